@@ -104,15 +104,19 @@ FC_SRC = \
             fc/rc_modes.c \
             flight/altitude.c \
             flight/ol_flightplan.c\
+            flight/ol_ekf.c\
             flight/ol_filter.c\
             flight/ol_ransac.c\
    	    flight/ol_control.c\
+            flight/ol_trajectory.c \
+            flight/ol_navigation.c \
             flight/my_test.c\
             flight/failsafe.c \
             flight/imu.c \
             flight/mixer.c \
             flight/mixer_tricopter.c \
             flight/pid.c \
+            flight/rpm_filter.c \
             flight/servos.c \
             flight/servos_tricopter.c \
             interface/cli.c \
@@ -188,6 +192,7 @@ FC_SRC = \
             telemetry/smartport.c \
             telemetry/ltm.c \
             telemetry/mavlink.c \
+            telemetry/mavlink_rx.c \
             telemetry/msp_shared.c \
             telemetry/ibus.c \
             telemetry/ibus_shared.c \
@@ -255,6 +260,7 @@ SPEED_OPTIMISED_SRC := $(SPEED_OPTIMISED_SRC) \
             flight/imu.c \
             flight/mixer.c \
             flight/pid.c \
+            flight/rpm_filter.c \
             io/serial.c \
             rx/ibus.c \
             rx/rx.c \
@@ -0,0 +1,4774 @@
+	.file	"blackbox.c"
+	.section	.gnu.lto_.profile.162a51487001df88,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.162a51487001df88,"e",@progbits
+	.string	"(\265/\375`\177\013\215'"
+	.string	"\006o\256?P\350Mkn|\346\211\326z\207\331\302\33186\001\224\b\203\305}\344\331qF\245Q1\233\026\n\024\207Q\024\335\031\001\020\324\266\327\233\017\3405F\f\2158\226\354[o\222\264\324h\223$m\035\217"
+	.string	"\232"
+	.string	"\252"
+	.ascii	"Z\326\234\212\007\370\036\340\0028\375)\273\266`\001\300\364"
+	.ascii	")\21414\344E6E=\032\227\212"
+	.string	"\027\325U\3648\272p\343\302O\241\2260\354\221R\013\221i\246\227\226\266\305\341\241\261&i\322\341%N\374\374,N\374\274\247\333\246\245\330ER\023\376\376\335\341h\360|\370]\270e\220\236Y.\255\004\201\277 z0\b\374<\376\002\301\345\231\371l\357\367o\273=\367m\357\335;e\261\347\216\330\250\362,\016\3154W\372\376\f1IT\247\004C\351\376\ba`\035\2668he!g$&\355\317\006\rX\306\215\243@\337\262\020\225\261\fW\366\004NBS\302\005C\325N\356\304,-\254R[\252\357TW\240\232z\212\302\023\226\332.\265\204\261\314%~\226oI{\242t\352\314P\2510u\357Q\243G\370\0165\204\241~\260\203\357\rn0\203\357\307\340\230>_jQ\0136*H\260\212`\343\001\003\005V\221\004V\327\236\033\036^\233\003\3529`\325\252\002>\235\324\363\311\251iu\2372\007\233*a\004"
+	.ascii	"\361\320\221Q\364\224^`\336\243q\350\274X\311\361\351(.\311\""
+	.ascii	"\034VX\347\250\354\312\r\353c\343S\205\213\215\321Ak\234\350"
+	.ascii	"\251Q\214B\221B:\261/n4\326W\233\202\261\265M\232\361t\346!9"
+	.ascii	"\004'\343\352\253\253\364.xb`bXme\265E{{\312\250A\202qj\006\007"
+	.ascii	"\314\355Er[u\325\353+\206\253\354\311\213'\277pSjg\221\033F."
+	.ascii	",|$\3121\273\373\322\302\232r\210\226l,V\334\013\364\246\316"
+	.ascii	"\234\212\3655h\347\006\217\236\024(N\230(Ab}E\241\266\036\335"
+	.ascii	"E\032!\202+D\022\355\035\351\2236\007\304\007\017\305\213C\272"
+	.ascii	"eJ\250\362,\016\315T\222\004\314Db\026\0024\305\315\374:\345"
+	.ascii	"\254\251yb\0369?\221P\347\241\351\3622\275,J\b\312[\034\263\353"
+	.ascii	"L\353j+c\004X\266TJ*B\024$\267\006G\304\2629\013#4\004\005\224"
+	.ascii	"%\214L\210=k[2\026d}\025\361\005\037\267\211\002\251\f\b\327"
+	.ascii	"\\!\320#\210\357\037\276{\270w@\263\266\276\350E9\254\365=\353"
+	.ascii	";r\273a#z5|/p\304\032k\302\031\276\223\335&v\320\346z\0307\002"
+	.ascii	"M\273Fo\215x|\3630\371\272\333Q<\005\316\225\311\301\3518\201"
+	.ascii	"+\250\201=1\"b\"#)I\262\034\321\004\020*\310\\\235\007\022 \004"
+	.ascii	"2\220H\021*\221\021\221\240$e\024\224\024\024\n\315\001\030\204"
+	.ascii	"\230\300=5\345\227{e\225\341\247Y\265\223\251/\207\250.:E~<\322"
+	.ascii	"\346\250\003R\275@\034Dy\335K\341]\266\237\347_\232"
+	.string	"\332?N\336\"\240\243\2170\265.OH\214n\254\037\376%z\204#\364g\244\\`:\013\306]/\214\234As<\f\031\276\301X\232\320)dsK:\373T\326y\274\335\206\374\032\222b$\347\245?h\314xs\350\277\221|\203\234\221\274\224\327\207\236\303\237\246\351\271\275\262\t\023A\301\254G.\006\206\246C\234Q\261e\260M\264\257\372\245\327\226{\336O\355\213\246\007\032*\375\030Zx\020x\27659\211\277)\341\304!\364\252\3329\263\331\231\365\030\364s\210\202E\260\321\003|/\207y\315\330\001\366\224\336)P\377\200\321\346\263\371[\034i\214h\232\362\003J#\006\327\253\336e\354o\351\201\274n\217\033\033\223\277\332\352\212\310\370H7\275|\235P\251\236;\336=\304\310\261\037\331\224\205EF\216\r%h\\n\241{3T\300$|bl\\\355\231\003lA\275-\3454\231\252b0\225\246\003\324\361\205M"
+	.string	"\265u\263\231\237\264#N\234\301G\016\250\374*\233\313\362\251l"
+	.string	"\236M\200q,\342\3127\221\320W\330):r\363L\370\026\366U\207\306\005\211\200\301|o\036\225U|\f\263\026\211\326 8\315[\262\236\350\bD\250\220\222#i$\210-t\336\375za\254#\251LI\316E\200\022#\302B\327\013fk\033\363\236\321/\332\255\372\363\354\251kg\377\270SH\n\177\225:\354\244(\025e\371IT\332\031P\2044\313H\376{\016\f3\267\373S,\234\264\355\372\370\357si\007\370\276\030\317\262\330\305\237\314\277.\346\026\251!\361o\270\252tlq \231F;\025\2622\235q\310'\211\250\337U\037"
+	.string	"\341\221\013\273)\031B'\200\024r\274\301\030q\224lP\016C\351\225*\362\327A\353"
+	.ascii	"3\227\023"
+	.text
+	.section	.gnu.lto_.ipa_sra.162a51487001df88,"e",@progbits
+	.string	"(\265/\375`\226\004\265\n"
+	.string	"\002\311\033  E%\035\300\364\f\fH\260jUU5\306I\004\236t\200\037\206\204y\350h5\335\310\2262\005sf\304\230\032u\272\232\276t}\313h]\230\244{$\342\241\033\304y\177<\035\316o4d\206\r\363\027K\205\302\233pI\204C\356\307\217\365"
+	.ascii	"@-G\243G\306\212&n\304\363\3604\334'\264\206\r^\300\213W\355"
+	.ascii	"$\313\036\277\027W\001\001{\250\360\224\223\326\200\202\241\262"
+	.ascii	"\252\016\022\200\2254\006\265\226T@\222D\212\212J\312HJ\215\001"
+	.ascii	"\001\2230\364\034d\376:\2529%\332`\353\361\032_j\344\270\350"
+	.ascii	"\f\221\351\341\336w{\305\031!\302\256\265\272M\271H\033R\266"
+	.ascii	"+\002j\264X,\035\2468\307f\347\372\311\202\004!\320W'\344\262"
+	.ascii	"\325`.~O\272\356\242G\317\364\341*:\210D\262\215\302\243\033"
+	.ascii	"\230\277\017\374\261\353;\006\331A;\"\332\310f\262\260\025XE"
+	.ascii	"#\231\325\257\245\013\3726\201\200\374z\035\201&5I\202\202\261"
+	.ascii	"\212#q\317\257\r\227nT,\370\270\331\211m\341\213y\311\333\240"
+	.ascii	"\274E\301\231\275\250m}\304\366{z||\351L\204\203\3752R\267\256"
+	.ascii	"\267\362 \2041\245\342\024\244i\267?7\305\306\231q\256\024\036"
+	.ascii	"\360_\037D\037\212\364\256\005"
+	.text
+	.section	.gnu.lto_.inline.162a51487001df88,"e",@progbits
+	.string	"(\265/\375`\375\027-<"
+	.string	"JBL\016Gp\\N:\177`\002'\224V\rtC\333\0370\005\365\303X\307qa\037X\275R \324?:*X\250\316\344H\260\214\024e\372w\271\266\f\001:\2279!\216u\023'\216\025{\376a\347Cj*\033yb\311\226;\005\277"
+	.string	"\315"
+	.string	"\327"
+	.ascii	"P\274\204\007S9\273\200\337\332[\236\355\033\335G\2434@\357/"
+	.ascii	"2\230\372\237\265is\3148v\216\277\026\207\026\305\2321XQ\317"
+	.ascii	"F1\230\224.1l\222\377+u\307\306t\333\"\334A\366\247}\317Zw\027"
+	.ascii	"\235R|\325T\226\375\215\301|\366?\002L\243\367\304rqhS\220\240"
+	.ascii	"\256\233\215$\226\005n\037'&2^dw\033q\337\267{\020i\377\023D"
+	.ascii	"\376@g\372!\377\374yn\272\313\356\366\371\213wLw\007\355\376"
+	.ascii	"\357\330\376\277\347\300\366\307/0\\\267\302\315\017\"\037D\362"
+	.ascii	"o\201\316\177\370\324\236\317D\356\356F\177\250\333\226\305t"
+	.ascii	"r\200\377o`k\3716\352\2425\223V\214\376\0067z\023\277-\234\321"
+	.ascii	"v\205\354\214\275\352Ibk\221\330\242\035\330\252Y$\246z\321\205"
+	.ascii	"\"\361\324\256\212\f\232\304S\326\247\b\233'h.\347\023\3140\313"
+	.ascii	"\264\020I]1K86\365\022V\340\331\251=\323\237\351\022_\275\312"
+	.ascii	"\304>\232a\224\360n\373\226\231\316xO\373i\013o\234/Zixj_\355"
+	.ascii	"\265\205WG\2254`\320\003\373\300\333n\341usC'\216w\356>\377\354"
+	.ascii	"\026\262\326U\232\362\274\332\375\342\275\340\205\376U\335}\374"
+	.ascii	"}l\247\330 \257\370\377+\"\032\022R\377 \037\320O\217\3473\245"
+	.ascii	"\342\277\265Uf\320 \2638\200[\247\013e\307\230\221o\271\003\373"
+	.ascii	"s\337\334\262\230\277?\352\026IBQ\323\202\325\334\262\230_\273"
+	.ascii	"\201'V\322\335\013\376;\356s\2722]$\2236r\366\251\355\247\303"
+	.ascii	"\233\366fEw\336.\331\266\355\t\300{\016Jl\223\024\334\333\252"
+	.ascii	"/\250\022S1\345\354\232Mb\252\177\275\307r^\222\034f?\036\244"
+	.ascii	"\",PM\327\363\\\262O\2376\365\316\3519\025\316\355\324\263\272"
+	.ascii	"\236\327\363*d.d\\\300\270\310\313\356>\032\336\272\272\2727"
+	.ascii	"\275\377\036\330\326\025\360\001\271\241\036x\352\350\257\221"
+	.ascii	"\351\352\352\356Px\b$d\304\332\250bq\250$Q\017b\367\017Xu\314"
+	.ascii	"\272|M\3675\007\350J\f\020|\003\361\3720\242C\215w\206\365\345"
+	.ascii	"\345\350\332\243\215\344\f\004\327\300i\361v\206G\030p`\373\234"
+	.ascii	"\230w\fGt\213R\t\020\242\247[&\026\367d\350\025zld9\030kZ\352"
+	.ascii	"\023\307\330\332\312r\022\3177r\326\021/6\r]G\274\330\022\334"
+	.ascii	"\036\221\267m{|r\230\271\245Y\361X\024\2709iV\356.\216\366X\373"
+	.ascii	"\035\232\347M\206\035&W\347\035\343\275\363\246Uf'D\201S\317"
+	.ascii	"u\267\357E\247\213.\211\354\025\246\205u l\331&\254\300\207x"
+	.ascii	"\332z(\277xo\"^&+.2.C\216\236\370l\256\331,\2720]\363\005f\253"
+	.ascii	"\347KE\356\024\377\265\\\307\036\312 Z\231\220\271\nG\361\217"
+	.ascii	"9\261\306\013\207\f _\312\030\220&\204\233\370\377\253\021\204"
+	.ascii	"\b\220_Z\302\236\355\2645a\023\"C\022\345\310\320I\302\310;\232"
+	.ascii	"I5\036\037.\213\211&\364\021?\325T\265\351\272\236\327\304I*"
+	.ascii	"tJ~\272>]\213|Uf\211\017\337S\340\323\025H\344!C\340\030\371"
+	.ascii	"\371\331@\241\033\373t\035\336"
+	.string	"\246\032\234\220\201\317\250\241\261B\"C\"\"I\222\244\003\241\004\2041\345\230\204x\003\022 39\006\242\240b\306 \203\220\210\210\210\210\210\202\242$)\2445\t^\240\366o\375\220\003\314O\277\350I`\226\026\020F\004\033\350\204L\202X\363,\345O\032\250\355b\274\266\243}\341\370\265e\344\221\232a\321p\211b\222\037\202r;A|\016[\0164\311\316W^}`\356\206\222qN\377E\013\210\276\220\217\211ff\226\354\237\337iN{o\222\341\302|\275\304\322\0057\031`w\225\027\013x\324\340\005A\031\242\226s1 '@\317D?\265B\241\2653k\031\217\3653KR\226\244v_\343\264\201fkf\234\344\237\t\200T\017\337h\301Zr\b\221n\001F7\254^\017\275S\271\356\252\240v?\021\314^X\3754u,\331\214\333\254\245\241\321\314h\341B[\037Y*E:Ih\277\347\237S\276\250n "
+	.string	"\327\323\342\f "
+	.string	"\330@\234m\263\nr\343OO\217y\232X\020\212\343\242\352\ns\215c\332\031v-\273-\330\334\250(\232Y\351\336$\272\310\"\027"
+	.string	"?\252\373\303\205\270X\212b\242\327\b\b\302\330,\325z\310k\367"
+	.string	"\221y\020@\206X;\203bJ\242\355$\225\022\302\354\263\034\325\003\372\344\370vvT\305\362\345\364)\371\302\256<\303\353\372\353`\377[\352oo(\213+!\023K\312\264^\200\325\350\246O\211\346\026\355\035v\3012xr\263\251x\367/\226S\325\030\350\244\266Wx\334\343"
+	.ascii	"\021\021\243\002\333\034{\007&\353\243\274\355\272\336\220\351"
+	.ascii	"\277\2445\265\341C\201\"H\317\276\332X=RD\267\201t\345\217\354"
+	.ascii	"\231\341\230\332\215\303\315\n\206\217\2513\032\306{\022\270"
+	.ascii	"\320\235is\376A\234%4zO"
+	.string	"y\203\323\252749\017v\244vC\322\261\\Cg1\355|\240/\247-\324\361Q\343#\355lnuNc\223\005\321\t\375\221\b?\244\020\244\240\303\205t\235oZ!\372L;\306\246\364\356\246\275Q\346n\260\226?,\236\003D\036g!\304\310\216\215\242\025O\365\241\277C\034\213\346[\231\215\236\\<\021\275\0211\372g5ua|\204\300+\231\361\022\032O\254\306\013Q\n\021y\021\202\030\247EbS\034C\034g&\013\352\221\264\022\314\354\253*_&\325\353\205\331\227\326\223{\203\312\006^Pp\262\220\332\331\210\346+f\250H\276\333WE\256\017,\272\300\244\\\273s\243\002N\234\240\244\320\214\345\266\307\t\224\302\220\267\364\224\351x\263I:\365\274\335\002[\374\211\236\235\306\331\3537\324|\376w&\002anK}=7\322\f\234\306\367\n\254\341)\210J\026<8\242~\330\230\304\303J\362\247\340\330\334\004"
+	.string	"xZ\2475&\354<sZ\313\302\232QK\364~<wqut\364\270\"\347\251pd_\307\322E\277\305\335TZ\204%6\267\017\245\336\210\320\205\272\364\rh\361\023!\233\262\0070\342\363\224\205\027\341<\260\325\273a3F\323B\332\321\263\237o\220\355@~\266\016\322\326F\017\262\230G\326^!\b\301\250Cv\2718\022d\016\333b9M=\367\237\022W 8\242\321\253\275\344\252\277\265\205\220\016\261\r\241\344\r9v!|,\003\224W\272\332\341\317"
+	.ascii	"\3255`\227^\307\202\301\333\264\223m$\361\302/\363\373\336\006"
+	.ascii	"\270\341[\231\346\035\240\r\324Cf\b&\257\220l\300\231R\t\377"
+	.ascii	"\254 _\001\201\374\0276\005%\367\r\016\243\274\327\004\360\353"
+	.ascii	"J4(\311Xt\312`\024\1776\325\245n\030\351(;TF\344Ec\373\013\216"
+	.ascii	"r\noz\367`\252]\t\214\001O\305Y\322\221\265\357\255\240<\262"
+	.ascii	":\325\311\317\245x\305\f\271bI\325\020\364\227\226\260\002\036"
+	.text
+	.section	.gnu.lto_.jmpfuncs.162a51487001df88,"e",@progbits
+	.string	"(\265/\375`$7\205c"
+	.string	"\272o\330\027<P,7\007\"\2248\321(\236pC9\261\002\257B\020\f:\257\002\274\354\255\273\036\370\275\\0\262\263\243\205\355\232\355'\020]\030\260\200`\242\267\032\251\013#\036\321\277eK\333R\246\024a\001m\001x\001\356.0\346\341<\372\027\316\232F\027\306!V\270\243p\367\021\356 <\270\331\304\033\231\365\326\326\013g\023i_\024\312\331\304'\363\370[\217\251\2500\006\374b\300\257\013\0311\360\373\026\277\266\301"
+	.ascii	"\203\327\340{\017\207\303!\306/\244\2441\2061\301\273\360{k\220"
+	.ascii	"\225%\341u\027~i\370\305\372\307\b\360\213\305t8\273\001w/@\300"
+	.ascii	"\3377\364n\262=\350\261\336\202\005\315\305\365\341\303\027%"
+	.ascii	"8\037>\003<\220\306*\222\032\016\207\303\177\240\363\027\275"
+	.ascii	"X|\337\257\363O\347\361\277\237\300\004?\205y\201\261\316\306"
+	.ascii	":\243\200;\236\007\217Yz\366 \337#4\023\366\031\367&\363?B3a"
+	.ascii	" \347\312c\255,K\220\320L8\310\271\362.{\\%,$4\023\036r\256\274"
+	.ascii	"G<\177\205\350\317\223\341\233c\375\371\177?\377}\376\201\366"
+	.ascii	"\177\240\361\347b\261\313\346/\240\227V\350\205\211\364\277\250"
+	.ascii	"\033\370\337G\334\326\337\005\177\236\317\303=j\315\347\003\350"
+	.ascii	"\026#V\261X,~\236\360z8\326j\265\3418nH[\373\373\177\347\337"
+	.ascii	"\316\343w-\257\345\235\221\306\357\370\376\013\025i\374\016\244"
+	.ascii	"\006\316\232\206\337\374\217s\261H6\034\362\236H\343\177\377"
+	.ascii	"\305c\231\377X\366\356\243\013\374\272\300o\306\257\210\377\317"
+	.ascii	"\276\345c \367\f1\002\370\227<-oAy\334\220Y\3574\273\013\231"
+	.ascii	"\267\225\375d\017\371Df]\350\207\356\330\310pH\304\001\306\265"
+	.ascii	"M\222\310\254\213lb-Q.\326\006\325\364\220Y\313\251\215\311\305"
+	.ascii	"\332\227\032\226\267\266\204\314\2736\324gd\326\272\021\242@"
+	.ascii	"y4\0332k1Zt\025\335D\023!\325\tS\244#\233H[Df*Bd\246\242\331"
+	.ascii	"!3\222M\244\275!3\225?\315\013m\n\r\311\030j\2344&\032\375\214"
+	.ascii	"o\224l\342\250eT\2227eE\031\020\223M\314w\330\344-yJ\306\245"
+	.ascii	",9\331D\254\210\314\032\020\2317\224M\304z\360\0322o\177\361"
+	.ascii	"\027LE\312&\342#S6\361CU\331\304\207\364\204\334X\331\304\277"
+	.ascii	"\202e\023\377H\233e\023\313\030\271\270e\023A\374\0052k.\233"
+	.ascii	"H\222;<\344\361\360\213E\341p"
+	.string	"\210\236\244\036\353\374\337q\344\200\177\006~\252\177\354\345n\272\373\017{)\026\035\210{\351\376\303\317\"\235\0312\364\036\310\003\351\263\307\270\353}\270{\017w\307\336\2051\376\347\341\303\271\207\263^\260`\207\273\273\216\327\364\230\f\277\274\034\357#6v\262\037\201{\201\337_`\177\263\273_]\275\320\221\306\243)S#\266\373\006\034\230\314&\" \363\367\351\303\001\373\214\256\177\241\231\341pt\367\033\356^\203\206#@\360B4ZZ\277\024g\035[gN\373n\267\272@]\311\323\271\253O\313\205\360\312\335O\275\351t\246\325\312\232^W\216\262f\330\311\232\274\362\313\354Yy\2175K\267e\323]\351[K\325\324\225+;\366E\300\001\270j\202\371\326\3245\325\365\307\242\256/-u\354\001GU\327]Y\236[\242\256\t\226\272:\263dS\363\200\263\350\231\202\211\261\252\231\262h\253\345'\252\363\215\265>`\211\266@"
+	.string	"\256\256\272\325]\331_"
+	.string	"G]\223-{a\277\222]\335\265\207\345(P5\301JT=\323\322]y\355\t\300\321s\355\225_@/\364\274y\213\262@\327Dw6\377ZU\334n\305\235>\0247\367\320\346p\272\034\356T\3214\005n\005\226\3738s<h~\346\362\220\241{\356R|\005\372_\201.3\303c\026\004\025!B\235`\"\263\240\242)8\177\251\341\2509AF\217\202\216\242"
+	.ascii	"\002\224 NU\244\374\346RpR\233 \245K\301JL\376\374\311l\036\277"
+	.ascii	"Y4\246\321\324\0043\215gAM\372\227$\301\031\021\242\005g&\\\005"
+	.ascii	"9\3452AO#\227\273o\005K\005A\215\035\236F\2229L\026\023\f5\226"
+	.ascii	"\n\216\322Y\357\232\364\3232\021\234\317\316\n\025\272\3721\367"
+	.ascii	"\2622\333\0352\257!\263\266\221\261e\2615\331\243\310\\\345\376"
+	.ascii	"\342\335iO\"\363\026\nw!2k\013\231J\360\224\177\032\017\026\205"
+	.ascii	"C\002\356\362\276Ru\3473Q\325D\325\005\n\031(d\320\352\316t\321"
+	.ascii	"\0227\bm\356\001\356\312}k\332\246`(\253\345m\016\327\346\264"
+	.ascii	"\367\3304\005\352\232'\316eM\267\305}\255.\002x\233\313\216\366"
+	.ascii	"L\037\316\335\231\254\211\033\213\233\237\271\ngN\343d\334dl"
+	.ascii	"\\\214\355K{Ubf\257\312\305rb\026h7w\201?\027\030\243\312U\\"
+	.ascii	"\2509\252\232\272\266\274\371\0260gs\364\313t\325\025LUQ]\226"
+	.ascii	"\003s\331w(\273\235][\037Z\303\365\241,\013\324]9\332K\335\337"
+	.ascii	"\272\252\266\336\352C\317\262mQ\335\312"
+	.string	"\376\264\374L{\233\345\2716\267y\020\023e\275J\363\347by\213\352X\233\257?1\264\324\261\333[\255\256\354\346\351\334\364g\0133\307\\\325\254\265\353\257\326\256\277\315\202\231\276\215\252_f\257f\363\023,d\250(X\215E]5\335Y\335\\\b\017+\200\377\200\247/\rK\255\316\364W\272\246\027\330\225\r_\372\302%\241\256\274\026eyn\001\367\245\346W9\346\246`&\373U\246\256\317\324rV\314TQ\366\200\273\274\257\024\r+]_\272\376\\\264-{,\352\236\004\256\234\312\255<\314\034+\335\264\227\252e\017\330\236\351\017\200\315O\237\351u\232\350Y\206\231cV\276\373\331\034\375\215\271mk\376\302V5\313\205\360\256\374\314\005\202\373\250\322\n\035s\314\f\215\210HA\222$\215\001B\n\020\206%i\034\250\255\362\022\340\361`\n\003A\212\242 c\bA\206 d\024\"\"\"\"2\"\242\240\323\030E7"
+	.string	"\007\266\360\332PQ\313-mg\017\346\355Z\2439\367"
+	.string	"m\033#\354\362B\266Wx6T2Q'\222\321\264s=\257\017 \020\332\343\2670_Aw\244\325\200\250\356\317\257|\203\372(,_\246/\305\330FFl\251\337)\021\177%"
+	.string	"\240du\367&:^\322\205FF\332\031\177\354kn \021\371m#\217\300 \303\256\3177G\363zA\255\316f\316\261{\004\025\250(\\\037\262\004y\232m\252vu\0219\250\200\004r\265\222\255\031\003\244,)\244\345=Zy\320\003&\305\211}NB\335\270\213\035\331>\373\250"
+	.ascii	"M\356h\017\3001v\207shG\271vN\340\370F\"Bp5\345\223\260\345\326"
+	.ascii	"C\360rl\255\350\2779/tGfZZM\tR\253\271\025\223ja\215,\322\275"
+	.ascii	"\267%\216\377(\311Y7\337Qm5\221\221\201\251\013\352\251\021|"
+	.ascii	"\222\206\3270d\020\247\240R\255_8@\332\233\345\226|\346\030O"
+	.ascii	"WtF\277\325UEz)w$\373\377\030\307y\226)I\007\327\205\202\320"
+	.ascii	"\334\241\374\315;\365}T\322\364XV\201\203\025<\364\355`[U@\242"
+	.ascii	"Z\004\342\226\327\002m\266\202\f\214\341\225\002\355\006\035"
+	.ascii	"\343\321M\255\262\364]\233\301\215=\370\024\022\303\220\274\326"
+	.ascii	"\034\035\245\251:\210\271\203\250\254\264|\346X\f F\313l\376"
+	.ascii	"\362H\246\306\275\220\250\300\341Y\350J\234\331\337\233\004\300"
+	.ascii	"\3156\345\230\350M\343\300n\221\020:\026\274\236G\203\212\244"
+	.ascii	"s\"\206f\256"
+	.string	"\030\242\371 \262)\212^\240!\352\302\245\365R\023\274G\036dV\030\022\235a\2144\272\225\206\022\364\312\3466\024\207\316\243\306R?\346\316\223\032\003\372\0016X\206$\032\300I\r\203\260\310\222\241\352\313\312\3068\313\265%?\220="
+	.string	"\316\250\361E>\334T\206!B\215\016Y\207\241-z\214g3\020\347sH"
+	.string	"\004c\373\302<leL,\016\303\030\353\340`(\317\005\351\312Cr\342\303!i\376\205\356\223\023)\336\330A\024+\206*\201\360{\303\256\333[\355\372\253]\344QU@]f\253Ex\340\033U]\273\252\005r\004\353\227J\033B\217{w\222\2079Q\223\332\206 :f\002\3240>\t \221"
+	.ascii	"\332\244\317\314\205P\0262\242qG\002\301b\361\220\032\251{\021"
+	.ascii	"Z\266\216\357S\274eL\317\262`&T\227iB@\203F\252\226\235R\n\365"
+	.ascii	"GV\264\025\354b\2368\247b/\207L5\225v5k\022;\201\023E\372^g\266"
+	.ascii	"l\204C'\263A\353\2004\007\214I\266dA\310\036%\205cZ\223vX\310"
+	.ascii	"\361x\375\273\310\020h\357u\002\342\013\311(\266\267\254r\255"
+	.ascii	"\363\tM\310\300\300\272\262Eq7\363%\242b\204\361\013\303\367"
+	.ascii	"7\344\243\320^*%K@\210\333\335\207"
+	.string	"?A\230kv\311\017\221\026:x\261K\016;\201cA>\232\270\037\3504\215\317\245i\307'\"$\273\204h\363\217\265Y\306\272U>$\376\250\376\274o=]\257\250\310\231\347\375\365\0274l\245\244\203\367\246(\246\007\034\261HpOb\332\024-\016\244[v\206W\361\267\271\262\204\210G{\246=\2554\263\213\333\n4^\372\322-:\0350\227Gq\362\340J\034\253%\037\301\225q\t\275\246\001\023\tC\347d\026!\342\027\203o\210\322\303\266\254\031\320\301\303&D\236T\226\334l\275vD\017oIDm\261\267h\223\321\361\353yd)i\266@H\221\337\f\250Qre\202\232\264!=?W\b\333\276\336\027\304D\017\3053\216\363\212\177\366s=\272\322`a\352R}\234\211\211D\241\t\t|\254X\024\007\307\260\241\260R\222\360\244,\037\321l\275\310a\262\226\265+\300U\272\253\022\005\352k\202\037\360;w"
+	.ascii	"\376\357\202\222\322\034\0246Sv\227v\306rr<]\326&\033\035\013"
+	.ascii	"\346\030X\231\245@\275\245\320\b\352\304I\262\206A\022\312\246"
+	.ascii	"n\fc\272])8s/Z\347+V\315\016I\240\245\2118\260'\033YQ\316\002"
+	.ascii	"z\353\274\032\361\263\377\316T$znJ)vY\232\335+\366g\300\367\033"
+	.ascii	"4].\203\030ja\nD\236\324e\0068\234;t\020(.\235q\266\376\222{"
+	.ascii	"\253\3372\275=\223*\251\363p2\264\263\350%hY\0276\271A7%\364"
+	.ascii	"\017;o\310\205GK=\006C\332\375\005R\315\252\266c\003\304\001"
+	.ascii	"VCZ\337e)\rar\232\002\0049\215\327\370g\277\023=\370\220}f\256"
+	.ascii	"Q\265#N\347\242\305\267!\0026g\203\302\211.\013F,u\227\0173E"
+	.ascii	"z8\3262\343\205\356V,\244!=\306y\216d\310\222\017TO\032\256?"
+	.ascii	"\035\232\207\243\351\034\205\265\243+%/-a 8\230\345\214\364\r"
+	.ascii	"\334\256\350\t$3r\244\244\3238\231\036*\036sb\332\251\205 \260"
+	.ascii	"L\226\322D\347j\036\"\244\302\316\314\260\224\007\200\340A5\255"
+	.ascii	"\221\017A,D\373\002\325\243\351Tf\212\247N\036\030\317\275\256"
+	.ascii	"\374\316\322\365\335\246\n1\274\fx\377PR\377\006N\244\306b\215"
+	.ascii	"*\240\203;\250\177\225\257)\201\317\357N\261P\325\241\204\227"
+	.ascii	"#B\363\022n\037\210\202q\275\316\337-\205\204\250\227io\263\326"
+	.ascii	"\202du7fSTq`\337*i\016\332\0251\332\031i\260\177\325\314\255"
+	.ascii	"\033\212c\354\235\020\217@O#\300\350\337o{\205R\350\263\201w"
+	.ascii	"n42W\033\034\250\025\032i\311\004\035DrF\266\034\375\"\347\224"
+	.ascii	"\022Gv\336J\026\211z\371\300\332\352\017\210\240`\004+\rB\234"
+	.ascii	"\026\263\340?\246t<\262\306d\214\277<t\370\256\034\t'Rt\325U"
+	.ascii	"\265\376\027)\035r?\301\005\033\362\310\001\035\271\031\304\b"
+	.ascii	"\313\205L\251\217\367d \316\020>\230\2667G\255I[kp0\365\202p"
+	.ascii	"x\325\257\273\013\t\256C\230\246-\0130\354\020\252S(*\353\300"
+	.ascii	"\216\315\374\354\021\244\276G\253\247\210\372p\006\027\243\030"
+	.ascii	"pk\366#+H\017\203s\nO\240u\224P\217\2035\205\341\351\247\210"
+	.ascii	"\020"
+	.text
+	.section	.gnu.lto_.pureconst.162a51487001df88,"e",@progbits
+	.string	"(\265/\375 \213\225\003"
+	.string	"\262\210\033#@E%\035WE\021\270\r\317bXDwD\354z(\351Q\210$\225\241\300U\023\005\bN\300+\027\033\t\363b\315k5U75Q\267\3234\315\322\2154GSt\013M\320\374L\317\327\231\234\271\271\232\233\231\230y\231\226\257\362Q\346dJfdB\016x\f\340\270\215o\361)\276\304\207\270\207k\270\205I\270\203)\270\201\313\030\214\261V"
+	.text
+	.section	.gnu.lto_.ipa_modref.162a51487001df88,"e",@progbits
+	.string	"(\265/\375`\212\007}\032"
+	.string	"F\235aD\360t\223t\300\034\276\210\3543\331D*\241V\325\342q\377hN\234\346\004O\264\374\202\267~M\256\311hj\342\f<\215\033\360\250D\303\003\317\034\321\322\004=d|\270\254\304\n\273\303\275\361\241\326\232\330&w\nF"
+	.string	"P"
+	.string	"P"
+	.ascii	"&SY\224\312\2118W\200\023\300/\315\023\021\311\245'h\3053!5G"
+	.ascii	"\243\236)R\321\276=\t*\204\327S\235C\310\211\347\326)*\204\237"
+	.ascii	"\347\240\366L\3216\223\343z\2364O\024\355\217\255\260\325\326"
+	.ascii	"\b6\360YK{\264K\245\322\332A\210\225\256\356\274%\b\363\030\021"
+	.ascii	"\016\323\r\316F\r\03203d\324\344\300CX\022\243ML\246\312Tg\035"
+	.ascii	"\204y\214\236,\326\t\243\247\204\027.\332\242\005RI\374D\371"
+	.ascii	"\356n-\363\234k\031<\363\245_\251$`\rxk\276\005\0310\\?\204;"
+	.ascii	"\262\254\223q8\027\326\262\2733\357`\317TJ\300e\251\005\n44-"
+	.ascii	"j{f&\302}\360\034\252o\345\263\016n\240`%\236\270\2111F\023V"
+	.ascii	"u\344\350O\346\324\353\255*<\306\240\237\271\340\004C\250a\235"
+	.ascii	"v\2254\355\335\234\001\303-\224\362"
+	.string	"~\177\266\317\026J\301\376\250|&\204T\260\377\032e\225\210_\022i\223\004\311\021#E\210\f\021\322\263\323\274SS\323\005\001\362\303G\217\216`J\005\235x\024eDE\374\031\261\330\020V\250\345\007\361\341\323Cv\370\216F\026\007\231\323\206\337\205\36444\200\374\250AU\307f$I*\245\326p\002\231\261\242\362\021\320\231!\214\335L\222\024\332\317\306\270\033\265\005\030\226\241\325\372S*GN\250\216\013\3647\0162h\301\357D>\220\231I\271\271\272\006\267?!\221R\345_\314\230f\325\030H\321\315\001\035haU=\331\004\037\217`3^_N\310\362+\033\262\"\215x\335e\331m9\b\242B\253\2133\t\301A#\217\256\371S\272FS,\302\231\b\fI);0\225\362]\234\230-\253OAH\304\350h\317\265\277\272.fS\230*\213\326\256M\254\250\206\237\031\221\221\035\355H;\247(F\335\206*:"
+	.string	"\021\331\034\243R2\027\210\255\266\230G\026\017\200\\\240\350\004q*\037`N\363\223=\237"
+	.string	"\226\2615\264\251\376\353@6\307\030M{(l(\032\f\317\035\324%t\2546\004\314`3,\237\252D\201&\336\341\007\006\225\234\215\215\232\256\367\242\237\207\223\357\005\270\342R\214g\306OV\310\b\325!;\035\220\252E\254,\331\310\247\3060Ub\230:\217\006J\270]\205\223U~\275\377 3X\320\35173\201\365\217t;MUKn\032#\223\016D\253g\2454e~\330+\024\252/\236\323\315\031\3108\337\347\341/]4\240\234\r\375cHS\006\033{\314\314\b\212\311opC \202\304\302\260"
+	.ascii	"\263W\245Ls\364u\030( \370\316 \206'^jz\351\333\026\344\317\n"
+	.ascii	"D\370\017s\237Y\n\031\201;\341\3213\247h+\300\"\002\021\332\371"
+	.ascii	"\332\236\232A\324\352\260\320M\312\271*`\230\b\313\200\3029e"
+	.ascii	"#\035\253\333\235wC\246seq\326\241\003E\270 0\324\236\b\352R"
+	.ascii	"\244"
+	.text
+	.section	.gnu.lto_.lto.162a51487001df88,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_blackboxConfig_Registry.101.162a51487001df88,"e",@progbits
+	.string	"(\265/\375 \233U\004"
+	.string	"\224\007b"
+	.string	""
+	.string	""
+	.string	"-"
+	.string	"\005\001\212\001\206\200\200\374\342\203\337\221\035\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\374\006us\317\006uq"
+	.string	"\005\001\006'\001\b\205\300"
+	.string	"?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\005"
+	.ascii	"\314R0\345z\230\305S\324}\003(\002"
+	.text
+	.section	.gnu.lto_pgResetTemplate_blackboxConfig.103.162a51487001df88,"e",@progbits
+	.string	"(\265/\375 @\245\001"
+	.string	"T\0023"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006'\001\035\001\003 ?\202\210\200(\177}\277\001{\276\001y\275\001w\274\001u\273\001"
+	.string	"\005"
+	.ascii	";E\300=\220,\305\276\001\300\001"
+	.text
+	.section	.gnu.lto_blackboxHeader.104.162a51487001df88,"e",@progbits
+	.string	"(\265/\375 b\021\003"
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	"Q"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002\206\b\177"
+	.string	"OH Product:Blackbox flight data recorder by Nicholas Sherlock\nH Data version:2\n"
+	.text
+	.section	.gnu.lto_blackboxFieldHeaderNames.105.162a51487001df88,"e",@progbits
+	.string	"(\265/\375`\021"
+	.string	"\255\006"
+	.string	"t\013\265"
+	.string	""
+	.string	""
+	.string	"P"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\234\360\350\237\002}\273\001"
+	.string	"\005\001\006\025\001\005\005\001'8\206\b{\370\375Qy\276\004\230\375\001}\301\003\330\374\001y\304\002\005\001'C\206\bw\374\001u\307'K\206\bs\330\367\001q\311\001"
+	.string	"?\202\210\2000o3\312\0014\310\001\306\001\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\tencoding"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\npredictor"
+	.string	"\007signed"
+	.string	"\005name"
+	.string	"\013"
+	.string	"\016\253\3044\244\006\226"
+	.ascii	"\302A\246YI\346\323}\\I\341\323\351\006\345\036\006\212"
+	.text
+	.section	.gnu.lto_blackboxMainFields.106.162a51487001df88,"e",@progbits
+	.string	"(\265/\375`\017\013\345#"
+	.string	"\3066\313AP\350i\016\277\317Pk\236\242\237\030\300\233\363\362=N\314$\2653\002@\001\250\nJR\2077}\032h\232\244i\224$9\027\b\250zn\357\3618\225\2509B\267\324\330\021\013\306{\242\355/S\222\001\272"
+	.string	"\300"
+	.string	"\265"
+	.string	"o\025ik\2678B\036\244\255\337^\txw[\277\305\023\024\301\255\027\031-\332\032.D\351#\002\n\305\"\225\317\321\r\375P\335\326q\031X!Nn\350\204\006m-\367\372[\330\0024tA\201\266\226\213\377\202\332\332\320\333\330\266\236{u\022\006\256\263\241\307h[\317%e(\343\263gk\272\267\004\013\033\272\230\236\255\351b\237\222\206\254-\256\256\241\343\361\332\272\356\375P\372\2504\352\r\216"
+	.string	"K\350\260\352\305\325a*\317j\035\256r:C\257\223c\207kY\r\361!Bk\377\212xiR\362\254\254\210~\345#\017\222\370\245\217\243/\360\371Hz\006\340\020|>\346\257\234\201 \002\256\0058&\226j\2567"
+	.string	"\330W\252\271b\001^]\251\356Z\312R\373;vR\355\345PJ\037\231\212[T\216\325:L'+\206\016\363\253\322\307"
+	.string	"\003\342\314\221\343B\207\305/H\242\216\322G\001\004\334\264y\322bo\0015i\236\264Xl\200\214\2312Oz\f\006IdK\037\177\007|.\f\230S\233\005\267ty.1\364\231\f\222(\243\364q)\301W\021z\231\352E\370\255\f\037\313_\231\241\321L\222\370T\372\310\203I\201\224\367\324k\361\202'NN\315\3662px\211\222S\263\305(ILQ\372\330\340\210\221T\267\275\016\236\310\220T\267\305\017\376\307\007y \251v{\203$\321\251\364\361"
+	.string	"\204=\336\307\023_\310_}\221G\362I\236\3117y(\037\345\247<\225\317\362Z\336\313\177y1?\346\317<\232_\363l\376\315\303y\254\207_\353\353\374\326s=\236\317\363a\257\347\311\276\354\373\374\331\247\275\332\273}\370@/\350\343^\356\013\275\241\257\373C\257\350\027\275\335\337\375#\017\257\327\001\305H\206\245zY\036$\025o\307\202$:\\\3069\302\233\361w\376\246\021\243\375w\261N\204h\177\336\233\004\323\315\355\317CCh\320~\275\330\007\367\266\177\357U\002\003\364g\377^\034fM\350p\033\333\376H\003\036M\350\260\237x\177\244\230\300\357\367\b\0356{>[o\005Yj\r\272&\213\272&\246\3265j)\243j\320\035\363\n\023%\332 \016\323\227iH\231\252\272:\235\354\3175\241n"
+	.ascii	"\263\333\242\256y\002MM\026\235RM\246\324T\225\262\0335beM\022"
+	.ascii	"d\036\232-\320\323\254\301V\265\300\034l[v\314N%F\254l\216\224"
+	.ascii	"\3146\334uU]\234\247\371\313i\025\024J\303\227\331"
+	.string	"\325]U_>9\340X\241\204\247\031\005\325$\0254\325\246\223m\2338H\310\353\024\3126\271\353\3126\001\363z\203E[_v;~\307\363\370\227\2179\231\233y\037\367\343i\356\346\177\374\315\341\274\220\033rD\236\310\033\271\235;\362G\256\347{\037\200\330\250\221lD\220N\313\243P\231\0160#\td\210s\021P4\206\2141\n\023#Yh1\300Cy\230\276?\2120\025\250P\372,\226\002B}\370^\234\202d\"3\200C\002\022\221\244\030w\305D7\341\037\202\350\006\352\201Cg\030tZ\330\224\226\372i\037~<\236\356Q\034X\244+t\027\200\021\360\256\030\246G\370D\224\305\241\0262\276\360\252A\364\002uE\235\260\244\350\333\345;r\237\357\201G\346\333;\340\021\363\350;\216\b`\251\b\023\375\026k/\3152\216KE\304\300D\316/\224\303\372\276\202\177{0\314\017^\310\222y\203\007#\377\302\353"
+	.ascii	"\253\254\02078\223A\205\377\022\373\240\327\255\013\001\371+"
+	.ascii	"E\352z(\177\376\312\030BA\340\275M\\\027\037n\005s\003\347\255"
+	.ascii	"\242\374\037\273x#;\337\256\254\367\020\026\340\210^\242\362"
+	.ascii	"oj\201{J\241\340\355r\231\211^\274\"\257\234K6\n\224\346\216"
+	.ascii	"4B\363\374_\030\376\013\3313Wp\302\030\026e\236\234\314\265\304"
+	.ascii	"Z(\247ooUF)$@\310o,\211\330\232\305\364\2207\226\331&j_4\267"
+	.ascii	"1\3430\213\036\n\275X\321h3\005\fC\033\277E\206\375\265m\247"
+	.ascii	"9&\341+\005"
+	.text
+	.section	.gnu.lto_blackboxGpsGFields.107.162a51487001df88,"e",@progbits
+	.string	"(\265/\375`<\001\025\013"
+	.string	"\204\021\272\001"
+	.string	""
+	.string	"v"
+	.string	"\005\001\006\035\001\001\005\001\006\030\001\177\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\255\222\331\277\n}\276?\202\210\2000{y\277\001w\275\001u\273\001s\273\001q\274\001o\273\025\001\006\005\001'A\206\bm\230\375\003k\302\303\005\005\001'L\206\bi\330\374\003g\306\307\004\007\001\005\001'Z\374\003k\314\315\001w\313\001u\274\001s\312\001q\273\003"
+	.string	"\330\367\003k\321\322\001w\320\002\005\001'e\206\be\230\367\003c\325\326\035\001\023\n\005\001'q\206\ba\330\366\003_\332\333\331\3308]3\334\0014\327\001\324\001\323\001\317\001\316\001\311\001\310\001\305\001\304\001\301\001\300\001"
+	.string	"\022GPS_ground_course"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\nspeed"
+	.string	"\raltitudecoord"
+	.string	"\013numSat"
+	.string	"\005time"
+	.ascii	"! \360\"\022\233\007 \030\376pC\030!\002A\2242qO\264\363\030"
+	.ascii	"\343\363u\221VpK\"\335F\207\3148Oh\250\247dlBP\376\033\222\303"
+	.ascii	"4\306\261\333\255\374\267\3212\376g\270yf\277m\255S\326\305\320"
+	.ascii	"\203)\002"
+	.text
+	.section	.gnu.lto_blackboxGpsHFields.108.162a51487001df88,"e",@progbits
+	.string	"(\265/\375 \302\235\004"
+	.string	"\204\007\177"
+	.string	""
+	.string	""
+	.string	"7"
+	.string	"\005\001\006\035\001\001\005\001\006\030'\002\206\b\177\005\001\212\001\206\200\200\374\234\360\310\310\n}\276?\202\210\200({y\277\001w\275\001u\274\001s\273\001q\273"
+	.string	"\230\304\004}\302\303\001w\301\020o3\304\0014\300\001"
+	.string	"\tGPS_home"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\n"
+	.string	"\303*PB\b`\223\252\f\005\222\301\n\257\243\354\002\373R\306\033"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_blackboxSlowFields.109.162a51487001df88,"e",@progbits
+	.string	"(\265/\375`\257"
+	.string	"}\t"
+	.string	"\304\017!\001"
+	.string	""
+	.string	"\202"
+	.string	"\005\001\006\035\001\007\030\001\177\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\271\232\341\311\n}\276?\202\210\200({y\277\001w\275\001u\274\001s\274\001q\273\001\005\001\006\025\001\004\005\001'E\206\bo\330\315\004m\302\303\003\005\001'W\206\bk\230\315\004i\306\307\002\001\005\001'f\206\bg\230\314\004e\313\314\312r\206\bc\330\307\004a\316\317_3\320\0014\315\001\311\001\310\001\305\001\304\001\301\001\300\001"
+	.string	"\026rxFlightChannelsValid"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\021rxSignalReceived"
+	.string	"\016failsafePhase"
+	.string	"\013stateFlags"
+	.string	"\020fModeFlags"
+	.string	"\025"
+	.ascii	"\022\007\001\013\253\016l.\003\207\001\363@\346S\226\001#\300"
+	.ascii	"\3506\222Q\246e\300\013`4\310\030xV\225y\302*IA\031\276\330J"
+	.ascii	"i\020\003p"
+	.text
+	.section	.gnu.lto_blackboxOlFields.110.162a51487001df88,"e",@progbits
+	.string	"(\265/\375`\332\t\r\036"
+	.string	"\006m\252C`\250Q\007%\226"
+	.string	"\200!\211P\260\222\260U\223\210 \r"
+	.string	""
+	.string	""
+	.string	"\320@U5\320\203\210\347\247\325Y\026\264\366\3331C\346\344\001 F\213\\\374)\357`\363\201\r\235\305\213\351\236\023\200\0040K\226bJ;\231"
+	.string	"\230"
+	.string	"\226"
+	.string	"\215\262X@\350\254\3754\fE6\250\375\264\314"
+	.string	"\320\237\366\327p\224X\237\366\327r\203\260\267\3654\333g\303\357\340\316\333y\360\264\317\226\321\007H\255N\326y\033\314N\373\215z\271\342\205\264\321\333\r\002\234\267\345\304\031~\033>#\254y\273\r\233\341\267\345\226\340\365v\0324C\324\013\373\204f\032\243\325F_\037\201\215,\321\310`\037M4\231\267\313\244X\321]D\031[\030\272\206I\371k\311\265F$\026\233F\243,rEO\033=j\247\31655\324\255\321\223\313y&=\005/\326#mtIK\026\365\375d"
+	.ascii	"V\252\250?\206\003H\211\242\376X\026`t\322D\375?\030D\256\330"
+	.ascii	"6\322F\007\034\221J\222\264O\326[i\243\004\214\024\031>Y.\340"
+	.ascii	"\\B\206_\206\r8\220\037\303/\313\007\234\307\216\341\233a\025"
+	.ascii	"i\243L8n\204x\263\274\313\025\177i\243\b\222N\303g\264\177\206"
+	.ascii	"\327\264\321\246\344\021\351E\207\301\373\263\214\2256\352\344"
+	.ascii	"[\336\242}D9A#\266\366\321\360\223\332\"E\355\243e\016i\2438"
+	.ascii	"\005\310Co\243!\342}\"\314\346\212\031\3222\274\206\333\360\034"
+	.ascii	"\256\303{\270\017\017\342\330\2078\021?\342H|\2113\361'\016\305"
+	.ascii	"\2478\025\277\342X|\213s\361/\016\306\307\270\321\311x\227\237"
+	.ascii	"\261\340i\\\215\263\3616\016\307\3438\035O:\230+\035\217\347"
+	.ascii	"\361\260\n\276\207\202\207W;\352ib=\330\207\\\261\257\244\314"
+	.ascii	"\245\372J\354w\262\372\312|d\247\216\372K\f\3058G\216\372\313"
+	.ascii	"\234\344\215\033\365\231\370\266\346K}f\306\251\241\361R?\214"
+	.ascii	"+5SF\375&FB\036\325o\346$1a\324\027\303J^\272\250\001'\353\353"
+	.ascii	"\t\3213\b\354\005\251F\260W\253o\312]o\356z;\335\016\302\335"
+	.ascii	"\006w\305\255,K\302\312]\225N\021lU/H%\374M\261"
+	.string	"\255\206\037\260\027\354]\271\353\322\311\333\005\177\273*wE:yR(\200YZ\274\335\210,\335\257\267\363\351xnP'\025u\002I\260\256N\b\004\272:\245S\310Z\235\330\371pg\233\3513\255\246\277\332M\277\3519M\247\225\235{\331\314\336\323|\332O\217u\240\026\324em\326\205\332P'\352\264f\324k\335\346Dw\341/<\206\007\200\257\250\221hD\230VA\352\324h30#\021\031R\007\021`\034b\b\202\206\013N\215f\027\016b\360\262|\204\353n>\202\371\244\031\324\221\312\201\232@Z\341/\322o\213\022\304\260\305\260\226Q\\c\370\335Dtdw\033\322\221\335\255\004\2011\023\227Y@\b\262\200\356O\316\345\214h\3515v\242\245\272\002\260\001\215\240Fy\355\373p\t\240\360]\213\fL\273\327\232\003\203\356[\326\016\247\371Eu\332\214\037\251\301d|\210\200\326=\306\"\224m?j\017 \206\315"
+	.ascii	"\376\364\210\274Dp\252\0046 ;\225A\370\314\371Q\373\376l\320"
+	.ascii	"\001\265\3423a\342\340\271\2225b\334\230\357\301\375\fD\032y"
+	.ascii	"\275z\374\307`&a\377\253\302\317{\376\t\215}\213\002Da_p\342"
+	.ascii	"\275\253\370\177\257\320K(\266\247\017`\331\202\363\373\f\321"
+	.ascii	"\327\347\360\033^8<\030QV`3#b\021O.\363 \305\"\271\303\210\312"
+	.ascii	"\016#PA\356a\221\021\031P\013l\277\223?\235!Lv\247"
+	.text
+	.section	.gnu.lto_blackboxMayEditConfig.139.162a51487001df88,"e",@progbits
+	.string	"(\265/\375 \375\265\006"
+	.string	"\222\f.4Pm\222\016'\217\250J\270:k\237\005\200\301\n\243).\032\253\352\317\276\375\333BC\035\025\334, F\363\314\314\"\212\350\303\005\333\230\371S\207mm\023\231\002S\027\211*\243@a\0262\257!\001\303\360(\353\341],W\016\b\326\203\250*\353U\264\354\210\002\035\364\334j(E\304~6<\355\250\207\346j\034\261q\315:\335\r\245S1\200\242\343\266\3278\016/\276R\242\305\357F\347\256d\031\215\\[&h3I\221i$\372\257\257\\`p\215U\313"
+	.string	"U\024\362\371(\311\324\036b\024\253\303n9*\221\234\200d!N\035\300Af\356\262\320D\307\376\003?\301_\021\n"
+	.ascii	"`\251'3 \f3\205\273\021\312\022\327\304\307\210\274\204\310\341"
+	.ascii	"\316\231\332\371\004"
+	.text
+	.section	.gnu.lto_testBlackboxConditionUncached.141.162a51487001df88,"e",@progbits
+	.string	"(\265/\375`\261\013\r6"
+	.string	"\232\\L\024D`^N:gV\306\264\022o\255a0\035\006\313\252\305}\2131,\347Y\355\217\344qE\257\177@Lx\312\036E\007;/\030\313\360\032\031\001:\003MX\354p1:<\013\355\313\2647\263F,!dK\231\0023\001\025\001:\001\375\336\355\253h?M\373\350\355_\264\337\267\317\fT\246\035!?,\\\333n=\361Z\271\324\214\223\377\374\377\306\017\374\337\375s\025n\273\301n5Pb\213U\246E\246m\233\f\336`\345T"
+	.string	"\037\251\234\242\\T9\375\377\007\020n\234\345\346\331Vo\213P\326\026Bm\333\214\272I\230e$\323\222R\322\021"
+	.string	"\322\221\261hTD\034\n\211\202\300\237o\355\251)z\233=\377\272\254\030\331\306L]\307$\264\304x\230|\224\324\230z\222\330\370\310\326"
+	.ascii	"\2448i\244\306\303\214;\372\005b\3021\242q\021\315\b=\332J\323"
+	.ascii	"\3429\256%\350\223]\031A\274\306"
+	.string	"\305\244\213\306\020\271\207\035\023\314\360\214C\214\205\274\306%\326Ds\\a\250\2005.\260\016^5\246\025\240\0036\346\217\307\230K|B3f\330\n\224\302\364\362\323[\211\260\232\225\242Oap\202\b\273r\240Gs\312\352\200]\311F\331\n{\270\322aW\345\216\354G\033_*S\322\232(\225\234\031\371*\342\205\365\353\272jSQ\262\256\035L\306Ue\330=\251\266m\337Z]?\370\001\370o\024\377%\374?_h!\345\333\235\033\216/|)\364x\373B]tK\226\333U?\317\267/g\345\341\350\347\203\375\247P\321\254\305\267\233s`rW\327\352\274\205\233\360\344\254\372\020\201.\035Zn\335\231\317\235\307Al\220\362\234\365\034\325\3319\3371\346\241;\323\271\363\330\247\030\307r<\207h\364\245\326\216\3019\307\271\363\310\207\315\260\315\331\215\360M\315y\315\235G:l\210\316\234\321\334y\214S\006\311\234\313"
+	.ascii	"\235\2109\217\3711\217\265\314350\3470w\036\337\224>.\334\205"
+	.ascii	"\275\334\271\362\272"
+	.string	"rh\237vU\244\264cY\316Z\356\244P\3075TN\371\312\177'\277\251\205\031i[+\016\373\357l\255V\001\247\307\033\027h+\254=\353\274\277y\325w\371\363}>\237_~\315\016\365\376\323\373\n\336O\360\376\201\367\r\274_\340\375\001\3577\275\037\340}\344\373K\357+\261\033\363\321\3277\372\372E_\337\310\327/z\237\270\366\207\267/\274}\242\367\203k\037\370\376\357\366}\275\376\252\006V\r<RG\315hJ\365\335\026\344\244\177Lqu\027\313d\237\260P\232\265X(*\247>4\220\322\371\206/UD,p\273I\007\306\206\235\350\274\210\302\005\334DPldt\r\f\221\372\224\005\021^\263\266P\244C\013\031\021\233\272\336\340\237,z\260\272P\224\326b\331v\254)\227\262\016[\032\276T\220mS{\367\300U\353\260T:\311\2665V\347`\255T\260`A\345\264\227\247\214\273s3\303\227\002\242\t"
+	.ascii	"\301\261\323\\\334\017\331+_P\177\f\031\232\265\024\244\221\303"
+	.ascii	"zc\247\2712\276\273\334\240\252\267\3512\211\311Bs\r|h\003\307"
+	.ascii	"\235\375\217\301x\035\022\234\265m;\341\003\033\002\261\266m"
+	.ascii	"\033\241\320\214\020\006\360\240\311P9U/\307)q\033>\237O;vR\217"
+	.ascii	"7\275\252\230d\330Y\020\017\222qF\273\210\021#.\377P\302\261"
+	.ascii	")\345\260\323\\\224\365.\337\351\002n\025\212\213.\217\277\350"
+	.ascii	">\251\275\273<s\361\b\2404\365\232%Y@\312\002F.\345)\365\336"
+	.ascii	";%"
+	.string	"K\036\254.\364\237\004\377\231Z\333\026+\302\331\216\375\2248\243qz*\024\351\031\205\312\351\275l\205\003-\252R\304Hq\242E\025\225\357T\rhT\231PAUb\205\211\250\026)J\260\210\242z\001#\252A\323\253\\\240x\021\025\243\252\352E\024\260\211\203\257\331m0\363\272\3001\365\020f\300E\314\307\222\322E&\301\344(-]\004I\260\264$\344e\220\374\312;\np\033p\371\032c\034p\215I/'\261\300\3451I\257\264\241\201\033!I$\017x\340\252D\206\374\022\\cRH\232O\301e:\\\2008\327\246+!\t$\254\367t{\214\351#\013\356B]\350\203\327\005\256\231Y\225x\342\355{u\306\302\214\"\357\262\311\227b\246\017\257\322M\343|5\022v\271\034\342\261\271\355\341K-\335e\036\013\357\322\345,4M\326e\033X0VLL\345Txc(\005\335)\361\260\023]\033\245\343\002n"
+	.string	"Pl4^dR\322\233\235'\307k\326@\230\350\366\332\221\036\233\022#\272\022\362"
+	.string	"\270\313\036\302\301\333k\3014u\330\211\356\214\034\022\273T\2017\300M\323\224u\021v\251l/6\211\022\226\t\023\225S`\237\2739\276\324\221\321\002\356\"\024\027\213w\200\361.\231\232B\352\212\254\372Cv\267-\333\344w\271\314\030\326\r\200\357\250aD\302\240D3$\222\024$\245Bc\320\002\221\031\262:\021\340D\305\254\2320\005I\nm\007\340\240v\343\241^\364ja\211\247?\t\003\227\274\315fH}\227\331)&~\201\037I]\242\031ASh\017\235\320\t?\035d4F=\307n\240\001\017"
+	.ascii	"I\004y\220S\331\277\351X\243\202\265y\230\371\240\362\325!n\336"
+	.ascii	"\266\304\213\244!\306\361\007\271\351\233\314\210\235\346')\227"
+	.ascii	"\004\324@P\212s\310\313R\024\240\365\340\376\031\365}\351\317"
+	.ascii	"\301\360\036\374-\3066\260\374\376eI\327W\204\327\340h\006<t"
+	.ascii	"\200\201)i \203\004\256\023\333\031\310\312\362mE\335<e\2532"
+	.ascii	"\303\3005\r\025#\314{\254J\3265ak\025\306i\204\247D\024\220\202"
+	.ascii	"r\004\245d\020\325\351\3521\367\030e\253.I'\304\r\225k\370\363"
+	.ascii	" x\212\177\232\242\215&\351\251+[e\035`*\204C>\247\227=$\223"
+	.ascii	"\261\b\240N\256#F\2200\244v[r\274%\261\2562\0034\032\376\245"
+	.ascii	"\221\370cFm\005e6d\b\277\316w[\250\200\351\3703Bo\314N\203\362"
+	.ascii	"j\274\036|\274\223-Rg>,\223l\261\202d\232}\362{a]\f\360N\217"
+	.ascii	"t\202\"\244o\377\016\231\007[\220<Q\205\3256\256\n\217\005\254"
+	.ascii	"X%S0\361\342\\N\264rp\340\231\027\344\021\343d}\037\231\340\351"
+	.ascii	"\350\240e\3406-Jn\020;\001\205\006r;\265\035\340?CZ$\225\304"
+	.ascii	"RRCA\202\242e\341\247-\367;\216\343%\220\207@\230\"\270\204\305"
+	.ascii	"\331\216$\204\230\343\242\002"
+	.text
+	.section	.gnu.lto_blackboxBuildConditionCache.142.162a51487001df88,"e",@progbits
+	.string	"(\265/\375`\255\001\005\020"
+	.string	"&\035hF\340\262(\0352=\227t\224\247\201\364x\020\032X\320\273\202\327\257\301\204\202\024\267]\024\242\027^\356\006\363\032\372\250?\347\355\266\207\351\031\037\3173\230a\2069:\031\232\t\215\325\300\346\031G\223\355\243\261\355\275\245L)S"
+	.string	"P"
+	.string	"V"
+	.string	"4\336\n\006\317\234S[\021\226j\372GF\270j\362a\207-\0174\270\356\364\017T\030\n\016\242n\005\031\274\260\311\371w\215\351P*GN\310<n8\024u0\260d\316\t\352R\272\377\036[\036\016\327\311\\?\016\346\234V\256c\335!\267\255\262\255\300~N8:\025^\227\035z\354\226P\035\241\032B\365\256ZU}\021"
+	.string	"\235\231\356\336\21593\314z\246,\3260\361\330\355\257\360?\203\316\342-L\217\271|\262\346\271\0214\037v\314\371!x\364(\344\261\344\002\344#<\211|<\310&{\207"
+	.ascii	"\314<-\b1\340\036 \321Aw\367\253 r\023\\w@\313\373\241\352A\351"
+	.ascii	"\354>X)\\\320\202\374\226jtR\n\304#*\327F\331\366\337\003\344"
+	.ascii	"\270\201\311R{Z\035\256\035\031\273/\025\351\273x\215\212?\343"
+	.ascii	"\025\026=\367\350\263\310\307\026\317\206\247\307\213\316\354"
+	.ascii	"\357\244\373\262O\022\017R6\0224i\324\262\235H \231L8\321R\""
+	.ascii	"\230\240h\244\322\21262\340\215\002\204\222Va\333J\032\350\233"
+	.ascii	"_\227\r\3731\334\330\220\275,\352\263/7\340bhEJ\250c\n\2048\234"
+	.ascii	"sN\271\257\273H\271\241\275\200\362pT P:\323\030w\3069\036pw"
+	.ascii	"\343~\245!' @\002\243\220\252\033`\352\305\003\177O/\332\"&\325"
+	.ascii	"\257\217\271\264\0020\327\342\330\303\026K\260\240\344\022n\034"
+	.ascii	"\262\030\212\235\302\004\203-,!\020k\317\214>\253\232\r,k\305"
+	.ascii	"\213\235\202Z_\254\240\215\254\244\036\032\332B*\353\364\323"
+	.ascii	"Dw\f\205*R|\313\246eu\330\264o\022\314\023"
+	.text
+	.section	.gnu.lto_writeIntraframe.145.162a51487001df88,"e",@progbits
+	.string	"(\265/\375`\227\025\305\\"
+	.ascii	"\312\226<!M \322\322\351/\032\370r\336\264\325\237\305\rb|4S"
+	.ascii	"l&\036\253\244y\322\335\030}\032X\276\273\220\013\026\037\311"
+	.ascii	"\255\342\344\375\321\b%\305\367\306\350\342j0\030\314a\262\f"
+	.ascii	"\205\334\257\310\030\314\203yw\373\326Q\024Y\262\367\336;\245"
+	.ascii	"\224\002\355\001\361\001\013\002@\347\240\036g\240\325\371G\350"
+	.ascii	"\354\263:\027\205\316D\241\363P\350\334\263:\013\201\316<@\347"
+	.ascii	"\240\320y\007\350\f\344qf\203\316+\320Y\335qN\201\316(\353\374"
+	.ascii	"\254\263\257\316\335d\307&^]\314~\202w\257\327_\235K\227\302"
+	.ascii	"Y\3515\335t\335j\335^\272\333\272\277\264\312\334w\034\334\323"
+	.ascii	"\342\304N\r\317p\276mi0\334u\034\244c2{Y\310,`\347\344\342x@"
+	.ascii	"\343\306\214^\031:\3151\306>3p^n0jkv\230~c\016\262\221\006\303"
+	.ascii	"/\310\306\004\2150\007;\rv\227fk\032\332\215\203\3145\264\rm"
+	.ascii	"\177\261\352\253\274\254\036\226\276\274{\277$`;%^\277\375\243"
+	.ascii	"\266\035\371\332\303\342\227\203\235\241\327\332\366rE\274jn"
+	.ascii	"3\331d\001!\357^\265(5\266\177T5$}\301n\203PG\013\ty\367\336"
+	.ascii	"\026\235r\023\333)3\26737\f\035C\333iI\030xo\224\267\033\356"
+	.ascii	"UKb%\266\323\243\016R;E\373G\355\224[\3467DK.\026\f,Ch\261\355"
+	.ascii	"\335{\227\036\205u-\342oT\255Y\375\266E\030\031\213\210\206\204"
+	.ascii	"\202\200~|\212\304a\217\220'\270\003dW5E\337[\356\025\312\255"
+	.ascii	"O\220\335%\361\2760\261Z\004\fm\004\003\0277\242\254\232\257"
+	.ascii	"\027\320\246-^t\002\030Z\023\255Pw\215jq\302B\0240\264\036\262"
+	.ascii	"\322BV\252x\220\n\r\244\002\025\377\231\322>SR\360\342Y\023\317"
+	.ascii	"\314|\370\244{\236\224\271\320I\3638!\301\203d\275C\346t\240"
+	.ascii	"\211(`c\315\266\232\257\261vk\023W\276\232\276\242\304{o\017"
+	.ascii	"S\013u\341[\314\244\253;,\210u\032\326(\312\"\017\207 z\230K"
+	.ascii	"\320 \257*\313 S\211\177\3275\013g\2305\274/L\261\366\025\352"
+	.ascii	"\336\313\276d\2025\217hfGbf\036\314@\035R\316\322x\272\302\325"
+	.ascii	"g\262\322\262\300\204\221B\270\262\305\022\304m\026_\362\244"
+	.ascii	"\276\016\347\033\337S\225e\031\372ON\242\016y\022\270"
+	.string	"P\300\232c\327F\211\013\301VO\365C\276\265\232\354X\236\225\204\233\n\267ZZ4\357e\213\246vJ\365(\316\232\037\274\325w\372H\375\301\267]\247W\306\312\254\341\265\325I\372\037\243\237~\273\321\362#6\223Qq<\372]\327,\336\332\031\236\262,\331\377O\346\177\n*\350k\271t\235\177\022vg4\230\360\244\366\337\361\314\255\f7\274\227\024<S\t\312\346;\262\034\325{\006\260\235\262\376$\354\314\376\226b\375:~\307\0371\002\rD\022a\fn=$\232\004\234\314\250\\\251\235\366\307p\266\361\245\031\035\202o0-'\307\013'\033w^\307\261\352f7\352\002\fx/u|\233i3F\267\344\261\230mh\007Tn\037\372\007\007v\234lT\270\335r\354\030\373\333r\357=\242v\332\344d\333\242\227\345\177H\335\303U\r6\367\336&n\274f\023\0017\225\t\274\227\023\250\235>\360+\2241%\224\305"
+	.string	"\227\345\177\314jI\377\247\332\233\300\354\034k\216 \026\326D\0040\346\227W\027W\b[\275d\322Z\255D\002\235?h\265f$WGVg\253\252\325\231\252\310qu\036\"D\203\f\200\254\316\030L\255\316R=xT@\301\016\035\235\326\rA{i~@\350\334@\257i\216j\272f\0347\240\236l\324p\2421CF\023S\214w.\300\307\031\206\2173\001E\347\027E\347\001\212\316.\212\316KJ\335\326\234\364\316H@\347\026Eg\026@\347\025@g\025<\316)\200\316(\200\316\002\3608\007"
+	.ascii	"t\006\200\307\371\004\321\331\304\352|4t.1t&1t\036\301\343,\""
+	.ascii	"\350l\324\343l\354q.Z\235\211\204\316C@g\241A\372\034L;\305\b"
+	.ascii	"\316RL(N\031P\325\013\333\322\370\375\024y\033M;\254\246\r#|"
+	.ascii	"\337\020d\374\"U\377\324\206\374s6\343\373\220\262E\314R\f(\315"
+	.ascii	"\233\317\361\031-:}\r15b3\204}\303\025}\215\"\317$\003\226\247"
+	.ascii	"\025}\t)V\376\226b?D\357t\034z\242\244s\031\362C\363\361#\ny"
+	.ascii	"F\2074\336\251IZ\2357\331\"\302\367\230\242\320\323\020\262\304"
+	.ascii	"\263\b\275\221\016Q\256\254G\203gT8\343i\200q\351\322\027\354"
+	.ascii	"\n\363\273\f\017\203~\206\006\255\226[i\261\f\331\324\bz\243"
+	.ascii	"\336\231\264\236\035\322x2xF\2032~\306\327\013\304/*^\337f\204"
+	.ascii	"@/#\203\177:\233b\342f\355\026\320\373\220\242B\232\245\030\317"
+	.ascii	"?\331\253\355\314\233\035 \317(\260\351et\271\300v=\271\276\321"
+	.ascii	"\004\177\276\t\210\317\377|sy\024\237\357='\036Z\332\316?y\330"
+	.ascii	"v\246\214\235za\233\016]k\217o\352\020\260\260Z\bOz\353;\216"
+	.ascii	"\201F/~\217\251\006\276X\354\323\362\313\372\373\353\024*\361"
+	.ascii	"\033xv\255\346\360{\236\370Fr\312\025\222^N\3262\207\337o=\244"
+	.ascii	"e5}\254e\212\320\206\205\251\235\366\034\020\204s\r_\223EU\246"
+	.ascii	"O\372-O\266\2247\271\252t9\272\255B\305\340\245\3020\370\236"
+	.ascii	"\353\025]\302\264P\026CS\370<z\374\021\317\013\277\345\202\017"
+	.ascii	"|\236/\002B\271\302\316\007\333\021\034\254\035c\357U\022\203"
+	.ascii	"\375\313\231-Y\353\244}\362D\355t\347{\256\2074\366\201J\336"
+	.ascii	"\325Bi6\256v\212\023\373\252\2303\016"
+	.string	"M\311\223z\375\244g\213\202\367\222\207/\203\2349\223v\312z\201\224\024tX\212\255\377\344\025M\332\313\367R\346\220\346-\032\307o1\232\306\370v\353\346j\313\241\313+x\246\337Jj\034\237\306\031\003g\255\375\336\213\245\376\223\273\256;\254-\2079\264\231<\243\317\3641~\013\307\367\362\207\001\035\364\217!RT@R#G\016\276\212\310\017**\253\250a\025\021\253c\024\325\261\3528d\207\3101H\225\024\325\217\252 @\236R\352\340\350c\203))!>\226\210\004\221\032\2624EedI\251\004\0379\370A\265Tu<R-\005\325\262\372M\340vk\266\216\226)Zb\214\220\317\250Q\351o\374\326\001|%\360\345e}\222\255\320{\243<\365\227\356\274\031\220r*\277\222_\202\224K\203\254\253S;\365\200l\315\236^\001H\237\365X0\236\375\317\257\200oe\013;\250\004<\214/\352S^y\361\004\374"
+	.ascii	"\377\342\213\310(\341\332\305\017\360Dn\224e\311:\315q\352\322"
+	.ascii	"\273\370V\306\355!\361\330{\263z\311\036\204\323A\332!\357\220"
+	.ascii	"xH<u\351\207\354\270\374)]H\272\034\327\273\0222\3639\336L&\311"
+	.ascii	"\005\316R\016\322{\336\225\220\031\234g[\312qs\305\372\017H\337"
+	.ascii	"W\310\344\370\340\024\360\026\337`\332-\307\220\231\017H7\336"
+	.ascii	"Kf\361->\211\275\367\366\362\306\263x\037)/\320Q\272\300\"V\274"
+	.ascii	"\022\262\312\004\025\277\342\273/\305\253p;\277\203\343k\322"
+	.ascii	"NS|\273\221\341\2033*\202z%g\033(\250\223n\354\373\315\370O\006"
+	.ascii	"\266!j\255\037*\347\314\rm\365\335\2347D\255\234S6t\365P\277"
+	.ascii	"\205\344\243\276\323\326\342\320{\357-\372'G}k\375\317\032\032"
+	.ascii	"\034e\331\nG\361PJ\001\036\200G\361"
+	.string	"\335\027\300\013 \327B\351\2718\344\020\255C"
+	.string	"p'\036"
+	.ascii	"\344\236\243i\241\264\22735N|\337\365\001`db\376\325\356\305"
+	.ascii	"\"\372'\307)#t\344\031\r\262\361O"
+	.string	"&\036\t\002\316\214\234\203\004\302{i\342\237\356\r\032]\362\261\330\350G\377tU\342\217\276\345\224s$~\304\227\370V\256\220\034\343dX\f\222\016\277\361\233\332)\211\007\212\370\021O$\247\314s\270\026\312\023\222\317q@\016\341$\342\333\217\f\f\037\334\320?Q\243\267q$L\201\323\250q@D\0253C\"\"\n\222\024$\031\016\321\005\304\030\306\330\331\016\021`\031c\216\321\220$I\245\003\221E\037\224t\016e\362a\177 \360\004{p\0174\236\366\325F[~\2021\006\324\247{\347-`\376\352\266\263Z\002U\030\241\340\275O\345\315\235\357\276q{T\320A\337\327\021\213K\370\333\314\332\250\030sg\032\035x\250@\303;@\373p\373\224-4&\220\362\305\201\314P\004\210Z\267\256\216\231_Z!\002\304\242}\032asP(F\036\204\354\007\305\254G\272oC\256:\001\257\n\2049\303=\377d\321 o"
+	.string	"~S \305\340\004[\346\003Q\\\307L\275\263\346\017\024@\273\2510\371\323\276\306z\350q\310\272@\242\364m}kH!\r\270\301\300NO\343\376m\006*a\344dO8\235\214S\222\205\233\206\025\306\222r\2623E\025\335\260\221\007\360\016(\253\376\214B\024reH\032\332},\b\251\3058\265y\024U}\323\333e\312\034\307\341\354\331\206\360M\361xh\346\337\224'\325\222\357KP\377~\351\007\251\"T\360\026\023\310\202\300\220qM\032\231{\036wQ"
+	.string	"-\024\246q\202+\264]1.U\022\270\f\226\265oA\333\306\201\347\220UR\023\336\241\220\016\254:r\276>\205A\342\357p\313+\207I\34252\325a(\212\030\272\222\217\313`m\230b0{\213\201\216\320dh?\237\213G\273y<\355\205\364\213B\207\216)\337\005\330\247H\217g;\365x1\344;\331\217\031\367\374\230\366\211\3000*\223|xB\323\364\241\021\020\204\260\376 \214lj\rVF\233\317'"
+	.ascii	"\312\300\202NKV\373@0\322K\301n\034\347l\327\206\232\324/\233"
+	.ascii	"\357\341\342+!@if\250?\332\236!I\251#\307\370\342\037\316\025"
+	.ascii	"\313XI\t{\001\231\032E\031\024\226\345[\267\367\211Gp\341GW8"
+	.ascii	"|c\026\346\030\260\216\242\316\201\312\270\243\312\2264\305I"
+	.ascii	"\226\351\347\317@vA6v\231\343\3173\033\244\324\365\345T!JM\313"
+	.ascii	"\324\275\234\303\277\023\035\n4F\004\324\024\362\364\214\310"
+	.ascii	"\343\316\320OL*\326H\210\f\337\324\020\375\t\334\254\212\221"
+	.ascii	";5\323\035>\272:2'j>\313\324\311\324 \330\214\027\376\331\365"
+	.ascii	"\323\3720\035\354\206q\200\226\363\023\347\004\336F:\016\337"
+	.ascii	"\372\254\345\310\347\333\177>R\250\346e\344#\037p\271\b\345\225"
+	.ascii	";K;|\245hs\002\340L\2312e\312\t$\270\227@D\373\337\307[F=\002"
+	.ascii	" \276\246ZB\231l\255\222@I\352\225}\270\326\327\222\352\325\235"
+	.ascii	"{\377\376\307\241C\344\232\202\361i\320/\003x)\303\346\236'\016"
+	.ascii	"_\343\t5`\034\004\353w\n;\207\235\303\316\241\335\205\314\342"
+	.ascii	"\373D\tN\321\312\200\210y\377\021k\376\250\310\223\025y\354\333"
+	.ascii	"V\346(&\303\005iQH\204\205\275\2043\252\203\006\365\264!/(C\375"
+	.ascii	"\025\376\037G\366\030\300r\216a\224&l\264\002I\232;\336\021\353"
+	.ascii	"s\260\3519j}\0166=G\255\317\301\246\347#\243\325(\215\031{\341"
+	.ascii	"F\371\222+f<\031M/\004\244\002"
+	.text
+	.section	.gnu.lto_blackboxEncodeMainStateArrayUsingAveragePredictor.146.162a51487001df88,"e",@progbits
+	.string	"(\265/\375`\244\003\365\031"
+	.string	"v\262\253I\240\230Q:\020\353\217\365\263\360*\230\300\013\257\355T\215\375\024D\226d\035;z:\211\225\330!,J\027\217\214\313!\276\366\255$\024uy-\300Z\017h\307\207'\303\253\207\300k"
+	.string	"!\210\264\213\037\342\217%\237l\"eJ\001\226"
+	.string	"\211"
+	.string	"\231"
+	.string	"\227\267\205\354\227\275c\311\002U\373\276\343\020z\016W\205\260y\264\324B\310\2343\307\t\306\313\002\341c\242\2767d\003\233G:R\b\231\323\227c\235\361\3626~C\310C+\"W\244\302\300\223\217\020QV\346\364\315\354;"
+	.string	"\361r|L\274\334\025n\005\203\301\340C\337\035\352\320e\270:\344G\235\201Q\357\267\343\021]\206\255\\\222\213\030^.\334\311\212\002\274\324\025\211g\244a\214\022\337K].AY\355x%\256-\005sN\353\216G\342\026o\373\203\355\t\366N\005E\032\264}D\272M\366wXdE\3612\331\003p>u\337|\307/\340\275?\200T\333<\307_\363\337-{\357\216\251\232F\3253\243\032\326R\313\250:F\3250\243\372\245\245~\251\332eT\273Z\352QT\267D\265\030\252\345{w\030\252W\2525T\237"
+	.string	"L\226\023\3577\240\314\231\024\3142\257$\360\305\247\376\337\355\367\360\251\374\232\0021\202\351I\t\204\361<|)\277\374s\325'\211y\021V\236\220D\231s\036\270\364\2031;C\001\366\225\331\032&PUt3N\3441{\263\372CW\003f]6fC-:\245\227\205\311\360\"\367\265\222\212k]\366?\362\203\341N>\007\361\322\265G:a\263\273\243K7\243\265\2726k\325)\351\235D\024\267\265\327\3110\322\240e+\356\251.\201\t\024\326\356\317*\307\333\"7R\245w\225x)\367\246\211\t`\316\201Cv?\005\005\326\025`\315\352\252\223\020[\2124\210\340A<\214s\316\035\377\307\201\324|\247Kk\360\321\357.}\037\361\362{)(\260h"
+	.string	"\0037\033\216V\263\320s\003r\325\216\373\351`\243I\0207\033.\250\326\340\307\001\256'\350\302\205\b\267\033\017M\220\rhM\323\371`\253\240\201\306\263\241\302\354\247\306\3433\243\335\202f:\004l\003\352\271\315p6\333m\366\362\315/\223\035\206\261\r\303}\324g\256\240\f\271*Z#\271Mv\235x\222\016\213\013=p\331\"\235\352O\342\201\345\311\342\254C\r\260\261E\022\260\262}O\207\222#\315z8\347\234\3416\311v\300^\352\022\226\240\254tJ2J\263\261\265i=\372\035\316\026\310-\221ovfi\366Zt0`\001= p\002\031R\306\r`\365:\003#\036b\240\366\035D\027\223\031\027$\221H6\270\307\335\227\2129\354h\216\231=\261]4\3575\244\035\314\3012\263l\2109\336\3242\253\322~+\323o6\242\r=\332\320\277\305\212[\252\266"
+	.ascii	"\203\304\274]\023\362\343F\370\352\025\376`\037\023\262\240B"
+	.ascii	"j!\bE!\023\205\0037\374%\021\b\033aw\302M\003\371\233\223Y\310"
+	.ascii	"\b\225\204;8\002\267\367\237\241mY\202f\221\013\213m<@DL\227"
+	.ascii	"y\002"
+	.text
+	.section	.gnu.lto_writeInterframe.147.162a51487001df88,"e",@progbits
+	.string	"(\265/\375`;\030}g"
+	.string	"\332\2518%L \322Z\031\016/\306\217C\265\347\377e5\246\241\013"
+	.string	"f\303L\035\376vg\216\317ODR\350\233\217\007L\241\207\035\037\367\357\354\332\213K\206\006\006\2039\f\306\314\341g\035\316\273_\305[\336\022\316 "
+	.ascii	"\311\310\242\r\262\367\336R&\031-\002'\002A\002)\357R\312;\202"
+	.ascii	"\310\253\224\362&\021y"
+	.string	"\221R\336\243\224\327\210\207\267(\345\025\301\303K\224\362\016\245\274B)o\320\016/P\312\3733\344\365\031\362\366\fy\211C^\236\224w\007\345\035\242\274)\363\242(\357\211\362\232(o\243\274|\270\357\217\202\007\204T\246l}\215o]\251\024\326Y\361N:._\363\367\375j\376\265\177\314O\346\257\341\207\373\345\276\263{6Q\306\322\374\374\226\270\306\267\2675\222f\002\365\226\250&0\315\214j\230\307\207\367w\346nN\017u\272\320,\025v\23513\323F\207\267\tT&\237\303\351v\211\333\344e\266\267\376\314\224a\326u%6\331%\376\354\271\fo\373\333m\370\r\237[b\334qP/\367\301W\343:\234\343\345o\203\341\317\240\365E(\021\n\007\202V\240\0277\200S5T\345(\222\360\303K\340\031\221\323p7\365d\252\202\326\274\365[}^\004\001\327\225\355\307\360\347\262\r\331>\203\3721#\f\347\244\225"
+	.string	"\270\256Z:\206?ym\332\207\271\030\365k[\367\265\312z\022\324\244\341"
+	.string	"\270\256\253\323\317m1\374\331\364\"\364\247y\"\364\247\272\353\006\t\312z%\303\013\233\243[\340\272\256Q\255Bw\007\231\246\271\263}\223\355\213\232\352I,\215PJB:2*\022A4$\024\004\304\364\343\323C\344\331\031\246\350i6\253\3734\307\t\2604m|p[W'!\346Kb\302\360\b\265+\251\201\341\244\264#=O+\355\013\037q\271\021\227\026\270\210\205\213`\301\214\211\312>T\266\002\013\231A.\3028h\354@\307\032;\023\233\233\310\323\"[\343\037\345}\224`\334\223<1O+i6\315}1\217\331\263\207\206\345yZX\314\030^q{\367\273\211.Z]\274\223\346H\241\212\327\207&\266T\361zj\006\255\353\372\263u4]p\326V\221Q\036\027\254\374\344\272i\262"
+	.string	"\314\001\210\237-(f\021\225\026\220\304\255'\334\327;\213\244\231\"\037\334\226\225s\232c]\327e\344V\225o\211\357\262\006\273\233d\327(\202\235\202\254\353I\037\250\237~d\237\357g\027/3m|d\352\3744P\377\357H\030\004\244\177\372z\037\362\265\301\2751*\213\214\346\025\007\2477\005?i"
+	.string	"\203\352\205\217\344@\f\036\224\236\366\271b\305\347\0045\215M\350\351\"?\330\360\346\004C\275\305\330\272\256\273\252\030U\006>R\203\376\2318ax\306\276\332\022\fu\236&\366\313\274mGQ\037\017\037|\344\022\263\034\373j\227K\220\022\206\330g\035\322\n#\251\206\013\204\243\004\371\311\323E~\250!\b\244\225$\336\351\227\341#\0050\276\006\003\227\241\260\361\203\375\367\017\035\342"
+	.ascii	"\0379\325MP\372j\207\275\323\267;\022\246}\366\260I\324\031\225"
+	.ascii	"\214\245$\355\027\222\255\235\220\327\252a!\177\353\320\237h"
+	.ascii	"\177\320\217\316l\356\263\223\354\214gE.\\>\021"
+	.string	"\264\333\354\244Ac\227\342\020`\272\257\347\267\006\301\005\211\314\330\007Z\205\211`hV\325hW\322Mp\255\314'@\367sNg\002\236\257\301@\263\375\034\005\022|\005\361e]W\020\320\2374\276\006\003\347@=N\225\21518E\232\311W\035\301\247\277\251\272\321\267\256+\215\375\337\335T\2607\373\271\026H\361\221?\367R\350O\251N\265\244\301S\212\241\303\342\302]\266\"\367r\017\315\253\3146\n\273b[\264d\tS\202%\277\260x\275\353\312\271\244\244\274GF1>)\242\274\277Z\255\252P\336\020\234x\320dI\007(o\022\224\027\311\021\0164\230:\231o\221\327\360\225\372\232\357\003\01640\204\201\005\204|\355\033\344}_\005\256\346\013\344\207\217\036<\016\367M\200yw\374\360\"\360\303\253\303\2077\207\017/\016\037\336\003|xo0\257\r\3465 \345\255\341\303[@\312K#\345%\200\207wF\312;"
+	.string	"\017\257\214\2247F\017/\214\224\367E\312\353\202\310\033\225\362\266 \362B\245\274O)\257S\312\313\"\345]\221\362\252Hy\005HyS\244\274(xx\003Hy\001\340\341=\221\362\232Hy\233\210\274%R^&\"/\211\3759\277\265+\f\247\226\205\021\340\274K\326\021\034\nZ\240\327\374\021\322\f|\255\005}\365{\020\352\345\356`\001j\322EG0%\223\323\037\350\254\263\371U8\202\265"
+	.string	"\264\244\327d\022\322\013<\320w\363\270=\264,A\275|\240\233\364\220\230\334\234Q\231BM\321Y\207\242\001\350\024\2154\270@/i\223\216Q\031@\243 \243.\177\347\246~\231\t\240\177\347G\327"
+	.ascii	"\240\3416uy7/\036\243~\335\350;\321g\363\036V\222t\322\356\025"
+	.ascii	"\267\367\005\210\251Q\330\345\361K\316\247\203^\263'H\013\301"
+	.ascii	"\002\346j\210\245\177\367c\242\373\232\232\251M\264R\235\361"
+	.ascii	"\354\351A\272\2036\353\214\312\022\335\324_+\321WC\242\231\300"
+	.ascii	"8\f\t7>\275\\\024\307\257)\304\247\367\274y\335\3618=Hg\335+"
+	.ascii	"\206e\273W\037\357g\327[W\261g\251M:\3108#:\251\227:\211\216"
+	.ascii	"\361L\251G\364\277\200Q\352\337\221!uR\237nj\030\307\240jAj\264"
+	.ascii	"J\262M\332\032\026\027\306\360\212\353#\366r9\313\221p\327\024"
+	.ascii	"4\037\232\326\253@\2234\022\264$\375\274\257\230\001\207\027"
+	.ascii	"\224b\272\260\270\360bG\204\316\310\341\302\203\322W<\303su\257"
+	.ascii	"I\235\256@g)\320_3\327u]"
+	.string	"wz\271\n\364\271\032H\354\206 \214\312\243~\233Z\006\304v\3108F-\242\217\032\2653\236\025\265\021\013\352\362rcf*\031\rE}92:\242\026\321?\022\256\341\025\324e\224\nL\246\222\245 \352\373\375\\K\246i\027\206&\312\243\377\264\227\233\2429\337\325T\216\\r\354t \235\265\346\231@\177\356/\341\315\0047\314A\363\350, }\302\321Ck{{\305\355\315\200\366r\257\367s\275q\2711\177\245\327l\036\235@g\355>\035H\277\253\201\304\340\370\370L\342\241\346\321W\204:\250\207\232SP\313\3167\266\274]\237P\237\217\314\252\r\213\251e\217[\225\005\336\202c,\250\321.\311\035\322\350\260V\357L\013\315$\202\206\320\311)eZ\344\374\260\346\t\013\261W\035B\377\330UTr\030\221\275\331\252\\T\027\370H\325\005\364\347\257\002N>uDJI\006\347\022\252$\315\004\311\224\022%Mv"
+	.ascii	"1Y\"%\244g\211\024\023#S\030\240L\2204\241\332\201\201\221\251"
+	.ascii	"\rz\030\221BB\265\001\223$TC{A\013'TE8\270@\312H\221($\033H\035"
+	.ascii	"\211\272@\311\222\250\026%\226*\311\224\222(&TTJ\242\210lXo\024"
+	.ascii	"V\0045\263\343\334\322\245\264\0215\262\343\334\210G\351\037"
+	.ascii	"\235\345\303\013\240  V\027w\2041\037\230\353\272\005\307\345"
+	.ascii	"~\3001Vo\320\355\023\232\313\352\215\025\034+9r\320\237!\200"
+	.ascii	"\245\3712gGW\331\352m*Sv\364\215/\360\200\352h\004r\264\216\306"
+	.ascii	"\3219:\251\316HW<\240q4\322\237QY\347\333\003z\243\017\350\033"
+	.ascii	"{(6\tV\202\303u\305:r\333\330G+:\273V"
+	.ascii	"AX\tZ\t\2427\372\350\007\036\370\2141\330\350~\322\305\276\352"
+	.ascii	"\325\206\240\001MXe46\330n\3108<\004\013a@\277\013\230]\032\035"
+	.ascii	"\002\\c\216\202\2431\253A\253\302\002\272FC\035\t\177t\001=$"
+	.ascii	"\206\246\320\030\003\t\032\375(R\272\211\200\036\240i\364\007"
+	.ascii	"\215g3\232\2009\352\362vcr\324b\335\214\276\035\231\214\036\200"
+	.ascii	"\3370\034uy\032\256\030P-\3368e\364\213\255\277\263\245a\035"
+	.ascii	"\265\260\343\234\322\215\275fR\217\366!\266\306\024k\263\245"
+	.ascii	"O\027\243\227\006\037Q\272\tF\307h\2376\2757\302\033\274\253"
+	.ascii	"\036\325(|$\214>\337\033\fZ\202\200\305\276\032\301\\n\243\207"
+	.ascii	"\261S4\300@\245^\256\bj\311\343\034\322\213mD\r\313q\356\350"
+	.ascii	"k\367\320\302\247EM\226\276\016I3\276\026\033\350\r\215M\020"
+	.ascii	"\320\330W&\364\316\266\220\346\3163\246&\3458gT\325k\0265\320"
+	.ascii	"\016\204\355\205\245\271\262o\246\006"
+	.string	"C\335\205U\t*\225\025\206\023\354@?\035\331\262\352\237\001\342\350\305\235\213n\321/:\311\255\201\256\212j\027\3753Q\375\035\240\272\205\tlF\325\002\325h\02502iF\204\"\234\364\232DC\272\001\260<\037\030\254\177\246\350\t\317\251Y\364S#\351\ri'tN\375:\2625..\243\226\261\350\337%\013\005E\3642L9\344A\257)\304@\017I\3120\303\232\354\243!Z\221\247\242\005\350\025\215\204\003\003\355A\034\030\025\001\201\367\250a4\345\024S\206fDD$I\222\264\006\241\005\204 \307\034\263\036\021 )cN\021\215\246 )\264\035\020.\246pR\320\0202\334\022\202y\256)\277 4\003{\313\262\212\257\265o\343=\350\200\371\337I\200\345\361\231=}\002n\003}\231\230\3763\345\237\250\202U\342\320\033q\200\373\0272~\371\237&i$s \335\372ZB\353g\343\f\230\2375\330\320\222i\251"
+	.ascii	"*\313\263-g^.\324jw\323j\372\365\227\232\026\331\002T-\327\237"
+	.ascii	" \226\365\261\033IK\353\357\243UN\217\274\242\b\2744\217\263"
+	.ascii	"\0324\330n\303\21428I"
+	.string	"\030u\007\326\362f\371\244=@\224\nz\273\342_gHv\272\315O\204\234\241\370\334S\372\036}\332%m\322\017J\264\337M\344Z\017#7\0267\200;}\363\245\033\341\326g\236E\327VyvH\037\226DP\365\300\"\243\266Ln\004'\356cN\0071\t\220J\nC\337@0,\224\250]]CU|l\313\363\356\310\024\206\rs\323L\3621\273G\200\355\232B)5@\033\f4L \220'\035]\004\202\346\312\276C\353D\036\272\3232\027\336I\305*\024\022\3246b\333*\0172\222\300o\211\246\277\035\212\nlDJ\001\363\302n\363U\363\362\341~9l'\254#J\245\020\253^)\331\241\253Jo\016\263\222_l\207\274\316h\007\250\"\264\025\036\217dbJ\207\231X\270\006l\021\214\307\371\274?\037\344,\332\017\362\001\004i\221>\361\017Z8\357\301x\260\326\2326\363+o\347\f\034v\255\215\332\301"
+	.string	"\262\312\210=>\336\314y\235\240\371\342\325Y\226\005\250\200Af\370\310\373\264\002v!l[)\316M \210c\007\216\373\256\001\205\266\326Up\215\026\375\355\275B\321)\301\256!\331\0310@\313\326\037\236p%\230\340!\302U\205\270\245\201U\362\253F\375>9\244\317\230\321\316!\250U\203\006\007Dr0`\t\034\370\252P\325#[\263\255\212fd2\250\241\223j\230\001"
+	.string	"\026\022\004\337\251(ASVa8\241\316\021\254\033\227D\304\331\340\244\343p\264 \304n\3325R\233\216\216\322B\311\211\364\366\006\255\234\252v\256;\233\305\031\354\270\220\230\016Y\261{\020\324\250\321,\204s\302\020\216\331#z"
+	.string	"\264E\025\323IE\307\263<?\355\225*m\332\253\022(e\275\250\337I\261\235v\303\027\313X\203\3761\001\225C\335\270\317d\264B\261\327\214\360\210\004%\001-\004u:pg\204\324D\023\244o.4E\r\212\246%,^\357*\323\b\362<\374\232\216\224\335\0339A\033\261\303AZ\265\177\266\360\270{.gOc\r\233\333\316{\241\007V\026\245\323\002\f\275]JE\312\352EF\t}\334\263\033\261\345\342\327\300\231.\247\261\007\264*\030\376eTA\223\370\377\225\002\0016\r\"\3500\2138hH"
+	.ascii	"RN\t\025\330a\267\2128_\214W\021\271\304\344\027\n\t\236\205"
+	.ascii	"\020\347\340\355n\223\013\276\323\241\214\027)\217\034\321L7"
+	.ascii	"\266X\005\341Q\025\302\236i100\202\0241\032R}\006Q\225\001\366"
+	.ascii	"\267\205\302{7\336\353\3667\341\231\323%\274\276\031-\376\001"
+	.ascii	"1\016\226\306\005\263\371\361\250\205\224f\314\345cD\f\316\314"
+	.ascii	"\2211\016\217l\333`\344\024v\266\371\273\206\214/3\311,ML\003"
+	.ascii	"V\244\241\241\r\262\0054\247\b\005}\215\344`\227\332>\303\321"
+	.ascii	"\227\221P\001"
+	.text
+	.section	.gnu.lto_writeSlowFrame.148.162a51487001df88,"e",@progbits
+	.string	"(\265/\375`'\003=\026"
+	.string	"\226'\214J\240\024R:\207\245\206\307\375)~;p\226\037\026\236\340\256\247\366q{\213z\275\215S\034\200\227@'~\371\360o\326\270 \243\372\227u\317\036\336\242<ic\3444/\200EAvx<\005\250\220uu2Y+\371{\023\271\223\ft"
+	.string	"q"
+	.string	"x"
+	.string	"\177\3603\256\2643\032G\342=)\347\375\323d\326\217\t\253\001yZ\322\263\205\227\301\373P\247\244\253\372A[\277&\254n!\003!\271\207\361\030\274\003w\306^\032\177Q-\272\203VN\327\205<]\252\023\250\247"
+	.string	">\240\236.o\367\312\200O\367\026\374n"
+	.ascii	"!mu7\215W\234\367\311\333_\3511\237P\357\023\006\241\273w\372"
+	.ascii	"\204L|\371\273\233`w\035\354\362\213o\272\355\213N\327\003\315"
+	.ascii	"\244\251\247\347\227\362\352\b\370t\\\335\327\270\r\234\254$"
+	.ascii	"\026\355\225r\031J+#\337\351^\247\236\302\224D\243,\236Y\334"
+	.ascii	"\025\366&\253\330\375\330<\264\213b\362\341\227\244\316\235\221"
+	.ascii	"seun\f6\227\254sa\260\271\265\316\245t\3568\316e:w\216s\237\""
+	.ascii	"\340\013\207\320}Xu\227(v5\025ubq\340?\374\223\316\273\001\363"
+	.ascii	">\024&!E\025c!\363\013UOI\216q\365\262\360 U$\343\224F\216`-"
+	.ascii	"\225a\\\241.\034\b\210\251\312\005\244\274\273,\017\312\004\030"
+	.ascii	"\322\3350\367\362\025\031\231\3621\274\207\324\3108\245\326\021"
+	.ascii	"3\t\233Lf\376\017\240\257\325p\036\270\035\223\037U^q\001O\346"
+	.ascii	"\371K\327\221SP\022\367N\177\312\371\227\270\201\303\274\217"
+	.ascii	"\204U|\270\267\273\265\347\260\221\335\375\262g\n\267\\m\327"
+	.ascii	"\201\336\350l\370\346&\242\2466"
+	.string	"\242\256\315\005G7\203\263\325jfh\037hj9\232mwCsA\260:\233\333\216\026B\247\333\321f\302\376\330<\264\344\021-*\036\356\331\035`\316\330\215\342\301\223~\254\341,\356\312\367DN\224\331\027-/\030\023s\242\354\332\312:0gJ\271\002D\033A\302\274oUd<\343\026\240/\031\237\244\230*\376\270\350\231\305M\231_zp\002\013Qw\357R\250\020C\250a8\244\230r\306&\220\221$-h3\006\240\002\021*c\007\020`F\264I5c\240\321\220\035\331A\330\221k\205\230\003\222\020\250\371\230\314h\0021<\232\240\321\027f\353\n\272\331@C\200DK|\210\3069X}v3\274\322\207\214Bo,N\341\352\226{\2558\354L\327\032vt\335\375\035\310\036]\335\225\340la=\313\324*\031\312\243.\274W \207-\221\032\267\235^X\320\215\340\325'sH\3744\177\313\234\024\340\316\336;"
+	.ascii	"\300\nN\277\020\375\017"
+	.text
+	.section	.gnu.lto_writeOlIntraframe.149.162a51487001df88,"e",@progbits
+	.string	"(\265/\375`\355\005\275!"
+	.string	"V\274\321F\200\334M:]\024]\026\372\262o%\241&\331\274\353\310v\bf\031\021\n\275\365\377H\361\214\252H\355\017\026\301}\013<\022\232\255xz\346\037\261l\340\254\\\321\246\0174)\025(\322\007\025\274\351?\261d\023)\223\f\266"
+	.string	"\263"
+	.string	"\306"
+	.ascii	"\t\202\214\200y]\rZ\2555\212y\252\031%K\362\340/\334_9\226\335"
+	.ascii	"\333\262\270\225\235\002zyRk\275\235\356\262\330\275\235\376"
+	.ascii	"T>\334\333n\225\217\231\027\272x\345\252%\235\2605b\2556\026"
+	.ascii	"\224\247B\225k\360\205P]So#-\254H\2545\370t\272R\345y\367Q.\305"
+	.ascii	"\274\230\326\207j\r\002\347K\255A\335F\225\247\033|\021yZ\236"
+	.ascii	"\210<]sWN\200\030uKAX\236\256aZ\255u\327Cn~l6\367\037\276\347"
+	.ascii	"\364\332\372\210\343=\036 \202\251\003\344\005c,\252\201\344"
+	.ascii	"\374\360,\303\353\307l\213Pk]>\275n|\351w\267\302\356>\330%C"
+	.ascii	"\004\247Q7\350\301\3652Y\345r8\031\252\362\264\254\265r\347\306"
+	.ascii	"\316\334\234_D\374\276\225\213\271\232\002\n\367d\017\343b\377"
+	.ascii	"\215Cz\370\300?sM Fo\355.\210{\341\341\030\354\273l\250\322\235"
+	.ascii	"\201i\221\247o\006\300\341\0351/\267\"\367Y\256\305\312\007("
+	.ascii	"\004\333\017\257:\360(\246\235\247\373\027\344\251\003\2400\215"
+	.ascii	"\216\217\213\273\301\037\267\220\335\217\265\203\354R\336)\312"
+	.ascii	"+\245{rjbZRJB:2\312]\354/z\360;T\362\n\335x\203H^ \037^\\\311"
+	.ascii	"\373c\343\275Q^\237\222\267\247\207\267\244\274\266\222\227$"
+	.ascii	"y)\311;\332x\233\344e\312\373\\y{\2605\223\230J\370\247\251\204"
+	.ascii	"<\225\352c\271\023\025.L\200Rr\330p\355\364\204\247\304\222\253"
+	.ascii	"\231Mph\347W\001\376\351\246\3365\241\230a\374\323\311\224r;"
+	.ascii	"\022pgP?=\240\213\016\261[35\321QaN\371\034\f\267\316\215\275"
+	.ascii	"Qs~"
+	.string	"\371|z\211\251\247}.\347D4\333\267\214<\355\341\002\205\214,[i\251\tp\365\326\256\360DdQ\227\335o\264p1\371\331:\251\225\310\266\365\321t\255\371\270\b\3653\t\n\316j\255\016v'\334\r\005\262O\006\334\002\205\2146RR\233\ngC\2137\363\261\217\220\314\262,\\\r\325hG\367n\243\2433*.\274\fC\243\005\340\361;\206\344\316\365n\006\r\374V'xX#hV/E\233\350\361VE\265\350\211(Q\3053!b\207\202\004\357\304\256\n+k\027\225\264\275\024VX\273\025\275\036\326\356\026\364}\254\035d\203\256\204Yk]\343\256\204I\303O=\3242J\26523_\377\326\305X\353\017\b\027\376\304*\\\\\004\374\035\3372\262\250o\205ih\001\021\251\325\367s\337\205gT\355\232>\264xM \246\020\003jf\314\240Xhx\225#R\3044\302?7\250\205Z\327\2656\324A\r"
+	.string	"\b\2342\\N~#P?\351\032\002\307\310:\3020\250\200Z\300\330\233\342\371u\"j\304/\315#\247\372\303s\216\032C\250\314a\003\007\006\253\355Xk\275\001R\252\247\372]9~\\\334}1x\250a8\004\231B\246&\030\2214\232\202\244\r\300\002\021!\"\363\021\240\2413\314\202\024\244\306\003 M\242`\306w\n\250gi\330\032a%\001\373\242\\\200\211\"V\262\030\022\031\bi0\207\026LH\335\274"
+	.string	"\345xrq/\032d\274\316)\263\242\367\003\025\316$\0046\214\304\2010\236\201\220\026|Z\355\310Y\357z\204\263\215\377\271\001`\304\376G\375\365\021\266\202I"
+	.ascii	"\023\204 \302jA7\020O\2267xQ\021\\j!r\344+y\313bm\227Vh\245\""
+	.ascii	"\f\326\226\250\346\217\217\036\211R\177\274\221\240c\205M\035"
+	.ascii	"\372\321\r\213\365tZ\210i\036bmv1\360\314\314c\"\375b\336\371"
+	.ascii	"\002\241**\302\226\250\bm\236\307F \223f+*v\r\252\025K\250`\230"
+	.ascii	"t\020\262\344e\nW*;\272\353\201\354\363D(i\373\251\321SN\370"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_writeOlInterframe.150.162a51487001df88,"e",@progbits
+	.string	"(\265/\375`\325\b5'"
+	.string	"\n@<\016J\200VR:\341\306\243\221\244P\030\314\344\244Z\240\373"
+	.string	"\371%{\301\301\270\353\245\372p\374\221\031\323X]\336\366\007\3272\245\327\276l\251\223\r\343\335f)Ct\321p\272\265\272\001\264\347\252\234\np\n\223\372\255\344\223\330\275\223\f\277"
+	.string	"\304"
+	.string	"\335"
+	.string	"Y\252\016L^K\223p]\354\037\373\313\216\273\337\037r\"\335\277\026\361\263F\320\364\322\225s\376\211\350\376=\375\201<\310\315\372'\344d\354\313\226\236\227^\n\326\2474\371Au\214\004M\236\222?\025\007\355\361\226sXP\207\375\007{1\246g\252\274\302A}\274\345<\265\363\264{\326\2477\013\177\273\357\343P\366\321\246\327\344\234\305v$\3470\236\036\256O;\354A\365\351\372"
+	.string	"\352\323f\273\333\004<e\244\017\224\013*H\\\316\231\210a\234\375\016_\266\177\263\367Z&\362\273\023\307;\003oH\274\3140\235vA)\032\355\315~\243\230\312{y\rr\316}[&\325;}w;\350n\241\356\236P \326\226\3604\242\247;\ftjqk\253\202\027\343\237=\212\021AS\255\377\344P\226\376\336\242R\260p\337\332`\341\023F\366\305\307\030?mYC\311\344K\212}\241\351^\274"
+	.ascii	"Kc\270\222\242\237~\222\t\305u\253I}z\374\035\315*^Q\267\033"
+	.ascii	"\251}#G3\3625\325\266\372f\306\n\315\264\256\366i\237\204\372"
+	.ascii	"4\250\251\326\005\227\274u\335a\312\213\265\272\277\3138\253"
+	.ascii	"[\275\r\244\336\376\351\031\356\350\344\020\020\342\334\330<"
+	.ascii	"\372\007?\366\256\361\335\246\211\271\r\344\335\236\371\335\226"
+	.ascii	"\361\335\216\361\335\376\371n\373\326\333\275\336\355\225w\233"
+	.ascii	"\307\273\255\256\267S\336\355\235z\033\253\267\257z\373A@\260"
+	.ascii	"\022\314g!\313\001:?\212\344hB\255\270v\206Mx4\2223X-\237\347"
+	.ascii	"\335\222\271O\016\316\013\203\325\222\301@g[\223\266\352\300"
+	.ascii	"\215\301:1X\031\367\355\316\017\373pL\026\313u\235?\374\261\030"
+	.ascii	"3.\026\313\265\372\360o4\341\344\2429:H\256\216,"
+	.string	"\206|\236+z)\2166n\325P/\347^\252w\263:X\036\367m\016tm\271^&\322\024\023\361)\265F!y\335\226iu\023\022\360\272\313\257\373t\235x7\177\275\216\247\206#\324q+t\31199\265\013\013=\034\221\212\201\316-h\335,\030\216\r\236\377\354oG\267\241\266\224\355(t,Ci\035\316=\360\3149w;xp\337\336\340;\241\273Z\273\271\273\367\022\365g\257\222\244B4\2742e\007\004)x\005B\204\373\266\177.\2400\262\373R\002F\244b\322\206T\351\370\001+\025C\034\0315\250G\307\333F\303\021\307\f\035\214\212G\031\210\0368\024\221\210FIJ\304\341\200>~0&\021C\034\217I\304_X\362\273\214\263\032H\226\326\206{\260\fYZ\364\016q\r\216Z\351\344\326\222X\331LbK\273\234_0x\331\377&v\353\032\350\236\305;\212\032\304?\273eM3O2\326\004\213\242"
+	.string	"\335\227\265%F\266\317\24513\332<U\260+\204@L\203y\240\302\2545\030\210\0018\335\320\226;\224\273\341\260\007?\216.\r,\031%\372\201\316\330$\360\002qu\273\210f0"
+	.ascii	"g\233[[\365\347\334\333\021\334E*\020\266\222\372Br\241\302\346"
+	.ascii	"t\347\372\005\324\037\f\204\017e\245\2748n\216\242\376V\263-"
+	.ascii	"X\254\373\226\305R\237\376\340\023y\200\272\250qP\206\23023\""
+	.ascii	"#\222\024\244 \351\360\002\021\031\242\355\021\240\025c\n\215"
+	.ascii	"\314\220\222\002m\035`&\342EZt2#:\f\020\b\256\274\017\\\241\\"
+	.ascii	"\250`\305\207|\271\365)\340\313#\306\372\353\267\262\211d\036"
+	.ascii	"S\320\212\233\001\225z\214k\033\306\266\264\0017_]\026\343\360"
+	.ascii	"\037\036N\235\201(2\336\271\314_\321\277\024)\261\320c\301\222"
+	.ascii	"\357\032[\341\035I\206\220/\247\201\202\201\374!\204\244\321"
+	.ascii	"\304%N\r\323F.\2647\254!\355\262\273\250\261@\227\331\206\335"
+	.ascii	"+\352P\\r4gt^\006h%_.g\302\364\033\214:T\335\274bn\206\\\036"
+	.ascii	"J\223\267d\025K\272\"\217\257i\272\313L\264nJKe\035:\211\341"
+	.ascii	"iHZ\256\2450\t\355\227ax\245UO$\217\246R\204YY_\225P\177<%hW"
+	.ascii	"\322\025>\235\224\0240\330\306\241Q\016\3118\245d\311\232\342"
+	.ascii	"\305\031\r,\027\f\267\377|\340}G\227U\304|AsY\022\232\240Yw\f"
+	.ascii	"\333\352~\331C\306\310\355h\355\220\200O\370z\362\004\b\215\376"
+	.ascii	"8\235J\355\263\002\251\270\212\310\275\177SM\347\371b\331\235"
+	.ascii	"\0345h\270;\225\003\325\214\\\020\215J\230X\236\357_$\323y\t"
+	.ascii	"M!\217\032"
+	.text
+	.section	.gnu.lto_loadSlowState.151.162a51487001df88,"e",@progbits
+	.string	"(\265/\375`H\0015\r"
+	.string	"&\231XC"
+	.string	"\2216\035\320+''\034\023 \200G\020\267<\375$*\255@(\211\366a\344^a\312\270\261\256\3026:(\302\235\201\025\036\352\337&\311\241\331\002\200\002\204h"
+	.string	"\220\327D\013\366\177\351y#\262\267\224)\005D"
+	.string	"A"
+	.string	"G"
+	.ascii	"\376\212\263\320\236B\362\315n)F\306\256\207\300\235\352\321"
+	.ascii	"\3369\324c\365\001\324"
+	.string	"\2435;\007\201\r\273)P\341`\302r\332]KM\\{j\376U\016\200#mO\017\006\273\353\344H n\275m\003\266\023\330\277\021\335=\354\302\201\023\273\243s\217\276HO\342D\243C\210Q\316\330\336\226Z\302>\334\335\265\226\354\230\256\236\362S0\035a\032fZ5\235\231\376F\200\r\017\244\237f\354~\230\331\261\246\370\202Bc\373\351\252\266\204\303HUU\027\223o\2236\005O\236KU\230O\204\251D7_\355\353/>\252\335]\340\273\310@\001b:\022N\206\345-\037~g\220P\206\250\307\353\004\224\026\025'\225\372+\231\210\337%\216\223\257\274E\006?#X\210\b\372\352h\300>\241\313\023\362\261*\200xD\254+\023Y\235\002\306,\2002\013\003\206e\226\306\333\303\325\222\253/\205i\244%\216j7\370\013tq\020\025\302|(P\355\007\2171\24258\031N\332\020\"\3449\250\252\343\033\021\033"
+	.string	"`\251'\023Z\373\002\303\005\013P\004\300"
+	.ascii	"\203@\210Ze\006\242\302\265E\370\260\204\342\370\032\205b\205"
+	.ascii	"\200\270A\005l\325\360[\215\307U|\226\336\2100V=\030p\t\241Y"
+	.ascii	"M\001wy\321N2"
+	.text
+	.section	.gnu.lto_writeSlowFrameIfNeeded.152.162a51487001df88,"e",@progbits
+	.string	"(\265/\375`\342\002%\025"
+	.string	"\226e\205I\320\360(\035\017\201\3636vH\006\234\303@\245\024J\266z\271\340mN\2414$S\261\3301N\037\356\232\210\377\215\332\200p\377N?\362\340\263g\343@\374\342\351S`\361\316\233\304\002\200\3370\303\220\353\306O\b!D\356\224\002r"
+	.string	"j"
+	.string	"p"
+	.ascii	"\017o\317\370?N}'\033)y\213#\366,\271\330\225<\264\t\371\320"
+	.ascii	"\t\024\314Xv\200\246L\032\t\362\261)\332\261\313S\351\207\313"
+	.ascii	"\216\"G1\004u\312\374\361\304\001\255\351g\273\225G\355\234\244"
+	.ascii	"\221\263C\"\"\0077G\221\204G\007\367\260\246G3A\217\033\206+"
+	.ascii	"\310\255"
+	.string	"\006\216\354\356\177>on\2649\307\223\335\365\264\335tn\217\333\336`\273\201=\225\002@\264\022\257\251\250\023\275\310\202\257\363\013\314\274\355\241\017#>\274~\350p\322q\370\301\315\346\317\346\225Ss\366\301U\017v\b8\215\372\356\036uZuz\352\364\005\210\344\240\035\021\005\201\320\032\274\305\3715\255/4\nq\241\177\367i\337>\220\337s\312\017:o\346B2\337\232\375M)\210\004\322n\316\002\336\013\210\017\311\017\020\003 7X\274E\214\257C\340\263\273\022\304\207(\035{\230~7\031\036j\316%W\205\r\341\250\315%\007\230\344\rC\374\320W\030\255X\3636\325\333xb\362\325h9\364\236\213\264\365N>)\201\037\363@O\341\"wg'\216B\306\327=\264\212\313%>\264WZ\346m\276\211'\031\276\232\226swK\325\234\226N#\206f\324\346\222\247^G\275\n\233\255\330*\206\022\363bA\211i\271"
+	.ascii	"h\305\\\260\007\023X`^\024^Rf\231\\x\245\254\260V,)*\027\327"
+	.ascii	"\252E\305\202\275\250LD\374\252\320\202\251b\257\027L\225\342"
+	.ascii	"\355\311_&\032\034\037\343!zc;D\357\373u\360\315\224\006\242"
+	.ascii	"\bL\033B\204\237\006\037\215\267[\222\232\263L\034\025\207\223"
+	.ascii	"T&\035\351(\312\200\273<\f.\364#\365\346\317(}\241\3422\340\263"
+	.ascii	";\013? \240\002\031A[\007\240\365>\003\316\260e\030\330\223\354"
+	.ascii	"\246\265\"L\342\226p\0242\344\242D\215\016\270\273%,\016\317"
+	.ascii	"\026\263i\r\\\002\200&\244\3056\224f`M\013\307ytc(\b\243\241"
+	.ascii	"m\334\273\034\210\257\312\305K]\020\013\205&Y\"\231\303@\305"
+	.ascii	"\311\333\242\016\336Z\003qM)\3552x\370\370x\356\341\016\024\304"
+	.ascii	"i\300\202\021\26760e\372c\0057\337\227\032\007z\031\354\030\017"
+	.ascii	"\244^\313-\0305\037\303\0167\362\336\326v="
+	.text
+	.section	.gnu.lto_blackboxValidateConfig.153.162a51487001df88,"e",@progbits
+	.string	"(\265/\375`t"
+	.string	"u\t"
+	.string	"\246\320?9 \261\322\001\013z\034[\025\344\317\002\035B_j\324\353\202\244\027U\007x\023@\247\214\r\267\331\337x\233\021b\200\t\020\002\340\220\220\021\004\004,\316\221\003\036\322do\271S\n."
+	.string	"-"
+	.string	"/"
+	.string	"7]j4\371Gy\200*\354\270\024\bWWYP\033\261u\302\224\\\byY\r\204\250\030\001\034v\327Q\025\202\334\363\266\037l3\330\316\005\247\270\263e\250\250.\373r\265e?\372\223\340\306\026\336\006f\367c\247[\332l1\261\375\216M\366\355\262\327\036\304\\<Vp\273\373)I:\234Ld\231\251\211\250\272\364\b\336\325`\026\223\2129\333\244\30708\273\251\006?\345\260\f\277\344\323\033\245x\325\247_\362>\257\034\254[\r,\016y4@\220D\3503\001\372*\">\024_hD\372<\t\006- F\337\005\b\216\276\216\354t\271\332\342\354hh'EIu\211\274\231H\341\265\273*?a\005\021"
+	.ascii	"`\2517\023\032\200\002cx\r\343w\004\321X\t\313@\270I\310\002"
+	.ascii	"\305\343\357\007\001]\303\355C\360\227q\305\245\213\331N\274"
+	.ascii	"0\241"
+	.text
+	.section	.gnu.lto_blackboxStart.155.162a51487001df88,"e",@progbits
+	.string	"(\265/\375`\252\001-\020"
+	.string	"F\234hG\340\320(\035J\271\207YsGy\277\016\367_\031\206\232\326v\355\313\310\t\361\353\365\t.\364\\D\304\031\303\277\375\257=+r\204F\335\363\371\255=\244a\206\031y\342q\37089\005l\202\257\314\365\336\355\223M\266L)U"
+	.string	"N"
+	.string	"W"
+	.string	"\252\006\270\020%3\272\335\r%\211\247\016\372\246'5\345\253\016\n\251\374\353\210\335\334vV\214*\237\336\306\013\213\0178n\360\016\264\310)\271\354j2\272\324\023\215)\227\336"
+	.string	"\035\227\030\340\330\362\026\254\340\244\004\030Y\252\240\321\356Z_#\312\035\272m\3216\003[5\267=\001\256F\317\312\214\266\322\235]c\251\204\331\367V\276\330\236zJ\365Ew\30191A9\207\235\335\223\335\317\346L\026%l\337\257\3356r\031\213b5\272\021\373\263\323H.\343\216\330\315\211\335\005?m\022\033\374T\320)\233\247\200k\0036>9\225\322p\271\330\230\251\341\273,\335`"
+	.ascii	"P{\302\207\274\354\357\360\372\220\363\311\261\244\312\223\260"
+	.ascii	"\323\247\342\204 \266\27347\301\362\243\353Q\234\f\235\026)a"
+	.ascii	"\362\006\276)\t\334^\264t\206o3\310g\304\320n\313\201\177;\212"
+	.ascii	"\013>\314\247CD\364/\221\357s\3126qd\020K'\023\211B)\254\360"
+	.ascii	"A\002\tM\250\220\220c\303\242\005\t\250\020\203(\242B\260\266"
+	.ascii	"\372h%Y \001jC\210\240\177\371\262\217XR\365\031-;\232O\302\354"
+	.ascii	"\361\3716\307y\3700&\231L\337\347\003\020?1\"V\272\253\341\t"
+	.ascii	"\305\326\303\216X\005\237\247]\224b\026( P\2021dy\003`\352\311"
+	.ascii	"\003\3260]ag\002\t\2777\241-\265r\240\203\272\237y\250]\237\330"
+	.ascii	"(3`\002\264\322m\036\355\002\\3w\255X`\325\304\035B\r/\025\363"
+	.ascii	"\272\n\262Xy\\H\244\214/\b71\244\206.D\321\344\324\310CG_\357"
+	.ascii	"\r\313\217\237\207\303!@\272\027\337>("
+	.text
+	.section	.gnu.lto_blackboxFinish.156.162a51487001df88,"e",@progbits
+	.string	"(\265/\375`\354\001-\021"
+	.string	"\326^nG\340\260*\035\372\377&\370L\206k\310Oee\242\304\262RH\207S\265\217d7\317q\203\220D\344}\371w\353\032\"\344\242\371\001)e\021\362}\"\226!\036\361\034\306\030\216\023\256\001"
+	.string	"\274\003m\275\020\262\275\311\226)\005X"
+	.string	"W"
+	.string	"\\"
+	.string	"3\273\033\272\264S\354\320\345CV\331\273\333F\254\001\031<.\334xv\367\213\"\256\372\224^T\225\177\332A\\0\360\263\300\245\206{\336\001\034\020\267\020\230\212\247`\205\216\366\332\225\005\326\322\310Z\231\004f\271\022 X+\352\007\311\356Z]0\227\373\343\266M\266\027\330\332 ;"
+	.string	"\273\340c-\311\301F3\2630+J\320\322\036\366mg\221\362e\\\001E\357\272\364Q\346\345\243\003\\\216X\315\313JC\333\306\322\030\302~\f\303\260\3071\306\216\352\251j\251\352\203.K\361jq\371\353\306\356+\364Y\235\234a\302\366\375\232\327RNc\006$p\001a\030\352\270\310\224q\306\257\304X\032\306\220\361\265\017\330\361\211}"
+	.ascii	"Q\373t\242w\3719\262\016:V\004}\027\277l\203\016\324\237\317"
+	.ascii	"r\263\235x\363ax'\272y\t\360\324\314\271\316_x'\302y\001\205"
+	.ascii	"\016\2634XN,\314\3558\307y\2478\236\230\207\247\236\232\227\352"
+	.ascii	"Z\321ml\007.\215X8\221L\245\021\004\322'\301d\024\341+\241R\337"
+	.ascii	"\b\002\237&\224\240>\n\247\023\352\013\331V\3676\306\320~\f2"
+	.ascii	"\025\272Ud\37177\t\250?\336\034\235\304\026?\355 \035\024\333"
+	.ascii	"\203Cs\263\234\214\fQ\277d>\374\203\351\327LL2\202\276\311P\243"
+	.ascii	"\305\273\310\234\221dcCEwX@, `\2021s\305\033`\324\023\023\032"
+	.ascii	"J\002\336\363\004R9A\332\316\250\205\214\032\365\313<X\223\007"
+	.ascii	"e&@<\034/T6e/\301\217Q\3776\207Tx\0020\030\007\220#\330\206\227"
+	.ascii	"\353X\263Y\256\221_]\212@\f\326\352\"\213\321\260\t\233R\030"
+	.ascii	"Z\310P\322\230=l\210\307\025@\363\205\3339\026\243\3172*\213"
+	.ascii	".\013O"
+	.text
+	.section	.gnu.lto_startInTestMode.158.162a51487001df88,"e",@progbits
+	.string	"(\265/\375`g\001U\017"
+	.string	"\306\\hG"
+	.string	"\261&\035\203\2220\343l\211\337\342\2441$\336L\035\244\221s\331\337\035\024:\2426\224@8\330\033jf-\251\314}\r\212\025T\207:j\354y\351\277\001R\226\377\332\013S\233\277\305\020B3\320)\321{\023\271S\nV"
+	.string	"O"
+	.string	"S"
+	.string	" \256\375\032\350\304\254\234\360\331]NE\\\365)5\215*?"
+	.ascii	"\370}n\036.5\003+9f<@\227\226\300\347\313\t\201*Q\323\026\264"
+	.ascii	"\274\350\360\320\245}\310\b\321\023\002[QC\240\212\206`w_\363"
+	.ascii	"\310\002\262b\354\030\355\256\343\013\214\335\035\267=b;\202"
+	.string	"\375\2304-6\037V1\310\016YQ_\354k\253.\366e\367\246\321\032\243\017\3400@0\226\330A\304\330\205\005\001\355\216\314!q\331\355\227\360\303\333\374FuY\212\200\235\261\007{tfl\354\206\f.-\332.\035\376c^n'0/\037\262\312\256\021\257M\037\276\300\r\030\030;.\375\354\302\005\243\321\364\305z\324T\365f4Z\361\347*P\333n\313\201\217\342):_\346\322\030R\251y\251\272aD\013\0347qw?\325\027\243\314ki\306\323\212?\366M|\206\342\3138\303I\374\353\322?\321\327\\A\f'&^7\241$%!\204\344\001\204\220\223G\262\220\002\261I\244\241+\215\230H\027J\034\211\b\t\305\231\274\024':\340\256\344\344q&]\347q\241puu\361h\245\2549 \332\024H\361/\277\346#\226~_q\303\341\223)sS\271\302\221\315x<\342\177\232\337\233\305\264+\210\304\007\033"
+	.ascii	"5\263\007K=\231\001\353\034\242\365\022\336\3666C[ \212\304\n"
+	.ascii	"A\210xP8\016\267\357om\033\"{$\310\271`\3430L\b\256\211(\231"
+	.ascii	"\320\272\260\227U\226\227&\200\273W\205\320-a\\P\341\267\253"
+	.ascii	"\224\001"
+	.text
+	.section	.gnu.lto_inMotorTestMode.160.162a51487001df88,"e",@progbits
+	.string	"(\265/\375`y\001\215\017"
+	.string	"\326\\hG\360\260(\035pC\353e\321\343Q;ut\017\033/F\177\357KS\01684_U\331u$\271\372\013+\306\215\301f\027Y\257P\312\216h\212\266\343\031x\006\356]\304\376\b\016$\036\034D;\377l \354\336[\312\224\002Z"
+	.string	"K"
+	.string	"U"
+	.string	"\366\207\025,`q\252\200\213\352F\202\332\215\205b\307\2341nm\236\272\214p5\345\253.U`A\262\310"
+	.string	"\246c&\306\254\245\341\020\212\370\354\344"
+	.string	"\201\t\341}\264Zt!H\317\f\rQ\313\005\212\274Xd\370\315\365\245\325\251\206H\346\234V\257\205\341\016\335\366\211m\004\366y\0028\317\231\340\203p\312\212\336{\364W\344\343\3677\017\371\241\215x\341\270V\372\3311\225n\215\375\375\276\357\363\322\330V\217V-\262:\004\325\022\252#TC\250^\253u\325\037\020\322\301V\3428x\346\204\371\202\246-\252\020\241z\233%:\r*\224J\362Q[x?\007.\334$w\341.\220\205W\247\237\005\250\375\300D\357\355\352\315f\205\255[\225m\343\204\013\0300%u\365\203lF"
+	.string	"\265QNzO\367\034d\272U]w\200zdvk|\222\024\001x!\273\265h\017\377$\371\025\255\225\345\352\0366\215P8\225\234\230J\020J\270\b&%\024\316\204J\341F\f\370$\301\001\212S9\235P\\l~i|\0315\036,Z\034\005\325j\350\320\340\237\222\241}\261\035Z\223\254\266\203s\316)\345\306\035\355Y$frI0\327*.\201\231\211\030\036>\033\223\343aC\204\353\247x\037"
+	.string	"\263\312\371\256\213\253Nz\260\256A+N\310\315!"
+	.ascii	"\202;\004W\262`\306\202\005\260\2220\315aa\2259\257\314\354\003"
+	.ascii	"\253P\245\334U\013\\\230\\\231\316\257Z\026\245VY\\\030!\306"
+	.ascii	"H\360\366\252\240\0034\222)\227VW\263\254\271\007"
+	.text
+	.section	.gnu.lto_writeGPSHomeFrame.161.162a51487001df88,"e",@progbits
+	.string	"(\265/\375`\250\002M\023"
+	.string	"\026\342wG\300RN:\342\265\231c\273\256\366\374\0375\r\033\302\357d\206\236Z\261\215\253\200\310\241\n\205\236`\226\027\213f\372fv\310Z\357`Ss\n\201q\212\202 \310,0\260ZQ?\263\306\345!\243\207\274\254%\233H\231R`"
+	.string	"["
+	.string	"h"
+	.string	"\317\331u{\n\332q5\337\234mU5}\230\332\3359i=\212l\256\177\342(h/\262\021\331\247\375\216U\0238\265{[\360h\223\326\243o'\371\036[\037\371\036M\263{\030\300\331Z\003\246\235\316\221\325\356\276\024\350\264'\315\177\356  O\355\311\202\260\273N\220\247\347\326\333V`\333\201\255\021\002\217W\224\020\211h\311\226;{\305i>\377\350:\032"
+	.string	"\241N\310\317\315,\204GC\340\243o\363=\246\204\272\241*[\356\354[-\365\307\276\267\273k\365\261C^t\273b\232\245\351O\323Q\323\236\227VM\247\246?B\002$\325\363 \244]\020;\037\353\024\227J\274\350\307=\355\337(\002\242v\027e\306iT\270\300\302\362=*\024He\313\235\214\030Q/\"L\"\032\220^nV \310\306"
+	.ascii	"\313\203V\365\264D\347\207*\201\037\0220rL\334\244\2724\244\344"
+	.ascii	"LKy\025 \257W\361\027\263\223P\347']\251\3467\217\027\ry\320"
+	.ascii	"\245\tp\264f\333\f\356\002\246\265\273)>\213\267\210\361\205"
+	.ascii	"\036-\023\313\330\027/20Y\2068\213\315\250]L<\304Zb\\`\033Z^"
+	.ascii	"\034``2/\027\331\354e\202\300\261\231\027\331\253C,&{\271n{o"
+	.ascii	"\325\307 \241\221\223Mo\\\343\355\216xp\334?\205\313\235YjK\270"
+	.ascii	"\224\312\216\203TQ\327\241\342\013y\302J\036\\\371\036Y\372\235"
+	.ascii	"P\211(\304\2479\240p<\335\370\256\226\242\332\2009\020d\n\257"
+	.ascii	"\021\023< \220\002\0212\273\003\340\353M\207N+\306 \007\3671"
+	.ascii	"Pp\201\225\203\306\360W`ik\230i\314Xt\2349\017\n\254\033\347"
+	.ascii	"\306\222\202\265\340\240\201\377\217\240H{s\221`\254\241\354"
+	.ascii	"m\006k\023\202\244QF\300A\312\307Ki\313X\360~\241\203\005\336"
+	.ascii	"u\202\004\235\257e\264\235\2730\230\240U\244u\312\347\002k59"
+	.ascii	"B\332\353\n\035P\237\002i1~\270\0347\030\337J\t\006\033\234\266"
+	.ascii	"\226\210\235\013\0050\363\2425d"
+	.text
+	.section	.gnu.lto_writeGPSFrame.162.162a51487001df88,"e",@progbits
+	.string	"(\265/\375`\325\006\225$"
+	.string	"\326\276\335FpZR\007\023\300\360\356f\001\243\3575\342\317\373w\027\030:\274@\314\376M\217\021\212\t6\200\355\252E\215\234\272\347j\267\331!\263N)\272dR\223\226>\210\3561\013\260\205\353~f\225%c\373\334m7I)\245\303"
+	.string	"\275"
+	.string	"\316"
+	.string	"\334\b\206N\352ht\013\275Wk\257\315\335\222\276\2155Z\267\032\367\224fc\0162\212^\343\004\255\026\262{o\260Sf\024\314\301N\273\243\364\223\203R:\215m5\253\276Xw\315\203\003\303\273w+\302\332)\317\365\333\316>c\033M\005\317\355r{K\r\\\030\336\275N\003\235\262\203\265Sv\256\355\314\r\245\313\330n\262`\340\275B\250\270\335\353T\342\245\265S\242\036\252\235\372\372G\355\224Y\346;"
+	.ascii	".\356\225\0028#Yij\356\275\305/\322l\373\336Y\356~6p\311u\325"
+	.ascii	">\033\375\276\002xV\322\354p\265\360\r\265\216,\373\331\016\203"
+	.ascii	"K\351\376\213p\357e_r\321hN\233\231\235\230y\002\363\357A\334"
+	.ascii	"a\235\362\007\020 \324N\373U\262\366\013\363\255\277\326\340"
+	.ascii	"\271\375{\261Qe\372\256\033cgg\274\320\265\3605Lto\023P\213\317"
+	.ascii	"\364\235\325\245l\267\266b\344\016\343\247\243\037\325N\213\337"
+	.ascii	"l\235t\326\266\304GY\327\263\241Tn*\335\006\205\323B\303\270"
+	.ascii	"\237Q\034\3328\262e\247\334*\324N\033\264P\262\274\244\3571;"
+	.ascii	"\225\376^\314\355\273O\204YufR\235\213IHGFECB\335\354\016\320"
+	.ascii	"h\315\304\3259hu\036\376\234\201V\347\037\034g\037\325\271\007"
+	.ascii	"\350\314\243:\013\201\316;\252\263\016\3209gu\016\256\3168\253"
+	.ascii	"3pu^W\347\337\352\254\252\316\351\317\331\247:\277\352\354\251"
+	.ascii	"\007:ot\224\363:`\315\206\025[\260\306\251\250\227\363\035\327"
+	.ascii	"\3161\203_d\204\363\300\017\246A\223\207\303\216\265\2312x@\275"
+	.ascii	"&\222\257?\364\314\254\022\226\211\367\262\350\367\352\257\337"
+	.ascii	"r|\240\355\232\272-\312\254\223\256c\231\235\366E\327c\330'l"
+	.ascii	"\031k\306\232\251\235\376\276\333\304\274%%t\264IA\224'\364\234"
+	.ascii	"\323R\264\3230\352\367[\033\206I\364\364\211?\344\373\364[.\353"
+	.ascii	"M\222B{\201\342\322]*X\270\340\275\274\360\335l\301\3505}D\377"
+	.ascii	"\357\265\326\022\225\240\205r\313u\026+\356f;\025\203\006\357"
+	.ascii	"\245\320\023\271\370+\366\017\360\377\355\006\013\211rCc12\340"
+	.ascii	"\276\262\242\303Z\365]EL3\351{J\r\255Z\357\275\r\270\341:\316"
+	.ascii	"CG)#RDJ5e\342\2514\034\245\2422\234(qD\"\253\236t\370i)\305T"
+	.ascii	"\210\021OF\022!\212%\242\214R\305'$Uqi\210\247L\034\221\305\023"
+	.ascii	"SS\310b\320\231l\337}\",d\2732\343\205\336\275\327<\210\003!"
+	.ascii	">\f \230\331\226\344+\331\312w\257\020\b\255\326\215\207\346"
+	.ascii	"{\034\244\344=x\354p\035]9\202\276\223\264d\230\315\341\373\215"
+	.ascii	"&\001=\334\006\313\024\326\260\223\340\\M\007|\313i@Tk\370\235"
+	.ascii	"\244\275\323\003\372\3412\240\204Q:\217\361rK3\276\204\362\027"
+	.ascii	"@\3378\332;f\263\350?\317(\342\027"
+	.string	"\263CX/\357%\373\374\317+e\275\361y\037/1(V\023e\317#%\361|O\021Wz\222\247\216)\374#\244\235\027\032\351=Vl}\2633\247\027\200\212\250a8\346\024R\212H\202Q\222$I:\260\002\021\241\252z\021`\251dNd\264*\264\006`\247\303\330P\017\362$\227\221:t\315\325z,m\275\032Qr\300/\367\035\005J\b\200G\214\324b\242\334\344\203\322J\361\360h\235#\221\021O\r$\f\262l\265\017\367/l!?wY[\226\327h\315&\2546\214\253\330\216o\370#,G8\203\315\364I\030\346\373\247w,\370xr\216g=K\335k\234>:\362\304-\304\330\333\331;\"\246qla\275o\245\202\022\264_\247\3349va\231f\254m!5\314\373X\275\206\260\266\241S\013)\324j\247\325\217\3506\r\346\331@\221\217\337\177E\322\232\364\213\b\213\321\254\004=\035\003/g\323\326"
+	.ascii	"\214=\334\230%\376\326\203SIQ\342@\026\260\263\253c\222\256\234"
+	.ascii	"U\267\203\275\332x<!U\321\003\f\235\265Dn\217\367\233\355m\370"
+	.ascii	"\350nz[\205\211&\215\272)\245\347|\036<\356.G\025\340\262~\261"
+	.ascii	"\322\334\007M\331\263\032"
+	.text
+	.section	.gnu.lto_loadMainState.163.162a51487001df88,"e",@progbits
+	.string	"(\265/\375`\225\nU1"
+	.string	"JTp\022@P\346J\007\027\027\024Z@\250 \310\347,\225\"L?\271\037J\370~Wg(\264\216X\333\b\265\274\252@\214\224\b\2004\321\323y\235\340\370\333q3R\302\372\265\177\377\307 \204\220\275\245L)\245\022\001\001\001\033\001\355\245\233K\367^w\0260n|j]j\272\345\002\263lIk\341\336\262\307\200\177"
+	.string	"\rK\020\333\326\326\343#3g\251\321iZ\3329"
+	.ascii	"1\333\006\3234\205j\313\035\230=\257\255\334\276b\243\026\245"
+	.ascii	"aok\022\210m\013\324v\346\246\322w\267\253\334h\2434\205\013"
+	.ascii	"\364K\323<\006\334\200\330\226\363:\351lK\354\243\263\355e\276"
+	.ascii	"\263$\226zI\001\332\031\323\373\223\246i\324\037a&\022\217\304"
+	.ascii	"Z\353\311\3375\257\271\332\333AGc\221\210\n\235v\250\276_n\275"
+	.ascii	"\256\312\273\275$\232W\007UT\314\214\256\333\234\261U*\303\301"
+	.ascii	"\277\006\323\006\230\234\255\371\321\200\221\264 m\004\323\225"
+	.ascii	"\351fW$-H\027\325\370\306\234\210R0\222\006\244\321\376\002\322"
+	.ascii	"B5(N\223\265n"
+	.string	"s\326V\037\250\361\305\351.b~\032\355|\264%\372\350\241Z\324\346\314\255:p240\257v=\372{K[e\0353\211\326\243\035\245\220\246){\022-\255\231\250\231\373\0033\233`.\272\t-\307\003\210\020!\316\266\350\267\233\\sy\276\021\321n\354\237l\326\220\260\205UM\211N\363_\317\2309\361\337c\344\002-\377\374\311X!\bd\024\315L\321\266\251\223z\372\375\353!\0165_\336\324\320\200\334G\305-\246\307\\1V\226w2\353l\333?F\356\260\360\357\313\233\337q\206\203~\317\b\236yE\207\321\"\246i:\305\355w\241\260P\212K\323\264\223\3348\333\316\220\003\264d\373\362&s\236\227\277\222\271\251\342\f\007\371\341\230'PMIu\226f\005}\245\033AW\351>\320_\232\237\332K\263Ssin\352\275f&\324y@\321Y\200u^\262\316\001\212\316J\3269\251\350\214\204:\037Ug"
+	.ascii	"Dg#\324\271\bu&\252\316C\250\263Pu\016B\235\217\325\331\210:"
+	.ascii	"\027OgbuF\255\363Y\235\255u\256\325\371\255\263W\347\246\220"
+	.ascii	"\344gGZ\323\021\246\251Y\023P\272\306\376\325\365\227\016Gl\350"
+	.ascii	"\246\254\001{\257\342+\0315\203N\375\013\nA\265\323\223\261X"
+	.ascii	";\021\235~\352\211\224\313\276\242\337q\361\b\004q\262\373V\323"
+	.ascii	"$\365\\p\035\027\317\307<\307}k\273B\204\234m\213\276\371\332"
+	.ascii	":\231\373\202\nY\252\177\301!\250nz2\006<\233\\\215/N\334\331"
+	.ascii	"\364TO\244\224\202\207\350\303.\336%\342`\367m\350\2110\270W"
+	.ascii	"\323\323\253<r\221 9\333\016}wi;fno\031\305\276\222{\350\341"
+	.ascii	"\0305\363\023\376\005\035\252\231\236\214A3}W\301\"\030\346\206"
+	.ascii	"\315\346\215N^]\320L?\341\211\224uL\034n`\336d\241\303\271\006"
+	.ascii	"\024\364B\206J\272\220\260\377\334:\273\333\244\311\3316\350"
+	.ascii	"\333o.K\341\337\361\373\\\274\003O\232O\225\361\217_\341\350"
+	.ascii	"\341>\251\270\033\245\363\\-\b\304\323\203wy\247\334;\357\344"
+	.ascii	"\275;\333\032\277\375\344\232\205\177\305\267s\361\016T\350:"
+	.ascii	"U\304/~\2653\026\310\311\321g\316\260\341\354$\361\013\204\275"
+	.ascii	"\327\034\356K\300\241\003\257 \304\305\tZ\335\365B\306V\025\327"
+	.ascii	"V\327\226\013c\f\022Y.\264F`\tu\275\310\342\342\222QE\304X\r"
+	.ascii	"hl\251`\201u\325BE\324\013\255+\027QX\\1\242\032\020\340-\030"
+	.ascii	"Y\\Q][[\\Q\307\274\264\037\216\213uvk\276\036\214\007<\335\305"
+	.ascii	"s\nD\262q%\267\214x\030\347sH\\\356\226\271A\302\201s\266\265"
+	.ascii	"m\007|\263\315\301Y\376\t\220\343F>\rr\216\200\3779t\207Kt\374"
+	.ascii	"\315\312\316\322\3272t\204\001\360\370\020+\245\357"
+	.string	"\203\314\343nV\316\346m\310=\310>HB$\341\3316\3007\2209\346\262\212\3223#\013}M)\351\225,83\362\020\331\364N&}-\244c\"=\363\365\362\037\027L\351KRO\204\261\253\303;\211\204T\206\0160\350\225\\\0244J\375\013\026\241\372I\301?\241\251i\232\246\307\247\227\372#\275%\341\321\367 s\036\267\f\300\037}M\203C\215\005G\343>3?\273fh\227\007\217\263-\200o0}\277\307\024C3\032\275\202\357\303\261@\020\234\371\376\270j\336I\243o\275\016\200\320\250Q,%\031d\206DDD\232$\205\326\340\002\0211\3426\021\3000\355\034\222\021I\nJ\222l\034\023\200\013\222\200\202\227,\234\267\036=,\226\253Hc\345\363\251\220\233\026\250d\315pe\372\255\221\031\272\355\203\363\273<U\234nL\347=1\005\377\t\033\222\376\357\006\365\002\346\312\315\320\265A\016\nR\305\351\363\312"
+	.ascii	"\302\322c:B/h,d\337\370#\213u\234\326\363\366\230\257\201Q\214"
+	.ascii	"6\341\306O\351\037\023V\246\267\210-\257M#\313C\366-\340\334"
+	.ascii	"\270'\363\320G\002\245\237\324\005:\340\\\373\221\260\367<\322"
+	.ascii	"\346E\300t*PvH\322\023\206\251\205uY\321\303\315C\201\nZ\007"
+	.ascii	"}\\\265\306\371\023\332&\177\361\333\251\267\313\266t\345\250"
+	.ascii	"cs\n\017N\373\210\270\"r\243\205\267#\361\307\220*'p\244\220"
+	.ascii	"\264\3236h\2762\203\027\346A\016\020\333\017\322pn\022\255U\252"
+	.ascii	"\220mE\365\f\272b\230\034\340#\330!\273\214J%\310M>\005\366\323"
+	.ascii	"\261\032\331\271-m\254j{\3639\300e\361\354\030\343\242\337i{"
+	.ascii	"\204_&\030\002g\361\206\0167s\226\332&\2435\252\335\305\031\216"
+	.ascii	"/\326\245%74\361\357\224\317\237\367\034T\205\326\276\362z\001"
+	.ascii	"]\261\032\220\334\371\274l\346\314l\356\246AU\235\246\361\314"
+	.ascii	"\006\361\330\323\374\315\221\245\260\302Q\272\365\013/\256\312"
+	.ascii	"F\024zG\374\362uv|\364\216x\"\305\353\024\001\214g\312\362\037"
+	.text
+	.section	.gnu.lto_loadOlState.164.162a51487001df88,"e",@progbits
+	.string	"(\265/\375`\276\026uA"
+	.string	"\032p\310\027- \254I:\333\3715S\210\231j\033\3744o\255\305zr\345C\031\024\311 oy\037`\372\352\032\2066sY\2420\b\215\b\3312\355\0248\001C\001\250\001\236a\3362\312;F\275a\324\373\205y\273(\357\026\365fQ\357\025\346\255\302\274S\2247\212z\237\250\267\t\363.Q\336$\352=\302\274E\224w\210z\203\250\367\007\363f+\357\265z\253\325\333\203yw(o\016\365\336`\336\032\312;C\2751\324\373\202y[(\357\264zW\2507\005\363\236P\336\022\352\035\241\336\020\314\373Ay;\250w\203z30\357\005\345\255\240\336\t\352\215\300\274\321\312\373@\275\r\324\273\200y\023(\357\001\365>\253\267"
+	.string	"\363\016P\336f\365\006P\3572\363&+\357\261z\233\365.\315\273\226\367\326\373\365\2464O\002\300Mk($`\347\231fq\330\271\252\374D\31065\035\244\204\\h%\033A\206bt\236\247\031-m.\266\031-\251\231\355\013RIG:\311\213\313\316SO\"\b2ZN\250\3646}D!\035i \030Z\340<\371\240\352t\236\202j^#\243\245\005)\002\223\226d\364\200IK\037m\\\013\304\234y#F\245\0323\030\354<O\266\375C\217\364GSJ\211\226\365\251\311\243\037{q\236\247\337\247f\r\365R\333i\266\211\330\nL\004\277\002,+\352\252\325\251\017M\263\r"
+	.string	"\300\254l\001\374\240\251P\225\375J\222\251QS\245\306\226\314\034+\327\fB\017C\225\211\201um{\240\237\336\316"
+	.ascii	"\235\347y\302\036B=\025\241%\355\343\265[\367\203c\212\351}\321"
+	.ascii	"\006\376\265\223,1i\337\356\2040\233g\033\322K>\013s\236zit\277"
+	.ascii	"?\344;\264g8ZhCMtS\234\345\240\234\366A1iI\227\256\371CL\006"
+	.ascii	"\352}\321]\326\236\243\230\246\220\235\347Y\302\364\222\321\f"
+	.ascii	"\335\312:\317\223\"ii\n\306\244\345\212?_I:z_\264\005\367h=\317"
+	.ascii	"\363\374\366\261i=\317\363\364\362\261\315\233\342\031\273\251"
+	.ascii	"\037\235Di\027\032H)\027\262[\213yg)o,\365\306\253\367\025\363"
+	.ascii	"\2763o+\346]\245\274\355\352]Wo:\363\246R\336S\352-\245\336s"
+	.ascii	"\346\035\245\274\241\324\373I\275\345\314\333Iy\307\325\273I"
+	.ascii	"\275\341\306n&\346\275\244\274\225\324;I\275\221\230\367\221"
+	.ascii	"\3626R\357\"\365&b\336C\312[H\275\337\352\355f\336A\314\033H"
+	.ascii	"y\377\250\267\217z\3670o\036\345\275\243\336:\352\335f\3369\312"
+	.ascii	"\033G\275o\324\333\206y\327(o\032\365\001\211\027\246h\376X "
+	.ascii	">~\364X\037l\216\350\253\307R8\310\302$\017]\347\265\253\334"
+	.ascii	"\261<t\354\270t\326\266:\334\334V\255\266\304\300\034\033\353"
+	.ascii	"\263d\035\363T\034\233\343\006\016E4\033{\343\315]\331\260\225"
+	.ascii	"\2155\"7\325X\245\352\230\207\306\326\330\027\316\240\021\347"
+	.ascii	"\250N\315X!HK\2112J\221\212\2612`\304x\2610\346<\024\250\027"
+	.ascii	"kDZJ\272\360\324\351\230\247\305\272\330\027\262h\261bY\354S"
+	.ascii	"\361\035\332\253\363M6\324\264b\215HB\025\230\336"
+	.string	"\316d\335\371\245c\236\302='\364\341\240\212\255\202$L\246\2404\t\305\2468\201B\021\315\304\236\350\363@H&\366\013r0Y\302Q#\022[b\004\211?_\244h\304\272!+%\212@\004\030bE\200\b\361aA\004:\241A\037\366\013\262R\222\r\371\367\277\265eS[\273t\346a\325\004\375O\237\3739\022:\032:\002\036\001MZz\330/\177\213\035\326\276G\017\207\355\260\201C\242\337\261\263a\335\376\212%j\2403'\303j\300\220\341\302bX\3647~\027\212%-\250\275\r\233\264\265P!\215\302VH>\r\032\n\023n\346\350\350e$\354\204\b\022\024\321 l\204#\244\217\271\230\363\035#\301\220!\303\244%\204\245~\177\304\222\017\276w=\007\373\240\201\003\006\333\200\006-F\214\301\260\005\302\024\333\024\354\202\004\n\020l\002\033\364\027\"\002`h\275pP^m\007\026\315\300\201\002k`\007\305u\253"
+	.ascii	"0\002k\264\026\255\001K\340l\200\"\232\200=\353Aa\275\022\020"
+	.ascii	"\216\262&G7\207\307VgGGg\027\307\340\312\233\034\335\234\033"
+	.ascii	"^\235\334\335\035\2268\001T\354\356\270\265-vM\246\304\301Qi"
+	.ascii	"\302V7\007G\307\026ww\205mM\202\355\252\310\335\261\341\331\331"
+	.ascii	"\335\261\231\t\352\321z.\037\227\001\326Y\245\267{\366q\002\324"
+	.ascii	"\247\314\016T\013+\243\253\323>\233\341\341\333<{I\331\365\331"
+	.ascii	"\306W;J\313\216\rn\262\324\347\227%q\017C\031\021\261l\026<,"
+	.ascii	"\212hW\026/\326v\262\241\341\025T\311;][\270i\326f\302tge-\021"
+	.ascii	"\032\021S\365\361\322\253\265\225|H\311\312~A\216JVYI\202v[\245"
+	.ascii	"\316\216n"
+	.string	"\353n\355#Gt\211T\222\214\246,\025)S\346VJ\256E\0048'*\031\305P!(\033\345\t\024\271}\262k\221\177r\207\211N\002\031{- #b\334:\331\247j\022\247\210\006\267M\366\267\214\300\226\317\352\331=\306D\2430#1#1\223\226p\207\311@<k\033\027\027\317\033\245D\253(d\250\275X\231x\341\331\005\210c\2121\331.K\375\226\022\322\264A\3104\300\b\013\345\255\035/u\230\254\021d\250%;G\216\222]\222D\t\222M\262\267~n\220$\036Q[6k\214\354\221\"F\210l\0211\213\346\f\021\303\344\020\017[\346m\300\230\355k\023\262C\366\251\336\204\270\355\333\376\026\337\241=2\313g\303\025\343\266T\016\222S\220\315\333\275\325\033+\363E\037\022{\261\343\2314G5jLZ\006\331-\310B \001\201\220\250QT\345\r\221\210HAI\222B\332\f\301\006\"\"BT\334\022"
+	.string	"\"i\n\007!&&\306\004\026\211\210H`i5\007\251^>H\352\313\363\267\372\221\344O}\240\216\366C;\234\352\226A5\342\361\n"
+	.string	"=\025YIh\200\204\202N|\2466aY\0013mtUt\3038\335\274\366\363z\035\211\023P\202N_/\347\0012w\310\325\237\367\206\231\205M!\205\250n\t\300`\r5\003=\250\202\t\320s\271b5\246\021\272\320\344\211\240$\235\316q\033\246\241\355a$4\242)\225\013\262\351SQ-$\252\r\265\330\354\037^5\245 \3614\352Y>/'j\031J\315\216\217\bwfX?h\033i@/\030\370\234\005\240\377\373\362i\204\320\257\342\320#%~\315\230\256\013\311\373\257\340[\006\034\227\036\366\007\266'\346\300Jx\224$\031\b\n\232 \304\\vx$\275\214\324\n-5\262T{,\223=<\0245E*\204\020_\201=\324lLV\274*\303\204\362'\3514\021"
+	.ascii	"\033\336\302\217\364aO\240\214\004\034\206\001ac\263\272\226"
+	.ascii	"85\322\nP\017\2520\315\222\346\310%P0r\373\2321\335\270L\336"
+	.ascii	"\n*\315\376,\tI9\033\0041\345\376\204\274\365G\226\"@\354LB\223"
+	.ascii	"\311\326DL\"\210\005\037,\243\213\314\rA\301\313\355\307\242"
+	.ascii	"+m\"\016?\031\333\200\027k\221\211C\021`\031\037\271\260\016"
+	.ascii	"\331\320\226\215\214\221\222\207\351\376\303^&\250\270sA\351"
+	.ascii	"I\027\177\002\204\3107\201\017\202\017\377\020\331u1\377\001"
+	.ascii	"\370\361\357!\004\310SL\264\024\336%\324\364\200`\306\351\267"
+	.ascii	"(R\035\n\256\353\275'\356U\340\\\020\003;\246\t\365\005\373\252"
+	.ascii	"0w"
+	.ascii	"\320\310\323qs\027\2017^\001w\347`=\272\016\005,5\216n_\325\370"
+	.ascii	"kV\273\223\032\370\002\025@A\021N\2607Z@\006p\2520p{\257U_Q\007"
+	.ascii	"\372S\340\365\200\210\264\027Y\365xY\232U (:\331'\265\022\332"
+	.ascii	"\027}%\203\252Sg\325\003&V\337j\320\231\304y\016\356\2143\226"
+	.ascii	"\323t\252\220\213Zl\236?"
+	.text
+	.section	.gnu.lto_blackboxQueueFrame.165.162a51487001df88,"e",@progbits
+	.string	"(\265/\375`\217\0045\035"
+	.string	"V\264\272G\220\234Qc*w\b\001\220}sR\244\377\263\264\n>;\201HG4\017J\036\300\360\222\242O\220\036\226XW\267';\203\207\206\323\352\353\344\b"
+	.string	"\364P\3225\325EV\354 \337k\236\205\007ju\256\315\356\275\245L)\236"
+	.string	"\231"
+	.string	"\260"
+	.string	"wxU\244TUY\367\"\025\334\364\004/):\322\300q\013\311\024\220\255\366\002\006\350\221F\266\367&\261\211\272\367\332\374"
+	.ascii	"v\323\257\366\221\234\t}\022\026\216\335k\203*\352^\244\315="
+	.ascii	"\260\233;\3179o\226\247\2357\215\332d\006\034]\240\017\325\025"
+	.ascii	"\242\323\326\275\367fs\034=\354u\232\245\255\250\017<\354\365"
+	.ascii	"c\003\351\370\327\214\2377\306\0317g\306a\271s\357=\252\345\203"
+	.ascii	"\307\3332A\022\226\0303c\2132\347\352\206\230'_]\030\205\265"
+	.ascii	"\276~\356\275\256E#\322\035\273m\026\2661\330\245\220\311\241"
+	.ascii	"\017a\3552N\2557\225\363M\036\205g[\2727\370\"\224\233\306\345"
+	.ascii	"t\365E\034k\245\004a\262:\262@\373N\376d\204\237z\307\253/\362"
+	.ascii	"\316\2333\373\344y\200tA\223\304t\f\326.\033\t\254V\311~y-\016"
+	.ascii	"\373\254\326y\222\277\366%\177\316\221?\355M7\316\237\356\231"
+	.ascii	"\255\226\235\3257\261\352\030\254\032VV\277\312\352\263\2546"
+	.ascii	"_\325\245\255\266g\365\t|\b\022\214\027H\207\202u/\214.\256k"
+	.ascii	"eJ\365x\323\377t\247'-{\372\225\367\370\200*\213\017\013M\277"
+	.ascii	"\007Kk\262\242L\277\350|\331 &`N[\307\020c\2249\255\035C\224"
+	.ascii	"\022B\335\350\244Y\323\276\234\240\252\020\245r\254\r\341[\212"
+	.ascii	"|R\256\255+\253\016)\227\032\232\265#\274\312\310'\345*\222\005"
+	.ascii	"K\206\224\313\b\215\322\332\022nE\203O\252\325\300v\212SQ\270"
+	.ascii	"T\252U\344\336\353\240\312\247*X\270\200\341\274\371\342\231"
+	.ascii	"O9\025\r\034<x\260 R-5G\035k\315\252TK\210\225l#\340\277sfu\254"
+	.ascii	"+\361(\254]UJ\232\253\032%\255\332\037B\324\027m-\360<\212IV"
+	.ascii	"\326*Y\300\013\234\267AL\252Z\3245\306\2613{{*E\t\"p:\022e\211"
+	.ascii	"\035\216\250\324\t\375\206t\276SwB\005Q9\304A'\264\333@dB\347"
+	.ascii	"\363\375r\001\234\353I\321\013\342\345p%\202n&v8\241[\3167t\353"
+	.ascii	"9\340\336\t\235\357F\324\353\371n2\344\375O\320\na\266j\273\314"
+	.ascii	"\276\311\267x5\255\035\232\003"
+	.string	"\3251\264@\337X\231\265\021\333\374\005\316\231\275\2615.S\311a\322+A\255\331\330\016\264\307\031\241\0377\203\006A\220\005\264\"mS\206L\314\232PaN\236Z\2630k\243DP#\365E\357\204\351\001\360R\264\321#\007\2032\361,\241J\376\005\bE\312\346\246\027,\230=\225\240\264\024e\004kWV\250A8\205\024DF\231\200FFSP\220b\003\260\002\02121\036\020H\210FF\222\346`\237\0028dp\264<S\205Mm\034\357X\236\350\r$\006\305\202\223WtS8\213v\264\177\177\210\006i\0200\367\332\3246\302t\275\356I\264D\270\233\224\224V\3221s\260#\275\227\250\240\"n \314Y\322\240\013\223K\006\214z\262\027\314\"&\332(\330\241\226\034\t\310R\223|\036l\236o\233\236\035\317\2007\310g\004>\035T\321 k0\362SX\214\033'\002b!\316r\245\031@\311\237\360\201\244"
+	.ascii	"\200\007wv\372\006\027\251B\013q\305\352$Dq\034ay\034N\221s\250"
+	.text
+	.section	.gnu.lto_writeQueuedFrame.166.162a51487001df88,"e",@progbits
+	.string	"(\265/\375`\222\006u&"
+	.string	"\232@|\016IpXR:\177\206\354W\233\370\311;T\304\240\313\357\016\254\215\330\036>\237d~\260\242\272\031\277 \265\371\367\325N\f\026\246d\325\003Bc\275!8&\205j\351\275Q/0O\036\315\376j\352\0372\303\333\2364B\310\336I\006\320"
+	.string	"\303"
+	.string	"\327"
+	.string	"\335\277\335G\373\262=s\306wr\366\272\302$g\347\203\006b\257\266\363<\353U\366"
+	.string	"\326\253\335v\203\031"
+	.string	"\225\207AoSRkfr\316B\f\366\366:9876?_\217\345\255j\212o\333\367\035\207\327\311\301i\336\247\013\311\365\233\255\333\244\f\3044\251{\234q+\345\241\352Q<\231Q\353\376R\240\027\327\335\343\214\3114\370\006'\365f\326\365\361\206\272\2207\336\363\351Bb\235M\t<\271\326\036g\274J\023\230\301\235\275\355>dF\254\313{\234\361F\032\3149\377\216Rw\r\2415\246F\375\216P7-\361v5\246\013\031v\234FP\222\335p\216\304\224G\026\035{\363w\352\370t/o(\347\334\267xD\276w\336\375\233\356\236\320\275Z\b/v\220\210\207\335g\302d\003-v\213\270\033\t\007aE_rt\365"
+	.ascii	"\364\342\365K\212]\261\212\202\025\032\032\330\355M\353\261\221"
+	.ascii	"\332\034\361\236\351n\244#ibs\316B\375##N\260b3\326\253\307o"
+	.ascii	">ES>\357\230N7\332\355|\272\370\253\373i\306^\335\277\333A\366"
+	.ascii	"6\320w\273\347\314_\207\275\355So\367z\267\331\336m\036{{eo\253"
+	.ascii	"\274\333\351z\033\257\267\257z\373\006\004\330yA^\212\\\316T"
+	.ascii	"\3214\031Nu\342\343k\177\367\373E\336\026\343l\rA\031\345\316"
+	.ascii	"\376\263\177k/\236\221\371H\2707\035br66\270\332Al\214\356\023"
+	.ascii	"y\232\214;{\202R\313\220\253\3352\272\177W\357\257\0037\n\306"
+	.ascii	"\b\206\r\313\007\363\341D3\223\235y\301\325_5\275\237{\266?\333"
+	.ascii	"\261\363\244}\031\222D\303y\373c\355\267\265A\3322\025\017\333"
+	.ascii	"\315\356,\f\213\277\376\263\002\261\221\232\225\234h4Z\367\237"
+	.ascii	"\265\007\003\361\243\222O\347r\271\326\254/\326\355Y\273\274"
+	.ascii	"/\266\313\365j\017~\333\r\324\200\222&\271\274Zqw\333\334r\341"
+	.ascii	"Y\210\204\320\306\360\270\f\017\260 X\361\231J(fL\025wk\370\223"
+	.ascii	"(\007\212\277\024\351z\303\255\020\251\370\317\253W\312'o\333"
+	.ascii	"\252\263\343\275\305\232b#\265.\034\376\326\"\305\025\224"
+	.string	"n\306\263/aV!\030ww\210\002\345\t\306\353\327\224(AbVE5\f\246\363\"\207\213@\211wi\317\355\366\360\341B\222pOx\330\001\356\305\335 B\334HIMLHK+RR\321\222\t\265\217\200`(\031\2458*Ra$\\\201\242(Ix\264\304$\004\002\266\022\013\244%\241\013%\245%\341\317\351\3644c\257\036r\302O:\013\312\2269\355\324\007 edjW\240Yp$\\\037U{\274D\"\033\240\017CPn\271\273\021\272\335\255\215\326j\256\254F\253\261\355hb\323f\255A\254UE7$\223e\356i\335b\335\334f\2619\023\205\372k\036m\267\270\332\0349\326\253A\374\264_\264&\220\3442\t\025\250\251\237\2217\255=4M=\\AY\345\216\tt;\315\373m\345a\366\253\005\373\341\210\302C\007\267K\212\320/\363\272VGw\313\243U*q\2019'Nd\222\016\204\321e"
+	.string	"\202\216Q\020\306S\215J*jrG\252|/\322\234\273,<\277#&-\200\212\250\221(\303\230d\306DD\202$IA\322\001`\002\221\231+\353\021\200A36%M\2459\240\246D\224$\310\226\325\006\2454\211\f8\305\342\366\313DAq\305\265\262\026\346\372\276T$\013\272\025@\254\232\203\032W\367X/\2250\350\025o\321\b\265\343&\315\242\240\310\224\317\235\314\351\320\024\024\305\307B\3132'\263"
+	.string	"\235\210\003\016N\260\364z\332*\0271\\\202\311\213\370\001\013\261\207<\037\215\227H\301\303\035\366&\244D\343\n\3474\372&\024z\305\307^\023\266c\005g\377[\312\200\\~\233n\275nt\252\331\347T\177\205\331\212\232\202Z/y\030\204LO\303\350I\260\247\220\325oA\240K\310\203\244\002;H\332M\211bQ\374=W\323\234w\232T\177+\263\274M\206k&\264$~MY8"
+	.ascii	"}w\tYcd\271\230\352\004\236u\351\244\214m\346y\302-\311-\350"
+	.ascii	"\365\327=\346\037\035\254\344\b\343\032&\230\224\370\242\346"
+	.ascii	"\347/\366U=W\nO>\332\201 \262+_$=F\271\304\323Sj'\214\f9\030"
+	.ascii	"v\235\3076j"
+	.text
+	.section	.gnu.lto_writeQueuedFrames.167.162a51487001df88,"e",@progbits
+	.string	"(\265/\375`\356\001}\021"
+	.string	"6!uF\340\360&\035Zd\033GJr\242\311k$\375\bM2\225\3669Xp~\202\354\201\3433\270'V\362\233\326\255\326\356\b\177\214O\njc'C2\314@(Rie\037\375@\231+3\202\344P\024\314\222\275\245L)`"
+	.string	"\\"
+	.string	"c"
+	.string	"\037\2763\333\201\347\250\311i\327\246\340\321)\217G\277l\246\002\262\20558\252A\023\204cwU*\302\277\035\332n\230\257G\250\371\362\023|7\274\031\354\021\242d6$Bf28\362\344T\364\332\263f\026Kh\002\347\372\332'$}/\274\031\316\023%aw\235\336\354\346\346n{\305\366\003;#\004\n\263\237\342*`|\036\263\270\362\336\243\357\342\036Q\na\304\r\02491y\263m\260T\232\375\221\235''\253\216\035\323 \335}\356\017\324\201n\250i\205\351\324\364C\b\334\206n>\243i\327\346\226c\221bQ\211\373\374@O\373\377y\315\035\020\314\213\215#&\006\036\217^\340\340u\237J\357\024E\373\276\231\020\261\274Y@\246\332\0270\344=#\220!\342"
+	.ascii	"`\311\263\355\341C\253\324\322\356\216\270\270\020\253\304\304"
+	.ascii	"\204{L=\221\007\002D\257\257\335B\322gD\263#\300a8\250 \352\244"
+	.ascii	"\311\211i\013#\331L\335e\3362\270\333\316\302%\262\263\033s/"
+	.ascii	"\350\321(Vi\345\275\017U\030=\037\222,)'+\027\230aU\242\001\232"
+	.ascii	"\225zi\221\240\260V)$\252\225\223\225\212\212\325\342R\245\016"
+	.ascii	"\270\265\241\244E\345\322j\265\250:\333^u\334\243\003)FcQi\356"
+	.ascii	"j'\264\323\020\241\037\246D)\324\032\333\376P\250\361\246Ii\005"
+	.ascii	"\r\231|\202\273\273Pi\266\007\244\310Uo{\f\227\201\"\026\n\025"
+	.ascii	"f\024\346NU9\332\027& \220\002\241:\353\240\353\205\002\257G"
+	.ascii	"\026\267R\265\350;\275\365\360\3061*\257Q\004\365\bi\334@mg\321"
+	.ascii	"Ze\\$\r\214\031L\204\264\217\227\375\254\263X3\326.\262%fN8\035"
+	.ascii	"\372\205F\227\216\024\360j\206,$2a\344\371\202Y\210\023\224\270"
+	.ascii	"\031\214\262\351\022O"
+	.text
+	.section	.gnu.lto_blackboxGetDroppedFrames.168.162a51487001df88,"e",@progbits
+	.string	"(\265/\375 \372\315\006"
+	.string	"\362\314/5@o\222\016\230\016?\020,\nd\214q\352F\234K\231\325\272\033\211\201\371L\263\233=\204\250\240P~\375\006\206\341g}\3258jbH|0\340\271\266\211%D\246S\033\212\252\323@q\034:\021\202\201\363\020)K\"n\b\256\"\026\2548QUV\314l\3317rO\203=\213/I\267\353~\\\341q\315\n\257g*t\017@\003s\245\337@\356u|/\231\231\277\321\357vo\200cET\222IfF\251%U\340\t\310\377\371\314\r\251\310\347K!\204i\006)\030\027%,\231[\324T`*\2744`*|\036\275\352\256\333\221&\204H(\231\006\252\303 d\346.\323D\375\365/\370\017\376\215\b"
+	.ascii	"`\251'\0230\2013\202\342P\342\032\235\205\310\303]1\265\223\f"
+	.text
+	.section	.gnu.lto_sendFieldDefinition.169.162a51487001df88,"e",@progbits
+	.string	"(\265/\375`\324\020UU"
+	.string	"\332\221P N \322\322\031\016\357\364.\001\027N\321\375b\f\263h.\354\377\310\250"
+	.string	"\037\245\2367G\003\367\006\354\240\270\274\020\030{<\346\242\376\316\033\r\214\214\0223\213U"
+	.string	"\300`\026~\274\022\201q\271z\350@U\213\231\232uC\300Hh\223-e\222\001\366\001\273\001\365\001+\221\276<\253\231_]\363w\277\016?\227\337\313\205\374\272\037\314\201\273/s\347C\310\324\323[\355\202\017\263\267[\241\016Zq\274\330\020\314\341bv\205\273\3650\013\234\313\343\004\rn]W\341\326\256\360\277\336\005\262\357\362/\307\341\317\025\202\341\300\270\346\2557\203r'E\216\225\272\023G1\271\265\314\247\312\0333pzQ\274tQ\205\tY\340\316\351d\215K\027\272\236\311\255f\300 o\364\340P\374\267?\323\302\345B~6t\220\002\220[\371\025 \307\262\317\355Y\32746\\\301\377\216\350\205R*\333\003\217\365e2\334\275\311\251"
+	.string	"\345\335\313\275\006 \237\333\036\216\214\253\030\035\f^\326U.\3052 w\242\364\277\340\205R\347\235\027\315\207\023a{]\321\266xY\3275\305J\005\377[!"
+	.string	"\220U\217\202|\371\240\342\016\212\262\212\336\272\312Mu\223Mb\365MLKJ!\222\220\216\214\212\210\206\204\202\200\214E\342\360G\350\323\023\004\246?\264Y\335\177\275\tH\345\243\206\027\307\2074\263)gr~\311\031\307J(\213 z*<o\351D\177\360(w\270\333\022\216C<o)\345\231\204\223Z0\213r$ \325\321\333\215\362\226ow[6\271\bJ\033\023\r\301p!\024J\316\027 \236\267dC\211\210\264\215\335m\371\002\007\241/\342\240\254=o\351\002\332sWr"
+	.ascii	"Z\273qM\215\213e\356\224\267|C\217D4J\315\023$\317[\242\241B"
+	.ascii	"G\264\250\371S\t\0179\312\177T\270\320\311\007H\225f\226\302"
+	.ascii	"{\362\226H\216p\360`S\016<\023\226)9E\233\230(\271C,K\242G;3"
+	.ascii	"\312\333\335\311m9\205\177(\024\032\231\"\317[\252\200\022\235"
+	.ascii	"a\001N\020F\213\274\211ea\350q]\327?\317deb\314@\252u]\227\307"
+	.ascii	"\312\314\276\307\357\262\324\356\277K<\022\327J\203]\325\374"
+	.ascii	"L\242\001;\330\300;%\237\bN{W\215S\247\360\307\200\375 \226\210"
+	.ascii	"\365\227\007\347aFp]\305\b\330\2779\234*T\201\032\351\307j\244"
+	.ascii	"\377\245=\300\234\0355\264\270\272\0366lni37"
+	.string	"\200F\233\213\016\317\306\333h\005\331\240}\273\243d\332zxs\202q\337\320X\332\222_3W8\306J\243?\221\026\3350\246\215\323\237H\003h2\251w\363\240k\263\313\300w\330g\321n\003Gs\203Hm]W\027g\236\347\300\236\355\277\305\241\203?\246#\375\257;\202\2668w\234`h3\227\350\326\f\351\213\220\316\350\006\003\242\t\235\0331\306\263\334T2:Fs\207H\363\246/\371\206\321O\243\344\003\343\276}\321\007\364\373\317\377\360\264\341\205\255\2612C\030\367\355\312\205q3w\177\200\222K\3316\223\335!\257\325\220\027\203!\357\005;\232W\307\301|s,/\216c\371\033h^\033\315[\243yi\034\356W\340:|\253\356\374g\234\313\227\3526\3742\256\345\217q/_\030\237\373_\234\312\177@\363\266X^\026\277\373\256x\3357\200!\257\212!\357\324\220W\252yS4o\224\221\027E\363B5/"
+	.string	"\315{\242yM"
+	.ascii	"\361\226\030\362>5/\211!\336\021D^\021C^\247\345=6oS\3632\031"
+	.ascii	"y\227\204x\225\204x\223\212\274HD\336\243!\257Q\020o\021\020"
+	.ascii	"/\321\217w\250\310+T\344\r*\362\0025\257\261y\213\315Kl\336!"
+	.ascii	"\221\367g\310+4\362\3724o\317\2207X\344\005\022y\323\346\375"
+	.ascii	"\ry\321\346\355\037^\376\341=\217);th\250\334E\3515r\001W\210"
+	.ascii	"\234\3112\344\202\243\276\317tW=A5\302\037[\316\342\254\263y"
+	.ascii	"C\302\254 \324\314e\022~L;\366\003M2w\316\232\226\254h\246nB"
+	.ascii	"c\352\236\264=8\264\270\263\265#4\270\t\232\243\246\330\367\221"
+	.ascii	"6\221\315q\032w\364\212&\363\341K\375\264\025K\315Y\234O3b\375"
+	.ascii	"\005\244\324;~\227 Mj\245>R'u\3279B\352\233\240\036\3413\027"
+	.ascii	"\313FF\b\243\246\300A\372\337Q\177\206\346\226;O\242\004/\211"
+	.ascii	"\221\315n\324O\243k\303'\0241\352\2279J\247\271\345\315\031e"
+	.ascii	"\212SJQ+\265\3527#h\276\346\240q\203A_\320V}\345\031/\271L+\211"
+	.ascii	"\252DI\372\037\006]b\355LG_\320W\362\025u\324u\364\305\374\347"
+	.ascii	"v$\f\335\032+y\210\272\250\233K\330\241\256\020d#\352\223!\021"
+	.ascii	"j\031=\324\3004T\r\324B\215T'\351\026\306ub\204$!\276\203TF\367"
+	.ascii	"\\\236'tm\202\372E\347\350\363\220\224\001F\003uP+\245I\272A"
+	.ascii	"5P\215\272f\225\2605W\370\032\315\2339,\303\024Q\250\b\371i\346"
+	.ascii	"\262\017\215&q\003^\t=5\272E\223\245\313cL\246f\251,\260\220"
+	.ascii	"\376\267\243mO\217\216\261\205\260\222\223Q/\266\261{\217\305"
+	.ascii	"8\214\301\212\035A\333\336\233\223\330\373=^?\366\203\215\036"
+	.ascii	"6\261\237t\362\275\363\371\330\263\255\312T\233\260\332$\375"
+	.ascii	"o\330Mkg(\370\247[\364\311<\b\365\205\340\272&?\246\302\020L"
+	.ascii	"\236\215\t\265\251\306\300\037\263\321\307d\177\241B\005\232"
+	.ascii	"\006\373\314\350\032\3757\232\026\262\236\276V*ln\201\256\214"
+	.ascii	"\030\343\351q;@\374t\257Y\253\003\343>:s\204\r\004\314\216\031"
+	.ascii	"\2648g\032w\206B\260\231\037\372\202\004\016\260\231\352\223"
+	.ascii	"\324\247\271\350\334<q\017\r\352\033\177\314\247\217U\335\323"
+	.ascii	"@f\2345\302\213\365\324k\001\326\023\005\2775\240\353\351x\365"
+	.ascii	"t<.PDn\345\350Bz\201\300\343\347\007\322\313+\213\013\002$\002"
+	.ascii	"[9\272\270\254z\\\0313@b5\027\022\313\n\331C\210eDbeqy\3410V"
+	.ascii	"\025}\274~t\260U\345C\003\353\307\326\025\262\213\250\353\307"
+	.ascii	"V\226W\326\217\254\f\220\t`i\200\314\312"
+	.string	"\300h\345\245\001\022\213\310e\325\243\n\251e\305Ec\270WR\037l\361\360qe\245\001\217\251\037YVZSW\\]SRM\273\265\001\222k\312kk\213kJ(\007\366f\262\312.L8\332\002\036\256\\\001r\223\337\356=lwxW\272\374\230\204\263`\321K\005\326a&45SE\343h\364\251\204B\306NEO\320\264\303\324\3141,&\207/\233u\364\350L\365S\213H\r\314\257\225J\365Tw\235/ZA/R\235\243Y\347\315\351\202}\236e\n\016)\264\250\367\221Fu\212~\022-KT\207\320\244\363v&\307\214r\251\231\213\242\031\017]\233\250\243\350\0267\004!\347\216\034\261\376\372oL\025>\245f\356\341\360\206(\273$A\365\257\311~}d\304\316\2319h\332\2101\036\245\"qPB4s\033h\250\3466:2b\214\307\312>\215\330T\271Q\304\206\nT\033\265q\376\350\272\256k\022"
+	.ascii	"s\373\214Q\303\r\030r'\032\200>\332c\347>cp\334\r\030p'\246\346"
+	.ascii	"\3620\351\272*R\364\220LD\031a\217\304\b}\301\344\371J\264\211"
+	.ascii	"\346-20\r\352\nSj\253~\361\fj\330\177QlJ\364\324Z]\261\257\257"
+	.ascii	"\257\357Z\251S?\365\025s\257K\022-\354\b\005\223\350\343\361"
+	.ascii	"\0235H\t5e"
+	.string	"0y\275=\006\351\257\035\321$Z\310\314\323\303b\371\262\006\307\250\231\352U\262tD\337m\b7U\262\021\275AS\315\233\263"
+	.ascii	"\026AD-\303\301&\242\357\244\271C\021-vu\212\234\\Xsj`\032\337"
+	.ascii	"\022\2648'\221\232\266\340A\263\f\024:`\334\367\201I\250\221"
+	.ascii	"(\305\224R\n\221\214\210$I\222\346A\005\304(&)4\017\021@\265"
+	.ascii	"SN\315HL\205\306\213\236$01\f\021\34286qd\223\347\243OA\020\250"
+	.ascii	"<\207\2643\225V\272\233\007\236\007\217\302'L\377\354R^\375\177"
+	.ascii	"\346T\355\177\323c\030\236\177,G\340\244\311:\205\005\206\031"
+	.ascii	"\334\276\223\226\321\270\230\244\226Qr\366w& \243\250\334\312"
+	.ascii	"%\252Q\321-9b\311\003?I\214X]\362G\374\345B\241\227w\341\235"
+	.ascii	"s1\033\317\304\361\365&\242&3\t\b\230{\361FMh\256\f\177-U4\001"
+	.ascii	"\234\374\236\235 \026\365\227\313\001K\337=X\n\343.4\302Y\352"
+	.ascii	"\260\266\351p\301\240\004[ &\341\346Ur~\rq\257\341\222\314\362"
+	.ascii	"\243\206e\233Q\250\210pQH{\233x\232\205\237X\007\007|\265\353"
+	.ascii	"\326\372!L{\204e\036\302S\367t^\306\236\033\303\365\2665\345"
+	.ascii	"\336\307\251\306u\006K\340\301\304\313=\021\221\244\3123Yk\302"
+	.ascii	"\374M\345\376\002\272:U\312-\360"
+	.string	"\004v\276\003\250\224g\373~Z\253_\016#\310\375$\033\240?NFN!\315W\204c7\232\262\200u\312\303\031}`x\331n\231v\0026\375\027R\0251\177\240\345\320\f0\277Y3\277\237E\201\230\317`\367\363\013\264\034@\260emLc\276#\007Pt`\335\361v\246v\320\273\237\025\334;!\323\354fW\3151l\332\271\353\005\353n\3465\263\350\220\367\\?\350\313\301\313O\214\362p\306\222\230\313\371\007\240N.\005A\373\023\242_\301\251\334\027<S3\225@\262\322EUq)8*O\257\331<D\300\323\020\221\f\003^\006\354\240\250J\371\211O\002\262wU\243\372|A\007\372\033\n\031\332\373\356\223\236\021J\204\313v~D\006R\004\267`\377\003]\252\031h\223\207^\272\223\370\377\373R\243-\013H\300\n\177\240X\302k\234\351\273\366+\306\\\237\232:&\005\005\311c\004R\021\341n\234\247\207\036"
+	.string	"\0229a\\\r\247\312\252\3021\r\200\"iH\035\013II\036}\033zI"
+	.ascii	"'\314\220\323\305Eb\201Q\027\266=\240\201G&\023\361\321\250:"
+	.ascii	"\333\013\244\270\204\233\264op&\240B7g\266.\325?\257\017\204"
+	.ascii	"\274\003\261|<\311\365\346h^4\304\354\333\305?\254:\006\360z"
+	.ascii	"\212H~;A\025]\370\226\025]E\217\002D\373\354\370\271\371\312"
+	.ascii	"\020\206\002\207\260\257\004\224\357y;\0165"
+	.text
+	.section	.gnu.lto_blackboxWriteSysinfo.171.162a51487001df88,"e",@progbits
+	.ascii	"(\265/\375`I_\235\"\001\312\343\245jP\020 g\355\214\001\327Y"
+	.ascii	"tg\326:\355\311\340G\356\364\3722\256\333\263<CI\222Y\315:\262"
+	.ascii	"\207\227=dX\262\225K\205\013z \317\006\033Fxg\234q\202\356\r"
+	.ascii	"\215\207\224hN6\177g\260\216\232\241zE\243k&\230\226\036$d\345"
+	.ascii	"N)\245:\006W\006\315\006\316\335wtn\276\326\271\367\216\316\375"
+	.ascii	"\245un/G\347\326k\235;\357\350\334x\255s\337\035\235\333\256"
+	.ascii	"u\356.G\347\346\322:\367\226\243s\327\265\316Mwt\356\271\326"
+	.ascii	"\271\247F\347\326btn\271\326\271\263\3548w\\\353\334Xv\234\033"
+	.ascii	"\256un\351\216s\277\265\316\355\266\343\334WZ\347\266\262\343"
+	.ascii	"\334m\255sW9:7[\353\334\321\243s\257\265\316\255vt\356\264\326"
+	.ascii	"\271\251\034\235{J\353\334hG\347>k\235\333l\307\271\313x\234"
+	.ascii	"[J\353\334Qv\234\233\214\307\271\307Z\347\206\262\343\334Ox\234"
+	.ascii	"\333I\353\334b;\316}\003\217s\207\265\316\335\344\350\334Lx\234"
+	.ascii	"\033\254u\356\257\243s/\341qn\257\326\271\273v\234\233\213\307"
+	.ascii	"\271\225\264\316\275\265\343\334P\036\347\326j\235;\311\321\271"
+	.ascii	"\221\3608\367\221\326\271\263\216\316m\204\307\271\213\264\316"
+	.ascii	"\215ut\356+\036\347\266j\235\233\310\216s\017\341q"
+	.string	"\356\252\326\271\205\3548w\020\036\347\246j\235\033\310\216s\377\340qn\037\255s\333\260\343\334=x\234\273\206\326\271\247\216\316\315\203\307\271w\264\316-ut\356\250\326\271u\034\235;G\353\334PG\347\306\301\343\3347Z\347~::\367\223\307\271m\264\316\355tt\356\246\326\271k\034\235\233\251un\347\321\371\345qn\266\316\356\321y\251u\236\300\321\231\206\326\231\306\321y\006\036\347\031\255\263\214\243s\214\326\231ytVj\235\227Gg\t\3608'\265\316\312\2433R\353|tt6j\235#pt\226\201\307\271\250u\206qt~\321:\2738:'[g\242\243\363\020\217s\213\326\031yt\206@\353,tt~@\353\354\200\243s\003x\234\031\320:/\340\350\254\200\3269\001Gg\004\264\316\0078:\307\300\343l\200\326\031\206\243s\001Zg\002\034\235_h\235]8:\017\200\307\271\205\326\231\205\243\363\n\255\263"
+	.ascii	"\216\316*\264\316\0018:\247\320:\243pt>\241u6\341\350\\B\353"
+	.ascii	"\f\200\2433\t\255s\320\321\231E\353\274\342\350\254\242uNqt\036"
+	.ascii	"\241u\006\332q\026\241uFqt>\321:\2338:\207\320:\203pt\376\240"
+	.ascii	"u\366\340\350\334A\353\314\301\321\271\204\2163\211\326\371\247"
+	.ascii	"\203\363\210\326y\203\016\316\032xp\316\240u\306`\307\371\202"
+	.ascii	"\326\331\202\243\263O\353\\\301\321\231\202\326y\202\243\263"
+	.ascii	"\004:\316=\255s\004Gg\bZ\347\007v\234\035h\235\033h\235E\350"
+	.ascii	"83\320:/\260\343\034\242uV`\307\031D\353\374a\307\231\247u\366"
+	.ascii	"\260\343\274\323:w8:sh\235u:8\267\034\234\217\034\234s88\343"
+	.ascii	"pp6\3528\263\255s\361\350L\314q^q\234\207F\347\307qv\243s{\035"
+	.ascii	"\220_\332\236Z\231\257\367Cs\356(|\343\324[\263|u\226n\263n*"
+	.ascii	"\335j=dnVv\2249\244E\273\270\343:\013\267\034\3470scq%\320#\252"
+	.ascii	"'\001n,\234\363\326R\t4\234RO\r4'\023\216\215B*\002\330^\031"
+	.ascii	"\013N[\351+\3149\034\243\243L\304\203\002\310&\0067[Wa\316\341"
+	.ascii	"\031\035\345\365\f\033\230\225\024\247\323\231\323+\363\f\346"
+	.ascii	"\234^\207\314.\367Y\247\365\032\347\250\321\030:\241Ae\306\300"
+	.ascii	"N`\321z\212\333Th\364\324@s\362\310y\312\201E\n\033\247\023m"
+	.ascii	"\203^\331\003\266\327\016\316-\245\313\3346\233@\017\023\232"
+	.ascii	"\223\211\310\246\243\212\0246N'\217\rze\022l\257M\246A\020{\205"
+	.ascii	"\240y\210\275\262\007!\270\374.`\203\251\f\007e\226<\255\261"
+	.ascii	"q:\321J\274V\277\315S\326\302r\234\205\343\030\013\303\261\224"
+	.ascii	"\337\330\215\257\260\025n\343*\314\306Q^c5Nc"
+	.string	"*<\205\321X\254P\221b\004 \021P\2340\021\002\b\037x\320\001\007%H\374\214\330@\203\f0\270\300\002\237\n(\230@\202\236\b x\300\201\006D0\260@\b\005@|\340\361\260\323\201\203N{\314\3011\262E\342:|\177\271\231\232\247&\310\374\262\374\254L\365h\326\302'EW\225\243\303\313\"\215\2433\303B\267\004\216\316JJ'\365\246F:%tS#5\255^\231\342YI#5\225\266M\315\252L\227\260M\255\242S\251\265;)\271\252\232\303I\311I\323\300H\345\314\250\310-\231B'%\307hrR,\342\bWHU\3049I\321'\025\267d\2041\3228+\2404\3228)\021\326H\235\021\2428\253\236\3505\3223<\023gIB\220\236Y\201 u&\365A\031\241\007e\325\016\312\3608(\223\226\250J\313\314H\224I\375t\2364\n\341\210(\322\r\242\374\320`\254\232\201\023\f\306\236\027"
+	.string	"J\237\340Y\340i\244O\226\370x\240T\214\260\002\177#\025\243\300\013\245\304\254&\3705\251\260\252\004\201\3220\274\036i\004}\32203\b\370\244aK\036\220\206Y9"
+	.string	"F*L\252\201\235\251\224\t\241\b\006\206\037\330`3\304\001#M]\303c\233'\276n\302c\314\027\270\"\f\341\241P\352J\252\300\020\304\007#Y]\375a\250\001\23185\375\205\207\327\020\304\216%P\335\204G\227\363H\245\210,\361"
+	.ascii	"(E\304jG\207\310\263\203\264\212\220\003\236TUU\307N\252\n\257"
+	.ascii	"\245\223VI\217h\244\252\314r\246RUKp\346\244\252\254\214~RUR"
+	.ascii	"l\337I\203\020\026}*\025\244J\354\265v!\025\224y{\202\263\301"
+	.ascii	"HVW\257\\J\266\240WVD\206T\t\tB\265C*JG\016(\0347\n\t\007\337"
+	.ascii	"\270i#\310&\260\n8FL\230?j\036\336\235]\027.[\352\340\244onW"
+	.ascii	"\254\264U93+\223\022\205\f\312\327\022.%[\320++\"C\252\204\004"
+	.ascii	"!\312\300$\260\215\360\240zz\022e`\022\2103e\203(\003\223\300"
+	.ascii	"\017F\232\274Z\030v\310\362\352\037j`eg\203\316\224\323\020\204"
+	.ascii	"\227\2541\275\326\236c\252\311\275\030\344t:\331\241\246jh>@"
+	.ascii	"3\263\0240\257>\314\005H\023\276dH\024\2463{=\316\306\200\350"
+	.ascii	"8\336s|?Q5\271\r\337^\261\"\315\254,b\257\216\343\273Jg0\345"
+	.ascii	"\355\006\2532\252\036<\017X\361/U\232H~\250Z\354\323\2718\360"
+	.ascii	"\017\274O\267\206kM\256^\203r\323k\250\326\374b\001u:\235&z\345"
+	.ascii	"!\225aZ\223IXSL\214\330\253\003\337k[f<\246\036D|\003ho\224\n"
+	.ascii	"9\2637\353\207\032\3555\337\300\367\023\341\213x\237>\021Fu\267"
+	.ascii	"\355\311\351\3550\020\245\371$\005\2659\306>\035m\354\235\372"
+	.ascii	"\241\372\r-\234\341\332\311\354NNg\r\n\230\233e\3153o(\006>\006"
+	.ascii	",\247gb\207\352n\333\213\323\353\260\300\r\257\226\nh\2237\353"
+	.ascii	"\207\252\025\342\027x\237N\031~-\tA\006%P\320\314\2378(\320\365"
+	.ascii	"j\245\240*y\263~\240.\004\304+\2206\324B2L\322\\ck\266\265\021"
+	.ascii	"{\005\001\005J\340\230\223\316\207\254\"S<\377\341\312\320\212"
+	.ascii	"\b\217\240\2313\265\036\252^-\023\324 \315\267&\034\373\364\033"
+	.ascii	";\357\341\375\255\0317\374Ach\303\320GSn\332\244\243#\366\272"
+	.ascii	"\363"
+	.ascii	"\275\326(8\201R\0353#<\372\216\357\360\035\035\326\360F\245\200"
+	.ascii	":\023\2174\034\276\303\373\033\f\316\334\354\322\274\363\206"
+	.ascii	"\342\360\275\326;j\322*0A2M\315S\2427\275\357x\366'\252&/\344"
+	.ascii	"\027\274\007\337\231\236\373J\323Ks\317\033\312\233\276\307\306"
+	.ascii	"3q\027\2763A\375\025\276\361{\360F_S\2147T\257\355\346\373JS"
+	.ascii	"\240\306&\305\252\314MsP\216\316wt\370|\265Rt\231\241S\337\363"
+	.ascii	"\231\270}\235\357'\302\241s\310\324\364\343\356\342\346_S\214"
+	.ascii	"7\305\020{m\331t\267\355\211\351\341\360\0236\001\275\241\230"
+	.ascii	"\203\037l\0066\3134\317xC\271y\265R@\005\337\251\237-\306\275"
+	.ascii	"&z\3174\306\017\324O\363j\265\032\364L3Ms\r\373\354\265^\353"
+	.ascii	"\266AZ\345\024$\363|&V\032:\235FXt\226n2T\274\220K\200A\355\210"
+	.ascii	"\225\224\216\366Y\323Ms\260Y\370\245\006=\033\317\304,\274\265"
+	.ascii	"\264\334\333\304:\235\316\206\342\316\362\332x\237\274\241\270"
+	.ascii	"\345\032G:\345\024$\343\364L\334f\232\203\330\234?~G?\314\033"
+	.ascii	"\245\202jF}\271~\240_=O}8\216{9r\002\257\212\306\307\371\216"
+	.ascii	"\276\2277\252\363v\260\317\206\346\275S\255\005\332\203}\366"
+	.ascii	"\220\273\227\213\005\265\243\272\274>\200\260O\032\206\316 \317"
+	.ascii	"T\027\344\275\"6T\2578o\244\372\351\317\275U\303\356\342\227"
+	.ascii	"\310{E\274\"\366j"
+	.string	"\374\017\177=\246\273m\217\b\261\204w\364\345\336\254VC\302>\217\342^-\025\324-\366YtA\257\035}\270\227\353\007\352t>\033\352\365b\237\013\270\240W\346\367\353e\342\r\3050`=\237\211\373\257{O\210\036\223\0172\301\343Z\037\311_\341w\343*P\036\325\225*\374muV\326\370\243\\\005\302\243j\243\302\237VW\345\214\037\215\253@wTlR\370\313\352\242c\374d\\\005\262\243Zs\302\377\244N-\214\377\006\256\002\321Q\245\201\3613\251\243\342\305\277\204\253@sTS\224\360sq\025hZ\207\246\305\017\345*\320\224\212\305\021~$u+\212\360\033\341*\220\026\025V\374W\\\005\202KQ\305?\204\253@R\252\021\250\370\203\324\001\371\340\377\301U\2407*\021j\340\357Q\207\342w\360\363\340*\220\033\325\211\327\301\037\305U 6\0238\370\241B\320\361\344\177\002!G\023\277\323\007P\357\344g\362"
+	.string	"\307 ;a\007in\264aw\303A\341\032v6%\b\321\260\247!1X\206\335\314O\233*{\340\bA1\354c6`Ce\377\323 \260\217\035L\006\325/\354{\030"
+	.ascii	"\346\261\353]0\306\216\375\316\0021[\330\271\370P\347\330\351"
+	.ascii	"*\310\223c\327B\201\035\026\366\270\t\266\274\261K%\220Za\277"
+	.ascii	"\322s\205\215\275J\004U\324\330\327 (\233\302N\345\00123\366"
+	.ascii	"3\007\276\242\260Ki\240\013\n\373\230\210-1v'\fX5a\017[\200\310"
+	.ascii	"\027;X\210!`N\254.v/\005\252\300\234X[\354J@\bI\302\256\305U"
+	.ascii	"\021\334>d\261\037\341\252\bnT<X\354E<\234\331\001\346\304\""
+	.ascii	"\302n\305U\021\324\352v\204\260Wu(\004sb\001a\247\342*\nB*\016"
+	.ascii	"n\003\273\017\256\242P\2433\305^C\033F\212}\307\361\017\314\211"
+	.ascii	"\3459\330u\344P\301\234X7\330q\324\341\330`\177r\025E \225\321"
+	.ascii	"k\2607\325\261\205\354N\256\242\250R\025\337p\017r\025\005 Q"
+	.ascii	"\220\273\315\312\005\314\211\245\206{M\335\360\f7\032\256\242"
+	.ascii	"\030C\365d\270\3138\034 w\265\245`N\2540\334b\270\312\366+F\354"
+	.ascii	"\265\033\313Y\346\r\214\271\251\314\\\365\200\214\017\212\323"
+	.ascii	"\311\324V\3542W\035\312\351t:\235\031\364\312\276\002hMVN\310"
+	.ascii	"\314oX\203y\305X\247\323i\202\233\257\373\336'\357\330\033\345"
+	.ascii	"\215B\354\225\375\006@\0013F\374\342\027\373\236\b\371-\353/"
+	.ascii	"\357\031\353t:\231\340\326k/$pw\365\312%\234\340\r\325+\367\t"
+	.ascii	"\304^\211\177b/\332eUfV\303\013\231\321\232\332\343\322x)2|$"
+	.ascii	"\314\334\375n\244Xe\377H8\005\342\372-\322\3028y\033n\300\031"
+	.ascii	"\255yJd^\241\005o\250\365\273\355\213\033=\247g\342\3417\233"
+	.ascii	"\037~\217\32331\367\\sa8\356.v\201\245\336P\275\376w\023(wcT"
+	.ascii	"5\274\220\375{\315{\337\023a\r/\344\020\336\317\fC\f\304\206"
+	.ascii	"\362\357qz&\346\236k:\206\343\356b\004\260\324\033\252Wn\226"
+	.ascii	"\022{\355\357\265\336\240i\215\317"
+	.string	"\252\214\252\206\0272\2435\365\320\351t:\375\2210\367\320\351t:\371\2170\267\316\276C\307\331s\3508;\216\326\331\233Zgg\352\340\334\205\255s\017vpn7M\245\271\331\264Zs\257a\347>\243\343\334ft\234\273\214\216s\223i\235;\360\350\334\325\326\271\001w\234{L\353\334bv\234;L\353\334\177G\347\246\266\316\355wtn0m\337x[g\334\230H\362\035e\235^-\026l\r7j\007\373$J!\371N2U,t\202d\360\3107\035\2314!d}G\213n^\255\025P\301\227\353\207\272\026\032\371\316\352QT\343J1\202\246\310\367\364\017\360\f\bXf\310\224\271\372\306\362Q\004t\251\\\211\261\372\236\206)\363\001\221\357h\361\357\325j\265\242_3\315\017u\275\033\362M\004H\221\257\312\220/U\337v~y\036\b\371\216\026\365\212x\353[\220o!A\212]\244A\266P}\317\361\335u"
+	.ascii	"\344;Z\244{\265RP\247\357\324\017u\235\362\343\033HU1\213\226"
+	.ascii	"\037X||k\361\322\205\003\033\276\243E\351\253\245\202\352\346"
+	.ascii	"\022q\257\330\347\032\326\343\333\206\"\305\266&\227\036od\253"
+	.ascii	"\341{\212\267\245\304\324w\264\270VL[\261x|Oe\025\321\\.\226"
+	.ascii	"\330\344\352\271a,\2177\232\355\370\246\373\353BG\002\352[\307"
+	.ascii	"\267\224\224f\223\t2\252\250o\251\342\023'bQ\337|[9\276u\024"
+	.ascii	"\303\2320\311\361\276\366\207\343\033\352\313\345r\277\256\342"
+	.ascii	"\022\327\313\361\274\252n\230\333\031q\274\373)\271\361nW\027"
+	.ascii	"\367\363\364\035-B_-\023\324b\222\225\307\363\373)\313\345\352"
+	.ascii	"\273\"V\321\210\353\325Z\250\305\".\0327\254\245P\266\237\337"
+	.ascii	"wE+\033\337\322-\237v\267\371\235\215p~\327\370v\372\216\026"
+	.ascii	"\207\024\205\254\317n\372v*\002\371\341\243\351\033\314\226\031"
+	.ascii	"\323w\215b\217\032\246\372M3\275\337\316\255\342\016\227\313"
+	.ascii	"\003\213:\212R\305\250\032\305\367=\260\b\325|\317\333\3122\266"
+	.ascii	"\001\215\237\300\273\337\321\342\215\342sp\351\335b\023\233b"
+	.ascii	"\215\"\323\022\r?\201B\302A\0364\314\3604\334\260!\266\021\344"
+	.ascii	"A\234\341\035P\315\214\367\273?\270\3566\2770\r\226\317|\031"
+	.ascii	"h\314\240\211\3612\002]\256\356\253\272^m\007H\215\361\335\247"
+	.ascii	"\364L1.\227\263\205q\275\232\360\257\327(\275\263mI\340\227~"
+	.ascii	".\227\003\362\021\301\364Y\255\022x\007\374\222\364~\367\347"
+	.ascii	"F$\203\b\374\321+\365\360\306 \275\262\013\227-HF\177D77m5F\357"
+	.ascii	"k2|\004\344\\.\367#b!fq\275\034/\256\313\rs\273\241\f\322\242"
+	.ascii	"6 \030\020\275\213\207\341f\205\357\305\303`\213\256\275H\276"
+	.ascii	"\2134*S\310\222COtF\202hVF6\024\245E\264\273\315o\352\002\007"
+	.ascii	"\274\320#\307\232M&\210O\206v\020x\344\r.W\363A\303\\\257\246"
+	.ascii	"\2436\231B\340\233\357\001/\004\346r\371\032\365\313\365\352"
+	.ascii	"A"
+	.ascii	"\350\222V\363\200\367\265\277\006\274\003\272\\.\367#r\271"
+	.string	"^\216\247\244\212\033\346v\rx\367\2032\340\335.\315\215\005\007\370\004\374\002\2224\233NP\2174\233~\262(\340\027P\304\345j0P,\327\253\355\250WsP\005|\203A\300'\200\210\313\345n\324!\256W\027B\253\372\r\002\336\335\376b\370\003\004q\271<\360\207H\345zy\037\025\310\234\033\346y\320\030\336\003}\030\340=o\213\n-\215\217\013O\200\207\341;J\354A\234j+\300\303\200\204(\345ru_\224\353\325v:\246\005\370\356{\341\t\240E\204r\271\234\r\207\353\325\2047z\315\013\357l\003x\027\334-\342\323\345r@\036A\264\341z9\037\224\335/\242\223\313\204%65\371\3340\277\243\266\002\210\275\016\340\035p\313\214\350$2)@\314}\362\204\330k\013\357w\177Tey\025\004\340\005\360,\0206\233L\274y\243~\250C*+<\013\202\357Y\363\261\351\361\006\266F\315\n\337|[*\274"
+	.string	"\320\274g\356\006=\323\343\r\314L\031\025\336\335R\370"
+	.string	"\004\276g\216\206:\266V\263\336\300"
+	.string	"\307\244\360\216\346\217l\013\005"
+	.string	"x\023\036\2050\315\246\023P\352p\354\204G\241\357=\353>*_\330\333\221\275/'|\367\225\360&\350\275g.\315K{;\202wW\302\273t\213\204\007@\227\367\314\327@\243\254\\\3343o`\357\355\310\226:\022\336\327ley\"7A\212_\361A\337\321u\256\331t\342K\013\022\026\0374b\215{\317\032\f\026\367\254C\244\301IY|\203Q\361+~V\267\367\314\341\250W\3343\337\331\263\322\246\342\035\356o\204O\301k\332\312\366\236\371 \324\351tB\301\354\226\255Q\367\314\037\350\341\306f]S\363\346)\261\327\021\336\007\267\262\334P&\001\320\224Wk\005\365\314\235\342\246\261\317\241\017\021\036hm\225B\243C\244\271\241\211B&\3027\036\223(=(\2408\311q\342Q\260\255ad\23209\261\244\273\r\314\230^\004&\276\274\206L!\274\211\266U\311\236\333\230-h\b\337t[\\\335m`\236\350A"
+	.string	"B\222W\353\304z\204\315\007\017\302\225\265\310{\326 \344\334\250VR\234N'\023=eNZ\261\334\267b\236\327\016.)N\247\023E\257\274Z\255W.\\\234+7%\366\372\301\367\334\037T\354\001\017\276\243\353\220W\253\325V!\257\217\037\352\243u\360\036\320\255@|\254?\334-]\334\273;b\257\035d\031s\023D\342"
+	.ascii	"\007=^-\026\320u\352\277J<\007n\336*\265\352X\243\\/{n_\037\261"
+	.ascii	"\327\022X\306\334\306\314\2144\0075@\342;\272B\275Z'\250\353"
+	.ascii	"\215f\323\017\025\t\263\353\267\332X\233V'\367O\214\013\350\002"
+	.ascii	"\022{%\361 \266\314\256\272\333\300\\\211\330\340\177\276\243"
+	.ascii	"+\323\033\325\204\324\302\227\253\253\377c\304\377\004\016\337"
+	.ascii	"\270\031\361\216\367\247\301o\360\"\356\3342CA\367\314\232!\033"
+	.ascii	"7\r\273k\\AW\220\330\253\006\357\205\\f\213\023\003\355\016\022"
+	.ascii	"3\370&K\373s\3626\314\354\272\031\242q\007\317d\360\275\326\353"
+	.ascii	"\22015A\263!\013`P\346\325:\001\rl\276\375P?\352\202\307@\314"
+	.ascii	"pL\223\213\273\213\335\302&\023\023\261\327\013\036\304\026U"
+	.ascii	"\220\356\266\275B\275\020\023|\005o\301wt\370\327lb\321\264\301"
+	.ascii	">\277\311\257\371\364\203\203}\272\031\252gb\237\267 \307\220"
+	.ascii	"o\317\347\333\356\217\202\257 j\350E\217\202\357B\t~\202\367"
+	.ascii	"\351\216!\236\335\360\2569\305=\232>|\020{\225\340{\255W\260"
+	.ascii	"\202B8f\366\2439H\201\236g~\303\206\\^\261\227R\207[\032\312"
+	.ascii	"\f\231f\277\347G\230>\255\232\274\320\235\315\2226\020\021|G"
+	.ascii	"\207t\257V\277\201N\337\251\006\204\202\201\340#x\021oM \303"
+	.ascii	",C,\303\270f\020\326\351tV5\211\\\021{\205\340\275\372\327c_"
+	.ascii	"{\037\036I\230\366\034\337k\035\254\224\\\306`\"\223.\214\234"
+	.ascii	"$R\036\t\275\210\321\"I\224\303\311\030FH\031BI#\242\"!\246\022"
+	.ascii	"\206\022\321\016\0076R\016)\231\312e\222\320\321\214$!\036>\232"
+	.ascii	"\221$D\224\034B\242\241\204\024C(\251\024c\207\227I\242\"\031"
+	.ascii	"\312e\222\320\fK#d\3212\251\344A(\311D\312(b\016!\205\222D\312"
+	.ascii	"\243e\021R\204\220\b6R&\t\r-w\370h\211\024b*-\213\\\b!)\205\214"
+	.ascii	"\220C\n\274@\036\265\312%\262\205\016'\227\310\031DK$\f\241\241"
+	.ascii	"!d\233\343A\207i\200\321AI\t\2314C\351\201]$\031\031\205f i\264"
+	.ascii	"L\204\204lA\204L\022\031\217b(\021\025%\265\214\3033\2204\204"
+	.ascii	"\230EGEFBCCH\235\344\f\005XY\304D.\205\220\224EL\344\fH\243\344"
+	.ascii	"R\210\231T\022\341\201\211\214\2240\224\222K\030L!\032\314\""
+	.ascii	"\031\310\345\013\241\"&\0222\204\001\220\212Z`\222@T\224\264"
+	.ascii	"\303HE\310\027BDEI:\234\024\203\b\251hFQ\313.\\(\2311\206x\230"
+	.ascii	"\006\030B0\206\230J$\0163\2204r\230\006\030B.\222\214Z\241e\222"
+	.ascii	"iT\344B\350h\231d\022yx\201<*&e$\215\2142\220H,\233\240\302\013"
+	.ascii	"K%e\022\253\244Lb\032!g i\024\331\004\025^\2001\304,J2\262\t"
+	.ascii	"*\274`d\244\\\262\304\241%\313D>#\214\2544\26442\023\251H\231"
+	.ascii	"\024"
+	.string	"\001dr\331B\b\231\304\344\300I&r)\204Lb\032Y\2314CRh\t\203id\242\242#\241%\f&\3130H$\215\212\\(\227IBI&ri\244\\2\221\224C%\206\\T\240\244\224\034R.\223\204\210\212\222<\b\r!\321\350\220\244T\032\031y\251TBJ\302\300DJ.\2271\206t\330Er\311D\266\220\301\362\210\030>FN\276@2\215\2242\214\214\222CLd\013\031\035\230\310\0262r8\206\317s\n\035\b\r\r!\213L\3443\202\310\207\310G\236\301g\006\016VN\032!\207\224\204\224K\032/rf@\036\0359i\304d*\2270\230HEGG\027X>R\"%\211z^`\231\310\247\004\221\017\361\205\034&\362y6B\312X&\231HE=*\344p\362\b\211\324\303t\201\\\226\220\303\311\243\"&s\211d*\365\274P\262\300\303DN2\221D\334\001\211\017H|@D2\223"
+	.string	"\310a%\237\236\f\224|0\350Q\362\351Q\362\321a$e\221R\221\214\344\322\0033a\274(2r\201\204L\032\225pd%\237\347d\022\rfOr\211\234q\264,BA\207I\344L$\025f(Y\330a\"\251"
+	.string	"\343EQ"
+	.string	"\2301\222\2301\\X*\231\312#\017.b\264x\036\"1\203\262E\004\206\220F-J \025!\217J\f-\225J\220\210\200\225I\311e\t\246R\271,\221\303\314\214V\243\377\bwW\23266\270a\367K\354\265f\337\2241c\203{\356\227\330g>\0073\367\231\347\240\032\337\304\0230\353^\353\235\366k\016b\362\301/,$\244\306`\346{\274b\034\24085"
+	.string	"v\227\3716\363\217\303\343\025cqv\224\371\337\233\003{Sc\2723"
+	.string	"\231\357(N\024N\016\234!1`=\237)\n\347\306\322\016\234'\316\323\322T\217%\037>\210\2756\031(dycV`\b\374\216\3428\341\324\300\341Q\375\016|\237.\0011\026\032\t\253ddx\202l\005"
+	.ascii	"|\323\206p\3147`\020\343"
+	.string	"\032\032j\306\340\215\2515\007\021@\314w\324\210\306h\306X\r\363-\246\312\030H\243\347\252KY\255\0050\f\027\262\273)\315A/\374}G\215b\214\177F.\324\357?\"F0\357Y\333\365-e\365\034\037\325\f\331\235\231\013~_\364\214U\300|\373]\031\357\336\263\246\243\362R\021\243\335RVO\241<Db\354\002\006\217\314.\312"
+	.string	"\372\266\274Z\255Fg\024\343\373\356Cb\324\"\307g7\006\245\205\27588\243\220/\337{ZF\267+_\304\232\203X\360\362\0355\266\031\331\330B\275o/[F\2654=\272\261&+\344}G\215S\214g, \336w\036\227Q\212\221\314\030e\311\353k\211\t\023\274\271\257\346 \001\334}G\215P\214N\3309\273\357\2730c\030\023c\223%\261'Kccvd\310\346\272T\350\362\345U\205\313w\227(F%P\343\326R\331\331\322\224)\304^\233\313Tp+"
+	.string	"[\222\274Z+\240\306#\354X\335\367\2264c\221\367\354\312\210\265\264\306\266\324\326F\354\265\353\246cIR\240\373\216\032\211\030\253X\256\271o\272\367\351\025#\325{\006d\016\005;2-\202Y\315A(L\277\243F\037\306\036\354\225\226\357\351\373\364\211\007\327UtZ\356[\313\367\263I\223\027rg\371\226{\007\006\237d\342\276\263|\277\031w\3200F\031\245\226\340\342\226\344\344\210\275v\034\nh\310\264`\235 \375\306\362\0355\346x\243Z\315\210\203\325\001\367\215ej|\032m\300}\317\275}K\351\214M\306\032om\310\340\210\230`\345\333\355;jt\276Q+\b\213\203W\276\335\266\260nh\264\271\362\255\345\257\355\333J\027\226\r\2155m)p!\223\216\ti\016*\241\312w\224M\303\236)\216a\373\256r\307\222\td\303B\366\006\2449\b"
+	.ascii	"Q@1\305-k\337\321<\226\352\267\246\205\354\315\006\022\324\372"
+	.ascii	"\366\340\322\276\325\226\274\260zl^Z\0232\267\251\346\240 *w"
+	.ascii	"]\246L\371\246\262\307\326\321\365\22492\2671)\026h\323W\353"
+	.ascii	"\004+W|r\366\215\266\324\307ba\245,\334\222\337\322\337\222\230"
+	.ascii	"%1\304^\373\314\214\214M\320,Gs\320\n37+E$e\337fK\200,[\363Y"
+	.ascii	"\306\256I\371\246\333\372\033\335ma\202\250\210\362\035e\323"
+	.ascii	"\330)E d\337Q\226\002Y3\035"
+	.string	"dR\306\276\247o\243\273-\f\220\024P\310^\255\024P(Ke\226\316\260\317\242\216'\337P\226\322\260b\315\032\236\260aN\276\341\376\276Fw[\030\037#\210}GY&\354\027q\360\206o\261\2455lW\223\352\006%a\337\323\302\356\2660=\200\232@_\255\216&Y\022\\r\303>\211`\230|7Y\032d\263\\+&E\300\276\357\336t\267\205\231\022\341\353;\312^\275Z\355\006e\211,\0252\261O\342\225%\337_M\254\020\367\310\022\226\312\353;\357O\260\020E\327w\224\375\301\332@\204\302\365\335e\203\235j*\341bw(\371\246\373S3xb\353;\312F\275Z\035\245\2629\334'\027\007\373$bA\277\267r\2607\232`P\366\251\025\206\242\250\363\220f\241\200*g\210\241\021\021\021I\222$\255\001C\033 \b\006\2424o\241q\003\023\300\003J'\244Y<M\344(\207\230\203(\225T:\354\252"
+	.string	"\334b\256/KqA\230\341\234O\265Un\021w\301\214%r\030S\240\202(\202?l\327\342\261\230\322Jm\220q\266\023S[W\036\nd\271\217 \234Y\240\245\2732\005>4\336\030\240S\"y16\237\227\304ad\\?\343\374@\255\030\355;\372\367\370\317y\317(C\375\363\255\305\36787\354\343n\342\323\246\360\227\272\201!\373\304&\316l\303q\332_\217>\351\2679I\302\245\221\035>Y1d\243\374\035\020\263Y^l\016\321j\030z\202a\377\007\224q!\367\377\233/\227\2126\r\026c{\207\212\021\0265"
+	.ascii	"\037\275\241\034\272\311\335\305\324\333\321t_\244"
+	.string	"F7\323\021\325\273t\345w\021\240\214\357y\t\351\236\027\316\276b\204WK:uK|\226\b4C8\304\026\2112\330\216\t\321\222\263\035(\037D\035S\017\002\250)\360>\324\321X\301\2410\216\363P5\270\006\236d\242j\254\362\307\020\013\232\372^K3s_\336\222#c>\221E\254\b\024\257r\370!\243\242\237/\202\234c\300\304\237~\213K\327\237\331\017\324\206o\230\347SB\364\212\311\304E\026\250\t]D:&\373\001\216\265\275\326\374\032\270\261I\254'\324\030j\342\304\256\272#\216\306'D\217\215p\246\337\211\262\354I\345\216\344w_,\327\215?\261r*\264KW\003\030\332;\301\354\276\264\344\331t\374\2676\317m\250@\246\246*_\267\"&\310\215\034\"\212\357\237\t\002\213OM-M\242i\273B.\241\232\320\232\311k\347\t\361\"\\6X\252[\264\3002\375\35621\226\216\032\245\315\220\271n"
+	.string	"mMOA\200\310\317G'A\347\261H;\367\226\177\003a\0069\332Q\264C\257'\362{\215\\\311\004\177\2425\273&\243aCv'\261\251I\177\337\232\b\030\326\376\034\354B\340\313\326q{\007\326=yA\311x@\256\306\272\352\313\276-\317\372\233\004\366o\311\335\252\335\2120\273/z\":\3224\377\335u=\336dtOd\327\315\233\232o\254\206\206\222\231I\226\357\316\217\f\2356\031\262:\250:M\236/W\240U\376\263\215+JO(\272y\005Zn1\020!\211\254\341h\260\302\305-\037\216\256\232\2034:\327W*\374\360{\320\222\256\262^\013\326\231\202\307\322H\f\3421h`"
+	.ascii	"&]\024:dCMr\030\327\334\276\324\237L\300H\n\341\3567\031\215"
+	.ascii	"\235\316p\242'\230Z:y\360N\366n\267v\311vO\264\006\357\374\317"
+	.ascii	"\035\302\025\324h\t\002\215\031\256.\213\270\376\273\371Z\364"
+	.ascii	"b+\330\235\207O\356\347\n\",\032\314v\361\230\334\004wd\266\207"
+	.ascii	"Y\264Nk\270\247\307\325\020\350\325\335j\365\276,\214\315\301"
+	.ascii	"\242\252Q \016\301+4"
+	.string	"\351\254\227%\274\336M\246\250@\246\031\222W\350\306\252\346B7\200v_I\224\313\257\222T\242\033\275\355\322EZ\332\0255WFB\233\311\007\340\036_\267\013\032\323\370\232E\"\274\236\336\bv\202\367\220++\033\254\305\207B\360Y\250\032\204^\347\266\243\245\007\225\3044\277\273\342\260\217L\201\340\300\314\215\262\213\333\347\312\307A[R\356\262\262B\356\n\344\277\261\253\301\203\351*\264P\b\337\204\035\211h\370\270\342K\366\2556\027I\334\367\374\342t\354\3712\365:&\030\032]\351\203\035\013]\270\244\022\te\210\306\023+\201\312 \20238\222e$\250ReGHP\356h\b\333\230\034H\212\274Kc\323\303y.\035A\234c:8B\224\312\234\364\316\024:\330\b\037j\3055\372i\323\214\204I\240\0203\330(\251\304<t`\361\227\214~w\005\203\254Zj\361\310\277\021i\354\315\221\007T\354E\306FKy"
+	.string	"\230\305InD\035\251\"\224H\212\363\227\344\210Lb\225\321\262"
+	.string	"\303T\354d\271\031\220\377D<\333\241\270\n\311\341V\251\340&\022H\352V\264\224\365\260\031\347\270oY\303\223\203\214\261\240\365-\215a!J0\027^s\032!m\253ub\036\b\210\002\253\313\034\341\202"
+	.string	"\001\310X\275\336z\005\301\246\002\257\2329\"\376\306\244\035\013F\r\263"
+	.ascii	"\252M\365\030\244\307\300"
+	.string	"\333n\214\305$\006i\241!\251\001R)\r\301)\372oNK\242\362F\252\277Z\273d\376\351Z\271\215\212\337\355\206\t`\324\020J*\211\002\352\345\233\323\254U~}"
+	.string	"\t\315\377sY\266{\031"
+	.ascii	"\363\306\377JD\005\346xCK=\003\220@\321\341\215\362t*\216\213"
+	.ascii	"V\221[s\323\332j\216V\"{\230\017M\253\237\b\013\310\233Cx\002"
+	.ascii	",B\036\317\365J\220G\336Z\234q\273H\370\301T\231G\306"
+	.string	"U\313=B\021F\222\216&\250\206\237\004\250\362H\240R\336\241\006\373\316\016c\216F8\263\b\016A\001U\"\335\200\222\247\211;r@(yS\231\\I\021\"MN\r\220\340f\241]E\244\226\265\307\255k\345AFR\202\024V\316\366\f\355j\310\340\303\035s\217\226i:)\2006F\216yS)F\301\251k'\275\370E]\206MCh\340V5\342;a\303\213'\030\306e-\354p\372\226\205l\\\236\220\334\236\b\223t;\340\334M\344\023\365b\213[\t#\r\347(\026\017F\271\310H\354=\303g\313\344\024E\252\200#\207l\205\033K\2104 \315:\335\253\352L\363~\201\025\342I\375\201i+F<\231@l\232\221A\211\335\"\013-\016\345\f\313\n5*\232\202\364\326\\\345\323\224\312X\201\r\375\324\374+\220\207\026\b\340-\001\322,\030\260E\316\233=.\255M\177J\334\213NA\215\214\355\321\345"
+	.string	"Y\006\0165WK\266d#\336R-\375\304Y\242_1\266\254\320\205\200\235\301\272k\030\306\326\177\314\007j\361\321\025\256I\303x\b\276_/\007\020\026xmX\233r\303\005\r{\325\363\253\341\320 VZ\027\325^Ap\217\311\352Z\005\320\310\020\036\232$\b\007\347\230\264\340v_\032\361\201\243\253%qQr\023\256\311\374\r\301\225\224\031T\325\200C\031\301-\227\305\372\315\002\271R\214\216\210\345\221S{S\",\225\317\b\321\201\r\251\222\214\017m\237\201H\320M\017=\213F\340\b\234C*\252\"\242f\304"
+	.ascii	"5\264\252\023;\264$a\262V\026\312\270\243\330hjr@{\232\304\030"
+	.ascii	"\370\223\205\231\t\036p\306\031\\\246\"/\262\004J\221jG\363Q"
+	.ascii	"\264\200sZ6N\205:\253D\001\255\342\360p\335@\314\304\373!5\270"
+	.ascii	"\230o\234Y\005\321\260o\305\t\022F\321#\"\270I\255\353\252_\276"
+	.ascii	"\226\370\027B\0376\2131lP\240\264\024*\211\355\226\346\007\347"
+	.ascii	"\25241$\257\321:B\214\331'\265\016"
+	.string	"s:C\035G{\202%y\315H\243\325\241\207\304\005Z\271OR\233\243Q\201\177r\305\251(\013!\b\303\027P0\310\233^DG\3344dp\261\321s\252\030 Y`L[\240\037\343~\226Q7d\212\243\203\317|\201\262\340_\200\016\263\370\334\213\2272\236\307\322\265;\341\001z3\\D\305\026\355\364j\003\336}\033)\301{~c\025\270\336\267\3714\334\347mF\001\307{\233\311+\0048\n\211\374\312\326h\323\320l8\327\221\355\253\355\255y\253\341Qj\350\313\303y\271\231\006!\277;\030\212\324\312\222\340\317\030\337\035:,\021\372\267ti\336\227\332\344O\356\331.I\372{\373\256\320A\251R\377\352w\025\215\313*\365\265>W\370P+\324_\365_\307\206%I\371\332\337\035:,\025\372w\373\255\242\301\222\246\376\326\367\n\035\313\025\365\253~V1\031\204k\310\3675i\2610\261\033[\277Y\255S\364\271"
+	.string	"\370\3339\302\226\376_;\305\304\b\204\251B\247\021\276\035\024\207@=ks\006\300\226\245\326}1\331\224!l\030>\306r2m\216\021\340S<w\333+\371:\304\2660\204\207\021\361\325\237\206rE\261\217`\227.i\257\245\267\037\212\375\217u\226\341-\034`+\204\004\013c\257/re\234\235C\245`\274\313\245\330\2173\206r{\b!\341'[9\370\241\n\251&\200G\302YL\207\210\322\327\370d"
+	.ascii	"T/\332@^\204\272\225rRg\255+\254\f\322\227\253\n\234\034\305"
+	.ascii	"M\037&\325\201U\262\027\217E\316\022\021\207\3225\335\271\202"
+	.ascii	"Z\302SVIk,Y\022-\253\025\207\254\217Gg\004C\3315\241P!7e\217"
+	.ascii	"BGi\344\023q\3641S\307\254\021\353L\031U\f\f\"^\366k\310\023"
+	.ascii	"\263\362\301P\007liE\354\210\223nJ\302\032\006\261\033\342\340"
+	.ascii	"\306\004B;\262;\260\356\316\367\003\344y\326\024A\226\246\243"
+	.ascii	"\353\2118-yT%<\266\023\270\f\327\211w&\230\3108\025-\304\201"
+	.ascii	"\325\307\360Z+RK\032\302M?|^\310\f\243\244@\244\214\223\370\320"
+	.ascii	"\344\215n\n5@L\016\031\242)\031\314G\314\022,\f\006\312:B\224"
+	.ascii	"q\342\210\022\313\224Sz\2421C\316\204\023\242\214\021G\204\030"
+	.ascii	"&\234\020a\2148\"\3040\341\204\bc\304\021!\206\t'D\030#(\256"
+	.ascii	"\303\"B%\356\377E\016h\351\002"
+	.text
+	.section	.gnu.lto_blackboxLogEvent.172.162a51487001df88,"e",@progbits
+	.string	"(\265/\375`\346"
+	.string	"]\f"
+	.string	"&\027TA q\223\016\200\302\265\214\355"
+	.string	"\375\002\3308\005h\005BRr\343V`ru0\221\023\252\231B\255\177C\026^hY\235LIL-\017\b\b\344\3642\330\2116\243\207\273\226)\310l\304\223\275\245L)@"
+	.string	"B"
+	.string	"@"
+	.ascii	"\357\005\252Ckv\216s#"
+	.string	"\233Q\261\321!\265\262\273\227\236\270\366\247\251\371\227\255\364g\211\\\037\002\223\021)\001\233\3511h\201\362\342\3353d;e\002\340\354\256\023\265}\270\341mG\260\r\301>\026$?|\351\324\364\255\0048N@<E\312\256\207\310\262(\260\206\n\333\307\330N\3562\264\227h\310\020\330S\027\362\300:4g=\355\303x\f\355$\033\034`\227\304\f\032\273\234\003o\254\303\005?P\035\006\245\237\254`\031\321k\252\324Nw\343\224=< \306\270\343\232\352\232z\016\"LO\335\344\202\217\302\243\217<\352\243:\274\276\373c\341\"\205G\b\220\2146WJ5a\377\355\356ZK\330/\371\253\007\030\t\223\360H\241\017\206\017\264g\223!\353P\360`\025:Wh\002\006\272<\242\321\265Q\340\314\302Gt\221\262Lta\270=\007DMN\003+\242\262\242c\271m\360l\271\306\030[\336%+\205j\203\262<\312P\003\026"
+	.ascii	"`\251'3\340\324a\233\205\225\"h1k+0\230\250\006@@\213X$L\344"
+	.ascii	"ICa\230\320\3205\240\030F\003\34175\005\356\005SS\304]n\252="
+	.ascii	"\032\230\332\003"
+	.text
+	.section	.gnu.lto_blackboxCheckAndLogArmingBeep.173.162a51487001df88,"e",@progbits
+	.string	"(\265/\375`\375\001\005\022"
+	.string	"V\341vG\340\360&\035\300\013\200\263\026:\260]\263 \r\232\316\021k\256\352\207\223Z:\325\335x\240\314\002\356\334\340g\322\317\235\207\247Xs8\334\330&\016\241\f1\216-\2706\317\356B\240Fss\f\242\216a\203l\"eJ\001a"
+	.string	"["
+	.string	"e"
+	.ascii	"\335#\367\222\356\321\256\261\275\307{\206\3317\0019k\243\340"
+	.ascii	"\211\304\016\022\324\356\252t\304a\357\"\247\t\363\017>\344\223"
+	.ascii	"\331\274\003 \373\360\350\341\0347 \351\007iD\206\303\0318a\003"
+	.ascii	"_\313I\345Rj\330vFd:\034\n\320O\324\301\247\006Y,\363\303\301"
+	.ascii	"\356:?Y\317\375q\333-\266\031"
+	.string	"\330\t!\037i\313X\310\177\327\267\270\351\260\305\324\306\236\305R\203\354s\253@\266\246E\270\264\247i\325tj\372$\004\226^px\321\323\356\206pjmqF\211\317~\373>\212\327j~\344\004\240\022\321\356z7\362iOq\025\260\317h\276=\373o\350\251\210i\227\007\301\243W@\036S~\022\234\006]\245\023QVM\211$\fC\036W\351<\025\321\353\200\210eh\037\306c\264\\,,\335\243\247\257\2353Q\264\024\345\343\226\323\\N\204vw\301\310\016h\343kRu\301!}M\252\247\335D\306\315\351R!B\026\252AN\275\262j9pR\312~\322W\270\370C~yE\377\325=\246\026\300\341s\223\241\003\253\231\325\203\031\030\327\005W\210[+\030^,\227\326\212\002K\005\323\262zQ\265bdT+(~Up\305\250f^\257\030\2257\2739\370g\270\365\260\335h\254\243\341vE4\370\354\247="
+	.ascii	"\323Q\2064@\204\226\347\226&\333a\007\024\323\316\366\300\343"
+	.ascii	"\263G,\311\037\235\026\2413\002\225\210>_B\347\327&\254\362\237"
+	.ascii	"\243o8M\r\005( @\002c\030J\036\240\352I\002:\314\271a\245\001"
+	.ascii	"\351\332[\2427\356\272\3718a/\300\005JG\354\355\255\322\t\266"
+	.ascii	"\255J\302E(\303\230\b\206\317\266\017\344zK\020\317\232\226x"
+	.ascii	"\340\210\3259S\026\007\306x\177 v\242A\030[\313\240\\\361\371"
+	.ascii	"\260\002\360\301\2651\220#\221\310\302\357\263-;\031\340="
+	.text
+	.section	.gnu.lto_blackboxCheckAndLogFlightMode.174.162a51487001df88,"e",@progbits
+	.string	"(\265/\375`y\002\235\024"
+	.string	"\306\244\202I\300\322Q:r\020`\305\322T\fT\350\334V\237\2148\205\332\251^8A\r\200\200\001\311\300u\246\211\316j\260\267\3651:GU\243\002\236\352\017\320H$\302 (\2157b\352\346|\317\202\362\310\023\275\225\260\264\2617\331;\245j"
+	.string	"d"
+	.string	"t"
+	.ascii	"*\236\216\232vuRN\255\222:\365\356&\3654\365\001\365\324\256"
+	.string	"\261\305\323\213\226\331K\004nv\266\340\311\310\003\021\324\356\216\363\347\262W\032N)\363EXFl\267\331\253\3526\342T\304\303\360\244\350\004\021\311\315&L \364\313\335w#'\311\r'D\260\273\317]\346\334jR\212\260\354\256\245\355\266s\213\334\266\213\355\006\266<\n\227\321r\275^\365\364\272\303\200\245vi\267\371E\177\341\342\007\235\372\005F}X\215i\220\267}\336\210\211\304\017g\316\354]MN\234\375p\247\217\035J\213UZE\245k(-\247\364I\n8\001C\\\227\264\013\"\030d\177\024)\305w\277}\277\305}5\357y%\007\024\257\363y\037\272\013\331w4\337\235\375N\223\345\313\021\f\006\235\216RUS\234\3071QS\372\r\n\025ZdK=UM\026LJI3\347\275\274\222\003\n\325i\303\365*\001\320\243\007\3515fz/\260\021h\227f\241\236\326Y\177t\301\234\022r\332\027\316k\231"
+	.string	"\355.\203\333~\320h\371Ar\236\3670*\307C\250\207&\203rwgs\342\234\362O\226\317\207\215\214r"
+	.string	"\031\3368\352u\237\361\212\021+\231\325\003\031\030\027\007\327\210[*\035b\254\227\326\n\003k\204qY\301\306V\314\206Q\345\200c\031\\1\243L,\0263\212;\332\303\235>v\356\377\300\264\342G\233\265J\023\356\242p\300\273\200\246\236\f\352H\001\255\316\222,Y\036 PM\273[\005\247\227B\350\304\331>\221\357\235\007\241\016\345\200P6\003\217P}\237\204\t\3626\3239\363\216\236!<\341\304\035\245\212\0018 @\002c\320%w\240\352\t\206&\020Df\300\367\366J\320%Ck1\327\255\263N\030\013t\201ND,#\335\320\322\032\220c\213\313\304\030n\253d%+\303H7e\204\302"
+	.string	"\032\326\017B\016\"\362\020\2269\034\2108\300'\313\020\370\342'\305b\307\001\"\2026\001)"
+	.ascii	"\036\207\332a\222?pG\351d\323e\260\3013\321\"\212\275\021\213"
+	.ascii	"&X7^\037v\002>\2706&\352\210\b\013\264gKm\276\271\255Uz"
+	.text
+	.section	.gnu.lto_blackboxAdvanceIterationTimers.179.162a51487001df88,"e",@progbits
+	.string	"(\265/\375`\353\002\335\022"
+	.string	"\006`qG\340\320(\035\332\271<\254\037\341;b\263>\022\212\341\024\326\2171\034\317\004n'%~\353\023\3473h\264\337\357\306\035E#\254\352\210\271\236>\0365\336\301\004QYk\200c\222P\367+\300\267o\177\315H\333\233H\231R]"
+	.string	"O"
+	.string	"c"
+	.string	"z\365;<bfp8\316\315\234\032\212l\314\237\270\"\306\3669<\263i"
+	.ascii	"P\2314\002D Xl\206\346\234\337\206\370\354#\031\273\325\231?"
+	.ascii	"\n!\335p\264\217\274\226\313\022\256\345qEE\273\016_\024.\245"
+	.ascii	"\0230\347\274\210k\006\234Mu\0242\347\264\336p"
+	.string	"\033n\357\266Ml\017\260\027A (\037w\017\264\360\220\323%\361[\320O\"\277\272_\371`\373\210\317\220\3700.9\321\337\036\375\023\371\370-\205:D\271\232\026\33146\335\027\373\335\\\027{\325\252U\247\256Fu\352\323\325\246U\227VMZ\265\267j\271\352\250\352N\325{u@9\323>\207\345F\311\305\352\304I[\332Y\221\026$\344\221\351\366\305/\311\002C\2703$\244sN\332\356\213\267r[5>)Z\303\366\203\253\200\340\315\231b\300G\361\024\021|\230G\263\\.\371\350m\001\240\031\2719\267y\311\270\322\304q^\022`0\371\030\027$\334\221\351\366&&w\273\232\227\210\215\004v}\240\200\255\230\2135\241\365Q\200\261F>\227\254\344\373\b`\260\302K\366\231\200\240\354\343\240\251\275\233\353bRP\321Omm\335\250C\355\004\n\3647\357\322T\312Xp!\354\031\022Rm\214\247V\345\363b"
+	.ascii	"K-J\330#\223\323y\317\312B\310\023Qk:-j\317r\243\366\3420\032"
+	.ascii	"\3700v \"\"\037O\353\021L\250AH\352\220CCCA\312Wc\340\002\031"
+	.ascii	"\251\242\007\020`G4I\013\007\240\230\003\341\344\260\212\313"
+	.ascii	"\260\001@7^\024Yd\001\005\370a\027\3775\025\001\\\177t\177\244"
+	.ascii	"\343X\207\360\272\317\344\321\212\264D*\325\225F\376\274\245"
+	.ascii	"/\366}6\025BXH\367D\213\022\326\353A\225D\013\t>*\177\223|.\201"
+	.ascii	"Kj\224I\364\034\201\306\212N\325[6&\345f\320F:+S\250\037\026"
+	.ascii	"\317w\026I\230n\027U\343\022\353\237\034E\212\261\266\227\273"
+	.ascii	"\275-\241\006"
+	.text
+	.section	.gnu.lto_blackboxLogIteration.180.162a51487001df88,"e",@progbits
+	.string	"(\265/\375`\271\005\205\037"
+	.string	"\026\265\275G\200\234Q:\035\2226D\001\220t\320P\003\232N'\374\355\224\375\263\001\217\n\370\004\241\204\236\365\307\244m\177<\226\331\242\235%\036\364c\304\2633V\266\351A\314p\363\240F\374 \353HMu\004\370\325~B\210\224I\006\250"
+	.string	"\230"
+	.string	"\257"
+	.string	"{\373\371\333\356\236wo\374\223\364\307\030k\253\325J\214\226Z\221J\273T\373\211\364\001\350O\363\002\320\237\233\356\276\301\311\250>\006g`SQ\314j\255\271\036\362\364@?>\267\036[\215\206\236fs\272\267\005\207\276\003YQ\021\377\343\343\343f\0168\003\244\315\307\204<L\005\30418zL$1\311\251\217\tw\230GA~\234=\211\260\007\333h\021\222\254\250|\274v\232\216)Fg\234@C\031^OJ\"\254b\3636\224\342\036\023\022M\244Z\353\273\3164\206@fZ\204Z\353rpH\365\005\360\335\367\354.\204\335\223D\347\236\260\007{\025\027\373\254\375"
+	.string	"\342\334\203@\177r\037\025\253~\274<\327Z}\275.\320\267\323\327\032)\266\263"
+	.ascii	"\370\365;t\367i\004?\370>\025\245VR\n\212X\342\312\0356\336\345"
+	.ascii	"\251\340\0077\201RG\022\330\276]$\220\373j\367f\355 \273(\257"
+	.ascii	"\021\312[\204\362\022\235\274\270\223w\350\344\025\372\361\017"
+	.ascii	"p\362\006\235\274\265\223\227v\362\242'\357i\362\232&o7/7\357"
+	.ascii	"\t\0308f\335\270\0253\265\332X\342\251\3113\354\310\036\312\275"
+	.ascii	"^\034\271\017\214n\314~\356\276\330\022\234L\350\372kd\341\201"
+	.ascii	"<\213\003l\037Y\255\265f\324D\315r(\034M\205\332\230Q\277K\361"
+	.ascii	"\030Tk\245\035\001Z\324\"\276\312\226G\200\022uQ\177\252\n\310"
+	.ascii	"\313\335\223y\231\n\026.\360\203\027\320\237D}\242Q\312Y\025"
+	.ascii	"\332W\213\353\241\346<bt\027\303\n\323\364+d`p}\261\242\322\277"
+	.ascii	"\210\r5Sq\221\265\326S\250\203\332\351\253\213N\211\354^\213"
+	.ascii	"\341\\\232\016`\325Z\033lyX\006\r\0336\240?\205Z\251l\301\263"
+	.ascii	"\350j\265V\007\373+\307\322\264\317\372\271\035<x@\177\006\365"
+	.ascii	"\275~\340F\232&\304'a?^\336\354\253)\001+tO'\2408D\241x\352\365"
+	.ascii	"X\354~v\267\324\202\347Tb\027\302\204S\016\005T\210\023\271]"
+	.ascii	"oEn\351hy)\236z\271(\036\257\227\273!\177W*\223\277\006\002\245"
+	.ascii	"W*\250(\301\374\224)\275$\245\332'\004\306\345\363\2515\r\317"
+	.ascii	"\035;\265!7\253C\207\3260\214s\266\314\034f4nh\237}!stLX\273"
+	.ascii	"i\361\312&\006r\320f*\206\021y\034\335\021\326\246E\016'=R\340"
+	.ascii	"\315\3310\214p\316\216>VK\200=fw\337\b\222\267I\265\330\230\235"
+	.ascii	"+;\376x\251\344e\251\226\232\223\245L\322\255\224+\345B\177v"
+	.ascii	"G\031\341l\341j\255\266$\016\320\273iW}\250\2218\302\020u\244"
+	.ascii	"$\220Q\220$\225\026\003\300\002\221!2n\021@)\244\250H\222\313"
+	.ascii	"\030 A\311\314#\223\304*\020u$M#C?#\b\266\024\351L-\021W\254"
+	.ascii	"\037\312\3639G\343\275\"(WJ\337tt\032H+\026\366\305H\313\373"
+	.ascii	"es'\003Z)\264\001\006\273\324\235\\#sx\226\257%\356i\342\211"
+	.ascii	"G \250E\tu\216\260\020\006j\361\023%6\244\256A0\026\203Q\247"
+	.ascii	"Q\232h+\375<\246\\W&k\246\262\372\324\210\267\232\213#\341\373"
+	.ascii	"\277o0(\216`r3\202\016\3165\237)(\004\357\013X1\243\277\223I"
+	.ascii	"\344\027V\325iC-\2265\002\250\251\200O\200\242\0166-\315Ha\234"
+	.ascii	"\347\224\227\210\233\357\327\036\332\262\r\037\322\251\2218K"
+	.ascii	"\201\366'\251\266,M\3435\244\b\346\351\237\220}}w\t\213\373E"
+	.ascii	"\026\232D*\026\020!\3673\261:\202\364\017"
+	.text
+	.section	.gnu.lto_blackboxSnapshot.181.162a51487001df88,"e",@progbits
+	.string	"(\265/\375`q\003\365\030"
+	.string	"\206j\233M\240\022V:\222~\034\324It\207a\002{\363\324~\265\377p\245\266\373\305C\351og\207\237\024z\321\374\013\210\361\007\264\336[:\235|3{\203ko\245\317\301\317\247\t\234\257_\300\313\232\300JqEb<+\372\267A\b!d\357$\003\204"
+	.string	"{"
+	.string	"\214"
+	.ascii	"\304\334\227D\264H\316AQ\310\234\215\017\032\205}Zr\022\365)"
+	.ascii	"z\002\352\323\316u3o,\312\005\234\317\034\247\256\234s\f\023"
+	.ascii	"=wvUS\024\337\\\237\001QG\023\326\224Ow\366\273\337\3275\205"
+	.ascii	"\002\221\225r\350\f\342\371]=\361\024m\320\234\301E\242\223\242"
+	.ascii	"\205\371n.:\342\303AKr\316/\376\216\360\365.\316y\371x*I"
+	.string	"0i\364\240\235\037\276kJ\316\271o\353\343y\213\274\273}\272;B7\336\t\310\341\311\247\272\233\211\231E\300\237\234u\007\3366\237\224\364\356\220\356C=\n\246\217\242cl\367\255M}z,\323\022\002\022\177\273\373\3546\362.\036\352>~>\237\316\306B\335\353\355\227z\233\375\322\277\246\267/z\373\003\376\303G\207D\211WA\345\254\363\f\222\225)\r\025}\027w\252\271\261\277D|\022\326t\277\305\231lnl\b\304'\330\323n\233n\330\323\013\353\356\337\356\017\037\033z\202$\375\274\360\215\025\025\226\267=n\343W+\034XX\324\247/\374\025=[IVL\266(\357d\2403\375\365\244\324t\"0A\024\246-*\213\257\200K\235\217eV?y\252\226\016\263\231\372\224\305w\272\311\022\307Q'\203I#\024\0175N\275\370\326\304\243w\201\364\310=\360\232\332\355\341\345\276\275\370Y\\=\312\036\326\365_\\"
+	.string	"\022PWSw\205<\230\fR\341c\037\t\263\3321\024f \030\375\030\315d_\207\271Y\253\0023*\265\230\027\r42\265\333\rG\013\3204\224\0206\027\030\332\354\203KL\346e\026\023\243\335fb(\n\332\006\242v\213\321\330l\267\030\314\270;\232\213g\217IHgs\207y}\251w\n\312.\270\271\242\204\373\266Q\031?\341RR\256\tn\367\204\n"
+	.string	"\216,\216\234M\036\326\251x\3508\025\013gA&\302\323R\032\270\016\336R\357\244\272\342\356\013\030\356\333\0369\"5\235M\234\032\357\347\370\022\227A&+\336d\251%\004\016\267~\2742O\250q \312\020S\n\225\214\224&\005\2056p\002\221\261d\007\020x63I\322\034`L\362\2459\177YV\233\337TMb\342\235`\276\367_\364\3506\f\341\002\245A\221\006\220t\250\376\235\330\2643\257\272\203m"
+	.string	"\214=\302\252@\342\342e\\\262\033\325\242`\3700\343\272\214|\250\327h+\336\243\240\353\221\277\205\374\\\343F\232\320\002\200C\370u1Q>\234.\204\233\375Q\222\361\370H\347\016\201\006\"\006"
+	.ascii	"\3747\324!\330\277\217\232\322\251\346:\210 ,\352\1770\347\272"
+	.ascii	"CL\363\013\001\005\f\203\257\301\251\\\312\277\020\\b\312a0\374"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_blackboxUpdate.182.162a51487001df88,"e",@progbits
+	.string	"(\265/\375`\177\037\335n"
+	.string	"*\244\270$O0\320\332\031\003i\337W\026\261 \220\373\216\"\262~\237\235\271\013\345\034s\217\323\022n\343\347\013\024%\266\f\306\333/\025\330\261\313\200\273"
+	.string	"A\b\364\262O4e\004\201 \246\n\213A\016\307m\362\321\326A\264\345\355\303\240!LJ)eJ)\005;\002\013\002=\002\316:\2543\007\3269\207u\306\t:\337\004\235\203Ag\033\325\231\265q^Yg\225uNYgtu~\325\331S\347f\301\215t\371\210a\252\343\346\336\327\307s\315\273L\265,\351e3w\222\373\313\222\331\372\375\3616\017;\247\217\275\367}Wt\312/X\271\003\216N8\r\306\260|\275\301\271\245Si\360\332\352\210k[\324\354ei-*\250qS\2019-\201&QI\301\330\232/\264\003\220e}g\024 \327\276\252\004:\271\262z\337\267\254\247\260\320I\376\265\262/\026\230;JKi\241\223\234\256MY^\211\275\357{\323)s\013\3147\235\352\3340s;s\213\365\321\355\261\027\330\346}\213cj\357\233l\301Hl\247A\315\243v\212\366\216\332)\273\314z\235\334z{"
+	.string	"\337\236\246\364\275\357\353\342\265\222\215&\233\203\356\266"
+	.string	"\001"
+	.string	"\200\324\202\305\212##\025E)\210P\f\235\020\n2\001\364\343S\202\304\210\036\021!x@\354|\360\320A\207C\016\316M\320&\211]\325\024}w\271\335\f\217\214\316\212\324R\013\020"
+	.string	"\222\351"
+	.ascii	" I\221\363\026(\317\027#xGWpTq\316b\005\232\244\243\317\n\347"
+	.ascii	"\357)Lw\r\275\370\021\334\233\033\331uQy\220\260%\351\342\360"
+	.ascii	"\356U\334u\321]\232\247p\303\342DU\0325\202e&\346\207B9\204v"
+	.ascii	"\305Ot\r\255\270\220\013\245I\320\n\243\001\255\277>1?\023g@"
+	.ascii	"c\376st\037\264\022aNB9\"\255\007\354\313E,\361\020k<48\210\266"
+	.ascii	"\235$\376\301\315\303[\007\256-\327\351\0023\304r\016+\f\270"
+	.ascii	"n\251\034$\021\307A_J\025./\216_\\"
+	.string	"\3355\254\362\033\264\245\342\321`\206V\250\002Kd\232\375e\210\007W\0303\374\020\3226\315$\244\223\202\272\206d\234\025\352\032\022}m\271\036\3022\023\003Swx*T\374\241l\024=\332\313\242\246\301\f\225(\217\217\032\204\215l\207\222r\362?3C\212A\251A\t\222\253'\035A\251&\025U3\325\245\213Ce\216\2570\336\367e\027J\375h\036\240\231\321\n\230\031\001\346\022t\001\\\352\372]$c\0369'\233\331Tf\227\006w\211\267p}?\373#\262tb\337\310\352\243\237\203L\216\303\264\222\232\276\372i\232\035WMH\224\210\354\270\334'(\354\266\322'b\2161\372\315\374\033\34269k:\363\272\221\035LC\252\371\255o\344\346\246\363#\026T\255\001\263\222\340\275\274\250\024\302\006/\342>\3514\353\235B3C\316-\347\206\271Go\241\004\217\232\215\001\302\255\244\266\034\273H\267R\342\331z\337\227"
+	.ascii	"v!>d\001n%\2352\003\0168\240v\332V\205\351[\321\354A\234\030"
+	.ascii	"\003\202\b\"P;u\241*\314\027\032&\177\002\321c\267\336\341\233"
+	.ascii	"\365\032u\332r\035\244\362d\317oo\311\235\252\t\352\177\216\036"
+	.ascii	"g\236\240\002o\341\1773\233g\372\256\215\232|\313tFS\r\2043g"
+	.ascii	"\260\201\267\220\233\331D.\233~\t\347\251DC\177T\021\337\310"
+	.ascii	"f\315\220\3359\371\037w\377\250\376\"\236\375\211\330\344=<\212"
+	.ascii	"\003\017h\320P;\365G\341X\006\254\307\264N\230Z\337\336\222;"
+	.ascii	"\213\232\020)\3737\262\363`\027\342\204\355`\177\272\371jbw\n"
+	.ascii	"*a\342/\373\222\315\263\207\223;\220-\263\024\373\372\343\006"
+	.ascii	"\\\235vM\356>\025\257O\354\013\rw\232\024\311\307m\006ur\351"
+	.ascii	"q\227y'\031n<\357\254\027\260\217\311\233e\307\315d=\266\333"
+	.ascii	"\206\2165\316N\354\253\353\230Y\357\237xK}\345\302\327\b}\257"
+	.ascii	"<\220\271\351:\214\rn%|\343\003o\341\007j\247\375\025\350\355"
+	.ascii	"]\035\211L\376dN6\371\033\231\373\237\317g\026\376#\314\253\363"
+	.ascii	"\005Ag\013X\347\031\254\263\f\326Y\202\030=\326"
+	.string	"\235\324\313f\243\324YE\352\\\224:\247X\235\211Tg\024\253\363\320\352|bu\026b\235\203Xg\023\2543\320\352\374\023t\366Y\235K\254\316$V\347\021\253s\217\352,bu\016\261:\363\254\316 V\347\235\325\371\303\215\263\007\326\271\303MO\304\246'\3732\245VL;\306\307\250\235\312\370\326\322FQ\224ND\204\370\250N\223m\036\362\330\346\205\275X\313$\323\346\345m\t\361@XP\326l\361\213{C\374\335\260\346d\315\253k\215\311\2225\036\236W\222\244\305#i\371T+\256\327\312k\313\374\fol\371\2328\226wD]\213\264\315\254\253\266i\365D\3323i\332f\263\n\317\003a\335\320DM\027\020\315\017R\365@lx\252\237jc\027\371R?l\333q\303\002f\007\304G5\267\373\244\372C\265\316\027*\260\3650\264N\366w\374S\353\327\002\266\316\326\251v\272\242\331\f\304\003au\301\275B"
+	.ascii	"\245\316p\331\373\360\367KnO\267@\247\033\340\237[\367\326\230"
+	.ascii	"\252\245\0074\315\2674oh\316\274\361\355\275u\330\371.\302\360"
+	.ascii	"~[i\311m\362\026\356\314\351\274\321\247\372\003\002\336I's\347"
+	.ascii	"B\365\225\026\316t\243T+\273:\367\351\305X\333\027\273<\\\214"
+	.ascii	"\013Ud\367\276N\0040\013\017\343F5q\254\255\257S:\365\250\223"
+	.ascii	"\276t\247t\266\344|\256\313\266\336wGs^\322\341\334)\366}w\264"
+	.ascii	"\220\375\315\275\270>\244\334\251)\2653 n\020o"
+	.string	"\341\207\007\302Jb\365\n\371c\333c\033r\340[C\252r-\314\006\227E\255\207Uy_h\234H7\034\026%\236-%^\037\032\\\007\251\200%\375\036\353\214W\016Y{\370\356\"cv\340gf\036\236\210\312\224\016)\2241\245_\035\316\033\207\250:5\\\212;\204}_'\003\330\223\036\305%\202\272Xn\021\325-\242v\252\363/\230Z\230\306\216\034\276\2470\307\230\374\371^\236=\274n\336\310\005@\261\211\361+\222\244\025m\364PLC\033\275\203\351\270'\305(\301\234\017Sj\274-(\335J*\316\347<\220\230'J\354\r8\337x\\c,\332\350c<\tc\354\2367\357\244\205f\334\216\241\006\377\346\273I\360\273k\354\212\037\021\311m\236\3315\272ZAN\277\304\354\333\274\347=\005\352<\373\375\2455\320bVy\nd\362'\312m\3150/6o\344n\025Y'&\351\217\270\001 \364\t3n\214"
+	.string	"\202\f\024H\270\221#G\n6r\330\006\322\n8j\204`\203\206\b5\\\220"
+	.string	"\002\215\021\\\330\310q\202\013$\023\214\243\204\0339\\\240\200\003G\016\0277I\246F\337?\302B#^K\246obtH3\fT"
+	.string	"+\305\247\207\342\234\227"
+	.ascii	"T|\027kP\361.\230\315\201\021Q\254\016\242\346\267\007\200\022"
+	.ascii	"*\256\272\226\322j\005\2611\036\257\220.\370\032\\\027|K\351"
+	.ascii	"\241\037X\266|\250\216_-\212\356\264\212\270\260\360\362\273"
+	.ascii	"b\0276\313\222\274\025)\216\244\370\2462c\363#\036\261!i;\"\372"
+	.ascii	".\332@\364n\245\310\206\022i/\252-\231\r\t[\022\243,F\213\374"
+	.ascii	"\250\235\036\321+v\037KR[LP\253\007\352\210IYN\036\310\314\355"
+	.ascii	"\023T\210\013\3052JD\253Z0\016k\217G\265S\024oCU\266"
+	.ascii	"\346\352\250\342\2152\264\023\263+}h\236\317\347\263h\210\312"
+	.ascii	"\004d\253\034\"\242*[^\035\211v\350\017t8\245\203T\216j\375|"
+	.ascii	">\235)N|\215('\272\207\026\251\327oOL3\214%w\002\022\275\221"
+	.ascii	"\321\250*M\324$myu$c>\253l\346\336\210(\204\236\003\024\241_"
+	.ascii	"\275|\350\215\034\364@\377zm\326J\252\211\017z\237)(\fJ\335\206"
+	.ascii	">\271O\232\315\016\335a\342\273\r\350\373\231\325\364K}\342\207"
+	.ascii	"\003\367\251"
+	.string	"\322\236y\013\177\276\304\373|?\0052\241K(\223\th\255R\251vZ\342\017@\212\361#\302\320F\201M!\f<\351\231\333,\355\2263K'\035m\024\310\267\fj\331\002\343\234)\215\2117\362;-x@.\036\344\375bt\211\340\273\253\n\r\030\261y\266\347\267\007D\342\273\350\205\304\373Y r\331\3643\242\215\033\361\315\f\364Z6\005\016y\362\371\230A\333+\203\326A*a%z\360\310\270PM\345\316\215R\231c\236}_\347B\245\020\343F5\025\262\354+L\321\227\226n\251\300\326\313\265t\017\367q\355\\\373\245\245k\351\312\244\365<\020\026r\r\340\232\271$\2117\362\267)\327~\213\336gQ\202-G8\323\322\224iW\320\322\316\336,\315\006O\253I\317\033g\374\026VX\2213t\256B\225\3613\276\003\202\225\250\002Y-\215R\246\224\214\210\210$I\222\306\362\013\020\206BIH\261\273\003\022"
+	.string	"\0049\310cT9T3\"\232\202\244\220\2559 \220&\007lp\314\265\353{\334\322\325\207\240J\224\341\270\260,\235\206\271V\\/K\037\222t\300\3408i\242\b\257\242\235\305S6\016\330\351n8R\2007\240\265/\351\377\022\334)O\276\204\310\0178\236\037_\006\032\334\300\267\322\230oF\337\2159\325(\346\031\f"
+	.string	"CA>\277\b\304\353L\003Rh\026Qg\007\263w:Oh\317\264\324\372\354\337\352\355\365\266\340k\3452\260,\026z\"\020)2\302\205\340\32110@\373\321t\234rs\344\237FU\302\353\304bK\020\320V\005\200\022\336}\250i5G\024\237L\321"
+	.string	"\204\213T\035\006s\304\231\202V\315x\223.p\362\235\251*w\356\030\253\371Epm"
+	.string	"\265D\270B? \366\362\215\363\003:\016\320*j"
+	.ascii	"\266\001[\235\365:\\\200\216\232\214\025y\021\0250\231\374;\274"
+	.ascii	"\215g\260\3638v|-\244y;-h\255^_.\207 %\2648\b\242EK\273\3619"
+	.ascii	"\354\022\017\244\273;2\240\200;]\376\023\260\326f\0054\001\031"
+	.ascii	"\225X\007aPo,LuM\331\323\350QF\364]o\0046 %\205\225\365\032N"
+	.ascii	"\347\021\260:\272`/\030\263\327\305\354i\313\270]\300\204\350"
+	.ascii	"\033\216\240\304.FQ{W\221.\374\357\\\314 \223\357\0020|b=o\f"
+	.ascii	"\0302}\361/?\337d\301>\334\t\321Q!\005I\223_\215\351\311\371"
+	.ascii	"\017W\355\023\262n\356\2270\004\312\272\2029\257/\016i\3317\025"
+	.ascii	"d4\314\320b\227\241\223\322i\274\347\302\232\033\024A\372\313"
+	.ascii	"1#\362\353\202\362v\206\002\272\215r\207\377MN\022-\037\b\344"
+	.ascii	"\023^\376bO\232\006\246\221@\366\272U\005\311\267\372{\255\304"
+	.ascii	"\213g3-^S\301~\371g\251\315\260\273\027\017Q\362\0276\324\243"
+	.ascii	"\207u\337\226\3120\277\242\223\207\2754\315\023u\201\362\301"
+	.ascii	"\300\020IL\364I\027\363\323V\320^\001\377b\210c\256Bfw\233R\310"
+	.ascii	"\002\345\320;\271=\234\270\037\303\344T\370\342aZ}\337\353\333"
+	.ascii	"9\230\321\200\334\225\247T\020$\207M\247\232^\0244\316\274\362"
+	.ascii	"\224\003\205\220\201\353\340\250\210\265r\237XRD\354\370\243"
+	.ascii	"\215\251:\031\273\256<\230\0220\304g\2149\007\262x\027\300\372"
+	.ascii	"\001\312\016,)\352\032\025\305,\277\205&c\210\330\207@el\242"
+	.ascii	":\213r\303\354B\351|\301\366\033\300\260\246'\332\335\266g\361"
+	.ascii	"\006\344\215\037\374=0\307E\f\217\302lIr\024|\201\3320\236\217"
+	.ascii	"\205\276\200Z\036\3034\220\250\2507?i }P9\bf|H\375\023\367\263"
+	.ascii	"\236EQ\025i\236jS\017$\344\203v=\b\202r\376\036\026\212\227v"
+	.ascii	"{\244\2014b\277\310m\301\006\002W\323\262K\007\r\247\214\245"
+	.ascii	"C\250y\347\266h\006\363XQ\321G\227pwI\351'!\b\024O\235L\322\n"
+	.ascii	"\371\232U\312\025U\372\22138cb\254\t\225\362'\371\236_\244\025"
+	.ascii	"\250\264\224$\364\227\022lq\034<6\306\324\\g\377\342,\205Q \336"
+	.ascii	"\227L\314E\030)\277\232L\n\037\006\237\232\017\216\251\002\237"
+	.ascii	"\243\226X\022p\232;\355\204A'\362\331bL4\247mk\177\252<\323\333"
+	.ascii	"\243\347\374\264W|\336Tv\233MaD4\0250\225\006\25050\354s\201"
+	.ascii	"\372\021\207\234;\314\022XE\377\3345\322;\177{\266\362\275o\036"
+	.ascii	"\315\226!\210\301\177\264\212\3467s\210Q\215\334q\177\333h\021"
+	.ascii	"G\016o\310\023LN\346\217]\322\373\311\240\024\350\360\355I\006"
+	.ascii	"\264PQ\320\355\340\252\320\3004a\3337U\304\230\306p\334\267q"
+	.ascii	"i\252\t\341\361H\222\322\225\341PCB\225\212;=(\351\200\261\213"
+	.ascii	"\265\340\343\317Zs\230\315]\321\021\351\312>\037B\312\307D\334"
+	.ascii	"p;\210\377\341\331@\353\274\007\242e\315]\0238\245\021`\004\206"
+	.ascii	"\223\277\007\242\362]?R\013=\030\230\252\270N\212K\002\261P="
+	.ascii	"L\001\351\306\326\251\3623b\200\227\317e\\\276\357\t\214B\214"
+	.ascii	"\353\331t\212\f{td&\217I*\371T\3142\fq\241\030\255OS*,*NZ\315"
+	.ascii	"\244\365'\207&pA\030Y>\tB\355\246\201\346\255)[\262I\035\ri\n"
+	.ascii	"j\322\261l0a\327d!\361\201\t~\234R$\245\037\216\031j&kB\3304"
+	.ascii	"\264E#\244\023\201\210\220\t\204F\314\206y\332\207"
+	.text
+	.section	.gnu.lto_blackboxCalculatePDenom.183.162a51487001df88,"e",@progbits
+	.string	"(\265/\375`\206"
+	.string	"\345\t"
+	.string	"\246RC=@\305(\035\365\245\273\235\365\256\233WFu-\253\363lpR\\\224\270\311\006\270\320U\245[\263\215\223Zm\021\2245d\325\013\273)q\013?\200\023\233\304\300S&\217f\t\331D\312\224\0021"
+	.string	"1"
+	.string	"."
+	.string	"\206e\241\007\230\001\005\250^\007v\227\333<\243=f/\320\036\265\343\337\363\363\177r\007\013\226\201\025hzn\013\273\353\\\201\030\267\336\366\201m\005\373\231\361i}:3}\213\301\310J\306Y\005v/b\b\226@\f\020b\373\2631v8 \341y\227a\276\354n\250"
+	.string	"\330]\004s,\217\266\375\222\233|\016QSU\237\022Ae\314\327\324\253\022\034\345)$\037\304\024\245\374\252\244=^5\037\032\247\214\331\241)\225\303~\266\332\262\237\336\036\376\332]\177\241N\004b\270\204H\r\240Q\307\333\374\341Tt\036\210O'\302\303\211\036:!\356\343Mp\034\215;\t\220\307\215\272\316\3430\341>[mm\2729)\312\232\252n\032_)\222\021"
+	.ascii	"+!\201\245\236L\350\f\n\\\374b\201\031\314\320S\004\306.\327"
+	.ascii	"p\020Z\300&\204\003\346@f`DP\001\007\240\362\230\332I\006"
+	.text
+	.section	.gnu.lto_blackboxGetRateNum.184.162a51487001df88,"e",@progbits
+	.string	"(\265/\375`!\001\325\f"
+	.string	"v\231WA\020q\224\016K\343\210\242K\210\271\207\315\203\375\361\345>!\t\254\301\205D\300\254\217\032\234\025\332\366:6\243\2517\2151nP\257\f"
+	.string	""
+	.string	""
+	.string	"O\306\023\017\246s\225TD\333o\244A\030\331;\311\224\002F"
+	.string	"A"
+	.string	"D"
+	.string	"\256?\030%b\017]\240jI\311\314\314\257\025i3?\267#mV\004\tF\n\022@\022\202Q\300\344\2024BFfJ\273\006\203\214\240\332+\356`1QQ2\205\214"
+	.string	"\032df\261d\272\340\336m\r\264=\320:D.E\025c\306I\204\25365\302gh\35523\373\223\326a5\016\233qX\314\303f\016{)\026{\330\313a-\207}\017\353\034\366\016\213\307:"
+	.string	"\001\225\027\030lr\"\323\302\212F\266x(6\264\r(~\345t:\226\237\357\025\277\025\252\226\016(\257\334\024V\346\232\027I\247\021\256\212\301\3131\257Q\037 \350R\346\033$\0175;FDHv\354\372\345&\325p\312 \266\032\245\022>\350\222_\375\261\374\256\033\345\345pP\330<@8\233\007\036\032\204\217M\210\306\361|4\216\001\335\"t<\332\204m\363hYJd\227?\301\276!\372\250\326\261\367\337\272KT\334\237\tw\006,'\315\361\277cQ\302\301\307:p\211\216+\263\202\202\232\204U\233:\026"
+	.ascii	"`\251'\023\332\230\002wR@\016\246cU0\300\335\215\261~\302\320"
+	.ascii	"\024v\300\2602\376\221UN\2604`\001\355\036\205\203\252f\220\224"
+	.ascii	"(\237\313\304\202\n\027\356\234\251\235O"
+	.text
+	.section	.gnu.lto_blackboxGetRateDenom.185.162a51487001df88,"e",@progbits
+	.string	"(\265/\375`N"
+	.string	"\035\b"
+	.string	"b\31755Po\322\001\243\334\234[\"\256FO\227\251ER\231\006\f~\277\270U\277\2214\217\031\026?t.Y\320?3-\234\253\377jE\350g\204\0322#n\222dJ\001\2654\026\027\347\301\332@p`\204\303\246\003-\314\0035\004\275$\0320Hq]\030\304t\321T|\251z&\364\213\276W\002\231\247\336v\256\364\366\236\021]\353Ou\023\367\363\036\265x\304&O\r\322\212Oz\363\253?"
+	.string	"~\376\245#\224\247\266\323\362\036\255\251\370R\333l\365\354{\226\312\354\237\315\314\372R`\312\3400I%F\215\023K4y%!mA-\246\t\n\240f\003\"-\305\200;\031\221\254\304\330\301\1778sf\265E\314\200A:m\234\346\fX\210167n\303\275\333\036\264Eh\213\022\020"
+	.string	"`\251'\023z\376\201\225\026h\204"
+	.ascii	"\267\n\032\360\201\306\216\302\242\2514\021\252=\027\362\250"
+	.ascii	"\303\340\022\214\204k\316$\314'"
+	.text
+	.section	.gnu.lto_blackboxInit.186.162a51487001df88,"e",@progbits
+	.string	"(\265/\375`\022\006e!"
+	.string	"\2467\306H\220\330Q:\223+\267j\023?\254\236r\224\240l[\251\337e\027\034r1\213o\307\211\344\341-\271A/\336llzD\222\315\177(P\226\004E\365\004\023\022\210\255\002 \2024s\314OYrHT\373\337\3667!R&\031\264"
+	.string	"\252"
+	.string	"\261"
+	.string	"M\222H\027\273\306\236*\302\027\217\365\342WK\341h\205\252\326\212\273\271\373b\027w\263q{\356\212\335H\254\004\202fHZ\310Z\353\256\201\374\274N\016\216.\207\273\331j4j\226\315\347\376\b\226\345\305I\220\350:X\1770\307\370\322\251\251\311\025Y\017%\342q\232\206\254K\220\243\355\230\261\321\224\006\227\203o:J\004RILl\243\355\364P\332\361Z\227\244\245\022A\255\365VO \225$d\032\216S\363\b\027\214\301%m\247\326z\013\342x\227\020\206`7p\202F\245"
+	.ascii	".Nenu\246\021\3741\323vj\255\313\300\240\322\027\300wo`w%\354"
+	.ascii	"\232X\001\035:\364\255\276`\n\024\250a\021\353\367@\367Un\305"
+	.ascii	"\303\207\020!\350\315\024\304\255)\"V\020\267\250\"|\357\365"
+	.ascii	"\257\021$||\230\210Z\310\256\037\007Z\302?9W\220\217\270\004"
+	.string	")D\367\307;\021*14Do:X\"<\217\356\265\276\305\333C\355\211\036\037\330\2437\237\365\006i\222o\206Wk\2128\271k\374q?\355\276\223\311dr\333\307.\345\325Q\336\\\311\213\243\361\336J^\033\345\255Q^Z\311K)\257i\362\226%o7/7\357\0250\020\203\272\361\032mj\255\221|S\303\314\257\250\335\375^\311\263\\\374jo\001\335e\377\255\237\226\326f\303\310\322B\233\326G:\033\243-!\210\260l\263\003\314Xj\203tf\353\2473<gU\024$\327Z\211j\375\264?\213\264<\255^\346,\326j5\252\260\037s2g\222\013\0300\320\233e\373\216Q\252\312Zk\245u\207\351,\3001\356\3566\203t\326/\253\347Q\356\002\307%&GH~\234\374\226_\221\213\226_\230\354\330\230\323\227i\241\327@\231b/6\\x\224\265z\036\272\337\3620\236\f==\364&\213\343\026\325\207"
+	.ascii	"\207a\335O\007\316\243o\240,1F\\\266\273\032\016\306\253\325"
+	.ascii	"Z+\354\257\034\313\206=\324\315\345\020\0334\241E\017\210\027"
+	.ascii	"\364c\002h\207b\350\347\304.\310\247b7\341\300\366R\b\371v+z"
+	.ascii	"=\337\016g,zY"
+	.string	"\333\307\336~\250\t+\352\337\352z\357\3054F\b\361a3\340\030\327/\025\232k]\377H\n\3279\226\201\213`\204+lX\024\352l\f\254\237\b\006K\030\021\233\345\364\323\317(\272\\\231\350\214\"r\0269\213\320\233 \226\336T\351(\342\344\231X\215X\223*\217\372\340\346\215\277m\025\245\220\241!b3\234)zk\240\2541G\356\346\234*\273\265\357H\205\f\253\324\331\032y\340X\255m\335Y\314\246u\255\007\210a\352:B\362{\356l\272\220k\254\265\342x(\r\200\216\250q<\007\231\241\"\031\205%I*\351\240\002\021\"\253:\021p5\203\210h[\030\306\240\323\241\026\272\364\320\023\177\340\341\261Ht\207\223D\250\362f+\2267kd'\301N\245\254]\027\353a\316%q\372\232\034*\316\036f\254[\\\213\345\001\034$/\007\244\037*r\257\236\255\035\262\226D\241\313Pop\007d(\342\316i\373"
+	.ascii	"\247\203\031\275\233\277\304F\361F\363N\344\215\215\365.\033"
+	.ascii	"D_\242\272\004\231\303\272\024\305\377\f=B\230\301\212@x\353"
+	.ascii	"`\244\024\260HF7\034\334*Tm\216\207\260\335,\374\323\224\242"
+	.ascii	"O\023\330\260b\325\007:^\234v\371r\361a\220\341\021\250\265q"
+	.ascii	"\314\025\202 \017\310\016\374\n\025\373\225\240\365+\341Wba\204"
+	.ascii	"\212\200\202 \026\003\243cj\372B\362?k\341\026\323\204\235\r"
+	.ascii	"\351\276\207l7\205\305\371\333\b\332\312&\2035\343,H\030\224"
+	.ascii	"\b,\262Lm\227\025\340#U\202\344>\2336\251\305b\364\325\021\377"
+	.ascii	"`W\003"
+	.text
+	.section	.gnu.lto_blackboxAdvanceIterationTimers.part.0.293.162a51487001df88,"e",@progbits
+	.string	"(\265/\375`e\001\305\r"
+	.string	"6\231YB\020\221\223\016\370F\365]\001\340s(PP\037E\025;\002\235@\343?\346\276\023\261\036d\334^p3k\032\013~\344\025#\367\366?\365\001@\227#0\210P\240\263\024[(\034G\337\177d\211\334R\246\024E"
+	.string	"I"
+	.string	"A"
+	.string	"\006\3310\327V\313\301!\033&\004\303\212\020\344\babm\273\373\256\311\362\320]\242\206|\315\310\307\t%\272\303\023\252\303\023"
+	.string	"\252\344\n\354\356[\216\032P$\304"
+	.string	"W\315\310\356\332\303\303}\335\266\002\333\t\354\273\004\230=\231\335\r-\231\025\2413J\254"
+	.ascii	"\031\305mJ[\251hX^l\331\266%\355\200v\025)F\t\321V*\fL\334\310"
+	.ascii	"\266]\355]\255}\300u\365\270\200\353z\373N\271\213\377!\243q"
+	.ascii	"bw7\367[@\366fs}\n;\235\316uui`D*\023Y\246\031L\027\337q\212"
+	.ascii	"\371=\327\023\363\031@\220\260e\277\305Y\036\237\204\261\023"
+	.ascii	"\374\351\352\237\344\202\354\005Ej\204-L\225S\3576WlE\353\205"
+	.ascii	"v\212N\207F\207>H~\300\021\251\200\225t8$\020J^\004\023\022\317"
+	.ascii	"\343|&<\021\002\306$4\370<\n\030\366y\033\333x\267\271\342\217"
+	.ascii	"\230\226\215Q\222\\\252\354\271dX\310^6\034y\334]Q\246\312\232"
+	.ascii	"\231\027X\324(\241\016\273\324\274if\004\3431\034\230\004\" "
+	.ascii	"\200\202):\353c\r\237V\35781\b\004\263\\\"\005\006>`p\370!a\035"
+	.ascii	"0F\223\026\316\356\316\033\213k\230\305\0268\217\316\336%{&\372"
+	.ascii	"a\246p\007\023$@\210\356\005f\324vY\\\205n\006\030\270\257<J"
+	.ascii	"c\312\337z-\035\003"
+	.text
+	.section	.gnu.lto_blackboxQueueFrame.part.0.318.162a51487001df88,"e",@progbits
+	.string	"(\265/\375`W\002\035\023"
+	.string	"\246!yI\320\362&\035\300\326?\017\354\354,\302\257\2379\276Ab\202\005\315\223X\317&$r\216\255\207\236\270\257\250%\252\306\206^\250A\304\216\300\016\311\355d\350@\031\336\270\023#\323\024\342\037\354)j\332\225%\266 \224\354\275wJ\001d"
+	.string	"h"
+	.string	"\\"
+	.string	"\243S+b\350\316\"4\3150\321\240{\035!\211\275'F%3n\215"
+	.string	"\033E9x\240v\307\005\257\026\351^\257\3026\314~\372Hbm\034\263\237B6\254\214\203&\247\0166\250\335\365^\347\210\307>%\215\371Rv#\363y\245\233\324\214h\310n>\\\0268\005P\262\273\356@\334\365\266!\330\266`\313\024\001G-2d\\\034\233\242\033\305~\324Bw6.N\312f4a\354\016\302\021\r\211tg\327\201cH\374\210`\006\305\303\264;J\b\362\b\t\354@/\252\255\022\350\305s\227\366\343\266\273&\335\253\r\366\037\030U\200\335\234\020\267)\355\267\270\213\330\177`\350\2707\007jEL\f^\375\240{U\335"
+	.ascii	"\367"
+	.string	"J\017\302\275\336\347\001r\236\003\215FF\331\217\361\245\226\277\343\024P^\366\352\203\334\353\347\225\256\240\306\r\035Z\317lFF\311Y\363\244\247;u\354NZv\322\347\250\223\007\002\264\335\232(\037+\242&\225x\322\217\364\337~\333\037\364\023\235\263o\237\005\314\177q\241\3038\322\223\256\344\324\350\343\021\022\330\r\366\037\270\n1\324\017t\021\277\220\373X`^T\254\360\201-\n\257\225/\f]X\003.\254\276\fT\245\265zQ\263D4\270NRX+\225\023o\245\265\002=V(z\"\t\354b\371B\357\345r\205\236<\335\251\343\222\231I3gM\350\304R\r-hg\216\177\221\363\235.C\374PP\270\327\327N\017\024<\344l\272l\307\337\342>\0037 \200\002\021\273\233\007\023\313-\220 \316R`\342\352Gi\020X0\002f\230\2475\324b*\354*o\267\344\271\021\3061\306\202\3028\204\035\240H\033"
+	.string	"mM\222\tn\3013.\177\350\310`\305\200T\355B\260\327\207\261\234-\211L\337Ba\311tVd\363\026\003\332\335[\\g\0220A\227\306m\257W%\231\354f'\253"
+	.string	"\307Cv\004\2358\f\335\027"
+	.ascii	"t\037\302\024Z\227^\213\307"
+	.text
+	.section	.gnu.lto_blackboxStart.part.0.334.162a51487001df88,"e",@progbits
+	.string	"(\265/\375`\320\004-\034"
+	.string	"&\355\242F\240ZQ:0\373^\327\031(i\346\331\216\t\222\257\265q\240\301\261\214\263\247\261P\355\302V\237\273~@\330n\250\355\r\240\341\327\265\367\240\027O\0302\n\246\305\007\316\265\301V\017*a\211'\213U\326\"\204l\231R\205"
+	.string	"\223"
+	.string	"\217"
+	.string	""
+	.string	"\326s\\\257\270~\202p\nk\300\255V\242`Ve\022\2730\361\253\334\312\214\353,\240\324\002\234a\363&\020\036\323\224\357j\\\347\006u\304\324\360\245<\312\306u\016!\345\273=\325Zm\204>\324\r\273\247\347\342s\266o\330X\217*\353\017S\033\313\200P\255M\230R\322\301\003\326Z]\027'\356\364sC\352/YT\373\374\356K$k\227\246Wd\364%\360\020"
+	.ascii	"\206Z\253\003\004\271\305\333\276`\333\307\026O\004'=\214\027"
+	.ascii	"i\224T\300\337\0337m\324|\315\325\336_\306-h\316X\371\274\212"
+	.ascii	"\252%4T\205\364\313\220@@\346\203K\314\307\200\0201b\204#\034"
+	.ascii	"\f\211\002e\255\265\202\357\345_J\230@\201b\274\030\243\f\263"
+	.ascii	"c\323\0232\203\301\277F;\305\247^\003\332\324Z)p\371\217\022"
+	.ascii	"\f\360\027\264A\267\226\300]f\204\360\353\236\005\326*k\r\272"
+	.ascii	"r,+|%\027\315\002\266'ac\213\027{\322\207\272\200\336Q\324\035"
+	.ascii	"_\216Y\333\351\344\031>\254\023\211\035`\035\006%\017\270c\211"
+	.ascii	"\346xH8\236\303\210\254\244r;k{\035\2419*\264i\364\203[i\223"
+	.ascii	"\023\305\341\306\213\217\372\0029\301\254\333\323og\236Y\022"
+	.ascii	"\361\352\301\0368]2\332\224\tm\262'w\212r\232\234X\341\23053"
+	.ascii	"pB\237\354IoO\251~\372v\016|\321(4Gs\343\305\245\"\347(X\233"
+	.ascii	"J\3110\013\364\206\370\356\370l\263f\1776\372sNg\246\341\347"
+	.ascii	"g\274x\242\254\002\036\353\276\r\r\252\220~\034F\037\316\343"
+	.ascii	"p\360\225\270\203\207\r\006\222@#\246\242\005\320\313\205\n\027"
+	.ascii	"\f\330\353\205\013H6sIH\340X\214\0252\227\214XL\346\352\t\353"
+	.ascii	"Db\fA\323\3469\247\223\355=\r\317\350-\262K4<\264<\264 -8^\024"
+	.ascii	"\233l\261\272A\025\371=iV\373\331\335AQ\226\337\355)\234H6\212"
+	.ascii	"k\255\033\244=Z!1\035\025\242:|x\214\027\303y'\037f\206\222\246"
+	.ascii	"\021m\032\242\270ye\201\210\026\355\3119\017\365\033!\227\230"
+	.ascii	"\276DFR\300\036G2J)(\020\356%w\210\016!B\225\224\222\002\200"
+	.ascii	"\201\250q0)\2252B#2\2226\205\016\240\002\2211\253m\020@\351\210"
+	.ascii	"\n\351\240\265\344\001WR\331\224v\300(\031\b\021\024\213h\261"
+	.ascii	"|d>\302\2267\332\205\026E\376RxBW\200\026\306\306\026\244t\305"
+	.ascii	"\224\017\320\027\312\344\037H\341\007\003\236\307E\202#}M\200"
+	.ascii	"k\244S.\303`\264\221D\274\360\007\004\n\332\364\274\013\354\324"
+	.ascii	"8\375\016\315X\324\035d\241\300\303r\255\253\372\022\2143\324"
+	.ascii	"\264060V\323\364\344\377\260\034\324=/J\0168p|\206\337\tb\326"
+	.ascii	"{\346\370\361\377Hc\234PJ\254L\232sDBk[cX2\230\254\306\016\033"
+	.ascii	"\"\240\352\263\026d7^\302\034F2\212\021\260\210\254\222!\307"
+	.ascii	"\025\254\212\324q\253\303R\375\034p\003\233\217rT\216(\366\276"
+	.ascii	"\346{k\256\221\007\221\0048\202)\006\310mq\252\312\325\221\226"
+	.ascii	"\272\202[\223\344\024\345|\324\374\001"
+	.text
+	.section	.gnu.lto_startInTestMode.part.0.336.162a51487001df88,"e",@progbits
+	.string	"(\265/\375`!\001\355\f"
+	.string	"f\027VC O\225\016\240&W\024e\210h\316\322\n\026[1&\036N^\b\332\024\236\227\227m\305t\354@\227+jb\224\235<\302"
+	.string	"\006\305\363\343\013\004d\200\364\001s=\222\326Q\330\352\305\2345\r\221M\366N)="
+	.string	"B"
+	.string	"I"
+	.string	"\333I_v\262\273\356\364&l\237\354\221\327\330\262<\332#\336\204E\035\240}\250"
+	.string	"R\333\335\357tv\370\370)\267\321G}VZ\030.\003|\233`v\327\224\327Mo\333\200m\006\366#\004\256J\006\021\n\033\265\335\372\235J\373\376\307g>\210;\217\323;J\322\253\353b]\346{\324\243\030\337Q\002\2600\366-\021Z\b\222\335j9\365\205r\352\372\001\334)\345\002\270S\233>s\201\026.v\003 w\372\227\207\027%b\244d\211'\322\026\037\310\257|\331o!\204\304\b\031$\252\211\222\023\346\271}\333\311ao\033m\246\261\261{\241d\306r\240,D\374\343)L\332VC\215\271&\260\r+N\324VB\265\230L\362j,\366\214Bp\201HT\300\t!H\300\351\204\031\217\350ys\201"
+	.string	"j>\233\214\003\315\027j\220\001}\233P\374.\004\f\212:\3417\002\301\360\353l\313O\016cRS5'\354\037\316\017\271\212\217\017\302 P~u\352\007\033"
+	.string	"\\\tT\323y\262\350\207s\006~u\0234\326g\002\004D\3010W\270-+\004\004!\211\021\"\005\"J\2058\352p)\003.S'Z\350&\b,\352\006`\272\323"
+	.ascii	"p\355\0017ZD\277\253\214\001"
+	.text
+	.section	.gnu.lto_blackboxLogEvent.part.0.337.162a51487001df88,"e",@progbits
+	.string	"(\265/\375`\333\006\265 "
+	.string	"\346\267\302H\220XN:\303\367,\226\r\017\371\025\367\254\256\341\034V\355\331\236\225XP.\017\037BAI\220.P0t\2349\213\367\323\216\025\346\f`\002\210\tD|\n\340\340[\235\246m\210E#=\270\215z\272[\223F\244m\231R\252"
+	.string	"\227"
+	.string	"\267"
+	.ascii	"'&\rk\fZ\344^\347\215\250\270\241\251M^.\020\230'=4w?Lz\027\322"
+	.ascii	"mX\203Q\336\265O\344\\\347\273\220\234\253\325\212IX\255\303"
+	.ascii	"\003'\315c\236\304\271\200\362\344\355\001\312\223\366\205\266"
+	.ascii	"\223\242|\332g\037b\325\2334\262'\"\230Z\353\357$\305\361\363"
+	.ascii	"\272\234\211+\311\033\335\335\351/TP\351:\024X\271\233\032\r"
+	.ascii	"-3\007W\366\202O7\234Z\353.\350\264\244\211\243\326\355_7\257"
+	.ascii	"\244\211A\263\2121u*\325$c\205.\310T\352\212Y\305[EM\225\013"
+	.ascii	"\340;\\\203Z\253\2774\343\346\335\366\022\333\020\354\262+\265"
+	.ascii	"*\235\312G*\303\352\253j\332\332\217Z\253\217\211Oe\037\314\034"
+	.ascii	"V\337\311\323\233u1>m\233yK)\316RJ\377\365\235\036fOmK{\364\217"
+	.ascii	"G"
+	.string	"*O\227z\237d0\355\321\2745\361.\226\366\020\321\036\312\377\372s\230\215\031\233\250\322\322+\323\335o\225\336\260\313uM\271\246!\3273\344\272g\256erk\036\271\336\231k\235\271\316\341\326f\271\306\225\353\262\\\223'\3767rMo\353\375\360\177\316\n\013\220\325\n\3438\246V\221O|\330\276\375\257${\2673\335tG\317\245^B\231\243:z\303\346DeGx\232\204\004_~\b\344\350\241\b\211[\364\005\212Yb%\2752\211\322\244F^Z\2326\214\355\tG#\241C\341]~lL\372)\241\021\261\373\316\202$\256\302\271l\301Q\006G)\233--<\313\205\227a(i\317\220\2665\262\373\314\326n6KR;\203\006{\303\261p\340\331@\277\022\244SVkU`\345\204\220\277\343\244\257\242<I\322\236!l[\\a\277\231\027\243\322\262\231\336\305\254\"\026\245Wv\025_\211Q\255\306\024\237\312"
+	.ascii	"\262\2641c\276\224^\024\251\242\017EF\254J\215\305\217ZU}N\374"
+	.ascii	"'>3\003\006\001\f\201\363\001\210\343\241(\302\016\350\b\310"
+	.ascii	"\303\355\250H\350\204\020\351 \236\024\300\016DA@!:\374\212\206"
+	.ascii	"\200D\374\202\214J\374x\b\0308B\310\350w\004\004\032\375v\266"
+	.ascii	"\367\364\206\033,Q&\037\354\247\307\343\021M\307[\003\357\372"
+	.ascii	"\355\221\354\213\323\306\200\262Z\235\016u^\231N\013vN\034g\216"
+	.ascii	"$gD\2147\336w&\314\325\350X\250\026\247V\r\365\001\033\243\341"
+	.ascii	"\261N\247"
+	.string	"\217]qj\351\224\321\320\036!X\224\373\316\200\230:;\023\344\024rn\355\322)\\\245\237\235\262\031\352\363%\325\223\241\27566\231#k\270\234\345Q\373\354r\360\340a\334\244\267\366\243\203\305\243>\3041\256\245\035\265\207\210t\001\200\206\250QT\343\034c#\"AR\220\244\220\341\320\002\021\232Z7\021\300@\346\034\032*)L\262?\007\344\376\2370Y>\352\265)\250\315g\330\256\236Y\302\211R\230EX}\\{3\305\363\235wH1i\263\240\362D\322>\3137CaI\016\250\017\242<\266\376\344\250\005Q;\211\020(oe\273\260\254\240\024\233\315\371\005U\274h\227\265u\222\306\321)[\217R\220C\3409\365\320.g\352\365C\243\372~\240\027v\017\311M5\347&\351\364\031!\323x\267\354_\234;|\271\2754\"l\200\347#\327+\320\260\243\253&\305=\246RA\035\177b\202@0\345\271\233\243\337"
+	.ascii	"f\302C\231\271%e\311\313\016}\245\325\0354\237}\201\001\247\305"
+	.ascii	"S\274)eO\233\n\233\002\337\234\240\027\205\030\272-\305b\022"
+	.ascii	"\216f\005\r|+\016\016\365\233\027<F)\254b\"\344\266\233\253\360"
+	.ascii	"\017\033\202\024\2455e\225\020\030\314`B\3353cQ\001"
+	.text
+	.section	.gnu.lto_blackboxFinish.part.0.341.162a51487001df88,"e",@progbits
+	.string	"(\265/\375`;\001\365\f"
+	.string	"\306\325O?"
+	.string	"Q&\035\310\200\341\377\252-\250:[&4\032:\341O<\330\007\243\234O\003\246\3119D\377\365\003 \240\342w\363E\273\235"
+	.string	"\353\273K\377\021\022)\310\270\376]\207\352\360b-\331d\313\224\002;"
+	.string	"?"
+	.string	"?"
+	.string	"\037a\373S\301 [\306G\325\026\230\325\230\360\242\261\273\335\247\344p\320\245n _\274v\220\205.?^I5\027\f\230\005\fW\001\337\036\224\3355$\303=o;\201\355\003\366M\004\237\222\r\037^\204\224Ce\312r\373\266\022eo\352s\233\013\r\001L\273\024:j{\232-<\370'\356\352\274e\215\2050\225:~\211\217\236\267,/\304b\230H\354\256G}\361cG\"\237\001\334\247\002RMD\351\362\243\277\257\270\020\030\315\3400\314"
+	.string	"\325\356\"Hq\025\031\177\365i\r\250\017A\356Sr\2043D\332\341\207\372#'\202>\274\374\370\243P\210\254\r\332H\206^\220\323J\002\376&\022@K\346\363\032X:\007\030O\323}\033N71`\360\301e\323A"
+	.string	"\301M\027\261\255\337V\242,\036\002\003\301\332\240\211\344h\246\241)R\246l\003x\205\363egQ\361W^\340\351C/) \200\202\031\244\351\001\247\325\333\316\030\205\235k\254\323\254\332\301\nt\310H\026tX\034/l@\016)\034:<\211\035\265\264\202\034\362{\200\322"
+	.string	"\220\275\256l\232(\017\363\341\350Z\340L\343\r\202\234\304\235F\260_\032\233\226X8\247XhMY1"
+	.ascii	"j/\324\332P\320\376\023\336\030"
+	.text
+	.section	.gnu.lto_blackboxSnapshot.part.0.347.162a51487001df88,"e",@progbits
+	.string	"(\265/\375`r\b=+"
+	.string	"jF\250\017Gp\236Q:s\256\241\342\"!\325\031\201\355\367\324\240\365\320\263\342\016u\306\001\330<h)\240T0~\263\266\356\215\320O\367\201\244\233u\314\277\024oc\343\340\334>"
+	.string	"\247\0073H\333\302\025\354\177\373\2374B\310\226I\006\343"
+	.string	"\337"
+	.string	"\352"
+	.string	"8\034w\377\330t,3\316\343\235\"r7\363\327o\001\217e\006\333\3565\242\374\272\367\330\340(;P\217\022}(=z^(=\312\374+\314\334Dd s\234\037\215W"
+	.string	"ZZT\362\354\336\333;j\223\034x"
+	.string	"BA@?\274\235.\207\273\331\324Z\212\236\266\207\200|\005h\344\f\247\202\007P\253\240!\t\032\245\026\232\221\035K.t\365 %\007\262R\322?W\306\346\021\3412\366\356\252\330\272\253\344\220\316\035\300a\021\251\016\214\021\205\364\r\213\030\244mcD\252\223H\371\003XD \255\326>F\374\021\325\351\273\216\200\210R+\313\310\016\252\2435\372\304MA\235D\367\336\335\324S\333\223A3\314\235\335\024\3249$\325dx\2567\216)\247\356\240\017\325*\334{\371B&\347"
+	.ascii	"g~\016f\276\300\\\373\021\037*\245Go'\254`Y?\204\235\266T\213"
+	.ascii	"\334\005G\333\013\312\027Z3\330|\332V\261\035\372y-\022\346["
+	.ascii	"3Om\336\251\315:[s\316\326\214S\233o\266f\233\255Y\375\361\257"
+	.ascii	"\335\232S\324\326|\252\315Vmn\265\371\005N=`x\305{\245\322\366"
+	.ascii	"\334\"\250\030''\3634LL\303\264\365u\006\306\372\246\f\373\210"
+	.ascii	"\202G\243\324\271x=\035\213d\260\357G\243\324.j\353\254w\224"
+	.ascii	"\017&\3068f>\031\206\020\241\351a.\230\b!\002\360a.\210\202\307"
+	.ascii	"+\205scf\251uv\357\261\350(SP\271\304|k\335R\345\313\302\211"
+	.ascii	"R\244\272\367\202y\327\322\221<a\005;[\362\362/LLc\221\212\211"
+	.ascii	"\313\2250\216d\024\311\\\302\340kyR\306\221l\3070\233E\255{\257"
+	.ascii	"\214\032\237\253\2119([\300\200!=j\263\024\254\266\204\2356\304"
+	.ascii	"I\222\244\215\316U\333S\220|\2142\034\251\366\312\013\251\331"
+	.ascii	"S\034\322V\324x\rU[u_\232g\303\211\253\330\231\035\002\235Z\356"
+	.ascii	"r\016Kk\226\231C\207\376\220\211\240l\220Q\233\332\t\253\230"
+	.ascii	"\223\033.}\204\235v\207\306J\346\314\216\260\323\354\370<(\241"
+	.ascii	"\366bOP\207\371\244\270\n\021\202\221\325\214\322\323^\025\315"
+	.ascii	"\262\324!+k~\216\321\207\243#\373/W@\266\346Iq\265al\2160\323"
+	.ascii	"\333E\244|8g\212\030A\202Dz4\004\220=YTfK\357\372m\313\312\240"
+	.ascii	"\210\246\007j\255n\353M\tk\237\306\312\236\301\326*\306\363m"
+	.ascii	"\336\326b\3754\201\233H\231\221\222\372\303\266\237S\344\311"
+	.ascii	"\006\331\376\306<\315/k\253\230\331\227\336\376\220fO\235\207"
+	.ascii	"\371c'\363\361\2270\n\245\016I+\230\226\222~\351\322Q\322\n%"
+	.ascii	"\020/X$\375~LH:Fr\020\303w\"\005\222\t\025'z,\224L\254\350!\375"
+	.ascii	"\226z\016\f\260\257E\322\257\367\302\347\373\365p\347\377\006"
+	.ascii	"\036!K\241u\362\321C\256p\002P\320\314@(@)9\257\254\213\326t"
+	.ascii	"\262A![\305\r\304r^\350Y\243\274~\330\213gq\354\26091\317\212"
+	.ascii	"Z<\033\364\340\336\013d\221\3301L<\313{\357\317\316\332>R;\373"
+	.ascii	"\244\325\361\336\313\323\331\036\323\261AW\204d6\257\3609\333"
+	.ascii	"V\222\f\244\3228\2069K\241\254\357\275A\035\316\266\025dY\263"
+	.ascii	"m\030\001\263\216p\366\311/\340\261\246M\216@\027\235\277^v\247"
+	.ascii	"\316\022j\200\0361b\270\233\355<\375t\263\347z\003\036\314eq"
+	.ascii	"\345.\2611c\267\003\327\324fv%\003\257t\020\270\252\367>I\340"
+	.ascii	"\247\365\005b\341/y\200\303\250\201@\345\024SR3\222\024\024%"
+	.ascii	"\035\240\002\021\242\242z\021p\261SpJ\223\354\354\006\240?\300"
+	.ascii	"Q\341']\234\214\250\232(%\274\3327X)i\371\267|\233t\032\252\006"
+	.ascii	".\247\215\3615z\273\204\224\240\242\246\t\272\302\336\244\213"
+	.ascii	"\221)\320B\272`\t\027\222\217\321\315^\244\335!\376D\211]V\374"
+	.ascii	"V\356Jh\271'/\220\374x\216[\017\335R\357\210\350\301\3772\272"
+	.ascii	"};\0337\370)(\033R\231\336\233\t@t\256\236\276\fh\020\003\\\302"
+	.ascii	"\034Y\025DG&]\252\242:\275\025\001\273?\2538#\252\277JP\314$"
+	.ascii	"\017\225T\347K\377?HSw\300\232\376\035R\224%s\346\215vY,\376"
+	.ascii	"\023\335.\0336\301)\347\211\b\364\3146\267[\232N\375\356\022"
+	.ascii	"i\303Z\343\251w\331\376\346z\267\237\325\364wJ\212D]f\300\212"
+	.ascii	"\330\213\320V$\333\344\307\"\274\275W\247B%\342\211\177\007\337"
+	.ascii	"w\220\b\270e!_-,,%Bx\247sB02\230\024\242\270\230\265\277\337"
+	.ascii	"\003\215\332\"B6/]\201o\031\236F\274`\210\226\260\fT\325\303"
+	.ascii	"\2417Q,\335g\350\244;\350\315\306\234\235d=\273x\005\267RTN\217"
+	.ascii	"\224T\204r\267@\250\355[\b\356P\343\235\340H\340\253z):wlZ\200"
+	.ascii	"8\345(\351[\2174\tb-\n\303\bJ\231\361=T\260z\262\353\237!\206"
+	.ascii	"\n"
+	.text
+	.section	.gnu.lto_.symbol_nodes.162a51487001df88,"e",@progbits
+	.string	"(\265/\375`|\035\225U"
+	.ascii	"*\206\270\034W\200\314!\245\0037r\177R\201\324\017\232\367n\352"
+	.ascii	"U\332\236\207\260\261\335\220\n?\320\017*P8\byL\314\376\035\230"
+	.ascii	"\315\342\260\370\177Y\313\356W\302\353\204\237r\364\322\243A"
+	.ascii	"(\325\355Rn)Kk\n\316]n\314!AT\365\304+W\036\210\355\371\275\336"
+	.ascii	"\377'w\222\001\261\001\252\001\275\00116\n\220\005\243Y\315\023"
+	.ascii	"\372<&\324\034\341i\376\374\230>>\346\214\036S\006\217\031\303"
+	.ascii	"\204\311\242\204\tc\307\354\3211yf\216\271s\336|\3414s\232&\016"
+	.ascii	"\323\364\2210W,M\032J\363&\251\257\204\243\357\003\251\337\343"
+	.ascii	"\250o\202Q\177\351F\037\3518\311\276\215\242>\215\331\343=\375"
+	.ascii	"\372:D=\211C=\203B\375\022\202\372L@}\022\346\264\321?\252\321"
+	.ascii	"7\232t\204\236V4\372A?\007\332\340\323\263j\316\350\327\220\261"
+	.ascii	"a"
+	.string	"#\326J\317\212\305\330\025`\374f\003OO$;\027\341\202\373h\"\276\242\366\242\177c\2728N\213\347l`\3213Jg\271\344\254\026\032\316v\361m\226\332\212\376\016\021\366H\273\331-\033&\355y#\204\0314{\017;\2336\375\2419y\223\322\316ne\266PV\330+4\007V \341y\227>\216i\201\310\343\343e}\027\223\354f\264\265\371q\213\\\246\315\330\344my\027-?\343\263\263\263\"\317\322o1\261\274\312\225K\261r0\261?\t\273\261\312\277\250\274\322\246\334K\312\213Q\356\004\312\273\300\372E\363\311\233\030\277\365u&\365D\232\327\263\212}\322\311\222u\365\177&\327\217lp\252&}\237\271\306\0354\252\276\325\217\301d\315\210\017A\353S\264\254=\243a]\205\225\032\366y\246\260?#\270e\037n\263\244\3373\225\314\032W\375\237\325\216\32108o\303\253\246\215$}\2429\301{4$\213\005"
+	.ascii	"\036\217\307\373\221\276\214\311\273\247\274S\235\322v\267\306"
+	.ascii	"\353\365x?v{\027\311\316\033@\"\023\273\221>\214\271\273\031"
+	.ascii	">\b-b\370v\243:1l\253/b\330F}1\234\"G\307(\252\211z\226\342\361"
+	.ascii	"lJP\036\035\223\250#h\006\245\b2D\351\241j g*\006rW>\346\005"
+	.ascii	"S\016L\256\204\241\343[y\b\230r\202\356\323\255\224n\245t|\022"
+	.ascii	"\304W\212\205\216w89\336\321\034[\2400UW\352r\325\227c\034\256"
+	.ascii	"\304\321\235\033y\243\266\322F\326\0269\256\2255\352\"\307\177"
+	.ascii	"\221\343\2239\276U\034\337Z\340\370%\b\0268\206\2419/\254#se"
+	.ascii	"\305\335\250\357\205m\224\305\013\327(\215O\202\200\2518\223"
+	.ascii	"a\312\234\311\272\362G\"\023\253\312\341|\223q\344\255\336\250"
+	.ascii	"\255\254\325\032YO\352L\006\301b2\216\236\211\fox\356[&\353\213"
+	.ascii	"\035\373V\270\364\257\214\365\267l\351k\321\322\037\313\322\347"
+	.ascii	"\202\245g\213+=]X\351\251#\326S\204\260\236CU\372XT\372@\246"
+	.ascii	"\364\205R\372\301(\375%Pz\n\201\365\217O\372e\306>\331W\037\252"
+	.ascii	"\366O\360\352\tT\354_9\351\331\353\352\017\271z\206\320\244"
+	.string	"\217e\253\257\204I?\013\261\277\202V\037JV?\nV\177\312\260OE\330\327\n\366\271\226\364\215(\351#\271\352'\261\352WU\365\211$\351\027A\322O\341H_\bU\2774\322\037\242B?H\221\276\324T\037H\244\037u\036\217\267\253!\205>\n\0372K\005\204,0\201\353E\333\005\241D\007&0\020\201\302~\321v+\350\240\002\020\035X`\302\202\022\024\210\340 \201=\275\231R\373\204\026\244\377\024\325\3771{[\305\267TtV\312\316N\241=e\323/f\207\f\323\373\205p\201y\311\024\177*&7:\272\035\262\356\367\025B$\311Jf\207\274\003E%\3548;\334$cPa+$\031X\362\311\311\221o\332!\277w\007|\312|s\207l\200\020\255U\033\211\243\270\222\004\022\201`\322\2223\255\220u%]*\177+\334`R\020\351B+\344\027\377\252(\237\315*\331\340\360\346\205\323\2256\310\005\034"
+	.ascii	"\336\325*\341Z\357'#:\233Z\252\275J\332+6\300\307\306Rq\255\310"
+	.ascii	"\300R\261\215\"\341X*\306\225D7*\322\354\024\337~3;u\246\234"
+	.ascii	"\240\256\035\262S,\301\321Nq\356\367\371\300J\361N\024\021\215"
+	.ascii	"\223\0356\f\205&\306\223\035\370\364\323J\213\223\241\337\350"
+	.ascii	"\300\032\224\277X\327\212\f\310\323\262\206\230\205\370@~\247"
+	.ascii	"\254pL\361@\376=TD-\377\325\260\006\372-\342\b\211.T\3033\344"
+	.ascii	"\347S\220((\f\364\007\022\342\002zQM\r\310\317\214\023\325\360"
+	.ascii	"m\250\346\005lI\307\213j8\202\363\024\262J\021\016\f\360\016"
+	.ascii	"G\364\345\364 \016\254\2538z+\20180\210\027\300\343+\317\303"
+	.ascii	"\201g(\r\032"
+	.string	"\306P\216@\303\027\310\0324\274\263A\3030\225\207\206m?4\374&\237\031>\023\231D\215jQ\371#UP\024\365Di\242\226(I\220#4\240\"j\b\352AC\315P\316` /P\013\025\246\324\2219z\253\266\262F\376g\206m\300O\234\314\344\315\220\341\003\377\273\315N\206ke\214\035\327h\317N\306\216_\224\023\303\377U\025@\025<1\234\002\210\342w\232/'\236\337\306\360\211\235\030\276\340\"\206u\365\373\345\264\263\003\027{\036_\251\370\001~\\\304\r&\001\377r\003H\320v\035\375\036\200U\023\225\r\032\375\224:\324\262\363\330#7\375\013\227\326\317{\354\221U\224\257\0051~\335G\231\202\376\307\036\031E\217\270G>\001\304\252>~k\334#\233\240$\200$\310\fD\204\350}\250\036z\032fh\020\260f\217\214\201\324\321\257p\f\212x\241=r\216\016\355\221q\364V\237\366\3106r\217\007\344"
+	.ascii	"*\017\265G\256\365\366j\217\002\234\0351\362\023\366\310\314"
+	.ascii	"T*%\035\031\025\361\357\314\254\214ll\013\226+5\214J)\243<1z"
+	.ascii	"\025\203P\250\372T\366 yP\035\265\251d\"\225\350Q5*\213\310\371"
+	.ascii	"\243f\265\254$#\307\350\225\032VJ!\237\320b\215*\237H\036\264"
+	.ascii	"\251*\035\025\265\212\024(Nx`\242D\375Z\311\242#\252\006\365"
+	.ascii	"?\232\274>x(5\220;\326\310\031f0\\\250\273\272\373\355\327\032"
+	.ascii	"\331B\315\261F\206\321\221U\007Y\302"
+	.string	"\0329GMX#\343n9\232(]G\035\222\340g\215\374\034\373\305\267\337VQj\275\330\366;\001=@|\354\324z\361\351\235\326\213*G\027\244\025nq\006\223\202K\313d\273\266\334Y\342b\205\333\365\244`\222p\261\266\213\357\264[l+\3765zK\274p\305\313\224]\ra\200\337\256\251\335b\013=\251\335\"\227\311\233\226\310:\340w*@\331\340z/K\004\343\361x\264%\362\351\203\226\310\036\260\226\310\021h-\221\013\330\254%\256\361\307\254g\205\2535c\265\270\006\374za\351\262\264\302\315\342S\003\262\270F\032-\026\037\270\303\305b\t\216\026\213a\002\2027\250\222\260dR\306\212dd\244 )H\032\003\202\f\210\005\255df\334\022\240\262D\fS8\320\004\"\201\310\004\"B\017\302\261\202\215\360\277\013\022C\240\006\322\327]\310z\276\305\003\244\237\375s\257\354\325:\320\374\355jp\247\242\312\260\325"
+	.ascii	"!{\270\006\001\357\372nj<\023\002u\004\375\317\325u{\346\001"
+	.ascii	"\217R\370\207;\016\020\005\013\377\2201\264\037\005l?\212\331"
+	.ascii	"}$\t\372T\232\371W\316\324\004\360\357\271\016\307\357\373\210"
+	.ascii	"V\315\\\005s\006\271\217\347\377"
+	.string	"\313\023\276\004\317\357,\310\245\266\210|\234.\371\372{\001\023\020\262\207P\016\003#\005\f\367\025b\002\346m\363\347I:FJ\367a\234\023\035R\264\370X\322k\336\224~\335\226\360V\007\r\336}M\271Bp\262\035\t\2637\007\275W\b)\360T\251\001\313\344&\273B\241\257\f5\207#\277v\2723\375\300\365\352\217\225>~4\005\035\022\312\207\013\364\370a\036\007\2109\356\004\"\036`\301\030m\305\t\241\216\242\355f}\316\347\240b\274\307/\312\323\232\250\263\034A\007\313"
+	.ascii	"A\213R\230~t\006\317\023y\342\214\360w\020\006\212L\024\306\311"
+	.ascii	"q\305^\357\313R*h\310\315d\217Ok\017f\314\347G\312\3007\276\002"
+	.ascii	"7\001{:Q\357W\003\362QQ5\224\307\210\343\201\377\361\335\363"
+	.ascii	"s\b\024\276\327\312\341K\316\333\236\245\376$y\n\200r\217\313"
+	.ascii	"\274\324u\261\270Z\331\312\032!M9\234\223\315\261\022\250\210"
+	.ascii	"\304\301\303\260!\303\350\316'h{\254pC\003\262=_\262\300\372"
+	.ascii	"\253!\031l\325`\315\330\372\017\031\353\265\272\240\t\260\027"
+	.ascii	"M\332\316\031\032=\002\235\3779W\txM)\322\216\203\215\376\027"
+	.ascii	"\nYm\016\177\325@A\323E\351\374\324\025\274\251q\333\331a\236"
+	.ascii	"\357>B\300\342\212\247|/\376\021R/\256l\236\377\233}X\252\325"
+	.ascii	"\355\f\023!\342\260\307\254J\023\347\353}\222\367\2333\311\006"
+	.ascii	"\177\327\253\207q\374\341\326\337\221\343m\212\300d\312\262Y"
+	.ascii	"(\257(t\271A\006\025]!\332\032|\r\317\255\367\b?\365@V\374I_"
+	.ascii	"9\261\351"
+	.string	"\323B2\260\345\243\021\210\022\334\333\263\323\273`8\177\201#\210M\251B&\262|\233\337\306\243\3764\037\305\253\361i\236\325g\373Y\274\215O\363Y\177\266\317\362\325\3706\217\352\243\371(\336\346\247\371\254?l\301<\363\021\016j9\016J^?\307\361T\021d-g\205-\007P\270B\267\271\354t\207m\333jvK\244\373~\323\366P\205y\371N\327\371\376\376\277\372\363d3n\322\217z\205\031\256\356\327\272 \024\003=*\320\032P\334@%\030o\253mn\246AO\222u\326+\300\374\252d\362`\374\317\244\264\341\250\346v\371\370\210\350\016R\217\244\215v\337\300\212\022\310\260+U\355\353\271\017\241\362\344\025\027\2714&\\\301{\225k\344\321\265\331\026@9\347\027E\235\265\372\346\001\270\222\232\216!\252\267\210\316g9\246\270\257r\3176\325%\226\264*R\232SQ\214\337}x\345\237\233A\372\202 \030\036\364"
+	.ascii	"\200F\231\205]\226\003\003\224\217\017\373}T\243\206\233\271"
+	.ascii	"uh\214\370y\031\374p\227\323$\021\342\341\335\031\274\324\310"
+	.ascii	"\032\305B S\214F\317\360\245\210\246\356!\230\253BN\214d\217"
+	.ascii	"\324l#\365z\231\"\350[\001"
+	.text
+	.section	.gnu.lto_.refs.162a51487001df88,"e",@progbits
+	.string	"(\265/\375`i\b\005+"
+	.string	":]H\020G\220\\Q\032\003"
+	.string	"\204\232\032\271\025"
+	.string	"m\241\354\274I"
+	.string	""
+	.string	"\t^\177\033uiz\025\022\004R\323\334\002L\004"
+	.string	""
+	.string	"\300\005"
+	.string	"E\330\324e^\263=\001\r\0362"
+	.string	"2\237\202\240\350\243\207\242\377\355\243\362\217\326\330,\331[\246\337"
+	.string	"\352"
+	.string	"\356"
+	.ascii	"A\241O\360\373\245\337'\375\036\370{\"\337\007\371\336\307\367"
+	.ascii	"7\337\323|?\372\236\372\0162\232\244\355#\215\016\243\321i\357"
+	.ascii	"\267\234\007\273\002\375\376\354C_\0347l\304\310\321\027\306"
+	.ascii	"\013\027-\346\2609S\237\251>\257\276lw\266\027\205n\337\250\335"
+	.ascii	"\367\304\234\034}9q\276\3667\203\005\367\017\271\352oU\037\252"
+	.ascii	"\276S}\004\365\013\324\007\336\336\310\366\265\332\263{\200H"
+	.ascii	"\207\352\377D:O|\037\221\236\023\3516\221^\212tR\244\217\"\275"
+	.ascii	"\212\327h\353\312\275\244=I\373\221\366\"\355)\ri\334\201\344"
+	.ascii	"\003\030\367#\362\215\306\275\210\374 \362\201\310\337\221\217"
+	.ascii	"\033\377F~m\374\222|\222|\330>\255\317l\327\306\275\224=m\334"
+	.ascii	"ybO\216\373,\366b\354il\230\354#\221\336\253S\272\270\277\373"
+	.ascii	"\365g#\002\343lk\321y\310\331Z\273\214\236E\337\261\2060[|\311"
+	.ascii	"^\277\332\367\253\037\324\201\204\373\217l\337\311^w\273\352"
+	.ascii	"{\246\332\313\251\236F\232?{j\037\237\372\330R\273\270\324\327"
+	.ascii	"r\035\364,\023\3560\250\257\302}\205?\211\223\r^\326`_\006/\250"
+	.ascii	"\177\305J\225)Q\202\373P\202\347\337\344\334\317:_x\376\223\323"
+	.ascii	"\276\300\351\235\202{S\360\225\316O\252?\344\264\013\235\273"
+	.ascii	"\357\374\240\340\316\013~\256\351q\347\3634\375\354\374\361\\"
+	.ascii	"AoY\335cu\023\324\025\230o\"x%\363\005\230_t\340yL\357\303\364"
+	.ascii	"\345\322\217\006V\232}\026x&\002\017Lz\241\001\017$\340q\001"
+	.ascii	"\276\007\351y\200/\003\360\260\243\247F\027\361\274;r\334\230"
+	.ascii	"AD\364\233\202\350\277C\364FM\2311C\377\227\337\317\345\312\224"
+	.ascii	"'[ZWB\377\224\320?\t}\337e\313h\376,UnP\274\230~'Z\237\371\231"
+	.ascii	"T!\275\223\355\025\330\376\200\t<\202\372\241\337f\350\273\313"
+	.ascii	"\220\371\333c\304<\317\031\346\305\301\374\342&\361\226\311\321"
+	.ascii	"\374\272P\217\020\337\253\026\261\327h<d\271\317zT\207\030A|"
+	.ascii	"\330a{\355\201v\360\232\303~$\344\233\353{\346\003\355r\346\337"
+	.ascii	"\204o+i/yr\026{\270\365\206\236\305s5\320}#o\364\031o\343\327"
+	.ascii	"~6\276,\3661\335\031\312e1\330\317\327\273\272\350\373C1\304"
+	.ascii	"\036Fw\362\205\372\f\266\026V\326\026\304\203\314\377\331\267"
+	.ascii	"\355u\205z5\177\037N\201N\037\356\204}\254\346\276\346\022\352"
+	.ascii	"\275\275v\236n\007\272k\377\371y\237\235\354\272\271\366\034"
+	.ascii	"\256\334o\302\335&\333{jKm\355\344mI\326\036\033k\207\345\350"
+	.ascii	"\260\335\305\334^s\364\272;\035\367\035i\004\336>c\321o\024\335"
+	.ascii	"\024\324\244\213\242\016\354\355FEC>\363\203\240v \250]\207\203"
+	.ascii	"\332mfU\325\3562\340\217sM\355\260r\027\205{\225QI\355\236\330"
+	.ascii	"\255\t\372\346\270\361p\2070V\250x\270/\212\207u\340\254\321"
+	.ascii	"\221)\367\307\364~/]\316\325\362\035\372W\254P\331K\312\223z"
+	.ascii	"\327v\350o59\227\311u\350[]Eu\356J\246C\177jp\356\f\316\335)"
+	.ascii	"x\356M\347\232\317\241/\0318w\245sO\032p~\200\345<\322\371G\347"
+	.ascii	"^t\376Pp\377\005\177w\376\315v\356\265s/\203\273\310\240\304"
+	.ascii	"V\327\037\347^}\234_{\374\3655G\255!\303\205\n\333\327\023u\342"
+	.ascii	"\2709\360T\315p\236\232\371\315S1\273y"
+	.string	"\372E\313m\236Z\2412|\302\225uE\247\222\314\346\351\021#D\206\b\001\342CG\215\030,\226\236F\325\371bs\346\013\227)\\VH\212\f\t\302c\351\027\207\r\0321^\264H\021\265&\350|\265I\363\232\325\374aN\003<\200\312\2501`\205\brJFDD\222\202$\031\003\260\"#\031\032\017\021\340\266I\266\346~\264\213;\256[\251\333\376M^s\241\031\026\227\304\022[\315\356\362M\001}H\324*\304X\271p\221U\360\360\351\233'j\322\033\242\300\300\215\324G#\314<\225\326\302\336A\267\"h\371\360\nR\246\335?_\264\371\350\003\b\304\341\261\f\353R\034\312\207\221\323\016\032m\352~\266\006\3507E\327\002ed\255)\217/(7D\367\003e\003\331$\310\263^\013\242\222\347\"KF\212\bB\203\0206\342\002\t\241p\354\251\263\334\222\354\233zh\206\326\265\t\365*B\266w\322R\202\261]"
+	.string	"\030*3\311\304@^\364\357tz\005l\252\201\034\261\3733\220f\365\351\fd\023\275SE\365\265j\305\323\020\237e\304g\030\353\376\210\300\205\255\340\306\227\007)\275T\345,\335\035$\347>\035\352\002\024n\371$\0243\222(\350(\324\336\034]\b\\\035\177U?\311o\353#\217\226\237\002\036\366\360u+\336O\225\022\346\230c\207\212\273!E\207\240PY.\312.\314s\275\245\3004\203\270+VYi\3103@*FP\352\277ep"
+	.ascii	"\257Q/E\352\030\021\005"
+	.text
+	.section	.gnu.lto_.decls.162a51487001df88,"e",@progbits
+	.string	"(\265/\375\240\333\004\001"
+	.string	"-\022\004N^\006l\026S\020(e%5\006\300g\310a\262c\024h,\037\370\354\377a\250\216rA\253\f\236h@\0169\316\331C\216\2557\034&\306\\ch\"C\304J\324\256Q"
+	.ascii	"\210\334W\224H\030\262\017\206\320D8\215\023\371&\267A\200d\370"
+	.ascii	"\006ndk\226\310\275\267\334R\246I\023\264\026o\027t\332|=\351"
+	.ascii	"\r\241tjrP\240S\240\325>\220j\037\310c\037\230\264\017$\332\377"
+	.ascii	"\321\331\377\341\355\377\352\366\177h\366\177o\373\277/\373\277"
+	.ascii	"\264\375_\330\376\317+\016\336\024\266\"\266\254\261]Z\207\337"
+	.ascii	"\304PlAE\205\260\031b\027$\n'}\223\352\245wi\036\206\246x\251"
+	.ascii	"\233'^\332\206\212\324\220\255\367}w\220\210\321\013\352\377"
+	.ascii	"\214\354\377\242\366\177B\366\177@\366\177>R\272 Q\21732Y\377"
+	.ascii	"\207c\377\351\2324\r\230\032\275h\326n]lc^^\310\312\244p\351"
+	.ascii	"\231TM*\227\242I\311\244f\322\2714\016C\3234\251\230\247c\322"
+	.ascii	"7\267/_kems\\0VV\226h\230w\261\342\212v1\033K\223\202\251\241"
+	.ascii	"\345\n\312\326\373\276\037\200ra\\\306D\240\363\023kX=`\f\353"
+	.ascii	"}^\366}h\373>\261}\037\225}\337\326"
+	.string	"\276\357j\337\207d\337Wd\337\027d\337\247c\337\207\264\377tK\232\305G\324S]\326\307O\262\037\"\304\202`\225\035\215=\341\235\001\305\362\204\225%\035;\032~\023{\201ED\250\262\266\320R-\351Y\252\226\246ah\232%5\343\220&\031c\362\n\352\357\264\375-\266\277\237\373\033\312\376\266\332\337S\320/\",\246\261\254O\002\333m=\243\214am\211\211\340\362\032{\222\005\313\r\n\031\326\263\353hC\337\373\262u\245T\322g\032\226ZI\247\244UR\260\364\n\206\246_\251\327\330W*\345hC\243\347\273d\245\322\"5D\357}\337Ti\017\352\345\321g\243\373l\335>\273f\237\225\333g\321\354\263e\366Y2\373l\030-'\301'[\234Y\326i\026\0075G\023\027\266\254\317\216\355?m\222b\035=w\260\321\225Y\225\254S\253\364\352)V\312\344M\261:\210z_\242\024\2138\347}\211\210\030\013"
+	.ascii	"c\001h\256\"Wd\253>\033\266\377tIZ\225v\235)\343#\353\223\270"
+	.ascii	"1\226$\206\205T\026E\222N\245J\322$)\025\206\246Ui\221\247F\322"
+	.ascii	"#\317\317\3675J\253R\034\251T\372L{\200\025\260\350\373\276i"
+	.ascii	"Uj\003\177\301oU/\321\320\007R\242\344d\r\343\024Y\215\0055\306"
+	.ascii	"\302\032\326\b0\206\365l\220M\204U3\244\027\227\365Y\033\373"
+	.ascii	"\370\311\024\006\313,\005\222\366H\177\f\207\212\257\321\225"
+	.ascii	"1iS\0167\f\246\303L[\n$]:\"&\005\222\356\300_\206D\317\227\311"
+	.ascii	"\002Qo\262\266\240\322\2474*\035\222\nI\203`h\n$\345\361T)\263"
+	.ascii	"=k7Hz^\206:\375\341\244\201\367\025s2J\352\221\352\036a\216X"
+	.ascii	"e\375\225\314\376\nf\177\035\333_\275\366W%\373\353\217\315\001"
+	.ascii	"kX\277\332\330W\347\354\253z{\2101\254W\311\354\253]\366\325"
+	.ascii	"\261}\365k\377\351Q\0076\212\026\250\251\032G\206EWq\256\320"
+	.ascii	"\210\242\2038\275-\315p\303v\255\025\021K\2150\233+6\210|d\375"
+	.ascii	"\247E\351\320\272\027-\002\226\365I\244C\031\016\316\0336=\337"
+	.ascii	"&6\213\330\322\232^\372f:\271N\336K\21104\035\312q\362\034\334"
+	.ascii	"\205\275\216\237\357\221\330\373\276\317l\242fO\275\3544\034"
+	.ascii	"*\276EtcX9\357Mvb\231\220-\255\351\215(\221\016e\274\354f8\364"
+	.ascii	"|\227V&eKkz\357\373$\006Y\273\252\n\352?\313\371}\2770o~`e}5"
+	.ascii	"\312\276Zd_\325\261\257\036\355\3538\333\003\326\260^\253\331"
+	.ascii	"\331M\316v\371\356\331Mn\363\021%\0364\312n\364\373\022a,\200"
+	.ascii	"!\306\002P\2730!\262\262\352\353\270}\235e\177\2005\324\3459"
+	.ascii	"20oH\262>\t/^X\357\373\024\001\206K.\253\311t9M^\223\321`h\236"
+	.ascii	"\313g\346r\227\"_k\370K\321\024\254\367}>\263\315\345/]\321\367"
+	.ascii	"}\346\271\334\226\315\244T\230\034\020'%\252\331\342\274]C}\335"
+	.ascii	"\265\313 \263\336X\311\372\232\311\206\313c\2540\211\313o\231"
+	.ascii	"\f\206f\270,&\f\026+\242\004.\273a\261\241\321\363m*\361\204"
+	.ascii	"\213n\375\230@A\241\331\372z\307\276\246\261\257\211\366\323"
+	.ascii	":\373i\234\375\224n?%\263\037\305\032\326\247\\\366S\264\375"
+	.ascii	"Tl\377\231K\005\304g\017%#[2\330F[\312\274\324\322\312\320\224"
+	.ascii	"He}\022cIX\371,\243\345,Y\013\206\346\264L\366\\\226\315F\224"
+	.ascii	"\310i\031KvJ\237X,\026&8\242\357\373tK\313\320,K\"\322\262X\016"
+	.ascii	"3\312\242\304\341\303\207\017>*N\346\222\3744\216\302\032\326"
+	.ascii	"\f\030\303\372\364\311~\272d?\225\332O}\354\2475\366\237\257"
+	.ascii	"\204\251`\303F]\3269L,\003\257zt\251\313z\204\210g+\353\026\027"
+	.ascii	"\"p\252d*Q\336\314\240_\031,?\263\223\0064\335\023+\244\254\213"
+	.ascii	"/\326\260\346\027cX\363\024\021\317_A\0336\232\334e\215\367\274"
+	.ascii	"\272~l^\340`\311\232k"
+	.string	"7\321\235\211\312\372\031oG\311D\352D\251\373\263V\316\312R2\224\374$ce'\371*7\311[\030\232\243d%\317K2\223\353\347\373\032\221I\321\201\313Q\262\221|dh4'\007\261\242;\232\253\2123%G\311Cr\324^\022\275(y*S\315\311q\213\222\221\300\301z\337\367\303\007\016\037\234\030qC&\002\375\\\267}O\331m?\263\355g.\3739-S\211\345\335#\213\r\260\254\237\315v>\362\343\271\\\004\213\345\364\215\223\207#\353g,;\277X\303\372\374\334\317P\366\237\241\236\243\376\374\224\205`\261\034\365\276F\304'\264;\247\254q\231\210g\250<e\352(I\326\317W\033\277a\r+\005\030\303\212_ \036\204p\316\024m\375p\312qa\222\212\262\316<r\017\f\255 \373\370\210\022O\207\252\274^\357\373$\n\353H\251#'\353g\252}\\\301\212\367p\005\353\237w\350#M\316\272t\344"
+	.ascii	"\2169\362d$\353\234\343\317L\271)\343\b\3428P\312\254d\215\237"
+	.ascii	"X\303\312!/\341\300p\344\314m\311\372\3178\224\322\243\244\250"
+	.ascii	"W\354}\237;\302!ge\366\262\316I\034\200wQFa\262~\326\261\311"
+	.ascii	"\270`\261\241Q\3615R\002\006kJ\025,\246$\rY\027\264\350\373>"
+	.ascii	"\347\326\3404e`X\"\332t\225\2213A\211XT\3043\021\266\303y)\025"
+	.ascii	"\246\215\245LJ\364}\237\270\214\032\274\345U2V\207\331\244T\230"
+	.ascii	"LP2%\372\276\357\177L'\333\300r\362\215\214\224\207\362\213\347"
+	.ascii	"\340:\331(\323\310G\271\b\357\345\032y\006\206f\"\374\346X\017"
+	.ascii	"\303\271~\222\2019k\023cF\342\307n\231\bG1\233\241Q\361}\225"
+	.ascii	"x\225\311D\330\fN\223>\323|5\224\220E\2752\021\216\203\277\244"
+	.ascii	"\317\264]\243L.\372\276O\270L\204\3430\231!Q\3615\232+\303z\337"
+	.ascii	"\367x\354\307d\231\bg\301[\322g\332\373\026\351\202\200\"xhP"
+	.ascii	"z\357\373~\340\360\341\027\005\013\231\253\013\3641\334f\337"
+	.ascii	"\260\206\365s\3166v\203\3570\324\003\306{\022}g\334\b\021\313"
+	.ascii	"\372\370\312>\366\260\022=\254\307\317}\fe\037/a\363c:<\206\305"
+	.ascii	"r0m\016\215\036"
+	.ascii	"Y\037K\355\240\323\266\200i\037#m\234Fl\250\343\312\026\220\254"
+	.ascii	"\361\031\021\307hBPb\204+\353\024cX\217\2136\007\030\303\372"
+	.ascii	"\017\354?1\206\365\307on8\214\331\373\276\033\210xCbg\262\306"
+	.ascii	"cD\034\277\001 K\027-Y\263\030\303z\030\033\277\030\326\247a"
+	.ascii	"\f\353\225\033\257a/\030\232\001f{\022\263\022:cV\262>r\037g"
+	.ascii	"\260\246{{8\203\365,\366Q\330x\313\217\313\260\031V\303Q\357"
+	.ascii	"k\364\276\357\0066\007\027*jYc4\234\206\241\035\260\226\343/"
+	.ascii	"\fv\225\350\371>\355\252\212\232\262>\212\r\202\367\305\035V"
+	.ascii	"\274\267\207;\254\370KD\027\366\302\26029=_\261\367}\211i\332"
+	.ascii	"\032\2159Y\177\001"
+	.string	"\233\003\254a]1\254\177\303\032Vl\005\207a\350\273`,\307T\360\363>\243\347\033\366\276/\021#\3612\204$\353\227\330\033\210\336\022\027\356\030\357\373\276\370]Vvooo\017\277\313\372\2745\306\260Z\2005\254E\254a\315\030\303\372(\306\260\376\2115\254\033cX\267\232\220\301F>\f\374\373\313w\201\337W\201\354\341\037\252\307{\006\373\213\016\235\177\013\265\005\032\203\235\302\277U\370}\023\370\265\336)\376\355\200\337'\201_\263\277V\365\372\353\f~\375\323;\277&\300\2571\354\022~_Q{\320\037\256\202:\302\25758\007\277\320\213\226\016\370Z\020\003\246\272\260\262\255k+\027\027\017V\f6\227\032\201 \026\262p\333\252\271\252\235\370\205G\260\340&\246\2732\374\2057\232\234\303\356\300\357k\341_\257.\374\205\306\177ma\325Z\333\342b\341S\301\236\370\377\341\037\326\340\2007\f\213\274\264X\023x\303p"
+	.ascii	"\347\300\016+X\305\244\\[\371\357\345\277\235\377v\177\237\n"
+	.ascii	"\033\370H\350`\007\251O\242\250P\261.\252\227_esc\365~\374i\227"
+	.ascii	"2g|)d\371Y\006\370Px\361\247aXv\214U\313\013\377\346\302W\031"
+	.ascii	"P\260\235|\017\b\341\377\317?\224\301f\f6W\025_\212\177\035\373"
+	.ascii	"\261\321\261d1\\\273\304f\341\367\235\200\233>\0230\335/\370"
+	.ascii	"\207\351\277U`\024T\300\033\326\r|$\374k\006r\326\273\025\203"
+	.ascii	"\315\305\302\207\"\016\336z\325\344_?\254\\\352\334\3316\324"
+	.ascii	"1X\255\204\030\030A\027\177\326\213\352\202\352\263\2554\006"
+	.ascii	"=a\033\023\021\254l\333'\302\237\316\321\035\362\350\376U\215"
+	.ascii	"\326@\256\313\257\216`\023\360\373\032\360k\021~\214\344\307"
+	.ascii	"@~\374\364c\250\037O\375>\006\374i\220?m\362\247W\177*\245\036"
+	.ascii	"\340_\203\276\005\374\352\005\254\007\277/\204_e;\370}\n\370"
+	.ascii	"\365\233_\343\261#~_\002~M\343\327M\277F\372u\220_\377\370\365"
+	.ascii	"\323\257s\374Z\354\327\320\177\325>\020\376\024\205?E\221~\360"
+	.ascii	"\247!\244*\374\276\017R\023\177z\302\357C@\232B\252\342OA\370"
+	.ascii	"\323\025\177Z\302\237\236\370S\023R\022\376\224\205?=\300\237"
+	.ascii	"\206\320\\\277\336\372u\327\357\363@K\371\365\223_k\375\332\353"
+	.ascii	"g\017\360\263\033\370JT\261\006\370}\035\374\332\306\331\f~\037"
+	.ascii	"\211"
+	.string	"?W\240\177~\355\303\026\340\367\215Hc\374i\363O\205\264\361\327-|\"~\215\314T\331\353\317Z\027\3707\006~\037\007?>\362\343$)X\332\265\303\n\377\315\342\367\205\370W\255\325\313\007\302\267\301n\267\213\337w\200\177'\177\237\006\276\017\354\004l\207\337g\200\177O\300\347\341x\232\001*\034_\006\254\206\224\3051H\3170\370}\001\370}\023\374\254\211\177;y\360\263\030~\334\034f\360\373$H\341~_\2074\356\367q\370\267\360\337\303\337\267\341g\353\374\354\336\357\213\340O\337\376\324L\312\205\210\357\367\3734\374[\377[\365e\370\367\006\037\206_\275[\241~\037\317\237\216\375\351\225?-[\237\276Am\300\316\351\331\377\fV#\377\261l'6\351\313\025\310\b\277\260\304\277ba}\372\037bh\343\333Y\2019\304\331p'T\263\202\340+\376\353\212\255\265\231\370\210\332\202\037k-\200\343\255\036l\025\253"
+	.string	"|C8s2\300\n\320\003\360\tW\273\377\n\370\205f\376\355\301\007\374W\245\357\367\247\321\265\002>\337\237\266I\335\374\251\335\237\276\371S\274?\275\373S8\377\232\345_\317~\337\376\3238P\326\260\177\275\362\373\330\177\213\330#~\337\272B\001)\027|e\345?\210_X\343g\341|j\326\360g\f\177\376\375y\347\317\305?g\310\300?\017\363\006\254\367\343\274\037\277\301n~\214\267\"\321~\034\367\3433?~\373q\231\037\313\301\375\330\314\217\311\3748\215\232\365x\366\343\264\037g\321\362c\263\1775\202\375\330\n\256\362\343\347\217\275~L\345?\026\374\365\343)\370\312>r\013\370\264\002\016\201?\030\345\377^\206\303\326\261m\362\335\257\272\331t\330\350\317\272\371\367\034\272\237\305\373\267\234\214%\213\321\311\320\034\226\257d*\277\332f\307\311R~\225\315\206\203\325\255\367\263s\377~\363\347"
+	.string	"\374*\335\316\373q~\235c\311\034r\207c\300\201E\017\341U\374\301\266\037\243\360c\025\224?\366\371q\013#>\2015\340\342\307=?N\376j\232\215\207w\f\204t\037\361\0071\360\343\024>\250\370\325\t\354\273\023\030\005\006,\326\f\202+\374\307\333\022\374{\202\177S\360o7"
+	.string	"\370\267V\325\2179L\375\270)La\314>\261Q\374\333\016\033\3556\377*F8E\315\257*\327\271\177\203\335\245sV:B9j\377\346\332\t\370\267Vs\177\375\253\226\377\031~a\221\037o\340\302\256\377\367?\024\376+\006\233\213\365\362\263l\377\226\362\257+\374\352\003\366\326\261\354(\377Y\254,4\374A$\254\225u\305\326b\307~\226\354\337Np\326\n\201\235\265\233l+\026\212\235\274\303\037$r,\254\324\016\3022\271b\237\250$\320P\300?\370\203@\377f\302\366\3707\025&\361\001\226\021\257\303"
+	.string	"\001\t\330S?\013\265\217`\005\\\304\037$!\213\301E8\004?\366\300\007~\f\202\241,'\267"
+	.ascii	"\213\f^w\001\374\301\366o\034\266\221\237\335\272\026v\311\317"
+	.ascii	"2\371w\021\366\t\013\345\337RX\343\340Y`\002<\305\037\324\241"
+	.ascii	"\205\347X\326\016/\376A\022\253\t+\212M\344g\201\374l\220\177"
+	.ascii	"G\375\337\273\234\377o\377\351\3748\375\261\372\177\316\217}"
+	.ascii	"?\376\375\217\363_\355\307\373g\333P?N\262\207\260\317\237\245"
+	.ascii	"\362o!?f\377\243\371Y\242\375\224\353\374\254\324\317\026\371"
+	.ascii	"w\220\037\257\232\245\372\331\252\177\003\301&\326\t^\201\377"
+	.ascii	"\026\370O\301\376q\016j\003\212\266\323\217E\3701\207\335\343"
+	.ascii	"?\336Y\370\203B\377\032\202\275\343?\336\326\361?\003\334d\372"
+	.ascii	"\017\374\205\002Xq\244^\352\334\232$\347O\237\376u\270s\374)"
+	.ascii	"\363\337M\177\252\3747\323\257\312\331K?\253\367\037o\343\370"
+	.ascii	"\323\rR\021\177\252\200?\035\261\322\310t\376\224\313\277\026"
+	.ascii	"m\245\237-\356\244c\360\247\306?m\341\031\374\247`}I\374B\374"
+	.ascii	"\253o\376\265\355\3377\376t\016n\372~\365\211\215_\315\361\b"
+	.ascii	"~ \320F\372U\244\243_m\326\370\316\017\\\372\372\325\347\257"
+	.ascii	"z\375*\225_\235\362\253W\200R~u\215\306\257\3168\373\325\264"
+	.ascii	"_5\373U-\277\232e\3178\317\017\274\372\3252\3776\332E\277\n\201"
+	.ascii	"\023\210~\225I\275\372U&\277\212\344W\255~U\311\257b\375\352"
+	.ascii	"\222=t\t~`\331\277\016\371\367\273C\260A\360\2536\376\375\201"
+	.ascii	"\373~a\003~\226"
+	.string	"\001\377\361?\f\301\237\202\375)\327\237z\375\351\224?\355\372\331\025>$\362\263\314\237m\376,\007~v\371\263\312\237\r\372Y\227\205\361\357\n\374\254\013?\233\334\035\370O\374\207s\377~\341\3371\376\375\342\337\356\277\203\376\275\374\267\362\337\033\370\267\213\177c\340\337\024\3707\213\177\263\360o\025\377V\341\337\016\370w\t\377F\361\357\004\374\373\203\177{\360\357\021\3776\300\277\001\360o\n\376\315\341\337\303\177\377\376\275\376\354\336\317\312\371Y8?\213\367\263n~\266\315\317\326\375\354\334\317\306\375,\333\317\222\375\354\225\237\265\362\263T~\226\353g\267~\026\312\317^\375,\223\237\255\372\331\"?\033\344g{\374l\321\317\202\340g=\360\263/\374,\214\237\025\372Y\025?{\342gM\374l\003~6\204\237M\300\317~\360\263\036\374l\007?;\342g9\370Y\020?k\200\237\315\340g\013\360\263\003\370\331"
+	.ascii	"\374l\005?;\301\317v\370\331\r?\253\341g1\374\354\316\317\016"
+	.ascii	"\177\026\377\253\334\317\372\376\225\316\317\256?\253\1776\377"
+	.ascii	"k\235\177\215\363\257z\377\232\367\257w\377j\367\257s\377*\346"
+	.ascii	"_\311\374\353\230\177\325\362\257m\377\312\366\257k\377\312\345"
+	.ascii	"_\325\376\365\354_\255\374\353\330\277b\371\327+\377\352\365"
+	.ascii	"\257\\\377\272\365\257P\376\325\352_\265\376\265\311\277^\375"
+	.ascii	"\253\222\177\255\372\327\251\1775\362\257D\376\025\352_\237\376"
+	.ascii	"\025\310\2772\375+\216\177M\372W\033\377z\364\2574\376\325\350"
+	.ascii	"_\337\177\365\300\277v\340_e\374k\214\177\205\361\257/\376\325"
+	.ascii	"\375\327\346\277\006\375+\363_\227\377\n\364\257\355\277\"\377"
+	.ascii	"\365\370\257\306\177\305\300\277Z\340_[\370W\026\377\n\201\177"
+	.ascii	"U\361\257)\376\325\204\177%\341_E\370W\006\374k\b\377\232\200"
+	.ascii	"\177\365\340_;\370\327\021\377\312\301\277\202\370\327\017\377"
+	.ascii	"\352\341_3\370W\002\374\353\005\377:\301\277v\370\327\235\177"
+	.ascii	"-\376\353\360_\203\377\372\373\327\375\257\353\277\352?\205\300"
+	.ascii	"\257\277\3765\377\353\177\265\316\257\322\371U9\277n\361\253"
+	.ascii	"p\376\324\356\327\037~\365\315\237\302\371\325\274_\275\373S"
+	.ascii	"3\177j\345O\311\376\277\375\252\233?c\371\217\346\317a\277\332"
+	.ascii	"\346W\331\374*\335\2379\374y\370\343\273\037\243\371\261\331"
+	.ascii	"\217\247\374W\341W\347~U\356\307Y\277\232\346\307\301_\235\300"
+	.ascii	"\177\266\037\237\370\217\345\307\t\370\257\345\307;\277Z\346"
+	.ascii	"W\317\374\252\231_m\373\3250\277\352\366\253h\277\332\345W\327"
+	.ascii	"~\225\355W\275\374*\364W\305~\025\313\257&\371S.\277\252\365"
+	.ascii	"\253O~5\312\257B\371\325 \277\n\344W\235~5\307\2572\375\352\322"
+	.ascii	"\257\342\370U\033\277\212\364\353\021\277Z\343Wg\374*\321\257"
+	.ascii	"\206\340W_\370U\030\277\332\374\325\345\257*\177\325\205_\375"
+	.ascii	"\371\325\023~\325\370\253\027\370U\n\374j\004~u\305\257B\340"
+	.ascii	"WU\370U\024~\365\001?\346\340\307 "
+	.string	"~<\342\307!~\334\301\217\t\360\343\022\377\353~,\342\307\001\3701\211\037c\360c\272\037o\370\325\024\277J\302\217\233\277z\342\377\362\307W\277*\302\177\274\377,~u\001\277\212\200_%\361\253 ~5\203_-\376\032\316\257\315~\r\366k$\277\036\362\353\r\374\032\371\353\t\374\272\204_s\360\353\020\277\006\361\353\r~}\200_k\360\247t\3764\316\237\242\371\3233\177\332\345O\267\374)\332\237\232\375)\364O\237\177\252\365\247/\374\251\214?\225\300\237\262\370\323\b\374\351\377\f\347\317z\177\026\3733\364\317W\376l\345\317S\376l\301\237;\374y\303\217\341\374x\356\307j?\276\362c'?\306\372\237\302\217\225\374\270\306\217i\374x\306\217\215~\\\364c\242\037\003\375x\305\217\205?f\341\307\020\3701\212\037\233\370\277\342\307\n\370q\207\037s\3701\206\037\363\374x\370\343\016\374o\373\357\301\336\336\336\336O"
+	.ascii	"\261\237\0039\377\325\016Z\003\235\003\337\377W\347\267\227\231"
+	.ascii	"(%!\313\032\247a\r\253\004sD\374G\007\255k\214\221\254;\300\371"
+	.ascii	"O\316\377\273\373\305\201\252R\305)k\314\2045\254\2776\"\376"
+	.ascii	"\203\323$\345\n\031\336\177z\377/\357\367\206\307+E#k\354\204"
+	.ascii	"5\254\0300\206\365w'\342?<\337X\234)/Y\363D\377s\363\377\332"
+	.ascii	"\374\354\206oP\240\234\311\032\037a\r\353\016\306\260b7\021\377"
+	.ascii	"E\177g\321\256\245\272\377\330\374+\025\253#\t\017\035c\262\306"
+	.ascii	"]\"\376\253#\306\241\341Y\321Mu))\321\312\372?5\3707\207\241"
+	.ascii	"\2779\234\207\2316\031\2230\321\017\336\354c\234\267\376?2d~"
+	.ascii	"i\264Q\2257\007\220\t\233\223\006Z)J\024\251\254\321`6'k\342"
+	.ascii	"\262\376\007r\373\377\317\f\206\376\316\374\340\304~g~q\2772"
+	.ascii	"F\330V\266\245\2514\"\033\037T;\364\257L^V\232Bs\224\365?(\333"
+	.ascii	"\377\340k\377\003$\2771\303\274\033x^\262"
+	.string	"\376\007;~b\332~nQ@\254\020e\375\017\222\366\257\355\347\345\030\372\363\362\373\342\201\215\325\217\255\214\023\222(Y\037\001p\366\021P\327\245Kv\302\305\267\210M\026,/\373\377a\350oKv\302\317w\351\267d\226\246\301\021\360\334\377/\355?\265\377\247e\355\321\366%NN\326D\214aM\225D\374\227\266\367\366\266 9\373\017\355)\226\006\316\302\\\231\312\032S\021\361\337\2316\222\267\224\225\365/K\212ud\210\034T\031\364W\226:Y\231|KKWQ-\262\261 \225%\035ZX\376\033\373\177b,\323\210$$TY\0031\206u\247\211\370\017\313\221\034\256+\030\372\273\222\273Nx\276CC\264\255\2455\275\227\211I\203# \311\246\363t\032\222\265\225_\225_\217\242\2427\353# \310\206\2665A\373=\177`Z=\236\362\262>\002\212\366\377\373\372M\331;\262E\204\353\277)\377\257\353\347\225bi"
+	.ascii	"\314\212\214\226\2545\032\306\260\376\244\210\370\217K\005\202"
+	.ascii	"\264\267#\353\237mE\t\272\233\"\227\365\377\203\362_\224\024"
+	.ascii	"K\003\231\016\310W\222\254\177OD\374\007e(eH\210U\326\025\374"
+	.ascii	"\264~YF\264@\021\223\365/\353\207\205\363\232@\260\303\361\346"
+	.ascii	"\347\004C\177Y\277&\0378\b\213D!\221i}\017\326\366=\200\356\377"
+	.ascii	"w\365\263J\313\320\2468\375\226\374\230`\350\317\352\247\204"
+	.ascii	"D\022\264\022?\253\037\022\026+\3305\245\213\215U\337\203(\373"
+	.ascii	"\036\020\331\367`\251jj\250ei*/\353\223\230\372\005\301j\370"
+	.ascii	"\255J\004.\267\350\357\310o\310\317\310O\352\007\365#\362\213"
+	.ascii	"\372\025\371\t\371Qa\350o\352\367\364\233\372\345\320yu\321\035"
+	.ascii	"\351\032\257\037c\260x\314a\371P\243\303)\rV\217,\2075\365\323"
+	.ascii	"\221\322E\177S? Z\t\360\006\034\234\226\236\360\207\024!e\"\320"
+	.ascii	"/\261\267_\202\315~\t3\373%\330\366K\230\355\227\230\262_\202"
+	.ascii	"\311~\211!\373%r\354\227\230\261\337\001\235\375\377\232~Il\250"
+	.ascii	"\312\f\311\372*\2309m\321\241\263\347\357E\033\223\343\026\375"
+	.ascii	")\375\230~5~G\277\033?\034\277\245\237\215\037\215\037\022\206"
+	.ascii	"\376\222~3\366\300\210R\022F\276:_\242\277$\037\0350\321_\322"
+	.ascii	"\257\250\n\2334\275\367}\022\315\250\231K\212@\277\203\271\375"
+	.ascii	"\016\304\354wp\266\337\001\225\375\016\232\354w\020\265\337A"
+	.ascii	"\216\375\016\336}\022m\366I\230\331'\361e\377>\237\233U\213\222"
+	.ascii	":\2703\337\030\374V\365\022\351 \200\023\242/.=/7>6j_\\z>7\276"
+	.ascii	"7_"
+	.ascii	"\235\216\0034\261s\343ks#\352\306\027\255\362\305\245\347s\243"
+	.ascii	"\247\232\300}q\351\301\361\275\361\335\371\364|x\276<\f\365\271"
+	.ascii	"\361\331\255rsvPC}\022V\366Il\355\223\260\332'Ad\323\255Vf\342"
+	.ascii	"t\311\372$nl5\237\032\374V\245\353\260E\327\370\3440\3247\347"
+	.ascii	"#\343\233\363\241\341-C\365}\211\320\260\200PF\232\220V\235\306"
+	.ascii	"(\325\373\222V\226\365G\2641\023Wv\306\207\306W\006C}f|pf|[\260"
+	.ascii	"Z\211\0348\240\254\251yQ8m\266\376\b\264\375\021N\366G\b\331"
+	.ascii	"\037\301CL\207`\333\031\2627\353\217\030\332n\2766\f\365\205"
+	.ascii	"\361iQ\363\201\301oU(\342\324\211\276\357\033\306\207\346K\033"
+	.ascii	"\252\357+E\007\353g\227\004\310\252\277p\020RE=\201\312\372\""
+	.ascii	"\324\354c\260.X\r\016\233o\rC}^|\\\274\370\266\260WD_\\z)\234"
+	.ascii	"\2600\321U_D\334\276\b\264}\021d\373\"\254\354\213\270\332\276"
+	.ascii	"\2640\035oj~d}\021J\366E8\355\337\227\305g\006\274\322\245\304"
+	.ascii	"\214\257\314G\346\023\363\215\371\260`\250\317\314\007=\253%"
+	.ascii	"\347\035SY\305\340\240\312\323\253b\025\266\004\313\212\317\314"
+	.ascii	"we\r\007U\336\326\373>9\220AAC$\250\317A\232}\016\306\354s\240"
+	.ascii	"\266\317\301s\237\003%\373\034\364\330\277\357\351\003\213\222"
+	.ascii	"\302\312\372+\327\200*\333\222\3659 \332'\221%\206uU\206\265"
+	.ascii	"\304\307\004\2779i\256,Q6\337\226O\013\315\267\345\263\3621\031"
+	.ascii	"\246\357Kd\206\345\343\362A\361u\371\244\370\274|Q|O|S0\324\267"
+	.ascii	"\345s\222\261\306\224\210\360m\371\232d\247\034Ju\342l\275\357"
+	.ascii	"S\210\345\306\017$<\372!\316\366Cp\355\207\310\332\017\201d?"
+	.ascii	"\304\220\375\020=\366C,m\037\223g\247\346\325\017h\326\017\201"
+	.ascii	"\264\017bo\377\276$\276\251\242(.9Y\237D\221\271\350\224\217"
+	.ascii	"\b]\t\251\354\264\346\210\257\312"
+	.string	"G\345C\202\241\276)\237\221\347)_\324\2248(wjY\220\027\307O\037\204\233}\020d\366A@\367A\034\331\0071\264\177\037\224O\351-l\312\227\254\367\335~\363\204\b\234\223\236\b\337\220\223!08CO\237\221\222\357\315NMpN[Lt\236\260\350\244D\355\226D\361\334^\023\205\b\234\223\236O\3117\243\t\0258'=77M\340\234\364\210\332\3009\351\351!as5\327\346\211\0268'=V\307\036\t\"pN[\273Nv\023\004\313\327\303\347\344C\3625\371\222|L>\037\276\035\276!\276\034\276'_\r\237\r\337\221\357\207\017\207o\311\007\304'\304\247\303w\303\027\304\307\003C}J>\032sQ\254V\202\f\234\323\226O\311WD\006\316IO\316\\]\321\326\034\237\322\216\343\244\r\\\360\306\227\226'\016\3647\270\333\337@\315\376\006b\373\033l\355op\265\277\301\323\376\0067\366\017@g\377"
+	.string	"u\373\007\200\333?"
+	.string	"\332\376\001\270\366\017@d\377"
+	.string	"I\373\032\270\331y\271L\335\013\225\3655\030\263\3614\320\262\257\201\225}\r\236\354k@\265\257\201\217}\r\216\366?\344\355\177(\263\377\201\313\376\367\334\226\373a\275ho[\315N\203\241[n\243\t3\203\325\226\260\344\366\031\254\366\244\344\304m\313\002mk\340\254\372\037\204\354\177\360\261\377\201i\377\273\314\216\233\341e\227&k\270\247\321\215\036r\350d}\003\274\331/\001\006\n\253m\310\026\263\311\3547\f\335c\266\333\230\035&M\311\312nK\031fEd\353\033 l\337"
+	.string	"J\366\r@d\337"
+	.ascii	":\366\277\277l-P7\037e7\262\354\221)E\305~D\315\220\242[\313"
+	.ascii	">\243\023\335Z\366Xv\032\242De\267\325e\253\355\265\315\266\271"
+	.ascii	"l/{\013\206n-\033\355;M\005\223\346\201\251E\213\372\2071\254"
+	.ascii	"\367@\267\357!\315\276\007\270}\017b\366=\260\355{H\333\367 "
+	.string	"\266\357\201\312\3767\226\375\305\204T'J\326'\321E\206\365\204-\312Y\316\203\202\266\225\005K\212Yt\177\355\254\355\004\2779i-0Q\2562\254\347\236\262\257l+;lW\331T6\330\206b\350\376\332^x\177m\255,\245\"Y`vX\331\313\240\357\001\310\276\007\033\373\031\350\355g@\267\237A\230\375\f\260\354g e?\003\251\375\ft\354\355$\305\322\300\221\221\224V\326\317\240h\377\273\tS&B&n\016\326v\332q\205e\306\225\2338h\266,\311zG\265\3611\303-\353c\350fB\002\224 s{\311VR\205\227\245J\326I4\024\226]\264nj\363\330@R*L\033\315\214StO\261{\373FJ\205\251\205#@\242O\333HJ\205\311\247cF\220\350\373\276T\273j\037\331H0tO\355 {j'\355\035)\025&_\216#?\242\035>\340:!ox\374t\021\265\313\212\023T\326\307"
+	.string	"m\237\204\220#H;jC\355H\202s\333\"\262\2450tG\355!B:Q\275\034\253>\006V\36610\262\217\201\217}\f\220\366\013p\367#\214x\004kk)\353\027"
+	.string	"\214\017\f\335N\273\207\023\266S\203\305\026\271\322\224E\353\027\340\271_\200([\207oH\256\r,\353\027 \310>\t%\23474*\276FE\350\2606\323^\262\262\233v\016\f\335L\033\307*\344\f\0304\253~\001\232\366\t\200\267O"
+	.string	"6\373\004(cC%\243\243\204M\326'\300s\377\33756\215}\264g`\350F\332ECG\243"
+	.string	"\351}\331\202\260yF\331\r\005E\357;\344\007\033'\t\316m#\355w#m\",F\001\322\373J\ta\357\222\340\334\364\336\367\345P\247\325\346\306O\237"
+	.string	"I\373\003H\263?\2001\373\003\320\262?\200\257\375\001(\331?[\207\316\331\320\220\246\254Y:\354\034\337\027()>\262\376"
+	.string	"\204\354\237\225\023\207\211\2227\243\254\341\254_\240\304\310\262\376"
+	.string	"\224\366s\236\232\253;V\217\315c\3610\224}\303\316\235]\303\322=\337\260r)V\372\304b\241Y\254\242\354\033m\224\205\211\327\033\266\216u\203\337\304T\272\256h\n\305b\006\345\247\377\263vl\033\fe\335\234u\303\262\311])\025&\025\350\270X7l4+\021\231Hy;|\370\300>\327\270\254\255\372\0038\332\037\300\214\375\013\366\366/\nkX\261\021\214a\375\005l\366/\220\333\277 n\377l\032\016ss\302\210a\321\260g\234\324)\252\222\265\231\247\231\036\024\227\032Y\377\202\261}\354\345\205m\233q#\372\276\357Y\035\277\b8V\f\373\026\307\226a\311`(\013\307\206a\341X7\026\355\b\322\322\332\246\353*\252\261\365\317\2169\373\366\217(\341\325\345\265k\313Z\204\210\263c0\230\034*^\262\376\005W\366/P\262\177\301\324f\331\330/\030\312\201\005\003W\204\343)\353_"
+	.ascii	"\265C\360b\016\353\3670\207\365\0270\355\237]c\273\2446\246\334"
+	.ascii	"\241--)\211\342\262\305\027eG\2321jg\267\234E\013F\tkd!2\312"
+	.ascii	"\232\325\"\342\254Z\232&-<\262V\3314\026-\r\226\0207\026\215"
+	.ascii	"=\353\3321\265\344\351\365\276/\321\247E\316\023\036Y\377l\026"
+	.ascii	"\266\214\235\362e\rL\214\r\303ob$\320\351EY3\226\fC\331\262\227"
+	.ascii	"\261c8/K\232\350\234\022\267\255U\377\002\243\375\013\210\366"
+	.ascii	"\317ba\303\312\374@\242#k+\357\302\244.\312\206\261Up\336/\013"
+	.ascii	"\033\366\n\013\305P6\354\317\367\303\207\016@1U\270\364V}\001"
+	.ascii	"\274"
+	.string	"\331\027"
+	.string	"\335\376Y*,\0304\316\314V\326\307fP\324D\237l\027;\205\375b\2750\224\005c\2712\230F\023\2635\206\005c\245\204a\301\330(%\322\222\2540\030\263\266\026\324\027\200\327\276"
+	.string	"\264\366\005\200d_"
+	.string	"F\366\005\020d\377\354\2232sK\322\262>\366\2421c\211\275b\227p\236\225:\321uo\b\226\033\216=,\022Cf\236\330!\254\022\026\t\233\305V\261Xl\022\266\bK\204e\302j\261Vl\020V\b\273\204=\302N\261Pl\023\326\tk\204\245b\243\330'V\nC\331+\326\351\354\017\026\3105\233\0328\242n\354\f\247\250\215\033ft\256 !\n2\267\326\251\212\316\275Br\310\301JB\302\272a\003\213\251i\016[\004\004\353}\237\354\025\333\203\365\221>\261|5\212\350E\331+\326\350\312\217(\253cG\034\254\367}\262J\351\321:'\tR\022\026\0178X\354\025{\224\235~@\222\222\f\331z\337'\007\026\216\224!<:\320\371\rkX\017\2001\254\267`\316f}d\326\311\036\016\273\254oA\336\276\005e\366-P\333\027\303\262oA\224}6\254a\275\005L\366-\340\261\037\200\273\375"
+	.string	"\264\355\007`l?"
+	.string	"L\366\003\020\265\037"
+	.string	"\036\373\001@\332\017@\321>"
+	.string	"\342\354\003\240\315>"
+	.string	"\310\354\003`l\037"
+	.string	"M\366\0010d\037"
+	.ascii	"3\366+\200\263_\001\335~\005a\344\274\305\321\033\201\243\206"
+	.ascii	"]\326/\241\206\353+\332f\255[\331\254w\253\335\372f\215\256t"
+	.ascii	"+\336\272fu\263\302Y\3630t\325[\347\364\252\267\2129\223\233"
+	.ascii	"\202\365<\203D\307\\\035=\267\"\"\322P\271\001\013\243D\207\331"
+	.ascii	"\227\270\2611+\334pl\313\263-;\r\323\367\035\202\335\300(\261"
+	.ascii	"2WGo\325[\343V3\370M\f\305\035Y\332\244\267\242I\325\024\315"
+	.ascii	"\325\331\362!\r\251\203E\201~\005W\373\025<\355W\200\264O\201"
+	.ascii	"\335>\005l\373\024\220yY\313\b\337|\250!\313\372\024<\331\247"
+	.ascii	"@j%\243tw\004J\326\247@i\277M\020g\177\002\271\375\t\334\366"
+	.ascii	"'\300\262?A\222\375\t\202\354OPc\377+\233\027\325\n\030.\242"
+	.ascii	"\254W/kk\027\342\335\225\037_\326.\253\332\215\257\244%Y?\263"
+	.ascii	"\031\202\004\013\252\252l\245\262v\255d\253\331je\335Z\301\326"
+	.ascii	"\257\025\312*e\235\262\242\255"
+	.string	"U\326\261\365lM[\237k\224U\313\312\265fY\257\254\\\326-+\2265l\205\256b\253\027\206\256j\253\326q\333\372\004\317\001a\302C\nV\231&0\260\035sOJ\260\031\022Z\224\250\r\356\210-\252\303\255\310S\024\224\224\020!I\346\210\f\301z\3328\313Q\004f\355\341c+\232d\206\245T\206\305$\026U[\247V'\351\023\313\204\" Q\257Um5Zk\244T\230\366Y\321\027<\026d\311\022\334\215,Q<\267\252\255NV\321\367}\256j+\016\262h\331\016\036Z\030\240U\t\342\354\325\311\277\032Y\217\254Y\032(\342\246HK\326M|\\j\266H\311\372\022\270\331/\201D\tk\265Z\261V&\030\272^\255J\216\317\244M\307`K\342p\\\255I\262S\007M\254@\271\363\2359B\306n\353K\300\266/\201\226}\t\320\366%\310\262W*\021_\253\200F;\310\254\262\366\215m\034\305\032V"
+	.string	"`\f\353%\370\332\227\240\311\276\004R\373\022,\355w\240\263\337\301\314~\207/\373\035\310\366;@\331\357pd?\r\326\260\276\003\217\375\016C\373zX\303z\016i\3669h\331\347\340\265\317\001\311>\007\036\373\034\212\3667\334\355o\210\333\337\240\266\277A\312\376\006\253\375\rR\373\033\224\366#\200\263\322"
+	.ascii	"\2161\213\303\221\365#8\263\316\210\300\313~\004X\366#X\207\326"
+	.ascii	"\327\210\234%(uO\255\203\241\353\253\322y\312a\222\223\245\267"
+	.ascii	"\276\352\234\354\204\200WN\326VW\232'IV\375\b\254\366#0\262\037"
+	.ascii	"\001\323\376\3258\307d\310\354\345(\203\223\267\304\355\251\225"
+	.ascii	"5\031\035\\\236Z\206\305\326`\351\251oT<\365\016C\325<\265\315"
+	.ascii	"U;\325\r\\\036\346\202\305\360\233\030\n\256\271\250\232\227"
+	.ascii	"\342P\243C,\235\024\2334=\"\032\226\034\330O\253l\030\303z\r"
+	.ascii	"j6\033=\006e\304(\353k"
+	.string	"\030\263\347\3240z\r\005EGZ\315+\372\276/\234\030\325L\231\n\246\r\177\031\252\357\033\365\205E\247\252Q\323\250gT4\352\032UN\255\303PuNE\273j\246f\361R\347T7\021\274\246\234\221\225\3612\206\365E]\003\303\232S\331\324\265\237\032\24290z\357\373$\356-\251\362\342\321qj\031\2702LW\362\262\276\206\25088!\2266 Dd\256\302\345\321\230C\226\265\372\226\216\2413E4\346\277O\370\205\205fm\314\025\216+\274\254\257\241\307\276\206\245}\r4\3663\320\331O\303\032\326g\270\333\317@\267\237\241\214\332\005gM\211\342\221\3653\254\251\\\324-;\211\224\022%\252\332\325-\024\340P\322\225\365\361T-\377}\277\274\034Up\264\244\34192e\364\322T4,DDEY?\203\331~\206+[?\261\206\365b\030\303\372\fO\3663T\355_\035S\3056\330\302d*\253b_\315"
+	.ascii	"1\233\302\202\323\274pr\372R\241\352\225\032Pac\262V\257\034"
+	.ascii	"\r\t\217N\234\254\1775\214\312W\030+fY\253TT\2603,*8\213\032"
+	.ascii	"58-\275\367}\255\250U0T\245\242>5\007\341\224&\2665\253~\006"
+	.ascii	"\243}\f\321\375\253_jW\224\007\026\245\254\325\256\024\207\372"
+	.ascii	"\204h\f\326\373\276S\272t\021\234\207\337\304Px\245\211\252R"
+	.ascii	"T.\325K\235\202\241j\227\n\345j\024uK\355\302j\364\217\241\321"
+	.ascii	"\363\035Z\351r|q\345 j\227\226\222\372\342\322{\337'\b4\320\204"
+	.ascii	"\375\364~b\r+>\302\030\326c\300\262U\255\340\0232Po\262>\206"
+	.ascii	"\257\335\266Ds\3417\261*\\Q=lv$\305\362 \205\210+\2527\227\247"
+	.ascii	"\345|@\203\311\207\303\312\225j\245\247\3505\037\320`r@\021)"
+	.ascii	"\321\367}\333T+\335\205\267\340\267\252\367m\352 J\026W\024\211"
+	.ascii	"\232\2452Q\225\250KT'\352\225Z\245b\251Tj\0235\t\206\252V\272"
+	.ascii	"\356x\2126r\0169o\312\216+\252G\246Z\351*\255$\007\007Q\324F"
+	.ascii	"\224P\2554Uv\203\337\234\336\2416\004\210\002g\245\347\250F("
+	.ascii	"(:z\337\034\035<Q\343\212\352a2\365\210:\205\337\234^\242\241"
+	.ascii	"\016\244\344\340\212\352\265\251V\332\253\214\225\246\323xE<"
+	.ascii	"D!\342\212\246es\210@\221@\377\331\312\325\251g'\r\274\033v\300"
+	.ascii	"0Ae}\fM[-\322\201h\204\212\310L\326\3070\2645\035\365M\237X%"
+	.ascii	"\024\341\210B\251Rj\024\206\252D\214T\"\352\220\312\343\003\032"
+	.ascii	"L+\024)E\211\250C\356FA\321\321KD\204\203&q\240x\351ih\325\027"
+	.ascii	"\250\255\317\003\335\307fJ\035\360[\225\bYe\317\034R\242*\017"
+	.ascii	"\225HM\242\240\350\b\0056\263\350\322\273\f}\357+%\206\345\325"
+	.ascii	"\304\344\001\277\211\241H\363Ry\250:\266\236*\017\025G\207\025"
+	.ascii	"I\222\2545=5\210*D\355\241\002Q\235\324\037\352\223\352\003C"
+	.ascii	"U\036\352\216\017*\364\212\236\034\036}\236\241\375\2358\373"
+	.ascii	";v\373;r\373;d\366w\300\354\357\250\355\357\210\3350\033b\003"
+	.ascii	"\267\224\365w\242\354\377\352\221\212\204\241\252\r\325\250H"
+	.ascii	"\245a\204\016K\265\241\326Pi\3407\247\347\233\203\207"
+	.string	"N\216*\216^z6wwe\325/\346\355_\245\241\316"
+	.ascii	"\326\231\"\244\216:C5\032~]%\031\311\372E1\373E/\373\305\264"
+	.ascii	"\375\342\330\376\365\336\325\367)\226:\206\324V#k]G\304\365\336"
+	.ascii	"\214\252\244\034Yg\2001\254/V\331/N\201\243\343\350m&f\236\270"
+	.ascii	"T\301\321zbo\232\254\265\336\353V\271\241\2658D\364\235\335\234"
+	.ascii	"\036Z\256\262~1i\037C\265\033m\227E\013\311\254\315\265\335?"
+	.ascii	"\242Dv\023|)\b\306q\023\263#\353\343\351\350\177\337\360\314"
+	.ascii	"\027\332\226(\233\241\022\334+\305F\327\371\362\322\320\351\312"
+	.ascii	"\372\305\242}\342\234\271<7\305\0074\353\023\243\373\277N\243"
+	.ascii	"\325`\250\226\323U8\310\351/M\005\277\211\241\370\032\223\323"
+	.ascii	"V\364\031\374\346T|\215\352\344\242\357\373r\370\360\001C\327"
+	.ascii	"\352\330\255\332\213\216\373\202eF\227\321h0T\237\271>\243\303"
+	.ascii	"t\226\341\320\316\373N\251\301:\243\317t\027\374&v\002\2240\321"
+	.ascii	"\367}?t\370\360\001\230tD\310\320\326d4\034\206\3528\375\326"
+	.ascii	"\246\307PPtt\302\235Y\234f\323`((::\201\013[toI\302\005\311\252"
+	.ascii	"O,\263\177=F\f\022\232\0234n:\314\217\207\323\033\227\254Od\333"
+	.ascii	"n\3078\232"
+	.string	"\314h\313\372D\264}\f=\235\376\362:%n=\246d}\"\331>\321\312>\021\254\213F\323j\370M\f\205\230\266\350\373\276\\\364\032\206\352.zK\027}%;\3417\247\020\300\270E\207WN\272\246\254\372D'[G1\302\022&k\255E\247\275Ba\235\220.ZY\237\210d\237(\265O\034\262\313\264\031\206\352,\232\214\303\363}\315t\026\r\325c\024\024\035\245\0302&\213\276\222\235\200L\206\3428\351\275\357\223\303\207\017\254\0215\260$\253\376\320\315\376\365\230\026\373q\224e\316\363\365\342T\206I\326\3771Tc\321U\236\357\373\312\331x\353\262\376p\315\376\260\314\376\260m\177\250\266?\204n0\375\304\"\365\265\225\365\207^`C\255\375!\326\376\020\311\376PjK\341@\324!\004\313Q\326\037*\355\223`\242\261R*L\233\214\252*\nEoa\250\216\242\233\210\275\357\033Eg\351'\370M\354%\322A"
+	.ascii	"\274&6=\204dzrz\254\332\211\326\"\336`RC\t\232\223\260}\341\225"
+	.ascii	"\225\276\3129\256$\021\026\261\022>\355\013\221t\022\034\227"
+	.ascii	"\027\007)\353\007\343h$\327U\242\204)Q\2170hY?\330f?\210f?\b"
+	.ascii	"f?\230e\263A)\373A\250\375k\"\032\n\33067\327DC\351 \372\007"
+	.ascii	"~\023\323P\306Du\224\036\202\241\032J\013\201\322O8\257\214\f"
+	.ascii	"\234\023\207\017\351\021\031+MV} \235}`\335>\320\314\3765\220"
+	.ascii	"\037_J?\216\262\326?\216\226\307\264\031\242\227\365\257\235"
+	.ascii	"\364R\025\247\255)M#I\2156_O[\372\245\362\365\244\3475\243\t"
+	.ascii	"\211\"l\346Y'\335\233\3425'\255\033\032!\r}=\351\033\232I\333"
+	.ascii	"\3209t\223\346\241\223\264\222\326\241q\350\035\332\207\356\201"
+	.ascii	"\241zI\037\035\227\321HF\357\202\337\304^}\204\314\327\323V\211"
+	.ascii	"\037\273\351%M\224\335\324m\271\351\241\25619cQ\275\224\0065"
+	.ascii	"\212m\305\266b\0307\037`YU\264 e\025\335^\f\203ip\211\325\261"
+	.ascii	"@\227\265\265\342\027&\337\217\033YN\330^\374\002\327u'$\353"
+	.ascii	"\242\027\026\255\310X\026&\013x\025\271\024\271\fq\210\351q&"
+	.ascii	"\013\bD\f\2317Y\337\002[E\265\242Z\021\212\335\322TZ\334\224"
+	.ascii	"\215\033Y\337\002SiiA*\256\035sY[\231\rN\035\222\254o\201\034"
+	.ascii	"E\263\242Y\361\254\f\204#wn\262\274xVG\366:-\231#&V$s\303\312"
+	.ascii	"R\273\233S\034{\221\254.{\205\225Qz\005\324@\241A\256\016;\202"
+	.ascii	"{ee\232d\375\nh)z\025\275\212aP\354\020\037N\354\302Di\261Q\374"
+	.ascii	"z1\314\212\346R\244\006g\245\n\033\2166%YS\321"
+	.string	"@\312\270|\311\372\025X\262\213\317\"Xp\310\021 h\262~\005\240vq\n\376R\006\215W\325[\0262\320,Y\277\0026v\221\253\310\245\341\213xW\007\214\227\254O\2017\305\255\342\326\020)\317\207U\035=\025)G\2167Y\237\002X\212ZE\255\"\024\\\345]\372\345X\232J\333R\322\003-\356\311\213P\210EO\226d\t\263Eg\346\307\224\222\027\231()f\255h\200[\264\340\2755y1\353\037Q\242\202\340\325\215\270\034Y\027\255\212X\271N\035#Z\260\256r\335\034$\274\247\312&\207\033\223%=\242^\224\212*\"Y\361\336\267\210\203gQ\232\367\310\311\303\252\246\365t\253z\021I\035\007\240@\275Y\027\215\024\251\300\3468\371AU\234\322:\203G\243\256x\344\377\203Q\023\374\206\370\310\"&\353S\240i\027\213T\340\244\303\213\220\"\021\n\274C\206\004\271d\230\222&'K\217\206\021T\326\237"
+	.ascii	"\233-\266\305\212Oq|L\261\351Q\305\231\"\227u\361\251\030\004"
+	.ascii	"\316\217(:Y\027\201\364\034\301\302%\353O\240\254\310\364\242"
+	.ascii	"\216\"S\321\211(\006%\301\230\036]^z\302,@\244D\025w\274\350"
+	.ascii	"\364\242"
+	.string	"\217\021%\210JB\034]\244\362\262.\366(\362(\346(6M \254\230TL*\342\200\262c.kkx\207\205\307\234\242\322\2138\272\3407ZwI\262>\036\213\026E\316\2153Y\177\002X\305\243\342Q\321\006\256\362.e\250\263\306\251\352R\247\210\364\242\215\2456\271)Y\237E\023z]\241\021\223\365'@\2448T\034*\322\340\0205\344f\001z>\033Q\324|e\375\027\211^\244Q\234\241\221\314\230j\313\272h\304&Y\215M\240\250X$\0018:t\210{Y;\346\262\324\263\"3Vu0\224\270\327\245\366\364\341T$o\r\032\0279r\210pp\225wie\302\361\346ikL\016\264&\2637o\210p8D\r\341\261\321\035V\\\270\220\316@\351\235\b\007\357\312\333W\030\036\036\261\216C\324P\033\017O\212\314\325\321K\237wKV\226\270qCl\203\253\274K\b(\232\253\2635\244cIW\326\227"
+	.string	"\220h\224\330\206C\324P\233\002\314\351\361&*\274\363\202\245\252\r\026\233\361U%%\353\267\320F\244#\322\021\353\200"
+	.ascii	"\347$%\031\202\275\240p\350\324\341/?%Th\020\311\372-l1s\242"
+	.ascii	"\0323\3049\226\013\007$\030\344\364p\323C\357=z\362\3403\005"
+	.ascii	"\345&w\342\334\335\366\256\244I\035\r?9\223B\22651\r\213\306"
+	.ascii	"L[\225\254\211h\324 :\346\264\316\374\276`\225\233\030\273\254"
+	.ascii	"\337\202\220\375\026z\2009\321\r\f1.=\203\237\257\323~\275\274"
+	.ascii	"\350D\251\334\240Bf\314\211q'\302\215(q\272-(g\210\262&\222\371"
+	.ascii	"\320)\214Z4\353\023\337~N\216\204E\311\372\033\354*=\232\232"
+	.ascii	"\262&\2129]\326\242Kj\22351\314\273\004\235\320\350Q\265\265"
+	.ascii	"\260dvb\232\031\221\215x\204\337\327\351-2z\207<\255M@)rP\270"
+	.ascii	"l9\221\355D/#J\274\213Y\032\254\252\254\211k]\210\\\324\316&"
+	.ascii	"\bF\213^\220\254\211Z\320\200_]h\304eM<\303S8\336\340\262\374"
+	.ascii	"\276`\233%=\222d\375\026l\354\267P\224\337\3447D2$\353Z\0176"
+	.ascii	"@p\030\001SD$#\216\271\211q\023\2235Ql\205,(o\326\217@\227M\304"
+	.ascii	"r\345J\220\013\256\362.\001\331\234<h8O\224\330\262~\004\250"
+	.ascii	"X\261\022"
+	.ascii	"\344\302!j\b\017\350\201\235s\246T\227\365#P\345\345E\244\002"
+	.ascii	"\346\375\352\221\345y\"\225\375d\313nI\326D0a\336\221+\275\254"
+	.ascii	"\211S\210_]l\330\304\276\366\272\034\231r#\0026\270\270\206M"
+	.ascii	"\034\242\206\332\020`\n\226\234(B\326\330\262>\2139[[\321=\225"
+	.ascii	"\306\306G\326gQ\246I\023\"\024\016QCy?\246\036g\262\204rRH\\"
+	.ascii	"\236\234\b\245\007\222\224T\326D-u\314\2314O\232dMt\242\216I"
+	.ascii	"\253\222<A\311\232\230\245\216\361\345e\335\325\351\272\272\""
+	.ascii	"2a\203e\326%k\250H\222$D&u\3175&>\226\234\310\004\327!\203&H"
+	.ascii	"\326D% <yV\021\243\210zZSbY\237\305\215#G\210UO\215\336!rXC/"
+	.ascii	"(G\262\250N\254Z\225\336\244\324\311\2328uW\204\316k'D\b\261"
+	.ascii	"\b\207\250\2416\006`\353\021e\007\261\215\223\264;\251\023\213"
+	.ascii	"\004\243r\306\344dM$\342\265ff/k\342\020b\324\347\302d\211\""
+	.ascii	"B\221H3\206\225\265\034\331\030\2745\247\337\211\030\004Wy\227"
+	.ascii	":h\355\230\363\260&\031b#\002\344\304 \302\035FmdY\023\177\260"
+	.ascii	"k\302\2758{a+\256\3148\021i\006\261G\032\207\237\257S\324P\033"
+	.ascii	"\020\242\364\350\362\322{\217\234<\fo\260\221:\302tb\217\023"
+	.ascii	"y\214(q\272\345\024\024\2325q\3071\0227\320\243\254O\314A\324"
+	.ascii	"\361\373|M\326\230\325\311\372+\2466\261i\003!q\210\314\311\232"
+	.ascii	"\270t\272\254\244\366DH\326D\034gcF\245\352\211\250$\246H\\Q"
+	.ascii	"\326D\033\304\033\030\3726b\322\237\304\241Z\215\261\266\254"
+	.ascii	"\277\002j\037\277m\r\001~\333J\254q\342\321\357\363\251\r9\""
+	.ascii	"\225\365W\370\330?\221\306\357c\311\316\004\301\312\372+r\354"
+	.ascii	"\257\270A|\211/\261\bWy\227\360Z\217(;\266\336\327\311\303\210"
+	.ascii	",\"W\210D'\026\375\020\222\311\243J\2235q(\377\b3%\310\221\330"
+	.ascii	"\177\337\252F\213H\215\262:up\336Fz_) \277h\017'Z;L\336\242d"
+	.ascii	"}\026\200\354\1778g8'\273\321C\317w)\203\226\"(w\"\322\230\216"
+	.ascii	"\262>\0134\340\300\031\306\321F\317\267I\230\305\304\246\301"
+	.ascii	"p\254\313\033\265\254\207q \240\367\346\r\360\215&*\276FV\364"
+	.ascii	"\322^&'\r\200EC_o\326\207@\031\265\017\277\f\325\206x\351\221"
+	.ascii	"\323\253\343C\334W\316\001D\311\223\254\357\330\033?\312\304"
+	.ascii	"\262>\004\274\354c/0\303\2664nn\371\007\005EG'x\215!!f\370\206"
+	.ascii	"\337\252D\200\342\026\235\033\302\r\345\316\326D\207u\372J\376"
+	.ascii	"!\006+:t3\264\033\262\031\322\r\333`\350\260nHfX7\f\003<\203"
+	.ascii	"w\3656\324`NGA\321\321\t_rQ\271a\334P\r\005EG/\221\024\bk=\254"
+	.ascii	"z\f\347\206k0t(w\016\035\204r\324\350}\255\372\037\252\031\246"
+	.ascii	"I\263\021\244F\326C48\254\355\206\221\254\017\0013\030:<SW#\213"
+	.ascii	"\216U\326\3032\247\323HC6n@@k\037\002V\373\020 2\034\263\315"
+	.ascii	"D\205\004\331\207\200\217}\b\344\330\207\200\322\376\207m\371"
+	.ascii	"G\030\230;1Y\037\002H{\2706d#r"
+	.string	"\245M\225e\375\241\227\377>\025\222\214)\313Zw\311mWXJY\177\310e\230\306j\214J\326\037n\371\357S\313\366\356~d\r\244\261i\250\220\223\301O\310\031T\220\254\257\"\356\312\207h\270\013_\031\246e*\317\034\303\"\261'\r\264\323\0310@\236bo~h\201\313zX6\3142<\373}\276-IqOY_E\333\376\320\254\n\216\311\223\2543~\227u8\366!\331\357c\275\230\214\306\262\276\212\265\375!\226\241\330\357K\351\270mA\312\372*\316\366\207\320\377\276\020\314\021\221\2225\360h\323P\001\226\201O\256\n\235\222(+V\202T\371}\337\027\213\375\322D':\204*LK\326W\241c\017\251\f\251\f\233\n\320D\307r\231Q\324%\353\257Pg\370\205\241\303\257!\330/N\216=\323\300\233\223)\247\254\277\002\033/\257\240\325~\345\f\337\240\265Y\312\372+\274qq\005\233D\020\213\"\322!"
+	.string	"=\034o\236~hY\306\312\366?\334\032n\005\225v\221\321\033u\305B\301A\225\207\301\234\264\271e\375\025\242\354\177\be\b%xC\033-\345\200\323Z\3221\245M\326_AJK+\210\244\211\252\274C\3032;6iz9j&\312\230\254\277\302\215\375\017\263\206Y\301\032\0378\311\372\342\322\0232cm.\353\253\020\335\377\020\353\030:\304\n\316\350Z\357pP\345\341\246\267$XY_\005\266\375\017\225`\350P\311\320J\204\252\250W\207\b-\245:q\274\304I\342\221\365\320\352\307d\303%C&\330hkL\315\030(iCY\257*l\355\177\210\344\030:D\022,\022\241*\352\315\301\001\230\016(w`\300\316<e}\025\250\366?\244\032R\005\207D\020\213zst\020E\013\234\2230\b\232\031rY_\005\036G\216"
+	.string	"\353h\242*o\323\252\245\344\304m\353\314\324\215\267\254\237\302\233\375\017\211`\350\220\310\260\310.2z\211\306\3265%+\273/^\234\342\362\260\310\207R\032\b\333!\007dk\312Z\032.PPg\352\217$gM\310\204\b\371\222\331\340\342H=\203\004\001\342\351\241\035\243\327H\031\326\373\272i\220~\301R\244.\353\247p\265\377\341\217\341\017 \236\001\230x\310\255\351\275\257\233\006,\216(#X\262~\nG\373\037\3728\206\016}"
+	.string	"\343\210\340\024\365\346X"
+	.ascii	"\227R\221,=\261\032iZ\262"
+	.string	">\nw\373\037\362\030\362\240\362\001\273%%\356F\326G\241\314\036\352\030\352\br\301\357\313A\033+\024\320\230\230\206M\026\274\357K\343\215a\246)M\224\316\025=\250\246\354\244\246ikJ\326G\301k\017o\fo\fq\234\360jhj\353\341\201\204\313P\351C\034\357B\364\302\0323\223\3650\t\005#\303\243\341\321\020\311\347!\314\221\216{\343d\226\365\020\t\347\311Ey\273\312\372(\334\240A#H\265\2078\200\201\t\266Eai\222\365\037p\267\207FC\243 \227\023^|%&o\241\023'&\353?@\314\360\035\022\r\337\240\325ph8\024\264\222\261\267\264\266\365:9y\3003\234\356\352d\375\007d\331\177\300\2239\302:s\202Tt\350\004\251\264\310\0013\247\250*\353?`j\377\001Lq\342\004\255d\220\311\321\323{3\206\025F\230'\314\013R\301`\262\264\266\005&\274\023\336\005\251Bh[\203\345"
+	.ascii	"&\233\216Nh\207\337\267\355\206\320\216\313H\232/\321\264\207"
+	.ascii	"\230\2429Q6\300\2576\2558p\204u\220\336\270\204u\354\234\032"
+	.ascii	"D\214\016+\353;\340)N8\027'\224\023\226\021\226\021\312\355!"
+	.ascii	"\016xnN\036\2004\304\244\274\251\271P\216E\342\246\210[\326\302"
+	.ascii	"4\277\260_\022Z\0317!\0324KR\274\b\321\b\3170q\262\006)I\207"
+	.ascii	"]\3654\326Chf\007\241\013B\004,\353;\340\306~\n7d\310d7\034\252"
+	.ascii	"R\200\t#\034\023F\214\230-IR\220\355\247p\262/\374\202\205mm"
+	.ascii	"@=\314\264\313\262\200\211\036\331\307@\275\225M\310\346\226"
+	.ascii	"\002\307\376\205kk\331\r\2077e\363t\202\034.\\\262\033,v\002"
+	.ascii	"\2274\241Z\232\026-A*-AN\200\356\237\320d\377\3022\f\025\226"
+	.ascii	"\t\317\206Ke\302\263_h&\314\302\306\001[\373!\22756\362"
+	.ascii	"b\rk\206\023\206\354_8&\034;\213\236\240\264\177!\026!\026\234"
+	.ascii	"w\205f\302\233/a\330\227\360\212\360\212\020L\b&\264\202_\246"
+	.ascii	"/m\302*\027Z\221\253\"\346G\326B*i\335\226\r%kY\013\237>/Xg\350"
+	.ascii	"\262>^v"
+	.string	"c#\307\226!Y\337\2042\373&\220yy\3410a\213\213\013ij\377\302\255-\374%\027_\243\245 X&@\021B\271:\212\356\355\013\263\260PK\013\253\251\3306\226\234\242%\320\355c\254\266\376\302&\302&6\2760\021^1\tR\255\357\213\237QKL\257\023\223\007+\253 \025~\231:\200\003U\002\327~\t;\366\177j\2600\211\220J\250\004\347\351W\354%\312\321\301\026\271\022l\354\223P\247\252*/\345\221FE,\353\223`75\025\344\262E\r\tp\373\331\r\026\026\371G\224\020\006\021\032\311n,\030z\276K\030\230\262\264\266E\002\333>\tf\373\027\022\021\022\301b\"\210E\021\345\020\300\323\216\271\254\2572`Y\237\204\035\373X\n\026\016\021\016\021BY\251\333\241\001\020\317-iG\233\234\247'\266\214\303\363\315\001\004\007E\233\0349\204@8\b\263%\374q!\020\340\f;6C\262\026:Q"
+	.ascii	"\214\221[\326B\037)\026Q\315\332\032\254\254\205=\202pJf]\262"
+	.ascii	"\026\3628\233_\035\2252h\326\302\035\357\222Z\211\"G'k\241\216"
+	.ascii	"\340\231'\271.Y\037\217]+\022\246L\230\254\217\"\314\0262\t\231"
+	.ascii	"\202TN~\240\240\262\177!\016!\216\354$\202S\324\220\235\005n"
+	.ascii	";\242\244\005\341P\201\243&\353\243\210\222\224\004|"
+	.string	"#B\325KD\344C\321\227\223\006\332\216N\216\263\254\217\202\310\376\2056\216\241B\033\301\245\215d\364\022)\371\201IJ2$\313\031\333\\\326G\321\264\177\341\221\360\b8g\270T4WG\317G\0168xY\377\304\234\375\013i\bi\254]v\321Q\024Q\221\022iJE\262\322\"\270+-Y\377\204\334\376\205DB\"\241\221\bNQDD\037DyF\327\236\314\204E\300\2663F\222d\375\023n\373'\306v\235:\302\227]\322\013\356]\370f7cF\354\216\262>\336\217\312\177\237\217J\231\031`\262\376\t%\373\307b\304`2{\206\321;U\365\003\262\203\353KO\370\366c\007\0319\307\320\240\034\340\035\033\"6ij\220%k\236\262\376\t\033\373\307q8N\025\353\302\222\223\005L\343\304\206\224\031l\006\247\021\241*\212H\312\0020;\242\244\351\375\276\300\274d\301k\360\032\365\2126\252\362\352X\323\2344"
+	.string	"\326!\241a\222\227\007\264\023A,J\203\034pZ[o\254\254\221\311\372#\254\331\177\360\356\030\032\274\003FEp\252\362\016\261Y\324\276\270\270\206\214\220f\377A\273ch\320\016X\307\322\021\201s\362\235\201bS\227\365G\210\333?\256\253\003\303:\301\323zF\243\372\207\366\031\275D^id\216\304\031\223\365\217\333`(n\243\177\210 \026\3656}"
+	.string	"\026\007\345\216\315\r\324Y\326h\320\004\351\350\226\326\364\326<H\227\346\325\310\241\226u0Mp\216\330f\025\204\313\\P\216\353\306\220\234\004W\305&\252\006\277\311`\202\200mu\331\177\320\f\206\006\315\350%\021\304\242\f@\345\353i+\355bc\345\255,..\305\303`\246\211\324\220uF\017&\035Y\177\004*\373\017\222\301\320 \2314\r\317\\\323\025\224\037\325\226\2213Y\177\204\256\375\007\307\004\307\244Y\"(jC\225u\004,\t-\353\217\200\265\377`\230`\230\364K\033Uy\2070\224\rI\r\021\312\211\321\023\313\372#P\261\261\005\333\274\204\001\363`\033\006\236\236HY\007\277\3402\262&\274\021\202\354k\200\203kk?F@\332[\266\004\271\270\261"
+	.string	"\254\212\213\257\211\223\"IY\337\204\335\376\263^\326\313N\273\310\350\035R\305\256\355\260\342\242\367\276l\032\250Ryo\244d]V\026Lk"
+	.ascii	"\322\322\332\026\332\203iC6*7g\316R328Ug\301,ec\250\234\322\254"
+	.ascii	"<\347H?-is\306,\307\311s\216r\024\251\033\223\365M\204\215\215"
+	.string	"\005\251\242\314\231\320\332\177\020K\020Kv\303\001\213eIH\324\304\323\376\203U04X%x\345\204\347;D\\\352\n^\371\203V\202aY)\243\225\221\021e\275!\nkX\363\035\306\260\336\304\321\363y4\021\304\242fX\t\241+-\2107\227\204\224\365E\200\363\365\265D\204\271\375\007\275\216\241A/\340\234\bUQo\216\017\244\274\311\311\032\002\211C\244%\353\213\300\266\365\255 \327~\337W\316\322\332\226\224\007\271t\034\330\2314Y\037\017\347\375\367\255b\226\346\304\311\372\"\210A\201\022\224\232r\005EK\013\213-\001\021\241GVV\220\252\253L\204\032XX@5\"\210E\275:<la\332Oq\262\274\311\372\"\274{\311\222\240U\027$A&\017Z\r\275\272D\341d}\274\264\356\277\317\330%\211^\326o\200\335\376\203I04\230\004\177\311\317\227\351wuC\314\376\363X\036\313a\"\210E\021IY"
+	.ascii	"\366\302E\3239s\312\340d=5\025\244\332\262\027\244R\341\264\254"
+	.ascii	"\310\262~\003\314\366\0374\0224\202\363\364\363m\3721\231\363"
+	.ascii	"\324\340\rx\"DHP\252k\016\221\007\245^\007u\206FH0*\016\032\035"
+	.ascii	"<\262\376\203QA(\246\254'\030.bUX\217g\326C\262\222\377\257\025"
+	.ascii	"\2577Y\277\001E\366\037\fr\f\r\006\3119\210W_\257\006o\200\216"
+	.ascii	"\375\240\216\340\216\007y@\203<\202?\360\373\276\257\323;dG\200"
+	.ascii	"(fKkz\257\023\223\207?\350\364\340\217\374#;ic2\226u\320G\376"
+	.ascii	"\001\204\316q\342$\353`\017\266ML\021\250\254\217\367.\377}\232"
+	.ascii	"\207\226\2560Y\237\001d\366\177\374\374\257/\021\323\373\276"
+	.ascii	"9\324\347\313T\024\\\177|\254b\354\341\027\342\024_\360_\277"
+	.ascii	"\357\033\320&\302\373B\321E\275\357\213\357\266\0234\242 \026"
+	.ascii	"\274\377\377\r\357\3736\035\031\275C\370(L\252\351(L\212i\347"
+	.ascii	"\310M\252\3515j\3322\222\212\302GFRLLF\357\320\316\033&\305t"
+	.ascii	"\364J5\025\337\260\327\307Q\030\321\020>2z"
+	.string	"\233\336W\352-\276GDMo\330\223i\347(L\212\351(L\252i\347(\214\250\351\350\215z\213GO#L\357Sjh\347F\030Q\323\033\026\325\264\363\206I5\035\3555\031\n\300\2322E\350\204\031\201\241a*GF/\016\245'\"\246\342\333\3213\352M\363\276X\214\306\313\364\276\275\357\005\357\373\024\305\224\206\310\007N+z\303QdF\024\325A\251\250H\324k\3646\204\337\267#\255\250\367\325*\372y\225\336\367};\030z\276\275H\360\333\220\221\2477\211\306\373J\360>\337W\351}\207\360\373\366\276\357\320\373\276,\323\323\363}\201\024\217\260\224\224\336\327\211\203\322\3734\244\205\306\373f1\271\264\246\243\260\"Q\"\264@\303\260\336\032\317!|\224\024\365b\275i\244\230v\330\020\2257\351}_\354fc5\351\260\313\372\231\301)\n\216\254\203Lz]\342\244k+\3533`\311\016\342\210\203\223DI\326g"
+	.string	"\221\035L\302\262\244\313L\326g@\216\035\264\321\004w\366\224\365\031@\264\203G;\354\360\236Y\177\001\321\035\244\241\264\345L\234\254\277"
+	.string	"0;h\244Gd\b\227\254\277"
+	.ascii	",;H$,\013ceK\326_@\327\016\276!\210\023\206L\326_\200\325\216"
+	.ascii	"\023\267\364\006H"
+	.string	"g\250\306eL\233\254\277"
+	.string	"\036\033(\207\210\225\2247\225\365\0270c\003\341 \361r\344\226\365C\310\333Y\310\254}\311\032\230\227Y9&D\332d\375\020\314\354\247\323Q\226\257\254\201n\256h\361\310\372!\210\331\3006p\342\240\317\254\037\002\333\006\262i\262z\256\311\372!\250m \335\320HR\035Z\326\017\241\354\tL\0332\266#k\240\334\363\317\311\307^R\326\017a\312\006\246a\321\324\304M\311\372!(\331?\020\r\320\f\233\332\325\030\f\005\216\001\232\341a\222\300\021\271'H@\220\206\342\016,\363\003\337\200d\200N\202Q`p\274\200e\r\204\023q`\234\215\2501,Y\033"
+	.string	"cX?\274X\303\252Fa\f\353Cp\022\343\226\216!Qm\201\201\002\301"
+	.ascii	"\335x\230"
+	.string	"$\200e\017\032\214\262c\003\244I\326\3006`\030\222\033L\266d\375\020f|\361\262F\275\301\013B\206\241@2\240\027\036\246\n\240Y\263\226\1770y&U\351b\026\355\002\344\342\223R\345\343L\326[\206OM\320\256\267-\256\256*3/\263+3`\032\020\r\250\005\230\005\250\006<\303P\240\031\260LUbw\224f\250\257\200\256}\005T\215a\311Z\204\230a\"\005C\201R\200Xx\230$0\206\003\272\303\262\244\354\b\242\031\273\022\002\274r`\330\217\016,\314\220\254\255\2609\342L\221\222\365\025p\364\204\212\252`\270\300\200T\200S\200U\200_\030\n|\002\273X&/%\317!O\340\024\222\254\343\214\355*\250\257\200\241\375\004\220\331O\300\227\375\004@\367\017\334\002B)\363\312\333\222\365\261\024\f\024\202\241@!@(<L\022@\242$\3722\355\320\340\t^*C&\212\004\243\036=\210\034\250\365\003\207"
+	.string	"\241\200N\202Qd\234\240D\311:\353\375A\261\322\206-\353'\200\212L\212\355H\226\"@$\254\033\213\366\001\r&\237\215#c\321\251\252/@$@#\331\211=r\006T\002\304\002Z\001\223"
+	.string	"\257\200K\200M\200L0\024\210\004H\305#\n\231#\036\375\004\b\331\007\241\316>\bx\373 \254\331\007\241\314>\bm\373 l\331\300(\021\007\022\371\202\002\346#k\f0\2065\203\027kX5\bU6{\246B\3419\255\001r\f\005\002\001:\211\340\264_#7\260(\217:IdY\037\204\253\375\003\177"
+	.ascii	"\235\272\\\345\211e\355C\255)\013L\326\007\201\310\006\362`\335"
+	.ascii	"~o\223\007=\245\"Yz\300\036\030\n\344\001\334q\314\001x\245k"
+	.ascii	"nJ\353\203\240c\377\300\034\007\352\020>e\0319\222\365OL\304"
+	.ascii	"\2019\324\037mD\224\274\035\330\244\001:Ln\214\311\032\310\364"
+	.ascii	"\3431\231M\320\314\231]U\322\201K?P\t\210#\311\216\2637Y\343"
+	.ascii	"-\254a\335\2001\254\251\021\021\007&\t\253\226@A\313\032x\343"
+	.ascii	"{WwIH\007\332x\212\245\001\037\324\216 pY\377\264\2108\020i\255"
+	.ascii	"\003\347\206X\215\003\217\236\024\304\211M\326\300\031\"\016"
+	.ascii	"\254\221\257\304\332\332\214\016\244\361\003g\254?^\330\243\363"
+	.ascii	"&k!\306\260b:\021\007\032\211Y\213\202e\375\003\211\016,:\220"
+	.ascii	"\312\2309R\262\006\016\2118\220\210(\304j\310)\007-\320\261Y"
+	.ascii	"\202\n'\005AL\3279\334\340\f2\301\207\211B\217R\210\371\263\242"
+	.ascii	"i\202S\206r\271\2023\205kl\201\222.\320\031\001 \244\357\350"
+	.ascii	"\036Q\f[(\266\312\026G\026/\326\344\25756\231A\277\326\270\202"
+	.ascii	"\333d\006\t\235L\266u\217,\364\b\035[\354\366\205\344\212\366"
+	.ascii	"\205\344\212\355\356f\260\347\330\236\240"
+	.string	"L\036Y\270\301\246\253\242\345\340\002\362\330B\251<\236\210\321\374\265+4\270\313d\272l\203V\360a\242\260L\372\264#\3748\223\313V\031\324\262@B\213l2Kh\235L\345\t\245R\310\231\314\200\302mM@\272\315\241k\374)\217H&\n\356\021\250\311,\001\203\273L\301d\341l]\031#\270G&\022C\273L\242\320\203\364IIh!\005\213\023&\214$\240X!\005\343\t\026\214+R\354\3748\205\224%\360\270Ncp\305\212\236e\322E\206e\033\264BP\333\266\b\301L2\233\310d\n-P\222E\353\263\301\231\264@\204\261\347\310T\022{\222\314\027Z\204\261m2]\247\021\231\004b\272G\243\261\350\263L.\227B,8\333\346\261\350\032\235),[e\323u\256+T\030\235B\356\321]\321\"\217A+\232\255\013\027B#\264/\232\255\263e\001\205\005,\333\302\bn\353\263\301\204\333\372\354\374\007\204"
+	.ascii	"L\264&4\333\236e\322E\353\263<6)H:\235,\270\255\017\253<\"\177"
+	.ascii	"\334#P\b\327\271d\"U"
+	.string	"\027\3562\331T\256n\353\004j\201\326\266)\024\244\203\200Z#\321g\231t\246\210\321\304\3206M\304hz \302]\n1O\270\255\217p\204\026V|\360\037\020\316\037\367\b4\202\204\273L\321Bh\205\214c\263y\024z bE\007\306\017F\220XA\3028\302\347\310b\204\026\234\313\b\270\020\032\241\351:#P*\205\226K\346\222u\215\355\013I\347\n\203\331\374q\231K\326\305\261Uj\031AH\240v\231\3640B\013\377\001\201\002\213\024+B\270\200d*O\264M\346\tb\217\363(\201\266\207\t\324L\0361\264FW(h\231\024\312\bb\236\370\017\b\237\240\020>A\310\245P\t\300\245\213\254:\215>AA\327\270\364\tR\227>Ai\373B\322\251e\0041\221\272\351\006\245\027\312h\272\316\244O\313\202\261\247e{Z\247\220v\262?\272\307\036\243O\020\210\241\261u\217\312 \240\226\205\333:[\026|\202"
+	.string	"\340&\227)\202\0310d\210@\202\r\316"
+	.ascii	"\024w*\270\240u\217(Z\240$\013\037\013n\322\004\267\311\374q"
+	.ascii	"\026\377\003\242\005:\252\360\303\360\343\223<\201\310t\261L"
+	.ascii	":e\254h\335dS\002\031\200\204Th\335#\013nk\002\020s\331\242P"
+	.ascii	"\261\301mMH\366\220 \343\230\002\363\307\031t\\\256\030\3768"
+	.ascii	"\223\313d\t(T\340\303D\241gi\242\002\347N\021\205\236\226\003"
+	.ascii	"q\231\"\202\326\rj\333\021\\\347\021\005!\024*0\020\272\315\243"
+	.ascii	"\273\"\350h\202\263\247\r\nb6Q\360\0041\231((WP\241\202\003\020"
+	.ascii	"n\363\030\004\302\211\\\036_\364\230(\200\217\003\020-P\222\005"
+	.ascii	"\020\350lY4\231.3\205e\222\350\023\001\242\247m\227\300\377\200"
+	.ascii	"`&\335\326\247Gh\204\f\316\026\350\250\302\t\034\334$P\f_\317"
+	.ascii	"\262ubH\n\215\320\3660S"
+	.string	"\360i fP\261\343\362\364\264?\310#r\031\001\327\331\272\025\374\007\2043\304\004\314\346\261\205\376\017\b\037\241\026mO\210\036eR\250\205\317\021(E\"\217)\263)\303G7{|\315\036_\220\013c\263Gm\366\374\332f\317\35692\225\300\025=mO\333\252\340\"E\004K\241f\b\244\213\236#S)t\312X\232\350i}|\230(l\360Y&Y\200\301Da\205a\213\\\266\315\326E\313\002\017\261\3316[\240$\013\240cs\270\n1\224\320\0021OX\241\302\204\366\007y<\321\002\035\233.\216Mw\231B\271B\353&\2330v\232L\025/L\370,\223\316\b\31086\233&H\020qd\262\331.[\237\375\016<\330\300\203\017b\260\377 \001\034$\200\203\365\037$@\204\210\004x b\337\003\021\251\353\272\356\216\353\272\256\353\272\256\353\272\316e\362\230\002\317\t\312#\001Lp\006\231\260\266\312 \240d"
+	.ascii	"X'\f\246"
+	.string	"r\205\213\364\035]e\213\002"
+	.string	"=\355\322'\271\302\231\334)R\260.2\331\3236\203T\354\266\207\211\\\266*X\247r\205\025<\256\313T&\203\204(L\340\"\233!\220.\334d\013\r\344&G\210\301l\021t\301yLa\311L\"\233\031Zc\223\251\"Ck\354I\021\203\331\202uy\234A>?e\362\310\242\347\330\236\320\n\265B\020\210"
+	.string	"\006S\351\004\312h2]g\362\004%\3237\354Y2O\224\260\341? B\270 :\333\022zZe\213\343\262%\036\207@\315\243\321u6\223.\214K\246QyDj"
+	.ascii	"j\036\235\311\036#\323\025:\356\020{|\216@>\237#P\0208\3649\002"
+	.ascii	"\021\207@\237#\0137H\250\031d6\333\n\370\034\201\330\035\342"
+	.ascii	"\322\211$\032\221#\222\305\035\027AJc\353L2\227Ce\373\302U\036"
+	.ascii	"\215.\220Ff\363\330\002\250\001\211<\376\220\310\243\257m\036"
+	.ascii	"a\3644\217\256kt\321\366t\370\017\b\030G\031\251s\002'2\tt\\"
+	.ascii	"\312@\241\201\331l+\200D\036Y\327E\333ct7\374 \335d\220\352T"
+	.ascii	"*\231M\355l\205\224\307\027\253\220\361\007\351&U\364,M(\225"
+	.ascii	"\314&\006\030\307f\352\004J6Y\360\374\007\204\023\331\244\300"
+	.ascii	"y\002\331\344\3310\2162\202=\313c\213\236c\333\263\323\372\270"
+	.ascii	"\316\243\013c\217\222\371ct\225\307\f0\21622\270\377\001\021"
+	.ascii	"\244d6]\002\270pl\233-\214\307 w\330\272G\0260|\320\223L\241"
+	.ascii	"\371\343\262\0370\203b\220\320\374q\177\316\326=\262\200l\262"
+	.ascii	"\314\240\030$ \233\253\263u\217M\025E\n\025\315\037\026K\031"
+	.ascii	"=\276\236d\020\320\351l\221\314f\220\261'\031\264\263d&\335e"
+	.ascii	"\373\242m\006I`\201\261u\217m\217\321\205\013f\353\302\3215\312"
+	.ascii	"8\3028.\205\232\003`6e\370\004\177-\222\312\343\tw\331\002\265"
+	.ascii	"/\230)0\2332|,@.e8]\004)w\033$\303-\276\360\343\302\b\022\306"
+	.ascii	"\326)4l\235BF\246\013\034a\344\021!b\204\361\205\237\f#\214\256"
+	.ascii	"\013\246\223Ckt\001\331\376\234`6e\370`\200\301"
+	.string	"T\272h\266/V\020r\240\031d\024\3028\3120\022a0{\226I\030\303\027~\214\2552\b\350\350t\341\330\006\031]\027.\214K\031=;\356R\210\271\224\321C\374\017\b\225\271\272\377\001\321l\223\312\240\244\253\024\002\312p\002\305\n\016\356\261\305\013\237\362\370\342E\262\307\3316\335c\213\027\302\377\200h\201\222n\210%\023\b\210\211t\217=F`\363\330\312\320?\356\222\t\244\3128\366\244\316\246\020\363Gu\266\256\3202\t\304:{\226Ld\353d\235I\2452\t\264\376\007\0042\004\322\305\006\240\326u\312p\022Yh_$]\344q\347\347D&]g\322\005\347\321%\376 \335$\214\025N\246\n\017Z\367\330\324\340\002\222\251D\n\005!\205-P\222E\213<6M\360Y&\201\232&\226+4[\030\314\240\b\232\255R\250\247\375A:\207\3156\351\"\351.\333\236\024=\315#\263\005\321m\201\222,\200N#"
+	.string	"R\3700\225A\026|\226I\037\037\246R(\224\301u\032;\004\265\355\b\310\245\f\347v\235G\245\317i\234\300\351sT\272P\177\356\177@8]\264=F\237\243\262\004\367\310T\272\3609\215Fw\331\276 \301\207\211\302"
+	.string	"`\264\313}d*K\200\321.\205K\241\022\216<\356\262\005r\235B\033\3501\261L\362\264\356\321\035A\350.\223G \255df\325il\201\216Mb\033$\303\325-\220\220\263m\256n\263\231\\&]\264(z\224m\262\204\016-\320q\251W\025\206\315\266\347\330\376"
+	.string	"\205p\217\262M\272\370\265@I\026\276\377\004\240\030\304\"\221GcO\223\211l\233\277\266\207\t\244\201\230\313\266\307\250d\356\377\200\210\321\f\021\243\211!F\363\027t\004B6\325f\333\223|\301l\006\365\2641\232\312c\262\331:wb\264\312 !\024.\224\307\237_\020\261'\351s\3214&\203\234\306\030\315\rmO\262\331l_0\215\313\244\005F\037!e\020\207\035\267u\266M\246+t4\366,\223-\214\356\321i\004\022j\272.\264A\316\t\202\255\362\210t\376\334f\373b\2314&\235\316&\020\331\354I\002\251\313$\320v\001\331\376 c\034\2016Q\311\fB678\333\266\351\323\242"
+	.string	":\236x\021\344\202\307=\276H\272H\023\311#\207e\022\331:\205\2141\216@\306\030M \322\030C\350h\214q\004\"\376\007D\214\3432\t\304\003#\002w\331:\333f\220\313\\\272\307\026/: _(\205\255\221\2475fh\221M!\346\212f\353\266)\270\313\266\331\024B\362\310p\223\310c\320\361\204\214f\353\272\307\026D\3678B\013\255SH\350t\233\255\322\304\211\326)\224\241\3659\372,\223\313\346Q\002Kf\322\r\002\022r.\231H\n\234Ig\333l]\247\214\037\367\330\342\305\260\3659\272J\346\013\245\262E*\225B.\234\306V\231t\301l\252\350I\006\005\335\377\200\350I\006\205\340\200\002;\215\037\364$\203V\0258\005\356I\006\2450\2162~/\374\030]\004)\203/\374\f]\270`\272BH\343\017\322e.y\332 \031\256q\307]\266\310f\253\302]&\231*\202\204z\226I\tl"
+	.ascii	"\3028R@hEO2h\350\\\266A@\314\023=I\025\356\261\305\013\f\313"
+	.ascii	"d\n\256\211\236dP\261U\372,M(\333\027\255\222\350\"[\027.0\264"
+	.ascii	"=L \243\333l\203b\264FW\231t\215K\346\013\311&\363\207\003\013"
+	.ascii	"\026\021,\223G\023\232L\023\031\230I\367\310B\214\243\262"
+	.string	"e\201\307\375\361I\266\022X\001\324l\335\036\f,\3008\312\330i\335cs\330\343S\354Q2\177\234m\363\3075\272\313$3\310m\235\034Z\240\244\373\003\266J\237\3451C\353\036\233F\f\255\221\205\037\347\261y\242'\031\304#\243\331\276`\"\333\346\020\306Q\206\321M\002%\225\306\037\347\261\211$\272I\240$\n@\315\326M\376\204m\0173\005_O\353l\266/\332\246\321i\204q\224\201\301i\\\335\377\200h\266n\013\304l\036[\234`6\217-2\264\356Q)\204T\036\221\276\325\025\3322\216\312\266\307\030$\264]7H\310\3506\217\256s\007\255\300l\036[\b\231\315c\013_\220\220\321m}\326\266)\344\266,\230\315c\013b\333\024r:\333\246\nf\363\330\"\370\037\020N\3471\b\210\211\254\300i\3649\002\251\313\244\022\331\242@&\335v\351s\004\302\360\037\020\312\026\211<:\215H\344Qu\377\003\242"
+	.ascii	"\315V\251L\272X]\242\221\375\017\210\021Nc\214\326\025\002\332"
+	.ascii	"q\001\311T\032\215\253\273\024b\"\215F\266\331.a0\215F\326\331"
+	.ascii	"l\235BK\243q\367,\223.\030\215\253s\231\fr\032\215\254\2625\032"
+	.ascii	"}\256\321u&\225\305\377\200p\266A2\334\rz\332\346\361\307\271"
+	.ascii	"A\b\247\233l\021Bh\351\263A\f\241eR\271A\007\036\030=\370 F\210"
+	.ascii	"\266GH\211\\&C4\235B!@pc\264K\345q\331l\335e\322\330sl\233?n"
+	.ascii	"\220\321\270\341E\333\f2\032W\327\231T\032\215\353\321=\366\030"
+	.ascii	"\215\253qu\001\311Tj7\271L\261,\301M.\223k\323U\201\\\n\225\320"
+	.ascii	"slY@\"Mdp\032_\264(\220\310\343^\226\320sl\233\253\3534&\203"
+	.ascii	"V\270hQ\264A2X\030S\250X\001l\221\313\243"
+	.string	"\353\\&\267k\\!\205^&U,\235\3105\031\344L\235\306\023#R"
+	.ascii	"O\214H\341[\221#\222\351\177@8\205Ztp\032S\350)6[\327y\004Z\235"
+	.ascii	"\316\266\331\323sd\333\027G\345\n\241 \240-d|\321\3668\205Zl"
+	.ascii	"\247\261E&_\264(\234B-\200\255\261\r\222\301\302)\324\302\327"
+	.ascii	"\006\311p\235B-X\247P\213\324\004\021F$\362"
+	.string	"\270\3028\262p\002\205\211\325\375\017\b\241  #\263)\303\007\211<\032\2405\262\300A\t\016<\020\n\002\302\340l\233?\2471Ck\\!\024\004\004\\]\245\220\263ea\311L\272\310\326mQ\b\005\001\361\264\306\245ORy4\016\227>I\245\t$\362\270e\364\034[\026\216\356\261\307\327t\2720\376\370$\177\214H\3441\330\3660O\264\315\240\362\370\242\331\272\313\024>\313\2442\b\350\270\002\211<bh\221\313\025\\\347\261E\3015\321\323\272\307\236\240\b([$\322\2043\331\341? \230M\031>!\234M\246s\331:\231M\031>k\013\224t\203\230L\024\334\326\247yt\207.\366\177@\3048\002\031\335\236\325u\036\225F\027Lc\214\266g\2314\272\020j\261\323\276\220t\032]\b\265\330\315\326M\372d8\205Zh\237e\262g\331\006\2611d\030\233M&rm6\327\355\0242\266@I\327\350&]"
+	.string	"\335%\322\350&]\260\033\334%2\215\321\223e\364\344\027z\262ktF\240\005J\272\373? \226Ge\320\005A.04\227l\f\031\253\253<&\235A\306\326=\372\354\0302T\267u\272\255\323m\235\306\236\266\rr\372\376\003\""
+	.ascii	"Jf\323]2\221\034\\\264\315\237\243\333\376\270\276\036 \2441"
+	.ascii	"\351\fb{\200\220FWyd]e\322\205Q\311t\221BM\327i4\266\310c\263"
+	.ascii	"]2\233=\021\304\3002\360\0138\306\213,\343E~\341EN:\203R\267"
+	.ascii	"y\374A\352\377\200h\2661\222@!$\020\272\377\001\341\n\005\271"
+	.ascii	"BL#\020\214\240\020\316f\373\"\331\354\261\3005\262N\237#\013"
+	.ascii	"fru\032}\222.\226\314\023/Z\024\255{d!\250d\"\231.\263\251\242"
+	.ascii	"\270d&\235\315\366\3052\005\020\f\025;@0T\364\264\310\245\f\347"
+	.ascii	"2\002\255Sh\3502\177\234(\\gSh\204\326)$|\321\366\244\255\220"
+	.ascii	"\362\330\202\333:]\270X\241U\366\244P\036\335\244O\262'\202e"
+	.ascii	"\022\b\330*]\227\331\374qc\034\201\200\310e\022\350\327\323\272"
+	.ascii	"\200<\006\255N\030L\345\212\036f\n.\210N\237\243\262\204\326"
+	.ascii	"=\272\316_\353<\376\250h]\034\235\312\344\321\205\260\247}\221"
+	.ascii	"l\221-\013\312\343\322'\271\"F\263\250d2G0\252=I\345\261\005"
+	.ascii	"\247\262].\217?'\334\037\237\244\262\204\030M\rN\343\321=\242"
+	.ascii	"X2\223\256\220\222\271\302\031\344\263\343\376\007\2043\310'"
+	.ascii	"\0043\231\301U\036S\247q\311L\272G$\023\005g\220\217\320=*\323"
+	.ascii	"%S\231\376(\225i\333#\344&]\345\321\270B\205\t\301\236\266\r"
+	.ascii	"Z\001l\235M!\346\211\236\245\020\263\351\023\fb\366\374hg\220"
+	.ascii	"\t<-\020\363\307\270B\205"
+	.string	"\t\273\247\311d\"\215+T\230\340s\217+\200\204\226\306\025*L\370\305h{\226)Z\240c\263\204\024-\020\363\207\350\272\355\212\027G\240U\271\302\216\223\031\224*\333\027i\017\0202u[g\272<*\203\364\332\372\230X2\223\316\344\013\037\362\350\\\036\233\253k\374\300]&\205X\367\00183\250m\206p\231\314f\b`\322\351lj\247\261u\217\356\212e\362\230\002\006\3278\202D\013\224t\265\212\024(\214(R\250p&c\034}=\313#\020\020\363\004\262\351;\201\302\004\263)\303\207=\201\302\004\022y\\}\204Z\264=j\223\3512\201T\346\213f\353T\335c\213\027?\241\355:[\367\210B\353sl\266A@\307\241\2534\301l\036G`]\243\007\"\334e\222=\201\302\204\317\021hu\215#H\270\313${\020@8aA\004T0a#A\304`\266p\001yT\266\b\261L\036\201B \233\316\020 "
+	.string	""
+	.ascii	"\343\310B\213<\272h\n9\177\177z\275\357s\270BYRCK\326nnA.'\300"
+	.ascii	"\bSf\203\001\363\206M\331\376y\276\024\317\336xQ\243\301V$s\222"
+	.ascii	"3\246\246\306\263V\265\001[\222\025\027\317\032O\0275!\257U\027"
+	.ascii	"\036.*\320\314\320\003\346\375f\354\311y\342\331\302r\345\350"
+	.ascii	"Zs$\353\037\275vZZ\220j7\200\316\021j\377<h\305\2737I\210\021"
+	.ascii	"\317\231\020\210\317M\020\256+\236,C05_ond\315S\306S&vd\332?"
+	.ascii	"\017\231\320\312\031$K\270\306\212P\332p\345-\301\202\005\206"
+	.ascii	"\334\322\332\226\0364hU\307\356\212\226\254y\302x\302\202\\|"
+	.ascii	"/\023\234$0\373\347\261\262w\254ji\204\374\250\262\201\f\311"
+	.ascii	"\200=\335Q\031\"\021\221\206\324\311y\006\233l\230)\371\310\372"
+	.ascii	"i\224\305\356.\311\227"
+	.string	"\322*%,k\312\215\354\365\036y\275\202H\276\266;+0]\301\032\320\246-8\270\2023\340\206\264y\223\002|\211sIf\316\266\200K@\346\274he\315v\321@Y\227V\022\224\241\325\234<\035WO\202E:\252\234@\265\202C\373\250\313G\017'\300:[gX\250d\r\213\324!i*\323$L\236\342u\345\305\032\342H\202d\206\324\025\360\311\331\205\355\314\352\247\26761)S\206\311\031VN\225:\272%<O9\313J+\210\222\242\234\320\313M\312W\022 \336\360LtN\026$\305/\372\307\026.D\252\200qT:6B\336\0209\021\236\251\363\020\275o\321\373\016Y\002\202\226R\2358R\347\231\3429\202D\214\221(Gx\214\02412\304\366\365\344\372\"\303S\304\347\344K\311U\023\r@y\204\360\b\341\201\302/\323\007c\342\360\f9\017\324fBdc\367\205\226\365\3616\023=1\250Y\326\327"
+	.ascii	"\223]$\203\267\256\234\211\006\371e\211B\305\b\215\314vak\204"
+	.ascii	"\221\303#k]\004F\307\223\023\016bT\017/\314\007qO\017\214\031"
+	.ascii	"\244\036E\033Zo\316\227\021\0364\362\031\234\2468;\212Nk\332"
+	.ascii	"\022\030T\207\020j\250\006\351H\233\034vt\224`\241i\nr\351\260"
+	.ascii	"5p\3500m#\\qRC\226\244\200\260\001b\2265\217\022\217R\220\313"
+	.ascii	"\tCs\032H\332?OR\021\311\220F\032=27\350p\336\225)Rl\004\333"
+	.ascii	"\204Eh\332~ \235\245_4\336\270#\341\025\236\032\305\254\031C"
+	.ascii	"C<4\210qo`{H\262\336\331\333\331\3431\302LL\033`)Q\331\351\275"
+	.ascii	"N;<\374<C\3471\342)\222\243\352\002&k\036\"\242\027<\250\264"
+	.ascii	"\254\257\201w\363\274i\035\\\035&o\214y\373\337\251\003\274\013"
+	.ascii	"\301\206\236\030\035b\2335i\313\224(s\210u\030\324HJ\223\003"
+	.ascii	"\264\003\216\361\240\001\215\003\214\202\351\251\201zja\331:"
+	.ascii	"\243G\234\203\352\235\345x\003\254\213\200\330\224\265<\240\032"
+	.ascii	"\"\336R\264\016\357\367E5R\207\007\332\335S\332\206\366$\212"
+	.ascii	"\233\"\033'$\315\017\2736\017@S#L\326T\032\320\226U\227u\332"
+	.ascii	"\021\225\035,\037\320`\362-Yq\212>\311\222\274\306\224\260\312"
+	.ascii	"\210\341\300z\252\321AC\332\262\263\266&G\313^\324k\307\314\016"
+	.ascii	"\0308m;c((:J\341\304&\272Sf\207\315\316\232\035\272\235\272\235"
+	.ascii	"\270\035\270\035\271\235\350N\232\235\271\0355;dv\320\354\234"
+	.ascii	"\301\320"
+	.string	"\0353E0\270\267\323}@\203\311G#\356G\231\235\262\033\321\0353;f;g\037\320`\362\335\210\2631\266c\206\215\262\363E"
+	.string	"w>\352\330\351\275\3573x\246\253\213\r\013\364\215d\373\337\031#F\214\312\032\271\247\316B\203v\265\023f\307\355+\256\nL\3267J\3317f\355\033\251\266\227\0356\342\033\245\2733O^v\272\004\265r,Ye}#\216\275\303\305Hc?\003t\3663\020\335\317@\334~\006\300\354\177\347l'\213\212uU\205\356\215\030\254\323\025G$\353g@\313~\006\302\3663\020e?\003I\3663 d\007:c\313\226\252\254\237\001\243+;apS^\350\216\225\357\204\021\231\234\2211\222\365N\025\374\005\270w\346\326\345t^\222\024\021\223\3651"
+	.ascii	"g"
+	.string	"\377;O\241\034\333\326\030\246\254w\274v\274v\276,0\272s\262\025\335\231\362\235\257\340\224%\272,Y\037\017\250'\227$:\227\3651\220f\037Cw\272\202Tz\354GU\021.\"\033\021\316\b\221\225\224`Z\215'0]\262\336\201\262\023\345o\303\201\3233J\354}\237Du-\352d$\353\343\267YC\200\337f=\206\356<\tr\031\301.\351\210\026\031\231\245\"(Y\247F\317\250mV\304\005$\353\227\006J\f\017!Y\357\\\245!\330\333\333\333\233\363\276D;Wy\247\311\016\326w\256Nd\323l\035\021\255\372\337a\362\035+\273\036D\202d\275\243dgI\024,25\247\253s\262F\355+\353\035$;I\252\260\306\266\234\315\243LzZzrU\304\036,\216.9ST9*\330\366\244\251\311T\246\302fr5\260\216\004\177\f\365\240,\2212\302d-\002\022\335+\002E\035#3\003\216T\360\312"
+	.ascii	"\242\302\314!B"
+	.string	"\f\362\233CR\343\022\205\277\254>f\310)\203\002\316\345$\037iEC\250\f\335\344\364\222\b)\002b=\0315y\"\026\321Y\321\2667A\210U\300(7L\242@\2664\205\260\351e\275\343\264\343$|}/\223\023%\030P\333;=\206b\320\234I\223\3651p\266\377\035\036\302W\265\003\222\345e\307X\335\333\215\035\035\301\245))pxd\275\2434\241\222\223\3653\223\001q\243b\232\203q\344\260S\263D\204CL\023u$\t\207\320hx\026\267\246Ni\330\004\264z\252\315H\322\023~\215\3412vC\307\3561\203\312\017\033@\033\3043S_b\220~n\204pF\324\314\034\001\213\270\216\030\251Q\003H\0038u\205\214\007\r9\372\312\225&L3\216\202\357\333\024\334\216\321O-X\204I\315\221\235\"`\223\261\251\211\031\242\355D\210'W\244\306\320\017\r\210\006\3526\266\3632i\2742at\354\001o"
+	.ascii	"g0\271\315\250\363cC\345("
+	.string	"\217\254H\007\370\006\016\222\034\033s>L\303QwV%\3538q\202T\035\2600\024\251,WY\037\003T\364\364\300\254KZee\262>\006\222\344\345\345i\26364\255\254\217\201$;\273\342\235\333\216\271\254-\340\022\035r\244\334\274xg\266\005*\312\233h4\310E\203W\320IW\023\273\254\177\0011uuA\252\264\035sYL\240Kd\262\376\005\310\326\254\tr\211\356\230\313\332r\212\022FG\326\277\300\223b\232b\232\242\234\236\022\225\335V:#M[\0265/\312i\300\225#\354\002S\3051\3051\3053\253\227\022\225\035\261\213\221\034\264h\346\3053Z^p4e],\263\231\374\367\3515[8\264\262>^1\356\277/\002O\330\324\212qE82xZvd]$\363\324\226\326$\353_ \310~\333hPB|\260e\375\013\004\223S\250\204eO\325%4\262(\007\023)\006\202\2169TT\324\244"
+	.string	"C\025"
+	.string	"0H@\034\221\211\204ev\r\024"
+	.string	"\fW\306\206xT\253\313I\026E\f\231\021\200\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\257\212Q\037\260(\013Y\336\036\256'Z\020ai\312|\306\017Z\316\353\244L\3418B"
+	.ascii	"\267;a\b\3214\021A\275#l\200\202\031R{io\256\237D\236\331\333"
+	.ascii	"\302\227\005\214]PB\203\n8bP\311\216\244Q\301'\"\030\222\232"
+	.ascii	"\212\360v[\332\306<\353\324\016\217\247\301C\314\235*\326\241"
+	.ascii	"n\033\353\241\304\027\253OcH,\003\260\024\201\3247\251z\356*"
+	.ascii	"\325\323Xk\266\225\305:\255\022\020\033\243\351x\"\201Q\314'"
+	.ascii	"\241\237w)\241\231v\350\241\220\261\310Q\006g`\374\226q&\347"
+	.ascii	"?\264\035-^v0\232Y\241Z4\227\236\362\272\233O\364\034S\246x\006"
+	.ascii	"]\026\336\320[K\267n\013\003\027V'\211\032\205W\271\254\246#"
+	.ascii	"\036 \303!\226\037\bjS#Y0\202\3615\260\250Q\032H.*\323\f|\315"
+	.ascii	"\372\204\205\204\363|{\343\337\227V\272R~\034\270>\320AX\b\334"
+	.ascii	"/\363\247\275,\214\243\006\332\244\322G\206\361)\235@\\\210\027"
+	.ascii	"%\234\312L\234\200\370\304\021[SN\036-\3054\323\262Df!\025S\333"
+	.ascii	"\213`L\013\300\201\251\234\214_9\212\257\204\bO\025\374\303\300"
+	.ascii	"\253\177\257\337\202\223\025$\253\214\336\366B\3615C\223w\205"
+	.ascii	"\374h\302Px\271\036\336\032\023&;\361\\\354jD\362\3512F\020\022"
+	.ascii	"Y-b\251`\312W\225\234\272\323\177\256\376\333\037\2668j\006\346"
+	.ascii	"\ryk\354E\334z\n.\215\001\311\232\212\025@\203\361\372\272`\261"
+	.ascii	"\r\257\214\005\355\321\206ZM"
+	.string	"\367s\301b\035&.~\210\332\350@\201\243\257$\023\342\237\201,\311s\244\376 \3025\017\356\252\262P\260\340\361\177t \353\t\261\021.\260\345p`\314\323p\022^\023\253\314C\033e\2610eg\275\022\251DY\0346\35714R\212(\346\036\356\241\342Al}\024\004\324\3702R\344P\310D\262m\251\224 |2\210T\204\316\271Z\372\372\206\223\212\352j\2303\351\3072\240\347;z{\301\025<*\316\262\027_\264\r8!\034q\232\344\f\007\211\353\004\233\324H\316\001\200\222\271\347m\244\023\357yq\347j\\\3032\2235\026\362\224\242#IZ0aE\356\321\301\333\316\262\243\270h\252\300\341A\306\251\3647\251\336\364yx\3049L\240y7\366\365Wo\237N\005\223\254\343x\264@\017\3124\021\320\030\001\350J\237i\001\316<k;\372\237\230\253a\034\212S\037?y\226%\261sz`\311\215>o`"
+	.string	"Z\\\330\270\037\334\234\006U\214N\264d[i\322\b\2530\214B\017\233\\Z\315b\262\214\331\n\356\252\241\326\362\037\032\0018\023J\027Y`\036\206^}\313o\003\360\377\204Si!?s\317o\364\324\200\257\244\374a!Q\375\337\020\215K\324\223|&\254\2338\276\227\336+P\2449\337\316\021\206\226\360\233\261\035\177c\304+q\\\3510\nKp\375\340+Gj\t5JS\035\330\b6W\224\273\376\223\306\206:S\360\274Jl\256z\253\252\267q\2542\302V\321md<\255x\377{\250\200X[\202\233\f\276\311\0047\307HH\332{\244,`\267"
+	.ascii	"4\203\271T\205\325K\325\316\367\277\257\216\275\357\362\211\325"
+	.ascii	"\315N\313\037\367\334J\020 0A\234\254\337\346;\332@U\274\230"
+	.ascii	"\360\025\247U\030\320\351Gj\2667=\353\037<\240h\252K\204o\321"
+	.ascii	"\3227D\303Y\276-\222\327`\035\341\017\271\217.\252\223|^\036"
+	.ascii	"X\\20\241\373\017|\341E\265\016c\202\265?yb\230\307\214\323\265"
+	.ascii	"1\221i\376\027\311\354\244Q\335R\357\022\305\200g\017\221+\344"
+	.string	"X\f\321\b7\305,\341\322Q\357\275B\332\213t\262\017\342/\255\307>f*\f\336\364_\321\033GZ\213B\336\224j\214\233_:p\325\201\355\202\\\004\221\234/&\273F\2176Ti\251I\254\340~fr'\372^\034\220\037\205"
+	.string	"(\231\f+\374\243\334\330^Y\374\005D\025\2219\244\230\300\232\244"
+	.ascii	"\307\302#T}N\f\350\020\0019\305g\247\243)\357f\221@2\257\375"
+	.ascii	"\323^\346\251A\241&5\350Y\022\266x\316\034i\304\226\344\tq(<"
+	.ascii	"\225>3S>\374\244l\023\2025\266%\266\\\332\370\006\336\013\353"
+	.ascii	"\236\321\356\316\316q\373!c'\202\213\276;\"\037\271\303\307y"
+	.ascii	"o\273\"V\016&\371\203\270\242x\035QC^\205G \023\276LMy$*\021"
+	.ascii	"\361\263Nj'\022\320\001\"\332\237\024\256\275\215\314l,0\350"
+	.ascii	"P{\020\215\034 \\QXL\267#\313\365\320L-\373\367\230\261\304U"
+	.ascii	"\244\376U\256\314\354\363\035\306{.^\253D\207c1\225F^h\\7\276"
+	.ascii	"\227us\240\007\202\242\327\013K\343*\235\273]6\374\262z\335\343"
+	.ascii	"~\261q\204\361\345\355\272W\331\265|\365)\204\262\3022\232\210"
+	.ascii	"\202\371v |QBu`N\241.4<\343X\026\263>m])\261\267\327\242JA\275"
+	.ascii	"\233\267t\210\376\231\372\372\214\r\020\275\201\325\214k{\022"
+	.ascii	"H\233C5\236\332;\242\261\355\321\213@\232\301\201\2510\264\363"
+	.ascii	"\324\332\357X=\3705\211\341,\204\346\377$(\340N\200\262K\206"
+	.ascii	"\331\363e\331\224\004\353\377\227\276b\350m>Z\307\371Q7\335d"
+	.ascii	"\032a\341JK\037Q,0\031$\031g\217\004w\276\306\037\313\277\033"
+	.ascii	"H\216F\300\366j1\340\364\343\357\346\250\237|\"\334]\017J\004"
+	.ascii	"=\275\016!\246\017<\331F6\220'\334\210C\232\017\237\253\024\005"
+	.ascii	"\227#\f\235\300_[lX?)u\255u\316\344\277m\020\313\372\025\215"
+	.ascii	"\262\253X\267>s\222o\203=\336`\327P9\301B\213\237\006\203\315"
+	.ascii	"\326\026,\344_\360\375\240T\243\316\242\013\020\340&\235\374"
+	.ascii	"A\223\201\252\305@S\277\"\013l\232&n3%|Af \373\324\365A\340;"
+	.ascii	"\314\2337S7\030\2379]\341|[\302\220\3536\020\f\253\201\330\b"
+	.ascii	"5\375\352\302\273\2469sjd\372G\271"
+	.string	"x\251\0305\004L\334~\231Qe\rCz\317P\366\344\314\236\374\3116F\313\247n\247\200\256|2\320\200C\233M\315u\245\333\f\335=\304G\256\020\237\001\311\253\255FE\257cOy\210qw\326\360\263\226\231\337W,\203.\266\367\362\037\027\257gt\362\020\322FW*\027Z\304\007\310\355O\204\223\344\177]\023\340R\016m\005G\022d \264,\303S\\bn\240Z\213\320\024\234\244\221\370\3422\211\023\354hK\261\330\024cz\021J\203N\265\376\262\033\r\241Tm|\221\346 )bc\245Y\245\352\2400\256i/\025\262\004.yf$\223\353\232vTZ\036KFv\2035\246\031\243Pd\344y \016\264\034\277'\374\250\027?\272\332a\370\203\204p\313\b\313|r\226\025\336\212?\301\303@\n\230\214\276o\006\201\345\004\177S&\333n\370\026h\232\323\304?\025\225-\024,\213\273r\347\253s\244\210\313B"
+	.string	"P\031\021s\031\321\267\266\251\221D\320D\0162=\272\204\002\310\002\355\212\214,\314\343*\313\271~\337\362\304e\007\365\005s\007\346hN\027c\001\373\036)\343W{\345\004/v2<Z\320"
+	.ascii	"\027s\261~.=\016\302\203\036\204K\337\302\201\261\362a\300\234"
+	.ascii	"\253j\365\240\210\312\240\030\233\231Mb\241$\251\r\330\013\252"
+	.ascii	"aY\037\376C\030\377\276\374\036d\203\253\377-b\351L%\324\340"
+	.ascii	"D\n\213X]\351\006 \361\277\327K\032XAc\376\321\302\316\336\031"
+	.ascii	"\371\033\250\241^\355\333\313\013\220u\303X\3043\246\352\217"
+	.ascii	"/\221\022R\037\357\241x\n\250"
+	.string	"P`\314@\3309\220\204\340$\002\202_\3413N\357\344\237\345IFb[`\037(\037*\255\r\307A\375\343\302\353\340\365K\t!\231\341\320fI\267\b\332\235D7\241Z\333*v\203\347@%\367\252\311\362S5\267\263R\025d\230OZ\314\304\271\330\216l\272\302b\017\024w}\300\204`\323!\313` \263\313b>\f\321\030\021\023\227GDj%\275\264\341aF]*yh\251f\351\t\211vl\247\007f+.\303H\275)\210i\3120\177\213\023C\b\370\f\"\335\373\305\350:\002\024A\377\306\301<\311\262\027\002\257\215 \r;Y_\250>m\004\340\201n5 \351\350\262\334\262j/\262[(\310\264~\223\t\277Q\346\377\240\246\326\226\323\\\240z\fm~0R\253\216\377\344\256-\202\273\311\026H\332w=q\024\234\"I6>\177\360A\2377\265\254\222Q\266\235\343\230d\221\2466\316\016g\2444\272"
+	.string	"\225\033\201\241\237\020mH\346\252\213\276q4\030\206z\201?\301\364`8\262\213\302\213\375v\327\3237:\276]\340\372kR\325\371\331\022\277\361\321\305BWY\260\365\337\361\336\016?fp\313\341\336\330z\026r.T\250j\253\254\341\231\007\317\017aH@\337\343b\006^b\310W\206\255\275\376\345\030>~\372\303W\022\001\032`\316\327E \026+/]\336\277%\tH\021\233\262\201\001\2065\311nu'\340\322{\016\274eP\251\276f\343\361c\231\345&\310-"
+	.string	"b\031\332E\376\267\205\306\256\313\"L\034\341dG,\300N\335\304J3\033\262\334 \350\0162\345`fK3\017\004Vt\341,\177\\\207\0139\002\250\036L\264\207\265]\006_\027\351<ML\200\005\370\223|\277\272\335\021z5\375c:3\240\025\346y\n\244`\227\231\nF7A\347\276\2740LE\270Q\226\370"
+	.string	"\206I\323\235\001\255\314\0271\334q\240\345t\261\373t&\305h\363\243\3619i&\021\335\023\016\245.i\203\017\266FnP\207mw\202\334\037\374\007\2735\253\265\277*\311\321@/\323\n\250X\372\177x\351\004"
+	.ascii	"\030\r\340\313\013\270}\252\275\362\336B\206]g\244\036\201\327"
+	.ascii	"\027UG\343\301\023\rI\350c\246W&\321O\031\337\213x\223\032 \273"
+	.ascii	"_}z\334\351\326\211\264="
+	.string	"g\245k\215\240\340\026\233\222[[\220\206\243\032\343.\374Z)\240\302\035\227g\220\347\254\023\232\021\0348m\335\275Uz3cSo<\364LJ\306aq\223\270\301\230\253R\342\355\236\221sSs\301C\315\350\241\"\265.\303\361\025\310W\371V\231\206m\312P\211\344\301\217\241\375\243\255\013y\234\360S\250\311\362\034Gw\273I\264\221\263&\262\016\220c\033\023\321\217\212X\207\300\341\262\355\362\313\302\004\370S\350\341vl\325\373\362\205/\343\325\032\352pu\356\355\350\322\276\022\376\251\021\357\340a\217\374\231E\353\242\231b+H=\363As\366<\021\365\013\365\273\307\266h\027\001\273\264\"S\342 \016\fZ\"w\300\303\335\347\036\n\223o\242Ew{P\301\022\004\265;\260\354\214\336\253\241\025\250^7\216p\235\243\236F>\337\2364# 9p\332\307\261G\027\363\216\355\260\256\274!<\007w\362\346\31645\004O"
+	.string	"\261\323\356\370]\036\220GYk>\342Y\2364F\201>\360Q\226TD\262\317\261>"
+	.ascii	";\233\322$D\3556\335;\207\247R\325P\236w\207\235\235H\213\f\003"
+	.ascii	"v\tn\326T?C\225\212\245\372;\311\330\276\322\210\231\201D\264"
+	.ascii	"\026\023\002X\252&5\233"
+	.ascii	"\373\005\004\342=\244\002#\3659]CF\004\031\275\276\342\240K<"
+	.ascii	"K.\204\034.}\342n\021\021P\342\215\244z\203$\311\211\352\215"
+	.ascii	"\377\345\313\237w\216\275\035\002\355>d\347U\364\310\254\235"
+	.ascii	"O\364\270\004\216\334\300\235\rS>\241\241\316]\350R\226\354d"
+	.ascii	"\017D5p\2029 \340\270\325#\324nvq\220\334\310v\335M>\006\324"
+	.ascii	":\fB\325"
+	.string	"~\275@\226\357y\355\271h\315e\323\031\361\207\312\274\367\363\242\330\342x3\"\243\324rV\252zQ\224\250%$\253\223\367\251NWN\244\254\3646\307\337\304 \353\347@\231\363d\273\375\177\f.T\3214\354bY\0039\301\003\303\313\2350?\310\235\343\030\377\252\312%\016\001?\006l.\240\207\336\345p\310oe\343\273\027\366/\335j\370\311\255\367\365\201\317\332\321\373\355)\2208\201/V\272k\221)\225\260d\b\237\024\370\312:t\245\246<\363\243\261\376\332\362\205\277w\2349a\347\033.\036\341e]\007\n\346\17707-KFK\331G\254\344\212\344\273\3310]\255r\362\034\240\235\3349ihi\b#MM\f9!\024,\226\rmO8\305\003/\246\350r\007n\351E)\273\340\325}\311\030\330\205\226\021\317\302\306\2414\210\243\026i4F\237L\360^_\t\022\255\261\201[~\237\025e\321\346\214\321\233"
+	.ascii	"\341\236+\021\316x\034C\300\203T\370Fi\224\021b{\004\214;52\332"
+	.ascii	"p\013\002c\177\232\3646\250\337\034\005\331X\207!\247^H\200\022"
+	.ascii	"\325\005\357\001tD\030\245JA\232,\271\224X\306\360h\303"
+	.string	"\352\2504\304\277\207}\327r\206o\253\247\"\332]:\r;\245\035\tE\303E\373{[a\364\224G\211T\352\244T\221b/\200\207\373\260\002\327\335\236\345\260q\214!\350\235a\245\234_\323I\016\003;\332Z\267\221\237\2603#\257\321\370S\265\222\247uI__\235\030\301\210\n\226Hok\271\252\307kG\232\357p\215!\311\346*\332\323\222:\252y@\225\322\3254\327\207 \213\002`\025|(\020\376Y\033]Z\257\274hn\343<\261\355\024\322rE\340E\036n\275n\362 2\356\230\207jo\f\211\017\313\202\016%]\250~S\007\\\207\333\245o\360Z2\260 /~\244T\335\274\035'\375\334\263\007\226X\274\372\236\203\b\252\341\307\236!g\031(X\301\3461\371\005\b\216\347\320\025\315\331\371\202\2661\034\376_\204'[\034\2414\031a\2528\276\200\334\bZs1\272B\3163j\253B\240\244?\365\213%"
+	.string	"/L\006+\030\203\251\335D\252\247\037\216\336d\225\314`2;B\264\005\017\227\275\305\220A\205(\231\221\302\037\242\233L\222\2647\300\342]\351Q\306\331t3\230lB\263\203\226\344\376\004\002\340\316\304\013F;\020OC\346\334\024\354\215\351\203\024g\373,Gc\276\005;\f%s4\302\332 6\"0cI\033s\305\232\2274\314\306\364u,WW\236\243\221N\262\005<\0300\207\230\177\376\230\223\226\216BnEso\257\034f4g\033#\\c\313S\016\027\273\274\224\022\005a`\025y\"B(\233xT\024\221X\032c\216\205K\302\004c\216\223&\026KBt\304X\223\241!\213$ \220\266\227g\347?\377\001\327\245\311\212\362&ir<\315\242\226\033y$\314\350I\007O\262\265\233\347\331\247"
+	.string	"!\301\224\032\354\263H~\3125_hX\301z&\204&9q\2501\002\227:fg\320\310\nx!}\213X\357\301\262U\261\263-7\314\230[\033\021\004i!\237\027;\227\377\347(\337\221t\377\t\215\227\234+\262\271\017\247\203%^yp\223\252-L\315\2031\254V7@\t\226\372\322@m\220\357\230\002\340H\235\362Z\222\233\272u\245\366\244o\330=\013-\203=\373n<\266\324\347~s<\352O\363)\347\364F\007\352v\376 \211\303,\035-\377q8PW#\021?\332\357`\352\324P\\1\306\337p\332[\302\352\332\250L\301\225pR\225}9\225I\0208)\212\274"
+	.ascii	"\001b\314I\377\2137B\217\005\0364G\303\223\003P\0218\330\342"
+	.ascii	"\322\264\006J\022{&ZLR"
+	.string	"\203\336\337\341\217\274O\242\301 \224>\240\241\314f\234\307\223\033\013\267m\332\240\b\330;7.\366]\f\322q\366\354\227r\036\353\377B`\325\372W\027\370f\225a\302n\206\355\357,\253\205\245\276#\3572P\310\332x\263\351;Y\365\300\351\237\023\347\204M>\310\310\353Z'\334\\\272V\374\235\371L\264\"\326?[k\264\322\233.\207\346V\234y\204\f\247\005\027\217;\253\371\344\205\270\251y&\r\b$,\367i\036_J\272\365\310\017h\001RB\367\031\bG8\024n\355\336\364\001\331\333\375\"%9\f\356UJ\317\350\257\021\352\373\257\250\025*\200\212\275C\032\201>\213\324\330\2176\301Wo(sz\223\331\244\334\r\314\305\367)\311\233\021B.\200\226\b\361\347\203\223-\016\335\3328\315q\276\202>\"(\037\320\235jD0\210j\236}k\215\326Ei\033\030\303\\\213\005\b\305\377%\250\3640:\335\005\271"
+	.string	"\245\025\036\001\013V\206\227\224l\017\005\366\356/\221\233\024;9\264AY\222\332k2\334N\305\337\001\344X$ \344_\333\375\245\215\213\016\315\265\024\216bG\022\203\236y\372\274Y'\204\230F2z\212\353_\032\331i\251C\350I\352\202\330vz\353\270\305\021\347\337G\tLq\320\320)\316\345\271hq\003n\272\t\201w>_-\353^\225\220_\334,f\212X\227V\220\005i\344\376\355\354)~'p\355\017\366#\330,V\2474\212\332\377\226\177g\204\244\367:9\306\210\366\\\203fz\003\367\223f\335\320]\342Y "
+	.ascii	"\333\244\341-(J\251XV(\027f\250"
+	.string	"\361\242\004\034\037\330UB\336\216\360/I\325]\343\324\334#<u\005\026\237.\225\003\341\230\257x\302)\332\227\235\223\330\316B\035s\377\311\244\333\360\227\350\3724T\331_I\006\f\"t\264\305,53\270\206\232G\322\310\013\352\272\245\211\353\273\rL\2626\317\030\203\036\365J.`\362(\314\234\210\260@g\007\360\315\343\317\027\024\325SH\025\220;\213#\305\304\332\275D\326\310\274J\326\266\351\320\3063\"Cl\f\017\360\336y\364\257o\315\004!HY\001(z)N\026C\263U\n$\265\032\305\307\3452w:\321\2000d(\326\350\006\214\265\337\022C\370\002\fo\223\t0\330\007\345\022x~\177\341xI\313Pd\376n\367\346\267pPKd\204\004\301\017+\031\370\237\215\fO*\244{\353\030P:t\025\030\003\354\377\340\236\271\374\320\344\313\254\016Id\005\016\f\"\nd\326\233\023\362\203\253\237\345\313u\032"
+	.string	"m\305\371\264\334\262\034\017\256\224!\341T\224\306=\322\225\354;\201\273`A\356\002\031D\023 \315\271h\234\345\013rs\341\005\357\024\310P\\l\237\037\205h\236!{\235\334\345|\310|\021(\002\234\340\331\247\017\271%x\350\304Z\220\225\237!{\324\316\341{\250\222\211:%U\331\026RY<Z\005\253\247\365\001\224t\022S\235 !\037%\325sB\251j8>\3017\346\241\223\257\367\025:_y\017|\030\365p\345\020\257\205\210\323i\246\3002\3517\235wu;\f:\307\310q\027\220\232\314\252z\227?\241\262I\261\252\311.1\211_4/\220\336\365] \373"
+	.ascii	"\344\377\361\310[\207\337"
+	.string	"G\027\263\322\300\326\320zp\276\307\270\317l\330\270&a\375\036\200\202\275\242:\320\250y\377ve\361\2206,\316(\272\226\357\325tQ\335\3622\f\262Z\341\355\330\226e\315\353\215\334\307X5\361\221G-9=\262\310\037h)\235\036\216\031ra\377\225"
+	.string	"\214\245\027\002\320\226\177l\305\352\227\277\314IH\305\324\262"
+	.ascii	"\262\262\315\n`\"\252\244\017\205\216\017\371\003\f\257b\316"
+	.ascii	"\221d\314BPY\233\3448\340`s\325024\355\255\3441u\305\357\033"
+	.ascii	"\013\330\243\243\226\n\301\235j\206\005\227\376T\013\2422\t}"
+	.ascii	"\225\266\020\367H\243\213\2253\263H\363\205\314\226\374\270\322"
+	.ascii	"\024\263O+\242\262\316\354\001\262\322\007\262y.\263\222.\177"
+	.ascii	"\373\334\354\277\330Lr\211\241\200\303\316%\025\330\207#\362"
+	.ascii	"\242n\005\030\330\353E:\017\001\006\302\321\247\272,\260T\254"
+	.ascii	"V\023\377<\340R\353J\030o\"\355\201}\347h\300\325h\337a\343\265"
+	.ascii	"\023\220\335e\201\224wvQ\353\006\247B\223A\327\016x\335Z\\YW"
+	.ascii	"o\237j\206\022L\330\234\253\333\022\004\226\215S'\004\nR~;\217"
+	.ascii	"\373G?\372\367\030\205\252jD\361\361z\3236\341sjI\200e\002$\214"
+	.ascii	"\302\316R~\224\033\310P\233\005\303<7h\223er\266\276\033Q\360"
+	.ascii	"U\242\361\213\322\022\027\320i\211\300S\310\377\266\357\207>"
+	.ascii	")\261\311\235X$\214d\343z3\207\0371O\320Aa\231\271t\312=\320"
+	.ascii	"\377\020P\204%\250\034:\034\324\215\205B\325\330H\222\253tt<"
+	.ascii	"\372G\277$\300\020\035~y.Q<\323\3154\\\245\231`\022E\25224\252"
+	.ascii	"\303"
+	.string	"\377s\236t~\333)\0309\366\364\330on\353\260\335\033~\262\357IW(\f\255\264\203\237\356\254\034\216 <\377Z9t\323h\366\265\304\370\022;`\264\031\264@NK\260\265R \243\242\374\235xMj\306\363\013oJ\305f\371\314\001\035s\211\213\031\300J\341\b,\321\253\250\346\232\247#\336\222[\023D\343\273\332\346\223\032\376$\005\344\251*\251\222o\354o\017%4\333\006\303\004\361On\013\216M=\255\365\205\374\205\344L\257\"Q\261\233\"t\304m\345\260t\247*!\025\243\200$\373\023F\b\307b\221!4\221I\315\305\314\261\223,\326\"P\206\215\3370\\f\306F\201s\327W\207\254\035o\354\374zq&\236\317>\255\376|\004&\367\213|\3358\364m\320\035\361\3320\371t-U\213+\262\003\356Y\232\305\b\317\022\275\240^\320\r\265f(ty\237I\220#\306\032j\244\022\236s7\317\307\216\370"
+	.string	"\246\037\027p\223\210S3\274\021\204xv\033\222\332\310\024\372\307\352\362\354\226"
+	.ascii	"f}\217\264XT\001I\244@`\316\367Z\277\263\212\246\341y\377\337"
+	.ascii	"*\312\210\305S-\235\001W\335$\203\016\356\2139\2166\250u\200"
+	.ascii	"c=\n+\310\350\271X\216M\322t\241\030F\366@P%dSe.e$5\216\377\300"
+	.ascii	"a\347\024=>\251\255#\255\017\363?i|\340\001\375\320o1\037\255"
+	.ascii	"\217l\221\252\305E\300\352\024\200\364\004\3733r.\313oFz\200"
+	.ascii	"\027\206P\317\227\177\bNR\002\275\367\347\351\003_9\272\bc\256"
+	.ascii	"\205W\036\324\364\244Y\200U\272z\250\206\032\037\007T\350\270"
+	.ascii	"\306\375\344\250\3034\302\376\261\254}\344j\251\007\035"
+	.string	":~\226\240u\360Xp\253_\267\275\335\311\363j\374\322B\f!\305\217\237\245\2454\355\202+v\230/\321\313u-V\322\355N|$fG\335\\\267R\242F\006\254v\241d\3109\341\324x\351\237t\246~\201\301\244\225\235\n\276\224\b\315\326;\227\3352\266\374\366\031\344\f\002\367\305\025\201\364\013\207\354\354\034\254\216\210<\021\371D\307n\005!G\177\323\272\034\016\270\n\030\267\237\230\347\210\353\206a\377\2604\021\324\004v\241\205\262\234))\350\350i\206\274;[g{^i\252]ic\274\375q\327\334\256\273\335%\035\205\311\213oX\027\331\303\210\204\221\325 \301\3711)\022\251\037\326o\023\177\246N|\t\317AS\026f\302\335\030\177\021\371\363\367M@Z\234\217\033\0010\225\3026\030\2759\030\\\345\215\223\354\234\264`\250J\026w\013\356\0234&\266p\3530\234l\220\253\304\236b\355\r\311<\020_\036T"
+	.string	"\324\366\242<#`\361\351\265<\017\033\267\223\254\023\245\212>\336o`\204\245\261\333S\230\002Y\335\374\215\222\377g\232\250\374\r**Q\207\327@&O\215\260V\312h;\272\260\223\217\222\233y\243\231 \357\241\001\320\254\037\034\257\357)\325\342U\226_\b\270\023\354\242\265\022l/U{\"#U>\2217\020\267P%Y\307a\347\357\317\r\252\005\327(e~\333W|\340\323ax\n\301L\020\271\242\005\215\377\243\311T\2231<\223\035=\233e\270\312\202\024h\332,\262=\033\2617\357*"
+	.string	"\210\32089\276\241\212n\256\327r;!^\366\334\231\"K\220\2623V\036VnR\270\225\265\f\333K_G\256a\302?\243;\337\257\366R,\236\255m\276\253 6\341\032\201s\302\215y\255c\"\273\n\375\355lN\f\20096W\355\"\223!Ke|\016BO?^\375JtF\004jd\013\020 \203\025"
+	.ascii	"\357\377\036M\334<\023*:\252w\346\202o\276\210:\253.\350$\336"
+	.ascii	"\233\355a\n+\007\231$\n\376\245']\252\007G\360`\037\024\210\243"
+	.ascii	"\316\236\022\350\315(\324S\274\036O<\342\355\210TT\201x%\301"
+	.ascii	"\345\332\303\331\027\300b\327\360~\350\036\321t\377\032\316\033"
+	.ascii	"\214\022\233\006\355*\032\254H\207\210\331\224\026\027\374\211"
+	.ascii	"}}H\022\262\374\n\031&\364\252R\2179\277*v<l\3546\332m\375\327"
+	.ascii	"S3\277o\016\270\003\220d_+\002\204\262\237\261 \017\311\266\276"
+	.ascii	"\375\2067\251\027\373&\244\333=\031\021\356\347\324x\t\220\233"
+	.ascii	"6D\311\013\013\360|\230\033\267\033\364.|dV\035\354\227o\215"
+	.ascii	"\221\n*$\"\375T\322c\007\246\316\002\242\312\341;\257\326\226"
+	.ascii	"\302 )\303F\302\212\3240`\224\021\370\326B\350\024\023H\001\013"
+	.ascii	"4\225\376Hd\330\234\275VP\\8:\227&\373A\251\217\236C\261RE\230"
+	.ascii	"\001\340\004\321\312&\264\246\362\265\343\262\240Hp\344\371\023"
+	.ascii	"\231\215\301f\247\027Z `\367\301e\3067\013H\363\365\325\335\251"
+	.ascii	"\177\305\372\267\324\231B\r\357IsT\264\231JeW\023\322*V\271\252"
+	.ascii	"\247\307\321\306\321\233\211\002:\313e\256\"\036h\217^\373G\264"
+	.ascii	"\\\215\020\254?\022\037\274q#\033&\223\267%\305\321\2165\262"
+	.ascii	"\354\223wwJ\211\310\317\353J[\267\211\245`i-\375\220\304&H\216"
+	.ascii	">_\332M\300\276%\351\374*\260p\320\247\024\373\32724\346\206"
+	.ascii	"\005\256\025%\2755\\<oi\216:z\312\001B3\306\317n,\307{\261H\261"
+	.ascii	"\216\276\210\277\245`F\020\222\254\217\201\344P5\262\220\201"
+	.ascii	"W]+\314dhe^\311\372\370ALW\f\320\031\001L\2724\246h:\232X\325"
+	.ascii	"\267\311\327\367\337\221(\364\367a|\302\233Nt\242\210\302\215"
+	.ascii	"\344\2743\003\366;p\200\360dI\237|\245\2679\223r\220\035'Z\021"
+	.ascii	"<\240\301\230\35176\001\352bP\337~\n\227\254\333\340\320\315"
+	.ascii	"\357\365\310\276\251\333\270\226\270%V\027\365+\225\r4\360G'"
+	.ascii	"\3309pA\b\361\035\234\355\026B\215\260\230\024\216Zk\300J\367"
+	.ascii	"\370T\262\355\367\306\374es\221\3305c;Yt\312\276d;\231Q\354W"
+	.ascii	"9s"
+	.string	"v\235K\005\373N\376\336\345\025\221\363\333\304=0\2242\336P\375\n\247I\245\301\016\006\370\020\375"
+	.string	"{\3178e\035q\210\022P/Z\310E\304\260\340\261\246\004\231k:}\302_L\314\357y\214\261\235\375?\353g\205\031\325\220\202\311\215\211\210PR\007\t\fG\3640z\300|=8\205?\307\260=\341\031S\330kJV\353)7\0033"
+	.string	"\f\177\235\270\234\230\267\205\341\364\241\274\246\273\322\323\260\237\304\016\255\333\223\360\363\034fZ\217\253-\204\304Zx/\276\220\021\244\240aKH\201\213f|\204)\316W\\z\376\324\334+xD\262h\253X\004\034o&\214\345!\222\202\325\\\037u\222\2178\340\207 j\265\204\300\361\235\004\375\217\033\320\247\215\261,\277j\332\2721\340\353"
+	.string	"\024mY\343[\022\311\307sG\344\207\271\027\352 \332\240#w\215nM \262\235\330\301\233-v\240\310\b\036\034{FS`\253\233\002\352\033\314rH}\275;j\343\363q\027_8\007\ta\340Kg\271\237\021tf"
+	.string	"\253\266\205\022\203\237\337OgjD\002\367\341\253l"
+	.ascii	"v\237I\2007\006\302\210\300\003\020\352\020cz\255\353\273%\336"
+	.ascii	"S!]E\345\377\377w\241\303l\250\323\025(\216\2273\322Z\247G \235"
+	.ascii	"\330\351\200W\027\251Z=`\315\332&u\315\220m\006`\354!\244\205"
+	.ascii	"v{\270(\300\3731\313\030\370\317\217\254\304\021\200t\371s\203"
+	.ascii	"\255\2020\006\313s\245]s\311\273\335\3441\001\301]\326\242`\265"
+	.ascii	"\212C\036x\005\351\314\255\302\326\351\206\236.\361\222\037\275"
+	.ascii	"s\240\3035g\235\005\263\033N\271\237\007\016\374b\310\027{4\021"
+	.ascii	"a\274v\256\256\2760:h)Qs\021d-_Hm\004\253\244\222\224\031\232"
+	.ascii	"y\353\350\"n&\005\b\231\200\266\226\242\n\027 \314\232y\340c"
+	.ascii	"(\244\277D\250pK\265\305\367\005\340\247\364\371a\256J\203\341"
+	.ascii	"\274kD>\031$s\273\263\025F\362\221\326\303C\006\004Z _i\025\254"
+	.ascii	"5N\360\321D\203\211_\270\226u\320 \3426`\203\322\032\353\202"
+	.ascii	"\343\337\222\350c\344y\370J\214\r\005\244\345G\030\300\214\032"
+	.ascii	"\276\272]\343\"\362\205\016\321Ok\023>\231\263ON%\327\013=\223"
+	.ascii	"7\325\324\246\024r\244C\205\334t\020\323\202\244\351\364\323"
+	.ascii	"\371\023d\021\210\304T\177\335L?\344\342\217|\333\033\351\303"
+	.ascii	"\262\235\374u0\330pO\\\346]X\006h\233\212\3266\322\373\r\n$d"
+	.ascii	"\024\235\343#*L@~D\302\022\232\200@\336]\224w\267\332wU\335\266"
+	.ascii	"7\023\356"
+	.string	"@\b\202\024\007:\333\305\353GyJ\027\265K\304w\214\007e\3618\243#{\t\304\326)\231\317\0038\315\206V\234\221\331\222&U\275\241\025\201\257d\356\356fN`|\313\023\300\231\320;\\]I\340\225\035C$V\267\307\"U\320L\251\264\001v\360G\216\274]<\227J\306v\370\274H\300O7\234\230a\300\274Z\322\226\313[.\375J\204\355\031nI\240\363\247Q6%\364\306\025f\001\251N\371\032\240\324\256dG\307\224\034j*\365\241\371%\331`\322?tD\353\227Z\223\305\237\343\020\362W\bi\274\021\260`U\272i\002Wn#&\317\222X\261=\333\361?\203N\376\314\336kq>\030\017\213G\232\265J\203\r#\f-\267\354\252\305\323WO0\2001i\261\023V\021\361\353\333\223\2222l\006\036\320N\270\363Z8\\\276\033p\031K\003\273\313\371\366x6\306 \356<(U\243Z\303\204\373&\t"
+	.string	"\234\211\005g\323\240\r\022\306v\tW\301\257f\350}\372\330\372\237iO\317\030\260\375\232Z<\344p\212\323\370\347ja\240\231\026t3\372C\212\004\2142\364:\206'Q\323\210d:\263T:\223\262m\254\203\334<\211\317\361P\364\226h\377\334\356\307t3J\345\007\236o(\277$\221\267Px\210\bQli\317\n\252\021\244\242\307l\265/\r\006>FM\026\\\230\367y\001)\244J\334\251W~\330/\223\304\325\366\231JyK\373q\350I\003n\263\351b\036W\315E\250\231\233O\315\"\t"
+	.string	"\323\256\220\222li \003'B\370\375\310*\224B\253K\033\316\207\265T\342\361e\320\276(\374\022!\214\274\r"
+	.string	"A\016?\017_\t\345\177\004ClO\240\240\211\363-\236\352A\230b\241B\317\374\002\261\354-\233\216AB?[\034e5\3161Zi>\370\017Y\270,\237\276\036\262\352\247*\004\252c\361\311\027\021\310\013\220v\361s]\314=\216\236\320b?As[U\314\341Ih4o\240\326\246\363\304\373\337\034\321\260\022\\\376\313\r\"M\313\334\017(\257\233\317l\264="
+	.string	"\2021\376"
+	.string	"\335E\273Xq.\276*\021\303\246p\236\025\0027Ds\2710\034\2110td$\356\2446!U\0335tv\r\266T\007+\203\f\375\251'\256\310\274\247\354\233T\002\360\177\313\b\351\244\2358\203\200\254\204\316\013\026\027\354<\037F`\327~\277\236bL\334\235\230[\302\312\0239~\347\016\024\013\336\2452\332\321\007^\237\b\375\003!m\377\250\202p~{\315\036c\207rq\025\020\341\263\223\222\307\302\351\244T\355:+\334Sp\366\025rk\201\213\373\232\033\r^eoD\321\244J]\237\352\310\260\207\371\233\022\030\2773\277c\246\024\245\020"
+	.string	"\203=\374:\273\0028\006\031J\036k\023y\276\317\374\232\2718\214\0071'\322\324\346i\374i\267/\205W\t<-\203\316VyW\300\th\025K\365>\244-\007\f\371ti\005\037\265\001\034{\301|S3\255><\237\203Hi?D\226\316l\2436\035U\246\221A>\262\0169\361\321!\307\267\342\020\332q\366{\330\354\232\234"
+	.ascii	"\001i\353CO\rY!\377E63\255\321\307\343\231\334\224\262?):\363"
+	.ascii	"4[\t+\026)\t\253\245j~p\355\206\201\005o\260P\224<\257\223<:"
+	.ascii	" \373\251"
+	.string	"c\023(\3345\354?\345\207\334\352\037\367A\006\347\020;!\216\321)g\303\225\225\236\310p\034\220\025\347a2\013\203\350l\206b`\203\370\201\351\226\300\025\361\210\324\363\367\355\240\233n\235I\262\274\231|\031\\Y\b\013,Fd\274\300\td\004>}\300@%q\317\t\251N\302\310\206#\371(\213\302}\022\305G\355\276\364/\255\021\264\231\201[e)\254\201\326\351\300Wa\2504-\364\256R\263IWP\306jG!\002C\227\334\213Q\216\341\034da\002\347uf0\220\245\233\026\034\267\177+\032\212\244\364<\362c=\003\003Ya\246u<\316\277N\223d0\373r\2718\003\027\304Na|/\345R\313R\311\3273\326Cv\262?NfY\"\024\357\233\260kQ\233\f\n\023k\005)\322)\257L\273Q\021z\201#\333q\334\206\204\274\323\243\355>\267\374\2122\267I\225\341\315\2169\350\233\353\204\270\314\371\355"
+	.ascii	" \003\356<2\247\310\357\376XS\034\237\340\256\364\373$\252\\"
+	.ascii	"Oa6\352rE\271?\273\257\317\205\251ixE\323\023\013\317\237\035"
+	.ascii	"\205\323\234\345\023\2136\346\321WW\255]s\360\234\332\241\374"
+	.ascii	"\210\271\333\264\332\320\024\343\274\342I\377\005\b\377Xj\336"
+	.ascii	"K\240=\247L\255\225.\005\007\213\216\037\n\363\264\230\226\267"
+	.ascii	"\345Y\356R\314=\214\336d\303]\370\357\361\263\035\310?\355\277"
+	.ascii	"\225(c\362\"\372\022S7\342/?\301}\264\226\246Ah\342\240\250\177"
+	.ascii	"\031\376\236\3208z\2375\207\213\2034\304\301\024\234\020\255"
+	.ascii	"\2644\177D\206\267\274\350\225\250\215\305{\213\272\371\240\213"
+	.ascii	"/\031w\340-\356l\362\312hv\036<\204\235\363yb\365\005\356\317"
+	.ascii	"\2569\r\325kX\366\221x\344Ej\251_~Q\343\233\3679\265\312\261"
+	.ascii	"Q}\333\340\376\031\360I\371\316\302W@\216_2\334^\367\3708\216"
+	.ascii	" \310\350\203,{\276\327\0375\305+\277{z'\375\356'\265\327m\274"
+	.ascii	"\330\350\251'\216\360\236\r\224l\374h\016\372!7\b\344E+\273f"
+	.ascii	"\276K \263\2025\023\232\320\247\207\f\266/s\177\306\326\f\370"
+	.ascii	"S\\\214_\303\336\327\261]\344p\022\317\334\361\204\216\264\205"
+	.ascii	"\274z8>\221\314E]L(\326a\217\327\204\3279\363\343\030\270\013"
+	.ascii	"1rF\324\305\273CL\202\203\254\317\n\337h\310;\213\264\221\261"
+	.ascii	"\\p\377\314\033\352\317\320{^XN\306?d\350\337\363G\177rmU*\225"
+	.ascii	"\334\021\274\211\224cZ\027\247\344E)\301\243X\333\335\333z]\220"
+	.ascii	"s;q{}\367\"\356f\177m\373\355\316/\035\257\223wi\002\306_M\352"
+	.ascii	"\251\362\327\337?\371\037.\334L\335mlp\005\314\315\360q=\201"
+	.ascii	"\352I\234w\333\235\305\322\031\033\331lP\311\034\215\371\337"
+	.ascii	";\274\276z\273\323\344L\3365e\t\027\326SBq\307\342\371\377\250"
+	.ascii	"`\376\0169=~\002=/v<\234W~\314\276\375\"\375$\006\201\\\0139"
+	.ascii	"\235\314\375CL\206P\3219\246\215\252\267\215\321\366m\234s\316"
+	.ascii	"\331f\363\343\2315n\303\020\335\332S&\343;\226ckw\n\374]R\234"
+	.ascii	"\013\366\336\213\231\203\352\311q\301\250\243r\207\357\026\373"
+	.ascii	"\"\2679\021N\237K\346\rZ\364\277\325\360jr\267\215:s\367\304"
+	.ascii	"\256\254\373\0356g\020\355/\220\034\213\333\177\301\261\004*"
+	.ascii	"\177\222.\005\365\234\304\373Y*G\253W\351\2551L\326T\370I\321"
+	.ascii	"\301\226\334]v\2426~Z\277\377\036\365\023\206\031\354\376N\252"
+	.ascii	"r\276z\303\376\272"
+	.string	"\323\017\377_\211\317\027\024\311\020Di3\b\031\214\343\343\016\004\337 :\033\366~\206\335[\254<)6\267\t^\033\334\351\"|\256\347\275\020\211\341\177<{sS\200r\265\261\263->Tg\214j\274\3348\353s\353\356\260AC6\340bBN\351\364\311\307\343D\277\353\002\346\200/\037\034\250~<<\356\2540}@\376.\275\370\003K\215\032\206\032\374\243\036\304m\263\340\242\004\376O\312\203\365\240\225\310w_s\247e\007m\375\335U~\365\277\265x\272A\371\363\262zf\370^\f0/\300\277\001\210r\2267\357\372i\337\253ZW\346\016Dn?\320\346+\375*z\331\275y!\246da\324\341\027!\371;C\262\207\366\343c\346\237\30748\023\270\374A\235=\256\2762v?\350\374%\263\030<\312\313}\254b\374\024\256\214b\331\3031\330\304N\350\342\362'\224\261m!?d\320\261\005\316m\376\326{_"
+	.string	"\361\324k<"
+	.ascii	"\360\322>\337`\211\006\340\3119O\255\031\360\314\253\232\265"
+	.ascii	"~\345Z0\353\333n\016\316#\320\230\003Y\215x;\344\213\272\225"
+	.ascii	"\027\351\220\267/\t\261\022n?\271\005w\344\261x\007\177\377M"
+	.ascii	"\212\353\003\f\355s\226}\260\330V\253\201\342V\340\225\033\312"
+	.ascii	"\335\250\370\330\213\263\326`\214\357\177)}\030\356\371h\373"
+	.ascii	"\235\036\236\021\374\254\364}\335\317\020\261\013\347\033\033"
+	.ascii	"\225o\356\362\235\fonE>\243\347\300\343\326\344[4&e\232\241\334"
+	.ascii	"3/\f\363?q\031\320eijL\257\226\313m\357e\315I\367\230\367\306"
+	.ascii	"\314\244\332\327\252\333h\275\350\377Z]\216\304o\2200\t\351#"
+	.ascii	"\021C@\375\212\244w\270\277(\270\r\221\357\241\206)\177a\201"
+	.ascii	"\366\033-}\253b\002\360\337\361\3262\177\300\"\367\274\305x`"
+	.ascii	"\f\336\263{\357\210\035\\\377\337\365\b\272\234\232\205\r@\217"
+	.ascii	"\346s\241a'\b.\216`v\367N\257\331\317eg'nt\250\227\333|8$\237"
+	.ascii	",z\0337\317'\263\330f\314\247f-5\375\261\334[\260\rE\214'\234"
+	.ascii	"\fx\312\277\343\203RvJ\300D\264]I\177\322\303z\324\233B\375\005"
+	.ascii	"\355cH\017\277#\230\271\352W\334\303\366\322\235\363p\346Y\r"
+	.ascii	"t|\256\334X\217\217\202b\346[\317\333YTk\262\027\363Yq\236\227"
+	.ascii	"|\272\233-\327\350_\021x\253B#\300W\001\017Nv\263\352\211\305"
+	.ascii	"'!\243\215\243p\377\316\245}-\n\236\365c\305\335\374p\253\320"
+	.ascii	"c\366\207mD\034~B\362%\262\205..\r\344\200\373i\016mf\375\340"
+	.ascii	"\322\037\203\367h\372\221\353E\017gr\302}\312\275\027\344\277"
+	.ascii	"\356\277|\237\246q\254\375\217\316\307D\235\370\240\327\365\240"
+	.ascii	"\201\350\271\316\013.\355\341j\342\223\035v?\345^\371\177g\351"
+	.ascii	"?\223\370\367\353\215\211\354C\341\351\214\346\305\332\036\372"
+	.ascii	"\247A\246\251&W\036\356\370\344{\364\313\310\332\271g\327\020"
+	.ascii	"y2\261Z\375\274\222\352\360\256cX;\307\204\326\227\3559\200\323"
+	.ascii	"\224\305M\371OT\372\312w1i\211\232 \334O\0049\344\375\263\310"
+	.ascii	"\264\316Q\207\210Sv\312\205\256N\242^0\237\354W\302\275\276\005"
+	.ascii	"\377\001"
+	.text
+	.section	.gnu.lto_.symtab.162a51487001df88,"e",@progbits
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\006"
+	.string	""
+	.string	"blackboxMayEditConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\007"
+	.string	""
+	.string	"blackboxValidateConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\007"
+	.string	""
+	.string	"blackboxFinish"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\006"
+	.string	""
+	.string	"blackboxGetDroppedFrames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\007"
+	.string	""
+	.string	"blackboxLogEvent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\006"
+	.string	""
+	.string	"blackboxSnapshot"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\007"
+	.string	""
+	.string	"blackboxCalculatePDenom"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\007"
+	.string	""
+	.string	"blackboxGetRateNum"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\007"
+	.string	""
+	.string	"blackboxUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\007"
+	.string	""
+	.string	"blackboxGetRateDenom"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\007"
+	.string	""
+	.string	"blackboxInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\007"
+	.string	""
+	.string	"pgResetTemplate_blackboxConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\007"
+	.string	""
+	.string	"blackboxConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\007"
+	.string	""
+	.string	"blackboxConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\007"
+	.string	""
+	.string	"inputSource_e"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\007"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\007"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\007"
+	.string	""
+	.string	"GPS_home"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\006"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\006"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\006"
+	.string	""
+	.string	"motorOutputLow"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\006"
+	.string	""
+	.string	"rcModeActivationMask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\005"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\006"
+	.string	""
+	.string	"dr_state"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\006"
+	.string	""
+	.string	"dr_control"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\006"
+	.string	""
+	.string	"dr_fp"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\006"
+	.string	""
+	.string	"dr_vision"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\006"
+	.string	""
+	.string	"dr_ransac"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\006"
+	.string	""
+	.string	"axisPID_P"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\006"
+	.string	""
+	.string	"axisPID_I"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\006"
+	.string	""
+	.string	"axisPID_D"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\006"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\006"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\006"
+	.string	""
+	.string	"mag"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\006"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\006"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\006"
+	.string	""
+	.string	"motor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\006"
+	.string	""
+	.string	"baro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\006"
+	.string	""
+	.string	"servo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\006"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\006"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\006"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\006"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\006"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\006"
+	.string	""
+	.string	"blackboxHeaderBudget"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\006"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\006"
+	.string	""
+	.string	"motorOutputHigh"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\007"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\007"
+	.string	""
+	.string	"targetName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\007"
+	.string	""
+	.string	"shortGitRevision"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\007"
+	.string	""
+	.string	"buildTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\007"
+	.string	""
+	.string	"buildDate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\007"
+	.string	""
+	.string	"pilotConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\005"
+	.string	""
+	.string	"voltageSensorADCConfig_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\007"
+	.string	""
+	.string	"currentSensorADCConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\007"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\007"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\007"
+	.string	""
+	.string	"controlRateProfiles_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\007"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\007"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\007"
+	.string	""
+	.string	"barometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\007"
+	.string	""
+	.string	"compassConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\007"
+	.string	""
+	.string	"armingConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\007"
+	.string	""
+	.string	"featureConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\007"
+	.string	""
+	.string	"blackboxEncodeSignedVB"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\007"
+	.string	""
+	.string	"blackboxWriteBuf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\007"
+	.string	""
+	.string	"blackboxEncodeSignedVBArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\007"
+	.string	""
+	.string	"blackboxEncodeUnsignedVB"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\007"
+	.string	""
+	.string	"blackboxEncodeTag2_3S32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\007"
+	.string	""
+	.string	"blackboxEncodeTag8_4S16"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\007"
+	.string	""
+	.string	"arraySubInt32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\007"
+	.string	""
+	.string	"blackboxEncodeTag8_8SVB"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\007"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\007"
+	.string	""
+	.string	"blackboxEncodeSigned16VBArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\007"
+	.string	""
+	.string	"rxAreFlightChannelsValid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\007"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\007"
+	.string	""
+	.string	"failsafePhase"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\007"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\007"
+	.string	""
+	.string	"getRssi"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\007"
+	.string	""
+	.string	"rangefinderGetLatestAltitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\007"
+	.string	""
+	.string	"getAmperageLatest"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\007"
+	.string	""
+	.string	"getBatteryVoltageLatest"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\007"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\007"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\007"
+	.string	""
+	.string	"blackboxWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\007"
+	.string	""
+	.string	"blackboxDeviceReserveBufferSpace"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\b"
+	.string	""
+	.string	"blackboxPrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\b"
+	.string	""
+	.string	"blackboxWriteString"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\b"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\b"
+	.string	""
+	.string	"areMotorsRunning"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\b"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\b"
+	.string	""
+	.string	"getArmingBeepTimeMicros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\b"
+	.string	""
+	.string	"blackboxDeviceOpen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\b"
+	.string	""
+	.string	"findSharedSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\b"
+	.string	""
+	.string	"blackboxWriteUnsignedVB"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\b"
+	.string	""
+	.string	"blackboxWriteFloat"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\b"
+	.string	""
+	.string	"blackboxWriteSignedVB"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\b"
+	.string	""
+	.string	"blackboxDeviceFlush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\b"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\b"
+	.string	""
+	.string	"gcd"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\b"
+	.string	""
+	.string	"blackboxPrintfHeaderLine"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\b"
+	.string	""
+	.string	"castFloatBytesToInt"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\b"
+	.string	""
+	.string	"dateTimeFormatLocal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\b"
+	.string	""
+	.string	"rtcGetDateTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\b"
+	.string	""
+	.string	"isBlackboxDeviceFull"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\b"
+	.string	""
+	.string	"blackboxDeviceClose"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\b"
+	.string	""
+	.string	"blackboxDeviceFlushForce"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\b"
+	.string	""
+	.string	"blackboxDeviceEndLog"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\b"
+	.string	""
+	.string	"blackboxReplenishHeaderBudget"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\b"
+	.string	""
+	.string	"blackboxDeviceBeginLog"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\b"
+	.string	""
+	.string	"blackboxOpen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\b"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.162a51487001df88,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
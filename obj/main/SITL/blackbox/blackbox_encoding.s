@@ -0,0 +1,1288 @@
+	.file	"blackbox_encoding.c"
+	.section	.gnu.lto_.profile.7f1fe50f3fd0f3b7,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.7f1fe50f3fd0f3b7,"e",@progbits
+	.string	"(\265/\375`%\001\345\b"
+	.string	"d\r\031\002"
+	.string	"\027"
+	.string	"\342\203\351\365\f"
+	.string	"\001\357\350\332\204\n\002\002"
+	.string	"\002"
+	.string	"\002\346\371\265\305\006\006\002\001"
+	.string	"\002"
+	.string	"\004\355\232\254\270\007\004\002\002\005\362\263\350\327\003\006\216\272\367\306\016\002\002\003\002\003\007\321\265\305\350\003\006\b\332\217\267\212\f\006\002\004\002\t\264\325\273\271\001\006\002\005\002\005\n\252\212\212\215\003"
+	.string	"\013\242\247\237\212\013\002\002\006\002\006\f\213\215\316\230\r\002\002\007\002\007\r\353\206\240\252\016"
+	.string	"\016\310\212\262a.\001\002\b\b\002\b\017\360\372\372\366\004\002\002\t\002\t\020\245\277\256\207\b.\021\354\376\324\307\001(\022\250\235\326\320\b\002\002\n\002\n\023\246\305\243\350\013\n\003\002\003\024\335\255\275\341\016\002\002\013\002\013\025\324\230\357\263\006"
+	.string	"\026\274\320\320\213\f"
+	.string	"\027\240\342\234\212\n"
+	.string	"\035"
+	.string	"x"
+	.string	"\270\315\021;;\003\\,\345"
+	.string	"h\030\300,\315*\037\260a\214\201\005n\0363\223\001Xp\223\001X\310I"
+	.ascii	"\002b\006\340\002\310\031\370\013\255\310|\233*\215A\021\340"
+	.ascii	"\022\202\314\002\301\240\344r.\200\033"
+	.text
+	.section	.gnu.lto_.ipa_sra.7f1fe50f3fd0f3b7,"e",@progbits
+	.string	"(\265/\375`\337"
+	.string	"\215\005"
+	.string	"\242\306\022\032\240'\351\377\377\377\003\262\252\252\252*\3567z\373\364\366\351\355'b\311\226R\246/\024\246\373\023\277\030m\002q\350\310\37496C/l\204\363s\360\366\0260-\202\257cl)\264\272<\\\031M\300\337\221/k\277\237\374<\275F- \200\202\241Bv>\025\370:L\271\240\316qf\203\345\262\326H\224\334\232\221\004\202\006\030\304\005\n\004\330\300\316\200rc\020\222a\n\016\302\t~\004[\bV\017 \021\300\342 4\b:b0\340"
+	.ascii	"\351\3312l\230\224\371Do\241g\230\026j\024\337\225\345\020f\244"
+	.ascii	"\013\216Qv\033\210\344\227t\301\027j\b"
+	.text
+	.section	.gnu.lto_.inline.7f1fe50f3fd0f3b7,"e",@progbits
+	.string	"(\265/\375`\r\007\345\031"
+	.string	"6\243yG\320\362&\035\242>\360\304\377\374\267\303\234\034U\027\210&\225X\027\227Ixw\243\026\372\200\027\211\357\334 \307\260\324\003\221\214u@\367\214\204e\304\226\341\302\036F\251\267\270\212\370\377\370\3047,\032>\263\2334\"\223L\001Y"
+	.string	"m"
+	.string	"j"
+	.string	"\035\2149\317^!\f\243Pf\232\023\206Q%N\245\035\363&\3230\f\231H\324\366\310\354@a\b\345\275D\332m\354\256"
+	.ascii	"\224\247\263\323\264_\240\235\336l\267\270t\302h\213\335\355"
+	.ascii	"P\322/0m\257n_\366\335]\316\216\260\2734\366m\263\236\231\316"
+	.ascii	"\006\372\263\273)\373\3041\0031\242\262f\217\265\025\355\356"
+	.ascii	"\212\325r\314\246\345G\277\345A>H;T}\220r\f"
+	.string	"E\305\020\3443\243\304\246)\321N\322O\352\244\376\244\251\213\245\020/\274\324\215\304\356\261\272\325g\312S;b\352bT\351B\223\210\021\257VO\030\005\001L0I\211\304NS\346+\224pX\254\374)\243CM\265\024)V\275\300;\315\3326o\276K\252\003\n.\003F8d\313ep\03267r\0068~\037L?\004\375\020\352\034?\307\217\345@OI>T\034\277\216,\307\321d\024\244st\224]\310\251\007\324Jl\371\223\220\236!\234\277\226\251\374\257\357\302\004\356f\r\213\004\305\211\253\211\022^\3028\225$\221I\224\255;\3607a\234]G\340\272\204[5L\030\327\372\214U4E\001\326\223\027\355\\\016\340\027\230*`\302\332\322\321\373\322\321s\364f?\262\340a'\305\217^L3\214\340\240A\035\275\003\216\236\313qx\204t\036S#\0355O\233?\3136\325\f\204\333\006\262\365\007O9i\007y"
+	.string	"QA\300%\"$\2169\205\332MOv\320\203\265\233\036\327\260\353\213\266\037\277\005\272\001D\315I\375'\3707\200\226\2501Ah&\020\232\021I\n\222d8p\002\031\232)\353\001\022\240\304)\2111\305\220\"#\221\214\210L\220\202rRR(\016\001\225  ;_\224x\312\362;\355\00454\003\243\311;\367\244\316\221zuj^\201\323@\223\251\022\340\265t\256]\002X\244\372-\376\346\261\265\264\026\220"
+	.ascii	"\356N\311)b\210\262e\236PIuI9\206\033w\213\305\240\306\252\226"
+	.ascii	"\333\216\364k\324\n\242^ \212\352\230\333\0207}\210\310J\321"
+	.ascii	"zb\306(\354\207!.zR\275\2514h\237\303\321\277G0\b\255\005\250"
+	.ascii	"\326\002\031amK\203R\233\025\373\324\2435\"]\221i\254!\276\244"
+	.ascii	"\301\030\301\226_L\345\267eoQ\030\f\0314\365\035D\373\030\227"
+	.ascii	"\r3{\352\377[}\235\020O\003\232\202\202!\034\002\211\266\272"
+	.ascii	"v\217\002\270/\211\261nb[\254,P\212mR\230b\200\245+\215`\020"
+	.ascii	"\325\271\"M\257\210@\f\2209\0209\260\326\245!\326v4\304(<s\204"
+	.ascii	"\355%i=\220\266\344Y\004\223\242\377\024b\327Lv\027\006RC!)n"
+	.ascii	"\224\357\327\340\030c[\263\025\216\026\331ru\273P\323d\237\351"
+	.ascii	"\346\271\270\220\354\256\305\263\232\246_r\227\241=\f\\\251\255"
+	.ascii	"\243\266\005\017"
+	.text
+	.section	.gnu.lto_.jmpfuncs.7f1fe50f3fd0f3b7,"e",@progbits
+	.string	"(\265/\375``\005\235\016"
+	.string	"&\32371PI\224t033\213H\337\033i5\215\234\252\252\252*T\374\361\030`b\225}E\3461N\024\361J\365\320\036\241\372\267\377Q\343\243\035I\223I\006("
+	.string	"*"
+	.string	"("
+	.string	"/x\005\223\247\356\212}\005\343\250C\"\030p\017\367\305\376b\235\t\332\350\375\371ZM\\M\223U\364\030e\342\313\007\215@\210\257\202\304^b=Zk\255\177\003fQ\205z\355E_En6\221\310d\362\251\033<\203\237gN\2606\372\363-\271\200\253\002\b\336\322\343`\213*\357\203z\316/\274\026&\223Y\035xQ\317\241\374\216\2017O)\247l\207\276\306\273C\370\007K\275\275$I^\003<\n\330\001%9x\323\266\306)\305\220"
+	.ascii	"P(\3444D\223\321\254!\3664\304\272-\224E\016\324\205b\t\037\341"
+	.ascii	"nH\360\266j\250\201\315\232\nD4-)\2449\200\")\"+\017\022`\003"
+	.ascii	"9\001\207\344\2401\212\324\0043\022\024\024\244\270\214B\245"
+	.ascii	"1\226\021\344\332j~\344\213\312\250\200!g\304\302\020&1k\310"
+	.ascii	"\235IB\330\344&y\264\223\205\0340/\304])\264\032\377\230\272"
+	.ascii	"~\336\311\353\344\231\024\375~P\363e\256G\233\306|,W\375\b\372"
+	.ascii	"\013\244\363,\336d\214S\354\343{l\336D\316\273\016<er\355\377"
+	.ascii	"GOuK>\222r\303\210m\214\245\301\361\206q c\306\013\307\036_P"
+	.ascii	"\357\316\215\333\177\020\214m\201\243\007P\204\300\273\bWw];"
+	.ascii	"\021\202\016f\002\202.\361\3577\373\204)v\025\232\3421-Z\346"
+	.ascii	"\001\017\026K\2577\353^\363u\211\341\305\267\021\325/p\207\344"
+	.ascii	"\216\303\241\270\001\215\024\312\314W<\330B\021\275\322\n\217"
+	.ascii	"R\276\006E\276(\237T\360\326\325|\002"
+	.text
+	.section	.gnu.lto_.pureconst.7f1fe50f3fd0f3b7,"e",@progbits
+	.string	"(\265/\375 F\335\001"
+	.string	"b\304\r\025\220+\035efff&ffzi\270\256\353\272\256\233\214Fvs\315hB\367\231\316m>f.W\231\311\207|\3074fq\211;H\302\r\356\023\230j\3322\263)"
+	.text
+	.section	.gnu.lto_.ipa_modref.7f1fe50f3fd0f3b7,"e",@progbits
+	.string	"(\265/\375`\263"
+	.string	"5\006"
+	.string	"\362\306\031%\220)\351P\377\343;\325\260?B)\375\256\377\374bK\271\230\241iu\237\032\3327\364?\370\026\021\302f\233\334)\273G\204\341\274t\"N\215f\354~\203\200\016\347\343\270L$\357)\r\260\005\302\323~\025\243\016\026\034P\260\205\201,\330\254E\306\362(\277s\237\331\nY\261\312Y\260\200\366\022j6\316\333\245\325g%* p\2022f\345\001\224\340k\304"
+	.ascii	"y\255b\210\206\224`\017\266\2708b\217eb\267\211\314~U#\"\343"
+	.ascii	"\353\006\206\361\320\371\002 \367\331\227\333\210?\256\252\210"
+	.ascii	"\300\005 \266\036\301L\220#\3068\2061\242\313&<l\rf\003\0052"
+	.ascii	"\307\315&o\253\345;l\016\355\342\260Oc\274\b"
+	.text
+	.section	.gnu.lto_.lto.7f1fe50f3fd0f3b7,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto__putc.16.7f1fe50f3fd0f3b7,"e",@progbits
+	.string	"(\265/\375`L"
+	.string	"\235\b"
+	.string	"v\021=5P\217\206\003\2438\003\272\002em\313\030L0-\252\300/\202\243\016\317\320\354k\037\317\334\031\205\210\304\262Xb\226\206\263\017\356\232\fZ\302\025<I\333[\312\224\002,"
+	.string	","
+	.string	"+"
+	.string	"\3268\036\320X\253\327\272\370\3738\bdu\022\363\177K\017{F\257\266\211\001X\255\224q\303\360\277\310jm\270\351\266\006mAmW\002\207i)!m\335i\233\330\"$x\376.\232?\007\312\353\277\247\013\306\326#&\361\\\322\026\007\374.\221\327\377y\252\300\261\326\317\004\232\250\n4\253\005\031\231\252\023\323\231\316\006\230\325\214\nc\355\227\302\354h\235\375\177\323\325\372\2633\261\230a\255\321^\004X~\215\230L\234M.\367\201(\221\036:\2564r\260\350D\021\\HB\264\225H\241\211\215;\241\266\317A;\323\350\264Qt\335i\353|w\366t5S\201\251\022\243\033\304l\003\n"
+	.ascii	"`\251'\023\372\374\002\213\013\316\313\250\340\032\373*\fVP\241"
+	.ascii	"\307\035^\264\223\f"
+	.text
+	.section	.gnu.lto_blackboxPrintf.18.7f1fe50f3fd0f3b7,"e",@progbits
+	.string	"(\265/\375`\364"
+	.string	"\265\f"
+	.string	"\326\030YC\020q\233\016\ba\201'Ti\302\340J\024!\3000\002\256}!\013\235U\006D\350\360\003\r<\241\337\0329N\016#\202\367m|\342\347FWU\265\f\273V\212`r\374\226#\201\203i\bK\2266\221;\245C"
+	.string	"E"
+	.string	"D"
+	.ascii	"\001vUB\030\273\337\0023\250>"
+	.string	"\375U\266\375\025/m\266\214\b%\323\211\220\004\352\330\335\353\300\007P\237\323\005P\237j\342\333\345\346\037<\002p\206\207\302]f8\273k\351\241\210\270\365\266\023\330v`\277C6^\364\306\267 bvt4f\f\024o\371\355\373/\036\332\226G\356b\205YI)\355\2565b[\237\2677\037\264e\263\334\305\366\026\022\316\310dR\001#\356\206\320|\272A\365\371\002\227\366Y\274\305\366o\303\003+)%\325\277||\252\335\356\336u?\004\001\311{\224><\004R\212Q$)\347Jj~\227\203\027\f|\330\335{v\b\006y\317\367\020\216b\211r\3667\222Z\302\376\264\252bO\322\324\277_+\0025p\004X\006)\002\242\240\3166\037\241\317\004-\013y$h\320: \031V\241s\205>\030\350\312D!\327F\2015\013\036\321%\242i\242\313\372\272\333\224fNF\214b\247#\223L\273$\036\210,2\306"
+	.string	"$\226\201\237'&\243\310A9{\310\231#\022"
+	.ascii	"`\251'3 \f\013\263\2608\023l\220\030\027\344ku\212\\\325\216"
+	.ascii	"\013#\267\315v6\030\260)\213\301\020>E\016\356\366\250V:\302"
+	.ascii	"$\003"
+	.text
+	.section	.gnu.lto_blackboxPrintfHeaderLine.19.7f1fe50f3fd0f3b7,"e",@progbits
+	.string	"(\265/\375`\333\001\305\020"
+	.string	"f\337nE\360\264f8h\310-lX\303r\251\335$s5B\234\226\275K\346\3678\256y\346\266\213\246\337\302\200\266\020\207\332\270{n}0\264S\206\234#o\214\034|\374\013\315\334\264\315#\260<\313Ec\245M\366\2262\245Y"
+	.string	"S"
+	.string	"a"
+	.string	"B5'\030\t\215F\221q\327\204\3127\237J\337\236\0226q\360\264\377\363\032\256\003\211\370\200\335\036#\242\335p\305\fJ\337\034\336"
+	.string	"\351[\351(\244ov\331GRn\002\f\311\021\227\354\256\247-\356z\272\374\213\007"
+	.ascii	"\356\330<\271\323\356:\301\235\023\267\336\266\002\333\020\354"
+	.ascii	"\334\020\226\371\220\007}\030D\262q\204\332\330!,\225\205}mw"
+	.ascii	"\327\332cki\323\303\277;\320\317ii\325\322\251\245O \365\003"
+	.ascii	"\t\020\"\032$\\\235\031\223\327\321\246#\306\205~\373\376\215"
+	.ascii	"\307\354\3164\037\262\346\030y~v\267\243\261\273o\277\350\316"
+	.ascii	"\017\272\r\327\003/L\241%\017\266"
+	.string	"\220\276]9\025\342\214\024\257\234\231\313\223\0022\366@V\260 ~\323\021\"\033QrS2\362\374tz\034\0270\224v_\007\275\3731\027T\0364\351c\227\220\343#\033s\324\306\002R\345\037\272\270BP\002\264_`t\\\310\306\233\006\343Irj\263>\037\tx\034q\351\330]Dr(\0209\303\322\240+\026\252\245Y\305\362\322\202\311\360\251Z+\227\020_\212\203\n\325!\345\265`P,O\025#\343\261,\360\347a\025\343\315|_\214\327\205\257k\253=\216\200\342\350\2450\327h\273+\036\\\350\037\203rf\325\036\007\223\244^U\265\b\307g\345&M\325\214\340\360\300rf\177\307\215&\370\001& p\202\221c\307\003 \352\215C\333\033\003\351\305(\020\327<\002\f\025d\016o\25401w\005CC6\016\331\357\003\353\236\376\205.{\255GH\036\353\225a\002\357Z\033'X\236\t\355a\330\004\317\2141"
+	.ascii	"b\023,\b\030\374\343\230sh\216\2035\"\300\243\204\207\027-%\003"
+	.text
+	.section	.gnu.lto_blackboxEncodeUnsignedVB.20.7f1fe50f3fd0f3b7,"e",@progbits
+	.string	"(\265/\375`\212\002E\025"
+	.string	"\006)\216J\300\360*\035\313\263\027\204\255_\262g\372\327\037s\026"
+	.string	"\355\360\322\376\377\376\230~\t0\271\021\006)\331\023=\022~\217\247\"5\341\246\331h\254\214\243(\212\242\360\327N\004\2611p\232@\222/>\254\301P\375%\215\220-wJ\001x"
+	.string	"r"
+	.string	"x"
+	.string	"1>\325\352!\211A\371Q\204\236E\316\377f_\325zS4T+\020\201\027\224\037\237\342*d<\013"
+	.ascii	"\004AC\376\204\300\005s\324\nt\031\370\026\371\261<\213\374\270"
+	.ascii	"\037LO\2017\235\263\217t\347\314\017\236\236\360\311\310\355"
+	.ascii	"h\037\251\007q\247\247\332i\240\nj\202\210\037~\352v\266Iux\337"
+	.ascii	"\017o\240W\314\355x\237&\007\265V\317\334\216\346&o[f;\202=\205"
+	.ascii	"\001\275\0328\236m\026m m.\016q\247f\310{c\207\264X\253\377~"
+	.ascii	"\220\003\335\252\373\374\037\027\336)\324\211\234.\377\273M\344"
+	.ascii	"4y\237{$\247\3518\275\343\364\244\323\007@&\275\020`T+\207\242"
+	.ascii	"R=\032[\344\\\370\003}\332\267\317\302\037\nM\364\223\003\241"
+	.ascii	"\374x[\306\017:e\033\b\246\244u(\2050F\330\250\265\036\370\350"
+	.ascii	"\007\245'\360+d\356\023\252M\355\177?E33\351\264\326Z\351\310"
+	.ascii	"S\033\262\247\351\025o6\266\240\243\266\265\r|B\267%r}!\224\023"
+	.ascii	"\217\031\"\374\031\371q\006sH\265Y\364\353\007\220t\311\235D"
+	.ascii	"8^\202\237\226\265\247q\343A-\335\017O]\370\204\270\245\332,"
+	.ascii	"\356\326\004\021uvql\233T\373\0357\024s\t\334D\344.\211\343F"
+	.ascii	"\3424\277\266\354\002\371\334\\\221\231\245\371\217!?\366\233"
+	.ascii	"!&g\211\265\300\274\306\230\013J\t\206\221\202\313k\r#\251\220"
+	.ascii	"b2A\006K\211Ix\221\275N`%(/W\212I\211\005\027l\205\305ER\300"
+	.ascii	"2\225\330\212\253E&[q\245\200\365\024\265\343\352L\351iM\253"
+	.ascii	"U\335t\034\325\326\346R\345d>\2074n\271\217\201[\252\231v\265"
+	.ascii	"\017\236\226\360\031\335x\306\305\361\251\267!\373bbi\216<\245"
+	.ascii	"\324c\263\255\217E\255\356\303\2277z6,kM'\310\236Vg\333\001/"
+	.ascii	" `\002!\266\254\003`\352\211\032\020\fK\224\240\003n\262u5\216"
+	.ascii	"\273B\016\356\353\013\321Y\215~5\236\243\360\277\3772\017\217"
+	.ascii	"\035\b\304\\0\224\272\255\0136\231SP\361m\"<g\306\356\270qF\203"
+	.ascii	"a\210\241\301\2728\202\004\247\341\334\3330\tX \353\216\226\360"
+	.ascii	"Y\21468\002\332\373\311@\306,aR\304\266b\213\337\217H\3472O"
+	.text
+	.section	.gnu.lto_blackboxEncodeSignedVB.21.7f1fe50f3fd0f3b7,"e",@progbits
+	.string	"(\265/\375`~\003%\031"
+	.string	"\366\356\241I\260VU:5F8\275\274&\3163V\255'F\202\275\013\032o\370\240q\337r\374`\355\344\260\223\\\tH\030\274\326.'\351\2255\362\222\337)\344?%\025F]wV\021C\363\204\364\234U\325\363\354\374 \215\220-wJ\001\207"
+	.string	"\213"
+	.string	"\212"
+	.string	"3\233\264=\247\375\362>f\357\021\341R\255*\232\370j\255/v0>$@\277\022\347yhW\325\272\242\210\257\326\362\305\r\306\207\347\361\0363\323"
+	.ascii	"\224.pD^\320\315GJ\255e\313\345Y\342\303\361+\361\341\2660=-"
+	.ascii	"o:i\017\351N\232\317;\325\201\242\tNW\363\220\236\2006v(\035"
+	.ascii	"\t\312@g\b\370\337gNW\233\224F\316\367\277\037\330\005q\272\234"
+	.ascii	"O\022\204Z\253'N\207s\213\267\035\263"
+	.string	"=\301^\036\001\344\211n\323{w\2114=\222\246I\342\264x\236?|\317\277\342\364\003\220P$\021p\244V\023A*\025I\370\223\361\336_\364\013\375D\247\366\375\240\027\371?\223Af\007z\317\367\371gF\363\037\376\320\205\254\017\240\224Z+I$\373\tg\217\3547\243\021\236P\265\335\224l\274 \0044\347\241\2117\245\023\265\027Nj-_\016\344\007\001b#\236\f\t#\215\377c\3224\367\t1\326\334\214@Jb8\251\265\"x\350\b\343\303\333\001\313\262\017vz\266#\324\372E.\270|\030>M|8}pO^?@$\027\265\323\350\226\263\340\247]\3313\261\3350-\271\377\235\016\331\001\272\035\331\314\340\352\f\001i\254I\245}\025\333\016\322\026\270\215\304q\305(\266\031\250)\256\337\203a\020\217#\3752\361+\356}\247SvMn9\265\03149w\355\f\033\346q_\002#\266\306.ksY"
+	.string	"m\350\370\274+\354q\232\345\262jQ\275\350N\261\214\323\250\225\013\335\247q:1\357"
+	.string	"\363\020\342\025\302d\032\\\037\302\013\262\327\032F\001\006\231\030\0131\030\031X\005\020\261W\006\030\227\206WK&\306\265\241\0053\323\241\245\300\200c\034`3-\017\261\330L\213,mNO\353\2629Sj\332\226\315\331^\355y\227\260Cb\2635\263(\034\367\244eY\373%\267#\033\227]\325\3309\022.\013\227v\253Z\0208\216f\202\247\250\344H\261,_\323\346\376\373\b%G\211]Y\323\031\356is)\036\236\221\021s\n\255\265V\232\340\251U\355qvA[\212\032\221\233\002F\250Q<\306\fbFD$\260@JR\020uP\002AL\3229\020xV\242f\016`\t\324Y\026j\212\235\261\217<M\257\031\021ep\004\026\215v\254\262\f\026\3655\023\317\323\217\\\3121\367\024\031t4\214;\367\211A\020a\205G\252\364\316.\3248"
+	.ascii	"\226_\314\352\0011<\206\324\257t\t\226\b\322\371GT\bT\272\334"
+	.ascii	"\312I\357\371j\240\371\266\326\002\234\223\340\325TX\t\373\215"
+	.ascii	"\345\236A\334\304U\256\214\340,W\306\021\b\204O!\313\327p&z\304"
+	.ascii	":\3770\355\034J\005"
+	.text
+	.section	.gnu.lto_blackboxEncodeSignedVBArray.22.7f1fe50f3fd0f3b7,"e",@progbits
+	.string	"(\265/\375`\020\005\005!"
+	.string	"\226\374\320K\240\326Q:\261^\350\t.]\205\016\024\376 \2031\005\235[\223\221o\234\216+V\b\365A\005\372\251\332MpCo=\270\305\223\300\260\323\247\220\327\202\037_\213\271A\212\n\343\241\360\022@5T\203\005TOs\215\020B\266\334I\006\271"
+	.string	"\270"
+	.string	"\267"
+	.ascii	",\001}y\346#f\0313we\276\217\027\217\376\203\215\226v{*\240\262"
+	.ascii	"\356\275\007\030\002\372\262\307r%\216\250\241\335^\021\330\240"
+	.ascii	"~\270;\314\275+\272\262\356%\036\340\005\350\313O}\307\021\357"
+	.ascii	"j\210-\226\314\"\022\037\025\226{\2116&^\306|\211>\306|\331,"
+	.ascii	"\254-\371L&\223\311[\342\371\354\335\321\323,m\327\035\237\352"
+	.ascii	"6\307\023\330/\210t\324\236$L\304\370\023\245\024\226A\230\024"
+	.ascii	"\255_\361\352\311t\323\316\274l\b\001\004S\253\240\311\312\013"
+	.ascii	"\030\354\325\222\006\212\333\343\2530\313/\210\342\375\253\027"
+	.ascii	"x:\376\202L\257\347\203{/\327_p\351\034;3\367`f\013\314\026,"
+	.ascii	"8\347:\337"
+	.string	"\330\304*\327\320\034\353<\023\253,s\255s\355[\347\230\256\034\240+\303\240\225i/'\376.\263\377\370e\037\376\261[\235\317\017\317&Z\271\354\312\266V\356\263r=+_\300\271\303\211\016\326\275&\222Zn\223RK\306\267~\256\037\353\327\372\255\370V\347\342\037YF\344\350B\276\3057r\220\252\0200t/\302\317\372\221\236\362\205\345\336+\3232B\004\304\254F\210\256\2042)R@_b\335T)\226\026\221\370\350>\334\231J1&\236\013)@\370WG=\275$3.\204Od\b\033\2132&\240:~\020\226\261\356U!P$%\264\n\n\f)\367^\237\227\001\2674\360\233\306\351/\t\223)\024\257\353\265\266i\007NX)\262\246\371O*\\\340\235\371\262R\375\250\374^\307\224\351\232\256F\337\211\004\237i\232\376W*Uk\231\376\361v\313\251\212\273\311\312\213\206\355\250\230\376\226T\007L\0178\033\315"
+	.string	"m^Ig\320*\255\371[7\234\371\037\314Od\226M\353\033o\303\204`\276\023.\3256\363\206\240\372_\331=\275Fb~\022#\016\350\013\376\210\376\026\2400\251&\271\266Kw?\225\262g%\346\273\366\323\032\274\232\344\263\337\277z\211|\352\362!\223j\262\331\313FSVw\0243\221W?;\202\374\342^\301\034\253\314\263\243\223\023@\272\0167\020e\320\211\200\212D\374\224EB\272\034\256\024q\033\032\272\225\032t?\3158\004\033\204\2022\344pB@\030\214r?\034p\267\016?6\241\240\233\007\033n\210\310\206\200"
+	.string	"\347>"
+	.ascii	"\r\331\212r\271!\233\214\230t{\232=\233\365\251\376\022\276\251"
+	.ascii	"&I\315C\315\2276\232\212Q}~6\360WG\265L\rM\235f[cm\312\372\214"
+	.ascii	"\r\213Kz5\354\\\305\227\202\307Y\316\364N\003\331\226\265\316"
+	.ascii	"i\340\331/KO\307\024\212'\302\177Tr\232\247\037\305\207L\332"
+	.ascii	"i\235\032N]\251\224\331Q\034\023Z\2346\272\201l\003\277\321\202"
+	.ascii	"\003\312\332\224]k\340\217G\255\340(ai\232m\233=\323\300\233"
+	.ascii	"a\221I\257\206\331{ok\250Q@\246\214R\244\310\214\220\204Q\320"
+	.ascii	"\264pp\002\031;\262\r\021\020\266+\242\3120\007`\322E3z\"(p\223"
+	.ascii	"\233\244\2410H\235\264a\347\246/3k&!\323\212\026|\314z\207\331"
+	.ascii	"\213\217\310V l\351[^\301\325\271\251\255)c\\\375qa1\315\315"
+	.ascii	"\307\224(\340\221\302\267?r\005\263\r\344X\375]\371\320\241\237"
+	.ascii	")i\201\264g\346\007a\\\305\004\b\276\264\001\260>\005\204\230"
+	.ascii	"\302\343\326\032\300oD6\344O\205Y\342\342\237\227q\257\347\237"
+	.ascii	"9\201\350\017\035\213t\361%%\224\300\006p\266\257\360\325\fK"
+	.ascii	"\361\252\252\357'(\354s\013n\371\370MD\363\031\301\317<k\217"
+	.ascii	"\f\346L\202:\361\337\331\202\277s\375\3579\312\007\314\346)\206"
+	.ascii	"3)\227n\2567\376\375:\343\242\002"
+	.text
+	.section	.gnu.lto_blackboxEncodeSigned16VBArray.23.7f1fe50f3fd0f3b7,"e",@progbits
+	.string	"(\265/\375`\037\005U!"
+	.string	"6\375\322K\240\024R:)G\237\301\t\023\356(\314\225\303\257\246i?m\304R\343\270s\262\264\212[\017:\260\177\325n\222\371\272\363F\212\335\365\006\203\262\327x-\356U`\275F\255\336\033\371T\001\177=\224tm9\353\232%\204\220-w\222\001\273"
+	.string	"\272"
+	.string	"\270"
+	.string	"/\031\002\372\362\314J\314.\314\334\225\371<^Tz\0176Z\231\313K\261b\353\336k\200\037\240/k\226+1\004\216\314\345\025G0\250\037\352>s\257\024\224\255{\211\006X\001\372\3629\256C\211u8\304\025Nf\361I\317*\313\275D\033\023O3_\242\2571_\266\nkK>\223\311d\362\226x>[w\3644K\333U\307\267\272\275!\234\342\003.\035\265\247\210\022/\316\244\t\205] \026\306\365\254]=\237n\332\0270\032\301\030`j\023@a\201\375\200\274Z\3128q{|\rj\361\001O\274\237u\002\302\243\017\370\364z:\270\367r\365\001\235\316\2623\363\016f\246\300l\221\001<\367:\357\350\314*\347\340\\\353|3\253ls\2563\355]g"
+	.string	"]\271\246+\323\310*\317\310\234\370\307\300\274\307\377\362\341?;\326\031\375\360|\312*\233]\271D+\333Z\271\317\312\365\254\374"
+	.string	"'\222%>Z\367\226H\216]%%\027\214w\375^\277\326\317\365c\361\261\356\305?\262\213\020\245\003y\027\337\310?\256>\270\310}\b\177\353E\232\n\226,\367^\027.\"G>\314J\344\350Mh\222\242\004\364\245\326M\233di\361\tP\356C\235\331${\332\261\b\363\301\317R\252\361\242\3048\020\276\220 l,\302\210\200\346\370?\330\205s\277\372\200.5\241WM\\\204\335{\201\002\267,\360\235\346\351;\005\223\251p\367uZ\353t\203(\255\024\231\323|&\023*\260\316|Y\255|U~\337c\332tNWc\317\004\202\3374N_JJEk\233\376\361\266+\352\212\033\n\013L\206\355)"
+	.ascii	"\375-)\016\232\026p6\2325mbIc\314\324\231\346wY\270\231\367\321"
+	.ascii	"\374G\246\3313}\343\255XpJ\317DL-\233y(C\275\317\354\032\257"
+	.ascii	"\227\330v\331\337\302|#IDh\013~\210\376/\310\3241\335\375\224"
+	.ascii	"\252\236\217\230\357\332Og\354j\222\321~?\353%R\370\325C2\325"
+	.ascii	"d3\030\r\250\255\356)f\342\256\376\245\bR\n\267\024\363\254r"
+	.ascii	"\355\307\247'C\271\r7\017%\321\217\206\220@\004\225HE9\234P\t"
+	.ascii	"\342fdt+1\344\202\232\205\016d(\"\272\200\023*\032\262\220\204"
+	.ascii	"\013\322 t\333\020d+\"\272q\260\t\031\035\331\016\f`\\\207!#"
+	.ascii	"\033\022\016gds!2\275\245\230\355y6\fL\337\352'\321;\242\204"
+	.ascii	"\251w\250)\323IU/*\320\321\376=\353\350X\325\320\364i\266u\326"
+	.ascii	"\347K\243\262a\021\t\257\212\235\255\364PT\235\345M\377\364\217"
+	.ascii	"mI\353\236\376\241-\343$<\246\302\232\203\373\252\364t\255\357"
+	.ascii	"\244\207d\372i\237\031Q_)\225\331S,\013Z\236N\252\201\354\002"
+	.ascii	"\337\031\263!\264:f\323\372\367\343\321+6HX\234f\333g\337\364"
+	.ascii	"ogXL\302\253b\366\336\033l\250Q<\246\214RF\221\031!\t\243\240"
+	.ascii	"i\341`\002\031se\033\021\020\266+\242\3120\007`\322u\006M\017"
+	.ascii	"\260\3111\177$\032$,m\330\317\351\274\314\222I\355\340\262\254"
+	.ascii	"Q\f#\217\3313Fd+\020\274 \316\317\300e0\032\257\201\001\004\375"
+	.ascii	"q\275X\3140\307\224(\354\235\342\302?\201\005\263g\262Y\370X"
+	.ascii	"\251\004\331s\231\302f&BQ`\234\251\037(5k$2X\304\024\262\212"
+	.ascii	"\024 \304b\226k\326\200y\2238\\?J\f\345N\276x\031\365\372\374"
+	.ascii	"\357\311H\277\024\027\356\367K\226P\"\f u\263l\253y\254\305x"
+	.ascii	"j\335SP\330\347\026\334r\262\333\211\246\347%<\333\204?>\356"
+	.ascii	"+\001\340\333\177g3\376\350\375\274\311\030^\2406Oi\230]Yi\363"
+	.ascii	"?`\352\327\031;\025"
+	.text
+	.section	.gnu.lto_blackboxWriteUnsignedVB.24.7f1fe50f3fd0f3b7,"e",@progbits
+	.string	"(\265/\375`\323\003\r\033"
+	.string	"\2661\254H\260VU:PrI\366|w\234\366Z\3578`\312\274\374\271\342\202\206\252vs\374\201\373\305\t\343\252\032$ ^i\227\223\364\312\032y\246\347\364C\375\013\236\273\276;\253\344X\276\210\3232G\260$\331\262\222F\310\226;\245\221"
+	.string	"\225"
+	.string	"\226"
+	.ascii	"\272\022H%\307\260\326:\241\374\370\377\274\262{/B\273\017EY"
+	.ascii	"wX\230\021fX\253\016\301G?(?\032\030?\355\0179\021\332\223\202"
+	.ascii	"\254\252UF\260\251\326\236\002;(?\352\034\207\374H\357\"?\232"
+	.ascii	"fcy\357\250\376\367\005\247\324\245\326\372Z\033\246\247\275"
+	.ascii	"\233N\332G\272\223\346\377N\340\b\230\333\t}\244\254\250\036"
+	.ascii	"\274\231\235\n\332\240h)\352\302\317\241\235mR$\242\357\205?"
+	.ascii	"\300+\346vD\237)\t\265V\317\334\316\305M\336\266\217\355\013"
+	.ascii	"6m\00587.\233C\335\255\032\3254\315\314\231n\031\3254\353\301"
+	.ascii	"{u\247;&5\255JM\227\345t\352I?MMOr\372\001btS\006X\251\265E\021"
+	.ascii	"L\2252>\351\270\323\017\3653\375\301\337\347+9\224/\364*\t\355"
+	.ascii	"\300;\371O>B\003\272\021\237\311\233RH\305U\220V$\024>\223\202"
+	.ascii	"\256+\241\374\230h\367\315$\330V`\370}\031\326\332\033\227|\t"
+	.ascii	"\350\276\031\251S\275\260\335\030~t\257\274\213<\320O\202\304"
+	.ascii	"M~:,\224@\376\021\257\200\256t\242\024\nt\336\310\177\260\234"
+	.ascii	"\314\016\331v+\351\007%\305\364Bk\255\225&xkm\366.x\305\033\f"
+	.ascii	"\233\223\257\266f!\030\005oD\232\365\237p\210\3718\374\031\371"
+	.ascii	"q*\345\264\324f\321\257\027@\262\226fg\023\034\021\203\313\354"
+	.ascii	"\314\376\312\315\307jY{\341\251\320\b\210#\326\266h)\ni\235\212"
+	.ascii	"\331\207\271\t)\267\300\335\204T-\311\345\266\2035S\353;\365"
+	.ascii	"| \237+W'\305\n\371\017\"\351\246\366O\247^xYpD\266Y\264{\266"
+	.ascii	"\2715\242z\0245yi\330\252\351\234=\037\021#q\202g\3540\343\331"
+	.ascii	"\330\f\304N\211\321\260\005\036|z8\310`>\261\r&d<\037`; x^>="
+	.ascii	";!^\260\237\021\257\005\006,\023\021\373y\221\220\311~^\253^"
+	.ascii	"\355Tfqv\310\224\256\326\225a'\245\2666\243\240\265\312\210p"
+	.ascii	"\337?\364\315\242[s.\200#{\303\316|\316:*v\256\002\034\261\366"
+	.ascii	"\037\254\274\331\357\177\257\240\213Q\274\001\311\321\360\234"
+	.ascii	"\026\327\346\354\253\340\2105\234\275\341a\024\345\346c\334\032"
+	.ascii	"V\361\326fM\374 \316\004o\201\t\002ck\350\256v\350\302\227[\202"
+	.ascii	"\260\330\231uP\250Q0\206\224r\206\314\214\320\310\004ia\213\001"
+	.ascii	"`\002!ut\036\020pH\242d\030\003`I\354BM\\\322n\221\263\344.\357"
+	.ascii	"\336\244\344\001g\330\002\"\275\342\207#\331\0170q\221H+\313"
+	.ascii	"P[b\215f4r>\350\005\227\274\262\2451G\215\343\305\225gl\211\340"
+	.ascii	"\226H\331wPE\f&r\002\2026\337\202\252\337\224y_\211\313\002+"
+	.ascii	"(ye&o\004\264\367$P\f\214\nh\300\300\250n\2077\223&\335\025\335"
+	.ascii	"\235\331\330q\252\337@\035\342\240\r@3_L k^B%0\231\331;8\373"
+	.ascii	"w\276L8J\211\272\321\337\336\361\217\n"
+	.text
+	.section	.gnu.lto_blackboxWriteSignedVB.25.7f1fe50f3fd0f3b7,"e",@progbits
+	.string	"(\265/\375`-"
+	.string	"\355\007"
+	.string	"\242\31776Po\322\001\240\\\354\320L\013\3422\262\317k\034(\201\312\234\346\024\026G\210 \227\207\177\374\b\345\364O\224\340\231I\017\343\207\272\016S>\025\325\326\354'\233H\231R\231\304\350\232\200\306@\f\232ha\303\264L\241b\0135`\327(\0245\321\345\0201\216\024A\037o\017\031\027#\266\215\213\035\324\276Z59\301$\205\241\031\336\344\325\206 \345?{`\252\332\024\026\371\357\232,$)\r\365l\224\227\nb\277\332\335\265\232\354\237~\315\364\255\200\022\230\217\314nG\r\315\246\340\313H\307\366\323\376\311Q\272\237.\314\331\375hq\331\335\002\033l\016=\037\260\016\253\013X\207\356\354\230\243D\366+\034\033+3\273\0335\344\335\263\363\237r\316W\362\236"
+	.string	"\b\273\353\374J\036\267\3366\201\355\003\333*\001\n"
+	.ascii	"`\251'\023\332\370\002\307\005\003g\030\001\243.a\021\253\321"
+	.ascii	"\340./\332I\006"
+	.text
+	.section	.gnu.lto_blackboxWriteSignedVBArray.26.7f1fe50f3fd0f3b7,"e",@progbits
+	.string	"(\265/\375`\307\001\005\021"
+	.string	"\226!sF\360\320&\035\372\305\275\357P\236\3271\211b\353\322\241\232c>\315G6\273\377\247+%\352_\313z\023b\334P\311~\256W8\322\331\212h\t\236\201gPy\263 /t;\006\013[\220\362%\324J\243\355-eJ\001^"
+	.string	"]"
+	.string	"["
+	.string	"\"N\220=\272\373"
+	.ascii	"\322cv\001\244G\263l\033\357r\366\261\f1\261\034\273\273i\007"
+	.ascii	"{|\337\367\035v7L\326#\324d\371>'\340\301{\301Z\036\241\307\313"
+	.ascii	"\f\210\017\330\013$92\032\272\367\224\201\271\022\356\324\\\357"
+	.ascii	"\375\200\316\215\027\254\346\351\261`w\235/\030\315M\272m\013"
+	.ascii	"\266\033\330\3710\2350\375\017\223\220\f\0033vg>\035[\024\207"
+	.ascii	"B\374\347\267\357\307"
+	.string	"\016\264\362\024V\032\026$v\367(|\317\232\177L\224\265\\\310\274\230\006\243\335\ry4\003\257\330\332\3435\333\331\375\004\353=&ri\227C\r\241\335\025\261\202\354\021\004>\355\227\270\t\326yX\036`\367\346\205\320n\027P} \216B\376\245\351\201n\n\332)r\321\026\373*TP\262\017>\013\351+dlZ\3719\265\244\252\207\031\001o\030\244k\352aD\270\362s\324\353\275G\f:8bv\264\362S\365\\\274\300Tq\354\316\225'\31192\262\336\3301\255\231\316\363\227\336\363g\377\271c\246\341\323\032\251\247\250*p\250\270rZ\255N\321\250\021\b\252\324\003\016\2452q\240\302\225\234\240N\021J6U\352$aC\255P\266\221\002\346&\230\254\266\024\216[mZ\327\272\336\370>\317\202Z\024\265\324\025\025\307%\0335\251\322\310\220G\225\3114\352y|b\270\344\321\341\356.4\202G5\321\350\334\200\331"
+	.ascii	" \265\324I\376e\220R\006\" `\002!\311l\007`\365\304\300\356\221"
+	.ascii	"U\026}\266\226\313\"y\224\fQ\356\237\266\264Q\230\231\311\334"
+	.ascii	"dL\007\334V&{\020K\367UV\261dac\313;1\322p\327)l\2178\372^\031"
+	.ascii	"f\023i\304\022\264\3138\221i\206\332x\017\221\316E\237"
+	.text
+	.section	.gnu.lto_blackboxWriteSigned16VBArray.27.7f1fe50f3fd0f3b7,"e",@progbits
+	.string	"(\265/\375`\326\001E\021"
+	.string	"\266asE\360\356&\035\302Y\024\034\250\321\351)\372\324\352\3404\345('\354\346\227X\215\302\345\334\373\311Wn\317\\{&\233+#\3418D?\272E\331D6axy\367\326\312\005\245\235E\240\241\n\231Z\344\223\275\245L)^"
+	.string	"\\"
+	.string	"\\"
+	.ascii	"\036V\260=\332\273\001\355q{\001\355\321,\333\305\275\232\275"
+	.ascii	",\326\"{\261\273&\345\340\214\357\373\276C\357\206\311z\204\232"
+	.ascii	",_\347\007b\337\013\226\362\b3V^:\004\200\255@\220#\243\237\317"
+	.ascii	"\236.0W\302\233\230\353g\347\210\021\275`1\317\f\006\273\353"
+	.ascii	"|\301`n\355\266/\330v`\347\200O+L'L_@i\005\013\016\241\335\227"
+	.ascii	"\017\306\016\305\037\017\337\371\355\373"
+	.string	"\262\363\234\274\204\025\006\305I\3703s\3361\320\226\202a\233\311l\214v\267\343\321\r|bs\217\347l\247\367\021\254\347\030\310\244\335\rE>\273\353\341\005\333\343\006|\332\017q\021\254\343\240\234\300\356L\220\317\256\027>\017I\227\177i\350y^\352\271\031R\321\024C\215\372\023\366M\230P\330l|\024\355.2--\251\352Y@\344\255B\273\246\236\345\203+?kz\375\3541C\254\250%F+?\325Y\212\025\230*\215\355\271\362 5GF\326\031[Kkp\307\371K\317\371I\337\271\265L\307\230\206\001\251\227\250,t\250xrZ\255N\321\250\217\021U\nB\207R\211<0\351B\"\240N\022BL\252\324\211\304\204ZU0} p7Ade*\351\272\225\211\363Z\327\031_\347[\217\320PK]QiL\222QN\265Ev\\S\027\222jz\034\235 \225<:\334\335\205NpM9\230\030\021\213\006"
+	.ascii	"\2511\222\312\277\274Q\312\250\001% P\002ATU\017\340zR`\347\221"
+	.ascii	"U\213j\255VO\"5\n\211Q\004<\035\266Q\231\231an\3216\226Y=\370"
+	.ascii	"\022`y\206}\360\225\225\253\206\002\3420\315b]\214`\235\021\332"
+	.ascii	"\273\222\302\206\210#\356U\303h\"\355X\202va'2\232\241>\336#"
+	.ascii	"\322\271\372\023"
+	.text
+	.section	.gnu.lto_blackboxWriteS16.28.7f1fe50f3fd0f3b7,"e",@progbits
+	.string	"(\265/\375`x"
+	.string	"=\t"
+	.string	"v\322@7@\217\322\001!\324\227KF%:\315\335n\0054\322.P{p\002\215\304{\333\340p\355\232\016\313\331hG\3068\002\331\327w\201\320\362\322+#pC\215\354M\244L)."
+	.string	"/"
+	.string	"."
+	.string	"'\210\207\371\201x\350\317^\371\313c\017\013I\301Xv\227\323\216\177\317\317\277\353"
+	.string	"\252\225\351\271-\354\256S\265\322\270\365\266\rl+\330\017\b1\323P\323\232\226\326L\247\246\237\311\264\244lNv3f/\033\203% \266\257\261\235i_\344#\337[\026\206\273\033.\222\335Ep\002\346P \267I\214\252\272Q\301\220\241r\346-SmR)\257r\301\205\232|M}\324k\346\003%%;\345\314~\231R9\354k\273\273V\226\375\326\037\237R\250C\001\335q\036D \007\257\023}\032*<\017D\327\ty8\021\250\023\301u#\022\3079\260'\361\031q\023\2367\3424\257\275\262\314\340\022;)\312[BM\241\252\206\t\f"
+	.ascii	"`\251'\0230\217g\340\002\277\225\034.o\034\252\367\300\304\253"
+	.ascii	"]\006$VS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_blackboxEncodeTag2_3S32.29.7f1fe50f3fd0f3b7,"e",@progbits
+	.string	"(\265/\375`I\017MM"
+	.string	"\312\206\354\034M0\326:\031\016"
+	.string	"\342\001\312\226\327z;t7\257\324\202n\033\371\216=\346\001\216\356[)\202\270\350\007\037e\017\244\006\344d/L\337BI\210y$AW\033gP\001)QW\362\364\247\261H\347\315\247\007\005\251\376'\233\354\275\367N2\311\300\001\217\001\301\001\nD\256\376\220\253\272\334\252Y\256\346\310\3252\267J\226\253c\271*\222\253\341\256~\\\335q\325$\304"
+	.ascii	"\363\022\363uv:\276\023L\220\317\311&\246\235q\021\366\020\266"
+	.ascii	"\020v\0206\232\235f\233\331e\266\016\316\251\022\241VS]\021q"
+	.ascii	"\250\3128j9CP\241\225\271q;O\337\256\204\343\245\f\032\232 \324"
+	.ascii	"@\325\235\225\255qs\3437?\030\b-N\273\202\344e\350<\313\334\200"
+	.ascii	"\306\211\355\007\355\210\330\017c{\236\264Q\367\240>3\303b6\247"
+	.ascii	"O\221\322;\250yP\235\3052\005\226\\\262\312\262\037\0377\"\245"
+	.ascii	"\305\253jQ\377T\2479\230\215\026\353\240@$/\276S+\307\2318c{"
+	.ascii	"\316\363L\262\250>J\213H\241\215F]_\226\340\2165Y\225\211\316"
+	.ascii	"\223\f\021?\234\247\317\2066PZ\264\230\307\264h\025\013\037\330"
+	.ascii	"\326\3703\273\372\3559O\337\222\372\254b\264X\332h\264\3702d"
+	.ascii	"0\030\f\006\r\231z\207>k(V\271\210hH(\b\350Gg\346Jr4\022\303"
+	.ascii	"o\225Z\007\231\033,-..2\342\016\021\f\341\r1;\004f\241\220\374"
+	.ascii	"\002\306\214\217\310j!\324\001\205[\232\325X\330 /\003\251yH"
+	.ascii	"\2318w\306ly\371\207\354\001\307!\016cncpc\266\300\254\013\207"
+	.ascii	"\216\310Z\001h\031i\262TXS\306\013[]\316\261@CI\206\241\201\374"
+	.ascii	"\031H\231\022\356\214\331\212\301\343v\331H\006\217\311\nsej"
+	.ascii	"\361\306\237$j\350R\031c\262b\020\305p\350<\317 \255/\341\215"
+	.ascii	"\236\226\325\2064p\371\346\301\233\026gE\307L\213\313K\3668\317"
+	.ascii	"S\027Kk\313\232\302\252>SU+\252@|\002\346\301\242\2303t\260\\"
+	.ascii	"\311G\270\333x\210\2323o<=B\3779\226\257Z\320\205xx7\002"
+	.string	"=\b\t\350J\272\227\377\371\221\017\346uB\336\215\271\233e\356Gj</\362\345}\357\306\361\344}5f\345\335(~\274y^\027\037\252]\305\251\331D\230R\316\240\3162Z\f\357^W\227\r\352^\312\177\363\324\204V\"F\177o^\032\253\r\352\222\373>sR\016ql\350\224\305u\331\340W\2056I\200\375_\252>.{2jmoaz2\252Y\310\325\021lf\305r\205jj'\025\005\365\344\301\024\373l)M&\263\231\\\204\025\212\207\260>\261\020V'\016\302\332\304hV&.\263.Q\262A\022$\344\352\021\335\252\006\344j\006\273\212\301\270jd\\-\242[\275\300\\%b\256\016!W- W\205\220\253Ar\253@\312\325\n\310U\n\310\325\037\271U\037\345\352\004F\263\366\260\016V\036&\263J`2k\004\344*\004\271\325\035\345\352\003\345\252\003\344\252\216]m`\\e`\\]@\267\252"
+	.ascii	"\271\232\200n5\007\271\212C\267z"
+	.string	"\303\\]2W\225\314U\033\344j\r\335j\222\271\212\200\271J\303\\\235A\256\036`\256\032@\256\026@\256\022\240[\035\300\\\025\300\\\225a\256\"\221\2531t\253\001\230\253G\346*\fs\365\005\271\352\302\\ma\256\2620W\001 WW\220\253*\314\325\024\346\252\221\271ZD\256\022\221\253C\344\252Pn5\250\334?\236\327\216C\020\364n|\340;|z7:\360\007t\334\201\207\277\252\254)\245\016\006.\345\r\330\b/p\006\232|\201\033\350$\024\326\254t\200A\341\226S\340\272`6\201+\360\005~\n.\001:9p<\307\027\250\007\307\275u\303\332\215\245\337\250:\r5*}\tj\264q\245\032\267Q\343\266\341\0068Mx\321j(\223\256\373\305\b<\311hd:\025\215\033p\004\270\254\342<\3434\016\370\214\217\277\253\270.p\007\\\234S\300\r\360\023&\340\005\334<>Vz\b\370\ba\301^\327"
+	.string	"\002|"
+	.string	"\365\031j\224q\001\036B\215H\227\021\343H\027c\3346\204\275\365\272\226\360\242\255@\006p5\237-cN?u\252F\213\373\303\302s\364"
+	.ascii	"\342p\230\351W\356&xj`\274\305\217\376\002x\305e\0055\2768\f"
+	.ascii	"\027\177q\030}\256\342\272\300\225.\016C\215\305S\274\305\311"
+	.ascii	"<W\\?\206\032\0018\213\025\007\300mV\361\025w1G\317\2264\241"
+	.ascii	"\212\267\370\365\272\214\236\342!\020\013\317\rC\215E7\272\257"
+	.ascii	"\302\020\275(\034:\321\311\037\217\217\325\2264CwX\330Z\257\313"
+	.ascii	"J\330?\033\341b\343\262}\306\177\271\331\333G\355\242#\342\276"
+	.ascii	"\214\302P\311y\274wG\225\264\355n\302,\326y\266\251\235X+p\264"
+	.ascii	"\250\002\023j\303\0044\247"
+	.string	"\013v\264\206\266\225\347\311E\027\353\274\302Bs\236'\215:\252\332f{i[\tvf\235\276\223\206E\036&\032\nl\274\215\023\377\2459;\345\2365\264M\362\222\367|\346\034\330Z\333\317%\022kd\233d%\357\331\360\222\233\214\215\035/\013\205\337\304\324\330B\255\341%\317\362Ov\242\212b\262\"V\221\242\332\375p\252\202%J.G\016I\007QNOR\200D\360\324\256J\223S\224\023\225\222\212\023U\024\223\225Q\nU\224k\223\322\024\251\247\016vMRN\034\210\260\213\002\325\304\024\025eI\352\211\351\203\245\246)*KJ3t\007\202\323\324R\225\335njI\347;\305\034\022Ip*;\224S\017A\017Iu\377\034\244L\357\312\315x\345\032\212L\337`\203\007\201y\303\326\345Vj:bECI.\301\225\360<\307\360p\232\375\306Dn9\020\375Kuv\204<\b\203k\323%\331\311{\032\nE"
+	.string	"G\246kz\022'\271\270\241 $\217\340='\367\340\206cql\354m\205\344"
+	.ascii	"E\335u\2428\341'\311P\230\210\302\f\020T\256\016\\\334\317\224"
+	.ascii	"?y\317j\316!\021\205\027\320\3235\374Ir$\357A\371\221\257\031"
+	.ascii	"6kf\345\221/)\221\326e\203a\020\224G\335r\326\224\361\274\312"
+	.ascii	"'\207\272\2255pxq\032\304qZ\361\344\032\374s\220\374\351Vs\210"
+	.ascii	"g\215\233\277\f\316\027-\240\f>\345\007na\313\300\310\245\034"
+	.ascii	"\203\"7\342\344En9\026\321\214\005\257\364\307d\362\036\027\004"
+	.ascii	"\315!\362\013\036\346i\372\372\300Sc\250q\310\211\334W\\=>D\024"
+	.ascii	"3\266\246\373\227\002\341\220\333\335aoF\030\271\315M\3363\320"
+	.ascii	"9&\336\342rR\367\033\347\310\274\2311J2\223\367\324\304\243\332"
+	.ascii	"\203\313\366\261\236\365\340R0\225\334\344\273[\b1'x^\026\\\310"
+	.ascii	"\245~&\267\340F#\026\344\361\021rU\335\322\306o\024x\004\366"
+	.ascii	"<Xx\202\234\202\013\271\322\017\310\203\220\301\n\016$<+\270"
+	.ascii	"\022\220\347\365\343\020\234\202\303\310\343\343?\202\023\334"
+	.ascii	"\3079\301\217\002\2019\250q8\345\220b\206ff$II\322\0341\005\304"
+	.ascii	"0\t!3\017\021@1TR\215$\251T:|\0272\262U0z\223I\240|{\n\3727}"
+	.ascii	">\023,\222\332`\320x\325o\tD\240}TU\016\234\241\001%\327\344"
+	.ascii	"\201\376\374p*+_\bA\ns\300\200\343\022p\372!\376C2d\242;\n\207"
+	.ascii	"M\034D\021D\036\320\250\233\242N\253\3477\260\240\032\n\357\361"
+	.ascii	"$\266\372\231V\r$\341PHM\222\213 \365\325"
+	.string	"\343\023$\340\006\2628\241o\036\364T0V\352\204p\205\364\205\225\264\377\321r\226\335g\315\013\3048\033\250\207\023J\r\260\234\270\344\230)\271\f ,  B\007\236\204\255\326*x\331\203\302\224\200\216|-\n\3119\204/;\004\305\275\030\037\321\322W\025{p\220F\r\234\357\223\365,\212\223\215)\307\365\222pZ\372\026\221\303\242g\fKC\237IZ\356eq\231\265\303\320 \367\232\353 \252\377^\t\021\030\341q\334=\346\177\250\004\\\242\203\207\344BH\001\224\b\035?\263)(\nM\360\351+\025oj Z\326\331^`\0031\352\004\tim\362\200A)"
+	.string	"t\022\002R\022O\374\346\310l\235\222\237\365\337Ye\307l\317Nd\022\310\335\016\236\343["
+	.ascii	"\262\340\331S\366\262x\022*B\362\003b\320B> \\Q\027\216\333x"
+	.ascii	"cz\366\340\322\310`\337\201,OxOH4\2711U\347>\225\256)O\352R\b"
+	.ascii	"b)\017s^z\374\265\220\227\267\204\363,<sL\204O\002\227\271m\222"
+	.ascii	"\367\216\"\363\361\322\030\"\335\365\350\2739\233\345\317X\215"
+	.ascii	"\035\314\266\245\247[\323?T\252\371\037\244\330118e\235\355\200"
+	.ascii	"\221/\220 .\255\f\257h|\363\335\204\341d\230Fa\370}v\031_\340"
+	.ascii	"6\265V\305*\235z\263CQ\177\322J:\n\260]\220\026\372W\250\307"
+	.ascii	"\271\344e\213%\023\220\304\245s\221\234\021l\336\207\351m\214"
+	.ascii	"\004\277F\214\201\315\235\324\371\3029\023\224\3666\237\321\333"
+	.ascii	"Z\251\344\022\272\230\352I\300\321\370\317\347J\374\0164cF\344"
+	.ascii	"\254\\\271a\20018\025\345\356J\265\254=\033!\007\221&\035\026"
+	.ascii	"\245\361h\220\254\021\2608\243C\251\001\006\0161\032\272\226"
+	.ascii	"\033.DF\220\352\026\r\2151\373\r!+/y\376\003"
+	.text
+	.section	.gnu.lto_blackboxWriteTag2_3S32.30.7f1fe50f3fd0f3b7,"e",@progbits
+	.string	"(\265/\375`\263"
+	.string	"-\013"
+	.string	"F\025M>\020Q\225\016\213\202I\222\002dU3\177\020\364D\022\230\002:D\352\013"
+	.string	"|\246\240v\217>\362K\367Q\201\251\273\266#\230"
+	.string	"\n@\315\307T\0041\231\252 \364!\236\247\237eD\233H\231R6"
+	.string	"<"
+	.string	"9"
+	.string	"\273\237\304\013\262G\177\037\360x\314.\340\361\350\316\216\361\357\264_\311\030\251\\\273\253\251\351\335\263\363\237:\304#\201\236\033\rv\327\351\221B\334z\333\bl;\260\377 1\246\025K\247\246\017\001\340zAY\355~\bi,+\272 q\360\267\377\224#\366\367\024\335\301O\266% \230^\255]\020\n\036\315"
+	.string	"F\307\323\376\211\243\350\216\342\360"
+	.string	"\273\245\025-\002\034\251\004N\230L\336\363\201TU\311\250F(C;\265\200\312\203\tQ\206\206d\324\253x\212\313<\033C'\357]\r\260\230\301\352\240 \373\003\245\216\260\217\355\356ZK\366Q\177\024<\026\355\\<\232\212\206\207\267I\205\rf\002\267m.\0226p\226\314V\321X\264\r\246bA\3338\035m\222\300\334\205\013G\313\300q\034-\362\355\261\325\222#\274X!\025\371\203\355\212\240\034\374[`\206\016\022"
+	.ascii	"`\251'\023:\302\201\305\303\bb4 r\023\301\246\317\004\212\032"
+	.ascii	"\3535\226\241k\340\031\256h\312\032\330\201\306\362\324\323\340"
+	.ascii	"$/\256I\006"
+	.text
+	.section	.gnu.lto_blackboxWriteTag2_3SVariable.31.7f1fe50f3fd0f3b7,"e",@progbits
+	.string	"(\265/\375`\023\024\345U"
+	.string	"\372\223\\\037J \324RI\007\201\377\355\275\247\212w\2037\337\266\360\034\323?r\254D\2546\275I3\376Z\036\310\257Q\327\260\205(\223E\205WN\3178rN\375\330\177\316\272x?\374\226X\f\303\365\034\207\374\034jq(\216\326\b\331)I\031\354\001\236\001\367\001U\323J5\255.\246u\312V)[\243\246\025jZ\237\246\325\311\326&[\231\226\246UiZ\223\246\025\311\326\243i5\232\326\242i%\262u\310V\241i\r\232V [\177n\005\336\372[\272U\322\326\321\326y\353o\265\255\273*x\311\301\255"
+	.string	"\206\355w\346\312\266>>e\235q\210\033V\315n\232]\272\3353;U\367.M\2302b6\b];\rJ\343\343\210:<\200;ZU\212n\335\242\321\2403F\245\032\2302br,\235\356U\251\315\225X\276\326d!\267\265\243\336"
+	.ascii	"\356h\325-\263f\244\354\034\n{T\2260\360\265)\3139.\265\001\334"
+	.ascii	"Q\347\200\373\303\312IQ\335\233s2`Y0T\204h\262(\313\322\253j"
+	.ascii	"\227\310\035\347&\221;>\006,\375\316\271\325\254K\331\027XWV"
+	.ascii	"UT.\246\244\262\240\236\234\232\230\226\224\222\220\216\214\212"
+	.ascii	"\210\206\204\202\200~\200\277(r\234\267\024\335\037\330\344a"
+	.ascii	"\216\0366,g\373\002\357\016\bc}q[\263WMX\361U\005\261\301\201"
+	.ascii	"JG\230;*\274\270\335\255\013;3\244\021\261\fiDT3\247\356\326"
+	.ascii	"|x\344z\360\342\266f\245\246\221\334\244A\203\263~`_\334\362"
+	.ascii	"\026\312\352\311\251\007\036\334\364\003\363\342\346\3032\335"
+	.ascii	"`\203\227j\260\363\301J}I?Z\340\200\364\305\246\216\234\026^"
+	.ascii	"\334\360\366\310\016\021\214\221\fEv\210-\020M(\2708Y\326\016"
+	.ascii	"\021nf!\361\002\024CS\006\036!\260X;D\026\346R\233\rl\233\003"
+	.ascii	"q\006\013\255\020\244\002\320\333\317\324\302cB\207\265C\344"
+	.ascii	"2\231t\340\222\267\300\371u\267Gn\355\020\267\314!2S\316\204"
+	.ascii	"\361o\321\3626JH\256\215S\246\332\211\260\244\315\252\262,\027"
+	.ascii	"\315Z\345@\374\301\376\201\225e\251f\303\342\266\ncUM\205\252"
+	.ascii	"\366P=:\023f\336e\016\033\340\343\224j\313\310\337\315\214~_"
+	.ascii	"4;\022\361\364L\"]\n?\217\363\273\267\272GV}\250\336Z\035\267"
+	.ascii	"V\277\265:\311\255]\372Pww\313\262,\243\206\330\021\330E\r\013"
+	.ascii	")\304\216n\200\343\203\340\321\031\032\321\245\320e\224R\372"
+	.ascii	"K]\0345\357Y+5\"\335\324\276eB\316C\321m3\027\205\007\301{3T"
+	.ascii	"\272\024\272\250\375q}[F\376D\352\346\250y\217\272\3342\322\377"
+	.ascii	"w\r.\315}\272\367\277',.\236\031\221\t\220\006]\024\310\035\367"
+	.ascii	"\267B\211\272;k\336\320\334\247:w\346\307\251\356\252\021\351"
+	.ascii	"\250\350aP}\343\262E\313\022\367\314\352\266]\261Re\270lK\305"
+	.ascii	"V3[O\260\325\204[K\270\265\314\326(;\267\033\264\365\211\255"
+	.ascii	"NV\315\352\022\2621%IlEb\353\b\266\036\261U\004[\215\330\032"
+	.ascii	"\302Z\305Hk\021\322\032f+\021[\207\330\n\202\255Bl\375`\255\036"
+	.ascii	"\220\326 \244\265\003[\201\330\372\303V\016\326\272\001i\325"
+	.ascii	"\200\264f`\253\217\265b@Z{\220V\036\266^`\253\005\243\265\202"
+	.ascii	"i\3351\255"
+	.string	"\024\334:\301\255:n\225\340\326\034\266F\260V\bH\353\003\244\325\001[\033\030\255\fL\353\002\323\n6\2558l\2751\255\n\330\232\200\255\b\330z\300h5`Z\013\230V\033\323J\200\255\003\330*\300\264\006`\353\227\2555l\2451Z\275\246\265kZ\271\246u\206\255[\266\312\030\255Z\323\032cZ\001\230V\030\266fM\353\013[\261l\275\262\325j\323\254\006kpM3\366\312\241\300y#\314\222V\247,K&\035\3372urt|\307\300\321[\203K\233+\313\263\245\307\351\366m\031)\301\327K\235\234\315q\t\"x\216\317\274*\"\370>\360\340!\370\256\215I\343#\035\370\003\337\265\034\310\356\300\177l\241\344;\374\332m\326\025l\352\356\004\301\347eY\242)5\300\300\033X\340\f\200]\201/\240}\033$q\034\354\306q\270\271\361\337^\002W\340\207\300\023h\203\300\315\364\364\034`\300\017(\340\006\330x"
+	.ascii	"/ KZ\236%\3406\0068\001\002|\200;\365Y+\246\265\021\340?9_\017"
+	.ascii	"\340d\036Y\343_x5n\2467\005\r\257\323\350\272W\220\344z\327g"
+	.ascii	"\037\034\033$g\234k\3533\366[\337=zw\326\212W\034\215\026,$\311"
+	.ascii	"\320\272\214\030\327\372\002\360\027\217q2\257h\203$\214\003"
+	.ascii	"\220u\030\377]!,\242\271\311\372o\017\353/N\346]\035\353\243"
+	.ascii	"\2345>W7\323K3|\003\262\025\325\255\\\034\352T\273Ar\352.\244"
+	.ascii	">\205\304F]\252\030\365\247(6H>\035\352\263\317\215\r\222N\177"
+	.ascii	"j\272\323\214\3357\365\271\300\247j\264\374\200\004d\246\253"
+	.ascii	"*!\363\262i\225\332\317T\351L\337<a1\351FWzT\037a\226o\220Dz"
+	.ascii	"\322\321\221>\265\204\260\210\346\346\350Sh\212\036t\243;\311"
+	.ascii	"\021f\021\332 I\364\242\241\023\355\336\n}\350QyB\177\212b\370"
+	.ascii	"Fc\203$\320\203\276\302-?\007\372\n\213s\377\363\335\303\206"
+	.ascii	"\316\032\2374\367\251\024@\031JbY\226Z&b\257\316\231\373\350"
+	.ascii	"\342 \346\210\316\216\223\313\234\321\234\325\003\004W,2\333"
+	.ascii	"\242\022\020|\2106O\215-\246\f}\313H\240\201\337\301wg\367\204"
+	.ascii	"P\224-j\025qn\b\372-\023r\374\324\227$V\214\2310@\217\323%^\334"
+	.ascii	"V\227\347\347qZ4\365%Q\026\370\325\204\314I\230X\0221\022~H\020"
+	.ascii	"{\222d\b\024R\303\272\214\214\035)B\0266&&$\n\031\021$aC\222"
+	.ascii	"\020\361\032;2D\211WX\023\022\274\272b(\331\022\261&^N\310\310"
+	.ascii	"\232x\005\315\225\233\2044c\365\b\213k\267\355\303\2663\001\242"
+	.ascii	"\216\026x\320\236\266S\200\330\330\311e\201f\301\316\334\347"
+	.ascii	"\305\3434\310\207\253\245\362q\006\251\255]\362\341\336\255\327"
+	.ascii	"\333\325\262]\247\024\371\261\017\271\244\250s\002k\354\313\366"
+	.ascii	"\337\222/\225\357\016|z\326\340\314\340)\347J\255u\237+\023J"
+	.ascii	"\270\t\3779\225\275\204\223E$/+\242!\371\276\315I\023e\204G\201"
+	.ascii	"\333#\037\341H\337\023\021\376\304\310E\030cD\217\223\020\356"
+	.ascii	"dL\bE\036\274X\330\213\204M\321\266Doz\260\322B\344\253\305h"
+	.ascii	"\310\211\fyc\006\302\315\254e\205\034\004!z'|\360\023\316|\020"
+	.ascii	"\344\301{\320\301\203t\360}\223\223\306\312\022\275i\241\212"
+	.ascii	"\013\220/\027\340\217\003\371\230\267V\3741\305\026\273-\007"
+	.ascii	"\337-m8\320\340\301o\220\3015\310\340\316p\211\336h\241\332\267"
+	.ascii	"\275\333I\204\013\333\347\343\373v\265pK\232\021>z<x\fx\274\307"
+	.ascii	"\222\363\370\276\305\321\023\026Me\233\210.\036\247&jW\234+\272"
+	.ascii	"E\350UQ.5[9\\#\246t\241\3242\233\226\345\331\302Y\251\024\206"
+	.ascii	"\261\303\263\343\005\037]T\256\035\373\005\337\273\235E\276>"
+	.ascii	"\341\226\251\231\245\344\344\207\026Tp\013v\274\202\r\222\024"
+	.ascii	"|\307W\230%\355\024\300\361\321\021\026\321\244\354\226\213\r"
+	.ascii	"j\211\327\250\252\223}\250PI\2563j\351J~\320\220\247\316\t5\357"
+	.ascii	"\331\335\231\3658]2L<m\225/\231 \234\326\312\227\314\027\246"
+	.ascii	"\275\362\215\202\314\025\245\035>\311\207\252]K\366%~\333\034"
+	.ascii	"q\307P\\U\016$\317\323"
+	.string	"\343\366\254\034\n\234;N\217\323_\337\004\263\234\340\313\003\034:\001\201\230\250a4$\221ChFDDD\222$Ic\261\005\304\030\007\235\225\007\021"
+	.ascii	"\245c\220\231\210&\005)\244\0036\321\007\223\024\b\345ps\325"
+	.ascii	"\177\264b]Z\306;V\"\316\200.\216\302\245\350\220\314-\371\326"
+	.ascii	"\n\026Wb\236\323\004E+0\377\007\2551\240\007\341he\271&"
+	.string	"\313W\303\034#\244\\<3I\241\265\026\202\353\177\003:/\336\236\377\370\035\177[s\177_\366\302\t&\366\324\324\342\363\372p\324\0308\027\361\370\331Y;\3509\001m\023=\024\342\003\376\271\354\207;\020 Rj1\247\310\\7\365Y\255\311\360\032\005Y\365}\377\200p\002)^\rC\013\2015\024\256L(!\271\2555\365sC}\214:N\203\366\213*\207\033S/9\347\025/g'\276\030\003\227R\003\036\205\316\322\032.9\264\030\322+\342h&\370\251r\356\251\240\204R9\255!\253\376\315\301b\006\210\310X\265\266E\"\031\332\346|\006\350\321\036_k\336\377\326\205\251\037\356\242\021\022\353\270\2652\337\205\216.fI\021\353\222\021/\364\331\306!\261\355\374\263\313j\316$f+\032\354\313\013\032\276\366\202\325\370\245\0359u\341\341\321H\374\033_;\277F#\234-\0252\037\366\343\303\230\350p;\244@2\200"
+	.string	"\033\225 i\332\330\250\266ed\037\027\212\275\002\036\254*gz;D\340x\021`\2032\350\246\206\0374\220\305\021\265\331\210\211Q\2254V\271\237v\300\310\262\363\352'\224rh\215\0069q\273\021\026!@\315\265q\257\266i\364\020\373;\221\2079\375\331\276\200\377\001\2379\230\267\233\004l\221\307\005\356\254 \032\022\n;\243H\270\334h\216\t\2327\255!\004\250\320\025\236f\r' W\n(\037.q\355\366'\374\363\225\227wDQ\345KA\217\275\352\221EE\361\257\001\276\001C6"
+	.ascii	"\224\006\232\0233\\?Z\\\236{\317\200\201\312\210@\nP\257D\274"
+	.ascii	"d\274\037\257\3754d\007\331\231\311\222\2014\331\360\210\303"
+	.ascii	"\211\017\276\253\340_\215\334\333\230\266\261\305 ?\027\210\237"
+	.ascii	"\336M\244\360\246\355\232\3626\037\222(\233\331\275P\246\317"
+	.ascii	"\303H\034b\214.\330\264\317\234<\203\260\321\r\206\300\205\021"
+	.ascii	".\2550\246\262\201B(=\334\255\236\\\263\215@!\210\223\344\214"
+	.ascii	"\2120E\031\333\032\025\003\311y0\r4Y+\207\346f\025\035\217k\220"
+	.ascii	"\373\375\214D\016.\037E\301\002\346\364\240\355T\236\016\274"
+	.ascii	"\265\007\305\204o\221\016H\n\223\304\363\236\341\310\261\270"
+	.ascii	"\232|\314\272x\341sB\2251Y\007\022\222\335K\333\341\257\b\260"
+	.ascii	"\022\257\\\331\212P,z\201\035)\247\363\272\374\332\315\202\177"
+	.ascii	"\007\274\234\332\251@t\340\211o8\375\356\r\266:S\222*\327\266"
+	.ascii	"%T"
+	.text
+	.section	.gnu.lto_blackboxEncodeTag8_4S16.32.7f1fe50f3fd0f3b7,"e",@progbits
+	.string	"(\265/\375`\350\r=C"
+	.string	"jwl\03150\352\311p\240\306C\275.Ib\250\001\2326s\361\235&\210\271C\317m\354\210\345.\231b\221\240."
+	.string	"1\tw&\373"
+	.string	"`r\322k\237\020B6\331{K\231d\205\001e\001\221\001\274]G^\256#\357\326\221W+\345\315Jy\261R\336+#\257\225\312\253Ly\223)/\322\310{TyU\225\327\230\362\246F^4\345=\231\267Q^Fyo\004\301^\245\036\210\353jeQ\325J\tE\304\346\206\376B\377\240\177\317\357\347\007\364t\367\2076\251\206\320~p\223\205\220\b\372\304\345\354\202\366\202\233\034\364\207\320\026\036\352Q\336m\262\347\363?\017\264I@}6\372<\260\311\375,\241\372\244\251\372Q\203&\324\272\256.\324\243\n\316\305\260\241\311\367\320\251k\033\343\0375iB\255+\340\327\321=\261\f\270d1\004\377\257\356Z\353\032\246\320\320\272\002\202m\007\365\350\361<O\223\255\023"
+	.ascii	"X\346J:H\325]\240\251u\005\024[\300{\245G\325s\245G\233\214\326"
+	.ascii	"\236?\001\277g\327\275\213kK+\013\353\312J\231D\036Uc\212\236"
+	.ascii	"\315u\373@?\353\230\232\204\227\367\344]i\316uR\360\203\244w"
+	.ascii	"K\3154\247W%0\236\036\b\ro\335R\363\314\241%k\031\307\306\\1"
+	.ascii	"\363,\254\253.~l\245Ln\321\302H\343\330\3218v\245\314UKM\276"
+	.ascii	"S\301\2027\315=6\366!\363\356\322\254/M.i\326\202/\3152gz\350"
+	.ascii	"`j\334|\271b\346\350\2514\204\323w\225'\345\314\300'hx\30133"
+	.ascii	"\317\216O7z\357\013\236\302\241&\274<\275\263ql]\327e\274\274"
+	.ascii	"+_\257\357\276\313\356\262\355*\033\005Y\255\325g&\376\022\246"
+	.ascii	"X\235\325_\252\202\321X\315\344\260\324U'[\2569\222U_}\361q\251"
+	.ascii	"\262\255\276*\033A\"\262\323N6\232i\351wl$\326\343R\265\217\375"
+	.ascii	"\273<\352\343Rc\253\375\245\337\331\306F\023\321N\373w\212P\334"
+	.ascii	"\322\263\321>\023\357\024\355\025%qS\323\354"
+	.string	"\227\364\231}Pxq\271\317\272\373\3138\347\2670}s\177\371\306\216\027WF\277?xT\357\020\361N\021\n/v\363\t\032\272\351\026\263\013\370\204;\214!\034>C\333av\213\314\275\320W\356\200\276D\206\300\275\001\371\321\266\246\206v\300\377\214\007\222w\207\216\377\3759\220\2748\220\2747n\350[\303\214F\331\214\017\372\312\210q@_\030/\310\376\367u\201\344m\221\362\262@\362\256HyU\244\274)\276\347\213\002\311{\342\310k\342\310;\226\362\226HyI0\357\b\224W\004\312\033\002\311\013\"\345\375\200\344\365\220\362vHy90\357\006\224W\003\312\233\001\311\213!\345\275p?_\013\007\364\025\373\3377\f\311\013v\344\255p\344\375Jy)\244\274\023\230W\002\312\033\001\345\205\200\344}\220\362:`\336\006(/\003\224w\001\222W\301\2217\301\221\027A\312{\200y\r\240\274\005P^\002H\336\001)\257"
+	.string	"\346\r\200\362\002@y\275\220\001}fZ*\352q\320\320g\275!Ck\310\320o\202\032\274Z\324te\241\036\253\026\323\351\030Z\355Bc\270\320o~\232\304\354\003\303\321f\rV\241q\240\375\323\277\272\002\205\376\352\364\3239\241)4\272j\251\270fB\204>k\t\020:\002\204\376\234O\203\312\007w\320\017\272\003\327\352\3528`\320g\335`A3X\320oz*\225\234C\007\323\225\205|H\005\234\350\2726u \336(\263\356j\005]\204\356\364\022tW/\337)\222u[\363\247e\034;!)\202N\320\277\333;\320\b\032M\\q\240@\237\265\001\002]\200@?\216\247?\307\363\022\322\001\375\243;p\251J@\017(\023"
+	.ascii	"\240\317:\300\021\335\253\001\324h\257~\263\023b\006>AC\265\305"
+	.ascii	"\354\327\313Z\202\034D>\207Q\030\325\276\322\t\220\242\364\204"
+	.ascii	"W\t\032[\314\246\375aK\312\2647dAK\373K\013J]\327'\367\373\017"
+	.ascii	"\244G\227\361V*w\332\254^\326\t\224v\027\324\357\267\333d\027"
+	.ascii	"\224Zfm\256\200\353\204\2437\372\207\376)\217\"Q\222\302\212"
+	.ascii	"\333\247Kc\364\2156\356\245\347\t\243\305\304z\037\311\211 \035"
+	.ascii	"o\252K\217^\231\331\273\360\034\255\243\337p\032D[\314\0329\251"
+	.ascii	"\247\022\025b\260\313h\346\007\1774\223\bT\317\365\003]ML\264"
+	.ascii	"\206\367t)\214f\356\377\370p\212\302\250~\256\353\272\236\033"
+	.ascii	"v\031]\244/\370S\325\241\246\245\037W\3175\023n\265Vs\365\357"
+	.ascii	"\364\344z+kolnmh\222\313\305\025Qc{c\233S\223\260\255\301\271"
+	.ascii	"`{KKs\203K\312\261\265\265\031IK\347\330\214\274\241\035I\333"
+	.ascii	"\214\244\365\252\205\371\200s[\213S\203c\353\221$.-\210\032\332"
+	.ascii	"[\232\030\234\033\232\02015\2719\2610\t\0337\204MN\254H\\\234"
+	.ascii	"\234X\022p}\207YQU\270x\364\236[a\375\342E_\371e\241\004\245"
+	.ascii	"\355\fu\241\250\373B\247\354\nk\036wL\375Y\306\261c\260\311\316"
+	.ascii	"\032.-\263F\321\314\325*k\013Zd\035V\341\026x\217\316\342\326"
+	.ascii	"\243\254!\352)BI\350\327k\320 ,\204\276\360f3\376\320\257\227"
+	.ascii	"5\363\207\216<$\224\224E\244\027\025\353\030\315\3343\313E&B"
+	.ascii	"?TG\223m\rf#\207\216\326\225Y\357\2314\3533Z\244\376\350\302"
+	.ascii	"9J\265\336\363hVi\222\037\326[oj\3264\232\271W_\3373\371\365"
+	.string	"\037:\312\310P\255\360=\225e\211\216\374\216__\254\262\262\236\321\314G\032s\005\207:2L\256\365\236*Y\277\020\213\022\255\357hyl;\312\211\244\210\005\244\367L\311\332E3w\377\3501\232H\243\204K\305\327\350!\255\204\023\342\322\317n\322\317\253\030NV\213~c\321-X\364\233\210\203+T\364\212\237:Y\003\031\365\024\255\"J\212Ef\337\211\035m\326'L\364\216\2616Q\242\307:MT\222\350\022QH\210\350\263\036\021\242E\204\350\317\001\205\210\005\242\367\251~\274Q\037\032Dw WJ\326p\037\0301\373<th\017\335\201*\207\356\020\201\023\250QH\003\225\203dFFAA\n\n\255\031q\005\004)\b\335\365\0210\251T\016\325H\223R: V\214F^\245\326\3401;\215\335\267\n\363]0N\345|\301\313\360\310\322pZ\244v\277hZ\333zF\007,](\234\311\325\002\352\337Q\303"
+	.string	")\215U\263c\322=V\304\026\277\203>\320c\266\f?\213Y\031^\247)'\0204\026\226\233\"\244\237\322\021\355\030\202\271\337F2\210\005u\004\030\302`?B\022\234\364\034*\375$\326C\247\262\3247/+\271\2045\215;\316\034`>\017\271\216\021\235\262L8"
+	.string	"\352\364\356o\031\234\0054B\022\261K\377%\030\207\331\223.n0B\241\205\033Jc\232\205%u\217\331\001\241\"\305V5\245\325\031\326\253\230.\207z\270\355\330\177\251c\356\034f\206\n\275\217\3229ew\220\356\017\f\200\207B2\217-(\201|\307B:A+\355Ap\354\020\004"
+	.ascii	"\021\016A\233\033\277c\016\312a\275\310\311a`\257\0362w\325\036"
+	.ascii	"\212\025\nR\224%?\021ZvHK.vp\025\207RF /\244\360T\200&tgxP\354"
+	.ascii	"%|\251\234H|\356]\236O\252\203\237\213\374\233\025\344\373R\031"
+	.ascii	"jF\365c\236\004\247\274G\247M\371\227;\244\332\206>\331\230\233"
+	.ascii	"\3428\267\317[\261\374\352\250"
+	.string	"/!\247o\263\225\310\270\003\204y)Q\212G\334\331\307X\005\316>U:L3\363\253\340i\317\350]\353\307\245HH\311Z\005$\007\035\035K\335\355\316!\356\272h\023\027\3008\024\016\321\t(\374\322\250\237\223\210\247\016\323|\272\\\344.\005\326\232S\205}\237>U\205\343BQ\255\023\327\033\305`p\002NH\"\227\345\001\005\254c?y\016b\275_G.\007"
+	.ascii	"\345\310\236I\317\003u,\277\335\310\027\201\032\231\026\027\034"
+	.ascii	"p68\216;/\002\030e\341\211\255n\225\330)\021#*\243\306\377?\265"
+	.ascii	"\023{\177"
+	.text
+	.section	.gnu.lto_blackboxWriteTag8_4S16.33.7f1fe50f3fd0f3b7,"e",@progbits
+	.string	"(\265/\375`\263"
+	.string	"E\013"
+	.string	"\006\025M@ O\225\016#\352C \034\312\2538\024\370\216R \275\232\241^+U\f}"
+	.string	"v\027Z\303\266\213\301\362\346\355\346Fd\344\037"
+	.string	"\210\350\016\005>\006o.:`\215\342(`\233#\214h\023)S\n6"
+	.string	";"
+	.string	"8"
+	.string	"\013N\\ {4x\217\310c\366\216\310\243=\033\306A\323^\205\207Q+\306\356n*\342\336\323\363\317\272\366\221@O\r\004\273\353\374H\035n\275m\001\266\023\330W\020i\305\322\251\351k"
+	.string	"P/.\264\330\335\020\312XWdq\372\352\267\177\226%6x\023\336W\237lG,8}x\355r \360h\003(\264\247}\324S\336U\030\316\261[J\261b\003\037&L&\3779@\252\352d4#\224\241\235\n\322\322@B\224\241\265\214\372\023gu\331gO\350\344\277k\210\213\022\256\f\n\262APj\b\373\330\356\256\265d_\365\307\030\017<\026\355\\<\232J\205\2109\n\204\r\306A\307m.\r,t\226\fW\321X\266\r\246\022a\3438\235\2152\300\235\204\013g\243\320u\234M\002\356\261\325\222\031\244\\!\025\371\203\355\2028\360Ze\350\215\324\023"
+	.ascii	"`\2517\023:\302\030\212\037\237d\201\00710\020i\210`\323g\002"
+	.ascii	"E\215\365\032\313\3205\360\fW4e\r\354@cy\352ip\222\027\327$\003"
+	.text
+	.section	.gnu.lto_blackboxEncodeTag8_8SVB.34.7f1fe50f3fd0f3b7,"e",@progbits
+	.string	"(\265/\375`\255\003U\033"
+	.string	"\306r\261J\220\330Q:b\242w\372\350F\230\375\r\fp0\026O\337\226W'\360A\324\341\030\005\354\216\364\210\316T=\332\337\276*\326zT\302\027\264\021\300@0\232E\240\026\230-\201\200\336\f`\344z`\323l\313t#\204\220-wJ\001\237"
+	.string	"\215"
+	.string	"\241"
+	.string	"\265\376\030\370\001\371\3608\236\003\310\267\230\337\013#\321\252\211\307\303J\255\277\232\177\017 >$?\023\037\256\013\217eY\226\247\277\3335ooq\221\243\030\322\2357\037\367\026:\n\r5\235fK+\310\201\273\351z\013#\025'\r$\031\035}\244\t\264\200P9\022\242#\032`\250\251\367*\342MQt\252\202\222d\244\342!\025\300\202\210\211\003o"
+	.ascii	"\t\021\022=pD\311\211\320\244\317!})\315\217j\025+\322\321\261"
+	.ascii	"FI\343<>}EAs\216\021j\255\236\275\"\243\373u\333V\266+\330\253"
+	.ascii	"\013Kts\313\376\341\34625\251"
+	.string	"\202\365\344]\262gd\376\373c`\036\365\323\276\343\237y\372\345U\267,\366\250\333e\247at\372\265\323\244\247G:-\356t8\247i8\275\341\364\244\323\037@`\306\221\021e\255Ce\260\032\t\2038\275\352\366\251|`\225\261H\034\021\331\303\252J\253\326\252\340\241)|\312~=\274\rd\277l\357\264\257\343R@\337a,\372RuJ+\256j\255\f,\201|X\200z\376H\224\020\346\243n\007P\353\322\220\253Y>\244\327\322\224\274\027E\334\357k\366\203g\202\334\257'/Kn\301\311\335)\273 )\256\205\240\220\243p\242rb\324\021\303}\222\024\223_\205\320!I\354}H\2731K\367\273'z\017\021\347\356~WC\266s\017<-\022\264\342e\311\315r\251\204\b\025\211\313\264#\372>.\354\300\224\310\360o\342\3030E\226\r)\271Y\332\301i\013\263\237:\rby\262{\n\232%\315\213-\255\220"
+	.ascii	"\324\023\251\"Y7\200Y\224\2341K[\373\203\317|o\334pq0(\037\326"
+	.ascii	".\223\027|\266GPI\244\0029\007\301\363c\233\320\342\203\363\323"
+	.ascii	"\241&\204\270\341\307f}\323\200\003O\216\006\333\r\017N\006\021"
+	.ascii	"6\033\235\233\232\01665\236\234\232\235\332M\217O\255\001\002"
+	.ascii	"\333<\340\364\324@\330l=\265\327\257~\227lJ[\273b\353\035\367"
+	.ascii	"\345e\035!\267A-\313\344W\frfa\\)\021*\270l}\246\244\313~\352"
+	.ascii	"\256+U\212\2040\033[\337le\013!JI\212\210nn\235\326Z\253k\231"
+	.ascii	"|\340]PW\242F\2315\025c\353\262>\331\316\354\237\202T;\026A\263"
+	.ascii	"\234\244\313\204mlm\0169\363=\231- \2648\330b\b\006H\250Q \245"
+	.ascii	"\020SH1\321\210\004S\n\025\250\003P\0021\350\324\016\020X\214"
+	.ascii	"\246:H%\240\271w^\305\312\027f\r\022\007\336\207?\277\212T\322"
+	.ascii	"R4\337\244\004\t\307\013N\200\257\001\022\030\003*1\365\346\351"
+	.ascii	"c\037\331\004\234r\315M0\221\003h \2732!\3378\3566$\252P\203"
+	.ascii	"\326\202\245B+2% \314\030\336\275\021\265\252\375\311\220!\333"
+	.ascii	"\366o!\256\243b\343\031@]rQ\353\266\270\237\3037\0311\352\304"
+	.ascii	"\206\003\333\371 \310\f8\f\221[\311\244+H{\253\241L!\221\241"
+	.ascii	"\2470\212\f\252\006"
+	.text
+	.section	.gnu.lto_blackboxWriteTag8_8SVB.35.7f1fe50f3fd0f3b7,"e",@progbits
+	.string	"(\265/\375`\357"
+	.string	"\255\f"
+	.string	"&\030WC\020q\224\016+\204\002\017X\346\320O\236\200]h\204[\002\246\200\035v\367\013"
+	.string	"\271\230\203\022\265\210\210pa\337\254j\205\364\273\334F\366U\325\030D\366\323\"\200\354\033\271\f\266!\022\264=\211d\023)S\nA"
+	.string	"E"
+	.string	">"
+	.string	"'\272\233px\200]\224\212\225]pc\006\330\243\301\017\270\036\261\013\270\036\335\3314\016\222\354Uf\204\234\324\330\335LG\274{v\376U\277|\"\336\223\343\301\356:?\221\020\267\3366\002\333\023\354\233\002V\372\230\003.btP\331\375\020\332\330U\\Qr\224\337\376U\316\370)~\322\035\245\003[\022\021JXZvA,x\264\004\3541S\024\330\t\036E\367\224Y\370\262;\302\262\262\273\0337\300\0365\326\323\276\211\007\377\254\361\240\236SU7!7<2\264S\013\310"
+	.string	")\361\221\241/yi\324\247\\\305a\237\235\241\224\377\256\006`\264X\201\250g\203^\252\b\373\326\356\256\025e?\365_7\371c\2465\2463\025N\0375m'\016\002\246\004:\215<\032.k\034\013[\210\002\247m\240\316\006\356#\322<\243O\266\205<\0272\215T\3128\t\314a"
+	.string	"\2212\023\307\221\262\f\270\267VQ\356\274Xy\350\207;\254\335\021\007-\251\f\r \225"
+	.string	"IH\224\001\025"
+	.ascii	"T\004\003K\275\231\320\021\306\300\374\370+\013|\210\201\013"
+	.ascii	"!7P\t\034\265\266aY\326\256\201\021s$\2349h\367)\034\001\033"
+	.ascii	"\240\2114\205\005\\\313\013a\222\001"
+	.text
+	.section	.gnu.lto_blackboxWriteU32.36.7f1fe50f3fd0f3b7,"e",@progbits
+	.string	"(\265/\375`\364"
+	.string	"u\013"
+	.string	"f\025L>0K&\035P\\\211u\006\347B\357B3\330\203.L\344\214\204I\317\311\247\256\035\033\036\037\207\325\220\230\255l\3455\"\"J\213\376\200'\364\251\331\237@]\231R\322*\024\365\336D\312\224\0028"
+	.string	"4"
+	.string	"="
+	.string	"\254\r\273[q"
+	.string	"\307!\345\027\361P\273E<\264g\203x\253\302\336\0253i\210\355\356\246\024\356==\377\254?N(\321Sb\300\356:O\250\324\255\267\255a[\200}\007\001\276\266\273kU\331\231\236dZ\222\351\310W\177\3144\324\264\246i\315tf\372\024\0312\017\236k\367\301'[\030\344`\001b\373i\377\3021x_\205\374\330\225\020O}!L\263\321$\303S'\025\251\237\357\203\004@\204\253\304qw\210Q\257\237\357U\232\305\214\250\rZ\220?\371\254O\274D\300\032\250\310\377\036\212Q#\3524A \345g\267D\251\023\034\032\020\007\243"
+	.string	"\232\263\024\350l\bt\\Gsa\320e\fp\030Nf\353l0\0076\316\223`\263l\270C\240\361l\237\256\363l\220\326^U\276\214\200\215\224\344\230\220\242)\324\n\206\252\246/\315H\252\032\030"
+	.ascii	"`\251'\0230\373\315\300\203\263\254\330\035\302\013:\242\r\301"
+	.ascii	"c\006\202\353f\225\024\024\006\306\003\204\340\212\243W\023h"
+	.ascii	"\206\241\253R[*\224\002L\270\204@\254\246\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_blackboxWriteFloat.37.7f1fe50f3fd0f3b7,"e",@progbits
+	.string	"(\265/\375`A"
+	.string	"\245\b"
+	.string	"\346\220=7@\217\322\001\233\276\t\325$\035\r\304o\231\303\006n"
+	.string	"MJ\371\0166\326\206\266\306\221j\223\321f\254(\333\310\030G\3211\272{\273\261\337\005`\301\226\326\022B\244L)+"
+	.string	"."
+	.string	"*"
+	.string	"\017\330\256\331\263[\356\n\331\201\021\214\224\311\313\356B\005\271\367\364\374\267\316}\252\3233\203\260\273\316O\265q\353m\023\330>\260\255\022\3174\235\231~\006\300#C\365\213\225]\215\030\314\276\264\024\221\215\355\247}\222\227xg\371\304\334.K\013ew;6\320\\\343\\`\273\226\005\\\246\332\361!\377\231sM\355\244bP\031\363\226\231\332\246\211\374wM\027\030\307\313BO\266\353\224\372a?\333\335\265\256\354\263\036!\323\350#\241\271\363,\220D\n\261#\205\022(\"\210\241\373\214@\220$\3724\300\256\004\001=\005\216\016\241\022\214\210\261\0047\256}\266\272\262\006\326\361Bi\205\003\n"
+	.ascii	"`\251'\023Z\373\002\303E#Q\341\035L\271\004\333\254\246\200\273"
+	.ascii	"\274h'\031"
+	.text
+	.section	.gnu.lto_blackboxEncodeTag8_8SVB.part.0.57.7f1fe50f3fd0f3b7,"e",@progbits
+	.string	"(\265/\375`\373\001\265\020"
+	.string	"\026\036iF\360\260(\035\360-z\003\317\300u\326\305*\f\375\275Y_L\265E\262\350\367\253B\351\032j\260\233f\217\ra\352\244\026U\213\242\254j\252\325\360L\332\035\230\333\307\351O4\341\023?-\246B\207\013\021M\366\226;\245R"
+	.string	"Y"
+	.string	"Q"
+	.string	"\340\003\354\276f\320vC\221O\033\340>\355\307\250Tl\373*\276be\020$<\341a\233\245\340"
+	.string	"\253\261\033v\237\016/`\373\344\376\261}\252\211\203\327(A?\272VX\327\313.i6d\270V><z\\r\220\354\2569\020\367\274\355\003\266\033\330\361A40\206\320@\271!>\333\232\305\300\354\206\fl\374\233\027\336\341X*\234l\026\243\261"
+	.string	"v\037\246\362e\366\324\250@\035\273-,!\237\226\321>\213\267X=\346\035\371\331V\t\021\264\335M\300}\202\344?\266\225\355\261\306\323\314\244t&UC\020\037^\006\004\tW\304\216\227\t\361.\251\240\r\312\262\037#\003\312G\341\247\266\317\250\227\275#\205\005%\326\242\272X\345\345\352\313\323\321\362\341\2572:\236\346?7\240\300\210\335\016\265\033Kb\346\274\034\347\327\371k\256\366\375\331u|\030\366\334\250@\255\317\266^b0\267\271\013?\007'&\257$\344I\330H?)\241>\005"
+	.ascii	"N\036\312$ta\203\200\022\251G#\021J\244\222oT\362\034`\370D\023"
+	.ascii	"F!\023QW\"\205(t#\323\251\033!\340\257\202g\352N\276\317\324"
+	.ascii	"y,W_\276\354\036Q\352\324\024\333SM\202\242\032T]l\313\330j\213"
+	.ascii	"\271\030U\325\266p\n2 \220\"\242+z\310b\204/\342\336\242\245"
+	.ascii	"\223 \222\200l\311\353\b?F|c``\001\314`\234\240\345\261\322f"
+	.ascii	"\031\364\262\267`y\b\246\373\r\004$5\334\347\203\016\310`\202"
+	.ascii	"\370\365\314\250\030\321\361\360\272\035\315x\341\276\305\205"
+	.ascii	"_\317\006\311C\220}\320ed3\252q\005\272\031w`\247\\\\\2225\007"
+	.ascii	"\232\034\341\035\336B\224Sh\227^\213\307"
+	.text
+	.section	.gnu.lto_.symbol_nodes.7f1fe50f3fd0f3b7,"e",@progbits
+	.string	"(\265/\375`\243\004\345\021"
+	.string	"6\331`G\360\2226\035\330y\375N\347\030\321\235\352\251\227\224\0331\005\201\373\212z\341\201\326\270\362-\275\2661\214a\261sqx\006\236\201\221\230Lj\246J"
+	.string	"T\001U\004\251a\023\231\375\337n\377=SF\263\357\267n6m)\003Q"
+	.string	"N"
+	.string	"F"
+	.string	"]\215\03574&\255*\351\024\330(\230\020?x\220\364i\325\246\221\346\276\026\020\232\001D\207\327\245\217\212bM\321\365\002U\223\246\212\3051\223AF\252G\037j\345:\3656E\252\301\324\"\214\212b\013\232\335\336\215\021\303\034J)%\2656w\367\342\020\251\371\020\344\346[&~x\342\203(~\213\333\303\364\213\202vI\320-\b\232\345@\253\030h\223\002\215\362\322'L)\335\365\202\020\350\024\336]\256\021\006\204\\.]\322\322 K\223\344\270\2619\261\322+\225\036I\351\217kL\315\004\224\366N:\\\202\004\247\235\253'\362\025"
+	.ascii	"\221s\031r\276\221\205\316d\027"
+	.string	":\327d\240\277\240!\241B\007:+\373t\237\203H/{\250\312\216U\317\231\364\234\313\316y\354\234uao]\007\273\353!\347\030\227\363L\316\3638\3175\313\240t\360+\275\203\3251d\016%\215\266\321?\035\230/\310\364\260pmgq\210\005\005\033l\023\005\020\235Q\2243&d\310\021\"@\224\037*{\250=\362\332\200P\231\265? \035\324\006#\337\205\217\r\234vo<\225\27400\254\340\264o%\007`\250A F\212&\222\222B\2511\340\002\241\032R\007\021`\210\006%r(\240H$\"\013:\225\265\t-<\276+\204\341$.\001\013\022\333\252\272A\336)0\022\264y\f\265}\004\2030\352\356\267\247\373\005\250ES\230\244\234\225\215\031>\303\344\003\375r0\236\340\246?\241/\350R\230\357T\005\t\247\024\307S\311 Z\336+\370\021\n22G\277\315k1vO\266\202J\241N9#2\220"
+	.ascii	"7\356\007\214Yr\023OL\265_\370\f\2326\207\347$\214w(\371*\305"
+	.ascii	"G\233\361\020e\277\352\230\263V\224\201\255\343\367\200\t\255"
+	.ascii	"\326\272,\314\242-~\031\327\203\266j\025"
+	.text
+	.section	.gnu.lto_.refs.7f1fe50f3fd0f3b7,"e",@progbits
+	.string	"(\265/\375 \031\311"
+	.string	""
+	.string	"\025"
+	.string	""
+	.string	""
+	.string	"\001\001\002"
+	.string	"\002"
+	.string	"\003\002\002"
+	.string	"\006"
+	.string	""
+	.string	"\003\t"
+	.string	"\001\003\f"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.7f1fe50f3fd0f3b7,"e",@progbits
+	.string	"(\265/\375`\027\037\335\202"
+	.ascii	"\352\312\f-O0P\322I\007\377NM\271\272\317\b\240\231\367{\267"
+	.ascii	"i\017\332c/\037\335\21550\"{\004\202\371\307/x\357F\257Q;@\245"
+	.ascii	"~\343\357\310vUKA\025\266\215\271\330\302\030\030a\272?w\363"
+	.ascii	"\244\032\203\322Fo\021f\376\232\223lq\023)SW\002\257\002\323"
+	.ascii	"\002@g\274\034:1~dh\356v\262\314|\\"
+	.string	"i{\276\373\331\216\317\374\255\327iZ`\220\266\257\343\020D\0350@\347:\225ML\023\241\031:\273\204K\r\354B\377\234$\233sr[P[\2017\372\004\016\371$\256\214\336\0225\033\332\236\313\374<\206\311\260\231\n\f\004\316j\253\355\017\207 \3420\b\"\177\001:\303Y,\301\250.1o\374\266D\354\206\266\314\306mLF\202\335\316`8\314q\230\240P(\317\233\273(7m}8\004\261-Xi\270\227I\020\371\360\220I\254\251\271\220vy\266\345.\214\306d\177c/\347/\234\366\016J(4\252\243\207f&\260\355\t\016A\264\020\254/\024\371ogf}7\367#\331\226\243\274\205\311L0\227\267h\340*\262\354\206\335\013\355\3311\274b8\330\366.\326\263\t\"\037\262\t\"\227\251\313\037N\350\007\234\300\251\240X[&\3432\316r:\035\347\275\312{\257\b\017jRC\240\264\345\021\f\202x\036\273"
+	.string	"e\267\201\367\n\004\004\306a \210\314)\350=\273\367\3660\331`\026\270\266\207r\b\342\312 \210?\"\374\354@\364g$Z\356\341o\262\270\027\377\266r@\331_\t%\262\244\200\"\260\001\337\036\t[5t\376\206\022\327\2049 {\036\bIX\354g,&\374\f\221\021sOst\347\371\333\2068\023\276\363\267\f?\273\260\222\342\035\376f\341g#UN c\024f\304\033\210\277\2157\201\006"
+	.ascii	"\177\327`)*>\177C\360\237\313\317^SR\374\334\225\3637\020\367"
+	.ascii	"x~\200\277\017\370\231\205\255\237g\220\362s\362\347(Z\f\345"
+	.ascii	"g\253\017\177\223\370\371\206\363\177\211\257\177\367\374\234"
+	.ascii	"\344g\252\237\203\374\314\374y\371\263\362g\032~V\372\231\350"
+	.ascii	"g\343\317B?\237\360s\t?#\3603\t?\327\3709\350g\020~\356\340g"
+	.ascii	"\f~\236\361\263\004?\307\370\371\305\317,~V\340\347\237\237M"
+	.ascii	"\374<\342g\020?\177\370Y\347\177\230\377\037\374\274\376\\\374"
+	.ascii	"\371\377\217\b\377\317\375\247\361\177\360\277\233\377i\377\333"
+	.ascii	"\374\347\373/\375\177\367\237\356\277\334\3772\377\337\376\253"
+	.ascii	"\3757\373\037\364\277\354\377\003\377\343\376\2138<<<\374\211"
+	.ascii	"/~\273\301\037\302)\357.F\214\364\221\325\347&\357\320\236\037"
+	.ascii	"pueU\275\217\354\330\t6\221\266m\25291\252\245\234\032/%=\272"
+	.ascii	"\204\b\351\251\025y/\022z\243\210Z\262r\324\342\236\230\332\366"
+	.ascii	"\024\237\021\237\352\256\030\266\355!|\246\003xUx\t\211tQ\204"
+	.ascii	"o\212H\235\311Z\212\345\254\262\3546CP\213\222\233\336;\265\300"
+	.ascii	"Z5\206\206\314\016\n\252\233{j\3243\250(-\346\273\311f=\003\006"
+	.ascii	"x\244mG\351\\uIc\236\255NN\375\203\357\362\336\251\253\352\235"
+	.ascii	"9\261M\357\324\324\217\0074Wnonx\377x#F\305\351\211!w\302\266"
+	.ascii	"\362\350\332\236\257\370\350\036\315\350\032\266\266o\246N\276"
+	.ascii	"\225d\255\354\036\367\271\367&\357Er\304\303\2310NE\246w\212"
+	.ascii	"\371\363w\323\273\307\331\350\334\022;\207el\372\332\266\r\347"
+	.ascii	"\363\260&\313\bX\333\007\362\264\331\310\211\271j{\032\326\367"
+	.ascii	"O\274L\314{/\020\034\350e&u\210\214\303;\254\262\001\377\355"
+	.ascii	"U{\274\356\205\002\004\\\247\2541Q\375\304\375\272\027\371\341"
+	.ascii	"B/s\031\265B.\267\234i~\200^%\"n\024\353.\241VM\353\274}\241"
+	.ascii	"\227\257\322\252\311\302\022\352d.\241N\244\317U:\221\367B\233"
+	.ascii	">\3133&$/\243V\315e"
+	.string	"\324\331\374p\225\027y\243LJV\245\263\271\224s6}\226Q\246\346Ri\325\374\360\004x\245\266\354\263\242\342\346Ry\241\236\252\230\230>uK\250\363J\357\345\263\246\3134\340\336*'S\312D\204\331\222uP\311/LN&\361\224\274r^e\335\322\313y\257W2\307}z\201\204\326\335'\\\207\304\252\272?\232\356\035\340B\357}\272\027\311\267\356\336\213\274\367\026\231U\320{\215\370,\237OO\367N\215x\272U\310\266\246{\373L\217\255\271\214^9\201\332\270D\237\267\007\024\311\317+\265b\256Qd\226\373\243\315\372lJ\3755\262o\017X\020&Zm\241a\035\332\006\251\bi\313\205j\r\204\205\315\207lx.|OQ\372\265d\"Z\316\201\3370\331\017\017vH\323\346\310Y\333\207\260\236\177\210=?D\026d7\347)\007N_8\357e\342i\017\341\275L=\314(\230QX,W[hD\373\016"
+	.string	"\333\020\257\244z\334\346g\034\370\217\247\013\234\034\220\266\235@\037\320\331\257\312\032\032+m\177\316l\370<Te\371\322\246\355\231\357\3475\274\327\311\275iZ\333\237q\bb\0070\240\263^\317\335Z\240\0245R\036\351\030\030W\333\263\364\3474\2347\001\222\255h\333K9\004q\307.\316\350\375q\342\"\230l\253>\275\365\362\360\342\312\332\252?\336R*\2515^78\221\243\373\373\262\2768\326\3647\251K.+ .J\356\213\007\320L\b\241\332\343\352\362\315\215\027`V#\255\f\336\220&K\275W\231\324\253*q\306\324!\\\350\312\250\311\253J\036\275?d\262\355\326\030\226\231\266*\262H\004\360\007lC.\273Q\001\2109\335\b\022\367\222>\236\323\267\341\273\320\214i75\330\204M\\`J"
+	.string	"\327\316\241\337\254Mj\266\276\210lRt"
+	.ascii	"S\204\357\3609\250%\245m\2739\237r\214L\260}\200\241s\262k\333"
+	.ascii	"\201\215\\\225H\322\214\021\357\326\274\367\232\274\376\303\021"
+	.ascii	"\2737\311\002\232\224\336\345\324OQ\020\260\t\036\016\357\277"
+	.ascii	"\234e\025.V\332oK[\234\240_\237\216\235\r\206Pm\373z\257\331"
+	.ascii	"\374\336\0219~Q\207M\276\277C\016\033\226\337\024\267\365\304"
+	.ascii	"\350\332j\336znH\226X\205I\321\322P=\255\254'2Y\373\356\256\361"
+	.ascii	"F8\325=2?8jI<)h\336x8`nP\"f8W\202{kmO\234\262\263cB\n\316.S\363"
+	.ascii	"\007\356\366\321M/s\314\002\037\242\324Y\311\233\233k3\021p\371"
+	.ascii	"x\356\\M\301\033C\3676\323aQ4O\247\242v\005-L\\\\\177M\235\240"
+	.ascii	"\245)\242\205\f\231\026\353\223>W\034\220\367\214\026\034\\\257"
+	.ascii	"\255\025\361\343\021\004\374\302\021\362\366\326^\326\353\205"
+	.ascii	"P\312o*Ja[[\203y\342\303\257\350F\320\311\351\366\006\363Vlr"
+	.ascii	"Ea\326\245\245\365\332z\331\254\317\211m\352\3443\363\244\366"
+	.ascii	"^[3\027\350\306s;c\317<1]\316\316\332K\337{\357\263\310e\013"
+	.ascii	"\232_\007f\241\201C{{\351\302\025\2156\227+\317\022pSg[\336\\"
+	.ascii	"z\372\330\232\3541\035\317\023P\013\351$#\353\262\254\"\023="
+	.ascii	"4\314,\357\262\325\214n:\245mC\331\214\205\213k\2736\211\005"
+	.ascii	"K\213\255\227\312ByyR\027\366\026\213KN!\3336\030\317u\020\354"
+	.ascii	"\0024\224V\251\322_+\022\357\351\211\327\204\254G\333\376B\273"
+	.ascii	"SZn]]\355%\201\226A\277\016A\262\262\220i\333^\366\216,\215T"
+	.ascii	"\305\242\245\325O\351\323\3660D\242l\333\317\225\312\327\237"
+	.ascii	"V\333\226\262#\270dk"
+	.string	"\332\266\243\260\230\"X\337\2303\265j\315\312\272wc\234\330\276t\2528\031\323\366\352]\223\364\222$\355\204x/C\235Q\314v\302\206vyTm\233\t\237=@\005\352d\255g\352\305\344\254\255\323\331X|\231}R\234\330\276z\336(\231\330\256\336X:~\203]\006\333\266U\230\030\274\303\266\255\204\327\370\311\232\271\264\277Y!m`s\3225GII3\204p\216HF*\n@'"
+	.string	"\245\200\323BO\361\210\264A\022\215%\242#\f3\216K\306!\0208x\314x\016\023E\306\030\212\214b\3209.!%\r\341\304p4\264S\204d\244t\f\002qT2\036\227"
+	.string	"x\016\025;V %\351\320\2214D\300\322\022\321\320\220\221\210\002\320\t.R\3009\032u(%\341\020\332\201\343\350\341\204\221\r\243P\013K0,\371\024\031\217B\307%\243#\241\035\027\222\224r\034\223\220\2128\214DG\366\006\022\221\220\261\005!$\243\343\221\021\017\033BB>;\317\241\302\003\032\033\004\2558\022\025)\031\217'V\030J:\262\200H)\311\002\035D\307%\030\202z\216\306\244#\f"
+	.string	"h\341\242\006\f\240\240\027B1\210\216l\030\215\224\214#\224h\341\"\310\205P\213\"#\r\030@A>%\006\bq4R\"A\004\f \0230\030\225\224* @\004\013\025G%\343\016\0253F\b\212!\024\243\310H\243\200 \001f\214p\203\b\251\310h\t\251\006\321\005\317\241\"\311\310\200#Q\321\r\0363\002 B2\362@\211\350\206\221H\203\0218\216HFJ!\360\374\347I;\210\224V\034\223\222\224V\344\f\035y\354\020\302\371\220\221\022\021\022Q\321\372\0270\030\200\021\343\205\342c\310`!\203\005\3611d"
+	.ascii	"\001\311\200\001\264\036\006\220\272*\031s\f\331\243\020\f\240"
+	.ascii	"\026.\216HF\305\243P\214#\222\021\217\342\037x\300\202\0235>"
+	.ascii	"\310`\035RQ\204dt#i\b\211H\350\205$\033+\f\031\217l\254@22\352"
+	.ascii	"X1\244\264\264BE\212-\375\245\272\201sk\212\252IZ,l\313\325\202"
+	.ascii	"e\273\374\342\334\224\035\311yV)\271\2628\201zI\032\361;l\253"
+	.ascii	"\216\251b*\331\325\261C\257:\306\214\242\247|\2212$Z\025\254"
+	.ascii	"U,j\330U0\365\212\216R\005\263\36721\243\340aF\201\363\026\205"
+	.ascii	"I\013\321~\215~\265\227\215\356\345PhE\245Z\343\303-\214ZE\r"
+	.ascii	"27\244\f\020\250\323\263\360\317Ke\036\003\323\244\251]<tyi\244"
+	.ascii	"P.u\331\3437\r\214>\377\326;$S\320l\265!\221\b \224;)W9\323\264"
+	.ascii	"\274\033EU*\221\032\354\322V\305R\261T(1\2568\261\251L\256"
+	.string	"B\271\232\245F\235\334@=iB\256'O\262\264U\233\250N\212Z\254\224\314\255XR\360\220Y\346\020\246.Y\263V\325*\247H\2222|V\353\257*i\274i\031<\037m\217\034Q\223\324\031\032\026\313\332|t!\271\232\204\233\260\234\031\256PC\206\250T#\234\352^\231(9b\026r\214\022\325\310U\252\235 \3128\264\266*\021\265\310\341\233\303h\021uJu\022\003\\\323\211\212\202\342,T\201\250@\324 \304-~\206\206S\031y^\332\250RW\2030a\216T\230V\241\233\323U('\225i\345\252~v\314\246\323B5\352*\363\315\002\t\202\243\250b\3610\007\023\031B\206JD$I\222B\007\362\n\020\204\342\210\240\327\262\003\022@4-\323*\306\210\024\211\214HRP\220\024v\326tI\300\217*\251A\303R=\263P]\001\347\222B\324\004A\t\224\225\343\224&\3443\260r\007%\007\264U\220"
+	.string	"\0206Ay\327\b\201\326\034\254\214\230\322e\247dw7\202\307d\377]3'$\212\006\350\215\243\251\347\032\330\264\270x\231H\005\322\323\250G\217\222\362\332g3\222\363>TR}\277#Y[X\212\032\3623\342%\205-\316\321\005\260\245BEi\240\033\214\342$\206\304\331\344\016\nE\272g\316\200\027\023\264^\240a\013\0202\0277%\201\002\360\025\331\022G._\013\300[\315R\331\f\311s\320\214/\244$\203\357i\320\034\270\003\215\025 -\202\003$\267\201\267\263\n`s\223\341A)h\302\367z\261\314,\275PDn\265y\n\262"
+	.ascii	"j\027\013!\305\333c\304\273\376\236\0161\360\2762\350\222;iP"
+	.ascii	"\005<\031\224\346\261\262c\302\311\027\032*\266\301\340\230\252"
+	.ascii	"\\\324\355)\265Q!b\233\354G\264\303G4\201\003\250\240\201\301"
+	.ascii	"\371\332\3368\0355\371UE\256 \036\232\2202r\202\324\236\217 "
+	.ascii	"F\020\210q\266\234.\013y\006\303\207&\273\250\333\264\236\234"
+	.ascii	"\370\350j^'kV"
+	.string	"X\375\310\032\333\367\366\3511\310K]M\321\324\265\2541\tH\235\301:\247\360\026\300J\300$J\211\263\0229\312\373g\255\340\026l^\363f\271\376a0\315\nA\325H\364 \320\303\274\363\033H\234\302\351\r\2045A\333\207o\272\3565\264qE\250[*+0\327j\024=_\200\332T\005d\314*n\026\240\321\356p##1\277\024\203\345\325\245\342wy!%\224\235p`t@\236\337_\225\314\236b\007v\"/M#\216}\301\r\273\230\232\364\263\243\226>\0014\361\253\004\341\013:`\024\366H[\326\013\35588e\336\007\311\262l\336\\\265\331\347\362wU\224\227\371<z\264\352\371\037q\325V\261v\373n\\\342\321\213\277\255\016<\350\231\320\275}\"}\370\032,!\354\020\001\212\277\006L\026\300\336\370\274D$\027\\:\n+\256f\225@\373\334\036\362\312z\336;\256\037\370)\344U\312\327,\\\360\013"
+	.string	"z\306#\267\251\353\247JF\302\377\274%\371\200\020\22604\303\326w\021\317D\221\324[fPe\360\316\234si"
+	.string	"\\-\032\220Y0\207\030#\230\270\266\206W+\3758\372r9\350\005|\324\237\017Z\347\b=\004p(\325\004\252\035\260\254\336\254H\036\005\rvF\221\215\004!4G\0221w\260\353[\224EV\334\330\003\273E5J\362*\210\265\217\222{=S5\333+\262\374\202\357\307\277@\026i!|6\331B\251Kv]M\304j8\314\243\315@\247\327\033\225\271\224/6\2619\207\303\234\204\023Dg\312\201\327\024\016R\337Q\325\216\211\223/\t\264\351D\255@zN\216^e\237L\325\271\256CG\026Su\324\304\271\264g\226\230&\265UnY\233I\372\2446\345x\0326v\004\212\266\224\352\373\036n\350\325\001B\324R`\310s\354-\023qp6O"
+	.ascii	"\340`\004\236\213J\377\002R0\217M-\211\021\311\226\207T\263f"
+	.ascii	"K_'\207\261\306\001\343(\033\206\224\317\024\312\242\267\310"
+	.ascii	"?\202\313h\312\031\263~YtC\276\207\313R\311\277\\\026\356\031"
+	.ascii	"\250\221Q\005x\225\r(\032\312&\031\315H\320\315\360*m.]\0172"
+	.ascii	"\205K\300$7\247\356Lg\240|\004D\203-\275\037+J\264yJx(\310\354"
+	.ascii	"\320v\013\205\245\360s\334\341\365\226Td\221\030;3\270h\275q"
+	.ascii	"H\320\304 \373\234\341}\177\037\2447:\364Z\356\003t\330R\330"
+	.ascii	"+\277\302~[\231\202\356\221\036\3638\324\253\01356\034\312_\017"
+	.ascii	"\360Q\355\367\304\312'\364\353\237O\236\304X\213\3379\313\255"
+	.ascii	"P\363\345\335_\273\323\372y\n\347\231\2610\266\271\335\206\\"
+	.ascii	"b|\364\204\031\255\214\023\030r\363\225\313\036\325\273,W\004"
+	.ascii	"\276\224o\302\305\271d\346\314\343\347\373\254\256\226"
+	.string	"\215\244\337\207\372e\252O\222\237X\270\336\232[\030\313Y\362\311X~\376}\337A\"{ }l\373\227\354!}\225\374\337;\323\363\256J\375\353\252\341\316\200\026\375\320\276\261\b\370\324\371\215\370\260\273\335\203\343\366\267A\373\252\335\341gv-\\\361\277\270\006\317\206\234ZV\f\377\252\214\316\177(\277\201=\265Z\307\025#S\300\b\231)\237\024\217\234oz\024\371\250/y\271\336p\224%\366\352\261\373+\006\332.\300\262\2764*^\255\217\324\336t\243\3173\232\3133\236\345\257\376\247\247\324g\332M\232\357\227\367"
+	.ascii	"\340>\370#j3\254\237\365n\216\246\353\303]\322\330L\333\361\370"
+	.ascii	"\305\206\351\223\213\334\263\201[\341\224ch\003"
+	.text
+	.section	.gnu.lto_.symtab.7f1fe50f3fd0f3b7,"e",@progbits
+	.string	"blackboxPrintf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\001"
+	.string	""
+	.string	"blackboxPrintfHeaderLine"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\001"
+	.string	""
+	.string	"blackboxEncodeUnsignedVB"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\001"
+	.string	""
+	.string	"blackboxEncodeSignedVB"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\001"
+	.string	""
+	.string	"blackboxEncodeSignedVBArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\001"
+	.string	""
+	.string	"blackboxEncodeSigned16VBArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\001"
+	.string	""
+	.string	"blackboxWriteUnsignedVB"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\001"
+	.string	""
+	.string	"blackboxWriteSignedVB"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\001"
+	.string	""
+	.string	"blackboxWriteSignedVBArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\001"
+	.string	""
+	.string	"blackboxWriteSigned16VBArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\001"
+	.string	""
+	.string	"blackboxWriteS16"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\001"
+	.string	""
+	.string	"blackboxEncodeTag2_3S32"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\001"
+	.string	""
+	.string	"blackboxWriteTag2_3S32"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\001"
+	.string	""
+	.string	"blackboxWriteTag2_3SVariable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\001"
+	.string	""
+	.string	"blackboxEncodeTag8_4S16"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\001"
+	.string	""
+	.string	"blackboxWriteTag8_4S16"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\001"
+	.string	""
+	.string	"blackboxEncodeTag8_8SVB"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\001"
+	.string	""
+	.string	"blackboxWriteTag8_8SVB"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\001"
+	.string	""
+	.string	"blackboxWriteU32"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\001"
+	.string	""
+	.string	"blackboxWriteFloat"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\001"
+	.string	""
+	.string	"blackboxHeaderBudget"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\001"
+	.string	""
+	.string	"blackboxWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\001"
+	.string	""
+	.string	"tfp_format"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\001"
+	.string	""
+	.string	"blackboxWriteString"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\001"
+	.string	""
+	.string	"zigzagEncode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\001"
+	.string	""
+	.string	"blackboxWriteBuf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\001"
+	.string	""
+	.string	"castFloatBytesToInt"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.7f1fe50f3fd0f3b7,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1042 @@
+	.file	"blackbox_io.c"
+	.section	.gnu.lto_.profile.8e058af6d61b2dc,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.8e058af6d61b2dc,"e",@progbits
+	.string	"(\265/\375`\030"
+	.string	"\r\007"
+	.string	"\304\n\f\001"
+	.string	"\027"
+	.string	"\226\223\225\252\r\002\002"
+	.string	"\002"
+	.string	"\001\352\263\360\321\b\002\376\201\211\336\n\006\001\002\001\003\240\342\234\212\n\004\246\214\355\273\004\004\002\002\003\005\311\231\247\372\017"
+	.string	"\006\360\340\271\300\013\007\267\226\343\242\t\b\373\327\252b\004\002\004\t\274\205\242\255\006"
+	.string	"\n\222\345\311\225\006\002\002\005\002\006\f\233\312\344\255\f\022\002\005\002\007\002\002\002\b\002\t\002\007\005\002\005\002\005\002\005\016\020\214\371\233\377\006\002\021\307\276\344\257\003"
+	.string	"\022\330\370\241\354\t"
+	.string	"\023\222\252\354\340\007"
+	.string	"\024\025\266\310\363\237\013\n\n\026\027\327\316\273\360\002\004\030\031\240\342\234\212\n"
+	.string	"\025"
+	.string	"8E\220\n@\023\266\340{\371\340%\224U*\030*\323\250\206\001\230#\270\2211:\311\260"
+	.ascii	"\227\345\234B\355j\305\020d\301y\233k\020\31554\340\006"
+	.text
+	.section	.gnu.lto_.ipa_sra.8e058af6d61b2dc,"e",@progbits
+	.string	"(\265/\375 \224\375\002"
+	.string	"\242\304\r\026\220)i\f\363\273\273\273\273;\230\361\037\341\245\337\300\267Hn\231\002\347\322\224X\021{X\303T\330\004\371APCw`|(V\"\247\214$80\001t\346N.\002\020"
+	.ascii	" j\321\310O\210Q\3640\025\214\017e\344\305\0204\206S\300\345"
+	.ascii	"\326Ms1\315\275X\333i-g\345\006\332"
+	.text
+	.section	.gnu.lto_.inline.8e058af6d61b2dc,"e",@progbits
+	.string	"(\265/\375`\023\002e\t"
+	.string	"\222\215/3`m\322\030\344+\fZ\333\331\241\032\206\314&-\364\300\f!\237\002c?8\007\250"
+	.string	"\004\037M\275\202\025\025\004xA>\306\320J\351M\b\241m\226H\271S\207J\016\240\207%HD'{\017`)\001Z0\311`j\361P!\262,\220\t\300\\24F#n\313?\214\356\307T$\027\033\037\005#\321\211\207\340\267v\204<8\250\255\204\335Ux\215^\265\247\007)B\372x\020\022\202\201\204\361\246\206Q9\324n\030\2071\333\255\362"
+	.string	"\323T\322P\232\270\246\274\374\266\321\352\351\337jWn2\333]+\277q2\243\350|\256s\030\333\377\364?OM\345\rrw7\363\033\246!\273\353\376\262\272. \220\"\t\312\360\006\320\002\344\032\330sU\001BSp \017H\346H\212$\344|\217\205\375{\310{\330\277`\211"
+	.ascii	"/q\257\\h\265u\362\360\332\324\201\361V6\352Z\216\007\003\032"
+	.ascii	"qy\207y1\302\202\344\315\3719\324+\352\b\327T\300\".\330\025"
+	.ascii	"\343c_M\003y\201\357\270\032\006c\251f\021\3162\\H\361A\356("
+	.ascii	"\256\033"
+	.text
+	.section	.gnu.lto_.jmpfuncs.8e058af6d61b2dc,"e",@progbits
+	.string	"(\265/\375`\334"
+	.string	"5\006"
+	.string	"\"J\035%\220'I\007\377\377\230\366l\373\377\377AFc\303\202\337\335\311\2018>.\"d\3667n\337\217~\377meJ\001j\f-I@\320\0035XL\177\241\n\265\340\341\355Fy\243\366\266\027j.\347\234\263\302S\2071\230\025MTD\007>3\352\031\265\027\001\315\276\206J\331\264\221_\200\237\211\240\364\206\232\216\035\033Q#\200d&\361\244\031=\234\036\353T\205C\004\037"
+	.string	"w\030\005\354u\377-\204i\020`\243<"
+	.string	"Hz\367E \305.Q\"\177\026@\206\033\212\333\t\037\003\314\\L\252\242\301\336.\b\002\b<S&\222:\013C\200\nK\374\225\314."
+	.ascii	"\232Q\003\037\203\252\215<\021\241)\227\230\002\024\300\r"
+	.text
+	.section	.gnu.lto_.pureconst.8e058af6d61b2dc,"e",@progbits
+	.string	"(\265/\375 8\301\001"
+	.string	"4"
+	.string	""
+	.string	""
+	.string	"\021"
+	.ascii	"\230\004\002\230\004\004\205\004\005\230\004\006\230\004\007"
+	.ascii	"\230\004\b\271\004\t\200\004\n\230\004\f\231\004\020\230\004"
+	.ascii	"\021\200\004\022\200\004\023\200\004\024\200\004\025\230\004"
+	.ascii	"\027\204\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.8e058af6d61b2dc,"e",@progbits
+	.string	"(\265/\375`\006"
+	.string	"5\004"
+	.string	"R\004\020\034\2405\351\377\271\252\243UG\325\005UY"
+	.string	""
+	.string	"\f&M\2725[[F\266\021\"\223\f,\003h\013j\263\353\274\325\017c\225\263\236c\322\211\222\312\303I\bV'\222\232\321\252S\265\375t\026\f\004\036"
+	.string	"`\310PC\300\303A\234\n\365\211\0300\334\031\023\263\324\335O\b$\236\002qA\340\2307\200a\256Z\301\n\360\007+\353\302\024\234"
+	.ascii	"\204\033\204A\203\203\034u\254&]J0\230'v6\200\305\033\300\002"
+	.text
+	.section	.gnu.lto_.lto.8e058af6d61b2dc,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_blackboxOpen.38.8e058af6d61b2dc,"e",@progbits
+	.string	"(\265/\375`\227"
+	.string	"\305\n"
+	.string	"\246SKC\020\311*\0358Ps\370q\004\354\234\314\272\364\342\304\0160\001\206\225\0206jRa\343\300\260\\\013\\\3260\276\262\325\240\006\325\344i\233\273\252\243\245n\212\017"
+	.string	" \351\200\224(}Q\326r[\t\331{\247\0247"
+	.string	"8"
+	.string	"6"
+	.string	"4\024\002\022v\267\2431\017_\351\f\375\307\316 \216\252W\227\323*\321@A"
+	.string	"\207\221U9/0\005\036\373T\031Ws.|v\327S\034[\356\355\266/lg\330\236\020\207\335\225\363\234D,\330e\251P\333r3"
+	.string	"\340\260\337\376c\326\370\002> <,\365Y\245` \250A\330%'\276\331\223\371f\362\020\334\267\314\037\270o\016\355\007\233VC\340\274h\022\205\2225G\006+\t(}9\305UzY\004\231\003\326\244y\233\277\b\367\275\017p6I\311\274X\351\234\315\312\026U\331\244j\322\227\375\272\273k\352\262\003\250\317\3338\201\032#\023E\305\210\364\201:\300\215E\035\257\3041\342\205<D\240\217Pg*\201@:\321\007v\035\216\275\023\351\353P\236\367u\032r_\227\272,\306\322\204\256jfVj\207\004\017"
+	.ascii	"8\263\002K\275\231\320\0014p\327[b\330\253h[@\270S8\3402\227"
+	.ascii	"\321]]\006\260e\\\342\251\232\234\242\251="
+	.text
+	.section	.gnu.lto_blackboxWrite.39.8e058af6d61b2dc,"e",@progbits
+	.string	"(\265/\375`7"
+	.string	"M\b"
+	.string	"6\220:6P\215\322\001gV\0014\310(-\221t\347\3062P\231\333\342\345\250{,O\032\370\006\273\3610A\345\243\r\211\313Lk.\347\031[\273K\027\321\355\227}B\244L)("
+	.string	"*"
+	.string	"*"
+	.string	"\307\334\331(\217\035{\221\3174\302\332]\250\034\357\236\235\177\220c\276\023\351\t\200\260\273\316\357tq\353m\023\330>\260\255\n(\373\251\377\322tf\372\026Nd\245\004\234\354Z\264Tv\205\251>l?c;\323\336p\272\247(\254\273\032\251\222\335X`\203K\366C(\377Y\240BI\366C\036'|\017\213F\371\357\230?\262\034K\305`\\z\335d\220\230V\274l\331\261\224\272a\377Z\r\036\021(\213\300\254i\266\217\202\304\326Y\3202P\0076|2\006\250q!\250\031\360\346\340\341 \304\266q0\023\275_\253\250\004\223\225\247%_\362\232\032\n"
+	.ascii	"`\2517\023\332\372\201\253e\016\202i\227k\270\005&<\225\032\007"
+	.ascii	"\356\334\242\235O"
+	.text
+	.section	.gnu.lto_blackboxWriteBuf.40.8e058af6d61b2dc,"e",@progbits
+	.string	"(\265/\375`n"
+	.string	"\215\t"
+	.string	"\006\223C90\257\322\001$\3110PRG\034x\342\272\206GkIY\250\327\301\304d)\266\332\032.~\275\217\231\367\316z\375Q\nJl\350e\017\002\\\373]=\005\025\361\204l\271S\n/"
+	.string	"4"
+	.string	"0"
+	.string	"\036?\320\235\363.\320\235sh\267|\374\330\313^\0273\333\356~\352\361\3602\364/;Fl\251.\001\022v\327Rli\334z\333\006\266;\366g.\004'\273\030\267\227\255q)/\333\317\330\226\343K\302\307\254b\314.\307\nmw7F\360\316i\346\245\375\221\223\204\207U<`\327\205B\333\0357>\360\316\005\362\2425\026\252\262?\273\t\205\017bTJ^Lu\347\256\332b\021\331X\311\233=\262\244v\330\237\273\273V\227\375\330?\017\373U\245\337u2l\001\016\247\006Rh\3241\240>j\020\007\024-L\200\237\007\220g\364\371H\"\017\304\007*\231>N\201\301\210P\351;\201`\351\313\214\253\317U\227\025Bj+e\331\223SU\257\266\204)\f"
+	.ascii	"`\251'\023\032\201\006&\036\305\300\004;\256\261\3070/\020\030"
+	.ascii	"\\\221\246\246\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_blackboxWriteString.41.8e058af6d61b2dc,"e",@progbits
+	.string	"(\265/\375`\230\001-\020"
+	.string	"\246\336lF\360\320&\035\372\305}3l^F\026\355?\231\320\2572\306O\316\340\320\331\337\365\3309p`A\233\360v\324\3724\365\330l\004\276\001\367A-]4]\234\350\266\232\356Q\304\361\262p\013R>[\333\222A\366\2262\245W"
+	.string	"Y"
+	.string	"V"
+	.string	"\016\267\337|\304\312\366\211!\f\274L\013\227\330\2159'\367\361\001\332e\274"
+	.string	"\355r;8\352\3522\256\256\374R\r\320\007\262.c\207\353\305\203\007\350\212\245 Y\317c\327\027\350i\004\021\363}\354\021\007\026\343\003c\256\035\r\346\234\326\017\314pk\267=\3016\003\3733\002\017\377\220\246\251\245T\307\250\336U\353s\356\003\200\360s\243\006\001\2409_f8\346\217\354\371\360\234_g\345\227x\314#_\307>\033\013f3!\343B6\347T\220\303\362\331\002\023zy/ds\206\007.\235`\273T\3738'\261zx\341\001\346\234I\261b\316\020\201C\266\313>\n\324i\263\361Y4\0030^\033\342\234s\306\245\261\035rmI\373"
+	.string	"f\243%\204\2473\217Tw\3276A\321\177\376p-\313\376\316OT\360m\334\255\350\277K\177eC\032\342\352.\200\001\271\344h\351lwX\270\300]\032;\364\264\004\013\222ygl\322unQ\024T\247\024\222\023-\325\251l\3526\201t%\022,t#&&\221\223\021.\245D\004\2053\241R\034H\001w*$(N\325u(n\024\266\036\243\266\027\255\307w\363\323Z\317rE\253\261\320~\345F\250Q\321\"\302\323\231\\\032\237\003\017\215%\255\212\007GC\253\355\313>iq\035\310\300\240A\016  `\002\221\222\214\007\240\352y\007\3361=\3549\326@\233a\205\206j|\210U\274\320\203\r\024\200\223\371P\270\006\205\216\336&*9\342\360\304\242\260\206EH8\340\253\036\2044"
+	.ascii	"\023\265\240\303\275Kt\340\243\3531LJ\204\003!b\272\360\023"
+	.text
+	.section	.gnu.lto_blackboxDeviceFlush.42.8e058af6d61b2dc,"e",@progbits
+	.string	"(\265/\375 \310U\005"
+	.string	"B\211#-pU\323\001"
+	.string	"\215\337\301\241\025\260\343\253p\301\306\277\3061\342 An\372j2\337\017t\273\241\377\177\245\213\231t\004 \b\221E{\247\024\246S\265\030\225Z9(\365\250f\304\242 \223^\2239\031\\%\215kRj\275\246\344e\227]!\223\232\355iQj\354\007Vvv\\\200\241\b1\332\305\004"
+	.string	",("
+	.string	"yl_2f\207\356q\366_\347\362\205\273;\345\346\330#\346\377s\302\306Y\036\007\212\335u\334\270\314-o\373`;a\333\n\t"
+	.ascii	"`\25173\340\234\031\002\276\3345<-\204\3612\004\270t\213v>\001"
+	.text
+	.section	.gnu.lto_blackboxDeviceFlushForce.43.8e058af6d61b2dc,"e",@progbits
+	.string	"(\265/\375`\212"
+	.string	"=\n"
+	.string	"v\323F:0\257\322\001\300\262\214\312~\237F*\337\332\"\345\325\t\232|v\360\034\316XR\360\377?VPR}\203\206\374\001\3523\"D\326PK7\267'\021\013L\334"
+	.string	"E\215l)e\n6"
+	.string	"3"
+	.string	"7"
+	.string	"\242\2261\227\302VZ'\270\356\022d\021\025u\362\212W\016\231\3229\240<\001r-\226\217\\\315\005\r\334G"
+	.string	"\311\332\325x\272\373;\222\035zO\377;\374O\370U \327SF\275e\225\351\316<t 3\232jw\177\271Z\206\375:\233_\377\367\363{\336\375jH%\356\005\001\246\333\265\323\265\315S!\371\217\372\277+0\240\036\377(\\\035\231\231S.\233Xst\367\301W\263\2456\346\267\032-\204\031\306Z\220Y&0iam\356?IKL\233nV\303u\246\264\213\353\210z\3078\255\216\352\005\017uB\021DF\b\222\b}&@ \205\3503\002C%\023\3301xX\021Q\002-\302\260\004~\245J\371u\225\351\303mDI\331\253\23093O\336\370?\371\036\025\257&g\003\017"
+	.ascii	"`\325{B\300z:\236a\366\322\252\025_@\311\260V\321\"\2410\"\272"
+	.ascii	"\206\263\217x`\b2\356\\K\323oa\226\001"
+	.text
+	.section	.gnu.lto_blackboxDeviceOpen.44.8e058af6d61b2dc,"e",@progbits
+	.string	"(\265/\375`\307\005\275&"
+	.string	":G\244\017G\200\234Q:_6\003Ua\265Y\201=\033\252XK\367D\327N\tA\343\t\366l\361\301\021\321\274\324\203?\002\325\035\002\356\336y.\022\177\272\016c\245\300\356\027\305\005'\236\203\271{\022V\366\266g3\3226!r'\031\351"
+	.string	"\323"
+	.string	"\345"
+	.string	"G\362\247<\214\351Th|\005\016mR[\304\020F\364\273+\245F\320G\006\364\347\301\016\205\351\306%\264i\210fIr\231\255\253\361\301O\236\200\376D\360\001\367\247\371\335\275\301\234\376<3\023s\312\024,0\261z#\227\216o\361\b\206\341YW#\257\267\256^\227\303\2457\033Z\273\247\331V\3457]\027\240\013\212N\226\024\361\271*F\334\355\351\nH\246\314\222\262z\332\303Dp{\232a\225\330\023\034\031ZY[M\003\362&\027(m\236(\263\244\256\216\036\031R\231\b\326u}\232!\017[\333\361k: \222M\351\242\200\346"
+	.ascii	"4Zp\202\366\274\217x\323\204@%VF\027\365d\356\222J\264\216\274"
+	.ascii	"\205\212r\262m\342\362\004\327\244Q?\263\302\023\036+]\224\223"
+	.ascii	"\2655\r\353\272\262\025FI\235\001\234\371'3#1\237\036\002MH\344"
+	.ascii	"\220\310\331\305\267\227\327\234.\346i\334]\007]\005\021`\277"
+	.ascii	"\036\305eN\241\302^\270\353#\377\"9\276\312\234\272I\016\312"
+	.ascii	"\265\016\327um\240\363*k\262i\234\324\002\206\325]\344>\320}"
+	.ascii	"\373\034\3358\331<\314\274\342X\204\320uu\272\300\267\362+C|"
+	.ascii	"!?\231\350\205\275\360'\377\305\375\371\276\223\333/+8\304/0"
+	.ascii	"\237]2\033\177\266\213\3147\327\006\302\314\226\201R\313?\250"
+	.ascii	"\345\002\227r\3669\225\363\216-\353n<\347\256e\\j9E-\337P\313"
+	.ascii	"6\3242z\263\\\263Y\276\250\345\363Z6k\226\373Z\376\001\006z\210"
+	.ascii	"V[U\2354\256:\226z\326\262\223K\221\033\177)?\2257\363\371_\027"
+	.ascii	"\273\361*|\344C\017\361\311\272\256\177\302\217\362c\266.\032"
+	.ascii	"\377\341\362\341<\316\207-\265\253\353\376\314\035\367x\241\371"
+	.ascii	"\354R)\315Li\326d\323\026\250\251\262\003\355\"/\001/\177\351"
+	.ascii	"\036\355\216\234\323~\351\346\032*\350\026\370\225\001\260\\"
+	.ascii	".\321\036t}\272@\263\005\022\177v\311\265\346\2579\233\030j\020"
+	.ascii	"u\210:\344\376\354/\302\263 \233k{\325\310=\233w\276\212\344"
+	.ascii	"~\313o3\253I\324%\366\302Z\233k\225\312\344gT'\007\270.\264\271"
+	.ascii	"];\262Q\326\272\310\273\372\345\270\r\204u8\326\253_\367\354"
+	.ascii	"g1\211\223\251_\030\370cNF\205bn\340p9\334\237g\327\264\310\224"
+	.ascii	"\\\314\366\351.\023\334\303\035.\346\303\005~\227\023 \320u]"
+	.ascii	"\315\266\325\t\243\004\353\346\1779\230\020|!,b\304\b,\3023\002"
+	.ascii	"\366[\276k\346\022&\354\205\335V\210\2352\245\331S\007\fC\302"
+	.ascii	"\f\030JBF\274\243\236\221Qo\310\300\213\"\027G=\0167\033D-\216"
+	.ascii	"@\020)\t\221hAC\210En\306Q\257H\ti\204RR\017)\345!\t\275\242"
+	.ascii	"\0256z,b\f\t\311`\301;*\0222\342\r%\315\340IP\300=$\242$\236"
+	.ascii	"R\257\227\304K}7\327\006\302\001\272\240\202c\271\020\311 \310"
+	.ascii	"1\223\257^]C5k\360\365O\327\305\307\270\265\006j0\025vL\"\275"
+	.ascii	"\374r]\344\022`\322\264K(\271\261\361\374\345^\3546\254.\303"
+	.ascii	"7c6\b\377i(f\\\337\271\360\354\247q\021\216\313c\022\211K\223"
+	.ascii	"Xk\322\240{k\240\2517G3N6\017\201,Q\220\267.\362\203\247}\261"
+	.ascii	"[\252\251\262\252:j\334\334:\355k'\270\307\207f\353[\377\204"
+	.ascii	"\001\233\374\256\376\270h\333\372\300#\277\323\371\231\372CK"
+	.ascii	"-\026\333\002\222\245\222\312g\227Xk\003\335XZYf\250Q\034$\021"
+	.ascii	"Q\210934\"\305\211\306@\002B\0202\274\003\021\240=DU\223,k\213"
+	.ascii	"\322\264\212\004R\352\003\211\267q\325\343\215`#\357>\320\273"
+	.ascii	"\275\333\022+Y\371\017\f\303V\0248Io\006\020\320\005d\216 \213"
+	.ascii	"*;f\262\253_K\200\006\267\003t\003#\253\362&\234\242wL=E\033"
+	.ascii	"\335\334Xa~\327\t\254Dz\r\342f\bp:\0054I6\2574\331\343\360\304"
+	.ascii	"=%\363\300x\232\275\"\024\316\320\017C\035h\216\320X{\211\355"
+	.ascii	"\n\004\225\222\357*d\344d\033>JQ\036\225\242\243\217\311XaK\330"
+	.ascii	"\364\212\231]\365F\314!\312\314\242\017\244V\360J\\8\214]7C\223"
+	.ascii	"\247\231\306\235\225\006\326\365\36261f(/\241A\0208\236(5\335"
+	.ascii	"/%\215b\253Z\032\331\231L,\314$\211\207\021D\234\372\260\315"
+	.ascii	"\253\002"
+	.text
+	.section	.gnu.lto_blackboxDeviceClose.45.8e058af6d61b2dc,"e",@progbits
+	.string	"(\265/\375`\212"
+	.string	"\345\t"
+	.string	"\026\222C: \261\322\001x\224\002^\027\002I\240Bx%\036S))\205\332B\254\363\300\023\327\336~\2621r\301hf\231\360\037\n\t\001p\004\034hWY\036\001\361\001\236\253%D\356\224\0022"
+	.string	"1"
+	.string	"2"
+	.string	",\345\356\202:\362\324=\235)\377(\357\214\244x\217\340\352\005\344Z/\036r\345!p\224!\002$kN"
+	.string	"\206\335\365\034I\220\373\273\355\005\333\007\366\007\002>j\363\357\252 K\021\231\321Tsg\327VSa\366\275\325\227\375\351\177?\331\022\347@\263\353\261\253\331\333\347Bb\373\036\247l\231\327b\373\226\216V\363\243UENl?v\027\364)\271\211Sg\030\033\315\245\n\263\276`s\375\254\304\260f\316\366\351*\030\234]V\202?;-\303\227\375\363\006j~\374\027&\205\302\322\203F8\212 \211$F EI4\001\222L'0d\340\260\002\302\004^\204\241\t\364\324T\367V_n\300\335T\272r-\350&\266rF\234:\2573\355\320\"\020"
+	.ascii	"`\2517\023\272\202b\2548([\221\037\314\262Y\333g\262\250\242"
+	.ascii	" \034\340\302qMt\017!\277\f!.]\314v\336\302,\003"
+	.text
+	.section	.gnu.lto_blackboxDeviceBeginLog.46.8e058af6d61b2dc,"e",@progbits
+	.string	"(\265/\375 \317\335\005"
+	.string	"\004\nl"
+	.string	""
+	.string	""
+	.string	"0"
+	.string	""
+	.string	""
+	.string	"'"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\312\347\343\336\367#\001\273\001\001"
+	.string	"\177\002\001\177\001\247\003/\300\200\200\370\305\207\255\257\001\217\250\300\001\177"
+	.string	"}52"
+	.string	"\013"
+	.string	""
+	.string	"}"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\367z\361\370\200\371\001\002"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\203\300"
+	.string	""
+	.string	"\203\003\202 \006\177\001"
+	.string	"\244\003\001\202\300\013/root/repo"
+	.string	"\"./src/main/blackbox_io.c"
+	.string	"\t"
+	.ascii	"`\325\263B\300<\207h\025\274kx^\304`B\344p\347^\355|\002"
+	.text
+	.section	.gnu.lto_blackboxDeviceEndLog.47.8e058af6d61b2dc,"e",@progbits
+	.string	"(\265/\375 \363\275\006"
+	.string	"B\314.4Po\322\030 t\007\303P\305K\362\301\361\231\346N\257\316\252\311\037<\324\276\355 \255\001\\\324\tv\b\236YF]\212`\2772j<\243\032\017k\322\366\226)\020\320\241cQ\036N\024\270\322@\353\301\002n\"*Jb\363:\0265\361\252X\3614\005C\nN|\036\b\343\313\314\217:\321*1\004\037\007\372\tj\256\343\365\262N\364\r\203md*\027\311n\250\324\262'\323\310\350\277>\363\267\246$9\240+\031\251dw\"\234\020\240\323\277\302\302\265\324\371\021\322\221IFH\266;\237\363P\251M\256\n\242\006,%\224\024\021\354B\033@\303\356\33640\016\335\351\177\3603\374\030\001\t"
+	.ascii	"`\325\213C\300<\207h\025\274kxx\3040CH\341y\373\325N2"
+	.text
+	.section	.gnu.lto_isBlackboxDeviceFull.48.8e058af6d61b2dc,"e",@progbits
+	.string	"(\265/\375 \307m\005"
+	.string	"\202\211$.pe\322\001"
+	.string	"]E\254\377\376\3173\336s\246\"$\240O\006\264o\267\366\303\276\230\206[!\031\372\257\317{Q\323\266\013>Y \264\245L\001\307\254\2315*S>\260K\2231\222]\220\210m\223h!>%\216-R\346\334bU/K\007\f\273\277v\f?\377\006\272\273\017=?K\223\307\3716\203\352\366\002"
+	.string	"\372$(\211\376s\177u\305\202;\335\032\362\f\243\r\206\224\352\256\021\202\226.\323o\341\263,\023\030\335}\326|\235=\334\377\207\377\211\377Z\t"
+	.ascii	"`\251'3 \0306*lV\341\3305\217\bA\302\235\273mq\002"
+	.text
+	.section	.gnu.lto_blackboxGetLogNumber.49.8e058af6d61b2dc,"e",@progbits
+	.string	"(\265/\375 \334\035\006"
+	.string	"\322\n*3pK\323\001\220\225\353\002\300J|\360J\202(\251\324\337fL\371hB\\E\306\212L\377\002\006\321\252\3050\2336\317\356\004\306\354`;\030z\326\215\354\235R\266\246y\t,\314\212\300\242\n*ypQ\006\322\302\022\344T\361D\030\300\244\302\234\230\204\276\275\364DZ\334\354/\203Q\302~\263\273\353\030aC\211\247Q\337m\354>\204\200l\207\303\341\331\2466\344[\374\202Z\nh\320*\206\242\302!\343c\367\223\321)\317\235\346\223\347N\2348=\244\3761\016\260u\036\\\315\016#\231\3355\344*\304\035o\333b\373b\233!\t"
+	.ascii	"`\251'3 \030>*lV\001\3255/\013A\206\273bj'\031"
+	.text
+	.section	.gnu.lto_blackboxReplenishHeaderBudget.50.8e058af6d61b2dc,"e",@progbits
+	.string	"(\265/\375`\013\002\245\022"
+	.string	"\306$\200I\320\360(\035^\252)\007\211\030\203-\001\373>L\206\004\212F;\262J'\325\205\204y\"\2329\204\263`\341\237\026\327u\b\021)\025\037\265U\025:\220\233\005\310\255\254\227qU\0231\226\001"
+	.string	"\352\220m\343\260\215l\"eJ\001j"
+	.string	"a"
+	.string	"m"
+	.string	"\227\377\215E\277\3466\263\353P>]\346=$\345X\314\230sz\\\032\004u\331\361\001\341%x\001\341\245gv\214\357d&G\316\307\226\2634\347dm\211\317\016\256\316|\3055\215\276\236[\312\301\337\034\244\301!\361|=7\020_0\305d;\022o#\230\240\303\222\210\325\255\246zj0\347\264\256\334\\ny\333\016l3\260UC+\227\376Ix\371=\t\351\364^lt4\375\331\273Q7\306>8\347\234^\030[\252WR\255:\316\235\022\257\273OR\035J\265T5\b\252w\325\252\352\007\340h\032\215T\344~\326\267\233-?\032\263'\207N\034\347\327]\355\333O\341\363pL\004N\236I\013\361\301k\341\251YZ\200\272\264\277\263\305\273\201\003W\356m5\016\364 \t\023Z\255=\357\262Hh\347\350\305\006\007n\314\212\253E\266\032"
+	.ascii	"T\327v"
+	.string	"\275\364+\273\035\265M\261\277\342>\034\374\031W\200\301\302K\335\b8$\0248\232\376P2\363\303\234\023\201\213\246\227\242M\366\005\351H\354\306x_ \374\022\340\301\250)\223m\222\357\224\240\346\254)\360s\256\023\363g.\215\341D\037#-}\271DL\036\274^2\n\033v}\304`\255\r\261\021\022\227\210\205\021\326\005\230H\t\313%;a}\030p\314\344%ce\210\305d,qG;8\027\306 2l;\352\361\317\344^\330\200V\334\323\262\240\214\224z\264\035\275Z\027\277\371G\230\320y\023\205\252]\355w?\300\242\224\332\323\252\026\345G%i\324\237\303\225\233Z\022\"\225\227q\350-P \204\204\204\227a  `\2021\223r\036`\365\214\b\215Q\242\225,\320\340FqA}[\305q\320\371\205[\234G\263\214\270\242\t\210!Y\346ZT\347\271\366\330^\007']V\2024%\351\261\300\330\223q\362"
+	.ascii	"\202Hw\352k\252o#r[D3\213\255+\022\016\024"
+	.text
+	.section	.gnu.lto_blackboxDeviceReserveBufferSpace.51.8e058af6d61b2dc,"e",@progbits
+	.string	"(\265/\375`)\001\035\016"
+	.string	"&\033bE\360\222(\035P\247\352~4\344p\t\340w}\002\310\374\202\003\362\204f\033^\237\240FQ\314\316\326\211\377\266W\024\254\037\347!\001\037\364(\253\031\3419Lxa\366Xx\307\273\177\356\337\222\216\332\242\275\267\224)\005N"
+	.string	"J"
+	.string	"Q"
+	.ascii	"$^\031r~\354\3166\222\203\342\341;\201x\250!~:|\232'\037@\207"
+	.ascii	":\004\375=\0030\r7>\335\352\221\324\360\341r\306t\254\324\247"
+	.ascii	"\340\245C\023\240S=\020\315&\307eO\230\216"
+	.string	"\225)r\262\273\316V\307\341\216\267\375\300\266\211\375\231\257\0245\251\254\3313U*\314\376[\005a?\366G\230~N\353K\247\246/\222\302C&\246\273\253\266+S\023\262;P\306\b\333.\366\307v\346c-o\300\256lj`\354\356\0023\360\034\332\366O\034\205\213O\016X\251\231\006\001\t\"\350\354\240r\310a\035h4\236\276@L\035\301\301\341\224\267 yvW&>\213\347\250\3707\207^\341\270x\230\212\3015\003H,c\364\240}P\2059\3525\204cc\225A\354\253\370\212\026\377\306\025L\371\326\241o\212\207\327\313\216`\207\013\017\001\246\021\313\205\020\264\250\204#A\260\300\205TD(\022B\333\004\022\312\312&*\231\266\222\003\346(\214J\033\013\307\225\266\317,\365\367\236\216\274\230x\241\371S\274\354\247y)\361J\377\024Ua\324')UA\001\031\325\026\215\362\255\247OQ:<\"v\303\356\006\025"
+	.ascii	"`\325\333B@\030V\303F\256\"@\246Y\201\253^|\001n\203\025\032"
+	.ascii	"\204\302I\234\0208\210<\215 Y$\023\266k\342\231\026\232d\202"
+	.ascii	"$~flizTA\235\001"
+	.text
+	.section	.gnu.lto_blackboxDeviceFlushForce.part.0.71.8e058af6d61b2dc,"e",@progbits
+	.string	"(\265/\375`\374"
+	.string	"\375\013"
+	.string	"\346UO@\020Q\225\016\274\200\224\323f\223\001\250Q\t\303\243C\004\201\371\340\2061\240\374C\247\036mO\356\177\016\245\023\017E\344[&\023 \217"
+	.string	""
+	.string	"[\200bt\024\347\216\322\215\376\355IEc\333D\312\224\002;"
+	.string	"B"
+	.string	";"
+	.string	"$l\271x*\333\266\\F&=t\245\336zAA\205l7\344\036\325\303I\327\324H~\242V\245\353\301\013\370b&\031\257U\206'\345\032\007fw-\321p\307\3336`\373\200}N\027:8\354\246f6\266C\204\205@\3419\2041U\230\240\275@\314(!\333SX \374\t\221C \241\013\003\002\0211`\016\377\021y\224\334#\362[t\023VX\r\331\356n\367A\317\336\354\221\275=>\n\340\244%\373+\316\"\202\377\301\017@y\324\243\017\322\370\305Fl\370r\226\302\266GC\342Z\325\356\022x<\370I\013\0270Jy#\265e\325\256\255\262l\247\325\351\214\351G\006\004VP\t\361\246\322u\022H\3504\0136\031\006\032\256A'\343\3416\037\020W\t\340\316\001\347\303A\350\272\017\267][e\371\340)\231\252j\301\266\2521\237\232T[\266'y\265=]\036\225\001\031"
+	.ascii	"F1\003V\275\234\305\230\267\241\321\016*?\0139\207\3605\315\360"
+	.ascii	"\bm\3462@\024\fs\205\233h\"\377\f\221\347\226\005\233\372\320"
+	.ascii	"\223\216\267\016\347\252\232x\251\323\276\244\246\250y\377\265"
+	.ascii	"e\f"
+	.text
+	.section	.gnu.lto_blackboxDeviceClose.part.0.74.8e058af6d61b2dc,"e",@progbits
+	.string	"(\265/\375`\236\001\325\016"
+	.string	"\266\331^E\340\224(\035\244(F+\334\350d\201\001\016\335\266\240\346\222\315\220\t&\213\031F\026q;[c\244B\370G\365\265\212\236+\203g\276\224^7B\b\\\031\3171\206\034\365\212#N\230E\270\356\306D\220\275\245L)G"
+	.string	"L"
+	.string	"J"
+	.string	"-l\233@\370d\013\271G\263\267\341\001f\306\267\273\333\243\226\370\351P3\236\374\273\036\240[\241\016\263[\211\270B\006/\037\t\222\225\n\016\320\201\351q\327\263\303*\225i\340\021"
+	.ascii	"\312\356Z\213\271\263\333v`\373\201\375\234-;\246\023\246\257"
+	.ascii	"\235\254  \263\373a\307\310\262\"\f\005\f\223YPR\034^\340\r\035"
+	.ascii	"@\\|\253\362N\274\277h1\013\002\217&\004\004\025<`\337\256\267"
+	.ascii	"=\332{I\366\250\375@\366x\373ny\215\365\306\306s\337e\262=\236"
+	.ascii	"\307\007\366_\307!\2320\032e\217\251\rN\264d\\_\311jD\037\257"
+	.ascii	"/G@^m\025.\337Y\201JQ\366i\334f\3057\341\f\245|\367\350\227T"
+	.ascii	"c^,F\270\344\216\f\333&\023\315\344\261$\305\026\031\202\312"
+	.ascii	"#\2513\326x\270\032\246\360I\340\320\207\033I\330\300\245T\b"
+	.ascii	"\201,\244l\027F \225-D*m\237\005\3460\210H\233\006\216#m\036"
+	.ascii	"\270\332r\004\"1\027M\301X\254\304\331\021\203\005\322\006\205"
+	.ascii	"\362\235Ipnb)EY\357\0379jX\2523\316\213\262TR\214 \252\324\t"
+	.ascii	"( p\202\031\263\363\346\230\001\257g\377\303\375\3310e\225u\343"
+	.ascii	"\030#\302f$n\274\210\023\207\202\031p\365\354)f\036\\\007\326"
+	.ascii	"\265\260\227\313N{\323\332\306\307I\273\031\2201G\036\214\360"
+	.ascii	"c\034%\3067D\376\226\027u\t\260dY\2346@[\312\212\201P{3\342\320"
+	.ascii	"j\334\273\360\030"
+	.text
+	.section	.gnu.lto_blackboxDeviceReserveBufferSpace.part.0.79.8e058af6d61b2dc,"e",@progbits
+	.string	"(\265/\375`\354\001\215\021"
+	.string	"\366`tG\300\226M:\3444\265\364\340\235\362\200\306\026\231\320\200\037[c^\377\333v{g~\201\240\260\020\224\216C\016B{\352\223b\254\346|\255\346z\273o\3224\261\215\242X\335\276\0236\251\354s\003\025\230#ido)S\na"
+	.string	"b"
+	.string	"Y"
+	.string	"3\370\335\274\037\333>\214\037\325xV!\347f\004\205\"\241\035%\250\335o\365\270\362\002\334#<\001\356Q[|\366\b5\271\231\237<\236\315#\206\232\023\316\021\034^\211C\b\301\007\210\r"
+	.ascii	"\023\026AT\036-5\200\227\003Wv\367H\317\036\017's\300\271T\313"
+	.ascii	"\356\2723q\247n\233e\373\202\235\n\002\251tr\351\247`Q\224\212"
+	.ascii	"\320\256\210(N6E\364\341\242\206\3142p\203\276\033\220J\221\332"
+	.ascii	"\222#\250\245}\f\224Nc\3062\007\276\033\220\205\027C\234\374"
+	.ascii	"u\267\357\231'yB\355\007\324\356\252\356#\311l\225]c\253\254"
+	.ascii	"\371O\366\255\367c\315\317\240\201\002\226\266\"\210\307\356"
+	.ascii	":x\364\203\356\321~\f\231\003\372\334]\033U\233m\027\227\nKB"
+	.ascii	"B\313(\333\255\357pu\273\033\301g\n\241\301'\212q\217\251)2\236"
+	.ascii	"\343:b>\221_`\362<\217>\214\302jMM\202n2\312\r\333\262\247\356"
+	.ascii	"\266?\273\273\340\361H\377\315H\223\020\233|\222j\263r\207\253"
+	.ascii	"CvJ:\376\373a\227\326\336\300\202 \346\212\241aE\267X^/\031@"
+	.ascii	"\274X0-\027\016\254\225\207\027\227\016\253\026,\266bI\340\327"
+	.ascii	"\007\027l\025\363z\301V*\333y\270:d\003:FL0?\343R\337\343$t\214"
+	.ascii	"\236\362\237qQ{lGu\313\215\342Xc\003\037%(l\254\252\260^\302"
+	.ascii	"\322\211$PmPU\223HRS\252*\267\264\003%' `\002!\347\350\034\354"
+	.ascii	"\354\237\252\3363\305B\2740\322\214\360s\301\216\3137&\267_+"
+	.ascii	"\353\304\213/\225\300dH?\341K\230\261\b\206\334F\242\036f\034"
+	.ascii	".\030\n\035\016\321\277\020\363\2462p\210\2601]\336\266g\213"
+	.ascii	"\354\222u\215l\3358%\022/lG\003k\256VMv\003O\300x"
+	.text
+	.section	.gnu.lto_.symbol_nodes.8e058af6d61b2dc,"e",@progbits
+	.string	"(\265/\375`\272\002\245\013"
+	.string	"\226\020@:0\315\244\003\020GL\310\r\337\252\271\n\tM[~&\206|\205\016\374\301\220\304\277\310\210\364\244\240\300XnZ"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\340(\244\340\027\037\2764\333\270\221\224R\006-"
+	.string	"2"
+	.string	"0"
+	.ascii	"\"\360\241\314A,\316\214\357\037\306\\C"
+	.string	".\236\204\353\007\267\352\336&B(UU3E\361\206\241zU\020\334V\346\234\363\340:\262\252\366E\253\313V5 S\237D\235\305\352p\352H\323W\245\253HO\215\216\022\375\304\241\233\030\264 ?\034\351\251\311\360%\356\300$\347\244\315G\261\212\024\024\315\003%\020#\237\3540#/\334k\262z\"\242!\201\341\266i\327\256\034\264\317f\247\311\256\020{\f\366\327\356\365\226\353\256\326u\203u\206\235s\252\202\273\272\035\273\024\021$\272\212A\357DX\300\004m\331x\275\036\253\343\210\263\340x\275\267\216\327+\252@\333\266G\335C\016\f\350\006\215\005\004h\333r.4 \320\002\031*\242\007\030\370-\204\347e\rMi(\f,\fQ\325\300\020\222:o\326#;#\300\0018\202#8\002\007\002g\004\340\350\023\330%\236@\034\271\024I\n\006\345\307\rG88\302\323\343\303\346\364\350\033\2761\337\330\177D\216\310"
+	.string	"\033"
+	.ascii	"\304!f\215\200\021\tg\007\364\360\037%\b`%\f\177c\377\303\017"
+	.ascii	"\213\004\016\262\"\311\260O=\312"
+	.text
+	.section	.gnu.lto_.refs.8e058af6d61b2dc,"e",@progbits
+	.string	"(\265/\375 {\235\002"
+	.string	"\302E\017\024\240\027j\f\377\377\377\217\355\030Q\375\026{\272\327\beK)jH_\026\204\267\366,5\247\"\2035\334\252\244\204\333\364\036\201\026\333\221\201\342\310c\366-\200\261\304t\2740\305\272z\b\007"
+	.ascii	"L\b\220\022\270A\305{9Ki7\246\240\004%\t"
+	.text
+	.section	.gnu.lto_.decls.8e058af6d61b2dc,"e",@progbits
+	.string	"(\265/\375`<%%\236"
+	.string	"z\363|6N PZ\352\226"
+	.string	""
+	.string	"\363\025q\326\310\3604Yp\245ph\274"
+	.ascii	"~\232\213\231o\241E\013\0321\025\274!Z\337\242;R\221\252D0gb"
+	.ascii	"\214\007\003\227\305A\351\020S'\267\213\233a\272K\333\270%\314"
+	.ascii	"\034\326nyi\235\242w!h\357\224R\354\002?\003~\003c\207<\356\305"
+	.ascii	"\375\374\317\263P\032\204u\341\301\342\202\007 AY@ay\032\217"
+	.ascii	"\364\317\237\341\205\336\345\233_\303\017\337\371\331\t\375\213"
+	.ascii	"\357\340\261{q-\355[\234K\353\3049?s\316d\203\355G#\217G\233"
+	.ascii	"\023\307\266e\3217\315\354\306\230\027\257\363((hDen\344%\001"
+	.ascii	"\346\034\267\263u\363\270\027\267\342}\007\330\310\231\232\225"
+	.ascii	"\300\031\232\234 a\316\261\b\035\021\"D\210(\352\211a\223@\270"
+	.ascii	"\375[/L~\373)\301\300kY\037_\354\016\251\342\326\225\305\001"
+	.ascii	"\343\254C<\222\227U\367n\277\322\333?\343\255\371b\344\213a!"
+	.ascii	"\237_\271\031\\\322\242\207\205\217\317\253\024\21341\005y\342"
+	.ascii	"z\355&\231\326\264\316\035wnL"
+	.string	"\336\366%o\373\221\267]\310\213\223\025\245\241\300T\273\222\370\275\353v\376\304c\004\374\256m&\311\336\024\277\210\345\371x\267}\372\266#@\364CG\200\330\376\364\202\360\244\267kx\333\350\3658\227\363x\307\231\264\273\371[\313<\343l\225\321\023\234\272\276\333Bo\373\016\361\306w\210\315\302\013\302?\020]\017\200h\"\353\037\210\276\304\235!'\227\365n{\360\266\307\256\304\307\\\255\205*M\3635\3478\207\210G\226\321\374\332\256\326=\201\005\375W\314y,\347|\300\r\2206)V\357z\231\247\035\266=\301\276\353I\334\314\343\020nm?s\264\206q\3069\3169\276y\256\035\324\314\336\305\361\017\304G\361\266\207 \266\207\207\036\202\330[\332\217fn\253\n\312\273\335\215\244\007\300\313\026t\315\333\377v\034\373\007\342\353\001\020\273\235\bC\203\233\356w\303\2522\244q!\247\373\215t\373T\241\017ju;\234\305a"
+	.string	"u7N\367\263\001vw\023,2\375\241\273m\240U\200\200\266\273\375\360\335-\013\1773\335\377\345\327g\275\322\355\024t;\004\335nC\267\337\300\327\355<V\272}m\257\333\343\252\274\b\321\335!\272\235F\257\273\253t{\236\211\356\357\322\355.\356\272\335\200'4\335\237C{\367g\351v\233n\241\273\017"
+	.ascii	"\241k\272\337\257\333\303\354\250t{\221:\273n\337\242\353\366"
+	.ascii	".'-\323\375s\335.\327\355l\335~\326\355b\335\356\325\355\325"
+	.ascii	"n\347\352v\254n\267\352v\252n\177\352v\247n\017\352\366\034\335"
+	.ascii	".\355v\246nW\352\366\244n\247\321\355-t\373\263\333\235\335\236"
+	.ascii	"\273\235\206n\237\241\333et{\214nWv{Q\267\037\273]\250\333a\350"
+	.ascii	"v\027\272}\205n?\321\355&t7\223n\177\273\235\204n\037\241\273"
+	.ascii	"\257t\367\222n\007\241\273_t;\007\335\256Aw\373uwO\267\247\350"
+	.ascii	"v\f\272\375\202nO\240\333q\272\375\246\333e\272\275\246\333\213"
+	.ascii	"\335>\323\335\033t\267]w\003pxxx\330\355N\273\211r\335\005\030"
+	.ascii	"\t\217\365\237\213\177\356\223t\342\334D\243\226\243\361\210"
+	.ascii	"&\306o\373'\021\341\236\t\334\313\021s\366x\312\024\315P\321"
+	.ascii	"\235~\267\177\353\217\373\270\227{\2339{\260{\013,$\314PP;\304"
+	.ascii	"+\266\254\254\267\364\313\275\232\214\020\"UJ\3576\361\3716\314"
+	.ascii	"\224\267\333\211\331\031\31597\301\3049\212T$:\214\373Nw\215"
+	.ascii	"\267\316@w\2739\033\360B\234\233w?\264\274D\334\234=@\344\206"
+	.ascii	"\311\346\374\2446;\240J\237\324'\250\225\232\233\317 \315\234"
+	.ascii	"h\2466\241\326\234s\362\363\331\374`\232s\240\326,\3153\360\244"
+	.ascii	"\236cj3?\2479'?\263\023\004\364I\225B\255Ni\016\324J\225f+5\343"
+	.ascii	"\344\2473j\343\231\2439\331J\315\222\255S)\016\324:\225B\255"
+	.ascii	"\324\036~\003\372\007&}\362\243\252\313\263@\237\031\307\222"
+	.ascii	"\2243\212\223\205\306\323\274\227\263_i\344(\0039KM\243{\316"
+	.ascii	"'\177C\312\342@ZsN\235\200%\244\252i~f\241E\2469\027A\032\312"
+	.ascii	"K\0254\343l\326\362l\323J*+\321\310\271\200\245\234\233\236\263"
+	.ascii	"9\347f\3169&*\025\347\034\205\003\255.-\345\f\245\263\224\245"
+	.ascii	"\232p4r\376+\337\233\024j\255\232\362\300\241Y\253\271F\334\364"
+	.ascii	"j\336\243F_k\263,+\t\276Ui\216\300w\331tb\370\200\370\310\022"
+	.ascii	"D\351\227\020\247h\301\361M\337W\373\277\276\222~\265O+>_\315"
+	.ascii	"\315\331\351\276\200\215\373\0020X N\263(\26431\035X?d\340\f"
+	.ascii	"\275\234\336\375$o\326o\375\262\374\326\n\2469;\337z\343%g\347"
+	.ascii	"\215\373\002\356\013\270aU]J\210n\3038=\022\033.7\266\314\275"
+	.ascii	"\3330\371=\322\330\037\3137\2565\327\324\"|\273_\254?\013+\365"
+	.ascii	"\313\022f\344\333\214\200\211a\177\032\035\200H\345\355y\007"
+	.ascii	"\366_Q\201Se\357\352@\244\213\002Vy\267]*/\221\037\362\325\357"
+	.ascii	"\372\"/\304\343\367\372\037\375@\234\255\335\367r\277\337rC\212"
+	.ascii	"\002\370\323 W\252>\250\376\327\306\325\230\264*>\257\347\362"
+	.ascii	"\2646~{k\230A\001\374*+\234\214\224g\305\353\257r3K\005dY/LG"
+	.ascii	"\204\210\033\275\301+\235\215\333\256\327[t\251o\273N\257\345"
+	.ascii	"\3264\255\366\313\373X\237\203\307\237\225kh\256\336\256\316"
+	.ascii	"we\3044\226\330m\337\333m\335\333\327\326\354\3557'8L\241\345"
+	.ascii	"Q\001k\312a\205\352y|\217\227\372(\217\177\352\241\372\343\234"
+	.ascii	"\257h;\374\317\246\315\231\nJ\365u\274S\024\236\376\251\177\362"
+	.ascii	"4\317fu0v\367\366Sn\305\377l\232qfJ\261\327c\207\316\003Q\232"
+	.ascii	"4)\272\3356\275\335&\275\335\"\275\375\204\257\316cyM\364K\021"
+	.ascii	"\270\211w,YE\231\332$2-n\357\306E&&\256)\216\235\232.zH`K\257"
+	.ascii	"dV\027\346|\367\225n$\331\330i\201\361\370\244\267AB\225\032"
+	.ascii	"w\357>T\207\003\273!\177xo;\033\036\224\354\210\2571\231A\001"
+	.ascii	"\276\315)U\233,U\341\034k\363\304\311\317*\034\325\267);dmP\361"
+	.ascii	"\275&\206R\362\034\353\331\353\007\001Aj\274u+\327\306\r\336"
+	.ascii	"\200\323\213\203s\237\254\335\240r\365\205\016\313_ZZ\313\326"
+	.ascii	"\363\246\027\006\306\301\327\224\263\265n\331~\355M\3132R\345"
+	.ascii	"\335\366\332.!\002x\345\326.i\225d\353vPu \340Z'm\325\376\207"
+	.ascii	"\001~P6:2\262\366\f\233m\217p\221\203b\355\366l\313\210\222\327"
+	.ascii	"\273\255\331o\305\fZEI\3621\315\231U[\231\257\335h\361\205A\337"
+	.ascii	"m\343\366s\237VB\354\336m\2218\366f\214*\216\356\335\366\210"
+	.ascii	"\367\271\341\233\236\r\337k\321\264\250\034Q\362\365\325\212"
+	.ascii	"\375\275L\236c9\204u+V\203\325%n\352\335\326HKe\332\242G\344"
+	.ascii	"\335\026\254(6dH\353eveG\024\241;(E\310[\221n\275^*\204^l\274"
+	.ascii	"\333\022i\251\317\305\344\211H\261\013\b\220\266\2523mf\321\300"
+	.ascii	"\210{7\205K\352\352\266\332R]&Hqx\357\266A<mJ\225\261\254\217"
+	.ascii	"\331\244\240\261\275\333\305\250\254\254\226\313qb\244\274\037"
+	.ascii	"U\233f\337\r\253\255n\271\\+3l\344\320\232\321\3433\314jE\305"
+	.ascii	"\314(\254\263\026ba\275\235\005B\216\024\202!1\314\243B\233N"
+	.ascii	"[+\2359@\275\260\026"
+	.ascii	"n\353\260\260\255\352\326j\006\253Gs\214*\223\345\302\345J\365"
+	.ascii	"\321:\301a\307\345F-aB\247\303\333<\232GK\345I2\223W\025\356"
+	.ascii	"\210\332\241\331k;\313\232\352\226\252\346m\307V[+\0257\363\237"
+	.ascii	"T\333C&\260\357\312\363\2416H=\2529\264Q\256\245Hu\025E\023\365"
+	.ascii	"\364\224\235\322\235\271\346W`\016\220\354\227\025'\247Ws\341"
+	.ascii	"\232\\M\bs\324\311\b\236\267(\024\233#\307\223\271\3178K\211"
+	.ascii	"9d\241F\300\\Ea\222\213\245\322\267\373j\214\023!k\200S\b\241"
+	.ascii	"\002\2518p\264L\215\223\251\210O9\260\220\360\275\234)e\265L"
+	.ascii	";dE\004\377\336\355\231%%\245\227#J\2534hx\322'B(\264Mr\303h"
+	.ascii	"`!\330\r\217,A\272\326F\267I\257\366kr8|\251\025\223\232\344"
+	.ascii	"\250\362Z\032-\215\227\373\260E\201l\215/k\317\366\351\330\016"
+	.ascii	"\256Sg\223\003pR\256&\2049;\031As\304\3579\366n\313\370x\273"
+	.ascii	"[g\334:\375\317\343\3144S\243\372~\371\362\245\315\035\\\247"
+	.ascii	"\271I\003!Y\251\021\3565\252\306\340\037:Zl\306\344\335\330\352"
+	.ascii	"\001\352\013\207\026/^^N0\232\0015.\226RX\370m\2563InR\366A\215"
+	.ascii	"\250\201\372\221\204"
+	.string	"\310\022B\302\267\323\301\276I\355\270\023\255.\252/-Z\236\213\007\2618\260\220\320\001\252,>\266\364s\301\372`\021-[\217v\363exC\257\352\305\202\345\003\337l\001``!\330\315\023\326\265\353\335\017\254\321\361\264S\362\356\003~\264\346\260\360\320\332X\327\tN\354\256\351\275r\345\375\336\234sR\025\246L\354N\260\317\343\367\023\213\213\237\374\017\246\212K\337\373|\255Xy\2737\273\333\024\253-&\033|\263_%\373z\017Hi)\257\327\036u\346\214\2243\025\022\"\221\354L\037\022\324\220\307\353\327\243\342j\315\300\262{7\357\247\304(\005Q\313t\237\267\345\311\210V\212\370\250\361n\307\200\275\035\023\205\022?\224_s\343,\245Q\213zy\351\376\t\335\333\325\325\275\035\001Bf\262\270\262\236v0xE\202(\331{\233\310\366vB\307 dr\205\r\3543\323C$\226CLcQ\td\262\250(\371S"
+	.string	"\362hT2\227\310\344\217\f\f+C\220\361\"\007F\036\213\2240\023\006\362\200\204\215\2226AG*lh\200` \3441\310\003P\020\213\245\021&\202](\340c\264,Z\302L\343O\222\210\310\003\243e\221"
+	.string	"=?720\215\212@`\036\213\226H\243\362E\317\362h@\017\221(\341\005\213\236\022 b\370Q&W\334"
+	.string	"\301Lc\214#\363\307\203\245q\005\345\321\030"
+	.string	"\023\026\002:\032Z\036\2210\221\021\354B\t\303(::A(Y\002\023\026\201\210\350(\004\025\313#\020\022\004\017B\311\022\220G!X\005\320\321\250\004sH\350H\024\244\003\027%K"
+	.string	":\266`\302BJ#3\307\250\204\231,\224p\213%\314\224A\205\022\226a4\201\201\245\f"
+	.string	"E0s)C\317\007fO\320\221\n\346Q\271B\r\0226B\001\366Y\0361\215\314\036\004@\030\215z\340\030Jx\t\273\b\321\"\200e\222hE\001\305f@\307\004\t\246\322hD\002\376Q&C\030Z\036\021\205\360\201\002\375sT\302HX\350\355\nNHp\002\205\214\230F\221\302D\n\023\304F\221\202\207'\305\t\236\267O\360\264L\330G\byT\032\207z\210\222I\025>0J\343\320\217\013\373\204\340!\206\t@\3628\200\fJ&\\\004\023\301\314\001"
+	.ascii	"\210ai4\341\007y\024T\204}X\b`\264,Z\032\t\345\310\200\201\220"
+	.ascii	",`\246Q\351#@\017\221P`\351#t\fB&W\340\030\305\300?\307\0300"
+	.ascii	"\020\361\347\307\350\003\244L\376\300\312\231\242$\022\006\362"
+	.ascii	"!J\276\314\036\"Qb\251\204c\034\225@\007t\322\bV\226`&\223\312"
+	.ascii	"\0224F\246\361\003\233\245OQ\005\2462\331\002\007&\202a|\021"
+	.ascii	"\203\250\204\217AG&\022\006:\316\300>0P\322\204\031\030(Y\344"
+	.ascii	"\302>(0\225I\243\232%2yd\032%c`\246\321\005\320\221\021\306\013"
+	.ascii	"\317p\354y\231>(b\230\257\262\bd\204G`\372L@\001\321\321\370"
+	.ascii	"B\t\007\005\035\251\220\301,*\231-\340\030G\370\007vAd<*\341"
+	.ascii	"\245\016\323\347\004\017\023y<z\033\003\fV\200H\341\004\021\336"
+	.ascii	"\037\022\311\243\217\214$\214\030~\214D0J \217\306\242\022?\312"
+	.ascii	"e\t\022\013\304\360c\204ADd\\!C9\343\245\265\232\271\372{R5l"
+	.ascii	"\251\272`ut)l\273\340\370kK\362.[|\035\344\001\207\367n+\330"
+	.ascii	"\n\266\2032;\372z\354\030l\271\304M\345 \\\332--\252\314 d\233"
+	.ascii	"\231qh(\325jy\250&\261\276\253\263\300\327k\353\"-\314\362d\337"
+	.ascii	"\205\243k\013\340\334\f\324\016A\356\336\305\362v\256\032\217"
+	.ascii	"\254\252?\307\276j\177\331\033~\376\367ywJH}g0e:\356\234Wr\221"
+	.ascii	"Jk\206\036\337\332\013\306$\032g\205\355\3252\013\263\356\311"
+	.ascii	"\245\021"
+	.string	"\"\341\361n\253G\343\307\005w\025\326R\211\322\335Q\332<\217Fs\206\312\315\300\b\340\244\360}!\314P:v\272[\274n\363`h\364i\221\322\330\327P\r\311\224w\333lcc\354\240T\341P\343\004ENE\240\322\325\335\267\321t\261a\230\364D\354\272\3464\330\332\265^[\250\276\260\336\255\3432\201\352M\220\256\2327\265\307\343],\266\235#\232\371\021\357\252l,i\322\355\234c\213Wy?\252j\220\334\332\255\2253\341\271\306\222\253(\300\232-\247\2034\250\"\361<\t\003\0252\206hDf$I\322\001\362\n\020\006cY\0328\317\003\022@\0249\322B\310\310\314\210\214$Ie\330\016\210\301$\311\204P\034\362O}\331\220\005\346\216\336\313\216\tg\2614\307\370F\rr\b\343\260\277\367\255-!\035V\243\273\024f\202\276\222\273\tI\255((\202\370T\265\227!c\366\244N\374>zf\315K^"
+	.string	" ;J\200\305\201\370G#Z=mEK&\361n\247\021}\003\346\257\2747\272\204\3331d8\362\314hn\227\275!\234\372\023\017bXG\230Ik-]Z97\330\275eU\013.\343\230\001\315\177UG1\313\331\201\241\250\253\313\341+d"
+	.string	"\321*"
+	.ascii	"\035o\315\341O\021\243\252\343\366l\260\033\265[\370\316\231"
+	.ascii	"4\3133`\347( \342g\342\201\276v\235 \323\364\376\21536\232\322"
+	.ascii	"3\036\364G\203;\266\215\017\016OL\250\317\020\347t\203\210-."
+	.ascii	")\311Ne\330'\036#\007#\272\177\236)\365\232\212\023d>G\225\t"
+	.ascii	"(\237^CTt\254\177\333\270\201\220\355\003\364\337\341\312\212"
+	.ascii	"9C(\025\347\034:\366B\362\360`\t\216\b\273\f\207\353\301^?7H"
+	.ascii	"\024\323|\322$\223za\033\223i\263\251\202\317w\326\357\332\327"
+	.ascii	"\361\234\210\306\206\035\226Jr\343\323\023\374\2042\320\"k-%"
+	.ascii	"\357!\304\330\244\337#\257\311Bez\212\272\246 \020\225Rrl\027"
+	.ascii	"\013\341\207\357\007k\035\241\277\342\247\222\322\221a\325\240"
+	.ascii	"\246\"p7d3S\215\224im#5\337\312\2446\351\262[\331\351Abrv\247"
+	.ascii	"`\317\3679\323y\371\345[WM\224B\203&\034\232\367\2717v\\\350"
+	.ascii	"8!\376>\242i@\372\025SA\235\245+\001Gj\032\274\321\377\264`\003"
+	.ascii	"\314\207hs\210\260t_\002\007\224z0!A\363\037\357\3307y\\.\225"
+	.ascii	"\377"
+	.string	"\036\265@\217B\347\264\300\375\247Pz&\016\035)\354\341\032\020$\356\006\277\203\266|\"s\320\324\313I\nM\325\233\037vo2\205\262\347A\307k^:o\310-\330O2\352\222K\310,\370*\260\347\2413\203Y\244\0228\342/\032)\031\370\333\2635B\032\013 \364;\006\247\270Ji\353fov\303\361A\325\336\023\330\317\311\267\256\206\223\227g\317\275c\253\2149'\235\\\305\354\362}){F\316\034\246\271p\353\006\235\306\002\210\274\300\242\213\035\273?\324\320aL\231\b\251\253W+P\375\236qC\374\r\242\372,5\301;\321\032\r\004\357?\353\375\230\302F[\025w^\344\214\266#\\H\242\322\212\033\327S$\202R\003\006x\326\020\303\022\033\320!\r\263\202\254k\344\0206N\367&\361$\251\300\325\314w;\262\303+\2147\261\302t\3435\273\312\202\006\300m'\203\200\302\322I\364"
+	.ascii	"\243\326D\032\260\273\n\f\f\214H\220\\\247\337\034\344\367\020"
+	.ascii	"T\177\352<'@hD3\211\007\337\367\032I\324\212Z\372\321R\032\355"
+	.ascii	"(\017\207\316\266\025nR~h\006\020\257%\324\272FGt\224Tlb\371"
+	.ascii	"\204\2531\354\224M\250\210\324\213\205|!x\221=d'k\\Y\361\004"
+	.ascii	"\277T\264fb\020\267\007\f\371\007\205\303P\271\330j\361\331\344"
+	.ascii	"U\016\340\325G\235\364\3064@Z:\336`\3070\305\t\025\252\321\351"
+	.ascii	"\275\203C\300R\003O\351\3713\265\206\f\365\342\367\017\270E<"
+	.ascii	"}\020\355\207\321H\343\225\337\340{g!\255(\315\"\352MB\263\346"
+	.ascii	"&\324Q\240\031'\375x#\351\227iX\354\203\022\"\326\r\261\216\347"
+	.ascii	"\224\255\322\272\232\301\221\255\305-{\205\031!_;\214 l\026y"
+	.ascii	"A8\326:\352\362\375\341E"
+	.string	"\262\235\344\230\260\370\236\254\252f_/\\\236\200\202\357D\266\341\367\006\311\037<\207r\364nn\376\357\207fE\022\035Os)\231\n\243\3570\344\361\037\237\rV!\367\211\270)\013OB\037\263n\272\213=\224\371|n\"`i\230(\306\270\226F\241J\335}\231\257\252b\250\2561Vg\363\322\307\350\346\364\bK=H\232/I\001\254\200n!\206\236sc\342(\037\264\021\262\230\210\" \033:\371\336\307\276\201\030\227\327\\C\370\376\255\305Y&\322\217,\301\235\214\314`&l\272\2516\366gu1\252@\242\034$q\357T\3714\301\203\022\354@\331\2341\365\321\345\223i\354IY3\306\326\016$\307\3316\275?\360e\252L\365\345 \322\325(RA\207\004\324\032\260t\316Q7T\253\244=\277\256/\260K<\007\252G~\030\336\\q6$\344\333(\233_V\t\264\363\343\257\205\365\030\336@\336b2\352\324"
+	.ascii	"\225\037\207\376\306\203\r\004\002+\302\340y0V\021\220\314H\255"
+	.ascii	"\337\323\036\234\325YF Y\357\352\270\022\035U\262\224Y\262s\301"
+	.ascii	"x\357y\200\232\361?S\023- \316\213\214?\376\r\271\003\253\351"
+	.ascii	";\026^\345\360\345\244\nb\266x#\265\311\325+D\326\n\266\001\205"
+	.ascii	"\024P\213<\016\314\035)\"\204\335\022\311hjb,\350\t\211\300\t"
+	.ascii	"\306R1&\3032\360\003G\002s4\311\246\"T\026v\261\303\213>\221"
+	.ascii	"\357\315-\204\275\260\346\303v\251\013\237i\352{\334Y\232\036"
+	.ascii	"\002wv\327\222\212\233\234~4\276\017\037,d\023`l\315lQ\2566\247"
+	.ascii	"\304E5br[_\317\314\374\223\364'\356\025\347u$\236\267\002\275"
+	.ascii	"0\203\203~\367$~\033\235S\256s\344\3749F\340\331\274b\202=\355"
+	.ascii	"\\\370\2373\272\367\361\022=\263\264A\365\302\376k\016\\\301"
+	.ascii	"\375\257M\347sC\354\017Zo\340q\017\364-\351\005\331T\025\335"
+	.ascii	"\230y\203\300\361\301\367\024sZ\370:x\\9\021\016+\237L\375\200"
+	.ascii	"#\307\203\345\331\261\227?\347l\322\314@\334\204\201x\312K\017"
+	.ascii	"\333\214\337\345uj\253\260\263\372b\354\201\f$\315\270x\n\207"
+	.ascii	"\371m\313\\y'h\221\366@\327[\034\t-_\365v+"
+	.text
+	.section	.gnu.lto_.symtab.8e058af6d61b2dc,"e",@progbits
+	.string	"blackboxOpen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\001"
+	.string	""
+	.string	"blackboxWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\001"
+	.string	""
+	.string	"blackboxWriteBuf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\001"
+	.string	""
+	.string	"blackboxWriteString"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\001"
+	.string	""
+	.string	"blackboxDeviceFlush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\001"
+	.string	""
+	.string	"blackboxDeviceFlushForce"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\001"
+	.string	""
+	.string	"blackboxDeviceOpen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\001"
+	.string	""
+	.string	"blackboxDeviceClose"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\001"
+	.string	""
+	.string	"blackboxDeviceBeginLog"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\001"
+	.string	""
+	.string	"blackboxDeviceEndLog"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001"
+	.string	""
+	.string	"isBlackboxDeviceFull"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\001"
+	.string	""
+	.string	"blackboxGetLogNumber"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\001"
+	.string	""
+	.string	"blackboxReplenishHeaderBudget"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\001"
+	.string	""
+	.string	"blackboxHeaderBudget"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\001"
+	.string	""
+	.string	"blackboxDeviceReserveBufferSpace"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\001"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\001"
+	.string	""
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\001"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\001"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\001"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\001"
+	.string	""
+	.string	"closeSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\001"
+	.string	""
+	.string	"mspSerialAllocatePorts"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\001"
+	.string	""
+	.string	"mspSerialReleasePortIfAllocated"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\001"
+	.string	""
+	.string	"findSharedSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\001"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\001"
+	.string	""
+	.string	"serialWriteBuf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\001"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\001"
+	.string	""
+	.string	"determinePortSharing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\001"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\001"
+	.string	""
+	.string	"serialTxBytesFree"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.8e058af6d61b2dc,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
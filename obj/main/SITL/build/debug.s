@@ -0,0 +1,240 @@
+	.file	"debug.c"
+	.section	.gnu.lto_.profile.3d14f6b5635fbbd0,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.3d14f6b5635fbbd0,"e",@progbits
+	.string	"(\265/\375 &\375"
+	.string	""
+	.string	"\270\032"
+	.string	"\004"
+	.string	"\352\201\367\375\017\001\240\342\234\212\n\002\003\240\342\234\212\n"
+	.string	"\002"
+	.string	")Bm"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.ipa_sra.3d14f6b5635fbbd0,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.3d14f6b5635fbbd0,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.3d14f6b5635fbbd0,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.3d14f6b5635fbbd0,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.3d14f6b5635fbbd0,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.3d14f6b5635fbbd0,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_debugModeNames.3.3d14f6b5635fbbd0,"e",@progbits
+	.string	"(\265/\375`\371\006E&"
+	.string	"jI\020\02060.5\007<\303\243\341\255\031\3603\274\222\256\314\356\361\236\367\217\007\301\373G\357\271\275\017M(\2557\225~\277\326\344\306~\361\317\201\314\300\216\005#\036\223\250\245$\003\365"
+	.string	"\371"
+	.string	"\363"
+	.ascii	"\377V\226\202M\305\3255e\307\020n\241\245h#e\307\021h\tU\030"
+	.ascii	"\312\216%\304\n\252h\315\304\325\363d\307\023\\\271\255\3609"
+	.ascii	"\3311\205Uj+\\Mv\\\001\025\033\013\326\313d\307\026J\341`\341"
+	.ascii	"]\262\343\013\242\204\016\307\302\020W\237\222\035c\370t\346"
+	.ascii	"p\355P\\\235Iv\234\201\023\232\307\315\020W\037\222\035k\310"
+	.ascii	"\304\346q-\220\354x\203%7\227\363\221\035s\230\244\346r9\262"
+	.ascii	"\343\034"
+	.string	")\315\347\330\032\342\032#;\356\340H\315\347Z\033\342j\226\035{X\324\346\207\3304;\376\200\250\315\017\265hv\f\242P\233#b\311\262\343\020s8\034Q\273&\256dv,\002\216\315\023\261<\304uEv\034\006\250\315\023\265>\304\025Ev\274\353\343\346\212\330\037\342*\226\035\217\360\005^\216\257\353\001\002\206E\226\253.\266\336\336VW\3428\210\270~v|\037\337\213E\005\037\346\305<\231/\363g\036\315\253\3715\337\346\335<\234\217\363s\306\276\316\333y<\237\347\367<\237\367\363\177>\320\013\372\270\227\373Ab_\250D\020?^\203\336\220\faq\237\220[\205\266\353mN\250\201}85\r\255\016\220\333\006V\007*;\356\372>\343\206\226\024W\235\244\354\030\277\0365\016\254.Qv\354u\347\214C;\227\035\003\240Sf\035\235,G\230\323d\307_o\200\204`u`l\204!Z]\2004g\"X\235"
+	.string	"3ZDk+;\0360F\207\261\246\262c\002`\320\3028e\307\005\276\013\333\356/e\307\006\264\240\355ZG\331\361\201g\321\304\330'\224\035#\250\222&\326\276\236\3548\301KA\033c\037Nv\254\340\237\350\261\326'\256\017&;^\360LJ\023,\231\270\376\223\354\230\301'q3\321~\222\354\270\301zv\202}\007D~'ZT\\\375Uv\374 "
+	.ascii	".\357\034\177?\224$7\330\325\246\357\034\275\256\346\005\325"
+	.ascii	"RU\307\257k6\n\273.\t_\372\303\227w\216\277\037J\212W\233\276"
+	.ascii	"s\344\351]\246\2327\340\252\251\016\226\351-^\225\247\273&\252"
+	.ascii	"\273\300\236\356\232[%M\024\300-S`\327\035I\3355K\027@|g\204"
+	.ascii	"\325h\223\221FcG\343\206Z\233\214]\01654\034\273\031;x\354\302"
+	.ascii	"\036\3345\035i;v=\326\326v\354\002\334\255U\263\354\r\177\300"
+	.ascii	"\035\340\372\036\347\343~\374\217\007rA\036\347r>\310\t\271!"
+	.ascii	"?\344\211\\\2213\362F\376\310!\271$o\235\222W\362K\216\3115\371"
+	.ascii	"&\357\344\236\034\224\207\362QN\312M\371)O\345\252\234\225\267"
+	.ascii	"\362W\016\313e\371,\257\345\266\034\227\347z!?\344\213\274\221"
+	.ascii	"?\362H^\311/\371&\357\344\241|\224\237\362T\336\312_y,\237\345"
+	.ascii	"\267<\227\367\362_\002W\237\350\211\265I\nI\260+\334ZU\307\026"
+	.ascii	"\342\305\372\207nmj\222\034\t\\ \212\232\274\022(^\027\244\212"
+	.ascii	"\236^\367DKu4Q\340\326\352"
+	.string	"Y\016\311}\340ju\334`\327\f\362\264\0132\005\273d\344\250\246^\367\007\334\300\237:\334hz\352tH\246\272\2009~]\265\327\353\272\372W\252ez\367\206j\257\367uK`:\024\222\245\2737|\261\007\\\263q\017\321-\364}]s<}e\201KF\242&Y\002\323\241\2111\261\023/\306\337\201\233\006[\244\370\252\033\005\366\274\356\326\274\263\354i\3379n\001W\250\226\346\030,\033n\315;\313\236\366\235\343Vp{\352p\217\274\322\374\272\300\237V\207z\243$\330\355\365PM6\252C\341h6\236\301m\340\252{\f\342kn\225T\315Q\274\276\364\327uGu\344\221;p\2501\034\3020\362\204,*Hj\fk\360\"\251Qq\003\020 \2024\021\253\003Lh\342\302\201l\363\252F\035.|\340\244\0015\351\217?N\257\324\017_\207\225s\300-:$\324 \266\244\266kR\263\371\233\256\201&\240&"
+	.ascii	"\301c\347\035\256\235\271\316s>!\325p\204\336\016s\034\211o\337"
+	.ascii	"\302r \266\2734\240\337\315L0\322\254Ru\353u\273\312\375\362"
+	.ascii	"\361\264\212\261\317F\310\004\210\314\004\270XH\t\225\t\302\356"
+	.ascii	"\266\371\227\\\270I\247\233\375\311\027\253\303\371\212\334\220"
+	.ascii	"\343\324\035Y\262T \371\036\336HcjW\302D\344\240\334\361\337"
+	.ascii	"j\t\023\272\031\222\252h,\030r\352G\330@\374eB\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.3d14f6b5635fbbd0,"e",@progbits
+	.string	"(\265/\375 *\025\001"
+	.string	"\300&"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\003"
+	.string	"\201\204\001\002\001\001\002"
+	.string	"\003\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	" c\220\230V\361\002"
+	.text
+	.section	.gnu.lto_.refs.3d14f6b5635fbbd0,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.3d14f6b5635fbbd0,"e",@progbits
+	.string	"(\265/\375`\027\t\005."
+	.string	"ZV\024\022Dp\330J:\253\242\320\330\3113G\250\373N\326f\212\331\007\222Z\200H)\233\224\342\303\025\326V!\016K\356\351\354e\004\340\240\344<h)\351\215.4\3743\b\277\031\365Bc\314\032\232\251\303\033&\355#S\n\345"
+	.ascii	"\023\001\027\001F~\344Ll\270\322\324)M\323\002\033\370&C\313"
+	.ascii	"V\373L\016G\243\\r1ur\324\252\302z0\215\324\320\031\006\261\332"
+	.ascii	"z\267/\361\337\336f\241!\323\254H\222\032I\323\364o\021\270\322"
+	.ascii	"\264\351o9\207i\332\224\363'\370\023\3244\257\262\270\263\032"
+	.ascii	"\202\361L\324Wb\237\355I\220\247\324\0253\205K\3234\30787\004"
+	.ascii	"\306\226\2556\036y\006\035y\372HL I:d\035\343\016\363\311\223"
+	.ascii	"Fy\344\3515\332nb\177\310~\004\373\250\375 \373\016\354\377\330"
+	.ascii	"o`\237\201\375\005\366\025\330\357\261o\300>\217\375\035\373"
+	.ascii	"I\373\003\354\353\330\027`\337\306\376\321\376i\277h\237\306"
+	.ascii	"\376\332F\264}h\333\320\366\031\333\204\266\007m\003\332&c;\201"
+	.ascii	"},\333~\266\365l\337\331\226\263]m\327\331\336f\263\331\264-"
+	.ascii	"f\233\3126\312\005\310\275\265\357\335\257\026\323\364\253\354"
+	.ascii	"\307\022\326\222\317/\314\271\322\024\016\207\312\215H\326\326"
+	.ascii	"\363\335\313\327x\336\347\1779\030\027\233\230)\363\200b,\246"
+	.ascii	"\266\nx\362\334/\215*\322\364<\347\233\315\363\234>\324\026["
+	.ascii	"h\350k\337r=\013W\025\316\210\374\245RW~\356\264\345G\266\365"
+	.ascii	"x\347\362\265\236\347\335$\026I4\334j\025F\277\347|\363=\247"
+	.ascii	"\231\214\366\347\326>\367;\343\223\262\242\251\375\245RW?\305"
+	.ascii	"%a\341\323V\377\316\376\223C\271\335\026.\331\022\267\372v\366"
+	.ascii	"\247\234\312\353\226+M\345\316!T\200\234m}\225[\371\232\317\257"
+	.ascii	"\370X\236\3055N\314\264-M\23195|el\300mE\360\344YI\030}\2373"
+	.ascii	"\347>\347\005\034y>\n\352K\251\300\343+m+\315\221\247\020\352"
+	.ascii	"\323\235D\246t\025n\335\364\311\023A\007\243_\344W[\273\332\345"
+	.ascii	"j\224i:#\350piF\306L*\265\365ss\243K\027\261&E\020\323\332\230"
+	.ascii	"\307+\245\023$[\3758\373\001Q\250\267\306\321\251*\216\214\206"
+	.ascii	"\325\215 \030\257\026[\275V\366\233[u*\235r\240m\r\022"
+	.string	"D\275T4}StV3\246\212l\312\301\270\255\336){\243Vj\314\212\n\356\311\263\346\310\363l\250WF\216\336\023A\262\215\261\3130\2678\253\255\336\245\275/\026F\212&\"\341V\367=y\336\034y\256\022\365\2728j\251\362\267\266\325f[@\021M\231\355m\365B\275y@\364\261+P\357\323\001'T\350\234\226E\025\354rG\265\325\313\302\336\025\333d\2637\007(\266u\302\223'\200&\352M\367H\230rl\353\231\210\230\325\005\366\002\321m5sbc\177\207\206;\204\355\013j\253oh?\312\317T\260\033`pl\335y\362\374\027\324/\244\201R\005\352\320\f\341\321\313\022;&[}B\373\202\037\264\231\273s\013\333\352\363\344Y\304\202\372\201\365k0\352\254\f\240\r[\024\025\332V\037\320\376\337\311\374\315C\232:\t-w\350\330\352+O\236G1\250?Fi\230\2665\300\003LD\022P&\244#"
+	.string	"E&\242\t"
+	.string	"j\230\210\204 0!\035\2410.\031\2318\332\200\224t\304Td\264dc\036'\2350R\002bJJR\002:*}\030QTM\201\302\005\004\0344`0\026="
+	.string	"\nQ\342\b\005\b \244\243\017&\200\212\224\226\200\036\354,\031\231\370\240\301(DR\006\021(@\030\205\300\021\022$\305\013\313\333\352\rb/\331\242\355R\353j\314V\377\275@\275@\266\f\256\256n\317\326\314K\352\313\232\331\253\265?\352\260\350\231y\362\\2\324[fl6\245\354\330\212\343\243G\336W\224\355a\357\330\362\300\301\023\"\204o\353\225O\236:SP\357\216"
+	.string	"s\177jQb:\2144\236\330\260\266zu\330\253\334\260\233\255\263/\260\255\306\373C\275`E\254\272.\036_^8}Yh\201[\275^\366vm\016\234,`Vdl=\327\223\347"
+	.string	"\034\250\227\353\330\244\016\261l+ro\254\r\2760$Z\266zm\310\341\250\322\312\333\272Z\250w\353L,\204\001\2675'\013\353I\312n\261\354\213\331\253fY\340r\253\241\004\200\233\250A$g\f4H\023\021\022\221\2440\311p\240B1\243\252\003\021p\241\202DRet\332\f\365\320\316]\352\307)\333\246\031K\322\245,\2160\201\366R\017s.\236\302\303\217\304-\177\210\222\215\"\032"
+	.string	":\t\235\022$\013\344\201\035\244\254\334g\202\340j\203\257\207\030d\227\320=\360\035Pt@\320[\212a\356bd\021\317\331\031\213\232\236X\243{\231#\254\031O\303\313\025\n\331\002H\304\324P\221\361\320\251p\036\035\2405\020s\354h\036\262\324\207\240\225\035\346^!h\343,\307\362\024(\344}\327\036O \371kQ\247\265\032^\375\301d\304\006\206\"S0w\200\330\b4\265\356\316X\353\206Y\362\206\311\213X\366\b\327"
+	.ascii	"P<\201Q\r\364\234u\03145\253\237&S\326\333\214\026\262]\247J"
+	.ascii	"S\013\227y\233\240x \3257H\241;\r&\3072M\274\021\366?\275\347"
+	.ascii	"\004vi\331\327)@\325\3662\262<\210\370\242\261\305\005+\343\235"
+	.ascii	"\233\262/\236\032R8e\350\243xz|\"\277\r\355\266rA\341\373\t\243"
+	.ascii	"dNs\246r\003\001\327\264\312U\016\026\237\262\303U"
+	.text
+	.section	.gnu.lto_.symtab.3d14f6b5635fbbd0,"e",@progbits
+	.string	"debugModeNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314"
+	.string	""
+	.string	""
+	.string	"sectionTimes"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	" "
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335"
+	.string	""
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343"
+	.string	""
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.3d14f6b5635fbbd0,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,118 @@
+	.file	"cms_menu_vtx_smartaudio.c"
+	.section	.gnu.lto_.profile.de8b2c579f0a4fa6,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.de8b2c579f0a4fa6,"e",@progbits
+	.string	"(\265/\375 \024\205"
+	.string	""
+	.string	"P\b"
+	.string	"\001"
+	.string	"\240\342\234\212\n"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.de8b2c579f0a4fa6,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.de8b2c579f0a4fa6,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.de8b2c579f0a4fa6,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.de8b2c579f0a4fa6,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.de8b2c579f0a4fa6,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.de8b2c579f0a4fa6,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.de8b2c579f0a4fa6,"e",@progbits
+	.string	"(\265/\375 \017y"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\002"
+	.string	"\301\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.de8b2c579f0a4fa6,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.de8b2c579f0a4fa6,"e",@progbits
+	.string	"(\265/\375`\016"
+	.string	"\235\007"
+	.string	"\342\31557PO\323\001\310B\270\022"
+	.string	"j\342!\326\221?\002IO\036\302\330\004}y%V\323^\306\315\242\214\356\246\212\242\226,\004\301\263\n\340\277\2758\273\360\026\306\357\335\213\310\024\237\260\032\036\0302\023S\211\233a\352\326\202\336\211\255\275\363\202\261\003\004\314m\236<\006sQ\020\016\013R\263\354\026\341e\370f\265\3030\360\005\346q\264b]\325&\267euj\267\233VE\241\331\212\213^{U\212;Mf\372\336\236\376\372\323\233N\346lhX\033\024\222\257%wL\f\0028R:\240\250\301\016iO\325\"o\217\376\270\304\001\363H\316\340$\255\260d\224@\321\025\344\273\212SW\361?\310\013Tr\302\005$\325\0041\352\201xH\376\377\374?\371\337a\030\206\377\001\376k\376{\001\t"
+	.ascii	"\257\354K\t\006\337\303q!\220p\352\216V\006\211\262\f\327\214"
+	.ascii	"\255e\f"
+	.text
+	.section	.gnu.lto_.symtab.de8b2c579f0a4fa6,"e",@progbits
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.de8b2c579f0a4fa6,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,285 @@
+	.file	"bitarray.c"
+	.section	.gnu.lto_.profile.664c5336e2d5f4b,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.664c5336e2d5f4b,"e",@progbits
+	.string	"(\265/\375 J\235\001"
+	.string	"D\002>"
+	.string	"\004"
+	.string	"\346\223\345\213\006\002\002"
+	.string	"\002"
+	.string	"\001\277\330\227\230\003\004\330\313\241\243\016\003\343\304\327\323\002\006\002\001"
+	.string	"\005"
+	.ascii	"\271}d\226\346.t\261a\003m"
+	.text
+	.section	.gnu.lto_.ipa_sra.664c5336e2d5f4b,"e",@progbits
+	.string	"(\265/\375 B\355"
+	.string	""
+	.string	"p6"
+	.string	"\004"
+	.string	"\002"
+	.string	"\003\001\001\002\003\004\001"
+	.string	"\006"
+	.string	"\200"
+	.ascii	"@0\330\330\245`\220\311\006\260"
+	.text
+	.section	.gnu.lto_.inline.664c5336e2d5f4b,"e",@progbits
+	.string	"(\265/\375`\023"
+	.string	"u\003"
+	.string	"\322\205\022\034\240'\351\317\377x\216W\tP\334\017\307\277\205\252\252j\370}j\367\366\267M\244L\001\177\rq\221 \311\300\377\340\266\207\310H\220T\270\f\032m\315,\363\201\327\b\n\346<\374S\332\026P\177\341\310\215/AE[\302\327\013\004\r"
+	.ascii	"F\313\306Ns\fL\263\203\300\202r\201\210\223\360\266\2526Z\244"
+	.ascii	"\334\f\203\345V\236v\025`\b"
+	.text
+	.section	.gnu.lto_.jmpfuncs.664c5336e2d5f4b,"e",@progbits
+	.string	"(\265/\375 C\245\001"
+	.string	"\224\0027"
+	.string	"\004"
+	.string	"\002\001\001\017\177\002\003\177\002\002\001\004\177\002\002\002\003\004\001\001\001\001\377\001\177\002\004\177\002\005\177\002\004\177\002\004"
+	.string	"\003"
+	.string	"`k.\343o"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.pureconst.664c5336e2d5f4b,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\205\004\001\232\004\002\232\004\003\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.664c5336e2d5f4b,"e",@progbits
+	.string	"(\265/\375 \210\r\002"
+	.string	"\244\002|"
+	.string	"\004"
+	.string	"\002\300\005\300\007"
+	.string	""
+	.string	""
+	.string	"\001\002\006\001\002\020"
+	.string	"\002\003\004\270\006\274\006\024\024"
+	.string	""
+	.string	""
+	.string	"\001\002\002"
+	.string	"\003\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b"
+	.string	"/DtW\016\325\\QG\310\331\351\347"
+	.string	"v\343o"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.lto.664c5336e2d5f4b,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_bitArrayGet.0.664c5336e2d5f4b,"e",@progbits
+	.string	"(\265/\375`\354"
+	.string	"]\f"
+	.string	"6YV@ \217\223\0168B"
+	.string	"\230\003\335\201>t"
+	.string	"\003\214R9\321*\336\346Ps\234EH\365~\331G}\361|#\277\310\272\224\214\017\b\bD`{j>\225a\320M8\321\260\263m#d\357\235dJ\001E"
+	.string	"?"
+	.string	"B"
+	.ascii	"n)\f\003\310\\a\031\221\231%\250Ge\327\314\001\236]"
+	.string	"\345\215g\327\266 !\242\216\004\234\334E\007S\b\031\231\231\365\013\036\031G\265A\270m(\321\002%\245\304H)\310\314\"J\312\004\367n\213\240mH\353\223\336\330\305\326\034\2339\266zX\352\330w\254s\330\326\260oX<\326\032\324\211\r\025\231\022N0\271\302\221\310\320\326mE\355\246\3553\177\020\331\245\243\231\314\n)@*;\216\206\330\332\203YD\001\005X\230T,\342\001I\205\241v\360\354\334\035\201\302\277y\273K\034\232\213\342\341\377\317(i \341\251>\336\246\030\023<\325\271/Os\277\305(\305\220\360\324f%x\013\255[ff\277\322\026\313q\213\003\241\217\310]=\037\020:\030\326\t}D\254\221\013\004\272<\326\310\247\003\262<X\003\353\303@/\006\0130+t]\230\265\311\322\345\234\303\344\244\326$/s\316m2Q\335=\363\001/L*\324\253w\017S'\360R\2029\340\216\247\371{\022"
+	.string	"c\221\"34\030\361g.(e\035\354 \003!\255\221\2568\315\262,1e\007hZ"
+	.ascii	"]\346d*\374\246F\301e\210S\023M\327|\002"
+	.text
+	.section	.gnu.lto_bitArraySet.1.664c5336e2d5f4b,"e",@progbits
+	.string	"(\265/\375`\354"
+	.string	"E\f"
+	.string	"\006XS?\020Q\234\016Q\013$\365"
+	.string	"\002\245\216\264\217 \002\307\345KA \345\277\031ZJ\213R\002\210\365\biO\016\323\354\033\"?\314"
+	.string	""
+	.string	""
+	.string	"\212 K1\032\355U\367\365\230\006E#\021\262\273I\231R@"
+	.string	"<"
+	.string	"@"
+	.ascii	"W\261\275d\033\017\260K"
+	.string	"B\001c\327c\340Juh\357\004\342au\001\361\320\233}cb\241cE\347\"\307\356b*\342\333s\363\337\342\226h\364yR\017v\327)\032i\270\365\266\027\330v`\377B~\351\2772-\271\307oe\272\3124\005\3231\3230\323\323\224VM\247\246\017\300\n1\340c7\303'\262 0F\t\333\277l\247w\026\333=(\266v?\314hP\035*\230\236\366S\004\n\325@H\327\341\037\023:\325\356\236\204/A\217\301C\352\245\252\347NL7\215xM=g\"\224\237%z}7\002\312\317\360\226\021-\225(U\341\0057\022\312\317\366>\251 \354O\273\273V\222\003\036\rF\2413\026\n\027M\273x4\030\214\223m6Y\006\343h.\033,\243u0\013\002g\021 h\230'\3134\354\362\366\323*\311\220\003\bHC\256\364\300\210\213pP:i\245\223\220nCTJ+\217Z\240\006'\222\340\224h\005\026"
+	.ascii	"c\221\"\023\357\304\321\360\350M\034f\242\007\025\026\301\032"
+	.ascii	"c\320\243\325\222+\3723\315\222\245\366\300\314\005\221\013\237"
+	.ascii	"1\314\313T\370M\215\202\313\344\324\350p\207\027\355$\003"
+	.text
+	.section	.gnu.lto_bitArrayClr.2.664c5336e2d5f4b,"e",@progbits
+	.string	"(\265/\375`\374"
+	.string	"\235\f"
+	.string	"\306\230U@\020q\233\016X\341\310\302\003"
+	.string	"\270\222\307H\003\007Q\350\202eV^f\262P\364d\210\256\327<\n\357\220\371\373\242\236j\3344\002"
+	.string	""
+	.string	"P\2042\024H\003\363\205\256\277\266TOOMh\223$S\nB"
+	.string	">"
+	.string	"B"
+	.string	"\365\b\223\330|\322\025\007\310\024\211H\221\331-\250G\345\327\316\004&\277\312\002&\277n\255\213\215\n\030\024\\\n\215\314\304\316\301\233q\253m\302\026\250d\304H9\310\314\"\250\004\203{\267U\320\266A\353P\242\326'6\006\261\227Q\354\013b-\304V\017K=\354\204\330\207XI\302\376X<\326"
+	.string	",\031\003^d^\030\261\244\312S\361\241\255\257\266\330\271\304f\224\216Z\231\032X0\250\374\022H\306\006\b\3341]\376^\240\006\027\362\t\t\"Uf\332C\035\341\266`\202\307\374\367'\204\344\266\230|\274? <8\352u\337\\\013\t\216\372\334\025\323\345\327)\n3>-\036\034\265\335\b~Ck)3\263\017\235\r\310_5\037\0232\232\226\351l@\260\220\214\303\3114X\310&\303\3014\232\b\366q\240\031\204\007\032\326\3112\r\273\272\264\224\027\365eP!\271\247\326\rt0\bFu\351\3267bp!\352\325t\352\034)\234\311=<\235c\345\303\022\027"
+	.ascii	"c\221\"\023o\306\321\360\350Y\034\306B\017\236\213`\2157\036"
+	.ascii	"\037\203\034\255\221\\q\037j\214,e\007fZ\250\\\343\214a^\246"
+	.ascii	"\302oj\024\\&\247F\207;\274h'\031"
+	.text
+	.section	.gnu.lto_bitArrayXor.3.664c5336e2d5f4b,"e",@progbits
+	.string	"(\265/\375`\335\001m\020"
+	.string	"&\036kG\360\260(\035\260\333\327\2658T\246w,\251^\035\350\325g\3406$\021\207R\316\n\267wq\264\357\225\336\337\352\231\213f\364\017%Z\246\376\016\314\300\363\340m\0174<\032\220\222Z\320\215?\273k\013\364\t\331[\312\224\002U"
+	.string	"U"
+	.string	"X"
+	.string	"\007>\227\016\377\301]~>\200\273t\313\246\001\002\013\251X\241\335\230sz\273\241\2451\274\243\266.\343j\313\247]1\330\210\201)\227\261\203\261x"
+	.string	""
+	.string	"\302\"\t\317\216\215\f|i\004\321\362\275\355\232\002'\006\266\\\273\2229\2475\006^\270\271\333F\331n`\253\201\341\337\361\332\335E5\267j\031\325q\325\033\325\272\352\007"
+	.ascii	"\275\370\270\231\223\345\3263s\244\315\207\327n\377\204o\253"
+	.ascii	"\261J^\026\036\330\254\330\2313\f\2714\203\317\345A\366L\317"
+	.ascii	"\202\313XG\206\002\rY5#W\373%\016\323z\214u.`\316\331\b\024s"
+	.ascii	"\206\b\034\"pT4p\353\323\254N\b\304x\254\206Ko\313\355\352\254"
+	.ascii	"dxy\254\334\255\221\020C\273\013\322\302>\r\205\223O\007\037"
+	.ascii	"\205\273\324\275\314\305\2457w\013\332\357m\017q\001C%\304Ko"
+	.ascii	"\273\265\033\030\270\373b\207)J\302\201g\307;\263E\217\371=>"
+	.ascii	"\363\207.\363\203\036\246'@};\202\372\2664\301\244\212+U)B4I"
+	.ascii	"\004e\224J\215V&\b\236\311w:}$\317\3044:y\244\224\312\023)\340"
+	.ascii	"\017UJy\253\357Ky\240p~g6\355\016`r\\\373\222\373b\016\022+Z"
+	.ascii	"\351\242\226ul\267\237a\202E\005\345y\234s\316\350\237\305u+"
+	.ascii	"Z\216, \260\202\231\302u\241\300-\247\017\263\234\226\372\304"
+	.ascii	"\307V2\n\203Em\312\322N\364.:\213#\312r\245\314\226\027\276\351"
+	.ascii	"\255\303\354\203+YnyG0\230\261\266iZ\230\330c\023b0gfG\0167X"
+	.ascii	"\343\275\303\016\002X\350e\215P \n\270\206\2215g\260fD#\274\007"
+	.ascii	"\345\316\005\237"
+	.text
+	.section	.gnu.lto_.symbol_nodes.664c5336e2d5f4b,"e",@progbits
+	.string	"(\265/\375 e\265\001"
+	.string	"\204\002a"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\177\007\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\001\177\b\002\177\t\003\177\n\360\372\2508"
+	.string	"\004"
+	.ascii	"J\350\f\370\006\370\341Zs\f"
+	.text
+	.section	.gnu.lto_.refs.664c5336e2d5f4b,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.664c5336e2d5f4b,"e",@progbits
+	.string	"(\265/\375`\301\004\025 "
+	.string	"\306\273\322I\240\330Qc\300&\363\001\027\310#\225y\342\2213\302\370@\346ff*g\260\242 ~5\232\347\332\024\212n\234%\373\036\356\203J\241\265_|\312k\\\215\027\274\203\nv\270{\036pS\2742\246\213G\020\205\353f\307&[\246\256"
+	.string	"\266"
+	.string	"\271"
+	.string	"A\366\304\033\"JW\\#\351 \323$\256\271\260\256F(]>\336H^\253\353\343\262;\227\350\036\037\307\316\251K\331\214\211\032#f$m3}w\312\033vw\252\256\324mc\251o=\361gs\314\253+\305\022#yu\334\035\227\245\335\036\276S\227\3123=\366\355\317\342\314|qaA\034I\236\033\240$i&\316\223\373x4}i%\316\245\225fo\200\322\274"
+	.ascii	"J\235\322\276Y^<\214d\366\315a!\303\021\333\246}i\330\376\262"
+	.ascii	"\355e\273\313v\022\333T\266\263l\033\331F\262\235\300\366\225"
+	.ascii	"ils\331\226\t\013\013\013\263M\264\335\332$\202\3539{o=\177V"
+	.ascii	"\235\245D\364\274i+T\323vUs\336\373\371\026u2{\253\2322Y\325"
+	.ascii	"Y\332\242j\332\023\2529\276\341\023\213\024\n\032\274g\332\273"
+	.ascii	"\211_\023\n\234\025Sv\375\224\377\022\223\016<\3607\255\300)"
+	.ascii	"\250\212;\204W4\301\003\202\256\227\375O\340\307{Z\337+\2466"
+	.ascii	"\326\337\006\217\303\177\016N\266x\030\267x\276h\272/\351/p\366"
+	.ascii	"\377\375\347}\361\377\371_\006lb\177\246Y:\374\375\376\340\200"
+	.ascii	"\337\233N\255\244\177$R\031\242\246\355\323j\323\262j\207Wb\317"
+	.ascii	";\374\024!"
+	.string	"\320l\317\036\367\375\277\\\314\241\212b\313H\336\037\027\310e\315u\263\\\002\003\245\223\0337\240\256\223\351+\344\016\361\325b\257\326M2\023\374\tv3U\345\303\013\314\203AZ\f\f\223\026\260[\3047\211\335\343s\267j~\035\233(\255\031X#y\267\306{\344\"\361\335\272Fjz\227\372\331\273E\376\350\275\006n\3565 s\004\n\245*I{0/\021c!\275\300\350Q\031I\203\321l\317\340,Yy\341\215\244o\246G\273<\n\374\177B\206=\220W\343+s/\315\266\271\261{\3006\371\230m\262\374\277a\027\263\206\020t\305H\332\3469\216\377\3149{`\332\n\317\264\352\211\232\303\336I\300\333\027OY\241J\256\347x\366\367=\241\352!eW`\312\006\272\034\006\235\221\204\335\255\302\216s\035n\272\332.\227\323\325h\214r\271\bC2\273\333\004\b;\234\006\032\027\341t7\244\333\006\323\016~\024\374"
+	.string	"\205\220\031H\210\201\020\203\322@B6\233\320\217\315\364\217-\266\033\272\215\300}(wC@\262\335PO\203\035\022\016\204\351\240 \t<\027(L0\213\026\210 \322\351\210v8\r5\244\334\321Q\256\250\206\204#:\252\025\351>\324\026\350\330\211\223\373\245\344\201\222\013,R|\277\276HI\245\030\311\033\305VbQ\200\2761#y\241\334 6\252\227\030!#y\237\310\260\230\262\320\2214\230\255\320 \211\361\324$\312\313+\366\267"
+	.string	"2\234\301\032\006Y\202Z\262\344v\231\263\363\252\360\310\202\343\324\"L\027&\276]\276\"[\322!C\035\311\313e+\001T\250\201,c\224CF F\231\221@FfZ\350\200\002\2311;\017\021"
+	.ascii	"*Z\264\265\352L\0070\371?\371M/B\036\242\016\005\377_\317IQ!"
+	.ascii	"\336\3662\214\2601\302\261\030\213\225C\277\340M\240\243\302"
+	.ascii	"P\341'D\037\341\004\227|\220\306\246T^\023]\362@\005\356\236"
+	.ascii	"\351\305\032\025#\315Bu9k6h\0366\371\205\bK\322z@6\363[\222\227"
+	.ascii	"*F\271\177\230C\340\324\245\243F\256s\003\225\217\355\331\232"
+	.ascii	"2\020\323\311!)\271\264\270!\251\244~\202\334{\323\023C\3046"
+	.ascii	"\314\023z\3517\365\366\177>\025\223\034\357\237n/_\216M\237\233"
+	.ascii	"\305\233\376\256c\372"
+	.text
+	.section	.gnu.lto_.symtab.664c5336e2d5f4b,"e",@progbits
+	.string	"bitArrayGet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330"
+	.string	""
+	.string	""
+	.string	"bitArraySet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335"
+	.string	""
+	.string	""
+	.string	"bitArrayClr"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337"
+	.string	""
+	.string	""
+	.string	"bitArrayXor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.664c5336e2d5f4b,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,582 @@
+	.file	"crc.c"
+	.section	.gnu.lto_.profile.b70030dd64d54b96,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.b70030dd64d54b96,"e",@progbits
+	.string	"(\265/\375 e\235\002"
+	.string	"\024\004Y"
+	.string	"\b"
+	.string	"\334\206\377\260\007"
+	.string	"\001\260\240\374\337\017\002\002"
+	.string	"\002"
+	.string	"\002\265\212\310\322\f\003\276\307\307\\"
+	.string	"\004\277\315\376\324\t\005\220\351\245\372\f\004\002\001\002\006\256\306\254\254\004\007\365\267\335\206\001\003\002\003"
+	.string	"\006"
+	.ascii	"=\247\270\\\221\331\020MI\271\334\261\2016"
+	.text
+	.section	.gnu.lto_.ipa_sra.b70030dd64d54b96,"e",@progbits
+	.string	"(\265/\375 \250u\002"
+	.string	"4\003\234"
+	.string	"\b"
+	.string	"\002"
+	.string	"\003\001\003"
+	.string	"\003\002\002"
+	.string	"\020"
+	.string	"\007\001\002\001\200\004"
+	.string	""
+	.string	"\001\001\001\200\f"
+	.string	""
+	.string	"\b\003\004\005\002\001\002\003\002\001"
+	.string	"\b\001\020\b\006\006\007\t"
+	.string	"\n"
+	.string	"OC1C\276\202\200<\220L+\330;>4\227\001\221"
+	.ascii	"G`\200\005"
+	.text
+	.section	.gnu.lto_.inline.b70030dd64d54b96,"e",@progbits
+	.string	"(\265/\375`O\001M\007"
+	.string	"\322J%,pI\223\016\374\247\021x\260\223\341\345\313\302#\277\017\376\3362\254\277\376\303\212\f\006\276\365N\377\317x\217\206T\314\361\377[K\266\334)?HO\303f\264BHO\003\320j!=\215ce\275\256\002f\236\025\257b\nN\"^\305\034H\274\212\031x\275\032\305\035\234ha\343#\362#\322~AA\223\301}\2063HNP\320\204\220?\243\210\277RlGHRP\320D0[/\364^\206:\347\234\362-\033\234h\021X\177R\\E\354\330\3629\321\022\360\215\233\020# \200\"#\243v2\001\021\r8\200D\302\3341$x\227&\007\032\304\361-\362:d\nq\354\006Hf@"
+	.string	"\003s\244\346A,\314\206\f\016\027\300\020\343\257x{\177*6 \252"
+	.ascii	"\344\t\0373\276tu\022\377\257k\267\351\300\270]f-\215\017\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.b70030dd64d54b96,"e",@progbits
+	.string	"(\265/\375 \336\345\002"
+	.string	"\242\004\016\026\300%\035\377\033w\375\377\356U\365\371\277)"
+	.string	"C\b!r\313$\003#c\277(-\253\320\253rt\316\254\3315o\253\226X$\201'\007\213\b?]\226`\005\317\225\r\001\016"
+	.ascii	"A)\266\222\007\352aAYO+`\\\310\212\205a\241\202\255I\020&\201"
+	.ascii	"@8/7l\240\r"
+	.text
+	.section	.gnu.lto_.pureconst.b70030dd64d54b96,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\b"
+	.ascii	"\200\004\001\205\004\002\231\004\003\200\004\004\205\004\005"
+	.ascii	"\231\004\006\205\004\007\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.b70030dd64d54b96,"e",@progbits
+	.string	"(\265/\375 bU\001"
+	.string	"\300V"
+	.string	"\006\001\003\200\007\300\004\300\007"
+	.string	""
+	.string	"\001"
+	.string	"\002\002"
+	.string	"\024\004\005\006\007"
+	.string	"\007"
+	.ascii	"\300\020\320\017\030\354g\027/D\200\3607\200\005"
+	.text
+	.section	.gnu.lto_.lto.b70030dd64d54b96,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_crc16_ccitt.0.b70030dd64d54b96,"e",@progbits
+	.string	"(\265/\375`k\0025\024"
+	.string	"f\246\204I\320\360(\035B\001\267%>\200\004'By\230\rQ\336\3761\221\035\021\303\027\302\240\026)xF\221\201\242b\"\205\364\276\305&\201\236\251\347\360\205\027\\A#|Hu\026@\232\331x\355\310\340v\247\322\266O\b![\312\224\002s"
+	.string	"h"
+	.string	"o"
+	.ascii	"\341\275\227xO\3142\035A\320(\330\211\321\345\230s\024\001\\"
+	.ascii	"\300wO\337\372\356\255\216\303\313\361\006U\366\020\374<\271"
+	.ascii	"*\363}>\002\304B\306\346\362P\20234IG\242\311 Q\230lh\250\331"
+	.ascii	"f\n\216\270\371gs/e\263\271\224\006bx\250\261\262Q\220\004nF"
+	.ascii	"5*\033\214\356\203\256CE2\266\233+\310`\316i\225\261]\270Q\267"
+	.ascii	"\275\301\266hkM\255\020\026\210T\257>\216\373=>\376\252\353\356"
+	.ascii	"\324q\270;\\5\270\352O\325\236\252\345\252W\325\252\352\007@"
+	.ascii	"}h\355\346\264\360\3444\217\274\027;\327\335\376\217\037d\225"
+	.ascii	"s\007\212]g\"9O4\350\341Y\232s\222\334\263IxOD\336\216\331*;"
+	.ascii	"\301\202\330\307\002\3369oJ$\252\307\311\354\315\311\301D\213"
+	.ascii	"9"
+	.string	"G\023\037\b\250e\355\336\2409\315\264\302\017\211%\017\334\220U!\221\016o\371\276\005\367\336~\2738J.\327\333\243V.8\233q\036\0259$\2719n\371va9#\030m2jw\037\364\221!\030\273\233\321\341b\275Z\217\375\330\373\234%\024c\243\273Zkx\023}_\335\325\321\234f\372d\325~7E\314\216\027}\262G\027\335\034\373(L4\021^\034;**\232r\027\314\265v\235\270`.\221\345\265\262\362r\211,*)+\242\013&A<\031\340W\004\b0q\302\353\005\023U\343\374\342\330\022D-\bH\310\204\341\350eg\241\322\327z\260\013\241$Om\315\362\013\035\350\334\364cQ[\363\356\251]\0244rJ0\332t9\347\234\340\346\030L\362X\233\322Y!C6\334\232]\362\324\266\026\224QD\273\315\364I\207\276\037\301\0270 P\002A\314i\007\023\005>\035\006\352\013o\231Uz\t\332"
+	.string	"_\373"
+	.ascii	"\032\302\224}|hK(j\205\357\277,\002Z\371b\364(\267\303\354\036"
+	.ascii	"&j\237\365\006c\332b\251)m\001\360y\332U5\223\332A\3068{\356"
+	.ascii	"\315J\\\262-\326\177\337\306\"P\337\361\267\f/\200\305\377\f"
+	.ascii	"J\336\022x\bh3\270g\f\207\227\030y_\343\367Z\247\245O"
+	.text
+	.section	.gnu.lto_crc16_ccitt_update.1.b70030dd64d54b96,"e",@progbits
+	.string	"(\265/\375`\214\004%\037"
+	.string	"\366\370\306K\240VN:\203X\210\307\221\323Y\177\013_\371\217w\3540\242?\003\030\275"
+	.string	"f|\024B\t\265\200\362\251\362\357\235N\037M{\353{L\226\30249^L\224JK\363\267\204\257\274\022L\317Q\327L\327\365+\221F\b![\356$\003\265"
+	.string	"\250"
+	.string	"\262"
+	.string	"=\210>\305c\307\335\373bL\307xr\255\227\n2y\357\212-!\367\032\021p\316y\362;\316\203\210\203\325\030C\211A\026RU\225{\215\273\333c\312\223\365/\345\311~\342\363g\260Z\343\031\355\340S\264v\232%i\273\006\371]\325$D\321\303Sk\036\215\240q%J)\354\216\031\231\327\261\204\025\025"
+	.string	"c\211\3515k&)\211]\211\022\n\273S6\306D,\032\325\023\306\322\211\233&^\242E\023'-\201$.\240\330\212C\253k2B\"-\036U{|\215\272\321b\351\304\373X7P\244\254\305\022\323\253\311\273\367r\rQ\\:\263\234\231\305\230\231\307l-\004\270Z\345[\255\354bky\227\324\217\336\352\\\373\217\377\374\324o\376\352L^\352lk\345>+W\263\362\001\244C`\306\356\035\221vv\221\220^5\016\366w\375V\377\325-\363\371B\016\306?r\312Et\255\1771\003\237\305\367\n0#\307\2757=\331eo\f\036T\026\360R\301\002<\264\032d\327\342sq\n\374\026\037\355\265\212\300#\212\354\336\373"
+	.ascii	"\310\234\236<3\021?\310\2618e\346\253!\034\017[6\034X\r\361\204"
+	.ascii	"\037(\020\341\"\273\327\250s\222\033X\037\257\"\372\217\016\366"
+	.ascii	"v\215\\$)8O\342\330\256\3147>"
+	.string	"5\335R\206g\302*b\n\007Y9\3234]\265pX\\C)\3233}\244\0221-\323M\345\300a:\246\237k\2306\205M\036\225E\225\204\324P\276\364\217\312\210Q5\343\\\277\364\217\037\360u\244\201$Y\351\262\267\266\215\303i!\225p\351[sEB+:\037\313n\227\376\327s\204\\\303\263\332\335\277\3620!\237S\006\177\250<Y\273v\024Fd*\252iu\247lh\243\333\251\315\256ue2\204\022\3264>\373m\202\245!\241\025\3254f\243\260\266\023\363M\241\024(\334/\230ol\016v\326\325\320\240\225g\320\3122\265rL\255\f\203V~\311\005>>5\350\027\200z\202l\006!\f@=\033J\036!\236\013\266\367\3535\367\022\364~\275\035\220\357\347\307\327\333\001\371\360\374\354z?\340.\001\r\373\202z~;!\237\357\267K\215E\267\250m\233\2559\350@R\324\302\264\235\330Fl\252\265T"
+	.string	"\021\245\232M6\221k,\315\266\242m\233Xk\3624;\204)f*P{\346\232e\301\311n\351c=\347\210k\bUsb\332\364\217\237"
+	.string	"\204F\353\\\327D\266\346\215\204\247\246\306u\256\211L\344\272\356 O\250\234\030U3{\357\275g;\261)V\3264\372\264E\322\364M\023\231\017\\\3276m.\t\0336\t\315vz\2012\327\001]\250a<\243\bs\210\220\004#22%i5`\002\231\262\354\006\020xW\223\244\335\320p\255\213<\0215\201\t\244\037RL\004R\003\354\272\301\020]<\344\250`'BD\022\300\t\243t\233\257\037\232\264\215\352I\361\341_\371\346n\023?G!\"G\213\271*Rk{cLb\007\367\034k!\203\0070\016\223\246,\2216\025;\037b\371\021\211\352\254\230"
+	.ascii	"\037\222\256(\313>\262\333\016\332\311\322!,\230\334\207\373"
+	.ascii	"\217\361\302\221X5\334iw6\002\325l\331\341\022\350u\223\263\033"
+	.ascii	"\353u\035)\323a\327\026a\205\240\234\177gJ~5f\021\214Q\313\030"
+	.ascii	"0\336'\3044\256\345\033\342\3058\322\262\344\257}\212tN\377\003"
+	.text
+	.section	.gnu.lto_crc16_ccitt_sbuf_append.2.b70030dd64d54b96,"e",@progbits
+	.string	"(\265/\375`\272\0045 "
+	.string	"\006\373\314J\240VN:\202Xa\331 \352\306\371\230\266\330\034\025I\247\322Y\"\266\204\025\\\365u9yP\016FB5>\3374h6l\312\203}\r\353\360:\274\005\037\344\004I\r\332\033\027\\Y\375\330uC\373\354\"\322\b!d\313\235d\272"
+	.string	"\262"
+	.string	"\265"
+	.string	"\025\244\210\225\335;\314\371\310\r\230\353\320\003Y\316+\363\251\216\343\367\252\017\307\335\013\265\325u\357p\001\0330?\362\3600\344G\3639\362\343\217\231\211\356\b"
+	.string	"\030\222\016*\367\336]K\261y\363W\355\360|\366\357\350Y3Kr\264]\177|\342+SZ\222\220\350\250-\217F\300\370\021%\024V\347\254\314\353]i=\007\260Xjz\315\226\"\224\222\374\210\322\t\253c\326\244)(4\252&\213%\023/K\234<\205%>\332\002FV\220\261\b\201\226\306\251\b\tTxT\355\327\353\324\214\247%\023\357w=\301\230\331\323R\323k\271s\357\345\232$\\:\00383/a\346\b\314\026\0300g\345\227\234K\2552\256\254|ka\271\327\331\366\341\217\336\352|\276\3527\317u\036\217u\266e\345.+W\263\362\003\330\244\304\020\357\035\221\206v\303F\257\030/\376^?\327o\365c\361\267^\344\1771\252\365\263w\207\004\252\251\262{oN\326\2030\013\375\007\037\210"
+	.string	"\0337\356\275\350G/\234\242\3335\n\001VV\241c\r\035\330\271\022\243l\007\277\213Q\256 'c\020\314g\361\265\370<\336C\350>\270\210S\273\367iJ\306\275\367\201\371\021\307>G\n1\243\037\377\253\023\031\315q\035\277c\r\331\333b\207j\211\003\363\343\255>GZu\330IA\004eG\375"
+	.ascii	"\231k\232\356'@\264\264\206\260\252QF\352z\246\253\026\216\212"
+	.ascii	"o eZ\327Gb\212i\231\356(\n\016\3231\375\\\303t\231*\371\224\217"
+	.ascii	"+#\343\006\362\245{WE\214\352\031\347\372\245\377u\002@\300\232"
+	.ascii	"(\242\312\017\213k\333.8-$\246[\343\232\253y.\222\265o\375 7"
+	.ascii	"\220r\001\321\322\232\306\357\332\267\202t\245\250\2461\177\210"
+	.ascii	"\217g\272\340\007\221\037\337\357:\002\240\222`SQMk\0353\240"
+	.ascii	"\214f[5\233YCO}\322\3315\252\030f\324D\314\303\264v\024\363\313"
+	.ascii	"\364\t\0317\024\363\215\315\213\347\032\232\231\263\262\356\254"
+	.ascii	",SV\216)+\007=\037\207\356\351\251\274\036\2571\374dh_\217\307"
+	.ascii	"\0274\372\20204\363\030\360z\274\335\017\220\217\017\020o\367"
+	.ascii	"\323\303\343\263\343\365\202v\ft\f\304!Co\347\003\002\352\355"
+	.ascii	"\320a\321\033\212\331\236\266[F\260\260\242N\031W\273/\360\324"
+	.ascii	"'1\316Q\023qKw\177MA;\212mM5\026\013/\252*\332c\315\326'\236"
+	.ascii	"\202\226S\345"
+	.string	"\017\221\266\203g\217\247\330#@9KqZ3\327\266\006\037\233e\001\023\030\220FM\254\264\241@\204\3219\257\351 \333\362f\202\224S\273t\256\203L\3445\335YcWbF\365\314\336{\257\331Q\\&!i\372\224\332\032g\372\246\203\314\n^\3236]\"\021\002tJ\003c\250a(\246\214tH\204d$\030\211R\314\030`\002\231\262\253:\020xg\232\f\007*U\024d8\224\t\022S\022*\336\026\300\001q\265\261\253\317\004\241\222*!\327\016\306U\214\362\212r\021\314#\022\315\301\r\003\200\3074\330\246+\205\214\333c\374Fm\366\026,vi\372\037\315\267\270\354\331\036\350\201\204\343*\030\240uO\362\277\227\256\274L\226*\224ohH\311\026\bL\035\023-\302e\351W\316uX(\324\205\301\210n_S\231\n\254\360\003\263\033\335V\r\365\202\227\325\263\376\n\361T>h\004\307\220\320B\330\321`\335>"
+	.ascii	"\203\235`\217\020\213\275\001Z\365E1\002z\363\200L[\307\3736"
+	.ascii	"\222\006\213\362\215\3006<~9\334\267\236\274N\356T"
+	.text
+	.section	.gnu.lto_crc8_dvb_s2.3.b70030dd64d54b96,"e",@progbits
+	.string	"(\265/\375`'\002\345\022"
+	.string	"\346\343|G\340\360&\035\30225B\004@\007?\306\0070\373\022\275\244i\177\033\311\364 \336]\372\030\264\033\214_v\247}\263\271k\250\033\325\023\345\306\023\326\300\206\372P\003yi\214\343\312"
+	.string	" \255:;\232\017-\222\275\311\2262\245m"
+	.string	"a"
+	.string	"j"
+	.string	"&N\320\235KY"
+	.string	"c\326m\036lR\226^&v\314i\373\266\203\273C\333-\225\365NF\016\256\262\374\236C\0218C4\261\230wP\326\334\320x\321\r\016TQB\322"
+	.string	"\213\265T\202\230=\312\316\235b\262C\210`\006\007\033\250\230\005H G(\203\027\233\321\375\3175\310\210&6\273J\006sN+M\f\303\375q\333\033l\177\266B\b:\266H\b\n\304;\317\177z\355\377\370\355\356\344kw\\5\267j\250\352U\265\256\372"
+	.ascii	"PN\f\b\232\323\246\211i\022q1v~\273}\233\377c\317/q\037\230\337"
+	.ascii	"\f\004g\212\0065\246\2449'\3119\233t\347\f\\@<\007\037 \236\273"
+	.ascii	"\rc{6O\201\032$\252\257\261\274s\346\220x1\247-\335\212\2544"
+	.ascii	"2r\345\264\264Ie\304\245]A\224\213\332\221\233\213\251\245\027"
+	.ascii	"|B$q\334\206\254\262\210\360\227\b\227\333\277d\273p7G\311uw"
+	.ascii	"\357b\222\253+_:>b\305\255\b.\315/\361\273\272\t\315(\017\313"
+	.ascii	"\375\376\347\007\202\220^=d\026E\315\022\214\365i?\326\333\235"
+	.ascii	"\r\275d-m\262m1\2724\373*J\256\017\336,,\272\362\324*\265N\235"
+	.ascii	"\244V\251\317E\325\322\242J}.,+-_jE\341;\031\261j\202\204\325"
+	.ascii	"WA\245Z}\236m~ul(\345\202\200\274\3065#\222\331V\2674\313\243"
+	.ascii	"(\362\300E\013%y\2670\303\030\367=w\260\303\243\336\312\205\031"
+	.ascii	"(v\273*p\334\216f\224\307\341\234s\312\245\031\305\305\241\366"
+	.ascii	"\264s\003\206l\\\230]\362+ `\202AgV\007\025\n\214x(\3347\326"
+	.ascii	"\305Y\244\334\270\265#\200\214\202\247\241\200J\271>\244g\t\270"
+	.ascii	"\025\027=\317\226\3459\234\202\211\330\007\237\307\bL\030\334"
+	.ascii	"\354\276\253y\205{^\006\254p\336E\374\026\265\035\332\027\274"
+	.ascii	"b\215\021\205kx\263\203\225u\021\026\200\315\3522c \274\314\310"
+	.ascii	"\0335\276\327:\355z\002"
+	.text
+	.section	.gnu.lto_crc8_dvb_s2_update.4.b70030dd64d54b96,"e",@progbits
+	.string	"(\265/\375`N\004\335\035"
+	.string	"\206w\300L\240\324U:\n\362I\346\364\313\330\225\275\310h\201'\217F\243$\360"
+	.string	"V\303\213t\270\304\2609:\334\361\235\376\217}\234IBV\rz\365\376\241\311q\025^\007\360\t|\204_x\032\361^\274\333 \203\375\237\2214B\b![\356$\003\257"
+	.string	"\241"
+	.string	"\253"
+	.ascii	"L\365\224{S\024\211!\276\245<y~\245<\311\265~\b\307}\357O\022"
+	.ascii	"\217{\211\t\330\300y\262\201\203\033\343Nd\261S\002\371x9\226"
+	.ascii	"\334K\214\365\n>\177\342\252%\236Y\215{\312BO\263$mW\034_F\250"
+	.ascii	"D\004\020\304Sk\206\330qq ?\023V\346ht\372Q\256\262\006\250\b"
+	.ascii	"\372\034\265\246\357'\344@~B+SE\345\323\003\352\352\251\"\330"
+	.ascii	"s\223\347%\013\310s\322\026\220\002\"\322\002\356,\200\037\037"
+	.ascii	"$R`\210j\237^\255^\240\b\366\274\177t\022\310D\025\212\240\317"
+	.ascii	"\2539\341\336\313U\0040x>93O1\363\004f\033 \351\207~\364E\347"
+	.ascii	"\3638~\363\304\277\274\321\331~\350\334g\345jV>\200\222H\nvu"
+	.ascii	"\357\316\225\325\215\"\235\202\356\3643\375E\277\321-\363\371"
+	.ascii	"Kw\342?q\252t;\322\233\230m\337\301\347\321UK3\356\275g:\257"
+	.ascii	"\220Y\004\344\263}\b\007\203pdb<\022_\211S\333\223\030\312^#"
+	.ascii	"\nCV\306{o\004\033sz\362\3147\276\216\037qj\224co\317\353\352"
+	.ascii	"\212=B\020\212r~w?\264\227\023\032\357%\306\234\344\007\366\306"
+	.ascii	"\213\267\343\360`_W\0074b\301yR\200\355\312|\242\333\270\235"
+	.ascii	"\030\303\037(]\355\322\260\342\316*WG\334\220a,Y\272\245\253"
+	.ascii	"\322\205\317\312\225f\351\363J\250\364Jw\022\004Oi\225\376\316"
+	.ascii	"\312\325)m\362\224\234FRQ\212\234\225\257\256\025}\350\352\221"
+	.ascii	"]\375\352?\235@\017\252\326\341c\322d\273k\267\372M'\300\363"
+	.ascii	"\203W\"w\250\016\033\316{\357[\360s\312\223\265\377\023N\365"
+	.ascii	"|t\352U\225\251\332\tu\017\273\354\263k\220]\214\\\275b\263\337"
+	.ascii	"\037\204L\274&:\365\212\231\230\253=d\276\231;B\204;\0053\f\354"
+	.ascii	"N\347\027\227\026\2642\013Zy\245VV\251\225S\320\312/W\013\345"
+	.ascii	"L\347\22355\365\346\030lhn\254\006\234\f64\034\312\031\234\031"
+	.ascii	"\f"
+	.string	"VV\2235\313\024\310j\262\230\rm6\243\311b653\263\230\254f\213)\2001\355\206\246\026\303\241\321j\261\224\250s\313\352N\323n\355jD\351t.\355!?\n\006\021\212\202\n\301\360\325\262m\367\030=i\266\025\355n{\036/\001\311\361\004\313\236\256>ap\333(\375\243[\243\360\307.\006\332C6\207\2300\013LK\035\363\227\356\2615a*\004\021u\253]\335c\250\362\245\033\351Hq\210\256\036\355\275\367\236=d\006\273\322\245YAF\310\226\206\351\0363\202\2774\254\315\251\251\335O\316\354T\250q(d\004\314!\202\314\b\005%C\323V\003`\002\231:\354\006\020pg\223\244\335x\242\362\021D\344$B\367\n\344\223\226\241J\351\335\202\215\245\266\325=\016\230\246\215\277\017\330\006\264\321+\263G\201\022\327m\367O\234\372E~*k\001S0x\034\273\306\245\212\001\266I 1^9M\252\254<"
+	.ascii	"\0214\333\"\264\215\031:\n\\\255\017\235\366\244\216\370\343"
+	.ascii	"B\020@q\206\267G\322\203\023\270\030\350\211\034b\314\206\305"
+	.ascii	"\337\304\b>8t\f\363T\001`\321-\301\254\035\206\250\255\251\215"
+	.ascii	"\205h\214{\306\300\370\2110\275\361\221N!\242[Gg\310|\364\034"
+	.ascii	"\244\231DW\003"
+	.text
+	.section	.gnu.lto_crc8_dvb_s2_sbuf_append.5.b70030dd64d54b96,"e",@progbits
+	.string	"(\265/\375`\224\004U\037"
+	.string	"6\371\307L\240\326Q:\002_\007z\340T$\347\250\241\307\232\206\222\027\247-;\211\024\262\337\334y\202\255o\331\241\336\233R\205\274\257\201\327W\265\322\361q\340\3530:\214\027\343\204:S\210\032\r\263_\340\333f%)U\327,!\204\220-w\222\001\263"
+	.string	"\254"
+	.string	"\265"
+	.string	"8h=\202\300\272ye\276\216\357\340\335\030\342/\367\256HF\335{T\300\006\320\227|\274\214\371\022\375\314|\311<f'?\272\270G\276\3701M\271\367\326\272\005\243Gy\325\036\317\260\346=\006K\321\323,mW\036\237\351\002\214\240\204\204\"\036\263g\020\211\031O\0224\2629]ZRO\366*,"
+	.ascii	"\213!\361\251=\207\202L\236$x\302\346le\021\201B\240\212\262"
+	.ascii	"\030\026\375$\272\t\023\022\275\264\004\254\216\260Z\204>k\223"
+	.ascii	"\242H\211\2300\250Z\252W\257\032*\206E\357'_\036\311\330R1$\276"
+	.ascii	"\236\023\356\275\\\205\204\303\363\312\231\371"
+	.string	"\212\231%0[\f\001\263\2632\314Y\371%\255\354\"kaY\371\361\207]\351\234\336\370\243\217:\233\177:\333/\235\373\254\\\321\312\2671\237X\331T\335K\342\313\353\")\245\220>\365G\375O\277\322\277\304\007\362)>\025\307\234xo\272\024s\317\241\370Az\253\352\306\2757\3662\312\336\242\b\310\027g\355\371\222\017\rB\027\025-\036\374$\307\236tG2 \240o\342;\361{\334G\317\177\260\020{{P\320\341\245u\357}\200\276\004`?3{\230c/\177\344\2318\306\f\032\360\276\344\203^\032g\323\021\214\006J\037~}\301tHI\f\255{\2177/9\245L\3274\2209\301i\232\326g\223&\276\024\275\263\213?`\312z\246iH\237W\257\216PJ\3222cZ\246\353\323\205\337\314Y\307\364\177&`z\326\035%\301_\032\246\357\363\352\325/\226\365K\237?)\317\001\004iU\336L\227\316!\213"
+	.string	"\325.\226\265K\237\352\003\252\262~U\272i\210J\020\333\375n\351K}"
+	.ascii	"\321\221\237\211\336\211x\330\200\362u\346\313w\220(\005H\374"
+	.ascii	"\251_\235\263\345\243\321]\334y\025\b\364\336\353\200?\204\207"
+	.ascii	"C\001\0271B\230/\323>k\f\301a\374\251_\314\307^\355\"\363\317"
+	.ascii	"\036\027\026\367\n\346\032\332\247\316432i\345\230\264r\271]"
+	.ascii	"\207\336\331\251\266\234\2555\360\350\364.\227a\247+w:\r\315"
+	.ascii	"\266\005\266\234\255\306\203\273\335p\266\032\317N\206[\315\226"
+	.ascii	"\323\325\026\320\030\327A'W\333\341p\271Z\354\370s\013\353^"
+	.string	"\251\300\205\344\247{,\253\265\321f\266\351\324\0131\200\240\026\301+]\021\0305\375\252\304\272\310,\304\224%]\222d\244\302\332\246f\237\351(\224$c\345\373\230\235\266\355'\017\273\272\004(](`\026\225\265\211s\333,R\304,\237\215\264\213|^\2354\013P\311\2769M\003\331\2365\025\220\214\335\322\262\006\242g!&M\267\023\027\362\n\250v\331{\357E\273\3108>s\246aHN\002^\250a0e\bt\006!\021\221`Fj\222\306`\002\021\272\264\r\020xW\232\024\332\f\032^\t\322\277FR\366\365\372\215\231\032\370F{\347Dw\323\033\272\301\375I^\207\007OZ\214\343\022\240\316\007\2412\311\037\364\\m\240\262\t\022z<\217\260``(R\326h\234\267\t\253\203w\023\261\233\"h\335\316\031\274m\204\322\265%\361\352\004\334-\2642hlB\262\"Te\033\265\237\002\237\266\b^Ew\n\001"
+	.ascii	"\370@\246\022?BM\3060F[w\256\031\020z\332\223\262\302\233\341"
+	.ascii	"\r\242\325#\305\032<\030\037r\342\\A@h>Pq\f\210\2035\231\026"
+	.ascii	"\214\230l\220Lc\272O\370c\215\210\271\363\221\247\211H\323y\177"
+	.text
+	.section	.gnu.lto_crc8_xor_update.6.b70030dd64d54b96,"e",@progbits
+	.string	"(\265/\375`\306\001\005\021"
+	.string	"\306 sF\360\320&\035\372\305Z\206\201r(l\262\252\203l\345\346\361\375'\0377'\030\263sK"
+	.string	"K\223\331\225\205)\032M\n\\\317\314\332^:\035?,>\026\207\241.\b-D\262\r\222}\361\371I\346,!do)S\n^"
+	.string	"`"
+	.string	"\\"
+	.string	"\316\374\316\312\272K#\203\261\373%\360\001\356\221A\003\225W\377pb\264\232\024\255\026;v\277NE\254\022~7\314\325#\324\\\371$\260\0310\257\225G\270\271\304\220"
+	.string	"y\271@\222\"\242\240\313\236\256\027+\241\t\231\353eG"
+	.string	"\213\301\274d\236[\204\335u\302\274:\334\332m\227lC\2603$\206\337\271uK\247\226>\200m\206F\001\033\27313\036+\024\203J\374\347\007z\332*?v\231I@)pgB\266\245GE\316\203\237\224\357\013\207\221\213\305C\264\373\211<\332\001d\361\036\325}2\300\220m\251\321\240\200{4"
+	.ascii	"5\355\363|\205\352\237q<\300\256\315\220\310\367\001\332#w\001"
+	.ascii	"\332c-Yt\270\273\013\027\034\352\207\242`1\325T\222\376F\313"
+	.ascii	"\003\353.0\234\270\021~\212\366\230*\001\366\302\005\202%g\251"
+	.ascii	"\261\030./\3655\352\246Y\343\345\004+g\326\364\252\022BG\253"
+	.ascii	"\007K\316\354o%\365\306>\tN\021\221\325\306\376 \215\276\363"
+	.ascii	"s\377\271\267\373\374\332\277?\036\350\001\250\233\230NP\220"
+	.ascii	"\002\312\004\323\211\005\255\004\245\304\004z)O\355\215x)\257"
+	.ascii	"3\235J\245\223\327\231*\224\224:/u\241\033!\340\023\352$\325"
+	.ascii	"\241\234N\251\216\364\355\325\306\206Pu4R\220\326\007!\026eE"
+	.ascii	"\275\361\205t6\350\207>\007\205\214\214\n\325u\331\271\034:4"
+	.ascii	"JR\303\344T\325e\333\233BU\351\031\n\" `\002!\265\316\001\226"
+	.ascii	"\300\304C\237\265c\263)\324\312\362v\024\320'fZ\264\026Z\203"
+	.ascii	"3\267\274\273\232Z\301= \324\236#\255X\2348!\300\340\003\tt#"
+	.ascii	"\260\303\2572\372\262N\303:\302Z\324\355\263\335\330c\310\232"
+	.ascii	"\t\224m\371\371rG\240O"
+	.text
+	.section	.gnu.lto_crc8_xor_sbuf_append.7.b70030dd64d54b96,"e",@progbits
+	.string	"(\265/\375`"
+	.string	"\002\355\021"
+	.string	"\026\342vG\360\320&\035\272\243\270\200\021=\fj\003f\224\235\243n\361\310~\206\342Go\024 77Ko\317\246\025\3534\2162Z\201\355t\355\251\243\206e\023\331\314p\231\242\246\372\003\275<q=l\327\3141\237\020\262\267\334)\005a"
+	.string	"`"
+	.string	"e"
+	.ascii	"K\023$\264\033.\260\002\356\323\341\th\237\334\007h\237N\331"
+	.ascii	"6\036\332\354\177T\304\300t\354\256\247\037RQ\206\267\214\251"
+	.ascii	"O\2511\345\303\236\340\225\203\345r\371\224\333J\006'\200k%M"
+	.ascii	"\216\214\206.{l\271TQ\212\230\271^\366\220\027\021\3135\363\270"
+	.ascii	"A\330]G\226k\303\255\335\266\311\366\003;J\b7\367\236\177\233"
+	.ascii	"\217\335\362@\267j\321qF\037\300\266\003\303\300lWf\306c\213"
+	.ascii	"\346\020\210\307~\237\037\350j\337\376\t_\346.\206b\305h\341"
+	.ascii	"\200\373\374\177\016sg\006%\251\003\261p\033b\213yXQ\342s\341"
+	.ascii	"\013\243\341\243\245ba\264\033\212|\232\304\216!j\206\310\243"
+	.ascii	"\375\235\363\244\336\323r\001\033\332\342Tj\034\361\343\002C"
+	.ascii	"<\272\334\335\225$\227\n\242\317y\021\301\220P\305\231U\257\235"
+	.ascii	"\276F\f\007\325SX`\341|\224\366y\275\354R\350\365\242\325\341"
+	.ascii	"%\316TcD+\227j\215K\017Bq\273\333\300Ga\252p@\306M\213N\0234"
+	.ascii	"v\364\274\304\231\035\272D\255\261obsdd\245\261A\272\207\377"
+	.ascii	"\307}\002\340\311\244\037\370)\212J\212\236\300\223\323\312<"
+	.ascii	"\255\240\250\277\221\017\374<\225\022\211T\372<\225\t'$\357\003"
+	.ascii	"W\274\221\002.\231R@\357T*\201^\027\356\245T\235\021x\212^T\345"
+	.ascii	".F\335\324\246@\212g\031\301J]<5\206\274n\304\364\230Z\343\256"
+	.ascii	"\304\215\016N\374P\251-\235\034\355\364\260s8t2D\237E\323) \220"
+	.ascii	"\202\231\301\333\001z`\217a\310\276\310'\317\013\036\023\206"
+	.ascii	"\212MZ\267\313fT\203Co\314\261^\217\\\236\021\203\001\360\022"
+	.ascii	"\262\260q\245d|\365j`\023nme\2650\303\334\321\004\351La\200\302"
+	.ascii	"O\230d\330\003\024\004\301Y\315+\315\r J\275\307\2235f\200\312"
+	.ascii	"\203\374R\356\\\353\t"
+	.text
+	.section	.gnu.lto_.symbol_nodes.b70030dd64d54b96,"e",@progbits
+	.string	"(\265/\375`6"
+	.string	"E\004"
+	.string	"\364\0052\001"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\177\t\260\206\3618\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\001\177\n\354\363\203\007\002\177\013\003\177\f\004\177\r\005\177\016\006\177\017\360\372\250\007\177\020\001\t\177\021\377\037"
+	.string	""
+	.string	"\200\200\200\001\b\177\022\n\177\023\003\002\t$\003\002\b\344\016\003\005\204\016\003\007\n\360\372\2508\001\304\006"
+	.string	"\020"
+	.ascii	"\007k\b\353\b\335\264\003\324\303\007\310\357-\265J0\\\366t&"
+	.ascii	"\016\314\020\320\016h\207\004\332\001\332\001\334i0\307"
+	.text
+	.section	.gnu.lto_.refs.b70030dd64d54b96,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.b70030dd64d54b96,"e",@progbits
+	.string	"(\265/\375`\302\nu8"
+	.string	"\332aX\025G`^R\007\373e\370\365\034OS\327z\270f\002\305\"\257:\213\1771\033\222_|,"
+	.string	"y\377<{\255]\f\377\020\246\356\325m\374P&\216\365\205e\252\310\302K\221\302\310\271\351\2217\260\037H\177\214m\233\273\311\224\002\037\0017\001O\001.\245&\f.\253\035d\267\370\227\303\316\305\237\355X<K\013\301\377_\377\337\276\245\305\235\001Z\240\177 R\230\377pc\350\366q\361+\356LPt\237\370\243HN\224\326\234\267\177XH\202\004\265\350\025\035[\325\376\261\376\036\264\366\210\330\236\300v\273\025\247..\323\206\306\031\347\2623Q\305\377\211\323\212\273\223\325n\367\352\366)\276\345\315\234\033\365\376\363\037\006\312\325\340j\003\313\252s9\025\207\025x\225\276\240\241sm\023\336\372\207y>SSF\336\254\366\003\266\275\253\0034_Cg\266]\301\352SW\2606\354A+\353\003\326\254\353\316\336\355\274nG\320Z\272\033\314\r\316MZ\247\333\205\324n\177\323\355k\001"
+	.ascii	"A%\234\200W\021\020\365\351\366\260\356\206\320\355@\335]B\327"
+	.ascii	"\355W\272\275\327\355=\335\276\353\366\334\355\335\335q\335-"
+	.ascii	"\355n\267\356\216\323\335\321\356.\353n\257\356F\352\356\261"
+	.ascii	"\356\026\323\335\t\272;\356\356.\335\355\354\356fw\023\350n3"
+	.ascii	"\335\3153\235N\247\335\376\326\355I\335\254\210l\026\030\261"
+	.ascii	"*\253\335\315\340;\312\177\013\364\360#\335x\331\272N5I \370"
+	.ascii	"\177\030\370\030\310\273\3602\251\276\237\037~\177\3432\031\303"
+	.ascii	"\205_\244\013\277m\357\215o\373\017'{\356\223\330\272\033/\223"
+	.ascii	"n\374&\201\336\370\355\307\304\037\254\361M\272co\262\347\306"
+	.ascii	"\304\244k\\&\201n\f\tR\365\264l\372\3604\256\361\245\216VDd\017"
+	.ascii	"\352\302\357\243\375\373\263\351\221\016\376\255^$\032Q\207w"
+	.ascii	")B\245\212_\304\327\341\377?p,b\275o\204\272M\336\377&E\027\177"
+	.ascii	"\314\320\302\320'\342\320\026\210\325G5\375#8\376\267\376\320"
+	.ascii	"\377o\377\177\207\264\202\377y\364\\\346\361\370\257\024:\276"
+	.ascii	"U\353\245\351??\333tI\2721\326\353\363b%f\276\023\334:\363\321"
+	.ascii	"\226H6n\253|\324\377;\033\313L\332\220\223U\037\343d\034\036"
+	.ascii	"\3622\355f|\254y\214\360\307<k\330\256\236Ye\340A\253\312\304"
+	.ascii	"\266\017\255\274\351t:\365\241\325\277x\230\303\021\034L{\030"
+	.ascii	"\027\323:\"\374\360?\314\313F\340\260xe\265\347Ak~\301\266GX"
+	.ascii	"s\323\251GX\273\335K\227\037$Y\315bV\301\204\002\256\306\363"
+	.ascii	"$j\205\207\230\332\225\245\024\002\226\211\231\310\205Wu\006"
+	.ascii	"\346MJ\376\374.\025\300\334Y\301\232\342O\242\227[$.\316\343"
+	.ascii	"\270\322\203\027\221\265\037\256)=>\253\235\251\336\336\\\032"
+	.ascii	"\242Lj\247\3242\022\275\323.\375q\2024\343\312\252\333\221\300"
+	.ascii	"d\206e\325\353L\331\330\334\315\037\371\257\354\300\244\316\332"
+	.ascii	"\332\243\315\332\330\234v\267\230\035\253\362\322&\253\336\346"
+	.ascii	"\361\317\354(\206\315M\273\3618l\357\213idk:3j\334\264\265\366"
+	.ascii	"8\r'7\265\301\006\227UOs\265\350\253\205E\rN\017\223\007\033"
+	.ascii	"\034\330.G\321\216XV\337\370\363\212\352H\2273\327\334\232\323"
+	.ascii	"e\346\354\314\243!\376?\367\337\343\213\371J\345Pn\312\031\224"
+	.ascii	"\026\264\366(\317\222;WOYu6.\246\213}\224\261\223U_\323jCc\024"
+	.ascii	"-?\263\242\231\222\332"
+	.string	"y\262\355h\234\254\035\n;\324\313\330\366\277\205\177*\203\022(*o\257\264\032\342\345\310\362FQ\323^\326}A\203\213\371\374o\375\177\002\237\252A\007NV=\215\213\005\270Z\022\026\315j\317Q\360\343\206\213\031YV\333\261\330\316\335\353\023\221\377O\245\203\037Y\364Y]\347>\324\375\3439w\360\271\016B\373\3071\244-E=\302!\211\335\317g\"8<\022\236\360! L\232\301\023pa\311H\205\214\025FE@!PI)\205\201\3400\305\n%&#\001-4\034\036\001\201F?\037P\b\354i\340\2210\210\024l\301v\206\037\205_\321\214]\027q\260\300\301\302\332E\034|>\016?\037\333?_nht\001\303\317\307\016\333E\005\026L*`\244\b\n\207K\013:I)($\032&%\t\211zV \005sKF,\230T,\255\302\241RnhT4D:b\332\365\206\r\037\030\230\030\001\202\005V"
+	.ascii	"\n\201DHI0`$\001\211\220\216R\300 \002\n\227\210*\030\250\312"
+	.ascii	"H\267+%Y\315;2\274\312\314\243\363\216\206\363\016\236\364\237"
+	.ascii	"\350\336 g}\331\210[ud')(jN9G\206R\221`\201\266y5a\2364G~\220"
+	.ascii	"e5S\371t*\245\342\271\361\373O\3147\262\215\316T\355\r\334\033"
+	.ascii	"\360PDaE\255\352\361\230\221\336\203\213i]k.g\251\365\224\247"
+	.ascii	":#\215\240\tB\225\325,\345j4\262\244o\214\345\226\006f\366\364"
+	.ascii	"\224\241\204\330\337jB\266\306s\306\354\213\253Fg(w\356\232m"
+	.ascii	"hm\211\2636dcl6\032\263\2237\027<\233\254\242\374+\207z\200h"
+	.ascii	"\211\335rSg']\222:[\240Y\3154\002\200\345\250\261<F\230#\"33"
+	.ascii	"\"IA\222t\240\002\221\2512n\021\240-\223Jf\223,\333\001H\024"
+	.ascii	"\364\337O\337\325 f\267\316\201\341\213l\350\334\303-\342\335"
+	.ascii	"\357\202\006V\237(5,``l\225\322\204yi\226h\026\307\255\261p\t"
+	.ascii	"dY=\fdW\2174\355\335D\007\265\316\006\317\303\306Q\240\345\367"
+	.ascii	"m\305\b\210\022\217&\227\276\304\265\242\272\215jV\252)\216\030"
+	.ascii	"1\226%\004\246\370\364h\312\252S\r\3352\236\016\356\210o*\351"
+	.ascii	"\020E\221\275e\240\013\026l \275/\032r#\367\035\\j\236\317|\024"
+	.ascii	"\224G$]\371\"!\2048\313\036\223\200\006Ym*Y\324\013\364\324\316"
+	.ascii	"\304\222[`\327\3648\023j\346\311\204\021rj\206\256\314\324\374"
+	.ascii	"0\025\006\032\315\f\340\1771\030\"Th\325kR%$\025`\351\360=\201"
+	.ascii	")\b+\312\274>\202\023p\260\335|Qy\201\322Au\255\246ojY>\226\375"
+	.ascii	"\240\256\024]\213_}9A6\350\365\356\016\001\263@p\234%s\344\311"
+	.ascii	"&\3151\271$\017)^\034\235\211\200WK\227\232\320\307P}\216@\335"
+	.ascii	"\250\276\231\222\227*X\245+tI5\3514\220\016\266\374_\243\257"
+	.ascii	"DJ\244\307I[\220x_Jz\211\276\253\340\230\327\235tV\216\377\002"
+	.ascii	"\322\001\005\367\365W\306%c\203r\203\361\377\270\374\2668\266"
+	.ascii	"\204\315P\334\276\354\252\371\321\335\301\354\363{\202\354o7"
+	.ascii	"o\206\030\352\b\027r\351^\344C\247\340\370\216W\222\207\325%"
+	.ascii	"\272\033\353\203/\007\361V\231\231-\007\361\306I\037\306\351"
+	.ascii	"-\344\257\341\024\335\215\337\335\331\025\037\244\257\002"
+	.text
+	.section	.gnu.lto_.symtab.b70030dd64d54b96,"e",@progbits
+	.string	"crc16_ccitt"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343"
+	.string	""
+	.string	""
+	.string	"crc16_ccitt_update"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351"
+	.string	""
+	.string	""
+	.string	"crc16_ccitt_sbuf_append"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361"
+	.string	""
+	.string	""
+	.string	"crc8_dvb_s2"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366"
+	.string	""
+	.string	""
+	.string	"crc8_dvb_s2_update"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374"
+	.string	""
+	.string	""
+	.string	"crc8_dvb_s2_sbuf_append"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376"
+	.string	""
+	.string	""
+	.string	"crc8_xor_update"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"crc8_xor_sbuf_append"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\001"
+	.string	""
+	.string	"sbufWriteU16"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\001"
+	.string	""
+	.string	"sbufPtr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\001"
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.b70030dd64d54b96,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,242 @@
+	.file	"encoding.c"
+	.section	.gnu.lto_.profile.6d1fa1848847d0c9,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.6d1fa1848847d0c9,"e",@progbits
+	.string	"(\265/\375 #\375"
+	.string	""
+	.string	"\310\027"
+	.string	"\003"
+	.string	"\350\335\352\372\n"
+	.string	"\001\277\261\216\273\n"
+	.string	"\002\241\277\301\240\007"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.6d1fa1848847d0c9,"e",@progbits
+	.string	"(\265/\375 #\315"
+	.string	""
+	.string	"x\027"
+	.string	"\003"
+	.string	"\001\003\001\002\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\003"
+	.string	"*\203_\302\330"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.6d1fa1848847d0c9,"e",@progbits
+	.string	"(\265/\375 \243\345\002"
+	.string	"\204\003\227"
+	.string	"\003"
+	.string	""
+	.string	"\003\200\200\200\200\002d\001"
+	.string	"\001"
+	.string	"\001\002\002"
+	.string	""
+	.string	"\201\200\200\200~"
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"\001\300\002e\001\003d"
+	.string	"\004\002"
+	.string	"\007\003\002\b\002e"
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016"
+	.string	" \020"
+	.ascii	"\016\2533$\254\303jeVB\200\007!\214\353\324\214\23176\355\365"
+	.ascii	"9\036\317\2606\200\005"
+	.text
+	.section	.gnu.lto_.jmpfuncs.6d1fa1848847d0c9,"e",@progbits
+	.string	"(\265/\375 #\345"
+	.string	""
+	.string	"\240\027"
+	.string	"\003"
+	.string	"\001\001\003\177\002"
+	.string	"\001\001\002\001\001\003\177\002\002"
+	.string	"\002"
+	.string	"*\342l"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.pureconst.6d1fa1848847d0c9,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\200\004\001\200\004\002\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.6d1fa1848847d0c9,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.6d1fa1848847d0c9,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_castFloatBytesToInt.0.6d1fa1848847d0c9,"e",@progbits
+	.string	"(\265/\375`\017"
+	.string	"e\007"
+	.string	"\222N45Po\322\001 ;\263Z\017\345W\365\332e\320\0336\001.W`\366\020\025ICm6 \342\236\334\244\241\230\231!\210\206\265m\303\347\240\302%\373f\311\336r\247\024\0167\305y\260<\r\222\262:\321\222U%\251hy\030\252H]\021\221C`\t\321\271\242\204\224W\314\314\375[\025\251~K\3312\245\360\347\004\002fw\025T5\030 +\231+\331\023\344T\303\376[\025\331\352\254\037\375\356\301\217"
+	.string	"\322\256E\251e7\210\322a\373cgl;\367\221M\f\260\253Rr\262\273\033k0\207\266\375\220\213|\214\275\311\241%dT\220\260\354\316X\360\201\351\360]`:\324\215cw\230\377\221\037d\244\220\006\272\273,\354\256]H\273\270\365\266\rlol{\004\b"
+	.string	"2\241k\037\030"
+	.ascii	"\023\236k\370\r\013W\207p\001Pi:\355$\003"
+	.text
+	.section	.gnu.lto_zigzagEncode.1.6d1fa1848847d0c9,"e",@progbits
+	.string	"(\265/\375`A"
+	.string	"\255\b"
+	.string	"\266P<6@\255\322\0018\353w!\001\353\207\"\377\337\030E{\242o;\331\006!\245\006\250\252}\263\346lDNZ\326\f\303\210\35166\227\2639\220<ls\r\355-eJ\001,"
+	.string	","
+	.string	"+"
+	.string	"\t\253\223G\312\356\0063\027\250\374\271c*\177\232q\321S\344\277\365\202\016\024Tj\364\264(\354\256\023\225\252\270\365\266\rl#\330\026\tNM\337b9\301\224\354R\304^;\362@6l\207\354\213\355\314\263&\034\260{\321\372\330\335\003k"
+	.string	"\376l\373\034_\205,r\233F*w\235`\244\2149\325\271N\026\004wH\305i\352#1\3014wzU\023\323\253\2241{\033\245b\330w\253*\277\263~\247i\325\f\235\210\006\216\304s\266a\320<\0131\323:P\213\237O\314\240\346\341|`\006z\200\233\001G\207\016\bB\304\b\202\227m\357VUO3$-Y\365i\f"
+	.ascii	"2\241\307\037\230\313\004#*4\232\361\307\f\3135\034c\002\227"
+	.ascii	"j<:\204\003~\246\351\264\223\f"
+	.text
+	.section	.gnu.lto_zigzagDecode.2.6d1fa1848847d0c9,"e",@progbits
+	.string	"(\265/\375`f"
+	.string	"m\t"
+	.string	"\246\322A8@\305(\035\355\345n3\006\265T\177c\323\031v\260\216\350\357\222Jf\202\347Mm\257\376{F\371 \330\223\237\211\242(\206CD\2402\351Ay\334\321^#\261{K\231R2"
+	.string	"."
+	.string	"/"
+	.string	"\035\"\217\340\247\221J"
+	.string	"\361>"
+	.string	"\354\256\226\371@\345\021^\240\362\250\031\037=G\376Y/\360HA\245HOLaw\235\250\024\305\255\267m`\033\301>\f\230\323\361\253\037\302\264\302tj\372\026\013\n\246dw\342\025`G\242\310\206m\221}\261\235\371U\310\226\335\013V\310\356w`M\366h\333\347x\231:SUa\353d\202i\352Y\307\234x\256R\276\374\207*P1uz\026\232C\275j\353\3442\345\313\376H\251\030\366\341\252\312\206\351L\323\001\235\210\006\216D\364\266a\340<\013\335\306u4\256\373|\272M\343<\234\217\266\201\036\264\r\201;\207\016H\203\350:\220v\371\366pU\0255SR\2233U\215\001$^\205I\003\r"
+	.string	"2\241\021(\360\364E\002\241\225\n\332\347\360e\306\0303"
+	.ascii	"\327\304\001Yl:\004\t\374\314\330i\347\023"
+	.text
+	.section	.gnu.lto_.symbol_nodes.6d1fa1848847d0c9,"e",@progbits
+	.string	"(\265/\375 Ne\001"
+	.string	"\024\002J"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\177\003\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\001\177\004\002\177\005"
+	.string	"\003"
+	.ascii	"\200\036\340\207k\3151"
+	.text
+	.section	.gnu.lto_.refs.6d1fa1848847d0c9,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.6d1fa1848847d0c9,"e",@progbits
+	.string	"(\265/\375`R\003\275\031"
+	.string	"\226\360\253J\260\226m:d\2061\2765\344V\275#\341G\360\b\026s[\246\016\217\264S\337\036\022\375x\340\272Xe\343\342##\325\237\277\026\027t\347P\342\221W~\370\346\245\347\225'H\013c\2542\245S\215\300s\324{\216}3Y\"e\215"
+	.string	"\217"
+	.string	"\220"
+	.string	"L\353\321\205\324\261\357\020\372\243O\245\246]G\245\017m\261G'\f-\336\327Gz\355$W/\251-\231*[f\344\274\217q,\267\013l\271\300\036\322\270Nb\251.\302\255\266\022\313\224\352\327\377\2556z2\032y\337M\023"
+	.string	"\277\036"
+	.ascii	"\262\313r\023\341\326\224_\002{\326\304\377\263\232\245\300\030"
+	.ascii	"\346\316\301\314\035j03\203\217\271\211\2309\212\231\237\230"
+	.ascii	"\331\211\231\227\230Y\211\231903\310\314P\230\371\333\355v;f"
+	.ascii	"&\301\314?\230W\t\002\351x5\035\255\372\363\345I\324\346\226"
+	.ascii	"\351y\327\364\354\273\336|I\232\002\356\321\363k\232\245\257"
+	.ascii	"\232\232wEO\233\273Tu\"IQE\324\347-\337\302v#\315\032\335U\321"
+	.ascii	"O\375\235\013\272\271\340\277\241\346\024I\324Mj\272\0265%$\332"
+	.ascii	"\352\177\003\266\332\r\364\245\356\"\241?RM\304m\021FUw\243\326"
+	.ascii	"\2158n\037\n\372\017\\\375m\377\330\327\375\037\377\263\314\233"
+	.ascii	"\372\307\250\271G6\333_T\300\366\333\b\025\364{\271+M\316\273"
+	.ascii	"\336@aP\001F@+H6\204\274\217\373f\271\221t\216\273\251\223\272"
+	.ascii	"\251\235\270"
+	.string	"\346\177\355\247\021\003\264\261\023\222\352\362\242\233Kf\207\227*M^\022n'\346\007\022\232\211\346\307\375G\320ABra\274\217\271\310\364\017&A\222x\037\177\260\0363x\322\374\377\"F\275Y\243\001\231\233;\246\333\305\034\240W\275\340+f\016\200\364\017QQY\037O\244\f\357c\346\233\263\356v%\1775=\313\224\310\346\256\367n\024\3624\237\2166\367?\355%\377\025\375y\327\2373ka\b1\026^\b1\364\360\240\350\221\241\240\341\004,\222\b\177^4Q\374y\315\320f\033\304\016@!\355D\005\032\2178\"\003\r\210'6\200c\262\237p\026\366X\216\220\323 G\307\004\213uvpvp@\326\331\201\301vr`\226s`\253\022\226\006\342\001\004\332L\306\342\t\023,\334x\340\240\301\306\034\364\314d!\304\330,|\315D\037\0371\366\232\311x|^\261\037\240\227\003\004\f\005\325Q]D\241\207\022,"
+	.ascii	"p+\250\2508\341\2162\322\222\032\302\242\013\223\024\027_\252"
+	.ascii	"\214\226,\351'\253*\300\t}\001\002\252\3401\226L\270\237f`\340"
+	.ascii	"t\200\351: \220\002\2311\\\007@)\"\267\316\370\207\231\240y\227"
+	.ascii	"E\206$|\233\336\364\215\024W\322\216\325\311b<\241\301\211\372"
+	.ascii	"[^z\201(Z\306\2776\300\322%\333\221\205\365\210\030y\232\245"
+	.ascii	"\244 0\024\302<\bn\257@ZS\326d\021\235\002\341\253'\333V\266"
+	.ascii	">iW`;K\265\334\316\272\253j\347o\013\224\037(\025OC\307[\311"
+	.ascii	"W\354\265\364]\230/L-\fZ\340\331\357c\341\335\002\313\320u,\344"
+	.ascii	"\306\024\n"
+	.text
+	.section	.gnu.lto_.symtab.6d1fa1848847d0c9,"e",@progbits
+	.string	"castFloatBytesToInt"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313"
+	.string	""
+	.string	""
+	.string	"zigzagEncode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317"
+	.string	""
+	.string	""
+	.string	"zigzagDecode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.6d1fa1848847d0c9,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1871 @@
+	.file	"filter.c"
+	.section	.gnu.lto_.profile.119dd381cbddb993,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\n"
+	.text
+	.section	.gnu.lto_.icf.119dd381cbddb993,"e",@progbits
+	.string	"(\265/\375`\375\003\275\020"
+	.string	"\264\026\361\004"
+	.string	"'"
+	.string	"\257\347\272\006\024\002"
+	.string	"\002\001\002"
+	.string	"\002\002\001\203\255\266\373\b"
+	.string	"\002\237\336\232\313\006\003\003\263\311\277\326\001\006\002"
+	.string	"\002\003\004\211\337\230\303\004\005\217\364\362\333\n\020\006\241\236\345\333\017"
+	.string	"\007\206\223\232\231\013\022\002"
+	.string	"\002\005\b\311\276\204\302\004"
+	.string	"\t\245\233\254\343\013\020\n\316\371\272\301\002\006\007\007\002\007\013\302\265\230\372\n\032\f\243\352\335\360\007\r\242\233\2154\016\002\b\002\t\002\n\002\t\002\013"
+	.string	"\n\002\t\016\342\377\371\206\002\017\322\342\227\340\n\f"
+	.string	"\002"
+	.string	"\n\002\t\020\364\213\236\231\b\030\b"
+	.string	"\021\370\233\266\355\004\026\002\n\002\f\002\013\002\f\002\r\002\r\002\b\002\f\002\016\002\016\022\307\252\331\263\003\023\346\306\223\235\b\n\024\226\255\246\372\017\025\367\252\201\351\t\b\026\235\315\304\313\t\002\002\017\002\020\027\302\324\276\264\013\026\002"
+	.string	"\002\020\017"
+	.string	"\030\210\207\310B\n\031\326\333\333\276\002\f\002"
+	.string	"\002\021\032\273\256\340\205\033\341\335\255k\022\002"
+	.string	"\002\022\034\222\237\264\265\f\n"
+	.string	"\035\371\224\357\253\006\002\036\356\216\2753\037\251\261\353\256\r\007\007\002\007 \323\216\201\256\007\026\002\007\002\007!\223\346\233\247\f\034\002"
+	.string	"\002\023\002\023\002\"\221\276\232\276\f\036"
+	.string	"#\301\205\244\231\006\026"
+	.string	"$\276\352\335\257\017\024%\232\213\217\365\001\026"
+	.string	""
+	.string	"&\240\342\234\212\n"
+	.string	"G\2501\261\300\020\305\030\ti\232\264\032`\202bU\305\r\022"
+	.ascii	"3\031\017R\004\2122\314\030#\244FTf&\230(\343\026\003o\335\301"
+	.ascii	"a{|\205\r\004\343-\377c8\247\363\310\031\3054\372\367\013m\227"
+	.ascii	"\300\023/\n\256i\333\204t\343i\232!`Q\362s\"\025\243\231\226"
+	.ascii	"\227g.s\254\013\345*\231\250\\\363\233\3313\354C\022Q\236i\035"
+	.ascii	"|v\006#\376\t\035\332A\345*7\323F\027\007\001\013L\177\203_0"
+	.ascii	"\244y\2739\233C\214\016J\221\3419\371[9\"q\"\256\257\367t\235"
+	.ascii	"E\36431\231=\366\361A\307\227\276\345\013"
+	.text
+	.section	.gnu.lto_.ipa_sra.119dd381cbddb993,"e",@progbits
+	.string	"(\265/\375`\227\002\325\t"
+	.string	"\342L#!`k\222\016\300\322\017\3030\f\3030\200$I\222$I\365\357\032\021\311\354\177\373M,\331{\313$\003\204\330\036\034\032&7d\033Y\246\305\360YPH\022\222\346~\b\367\300\240\200\340\201\310\274\230z\251s\351\027K,\323\016\251\243$\253@Yl@Y\204\031\262\350\322\021R\332\350\210\250\216\336"
+	.string	"M\367a\016^_\203Q\n\237\213I\233\254\371%\t9\371$\243\371V0\261\220I\364\251hzY~\316\212dk\262u\317\215e\004k\"W\250q5VS\233ba;\220\202\031B\242\007\021\300$\245@\272ZXP(\264\006a\326Q\253mH\373&V\274\254\306\270\033E\226\016\351k\256\025h\240\206\2134k\002~\216\032\027\031\333+\\\251\242%IM6\366\262\365\272\020\240\363\233X\232Z\002\352\251Kb\030\303h\253\370)\3120z"
+	.ascii	"f\356\364\351\301@\356\223\257\372\177\001\210\305rJ\344\007"
+	.ascii	"\350Z\350u\256Yk6\004G.\300Z.b\334\020\017\320C\232ilD\311y^"
+	.ascii	"Qh2\371\213#MOR*J\302rF`\355j\314\003QR\"\021\366X4'\224\001"
+	.text
+	.section	.gnu.lto_.inline.119dd381cbddb993,"e",@progbits
+	.string	"(\265/\375`\035\021e2"
+	.string	"\226\370\265H\300\026U:\222\031\276\305\030,\250\314\210\241\355\r\017\021\274\b=\265\177\364cTO\031\003\373\213Y\3505\222\3716\213p\033\371\366\276\246\351.\byM"
+	.string	" \263[\300\202\307\202\364\363\276o\217\202\212\025M\311 dK\271S\214"
+	.string	"\242"
+	.string	"\256"
+	.string	"\266\325\t\351\247\332\371\225\351n\323\301\005'K\227\321\213_\361Ka/\372\214\303\207'qL\215t7\350\227\261.\004\343\032\313t\343N\377\376sy\222i[R\326g\333\245\223\3730\374\322\323o\370\317\217?\237\317\265\224\263\210\276\266\274\356\246ew\243\374\262I\377\247v\356\177\324\316\271g\033\347\272;\374\202\377\206\356\306\375\263\355\356\346\371\307r\374_\205\356\327\266@j\355\021\377\027fQ\353\222\325\376\f\263Cj\355Q\375\007\016\200\024:*\340\tz\242\303\311\3250\001\006C\300:\271\313\252\317.\307\260\024\r\370I\265\330\335\375E\371\001\273\373\273\375\235?\345\354\3310\230\203\227\350\344\266\276\355\362\tR=\364X\216\364\375\264\271\002\326\366\005\221\026O@\267\265i\234\214\350\257\2608\0327B"
+	.string	"\357\331\302\252Pb\002G\213\0134\216\242l\322\266A\337\346\225:\322S\346\037\313\255\200\266\315\205\364\224\3342\224q\213\027\311\355\331\247\211w\031O.m\345\207Y\016\335\215Zm\200\2353\002\270Z\f\024<\3030Mw\277\216\362Xnr,\367o.-\016?D\354ZG\261.\374T/\333\343t\3415\236\312b\306/\2450\037\212\017e+\2126\272\tc\2626\303\224"
+	.string	"\262\026\303\277\034\2462\234(\2374'^\t\366\230\361\264\215\201\243\303\207I\246\271Qbf^\364\260c\236z"
+	.string	"{98+N!\324\215\220\236\013\032\245\263p\007"
+	.string	"\247\3630Xmcvjl\354\305\247\330\251\2511\037~\351\215A\324\314`\362\022\215TnL\246\235\377\3167>\222b\007\307u\322?\333\34557\364\323B\342'\r\1776hD\374gt\366\361\312i\303G\241>\372\312h\306rT\345\2371\357\374\264m\277\365<(R+\317\201\267\324x\027\242\326^\352C\255>\246\273v\2656A\322\200D\255<-7`\343]\255=\226\377\2663\265\366@\270-\217Zw\022\274"
+	.ascii	"l,]\2669<AP,e\336Mw3\b\235\3704\356\227D\305\021\031\nN\200\352"
+	.ascii	"\230\307\377\234\347\227\224k\004A\3235@\300c\271\371\271\234"
+	.ascii	"\303\325\372_ke\222\002\244\326%\255}\210Z}X\316\252\2656\t\177"
+	.ascii	"\033\317\324\332\0239\031=\300\017\210\0133J\372\347O_\211\345"
+	.ascii	"\307\377\262\350*\252S\351\244\\\270\324\311\365\241\223\323"
+	.ascii	"3\372m[\363C\304n\005\372\310o\005\201\232\250Q9chdD$IA\222\341"
+	.ascii	"\301\004\004\021\204\240\265\362\006\022\240S5F\264\024\221\021"
+	.ascii	"\031\221@$\020\021IQAARi\r\376\361\232g\3758\327\362i\243%L\344"
+	.ascii	"k9]n<2s\321\323\333\211\t$\341hw\320_\036\216\013R7<\r\311q\216"
+	.ascii	"\301\372\257yE\243\371}\2756lt\t+\347\271d"
+	.string	":\025\317\375<0\212\222.\023\326\275\360\212\251l\270\016\001\351\257\334\356\306oC\273\016MA\026\232\316\220t\212\270-\333\277k\"\f\306U\037\306\240\346'\337\251\217\220\221&j\264tI.&\251\024r*z\354\3436\254\243\275d\227\"\214l-H\374\321\352s\033\334\244\035\303\277]4'\356 :\337\203\345G\322\312k\200<\020<t\216\310\255\f\323\202@`\321\323\333L.\323C\346\3134P\f\023\300\323=\037\023\036\200\356M\371\341kU\372\3371\310\340uS\b\232~\376V!\020C\322\032\257\021\016\340\353\206O\tEW\277QO&\023\276\355 \016\201\323\200\375%wF\311?\024L\263s?\351\357\3505L=z\34698P*B\334\301\251\310\315\262n\033\327\212L\247U\205\362\304\366\2248'2\037j\027\025\233\244G}\221G\005\"\244F3z8\334\311\216\210\214\265\204r\254\3306\222k"
+	.ascii	"\305\0042@)X0\214pf0\273\f\256@\362\364S\262\204j\260\255<\326"
+	.ascii	"\347\234\017\336_\371\032\206Sh(\203:]\230U\037\343\005\0362"
+	.ascii	"K\235\361\227\2276\312\210;\203\266\357K\267\230\260%*\227\247"
+	.ascii	"\3564\275\023\025x\246X\362\200k\361\2473\210\031\232f\316\266"
+	.ascii	"\033AF\206\030\271\216\207X\nO\007\376\267\222\013H\245\241\303"
+	.ascii	"\337\0243\351LK9ox\341\b\237\255\374\326\fJ\024\315*`\232\376"
+	.ascii	"\365"
+	.string	"\216\250\rR?\216\312\372\t_~\202\033\201\340N\301\217;\3446l+q\315p$P\323Qg\323\301\321\016\340\222Z\346\211\005$s\260P\214g\334\270\306:\311S\336<\0038k\267\304m$y\033i\251u\226Ei\255\"h\021\331C\364BZ\227\206U\272\262k\007\f\244;\2475\253\234\234b\246~z2\023\211ok@\026\336\333\212\346k\332\250j_\345\335\311\030\320\3471d\230@\277\355fI*\354\267,\210%\006gqA\001\232?XS\245\270$\002\001\023\371\236O\361\374\202L\003i\360\334\362V\232\331\026a\372\354\177D\326\311\262\251\352\002\234q6\271><\335\016\004l\230\377\330\265C]:\317\377.\276np\363\314L\020(\232\206\270\327\257\002m\222$\330]B\316\032\276\347%TOX\237\246\364\320&\277=\3173E \365\222\320\226\343\217\002\276\355\034\2678\266t\276\226\314\243\264\346\372"
+	.string	"'\344\265\020\326\374\263Z!]\027S\356,3\016\332\200a"
+	.ascii	"d$\302\246\370\325\327\247y\254]'\323\030@\255\314\246m\251\001"
+	.ascii	"\203`\342\336\013Em\250kp\274\246\371\244\031\274j\362\247\313"
+	.ascii	"aU\301D\225c\206Bv\363\360r\237\252\344J\204uC\2026\021% \363"
+	.ascii	"\226hQT\364\353\362\207\261\305\254K\225\370\027\271j\247D\n"
+	.ascii	"\202\323\204\020\255\320V\347\244\373\300W{\004[\013\264q\305"
+	.ascii	"\241\233\273\231\024\206.\327\320\004"
+	.text
+	.section	.gnu.lto_.jmpfuncs.119dd381cbddb993,"e",@progbits
+	.string	"(\265/\375`\245\004\315\020"
+	.string	"&\226D5`I\224\016"
+	.string	"Q\027\f\202"
+	.string	"<\325V\365\013\025\01709"
+	.string	"\307\036w"
+	.string	"\b\202@\301RB\324\037u\263X\3557\220O6a\337\376o\b\021\366#\262\267\334)\245/"
+	.string	"7"
+	.string	"9"
+	.string	"\224k\357\371\236\210\357\311\330{NO\366\314\330f\177O\312+\331w\313\341\270\026\334[\027\360\333<zj\364\270n\242\363\373\347\302~\t\264-\b\256n\367l\035\005&\262DI\266\006\211\326\b\334\037l\"\\\350\342\272\256\253OLTT\367\273\333\215a\220T\355\031]n\321k\b>\366c\253E\005\226\265\271\034\251g\355\275\211\201\030\310Q\214g\006\"\002\231\236\322\373\300;\244\227\331\r\306{&\026\256`S\260\361!\n\325Q\310nzZ\372L8H\r\026\264YZ\343l\215\273\233\340\212\312\003\355\0232"
+	.ascii	"\"\340\322\347\003\274\347\343\235<\017\240!\373$#\016lg\261"
+	.ascii	"\365\336\317\305\007\374\333@\245\265\004c(\356\330\023\214\277"
+	.ascii	"\033\203I\237\216\210\347\250$\357\331\240^x\250\001M\306\230"
+	.ascii	"\315\244\240P\3309`\002!Ce\346\001\022 s\001\013ZJH\0021IQ\n"
+	.ascii	"\353w\315P\023B\264\035\030F^\374\230\221\217.\250\241'[\261"
+	.ascii	">\323r\327\257\220H\321\n\037\023\342P\211)\224\373Z\235\030"
+	.ascii	"\203\250\220\270H;\007\001h3\260GK\027$t\354\b\3209\034B \003"
+	.ascii	"\344\332lo%\310\002\\\370Y\037\004[\"!\272\037\013\302y\346\263"
+	.ascii	"\243-\224\nD\362b\344\336`8\240\320\274\215\030X\346\305\020"
+	.ascii	"\022\312?\322\374\213\251.\033L\226\272\2171,\025\300\007\032"
+	.ascii	"\305%q\b\247\330\210\037\004\207I}\224\230\264\315\215\264\340"
+	.ascii	"\030\013\024\256\257\016\202\b=\351X\262\262\313\211\2202\206"
+	.ascii	"9-\360>\230\342\302\201\366\223\0266!\235:\0065\273\251x\013"
+	.ascii	"i1ZgfD\035\030\257\017O\207\034 \224\324Ld\031M\356s)\260a\036"
+	.ascii	"-\205\271\354\246\017\224\366\t\331\221^\037r.\004h\002"
+	.text
+	.section	.gnu.lto_.pureconst.119dd381cbddb993,"e",@progbits
+	.string	"(\265/\375 w\315\002"
+	.string	"rG\025\032`\3310\0064\\\224\323\207 \b\202 \210dfffffff&7\0322>r\221\207\034\344\037\367x\035\217\343m\\\343\031\307\370\305-^q\2126\321$Z\304!\332\303\035\336p\206/\\\341\tG\370\3013x\301\211\340\003\327\005\036p\002x\221\252\252\024"
+	.text
+	.section	.gnu.lto_.ipa_modref.119dd381cbddb993,"e",@progbits
+	.string	"(\265/\375`\001\006-\023"
+	.string	"\026XH7`K\222t\235\206\b\347\032\206\265\376B\201G\263\f\006\346\320\343ZT\025\004\017\034\003\231j\037\035\277\177l\266\375O\313\212N\213\215\023\323\242\037E\335lk\255I\231\0024"
+	.string	":"
+	.string	":"
+	.string	"?\251&\314F\233\257\256\252{\302|w\2731t\371\356\356N*+Ko\311|\330X\0332n\326<*\247('\273'y\244|\242\374!N\245O;\357\204\b\214\372<d\025\355\317\303\214\371\323\226"
+	.string	"\363\240\300\306\306u\273\336s\231+$n\254\006\224M\002\276\335\246n\be\200\271\270\310\270\216l\202\032"
+	.string	"\322\210\266\030\210\345\371\262\251q\004\223\221\035}7I#\352\256\346\335\"\001;\210X\0328,I\271E\344A\360{`#dF}t\312\216\205\321\003\006\376\031\351C\242\3202\245\313\217\301\002S(\\P\243\005\372\t[\270\220\241Bs\271\254{\346bz\352b\362\313\261\244\233\325\251\031QL\225O(!\314\304N\305\271\007\222\206\003I\243-\366\215d.\026j\203\247$\224\013\203\333\215k\301-\202\202\200\231\250\021AH\325\210\246\222e7p\002\021*3z\022"
+	.string	"4-\210\222\020v\fI\315\202\226\324\310\376\006\244\321\242\314\205\262\031\365\337fY\376\352\301\001\330cE\203"
+	.string	"\320\0018\204\341\036"
+	.ascii	"N\2350\031c\376y)\355]U:(\"\314t\013\347pC\231\267+%\365\"\211"
+	.ascii	"\355\250i\343\213\227\201\026E\322\001'}\342\270\n2\367\202J"
+	.ascii	"\f{G:\325$ u\236\024\261!d\033\357\234tp\226Lcb\211\n\305a\204"
+	.ascii	"\363G2?\361\247 B\212\201~\027\246\271s\346\216`\020\230t?y#"
+	.ascii	"\251\032\211\013\3410\211#\336\236\373)\206\337F<<\217\345\304"
+	.ascii	"^ir\234\320\030\246'\337\366=:}\313E_{\312\032*\371\263\246\371"
+	.ascii	"\021z4G\016\314J\036\001\n\3130\267\245r\330\344w#\242\031\017"
+	.ascii	"qF\323\341Nx\270\357*\236\2305l\374[\262:\332\002\237\321\201"
+	.ascii	"\234\222\020\326c\373yM8\227A\275D\223\007\032\311\b\013\370"
+	.ascii	"\036\f\2151\314\342\317\030\005\031\206F\314\236F\031\301\027"
+	.ascii	")\235\220\022\311\207X\017\313G\201L\373T\235$\0069\031\244\033"
+	.ascii	"BX\357hw\311m\220?\t^\331\312\031"
+	.text
+	.section	.gnu.lto_.lto.119dd381cbddb993,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_nullFilterApply.5.119dd381cbddb993,"e",@progbits
+	.string	"(\265/\375`)"
+	.string	"\255\007"
+	.string	"\022\01756@o\222\016\230.|\362D\200\200\3041\2621\267\272\377\037\260:X\2326j\374\3218VC\353\343\340\354d\024Eg\250\326H\b\304\031\365\250\346\\\026\265\326\b\221)\"\211\020\310c]s6ZG\004\341y\200\240\354\363\3118\020\344q\370@\216\026\0017\006g\241\216\006EY\246A\354?f\237\351\227\241x\025\037G\356i|\253|\246\357\251\355\303,\bX21^\\R\305B\361\370\267\307~\347z\032u@f\312J*35/\324}C*\2625NT \323d\222\312\214\232\0230\265\216\230\377~\024d{T\0259:\024N.JZ2\023fZp\325\252:p\325z\033\335\352\266\333\221\036\220\274\220J\243:\200\206\314\334\221J\031\375\365G\370\031\376S\013"
+	.ascii	"o\031E\347d\255\302q\r\237f1@\026d%$\020(\313\240\t#%\245sM2"
+	.text
+	.section	.gnu.lto_pt1FilterInit.6.119dd381cbddb993,"e",@progbits
+	.string	"(\265/\375`\f\0015\r"
+	.string	"\246\032\\B\020\221\223\016\370qU\020\017I\320!\257Z\035hi&LjXp\231\003\247C*\373\252\330\322\202\375\251\214\200^/\302\233\033\204\b\240\020"
+	.string	"`\357\360|H\224\f\"\253K\244P0c\t!{\313\235RG"
+	.string	"H"
+	.string	"G"
+	.ascii	"\371\303\3308\340\327\332\204Ol\216Y1\200\237\304b\346\347DZ"
+	.ascii	"\340r,g\220\312\361r\200\312\261[{C@\006\217\032\027"
+	.string	"\025:\376c\031\302\233\337V\333d\316\350\205\305\317z\360\277o\364\262\301M\267\ri\333\240u\207\234\035\341+\204\257\t__\276\272\363\301\001$\307\257\241K\035\025_\214p\311nmS;mK=\301\2570\211\0223l\376\033p,\203\013\242p\212\3152=\225\363\313\270\231\371/\322\005\227#\001\230\257E\220`3w\241\00182\255\204\371h\210h\254\2542\323\002a\022\301\274\354\311\036R(\324\353\240\353R\030\376PH\225\256\021\321\264\274\256\316\227\026\331\304t\306\030\235\313M\350u-\307\362\362Ck\370\377MR\353\030\233c\031\333r\311\255\034\020\"<\t\025\036H%\233P\022\253f#\037\022\320\211I\t\206\242y<Z\206\241\230P\360`\331'\005\033\031P\315\002\311\007\003i\332\007\353p7|\222\032a\240B\331R\230m\212]\364t\375WP\2678Q\371\250\361\337\"\034\353\225\312\321;F\001\024"
+	.ascii	"i\23123\236\322pe[h'D\227\031\336h\240\211p\003L\013\024\327"
+	.ascii	"\304\220\271\206Qb:\334\r\330\200& \001/\230\033\240\242\204"
+	.ascii	";\274h'\031"
+	.text
+	.section	.gnu.lto_pt1FilterApply.7.119dd381cbddb993,"e",@progbits
+	.string	"(\265/\375`\336"
+	.string	"}\013"
+	.string	"\366\325M@0k\225\016hm\376&\236\255\017A\317\344\231\271\365M\024s\035\336O\222\222R\201\307\207\223\212\032V\3020\213\023lE)\364DDD`0\034_\207|Xl6\354\240\215\301\264\310'\233H\231R:"
+	.string	"9"
+	.string	";"
+	.string	"\217\0067\333>\2037\370lW\006\032Pih\030iy\330]\016\343\025\332cv\n\355Q\013\374{~\376\037\274B\240\303\t5zJ:v\327yB\005\270\365\266+\2661\366C\001\216\231\3162\255\231\316L_\202\302\301\302\302.\200\020\304\306\"\005\004\266?{b;\363,\273\034\261[!\303kw-\336x\332_\335\301wP\364\211\335\324\204\327.hq\306\026\232i\faRP\312\320\327MU%-S\202\022\350\021R-\030\034:\004\2730~\313#\262\355\356U\"\355\361\312\261\340\303\212\224\241\r\216R\007\330\317VS\366Y\377v\360\227d\006\037\220\247\263\211\2323\027O\363\001\331|p\235\216\303\3512\\g\343\301\3412^\bw\271p\347\321x\334\247\353<n\002\356\355\250?"
+	.string	"\213\221\264\344\250\022(\027`\247\r\244\f\235\3515j\0063\tP\315\025"
+	.ascii	"i\231\"34\030!hB!\270qp\334\t\264\212\031\003\\\256(\232\231"
+	.ascii	"\302\322\262\224`\354r\r\247\246\005\004Y8\225\220K\240\314A"
+	.ascii	"\273FJJ\347\232d"
+	.text
+	.section	.gnu.lto_slewFilterInit.8.119dd381cbddb993,"e",@progbits
+	.string	"(\265/\375`\321"
+	.string	"5\013"
+	.string	"v\024LC \2138\035\300+\313b00)\3422|\235J\350\277\177\032\004\032\224\323\"\230"
+	.string	"\022\032\023\036!\266)0\245\324 \030\t\241l9\200\344\030\025F\243Q\353\205q\227\006\"\306\004\016DtRP#{\247\0246"
+	.string	";"
+	.string	"8"
+	.string	"\273\244\305\032\3321\223\257\310\216i\247\310\216y\2645\\\b\200\340@"
+	.string	"\305\332\335J\025|\374\034\375\243\276\211F\237\317\007\217\335\365\024\215\016\334\364\266+\266?\354\213\004\245\177j\230\001\026\027v\r\264:\354\n\253\300\300\366)\366\311\345%\261\005B\242\216I>\302x\223Ko\273\0262\250v\327b\214v,\343\372\264\357\340\017\306\227<\237\330%\245T\001\247\260\341\242\366\311S\025B\003\004\245\355Y\261;\237\340R\333]\016_B"
+	.string	""
+	.string	"\021\030\026x\262c\033%\026\0134[6\371\2314\201\375kw\327\224d\377\364g7\375\327\003$\233O\023r\240F\334\304\316\353B:\334&\3342g. 'n\272\222\312\371<\357\313TN7\342\325\f\030\326\013\206?\023\016\254\342\367\201\225B\356\257\245$\203\214V \032rF\3550\024"
+	.ascii	"i\231\"\023\357\306\321\342\202\n\2528J0L=Ij\017\267\255\320"
+	.ascii	"1\253\212\013\357\200\031\016\030\031tD\tq\0031\300\025ijJ\270"
+	.ascii	"\303\213v\222\001"
+	.text
+	.section	.gnu.lto_slewFilterApply.9.119dd381cbddb993,"e",@progbits
+	.string	"(\265/\375`\274\002=\021"
+	.string	"\026^iE"
+	.string	"\217*\035@\326\030\232\251\270\237Ap\265\303-\330\361\200(\302Njp\324\372pR\277\033\177\304\035_\250\207e\023\334\201R\201\357\357\362%\375\377\377S\177m>|Sy\030!\343\367\342\341@d\357\275\245\224)W"
+	.string	"N"
+	.string	"W"
+	.string	"\360\343\200\"K\247\023\226\030\335\335m\224Cj\204*@j\344\r:\322\3146e\204\274\243\353\344@\030U\355\204\"ifr\266y\262\262\202ic\201\f)\225B\026\024T\034\312dy\003\025\001n\272[]\272\022P\245\335\311\351\356\357\t\225\322k\350\177\r\377?\376=\021\372\251j\354~\356^\356>\356\036\356\236w\277\273W"
+	.ascii	"R\266b\300\254{BmF\253\210/\036\376\217~\356\377\256\256<\366"
+	.ascii	"L7\212\027\262\356\3568\002\335_[:b\244\037\211\006\350^\301"
+	.ascii	"d\335_\307\017l\032\377m"
+	.string	"\377\257!T\304\350\217\005\221Y.\034.&\210\226\024\013\n9\206\354\271R0+C\206-L\037J\"Z\202\231Sy\321\266\273I\314\254/++p\315LV\306\377\021%\261l\240\303\035\350\353\261\255\273?\256,\f\036l($R\2432\307\274RZ%[\373?\3222\353W\330\274\322\350\212*\027\242\221\020\220'\312w<<\020Q\003\317\202\016\024\372|B\235\016\344I\360\351:\236H\347A\340\241\020\020\257\023\205B^\307}\255Py\245\341M\t\227`4\0341\304h\231\027M\214\201\3216\231\211\177\335='{\256\231d\345y\001&\231Sq\241\265dde\b\313\2215\245j1\301\b: \300\002\0311\363\351\232\"\"?\006\235\242\216s\335\034\321\325\\\0361\303\305\t\032'O\314\254\002,\252f\252e\020\3425m\316}\326!\006T\340&{ \353\312\340\3701\253\304r\007\2414\321\346\313\264c"
+	.ascii	"-\353P\236Z\253\224\222\r\270\373\332%!\033\274\023I\022M\227"
+	.ascii	"\271\375\021++'\020d\331&0Y@\236\343\355\210\302p\032,\0339\023"
+	.ascii	"\021\231\201\375(.3\272\247\267v\225\001"
+	.text
+	.section	.gnu.lto_filterGetNotchQ.10.119dd381cbddb993,"e",@progbits
+	.string	"(\265/\375`o\001\005\016"
+	.string	"\266\233^A"
+	.string	"\2216\035\034\n\326u\376\337\322\037\b+\344\"\f\222x"
+	.string	"2V\347G!\t\350\304\023^\252\376\377\322<\342\221V\337\216(B\332\245\377\357\024*\202\037\362)\025\220\323h\242\357\266R\243M\222L)N"
+	.string	"H"
+	.string	"I"
+	.string	".a\023\036\177\024\nc\334p\"E\214\237\202\"\260\f\001d\333z\204IxZ\322\364}Hq\013\b\013#\0321\306,c\001\224\341\344"
+	.string	"\224\341=\330\343\364\324\036\031j@\231\021:\3718\253\0061\306f\350$\203{\267=\320\326A\353\032\001\305<\213Y\344^^\2619\374\331\326\263\325\263\324\263\360\331\351\331?\233\317\272\303\222\321\342\006\201\0271^(\331\210,PE\b\213\354\326S\217\212\325\242\222\254\017\206\001^K\312K\2141\201a\031X+.\013,\303f\266\001\230\333S\311\353-\027B9\004\337\341\261`\251\360OKr'\223\030A\006\246_\267\013O\205\312\277\035\231@94=c\362O\363\376\237.\336\212\222,\225\343yjd\335'A\211\341\275\200\262\324~\237|\207\326S<\207\366\031\"\033\311GG\343*\215\206\353\214hT\310\326=\350\266\016g\323\256j\036\335\326\211"
+	.string	"\242\3118\334f\303i\031\007\344c\223i\235H\346Q\240\234\204\255\313:\034\327e\330\027\335b\317\200^\322\352\324\261O0\022\276z5\362D`\211\271Q\270\205@=s=\033"
+	.string	"2\003\302\260\b\033\3603\227\201f\320\361\217\355G\254\243\204\004F\303\260\341\032\220\242\214\013@\206\253\036\312\0220\007pMt\0246\342\320\202\271F\361\022\002"
+	.ascii	"s`0\0015\004\234xR\255\230\204I\006"
+	.text
+	.section	.gnu.lto_biquadFilterInitLPF.11.119dd381cbddb993,"e",@progbits
+	.string	"(\265/\375`\217"
+	.string	"%\n"
+	.string	"\246\023F;@\305\2521\270\275G\363\365\347\372^4\342\370\267\315\372\023\006\231\340\233?3\360\351\251\366\217\n1\3024\327$\272\273\374p\272\265t:\204-\226%\005\304-L\361\223\275\267\224)\0052"
+	.string	"6"
+	.string	"2"
+	.string	"\026s\035\215\320\231\263\370\2403W\261\235y$\271\001\234p\274h\377\2759b\321R\254\375\362\005\2252YV\036\376W\242R\036\356t[M[\210\326\t\001\3578P\273\214\013P\322\326\230\266\323\205\261\025|#\004\304A\216N\021\335*\254\227\177"
+	.string	"-\366\177\323\006\2139\205\315\262\365\312(\242Y\0316\370U\004b\377\270)C\244\2560\233\234V\262w\373O\232m\316)gkq!\215\352\302\254\366\217ijG\223\234\"\255\267\377\357T\265v\331\233[\3664\313\226]G+\220\021\360_\311\023!A\372B\320\027b*\276\260C\320\365\303\t\277\322D\b\344\215@\221\b\374x\243\220G\344}B\222\307\311\024\244\370B\257\004\202\241\207\031\357\355S\325\216\001\331ij\264\"\353\020"
+	.string	"*C\244e\212L\274\016\032\r.\304T\335<\256\261\001f<\240J\204\021%\304\r\304"
+	.ascii	"W\244\251)\340./\332I\006"
+	.text
+	.section	.gnu.lto_biquadFilterInit.12.119dd381cbddb993,"e",@progbits
+	.string	"(\265/\375`\305\bm'"
+	.string	"\032E\350\016E\200\236M:C\031\212\201Wj\250\204\356\323@\3353?\f\3200 \225\030Z\021\362\363\235\332\314\310jd\270b}\223,7e\332\331\007a(\222;\002zG\362y\212\021\360\257.\022\0260jS\263\226\020\271S\n\336"
+	.string	"\305"
+	.string	"\336"
+	.string	"\366\357\345_\216<\230\207\371\230\223y\231\2339\032\013\235\3512e\366e\374\225\315`\nz1F\221\315\020\036\001\273\263B\214\220\024cLzbZ&\302\274\220"
+	.ascii	"3\222\311\214\230\b\373\313H\\U\017\003A\332\204\335\251\265"
+	.ascii	"F\270\351\020v\311\205FZ\207.#K\242:\274\262\302a\265\330(\211"
+	.ascii	"j\360H\220\f\224"
+	.string	"\353W\250\216\305H\007\325ZVG\254\326*\301\025p7\231\312S\373Un\205\352[7>\240\326,\244X\255\\\022\f\001w\323\\/\262\335\304\275\200\355\246\251l\265s\025\353\263l\345\330\262Vk\335\255\222S\335f\226K\251|\272\304\216\020\253\3526\007\246.Ky4/\217D/!\026\220/\216\340\225\215\250\326\232\303:Kz\323Pk5\025b\371\270o\267\035\303v\r\033'\026\273{dvE\223e\321\356\326\030\202\026e\2647 8J`\355\030S\364\302\2425\312\361\343,\270U6\362cst\234U\363\222\3114\301Z\255\232\350\022X\372e\300~\351\376<^\321\244\211\366k\0132\004y\336\261\242I\233\253\212.\022\373e\335,\373[\177\003\006\013\232\024$`\322-)%!\235\313\217\340d\367\321\273\376\003/\273\215nv\027\375\314M\340X\376\001\327\362\023\375\353\026p\260;\300\303\356\241\213\335"
+	.ascii	">v\013]\314\235\243\324A\224\032G\251o\224\332F\251MJ]R\352\245"
+	.ascii	"\324\224R\237B\216\312\032\244d\255<\222\177\352\2319\366\344"
+	.ascii	"_?\330\037\366\213\375c\277\230\237\354/\373\315\3763\317\005"
+	.ascii	"\373\264\304\013\2676\024\255\001\026\267O\305\344mm\337\003"
+	.ascii	"\001\330\333>\025\367\330\326^\361?Bk\333\247\242\235\323\314"
+	.ascii	"\\\273\305\373\030\211\253\265^\360\371P\035]\f\305ir\303v\223"
+	.ascii	"n\021\016mn\315}*\242\235fl\376\322\266\264:?\247Qiuy\316c\322"
+	.ascii	"\352\322N\342\321\"-\206\"h'\036\2539\247^y\314\004\273\344\347"
+	.ascii	"42\355R\332I\324-\006\242\232\363\210v\352"
+	.string	"\025\246<Z\006\253\344\3474f\031\355\202U\312s\264M\253\224v\022\025\354\337\234G\243\245\301r?\020!s\032\357\346\267\343Y\025\005\264\213\304O\363\351P>q|9\227c\254F\336\370p\254\206\253\265\352D\237\206\355\246\251\260^\2251\326Z\037\274\215O\304\025k\217\312U\037\334D\260\324\013\312\031\016\032\310\007\002\275\025\276()\023\306\024\235\202\242=\026\277\027=\223\002\nZ\001\005\265\200\202R\350\321\n=j\241G}?\033 <\334'\243\367\201\305\224\017\250\302\007\024\212\341\003n\310\331\f5\001\350\223\361\242\205\212\035\f\251\250()\250\035\214\026\275\250\035\024pj7\001\311R?\037p'CJ\n\270\023\342\252/\353f\231\247\307\\Z'=e\202\375i\005Z\006\273M\004\354\220\007\307TZ'8j\273`i\200\035\362\310\314\244u\"+\231\366\247\225f\233\226\016\355\220\327e\"\255SW\030\035"
+	.string	";\344E1\235\242\224\272\375imm\271o\"\264C^\022\363h\235\222\224?-'\253`_LQ\243\271\035v\320:\263\332+S\341\355\021t\007\t\252#L\312\032\305q\273\004\315a\244m\332d\237\240\301\244\342m\354\313\332Z\320\332=j%`\203\002\200\234\250aPf\220Q\314\314\210(H\222$\255\001\320\002\021)\2536\022"
+	.string	"\0055S\032f\210\244\230\271$\005\246b\315X\024-`\351R\365\316\376Gb\212\300\334ym\223l2#\026g\275J\307\227Q\345s\036\210\372\274y _bg\022-E\025\225\022|\336\323\330\362y\f\342l\3201\315\037\350\370"
+	.ascii	"\347\372\035\272\207\314~\003M7\201\221Si\213\001\342\366\252"
+	.ascii	"8A\220\227Uv\254rV\316\300\332\365\025!\230\263\347\233^\222"
+	.ascii	"{\206\351\362\0201xd\b\211\024\332\030\301F\275 X\371\222\013"
+	.ascii	"\331\221\327\253\273\267\001\025\013K\034L\262\025\023\205\261"
+	.ascii	"\356\006=|\264\244\261\335*\337;t\261wzcd\231\231\206\212\341"
+	.ascii	"0\267\235\360\022zJR\335\013\202\250\267\307\326`\261\2428\266"
+	.ascii	"v\330\323\206uGXt\276\273\002a\334,\212qt\244\035\316T5\202\276"
+	.ascii	"<\254I\234\250\340\333\217\200\345.\255>\241\372\017 \020x\300"
+	.ascii	"\204Az\303\202:\333s\336\255\341\370Ov \262(j\024\235\26148\025"
+	.ascii	"P\177V\235n\1775i\232]v \243\203\257?"
+	.text
+	.section	.gnu.lto_biquadFilterUpdate.13.119dd381cbddb993,"e",@progbits
+	.string	"(\265/\375`\264\002\315\021"
+	.string	"\366\236oI\340\322&\035P\353q2\f\202\363\224\021\211\240\r\276\016\360:\230\272\021\217\350x>L\210c\273\241\206\252j\215\323\354U5\203N\205\351\233h\227!\353\030p4\347\034\224m\342\262b=\003\333\246B\2115#\226\020\"wJ\001T"
+	.string	"a"
+	.string	"T"
+	.ascii	".m\332\rB\262\355\256\210U\337;\020\356\323\276\213\277\210\375"
+	.ascii	"\206\345\002ve\204l\273\244\210C\276w&O\300{\367}\200\367\316"
+	.ascii	"1\373\350\344\314\336\310D\210\030H\273\013j\212\307>c\376\177"
+	.ascii	"n\242\301\310>K\016v\327\223\006C\342\326\333F`\033\203\255\t"
+	.ascii	"\0027w\333\315?S\247\244\242\020\031\273\""
+	.string	"~$-QW\203\305y\376\236\337\347\267\235\263\377\031\247\361\362?F\331T\\\360\241\261\320\343\022\304%\265/\037jZT\260y\\~\262\021\005@\030\255\350\261\273\013\336\231\202\315\355t8*\321q\311\245\366\245e\007\202\346\300\270\324\272\234(\321`\222\207\021;NSm\226\206y\232\025\320$m\214\312l\267.\344\335\304\007u\2526@5\225\003q7\273~\303\345\267\273\f|\033\0368\030\230\251a\361\336\251\252\r\216\332\315l\376\260I\331T\024\366\271\335]\253\214\375\235\377t\235\337\364\234\377;\316_:\317\355\275\347\356\356\023\252\225I\2622U\260I\002\233a\nlB\204\207/\023\t\031\\\341x\022\216(\225p|p\362\274\032\031\303\327\006\326\t\210\"\266Z\342\nDa\231\264\300\325\350\002G\016XL\tG\360%\212#\210\"\367\334\252\214K|\020\315\264\305\236\356\270uZ\224\243\306\251\216\233\352P"
+	.ascii	"\036\263\241Z\f\200yR\223~Z\3229 \360\002\031\261\321\003\370"
+	.ascii	"r\020\f\221\346)\363xG2\034\214\204\214\035H\340\"\025\214\r"
+	.ascii	"\330jC\224\026;\220\300E*\030\033\260\341\355\f\312q\f\376\037"
+	.ascii	"\226\311\334\017\2259\364E{9\237P\316\020\"%\204r\316f)\203\034"
+	.ascii	"\271\215a\210$\216d\237x/\245\223\316x\265a\274\355.W[Mb7y^\274"
+	.ascii	",\003\226\b#\212\270\211\301+\322\330\024\020\227\027\355!\003"
+	.text
+	.section	.gnu.lto_biquadNotchTableInit.14.119dd381cbddb993,"e",@progbits
+	.string	"(\265/\375`\331\004\315\036"
+	.string	"\226\272\307G\240\230Q:\020\3505IzH}\3512\202\256\233\233\022\354\003a\300\344Gpz\262\302\035<M\361\267M[\377ut\236$\263/\254)\273\264\276\n\037\234\006\233\301\3720D\354t\r`\"\203'\340S\222O6\221;\245\266"
+	.string	"\246"
+	.string	"\263"
+	.string	"\343\025\213\002=\325W\365\206h\237\270\030{\252\257\207\224\005'&\216=\225I\351\006\205)|\223\335\251LtN\255X\340H\251\265F\360\204\3624\301\370i_\311\227\354>\365\342\002j}\362\"\245Va\004;(O-<\020yZ~"
+	.string	"y\352\235\255\346B\250z\253\253\030Voj\255\262\365\341\327\217\302\233\234\273\303H:\356\334\371\303+"
+	.string	"R\374\001y\207\215En\300\360"
+	.string	"c\214CA~:\256\005c\222D\234N\257u\007Q\305\037\320\351#"
+	.string	"`\215\357h \007\227\032<@\337\330"
+	.ascii	"L\0174\037~2\001\225\346\204]\250\265z\376\2004\356\362\266\235"
+	.ascii	"l\037\331c\224\373=\215\250+KC\224f\321\026\362\346\006\355\323"
+	.ascii	"\031Adx\237l\241?\371\203~\365\003}\353\376\231\323>\237\372"
+	.ascii	"\003\034\353\3369\325\257s'\177lN\347<\353.\3474lN\223s\232\316"
+	.ascii	"\351qN\357\234\236s\372\bbS` \020k\235Q\204S\277P*BN\345\337"
+	.ascii	"\372\263~\254\217\366\355\023\375*\347\332b\nb\231\225\247R>"
+	.ascii	"ew*H%\257)\003\214,]\2656\201(O\347\016\006\037@>\212\257\345"
+	.ascii	"\330i\226\271J^S\t\305\212\350\241<\375\207\216\331\306ZQ\362"
+	.ascii	"\232\b\374\202X]\265\326\007\247.\262\003taa\322xM\365\314\177"
+	.ascii	"F\216\033\264?{+\257B+\177v\315\304\374\317c\265\261<\307\346"
+	.ascii	"\317\032h\307\325\031\032\371\342[\236uv\367gg\232\245\034;;"
+	.ascii	"w\367\345\316=\327)\022 P\226\272z\263\270_]S\274\350\006=g\222"
+	.ascii	"\365\331\234e\262s\326>\272\227\240\0376z\2638\216\033\\\023"
+	.ascii	"\037\247V\036\237\375\222\026\245Y\374\366\266\304,\321\366\\"
+	.ascii	"\260\263GNG\252\272\370\346\227ck\333\276\205\214\024\216\236"
+	.ascii	"\215{\026\023\313Z+\005\037\313\b\025;PQ/\310S\312c\214\027\216"
+	.ascii	"\036\361<\036\257\332C\305b\033_\255\275\005\337\235\235YKEt"
+	.ascii	"6\026*j9\f\271\232\356V\243\001 \215\236D\224\242\246C\"o\030"
+	.ascii	"\212N\320t\270[Y\323\3154\234@\252\345J\324r\261$\242\0263\033"
+	.ascii	"M\"\272\031\331h\r\005\211\231\216\232&!W\323\2410*!\273\341"
+	.ascii	"l6\034Mv3\232\331d\264\034\222L\302\001\343R\324r2\035\016\227"
+	.ascii	"\223\305\204\365\373\344\341\313!\223/\275U2l\203\206}Q\241]"
+	.ascii	"3\343\203\227\313\344zs\221\345~\252\312\214o~}\254\265V\022"
+	.ascii	"\302\313\025\332k}\214\023UD\032k\3451\324E5\213\206\255)\272"
+	.ascii	"\232\r0/\362\f\207\233\351@.,\214\032)\272\266o/c\"\020T\255"
+	.ascii	"\265\202\375\341dB\234\006\230n~l,\342U\002Q\2501<\303\230Q\312"
+	.ascii	"\fI \301LM\2539\240\002\221\271\242\007\021P\301$H\223\244Fa"
+	.ascii	"?\003Y\0275\210\365\206k#\344{\252e\225(\203\343Tiv\225-6\013"
+	.ascii	"2Wr\307\037fO\025H\321\210y~<\201\021^\225\247\206\016\307\342"
+	.ascii	"\372\020\017\335\235\241\367\\8tu\253\353\255\212\374\307H\022"
+	.ascii	"\263\nq\246\250\270p*\360\310\254{9\032\212\023\257\037\263\205"
+	.ascii	"Q\274>T^)\355\t\226\214\204\337\233\340;\211q\003\003\227\260"
+	.ascii	"b\243\t\307\366w\237 \310\353\264N\201\007\322\021\366zh\321"
+	.ascii	"2\207\217\322\013|\2124\323\334\360n'\256C\341\006\377\034\231"
+	.ascii	"\376\324P\216\032"
+	.text
+	.section	.gnu.lto_biquadFilterApplyDF1.15.119dd381cbddb993,"e",@progbits
+	.string	"(\265/\375`\374\002\r\023"
+	.string	"\226\243zF\360\322f8\252h\322UT\300\017\300\317\302\262A0x\021_\315u\253\bK\324\352q\270\275UP\211b\277\202\301\007\001\364u9\215\274\016\225\335\201\347\034\021\375\264-e\367\331E\027\026\3736\b\321&{o)S\na"
+	.string	"Z"
+	.string	"m"
+	.ascii	"\273\t\336y\301\227\371\035\333\\\332\r\352\341\263\273'V\360"
+	.ascii	"\264O{\t\330\307\230\247vk^\370\354\216'F\360\275\363\370\331"
+	.ascii	"\366G\234\004\314\266q#\b\034\317\202\215\0135\036\273\013\026"
+	.ascii	"\270\312{\307\235\304{\247\037\016{\302\374\327\316\211\310\271"
+	.ascii	"\315hd\236\244\006\273\353\234\321l\270\365\266\r\330f`k\206"
+	.ascii	"y\263G\231T\033\373\334j\215}\236[\365\235\277\344\343O\222\351"
+	.ascii	"T\246G2-\222iT\246O\231\016\311\264)\323 \231.e\372\3134)\323"
+	.ascii	"^\246\273Ls\231\326Lg\246o\202\232\211\201\002cW\303\355h\207"
+	.ascii	"\272\237\234\363\3746\314\257\331d\233\247\302'3\003`fC\204c"
+	.ascii	"\003\262\020!j\322\223\022\310\301:P\210~\307\204\377\230\364"
+	.ascii	"7J\352)\210\006\360\361)IKj\"C\246\023k\335\347\323\013\335\320"
+	.ascii	"\304\360*Hz[\247\251\236vD2\017\261\274\231S\325NI+d:1\227\243"
+	.ascii	"\340\364\265\033\232\370\362\023\252)5J\364\232\312\021\311t"
+	.ascii	"b\206\271\t\333\276\335M\361{\036P\370pb\274w\327\222\250\303"
+	.ascii	"\210&\006\257\025\230\227\225\313{\301\264\260\260:\317*(\256"
+	.ascii	"\325k\205\025\001d\t[\255P\005daAh\201*\256\027\020E\200\303"
+	.ascii	"\226\225\013|\205\241\0134\215{n\265F\245(\f\267!QcV\351\320"
+	.ascii	"\017#\016\242\320\214YQ\211\332.w\321\211GF\035\304\026'\032"
+	.ascii	"\016rzfE)E\251JsDE4\245\007j\253\007\215h\002I8\013\021\315\332"
+	.ascii	"IA\024\245\003R\0044 \340\"\021+z\351\232\"\"\236\224\024\r^"
+	.ascii	"\202N4\020\r+\211_\200\201\3406j\2345\b_\\j0\320zw\305q\201\324"
+	.ascii	"Y3s\304\200\222\357@IDX\236\030(\371\016(\t\346\345\361\272\206"
+	.ascii	"I\315\205!\220\222H8\336:\203n\nc\226\222\r\361\033b\205$.0\n"
+	.ascii	"\301\233\330\2524\"\361\341,\245\320\344\266J\022\bXf\023OU\212"
+	.ascii	"\351\022d"
+	.text
+	.section	.gnu.lto_biquadFilterApply.16.119dd381cbddb993,"e",@progbits
+	.string	"(\265/\375`b\002\265\020"
+	.string	"v\337kD\020\217j8\200\265p\034\205\203\331"
+	.string	"\330\033\230\321\276h\221\033\036\037\304>\311\264D\001\302y\334^:\211\210\277\1774\006\261\336\2032\f\002"
+	.string	""
+	.string	"T$\367b\336<*\220*0K>\317\223\277\367\336[\312\224\002V"
+	.string	"P"
+	.string	"Z"
+	.string	"\313\362R\333\335\016\033x\332O9\210\325\307\220k\354\276T\324v\307\016\023\370\316y\374l\373\036\376ae\323\2661\303I7\"aD\366\262\273\240\200\003\350\316m\007u\347\324\344\253\347\312\277\354[\007\224\231\213\204\365\364\024\354\256\323Er\341\326\333\036`;\201\2352\002\337\370\370kd\372\223iO\246;\231\346dz\223iM\2463\231\3762\355e\272\3134\227\351-\323\232\351\314\3649<0\026\bZ\354V\210\231\261-\334\212\206\307~{\345\313\274\261\035\213\360\261,p\270L&\300\330\335\002\347|\340\313\274\212i\316l\272\271\210\033Z\031c\220v\352i\207B\204\2057\321ihSN\325E\204=8\211M\275\326\fE5\025\244YB,A}\204\252\307\213\r\275\246n.\"\254e\325E\230\366\355\256\207?["
+	.ascii	"\341;\t\351\316]3\255\0200)\"\031c\217\254T\f\366\267\325\227"
+	.ascii	"\375\330\r\272\312\003\251\017\025jt\352R*\020\023\211\353,\n"
+	.ascii	"\235F\251\017R\003\320\024\226J\241\b4\221\030\224@\321\t\005"
+	.ascii	"\206\0028\004\031\235\300T\030\236\300\315\270\337V_ \365P\340"
+	.ascii	"\320\"\242-\177\224\305\243\034\375t\324Cz\212\316F9\016~b\003"
+	.ascii	"\243\321\225\216\213\224\271bd\364S\215z+\304\222\322k\031\275"
+	.ascii	"\314SN\277, \300\"\231\253ziO\021\212\007L\242YI\320c\003\271"
+	.ascii	"\264@\320\232\301\030\351\005\207\361\200\016\t\3060J\2436\020"
+	.ascii	"\004\343XN\262E\035\206<J\b\342\361\340@]\371\3051W\245\220\350"
+	.ascii	"\034\306\234\222]\361\233bu\024\027\326\206\340\236X\2120\"\221"
+	.ascii	"p\226Pht[E\t\004-\277\211'\221b\272\026\031"
+	.text
+	.section	.gnu.lto_firFilterInit2.17.119dd381cbddb993,"e",@progbits
+	.string	"(\265/\375`\346\001e\017"
+	.string	"\206\334eF\360\260(\035\333]\347P\306E\334\317R=E\247\307Kb\304\366X\205\346\230\006F\276C\312\3763\277w|$\223\202W\027\242\352\351\370\210he\361\261\304s\241\213\271\373\321\236\271\265\366\353\334I\365\333F6\221;\245M"
+	.string	"O"
+	.string	"U"
+	.ascii	"\313\262\023\"G\273f(\270\264\217\342)\304\277\234\\\264\333"
+	.ascii	"\252\271\331\035?\214\340\363\351\361\004\266\317\317\007l\237"
+	.ascii	"\026m\032\037C\354iXTT\310v\227S\020\027/E\3774\007\261VT\227"
+	.ascii	"\236\007\273k\311Z\331p\353m{\330\226`K//\227\016(rf\217*\251"
+	.ascii	"\037\354k\273\273\326\226\375\231?t\231\037t\230\337\363\361"
+	.ascii	"\237\177\371\265MZn\322\027\t\250\001\243\301lW\303,\307\346"
+	.ascii	"L\034\022\266\037\262g\302w\354*\206\013\302\224I\025\350\330"
+	.ascii	"\f1#\034h"
+	.string	"\322^\020\"\036&\264n\037)%V\327\277N\314Tv\036\273\335\335E\213\226\207\233\355\035\026\232\210\311p\330\330\226\036\366\3508\266\211\265\310Bj\223~\023z<\300t@jS\270+\025\003s\361\250]:\213p\336x\351L\265\301\327\330\365\331]\006\376\n\f\027\002\310\020q\262}N\016\001%\250\221\311\023\001`\362}\036\330m%\250\221\311\023\371R$\240/E\242\233;\220\223\207\252@\3728\023X*\201\035g\"\215\224\270\356d\302\201\0300h\301;q(\020<q\241q\257\255\266\034\301F\016\212\256,\222R\023|\252=aD\236\345\003)\252\262v\277\330\256R\003% \300\202\231Iu$\243\2452E \236\217D\023\r\355\334E\340VT\265\364 \333iF$\302\177\377\301\342$qq\3508\n\034\231\244\363c\027\331\2455\273\2057\214\252\341\224\350\b\341\356\205\037\206\023\200\021\303\r\324\270\347\260"
+	.ascii	"\016\rty\321f2"
+	.text
+	.section	.gnu.lto_firFilterInit.18.119dd381cbddb993,"e",@progbits
+	.string	"(\265/\375`\321\001m\017"
+	.string	"\306\\fG"
+	.string	"\261&\035/\2237\214\300Z\022\033\352w\347\016\237\201l\352D\006\207\351\342\324\346aR\021d\326X\232\265\021\251`I\367\\\221Y\370h\244\004\264\3365b\360ML\n\232\331\300\317R\304\325\3564b#{\223\275S\nN"
+	.string	"L"
+	.string	"V"
+	.string	"\273\036x\220H\3216:\f.\355\247\270\212\360\253\224\013\330\205a\001cW\024\261\002\317\251\305\027\250\247\236\023\250\247\016m\034\027E\354kV,,\330\356n3\304\303\313\320?\353\037\251\026\225K-\302\356Z\246Z\\\356y\333!\266%\330\262$ \354g\273\273\2360\266&\255i\322\3654?\275\370g_\375\3632\377A\002\270\330x\020\333\345\020\333\2619TF\t\333\367k>\222\276\302\024n\250v\367sj\223\354\317\351?\266)\215\311"
+	.string	"\310n\230!\001!\223v\003\222\3602\240g1\226\0368\377h\223\323\300Q\035\254\037\315\375\005\236x\301t\264l\313\220\217\356>\303\255\227\nv\224\307"
+	.string	"\265\0177;\024\364\226i\346&\346\027\376\002\2449\\;\331\374\350\320]\330\006\200\316\356:\360[h\370\374\021)\365\364\343\023\274\270b:\234d\314\026Qr\006$\317\353>\256Z(\241\210\272\t\236\351\344\3033\235\314jnd\324\2250\200\274M\364\205B\037\267\211@&\241\215\033\221\266\221\003\3762t\243\255\364}\243\355#\236\316\272\247\365\222s\232(\017\220\332\\\360l\372cI\005\371\224\021\254L\025gw\215Z\2476EVL\240\352\274\013E% \320\002\221\311u\351N\021\241\371\310W\006\350b\242"
+	.ascii	"\372\242\254\215\247v\032\372\352$z&\250t\037v\267\b$w\261\310"
+	.ascii	"9\313-\004\304\204\204\227\033\267\326\332\302O\004\030\355\321"
+	.ascii	"\325\233\302\f\303\007`\244p\2035\356=, \206\006\272\274h3\031"
+	.text
+	.section	.gnu.lto_firFilterUpdate.19.119dd381cbddb993,"e",@progbits
+	.string	"(\265/\375`\245\001\025\017"
+	.string	"F\334aC"
+	.string	"\221(\035;\346\366H9*\247\306\211\b\367c^j\351\324J\375v(\3169_{\017\231\337h\203\352W\006\3416\346`\346\306\325\264\364\357j\375\366\352W\217\2323\254\331:\3569\206\374\t\331{K\231RL"
+	.string	"H"
+	.string	"Q"
+	.string	"\027\260\213b\271v\273\017'\310\016\335\275@<\314> \036Zd\273x\247\2627\301JY\321\354\256\246\034.\372\323\024\371\230\310\306t\032\375e\270\0068\241<\217\335\275\313\323\302\211\224\211\211\354\256\323t\302p\303\333f`;\304\316\003\001\376\333\335\265\242\354\267\374\034W\375"
+	.string	"^\032\323t\204i\b\323\357\245\365\245S\323\347pVV,x\355^\250\241\2611\020\346\203\355o\330\316\356$Do\361\2137\273(d\\\273\373a\005\331\241\307{\332\027\361\021\242\253L\002/\004T|\267\342!\202\016\032\240^\243\276\004\342\335)\342S\250\271*\255\244>\325\231\224\032\252\254\255\243\305M/\376-\246\252\352Li\003\351\363\023[j\207\214)\274\204[\331\356\206\370\253\b%\231\007\223xxU\026\0262T'Ycw\243\324\224\003\241\n$ \017\214\356\200p#\241\t\036\b\032h\373|\266\216\006\3628\370h\035\256D\0031\340\215d\204\323B\333\306i\033\335\376\255\242\334\200%\346DIOS\336\"\f\007\302x\321\304\310\335\035\251\246\214\251\352\003\027\025(9\303\266\204\2730\335\220^!T\034\352\2678\007$ `\2021\223\214\007iL\031\343\325,\334\223"
+	.ascii	"w\262\271\017CZf#Z'\332\240\211G\301\372\234\0068\020\325\241"
+	.ascii	"Fv\320\355\007\033/\032\236Z\\\265\261L\016^\366\t-)y\262uV\242"
+	.ascii	"qi>\004\305\030q\314\350\212\301\025i>\005\354\222\006,Wn\273"
+	.ascii	"\202\036"
+	.text
+	.section	.gnu.lto_firFilterUpdateAverage.20.119dd381cbddb993,"e",@progbits
+	.string	"(\265/\375`\373\002u\023"
+	.string	"\366\"xF\340\322&\035R\2561\2722\216C\232(tq8\271\264\234Z\3501\311\002\344h$\270\020A\341wJ\327\320\236\343\t\307v\330q\202\215\266\0163\324\f\363LT\212\250+"
+	.string	"'\262\375\337\027bm\315\210%{K\231R`"
+	.string	"X"
+	.string	"i"
+	.string	"\b\270\307\022\370\264\177\342(^\377b.\262\2133\003hwf\342\003\334\243g\027\260=r\017\260=\372e\353\370Lg\277b\210\306\007iwW\352\341\257o\021j\276\374R\212\251F&\363M\303c\314B\302\fW"
+	.ascii	"\262\031X\262\273\357y\332\310\274\314R\312\356:kd\030\356\322"
+	.ascii	"mG\260\215b\353\202\333\343UG\034\231\370`Y\263g2\2519\366\341"
+	.ascii	"\356\256\025\307>\317?\362\357\027\201i\025L\247`\032\005\323"
+	.ascii	"\247L\2332\315i\272\024\323[LG\230\206\232\326Lg\246O \244\350"
+	.ascii	"\206\202\332\356\205\332\217%\212A l\037e;gO\361:\217i6\355\306"
+	.ascii	"@\002\332]\023\007\037\211\216\201\235\016'\205\321\r\370\273"
+	.ascii	"\r\352I+|B\261\033\323\013NSM!\274\323\\L\363\375\243\267\341"
+	.ascii	"\260\251jI\037#q\323\330\242n\ns\304DxY3\324\250\247\t\002\313"
+	.ascii	"\332]tPOv>X\353-\374\243j\362\216\222\276T\026*\034\257)\032"
+	.ascii	"\321kj\002\211\335x\236p\025\246q\273\213\342\3734x\341>\304"
+	.ascii	"\0040\024\\ZXq\363\312\211\213\005F\002\353\301\252\245\325u"
+	.ascii	"\255\225U\013\313A\267Zq\275\254N\n\270\345\302\342Z\301\264"
+	.ascii	"Z\256\025j\266\207\2538f`D\004SoS\351\020I\320S\252\322\004_"
+	.ascii	"-v\343\305\224\242T\245g\b\302k\244T{l\200\232\343n\223\321\205"
+	.ascii	"D#\036%\216rweTs\214\322\223\252\364\330\230I\037\266Y\027B\251"
+	.ascii	"\311\333\221\024= \240\002\021\261+\017\251\2312=\336\223\302"
+	.ascii	"m\006\270\025\0027>\027c,\372#9\277f\3230\354&\332Z\n\201\021"
+	.ascii	"c\336\205\203lM\357\205\312\217\371\n\312I\253\242\021\366\007"
+	.ascii	"\353\274QdX\205\305l\254\234~Wc\267B\254}\t\214\034\264\304!"
+	.ascii	"\227\r\302D\034\2517\342g\271\202C\333\207\311\267\301P\026\223"
+	.ascii	"\362\026\231n\317\346&\003N4A\206l\020\355\210c\2433FW\244\345"
+	.ascii	")\342K\032Pqd13\312\252\261]\246\f"
+	.text
+	.section	.gnu.lto_firFilterApply.21.119dd381cbddb993,"e",@progbits
+	.string	"(\265/\375`u\005\275\036"
+	.string	"\3069\304H\260TN:\330\311\\\352\031\354d!\207\336\330\222{\007V\032\016{\253\021G\271f\272\365(XF@\227\316\200\274W\372\264q\346\311\346\013\323\235\364\r\374{\351\313\245\326\377!\247\222\237C\016u=\224\326\204\220M\222\224)\267"
+	.string	"\241"
+	.string	"\254"
+	.ascii	"\232C\301\024\350\2300\217\221UZ<<(\\\310\020|y\310lgS\356\272"
+	.ascii	"\272\2748\2408<\204\254\322\"\303\272\202deY6\3514\001R\347\332"
+	.ascii	"\352\2457\250\364\327Ao\312\022\305\221\037e\371{2\023\251\323"
+	.ascii	"?\262\206\332\240\262\307\302_\n\026\"\226\026,0,eY\326f\272"
+	.ascii	"#\352\f5G\324\371\256\321\032\324\360\247\016O\245\344(\316\360"
+	.ascii	"Ke\205\022\273\222\345\253RR\235h\225\340\355HBE\006H\262|$t"
+	.ascii	"\206\343U\210\0264\276\253\020\252\214,\210\002u{>\253\ra\214"
+	.ascii	"\320+P\231\304\200Y\276\021\272\343\202\262,\275Y>\021\352\027"
+	.ascii	"\265=\303v\002{n\b\266\240;pdY\356\fXuP\305\310\221,tZ;\210:"
+	.ascii	"\365\343\356\213\206\227\207\r\332\277\252=\227\255P)\312\310"
+	.ascii	"|\024v\215\366\344\324\304\264\244\224\244?U\001HGF\212C]4\323"
+	.ascii	"/5\321\220\206\251\205\276\016\3325\220\270\376\021\327>\343"
+	.ascii	"\032\300\\\367\3145\317\270\336\021\327:\341:g\256q\346\372&"
+	.ascii	"\\\333|]\263k\032q=#\256e\306u\314\\\303\314\365\313\270&\305"
+	.ascii	"\365\030\256\305\271\236s\035\206\353\177\275\273\326\0018[M"
+	.ascii	"\024@)\313\020\301-%\223\031\304\205"
+	.string	"\342P\375R\r\323\333T\016\020\224\b\216\346\343\016,\313<\227g\312^\373\314\332\244\027\275w.\037\210\323.!He\233\224\350=\r\276\255?\375BP\311z\314\366\036\t\275\347\245\222C\312n\3134,\313\262\f\213^\273\310\305I\211N\273\006\021\003\n}\346O\327)\274-\231\217\237y\230\204\027\303JH\005\217E\211:e`N>F{\350\313a\212\376r\021,\202\002\211\"\377\024\305K\307t6\353M\3249^{&\346\177\361\312\223\021\252\221\210\341\347\225\027\203\350\341o\205\202\362\270\375\363\311W\226\037X\344\312w\323t\237\364\005\343mYm\320\372\275bu\tS6\335o\267\345`\223 u\233\242\243h:\333\324\205\333\204\232T\016\207\313E\325\244n\021p\265(]\206\032\r\3109\f6]m*\227\323\325b~\245\206\343\320\217\216N#\342\004\023\017\267\"\317\345\002+D\247\317\254\251t#\375"
+	.string	"\303\347%6!}\366\236\002\225\264\342\363!2\335\341\\\372\320{\263\007}\253\344P\262\3332\003=\350\372@\225\340\200n@\305ht\247\373\f\231\275\351b\t\261%C\3779\223\317u\376\323\300c>=\3379"
+	.string	"\236\367\030\235\007\311\216\003\233\016\316m\236ss\234\331o\214\334l\256@\r\360$\214\206\030\022\035\351=\207\241\320\227\336\253\271\022\315k\256\001c\25018\303\234\203dfH\202HA\f\222\306\340\002\021\"S\035\021`)S\024\ti\312\324\001\251~i\021\024p\371\035\314G|q\332\215\005\231\302T\325\322Ia"
+	.ascii	"\024\234f\314BL\321\266\003\206\214G\3460\365*\350NR\312\334"
+	.ascii	"\324\345\353a\204\207J\230\232\305~\305\216\301\356\n#\177\243"
+	.ascii	"\241\331r\224+yxA\206\220i\240\003\3434\331u0\357\030\033F\317"
+	.ascii	"2\202\224\220Fd\223\263@Kz<W]\035\214\n\247\215-\355H\373e\234"
+	.ascii	"$\237Z\201!t\262a\270\034\261\214\004Z\371j\231q'\337\037\304"
+	.ascii	"\007\237\030\rB.!q`\305h\022\226\254`G\353\263N\211f\tl+\226"
+	.ascii	"\362_\244\323A*"
+	.text
+	.section	.gnu.lto_firFilterUpdateAndApply.22.119dd381cbddb993,"e",@progbits
+	.string	"(\265/\375`\331\001\325\020"
+	.string	"\246\337mE"
+	.string	"\263$\035\363K\002\366\300\204Hv\354\307\f"
+	.string	"\036\035[\030\031\3720\b#\337\254J&$\273\306\007\330\266\250\276"
+	.string	"\"\253C\244\243\240q\240z\245\016\b\324T\343\0046\n\363\371.V"
+	.string	"\3447B\366\336R\246\024W"
+	.string	"S"
+	.string	"^"
+	.string	"\027\260k\223#h\2673q\002\354\320\035f\333_q\026(\033\350u#p\242\206\0174=F\273\253\225^ \036\276\023\210\207*\342\250?M\224\177\245\360\374\245\360\031Z\261b\376<\\IX2\257\264\273o=7\260T\231W\312\356:W\254\232\033\3366\003\333(v6\b\235*\365\306\376[\265\261a:{\351\221\230&\3054\006\323\027L\307L\303\227~\337\371\365\335\237\001\006\250\330\261\300\306n\207#\"+\004g\224\360{\336z\271\013;\210\221\275\330\331Qvf;\363;\0062i\367\306\220\240\3355\261\202\247}\235\267@\275\203\tJR\r\345\350\250\3722&\030\310\307\361\375\023\017\021\220"
+	.string	"A\322\247#\372\031\024\357\306\0211%i\366\314\230P\345\221\243b\252E4E.\375\331J\210\276\362\221\372\026\243^\252E3!T\024\016c\213Z\322\343-s\367\361\017\266\273(\376\213\f\026|\034\030}\353\007N\360\b\242\223\312#;.\030ZXL0Z\345\344\264\342R\301\024Ac\341\266\215S\321XL\0176M\345tA;1`\256e\345\244\271p\334I\313\272\324\337\252\r\324RJU&\311T{EB~\005\365<?\207\232\034!\031\215yz\343-\326\330"
+	.string	"\020\301\037CF@rwcTo\234\351\245\020xt\310\244\020\323ilX\026&  \002b\220u\346\001i\247\310\2147\245h\233\0322\f7\333\311p\251\226x\245\356\333\347|\375\245U\253.&\313\254eO\264\035\322\325\"B\206\0272\260$\300\310\320\244k\363,{\335{-\027\271{\310\340\3354\200\025\276]\256\246\213\331S1\227"
+	.ascii	"\232kw\022\002\321\301\227\250\261]\245\f"
+	.text
+	.section	.gnu.lto_firFilterCalcPartialAverage.23.119dd381cbddb993,"e",@progbits
+	.string	"(\265/\375`\236\003\215\031"
+	.string	"\246\260\245E\300\230Mc\024\347\377\324\363\335;\372_\230v\303-c\322\311\227\037\373\246d\322\262\331\342\252\030\246\221\036\226\310\025\326<\214\245\330\" \202 \f\002\347\300ON\213\024\354\013\305I=\"\243\217\375{o\271\223L)\226"
+	.string	"\211"
+	.string	"\217"
+	.string	"\fj\336\001\302\260I\364d\204\002\307\326M\326Q\263.\204i\346\\a5dN]\202\036\b-\253\013q8G\255\225\362t-\230<\345\305Q\217-s\316\030\001\333|\226\236\003|\226gQ\177\261\247s\277X3\370I\357\261VC\331\033\362\343\n\022n\310\240\007\032%\305x\341\216\274\007XWS\3369\336pD\361\213\231q\302R\311\236g\300\211\212*/\234\221\267\263De\242\205+\212\367\316\007vZ\220p'\034\301\bs\316F$\\\t7t\333\244\266\023\332\353\002\272\241\370\\\353\007-\260\254\372\025\355\216N\016\016\030{\343\035\266M\215uv"
+	.string	"\032G\271\260\031;\271/?\271.0V\346\261\255\307\306x\2610`l(c\301/\366\373b\245\214\365\036{/6z\261\026"
+	.ascii	"\300\213\023\nL\346L\372\342e6\221S2\034e;\331O~\353\326>\352"
+	.ascii	"][QPQ1$\204\226nku\017C\265\365T\251p\210\304\215m\n\023\004"
+	.ascii	";\325H8D\"|r\001\343j\316\311cY\007\341c\273 9\227)e\035\347"
+	.ascii	"\257\337Z\004\206}\347\236\332i\261-\271\036^\347\266b[\"r\021"
+	.ascii	"\016\225\2523|\226\341}K\361\335;x\333jx\256\222O\376\273m4^"
+	.ascii	"\227\177\225\314D2x\227P\252\242\354\361\237\363X\025\377{f\251"
+	.ascii	"x\260\006\225oP\271\031y\317\361\030\347\003rOxP\025E\254\366"
+	.ascii	"x\3468\337u\261-\021\035\n\211\021\356\317\275\346\016r\224U"
+	.ascii	"\r\016\362\023\316Y\324\240\006R\201\0262Y\326!>K_b9\302\245"
+	.ascii	"ID\374\322\006\263Y\024\222\005\375\203\354\002\320L\n\001y\240"
+	.ascii	"\371\310\257>=A2\241\r3\f1 \332\317\017\315'\0064\263\360\023"
+	.ascii	"\363\t\352\020\353\021P\032\007YPL\210F\013\212\265t\363\312"
+	.ascii	"\336\347:\315\315\t\2108QeN\363\233\333\226\244u\231\333ve\363"
+	.ascii	"\326\217\262\256\300\347\352J!w\316E\311*\362\030\366[=\371\212"
+	.ascii	"\242\264$\326|\3467\357\034fA\321$un(\207V\224\204\304J\265\215"
+	.ascii	"\005\\\277\301\036sK\341\261\004\3461>>\002s\030\023Hl\330\233"
+	.ascii	"s\316\357\271\032\006\212%/A\2501,\244\fTF\021\032\221`HHA6\006"
+	.ascii	"p\002\231\271c\007\021\300\271CEc\353i\250L\022P\220\324\t\376"
+	.ascii	"\306\002\260\177G\327\322\004o\243\020^u\337C\347\203\201M`\355"
+	.ascii	".?3\317\207\232\242w\034hqDO\213\022\205\303/\374\322\177sz\t"
+	.ascii	"\1771B\354z\367g\326\323t\310\365!\301s\002l@\223\333\336\350"
+	.ascii	"\001\212\020\225\005\020\326\331:DX3\350\005:\312<p\004\264\252"
+	.ascii	"/\024n\214\t\016\247M\212=\370F\025\245s$\310\352\235\343*\235"
+	.ascii	"\320L\001"
+	.text
+	.section	.gnu.lto_firFilterCalcMovingAverage.24.119dd381cbddb993,"e",@progbits
+	.string	"(\265/\375`\210"
+	.string	"\305\t"
+	.string	"\346SE;P\245(\035l\022\\-E[\201?A\232\243$\300\003\031Eh\235\b,\253\273(\332\217\266}\344z\264\022\215\330|j\255\314$\352jZ\201\247Ma\327}.a\021B\310\2262\2454"
+	.string	"2"
+	.string	"3"
+	.string	"\032\337"
+	.string	"\355V\f/V\027 r\0021\260\273\334\345\226\354X|%;\246\026\007\237\240\377\216G\327\210\t*5zj\013\273\353D\245&n\275m\214\355\004\373\230\3172\035cZ5\235\231\376V\241\b\300\320\332\225x\271\026"
+	.string	"V\222a\033\264)\266\237\366Y\347"
+	.string	"\037\212N\260\253\032@\262\033\"\370`;\346p\263\355\007&\002\251\252?\035\350\036\342\245\032\370\341\037\240m7B\301\367\370 \266\335\375\352\230/\312\216]-\030,R\276\354p\224Za?\356\356ZUv\246\265\207\017\337&\344\351p2k2\337&\344\351p\270\217\327u\236\206\373t\032:N\363\201\270L\201=\207\315\307\205<\357\343(\341\336\326\364B\322\222\243^5\275\351\244\224/\253F\325\002\001\f"
+	.ascii	"2\003\3020#\026\331\na\203\201\020\345G\224\312\205]\263K0A\300"
+	.ascii	"\211'\325\212I\230d"
+	.text
+	.section	.gnu.lto_firFilterLastInput.25.119dd381cbddb993,"e",@progbits
+	.string	"(\265/\375`\226\001\315\016"
+	.string	"V\235bB\020q\224\016?N\200\324\220.\f\342o\177\217\235P\b\361:b\217"
+	.string	"\322\t>"
+	.string	"\263v\264fnC\365_c\013O\276\375\024\377\004"
+	.string	"\202\002 \005r\001N'\260\n\232\003@my\326\b\331{K\231RO"
+	.string	"K"
+	.string	"T"
+	.string	"\327\241\273\313\266/\342#F\366\352u\035N\336\2622r\202\306\356f\234\017\210\207\357\035\361P9|t\3704G\276\345\361`\254\254HR\244\303\222?"
+	.string	"\251\222\353&ez\234\335}\211'*U\312\264<v\327I\222\272p\307\333n`;\201\2350\371bw\244\324\r\366\337\252\312\216\351\215\2465\232\306\336\375\031Mc^\372\202i\013\246\343KCM?Mk\2463\323\017\320\201\"\203\301\214]\013/76\006d\361\301\366\310\316\244\375\224\223\030\275\013\271\200]\325\213\025\273\035\002\037\bj\351O 0\0325q<x\n\r*T\271\324x\360)v}Z\200%_\347\252\032%\300r\322P\312\027\247\252~$\207#\034E\252\002\223\347\356\222\324[\274b\036TZLi\3036\350&\266k\327\264\300W\2010\341:9\364C\342\341\325j\341\022\"E$\334G\004\242}D{:\334G\004\242}d\241\r\004\332<YHs"
+	.string	"\312<\034\205\254c\300\233\204\017\227\211\266\215\3132\266\335\355\337\252\312\3710\305L2TP\215b\024e{\243\034\021-\331W\021\362\312\327\342\341F\217\302`)\324K\177By\267\213\030\003\037"
+	.ascii	"Y\331\360\242\030\237\260\342\314Dzp(@\220;x\201\275\236)\fd"
+	.ascii	"\307T\301\245\256@\335L\034c\243%CH\002q!j\211\270i,\\\262\t"
+	.ascii	"\3155\314\340-\316\314D\016\252pp\227\222jP*|\236\2521\324\351"
+	.ascii	"\255-e"
+	.text
+	.section	.gnu.lto_firFilterDenoiseInit.26.119dd381cbddb993,"e",@progbits
+	.string	"(\265/\375`\244\001\255\020"
+	.string	"\246asF\360\320&\035{\276c\022<\3530x\237\371\370\002\0273B\364}_yu\033F\214\004+\372?m\3306\312\234}\2405\023Q\357g\357\036\206\237os\360Y\212\363\003\030\302\177\324\036 \302td+!\233\020)S\n]"
+	.string	"V"
+	.string	"a"
+	.string	"8\026\362c_Z4\020\270k\037\251i7p\260z\230\301\272\313!\306\340i\337\304kV\267i\271\200\335\031\031\260\335p\201\021p\327\034~@\274\306\035$^\363\312\266\361\360\303>\005\f\230\034\242\335\355\324\303W\317\225\377\234\003x\305\270<\267\b\273\353|\305\310\334z\333\"\266Q\354,\005\366\276\374\313\331\242\346\307\245.v\330J\355`?\333\335\265\316\330\343\341_:\316\337q\233\177\244iN\323\333\226\2161\255\305t\026\323\252\351\214\351\177\200\300fL\b\332\325\020\313\261?\032\013\032\333\367Q|\207\345:\336H\004\221\256\331,6\351\332I\266\365\304oV\0177\024\334C9u\272p\230\350\366\211\233z\350w\236\225"
+	.string	"\001\033\001\2443\024uS\215\001S\224\232\332'\251\370W\324\002/\352\342L\335\363!\231\335\365\201\227]\226\210\246Y\r\227\013\325k\246w\211he\314\251\252w\t\22545\204\007\246\250C\257Q\206'\346\022be\314\243T\241\373EL\360\221:F\031YA\001M\036\001\224\227\002U\276\217\004D\235\250L`"
+	.string	"\f\022LTH@\223\257\344S]8)E\237FT(\260B\312\244K\371<\357;u))\223\327\235T+\335H\210?\025\224\252\003\277O\325\221B\326\263\325\031\227\254\370ai\313\234\332\246\303\354\303\355\356\003\277\207\302\251Dcw\037\242%^{\316\rl\b\272\001R\021\033"
+	.string	"\016\301\273\264L\221\031O\251h\302\203\264\334P"
+	.string	"\023(O\260"
+	.ascii	"\203\337\340\2157\356\017\346\262\227\345\215\271J\027\326\204"
+	.ascii	"c,\0065\3031K}h\r\326?\002*4\006\t\030\200\021\001*\n\270\313"
+	.ascii	"\213v\222\001"
+	.text
+	.section	.gnu.lto_firFilterDenoiseUpdate.27.119dd381cbddb993,"e",@progbits
+	.string	"(\265/\375`}\003\355\026"
+	.string	"\226(\213I\320\360(\035GdN\032\341\226w\256\016\0217\366\3001**\250\327\306\200<EB0!\362\341\356k[t\202\325\324\360\207\035D*G$\020\341%W\353\nO0\013~*\345t\245\031\033W\311@V\375\326\b!\233H)Sv"
+	.string	"k"
+	.string	"}"
+	.string	"\nt\177\305i\t\230\346hT@w\016\215\240\356\334\311MD\235\317\211\377\257#\224\004\354/\277\334N\217\362j\\"
+	.string	"\322\321\335#\211\202\200:?\375"
+	.string	"u\262\007\205i\b\316\217\027v\255\321P\251\354\201\241\212\255\274A\253i\320\311\252\221\037Iw[\330\317\246\374\231\334\210l\254\332\354\0031\352`Cu\27265\331n\250\322\335_Z\355F/\352\177\n\377S~6\0213z\342;\261\273S\256@\r&\210=4\240Ne\325i\211-\007\023.\266\275?W\263\254\363\353\327\234#\262\373\020\375Q\375\320\234\352\200\335\263v\277\332\275\007\357U\273O\361\036\265{q\367!\357A\336\317\335\177\273g\336/\357u\204\300\215\021\203\031\335\031zM]4\205@\374\207\375\252\377\273\372\363\362\013\32062\fA\335}\362\250\243'\037\221a\274\f\371c\221\327\211\f!\333\336K_\274,A\332\031\b\271\204'\344\002d\325\221\223\317\207@["
+	.ascii	"@Rj\022\241\244\037h\267\"f\235O^^\321\361f\273\343\177K\313"
+	.ascii	"\357&\243fKL\270\030\363\307\353D\336d.]\361\222y\305\303-\253"
+	.ascii	"\370n\334Q\032\216\004\252\274\254C,\226\310\233l{\377\340\377"
+	.ascii	"\025"
+	.string	"4\305K\220\235\356^\360KP\0241:WH\007x8<230/.\023<\013\312\253E&\202\313\203\361\305\325j\271X\306\027\027\007\255\221\345\0253\242\214\334\005\323\362\032e\\\256\327\250\312\265r\316\231\207\363\004\206\244xpbL\021f\261\315\177\026_%\306\262\260\324\357\254;V`\305!\034\356\310\233\007\213\274\362\340oG&\251\230\350;\224\035\212U\254\033\312\036y\223\201)\026Y\204\225\034\232\234b2i\273\273f\242x\362\212N\006\004\035BqL\250\201(*\rB\206H$\220 \243%I\033\200\002\02193\017\0210M\246\220\026\026\224\213\001)\2407\307\243o\262\262\001\007&\365\003\241\360)\311\341\363;\312AG\266\333\207\3627\276\370\273\214v\243H\207Z0t\311\330\002~v\003\254\376d\205d#\270\346\270P \342\3468OfF8\270N\030\305\271Y)\207p\021,\357\263\030\260\266"
+	.string	"!\300[\275\372\233\266"
+	.ascii	"X\241cd\246\373\200\277\275\240\211\345\307p\022\001cT\230d\243"
+	.ascii	"d\r\375\030\005Jam\345e_u\245\237\002u5J\264\007\\g\214\227\346"
+	.ascii	"\353\207'\f\246\234\353\017"
+	.text
+	.section	.gnu.lto_biquadRCFIR2FilterInit.28.119dd381cbddb993,"e",@progbits
+	.string	"(\265/\375`-\002\305\020"
+	.string	"\006\037mG\360\320&\0353\312zm\252\t\330\340\304\r:\271_l\214\370\321\034\244\360\353\264\353G\246\307\300[\207\240\255Yp\262\277U1\251V\262\266\203-\242\356\300\345\024\356\334Dx\364\227\223\336\327\365\035\003F\266\355-wJ\001S"
+	.string	"Y"
+	.string	"W"
+	.ascii	"\372\335E\367\231\f\236\273!\206\fh\237\246\370h\237\305[t\227"
+	.ascii	"i\271\307\256\314'g\367\0131\001\355\323\337\005\210>\265\007"
+	.ascii	"\020}\272\263s\374+\261\307\331\340B\023\264\273\233\222x\367"
+	.ascii	"\330\371\3079\t\006\303z\0345\330]G\030\214\207[o\373d{\201\035"
+	.ascii	"\277&\275\346\327~s\217>\363\213d\364\224\321RF\253\214\216\032"
+	.ascii	"}\217\017\0256Ht\354\276\204B;\233:'n\363\337<\306q\\\2721\b"
+	.ascii	"\3622m,\306!F\201\215A\215\325\341\303\303\361\362\263\273\005"
+	.ascii	">\235\300\226/N\323\275\306\2404m\314"
+	.string	"\365!gwC\214@\373\004\221\001\273\007|\320\002\013\200\033\273{\023-40 \360\222\244RIx`x(T5%i:RU\225\235\320\003\021\325\340E\b\315fk\006a(\364\332m\235Fz\037\257\307\025C_\243\336\373\021\351U\302\316\016\227\241V\f\355\217\025u\204}\271\273k\225\331\227\371K\267y\016 D\224\217T\210+\026\324\004\223)2JDU\262\272pb\262\245p\251\024\207\332RN(\2446\224je\023\031`N\245D\265\2558N\265\225\276\275\\\2259\302\212YK](\357\2311\325N}'\276\246\216\360\324\360b\\\266\343\311\346Ncj\220\221\"\b\303u\036\360\2000 \251\366\312s\fj\033+ \220\202\021\262\363\251\247\b\343\241;\032\207\3556\325\033f2\023\320\001`\316\221\363\264\250\257#\006\312k1fcQL\374\311\306~#+\004\374\032\272'\266tU\275\211\241\t\364"
+	.ascii	"}\001\311b\254\336\202TQ6\356\314\304a\233P\250\t\227U\340\257"
+	.ascii	"8\227\302g\216rYZ\216\006\274\274h\027\031"
+	.text
+	.section	.gnu.lto_fastKalmanInit.29.119dd381cbddb993,"e",@progbits
+	.string	"(\265/\375`\333\001\305\r"
+	.string	"V\031ZB \221Z8\234\301\362Gg\270J\003\317MS\273Yd\360\333\260BS\003\270\314`JL\306\277^\206\304l\203\335\r\373\330\177\3306\201\234U\b\320`\372\016\210\001@\304\200\303z\360\326Q\321&R\246\024D"
+	.string	"F"
+	.string	"J"
+	.ascii	"\366K\334\004\367\027\224\023\330\025\215fv\277\217\025X\247"
+	.ascii	"\374\335@u\312z\201\352\2249\273\346\237\313~\344\222\001\205"
+	.ascii	"\270\273\227~8\367\344\374\247\370&\304\222\362\004\360`w\235"
+	.ascii	"!\026\016\267\336\266\3076\210\235\025\002V\221}\231\237\363"
+	.ascii	"\230\337\372\313_\035\346\2372\255\231\316L_\300\201\0332 \200"
+	.ascii	"\273\033F\036[\242Z\204\260\375\216-cp\032\260+\336J\203\230"
+	.ascii	"\035\f\362\373\t\3560\006\275\331}Qcfw?^`\235J0=\003,8\252\212"
+	.ascii	"\2053Rm\n_\341ih)\325X\232\212\2051\256\266\205\217\fZ\273\013"
+	.ascii	"\342\253\330.\004\240\001\002\245:\365\036\241\034\035x\225\026"
+	.ascii	"\033\035\326\016\3061\304\260\333y&\275b!IE\204\227\243\375\245"
+	.ascii	"\244z\260?\355\356\006$\337^\362\312\240\217-\344d\202\210\204"
+	.ascii	"kD\3132\rt\215\210D\310.\320fr} \260F\022\262]'\232\266]\235"
+	.ascii	"o?\255\212\214\341(u\352e\207A\022\265\323P#H$D\333\351\261K"
+	.ascii	"\356Bu\320\210b\227\243Um\223\007\" \320\202\2211\353\251L\021"
+	.ascii	"\210\207#\321 \354\266qY\343\344\321\374\353\f\003\002\377\255"
+	.ascii	"8f\230-%\300!{\321\314\310\220\213\304n\034;\307f|\254\r\302"
+	.ascii	"\302\361s\f\314\031n\311p\022\212\247d,\206\325D\332`\201my!"
+	.ascii	"@2"
+	.text
+	.section	.gnu.lto_fastKalmanUpdate.30.119dd381cbddb993,"e",@progbits
+	.string	"(\265/\375`W\002\035\021"
+	.string	"\326_mE"
+	.string	"\261h8,\221O;@\240\232\203\274\035r\362\323\240\020\261\021\376B@\030\306e\200\023\035\354\351\336\327\026HA\360\336C\027\352\036\201~\005\376\377\377\022\325\263}\263'['\337`\326\226lm\357\275w\2222\005Z"
+	.string	"O"
+	.string	"`"
+	.string	"\236]\02590\273\013b\003\251v\302r\204*\307\223\334\330U\221\301\354\216 .\340\345\346\321\263\355\f\221\"T\266L\0339\254p\025@P\210\315\330]P@vp\271i\t\200\313\355\033R\225\252r&\211\324djfZ)(\251\335\201\335\265\266R.\244\237\266?l\213\330\032#\177\013\213\035\330Jg\366\210\242\327`\247\266W\261\323%\223#\307\314\rU\217T-R\365\247\352\220\252A\252\376\250\332\243jO\325\235\2529Uo\252\326T}U\253\252\323\303\303\203\213\004-v-\314h\254\315\026\323\301\266\312\006\331VM\027\313\034\246\214\311\032-\035\317\273\177Vx\357\356\371\026\023]\2540a\274\177\023^|\340\276\275\373kD\027\353A\246\340N"
+	.string	"\007\266*I\024\3337\0317;0\355'>\030\bh^Z:\177^{\326\020],\235Y\237\377\237#\276X&iB\377\201c\bY\3022owE\2341\005\021\274\225\023.\267\f)\023\222Si\343L\nA\215\244\034\224\032\200\247\320d\nI\340\251\304\300\004\222P%`H"
+	.ascii	"\207$#(0\025\206(\0204n\332\337;0\264\330\254\316\362\3503\242"
+	.ascii	"w\037]\273\021Ydi\225\260\273\032 \372\202\232\027\361\365]&"
+	.ascii	"t\355\037\350\237\207\376\033\221E;\307A\317\f43\361\365\271"
+	.ascii	"\035- p\002\2219,\017iL\221C\343#<H\350M\203[\352\242Y;D\022"
+	.ascii	"\370v\212\326pm\026K+\353\241\031\272\320\034\25160\273?\311"
+	.ascii	"t\2401^l\322:)\274*\223\313\225)\\p\250i#\031\005VF\306[\340"
+	.ascii	"|\255\033\266u\2454o\306\205\240].d\2033\261\303#\242\250p*\312"
+	.ascii	"%\320|\355>\211\024\323\365\310"
+	.text
+	.section	.gnu.lto_pt1FilterBankInit.31.119dd381cbddb993,"e",@progbits
+	.string	"(\265/\375`\207\002\305\024"
+	.string	"f'\212I\300\322Uc\202\023Z0\230\227\021\177\356U\1777\037\324\201\373\b\023FQ\240)\224\257\355\204\340\016\361\243W\232[X\r\351\305\207\226\360/\217CB\003\262\b\252D\f\020\212?i2\276C\020\252\352,[\303\266{K)S\nq"
+	.string	"r"
+	.string	"x"
+	.string	"\367\346,\225\247\366_\034\306\354?2\037p\257\316\215\243{\315\022\217\220\027m\336\300x\221<\201\361\242g\266\217\233<\367\273\0365BO\367\336\262\242\260\2755oKg\027m\2453_\350\013\200\300\033n\346\242]\t}H\260p\037\354\003\234\"\341y\2476\270\032\265=7\257\347}\344w\336p7\247(\t\367^\323\033n\304=\336v\314v\212Mu\001??\352A\377x\363\2677\272i\245~"
+	.ascii	"\004M9.\354\2707\3049\274A\021I\305u\277\221\375!\237g\225\221"
+	.ascii	"}\344\214\b2\267[\212 "
+	.string	"\343:\177w\242\231\354C\266\340\344\342\336+\363\211\254\272h[\366\234{\366\022}E\013 \323\275\227\344\242Q\310\213T\025\343@\263\007\271g\005\\\233\032\210\243{o\211O\310\213\nl\245\266\203\223\331M\017\256\001\275\002<\367^\024\033v$\016\344\275\027\302\214\027\030\026\217{\357S\310\214\027\317\273\375\001s\267\0374z\326\212S$\354\251\016\251ceU\252\303\226\264\252c\r\251\250\0239[\216\252\272w\023\303`\360\332)\3479\244\271\227&\262\252\307aK\252\321\323\257\252\372\335\031\370N\033\223\255\257\251\237SM\020\032=m\263F\353\216\320\007\347\310U\207e\251C\256\273W\226Z\225z+/\025\027;\201\002\255\240\201\306\310Z\030X\304\r/\225\f\326-\223\330J\214K\013K\371\202\271\\\260V\371jQq\225\255\030Li\222\300\260\227\225X\031\003\203\305J\225I\273\320I\033NAZ\255\211u\307"
+	.ascii	"\224j\252V%JrZml\333\336\276\221\3267\001)\321P \267\266\301"
+	.ascii	"iM\325\227\370\235\266\234Z\3176\025\251\341\336\001\327}(\026"
+	.ascii	"\303\247'\032=\315\252\266;\234\206\003/ \220\202\2312\262\003"
+	.ascii	"b@\fgI\330\352\204C\231\335/\210]\022c3\357on\025\005)\033\274"
+	.ascii	"\326\027\031hC\261\032\345Mxax\303q\304\343\201\r\313\236Q%\214"
+	.ascii	"/N\371f%L-\274\226\\\277\037\213\275@\360k\264\342V\242\366\372"
+	.ascii	"\032\314\360?\221h\240m\270\t\210x?7\200(\365^~\210p/T\217\367"
+	.ascii	"!\322\271\362\023"
+	.text
+	.section	.gnu.lto_pt1FilterBankApply.32.119dd381cbddb993,"e",@progbits
+	.string	"(\265/\375`^\002m\023"
+	.string	"f\244~H\320\322(\035\226%\306\205\266(\226r\207\002\020\233\302o?\204Q\242\252\311\200l\333\2601]@_\240I\222\252\355\357\025\347zz\373\232\230\300\205+\274\340\nOi\004\214\022\232n\311\305gT\251\331\316\366\244\021\262\245L)h"
+	.string	"a"
+	.string	"n"
+	.string	"*`\337y\271j\316[\221\320\234b\003\207\200\367,\236\300w\017\374\200\357\236a\366\215\2137\3635\226`pJs\316pEX^\212\267T\330=\271\n\363y\276"
+	.string	"\311\250f\213\335\223"
+	.string	"v:4)\333\006\351`\006h\367\3345\3066S\211#\363}\356!Fc\315&s5A\230sZk6\017\367w\333.\333&\266\336\0046\266\030\323\275\355tf\204\2747[u\361O}\347\017p\334\215Z\365i\325\340\252M\253\376T\355I\265\224\352]\265\256\372\002\020|\240\021\201\307\234\034F\037\363\310\033*q\334\355\257\360s\006\361{\356\003;\316D`\254\003\310\342g\3041\347\024\271\347\007\340=\005\362 \266Ut\220Rx\265\237\342\001:\032\334\357i\275%Z\315L\307\005\327\264D\313\371~k\332\0036h&f\027zY\007\372\016\372\356}\373\030\032\331\246\326\333\323N\310\273\350\333\225{Z\316LG\243v\327\200\016\230\0370\254;i\035\250D\367dD\205\277\260n\344f\316ibc\270\013\027p\316Y\322\"%\003\003$\022/\373\334Eh>(\206d:\356\316"
+	.ascii	"\355pv\003*\254\025\213\\\275V)\322\002k%A\032\205\304\245\362"
+	.ascii	"bY\231\020\262Z---\224\220\265\262j\tQ\\.!I\002\267.\250\270"
+	.ascii	"\302W\253\345\nA\304\371\275\361\034\224\001\342H\2663om|JZ\325"
+	.ascii	"n\222\212\034\2651\266\211>\324~GO\222\006\355q\213\261\3139"
+	.ascii	"\347\224kc{\344\250U\355C\030\215\264\232\031\205\237\323\306"
+	.ascii	"\260\256\300Pjg\324r\310\0020 p\202\221c\326\rb\300\277\306("
+	.ascii	"\220\343 \32428m\2456\253\203\003E\306\026\203q\251Jq;\354\310"
+	.ascii	"\350b,\266nx\035Q\214\337\207\2153\264\203\222\315\206\347\326"
+	.ascii	"\022\001\b\340W\264\350P\254\005K?\004\336\343\203\t\311\230"
+	.ascii	"\301\021wH\207QCJ\221}B\335\356\025\241\003j\270\347a\001\207"
+	.ascii	">\367\242\206\b\354\205\332\361^\"\235k=\001"
+	.text
+	.section	.gnu.lto_biquadFilterBankSetAll.34.119dd381cbddb993,"e",@progbits
+	.string	"(\265/\375`\027\003\255\023"
+	.string	"\346c~I\320\322(\035P\226\304H\260\272\304$+\030\333G3\330\252M(nUPk\250\220.\n9c\231\352\222d\004\017xh\205e\303\255=V\326\337'\261E3\310\265\036\222\322\004\f\365k\241~\026\245\350\366\177B\310\336{\247\024g"
+	.string	"b"
+	.string	"o"
+	.string	"\267\261<\300\256M\017\241\335\221\201C\302W\217'\360\275\206\037\360\275Zf\347\370Xb\301\0235\036|z\354\2568I\230\236\2167\225\262W:\245\314\347y\002\336\rZ\255\345\225\246v:\"@j\035h\003\232\237\335q\2271\265\231\24493\237\307=\204\027D\253\315\\\202\020v\327\222V\003q\177\267\035\263\375\300\236%\00166\225NQi\024\225>Qi\023\225\016\301\217\377w\333O\177\273/\300\300\214\244Vo\367C\357\307\352*\021\212\337~\373~\317s*w\341\031\242(\305\356\236\205\217\363[\334G\366\233\213\302\026\231\020\007dB\307\356\212\274\232$|E@Ul\324\353Q\266\345\270R"
+	.string	"\300\276\364\340\210\227\366U|\205,@;'\032\025\216Tr\243\323\222I\206\3521V\207a\232\340\355g\307\026N\016'r\020\210\203\347\314\372\020\206\024\216\335%\021\332\320b\371^\245\022m\307s6\371\013W\270\373B\342\003\305`>\316\312\367\032\316\347\256\340\206[\262\271\310\336\244\371\331\345L\203\36227\322'r:m\024\r\3624\313\243!\035\314l\261\307\231\2347;\035\032!\317\254\227\352\204~&/\225\005\352\325H\214\225r\322\272 \276`.\027l%\276Z*\227\270\212\241\210#\007\f\313\300\212\211)0XLD\215.\2376<\017\217\214t.sV\347\215M\274\t\316\311\223\"\377\214q\321\367y\036=\274\027\351\343tw\227.\370'8\217{\035\301\013\202\251\231\311\236S\273\bW\222p\033\251%T\322\204\353(\274\006j\202\267: "
+	.ascii	"\003\031*\312\001\306\024\251\320\236\207\253\225C^\221\033l"
+	.ascii	"y\276\212b\372\345\362e\214\342\304\033\354\225\3716Fq\304zo"
+	.ascii	"f\rWtQ\306\275l\0261\3062\003<\006W4\033\005N3\n\250PE\030'\311"
+	.ascii	"\265h\354E[\355\002\247\353\031p\304\324\034\305\255dm\323\357"
+	.ascii	"\207\307\212\016\226W\334\315\322X\233\246\371\303\002\204\256"
+	.ascii	"\356%\207\b\354\205\032\343=\211t.\377\004"
+	.text
+	.section	.gnu.lto_biquadFilterBankInit.35.119dd381cbddb993,"e",@progbits
+	.string	"(\265/\375`;\001\335\r"
+	.string	"\206\331\\D \221\323\030p9\202H"
+	.string	"k(\360\371^F\3600\344\202%\b\312\240c ,\206@\025q\371?\373F9a\343Z\\\326\367Q\266Nb\362\007a4\2510B\0137\333\t*?\"c\"\264\244I)eJ\001C"
+	.string	"M"
+	.string	"D"
+	.ascii	"\255]\274\242\363K\006\007\370U2l\376/\244\t0\317~\036\300\361"
+	.ascii	"\304,\200\343\331\256\245\341ou\267Z:\264\300\361?\213'"
+	.string	"\334\031v\265[\366\244X<\303\016\203\377\205)\226\020nt[\003m'\264N\021\257\035wM\030(Lc\267v\253\240\332\205g:\323\240`\336\212\203\017*n\376\025\020\317F\300<\341\210\003R\006C\216\0061\255\221\036\367\24023\022aR\244\3077\224X)\200\237Ytf\265\246\236?\206\016\233\377!\3150\317\002\3220\020\301\252\023[\022\311G\r\027\207\350\325\003g\2241F\030\375\302\255\rK\265''\350TAZ\\.\"z\355\347\301h\242\265\374\377FU\353\027\273c\031{:\306\226\206\261\243Y6\374|\330\230q\341\365\203\b\234\206*!\2158\232I\212\204\007\326P!\b\026N\0327\3228\320\211\306\215|HL\241\n\262\"\021NC\225\220F\231i+\2256Qf\"\205J\231\210;e\"\004\272\231h\\\206\3326.\003}\267|T\225\302\r\227\206\250R\024\371\223Xp\303\202\257\002\b\035"
+	.ascii	"x\346`\231\243g\342M\030\356\354\343KL\030\245\016'\325\345\321"
+	.ascii	"m\316\326b\300\205&m:\207[\016\342b\2060P\r\\\001\303\005\362"
+	.ascii	"\274\302\003\226\001U\"\214(!n \006\270\"MM\001wy\321N2"
+	.text
+	.section	.gnu.lto_biquadFilterBankInitLPF.36.119dd381cbddb993,"e",@progbits
+	.string	"(\265/\375`A\001\375\r"
+	.string	"f\232]C\020\221\324\030+<\177\245\b\356\230T\346\001R\352\360\222[t\034\320\016\346\335\213\224|\262\240\237\007!\347|\200\255\373\333r\224\261;\035P \332P: @y!k\261\211V\314{\260\021\373\211\224R\246\024E"
+	.string	"K"
+	.string	"G"
+	.ascii	"\006\244ak\225[<\273\\\260\200_e\306\314\377\2114\001\346\331"
+	.ascii	"\317\0046\236\230\007l<\353\2654\374\255\334"
+	.string	"\256\026\r\254\033\377\2658\302\236\241W\233e\217S\252d\330\321\340\177\341)\325\301\215n\033\322\366Ak\230\323E\t\267\354\3265\013\267jW\263\030\217d\230F\210A\252c\232y\326)\254\202\344\025(X\t\345`\303\t\232\037\245\300\263$\230'\374p\300Y\333\370bA\0068\206\020,\013\340g\024\236W\225\251\307\377\"\307\314\177\221j\230g\005j\2742\304R?`\r\332T\306&L\252\327+\177S\210\2141\272\205]\034\366\277u\"\202>\325.\233\205\204\352\036b\251\375R`\024\321Z\376\177\243J\353\027[zeG\273\330\020\003A\311(\261\361s\250\301\361W\33562\371x6\333\210\003\201\202h\353<[\227\235l\035\311GI\210#A\2663\322m#\223\217G\013q \020\327\321B\037\016H\353t\"m\004\244\\\205\255\323F\034\327i\331g2\313\030\214\324\313\024S\212\"\177\020\fhV\260\246"
+	.string	" \202\025\030\353\326\204O\035"
+	.ascii	"\006Sd\206\006#\026\013\300h\261B&\214W\207\273js\353b\205 \301"
+	.ascii	"J\020\200\313\004V\301\300%\252N5\r\003-\302\303\205\303]\037"
+	.ascii	"\215\001\214x@\225\b#J\210\033\210\001\256HSS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_biquadRCFIR2FilterBankInit.37.119dd381cbddb993,"e",@progbits
+	.string	"(\265/\375`\265\002\035\024"
+	.string	"\346\345\203I\320\360(\035\202`u\335\3104\316\303\032Q\255\371\020U\320\3730\025\366\306gK\006T\225\031\f\371_cL\333\377\305@/-RyL\007\037\b?\004\264\016\341\016.\210\246K\325\017\237\261\330\360\377\374\301&>\356\275wJ\001j"
+	.string	"k"
+	.string	"r"
+	.ascii	"\005\250\212\007\211\027\362HU[##\221\333]\022'\370^E\350\264"
+	.ascii	"=\205x\240\fR\2653\331\206\360{U\311K\373'\216B\374\217\206\013"
+	.ascii	"\330\335\261\221\333\265\221\370\300\367j\333\007x\274~\007\361"
+	.ascii	"x\265h\337\270\215gOt\243\tb\332\335p\216\270x)\372\307\375T"
+	.ascii	"\303\201]\002`\260\273\2265\034\017\367\274\355\021\333'\366"
+	.ascii	"<\t\376\376\363\327\013\375\364@\277\234\322\007\t\311\211\341"
+	.ascii	"\262\264k\323k\332]\325\225\270\321\257\373o\237\366}\027\327"
+	.ascii	"\371F?2\230"
+	.string	"\023\213\304\327\207\034A\006\370j\277\374\242\347\f\216\036Ef\252\255\251\351\320\323\340{\235\310\343\007\273!@\243a\303\333]\223\357\365\307\031\364Y\274\205\370\233\314\007\273q\300a\210\267{\203\340\325\013\276W\031\"3D>L\255\007Ic-\307\307\274\316\030\216\363\230\232\261\273\ndP-\307x\n\316\217)!i\005\315\004j\322\t\236&\235\250\t\203\324\243\345|\323\343u\232v\273\265I\257\3274\333\215\215\234\346a\320\224d\262\347\317o\376\350T\tI\007\215'\347'\252\006\016\232\0351\331\263m29E\330\247\273\273\236;)*\375q\335\rRi\324\215\356\023\225\001'\020d\313=P,\310\030\231\025\205\225\332\362\222R\201zU\342R\211qaY\t_Z,Vk\025\276\260\244\260\302\225\353\025\226\204\270\005\243\342\ncZ-W\b\332b\247;w<\001\304.6e\226\241\273:&\277\375< \331s"
+	.string	"\371\241\343V\006xv\367\265:m\225\013\3625\037w\324\213\017\273\231\tc)\362aJ\265\310Yj\242$-\321zd\266\345\310uf\3253 \260\202\021\262\365\267\032(\013\335.p\""
+	.ascii	"\r\246e\267\211\326\235\303X\026ri;C\225f\234\3730h7`w\313\204"
+	.ascii	"\234\031\2662\\\257V\247\301z\024\353\007\304ZLQ\247\223\264"
+	.ascii	"\001\227P8k\036\007\355j\231\326\022\376(\370\034OJ\314\336\202"
+	.ascii	"m\\\253L\353\310H0\347v\002\236e\265p!\317U\370\314\321_\226"
+	.ascii	"v\243\301\227\027\355\"\003"
+	.text
+	.section	.gnu.lto_biquadFilterBankUpdate.38.119dd381cbddb993,"e",@progbits
+	.string	"(\265/\375`\357\002E\023"
+	.string	"\026\243|J\320\362&\035 \332\243\257\203\t\202\031nT\365\211\007\211\367`\235|o\"\273\345\244[c \2469\206,\031C\004\354K\213\037\344^\260\222}\222\217\252\nDG8\204\261"
+	.string	"\212\230v"
+	.string	"\021\205>#\327\261iA\266m\262wJ\001b"
+	.string	"d"
+	.string	"e"
+	.string	"C.;\221\375p\263\203`\332\336\202\274\220c\030d\227\007\n\267\273&\006\275\327\001\335\247}\240\007\221\257\321|d\267G\007n\327f\342\003\336\253m\027\220z\365\016 \365j\322\346q\333\211\375\216\032\036\\\374\330]\220\2328\371I\372/\017B\323\251\371T)\330]O\232\316\210\233\3366\001\333\027l\332\022\323\253\013\375\336k\277\352E\177=\321\337\375\366\323\017\3753"
+	.ascii	"Im\tvcWD\024\324*\325\\\212#\375\366}\030\317\331\237g\216\263"
+	.ascii	"\204\036+v\367{\265g\354\357\365/\375\371F?\"\217$\363jrT@$9"
+	.ascii	"\355\346\224\274\232\202\367:I\024\250E\033|B0 jR\351n\034:\221"
+	.ascii	"\305)\021\224B\003O\262\360Q\325\315\350\247\266\242\261\323"
+	.ascii	"p\331J\360\2341|\206\213\325\264\273(2d^>\n\232\324\353d\242"
+	.ascii	"\371x\316\341\313\f\336.\016\312\212>w\003\267\027O5\233\031"
+	.ascii	"\345oV\332QJ'=\356%\214G\263a\342<\315%*\200v\207\326\330\266"
+	.ascii	"\233I}\354w\273\273\246=6\235n\321\351\020:\315\242\323\037\r"
+	.ascii	"c8\213yqI\2052\035 \254<\234\271\034h\220\205\243K8~3\341\270"
+	.ascii	"`\025\306\\1\035L\314\325\322\371u2\206\263\230\027\0270&\302"
+	.ascii	"`\342\013\214\275\270`\340k\224\201'$\026e\302\021\234\211\342"
+	.ascii	"\b~6\233\323\036\263\260P\262\2417\226u\273<)\345G\234\204f\224"
+	.ascii	"[9\032\274i\245\365\024\302\364\3408\"\204P\325\355\350\207\265"
+	.ascii	"4\341J\025XO\237\r\226: @\003\021\332\264\001x9\314\305\354\231"
+	.ascii	"\320\220\345dDR\374\002\303\345\313\230\342<[R\234\314\030N\210"
+	.ascii	"\257\210\223\231\341\n\361g1!\363uc\2303\324\271R\223\331(p\227"
+	.ascii	"Q@\fU\216r*\301\325\023\005\257\f\0277O<\220Ab\370\272\367$l"
+	.ascii	"\265\241\031D^\307\242\230\275\036\013\243\207\005\341\345\302"
+	.ascii	"\317)\202%\260]\221\206\246@]^\264\203\f"
+	.text
+	.section	.gnu.lto_biquadFilterBankUpdateNotch.39.119dd381cbddb993,"e",@progbits
+	.string	"(\265/\375`\020\006\265 "
+	.string	"\326\372\314H\240TN:\025\213\363<M\336\273a\243D\325E~3\374\251/\322\006Z\214\252D)\3607\330\322\016s\323\335[\365\246"
+	.string	"\252\334oF\371u`Z\370\rC\202>y\002\322yc\274\351\377\203\272\356\353W\262\215l\271S\n\267"
+	.string	"\241"
+	.string	"\300"
+	.string	":&[wr>\310\205<\354c\326\211U\251"
+	.string	"\2266\341+(4\334U)\025lYE^\301\362\211E\200(\033mVj\255\006N:\202M\273<FwUJh\366`\177\230\330\331\325\241\217 \013&\327y8\275\207\217tW\2072R\220\325Z\021\230W\236\024\242\237\366u|\207\323\267N\334\246\326+5\262Z\271\020\270@y\322\\\007\200;Y\036\007w\322Nv\332\271\212\365hSP"
+	.string	"a\253\265\362\226\306\235Nw:\371\037;L\324\324\323i\314\024\325\227\026\260BBE3%\244"
+	.ascii	"\230\310\250r\343\247\324\324p\316\034\204Z\253g\324T\213\233"
+	.ascii	"\274\355\b\266I\330\270\242E(\214(k\230\300\235\374*\350Z\323"
+	.ascii	"\332\202\232o6\227p\356\f\373\264\356\225\375\036\277\320\267"
+	.ascii	"~\001\367\272\203\376u\003\035\354\376\231\323>/\273{.v\363\320"
+	.ascii	"\351\235w\375:\377\361\007\240\3239t\032\207N\337\320i\033:\275"
+	.ascii	"\243\3235t\232\206N\317\320i\031:\255\243\3231t\032fN\227t:G"
+	.ascii	"\247qt\232\244\323\224N/\235\236t\372\003|\334\230\374\224\324"
+	.ascii	"\272\342\315K]B\032o\274\354\367\372\277~\260_\354\366\311\374"
+	.ascii	"\243ue>\226O,J%*\3202\224Cn\264uf:\231\201\212\265\3262\033D"
+	.ascii	"\26352;\2634R\202D\305\263\031(\276?\221i\323mn\201\254~6fuK"
+	.ascii	"j!\342\310-\314\306\354\316\221\230\365\273\223 Q\261I\203\""
+	.ascii	"\314\022a\031\017\334g\313\315\241\021\255\\\364%A\001g\265\016"
+	.ascii	"\035\330\037\256\004\351$\320Ynsk^\264\214\270\345\331\237,\237"
+	.ascii	"\305\221Ti[\210V\334\356#\256g}\226@\0301\013\317\366\354\217"
+	.ascii	"'\331\322\324\210f\344\322\345\331\031F\304!\fq$\344\036\n\326"
+	.ascii	"\334\235\245\373\261\323\034D\326\204Q\272\262\204\364\253\263"
+	.ascii	"\273\236\304,\3029D\013\223\030\2733\254\263s\253\\\024_Pqb6"
+	.ascii	"\234\\l+\375\310\334\006X\006\336H\260\254u\310\300\017\0061"
+	.ascii	"\304\004\242\251\247\324\323\3430K\370:\374\220\310\037\020\251"
+	.ascii	"\351\250\267\344\241L`4\025\364\346\b\337\222\204\030_\222Q\257"
+	.ascii	"\211\364\375zI4\304\257gD}4\264\344kJB\362\300\373\001\225\224"
+	.ascii	"\200G\274\037RO\211w\264\304\304\033\3621P\204o\211\327\004\004"
+	.ascii	".\361t\266\315\005\365\275\262\005\"\273{\343a`\034\263\324n"
+	.ascii	"\314\271;+\245\341m\t\324\n\235\363f\341n\363I\324\025\234\335"
+	.ascii	"m\316\322$7\213\263[\233\275\361\022$*v\261i\273p\266\335"
+	.string	"\346\326\336\264\214Ak\030\256\245\r\b\213\206_q\323\n\262\262\341jmU@\273u4\217\321\234\325Z\035\330\034^\245W\326Z\031P\201p$sv\002w\222\354\372\242UU\263\001o\250QP\345\020#3S\022\224\266 )4\006\320\002\021)*n\021 )sP\315\210HI\252\205\003I\303\251oq\025\276RZ\007\340\275\351\205Z\016\257\377\003*\275fE\033{X\033\323\260\257\003\302\"Y\233\313A\253\017 {\241\323\266\335\037\373\342\204\203\377\250\332F\214\222\362\220\022=\\\t\021\001\301\221+u\350kD\274\373\213@;\037\264\204\002H#0\374\346 \034\235\335\020o\tb \352iGf\013r\003\276t\037\233\340\024\360\234\2019?k_\260\0218\034!\0062x<\364v[\230\t\026\222\264\230\033\232e\376\377\221W\362\324FV\261\02708^Ao\301\244\006\272\211\205\251\244\213\357DR\327\300"
+	.ascii	"\3107`\212\322_\3000\177@\201\033\312\300\322\016\177\241\245"
+	.ascii	"!\2245\214\243\006"
+	.text
+	.section	.gnu.lto_biquadFilterBankApplyDF1.40.119dd381cbddb993,"e",@progbits
+	.string	"(\265/\375``\005\365\035"
+	.string	"f\266\274I\260\326M:t\234\320\3471\375.\277\360\\\363\027\024hT\363Jd\bz~)\2614S\360:\367u7\374\226\227\356\274i\030\367L\251\237/?\310SZw\236\375\342\220\331\323\030\003\003\264'\256\230\2147\213|\262\211\334)\005\243"
+	.string	"\231"
+	.string	"\255"
+	.string	"\344\320\n"
+	.ascii	"\300\033)(\220\037\3427yv\3523\235\210\320\205\266\"\207V\220"
+	.ascii	"N%\320J\255\225\301\251#\220\247\005\304\317l\317\240\245pj\265"
+	.ascii	"\210\351\304\355\323\376\217\003\021z\220\022\247\251u\211\312"
+	.ascii	"T\255A\007^@\236:x\333xJ\336f<\265\220]\345A\032\365^'\214\204"
+	.ascii	"a\265\326\333\316\260x1x\213S\350T\334)\344\013\271\0011\255"
+	.ascii	"#\244\241S1f\270\303\005\r\311\204\bA)j\370\246O \022\321\024"
+	.ascii	"s\264\370\276\351\013\302\236\034!\265\370|\271Pk\365<Bbq\217"
+	.ascii	"\267\315\263\215\301\2460\002<\304\273\311\370\235\373\237\016"
+	.ascii	"\2429f\333~o\344\224E\230\226Q\027\337\034\333U\212\032\346\330"
+	.ascii	"\225a\007\207\346.\rw(My\227\354\235?\335:\017\362\0078\324\235"
+	.ascii	"\363\340\217s\341m\243\3237t\332\206N\327\320i\032:]\243\323"
+	.ascii	"3t\232F\247e\350t\f\235\236\321i\030:-\243\323$\235~\241\323"
+	.ascii	"#\235\246tZ\234\323+NOq\372\006\006\364\2002BI\255*\306\266T"
+	.ascii	",Ju\343O?\324/\374\332\267\357\344\027\271\021\317\240H\024("
+	.ascii	"\252U\240\n\0248.\220O$\002\303\332\312,\315\0228\362\3031\263"
+	.ascii	"\264\255\255\002\253,\2273\t\317\243\314\252\231\235I\240\270"
+	.ascii	"\234\302\334\261\306h;\2051+[\231\r\300e\2660\033\263\002\204"
+	.ascii	"W.\017\366\341N\274f{\260\032T\276&.\237\265\325s&W0\373,r\351"
+	.ascii	"\312v\354\372\305x\331q\311\305\001[\342\362U \256\344R/\373"
+	.ascii	"\252\032T>+\227\026\266~^Uak\\\013SrV\\\272\264\353\247\203\310"
+	.ascii	"\326p*\227\t&\330\273#\tA\326Z%Le\bB@\243\304(\323j\022\243\362"
+	.ascii	"\245F\270<\260e\303\267\324x\232\263\263\013\350\3027\307<\027"
+	.ascii	"gw\377\013=\021@\272\036\332\363\021\021\224\343\2159\035\316"
+	.ascii	"G\304\365p\035D\020:\034\007\321<\017x\271\236O\217\207\233n"
+	.ascii	"\367\363\263\343\271\351zp?7\036^\320\355\201\216w@9\336\255"
+	.ascii	"\267\333\361n\263`\375.\t9y\345\003\313\267DteX\306\265;\273"
+	.ascii	"\\\223\301m\013\264\325"
+	.string	"h\333ca\342*\232Z.\326Z\253\350\006\267\355\316\276\351\364E\330\223_\f\"\352t\304G\222\016\026\260(\261\244\231+_@bNG_9V\274\214\234\304\222|].o\266\250\320\200\302\262\034}\335,\315\352\354\354\262\331\232\275Y\007R\270\\\316,\033>\005\314fg\026-\227s\210\373pf\325\354\fg\250a0\005\025%b4\"\245\005\005i\326\360\002\021\"\3326\021\020\035f\226H\205\242\2551r\374\360\250O\"%|\271~\255J>n[\332{3\243\002\242\357\255\251B\307\022\353<\003\003\3508\310\252\241:\fR\362\316\227A(\256\333\215\323\354EO\n\205r\275\362d\310\222*q\203\271v\312\221\355\006s\355\226\330\245\b\312\264\020c\020\261H\334XX\237\n\347\341\251\f_\254_\214\213y\371Vm\266F\340\302\023\003F/\n\367M.\364x`\360\261KZA\2720\221+\020|\346\374"
+	.ascii	"\271s\211\371!\t\257\272\210Q\273n\332\307\212\316C\002\361\240"
+	.ascii	"\"r\341\350\2202C\300V\033G\200.r\035u\376\007\323\016w\376"
+	.text
+	.section	.gnu.lto_biquadFilterBankApply.41.119dd381cbddb993,"e",@progbits
+	.string	"(\265/\375`|\004\355\032"
+	.string	"F1\252H\260\230M:\020\202\007\266\177\021\222\002\320\310\f\245\374\214\261\\\302\205\327q\3006\277\204\337\n(\356v\312\377\272\016\3100\366\271\366\230etw\310\177\310\377\212\201%\tc@4t>\276\276\354\253\034\260a\202\310&R\246\024\217"
+	.string	"\212"
+	.string	"\233"
+	.string	"\227\276\220\017\311\335\347(1h\205\370\033iT\231s2\270t\004\361\322"
+	.ascii	"\370\227m\355\331\251\213\354j\277\307}\344\376\303\304k\346"
+	.ascii	"<\272z\232\263\347\300\013\304K\367\036 \274\024\037\013/\235"
+	.ascii	"\263\247\2747c\236J\214\024\276,sN\331\"\031<\330\273A\315]\202"
+	.ascii	"\2539\037\310\017l\371\021\361\202.\301\230\252\035/`<\024 \204"
+	.ascii	"\"#U_\272\356xC\n\352h\361\375\322\027h\215D\274\026\327\227"
+	.ascii	"\013sN+\021\217\305\035\336\366\3156\006\033T\n]\204tk\267\310"
+	.ascii	"H\225\216]\031v/H\367\250jG\321\223\367\310\3269\323\235\363"
+	.ascii	"\037\277\2007\3358\357\3757\367\3351\251\266\221\352\032\251"
+	.ascii	"\246\221\352\031\251\206I\265\214T\307H\365K\252a\244\332%\325"
+	.ascii	"\242T\277Hu(\325R\252AU/\250VP}\002\004\252<)\361\233S\305\026"
+	.ascii	"\227I%\241p\234\351o\372}_\373\366\177>\221\027\361\253\211\204"
+	.ascii	"\201\0234s\247\242F\216\013\"\023\t1h\305\315\016\207\215\n\342"
+	.ascii	"\203\370K~\005FN<^\312\312\303\233<I\314^\nf\305}mxD\227#g]\013"
+	.ascii	"\263\002\242tIL<\356\364|\311\004\327\356\274\254\270\362\210"
+	.ascii	"\022\217\t>|\252\300"
+	.string	"\313\272\220\244\224\302\225\233\263\232\2453\212\362h\301\352\347Iv\254\302\265p\205\263\340\312\225Y\272\244![\303\241<*\240`\333\216$\2048\347\224\360\224\001(\301\f\023\241KJ\224\026(\337i\204G\004V7|;\205\2278\253Y\273\027B\272e\335\233\335\275\216\007x3\t\277\272\327%\r\351\226c\373}\221K\026ZS)\0028\021 j=\022\347#\002\210v\013i\265\231\0178\303\3158\200\037j\263\r\240y\036\334h8\237\236\016\262\232\355\347\307\306#\253\365\314~d<7 \331\203\001\266\201\240\335d8\233\355&{\365\346\367\b\310E'V\250\204vH\256\f\273\260Vg\027K\031<\266;\333Qal\217E\b\326\t\325:8\347\234\240\033<\266:\373\245K\030Z\243\316\bf%\177SJ.l\026\313#\200\253\232\235Y\033\232\255\221\302\363*\032\330\316D\241\035\nl]HRZd\366\211G"
+	.ascii	"T\260\365\021]\211\331\327\312lN\023]R\2501,G\035S\202\241\222"
+	.ascii	"\211\013\013\322\254\001\260\002\021*\242n\021 \255D\214\325"
+	.ascii	"\004[\317r\"\360+\323\202\324\207\2420\221\375\234A\233\326\305"
+	.ascii	"\214\253fK!0\243\334\202\373\006\237\013#\001\361\307S\214\374"
+	.ascii	"\337\237\254\351\004^r\312\374\025L\007b\210,i-\nbQA,5\374SX"
+	.ascii	"8\305\346L;\221\326\311\223i\235\013i\302\0205\007i \365\322"
+	.ascii	"c\317\335\252\213\305\006\302\254\255\r\326\n\236\263\200\345"
+	.ascii	"3\372\303\022\335G\b|\024\f)\235\032 \2718=/\271O\n\30215\346"
+	.ascii	"\342\035\210W\234\005h\365\031\230\264QHT\037_\240\235n\375\001"
+	.text
+	.section	.gnu.lto_fastKalmanBankInit.42.119dd381cbddb993,"e",@progbits
+	.string	"(\265/\375`D\003\265\024"
+	.string	"\206\244\202J\260\022R:@"
+	.string	"\340'l\272\212\342\215\322\207\307\245\275\037C\fu\364\2778NII\233\302\367\235j\017\316\366\264n\005\274\033\207\372*emz\351c\354\354\354l\303\267\020>\001\207}\252a_\306`\375\375M\020!{\357\224\002i"
+	.string	"g"
+	.string	"r"
+	.string	"-h\037\262\371k\327\347)iWw\342\222\361\241u' >\034/@|h\232Mu\035\320\276\\\301\001\006\220\335%\351\t\327W\335]'\355a\245\223\346\357\236"
+	.string	"hu\303\335<\254"
+	.string	"~B#Z\270\r5%\307\373\275\367\251\203\263\315\032\264s\372\336K\256\254n\270\235\317\220\b\273\353y\303\211\270\305\333\236\331~`\323\017\001\323#\255\017\375!7\372\305\027\375\341\211\376z\336\375"
+	.string	"\007z\2442D\355\202\b\002\327\027*\2458\357\366\217\374\036\317K\343M\210qW\016\365\330]\223\207f0\3068R\315\217,\001\212\365\320\256\261Y\017'\3136\312\245\024\271\254\256\325\261uX0uwA;\221K\213\354\322\250J\332\335\023\223\343C\004\365\323>\213\007N\262\327(]M2g\232"
+	.string	"\334y\204\332\326\360\031.\007"
+	.ascii	"\355\256\003{\3462,\214\273\333@)\006C\213\007\n\033\361\341"
+	.ascii	"{\257PW\301\233\217\332\fR\232\343\375\202\250H_T\005\207\315"
+	.ascii	"\003\217\217*\244.\252\362T>\207\247\312\304\256!\004\203N8\273"
+	.ascii	"5\222JG\350\221^\231\234\232rT\330f\320\326\331&\375\371\t\345"
+	.ascii	"\222L}\3549\375\232\323\256\031-\261\025\230\032\363\331e\376"
+	.ascii	"\022[\241P\315\2022k\241\201q\251@\306d0\230\214\205\214\271"
+	.ascii	"\254\300H\226\331\f\211b\300\262\230\226\031I#\223\315H\226\256"
+	.ascii	"v\352\343\357>F\221\360\325\250-\244?\026\231\242-J\247\246\311"
+	.ascii	"Ou\274$\236\376\307\213)\234\031\344\265*\370i\213\276\347\312"
+	.ascii	"*\247\204M\207\313\002.\317q\001\270C\352\345\276\250\233\217"
+	.ascii	"\232\355Ir\003v\033M\257@\250APb\231)\021\221@&\242@A\333\340"
+	.ascii	"\002\021\252\261\003\0210\261F#\250 )\2738s\344\341\360\221\264"
+	.ascii	"\354 \305\255\222\360\274rys{{\"{\237r5\211k\222iQ \021\300\360"
+	.ascii	"\tj\341\006\354]\267'PR\\'d{q\027\030\340\003\325\364\243\206"
+	.ascii	"s\\\364\031\274\213\345\356\304^>\253nH\022\006\0340 \337\300"
+	.ascii	"\033}\b>\033\n\022\r\021\030\346\225\210\350E\244MU\307\002\207"
+	.ascii	"\306Q\327\376\341\320\221\317\037"
+	.text
+	.section	.gnu.lto_fastKalmanBankApply.43.119dd381cbddb993,"e",@progbits
+	.string	"(\265/\375`\271\004]\034"
+	.string	"f\263\260I\260\226Q:+Z\3706fp6\230\201)\f_V^,\355\332\272\3574\2362\207^\340R\013>\214)$\265m\033\"\214\326\274\3441\232~\373\303\273S\372\323\2408\373Y\225pP\215?\211\244\254\350Z.\277%[\356\224\002\225"
+	.string	"\225"
+	.string	"\240"
+	.ascii	"\023\306\373\360\201\216]\364\177\034\b\356?#\031\207T\214M\345"
+	.ascii	"\024\226Zk\203\213\326\031/\032\240\217\331\236>\023\361B\373"
+	.ascii	"\264\257\343;p\347!\364Y\255HTP\265\372\036\230\301x\321\276"
+	.ascii	"\327\270.\216\017\340\272h\234\215u\237R\375\025%E\277.\265V"
+	.ascii	"\332\3060=\365\335t\342.\322\2358\277\307\017hM\331\365\206."
+	.ascii	"R\030\241\215\027\262\036\n\n\301((<\360\223\327\323MZ\203\305"
+	.ascii	"\367\3003\030J\355z,>_\030j\255\236\273\336\212\333u\3337\333"
+	.ascii	"\026l:\f$p\250\314\020\332\017\371\202\242\253\254\250\334\334"
+	.ascii	"\3325\n\nk\354&\331\276\241\271HB\033FP^$\033\347\276\177\300"
+	.ascii	"\235\356\233?\3356\017\3365\347\361\323\374w\317\350\364\f\235"
+	.ascii	"\226\241\3232:\035C\247a\350tlN\003\020\247a\342\364H\247_t\332"
+	.ascii	"E\247E:M\351\364\322\351I\247_\240\200\022(Be\255)\266\276\324"
+	.ascii	"*1\212\306\235\376\247?\370\377N\355\333o\362\203\\\310\2078"
+	.ascii	"\026dR\341\311\204\001\242\231\312KA\265Dat21\016\251\020\300"
+	.ascii	"\243\341$\033\263;$\231t\261\205Y\361\212\\\322=\n\b\227\243"
+	.ascii	"o\"\256\213\261=\357\005l\007,\200=y\203\336L\\\343\302\366$"
+	.ascii	"\323l\307=\214\341V\221\326km\366f\312f]\373Z\372#\217\252\\"
+	.ascii	":\370\360'\n\\\033kq%G\224\270tm\250\\\352\364\274I\216\270:"
+	.ascii	"2\246|\276\004V\204\225\025U\263R.\005(%\221\275p`\345p\261\373"
+	.ascii	"\255\331yE\036\351\346\226\347~w_?rIw\304\345\201T~n\344\202"
+	.ascii	"\322\334\003\253\330\366\206\027q\231@\251\326*\301\266\035j"
+	.ascii	"\304Xk\215Pf\b%.\342>\347\001\252\205\240\265\240Z\007\352\003"
+	.ascii	"T\343@\275\223s\343\t\n\321\343\201\006d\373\371\261\355\320"
+	.ascii	"\200zj?\264\235\033\tZ"
+	.string	"\016\001\333D\360\334hA6\333\215\026\363\325/R\217\217O\226T\345V'n\222aV\213\263k5\033|\266<\333H\\\263\375\226\037VD\323\313)\335$\333\016>[\234=\360\"\214\241\024y$\323\240%\265\313\222\273rI\303s+2.Z\262\\\314\254\225K\232*2;\263T\n\311\344\362\325\236D\265\346\020\310\354\t\255&rI\266B\2274R\206\273,\271\230\225\355R\221G7\013\023]\250QD\345\0343\"5BJ\n\013\222\326\260\002\021*\252:\021P\255T\020\221Bec;\"\374\227\\\213\264\220M=h6\374DL\223=v\316\260\307j\311\203\237\357RBb&\003\233\362\275|\177\327\"\307\251\034B`\220\200\346m\347\376k|\353\322\372\007\031Dp\030\224\264= N\376\313hy\201QZ\022\266\307d^2\276\246#\253\340Y`vV\234G\220h\367]R\3227\373h\\\242N\272"
+	.ascii	"\233\246&\335:\006&o\377-@\031\244}\033\243\017_v\007!\271\006"
+	.ascii	"\362uF\320\352>\276sK6.\355\036xGv\017\022\302\237\032wq2\220"
+	.ascii	"?\300\002\274\372(\006\304Q\241\250\316\177a\351\034\353\017"
+	.text
+	.section	.gnu.lto_.symbol_nodes.119dd381cbddb993,"e",@progbits
+	.string	"(\265/\375`9\004}\f"
+	.string	"$\0225\005"
+	.string	""
+	.string	""
+	.string	"\002\"\177.\320\231\263\346"
+	.string	"\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\200\202\202\200\006\005\177/\200\200\200\200\004\272\200\202\002\006\1770\007\1771\b\1772\t\1773\n\1774\f\1775\013\1776\r\1777\016\1778\210\256\217\005\017\1779\020\177:\021\177;\022\177<\023\177=\024\177>\025\177?\360\372\2508\026\177@\027\177A\356\030\177B\031\177C\032\177D\033\177E\034\177F\035\177G\036\177H\037\177I \177J#\177K$\177L%\177M&\177N'\177O(\177P)\177Q*\177R+\177S\005\002T\201\204\001"
+	.string	""
+	.string	""
+	.string	"\0011\177U\377\037"
+	.string	""
+	.string	"\200\200\200\0014\177V-\177W,\177X0\177Y/\177Z2\177[\003"
+	.string	"'$\003\006*\204\001\003\006)\304\001\003\006(\204\006\003\007,\001\003\007+\244\001\003\b\007\"\003\t\242\001\003\n\007\371\321\360\372\003\001\242\007\004\n\225\007\003\r'\006\003\016'\304\006\003\022\021\202\007\003\026'$\003\026-\344\001\003\035\007\"\003\035\200\004\001B\003\036\036\037"
+	.string	"\242\007\003 "
+	.ascii	"F\2501\f\202z\251\251\323nP\203\210\244m\021P\bM)#(B\"$\004\017"
+	.ascii	":\342O\314\356\255\013\257\265\276\343:\357\355\035\031\314\005"
+	.ascii	"\232\340\340\027\277=\243\252\034\242\333%\205\232\356\221D8"
+	.ascii	"\005\375@b\013\\\357E&^\360\303\266\034\277\243\242C\254\200"
+	.ascii	"\347\215\224\237\333\251\262\2265\261\226d\321UF\027\230/\323"
+	.ascii	"\201\024\r\304*"
+	.text
+	.section	.gnu.lto_.refs.119dd381cbddb993,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.119dd381cbddb993,"e",@progbits
+	.string	"(\265/\375`r=\025\360"
+	.string	"\212i]OU NA\225t\376\313\0341aL\263\262\332\335\355\321\277"
+	.string	"\"\242\252I\204P\263+\234i\232\225\322\271J\217E\325+\242\262F%\336s\352\b\241\307P2\327AI\375\237\\\274g\230\245\305@\364\\\376\327\355\233q.\251G\313r\330\367\241\252\030\211\215\310-w\n5\004\344\004\372\004L!\314x\223\b(\t#\255h\311Fl\243\006\341\0301?\032\356\2552Z\262\r\226q]\200\206\202\020}\254\3105\211Z\212\351\357\275\0241Rz&J\317@\351kbz\216\3613\f>\372\261akKD\270Y9sFr\271\261u$\307\375\305\233\022\265\024\305\272/\356\273\364-\307T\017n\036\252L\205S/\270\223v\231\2708\245\360\302\325(oK\376a\237\346\222\2058\250\272\361\017#\317=\225\271R\305/\021,\355\327$\351K]\372\372\266X\305e\007\021&Cn\305\017\035"
+	.ascii	"$[2K_\313\244\260-\247\324(o\306\3740A\260\026\204\350\343\336"
+	.ascii	"K\245&V\267:\245\"\256}`\001\273\341#\310\330\257e\351kW\372"
+	.ascii	"\272\225\376\025\312\223\026\236\234fp\037~\210\341\202\203\202"
+	.ascii	"\342~\245\221&AK\353\273{\376\245\2559\307\324\374\202\f\351"
+	.ascii	"+\362TR\007kauR\237\325\2606\251K*au\253L*\340k`\025\354\003"
+	.ascii	"r\307\346\3444[\253|\326L\311\322\006\244\310\363\310Y\345\263"
+	.ascii	"\002s\032\251Lj\263\362\305\3740o\022\007\237\273 \304\017-g"
+	.ascii	"8\202\240]\320,\312*\224\202\300tV\276\252\367&G\335+\344\336"
+	.ascii	"\233A:\364Dq\nw\335\233yE\322\301\250db^\231\bdQ\205q\333g\355"
+	.ascii	"\340\301Xo\355`\374Q\305*\236M\026E\335\265{\231\033\214gSp\220"
+	.ascii	"q\3371?\270\200\341h\202\301}\027\351\253\330?\243\226\367,C"
+	.ascii	"sr\212\001!32\223\226\267\034k\352\315\260}\345=\231go\326"
+	.string	"\275\265\272\2443\362\f\341\257fA\336\214a\271\327\356\207\263\016\251u\325\256\312U\272Z\244:+\221\352V\343\252\220\327\267\n\367f\336\373s\357}-\373\311jY\215\253ko\002`\350^;\250\f\220zAq\210\367^\005|P\200\013\2233\031xA\277\205\224\243\252\007\243\001&\220\276\266\235\003\251;\3027H\237A\372\013\322oH\037\223\336%}\232\036M\317\251\206\275\352\301\b\242z0v\355`\004\301\254\036\214i\355`\274\250\207\277\312\360\327\025\374\225\005\177\215\341\257.\376\252\002\324%\312\177\301+!4\234\211\341\377\206\277\235p!\023\266\340c\013\376]\203\277\353\202\220\240\253\030\320\245e\353?\223&\317\301%\177\307\340\267-\234\345o\033\177\325\371+\213\377Hx\222(\240\342\2576\177=\361\327\024\1775\221\202\232\277v\340\257 \370+\007\376\352\201\017\374\365\003\274w\344#`\275\021\\\303\337-t"
+	.string	"\201\267\374\355"
+	.string	"\022!\374\034cw\231\277\023\220B\013\240;\334\345o\231\304w\370\033\375\331F\335_!\360W\t\374\265\204\277>\340\257\023\370+\211\277F\340\"h\201\303o\243 y\314o\215\374U\203\272A\355\340\257\033j"
+	.string	"\376\372\341\257\034\314\f\340\037~;\204\3560\277\035\373/\367\237\310\377\272\377q\377\347\376\333\375o\376\037R\225~\301o\267\376:\307tO\177\013\366s\326\034\221\237\207\374\274\224\374\313o\233\324\372\257\306\277\242\177M\201\246T\271\361\267<\377\023\277\362\333\233\333\337~\340g\271\237\335~f\373Y\355g\261\237\265~~\372\271\350\347\027?\003\375\254\202\237c\370\371\3703\f?\233\370\231\004?{\340\347\f\374\274\302\317\024\370\031\002?\317\374\274\200\237\021\360s\007?s\360\263\006?_\360\263\314\317,?\257\374\314\177M\374\353\363\257\205\177\025\374\253\336_\363\376J\367W!\177U\373\353\331_\301\376\352\365\327\254\277Z\375\365\376\365\370\327\235\277\232\340\257\"\370\253\005\376j\302_A\374\265\345\257\351\177\305\377\207\377\357\376:\342\257M\177\225\361\377\205\377"
+	.string	"\370\353\321_\215\376\232\374\237\201\277*\340\2573\177\355\371+\362\257-\376\312\363W\030\376:\202\377.\374U\205\277^\340\257)\374\025\205\277\236\360\327\n\374\265"
+	.ascii	"\177%\300_\007\360W\227\277\262\374\257\362\377I\013\377I\360"
+	.ascii	"\037\357\277\007\213\213\213\213\177\213\326\277\342\3623 +\177"
+	.ascii	">n\301Z\202P\251Z\302m{X\036/I7\020\233T\266\266\254W\212\274"
+	.ascii	"w\211\221\347eb\na4\004t2\324u\353\345\362\003\344\307\037\267"
+	.ascii	"\335ay\254\370M!\001\344\301e\271\266`,)>\371Q\350\263\254\210"
+	.ascii	"L\b\203\t\025n\253\203\263\270\2119\364,\274\272\262Y\021X\n"
+	.ascii	"y^\246\032!X\020w\f\346\270\315j\302\210\351%%\271-\226\235!"
+	.ascii	"\3233\2508\003\325Ko\235l\215[\033\267a\255*\323E6\031a\310^"
+	.ascii	"\241\f\304\313\244\f\361\333\252[\253B{\2217\262\270\355\rKe"
+	.ascii	"\f\253\363\031\263Tv\n\n\314\t\354\360ZI5\221\"U\001e\304\324"
+	.ascii	"\316v\330\250\030#\312 $Q\026*.\352.\312\235\336\340\220\317"
+	.ascii	"S\025b\275\244\302\366\270\217f\245\347\337x{\224\367\336\030"
+	.ascii	"(\363*}^^\321ZC\3740\325\276\357\335\300\346^\344\\\340a\332"
+	.ascii	"\325\354q:\210{t\357\336\037)$\005\244\220~\244\226\222hR\027"
+	.ascii	"\371\243\003\271Ay\245\220I\264{7\334\237\037$\nQwC\022\355\""
+	.ascii	"] >\244z\231R\310\373\023u7\334\237\333\003\"\371#\205\224D\353"
+	.ascii	"A\332\220D\223B\272hRW\303\375\351Q\016\375\\\345\206\213&\325"
+	.ascii	"\344\242E!iH\242E!%\321\244hT\032I%tHD\002\247\256*\222\344\317"
+	.ascii	"\205aT\243G\251a/\311\214\272\201\367\326\265\240\253$\300\275"
+	.ascii	"5\242\224\201=K\325\351\263\007\303GHO\224\006F>SQ\367g/\351"
+	.ascii	"\025u\257\227\217\212k$\002\222\271w\261\352\036\222\252\306"
+	.ascii	"-\n\272w\003\243{\221\365\356\335{\221\367\336\025e\r\346\275"
+	.ascii	"44$\227FF\3672}0\2725\220qA\367\362\232\022'R\022m*j&.\rmy\205"
+	.ascii	"\230\310\272\274\201R\312\024\riv\213\356\275\325I\272DJ2\344"
+	.ascii	"\266MP\224\236K\207)\223]b[l\262D\351v\351\315\227{\001P\325"
+	.ascii	"\224 \031\302\375'o\326\031\340\300\332fX\031P\320\230\302\270"
+	.ascii	"\223\\z\210\311\311\030LocX\2443\357\275BXt_|!\354\021\313\017"
+	.ascii	"S\206\345\317\211\215\265\"\326\250\311`\323TZj_X\242\352f\213"
+	.ascii	"~\321\356e\302\330\036%#\315\020F\231\032\302h\177,Pu\363\300"
+	.ascii	"\006\335\n\331\344\321\036\346er\226\"\033\020n\r=\226\276z`"
+	.ascii	"\264\213\213\325\003\346\313\321QV\224\355\261\310\364\007\013"
+	.ascii	"\t\213\333\336\226&\232\023H+\375\253R\004\375\214(I\344*\274"
+	.ascii	"\310SX\nS\251n\254\310Q^\373\030qO/\t\337\340\230^\240\"\037"
+	.ascii	"9\262D\225g~Eb\332\330NP\236\260`\031\311p\266\020\332@\":t\""
+	.ascii	"\026W\006\310m\230<\312s\302\375&J\037\202\224\312\367\323\367"
+	.ascii	"\266d&5J\345\353>!\334\204\237\325\215\2310\341\353\030\027~"
+	.ascii	"h\256*^n\306\346k\227\360 \262KO\311\255$\246\007`\\^a\372\312"
+	.ascii	"\244\262\23492\345\217\223\260 \373q \367U7\006d$|o\332U\321"
+	.ascii	"{\323.qiDq\t"
+	.ascii	"\310{R\2261\212bOE1}\033\230\336\342\245\267E\322\333\272\364"
+	.ascii	"v.\275\035\222\2077h\365\343\305}\327\243\n0\t3\345\271\032\205"
+	.ascii	"\207\324"
+	.string	"\275\265\376\",\023\3629)%K\035\203;\226\024a:\256c;&R\335x\216\341\316Mv\316\361\333\347\352\336\032\n<\004\237/r3\264\005\275t\033\273\305\370\240\221trs\334\314Y\356e\310\220\236)\356G\251\035\214\002x\332\255\364\366Fz;#\r\200\335;\334\233\017\340k\353\342f\256$\375\300\220\242\226\326g@SX,M\3001\252 \334\345\342\224C*\016\255\003\031\246\222\021\025\220\263\030\277\244A7n\263f\376\300\303\342\276\035J\303\030\214\305\230\214\177p\031\217U7f\362\f\347/\356\361\017bK\356z\001\344\252\226\351\3101\303d\257\303\221\bR\262\b\371@=\265\2668\3132\227+jSY\317{\231L\336\361\2465Sb\020\324\207\365\344*\037\032\256O\337\326\362^\346\331j\304\b\314d\034\234\025\203d\336\243\225)-&L_\237\224\223\206>SI\353\207gz^\322\305<\232f"
+	.ascii	"\275\261\333\233\314\365>\2132[\336{5\274(9|[\373K\317G\322\363"
+	.ascii	"\\zn\246g\2664D\365`\344+\306\252n\035p\216\217\030\341\026y"
+	.ascii	"v\305\356e\312\300T\001\253\222\330\201\261.\326\016\214\347"
+	.ascii	"\036)\b\325\203\221D\365`\374\231\352p\306\2431\304\277\251\032"
+	.ascii	"\327BG\365\342)uc%\306\224f\016\356\250\027@\304\2712\3563U\372"
+	.ascii	"*\226\364b\311FD\203\235\370\211\241\270\211kT7\266\301J\347"
+	.ascii	"%\016/`\366\240 \001\341F\223\250\017`\237\223+\227+EE\024\250"
+	.ascii	"\031\366\224){\222\264\206\376\034\005\372IR\272\343F/\352\203"
+	.ascii	"\036*\365\200C}\320\036\261&\031t\366\312<1\nkB\221\034\205\305"
+	.ascii	"\t\032\336b\025\227\031\211\211P2:\234H\347\"\024(-\205\311\320"
+	.ascii	"R\2058\245$\342[JL\263\350(\211\273\243X\252\227 1\242\241?B"
+	.ascii	"\302>T\3222\236\006\027\235\274\017S5(IR\270\333\320R\211ph\203"
+	.ascii	"\311\335M>\207\004on\bw\027\366\323\205m\356\354\255\237\315"
+	.ascii	"\204\365p8\007\t\337p\biK\222\244\007+\341\3353\246p\271e\250"
+	.ascii	"\344=\270\242\264\326\267\306\335\2023\004\231\024rw\340\347"
+	.ascii	"\370\f\213\312\022w\003\376\371\265t\351\3515_z\t\333b~<\301"
+	.ascii	"xC\362\346\013C2\251\343\356=K\365\362\264\343\253\302\335GZ"
+	.ascii	"\230\272\355\232p\254\036!\033\202\327xo\256\302\221\244\203"
+	.ascii	"\273\357,\225K\320\326W\022\356n\271Ng\323\325\253|\323\201\372"
+	.ascii	"9\177x\315\275\351\n\017\215\240\250\270\233\210\245\032[\222"
+	.ascii	"\007\205\273\207\264\\\307\r\272\2715\334\240b\213\331\345Bz"
+	.ascii	"{\303\245y\r\"r\267\220Vc\253\302\272&p)\027\335\320\227\335"
+	.ascii	"\331Y\263\325{\007\237{Fz\340\326\336l(aQ^\020w\243\265\332Y"
+	.ascii	"\337\323\215V\353\264\245b\321\241\241\313\023*\032D\035\204"
+	.ascii	"\t\215RBlj\334\r$\255\307z\254\231Da+<\332f|\225\275\231^M\212"
+	.ascii	"\210p7Y\2031\233\223'\276\031\272\272\372\307\340\325\022\306"
+	.ascii	"\215\017\006W\330\373\007\313\031\325=\302\335_\r\346\304\220"
+	.ascii	"\211\220\273}\210\231=\311)\261\312\301\206\326=\030\t\214\023"
+	.ascii	"\bm\2067Q\263\2528>\356\366\262\332\332j\256z\225nE+\300\340"
+	.ascii	"\363[\276\271\ns\b\223H\356\336a\211,\265u\315q\267\016;\344"
+	.ascii	"\222\f\253B\205\345\350\352\252\263\352\340\363\245\252\256\310"
+	.ascii	"R\347x\267\\a\325\201q7VS\305p9\223l)bC5T\263\345\271\\m]\345"
+	.ascii	"\350\252\267\2255\242R*\271\373FS\301\f\302\031\3455UO\321Xr"
+	.ascii	"\342u\227&s\024U\265\024\303\265\\-e\355qw\024g\0359\023\275"
+	.ascii	"\372l\330xc>\262%#\316vj\247>RAp\255\006\251\233J\233\241\225"
+	.ascii	"Z\251\233X\356\025\314\301\2626\003N\t\323\273I\313\355\211\037"
+	.ascii	"w/\265\221\321K\310\t\215\264\t\t\251e\244W\260\211%\210 \026"
+	.ascii	"V\322[FSF,q\210\223\273c\244\310&j\242>\342 \224\370\264{\316"
+	.ascii	"\246\025\214\367Q\323\210\026vH\326F2\2073\322|\332\250\213\370"
+	.ascii	"\016\026!4\342\0359R3\354\241\036j!@=\270K\006\205\327?\375\323"
+	.ascii	"B\200n\313\324G\340\336T\007\275\205^\310\354\210\b\271\033\310"
+	.ascii	"JI\223hZP\334\024\025\273\207,\355Bz\206qwO?\035\215\301q\367"
+	.ascii	"\265RV\344\274n\034\341\266\213\207s\022\352\330\342\266U8\313"
+	.ascii	"\250\314\363\212\343.\343a\234\017\2751CC\233X\257R\355\311H"
+	.string	"\303\211\356m\312mb\341\363+G \267\205b\245<\235\262\244 ^\345\300\2433\253\210;t\260E\341\031Z\215M\b\212\333>9\234\035R\323*\342\266\207\234\305\242%\366\234\342\266N\270\253\005\210_\021-\316\232\202\262\244\251\343\371\264\205\200D\313\026@.(+5\006\007m!\220\022\256\002k\232Ax[\370\222\354y2\306m\227X\"2Sl\202J+B{{V0\310\232}\306\2251\003o\005W\236L\\t\3346\211\005\204\371JR\201\001\376\275\3705q\202\024\205j\021\361\021\371\261R\313\213$_7\270m\337\233V`J\374\270-\337\233(\017<\275Dn\213\304*]\216dx\321\321\200Al\022\3142\324\323\363\203z\256\274}\355xq\304\316\316\346\365\201-e\230\210I\260\360n\363\ne\316\212\356\244p\333;K\244n\250L\221\333\026i\273\263\267\247U\032\365\216\250Lq\203\203\263t\022"
+	.string	"B\326\200T\004\371\346n\351\nal<\241\311Y\"\020\370\301\363#2\204\352\252\207\212\223! \267\215{\023f\217\251d\304m\235V\251UE\246\304m\233oB\265Qy\002\203\321\370~\354\205\261\261Y!\022\350\313B^\3053\267[!NJ\2051\270m\233\035*\201]\237\224\035\352\262.&\253\034hG\263j\274\\I\363ya\325\220\310\222i\267j\226h\211\256\211\333\006\261\3148\263\"\034F\032?~\330\263\364&\032\361\200pu\231\335\236\025\272\300\370\213r\271\355\230e\342E\251\301\304|Y\0216\033E\311\025\261\031\212`d\214\254U\310\200"
+	.string	"\341\266bo\312\300\231\005f\031\211\276\276,\330`L\"\223+(Zx\21696757(P\330\270 \200\234\033\232\035\026\024\307\234\233\035\034c\316\rO\213\013\235\035\026,hJ\360\350\324\264\240\030\221B\007\007\355\253\250\311\241\3311\221ss\324\311y\331\241QQ\323%rn\21687-L\224(\021sb\305\r\017\b\233\035\032\234\032\233\023 X\254\320\321p\025\037\360\340\340\320\324\2508\322\254\020\301s\2741!\242EN\212\006\270h\221s\203\323"
+	.ascii	"\021H(A\002\t\027\"\216<9:5(\212\024\350\260\350\253\370 E\316"
+	.ascii	"\315\316\221G\204\315\211\0268597\"vxZ\210\300 G'g\345X\302F"
+	.ascii	"\206\033\036c\ntvT\034urVP\320\330\340\364\321\206g\205\315\n"
+	.ascii	"\343U|\300\302\013+\270 \002\004\f5:8'\330\354\350\234\260\302"
+	.ascii	"\346\310\023\203\0132\0358x\370\300\001\006\033\244\240\001\026"
+	.ascii	"2\340\260AC\314\b\016\254\220\302\t\034\270\340\330\202E\316"
+	.ascii	"\nG\036\032\0268\264\260\001\016\315\315q\207F\003584'pp\"\307"
+	.ascii	"\204\flR\320\354\330\240\300\004"
+	.string	"\fd`F\304l\230I\001\205\013.\2609\322\234`\321\201\0244\300B\007\r\0338\332\\@F&&\346x\223\263\002L\f8,X\230\200\203\323\"G\346588&\034m\\\300\34057;696)\322\213@B\003H \341b\345$J"
+	.ascii	"\241\004\020\214'Q\302\314L\t$\314\244'a\306\356\0345\220\223"
+	.ascii	"\302\0066\034yJ\244\307\022#B\260)a\303\"\206\027H\230I\217\032"
+	.ascii	"\2162G\020\034yhpP\236\02294+ph0p\344\241A\361r\202\272SYT\027"
+	.ascii	"\365\310s\243\223c\203\002\207\0236887(\\N8\332\244\330\2419"
+	.ascii	"\272\034_vnP\270\240ha\302\036itpP\240<(P\330\350\324\030W\264"
+	.ascii	"p!E\316\r\ntV\260\334\240\307\234\026:5\350\261\004\211c\316"
+	.ascii	"M\213\025\025\307\02496,\240ha\202\345h\203c\202\346\005\025"
+	.ascii	"5G\235\f\310\240B\316\315\nT\006\025\\\320\254@]\330\234\310"
+	.ascii	"YA\347\005\031T\260\034O\340\350\250\340\261\331Qqdy9\336\254"
+	.ascii	"\270a!\00568<,G\030\352\314\221\205\213\315\221\346\310\203\036"
+	.ascii	"yJ\300\220CS\001\016G\025\034\\\207\205\315\216\210\243\216\316"
+	.ascii	"\216\b\227\02110O\211\024"
+	.string	"N\320\2648\301\215\211\230?\340\001'\200\350@\006.\220\326|\260cs\304\271A!\"Gg\305\n\235\032\021974+D\324\354\360\210\370`\003\020L\360\214\t\036a\202ghx\004\r\317\270\340\021.x&\006>\363H\222\022S\n\n\242\204\"\314!\227\034%\374\002B\030\307\215\016\242Jb\220\201\326j\007\221\035\0217\312\207\362\241\177\365*\343\234\250\337\321\277\302&_\236\rn4\211\245\"\002\324\306\305\215\366}\356cM\224O`\220\244y\326K\315\307\337\236\\\032\"\\\fn\364\016\275C\365\252Ri\310\2008$L2B\374\250\221\243zsAK\016\371\270\321\274\317%\262\225%\341F\361>w<\275)\250\271\031q?\214\324\025\351\243\021\370\025\371\261C\237\366\312\026\261\320:\272)\251\275?\026:\241$Ns\250\326JW\217\217E\346\241\340\016,\356\267\243\3167T\256>\251\314\313\024\2054<"
+	.string	"T\221>\"\210)\254\240\362\320\270\243ry\213A\234Rh\023\316\351\346f\227\252\006\246O\337\3402\004g:\f\203\260\375lv\t"
+	.string	"cf\203^\210\3672\205H\221f2\274\240\310\216\252\221\331%{\227\276\335\345\013n4\r\b\032\004EC\231\350\231\031\247\331\2255\245bQ\250V\323\335\033T\317\356\2212&J\021(J\334\350\217\2437\240\220]=\270\321%\n\206\206MM\3511\342>\214\214\364\250\017&e:\002\271\321\036i\020\214\220\007M\324\206\210\306}\264\307\321\257\022\334\373\003S\203\007U\0257\352\205\316p\364\013\355\272\350\227\bQ\367\366\240_2T\356\355\221\251u"
+	.string	"\265\016\240\303\246v\264\031\3730=)\3125s\224\007\332\204w#\213\333\245v0\242;\240j\304H\343Fu\260\304\020\332\341D:\232\002rrG\035\275\302B\2658\353^\037\020\230>\2017Y#\204\261\r\210\216+\353\250V\363F`\023\016n4\307\213\223\024\245B\255P\034G\240\250\214\361\245G\253\300\276\274\234V8`%i\242D\254\0161\366 \017\241\270\321\251\243H\200~xg\334\250\324\321#\247\244A\257\033Wyz\206Z\351_p\2440\216\306\200\201>\331\277\227\213<\273G+\315\"|N\304\233d\n\341bFd\206\244\351\350\323Q\033#F8a\352\343\353\257\207\033\255q\324\211\311\210\334\223\006\352\324U\205\326#\231\276\001\351\231\022\022\0227\312tB/\302\242&\334\350\322\347^\230"
+	.ascii	"\021q\240JzS}>\334h\022*\243\272\035\017\235\361\0309!\266\027"
+	.ascii	"d\372\026\324\343\031"
+	.string	"Q\345Q$\271\247*))Gm\177N\313\303\364.\204\351\217\026\275\272\241EVI\201\265\333\203\024\242\016I\346\003\361*\355\026\260ak\257\207\030*\204\n\241/\230\330=\2271\226\205\350\320\321\205a\250\363\263\3438\026\206\n!'\321\210\220\244I\322\030\343\025@0PT,\026M\323\324\003\023\300\023)\243\271\036e\231ch\204F\244 )H\n\313nM\343j\274\372\351i\256\355\245\320\204Q\025\276\236\024YL\367\277g\025\027+^\264`N$\336V\304\245c\303PJ\2036?>\325rW< \243\3134\367\263?\027F\356\025\"\033\240\007/\347\264\316\n\243@\203\241\313s\316\242\253\021[\206&\336\312dsF\355\025Q\006\355\243\215\034\214\327\354\234Y\200\333\2302H\375c\237\313\351\242\235\310\270\r\274v\337\214\346\306=f\356\210,\345f)\027\217\016\232q\330)\0040*\331\330\205\370\210(j"
+	.string	"|\331\304\377'\222q\341\006"
+	.string	"\341\034m\b\201)\215Hv\307`\307\345\220\310\020I\007\007\203X\004$\024u\214\2316\311\361\202H\243\305!)\374\320,\374@\375r"
+	.string	"\277\307i\302\344\376F2\345 \036\007\243\332 \242\243\240\247\313\030G\241\301\370A\342\240M\275\375T\243\340X\313M"
+	.ascii	"f\363\306]O\367n\307\247q;T\007\245\350\273"
+	.string	"H\021\273\375\0300P\367?Y\235[\236\242+4Dq\361_lA\203\365NM\345\017Q\246\267'E\206\017\266\033\\\230^\363\276&\325\343c:\263\376\343A\330\360\\\306\2258\\q\320=Y\223;\352'2\332 i\325\002R_\002\f\004\333~\020|~\370w\261-)\257C\331\275\177|eU\305Q\n\253\313\235&\217\366\222\002\333\201\212\230_(>J\t\351]\376m\226)\315P\030\364\037\332\303\222\206\312Zv+\207\375\301&7\274.!o\231\251\302Y\252F\231\335\036\272\266\322^\244\242\245\3727\353!\377F\341\235\032J\203\263\326\241\313\001\322\345\t\307A\t\243\317\270r:\004\311\350\3338\205o\023\370!\206q\242\222BK\217\b\005\226\026g8\272PM\230.\343:\034\350l\243\211M:\251\007\330\347\250\264C\335o$[\252\342[\357]\352\255,-E\333y\271\360\217-\n\0072\360\247X"
+	.string	"7\374\351\271\fj>\320\303*\341\241(\223(\322E\362\022*a\261\214\235F\307\217\256\0205\276\0042\315\3671/\343}e\022i\220N\3263r\027\314\023hz\007|\001eBe{\2508\362\207b\241K\357\023P\232D&\364\256\326\344w\333\035"
+	.ascii	"u\205.\260\355QTV&\3549\214\312\017\240\001\325\331w+i\362\370"
+	.ascii	"\216\bFm\216\211/\274\261\221\351\353\250\254i\033\237\301\264"
+	.ascii	"O\241&\210\337nd\221\r\207Y?\033l\r\242\331\177\257\270\361]"
+	.ascii	"\314\331\355O\005\031:\373(XT\234\025YBGcZK\344\255B\177\342"
+	.ascii	"\215!o\352\331\372\212\277\035iO\315\350X\227\262\b\310C\301"
+	.ascii	"\256\f\006\354\204\n\016\225\2105\236W\200\266a\342m\031\013"
+	.ascii	"\346\277\352C\345_\024\336O\003\321\204\312,bU!z\300\360\261"
+	.ascii	"\221\031\342W\377?\326\341\3656\3001\0064\345\016\214\370\223"
+	.ascii	"R\354J\f\212\275a){\250\335\254\034J\313\252\267\301X\322m\332"
+	.ascii	"\227\334\007N\323\300/<_o,\0200\340@\314\272\024\365S/\335R?"
+	.ascii	"4Q\347d\234\r>%\352\375\200\037\3741Z\2506\314\255\200w0\270"
+	.ascii	"h\017\226\201+}\022\\\220\263'\251\034\202\375\305\334\346\354"
+	.ascii	":\230\231\017\324a]\363?bN("
+	.string	"\300\305\262\034\217ox9#\245\037\352\020@\r\215A\271Np7 \377\314\203\344\371TF\020\030\277\027^-\231&D\354\302\361\027s\233\350\326d\207\207a[\004\226\330\324?\367 \356\007g\214q\365\2501kql\236|\353\341\037VE\370\315w\247\\h\376\315#\303)\262\203\307F\fdn&\275\373[\230\212o\006?"
+	.string	"}\017\021\241u\001|\313\023=\f\002\n\200\241=\026\205\023\023\377\375N\005\243x\343\211\253\244\332\357\353\312rF\033\222ne3\232\366I\212\232\321%\262\207\3675\320\346\320\337(2)j\002\323\022r7\210A\343\206\354\355\312\345\350\177\304\363\205\004?16h\214M\336\363\n!\213\235cc\242@@\t\272;\3747\214\305d\252[\234t\n?\345\305\232\027nz\r6n\300\030\031\206\324\365\224e\274UYe\207\2072\036\032\f\341\322j\224%\023j|5`\027\362c\271RL\232\321\314P,\270g\352\224$!\357\212_\356\007b\331\020\323\227$\272\031\035\241AI\312\360\371l\276\344}l\346\304\227\237\301f\026\3331\216`\302|\032Fp37>\361$\020o\241\224?\233\210\350xkb\256\216>\032\304I\253*\300%Y\206~*6\230\\]\260"
+	.string	"\256\021\030\347\2114gU&L\307\332\250\264+|\240\226w8\302K\250L\311\016\022,(\244i2\354\363\027\372\307:\354X\005\017\316w\332\215\005\0133\214\213\367\354'\311&\213\306\f\372s\006]\022\374\027JW\263\267\t\310\"U\333\027\217]\252\021(N[\337\276\"\232A\232\335\252 \240\353\026y\214\020\353\321\3504\331\201\302\262@\317\220\b\266\202]\177i\336Y\335\213\213\007\315i\013Os\216h4~b\226\337\340\3407\260\245\222\002\252\013\373c\373c\217\243\206Q\265\2462\006L~\260!aK\342b\027X\021\303\353\201\347\367I\261\024-l\340\202g\272"
+	.string	"\363z`0\217\302\327\265\f\311\350\261\223=\370\310\033H\002=\323\341\241\267\262\016/CyO\301\355Gh\366\221:\356\350G\356+\245\354L\033\217\352\034\345M\033\330>\025s\326\2745-%\277\344\3528\345>\273\373\017\266\006\246\005\037\231\341\\\177\030\235\236s_\302\361\257r\370\277\236\355\377@\332\322i\227\214\362\217#\313tR@\357\3623\\\247\325\026\266`\035$\b2\034\2629.\005\372\257\207\251\317\310\264vD\b\321\265p\024>\247\373\202\034\f0\361\335\363\213\301m\206\250\002\374\211\031,\361\232\303\357\027T\003~E#Z&d\3050\263\b\r\370\250N\231\275\220\016\020\333\201\235\255\221\330\3607\b\260\224\002\352Tjx\030e&\364\340\360Xr\216D\355M\242\252\350%\314w\340287\265\250\311V\3416-\030+\366`\271\222U\275\311\304Q\344\361@Hd\253\314\031A7\347\004\177\036 \350"
+	.string	"\307\003\247<O\361$\026n\317xo.p\336\203gt\212\025\301(J;ph\035\340\fv\216\245\t\373Xl\264\204\235\277\275\246u\242\007\3613\376)\363\220Gq\216\223UP\204i\261\304\277\246\036\2469m\320\032E%\343}\302\207+8\031\244\317\021_#p\324:o\333\215\220-\341Pa\016^pn\342FDB\034\347\324\210\005\326gtD\030u\360\367O)\213\024\b\255~6\213\032\213\037\333\301\270<\255\232\027\033-\350\t\340\007{#\361\336\023\376\206[\257\310\021O\370\321\353\376\236I\266\b\230\\^\260\025w\375\224%\305\3534`\311\033\260"
+	.string	"\3242CuFt\324fN\2019\310D\361\265U\nt\203a\300%\017\002\251vd\277\314\273fm\232@9\261\230\002\036\303\365\220\342\323\334\007\253b \013\351\374"
+	.ascii	"ES5@\234\\%T@\006_\304\351\34456n\222\364Bp#\350\342G\273\260"
+	.ascii	"\261\341\277\307\025\210c>\013DQ\336W\224j`\004\354\n\003{\252"
+	.ascii	"\326;\264\240_n \2746\347$\3304K\304\2079\323L)\351D+w\027s\376"
+	.ascii	"\036a\n\234\\\\\224\260eg\031\374@\f\362fFc]\267\377t\357\177"
+	.ascii	"\004s\365C\342\314\267\307\220K\031G(=\217u\035\337}\003\331"
+	.ascii	"\023\302E\177n\017q\002\271\350\222O\271qw\025\256\266\350\\"
+	.ascii	"\275D\344 \311\001\b\237\354\037\356\215\342+>LB\227\245\315"
+	.ascii	"t\372\354.\304\314\206\313\033\343\035]g$\273W\270tY\322\213"
+	.ascii	"<jR\031\316L{@L'z\254%\275(\260G\377\311\3659y\021\270\220x\320"
+	.ascii	"\362\300\321\221|\317\201\364\271\360g\267\036\271\204\234\203"
+	.ascii	"n_\tpZ\006\372?\2679\036|\372\303\262\235\345\016\267\2310\\"
+	.ascii	"~\344\236;h\001\201O\215/\025\311Q-\206\n\234\227\253\347S\330"
+	.ascii	"\236\237OC\351\347\315\263\352\360\340\327\333z\337\314\031,"
+	.ascii	"\314\352\372\364}\357V'(\343K\340\303V\337\245\256\274NPgL[\364"
+	.ascii	"_\324<%\355\234\265\362,)o\226-Y\253\355\255\344v\t?\264\304"
+	.ascii	"\033X\374J\360\341t\265\220\256`\317i\375\324\361;n\266\005\266"
+	.ascii	"W;\376{\330\016\305B\213\365c:o\007=\315\274\177\323\376y\246"
+	.ascii	"\216\205\317#\372\205\343\025w\201\372\345m\250\273\200\246\327"
+	.ascii	"1\206i\006\027\345\036\330|\331\334\234\013\267\013\367\340w"
+	.ascii	"\001\334\013w"
+	.string	"\022\214\037\332\213\240\367G\332\323\337C\237\247\240\276\324\315D\017\264\276m\377\300\367\t\276\367\323\314\203X=\220\237H\365&\344\003\202~\021\236\006\302>o\257G\025\363\"\237\333t\177\\\241/\263\217s7\222fh\333`C\226#}\256\234qI\367\211\360\301\206>e\f\265M\356\267\227\301\013\235\221\365\374\315\n\331'X\206\003q\273\256\244\237\334\035\206\317,~~o\310a\354\353{\353^\2745\324J\332\331\331\b\355DL\223L6cc\342\305x|\230o\035\312<\202\354\244\320\250\227\177\304\2760\270\220\2761\256\\\371\312\217\301\273\221\247\357o\321\201\372 \311\216\342\013\274Z\335\220\r\256-\357\351\220\003\034<\t\236o\f\356Cr\275\247\304zK\374\276\307\016\261\360\316\322\355\332\206\354\233\237\342\036\204~\346cc\201\271Cd\320\214\347\250w\341\202\353\337'\303;\367C\352y\032F\b\007Iw\267\337"
+	.ascii	"]\335[\333%"
+	.text
+	.section	.gnu.lto_.symtab.119dd381cbddb993,"e",@progbits
+	.string	"nullFilterApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\001"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\001"
+	.string	""
+	.string	"pt1FilterApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\001"
+	.string	""
+	.string	"slewFilterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\001"
+	.string	""
+	.string	"slewFilterApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\001"
+	.string	""
+	.string	"filterGetNotchQ"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\001"
+	.string	""
+	.string	"biquadFilterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\001"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\001"
+	.string	""
+	.string	"biquadFilterUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\001"
+	.string	""
+	.string	"biquadNotchTableInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\001"
+	.string	""
+	.string	"biquadFilterApplyDF1"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\001"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\001"
+	.string	""
+	.string	"firFilterInit2"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\001"
+	.string	""
+	.string	"firFilterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\002"
+	.string	""
+	.string	"firFilterUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\002"
+	.string	""
+	.string	"firFilterUpdateAverage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\002"
+	.string	""
+	.string	"firFilterApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\002"
+	.string	""
+	.string	"firFilterUpdateAndApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\002"
+	.string	""
+	.string	"firFilterCalcPartialAverage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\002"
+	.string	""
+	.string	"firFilterCalcMovingAverage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\002"
+	.string	""
+	.string	"firFilterLastInput"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\002"
+	.string	""
+	.string	"firFilterDenoiseInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\002"
+	.string	""
+	.string	"firFilterDenoiseUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\002"
+	.string	""
+	.string	"biquadRCFIR2FilterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\002"
+	.string	""
+	.string	"fastKalmanInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\002"
+	.string	""
+	.string	"fastKalmanUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\002"
+	.string	""
+	.string	"pt1FilterBankInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\002"
+	.string	""
+	.string	"pt1FilterBankApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\002"
+	.string	""
+	.string	"biquadFilterBankInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\002"
+	.string	""
+	.string	"biquadFilterBankInitLPF"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\002"
+	.string	""
+	.string	"biquadRCFIR2FilterBankInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\002"
+	.string	""
+	.string	"biquadFilterBankUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\002"
+	.string	""
+	.string	"biquadFilterBankUpdateNotch"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\002"
+	.string	""
+	.string	"biquadFilterBankApplyDF1"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\002"
+	.string	""
+	.string	"biquadFilterBankApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\002"
+	.string	""
+	.string	"fastKalmanBankInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\002"
+	.string	""
+	.string	"fastKalmanBankApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\002"
+	.string	""
+	.string	"powf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\002"
+	.string	""
+	.string	"log2f"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\002"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\002"
+	.string	""
+	.string	"sin_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\002"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.119dd381cbddb993,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
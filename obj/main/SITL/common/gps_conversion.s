@@ -0,0 +1,234 @@
+	.file	"gps_conversion.c"
+	.section	.gnu.lto_.profile.7bd4319fb31113e6,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.7bd4319fb31113e6,"e",@progbits
+	.string	"(\265/\375 +\335"
+	.string	""
+	.string	"\230\037"
+	.string	"\002"
+	.string	"\311\301\254\210\013\b\002"
+	.string	"\001\240\342\234\212\n"
+	.string	"\002"
+	.ascii	"9\211`\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.7bd4319fb31113e6,"e",@progbits
+	.string	"(\265/\375 \025\215"
+	.string	""
+	.string	"X\t"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.7bd4319fb31113e6,"e",@progbits
+	.string	"(\265/\375 C\365\001"
+	.string	"T\0037"
+	.string	"\001"
+	.string	""
+	.string	"2\264\341\347\261\002j\001"
+	.string	"\001"
+	.string	"\001\002\003\\\342\350\236\235\002j"
+	.string	""
+	.string	"\006\204\200\200\200\002d\002"
+	.string	"\002"
+	.string	"\002\232\212\217\211\002f"
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"x\206\265\001,"
+	.text
+	.section	.gnu.lto_.jmpfuncs.7bd4319fb31113e6,"e",@progbits
+	.string	"(\265/\375 \025\215"
+	.string	""
+	.string	"X\t"
+	.string	"\001"
+	.string	"\001\001\003\177\002"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.7bd4319fb31113e6,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\265\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.7bd4319fb31113e6,"e",@progbits
+	.string	"(\265/\375 \032\265"
+	.string	""
+	.string	"\200\016"
+	.string	"\001"
+	.string	"\001\300\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.lto.7bd4319fb31113e6,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_GPS_coord_to_degrees.3.7bd4319fb31113e6,"e",@progbits
+	.string	"(\265/\375`i\t\2755"
+	.ascii	":_\320\024Gp\334Q:!\f\251S\237H\365\351[\206\222*+\016\",\305"
+	.ascii	"\007\253W\333y\325\354z\2173V\322\005\352\314\260\226=x \033"
+	.ascii	"\242,\333:\327\204\021`@\233\"BE\202\002l\362\277\375/\325\266"
+	.ascii	"O\b!$m)\003I\001#\0012\001H\272e\327`<a\321\340\240\243\n\035"
+	.ascii	"\025j/\206\336\266\315 ZN\260hw\320JX\3513\253\276\322\002m\217"
+	.ascii	"<II\373\300v\372\273\314\004\301\252\313^\240m\017'(jt\332\366"
+	.ascii	"\311\240S\326\300\336\313\334T\272\212U?a4\260m\277\302hi\333"
+	.ascii	"g\0223\261\235\362\223\355(-\305\212\257\320\347\021\256\007"
+	.ascii	"S\264\316\362\264\355\2638\324D\265S\264\205j\2477\2026\221\371"
+	.ascii	"\352\372x\307\276F\237\315iz\325A@\304\2410\b\374\371z?>\274"
+	.ascii	"\235\216]\325\024\375\275\342\216\321AA\"6\352\f\351\022k \324"
+	.ascii	"\207M\023/\007>\326\330$\271\304\260\036*i\241\022t\b\354\006"
+	.ascii	"\231\366\324\031\322\025\326@tAS\214\216F\263\265\004%\236!\022"
+	.ascii	"\247\307\266\220\334\337\021 \327'\244{\315\376i\006\271>B\232"
+	.ascii	"\207\2563p,i4[?\320\tz\350l\321\272\273\365\251H\227W\353|4\213"
+	.ascii	"f\313\007:D4\266\325\343\256DC\272\274ZE_\206\345K\217k\211:"
+	.ascii	"My\202\204\311\205uS&;\032E\235\332\266\355qe\241\350\330\226"
+	.ascii	"\330}\273\365\355\002g\203kG\337\365\251m[\2766\270\272\232\205"
+	.ascii	"\232\271\3050\363\r\346\325Njz\rsssZ\032IE\237\276\227\315\037"
+	.ascii	"}z\377\253r\264\344d\3349\346\336r%e\212U\302\r\343Bk\230^2\356"
+	.ascii	"\\\243m\333\266\351R\023\375\351MV\340\356\331\032\0332\364N"
+	.ascii	"&z_i6&\353\352a_\013\325\342\373\355\326IYqK2\254;\3674p\312"
+	.ascii	"\320~'\3633\306\245\320\304\307\032\377\213\371\t\003{\371\202"
+	.ascii	"\005\247\n\354e\nM\023\370\262\204\b\020\330\313\017\0340-\365"
+	.ascii	"\263\273\310\227\225\272\2549\251\001\203\276\322\274@\001\322"
+	.ascii	"Q\002\004\007\214\212\210\326\313C\274\313\006x\227\013\360."
+	.ascii	"\023\340]\036\300\273,\200w9\300z\031\300zY\250\325\232\203v"
+	.ascii	"\227\201\330\313\304nk\036\366Z\263p\275\034\\/\003\325\313\277"
+	.ascii	"\364\262/\275\334S/\377\260\227}\322\313\274Fk\336\351.\353\324"
+	.ascii	"\313,{yM/\253\353\345t\275"
+	.string	"\214\252\227\237^\276\367rgXr\"\214k[\034s{Z3\351\026\261.\353\276\322\215\326\255\326\275\326\335\326*s3\263\025\267Yc\351\264\316\322l\355\306\2746\030C1\002c\232K\003\037\374\035\350\373\357g#\363\235\247\025\307\364\332u\013\225\301\231\276\306\301-\307\022\024a\302\005\207_:\342QfI\246K+\333\003\364)\370N\251\247\324\336\333\f\216\231\233_\030\231^\205\367\322n\360\230\355\326!\302\310\364\232\316(Ox\2433\215>\374\303\200\371\302\332~&\234Q\237~k$\244\377\274\002\205\3774\230\3669\005\336}\236\360\214\336t\235\027\270\336\235^Z\301'<\365\322\346\347\316\267V\220F\314gw\364\2403\031\335\025]\310\273\223w`r:\f_\221\334P\373\255\217\316\024\202\311\351,\234\007\326T\213/:\223\233\305\250\272_932E\037^\367\365\254\315\322\311m\3336\306\356Nn\267\356"
+	.ascii	"6"
+	.string	"\207u:\243k\277u\202\004g\217\341\302\331_6-9\020\315o\352\372\013O\317\226M\365\353\033\212\372+\207\351\265\324E\267p\335\333\234\356N\247\247oq\3131\256\203\347\314\027{'\277P\217\200h\342\314\336d]=\275\242)\321\207g.\251\245\367\2753\231\273\007\350\230\362D\275\223\233\324\320\247\257^\267x\2423u\215\024\312d\025\224\022J\2051\204\024\n\343\321Do\ny4*}TTF\345\224Q*\305Je\254Z\201<z@\001\205L\036\253\242\240\224&\200.\214RH\016U\307\251\243\324n\nyTV\2050VA!\217R\312d2\352\307QJ\310\344\221Jid\201LF\221\240R1UD&S\244HF\025\221G\250\024\305(%UQ\311\210\223*\214\312bU2\251,\362\230\231\237m\377\213\357\027\223%@\022^C\356\334W\252\322\231\277\307b\013\"2\370\232\326\374\265\231n0t"
+	.string	"\227`\340CG\331\324\0027\360"
+	.string	"r\226P\b\\\300\013|=[6Y\315\200\023h\360\001\007`!\353\331\034F\rp\001\273\007x\272\006E\023\326\366\225*t"
+	.ascii	"\357\345X\320\205.\242\307\027\240;\331gc\030\341\203X\033\260"
+	.ascii	"\337:i\301\206\264&\220\207\007\336\023\243\002\\:\2023\323,"
+	.ascii	"v\272\b\327\026\207x'\007\341\344\204\020\356\203#\023d\372\202"
+	.ascii	"\021nrB\007g4\210\340\007^\250I\217p\237V\233e"
+	.string	"sx\347\201\016\341\301\201\216\216!\376\301W\266e\023\213x\024\217\226\034\202;\370O\233\271%\2310\307\214<\302;\271\273t\360=\304,\200\300\250a($\215S\306\324\314\210H\222$\031\016\220\002\231\251*z\020`GS\223\326\300\233\360\3561gTSe\271\320=\bgSy\371\260Q\321 Jbev/\202\273\005?\324:\023\253\246a\260\305\344W\344\235\220\264\227o\253\256\326(\250\277\342\007rH\366m\020\200\332c\274'\0322*\354\252\273\240\363\371\r\215\204\331\213|\345\274\252\336H\274s\327\301\255{\300\263\337\006\022)T\234\346\031\020\274GB\304\240\305\002\224,\347\340W\"\270\340\027\216D\r=\027\335E\320\322\250\365 \316D\333v\3452\334-\024\313K\305K9\304\313\203J\3312\316\230&W\036\255\317\037t\201\362\214\377\006\305\336M\225L9A\311]\326m\207\270\323(]\235\003E\222"
+	.string	"\003\311!\317\"\275\343\302\365\037\275\t\213\013S\312{'-\017\034d\264`\203\333T\270\275f\2028\266{H\301\017\222V\031]F\373W\032\366\2242\332{)\363\016x]I\230\206\3210\024K\016\002\306p\337^\026\250D\3338\0238>,k\372\t;\310"
+	.ascii	"\262\260\267|\t\365\352\013\354#L\021\233e\336\344\263\301x\024"
+	.ascii	" %FL\003\3604\314\316A^\343G\205\004N\f\007\236\335\310d\271"
+	.ascii	"d\230\351\003\206\315\315\310\217\331\307(\324\020\267{g\241"
+	.ascii	"O}\273Q\246\351\222\362d\300\316\377%\026\263l\303]\221+\333"
+	.ascii	"T:\224R\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.7bd4319fb31113e6,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\003\177\001\314\231\263:\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\005\002\002\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.7bd4319fb31113e6,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.7bd4319fb31113e6,"e",@progbits
+	.string	"(\265/\375`\177\003%\034"
+	.string	"Vx\304I\220\232m:"
+	.string	"E\257I\364<\353\225\254\215\223Z\205\005j.\331,\005\251\375&R#\262\262ZC\241\326\177K\315\207\245\375.\352)f\036F\306\311?\"\271\312l$\224Y\332c\213G\t=\245o\300\367G\2134\005}\"S\242"
+	.string	"\251"
+	.string	"\260"
+	.ascii	"(V\257\327]U\240\327V\346O\252;\364\221\241\242\242\355\325:"
+	.ascii	"\3735i\261\032\3055\031\253\307\260)\331\232ZM\205\206\304RY"
+	.ascii	"\234\t\305\237\227\374l\204\217\260\326\013\245Z\333\327}c0#"
+	.ascii	"-p\354\2700\235\037\033!.B\221\223\260\222\363e$/:\372\313\\"
+	.ascii	"\322G\272\233\257\321\332}\362\205\265\351>a\314\t\230\023\210"
+	.string	"E\256|<\031\305\207\344/\373\214$\013\030\377\337\377\034\376/\370\337A\350?\202\377J\256H\371\317\363s\215\377\277\377]\377\265\376\277\376s\371\037\006\203\301\340\177\r\377\305\374/\2432B\361?P\337\214\310\232\335\253\032#\200\266,\363z\230\250\257UF\333n\364v\213<\263\233M\033m\331\216\365\t0j\337U\345\346\255\215\336\263\303\224w\2521\264=U\264e\325X\267l\243}\232=)x\235\242\227UEt\273\252(\217Mch\313\312H\201u\365C\004\312k\025=\2533\355\001\242w\3551\335\354\223\3524\250\333jM\307\2340\230\312\016\250b\027\345\\\371v\267\201\336\356jm\036\020\r\262v\007\331=u\033\231\027\3309\030h\332\260j*\251\356\003}\273{\335&7\260\273\315\356\316I\255nw\214\236o\330`!\317?#\007\371\347w\346\342\037O\231\340k\361F\326T\227\254N\2630\210\361"
+	.string	"\016\t\3053\016\362\314\204\333\363\026s\361\026w1\357\272i\304\200\261[(\274\254\351\252\252\241\0353f\326\224\357\334\365\027\035\361\224\235n\004\021^`9\023\212\354\204\2370\327\020C9Ga)\327\341\335n\273/L'\f\232\031\276P\004b\237Q\214\"\317C#,\030\f\006yh\274\232\353\300\206\260\231\n\023\212o\362\334\331}t\n\344\033\220\034\376c\237iw\257\300\271\235\356v\306\237\3178\314C?\017\2778\350\277\330\375"
+	.string	"\3006\313\244!\201t\235\001:\032\322LGK\312\371\023\321\005\r\026\230d:\233\023\256I\007\364\241V\202X\262\341\312\245(\233.g\202\tv\005/C\330p2]Y\342d"
+	.string	"t\264\"\b\272\033\324\b\362\022$,\001m\300P\201\254\021\335J\250\034\316F\342V\326h\271\020N\262[\031\025U\326d7\250\246(Y\r\227\223\021\005\345l6\234\223\315\003\255\324\321<\340\312\262Fc\312Pa\300kP8\333\315\346D\336\b\311\001RR\211\234')=Pz0>Ii6SB\232\221G\232\275pMO5\316\302\\B\254\345\274\205\271\034\347\274}C\035n\2340\t\305\036\366\031C\376B\236\205\306W0\310B#Wa+\314\365\303Wx\336\020\t+ 0\002b\224s\265\003\3652\332\n\344\314\336\325\b"
+	.ascii	"\242\216X\027\026AI\017RLe?\t=\025\210}\340\336\270\247\210q"
+	.ascii	"\245\030\303 \375\247\202-\202\354\202\335\257\256\210E\346f"
+	.ascii	"\331}\221m\205\220\313\342^\024y\225\201\334c\013\232.\002r2"
+	.ascii	" 0r\216\270\224p\315\301P\027g\035s[\006\344.\025\320\232\005"
+	.ascii	"Y>\245|,\210\313\002\024"
+	.text
+	.section	.gnu.lto_.symtab.7bd4319fb31113e6,"e",@progbits
+	.string	"GPS_coord_to_degrees"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317"
+	.string	""
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.7bd4319fb31113e6,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,291 @@
+	.file	"huffman.c"
+	.section	.gnu.lto_.profile.2a3159c5391a30aa,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.2a3159c5391a30aa,"e",@progbits
+	.string	"(\265/\375 \216\275\002"
+	.string	"d\003\202"
+	.string	"\003"
+	.string	"\374\230\247\260\003\016\002"
+	.string	"\002"
+	.string	"\002\001\002\001\002\002\002\003\002\004\002\003"
+	.string	"\002"
+	.string	"\001\236\351\277\366\016(\002\005\002\006\002\004\002\006\002\002\002\006\240\342\234\212\n"
+	.string	"\f"
+	.string	"C\0048\002A\317"
+	.ascii	"fR\300\352a\250\205\235+\220\352\b\233\0217\3032\363\216\r\264"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.2a3159c5391a30aa,"e",@progbits
+	.string	"(\265/\375 8\255"
+	.string	""
+	.string	"`,"
+	.string	"\002"
+	.string	"\005"
+	.string	"\003\001\004"
+	.string	"\003"
+	.string	"\003\020"
+	.ascii	"\035Id\303\002"
+	.text
+	.section	.gnu.lto_.inline.2a3159c5391a30aa,"e",@progbits
+	.string	"(\265/\375 \352\275\004"
+	.string	"B\t\036&\220+\303\001\253\271ZUU@\017\335\200\372}\245$\201v\306!,Z\330\202\371\n;\247\372\205\027A\b\021\331R\246?\366\305\257\261nY\024%\335\003\357M\264\263a\026\201\317\334\3041\252\030\252\237%;\037\356j7U>\301}9`f.\263\2010\006\363\261\276\367\336\022\227VTs\211pz/\242\226\367\336\364ZE\rI\250\340\376\251t\234Z7\020\305#\370\376\t\f"
+	.ascii	"@\f\270\003\366\201\315\300\226\034\002\026\007\360*\022\025"
+	.ascii	"\327ea,[\tf\003m"
+	.text
+	.section	.gnu.lto_.jmpfuncs.2a3159c5391a30aa,"e",@progbits
+	.string	"(\265/\375 :=\001"
+	.string	"\310."
+	.string	"\002"
+	.string	"\005\001\377\007\177\002"
+	.string	"\177\002\007\177\002\001\003\001\004\001\177\002\006"
+	.string	"\005"
+	.ascii	"7\213\350\274\221\322\036,\002\003,"
+	.text
+	.section	.gnu.lto_.pureconst.2a3159c5391a30aa,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\232\004\001\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.2a3159c5391a30aa,"e",@progbits
+	.string	"(\265/\375 75\001"
+	.string	"\300+"
+	.string	"\002"
+	.string	"\005P\374\007\374\005"
+	.string	""
+	.string	"\001"
+	.string	"\b\b"
+	.string	"\001\004PT"
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"9G\350\f&\227cg\371\006\260"
+	.text
+	.section	.gnu.lto_.lto.2a3159c5391a30aa,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_huffmanEncodeBuf.3.2a3159c5391a30aa,"e",@progbits
+	.string	"(\265/\375`W\b\2050"
+	.ascii	"\352U\330\022E`\\R\007\361\274\351\300\017\272\202\246\027Sk"
+	.ascii	"\241G;t\034hz\326\243C9JT#:\237In\370cV\346\254-\033\006.\240"
+	.ascii	"\300Y\004\020\b:\257sf*\347\370\303\376\235\017\210Z[\302\335"
+	.ascii	"\366\336I\246\024!\001\013\001\032\001$\332`<Ei\\@[\013\341:"
+	.ascii	"\273\240\t\352l\3175\177Ep\302\306\227s\032\322\331\366\340\256"
+	.ascii	"k-\356.Xi\271\325\230\257\200\b\201z*.\202\214\371\212\252\025"
+	.ascii	"\001cWk\271\016\346\034f\007\227sN\352\005\216\273=\212K\201"
+	.ascii	"z\032\f?\346,&\005.\347\264\244F\272\316v\232\373\304\321\240"
+	.ascii	"\335r\027f\254C\320\260\252\364\345\234\223\003\374\247uv\365"
+	.ascii	"\236\326\331's\0376\260Z\255V}M\363.>\324\217\306\235\"q\370"
+	.ascii	"\n\203.\260e"
+	.string	"\327\307\320v!W\f?\226\271q\375\311\003\302\306\365\266\312\326#00^\376&\004\357\374\210\213\342\"\230\023\327W\273\342\305\365\266|\254\021\2400)\273\302\303 ]=\374]%\230e\375\340 '\317\317\266\312\260\360lk\007\016\362 p\266\245\003\273\004\302\272\276\034\250\267\365\265\016\300S.,\334\342p\266\310%]\007\344\234_\256\031x\305\363\365\254\356MXW\017\177\217\363\243\2667a]`\216\201O9\347\306Y\\]\336<\336\355\313\356\316\352\006\202\b\217\337\261\376|\214\210\022\256\213w;G\222\331\233\356\bp\204L\355\177\354\331\266\213\201:yb4E\332a\264\316\372\233c0\261\27682p\265;-\006\376\261n\307r\336\372\372\305\272\233\\\315\275\001\003\246\245d\022\222\323y#\275\316\373\310\327\334\025$0r+\356\b\234\212\373\001Os/\200q\027\371\2357\221\317y\017\371\026o\241  "
+	.string	"?>=<G\243S\361\336\301\270\213\03071\210{\030\304\375\276\270\205\316\346\035\3646o\027\350n\336m\0207\273\342^\205\270_\210\033\007q\273\023S\220\236\275\234mT\353d1l\334\021\277s\237s\247s\257s\337\342\316\346\336\346\356\346n7\230v\274~\357\272\3249\r\227K\273\027\377\342vu\3159-/\350V\360\271Yuq9\250\317Y\255Y\310S\027:\024\256\263F\354p\355q\375:\273\005\255\315\204\353\254wC\333\263\270\026\177\353\267\273\335Zn\315k\024\316\242\360\345\234\0039\347!\3217\375[\305\313\353\301\321My\211\276\370\177v\364\305\027\252\202\273\317\217/N\370c-\364\304\307C\250xJ\216\340\211O\304\272\342\301\037\353\242\226\031\320\263?\333W\253F\273\364"
+	.string	"\222\226"
+	.ascii	"\231|\276\347\247\216\347\030\214\340\001\031|\257\355\361\215"
+	.ascii	"?\355\356n\360\306\307\3241\3240W\330\317E\362\3433\370v\215"
+	.ascii	"\024,\212\253\355n><}\034\302\022&q\230\334\347\231\236\305\021"
+	.ascii	"F\252$\n\364<_z"
+	.string	"L%\243\246Ar\240_z\326\312\025\351\037\222\017}\362Y\271\252\364\257\035\276O\026\034\031\270\332@\377\376\360_\016\313+*\346\303\323}\237\275q\306\337\310\311\033c\215Z\341{\030U\315\025\366k\344\017\275\360\035\317\017\334\b\203\365\025\3751k\324\330V&\337y\244\177\257\252TI4\312\323\254p\220D\376\003\262&\354\037=\276k)?S\302\tM\316WN\355fX(\225\234mo\321:\313\276S\232(\377\n~}\227*Y\275\355Z\374\377l\033\351Y\024W\333\003'N`\246R\303\253$\321\234\340:\227PN+\245\023\270\\b\247\262\352\225N\027@\347R\231bDT\207!S\251\201\271d\247\236P\314%\313Tj\bN=\241\234\317f\333RJ\314(\252\251\251\247\211$\263IE\325\224J2\227QTI\251*\253\244RQ7U(\253\222\316f\263*\371\246e_w\200\025\216\374\031\2156\330"
+	.ascii	"\023*yQ\321\367\223\214\217\036\177\254\201od G\265}+\311\236"
+	.ascii	"\261"
+	.string	"\030\364\t\212<\017\374\351\236'8R\351\324\225i\263\363c\035\034BL\262\200\305\r#](Xf\206}\317\203\\\013Xj\340\002\377Cl\337\337\334\310\fF:\317O\335\316+\224\375\021\221\276W|\340w\020\274P\320\214\200,-$\305!\320\007\177\332C\237w\177\332\353\360\370\355O\205>\351=\316\025\210\235)\362\202\302\204\370c\375\262\275M/\314b\366H'\312@\344\357Mb\310R\343q\316n\325\016\001\370\376\240\007\352\371\376\237\367\371i\277\306\357\365y\376\370\323\243'z\237C\005s\205\375|\315\001\200\257\250A8\245\fc\310\320\214L \243IZ8\200\002\23193m\020X\210f\223\244\003\274\244K\001\334\226d\321\316\020Rt\342\"R\364\227x\231\363&\225\330\005\031\273|\223\366\"*\376\211\321)\03322\024e\261\0250\265\312\2260X\315\201\220\213EV\206bc\337z\314t\306D\211"
+	.string	"\"V[\214\371^^.k\214\366\203p\2230\321`\f\316x+\347\204X}\374c\235\216\b\275\217\231&\357\345H \003>\305\216\026\363\354\013\224\373\020\277\020U\342\271YV2+\213\370\250\341\324/\237[w\004\255\341\007\027\2060\030p\357vS\005O\354\352\361]m\276t\240\342S&7\3739\005\t\212\033\211\200|\352\213\353\257\373\372\232\3234,\001\353\364\337\032?0\226\237\301\341\325\020\030^\270r\212"
+	.ascii	".\265\303\323\313\367t\361\275\372\3465\022\255o\211g\211i\302"
+	.ascii	"&\024\351\0324\203\311\363r`\261\243\0330\212r\271{\204no\326"
+	.ascii	"\006\024\"m/e9\017\344\t\344Z\016~>1\314\273bN\301E\343p\233"
+	.ascii	"&@\232d\023\337T\004\223\360\220:$U^\016=G\037\344\323\374\007"
+	.ascii	"\373z\323_\211\23135\316PW\362\215\227\277\334\n\305\031\202"
+	.ascii	"\241^wV\377\003"
+	.text
+	.section	.gnu.lto_huffmanEncodeBufStreaming.4.2a3159c5391a30aa,"e",@progbits
+	.string	"(\265/\375`\273\013uA"
+	.ascii	"\nq\030\031;0\346Q\007\"\327\241\352\331A\376\224\342\252\360"
+	.ascii	"\276\201{\001\243/5d\017\262\363\363\217{k\301\215\210c\3319"
+	.ascii	"\332\236@\325\177\0279\345\265q^\336\007)h\2455\356\266\367N"
+	.ascii	"2\245\202\001h\001\200\001\316\307\373t\261\273\357\232l^s\023"
+	.ascii	"\2233uL\217\357y\272\235\330\233\355\336\263\352\233\362\365"
+	.ascii	"\326\t\267\204\256\247\343!{\263\030a\335_\225\027u\2157\347"
+	.ascii	"\n\027\300\2343X\235\037o\331\364\245S\005\003\2303u\313\333"
+	.ascii	".\361\262s\202\354ix\354q\032\217u\312fW\344\354r\316\017\272"
+	.ascii	"\002\206S\204\312)\233U\235Dp\334\355t\356\346\351T#\376\224"
+	.ascii	"3\026>\273\234\251\017z\353\365\266\251o\267\263yv\343\261T9"
+	.ascii	"4\277\322v&\007S\316\231\313\312\247\\oY\217r\275}-8\027\237"
+	.ascii	"\370\330\302\301\301\301Ag\251\336,\373\364)\251(\250'\247$\362"
+	.ascii	"h,\022\207\257\320m\331\307\317\3662\237\022r\350\343\"\240\230"
+	.ascii	"\"\301\245}q\251(\326\312o\352\205\265\"3\355\202\241\034.\315"
+	.ascii	"\213?\025\241{N\354\006.\207\022\271\337t\013\313b\312\232\223"
+	.ascii	"\231\312\341$;\340m\220\232\373M\271\260Z}W\032y\037\277\"3\255"
+	.ascii	"\202\221ozQ|\274\312\222\346\346F\277)\025\353\031.fIks\242#"
+	.ascii	"\371\342C$\264.\022\\\332\024\177\331\fm\324lq\277)\033\373p"
+	.ascii	"\350\374q2\3235,\264\272\210?\272Hpim\356\3529\226\2321pin\336"
+	.ascii	"\262\302$P\300 "
+	.string	"\321\222\260\026\004\001\357<\317\261\024\r\212\3311j\376\236\347\r\330\370\230\240\2519\026r\31097f\202\226\346\r\300\273}Mw\253u\023k\004\356\202\007{7\215\215/\252\t\212\007\333\201k\375\211\227\300\206(\372\006\305\203\357\221\232@*\373\217k\030\216h\231\345\365\236\347ZV\360\002\351\334\320\223m\331\336t\275\245\360-\246\fJ\331b\370\237\230\226\334\204\377\276=s=\303\373\232o\316\331\253\235\320\223\n\r\003\211\274\030q\275\225\360\336\307\261\372\364\004\322!\301\203\335\3242\374q\335^\340\220\025G\375X\272\301N\230(Ab\204\210\020\276\347\r\302\347\270\177\330\340\200\2741x\034\367\013_\016\307\335B\005\257.\307\343Ma\202\004\247\272Gx\334[.\310\273\201\327\361f\340x\336\013\024$\320\312\302Bpe\304m\365\270\017$q\0330\342.\200\304]\365\270\t\274\270\007$q\0130\342\246\362:\357"
+	.string	"H\334"
+	.string	"^\334SI\334RH\334Q\217\033\352q?=n\247$\356$\322\355\274\217F\277\363.\"q\023\215\270\207,\356\367\210[x\304\355\032q\267E\334\354\343\376\307\215\037\267\243\020J\352\023\200(g(\203\2322\241\366.\214\357\271\003r\027\344\216\347^\307\275\316\035\217\273\235\373\235\017\273\007\265[\273\270\307\243\356onI \327\353\242\240\"VesvI^o\001\025\361\034\235\016\243\374\251\361\262\327\375\264\347u\021oY\355B\344\365\026w?\333\355\370\035\317\023$\336\345\322\350qE|\202\227\322\334#\242\211\254\307z\251[}hf\316J,\361\315\272\b\376\352\245\302/'\231\252V3,\310f1\027\353M|\325\244\350\033\325\263Y\"\235\211$"
+	.string	"O\365/\347\354\032\301\257\276\304cGQ3$>\304\003\370#T E\257B\022<\211\227A\305\216\033\226<\342\307\371"
+	.ascii	";k\230!\205o7\264b)\225(K\321\332\245\346\324\267\221\n\005\322"
+	.ascii	"\r\320\3436\351\305z\251w\270\352\236\031\026\354n0\257$\366"
+	.ascii	"J\375\260\217/\220\356\377\030\301\251#\004\361\n^\304\257hC"
+	.ascii	"\024}\213z\342\207P\203\372\250\247wz\250\247\312\023\275B\235"
+	.ascii	"\236^\200\234\250\230\344;\275\247pI*4x%_\003\210g\360\304\227"
+	.ascii	"\321\306\027\3254|\020\217\367\316\256,\034\220\254+Q\316f^\355"
+	.ascii	"\220\230. \004q\275\035~\227\":\341\177\370\367=j\206\365\326"
+	.ascii	"s\335\027~\353(J\246}\367\375\354\332\350\311\205\354-\342z\333"
+	.ascii	"\276[\275e\323\266G\312\346\345\247\307\305eY\255\017\300\276"
+	.ascii	"\205\307\360\354\246\250\231\013\317\276\353y\233\327F\347\277"
+	.ascii	"\302{\245\263+~\377\177\026/z\r\360\2577\236\213\277\225\023"
+	.ascii	"\025C\341\275Uc\273tvm?\256#\260=\330\273\334\031:\354\365\013"
+	.ascii	"^\352y\316\236\231\363'\336Bg\300\340-\327zig_\272\013\376\263"
+	.ascii	"T\027\231aA\307O&M!\261\356\013\002L\245\te\216\246\207\"Y\323"
+	.ascii	"\307\347`*\337\031\3466\205L\245\323\0316"
+	.string	"\346\202L\351\034r\303\250t\016\351\340\374\001\226C\t\304\006\231\321\311\374\321\364\340\f\273\361\2229\303n\260\312\0367l\25402\225&\230a\255\216\037\035\230a\255\322i\303I\3266\016\bL\033K\035:~\354\340b6\227\313&\016.f\230\215%\027\21612.\bU\335\364\241\034\343r6\233c\\Ej\366\307\322\200n\236Hm9\24190C\b\276\365\322o\016H\036\372h\312\352\273a`'Kg\"\351\300[\345\003\357|\273\024\275\"\277;\006f\"&D\263\024\270f|%\315c\373\306\322\334\032\022)U7R\037\327K\267\265B\t\023\245\356sg\2152\360\310?R\035\204\315\f\374\360\r\2459:$Z\342\326@\025\320\2614V}\201\307xgW\002\277\341\253\376\363|\275/r\002\177\304m0*\006\372\350\r\372Tb\2114\200\363\200o\307<\232\303T6N\037\327\002\036\371cU\276\253\230"
+	.string	"\006V\034\005\3229\240\225\232<2\370\r\n\376\353\245}\314z\344\021\301\033\267\374\013\257=a\364k\320LHA\343\210a\2414OZ\013\337\200M\203\306\030\342\314\241\266\3023xi\033\273\276\333"
+	.string	"\257\340\310\2269\324N\370,c\021S\031k+\341\021`\370\006\336\004\256:\350K\220/\356XL\360]/\355\"\326\037_\332l\361\352\213\021\274\301\217\b\361\326F\007W\251\265Qc\374\270v5sz\210\001\200\367\250Q(\307\020d\210d(\020\221$I\322\001`\002\231\261+z\021\320%TG\232d\343\317\301\202\303\361\3753P\005\360+\2723\222LB\366\006r\305\022\033W\007\205\212\344\203\351\372\310\030\370\3331n\370\004\021S,\314OW\031U\313Zl;\341\2363\276!\201\260\320<\257jJ\240\007V\224\030\304\024\342\251(\322\230L,"
+	.string	"\r\3501\223\224\213G\350\362\234\204\345\022\b\201\247w\206R\333\360jyq\344\227S\031\tz\200\026\213\334.\003\247\313\377\212\336\354\334\031\310\332:\315C\230\027\264\256\365~\001\2563\316Q\213O\212\2101\003\230\365;\203\211c:\352\265|\t\346\254\271\245\270\205\313\373\231\215\243\226\303\021\006\007\253\341\353\202\0052\337\n\371\240\022l\212l\270\256\312\200\266\203\244\230\344,\021[\013\\\253\\Pz\025c\021{\033\002\334G\f\260\304\321@\005@<\006E\233+.U\333\303\214\207\026\223\023\201\332I\320\037^\243\361i\004\021\320N\006\017\371\311\350\204\221\323\251\016\373\017\367\357"
+	.string	"\0051)f\016\265\302\3775dG\022\257aF35\316\2461*mqW\365fc7\321\346\023\274\300*\346P\301\205\315\360\212-@\214\346S_r\225\313\216\b"
+	.ascii	" \006\013 B\331\242\034\303!\n\271 ^\364\342a\230\004:U\252\304"
+	.ascii	"0hm\221\317\256\256\313{\315\210\325\177M"
+	.ascii	"\243z<\301G\035\253\004\036\273D\360\202\371\230\300U \351\347"
+	.ascii	"\2437\330\240p\367p\340\253n\206\277\341g\222e8\377%0\241\220"
+	.ascii	"\026\026\371\207\036M(53g\347\263\023\376\237\200y\242\324!\322"
+	.ascii	"=8\267\217\025\213\367\001\350\222\216\333\342\375f\243i\036"
+	.ascii	"\257\035q\353(\347\261W\316|\t\345JtB\250b\372\367\334\t\037"
+	.ascii	"\025"
+	.text
+	.section	.gnu.lto_.symbol_nodes.2a3159c5391a30aa,"e",@progbits
+	.string	"(\265/\375 =\235\001"
+	.string	"\244\0029"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\003\177\n\370\317\365\002\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\004\177\013\355\241\346\035\005\002\f\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\240Mj\3151"
+	.text
+	.section	.gnu.lto_.refs.2a3159c5391a30aa,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.2a3159c5391a30aa,"e",@progbits
+	.string	"(\265/\375`h\bm0"
+	.string	"JW\004\023H`\\R\007\377H\327\261\020\200\001*\205\212\333\317s\307\327\201\210_\013\202\331\214\021\271\"\336a\023\346I\322\026`\261\274M\226k\265\351\241;\233\037\316\277o>\373\006\215\332\242G\317\323'H\314/\263\017ll\333D\246\024\003\001\031\001\032\001\035\354~ \301\317\274\211\203\371\034\377\255\252t\336\266(+w\377q\317\320\320J\225\232scW\227\342d\036\007yY{\324\307\272g\214?\316A\3244\t\313k{h\333\203X^\265\352Alkh\201|"
+	.string	"\273Nh\033\330f\027\300\376|"
+	.string	"\333\355L~vb\034I-1(OF\027\035Y\214C\203F\220f^\273]\211?\035\214\007O5?\372\037\363d6-S\307\274z\227{y\374\343_\375@B\363^\260\177\376\307;9k\222\254A\223\327\016j\333\227\364\016\330K\350\334\266\377\260^\365\037\266c\037\300\266.\200\355\356\265\266\356\346\322\335]\272\373-\250\003\370Z\240\333\247t\267YwK\273;\254\273\025t7\211\356\366\351v"
+	.string	"\335\316\376\272\375K\267\367\272\273\256\273\277\272\273\254\273Ct7\265\273\323\272\033\255\273\253t\267XwC\273\033\254\273s\272\033Kw\363\252\325j\265\273\351\272\335E7\013\027\257L\360\317l*\251\306\034^v\234\3168B16=\376\377\002\311cV\363\221S\330H\363\337\310\221\351\223\021\336x\372@|\372j1\177*\352\337@\362\377\365\237\376\377\373\3776Jf\374\277\343\007;\223\311\177\252\236\3443_\263\250\377\034\205+[\302\320\254f\320\214\t\324\3711\342\327\235O\305R\266\320\367\353\247\376\337\347Z\347\322\206\234\027\252\317\316\rF\313\353\033N\027\021;\377j\333\237\335\3016\317\342a>G\230\303\323\313\307\332\234\213\203\371\224\252\002W\264\213\263\271\233\257y\354m\256\326\276\305\247\335\023\377#\377\337\257`Y\342ls-n\246\323\373ov9\377\343\241\241\236\241!\247\276=\314"
+	.ascii	"\254\355\\\255\367x\220\266\335\252m\307\321\266O\265?\027`%"
+	.ascii	"\254\007\275B\247\226\026\324\"\251<y\242U\0010EKR-\257\322\270"
+	.ascii	"'\347\n\315\216\037y\355\027-\025\237\342\261\237\271\223\366"
+	.ascii	"'\016\245s\374\017\375\377\3661?\363(n\346\323\037\026\236I\342"
+	.ascii	"\376\343\206\320\001U\324\267\2779\302\006{\241q\265\354\314"
+	.ascii	"!\225&\257n\346.g\265\355p\376\245\035L\203\361:\247z\036\334"
+	.ascii	"\263\006\363\356\251\250\204|v\277u"
+	.string	"G\327^\327R\234\377\347\377\373\364\230uvky\3659\017\353\221\241\252\222\346\325\345Z\232\357\256\242d\344\325\311\270\030\216\025%:\220y\365\270\226\272\234\227\221\261\274v\235\217\351n\237o\210\220.Yc\304\340\034\221\243{\2236\213\305y%\315\253\207q'>)\2551`\352\332\316\335\354\033\225\377_\243\027\277\362\210\323\336s\027\352\316q\236'\350\356\365y\215 \356\337\312I\327\026!3\362\310kw\003}o\375\277<\037\277\022\206b\275\260\330\332\222'\376+\002\017\325z8\306Z\256\315\317\037\277?\022k\271\002\216\233J8n\276\277G6\337\377x\371\203\243\306\327a(\326\022\2066\227<\217\374\367\241\306\253\026\331\\\302Y\232\313\037\f5.a$\326\222\247\312\351\243K\352\213\221\313_\030\3713\222L\243\3627\205\343\346S\377=\032\025\356\260\211\327L\r>\204\350p\004t\205'\212I.\220\213\364"
+	.string	"\002\n%b\n\f\302\"\021\203\223\320}jq\264sb\330\344\224$,\272G\005Zi\t\352\3020\303\257\225\232\212\302\241\360D\333\021\210\030\020\025\261\260\351\"#\007F\016\330.2\n\006\215\210\202m\023\005y\256\333\304>!\t\335$\367\310u\233\212#\236\204n\213\0228B\267\205\315P\370a\t\352\202\013E\364\271\315\344\323D\025\302\"\320%\022\213\300\033\027\211(\330\256OH\302\024%\222B\350\f\205\037\204&\210J6.R\221;l\202\262i\n\0240"
+	.string	"\211"
+	.ascii	"\261\241Uj0LrZZ\202b\002\016\211NND%\340\260)\311\t\250T|\002"
+	.ascii	"68\320\031\316R\036\2674\313\330\321Q{s\243\226iY\330\264\224"
+	.ascii	"\215\343\2332\253&7\362\333\036\3477\303X\221\361/Y\261-\034"
+	.ascii	"Y\356^\231\266\200G\310\024I^\2631\037=\026\312H\0372~\250\317"
+	.ascii	"m\256*\032\245m\027bw\252\325j\325\205\330\316]e\312x\225\215"
+	.ascii	"G\r\346\226\277\211A#[\323^\275a\002%\216\346\325\317\270\032"
+	.ascii	"\2333&\22145i\3308\256\200\234\250\2610\205\f$#\"4\"2\222\246"
+	.ascii	"\205\003p\002\021\252+;\021\300\255\201dL\322\202B=\032\003\257"
+	.ascii	"\371\004\261\n\232\026\007|\364T\314.#\037\214\226\351\335q\361"
+	.ascii	"\033\336Mk\202I\016?\217h\372\343\300\354t1\260\325\313G\016"
+	.ascii	"6\031\355\206\214\343\026\034\301\005MO\241\022cF\t\350\3125"
+	.ascii	"\034\200W\245\031\025g\r\017\336\024I\256\3468\017z\007\017\\"
+	.ascii	"t\217ch\365\013f\265\240\206V\216s\027I1O\3442\275\221\004\031"
+	.ascii	"a\215}9\300\326p\345\226\361MYk\370\336N\210\031\306\243\313"
+	.ascii	"\263i\344\005\222\033\332\2024K\334\304\337:\363N\220IFR^\031"
+	.ascii	"\317N \352\022\372\215vcJQ*\221\376\243TE\022\370\\`>\322\227"
+	.ascii	"0\370\351lc\247y\267\271^Rs\216\265\005\n5h\235\222\033\373\007"
+	.ascii	"\013\343%~3\234?\362\306\333|\031\256\203\f|\004|X@;O\213\257"
+	.ascii	"\376\265D\210=\rG\203I\240\3427\177\251\206\257H\253\303\362"
+	.ascii	"$\237\262\350\352\330k\377\256;\2065>\310\300N\304\346\201\013"
+	.ascii	"\232\2347r:\036\236\230{\311{\360\341bf\302\3723\001/\343\021"
+	.ascii	"\206w4\0265\334\370\276\024\377]j"
+	.text
+	.section	.gnu.lto_.symtab.2a3159c5391a30aa,"e",@progbits
+	.string	"huffmanEncodeBuf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365"
+	.string	""
+	.string	""
+	.string	"huffmanEncodeBufStreaming"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377"
+	.string	""
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.2a3159c5391a30aa,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
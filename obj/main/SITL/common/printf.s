@@ -0,0 +1,643 @@
+	.file	"printf.c"
+	.section	.gnu.lto_.profile.b74766c4f008699a,"e",@progbits
+	.string	"(\265/\375 \ri"
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.b74766c4f008699a,"e",@progbits
+	.string	"(\265/\375 \370\365\004"
+	.string	"\364\006\354"
+	.string	"\r"
+	.string	"\343\214\373\264\003\004\002"
+	.string	"\001\312\334\346\233\004\006\002\001\254\277\363\246\017\002\003\240\342\234\212\n\004\261\316\222\345\017&\002\003\002\003\002\004\002\004\002\005\002\005\004\006\002\006\005\306\261\236\222\002\004\002\007\002\007\002\b\002\b\006\007\b\376\220\273\353\017\b\002\t\002\t\t\252\335\206\331\006"
+	.string	"\002"
+	.string	"\n\206\273\306\320\013\226\266\306,\002\f\240\342\234\212\n"
+	.string	"\023"
+	.string	"x(HXmc\007\353\007\025&"
+	.ascii	"\237d\251\273\327\320\361\3252\340r\016l\250\025//h\345\006."
+	.ascii	"@gX \313\334\350\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.b74766c4f008699a,"e",@progbits
+	.string	"(\265/\375`\016"
+	.string	"\335\002"
+	.string	"\344\002\002\001"
+	.string	"\007"
+	.string	"\005"
+	.string	""
+	.string	"\003\002\001\200\004"
+	.string	""
+	.string	"\001\001\001\002"
+	.string	"\001\002\005\001\001\004\003\005"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	"\005\n"
+	.string	"\001\013\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\022"
+	.string	"A\263\211K\201\2251\360|\236\244\263\206\374\200 \n\204\0022\251B\303\271\302\305b\220\204\263\3402`\0270\270\260\273\272"
+	.ascii	"C"
+	.text
+	.section	.gnu.lto_.inline.b74766c4f008699a,"e",@progbits
+	.string	"(\265/\375`\352\0015\n"
+	.string	"R\016.0Pm\222\016p\361\"P\n\370\246Q&3B\303\003\205\025s[&PT\274L\306\354\373\231\332UUUSA\303\200u\233\277Q[K\b\331[\246W\223G\256\344\275g\311@_Zo\t\222\303SA\342\360\013\017\204\016\200\fe\203l\026yzi\255\344\372Z\330T\365\247\212}\245\311\317A\214\f\205\217\233X\320\200\350C\034\211\bIh%\255\251\302\277\222\377k\330^N\202\274\2462\3075\016\3643\225\353\363\261\367nrr\247jh\003\277\030\366\324R\247\374\3268j\360\275w\320\276"
+	.string	"\031$D,\004\",\376\016\233\177;\315\241A\346\355d\203\003\305C\300C\343G< P\002A\212\354<\fbG\270\200x!\031A\233t+\224\310pw\001\2020G\200\320"
+	.ascii	"\356\001j<\200cL\301\013\026\032\356T\375X`\331\313:\310\n\001"
+	.ascii	"\241\300\210A@<+\341\n\034\274\020\306\034\351B8\201\202\216"
+	.ascii	"\024Y\b\301\200&\032\354\001\021\035\346\212\206\261\002+J\177"
+	.ascii	"\201;2\225s\f\303|\030-q\020\n^\203\202\372\204\205\"7\331\301"
+	.ascii	"\301\325]\206\270,\303\276\327Zw5Z]\234\272\256\360\272)\260"
+	.ascii	"\236v\207"
+	.text
+	.section	.gnu.lto_.jmpfuncs.b74766c4f008699a,"e",@progbits
+	.string	"(\265/\375`2\004\005\013"
+	.string	"\222\216)*\220'I\007\313\374\037\373\001\276\037\177\273\273;^\\\231\225\260\325?\307\005\315*\177\302\260\367\243\266\310\266Flk\244m+\223\f\024\350%\236!\327\375P\377P\bh\202=\346\2530\362\232\364\376\342$\215F\002\364d\372d\204*\202\301\221z\341~\360\202X\326Z\266\206gx\351\376\360\016w^\013\206v\234\tT\311\230\246iz\271!\352!\252\037)\376\320\345}\266"
+	.string	"z\211\322T9b\306'c\363\355\3525=\306\367g\307\221z\216Tw<\363\256I\334\244I\236\031{\253\307\364\026m\323*\221\023*\230\f\004M\250\261A\241*I\013\264op\"\241\262\234\007\022\340\3610\002\216\310:\001\223\006\031q$\230\231`\202\t'\r\267\032.c\337(F\b\261\2227\236A\370Qh\"tM^+3\305\216%\330fh5C0\227\314X\265\2429\034\364\344\235hs\316\034\367\025\244\266"
+	.string	"\022g\325\201\331\347G\017\214MG\314$\274f\003\"\327\343x7v\002q\266C]DLd\246\201\370\202\236q\031\250\f\007\372\370\307T`_\232\0220)\343s\230 n7}\205SNBTm\257\310\2051j\236[\257_\212B\231p\314K\246\233"
+	.ascii	"\254\023HZV\211]\200=\277\320\277\274\200\023"
+	.text
+	.section	.gnu.lto_.pureconst.b74766c4f008699a,"e",@progbits
+	.string	"(\265/\375  \001\001"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"\231\004\001\232\004\002\230\004\004\272\004\005\230\004\b\270"
+	.ascii	"\004\t\232\004\n\230\004\013\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.b74766c4f008699a,"e",@progbits
+	.string	"(\265/\375 \341\325\003"
+	.string	"\322\204\021\036\260%\351\300%\017\2255\f\013\032\320N\312C\266\352\330!N \3046\3226!\244I\231\002\013\n\207A\001\034\204\203\020\205\201\312Qg*OeslB\246*Wm\347\353U\006\312\371\206k\327\216]>\233?\021\025"
+	.string	"\b#"
+	.string	"\354Ub\261\017\021\214\206y\202\001"
+	.string	"og\260O\305;\025\341%F\251\003-V^l9j\020\227U\2356\354\022\257\330"
+	.string	"l\035"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_.lto.b74766c4f008699a,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_putchw.24.b74766c4f008699a,"e",@progbits
+	.string	"(\265/\375`\335\004\225\036"
+	.string	"\2267\301K\240\326Q:\005\026\337u\256\272\"#\270\312#\271\216%\250a\3353\255E\037/kX\331rJ\005\260\251P\241\376\273\344\331~\3322\013\270^\217\327\202\327a\253\360\3709\005,\247\227\006\021(\007\227u\214f\255\021B\b\331r'\031\257"
+	.string	"\246"
+	.string	"\253"
+	.string	"<\345/\367>\345\330\272\267x\200\013\234'\271x^\307w\364\230\271l1*\330\023\206T\205\345\336k\313y\255<i\017S\236\354\025\263\030\233\307\343\361x[<\227\266w\332L\226\306\320\323,I\333\265\307\357a\362J\n\372N;Q\242\316\240\226L\\f\342\2515\217B\304x\023%'\333\003\3665\204\251\306\004@-5\035=\252\347\211\232n\332\226\372a$\r\"Y\b<p\260\270\361\002h(\tkI$q\322\364\2617\204^IA\022\267#\336i\260\310\346\334{o|\005\006\215j5}\356\275\\\223\202K\347\2263\237\0023O`\266\022\002765/\3764\227\372g\236u\226\251\305\300\274\234\352w\371\325\337\222\336\352\247\331\312\261c\235\321\363Zg\363W\347\222<\325\331v\345\356\312\325V~"
+	.string	"\005Ef\216\367\2068f\271K\310!2\216\365g\375Zo\3463s\217\037\344Bnd\0313k1\327\351S:\255T|\360\311\342\235w\206i5\225\364u\357\215\2005\364\373SB\177N\200_\367\026uN\362\203\223\274\032\242q\271FS\037zx\030\364n\305\343\276\327\211J\203\256\247b.F\357M\241d\353\336{\200\027T)\017Bl\257\314\357q\037\275\027\003G\2440\"\035\"\216\262\240=\324\271\355\033\217BMu\031U\260\267\023)RX\347\251s.u\216\323@>m\263-m\247\rd\027f\017\231\003Q\213|i\r\304\036\266\245\321\006\336\370\023\n\261\213\204i\266\326\245m\003\267\376>\324\211h\340\235/\370C\345\311\367\237"
+	.string	"\233\210\352\221\023\034\355\227\206 \364\372\331\260\367\336[\362\316m\3034\215\224\237SQ=r\0039\361t\204\354!\327\3169\257\254\025\301ye\254\201l\271\350\263=\254"
+	.string	"\2100\270\232W\322\272\006\304\212\251(F\025\214\271\350\253=d~\203&IZp?1\343\0047\f\273]\220\216gf\370\251\271\003]\250\035~;Pn7\224\263\374\263\003\264\273\005\351r\266\033NH\b\367c\273\005Y\020\262\375\3506\330v"
+	.string	"0.\207Ag\333\341p:\233\254xogg\337\334t\372\313\261\204\250\213h=\254\021CVc\366I"
+	.string	"\211\254\326l\323\226.eZ\247\343\325\242d\272V\225]\353\nL\306\331\3315-\323\335<LFd=\344\247\375\3047>\206\202\030\206\332\340\2649"
+	.string	"\t\032\323l\315\264\311\006\222\375\024S];';\246\035\b\257\374]\305\n\223\250\230\201\233m\323\266\252\254\265i\232g\232s\216\332\307\261\256\315#\f_\250a8\343\020R\006\031\031\231\200(H\242\016\200\002\231\301\272\r\021`5FhA2\354o\305\024\377f\211\030\"\371\377\3236\223\271S!\217\237\252"
+	.string	"\315\255\037\335\302\347\006\nuy\356x|F:\242X\022\375&\301H\251\fe\226\241k\037\3364\212\251\263\351<|G\323p\344@\035\245\227X\332\t\251\350\353\t@@+\n\316cK\261g;p\226\3471\026\212E\363\375\001\274\317\013\370\0274\227t@U\207\30710+L4\020k1\267\243\234\262\326\273\362z\247`\304\177,:G\bn\364\255C\016\023\372u\343\354\253\342MM\350\312\341\255G\224\201\317\374W}\254g\314\225\357\351<\222c\002\007\270"
+	.ascii	"\311)\347cS\236\032"
+	.text
+	.section	.gnu.lto_tfp_format.25.b74766c4f008699a,"e",@progbits
+	.string	"(\265/\375`h\017}J"
+	.string	"j|\200\033;0&k\f\364\222\232\2428bC\2210\372\217\037vDW.\226\277\221f\367\341\315\310\226\275Y\373\335mb\177"
+	.string	"\236\323\274\2602\330\326\273\237\004\360kk\"\331[J\271eJ)\005\256\001\213\001\243\001\177+\334DB:1)\334^63\224\033M\253\351\302Fd#6l6\320>\364\341\276|\033\004\257D\276\357\333\t\306\243^\303\211n\364\3155C\227\027\031B\001\003h\2479{F\251\257\333\002(\214\177\224\275\344\017~\rmB\206\354\327\363(\377\b\364\2225\360\352\334\325A RJo\021\301#\027\3346\303\314\354%\207=\031!~\f\337\327\320"
+	.string	"/\360@\"\204`\355\314-\246\307@\233\312\177z\351}\353\366\f\337\227j\200\275\334^2\325\3550\375\007eN\\\251wpMw'-C\371\276/\330\263\237\330^\256\335\304\366\362\255\360\323\241\255\365\314\302\272\262\252\242\232\222\212\202zrjbZRJr\"\035\0315\231n\313.\327w(w\230^\225\r.\332Z\353\007V\025\267\306H\336y;\263J"
+	.ascii	"\354\303k\3044\177\256\305\rv\026V\243\211\351\253\257A\300\266"
+	.ascii	"Z\356i\251zC\345E\375\363\233:\304{\3743$\025\325\327PY\366\374"
+	.ascii	"\311\357\f\377\374\234\232\364\232)o}ny\273\342K\213\275.N\241"
+	.ascii	"\212i\245\244\273v\336y\233\262>\337\367\235:\322\231>\222\002"
+	.ascii	"\346\017\317\017K\0309\266M\"\347\327so\200L\243(\335\354;oQ"
+	.ascii	"\2408Sk.\356I\273\253W$\033B}\347\355\311\372\344\266\307\326"
+	.ascii	"\213\255\265\345\315\211\267M\232u\302I{\261\275\rn\315\227s"
+	.ascii	"qc"
+	.string	"z]\237\354\320\371q\302\251\255^S9K\214\340\212\3707b\257^\240D\376\031\232\213\033lo-\274\357\313\316\006\027\327\f\240\231\335\214\231c0#\031\t\354\327\2675\237\337\224\235\360\016\b-#|\327\2671\223\261\355\367\234\340\234\"~\210\214e\277\375^\233v=\373?\344\364H\027\265A`DMxw\\\376\362\177\310\025\256qIsP\250.\217E\320gl\204\357JB'\270\247\351@\271\300x\272\323\343\026\302\3662\302{\2316(\377M\246\233-\220w\023+\340\377_D\251\\\343\362\325\213\275\005W\247OP\327Q\343\340Y\026h\256\307\361\253\343\3324\315+9\311\3739<wx~\252}\224\303\276\037B\224\252t\021\232W\372\230+y\034\327\267\343\255>c\303>\207\035\311F>E\374\3207\366\t<\363o\307L\215\372\201\276$r\370\353\230\307p\320\220\321:\213\261H\321:\243\030\321:\213"
+	.string	"\321:\177\350\300\356\016M\355\346\320\203\335\030.T\230\020!\254\025\233\0134\234\346//\002\235\246\271\213k\300;o\275\263"
+	.string	"\247s"
+	.string	""
+	.ascii	"\255\263\026\222\363\263u\316Z:c\265\316W\255\263U\353\\\325"
+	.ascii	"t\246j\235\247\216\234\245\230\316Q\2553\324\221\363S\353\354"
+	.ascii	"\324:7\265\316LF\316KLg\245\3269\251uv6\235\221\230\316G\275"
+	.ascii	"\246\331\350\235\233\357\314l\235]\327\271u\235\331w^\276\363"
+	.ascii	"\267\316\235C\305\033\245$U\341\373\272U&z\031\327\303,\235\330"
+	.ascii	"\255\330\r\247;M\367\232\356\303f\231\233\271\333p\273\3517\275"
+	.ascii	"\310Fp\316\236Q\2457\255\021\f\337\013\3053\367\345k\t\005\003"
+	.ascii	"\377`\t]S\200\310\251\336\3223C\303@\001\275\331\224~\351\255"
+	.ascii	"\004\035\253.m\245\377\307\312*\223\215L\223\202|(\333Y\035\264"
+	.ascii	"\364\341\271\036\304\377\237\265\351\323u~\322w\340\013\031\274"
+	.ascii	"\331>\374\372:I\354\244g:A{\347\367\333\264R\351\352)\235\255"
+	.ascii	"\221\236\231\203\0077\322\334 \220\376\201[\230\244)\304\021"
+	.ascii	"G|S\275\257nv\027{\364\314%Lx\263q\333q\003a\271O\260\030\236"
+	.ascii	"\371\350\037\270e\0214\262\366Q&\334c\033\347\333q\230[\236 "
+	.ascii	"\037\217v\222*\033\244\325\210\353\001|\033\277\357\\\205Nlf"
+	.ascii	"d\340`\241Dg\336\237\343\206lg\025\2201\352\212\230\350\330\334"
+	.ascii	"\035q\t\263\327l\307\356\273/k\230\215\247\013|[/6\21048\322"
+	.ascii	"\302\346\205\347\225I\340\275\\\215!\235\370\246r\224}\306:\032"
+	.ascii	"{\332\240)\265\222\375\235\034L\304\255\b\362\n\245!\356Cx\246"
+	.ascii	"\030\022\342.\304\220n#\036\225InA\f\351f\336\274Y\336Ir\313"
+	.ascii	"\271\302\370\327\367R\001\304\355\310\220\256K\342\225\022\371"
+	.ascii	"\327\367\207\231!\237\036\247r\357\033\355)C:\333\373z}?\026"
+	.ascii	"\372{\243\370\"#\035\027\336\035\233\t\232\371\315\3575.M\246"
+	.ascii	"\231\337j\361cH\016\255\271\330\314>?:n\205\347\265\355z\002"
+	.ascii	"\337\346\247\317X\002\337\225\244\221\351\344\035\247\335p\233"
+	.ascii	"fs\"\333q\272\214\n\227\315}f\026.\274\331*\374S\372Q\356z\367"
+	.ascii	"[\310\001jP\027g\216\373v\334|~{l\367\031\333w_\366\226\334g"
+	.ascii	"\001Ct\370\r\036:\036H\333\220\341<j\230\231\215\225\001iq\314"
+	.ascii	"p\26322\031bK\261\037>\243F\017\037\317\033eb\256\331\016\033"
+	.ascii	"o\243\207\331Y\217\225g\034\260a\306c\254\254\007\030\017\262"
+	.ascii	"\035;\310f\200\361\030\023\333\0016\243\314\007\330\201*&\353"
+	.ascii	"Q\243\f\314\214\214\254\f\314\210\3722\366\223\353y=\002\360"
+	.ascii	"c<\366\31668F\264Oc\037\207\335\221\201\204\275*F\032\212\214"
+	.ascii	"\272\"F-\304v\361t\021\343_\315k\226\321s}[\330\227\t\362\361"
+	.ascii	"\002\343)\354\275\314\226\200\337\022\260%\251\350'\327\353\023"
+	.ascii	"k\3007b\233H\353\223\026\2568\336\250\373\331T%\353\262\256\270"
+	.ascii	"\036J\r\213\264\260\212\3067\236\304=\252\021\237e7EZ8\305\342"
+	.ascii	"\235vr\322B)\031\277<\"\255:\245\370$:@\322B%\020?`\311\025\305"
+	.ascii	"Ia\243b\265\237f\013\335\002\252s\206W\\\317\276\004\332\307"
+	.ascii	"\211]7\325\323\363\273)\226,\001\336\317\354E'\033\021\265\223"
+	.ascii	"\260\216\025\215_\226\331r\"\214\303\250\026\331f\211TC\221U"
+	.ascii	"\"\236\353G\374\253y\376Wk\211\320\202ja\237/\201I\236\340\242"
+	.ascii	"v\022\"R\261x\n\202\216f\262\260>\353]\215\364\352\261\036+\315"
+	.ascii	"\261\252\344\352W8V\354L6\032Y\033\324NB\300)\261\347z\031\377"
+	.ascii	"j\252\336J\314\252\352\203\340\351\221\232z\177\322TH\250\244"
+	.ascii	"~J"
+	.string	"\352W\340\325\211z\204z\245\356b\243\242>\303\323C}K\027\241M\266\327?\375\n\274\252\3640\315+\241\n,\031\023\250\235\204O\236P<\327\247hz'\024NM\337ow\205R\247\001.\210\251\013\364\213\032\267a\n\201E\250q8\345\2203C##\"\222$I\032\003\201\005\304 \346$3\017\021 5TL\315\f\245\222\341\005<\204/\226\222PM\307\r\026\257\227\226I\351\250\210\243H\255\327(\261\255\\^SOD\370\004\236|\013\277\006\3050\366\251\353s\004,e\225)\303\240t_\312\303\372M\237\331(\017\031\233\247c\3603g\227\373\240\b\272n\202\310V\353P\317c\352\226C\261\252\027$\r\252\211\354\201\333>Q\340\262\272j-[\343Y3\t\256\212\364U\0239z\377\001\3212\300\3066\001V,\266EI\376u\350\366\321\372\035*\216%\201\277g\"\233]g\004\242|\374E\203b\240\310"
+	.ascii	"\007\332U\244\034\031\301\037I\367\303\036\260\222\244\326D\026"
+	.ascii	"\036\204%\245at\301K\333\355%\035m@\3225[\013\020C\r"
+	.string	"\200\251\364\340\201*\335\341E=7\326=B\273\254D\234/\344iTo`\n\213(\270\347vF\307\251\250XN&#jL\177\232\203\317Y7\356\341o\302\341\324`(K\\\224\371\205\2021\250\317\266\215\272d\372\001\273@\237]\256\262V\n\235\366\231\241\230(J\254\376\346\374\272;h\2427\016\271/\371\272G\3430\001\024\2313\026\b\004J\314<\033T~\247\016S7\316_m\t\304\261\026\242*"
+	.string	"G\235\351C\004\224\306\022\241\027\244Qy\277\272\301\241\277\352\006b\020\177\226\373\033\362\353ea\347\311;\355\007\337G\354\327}\354\177K\257\006z\025\242+W\354\264\234?\257q\016\233\272\360\357\223\301\261\371\343s\356\325\210\025\217\025C\020\303\241?\226\276\316\345\241\334\300\242\004\024\023\361M\340\233F\b5\216P\261\3606\214Hk\001\317\310F2\360\252\n\177`\320cQ@\027c\037\255\023\213\350\020\323\230\274\270\354^\253\376w\024P\245\200y\344\f+\305\226\261\332[\235\215\275\027\031\245<\332\252D?\244\006"
+	.string	"4>\213\203\302+i\213\257^\024\350\375&\345\341\034\3715B\025\254\322\300\t\372Z\342i@5\237\031\264\030\351\210\232\373\371\301\200&\305$\357"
+	.ascii	"\350\336\3370u\330\340\2406\030\352\311\316\017\035=R\371\330"
+	.ascii	"\204\222\360O\262%\215<5\036\217q\f\316\230y19\217\224l*Hx++"
+	.ascii	"\021\330\346\331\373\004\232\tfx\177"
+	.text
+	.section	.gnu.lto_init_printf.26.b74766c4f008699a,"e",@progbits
+	.string	"(\265/\375`b"
+	.string	"\375\b"
+	.string	"F\221=7Po\322\001\240X\300q_\231\026\006\204\364\323b\250\324 \300\375j\241\373\266,\267&p\357-\201DB&u\315g\306\325\214\006\330r\210m\345\274\210\264A\366\336;\245+"
+	.string	"."
+	.string	"-"
+	.string	"\230\017T\237\376l\226\327\215}\311d\242\324\262\2734j\374;\374\374\207<"
+	.string	"\024\362\034\002,\354\256!($\272\343m\033\330V\260\357\365\207\225u\241\202p\332\245H\275\254i\246t\330\276e\033\326\210\023zh\377\343 \337IF]`w\344\201\262[\023|\200\371t=A\365\031$/1\352\241\353\252Ox\252\200\321\027\371\b\307\3470D\007\036\324\251>\247h\305\305\342\003Sv\365\300\230a_\356\356:\216\354\223~\371\032\217\263\311\315\343l\322WF\343e\033n\243\231\206a\332E\263M\003F/\256\243\231\002k\233\003G=M\343\250U\367r\343\310\f\030\246O\224\260\214~\017"
+	.ascii	"2\241\th\340\270X `\242\322,\332\313\033\326\262\013\227+\214"
+	.ascii	"\007T5p\005\314UPQ\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_tfp_printf.27.b74766c4f008699a,"e",@progbits
+	.string	"(\265/\375`\337\001M\021"
+	.string	"v\340rG\360\320&\035PY\2279\373\235X\271\301\321\3114\336N-L\026\216)\257\335\024e \345/vM\346k\r[\336\2734Y }\020\033\361,\270C\004m`\376@\334j\274\035-=\352\3756~\253\225 \262\267\224)\005\\"
+	.string	"]"
+	.string	"^"
+	.string	"<s\206!N\260]:\334~\3427,\333'\2064\340gd\260\344\b\3159\271\322?\264\313\370\001\332\345\206\360*\353Q\256\262|\0236\261\017l=z\220x\271\214\034\257\026\033\022\350\212&\"YO\007\370\322}\354\261D\315\354\003_\256\034\017\346\234\326\017\364pk\267\335\3316\331j\n3\366M4D2\257\214}\330=z\370o\232:J\365F\265\256\372\035$.B6B~\346l\231\025\255"
+	.string	"\311\236\021\207\375:,\037\3471\223V<\207u\035\2258c\302\331bP\023\303e\301vy\002\207\331\247\344\n'\250\240&\350\006\344\322\"\333\245\332Oq\025\254\207\033\036`N\231\233r\367"
+	.string	"L\321\343\234s\256?t\002\205\240!\231k[\026\240\r\202\266\375\352\332$\025\364\337hK,w\361\027\256Q\322u\332\245."
+	.ascii	"\237\305[\230\370\"l\341\244\377.\375\223v\371\005\201\271\361"
+	.ascii	"\001E\314\212\316<R\220\177\3471\024\202\016\237\355]\320\177"
+	.ascii	"\366\230\2613${m\313\016[\272\001%\0314e\262Z\235T\0328V\250"
+	.ascii	"\223u'r\262J\235T(\\\312C\241\274\216K\235JP\\\247J\341D\f\330"
+	.ascii	"C1Qq+\317Sq\244p~\264$\036\240\225\345`\2258'\b\007\327\371e"
+	.ascii	"0\235\305\235\361\277\261\237\027(\235\242\305U\341\320p)\221"
+	.ascii	"\013\350\256\r!\202\376\213[r\371\034\006\006\t##\332\003' \240"
+	.ascii	"\002\021\301\343\001\321@\345e\353\207\240`\321\t\206\260\224"
+	.ascii	"\030v\227\2658\371,6\367\326(\266\203q\022'\302S\303\325\310"
+	.ascii	":Ga\300\30246\357\262\213\254\373U6M,\fC\344\200B\314\2032Xb"
+	.ascii	"X\221\352C\004\017\022\356]\242\003_^\217aJ\363qM3]\375\t"
+	.text
+	.section	.gnu.lto_putcp.28.b74766c4f008699a,"e",@progbits
+	.string	"(\265/\375`x"
+	.string	"\315\t"
+	.string	"\026\223C90%i8\200\213o2\377a*B+\204F\345N;\017W\276\001cBlj:\2615\237\240\230\275\227\033\214\354\230\031A\340Fh\246\325E\233\200\306\320xm\262\367\2262\2451"
+	.string	"3"
+	.string	"2"
+	.string	"\233\307\027p\337\272\023p\337,\3324\037?\226\343\222\271H\001\260\273\236z\\|\212\376O\036\260b\241\236\234\206\335u\256X\032\267\336\366\201\355\217}O~\327iy\001\301\354f\314\002llc\021\261\375\216mM{\201A\374x\262\356v\254\300v\367\343\204\247\375\222\233\210\177y\346\003\273-\022\330\356\3701B\367\034\251*\373\312F\341\327\324\274\261\030Q\035\205\302\324\201\370\023\334\267\253@H\r\306F*g\366\210Ju\331\327vw\255-\373\343\317\375\365kZ:\265\f\337I\367\007\212(\215B!\311\033\201\"\021\370y\243\320\203\310\373B\t\017d`\220\004\021z%\020\f\275\316\270\327V[vp\211\245TeN}\225\212S\312L\3347OL\017"
+	.ascii	"2\2413\0348.,\257\322\3404LT\303C\311h*\374O\350\312\027\230"
+	.ascii	"\271\006\274\n3\024Thp\227\027\355$\003"
+	.text
+	.section	.gnu.lto_tfp_sprintf.29.b74766c4f008699a,"e",@progbits
+	.string	"(\265/\375`t\001]\017"
+	.string	"\246\335hF\020\217(\035\200\371;<\310\204\370@\240\213#\360\037\\\375c\037\027\242\261\323S\355\250\337\205}!\220,\2425\234\033kn\325\177\0020x\224\254"
+	.string	"\210"
+	.string	" -Q@9\211\252,\344?\024E\r\305\304h7\331;\245O"
+	.string	"W"
+	.string	"V"
+	.string	"\037Vpi\177\304I\210\257%\327\330-\235\\\273\256\017'\330N]7\333\276\210\243D[F\253+\244\233b(.\261\335\355:\276\2419\325>@s:C\\\274\024\375\263\256\265\264\274\214$\321e\306\203\335\265\034I\034\356y\333\bl\207\330r\013\237"
+	.ascii	"8J*)&\331"
+	.string	"\234\251\253a\026c\264\202\2468]\365\257|\230\307\330\234Co\231v\210\251\240v\227\013\331\334\351m\321w9\313\334\211\277\210_\221h\353\241\256(\344\344\332\320`;=\201\253,\323qR\227\304\340\304\002\025\333]\217S/\330d\352\002\n\327n\r\224\243E\312\353\267\371\230\313\0270L\314\300|\030\311\231\003\310n\316\267B\0226X\354\216>\276\365\022\234\003+\023>\371\221\316\263\274\\2\030\312\024y\223\036\177\353,\n\0062\214\366\247\202\374h\001\257\225\f\206a\212\354j\"\247\311\276\266\273\353Y\362v\325M\237z\033\013\022\024\001\2018\236P\006\350\033\231\237\333\003\031\001\201\034O\247\003\303\357\013\275\016\344l\276\316\363|:\220\002\016;\"\236\016\024\206\236\216\253\243\333tv\\\254\f6\232&&\321vA8\370\352\207\245\344\314\0322\302\346\254Cx\305d\260\223{\032_\005\350\371,~\211\346\001\034"
+	.string	"2\003\3020\303&\310 \255a,)\314\3366\327\375J\b<\007\303h\272U\3132\256\251cZ\020&;\321\b\026"
+	.ascii	"\003@\210\251\202\302\3407\206\355F5\023\356\005\205\301q\201"
+	.ascii	"2\007\355>))\246k\222\001"
+	.text
+	.section	.gnu.lto__putc.30.b74766c4f008699a,"e",@progbits
+	.string	"(\265/\375`g"
+	.string	"U\t"
+	.string	"6SB90\345(\035\2363\230Y\320\3650\016\005\352&jN\344-\317D\205\312\312\360\001\325\032\211\200\355DF\002\231F,\f\030\262@\343x}DT|\217\306\366m\237\020\"eJ\0010"
+	.string	"4"
+	.string	"/"
+	.string	"\230\343\t\262c\232\017d\307\354\331/\217\035\233Q]\234Tbv\027\252\352\336\323\363\177\362\315\207*=3\r\273\353\374P\031\267\336\366\201m\217\375N~&"
+	.string	"\244\205\001f\027\243\005`Y\030\313\207\355wlk\332\n\013\336#\205uwce\265\273\036'<\355\223\274\304\273\211].\260\233\032Y\355F\217\0214\017%\373(O\231\360=,1\312\177\243\354\230\352F\343\232\372K\257\034\221\326)\200)[v,\245r\330\277vw\255)\373\361\277\260\264j:\257\f\332E\267\366\211 \205@\235\b\206\270m\3434\030\002=lP\353F\360S`N\004\321A\022\307u\260\023\367\327j\312\016!,\223V\230\223\251\252\366\306\345?\033Xh\013"
+	.ascii	"2\241\037h`\341Q\026&\242Kx`\016P\256\261\257\302`\005\025\032"
+	.ascii	"\334\345E;\311"
+	.text
+	.section	.gnu.lto_printfSupportInit.31.b74766c4f008699a,"e",@progbits
+	.string	"(\265/\375`="
+	.string	"5\b"
+	.string	"\242O88@\215\323\001\374\344\021\007\361\370\013\025xt.\326\254\342\260\312\346x\206\231.\312\205\tm\220\341k6\326\376^h\003|\224\206\002N]\216\2430\272<5X\333m\357\224\002\306.\t\033\r\263e\250V\263\254bT\303\034d\024\3338z\tp\315 ltS\353F\257\320;\351\005%(\223\224'=\246\3677~\262H\325h(\237\026\320\350 \2470C)\021\270\353\375\363\303k,\370\027f\340\304\177\237>\207\362y\323\243\005(CT\nyqe\207\236('\354[+%l\213C\251H\006>v\037V'\0132=0l\337/\335\3249h\203\216\321\356^\237v\307\276>\177\271\263G\036V\3549\"\034N\252\335\245\222\342\335c\347\237t\200\357\323\360X!\330]\307\357\003q\313\333\026\260m\261\035\022\r"
+	.string	"2\003\302\260\300\302\232\230` `\251\2621\2532t\r\027\017\341"
+	.ascii	"\025\375r/\270t\213v>\001"
+	.text
+	.section	.gnu.lto_setPrintfSerialPort.32.b74766c4f008699a,"e",@progbits
+	.string	"(\265/\375`\036"
+	.string	"\305\007"
+	.string	"\202\31777Po\322\001 [\256\242nN\314p\025\2617\002\2442\t\321\226\224\276\034\212[C\255\373#W\330\315\334dI7\225JQOSK\254m\345x\264n\031\331d\357\224\002\032\235\017\021\235\213z@\002\2668\020Zv\321\217\314&\206MKfW\007\223\026\005I\316\201\347\307C\2456'\225\233\272\247\026vv\3008\221\340\204\037\364I^\"\362;,\021z\347\036\375P\365\030]^>2Ho\306\256\243\0075\354S\273\273\206\235}\323\377\250\201\213\026\206\224\335\212\031\231=\305\025\217\215\355?\373!\027\331n\022\235`\267cQ\331\255\nN\320<\272\336\240z\324\274\240z\364f\303\274r\354OP(LbvW\302\215o\177\233\377\221\007p\245\321\037@\303\356\372q%\213\033\3366\202\355\005\333 \001\b"
+	.ascii	"2\241\177/pq\241\024\f\271\004\333\254\246\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_.symbol_nodes.b74766c4f008699a,"e",@progbits
+	.string	"(\265/\375`\347\001\325\n"
+	.string	"\242\317;7P\215s\004\322\"4\323F's0A\301\031<\265N\327\357:\016"
+	.string	"\254!qh\323\220CTU\031\204\263\372`\337\375\366\263\366\335\357\245\345\272\230\201\f\252wJ2\245\272$\247\361Bk,v\032o\271e\274$\227\361\216\235\261\330e\374\320\220\352\206\330\311\321B9\351vX1x\204\345\247\344\214 i\320\374\225\230fo\265\231\213\020\2266o\037\004\315\033j\265\212\024\221\202f\201rO\344\213$\323\274\250\313\344\201T"
+	.ascii	"\306\362\206\205\004\213\266\311K%7\221\374@\364\320\310E\221"
+	.ascii	"\223B.\002\371h\377_5l\t\035a5\342s\301<\016\232\035\017\247"
+	.ascii	"\212\343\036\225\002kE\005t\316\334|\230\306\303>\007\307\327"
+	.ascii	"HpM\214x\276\231\254\272\250\357:\214\363O\207\253\377\3771\336"
+	.ascii	"\001\370q\374\fUW\005\241\330S\311\253\265\271f\252\3524\t/ "
+	.ascii	"\260\002\271\242\316\001\fR\fb\031\232\306\350\3624E#\005\022"
+	.ascii	"\204!l\373\373W\202'X\004\177%8L\2708\355\332j\025\002\253h\274"
+	.ascii	"\"\372\365\020\034\30018\202\003p\030\034\316@`\\\n#\301\260"
+	.ascii	"\204,ZyO\023\016J\260\373\231\346K@8s\214\2751\373\f\\\270\001"
+	.ascii	"\367\216_b\251F\b\356\023\237\2033\006"
+	.text
+	.section	.gnu.lto_.refs.b74766c4f008699a,"e",@progbits
+	.string	"(\265/\375 =\351\001"
+	.string	"9"
+	.string	""
+	.string	""
+	.string	"\001\002"
+	.string	"\003\003"
+	.string	"\002\005\001\006\001"
+	.string	"\001\007\002"
+	.string	"\003\b"
+	.string	"\006\002"
+	.string	""
+	.string	"\007\003"
+	.string	""
+	.string	"\003\006"
+	.string	"\001\t\002\001\002"
+	.string	"\003\n\001\006\001"
+	.string	"\002\002\001"
+	.string	"\001\007\002"
+	.string	"\001\013\001\003\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.b74766c4f008699a,"e",@progbits
+	.string	"(\265/\375`_\031\375t"
+	.string	"J\300\270*Q0\022\322I\007\362\273?r\256\261\322e\243\254\036\223\371P\360\216\350\232\016\006|R\223yF\036YEd2iF\212\262\260\356\334\377K\241+\232Q\322O<QU\314\360\314\314<j#\"\242l\215\227\272rt7\241\326\335\031\270\213&m\226\020)S<\002\224\002\256\002\367\266&\200L\2300aBX\207\004\316\211\204\372\376Z\201WJ_\245\351c3\013s\327\252d`\332\304\3200_{\201\202J\272|ei\365\355\264\276\231\326\2356G\332\370\365\3511\231\0364P{uyzv\234'$\202CJH\026\016s\365\354\271\223&\251\204h\233\262\236\233\254g\261\325\307k\375\371\313\275"
+	.ascii	"\241bgy\255\362\026\346\302\321\003\270\013]\217\260\r\222.Y"
+	.ascii	"X\353\371\200 \377\361\001\301\263\216\225\004/\327\363\260\036"
+	.ascii	"i\345+\214\205\243A\234\345\f\307U\216\243lo\032N\235\231\036"
+	.ascii	"l\255\236\270\236\203\202=\034\024\274\013+\t\026 \250\262\210"
+	.ascii	"\240\004t,@\220\335\332\324\246\267\267\257V\257\301*\245-\310"
+	.ascii	"%\311]k\365\347(\347\266\213\021\336\021=aQ\266p\265\312L8\210"
+	.ascii	"\277(rp\2552\0337\341h\tvr~\302P\016L\266\267\275\267\355i06"
+	.ascii	"M\320Z\365a\001\202\275b=\227\b\246\177\177\\\"\3703\317\323"
+	.ascii	"\261\002dk\256\325C\260\276\3454\264\235\2535\2550\255\236\243"
+	.ascii	"\234\204\225\360Y\272|z^\266{\333\037\017~\270\302k\225[6;\237"
+	.ascii	"\361\222\247P\361\024yv\243\367^>\243\340yo\222\317z\326\334"
+	.ascii	"\233\354aV\200Y\001\025\210-1'A\365\016\254oY\200\340\312\"\202"
+	.ascii	"g$\357\321\272*\336\353\325\277\203\250\340\204\343\374\275\344"
+	.ascii	"g\243\037F\\\347o\343\001\370\373\310\203\177\303\360\263\216"
+	.ascii	"\"\334\203\310\317!\f\331\"\013\272\001\177\213\215}\375\333"
+	.ascii	"\207\237\241\334\203\330\317J!?S\020\366\263R\220\237\301~\336"
+	.ascii	"\001\310\317?~\276\361\365\363\017O\375\207\341\177\211\377/"
+	.ascii	"\374\354\305\003\374\201\277u\374l\300o\376\266\341g\256\237"
+	.ascii	"\261~\246\372\371\351\347\246\237\357\317<\374\314\376|\364\263"
+	.ascii	"\214\237\213~\036\3729\206\237[\3709\205\237O\370Y\204\237-\370"
+	.ascii	"\271\202\237U\374\334\363s\004?\217\370\371\201\237\035\370\271"
+	.ascii	"\201\377F\377_\3747\373\231\201\237\021\370\371\200\237\201~"
+	.ascii	"\006\340"
+	.string	"g\021\377]\374\354\363\037\355\377\331\377\240\377q\377s\376\376\376\376\376\364\177\332\342\017@\030\352\323\263\365\r\326A\336a\377\303\332\271\"\357E\266W\352\246\013\357\312\331w\253\230AO\237\353\373\017\336$\363\336\213\003\330^&\223\360\f\344\035Ny\201{UD\357%\262fo\035\322\226\274\"q_v/\362\347\266\227\271L\323B.\325\2704\177\332\2335\300M\343\272\313V\253\251>o\337\366\362Uj5oX\266O\346\262}\"}\256\362\211\274\267m\372,\331\222H^\246i5\227i\317\346\317U^\344MKf\255\312gs)\367l\372,\323\222\315\245R\253\371#\266&\254\312\351\217\213\026\036[*o\024\2243\311\364\241[\266\317kw/\263\321\270\314\005\356u>\231v\311\035,\205\211.\212\tJ\362\311\004@1m=\257\222nI\344y/\021&\031\027\212\002dKw\1770\035\222\313y\237h\334["
+	.string	"\324\275H\276t\367^\344\275\367\206\351l\357\265\362YB\241\240\356\255\002\202\272N\244\033\215{\233\355NJs\231\266\365\024r[K\203\336\032-\222\241\327N\213\271\246!\315\356\223\231\025\332\234*\003\344\207N_\020`n\177\351\360\360!K\236\031\037\237K\333\214\025\311\352.'\337\324\325]\036\327\326\231>\276$O\216\366\326\337Y\255\3659\3413'\312\024\025X\253\f\304\"\202BB\357'/\3613\263\342\303\363\032if\004\013V\367"
+	.string	"^\035Y\256\272G;\325f\032\236\224\276z;w\376\316\304\214i\265\255\236\227\203\007\304\nI\253?\303g-F\256\312\026\217\252\225\252\311\254\253\376\336\301o|F\303"
+	.string	";N2\256\256V\205,\"\330:\204\336T\"\202\314\252\366\262\001y\304e\201\265\252\303\"rL\261\035\264\207\334\024\216\036$9\274\202\264=8n~Et4\231<q?\312x4\263\245F"
+	.ascii	"SC\210V;J\203821t\353\371\315n\251\266\306S\244\320\252\364\252"
+	.ascii	"\b\361\004\225\203\202Z\3418\036\245\317UnEA\253\334\261\251"
+	.ascii	"\263\201\307b\252\370\201\031\202\343\230\216\255\203\350\237"
+	.ascii	"P'\331\f\3571]\025\006@\244\021:\303iF0-C\250\032\3637\262\237"
+	.ascii	"\332F;\365\215\276\374\3275\032\252\233z\3314\270M+\233\211\243"
+	.ascii	"\235d5g?^s\240\366^\345\275W\215\315\363ht\3411\301\317T\346"
+	.ascii	"8.5c\256L\320n(\371YK'\231\216\277\260\240\301\304\271\321\305"
+	.ascii	"I\357\336\366\374\366\013u\222\307p\231\0216\356\325\372B@M\355"
+	.ascii	"MK_\251\024N\2310xJ\036\246+\250\0172i\215\264F\372tD'\312'\365"
+	.ascii	"\225\336x\372\304gj\177ph\255\246N|\326G\242]4ZMmt\21643bo\255"
+	.ascii	"\246\313\303\001\311D\335\246\234\312\r\027\233\345Z^\232L\223"
+	.ascii	"i\223\220\240\035Sn\231*\2376\251Y\272\364\240ZM\231.\247\223"
+	.ascii	"6\304\317\216\r\233\364\226\001\271\246,\263\364\337\323\013"
+	.ascii	"\307\247%\325j\267\361\302\307\327~O\225\027+\f\232\023\335b"
+	.ascii	"%\212\232\267\237\030'R\370\264Z\3554\217\013Z\031\363\342\324"
+	.ascii	"j\367\241\231\0333\246\367\200\236\351\027=\274\275\262\027z"
+	.ascii	"Z>\230y\357\211\021\222\275M\211\265\332e\202\240\bq\353k\265"
+	.ascii	"\311\004\335`qYcj\265\365\016w\203\204{B\007,\262\376\356w\235"
+	.ascii	"\307gW\212\321\360\250\250\372\356\255\nR\321l\031\223\022\346"
+	.ascii	"\235\267~\351[c\243\325\306k/\rFe\307\020\336\333\342\013\003"
+	.ascii	"\374aw\216\266\035\307m\300v\223\315 +\367\016\332w\231W \370"
+	.ascii	"\t\2433\322\267eK\327\361\275`\330\256\234e:ksP\210\364\227w"
+	.ascii	"]\216\327\0252\352\205\216\217\217\315Kw\271\022\025\007\326"
+	.ascii	"Q\252\325\023*XZ\345\302j.\304\352\262\002\343en\256\2650\023"
+	.ascii	"\253+g\237Z\007\246\304\373\231\267\0261@.D\2048\231\202\005"
+	.ascii	"K\313\361]\336[u\323/}W\3162,'\251\270\267\034\234j\243l\n\223"
+	.ascii	"V;\013\243\335\224\335pbf\r\016\256\255\254\267\355\302r\345"
+	.ascii	"\354\333\201\222\331\332Q\345m\345\017J\305\335%\231\332\211"
+	.ascii	"\212\201\231C\362\366\366<\376\271\227K\rT\314\315\255\2750H"
+	.ascii	"\243nA\201\322m\254\366\344\312\331\327s\006\313\023+\312\273"
+	.ascii	"M\312\03293\255v\020\317\313)\273j*{`\271\222\003\210\035H\220"
+	.ascii	"\264\023\256\312`\353K\357VU\005\361\340\030\342\2123\355\355"
+	.ascii	"\344\335\204\tsK\025\223f\373q\230\306\030\222\254V\2572\327"
+	.ascii	"V\3535\032C\210\225\251N%p\336x\344\375\345@\375\202\bi\265\321"
+	.ascii	"\236'T*Y\322\243\325>\353\0369osN[Zm\263\236Rb\325)\351\026\250"
+	.ascii	"\346\026\307\327.\021nij\023\325\321V\242\243'\365\327L\"\205"
+	.ascii	"KoH\232\365)\336\372\224n\215\366\221f\002\265\027G\fa\230-\004"
+	.ascii	"O\333\214\030i\347z}<5\021\023\353\"\353e\321\346M\344]\004\256"
+	.ascii	")*\032\246\325\036\362<\234%dm\276Zm\262\366\322Y\202&\354F\253"
+	.ascii	"=v"
+	.string	"86M\267f\253\r\345\263\265\265JVA\023\366\261\255A\351\354q\310*\001\200\203\361(\2035\"\335\024\r\211Fj\f$\"R\2215*.\301\030\032\36212\0329\030\002\352\300&\035y\300\026\217\224\220\206\307\027JE\003\212)\206\3520E1\035\246(\032-\001/\343\004\222\261\210d$\"&\351\30020LQ\\R\211l\361\330\202\316e\234 \341E\b.P\260\304\032\216C\226\204\rDF\243\026\304\243\261\305\021\221U\322\301E\017\n,QI\004[D\n!i\311\305\217R\022\273d\214\301*\351\f\261E\244\242\216\222\022\221\210h\030\224A\b\206\tf"
+	.ascii	"\222(\302\030\016\315P\322A\311\247\206!;44\264\303\016\217\216"
+	.ascii	"\306\242\241\244\"6\307\205\317\020\020\007\031\301\033\220t"
+	.ascii	"\242\342\221\210D\254a=\005+\"X\301\"\207\233\263\270@\202\013"
+	.ascii	"$\b\236\305\005BB\027\254\020Z\277B(e\225\212FC\303\0317ED\354"
+	.ascii	"R\022\220\275\214\023(\224\216\304\031\305c\214\0217&\021\217"
+	.ascii	"(X\243\361\210Bg\310\016;\340Q\032\022\262\300\036\215(\370\020"
+	.ascii	"\215`\f_\314\b\036\211\305\242\"\213D\214Q\314!\016\021c\030"
+	.ascii	"K\310!\3060\036\251\304\241\023\330\2431iG\t\311Xd\223\2147D"
+	.ascii	"v\250B\214\245!\214\225\270C\321\305\312\016\261\270a\327\243"
+	.ascii	"0\306\220\b\002;\224b\002\243\342\360\305\221XT\264\304A\016"
+	.ascii	"\254\360\310\242@\234Q$\022\021U0\032\026\217D% vh\205\020\213"
+	.ascii	"T\\Zm \032\30202\032\266\310\341\230s\034\312 Ro\201\005-H\254"
+	.ascii	"`\302\007+\321\211\"\026\251xLB\201d<:2\022\241@*\016\217P\020"
+	.ascii	"\035\225P\234(\300H\036\317"
+	.string	"\031,#^?P\255i\340r\244)\222b\255]\260\206x!\322N\202;\366\300\272\f\341\nfM\3715!\363\022\226\201\353\3021F\245\227\214i\002\006M\357\272\203\354n\212X\332\304feMH\021\236\2562dma{@3cRhA\202v\322\3241\225\201\265_\017\031\031\247\025\220\307\221\301)\263\322\037\351\323\\\233\231W\253\251\217N\275\322\257\247>\336\372H`M\217\325\223+dA\365\371T\353\231r\001\225\244TksY\266\236r\361\334\225A2\265z\0351%\\ZZM\263\306\252\236:\253R,`\222{\231$h\231\354\356\262*\350\206o\317\307\227\264\307S,\235\345\017kFR\253\247WS\260\272\264~\254\177\312\303I\335\025\264\325\007\271\326\007\247\322\2504*\245\332RCE\325g\027E\355+m>\245JsP\001\211\322j\232\243\323\251T\307\323\034)\216\247Pq\241\262Ms\250\254"
+	.string	"\017\263\002@\270\260$ZP}\020j\375\231\224)l\221WL\312\f\202\035\250\022\0015\206B\2351\246LD\204$I\241\003\"\013\020\006Bq\246\227\347\001\022 eE\r2\251f4IA\n[\273\001\203T\316\004w.\361\207\224\326\323T\205~.\\a\365\333\252\f|?\265\\\365\335`\211\313\274\022\377\354t1\023\354\001}\356\273\021a\f\225\242\361M\366\001\303k}%r\031l\371N/\322\374\243\310:\324\210/|F~\"\300\003\360\3139\231U\316Th\002\330\2376\204\2724\301Ia\263\376\r\250E\006<"
+	.string	"\023`'#I\307\357E\334\244\360C\245<\310\231\357*\2022\275\251\265^\250\027\022\337gFK\355\357cI8\236}\250%H\240R\216\314\261O#~nh\356"
+	.string	"\f\300\377l\376u\\U\366\nU\224\202t\236\365\021\253\271\354 5\254\336\344\020`\263\263f\226n\022\234\b\036\306\336}\247\322\031\203\007\247\226\365W>\227u\365$m\001e\356i\3203R\350q\302v\247M2\257\205\215\372\236\nkY\271\332\345\026\206\024\314\352\312R\r\037\177H\350\315\343\347#\006>M\027_\371\230{7\347GI\031n(\225\021D\t(\002\261=\224\266\b\026\2769'\215\351O\006\362{\204\370\270\235\2264E\221\r\222>\205{z\357(s\244\003\016i\024\335Q\205\347;\221\034+!\213\371\376"
+	.ascii	"Ac\264"
+	.string	":\315\322\214\033\261C\277\261\365s\367`\017\232\211\263\026,n\r\370x\3059g\234\313\273\215\372v3l/HA\360\020<\f\267$\247\377j\211\343 <`\262\257\200\304\262j\214\336\rFh\227\034\327\342,r\002A\245\344Q\217\362\fI4\007\207\260\325H\241\224\2162\354L\242J\230\325\222-\353\302-Spr\246^\344{j\002\253\250P\353\272\023 -+\300F\276\206\326\300\332H\2616\032\013\270\350I\0246jO\327\310\235\236\266\032YD\"\023\301\242Cl\264\275A\254\362\t\225\274<\016\257]s\225\310\371\324+h\231\207&;\241\301B\332a\020\b\211\350\022\r\204\3345<\276\016\215y\0028\271SL\304C\310A [\245\035\245\013a\255\346\265\313WR\352U\347\375\324\305\373\242Kxh\013#D@g\003\276A\367\341\0249.\001S(\355\205\341\372\003\202,)\234\035\372\213\333\231\362l"
+	.ascii	"\376\340\337\337\213\332\033#p#7\335\n\330\236\204{\332\340\230"
+	.ascii	"V\335\356\305Y\364\315i\241\2435\036g\331@\331A\277\330W?\204"
+	.ascii	"\266r\245J\336\3719@\3550\260\227\244S\254\265\t\020A\225\364"
+	.ascii	"s\260nr\204$\267\003\231q\271\350wv`\267\022lA\316U\326\206M"
+	.ascii	"oy\233\322\314\004\320\221\362\277\316V\f\242\006\027\212\226"
+	.ascii	"\355\344)*\3348\344\037\307\245\220'\241\310\270\035<\316P\344"
+	.ascii	"\335\207#\03558\352\020`\227\201d\212R\322\344\325\361\375\317"
+	.ascii	"\001\020\343\007\256d\315\n\b\271:JcjH\340\030J\232\025\256*"
+	.ascii	"b\005\317\271b\306\025R\234N\372UD\350\323X.\347\001\222U\305"
+	.ascii	"\321\354F\204)\222\006\3538`\bk\334-\263h\336\210\225\021\317"
+	.ascii	"\226N;\214d\214\343H\241\027N\277A\203\320P)\237\366\006c\004"
+	.ascii	"M<6\207\204\243\220\025\246\367)[\002\353\305G'\256\347?\230"
+	.ascii	"a\354\006H\034\370\247\303`\343\354\260\367`\327\t\217\006S\212"
+	.ascii	"\r\002\367\340\362/O\244w_o%\347t\306\\\342\252U\363\216[s?\256"
+	.ascii	"\363\262Y\274y\322\374%~n\2237\276'\007;\2543\214s\202[\020+"
+	.ascii	"\320C}\257v~\23083\267\035\263\364\371\357>\277\250\013):E-h"
+	.ascii	"\035\302\027\246\375'wL\3703X*'\310\361$\247\033o\336O5\321Z"
+	.ascii	"\210\365\373\024\3017Z\375\306\222\265\002"
+	.text
+	.section	.gnu.lto_.symtab.b74766c4f008699a,"e",@progbits
+	.string	"tfp_format"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\001"
+	.string	""
+	.string	"init_printf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\001"
+	.string	""
+	.string	"tfp_printf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\001"
+	.string	""
+	.string	"tfp_sprintf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\001"
+	.string	""
+	.string	"printfSupportInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\001"
+	.string	""
+	.string	"setPrintfSerialPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\001"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\001"
+	.string	""
+	.string	"ui2a"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\001"
+	.string	""
+	.string	"uli2a"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\001"
+	.string	""
+	.string	"i2a"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\001"
+	.string	""
+	.string	"li2a"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\001"
+	.string	""
+	.string	"a2i"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\001"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.b74766c4f008699a,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,762 @@
+	.file	"streambuf.c"
+	.section	.gnu.lto_.profile.8dd98a2f27a47d17,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.8dd98a2f27a47d17,"e",@progbits
+	.string	"(\265/\375`\322"
+	.string	"E\006"
+	.string	"T\b\306\001"
+	.string	"\023"
+	.string	"\271\352\202\310\n\004\002"
+	.string	"\002\001\001\331\205\355\260\004\006\002\252\337\376\202\003\f\003\332\333\323\265\005\030\004\217\273\217\234\013\005\234\225\205\264\f\006\347\301\343\350\b\006"
+	.string	"\002\001\007\311\244\360\314\013\b\221\344\270\264\005\t\365\250\256\225\004\n\275\227\373\\\002\002\002\013\275\240\345\300\007\n\002\002\002\f\207\236\200\376\r\022\r\366\264\360\365\001\016\257\241\227\210\017\276\237\344\233\016\002\020\003\021\226\210\313\347\b\022\345\362\340\204"
+	.string	"\034"
+	.ascii	"f#5R\332\\\352B0\200k\265\314V3\037\030\025\001\b *\306\027\003"
+	.ascii	"\234\005\240\240\2556\r\216\002\216b\363\034P\030!*YX\n\200@"
+	.ascii	"(`/1\260y\205\013W&\231]H\005\030\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.8dd98a2f27a47d17,"e",@progbits
+	.string	"(\265/\375`R"
+	.string	"5\004"
+	.string	"R\305\017\025\240'\351\377\377\243\377\377\221\267\277\377\237\374F6\331\204\310\235d,\020Z\364\327z\320\272\333L0I\367\213\335F7p"
+	.ascii	"\2350\266\341)\n\217l\216\202\224\311{\213\214\322\244\313\322"
+	.ascii	"\300\017\001\" \360\"\013\256\033`\213\213\354,m\340.[\372{\212"
+	.ascii	"\001\242\301\271\312\305\366\013\367\177\276\3426\031LM#h\204"
+	.ascii	"\270\2318o\323\323m9\201\031\006Hy\307l\355i\226\303\220\201"
+	.ascii	"Bx\r\342\216\024\211\026\206"
+	.text
+	.section	.gnu.lto_.inline.8dd98a2f27a47d17,"e",@progbits
+	.string	"(\265/\375`\314\004e\f"
+	.string	"BN)(\220'I\007\277_yE~\237|\362\205(\371!#k[\003^U}w\373CTD\310Z\333\232\265\215\264\326\366\226;\005\377\001\267\203\225"
+	.ascii	"\034\343\177\354E\343`\335b\300H1B\333\204w\346\365!\005\r#\b"
+	.ascii	"\221@\230r\260\230\271\241\320\330]\304\036\332*N)\035\227\272"
+	.ascii	"\241`\277s\214\031\317]b-,\032C\333\304\212\222\244t?x\217)\220"
+	.ascii	"\363\220\001%\302\206\266\004\333)\031\363\020\027\3322\t\253"
+	.ascii	"xA\350\320\266\2317o:X\214~\330\275M\326uA\313\305\371X\372\007"
+	.ascii	"\371\005\261m\223\0278\211\002l\250\200V\215$Ia9\200\002\221"
+	.ascii	"\031\263\335\022\300\243\035\305q@\303\bS\301\004\022c\243\244"
+	.ascii	"\240\254Bc\217\b\b\261\225N\252\005\"\264\330|\037JW\367\t\326"
+	.ascii	"\355e1\356{(- iy\373\007P\0263\326\275\027\356d\307k\030g\235"
+	.ascii	"]\221\t\">dc\322Y\035Tr\274\342cB\325\361i\351\370\"\346W\313"
+	.ascii	"\311=t\226\232\377\002\270\b\326\230\354\2251\375\2305;>\217"
+	.ascii	"R\314O\riH:\324\314\351\353S7\256y(\027\244H\004\241\242\276"
+	.ascii	"\361\007\336\347=E<\034c~\242\362\250N+\263\f)\231\277\254\200"
+	.ascii	"\336o\024\240\0258i\354\220\212\211\214\370\212\334I\351\004"
+	.ascii	"\363eE\230/j\013\241\273X\246D\n\f\205e\3068 \350\025\253aP\336"
+	.ascii	"s\217\344\377\314\f2\206ftD\\4x\026\300\b"
+	.text
+	.section	.gnu.lto_.jmpfuncs.8dd98a2f27a47d17,"e",@progbits
+	.string	"(\265/\375`\005\001\275\005"
+	.string	"\322H\032 \240'\351\330\377\266\375 o"
+	.string	""
+	.string	"b\214SU\365\317\027\3775\263\377\375\366\267\326H\333\204l\231v\326\002B\270\001s\355^\260X"
+	.ascii	"\260\334\274W\222\242\322\336\\\276i\306/\376<I\277\211@\024"
+	.ascii	"k\255\225\224Rjs\340m\331\327\326\300\303\375u\3664\366i6C\244"
+	.ascii	"\231\020\021:x\250\211\371\336f\2337\023\377\231\301~\004! \240"
+	.ascii	"\242\252Q\017\240`\345\ns\231<\242NbA\234!y\204\001\004q\bV\377"
+	.ascii	"\312\306\025\003kd(C\"\002\370\007\030r@73\207a8&\217\261\314"
+	.ascii	"\005\271\224\204~ \2036\273\0227\266\340\nF\301v\341\341\262"
+	.ascii	"\202\017\001"
+	.text
+	.section	.gnu.lto_.pureconst.8dd98a2f27a47d17,"e",@progbits
+	.string	"(\265/\375 >\361\001"
+	.string	":"
+	.string	""
+	.string	""
+	.string	"\023"
+	.ascii	"\232\004\001\232\004\002\232\004\003\232\004\004\232\004\005"
+	.ascii	"\232\004\006\232\004\007\232\004\b\232\004\t\232\004\n\232\004"
+	.ascii	"\013\232\004\f\232\004\r\231\004\016\205\004\017\205\004\020"
+	.ascii	"\205\004\021\232\004\022\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.8dd98a2f27a47d17,"e",@progbits
+	.string	"(\265/\375`\034\002%\006"
+	.string	"B\307\031$\220)\351\260\327\335\335\242\233\205rw\027u\247u0)\027l7M\364\347\265\017~\333\376G\2154B\310\226)'\034\222\202\035A\355\210!Al\203\303\302\302\356\270se\t},;X\017\312\233L\277D\036\3454\202o4"
+	.ascii	"@H\230N\252-\324\302\226\302\317\323a\357\353\353;\277w\304\336"
+	.ascii	"`o\020\365\341\347\261\022( \260\"\031\235m1\001_K.8Yn/\034N"
+	.ascii	"<\030\343\004z\302(\225g\276\266\307s\306\302d/\221Vt\207\231"
+	.ascii	"\235\236\274\331\273Y\242\31491\300\177\035\\\032T\036\230\034"
+	.ascii	"\250\r\2224(z\200\303\201\026M2I\001y\035\b\301\005\b\260\324"
+	.ascii	"\301@\343\251-p\031^\021"
+	.text
+	.section	.gnu.lto_.lto.8dd98a2f27a47d17,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_sbufInit.0.8dd98a2f27a47d17,"e",@progbits
+	.string	"(\265/\375`\223"
+	.string	"\305\t"
+	.string	"\006RB;0\245L:"
+	.string	"\276\236\177\254\352V\315A\267h\302\241\t\333y\024\215u\032\\\024\204t\3256|\323e\033\304I\220:m\204\203\201\025\261\037\272\253^U\fJ,\357\323\272\221\334)\0050"
+	.string	"0"
+	.string	"/"
+	.string	"\006\023\243\265\201M\320\006\354N\351\371\202\311c\345\227\311\243^\374;\374\374\317\2160\033Y\261R\207\024\206\3355\\\261Z\267\336v\202\355\005\373\n\001\217\375\220B\251]<v)n\005\326\026C`\266o\033e[lY"
+	.string	"\016\234'\221\r|\354;\301\356k\003dwf\234\251<\332\3669\336\201\362\027Qm\323?0\025\032\252\366\303k\247\312\356r|Z\004\304"
+	.string	"\200\214G\377\233<b\\\004\\*x\263g\n\252\205}\311\352\313\276\354\217\237\277\006\r\"\220z\245\221\206L\036\222\304\037M\310\344\341: \257D\222\242\216\343\272\217\0249t8\371\361HRs\340n\004\362d\251\353<i\231{\311\352\013\352H\200M\245\022\016\022"
+	.ascii	"2\241\033\f\354\376\202e\024\035\230\n36\201\271\206\277iB\001"
+	.ascii	"F\30080\f\004\001\n\301e`\004\250{\301\317<\235v\222\001"
+	.text
+	.section	.gnu.lto_sbufWriteU8.1.8dd98a2f27a47d17,"e",@progbits
+	.string	"(\265/\375`\223"
+	.string	"]\n"
+	.string	"v\223F> \3458\035 !\025(\2042\0315\020\006"
+	.string	"\307\232D\023\002j\256\245@\\*\354\236\023o\0217\226\f\370\n'\350\371\017\016H"
+	.string	"\310TC\201\215}`*N\316\007\232\025\244\324\210\334)\0053"
+	.string	"3"
+	.string	"5"
+	.string	"\366p\327\\\336`\273\306\275\263]\263h\0078\300\340\220\032-\004v\267S\221\213\237\242\177\225k\\\257\325\347"
+	.string	"\304\356z\272^\034\267\336\266\202\355\006\373\013\001\337N\376Y6=\263\351s\032\217Nlw#V`a\232\f\211\355ol\353\264\031\034\304\227)\353.\b\f\350\323>\312S\304\223\252\023\354\216'1\273\245'\333\265\002"
+	.string	"\037S]83w\t"
+	.string	"\375:\365\0032JZ\016\317\202\342v\367\301_9\231\270\021\325v\355\2120\232\220\254\031\263\313\325\324\020\373\331\356\256u\264_>\025\241\223\226B\t\265\3503a\212\360B#\260\024v\244\317\363>QG\242\by\235\b\f\273O\202?\213\021\330\225\276\017\3546\345>[\035\255u\300X\332\362\246\376\313Ej\372\250\022"
+	.ascii	"2\241c\034\030.\254\244\346\024\025\b\002\213\3124\250\322ee"
+	.ascii	"\323R\003F3\261\016v\225k@T\030\f\346\006\250(\341\016/\332I"
+	.ascii	"\006"
+	.text
+	.section	.gnu.lto_sbufWriteU16.2.8dd98a2f27a47d17,"e",@progbits
+	.string	"(\265/\375`v\001%\016"
+	.string	"FZ\\C\020\221\223\016\t|ml\357XA1\274\2518\335\242D\250}\004\205\303bO?}d\031\342\354\255\365\270\346(X\243\r\0022i\274\035@\004@T"
+	.string	"\254\177\360)P\001\354i\331\201\255\021\262\311&R\246\024F"
+	.string	"E"
+	.string	"K"
+	.string	"\207\001\362i\237\304Kx7\231\\\300ni\304\212\335\317\303\036\330\241\277\017\270\016\261w\\\207\366l\030\004,p\264\214Xl\354\256\246\037\356==\377\247g$\224\n\317\250`w\235$\024\f\267\336\266\001\333\b\354\354\bZ\262c:\023\323YLc1\035o\372\257\257\374\026L\353\225N\230>\200\214\306\306\305\356\205\325\215\205\201. l?u \003\313Q%?a\350Ash\227\330\232\303\324\330\326\357&\274\257P0\334\345\320\002\004\0135NT\352\253\020\211\340\253\370\236\353p\023\223\222\321\024\036\216\027'\311"
+	.string	"y\246\031\375\214\223\020\242\\\371(oo\361`\273\233\300G\321q\276\212\311u\230\351QO\r%\021&K\257\fb\214T\241\\\331\237(\265\203}kw\327\001\"\234\t\n\3728Pw>\036Hh\260qB:\320G\033\341\266\215\353h#\0208\233\326\351>\332G\001s$!\235\006\342\270N\323|\241\237\276`\003LHEV\222ML\212\276D\305R\336\356\342\301\242>\225\252\372\221\n\273Y\\\226\246\376\364|\t\" p\002\031\312\353b\300\031>\221\260\\\nD\\\0031`w\217-\203u\f\340\035F\022\211`\276\262\005Y\3020\332\363\312N\031\332\342GA\253<VM\034\206-\303\246N\303N\305"
+	.ascii	"\214\342\037I\3444\354g\036\355\262\2643:tx\321v2"
+	.text
+	.section	.gnu.lto_sbufWriteU32.3.8dd98a2f27a47d17,"e",@progbits
+	.string	"(\265/\375`\306\002\235\021"
+	.string	"\326\037nF\360\222(\035x\177\335\373n\237\245\237\264\273\223X\377\224)e\244\245\235`\347\325\230n\243\370O)\357\346\227\223%{\032\244*K\006\375\235\031<\003\336,l\241Cjq\364\310x\340o\355\377\310\202\264\275\211\224)\005X"
+	.string	"R"
+	.string	"]"
+	.ascii	"\217\234g[gG\301z\f\006\207\314\351\241\246\244{$\300]\355\227"
+	.ascii	"\270\t\326e*\037\315\031#\301b\316Y\311\245\356\321\263\217\310"
+	.ascii	"\307\356\001\344\243Y\266\016\022\r\236\232\227\f\2209\347\267"
+	.ascii	"\037\316\272\262\374\323\036\002c\311p\355$\230sZa,\034\356\275"
+	.ascii	"\355\002\266\017\330\213\n\366\2719\347\364\306l\251&I\365H\252"
+	.ascii	"ER\035\222j\220T\177"
+	.string	"\244\332#\325\336e?\200\307\374\035\247\356D\265\344\3241\2529N\275Q\255\234\372\002<\037#2\346\334\220\023d\332D\027!l\177\346k\271\321\330L-2\257\245<\205#\b\357\321N\261\275\"\233\301\307\b\273\320\336\246\273[z\341\3340d\267\272\247\335\300\013\216\025\234\365_0H\3710~(\037En\\H\333\"\364\3448\214G\311GK\332\367X\021\341\322\034\277f\360+\302n\316\211\300W!\241\202\017\243\"\037G\373\332\265Cl\204\254\333\357\202\032/\234\226\346\3303\227\356K\023N\027v\025\232\254Q\246\007\026\034\244N'\252U\370\241\200\251\024\210\372P\"\234R\037J\025~\246\001\006)\234\250\276\025\b\252>o\326:77\346\323\256\340\204Mk]\356@\360\354\ro=3\006o\303\333\317\310\355\220\310\037\321\004\2644>\013\272\031\374\214\317\376\306m\024q;\266\201\310\215\213hiB\033; "
+	.ascii	"\003\2211:\006rB\237M\201\031\311p\r3|/\326:\360\213\262=\220"
+	.ascii	"3\330!\347\022\230\001k\317%\262\003\254#rOr\007;\344\\\202\031"
+	.ascii	"\030\256r\264\347\022\266\203Q\330\204\227D2h\034V\026\004\027"
+	.ascii	"\306\326^\333\354(C{\374P\311*\207\253\246\206\3212\244\335\242"
+	.ascii	"\034o\206N\235\036vB\f\260(\276E\022\235&\373\331Q/K\253\243"
+	.ascii	"#\017/ZO\006"
+	.text
+	.section	.gnu.lto_sbufWriteU16BigEndian.4.8dd98a2f27a47d17,"e",@progbits
+	.string	"(\265/\375`v\001%\016"
+	.string	"V\232\\C"
+	.string	"\221(\035\371f\022:m\252K\321^$\244\274\213\n\345*6Y/}S\207b\256,\b\345\352W\324\230\fl\371\203"
+	.string	"\224\033\374I\273\252Z\005\376uD\3619\223\204\260.\343y\3557B\366&R\246\024F"
+	.string	"F"
+	.string	"J"
+	.string	"\331\241\200|\332\037q\022\336O'\037\260kry\331\375<\354\221\035\372;\201x\230\235#\036\332\263g\030\270\300Y\221Zl\354\256\246\036\356==\377\250gJ)\026\236\330\202\335u\226R2\334z\333\bl+\260\223#k5\331XZ\203\2453X:\303\322\330O\177<\313\177\305\264\306t\302\364\003"
+	.ascii	"XQ\200"
+	.string	"\305.\206\326\215\215\2010\037l_\025\242\241\345)\223\2330\f\2619\264M\354\315anl\353\367\022\336Y*\030\356r\220\001\022\376\212\377\211\207\035+\025\215\242\370pb\274D\003\344\031\325\350k\240\200\030\245\274\335\345\223\355n\210\177\242\343\374\225\223x\230\321\247\236\033L\"N\327\324\223X\242l9\273U\304K\257\r\\\240\260F\331\262\277Qj\007\373\327\356\006#\035\n\032\002=P{> Lp\260uD\272\020H#\341\266\215\363h$\021:\233\346\351@\332\307\001s%\"\235\026\342\270N\333|\242\243\316\240E\214HG\326\222\216\225\212\246\3004Sy;\314'\303\364\252KU\217z\202\0270H\254T\377eDB\" \200\002\221B\355b@\035>\311\260\\\005\032\327\266\230/w\357\226i\035/\274\243\227D@HU\016\343\325\036Bv\221a\314~\373\206\232V=\227'\006\032X\201&L#L\304"
+	.ascii	"E\361\037I\374\264\354g\217zYZ\035\0359\274h\r\031"
+	.text
+	.section	.gnu.lto_sbufWriteU32BigEndian.5.8dd98a2f27a47d17,"e",@progbits
+	.string	"(\265/\375`\307\002\315\021"
+	.string	"\026 oG\360\260(\035\363}\221\375\001BYe\034t\332\323\020 P,OYX2\320\373\262\260\212\244\325\211\335\331\272\b\277|9\023w\221}Y\035\235\310&tc\234\231\2402\355`\\a\003w\263\366\177\254#vo\"eJ\001X"
+	.string	"T"
+	.string	"]"
+	.string	"\336#\347\331\326\332Q\264\336\302\301\036s\212\240!\322=\032\340\256\366Y~\242u\232\311Is\312n3s\326L6u\217\256]\200|\354\036@>\272e\327"
+	.ascii	"\361\360\261\001s\3111\347\374v\366\326\265\345\337v\217\030"
+	.ascii	"J\207\253\307\301\234\323\032C\001q\357m\037\260\255\300\336"
+	.ascii	"T;\302>7\347\234^\231-\325%\251&I\365H\252ER\035\222j\220T\177"
+	.ascii	"\244\332;\355\007\360\226\277\213jOTKN\035\243\232\343\324\033"
+	.ascii	"\325\312\251O@\324b\200\2129?\354\354\2307\221\206\204\355\337"
+	.ascii	"\032\244\304\270\200a\220\342\362\227\222\247pd\361\036\355\022"
+	.ascii	";#\030\203\257\t;\321\036f\227\033\355\336\366\004\263\032]\177"
+	.ascii	"\005\004\225\277\342\207\362\361#G\245\2644\341g\306c7DN\332"
+	.string	"\322\036\307I\211\327\213\301\317\204\335\234s\201/c!\203\277b\"\037I\373\227k\b\231\t\332W\327\004\323q\351\216An\026\262\333\257g&s\242\363\322\035\273\366\322\027N\033\226\025\246\326\250\220\t\032$\250N#+V\370\221\200*\025\210\372H*\234T\037j\025~!\005\fb\030Y},\020\\}^\315un\256\314\267\375\201\216\033\327\276\354\241\360Y\031\336~n\006\037\303\333\337\272\365 \300\301\201\351\310Thm@\033\2121x\030\240}L\\\331E\033.\302G\216\312\276\020m; \360\002\221\261\252\003rB\243M\201\021\351pm\030\276\027c]\370\035e;\356H\020Sb\354\2540`\370\274X\353\302\017\312\367 \307`\207\234S0\303\302\201?y\333\313v0\b\233\220$\340\320\273\022b\376\321\t\343hOWv\225a\230\375\306\r\313\257\002X\237:4\254H\320f\213\320\276\b\204\211\b\223c"
+	.ascii	"F\361\023ItZ\355gGyYZ\035\035rx\321\0362"
+	.text
+	.section	.gnu.lto_sbufFill.6.8dd98a2f27a47d17,"e",@progbits
+	.string	"(\265/\375`\f\001\215\f"
+	.string	"\206XUA o\233\016\243\331\004(\210#\2600r\017\0340\252\336.Fp\251+\352\320P\002\224|Y\216\210P\322@Px\365\033\253\332\177"
+	.string	"\b\201"
+	.string	"\030\270#\003\361S\300(\260\003\352\355\277?\331[\312\224\002@"
+	.string	"B"
+	.string	"?"
+	.string	"\377\260=\324q"
+	.string	"\273^\t\312\356\247\261fz\364w\001\322\343\364"
+	.string	"\322\2437\273\305?\222\275\311\204\020\021\214\335\245t\303\267\347\346_tK'\302=+\013v\327\331\211T\270\365\266\r\330V`\337\013'\277\024\3231\246aL\253\246\023\246\237\221FV\f0\261Ka$cS\342\211\022\333\307\330V\0207\331~b\024\266\354fP\201\262\273\032s\246\307\002P\323F\220`\373'\301\272{\201\304\201\247}\017\0011.yMU\265\255+\337\031\203\001D9\333\021.\202c\332]\216\037b#\2338tH\217\252\032,B\025M\275\244\327\313H\212\220\031\0369\262?.U\203}\270\273k\365\354\207~\313\277\277\362\240\317\206VZ\345\201Z\346Qw6\0168\032X\325\007\3232\ntY\326\325\241@\017*\213\352`\031\265!\340\013\302\007\243\264\353\302(\314\267\207\253\236\031XH\361\320\017G-\221!y\347\342\n5\352_\200t\370\310\321\b\250\312\211\002\027"
+	.ascii	"2\241\037/0.\020\302U\203\301P\345@\225=h\031\327\204\007\342"
+	.ascii	"\b\307\232@\032;.V\2039\366p\r\343\207y\201\300p\005$\214\005"
+	.ascii	"s\003T\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_sbufWriteData.7.8dd98a2f27a47d17,"e",@progbits
+	.string	"(\265/\375`"
+	.string	"\001%\f"
+	.string	"F\327Q@ o\233\016\243\3314(@T\326\370@\007\215\200\320\235\211\032\272\222\251\332\200\2068\030\300\310\013\021\241\246\341)r\353\033(\233\177"
+	.string	"\202\300P\f\376\034\272\225\253F\201-a\332\254?\331[\312\224\002="
+	.string	">"
+	.string	"="
+	.string	"\030\027\260\013\002)\331\365.\276H\217\366N z\224> z\364f\247\270\347\261\017\221\3001\302bw)\325\360\355\271\371\037y\245\353\340\236\224\005\273\353\354:(\334z\333\bl+\260_!\241\237r\221?\3064\214i\215\351\204\351O\321\307\211\002\337\356\204\317\305\232D\022\034l\177\262\255\037\036\262]\304%\\\331\305pR\262\273\027g\244\307\0030=\237\230H\360\264\017r\017\333C\001\252\312\211ha\311\253\244\251\266u\345;O\0276\224\263\035\341 >\322\356f|\022O&m\300\210\036S\003\240\bE\275Z,\220p\274\310\310\317\366\270\324\f\366\341\356\256\025d\337\373\245\007\035\016\004\255\264j\003\265l\243\326`\034|\032X\025\007\3232\252sY\326\245\241:\017*\213\322`\031\2051\340\313\303\301(\355\2720j\362\366p\025d\006\035L2T\303PG"
+	.string	"\360x\247\342\252\n\365+6>4\362\013\021\030"
+	.string	"2\241\037/0.\020\302U\203\301P\345@\225=h\031\327\204\007\342\b\304\232\340\031;`\332\035\\\303\004\314\274@`\270\262\204q\203\252\001\367\300\260"
+	.ascii	"\025\032\334\345E;\311"
+	.text
+	.section	.gnu.lto_sbufWriteString.8.8dd98a2f27a47d17,"e",@progbits
+	.string	"(\265/\375`\026\001\255\f"
+	.string	"6\031W@\020q\233\016K\225\271)\200\374"
+	.string	"4\017\007\353\334&R:\026Z\005l\025\303b\004I_\232\333\177\235\360\247:\212\033\271\035\376\377\t\240"
+	.string	""
+	.string	"\212\3404A\270\335*\235!\200\255\215\b\331\335\244L)B"
+	.string	"?"
+	.string	"D"
+	.ascii	"\276\210\243p\367F\036`\327\304k\261\373U\\\231\016\375}@<\234"
+	.string	". \036\232\263e\374;\331{2\220\224\260\261\273\226r8\367\344\374\247\234\352J4Oi\301\356:\273\222\013\267\336\266\001\333\n\354\177\b\273k5\261c\232\212\351)\246\245(\035\357\375\360\337\037\301tF\351wD\017\006\201\031\273\026B8\026\004]x\260}\337\363\217\310I\230\001\213\020\273[\035\332\"vu\370\312v~\024^ x:\221J\352\177.!\371\316\225\206\216j\374\2171G\241M\273\233\300?\261A\360;\214\304CI\001\304\360R\243\376\363\304\340\271\246VHrl2d*#\2651\t\371\356z\240\203\002\252\240\032\373\343\244n\260\037m!\031L\266iq\323\034\250-\037\017&4\270@.\331\246Y\031\354\2720\213\225\301\200\\\226%\323\254\217\002\306\"\\2k\303\260\314\252\276\315S>\231\030\001\332(\307\224\256\320:N\336\321\210:)\245\257\321\001\301\311P\212IU\243\342\206GF\r\026"
+	.ascii	"2\003\302p\331\302^l\2443\\\304)\031\244b\0170\266\025\302}="
+	.ascii	"]5&}\332>0~q\031\003h\b+\334\007\252\201+`n\200\212\002\356\362"
+	.ascii	"\242\235d"
+	.text
+	.section	.gnu.lto_sbufWriteStringWithZeroTerminator.9.8dd98a2f27a47d17,"e",@progbits
+	.string	"(\265/\375`9\001\255\r"
+	.string	"6\033^B q\223\016\214\253\202\314\362\326\326\233\243D\316]]Q\t\016\026u\027\202h\304\227\323\304V\354\326:C\t\337\214>\222\204\026o:\r(\030P0\271\bt c\220\310\270\257\2304B\310\336D\312\224\002I"
+	.string	"E"
+	.string	"K"
+	.ascii	"Kb\242\260\340i\037\304C|^\032\371\200]\223\027(v"
+	.string	"?\2141\327\241\277\027\210\207\327\t\304C\177\354\030\377N\366&\016\244\0214vW\323\r\377<?\376Q\216y%\240\247\345`w\235^\211\205[o;\201\355\006\366U\004\252\301~\265\273k5\261\255tf\245-V\032\253\322\327K\277\365\357\2171]\301\264\302tV\351\007\210,\\\034P\331\255\220\262\261(\230\302\203\355\373\246\237D.\302\017Vd\207\266\210\235\035>\263\235\337\004\003\002\002\232\274\347,\303HA\376\311\0367\001r\355.\003\277\304\307\306\3570\022\0171\275\300(Uz\351O\317\013&\325J1\244\225\320Cb\252\352G\030D\231\3625\025\336 \255\2042eKF\2657.\357]\025\214TP$\n\262?Q\006\036\234M\347\351DO'\202:\303!!\004\302\326\241\351<\035\215\303m\033\227\3218\233\216M\313t\035\215\003\201\271\017M\247y8\256\323\262/t\224_$Z\240B*r\246'@"
+	.string	"\234\334\223q\251E3\375\214\321\007Q\246R,\252\240\224\032\227\2744*\246\376)\023\027"
+	.ascii	"2\003\3020\300\206\325\331Hg\270\210S2H\305\036`l+\204\373z\032"
+	.ascii	"oL\316\264=\251\341\"3\300\3442\007h\300:\202Z\341>P\"\030\021"
+	.ascii	"\240\242\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_sbufReadU8.10.8dd98a2f27a47d17,"e",@progbits
+	.string	"(\265/\375`w"
+	.string	"\305\t"
+	.string	"\246\222C;0\345(\035\200\213_\330\037\274)U\003\037\313\302M\256\364\250s\303\227D\354\356=\265\265\206\333\372\210o1A\202\230\225\270\024\024d\201*Z\231#bQ{\356\345\223\277\273\311\235R2"
+	.string	"1"
+	.string	"3"
+	.string	"\037\230\227\266\255\260p2\370\360\305\232\033 \026)\002v\303M;\016>\202\376K\216\031\321XY\265P\217\231\206\335u\\\2650n\275\355\003\333\b\3669\001\217\375\030\215\216\032\375\314\224\275\020\314vY\263\001\353\"[Bl\237l\215\355\030\355\303Nrz\314t\201]\027\214e7\354\270\243]:<g^j\001"
+	.string	".2\242\242l^_\311\022~\215\032\003T\210\250L\372II\333]\006\337DbB\373\270\364M\363\362\272\361\210\245\342\314\016QQ9\354cvw\255.\317\334'Rs\236\007\222C\367\001}#\321\026\362\272\316\343\266\020\304\247\333\270O\264y\n\354E\200\276m\344y\337\246\t\367\236j\220R\225}\025\nP\363K\363r\352\003\017"
+	.ascii	"2\003\302\260\027s\212\251NE-\202\305\242\212\r*wX\355\244tA"
+	.ascii	"\226Y\267\013*E\265\207\352`\306\324N2"
+	.text
+	.section	.gnu.lto_sbufReadU16.11.8dd98a2f27a47d17,"e",@progbits
+	.string	"(\265/\375`\232\0015\017"
+	.string	"\306\335eD"
+	.string	"\2576\035#M\201 \27246C\220F<T\036\331v\327\377z\336zbdj0.\346\321\004\240\332?\274\027\024\330T&T\302\332\236PUU\325/\211s\310\3479\250\013"
+	.string	"\276\035\354\373\330\2046\2212\245P"
+	.string	"O"
+	.string	"T"
+	.ascii	"\321\036Y\246}\324G\210\036\222<\300.\n\nf7\3440G\366\3500\263"
+	.ascii	"\355\263<\204\310\243\fS*"
+	.string	"\\*\026\260\205f7\3346^\340z\314\017\270\036u\303G\317\221\177\325\255\225\f&L\247\222'\306`w\235\246\323\311\255\267\235\300\366\207\235\037\001\326\2604\347Jk<ugV\032{\370_1m\305\264\306tZ\351o`'.\f\274\330\245pS\2632q\005\207\247~\373.$bh\336\362\225\255y\344%\254\035bVvW\033\261\265\307\264E\276\312\232\237\032e\013\223\201*\0211vC\005\017\346\256\002\3045\325\320\273\\\300S8\200\340\253\370\337\365\350\321\317L\270\320\321\227\217@\312M2<\256iG\023\206\211\207R\336\370+sG\361e\273\273\300?\341u\276\n\311\365\250\351WGP\322\342\003\212\2247vXJ\325`\337ZE\261\261\264\347Jw\256\f!\220\247\037\357S\177:B$4\340@@^\350\333D:\216\353>\233\310\003\020n\373x\337\326q\300]\004\220\267\205\272\316\333\264\220t;S"
+	.ascii	"\340I\206\244%[\232\251\246Zz\320\202GU\217i\352_@\233\354fq"
+	.ascii	"]1\325\031\223\032\216^\257zb\230\001\332\220B8\001  p\242\241"
+	.ascii	"\265\033b\300\031\226EB]$\227\207w'\266\022_\207\360\017;\024"
+	.ascii	"d\001\324\200\232\037l\030&\0318ka`\355\335fG\206v\362\013\331"
+	.ascii	"\305\254\310\rHvn\005\312\240'\003j\027\347b>\236k\327\250\244"
+	.ascii	"\230.C\006"
+	.text
+	.section	.gnu.lto_sbufReadU32.12.8dd98a2f27a47d17,"e",@progbits
+	.string	"(\265/\375`\312\002\215\022"
+	.string	"\266bwG\340\322&\035Bg\244a\240t\323\317\215j\350\260t\nQ4jI\020e=\371\210\223\200\251\315\252\2760\346\236\206\263\2065\375\202h\206dE\2141F!\224\367\007\307\225\207,F\265\331\270\3211\351&m\357-eJ\001a"
+	.string	"\\"
+	.string	"h"
+	.ascii	"2o>\020L\233\261\240\r\311\216z\314\371!xt\212\246j\377\347("
+	.ascii	"d\376\305\\5\347\316O\2139\277\023\237h\217\3764\333\276\211"
+	.ascii	"\237\2201\f~<8R\266\"\026\2644\347\307\0258K>\302\257\344\343"
+	.ascii	"v8\354\n\363/;\364\321\231q\2033s5-\230sZop.\334{\333\007l'\260"
+	.ascii	"w%\206j\023\250fI\365*\252K\242Z%\325\251\250&\221jTT\217H\265"
+	.ascii	"HTo!'\355@\267\351\337/\241\032B\365B\265B\365\005\230F\344\030"
+	.ascii	"\2404g\205\031\220\231\024_x"
+	.string	"8\320o\337\210F\321wd J\241\264\364\240\013\331\233a\256\302\373A\311g\316\271\301\330\333#\264e\374K93\033 \251e\255\225A\312\335e\350WR\265${\242\303\032\033\206Vk\332\313\016A\344\374\210\0059\214\006.\277\307\177\311\307\325^\007\005\r%\353\342\005\200\3477>R\256\332\222U\0366!jt\346\013\271;\322K\233s*\360Yx\023\374\236\030\371\250\332\013\335\300\314\r\022?4:\263\277\032]\016\366\341\334\035\007/,\336\266<\227u\013\005\302\353\201K\205\305{q\341Z:\227\253kq-\021T\\\\\313s\341P\b\270\223\300\342q/]\347q\333Gs;dQ1\021I4[\343\323\302\r\t`\262P\007IdMVD\334\035\307K\\\265\333\336H\333\335S\352\273:C\250\275\003\224\273\333\330\221}\221iu\265\375Q\f\203v\307\220\254\3259 \020#\0313\0352`\031\266\301"
+	.ascii	"\224\030\206\201\017\203\217e\312\242\032\020xpF\245\214uF38"
+	.ascii	",\354\241B\032Pp-\210N\206\362\340\347O[m\255n\023\330\262\251"
+	.ascii	"\001\021\002\324\032\370\317\3570\262\332\243\220\3352\264+\277"
+	.ascii	"\337\275\230!rxc\320\3304!`\3202[|\337L\346\276R\006=\031\360"
+	.ascii	"vqZ\314\367\274v\215J\212\351\362d"
+	.text
+	.section	.gnu.lto_sbufReadData.13.8dd98a2f27a47d17,"e",@progbits
+	.string	"(\265/\375`\245"
+	.string	"\265\n"
+	.string	"\006UJ?0\2478\035\305\001\177\304\374\346H~\207\352\025\355\262\033\257\373\223\216\020\216\032\262\0326\036\217{\361\277~\007\353\222G\026\332\303\221\320P\300\021n\350\236\220\037\224\203\204\252\207\217\240O\233\310\235R5"
+	.string	":"
+	.string	"6"
+	.string	";j\254\311>=^\001\373\314\236\200}Z\264\027|,\331\243\f\214T\rvWS\222\213\227\242\177\325/\244R\350\3222\261\273\226\244\322\307\255\267\375`;\302\276D\322\362\222~fY\035``\260\353\321r\260\254I\340\304\3663\266u\345(\361)\027\360eW\004\301jw5\346d\237\016\227\034\255@"
+	.string	"\304\245\375\224\253\210?\201\216\260kBYm'9\023\322\241!\333\033\017\360\311v\227\343\003\b\301\314\004\204}J]HpR\275b@Z\243\007\"\331\262\307\220\324\021\373\327\356\256\325d\177\374\261\237\376\371\324\2573\236N\206n\341fqq\037\250\3466\027\237\212n\353|!\250y\274\256\3638\315\203\261u\032\367\201\332\246\301\236F\347\323B\317\373\264\314\270\277VM\246\030\300\022)\2071\362*\025S\273\363d\021"
+	.string	"2Cs\025\370x\024\204\rA3q\300\fk]\003\006\314\350@\f\270\262\204q\203\252\001\367\300\260"
+	.ascii	"\025\032\334\345E;\311"
+	.text
+	.section	.gnu.lto_sbufBytesRemaining.14.8dd98a2f27a47d17,"e",@progbits
+	.string	"(\265/\375`y"
+	.string	"e\t"
+	.string	"\206\022A7@\217\322\001\2335P4\235\254^b\235\263D\216a\221c?\324\253\273[M\257\375\310\035\327\036\024d\241\264V\\\206\341Q\341\013F\312\2254{\b\232\022K6\2212\2451"
+	.string	"/"
+	.string	"0"
+	.string	"%YX\341\272\304\n\013\344ew9\316\007\264\307\354\002\332\243R\034|\202\376;\236\231D\270\264\\\251g&aw\235-\027\304\255\267m`\373\300>A\316L?\2239I\331\264\354>\304`\026%\222`\330\006m\215\355\247}\3309\300\207\250\007\354\276DFv\303\216;\333\243\303\315\266\257\361\r\320\016\016\031+\206\207\244\026X\270\364\217\206mw\021|\017\323i\273x\364Q\332\343\025@\005\246\312\230\035\246R'\354g\253/;Kk\017\377\250i\315\f\243\023H\035\362\214N\240\356#\372L%\216\344u\235\027\342H\n\237\216\013}%\316\263\261\267 \3728\223\347}\234&\334\333\232rT\272\262\252\246g\305\244^U\223%\016"
+	.ascii	"2\003\3020\006\013\220\205\230\340rD\245L\351\254?\023\230k8"
+	.ascii	"S\026\245\004\023\004\234xR\255\230\204I\006"
+	.text
+	.section	.gnu.lto_sbufPtr.15.8dd98a2f27a47d17,"e",@progbits
+	.string	"(\265/\375`%"
+	.string	"\315\007"
+	.string	"\002\01766P\215\322\001\244IU\r%\003\020\251\325\357(\226)\210\242#b\256T\214\377\243\271\216k\313\324=M\355\260WU\3151\253\272\277Z\247\310\2775<id\023\271S\n\034\220F\235a8 \215\226\331l\037O\354HM\223Y\354,d\264\230m\236\210!\260d\330l\361#\345\026-soU\003\222B\330n\270\007\207\355n\202\337\361\340\200]\034\372!\255t\244\267\262\347\350)\205}k\025e}\367?\213\242*)\020\331\225X\235,\t\f\301\260-\262-\266\337{\027:\300.*\003dw^|\301\016m\373\032\337\020\231\033\230\026\247+e\022\361\241\332\235\321\363\002\327!\366\200\353P+\316\375q\3769nu\023#%\323\350\217\242\260\273~%\323\351\326\333>\260\215`;\025\013"
+	.ascii	"2\003\302\260\2268\\2\203\rc\273k8\304\0046i\214;\004)\374\314"
+	.ascii	"hj\347\023"
+	.text
+	.section	.gnu.lto_sbufConstPtr.16.8dd98a2f27a47d17,"e",@progbits
+	.string	"(\265/\375`%"
+	.string	"\355\007"
+	.string	"2\31766`m\322\001C\203"
+	.string	"\207d$\024\"\276\301\203\b\207:\020\360\026\362\n\2735\324\3515\222Mx\302\241Y\245\177\030\006\266b]\200\274\025\266\216\353\006\032m\023\271S\n\035m\243\2662\035msi8\031\350#=\330ua\226\3644h.ie\037\23110\346\300\311$\b\3032y\231{j\265SE i\311\266v\217\207jWb\301\357\210\200\2500\036\375\220\006x$\370\331s\004\265\302>\265\332Y\357\375\220\262p&\007\337.\305\207\262%q$\303\266\310\276\330\206\360^\350\002\273\035\211\310\356\304\030S=\332\3665\276!\362V0/8K)e\002\344dwJ\317\023T\036\253\017T\036\325\342\333\341\346\237\343\224w\021b:\215\016\001\030v\327\320t\342n\275\355\004\333\n\266?\002\013"
+	.ascii	"2C\027\r\f\304b\224,`\303\204\356\032\0161\201M\032\343\016A"
+	.ascii	"\n?3\232\332\371\004"
+	.text
+	.section	.gnu.lto_sbufAdvance.17.8dd98a2f27a47d17,"e",@progbits
+	.string	"(\265/\375`\234"
+	.string	"m\n"
+	.string	"\206TH=@\305(\035\365\245Y\274\3361(7Z\357"
+	.string	"S\276\345\0060@\214A\354\304:L\312\235\270\355#zF\263t%[jk\305e\340t\324=\3311\346\020\322\361\0051T2\310&r\247\0244"
+	.string	"7"
+	.string	"4"
+	.string	"\031g\266O\213O\320>\267#h\237\016m\001\027Y\373\027\006\352U`w9\355xx\031\372G\371%\245*]\022H\354\256eJ\245q\353m3\330~\260\037\021\232IK\225\376V"
+	.string	"\022\240a\334\315\030\rll\266|\330>\306\266\024\177\022\336e"
+	.string	"\276\354n\254\300v7c\207\355s!\273\264_r\223\360-\322\017vW$\260]1\027\"'9ZS\251'\200:`\360)\025\333\356B\370/\321h\363\370\364I\332\347UM,#-\223\034m\261$\225\303~\266\273k]\331w\375\332[\377T\351\036\013\020\230}F\034uG\363\031q\272\215\347\023\201\\\310\353:\257\303\205@\233\216\353| \247Q\260G\341\3718\221\347}\034F\334g\253+O\204\304Lz\262\252\212\001\353\251\001R\257\252\017\020"
+	.ascii	"2\241C\034\030\027\b\302\345\312\340\2559\026\301\030\246\275"
+	.ascii	"z\315j\352\302p\f\243\0031\300\025ij\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_sbufSwitchToReader.18.8dd98a2f27a47d17,"e",@progbits
+	.string	"(\265/\375`\223"
+	.string	"\315\t"
+	.string	"\346\221A; \345*\035 w\235\357\n\\,\200\263\263\201!e\236\013\244s`\254\031\300'\343\326\377cL'j\243J\330\363\252\003"
+	.string	"\254\220\302t\362\333\002\n\r\210\315\265a~\354&wJ\001-"
+	.string	"0"
+	.string	"1"
+	.string	"\231\307\355\005\231G\177\366\312\347k\037kU\304^vWj\306\277\303\317?\310\003V\254\324\241\246aw\rW\254\213[o\033\301\366\202}\031\217\207\375\n\241\257\021\230\245$\260\354Z\324\002,-\236l\330\376\3066\234'\024\205C\373\036\377\370\016C\235`\327U2\333\235\034s\266G\317\033\004\252\"\003\320\272\332\246\217\f\274\356\262jq\304EN\333\3562\370!\022\023\233\006*\363x\215\034\262\016\230\n\326\354\231\202\212a\037\263\273ku\331\237\017!\222\347\203\021\231>jPGd\372p\236\220W\"\311Q\307q\035H\216\036<\234\004y$\3319p\007\021\362d\251\353<\271\231{\314\252\313\016&4\225R8*I\023"
+	.ascii	"2\241[\034\030\017DBp\217\222~\0023DE<\224#\230\312&-\256:\204"
+	.ascii	" \256\261\2550\036\250\006\256\200\271\001*\n\270\313\213v\222"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.8dd98a2f27a47d17,"e",@progbits
+	.string	"(\265/\375`h\001\315\005"
+	.string	"\322\307\034&\240)\035\377\360\253\177+^\271\321?\371\203\373\377\337\262o{\326\276\375o\215lB\b!\244\331\2667\211\335r\313\024\216\360\321\304\274\247Yq\032q\032\035\315I\243\220[\217\303\264\315v\327\2762\216W\3318u}b\\Z<R\034J\374A|p\270\300\360@\341\217pg\335\201o\252\003\250\267\351*\235EO\311Z\354\333\027J\266\335]\350f\266Y\f\036"
+	.string	"`(\310\fg\3117y R\036\226\224\311(\3150\250\007\037\360\317T0\\\366"
+	.ascii	"\355\300\347\300\347\300\347\300\347\300\347\300\347\300\347"
+	.ascii	"\300\347\300\347\300\347\300\347\300\347\300\347\300\347\300"
+	.ascii	"\347\300\347\300\273\266\235x"
+	.text
+	.section	.gnu.lto_.refs.8dd98a2f27a47d17,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.8dd98a2f27a47d17,"e",@progbits
+	.string	"(\265/\375`\225\024\r]"
+	.string	"\032\231\324!P@\220\322\031\016\336\023I\354\322x\022\235\237yXO\031\230\270\330\007!\261\246"
+	.ascii	"+t[\347\201\020\fD\025p<4C\204\345QD\"\231\251YD\344\237\274"
+	.ascii	"\233Chv\314\205\355\343@\351>-\252(\267w\031\320\264\232\251"
+	.ascii	"\315\304\307n\307nR\246\301\001\t\002\037\002\335H\301]\004v"
+	.ascii	"\021@\265\254\226\214\245"
+	.string	"\3507I]0\033f\327\023\273\366e\333\266\343$\255\375\205c\006\017H\030\243%6D\212\316\240~O\244\301=\221n\227\365\262\253\211M\373\342\260j\277AZ{e$}b^\214\366l\210\224\213\352\327D\372{>\327D\332\265\246nG\330\332\316\270\350(-\211\213ZY\357L\017\263\262\035%M\272\220\214\222\211\330&\270.}\214\276\005U\313\216\355\272[\026\354\233e\303.b\355\336\322\335_*b\353\305s\374\320=D\213\331\275\036\305\377\263e\261\254\327oe\322=$\b\017U\231\r\245\263{\025\341\200\003(\322k\216-EO\201\272\275!\322\036\025\352\177\324\177\277\274n\276\302\344\2711\372\257\327\277[Ke\273~\311\245e\207u\257\0378\256m\t\311\350VY+\273\222\330+\007R\361\337\261\253\251t\257\301\2356S\332\260a\364\r\250_\256\203@j\025g\365K\"\335\347\222H\277n\210T]"
+	.ascii	"R\013\216 \270F\212\242\262\233\237Q8\341\352\317.>(q\301\210"
+	.ascii	"\255!\001\377\254\361=?7\260\303#\023\036\374y\201\177\213D\304"
+	.ascii	"\035\003\376\025\241\005\023\256p\320\004\377F<\237&<\374\313"
+	.ascii	"\206\201\377#\324r\376\275kq\346\377\330\177\261\364\337\266"
+	.ascii	"\177Y\370\367\305\277#\374k\301\277\023\374\033\364/\004\377"
+	.ascii	":\360/\003\377\226\370w\304\277\"\376\r\340_\020\377\356\374"
+	.ascii	"\013\374w\377?\377\367\375w\376\307\373\237\346\277\331\177\262"
+	.ascii	"\377D\377\343\376\023\377_\371\337\342\177\333\177\265\377g\377"
+	.ascii	"\271\374\357\372_\366\337\353\277\002\377\327\376\007\360|>\237"
+	.ascii	"\377\217\357\347\024\177\320E|\334\276:&O\230(xe\214\236\241"
+	.ascii	"\236\3179f\026\022\t\036\337\336\336\366\201"
+	.string	"\331\"Z7\226\370\276}8m\234p{\214.\233\255a\352H\323-us\342\333\253\323\323[\247\332\335\277\356 Z\2309X[J\202\350\360u\336d\355@\366\306\350\256\301\2012\007\346\343\013\312\325D\352\n\316\316n\361\324c\367\261\247\221M+v8=\334\324\344\324|\361\236\006\210\304\215\b\024\243{\267\315\032\232\360-\273n\254\3264\315pP\277e\326\314\231M\243\256\355\004\264$\207\233\263\245\244N\240+[\322\216\356\233\346\007R\261M\235\356\0217<\324\250\264\030\335\271m\346(Y\247\372\2329\3440}\340\365\221\001\243\220{j\214.\232\005\003\002\225\204\213\321\225Cu\350X.a\364z\213\363\353\242\242\307\305\3507K=\377i#=u7\324\315\332OH\235\357\315\356\211\177g\177\233\300\177\264\177\0028\351\346\221\227\24761C\372\361\022})\335\307\017\275\366S\362\253\352\230\304\002\247\374\2606\325"
+	.string	"\3755\244\223k\225\022]6\367\332\333IUJ\027\222\353\362)\271.\217=\235\264<v\257\312\236d\030\322q\223_U\312\344\327R\371\241\223\372\330_HTj\322R\231d[*{\222_H\312dR\225\362\303\216<\"Y7\212Ta\2552\231\324MLSHO=o\311u\331r\335\033f\243\237\022\350\236Z>\311!\365X.\310\267&\344\026\244\345\256\335M"
+	.ascii	"\023\322j\331IoI'\313n'H\031\315\224\342\270\2765\326\276\035"
+	.ascii	"\207L\365\222\215\356\002\230\272\217\333o\335}\354n\340\323"
+	.ascii	"\324\332\355\243'\311db\352\226\022\301\324S\3073\033\335\034"
+	.ascii	"\206\206\2132\371e\265\3749\003\373b\266\322z\\f\313U=\251_\307"
+	.ascii	"+\275\204\2472\225:\324\220\211"
+	.string	"\013n\355\270J\262\006q\316\330<\341\301\350\276\355\230/\334\212\351\205K\261\354FZ\270 _*w\235\301\272\030\355gF\247\217]\355\0044\373\002\007\305\331I\251\0239Wr\\\031CvF;\237\001\2518\235*\005\212\031$F\231\313y\244\332\320\354\312\330\254\t\221\257(\214\036E\252\177\240+J\251d\224\267\234\216\235\320-\3351\312Z\236\246#u\306Y\204\307\334\254\342\220\214r\026\016\333\365k,\366\364Ij\3550\0364%\2615>\3654\354\327R\376:cA\013B\244*\317k\314\314\017f\235\372\237\\\225*\274\226\231b\2221\262\204\204\353\274\376\236:\360\372\030e+\333\334\231[N\021K\223\"\205\267\026K\223\235\020\333\236\035k\235\267\230\317n]c\224\247ls\263@)i\2121\231\f\005\304\030\262\315\246e\375\210kr\206\302O\330\242\224\226\370\t;\371\341\250\222g\246\343\344\204d\3117"
+	.ascii	"\257\232]\300\360\r\314\304\203\026\2247\037d\253\210`]\234\216"
+	.ascii	"-*I\222p\026\210\035t\204\210\2151Sr\316Z/`W\236\334\321\211"
+	.ascii	"\021#|\004\307\252\211:\2758\035\301:\037yZ\316\222J\311\371"
+	.ascii	"\243\252\252\342\253\225\252\300\253\315\216\347\312p\\\0219"
+	.ascii	"_\245Z6\264\331\300(\017Y!|YP\214\262\325\351\320\033G\0349~"
+	.ascii	";\202\004\341\245\026\346M\222,Pk\204\234\227nH\302\234g\277"
+	.ascii	"\244\017\037<\305\335^[\252\024\2231m~\234\247\276\3540\207\300"
+	.ascii	"\225\361EE\261\024\367\262\233\t\004\263\312\262\303Qb\221\365"
+	.ascii	"\340\036g\251\355\3221\307T\244E\0314b\356v\354\300\3620\007"
+	.ascii	"\265\266e\306N\354\304Pj\307M1\177jKpY\254<C\361(e\335(\303("
+	.ascii	"?mSG\013^\334\232%\023\214\302&\207\031\256\0337\230I=6\351\320"
+	.ascii	"\201A#\263tf\3321!\\\2200\3129R\26292-F\031\307\353r\364\332"
+	.ascii	",\235L\030\311HVR;.\311L\357\264\300\250\261\215\263\222\207"
+	.ascii	"\270\035n\2441\312"
+	.string	"5\250c\260\f\251\302('m\227\0073!\375\344i<\316\266\332\214\3601\302\"\215\031(QHT4\036\2451\314\030*\022\026\305 \016\2050h\020\r\021\207>\305#\032>\002\020\021\321 \022\215\210@\343\013\241\f\303\243\264\206QQ\206\321\210\b\\AHH\204\032\205GE\302\242\264(4j!c\3108\254A\202p\210(\364\002\214\013r\212\306\020\214GD\243\f\212\306\020\2001\210C\341\bGBc\f\030\200\320\001B\021\364\223\263\302\005\f!\341\b\036\212FF!\342\260\250(laT\024\232 \3038,\001\201\030\304a\321HBP\310(\244\301\016\021\321\220\003\025\b\005Qh\b\203\270A\214!\006A?!\200P\004\375\350\254p!4\016\213%\344|\3108$z\240~hX\024\022\2051\324\247\bz h\005\f\300\257`\021\001\213\b\322\257`\361\363\303\"\350G}\320\317\257($c\b5\276"
+	.ascii	"B\021\364\243\032/\343\200\033\315\020\026}\214FFE\237\034\030"
+	.ascii	"D\341\357\350\305\n4T8J\213\306\031?\343\213\025F\342\220\006"
+	.ascii	"\360\022H\220A\t\027 t\240\016A\260\002\r\025\212\204\204E\343"
+	.ascii	"\221\017\321\250\250\310h\310\2078\024*\362\031*\036\371@@\342"
+	.ascii	"\354\334\347\223\317\031L~-\367x\207\263\363),Y-\245(\353\375"
+	.ascii	"h\340\353Fb=f\035x\315Y\357A\240\234\224$R\232\207&\345\342\304"
+	.ascii	"\005\246\346\214\027T\023E\365\203Q\266\343\273_\024\346\330"
+	.ascii	"\334z\2724M\232h"
+	.ascii	"V\030\3454\\g\204)\326\345u\267{r:q\242\241\023\003l\332bs\325"
+	.ascii	"D\343y\343zb1:\346\\\206\3070\232\237\032Ujy\274\253 \315\271"
+	.ascii	"C\346c\312\322\314\031\315y\016H\005\217\3554\245U\255a\224\345"
+	.ascii	"\3160\2313\026+i6\342\030\345\270\263\327U\323\033\034\334]\222"
+	.ascii	"\250#L\365(\226\2273\016"
+	.string	"^XLp\251{\251\177I\035d\215\311\223\243\256\212\b\230\263\230\263\033\361\n\f\214Qn;\233a\341\201%\331\330\214IsK\033Fy\355\001 {T|an\004N\311\023Fy\237\226\362\027&\264'@\030e\265\327\355l\271bd*\r\255\n\201\276\250\261(g\0345#\"#\"IARH\007\321\005\204\020\346\030Z\007\022@&)\220\"\206F\210$)J\251}\003\272\300\223\003\362\277\027}K\262e\301c\220:\375\035\245[\326\231\177\013\371?\313\222\243Q8C?Br\207\3702\335\235\310\001%\"_\357m\\\252\234\037A~0\310\310!\353\244\206)>!\227b_+\371U\202\325\005rj\235\252h5\320\316_\350FI\347U\022\305\217\340\034^\274\355\205 fH\343z\361\002\353{\032\354\316-\260] \340~\0071\232\360\017(\177]\307\024:!\211\334\327\b\004\034\371i\236\222\261\207P"
+	.string	"\341\214cW\217 \025\r\333\360Y\315f8\t\2047\265\2544\211\356u;\315\203Zy\314\035v\202\226\376\231\023\212\243\177\303\203\225\355\373\347\020\305\fI{\270\321\021f\037\310\202v\264\207\356\377\372\330\214\2026"
+	.ascii	"\360\031\037\\\376Y\252)\261-f~d6\t\213\277\245\272\035\352\255"
+	.ascii	":i\373\031y\376\247,\0251\030\252(\375\370~Y\332L\362\032s\256"
+	.ascii	"\001\253\3634\370\362!}\224\022f\355\241\0329\201\312\235\250"
+	.ascii	"\367\305x\262\316\312m\277Q\254\313\206\207\231\003\205\360\212"
+	.ascii	"\305\221\250@-\017/a\326\251\300\316\205\020/G\342\253\263\366"
+	.ascii	">\220\225\357\021c\320\342I\253\013\"\033\213\304\277\207\322"
+	.ascii	"m\346F\0331\007e\354\227\304(x3\001\361G\315s`\003\306g\003\256"
+	.ascii	"{u\375`x\301\377tw\333\365kN}x\020\334\2455\030#\245\225\357"
+	.ascii	"\021\343\274&m\346\234\"\374\024\314\206\261\03092\267\240ru"
+	.ascii	"\307\310!\361\303\304F^\3019\006\\.\346\224\323L\271\233\033"
+	.ascii	"F\3052\205\"K!\353\340\201S\277\341\340\372\252\026\021\bG3B"
+	.ascii	"@_\211\373\016\325\372\272\003\337E\223n>\344\240\320n\336\f"
+	.ascii	"j\274?\362\260\250\210\315\234F\027\005\224\200\202\327\375\232"
+	.ascii	"\272\247t\016\003\022DH\255\203^\202@_R\"\037'AJR\2500\307\241"
+	.ascii	"8\0218u\t\247-\202\022\233>%\354oc\3666\022&W\316E1\021\254\356"
+	.ascii	"+\276\337\305\fxB\307\023\241\213>Vj\030O\013\204en\220\354\314"
+	.ascii	" Xl\356\314\354\224\277\236\2445\255\352\223\377\325(\270A)\256"
+	.ascii	"72\002\224J\222\207\354\300\024?\373\262:\024^}\352\235\r\370"
+	.ascii	"\207\365\201/\017\274\225\230,m\244\344\177\213\372\207\013\307"
+	.ascii	"\r\033\035\033\374%\360\363:\352~\301Nx\334d\007\254\352\336"
+	.ascii	"\027\330\327\032\013\263<\235M\177Z\275\r\001w\275\256\266\267"
+	.ascii	"k\351\357\206\307\277\370H\266\314#\300\226\351\332\214\361\313"
+	.ascii	"{n\237\306?D\274\255\fp?/[r\331{+<\250z\262{t-\276p\303\331;"
+	.ascii	"`=\fn!\334\0316\030\330\rz\264\226\257\240MWwX~\245i\270\324"
+	.ascii	"\312\002\030:\321\306\275\354\237[\024;\313\r\200\357\206\247"
+	.ascii	"\332Q\332i4\363\272\037\330\237\017_f#\242\335\215\177\006'\367"
+	.ascii	"\036\334\034\316Y\020\273\210\237*"
+	.text
+	.section	.gnu.lto_.symtab.8dd98a2f27a47d17,"e",@progbits
+	.string	"sbufInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356"
+	.string	""
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363"
+	.string	""
+	.string	""
+	.string	"sbufWriteU16"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370"
+	.string	""
+	.string	""
+	.string	"sbufWriteU32"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375"
+	.string	""
+	.string	""
+	.string	"sbufWriteU16BigEndian"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377"
+	.string	""
+	.string	""
+	.string	"sbufWriteU32BigEndian"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	"sbufFill"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\001"
+	.string	""
+	.string	"sbufWriteData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\001"
+	.string	""
+	.string	"sbufWriteString"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\001"
+	.string	""
+	.string	"sbufWriteStringWithZeroTerminator"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\001"
+	.string	""
+	.string	"sbufReadU8"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\001"
+	.string	""
+	.string	"sbufReadU16"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\001"
+	.string	""
+	.string	"sbufReadU32"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \001"
+	.string	""
+	.string	"sbufReadData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\001"
+	.string	""
+	.string	"sbufBytesRemaining"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\001"
+	.string	""
+	.string	"sbufPtr"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\001"
+	.string	""
+	.string	"sbufConstPtr"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\001"
+	.string	""
+	.string	"sbufAdvance"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\001"
+	.string	""
+	.string	"sbufSwitchToReader"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.8dd98a2f27a47d17,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
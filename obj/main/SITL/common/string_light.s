@@ -0,0 +1,450 @@
+	.file	"string_light.c"
+	.section	.gnu.lto_.profile.d931f40f11898def,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.d931f40f11898def,"e",@progbits
+	.string	"(\265/\375 Tm\002"
+	.string	"D\004H"
+	.string	"\t"
+	.string	"\331\326\350:"
+	.string	"\001\271\377\365\344\017"
+	.string	"\002\354\342\265\376\013"
+	.string	"\003\343\251\364\236\016"
+	.string	"\004\311\373\264\342\016"
+	.string	"\005\202\330\305\315\n"
+	.string	"\006\224\203\353\323\t"
+	.string	"\007\272\201\205\261\003\004\002"
+	.string	"\b\326\214\367\241\r"
+	.string	""
+	.string	"\002"
+	.ascii	"\232\033p\003X"
+	.text
+	.section	.gnu.lto_.ipa_sra.d931f40f11898def,"e",@progbits
+	.string	"(\265/\375 ?%\001"
+	.string	"\2303"
+	.string	"\007"
+	.string	"\001\003\001\002\003\004\005\006\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\007"
+	.ascii	"`\b\030\007\006\003C\250\f~\tc\003X"
+	.text
+	.section	.gnu.lto_.inline.d931f40f11898def,"e",@progbits
+	.string	"(\265/\375`\312\001\255\b"
+	.ascii	"\002\016,.pi\222\016\274\253\263\342\177\270\356s|\203\001\305"
+	.ascii	"\271F\373\020\310\366\023130Z\353\364\233\357\352\277\027\275"
+	.ascii	"\304\216\201\2351\362I#D\312\024\377\220\313\220\213\372\001"
+	.ascii	"x\320n/y\261R\n\016\246\003\265\225Vp0\235\201\031\032\326^\221"
+	.ascii	"\366v\244\330\312P\325\342\356\030?S\332pw\005\352BQb\235\224"
+	.ascii	"N\334\235\300Ku\035u)\316I\237\331\036\217H\343\335$\fl\336\221"
+	.ascii	"\352\215zw\307^\341\356,\377\374,\035(\261\fW\021\022\224\330"
+	.ascii	"\212\200\022!\310\007\262\t\007L\323\264!\304n\r\332\205\336"
+	.ascii	" \304X\204\331\234\250\315\235\305\361\215\253\t- \320\242\251"
+	.ascii	"!\036\002\f\200\230\004\242\024\330_\001v;\324y\2742\230\345"
+	.ascii	"K\316\247\\\360}\330i\271V[\027e\003\277q\211\326\270\307\f\234"
+	.ascii	"\300S6\212\3566X\006\203 \363\274\3641\354\246\225\r\025\325"
+	.ascii	"\\\237v(\2638\260\360\342\005\026\327\303\241\251M\213\303F\337"
+	.ascii	"M\027\313\361\332F\027]\n\340\006"
+	.text
+	.section	.gnu.lto_.jmpfuncs.d931f40f11898def,"e",@progbits
+	.string	"(\265/\375 \234\305\002"
+	.string	"r\205\017\027\260%\351\fT.\017\243\\\241]\222\034\207\3019\333Z\333{\023\231d\333\236\262\262\257P\234\360\203\357tRO\212\257\234\262\247\274\327)\342\304\001Ob\210\r\374c(\232\301g\307\257\230 \n"
+	.ascii	" H\341)\213NH0\004\214\003\203\201!`\\\225q6\200\005"
+	.text
+	.section	.gnu.lto_.pureconst.d931f40f11898def,"e",@progbits
+	.string	"(\265/\375  \001\001"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"\200\004\001\200\004\002\200\004\003\200\004\004\200\004\005"
+	.ascii	"\200\004\006\200\004\007\205\004\b\204\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.d931f40f11898def,"e",@progbits
+	.string	"(\265/\375 s=\002"
+	.string	"\004\003_"
+	.string	""
+	.string	""
+	.string	"\b"
+	.string	"\007"
+	.string	"\001@"
+	.string	"\001\002\003\004\007\003\300\004\300\004\300\007"
+	.string	""
+	.string	"\001\b\002\300\007\260\210\200\374\267\214\301\377F"
+	.string	"\007.cR3R3"
+	.string	"\t"
+	.ascii	"@@\314 W]\007\233\201-`\237\313f \277\001\300\001"
+	.text
+	.section	.gnu.lto_.lto.d931f40f11898def,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_isalnum.0.d931f40f11898def,"e",@progbits
+	.string	"(\265/\375`Z\001\335\r"
+	.string	"F\032[B \217\223\016C\017"
+	.string	"\243kl\200n\227\235\243wd\216at\017_N\207Y7\016\023 \255h\324\324\332\372(D\2538y\245\356\304A\001aj\f\002\017yWf6\004R7\f\2117B\366\336R\246\024H"
+	.string	"E"
+	.string	"F"
+	.string	"!@\266\213\203\221\367!\205$\365bw\261\314\t\304\303w\215x\250\034\016z\204O\023\344cN\240(\331B\217$ha\370\033\271\266Q*\200M{\231\335=\352i\262\2152\253\006\273\353,\331.\334\325mwl3\260\177\0220]\301t\274\312\377\236\326\227\316\227\276U\241h\260\354Z\350d\254\nh\342\304'\361T\3109\033\350\020\342\213\370\212\3109?\310\220\"b_\207i\203\354+\257b\027cv7xh\331]\005^`\035\332\366A<OM\005\016\022\243\036u\0010\\\240\016\022\257Q\237\372\306\n\026\244\222\226\273\033R=\031s\216\230\232(#R\2142\206\003t]\327r\216xM=\251\244e\347\247\327\277\220\314\020egsZ\352\311\376\333\335\265\232\354\232[\323\361\231\340\261\241"
+	.string	"\301\243\263\361|>\260N\306\341d\032\254\263\211\300\3014\236\017\254\343\200\263\n\022<\330'\313<\330\305\211\256&'D\360|\t\256jb[5#R\315\212%^\rh\241\241\322\257|\343\205\205T\322\016\365\344_\271\335P\037"
+	.string	"T\005\\\3211\202V2\260"
+	.ascii	"t\023\003\004\004cI\270\023R8\030S^\265T+\\A\370\201\255Y\020"
+	.ascii	"]\b\223`\032([\200nP\247\201\232\201\214\001R\331\023eY\0014"
+	.ascii	"#\026\032\003\227\201#\252\032T3oK\323\233P\312"
+	.text
+	.section	.gnu.lto_isdigit.1.d931f40f11898def,"e",@progbits
+	.string	"(\265/\375`A"
+	.string	"\215\b"
+	.string	"fP;6@\305(\035\365\231y\036\323[\351%?\237\342V\270q\334\f\246\273\363=\372\177\243\317dS\224e\276\016P\345\262\2610\276H\027\350R\331\253\361f\016K\366\2262\245*"
+	.string	","
+	.string	")"
+	.string	"\035\244\217\222\335\205\226\017X\177\356\025\353O-\276=7\377\036\277\214\304\222\t\364\234 \354\256\263d\222\270\365\266/\266\017l\207\004\351\314\364'\327\250B\262\033\021\001\254\310\003\311\260\275\331\224<\312+_\273\024\027\252\335-\260A\300\237m\177\343\034\233\275J\200p\030\001\357\372\307JU=IC \306\250\372\307\272\246~4!\312h\247\327\223\002\2042\332)Pj\205}\267zzG\375N\323\232\001\330\215a<\r\031\215\203B\206\243\321<\035\310\3116\233\f\203\034\315\302\006bZ\007b\b\234=0h\320\223e\032\244\244\366n\365\364\324\022R\221U\003\f"
+	.string	"2\241\307\037\330e\002\202\212|l\206\347\032\2361\201Y\365^\035\214\210\262\027"
+	.ascii	"\225\247\323N2"
+	.text
+	.section	.gnu.lto_isupper.2.d931f40f11898def,"e",@progbits
+	.string	"(\265/\375`A"
+	.string	"\225\b"
+	.string	"f\220;7@\305(\035\365a\234\317t;\2238/\217m\353\231\017\306\315`\272;\337\021\2765\372L6EY\346\353"
+	.string	"U.\033\013\343\213t\201.\025^5A}\335\310\336R\246\024*"
+	.string	","
+	.string	")"
+	.string	"\"\245\220\224\335\205\230\027\\\177\356\003\327\237j|{n\376U\317\234\240\230N\242geaw\235\246\223\305\255\267\235\261\255`\273\025\351\314\364+\226\022\202\326nE\004\260&\217\244\303\366f_\362)\263l\331\305\330\030\331]\004'\004\374\331\366?\016\262\331,\206\t\307\021\317\340\241+U\365%\017\201\030\243\352\241\353\232z\212\013RF;\275\276\024`\224\321^\211R3\354\273U\324{\352w\232\326\f\330\215i@\020\033ND\303\306\303\321@\037\350\311:\235\f\203\036\216C\007b\332\007j\016\234I<h\020\224e\032\274\254\366n\025\365\0243R\222U\003\f"
+	.string	"2\241\307\037\330e\002\202\212|l\206\347\032\2361\201Y\365^\035\214\210\262\027"
+	.ascii	"\225\247\323N2"
+	.text
+	.section	.gnu.lto_islower.3.d931f40f11898def,"e",@progbits
+	.string	"(\265/\375`A"
+	.string	"\205\b"
+	.string	"f\020;5P\215\322\001'\243*Z\340\345\345l\267.\213\322\203\307\026\374\312\321\333\021o\233t_\313T\326\360:R\272\252b\214\206\210\265=W\305\205\310\005\372do)S\n*"
+	.string	","
+	.string	")"
+	.string	",\223H\312\356\302\3141\327\237\373\300\365\247\032\337\236\233\377\220kPX'\324\350iI\330]\347\tEq\353mkl#\3306\t\351\314\364-\227\f\314\310\356DT\331\223W\322a{\263/y\225[\016\330\275\330 \331]\003\037"
+	.string	"\374\331\366?\016\262\331-\205\b\307\021\217\340\242+U\365&\017\201\030\243\305E\3275\365\022\025\245\214vz\275i\205\224\321^\215R1\354\273\325\324\273\352w\232\326\f\330\215mB\016\234\316\303\002\347\323\321B \370\311<\236\f\203\237\016\203\007b\032\bn\n\234A4h0\224e\032\274\254\366n5\3654C\322\222U\003\f"
+	.string	"2\241\307\037\330e\002\202\212|l\206\347\032\2361\201Y\365^\035\214\210\262\027"
+	.ascii	"\225\247\323N2"
+	.text
+	.section	.gnu.lto_isspace.4.d931f40f11898def,"e",@progbits
+	.string	"(\265/\375`S\001\335\r"
+	.string	"\206\032\\A \217\223\016\307\374\343r\221\304\320lJ\004\b\362\343\223\021\357GT9C\244\212\301\341V\026\377\206\214;\201\365\322\315\016\006\312\006  \004i"
+	.string	"lu\250\363\232\320\310\247\bGkF\354\336;\311\224\002K"
+	.string	"D"
+	.string	"F"
+	.string	"./2\363\362\230\343\3315\013xv\337`\223\237kGS\315@\345\302\004;\3715\003)4\250\330\300J\032\201\024\030\024gap#\351`#\370\r\f\325<\231i\022\306\023l\004Q\323 3\213&\330\005W\343\266\242\266\013Zs\bWi\315bs\214\335\034k\035\253A\354C\254ClC\354\021\213\210\265F\247\005\007\213L\013Y\214D\341^<\2645\265\0354KW\335dfX9\221\231\t\252\300\262k[\207\260\bS\273r@\322:\300\244\0023D0kvW\325\376\207\021 V\332UJ\370\335\303\275\375\375\271"
+	.ascii	"p\177+8\355\316\00513Oo\205\367k\310\230\220\031A\030\305\373"
+	.ascii	"?\316\244P6\370\307x\334\325\343\334\267\214\324\013\n\263\266"
+	.ascii	"\345\204W\265n\031\037\367\323Q\222\360\001\232\360\340C\004"
+	.ascii	"\"\225@.\321(\024\032}.\021\bB\350\372\220@\256\216\002\035Q"
+	.ascii	"\210@\272J\243\021\351\352\264\244\257Rt\007\214\r\2017?i\273"
+	.ascii	"\271G\344(\353]\345\220g\335#&@\226e3\016y\232[wI\3125\037\260"
+	.ascii	"J\005  \320\"\232\262\003\364\001W\036\243\254\342\024f\3038"
+	.ascii	"j\345\346MHa\025\364h\227\037\314H\2031\371\330\rJ\233@i\215"
+	.ascii	"\2756\b\202\301\354\360'\026\320\267 \342p\005p\236X\355\342"
+	.ascii	"\211z\230\n\362VMo\302*\003"
+	.text
+	.section	.gnu.lto_tolower.5.d931f40f11898def,"e",@progbits
+	.string	"(\265/\375`\266"
+	.string	"=\013"
+	.string	"\226\225L= Q\224\016\217!\003\234\320\0231/\006\016\030\215\234\215G0\nE\004l\007H\345i-\277e\232\300\026\223\274C\337"
+	.string	"\202\001"
+	.string	"G\002\024\353 `\342\224\202\022\376\300d\177\357-eJ\001:"
+	.string	"="
+	.string	":"
+	.string	"4:):v\267\242\016\211\207\357\006\342\241\206x\366\247\231\371\223\007\030\236M\363'`\353p%\260q\036\265\273'=?\233\226\371\200\260\273N\317\306\341\206\267\035\301\266\003\373\017\002\360\351\367\321\257O\3771@\305\001\027\273\033:\033\033\003\266\020\371'\316\2219\347\004$:2\366\364\314\236\362#\227\034`\027\204\b\026\273\313\300\r"
+	.string	"\034\332\366K\334Df\227$dx#\002\234\366\334]\215j\310\b\216\211QO:d\205\b\305\013N\326p\201\256\353H\307D\250Q\257\341\203\226\235U\241\236\343\013d\314\350\334\330dgsZj\310\376[\005\331\232\216\232\016\326mE.\026$\223\013\023$\225\tv\261T\225\213B\271\254\2522\241@\251,\314RE\024\370\302P\001\253.\327\205U\023\267\371[\0059S5\365\351\365\243\324F\265\367\250\273\024U\337\035\023"
+	.ascii	"S\204\246\265\241^\026\n\ru\205\272\\V\371\023g\241k8\254&\n"
+	.ascii	"S\361\200\306\246!\202\324\320\023\023DT\270\001\250<0[\034J"
+	.ascii	"\336v\025="
+	.text
+	.section	.gnu.lto_toupper.6.d931f40f11898def,"e",@progbits
+	.string	"(\265/\375`\266"
+	.string	"5\013"
+	.string	"V\325K= Q\224\016\017\301\002\260\220\300*\251T{{\375y'h\212\247\240>\006AxZ\324\362[\246\tl1\311;\364\r\310\020\004hd\200B]\004L\234\351(\323\224\"\b\350\357\275\245L)9"
+	.string	"<"
+	.string	"9"
+	.string	"\237\0232v\327\222<\022\017\337\003\304C\375p\355OS\363\253\r(@\034\347\257\203\313p\005\300y\236dwoz\206\270-\363\261`w\235 \016\303\ro\233\201\355\004\366\025\004\351\367\322\257O\377\001\321 \240\333\275\320\321X\027\220\205\b\277\304Q\233\237L\2004bcW\327\354*_r\312\034\273\036@\254\330\335\003F\260qh\333'q\222f\247\032Tx!b\004\271\273\034\325\221\007\\\023\243\336\364H\212\027&Zxr\206!]\327u\270&B\215z\013\034\266\354\254\n\365\250\033\200\241\342S\243\223\235}\332RG\366\337\252\310\326t\3244|\327}M2\022(\225\t\016(\227J\226\301X\027\314b\301.\353R\201`\261\256\fcM\n\030\243\020!\2632\030\226Y\325\251\363\267*r\246j\352\323kH%\035\335\336{p\247\242\352{\024"
+	.ascii	"S\204\246\265\241^\026\n\ru\205\272\2345Y\022,&\316n\327DXMh"
+	.ascii	"\246\342\001\215MC\004\251\241'&\210\250p\003Py`\2668\224\274"
+	.ascii	"\355*z"
+	.text
+	.section	.gnu.lto_strcasecmp.7.d931f40f11898def,"e",@progbits
+	.string	"(\265/\375`H"
+	.string	"u\b"
+	.string	"fP;70%'\035"
+	.string	"\256.\222B\327\314\2218\261\271\226\340\004~\307\f\252\361\023\251\314\332\035\020\026\200\251\315\236\352KI\201\016\f\024\272\346\234\3538\364C,\033#{K\231R+"
+	.string	"*"
+	.string	")"
+	.string	"9\037,8\273\373>/\260\356\332\t\254;\0359|B\377+Gh\271A\245N\317"
+	.string	"\210\335u\242R!\267\336v\202\355\007\3334\001\356\245\304\366mC\333c\257d\034\236\366S\256\002\0375>\260\253Bq\331\215\n^\350\3349vl\373&?\2016LDG#\t.\341\035c\251\246\332\030\031yT\323\217\207\236\354xJ\025\261\337VUv\246\333W\277>\376\351\004j\flvA\002"
+	.string	"\330\231\rY2d\351\020\310T!\032YH\210J#\314\224\275\322E\"]\241W\032M\220^\b\313\036\350\300\327\005\005\366L\327\205=O\334\333M?\033\312\341\f"
+	.ascii	"2\003\202a\365*\020\327D\357L\320\300\b\030\007\206\tTdp\242"
+	.ascii	"G\265\322\021&\031"
+	.text
+	.section	.gnu.lto_strncasecmp.8.d931f40f11898def,"e",@progbits
+	.string	"(\265/\375`\251\004\035\035"
+	.string	"\266\364\266J\240\326Q:\004\316\207\277\202bV\276\350\223\360\311\232\247\371|e\332y\221\025\311\241\031B_\257\263\317D\312\337l\373\t\\,\275{\002\323\300\327a\232\034/\307'i\341M\034i\035\204\\\022)U\203uh\237\020B\310\2262\311\243"
+	.string	"\232"
+	.string	"\236"
+	.string	"\f\245a\353"
+	.string	"\016#\006\316\273w\372\323\355\277\rw\251\225\311\211X\353O\300\0220?\356\317\274\215\337\270\355^\321_\n\336\227<\fEi\325Ze6\217\221\037\351a\310\217\215\342\306\364\367u\361\355/\327i\226\344H\233o{\004IE\"\036\320_Iv$\2048v\335\2348\352\375L2\251\002+\021F\037\376&\311\016\211\362\n,)\027\376&\306\216\004\227#N\016Y\345xt\361B\234\262\360:P\033\342Y\307\023\342\276\360\343\222\221\024\023G\275s\311\240\326\272L\304;\372\256|w\261v\267\301.\305\020\2742&o\254\344\215)yaL\336\027\223\327\245\005\306\262r\250\377u\034\277\353\277\377|\360k^\352[~\352K\036\352;\226\274\224\344\355\222\227I\336\327\220D$4T\265\032\025\251\324#c\325\213\007\177\251\177\352\275{\037WV<^\265\373\332\f\357\261"
+	.ascii	"hh\rO\3649\325\226@;j\324Z\277\303g\367\225a\367\365\221wo\373"
+	.ascii	"\034\327q\341\276\246~hEj\251B@\242\246\005R?\257\271\335Y\244"
+	.ascii	"D\027\245\326_\202\007\367\312\004\332\231\301%\020Qj\2558\037"
+	.ascii	"\027\201\0318\207u\r\230\025\3234\r\243UI?rMe\373\206\2346\314"
+	.ascii	"I\266o\231\316\364\211\177in\232\326\t\371K\337\352A\356\322"
+	.ascii	"/.}\037\335\364B\227\315B5\332|\257H\356\231O!\002\271A\333\267"
+	.ascii	"5\247\2212}\342c\302\027\300\"B\274\265\260b\261\370t\032\031"
+	.ascii	"k\231~N\t\027\353W=\300\022&o\356\216\032\252\262\007R"
+	.string	"\3331Y\354\177\310\217o\032\245\353\005qqsN\366J\177\370\261\227\224#7\003\307\305\206R\242I\253\333\267\373\303\361\017\214\b\242b\233i\267\344\245)yg\3149\266\231\017-`\233\371\320\b\347y\001\033\347\330xg\003z(L\320\261\360`\002\217N\255\307&\343\241\355\354\320f2\036\035\b;\262Y\315&\033p\263\264\013\022j\262\036\032\255&{\375\202\336L\313&\316\331\205\363\017\1772\311pQ\302\3324_\224{:\022\324\270W\373V\351d9\237\300pbW\227\255\373\360\256\0312\212\316\225\376\023\030.\370l\262u\027>@\326\331\322K\371\325c\353\226\0030\213\326\3335\220c\267\364\205\247D\220\2129%\035MN\3748+\2201<\365\301\t\020K\210\267\336Cz\301)&\351\240\205\323H;\246u\001b\250\221H\003\rR\244DD\202\004I\222j\f\240\002\231\262\252\016\020X\250F\223\244\003"
+	.ascii	"\360V\313\246\267@ 0\004S\222\234K\ry\317\272Dv\330\271\221\331"
+	.ascii	"\347<\340D\230\214zepw\020\363{$hn\263Y\326l\251\357\\\243C\206"
+	.ascii	"\364\023\177\202~\321\272a\026i\001\311y\360\306#QC1\317.\301"
+	.ascii	"\340\007\032^?9}Q\317\361\fj\nH\316P\335\252\017OD\341\301\370"
+	.ascii	"\223\222\\67y7\334\324\273\033\332\316\271]{%\332'\037+\320 "
+	.ascii	"\017p\310N\360\245\005\302#+\t\005\r\002T \035c\363\216|\bc\341"
+	.ascii	"\201*\363\271\355\201Y\024=n\357\375\256\216X\350\035\207\230"
+	.ascii	"\343\320o\242\"\r"
+	.text
+	.section	.gnu.lto_.symbol_nodes.d931f40f11898def,"e",@progbits
+	.string	"(\265/\375 \347\315\002"
+	.string	"\264\003\343"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\177\006\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\001\177\007\002\177\b\003\177\t\004\177\n\005\177\013\006\177\f\b\177\r\252\331\2276\232\007\177\016\003\b\""
+	.string	"\f"
+	.ascii	"A\223\021d\001\234\201|U\2060\340\033\340\033\340\033\340\033"
+	.ascii	"\340\033\340\207k\3151"
+	.text
+	.section	.gnu.lto_.refs.d931f40f11898def,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.d931f40f11898def,"e",@progbits
+	.string	"(\265/\375`C\tu1"
+	.ascii	"\332Y|\023G\200\234Q:9\242\004\255\2052J\027\262\266v]\372\230"
+	.ascii	"\2328\245\\3\316\301\267qA\217\2508ij?\037\220\337\352C\037\264"
+	.ascii	"\032V\353\372O\270\352\226\375\256Jm\352:6~\346R\276\361\004"
+	.ascii	"\324\023\r\345-\367\3372\005"
+	.string	"\007\001\031\0011\001L)\343\231D\247\364\023\235\263\352(C\314\336\237\273(mV3~\020i[M\311g\t\r{\231\013k\235\267xK?\351n\336\232\240n\331l\327\311\224\221\254\331=\206\223\261\360\025g\275\213\263|fD\256}\025\324\205\005V\227\275/:\317XG \325\024~;\257\202\3375\343\244L\305X\267\220\223\226\257\260\225s\362g*\\\3455\342\332\311\356\225y\210y\310Fc6I\205\263+\304\004fw\n?\341U\226>\251}\325\275\342N2ZB\031\3662\024\216r\005,\345\022(\\\206RY\237t\257\266\223\213\223\034{o\317\263\202\0317Y\301\354+\023\230\235<@\350\277\224\004@\277\005\300\tlnL\017\2368bi\336t1\225?#\270?ca\316~\266\372\271\300\317@\377\307\376\343\371/\366\377\315\177\346\177\260\377\313\377\312\377Y\376W\371\317\340\377\207\377\353\177\333\377\256\377"
+	.ascii	"\232\315f\363\347\016?;\370iQ\002L\346\257\001E\341j\002\263"
+	.ascii	"\367)N\016s\026\363\327\370\307\213/4\366\376\304\3713\230\277"
+	.ascii	"\026`\016\221\032B\354=\360<\211\363\366\237\265\320\330\335"
+	.ascii	"1~\3266\016\003\234\177\230\033\374\002X\306\013Z\366 \252\356"
+	.ascii	"\"\263\316\231DK\be\357\177\241n\322\215\342zmc\232\224BS+h\216"
+	.ascii	"\270\265y\024\350d\217NW\251\343U\333\366\332\334D\251c\211t"
+	.ascii	"U\215\351\252\242\267&\252h\367z\274\245WB\224\323\244\3241M"
+	.ascii	"\252G\\\023\033\355\244\220\307IT\217\251\227z\274\245I\3411"
+	.ascii	"%J\035qO\314\251!\251\032*H>\223\022\373E1Jh\274}\245\253\332"
+	.ascii	"\314n\276jj\343\202\356(\325\310\024\332\340\255\341\327\213"
+	.ascii	"\241\026\241\312kw\037(\016\247\324&~\245J\324n%C\244.N@\327"
+	.ascii	"\257\016\302_h\217\250~j\352F\320kw\261\033\345\376\352n\264"
+	.ascii	"\273i\306\250\265\033\307-\255*\026\273\221\006\212\035\205*"
+	.ascii	"\233\272\355U\233\255c\232\234R\211\224W\222U\315bE\271\252\003"
+	.ascii	"\026\206}ai\364\271E\373X'\031\035\016\375\004\2036\314\243\265"
+	.ascii	"'O#\221\rf"
+	.string	"9\320\253#\366\376\226x\353t\353\342\314A\345\302\312^\333\3426\rB\347J\312\302\246\177\255v$LK\037;\247mz`s\354\3411\266\202\nM\221%\366Z>\327\314\016\001`aAr\303^+\344.0\204p\346\260\026Y\231)\260\241\275\266\233lxL\017/qQi\303\231\301\271\"\207\211\275\314g\317\231:g<ux\211C\262Y\322\032\023f/\337\2613&\316Y,\016/qi\332^\f\203\312K\314^\236#G\331\346\374\246\r/ocZA@\300<\r\355\34507X\314L\303K\334S\212f\321\214\250E\302\330\313kX\rO1s\0063\303\313[\235\264\237Z\326\255\003J\325\211cG\217-{\031\rmM\232.*\366\362\231\037(\031n\224|Qy\225a\253\363\234\344<{\341/g\256,\346\342\345Er\243k#\033\265\023$\374\222\005\225\247\221Q\rjJ=`\250\327yy\256"
+	.ascii	"\335\tlP>\216D{o\347\\\377k\227\206"
+	.string	"\322ji/\217y\301\036O\226\344\363e\b\361\363\013\002\001\034\t\002p'\202)I\327\343\345~@\246\\\201\244$\246^\317\327\243-)\351v@#]\357\027\004\002\371\202\276 m\2473Z\002\232\360%\001y\264\337ni\211\t\310\243\005\201=\237\356'\310;\342\211\030\272oi\367\313\005}\276_\016\310\204\357\207\024\364\365h#\214vIw\367cZ\272JL\275$# \217v\035\357\267\353\355\216\316O\250\360\240\202\205\023\264[(\212P\024av\013EDDE\025\210\316W \222\335`\210\035\n\036p\366\013\0274\b\201\360\260\341\324A\b\"\035\361\222B\034\365x\277 0\327\363))\371t\271\036\317H)\247\373\001s\020\204~FH:!\021\273\336\021\017\330c\022p\253\303\356\370\271\254\272&\203\312\254Q\303\374q\236\2405\233\315&\237+\207u\252\251c1\230\330k\241\254\305a\243n\241\354\215"
+	.ascii	"\304\325B\335n!\363P\020\363\320\017W\021a\225\331\275Um\361"
+	.ascii	"\326h\213\326\206\254\315\255\207`aU?3\344d\251\021\343\326\306"
+	.ascii	"m\r\032\026\033\027a\366Z\0323\254\214#P\020+^\220]lL\3708\251"
+	.ascii	"\2617\200\245\250\2414G\22433%\"\022D\222$\205\016\260\002\021"
+	.ascii	"\0313n\021\200\261sHd\244-\177\322jN;Y\007s\254\234\241rZo\351"
+	.ascii	"\026\f\001+%\313\333\243s\0315\231\230\227\373\244\200]\356\r"
+	.ascii	"\353\236O\231j\347\220q\031;\333b\332\222\2057\236\346\317\232"
+	.ascii	"3-\031\200;\263\213\202H\237\272\364_Q\016\013\t\360\033\322"
+	.ascii	"\346\222\320D\254\020\342\340\003\236\314p RZaidEN\307ODzm\022"
+	.ascii	"\226M\203\360GjJ\341\020R\355\37015\201\314\371\316?RP\204S\336"
+	.ascii	"\377\301\222\305\365\0324]\223\257!\331\275T\274\351\364\205"
+	.ascii	"\216\315B#\b\245\fH\346.<\251A\341\177 w\377\363\243\020\007"
+	.ascii	"\320\345\275&9\327\354\b/6\253\004?.Y\221v\263a\021\223\302I"
+	.ascii	"T\312\221\031\024\"\320\325R\341\267\005\307\341\377\027m\337"
+	.ascii	"\326\034\367f\003 \267\270\303\022ER\347\321\324\354M\347\021"
+	.ascii	"\3170\bh\030\032\375\201\351\036\350>\202\311t\240\332\233w\246"
+	.ascii	"n\345#\335\303\307\261\336\370\277&1E\270\234s\362\007\370l="
+	.ascii	"\234\246\tK0A\233\026\303Sp@O8\270b\247\3032G\2001\362\362\370"
+	.ascii	"q\266\306\343\200u\357\021U"
+	.text
+	.section	.gnu.lto_.symtab.d931f40f11898def,"e",@progbits
+	.string	"isalnum"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335"
+	.string	""
+	.string	""
+	.string	"isdigit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343"
+	.string	""
+	.string	""
+	.string	"isupper"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350"
+	.string	""
+	.string	""
+	.string	"islower"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355"
+	.string	""
+	.string	""
+	.string	"isspace"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362"
+	.string	""
+	.string	""
+	.string	"tolower"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367"
+	.string	""
+	.string	""
+	.string	"toupper"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374"
+	.string	""
+	.string	""
+	.string	"strncasecmp"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\001"
+	.string	""
+	.string	"strcasecmp"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.d931f40f11898def,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
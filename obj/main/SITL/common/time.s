@@ -0,0 +1,967 @@
+	.file	"time.c"
+	.section	.gnu.lto_.profile.edfeeceed7de37c1,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.edfeeceed7de37c1,"e",@progbits
+	.string	"(\265/\375`\334"
+	.string	"\365\b"
+	.string	"\004\r\320\001"
+	.string	"\032"
+	.string	"\310\214\257\245\001\020\002"
+	.string	"\002\001\002\003\001\243\214\302\266\b\002\244\261\227\364\f\024\001\003\217\306\265\237\005\016\002\002\001\004\315\203\200\366\013"
+	.string	"\005\320\272\212\332\002*\002\002\002\004\002"
+	.string	"\002\004\002\004\006\346\307\273\333\001\004\002\005\002\005\002\006\002\006\007\352\263\360\321\b\b\303\243\360\202\004"
+	.string	"\t\211\242\243\201\017\002\n\251\324\331\213\005\013\326\225\305\221\002"
+	.string	"\f\324\342\311\266\t\002\002\007\002\b\r\240\342\234\212\n\016\305\237\224\203\017\222\275\371\270\b\020\331\345\253\313\f\b\002\t\n\021\354\242\3530\002\022\221\335\225\216\r\023\266\200\366\276\b\004\024\211\307\225\365\002\024\025\364\235\311\257\t\026\355\314\246\334\007\027\362\372\330\324\n\030\240\342\234\212\n\031\240\342\234\212\n"
+	.string	"\" `\002b\322\034\003\fR\343\007\260\022\203,"
+	.string	"am\200\331a\374+9\266x\334\312\363\266\022\211\316t\371f\375P\001x\027\356\n\301\02261\360\262\217"
+	.ascii	"t\0348\n71\007\354\007\350\rH0\200\341~\006\343K\334L\332\035"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.edfeeceed7de37c1,"e",@progbits
+	.string	"(\265/\375`\032\001\275\005"
+	.string	"\322\210\026\026\2207\351\272\273\273\273\273\223\376\355?}\373m\t\355&\215\310-S\333\037B\332\205'\341\017\304r\320\005m:e\3008\364\227\224V\201j,\3216\005(\362\324\276\246\033Y\020^\313`\177\ty\276\370\207\260\310'N\267\264|Y5'\261\2144C\351\025\353\252\242\b~\\F( p\2022by\314A\266e#\265\303\373\034\206Zi\301\031\032\016(;\260\265!\032\263(\204\202p<\334\004\343\250$\260\340Ym\212p\356\016\332\240Y\3108\bv\344V\202a"
+	.ascii	"\n\300j\261\305\372\202\004\200h\334\325a|0\262\362\006;\214"
+	.ascii	"s0\036Q\037\220\332_\224!"
+	.text
+	.section	.gnu.lto_.inline.edfeeceed7de37c1,"e",@progbits
+	.string	"(\265/\375`\202\006\215\030"
+	.string	"\246\240iB\020\257&\215\001\205\200\246\310\006\203h\245<.W3\222\345\320\310\017\001\004\013\3239\352\352j\031-\300\360[\033\323\332VG\372#"
+	.string	"\205\212\n\222\002\210\021\034\364\346\334\377\326f\237\334\272m\022\264\245\224)N"
+	.string	"^"
+	.string	"V"
+	.string	"k\273\376$q\\bX\016\350\177%\"\216'\332\342\022\303b\340\314M\334O\236\023\367\3146%\306\231a\227TO\354=\347\316v;Ix\236\246\334\335\255\276$Q\354n\307;[\367<\017\254\300\037\372'qkDi\315\356\016\370\215-\006\001\213\255\002\221\314-\310\b\266\233\033\222\221\274\335L\344\271GR\313\275\221Vr`\235\255\355\236\215$\361\334\335\006\273\273\362\037X\246V\212\017\024\244A\2003\001\320\203\207\022@\031\304\016\b\312\224\361\005\242\252A\231"
+	.string	"\237z\020U\201\220\003j$\n\b\006O*\215L\231c,I\0135\273\" /\352\374\243\324\035\227\333\225>\277\337I_rbZ8\316\032v#i\213\0256+\252\261MMd\375\241\304\307\017\030\312\005 U(U\364G\221\352\245Jb\214&j3!C\204k20\036\245\020G\251G\251\374?\245<\351\347%&\216&\taw\337-\004w\003\233\232j"
+	.ascii	"\200\177J\021*`X\\$N\274\334llp\021\242B\207\343 %nhI\342\230"
+	.ascii	"\240\271\351,\312C3\027^r"
+	.string	"\334\233\250\f\205\021 Dy\211\007\0220\\?\035\264\006\272\354n\306\237\366\203\252?\265\273\235=\031\277*^\235S\224x\312u\036\224\273z\224\322\253\271]\200\260\2501A\250J\204\244\240 I\241\320\001p\002!*\"\363\022\3004EJR\250fFD\202&-\024\366\217\003\266EYFdM\364\202%b\222\264\0060]\313\320\325\262ee=&\\s\025\315e\257Tf\302\200G4\230,\226\257%\322\304g\020\235\210\002\271S\253\3554\300\220O\231\263\312\023\b\034S\214.\256*\237wi\211\354I\354\376\227\334y4\027^\3174\2012\361\375\035\016I\023(\005#\261\240EnE\346\205\204\263\344\322\231\234\220\351 h\344\002a\001tD.E\304\304\346YHK\312C(f\236Q\f\320\256\211&\302*^$\025\316\306\303\227d;e\357B\344\022l\214r\256\3053M\253\037\nf\331\030)\245\264\247"
+	.ascii	"#\266\202\037CC\021x\230 \336?\251Y\270\0236\346U\350\017\237"
+	.ascii	"\323\343Pm\037\376&\205\276\034\213\026g\263\200T\307\202-\357"
+	.ascii	"\t\314\003/1\201m\225E\3501Z\021\307l\321(\004@X\254Bt\237\332"
+	.ascii	"1M\362)0\322^\302}Z\026\372\210w?~\200>\026h8:\350\377;\203Y"
+	.ascii	"0 \336\200J\366\f\021P\216\271\177\337\336\001\300\363\300Z\346"
+	.ascii	"\360jT\t\024\246\275\324\332ZB\212\274\311'\253\254eX2X*\375"
+	.ascii	"\331\363\036\361\340\340-\222\005\323\260\344\026\002\3611"
+	.text
+	.section	.gnu.lto_.jmpfuncs.edfeeceed7de37c1,"e",@progbits
+	.string	"(\265/\375`\362\002\245\n"
+	.ascii	"\242\216/0`k\222\016\335 H\330\242\260\230 \b\264\001\234\213"
+	.ascii	"\322z\306JT\303\360^ps\252\302\260l\030K\2179\200\201o\277\207"
+	.ascii	"\242\337\332"
+	.string	"\260\021!2\355\227\200p\030\214\0135]L\233\007j\262`(.\324\324\260\201\240&\313\335\006\234l\355\202\253\024K\271\233@M(3\022Jf \310\023X\270\317=\352\3217\202\021B\221&\3459l\262\307\3133\260{|\307\375\262\342\351P\322e\002.\207/v]\271\006_\203\3758\026Og\005v0iJQ{\310\177\0038[#\254J\003dC\302\252\252\252\372>\260\347\331f\335\315\372\276lM\372\216\371Yc\003\315\233\222o\357\261\277\312M\3341\216> p\242)\272\352\001\220\205\\\360Y\242\347\226\241\241w\230\310]\260[\026RL\016LJ\0071\262D\254\r\217\212\261Lt\307#\242\222h\374\022\310\003\034\234\201\300\021x\303\026\242\271\035\243\025{\036;K(\204\305\346EQ\360(\2063\002\234\205\037\376\207\333t:q\236\025\020\027\202\332\345\242\313~\2676\261`y\001\331L\210\240\221\330\374"
+	.string	"3\370\f\226p\330\002$\036\310\214\232;i\026E\033u[\227\257rH\023\024L"
+	.ascii	"\250\255\204E\252\203\r\245\b"
+	.text
+	.section	.gnu.lto_.pureconst.edfeeceed7de37c1,"e",@progbits
+	.string	"(\265/\375 >\361\001"
+	.string	":"
+	.string	""
+	.string	""
+	.string	"\023"
+	.ascii	"\205\004\002\232\004\003\205\004\004\230\004\005\231\004\006"
+	.ascii	"\232\004\b\200\004\t\205\004\n\205\004\013\230\004\f\230\004"
+	.ascii	"\016\230\004\017\230\004\020\232\004\021\204\004\022\230\004"
+	.ascii	"\023\231\004\024\232\004\025\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.edfeeceed7de37c1,"e",@progbits
+	.string	"(\265/\375`\013\001\235\006"
+	.string	"\262\310\034%\2207\351P\325W\335i\325v\177\247\375s\274\341\273\257\356\372_ER\336\210\335\330\220\020\033\033\261\273[#[\246K\221U\003t\001g\264\335\243\266l\\Y&\246@\302"
+	.string	"\201\375\200\025\340\225A\026\243\023x\300\237\347}\260?Z\027&\262u\242P[2\034\321\202\271\244j\236\222uOSby \376y\177\357;\356`\325\274{\037\227\260\177\222\035\272[' @B\344\324\361\001\310\007\030\257S\333&\"\342Oo\"\031\003\254m\224\023\271\022\201\004\332\3205\300w\353ir"
+	.ascii	"\211E\257\267I\030p\315`h\001\004\371\303\3512\2344\020\3451"
+	.ascii	"\003\"\264R\34613\017 <\222\005\322Tc\024\003\250N\300\203\030"
+	.ascii	"q\0200\007\254k\250YO\003C"
+	.text
+	.section	.gnu.lto_.lto.edfeeceed7de37c1,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_days.12.edfeeceed7de37c1,"e",@progbits
+	.string	"(\265/\375`|\001\305\013"
+	.string	"\206SD<\020%9k\360\3140\202<\001\371\352\336\306)\343\224q\366$9E\020\371\367}\263\221 %\250\214j\200w\316\373\002@\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200,"
+	.string	"\304\325)\320"
+	.string	"\025\200Sk+\2737\3556"
+	.string	"2"
+	.string	"4"
+	.ascii	"\243^\027\231}\344\366\324\270j\2440l\341\201\341\340+B\211f"
+	.ascii	"]\203w\361\235\367\005\036\002\b\035V,\232\002\016[\213\002?"
+	.ascii	"\213\207"
+	.string	"\340w\200\264\b~\2719\256C\b\253\317O\310Y\243\243\234\236\262\272\312\353\255\331Wnw\215\263\\\327\r\"m\254@\233DF*D\203(m\272\274cs\217\317?\310O\243\203\234\036\262\032\032\235\312\345\362\327\346\260\317c\344/\243\303\234\036\263\272\314\353\262\331g\267\317\214\323t5/\302+y(O\3669|\030\337\351\213}\001\256\305-K.7\331<\334$\263\267\334^3\3563J(\260\271\234\266\371\315\3475r\234\321sN\327Y\335\366\372\316\354\267\333y\306{8\002\003\316\305\001M1\307\254o\335D\027< `\023Qs\363IQ(\262\022m\207\024\346Zk\245]\333Zi\327\264&\332\f}[k\244]\323Zi\327\264&\315\265\255\21168t\303\266\326b9n\230\333\206\030w\030nS\f9v.\002\373\240\337P\260#\367\016{e\316e\035\001v\343\260{\337C\333\001\273\256\252\f\211a"
+	.ascii	"\370#\261i\250E"
+	.text
+	.section	.gnu.lto_timeConfig_Registry.16.edfeeceed7de37c1,"e",@progbits
+	.string	"(\265/\375 \223E\004"
+	.string	"\244\007`"
+	.string	""
+	.string	""
+	.string	"'"
+	.string	"\005\001\212\001\206\200\200\374\342\203\267\217\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\325\006us\356\005uq"
+	.string	"\005\001\006'\001\002\216\004?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/common/time.c"
+	.string	"\004"
+	.ascii	")\302\303,\016\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_timeConfig.18.edfeeceed7de37c1,"e",@progbits
+	.string	"(\265/\375 \034\341"
+	.string	""
+	.string	"\017"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\031\001"
+	.string	"?\202\210\200\b\177}\273\001"
+	.text
+	.section	.gnu.lto_dateTimeToRtcTime.19.edfeeceed7de37c1,"e",@progbits
+	.string	"(\265/\375`\315\004e\035"
+	.string	"\206\370\300H\220VN:\205_4."
+	.string	"\370\002\370\005\203\246\363\373WuEWL\\\336\257g\243h\005\021\374\345\224\346\237Y\321\316C\323\327\264:\361\3043\270I\004&\212\363\361+F#\2402\025S\277\333\375\271\266o\t\331\204\310\235R\254"
+	.string	"\230"
+	.string	"\260"
+	.string	"b'\355\373?^f\343\034\342d^\255!.\204\215\373x{\311\347\272\360^\347\361\036\367\3611\343\304\330lD\b\323\345n\265\272h\203"
+	.string	"V\302\301\227\t\006C]\356\251\245>\275\220\262\241\240K\007\306uB\255\326\340\201\340\265\226\276\245T\222PQz\275@\241Vk%\360\321\004\312\2179\3610t\316g\215\270K\255UJ\310j\r\026\260\256\374h\333\317q\035Kf\252\t\312`A\001J\224\360I\255u\347\340e\350\307\3620\364\343\3068\323'\223\377\261\2138\246\232H\255 \361I6\250\265zJ\255`q\357m\003\331\256`\217\017\002\364\343wh\007VV\323l\263\203Nsa\330\027\353V\331\267i\335m:\3506\rt\233\376\241\323>\337\272{\336u\363|x\013\370\327\235;\330\275\363\260[\347bw\316\263~\034r\372\246\234\266)\247k\312i\232rz\246\234\226)\247c\312i\230r\372\245\234v!\247[\312i"
+	.string	"\3454K9\275B\247U\3504\216\234N\241\3237:]\216\323$\235\246tz\034\247\305qz\307\3519N\177\200\201$4MjM\321\006\245\036\031\313j|\353\357\372\207\377\327\017\366\207\375\001K\317\240\250Z\326eo&\035G\223\360\241\355\rO2aHF\255O\t\220\374\254\202h\341\002\275\324\005\372\261e?\234Q\346\263"
+	.ascii	"\366c\237S\302\002WY\237\365\214\232\302\335\270\216\256,\313"
+	.ascii	"\225\023\317\256\354UL\241A\261\251,\317\007\261\333\214\342"
+	.ascii	"VeE\263\224\305a\270\221\f)KZ\t\327n+\240\334\333\212g\344\226"
+	.ascii	"{\r/B.\251%\304\242\233\023\372\270tE!\024\225\323l\263\270\343"
+	.ascii	"\236\350C\304%[t\255\355\356\024]\310.i\325\2055W\207\367 s\207"
+	.ascii	"v\254}sv\232E\261\231\303\315ze\255\025\201\017\344\201\207\222"
+	.ascii	"\306G\177DF?`\021\017\004\345!%\375z>z\224\004\354 *\021\031"
+	.ascii	"m\007\244\037\3207\036\021\361\224D\236\257GAD\357\227T\"\031"
+	.ascii	"M\027\t\361|=\244\335\017\350\363\001\213v\277\036\221oWt\004"
+	.ascii	"b'dc\340\007\336\321\016\t\b<\332\341\202M\337*]\251fE\266\246"
+	.ascii	"\326\264N\016Z\240\325\355\241\250n6h\305\264(\266&%7\021\372"
+	.ascii	"\263@\273N\240\256z\366g_\366\236\262&\\h^\021\316$\303\315\336"
+	.ascii	"\264\206kY6\333\263O\313\331\232\265Y\235%\247\331\232\315\211"
+	.ascii	"\242\2633K\2638i\013\256\2432;\2638\302\235\215Y\231\r \254\271"
+	.ascii	"\216\302l\314\336\024\201\272\312\355\313\302\254\215\313\262"
+	.ascii	"\354KP\25010$\215b\310\221\013f\222\026\264\260\034\340\"\231"
+	.ascii	"\252u\021`\251tl\204R\305\035\"\250\2770\240\341A5\005L~\355"
+	.ascii	"i\314\323<MI\374\326\016\200\251\034b\264T\233u-\034\337\027"
+	.ascii	"\n\355\334\313\204\f\342L|]jY\262\243!\030z\336\371\255C\030"
+	.ascii	"\3436\235\320/\234\341.\"\r\003\207\305x\200\365\227\312\023"
+	.ascii	"e\227lU\274\217\245\026LO\304\227\356\341X\267\307&\315\2759"
+	.ascii	"\340*\271\241\346\366\322\214#:\201Gd\364mG\243\351\333t\275"
+	.ascii	"\270\254\356\343\022g\200\233\215\036;\212\213\026\274L5u\342"
+	.ascii	"\017"
+	.text
+	.section	.gnu.lto_rtcTimeToDateTime.20.edfeeceed7de37c1,"e",@progbits
+	.string	"(\265/\375`S\006E%"
+	.string	"\272D\264\016F\220\332M:\204\331N\266\035\352\235\353k\026\035\016\037\322m?\030\007k\007\2559\277\\\255\320\b3m\364\356hn3lQ\213\376I\030\256\023\311+\321D"
+	.string	"\304t{\225\215sR\030\215~\260\315ZB6!i'\031\335"
+	.string	"\310"
+	.string	"\331"
+	.ascii	"\267)/\302~\004\337\324Z+H\301)\360\371T\337\217#[\023J\217\353"
+	.ascii	"(\366\352\371\013W\312\260*\251x9yS\253\320\201\307\205PzT N"
+	.ascii	"!\2149Xj\255\020\326\201\347\256\235\370I\317Pb\370\247V `\260"
+	.ascii	"\324*\204\260\270\322\343\n\035D=\226\006\242\036"
+	.string	"{\273m,\034R\311\037:\246\300\344\324Zs\027r\273\325\366\026\205^\372\236m\265\222\244\243\370\331[O\254!\325\225\f\333\304\261H\027\227\313X\005E\013\\\306\256L\315Z\220\033@\227.c\245\303]V\301I\212>\265V\236+\237(aV]IMj\343\312\341q\201\217\033@\213\342\322\023%Dx\256f\210\217\022Vv\273\362\315[\314J\3014\252\253\034\236\344\205Z\353N\252\253\033\336\233w\267lw/\354R\t\001@4?&\377\256\n[\321\225\265V\n\353\261\036\224\335\317\214\304\240\036M\205\0265\207;\377\317\261%/\027Z\364y\027@\263\037\231_t\263\231\272\0235\207K\236\031\006Ep\237\007,\3731\221\232\303]\241\214y\255\257&[5\366@vsJI8\244##\006\206b+\360\024o\221\2056\002\177y\211,\305;D\316= \316\025\242s\r\320\271\005\350\\\002\344\334 :w"
+	.string	"\235\013D\347\n \347\376\220s}\310\271=\344\\\236qn"
+	.string	"r.\200q\356\215\234k\033\347\326\306\271%\235K\216s)\235;\216sE:\367\343\334)\316\265\0042\213\214\320\225Zm\f\353\3241#\031\022\177\331R\354)\376\256\r\3460\213m7\326\0167o\362u%N\031"
+	.ascii	"\300\003`0\231\236\021\2171\003\360\032\227\331\222s1\262f\016"
+	.ascii	"y\255\255\025\031q?\235\371\252\005\343\241\373\214W\032\337"
+	.ascii	"\244c54\326T\3323\034\016\207\306\321\241\343n1\2178\202i\277"
+	.ascii	",\2519\234\0162\326\004\316H\3278\272\342\207\236\364\252\265"
+	.ascii	"x\255E\372\355P^b|\223\316\332~\273\247\356D\355>\360\227\021"
+	.ascii	"\rvW\203\275\224(:\253\325W\241\314]L\210LM\324TM\324\243\355"
+	.ascii	"5\256\2629dQ\336\n\222\245\376Z[|t\244/\005\313\327N\305\374"
+	.ascii	"\272nI\216^\3369\202e?&Yl\364\243/\005\303\310\357\242\260\026"
+	.ascii	"z\362\266c\300\350\364<\340\360G&e\364%`\332\370]'c\021?2\270"
+	.ascii	"x\027@7U\\t\006_\nM:'\016.\234\236Z\224P&\232^\210)xO;\335\310"
+	.ascii	"3\357\304\\\246\bM:'^\356i\247\323\355\230rON&t9&(\026\271\b"
+	.ascii	"B\273[\321\004\225\343\355vP\271\233\260\272f0^\221$z\356U\031"
+	.ascii	"x\214\211\272\324\036\370\356\006\277\021\372\201O\260\251;T"
+	.ascii	"\214\340B\377\200\225\366#\223\372n\007\267as\306\005n\340\243"
+	.ascii	"\231_\026\201\017x\201\373\267\025t\002?X\257\207\327\2148\032"
+	.ascii	"\242\246D\202!i\202~D\204\f\351\003\276\002\313\r\320w=\370L"
+	.ascii	"g\207\n\315:*\340@\271\0138\t,4?\337\005a3!\342P\241Eu9\004\365"
+	.ascii	"\371\317\317\246\347<\367\271\177YI\357\251\235\347\"\260\314"
+	.ascii	"\246\356\330\256\265\026sR\232R\351+\2127\343(\021\321\215f\213"
+	.ascii	"\265\326Z\273V\030\023])t\250Q0\243\024bJ\241\222\021\2214IZ"
+	.ascii	"\003\200\002\031\"+z\021\220-EdS\320\232\205\003@*\353@\322L"
+	.ascii	"\265\230+J+\177s\257,O5\274\306\022=\330$\226\337\302\310\313"
+	.ascii	"Y*V\033hM7\016WX\323\202\304\006\364\360t\210BV\003\355\324-"
+	.ascii	"\313\372&\025c\225\270\303#L\275E\274N\203\262}Bk\264Wz<\331"
+	.ascii	"\212\374p\341\356\002^j@JH$\377\200\360\206m\227}s\2326\2300"
+	.ascii	"b\262\224D\362`\\\345\374l\374\250eA\253.\316P\331\232yl)\023"
+	.ascii	"\b\373R3\021R\322\256\304\303o\030\003\323\260h\b+\374\244\315"
+	.ascii	"=\034\322\300'\210\357\023\247H|k\016\260\240\315h\361\263O\357"
+	.ascii	"B\262\b\003\303\354='\032y\027\225\362\214\213\340\252&`S\274"
+	.ascii	"\016\242\351(\2208\203\327\327\335\236\367h\346\260\007\301)"
+	.ascii	"Y\3235y\304$\355\324\346\017"
+	.text
+	.section	.gnu.lto_rtcIsDateTimeValid.22.edfeeceed7de37c1,"e",@progbits
+	.string	"(\265/\375`\340\002\225\022"
+	.string	"\206\342vF\340\322&\035\223\032\004X\020\351\357;\326\377\213%U\277\2644\204\2131\372\250\007$\226\374\267pW_\322\250N\216\357\307N\0137\231\326\203\260\034\216\221P\235C\"\251U\020H\343"
+	.string	"\"\363\271n\215\220\275\267\224)\005d"
+	.string	"Z"
+	.string	"d"
+	.string	"\333\241c7\020\017\267\027\210\207\266\375"
+	.string	"\002\213[\036+\321i-\03612\037\2731\223\222x\313I\243M\213\360i\266\370\032\t\004!\302G\306\305:)\301\210\032\233\217lrKA\343!\265\230\2140\t;\344+\271^Rs\320|x\"\273\373\234\347\214\253\225\251\221\354\256S\306Us\227n[f\333\201\235>\001\027R6\023\207\376J<\274\302Y\217\033\034\227,\262c\254T\230\375\267\273k}\031\3448?"
+	.ascii	"\230&iz\364\322\333Kk/\035_\032"
+	.string	"\276\364{i}\351\324\364\003hB8B\200v\273\242\241\275\001yN\330f\261K\2663\355\2578\013\226\343\254\234\300\356\253\306\316n\254\201\025\004\335\017\35224\205\263\0377Qa>p.F\335\320\351\320\351\301\360\0301\310\261\335\205!\347\"T\016]\316\213?\205\372d\251\303x\ngC\177\ns\351\\T\245\320\251\320\351y\321\271\230\252\372h\300\204h9\303e\\\006\345\356\262Ta\026\200\342\253x-\351\200tl\274\244\220m\325]\254\266\335\215\340\267\b(.U\001\245bba\363i\004\305\245TL'*\216S\235L')\023\316tBI1\215 \260J\003\n\305\244\242R\241\230J\261\275\276\234\243\005\317\215\301I:c\033DE\\\264e\222\202\350c\210\\\262\b\222\024v\035\332e\215\364\245\375|\025G&\237\261\032)\234\021\351\266\363MK\272\035\247\363lA\003vW\223p.j:!5 "
+	.ascii	"\003\021\021\353\006\314\b\230\320\307K\240\210\340w%\333\202"
+	.ascii	"\b\3025\315\006\\\213\244\3457Z[\3402\336\2317\260\345-\313\""
+	.ascii	"\341\224`\215\265\344\f\247@\333\007'e\270Ky>\325\314%\3065\351"
+	.ascii	"\227\205\230\203\321XL\301\264\364\350L+\232Z\\$^\353\017\215"
+	.ascii	"1*D\034F\243`\210\035\214\243iC\271\3471\352t\310\200\214\200"
+	.ascii	"\f;R\217\030,\003"
+	.text
+	.section	.gnu.lto_dateTimeWithOffset.23.edfeeceed7de37c1,"e",@progbits
+	.string	"(\265/\375`\310\0015\021"
+	.string	"\206bvF\340\320(\035\352\203^\312\365\331\222\006\023\2639E\027.\303\250\264\0232\001\365 \311\201 \2070\217}\370\303c \201\247`\223\203K\020\fC\343\n{`\362\270A R\031`\351\026V\245\275\334[k\233\304J\231R`"
+	.string	"Z"
+	.string	"c"
+	.string	"\255\337DH\324\272\274H\364\354\256\210\017\210\276\241\362\036\\\310\""
+	.string	"\265.\262\030\222\247\375\020\027\321\272\r\313;vg~zvC\021\207\210\2769|"
+	.string	"\356\233\350\036\3347\267\354\026\017i6b\250\275\314d\354n\247\032\336z\266\374\317>\212\301\264<\243\201\335u\306`(\334z\333 \266\027\330\251 \216iTL\2374m\212i\216\230\336\270\315O\372\315?\212iQL\307\207?\247\351\220\246U\323\031\323\357 \305\240\b\301\331\235P\243\261@\233\017\007\333\367K\234gu\232?V:\337Q9\315\004hT\354\022\316sVN3\211k\366awK\337\354\025\273\364MK\266u\304e\0011`5!\025\351y\016\342\343BfR\325\220\252\n\230L\201\373\004\227\252zX\315HS?{\310\303\205\331+\b\207CM\372\227\032\256\254\371=\277r\350w\236\033R\300@\304\025\377\270\353I\237s\020\0304dA4\237W\326LJNmP\225\217]?t*"
+	.string	"\271h\213\035\276R3\330\017\355\356Zg\034+\217\245\222\372\300\370\300\344c})\004'\226\267BAa\340\201_\211\3072i`\362\311\210\007~\254.\245\002A\325I\227\372L\300\356$e\325\215\f\260\n\202\227\322\261T\252\224\256\024\272\036Z\235q\002\013@.}\331\224\033JR\333s\220\217\371\263\227\230\3500\343\205\004m1J\243n"
+	.string	"`\001\223\321Z\355\244(u\276\304\370\207\023iT\r\036"
+	.ascii	"\006\b\312\f\375D\004>.\336UA\220\212Q\023\270\215\323\017e="
+	.ascii	"U\211fZB\225)]z\\\347\322\244\013F`\025\024\006\322\001e\241"
+	.ascii	"P\312q\2101h\264?N\223\204\r%\264\031\034\006\303\002Thp\227"
+	.ascii	"\027\355$\003"
+	.text
+	.section	.gnu.lto_dateTimeFormat.24.edfeeceed7de37c1,"e",@progbits
+	.string	"(\265/\375`\306\b-/"
+	.string	"\032W\360\022E`\236N\007\363\330\031\375\004j\201+XD.\033E3\371\026\007,S\201\0167\r\237\263_U\325\026a\237R\232\033P\004\3069\374\201)\342p\240\212\267H20\322\355\020\307\332\377\334\024i\273\333\226;\245\224\002\035\001\376"
+	.ascii	"!\001LD#\216-\216\005\263\260\3553\177qSi,]\327O\026\332\365"
+	.ascii	"\335W;\215\352\265\3030f\203\357\336\263\024v\301\016J\351~\256"
+	.ascii	"\030S\215\310\275\227DWi+_}\205\363\222\304\232K>\266\304\301"
+	.ascii	"\335{\253\324\266I\350\024dR\262y\315\206>\364\342\022\264e\016"
+	.ascii	"\252\365\216\202\354\346\321Z3n\313\004;\327N\276\372I\013\377"
+	.ascii	"\271ba1\354\356\275Q\334@m\373\343\337\3642\003\345\316\334q"
+	.ascii	"\275\344\253\345^4\320\275mT\354\356mFq\223\332\226\233-\224"
+	.ascii	"\266U;(m\313\314<l\360\305\310n\272\231\001\307d,\241\370\335"
+	.ascii	"\333\234\372\036\215lapU\201\251E\337\221\334@\t(\\\020-dh\311"
+	.ascii	"\026\006\225v\244\251\365\212\026\261u\231\321{g7P\2460<\316"
+	.ascii	"\264\22135W\201\022v\244\2555\260\367\316l,=\255\321V\210\246"
+	.ascii	"D\223\356\2752\320\306\034\235\321\217>\361\335\275\351A\023"
+	.ascii	"C\205\314\204\220\365\263\275\f-\314\035(\341\336\313N\206\226"
+	.ascii	"\326\274\323\314\334df9f\025B\337x\375\364R\311\230\211'\274"
+	.ascii	"\3118I\371Iv\372\177#oZ\232>\312s\270\361ozve\0340.\355\364\376"
+	.ascii	"\255\245+\274y\253S:\373\241\336\363\226u\300\374\217!4\321\367"
+	.ascii	"\2147)J%a\376\327nq\370\354\376\231\334\"u\372n\322#L\0331f\304"
+	.ascii	"<\016s3\314\237\311\334\350\3756\346\226\353\036Zg\005\035\245"
+	.ascii	"\233\312:GAu\263\373\251\237t;\t\235\233\254\363\201\236\322"
+	.ascii	"l\240\2574/5]\263RR7\233\221\254\363Q\320\331\310:\027X\235\t"
+	.ascii	"X\347\242\325\231\310:\017X\235\005X\347\241\325Y\310:\007X\235"
+	.ascii	"\203\2543\200\2403\220u\376\t:\373X\347\236\325\231\307:\357"
+	.ascii	"\254\316B\353\034\\\235W\353\254\256\316@\353\234\256\316\226"
+	.ascii	"\235Q\353\374\252\263\253\316\ra\350\f\033\016\246\331\223i^"
+	.ascii	"\263\2779W\317:\207\364\224\356+\335t\335\316F\231\233\033\257"
+	.ascii	"\363:\013\263\220Y4^\351\253\037\374\235\357\371\0379\023\214"
+	.ascii	"\334\356U6\031\005U\311\002A\333\3413[\270\340w\355\223\354\363"
+	.ascii	"?\"\332\317\312\347-\317\367\200\3507<\277:\205\277\343\241\373"
+	.ascii	"\204\317\263\007&\311\372\301\016\315f}\353\004\276\272\241\371"
+	.ascii	"\200\277\356\201\201#g?\375\341\0175\313:\254\241\323T\251\334"
+	.ascii	"h\220rF\025H[n\257\264\255}/\032s\330\226\310\201\001\237\311"
+	.ascii	"\301\261$\313:\333_:e\342X\326\241\335\310\324\200\205\242\241"
+	.ascii	"\307\026\207\"}\322\227\361\227\246\372~6P\223!\311\364\231a"
+	.ascii	"2\364\323*L\237\237\2065}c6\254Q\343W\325\341N\r\234\230\356"
+	.ascii	",\354\241H\032\277\356*\020\375\254\262wi\340\372\270\255\322"
+	.ascii	"\316\302\"\372i\325S\346\336\353\240\263t"
+	.string	"\3138\303\206\243\017\314\357\275I\373L\026\216\371X\326}\324\247\314\265\245/\013Bq[\326=\324\247L\265e\235'h\245/\353g3\275=\367\323\313\316\345\371\241\376\364H_\206L\321'\341\004\310\221\236y\304\2257\031\372<d^\364\304>\211\366\370\377S\\bH\305\364\240\304\220\212\t\213\251k\001\025\223\324\007)~\2204\244b\212\352b@\305t\244\342\n\253\250\302\032\271\272\212(F\2708\252Z#\\\034\203*\256B\034\211\\\351V1\313\310E\fq\344*\2420\356\030\211\307\256\255,\rG\242\321\204\211\"\017Q+\353\003\361xUB5\321E\342\031K\212\250\225u\234\332*ji\025\261\246\266\262\256\264\246\260\270\214SRD\\\\A\344\232:\026\213\\SB\006k\364~\233\201\357)C\242\007\366alD\357\335\021\241\235\335|s\376'|&\373\032\365jj\202\346\274\364\300\227-\275\202?\360"
+	.string	">\300\017\375\200/\372\002\177\364\215\3471\220K\220LTe\237\351\370$\033\375\221\b\207ae\364\226\300\027"
+	.ascii	"\341K\002\277:\211\276\310\203\217\021=\317\336\0308\002~@\007"
+	.ascii	"\017\023\360\326)\364C\033<)\364\353^\320\007\370\013z\23742"
+	.ascii	"I\344\200\036\300\017\201\220\311\320t\200~\301\034\0314\370"
+	.ascii	"L\347fXw\f\347\027\272\365\333\370F\215#N\300(\275\202\357-m"
+	.ascii	"\001\016\310\237\322\017\314\377\\\313\230Y\021\025\311\003\200"
+	.ascii	"\223\250A,\203\031R\212\214\210H ##J\241\003\300\242\221\"\352"
+	.ascii	"\034\021p%dfJLR\324\001\230\2020u\241\th\376& \375G\256\334\222"
+	.ascii	"\342\216\352\272)|\254-w\016\267\233\320\326\347\351\t\023\017"
+	.ascii	"\250\225H\333h\215VYh\370\304H%\326\006Dj7-LF\376\264\321v(\314"
+	.ascii	"\277\r\333v6\252T\327\302\312\366?\022z\217{7h\"J\234xXYP@o#"
+	.ascii	"\300\262\346n\372\2054\236\336u\230\304\341\031r<\034\363p\001"
+	.ascii	"CK\035\313\245\325\261\360\024\031Rzw\307\215\241\327\330\302"
+	.ascii	"\341&\024S\264\271\006\250\346\311^\360T;\r|I\264\235\"\217\b"
+	.ascii	"W\313\030\363\3306<\202\322\306M\204{\233\225\270\372\023\311"
+	.ascii	"\333{\270\335H\257\310\244%\fo\3121i{\221\234\n\241Aj\363\232"
+	.ascii	"\341\376\340I\311\220\027\t!\351\317+4B.BZ\304y\361\241\006\233"
+	.ascii	"\201\"\352\n^\310\3646\332\267\021\211\203\214b`x\216b)p\251"
+	.ascii	"\272\033\007\300H\214\224\245!\205\360\240\241\034\341\2617\200"
+	.ascii	"S\036\361\007"
+	.text
+	.section	.gnu.lto_rtcTimeMake.25.edfeeceed7de37c1,"e",@progbits
+	.string	"(\265/\375`\177"
+	.string	"\345\t"
+	.string	"\326\023F=@\211(\035\263VX\377\3149f\3735i\231\rf\266\372\032\036\001\200\206"
+	.string	"\357OqO\324\366\032F\215\255]Iw\273\345\016\303\260a\201\347\310\036\370\360\005\t\216\177"
+	.string	"\362\367&R\246\0245"
+	.string	"5"
+	.string	"1"
+	.string	"\001.\240\363\306\301\013\031E\006\b@\246\b\273{\331{C<\254\316\020\017\025\344\233\347\306\277\351PC\344\013\2118O\t\305\356:C\242\321\255\267\035a{\302>D\233\361IX\005\320\300\210\355\316\236\330\246\b\274@\367\322\205\341.G\202\323\256g\331\252\016\0272\323\376\200\223\272{\030V\330\355 \235v\327\262DuH\241l\373\001\367\201xM\325\007\037"
+	.string	"\236\374L\351\365\016@\023:\371\331\036'\365\303>\265\273k\365\260\235\216/\375\360\336O\301\264\302t\302\364\253\311i\201\005a\003\\v\271dZ\3440\013G\031\253X\264Lsa6M\333\260\013\223Uh\027\226\341\256\312\2037\013K\346\322l[\346\232x{G\245t\324c\325\324\250\377l@U\245$\r\002\r"
+	.string	"2\003\302\260\\8"
+	.ascii	"\354KP\231\264k6\313D\004\004\006W\304\3248\270\373\244Z1\t\223"
+	.ascii	"\f"
+	.text
+	.section	.gnu.lto_rtcTimeGetSeconds.26.edfeeceed7de37c1,"e",@progbits
+	.string	"(\265/\375`C"
+	.string	"\205\b"
+	.string	"v\320:5P\215\322\001'\241\262\031&\007z\b\225\352]wX\f\242\332\242\\\203\225\316o\353\353\271\3327$gj\02513\213\214\251\345#>\371%\364I\322\366&R\246\024*"
+	.string	"+"
+	.string	"+"
+	.string	"\246\016\224\335\205\227\013\274\273\353\001\357N%.z\212\374o\374ZU\230\234P\243\247\005aw\235'\024\304\255\267M`\333\3006+\255\224\035q \026\266Cvf;\323\376\352\032\241G\320\001vS\036\037\273\361\300\005\330\235#f\333\307xF\310\242+N\240\236\352$\251Wi\270(\235\203\341\203Q\370\240ww}\211C\004)[v\034\245\252\354_\253)\273\307\377\322tj\372/\013!\301\210\354>\004\236;\203\321h\033\017\344l\232\266e g\223\240\301Lg\001b\006\274)h:\320\263m\035\230\305\275\235^HZr\252\323\233V,\254\177\3365\r"
+	.ascii	"2\003\302\260\\\270\372)S>\246\345\236e\256\341$\023XQ\343u`"
+	.ascii	"\342\301]#\325\212I\230d"
+	.text
+	.section	.gnu.lto_rtcTimeGetMillis.27.edfeeceed7de37c1,"e",@progbits
+	.string	"(\265/\375`C"
+	.string	"\235\b"
+	.string	"\266\020<7@\305(\035m\037\274\267\324L\264\300\210\376e\265V'\200\004tq\354\206n\346o\365:\3752\205#\264m\3128\206\2414\200[\031\265\300V\232Y5i{\023)S\n+"
+	.string	"+"
+	.string	"+"
+	.string	"&$\025\312n\204\001'xw\371\201w\247\027\007=A\376;~\245P!%S\350YY\330]g\311Dq\353m\037\330N\260\315\n+\321J\331\021\267B\331\376\330\231\355L\373\251s|\036=\027\330=\201\210\354F\005#`w\216\230m_\343\033\037\2032bL<U\357\232z"
+	.string	"\020\253\321=\036:X\206\357yw\327\227DT\210\262e\307P\252\205\375k\365d\367\370_\232NM\377e'$\360c\003\234\373b\301h\031\016\324l\232\266]\240&\303\240\301\313\306\001Z\n\2745`6\220\263m\033\230\305\275\235\032\210t\344T\247'\005\020e\313\025\326;\001\f"
+	.ascii	"2\003\302\260p\341\210\217=\271g\257k\"\311DS\324 \035\230 \340"
+	.ascii	"\204\221j\305$L2"
+	.text
+	.section	.gnu.lto_dateTimeFormatUTC.28.edfeeceed7de37c1,"e",@progbits
+	.string	"(\265/\375`7"
+	.string	"%\b"
+	.string	"V\220:8@\305(\035\320\362\212\326\347\241)\221\003\376a\241\311\211\023\022\035o\337%W\213\r\201\362\214\t\202\222-\013;U\270\f\033cw\370\240 \371\355L\037\200\355`k)S\n+"
+	.string	")"
+	.string	")"
+	.string	"\r\234\273G\216\320I\250O\310i7B\335x\367\354\374\177\374"
+	.string	"$\345A\021\021u\236\002\016\273\353\004\2114n\275m\004\333\226\355\222\035\266o\233\263-\2665^\230(d\332\367x\211\273\t\343\003\273\243\322\310n\\pB\345\317\361\005\325_\345\004\325\237m3\004\232js,\362\240\247\227\217v\354\330I%\331\017\330\335\265\216l\247\337\343\2577\375Y="
+	.string	"8\005\200)\273\241\024jO\036I\233DNp\"\324\227\225\3014\033\334d\030\226]p\243\201\300\340\245U@\313\300\031EF\203[\226i\320\022\367~z\311P\217\253\304\034s\r\t"
+	.ascii	"2\003\202a\353\352\022w\031\033T\003W\300\\\002T\234\3275\311"
+	.text
+	.section	.gnu.lto_dateTimeFormatLocal.29.edfeeceed7de37c1,"e",@progbits
+	.string	"(\265/\375`x"
+	.string	"\275\t"
+	.string	"\326\323E<@\305(\035\365\311\373\202\267>\277`IA\373\265\274)\346\023@\017\260:Xw:Z\355\253s\232\366m#\240\312b(\363\f\003\347\370\002\007\213*\\I\371\244\330\025\022\273\211\224)\0054"
+	.string	"5"
+	.string	"1"
+	.string	"\230C\356\006\230C\333\206\220 \271\364H\262\272+$\025\223\355\306N]/=K\376W\256"
+	.string	"\213\301\006\264\260L\317\255bw\235*\226\310\255\267\275`{c\037!?\374\353\327`:\265\3649P\224\025\240"
+	.string	"\260\273\232\031\330"
+	.string	"\360\345\3046\311\316\330\326\350A\300!\323>\312SH\177}\274`\267\245\342\262\033\037\314\300\035:\376 j\3625\365\002R\007\274\361\230\307\355\202L\370\260\263|\276\311\241A\242\274\352\320\027a\016\257\021%\257S\316\354\210J\035\261\257\355\356Z[\266\323\333c#\214\314\350\270Ps6\035\3173\352>\237\347}\234\356\343\261\360:NH\324m\022\374qtB\335\350\373B]&\236\356M5'E\231 \033\236\nUS[\303\223Wm\252I\005\013"
+	.ascii	"2\003\3020\330\341\364\241jZ]\270'\306FP\r\\\001s\tPq^\327$\003"
+	.text
+	.section	.gnu.lto_dateTimeFormatLocalShort.30.edfeeceed7de37c1,"e",@progbits
+	.string	"(\265/\375`x"
+	.string	"\305\t"
+	.string	"\326\023F=0\307(\035\305I\230\333)\254[j\341\364\360\372\235}\0057H]]\017U\306z\232\303Z\375>\301(\327$\251\373d\354\36000\300\020\013A\230\235\255\034\270\300\242\352\222\330M\244L)4"
+	.string	"5"
+	.string	"1"
+	.string	"\226\303\355\b\226C\333\206\220\bY\364h\202\372J\304\344\202\355FNW\027=E\376\001\234\241\365*\035\020\220\032=\265\212\335u\236R$\267\336v\203m\215}\205?<\353\317`:\263\364\267o\004\226\200\"\266\213\212)\330\002\220@\212\355\220}\261\255\361\003A&\323\276\312WBg\201\374`W\365\032\260\033\037\354\260\035:>!:\3625\365\006L\013\274qW\267\355\206L\370\255\007\360|\224Cw|\371\323\241\377Y\016\257\021',R\306\354XJ-\261\237\355\356ZU\266\323\332c \214\314\360\270Po4\234\256\003\342<^\327y\033\316\323\261\350\270\315\347\3434\013\36688\037\016\344y\037\356\022I\267\246\030\222\226l\220\231\247B\315\324\326\350\344O\232bL\001\013"
+	.ascii	"2\003\3020\330\341\364\241jZ]\270'\306FP\r\\\001s\tPq^\327$\003"
+	.text
+	.section	.gnu.lto_dateTimeUTCToLocal.31.edfeeceed7de37c1,"e",@progbits
+	.string	"(\265/\375`\202"
+	.string	"\r\n"
+	.string	"\306\023G>0\2478\035\030\335\236i\355A\222b9\362_\201t\2641)a)\371c\350=\036`\337[\304\023\300\027g%\360\024\022\205\b \027\350\305A\206\266\376\207\303+U:\261\343\177\334d\313\224\0022"
+	.string	"3"
+	.string	"5"
+	.string	"\226O\217g\240|Z\276@\371th#\3708\262\017"
+	.string	"BR%\330\335L\212<\274\206\376Mn \226B\327J\305\356Z\305\322\307-o\373\301\266\205}\205\327\356\256\245\311~\352\237\037\377K\252U\325\257 \234\fP\034\330\365h-\330\325,Pb\373\230=\262$\256\366OG\205Om<a\327$\200\300\356x1D\230\252\234\362\2226\206\247\027\355\320!C\276Ty!\261\374]\245a\331\345\230\360O\016\300\343\223|\372\003\322\213 \312\347e\304h\200\202\224H[\3668R\031b?\234\327i8P\313l\264\355\333\034p^\247\341@-\263\201\037\314\033\206\363:0\343|\236\367m\031\247\323\274l\353x2L\203\277\f\256\223\201\337\327\311\260Q\364k\245\311\027\250\225H\216\034\r"
+	.ascii	"2\241-h`\342\342-\365\206<Xk\256\261\2550\0340\002\306\201a\001"
+	.ascii	"*4\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_dateTimeSplitFormatted.32.edfeeceed7de37c1,"e",@progbits
+	.string	"(\265/\375`\030\002\245\022"
+	.string	"\246\241yI\320\322(\035\220\341\200Qj\212!\242\312\337\031\013\354\030\2764P\262-7\243\022\002/\340\220\215K\344\312\313\004\354\330\016?Y\332\316m\244\273\203\032^p\205N~\346\017\005n@\353!W\313\216B\0160\"\215\220\275\345N)c"
+	.string	"`"
+	.string	"j"
+	.string	"Np:\365\370\002\336\351\351\004\274\323\022\0060\206}\324\251y\216\216\354\346\243\3261\334\034{\022\366\317\243s%\314\217\371\207\022e41&\275\0236\247\224GiI\227\023=|N\223\240\236\021(Q\303\\\033QR\2108#\367\270\313\026/b\272\234hs\371\235\324Z-gb\207\373t\3332\333\020l9!$\2745\373\266?\300\307\037"
+	.string	"x\241\377\2634\235Sz\245\264\374\355\276"
+	.string	"\027\222\217\035\017\216j\255\331\001\2513(\013\023\277\335~\n\037w{\275\322p"
+	.ascii	"g\262\035\035\265\216\nNmr:\275\rc\207\330\266\027\003\003\352"
+	.ascii	"\314\320\006\007;\276\344(\221\322>\320\203`.\364\272H\255\265"
+	.ascii	"\034R\255\343\2024\0202r\367Yk\255\036\311\347\202\364\303\217"
+	.ascii	"N\026\335\324`\320\271s\2774\333wy\276Q\006\327+\246\324\323"
+	.ascii	"C\256H\0313\036$\377\312\255\360\263\243A\021\223;\177\353\027"
+	.ascii	"Yx\241l\354\370/\336)\345I\362\t!#w\bV\3344M\027wy\273\307]\204"
+	.ascii	"\006\223\210\246\245\0333\362\307.1\331r\2738\366\030#\033\324"
+	.ascii	"\210\021.O\251XZ3\325BQ\231*\251V\013E\305Z\255\200N\031I\251"
+	.ascii	"XZa\313J\245Z\245\204-,(\2520\205u!\0349\340\225K\212\025\266"
+	.ascii	"V+V8\326o\315\037\272\004\035\020\321\221\347\303\274\343NA\347"
+	.ascii	"Ct4\177\230G\351\372Dfc%\276\3051\230\243\340\322\231\374v.\315"
+	.ascii	"*\276\033\001\307\2150\270N\273\033$/ \200\002\021Z\346\001\245"
+	.ascii	"\t\376:wj3\031\362\241\303\202\327\312\233q\275S+\234\266\376"
+	.ascii	"t\221\007\271\240\236\246c\203K\024\b\312\306\t\fA\231\267b\334"
+	.ascii	"-*r\237j\266B,\200\215*\021\213\027\302\326\005\317\236\315\026"
+	.ascii	"\033\370\354\271#\023\031VT\350e\216\310Q\202\023n\332\212\264"
+	.ascii	"\006\347\206m\340\273\264\320#\220\213{]\357\t"
+	.text
+	.section	.gnu.lto_rtcHasTime.33.edfeeceed7de37c1,"e",@progbits
+	.string	"(\265/\375 \367\275\006"
+	.string	"\322\314.4Pm\222\016$\243\252\022\252(\350\326\226\377,\3725\332\034\277\266\303\376\354\333\277[\206f\253`\232\305e\033QU\025\324\272\230U\022\3126s\350\260\255m\"SW\025\213u\311<\314eYW\3650\227\005\353UX\303\253\f|1X\260\227\271.\354Q\266,\216\020\t<\370\371j&E\304\202@>\315\250\206\346V\354\260q\325J\335\315\244T1 \302\343J\277u\034N|\247\304\321\357F\347\356$"
+	.string	"1\222\320\221\031*\225\244\b\365a\361s\236\362\001\002\347\254\033E\250\244\r\020\007I\346\366\220\324\254.\273\275\350\024\202\341\241\211:u"
+	.string	"\n\231\271\323D\017\035\373\027\374\006\277D\t"
+	.ascii	"2\001#8c\216#D\250@\\\023\037#\362\022\"\207;gj\347\023"
+	.text
+	.section	.gnu.lto_rtcGet.34.edfeeceed7de37c1,"e",@progbits
+	.string	"(\265/\375`\273"
+	.string	"\225\013"
+	.string	"\306\026QA0o\223\016\004^#%\211\017\326>\316\355\256\346CFOw\005\357?\272`\324s\227D\001\305\260\356\326\320\226\022\312\3541$\260iU\r\205Dan$j\314\3544K\306c\020]2\366\336R\246\024@"
+	.string	"<"
+	.string	"<"
+	.string	"\266\315\240\301\307\332\273\016\030\327 A\n1\331\355,\325\270\366\247\251\371\0026\320\037u\341\372\016p\031X\f\330D\017\301\211\021\322?\236\027\333(\023\200ew\235\245\315\302\ro\373\201m\005\366!\004+\034\250\330\3058\265\330\021h\202\303\366}\323A<\357\254\033H>\354n\345\261\253\303\333\037\273\262\235i\037\304;>\367\310N\331\3458J\354v\013\234\200:t\367\002\361\220:\201x\030O\377q\212\251\304T\202\"\305(O\354\207x\b\307\337p\205,_:\364\263x\370\364 \317\215\f.\243\003C(Ov'J\345`\377\355\356Z9\307{\374\360\245\237\323Ie\036L\002\235\373R\301\\\231\216\245\301\256\013\273X\232\214\204\313\272l8V\305\200\261\t\230\215\325\301\260\215Uu\241?\215\021HDD\210\244\257\305\324\013\265%\244\242\027 \241\332\030\205|)\352S\320O4\234F\25091\020"
+	.ascii	"_\b\b\303N\026n\025\361#\026\352\r{\r\325\026H=\021\227\367\020"
+	.ascii	" \327\250D!JPA7\257\"6u5\215AA\001"
+	.text
+	.section	.gnu.lto_rtcSet.35.edfeeceed7de37c1,"e",@progbits
+	.string	"(\265/\375`m"
+	.string	"\005\n"
+	.string	"f\224H?0\251\270p\304W\331U$\257\261\2225\0034\034\363\n)a\311@\351O+\337J\0320\361Ry\2545\312:X\2278\262\340_\021\305\300@A\270p/K\026\322\320\r\375`4D\210\224)\0056"
+	.string	"5"
+	.string	"7"
+	.string	"w\320\236mo\320\236\331v\205\005\350\360\243I\351(\003$"
+	.string	"\256\335\221S\324\303g\350\177\345\020(\016HZ\001L\241\247\002\306\356:ES\310\255\267\035a{\302\376%z\262\277\3725Mc\232V,\235\232\376\002\b\342Zp\361`\267\364\212\260\0072\002*\333\240\315`;\323~\312U\300\257@\277\354\236T\003vG\nKl\317<\006\bD\006\252WL\263\200\307\311(_NU=i\302\226vG'/\246f\214\2144d\237\365}\266\224\017\322\236]\265A\002\226\226"
+	.string	"\021Q\276\3541\224Zb\037\333\335u\236;\203\321t\033\017\307\361\272\316\313p\234\215F\307e\276\016\207y\260\307\241\3718\217\347}\234\307=\266z\362CmC\302\007\004\005\"\035\031S\237\365\226\217\237r\007\312\213\317\036\t"
+	.ascii	"P\213RF\214\325L\274<\203\225\032\355\314\204\226\256\001\310"
+	.ascii	"\016q^\327$\003"
+	.text
+	.section	.gnu.lto_rtcGetDateTime.36.edfeeceed7de37c1,"e",@progbits
+	.string	"(\265/\375`\323\002\005\025"
+	.string	"\026'\212I\3200\2511\302@O\212\247v=}\200\020\022}\206\025\233\207\243\275\206\343\264\007\"n\304\264V>\2002B&\r\331\027(\310\363\033\027?"
+	.string	"\344\304\020\371)L\301\266\221\265x\272\234\217\\\242@\302\256\276\263F\266\334R\246\024u"
+	.string	"m"
+	.string	"v"
+	.string	"\366\201\036Ds\241\231\203\334\273\003\226\270\327$\340\001\254[\233\0170\336\262\0362\336\3326\212\001\032\317n\376\344\334\247\206-\304\360^\223\254>\237}\264b\2453\277\346#\210\034\266JQu\b\026\3412\\\024\013\324\206<\037\270\232\3501ec\372yC\2538\262\323\341\370\300\331\210$IJ\266\003Oqp5JW)\367^\323\033\016\303\275\272\355\322\266\211]M\002\271 \r4Ze\2336\264\366\330\027\357\275\327u\347\216\025u\353B\27755]Q?dD\230\343\361i\252A\363\346TQ]%k\302\303\315\337\276/\342E1\037a\001\271\023\035\bs\237Et=\030;\306\037\372\317vY\346>[]S\016\350\336\353\222\261]\267\324\246\361O\273l\233\262_\013:-[\320\006\324\275:%\267.aQ\0322\356\275\007|\024\261\b>of\274\375\357\224w\241)\007$\244\321\252j\304\373q\262"
+	.ascii	"\350\253\255\366\213\205\376f\222Z\255q\255;7p\240\234X\261#"
+	.ascii	"\316\306\216\372\363\254\245!\032\036\364\276\237\245\210\256"
+	.ascii	"\367\233\017l\241@\177\353\250b\255\371\324\206*`\255=\276ll"
+	.ascii	"\325\003\017rJ\235R1f\334\320)\373$n$\363y\206\225\364\267r\274"
+	.ascii	"m\325\027\235\362r\273\261\307&P\277NX`-1\322\245\204\301\312"
+	.ascii	"\027\351\322\"\001F\276^`\310\023\021\227\025X^\310XY\276\220"
+	.ascii	".\223v\361\326\235\307 \025\321\221=R\202\340\220\350H\374g#"
+	.ascii	"\2558\325)\264jc\231x/\007\004\347A\240|c\355Q\241\340L+0\204"
+	.ascii	"\303\005_\212\022\276`p\245\250\247\241J\203\273@z\352\265\370"
+	.ascii	"\177v\360\244\017N\303_\345\301Y\250X$\247\236\360+\343\177\206"
+	.ascii	"\360\024+\037\0012 \200\002\021\272\253\007\227\f\375\252\360"
+	.ascii	"\216\210\257@\342\017m\240\243\311s\244\335-\3029\314\361\320"
+	.ascii	"\243\311\024[\016\357J\341f\r\372a\036\270>\354\261\225\034\241"
+	.ascii	"\306\215\033{\031X\203\347\211\365\"\274G\345\021\256y0:\177"
+	.ascii	"W\037\337\342H\310<\006\321\030%\300\007,\030J\367&\3530\213"
+	.ascii	"\235\267k(M\230\020\030\3516\357\0333\225\201\201\362\260|\036"
+	.ascii	"\236\264\314\036"
+	.text
+	.section	.gnu.lto_rtcSetDateTime.37.edfeeceed7de37c1,"e",@progbits
+	.string	"(\265/\375`\224"
+	.string	"\275\n"
+	.string	"\026\327N=0O\224\0163JS\027\245\200\205\f\301K\006\312\377\321\3362\223\232:{\013Y\353\241#o\264\026\373\b\257?H\262\366\327bIALX(\275\314\367\f#\346\236\205\331d\220\275\245L)="
+	.string	";"
+	.string	">"
+	.string	"#v=\0046P=\332\373\203z\254>\200z\264\355\004\n2\336\356m\350\034\364qL*v\275KA\337\236\233\177\322\241\b\243D\347\321<\0010\330]g\347\261p\353m\027\260}\300\376\202\206i\n\246cL\303\217~\205\351;\004`0\321\340b\267\363\261X\215\230\321\301\366}\020/a\356YC\230D\273kal\353\361v\306\266lg\332\367\360\017\231\217&<\300\356\007#?\321\245\210z\2454IT\bq\371\031j\324sZl\362\263\225~\tB\226\357\240\276tGh\305i\343\304\251\306U\252\332\022,\371\356\372\310\270\240AA5\266\307\245j\260\017ww\255\037\007\227\007i\f\022\311&\227\213\242e\231\206]\224\211\203\354\302*\226\013B\300Z\204H\345\272hZ\345\262l\333\333\034\256~\374\215:\351\025\nO\206\215\323F9S\352\213\370\005\346spD\022}\t\365\030\b"
+	.ascii	"<\033\303\236\205\203B\270\3023\034w\231\035T\320\314\253\210"
+	.ascii	"\246k>\001"
+	.text
+	.section	.gnu.lto_rtcGet.part.0.48.edfeeceed7de37c1,"e",@progbits
+	.string	"(\265/\375`&\001\215\r"
+	.string	"\246\232[B"
+	.string	"\221(\035sk\372u\024\255\177\240[i\323z{c"
+	.string	"\242c\204\013`\035^y\037\210i\022:\337\370\221\255'\264\362E\200\217\261/\375w\307\325gLL\007h['\032]\354t\377Z\275\367\2262\245H"
+	.string	"L"
+	.string	"F"
+	.string	"\231?\307w\300\277\314\t\300?\373.\006\t\021\235l\033$d\344\355\321\303\311WR\230\260bv#\366\247+\337\256\3516?M(\244\353W? \"F\212\253\205\242\3419\340\216Cdw\235\331p\277\333n`[\201\375\021\001\035\036\013\026\333\2071@\212\017P\252\027\252\226\255\020\027\200\274yXP\030.1*\337?q\026\350&\254)\256\226\335\005\335_\211\354\215=\2627\326|\024\375%\344\0217\303\311\232\366I\274\304\350/\241\013\330M\261\254\330\215\f\376\234 ~\353(:>\bG\b=?\004\377T;>p\270\246\336\344FI\276\254I[\233\2207]\277\272&D\215\023\r\031%%\245\252X\335\335j\312v\032>\376\017\246\035L+L\347K\037"
+	.string	"\002\027\001P\273'/\033\033\237\233\3631\222u>\030\211\226e\032\007#\351@\3100\216\207\002\366Q\300\232\204\021\017\366\3214\017\266\261\235w\253)\177u\007\256\0260*\362\337 T\f\266\241Z\244DK\252*\266\235\372\255\317Y\246\031\252\251N\177\001U\312\227\003\031"
+	.string	")opr\240\024T\220\266\212\201TP\201@"
+	.ascii	"y`\204+FLl\200R6~\311\006O\346\200Qf\2042\337\331\330\031Q\b"
+	.ascii	"\016\235\363\016\355\264Ps\030u\006\222\324\3005\357\277\266"
+	.ascii	"\214\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.edfeeceed7de37c1,"e",@progbits
+	.string	"(\265/\375`\026\002%\013"
+	.string	"\206\020@9@\255\322\001\017\036R\026\233e\277Z#*\241\246\326\265\276\231\357\233D4\370\026\224\245g\310\220\216aQ\207\026\354\355\354\210\266m\333\266F\002\033\260MH\366\203\354-\267L\001+"
+	.string	"2"
+	.string	"1"
+	.string	" \030\202x\365a\216\207\013\342\307\004\361\266\220\016\013\2175q\177\r\273c\231\377\273\006\301\376\370\371'\301P\331\335\315\341L\374\277\2305\025f.\360I\201M1\201K\bL:\340\321\003\312\t\207\001\213R\034B1(\276\342\0240M\374)\261\207\304\337\210\275\b6\210\210;\241\312\374/\352)%r."
+	.ascii	"\030\345\222T\266\\\007Niw\377\241\034\213Q\332 \347\3522\177"
+	.ascii	"\n\031m&\021c\030\230\277\213\346\212\240\301f0\031DlBu\r\003"
+	.ascii	"o}\233\315\252\210\262Ln\031Q\243\331Vf_\2528\215\334H\207\221"
+	.ascii	"\002\227}M\313\254\254\351\353\366\263i\274\325.<\274\271\231"
+	.ascii	"\320\333\271\035\250\272\201\013+ \300\002\031\243\335\f\354"
+	.ascii	"i\361\2472>\331\003\301]\006\017\354(!\310\261\037W\272\327\253"
+	.ascii	"cP\003\354Wd0\246\324-\030\235\0379\234\2351K7,\332\255/O\017"
+	.ascii	"\337\360\317\346\t\360\2210}\203\320\257\037Z\004z\370\306\377"
+	.ascii	"l\002\374F\222\002\242\345\f\207\314/\217\352\321Y\023@\025\022"
+	.ascii	"f\036P"
+	.text
+	.section	.gnu.lto_.refs.edfeeceed7de37c1,"e",@progbits
+	.string	"(\265/\375 Wu\002"
+	.string	"\364\003S"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\027"
+	.string	"\003\002"
+	.string	"\001\022"
+	.string	""
+	.string	"\001\031"
+	.string	""
+	.string	"\001)"
+	.string	"\001\006"
+	.string	"\007\003"
+	.string	"\001\f"
+	.string	"\r\001"
+	.string	"\001\016\017\021"
+	.string	"\007\001"
+	.string	"\001\022\023\001\007\005"
+	.string	"\001\024\025\003\027\002\r\002\030\002\026"
+	.string	"\005"
+	.ascii	"/!j\236\001\315\200\\\347*O"
+	.text
+	.section	.gnu.lto_.decls.edfeeceed7de37c1,"e",@progbits
+	.string	"(\265/\375`\037\037\265\213"
+	.ascii	"\272\336\2600P0\022\322I\007\256\277qt[v\332l\253t\304\177\314"
+	.ascii	"n\336\021s\277?\006\224\310\335%?\261\371\026h\244\210\021\204"
+	.ascii	"vl\321g\033\267.\247Y\177\356\340\030\242\252)\021\305\334\235"
+	.ascii	"&\210!f\364\255\264\r\232Yb\246\327\335\177\177I\021K\266\224"
+	.ascii	")\200\002\370\002\023\003\3509\314\317z\274\307`l\232\376\302"
+	.ascii	"\240\032=\203\371\271\217\277\360\0337\007\340\031\323\265\243"
+	.ascii	"\252Q\376\341\013:{\tR\321]\031i4\207}\322\364\342\261O\312]"
+	.ascii	"\202\316B\370\244K\346zy80\002\244I\243\226\313\t5\371\306&\326"
+	.ascii	"\350\317[8\257\203@\362\305\243Q\274\037\006s\352\3715z\236R"
+	.ascii	"\317Q\3308m\347\330s\221\\\240\272\310\250p\332\216\275\327\307"
+	.ascii	"\263Km-J,\216\337\354\332\246>\231QI\231b\223\2265\243\002\226"
+	.ascii	"\343*\374\306xZ\037\210\005\372\361\372\007\375\024\\\300r\\"
+	.ascii	"\306iv\355\272H.V\030\310S\223\346\004\360\336\265\216\347\330"
+	.ascii	"\216\2650\035\337q\026v\262\034_9\3031\226\367zo\362\336\013"
+	.ascii	"\301\217%\202\314\315\257\007\275\013\365m\\\"\305\231A\3456"
+	.ascii	"\266\302\316\023\354v\036c\262\007\233\326\273\266\221\3005\263"
+	.ascii	"F\317\202z>\221\332\347\223O\244?A\375\b\352AP\1778P\023\340"
+	.ascii	"\022\351-P\201\270D\312P\330\214\235\0070\332)\270\340\366\b"
+	.ascii	"\345\212\335\273\362\350\254\t[\223\246\321G\240\236\317\016"
+	.ascii	"\300\226{\301q\324\363\001)?\371\200\364\255N\300%\322\036.\221"
+	.ascii	"6?\371\331\t\213\035`\2255\232W\355\336\225\004\317\nD\024\220"
+	.ascii	"F\277r\211Te\2374\204\031{m9\020\3607\0274\272\241\226\237A\310"
+	.ascii	"\202\363\367S\377|\304\337kCd4\354\374\315\344\347\016\346"
+	.string	"d\260\371\333\213\310\203\177_\271\245\177S\375,\007\345\3478,<\001\334\317+\256\374\374\366\363s\233]\340\357\036~\216@\n/\300\326C\274\274\236\277\213\036\370\233\006v \312\377\271\333\375\317\362\377\356\177\335\177\271\323\360\377\304\177!\023\177\223\360?\360\347\244\315\371\031\311\317I~\356\372y\353g#?s\375\354\265\3663\363\347\"?k\251\375\347\371m\322\317'~\356\277Y\3709\355g\263\237\305~^\362\363\327\317N?\027\177\316\341\347\341\317,~V\372\371\206\237\215~\036\372\271\206\237i\370Y\206\237\205~^\341\347\023~&\341\347\020~\366\340g\f~\016\372Y\202\237\201~f\340g\002~6\361\037\357\347\001~\006\340g\235\237m\376\243\371o\300\377\007\376\227\371\217\366\337\355g\3733\372\177\315\1773\377\377\376\213\371?\304\3770\377\267\374\317\373/\366\337\202\377t\377\007x>\237\317?\310\367\3331\277"
+	.string	"+\002sA\314\220i\264\225\364\025wA+r\327h\177\351\230\331SNI\263\323\365w\344\350\205\213\253\223\330 \301LU\001v\275\223\264\022E\023\034gX\212\024\351\255f\372\035yo}\b\036\254\274\035a\215\266\221\276\nb\301\355y\361\237\316\036\232\246\327\231z\016\343\016\342\354 \255u\243D\357\356\374\3562\007\212\036\302\\F\374\302Z\210N\224\265@\266F\327\2346\037k9\310\324\267U\367x\373\270\217\316*a\2757\204\324LU\001^\346\022\350o\254w\326\337\210k"
+	.string	"N\\X\237\217Fo\346\306\005%rn\215v3\317\214\225\034x9VtmI~\360\025\364G\217\035r\215\276\247\324\377\347\3646-\357\2758\202\353]\"G\234\203\254\303\226\027\370\217^\333"
+	.ascii	"\337\275@\264\376T\257*M<:\201{\260{\217$\356z\227\3123\254\243"
+	.ascii	"\322\271E\212\304z\257\006\270g@\256r\305\222B\233\267\357z\371"
+	.ascii	"&\261\244rP\256\315\245rm\036{n\262y\274w\225\352Q\2525\035Y"
+	.ascii	"y\206%\245<kJ\221\270\311{\274gMWj\262)\245\254kJ\365(\317\232"
+	.ascii	"\244\224I,)\022?\264\206\244\231\201\006\312\023\316S&\257\215"
+	.ascii	"(\253\246e\017\236rm^\276{YM\306].p\257Us\311\327\264\203\333"
+	.ascii	"\220x6\220R\232\232l\"\n\231\325\274I<\345W\363\336/$\322\215"
+	.ascii	"\262\340\270\342]\"\214w\004buk\310\270\227\200\250{\217|\361"
+	.ascii	"\356\275\307{\257\315\322j\275\267\252G\331\025\025u/\363'\352"
+	.ascii	"Z\035\255\310\270\267\325\372\332\244\224gY\315 +hg]\367i=r\327"
+	.ascii	"\345\303Z\252g\307\262[\243\214\332%5E\246\321uE\303\345F\021"
+	.ascii	"\2156\325\217\016]\024)7O}3\377\006\242wt\230\252\261\"\2152"
+	.ascii	"\0029\202\336:v\302\216=\2204z@O\375-\3258\032iC\216\225V\340"
+	.ascii	"\217F\333\217K\244)n\004\275\227\367\321\361\352\203:kT\002\366"
+	.ascii	"I\233FC\261\363p]\343\035\305Q~\223\\\357\031\221\270#\221FQ"
+	.ascii	"\236Sw\260\201K[\331\375\3243\336\312\2261\"\331J\364\336&f\005"
+	.ascii	"v\230\025\b\302m5\231\275\251\177;%ux\240a\201qv\262\221\",\341"
+	.ascii	"\361\245\321>v\323\033\331\3676\322\202\346\275M\215\344Qso\023"
+	.ascii	"\017\263\002\314\n\240M\262\270\242\244\350\231\3123\020\205"
+	.ascii	".zh\032}\005\201\\\004\247\331\t\336\333\324\322u\357]\303N\016"
+	.ascii	"d5\353\217\312t\373\022\004E\317e*\003\362\031v\232`4LF\013)"
+	.ascii	"\025\246\372p/\233H\371\371d\023\351YK\375\231\b\0236L\254\374"
+	.ascii	"\020b\206\377\210\340J{6\312c\230\f;_\307e\216\352\321\310\262"
+	.ascii	"\362\241\376p\237\374:\277\327\241qJ\312\216b\344R/\264\272\035"
+	.ascii	"C\204\t\3768s\242\322\001w]\\6\b\233\304\"\261Gl"
+	.string	"\027;\355\226m\336N\331\034\377Y\317dv\313Z\331\371\335\273B\360\003A\216\236\031.\274\035t\307\303\030\200T\2260\326G\304bY-\306c\256\027G\316\224\2562UE\254\021vZ\"\377Y\357U\203\300\204N\032/\200c\251\226\0352\242\215\006\217\247F\255\2203:( T@\330i\203\360<\005\021\210\244Q\233\3650\350\214#\r\250\303\351\260\342\304\256\321\247@\250O\227\352S\244\365\241\n\341\327\343.P}\360\214\372\340\237\372 \030\365\301=\365\267T\226\031<\313\362wg\231i\\\354j \271\250=\354\223&\300>i\003\261OjoX)\213l\322&\204m\231B\021-l\215\242\326F\323quEEu \037\222\265\262\032l\317?\252F-\224*#\bw\002\247\007\225\037<\032\275\205\372\233\bK\203\207g \037\227H\2552\350vF\316\035\026?\262FG\224\231\271M\232\261N]\266.c"
+	.ascii	"\264B\321I\256\"\310\326\037\236&=#O\215\332k\233,\362\277\271"
+	.ascii	"y\253\301\305*L\275=jm\331R\322h\257y?\377\033\033\261er\355"
+	.ascii	"K}\253\351\300\377\306\006\326\275\315h\364\301#\352\373\207"
+	.ascii	"/WhT\031\301\036'n\372\240\2041\322\350\033\315\337\200}\246"
+	.ascii	"\006\017\246\230F\277CD\320\273\210\346R\243\243kT'\330T\246"
+	.ascii	"\314S}\332\242u\313\214\031\323I\370\336/7\\K\036{]\304\210i"
+	.ascii	"3\266C\340\214\227\235\035\0300\035\346\346.\311\246\252\300"
+	.ascii	"\254\332\0302r\215v\230\233$^Y5\334\364\364\272o\210Vz\306im"
+	.ascii	"zy\3671\02152\242\032m\276N\246oL\200\240k\264\367\332\t\007"
+	.ascii	"\b\262\n\227vb\222&G\346$/\257\273\244\361\340\301\363\ns\325"
+	.ascii	"hw\321q\312\362\232j\264\267\364U\316\230\020"
+	.string	"Y\264\240ZZ\264\330\230\252\002\334\331szi\364\350\r;g\333u\025\332\264\336e\312\034\202\211\002\247\tP\256-\220\216\256\347\230y\355\336\214\251*0\235\271!G\202xQ\261`\3519\365\006Q\243\0169C\304\206\334{.\370\025gC\252\321\216\353$\0300\033_qnn}\305)\006\007\b\0315po\357+\374\206\332!\261C\243B\245\333"
+	.ascii	"\270M\264 }~93\262<\331Q\345\335fC\245\033\263\272\372R\327\326"
+	.ascii	"ZJ*\204\235\025\020\372\005K\217#lo):\312\210Di\033?\362\212"
+	.ascii	"\200\275\241d^L!Z\352\333\311\235\346\3544\376\373Y/\016\241"
+	.ascii	"\272\345Eq\333T\317\374\227\256}\266\266Yz/\257\315\033\313\262"
+	.ascii	"\2626S\217<D\n\023\310\306\tOl\n\224\267\031\032\3474\204\315"
+	.ascii	"L\036\224 \352\032\275\245Ro\241\302\302zLu\262\361\344=\306"
+	.ascii	"\246\fl\322h\213u\222\307\007\031\272'\215\266\223\276B\362\364"
+	.ascii	"\327\204\323\344,\001\324#\243\034A\003\307\233\0175^^\315\344"
+	.ascii	"\271\344\315$/`\020\271\020\2268R\221(\324!\211h"
+	.string	"D\200q\250\210\202z\244\024\005\2700.%\021\231\212CL.\2149GJq\202\220\t-T\030\205GD\"c\0028\024\r_\260\020\022\207,xb0\rY\360\030\217\224\342\210I\305\021\223O\321\022\214\021\214\302b\316\222\213\016\026\207F\030\207\226\216\230\202KGLV\310CR\021-\026\205D##\"\233\030L\303\"\224hd\262\327\211A4\026\223\216\204-\f\371\030\t\227\216\222^\020\331\030\t\2130\320\245a\222\221\310HdD\034:bJ\2613$4\022\275`R\022\n\031\205Ea\013GL\004\264\3301\n[\024\211J(2\022q\214\204Fc\322\013\246\026\002\f\205X\b\271`$\016\221Z\374(\t\215\305\030-H\274 *\032\236\340\303B\310\005\024zZ\030\205$\bq B!\307Hh$\022\031\2136\351\004)\214D\"\246\024F!\tEF\242\216\221H\2118\034aG\005$c\022\fF"
+	.ascii	"\030%\275 z\241hB\221\221\b@\bC!\022\305\030DF\350\213Z\030\n"
+	.ascii	"\221xQ\022Q\270$<Ro\301\n\tVd\260\203\3153\330`\202\r&H\237\301"
+	.ascii	"\006AA\033\254\bR\277\"\310\032)\250\340\305p\b\302P\220H\204"
+	.ascii	"T\204\026\207\216\222\\,\rY\214\260A\301(,\272p1\034\342\301"
+	.ascii	"\330c,2\022o\2148G2\361!\223\220\250\3028\034\022U\344\024\223"
+	.ascii	"^\274HRJ\213CB\245$"
+	.string	"!\241\221\310h(\3078\264\"H%\022\tc\240H\306\245\241R0\006\221\221-\022a\f\221\202E\241\021\306R\222\222\215q(\003\343R\022\f\233k\240\001\213\004\\H\201\004\265(\205P)\311\250bi\250\2444,R\261\224D\244\244\242\210XT\221\342\247h\2644,\022\026m\352l\232\245\253\242\204\t\235\031\217\331\352\203J\226\2616\031Z\316\271\236\312i\"\267\366\344\230L\177O\372\342\254\231\335c\302\327\205%\211X]\330\030\\3\371Z\363V\325\250u\263o\267Wn\257\264\275b\237\317\364I\227\264\024\265T,\025\333\246\036\263\346l\225\333\266\217\200R\316\315\325M\331Jq|\001L#%\313B9\323b\205M\013'\214\314\026\323F\351*\344]\216\347\232S/i\"D\223\343lZ\232\326\266\006\007:\004\315\223>\233f\321\316P5\003\235FA\322\256\200\251\037\263c\326\214\241\334\033\001<\271h"
+	.ascii	"\001\357e\002Y5\035XO\013\345\326\354p3\300\334\322\032\265e"
+	.ascii	"\235<\030T\2242\215\336\256b\\{w\275\222\3618\311!\344\310*v"
+	.ascii	"c%\215\022\035\215\336f\tvvZ0+\366\201\332m\222\002\212\273E"
+	.ascii	"\214\001\336\245\034\n\022[xL\032\265a\266\t;\201\254\223\033"
+	.ascii	"\2752=\324\364\3243P\312\003\224>\305\262\304.\351\271I\244\224"
+	.string	"6\036\034Rm)\232}\272\305\301N\373d\277~\312\326c\316\335\020if\24685\352\265&m\240\250\330\324\302\324\263\330\016K\305\007D\225e\212i\351a\177,\251\263:\256,\021\306c\366\334$\0250~b[\226\207e\356\034I\334\013$\202\251\250\222\3310\207\362\224R\b\221\214\210H\222&\035\202\n\020\004ci\244\350\320\003\022\200\0055\222*\310FFA\222\202\244\3764\007s\t\356\305`\367\234A\362:\277\371\261rt\027L\224\037\241\rR$\230\302\310 *\260\210SC\356\370\003\274Oceg?\304D\340\024v~\343\274\344\364[\255\b8\256\230\034\006\345\200\304\237\316\346\350~G\321,\212\333\361\340\220B\316\360\024\324~0\366Z\342\315y\244\331\206u\215\343\267U\346\265\316s\345\341\241\005\336\f(\034\204uu\303\244\230\346+\276\300}|@\023\030\352\200\243HT`\017\300u\261\367w3"
+	.string	"\345-\f\241R\030\263\207=\021\270yR\200\023\003'\346+i\034A\362\304)_\216\322+\3465\301?\230\\\207\332\346?\266\254p\314"
+	.string	"\242\246\t\377>R~\335\214\277\322\271\353\334\221i'ch=\220\270<R@1\265\017\303\216\020\336\207 \302\004bA\r\256\305z\262\0318\331|%5X\036\363\336\017\361"
+	.ascii	"\037\344VV0\037\335\177J\024y\304\2148\250pR\204\351\341a\006"
+	.ascii	"/\272]"
+	.string	"\262\367\r8$\224\235x\342q\035\177\353\347\301\376y?\315\024F\332\222\344_\235\034q\336>\033@A\314\275A\212\315\333\276:\253\277\265Kp\271\265wpB\032\351\201\332\007\025\233\202\206\302\335\241kc\303Q\213\0264\226\264\352)\201\320\n\305\320@\354Wj\017\324\030F\013X\240O\021\271\270\277\273`\353\230\370\257\331\345)\352\244\370.\246\021\302\375\266\342\rcb6\357\245:\230\307\032`\374\371]D(\250u\370\313\221M\266L\201_\262]\007$6\261\233E\250\023\275\274lX\325]+\f\276\232\020\007e\366\334\024\320\251\b\r\220\245\373j\221\267\272\004\267\020`\263\255\355v\033D\317\2334\342\314\322\314\022\325o\347:I>\336\370,33\251\243X\223\317\224a\371E\242\363G@It\264\260\254P\022\206\372&\214'y\205\232\031\341\002r\364\022\355<n\247\340\320\246\274\021\3222\242\322\003\372?"
+	.string	"\240\036\200\242\206\257\300\223_\377\305\336J\022\3408\322m\224 \366\023\221\265\266\036\227\241RDC[*:\367\255\205\262\216\034%\004\277\247,%\023\226\301\032\210)\314@\016\005I\376\024;\r\316\272\033\fiT\217\306\376\001\322\251O\256\216\276\234\320\020\256\037\352=tfG )\026\207\177,\301\311\020\241\212\223\204\177k\274n\362\372\246\251\366\005?)\022h(\f\315\236C=\371\005M|\335\270,\333\037k9\204\036\377\211?\033\2217\300YEp\261\005\2371\211b\306\020\205\030\024\032\310\240w\005\210\177\263U\022\343\324\370\3210:\375aD\241\200!\243\034}uF=p\275\312\227\207p\277\024\300Kg"
+	.ascii	"\370F\350\030f6?\357l\3628e\317W}\336OV\207\013Dn\007\375\261"
+	.ascii	"h\2415\213\"\232\302j\t\036\261-\343}\266\200\022\221t\261\030"
+	.ascii	"y?N\316\363\033\321,\274 x\332\r\f\363Y\274\261\205zm\233t\251"
+	.ascii	"1\237i5*U\355DP\023\314$!\305\244\034\304+\004\260\266\204^\207"
+	.ascii	"\260M-\276\225\223\216\313\211\256\252\207+\336\201*\332n\232"
+	.ascii	"\331"
+	.string	"d\273\017\3330\314\234\225\314\244h\314\236\r\037\3000\325P<\312\214[\220,\204\033AY\rH\021ET\267\2527%\252/K\310O\016\345:\264E\375\013'\250K\002\362-\023\314D\277\346\277K@rG\314\325u \353\033i\341aZ\304nhA\323\341\210:8\205\021$\277&\350\036)\245\211K\203\276\273\254\360\017\023\200\253\007\005\235\2303\376\270=/Lc\013\373_7\317\264\356\366*$M\006w\021r@\335\377\f\301\244u\335V\267,9\233\273\344\304\203PYP\023\263\275\245"
+	.string	"\025B\375\3728B\266\233\237>\355\b\031\364\341{`+w\240\3364\275\"\342\274\253`\372\324I*\350\220 +\t\3705?\303\370\306'\272\305\256^t\344\265Q\017;\236\300\253\340\022}\027\337y1$\274X\332\253\006\365\002\342\205!k\240\352\352\360\021\314\034\017l\3202\235\376\226^\205q\317\242!\314w\232X\331\177\276\337\345\316\303<p\273a\276\260l_\376\373\251\336\265\276\216(\217\377\303U7\b\335\017\353A\263\273\337r\3233\274X.\330D\202\303\362)\325\333\203\277\230a\363[\340\177\023.\235\222#\r\243[G\202\377\224\365\307\333\347\277\023u\226$\373\371D\237?\275!\374\337\327x\306\373\2655\344J\275\323zs\366\027 \377\216\007\f\370\340W"
+	.ascii	"\317CsD\251S\270\033\224;\332\b\364\034\374\215\035\220\037\212"
+	.ascii	"\217\3449zo\330\305\333\002N\023\326?\267n\245t\0169~\234\342"
+	.ascii	"\273\f8\361\007\356\277\345\f\227\257\336y&f\2635\275\231{\303"
+	.ascii	"?\374\352\035\3222\253\360T\372\207\337\302\254\020\206\256\370"
+	.ascii	";\224?\301\f\344/:\317\375\200{\310\032\263\344B\003\352E\237"
+	.ascii	"\221|\350@]\313\211\2170\253V"
+	.text
+	.section	.gnu.lto_.symtab.edfeeceed7de37c1,"e",@progbits
+	.string	"rtcTimeMake"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\001"
+	.string	""
+	.string	"rtcTimeGetSeconds"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\001"
+	.string	""
+	.string	"rtcTimeGetMillis"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\001"
+	.string	""
+	.string	"dateTimeFormatUTC"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\001"
+	.string	""
+	.string	"dateTimeFormatLocal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\001"
+	.string	""
+	.string	"timeConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\001"
+	.string	""
+	.string	"dateTimeFormatLocalShort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\001"
+	.string	""
+	.string	"dateTimeUTCToLocal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\001"
+	.string	""
+	.string	"dateTimeSplitFormatted"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\001"
+	.string	""
+	.string	"rtcHasTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\001"
+	.string	""
+	.string	"rtcGet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\001"
+	.string	""
+	.string	"rtcSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\001"
+	.string	""
+	.string	"rtcGetDateTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\001"
+	.string	""
+	.string	"rtcSetDateTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\001"
+	.string	""
+	.string	"pgResetTemplate_timeConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\001"
+	.string	""
+	.string	"timeConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\001"
+	.string	""
+	.string	"timeConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\001"
+	.string	""
+	.string	"tfp_sprintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\001"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.edfeeceed7de37c1,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,695 @@
+	.file	"typeconversion.c"
+	.section	.gnu.lto_.profile.dde54e048c27d5fc,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.dde54e048c27d5fc,"e",@progbits
+	.string	"(\265/\375 \354\r\004"
+	.string	"\264\005\340"
+	.string	"\n"
+	.string	"\232\317\241\374\t\002\002"
+	.string	"\002"
+	.string	"\001\201\351\223\225\002\004\364\223\222\365\n\006"
+	.string	"\002"
+	.string	"\003\303\224\212\270\b\004\004\344\300\270\257\t\006\005\251\243\200\233\007"
+	.string	"\006\331\327\376\320\001\b\002\001\002\001\002\003\002\003\007\221\334\215\370\004\n\b\376\242\274\376\b\030\002\004\t\241\221\303\212\f\f\002"
+	.string	"\020"
+	.string	"\270\3129\211\240\002\3301 \030q\260\001\025\026W\f\304Y"
+	.ascii	"k\0011\200 \231U\271\003]l\330@\033"
+	.text
+	.section	.gnu.lto_.ipa_sra.dde54e048c27d5fc,"e",@progbits
+	.string	"(\265/\375 \274\225\002"
+	.string	"\364\002\260"
+	.string	"\n"
+	.string	"\003"
+	.string	"\003"
+	.string	""
+	.string	"\001\004"
+	.string	"\001\002\002"
+	.string	"\001\003\004\005\001\003\006\004\003\007"
+	.string	""
+	.string	"\b\002\003"
+	.string	"\001"
+	.string	"\001"
+	.string	"\003\001\001\t\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\017"
+	.ascii	"T\331\200{\273\t]\005\002\004Q\003B\220\003\250\001\002\202\215"
+	.ascii	"\005\345\033\3102\350\005\030\262\001,"
+	.text
+	.section	.gnu.lto_.inline.dde54e048c27d5fc,"e",@progbits
+	.string	"(\265/\375`\276\003\005\023"
+	.string	"\226\036gC\020\221\324\0307oW81r\005g\027\343\270\256\254\352Uh\016\310\037J\255\271\264\355rBk^\373\0075\304\b\214\304H\366\023\361\320"
+	.string	"\300 \024("
+	.string	"\200\006\t\246\353\271\254l\024\211]I\331\244L)\005U"
+	.string	"Q"
+	.string	"W"
+	.string	"\375\214\013\025\213\216N;\267\333\305\316\027\36447H\324\006\364\\M\177P\203E\006Oo%V\003\243#\272M\340\370\006\177\365\351y\220\t\241\"\240.\211\365\332\2028"
+	.string	"Zr\b1ZZ\236\276\217\355\310\347\234\023\276\267\345\334}]\362V]\312K\250\365\024~\b\"\237\3052\270\304J\317J\221wc\206\214M\254gG\036Jl\035\3149QZy\327.\243\342\b\030\025\216_l\021\226O\325+\214\212\335\376\261\375\344\335\214\212\362\250\306\332\364\0164\"\264B\345\024\312\277\036\366\020\304\205\034\224\205\245\267B\203\231xe.W\316\364\026\257\030\031\250#\321v\006\241Z\255\226\303\247X\317?<?y\r\370\024\343S\2176-\255\024\036\355\204\270\357)\310\326\3447\260N\205"
+	.string	"\266\257\277\355\332\3448`\235\252@\243ga\351]\nL\314+9\016\344\241\220\255d\037\225\236\213\205\t\252W\212D\001m{!6\243y\365\366\235\216!6\243\365D\267\326\365k\223X.\211e\022+"
+	.string	"\364C\316RA\303\213\312\327\313\225\344\275\346\234 \323\333"
+	.string	"\342f\346\300\347\206\371s\224\n\217\317S}}\n^\215\204U\327\022\004\244\344\344\310%I\236\f\0166hB\275\354\245+S\250\341<f\020\031\242\tfd\0244-\034`\002!&U<\022\300\224U\203,\223\210h\371]v\261v\317\263\362\373\242j\035FN/$\007\357[K\324\266\275\342c\022\rPI\313\027j\264Q\251\335D]\031\205\003\314\314\2009\241\035\226\265u\254f\302*O\306S\252\245:\243\nJ\343\236(\307G;\340\327'.\177q\226\334\360\307\324\215\036"
+	.string	"\353\006\236(M\364\031\342\210;\n\217B\211(kp!/\214\255\202_j\345\252gz\tR\314hU@t/\0323\030\275\3558\307W\t\001\361\240\3151<\036\265\316)'\224\213\274u\315\037F\334i\366\332\255\274\351,\211\2043\337\245\363'"
+	.ascii	"\006"
+	.text
+	.section	.gnu.lto_.jmpfuncs.dde54e048c27d5fc,"e",@progbits
+	.string	"(\265/\375`E\002\035\t"
+	.string	"\342\215&'\200)I\0073\260\314\210\327\f\21700\003\317u\025\\P\031x\234X\367\267f\035\003*\300\242\330,i\273m\"\223\f<(\273H\222\222\302\fl"
+	.string	"\365\b\240>q\021n\260\021\352\263\252'\236\266\262\235\025V\006\344p\301\271y\211\373W\305\036"
+	.string	":\342!\356\313\335\260oXOx\241\212a\030f\305~\270#\004\313Q\214+\326\217\031r\356!C\275\363G\035\207=\244\307\370\226=\013\350\235\376\353^\221\327\277\"#\245\224\256\206W3iG\217\275\243\267\374\207\t\017y\024\002< `\"1\254\352\257\222\b\244wx\263\300*t\n"
+	.string	"#\001H\006\337\322"
+	.ascii	"\332\251\371\205\002\240\321\335F\2113\034hV\333\253)!\354\345"
+	.ascii	"\201\006D/:\206V:\230\275\227\306\234\n(!\200\023\007$\344\202"
+	.ascii	"!\202\203\361\027\224d\325\006Ea\365\330\002\002\357\211\326"
+	.ascii	"\226\025N6P\356\206\274\315\005\261[\032\260\332\301\303\301"
+	.ascii	"\"\336\026\327\261\317\215}\352\032\221\023\305\355\020\037\267"
+	.ascii	"0\242\005\026\257i\206v-\362\206[\004"
+	.text
+	.section	.gnu.lto_.pureconst.dde54e048c27d5fc,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\037"
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"\232\004\001\232\004\002\232\004\003\232\004\004\232\004\005"
+	.ascii	"\200\004\006\232\004\007\232\004\b\232\004\t\265\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.dde54e048c27d5fc,"e",@progbits
+	.string	"(\265/\375 \335\235\004"
+	.string	"\222\307\033&\220+\215\001+\007\034H\254\253w\325=D\037N\214\347S\215{q\235\r\006Q2\3164<\365$v\373\357-e\noB*"
+	.string	"\216\\tX\267\n\311\265\365\025\023\"\304I=\215\243\0019\235\205 \363\370\274\310ds10$\020\212\347a\246O\270\006\232\276\373\251r\246\307\343g\346\252\331<#^l\251U\225Af\371\225\177\016=\370+\001\r"
+	.ascii	"+\001\351\253yU\205\021S\b\215\353\334\205\245Ua\200;\240:\203"
+	.ascii	"\271\363\314L\240a\f\024\001"
+	.text
+	.section	.gnu.lto_.lto.dde54e048c27d5fc,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_uli2a.2.dde54e048c27d5fc,"e",@progbits
+	.string	"(\265/\375`\334\003\005\033"
+	.string	"\3661\255I\260XQ:\320\325\023\212\t`\221\241<\353\320\272R\205M\225!\344\020\0241D\305k\320EGp(u^\330\276\332t-\025\333&n8\374?\350?h\\"
+	.string	"\317\206#\326\342#\341t\315\322\207\020\376'\031\204\020B\322N2\234"
+	.string	"\221"
+	.string	"\223"
+	.string	"\033Sk\214*\016J\213\004B\323]\003q\220\232{\273\304\255Zw=\247Z}\t\266Aiq}v\215\026K\003\030-nmWJ"
+	.ascii	"\320\312G\020\221/\265\326\327i\354\271\341k^\235fI\216\254\360"
+	.ascii	"\264\266v!\021\322\221\360\312\005\216\236\344\204\031D-l\026"
+	.ascii	"\210AT\344r\305\216\241\"JF\031*\n\t4\005\321\321\266\026f\205"
+	.ascii	"$\320\t#G\031z\021B\bR=\031h\232\323\335h\250#\205o\240\r\034"
+	.ascii	"M\t\351R\230\222\023j\255K\205tD^\031\357\256\222\335\265\260"
+	.ascii	"{\035\001Q@\272\237\267\353#A!\324\bR\355w\2738765\036b\0070"
+	.ascii	"\223\327\345%\233\306Iv\313={F\244+\303\362\317\273:\335\363"
+	.ascii	"\232^\362\306\214tK\221.)\322\035MW4\335\320to\272\324t=\340"
+	.ascii	"T\001 \252\326\023U`\352\023\361)\207\231\354\237wmd\335\304"
+	.ascii	"\264PH@\252Z\253Ni\321\006\356\271\273\277\234\260\376*$\371"
+	.ascii	"AU\253\017\201\305\245PZ\\\022!`\246\376(\231\220\360!\013\025"
+	.ascii	"t\252\265&\330\b\324g!5'\345\004v\3520\243Up\254E\214\026\315"
+	.ascii	"Dh\013\371\362\364\b\003\237\257\271\211\340x\310|<y\343`\210"
+	.ascii	"\037\357\022\205y^\270Z\272@\331\225\337!p\200\353\\\371\241"
+	.ascii	"A[\n\226\244\037y\336\306x\241F\327\251\221\033JM\304\273\356"
+	.ascii	",\341\315\213\254\207w\223\017pA\022\024\3066\236\267f}\267#"
+	.ascii	"\025\251\343\334,\322\243v\316\270z\356\247\327q\362C\203\333"
+	.ascii	"\372O\247\3703\2477\016iu_\274M\005\205\261\205\265\326\032n"
+	.ascii	"\353\253\343\374G^p;n\264\352E\002>\0344\\\2037d\2400\032\335"
+	.ascii	"\231a\310\020\362\320b_\230\202\230\314\303\254g'DL\006\333\001"
+	.ascii	"1\302\347\025\223\361\360\310`\257\230\007\f</X\317\354\245\300"
+	.ascii	"\300\312@"
+	.string	"\354\364\274|d\262\236\327\351\253\016\317\3631\317\211GOl\277\355z6\256\235>\260\300\321\203\213\215V\255\316[+R\346\315\352,\013%\214\314\032\232\237\317\271\311\027l41m\276!k\346\346s\316\031Y7\320\255-2\224\316\363\226\222\017L\033\351\270\300\264\321\264aTn\224i\243\314s\254\337\374<\274\340\220n6\177\222)\334S\371\rP\25010\202\214d\314($3\301hS\230\306p\002\241\302\352\006\020pW\242\244\003*\237\227\"\004\025\340\267\346\026O\300\310\325\260\211\270C\245/^\361\275Z\220\255\3044\367\332[\026\340!S\017\177\367\022:`\261\216\365\037'|\376X\032J\270\003\"q\337\375\344\377c\342\"]c8\337\267\006\222\303\367 \2150\2768\333\365\t\341\023\240\240.\017\313\254\316j\370\271V\020\321\317`\235\365>\350b \b\352\225\022\026\273\211u W)\234\336\221\007\321\226"
+	.ascii	"D:\365\265\271\326x6\375\236\350/\324\220\322\245\247\267\216"
+	.ascii	"\240\177"
+	.text
+	.section	.gnu.lto_li2a.3.dde54e048c27d5fc,"e",@progbits
+	.string	"(\265/\375`\376\004\345\037"
+	.string	"f9\306I\240TN:\305\223V\330\340\037\202U\030s\351~\3677\353\356\234i\346"
+	.string	"\264c!\343\3340\352\227\365\022G\366\356$\004aQi\262yN\23289_\322\250\301\336\200\273\252w\310Q\243\376\377\277\257\326\310\262\221\220-wJ\001\263"
+	.string	"\245"
+	.string	"\257"
+	.string	"\nl\037m\350K\333\223(T\243\253V\"\216\021|\332\267\361\033\276KY\354*\265.\265\350\252\265\342\370\200\355\243\211w!?\332\316B~\264\317\036\213!\312\205\025Y1\251\265\362\226\205I\227\353{\256\304\335l:r\244;}~\022\230\321\320\303s&\224fy\322`\005R\211\343"
+	.string	"\244@\"\361\333\220#\022\324\246x"
+	.string	"OG#\246\355\277\022\327\321\023\242\020N\037rt\202&H++\276\213h\2221\222>\276\353\001d\220\031\r\223NE|\251"
+	.ascii	"!*\224\240\f\207\350\f\n1\021\237\372\024\016\201s\2364\250\265"
+	.ascii	"z\032\r\221n\224\333Vb\233\201M\261\002\273d\327\320\220\323"
+	.ascii	"321\3434\3148\3752N\273\334\353n\241\323,\327\272W\350\264\312"
+	.ascii	"\356[w\n\235F\241\323\272\334\271\356\362f;\361'/\365\217'\336"
+	.ascii	"{\251{\322\351\333\350V\270\024\2515\304Z\223\032d,\3028\327"
+	.ascii	"\357\365k\375[\247\366}\035\367\362\213.\263|\277:\227\337\345"
+	.ascii	"\034\276\240S\371;\316c\204*\267&Q\210<\272\005\225\264\302h"
+	.ascii	"U\332\325\241\035a4\350R\016\333\017\022\232\320(\373"
+	.string	"\225\237\205\345\257\250\254\262Z\353\002[\220\237\303\345G\277\3528\202nuC+\226\203\0365\312j%\016\370\350\267]\362\027\331\262S\307\013\226m\331/Q\331\225e\331\255\312\276x\001g6\335.\231,26\346\026w%E/\274\335a$\312\376\251\n\210n\277(\373`T\271\272\035\201dEj\264\326ZI\334o\310rs\213\026|\002\356\025\030\321p\\&\013\325\366F\356\256\360S\217\360blmk:\307\235+\264\347~)p\025\251\375\346\032\305\271\017\351\177\365\370\344\2144\371B\344\307\024#g\277\271f\003'\367\266k\265\026\204\002\3165\217k\333\375B\013\232\375\346\032\214\320\207\211]&1r\334S\241U\211\r\3154\233\b\234\313d?A\213\2642\007?\0320,\206g\2700w\200x\3269\004xz\033|zt:\360\364rt8\004\375\360xz;;\275\034\036\317\006\013;\274\234\036\037\036\201"
+	.string	"\356q\320\351\341\375\364z=\274\222\370;-c6e\205S\177\360\025\344\267@\273\302\210\246\031g\271e\362\2211\\M\271;\b \234p2\2731+|\361\021\\"
+	.ascii	"\301\321\254\251\356\273rC\356T\314TT!\031\232i\3452y\336"
+	.string	"\fv \022\347\302\311V\340@\344\313\301\276\333\232](\264`\024\220f\267\007Y\2608\263\376\327\004\037\277\351?\214\314`vf\347V\221Z\314\312\354\255\202P/\353\2620\373 \n\226u\331\027\251\375p\313t\"I\250\260\002j\250\201,\203\024C\2121\231@D\322\202$\035`\002\231\271\263:\020p7\263)T\032\003\377\330\327IF;=\002\0072W<d\n@\364AC\3007!\0346\2300\031V4\302L\243f\273\200\330\360I~L\300\232\341\2652\020RsQ \321\365\236\254U\211\266\002\001$\356\017uwY\017|\003K\215|\310AT0\261\006I\353\346\220U\344\321D\325\037\312i\206\227\376!<\026\260\013\245\352sv\231#\210\327N\353q\364\343\025\016\273t\302\216:\205\216o\246\261K]\350\304\353V\265\376L\220\237\355\311`\004\346g\017x\327\220p\232o;r\261\3456\337'\314\242"
+	.ascii	"/\313\007\3324*\350\217\271\273\266e5\266\240R!\302\344\210\346"
+	.ascii	"uJ\304\013h\372\001\\(\360\273GPU\314)\226\252\001"
+	.text
+	.section	.gnu.lto_ui2a.4.dde54e048c27d5fc,"e",@progbits
+	.string	"(\265/\375`\262\003\365\031"
+	.string	"\006p\245I\260\226Q:q\205\351L\343\n\263R\313N\341o\250\016t\\\307\221\237\276\365\277\324\271\363\373\236N\260u\227\302\264\232{EN8\272\353i\370\231A\377A\333k\037\305J\311\341\331\245\323\261\036\304\177\374/\371\204\020\262\345N)\222"
+	.string	"\206"
+	.string	"\215"
+	.string	"\f\306\203\376\264?\3434j\327\275\214\2525\205\f\244Zw\007\274`<(\340"
+	.string	"\302\203\364*\341A\327l$.\033\025\222\233!\247Z+lW8e\272\265\253R\344(\206+\272\263\346O\236&\234\033\210\253L\2243%JP\261S\342\344\200\024;=\037y~tz\246\bD\247\207\n8\272\231\341iJ|EE\233\034\027\007\242s\202:xbJz\321\247\355V3\251\017\211\357\213N F\017\347F\342S\224Pk\365\304\271\355\334(\267\275\303\266\005{\313=\233\333n\316\336\201\230\016X<1yq\266\213\345\272\273\265\242\362\240?\345F7\353D?\312w\377\352\272_E\247I\324y\367x\242[\274\356\016\301i\220NS:\275\237\236\237~"
+	.ascii	"\005BZ\277Zs~O\252\0170\351\305\215~\236\375\033\376\221\221"
+	.ascii	"\225\200|L\265V\n\343\301\277\310)\333\274\027\255\274\n:\234"
+	.ascii	"\230j\335\0318\350\t\366\326\370P\355D3g\325\212\363E\330\215"
+	.ascii	"3\310JF\220j\255\007\fa\267#\340\372H.2sH\013\177&<x\0368K\350"
+	.ascii	"\202;q(\270\270+\373\241\022\006\271\273t_\242\230\273\373q\004"
+	.ascii	"\2719j%N~\340\306\305\031x\312R \022b>\375A\212\004\361\304\315"
+	.ascii	"\031u+\205\254\235F?\241\036sY\373#7>\232\3713j\303\235\373\243"
+	.ascii	"\027hj*\201\302\315\371\253\3059L\242[\327\2229D\314\377\025"
+	.ascii	"\216k\363\367?BK!\346\223\307U\355\027\274\351\225@\264\326Z"
+	.ascii	"\251W;\256k7\306R\371S3\177k#1\0344\254\206o\3100c2S\006\203"
+	.ascii	"!\003m\221\231\255c\bf\264\0160/2\0173ZL\3462\023\003\233\321"
+	.ascii	"ZZh1\330\254\003\206\026X\354\005\006\206\200\200i.\262\027X"
+	.ascii	"\f\215\366\002K\355\352iJ\\\225\265\371\204\017\232\255\261/"
+	.ascii	"\023\372H\027nDNMhT\233\263\021\037\035\3112.\312B\216\217\\"
+	.ascii	"AYqm?\372\330\304\307\005\331Z\323\225j\303\265\375\025\242\366"
+	.ascii	"Eg1i\022Jm\316Sl\360\017\341\f\023\274\360\215\356\375CH\256"
+	.ascii	"\r\265,\313\200g\251\004\252i\355\003\236^\231\024M\250A$\242"
+	.ascii	"\fU\b!44\"2\232\246\003`\002!u\3269\020hX\242d8\003\020\360\026"
+	.ascii	"\310m(\002\223k\222AFn\322\340\2133\030\013\344syTD\357\353b"
+	.ascii	"\211\bR\023\001v\257\021\310Y\253'\350\341\375\212\201\253\365"
+	.ascii	"\306H\251\223\237\235\216\223u\307K\263\201\321\032\251\004\335"
+	.ascii	"\254V:\270\200.\357\212\024\021:\001\020\276\247\020\272\202"
+	.ascii	"\321b\366\365e\350;\202\235`\341\357Y\275H\232<\257\354\227B"
+	.ascii	"\3754\262\005@\211\236\234d\f\271x\356\367\324\325\026\365\227"
+	.ascii	"\263\265*\"\377\037U('}\177\353\b\363\007"
+	.text
+	.section	.gnu.lto_i2a.5.dde54e048c27d5fc,"e",@progbits
+	.string	"(\265/\375`\336\004\255\037"
+	.string	"\366y\310I\220VN:\001y\f\354\003&\201\223$\356C\367\013\351ol\344Y\003\3755\006\035]\257\305\213\210\265\220\245\332\275\035S\273\203\312\214|0#\022A<\213\003\257\336\274\364\211\370\333S$Z\204\331\356o\215l$\022B\344N)\264"
+	.string	"\247"
+	.string	"\262"
+	.ascii	"g\251\025\212\206W\255A\034+0O:h\236\332\257q\033\273\003\035"
+	.ascii	"\346Z\255)\236\274j\2558N`\236\fp\230\362\344x\227\362\244w\366"
+	.ascii	"\222\007\245\352\205MGWg\265\326\334\262p\351sw\277\235\266\232"
+	.ascii	"\211+\311q\351\316\027~\200S\021\351\367\341\267\023M\364D\321"
+	.ascii	"Y\301d\3426\001)\230J\274Fd\251\304\030`x\001TKN\324<\317\304"
+	.ascii	"q#\212\221\222\213\023YB1\346\240\021\207\3672\242\345\024\211"
+	.ascii	"\223\367\272\215\f1\244\037\211\217#\276#\201!*\310R~Ec\315\323"
+	.ascii	"\217\021\027\236&\375z\224\242\350\324ZM\221~Lw\312m\223\331"
+	.ascii	"v`\217R\001%\265L\314\271n\030\222\372\205\244v!\251[\376u\263"
+	.ascii	"\214\324+*\337\272SFj\334\355]\367Y3o\365\227\007\376\344\255"
+	.ascii	"\356=\360\246#\365\001\224\300!4]\265*\025\237T!\344\360\305"
+	.ascii	"\273\376\257\177\353\347\372h\337\337\361/\177\350S\307\356Y"
+	.ascii	"\357\362\275\214\265\033z\016\237\307{T\350\232Qk=\271tz &\f"
+	.ascii	"\335\212hALx\342oA\0206\215\024x#\341\001q\t\361Y\276\016-\207"
+	.ascii	"U\245\021k\255\r\314!\037\313\347I\333C\277\272\031\253\326\003"
+	.ascii	"\2603b\255\301\002'\275\300<\371\3236\r\036\307\356VD\001PvX"
+	.ascii	"\311\262t\253\270\262,{%*\233\262+\373\341\t\230\231\371\252"
+	.ascii	"L\334B\271d\002$ok\353\0221>\251\366\233\022\267\247\022\006"
+	.ascii	"9\367\213[\362H\314W5\326Zki\373My\356m\307|T\275\315\0223\372"
+	.ascii	"\221\033e\"\214\036[+w7\351\302\233e0\200k\256GJ.\335$\233\356"
+	.ascii	"\327\346dv\224\306\243\305\021\347@\245\017\366\003t;\322\302"
+	.ascii	"'*O\252\034)\343\321\242\021\274\334\332\3468\031\361\305\350"
+	.ascii	"\321\242\3115\227\201\323\230\257\t\217\026e\222|\234\330\215"
+	.ascii	"r\201\223;\023\"\211\360G\021E\263\203=\272Q\366s\244\320\210"
+	.ascii	"^(\273\206f&A\0332l\206k\300@{\204|\326;\006|t\034\200~x<\370"
+	.ascii	"\350vx:\f\005\345|t==\272\235\234\017\207\013=\271\235\037\240"
+	.ascii	"\234\001\033\353:\360\374\344\202t\272\237\334\031\344}<a\266"
+	.ascii	"\006\353\206\020\336\366l\n^\267\371a\235\225\3356\312dS@\033"
+	.ascii	"\315\271*\021\224\322l1\2730\233\364\341\315\262)\027\266\231"
+	.ascii	"\365\210\373\246\334\224*,N\314\204H\212(\332\271Q\2465\213]"
+	.ascii	"\250\264\275H3\017\\\250t\271\217\253,\315*h\032\363U\365f\226"
+	.ascii	"A\223\230o(\263>\230\005 \277\305\201 5yY\231\245\\Gi0\033\263"
+	.ascii	"\277\362\305p\331\226}\331\373\236V\266e\177\224\306\263m\324"
+	.ascii	"\213$\261\322\252m`\250a$\303\020D\006\232\241@d$J!\035`\002"
+	.ascii	"\031JU\036\020`W\332\024\2440\034*\362\347'\314\327\001\306T"
+	.ascii	"\371\371\200\201\256u\321\300\327\322\313\005\304\235\220\n\370"
+	.ascii	")g\034\025\215j\331\220\332\217\366\205cj\006\330@+\261{f\361"
+	.ascii	"\272\223\303&+\301{\033\276\034\220\310h@\372\263x1\213X\321"
+	.ascii	"\2009\360(\322\275k\035x\022RXeZ\345\203\301\220\355N\003\355"
+	.ascii	"\315\201\362\0331\305#H\235a8\355\032\022*y*\3643\024\313\224"
+	.ascii	"\313\"\243\3177\017\326\277\326\026\274k\266\242\022\332\300"
+	.ascii	"\351\241\353R\353\253\312\340W\025Zq\037\t\022efi\351o1\201\325"
+	.ascii	"\262\245b\275z\323\0275\351\201\b\037\354|\317\037\006U\366\206"
+	.ascii	"\353\242OAG\r"
+	.text
+	.section	.gnu.lto_a2d.6.dde54e048c27d5fc,"e",@progbits
+	.string	"(\265/\375`\322\001\245\020"
+	.string	"v\037pG\360\260(\035;\206\205\213\0077\320\346Z\321\023X5\270\373\334\bwc\326\240\212\246z\004}\303\370t\357\334#e\333rx\bJcl!\2603=\223\226\017^/3ilh\260(\225\007$\317\313o\t\331{K)S_"
+	.string	"R"
+	.string	"]"
+	.string	"\035f\324Z\273"
+	.ascii	"\313Aw\312\335\240;\273\302\246v\323\350\224\315\251\357\310"
+	.ascii	"n\255\001\203&\327\265BfODP\221\bnR`\270\220\3054\344\202\315"
+	.ascii	"\025\027\226\260\374\240pyA\001Ee[\016\020oRB!\211\344\230\271"
+	.ascii	"Xll\371$\004\2315\217Z\353\331$D\331{\366\377\311\377\002?k\001"
+	.ascii	"=\216\343\370f\0011\237c\376gcv=\314\337\230\2575\2372\1776_"
+	.ascii	"2\277\233\317\315\337\020\2151\003@\242V\bc\215\2323k.\374O\375"
+	.ascii	"\334\177\346\277\303@jc\036\274k\025E\232Z+\201wl;\377\1777,"
+	.ascii	"\207\324o#e\026\302u\265\260\002\255q%\2028 \f\b\332\257\226"
+	.ascii	"\331\334\354\257%\343::\256\2329\027Ee\213L\220}j\271X\211 \213"
+	.ascii	"\2001[\221\n\3666\264\033\324\275\240\245ba&bN\367\353\236EQ"
+	.ascii	"\356\0062&H\230\306\227fQt\233{W\"\310\343=\275\275\261\225#"
+	.ascii	"Z8\254\035\025\217\277l\204\373\365o\016F\374\221\310\344}\200"
+	.ascii	"|$\021\2237\"\235P!\235\311+\225\274Qg\372`P\352F\037H'\022p"
+	.ascii	"\357D\372\272\020\317\373:NV\267Y\276+\031`T\264\007V\332\247"
+	.ascii	"7\305K\213\311\365\306\326\343\362\022\242A\275\365\326\367P"
+	.ascii	"5(k\255uK\240\365G\353O\202\007\326\216\252\304\207\231\022m"
+	.ascii	"fi\214\366)$ \340\"\t\354\272\001\366\001o\347yj\206yU\337\256"
+	.ascii	"\261\003\271_\245l0\262\246zA4\316\350\267\016{[#\324`\301Y\356"
+	.ascii	"~\004\177\226w\343\336P\013\200\023\267\306 \217\032Hmci\275"
+	.ascii	"\342\274\216\201\036\b\027+\343\336\223\r\333\313#\344="
+	.text
+	.section	.gnu.lto_a2i.7.dde54e048c27d5fc,"e",@progbits
+	.string	"(\265/\375`\217\004\005 "
+	.string	"f\373\320K\220\026R:\300[K\037\033S\252\301\371\266\217{\242\006\265\376H\302\201V^e\224g\324_\034VeV\254\247\377\366U6\265\376\225\277\306\013\222\256\370U\"\370\346\346\317'\320m\360\032\3061\312~\310`\261|k\215\220-w\222\001\277"
+	.string	"\261"
+	.string	"\277"
+	.string	"\374\033\247\002z\363\347"
+	.string	"\356]\302\342\272\267i\200\0254\037\203\376\264\375\005\375\311\265^*\210\373^e\n\256{\257\001N`\373\231@\001\020\007\275\331\342\350USD9\246\334{y\315\202\317\032\364\\\212\273\331j\350i\273\006\361\031\240"
+	.string	"+:\202x\356Z\303\232v\r'\234\375\222I\325\213\030\223\366A\030\211\251?\031\221\365\246[6\331^\304x\342\311\210Tk8#LP\224F$\035\265\005\224a$tG\"\033C\2664\373\326k\361H\254\247S\211[\353\300\313\304\221\3568d+\214%P\376dL\326\276\326\355\214$X\321\261\304k\r\302\275\227k\321q\304\271\345\314\234\204\231'0\333\013\001?\350\317[[HJ+\"\205j\032ssX\233\311|\002hMW\270\227xW+\337\330\324*\327\324\31243\265\3122\265rL\2552L\255\362\313\257~"
+	.ascii	".\272\226[\375\271\364R?\356\366\346o;\326\371|\326\331^\352"
+	.ascii	"\334\265r\255\225\037\2406\203\354\006\355\336\243\264+w\354"
+	.ascii	"\364\021\343X\177\326\371=\276\305\234\262\360<\370\354BR\343"
+	.ascii	"\336\233\n\231\323\237g\006\342\357\270\026\247\314\234\325\363"
+	.ascii	"K4\336\212\226TO\356mJ\300\342/\033\b\243\355j"
+	.string	"\211\365\344\336\213\363\223#\330+\3662{`\303\361*\240[\361\027\337\356U\n\322\300\366S\200\355\312\001\035D\242q\224(\313\037\266f\362\371\035T\246}R\3104\020\351\204\250\254]R\310\224j\025\316_h\355\030%D\345\233\212\224ch3\231'\212\210m\351\016QF\025\347g\027\257\"\352\314\352\372K4\262\324[\333.^\353\266'Qg\326\245\331V\\w\027o\337Aa\232C\325\220s}\007}i\230>Q9|\351o\335\002A\212u\327\316\220\004#\312\"T\323\354\275\367\236>|~.-z\320\237.}$\bn[\327\025\222hD\031\273~\267\364\233\020\225\271>\373\215!\351\204\3704\254i`\"\272B\330f\362\256s\2753\212Q\0256T\253t\231\225\027&\272\231\347\362\365\310\2241\361\003\300\353\364\370\032\250\323\343\2639\302\r\034l/(l\017\275\312\275\003\276\337\007a0\307\307\367\353\345"
+	.ascii	"\177xx\276\237\216\316\257\307\363}\330\240\303\353\005\205\274"
+	.ascii	"\003\003\370\007\314\t\362x~\277 /m\na\371\355lN\317\346>{\306"
+	.ascii	"6\247\266\271m\333t\221o\335\234v\263\355\3564m\035\021\324\230"
+	.ascii	"P\017y\246\371C4\360We/\364g;\231QA\262\351Zv\357=\323\265>`"
+	.ascii	"\205Y\024\022\226\\3y\001\021w\323?\002uf\243\2711Am\2411\275"
+	.ascii	"\353\"\316w}\303\bF\225\330P\255\322Vr\020m\244\024n:\230\244"
+	.ascii	"C\b\226\025\021\327L\006{\rUM\003\221i\027\033Nm\335\202\\\320"
+	.ascii	"\004W\250A$\245\210c\304!##%B\2244\006p\002\221:\344\006\020"
+	.ascii	"h\2526\035\253\020#\255\304\263`4q\245\363\020\363\270k\036d"
+	.ascii	"EFH\016\265\307bF\370\344s\262\232z\\n\260\311\331>T\324\253"
+	.ascii	"\030\312hb\333\be[EP\234\373\355\321e\360b[\fn\252\232\256\006"
+	.ascii	"?\235z\340<\314k\016\034\351-l\001\374'\202mt%)6\032\006\337"
+	.ascii	"\203\250\220\\!7W\001\321#\250V\332\303\2029\254\035\t\270\022"
+	.ascii	"JI\032\263\364\302P\210\256\260\246\212\202\377A\315\324\232"
+	.ascii	"\261\337\203\214'\332\207\340J\355$K\bUk\206\253\2053\274\312"
+	.ascii	"\rB\310\206\371?Oj\022F\r"
+	.text
+	.section	.gnu.lto__i2a.8.dde54e048c27d5fc,"e",@progbits
+	.string	"(\265/\375`t\001-\020"
+	.string	"\206\336oG\300VQ:4ff\202g\335\371Z\271\263\342z\031\241l\027\f\250K\205\023\261,\202v\304\351\355K\343_/\006\353t\t\246\252j\332\200f\300\031p(x\336\214\252%Q\266\b\250\007\024\006\256nwNk\311\2262\245W"
+	.string	"T"
+	.string	"["
+	.ascii	"ST`\027\357\335I\332\366{\234G\346\331\212\030\346\220~\242\304"
+	.ascii	"\3109\231S\374,^e\364\316\373\200\321\273\265"
+	.string	"\361\331\345\352\314\177\356\222'$\272\341h\2273\2762A\221\020\223\024\234\215T\301\311q{\356z\203\253\251\222&\3149\2557\\\316\335\335v\214\355\026\366{\002\273\2023\376\024\261\321'\266H\323\335\261/\347\352\330T\272\317\357\035\350']\374G\367\271\345\252W\325\252\352\247\004\240q\204@\2239qF(\323H7\244\303\266\314.\331@I^<\275\317\354\002\346\324\021\202\362\336Y\325~\317}\310.\"0\2009k\360\004\315\266iO5[s\313\345\232VBHd\333\261\353\007\241\211)\022\034\376l\364\356\271\233\222\032\035a\034H\314\233\323\006\006\346\331\"\034x\267\213\2721T\243\243\356\211\204ClC5\035e\247\244\365\366k\313^\350o\245=\331\226\366\205\020\376\260\361\250\351\370\360IQ\320\356\216I;\nf\261BE\n\024'L\224 1BD\b\020\037<t\210\341\260AC\006\f\027,T\240\360"
+	.string	"\306\301K\003\024\003\227\226\005\006V\260\224\013\231:\353V\261\270@\026\354\265\242q\201\252\225Ll\346s\201\255\026\250\372\\\254T\353S\275`\037K\001\2032\253\3277\003\202\257\257$\316\313\271:~\356\336\022!\031[ZK\365V\356\215\003\032"
+	.ascii	"Y\b-\257Q\226\b9qC\001\207\030X\357\254\302\212W56\224\240\240"
+	.ascii	"\216\307\331\345\032\256\2611g\210K7\001\303/\0240\327\325`@"
+	.ascii	"\247%\021\004\022\362\021P\363\340n$\325\240U\"M)\024\024"
+	.text
+	.section	.gnu.lto_itoa.9.dde54e048c27d5fc,"e",@progbits
+	.string	"(\265/\375`\223\004u\036"
+	.string	"\006\370\304H\220\330Q:\205\005+\301\203"
+	.string	"\216\342\023\261\324'\346\351\247\231\370\006\006\324b\323#\013\370\200C\237\261\262\246\375\376\2416\353w\217hmP\022\250\347\023W\327\321a=\321)P\312\340\bh\\=4n\377\223F\366\226;\311\256"
+	.string	"\241"
+	.string	"\260"
+	.ascii	"\017p\357U\222+\367\032\203X\310\274eJ\231\357\344O\234nd1\256"
+	.ascii	"\335[\225u\345\336\033\304\016\314[\237\312\314\374%g\342\304"
+	.ascii	"?\036c\326\324\313"
+	.string	"r\f\217f\367\032wl\274\256\2745\237S\336\366\220\377~\263\325LZik\323\037\277\"\321bC,\326\370\315\366S5\365\343\265\207\221\372\201\374\317\226\224\017j\322\206~\252\246\200\234\306\343eUp\006lM\2568\254\272\250\"\304'\205\324\326\003dVd\036F\252G\355\241\352\262\303\006\255;\336\271\342S\365\271\367\376x\212\243\030\244\2246t\357eJ,N\235qgf(\314\374\202\271\032\005\345\233\366\205TAz\362\255\337,\262\316\341\031\220\236\314\306 m,\346\367y\236'\367\0253\201\222r\217\245<\340_g\036KyG@IYg)\353|\3129\307R\3069\327\237\273\361\307\335\353\277\335\353\\\263\224MK\231f)\227\226\262e\312\325R\356J\231V\312/`sB\226\200\315\275Q\247\233;f\303\214\374\353\237\362$\225\256J>\312\221\276C\341K\351\252*f\367\336\333\277\206\2027<\224\345"
+	.ascii	"\362\235\353WJ\325tX\2759s\2571\310\307|\273\245\314N\3147f\257"
+	.ascii	"\257\b&=\327/'\362#\021\315\223\314*\236\245g\336\3734a\311\024"
+	.ascii	"Z@p\253k!\2550 =u\372Y\262\254\b\303\202Bh&\355\256\215\323\374"
+	.ascii	"\244/\006=1\247}\204]\203\273\313\306\351\nYQ\204J\202|\264\002"
+	.ascii	"b)\033\213\313\356\356\021uvy\261]\366\305\204hpm\233\036\033"
+	.ascii	"<\327\265/<\022\244'\327\272[H\013\314\360,\350\275\222\037v"
+	.ascii	"\324\303\215!\302\377q%\221\244\001\322\023L\rY\020\333X\374"
+	.ascii	"\343M3,Pm;\213\225\\\351\255k\215\003\350\270\326)\353\352\362"
+	.ascii	"D\333\324\306z\367\025\0278\215\222\366Q\327\227'\332\206\001"
+	.ascii	"\234\347yv\032\001\354\242\005\213\025*R\2408Qd\242\004\211\021"
+	.ascii	"\"B\200\370\340\201\250\003\207\r\0322`\270@a\202\204\b\020\204"
+	.ascii	"\0368h\300\340@R\317\350\250\032]\351\214\264\200\211\247\324"
+	.ascii	"kJ\232\301\304CJ\202\341\223\261c\342--\361\220vLJFK;\244\246"
+	.ascii	"\336n\201\001\346\301Hj\332\311\340\361\232v7#\360\365\366U\256"
+	.ascii	"\177\374\241\210M\306\200\035\254\027Y\343i\256f\256\t\234\313"
+	.ascii	"\371[\210\216G\260U\245\207\b\311\034\242g\200\215\326\271\336"
+	.ascii	"i>\222\207\326f\357\210\321R\346M\r\211k\263?<\003\322\372\210"
+	.ascii	"\226\231\341\031-B\244\0323\2237\323\200A\2259\315\325\326\026"
+	.ascii	"\260\245\350?\036h+i\226F\327\374\260\242\036\007U\250q,f\230"
+	.ascii	"R\306\224L 3\263\2400i\003\240\"\231\253\333\022\200\226E\b\241"
+	.ascii	"\271-\326\3773b\344\202Xi\026\013\257lX\205N\035\363\372xK\266"
+	.ascii	"\340\2702w\2165\326vH\314\366\\\302\3027\301\337\337\021\370"
+	.ascii	"V%H\374\255*\332\026\212\301\020 @\334n\255\004\001\300dqV\371"
+	.ascii	"6\254\346<q\201\366\301~\203\336\377/ZH\300\232Ev\035\002K\250"
+	.ascii	"\331\364?'\346\016\\\202\337\035\305\317\225\236\003\365*\023"
+	.ascii	"\232\352.\"\254\001\027\330L~\033\034\263F\276\236`\355\317\224"
+	.ascii	"\341\220\344\"\013\246\263\n\007\343[\305\200\256d\002\344\365"
+	.ascii	"\201{\036\370J\026qyK<*"
+	.text
+	.section	.gnu.lto_ftoa.10.dde54e048c27d5fc,"e",@progbits
+	.string	"(\265/\375`\307\006}%"
+	.string	"\032Ax\016H\200\332Q:\237eh\203,\352\363\347\021\263\262\263\026s\332\261\302\305\355\341\274q%\210\247\337\241\263\251\321\232 ),\254\352z\367l\340\254ap\270\213\200\303\2238\334:js\t\020\304\2015\324\332\377\232\222F\b\221;\311\321"
+	.string	"\311"
+	.string	"\336"
+	.string	"P\240\326\353ec*\221\250\335\273$z\312\023V{'R\347\271\267G\222*\367.\213\330\301\372\224\255e\376\2223\211\372\222\251\360\316\275\\\200T\271\367\026\361\321\372\324\20723?\311\225D\261\324\317\362\007\326\313\004\251\n{\336\273\374\361\362>\352\323\365"
+	.ascii	"\324\247\355\343R\347\355t9\334mg\265\251)\332V\212_v\024\f\214"
+	.ascii	"\211\274*\236\267\323\241\t\264\276\310\370\230\244\026\352\363"
+	.ascii	"\225\324as\270\034_I\034\366\266\343;h\003\027\317\034\037\223"
+	.ascii	"\274\201\346\342T\221y\331\r|%m\330\325\200\355\\X5\256V\035"
+	.ascii	"m\232u\364v\225\365F\005h}\221\261\273\242B\017\234\361@\363"
+	.ascii	"\262[\253\253)km\023\356\275l\221WX\347\336\231\371\311\314J"
+	.ascii	"\314j\210m\216^S\267\342\346l\013m\345\247^\340h^\226\260\266"
+	.ascii	"\206\206\352^c\220\256y\r!\b\332Qk\312\022Aj\2355\225 ]\377d"
+	.ascii	"\255y\022\206\312\306\341'\213B\350bo\256-p\222F\273\306\274"
+	.ascii	",\332V2\037\275\335cH\265,t'\277\357P\316@\251e\236O9\367x\273"
+	.ascii	"/\177\335\227\347u\265lc\313\252j9\265YFU\313\255Z\266\326\362"
+	.ascii	"\021\354\260\316\022\240\335\033cm\316m\246W\272\016\345\027"
+	.ascii	"\373\245\374S\2162\237\371f\314\2703G\361\303>v\262\2271\216"
+	.ascii	"\231\2478\255\305\344\312T\016Q\273\367\"Iy\362\025{\367*\211"
+	.ascii	"x\335\233\004\361(gF]\354i\275^\026\302\272\324\356Mfh\346\370"
+	.ascii	"\350A\324\003i\252\352\364l\267\217U\033\036\230k\231\303L\333"
+	.ascii	"uq\243F\214\215\"\272\246\021\304\206y9\273\221\303\342\\\363"
+	.ascii	"\274\202\245\311\304Y\240\031r\272FW\223\263[O\201\233},\330"
+	.ascii	"\363C\304\210\034Y\222\246\213.\032\251\001s6?\306\246)\2334"
+	.ascii	"O\347\202\2424`N#\243UY\262\265\323\312\223Pm\227xr\246gWf\244"
+	.ascii	"${\244\355\034\231\221&U\027\327\"\264\247\323h\363\035\2502"
+	.ascii	"\263\202\217\001}\322\356\275\021R6f\236N\243\332J\016a\006\335"
+	.ascii	"\265\322\026\263\346\365\332V"
+	.string	"Nj\257\177f\030y\"&go\347,\352\315N\026|\2264$O3\253X\262G\362\313N\264u\354\"\367\232\247ov\013^B\266\034\237\357^\037\3141\214\321\256\305\271\367\366\254\375&\na\036\277\246\322]\023\005ld\231-\320I\t\211E\312\340H\030\274\t\207\301&\244\244\241\006&\0237\024\302 \261\311C\023\322P\351\004\256\3059\311H8\f\256 \002Y\b\207I@&\250\246\237p\270\2644L\372\t\203HK\277$\342\212\237Q\020\017\231\200\304_\323pH\374\341\226\367\350\355\036\334;\030WMcO\211=\241\367rI\270\224_\315\211]\343\036kk_\343\266\322\346\217\005\007\244\331\372\326\365\006\310\332\263\027\225\355\245`\343\372\002v\357\361\310\n\3531\205\320\323\241f\276\200A\250}=\324\027`7p\260G\n\265%\223s9D`\317\017!|)\365i\2014g\332\276V\273C\027\332\361H"
+	.ascii	"\2336\001_3{\370\340\003\352\264o]b\252\352\3209\224\2126P\333"
+	.ascii	"\260n\264\321~\250a@\206\214b\246dF$\210$M\212\r\220\242\221"
+	.ascii	"\262\343\001\022`\205E\316\0343\n\244$\365\243\236\003~\024\030"
+	.ascii	"\264\002\357\305=\3566\273\314V\374\215F\346\0314\226\b\214f"
+	.ascii	"Q\030(\201\244\004UKa\316V\2461\3136\033pQ*\341J\342\326M\336"
+	.ascii	"\366x\250\272+\3202\242\306\020\030`\235K\376\310*\243\316\344"
+	.ascii	"\001\207M\255\356B\375\340-j\211}\0162\333\306(\026\f\273k\300"
+	.ascii	"['}\224\360 J\220\347\330\217\375\346e\227)'\007\210\340\232"
+	.ascii	"\214p-B\024DV,A1C\217\211jP\277\321\270j\036\323A\342q j\377"
+	.ascii	"\221\332\351\201\007>\2342\372\203\342\345\325\326\270\r9\255"
+	.ascii	"\216\230\236\211]$\346~by\302\031F\352\247\037iX\021\021\364"
+	.ascii	"x.\260O\305\372\250\257\021\361\001\300u}S\031fTt\006v%\001\r"
+	.ascii	"\307i\371\336\334\327k|,h\246\331\340\016\247\220ZF=\227n\214"
+	.ascii	"\260\2020Z\177m\326\250\366?"
+	.text
+	.section	.gnu.lto_fastA2F.11.dde54e048c27d5fc,"e",@progbits
+	.string	"(\265/\375`\330\f=B"
+	.string	"\312q\344\030AP^N:\363\234\256\t\341*\023\f\216\316rG\304\207\030\262\354\017!\365\300as\315\321_v\303\320\316'`_\n\241"
+	.ascii	"\200\231\2059\250\026\330\210=<\202\252T\377w}U\315\315ZBv\332"
+	.ascii	"R\006\211\001b\001u\001|\25527\024p\313\217L\341\340\272\352"
+	.ascii	"\231u\031\356?6\372\275\t\306)#vj\231\331\270\367ZL\223\351>"
+	.ascii	"6\3621\033\"\0168\342\030't\203\030\306\030!\013\303Peq]\337"
+	.ascii	"<9\363\240\3010\224\210\003\356\311\307\333\223\301u]\271:\345"
+	.ascii	"\005\304N-s\347\265\027\266\326\273\321K\353:\307\345\314\272"
+	.ascii	"\352uq\002b\247\254Gl.\215\307\306\f\275ztRZ\320\371&\246p]\327"
+	.ascii	"/e;\251\235\336N\252\235\336\311pX5\240\257^\363\024C1\222\215"
+	.ascii	"|\207l\255\304\272\262\252\242\312\232\222\212\202zrjJ2-)!"
+	.string	"\217IH\306\243\"q\250\246\367\226\215;\215\037\235\036q8Z\211\305\327Wy\326\352\022\357\300u\271b\353\272r\261UxM\205\327Y}[\354T\023\271\273\226\352\266\273\216\322\002\255\263PT\372iHV\340\207\225%rT\332\251i\212\024\233\234\322LQ\240\330%\250\227\253\\\327\365\211U\242\373sZd\222>\016\005\003\007-\221K\322I\177\235u\007\216\016\211E\352;pG\262\256\300\025\261\306\254&rF\372\210\300\237\225%rF\272\230E\354;pD\372\n\334\020;\\\"G\244\325k\300)'\3101\356\355:\331a\362\307\030\307\264\351\035\352\370Qw\214\323q\305\022\r\246\351\276\266\31587{\255\004\351w_\337,w\202=\342\202\264\035\222\255\353\312\266G\234\\3\200f\266G\230\271\004\363Q\234\204\207\210\020\316w8\374\2141j\204\013x\223\213\020\036\306%\212\204\346\r\026\342\237\314\205\205D\221"
+	.string	"!\205\n\207\303G8\027\301$\020\035\205\352\275\001>|\223\206!\300\333\177W/\325?\n\211\237=>9l\242\364O\356\276&\3761\024\370\020\347k\305\036\340M\346\032jz\013}r\330D|o\237\276\337\202\024\357[\331K\265o\1773oi\032\r[\226%Q\n\367\r\265\323~\204;\301f\221\266\273\256\353z\031\254\003<\304\303\356\0041\355\334l\364d\334\350\200\373\237\314z8\254\030]\242A\376\034\263Y\b\020\037\256e\017\327r\207k\271\214\303\006\r\0310\\\260P\201\002\331\2041\t\021 <h\275n\261\006\327r\030\203\005\r\330\254\240\375\232\023\2005\230f\004_^]=\246\371@\3635s\031(\260E`\200\200"
+	.string	"\252e-\3252"
+	.ascii	"k9khY9\264\2145\264|e-[\335r\325-S\r-O\335\262\224\265\034\245"
+	.ascii	"Z\206R-?Y\313N\327r\323\265\234L-3\245\226\227:L\263\022R\265"
+	.ascii	"|T-'Y\313H\327\2621\265|\224Z.^\313\304\326k\036Z\313\352-\247"
+	.ascii	"\267|\255\345\337\262\265\226[\004S\241\035\007\321u\375\021"
+	.ascii	"]\264\326I\323Pi\300n\277n0\335a\272\307t\007V\347\232s\302T"
+	.ascii	"&\021^\362\317N\252[\267\3601/\305>0\213\230\376d6mu\265\026"
+	.ascii	"d\253k\253?\360\"\b\254\267N\341\r\355\233\305\013\264*H\027"
+	.ascii	"-KH\2573\222\322\277\336d$\201\363EB~\253\327t\325Q\354Q]\352"
+	.ascii	"Ub\2508O/\325\250K\335\002zK\343V\027u\273\274\250\222\024F>"
+	.ascii	"\216\023nCQ^R\263\377\272(EQ\243\343\330\371&)\335\353M\033\214"
+	.ascii	"\234G\262\267P\004\230$\341\004\336\234\323Pr\372\351P\357\247"
+	.ascii	"\037P\025\247\223\350B\330u=\234v\220\004N\366\261<(\323\316"
+	.ascii	"-\301'|l\217y\305\353M\037\273\235\223\340\3117\275\231p\230"
+	.ascii	"\236\3745\323pz\351L?\033\247/\335D\227\350[\243\266.B8d\317"
+	.ascii	"\021y\t\357\277\276Y\272$\031\273\256\364&_\343\200#\337\244"
+	.ascii	"\201\b\320\210t\365M\257^\252\352\243\234~\220\376d\033\210\002"
+	.ascii	"\217>\274F\226\"C\231\331ju\275\211(\320\021\210\363-\n\370\200"
+	.ascii	"7\213\275\246\036oaN\237\35155\351\307wR\243\266+H\217\200g\034"
+	.ascii	"p\020\017\303#d\332\031O\374\2077\243\243\033\177F\314\3016\033"
+	.ascii	"e\263f6j\361G\277\200\230N\244\027\177\331\2745j\203\266\022"
+	.ascii	"b\327\2117\201'\210yE\356\350O\266\304~\323+\b\235\303\0344\b"
+	.ascii	"\363T\2066\333\271um\323:\360fi\313\0274\320R\004`3\226/\322"
+	.ascii	"\263"
+	.string	"\023j)n\232\n\026k\027-F\213\0232R\264\026'\316\326\322\027\315g^iK\026kjh2\322\226gh/j\300\370J[\272p\261<\373Jcq\302\305\327\231\332\332\227\227\026/_\240\251}\301X.\325\276\214zk\177\216-V\331\215wW\035\036\346\341\312\266\273q\330\017\334\303G\370\321\271JF\201\224zP\363\2652\373\203\007\377z\331\333b\231\375\353\035\212}\354\341\224sU\005v\2637\271\036\347)\310\352O=T\030\026\234A \325\205\363\315Bp\2607\3774\203{=\261\354\365i;L\374|\251\212\366\226\312\340\030^F\210\351\004\373\205\227\371\021\363\243\216\007U\326\347\270\241\235\ni\"\245a\352\013\212S\2048\2452\234o\224m\016\275\236L\366\002\247\n{K]p\r/S\303t\272\345\005\356\bC\360\fm\312@\245\240\024\274\201\265\353-\265\301\247.\326G\207Y\310\315F\243\246"
+	.string	"\361\361\264\341\035\247\307\211\233\rm\"# \316'\016\347\353T\340\006\264"
+	.string	"\\\013"
+	.ascii	"\224\254\223\340\213\332u]q@\0318\207\217\365A\231v\310h4z\246"
+	.ascii	"\267T\3457`\375\352\312\254c\375\212ykt\324[\252\202_]F\037\231"
+	.ascii	"\306\343\007L\337S\023W\323\210\002&\271\272\351\242\201\230"
+	.ascii	"\0164\327\2337\342\352\232*\274E\324\231\244p\266CL\026^\340"
+	.ascii	"Mv\372sOo\275"
+	.string	"\302\307\370\334\250t\177\2124\265\351\201\f\250QD\003\rS\206hDD\222$IcQ\005\304(\350$4\017\021 1dP\225$Ii8\027s\320\361\004\333-n\016\335\226iL1\376\bh`\244\fE\271\252\234\021\336\354\003\253\003\221&5WY\023\302\016'\t\215r:\tGC\247\324\357\221\210\270\016\3412?;\231A\345\325\250\244\226?f\302PP\261N6v\251\021*vO>l'Z\363\001N\205\023\320Q/\3260\302\217d\257\210\022\303\221\301\022\247\310\346\023\\V \331Qz\302\f\327\306E\202<\347bb\006`n\234ohU\004\354\216T\n\035\347\036\013\220\260u\037\177I\3541c\311\344\002\fr}\032\361,\022\237c(\366\315\017\013\267Q\333\203\\\266\235\325M~\037\0252o\203\030\001\264\003\244\214\352!\006\350\211\033\032\3638\305\356X\0247\200\b\345(}q1\202${\272="
+	.ascii	"\317\226\033\357g\364<\237\336\360\rT\332\372\304\230\007\231"
+	.ascii	"+\332\363\326\320\277\203\332\267\332#\252*%FN '2=\232_\237Z"
+	.ascii	"\207.(:\264\027\311\300X\241>\320T\250@V\374\311\300pAoRV\220"
+	.ascii	"\2702_\037H\335\221\250^\351N\232=)\235tC\243\240t\350\351\303"
+	.ascii	"\203Mo \266\t\272\004\226\313*&\223\343 \001[4\201L\316\253\376"
+	.ascii	"\210X\245\222\365\2051\312O\215\307\270V\352\267\213\021\323"
+	.ascii	"dw+\036\026\300~\031C\f.&e\251\002\t"
+	.string	"!\226\345r\362\351\034\320\235\222kIr\212G\224\260\025\216cH\216\007\347\031\251\003>\315\017\006\367R\025\320\365\222\301k7\366-\306\210\271|\002>"
+	.ascii	"\263\022\260u\321\b\353\222\306L\2154\261R{k\313C9\241:|\262"
+	.ascii	"\n\037t\241\220\207\021$\301\031\202\374\362r]\206+\247d\363"
+	.ascii	"\317\235\240D6\366\033\243%\305O\257\254\223%\233\263?\357\237"
+	.ascii	"eC\254\016a\021j\230\231\n\232\002\264\317t\314\177"
+	.text
+	.section	.gnu.lto_.symbol_nodes.dde54e048c27d5fc,"e",@progbits
+	.string	"(\265/\375`\022\001\025\b"
+	.string	"\222L/2`m\322\001\320\377\344o\025\215\216\306\215\375\252[T\231W\f\366\032\360\207b\0028\b\002\032\004\001\021\020\215\002/\rk\370\221\255\265\354/G\"\221D\246\266\234\246\365Pi^0\212\246\005T\321|\240\207!r\214:#N\363m\320%\036\021\025N\263\302\320\033\237\217\216\323t\030Z\304\203!\3414\333F\223\3224\315\n\004\035\322Ar\342\226M\203\316\230\270>n\351\200\310\021\205<v*\234\222\360\207p\314\3013\270\273\366\202\301+X\360\212\340.\363"
+	.string	"\006\023\212\021\346-\263,\313\254S\227\003\f|\022x^{\321\300\021\205,\227\250\275\256\265\260ok@\340\264\273\373\256\222m\351\005\033"
+	.string	" \353\234C\303\320P\030\332ZK\001\335\234\2075\303\003\365"
+	.string	"\340"
+	.string	"\340\360\001\222\375\245}\020\306\303*! \220\346d\004"
+	.ascii	"\232cH\365\r@\f\030\020\016\350\001\350\241\223\016\252\304\340"
+	.ascii	"I\206\016\246\023"
+	.text
+	.section	.gnu.lto_.refs.dde54e048c27d5fc,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.dde54e048c27d5fc,"e",@progbits
+	.string	"(\265/\375`\230\020\305R"
+	.string	"j\215\330\036S@P\312I\007\346\351\270\310\215h\023\275\213\364@e\327\357n\276m\253\n)\261j\346\267\020\2728\210 \232Tl9\340\270[2\200>\b\373\200UU^\272\037\325\324\203\003\373\214\200>PU\377  \211\320\310\225\334r\314\241\354\362"
+	.string	"\326\201Ht[)S\240\001\323\001\344\001d\305t)e\344)\363ZZu\0222\270V\355v$\242\313 W+\205A\255\2128\346\270~\201\370\327\312^A\236Q\\D\230\\K\354\211\2237\347\354\341\3712\317%U\242\312p]3^\016wwwwf\274U\226\312\327\354_\262-\373\210#d/WE\317mI*<k\212=q\326)\274b;\366\235r$r\247$`fU\3408I\001\342\352\f\223\202\356\240\301\305\203\353W\312\277Q\026l\223-t\037u\367"
+	.ascii	"7OW@\246\270\276\271'N\233\3159\027\n\317\367+\347$6!\373\213"
+	.ascii	"\206\307Y\224\020\2565\233\343\325\265nVPh\334\265\304i\222\243"
+	.ascii	"\207!H\234\021ev?\350\340\372\325Z\345\277Nvk\223\274T\311\330"
+	.ascii	"_\335H\023\035$\351\341\205\353\"\227\353\233\334'\357iq^0\331"
+	.ascii	"Z\335\275I\026\306n\341&q\314t\013qvU\354\252\250L\244\214\200"
+	.ascii	"\235\365+\320#\367\304\211n\316\371m\362\234c\2678\243\277\005"
+	.ascii	"\376}\340\337\031d\370w\002\337\2771^\370\027\210\205\177+\370"
+	.ascii	"\027\204\025\266\247\002\002\013\366\257\t)~>\240\214\304\317"
+	.ascii	"j\377\212\360\344\277r\304\3174\365\337:\007\352\342\316\177"
+	.ascii	"\331\222WP\350\375+\366o\b\377r\360/\213\177!\3707\305\277&\376"
+	.ascii	"\275\371\027\375\227\377\333\375\257\373?\367\337\313\377\266"
+	.ascii	"\377Y\376"
+	.string	"_\371\217\302\177\021\376\227\375\027\373\317\365?\205\377$\374w\340\277\224\377#\374_\376\357\372\237\374\217\342\377\331\377\232\273\273\273\273\237O\370\367\203\377\246K?\330\021\361\265c.\307\334\252\222\f\207fE*J\214\230\255CK\364p\255iD1)L\022\335\267\216\206Iwd\342\272c\240\336\336v\016\r\302\361\230\260\t\371\001\346;gsE\005\207\021\256+\247s\023V\244\214\f\327\215\203krs[/hw\363\272}\234Yq\224\254\270\270!\276^\260L\311-q\335.G\253Yb\331\341\320\242e\333\266\211\335M\315\373\222\225tE\246\233\232tV@+\236\341\272m\207\253`dtG\256\313\345g\347\225#\\jp\335\265\236\217-^C\256\273\345\314^\220)\245\271J\0332_^aK\3507\210\305\362=\333,\233\242\333\252\207kZ.\210\372\342eG\246\233\210:\377\252}\263\374=-Vi\323\215"
+	.ascii	"j\206\006V\344\272i:5UP\214\\q]\264U\222 &\203j\\?F\007\247\206"
+	.ascii	"\027\335\220\353O@\371?[H\354\356\0334\310&\016m\2764\273:\377"
+	.ascii	"\315\362V\201\356\377<\0333\335JZbP\2541"
+	.string	"a\017\256M\323lt)\354F\036\213GG\036L\244\313\346\024MX$\3661h\"\355.\242\251\260{i\354b\272\354b\315\362\030l\3441\210\"\273\330G-4\232H\217\216\305ty,n\272lb\037\t\211\001\244m,\366\362\bfS\344\221\230.\215E\023i\227ZqICm\307\036I\217\332\306\322\223\220X\242\231\"\215\355\326\275_HMT\240\373\311Ht\023\362\260d\303\246\215a\230\320\270\310\356.`i(e\354\243f\212\304\330\215d\030\243\227X\004\221\315\246\332f\020\310S+!u\033\260\324\035\334nvw\260\273{\304'd\267S\211\324ji\251\273\211\200\245~\n\226!u\363\327\020\001K\036\235M\007K \207lA\254\352\250\310\335xr^\236\2258O\262\304\024\271r\222\213\221[\253\244\321\362C\352\210+;\331.\036\223\020\016\fk\361\324\244\326\206\\9\213\231\254\326\317\270\311\2218"
+	.ascii	"\230%E9\023\202>\207\375\331\311JXj\310\331\352\b#\341\315\021"
+	.ascii	"\031\007\330\223\253\2533\2223VO\213\237\345T=\275\361\r\224"
+	.ascii	"\215\234wl1\221\326\270r\221s\216\036l4\267\020\0013dG\325\022"
+	.ascii	"zF:\236\201Lq\025o\255{(\001r\350\326i\252\203\223\246\003\034"
+	.ascii	"Z\220s\325\231\252\247\305\337H\204\r\2214\240\242\244\215q\302"
+	.ascii	"\225}\370\333\271l9!\271r\017\217\003\200\013\026]\331\326\327"
+	.ascii	"\020 cP\226\202C\031\307\231\007\034l\344y\261\351`\262\231z"
+	.ascii	"]D\246\250\221\351\264I\347&\216\210\\\023\036g\343\371G\227"
+	.string	"\341\217%\\\331\307\227*\214W\372\304PG\276\204\235\031C\271G\004PDD\231\341zv\n\262\205\310\017\\y\317<\271i\225\357\336\232c\035\347\035\377\210\021f>\246\216P\320\237s\200\265\365\260J\242\337&\314\304L\\,\240[\b\037IWKp\340\230\3033&\236\213ch[\034\017\250.\034%v;\264aq\r\256\301KlB\254h\254\024\373M\351\274\304C\373B\272\343\312;|\f'J\356\206S\021>\342#N\221\315\264lKIWdlt\214I\n&\235S%\013'L\204pe\2443Y\352\306\223\025W\246\261Jt,\211U\021\314\252\243\254I\032U\021E\260p\273\225N\344P\036C\2450\034<\0137\331u\307Tr\345\336$giM!q\335\273\365Z\2061B\205\353\2369\223\006\214V\231\331\253\364\200\024\221zM\225)\263v\026HQ\311u\323\223N\r\026\230BCC\032\370\320"
+	.string	"}z&"
+	.string	"\376|=\240\317\013\340\317g\324\003\372\004\341\340+:o\230\001\364#\002\026\365\202\210\214f\324_\220\220\317\317\007\024\362\031\271\340\343S\342\206\031@2\202d\234\217\261\"\206\237\217\bX\264\023\364\202\221\020\320\317\267CTd\264#\200\220\220\321\3577\364\353\3250D\024\0038\364\353\301\360\023$T\201?@D\300\242\323\203\236\f\200E?0\364~\206\2000\324\237!\240\257\372z~x/\364\374\360~z|F\365\247\307'dD\363\005>4#\210h\00784D\264S\363\323\343\363\251\007\362\021\005\375\202b@\317\302E\004.^\330\320\373\013\030\022\300\220\340\374\013\030<<0\\\360\240w\301\303#\372\211\001TO\001\005\033\244(A\204\017P\240\025\277!_\021Q\020\r\277!\240\240\0317"
+	.string	"w~C2d\f\001\355\374|?2v\200\210\212vV(\300p,w\216\3437\233#\216\253"
+	.ascii	"\354\252\240a\022\021*\317zN~Y \240PQZy\251B\341G\322\323\020"
+	.ascii	"Hj\322\202$\271\235\273\234\225vU\326\270pe!x\013\t\251\260f"
+	.ascii	"\223+\267q\023\307\353\250\003\031\333\262\212\221\210t\355\314"
+	.ascii	"e,J+\341\312Zx\313\325\222]9\222\334\324*\022\244\371\251$X\212"
+	.ascii	"\020I\2709%\325e1\322\2241c\023\242&v\2221=\361J\343TX\204\251"
+	.ascii	"\304\225\203`,\253u&\237-\325\225 \025\023\324\206\036\223\255"
+	.ascii	"\254\026\n\276rs&\353\214\335\025\372Eq\356\335\2428\317U~6c"
+	.ascii	"*F\\[A\366\304\331\300\346\234L\306s.#\221\326H\207pe`s\316\237"
+	.ascii	"\307\262\320\234\271\263\323\342\3725\204\305xs\030\264\322\233"
+	.ascii	"\221)jdn\304\234\262\214Q\316b\347\260\236\026\254uc\203y\244"
+	.ascii	"\343\312R\316PMifr`\f\2055\265T\302\365\021\240\311\035\305\""
+	.ascii	"\024\257$\347%I8\201Y\250\2410E\030523#\""
+	.string	"R\220$I\007q\005\204\030\346\240e\035\021p\255\202HfD$IAI)\303\034\211\005"
+	.string	"i\207\r\340\021R\313\013h\227\243\252]\255C\263\251v\224\254\203T\262\244{_~\261T\227\\\\\037\006\214\333\024$2\025p6\f\026\314q\031&\304\341\324\322ab(\344\340\270.@\033\307\214\n^\275/[\022\247+\327\375\357\340\311[c\024:\272@\360\207\242\335uX\\5rU\3570l\253\341\263\204\003\350\272S!\374K\331\254\253\300\237\335\224\314R&/VA6\371.\337\037q\202\t0\265\254\365\023\231\224\307U\257\232\220\251\266,\3103\241h`\375\200\nO\376\031#\354\361('\367W2DD\211rHt\364"
+	.string	"\r\262f\372x%\016\t\207\241\216.\tA\213\331\361\255S\257"
+	.string	"\210\326r3\371\\\323S\f\360\3358\034\"^[\330\263\"\017\\\026\364Rv\323\251v\033\230a\026>\360{\013\301\351a\250\344!\022\310\024\217P\034w\341\031\253c\242\202M\332a\215O]\260B\210\303\n\210\270\020\211\221W\202\203$p\2115\025-i>\344\356\372\274\026\330\030\207\022<\364\241\351c\347\\\300U\231\262<\r\035\031\374\204\327sJ)H\266\017\233\n+\245<\224\334\320\030\004\303T5\200cha\357\200\246\224\b"
+	.ascii	"7\016)\335\321%qM\371\337P\344\252O\356B\251\224P\324\223\025"
+	.ascii	"\177\034>\006<O\370r\3408\354\313\366\355\033j\262\352\270\243"
+	.ascii	"j\372{~]\363p\035\342\304p|P\340\343W\314\322\366\026]\271\036"
+	.ascii	"\246H,\217\025RKi\013b\007\322\250$J\353d\235 1\362EC(E\002|"
+	.ascii	"\032R\241\362\361\bJ\270Y\340\2109O}T\b\216gQ\240\324%\3037\247"
+	.ascii	"\357!\244d\353O\226]\032\210\212pFy\\\317,\316P\324PeJ\230\031"
+	.ascii	"\210i>\220\263`\006\340\333J:\016\03095\334\360\214\252\220p"
+	.ascii	"\f\360\242\267{\313\203\276\r\261\273Z\013\264\013\005s\204/"
+	.ascii	"&'x\037w\257\377\034\204\205\177\234\344\325\350\317\224\r\036"
+	.ascii	"i\276\305\351\357\177\273\336\005\333\235\267\310oz\377\005\236"
+	.ascii	"\312\036=\225\217t\302\217\020\231\363=\004l=\237\220q\334X\376"
+	.ascii	"\023\275\244\227\300[}\211<\331W8\355\3405|\200\337H\354%\356"
+	.ascii	"\303\177\322>\322/1\376\035\337\036\210\3360?(\357\020az-\216"
+	.ascii	"#\203\207t\223\276\371\007\352fZ\253\fwX\005"
+	.text
+	.section	.gnu.lto_.symtab.dde54e048c27d5fc,"e",@progbits
+	.string	"uli2a"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346"
+	.string	""
+	.string	""
+	.string	"li2a"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353"
+	.string	""
+	.string	""
+	.string	"ui2a"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362"
+	.string	""
+	.string	""
+	.string	"i2a"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367"
+	.string	""
+	.string	""
+	.string	"a2d"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373"
+	.string	""
+	.string	""
+	.string	"a2i"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\001"
+	.string	""
+	.string	"itoa"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\001"
+	.string	""
+	.string	"ftoa"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\001"
+	.string	""
+	.string	"fastA2F"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.dde54e048c27d5fc,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,697 @@
+	.file	"config_eeprom.c"
+	.section	.gnu.lto_.profile.a1e1f8f0161ddaff,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.a1e1f8f0161ddaff,"e",@progbits
+	.string	"(\265/\375 \277}\004"
+	.string	"\244\006\263"
+	.string	"\t"
+	.string	"\225\200\300\255\007\b\002"
+	.string	"\002\001\002"
+	.string	"\002\002\003\002\001\002\226\315\265\355\003\"\002\003\002\004\005\003\006\002\002\005\007\002"
+	.string	"\002"
+	.string	"\002\b\002\b\002\004\002\004\002\007\005\233\364\343\336\006"
+	.string	"\006\315\341\340\227\r\n\002\003\002\t"
+	.string	"\007\240\342\234\212\n\b\311\306\266\303\013"
+	.string	"\t\231\271\347\247\007\001\n\333\263\352\242\r"
+	.string	"\013\240\342\234\212\n"
+	.string	"\017"
+	.ascii	"C\003\364\021\206\032\342!\004\035\006\330\335p\346\324\237'"
+	.ascii	"@\233\235\273\025\315>\307\332\235\262\322\026\f\260"
+	.text
+	.section	.gnu.lto_.ipa_sra.a1e1f8f0161ddaff,"e",@progbits
+	.string	"(\265/\375 `\035\002"
+	.string	"\364\002T"
+	.string	"\007"
+	.string	"\002\001\002\n\002"
+	.string	""
+	.string	"\002\001"
+	.string	""
+	.string	"\004\003\002"
+	.string	"\003"
+	.string	"\002"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	"\001"
+	.string	"\001\005"
+	.string	"\001\006\b"
+	.string	"\003\t"
+	.string	"\003"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\007"
+	.string	"*3vF\341\016\f\325\232]':\255\332"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.a1e1f8f0161ddaff,"e",@progbits
+	.string	"(\265/\375`2\001=\t"
+	.string	"2\r.30q\222\016"
+	.string	"_\220T=\314\351\337\234\300,\333\236\340\022\367\001K\300\231:\354\322H\350\347n\301\303\022FD\204q+\234\202\261\302v\262\374\267O\266\334)\377gu\021nd&\350\241\037$%.\005{\256\354\263jQ\375\b_LL3\004\020m\251\006bp\300B\213l\200\377jW\252^\324S\210\207J\302\2504\250\t\231\320\225Df\226\036\347\374]\355\373\303\356\253\341?\300\371\017\263^"
+	.string	"\377\212\030\f\026\205\376E\264e\345\2241*T\266\003\332\324\240\334\340e\267\241)\0320\251\273\227\241\231\231\325\223zA\321qr\300\036\367\364\276\217T\221\021\016\023\350;\027!/ `\002!F\306\007\313"
+	.string	"\016e 4\261\003\031\f\227#$lR\227\261\0278\322\022\330o\035\301#\272`\237\020\334\226\021\033Y8\316VuCy\013G\n\300\354\217\326\371\001\355\f\300\334\030\013\023\355&\"\362<\211\030\207\005?\201\261"
+	.string	""
+	.ascii	"\005\304\006\213\t\350F4\034\2670\"\356j\003z\341\204\214\\\273"
+	.ascii	"{txe\273\013\356\006"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a1e1f8f0161ddaff,"e",@progbits
+	.string	"(\265/\375`7\003\345\t"
+	.string	"2\314\"&\220)\031\016\273\377\270\324\201\222\264\352\266\221\273\253\263\265X\221\256\304\356\276\b\326\245\212\202 \374O\232$\233\310$\003\333\266\321\223$\037\224\334\002\266\023Jt-\346O(\234N\n\300\246\020\020\201\230E\252\t\035\207\216\223~\022m\320\361CY8\303\026N\244j\021e\237\202\336,\374\366\341\0373u\323\335\2243\365\006}\003\374\3558qH\325#G(\027\272\3037\234f\364\031\345k\020=\033=o\334(\300DnyN1\264\bK\250\261\275As\222Ba\3303\200\"!:\353\001\022 #-\001\006\004\0213\002$`& \232\231@\371\026w\370?<\233UQz\204\375\367h\017\002i\205;p>_\320{\225\327>\tA\253\201\343"
+	.string	"\213\366x\003[\210:\201\246\265\207\342\013h\344=VG\214\235\317T\350\016\231\241\b\211n\326\035g\262W\224<=\214\220I=\004iYC"
+	.ascii	"L\223\243\267,\232\2538\001\017c9\274\371\022\307;8\254s0\276"
+	.ascii	"\346\323\207\340>GJw\200\261\315\032\021\017\207\255\301t\355"
+	.ascii	"\326v\305\300\311\357/\023b\244?\204_4\361\255\273\316I\006"
+	.text
+	.section	.gnu.lto_.pureconst.a1e1f8f0161ddaff,"e",@progbits
+	.string	"(\265/\375 \032\321"
+	.string	""
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"\007"
+	.ascii	"\265\004\002\231\004\005\200\004\006\271\004\b\204\004\t\231"
+	.ascii	"\004\n\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.a1e1f8f0161ddaff,"e",@progbits
+	.string	"(\265/\375 \221\255\002"
+	.string	"B\305\r\025\300\027\2061\377?\364\377\377\177\337\215\334ks\273Q\022D\312\024?1\023\341\017\266\nS5+\3046\326aEV\206\001\236\251\224U\311\364\254\314vA\021(vL\004\013"
+	.ascii	"\020\260\020f\240\004d&\233\235\021\241\354\240\330p\323\326"
+	.ascii	")\003\345l\016\006X"
+	.text
+	.section	.gnu.lto_.lto.a1e1f8f0161ddaff,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_initEEPROM.11.a1e1f8f0161ddaff,"e",@progbits
+	.string	"(\265/\375 \310U\005"
+	.string	"b\311#-pU\323\001"
+	.string	"\355W\340\257_7g\017\230\257\220T\025\216\021\023\250\371\212\254\351\rXD\214U\325I7\306\3066G\025Fn\355\336)\005\246\246k\322\254\252\030\017\313\201MJbV\343\222\024\205\310\351\340\231UTF\346\244R\252\373\350\031$qb\327\r\306\213\375\300F\317\206\212\372\215\n\241\335J"
+	.string	"\300\202\004\237\215\355K\326l\321kf\337\321P<\337\356\312\210\271v\250\371\347\234\300u\333\341`\261\273\206\\g\271\343m#l'l[\001\t"
+	.ascii	"\252\244\233iq\316\f\001_\356\032\236\026\302x\031\002\\\272"
+	.ascii	"E;\237"
+	.text
+	.section	.gnu.lto_isEEPROMContentValid.12.a1e1f8f0161ddaff,"e",@progbits
+	.string	"(\265/\375`8\005%!"
+	.string	"\326\373\321H\200\030R:\243\020\202A,\210\303\354g+\214\005\363YF\275\236\371\366I\205=\033\002\330\314]\340f]?(]W\231\334\363\t\272\337g\216\200 \3301y`a-\005^_@\031\306\221\003\336\017\365\355\377{\023\271\223\f\300"
+	.string	"\265"
+	.string	"\300"
+	.ascii	"\374\257/\231\307W>\t\323\301T\234\367\205\362Zi\210!\246 \367"
+	.ascii	"\312\312\334\273\216\204\351^K\300'\345\255r \243J\227\201WF"
+	.ascii	"\220{\335y\217}\245\347\261\257\234@\001\0237]\231<\376\306\227"
+	.ascii	"Q\211\333\275\312`\347`K\233\316\333\351r8[\317\246M|\247\363"
+	.ascii	"pF\367"
+	.string	"^\013\\k]llXe}\2073\"\332Rf\t\246\t\220\253\353`\344\270T\275\340!\213\024w>\220ru<\363\224\ni<\351\2160m_~(H\025\026\265W\257g\317\261\207T\017\271\342,`&\212\232\363OY\357\036\022\352\004\336{\277<\235B\026)\305\031\335{\231J!\255\3168g\346+\314\\\304\\\001\004\364\303\2378A\342\256\006TZ3\272h\007\240\352\272\026\f\033-\316\336:\035R\226\306\252{+y\241}\207X\212\201\242m\230\031\304\305\204\271{\241\212\370K\036\206\324m_\212\360x\345\021C\034\220.n\367>]\352\225O\302\276\276iP\375\230\201\304\353\2116\231\225N\264\267\230O\305\2020\261\270\265\230\2312\321\020P(\b\350\307\207)\363\374|\225\362\216\216\262N\216r/G9\307R\306\251\224y9\312;\034e\335\275\316\270\246l-\345z\260\363Y)\367I\231\236\224?"
+	.ascii	"C\232[\033\200\260{\217M77\255\222\371\270\327\017v\312|\346"
+	.ascii	"3\231ygf\n\306\267']w\333\033\2235\034f\272\336\342\032t\374"
+	.ascii	"Zf\201\242m\372\fk\211\232\334\026\t\003\326\264<m\002\201\265"
+	.ascii	"{\357\202W4z\357\371\314\276\332&.\321j\373\332\366\337D\t)\322"
+	.ascii	"&w\327\256mk\212`\302\336\232\255\306\0176\270\336\3423\177\244"
+	.ascii	"\346\3068\246\373i,\306\260\352\323\277\236:\363\021\324\336"
+	.ascii	"\214c:\240\376\362\277z\346\261\fqTh\256\374l\003\237\331\354"
+	.ascii	"\253\257\247\230+\330n\3422\f\205\233U\240\322\341B\016C\237"
+	.ascii	"y\272\343\230<\357\275\327\366P\372\f\226_\306\217r\262\rL\207"
+	.ascii	"\366\265\233\315\363\024\313\314\301\003\275\224O\2278\242dc"
+	.ascii	"&\252\235\212\\X\321Q\275.\264\001J\027\022\205\315\302\003&"
+	.ascii	"\222\210JHH\037F\fE\234H\022\006O\fA\230\b\n\211(\202\007\004"
+	.ascii	"p\222\022\0221\230\")\211\030\344)\357[\213w+d\030\307vD\375"
+	.ascii	"\345\217\324\240\204\2155\277\311\362\3604\355b\026\317\376\032"
+	.ascii	"\327S|Z_\237\f\216_\262\300&j\013\\e\214d;\315g;\231%>\017\206"
+	.ascii	"ptd_/uF\247w\232\2461\276}\3140\200\230\241\326\351\024\\fQD"
+	.ascii	"v\347\261g\017u\217+L\250{\300\240\356uQ\262\371#?[\250{I\264"
+	.ascii	"(!\305K\371\3319A\270\316I\226\031\177Z\306X\354p\332\327@\375"
+	.ascii	",\274\306\361\302\353\232\244i\244\207\352\332\327\273\376i\340"
+	.ascii	"\257w\375b\250A<\302\220C\210\031\021\221\tF\244Icp\002\231\241"
+	.ascii	"+;\021`\265Te\304\220\215\003*T\253}\033\347|\263Iz\207\r\216"
+	.ascii	"\025%\2725\351\306\244\371j\\O\305\"\362C\256b\022Ij\316\210"
+	.ascii	"\335\301\204\001\320\253\367\314\"\220\t\330\313\345\331\005"
+	.ascii	"\374\336\001\005\314.\223\001\n\312(~\372O\221D\006Fl\032\354"
+	.ascii	"bt\003sf\006\370M6\334\003\357>\237\236UI\3018\370\204N\205\255"
+	.ascii	"4^\340n\223v6\030\270\007;\340\365Z\211\217\304\024/\236\213"
+	.ascii	"\032\216x\211\004u\200#\233\221\224\217\177k\223\207\324\003"
+	.ascii	"\3772\177\337@\002\2705\331\305\327\327\030a\3146\312\266u\353"
+	.ascii	"K\310\347\3230\216\360Z\257\370\004\373\200sI!\271z\234\3662"
+	.ascii	"NO\031\335 \020B\275)X\r"
+	.text
+	.section	.gnu.lto_getEEPROMConfigSize.13.a1e1f8f0161ddaff,"e",@progbits
+	.string	"(\265/\375 \373\315\006"
+	.string	"\"\315/3`m\322\001@\203"
+	.string	"'\244g\b\213bZ\366\017\202\236\216\317=f\b\323\232\265\036F[m\241\305 \361\b\202\204\215\245\321\356HH\273\367O\357\266R\246\024\2360\032\3678\024\305\360\220q\330\270\251m2\r\2326=\210\2069\260\343P\257E8\367\332%\356U\224j"
+	.string	"\322\t\373#\217\320\357\260D'_}\371\035\366\225\032\200\001\312\222\035?\251\032\366-\273\273V\221\355t\252\200IJ\002\311nEieQV\211\207m\217}\361A\036\3421\3148\262`\244\021\005Ie7\266\201\027\260\257<\001\373\322\215\303'\364/r\313\007\307I\025\372<\001\026v\327Y\205.n\275m\004\333\n\2663\002\b"
+	.ascii	"\252\244\223\261\230\300\0311q(w\r\311B\344\341\256\230\332I"
+	.ascii	"\006"
+	.text
+	.section	.gnu.lto_findEEPROM.14.a1e1f8f0161ddaff,"e",@progbits
+	.string	"(\265/\375`\317\003\345\032"
+	.string	"\026r\256G\240\230Q:\300\023\255y\211\031\327\230\316k\272\222\277\276_\231^\200bL\313\035\336\2363\021N\266\034?!\327(\034\247\275\224\364W>\001\257\311\223\322\340{<\021\277P\032\005\254\031\302uM%\257\366I#{\313\235R\235"
+	.string	"\214"
+	.string	"\237"
+	.string	"\025\310\340\324\025\026x#D?\242b\356T$\252\035\017\306\323\002\323R\376\267\342<\265V\271aR+\260\201\035\214\247\037r,\"\027\r"
+	.string	"\372\242t\204@\226\204ij\005\322\f|"
+	.string	"\361t|\217x\272:<e\321e\261\021&\322\271\262\310gq\031\007+-XjrD\315xlN\270\f9\316\005\274+R9PG3\300\325S\f\t[\022\225\350\234\300\273\"\365\341\245\023T\322\374\026\2520\027\336\300\325\323\f9\035H}ePR\2270\n\265VK&\250\250{v\333\\\266\201\354\265\021^A~F\362\313\377\254\265\326\271=K\330\356\207\037\303T\3112\356\212\333d\377\353\304\b\0134\273=\033x$\337\340\367\306\205\267\312\026\245y~\344\337\021\245u\376\373sFi\034K\313bcL\032\366\254[\034\245\251(=\247\364\302\244\245(}"
+	.ascii	"\002\270\360h\364\202\254\027`}\361\325\246j\241Nx<\353\267\357"
+	.ascii	"\017\257e\317|\342I\3543\345\343a\325Z\217\304\236\235\260g\247"
+	.ascii	"\267\211|\241g\266\263R\274*=\305\232\222\204\214\251\001\357"
+	.ascii	"\002\262\002\242\203o\265B<\325\331k\035A\213\037A'\"?)f\224"
+	.ascii	"\260\201m\317\324g\212*\210\005I\256\341R\203\351J\364\024"
+	.string	"\017\t|O.\345\203\002_\2555\002\224G\221g\262\211\247\262\326\273kQ\004\275\344\306vWFQ\362q\264RA\016\257\240\227\341\033#\371\265d\316l\301A\267\347\013\017@\036\311\233\330vX\322\370K\316$\3105\233\004\030_\214\316t*o1s\305\215m\223q\342w\027\004\203$\327\330\276]\tn\254\025\t\202\317Eb\304Xk\275\325\251_$\236~\351U\026\361s\323\321n\272\036\335\205r8\023A5\\\b\334\320P\020\211Z\316\315\266[\327~J\344v:\233\355\303\r\027B(W\243\t\341\202J\320j\273!\332\317\001\347t\266\035\315D.\267\243\315l\364\255\262\024\277uI\277\365\013o\241\013\225\341\222\371\255;6\256L\266r\217ds\214\355\270M\236=\270\224b;\013[\024A08\013\353q\263\364f\357#\322\305YK\373\302\265`\240K\313tQ\363\033NI]\343\366\314\2633\303\263"
+	.string	"MYd\312\307#\362#\360u\r\242\316\362\354\2003K1\264\274!F\250!,\302\230S\210\221\022\241h(H\\\r`\002\031\032=\017\020p9\323d\330\f\330\264\264\354e\300+\351\240{9\262\361R\020\361pf\326\272D\246+\337\035*4E\300\343\356\021\261\310x\257U\264w\362`U\312\246\211\205W\225\352l\214%\020\2567@\005\233\006\255\225\025\037\0059\370=\227L\021\214\\Z_\233\242<"
+	.ascii	"\211^4\200rZ\325\262\3118\241\201\312 U\224|x.\213\034\313z\332"
+	.ascii	"\306\245\376;|t\376\214\254DEF,#\032\327\201\252]J{\0077\212"
+	.ascii	"T\356\302\220\006"
+	.text
+	.section	.gnu.lto_loadEEPROM.15.a1e1f8f0161ddaff,"e",@progbits
+	.string	"(\265/\375`\261\002\355\025"
+	.string	"\006\252\223I\300VQ:2\275\357\037\240\347)D\220\212\244\357\220\206.\"!\260\2758\\\233\n\255\214.\366\264]\326\377\253\317\3729OK\271B4\365\223\242X\022E\025\246\220Ln\242+rs\373\356\276(C\364\326\221\220\275\267\224I\006\177"
+	.string	"x"
+	.string	"}"
+	.string	"\341_\350\347wqvO\333 \006ga\027\177n\327\035\251\355`\252UT\265\213\245A=GIA=GJ\227\342\027d\330C\220N\331\f\333\343x\201\032MK\224\214p\261\207\022\244\335d\\\211\016\217\224\371\371\220.\312\030\244\221;\335\371d\301\355\\\312\227\236\243\244\026\034M*H\nRq\336\371\004n\306}\361\214$E\246d\204\313\235\301\b\265\326e\033.\305w\345\273\013\264\2732\273,\024}\336Yl\030\321\241\342\243u\254\213\206\320p\335\272]1\3062??(\333,vS'\372\242>\364\rC^p\362R\220w\202\274\222\362\366\344e\311{\027\232\025LQ\026\214\265\336\306\246\232d\"\3158\321?t\336\375\356u\354y{\"\032!+\217K\235\355X\002\212\331\347\330\213{\372\334\013}\207\363!\022\2579:+\267\036\023_\255b\202\317e\020~\256x"
+	.string	"\3643(^\314"
+	.string	"\314M\033\354\013\030\370\266\205\260\242\326\261\335\377p\335\266\233\341>4|\202\335=\333\316l\332\177R\253\222\032\307\361w\020T\366\354\331\313\361\221\361\270\335\262_\233\271\021M\267\201\245\335\233\273\205\327+\252\2625\357\301\nk\2359\330\027mh\205\265\326\307\370|\267O\016\310GhW\202G\3365MY\222\255\333\021\024\325\003r0xMf\374[\024\357mh\330\273\035n\3706T\254\326\2539\264^\275,\230\033\327\353C\253E\303\301f\203\007\027K\345\301\246\346F\305z\205P\301\020X\327\207\326K%\302\345z\251Nb}\2638\214\036\307C'Hx\250\370J\264\314\027\266n\037\250\240\251\006\177\274\022V\007~\302>!d\025\326\232s\333\036\310\203L\220KaEo\373\334\257\032\325\202Wd\306\277\313Zk\005\021\374\205\206\235\352\213\2277RH\221)\361\260!\343\221\251"
+	.ascii	"\256`a&\t\223o\326\261\233 \022. \220\002\221\302\352\006\352"
+	.ascii	"\351\016\f\017\332\240ST\274#K}\335\256M}\375\230.\nY\300\211"
+	.ascii	"\257\270\261\204\351\360\206\231f\330\212\365\302\225\037\213"
+	.ascii	"\361\340\200_\030\322W\376\340\016\204Q\226#]\303v\206\320^\020"
+	.ascii	"q4\365\024\340\350M8\271\245\007\243\231\245x\030\n\r*\255\201"
+	.ascii	"{\201\036\207\250qYa\244\007\t\256\361\370\215Wk\310"
+	.text
+	.section	.gnu.lto_writeSettingsToEEPROM.16.a1e1f8f0161ddaff,"e",@progbits
+	.string	"(\265/\375`\033\b\305."
+	.string	"\372R,\022F`\\N:\377\303\252\b\bd\321\177\250\371\273\255)\025\263r<\207\34388\357\375-\371J\206~=\f\257\317\323\352\022\351\026\333\2754k\260|\205\200\221F\0213\026\216\337\030\035\035\026\274\252\n%\226\020\262w\222\001\013\001\377"
+	.ascii	"\023\001\177\273]w\260\223\257\353\036#pVr\316\301\271>\264\203"
+	.ascii	"`\036\006\353t.\330L&\202\tD\212\275\032a\275[\377\013\334\343"
+	.ascii	"\260.'\325\363\225\367\003\351d\037\264&\273\203Wq7V\377\354"
+	.ascii	"Z"
+	.string	"\376<\227\257\275\255\203]\356\005\353l/\236\273\300@\250\371[\301^\275\231\350A\253Z\025\233\311X/\246\227^\316`(\266\\\261Y\216e\256\211\351\345\354,\221\026\203(\013(o1\261\220\345\f&\342h\317\202u\247\f\"-g\006;af'\327\304^\005:\201\365\352}\320z\365f3\210\262\234\371\353\302\231\323\354\301\325Nb\257\266\004\nX\335\3369\366\005\344\362cr\341\313\331I\304Jz\225\"\346\266F\212\230[\336S\347;\275\355\325\024\337\266\337\366\242\347\233e\036[X\326\325\024\310\365\365D\030\306\2252\365\351\315y\205-o\032E\307\361\277\374\202y{\346\261\205\351\370\005f\3109\367m\206\341x\257\357n\255\356fv\263k\370\007\216\n\203{\337\226\255w\373Z\213E\211M{\326f\271pQ\360\272pV\037M\003\373\261'X\2739|\255C\027\325'\027\2769\b\356\315\371M\267\036\177"
+	.ascii	"\021\034\322\3654$\212c9k\275\331?s4!\372M\256\366\b\022\367"
+	.ascii	"M\022\353\325c\2466\346\237\326\215v\201{\267\267\225`\233\335"
+	.ascii	"&P\3347{\200\031\275;z[8\253\333\271\274\030I\367\231\306\372"
+	.ascii	"\364\032\037\351\026\336v\022\336n\022\336f\022\336^**%A\020"
+	.ascii	"\336v \340\366\321\315\336EC\007\204\267\205.\367\006\372\226"
+	.ascii	"\367px[(\274\375#\274\355#\274\035\034\336\0060\274\3353\274"
+	.ascii	"\315\016o\003\003\334^\003\334V\201n\247\303\333Xx\373\376\334"
+	.ascii	"~\205\031d|q\210pr\376\212\372e<u\016\312\351~\271\337\354w\376"
+	.ascii	"i\377\226_\355g;\333\375>\231\227\211z]\003\227a\254D\211\371"
+	.ascii	"\035\362u\255>\343\370\220\335\001i\267;\232-\217\365*\020\366"
+	.ascii	"I\362\034\263u\373\236\346\234sz\364\240\025\b\027\361\277\334"
+	.ascii	"\303^\231\231\256).\322\234\213`\320KK\361\212\201JI\030\210"
+	.ascii	"\237\307k\305A#c\312\320R\254\342\327M\350V\3542\333\037l\223"
+	.ascii	"\253*Fj\203\346\204S,\341J\324\350\336\345)\340$L4\304\030_\270"
+	.ascii	"b\207\371\307\340\256u\207\266@\212u>pwx\t\204\034zD\344\320"
+	.ascii	"\016\016\360\021>\363\317g\t;\300/\3634\212\022\347\331\232\332"
+	.ascii	"\037\223\221C[$]<\364FK\270g\036\333\236V\235/a&,D\347\256[%"
+	.ascii	"\357k\227,\341\337\275\210F\225\213\273[&\207^u\221\252\fNso"
+	.ascii	"\275\321\352\204/>\364\017\236q\313<\265 "
+	.string	"\313\033m\005\321_\255M\330\t\033\240c\366X\332u\353\344td\2609o\025\373sR\264P\372M\244\326\253M\370v/\3622{\2729C\323\272Q\274V\307\025\206\333\350\036\316\211c8\032}\323\255\335\255\224\226\312}\363@\335\002)\212\212\030E\025\004\245L\032\217\3125\352\250\304\312\243\324\323QiU\305*\217PO\307\026\253Qi\304\312\243U2\311b5*9L=!\241\246:D!7@\035\255\224G\030S\310\001UUG\243\361\252\n\330F$\251\244\222\352xT\021\205d1\2254\022\247\220ORD\243\262\212\210\264\240\223TG%\321*\231T\022\203N\255\247\351\020C(\302\302/*xZx\3312\2341\322\252\324^\260=\270\020\027\341\347a\316Y\270\313\266\306}S\210\237\006O\266p\231m\r x[8KK\353\265\025'\206\367\203\357\374\233{\370\007_5L\037B8\210}z\230:"
+	.string	"`!\334\227\371\367\343C8\210\205\336\272\376\330\036\f"
+	.ascii	"\277\313o\b\367\340\32713Cd\207 `\026\027\315\326\236\255\215"
+	.ascii	"(\336\215\326\356\366\353\317\253.\276\355\r\236dT\214\244\227"
+	.ascii	"|\030\365\335n\303Z\036=h\336\370\200\260\327\241g\375\354\334"
+	.ascii	"\300J\370mg\335\310yr\017\340!\366\352\213\243\345\301\346\334"
+	.ascii	"\005v\303\332\034\001\200\236\250Q@\304\020RH\211\210\214"
+	.string	"\310l\232\326\200\002\021\252\252z\021\220\255t3\242\260I\245\260\354\006Nz\256R\360\367\337A\272+\002\307\213\256w\316\370v\271\317\f\003\3507\243sJ\244\025p\n7\244\334J_\360\304\330\235\346pE\2728\020\237\366{\204\267\037\267;BF$\222\234\206\201\033\235\260\201{(\334R\342d\217\027 H\227\006nz\361\2772\023\262\223Dd\303 \232DZ\016\016\315\372\030\367\365\202p\372>#\224\273\032\330\231\347\342(\275\030\002\017\005\250\216Y\306,\367\241\345\fvS\005\253\331\017.\007\033\t0\035\331\004\340X\036\270q\323\230\002\362\272\376\326\007\320m\301\371\354\257WUE\3749\237\243\371\222\275\345\236'\006UX\242\360\274\021\314\016\224\245\316\030'\232\031\206\217\216|\2229\326N\"K\252,5:\363\362\347S4\330\037\267G/\270\f\201\201\016e\n\314\346\241\345X\354\341\215\005\231\324\303\254\025\036"
+	.string	"\367"
+	.ascii	"8\024g\220\211\321e,1\n\0307\314\362\277\325\242\252A1\311\314"
+	.ascii	"\221\321\017\262+L\334A\310E\036@>d\236\006O\244\206\303\225"
+	.ascii	"\231\024\021\274\264;\250kjH$/\304\250\001"
+	.text
+	.section	.gnu.lto_writeConfigToEEPROM.17.a1e1f8f0161ddaff,"e",@progbits
+	.string	"(\265/\375`\030\002m\022"
+	.string	"\246\"xF\340\320(\035\370;3\341\363D\020A\247!T\002\377\004\304#\265\022\350C\272 \2414\234[\274/z/\374\306\327\236(a\265\356\350>S\317\030c\214\336\222\032aR\322H\0341?X*V\005\037YB\366\2262\245e"
+	.string	"^"
+	.string	"b"
+	.string	"\tB\217f\331-\376y\330\347\354\274p\200v\267\2443\326\303\357\206\311z\310\353\"\324d\371"
+	.string	"d\255\207\n\304\274\300\334\203\0364\235YG\317\006\026\017q\001&;HzA\222\255%#\034\355n"
+	.ascii	"Y\005\210 &s%\0041\273\336\346i\342\305\215\017\t\331\354\351"
+	.ascii	"\211\354\256\023&{\2717n;\306\266\210\235\036\001\255\374*\007"
+	.ascii	"{$\372\355\366^\273\273\247\343\323\360i}:\237>\007\201\027\264"
+	.ascii	"\f3(\324\347[\227 \032\313\023K|\370\355\257=\355\333\257\361"
+	.ascii	"m.\342\037\3537\347H,\337\312\030\324\214\330\005\241G\322;\272"
+	.ascii	"G\370\001\335\343o\263\310!\nX\257\251\220Z\337\272\204\330\200"
+	.ascii	"j@\273\337\307\243\003*c\0014:z\220\263\342\205\313\217{\032"
+	.ascii	"3\324\353mw0\223\342\205\313\343\274\323\230J\007\265\301\017"
+	.ascii	"K\312\260*\254\361\202\351T5\346^\030V2\310y\347:OS\341\316\213"
+	.ascii	"\306\225A\207\273\273\320\007\356\351H\017\243\006\327Bse\220"
+	.ascii	"a\332\024R\362\260\353m~\013\270\034\217K[\272\273-U\031\373"
+	.ascii	"\013\253\223\222\323j5\342\251T'\223\tE\345\331\004R\202J\235"
+	.ascii	"\234N\020$\220D0A\231J&$#%%SJU\0021`\324\311)UZ\241P\251\222"
+	.ascii	"\350\333\213\254\250\313\017md<\252\263'\250\3620'.\006\017\213"
+	.ascii	"\266\374C\323\231y*\343\250\357p\203\222\222\207ExB\203K[\376"
+	.ascii	"v\267\203\260S\221\306p.\342\270\315\350q\241\34211 \240\002"
+	.ascii	"\231Bz\312\351\204E>\274\225\260DB\005C\bv\257Y5\356wEx\005i"
+	.ascii	"RVQ|\305C3O=\254\256:\020H\\9\301W484\343\005\241\373\2053\312"
+	.ascii	"s\343\0017}\256=\254\337h\354\206\326\236{\002\232\210\267\025"
+	.ascii	"7\002\353\342\314|^pcd\b\355`\274\035\351\r\354\312\330\337\311"
+	.ascii	":\214\310\353\022O"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a1e1f8f0161ddaff,"e",@progbits
+	.string	"(\265/\375`\266\001\345\n"
+	.string	"6\321A8P\217:\243\305\016\301\253\b\205\324\242o\346\215\244b\365\374m\256\"\0308\230\201\240afRvff\212S\033>1\201\330\330\232e\001bK\310.I\371\f\355\221RJ\0013"
+	.string	"3"
+	.string	"1"
+	.string	"(\2511\311+\3248y\207Y_\b\300\377\277\3119%\221F\362 :df#\377D|:MU\343\263X\037\210\252\253\232|\353"
+	.string	"\243\251\360|cU\345W-\361\341^\315@\334\r>bp\201\005\037PpR\202\227\020<\264r\323\201\237\366\277WM\325\250\034\265*b\300\332\0268\b&\345\034\201{\270U\267\025\013\\l\331\332.i\341\220q\261\027\334\207\f\224\017.\2667;\334^\350\341\366\300\020\330\315mn-\016\310q\313\271=\"\243\270\330\270wr\334\033n\034\032"
+	.ascii	"\256\276l\250`\210dG\226\325\330\377G\331\252\355\377\237`\331"
+	.ascii	"q\356\272R,<\272M\307p\0316\023\343\022\332\264J7\275\205\234"
+	.ascii	"\271\335\312\211+& \340\002\241\242s?\207N\321\343t\233\276\017"
+	.ascii	"\377\360\360\303\3258_0c\226u\032\215\020\ni\031\220\365\b\034"
+	.ascii	"\301\001\034\200#8\f\016?@\036Z\212\023\3018\341\264\225i&c}"
+	.ascii	"\202\330\335\f\202\357\373{s\301\226,$\256\336\300\302u\243a"
+	.ascii	"\305'"
+	.text
+	.section	.gnu.lto_.refs.a1e1f8f0161ddaff,"e",@progbits
+	.string	"(\265/\375 K\265\001"
+	.string	"\"\004\013\020\220+\035\377\177\213\226\372\251\3376!d\313\224\002:\224I\320\202y\t\254Q[<\205\347y\232'\255\357)\2172\021\032Y\317\251I\002"
+	.ascii	"-B\016\034\027"
+	.text
+	.section	.gnu.lto_.decls.a1e1f8f0161ddaff,"e",@progbits
+	.string	"(\265/\375`\306\034\355\201"
+	.ascii	"\272\316\264-P0\220\312I\007,9\364\247\346\311\231\373\177\236"
+	.ascii	"\314\177\023b\002\032"
+	.string	"\001\227$\213\211\202qin\276;P\375\177\364\251\242\343\216f\243\215\240\371z\207\242\3768\256ae\217\205B\251\276\350\303\322\230\034\303\357\n\"\305*)\324A\231\377\020-\222-e\nd\002\300\002\335\002Q\232z05\312bx\315s\372r\022\206W\016<\240\316\275\"z\230\312\324\2205\312\200\007sC\331\344\324\350\313\034\007\325!\227d\357-=/I;\210\315\322\363Xz\006\333\242\305f\305\023\344k-n\215e\357i\311+\365\341\237\341\b\376\261\302}\037\300\b\321J\323(W\201\003\272a2%HX\243\347\034\351Y\211\312nVu\336\274y5\251\210\302s|\345\n\20345\201o\017\254\340;\206c7\036{\357\326\323\311kw<\205\251X\325\351\201\327S\340\275\367\334\344\027:\337\361\023\216\023\341uo\263\007\002K\004\337z\020\336\253\3461\037\3531\036\357\361\312w\347:\226\302kg\3652M"
+	.ascii	"\r\311\376\326\326t\3203\025\267\026\356]\336{\007\300\311\203"
+	.ascii	"\262\367\325\350\205\316v?\303\251+\365\366\344\200"
+	.string	"\321ayi\364.\244C\272\037'go\220\207\263\321\253 \327bj\2320i\364-\322\213\2202\017\334\003\257%\030\312\331\t7\271\215\222z\325TK\240\026_\243\367 =\227\030\332\347\223K\f\317\"m\376\031\372T\220\216\340\020C^\302l\274\032\300m\177`\305\255\222\355\246\335\253\366\354\2549\262\246\260\321\253H\005`\273+\236\246g\003\206\374d\003\206\3574\210C\f\035\340\020CN+a\231O\315\013w\257\n\"]\322=Ik\364*\207\030\246\3743\374Yk=\201\311s\376\276K\262\375\274\344g\365\347\017'T\002\345fpXSkJ\343\250$/R\370\031\211\016g?S\360\263\2212v^\3607\021\025\210\374\\E\3663\217!\377\361~\036\313s!\366\263\220\237\201H\371\277\367;4_\303?\b\370;\310\321\277\345\270\376g\321\343\345\317\0314\177F\177\266\371\271\006\366q\025\376\277\370_\342?"
+	.ascii	"\377\031\370o\003\210\377\007\374\375\326L~\336\372\031\353g"
+	.ascii	"\034?K\375\354\364s\215\237s\370Y\206\237i\374l\374Y\306\317"
+	.ascii	"/\374\034\343g\342\317E?\023\375\314\302\317+\374\214\302\317"
+	.ascii	"/~V\361\263\007?w\360\177\315\377*?s\360\263\006\377\333\376"
+	.ascii	"\313\375,\342\347\n~\226\340\347\025?C\360\263\320\317;\377\265"
+	.ascii	"\374\234\376|\363\363\377?\377\367\375O\373\177\342\177\336\377"
+	.ascii	"\364\371|>\177{\303o\221\374\002\334}G\324\257{\357\275J\270"
+	.ascii	"?\257&\216\272t\373\230f\315\0306\356\375\273P\020(Y\311t\227"
+	.ascii	"\224|\257\ru\352\336\245f\013WM\316\3024uw\356R\351i\311\253"
+	.ascii	"\251cc\251\311t\315\270\230\212\271z5\205\344\334V\347]R\225"
+	.ascii	"\354\274\177]S\351\252T\231\314\316*v\365\244\016\371\204\350"
+	.ascii	"\355\311}\210\262\325$G\243k\267\3458\361\313\261\346eU[[\255"
+	.ascii	"\331P%\333U"
+	.string	"\346\324H\262eFx\357\325\211\017:d\311;k\364\315\366\367Z+Y\362\224\235Is6\332\252\320{\tNX\334\215+\215\362\363y\373^\253$-\tO\223A\274\260F\221\350\250\361\260\362\032\322h:z^\264\266\360\350\035\330\232\352\216U\262\332\213kTUm\206x=\007\317\314z\276~\230!\322Fz\251\3628}\231\261Mec\0138\327\236\215\366\030\377uX\222\300\336\361\013]u\027\317\322\347.\311\340\002\255\2328\337Z\307\245\360\340\334\333\345\3049\306Q.\205g\251&\220fU\206v\357\025k\262&\322\316\036\322Ex\355\261\016r\276\322B\322\306Z\252\253\036xbUF\250C8%\030\305\203\366%L\373G\003\341\365y\rv\324i\360L\0170}\016\374\274\341Vsq\337\325\006sk\335\325<Z\213g\251^\252\027J\254\312\274\372\213\327\356:\252\336\273\342\354\200s\0223D\337\\_w"
+	.ascii	"\353\324!\215\266\017\241w\323\002\261/$\215\332~K\033\253{\360"
+	.ascii	"\032\324Y\357\034\374v\234\245zW\234-d\264\340\032}\257\245\347"
+	.ascii	"\240a\017\007\r\337i\351\373,}_\227\245o\262\024\345\237aWuS"
+	.ascii	"5\216wUO\351,\273\n\275W\211\231\004\0173\t\033)C\224\230\f\321"
+	.ascii	"w"
+	.string	"X\372\366\021\005\205\356\240\006f\357\211\327\206z;5T7\361\234]\235)\023\023\036\201;YP`a\320\0347\356P\252\"Z|\314f\262\002d\312[\243\377\273F\333\340\265\231\336KU\305\022\240s\305/\324L\255\304n<J\365JQ\020\206i\016\310\204\211\033\266'B\260!\3327=\017\246\177+\r\350Q\255\240\276\372>\255\236\230U\260\3215\252\023\217'p]\322sZ\026\336\362\207\305\217\265\244U\321A\217\257|aA\356\273\362\271K(_\322\b\371\217\265\360(A\334\373\305\347D\303j8\r\237\341A.\344\225\t\231\313\271\013{Y\022\366\205a\220\266\027x\257j\002\310\304\207-e\210\364\361\240Y\016F\304\022\363\203\265.\202\f\206\311p\337\225z\253V\360\022\245W\206\315\360\312\202\007R\357\205#`\247\220\013\341\332\220\314\030\235\017\303X\360\276\260\032\265V\227r\223\307\347\345\303\217\212\312\342"
+	.ascii	"jZ?f\224\036Z\017\330\334\222`\325-\216\307\375\255\203q7wM("
+	.ascii	"\253*\026\312BY)(\316\033\034VS\2056\352V\n0\347\f\225&\246\023"
+	.ascii	"&&\353\004\324\264_\250X\225qV\240\227V\323\255\023j#\013\331"
+	.ascii	"\232F\355\215&c\337\352\326\263F-\263\303\322\036XLRfVi\225\266"
+	.ascii	"\006\263\005\2161ChC\370\304\002\304.ok\024j\335h\324.\361\234"
+	.ascii	"\315\352\003\017M\243V\351a\222K\264#C\346\2313\375\274s\016"
+	.ascii	"\005\357\030\333\232\367s\347\317I\240\217F[M\223\351\211\342"
+	.ascii	"\"\006\330h\243\3514:[\006y\350\222\246\013\233\324\004\343\032"
+	.ascii	"U\323t\244\244\304\232ZC>\2514h\306\f\016v\231\333\345\335\302"
+	.ascii	"s\342D\2511U\321K\003\037\330e\200\232\266\213\236UYP\217\237"
+	.ascii	"\322\212`\013\276\313\\J\3526\304nI\246\351\366\234\240\310\214"
+	.ascii	"\351\243R\222!\271;l\205^WL\007I\353\210\220\341h\003\344\265"
+	.ascii	"\001[\013\035\266\241MQ9\001bH\337\016g_\276\264\225\267\275"
+	.ascii	"\324j\211\230\034\\]\272\264]\312?\370l\232\252\036\366\254\374"
+	.ascii	"\374\372\357\203a[\030\316\037\232;\264F\377x.Gl\211\r\256Fo"
+	.ascii	"\243\244em-<\327\352\235jq7\245\2368*\006\013\226\266\363Rr\025"
+	.ascii	"\224f\201\223\202\245\327\327\327VRf\"\226\0254\274r\036\361"
+	.ascii	"\322(\257m\345\212\031\231\0239>>\037\365zE9\373l\313\035\027"
+	.ascii	"\265\273\273\326\303\340\212\355*y\260HE\351\021\336\233ub(\230"
+	.ascii	"7\230\305O\033\2675e\205\215\346\035O\2479u\227\274\265\005j"
+	.ascii	"I\243k\026\250\212\242\023\2332\245\355\322\233\032i^\346mW\205"
+	.ascii	"S\304\210\327\223\216\364\335\244\235\274\237\374I\327qO\033"
+	.ascii	"\332\325T\320\337Q\336ut6~brX\321\315\345dE5\021\302U\270\016"
+	.ascii	"\216\207/\314\315\214\334\271\216iC\345VdJ\243\315C\307\3358"
+	.ascii	"\335\251\001\211k(7\202\214\t\\\243\266\031*ht\215\276{`.\377"
+	.ascii	"y\312\274y\361\321Gv\266\314\314,\033=\332\224\366?"
+	.ascii	"\274\267\312F\275SK:C\266a\016\372w\330r\002v\203\257{\225d\021"
+	.ascii	"L\215\304)\365\030q\203\356UN1\327.%\b\346\252t\231m}T \230\352"
+	.ascii	"\345\032\340\256_\227\2516\225hS\331W\275\313.\252\273l*\221"
+	.ascii	"\230\352\235\272jS\351s\227T>LUI\311\\\273\250\230\2716\251@"
+	.ascii	"\334\345U\336\245\022W\272lR1\365\232T>\314U\211\212\271\354"
+	.ascii	"\242\342\2536/[\241S\273\2246\356\252\264s\357}R\235J\235{\225"
+	.ascii	"\246\256\362JC\335\256@\250\273u9\306c1\tI<\341\b\t\007i\230"
+	.ascii	"<\036;\030\341\b\311>\006\212\244\024E\244\221\210\017FD\307"
+	.ascii	"\020\216\220\2067\001<\006\212\"dQ\n\343q\306\214c\021\0201I"
+	.ascii	"d\204Dc(\231,\026\025\rE T\204,\002\200\206\214\0201\222\212"
+	.ascii	"\306\"\f\001X\020\221G\0263\210\311$\032\\\364\374\020\035e\344"
+	.ascii	"$\211G?\304\032\212.|\214\2122\210NH\032\211I\343\221ER1\200"
+	.ascii	"d\321X\314I\"\211\222I?FF\"r\350\bih\b\304\361E\322\221\261\230"
+	.ascii	"L\022]\020\223E\244\f!D \241E\t\034p`d,\302\310yQ\021I4\022\217"
+	.ascii	"\322C\020A\003\021H0\303\rq\210ht\024\201\210\244!\243H\004c"
+	.ascii	"\3471P\204\360\002\004\027)\222\304#$Qr\004Q\222h\203\234$q\250"
+	.ascii	"\203\237\344\020\222hDD\374 i\bDr\b\231D\302y\f\024H\342\f\""
+	.ascii	"\"2\231\244\200\013\234\034z@\205\f\214$\302\200A\303\205a\222"
+	.ascii	"\250\221H\242\225q<j0ds\224a\244\221\"\217I\"cq\006\222\230\314"
+	.ascii	"9\201\305\017\321\205\241\242\342\021\321\2144\371\030(\216\220"
+	.ascii	"R\034!\375\024\031it\220$&}0\302\350$1\211\210\264I\032\242\001"
+	.ascii	"\231L*\036\021[\034!\351$%\021\221FFD74 \035\213Pd\022\311&\207"
+	.ascii	"\214\220\307\"b\013\236'\360#\022\021\231\"y<\"S|8Bj#\"\fEDH"
+	.ascii	"\303\344P\004B)\261\206b\022\232\0342\036!\331\030\217\220\254"
+	.ascii	"\361XLB\022c\270I\016I\2204\026i\334|\202\tX\2140a\004\017\322"
+	.ascii	"\"\0243\216H$\"q\350\250\b\303x,Ja,\022\315HQ\204LJ\201\202D"
+	.ascii	"\322\021\221\f\0306m[6^\256$)\262\266\235\006c\236~0)\203.\323"
+	.ascii	"t\325`\3537\034\247T\017S\226"
+	.string	"\030I\347\360r|\251;\f\373\350\270<)\261f;v:\330\260b\327\236@\254\210\tQ\263N8j\n\331\324\322\244\272\276\254i5\032\232E\20235u\357\225\005|\204\201Gn\221\270\355\024Q\n\013S$\005\312y\003Sy\350\263\2633\316\033!i\312C\354N\313\226\265SZ\226\337\355\221\362\fu\030c\222s\266^\217\235\227\231?\"8p\276\320\314\324\220Y\254\272,{\\\255\336\314\331\211\211\032\353:\333\005\315\206\0171+\204NNJWw\241\305\213r\203H\243\026\314\346\360|>\237i\356U\262`m\203\330\260[\2603\223`&\321s\363\207\306T\032\242\326\313z\331\037 (\221\302D\351\331\257\333\037\366\016\213\251\354fG\372\333\256\271\341\216\032\205O,\227\255Q\267\306\251\266\311\266\244[\356h4+\313n\0015\255\027\347\240 Z\001ON8\255\333\255\017vmRl\355f\375\250\306\222"
+	.string	"\352\320a\261\200\232VKa\2079s\247\306\343\026\313\007\f\022\266F\355U\307\r\021t\2525jw\004\202v\2502\t=\005\022\0253\b\225\214\210\244I\322\030\302\n\020\004CY\"\351\322\003\022\200E=\324!\250Df\222\244\375\r\036I\312\024\314no\203*\246X\253\032n\301\004a\320\237\2633\177Bw!7B\365\025n\t\244\242\251\326\361\206\257\213B\321\230?\352\250\376\270\335u\210\024~?\035(\203d\231\276\302\013\302\367a\214\235c\351\323\236\240E\0309\302\226\351\247\020!A\236NA\352\236=}\020\001\321\276k\247\231\367\332I\352S\251\336{\025\353\252\317\237X\224eC\356\"dt?\2339D\240\320\"\332w\020\340\\\252\224M\316\202\271\233oH\263\330G\346\256Q\243*\203\313\335#r\016\371\217\364\227\364\001\231\204\242"
+	.string	"\233\250T\031Y@B\253\302\264\350+<Uj\256\304\232\322\277\201Q\253\251$\241/\350\265\300\257\257\361\232`\236_[\230\177\264f\"y\323l\217\215\346\003\203\\\316s\323L\203f.=gL\340\270*\t/"
+	.string	"\274\300\fA\rHG!\245e\341\250V~C\327\240,\2554"
+	.string	"\244X6\302=#^\250\332\252\245\024J-T\241\027O'\251\352\371HV\250x\231_<O\331\324\275\004\364H\241\275\336.\0269\026\220*\007\204\232*\310\335\365\263E\315\2035\227\251`\361\331\005\322|\3303\314U\365\024\207+?U=Q\347)G\370\004\242\361\362xih\335\346\001\305\b<Xz\025\373T(Y\2015\234\365\356\247u\227\241L\217\370|\022\234\367\003x]\033n\240\366\020\222Y\312V{3\354\376\331\244\323\214(\346a\211w\202\232c\317F\036~\013Pf \347m\321 \237E|5*\307\320 \004|\225\276M\234\330\242\333\316\351\023\313\244#\237\212\025\347\274\303\222\024O\372DD,\355E\2534\3435=\261V)H\ti\023\3462\344!X\356\306\274\025`\355\240\245"
+	.ascii	"\033!YI\324\206\252\345\032\371\261H\352\253E\b{\033\372\220"
+	.ascii	"\332P\337R\3611\"\300\b\316\036Zn!N\211\304\250\260\034W\314"
+	.ascii	"\307\355N=@\351\345\333\336\007\205\031w\254U\362:\244\217\202"
+	.ascii	"S[\027J\205s\330)s\3408\313\345\t\352\354v\326\203%\263@\271"
+	.ascii	"\275\007E\033\021\211K\335z\201\035\002\260\364\354\275\227\350"
+	.ascii	"S\336\202\0166\027r\315V\260\3623\007\261\237\243)Thq\253]qL"
+	.ascii	"\253\354\303\263\226\0032\310\333{\350\360\\~\037\005\216\367"
+	.ascii	"U1\375\027\326\177T\005\266MtGx\263\245\340\"\245R\330\016G\343"
+	.ascii	"\261Slk\353Jh\350_;\226\bj\323N\025\366 \3153=U\340\340;\370"
+	.ascii	"\313$\006\027WR\230\377\307\004\230i\370\0178\332{\322\021\330"
+	.ascii	"\343\240\224\371'\030\313\357Z?\251\004\177\266\257\031\2653"
+	.ascii	"\322\316\2649\003{\332\030\210=\007\224G\220\326\372\346\016"
+	.ascii	"\253.S\277\206|\314\006\335\321\211\265\245\267\022[H$\f\246"
+	.ascii	"\377\343s\205\312\b\210\316\375\226^j^'\323\021\344\216\203\300"
+	.ascii	"\375\323\304\353]\177\254s\340\201\230\325\226\006V\2215\336"
+	.ascii	"\337I\253\274\216\t\332\023+0\260]\260`\211\2602.\353\032\322"
+	.ascii	"\376`\375\374\373\t\245\020)\252\265\201\221\337\221\365\207"
+	.ascii	"%\220\254\364\220\215\363Q.*\2363\353D\222\"\033qq\274\214\""
+	.ascii	"\367Q\037\226\001i`\335\226%\356M\307\340.e\216\370\214\250\376"
+	.ascii	"Y\267h?\322\206\205A\300\350/\351\3655\231\300x\241d\027.\313"
+	.ascii	">#\205<\020\233\016X\234\232\257'\244\260\322+ \321~DpY;1\201"
+	.ascii	"\321\341\353m}}\032\276(\2301\211\004\273oq$\317\2422\004\224"
+	.ascii	"%\026\255M\367\344\222y\276\234&\342\002\007\363\235+\303\236"
+	.ascii	"%\322\020\340\363\001\363\202\327\375\336\316\237\347\372\374"
+	.ascii	"6=\025\341\307\r\350\305\367\214\\{W\031W\312F\202*'\016\024"
+	.ascii	"\241RZe\215\207\261l\364\244R\020\247\361\255\260\247\231@\032"
+	.ascii	"\352+\242\320\313\007@\346\311\201_\312M7"
+	.string	"\357\261>\232\3252\270[\274\261j\312\255\027wM\377\003\365\334'\363.\267G\207\317\301]\177\017\207w,i8x\344\264A)/0\327"
+	.ascii	"\356\033w\302\357\254\301\352\343A\266?%#\006y\210\353\335\207"
+	.ascii	"#\323*\237\331\016\275\341\256\325\001\363ef\026}8\353$h!\260"
+	.ascii	"\257\374\256;\335\257\372\364\243\2034\374J\357\001\177\005\363"
+	.ascii	"\314\027\260\340\b\240\236\311\243q%\021\350C\264\023\333:\037"
+	.ascii	"(\270\232\337\255?G\262\320i\310\177\017Lu\257\231/,\203B\334"
+	.ascii	"\314\237{\263\217\376\370}\376&\347qA\261\310\217\322\304%\265"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_.symtab.a1e1f8f0161ddaff,"e",@progbits
+	.string	"initEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\001"
+	.string	""
+	.string	"isEEPROMContentValid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\001"
+	.string	""
+	.string	"getEEPROMConfigSize"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\001"
+	.string	""
+	.string	"loadEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\001"
+	.string	""
+	.string	"writeConfigToEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\001"
+	.string	""
+	.string	"eepromData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\001"
+	.string	""
+	.string	"__pg_registry_end"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\001"
+	.string	""
+	.string	"__pg_registry_start"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\001"
+	.string	""
+	.string	"config_streamer_finish"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\001"
+	.string	""
+	.string	"config_streamer_flush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\001"
+	.string	""
+	.string	"config_streamer_write"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\001"
+	.string	""
+	.string	"crc16_ccitt_update"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\001"
+	.string	""
+	.string	"config_streamer_start"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\001"
+	.string	""
+	.string	"config_streamer_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\001"
+	.string	""
+	.string	"pgReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\001"
+	.string	""
+	.string	"pgLoad"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\001"
+	.string	""
+	.string	"failureMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a1e1f8f0161ddaff,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
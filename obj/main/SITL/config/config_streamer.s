@@ -0,0 +1,483 @@
+	.file	"config_streamer.c"
+	.section	.gnu.lto_.profile.21b98934ff58aabc,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.21b98934ff58aabc,"e",@progbits
+	.string	"(\265/\375 \270\275\003"
+	.string	"D\005\254"
+	.string	"\t"
+	.string	"\255\245\304\212\017\006\002"
+	.string	"\002\001\001\241\210\323\235\t\004\002\002\002\367\346\266\265\005"
+	.string	"\003\336\367\336\247\t\n\003\002\002\001\004\342\220\207\337\t\020\004\002\004\002\005\002\001\002\005\265\234\352\241\r\002\006\362\346\365\246\013\n\007\243\254\366\313\016\006\b\240\342\234\212\n"
+	.string	"\016"
+	.ascii	"c\340,)\004.al\006\003{A3 \300%\340.\257\247\0055\233\222\211"
+	.ascii	"\317\216\244\r`\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.21b98934ff58aabc,"e",@progbits
+	.string	"(\265/\375 \247\275\002"
+	.string	"r\004\f\022\260%\351\f$\f\3030T\211N\260\233\220\266\245L)>VL\310,\350d\337"
+	.string	"\006\206\367p\224\fk\242\213@\032zTB\322\352o\3458\b\017"
+	.string	".9:\006p\264\332\303\204\246y\b7"
+	.string	"\fr\205:\225"
+	.ascii	"\224p\217\032\235\316\030-\267\201\2217\200\005"
+	.text
+	.section	.gnu.lto_.inline.21b98934ff58aabc,"e",@progbits
+	.string	"(\265/\375`T\002\255\r"
+	.string	"\326\026I;0m\223t\300D\303\313-\204\017\243\"\207h\340\335x\304\264%\342\366}i\312\255(\275jpUb\377\252\373\265a1\203'\274\320\3018\fx\203?D\332\307\337\b5\273\267\334)8"
+	.string	"8"
+	.string	"9"
+	.string	"\021\253\346\257\203\003nUs\204\343\001G\b\200\357\251z\252\372S2\317\213ik\255\335\275TA40|\260\247\360\003\324\021b\371x\324\373>\213\202\340H\310\240<\033\013\004\367\251\272'\230\354d\230</'\325\013\036\034\b\353\346\345\346\201v\224\030A\341\266L\365\323Z\213\\K\364\013Zk\f~\2756\3566\034\353\346\025r\027\321\254\324\215\337E#h\007\013$LT\260w\277\244\327~\t\332\340\003\350D\345\\ri\240s3\206\322W F\322\007?\005\221T\315\3752\rax4(\306\277\237*l\375\313\240\210\326\332\n\337q8\251\233\f\030\036\r\322\353\246*\233 <\005t:c\037\366\337\253mF\007\036\234\b\001\216\222\302<B D\377*z\336\2233\255\020\312\360\320{-:\301\003\262A9< `\"B2\327\0038\240\203\207\301\035]\026\3220\216R\336\242lDO\001?\331"
+	.string	"(\004\357\b\220\022\364WX\""
+	.string	"\006\275\0352\315c\324\254\213<\315\035\n@\230s\356Z\253\317\022{\351\361\205C>\006+b\030e\225\300R4\236\252\242\3210`\033"
+	.ascii	"g\360\305`\006\022\336\016\351\302V\307\017\330j\234\b\203^g"
+	.ascii	"\203@\225\233\337.\205\235\330\344\302\2524\332\253\270\355\262"
+	.ascii	"\236\200\031b\033\003\276\260\355\375\215v\203\262\325\350\323"
+	.ascii	"\273(n"
+	.text
+	.section	.gnu.lto_.jmpfuncs.21b98934ff58aabc,"e",@progbits
+	.string	"(\265/\375`b"
+	.string	"U\004"
+	.string	"\362\307\024\033\260%\351,h\001\006(\032\206)L\n\026\347\024\235@\202c\203%\333\356-\223\f\333\354<\0311\275\243\246\277D\361\2255;_s\363\200\022\215\260\305\316\032\376\231\242xGq\273\360J5\347J?B)\245|i+\311\330d\274\221\200\317\016\236\013\354C\025"
+	.ascii	"I\017P\031\271(\206C\320.\251Co\346\340\016\r,L\302g\356\202"
+	.ascii	"vi\212\223I\334\035a\023\263A\324qR\325 \224\0360\367\251\300"
+	.ascii	"\233Y\\\001\206"
+	.text
+	.section	.gnu.lto_.pureconst.21b98934ff58aabc,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\b"
+	.ascii	"\232\004\001\231\004\002\230\004\003\232\004\004\232\004\005"
+	.ascii	"\205\004\006\232\004\007\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.21b98934ff58aabc,"e",@progbits
+	.string	"(\265/\375`x"
+	.string	"\225\005"
+	.string	"\202\307\027 \240'\351\340j\\\305.\005\270\353\374\027\242\276Y\277\304\rp\026\214\250\373\317\204l\322\b\3312\005\013\006\205\300\361+e\266\364\220\365\025\335\311\036\217i\005\261\023\273\256AH\314yee\205x\336\3553\223RS}\026\306\034\305\262\016\tF\355G,\342\314\362\374\336\221u\2005\261\323\350k\b$ \240\242\031\302\036O\200\357\351\3141\241\301\347"
+	.string	"\337Q\211\352{\300\355.\224(,"
+	.string	"a\003{\030#m\330^\260\270\274\nI\270,\022\203\211u\356\013\262\005\213\033J\370\314p[.\330\251=\301\021\020\1779\356,\003\036"
+	.ascii	"E\2648#X)\002"
+	.text
+	.section	.gnu.lto_.lto.21b98934ff58aabc,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_config_streamer_init.3.21b98934ff58aabc,"e",@progbits
+	.string	"(\265/\375`\027"
+	.string	"e\007"
+	.string	"\242N45Po\322\001 [n\3654?\021C::o\305\022l\300\321\325\271\0030F\022Sgm!-\373#)\315\314\222\"\030\340\213G\304\263\300\032\334\"B\310\226)\005\226kq\342\365\351\\Q\024z\210\360@\2000\013\202<\235\017\264b\br\020\212I\\\021\2120,\302MwO\177\\\035<J\026\357\242S\032\270,U\202\363\265\023\024\351\255\231\302Q\302xZ\333i\371>ZO\377\337\307\265&\3319U\035/\005.\277\306\214\314K\324\212\310\246\255\2635\211K2\223*,\360s-*\177\247\320\005\215\251v&\250Li<P\231j\326\302\270\013\271O\266\f\224\230\377\360\2018sf\265M\034\260\2154'@\303\377\3466\332p\237\333\036\264eh;\022\t"
+	.ascii	"\252\244\2231\215{\206\215\263\257`\336%\200f5\005\334\345E;"
+	.ascii	"\311"
+	.text
+	.section	.gnu.lto_config_streamer_start.4.21b98934ff58aabc,"e",@progbits
+	.string	"(\265/\375`~\001\215\016"
+	.string	"\006\332^E"
+	.string	"\221(\035\020\241L\007\372\b*\001\335\374\325?\202zB\274Q\023\337\266W\b\216\206j1\277\265|\255\376(\246\370G\004F2\327t\332\266\001\376\277+C[c\020\356!o\275\231\244\365\311$\371do\271S\nG"
+	.string	"I"
+	.string	"L"
+	.string	"\323\341?\260\317\354\004\260O\2036\216\207\250\275\312\304a%\263\273\233\2168x\251\021\364\277:"
+	.ascii	"\322)t\371\341*\025\300\264th\247\221\3740\225 }\365X:\211b\334"
+	.ascii	"H\330]G\322\311\303=o{\202\355\b\366o\004\276\313\277y\370\317"
+	.ascii	"\247~)\243\357\361\340\204L\216\002/\273\246\032\232}M\031&l"
+	.ascii	"_\263\255+\256\002\357b\227\024\260#\021%\326\356\202\030B\366"
+	.ascii	"y@\306\320\204\246\301\243}\226\267\200O\235|\300\256\n\r\326"
+	.ascii	"n\bb\006\331\003,Z/\221\206\216\232\201a\251A\330UDec\024glw"
+	.ascii	"\177\001\312\256\212\"\206\212\324Fm\fwa\227\266`\354\230j\177"
+	.ascii	"oa\222\355\256\003\377EC\006E\2218\301>\023t\250\221\322\022"
+	.ascii	"\002%\326\330a(\352\212}\271\273kUq\334\006\317'\271\217#\";"
+	.ascii	"w'\304\343>\034\316+\371(\214x*\220t\235\215\304\303\371l\035"
+	.ascii	"\357\333B\020\270\273\300y[I\327y\233\026\356A\274PT\344\005"
+	.ascii	"\267G>\303.5PB\245\260\304H]9\bc\201\002\314\226+E\214\026m\013"
+	.ascii	"\237x\222=\002# \260\002\021A\263\003\252\247\023,\252a\022\031"
+	.ascii	"\326\211Be\213<Q\266\277\3210F5\3407\333A\2575\300\017Rj\242"
+	.ascii	"\020\273\215\366U\246A[\347\234\204\303\261\276v\223\210]\350"
+	.ascii	"\016\bpt\306\340\212\322\270\013\271\314\021\0015\212xy\336\344"
+	.ascii	"\024\r\356\001"
+	.text
+	.section	.gnu.lto_write_word.5.21b98934ff58aabc,"e",@progbits
+	.string	"(\265/\375`\346\001\315\021"
+	.string	"\366\242yG\340\360&\035\360\213\230X\207\223\322\245\020x'\233=\262b\362\020\002\204\305\233\237\3148\332\205a\344\034\232\307\327}?:ZVC\fU\243\225\004c\214M\270%\307\264\350\355y^L\316`\274+\326\212X\262\267\224)\005e"
+	.string	"`"
+	.string	"f"
+	.ascii	"\276\211\373\310\354\243\370\361x'\032\021\255\3264\347\\\205"
+	.ascii	"\034d\273\214\037\260]\356\316e\337d\\\225\371(\257\345\033\347"
+	.ascii	"\34122@\242\371\371\360`\342qh\200)/F\343\207\256\033<\230\030"
+	.ascii	"2\347Ly3\335h\300\006\211\346\303{\211 J85\016^g\274\030\325"
+	.ascii	"\023\311\234\323*\343u\270O\267}b\273\201\255\252\367x\355F\375"
+	.ascii	"\373\271\250\226Q\035\245z\245Z\243\372\037\"K65;)V\30679\204"
+	.ascii	";f\222tA\342\265\333?\341\017\325VBf\337\364.\004-\3714\315\371"
+	.ascii	"\215\\z"
+	.string	"\001wy[f\247l\253^\b\203\001\314)\302F\202\253}\240\007\311\376\261\\\300\2349/\214\346\374\016\030\001w\351\217\263\035L\036\252k\233\234\350eP\373\241\177D\221\216\244\331\266\234'\307\r\243\370n\333-\001g\234\302w\233\356\256\306\240}x1\312Ut\272\004n`h\013\034J!vu<\362o\t\3104\323\034\266+\234\310G\334\234S\201\217\"\005\306\365\260l\227_\0206=6?@.\032\332_\213\256\216\375\r\3030\364\346\330\027z0\225\030+\006\333\\*\023X\026d\353n\251^.\024\226\353\025\203A\220`\022!\245k\255RLX(\253\326\013\266R\211\270\243\340z\255b]\367Z\245\276\3718\243\214\0174d\240\025E\325\017\336\301\316\nZ\221~\345\316\330\226k\022\227}\211s\316\271\005P\217\345\326n\271\3642q\017\236\004FY\324jJ\310\370\225\r\265\005nB0! p\002\231"
+	.ascii	"\355\016j\272\267\246\023\262\020\244\r\350\330\273\025\251\202"
+	.ascii	"\225\013?=z\0334X\331ec\252U2\253&z\355\274\235@\016g\222\270"
+	.ascii	"@G\341%\341\023\3439\032\313\276a\016\362\022\362q\256\300p\357"
+	.ascii	"N\242\301\n\241-7\035\374\nf"
+	.text
+	.section	.gnu.lto_config_streamer_write.6.21b98934ff58aabc,"e",@progbits
+	.string	"(\265/\375`%\003=\027"
+	.string	"\246*\225I\260XQ:\360\270\251\021A|(\030WG.q$mc!\323\360\215\201ez\373`\313\230\241\335\245e\355\277\351)A\201\365\245\331\244\330=,\017\370\017\365?\217\350\021EW\262EP\026\272hD\352BT\020B\366\2262\311\177"
+	.string	"{"
+	.string	"\202"
+	.ascii	"$>\240V\\\021\221Z\313\007K#\236n)>\307u\304v}\263\324\221\217"
+	.ascii	"\361s\333)\325ZU0O\201\247\363\005\300\323\206\021\343Y~A\216"
+	.ascii	"=\004\351l\216\355w\2378\200$\215$\317\303\031\326|f\234\310"
+	.ascii	"\333\254Y:\032z\357\334C\316\030\fPc\305\251\212\317ISS\3729"
+	.ascii	"\221\265)`\351fd\"i\334\357\275\301\217\244\221\\q\016+\324Z"
+	.ascii	"\227G\022\305W\374\356\372\354.\205\335\276\020U\202d\374k\036"
+	.ascii	"Q\215\354\316\355\226<\\\243[:\332\306\355\246&/\352\345\177"
+	.ascii	"z\217\237\345<~\323y_Q\344\rC^p\362R\220wR\336\236\274<y\357"
+	.ascii	"B\240\210\211\005)\265\372\374\254\324%t\210\306y\337\275\217"
+	.ascii	"}\217\267\363j;\001\300D\f\027G\265\2261\247;A<\375nl\327\264"
+	.ascii	"\273\315\357\021b\266T\332\213\037\t\314c\347@K\245\t\225\200"
+	.ascii	"p\336}\320w\304^\006(n2\"\031\340\331\247\336\315\240\201?\322"
+	.ascii	"\206\2515\317\356n8Q\210\027$\f\234\314\246F\276\033\253\244"
+	.ascii	"\205\r\334\354\334\316\257\017\344F\220\203!\364\204\306K\333"
+	.ascii	"\275\273#n\204\203\213\256\326Z\263\273\372\020+\245k\275\310"
+	.ascii	"\207S\226\2462\"\311>\344\306%\356wz\356zXp\013y\321}Dr\3607"
+	.ascii	"w\373l.f\374\333]\020\017\262>\261\326\032a\017\244\203\215("
+	.ascii	"\343tO\002<}\277\367\005FC\002:+\234n\211p\345L\234\263\276,"
+	.ascii	"\031X\313f\325\202\351\344p\370\340\362p\363b\251n\\+\033\025"
+	.ascii	"\013\226\243\222Q\260/\234\026L\245\363z\301T\246\262\276q\250"
+	.ascii	"\206\221\365l\213P\375\335\023\034!\272\021$\343_\330\271\235"
+	.ascii	"\031i\252C\026lj\261{\304\016\233q\bA\001\333\324a\337\006\304"
+	.ascii	"\322`\203QnWd\374\373\254\265Vp\346b\247\032<\361#\311\0064\343"
+	.ascii	"\037\247\2401WB\201|JSh\357bx\222\365\211\001? p\002\021B\253"
+	.ascii	"\003*\351\342\206\201{8Z\013~\275\254K\377t\352\262\303\270>"
+	.ascii	"v\362\262\264\025\242m\355\365\341P\004{\n\030\342\337\211u\326"
+	.ascii	"\302\355\252\362\344\242\327\224\2101`\235v:\303\356K\276\251"
+	.ascii	"A\200\260\252\r2\177\350\306\204\377=Z\257)\216\323x&\321\n\204"
+	.ascii	"\234\343H\016\370\330SWk\200\226Ens\207\3543\243\266\013-\350"
+	.ascii	"\344{\346\356\304\243e\225\370\bA\302\273Kw`\203\353Q\017L.D"
+	.ascii	"\022\222e{\343\365v\332G\006"
+	.text
+	.section	.gnu.lto_config_streamer_status.7.21b98934ff58aabc,"e",@progbits
+	.string	"(\265/\375`7"
+	.string	"\r\b"
+	.string	"\322\217770\217\222\016$=)\204\n\236\f\337\3070\256K]\017\267v.\f\206Q7n\321\376\375\364w\275\036\250h\235\206\001C\255\t4\024\345\227\036\216\214pT\366[#D\246[\3376]\347\303\351t\242\220\003\204\347\001\304m\032\310\303\371h[\027\3226\006s\021\235N\023q\\\247e\276\354\307\250)\305\212_\242&\253\262\314\\\270%\024\023YG\261;\212\001\251\022l\375G\2021\343{eD=\204\307~-\274\006X.\r,\231\027\255\227l\301V<~\3573\177\3417\325\021\257\337\250\002\231\250UJ\346\207pBV\354/\373oHE\274W]\337\306\251\034\037\026'\254\314\3244-\300\024\273J\200)\0265\352\025z\267$\275@PV\246\023\251\020\200!3\207\246\023F\217\375\017~\205_%\f"
+	.ascii	"\252\244\223i\021\206\315D`\231\005\324\230\320]\303\321\261"
+	.ascii	"x%\230xp\367I\265b\022&\031"
+	.text
+	.section	.gnu.lto_config_streamer_flush.8.21b98934ff58aabc,"e",@progbits
+	.string	"(\265/\375`\330\001e\020"
+	.string	"V\336iF\360\260(\035z\326 *\007jR\ft\032\341\231\325\321\323\024\251\t\303\271\277\3664*\203\034\236\201\242\177\231\356g\212\213\312ew\033\376i\357\214\301f=\007\223B\t!E\300H\203\271\257\2740\321\344\223\275\245L)U"
+	.string	"Q"
+	.string	"W"
+	.string	"a\001\033\340.\035r\266}\023?a\262g1l\251\376\301\345\362\312\231sv\241\203\266\313\370\220\355r=\334\364\270j\362\037\363X\002f\003T\235\0367|#\201\033\0278"
+	.ascii	"\250Z\"\350%\004\370\230k\006\025J\265\223`\316i\005U\032ny\333"
+	.ascii	"\nl\037\260\225A\b|\231\t\0268\020\227\376\312v\371\335\325\f"
+	.ascii	"\030\027\213\326\354\360\244\313\262\037\347\256lU{\036"
+	.string	"\376\036\252\356l\352M\252eT\307U\357\252U\325\017\020\322A\306\202\332\234/5\0353\206\234\021a\333d\177\250}\327Q\230\036\256\\\300\234+\030\2629\003\"\333\312U\r\214\313\243\273#\227k{\"=\350PjO+\367\261\024\t\324Y\\\370\264@\373\344+F\003l(\\\005\351\362c\023W_ \007\335x\277\330v\037K\215@i\315_\335\323`-\\v\274E\273\221\355\262<\362o\004\231\032-J\263\375=\205g\334\2343\336\355\221\224D$\023QI%\245\344d$\001\345\363:\224\221\t\251\363J)\035\211\210\277\n\242R\247\362}\245\356#\234\217sW\236\r\261,\3124\236]\032\0329\342\262f\026\247&\007\247\263v\203\313<\343@Z\372\002o|t[\217\265\035<\320\203\235\ra\330\223m\b\217\225\200Z\260( @\002B\214\243v\212\323\311L\377c\230+\263n\353\206\211.g\2213\202"
+	.string	"\313\202\213|}h\230c\300\206\215\235\220X\037}\001\353yX9m\244`\217\203\233\034\032\021q\260"
+	.ascii	"\022\005!\037\026m8\314\313(k$\347\243\264\371\364/ab\344\256"
+	.ascii	"m\243b9\030s\333\215T\201\326\233\246\024\024\n"
+	.text
+	.section	.gnu.lto_config_streamer_finish.9.21b98934ff58aabc,"e",@progbits
+	.string	"(\265/\375`\355"
+	.string	"\355\013"
+	.string	"V\026Q@"
+	.string	"Q5\0358\365WZ\260@\302\257\033o\262h1&\315\031\201\036=\226\002d@\033\322\347K<\276J\300w\004`?n\237N\240\252\024\324\n`\341\247M\356\366\244_:hO7\262\367\336)\005="
+	.string	"="
+	.string	"?"
+	.string	"\273\273I\036\301^\351\007`\257\223\364\357t\312\317\377\351\264\004\013\031`\3309\335\360I\017\264\\\340\b\020\202h$\024\002\374\3512C\370\2212c\260\273\226`\250\341\256\267\335\300\266\002\373\\\037\177*\245\257\235\303\210\327\r\007-vC\0379\226U_\210\260\375\331\020\333\227\366MG\361}\344\\\300\256\210\206jwD\340\004\332\253G\315\266o\342'>{EG1\374\207\031\030R\257\362\240;`\224X\237\331\271\350\321RMo\260O\b(\033 \351a\273\302Sl\264\335]\340\243,\\\320@\274\372\034\354\365\223\200\207\032\035J&\217\374\260\307\216\234#\373tw\327SdO\351,\334\315M\274\312\205R\3614\231\007\022,\0210\035\267a,\224\313\306y\231mb\300\335\204\212\267i\272\316\333 \343\336\316\246\3043?\266/_\341U6\013\220D:G\251\253"
+	.string	" \326\030.\022.M\332\0242\001\025"
+	.string	"\252\244\223i\021\206\301Z"
+	.ascii	"\026\346\275\210\241cB4\b\242\n\203\251H\275\013\266\240k\211"
+	.ascii	"\275\320\261\016\237YC\\\270\2132F@\023\221\224@\253n\232R(("
+	.text
+	.section	.gnu.lto_write_word.part.0.15.21b98934ff58aabc,"e",@progbits
+	.string	"(\265/\375`P\002\205\022"
+	.string	"\026\243yH\320\322(\035P\0011U\377!\343\234A\262&p\377\344\3111\236\354t\344\0213\373T\370\314\205\324\344\313\347Q\334.\361\020\355G\2179\267\276\006`\265\032\245^\210\312\235\347\005*\177\212\031\\U}\247$\177\357-eJ\001c"
+	.string	"e"
+	.string	"_"
+	.string	"Gs~\n\036\275\240{\364\327\331\367\201\261\261\355\263x\217\314F\202\037\217g\242\301\321\330~\3149S\217\250\033\220\217\360\004\344\343\236\270\354\021\256J\231\2574/\346\321\001\316\bJ\270\355\240y\"\276\020\202\322\215O"
+	.string	"o\006\257\223#\350\271k\2157\243:\340\322t2\347t7\3426\335\366\004\333\021l\345\tBf\211(#\305q\177\321\325\276_\364\027>\f\242\017\371D>u16\235\021\315\020\036\367\207`\374\234O\266\217\273\265\0305\273\265\240f\337\364TnI=?\346\374J\036\375\240\223\331'\257\336v!\027\370Mo\365B.\026\2313G\007\003\325\003\301\374\347\205\344\233 l\254j\337\305?\331\177^.`\316\332\214ss\274\007\200\243Dbw\307\360-\022.IME\020\216\231\006\361\210\356\352\332-\fz\032\\T\207\215\261\215\362\030\256n\316\331\300?\332\260\342\243x\364_\344\243\356sOpc\003\322BF\227tw\274\362pn\315\226jST\313\250\216\307\335\360\266\177\243Z\017\364\177\244"
+	.ascii	"\002\2459?,\0050\226\230*\006\223,\226\f*\rqu\257L^,\024\025"
+	.ascii	"\353\025\203Q\270\320\262\220\342Z\245RZ*\224\324\352\005K\231"
+	.ascii	"\034\260K\205\365J\305\\\256W\352\364\255y%\004\016,\371s\027"
+	.ascii	"1\341\325X\0167\2224m\215m\323\372Dfg\274Qn\222kyN\353\001o\032"
+	.ascii	"2\256\\\265y\300\231\321%\244\270\025\210V\254\017\033:7\240"
+	.ascii	"\002\351\364\334\002- p\002\231:\336*\3221\262\300O\306\227\235"
+	.ascii	"\373\341\341\213,\002\225a\316v\341\246 =3\0134\035\030\\\361"
+	.ascii	"O\001\231\203\271\2014\033\017\314\001\334\203\316\025\216\252"
+	.ascii	"\224\217`\006`\3214\320\260gc\211\337\322;\330d\006\326\311w"
+	.ascii	"\272YA\322w\262\332\337n\200\320\357!\223Uc\367\301@\236\203"
+	.ascii	"\232\320\\sO\bc"
+	.text
+	.section	.gnu.lto_.symbol_nodes.21b98934ff58aabc,"e",@progbits
+	.string	"(\265/\375`\271"
+	.string	"\235\006"
+	.string	"\202\211$.\200\267\351\274\260\230\225:\200\025m"
+	.string	"a\0316\235\032\203m\330}[L\305\004=.`\267\007\321\377\377\377\377\377w\023\021\221\245%M\356\224\002\306P\217>\201?}\203\364\314\0200p\275\321_\223jEr\372\342]\246"
+	.string	"P\340\353\023~l\323\026\242\353\005\262J\266\212\254\004\331\350\261\323\241\204\366\304\261\324m?\203\320p\016c\241\305\036\024\373X\260MK\354Cl\343\242<\260V\237\3169g\265\016\005\306(\r\354\2653\371\006B\b\251\265\234\355\023\004\032"
+	.string	"`h\227\241\263\032\f\002\002\2038t\f\225\031\034\250\035"
+	.string	"\035"
+	.string	"\235\017d\317/\205\2030\036V\315\004\177\207\036\n\376\006\370#\225"
+	.ascii	"3\020f\347\217\252,r\325\r\b.8N\007\323\t"
+	.text
+	.section	.gnu.lto_.refs.21b98934ff58aabc,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.21b98934ff58aabc,"e",@progbits
+	.string	"(\265/\375`\027\0175K"
+	.ascii	"Z\177\354\033B@\"R:\305-\276\347\341\224\367\3420\343\241U\340"
+	.ascii	"\230\366Usz\332m\202S\317U\373\264\377\r\254C\314,\356]4wk.\243"
+	.ascii	"3\002\302N\272\177}\340$W\f\3404uF;\273>\267 \177\313\024m\001"
+	.ascii	"\256\001\277\001-u\357\243o\027|C\335\267\3235\323t\215G51\347"
+	.ascii	"\306\227s\376\205\337B]\213\3512\t\200\344LFe\211\316\234\256"
+	.ascii	"l_\316o\266\3314\266\353\336\276\022$\034\020\"\211\373\002\024"
+	.ascii	"l\337t\3579\0339\027\030\372\251{\317p\333iZMc\025\364\232Oe"
+	.ascii	"8\220\t\227\333\206\213\272,J\204\333\263p\377\327\n\202}\306"
+	.ascii	"\302\033"
+	.string	"\215\200\240\224\372\346\245\017U\236x\301-P\205\333c\232Lc\241Z\356\375\366\333\205\3177_s~\227\204z\202\230\304\341\366!\334w\334\021\300\345\f\017\340\276\241\202K\r\025<\223{\241{\274v\n>\350\036\273m\013\b>\265S\220\351\313\337l\335v; \024\254\232\343r~\233\332,\331\347\030n\377\266S\320m\001\301\277\027\220\250\221h\303\221~<AN\353\357\021\002\"4=\360{\335\3775\377\263\377\347\376\347\371\363\177\257E\374\017\360?\302\377\004'\360\343D\r\342o\007\037\332\003\323\337\207\376\343\371;C\207\377v\376\353\375\327\323\347\303\037/\375=\305\301\350\307\300\2777\374\255\341\357\013\177?\370\233\301\337\005\376v\372[\300\337M\177\017\377>\372\273\377\373\375W\364\237\356?\237\377r\377\353\374\257\361_\006\240\377|\377\375\374\217\361\277\317\377\266\377\b\376\333\375\027\376\375\375\375\375\330\306\217\255~"
+	.ascii	"%\002\303\006\266\203\377-P\201\226\234\227\f\032\344\246\245"
+	.ascii	"i\212\375)C\345\314\224B\257d\314&\350\265\231\241b\360\246M"
+	.ascii	"\3207\217\025\310\327'\031\372V\231m\225\211\363\233\237d\323"
+	.ascii	"\374\2542s@\337,\315o\225\311\224\237S&\350\333dB\257d\323\206"
+	.ascii	"^\253\323\246\374\314\314\374l\216\271\317\352\024\032\247:e"
+	.ascii	"\202^\233S\350\223l\332\371\255\346\246C\367\2221\273\362\265"
+	.ascii	"9\3149\203\275VfR\316Mif\326\301a\231\214/,7\311\215\327\345"
+	.ascii	"}\222s\316\231\031\267WV\025\276\316\214\007\325R\315\352\312"
+	.ascii	"y/\207a`6\363\3159{e'\263s\356z\2459;\2536\250\325\266\343%\315"
+	.ascii	"\303\374l\2029\313\252I]\316\252W\3262\326S\350\265\254ja\315"
+	.ascii	"\230\2535;_f[\363\036\231\324\2752[\320\360Z\205\n\026\250\353"
+	.ascii	"\332\240\240\251\001\342\003\006\3712(\315\333\226\024\215V\251"
+	.ascii	"\376\311;bcS\026\207\375t\037%\254!8Rp\313\307@\322\227$G\312"
+	.ascii	"\330\334\326k7\035'\201\023\252\302\215\215\257\303\374\026\256"
+	.ascii	"]\247\364d\312O\26488\254\365\r\314\263J\302\234\311\344\254"
+	.ascii	"z\335\346Y\245\347\353\240\255\313o-\347|\247\367:O\353i<\275"
+	.ascii	"\247\261\255\327wo9=\347\006\336\234\237\335\366\267\333?\225"
+	.ascii	"\241\365\032\257\363\224\230o\216N\225\351\362\223`@BR\237t\220"
+	.ascii	"\020\245\266\363p\327i;\357\274\246\223\364\354\2746\347fw\003"
+	.ascii	"\245\356\006F\331\263f\230`\373Vs\337V\\\234\333)\370\324J\334"
+	.ascii	"~\323p\032{\273\266{\373eH-\016n\037XK\0370@\270\305V\236\245"
+	.ascii	"\342\351\213\202\253\310)\313s\342\026SQ\232\363\302\332%qq\224"
+	.ascii	"c)\277P8\327\304\214l\n\345\027\036\311\351\211Yq\373\026\314"
+	.ascii	"}\373cl\f\2275\323\353\314"
+	.string	"#\304\352\342\b\236@d\307e.u\257\317,\216\021\237\270!o\b\2718I\022\354\244\341r\364\b\033\315T\250\340\013u\353\022;v\202\233\030\221\003C\305-f\022\244*\221bh\017/\201\253\276C`\363\310]\032\334b%\035\007\243\245\211\331\001\331\270?F\202\305H\272L\373|\3634(fM\fN_\226\272\231\320t\206\307\305\314\210\0217H}a\n-\301\355\201B\210\020\301S\327\315\332g\204\3440}\321(\236\252\310\323\305*\354\002\302\326\224\036O\263\356\230\2636O:\030\b\006\202\303\246,\211\026\352\323\333S\347\016\330qXv\270'\307\347\004\267\370kIH\236*~p\213\2034\240$=Cf\364\224\301N\354\304^.Sv\346E\255\300:\202\020\025\351:\366\362\323v\331A[\204[\374\203L\335U\r\267\370\331q\\1%^\321g[#k\330\356\324\334\277?\314ts\207\tB\205\002"
+	.ascii	"\204\355.\213\3631\323\017\322!7A\240\230\356\356+\f\267\307"
+	.ascii	"U\227P+\"\324~\301\234\373\255F\245-\250\007\275\013\275P\373"
+	.ascii	"\271\314\234\217\274\260\321B}\231*\205j\277g\223rN \264\002"
+	.ascii	"J\244\b\267m\250\021\001\213\274e\375\020\035B\302\2332\321\370"
+	.ascii	"\f\341\022\225e\334b\273\257\357\336\354\326]A#\202\333\023\352"
+	.ascii	"2A9Q"
+	.string	"?D|\356[\216\373\343?\230\363\020\2437K\235Io\243n\250?IbV\325\223U\361\210eT\036\271\2068\252\220-\220f<+\n\353hL.\225RE+.\255\252\243Q*\251\344\222\"\240\245\305u<\"\217GK\252\240\016d2k\211<\036]\021\213Z\355\262\250\334*n\005\213XD\030E%1yb)F\222U\022Ic\213\230\304B&aP\251\2101\242\005\212\246gE\265\220\261\"\206\324\262\210\225$.\237J\024\223\310\022[\305\245\222G\214\245,\245\361h\274\312Rri])\271\226\304\245\222@\222\270T:-\215G\343\200W!U\210Z&\2119\242\254\222H\035T\305\2451\251\243\351U\306d\361X\304r\217A\003\005\r\033v\034-\265\220H\022TFVE\034UH\255#\227\253\244jZR%\2279\204Je1ieE<*\3660*\333gA82G1)\265D\"\223R"
+	.string	"\226T\033\216n\364\222j\352\302\362h\344r\317\201C\211\247\031/R\270UQ\311\342\026\261\230\\*\251\260\214WGd\225\324\321H\334\222\252J*\245\242\036\350\350d\361\352\212\353FpI\304\311d\021\030\306\311\360G\230\022:\fG\327xkN\254\030\f~]8i\232D\360\233\213\346\213\257\215[\373!I\221\314\211\371R\266\204(K\020\353\233\344F\f\330\023\263\341--6\211\2242\354\005\247\341\275\375M\301\355\332\032\336\022f\035V\371\320\3501\243\246\206\2674\026L\fN\237\220\312Y\026E\204\032\213\267\030\325\321\202&\367fv<\305\f\247\001\365\372\315\324*\360\217\233<\353Z\206R\241"
+	.string	"\200\371\002C\007\3558\3558\313T\206\367Y\333\242\327\304-\306r%\352\335\034\337\025l\375\205HifW.U\367\024\340\216L\247\270\305g\357\023\2016\250\241,g\224D\"2#\"\"I\322tQ\005\204 f\245\264\003\022\340%=R\"\207Dd&\005)\354\307\001\232\2323\333\321\024ef\310\240\b\220O(\004\350\257\355\271BA0a\007\340\334K\n\327&0\321\021\266b\350*\006\372\026\255\276RI\373\311m#\201\341\3640\036\370@\222>|@\260/\254\306\377\352"
+	.ascii	"\356*\254|\305[\376nj\237\023k\311\335E\201Q\202\340\257\250"
+	.ascii	"\030_\306h\017x\255\372\013\210\245\023\033B\304\023\021l$\257"
+	.ascii	"\352\343\300H4\231\365\252!2I\256\2328\001!5\006\005EUWb\344"
+	.ascii	"\233\344\013`R&\261\364Vw\"d0]e\fg\265\346\301)\217\251\274\305"
+	.ascii	"\223\344\212\200"
+	.string	"\037\331^]\025\252\b`\367\301\376\250D\206\264\340!\310\234\2007t\002\370\244\327\035\343/\207s\034\2718\005v\020\353s\346]Q\227\312iDo7\221\264\231O_\n\356!_\350lJ\b\367\211\030\341`\235\016k6\210\025\027 \325u\307#^\341\203U\342\275M\257E\332K,\007xv\332E\271\202\307K\203\n%\352\3666\303u\024\n\237\0171t\250\371 ;\332H\357\267\352\211O\336\360u\312\232Y\031_*T\031\230s_\276\251\303\360\350\272"
+	.string	"\235\314X\2337\365S\347\310\254\224nj\022\274\271n\035\032W\235\251\241h_y\204\235#\373*1y=!\346Te\376\017\023\377.\241=\021\237\226\230s\333\275\031\336\304\240\254\372\276{T\323bU\r\261\311\035\230\023\300\301\2134\353\252\303\020h-J*'\013\376\322w\362E\017\244\023v\210\301\344\003j\335\276\322\260]\225\377\tA\372\005\347\206\245"
+	.ascii	"\034\351\314Q\275\251\202\343\272\256kg\217\035\3674y)I\266\277"
+	.ascii	"\205\013\363\343!S\376\312oM\351\016q\177\301\031\303\022\232"
+	.ascii	"\22306\370\247Vc\377\024\345>\347\225\374\376\364\335\212\035"
+	.ascii	"1\307\266\311\206\341\n\337\301\374\326*\331(\276\375:`)v\314"
+	.ascii	"\322\303$o\377\337\216_w\374\277\336gn\203\240\003\336\203|7"
+	.ascii	"\370J]0\340E\263\204\036\346C\376\242fzO\344\336t\365\351X\030"
+	.ascii	"\367\353b\0168\037v^\005\276%\\\230y\201\367\363\217\265A\267"
+	.ascii	"'\346A\270\241X\265]U\fj\242\006"
+	.text
+	.section	.gnu.lto_.symtab.21b98934ff58aabc,"e",@progbits
+	.string	"config_streamer_init"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	"config_streamer_start"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\001"
+	.string	""
+	.string	"config_streamer_write"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\001"
+	.string	""
+	.string	"config_streamer_status"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\001"
+	.string	""
+	.string	"config_streamer_flush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\001"
+	.string	""
+	.string	"config_streamer_finish"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\001"
+	.string	""
+	.string	"FLASH_ProgramWord"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\001"
+	.string	""
+	.string	"FLASH_ErasePage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\001"
+	.string	""
+	.string	"FLASH_Unlock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\001"
+	.string	""
+	.string	"FLASH_Lock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.21b98934ff58aabc,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,609 @@
+	.file	"feature.c"
+	.section	.gnu.lto_.profile.89e9b3d72d7d2804,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.89e9b3d72d7d2804,"e",@progbits
+	.string	"(\265/\375 \263M\004"
+	.string	"\304\006\247"
+	.string	"\020"
+	.string	"\345\217\300\314\013\004\002"
+	.string	"\001\213\331\256\305\001\002\366\213\237\344\016\002\003\227\247\344\313\017\004\002\001\002\002\002\001\002\001\004\240\342\234\212\n\005\352\263\360\321\b\006\312\251\326\231\r\002\007\203\313\255\261\f\001\b\347\364\313\323\006\t\306\272\236\261\n\374\245\334\221\007\013\201\267\227\352\002\f\212\205\272\326\001\r\240\200\360{\016\017\240\342\234\212\n"
+	.string	"\013"
+	.ascii	"d\310\317\302ih\245\013\250\235\240\306\305\212|\332\003\326"
+	.ascii	"\310,%7\320\006\260"
+	.text
+	.section	.gnu.lto_.ipa_sra.89e9b3d72d7d2804,"e",@progbits
+	.string	"(\265/\375 Pu\001"
+	.string	"\330D"
+	.string	"\n"
+	.string	"\002"
+	.string	"\001\001\002\001\001\003"
+	.string	"\001\006\003\007\b\001\t\n"
+	.string	"\001\013"
+	.string	"\003"
+	.string	"\b"
+	.ascii	"`\020\\\2462\255\345\036\260\315e7\220\363\006\260"
+	.text
+	.section	.gnu.lto_.inline.89e9b3d72d7d2804,"e",@progbits
+	.string	"(\265/\375`\357"
+	.string	"\265\004"
+	.string	"bF\021\030\260%\351\f9\r\303"
+	.ascii	"\314q\215`\222$y\224\265\315\022B\310\336R\2463@p(\372\0070\205"
+	.ascii	"8\371{\310_1\246\237\277S\323\020\352\004\023\274\2569\347)?"
+	.ascii	"`\333n\374O\0237\276\202\204\266\344\207W\b\" \240\242\231\253"
+	.ascii	"\036\307\004\026\016B\216\221F\371:\231e\205\r\002\330\320(\206"
+	.ascii	"\024\301LR\200\274s\2239\242\355\277\023\311`\353\246I\337\263"
+	.ascii	"\267@\212/\202\364|9\020Ynt\255\023\347\216m\230k\336\362_\217"
+	.ascii	"cjF\372\233\253i`\b"
+	.text
+	.section	.gnu.lto_.jmpfuncs.89e9b3d72d7d2804,"e",@progbits
+	.string	"(\265/\375 P\245\001"
+	.string	"\024\002D"
+	.string	"\n"
+	.string	"\002\001\001\017\177\002\003\177\002"
+	.string	"\001\002\001\001\003"
+	.string	""
+	.string	"\006\003\007\b\t\n"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	"\007"
+	.ascii	"`\b\030Wep\313\221\232vp\331\177\003X"
+	.text
+	.section	.gnu.lto_.pureconst.89e9b3d72d7d2804,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\037"
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"\232\004\001\232\004\002\232\004\003\230\004\006\204\004\007"
+	.ascii	"\204\004\b\232\004\t\232\004\n\232\004\013\204\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.89e9b3d72d7d2804,"e",@progbits
+	.string	"(\265/\375`$"
+	.string	"]\003"
+	.string	"D\003\030\001"
+	.string	"\n"
+	.string	"\002"
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\001\002\003\001\001"
+	.string	""
+	.string	"  \002\001\270\006"
+	.string	""
+	.string	"\003\001\002\004"
+	.string	"\001\002\005\001\006\001\300\007"
+	.string	""
+	.string	""
+	.string	"\007\b\t\n"
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026"
+	.ascii	"\013#\343O\016`]\317\302\005J\013qd@{B\0137_\362s\024z\001$U"
+	.ascii	"\fT``\b\214\213\242\002\033.**\003:a0\023\225\335\360\005\030"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_.lto.89e9b3d72d7d2804,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_featureConfig_Registry.18.89e9b3d72d7d2804,"e",@progbits
+	.string	"(\265/\375 \225]\004"
+	.string	"\324\007_"
+	.string	""
+	.string	""
+	.string	"*"
+	.string	"\005\001\212\001\206\200\200\374\342\303\237\317\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\364\006us\350\307\006uq"
+	.string	"\005\001\006'\001\004\023?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\034./src/main/config/feature.c"
+	.string	"\004"
+	.ascii	")\"\301$\016\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_featureConfig.20.89e9b3d72d7d2804,"e",@progbits
+	.string	"(\265/\375 \036\361"
+	.string	""
+	.string	"\021"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006(\001\200\211\001?\202\210\200\b\177}\273\001"
+	.text
+	.section	.gnu.lto_intFeatureSet.21.89e9b3d72d7d2804,"e",@progbits
+	.string	"(\265/\375`p"
+	.string	"\215\t"
+	.string	"v\022B8@\217\322\001\320Fz\b\t4|\016\306\026k\250\225]'\f\031\350L\223\357f\033\262wm\013\r\366\230FZ\356\3560<O\202Zj\204\322\177\362\033/\277\335d\313\224\0020"
+	.string	"2"
+	.string	"/"
+	.string	"\227\007'\270\\f\027\270\\\372\263Q\n&"
+	.string	"FR\260\225\335\235\221\343\337\365\363/\362\214je\272b\032v\327\252Z]\334\361\266\021l3\330\317\004Q}\214\206b@e\327\"d\331\230,\361\260}\215m\005\037\362\375Ez\300.\313dA\2734\250]\355\203\274\365\335UrfW\243E\262\013*8A\013'W\245\2344\264\214\217\032\337\222\302@\035&Q\322:|\322\345\362\321!\254\3108ih\203&\215\033\366\263\335]G\226}\327/\377\372\263\250\326!\316\033\2116\256\243A\204\266Of\316\206\363F\242\215\353\314\007O\007\324q&\310\263}&\307\013\315\215\201\273\b\316\233\242\256\363\246\006\334g\033Y\226\037\261SDY\243\006\017"
+	.ascii	"2C{\025\030\027\210\250\303\206\352\340\263\217\364\255[.\274"
+	.ascii	"\3050/\b\277\251)p/\230\232\022\356\360\242\235d"
+	.text
+	.section	.gnu.lto_intFeatureClear.22.89e9b3d72d7d2804,"e",@progbits
+	.string	"(\265/\375`\200"
+	.string	"\375\t"
+	.string	"\026\323D=@\247(\035@\241\277\361\373\314]\273\024#\377\263Z\031\347\207\357\302)9\002`\037X\001o\033\262\273)I:\262P d\035\t\2071\023\271\001O+cF^\304X~\242\311&R\246\0242"
+	.string	"3"
+	.string	"1"
+	.string	"\206\310\036\035n\301\036\257+`\217\006\355\004\013\031\b\006H\252\005\273\253i\310\301'\350?\300)%S\350y@\261\273\316\222\211\343\326\333~\260=a\237!VM\247\246\237U\nXV\273\033-\006\313\212\003Fl\277b;\303\003"
+	.string	"\237\372<a\367\264\222\310\036\035fO\373%7\001\217\002\231\262\373q\"`7\214\b/)H\275\252\276\001\251c\224-c\232\232\004HW}\240L\304\377`\217\327\212\003\032\036\242l\331a(\025\304\376\265\273k=\331G\375\330S\177\324\f\035\316\363|\033\227\311.:\333\3462\346\302y\236o\3432\232\205&\303\3510\032G\263m4\214\327\321.\r\35608O\373\272\316\323*\341\376Z=9\222\260D:\262j\"\b\020"
+	.ascii	"2\241\025\034\030\027\b\252\303O\365\210\325b>\250Y\237e\351"
+	.ascii	"\032P\f\243\201\360\233\232\002\367\202\251)\341\016/\332I\006"
+	.text
+	.section	.gnu.lto_intFeatureClearAll.23.89e9b3d72d7d2804,"e",@progbits
+	.string	"(\265/\375`\025"
+	.string	"\225\007"
+	.string	"\262\31657Po\322\001 \232\307\355rP\303\302\026&z\036 MQ\310\320\264\232Zl\r\265;j\304\026\262m\375\235\b\231\0317\013\350\241QHS\036\306\341'vo\262wJ\001\034Z;\232E\261\312W\206\326\216fQl>h\260Mv\315\215\306\202\230W\345\314\f\202\263\bZ\247\226eub\272=\265\220sD)\205\340\204}\217\364E$<Oe\303\377\310\307\004\017\023K\350\235\354\016\364 \206}jw\327\220\263O\372\037%\220a@\262kqj\331R<\341\300\330\376\263\377q\220\355\244\317\007v\271\022\223\335\216\301\013\325\243\273\027\310\307\352\004\362\321\233\275r@\021\220R1b\332\335\t5\276\375m\376C\016 \032\201\376.\016\273\353'\032]\334\360\266\025l7\330\356\b\t"
+	.ascii	"2C\003\0258\036\201\306\004K0\344\022l\263\232\022\356\360\242"
+	.ascii	"\235d"
+	.text
+	.section	.gnu.lto_latchActiveFeatures.24.89e9b3d72d7d2804,"e",@progbits
+	.string	"(\265/\375`\022"
+	.string	"U\007"
+	.string	"\322\31526P\215\322\001$\251Y\272\262S\221Pe\036\217-\251\231+\262\315q\365B\227\f\251\017o\3735\356eG\t\273\221\231E\230u\037\310\002\214 \202\032\033\331D\356\224\002\306,\231\374x.\031\0062d0\233\210\301M\346\242\201\230\354@\213\201cC&\241'F\t\257\323\366ju\364DP\233\206|\365;\356\241\361I\216\034\216\365\247 \323\304\235s|"
+	.string	"v#\022\374\215\233\034|\322\237\037@\356\363\317\007Y\177\327\205\214\222is)\373\024rja\277Z\035\331w~5pBP\262K\221JY\324\013\301\260\375\313\232MR !02\361\201\262\273P/\256\335i\3765\0360E\020w\025\205\335\265\233\242\212[o\373\3006\202\355R\n"
+	.ascii	"3\241{\037x\305\\\366Tr\210\252A\027\362\263`\307\313\020\341"
+	.ascii	"r,\332I\006"
+	.text
+	.section	.gnu.lto_featureConfigured.25.89e9b3d72d7d2804,"e",@progbits
+	.string	"(\265/\375`I"
+	.string	"\355\b"
+	.string	"6\322@7@\217\322\001x\255@\200\277\265r\303\357\210\"\336J\226\337\320O0\264n\004~\250\277\315\265\007\005{Lk\225\237axT\311\363\201\274\026\001\320h\332[F6\2212\2450"
+	.string	"0"
+	.string	"/"
+	.string	"\332\007\266C\333^`PyeP\241-0\255\222\227\335/*\307W\317\225\377\220sb+\256\327\304\023\300aw\235\256\327\305\255\267\235`;\332\226\005\360\260_\323tj\372\233\200IAl\327b\026\263,0\305\303\266\312\326\330\316\264\377q\020\325a)\007\354f\234\240\354~\n\346d\0167'\330\016\003\232^S\241K\013\3033w\022\211\314.E\203/\362\221\222\337q\350\023*\357:\364Q\333\341\025A\006c\345\314\376\274\324\r\373\332\356\256U\303\001\020%\317H\363\247\003\352N&\017(\024\037D!\022\367\211$\221g\024?])v\016\314E\200\272h\342\270.j>\326\ru\303R\317~jK\205\372\226\212\2273\007\b"
+	.ascii	"2\003\3020\275\341\310\241\262\272\313\250@\215o\342\020\246"
+	.ascii	"sM2"
+	.text
+	.section	.gnu.lto_feature.26.89e9b3d72d7d2804,"e",@progbits
+	.string	"(\265/\375`;"
+	.string	"\225\b"
+	.string	"V\021>8@\305(\035\365a|Te\221\300\374\177\2104\351\017\351\372\313O\226q\177\244o\365\332^\277MQ6\234XB\270\253(.\272'f\b\0265\036\326\267\377`d\023)S\n."
+	.string	"/"
+	.string	"+"
+	.string	"\207\266\315\320 \362\310@BU\002\234FVv\275\250\032\037=G\376A\016)T$\250\024\351\031\340\260\273NT\252\342\326\333F\260\035m\243\004\351\324\364\257\005\213\202ow\342\003\260)\320\244\303\266\310\276\330\316\264\357\361\017\321W\235-\273\027\034%\273\236\202\023\004\0161'\270\016\255\017\\\001'\246\374l\3515\365'\225\351!\027\351\374\r\203By\324\241\037\272\016\257\026U)?\333#\245f\330\267vw\255\030\206_\375\226\006\020\036\214c9\313h\034\350\203i\232\370\260\321t\266,v6\030'f\234'f\016\274Eh\\\374l\033\027/\336\336P1%5\331\357\256T\250?\005\b"
+	.ascii	"2\003\302\260\200\341H\204\262\244\313\250@\215o\344\020\306"
+	.ascii	"tM2"
+	.text
+	.section	.gnu.lto_featureSet.27.89e9b3d72d7d2804,"e",@progbits
+	.string	"(\265/\375`o"
+	.string	"\225\t"
+	.string	"F\022B:0\345(\035\200\177t\254n\260C2\340\314/\253\314\256\001\263i\025\314,uu\210\303\033\302\266\002\332r\203m\3165\275\016-\311FC\205\341\0165\3236\205\204\307 \233\310\235R."
+	.string	"2"
+	.string	"/"
+	.string	"\231\355R;\301v\351\317^y\310\261\177M\244`.\273;u\365\357\361\363\337:\006TI<\006,\354\256#\250\252\270\365\266\021lO\373\003\001\333\206\241R \333\245\230\001\330\230L\361\360G\356*=tC\twi\227l\356\362\234\355G\373!\027\371\3162\031\263\233\001\202\262\033*8A\340\362\340\001\001R\026\250\223\034f\362;,\"\305\203\227~\304v\031\365\256gV/\331\311\305)\316\354\020\025u\303\276\266\273k\325\2605Z;\353W\215\216\001\017\242\rH3G\323\361H\243M\3073\035>\236P\307\231\241\317\00649\236hj\f\334At\2749\352:or\341\351\2553|\304^XN\212\262\246&\007[T\243j\372\017"
+	.ascii	"2\003\302p\036aYL<\bXR\354\256\262\211\244\254\256\313h\246\342"
+	.ascii	"\001\rx\205\240\304\3524\270\226\027\302$\003"
+	.text
+	.section	.gnu.lto_featureClear.28.89e9b3d72d7d2804,"e",@progbits
+	.string	"(\265/\375`\177"
+	.string	"\365\t"
+	.string	"f\223E=@\305(\035\340\265^\254\253\273'\300\277 \023%\362`\033mF\311\240\373F4\231h&\360S\3615\262\253\256\rU6\234\370+?\254\241\2001\347!\226-\2344y\210\305F6\221;\2451"
+	.string	"4"
+	.string	"1"
+	.string	"\005\227\t\327h\227\331\r\264K{\366\200\207\035\373\223U\nf`w\247r\334{\364\374\273\236\001U\025\217\030\207\335u\004U\027\267\336\366\202\355i_!W\215\216\030m$\300\001\313\256E\f\301\002\220. \276\311_\246\207\206X!\331\335\355\3226\331\333\3457\333\217\366Y/\361\336:9\263\233\301j\331\r\033\314\020_\214Y5\323\370\222:\312a'\337\303\243R<x\351Sh\227Q\377\272\346\343\023\240\202\201\2121;\374\242n\330\317vw\255\032\266FK\215\316\336z\022#N(sg\343\351J$\216\3473#@\037\021\327\231\"\020'4;\335hn\020\314Mx\272I\342\270nn!\352\256?\210\204\034 \200\322\317RS\016\026\3104\252\324'H\255\002\016"
+	.ascii	"2\003\302p\301\3022\231x\020\260\252\354\016\301^$5t\270\314"
+	.ascii	"f*\036\240B\020\253\323\340Z^\b\223\f"
+	.text
+	.section	.gnu.lto_featureClearAll.29.89e9b3d72d7d2804,"e",@progbits
+	.string	"(\265/\375`\016"
+	.string	"5\007"
+	.string	"\322\r26@o\222\016\200\324=\214\037[\005\342\275\321Y\314U\245\376\003\2711\277s\202\334\242\315\247\366\254\240\026xA\232F\024\b?I\306\230\306\210\373\316)\002\250\246\t\221)_\027L\3338\030,\023\0274\231Mv\305\215\006\303\020/\315!^\n\316\0320-r\262L\213V\347)\251\t\243\\9\361\300\317w\253nW\217\355n\374"
+	.string	"\361\n*u#\252R5u\200EtQB\361\274\323w\237\0071\276"
+	.string	"\231\231C\321\303J\244\204 %\223\342\324\222$\324\b\307\337\333QS\247\245\025B\254R\337y\253T\255\2717i\247\221\375\260\230"
+	.string	"Q\311\314\b3\312\365q\267\244\n\200B\022}\001\b\231\371\003\205*:\354o\360\037\374\243\n"
+	.ascii	"2\003\302\360\024am\f\001\306e\nP\001\235\n\372r\005\270t\213"
+	.ascii	"v>\001"
+	.text
+	.section	.gnu.lto_featureMask.30.89e9b3d72d7d2804,"e",@progbits
+	.string	"(\265/\375`\002"
+	.string	"-\007"
+	.string	"\342\31525Po\322\001 \3164\356\250M,Q\005\021\240\005E\224\222\321 \025\305o2P\353\321\333F\004\266\352#iWU5\222\224^\344qQ0v\037l\357-eJ\001\2362\224\005\372h\250M\\\340l:\325\024;\034\rC\234,O\314\030\270j\240\254\370\251*+^6\354n\225d\305`:\262\355\271\b(`7\"\301\017\371\346\340o\374\371!\224\317\376\374\020\374K\025"
+	.string	"\301\262do\243T\013\373n\225d;\235\nMR\nNv'J-\213\362J8l\213\354\213\337q\017\221/\267ehpDC\202\204ew\213\230\023\300?\367\001\370\247\030\277\236\227\377\217\273\225\n\225L\203x\002(\354\2563\323(n\275\355\003\333\b\266/\002\b"
+	.string	"\002\013\255\262\030\005\205"
+	.ascii	"]\303o#F\026\"\017w\305\324N2"
+	.text
+	.section	.gnu.lto_.symbol_nodes.89e9b3d72d7d2804,"e",@progbits
+	.string	"(\265/\375`E"
+	.string	"\225\004"
+	.string	"\344\006A\001"
+	.string	""
+	.string	""
+	.string	"\002\025\177\006\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\220\202\002\026\177\007\027\177\b\030\177\t\005\017\n\301\204\005\016\013\300\003\002\031\177\f\032\177\r\033\177\016\034\177\017\002\035\177\020\036\177\021\005\024\022\305\204\001"
+	.string	".pg_resetdata"
+	.string	""
+	.string	"\005\022\023gistry"
+	.string	""
+	.string	"\005\020\024\b\025\301\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016"
+	.ascii	"P\223}9\267\001\264\033\303\227\001=\3007\340\033ux\3152\302"
+	.ascii	"\006K\003z\200o\200\037\2565\307"
+	.text
+	.section	.gnu.lto_.refs.89e9b3d72d7d2804,"e",@progbits
+	.string	"(\265/\375 C\335\001"
+	.string	"\264\002?"
+	.string	""
+	.string	""
+	.string	"\002\003"
+	.string	"\004\001"
+	.string	"\001\005\002"
+	.string	"\001\006\007"
+	.string	"\005\001"
+	.string	"\002\b\004\003"
+	.string	"\002\t\004"
+	.string	"\001\n\001\013\003\r\002\004\002\016\002\f"
+	.string	"\005"
+	.ascii	"3C\200\240[F\277\234\321\266,\001"
+	.text
+	.section	.gnu.lto_.decls.89e9b3d72d7d2804,"e",@progbits
+	.string	"(\265/\375`\347\0165M"
+	.ascii	"\332\2054\035U@R:J\007\256)\302`\342\343\347\356\025O%\021\234"
+	.ascii	"d\205U<\013\243\351\226&\tM\306\240\b\242!dv\272\276\264\213"
+	.ascii	"\331\206\024vS*\263\020X\022\207\020\246\026\366\035T\211\335"
+	.ascii	"=\267*\276w\357\314\256/\200\321\023\265\361\025\337\270\330"
+	.ascii	"\2410\"\202\375\245L\001\204\001\276\001\277\001i\021\305\351"
+	.ascii	"\356\005\033\325\302M\355\224l\352 \275\307%)Tww\243Y\310'\242"
+	.ascii	"-\365\365\021\230\204xC\251\033\331M\r\240\213\246\335\255\243"
+	.ascii	"}\350v+\245\301n\037\021\205!q\271\350\b\366\255\177=&\337\023"
+	.ascii	"\021G\311G\324\321I\206\254\020h|\"\312\370\212b,\266/E\267\330"
+	.ascii	"H\247\240iD\323^'n\306\250!S\032\300PI\f\\\245\250(\213 \241"
+	.ascii	"\312\301\245\005\365%\204\030\3273\360\313\370j\355\020k\\\261"
+	.ascii	"\243\333)\210\001C\304\224\276\312t\247[\233\256\326f\325\264"
+	.ascii	"\373\205\212\333\023q\307V\255\237a^\001\363\337(>73^|S\214\265"
+	.ascii	"Uk\254\001\231\210\235\325\235\356\230Za\216K\\\267\311:\331"
+	.ascii	"\324g\237|\241\354\325m\277\264\215\335)\316\346\305\t Y\\[l"
+	.ascii	"\212\262\366\230_\253\343\240\264\003g\363\353S\342\326\247|"
+	.ascii	"\272)Jsy\3123&\314\276T\021\323\305h\363o\022e\345\277V\224\370"
+	.ascii	"o\373\027l\f\305\277T\265\177\203\250b\344\177O\375\267\207\377"
+	.ascii	"Z\377\342\374\347\237\013\370w\306\277@\377^\360\257\005\377"
+	.ascii	"V\360/\215\1773\370\340_\004\376\245\340\337\t\326\203\377\270"
+	.ascii	"\237\233\376\355\340\337\032\377j\360\357\355\377\331\177\263"
+	.ascii	"\377b\376'\377\227\375'\373\257\345\377\330\377\260\377W\376"
+	.ascii	"W\371O\345\177\327\177)\377\257\376o\375\307\372o\374/\300\177"
+	.ascii	",\377oiiii?\327\237\177\3747\020\004Q\256|H\232gEb\217\2635\222"
+	.ascii	")9J\20113\3330 \305\032\030\027\021^ab\304l\322\324i\337\226"
+	.ascii	"a\361\306\245\025v\306+L\230Mn\005WKI\024M\222X\302p\335d\335"
+	.ascii	"b\345\005\311\225\261\312\312\226\254Fj@\232\245\342\024\rb\322"
+	.ascii	"\3064\341\302e\311l\335df\226\212ep\202\024Y\222\004\327%[\344"
+	.ascii	"m\f\326\321\t\327E\362*\261_\276\310\365\202\363K\027Y\273{\273"
+	.ascii	".rv]\324\200\031\351]\225\365\254\304\374\230RL\0064\254\203"
+	.ascii	"\371=\356j\321\262\306\032\030\030\321$\331\301\024\306Yh~\327"
+	.ascii	"8\226\356\330v-\0324\2430\261Jvp\b\303\366\245\210\224\0254Y"
+	.ascii	"\262l\230\331e5\307.\301\343\307|\303j\264$9\262\205D\002\211"
+	.ascii	"\2752V4\301\310<\r\255|\257\324\274\262\250\220`U\252,\025\023"
+	.ascii	"\355\256u\007\271R\\\030zbfX\346\267\210\365\372~=\335\257\245"
+	.ascii	"\262\035\354\036v\255\254k\251X\246\207C\237\362k\nHo\312\227"
+	.ascii	"\312\277\200\003\017\203\323]\325\335+li\270R!\\\327\2105.\220"
+	.ascii	"\007\"\312\365c\026\313\004.QOp\375\346`\376\377\226\3353\324"
+	.ascii	"\244\035\364\341|kv}\376\333\326\366\200\356\024P\335=\270\230"
+	.ascii	"\231H\212\350\371\340\372\277E\373t\243A\240\321\t\335\001\032"
+	.ascii	"{\r\304:\nw\200i\017\031\240\215P\rL\211h%\242\334i\377\234\204"
+	.ascii	"\375#\242I\300\264\203\235\022Q\235\376\tu\200i\017\005\032\235"
+	.ascii	"\204\0134\022\205;\375k\264\177\275!\346"
+	.string	"\217(\004f!\nu\200\306\236\020\370s\022n\247\304\336$\246\244N\250R\033{\267\356f\n\314d\217\303\264g\270\351*nIVq\223M\231\352*\322\356\254\027\004\334\316|)\343\244d\262\004\307\213\207\017\035\\y*\314\032\261,A\025\021bSV\202\323\001\004\332\021\256\034\304\301\324\035(\217\245\203\325\032\276\250\302z0_\237\314W\033\212f\227$\020\261\240\371\312dr\024\027\331\264\207\215\234{`\"\257\351\245\235r\024\232\326\025\327W\237\371\355)kii\333S\276\226\306\344\345)u6E\371\032\031\363\265&\314\237u\200\2521^1\023\203\342'\336\022\306\344\343\312D\036\262)\013v\272\245Y\222\346\314\027\363\313\242\334\264eQ\276\326\305\324Y\236\262\205\317\362\224|\003\343\200c\342\265\003\3270\004\037\306\270\270V\033\030\213T\261\251\206\034\344\021\255'=j\270\322\314p\340\3124\230J\265#zP"
+	.string	"!B\210\017\256g\032\376}\202gp!\r\355\214\353\221\233\242\344\240\214\263\360F\254J\322\212+N-5\277Kv\315\234\231\314pS}\222\nO\320\n\376\200a\303D)\212\230\324f\003\021\264(\256\fd\036\274\364\333lS\230\266\374\2302\317;P\020\321b$\b\256\274\007+Y\351\254\343\267\331T\005\177ZH\314\363\217a\370m5\264,Svp}-\312<\373^Xb\310\022\256\3343\225j?zldP\300Dq=\367\376E\263h\214\242\320\0030\223\217!\023\\7\215\373\214n\232/\340\300k(\024F\033 v\367\030\305\241\351\356\341v]\354\272\250L\236\244\266\312\372\332\r\346\223\233\242\314Y\236r\237\220\361=\303S\006\2078\226\312\302\202\205\353\215\315\220!\263g"
+	.string	"\024m\002\277\021\343\003\0228\030\341\207w\022\351r\274\026*\b!\031\001\235:$ \\\216$$ "
+	.string	"x\277\021\203(\351\207(\211G\350\b\207\006\274swsd\203kvA8\274\240#\242\244\232#\242\244\032/\350\001\031\247\013E\273\272\333\235\272\241\241\234M\216$$\241\312\013\212\300F\307K\252\375\226C\307\333\025\021\235\"\004\t0t\036\021\025\031\345l\206\316\035\216z\204T\304\023:w6\317\361rC\272 \242\244\0309\272\334\r\241\032t\362rFI+\234$\360\316\335)\002Q\022\013\025v9\020n\214\214h\340\330@ac\204\204tAP\315\320\251\303\261\363A\216g\205\223\267\3131B"
+	.string	"'\013E<!\0327\204x9#\036##\032"
+	.string	"\350r\247\021\020\356B\274s\004\336Q\321\355BE\272\363\350$2\337\300\003\t<\020A\0136\274\337Xq\244\244S\367\303CB\322\375\334\354\202\200p;\r\206N\243\024rG'\216\027\264"
+	.string	"\003\274\243\"\034\346%\220"
+	.ascii	"\250E\t!l`\n\3058u8x\271\323\306\017Q\221\215#$\241\237\243\242"
+	.ascii	"\334\n?B\272\335O\214\002\272\266\253\362\220\322t\003Ki\252"
+	.ascii	"\025\201ff\213\267\266\3268#\253{B\237#Z\2112e:\210\004\214\035"
+	.ascii	"#G%e\346\317Y\234\265]\365\247\323\277\247%\274nZ\306\341\224"
+	.ascii	"\025\226\341\234\303\246,\003GQ\361$Es\246\254z\234\345P\306"
+	.ascii	"\025+\375\331,\341\300\225%\305\374V\ta\035\220Av`\250\2521)"
+	.ascii	"\376A\210,I\006~\006\202\204\251\3668\324\351\037\021e\311\255"
+	.ascii	"\262b\036\030*\007\335\351\206\022+>a#_q\312N\030\312\246l\305"
+	.ascii	"@\234}\360\217\253H\317D\330\212}\340#{$2\243*\354\205\212\027"
+	.ascii	"7^\306H\035s\252\220\203Y\341\003\326pB\226\354N\2518I\201#\250"
+	.ascii	"\2210f\020DfFd&\020\3214I\007\361\004\204(\013\2653\017\021\200"
+	.ascii	"\235\202\f\315\210\246\240 \205\302p\357\322\217\305\313\376"
+	.ascii	"\237\223t2q7)z.o\310\006\340\001\210\020\177')^8DY_\345\255y"
+	.ascii	"B#1\251\333\267;\220\201\254\234\217E\031\327\310\025\375X4z"
+	.ascii	"=4\205q:\256\335\237\2231\242\353d\237\217:K\t\221\023\312uj"
+	.ascii	"}\370"
+	.string	"\327\346\316\200\350\346\366G"
+	.string	"\256\375\226"
+	.string	"\\\3459\002;\244$\006\340X\205f\"\350\260\354\266\371l\234\222\007%+#\351\013\242\376\267n\320\212\326GPY\036\220\201\331o\214\204*$\fd\207eM\213Z\337\025s\262\235Pv\270P\375|9s\211\342\263\021\025\315R\005\f\016\214\021E\207\301\261\022\027\264\204|9;i^\360\311\276\241\024\225yO\034T\271#\177(K\365S\371p\n"
+	.string	"6;%C\305BV mXb\277u$)\313v\273\272\267\325\314\374=\246K\026\330\370\367\"\333\f\021\235\341x\377\316\371\250\t\027os\326\262\261#i\335WA\374{l\363ql\017A\n;@\376\0358\377D\244\211\226\217p\203\211'\237\275}\237\317\373\330\273\363q^\2039\213\207D\203\342\360\324\373j\270<\325\013\221\""
+	.ascii	"\250\323wE\344-B\247\267H\226\267yF\017\265\275\001\323\202\335"
+	.ascii	"\036T\235l}\023`>\257\303q*\\_\371\264\323qs\252>d\245\225\216"
+	.ascii	"\205\371\031\270=m\271\370}_\261\3408-\0036\202\364n\203d*Y\007"
+	.ascii	"f\034:\216Z\025\375\031\027?E9\025\2509\247\256\272\013\374P"
+	.ascii	"CD\334\\\353\263\240\247\214\026_\241\303\355\037\231\3706B\030"
+	.ascii	"w\260I\245<o\247\216\205\252\344\377\031\361w\210\0369\272\037"
+	.ascii	"9^\314\2441\220\002I\356\003\035ZN8\313'\201\021\227\221\253"
+	.ascii	"\031\"\002\373\370\017\024\244\234\233t\242\360\360@7\372]8\316"
+	.ascii	"'\372\026\341\003\315+\217\301\306r\331\261o\335\212-},\007\355"
+	.ascii	"\211\3630\237\235\226\n~$\233\030\321y\264\263\361\237\026\377"
+	.ascii	"\305\331\277Y/`\245\260\357<\312\237\324u\273<\257\341(\346\300"
+	.ascii	"\326\363\233\277\222\020\237\252\253Y\253y\367_\331\252"
+	.text
+	.section	.gnu.lto_.symtab.89e9b3d72d7d2804,"e",@progbits
+	.string	"intFeatureSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324"
+	.string	""
+	.string	""
+	.string	"intFeatureClear"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326"
+	.string	""
+	.string	""
+	.string	"intFeatureClearAll"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332"
+	.string	""
+	.string	""
+	.string	"latchActiveFeatures"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335"
+	.string	""
+	.string	""
+	.string	"featureConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337"
+	.string	""
+	.string	""
+	.string	"featureConfigured"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352"
+	.string	""
+	.string	""
+	.string	"feature"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354"
+	.string	""
+	.string	""
+	.string	"featureSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360"
+	.string	""
+	.string	""
+	.string	"featureClear"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362"
+	.string	""
+	.string	""
+	.string	"featureClearAll"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364"
+	.string	""
+	.string	""
+	.string	"featureMask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367"
+	.string	""
+	.string	""
+	.string	"pgResetTemplate_featureConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\001"
+	.string	""
+	.string	"featureConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\001"
+	.string	""
+	.string	"featureConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.89e9b3d72d7d2804,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
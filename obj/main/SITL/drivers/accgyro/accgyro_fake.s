@@ -0,0 +1,580 @@
+	.file	"accgyro_fake.c"
+	.section	.gnu.lto_.profile.7c9f5dc33c79c64a,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.7c9f5dc33c79c64a,"e",@progbits
+	.string	"(\265/\375 \3745\005"
+	.string	"\262H (\2209\035\220\tN\217\004\274x\3730Vx\253\352\257h\234\316@N\255\372\377\377\377\257\372\226,-i{e\333[\356$e*\247j\263"
+	.string	"\374y>t\376s\030)\326@\213\270)\310\001\233{\371}\374\276\277w\336\254\271,\006h\257\256\247$\221=\036\t\017\243BEa\223i\347\375\3751\242Q\033\324fT\034\324cf\346@\206!\234\234\252\315\372\335\277\327K\321\342rMV\247& 4TRL\017"
+	.ascii	"\210\n\037\356\305B\032\320\bp\374N\t\3406\220\005\344\003\023"
+	.ascii	"\273\273OYh%\365\335\r\033h\003"
+	.text
+	.section	.gnu.lto_.ipa_sra.7c9f5dc33c79c64a,"e",@progbits
+	.string	"(\265/\375 \307\205\002"
+	.string	"4\002\273"
+	.string	"\013"
+	.string	"\002"
+	.string	"\020"
+	.string	"\007\003\001\001\001\003\005"
+	.string	"\001"
+	.string	"\001\006\002\b\t\013\004\f\r\016\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\023"
+	.string	"I\t\001\354\326p\"G@Q\004\356\274"
+	.string	"w2\215qf\240\231e\355Tk\361$"
+	.ascii	"\354\245pV\031\2533\306.\230\r`\001"
+	.text
+	.section	.gnu.lto_.inline.7c9f5dc33c79c64a,"e",@progbits
+	.string	"(\265/\375`P\001}\006"
+	.string	"\022\211\036)\200EI\007C\\\005\fx\260\200\001!\252`)\207\n\001W\030V\241\3375\0274\t\232"
+	.ascii	"\nk\r\221\366\377\326\310\336;\005;\257\310\304\312\260 \351"
+	.ascii	"\371\206\013\377\244l\341\333\240j\313f\313!\334G\023\264\376"
+	.ascii	"\237\226H\271D(v\363\213|\264efVF\023\303\004(\b\230\260\227"
+	.ascii	"P\200\222X\016\370\037\336\3671\222`\240\002A|\217\3157\332:"
+	.ascii	"\036\377\032\266m>\033\023\001! p\242RU\347\001\366,p\206.\030"
+	.ascii	"Y\2575\250\025o\036Y\3112\234\340E[\301\345\027[\2117EV`n\312"
+	.ascii	"\355\375\322aa\236e\306\212A\357\327mnb\367B\330\305\021\361"
+	.ascii	"\001\314\no</\261\314\210l3\241\325\205\2105\b\256c\024\305\r"
+	.text
+	.section	.gnu.lto_.jmpfuncs.7c9f5dc33c79c64a,"e",@progbits
+	.string	"(\265/\375`\335"
+	.string	"\r\006"
+	.string	"\242\211!,\200\265I\00730\003+{b\234\031(3\003 q\021\t\017\376 \314\232\261\037\024\214\211TU|Y\324\030\253}[\311\222\336m'\031\323$)\332p\225s\224\0230U\002N\345\n"
+	.string	"\034\212@\242\\d\321l\022\361\001\023\370\306\367\302\1772+\234\206\023\036\341+\352#i\026\243\265\003OXv\366\206\330C\f\177|\020\365\221\232\265\343E\301vI\345\366a^=\257\333\266\341\370\224\277\301\216\355c\231B\332\r\002\027"
+	.string	";\317\200g:h\0170\f\b\332\240\025\214E@a\346\245c\212\n\334@\336*\\\006<\277B&\260\r4\3468C\360\336 \007\200#]\t\0078F\232\237\f"
+	.ascii	"\016"
+	.text
+	.section	.gnu.lto_.pureconst.7c9f5dc33c79c64a,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\""
+	.string	""
+	.string	""
+	.string	"\013"
+	.ascii	"\200\004\001\232\004\003\232\004\005\230\005\006\230\004\b\230"
+	.ascii	"\005\t\230\004\013\232\004\f\232\004\r\232\004\016\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.7c9f5dc33c79c64a,"e",@progbits
+	.string	"(\265/\375`\256"
+	.string	"\025\006"
+	.ascii	"\202G\030!\240'\351\377\377\3476\227m=/\352\377\377o^l0\373\377"
+	.ascii	"O\337\316\347\267\337\337\366'\2555)So\226\242\305\025\355hT"
+	.ascii	"Y\025V\204\217\327BPZ\214[(K\321\357k\242\013`\302\301m\226\362"
+	.ascii	"\300\306\362\3040\020\225\"\252U\376a0\247?\345\323)G\324Lps"
+	.ascii	"~(\177\332\333\336LI/ \340\202\021\023\335\210y\343AMv\211\033"
+	.ascii	"\033\013s\335\307\305e\221A\230\205.n\017\204i\"hC]f\344w\341"
+	.ascii	"\206\215\n\303\fQ\006h_\035\212\210\035\035H\222c\370+\354\203"
+	.ascii	"\360\242C\034\371\260\217A\207\354`\257\205b\260\rj\327\035\354"
+	.ascii	"W\243\210\241\234\341\312`_\r\354\212\006\206"
+	.text
+	.section	.gnu.lto_.lto.7c9f5dc33c79c64a,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_fakeGyroInit.21.7c9f5dc33c79c64a,"e",@progbits
+	.string	"(\265/\375`\330"
+	.string	"U\f"
+	.string	"v\027UB\020\221\232\0168\325\006\330wB\004\243\026\033\354 F\211\032\200\270\235\357mVx\250\272\374\f\025\370\ti\2179\003\314\253\217\310\270'L"
+	.string	""
+	.string	"\221\252HtQpwT\212`\262y\n{\266'{K\231RA"
+	.string	">"
+	.string	"D"
+	.string	"\004\244Ck\266\215w-\253 \206\212L\216\335\245T\304\265?M\315\177\3147\221\333\376\246\016\327\3471r\201#"
+	.string	"\227\362<+#\342c\236\0328\224L"
+	.string	"\fv\327\0319\0167\274\355\006\266\027\330w\020 N\262\306\356\266T\026\373ow\327*\262\017\363?Mg\246\277\271TVx`\354\256\324\354X\031\360\005\t\216\355\247\375\022\177\321\016\023\372\200]Q\213\231\335\356\303\t\246Cw\367H\207\323\003\n\001\005\215\224\244q'\375K\272\332\"#\371\230Z \203n\366U`\350D\033\273L\205iw\021\244 \001\031\230\341\022\222\016\257\352\341F\374\360\3247\361\023!\337\305\027J\362\361\320/\221\016\223E\215\020/\001Xf\022\362\\\201X\"\037\t\017\260\314$\244\252>\024(\263H\256,\0025\341\372\214PU\006\242@<\214Q\2602\312\002\206e\024\247\333\277U\221?6\350\030\235(\312\023\220ve\345\243U\267\267\320\214fTY|\340\031\024"
+	.string	"_\2417\023z\3051\260\n\203"
+	.ascii	"73\027\320\373\017\323\374\270\365xJ\212\t}\276`G\305\264Q\201"
+	.ascii	"\024\214\272\204\325\254F\207\273\034\263I\032\230\332\003"
+	.text
+	.section	.gnu.lto_fakeGyroSet.22.7c9f5dc33c79c64a,"e",@progbits
+	.string	"(\265/\375`\005\002\265\020"
+	.string	"\006\335hH\340\262(\035`e\204D*D\226Q\313\334\273\n\005\224MALm\323\031\2662\274\300\211\226\357\207\214\204\3226\204\255>\306\020\301f\017\212EbSpb\2141\006\347\372\342\2056\342\300\225\234#\246\021\345\337,\267\335;\245O"
+	.string	"Q"
+	.string	"T"
+	.ascii	"{\"\247\266\273&C\030\275\206\314O\373\260\307\304\317\250\\"
+	.ascii	"\300.L\254\266K\232\374`\364j\362\006\266\327\321\tl\257\026"
+	.ascii	"m\236\003\036J>>\270\370\331\335\216\246\270\370)\372\227\035"
+	.ascii	"\300\330\262\362)\"\331]\317\261e\304Mo{\201m\225=W\001k\nco"
+	.ascii	"\323\244\337\374\242\333\374\3655?\375\314?\003$\240\001\262"
+	.ascii	"\343\007\355A\256\210\240 \253Sg\304\330\276\017\3434\223\317"
+	.ascii	"L}^\\Ll\356\305\313\223\317\\Yp\257\366\211\315\275N\316\276"
+	.ascii	"i\315\220ey\201\210`\303CB\311\323\210\257i\271n\324\366\310"
+	.ascii	"k\264\n"
+	.string	"\250\330]\007>\215\343\244\274o~\374\266\327\313>\200\007\354%\346R\232$\352\227\252\222\371\321\nX\350\212_^\006k\356\214/\275z\rD\260\263\273\rb\244h\360W\250l\257$\372\362\"&f2\262\262\204k\006\331\344kR\024\366C\273\033\276pb\220r\224wx\310\336\351+IU@\201!\212\005\317Ku\254\360\343\240\n)t\030T\251U\347\205\254\356$b0\303\027v\033@0\3548\322u\331C1:@=.\372\242I8\355\244\222D\b\231\236\2436{\302u\240F%S\354\307GDs\236\003\207q6\240j\372\r\033#\260\02641 \200\002\2319\273\003Y\334\240\205\363==1\240\206\221\026v* &\236\322\316\322\202U\002\256\271Sb!\020#\037\r\213\314\016\306\321q@\235\rv5s9c\321\"G\274`\225G\033\032?\2101\306m\250\"\312\277B\017\306\030q\210\001\224\033\304"
+	.string	"\210\202#\022\247;6\314\201!%|"
+	.ascii	"\303\022B\300\022\203+\322\326\224\210\303\213\326\220\001"
+	.text
+	.section	.gnu.lto_fakeGyroRead.23.7c9f5dc33c79c64a,"e",@progbits
+	.string	"(\265/\375`\032\003u\024"
+	.string	"\226\243~I\300\224Q:\310h\204\243\335m\234rZ)9\337v>A2\301b\375IT\201\034!v\343\367-\237\375;\334\372\343\343\317"
+	.string	"\320\366|\005\265\247?\361)\036\266\013\246\241?C\t-\023\037\212\214q\377\016\201\245d\023)S\nh"
+	.string	"c"
+	.string	"n"
+	.string	"\266\252\375\333\177p\016t\363\2239y|9\346\304\251\030B\352\322\270\243\204\227\251\017\b/m{A\003\034\303\216\353\321\021 \013\001\242\306\323\2348qY\034v\t\256\302\374\234\313\030\272\035p\233\210zKE\266\023_0eL2\241\262\315@\024\336\216\221\007]I\330d\252"
+	.string	"X\346\234V\232\255\304\035\336v\005\333,{'\004\256\003\2769\247\003\0333\035|\237\233\360\322d\237\273\036E\351\226\212P\304\364g\343d\272+\354\203s\316\351\345\261C\265\311\201\376\224\325R\252A\251^\251\376\t\003\246\247\246\002\2729u~QSI\356^\330\276O\364\\MO\215=d\240\006\3433.ds\234e\315i\274\3159U6\266\352rm\034[\345F\264#1\375)\370\216\226\007\276\216#\271\330/+=m\025^\352J\250\t\031\177v\327}W\342kQ\273\2157\247\230\376\364\b\tO\0058\304\372\320)\034\355@1\3156\347.h\243\322\032\026~/\320(2\323$\266[\307\001K\245\346\234\337\007]S\324|\306\037\240\0225Y?\007\023\243\247\031\301ls\374\334o\320\350i\317Y\346E\001\336\260\222"
+	.ascii	"4k\245\025\263\312\360\342z\331h`\261V\"\315\253\365\001\346"
+	.ascii	"\205A\234\201Y\311\210\254\027\215\270\222b\027\207\326K\364"
+	.ascii	"\340r\275D\025.vp.\217\303\336\230\323\201\017z\204\336\210\234"
+	.ascii	"n\257\273\\\021\266\345\232%\2662)$\004.\221!\347\275\027Do\244"
+	.ascii	"\360\022\204\332\005\362C\345I>v\003\360\214d\354t{\264\020\360"
+	.ascii	"\331\302y\270\2446@\250QH\346\03013#2\n\n\n\232\026\016\200\002"
+	.ascii	"\231\271\253\007\021\260\261R3V\211\375\357\006S\n\264\016\277"
+	.ascii	"\247\242\326\275\3176\3202\322h\267\231\304<n\312y\217\241\017"
+	.ascii	"O6\361\312\357\234\007\"\376\375\264oYoO6\251\300\007\335\205"
+	.ascii	"MN\020\264Rs\n\355q\233\356`\241\274X\261U\360u\302\311\2425"
+	.ascii	"\324\002\b\316\364\342\267\001SL\004bSX\35159\275\310~\377\325"
+	.ascii	"z\341\033\203\244Agm\013xr^\321!\240\223R\007E\341Q\003"
+	.text
+	.section	.gnu.lto_fakeGyroReadTemperature.24.7c9f5dc33c79c64a,"e",@progbits
+	.string	"(\265/\375`2"
+	.string	"\r\b"
+	.string	"2\31777Po\322\001#n\203\240\340\313\017F\345'\r\n\306\030X\031\332\352}\364h\b\242\217J\3542\345\271\221M\f\230%\312DM\\\034c"
+	.string	"x\205\202NZ#\204\354\235RR\223\017\223^h\222\316\020hj\001\225\261\316\254\220\023\021\031\035Q`\230\214\":1>T\"Z|$(bT\024;\t\316B\223F-\313ht\335W\013;\237\273\f4`\311\256\244\007=\354W\273\273\206\235\375<\250\224L\201\313\256\251ffQ\026\213\210\355\315\006\260\r\353\210\246\341=\373%7\331~\222q\201\335\356ee\267*\230\201s\313\365\004\327-\316\007\256[\266\275\340\331\314\275\202\2306\245\220\215\224\324n\215\360\343\334\037\347\037\345\007#-01*'\322\337\306aw\3758N\0357\274m\004\333\020\266I\002\f"
+	.string	"8\303\361\212\036\025Ql&FV\301\3235ob\002\007\205\34020\222"
+	.ascii	"\025\346uM2"
+	.text
+	.section	.gnu.lto_fakeGyroDetect.25.7c9f5dc33c79c64a,"e",@progbits
+	.string	"(\265/\375`\324"
+	.string	"\035\013"
+	.string	"\266\224MA\020O&\035\300\242OC\260=\354\004\200\347L\234\215\1779\262\227\003=\013\344\273\206\223\006A\020~Yf\377\235\301gA$\b6"
+	.string	"\001"
+	.string	"\3628\264r\0033U\216F\207\351\0321\314#b\177\262S\n8"
+	.string	"7"
+	.string	"@"
+	.string	"\3435\266\323\3103\266S\333\036@\340\343\360#jtS\252\002\213\334\0359M\303\303\317\320\377\352\023\017*L\261\026\t\364\tA\260\273\236\"\222\205[\273m"
+	.string	"\266\r\330\277\004\263\264G\320\3242\330\177\354\356Z;\331W\375\023R\351@\262\340p\355\216\312\026\013\243'8\330\376\330\022\333s\332\007\361\020\237\253<\307\330=\255L\354\216\002\\\211\234:$\205]qb[^\302.Jz\245\310\316\353\220}'\201\251\245XF\2639\013LPz\211\034p6P\273\342E6\204\217\220\020\331\335\002\276\210\t\235\013\331\206S\337\263\235R\f(B\261\326\0051`\355`\036\366(\237\246S`\001k\007\343y\035\307\251_\204L\275p\f2\335\206\363*\207\243\0040\330\340\253\334\003\020\254\234d\334\333\177\270-\370\200\232\255\020\265\220\355\372\f\226b\327\007\3122\021"
+	.ascii	"_\241'3 \f\033\267\020\243\346\002 \037\270\031d\004\244\001"
+	.ascii	"2\006\005y*\221\257\31682A\3045\032\262C\304\3275\237"
+	.text
+	.section	.gnu.lto_fakeAccInit.28.7c9f5dc33c79c64a,"e",@progbits
+	.string	"(\265/\375`\332"
+	.string	"e\f"
+	.string	"\246\227UB\020\221\232\0168\261\031_\326\212\024\002\005r\344\003\245E\367\252\361=\332\215\017H1n\267\334\221\370\337H\373&4\230W\037\221~OH"
+	.string	" B\021\266\222\n!\177\245 \301"
+	.string	"\031\"\f\221%{K\231RB"
+	.string	"?"
+	.string	"E"
+	.string	"\003\244Ck6\216w\240\335\230\240\361Af\264\273\224\236\270\366\247\251\371\217\371G\344\266\277i\304\365\215\210d\354"
+	.string	"\300\255<\021\026\024\3611O\020\234J\346\346\301\356:#'\342\206\267\r\301v\003\373\021\002%R\262\306\356\266T\027\373ow\327\372\261\017\363?Mg\246\377\341\240\033\351 \220c\227\245\246\307\326\2003R\200\330~\332W\361\220v\030\317\005\354~b\314\354v\t\314`:tw\021\351pz:\241\305\215\225\244qH\372\034\351j\227\230\344cj\001\017\272\331\177\321!\304F\264\261\313d\230vw\201\213\223\216\001\320\213G:\274*h\201\021I<\365W\234\205\307\177\361\006\224|<\364Q\244\303\003!F-\241\226U\251-\222\253\244\252 \001\3138X\260\254\212\352d\327\t'\243@]\340T&\224\225u(\222\021c\030\256\214\322\200a\031\005\322\355\337\352\307/\324\361\020\245\250\312\013\220\266u\345\243U\267\203hD3\252.F\360\f\024"
+	.ascii	"_\2417\023\232\3051\262\n\206\02073\027\320\373\017\323\034\270"
+	.ascii	"-<\227\306\354\213\276\025G\255\267Q\353\031`\271X\333\254\246"
+	.ascii	"\210\273\034\263I\032\230\332\003"
+	.text
+	.section	.gnu.lto_fakeAccSet.29.7c9f5dc33c79c64a,"e",@progbits
+	.string	"(\265/\375`\f\002\305\020"
+	.string	"V\335iH\340\262(\035R\342I\305g\002\200ZJ`Px\235\265\3068p\007A\352\306\037\273\366\241g9RR\034\377\330\210\255{N\023\301\346\035\264F\"\311Q\f3\306y\002\0378lj\305\201\2231\264K\254ao\226}\366N)P"
+	.string	"Q"
+	.string	"X"
+	.string	"0;\264\335-\371\201\350u\300\374\264\377\3422\343gVN`\367\345\202\266K\226\354@\364j\362\006\266W\321\013l\257\036\355\236\223\260=\214\236\0201~v\267\243(>~\216\376e\017\300za\371\fE\330]O\326\013\211\233\336v\002\333$\366T\005\273k\372\262\267\351\321o\376\320m\376\372\232\237~\346\237\002H/W\313\004\020\352\203\\\227Z\320\366\2505T\330\276?\3433\325qL\202q\265T6'\343\345\311qL!(fw\271W\373\304\346^'g\337\f\221`\363\003\002%O3\276F\305u78v*\215\020 Jm/\370\r\025R\003\337\306u\274\017\234g\201\333\353e\2371\027\036\227LKd\216\250_\242J\346YF"
+	.string	"\202\262\370\345sR\223\207\365\322&\247\205\007`\273\313\200F\n\007?\266\262\275\216\350\313\217\264~V\260(K\254f\315&[&=a\037\300\006&1)H9\312?\374\373<\352\317\004\226x\030N\241\210\222\341\373\274.%\202\036P\342\205N\003\3123\351>1\325\231F\034n"
+	.string	"\305\256C\030\212\035G\256.\373\204\234\021@>+\3322\253\360\331G2\232\210\024>?m\266\205\3638\211D`\261ZL\220\020\315\361\035:\254\263\riQK\0171 \240\002\0319\263\003\261\270\360\031\"Bh\036aZ"
+	.string	"\252\200\224\370J;\317\013f\033`\313!pc7\027\322\232\311\326\315\220*\006\254\332\320p3\226[,\234\222\344\t\252\016\306\352h\004C\005-\306:\t\325F\t\350\320\204\035#\020b\220r\3031"
+	.ascii	"\243q\274\243\271\0063\b\362\206\031p$i\\\230\030\274\"\355L"
+	.ascii	"\201wy\321R2"
+	.text
+	.section	.gnu.lto_fakeAccRead.30.7c9f5dc33c79c64a,"e",@progbits
+	.string	"(\265/\375`\031\003\215\024"
+	.string	"\026\244\200I\300\322Q:P!\020\270v\"\217+\372g\266d\306\375|\353llm\026\351\311\356]Eo\277q0[\256\371\365\337\366\324@\322\360\\V\232\345\260\026\007nS`[\331\270>\350\362qT`v\245\t\300\201\255d\023)S\ni"
+	.string	"f"
+	.string	"n"
+	.string	"+\333\252\366w\347\341\\\350\346&s\002\375f\314\331K1\003\325\245{?\031/U\0070^\3326\202\0048\226\275\247\333\021\341\240\323\301\305\324\234=\326\222\270\354R\\\225\3719\227(\220\232\304\215\222\361\343\364\273\365|E\224\234\022nu\253\211'L?>>t\365p\243\251\212\254\3149\255\266\033\317=\336\266\004\333/\366>\b\266\373,\363\037l\200n\316\251"
+	.string	"\306L\006?\350f\274,\331\373\256GN\300\032\277\0173\035\332=\232\356\b\373\342\\ {T\227\\\350WY-\245Z\224\352\225\352\233D\360\231\372a\300i\316\235\341\220\271$\203'l\337\177q_\r.E\215]$"
+	.string	"\267;\213\023\331\274g\331\343\223\333\3159W6\366\352rm\034;*\264E\315tx\3404XTs\316\005>\322\223Zl\227\226\336\326\032/u\035\340\240r\274\340\201\017\222\350\202pO\271\035\220\231\016\365H\212I\204X\344z\321!\360hRP\265\315\271\t[ni-\033\277/-z\324T\210\355\327\215d*U\320\345\367C\327\0208\0259\236\020\211\226\254\357\203\211\321\333L\240\2669\276\3571h\364i\316\371\276\240R\300\345j\255]*\257\230V\005\027X\314\306\202\313\325b\321\304^\033`b\024X30-\031\226+F\303RA1\f\303+\306\322"
+	.string	"\203\305X\253\336\354\342\\ \217\302\022>\240\370\2417\020\202\360\001\367\300\313\325\261-\327+\263\245I\"\"qy\b\317\364\246\035z'\215#<\300\025\273:r\244\\\t\307\356\b\217Q\220\240\356\r\226"
+	.string	":O\270\215\026U> \220\002\031\301\243\007R\334\377L/JB\3573\020\3202\f\032m\311\\2\313s7\332\2203\356\260A\302\327\254\242K\305\310\227\340\3642\f\301\030\302\367CL\205\341\031!R\267\0364"
+	.ascii	"lbL\344\225}\213\266M\215\235\255\013\037\361\305C\354:K-\003"
+	.ascii	"`b\221\346+e\261\270\234E,\nk8v\302\352\2401]\033\3141+\374\211"
+	.ascii	"\266\354\300E\344C\034\360n\317\371N2\266E\b\3439\1778C\305\271"
+	.ascii	"q\322\023\212Z\001\005"
+	.text
+	.section	.gnu.lto_fakeAccDetect.31.7c9f5dc33c79c64a,"e",@progbits
+	.string	"(\265/\375`\223"
+	.string	"\355\t"
+	.string	"F\223F; \261\322\001\244\nh\003\235\017\2106\303\tM\235\307\216\202\267\353x\353\020v\242\357\2655\214;\313\376\f\030ti&\t"
+	.string	"M"
+	.string	"\002\f\021\223\003\212\345\004\350\027X\242\303fd\247\0243"
+	.string	"2"
+	.string	"9"
+	.string	"\234\027|\257\266\255\260p\262\3713\306:L\346Q\323\355\236\240'r\363\324\364\217r\203\022\334K\316\326B\235\006<\354\256\351\252\345\272\275\333F\260\355`\377 k\357e\237\366\323/\"D7\343\211\331e\355n\326\245\266\220\330\276\355\223-`\233R\373'\237\235N3\235`\3675c\331=\023\334\300y\365\371\316\367\032+\240J\2033\251\t\211F\257\221\020#\273\025\006\251\003\263\233\372\312\326\270\n\007gw\031\374\224\216\322@L\366\352\233\276\327\352\272\251r\266\217\024\335\331'\212z0\373"
+	.string	"\273\033\242\030z\026?\243(\244\220 \313\022H\024C\220T\216\033\241r\002\264\b\205#P,I\340\307c\362b,\301\f\222,A\237{\357\345\233_\305\r\304F&\345\251\354\203>{|\f"
+	.ascii	"^\321\033[\030&\033\002i\202\006R\203\213AA\236J\344\2533\216"
+	.ascii	"L\020\275\313\304\3275\237"
+	.text
+	.section	.gnu.lto_fakeGyroInit.part.0.42.7c9f5dc33c79c64a,"e",@progbits
+	.string	"(\265/\375`\251"
+	.string	"\245\n"
+	.string	"&\323E< \005)\035 \221!\220V\224\032\225\234\312\037%!D\367\354|\033\f\356\200\213\201>\266u\007\3767\006~]#H*$!\004\263(R0\347\3501\217\205kA\2219\354&{\247\0242"
+	.string	"1"
+	.string	"7"
+	.string	"\266S)\026m\236\2170+\241s\"\353\331\335\356t\276\\\374\224\232\350?v\201\025K\3659\300R\271\f]\013\240\330]o+7\275\355\007\333\026\366C\001\207\335\376+\345\307\f\262}X\352#\212S\2610\234ZJ\3733\247\021?\242^\260\333\262\271\331\035\035N\035\261\235z\374\301\347t\273\301\347\024tz\2314g62I\346t\331\336\244_\363a7\\V2\304)\310f2\241pj\213\234\344W\006_\263\222\251\222\323\345\251]\333\331\262\247\334!h\331E\t"
+	.string	"`](NLN\250a\255 G\372\302\r\216\003M\036X+\0204\177\"\220\344e\\\204\365\244\361}^W\252`\310\250bt\035#\217\243\373j\251\023-8\364"
+	.string	"kg\n\303\332\311k;[\016\030"
+	.ascii	"/\301q\206\343\025\275\212\005\321X\201q\301hEi\236\301\001\242"
+	.ascii	"`\230+\234\253\tQ\027\325\347A`\342=\255\024\325N\347\2026]t"
+	.ascii	".0N\\\314;-M?\241\214\001"
+	.text
+	.section	.gnu.lto_fakeAccInit.part.0.43.7c9f5dc33c79c64a,"e",@progbits
+	.string	"(\265/\375`\251"
+	.string	"\365\n"
+	.string	"\246\223IB \347(\035\220\b\"'`Nd\200?1\211n\252=y'`\215pW\354\023@\323\263\bj\214\206m]X\277ih\354\211 7L\220\204\205M\346\262)\234\003*Hh\260\240\220\206\262\331M\366N)4"
+	.string	"4"
+	.string	":"
+	.string	"\003l\243j\f\332\020\036\006\330\317\216\203\031X\204\335\345>%\200\203\2271\003\375\277\256\240Z\245.\027V6\217\017\317>\037\273k\355\346\236\267\275a[\304~Ds\201\200\273n\237"
+	.string	"\312\177\031d\373.\324\303\323\226\302\301\370t\214\366\013\334"
+	.string	"\370\360t\207]V\002\005\273\241\306\247;\264O\207\227\360|j\207\360|\202>\037+Y\016i\020{\2210R\266lk\321?\260bg\034F2\307'\213&\343a\361i\273\230\342Uf@\300 \026#SQ\266,\263g+Y\266\254x\320\220\263K3A\302\352\004\246\250_\255\3366\242\337\311Fi\267y\245\316\253 \023\224v\3224\344\215\272\222\221\257\232L(\3558R\365ZD\225\204K\021u(\034\255$.t\341O\305\253\\\351\373*\027\237\005\026"
+	.ascii	"^\321\263X\020\216\025\030\027\314V\224\3003<@\024\fs\205\203"
+	.ascii	"5!\352\242\372<\bL\274\247\225\242\332\351\\\320\246\313\316"
+	.ascii	"\005\200\223\027\363NK\323O(c"
+	.text
+	.section	.gnu.lto_.symbol_nodes.7c9f5dc33c79c64a,"e",@progbits
+	.string	"(\265/\375`]\001\035\b"
+	.string	"D\013Y\002"
+	.string	""
+	.string	""
+	.string	"\002\030\177\037\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\270\300\202\202\200\006\027\177 \005\023!\200\204\001"
+	.string	""
+	.string	"\003\002\036\177\"\005\032#*\177$\271\200\202\202\200 \025\177%\024&\201"
+	.string	"\002+\177'\034\177(\033)\026\177*\272\200\202\031\177+\035\177,\037\177-\005\002.\001!\177/\377\037"
+	.string	""
+	.string	"\200\200\200\002"
+	.string	""
+	.string	""
+	.string	"\001 \1770#\1771\"\1772\003\001\021D\003\001\020\340\236\212\256\001\001\244\001\003\001\020\241\341\365\321\002\001\244\007\003\003\003\003\005\022$\003\006\023d\003\006\005\320\360\372\250\001\001\242\001\003\b\t\t\b\013\021D\003\013\020\344\001\003\r\r"
+	.string	"% \020\003\t\212\272\001(\002\027r\020\003/\210\302\212\024\325\030\344\300\233\335\026\215)\203\356\340\324\256\240\353\007^)\t\006\344\227:\270\264\303\367E\330\276Q\177\215g\3100\352"
+	.string	"a\360\264`\260\306\230-}\206Y6"
+	.ascii	"\224o\035tp\234"
+	.text
+	.section	.gnu.lto_.refs.7c9f5dc33c79c64a,"e",@progbits
+	.string	"(\265/\375 a\335\001"
+	.string	"\022\306\r\020\260%\351\f\303\260R\326ZB0idK\231R\252\311\211\004R\314\316\354\346\300\234R\313\005\001\246\320\216v\272\314\207\311>\026\266\214\222\3211n\026)\221\016\371\324A"
+	.text
+	.section	.gnu.lto_.decls.7c9f5dc33c79c64a,"e",@progbits
+	.string	"(\265/\375`\367-\275\304"
+	.string	"\2121\025DV0\nI;\035i\005"
+	.ascii	"\234S\371\214\306\237\340\323\005\235_t\001>MO\256m\022p7\335"
+	.ascii	"\031\322\372f\330\365\223\026\f\353\002a/{\312M=\226>\361\372"
+	.ascii	"\036?\274\213\r\3438CbsU\001h\255\261\346f\323\373(\305\346\005"
+	.ascii	"\324\3223\254`u\310\366\2212\311\024\320\0032\0048\004Rz\314"
+	.ascii	"\357\321\026\2139\032\036\345{x_\016\272\030c\237\275EI{\313"
+	.ascii	"\221\366\226\026\3323x\257\327z\256k\227\266\243dn\272\367\336"
+	.ascii	"\361_W\372^\337\345u\355\226\026\220\204n:\223\305\0256F\250"
+	.ascii	"\363W\023\255\356M\370\255-#\323\327\004\327EE{\216\242=;\371"
+	.ascii	"\022\036\353J_\307\347\360oz\247\265\327\3618\376j\202 \247\b"
+	.ascii	"\247%W\314]\347u<\325}\233YF7\022\f\326n\342\0030\303p\212\310"
+	.ascii	"\217+5{\366q\345o\205g8\207\fF[\344\226\230`}\226~\325K\301<"
+	.ascii	"i\261\373\276\264\347,\355\231J{n\322\236\241o\003-\312\007\330"
+	.ascii	"g\317C\017\205\013\365\335\267\202Z#\250o4\212\253h\307PnT%o"
+	.ascii	"\373%~N\200L\364\013\3677\272g\237\3641n\203B1>?\322?\257\324"
+	.ascii	"\341\036\352\322\214n\263k%\267\264\242\323+\206\016\247:V\323"
+	.ascii	"1_\344\376C\357|\241\013\265ws\357-\3010\311\b\031\221\317\277"
+	.ascii	"u\374[\370\215\372\\\212\3564\354\026'4\350Cs\270\025T\365\336"
+	.ascii	"\250\037\364\315+\275\360,\374\367/\275\205\031\335\321\2757"
+	.ascii	"\315\235R\025\004\365\322!\330\373^Poa\341\275\240:\276\3225"
+	.ascii	"\267\202\372{z+\250\203\026^\204\260\271Eeh\277\322+x\251X\020"
+	.ascii	"\274U"
+	.string	"n \b\241\247K\013\275\022,d\310uC\322\274\234/\240\272\265gUH\244\375J\357\025+YmF\225\224W\351\213\331{\202\026\274.\035B>;^j\377>\355_\247\375,\320\274hBs~\366O\323\236\201\336\335\303dO-\004G\325t\357\250\337\351\225^)\327\211\347\350\336:W\312}r\243`\262\347n\342x\221ajI\022\034\340\336\321\f\0262\310\b\001\024\214\241f\276\013\205\246\bk(\007!\337\237\366\253\244\311=\341\223\202\\\021\021i\"\325~\301\364}\336\033\325\356\336\335<+X\210\254\354\236n]\224\r\t\036T\337$w\356J\217\\9\317eP\333l\357\250\ff\306\250k\373\354\027G\245\2718\252_\026:\337\033\025\303\007\264\247\320\236f\324\356\346&C\310\203P\360\263\023\265S@\373\221[A\275iW\355J)\270kxYF\223c\324\335\320\361\331Eh\277B\274\004sk\340"
+	.string	"\320~)Po\341\245@u\255\335\356VP-\334\n*\2767\352\205\2727\252\357\335\n\352\r\273b\367\007v\272\200\332i{Gm\206aqRi\237\357\217\277>n\324\357\217;\346\0354\360\230\346\026\333;z\177\344\275\231\367Z0s\257\005-pXL j\216\336\n\252\2767j\316\352\376\030"
+	.string	"\201\213{\346s\277!\370\200\373\265\363\200\373}2\343\236\207\334\357^\005L\362\372FP"
+	.string	"\223\n\362\372Hp\377\021\244\004\271\377\006e\236\024\f\270\337\036\277#\351~\267\220\356\227k\003\033\367\254\264\311\356y"
+	.string	"\356\267\313-x\004\356\371"
+	.string	"\327\353Gt\340\201\334\377\3507\356\271\003\356O"
+	.ascii	"\037"
+	.string	"\367\357A\341~\261\334\257\224\213\340\376\034\360\032\367,\302\375\215\356\237\001\367\267\200\373\223p\377\017\334?\204\373w\340\376\033\270?\b\367\327q\177\r\356\237\343\3768\356\177\201\373\027\300\375+p\177\n\334_\002\367\257\340\3766\356W\316\375\322\271\273\004\334\357\t\367\233\302\375\266\356\267\317\375\276\270\273\017\367\033u\277-\356\257\335?\273\337A\367\213\305\375\n\272_\r\270\337+\356\327\212\373\255\342\356\021p\277T\334\357\237\373\235\342~\375\334\357\324\375Jq\277@\334o\231\373%s\367\250\273g\340\356s\356\036SXXX\350\216\305\334\207\\\356\003X\021]Dk\330\210c\270\030,tJ`\340\"3M|\264\025)Bd\306\boG\021\301o.V\366\262\204\035\321x\bf\273R\fp\333\347\310\242\006\244M\373\305@\305\205\205\027\003\325_\322\264\277\220iw{\001\323\376\222C\343\2748i\020\330\314\213\232\216"
+	.ascii	"\002\271\360\365\366D\205\3130\231\336\363i\3603\216\262Q\201"
+	.ascii	"\275\300\320~\215\300\221\035\375\213\231ft/u\310\262\304\300"
+	.ascii	"\330\332\356\344d\274\322\226j\241\3651~\311\333X\220!`\013Z"
+	.ascii	"\206\2570\016\\\265\241\036v,\271x\230\354\251\245A3\246\177"
+	.ascii	"7\213\024\206-?\261\270\373\343\002\256\255:%\277GHX\210\257"
+	.ascii	"\236\350\213p\324\355\003)\243\251\224\351W\26128%t\277\205W"
+	.ascii	"\317|!\034u\323CRGuN\276oF\312\031\332\035\342\347\002_=\214"
+	.ascii	"W\272vi{C\021\260\265\225%\006H\004_\335\"{\351\347\201\353-"
+	.ascii	"K\354\352\001\361\324\004A\316\234\004\313\214g{:%\205\370\352"
+	.ascii	"\"\271J\362h\\]&w\n&{\272\034\001Y\352\201\267\360\030\316\302"
+	.ascii	"?\360\027.\001\363\30090\030\346\302;\260\017\254\205\305p\030"
+	.ascii	"\266\302X\330\013\233\200\273\260\216+\305W\177\347\370\006\246"
+	.ascii	"\372\031\216\257\236\351\207\354\244\013\266\226YbZK\204\024"
+	.ascii	"m\310\270\312\375\232\335 \367\r\2315\343\354\004\r\263\265\356"
+	.ascii	"\215\212\245.\320L\341`\352}v\0279\375\201x\343\250\226\007A"
+	.ascii	"G\323'\034\205\241\256\024\333hb"
+	.string	"\033x\211\225@\b='\020d4\265\201\235\234n\202 \347f\332\340\260\025\230c\t0\237U!y\322\331]\230\264\277\323\350\302\265\253\342\300\004\251\\\022\217)V\302L\354b\202 '\004\216\254M\221\034n\306e\357\2504-1h\217\263'\316\265K\333q\023\303J\370\205\303\3154kvS\007\330\324\261\022>\2720\303\214\356\247je\205\303\004\300\275w\r\334\204c`\032x\t\317\300LX\306\225b%\f#\203\205\226\263 \200\202\024\262k9\355\332M\273N\323\256\243\332\365\227v\255\245]Wi\327NEkK)xH\237]\033a'&\272R\334\0027\203\260\320T\024-\334\002\017a!\nQ\366\b\3430\033\037\225 k\332\035\013a\0260\204cM\204\230\005n\316\370\310r1\365\331\207]\332\207X\332\207T\332\207O\332\361v\177+\177\345\0137\320\242F47\364\371\263<\241\177\341\017\356/\364"
+	.string	"\2657\363\013i\006\367f\322\334k\301\275\026\344\036RYB\324\354C\032\372\261\350\370\013\262\250r\221\364\031\203\341\013\355\303#\3758\367F\375{*S\220;\372l"
+	.ascii	"\376\337O\301WS'Z\357\347?e\311'=\301Oc\2707*\224\217\302\347"
+	.ascii	"\262CI\r\312\034\024>\227&blV\236\370\363\341*NTXy\367\307\222"
+	.ascii	"R\233\221?A\257K\360\317\255\207n\362z\315\3002%L\374\365\356"
+	.ascii	"\217\033\326\227w\345\363\333}\236\326BZ\262\310\303\24392GH"
+	.ascii	"\3433\336\337\251=\244\004=\265\264W\371%.~zK\252\226\b\335\330"
+	.ascii	"b\013\373\354j\224\346poT\"\030\255\311\343s\222+\375\271o\263"
+	.ascii	"0\367n\217\344\332-Ew\322\f\232\333\024'\300\230M\024\370\226"
+	.ascii	"\221\034\271GGS\347\347\227s\241\203\241\204\344\017\356J?\016"
+	.ascii	"\307\006W\322g\257\362F\036\207\236\024,o\304\277\310s\243\315"
+	.ascii	"\370Ld\330\007\305+"
+	.string	"\273\323o\337f\203\311\004\252D{\313\232\366\026\264\265\347\033\223q\026\246\325^\310\225\276\364\245\374i|\r\267\020\225\376\323G\371P\223\376\324\243]\273\245\232\335\354{2\315\220\341\236\305\021NQ3\330\233!\321:\373 \237v\245\217\266\366h\177\343u\314,m\366\246r\242\205\366Y\357u\355\322@\360\252\313p!C\006\030\0277\232\226:\227=\220+}\263'\023\373(\2255\263\347\361a\023\0049A0rd\252\213\\\031\261R\263\267dE\375\177\310\020\265q\2350\366>^\224\226\354\214\004\027d\232\370\005\341\023\202$\305\302\355\263\317\324\320>#\024\344Js\220\214\306A\332fBq\344\226Rh"
+	.ascii	"\332`\331}}\306\311g.M\376\232\322\350\264\313\254\001\001\222"
+	.ascii	"\233\340\310f\\\314\260\"\345CL,\223Y\030\273\273U7"
+	.string	"\230\212\242\236\311\324\242\246)n\237\363\217\\CF\n\222R\335\347\354c\214\253G\217\254\024\301\327Rf\307\240 \336\224\346\342\312`z\337![K8-mZUO_\236\301\326\230I\276>g\257\214\004\203\244\327$\353s\336\361B\330L\251\256\351s\356z!\262%3\302^H\213J\t\313\245\255-<\255\021z\272\b\345%\321Q@h\221\321U\326q\225\263\262rx\216\214u\367s\3570\262\022<c\345\245\216\"q2K\3551}U\322\\\205\313t\220\023\004\260\266\351~\0369\200L\224\032T\f\317F\276a#S\251{\337(\024\3223SEE\345)\275\334{\230\003*\345y\352e\311\350l\fN{\f\331\323\323\027\341\354\235\204!\f\272c\306\214\334\364\266\305\344\271\351\213^l*\271F\231\021!\225\\#\323\270{\323\300\252>(szaV\332=\313\270\322,\343\213>\272\227/Dw\317}"
+	.ascii	"\217iz\361\"+\375a\330Z>axV\252`-\206\222\214\364\"J#\346\251"
+	.ascii	"=\267\310E\236]xv\221\241\227\303\016\350\017\032\200{\t\006"
+	.ascii	"\216{~z\206\262\005a2\3649\033e\244\034\030\245k.#\345#\234\026"
+	.ascii	"}s\342(\276\353\252!\367y\210v\177wu3\237{\357\244\226\350~\006"
+	.ascii	"\305\250\356\327o\313\2758\3562\027_\001\270\347x\2607\363\312"
+	.ascii	"\224\212\346jc\326x\f\333[\354\366nF-9\210\2026\243"
+	.string	"d8\315\242\366\262\251ci\363\334QK\247\331\3366\273\331\\\356@m\033\247\331\206n\026x\320\273\243Q\313\335\204\3326\273\271\231\030\234\315(\250\323\214\t\265q\232EA\267Y\324\256\331M\346\223\250\271\2376\333,\312o\233AAk\234fPP\247Y\224\216KG\024\226$\311\312\364F\224\273t6\367\221\021\023\363Yc\347\214B\355\275\275o\232\320~\n`o&\250\347\036S\306u\013\262;\nZcB\335\250Q\220\024\324n\3329\273\240\366\356\n\352\331F\036\226Q\273mu\355\226SL\333\205\320\336\0010\332{y\267\335\336{\271\367\036>\231\242{\323\250qj\031\031\355\275d\301h3-\337\204\366\376\264'nP\247\231\024\224\316\333\231\231\326\036\212.\257\326\336\213zj\263%\331v\361\247\265\240/\246|\366L\344\216\003\263\023\013\226\030\242\346\374|\301n\0055\013\351x\036\222\251*\301\253\3553"
+	.ascii	"2\013\317\315!qS7>\347\240\250\331\355k\022\204\203\241\261\223"
+	.ascii	"t\232\231y_i^z^~ .\204\252DV1B\234\206\206\324\354\270\320\314"
+	.ascii	"\205\255\352j\372\371\232\3518&\\@\216\251\0368\013\026\f\203"
+	.ascii	"AU\302g\307\203\2029K\026)\\T\314\345Mp\207\322g\034\250\343"
+	.ascii	"\030\213\206\362\372\222\372,\301\275\001\374\302\006x\325\340"
+	.ascii	"\273\022\367n|xeV\360\3340\313H\034\\\225&3xPz\024\241\002%\017"
+	.ascii	"\246\345\001\371\373\277\026&\244;\243)\323\314\365$\324\345"
+	.ascii	"\347e&`\261\001\376\324\261\0244\247\255\247\317}1;\356\236\256"
+	.ascii	"|v\230\"\355WlO\n\347\213,K\f\360\235g_\210\303c\212\353\262"
+	.ascii	"\352\366@\b=\035 \305c\372\313=,\375\242kW\365\265\225%\226\207"
+	.ascii	"\241\340\023\260\036n\202\243`'\030\017?\301w\230\017"
+	.string	"3\271R\274\207\337\374]`%h8m\017\253]<f\022\207\257\267\275\013\276\356\366<\354\300Ap`;\346\322\003\017(\026\262\207\327\260\033\220\036\323\272\275w\202\217\200\020\002\303\322A\033^\001\310\216\355\2426I\236O\237;\3508^\242\202\031\261\021\370y8\207\351\222h,=&#V\360\034N\362yi{\017#q\234D}\262\214\303\202\345\340\006c\274e\335\3418\f\367C\002(\212?\0208V \206\370r\254\200\nv\007E\361\007\002*\330\035\023D\326'\257Gc\353cT\226X\327\231d\253\004\312\024\274g\203\004>>\312\343\361\3478\034\341\007\331\323\376\034\207G\345\n\001\021D\220\310i\331\023Hb\213\241];d\020\202E\376\204H\301\266I\022H\320\310\264,\211\231\226%\321\301\013\f\005\025\354\016\207\r-\222\b\264\341&\304N\00701\236A\004\t\274hD\262G\366\204v\017\0374|"
+	.string	"\261b\350 6\340\260\001\007\325Al\240\243\263\301\007\035\355\037tp\273\"\333\226x\323\026\213\035D\240?\320Q\325b\221\250\213Eb\f\313\363\023\"\246\365\236\r\004@\262>>F\023jK\263\016\275gC[T\"\333d\207\344\272\202m\225)l\216\312\237\342\272\016\221\354q\204\237u\035&\221lRy\\W\315s4\242XW5y4\002%\327ux\3741&\215>\354\272\272\264k\215\006\036\026I\354Ij\310I\266\306\0229\312\343\t\r+\224G\243\217\006\017\037\326\017 V\344\260<J\237\342\321\230\203L*s\022\320\256`\217>\304#\222m\217\306\265\247\005ZW\tT\260H\240uU\333\244\321g]\325uU\221\304\236bf=`L\256\253\212\242\370\343\223E\264\306\243\261\302\321\003\036\"\213T\221m\b\305\243\322\003bK\334\341!\262\037\\H\256*\330\235\243\0072\336\263!"
+	.string	"H\326\207\347H\004\341\246=\232\370\344ZdG\240(\022K\370\370\020C\330\030\333\025ln\223\253\021\210\204\tvg\025\021\002\t\030\266x$\266\311\243Q\267\353\004D\344\2431\204c\262\250\032\201\2228\271\206\350 \002&D\007\021.j\261\203\021{\317\206\244\262\304\205\344\032\001\236\032$\333&\211)\324d\222E\362\360\020\207\254\n\242\217V\256*X\236\244\262\204N\256l\321\250\202\335I*K\300\260+\013D\202\bIe\t\027\026\210\2046\251,1L*K`\326\207XL\266\374 \331\013\350a\273v\310 \251\3741\252`\221!P\030\2018\"\304\316K\273~\320i\217\306!\213T\266D$\013\224\202maZd\033\302\210\243\007-\233d\221\303\344J\201\210T\2360\2328\376\204P\002\245\250i\275g\203\022(\205\377"
+	.string	"\261\310\234\366\347\007\231\003\303\256#8h\300\341\203\022(\305\215\322\347'\311\"_\222k\004,\t%P\n\030\265\365Q&\331\021\307\037c[d[\226\002\273\022W\344O\362\310&g\216'\214>\035\270\260\253\214\007@x"
+	.string	"\333\022G\300\220\300CdG\020[\"\217\0132ib\3559a\354YeL"
+	.ascii	"\371\340v\005\321\036\215\312a\022\350\007\271\203dy\214*\214"
+	.ascii	";J\240\0244\355z\202(\302\217q\350\tH@\b\f\025\220\300\007\272"
+	.ascii	"\270\201EA4\261\376 I"
+	.string	"8Q,\022s\222HV\205\021\311\223s4\022S\344\024\221\311\234\r\0068A\024\301\330\256h@{\024\241\004J!\343\363\363\303\200\265%\013\235L\224)\216\310`\223\246\222EhC\020+\246\017\006Ya``\306\252\303\241\257\\\311XkZLV\262\252@[\356\256\346\344\250d%\030d^~\371/O\265X-m\355<%\027q\321\302\354k:\315S.5;(\257P\353H\367\365\345\251\373\234\302a\354.K\f\220\206\031%Se(\331\211\022\024#J2\337\024\225\340X\320g%\236\357\224d'\026\364\026\343\321\244E\223\204j\255\260\211g'\236\367\256\334\362H\310\tY/\263\3210!\031\254\301$\314I+Jf\222\363\230wc<\360rPt\370\243\251h\343\345%\236\355\222\206\262\334\262\350'G\334\221d\272\\\264w\020\207h\320\336\336K8"
+	.string	" \002X\226\3043\235\3479\016\b\313z\274Z]\2251\234\205\346K\260\250\311\234\366\23188\317qp\271\310-\333HC\031V\177^`4XsN\232\200hW\363,U\313E\0347\267\023\323p\213\307\237\027\340v.\341|\225\260\026gm\236\213x&\322A\003\207\243ABVT\303-\277\271\273\274p\3350\373\222\322\256A\227\305\200B3\3333\020\n%\263\345!N7\216\260T\013\020+~y\237\327<\203\321\250\202\311@J\002\225BhHDd$)H:\302\n\020\206\202a\230\327\364\016\022\240\024A\r2\347P\215\210\210HIRPP(\264\033"
+	.string	"\375\337\341\330\350\274;\300=\025\370\031\n\001\223V^\342"
+	.string	"\251\252\376]Q,B\275u/\301\365Kg\354\201)H\035\206(\237\361\322\304?\211C\372\340\2652,\3107\t\214\236\002L7\355\235re\352Z2\244\271\251\377I\337C#\227\214\264'\013\230\324\206.\351\230S\017w]9(\031r^\226\206\300F-\017"
+	.string	",\001\321Y\377L\341\356\240\302w\004wv\020\017l\220-\330!\233"
+	.string	"\303\200\001\005R6\225\255\363se\233A\201zq\005\254i\"\215\347g_z\374\265W\337\003\231\3526\377#\231\216\351X\226\233\253=}\246"
+	.ascii	"\266\f\241E\205\341\205V\264\224\031C\311\005\213\203\f&\204"
+	.ascii	"ZV`\242R\022\226\275\227\"\303\273\341\032\023\225S\354p\364"
+	.ascii	"\2012[\025P\366;\020Y\250\277fK\244\315M\323|H.\233E\333\225"
+	.ascii	"\270!1<\275\241\370\321\023yb\031\035M$\302]<\315\224Y\215\324"
+	.ascii	"\376=\277\240uR\352\342\300$m\372N^\331X\2253\240\233\335\213"
+	.ascii	"\374\245l1\272\210C\017\037\207\373\324o\371\\n\345\303>\025"
+	.ascii	"\257\337:\274\2758\236\225\013V\332\262\370\243I\"\316\204\330"
+	.ascii	"\306f:\362\373q\311!A\b\220\365,e\247\220A\333P*\205\245(#!\315"
+	.ascii	"\"<\224\301\024\327\364\t9@K>\370\326\277\323\367^\\#c\346\327"
+	.ascii	"uF\036\035\037R\006\324\277fs\222z\225P\002|\215m\345d\252\243"
+	.ascii	"T\243O\234\001M\224\214I\354\345E\233\354\267\305\237\312\366"
+	.ascii	"o\347\255v\266\356\203x;\313\217\273\203\002\273G\206\n\354-"
+	.ascii	"?55`\264n\"V\277\303\371\002+\001B\234\207\215\345\255{?[\035"
+	.ascii	"(\205\202\3538\313\023\003\201\2332\023\252\333\213\225B\025"
+	.ascii	"Q\331]?\315\211\333\210R\361\372,\257/\t\245FUr\177YF\377\376"
+	.ascii	"HD\205\272\350\022\245P\023\351\346!\363\315\021\231=C\021\251"
+	.ascii	"P\202i\345\036\235\310\020\025I1\016\2427:\257N\302\337\341}"
+	.ascii	"+i^\215\004P\035h\247\256w8\bw5\250k`\215\207\331@\272\356\201"
+	.ascii	"uC\233\217Qw\232I\321\373\367\314d\373r\237\315\025\310o\t\274"
+	.ascii	",i\255\275?\303\231;/\203C\317\242$\nF\374\342D\021(\3049\234"
+	.ascii	"D*\2748\217\326f\231Vf:\205\035Zg\311<\017\032\224\016\255Y\374"
+	.ascii	"}\247\275\253\223k\262y\3478ZO\221\246\022\356R\3476\226\t\332"
+	.ascii	"\230\330A\344\r\243\254\2610\3739o\004\340w\342?\247\2645\263"
+	.ascii	"lOx\200\222C\254\fY\216\347@-\251G\002\221m\346\365I\375\316"
+	.ascii	"\203F'\020[\020%\265\345l \306\247C\301\214-a\004h>\244\252'"
+	.ascii	"\2144/J\367f\364\312\230\346\247\233+\354h\223s\376,\032$"
+	.string	"\244\017\302*\330[\242a\244\035\323pi\317\244\306\317/\267Qnx\235\b[Z\254\024\200\215\034\026\351@\346\266Lj\365\025vf\003\215\037T$%\232|U\330'\311:\r\353\n\227=\226\231\\\r\375\276\032_P\371\013\217\001\032LH\246\337\2210D\227\354\223\300\f\340\366\204Ne\300=\002l\366\nB\004\250 \321\220q\3504\007\307X'g\025\236}\236\220\311k\205\224w\275\300\220\003[\023\316\344FL\2239\363\033<Z\322\232\317\311\0370\027\216\360\374\206\332\335\033\200\365\355kD\033\261+$\253,*\017\244\031\212f\343\316\341\342i\217\253d&\251\244\220\354\335T\177\255R9D\207\240#\037\027\327\300\275\262l\374\256s\203@7\017\336\331&\374\305\332?\005En\030\334_u\240Et\255\3102\322\271gn%5{\351\357\332\316\343\340\244\352\226O\\;]\275\355\303\235\310\\<N_\037\306"
+	.string	"(\013\030H\2103\200\3726d\271\f\362\331\177\356\222\200\3331\351\267\204\326\241\234J\371\334\352\205N\240/\356RVa\364\221\306\264\201D\013\036pP\b\3130\362\335e+ \223\352e3R2\326\030\215\223@\1771\363\023\260\271\036L\246\n>$r\333u\025F[Qx|\270\271~\004P\207\364\226I\236\203Z\006\361\033\202\360\003<k\0344L\213\346\225\313X"
+	.string	"\332\n4\001\343"
+	.string	"\"y\221X\330\236\245j/\2301\264\236ca\351u"
+	.string	"\213\211\3245\262z\275\023\342\020A\rm\007\316\363\332\333H\201\324\343\331\024\033]F\310\247N\240\255b{\035q\200\030o\256\032:\351\233\352}\311\346-\355\245\2100\266\277\002\274%\035K\216\323'\214\3221e\224\374\231\202!2\313\223\006K\362\370@\306\262{\032i\242\033E\204\302L\351\230ta\355\202\rF\213\257\f\004"
+	.ascii	"\311\345'WwA|\324\277\366\224\245\223\212w\371u\035\037\007\270"
+	.ascii	"\372\f\210)\330\305\235}v\3315#\320\341}\340\300+D\304\016\253"
+	.ascii	"!L[\377\276\271*\0238\347\261\004\213\324\234z\0334\263@\316"
+	.ascii	"\017xq["
+	.string	"\036\354D.\177\203\326\325O?\334\3130,3\257\221\307\306\364\314+\202\202\016\025\361\220\313\317\355},g\303\016\337#B\024n\362\347\202\250IH,\325\351r\272\264\226\364\370\214\320\267\013\007\350I\333#l\267\2645 \\\340\250\367\247%\2608_\222b\361\350\327\2503\204\022$\006\230Y\225;\005/\203\277I\033;\265\362 \230\214g\212\372(\362$h\257\320\n\346\026\244Fl\0253ENr\220\223\356\276\3662\256\257[\3622\332\251o0\004\260\002\t$A\245\311\017\034\361\301X\276\230z}\364\304\214\214c\\[\355\304\364\343\005%k*\351M\274\326\372Z\002\254\235\241N\200^\t?\303\327\332\277uL\374\00118k\034a+\277\222\215d\244\037\273\363\320\222\255\243n\345?\007\033\bXR9\303;\253U\016\320|\340\314\322\320I\324N\246n\244\257\325\037\265\275\215X\270\3557\252\027\020jq\017"
+	.ascii	"\214\n\356\037k\315JC\034\303k\031"
+	.string	"\376\345\302\234\261;ul\276\231\311\207\021O\006\242\b\t\202\355\314\360\273=\\\321\023S\3064\022j\034m@\276\377u\355\025\253\270\376\250\323\003\207\261\311x\205L\201\311\261E\305\rRC\312\266"
+	.ascii	"6\220\001-\036C*\2719\336nD\tX\024f!\366&\342\346E\005d\252\037"
+	.ascii	"\312\031\361\207 5\032^M\bH\021\320o\210\222R\352\021\361{\031"
+	.ascii	"\266\\\246\342\310\3455L\374\"\323\312\306\013\274\367Z]\324"
+	.ascii	"\031M\020O\0236\203\306\237:\257z\365\345\276\326\307\242<c\356"
+	.ascii	"\344\351\225j\376\362\232\367\037-\316\204~lxY\202\237l~q\227"
+	.ascii	"\274[gN\237\306\2230\032X\306V\315S\265%\217\f\374\367*\003\256"
+	.ascii	"h\371\255\316\343z[\202,g$\2705\237k\374D\235@\330\026\3651\341"
+	.ascii	"\255h\243\377[\260\323N\217\355MQ\327\342\036\317\267\020\337"
+	.ascii	"X\330\347\221\021o\342\213s\177\267\034,\220z\r\236\233\215\347"
+	.ascii	"\036\235n\326\325\352\001\357\3578Eu\244\315b\b\036Vm@\352\025"
+	.ascii	"cY\246\373\340?o\027\213ohse\022\244\251\357\025\241p\017\223"
+	.ascii	"I+"
+	.text
+	.section	.gnu.lto_.symtab.7c9f5dc33c79c64a,"e",@progbits
+	.string	"fakeGyroDev"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\002"
+	.string	""
+	.string	"fakeAccDev"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\002"
+	.string	""
+	.string	"fakeGyroSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\002"
+	.string	""
+	.string	"fakeGyroDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\002"
+	.string	""
+	.string	"fakeAccSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\002"
+	.string	""
+	.string	"fakeAccDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\002"
+	.string	""
+	.string	"pthread_mutex_unlock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\002"
+	.string	""
+	.string	"pthread_mutex_lock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\002"
+	.string	""
+	.string	"pthread_mutex_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.7c9f5dc33c79c64a,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
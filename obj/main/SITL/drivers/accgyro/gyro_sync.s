@@ -0,0 +1,347 @@
+	.file	"gyro_sync.c"
+	.section	.gnu.lto_.profile.e12d67722142af3b,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.e12d67722142af3b,"e",@progbits
+	.string	"(\265/\375 N\265\001"
+	.string	"t\002B"
+	.string	"\003"
+	.string	"\275\377\247\231\007\004\002"
+	.string	"\002\001\001\377\270\205\350\t\022\002\002\002\001\002\003\002\001\004\002\001\002\240\342\234\212\n"
+	.string	"\005"
+	.string	"39"
+	.ascii	"\002V\256\356,\335@\033"
+	.text
+	.section	.gnu.lto_.ipa_sra.e12d67722142af3b,"e",@progbits
+	.string	"(\265/\375 (\265"
+	.string	""
+	.string	"P\034"
+	.string	"\002"
+	.string	"\001\003\001\004\003"
+	.string	"\004"
+	.ascii	"\270\fl\326x\tc\003X"
+	.text
+	.section	.gnu.lto_.inline.e12d67722142af3b,"e",@progbits
+	.string	"(\265/\375`\336"
+	.string	"}\b"
+	.string	"B\217..pK\222\016\374\252\312\004\023\017p&\002\263\310\376\001\241#Z_\n^\314\327\2576M\035\252\302\373\377p\3132(\253Z#\2154B\344N\001?\016\346\333\275w\335\203|\035d\240\223\210\211\004\356X\356 \200\353\334\223Cl\347:\327y\212\321\301\001\201\277\373\356#\250\206\203\305\005\316r\003\226\367YUUUx\363\250\231\226\217\372\220\271\300\004\374Jq\355\272\024\261\002)\260Uz0\324j\020\241\265J\226\254\307\tT*-\346u\320\206L\006\201\221]vY\301\204\273#\2452S\271\356Bxo\244\231\231\355\0252s\372\246\024\277\241\326\230\320\224Jw\214\272\221\231\313w\314\b$ `\00218\347\001 \023\2668\354\"(\017\340,\310&\304\006Z\326H\023n\375\026\224S\301\213\260\177\371\242\305th,\271D\245\206\025"
+	.ascii	"\007\001\320NX2\260R\207\341r\327\222\277\314\026\344\025\027"
+	.ascii	"\361Y\266\027\213\201\252 \216\300:\021kY\273n"
+	.text
+	.section	.gnu.lto_.jmpfuncs.e12d67722142af3b,"e",@progbits
+	.string	"(\265/\375 )-\001"
+	.string	"\370\035"
+	.string	"\002"
+	.string	"\001\001\003\177\002\001\001\004\001\001\001\001\377\001\177\002\001\177\002\007\177\002\007\177\002\005"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.e12d67722142af3b,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\232\004\001\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.e12d67722142af3b,"e",@progbits
+	.string	"(\265/\375 pU\002"
+	.string	"d\003d"
+	.string	"\002"
+	.string	"\001\370\005"
+	.string	""
+	.string	""
+	.string	"\001\002\t"
+	.string	"\001\002\005"
+	.string	"\001"
+	.string	"\001"
+	.string	"\300\n\b\b"
+	.string	"\001\004P\374\007"
+	.string	"\374\007\b\t  \002\002\n\240\n  "
+	.string	"\330\n\b\b"
+	.string	""
+	.string	""
+	.string	"\007"
+	.string	"L\020\rn\2006"
+	.ascii	"\337\250\212\003M?6\320\006"
+	.text
+	.section	.gnu.lto_.lto.e12d67722142af3b,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_gyroSyncCheckUpdate.8.e12d67722142af3b,"e",@progbits
+	.string	"(\265/\375`\347"
+	.string	"U\f"
+	.string	"\326WUB q\223\016L\006\\\204\277<Z"
+	.string	"9\262\310\336\340\252\345\020\214#\207\322S\3229\244m\t\361\243O\320\216\240\323vj\240bD\233\"\213\004"
+	.string	"c\361Dc\351\274\003\324.\272%eJ\032\331[\356\224\002A"
+	.string	"B"
+	.string	"B"
+	.string	"\207\323\007H\207\266\255`A\307W\001\r\352\362!\033\321\330\235Q=\374\372Sw\371*Zq\242a\177"
+	.string	"4\016W\016\315\344\031\330\335\207\356P\264\022\3470\020v\327\356DK\271\341mG\260\375\300\276\204\007\375\360\363vv>&"
+	.string	"&\203\005\bu1w\303\313\215m\201*F|\376v\307\0179\343\317\353m\207\325\026)-\033\202C;\230\234\263\277}\245s\320\310\005\354zN\244\330\235\t\3541\035z\236\200\0241H\264\344\351gt\026\216\027\032\332T\266\031nw1\325\217\177IW\n\"\027\023g\303v\206\233\270\246\335\365\360E\034k\nq\350\217H\207\327\303(\241\262\002\"q/\366\304\234~\354\277\335]\253\307\016\034\215\324JZ \317T\007%bm&\304JZ \024\365\0217R\203!DV\210\"!\037\026\"%7\261\343\200\253\013\032\0319U%c\306\266\347\376\255z\314 cq\037\275\201\210\f\205\376\227\344\024E1\031\211\032\001\023"
+	.ascii	"\201\n\350a\321\356\026\016\300\354\330\312\020,#\302\264!2\\"
+	.ascii	"\002E\361\313\310\215\305\346\232=\263\260\235\310\264\004\253"
+	.ascii	"\344\251f`J\034\352\336\326\026="
+	.text
+	.section	.gnu.lto_gyroSetSampleRate.9.e12d67722142af3b,"e",@progbits
+	.string	"(\265/\375`\r\006-\""
+	.string	"6<\324G\220\232Nc\200\222{\232b\314\005\200(\313\002\367OJ\206Y\216\262\221\373\326\201\226\020\fM\037f\262r\301Zc9\020m\315N\261\002&\002\035\275'!Cp\372jS\355\255\001\350x(d\004\355M\366\336{K\231R\302"
+	.string	"\257"
+	.string	"\310"
+	.ascii	"/\026`Q\266U\346\323%\274\315e\242\362\304CV\333A\004\244\013"
+	.ascii	"\021\332\336;\245\205B\255\366\271\036\004\351E\022\017p\257"
+	.ascii	"\2251\354\336b\003K@_\272\210\332\366\201|\013\311Id\021\213"
+	.ascii	"\b\201\313\211\210\230{\213;\235\343\230/\311\337\230/\255\214"
+	.ascii	"'\235\346\226\332\320\323,I[\223\374\tR\307'\242\322i\222n?\310"
+	.ascii	"tII\234)0\262<G\324\nR\301\324\223\0246p\026\305\242\332\202"
+	.ascii	"\320\037\034\347\331C\2129\351b\016S\242\223\211Cc\254\206\r"
+	.ascii	"TEI\331\362\354\251B\341\342$\216X\342Fl\252\366,J\005\251s\357"
+	.ascii	"=\330+\024\221\251\326\263\347\336\353\372DDq\343n{\211m%\273"
+	.ascii	"\234\021\367J\360\3036\004\351\320l\274\364I\230/yb\364P[\252"
+	.ascii	"\307{\357%\355\225\217\3449\373\263\033\267G\246\265\034\206"
+	.ascii	"`i\252k\256\266\2169\2458\253\265G.4i\354\255U\262"
+	.string	"\304I\214\251\036\355\242R\265W\366\355\361x<\332Z\331\367\272s\336\365\353^\344\317\275\370\327\\\310O\363\257\373\366\256;\265U\333l\325(Y}\242\325\346Y]\236\325dYm\313\352ZV\177\300\203\341\315\361\336\023\3072\327\254\024\273q\257\377\353\325F\362\215\034\314\267/\033\311\353u\255\035^i\367\336\020\367*B\225\242P0&\023i\367\026\027\2744\007\264\310Q\303(7\213Z\233\3750\207E\355\207i\251=\255)%\025\306\351\214im\r\377\"\004`\241<y9^h\246\326\264\027\223\3422\234b\"i\334\205\3137\346Xkia\267k\371\351x\266\304\250\241X7\352\336\233\340if^R\342\204Vj\257\234>\204YZ\017C\2564\325\265+<\006h\245\315\300c\f\327R=\332l\025\035d?J\202\222gYe?\362avV)?\001\026l\210\271\223\353(U3\n\306h\220\231O|("
+	.ascii	"\312\264\356e\3427I\3173_>\371\026\364^\245O\331\366\026\233"
+	.ascii	"\260\213\246u\251n\002\nTM\365\214\355\237\217\361v\320\334\273"
+	.ascii	"\022\337K\002\244\325 c\fWY\376g\332@O\362Co\035\200"
+	.string	"\277\240\017\203\017\004\221\020\317\307\306'\3643\"\002\002/\030\371\200\202<#\334\210\017A\016\036\374\370\212\216~pA\240\021o\350'\004\034\362U\350\r\t}n<\020\201\260\244{;\275!a\321\317\016\030\024\002\365z\274]Q\320'\342\027\354\260\033\372\361\204v\275`\321n\007\201\201D\276\340\316\b\b\f\356n\266]\274'o\255\\c\314Jm<\225*5\252\233\225\323\306Gi\341#w$\013\305\331\310H\033_&\2551n\271\331\3705]\016,\313\264\361-\234k\272w\351\300\315B\035\354\271\364`\356Sg\215\352\254IRg\017v\233\032\216\251\333/4M\232:\233Z(\3339\0267|a\266d\231l\2639\266V\t}\250qD\204\2302\304\220\210\210h\222\244\320\001\260\002\031\262Z\035\021\020Q\344\030\2214\245\302\001\206\223\334\322$,\b\017\200P\025\007't\356\027t\021\022.\035RaW\302"
+	.ascii	" \345\245\332\274\246)\334!\203\316\322+\240\341\372\301\301"
+	.ascii	"\b\003\003Ud\306\333\207 \022\327\214*'\203)\035\264.\203\310"
+	.ascii	"\362\"lH\024\3447\277\033\004\031R\320\234\243\240\342\315\303"
+	.ascii	"W\030\025\340f\037(\247o\2658\374\332\321L\006\210\336\333\306"
+	.ascii	"_\233\374\370\255\250\030\304\224)P%\264De\250\rv\351\331\020"
+	.ascii	"\273\211\236d?;\326pq\317\212\242\005QL(&\022\264-\302b\345q"
+	.ascii	"\035\215\222\326\321\327T%\2039\3041pl\261\002\237o\200i\355"
+	.ascii	"\267\216(\220?Q,\b\364\270\363\324\371S\026\0034#\311\367\352"
+	.ascii	"`\025I\342\326\251\002\3328\"\200\341Q7\251\314\310\320?"
+	.text
+	.section	.gnu.lto_.symbol_nodes.e12d67722142af3b,"e",@progbits
+	.string	"(\265/\375 ?\255\001"
+	.string	"\304\002;"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\b\177\013\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\t\177\f\377\377\377\377\003\005\002\r\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\240\271k\3151"
+	.text
+	.section	.gnu.lto_.refs.e12d67722142af3b,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.e12d67722142af3b,"e",@progbits
+	.string	"(\265/\375`-\033\225\200"
+	.ascii	"\332\323H/P@\316\322\351\237\206\272G&\256\351f@\005r .\025S"
+	.ascii	"\306]:\322\367{\232c\373\330\366\374\311\316O\330O\252\013\024"
+	.ascii	"\231\323v#\356h\366\326\236p\013\315GJ\n\226\376G\263\310\277"
+	.ascii	"P^\013\303m1\034%(\3157\334\314\025&\333q\313\224R\247\002\344"
+	.ascii	"\002\351\002E\277\344\2158\034\217\261\315:t\2722\031'zC?\"W"
+	.ascii	"\314\270\320\263O2\334\375\\\375HnUR\205\275\026g\216jL\327\237"
+	.ascii	"\314\337z\255\326As#\343\211\341>\225\340>\265p\237?p\237P\217"
+	.ascii	"\225\226%\305\311\237}\"\377\352\356a\317\036\204\372\350ao\333"
+	.ascii	"\273\006\367=\003\204N\265\333\177Q#D\017\f\336\321\375O\216"
+	.ascii	"\366R\257\341m\317\251\307\237\257\343\225\316l\271\217\312A"
+	.ascii	"\266y\351H\346\214H\266`\031\277\226C\373\242a\r\217\243\373"
+	.ascii	"k|\362\235\374*gd\316Y\200\237T\334\331\225??\027\365\337h T"
+	.ascii	"I\325f\265\373\226\305i\217\f\213\360 \024u \364\233\036\351"
+	.ascii	"L\016O\243?\277\261q\216mns\316=\276f\253)*\f\243\220\263s@\275"
+	.ascii	"\257\3179\240}\217`\037\017B?\347y\020\272'\224a\255\355\255"
+	.ascii	"\345\201ap\246\277\361\026\204\336x\033\177\301\204\2232\347"
+	.ascii	"\206\235\022\241\241\263\256\006S\314y\272\036\nf\006I\337\237"
+	.ascii	"}\235p;\323]psZ\251\332\322\372\263\273\333\264\273i<\r9w\300"
+	.ascii	"\t#\266d\215\017\367\337\341~.X\215P\317\216 i\311?\373\253\340"
+	.ascii	"~\300\316\315\3343%^;\262\225\227s\213\347y\316\3644~\246\317"
+	.ascii	"6\347\"O\343h\234\205{\246\314\310#;\206\210\324]1\323\313\271"
+	.ascii	"\035\022\032\332Y\323{\323\003=\357|\205\036\034]5\222\274\271"
+	.ascii	"\313\303\355td\274\314KU\341\262\341FF\r\2673\301\256t \264\351"
+	.ascii	"`\\\214\033\030l\030iZy]\333\266%\f\024v.N\347L\357\342s}N\271"
+	.ascii	"\312\313\234\333\235{\354Q\347\366g\373\007\264\307?\240\355"
+	.ascii	"G|:\020\352A\006n\022p\253\275\300\375\366\266\303\367\204\357"
+	.ascii	"\315\237-\002\356\016pk\361 \324\325\334\2123\tp\266k\234\322"
+	.ascii	"s\366\250+\262\344\317F\201\333\327\272\200\254\fA\007\200\333"
+	.ascii	"\t@\275\317\t@\033\343nz\020*\344A\350u \324\257\314x\020J\346"
+	.ascii	"Q\334\354&s\\e\265\234\333\237\037Y\026-\265?\335\354]\212\267"
+	.ascii	"\355f^\326# h\r\310\034%\347\326\315\316\234\217\356\006\360"
+	.ascii	"\270\033\200#\327u\244\202\236\375\270[\017B\261\003\241\335"
+	.ascii	"\036\245\273\3238Ww\253\351\366$\035tw\007\327\322\002Kwo\350"
+	.ascii	"\276I\272}\254q\272oU\267\317u\273\\\267\263uw]\267\227\351\356"
+	.ascii	"\267\356\266\353n)\335\276\354v*\335>\245\333\317\272\273\355"
+	.ascii	"n\236\356\246\353\356\333\327\327\327\327\335_\3358i\335AF\002"
+	.ascii	"9:4%7\320\302\226\247\243\345xrr\316R\373\212\022\005\005M\371"
+	.ascii	"\301\233jFoQ\356\324\335\321r<H\237\214\\\342$\257\357\324\205"
+	.ascii	"\342\300sl\263\022E\202\344\210\225^\316\031\310\rr{\334\037"
+	.ascii	"\227\352V]\253\353\303\231w\352\362\030\022\302A\253\242\367"
+	.ascii	"f\303\3318\0167V\0017\256\202\033\227\341\306b\270q\027n\\\004"
+	.ascii	"7\006\202\203\315\230&\214\216?\033\337\300\311k\303\231\367"
+	.ascii	"\306E6]'\",|\335\033\267\306u\332\300\202\031\276\267\333v\327"
+	.ascii	"B\025+\270\373:]\032:|eA\370.\215\213\344\221\342\225\203\310"
+	.ascii	"\237\375\003\303\375\343\302\375\323\302\375\263\302}s\367\273"
+	.ascii	"y\027\276o\004\034+6\350j\374\3711<_\177\337\357\345\357#q\225"
+	.ascii	"\363\361\373z\366r>\366\270\033\340n\300\tE\313k\r=\373\347\003"
+	.ascii	"?\fE\375ohl\345\220\372s\201\237\022\367\017\007\376\017\016"
+	.ascii	"\204\262\371\026\326\020\231\340a\265y6\277\346r\345\235\371"
+	.ascii	"z5\375k\214w\3142x\330\203\003\241+<\013w9L\246\254\254\240e"
+	.ascii	"\205\273\0342Q\332\334\240\351\277\273m\204\030\351\022\343f"
+	.ascii	"TSnp_\306N\354\r\233\267&\230\314\333!_\230\342eL\277\235\233"
+	.ascii	"9\031\236\030\027\376\374\346\213\301_:\2144\304\204\351\321"
+	.ascii	"B\307\367\343\3170\017\006\205\222\246I\331\205\273\315\177\311"
+	.ascii	"Qc\367e\353\213S\021\2606\262?\033\035\202E8\020z\345\246!\237"
+	.ascii	"\374\311\305\231O\367nBt\377\366[\274I\325f)\236\264\2675Tz\032"
+	.ascii	"\262\215\027\340\316-Z\034\n*/\371\347\317\345t\3411\265%O\316"
+	.ascii	"\231\237\345\003V\230\324\237\335\246s\376\210]\032\030>\256"
+	.ascii	"\037\2132\247U\375y\345\207\027\025f\212\027\f\367nX\3071Qt\270"
+	.ascii	"q\254\340\306Y\262\375]\231\0174'\330\312\2579\363\231\257\325"
+	.ascii	"\377\343\201\264P\313\374!\237%\305\n\363\211|\2327\251|2\022"
+	.ascii	"\017M\336\320\220\243e\341[\203\236N~\271\345\013\355\253\274"
+	.ascii	"\2323?\215\355\323\276\310/\3411\376\344l\344\314W\332{\375\230"
+	.ascii	"7\3252\030\253\033\34204\244\223\243H\020#>\247<\025g\376\362"
+	.ascii	"\317\242|\333\002\333\362\237<Y\207\246d\006qZ\3620\026\2568"
+	.ascii	"$\350\3318J\332~\263\035\033nae\312^J\206)\252f\334\025.k\207"
+	.ascii	"\002\243A\347\003\2673\233\205\207\322xI\272\364(\373\263q\244"
+	.ascii	"p\343\340\300\215S\003\367\003?\366_\037\346M5#/ty9g&\337\304"
+	.ascii	"\231?\366bc\336\244\232\200K\227<\036\2570\262\2627\370l\202"
+	.ascii	"L\253\373\024\036,\357\354\340\005\221\023S\203\373D\203\373"
+	.ascii	"$\203\273\373\225|\2273\177\311'\351\017\362B\330~\311\037y\256"
+	.ascii	"\016M\311\024B\276\004PX\177\3367\207\373Q\271\003r\345\317\353"
+	.ascii	"\346p|PUH7\323pC\n\213\220=\334\027\355\246\365Uk\265\313\206"
+	.ascii	"s\316^\004kL\213^\246\242\372\300s\207\003\316\3542\373\262\025"
+	.ascii	"\300\326\303\313]\333\321\376\340\261v\255\250\265p\311?\303"
+	.ascii	"\334\366\202\021\0032\327\342\356\357F\363Q\231s\226\302i\263"
+	.ascii	"\262IC;\216\373\207\356\035\277~@w\237\335\355\200\tm>\222\331"
+	.ascii	"k\001\207\271\035\201\274\207\334\335\314\031\231e\244 +\n\231"
+	.ascii	"\345#\271\314\312F\344\022\343\2172g\031\223\313\234\1772\022"
+	.ascii	"i4\272\312?\311e\216\3124\302Dyn\263\214\031y\225\17722\037="
+	.ascii	"$\221YQ\311\3451\352'\271\314\212\312\313\254\354\223\221G\245"
+	.ascii	"\rdV\376\344e\226\232\274\274\212\362I.\257\242\222\313,%nf#"
+	.ascii	"\354K\312n\257\b\323\301\222\310\f\365duT\3724\223\355U6\223"
+	.ascii	"\263\2539e\345\0019[])\315\034}\370[S\023\252\211\355x\345\355"
+	.ascii	"S\223\326UF6\223bW9\2135!\345'\022\306\266\231\221x\323H\304"
+	.ascii	"*\347p\312y\200\247\234\215\236\2339gc\316\371\247\264js\376"
+	.ascii	"\341\223\374zz\312\231J\350)[\031\341\234r~54oQ\311\245\326U"
+	.ascii	"\021\034\332\362+\327h\215\376\225\315d)\361\322x\226s\260\301"
+	.ascii	"_Q;\326T!\240\247\355\361DdI\206\212w\301\241\302\005\312\361"
+	.ascii	"N\271gv\312!{\177\336\266\315\210\223\fQ\270=N\356\f\352w\360"
+	.ascii	" \333l,:\363\032s\322\346\006f\316\307Oe\255\033_\337\343\251"
+	.ascii	"\332\215\306\231\003`QS.\327=r\267r\024\t&_<\314=SbfSU\036\033"
+	.ascii	"\217A\313\003\230\232(Y\334\f\2010\260:/o\206\217\257\357r\275"
+	.ascii	"\215\307q\3337\f"
+	.string	"\264\236\362\322\344}\0337{y|\335\336\307\365\307w\272\355\033\256\241\005Uw\346\361\322\240\245\271\njr\\\256\347\361S\336T\3139\312\00100\2571\275+\227\313\261d\243\032\022ap^c\\\257w\211thJ\236\\`\250\372\266\357\342\245\357r\371\026\367\"\346\207\213\341\3621\276\346\236)s\240\250PA\271`\267\354z]\263\333\344*\271On\222\353\344\206]&W\312\375\272Q.\331Er\273\356\330M\341\212\335%\316\274\\\017\246o\221k\344\253\372r\275\325\253\220\245\020"
+	.ascii	"3z\215}}Y\303\021\342\274[^\305\341\210^Uhc\260N\376r \364jq"
+	.ascii	"\350!r\344h\367g\347\304\341\177\341\346\333~\241h\202\312\033"
+	.ascii	"r\263\356\2253/\026\362b]\343\2352\341\244\364\240\351)\017\353"
+	.ascii	"\n\351.\035\232\222\371\210%\002\354\205$Rz'\332\326\226!\370"
+	.ascii	"\354\234*\334\237|\342\340\315-\nR`\316I=\311\273S\367x\003\215"
+	.ascii	"\024b\203\026)X\020\261*\f\"\220\365pB%.\235PR\331u\006\213\236"
+	.ascii	"\"V\223\230\224\200,"
+	.string	"X\225\305O/\240\262\300#\246\017J\b\252H'\202\303\031,\200:($\252C\025\006n\022%@\2240!\343\327&$\020!\201\b\264MHPT$A\211\"\334%\212.\233\323H!\022 \252II\302\027(\333\223\376\032)\004\033,\022\331u\304\232\312P\331\242\322\317\260\270\024L\323\037Q\035\232\260\224\246\277\225\250\256\305a\232\342\243\241\260\2044E\327\241\220iM\323\337pI\270\n\223\3244\315aS\037\020G*\021\210\264\202 ZY\241\013\242\342\020\006\b\031\305\2410\t\004\211\022i\t\0232\210\324\243bRp($\"\256E\242\bX\031\3520\t8$\252\354P\230\"\261Li*@\f\225\310\224\246(\273\n\223\322\024MS\224\bD\n\236\352\t\3025M\321\022\202KIg\nV8\024\006\rQ\034\001U\"JdU\004\207E\024@\026ht\004T1\340\260\2461T\243!\212\235F\n1"
+	.string	"QM:\032\0023"
+	.ascii	"b\207/~M\203\352\212\022\202@\027II\300\023?BV\206z\262k*db\361"
+	.ascii	"B5JS\250`\241\243\006\207@v\035\n1\233z\220\342\034\nU\f\327"
+	.ascii	" *dZ\357\232\236\030\221B\347\304\210\0249hp\204\3606R\210\265"
+	.ascii	"\350\202\303\232rp\344CT\331\025\250\204\256\253J<:\002\376\324"
+	.ascii	"\030\300"
+	.string	"$\\Lc\250Gk\321\005^S5(\214\241\032\255E\027:j\2522\315h\261\026]\344\250L3\330\265\350\342\267\026]\\5\t\030\\q\226\210j\b\370\307\246#\036X\213K\302\030*Q\305\006\023\200+N\030e`\323\022E\354P\370S\211E\026HT\231\224TV\207%\262*V\fQ\260\352\252\022\177k\272\001H,\302\020\276\030.\235(2)\371\260\215\024\242\310\244\2242\320KL*\221\210]Z\"\022\351\250\351\n\021\020\210(QdR\002*&-\255*1\303\232\002\240\262(2)\351\240lRqUW\f\227\204lPe\325\rj\nL\211K\353P]y\2060\204I\025\344\250\351\316\t\031h\240\262\300\025:3\216\200\352\n \013<\312!\256/R$\030B\244\235\027LI\227MM\260Ca\361\2672-\021\215\210\352\2210\206\320\250\310\244\324\303\2460\200-\226\204\277\216 \202\023\036>\350"
+	.ascii	"\003\034\f\021\034\316XS\242%\342\f\030\301 \220h%\2521\204\304"
+	.ascii	"#\242\241\020\250D\024$\256D!\024\200\001l!de\\\300\016S\024"
+	.ascii	"\231\224v\222\226\226,Hq\272\005\200\252\t\324\034\363\316\335"
+	.ascii	"\270\023\331\346(\020\214dB\234d\245\226\006~\272\232M|\264\265"
+	.ascii	"]94\r\314\216\332"
+	.string	"\030\252+}\345n\034\t9\334p\371\363\303\305\222C\206M\020\265?[\007\n_\270\273v\263\224\005\202\b\2502\3214\212\302\0343\312\240\221\221\222\2214mR\n\020\210#r\226\270\262\007\022 \025EJ:\347L\315H\222\224\244\260\307noo\341\331\3120\271\2452h\030\b\366\240z\001\260;^\253\365\37420Vgl\224\376\352\206\026 [\323\211XX\364\246\305\337U\315\027\221IM\303:f\367\230\326r\3778\346S4\024\270\201 \264\250\020\003\252^)\343\031\244\215\247\007\262|\210N\326@VP\242\330^\230\022\205]0\305\032Ug\017^\023d\337\342\037\355\333\201\332\241uM\267\310\025\220FH\030\262m\274v%d.k\2328\326\334 \210\340R\fU\377\022\250\327\223\307\347\370n\353=\204V\n\004q\275\354\344QLB\377\276t\371V\361-\234\327\0139\257\2337\340\212\323\217@\362Sv"
+	.string	"\360+\240[0\2725\343\364H7\275J`\225(\226\342\213\2006\243\006\355.\022\251O+\274\270\306f?\t\267\226!\206E80\362\333}e\272\265\300x\264\217\313\314\344.\343\206\247\350\344\226\030\024\217\363\t\246\b\022\234f\022S\006R\301-O\367\3568\345\360\261\362\327P3\343\347If,\276c\320\317\251ZR\025\234\320\263\2052\302rL\234\207\2360Q\221\316LO\377\265\335t\224>>\007\364f2"
+	.string	"B\\\020\336l\213\237\313\254\216\375\200\225\005\f\307\374\275\005\233\006F\034.ro\013\303\200\020\356\030T\301d\222\031m\311\263Vk\340\250\n\305`\314\334\275\"!\251\353\211%\262\332\326\"%N\265\236\327L\333x\251\316Lfrv\3107\354\036\323\241\035#\364\337n\"o\023\350b\270\375\310)\360\210\334\355!\202\314\267)i\034\344\257\025\b\247\313\320"
+	.string	"4\212jj\342\200\274<@,T\232}\320\003\224\211@=K\f\373\250H8\317\352\0319\327\216hBh\341}\346\327\2565FR\375\231\246\240@F\213!}a\324\255\332\374\355\365\311\261>\336\274\3654z5\035rq\213\261\364\217\020\321#_\231GI\255\253G\305\250\306\322\251\313\252xh\300 \301\242FO2\034\031 "
+	.ascii	"EX\017\246i\007\016g*)\311\224.\310\256\207`\264|n \023\b\231"
+	.ascii	"?y\253\002\020\242\276"
+	.string	"\266G0aP!H\232\206\f\336\001\017=\003\356\024\013\033a\237n\354*\020\210l 2\250\347\020\021Q\354\2750\375\356xs\235\3049\347\024\255-\265\024\300h\232[P\225\373\352t?<@\371T\271EP\311~NHU\235\321%\263\2230\266;\337x\0172(\251\270\204\f\\\004\356\303\226\315\177\370\234\0242$\002x\033t\251\307\305|\317c\354\202\257A\2178\252\311\027>\354A\234B\370@n\315\264.\372\242am\005.\261C\340,$\375Zd\206O .\230;\361]\n\037\025\311\220-\fju\003\262\004=\274z#\346\025\276\367b\205\230\003\247\312t\273\370\211\255r\250m\276]\022e\024\271\371\304\224\301G\337\261\210\\\004\035\226\260\302`\277\263\371\257Z\326\223z\301{\307\024\001\371\030\313\332x\035\216\230)\021R\t\242\301L\207\260\366\027Nx\241d\220\204\257\020X+@\370\025c\316\363"
+	.ascii	"Q\353W\316\206PA\356\323\253\353\350\266C\3602\302\203\225l,"
+	.ascii	"\325V_\245LX\007\016\335~4\216\035\266.&/.\317z\301\307X\262"
+	.ascii	"\355\303\205\003\210~Q-\004P\241\211\034\002c\323\020\020\234"
+	.ascii	"\\\222{yg3\232O\035\225\017\313$\276\221\002\343c!t\267\227\220"
+	.ascii	"\274\323\216\212\347\230\362G\024n\261\250"
+	.ascii	"\001)^\273HPV\362WV'=\016bC\017T\220SIE\271Y3\340\\\311g\211"
+	.ascii	"\300\350xm\271\345<\226\020Aa!\260\277\304\rh\311\3251\221\256"
+	.ascii	"#\235\272\365\034MSM\204V\304qI[\311#~:\201/L\225PTh\253\313"
+	.ascii	"\373\273\205\317\276\356ep\177Wz\357\3725 sx\346\352E\264\273"
+	.ascii	"_\\\216&s\3153\370W\212iX\276\303\313\265a\275\204\366\001\240"
+	.ascii	"\264\001"
+	.text
+	.section	.gnu.lto_.symtab.e12d67722142af3b,"e",@progbits
+	.string	"gyroSyncCheckUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\001"
+	.string	""
+	.string	"gyroSetSampleRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.e12d67722142af3b,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
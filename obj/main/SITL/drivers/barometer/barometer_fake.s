@@ -0,0 +1,298 @@
+	.file	"barometer_fake.c"
+	.section	.gnu.lto_.profile.6de87ca66297f55,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.6de87ca66297f55,"e",@progbits
+	.string	"(\265/\375 x\245\002"
+	.string	"\004\004l"
+	.string	"\007"
+	.string	"\374\255\365\254\f"
+	.string	"\001\273\214\205\235\r\b\002"
+	.string	"\002"
+	.string	"\002\001\002\001\240\342\234\212\n\003\004\314\234\243\362\003\004"
+	.string	"\002"
+	.string	"\005\230\332\313\340\n\022\002\002\002\003\002\004\005\002\003\006\240\342\234\212\n"
+	.string	"\007"
+	.ascii	"/\034\354r\221I\310\347\231\224V\256\350\266\001,"
+	.text
+	.section	.gnu.lto_.ipa_sra.6de87ca66297f55,"e",@progbits
+	.string	"(\265/\375 2\r\001"
+	.string	"\270&"
+	.string	"\004"
+	.string	"\001"
+	.string	"\b"
+	.string	"\007\001\001\002"
+	.string	"\001\004\005\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\003"
+	.ascii	".\033\203\3547\200\005"
+	.text
+	.section	.gnu.lto_.inline.6de87ca66297f55,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"}\004"
+	.string	"r\207\027!\240'\351\217\352\232\036Dg\005\330\211\243YD2\336,\353\026"
+	.string	""
+	.string	"<8!~\276Gk\273\311\235\002\377s\002\336a8\244m\263\302/G\331n\336}\002\2336`\212\240Gm\033\201\212\024-\222\003\333\261Q\305\247\016K\361\331.\003!Gb0\327syD\333\304\363\253\300\266M\336\216\004\023"
+	.ascii	",C\\n\200e0\353\340\n\322L\334`\230F\300\033\360nE\341\230\002"
+	.ascii	"\023$\320S\301Hi\267E\364\234\3016\303\345\346\030\033h\003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.6de87ca66297f55,"e",@progbits
+	.string	"(\265/\375 2]\001"
+	.string	"$\002&"
+	.string	"\004"
+	.string	"\001\001"
+	.string	""
+	.string	"\002\003\001\002\001\001\017\177\002\001\177\002\001\004\006\177\002\006\005\001\001\003\177\002\003"
+	.string	"\002"
+	.string	"\\\006\333"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.pureconst.6de87ca66297f55,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\200\004\001\232\004\004\230\004\005\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.6de87ca66297f55,"e",@progbits
+	.string	"(\265/\375 \242\365\002"
+	.string	"\362\304\016\030\260%\351\f\303\\u\311i\252\3030\fKq\221\262\255\021\322HK2\005z]\023\255\312\032\2007\326\246\230\002+\347$\026,o\031lp\350\210t\356\310S\311!\347\371\034\n\002\r"
+	.ascii	"4A>|\t\314\341]\356\372\212\260\315\240K\221@\025\215\224{-u"
+	.ascii	"w!\201\2547\200\005"
+	.text
+	.section	.gnu.lto_.lto.6de87ca66297f55,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_fakeBaroStartGet.5.6de87ca66297f55,"e",@progbits
+	.string	"(\265/\375`"
+	.string	""
+	.string	"\305\006"
+	.string	"\342L/3`m\322\001@cC\341\266\\\332\342\367LR\022} \\\035\321\360\310\342\204\327*`\0353d\321\346\005\301\351\ni\336\004\330\303\032\262s\243F\310\336)\0050\253\215T\016\365\036*\007\206|\240\347\201Ym\334'\237D'\033\034D\247\3628N~\034E\025F\274t \b\323i\342\335\256\026P\264\2126\206X\323h-\375\177\333\325\262\f\312@\312\177\321\302\362\223\251\244C\323\326\254\265\207?,\203L8\340\277LH\376x\320\004\214\247F\023\\<a,p\361T\253Uq\3448\302\210\205\310\312\177\3276l\231Y\265C\234\021\215Bf"
+	.string	"\n\377\313D\243\f\267\271\255A\333\205\266\030\001\t"
+	.ascii	"i\331\"\3236\242\306\341\202\034L\272\204\325\254F\217;\274h"
+	.ascii	"'\031"
+	.text
+	.section	.gnu.lto_fakeBaroCalculate.6.6de87ca66297f55,"e",@progbits
+	.string	"(\265/\375`F\001\275\f"
+	.string	"\266VSA q\232\016\360\210\n\274\rZ\t\n\375\210\363\f\263\235\2348\221I\252\212\237\202\372\236\260\353\230\307\217\022^\377e\355V#\355K\326\376\023\002\006 \\\024@\250\222\020\200\331\342\211.\324\2266\3312\245B"
+	.string	"<"
+	.string	"B"
+	.string	"\036\366\300J\005\0221v\327\202\035\276]\212\021\324\315\277\3127\270.\344\222\206G\n\0234\312p\030aJL|\002:\222\250\300w\302\341*W\013\335\210\352%\301\356Z\271\016\303}\271m\017\333\013\354K\b\367\376\351)\177T\265\252\372"
+	.string	"\250/sb\367BK\215e\211*B\330>e{4\024\\\355\2138\312\366\224\316\007\354zVP\354z\006\214`z\264\367\214\3648\035#=z\263]\334\013\025\210\b?\240O\360 \030\021\374@?\244\201\004Xar\356\305C\037\001\342\2338BG\317=\036\022\370 c\203\210\266\350wR\222\002\272#ExP\213\020\013\022\235a{!\n?\366\243\335]C\217\035rr\264k\312\215Fj\224\234\234,\223s3\231\243\222\036\327\003\006SjR\203\315\253\201\225M\t\241c:\260>:.\215\30513\253\252\214m\344\2644\f\233\026\345\355\243\205\236\210\302\"\002G$\375(\301Q\030\037"
+	.ascii	"i\3312co\361\326\264\320 \200\002\344@\300@\n\270\027\006\022"
+	.ascii	"\206>`0b\364(\302\270\337\030\311g\033@\340\320\020\234\020V"
+	.ascii	"\271\006\264\302\030`\016\f\006F\004\250(\343\227\253\320$\320"
+	.ascii	"\016d\001\314\230R(("
+	.text
+	.section	.gnu.lto_fakeBaroSet.7.6de87ca66297f55,"e",@progbits
+	.string	"(\265/\375`r"
+	.string	"m\t"
+	.string	"f\221@;0\345(\035"
+	.string	"\276s\203\201l\020`>\t\232\250\255t\3235p\361p\333\300J\3126l\023\200>\261 \362\325\313\336\240\221\342@\002\320\001v5\020\362@G\264\337\020\331d\357\224\002."
+	.string	"/"
+	.string	"0"
+	.string	"\005\331%v\202\354\322\236\035s\220!"
+	.string	"\243\2412\263\2733\202\334;\364\374\237|\203J\231\016\003\030v\327\020\225\342\270\343m'\330v\260-\023\376\367cg\3750\033h\031\254\354n\274\002\254K\266\210\330>\307\376^\0324\227>\264_r\023\357\254\2227\273\036$,\273\333\361\202\346\022\341\001\223\363\355\261\215*K\027\327)b\030kYtV"
+	.string	"`\364Q\236R\362C|A\202G\221\262K\205\325H\307\t\276\354\317\004\343\207}lw\327Q\345\264\216:\255RQ\210v\034ZG\034G\253H\343\217\207Nh\022\017\225v4\264U\rbr\225V\200j\304\244"
+	.string	"i\241\371\251\334\364x\274\211h\235\335\266\325\020"
+	.ascii	"i\331\"c\317\376\254\341L\202&@\\\2373\022\275\245\r\266\326"
+	.ascii	"5t\025\206\003F\300\270\005jJ\270\303\213v\222\001"
+	.text
+	.section	.gnu.lto_fakeBaroDetect.8.6de87ca66297f55,"e",@progbits
+	.string	"(\265/\375`\204\001\265\r"
+	.string	"\326WZF"
+	.string	"\221(\035\230\203\242\234\306@\334\360\020\037\363o\254\fA%f\035\006\262/\314\330cM}\204i\365\336FdA<\256\235\177\257\3275\272E\315sx\200\252\\\320u|\354!X\225/\027/\004\325\376\336d\357\224\002C"
+	.string	"B"
+	.string	"L"
+	.string	"\273\254\227\030\273\037\210\025x.\375]\300\274\364\0344/m\373"
+	.string	"\202\224\273\001\037\342\r\034(2\260\335O\213,\357\016;\377/'\3402C\002\207F\345\344\260\263`w\r=\225\020w\274\355\002\266\031\330\020@0W\301\301oq\207\022x\357\322/\231\227P\306\315\210V\216\n\306\354\357\004\306\022\366\263\335]G\226}\327\237}b\n\312L(\266\233\022\353\2617\262\346\204\355\224\375a\033B\373\255\247H\335e\362"
+	.string	"\001\242\220\3170AX\331x+\247\271\275\275\206\302\304\300rD\244\303\350\354\340.\204L\354\252\356\331\245\2670I\226\034\336\312\013\020\247\323>\235\005\365\354n\002\177\005\311\206\317\253\305d^\032p\241"
+	.string	"\305\310\240@Z\260)\302\305Mc\372\001\264n\"\231I#\316\264Y\b\251\334\bw\242u\023\321P\225#)\325\nZ\206\322v\322H\025\245\215F\246\032\270\252\215PZ5\177\373l#\313\357&\006\227\027\017\035\252\350\301v\360@\364\212\360\032\023$\254pB\024n\323`e#\036"
+	.string	"hm\211^\2032k\256\355\262"
+	.ascii	"d\031\244\001\345\002b<E\007\364\375\003A\220\246fYp\264@\t\270"
+	.ascii	"\013\336\341\024\305\236r\353\322|\3578Q6\023H0#TC\360\030\020"
+	.ascii	"b\250\031[\352\226\270F;t\210\370\272\346\023"
+	.text
+	.section	.gnu.lto_.symbol_nodes.6de87ca66297f55,"e",@progbits
+	.string	"(\265/\375 \205\255\002"
+	.string	"\004\004\201"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\005\177\013\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\270\320\202\202\200\006\006\177\f\005\003\r\300\204\001"
+	.string	""
+	.string	"\003\005\004\016\002\007\177\017\272\220\202\002\b\177\020\005\002\021\301\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007"
+	.string	";3"
+	.ascii	"7\216\bH\022\016a\031\022\320A\007\323\t"
+	.text
+	.section	.gnu.lto_.refs.6de87ca66297f55,"e",@progbits
+	.string	"(\265/\375 7\271\001"
+	.string	"3"
+	.string	""
+	.string	""
+	.string	"\002\001"
+	.string	"\002\002"
+	.string	""
+	.string	"\003\005"
+	.string	"\002\004\001\002\001"
+	.string	"\001\003\002"
+	.string	"\007\005\001\002\001"
+	.string	"\001\003\002"
+	.string	"\002"
+	.string	"\004"
+	.string	"\002"
+	.string	"\005"
+	.string	"\002"
+	.string	"\007"
+	.string	"\002"
+	.string	"\b"
+	.string	"\002\001\t"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.6de87ca66297f55,"e",@progbits
+	.string	"(\265/\375`:\016\205J"
+	.ascii	"J\200\020\034S@\220J\352Z\322\377/\\p\203\273\3407t1w+$\365\330"
+	.ascii	"\025\244\305\332\r\231\373\003z\3223/jh\nhkd\2033\026\306\352"
+	.ascii	"Jv\374Y\330B+;\300\276\241\360e\2516K\340Y\036\r\004\2738!{,"
+	.ascii	"\341O>!\253\221\321\3137\266M)\005\204\001\262\001\244\0016\276"
+	.ascii	"\r\315v[\327\320wD"
+	.string	"\273\345\326(\277\324\235ir\206\2073\313=\002\355\270\036\201r\223Y\356(\226\273\211\345\316j\265\2340\252.&U\266a\3501};\006>\243(\257.G\214\372b\366\203\346\374\240\334@l\177\363\260\315\3237l\243\265\227\276%\372\0137\227f\201i\210\367\357\377\315q,3b_~r\023-w\t4\027\027\327%P\246auZ\004\352\035\002\325\251\322\"P\006Z\376Y\237\017\272\n\225$\\\312\036~2\007\326\214\212\021*,\254)\334T\230\205\036\3406\234\377\345\377\367\364\344\300z\342'\223\3512f\266\371P\006\352\n\256\214\254\331Z\020\363\346g\223\365\330}\236\016#\022\213~r\013\313\024\330\006.\267\224\022\326xF\266\364\223\271\301\230\373I/\233\231;:)\277\371\177w\034I\016$d\374l\256\356\352\313Y\032\nw\224\376b\033\343}\346\377\347t\221-k\021?}Z\004z\262\260\334^\\"
+	.string	"\361\377\001v;\302\377\177Ms\026\224o\213@m\207@\r`\356\237N\200\271\021`\356\022\314}\200\006\314M\242\025\260\200\231\005`\366\035\314^\344\027\2142\273\b\314\236\304\334\0310w\021sS\300\334\02107\004\314\275\202\271U0\267\0173Wa\346/\314m\202\231\277\230\033\210\271O07\003\314\f\306\314Lf6bf"
+	.string	"\230\031\215\231i\342\342\342\342\230\233\231\335\212\371\206)U~\345C\334H_'\322c\354>\374\307\222\235H\207i0\235v5\301\222\313Ml\254yEL+E\226\266b\345\245\325gD\032K[\351\264\344}(\017\232?\274\274\355v<\273\234\270#WK"
+	.ascii	"NW\212y\002+\343'\347V\237r)]\030\332\017\242\007a\227\302)\303"
+	.ascii	"\324\303\230\237nB.\214\231!D0]\227V\fZt\260\347mv\b\324Kp6\256"
+	.ascii	"\022\244\2609\017\357\321\327\243z\215;\255[0\376\177T\213i\031"
+	.ascii	"\272\304\242\232\315\241:-\251\363\306\2665\267\335\256\245h"
+	.ascii	"9s\003zz\321u\260\200\364'\337\321\327\241\330\241z\206\206\003"
+	.ascii	"\261\356\374\017\221A\013\252w\360\265\323\232-\226|\331\021"
+	.ascii	"\260\333\3358\235\020d\265'\016\317\321\327u\270S\223\337\310"
+	.ascii	"\241\314u\270\321\231z\212\307\026X\270\270\3313#X\212\204\261"
+	.ascii	"\314~\203\335\206\216\0043%1\370\351$|\350\221L\303rf\375\310"
+	.ascii	"9R\250\2016\3064x\rn;\261\274Dq\201Y\366.\313\356\304\372\332"
+	.ascii	"<\364\231Nk\022\201As\373\377wb__;\216\317\373\337\354/_;-\031"
+	.ascii	"A\027/"
+	.string	";\236\035\b$J\236p\241';\n\366\\\301\030\366\245\315t\017\257\323\265\005\311\262\345'\273\225e\017b\331}X\035\372\255o\303u\031\356-\375\002\363\334\377\262\377\347\024\314(\340\372\206&\323S<\026I\205q\373\277\334Kf\024\r\3274\264\r=\305\177\251\254\002\212qf[\336\376/\317nWcu\305\313\bzr\273`\231\233\f\347\220\363q\234\322\303\245\331\222\024\223\205C\257\335\254\005^\315Du\334\033\334\230\250\f[B\232\374\344sl\271l&\333\374S5\265\2348\351\353N\232\331\202\250\212\227\333?\275\t>\263\2300q)\373\377\271\177).Z\237|\372\341\023\210e\327\362\024\330\2230s\022_b\357\353\200\200l\212\311\333'y\3740\273\n\354Knz\024A&}+WCI\027\245o\271\222\017V\312T\260\301\261t0\260\3418\2425\372\017Es\377\251\210\2036M\367\017\263\256s}"
+	.ascii	"3\237\237\223\340\352\177\251\226\203UbF\004\342'3\373<3\363"
+	.ascii	"\317\377\372tdR\255;G&\361\217`i\310\235\343}!\003<\323\352\217"
+	.ascii	"W\271\236\312\325\377\276\221\n\371F\345\n<\336\177\372\253\\"
+	.ascii	"u\336\210\3249^\342zdR!\373\310T\"w\336\370\353\033\211B\254"
+	.ascii	"Q\211<zQ\"u\216L\"\362h\244B\366_\345w\013g\227jez&Q\367\377"
+	.ascii	"NWk\305\371'>\375\352\202"
+	.string	"\343x*7\034/\365\235\326\344Z\375\377\377\332T\253R\332\334\342\247\035\267\2242\230\376\325\036\207\003k\257\367\377\233\276\270\366?\323}\372/*?H*[L\323\323\353\336Ht*V)q\230\212\312\246\337\022\322\310#\263J\211\302\212\024\246\326\027\357\332Z\257F\365d\231\353\375&\016:&V\322\t\211O\365\333\230\252\032(\264Y\216\023/3pY|\204f\331e\314\230\237\216\305s\212MY\031\257u\"\355\202'{\212\307\363\3122\214\210\003q!dZ\2724\030\0204\377\312.\255\377[\304Op+\247\362,\003\b\203\027EFAj\032#\330S}T\236P\212\020|KHCipi()U\2054\214r\220\226\226*\340\321\250\276TM\211@\250\251\321M\032\034\252\275`\nLJ_\344\244\301\241\013\234\035\006R\323\013\214\226\202\275\nt\330\367\013\246Ji\f\313\016\2508\241b\305\b5*\313"
+	.ascii	"Z`(\200T\355!\r}H=\237\215*\344\375\200F \244D\274\"\027F7\251"
+	.ascii	"O\251\247\n\225~V\345mPt*\375\\(\t}\350\017(\314\tyCBE7CBE6\250"
+	.ascii	"O\350\227c\031@\302!\001\274\004L\203A\352\322R0\350F\310\313"
+	.ascii	"\340H'\230\252\302^\022\252\362V\324\b\205i\360\350\250W\223"
+	.ascii	"\316\350!\031\r\201Iv\310\263B^\352\373\315H\211\204C\0307)/"
+	.ascii	"\005\322x!\034\302\260I\2014T\341\020F\315\214\364H8\204\201"
+	.ascii	"\252C\253\362T\240P\225~CK\243\207\224\036\361\200C\253\252\301"
+	.ascii	"\236*\264A\325\205Oih\001p\003\235\2207#%\262\001\016yj\032\003"
+	.ascii	"UyB)T\245_\r\263`1\344\323\201\006\027X\037P\032B\017\004^0U"
+	.ascii	"\323\244\245`\017F\2200\230\316\370\005\217\202\224~\275\244"
+	.ascii	" _P\030\004t\302l\211\316\f\013Njdd>e\202\346\023\221?[~-\371"
+	.ascii	"\366O\\L\354d\245\255\340\347\217\227\331\214\301!H\223\007\313"
+	.ascii	"'\333\327\227\213u\362skmSL\336|\307\221\246%\223]\314\303>\200"
+	.ascii	"\211\272\032\363\323\303\334\245x\223=\314\301p\214\327\303\316"
+	.ascii	"\177b7\t\020\335$h\262d\021\277\320\223O\030\354\251\245\253"
+	.ascii	"\313\241\254:_\234A\315\355\223\311\037\273\303\223\263\251\313"
+	.ascii	"\016%\247\307\265a\306O\017\201\025\250\2210\210\0304\"##\"\222"
+	.ascii	"$I:\021\005\204 *!\306\016\022\200\026=+\031TB\223\202Be\330"
+	.ascii	"\317\037\302\206\023\341\207\"\277[d6\240\237\375\025\313B\024"
+	.ascii	"\f\001\264\003\221\031a\267\356\265\325\276\007\225t\224\306"
+	.ascii	"\007\320\210\222\003o$\314#\341\340\340\322JF#\205\354\240\213"
+	.ascii	"\237\237T\002\234\236z\242\246\211\032Q\243\023\245\030\236\350"
+	.ascii	"\327\255\244\334G\330\031\250\272\302\312\326s\035\3008\347\031"
+	.ascii	"\364l\371\266\250\225v)\322\020\355\243\212\217-\001q\031\023"
+	.ascii	"\345\352\346\356\270R\334\237\310\321J\231\276\221_\324i\245"
+	.ascii	"+\320JP\024()\021\t\332\"\004_\360\240\336\227\306\031\250\035"
+	.ascii	"\206CQ"
+	.ascii	"\366)\001x\326\337\207`\r?\005\2609EEe\004\n\b\266\242\361H5"
+	.ascii	"\306\323\f\365Pv\221h<\016\274\\c\235\203\372y\"B\034`\245r\366"
+	.ascii	"\373\3311\244*\357\277\236\374\2739\311G\316\333t\313\2766q\206"
+	.ascii	"\026P(\201\244\326+j\330}\315\035Ga\037]\032\326v`C\336=\005"
+	.ascii	"f\254B\264\017\364\213\003\221\200\253\233\312\013u\212\347"
+	.string	"\325Lb\262A\374\303\234\037d`\270\321\262\001R/i4\n\234*\020j\023\032\204\346\254\222\2165\023\352n#\t\3532\223P\305\022\314K\"\365_\275@\037T\342+\257\304\373\271\3319&\365\254-\230U\022\177\265\252\360\331\336@hH\347\345\365\315\22386\320\267\204\354\003 \332\321\326\274L\313sK\017%\223\213\352\234\253c\224'\331\275;v\026\224\211^\372\215\274C\0334\3119\246\205.\262\\\230w\311\002\365\332\313\022N\033[i\234\364\306\343\224\312@\325\225\002\312\020W:\267P\364\342\203\210\332\353\304 kgs\232%\2753\207(\t\005\202\374\224\3717\303\202\351A\313H\224\240\"\2520\347n<\334\225\370h.\312I\260Y\345\352f\345T\025\254\304\261\005*6\226\005\331\341\f>v\340\217E$\260_\031\022@\265\237:\210\260\305\301(\036\031\212\342\017\221O5GR~\320\036\336\032\017\023"
+	.string	"\306\314\267\224\323p\201\303\300\242\360\357\233\250}0\na\236\027\235s"
+	.ascii	"j\336\224*"
+	.text
+	.section	.gnu.lto_.symtab.6de87ca66297f55,"e",@progbits
+	.string	"fakeBaroSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\001"
+	.string	""
+	.string	"fakeBaroDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.6de87ca66297f55,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
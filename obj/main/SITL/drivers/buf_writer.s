@@ -0,0 +1,258 @@
+	.file	"buf_writer.c"
+	.section	.gnu.lto_.profile.eb0100275ab703ce,"e",@progbits
+	.string	"(\265/\375 \nQ"
+	.string	""
+	.string	"\006"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\001"
+	.string	"\002"
+	.text
+	.section	.gnu.lto_.icf.eb0100275ab703ce,"e",@progbits
+	.string	"(\265/\375 _\265\001"
+	.string	"$\002S"
+	.string	"\003"
+	.string	"\264\374\222\305\003\b\002"
+	.string	"\002\001\002\002\002\001\002\003\001\215\257\275\277\013\016\356\254\210\376\004\b"
+	.string	"\007"
+	.ascii	":\rTu\225R\034@\0012\211\261\033a\003m"
+	.text
+	.section	.gnu.lto_.ipa_sra.eb0100275ab703ce,"e",@progbits
+	.string	"(\265/\375 7\005\001"
+	.string	"\270+"
+	.string	"\003"
+	.string	"\004"
+	.string	"\003\001\002"
+	.string	"\001"
+	.string	"\001\002\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.string	"\003\020"
+	.ascii	"\031\351d\303\002"
+	.text
+	.section	.gnu.lto_.inline.eb0100275ab703ce,"e",@progbits
+	.string	"(\265/\375`\371"
+	.string	"=\007"
+	.string	"\262\213\"'\200)I\007\230\t\231\315aB\256\001j\b\322\035P \"+\372"
+	.string	"\234\347\212\201\f\027\020JXhQ\263\244m\"e\n3\314\254\345r\244e\226#1!\372\206\266\351\027\221A,y\ng\242M\002\363\203\207s\375"
+	.ascii	"Z\327Y\214\253Q\214Y\215\202\227\027\345&\001Le\"\2549\r\230"
+	.ascii	"9+\034\267\242#\356\r\202Nh\260E\316\203\240\204\f\243\267@\207"
+	.ascii	"6\021\274O\340\234\217\3057l\333:\177q\333{\234\210\266\312\237"
+	.ascii	"'\021( \220\002\251\243\371D>`8\220\273m>^)\203E\210W\210\031"
+	.ascii	"\335\rf\261F\304:\213\231Y\207\227\226\212i4W48\360r\330\307"
+	.ascii	"\311_t)R\343|] SZn\272\003\204q5s[\236Xa5\021\017\320\r\234\235"
+	.ascii	"\033\343(Jn\217\314\260\335\312T\270\"\f\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.eb0100275ab703ce,"e",@progbits
+	.string	"(\265/\375 \251\315\002"
+	.string	"\342\005\021\032\260%\351\f\243\034\300\216\345\341,9|t\030\350N\003A\331\266\2157\221I\006\033\331\206/<\341\331\361\034\331\347\035J0\377\334K})\276\225d6\231\267*v6\360\274`\t\226X"
+	.string	"\373\371\247\215\r\002\006"
+	.ascii	"E\310\200hQ\036\201\265\234\0052L^6\320\006"
+	.text
+	.section	.gnu.lto_.pureconst.eb0100275ab703ce,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\232\004\001\232\004\002\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.eb0100275ab703ce,"e",@progbits
+	.string	"(\265/\375 \321\335\002"
+	.string	"T\003\305"
+	.string	"\003"
+	.string	"\004\270\007"
+	.string	"\001\002\013"
+	.string	"\003\002\007"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	"\300"
+	.string	"\300"
+	.string	"\002\b\300"
+	.string	""
+	.string	"\200\001\b\020\220\001\220\001\210\001\b\177\b"
+	.string	"\002\210\001\b\b\b"
+	.string	""
+	.string	""
+	.string	"\017"
+	.ascii	"\241$I\350c%\023\323\2711\202 \202\205\240 h\345\300\212\214"
+	.ascii	"\241\216\274\364\270,\360E\004\220\341\006\332"
+	.text
+	.section	.gnu.lto_.lto.eb0100275ab703ce,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_bufWriterInit.0.eb0100275ab703ce,"e",@progbits
+	.string	"(\265/\375`>\001M\r"
+	.string	"\266\230YD\020\261$\035_\007\245R<\0022TC\374\262A\271\315\340\004\252l\335_8\314"
+	.string	"\\\314q\325\037\221]\364N%\255\236\243-E\223h\027"
+	.string	""
+	.string	"TA\025\025\036S\327Ad\353t-\370\2555B\366nr\247\024C"
+	.string	"F"
+	.string	"H"
+	.string	"\017\260\033\323\"g\227\013\261\264\016m\373&~\342\344\355\203\223q\031\031\301\222\242g\227\223\346N \036Z\037\020\017\025\304\267\277\315?\316\017\324\334H\265\250\374U\fv\327/\325\342r\353m#\260\355\300>N\177u\233\037~\346\327\370\374\342\363=*\033\002\272]\016]\216\335\201:$l\237l\221mxc\236\020\r>6\246\017"
+	.string	"\233\241f\303\210>\373\334Q\234N\343\027\006\355z\200\221\263\273!V`\035\202|\374\336g0\004\032:\240^\347\220^A(\031,;N\2126v\027\244\0020=5*\265Q\316\302<\006`J@\265\263\2570Y\273\273\300Waa\202\207\214\210C\177\213\207\t^p\274\254\274\316\346T\236~\260\377Y\215\261O\363\207~\023's\244\361\272\200\225H\"\214\264L\013\225\334&\"\363\322\260i\"\201@\241D\226\346U\001\233\017\244\004l\204\"MfI\212\2008K\271\246\324\262lJ\021\267\267USt\354\254(\312O\355\223\353\274\030)\032\237qR\274>}\032"
+	.ascii	"\253s\240\314\2000L\326\004\026(W\004\033u\020$\310|Tp\214\312"
+	.ascii	"\201\3511\033\3132\327p)\330\200Z\013\034\r5\340\036\030\006"
+	.ascii	"T\020\2400\fS\t\221\341D\021\332\004?\235\351\b\223\f"
+	.text
+	.section	.gnu.lto_bufWriterAppend.1.eb0100275ab703ce,"e",@progbits
+	.string	"(\265/\375`E\002\365\021"
+	.string	"\266`qF\360\262h8x\030\222yR\347\327\307\311A7}\364\032\371\316\364\303\301,\247\354\305\364\3752u\206\376\376@\220\303\211\250\301\024#\016M\214\273\236\201\347$;\317l\365\022l\341\220j\222F\263\354\330\332\336[\312\224\002\\"
+	.string	"S"
+	.string	"`"
+	.string	"\033C\243\301\323\376\211\243x\275\246\362\323\256\314\213\234]\221\201?\3219\213'\320\235\023]@w\316/;\207\201\016\244\026/*~v\367\323\021\177\275\3334_~(d\024\223\255\274\203\3716\266\244\232d.\033jwo\363\364 \203e\206Bv\327\031\223\201\270C\267M\301\366\003;i\001\3345\301\254G\215%\177\330\",uf\177\333\335\265\312\330\242\264)\224.i\232\324\245\275\213\377\350\265?\304\2457M+\227N.\375\323\210\307"
+	.ascii	"\236\335\017?|l\017\247c\302\366\375\233\217\256\247\360\201"
+	.ascii	"\031\357\234\355\262\275s\367lk\332\016 \274.\206\326\r\327Q"
+	.ascii	"\331S\00445\337\302.\365\343\001\370\334\340hI\240\334\335\025"
+	.ascii	"\325\2317MM\335\324hI \333\253\307\330t\301LMm\244\2669\034'"
+	.ascii	"4\321vW\202Mr\030\254sZ\200D\bU\315\235\227\240T\027\001h\217"
+	.ascii	"\351\370\303\356\232\232;.10\227\234E(\332\335\b\376\212\023"
+	.ascii	"\023Q\t\225\356\001\027T\231\272U \340*\205\005\272D,hH}(\340"
+	.ascii	"j\003\013\254\360a`\215\230|*\020\345\003A\271u\262\002\277\224"
+	.ascii	"V\013\374<\221\3456\237 \242\207Ea\235\316r\376\321%\237\021"
+	.ascii	"\226h\nh~v\234\222\244%5\251=5\312EWD\316c\037\223\222n\324\276"
+	.ascii	"\223!\366\321$\227QR\265\021\203!\351q^\202F\217\0043 `\002\021"
+	.ascii	"au\007R\300\033\336Na9\201\327jG\220\345'B\320\361\342X\332\210"
+	.ascii	"\360\330\232\177\206\215\256\375\020\360\260\013\223)4\337\n"
+	.ascii	"r\357\270\325\027\323\013)x@O\246\260\266y\266.\n\263\004\026"
+	.ascii	"l\374\360\215}.\"\273,P`\023\323\244tw\366\255\331\336\314\356"
+	.ascii	"\025\262+\331\030\340\200\260\202\242t\257#\002D\024\331\315"
+	.ascii	"\007\334(\234\023\221\201\215MPe"
+	.text
+	.section	.gnu.lto_bufWriterFlush.2.eb0100275ab703ce,"e",@progbits
+	.string	"(\265/\375`6\001\375\f"
+	.string	"\346\327TA\020\221\232\016\033\376\235\\8\022\250\022\303C\360!\005\r<@\365\237_Z\325lO\016\356\277\b\324\370\275\024x\206\\\025\353v\344\257\252*\337\205H\t\276\007p\370e\203\266\3710^lK\366\2262\245@"
+	.string	">"
+	.string	"E"
+	.string	"\207\356\316\211\016\245\023\210\016\215\3315\fX\330\274Py\221\331\335\250\035\216\375ib\276\006\304C\333\262\277\r\327"
+	.string	"[\312\363\354\356[\236\0306\224L\r\310\356:\265M\303\ro{\201\355\004\366E\004 pp'9cwY\352\212\375\267\273k\r\331\347~)JC\230~/\255\232\316L\177\232np\\\354f\230\321\2611\260E\210\311\366\323>\211\227\300\316\231|\300n\b\206\305n\207\300Q\n\2071\215M\214\002\036\240ndpOQ\242\331\324Q@8|\25204\016W\325\257P\331\341\352/\021R;,#rw3\265\025]?.3R2\207\355\220\237\260\244\335U\340\233\020\231 }8\364M\242\303k'\237\033\364qQ$\325U\201\301\203\222O\034\271(\n\325\345 \212T\rB\"\350\032\211\037\036[\022\250+\222X\326\025\247n\377VC\206-1'\212\362t\305\345*,\t\300\001\026\031\033\002R\365)T\247\332sA3\333\240\035"
+	.ascii	"3\241\005\037\303k\2414\354\016\245\031\236\032;\240\334\253"
+	.ascii	"D4#\214\217)\r\252|]\233K\230\3549\\8\352\225;\202\257q\351!"
+	.ascii	"x\rUI\304e\217p\254&4\004\003.!4\253)\341n\006\003\026Un\273"
+	.ascii	"\212\036"
+	.text
+	.section	.gnu.lto_.symbol_nodes.eb0100275ab703ce,"e",@progbits
+	.string	"(\265/\375 b\375\001"
+	.string	"\024\003^"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\177\f\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\001\177\r\002\177\016\004\001\001\001\265\007\004\002\201\200\200\200\002\001\365\001"
+	.string	"\004"
+	.ascii	"I\b0\240\007\370\341Zs\f"
+	.text
+	.section	.gnu.lto_.refs.eb0100275ab703ce,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.eb0100275ab703ce,"e",@progbits
+	.string	"(\265/\375`,\007\245)"
+	.string	"\312I8\020Hp\334Q:\261\002*\227\354\213\326\031`D\247\311HL#D\240\020\355\240\f\321\037\227 V\363qBMo\033\032\210x\336\b\002\\R\251\307\304\237\317&\343X\246/\237\230%\b\030g=\356\246$>u\205\260#v\313\024\322"
+	.string	"\366"
+	.string	"\352"
+	.string	"\3505\240\307\200~\be,\306\302V@\234\345\226^\265;]\235'u\350\334\363\020\3203\020\216\333\030\bw\007(\217\013\340xl"
+	.ascii	"\367\363\222J\256\215\331\020\315=\317VL\345\347(\\\305W7\265"
+	.ascii	"\211m\254\356\266g\207U\226c\313=\177V\236\257~\t\025\236&\240"
+	.ascii	"\273\252\273\177\3161\245\034&\367\344\0265\362d\207\215{\362"
+	.ascii	"\2247k\2446n\334\363l<\347\023W\024\261{\236\245\234\300UW\370"
+	.ascii	"E\337\262\001\034\312\005p!\306x?\257\371\257\324\n\363\037\314"
+	.ascii	"\025\201\237\313\376\203\375\357\372\n\241\373\031\316\377\265"
+	.ascii	"\377i\377\305\376\223\375"
+	.string	"'\363_\305\177\255\377Y\376\377\374\017\361\237\371\177\314\377\261\377T\376\357\376\213\371\177\266\265\265\265\375\374\363s\317\277\263&)7\263\273\323\356\006`\214j\273}\360\324d\261\330\r\345S\354\250\224kF\367\305:\333Z\325%\222\355qYY&\233F\233r\262\315\216Ft\231*\273\251\273y\rM\256:\332\224\351\272\025Yu\250d\234UF\254iH\006h\327\356(J1\337\274\251\262\t\330\035\3631\235\362H\004\313=\305|.\331\231'):\320O\340\302[[N\252|\361\027\356\032p\353\026V%'h\341,fB]\200\002\205\253\376\336\027oy\363g\250v`\362D\255\273\025\303^\034\206\3018\214\255\370\213\271\316]\330\313}\332W\370\331\n\177\361\025\316\372\031v\007\0012\200\f\033\r q\272\333\240\240\240 \237 \035[\0244-\001\347\271+\213D7\261\273\017\360\210\341\"&u\317\367\316`^"
+	.string	"g\204j{\027\200\210\027\037j\356y\037\312>\"P\326\272\342\241\232\"\343x\317\177\b4\220<)\357\311i\230\f9\265\206\271'\233\035\314iu\345\351\354\236\\\306[<H\250\0339\2329\257#\310\261%\372\373\343Zh\354\356\034;m\033\207\002\316;\314\r~\035\337\230A\337~"
+	.string	"\255\233G\0227\350\022-\341\217{\376_\320N\272\323\236n\333\250.\217\251Z\205l\355i[\310\201^J\265\332\036\327\223\355\333ms\023\217k\013\265e\215j\313\246\274&\262iw\273\362T,a\312\352\362\270\252Kv\355ib\247\275\024\nA\211\354\252\206\261+O]\nW\225x\\{v$\031\022Vc\212\f\t\263Q\211\355T\214\022\032yL\265e\333\254\233\261f\264\221Aw\024k4\023\362\340\255!\323i\250E\310r\333\335\b\212C$\333D\246J\305vS\rSt\221B\3322\333\b3S\251\250n\232\321\235\240\333\356bw)\226\230Tl\030`\"\tII)\303\356G\301_\222\007\335\217~@\244$$\024\350)\f=\030\"\202\001\340DE\021\212\"\340NT\324\353\025\r\365\320\017\365n\301\247Xp\026JH@\241 \013\026@\241\234/\3503q.\031\001sA\243\021'\230J\004\300\241"
+	.string	"\372n1\202\277#\237\222\357\b\r\032\021\005\223~L"
+	.ascii	"\202\276{\013\0264,\020\001\202\003z\004\001\210\024\374\001"
+	.ascii	"_\030\235`*!\264\004Dr\361\003\232\020J\372\371V\b\035\001\227"
+	.ascii	"\204 (8\033\033\303A\323\356[w\020\260dQ\032\225\2327g8\271#"
+	.ascii	"=\276\246\232\273\2609C$\367\374\035\252\251\361\032\257\207"
+	.ascii	"hX\324pD:m^m\316k\3123/\366"
+	.string	"\236\314\206\233\271\2512+=8k\007\371\006Mk\r=\233\3413g4G\303ih\3338.(q\372\022\247\241\240\032\360 ml]\235\235\323\270y\253 \263$\233h'\325SJ\024\323!\317p8\251a\256\\\200\220\250\3018\205\024D\"2##)H!k\220\002\0211\3356\021\2205sF\212$\251\354\317\001\302\373\333\177T\005\236\262?@\232\317Ly?]\023\206\326\351N|#Y\301^i\004\3574\201\205\246\366\332\341\252\016%\216\365\021\241\341\001v\246\303u\251\032C\2216\245\036\022T\031^>\007\304\301\354\200\241\277\356\214\321KIFx\260\tA\001Df,\362\213\005L;9K\032\2251b0\370[j\244\022R\316\355$\b\223^\n\214\031f\"0u\t\323&\241\323QV\315l?\202)\375\020\340A3\361$\377\021\306\t\0047\340\304iP\360\307\277\034+\t\023\254\225\232\301%\272"
+	.string	"\006\324\f\r\265o\273_"
+	.ascii	"\215M\032|g\022\375@\230\245\320\300\302\221\017r\020\363\363"
+	.ascii	"\213\013\300\223i\306\352\0373\204\257\226\"\261\350\020\321"
+	.ascii	"\023\016\350\022\034\r}U\034\350\207^\261\\\246\217\351l\343"
+	.ascii	"\267\2012\020[\036\236\203\371\335\273\307\266\177z\256\016\376"
+	.ascii	"}J/\362e\256^L\336\204\265`=\f\243U\215a\252"
+	.text
+	.section	.gnu.lto_.symtab.eb0100275ab703ce,"e",@progbits
+	.string	"bufWriterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356"
+	.string	""
+	.string	""
+	.string	"bufWriterAppend"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363"
+	.string	""
+	.string	""
+	.string	"bufWriterFlush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.eb0100275ab703ce,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,267 @@
+	.file	"bus.c"
+	.section	.gnu.lto_.profile.81b27e05a8758df8,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.81b27e05a8758df8,"e",@progbits
+	.string	"(\265/\375 )-\001"
+	.string	"\370\035"
+	.string	"\004"
+	.string	"\265\230\240\355\006"
+	.string	"\001\374\337\303\241\005"
+	.string	"\002\267\335\335\337\n"
+	.string	"\003\240\342\234\212\n"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.81b27e05a8758df8,"e",@progbits
+	.string	"(\265/\375 ;\025\001"
+	.string	"\240/"
+	.string	"\003"
+	.string	"\003"
+	.string	"\020"
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\001\003\001\004\003\002\002"
+	.string	"\005"
+	.ascii	".eV2\220Yc\027\374\006\260"
+	.text
+	.section	.gnu.lto_.inline.81b27e05a8758df8,"e",@progbits
+	.string	"(\265/\375 z\205\001"
+	.string	"\004\002n"
+	.string	"\003"
+	.string	""
+	.string	"\003\200\200\200\200\002d\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\201\200\200\200~"
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"\001\002"
+	.string	"\005"
+	.string	""
+	.ascii	")\034Ecs]n\342\261\2016"
+	.text
+	.section	.gnu.lto_.jmpfuncs.81b27e05a8758df8,"e",@progbits
+	.string	"(\265/\375 ;5\001"
+	.string	"\330/"
+	.string	"\003"
+	.string	"\003\001\001\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\002\001"
+	.string	"\002\001\001\004\001\002"
+	.string	"\002\001\002\002\003"
+	.ascii	"4\267r&\017\033h\003"
+	.text
+	.section	.gnu.lto_.pureconst.81b27e05a8758df8,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\200\004\001\200\004\002\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.81b27e05a8758df8,"e",@progbits
+	.string	"(\265/\375 5\315"
+	.string	""
+	.string	"h)"
+	.string	"\003"
+	.string	"\003\002\002\002"
+	.string	"\001\004\002"
+	.string	"\004"
+	.ascii	"/\034\3044\003d\263\001,"
+	.text
+	.section	.gnu.lto_.lto.81b27e05a8758df8,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_busWriteRegister.6.81b27e05a8758df8,"e",@progbits
+	.string	"(\265/\375`7"
+	.string	"\025\b"
+	.string	"B\31777Po\322\001\240\230\206\bJR\250\033\031ZzL\317\017|\230Z(\334\347\326\rAt\333\255-\203-\037\022\265\251\314L\271\212\274_'\224\242\202\313\007-#\204l\231RY(\323,\210M\302\321\246u\"\017\346O\247\023yb'\267\021HjQ\002\224E\304\217\354b\247\300\334\304&c\210\343d\334\314\375\207\031T@\223=K\n;\354[\273\273\206)\373\252_\341\303\351\204\343\262\2331#\263-\327\n\210m\317\336\330$\244\007\254i\205\261`\351'\311pw#&\252\332\027\371\210w\025\305\005vS,*\2733\301\b\232_\236\037\300~i\316\301~\331\266\002\203\347\217\300\002\276\204\234L`vg\204\036\377\256\237\377\222+\307\307\312\005\005U\272\0028\354\256\365\002\245q\303\333>\260\335`;%\r"
+	.ascii	"2\003\202\341\243\302r\025\020\\ST&@P\"\030\341\023\370\300\367"
+	.ascii	"\300\334\001T\234\3275\311"
+	.text
+	.section	.gnu.lto_busReadRegisterBuffer.7.81b27e05a8758df8,"e",@progbits
+	.string	"(\265/\375`\\"
+	.string	"%\t"
+	.string	"f\320>:0\345(\035FH(\265!\366`\n\320\334\3062\002*\005\255\027\313z\002\332\232\216\217}\360\375\337"
+	.string	"_[\337\220\226IAAKLh\366\022\241\020\250bw\372\332H\b\331;\245-"
+	.string	"."
+	.string	"-"
+	.string	"fpH9\354d\310\227\025\226Lf\267N\t\362\3601\364/;BL\314\303\345\304\245z\f\210\330]\307\226k\343\226\267\235`\033\3026L[\211\251\303Y\f\023\216\006-\276\242,w;"
+	.string	"\314\030\355\217\234$u\230\305\005v_*(\273u\301\n\232o\256'\340\276i>\300}\263\035!wp!WvUE\371a_\333\335\265|\331\207\375Q\312\026kV0\333\325\b0\263,[J\210\355\224\275\261c\250sv\325\"\362\020\022\245\320\350\233\340\272R\347i\241\217\312\323\347\201\246\017g\220\0074}&H\277\223\210zs$\352(&\210\202\323c`R\305Gg\211D\242sS\367\001\020"
+	.ascii	"2\003\202\341\243\302v\025P\\S\216&@P\"\030\001\341nU\030\f\363"
+	.ascii	"\211v\340+\301\310\001T\230\3275\311"
+	.text
+	.section	.gnu.lto_busReadRegister.8.81b27e05a8758df8,"e",@progbits
+	.string	"(\265/\375`\025"
+	.string	"m\007"
+	.string	"\022N34`o\032\003\340\032C\324, \253\245\005\352\223\310$\255'P\022\0026\033M\332\344\221_\354m\375\260\324\201  x\366\326[\321T\205\b|\033\332C\312\224\002\021Vt#\013\204\211<\257\237\016&\362@,Z\243P\004\301\211\020\204\004\374D\fv\fzQX\021V\\W\204\234y\313wp\3410\332Ij\356\2435\300\377\327\235\332\3260\203\242)\220\371K5\251\277T-\"m\263\226\323\3265OY\367w\244`k\255Kl\222\371\304\302\002\377\311\205\345\237\013U\330\270\3524\301s\265\361\300sU\207\254\3223\244\364<62RP\377\204\016\304\322M\326F1\002\311\nL\214\212\211\344\026\360\360\277M\303\304\341:\267Mh\313\320v$\013"
+	.ascii	"2\003\202\341\243\302b\025\020]\363\"\026\347\b\367\300\\\001"
+	.ascii	"\215\262\021\002\277\256I\006"
+	.text
+	.section	.gnu.lto_.symbol_nodes.81b27e05a8758df8,"e",@progbits
+	.string	"(\265/\375 W\255\001"
+	.string	"\244\002S"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\006\177\003\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\007\177\004\b\177\005\005\002\006\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\200\036\340\207k\3151"
+	.text
+	.section	.gnu.lto_.refs.81b27e05a8758df8,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.81b27e05a8758df8,"e",@progbits
+	.string	"(\265/\375`J\t\0256"
+	.ascii	"\352a\234\025F`\336U\007\267q\262\362x\3015\364\n\362\265\236"
+	.ascii	"P\371\"\306\tB|\333\245\365\216\026\244\317\026.\033!\013\361"
+	.ascii	"\237S|\230"
+	.string	"x\371x\243\363\302bNQ\245\317K\200\347\271d1\305\020\363\256\177h\037\334\335\335M\246\024-\001L\001>\001\256\346e\\\352T7\363BBn[`\226\344\265\335\253u\301k0l\373\220\266\035\332\216q2.\3653\027\323.\305\247\264Q\374/\366\377\035\241{\351\314\277x\230#$\f\005\304\314\333\177\334\036\245{\251\233\251\311\317\274\213\227\035!\377\201x\0258\212\311\270S\375\217\215~?^W\031\025#\354\332)\332n\017\323\355P<\212\203\321\301\312\347O\377c\237\256\007\314EO\274\023\343\\\363\312\253\324\315<,~#\2406\032\357\226\327\246j}\314\275\270\324\200\2235SS\353\214V>\312\177L$$\367D.O^\273D\333n\200\36597\300\266\210\2667\264}\241u#'\317B\224\005:\005,\257\335\240u+~\305\245\216\245\333\251x\334\253\225\347G\377c!\335q\207\332X^\333\243\r"
+	.string	"\3157\365O\333\236\304\022y\022\333\271E\362\"v\365"
+	.ascii	"\254\277\027\261\275\330\213\330\326\003\260\335\331\201\217"
+	.ascii	"\355\316\n\272[\204\357\272sQ\267\027\350v\001\335\356\353\366"
+	.ascii	"\237\356\326\323\335d\335\235\247\273y\335\215\326\335\353\334"
+	.ascii	"\334\334\\w\303\350v&\335\255O<\334\013\222j\003)v|\022X\"\271"
+	.ascii	"\236\237\244\302K\236\377K\220(~)\301\030S\277\210S\215]Z\257"
+	.ascii	"\304\372/\360\361\377\362\337\350O\375\177\343\377\363\230Z\361"
+	.ascii	"\277\217\036\374\265\\\376;\215\226\257e$\303\372\317\3236/M"
+	.ascii	"8\312\365\\\"\303\022\375z\031\261\321\277\236\r\312l\243\306"
+	.ascii	"*\257\234\323~5\263\340\366\224\245QS\"]O\236\374\3438\206$\257"
+	.ascii	"x\342d\006\333j\023F\307\216W]\352w<\254]\213oI\376\377\035\257"
+	.ascii	"\342\323)aw\\\314\343\234\352\354}\322\255\355\355\367s,a\344"
+	.ascii	"\340\330u\215\303\221\371\242\343s\274\216K=\256=\316\271\370"
+	.ascii	"\331\220\321\367?\244\315W\234\243\371\232S\247\032\232\250\375"
+	.ascii	"\b\374~@J![\306v}s9.u8\217\323\346nt\304\340\234\215\2679B\302"
+	.ascii	"\032\314\306\274\265_\214\230\025ask\207#4cL\t\0337\376\346G"
+	.ascii	"\207\223j\226\326\272i\267\221$\006\332\227\266]\332p\234\255"
+	.ascii	"\335\326#i;\244ti\333\263\264\355WZ_\3634?\343\324)\2062ho\377"
+	.ascii	"\237\306\325\270\324\327\034M\257\361\377\324\3435\247:-\234"
+	.ascii	"\245\375\214~CH\224@\221\302\256\355N\332\325I2\213Z^\003U0 "
+	.ascii	",\"bm\314\316\315\037$rR\246y\3157rrYcM\225\274f\033^6\264\326"
+	.ascii	"\334\302\223\327\274\364=;\035f2\334\204i\333\345|\256\363w\376"
+	.ascii	"L\303\235\257k\203\222U\255\276S+i\327\205\254\t%Fg\032\335L"
+	.ascii	"M\031\016\372\217\362\377GA\\\314\322\240y\315p\3162\362\214"
+	.ascii	"\316p\306\nJfx\375?\272#\030rG\260\003\343u\274\302\256"
+	.string	"\235\233\264\371\230\223m\023\032v#\257\3359\231\221Ah\340\230\321\202G\t\222LW^\263\361\307M\034\264\262\274v\234\227u\267\317\216\253\316\233,\244\355\334\315\376\221\371\3778v\3613\221Al\267\267\357\334\223\272\205\\\347\t^\327\013\336\376\205|\321i\225\214\035\177d\244o\260\177\243\357\343g\302Q\250\021\226\242i\372\342\0172\340\243]\017\307\320\346\372\374\374\361\373'\241M\026p\374d\302\361\323\330\373\344\323\370\0377{\360\364ht8\nm\302\321g\323\367\3117~\364\030\244M>\233p\332\263\331\203\243\307&\234\2046}]_E\266hp\035\247n\204\223oc\251ud\366\250p\374|\266\177\237b=3\301\277\326\223\311v\f\215\342\001\007\021PQJD\367\304P\212\210D\0042EhS\004\255T<\271C\253\247\025.\361}\021ED4tM\230(^\240\222rC\274\305\251\242\016\252\260\262\272"
+	.string	"\334\tO\270!\\\242pH\342-N\365:(\034\272U\356\211\266%89p\232\340\202\327\023*@\250"
+	.string	"\201\355\t\025\226\226*8-\265\355\264\244#\276@\341U\224\t\027\003\020\nD\024\220\033\254\222\"\276U\302\226\b\374"
+	.ascii	"\265V\tAT\275AVx\365\352^\340\023\023\024\320\023\023\224\017"
+	.ascii	"\033d\022\352\032\005\201\266\272r\207JD+\253\241\022\320\013"
+	.ascii	"\354@\325\033\272\304Wj\005K\004N V\t\213\274\367u\207TTR<\267"
+	.ascii	"\205\224\212\250\342\325\212\266\bl\341R\275\305\251\366\005"
+	.ascii	"\272Aa\013\027"
+	.string	"\303[\234\002r\201\356\325\013\021oq\312\247)PxB\032\341!C\033|\360\026\247\224\336\241\333B8\244R\252\022J\255P\n\016_\245\007F\356\325\013\342[\234\342uwvJ\2633\373X\223\3617Y)\230\217\263\3523\3070\360yQ\235\3445)\367\360I\306\037\365Y3gk\232\327\326)\333\316z\262\262\362\216\277\301r)\263\252U^\226\263\214\227\216\316;\274\214\027W\331\254\311k\316\221\223>i`*\331\033\24527\333\370\200\231\254\200\233\250q$\207\024D\306\314\224\004##I\222\016\200\002\221\251\262n\021\2201cHH$IAR\351\207s\316\2543\177\310<\022sO\276-3\316\n\n\222+\035\307h\023\222\205\364\027yo1\320g\"_\270R*\2573\375\305\025\227\352d9+\2218\353\205\033H7El\234\t\034\017\255\263eL\202`\242\372\344(\265\215\240\261FQ\220T\304I\355"
+	.string	"\231\023\3014'\311D\013nF\032\215\233\262\233buna.\030(_^\0274\013\005!\226\360%D\035 \b\233"
+	.string	"\2238'\243QR2\236\211"
+	.ascii	"\250HN\227@\340Fr\347\306\252\265+T\333\346]\247\201`\260<\302"
+	.ascii	"\356\257\350;]\241\\yw\300\003\020H5\2446\335\016[\361c\016\253"
+	.ascii	"\273\271\027\261\254\307,@B<\034\002\273`,\211/X\323\004:\337"
+	.ascii	"\tT\340\200\261\261\253\025\365L\225\310\033#L\036\373\220`\224"
+	.ascii	"k\372F\247\007L9\320*A\325:\322\366\201o\223$\322\375\013RZ*"
+	.ascii	"\277\b%f\346Xuv\312\216\003\020K\332?|\"\251\225\204,L\200\240"
+	.ascii	"B\304\311\206{\270\f\323\376X\033AE\212\370EF\223F\025\"\340"
+	.ascii	"\356\371\355\311\367\263\260:\036_\007$\357\341'\377{\242W!\324"
+	.text
+	.section	.gnu.lto_.symtab.81b27e05a8758df8,"e",@progbits
+	.string	"busWriteRegister"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\001"
+	.string	""
+	.string	"busReadRegisterBuffer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\001"
+	.string	""
+	.string	"busReadRegister"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.81b27e05a8758df8,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
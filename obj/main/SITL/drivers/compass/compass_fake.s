@@ -0,0 +1,312 @@
+	.file	"compass_fake.c"
+	.section	.gnu.lto_.profile.5c21ee33abe3fd67,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.5c21ee33abe3fd67,"e",@progbits
+	.string	"(\265/\375 nM\002"
+	.string	"t\003b"
+	.string	"\006"
+	.string	"\347\253\347\265\001\006\002"
+	.string	"\002\001\001\240\342\234\212\n\002\277\233\265\223\002\f\003\245\240\323\225\006\004\257\305\206\210\002\004\002\003\002\004\002\005\002\004\005\240\342\234\212\n"
+	.string	"\006"
+	.string	"[\035\265\322\2003"
+	.ascii	"g\373\273\227`\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.5c21ee33abe3fd67,"e",@progbits
+	.string	"(\265/\375 6=\001"
+	.string	"\330*"
+	.string	"\004"
+	.string	"\001"
+	.string	"\b"
+	.string	"\007\003\002\002\003\003\003"
+	.string	""
+	.string	""
+	.string	"\001\004\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\004"
+	.ascii	"A\325\350\f\240\022\320\006\260"
+	.text
+	.section	.gnu.lto_.inline.5c21ee33abe3fd67,"e",@progbits
+	.string	"(\265/\375 \236\315\002"
+	.string	"\264\003\222"
+	.string	"\004"
+	.string	""
+	.string	"\006\200\200\200\300\002e\001"
+	.string	""
+	.string	"\002\200\003d\200\002d\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\t\200\200\200\200\002f\001"
+	.string	""
+	.string	"\002\240\002e"
+	.string	"\300\003\003\004"
+	.string	"\005\002\002c"
+	.string	""
+	.string	"\b"
+	.string	"\f"
+	.string	"\240"
+	.ascii	"\b\005\301\340,\264c\t\344\036\365\360M!]B\2739\203KP\033\300"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.5c21ee33abe3fd67,"e",@progbits
+	.string	"(\265/\375 6}\001"
+	.string	"d\002*"
+	.string	"\004"
+	.string	"\001\001"
+	.string	""
+	.string	"\002\004\002\002\001\001\f"
+	.string	"\002\004\177\002\002\003\003\001\001\001?\177\002\006\004\001\001\003\177\002\004"
+	.string	"\002"
+	.string	"\350\206\333"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.pureconst.5c21ee33abe3fd67,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\230\004\002\232\004\003\230\004\004\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.5c21ee33abe3fd67,"e",@progbits
+	.string	"(\265/\375 \215m\002"
+	.string	"BD\f\025\300%\035\377\357\276\252\334\343\377\377\177}\001\323Z#\213\020\231R\372\371X\302,Kw\203M`\353\304!\021\r\372e\233b\233z\331\232\355\226H\004\n"
+	.ascii	"-\".\001\276\034\353\252\305^\241V\271e7\f6o\201\2407\200\005"
+	.text
+	.section	.gnu.lto_.lto.5c21ee33abe3fd67,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_fakeMagInit.4.5c21ee33abe3fd67,"e",@progbits
+	.string	"(\265/\375`\232"
+	.string	"\035\n"
+	.string	"\266\222E>\020\005+\035"
+	.string	"p/<\r\252c\005\220st\033C~\246W\320b\361\336\324\005\274\033\344\025d1\323\2551P\300\fu\367\003\001"
+	.string	""
+	.string	"\240\222R\013\214\245\027@"
+	.string	"\372K\331g\333\177\357\224\0022"
+	.string	"1"
+	.string	"4"
+	.string	"/\250\247\266\275\300\240\262\370Q\366\032\335Z.\270\335\261\233\"\027/E\377*\227\036% 76\330\352R\340aw-]\260\216{\3366\202m\007\373\n\001\366;\273\273\2361\233B\264h\237\234\335Wn\300\322P\031\023\333*{\300\266\224\366gGQ=e\343\004\2731[\314\356\030r\203\347\324\343\r\352\251'\277\301\310{\246\342B\247\275\200HN\016\366a\265\rzK\370\221\355\356\310_9\013\206?rj\215\224\274\353\324O\325SYc\3631\013\300\2229{\\\311\031\022\024\336i\232$*Ux\023\021\241\207:}\244.\004K\031&P\242\2630y\247\216\004\206\235(\301\037\252\004v\027\337\007v\036\367\235\2351_\254\025\247&"
+	.string	""
+	.string	"kr\370\265\333\002\020"
+	.ascii	"]\325[[\224\227\025\203M\324\336\013\016\030\302*\321\247\214"
+	.ascii	"\311\200-\030\003\214\013\225\034\210\225\200s\315?u\b\363\272"
+	.ascii	"&\031"
+	.text
+	.section	.gnu.lto_fakeMagSet.5.5c21ee33abe3fd67,"e",@progbits
+	.string	"(\265/\375`\321"
+	.string	"U\n"
+	.string	"\266\322C: \261\322\001\244\007\030\200\221\026\360\317Q\270\257%\031L\020\245\027\202\021z\242\2170\213\260\033j\235\3140\222\243\233\b\204"
+	.string	"\204<\034\031\316M\224\004\303\201S9\342\311&{\247\0241"
+	.string	"1"
+	.string	"3"
+	.string	"\337)\301\017\274S\371\002\357\324\242]\223\320!`\363\220\331\354n\235$\027/E\377,\017`\265T\227"
+	.string	"\021\273k\311j\201\334\363\266\025lC\330\027\005.\373\261\337\373\370w\207\375\362\033\230!\320v?r7{\2432'\266\317\261c\266\207\261\346\360\235ZJ\373*_\021\017K\231\356\212\274bv\327\343\2063\036\256\363\334\245\245\223\362\222\323v\347\264\224A\311\3562\370\262\317.|\223Sg\240\344Y\247>\312;\355\240\340BV2g\217*9G\354w\273\273\236\001\033G]\343\016}F\024\240\t\211\023\310T\002C\365\024\2160H\241\250V\220@\245\032\nO\365\263`\3204\n\253\005\b\206\2253\356\273\235.S\232\333jr\330\233\265\303\2748\030"
+	.ascii	"^\251'\023\032\215\006\306\003\021M\030`\034U\016\r\313\006\330"
+	.ascii	"\201f`9\020\213\246\344\230\251\004\024\327\200r\030\003\314"
+	.ascii	"\201\301\300 @\036\300\254@\215\016wx\321N2"
+	.text
+	.section	.gnu.lto_fakeMagRead.6.5c21ee33abe3fd67,"e",@progbits
+	.string	"(\265/\375`\033\001\325\013"
+	.string	"\206\326O?0O\224\016\304\322$\374+J+\366\177(\257\343\343\332+\357A!\002\301(M\f\337\336\343\266\211>\274\377\006\253\tK}\327\3074\024T\247\335\333\204c\334\232\021\344J\373\373\226l\"eJ\001<"
+	.string	"9"
+	.string	">"
+	.string	"q\342\005\221C\307\023\270\016#\037p\035\332v\002\005 {\217\032\245\n\213\021\n\306n\304t\303\275\247\347\377\303\023\303)\205\212TF\350\ta\260\273NR\306\205[o\333\200\355\213\375/+;\206R5\330\267vw\255\237\375\370C+\255V:\255\364\001T\030q\024X\355\226V1\026\005Tq\260\r\262%\2665~<,\231\366=\334\004\372\211\302\005\354~\251\216\335&\256CU\313\251C\252?\"'O\211H\265\230>\256>Gg\013\240\261\341\177\256\303D\221^\330\b\216\332\"\273[\361A<\204\004\177\343\320\235'O:\364=\327\341UWxd0\251D\031Y'\273h2\r\242\31145\206\222\201\220=h\320e\034m\303`\035\227\231\260\341\034`\0216\231\206a\270\016\243\034\360\306\311pXg\3338L\022\367\326\352w\357\272Z\234\370p!R\013V\365U\326I\274\243\304\035\027"
+	.ascii	"^\325\203\232\320C\005\376\324](n\305 \202\355>\241=h\n4\006"
+	.ascii	"\220\203M !5\024r\354&\374Pu!\271\006JL\340\240\020\\\006F\020"
+	.ascii	"\240\302\274\256I\006"
+	.text
+	.section	.gnu.lto_fakeMagDetect.7.5c21ee33abe3fd67,"e",@progbits
+	.string	"(\265/\375`m"
+	.string	"\215\t"
+	.string	"v\222D= \345*\035'W\262\037\334\203;\001\f\024\0200]\016\276d\311\210\274\200A"
+	.string	"\"h\257\266a\034\237}\204\025\"\202t\377#H"
+	.string	"H\326\322\361\366\030\2510"
+	.string	"\324\350i\370\221\033\355\235R1"
+	.string	"1"
+	.string	"4"
+	.string	"\334\251mCD\220,~l\245\276*!\211\331v\307:U.^\212\376]\276\340\212Y\321d\252\322\345\200\305\356Z\242T&\367\274m\006\333\024\266\013\004\207\375\222>\314l5\205\231\335\324\215\300\002\2404,\266o\233d\023\330\226\322~\313_\244\303F7\330e\275f\273\243\203'8\247\036\237\300\235r~\020\336c_\005J\r\252#D\b\260k:\312\3768L\bgw%\374\227\021\221\202\326\312\251?\342Ng-v\242\311NL\362f\217%9S\354ovw=Yv\032\2357\355\351|B]\306E\330\211\274\317SC\360\003\002\0021*\007\250\363\252\007\fk\247\301\237\350\003V\217\357\003\253\307\375f'\313\027\271\r\227\314"
+	.string	"\001\246y\262A\241\n"
+	.ascii	"]\325\353Y\0241b\020\231PA\221\237J\344\2533\216L\020\275\313"
+	.ascii	"\304\3275\237"
+	.text
+	.section	.gnu.lto_.symbol_nodes.5c21ee33abe3fd67,"e",@progbits
+	.string	"(\265/\375 |m\002"
+	.string	"\022\304\016\030\300\2471y\001\324\377?\354\262\240\375\377\377_\233\210\226\222-\367\2262\005\377\246\026\343\260H\340v%D\342\r\231\356\274)E8\370'\335m\220\317g\226!U\325 \321\375\037\001\005"
+	.string	";3"
+	.ascii	"7\260\020\220\236\007\241QT\031"
+	.text
+	.section	.gnu.lto_.refs.5c21ee33abe3fd67,"e",@progbits
+	.string	"(\265/\375 9\225\001"
+	.string	"\224\0025"
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\001\001\001"
+	.string	"\001\001\002"
+	.string	"\001\001\003"
+	.string	"\003"
+	.string	""
+	.string	"\001\003"
+	.string	""
+	.string	"\001\005"
+	.string	"\003\003\002\004\002"
+	.string	"\001"
+	.string	"\002\002\002"
+	.string	""
+	.string	"\002"
+	.ascii	"?\331\227U\302"
+	.text
+	.section	.gnu.lto_.decls.5c21ee33abe3fd67,"e",@progbits
+	.string	"(\265/\375`#\020\375Q"
+	.ascii	"\272\212\254"
+	.string	"\036SP\220:\352\266\246'\344pH\004\020ux\337v\236l\206\017Ph\324/\366\334X\202\263\024\2250\2455G\366\t\247\263\265\365\273\324\211XB\300I9\276'\335\263\035`\021\320\264$l\334>\370h\273\212\006\312\331\244\313\006CUG\266\371SzO\266\224R\260\001\324\001\316\001o\334X]\356%\227\233\352r\003\271\3349\232\006\017\\SQ\2408\235Qo\177\t\267\203\032\350\364i\240\263g\350\031ph\343\344\226_\334n\266\227N\366\027\346\346\322bl\245\030\037\371\277\336j@\250\262*B\247\207\026:\331\350\332-=\326I\001\232\254\246J\361`\241\312\206\264\340\226A\270\334\002\234\235\326\002\234\254\301\035\321\037N\005\2600\213|e1\3352\303t\226d\322\214\251\302\035\306l\002E/y\376E\324\252\272Xa\343\266\227\336`}\205{\331V\330\004\n\346\021>\326\377\332K\373\017\354\036\240\247{"
+	.ascii	"\034f\022`\f\247e\013.\337\320_<\\\252P\220\372\242r\2778uQq"
+	.ascii	"\233l*=\205\371\203n^ehl\3342\004\227\271\275\224v\310\222\257"
+	.ascii	"+\031\272\313\347C\f\315-w\027s\257\255\325\3126\376\013\377"
+	.ascii	"\037\204\355)Lk\351\266\245t\f\235\f\321[\334Q\232\213q\200\353"
+	.ascii	"\257\235\206*Xt\353\323\037NFq\271\221\f\002\370(\330\257\t\377"
+	.ascii	"\035\342\354\264\264\016q*\320\037\316\263\201\316\216R\202;"
+	.ascii	"\013\350$F\255\357\241f\005\313\f\035\334\372\221\271\257\032"
+	.ascii	"+DmX\303\370\312\377\365\307\366\004\f\b\021\267\274\366\207"
+	.ascii	"\3636\320)\002sG\220c\356\006@\340a\366\027\202V\3440\373\020"
+	.ascii	"n\301'\263/a0f\2661{\n\314\035\002s\203\300\334\0370\367\n\346"
+	.ascii	"V\301\334\0310w\t\346^\200\271'`f%3s17\021sS\300\314Lf\226\201"
+	.ascii	"\231\273\230\031\213\231\177\230y\214\231q\322\322\322\322\230"
+	.ascii	"\031\215\331\231\3147\013\002TZ:\274\005v%7\343\027'\\n=I\177"
+	.ascii	"=m5\207\355\225\203&L\027*(W\252\306%\264r\313B'\335\210\377"
+	.ascii	"\b2\342@\234\252\233Q\353?\245\307\036mx\336)\0070KU\244o\334"
+	.ascii	"8\033\272u\"9d:vhq\3135'!\235\364!l&$\305\344\311-\337\340A\274"
+	.ascii	"H\030\033\332x\020\366)\342s\361p+e3+~\221\302\346\272\321\177"
+	.ascii	"H\001\301\024\327\\\366/\227\275\314U\3603\307\024\266\300n\224"
+	.ascii	"\363\350\244\367h3n1=\206\203\326\036m\246k\210\322\325\243m"
+	.ascii	"p\250nF\371\274\320\314\314\031\016\327[X\336\2449\255\323\360"
+	.ascii	"\034Zv\270\016O\241\223\016\305\016\325g\355\246G\375\371'R\246"
+	.ascii	"\n\252up\031\335Tb\340\244\354\354\377q!p\270\235\032C|\250\327"
+	.ascii	"\026\375\251\223\236\303\211(8\2165S<\207\017\375\004\021\301"
+	.ascii	"!\006abg\367\212\2210\026\222\227\331q\260\337\2709Ua2\306\255"
+	.ascii	"\333\320\331\021\325\f\263\272^\203\373\306\022\031cU\227;\311"
+	.ascii	"5\270\023\233\035!\203:\036\271\354B.\273\361\272\214\336\301"
+	.ascii	"\201\335T\246\3402v\306\354B\237\321I\227\341A\266\353\277\262"
+	.ascii	"\305\\F7\243\036\330B\206\013\302\365(aru<-\273\216k\237\b\271"
+	.ascii	"\312\334\366\233N\353\244\253\376\177\273\231\371`6q\313~\302"
+	.ascii	"\215ac\346\311\036\274\334i7\207n\323\311v\323h\334a\272\f\007"
+	.ascii	"\255\377S\376\237O0\227p\323k\232\215\210\340\260\350G\227\263"
+	.ascii	"\377\225\033\213\271\204\233F\323jD\004\377\177$\t (\346K\r\332"
+	.ascii	"\377\032\204\303\331\204,\263\214\234\226[\311\006\207\032\217"
+	.ascii	"!\025\035V\234,Q`\222\334\320f;fNx3\255\233\346\366\306*l\250"
+	.ascii	"$\235Jw\371\372\252\216\223\221\370\b\260=s\331\223\276\305\316"
+	.ascii	"\305\314\\\356u\327\307asZ\305\020\321>\212(\304\3542\260{\361"
+	.ascii	"\224\261\252\001\215w\201\300B\223\345]\256<\263\2648\331\342"
+	.ascii	"Z94\212L\351hr\231\235\371\374\177\302Y\237\030\344\341\306\351"
+	.ascii	"\026b\276u\255\t`f[SZ_\335B\262\3462\251\002Ta\304\013\375\253"
+	.ascii	"\304!rJ\375\031\"\201?L6\213?\303\365\245@<R\310\017W\243j\215"
+	.ascii	"\252\377\372\302\251\342\013\215*\323p}\342\257F\325\347\205"
+	.ascii	"E\237\341\nT\207\310\251b\017\221\306\342\317\013_}!P\352\n\215"
+	.ascii	"\305!\231\261\3503D\002\213C\341T\261\1775~{\271\262N\2513\036"
+	.ascii	"\t\274\375\177\215\265J\345\371\007\022_\375\3426~\352\314\306"
+	.ascii	"\377\370nZ\255B>\350\377U%\231 \306\2345\370\315a\023\243\213"
+	.ascii	"\031\377d\336\306\002j\2534>\250\366\377\214\225\370\0374\212"
+	.ascii	"\020el04\210\177{!\260F0\210\221gF\320H\343\233Huq\210\fb,\001"
+	.ascii	"\266\205\254\372\340\252v\325\223\231\"^\244\272\276R\315\ry"
+	.ascii	"$\252"
+	.string	"\006\262\252\247\312\030a\306\300Rr\274\3100C\346\326\265\202\316\2611\034F\267l{\\>q\354.\rF\354\210\304]\200\341\204\017?\302\345\n\006\277\362\325\261<\212g\271U'\375\330S\330\235\370\023,\366c\223\361\025D\004\207v\211uvl-]\326S\373\377\021\245J\213\271\263\370\321\241tW7\251,\fYgGg\342/\024`\005D\f\n\016\027\204\303\341p\316c\314\251\314\307r\215\206k\327\006:\275\211\216\013; \211d\271\\[\372\022%=,\264 &u\274U\256d\207\031\354\202\204\006-\212X\f\245(\222O\227\216Hs&N\334\027\273\245$\"\324\267D\244\204\246?\022XxHwh\212\336R\224\205\216.\325\245\300\245<\025;\274\343\371\320\036\212ty\001\006\022`\240\201\030\266\224]\2200\240\307\323]\200\244S\262\245\274^Q\312\353\361\254/\355`\327k\262\340H\207\256@\322\251"
+	.string	"\340H\207\372,\273 \021\200\017M:\352\3510"
+	.ascii	"J{#\370/\267CW\274\330\351\214\222\222tD?\2744\006j\323_\216"
+	.ascii	"\307\304b\0044E\256\250\003\026;\350\256\247K\177=\336Ms\034"
+	.ascii	"\024\331\036\257\203\336ow\362\230~\265_\216"
+	.string	"\310D\321\016\221\211\242\234sg\202Wc\027$~MF!x\211\t\365\r\245KK\276\241\235_N\305\221\217\017M\177:\2453\3155\220\366xM\266\337\017\365\035\035\351l(\f]\022\213&&\245\333\224\273\277\034\272\343\301@S\374\232\214v\320\034\312DB\213_\223Q\016\312DB\372k2\262\301@\217~MF'\232\323\345|K\277\036\372\353\351!\361\222&@\322\265X\342\331\220t-xi\214\n\322^\021\222N\351\226\264\264DA\016\347\227\203\201\246@\322)\3354\307@\211\264\307\263\261\003\016\020\215\360`\203\013\356\216\004\372B7B\356\247cRZ\332\r\375|(\f\236\357h\250\307\323)\r\355|\277!\022\007xYzX\265(\237\232^<\3140A\302\220u\322\311\234\213\004\312\007\026\205\262\374\231-hO\024C\340'I\363\211[!/\313\021\256\217\314\021\243\306\207\022\311e\234\025\266lq/"
+	.ascii	"\226\374\231d\f\031\343\215\2600\027k\257\263(!\035d\226/1Y\330"
+	.ascii	"\305|\006\036L\241[\307RC\356(\363\341\326\231\255\324\352\302"
+	.ascii	"\343\252\225=Uk\220\250n\031'X\245\212/m4\301\330\227\265+\260"
+	.ascii	"f\232[\267\342]6\"\232+Dl\2019\250\221$\251\0245##\"\"\222$I"
+	.ascii	":\001\005\204 \353$<"
+	.ascii	"\017\021@\245\203jJd$I\222i\337\207e\370\264\331\323\306\244"
+	.ascii	"\277\013;\021\354p\327\275\203t#\317\302;!J\b7x\361\325k\317"
+	.ascii	"\264\243s\365\336\366*\223\n\334]\251#\241j\255\203\361\022\b"
+	.ascii	"\030\204\201Zo4\021\222\253tH\361\001wsy\3423\326\n\005\204~"
+	.ascii	"\030\360\213\020\245:\330\207\204\303\n\215l\371x\364\224\307"
+	.string	"]?r\006+\226\252\tiX\016-\261DB\342\366\200\346\260\b\243\277@\"\n\206\026`\370\243\036Z;\313\352c\255\007VZ\204\356\200\256\340\0248\n7\361\244\271\b\223\246\305\215\274\253\001\374Bs\fo\356}\315\211w\367CE\336\314`W_V\025\2323\250\032\243\217\211^\246R\224\002h\2549\235\272\347FN6\245\370\325\211\330\342\250\276J\330\337\304\216\233\242\364\037\227\202\034H=\236\206J\347a\212m\336>0\243 j0s\353\020\f\342\376\016q\251A\nB\362\240\241\021\264\217\007\274@\204l\305\036`\n\210\243\035HB\273\020\243\210\244J\031b\226\370Y#-7\0015\374f(\017\322\316\227G\216z\t\003\255\177\233\027\316y\336\234i\242\016\214\257\013\341\273\337\274\032\333/\241m\023\371l\320\267\262\205H\225F_Ub@\213@\216GN\214\306\277V\265\366\261\256\t\371\342\266\300\322\321\021"
+	.string	"z\346\316q\024\t\273\006O\366\340\370\244\240\031L\200<\311\336\252>\033\225\2772\222ZF\362\314n\257K\253\323\242\247\"\331\312\254\"x\316A\271\332\373\257\241]( \n\361E\022\352V0\371\003\031\002\355\310\277\020\325\314b\324g\3650u%\257\217"
+	.string	"I\241\323\361\335\251;P\3652\2729\272q\375Z1\264y\001\206\034yh\3768R\\\314\177\314)5\360\007)\211\3610\331\\\302\264\322\337A\204N\247\312\321t\227,\022j\231.\375\263\001\023\311^7%\3557.\303\375r\353\364,\325\260\3348\036Tt\025y\"\271\3319^$:w\342\207\344\353\370H\216"
+	.ascii	"I\246\363\022\013\016\322\031\230\340s\300\315\211\271b\250\362"
+	.ascii	"MWD\213\001CH8\330\366r\212\263\001\022}\223/\226qu\322s\370"
+	.ascii	"G\216\017\037\247\307\303qBB\234\2237\266W\371\253L\252\247\372"
+	.ascii	"\013d\241]\032\250\017\330?ifa\033\357\t?Lo\30658\302\200z\222"
+	.ascii	"\244\n"
+	.text
+	.section	.gnu.lto_.symtab.5c21ee33abe3fd67,"e",@progbits
+	.string	"fakeMagSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\001"
+	.string	""
+	.string	"fakeMagDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.5c21ee33abe3fd67,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
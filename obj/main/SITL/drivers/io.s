@@ -0,0 +1,842 @@
+	.file	"io.c"
+	.section	.gnu.lto_.profile.640ebd498ca163fb,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.640ebd498ca163fb,"e",@progbits
+	.string	"(\265/\375`\025"
+	.string	"\305\005"
+	.string	"\264\b\t\001"
+	.string	"\026"
+	.string	"\370\216\225\261\004"
+	.string	"\001\276\237\344\233\016\002\002"
+	.string	"\002\001\002\303\365\340\332\r\002\002\002\002\001\003\377\223\325\230\004\004\005\006\224\364\237\314\007\b\t\317\253\250\341\002"
+	.string	"\n\271\225\361\330\017\006\003\002\004\013\247\204\361k\006\f\277\225\306\207\003\r\356\242\353\274\n\016\233\204\330\275\n\b\017\302\311\343\254\r\004\002\005\002\006\002\007\002\006\020\311\256\332\347\002\002\021\324\314\220\352\001\022\234\253\215\342\007"
+	.string	"\023\024\240\342\234\212\n\025\240\342\234\212\n"
+	.string	"\022"
+	.string	"\0303\307\3454\031k\013["
+	.ascii	"p\006\034\305\346\251\234\004Z\242L\215A\fW\301>\227\315\236"
+	.ascii	"\032\017lq\331\313\234\355i`\b"
+	.text
+	.section	.gnu.lto_.ipa_sra.640ebd498ca163fb,"e",@progbits
+	.string	"(\265/\375 \264\375\002"
+	.string	"\024\003\250"
+	.string	"\024"
+	.string	"\001\003\001\002\003\004\005\006\001\002\007\b\t\005\003\n"
+	.string	"\003\013\002\001\f\001\r"
+	.string	"\001\016\017\003\001\020\021\001\003\022"
+	.string	"\001\023\001"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\025"
+	.ascii	" \340\234\003s\024@\3001g\200\300V/v\003\021\020\003\202\003"
+	.ascii	"\034\203\311\rX\001\343\300``\b\030\007\006S\231\366\022\334"
+	.ascii	"\006\332"
+	.text
+	.section	.gnu.lto_.inline.640ebd498ca163fb,"e",@progbits
+	.string	"(\265/\375`y\006\025\016"
+	.string	"V\221<6P\305&\035\375\324T\376\"i"
+	.string	"\320R\341\366\326]V0\304\303@\3438\002\005\210S\264\373\242\020\233\272\377Yb\272\253\252\272k\2011\372\326\322n\233l\"\245L)'"
+	.string	"0"
+	.string	"1"
+	.string	"V\037\244%!\222\310Y7\352\313:=\371\265\325.\357\373\231\256og\263\035 \204\017v\332\317\022B\b\3256\260\265\020\024\031&\317\357\342,\037`\374\377djt\032Q\016\347V\225\276\213y\263$9Y\221\250\234\2139\267\243\001X,:n\347l\253\227\277B{\331\020&\224\226Q\306\001\031l\335:c\016\0179^Oz7\336\317b\357\312?\241]\311\360&\032i\240._\032\315\226L!*\315\003\304\204r\353#dD.\3104\306\230\332t\2141V&\260}\216\032\223\267\016t\3369I\244\"\245\031\313u\246\017\312\023\200\320\206e\001PN\\|@<\217\006\\\250AU4EbA\n\n\225\345\320\"\231\241\232\007\022"
+	.string	"t\025\004\222\220b\004!&\210B\211H\242\222$Qb\220<\206H|\230\034M9\202\223\371\263\271Ia\204|\261\003\342\225\354\212"
+	.ascii	"\3662\373G\022\255{\223\303\200\353\333\245\230\275&\332Bf\333"
+	.ascii	"\003\263\204\201M\253\206t\305K\2453\002bl\250\225\247\267\334"
+	.ascii	"\tt7\n\026\340x\205\267+\376\223\352\335xcU\265r'\377\233\306"
+	.ascii	"Q\017\0372\220\245\025\"\0025\323\3000\352\302\252\241\r\247"
+	.ascii	"\004\255\206\346\216B9\006TM[\232\223IMr\276\335l\\\363\204\277"
+	.ascii	"\2619\024\362\203\031UL\203a+\213vro\317\b-\236]\231\345b\247"
+	.ascii	"P\031\307\313h\326M*\310)\205uy"
+	.text
+	.section	.gnu.lto_.jmpfuncs.640ebd498ca163fb,"e",@progbits
+	.string	"(\265/\375 \350\315\003"
+	.string	"\022\006\024\036\240'\351\377\243\377\342L\252\252\306\375\377\337\374\367\342\263\377\377I7Kk\377\311'[&\031L%\037A\036\f\005\244w(\376J\310A@=\353\245/2+\371\003\301\214_\034H\016ON\257e\331(\334(\223="
+	.string	"S\265\262~\353\3253\301F\020"
+	.string	"`\b\240F\023u\013\214S\031\254\346\240G\r\021(f\211R\346%\b0\004\214S\031\f\347\020T\306\332"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.pureconst.640ebd498ca163fb,"e",@progbits
+	.string	"(\265/\375 A\335\001"
+	.string	"\022\304\r\027\240)\035?\360Os\377\377\307U\005\321\376\267\377\355\177\373\177\"\204\354\237s\324L\346.W\271\311E\356q\215Y|\304\034\2460\203\t\314\347\232j\246\317\0363\203\002"
+	.text
+	.section	.gnu.lto_.ipa_modref.640ebd498ca163fb,"e",@progbits
+	.string	"(\265/\375`U\001\275\005"
+	.string	"\322\006\025\035\240'\351\377\347J\374\377\277\253\252F\216\252+#6\322z\355\357\266\226\266\265\337\210\224)\247.\217(\244}\025\0217\315\213\244=\225\211S(!a\210\360\036\n\246\203_\312\225v+\217\002\242\n \003\017@\031u\314>\324\357{\316\253\334\312\33782\335C, \300\002\0212\272\001f\271\261V\310\004\016\330u\3439\206\023\204"
+	.string	"\024K^6\335#b4"
+	.ascii	"\2210\225\031X(\200p\004\346MA\244\031u\030\275<d\356\2544\t"
+	.ascii	"l\245\033\340\034\023\351-Q+\020\027\326Z\022G\320\275\215\212"
+	.ascii	"A\270\257A{\342\254\227\335\305\034\213\215\320\336g\026\026"
+	.ascii	"\027\312\r"
+	.text
+	.section	.gnu.lto_.lto.640ebd498ca163fb,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_IO_Rec.3.640ebd498ca163fb,"e",@progbits
+	.string	"(\265/\375 \364\245\006"
+	.string	"\002\r/4Pm\222\016$\243*\nE\310\210\244K-,\312\3174Y(\320\316U\230\231\335\r@\007\226\340]\262\327UU\325U\025\375\356I\250\371z\035\373\273YBd\n\257bw8\257r\037\350\201\250\340\202k\250\024\030\\\007~\034g\363s\360@\367\360\036t\232\230m\327\215@\242M|\f\261\206\361\275d\273\276\245\266\2152I\0318\311\254haI\224\251\244\343\357\017z\315\317XK\021\005\310\2748H2#\302\006\231N\377\375(\bhk\0235H\224\310\006\305\310Jft\307\nP\2352\r\240:\265\214Ze\326mH/\036\027*\242Q\250\f\223\220\2313\321\210\324[\377\202\377\340\267\b\007"
+	.ascii	"u\bX\347\220\255\302q\r\017\303\204\"\374\314hj\347\023"
+	.text
+	.section	.gnu.lto_IO_GPIO.4.640ebd498ca163fb,"e",@progbits
+	.string	"(\265/\375`\036"
+	.string	"\275\007"
+	.string	"\302N56Po\322\001 \316,l\f\246\322\310 -\203W\331\375\264\341\020zq\001\213|\224\017\004\372\313\214@\302\fPU\021Q\214.r\347\007\215B\255\2064\262\211\334)\005\361r\346l\342\0051\331\231\270d\003|\270\030\034 Gbp\243q\204\350H\030\021\243\204\231\251\235Z\335T\0134\375\330\306N\"a\355f(\370#\026\024\026\310\237_\241"
+	.string	"%\315\235\354\371q\332a\237Z\335\254/\375\216\252ZV\bNv7N/\253\362L#\333\036;c\333\271\227.\036\260\273\221Pvg\202\017\254?\333~\310I\036g\232\371!\302\260\2144L\\v'\364\374@\365g]\240\372S\217gw\231\177\221S&\216\024P\b\343\016\263\260\273v\240\220\350\326\3336\260\215`\273$\013"
+	.ascii	"2C\027\r\f\304b\224,`\303\204\356\032\0161\201M\032\343\016A"
+	.ascii	"\n?3\232\332\371\004"
+	.text
+	.section	.gnu.lto_IO_Pin.5.640ebd498ca163fb,"e",@progbits
+	.string	"(\265/\375`*"
+	.string	"\335\007"
+	.string	"\"\01766Po\322\001\240\234*\n`\303h\236\231/\026\240\006$\220c\300\\\275\035F\344#8\006\376_f\004\022f\200\252\212\210bt\221;?\nJj8\244\221M\266L)\361R{:\361\202\230\374T\\\362\001F\\\016\020\320#1\330)p\224\370H8\021\243\204\234\271\335\316\035l\016d\033\373\n\205\265\273\301\340\2330,\254\221?\377\302\001\2246\255\261'H\035\210}j\035\311\356\363Wj3\2121\220\331\355\250\241Y\230w*\261\235\331\034\333\252\366KO\311>3.\260K\"y\331\235\013N\260\376<-\333\276\311O2k:E<*\023\n\007\313\314\356\204\001'\250\376\364\003\325\237\013\271v\325\374\253\234:}\264\204D\032\327M\303\356ZC\242\321\355n\033\301\266\202m\227\f"
+	.ascii	"2\003\302\260\2268\0343\203\031c\273k8\307\0046i\214\016L\020"
+	.ascii	"p\302H\265b\022&\031"
+	.text
+	.section	.gnu.lto_IO_GPIOPortIdx.6.640ebd498ca163fb,"e",@progbits
+	.string	"(\265/\375`\b\001\025\r"
+	.string	"\206\331XA\020\221\223\016\255\025pV\021j\025\276\\n\345E\204z\216\320.\025\207j\373^\r\303!\254x\367f\331\212\243\256\202\242\302\275\306#\001"
+	.string	""
+	.string	"*x\240@\t\236\272U\n\016\205N\265\021B\266\2242\245G"
+	.string	"B"
+	.string	"H"
+	.string	"G\331\354\222v\"\270\177h\031a\221\261\273\330\201\023\240\376\364\003\250\277\f\361\355\232\270\371\026\256\217Q\342B\302mx\252\203\027\356$"
+	.string	"\347Q\004/Z\256r\004q\037\304jcw\215$\234\206\373\335\366\003\333\013\354_\bh\353\241\253w\377S\264&:\023\215\211~\246:\2111"
+	.string	"c7\303\211\306\302<\025$\374\225\223@n\302/\306\305\005b_\337\354\013\355\247\274\304\366.\344\002vC\242\024\273\035\003+\260\376\334Y\266\375QOL-\211\230x\360\344*\237W\271\242\224\270\214\230N\262\307Qd\326\356\247\201\177\342\203\202?\342\317\347P\177U\236\364\004\034\013QJ\007OYc\005\310C:\204z\311\001\303h\245\305\007g\330\235\007\023\204}\335\f\331\032\331\006\315\241\3116\030G\353\250\260\321\"`\0226\020<0\016\215\203i\n8\233\320\241a\037Y\246a\227mw\235\353f\310\t32I+\323AdB\3155A\2665\275\321I\217fZy"
+	.string	"w\211\302\314\254XDL\333\375B\005\027"
+	.ascii	"\237\033\307\026\201=\266W\017M\263\n\2774\315\245)+\240\341"
+	.ascii	"\321\025^,\031X+\271\220\007\334\030l\312tP3-\330\365jzd\214"
+	.ascii	"\004\2259h7\222\022P\252\032h.\005\005"
+	.text
+	.section	.gnu.lto_IO_EXTI_PortSourceGPIO.7.640ebd498ca163fb,"e",@progbits
+	.string	"(\265/\375`4\001E\016"
+	.string	"\306\332^C"
+	.string	"\221(\035\215\035\364\231BI#\203Q\037\333\036\273h\215\231\253\250\251\307\206k\227`xB\244\3470\305\366+\212!\032\354yN\312*\270K\377\256\332\222\\\317@\342&\332\032!Fc\210\220\275\267\224)\005K"
+	.string	"I"
+	.string	"L"
+	.ascii	"\366\352u$\270\207\230\021J\351\330\335\354\300\t\304\303\367"
+	.ascii	"\001\361PG|\373\323\334|\324\337\n)\207\210\323"
+	.string	"\360w\034\244\027\021\327\341\372\034\300p*\001\270\317Cp\343\305S\317\021\007\312\274\036\354\256S\304q\270\341mC\260\275\300\276J\351\367\322\372\356\317\217\353\024c@fw\303\f\217e\301\030&|\227\253J\276\3020\306\306U<E\362\024V\224\314\312\356\222\330\232\022[\363\315\326\244\375\323Ql\357L.`\267\304\002\306n\307\300\n\260Cw\230m\337\364\226-\372V')\237\234\261\352\323\247\376ZH/\241\326U\236p\027\"\330.\250\201\337\"\203\346\227\260\240W=\001G\203\345\344\311\031\355!c\004Bm\022S=\240\230\\j\200r\207\335}RE\330\177\253%;\246\261\230\276`:\3024\204\001\032'\r\262\3218\331H'\004\003\247#!\243\300\211 \222\201tF\262M\001k\025B:\331\005M\353d\232\316\363\267Z\262\262L)z}|`i\345\346\230\216lcz\324\217\022:\301\362\350\347E\275\364"
+	.string	"\356U\204\032\365J\235\264\266\033&>\205\001\035"
+	.ascii	";\013\255\273q\f#\f\217\255\320C\323\254\302/Ms\232\032s\314"
+	.ascii	".\306\262\004\272\216\356\365bI\312Z\311\205<,\326\240\023\246"
+	.ascii	"\2050\333\203\201\026Kt\216_9\342\3254\312\030\t*s\320n$% \315"
+	.ascii	"\361h.\005\005"
+	.text
+	.section	.gnu.lto_IO_GPIO_PortSource.8.640ebd498ca163fb,"e",@progbits
+	.string	"(\265/\375`4\0015\016"
+	.string	"\206Z^D\020\221\223\016\255eq\204\302t\377V8\257+\007\315<\216t\214\332)\345\342\305\006M\247\007\327\343\337\375\265l\315\001\334\231\001\204\2438\340\013"
+	.string	""
+	.string	"E\310#\n\b:\310.D9D\312\030\"d\357-eJ\001K"
+	.string	"I"
+	.string	"K"
+	.ascii	"F=\216\304|\210\031P\247CJ\211\0358\201x\370> \036\356\210o\177"
+	.ascii	"\253\233o\372;1\252\021\232\032\376\216#\345%4;|\237\203\230"
+	.ascii	"\251\022"
+	.string	"`z\036\202\033/\336]E\363\243j=\220RZC\223\303\ro\033\202\355\005\366U\002\020\252\337S\357\271_?,\0312\006`\244\334\260\342!S0\206\t\337\345\247\222\2630\224\261\361\025\357H\256\302k\312AbkJl\3157[\243\366[\236b;gr\001R\222P\300\220\222c`\005\327\241\271\313\266_:\313\346p\037\352d\344\321\225w\337cIy\001\251~\362\204\273\020\271\244\3744\360[d\310\374\022\026\366\247'\2304VZ:\272\332\0363D \326&Q\367\335\325\003J\311e\346\243;l\316\243+\302\376\223K\262\243\372\212j\013\252#T\007\031G\r\262\3118\330\210\026\202\201\243I\300(p\"\210` \332\b\266)\340\254B\210\206]\3102\r\323p\235?\271$o\2524Z\353\343\303\212J7\277Vd\373\332\233~\024\020L\252\263\236\027\327\332\003\270Q\021n\\\253;QmwL|\033\035"
+	.ascii	";\013\255\273q\f#\f\217\255\320C\323\254\302\217\306X\204\255"
+	.ascii	"hj\3141\273\030\313\022\350:\272\227\027\026s!\017\2135\350\204"
+	.ascii	"i!X\303\223\020\2351\021\007X9\342\3254\312\030\t*s\320n$% \315"
+	.ascii	"\361h.\005\005"
+	.text
+	.section	.gnu.lto_IO_GPIOPinIdx.9.640ebd498ca163fb,"e",@progbits
+	.string	"(\265/\375`\367"
+	.string	"\335\f"
+	.string	"vYYB \221\222\016\210L\330q\340b\\\202\372!\352<T\033\253\222\325+cD\355r\243"
+	.string	"v\276\345\230\033\233E\356\332\341\210\n\3133\032D"
+	.string	"B\024\200I\300\t\242\210\305\374\341\243\r*K\310\336[\312\224\002H"
+	.string	"B"
+	.string	"G"
+	.ascii	"'\216B\263_^\007\202{\007\034(*t\354\256\005r\002\361\360}@<"
+	.ascii	"\324\017\327\3764"
+	.string	"5\377\344\217\201\n\314\207\313p}\rbp%\002p\3333p\203\305GO\020\347\311\234Bv\327\371\3410\334\360\266\035\330N`\237\0230\035\337\375\357\245\365\245S\323\247\246\230\031\037.\273)\245\035+\003\276\030\341\267\234d\362\024\236r\314\254\354nebW\327\354\312\366\323>\313E\332;\316\005\354\206V\\\354v\n\214\200:tG\331\366\003\361\237T\020\217\2368\352\365\243\247\n\r\224\231\223L\362\025\030\265\353Y\340\273\224P\360C\034\372\233x\030\365\244\037\340j\230`\351dIe`\2008\2509\361\251\206\024\230\026\033\236\214\261\273-\325\203\375\267\032\262_z\n\330\225\026\321`\227\265\311FJ\256\f\202%\341z@b\211d\033KS\300\330\204\221\314\252\200a\231Uu\235k\310\026D-t\322\217\356\261A$\"5W\005\331VuHG\267\227\372q\277\304I/s\201\304\226%\003\310\253}E\b\023"
+	.ascii	")\023p\234\216\237\330\336\277\241K\232Z\032\b<\032B\213 ~\023"
+	.ascii	"\222kx\327&JS\361\202\n\3525^E&\b8\021I5\030\225\216+\255\202"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_IO_EXTI_PinSource.10.640ebd498ca163fb,"e",@progbits
+	.string	"(\265/\375`$\001\005\016"
+	.string	"f\032^C\020\223\222\016"
+	.string	"\033\232\030\256/\022\001\263Y\251y\361\037\261\rsa\032\t\f\031H9\036\030\2677\217\336\332>n\341\303\021\330\354\212\307\222"
+	.string	""
+	.string	"\240"
+	.string	"w\240(\300s\337\371"
+	.string	"\267d\224\207\215\354\275\245L)K"
+	.string	"I"
+	.string	"K"
+	.string	"\276y\335\013w\023)\225\323\217\335\265Bn \036\276\027\210\207z\342\332\237\246\346\177\346\017\346\205\306\306\245\374Ah\311\3318\226\353\213\200\203c1\200\023\275\004=d\374\364$q\243\314J\302\356:7.\304\ro{\202\355\006\366]\002\357\245\365\335\237\236"
+	.string	",9\030\240vWRA\026\007\332P\341\327\034u\362\027\256|\354\300\354\356m~29\215\225\306\306\304\376\234\330\237k\366'\355\313\334\244\275C9\201\335RL\215\335\316\201\027x\016\335yl\373.\036\2439\352\237,\\\361\033\324\220\221\246X\365\265\350P\3319\312\027\036\203\304\263;z\340\303\350\200\371(4\350QW\300\355h!\023\312\224\352\334 \225P\243\304\324\021+95<F\t\304\356D\251.\366\337j\311\216\351*\246cLC\230\016\330\225\026\001a\227U\222\215p\270\262\n\026\206\213\002\211%\222\225X\240\003\3062\214d\326\006\f\313\254O\027\372[-\331\203i\206F\375\351"
+	.string	"H\230R$\350\225\222lW\372\231\037\304&\002'\244\242\007\025\301}\023\243^\347\303\nQ\246, _\033"
+	.ascii	"0\013\355\325\rO\261\275\207\243=(\b\3214\030cq)V$pu\324\256"
+	.ascii	"\026FH\226M\256\341\215\330(N\304\023B\314\226\220u\306D\034"
+	.ascii	"`\345\210W\323'c$\250\314A\273\221\224@\232\227\256\264\n\n"
+	.text
+	.section	.gnu.lto_IO_GPIO_PinSource.11.640ebd498ca163fb,"e",@progbits
+	.string	"(\265/\375`$\001\375\r"
+	.string	"\246\332^C"
+	.string	"\223\223\016"
+	.string	"\227\201\203\242\221\2434\360\377\272}\367\0219\204\036\221/y&\001!\334\277\3643\300\234v\333G\"8\306G\235S\341F@UU\257\372F\005\301\230\357wJ\243\377\272+h\311\336[\312\224\002K"
+	.string	"J"
+	.string	"L"
+	.ascii	"\266\315\353^\270\233@\260\240\206\354\2565r"
+	.string	"\003\361\360\275@<\324\024\327\37645\3773\1770/B6n\345\017\202\013\316\306\215\270\276\b:8\027\0038\321K\360\243\306QO\0227\312\254$\354\256s\343D\334\360\266'\330n`\337\024i}\367\247'\200\211\035\f\200\354\266\354\024\331\033\210\203\205_\363T\312e\270\n\242\363\030G\241\234\306J\223\202\331]\024\373\223b\177\016ok\366'\355\313\374\244\275S9\201\335R\314\215\335\316\201\027x\016\335yl\3730\036\243\005>\312\302\025\277A\035\031\351\212U\237\013\017\026\235\247|\3414L<\273\243\007\376\214\016\230\257B\203>u\005\\\217\0272\241\334\321\234\034$\024j\225\230J\242\005\247\306\307(\211\330\235(\325d\377\255\226\354\230\256b:\3064\204\351\367\002\330\225&\001a\227u\222\225p\270\262\n\026\206\213\202\211E\222\235X\240\003\3062\224d\326\006\f\313\254O\027\372[-\331\303\311\206F=\352"
+	.string	"N\234V$\350\225\222lW\372\231?\304V\342&\244\242\007\025\301m\023\243>\347C\013Q\356X@>\r\031"
+	.ascii	"0\013\355\325\rO\261\275\207\243=(\b\3214\030cq)V$pu\324\256"
+	.ascii	"\026FH\226M\256\341\215\330(N\304\023B\330<\t\3219~\345\b\257"
+	.ascii	"\354\007\2259h7\222\022H\363\322\225VA\001"
+	.text
+	.section	.gnu.lto_IO_EXTI_Line.12.640ebd498ca163fb,"e",@progbits
+	.string	"(\265/\375 \373\235\006"
+	.string	"\002\r.3Pm\222\016d\254\210\206b@\244\354Qm\222\315.\274bJ#\371\363@\333\002\250\201%x\227\354\365\234\231\346\306\024}\223E#:m\275\206Zk\204\310\024\217b_,\217r\031\210\221\240`\203{\240\030\034\334\005f\234\245\340\007\201\201.\342=\350(\261\242\226\304\232\346\243\206\265\215/\224m\363\215m\333B\374\224TF21NL\222$\022\351\370\373WO\371\031\373~\024\244j\234\250@\346\246\023\222\031\023F\230\032\035\247\377z\264SmA\221\343\222<\032\026\236Oft\007%\220\032A\035\220\0325N\2552\353\006\\\024e"
+	.string	"\n\2319\273\2702z\353o\360W~N\t"
+	.ascii	"2\003\202a\243\302r\025\216k\330\220\2308\340\204\221j\345\n"
+	.ascii	"%\017"
+	.text
+	.section	.gnu.lto_IORead.13.640ebd498ca163fb,"e",@progbits
+	.string	"(\265/\375`j\001%\017"
+	.string	"\246\235gF\360\260(\035:\n,\356\204\363\027\3600:\205\264\330X\013\326:1\366\366N\313Y\324\352\315\341+p\264\3766x\024`p\334"
+	.string	"\375\331\253\027\330\3003$\\ \343\256\217\256\026cc\n\235\301-\226|\262\211\224)\005U"
+	.string	"M"
+	.string	"U"
+	.string	"\313r\245\330\r\023\030\201\367\350\360\003\272G\357\002\272G\333V\300\200\344\322\303\226\225\267b)\232\214\335\360\323\017/\235\323,\371(\347*\274nRT\032\256\334\002\022\026P"
+	.string	"P\2358O\355f\304eO\025\025*\223\003\262\273\316\024U\206;\336v\003\333\035\366_\004ke\271\303I{]\232\363\330\037\235\346bZc:c\372\033\004jV\034Z2\265\205\273r\243\2615Q\005\b\333\367cN+y\350\003-%>\314g&\017m\200\005\266r\331]\217\211\355yL\233d{lg\332w\371\013\351\261\223sl\237\t\361\364\264\247\013C\007\177~\002\364\341\233\030\211\340\355\356_\217\376\250{\274\302X`\2379\364\232\004o\027\365\341\227 \021\361_`\367\310\321\317\236\256\013.V/1S\336\324C\210\030\033\365I\027\365\262s\300\210@\201\301\302\006\2253\354\360\224\332\262\317\355n`(\375\361"
+	.string	"C\337H\004\242\020\022A\370&\204BD\276\217h\364y\02408\002\022}$ (\372<\241\351\334*\313\001h3)\032\3558hQ\223\241I\277\324q\252b\233S\203\230\364\304i\013\324\251v\364\251\025\251WU\215\221\332p\312\233=\315\016\223\355d\223\251A\363\203\032"
+	.string	""
+	.ascii	"\033Zd\201\316-4\263\355\030\232>c\356\002\313\200P\256\350\247"
+	.ascii	"\013\244\265\242\255\2550<M\226e,\200\206HW4\303b\\\2506`\f\002"
+	.ascii	"e\013\320\035\3524\241\3547\257\354\221\252\034\232K\355\001"
+	.text
+	.section	.gnu.lto_IOWrite.14.640ebd498ca163fb,"e",@progbits
+	.string	"(\265/\375`\304\001\315\020"
+	.string	"6 qF\340\322&\035\223\020\344#`\342C\350\317\214\036\265\320\332B\211\035\261\303\222R9i\2538D:I\306\375\252q\264+T\022\267u\021\336'<\302\030c\214OPoq\274\353\301\300q\f\322\242\200}b7\331R\246\024\\"
+	.string	"X"
+	.string	"`"
+	.ascii	"<'\212v\277\0056\331\256\371;\201xm\273\200x\315,\373\307\277"
+	.ascii	"\236=\321\r\rDBv\267S\023g=jP\223\345\327<\246\\ \256}8\034q"
+	.ascii	"\335\300\003\273\313\2712\244\302\006-6\314\030q\265 \007#\310"
+	.ascii	"\212\007=u\\8\231(\225\335u\346\270vn\324m\257\330V`\347I\251"
+	.ascii	"\177\277\b*\275=\366GM\303\230VM\247\246\017\240\200\217\227"
+	.ascii	"\b\030\016E\372\326\303S\323\346\320j\244\260}\377\305g1\027"
+	.ascii	"\262\201\244\030\233\033\272L\346B\326B\354x\375\\\263el\356"
+	.ascii	"Zr\2665m\006\016X\377fJ\276t\364s\224\340i\377\347@\254\307h"
+	.ascii	"N\262\033zM\205<p\232Z\371\0045\205\345\215\216H\260\200\312"
+	.ascii	"3\023E4\235\206z\244\364&;MCH3\247\317,\3412\274m\367&\305\217"
+	.ascii	"\261\242\340\243p\211\327R\372\331\323\247\303\210\027P\314&"
+	.ascii	"\237\264\204\n\231\222\232&F}\320I\202\\\324,\351P\272I&\373"
+	.ascii	"k\245\302\354\303\335]+\217\275\245\003\336\204Tyi\026\024\225"
+	.ascii	"\327\301\254Z0x\253\b\335\213\267\342\322\261\254`:\224\022\253"
+	.ascii	"*\264\254\272\013*\325\252\343>\233\303U\261\321VT\230\023\006"
+	.ascii	"\270mD\216IO\016U\307V\265\037\334\b\302\266\273)~\321\313\312"
+	.ascii	"\200\236\335\265\020\257\345\220\034 \251\212@Hf\226\323h\331"
+	.ascii	"\364\262\247\017\207\244\027P\f\006\" `\002!\202\326\003r\250"
+	.ascii	"\361\020h\204\020~d\227U\233X\017Gho\260\246\351\247U\355\213"
+	.ascii	"\03088\271\271\r*3^\215m\315\202\r\021+\236\\\354\030h\200\026"
+	.ascii	"\016\224\215\307\020\212\323\022\336\344c\373\006\320U\300\b"
+	.ascii	"\322\351\002\333\273\255\256\327\206="
+	.text
+	.section	.gnu.lto_IOHi.15.640ebd498ca163fb,"e",@progbits
+	.string	"(\265/\375`\025\001\025\r"
+	.string	"6\330VB\020\221\223\016\033]P5\177t\031`\350\215`\233XSB\007\330w\271\347~\317\223#P\340\306>\265\315\343\210\353|\304\303\321\300\264."
+	.string	""
+	.string	""
+	.string	"\312!\"\0048\365\016"
+	.string	"Z<\375\316\027\322\366&R\246\024C"
+	.string	"A"
+	.string	"E"
+	.string	"\027"
+	.string	"\377\252\003\200\177\326l\032\347F\373nFBgcw\243\202\270vJS\363;\266\b\2470\\)\003'&\300l\266\020e\275\310\2308\313\223\302&\312\324\204\354\256\363d\273p\277\333>`\233\200}\016\001\357\244_\251\364\253M\211\030Qf\327\302\t\307\302x.F\370.\357H\3169g\220\330O\361R\3119kPL\326\237]b[\177i\331~\332G\361\025\355$\223svSF-v\271\002\366\250\376\314\005\t\276\342\202\372\356\234\027\033^\262\202\277\214T\273\"\020_\005\004\314\027\321"
+	.string	"\376=}\351\031\242\202\207\016+$P\236\364\003\t\227\030\265\tT\325\220\341\324\022#\312\0336\027JU\261O\355\356ZSl\230\206/\035\330\225\356|`W\374d\236\007W\206 .\270DFb'\373\304\217\001\306\030x\262\350"
+	.string	"\303\262hq\240\207\2004D\251\212\332\"g\321\251v\027\304\207\311<\001F\273\373\201\1779sR\343\351\365,\367@1\265\3100\345\350\034\033"
+	.ascii	"2\003\302\260\330\302\306,\020\240\355\3601\333\2700\\\315P\340"
+	.ascii	"*F5\367\264Y\214Y\001\b<\032B\212 \003+\244p\rTBh\240B\021\212"
+	.ascii	"\206\316 A\303`!R\263\272\"\256\345\247\304\233R\250="
+	.text
+	.section	.gnu.lto_IOLo.16.640ebd498ca163fb,"e",@progbits
+	.string	"(\265/\375`\025\001\035\r"
+	.string	"6\030WC"
+	.string	"\2216\035;\331 /\006|m\224?\317\244\240\256\352\327!\331\343J\356\t\275\370\261\212\215\2671\333\363\031E\300\r,N\353"
+	.string	"\306>\250\252\252\032o\030]D\200\224\373\277s\314\303\030\235\330\335M\312\224\002C"
+	.string	"A"
+	.string	"E"
+	.ascii	"\027\020\017\253\003\210\207\336\354\032\367J{\026\016\023>\034"
+	.ascii	"\273"
+	.string	"{\251\210o\24747\337\243\223p*\303\2252\200\202\202\313\246\343(\253E\346\304S\236\025:R\246\346cw\235%\035\206\033\3366\002\333\004\354{\b\360\246_\251\364\253M\214\031\007`v/\314\350X\031\360E\t\177\345\237\310='\r\021\373*~\032\271g\r\367b\035\332#\266u\230\226\355\247\375\024G\331n\"9g\327\244\344b\327+\340Nuh/\n\316\002\213\372\357\034\030\033~\362\202\267\204T\273\244\217\277\"B\346\223p\020\017\241\376\364\034a\001\304\007\024\323(g4\204\211\225\0305IT\325\320AF%\206\2249l\217K=\261O\355\356ZM\354\230\2160\035\031\226\006y2\354\022i!\b\230\226\340b\200\201\204\\ Mty\0068k\020\322\256\007Y\246]\2267\372\307H9JO\324\006y\013P\265\273\037\337E\013\005(\355\256(\036\346\215\022\033P\257Oy\207{Q\201a\331\3619\033"
+	.ascii	"2\003\302\260\330\302\306,\020\240\355\3601\333\2700\\\315P\340"
+	.ascii	"*F5\367\264Y\214Y\001\b<\032B\212 \003+\244p\rTBh\240B\021\212"
+	.ascii	"\206\316 A\303`!R\263\272\"\256\345\247\304\233R\250="
+	.text
+	.section	.gnu.lto_IOToggle.17.640ebd498ca163fb,"e",@progbits
+	.string	"(\265/\375`\f\002=\022"
+	.string	"&\242xH\340\360&\035\"m\r\232\353s\335\003z3brZp\260\333\304\375\025dy\">\020>\302\373\2246\305E\\F\243\036\002\307\307\345\303Q\236\007\bc\2141\276\206`\brB\020\031\242\345\3010\235b#\204l\"wJ\001b"
+	.string	"]"
+	.string	"g"
+	.string	"\254\307^\376\261k\263\323bWl`\005\336\247\305\023\340>\275\013\340>\315\262\233.\346\354\307\036\227\320\215\335\005\025\347\254ssS\311\362a\316u\274B|\202\370\346\361\302\260\201\354\356\367\222\221\2729H\221\201\310\343\325\332>\232\215\023\237]\322\274f\244\354Fv\327R\303\353\303\335\3356\211\355\020[\246\004\322\035(N\332\273,\366\317\313n\235\322rJ\037"
+	.ascii	"\002\236P\004\216\nU\022\267\303Smc\314#\023\227\375\366\375"
+	.ascii	"\025\247\261<\310\007\302Z\350\303b_\350C\366\347\226\007\271"
+	.ascii	"\300\322\247\335b\177\237\3623\177\266x \326e.\036\214\007o\034"
+	.ascii	"\177h\354\212\f>\275\300\373\004\331.\355\373\034\026\362\351"
+	.ascii	"G.\"\276\021\205\022owS\270\317\313\235\260\026\302b4\233\274"
+	.ascii	"hB\207\236v\251\263a)\204\305<\355\022$\301\230)\2159>\344\324"
+	.ascii	"\211N\274]\031\021\237\305\n\212\277\243\322\017]\352p\030\021"
+	.ascii	"\302b1\362IK\360\0041\251\336\370\205\233\372\331?\200\232d8"
+	.ascii	"%1\311H\034\266\330\222zc\177\333\335\265\332\330]'*$(\233*%"
+	.ascii	"]\022\242J\201*+\223\013\251\225\004\260B\212\004\005,Y\251\200"
+	.ascii	"!\006\254\262`\262\002WT\252\025\370\2111\337Vm<\022\243-No\334"
+	.ascii	"-\271\306\r\245\335\370\343*\322NUilU\033\302]\f\310\231N5zj"
+	.ascii	"f\200\033\211\353\024\245\017b\343L\255u\243\027$Pl.\234\324"
+	.ascii	"\b\263\031\235^\245*\222\253\246\025( P\002Q\346\3566b\350[b"
+	.ascii	"\374s\311L\332N\336\340\230\231v\2548\267\232a\360\265!Q\374"
+	.ascii	"\025\211Q\003:5\372a\274\312\356N\265\r\312f\274\215kf\327\311"
+	.ascii	"L\241\333\2113f\274a\2340p\264\200\343p@\322\200\207\n>\374y"
+	.ascii	"\224\033cxE^\247\002xI\221.\270\275Ku\275v\356\001"
+	.text
+	.section	.gnu.lto_IOInit.18.640ebd498ca163fb,"e",@progbits
+	.string	"(\265/\375`\353"
+	.string	"=\f"
+	.string	"\326\325QF\020\255(\0355.C\276\255K\006"
+	.string	"\321\304\247\351\377h8W\232\371\231\236\036{\343\\\261Cj\337n\375\031\266\225\207\240\250D\243C\036\307^"
+	.string	""
+	.string	""
+	.string	"F~ Du\225/8Q@\234\031v\361\b\211d\357\275S\n="
+	.string	"="
+	.string	"@"
+	.string	"\257\016\355\022\037U\373\227\t\001.\024\273\313\315\007\017O\247\f}\f1\300)\202OjRa@\007\r\321D5\260\023\024\356\272, \236\244\264\350\354\256%\001\361\300]o;\3056\307\376J!*\b\t\266\257\261M\245]\302\t\337\022y\356. A\"\307g\b\317\032\371b\267\201\007\221\355\025\204^\332\277p\f\341W\244s\354\246 |\330\035G\034\262\275z\274\207\366\272\275C\013\033"
+	.string	"\2042T\273\373\b0\332kE\311R((\311\331DMh\305\246I\232\234\t\030\214\320\020;I\025\366h\222\323\201}\272\273\353\231\262\337\372\265\263~\372\325/\267\r\231\b\224\327\256\201\331\212\r3\335\007\344U\260\003\311|\365\363\244=\233\317\343B`\027\343\201\037\016\344\251\260p\0360\304m>\374\265t \367\362} \247\031K\357\224\246\211j\323\376\316A4\263@\247\355r\330h\333\335\023?\031"
+	.string	"2\003\302\260\311\302\326\021\210`{\301\320\362Q\023"
+	.ascii	"\3035\225\3613A\301\301\243&\2400\222\260l\032\327\200\3720\030"
+	.ascii	"\346\222\020,\b\237\251QpY\232\032-\356\362S\355M\321\324\036"
+	.text
+	.section	.gnu.lto_IORelease.19.640ebd498ca163fb,"e",@progbits
+	.string	"(\265/\375`o"
+	.string	"\235\t"
+	.string	"\246\321A:0\221\322\001 `1\024]\200V\306N\270\016\211\371\361\326\363y/\230B\205\006\245\373Z\305fS\274\306@L\2105\036\006\016\221\316Qx\365\0209\324(\230M<\331d\357\224\0020"
+	.string	"0"
+	.string	"1"
+	.string	"\273[\247\311\301kS\202~@\270qm\344ScP\351\220\031\bO\232\347\025Ky\313%H\210\222\022"
+	.string	"\264\273\226\037\241\310Mo\333\301\266\202\355X5\273!\263\235\265\2414+\217\355K\373+g\001\337*\235`WD\231\331\035\027\234\300\235z\374\301v\312\335`;5h\343|T\355_\036\0340\262\252\335\375\311\251\257\261\235R1F\226c\222\263Y\302z\201M\22769I\304\225\013\206\222:\366x\2223e_\333\335\365\024\355\267~I\013X7\017\001^'\035\372x]\035}\242\213\356\213\250\023\035\204D\r}\243\372A\260G!\372j\205\347}\3253\232\0162\315\2236S\244\315\266\270\213\304\355n\203\357\222\201!\020\020"
+	.ascii	"2\003\3020\301\302N\021\210\030;\002\204V\200\300\243!\214\b"
+	.ascii	"\2623!\025\314\273\004\320\254\246\210\273\374T{S4\265\007"
+	.text
+	.section	.gnu.lto_IOGetOwner.20.640ebd498ca163fb,"e",@progbits
+	.string	"(\265/\375`\233"
+	.string	"\r\013"
+	.string	"fTLC\020\217(\035\200\351\006H!\245\001\235%\346/_\367.\304\271\361\322\037l\006`\267\201\372vO\315m`[\335\200\317\002\352E\261M"
+	.string	"\214\200 i\252\003\004\310\237\202r0\020E\017\263H\t\"{\313\235R9"
+	.string	"8"
+	.string	":"
+	.string	"\227{\\\227\361\035\327\245Nx\367\250\260\363\017<\236\204"
+	.string	"!\362H\3278\242!\201\b\r\017\024-*\025\031~:\034y!\b/2\273k(\362\030\334\362\266Kl\207\330\277\004&&v\027\264Z\354\t\271\272`\373\266=\266\3056\204\366M\367\340\371\354|c\367S\215\330\235\"\006\301.=1\333>\207w\360\270\213\223\202\227Q\001\002\202\324\212\335\231\005\234\247\004`\273!\022\037e\200"
+	.string	"\266\273\267p\351\027PI\"\261\301\364\201-\225\200\001\305Rw.\250\017\276\024\037X!\310\302\236 \250%\373q\365s\374\374\241\241/9V(\002\233\006\255\301lZ\306\3416\0034.%[\321PT2\r\307\3110\037\336"
+	.string	"l\270,\300\266q\231e~\036W?\277\344@\201F\375\351\030\021\032\224\200~w]G\352\314GAQK\016\021"
+	.ascii	"A\204n\211\030U\004\370\205\315i\265\3413&A\303\243+\234X25+"
+	.ascii	"\271\220\003\215\341\321\224\035\320\004 %\240T5\320\\\n\n"
+	.text
+	.section	.gnu.lto_IOInitGlobal.24.640ebd498ca163fb,"e",@progbits
+	.string	"(\265/\375`\244"
+	.string	"=\n"
+	.string	"\306RD9@\217\322\001@\303I* "
+	.string	"\375\017\223\034\213\225\007g\377b\345\033\254`0\336\373LW\373\2715[\026\323\251\255\243\237a@\360\250n7\2721n)\362\236H#{\357\235R2"
+	.string	"4"
+	.string	"2"
+	.string	"~\346\343z\301\214$\024K\257t\263\273"
+	.string	"\"\004\335H\224x\222\024v\031b\244>?\376\340D$\024S\227\231\317\356Z\206b\305\255\335vg\273c\237\006\325\347x\007\370\027g+Ql\261\024\211\225\335\261\363j\203\355us\001\355\225>@{\275\306\240\255\362\321b\037\002\023\001\322\262\273\334d\201\246\023|\245S\202\001\023\305\321>c-\326\307\354A\272\320\335]\3729W\366x\222rwK\236*\373\257\373\225\240e\222\300\262;\021\363\262\262:r\361\327\355\303\276\341\217\326<\244\317\023Q\203<^\307\215\276\220C\367-p\r\235\002\003\007\372F\234g\300\236(\364q$\317\3738\315h\372T\271\276\225d\310L\363\344:WF@\231?G\253\032\362\036\177\025"
+	.string	"2\003\3769\006\324\201\030QX\037C\354&8\270\222i/\314b`\256\\\356\351F\202\320'\270U^\204"
+	.ascii	"r\203[e\247e?G\2119\274s\315'"
+	.text
+	.section	.gnu.lto_IOGetByTag.25.640ebd498ca163fb,"e",@progbits
+	.string	"(\265/\375 \357\205\006"
+	.string	"\242\314-3Pm\222\016$\313\316hJs=\250\020'`."
+	.string	"8\354\300:\243\310\301n\013`Y,\025\336\223\37533\323\334\351\"\255\210Y7\244\306\263\243ml\"S\r\032\017\276\311TT\3538N\004\345\030\332\003\245qh\033\327i\031\314\025\004\3075OU\271vy\331kb8\361\357\303p\343\013\220\250\361\025\265\305\226\214RP\250\223L\213\025\2254\221H<~\353/?\262OP\260*\222\03033>F\231\017a\003K\245\377\2024\304\372\302\274\216PG0(DR2_\373\225`\252d\351\300T\t9z\225]W"
+	.string	"\364)\013X\310\314Y\005(\324\261\177\301\177\360_\004\b"
+	.ascii	"2\003\202a\243\302v\025\216k\270\005\013\207\334\020\346^%\017"
+	.text
+	.section	.gnu.lto_.symbol_nodes.640ebd498ca163fb,"e",@progbits
+	.string	"(\265/\375`4\001\255\005"
+	.string	"\322\007\036(\200k:&2K\200l0\216\3304(G\3421\022#1\220\264m\333\266\271\216Y7\221\300\300\261m\263nB\233l)S\256(\230_BQ\210\343\301&h\333\356F\231s\211\321h;?\357\222E\3137\335]\257r\215\362k\362\204\344\210\310\017\220\033\036/t'8>h\\\300x`q"
+	.string	"wk{\245\235\312>a\217\212K\233\375\330\267A\235\224vw\257C\265\255\232\032"
+	.ascii	"\240\b\256]T\030\346\257\306p\356\2610\272\274h\007\220\b>\007"
+	.ascii	">\007>\007>\007>\007>\007>\007>\007>\007>\007>\007>\007>\007"
+	.ascii	">\007>\007>\007\336\265\355\304\003"
+	.text
+	.section	.gnu.lto_.refs.640ebd498ca163fb,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.640ebd498ca163fb,"e",@progbits
+	.string	"(\265/\375`\251\023\265Y"
+	.string	"*\224\300 S0PJJ\007\356y\272\252\257\372\357\363\333\335{\314\370\317\017\251\200\374\273\276\363\374\300T\240\220\tw\323I\365\352\375m\227\256\305\036L\345N'\255\022%<\307\356\244eh\354\331?"
+	.string	"\256\013\262z\206\254,g\347\363K?\013\226\377\37781R\362\267L\001\241\001\366\001\027\002"
+	.string	"\254|\345\346\315\231\344\310U\357\002[\271\n\026\325\361-\177hA\273\352U`\177\316\201\215]\336%\031r\325\237\331~~\302\\\274\346s6E\233\254\273\365\331A\263\206\252\353\252\254\366cL\323\205\345\252'\201={E\251\233\302T8\215\317X\312h?\227\261\331\325\266\373\254\273\317\\\255\035wI\341\261\235fO7\205\210\321\352n\377\300/tFc2\036\013\241\243\273j\n\247\255).\017\257\2735\361c\302\204\t\326M\354\fz\243^\005\313\315 \326\236!\366B,\1771\030K\201X\354\f\205\275n\323l[\332\335\362\330\310\231\tBv\325\003\261\377\303\316\323\245\207\016d\317@+\017\003\255\277\354\b\006\261\252S\006\261\276e\020+\313"
+	.string	"\254\352\177}\234\377\353\324\"\207\232\257\377}\341\277\335\3770\267\371o\013hb\307\377gC%$\360\236\377\"\375\237R\364\017\377\035JY\363\371/\007\032\220\260\340;\377\255\340\347\020@H\240\304u\376;A\b\025\307\371\357P\321\377\017~\363_\241\377`\276E\201\377b\200\377=\300\367_\002~\376\340\347\030?o\3603\006?_\360s\213\237)\370y\202\237#\370y\350\347\007~\016\372\331\304\317\t\374L\342\347\021?\033\360s\210\237\013\370\371\347\347"
+	.ascii	"~\356\3719\347?\232\377b\377\325\376\223\371\331\367\377\313"
+	.ascii	"\377+?\363\377\275\377j\376\367\360?\315\177\274\377<\374?\363"
+	.ascii	"\177\355\377\335\1773\377\313\374g\373\277\300\377,\377A\354"
+	.ascii	"\355\355\355\375\252\363\277/~\035\263\3356w\263\nz\202\263\215"
+	.ascii	">\235mT\331\323\315\250\262\273\205\3668\311\226JvJ\253\240N"
+	.ascii	"i\024\352\323\315V\266t9\003\333\214B\235oQh\217S\272\204:\233"
+	.ascii	"UP\037\031\260\206\344\351\350\001\254\213up6{\207\323\324\362"
+	.ascii	"\3313u\266\321\246\353f2\034\375$\321=\025}\322-\201p\032s\272"
+	.ascii	"\203y\266\214\022\340\304\264\212vs\352\\\022\355^\302\244\321"
+	.ascii	"N\020(\333i\023\341\251\362j\252\233pt\027\340\324\255\344\236"
+	.ascii	"v\267\262\273\201\317\251\266;\252\307\251\345\344\324\r\365"
+	.ascii	"\343\324SJ5\034\335\227\354K\032\324)\265\212\n\251\215I\265"
+	.ascii	":G\253d\255\246\253z\262R\345W7u7\233a\265\240<\312\334\313T"
+	.ascii	"\177h\021rD\216mux\310\3415\275\352\355\313{W\371\333\274&\247"
+	.ascii	"y[\355^2\037\260\303|\300\257J\3262lU\317S\366,}\035\253\271"
+	.ascii	"\235Z\303\333\217\256,m\213\223FU\326\243\345\271\2467\2534\""
+	.ascii	"x\332\037NWx<\344pi:#\273*\231\237_\2253#dh\254\374\302\334\266"
+	.ascii	"\226g\200t\322\3101\233\334\225h\262I\3412S\006\270E\303\220"
+	.ascii	"\350U\311\264\315\234)\312$A\330X;\2362\\\b\246\023\206\025("
+	.ascii	"c~\007\206\330\216\347\030\fO\241$\330*\023\303u\034\206\307"
+	.ascii	"\260\224\355x\207s\034\313\375\247\355nv\267\035W\3416\236\222"
+	.ascii	"\271p#\033\323\335\262\035ga.;\313\266\237\022x1\271\361\304"
+	.ascii	" \205C\330\215\312t\354\205\245\"\370\313\035\030\272O\t\326"
+	.ascii	"\\:k\234\254\311\313b\317\"V\336c\021\353y\b\313?,\003\\\027"
+	.ascii	"\037\232\232 L\254\206\223F\252EuU)\353\360\267\335\315;\222"
+	.ascii	"\334\310\022\305\362\033kai\t\336r\306\302n\377-\333no\rzeaW"
+	.ascii	"=C\331s\211\325\267\267\307%\326\263\023\333\303 \326\313\001"
+	.ascii	"Wo\210\211\3351vJ\321{\272\303[o\274A1\273\352\035\353\262\344"
+	.ascii	"\210\031\336\327\327\r\373`F$j\214\216\225\255\2549\260\3370"
+	.ascii	"nS@J\024J\235\227\227\027\035\352\0264\275#pN\234\334\25691O"
+	.ascii	"wMr\260\324\260\\q\375v\331\250!\262\f\273\352}\302z7p@\270\364"
+	.ascii	"U\357\026\267\371\350\200|\251\001\363\263B\023\006\355\215\t"
+	.ascii	"\023'7fyqX\330n\270\341*a\347\244x\262\262d\240\242\222$\311"
+	.ascii	"U\302P\355\213\323{\272k\262ji\253/\033~\225\340\240Ya\335(3"
+	.ascii	"b\344\"a\305\334\236\356\360\270\r\007\275(G~\221\334\016\312"
+	.ascii	"\265\\r\325\233\305\223\207\005\211\221\3339KOlT_XX\267\b\214"
+	.ascii	"f!P\236\356\360\200u60\311\021\371-r\373f\t.\212\223o\353\352"
+	.ascii	"\352\322p\273\307\304\242\306\\)\267\265+B~i\030\363\261]\221"
+	.ascii	"\213\312\252\252\212k\002\216\2751\r\221\212F\3678\214\363\316"
+	.ascii	"\307U\357\323AEu\241`(\305\374\240k|\254\345MMy\301aV\031\003"
+	.ascii	"B\027\025u\241`\3644\023\356MK\247l\tS\227\332\217\037\027\312"
+	.ascii	"\246\237\335P\023X\235]7.zH\200\374B\275\n\317\345\255q\003{"
+	.ascii	"z\272=\306\302\272|;\220li\036\277=\270\360\220\371\302e\371"
+	.ascii	"d\307\216\373\374\320\321n-`\0248$c\032\n\n\350G\306\307\231"
+	.ascii	"%\030~\237\f\207\003\246\006}\242\204\375\275qq\344\270M\254"
+	.ascii	"\262[\3316\fkX\221\247;\274\206\232\002\332i\342%\210\223\363"
+	.ascii	"\267\3512\345tsuw\210\3374M\332\326e\272KNGz\340\"\003<\343$"
+	.ascii	"\016\206\253\203w\370\271\351\240\202u\325\237a=\233\034K{UW"
+	.ascii	"\375\345\301\376\376k/\237\335\375\364k\373\311\314Y\177>\377"
+	.ascii	"\230\201~\035\3661\211n\004\350\272\257\260\356X%"
+	.string	"hK\251\217\3507\351V\372t\333O\247\264J\351\024\353\002\365i{\206\001Zz\325\316\266\n\252F\373\006*\034\2214\222G#p\004#b\222\232T2\036\217~,$\035\r\215\305dR\021\005\021\206C\235\022\216\216I-\210\310c\013\023\210I\245\025d\360(\255HFE+\260H2\022\341\230\364\"'I|!\f\336\020\225\214\210I6\311\2421\230\204\204t,\022\006\331c\006\302\240Z\204!\f\252\304d\021\331\2010\b\234aD$\022\006W\242\261\230A\216\217\261\350ccF\320X\324\371 c\030,\362\300\202\2410(\200\215\031\301$\362\030c\307X\2141\024\006\201?:\361sD$\032\n\203\353\217\212H\242\221\210\304\036\002\024\f\240Ha\003\370\024+\032X\321\300\372\024+\204\204V\240\020b\217B\310\227\034\"\031\025\035\213\300\244\343\221\305\360\227\034\n\203j\3624N$\3250\2418\024\221\034\246"
+	.string	"\332 \3160\026\177J\303#\"\321\261\b<\026k \251\311!\n!c\261\206\2178\024\022\217\220(\034\225\210H\036$\321\250\302\3617\002\321\005\261\306\nECa0\306\213\234\3238\221AQPFP\222\210\2044J\216\370\261\006\021\031\224<\036\221A8DD,|D.\202>\"\027B_r\350\300\003Ic\021\005\366*T\264\030\301\301\006/\330\243\023\307b\220\022\222\230B\0219#\310X42!\350\b\251\024tb"
+	.ascii	"\"\"\031,\324\267\276%-\2752on\3113rS\256z\327~\333\326\256\233"
+	.ascii	"\372\326\315l\240e\322\265s\nH'\n\036\236\036\226_7\365)*m\240"
+	.ascii	"\24514\314\253^+\277W~\033\340\\\\\026\260\226\2759\374V\221"
+	.ascii	"\342\001f\311\0236\254\267-en`\257"
+	.ascii	"\016I\223\3364\036S\233mCW\261&8l\300\353g\333\002>YS&@\330\377"
+	.ascii	"\236I\357\331\245\322\263\364\274\240\006\2741\375\204Z`\305"
+	.ascii	"AM\035\223\253\376R9\363\220\023\035`\225\352\002E\311U\205\204"
+	.ascii	"~\247\034\200\365\t\3256\017{\345}]y\222\221]\263\272)-_UW\221"
+	.ascii	"\262[\366k\306z;=\236F\2744\327\2712F\256\256\032\201\225\250"
+	.ascii	"\321,E\030E\"\"\"\"\"I\222\244\003a\005\204 \007\235\323:\022"
+	.ascii	"@5%R\034\205d\204&hRV\245\036\303\001t/\276=\373\221\001\207"
+	.ascii	"`$\323\"\347<\256\001o\365\244\017\340.\216\253\250\226\247\022"
+	.ascii	"(<L$\f\366\244]%\366t\211\fP\260zS\216q\345k% \354\260\240\034"
+	.ascii	"\2018\275H()\346\td\007vqk\330\324\"\346\300q\2721\367\352g\016"
+	.ascii	"\230^\017c[\277dH@$k\206DE\252\002\251\231\002\030 \311\224\347"
+	.ascii	"\034\244\247\361\321\273\243^\302\035U)\201\2321\201\244\266"
+	.ascii	"\035/\352}\326,\256\b\217/F\3039\266\240\303O\300\2776.I\002"
+	.ascii	"\203\252<u+y\200$\333,\301\371\260R\340\034\346|U\237\361\313"
+	.ascii	"+`\307\326\022K\257\333\3665\313@\030d\302\027<\016\"d\334r\362"
+	.ascii	"g\211\027\321\207*\220\262\023\200j\362\021\327\361\333\031\007"
+	.ascii	"\336\221\na%\262\224\002u7\302\204\177\252\262A\274cXy\233\322"
+	.ascii	"\203 \212\360\264\205\204\321\343\325\036DR\036\343;\242\244"
+	.ascii	"\024f\312/\211^w\037}8\017\361Z\n\314\264\212\320\236y1F\377"
+	.ascii	"\214Z9\307\rN\353\205\215\245\375w\r\332xm\236vV\366\345\331"
+	.ascii	"F\327j\206\325\035\235\270\013\255\023\357,\340~;\217&\016H^"
+	.ascii	"0o@\343\224H\273\b\250\nY+\222\204D\346\273\302\203\022\3115"
+	.ascii	"S\352\220\232\\FD\316K\337\032\2446:}S\350$\203\223\334\025\273"
+	.ascii	"\031\210(\001Q%\ri\256~\032)\377\2543\323\272\237p\2039\245\346"
+	.ascii	"\024\327\203^\355E\022\023~\367\t\267\017\363\373\250e\306&\240"
+	.ascii	"Z\267\321\tj\001\31189\003F\263\343R\361/\331o\343\027\303\240"
+	.ascii	"\206\312\253\020\237\1778\374\3517Z(\304\327B\340\004\316\306"
+	.ascii	"\215\013\263\277\216D2\326\254\315\215\037\214p\367\032\330\313"
+	.ascii	"r\302\200\342\3679\024\tj\200\241\f\3744\306\270\361\243 \366"
+	.ascii	">\007\206\332N\331 Y\344\273H\0010Pfla\024\232K[\232d\271\034"
+	.ascii	"\335x\273\267\363\t\262\021\224\314dI\031\001\352w}\023A\276"
+	.ascii	"\177\373\271\005\334\206\370y/bQ\272\200,{\tg\271J\002\005\366"
+	.ascii	"\016`\007\366\372\204G\034\302r\307\2435Bp\357\362\036\374w\205"
+	.ascii	"C~\2459\356\307\343\333o\274\367\254\031\304\343a,\316\226\245"
+	.ascii	"#.\351'\256\217\332/\336\001MH.\f\273@\177\321/pp\006\026\\\332"
+	.ascii	"\321-\316\272bO \243\340\267\204C^\366g\2605yl\021\376\201\016"
+	.ascii	"\214~28\240\335C?l\315\372%Q\211~\340:\261\036&\267\264\300\376"
+	.ascii	"\221!\330\373\372bt\031\335\303\246\177\310\3706\3241x\364\273"
+	.ascii	"\365\267\344\220\321\217\234G6\316\311k\314\007=fC\332\336\210"
+	.ascii	"~c\360\263M\335s\372em\274Sr\007\356p\356J.\224\325h5?\f\247"
+	.ascii	"\n"
+	.text
+	.section	.gnu.lto_.symtab.640ebd498ca163fb,"e",@progbits
+	.string	"IO_Rec"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\001"
+	.string	""
+	.string	"IO_GPIO"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\001"
+	.string	""
+	.string	"IO_Pin"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\001"
+	.string	""
+	.string	"IO_GPIOPortIdx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\001"
+	.string	""
+	.string	"IO_EXTI_PortSourceGPIO"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\001"
+	.string	""
+	.string	"IO_GPIO_PortSource"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\001"
+	.string	""
+	.string	"IO_GPIOPinIdx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\001"
+	.string	""
+	.string	"IO_EXTI_PinSource"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \001"
+	.string	""
+	.string	"IO_GPIO_PinSource"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\001"
+	.string	""
+	.string	"IO_EXTI_Line"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\001"
+	.string	""
+	.string	"IORead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\001"
+	.string	""
+	.string	"IOWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\001"
+	.string	""
+	.string	"IOHi"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\001"
+	.string	""
+	.string	"IOLo"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\001"
+	.string	""
+	.string	"IOToggle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\001"
+	.string	""
+	.string	"IOInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\001"
+	.string	""
+	.string	"IORelease"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\001"
+	.string	""
+	.string	"IOGetOwner"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\001"
+	.string	""
+	.string	"IOInitGlobal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\001"
+	.string	""
+	.string	"IOGetByTag"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\001"
+	.string	""
+	.string	"ioRecs"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\030"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.640ebd498ca163fb,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,518 @@
+	.file	"light_led.c"
+	.section	.gnu.lto_.profile.b9dc2feef3d3a4a8,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.b9dc2feef3d3a4a8,"e",@progbits
+	.string	"(\265/\375 \202\r\003"
+	.string	"\244\004v"
+	.string	"\n"
+	.string	"\366\254\342\276\002\b\002"
+	.string	"\002\001\001\251\245\204\311\n\f\002"
+	.string	"\002\002\002"
+	.string	"\002\002\003\002\004\352\263\360\321\b\003\240\342\234\212\n\004\275\375\215\235\005\005\237\326\324\323\t\004\003\002\004\006\212\302\222\270\005\007\b\t\240\342\234\212\n"
+	.string	"\b"
+	.ascii	")\"\222:4U3\205\022kWZ\356\372;\2366\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.b9dc2feef3d3a4a8,"e",@progbits
+	.string	"(\265/\375 O\315\001"
+	.string	"D\002C"
+	.string	"\004"
+	.string	"\001\001\001\001\001\002\005\002"
+	.string	"\003\001\001"
+	.string	""
+	.string	"\004\001"
+	.string	"\001"
+	.string	"\001"
+	.string	"\001\005\002"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\b"
+	.ascii	"4\205\230*5)\013`\007:l\331\360\262\034\f\332"
+	.text
+	.section	.gnu.lto_.inline.b9dc2feef3d3a4a8,"e",@progbits
+	.string	"(\265/\375`D"
+	.string	"]\006"
+	.string	"rJ!)\200)I\007s)<\\\366`\346\2224e\n\252\253"
+	.string	"\200\213`Qk"
+	.string	"\273\213\313\2202$\362_h\355j\244\265\275\245L\001\237\236\231Z^\032\221^0pc\316\222\374\250d\003Q!\204(\250\t\264\371(\305\335\t\234\fPG\225wT9\250\t;=L\317\365\f0~z\372d\352\3556\330\224\303]\004\375\243*\036 $\0306A\235\224s\"t\201A!\2021\377{\235\3057\265>\235\272\273Co\323 \034"
+	.ascii	"G\233\001\207  \220\226\032\270n\213cR\234P\241\255\226@g\013"
+	.ascii	"6\210\341\2640\002wfh\201%$\205;\254\226\2351na\356\3439\256"
+	.ascii	"+\254\fa\275Tju\254O\231f\351\327eU\r\270\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.b9dc2feef3d3a4a8,"e",@progbits
+	.string	"(\265/\375 \274\005\003"
+	.string	"2\205\016\026\300%\035\377\277\013\370\375\177\377\365\377\277\006\255\031\327\366\336[&\031\344\023\320\263^\360-\243Kq\277t\036\366\303\372\\\365`4r\341\222W\"\234\310$\265\234\377\336<\211D\016"
+	.string	"0\013\300sI\341"
+	.ascii	"A\367\336\241\007XEN\370@i\200v\203\022\372y\001L\242!\223\274"
+	.ascii	"\r`\001"
+	.text
+	.section	.gnu.lto_.pureconst.b9dc2feef3d3a4a8,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\232\004\001\231\004\004\230\004\005\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.b9dc2feef3d3a4a8,"e",@progbits
+	.string	"(\265/\375 ou\002"
+	.string	"D\003c"
+	.string	"\004"
+	.string	"\001\270\006"
+	.string	"\001\002\t"
+	.string	"\001"
+	.string	""
+	.string	"\001\b   "
+	.string	"\001\001\024"
+	.string	""
+	.string	""
+	.string	"\002\002\n\002\013"
+	.string	"\001\002\f"
+	.string	"\004\001\274\001\005\002\274\006\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"9\203p\001n\350\n8HQ\267\374\264\244r\030\3058\260e\003X"
+	.text
+	.section	.gnu.lto_.lto.b9dc2feef3d3a4a8,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_statusLedConfig_Registry.11.b9dc2feef3d3a4a8,"e",@progbits
+	.string	"(\265/\375 \232m\004"
+	.string	"\364\007a"
+	.string	""
+	.string	""
+	.string	"-"
+	.string	"\005\001\212\001\202\200\200\374\342\303\235\210\021\001\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\304\007us\250\327\006uq"
+	.string	"\005\001\006'\001\004\371\003?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/drivers/light_led.c"
+	.string	"\004"
+	.ascii	")\"\301$:E\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_statusLedConfig.14.b9dc2feef3d3a4a8,"e",@progbits
+	.string	"(\265/\375`\322"
+	.string	"\345\n"
+	.string	"\266\323JD \251*\035\310\310$\254%\004\224"
+	.string	"[\361\277<q\357m\361\230X\230\275ZJX"
+	.string	"\274d\024,\177\303\030Qd\215\220c\304@$*C\001\200l \026\373Y\b\r\005F@\023\004&\322\202\250q#\262S\n4"
+	.string	"7"
+	.string	"8"
+	.string	"\035{4\247.\317\351N5\207\350NM\332\022$P\032\036\254\016\330v\267r-'?I\377\003\316\300j\245>3\032\273\353\311j\251\334\334mW\330\316\260?\n\335)ff[\211UP\315\233]\246&\307b\037\263\273k\316e_\366\317\fjE\343L\330M\271]X\b\264\001lc\373\323~\354\002\310\313P\177\330uE\250\355\226\001bg\207\234\201\b\340\t\276@\301\274\035t\247\237\227"
+	.string	"7p\333\235\323\020|`\266\237:\333\026/p\232x\355.\206=\362\031\211fw/N}\002%&\021/\227S\037\025\244od\0027D\036\207x\032A\243\350\340\220G\344\225:F\017\322W\252b\350\211|\241\250\232>\320G\r\205b\365P\030\004\361\302:\202`X7\345\036\263\234\313\265f\201\202\212;\261\037\022"
+	.ascii	"2\241\235/p<bd\227\305\241c^\361\004\006\353\252]\016\367\200"
+	.ascii	"q\257R\203_\347\371\230\320\n\346]\002hVS\302\035^\264\223\f"
+	.text
+	.section	.gnu.lto_ledInit.15.b9dc2feef3d3a4a8,"e",@progbits
+	.string	"(\265/\375`\355\002\205\026"
+	.string	"\226\351\220I\300\226M:%\337\346\341\027\220\214P\236\217kn{\214\357\343g\267\031\267\007FQ\255d\250\334\364\215j\034d\3676O\327\335\237v\310m\212l\356\222\030\377FC,\301\212|j\222\232S\357\0170>\204%\204\354-e\222\001}"
+	.string	"q"
+	.string	"}"
+	.string	"1.Cv\033\320\013t/\351\330\321}\223\321\031\360Soo\361>\301\033\360>U\246\312\304e(\300\256\310IJw\207\234B\371\362v\375Vv\360\363\246\344\225\351\277\232\246+(\261\033i\342A\311b\004\251&\035\254\021Mh?\027J\367\222>\001\320\222.%\214\223\247(\003hC\262\345\210\305\270B\233-?w\230\232\217\221\246\364\375j\272[w\244\215\270\246\256\252&T5\202*{\001.\357s{\214O\024\304u0\260{\366@_c\365\003\256\370\324\003q\312En\212-hw\2527q\231I\365\357\356V^RU\335\366\0138\356\232\222\253 \257~\273\352\355\352\224\253\222WyWwW\337\342\331\212\270\350\272\217vU\232\310\204jq\334U\177\323\347f\234\206\3548\355\001\212H\240\0167:\351\356\230O\205"
+	.ascii	"~\276\310\257\250\352W\365\001\267\340IV\275\200a?\352\013\021"
+	.ascii	"\213\352\361\307_\362\357x\223=>\321\t\241\335i\212'\377E\255"
+	.ascii	"IQ\224d\0366*$\335M\243\177:T\006\325ps\263\204e\231Uqr\366\243"
+	.ascii	"\344\227\031\213\272\314\274\241v\244(J\243\204\220\210!Y\336"
+	.ascii	"\362\013\227d\266Tx\236\203\265@E\367\214FU\3478Z\237\bT,?w\006"
+	.ascii	"3\234\246@qw\213\314"
+	.string	"L\254\267\361\033;\372\025\332\343\332\217\001\255\353\264:\370\270$\254X\024`?1\234\030\214\200\346\314\254X<\034b\036tZ<!\354\305\n\321z\255B\237\026NO\230\363\202\2053\t\324\365\201\365\nc.\327+\\\271\365y\251\351`\215&\"A,\0042\223~A<\025s\222\215y\212\215d\236\342\333.\273\273\277\006O\261\212E\324|\254\027~\210\215\n\211\220\371\204\003\006\224\025Q(q\232\0076\346 \253N\2500\304\242\002\261\001\177\200|]\t(\227\375x\006< `\002\031:\254\007\342\200\377c\360\355q2\310.XM\251o\253\004\312\351\354\336\032\305:\327\034\267\364eM\345\353\203]\244\017\035q\325\306woi\220\240K\206\313\005\3041\261\326U\253\324\213\346\024\330\273\tc@p}\213\242u\373lq5\254Y\340\354\214\270\023\247#VJpl\267Bf\305\350\355g\235\345\r\001]\3305"
+	.ascii	"\025\341\335Y6\326\254h\367Zf\b\320\266AK\324\352!FI\007\331"
+	.ascii	"T\343\373Z\247}O"
+	.text
+	.section	.gnu.lto_ledToggle.16.b9dc2feef3d3a4a8,"e",@progbits
+	.string	"(\265/\375`="
+	.string	"\245\b"
+	.string	"v\221>8@\345\2501\340\275~\306\037\021x\317\236\002\030\0333q(\024e\007P\350r\021\204\314\357\007\2547\230J\363\263\tvO\237EC\330\251\261\247\336\207\267\236E[n)S\n,"
+	.string	"-"
+	.string	"-"
+	.string	"\022\263@fY\257\205\261*\344^\211l\244\304\374\237\021\304\236\241W\333\304\332g\"\031\006(\374/\374L\035nt[\203\266\bm]\002\177\343\251u\312\216\020\3262cy!X\3719^\001\356\222\254\021M[\303\326$.\361\234j\253\332\357\201R\371\177PN\306r\343\201\314\001\034\005\364\327\215F$\265-\206W\241\314\377\204\372\304(\0255\312\262\027#\350\317\262\036e\226\216\f-"
+	.string	"\254\022|\265*\022\214\037\255\261?\236\r\024\333\341x6P\203\b\342\341\003\232\241n\263\370t\236)\361q\210\230\235.49\005\345&\266n\2128\256\233\032\325\215=\236\272\320\342*\305\214j\320\261\r\b"
+	.ascii	"3\241\303/F\361\031L\300\250KX\315j4\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_ledSet.17.b9dc2feef3d3a4a8,"e",@progbits
+	.string	"(\265/\375`\250\001]\020"
+	.string	"fapD"
+	.string	"\317&\035?\252\203\335\373\341\302O\r\203\360x\374\361m\f\007\330\204\216\374k\305\346\31050o\272\265\374\363)\232k\361"
+	.string	"G\306\243\375\337\376u\246\b\217,\361=\203U"
+	.string	"\206\351\327\210\032\221F\366\2262\245Y"
+	.string	"X"
+	.string	"^"
+	.string	"\217~\332\257\371\b\324m\254\302\332\356\006\0209\273\353\341\217\354q\364\001\330#|"
+	.string	"\354\321(\373\305\275\017\373W\b\026\216\317\356n\352\341\250G\250\211\362A\"Z\313\225zt9\f\271\\\256"
+	.ascii	"\\+p\264\273\177=Y\\\253L\220\310\356:[\256\f7v\333\fl'\260S"
+	.ascii	"\024pw\327*c\337\373E\277\2717n\363\207\236\326b:{\032\224i\354"
+	.ascii	"\351\3704|Za:"
+	.string	"\237>\207\210E\214\006\0164\312\343m\313\367\263;Q\207\3467\277\375\277\254a\373\206\302(\345m\213\002\030\257\306g\327\353xt\210ABP\367T\b\034FN\315\212]\317\303 Y1SMG\225\037\214\230\202\364\230z\260tV\371%\334\320\250\260\347\271\273)\275\n&\322\210\201\347\345b%c\270\343P7\3642X)T\257P\317zY\345\347T\325\263f\250\216s\022&\177\306\023N\371\326\t{L5\320\342E\225\237Cz\340\327\n0%.\374\254\362\263\275Tj\007\373\001$\016\245\343RNJ\331\211)I\\\211z\344\203\304\2254@y@R*\331N\035\227R\352H\333I\311\201\3116\322\235\266\217\0026I\340\272\r\305d\3526\ro\017We\234\020\244\002D\304hTMY\026\364\354\250te\216\3244S{\204\313\267<\262\240)\bGA\222\355.\002\337\304O\224\374\231GG01\301\036\034"
+	.ascii	"@\205\006D\304\nh\214\177\004\241\262Lu\246\204R\247K[X\2028"
+	.ascii	"P\327\347*\301}a\013\217\005d\315\2160\367\226\272j\246Y\336"
+	.ascii	"\271\320\324\241mE!\377\264\373=\033\fN<0\312S5\206:\275\265"
+	.ascii	"\245\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.b9dc2feef3d3a4a8,"e",@progbits
+	.string	"(\265/\375`e"
+	.string	"\365\005"
+	.string	"\262\210!*\200k:&I\225Jx\340\203\201"
+	.string	"0\365\210\250\361\353\3370z`d\216\261\302\266\005\016\353&\"\"\"\"\201!vo\271e\n\217\302j\356Bn\204\031\350\002>\222\256r\364 \317E3\351\"\270;0g\340\254\300\232v\367\237\b\021x\323.\316\203\234`\036\334\002\363\237|\222\310\303s|\f\017\242\270\206\025M\222\031c\215\361\025\257i\356\257a[\324l\255\330\212\224M\346\347\277cQ\331\335Mq\025\377k#\027"
+	.string	"\024;\b\323\312\004\f\315eP\240\036"
+	.string	"\034"
+	.string	"\034>@L\\\232z\202\341\362c\231\f\241\321B0"
+	.ascii	"\n\020\006\206[\004IX0A;\240\f\230s\255\211\007"
+	.text
+	.section	.gnu.lto_.refs.b9dc2feef3d3a4a8,"e",@progbits
+	.string	"(\265/\375 /y\001"
+	.string	"+"
+	.string	""
+	.string	""
+	.string	"\004\001\001\002\002"
+	.string	"\001\003\007"
+	.string	""
+	.string	"\003\f"
+	.string	"\001\003\016"
+	.string	"\001\004"
+	.string	"\003\001"
+	.string	"\002\005"
+	.string	"\002\002"
+	.string	""
+	.string	"\003\013"
+	.string	"\003\006\002\007\002\b\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.b9dc2feef3d3a4a8,"e",@progbits
+	.string	"(\265/\375`\217\021]Y"
+	.ascii	"\312\233\030\"S@P\312I\007\251\365\026/\037\f\214 \221\311\304"
+	.ascii	"\304\\\265"
+	.string	"\216]FXxU\325)\210\n\271'\240\343]\223\352\026\313\252\267&\200}@t\033gT\324v\321\215H\365\001\3314f\202\356\323\240lww\273q\203\n\366\001:\324\266\034\315\356K\266\337V\312\024\310\001\n\002\016\002\276\347\363\371\\\241\336\306\361r\331.\337\270u\362<m\\\355>\356\216\360\331\035q\263&\303\361I\257~\227h\312SU5d\t\367fG\346Ise[-\353\306\263\364\241\3159\303\232\247\333\266\227\031\342\266c\254\007\272A\353\241w:6\222!a\303re\257|\\\331\245\373\343\313\031/\\\377][+\225\211\233\027\031\256U\202x\250\262\330\212p\375\322@\277\300O\244\266\351F\361\341u\037\231\204u\367\224\245\262\315U[)\337\263\275\341\233~\233\374D\277\002)Vmq\3304\020N\335>\262|\306\271\346\235\232\356\264DP\211\025\310/&=\264\236\035\224\354p\307\365\036\240\307"
+	.string	"\025\261\037z\225\005\372\215\362\257\223m\262f$t?u\267"
+	.ascii	"<6d\304|\341\272O\226\271\315\020\013\345\n\2448\317X\326b\335"
+	.ascii	"\251\257\356x\213\341\213\353\211\320\257\r\017\340\330)\236"
+	.ascii	"\203\376\271!zKF\364-\363\320KZ\245\355\343M\271\002\305\206"
+	.ascii	"+3\312[\017\275\240\3750\366/\223\025\013\301C\326X\266Yw\n\344"
+	.ascii	"KwPuq}\272\037z\350z\350\375\213\204\302\322\t??\347\374+BP\347"
+	.ascii	"_\r`\374\373\002x\267 \230\360\257\322\376\266\200\245\245\373"
+	.ascii	"\237\366\037\355?\224\377j\377\315\216\376\313\345\337\026\377"
+	.ascii	">\360\257\003\377\262\370\227\201\177\033\3707\2025\340\337\024"
+	.ascii	"\377\242\330\244\377\276\237\215\377\226\360\357\b\377\206\360"
+	.ascii	"\257\007\377\032\375{\301\277\024\374;\301\277\022\374[\377?"
+	.ascii	"\377\337\375_\363?\315\377:\267\377k\377\253\374\017\363\237"
+	.ascii	"\313\377\027\377\341\376\277\375\307\362\377\312\177+\377\305"
+	.ascii	"\376\203\370\337\366\277\367|>\237\377f\371\371\307\357\263\001"
+	.ascii	"\355\324\345+L\307.\307\223+v:?\001\200\205\226\206+\037\327"
+	.ascii	"\210\232\220\271\215\343\221\272Q\305\207\022\264M\233}v\325"
+	.ascii	">\t\002\001\0170\272\035\276O\276K#\305\310\327\252\0165&o`\350"
+	.ascii	"\277w\315\275\333\267\033d]2V\327\311\244\211\263\020\364\253"
+	.ascii	"\303\356\232\346\256\331\264M\273j\203&\311\324\3049\013\375"
+	.ascii	"nZ\317\214\231M\203\246\005<\253\264$\341IA\241\275\241\371\246"
+	.ascii	"\331\3012\313\341i\327C'\206\303\323\356\214\357\2122\245\222"
+	.ascii	"\346\334\320\312\022\302\365\254\003\375\212\3311_2'\263uk\325"
+	.ascii	"\2749\267*-j\332\312J\b\275\273\223Z\223\303\267\356ex\272\305"
+	.ascii	"\272\033D\017\310\221+\"\\\217f\313\374\317\351\325X\002f\254"
+	.ascii	"\f\335\316\020\034\312,U|=\242\306\250pm\356\334J\321\311\301"
+	.ascii	"\226\244\331\206\236\377^\037\223\335}\343&\355\244\023\317\367"
+	.ascii	"fW\350\357Y\336\036\360\2776/\204W7\226\234\035ZC\332\261\007"
+	.ascii	"\213\350'\3516\002u\332I$s\313\210\264!N\t\2246\f\0024\263\253"
+	.ascii	"\221\351\226\262.\233;\355\355\247-\245\n\310t\231D\246K\343"
+	.ascii	"O?-\215\335\251\362\007iv4.\222\271\245D2\227J\240~jc3\2170\240"
+	.ascii	"OK%\322m\251\374A2\217J\344\323\226\022\210\207\034\220)\032"
+	.ascii	"M\312\276\226\013\362\251mPa\035\223?Nd\272l\271\3565\203\352"
+	.ascii	"\344\001\335X\313\244\334\221\307Nqr\332p\272\341\270\334\264"
+	.ascii	"\273\007\240r\342Z\366\223\023Yd\331]\304\tFS\2410\246\316\016"
+	.ascii	"\262Nc\027V\327\200\352&\240\323n\252n\343\266\263\273\215\335"
+	.ascii	"\215\223\304J\273_\370A\206QQu[\005Q5\226Q\r\252\233\315\306"
+	.ascii	"LQ\"\231\\K\"\265&3\254\243R\343\206\265\334V\022e\032\311\272"
+	.ascii	"Fw\357\0314L\211\303\f\327\r\243\343\206\234\341\353\007\272"
+	.ascii	"^\366\3136\027\314k\331\262\231\335i\017\357\270\343-M\250\027"
+	.ascii	";g^\317!\214vN\013\203\206\214\213+\343\260n;F\3328\361\342\033"
+	.ascii	"*\025\re8\370\314GwE\307\031'\372Z\245\331d3\t\314\372\250\024"
+	.ascii	"\302\322]\254\250\351d\026\023@28\221p\025b(9Oi3s\300\234\311"
+	.ascii	"2\013\202\276^1\231k\216\bYB\307\365\365\t\375\271\354\333\344"
+	.ascii	"\262\265R\215?\335\\ZS:ie\"\347YwU\203\016\375*Y\206:_m\223\241"
+	.ascii	"8\r\"K\215>nL\260L\334\334\260R2\305\325\t\316\324\325\231\231"
+	.ascii	"\023\375\212\371\340\245\\\026\f\254%\266%\b\0179\342\306X2\260"
+	.ascii	"\221uZ\375\364\023\332\\\235\230\022\336b-\037#Pw\027\\\030\023"
+	.ascii	"n\302c\274\204\223\260\3306Y\t\0239\277\300=\036\304\\\254\204"
+	.ascii	"\273\330k\235^\022\210\275\225\b*\261\003\006\r\230\323\247\372"
+	.ascii	"8\035\b'\344\005M\306\324u\247F\370\213\213\254\323*\355\033"
+	.ascii	"\"\220\361\221\344?\037a$\333d#\017J\273D\211\001z\356\304\250"
+	.ascii	"i\322+R\003\317\024\251\036Q\\\231\206e\266Mu\245a\333\344\031"
+	.ascii	"|Q4\264\371\342\312`\247\243a\224\232\342\215\241\347!A\317\023"
+	.ascii	"\"\004\375R\227\005\327\205\236\267D9\006\376"
+	.string	"\261M\022\f\344K\306\\\2779\246\235\362\2206Q\236\360@\277$z\274\347sI\364\316\273\201\376\360\244\320\363f\240?/Y\353\206\251\305\016Nk\323\272\274\325p\342z\236\021\375Y\017=\021B:\230\007[\3759\276%S~\234\255A\317;4\020\262\345\214k\335\257\365\030\3079\307\237\303m`aTv\350Y\3117\376\034\037\271\257(ds\3509ys\366\264\273\342\312U(\024\303\221\320\311B\323\342\252\237i\260\024\333p\341\331F\007\256\\\203\251\3166x\252\331\006\212e\367\221m\370\330t\037}\273#vG\324%\\`Rz\365\314\206^n?\364z\326C\217\243\210\316\310\035\270+uN\270\362\244(\033\331\310O?\001\277bp\370\201Q\021\216Q\021\nDz!c\202\342\317\002\243\"\035\243\242\336a\234\020\006\203\212G\302\240\216Q\321\006\026\030\025e\360\242\250\203\241\342\0178D*\212(\036)\260"
+	.string	"\nI\302%\027\277\241\320\205OF\223\320\005"
+	.string	")\374\212D\031\035\004P<\214\023\300\246!`\223\207$\246\030;L&\360\360\206x\304S<b\0026\3350\001\233x\305#\025D\350\317\205 \261\022\211\277\241\222\022\022\216\214&aR\035\026\233xJ?&`p\t\tG\351G\214Q\231\204\301b\322\217\210\363\341\021\260\351D\317\020\tFR\2251,\022\203\300\037\007GA\305_\007J\277\245\336o\t\b\024\276P\372-\345\020\225~K\225\247\030d*R\372-\341<\351\210\251\202\342\217\370\343"
+	.ascii	"\3304\300\223\202\303\037\323\017\210\036\205\n\004T\254h\001"
+	.ascii	"\347+Z$\320\"\201\336W\264 \"j\241\202\b\275\n\"\336\357h\370"
+	.ascii	"cb\301\350\2274\214!$\376\206\276%\241p\202\243\233\342\221Q"
+	.ascii	"Q-\036\206\001\0276\375\206CE\241p8\264S<ZQd\n\306\300a\022\006"
+	.ascii	"\231\2029\304#`\320\004&\241\013\245_\006\304\030E\244\"\021"
+	.ascii	"\250x\204s\026,\\\210\360@\003\013\320\244\023J\277\245\243\""
+	.ascii	"\f`pi\2108\374\255\020\034*\r1\005\221R\030J\032\022\207N\024"
+	.ascii	"@\004\"\275\020\006{sq>L\25132\256\251O\357\b\221(\2651o:i"
+	.string	"^\254"
+	.ascii	"a1\234\246e\306\227*,\267F\005\0265#\f\263\365l=\233c\270\362"
+	.ascii	"\227\035i\310\264q\205\262T4\214xy\331\272\031\236pZ\\\267l\341"
+	.ascii	"8\026\3160G\2220\224 1\254\341r\216S\212\035\213pe\347\272\371"
+	.ascii	"\356\330\300\210h\265\265\361\033[X\205\002\007\265d\267\363"
+	.ascii	"\333N\032\227\327\f\267\234(\251\347\326\016,X\230\r.\354\307"
+	.ascii	"\335T\2263\333\272\371\344H\022\021c\326\013c\206H\327\224\232"
+	.ascii	"\032\257\355O\352\324\245-\314G\216\212\232(V\316k9l\202\034"
+	.ascii	"\237p\345*:]xli\256Le\345xr<\310\330\244q\245\231K\343\372\233"
+	.ascii	"'\364R\244p\332\226uU\320X\2079\242\246\333J(\201K\250\201$\207"
+	.ascii	"\0206#2#\"#i\222tA\005\304\030'\251\263\016\021P)\204hfD\232"
+	.ascii	"\244P\3328i`\306\355s\231{\302Q:4\306\202\252\315\020\376\321"
+	.ascii	"TV*\215\371\036~\3554\260OE>w\355\215\243{v\033\370FH{\324\""
+	.ascii	"\343_I\364\236\033XB6\036\372x\005\230oh\247\3710\343\364\363"
+	.ascii	"EA\022\3423\352\321\270\337\330Z\365z)\215\326\005 \203wE\tE"
+	.ascii	" \267\261\305xd?n \204\307\244R]\373\220\255>\004\024\204\270"
+	.ascii	"\022\026*\257:\020\326Q;\002\002\026SI\002xl\356R\034\013\303"
+	.ascii	"\\\177\003pP\027&\230\277\023\035\213\345\364Z\214\237S\331\022"
+	.ascii	"\262\354A%A\246\\C\300sz\346$\336\032\270i\326\370\205\226\315"
+	.ascii	"\024E\224r\217\256_1\232\236\312\325\037\210E`\253>k\025\324"
+	.ascii	"\261\245\272'\306K\371M\241\363\177i\244Q\035\277wGBb>\350"
+	.string	"\244'\n\345I\346\203\026\375\376\335\371PF\333\006_\302\013\201\264\227\206\251\331\b_\020E%\306rw\024\215]\fa\025\350\024`\b\226(<.\332\363\037\340%\212:P\001\366\246\344\017\033\205{\341\326\376\306\362\217.t\004\226+6A\205\016\"\250\314\3515[\250B\375\034}7\376\\\217UK`\2443\004?\362Gc\036(\307\007\243\206?\266\347\255\261\200~\310X\027\277\005C\336\243\222\b6\325\261!EH\221\217\nX\273\026\203\t\271B\341\b.7\315WP*a\262?\2664\306\354\204E5m\277zn\\\007R\b\221r\323V\344*\342\025\300\2712\302\236\207`q{\242!\345\361\300\215\022\235\021\251\273F\032.\020\001\376\365\324\226:\341\372w\301/\366\213\025\314~\302!\227A\200\350>?\333\022\034i\344\007\301)\344\327\022\031\311>e\315F\177\"\360\325\222N\355\221\216:\271\036'\333\231"
+	.string	"1C*E\223q1\3747\026"
+	.ascii	"\270s\366\3030\247\333@L\272\007\bc\342\364\266\"\350\336\024"
+	.ascii	"\313[Bz\303\320\255\2245\020\002\210;\004^\017%\305\025U\266"
+	.ascii	"\206&^[@'\"\3715\361\374\333bK\314\243\205\320r\206\251\340\n"
+	.ascii	"b\001L\252\234y&\311\2152n\031\307\222\371\221\200\237\340\354"
+	.ascii	"\341\327\321:\027q>p8/\331\206\301\031\200\271e\304\260\257\260"
+	.ascii	"\036 \2751\364\303\305r\272\363<\353\326\371\372\362\264\261"
+	.ascii	"m\374\357\261\372\205Yg\264\021\362\r-\r\223\307\360\277\354"
+	.ascii	"\342{\214e\257\222=~U"
+	.text
+	.section	.gnu.lto_.symtab.b9dc2feef3d3a4a8,"e",@progbits
+	.string	"pgResetFn_statusLedConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360"
+	.string	""
+	.string	""
+	.string	"ledInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366"
+	.string	""
+	.string	""
+	.string	"ledToggle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377"
+	.string	""
+	.string	""
+	.string	"ledSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\001"
+	.string	""
+	.string	"statusLedConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\001"
+	.string	""
+	.string	"statusLedConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\001"
+	.string	""
+	.string	"statusLedConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\001"
+	.string	""
+	.string	"IOConfigGPIO"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\001"
+	.string	""
+	.string	"IOInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\001"
+	.string	""
+	.string	"IOGetByTag"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\001"
+	.string	""
+	.string	"IOToggle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\001"
+	.string	""
+	.string	"IOWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.b9dc2feef3d3a4a8,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,359 @@
+	.file	"pinio.c"
+	.section	.gnu.lto_.profile.2ba92d8a5680b903,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.2ba92d8a5680b903,"e",@progbits
+	.string	"(\265/\375 S\245\001"
+	.string	"T\002G"
+	.string	"\004"
+	.string	"\203\333\301\367\005\016\002"
+	.string	"\002\001\002\002\003\004\001\240\342\234\212\n\002\241\251\226R\b\003\240\342\234\212\n"
+	.string	"\005"
+	.string	"?Q\256\314\005w\354J\332"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.ipa_sra.2ba92d8a5680b903,"e",@progbits
+	.string	"(\265/\375 ,\345"
+	.string	""
+	.string	"\220 "
+	.string	"\002"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\004\001"
+	.string	""
+	.string	"\002\002\001"
+	.string	"\001"
+	.string	"\003"
+	.ascii	"@\221\221#g\003X"
+	.text
+	.section	.gnu.lto_.inline.2ba92d8a5680b903,"e",@progbits
+	.string	"(\265/\375 \247\325\003"
+	.string	"2\b\032#\220)\351\370_,\\\f\360<\003\251\3501b\214\231\273g\350\301\270\315lgU\273>\236Q\037\265-w\n\2179\246s\377\315O1\271&\301\275O\225R*\360P3\023I\305p?\240\266m\212F\271\246\303\035\323\276\267Bc\217\3317\3470\355\215\320\377^\350\"\016\2112\370E\033kY\022}c\\$] \210\357\217\005"
+	.string	"\033\207"
+	.ascii	"<\211u\t\240,[o\240\r"
+	.text
+	.section	.gnu.lto_.jmpfuncs.2ba92d8a5680b903,"e",@progbits
+	.string	"(\265/\375 \263\305\002"
+	.string	"bD\r\027\260%\351\f\303\200\026\342\260R\f\206!\017\350QOQ\262\333n2\245\3724f\204\231\3417\017L\223zR{\\\312EY:\361H\315\3508\235u\317\340\235\200\r"
+	.string	"0\005\017\016"
+	.ascii	"OY \336\tT\001\270\033T\243\255\004\200I\264Lb\300q\305\224\r"
+	.ascii	"\006X"
+	.text
+	.section	.gnu.lto_.pureconst.2ba92d8a5680b903,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\231\004\002\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.2ba92d8a5680b903,"e",@progbits
+	.string	"(\265/\375 S\375\001"
+	.string	"\364\002G"
+	.string	"\002"
+	.string	"\001\024"
+	.string	""
+	.string	""
+	.string	"\001\002\b"
+	.string	"\001"
+	.string	""
+	.string	"\001\b\177"
+	.string	"\001\002\t"
+	.string	"\002\002\007\001"
+	.string	"\002\n\001"
+	.string	""
+	.string	""
+	.string	"\002\002\274\006\001\002\007\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"1\003\320)@U\334\240\254\n\2036"
+	.text
+	.section	.gnu.lto_.lto.2ba92d8a5680b903,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_pinioInit.9.2ba92d8a5680b903,"e",@progbits
+	.string	"(\265/\375`\375\004\255\037"
+	.string	"\3667\307G\200ZN:\273\320ZlY\226\032\260\033?D\340\324\236Q\347\206\214h\226\225\206\016Ep\255I\310\212\237U\233\030j;\261\366\377z\263*\311\236{\342\344\230p\213]\225\351\377\273\264\002j\351\025\333\277I#\204H\231d\264"
+	.string	"\245"
+	.string	"\262"
+	.string	"5\ta\037\244?7y\002\350\317\364\002\320\237\033\334Uc\240\211W\245(\366Vk\355\265\2205o&\277<\016^\207\267\313\321\2459\3644\233\203\373\257\363Ql\270\026\345(\274\216\311SnM]\355\351\207)!l\310\274 PT\337\345(\320]AM=5\031\204\001\202\346jOR\346\201*\264\035?\362\024\305\271\223\275G\214\361\330\343\250\311\213+\216\331\035\235L\tMoT\3139\216E>\213\320\334\256\240|\3344\205\224[S;\307&S\200\324\024\345\311\3166\216D\356\207\235\317\222\\pWPT\347\\\205Z\353\262\361\b\365\335\371\356\306\355n\321\256\331\025\227\342bBV\255D\242\335\337\243\300Hk%\016A1\241$\304F\344\347\236F\237\354=N\306Tu\2311\361\262\245\246(\265\272\221\273I!7\226rK\252l\033k\327\347c_\236{\375"
+	.string	"\232w\347`_\335\311\2336o\256yQ\223\367l^\263y\333\344\345\346\375O\033\213d\003\226\265\352X\276\251i\247Y\221\217\375`\273\027\333\223\215-\001\t\267\030\2515I\224>\271\017\333\335\317\335&w\022<\330\236\231\365\t\006.-m\265\326\240\237;\224\376\0042\277\333\335\363\356\271\336\025\274\027\215\007\250\025\213JY\r\r\004C\313u\332OS\214\303\324e\304\002.?\271\326\220\344\267\252G\312\264\325dup\206\223+\300A\017!BF\226\264\246\026n\232U\237j\255\016\216%M\310p\212\2109\264\320F\036\001\272\223*wy\004(\332;\275\\\214\032^\031\321\200\304\315J$\310B\273\003\0228\263"
+	.ascii	"|\366\204\237@yz\027\305\021\337\270@N-\\\263\317>\225\037\t"
+	.ascii	"\3556\373NUC^\256\256\273ub\313b\034\256B\333\361u6\262\252\366"
+	.ascii	"\3257\256\315\n\033\263\221\273\204\362\364\325\326\200\225!"
+	.ascii	"r\334\362\230{\327\307\202o\344i b\013\367\315\315^\212q\230"
+	.ascii	"x\331\"?\037\373\276\302\247\"\351wa\267G\021~\276$\337\213\236"
+	.ascii	"\022\020i\206\017\230\242\227\344C\341\242w\004T\352E\360\331"
+	.ascii	"\337\013$`/\306\357\007\354\355\222\365\215\365\257c\320\262"
+	.ascii	"\202kc\352\241N#7\307e\347\323m\206\203\256k\033\373=Cu}/03D"
+	.ascii	"\216\273Yk\255<\241\353\332\247\273\210\f\327\306x\327H"
+	.string	"\266%w3j[\223s\013c\3624K?h6\364\234\241\360\005\027\225\023\354*\3335%\231\017^J\3320\361\362Cx\334\300\241\003b\013\027rE\254\340\332n\204\356fx\030\243\004Y\265\326\241\264\r?l\265V\242/\007\303a=\200\340\033A\240??p\275\265qCVC+\225\201\246\001d\250A4\306\230Ch&\020\021\222 \211\323\030\200\002\231!\263n\020X\3104M:\341\323\361\rvg\333\253[,\235o\033\370\"\220\230J\232H\022\342r\307\364\277\375\005!\257T_z\363\333\304DSd\242\247m\230\234\030\0015\354t\335Z^xX\220{\221\363*\373\373\362\355?\255,\375\302\364\311_\203\024\264\375\206\343?\322\177\312Q\366\222\r\200\3668\206\261\233\031\300[T\230@\354\355O\300\322\211\r\2044i\357q\336\314\234\220\2379\021v\275\340w\244<\\=D\024\276\272\221Y\353\020t\312"
+	.ascii	"\201\365Q\254\227\334\340\020\202\021\214\b\346\344\330\257\247"
+	.ascii	"`\226V\n\315\257r8q\021^4c9\025\254\372\267jx\326\006^\377\222"
+	.ascii	"`$\2374B\372\312\346\017"
+	.text
+	.section	.gnu.lto_pinioSet.10.2ba92d8a5680b903,"e",@progbits
+	.string	"(\265/\375`\303\001=\020"
+	.string	"\226\236mG\340\222*\035\222\303B\f\020\\@\236\216\003\321t\325@\374\313\360\203\203\351g\257\025\211\352(\241\366$\2755\326^\001\\\333Vn\b\3474\032\302\0303\024\200\230\007:yi\t\n\252t\231\0322\266\201\210\215\020\271S\nW"
+	.string	"T"
+	.string	"["
+	.ascii	"\253\327<cp\267\004\n\231\335-\361\201\316?\320\001p\376y\037"
+	.ascii	"\341\374\363\312\366\361r\266\277mp\275\330\354n\250'\276\272"
+	.ascii	"\247s\345\377v\360\005c\335\363p\365@:r.\021\030\213G 6B\367"
+	.ascii	"\333\247\006Xk\316\220\007\273\353\371\202u\270\277\333\216`"
+	.ascii	"\333\201=M\002\273k\215\331\267\335\340\313\277\363\332\037\242"
+	.ascii	"\323\336\247uN"
+	.string	"\3179\375\317\247\207\210\020&8\350\216r[v@6\367\331Pq\333o\3777{l\333T V\271-\"\227\032\232\315n\211\340\237\027Xd\262z\251\022\360\0375\264\034\273e\211\025t\376\371\323>\355.\002 \250\252\"\0208W\220\337\220\330\301\250\312\f\352\324\t7\036,\363\306\266\312cT\td\224\n\304\230\352a\341t\035\275\202\372\031\256\017-\223\207Q\205f\273\313\3006\351\270\222\001\232\335m\360r\030'?\305?[H\315\277R\234\177W\317\013\\\213\332\312\334\331%k\252\314\276\267\001\"\352\004%!%\216:#rb\020SF\343g\224\0209\216FRx2\211\027FSJ8\032OTB\024\323)\f\r0I\022M!\212$M\241\247\334{\2531\b,r+\332\362T6\243\"\231\341(\005\270\001\256\210\321\271\210LUOm\221\302\374\313\240\f\312\262=^\246\302\207\246F\211\204\206\247\001\037"
+	.string	"3C\357\220\3009\273ehwF\326\200e\026\001z\300\270M\210\236\tl"
+	.string	"\355\300\020b\310Q\2068%\243cnB"
+	.ascii	"\333\201!\224\220\005\n\361\b!F\233\250V/\330\3045\261\016\327"
+	.ascii	"(j\370g\334\357yP\\sS\2113\245PP"
+	.text
+	.section	.gnu.lto_.symbol_nodes.2ba92d8a5680b903,"e",@progbits
+	.string	"(\265/\375`*"
+	.string	"-\005"
+	.string	"\362H\"-\200\305\351l\245\2366 \372\030\r7\254 @}\251\214\236Q+\264\227`\021\317"
+	.string	"\306H<dq\300\274!\022\021\341Z7\021!r\247\024~\301\177p\371"
+	.string	"(\230\261\3733\025H\344qF\3556\350<8\310)u_h\022.rF\230C\013\001\205#9\031\317-\300\343&'B\263\203F\203V\005\2652\275\276\273v\342\303\024\273\033\027|vw-%\300\264\257m5A\266\241c7\266\332\002\223\333\323l\003Q)h\373\212\n"
+	.string	"\240\036"
+	.string	"\034"
+	.string	"\034"
+	.ascii	"\034>@\020\274\024)\301p\t\201\345N\020\245\007"
+	.text
+	.section	.gnu.lto_.refs.2ba92d8a5680b903,"e",@progbits
+	.string	"(\265/\375 )I\001"
+	.string	"%"
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	"\001\001\023"
+	.string	"\001\001\025"
+	.string	"\001\001\027"
+	.string	"\001\001\030"
+	.string	"\004\002"
+	.string	"\001\001"
+	.string	""
+	.string	"\001\003"
+	.string	""
+	.string	"\001\006"
+	.string	"\001\001\b"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.2ba92d8a5680b903,"e",@progbits
+	.string	"(\265/\375`\360\013\035@"
+	.string	"\232p\234\030DP\036R:\345\201\r)F0\246\202)\313\372\253J\005)3\026N\351\263\364\r3\272t\273\323\370U\215\302\361\316,\"\037b\316("
+	.string	"\204*Nx\2006\n4\360U8\221\036\\\360\222\267\031Qv\304n\231\002F\001r\001{\001K\314\n\210\31209r\371\255\347#\231s]\004\2643T\356:\246\235\"1\221\205\324\334\365Ev\216\305\260\224\351\370\313\271\355\236bh\031n\311\327\r\265\302\326\335g-?\025\035\203a9\004^\335\320!Knm\244uz\335\375$%\365\313\363\363\306\353\267\312\205Q\312C\246e\022\247t\310\312\241Bw\275\025\373\017\354\253\3303\334\317[X\013OWtG\273\233\300Q\234:puwe.\034ei\002\366\362\013\031\3563\276u[w\013\\\313\330\024ir\327O`\317]\016"
+	.string	"Ng8\313\276\312\t~\354Fu~\013\360[6\333\006zP\242v\345\256\276\313\256\034\340\007\305NY~\306\302m\t|I\035\317\236v\267M\300\266L\251v\327\267\354\364c9\300\357g(\n\207\001\374\257\357\277\234\377w\354\204\377t\352p\223\204\237#\374\227\373Y\352g\002Q\377\343~>"
+	.string	"\341g\007\377\347~~\300\f\0204\370\031\320\317\n~F\360\363\323\317"
+	.ascii	"~F\372\331\350g\242\237\371\377\336\177B\377\335\374\267\363"
+	.ascii	"\177\314\1773\377\371\374G\361?\357\377\235\377g\376\327\375"
+	.ascii	"o\373\357\364_\315\177_\265Z\255\376\354\341\347\266\337\b/\234"
+	.ascii	"\214B\231\311\350\223\331\324\3106v\364\210\306\"\237\314\344"
+	.ascii	"\232'\223)\031=2\223H(\263\351\354\317\221<b\202\240Y\230\231"
+	.ascii	"D\366\016\245\363\270d\242&\333g\343u\363\024\254\227\013\272"
+	.ascii	"\235\317%\336\321\214\305xQwx\305\035\237]@\351\225\366l$5)\345"
+	.ascii	"\331-\305"
+	.string	"\313E+\253\214-\265\2210\325\250\346l\035`\335\006\272\355Vv\033\271\251\335m\354\356\242\245\263\355\016\302\224dS*\273\233O\312v\032\351\300\272\357\324\216\030f2\232\366\244\242\223F\331:\25452[\343A\227l\324\350\326:\272\233\375\260l\314\036}\356\312|\216\326$\2374A\303r\036\326\303R\336\363\365\355\331*\371\216el\346\242~\300j\265Z\345(<\307ct\243\202\346\256?\347\235\357\\46_jwM\303j\330N\322\263\033\2114\306\256\354\312]\353\024\3459\363\246_\330s\033\233)\206\237\352\216\3330\225\251\315\266\311\252\266\314a<\246\303R\276\3437g8\034\347Omw\334\232\013\031\370\216\345\260\335\222\261m\036\027\340\306\332\364\272[)\251'\251$#W\246q\354z^c\271\331\351\307\304@\330\263\364x\330\315\363\254J\326\224e\271\353\331\007{f\262\347$\373);\375\326n9"
+	.string	"\032\273\",f\322\246we\273\313f\370\314\331\216\313$!\331n\355>2+\beL=\212c\346\246\357z\177p\037\037\236\231\333^\030\242\264@ysiJ\345%\303cC\002\263VU\302\374%\373\321\001\344\226v\327\273d*\322\024C[\326.\217U\t\345\255\307\335\001\304c\346\207\237&{\337\330\330\330\025c\246\326+\316\034\233\317\n\232\017\214\275a\277aW\214\337\316\230]\321\353nF\255yD\246Bn\362Wl.m\355\213j\024\226\243\n\305c\377\353u\226^\257\373\265\"\333f\376\272T);\323\353\345\031\tML\250T\356\032u\221F\310\266\243Fw~\206L\265\260\277M\016\035\272F\266\273\231\213\016%\271\226\316\313\355_\243"
+	.string	"\247\\\240\273r\365ex\n]\222<\273\244\034dugE\366\244\274\307w\214\222k\233\270=\275\\J\370m\262g?\374\007\020\023\342f\373\362\344\232\315\250\0374\016\f\232AgB\317\223\324\335\326\335\b\220\356\232U~\334\365\200X\357\277\321}\323\004\356M\217\005\261\201\324\004\3423\246]\005U\261\322\346\256R\016\304_\224"
+	.ascii	"\025qJ\357\372\273\203\375\375\177}\\v7\031Q\333K\257\2443\021"
+	.ascii	"+\261\217\027\374_\273\245t\023\371\363\207\2152w\024r\327\377"
+	.ascii	"P\375*\335\306\246n{\231\214B\215\311.p\230Mm\243\021\350\250"
+	.ascii	"Z'[(s}\366\355\266\271\221P\346\214d\373\\&\333\247\221\251\221"
+	.ascii	"Ocw\313dJN\217\306\301\242\220\250\342\312\252h+\013\005\216"
+	.ascii	"\017\305`\210+\253\243+\253_\361\350\312\252D\210+\253$\241\210"
+	.ascii	"\241\360i8\342\312j\275\213\n#PX\235\230*\006\267\210YE\250\""
+	.ascii	"\326\005\f\354\013\255!\f\020A\342\020D\214`\261\013\307\t`1"
+	.ascii	"x\202M*\n\271\254\214\256%$\006\271\202[\354\2534P\320\260\341"
+	.ascii	"F\3217t\260\320\301\302\357\033:PQu\320@\305^\003\225/\210E\f"
+	.ascii	"r\331\270\nj\021i\f\273\202D`\361\007\202\305\254b\027Q\027V"
+	.ascii	"0\206\260\310E\303\304R\021\353\312j\035\n/\213`\221\030\254"
+	.ascii	"\301%da\f\207\037\260\210\212w\261%c\300\2072\202\304\251\342"
+	.ascii	"pH\234B*bm(r\ti\024i\375\272\260\266\204-\270\206 \224\212XE"
+	.ascii	"\347\300\001\004T\n\022!X\255\nC!\227P\306T\0271XCHd1\305%\314"
+	.ascii	"\2121\245E\354\232\252``+\013\305PH\324\004m)\232\003\214\033"
+	.ascii	"\023\261\24399d\216,!\003\246\371\232S'\227D\211l\017\0221qI"
+	.ascii	"<x(y\"i&)\235\204}\335\265\353T\202V\245v\356z\215\260O\300\352"
+	.ascii	"\264\254\024\233\262v\327\253V\365\354>\336\264[\344W\355\355"
+	.ascii	"U\003\356\001\231\025\334(q=\016\375\326\263\263\213\366\364"
+	.ascii	"\364\305\2213\273R\345zARd\320}\376\242\001\231mG)w\275D\230"
+	.ascii	"\n,\204\306"
+	.string	"\311\222)A\202\\g\033#\205\306\204\374:\231\272\344c\271\244\316\364G\247\317\022\265$>|\334\246\232%\2741zpf\277M\243=$G.w\275\001\200\360\250q,\207\0206#3#\"\222$I:\200\002\021)3\326\001\020P\207J\232$\255\001\225\201\310,x\205?\f\206p:$\343wT8\321\206g\002\336\213L<<]\264\273\251H\013\265\245P\013\037\300O\217-\346\215\210\325\374\221\265q\201s\340+\021\022\252\035}\247\221\026\364E\351\0377\360\227\003\"\306\206\315|\337\020.z\344P3\032\346\337{B\026\241\373\236c\203[\220\317\250\230\357\3668L\264\303\0048\311\322\031\272x\204\241i\340S\221\220H\304\267\347M2\302\313\031\202\221\353\376\200\212\002\252G\261%$\363i&+>y\230v\b2\243e\n10\341P\323\253\305+T\007\221\261\030O\275\260\225r9\243\002[~g\246\274"
+	.string	"\216{\202&\177\307J.1\207\375\316\361\356#\330\225\367X\037\242\372K!.\250GpN\325H\020;\246b\263\305m\260\357[\304\260*Wd/w]\200\321b\265GN^\213\r\330\345\007\346\213\363g>&_\017\245!`l\342\275\204x)\033C\214'\340$i\212\210\036\357\211"
+	.string	"\254HPOF\244\031\335Q\334\253\202\247v\252\001\277QE%W\3335\302\243\310\033\032\260a\201\374a\2244@v/IP\323&*\365\262\307Q\037\232\273T\350\271/O\357W!0/H\347\374"
+	.ascii	"\365}\270i?\214\361\275\r\027\237\244i\320\261\346O\235\240\371"
+	.ascii	"\2368Ql\237\232)aI3\202\362\207\277\220\375\267w\226)\351\253"
+	.ascii	"\262\377>F\312\320"
+	.ascii	"(0&\200\001\013\201\346\311\264\244\221\341V\365\213wy'\305q"
+	.ascii	"\361\342`\2349\023\326p\347T\273\2413[\216\272'\364\316\216q"
+	.ascii	"\216:\344kz\311o\345\362\261!>\341\357\007\352YM\025"
+	.text
+	.section	.gnu.lto_.symtab.2ba92d8a5680b903,"e",@progbits
+	.string	"pinioInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372"
+	.string	""
+	.string	""
+	.string	"pinioSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001"
+	.string	""
+	.string	"IOLo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\001"
+	.string	""
+	.string	"IOHi"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\001"
+	.string	""
+	.string	"IOConfigGPIO"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\001"
+	.string	""
+	.string	"IOInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\001"
+	.string	""
+	.string	"IOGetByTag"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\001"
+	.string	""
+	.string	"IOWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.2ba92d8a5680b903,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
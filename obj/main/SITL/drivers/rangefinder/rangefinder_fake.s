@@ -0,0 +1,277 @@
+	.file	"rangefinder_fake.c"
+	.section	.gnu.lto_.profile.9c3bf8ce5ba9aa65,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.9c3bf8ce5ba9aa65,"e",@progbits
+	.string	"(\265/\375 [\035\002"
+	.string	"D\003O"
+	.string	"\006"
+	.string	"\354\301\314\336\005"
+	.string	"\001\002\370\223\370\371\n\002\002"
+	.string	"\002"
+	.string	"\004\321\202\205\254\b\005\260\246\340\226\n\016\002\001\002\002\002\003\004\005\002\002\006\240\342\234\212\n"
+	.string	"\005"
+	.ascii	" \013;\373]\356R\031g\003X"
+	.text
+	.section	.gnu.lto_.ipa_sra.9c3bf8ce5ba9aa65,"e",@progbits
+	.string	"(\265/\375 1%\001"
+	.string	"\300%"
+	.string	"\005"
+	.string	"\001"
+	.string	"\020"
+	.string	"\007\001\001\002\003\004\001\001\005\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\004"
+	.string	"D\305\200{U\306\331"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.9c3bf8ce5ba9aa65,"e",@progbits
+	.string	"(\265/\375 \336e\003"
+	.string	"2\006\022\033\260%\351\270ThR8c\316\244\034\210:\215\250a\030&\216&Z\333\204l\271S\377s&\026\332\032\217l\340\027BA\333\342\363O\214h\377\321\002\245\3341\231W\342\300\03443\353y\277\264\005<\277\020\333\326\376L\b\r"
+	.ascii	"\234\210\306\302\005\262R1\006\253[\b\262\004<\251\216\201\026"
+	.ascii	"`\035\216\242\261\271.7\361\330@\033"
+	.text
+	.section	.gnu.lto_.jmpfuncs.9c3bf8ce5ba9aa65,"e",@progbits
+	.string	"(\265/\375 1-\001"
+	.string	"\330%"
+	.string	"\005"
+	.string	"\001\001"
+	.string	""
+	.string	"\002\002\001\002\004\001\001\003\177\002\006\005\001\001\003\177\002\002"
+	.string	"\003"
+	.ascii	"`\b\225q6\200\005"
+	.text
+	.section	.gnu.lto_.pureconst.9c3bf8ce5ba9aa65,"e",@progbits
+	.string	"(\265/\375 \024\241"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"\200\004\001\200\004\002\232\004\004\232\004\005\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.9c3bf8ce5ba9aa65,"e",@progbits
+	.string	"(\265/\375 \245%\003"
+	.string	"\324\003\231"
+	.string	"\005"
+	.string	"\001\002"
+	.string	"\001\002\001\002\007\001\006\004\006\005\001\370\007\b"
+	.string	"\005\002\t"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	"  \002\n \0200\002\013\200\001\300"
+	.string	"\300"
+	.string	"\002\f\300\r\200\002\320"
+	.string	"\320"
+	.string	"\001\300\001"
+	.string	""
+	.string	"\021"
+	.string	"O\rm\025"
+	.string	"\034\202\306"
+	.ascii	"\n\230\215\003\321Zn\005\331\337d\233b\230\323\330\316\034h\342"
+	.ascii	"\002/p\032\006X"
+	.text
+	.section	.gnu.lto_.lto.9c3bf8ce5ba9aa65,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_fakeRangefinderInit.10.9c3bf8ce5ba9aa65,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"\315\006"
+	.string	"\022\215/2pm\032\003\240\373\220_(\201~\003%\003DIy\232\t]K\246\233\204\201_ \256\343\255%\262-\365\377\223\207\240*q\001O\006\215\364'I\244L) 8\265v8\360A\3624D8U\224\007:TR|\237\bAT\234^EI\020\257\023?\217\203P+\002\306'aY\361m\346}y\273Z@\321*\332\031bM\243\365\345\377\333\256\226iN\006P\376\213\026\226\233\270\222\216M[\263\326\036\376\220\006\231p\300\177\245\220\374\363\240\013\031\273N\023`\3542\026\300\330U\266*\236\034O\030\261\020Y\371\377\332\206\245\231\254\035b\215h\0242\003P\370_&\032e\270\315m\r\3322\264\305\b\t"
+	.ascii	"{\341\"c\217\362\254\341\254\034L\272\204\325\254F\217;\274h"
+	.ascii	"'\031"
+	.text
+	.section	.gnu.lto_fakeRangefinderUpdate.11.9c3bf8ce5ba9aa65,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"\315\006"
+	.string	"\022\215/2pm\032\003\240\373\245h\356\253i*g\b\002Kx\232\t]K\246\333\220\271_ \256\343\255%\262-\365\377\223\207\240*q\001\026?{\243F\344\2262\245\236H\271n4\261a\342,\310HY\025'2X\223\204\035\031=\225\244\240UM\016p#;Pc\320\353!J\bq]\022J\363\216\356\262\016H\270\211v~\232\303h\035\375\177]\3266\211##\362W\254\250\334\344\221lHm\335Zw\330\003\363G\204\003\376\354d\344\237\005M\300\370u:c\361\303X\300\342W\254E\361\324\370A\tEH\312\177\3502\214\271a\265A\f"
+	.string	"\n}\334.\b\377\333@\241\013\327\271-A[\205\266\026\001\t"
+	.ascii	"{\341\"c\217\362\254\341\254\034L\272\204\325\254F\217;\274h"
+	.ascii	"'\031"
+	.text
+	.section	.gnu.lto_fakeRangefinderGetDistance.12.9c3bf8ce5ba9aa65,"e",@progbits
+	.string	"(\265/\375`6"
+	.string	"%\b"
+	.string	"\322\31787Po\322\001\240\336\314\032\340H\b\026\243\226\t\020 \242\024\351\226V\313\254\033\202\350;\376'\0209P\261\255\2152\256\252\240S\375U\225\222T\017<`5\331d\357\224\002\241\211A{:\023\342\3728\320\211i\331g>h\027\225 :C\031\305\244\226]\021\322CA\262\223\340MbR9\261mT\272\356\251\205&C\353\002b\330Gy\n\205\365\020W\210\336I\217\276\250z|0\200\343\344\325\330u\364`\207}j\241\311\017\016xpbv5jf\026&\272\210\330\346l\001\333\357\331/\271\t\367jq\202]\023M\313nE\360\302\346\321uc\333\0379\t\347\216\252 \245\206\227\f\025\231\335\225\3269\325#\365\202\352\021~\274\373\353\374\237n\260\302B*\215\376"
+	.string	"\024v\327\217T\332\270\341m\037\330f\260}\n\013"
+	.ascii	"zq\231\303`\321\314a\bV\273&RL4C\3436`\202\200\023=\252\225\216"
+	.ascii	"0\311"
+	.text
+	.section	.gnu.lto_fakeRangefinderSet.13.9c3bf8ce5ba9aa65,"e",@progbits
+	.string	"(\265/\375`\217"
+	.string	"e\n"
+	.string	"\326\023I? m\225\016\327\240\2541"
+	.string	"V\004H!d\326\026\035\300.i\360\004\204\033\303\350\324\356\315,\266\340\255\305\274\355\003\177FAB"
+	.string	"\3224\340\007\300Ov"
+	.string	"\322\256a\275\027\347\333Z\262\267\224)\0056"
+	.string	"4"
+	.string	"7"
+	.string	"\236\rB#\001\305\207\005\031H\354.\246\023\356\035jz>\344\"\031}\240C\b\327\212/\004+\273{\324\223\364\2112!\227\335u\216\276\007w\274m\017\333\037\266E\004\207\273\273\326\222\375\323\237\231~\264P\2001b\267A\313\304\262\"\007\013\023\333O\373\027\216\301\373\351c\311\256\004\r\033vw\303\035\221\307\312)\327#\374\305\365\350z%\305\020,\004\032\362\325W}U\240\362\n>\340\311\217\036}\317\365H\241\020A\225-\b\325\224\271\273 \325\222\325\301?Wj\364\200Zu\020e\t;\005J5\331\001\032\206\313:\234-\0231\306\242\t\3104"
+	.string	":-\303m\032-"
+	.string	"\227u\030\247\323\fl]\006\343\266l"
+	.string	"\206\3518\230\205\303\033\002Z\207u6\233\016\233\244\366p\265\344T\3133\030\234\310\f\016"
+	.ascii	"{\341\002\324\236\2155\360#X\022Ue\242\202\303\005\0060\345\022"
+	.ascii	",\261\232\022\356f0`Q\345\266\253\350\001"
+	.text
+	.section	.gnu.lto_fakeRangefinderDetect.14.9c3bf8ce5ba9aa65,"e",@progbits
+	.string	"(\265/\375`3\001E\f"
+	.string	"\326\325RC\360P6\0358Rb\232I\301\266\250\017\025\243\227-\264!\034s\332\024\266c\300F\203\271\025t\375\n \026\tUm\b\321\2770\276Ty\230<\270\320fd\213\273<\330\202m\r\341k\\\3756\264wJ\001="
+	.string	"="
+	.string	"D"
+	.string	"\027\037\230\234\363\371Jwn\362\220\356\234mg\006\230\\Z,\324\0328R1\333\356\351U\017/OK\377\260\007h\231\2201C\205\352t*1\260\273\246\246J\303]o[\200m\004\366]\001/u\347\350\254\306\301e\003Eo\366y\242\265\203\375\310\356\256+\313\376\353\247\035\365B\352\004"
+	.string	"\332.\206[\216\215\301\271\ba\333d{\330\246\324\276\353#L\177\225\016\262\313\202!\333=\003\225\3572\216ef\256\300\017\205\306.\352\246\035\236\005\250\300\206\026\346\352)n\207\276B\003\263I*\210G\221"
+	.string	"&\242f8\331\331\017\036#//\033\345\244\316\216\360\022\244\311\356\022\360IL\220\360\361\001\3049\007#\260S\315\301\200\240\317\263\031\301\216(\364\200\037\3217z\344\b\216\302\261\343\211\302/\344qF\322\303d,:"
+	.string	"G\017\202(\216\236\317}d+\313/\273\006\255\0277j\250J\301V\260@\363\031\003\332\346\023\027"
+	.ascii	"zq\351[\203#k\256\330\262\025\212\324\302g ;@d\247I0\355\252"
+	.ascii	"t\344kB\020\001u@\032\270\034\240.)a\"\225\016\324\023@\306\212"
+	.ascii	"\270F;t\210\370\272\346\023"
+	.text
+	.section	.gnu.lto_.symbol_nodes.9c3bf8ce5ba9aa65,"e",@progbits
+	.string	"(\265/\375 \226\255\002"
+	.string	"\004\004\222"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\n\177\016\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\270\300\202\202\200\006\013\177\017\f\177\020\005\t\021\204\204\001"
+	.string	""
+	.string	"\003\002\r\177\022\272\200\202\002\016\177\023\005\002\024\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007"
+	.string	";3"
+	.ascii	"7\260\b\b-\034\037(\003\324\240\331\351\004"
+	.text
+	.section	.gnu.lto_.refs.9c3bf8ce5ba9aa65,"e",@progbits
+	.string	"(\265/\375 \037\371"
+	.string	""
+	.string	"\033"
+	.string	""
+	.string	""
+	.string	"\001\002"
+	.string	"\003\001"
+	.string	"\001\004\001\003\003"
+	.string	"\003\005\002"
+	.string	"\005"
+	.string	"\002\001\006"
+	.string	"\002\002\007"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.9c3bf8ce5ba9aa65,"e",@progbits
+	.string	"(\265/\375`\321\n\2757"
+	.string	"\232b\234\025DP\346Q\007\027\356\006]\005\355\372\367\225*\275\037\342\372Ow-\306\314\324:\233\360\260\266\231\326\272\325\222B\313\355\257\275\257\2501"
+	.string	""
+	.string	"@y\037^\270"
+	.ascii	"\300v\264!\367\265\031\222\275Cj\367\272\271\273\255L)&\001O"
+	.ascii	"\001A\001E\323\351t\352\276\265\335\214U\313\260J\216\264\266"
+	.ascii	"Oa'8\322\352en\306\305z~\246\235\214\227i\3351\376\370\377\213"
+	.ascii	"\234\355\b\262\231\325\366&\254\215\177\357\255>\235zom_\262"
+	.ascii	"<GZ\263\037\255b \344(\024&\253\355\262M\3641\017\233\363G+\253"
+	.ascii	"\255\202\215~\031\202s\276\341\341\245\375K7\205\013\315\207"
+	.ascii	"\350\377\371\377\n\326$iN\240Ym7\357\322\335CC}\002q\225y\027"
+	.ascii	"\207\356\224K\322\300dU\314\241\316%\376\244\001[f\374\274Ym"
+	.ascii	"(\266=\254\027\320\371\013=\304vfy~\264*\371Q\226n\307\342O_"
+	.ascii	"\356\275\202?\372\037\033\t\200;CV\311j\307\216\264\262~\264"
+	.ascii	"&\350n=\275\326\335c\216\240\273\371\354\351n\265\356\356\343"
+	.ascii	"\307(;H\321\353ug\001Y\227\273\263w{R\267\027\350v\242ng\273"
+	.ascii	"}\355\366\334\355\335\335i\335=\326\335b\272\373Lw\303\351\356"
+	.ascii	"\266\356~\353\356;\335\035\250\273\001u\267[w\377\351\356gwG"
+	.ascii	"u7Rw\273\351\356u:\235N\273]Aw\036v\263\030\002L\264\243\017"
+	.ascii	"'CJ\261\220b\216\260\367\226H/\370\223\3227\n\374\037\005\331"
+	.ascii	"\342\227\026\214\261\364\221\270\324\370\305\365W\312\177\004"
+	.ascii	"\313\177\243\277\364\377\215\377\277cr\305\377[\274\027l\271"
+	.ascii	"\374w&-\237\313X\246\374\317\321<d\315\027\352\005\377\312\274"
+	.ascii	"@\301\036Glt"
+	.string	"\260G\353b\262Pc\330_\265\261`\315\035lp\321\317\315\207\2307\264\\d\207\227U\240\250J%I\233A\200z;*eC\214\270\365\037\235[\026@qYm\203\266\231\311\222\325\316a\330\256\340jn\346q\\\032\205z\222\211\035L!9k\330\224\331\022\306\307\304y\2229\032\227\036\341p\305\315Z\205n\327\242\346s<\217\002\344\033b\020\332\332\177\334\236\246\373\327\256\346j\034\215\202\033\377p\020\003\3208f\316\274\375\377\036\367\343}\234\217\353\3615gs1Ws.\355r\\\332I\361\177\362\377\037$\251C\270|\234\361T4O\303\023\301-\356\371\206\206G\345\342\265\344\t\235v<~\006\340K\213\032\223\254z\035\267\343b\235\306\357 YcD\262\306\322\330u\232\325\325\330\034;\322\352\363\243\325\335\370\033\027\3639\234\3666\276\246\207\222\361C\377\343\242`\221/h\350\260\355\2765Y\352\377\321\235\301"
+	.string	"w\006\2724L\216\\V\265U'\254\372#[e\253|\305{\244\236=k\357t\372"
+	.ascii	"X\261b\366#\347\350|\345`\336\271\344\254\273\207\326\264(Dp"
+	.ascii	"d\265U%\333K\236_\261\374:\\\b(\266\261\265g\022\201\3209\270"
+	.ascii	"d2+\335\271\201\f\316\332;\231\276\356|\243\263\322\317\212\276"
+	.ascii	"\300\372\304\305\311\307|"
+	.string	"\314\375\013a\003\226\213\262\355q.\250}\220\230\017\312\317\306\257\303)\314\226\331\333;\265|\335>\355\374\272)T\254\256\024r4)x~\024\"\024@\212\225\"\201\332\002\034\201_\254\254v\316\310v\267\257\177d\376\177\226.~&\222hu\235\273\257[\200\347\274Aw\253\237k&\351\277\023\370\017\013\245\314\021HV\273[\351\273\312\277\321\350\343g\276\320.\343\333\205N\323(~\"\007\036\372\365o\334\325T\341\317\037\277\177\262\253\031\343\215a\346\033\303F\336'a\343\177\334\344\275\321\243\321_hW\363\205\302M\243O\276\361\241G\"l\022n\276o\340&\357\205\036\233o\262\253i\324\004V\322\306\212\355\350\306\303\336\344c-\271\216L\236\364\215\341G\373\367\250\362\231\r\376\271\340\335biD\n\021QLn\313\242\bt\225d\260.\246\210/\236\332\"\361\211\252u\253jD\025\275 \022;H\351\240\3346\212"
+	.string	"Q;5\004\272UB(\267\005\201@\005RS@q\324S\302b;lY\260m\241IBS\006\032\273\316\3404\301i\302\332\031\234~?\247\246\037\333M\277\234\333bIB\023a\264E&\227H,2\005\b\002[\024R\024*\270C\341.\bl\213\252+UE\242\245\022\272l\025\211\032\300\027mpG\365\204\202\006\220\n@\222+\325\364s\207\302]U\333\026Y\264P\302\251\026*\330\006\207\255K\303C;$>\r\211Bw\252u\333\240\222p(\"\311\025\016\205j\321=15\224\361\301-\002\335(\030&zUR3Z(^k\320\360\244\244\242\004\bvj\251u\001\\!Ul\203C\341\212\226\305\020Xd\252*\2663\204\305 \323P\b\244b\232*V1-\375Z\027\030\204!c\345R\006\210\373J\302\003H~"
+	.string	"ad9\226y\013nN\362\216V\217\036\331\311!\372\307\246o\315\237=\337\236\311\006\202\021\023)\225\254f\037CgmA\242]\330V\245`ae\255\317\345\211\3332{\3433\266\307KGg\255\234\245\304\362D\222\325\234\225s3\357\350\234\225\231M\341B\023%\377\371\037\347\200\302\250\2018\207\224C\"\"2\"2\222\244\351\240\002\221\251*\316\001\022\340t1\224!\311\210T[c\377\016w\211\267\027dY\367\254\260\024\235\020LL\003\r\336\231l\215]\350\n\373\343\375\335=K4\242x\346P\315\251\3604\371E\335\276\372\303zk\234DQ\020\223\375A.!\304v\242\330~'\3077\344\035\341fl\002"
+	.string	"\205d\306\030\353\220\347\205\277\274\204\025$,*\037q5\314\023"
+	.string	"\357F\023\250\300\256\354\233\3658g\370\177\353\2140\013g\352(\350\367\376\034Kj\2127Nxh\362\273Y\r\3607\017n\024\244\271a3\240\201\272Aj\303\345\fK\370*\243\032#)\217\247\224\033\270\230s\226~\023m\273\3206\311\217\344|\345\336\203\216\022pU\351\224\242R\336\2047\026ufH\242Z\200\320Q\226\354\207\035\002g\277\003\360\324\361\r\030//g<J7\302!C1(%Z\253\217^~\004\254\315\306\332\300*fT@\307<\332\306\"\372\311a\243\003e\021\214-\332\251\365H \235\262$\004H\031\177\330w7\366 \3149\255\352N\221\325"
+	.ascii	"\200f\330>\351\231s\324\003\210\375\225JJ\234\236\351\366\214"
+	.ascii	"\264\214A\310\276B;\276\374\313N\tt\002^\220\357\340\3322\204"
+	.ascii	"V\212\032N\024\236\030\3549\206\341\r\276\331\211\274\324\261"
+	.ascii	"Rl\335-\377\302\030\370\003x\325\034hw\321\322> C\315\331\343"
+	.ascii	"\320\352\032\342\255g\353S\200U"
+	.text
+	.section	.gnu.lto_.symtab.9c3bf8ce5ba9aa65,"e",@progbits
+	.string	"fakeRangefinderSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\001"
+	.string	""
+	.string	"fakeRangefinderDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.9c3bf8ce5ba9aa65,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
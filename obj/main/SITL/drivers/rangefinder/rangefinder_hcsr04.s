@@ -0,0 +1,119 @@
+	.file	"rangefinder_hcsr04.c"
+	.section	.gnu.lto_.profile.48ed3d2f6fdf6bc9,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.48ed3d2f6fdf6bc9,"e",@progbits
+	.string	"(\265/\375 \024\205"
+	.string	""
+	.string	"P\b"
+	.string	"\001"
+	.string	"\240\342\234\212\n"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.48ed3d2f6fdf6bc9,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.48ed3d2f6fdf6bc9,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.48ed3d2f6fdf6bc9,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.48ed3d2f6fdf6bc9,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.48ed3d2f6fdf6bc9,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.48ed3d2f6fdf6bc9,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.48ed3d2f6fdf6bc9,"e",@progbits
+	.string	"(\265/\375 \017y"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\002"
+	.string	"\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.48ed3d2f6fdf6bc9,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.48ed3d2f6fdf6bc9,"e",@progbits
+	.string	"(\265/\375`\031"
+	.string	"\275\007"
+	.string	"\022\21668Pm\323\001\210\002\004>\213\276\246\245\177\256\307\026Q\017\025\267\234E\221\275"
+	.string	"\220\355\022\270\034?\331\342\266\333\226\206y\375l\262+\322+\376\2515\212\256\320\261\356&Od\n\347d\r\020\f\030i\351\2467{\275V\320\226\266\326\226"
+	.string	"6\203`\261\035\347\211\277\\\264+\302a!\316,\341\240\275\311\3114\325t\234\004\335t[K\257\251\005\327\032\331q[G\316\366df\231\230\225B\243]\265\016\265\336\005\306\n\235E\034b\022\177@\367\333\320\310>%\214\223\224\013\"1\020\3400\351\230(\0069\204E\030\217\316\036\374\361\312\007^\221{A\253RB\311\030\231\250?\3043VY\214U\377A>GW\341\003\361\342\202\212b\202\352S\374O\372_\362\237\3030\f\377\007\374\377\376{\002\t"
+	.ascii	"\257\354Q\005\243\374\305\232\013\326\b\247:j\265\205\250E\340"
+	.ascii	"\204\261\240\214\001"
+	.text
+	.section	.gnu.lto_.symtab.48ed3d2f6fdf6bc9,"e",@progbits
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.48ed3d2f6fdf6bc9,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,119 @@
+	.file	"rangefinder_lidartf.c"
+	.section	.gnu.lto_.profile.16fb3a3519f43215,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.16fb3a3519f43215,"e",@progbits
+	.string	"(\265/\375 \024\205"
+	.string	""
+	.string	"P\b"
+	.string	"\001"
+	.string	"\240\342\234\212\n"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.16fb3a3519f43215,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.16fb3a3519f43215,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.16fb3a3519f43215,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.16fb3a3519f43215,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.16fb3a3519f43215,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.16fb3a3519f43215,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.16fb3a3519f43215,"e",@progbits
+	.string	"(\265/\375 \017y"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\002"
+	.string	"\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.16fb3a3519f43215,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.16fb3a3519f43215,"e",@progbits
+	.string	"(\265/\375`\032"
+	.string	"\275\007"
+	.string	"\"\21668Pm\323\001\2102\006\017\232\nE\330bD,d\023\365T\321\301\331\003\226\027"
+	.string	"\262]\002\227\216m\347\333n\352\251\311bY\243\370\001\300\370O\255Qt\205\216u7y\"S\227\310\032 \030.\322NMo\366z\245\230-m\255-\001,\346"
+	.string	"\301z\264\023o\261hW\204\303B\344\262\214\355\255\243\033L\317\316\243\231\251\361\266\226_\317\n\332\235\364\350\306\221\\\1772K\230\340\352F\233]5\316\264\237\305\305\n\235E\034\342\021{@\367\243\221\221yH#\245\224\013*1\020\3308\341\230(\006\031\204E\030\207\234;\330\343\225\017xE\356\005\255\n\251\204A2Q\177\210g\254\262\030\253\376\177\234C\271\n\037\210\027\027T\024\023T\237\342\377\321\177\223\377\034\206a\370?\340\377\305\377N\t"
+	.ascii	"\257\354c\005\243\374\305\232\013\326\b\247:j\265\205\250E\340"
+	.ascii	"\204\261\240\214\001"
+	.text
+	.section	.gnu.lto_.symtab.16fb3a3519f43215,"e",@progbits
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.16fb3a3519f43215,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
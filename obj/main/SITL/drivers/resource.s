@@ -0,0 +1,182 @@
+	.file	"resource.c"
+	.section	.gnu.lto_.profile.7c243a7e6d07c72,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.7c243a7e6d07c72,"e",@progbits
+	.string	"(\265/\375 \023}"
+	.string	""
+	.string	"H\007"
+	.string	"\001"
+	.string	"\254\245\214u"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.7c243a7e6d07c72,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.7c243a7e6d07c72,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.7c243a7e6d07c72,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.7c243a7e6d07c72,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.7c243a7e6d07c72,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.7c243a7e6d07c72,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_ownerNames.0.7c243a7e6d07c72,"e",@progbits
+	.string	"(\265/\375`\215\007\315&"
+	.string	"\332F\274\01780*q\0160332\021\005U`ff\246\023\341Q\353\\\316U\231\350\267{\036\361\325{po\214\222\223\246\227\343k\333\343\035<\212\242\023\220\232Y\320\307\376\312o)\311\354"
+	.string	"\365"
+	.string	"\355"
+	.ascii	"1\226\355\032\302\253-ED\331\256\273b)E\304od\273\366r\265\034"
+	.ascii	"\361?\266\353\b\253\216#Zm\327\022P)I\210\332\256'\224\"#\341"
+	.ascii	"\224\266k\n\242\222%\340G\333u\205Oc%\bm\327\0268-M\270\333v"
+	.ascii	"}!S\322D\314g\273\336\226\214'\340\027\346\353s\266k\f\223\216"
+	.ascii	"'b\244\371z\232\355:\003$"
+	.string	"%\n\367\262]kh\204\206\"v)\333\365\206EI_\0233_o\262]s@4\346k\361\f\363\365w\273\356P\b\315\331\340\345v\375%\210\314\331h\230/\215\355\272\367G\351me\346\013c\273\366\340v\303\333\316\314w\335\256?\254\245\271\033\234n\327 \366\240\271[\254\303|Kl\327!\360,=\020\274\303|\301\266k0G\240s\235\275N\032o\312\233\243)\260\324\324^/\342\232\207\371\376v\235\337+g]\214\177\347\361\274\036\021\317\347\373<\333\267\375\333\373y@\037\350\007=\2417\364\207>\021\330/\n\241\3528\251\r\361\201\"\277\"\026\tZ\363\315Q\331\210\222\n`(\333\365\027J*\210sK\266k\234\240\264\0070\221\355:\367'\355A\234\363\261]k\267$\0048\326v\255\373\265$\204\030\307j\273\3369\002\335\236c\027,j\3479vi\3311z\301\2749G\257\030gh\273\336\202\243\254"
+	.string	"\267m\327\\m\224\025pu\266k"
+	.string	"j\322,\300n\266\353"
+	.string	"g\322,\304\2703\333\265"
+	.string	"2\304\013\270\001\037f\354\002\216\200\227\345\306\025\331\256\013l1\356\030\327c\2736\200\345\310\001^\265]\037\250r\344\020j\273F"
+	.ascii	"\033;\300\230\266\353\004P\214\035b\005M\226_\210\266\353\005"
+	.ascii	"\257D\371\365\266]3\370#\304\236\013\363\375\006O\344\330{\007"
+	.ascii	"\377\032\301\036\314v\375\340\307\022,\351\017Yd\001\344\240"
+	.ascii	"/e\321\366lQ^\016\252\254;TO\244\217E\205\276S@^\211\302\324"
+	.ascii	"\325e\026\005\016\323\024h\330\320\307r\345tm\221Ev\227\305\276"
+	.ascii	"\306\304\314\320\312\316\306\314zgfc9\310\314d\364j\220%\225"
+	.ascii	"=1\263\263\336WW.\2631f\326\303QVf\326\333\312j:LW]v;~\307\363"
+	.ascii	"\270\036\347\343}\234\315\333\374\315\3758 \017\344\203\234\220"
+	.ascii	"\033\362C\236\310\0259#\217\335\221?\362H.\311)y%\277\344\230"
+	.ascii	"\\\223o\362N\356\311Ay(\037\345\244\334\224\237\362T\256\312"
+	.ascii	"Yy+\177\345\260\\\226\317\372\036\357\343\201|\220\027\362C\276"
+	.ascii	"\310\033y$\237\344\227<\223w\362O>\312K\371)O\345\255\374\225"
+	.ascii	"\317\362Z\236\313w\371/\017\346\305\374\230/\363f\036\315\247"
+	.ascii	"\3715\317\346\335\374\233\217\363r\236\316\327\t\031E\331\024"
+	.ascii	":\013]\254\271,\\\327\\fUW\025\352\262\332\202E[]\006\242\301"
+	.ascii	"\\>\201\276\\v]\337\217e\211\247[D\315\234\266-\213<\201>\255"
+	.ascii	"\\t\213,\222\227\303\210?\024\030\026\226\262n\200\254\2528Q"
+	.ascii	"$\353\033\252\355V\026\242nklwy\305\331\232Ym\323\264U\205Z9"
+	.ascii	"x\372\200-\362\004\221\232y\227\333\223\007d}'\260\r\240\242"
+	.ascii	"\365\005Sh\345\3664s{\002[u\307\313\355\271#\256B-\225\365\375"
+	.ascii	"x9u\213(\200\374k\211\271\354\236\250\213\002\221\277\226\270"
+	.ascii	"\225YtE\321\337.\003[5\227\315\314\242.\213\266\030\246ZyMY\267"
+	.ascii	"E\002\321 /\263(p\250\256\355\320\307\272\\\271\350\266\310\345"
+	.ascii	"\366D\266\255o\025\252\347Vv\323a\212\262+2][\256\034F\f\256"
+	.ascii	"H\3400\200\211\250A\030\002\231\032jT\2523l\006\320\"\252\231"
+	.ascii	"\252\003\020(\202\264\321<Ul\027\321\025\2324\333b\216\206\263"
+	.ascii	"}\330\355v\311E\275R\336\003\201la\345\251\2247\023\021\257#"
+	.ascii	"\246uj\2214\002U\362\274\223\242\033\252e4\272\235\244\017\357"
+	.ascii	"j\201\n\003\307a\203\343\001\317,A\030\212\021\202\2179\315\245"
+	.ascii	"\025C\3176\304\340n{\t\341\367\334#\367\341\340\\i\267M\341\""
+	.ascii	":\026\373\224\346\203\334u\363@\226\334-(U\340\315\331%\027\354"
+	.ascii	"eB\205\035bf{\311s\211x|\202\220\227\351\013X>\302\023N\2059"
+	.ascii	"S\226Q\322b%fk\024\276\r\223K+\231?\324\266\177\353\242\034`"
+	.ascii	"@\212\337,\354o\330\310\335\016\365\023\376\342RE\356\342\367"
+	.ascii	"A#\231B,|\001\202\033=3\267\257\t)u\3674\004U\036\316"
+	.text
+	.section	.gnu.lto_.symbol_nodes.7c243a7e6d07c72,"e",@progbits
+	.string	"(\265/\375 \017y"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	"\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.7c243a7e6d07c72,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.7c243a7e6d07c72,"e",@progbits
+	.string	"(\265/\375`\266\005\345\035"
+	.string	"\226w\275I\240\024R:\016V\214\375(\344\007\371U\3276\013\016\377P+)\3335\366#\340\264\253\275\326\027\022\365\263\372\352\337`o\206\206\322\003\177d\"\266\200\337at`5\370m\316\tW\r\360\"\356\275\267\361m\375\264\225l[\231R\212"
+	.string	"\263"
+	.string	"\257"
+	.string	"\265\312\374H\207V\253\214\356_\360/\240A;@J&\365\213\355\306\323/b\377x\";\263\006\307X\221j\255\272\333\323\022\025\330R\333\2763_\354!&\220U#8g;`<\317\254\365|gzm\266\221\330\007`\337\264_\263\277\266\263\330F\263}f[i\333\314\366\230m*\266\303lK\261\355e\273\313\266\226\355,\333V\266\253lK\331\216\262\355d\033i\333\200\375\034\333K\266o;i{\227\313\345\322\366\t\333>\273\345(g\322\222\223\254\361\263\364\366\335\224\024%{be\263\324\227\262\017\365(\334\026\323X\317R\t\347\231"
+	.ascii	"\232N\177\311\022\025\207>ON9\262\257\035\232\245\276\223\375"
+	.ascii	"\246#\177\244\301\034\nm\374X\372\340<\323\374\316<\323\351+"
+	.ascii	"\251u\271@\336,m\271\220_\250\350B_r\031\326\372\342\301\024"
+	.ascii	"\021H\025e\255\241\321 \247\204\"<\"\241B~\220+\2147\234a\222"
+	.ascii	"!K}%\373C'z\022N\247Va"
+	.string	"\255\265@\211\257\"\242\245\366\223\216T\033\022u\214\003tB0\212:\214C.\3103 7Ko\364#\376\321\215\030B\004\327P\020\251C\265\326\037\275\350\004e73\342\302\324\343#\266T\301y&\265r\372d\024~x\202\226\326\252\214\035[\330\374X\352\217\331\247:\025\b\304\0348\226z\352<\363\\\247/f\006\031\236\005M\t+\032)\335,\365\303\354\203]\212\211e\232\331Rw\235g\346\222\247\037\245I\224X\321\227\327m\246\246jf\251\357e\237\353]\346\022\310\nq\251\233\3163\003l\235>\224\233\020\206\022\217\245.O\264p;5^\327\262\357\344Y\270$\225\326\331R+\3173uW\247\217e[.\237r,\025\320\304\312\026c\346\230\263\324\267\262\237|U\216\206\017\236\033K\215u\236\211\243:\035N` \210_\260\027\002\b\f\366nA\030\016>\352\t\023*(\300p\301\202\315\347\340\347\013\212"
+	.string	"\306\374\202\275\230\340oD\207\340\206\336\207\0160\036z\276`L\317\001\202\230\237\007\230\013\301\337\007\022\300"
+	.string	"\303\245\341:R\225\264\324Kc\237iU0Y\031\025\2272(;\2753\224\247\254\205\017\341\246\250X\305\254\245\336\024\366\257Vf\2113p\246,\265\030\330\351E\001\204\224Ln]fp\321ck\251\277D\022\220\266\203\305\325\322C\235~\226\004I\240\220ih-\307a\231\322R\037\315\376\326\317|nl\256\226\032\351x\372XtZJ\310x\\Q\312\250qc\305R_i?f\250!8%@\2268MD\206IA!\303\030\300\002\211\356X\007\021\200\235\202\002I\225\321\271\237\001\304\026\033\362/\206\321\320?\272W4ta4`\344U\275\001\324\3151\016\265l+~=kn\307WlD\244\216\200@Q\220]HQr\323yD\237dl\024t>+\226nXYN|p\263\344\204q\360&\330>\205\332!\035\353m0%\344\312("
+	.ascii	"zK],\373P\216\304u\244\036w \f\211\357\034\027\306\245ILo\245"
+	.ascii	"\020+h\225\004]'\231\\^v82\355\350\241\376qM>]\227\n\326#\323"
+	.ascii	"\241\336x\356\203\215{8/B\375\263\224\f3\310\205V\241%\234\370"
+	.ascii	"\222\330p\241\250\361j\260*"
+	.text
+	.section	.gnu.lto_.symtab.7c243a7e6d07c72,"e",@progbits
+	.string	"ownerNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.7c243a7e6d07c72,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
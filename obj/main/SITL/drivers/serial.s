@@ -0,0 +1,653 @@
+	.file	"serial.c"
+	.section	.gnu.lto_.profile.f3ecbbd9962e8db9,"e",@progbits
+	.string	"(\265/\375 \037\371"
+	.string	""
+	.string	"\033"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\003"
+	.string	"\004"
+	.string	"\005"
+	.string	"\006"
+	.string	"\007"
+	.string	"\b"
+	.string	"\t"
+	.string	"\n"
+	.string	"\f"
+	.string	"\r"
+	.text
+	.section	.gnu.lto_.icf.f3ecbbd9962e8db9,"e",@progbits
+	.string	"(\265/\375 \351\235\005"
+	.string	"\242\311$,pm:\200<\020z\315\254\001\323C\022\241\207\254\260\325\n\251\313\303\022\257!,UUU\021PU\325\037\241%mw\333{oIm\007\361\022\266\214\270\372W\005\351H>\334\277>\357\202\244xX\261\036.\032X\365\361'\316lF\332\355[\237\254I\267q\266_\321@\230?T\377~J\256\344\211T,\363\274\216Ji\3110\337\354\333D!\203$\300P\021\365<\365\333\020(`\274\276\236\342\374Q\302\251O?\037//\337\377\247\307_;h88\021\213\232\f"
+	.string	"0^\025\"\200\230 H0\023\004(S`\206I\367*kO\0256\231\344m"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.ipa_sra.f3ecbbd9962e8db9,"e",@progbits
+	.string	"(\265/\375`z"
+	.string	"]\004"
+	.string	"\302\005\020\025\240'\351~\373\377\377\377M \231\375\366[#\215\220\275eJ\001\036\370\2438\016Dx$\200\031\305\314D\031\235=\321\021\225\305\234\215\216\366\210J\235\213`6\330o\367\3723\374j\251\244\300\013\001\036"
+	.string	"8\t"
+	.string	"f`\270\005\343\330g\203Es\254\247\337\t]\245*\004\300@%h\236\030d\201A !\f\006\306\241\210y\314\250@<\231\310\201\025\242Z"
+	.ascii	"TG\2476\200Us9#&\312\231\212\\\230Ap^T\200!"
+	.text
+	.section	.gnu.lto_.inline.f3ecbbd9962e8db9,"e",@progbits
+	.string	"(\265/\375`\017\003\365\b"
+	.string	"b\r,1Pm\222\016H\243AD\220\355!\234yR\367\307b}\t\253)\304\fk\247\241\201\211n\2211\273\252\252\252\252\b\363\375\271\3456\373\355\223\275\345N\001_2\023\025\035#\321"
+	.ascii	"\007\027\222\231\320\221\245B9\310\232Y\232\311Su\377\005\251"
+	.ascii	"C\023\311\344H\343T\255\342\257\251\331\337WC\250GfZ\276\307"
+	.ascii	"K`T'\317\220\231\234\307\315\342\016\330\250\303\373\006\327"
+	.ascii	"@\222\321\201~s\017\231\020Q\302%\305E\tf{\252\256|\364MZ\233"
+	.ascii	"\204}\245\365\005\315\314\034\355\336MA:\021\030\224W(\207\203"
+	.ascii	"\347#\320_\252\325\266\205\323\360|6\006\0363^, \200\242\031"
+	.ascii	"\302\333\001\347\b\022\177\2727^D\262\006\361@\327\022\230\027"
+	.ascii	";\216\\\030\320\273s \226\314\265\031eX\022\312w\216\030\335"
+	.ascii	"\353b\n\221\t\274Zx\335\302\243\203\341pc\342y\016p\3047$W\240"
+	.ascii	"\213\035f\351\300\374\027g&\026\314_G[b\264\326Q\323\330\214"
+	.ascii	"o[\320\005\275\233\247\257cr\030\341\261\222\035L1\335"
+	.text
+	.section	.gnu.lto_.jmpfuncs.f3ecbbd9962e8db9,"e",@progbits
+	.string	"(\265/\375`e\001U\005"
+	.string	"\222\b\031 \240%I\007\377\377\017VU\325\244\252\031\340\005F\216#\307\377\267\247Yk\233\265\266\021\262\211L2;\030..\300\007\214\200\002\001uGJ)\335\252\203\033n<\007\2468\250\234\2277\250+[\267\316"
+	.string	"\305p\345\211z\0329\217\034^|<G\335\351B\335\312Jv%ok1\301\026kH\202\277\f1\026\004\033"
+	.string	"=\213`\337r\207`\237e\261\360\304\211\342\242\261\216\313l#($A\036\270X\317\305q\205\364\246F\314\262m\b\341\030\251\310\261LBaX"
+	.ascii	"p`\261_i\327\351\t\"\260\034J\003\264\211^\001\206"
+	.text
+	.section	.gnu.lto_.pureconst.f3ecbbd9962e8db9,"e",@progbits
+	.string	"(\265/\375 /y\001"
+	.string	"+"
+	.string	""
+	.string	""
+	.string	"\016"
+	.ascii	"\271\004\001\271\004\002\205\004\003\231\004\004\231\004\005"
+	.ascii	"\231\004\006\231\004\007\231\004\b\231\004\t\231\004\n\231\004"
+	.ascii	"\013\230\004\f\231\004\r\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.f3ecbbd9962e8db9,"e",@progbits
+	.string	"(\265/\375`\241"
+	.string	"u\004"
+	.string	"R\305\022\036\2407\303\001\340\277xVUUUU\367\354\376\377\377\377\377k\210\210\210\210\bm\262\267\224)\377\317\3264fA(\207\304\200\024\216E\200\312\007\206@\035(\007\364\367;59G\305\234?\345Q\371\253\307\262\313\376Z\260\323\316L\004\036"
+	.string	"Q\240"
+	.string	"\360\301\300\366\306\nN"
+	.string	"\204\203\201\323@\r`\006\006\001\366"
+	.string	"\306\200\025\300nah"
+	.string	"\354\300`"
+	.string	"\023\240+\030\f\f\242\250\305@\020\007\307x\266\240\354\335\325j/O\337\024\247"
+	.ascii	"C"
+	.text
+	.section	.gnu.lto_.lto.f3ecbbd9962e8db9,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_serialPrint.8.f3ecbbd9962e8db9,"e",@progbits
+	.string	"(\265/\375`\256\001\225\020"
+	.string	"\366\237oF\360\262&\035\"B\017\313\213\375d\"\221_.\001HAG%\"(uh6\202\320\247gdM=\265\335_\031y\177\005*1\256%R\030\253\236\201g\340\365f\266\242q\034a\302\255\337\361\357\200\032\021B6\2212\245Z"
+	.string	"W"
+	.string	"^"
+	.string	"\273\241\002\227p\217\016?@{\344N\242=ze\017\025h\001\320\231\341\361\261\273\236\222p\226\253\307Ls\345\353\017\027\b\363\230m\255\032\023#`+\033\305\210~\016{\322\200\254\314z\236\036j\270P\330\\\017;\202\024B.\320\346\271E\330]\247\013\344pk\267=\301\366\003;3\026\371\353\017\371\316\315m\017\377\370\360V-\2351\375"
+	.ascii	"[\017\022\240\335\232\" \033\024\177N|\347\267\357\363\274\307"
+	.ascii	"\356\314\362\0276 \242c\261\273\307\037\346\316\f\034\254\276"
+	.ascii	"\323\222\355\007\b+X\020\355\206%\217\036\331\031\272\f5x\332"
+	.ascii	"oq\027\253\277^.`\367\306\307F\272\351aO\300Ch\203\nV\266\273"
+	.ascii	"\233y$\257!\352N\335\215h)\214\3513(p\2732'\276\f\013'\025\355"
+	.ascii	"\261S\0028^\357\361\205\307P\341v\367\304\367AI\361s^\264G\021"
+	.ascii	"\r\221\243\363\342\364\252\035t\314\004\211\311\"\205\001\324"
+	.ascii	"\002Uq\354\220\225\037\225\210\021Yol.\335m\031\025J\371\255"
+	.ascii	"\250\324TB\221VT\250\023\347\222\t\n\351\364\231T\236\3523e8"
+	.ascii	"}\022<\324\211\224\342\225>\225gr\300)\f\246\317[I\245>\257\013"
+	.ascii	"c\2567EA1\312\212\212\343\230n\352,\243\252\322\370-\032\247"
+	.ascii	"\337\001\313!\2231\247r\232<3A|\032\032H\317\361]\264\307\324"
+	.ascii	"\274A\003b\3015# \240\202\2212\343\001\241\300\252;\374eh9EH"
+	.ascii	"\037\277T\202\371B\263\017%3\324%\344c`V\241\346\241iLmV\300"
+	.ascii	"2\022K\240%r\271\341\260\035\020!Xt\354:\202\340\321\304a(\344"
+	.ascii	"\262\215\b \212\272\026\227Vl\371\330;-}\002"
+	.text
+	.section	.gnu.lto_serialGetBaudRate.9.f3ecbbd9962e8db9,"e",@progbits
+	.string	"(\265/\375`1"
+	.string	"\r\b"
+	.string	"\222\21777Po\322\001 ;\263\322\314\240\004\016/X\276\350\025X\374Y\205j\304bk\b9\007\203\266\214`3\203\020\202\252\212\210\224\240\026\257\365j\343!f\274\303n\262wJ\001V\205Q\035\r\273\244+N\003uQK\233\032\265 .\3120\261\213r\230\025\325&\247\300\331\203Eg'\313\350\314\324\275!\324\200 \205\355\210\2238\271\273\n~\310\204\204\334x\364=\0203\002\275\222]?\017b\330\237\026\212\f_\3777aF\006Pv-J-\273\022O8lov\306\366{\366G\377\330^=\017\330\025\245\230\354\326\003\033\310GWi\333\357\270\307fn\252\032]\002I\205\b\313n\235\232\023\\\036\247\013\\\036a\306\271?\316?\3107$\225P\367\371\003X\330]\277Pwq\303\333\336\330F\260]\022\f"
+	.ascii	"2\003\302\260\2268\3742\203\027c\273kx\306\004\016i\214\006L"
+	.ascii	"\020p\242G\265\322\021&\031"
+	.text
+	.section	.gnu.lto_serialWrite.10.f3ecbbd9962e8db9,"e",@progbits
+	.string	"(\265/\375`\217"
+	.string	"U\n"
+	.string	"V\224H= \3458\035'!\210%\300\200\310\200E(6\254\250}\b\331\317\200\222\024\374@\324\"\024!n\2036V\356\345\370\006\224\254"
+	.string	"\204@\001\032j\324\017\240\270L\266\201\322\334\304\270\255\334)\0055"
+	.string	"5"
+	.string	"9"
+	.string	"\273#\307\021\331\247\307'`\237\331\017\260O\213\266\200\205S\301\f\352e\300\356njr\361R\364\317r\202\224\252t9P\261\273\226)\225\310\255\267\375`\333c\037\"\376\370co\375S\245uJ\313\215\3643m\004\341\265\033\362\"\260\256Ysb\373\232m\225\266\004\205\370\261\303\272K\022`\342\322\276\312W\304\267H7\330]\311\320\004'-\031SU\016\252"
+	.string	"\306c@\331.\210\307\207\361\370F\330\247T\005"
+	.string	"\336\270\313(\333]\217\337\"\n3\026\t\373\2746\260RZ&\371\262\307\222\324\022\373\233\335]\353\312\001\027\234\354\270\320G\024\206\274\314\\'\343\343\201]\270\205`\307\341\201\026[\310\373\2006\016\f\267\016\203?\215\016\334D\337\007n\332\270\337\254\256<Q\\&\375\260&U\247Z\252\035\002\016"
+	.ascii	"2\241O\034X\\p\300PJmn\351\254\322\342\316CX\351\032\020\025"
+	.ascii	"\006\203\271\001*J\270\303\213v\222\001"
+	.text
+	.section	.gnu.lto_serialWriteBuf.11.f3ecbbd9962e8db9,"e",@progbits
+	.string	"(\265/\375`\204\001\305\017"
+	.string	"\366\035kF"
+	.string	"\221(\035\277\204\\\364\205\232j\3270\031\356\035\362[e*\326\372\033\335\t\246\361\211z\227\t\277\233\265\206\204(}Vz\264_y&f.\355\025\201\335\3613\001\200E`'\366=\201\020a`-R\311\336r\247\024U"
+	.string	"V"
+	.string	"W"
+	.string	"34\273a\211I\270O\207\027\331>\271\207l\237\006\355\032\0062\004\230\261\241\246cw;\035\001\202\n~J\215\240\377\332;\255W\352\223k\271\364\274Z\2562\304\305\205\315\307\213%\023\330\230\b\361\332\243\353\265\212\021"
+	.string	"hw\035[\257\017\367v\333\020l\203\354\333\004?\367\230{\236v\313\031\035e\364\005\f"
+	.string	"!bc\327C\316\216\255\2311b\217\271}\026\276L\314\nh\305\301\001\316\315\215\335\220\344\323\f\270\317\177l\353\212\317\300\323,C\202,KD\007\232\335-\361\002\356\363\200\214\341\312\016\005\217\366Q<\005x\031\313\t\354\302\002\237\350\321\216r\352\250\366T\324h\320\024\310K\217\231\236\264E\2150\243\301\2128\266'\034\006\211\333e\235\370/0\230T\266\317\250#7\256\360\031\025nwO\374\026\245\023G\202e\373\274\"\210\235\220\251b\216\035\256\242\302\330/\340\302\003\207\025f\237\366{\036\376\235\313\002)G\225,\230D3\204\n\241HOT\n\241N\245\021g\221\t\205\320\350\363N\335\351\363.\214>\224\2564\n\221:\321w\352LFlJ\361\276\016e2}\335'T]a\2657\310Q\243\322\325T\030_\346\017J\274\304\216NuYF\217Ju\331\037\366$\304\267\274i\352\033NNL\006\036"
+	.ascii	"1\003\367\334Q\343\340\033_\031E\321\004\361\020u\026\372\337"
+	.ascii	"XK\316,\247\024\344\226\342\276\254\335Yc+\264\264\321\255M*"
+	.ascii	"B9\210\001\314\351\200\rh\242\004|A!\270\f\214\bPQ\304]\336\331"
+	.ascii	"dS\230k\264\n\n"
+	.text
+	.section	.gnu.lto_serialRxBytesWaiting.12.f3ecbbd9962e8db9,"e",@progbits
+	.string	"(\265/\375`p"
+	.string	"\225\t"
+	.string	"F\322B;0\345(\035"
+	.string	"\360'\031\235G\241\032p\021\275[Y\254f<r\na\234\372Z\265\372\373\\c\rb0\033\005\261\23100\320\004\302\372\207{\350aMa\321\021 vo\262wJ\0011"
+	.string	"0"
+	.string	"1"
+	.string	"6aUd\365"
+	.string	"\200\203\245f\267R\316\013\346%v\202y\031Cn:4\371O\271\202\213F\265:\035n$v\327P\265\362\270\343m/\330v\260\037\020\0304\214\320\337\b\304\034\310\354v\274\002,\214|)\261]\2625\333\020\332o\035\245\364J\372\300.k\306e\2676\230!\273t\315l\373&?)\005\361d\233\342.P\213F\2271/aL\360\305W\276l7\005\341\253\21402\222K\2374/\037\rFZ(\370\262\353\tF\020\373\330F\226\347\353\217\005\333'\344\021}!.\363\247S\341\341\274\355\243\237\267\2158o\202\2068\017\210~\274\217v\020\334Yl\036\025u\235G\265\272\367\214\034T\334\260\006\261h\030g\214\370H\005\016"
+	.ascii	"2\003\302\260\004\346f\220\035\330\233\322\\q\3062\327\360\220"
+	.ascii	"\t\034\250\361\0320\361\340n\217j\245#L2"
+	.text
+	.section	.gnu.lto_serialTxBytesFree.13.f3ecbbd9962e8db9,"e",@progbits
+	.string	"(\265/\375`s"
+	.string	"\245\t"
+	.string	"\266\322C<0\345(\035\200\213'\025U\207?\030_\006\2542Z\311\f\217\315\245\017\013A\314\345\330\372\365\367\271\306\032\304`6\nb3a`\240\tD\235\026\245,J\300\251g9\322\366\336{\247\0242"
+	.string	"1"
+	.string	"1"
+	.string	"6\305J\262\232.\216\r\027\002\273\225rn0/\343\013\346%\034\271\351\317\344\237\345\021\005\004\200ju\372\323D\354\256\237j\345q\303\333^\260\355`\177 1>?\370|\315\374\020\200\020\263\333\361*\260\001\344\314\211\355\222\275\261\375\236\375\326WJ\257\244\023\354\262\006\310\354\326\0063`\227\256\230m?\345*\245'\333\023\207\001\275dl\030\363\362A\005[\274\245\303vS\017\276kt\201\231\\\372\244yyxP\322B\275\227]O\017\212\330\217\273\273\206,\317\327?\331'\344\021u!\r\363\247C\341\321\270\254\243\035\227\2154N\202\2064\017\210~\270\216v\022\274Ud\034\025m\033G7u\357\t9(\250\341\315\213\320\017N\b\021\222\202\001\r"
+	.ascii	"2\003\302\260\004\346f\220\035\330\233\322\\u\3062.\243\0245"
+	.ascii	"^\007&\036\3345R\255\230\204I\006"
+	.text
+	.section	.gnu.lto_serialRead.14.f3ecbbd9962e8db9,"e",@progbits
+	.string	"(\265/\375`e"
+	.string	"e\t"
+	.string	"\346RC8@\217\322\001\230\265(~\343\005\304\200U\304\323\f0\321\2140\266Y\334\335\037\255\336\376\225\305\0061\030\316\016Y\364*\n$\303\2510\003\263\007\\BK\314\344\357M\266L)2"
+	.string	"1"
+	.string	"2"
+	.string	"\332\005\346\245m38\230|z\b\302\232\035\031\0300\231\335p\213\037?]O\376Q\236\225l\304V-\324U\003\261\273\326UK\343\216\267\235`\273\301\276\003\236\177\375Y\246\326\250\276f\222\300\024\304\354\262b3\373\"]Fl\233\354\215mU\373&?1\375Uz\300\256\213\245e7\\\260\202v\351\360\003\3632(\333\240\303<mW\325\361W,(H\363R\343\201\301\253\220\264\335\355\370)\243\nM\344\322/\315\313G\202\220WJcv\210\322\350a?\333\335ut\005\334'\344\021\201\241N\363\207#\341\351>\016\334\300\217\033u_\304\026\352<\240\355\363\201\033\307\300\336\004\367m\"\317\373\266M\270\367\214\b\251xa"
+	.string	"\315\2425\316\370\300\241\212\001\n"
+	.ascii	"2\003\302\260\013\314%`oJse\031\313\270\214R\324x\250\016aL\327"
+	.ascii	"$\003"
+	.text
+	.section	.gnu.lto_serialSetBaudRate.15.f3ecbbd9962e8db9,"e",@progbits
+	.string	"(\265/\375`\232"
+	.string	"\275\n"
+	.string	"\266TKA0\251(\035\210\306\213a\213\252.(\273%\313\336\265xF:\035\002\234\262W\017$\332\020\356\333\254\305Yd\327~r\214\366\021\200\266\t*\2510\023r\241x\305U+\277\222\320\376\243\373\223M\366N)5"
+	.string	"9"
+	.string	"9"
+	.string	"a\205)\350\247\303;d\237\364\r\331\247A[\302C"
+	.string	"\373\325\t\tk\302\356V\271r\360\021\364\277\372\305t\"=Z0v\327\321t2\271\345mO\330\276\260_\003W\375\363\251\037\303\242\243\214\276%#"
+	.string	"\001\342\301n\311\253\302\272\246\003\001\266\217\261\035\303#"
+	.string	"\257\372\360e7\205\202\005\375\224\300\036\355\033\370\001\360\251\321\031vQ-\006\273\001\322\030\224\021I\262\335\371\202\216\356\212h|\005 \036\242\3543\312\207\b\376\236@DwW\343\263B \032`\224}^\312\006\255\001\251R|\331!)J\025\373\330\356\256%\312\016\333G\323\340\200\264\r\272m<\332\347\363p\324\233\f\207\306y\333W?o\013q\036\247z8\255S7\336W3\021\356:6\257~\272\316\253\230p\217\255D9\243\200\253$C\274\020\247\304\244c\017"
+	.ascii	"2\241;\034\030\270P\224\332\021\323\001Y\013\241`B0\327\330b"
+	.ascii	"\230\027\204\317\324(\270,M\215\006wy\321N2"
+	.text
+	.section	.gnu.lto_isSerialTransmitBufferEmpty.16.f3ecbbd9962e8db9,"e",@progbits
+	.string	"(\265/\375`e"
+	.string	"e\t"
+	.string	"v\022C<0\345(\035\200\213\007\323e\310?3\232I\374lb[\300\323cu\305a\331U\272\306\366\372\217\317F\203\030\314FAl&\f\f4\201\302\234\207+\003%\341\364\204G\332\336d\313\224\0020"
+	.string	"1"
+	.string	"1"
+	.string	"\004\362\321\266\035 H.\375+Q]\004\244\303E`\367\233\220\344\245k\311?\313\261\224\217\230\324\312t\325L\354\2565\265\362\270\341m/\330~\260\357?\206\251\025\252\257\221"
+	.string	"\004\034\300\354\252^\0056@\234A\261M\2627\266U\355\253|\205\364\326\350\003\273\254\0012\273_\203\031\262G\177/\220\217\331\003\320d\273\342\256\317\313\006\247!\037\025&\030\343.^\266\213\212\360[D\031\331\311\243?\222\217\207\006&\255\223\276\354\317\244p\304>\266\273k\310\262|+\232\007\324\ty\240-\263\207c\321\331:\315\233^\247\211\266\216b\202\266\316gz:or\020\314]h\335\fq\\77\337\336\022*\234 \2077\212A+\224P\"\004\025\013"
+	.ascii	"2\003\302\260\004\346f\220\035\330\233\322\\Y\3062.\243\0245"
+	.ascii	"\036\252C\030\3235\311"
+	.text
+	.section	.gnu.lto_serialSetMode.17.f3ecbbd9962e8db9,"e",@progbits
+	.string	"(\265/\375`\226"
+	.string	"u\n"
+	.string	"v\024I=0\345(\035\200\213\307\220\241\037\222\265\230y\261\231\26387dp\033=\362\260\355`MTk\270\217o\272A\f\306+(\331\r\003\003\030h-\244E\213ti2\310\026K>\331d\357\224\0024"
+	.string	"7"
+	.string	"8"
+	.string	"\f^\340N=\276`;\345N\260\235Z\264\003|\f\331\277X\0320\001\273['\310\305K\321\377\353\232\224\352t\231y\330]\313\224\212\343\236\267\255`\333\301~\r?}\353\3274i9\245\237\331^b\016d\273\033\263\001\033\243-\"\266\277\261-\307\233\210wUX\263\353!k\340N\023\264K\373$/\021\3372}`w\245\262\262;\006\035\031\363d;\364\224\217\333\305\350\370(\026\023\245\355TN\003"
+	.string	"\016\177R\342v\267\343\303H\024\034\313\264\235~N\026\227\221\026J\316\354\361$\347\207}mw\327se\337\025\035\350\013i\335G\344\031\205\"\217\363\207\023\341\361\300.\254!\330\221<\020TE\236'T?`X9\b\376$:\260\216\276\017\254\233q\257\355\\\031\002&\206\232\027\026\220tj\323rz\023\017"
+	.ascii	"2\241;\034\030\270P\224\332\021\323\001Y\013\241`B0\327\330b"
+	.ascii	"\230\027\204\317\324(\270,M\215\006wy\321N2"
+	.text
+	.section	.gnu.lto_serialWriteBufShim.18.f3ecbbd9962e8db9,"e",@progbits
+	.string	"(\265/\375`p"
+	.string	"e\t"
+	.string	"vRA7@o\323\001x\r\374v\277\2640\314q4\037\322\226\333x`\245\325\315\3226\267\306\253?\364;\025\324\331\320\210\343(.\b\377|\250\265\373)\242v~t\221\266\345N)."
+	.string	"2"
+	.string	"/"
+	.string	"/\250NY'\250N9\264[>\202\354E\"\032\244\323\356^\372\361\3602\364Oz\200\370\361\\\0028\354\256\245\370\341\270\365\266\023l7\330\327\024J\210\355gl\253\311E\341GN\231\002\213\321!\226vWc\006\353\024\302\224c\305i\341\322\376\310I\302\207\314\362\201]PIiw\324X\301:\3451z\341JNU\225jw(\344E\313\023\027S\206z\354\321#\325\303\376\334\335\265\202\354\217\376\371\361\327\207~YU\247\025\003\225\335\215\030\2305\005 \327\3512\n\0031\316\3242\016\003?n\263\234m \260\315\323\276\353\363\264\211\315\343\\\334\206E\\\231\367]\233\003w\022\232w\201]\347]\231q?WA~x1Y\004\016"
+	.ascii	"2\241\017h\340\341\302\033\327\200\001\033\235\022b\300\225%"
+	.ascii	"\214\013T!\270\f\214PPQ\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_serialBeginWrite.19.f3ecbbd9962e8db9,"e",@progbits
+	.string	"(\265/\375`\264"
+	.string	"5\013"
+	.string	"6\225M@ M5\035\324\b-\030\354T\002\354H\330Ds'\020\303\266\006\244\262"
+	.string	"d\203C\240&\0241\364i\234\036m\254\030\b\220\230\200\200D\246@\274\267\0265\377"
+	.string	"\300\263|`=>\267\245M\266L):"
+	.string	"8"
+	.string	";"
+	.string	"\037'\354O\342\002\324\211\335\315\244\204\177\267\244~\376M\207\200\302\316\255\320\245%\021uPY\204\240\265\241*E\270\351\312 \374\250>"
+	.string	"\354\256\025\024:\270\347m\007\260\335a\237\022k9\262/\376S\252U\325\177<B\"2V\273\rV)65CT\210\330\276\332\277p\f\337E\316/vG\036>\354\216\034\326\300>=\036\343\372\304.\271>\375\331&\002\316\\*\005\234J\200\212\3026wT\006\333\005+\376\006\005\336\346\372T9!\341\003\327\260\301v\267\342g\320$\300(|\372\234\353\363r\206#,\210\036]\331cG%\311\276\265\273\001\332\005c\321x\230\r\363\205B\300\262u\232\227y\235\206`\353\006d\230\315R \273t^F\231\2303\240u\231\206\343\272,2\356!\244<\362cAtJ\253t\005\207\007)PvTU\022\201\220\222d\007\021"
+	.ascii	"2\003\302\360\314\302\242mP\210YVh\253q\310\034c\002VjGL\007"
+	.ascii	"l\231 \nF]\302jV\243\305]\236\252\311)\232\332\003"
+	.text
+	.section	.gnu.lto_serialEndWrite.20.f3ecbbd9962e8db9,"e",@progbits
+	.string	"(\265/\375`\264"
+	.string	"M\013"
+	.string	"6\025NB\020mj:(*\302H\334\353\005`\316\3521\2173h\270-\340\2301J\317\264DO\032n\225@\241\013/\376\220\2409\275u\016\036"
+	.string	""
+	.string	"\270\002\n"
+	.string	"8D8\017"
+	.string	"@\260(\034D\204,m\262eJ\001:"
+	.string	"8"
+	.string	";"
+	.string	"\037\037\354Q\252\003\251\022\273\253I\007\007\177I\005\375\237\036\t\211\236_\013.\257\211H\305\252\020\303+\203Ub\360\323\025\201\bR\205p\354\2565$*\270\347mw\330\336\260_\tk9\262o\372\247T\253\252\017\201H\370@!\261\233\240ubW\323C\004\211\355\253\375\n\267"
+	.string	"\336\324\271\305\356h\003\207\335Q\303\030\331\247\307_`\237\331'\330\247A{D\326`*=P\"B5a\273{J\223\355\206\026?\203\201\217\203}\252\244\204\360\200c\340d\273k\361/l\nd\020>\375\016\366y9E\020\024L\037m\331\243G%\311\376\265\273\001\033&s\331|\031.3\246\002\340\302y\333\247}\336F\200\363>\264\fw\t\240a\274O\253P\334\t\330<m\323u\236&\031\367\023V\037\t\272\":\245U\232BC\203U(=\312*\211:HI\262\003\022"
+	.ascii	"2\003\302\360\314\302\242\255P\b\2611s\t\275\032G\3171fa\245"
+	.ascii	"`\304\024\301\226\261\242`\324%\254f5Z\334\345\251\232\234\242"
+	.ascii	"\251="
+	.text
+	.section	.gnu.lto_serialWriteBuf.part.0.24.f3ecbbd9962e8db9,"e",@progbits
+	.string	"(\265/\375`\345\003%\033"
+	.string	"\206\362\255H\260XQ:\320\025\r\016K\366(\302\022&\213\255\335\305\350\2339@x\345\323,\256<\030\306Q\256\017j\361\361[`w\364+;`>\252c\241u\241\365\306\215\241H\345.\360\017\016\305\243\"\006\003\377\255\021B6\221;\245\222"
+	.string	"\240"
+	.string	"\222"
+	.ascii	"\270=\202\023\323`\316\377r/\342S\363\253-\210<\247}\"W\322\275"
+	.ascii	"\210\317\001\324j\244$X\353\357\346\324\257\362\324\277\023\030"
+	.ascii	"O\313\013\030O\355\013\261\235\263\271\374\207\243\022Ygs\251"
+	.ascii	"\351\271\246\202\226\302\324Za\247{\303kr8\034\016/\376\356q"
+	.ascii	"u'G*\356,u\376\233\276R\341\3739\031\264\233#k\307\213S\232\035"
+	.ascii	"..\212d\217\205\216\031_O\204 \254\202z\360s\310\307\233+\340"
+	.ascii	"\263\300K\222B\255\325\337\301\270W\267]\303\266\005{\275\004"
+	.ascii	"\377\007<\301\220ZY\f\305\324\"\n\225\364\247G1\315\206G\243"
+	.ascii	"\202\2074UUy\277\227\315c\332\211\006\b!\001\n\301N\357\344k"
+	.ascii	"\337\207r)\2367\361M\2170<vk\311\243z\336\304\177\202\340\007"
+	.ascii	"\220Z\353\235\230\201\203\334\241l6?4\025H\313\024\003\007=\207"
+	.ascii	"\262\325Hx\342TU\341OW\342\007\357\304\0047_M\276\023\023\034"
+	.ascii	"\005 !\fB\252\252Z\177\257SO({\246\337\224\263[-\213\363L\271"
+	.ascii	"_\365\021Y\\:\022\335\2238J\244\251<\033+\202\265\326\b\345\251"
+	.ascii	"\215\270\363\300#\001K\356\267\004\215\361\255\3348\370H>n<\035"
+	.ascii	"w\345\003\314\220\214\335\034\322M\002\245\347\023M\033\305}"
+	.ascii	"\360\001\254$\001\251xSh\002\363\353]q#\024\361\366\247\303\253"
+	.ascii	"x\240r\342\303\316x\272\233 \307\245\f\342RB\224\265\362\036"
+	.ascii	"\370S(b>\222l<\235{\251+0\262\024Di7\207\336\213\265\326\272"
+	.ascii	"{\344=\004\034\302\252\271F\336r\024\016\223\274F\366\201\377"
+	.ascii	"\314\231~\031W\353L7Kfz\265\232.\305i\3225=\322\326\264\310\232"
+	.ascii	"\336\325\364\374/#d\263\304o\263\036\232\214\306n1\021b\216l"
+	.ascii	"\026\273\331f:\245e8$b:\265\034\033\314V\3131\241S\023\001\233"
+	.ascii	"\351\304v`\262\232\r\206s\300\264\02295\330\215F\253\301Z\266"
+	.ascii	"\347\177\241K\225\335\002\221{d2J9\003k\242\256\245;d\261\224"
+	.ascii	"Y\031!m-k\207^g\355\374\002\234\262\237`CHc\334#\333\013N\327"
+	.ascii	"\265\344\225\024<p\316\332\326\315\227\247\0243\200\346\320\006"
+	.ascii	"&\271_\257\326\255\242\336\376dx\026\r\263\017\253-@\025e\020"
+	.ascii	"\307\262S\326Z\037\370WPl\360\331G\375H1\224\306Q\250A8\246\034"
+	.ascii	"\"\206\031\021\211df\306\351\200\002\231:\272\r\020h96\035k\206"
+	.ascii	"\201dy\245\031(\360\345\031\332\341z\275\312\262\"\212|T\020"
+	.ascii	"\"\247\300\230\2055\373\345\3761|\277\330\254A\006\245\360\r"
+	.ascii	"\212\321\202\334\320\206\007\272t\206\205\304\311p\322\216\273"
+	.ascii	"\374\f\305P\204\222@\224\320\216\241\t\301\201\272ix\247\b\200"
+	.ascii	"\236\021\237\213\310\212\022&\255%\202\301\365\2614\323%?T1:"
+	.ascii	"a\376\257<Ls\374\304\216\235\025\377\236VY\307\3513\013\237\326"
+	.ascii	"\341\265B_\244\354\004\021\033\374y\034\261\350\020Z\027LyN\304"
+	.ascii	"\004\246\002"
+	.text
+	.section	.gnu.lto_.symbol_nodes.f3ecbbd9962e8db9,"e",@progbits
+	.string	"(\265/\375`\353"
+	.string	"\275\006"
+	.string	"\324\b\347\001"
+	.string	""
+	.string	""
+	.string	"\002\030\177 \257\377\372\006\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 \b\177!\360\372\2508\272\200\202\002\t\177\"\200\200\200\200\004\n\177#\013\177$\362\375\231\027\f\177%\r\177&\016\177'\017\177(\020\177)\021\177*\022\177+\023\177,\024\177-\005\002.\201\204\004"
+	.string	"\265\006\004"
+	.string	"u\004\001\221\205\327\307\003\001\225\001\004\003\225\001\003\004"
+	.string	"\342\001\004\004\303\376\236\020\005u\004\006\007\b\t\n\003\013\004\"\004\f\321\231\263\346\002\r"
+	.string	"\037"
+	.string	"-\022M\b\034\2511 \037 \f\020a!\227+2`.\320\340\200\353j6\343\217~\b\320\036\336Z\226\006\364"
+	.string	"\337"
+	.string	"\337"
+	.string	"\337"
+	.string	"\337\230\352\033\360\r1|\003|C*\304\200?;\t\240\212\270\316@"
+	.ascii	"\2319\230c"
+	.text
+	.section	.gnu.lto_.refs.f3ecbbd9962e8db9,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.f3ecbbd9962e8db9,"e",@progbits
+	.string	"(\265/\375`\226\030\355i"
+	.string	"\312\253\260%P0\222J\032\016\224\364\324S\001\024$8\204?\311\323\360\317\271C\354\305A`\021"
+	.ascii	"\341\274\241\032\t\017\362\324\216+$\026\204\344\314\336v\004"
+	.ascii	"\344T9y\030UU-~UU\325\247\242\032Q\004\267\343\201\001\200\335"
+	.ascii	"?\357\253\330P1kE\306\336R\246\356\001G\002X\002-\334]\341\263"
+	.ascii	"\273\"\247L\211\220K\227~\207\352\337V\314n\r6\0321av\3264\317"
+	.ascii	"\fW\237&!I#\234\276\206\252\342\314\254'l\b\023#`\276fi\320\t"
+	.ascii	"\r\016\247\373e\273~\316\024\223@\274\350Py\3212\305\351v\371"
+	.ascii	"iStcr\372\027\324\335\262c\273n\331\277\\\226\354\351\326\261"
+	.ascii	"\225\335k\017*\364\001M\214S\025{B\227\256\220n\205t?A\375W,"
+	.ascii	"L\247\211\365\304\225\3047\354\307L\033\262\t\247\013\266]9S"
+	.ascii	"\206\b9\335,Oc\342-\3161\356e\251\217-Yh\234>\004\265\201\357"
+	.ascii	"\227\027O\0214J$\255|\275\376\026\020\034\315\256[\253\273S\360"
+	.ascii	"`\t\tjq\372\267\357\354,\341\340\2768\375\267\353\337\254\325"
+	.ascii	"Z%J\214:\366W\367\032\204~\341q\206\204S\2564H\02620\234\336"
+	.ascii	"\002u\267\266\312\332("
+	.string	"vC\212\004Q\343\364-\324/\225\017\200l\b\336\243\236\325\257\353\236\320\251\033\200n=\330=\305\377\004p0\340\3473\036\250\023\377\255\374\273\343u\236\037\rJ\272\316\217\366\374\007\363\257\216Y\027t\377\223\371W-\3631p\376\237\3717\2479\367\337\355_\023o&~\226\333\341\320\346\177\334\277\272\313\261\371w\206\342\377$\376\365\t\373\031\314\356\3474\377^\360\234\237\333\376\215\361?\316\277=\023<M8\320\317e\376\215\372\027\352_\342\277O\377\366\277;\374\253\303\2779\374\213\303\2776\374\233\364o\r\377\322\360\357\357_\033\377\"\375+\343_\336\2771\374{\364/\f\377n\360\357\013\377\272\360\357\317\277 \374O\372\337\345?\233\377-\374_\373\227\205\177W\370W\205\177S\370\027\205\177O\370\327\350\337\242\177E\3707\204\177?\370\027\350\337\016\376\345\340\337\240\377C\377\317\376\377<\237\317\347\217\222\371Q\004~"
+	.ascii	":\274\305\\\254\344(|\004\257l\205\247p\025\246\302PX\nk\355"
+	.ascii	"\312Y[E\212\021o\003\022\304\262\241U\214\252\027\327\216,.\302"
+	.ascii	"Fv\244A9\371\310Y\234\\/>\303\265\247Jp\243\300\216\231U\006"
+	.ascii	"\245\"=\252\346\211\223\257*M3)\02351\"\270\t\007uS\322\216\230"
+	.ascii	"\231Q\217\212Q\217\232\361\222\235\023*\251%`\254D\251\036\315"
+	.ascii	"R\217.Q\217\022Q\217V\0319VN\222\210\255\266\345\317.NV\032\021"
+	.ascii	"N\217J\251G\205\352\371M=\257\251\3473\365\313=\241\343!V\251"
+	.ascii	"\023\027.G\266\324\357\312?\260\225n\214\224\266\302B\316VJ\302"
+	.ascii	"\226\b\202S\356\301A\236aJ\224q\312>\330\207]\023\340\037\347"
+	.ascii	"*\006\362\034\341\332+#\201s\205\213S\240=\241c\216\242~\023"
+	.ascii	"\320\241\317\347&\240\373\333\333\274\fq\025\206\323\363\022"
+	.ascii	"*\236\352\031\0169\002\205\247\330\230\245\237k\234\256\303\235"
+	.ascii	"\303\302\206\210\026\226\025K\321D\354\224\013\215j\354\b\242"
+	.ascii	"7\334T\234h\332`A\223f\341\322\300x\270_\273\254\002\352!\327"
+	.ascii	"ZR\312\224\375\322\321$\306\211\266\314\24740W\264\354\331.\253"
+	.ascii	"\326\246\322i:\243\032\213[\255\237hn\335\274x2\356@5]q:\360"
+	.ascii	"\257\022\354\264j\333\366\342\311\330C\256*\016\220!\033\023"
+	.ascii	"\022\327\275\376\347\035\f\305RLd\036\370\211\243\270\310:\230"
+	.ascii	"\307\256\354\304\301\263\220\233\216b\355\036v\267\002(T\346"
+	.ascii	"\332\022\256\001\322\357\0335\247\367\204\356Z\316\250?\367\323"
+	.ascii	"\347m\b\024\2548\337\247Z&\356\r\017\234.\234\355b$d?\232\270"
+	.ascii	"\345\\\3015\305\304\250_,n\344\252\340,A\213\373\312\261\355"
+	.ascii	"\212\244%\271\342\364\b\270\267\026\314d\321\371}[\267\036`\266"
+	.ascii	"\2608]5\273f\327\003\226\r\032\334j\255\2368Q\342\314%\325\357"
+	.ascii	"\001\272}\356\001\272-\242\002\2655Q&\303*\2473\337\246\216\223"
+	.ascii	"\313\025-N\327\214\216X\030\263&\233.\214\324\0337\234\n\355"
+	.ascii	"\332\316p\375\331a\262\371a\255\324/\024\263\214*W\326Cn\371"
+	.ascii	"-\263i=Z|\030\"\214\323M\343\035\263d\276i\273\304n\270nZ\332"
+	.ascii	"\001\335\301\265\2456\313\312\234\022\327U"
+	.string	"UB4\262\210\341\3423\347f\017\226\334\330\017\234\262\031\036\2517f\023N\231\215\263\364<\335<\225\351\252>\035B=\377\272\026\032\273\233*gmc\323\356\233\263+\364\367,\272\b\374O\033\375\217b\306\332\301.2nj\0231\241\220\253\350\177\331=D\006/@N\r\221?\210Jd\007\207K\202A\306F\006\211\312\356\240\036\016\203\031\034;\210\250\354\251v\0323\265\275\"\203=<vP\017[\250\2028DN\021\225\302\251 \242\0229\325Jd\003\365Ph\344a\330\306\240V\"\325\264\3628\005DT\036\247\210Jd\325\002!\216!\233R\222\271\"\356\026\342\260y\024\255\204F\240%q=\366Z\367~=\265\021\201n\253\243qM\370c\2654-y4\201\t\217K@\261\351\352\330\303%\321\311\261\333IS\215.>\020\\\227-\304.\203AXu\324Sw\001\305\356\340\366\262\273\203\335\255c\264Z\273\203"
+	.ascii	"\021\223\305bw\025\212b[\005\267<u\363\227\031-SD\345\325\221"
+	.ascii	"h\213\025e\262u\254\301%F\035;\331kH\243\252\fV\351\250\356^"
+	.ascii	"6jr\252\2075_^\250\261k\312zf"
+	.string	"\326K\006\2270\313\350(\201`\035ik\352\206Jz(\002\367\266c\\2\303\270\221K\221`lON\327\267\225\b\221\323u\307\371\365\344\313\232#\025\004\202y\366%\204\366C\231\331\331\017\226\363\355\n\030\246Z\034Z!\371\322\006\204\213Z\033/pO\254\035]\304tO\300\232\224\t\365\3101\233\216 \343\222\325\003+I\377\354l\231{\342\203S\326\302[\316c,\326<\366\300\261[\310c?o\272\205?\273+vW\244H\\\021\201E\227>\3550n)\307\254\037I\200\201\240\246\003\215S.\024\026\2341A\223\205\261@Iq\023[\265vRRH\216W\326M\223\311\227\036_^?[| \3418\34521&x\244\210\243\020D)=0\020R\\UN\262\253\250$\262\230$\262l>C\240\036^\361H\222!\201s\204\007g\022&\242\313\334\020\313\266\313\257\f\264\236\316\026\020p\026\027\261n\273\254\242"
+	.string	"\t9'\023~\222\242\211\350AU\032'\022\334\025\257\301\"\004#\017\212\206\200=\031~<\240\212\031\220\226\2220\350\375\2260\260\321\0032\331P\364\243\001\f\033\276\032E"
+	.string	"\024\365\030\0051\365\2006\300\310\021\203\003%\337\257\204#\3714\300\002\370\343\335`A\003\007\214\023G\362\375zJ=\031\324?\340\202\001\027/r\350\374\205\004\rH\320\200\356/$ \"\222\300\005\221z\027D\350\217W\003)\345\001y\031\370\320\240\373\365|4|@\245\336\f\237\215\264wDB\017\223\322\222\017xcIG\206\332\273\301W\244\002\325\337n\006\257\327A\222\217g\224\003\270\373\001K\350\321\340\353!\241"
+	.string	"\036\271 \232\001\211'#)\211\207A\216\037\317k\244\370\322\215\336o\b\270\264\364\03321C\251\247\366\222d\360\214P"
+	.string	"2!\203\222\017\350\343\245\220#\206"
+	.string	"\275\336o\203\034FI<\340\222\021\360\350\205\316\f^/\006\017\360\250\205\003@%\037\016\265\007\344\305\230\201\203\007\003\330+\nJZZ\202q\224c\003\360\206\r\r~=\0324p\300"
+	.string	"\372l0)\361~FEL>\003zG\277\245\033<\275\031K\""
+	.ascii	"{L:4p\300\250A\0052\035\001\177K%\354\036A\004\030\2508a\004"
+	.ascii	"\016T$\026I<\337\257\3074\304\364\353\321\340\373\315\030R\362"
+	.ascii	"\361l\f!\375\230\206X\030\320\003\372~)(\371d\350\311\340\341"
+	.ascii	"\361\346\027\230\2176Q\273\242Q\313v\301W\013\247\204\274\364"
+	.ascii	"\232\036qm\374\262@\220\222%\2245PP`QV\266\260\322\210\304\365"
+	.ascii	"\232\222LR\251\021bLE\205\250\020}R;Jr\347\034\303\024C\235\216"
+	.ascii	">\351t\025\341\364\340\024\035\276m\207\324\321&\016\247hS\016"
+	.ascii	"\025\025m\264\327,\2113\207\n+\nL\021\352\242-\332\226Q[\200"
+	.ascii	"&N\346\2248(^H$\341t\325V"
+	.string	"m\233\025p\005I\323\250\312\2746\315\246\3317N\352X\271*\346\274\231qRr\312s<\267ri\304\244\216\355\013\225$\200P\345\344Vn\347~\202\210\003$\007J\3357\373f\237@\335\324\fS\257z\354\360\302\251\233\033\303\355TQ\340\344\212\223gK\355\215\023\277\235\341v\2140\213Qqi\236\206\327\250\335\215v\017\211\222\254\241k\207\020j\316k|\214>\254X8e\347v\355\262x=\3070\331\017\224\271\035\314\246\252\306mj\334\324u\357z\2242v\225Q\350\\\206\231\347\265\257qS\r\006\202\004\250r\0011\306\022\025\"D$#2R\230\244\003\"\013\020\204\203i\034\310\314\003\022\340\023I\021:\350\b\021I\020I\212\222\024\246\003w\251m\203\360\f\230\240\312\206\\\275\312\002\374e\2702\365\354\330\215\261j\026_\272aC!y7H\273.sUw\212l\244\033x\001\205\363y\257\345\276Z1"
+	.string	"V\006\303\267\223\351\364\017\223\236{\256A\260\320\026\213\215j\r\232g<h\033-\365e>\\2\310\217\267$\030\317;\331\243\003\250\333g\273P\215t\214\\\214\201\334<\nj\360T\221\372\234\"VP\323\216\254\316\275\262dE-9\331\3330\337\212\277K}\243\303c=P\303\251p+wf\206\024\230IJS\333\033\265\246:o\370\331\"\313\373\"\257\254JT^\260\366\207\234X\323\365;\354\345K\253\321wH.\037T\327G\240<\naU\306\222\034\230-\377\tF\005\027\366\356\027\t\347\021E\371(\272\277\306V\262\362\225"
+	.ascii	"2\374'F\206`\344\024{\334F\377\270d\256;\325\2738\005\247\311"
+	.ascii	"\371V\317Ss\272\3379\301\tgo\213\0261-Cr9+)\355\3569\243UR\256"
+	.ascii	"\244\357\312v\210\027X\t\245\246y&\321\352kO6\254\267\332^\202"
+	.ascii	"\204\207\037x\311J\340f\">oZ\017)|\214\272\b\363tE#\033\312b"
+	.ascii	"\272\025\315\022L\001\036\351W\370\346\036^\"\351\215\035(Zy"
+	.ascii	"\335\"?h\203\224\272\317\344\300\017s\206\254\002\0356\\R3\325"
+	.ascii	"\317N\215\2406\363[C\213U\235\373\325=\2162\213y\263\013l\001"
+	.ascii	"kz\360a\323\004-\246\347\354\333V\033\302\320\024p\243\327\223"
+	.ascii	"\314 \326\330\005\357\036\341\360\316jG \364j\263\021\331\335"
+	.ascii	"A\355\307\354\022\340\311\216\377\321\303\340(\fx@\232\237\237"
+	.ascii	"\270 \220\340\204&4Yq\ts!d\222\260\224J\017"
+	.string	"\260`\257\\\364\332\001\272\260s\352Gs2E=+[K\2052\276:\273\243Y{0\226\323\f\005\034\033\347\362\244\334\352\266=\013;\203\205\r\"7+\340\352F\376\357c^\207\321\350Rp\003\031\221G\244\007Q\344\017-\245\013\216u\261\207\346\350\310@\337@y\261\312\r\257\037\321KBi\336g\346Zu\355ro0\354U\360_e\246\177a\2103q/o\370\"K~}\r\370A\273\317\312\342\027\275@\367\024r\031J\020N!\247,\013\302\013\221\032\310\244la\214\004\342\bPI\311\313\303b\272M\341Qk\252>)Lh\364@R\265\243\201uN\034[o\036\2053].\355\361\331E\177t\307x\377\317\225*\256B\216\341$\3651\347\251*\221\302 \341z\365\204\341\332\\\325\b\344#\270\003{\273\253q\230\341Y\006\025\023G\215\375\210\033q\rAfa\005\027\0046$\2117\231\n\\\366\371*"
+	.ascii	"J\tR\204\245\357\305\252\220-\332>H\244\027\265\273Y\n~\327r"
+	.ascii	"X\0023\3641\241\327,c]C\237\033\306\022h\3416\266\2711^(\223"
+	.ascii	":\1771\022\007g\030\343b\377\300\\\261\261EDL\340\374}\366Q\224"
+	.ascii	"\324\037N\205W\307\007\335\031\354\213E\263\206\372\242\315O"
+	.ascii	"\204\351\307\223/v`\362\253\367\001\363Gl^\310\343\305\363\367"
+	.ascii	"H\217\036\366\307\221\256\340\213\333\034[\205\360%\260<\374"
+	.ascii	"\3324?\334\245\375\t{V,@Z\335\3661_^S\177\362\\\301v\270U\326"
+	.ascii	"\205\236\315\373_r\027\257'\222\032\f\267\202\357\305\264\372"
+	.ascii	"\332\371l\236^&|\202\361\352\r\307\245q\334\177\250\027\316\300"
+	.ascii	"\224\242M\372\305\366Z\275l\267\220\02663\342\267\034\320\017"
+	.ascii	"\243\325\235\315\276\025"
+	.text
+	.section	.gnu.lto_.symtab.f3ecbbd9962e8db9,"e",@progbits
+	.string	"serialPrint"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\001"
+	.string	""
+	.string	"serialGetBaudRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\001"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\001"
+	.string	""
+	.string	"serialWriteBuf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\001"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\001"
+	.string	""
+	.string	"serialTxBytesFree"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\001"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\001"
+	.string	""
+	.string	"serialSetBaudRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\001"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\001"
+	.string	""
+	.string	"serialSetMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\001"
+	.string	""
+	.string	"serialWriteBufShim"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\001"
+	.string	""
+	.string	"serialBeginWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\001"
+	.string	""
+	.string	"serialEndWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.f3ecbbd9962e8db9,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1034 @@
+	.file	"serial_tcp.c"
+	.section	.gnu.lto_.profile.8743f7869c80780a,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\n"
+	.text
+	.section	.gnu.lto_.icf.8743f7869c80780a,"e",@progbits
+	.string	"(\265/\375`Q\001\325\t"
+	.string	"\322\f15`k\323\030\260\372\344"
+	.string	"\240'+\" H\201q\375\207\354\311\310\277:\340\355\207\231\327\343\324\365\222$I\022\206 \252\353\232#\265Q\223\221\336$\244\355-\323\336\001oZ0 n\333\3362x\261A\250h\227l\350$6\223w\341\302i\262M\230\350\024\260K\327&Uv@\374\350:\034\2227\023\242y\260"
+	.string	"\366\303\201\310\250\340\027\234\032\033\033~\255?]\242I\036\n\003\306\264\266\256\266&\310%\202B\305\0358\225\203\335(\3320\020\231\364)U!\213\220\016\t\3168`u>\036\221\\\215\021E(N\013\006\304\351\364$\255\244\246v\271\300Vx\214LO\353\322\272\\\217\372\303\337\232fF\\\301\333\336\004\0013 P\002B\210\264\003\352\002\300\0204\214\313\202\005\240\\0"
+	.string	"\273\276\232\bz\317\307\310\340\312\020[\257OT\226\035\032lAp\f\331-\b\300H[}q\262\336.\033\\B\344q\024\310^"
+	.string	"\314\034\251*\266\f\006\356\r\214\330<)\213\211\005k\237\002\213,\340$"
+	.ascii	"a\325\027`\t\242\0040\2571\213\366v\215\300\326\271\364d\266"
+	.ascii	"\365\240UK\200\242\270\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.8743f7869c80780a,"e",@progbits
+	.string	"(\265/\375`~"
+	.string	"m\004"
+	.ascii	"2\005\020\031\260\027\322\001\f\303Pq\204a\030\006\332\215\255"
+	.ascii	"\243\273[\243\335\244\355-S\n\356>\tDQr<\343A[\354\017\033R\030"
+	.ascii	"\t\017\004\245\002C\366\037M\n\330_\032\267\235T]\345\024{\r"
+	.ascii	"\336\b\" \240\002\242\222\353\b\200&(E\016?R\270\216\306\341"
+	.ascii	"Z\201Y\006\020P\301\036S\220P\034\f>\367fn\311\236gl\351\354"
+	.ascii	"\302NE\224\001\022W>\243\364\202\201\215\242+\234\323j6r5\305"
+	.ascii	"\254\274\205\315X\036\310\254\230C"
+	.text
+	.section	.gnu.lto_.inline.8743f7869c80780a,"e",@progbits
+	.string	"(\265/\375`T\004e\023"
+	.string	"\026\332[D\020\2233\214\001\220\351)\214\301\220Q\300\276?\321\362\261\005%\032\322m@V\222)>6\214\351?H\367\373"
+	.string	"1\036@\2106\233\fP\024M\201R"
+	.string	"@\221Y\2741\202\215Mz\251\211\264\266\321\336[J\231\002D"
+	.string	"J"
+	.string	"M"
+	.string	"71H\334"
+	.string	"i\013\0352\251\017\314\017\0332\f\350\257\211\\\"\346\210J\020,z\274\030\306YR\375%\025\366\207\262\353\353<\301\363\354rw7{/w\354.\351\032\201>\2228\216'\235\261\273\334\203\306\022\004\251\302\305\202\213"
+	.string	"\213t>\222\350\020\355\273\253E\023y\223\306\240$\206\335\035\r\262\262\273!o\312\226\335\375\224\324\330\335\320\331\246d\321xH\001zOmTZ8\n\240\364\002\213fu`\f\363su2\177\217\342\365\203\260.\003\ta\223\234\200\203\240\202\214\313\007\247\364\301\001&e\362\347o\220\235\356\311aIa\215XRD\bP\036.*-\002w.\251P\204\351\266\235\332\251\235\f\322\304L\f\r\364\262B\216\206\030\355Qt\205\242\346\003\247\235\237\036\322\325ut\020\257\341)md^Bx\036\245++pr"
+	.string	"\310\314\0225\031fJ\036y\336\264\221pvwd\321\245\335\345\267\273\330\t\222\340\211O\307\005\031IF8GO;\244V\237\366v}y\331\272\3310b\300\233\204\335\2450\276 \027q\250qAB#3\301\210&\205)\264\006P\002Af\216\316\003\021"
+	.string	"\261#\316\221\232\221$%52\214\001\254\214\t\2454~3\236y|\022\026\211\n\227\352\034\272\265\264\001\243\341S\207\366\215#\316\235\207\226Z\230\005`\246\255\204\277\230hf\214[\257\nb\302u\220S\026\\\026\366\225v(\253|\317\004AL;l\n\0339AW\r1U\022\333\332/\343\346\220\253v\334\022eE\022b\250\341\374GG\232\267\234\177\203\317l#\236q\243\215\374-\005\270\375\312t?L#}\2761\244\t\234\036~\251\021\230\265\301\026\334\002k\026N\304\024\212a\315\357\350\231\312_k{\274\272\273\2547\245"
+	.ascii	"\334a#\343)?\326\231\243^F\261\253$\263\355v\211\274D\373\216"
+	.ascii	"C\371\331\373\265\266\346g\b\257\244\264_C{a\350\003\252B\241"
+	.ascii	"-\032L{\326[_\202\224\253]!\347\255r\207\007"
+	.text
+	.section	.gnu.lto_.jmpfuncs.8743f7869c80780a,"e",@progbits
+	.string	"(\265/\375`\305\006\245\024"
+	.string	"\226Z]B \217\223\016"
+	.string	"\234\0260\354\210H\345\314\230F\026\234\327"
+	.string	"\300"
+	.string	"\220\rc\030\217\236\326\232?4\304!\222\310lm8\226Q\305\217\267h\002\203\316\007b\256jK'\007\323\372\314?\334\277m[\262eJ\001C"
+	.string	"K"
+	.string	"I"
+	.ascii	"\233\t\375\376!!n\030\217d\262[T\344\351\b$A\340\230s\316_\305"
+	.ascii	"\357r\022H\332\300\215\256\323\345\370U\355\346\274\335\374\276"
+	.ascii	"\344\375%OO\001\222^9{u*\371S\351v\274\332\375\336\260\f\373"
+	.ascii	"\305\bz@\327\375\357\245r%*\347\250\366\213\317\330\354\215\021"
+	.ascii	"\333&B\301De2\333\342g\361\005\030\f\304l\nH:\211\312\271\370"
+	.ascii	"\375\023\233\266.OQ\224\340d\257w\005$\241T\356\331\235\353\264"
+	.ascii	"\323\376\373\002BA\324\251\306\230\031m\001T\307\242d\004\021"
+	.ascii	"\225r2\301B\006\224\n\"*\032ot\rH\370\357\n\350\003\335\016\002"
+	.ascii	"\336I\235\336\375\003\274\037\251\003\335\006\272\225\256F\227"
+	.ascii	"\201\356F\027d\376\t\260\003x\177\007@\356|\365\374\352\351?"
+	.ascii	"\277\177\261C\003f\036\216\026%;\231&3\r\013\255\\Y\246\255\310"
+	.ascii	"\016\227\311\307\205\021\023\025\215#\307\272>`\037\017\346\301"
+	.ascii	"\362\\\240\217Gr\300>R<d\210\fa\031&GWH\264Ab8\361pD\340\310"
+	.ascii	"\341X\327\007\363\260H\t\322X\244\210\222!\220\326\"\255\f\323"
+	.ascii	"\220\300\321\n|\2501A\245\330\214\214\024\264 \3112\006p\002"
+	.ascii	"\221\252\242\362\022\300\241A\212\3038\222\303\016)S32RXVIJ\017"
+	.ascii	"Z\203\024\213\372\002v\356\311\017d\316\261a\003IM^\017\022_"
+	.ascii	"\t\3768\"s\350'\b!\301z5\026\207I\236\025\244\363e-\375\366\214"
+	.ascii	"\022\205\232\213\f\242\356\217\250j!\\\305\020@2\374\262\370"
+	.ascii	"\211\234\263x\022\003\r\260\312J \217Nq\242\365\2046\371\354"
+	.ascii	"~\207\230$`\222\261\234Ob\275\235\025,\304\2703\240g\323\037"
+	.ascii	"\261\207\310<-\t\320a'\267\373\306/\275\342\355UDC\177\300*\272"
+	.ascii	"u_\353\224W\211\360\233\212\266T}\352\336|\373\324-]\234Z\026"
+	.ascii	"\376\335L\332\373\372\220\353\371\204e\262b\n\215t\016Y\001\001"
+	.ascii	"\367\212i\211Z\372\344\006\303\r\260\265\323\300d<\031\211\260"
+	.ascii	"\366\270 \362Q\300\245`\\\227\330\024\322\264\302'a\315\205\006"
+	.ascii	"\226\311\346\237\321\211\374\300\363\332J\357`\307d\007S\002"
+	.ascii	"Mz\367@\233\3551\002\326qi%J\243<s\017"
+	.text
+	.section	.gnu.lto_.pureconst.8743f7869c80780a,"e",@progbits
+	.string	"(\265/\375 /y\001"
+	.string	"+"
+	.string	""
+	.string	""
+	.string	"\016"
+	.ascii	"\232\005\002\232\005\005\232\005\006\231\004\007\231\004\b\231"
+	.ascii	"\004\t\232\004\n\231\004\013\232\004\f\204\004\r\232\004\020"
+	.ascii	"\231\004\021\232\004\022\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.8743f7869c80780a,"e",@progbits
+	.string	"(\265/\375`g\001\255\b"
+	.string	"2\214\"%\220\247\031\016\377\217-\006\337\256\357\223\376?|w_\342S\243h\210\212\347%\013\277\025\221\020\032ik\333\2262\005\257\347z`\253\202\365l%\370_\202\320y\320\311:\r:\221.\324X"
+	.string	"y\352C\252\002\036`\335\232\212\022?\217\351\031\255\361\275\246:S.f>-\370\212\200\224\350$\241\324\340\3648(\025\273\247j:@J\271\353\\\312\227r\205\026?\237N\245\323\251\332\225\317\246\274\351t}s\316\312\023\252~\306\007.C= \220\002\0212\273\003a\006\214P\276\031ELB\336\367Q\334\325\352\305\372/FV\260\203\3562{\033\301\025eq\300\031\021\2133\345\346T\016\257\021"
+	.string	"J`\354\205$&\212\\I\330\240\205\275\001"
+	.ascii	"_\300Z\25288#\013\331\021@F\222\310\3751\024\205z\217 \216\201"
+	.ascii	"\031)\236\320\277\331\203%Y\255*\375v\212-NN\3151\277\006\177"
+	.ascii	"\201\243X\307\340wb_\222T\265Ab\323\246\007\303\245q0y\342\262"
+	.ascii	"\342\016\001"
+	.text
+	.section	.gnu.lto_.lto.8743f7869c80780a,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_tcpVTable.16.8743f7869c80780a,"e",@progbits
+	.string	"(\265/\375 \300\375\004"
+	.string	"\204\b\206"
+	.string	""
+	.string	""
+	.string	"."
+	.string	"\005\001\006\177\001}{\212\001\202\200\200\374\342\303\325\204\013ywu\274\236\244\245/sq\270\324\344\007om\370\317\224\tok\270\317\204\007ig"
+	.string	"?\202\210\200\320\001ec\303\001a\302\001_\301\001]\300\001[\277\001Y\276\001W\275\001U\274\001S\273\001Q\273\001"
+	.string	"\013/root/repo"
+	.string	" ./src/main/drivers/serial_tcp.c"
+	.string	"\t"
+	.ascii	"\200\224\230\244\310$\006\352\312\031\017\202\201\023)V\017\240"
+	.ascii	"\b"
+	.text
+	.section	.gnu.lto_tcpIsStart.20.8743f7869c80780a,"e",@progbits
+	.string	"(\265/\375 \350m\006"
+	.string	"\"\314,2`m\322\030@\f\322(\ti\t\300A\fD\007rN\373N\377"
+	.string	"Lk\326:\325\331\275\006\337K\222j\b\002\"\311\360\252\036\021\222R\253\225X)e\nO\022f\312$,\\*G]\355r\224C\345\024ZCuah\223\273\232d\331\302P\256e,\313\265J\266\250\237TKG!\0369\260\343\215\031?h\0221\214F\r"
+	.string	"F\251\002\026\235\f}\306I\275x\244\254~\376<5AP\244d\227\"t\262!\221\207\306\277\371\312\006\007\233\337@\204\216|H\200Lv\263\246\030\3700\337\210\033H"
+	.string	"\"\301<\034\314"
+	.string	"\204\335=1O\005\256\370\027\374\322?\021\b"
+	.ascii	"2\003\316:#f\b\3055q.\002#!\362\270\033\235v\222\001"
+	.text
+	.section	.gnu.lto_onData.21.8743f7869c80780a,"e",@progbits
+	.string	"(\265/\375`D\003\r\027"
+	.string	"\246j\223I\260XQ:\320\001\013\253\210\320L\327[\202\265q\243\345G\252sD\240\260HE\240}\240\244\023f\277\375\217~\325\225L\355\r\336\337\352\343\311\302\303\376\201\314\017]\266\037\017i\317\216qdM\251\330\026m\237\020\262\211\334)\005|"
+	.string	"w"
+	.string	"\203"
+	.string	"F`\177\332\307\361\034\264\363|\356R\253\320\021R\255%\215[\344\251\313\263\304S\362/\342\251i\366\224\227\273\332\240I\316g\245\326\332Z\026\036\203\301`\360ay\207\223v\221\206;N\232\257\253]<q\032\2167\0220T:\\h\003\374\021\271\221m\206'\031&\276\244\211\217\341*H\r\234Jw\013if\370"
+	.ascii	"\276\3503H\227\233s\274\251\265z\002\351J\334\344m\217\260\255"
+	.ascii	"\300^\020\001\247\253\335\021\335\340\375\314\240]\326\346\016"
+	.ascii	"\t\241\301\033\341\025\262Y/\357\325y\277\313}w\212N\267\230"
+	.ascii	"\246Q\246\351\223i\332DN\223\343\364H\247Eq\232\322\3510\234"
+	.ascii	"\336\235\236;}\030J\345\311k\004k%\021\304R\235P\"1\356"
+	.string	"\373K\373:|#\243\374\336w\320\356sRX\217\034\030\221\362\253\265& Oe\302\277\310(\333e\317\215M\304\003$\245_\255\345\314i\344\232\366K\271,\343\222\033>\211\314\203\317#\236\216\373 \024t\303\025\3678\"\333\f:\265tE_.\013\205\037\341!\303\245ia\341F\274\244R*\302`W\005e\210\013\006\t\300\334\033}\276\260qc]\326\276<\220\334t\273C\376mv\300\337\270Bv\211\337\013\275(!&\3206\316\203\270\002\354\374:\020\330\217\t\031R=k\200\350\212c\357\341%\262\326\272\300?\252\240\201\300\256\326\372\027\247\276\217\030\261\317\016\273_5:\257\035\234\r\256\230\f6k\315d\260\0171\031\206V\207\230\213C\353%\233\265jd\234\243\003\223\265vrrd-TY\177\363\26361f\242\266eWkC\2100\017d\324\n\334\326\230\264\254\200%N\232J\005P\373\242\263p\304"
+	.ascii	"\365R\320\035\262\t\270\254\245.\306\231\2476(\265\247\375\224"
+	.ascii	"\036\023\tW\342\244\323\016h\361\260\326ZC\037xjYk\252\322\004"
+	.ascii	"\247\342e\356\232\326s-s\333\232\003@\250Q<\242\250#$##\241P"
+	.ascii	"M!\035\200\002\221A+\017\020H\307\246\266\320fb\250N\334D\213"
+	.ascii	"$I^\365+\037\334x\017H\202\"\301\316\033\207\264k\233t\231I\""
+	.ascii	"\034\213\261H|\00482K\302\366\177\340U\376 <\325\022i\331\221"
+	.ascii	"'@'\346\025\306\275\303/\"\240\"\021\353T\257\321\335\236\264"
+	.ascii	"\220m\213\350\344%F\352\271)\243\310\326\271%_\205\356/\273\263"
+	.ascii	"\377:\325D<\321}\342?e%\360Hx\317K\2174\026m\031\032~\251\001"
+	.text
+	.section	.gnu.lto_onClose.22.8743f7869c80780a,"e",@progbits
+	.string	"(\265/\375`q\002\025\023"
+	.string	"&\243{I\320\322(\035\242\211\023\310\023l)\222\016\374\326\214\254\343tM\202\037\003U\271E\274'\353\304P\2002\302\177\254GQ_\275~\235@\267\271>a\354\001\306S\366mH\372A\305\327\210\271\243\022\223\201\002\330'm\357-e\222\001d"
+	.string	"]"
+	.string	"j"
+	.ascii	"\032\242\252!M\312\214\303\003\242\037G\335\341\201KM\320}U\237"
+	.ascii	"\342?\261\2035\007\320\275\303\202\250;D\240^w\251\341\005\314"
+	.ascii	"\313\356$\363Rc\252=\036\3664\212R\316\n\244\356\366X\304c\217"
+	.ascii	"\2741\275)\345D\253\311\036A\234Gj7\261\244\273\037\364\355P"
+	.ascii	"\233\355\232R\272[\227V\373p\225W\007\252[\024\347\t\242\320"
+	.ascii	"\230\013)\217\256\273\027\350o\253V\252\307\347R_3/Gxo;l?\240"
+	.ascii	"\315.\251\206\262e\036\325\307\356n\345"
+	.string	"\035\325\207\327\221\203\277\b\257\242L\253\247\270\332\305U\323\\\235qU\312\325\030W\231W\227WO\022M\204H\312\035W\324\355a\tH\033\311\030$\036\376\252\177P8\247\251t8\n\f\250\256P\330\3234\266\016\313T/\34334\350}\264\002\313\236\3062/O|\3221\271\211\273\241\311&~N\313a\270L\336\\d\311{\303\201\013b\363\362\027\260\310ld\033\0012K\240Y\016\\\220\263\246\252\352.X\005@\244\334r\013>\315\007/-\375\233\347\345\265\201c\233Y8\356\033\202\271\320\321\314\313\212Z\245LV\251\022\024Xj\202\004\006+-*\020\032\260\004x\235uU\235\310\250f\\0\274|.\326\313{\271X\033>\327\312\313\360\275\304x*\327\313;)\321\226\f\313\345\315\264Z./$\354\307\346\035=\262\341Yd\036\330\254\001\023\2217\204N\344\266\273e\254\337D1\314M\307\315*\321\370PL"
+	.string	"(\t\034\260\314\222;\276\212\027Ex\t\233Ow/ `\002\021aU\036\223\320\347\214\211F\200 \t\204\275\035Z\215\367X\b\310`x\217\017o\367\212\032Y\250\250\002\336\305\313O6R\267\334\207E"
+	.ascii	"{^&\220h\005\227\354\311<\021[\322\330\033\373\341\204\256c$"
+	.ascii	")\t4\260*#\274\321\220\216\272\270\231\315\244U\216\267\tl\264"
+	.ascii	"\2009k\242\3065\b\ny\364\364\254\345\030\026\\\356\251\233\037"
+	.ascii	"&\034"
+	.text
+	.section	.gnu.lto_onAccept.23.8743f7869c80780a,"e",@progbits
+	.string	"(\265/\375`\237\005\265\037"
+	.string	"&\267\303G\200\334M:\331%\243\256\035z\343%`\213\312n\214\232\3103I|\365[*\336f\"~cT\t\255\333\260\310"
+	.string	"\317\b@p\353\016]\262\241\367,\303;\373U\232\254\236u\357\262\313\206\207\317\244G\333\b!\204H\231d\243"
+	.string	"\241"
+	.string	"\273"
+	.ascii	"\274g\363\232%o9\362\222#\357H\362\366\310\313\315\373#\013^"
+	.ascii	"\260\206S\212\276\324\212\225F\247\236\221V\204\234\370\357\376"
+	.ascii	"Kvgw\211-^\253b\324\322\340\325\232Z\211\bN\356\202\363\274\373"
+	.ascii	"$\007C\037\346\342@\265\362\200R\245Vb\202\335\235'\227x\242"
+	.ascii	"\362\344y\241\362\344\242\273iN\344\252\346\026\f+'qj\255\273"
+	.ascii	"\366q\364\344\330\214\356mB\340\311\254\217-\234\022,\003E\230"
+	.ascii	"\365\036\017\f\271\320\270\t\251F\"0[h\276\344\fC\030d6'\324"
+	.ascii	"Z\227S\241\214o\371\335\365\260\273%v\311-\001\265\352\251\207"
+	.ascii	"\263\252\301\321.\b\021\374tqV\r\334}\224K\211\332w\355\210$"
+	.ascii	"~\232T\236,\273vC\367\261\311\261a\220\323\266{\354[)\375\311"
+	.ascii	"Rw'\031z\205\275\271Yl\fY\035\246\223\361\3064\364\316\026\345"
+	.ascii	"\311w\247WD\326\304\233,\332Yku\260\027Cr\312q\325Z\337ur\357"
+	.ascii	"\242<)\240\271\256\206\f\301\302\2468m\227\b\344\356\261\373"
+	.ascii	"\2616\217\335\023\277\002\036\366\027\231\274D6\336!\223W\310"
+	.ascii	"\306\033d\362\002\231\274?5^\237\223\367f\362\366\224\274<#\357"
+	.ascii	"\316\310k#ykf_\203z\335\270\324\240_m\206\0029\032\352\225+."
+	.ascii	"*\344h\320/\243\242O\327\276\256\310\t3\300\267\"\250\221\233"
+	.ascii	"\361q1\335E\217\274\210\"9I\340\3266\034di\215\236\336E\301N"
+	.ascii	"\006\352h)\233)N\023\003u\3664\t\244r$Lw\335w\302\240J(\234U"
+	.string	"\035\216N\362\214\365\306\027\036[\357\324\332\326e\251\326JWn\216\312-\274\020ZeR6\\\366\006\314\216\321\210\317\336\255p\201j1<\013\024O\021@\361\354\026J\221\363 \351\360\254\317+\315&!v\206\212\347\\\341\231=\340\352l\b\366\r\345n\206\227mhr\007Y\0347E\314M\366\231\234\n\207\017\031v\325kk\312\351\232r8\bJ\"* %\r\255\255)\207\323\251\310}\350@\001\004\356\311\207{\3629I\361zOO>\036\216E\017\311(\352\275/OA\n\236\324\322\t&\247_/j\027\365\353\255p\3725\355\236\234\230P\354x\277\250\235\002\334\372R\364~;)\237\357\267\333!\326O\230\352 \371\200\207\260H\"\016\0221P\302P?\213\326\003\016\3523Ag\240Yg\255SO\315\257Y)d\003\325\262\242\003\305\001\204\2726g\321\"\024\203\372X\2640\340-\373\232\272{\243\252u\252"
+	.ascii	"P\016T\007\034\240>\026\255\035\353\376\263\205\366\300\275h"
+	.ascii	"`\033(.\006\370\351\233i\361\201\032\3411\2633\237\037\001k\250"
+	.ascii	"1(h\0254\207F$e$I:\200\002\021\2612\333\021@-b\016\226&\305-"
+	.ascii	"\006V=\225\241\246aN\002\203%\212\230t)\355\177V\300SeM\263\347"
+	.ascii	"\377\006\247\205\303\305\204\300uJj\350#\217\2643\347LC\260\242"
+	.ascii	"\232\306-{\005E\275\253\004W\304\221d.\0046+\334\200\0026e\267"
+	.ascii	"\235\007\304\275Fli\223\372\016Q\342=\334G\352\031(1[&\321)2"
+	.ascii	"\216\332\240\222\361p\312\231K\203{\353#+\342P,\nf]\201\272\231"
+	.ascii	"K\027\235\na\037D\365`\250X\030\tA\322\225s\002<\202\341\203"
+	.ascii	"\263`%\307\007\213?,\344^\254\340f\221+\023\023>i\247\031\002"
+	.ascii	"\210\320\317b\366)\320p1\347\323\343j(\361\231\215jj\320\215"
+	.ascii	"\241=\247\224\203\344\214\242y\235\377\204&\217S\311)J\250\032"
+	.text
+	.section	.gnu.lto_tcpReconfigure.24.8743f7869c80780a,"e",@progbits
+	.string	"(\265/\375`\254\007\355)"
+	.string	"ZJ`\020D`\346M:\201\3200|\257\261E\325\026\240|\241\023R&\\MH!\270=4\252\356\200\307\220\035g\256\020AJ\"\263!d\340k\216\247\213\177\340\224O\233\251/\0073\217\203\240 w\267&\215\020\262\245L\001\345"
+	.string	"\340"
+	.ascii	"\002\001\375\336\331O\315>\257\373(\332?\273o\236}k\366\333\366"
+	.ascii	"Y\202\006,\204\352\234\330\356\005r\207\350\276\235mW\376\353"
+	.ascii	"\370\177\377\273\177>\3431:\230\314\335\336\273\267\t\0375\367"
+	.ascii	"^\251?H\371TMFB\233\315V>\272\367\211\0345\367\236I=\230\362"
+	.ascii	"\371\377\f\206\313t|]:\213\022\304\027\347\205\253\f\241{\317"
+	.ascii	"\202?\343$\224\317\224\221P>-\024^\271\b\370\363\365R\036z\232"
+	.ascii	"\266\327\263\221\213\300\030\350S\202\361\017\356+\211\251j\371"
+	.ascii	"B\322>\226\213\213\353\035\201\322\362e\244S\236\255\273\343"
+	.ascii	"DnMY\204QS\002\235\230\030\206\373\n3\177@\340"
+	.string	"\306 \373\344-16O\343\234\243\334\232\022\214\255\251`\031\007\314H\311\303L\252\343\204\017\243qw)\217\335\274\r\367\336wR\031\204o\304\377\341\374W\373\321\273\326xA\316\231\027\324\216}\001\233M}\016\201Z\373\213\030\321\2344m[\026p.\371\227\3405'(\250Y\313P\030\210r\357e\262\325B@r\227$\322k\004\325ar\3321\266`t\322\320L\244n\313i\234F\005\277-\311\356ErrE\212\224\020\305b\2529y\225\2075\376\274\306hl\234\311N%\024\242|\266\265J9\205\302\330Jr\371f\257\205\262m\201\246gG\033Z\315XM+\275\367Z8\227a3/\316d|~\030\2439\311\3479\006\312'[0?\346\226a\332\266\372\356?3\266\035\373\331\274\367\336\333'?\2331C1\031f\365\375'\263\357\324\3537\365\372L\275\376\222\331W\352\365\007\364\372I\275\276\200\356#\245\375"
+	.string	"\335?J\373"
+	.string	"\322\276\021\257_d\366\201\335\377\241}_\007\366\310BX\376A.\217}\367\n\re9m\025\262\016I\357\335\342d\363\335P"
+	.ascii	"EV#\\\326\370D\304\236S\232\003`Y\320\0333\b\315\200\305V%\255"
+	.ascii	"\346\366f\304\204\017\021\3734\350\177\035[\2414'\215l\2160_"
+	.ascii	"\205\350\216D)<\210h\327\330y)\262\377J\205\005\255U8\tH\265"
+	.ascii	"E\226\202\330\035W\2425\013\372\257W\030\320\232\205\201\027"
+	.ascii	"\2413\374\257[\230N\313*\360\262\333\303~\264\224\346\372d\360"
+	.ascii	"\342\263,\263c\326B\317yX\217\326\312e\355\262vA\371,\3405\267"
+	.ascii	",\263\303\3436\006\347\373\311\021\243\370\004\332\001\302\370"
+	.ascii	"\371\3348 s\b\331\3531\033N{t\326/<'\265V\211\347(\267V$lI\236"
+	.ascii	"\364{\226\2001\343\035h4\316\032f"
+	.string	"\025\223\"KD\375\034: \337\360l/\214\333`\335-=\237\r\312'j\201hw\320\034!\320\277\207\017('Ok\355|\351Q\210\356\030\367AA\035\270/\013\201\t\022\034N\250E\242\0135\013\201Z5c\330\202\211\204\323}U\bT)\265Jh5\234r\241\336\020be\311PS\230p\272\017\252J\210ch55\304\032\316\030\252ZUS\302\242\325\224z5T\261\212D\032\005\252\206}\305\247j@\203\n\213\205\325\324\260(\274\n^\025\2055\206\305\252\340\214\341\224\214 U\361*\330@=\221\206\260\030\304\"\022\213\301\337\331e\363\332'\347\305\255\251\261\361\230\215\031\215A\034\313\270\330L(\373d\273\376?\331o\330\262\307\"&\333$d5\036S$\217E\361\351\364\345\344\203\227lS\367\340%\313\264d'\324!\002&\245\265\327\312\203+ErW\024\237J\\\335\245d{a\003,#\227\307\004\250"
+	.string	"\233dfy\024`#\324\031t\224SK\364@S\332\352~H\266\005Z\036\f\355;\262\347\265\013\r\360c\005\322\234D\262\275\203\b\234{\n`{RF5\200\211\250!<\003%ddF&\210\202$),t\240\"!\262\232\007\0210-c\020Y\230 \005I2\254\001X"
+	.string	"M\311\307\244\361]I[C\322$.\351IZm\201/\300\274\243'k\205\215\340x\310\245\244\021\030\033\3670\207X\314\306\032>\024O\350\211\n\261\020\002\331aj\3079"
+	.string	"\203]\205J=\032\327\241\235\202|\261?\210\213\277\254L\372\300\317\213\007\330\013\372?"
+	.string	"\247\316\272\rs\216m:\363\304[M\242\254\212\274\003P3\311X\2600\340A\177:L\2764\310\005"
+	.string	"j9\326\023%\265\305\001i\265\250f\321\354\210Y\265.R9\022\f\224\375^\211\363\243\344(\301*\365=\260w\373\360H\237\336\200\033\316/\355\276\332a\021\177\243\217\373\325i"
+	.ascii	"\352)\347BYR\360\235\242\352\277\322\034Zh\342\236^\203\237n"
+	.ascii	"'\037\025\2215v\332\345N\t\213\352\362\013\255\355\272|)\374"
+	.ascii	"'\257\361S[\345\321`A\202\325\274CI\226Y\324A\200|\301\237g9"
+	.ascii	"dW\200\021\240\354L\236\002\243\bY\177"
+	.text
+	.section	.gnu.lto_serTcpOpen.25.8743f7869c80780a,"e",@progbits
+	.string	"(\265/\375`\226\005\035\035"
+	.string	"\2262\266F\220\\Uc"
+	.string	"vk\240\345<!"
+	.string	"\336\366\301\2643\344\276if$\\\022>\013\035\001G\332\340\213\3130\323N\272\276\341\375\367\b\212~\177\2467\303\244k\364\314\376\324\235\256\237h\237\212-\240\266y\276\335{K\231R\235"
+	.string	"\226"
+	.string	"\250"
+	.ascii	"W\330c\312\007\323\211\265d\002\256\260I\207\005[\217\204\361"
+	.ascii	"\001\367&\271\221\272\367\b\301\022`?]\253\375%g2\364\243\255"
+	.ascii	"8\347^\244%R\367^\b\236\301~\366\230\266}\246'\031\362Ov4\036"
+	.ascii	"\275\256\340\030=Y\336{\234\371x\003\350O\330\t\240?\255\217"
+	.ascii	"\377\216\236\246\255?\237\350(rK\360\264[NWYO\304\342M\263\002"
+	.ascii	"\026\244\325\016\261\310<\225\224\354\320!\n\2535\t\330 \203"
+	.ascii	"\265C\024\232\017\306\020q\034\352uH\f\326\372\272p\357uM\211"
+	.ascii	"G\367\353\266\201l\333\3543IR\247r\363\201\374\264\n\\}\372\323"
+	.ascii	"\307\241?\253\225`\354\222\026+\326\227\031T\354\205\320[\237"
+	.ascii	"\246-\302\332\306/{{\25038z\022\314r\212\003\254]\366\221\250"
+	.ascii	"Z%\373\346\265I\366\237~\236C\371\023<\312/\273\223\377\300\221"
+	.ascii	"\177\201'\357\330\217\377\313\325g\254\332\214U[Xu\315\251\376"
+	.ascii	"\002\232\220\345\231\005k\356\245\321\365\346z9\247\202<\371"
+	.ascii	"\333C>\224ul's\2771j\344\244\301.3\367\036\035\374\264\017\354"
+	.ascii	"\365\324B\211\307\t4\n\257\304\t\305g\n\bW\363c\222\246\246A"
+	.ascii	"\003\304c\304\360\255\f<J\253\373\341\224\026\265no\270\2312"
+	.ascii	"\261%\207\217\021\363B\212B\322\341a\224\036\216\005f\311u/\267"
+	.ascii	"A\374\312ge\255\244[>\324\016\361.>\006J.\n\224\001\216\246 "
+	.ascii	"\341\272\026\032\002\343\2751\236\372X\236E\204I\202\206>\245"
+	.ascii	"\225\370\025\332\216\3216\361*\024\260{\357\004\252\0256k\274"
+	.ascii	"\367\236\310dS\326S\021X\273\252\224!\221\343y#\\\311&\346sh"
+	.ascii	"\314\312n05\205\031P_\266Z;E\255>\215\331\236\"Kd\277J\016\300"
+	.ascii	"S\333\272O\331\032(\357\275\024\002\274\363X"
+	.string	"\344p=]\356u\373\311\t\231\267^m\304\217\257\346\003\253\365j\032v\200l5\237\240\240Z\206\027\273\330\017\256\332\026Ag\353\245\b\252\341v7\336\214\267\273\271\300\355~f,p5\241\231m\307\233E\350qNw\333\315z\271\334n\246s\2747\257M2\25244\212:c\034\300\320p\2122\375\037z\332\241\355\323\372\002\320\006Q\236 u\330\"\235\322\262\224`H\225\3413\262\252b##R\213x\302\023\251j\351@\221\n\264V%BR\261\311Q\340\310\273`\304\001R-\3450\227\376\306\r\233\037\323\227\246\325\375\210J\213\326\332?%\001g\250QL\307 \"\231!E)H\222\341\340\"\021+n\003\021P\255BH\031\211\202\262dh7\354\255fK\316w\177\026!\305\n\262\221U\271\341X\324\241,A\332Zp\355\336=x\217]\267\315Ma\177\205#\220\007uT\317\234B\333\234B\233\316\320\025"
+	.string	"\2145\317\202FB\247\0261\366w\007\025\347\315\375H0&9bt\215\r\223\210\351\317\232\236\247\302x/\020\r{\372\032\360\n$Z9\005<6\366\244W\346\034l\362\353\213\203R-\273|s\234\206\270\327\b\311\234\267\346f\371{)\245dR\375\310L\375:(Q\225?\357\320 _\215z;"
+	.ascii	"\t\006>1\350C$\211d6\251\255\325y\016\305\004F\317\271\n"
+	.text
+	.section	.gnu.lto_tcpTotalRxBytesWaiting.26.8743f7869c80780a,"e",@progbits
+	.string	"(\265/\375`\361\001\345\020"
+	.string	"6_nE\360\262&\035P'\335\021\004n\025\307\266\301o\037l\021dr\374\374\223\276Nh|\371\241\331\253\336\254mCh\363`W\216Z\300\225\235T]h\035\026'\2171\371N&b\250\252\337\322_\037\253\244\221\275\245L)V"
+	.string	"T"
+	.string	"_"
+	.string	"9tv?\003\346\264G\177\232m\037\305S\260\330\203\237\314+\213\251\310\020\353\261\373q\241\217d\217\360\001\262G\005q\357\021jz\376\347\004\232\020\221\343z\251\036_\016A\257\227\253\310\253\005C\273{\233\247\313\213\225\3719\331]\247\353\305\341\316n\233\201\355\004v.\b\361\n\232\311quXe\217\375\251Rc\354\303U\030{\003\375\373?\257\2713\230\2160\raZa:5\375\220\255D\r\022\036\273\032z\200,O\2241\3425\277\315\342\333x\363k<M\265A\273\211\265\320\261\373\221<\032\201\226i\037\366\025,\377.\034\300.L1\274\001:#\237\325\r\037\260\025\324\230M\025\314\354\264\320\260rwU\2521VM}`\263\323\312\037\266E\207\341\225\274(\240Z\022\002\346\3568\236"
+	.ascii	"\031{t\027\021BR\343\312\306\t\330\226W[BJ\336\345PKU\366o,$"
+	.ascii	"\016\227m:\013\n\332\356\036\210\251\240\b\310\314<\372+\331"
+	.ascii	"\003\251\322\212\251\213\243\256$J\241J$\315\235\211J\227B\231"
+	.ascii	" \"\235F(\016u\032U \235 p%\222(\205\353N(\316$d\223\312\350"
+	.ascii	"\304\245L\246\023\267}{\270\n\343\0063 H1\320\200\351\246\231"
+	.ascii	"\272\330\316T\304\205\004\317JY\016\022\347\003OKU1*H\037\244"
+	.ascii	"\205\006jjT\270\243\305\003\013\345\001( \200\002\241\271\343"
+	.ascii	"\001\311\206.\251\340\316\013\221fD\301\013\226\363\350\345?"
+	.ascii	"\t\275`?\362n\2002A\t\340c(\363\244M\236l\250\020\317\235!\335"
+	.ascii	"s\006\312*\362[@\346R\321\270#E\207\276oh\306\360\207\r\202\343"
+	.ascii	"V\037\220\372`8\024\363\345\234v\007-\240\3148\357\032\003No"
+	.ascii	"\255)\003"
+	.text
+	.section	.gnu.lto_tcpTotalTxBytesFree.27.8743f7869c80780a,"e",@progbits
+	.string	"(\265/\375`\206\002e\023"
+	.string	"\006$\177H\360\316(\035@\n\023\004\264\354\244\"\3139\222\264U\007\313_6\355\360\312\341\306#i\231\f\203\250\375a\256\375\006\344JB\273\263\037\226\2171\265\\\315\255\301/\t\t\222\237\365\375\364s\322\fJx\371A\362\311\336R\312\024e"
+	.string	"e"
+	.string	"m"
+	.ascii	"\t\276\335_q\n\302E\307\t\032\240[\206\305N\367\030r\360\323"
+	.ascii	"\371\361\373\177\365\240\037\\.\312q\246\346\351RP\320\305\350"
+	.ascii	"\036\301\223\022\360tJ\025\340\351d\r*\352\224\274\342u4\"9\330"
+	.ascii	"\234\240\325^:aTn\324`\224M5\231<u\267\352t_j\261\335\321Hw\177"
+	.ascii	"i\265\013zO\377\223\374g\360/\212\006fht^#x:\2257jth\030`\273"
+	.ascii	"\373\307\327\262\355W\331,\363kNo*q\350\250\252\2418\372O\356"
+	.ascii	"Gr\357\311\375\224{)\367,\367\313{\355 \021\251\b\021\352\256"
+	.ascii	"\260\233\321A\223\307Fs\2528\272\277\313\365Fu'\341\210'YG\313"
+	.ascii	"l@7\005\232\023\277\227\205/G'\344\242{<\240\363\001\032\031"
+	.ascii	"`\024\341\346d\016\336\237\331M\362\362\344\3313\213\211\231"
+	.ascii	"\250\t\321\203\247\200\344Q\216\250\b\007\223l+q\203\032\240"
+	.ascii	"\331-\266\335\375b\266\235y\371\344\006H\2662\376\243tG\004\321"
+	.ascii	"\371`\006\331\200{JK\210\003f\376PI8(-O\330P\007\034i\225\377"
+	.ascii	"\007*\253\264\237d\374\372UD\313\256\240\375+\r\001\341\353n"
+	.ascii	"\0049)\255(a\213$d-h\205\256\226\023\2150\265\202r\265VT\337"
+	.ascii	"S\",)\227I\nJ\305\n[`\213\025JP\261P\300\025\025J\005L\261Z\240"
+	.ascii	"\310\351+\226\220\005\272V+\026H\032[e\263\314K|$\007+\315\017"
+	.ascii	"\216K\374\361\313\177\023\233^\206\202`\034+\331\021/\202d\374"
+	.ascii	":\200\335n\267S\321\033\261\211uh\026\363\261\307#\366Z\314n"
+	.ascii	">\342G\217\207\307\0010 \240\002\2419\333\001_'\364\240i=\261"
+	.ascii	"\216\274\220\321\303\352\274Y;\035\006\216X\"\016\003?c\254\315"
+	.ascii	"O\355\245\t\347\276\"x\200\217\341\231'm\362lC\205p\356\004\351"
+	.ascii	"\036g\240V\221\337\"d.\030\215%R(\364\026\206f\016\017\22288"
+	.ascii	"\016(\305\261\033\242\246K\036\265\226C1_\347kw\320\002\312\216"
+	.ascii	"\363\2561\352\364\326\2322"
+	.text
+	.section	.gnu.lto_isTcpTransmitBufferEmpty.28.8743f7869c80780a,"e",@progbits
+	.string	"(\265/\375`\022\001\355\f"
+	.string	"V\330WB o\224\016'\252\021\300\240\003\240x\344/\250\230b\253Yk\370\304j\026\213}R\201\037\300\333?\326\257+\302\177X\326\356D\005I\023A\n@\226\223M\203\306\373\300X\310w-\264\203Cb\t\2212\245B"
+	.string	"@"
+	.string	"I"
+	.ascii	"\002vQ/X\354\306\004\206\3321\307\023\260\034\323>\300r\314\266"
+	.ascii	"56"
+	.string	"\"\217\036U\247\247d|\234\300\330\215PA|\364\034\371/\371\265Z\2650\201\220\236\231\203\335u\232@6\334z\333\007l7\260\377!\366\257\335]+\312~\274\263\263\376\353J\353\225NM\037\200\001\022\"!\251\031\252\022\367\264\022c[X\312\210\307\337\026\371%\276\370q\224!\305=i\254PF\020\034\363\002-\323\376\310IDgax\333\006\205Fu\023\202e\316Ml\030\225\315\035eB\201T\006!(\021\022\326%\2576\205N\336\344L\006%\331?\351H\027&\373s\023\013\332\356*(\301\361aT\"\216\371\027,\307\256\020LJ*':x\344\212\035I\251\251\035!P\347\301\327e\334\346\341\204>O\247y\323\200\266\320F\005N\347q\037\374<\216\243\363$@O\307\351\300\315\373\240&\343\017\210\363`\350\363\361\340%\356\355L\003h\360\320\362\320R\204\\\301\241\245\232\232\351U|\244\2246\236\"\030"
+	.ascii	"2\003\3020\273\t\023R \254I\301,\017\204\202\202\201#\246\222"
+	.ascii	"\376\343L\024\254\002~\215 \236\t\321xF\212\t\r\367\205\361\256"
+	.ascii	"\331\027\013\333\211LM\260J\236j\306$L2"
+	.text
+	.section	.gnu.lto_tcpRead.29.8743f7869c80780a,"e",@progbits
+	.string	"(\265/\375`M\002%\022"
+	.string	"v\341vG\340\322&\035\222\341}\214\376"
+	.string	"ql\227\255\264\233\325Y\320%\347\262\242#\215\034(\304h6\331p\320\261!\343p\327\323\256|u!\2716\355\241 \031\302\030\31339\224\022\256\223\311(@j\224n1\233%\233H\231R_"
+	.string	"Z"
+	.string	"e"
+	.string	"?q\0242\307i\270\200]\235\0241v\303\004\376N\217\016O\300{<}\200\367h\333\n\026\310X\366\260\007\307\343\271\251)\002\262\033~\312s\331c\247)\363M*\035\220\320\016\333m\366\230\363N\344\226s-\271\325\272\223\335\375\320\323\346F\3134\251\354\256\323v\343p{\267\275b\273\201\235%\002-\256\002=?\217\276\005\357\361*\022D\303\346a&sv8K\335\261\337\355\356Zu\354\2077\352\270\037@L\233b\332\353\322\321Kw1\255]:5\375"
+	.string	"%7r\244\344vqrBV)\"\215x\370\3332\376\220G\374PvZ\022&#\236\017=vC\004\217N9e\332\001&M\371\374*O\325\323\rA<hB\320~\024{ \342?~\214\367\210\322\027\331\200P\2219w\232\032U\223hL\3202g\325N_3\004\302_\250Pz\\\200\006TQ|pfy\213\030\223%{u\026 \311Rj\354p\024\204#\311\253=\241\225\267\371\244\2463\373E\030r\311fW\370\n\227\323\3562 \n\024\300d\201/\253\030\354\245u2\230\202\001c,-\253\326\213\005\373`/\326\205\326K\302\367\322Z\271|\340\013\366\245N\354\202a\275\276\230\313\365\372F\302}\267\252\203\322\222\033\033J3J[\311\243$\245\232\316\242\2476jd\0202\262\371\350\256\362\222T&3Ht\300"
+	.ascii	"\372\221\273;S\335\261I=\215@\204\243\226Al;8\222*%\343@, \220"
+	.ascii	"\002\231\251\354\001B\241u\013,\023\256y\037\245\331p\360\022"
+	.ascii	"\b\026X\206@Q\01636\256Hp\025\302\271\317\n\371\221\304C\b\027"
+	.ascii	"\362\271y\210X\371\024\206\021\f\265e\003N\210&\0275\244{\316"
+	.ascii	"@XE\216\013\322\\\320\032\223\245\250\351\351\267\315\370c\210"
+	.ascii	"\205\215a\262\363\326\214\034\226o\345\306\336\333Z\243\007"
+	.text
+	.section	.gnu.lto_tcpWrite.30.8743f7869c80780a,"e",@progbits
+	.string	"(\265/\375`\210\002\255\022"
+	.string	"\366axH\340\264&\035hx\f\266\367b\343\n\351pxO`\352\021\373\320\344=K^\371\262\342\306)\f\270\215p\353V\207n\260\345\3019T\256\265\235\005q\340X\f\303\243\221\202*\r\034\241\317\327\355m\325`\203\204\354M\244\224)_"
+	.string	"\\"
+	.string	"h"
+	.ascii	"\3357F\ft\177\365\321\037\230\326Bh\200n\234\237\241\356\021"
+	.ascii	"\301?O\345G\0250Uz\2322U\036\366\023\321Q\247U\250\247&(Iw\177"
+	.ascii	"\274Ba*9^\330\265c\001 \322b*m\224#\321l\224M\264\031w\352n\205"
+	.ascii	"\241+\202&\333\355X\272\373+\322H\350\247\376\207\360\277\301"
+	.ascii	"\277E\002\327 \017k\023\177\226\312\330\340u\367\002 \r/\006"
+	.ascii	"txZS\2452\351\005\221Xbfo\377\030[\316\371\225\353\356>\343\374"
+	.ascii	":\252\226\264"
+	.string	"\246J\232{o\356\273\271\237r/\273=7\367,\367\313\3555\005\345\004\020\007B\335#nL\372H\352\350\371\257'\377y\377\004\n`:\2028\007\227\240<@\324\216\003\036\243vT\3019\271cFBs#\313\001\252\f\225&KY\221\222\022_o\274&\f\260u\253P\236\253\314T\211\332I\021co\347xY\362\016\241a!\333\333\2319\326\232&\024\324\006\270b\253A\300\306\274\"\244\366\nJC\306\244\363\273\350\214\024/3P\221\213\232i\225\377\025\206U\361\247\031\307\036\031T\273R\301\244^.\030\226w\025*F\365r\341\220b\205+\327\347\nW\035X\341\205\017\206\225z\371T\241\353C\235\336\212Y\205\337\253\325\n\277\223\261\225q\336\202\342h\206e/\260$\376[\036\240\230\210\2608l\216f\034\223\035\377\360\361\301GH4\302q\316\301\331\003T!*uA\214Z\034\331\356\2161\347\334\343\216-"
+	.string	"\031\315v\311\0373 \300\002\021\242\344\001c\300\002\206(ZTS\364\r\306\311~\323v~\220\021\245\035\204qU\264QG\360\023\370a\230\305}\330\243\344\275%\212)X\205\360\271Y\210(\270?-\317\342>,\004!\323\335\006\224\0208x\222\272W\033\350Z\363[D\346\362\321X\221b\241\022\033\314\203\004\353\230\021Q\017\326\334"
+	.ascii	"\037%t\211\006|^n\234{[K\365"
+	.text
+	.section	.gnu.lto_tcpDataOut.31.8743f7869c80780a,"e",@progbits
+	.string	"(\265/\375`\214"
+	.string	"\225\n"
+	.string	"\346\023JA@\247(\035\300)o>UJ\200\202f\345z\363[qY\0306\323\270\217\261\357\327\260\234\b\017\364\315ZC\3268\0365\266\265\004\375\004\344V\024\005F\370[\335\212\006\f\\\213 m\362\t\331{\247\0248"
+	.string	"5"
+	.string	"8"
+	.string	"&{\227\001\216\001\260\335\255\263\344\341\351\224\241\237 \216N\267\220O\352 B \201\202X\242\030\006)$W\271\354\020MRZ4\273ky\022A\356\354\266'lG\330\337\002\366[?\225\322\327\302\017\330\003\t\327\256G,\302*\310\020\240\\l_\332_\235\025\276%\372\302nju`w|p\335\236y<\203\366l;F{\346\320v\3601\246s$\027\b(\360\232S\345\207\264\317\212"
+	.string	"\rL\022\202m\215\003\bA\370+\240\215mw\177\362\314\027i\317>GP/\024\253E\2221{\034\311\251\262Oww=S\001\035\307\331|@\216\267\231\313x\270\017\305\305\306\373:\260\202_\007\362>\213\312\3616\030\225\373\300\232ip\307\323}\365\323\351|\3652\356\351\316\2245\244Y\242\026I\247\rf\310\237\002\017"
+	.ascii	"2\241E\034\003\353%7\354%\264\325'H\214;\253e\342\317\330/0\345"
+	.ascii	"\022l\263\232\"\356rS\355\321\300\324\036"
+	.text
+	.section	.gnu.lto_tcpDataIn.32.8743f7869c80780a,"e",@progbits
+	.string	"(\265/\375`\271\003\r\031"
+	.string	"\006.\240H\300VQ:$\341K\211\210\037\235\203`\346QI;\262\205 \016\005\367\005J~\344\203\\\316\241\344\225\302`\024\347\"\315(\374\002yM\207r\257\240\377\315t\243H\020H\005\274FB\020\356^\003\364\250\375\204\220\275\345N)\207"
+	.string	"\202"
+	.string	"\223"
+	.ascii	"Ln.\355\373\370\217\332u%\036\240\326\241\036I\265\2165v\205"
+	.ascii	"\247\036\337\372N\303\307|\247\256\331U>\022\325\037u1\301\333"
+	.ascii	"Rku\255\f\203\275^\257\3679\336(Y{\210\002\351\\Y\363\245\220"
+	.ascii	"&7\221\347\341\004\177R\324\370\023\025-\346\315\223\025\245"
+	.ascii	"\363.q\242M\242\276 \027\007Y\234\246D\026\237,\361g\322\324"
+	.ascii	"ZU\242\217\334\363\376@\312\211+1\202\\\\\202\016j\255\22671"
+	.ascii	"\350N\335\266\220\355\006\366&\005>\313c_\210\b\351t\263eG\342"
+	.ascii	"\020\326Z\027\034]\360`\200\210F\211\357\364"
+	.string	"\233\002\242\345\266\242G\366\354\221Gn\316\376\r\321\223\025\357\220=\363\335\335\372\356\227\371\370\307\\\367\003`\255>\336\252\357\356\324'\215\372\244\303O\032\f\245?*MA\351\371I/\225\226S\372\004\004\344p\322 J\255)z^j\023U\262a\373*\333[t\243\332w^2\252\326\030U\222j\2555f\020\236\322L9\222\bK`\206\202\354\310\322s(T\212\220\346\346\214\332pgFM|\344\223m\tO\362R\200\244\006\265\nf\374\257\017\334p\347\022\220\220\215\3515\340\b\f\270t\307\343\242\373\3267\2623\241\200S\2550@\360nX\212\256\224\201B\350\223\370N\277\375\226p/\346\312\245\273Dv\347\336\304\227\nOz\035p*b\300i\367\200\024\235-\234\b\b\031\"\033\303\207\340\254\344\312\314\320%\370jg\366J\220\230\200p\330\366\210\351G\334\315\331f\311\257\035\323 \1773M\261\0212\332\334"
+	.ascii	"\2231X\016\316\016-G\026\032f\363\001\266\203\241\003\216l\026"
+	.ascii	"\243\271h\263X\b\331,\203+G\206\343\301\005\233\321\\64\326\371"
+	.ascii	"\020\233\271vttf.\325X\277C\021t4\365\254\r\302yO)\335h\362Y"
+	.ascii	"\236P\312\254\301\324\262\026g\031\263\236\240jW\213Cp\326\316"
+	.ascii	"\214\246\330\234\265\255=\220\220m\326Z+js\226\264\265\207!\242"
+	.ascii	"\230\255M-N\322\231]\036b\2159\263\252\305\331\007\303}\342\344"
+	.ascii	"AHZnX\350\346\374\372\230\274\006\004I\250\021\360\224BP)\"\023"
+	.ascii	"\020\005\022\314h\332b\220\002\031\252\353\006\021`Ac\205Ar\337"
+	.ascii	"2*\036\326\201\216\0201y'\205\205U-/\266d\354\033\267\006Q\264"
+	.ascii	"\327\235\344p\255\301\265\225\324G\\<\351\251V\242\366!\222\243"
+	.ascii	"\222)\203\324\005\277\205\030\231\276\3240\353!\033S\\\344\321"
+	.ascii	"t>\214\376=\320,\340;\265j\210[\207\357\024_\325`\2216\211\351"
+	.ascii	"\307\222\225/`\214\257\233A,\244\035\360-\240?=ZI8\365\351\034"
+	.ascii	"\360j\360A7x\321\317\365d%\207\374\233\316\024SH\323"
+	.text
+	.section	.gnu.lto_tcpDataOut.part.0.47.8743f7869c80780a,"e",@progbits
+	.string	"(\265/\375`*\005-\035"
+	.string	"\226r\260I\260\226Q:4 \3154\216\317\206\237\302(7\307\023\334\001\333\311\320Dz?c\\\377/|g\345\237\025\321\276\264,\2476\033\260\274\205zmX\233\351\377\301\026\256S\374C\204\035\372UVC\016n6t|B\310&r\247\024\223"
+	.string	"\217"
+	.string	"\240"
+	.ascii	"\347a\253\234\242_\365!x2\322\264s\352\005\344iN\370\362\234"
+	.ascii	"\377\r=\207n\366\253)\220<\247}\247?\355\236Cw\232Z\223\232\252"
+	.ascii	"j\375\03585\215<\365\3577\342)y\231xj\037\207\355!$\357l\254"
+	.ascii	"\377"
+	.string	"\226\352{\b9\342\021\254\265\322N7\306w\037E\032\356$w~\211\217cO\255\025\306\307\342\342\212S#\0233\234=\237\212oX\340\312\020-1_Qx\203bF\357S\237'|\2749kN\216=\265V\237\250\305\355\272\355\021\266\035\330\324\026\247s?\365\002NLz+\210\346\227\271J^\362a\335$;\234\266\031\247et\272F\234\246\241\3233\217\272e\302\351X8\r\013\247c\306\351\027\235\206\021\247]t\232<\325=\206\323b8M\303\3510\234\336\235\236\377\375\307\2215h\252\025\305\227.\365\005%B\343>\376\250\237\352k\337\007\362\037~\020\277\250\0308\005\233\202\327q_\307\220\337\343S~\371\220\322\315\035)]X[\374j\n\bNRM\301Z\177\r\310\323\250!#\371P\337\261\0130\373Z;\202\004#O\270\023\020\344kc\256\\K.\314R%F6x\256\235E9\362BD\341L\204\022"
+	.string	"\227\224<@raLY7\236\304\035\367U\216\274\204KW\\jeT\203W\341Ij8KHJ"
+	.string	"Kt\037\344:PV\266\366_\342r\245jW\311\341\356b\200JR4\271\330\266\360#5\035\240\221r"
+	.string	"0\\\235+\373\302\213\324ll\237[\225\260]\312\303\332z\202\315\271\266\206\333|\3179E[\302>\021\021\023Xk}\317\346\360!\036\004,\325Z\025T\221"
+	.string	"\362e\234\372:1\271s\370\021\332PR[\371\343\023\224\373\271\221.y>\224A\265\016>7\234-G\313\341l!n\270\f\264\237\233\217\007Z\211\313\321xr\f\364\301\206\243\005\001\001\341h\257\207u\223\334C\264\274\361\301m\n\301\322\304f\203\265\330\226r\255zY\264j\004\200Y%\016\320f]L[n\210\263)\2635+\303\"\243\331\231\255\261\301\243\331\231\022+B\t\260J\236\231\205\301\320Bw.\2633\027LPRb+\263\247\202m\314\3066\324\242R\243M)\r\300\226vU\013"
+	.string	",obtxZ[O\341*\271&F\201R\302\306'Y\301\254\331\0347h\250q4D\241B%\024FJR\222\244\003\200\002\231\231\243\333\022`\325\031J;\247D\242\253\373\177\006\364\244\207\n\362\300\264>-\231\303ij\274\013%\033\271\350|2\235<\260\264\231\241\312B\2000\324\316\235/\0258}\n4{\"\305V?+\332\305\254g7\347\245\203\260\351=<\bwA\n\205\033n\3463\266\036\033.5\220\340\343\307\274\037\220\325m\207j=\277\375\357\025"
+	.ascii	"\030c\205\350i\0263\347\363\205\203;\374\261\224\237d\224\341"
+	.ascii	"\347\206\235\003\322K2u\324*\200\216E\372\357\366)\356\214h\236"
+	.ascii	"\303\b\033\377\2407\366\215\317\b\200\2672J\001\310=\002\222"
+	.ascii	"\t\262;\034~n\274\215,\254\255\304<`s!\025EG\0047MDk+\263\267"
+	.ascii	"\006\213\004R\275\273\351\006\205.M\243S\006\304i"
+	.text
+	.section	.gnu.lto_.symbol_nodes.8743f7869c80780a,"e",@progbits
+	.string	"(\265/\375`\306\003\035\021"
+	.string	"V\032eF"
+	.string	"u\324\001\304\350^X\375\355a\002\305>-\024K\357q\371l\331l\261F>\357if\375\2207=\376\377\377\373\245\377;\213 \210D\361@\324\021"
+	.string	""
+	.string	"|Y\204\333\017\262X\373\233[\332\357v?\221+IJ)\005T"
+	.string	"V"
+	.string	"N"
+	.string	"\247\306"
+	.string	"\222\027Bre\341I\253\n\337\241\3000\2041\003\363\fz\207\354\350\341\342\345U(\274)\365-\023\236\245\303\026\017\t_\352\323{\035A$}\227)\r\004n5\363\340WR8"
+	.ascii	" w7\003\303\260%\263\373\273BV\314\001A\020t\371Q\357.\247&\355"
+	.string	"\031e\230#42\244v\256\3346M\\7J\355L\231u\304\324@\302\322>\305n\035\305/8\361\007L<\202\022\237\200\304+\030\361\001D\274\200\020\357\002\342\007|x\002\036\276\200\352\r0\270\002wOO:\374\013\257\017\016\035\231b\305`\033\036\325\322\360_g\370\231\213('\216\244\177j\213\364\017\365\244{\252I\3726~\322\265\261\223>\305\223\364\214J\367\250h\344e\222\203\310\222\256\235\023U\332?u\324\376\241^\273\2472\337\024\301\361Zi\327j\327>GnP\343\204\005\251e\314\260\241\244\324\236\215]\273UN\261b0\023\347\252\217\363\371\002\205B\256\372B\256\202\333U\203$\331@\316!\367\215\253\205M\247l>E\312\314\212\301Z\250\315=\233\317\030\354@\214\254x\241q\264\027{1?hp\232O\021\005\305\271\323\361Y\347\364l4e\256\372\002K\250A\034dbjDA\fJ*\031\003"
+	.ascii	"\003\241!\326\001\021P\024\2231g\242\242\330\221\036Bs\305,C"
+	.ascii	"\266s\203a\273'B\366,\3120c)d\251\033\237\370\022\372b\003&\351"
+	.ascii	"\271lfl;\371\234}R\337\023\016\226\355\241m[\"\307 <\315R\236"
+	.ascii	"\006sR\275F\241\241@\376\230$W\216\007\336\3144nYhS>;\236\352"
+	.ascii	"\002\215`qC\377[=\350*\023\310\216\037\214+t\035\276\251\213"
+	.ascii	"\034\302\225\346X\363}\004\210U"
+	.text
+	.section	.gnu.lto_.refs.8743f7869c80780a,"e",@progbits
+	.string	"(\265/\375 _=\002"
+	.string	"\262\305\017\025pE\352\374\377\177\350\325\274\307\037\301,\032iA\266\266\245L\001\013ME=me\346\303\372\021\035:\313\213\003\356\211\352\005\037qS\026\360\003|\304\364\343\270Qx\343+\376\335M/>\377A\001"
+	.ascii	"\r\212\022"
+	.text
+	.section	.gnu.lto_.decls.8743f7869c80780a,"e",@progbits
+	.ascii	"(\265/\375`_>=\006\001\252\216QXW LA;\035K\231 0\177/U\025\321"
+	.ascii	"\005\334\305\tk\334\243%\035]\306hX\005\325\352\016\"\003s\323"
+	.ascii	"$\357n\202\350\325I\327,\361\205\366a]\241\216\034\277\230f\305"
+	.ascii	"\340\372`\364>JWF\201@\226g\\\216\361~\231E\373\337\262DW-\320"
+	.ascii	"\bi[\312$S\343\004o\005\217\005j5\232\222dio}hu\347)\355f\037"
+	.ascii	"u\177\032\017\365S\371\355\211H\321\347\267\3617\256T\203\307"
+	.ascii	"\361\002\370\003\260\357\263g\032\332\257\006\301\033x5\b~\215"
+	.ascii	"\032\177\251\2302"
+	.string	"\255\350\323g\026*J\332\325X\366\356L\260\305\205\366|\244-h\263\220\266\300\354\316\004_\006\0061N4\226M>;\376\323z\227\017\267\321\026\230C0^\351c\\\351'\371'\335*\377,\241\247\b\006\246\3204\351_\370\021!\223(\211\216=\f>|\310^Pl2tv\314\245\375}\234\030\3347(\024\252\302n;\364\343\237\327\357{2`:_X\023\233\376\\,!\253\007\n\362p\337\276V0\303\372\347\023\371\230\336\366\237\237\002\003\230e\273\213B\030\322\246\265\367.\336\350Y\374\321\257x\244Wq\245\377\374\242\016\252W\220\275>\n\262\377\237\366\327\323\376w\332_N\373#\321\376\366F\264?\231\366\227j\020.\207\340\243PB\201#\372\354\237\343\227\317\274\322o^@\277c\267O\354\376\375\206Qn\330\333\311.Z\363\315W\376\276oH\3556\272,\356\312\244t\370\360\001\223\325\345\005\221\262\003["
+	.string	"\263\222"
+	.ascii	"\003/\240\326T\220S\233\366KD\373\025\323w_\016A\277A\264_>\367"
+	.ascii	"\213w\363\356W\f\027\250`)\334|>_*5~\367f\202EH\355\376\302("
+	.ascii	"\240\202\214>wp\265\264\337\036\372=\334\231\240\005\323;\023"
+	.ascii	"\274\323\277Pn\024\277\323{\347\322l\3574_\016`\356\345@M\273"
+	.ascii	"\261\354\nf\277T\332/\r}k\270tW\332\301\255\363\353\344\312\271"
+	.ascii	"\272lw\273w\033\363R\177`]J\332o\007A\034\030x;\b\3725\322\177"
+	.ascii	"g\2022\227C\360\002(\223\016t\223H\030\326\215\203\273\\XnP\237"
+	.ascii	"\357\022\341\330\366\313\372\354\327G\327\024q\273*\260!WLK\314"
+	.ascii	"\355\266]%\227\355\"\271o\367\310\225\336$\356\327\310U\363\016"
+	.ascii	"\355\336\3151\"\027\315l\310\002\334k\322<\rfeo"
+	.string	"\246\257\250\226\373\005r\333\233\344\256y\032LSf7q\220M\367\336[\\\027,\003\246S\002Uc\323\275[\277X\356w,\311%\273h\270\245\332\333\t\212\202%P\204\264\330\333\273\375\360\241\303\207\233d\310\007\021\231\354\037\320\270\204\rh\017\241\375\005\355~\321\316\324#$\266%02\212j\360\373\354nv\313\332\335\341\333 !R\237\035\005\355&h\031\261\260\230\253\243'\033m\314\312Y\337\216\025\237}\004\355Wz\301\356\027\013<`\324}\276^W\210\337\257\033\304C\030\301\261\222kc\355\275\357\227\b\320\275\227\367+\306o\357e\314\275\034\334\313A\266j\232\032\022\314\016\202\366\333\3453p{\004\027j\177\275\301\235\tnp9\004\363\235\t\202p\263\334\357\325\305r;\354\f\202\356\257\275\333\r\257\334\352\301\366\331\333\313!\250\357L\260\017\317$\363\024\232\021\254\0074d<\367?\201)\310Y9\220t"
+	.string	"\270\253\003X\341Z\340\236k@!\211l\222\334Y\302f$\356\227\350~m\334\357\0068\340~\215\356w\204\f\356\027\204\373\315q\2771t\300\375\342\334\017\220\300\033~\260\214;\216\361\004\270\253/\356\030\006\277Pa\227\026.\027n\271,\013^\301\332\375\333\260\020\016\007\351Pp\317gVXu\177'8\273?\020\214\335\377\306\375\256\177\207\337\375&\335\357"
+	.string	"\246\340\353\356k\330\275\003\023\334s\r\367\017\004\334\021\201\373\345\271G\0048\006\356\371\207\373\037\375\271{\233\373-\301\335\331\334\257\007\334/\211k\302\375\202@I\006\356.\304\335)\270&\344\254\354\236\373\334\237"
+	.string	"\356\317\201\373#\300\375\007\340\376\033\270\277\006\356_"
+	.string	"\3677\200\373\013\300\375\017\340\376\035"
+	.ascii	"\240\002\031\367w\021\272\377u\277~\356W\317\335;\270\253\001"
+	.ascii	"p\177?\367\327s\177)\356\017\305\375\347\334?\316\375\335\334"
+	.ascii	"_\314\375\273\334\277u\377+\367\257r\177)\367o\341\376+\334\237"
+	.ascii	"\310\375gp\177!\367\007r\377\036\367/\201\373\323\340\376\254"
+	.ascii	"\373#\335\177\307\375\215\356\017\002\367\317q\377\030\334\337"
+	.ascii	"\203"
+	.string	"\373\245sw(\356.\347~ip\367%\356\227\306\375\276\340~-\340~Qp\277\rp\377\017\270\277\007\334\237\003\356\217\001\367\177\301\375#\340\376-\270{\230\373;\300\375Kp\377\005\270\337 \356\017\202\373\203p\177\032w\027\341\356g\356\256\343\376\np\177\017\334\377\203\373'\300\335\277\334/\024\367{\347~Yp\277v\356\367\211\273\207p\277u\356\327\211\3735\201\373-\201\373%\201\373\035\201\273\307\271;\234\273c\271\273\005\334\335\315\335e\002\003\003\003\335\265\273\353#w\232\253\231F\206\346\245\254\224\235\362\214,#?]iN\372\"Zn\016G\227\005\331[\324`\344\0270S\224z<e\027\236_\350&{~)>g$\234\367REZ\344\370)\265I\357IY\230\366\026\036+\216X\220\376p Q\341\371\350\267\\f\304\331hrz\026\205 \027\025\312D\236\213~\352\210\215\353\311\205P\020\256j\"\241"
+	.string	"\362\034$\234\022\001\303\372\234\177\204eI\332\236l\005\223\020\371U\371\354->\316\354\243\371\322\216\370r\217g\237;}1cQ\203,\243pi\225\373.\243\310\315\025)O\352\232t-\f\023F\224F\3352+_\310\224\252h\344\355Y\231\225(\220\004\342\274\230:\241\250\213?\023\032\251\231=\343\376\260\237\360\311SO\027\356s\354Gg\307\224\3433\256\202\363T-\245\345g\314\347P\246"
+	.ascii	"B\367<-\2578\273B\322F\005\353\261\314\270;\022\305S\034\353"
+	.ascii	"\261<\301Pb\341\274\2257=\275\257<\214\2676\344&E\227_\204\025"
+	.ascii	"a\303R~\315Ei\306\013'e\323\013\366\002\303\213\351\t\024+\314"
+	.ascii	"\027$F\216\273\367\nf\361\001\352\331y\340\223c\372xR\007\303"
+	.ascii	"u\2254\344\263\343\272\030\366\376\302U`=\177\237q\r5\216\351"
+	.ascii	"\0040\226v\366Yxg\346\260\223\027\246r\371\002;\301r-\336\374"
+	.ascii	"r|n\302\362\204\233\032\371\354,C\264/\240\b\253\030j\302\332"
+	.ascii	"LO\373\212\356\275\333\272(\016\244\351\216\237\250\032\330\306"
+	.ascii	"\213\251U\337\321\n\214t\265\205\305\027\205\333\360\rO\273o"
+	.ascii	"_,\304\271\230b!8\016\223a#\230\bf\202\221`3\214\206\207\340"
+	.ascii	"3\274\206\225`7\274\004\247\3411\374\206\303\260\032\376\302"
+	.ascii	"Ep\022\314\206\217`1\f\206\3130\334\225\3426,\344x\013sm]U\231"
+	.ascii	"*\3416\f\325\001n\315\364OW\322tG\217\013\346\2146\177\334Nk"
+	.ascii	"*:\244\365\303\017(\b\0231\263\224d`\246\373\206$\263\233]QQ"
+	.ascii	"\032\035\204\304)M\367\336\370\310\005N\362i\3721\255\001r\207"
+	.ascii	"\233(p\212. S<E\205ut\005M\263\366\242{\267O\305\343\202\365"
+	.ascii	"4\245\300M\356X\t\267a'\374\204\333\250\320\213)C\353\202A\211"
+	.ascii	"\3426\354\343\202U\375\341\215\333p\027\366\272oH{?7\370\021"
+	.ascii	"UUdo\357\2552\261Q\205\310\t\331\261\227;V\342\345\375\202i\233"
+	.ascii	"\241"
+	.string	"6\364\031Kk\034\007i\ts\373\233\372<\223B\277\3345\226\245\366\225)\332W\346\264\257\264i_\t\323\276\222\245}eJ\373\n\223\366\025\026\332W\234\332\365\236v]\247#\207^\216\025Q\222\003W\265"
+	.string	"a\"=\337\264k5\355\332L\373\333\227v\335j)\217A\362T\207\302\207vmC\373TC\265\353\247v\374\204u\242\311\f\374\\S\343x\206\317\\ }[j\237]\373\350\016\227\003\023^B\313\261\026\365\331\3570\324%"
+	.ascii	"/R\026,\272\374\264\013\365f\202\370\005\206q\245~\004\307\360"
+	.ascii	"\240X\230U\363\211>\301\366#A\0272Aj\021\243\247\244I\333\002"
+	.ascii	"\263\0202\231\216\375\254i\027\226\351[\204U\030\341\037!\026"
+	.ascii	"N\214\360\023\246L)\315\310\226v!\017\355\216\211\360\220\230"
+	.ascii	"\222\334\017\036\302B16\336\332|\334\320.\224\241/Th\244q\017"
+	.ascii	"\366\271Rw\303N\207A\363\001s\373\354B \355'\270\356\026taS\337"
+	.ascii	"h\020P_\350\345\020\254\340\316\004\257\0061-\013!'\300\351\225"
+	.ascii	"\221\246\257\277\213&\\!\235\322\344s\337\313\213!\262\317_E"
+	.ascii	";\001qC\312\323Q~\372R~\312\347\275\336\343=\224\337{*W\372|"
+	.ascii	"\356\377\344\355\250\252>z\337\220\262U\326\364\371^\307\327"
+	.ascii	"aE\235.Z\0210)w\312C\227a\321%\276gzh\006Lgn\033\362M|?\343\242"
+	.ascii	"\261\200m=#{\327\356N\253\304Z\276\277#\273M\370\356\334}\"\004"
+	.ascii	"3\3233\262\367O|\037\365Q\030e\273\225B\032ozF\3664_\213@\032"
+	.ascii	"\026d\017\232\351k\325B\335\231 \335\003\334\252\356>{\260K\373"
+	.ascii	"\003\tq\362x,\242.\244iWP\224K\350\201\262~\253i(\332\202\375"
+	.ascii	"U\245\030\362cF\372\276~\013+p\372I\036\355\247\356\033\322\t"
+	.ascii	"V|D^-\003\246\323\005$(H~\356\233\274\334;\371#\357\366q_\303"
+	.ascii	"/y&\017\367m\377\366J\256\364\223\374\232?\325\347\370\035ln"
+	.ascii	"\327\023\347B\372[x\253H\013\351\002\332J\362Q\357UBO\321\nP"
+	.ascii	"\334O\222'\3733\230f\273\237,DP\274\030\037\\\344\256\322~6\310"
+	.ascii	"\036l\241=\370\243f\344k\353\t]\233\253\234\224M}\332\027\tj"
+	.ascii	"\305A\265\361iW\245hW\235\224\275Y\f\025\241<\271#ej/\346\242"
+	.ascii	"\303\210\b\007\330\207y\346\202\276\340%\013$e[\332U\037\332"
+	.ascii	"U)\355\252\222\227\007Q\243S\\vo1.\200WqK\237]}jW\233\3323\025"
+	.ascii	"\375Z\017\344J=|\353+\315vKW\344\360\222\276\356\264_\017\301"
+	.ascii	"\230\353!\350y\311_e\024D\210@}\275\325\217 \\\326\366z\037\376"
+	.ascii	"?\374\316e\357\fbn\220-q\372\374=\356\223@\262#i\237}\212\333"
+	.ascii	"\271\373JK>B\272\224p\331\2145\025j\327E\243\023\302\006\227"
+	.ascii	"\225\225\245\266W\246e\306iE_\236VxJ@\\m\263\336\202\364\370"
+	.ascii	"\254j]\2646\265\026Cn\350\320\241^u\320;\253Kj\312\"\244\250"
+	.ascii	"\312\312\325+\262\260>\245\317\352\217\213\366\027%\020\310g"
+	.ascii	"\325\207\247U\371 \242\372\254\356P{\034!\022\342\372\254\362"
+	.ascii	"\360\302Qe\305\222\f=t\343\206Zu\2716\321m\202\362\321\212\t"
+	.ascii	"T\303\313A\345j\225;\314\022\223\253\266\317j\364\242I\261\375"
+	.ascii	"\361}V\247\256\230\013T\212\034L>\2538<M\350\226\244IF\314\326"
+	.ascii	"\252\013\027\252\024\366\273\355F\202*\243\324\364\250\001\311"
+	.ascii	"\003\314\332Q\317\227\fW\245\\\255\021\302\b\236&lj\263\374>"
+	.ascii	"\253O*\224\032e#\206\037\212=\255\322\370\340\223\252,\371-\261"
+	.ascii	"@\301\335\330\341\244\316\370\"\"\003\212\242U&\265\251\205\205"
+	.ascii	"\224\t \235V\241\352\3222(J\372\371\257\247\005\235\346\017J"
+	.ascii	"L\305g\025\206\252\364\266\264\207\242\345l\252\254.I\215\241"
+	.ascii	"\2369\0011i\"Tk\223\376^,\331\2302\372\\4\367\302\207\n\\\013"
+	.ascii	"\251\332\342\267P\370\332\313\247\0075\245\236\321\336.Z\363"
+	.ascii	"`\303\215\267\036T\352S}\252+N \245\310\313\347\310\325\025_"
+	.ascii	"xT\222>\253*\262\\\314\026\364\210\310g\325(\337x\021\242Z\n"
+	.ascii	"\201\241\241\022\251D\371\205\3560%\nKS\227\031\314\217\253\n"
+	.ascii	"\371\225\252B\031j\305\271\367\221\t*\316\216<p\230#\355\256"
+	.ascii	":\257Tu\252@\022h\267\222%\354\251\002\271\253)\324\237\357s"
+	.ascii	"\201\n\235\202\272\240\237[\212l\253\026\006E`\240\332s\002\220"
+	.ascii	"\226<\274h\226\212\302\325\036\234\347\306\244\253\350\263\332"
+	.ascii	"\364\264*bXL\237U\346c\305D\321Y9?\253K\267k:Q\271}V\225\277"
+	.ascii	"\205\245\204\306\366Y\335\177v\373\314\344R\214a\257\250&ZU\374"
+	.ascii	"\374\362\237\004\256\324\026\220\274=\030&\036ON\237\342\371"
+	.ascii	"o\205*GS\020\024\275\\E/\363\005\367\276-\224\250\210\n\225\314"
+	.ascii	"ww\321\336H\016\020R6u\231\302b\206s\3173\037\362\253KE\226\343"
+	.ascii	"z\216i1\321\376\202\246\363\362r\221\001\242,\3215\220\236\204"
+	.ascii	"\206H\221\222}*P\242\352\210\002\305\216j:\315G2\233\331\344"
+	.ascii	"Hte\212\207Q\221"
+	.string	"$}w\227\217<\250\235!y A\232\224\300\317\376\322\243\363\023i~r\247\0356\256\243\002\222\347c\027\265\036\270\313\037\035\035\256\353\320n#!\320RQ\221\007\356B\247\341\340\362\234\024\005\364P:\361<\227\345\202M\025r;>\347\270,\007\243D\354mN\256\211V\3617$\307\344\253`e\n%N&.noW\232\337\260\023\315tB\227K%\244\271\220{\261\267\367\232\007,K\220\246QZI\222\340\275\225\224D{\350#\356~${\351v\023\t\247\226\\\246\264g7\367\314\226\333\336\356\205\326\364r\b\n@\255\306\363\032\314\017e\022\216\317\032\030\311icF\234f|\316EZ\351\275K\352s\201\241\377E\030\221|v\245\031\255\335[\232\321\256^6{\2020\304e\210\222\217O0{6\223\222A\325\230~\316d5\236\313N\220r\262\372\214\363\230{\016\313b+Kf\355\330\347\273v9\004\003"
+	.string	"V\343y\b\336\234\364\307g"
+	.string	"\334\231\340\227W\331\322\332\026\220\334z\336\362\255\354u\221\2662\212\bTT@\362\3666R\221\007\367\034\304\263\027\256a\364\245%\235\021\326\304C\232\273\204\304\375\311\270K\356\202\244\252d.\277CT(\334\242h\367w\017\356m\244\266\273\210\351\342W\275\327\203\373\313\305\227"
+	.ascii	"\276\035\204\316\336K@h\236\316Q\266\204\261\301\366\260\267"
+	.ascii	"\262\310)eRnpJ\227\333\031\344\355\271\301\331\356\245\013\266"
+	.ascii	"\324i;[\2502C\225\277\333\335dz\356&T\271\343lw\321n\241J\231"
+	.ascii	"\335|\3128\333\245\322)ez^\247\024\372\334\260\233[\271\233\313"
+	.ascii	"%\335\204>\235G\240O\031\247t\371t6\231\236w\267\320}\227\020"
+	.ascii	"i\231\224=[\272|\331{\007\265Q\245\313\336\313\242\255\204{\241"
+	.ascii	"\3154\025\332J\373\276\375h\235\366\336{+\277\346\232\240+-s"
+	.ascii	"\2779u@sz\366\236\333B\"(\257\322g3\225w\357\236\266ho&4\006"
+	.ascii	"$\350e\342S\264_vs\031\304l\202\272\3640\241>[\307\322}:\245"
+	.ascii	"M\320\2323/it3[\345\215\3569\246\"-U\266\373\013\357E*\205\024"
+	.ascii	"\364\331\263\226{\306\312Y.p\313\0325>\337\257\313!\210\201U"
+	.ascii	"\215\347+\027\"F\\j\237;\360\310=\262\217`\331\025\226\212\317"
+	.ascii	"_t9\004\tp"
+	.ascii	"g\202yG\215g\036*\035\035^\334g\016\262\016\350S_\026\363s\246"
+	.ascii	"\302'\b\f\f\f\314T\237s\344*\317T\036#\234\363\341\\\006\243"
+	.ascii	"_7\001'>H\2462\216\263\025Lz\237\351Z\340\224PT7\246>\016I\020"
+	.ascii	"\323F\230\324\227\251]mV\313\032Q/M%\250\036QPa;p\356s\333\274"
+	.ascii	"}C\360\226\260\366\360_\003\314\360b\370\310-2\f cFC\206\362"
+	.ascii	"\363\204\037-^\214\275\030\230\312\\\024L\205\251\204\231\235"
+	.ascii	"lZ\0300/\257\242x1\366X\344\025?L\260\234\224Sd\241\f\230\316"
+	.ascii	"\275\\\002\341\307\024/FSf\n+[D\312`c\344\251\200\3459\256%\212"
+	.ascii	"\"\206\306\"\253S\344\0311\034\306$Y\236\035\034\325sh.`\213"
+	.ascii	"\306\342\220\002\317\241a\223\306\243\215\212C\\u\262\fGd\016"
+	.ascii	"{4\n\211G#\022\271\016\20722\254F\230\031\210:\353\n\307\n\260"
+	.ascii	"k2\346\005\271\276psC\2249\301\202q}\321\321\3411\032\217F!K"
+	.ascii	",\201<\342\004qXc\021\271\203\363\202\b\027B\200`W\022H\"\253"
+	.ascii	"\302\212<\252Pbe\2233\204\2101\272\220\fa\\w`\330\261\021\221"
+	.ascii	"t\201\005\004\032\026I\334\241ay` \262\304\025vl\330\r7D\341"
+	.ascii	"\216\215\210d\261\203\210\231\344\312\316\220\302\216\rk\001"
+	.ascii	"\213$\262!vlX}\263\322P\324!\026\331\242\321\005\nV$\017\211"
+	.ascii	"\"\216\361h\263^`\307\206\205\361\034\232c\361\206Mr@\"\327\033"
+	.ascii	"6\0314\036\203k\362\250\243\202\361(d\207H\226%\316\270\r\273"
+	.ascii	"\263\332\330@\300x\324nSD\256\306\225\204v\021H\370\200\204\022"
+	.ascii	"N\bo\214k\013\tc\221-\0225p\342\002\025\254+\262\205\023\"t\210"
+	.ascii	"\354Q\304\r\221%\005v\r\261a\006v\247\004\013l\261D\322HD\212"
+	.ascii	"\b\221,\006`M\nqxR\320\0320\026I\254#X"
+	.string	"\262\347\3200 \204\033\236\241\016\"\331\035\027\030$\273\363\302\026\2212\340\360\270\340\360\214hyY\223\304\021\303\035\236\230\033\343:\\M\020\223.I\344\032\002$\261\304P\033\213\304\034\233a\360h\\u\2128Ca\bI\022D\035\234\241\220\035\342\340\334\350\034\207-\306\022<:G\233!\222\307f\330\302\256I\326\304\020\006\207g\004\213<\346$YD \001\007\347\270&qp\216Ca\013k\302f\2759\332\f\365\313zS\224a\310\302\302\013.\2640\204\301\205\241~\301\341\0311L\256\310uE\342\f]\330ap\204\033\342Pe\207;6\354\212\347lpS|\326sh2 \262\304\025`\222C\227\f\260\310\243\005dV\235\021D\021&\202\310\265\210Sd\215\353M\221e\035\2567G\n\260\2547\307\022y\035\302\360\2224\036\213\354\316Q\270\262\304\013\334\360\020G\350\225\206b\b\326\345\206\270J\200\035\206\260"
+	.string	"\235\"Q\204\013\222\265\300j\242\270\332\254\027\350\020\002\033\342\b\035\035\242\n'\220,,\362\270\223\221\232\035\226 D\25688<)\234`\265\t\344\232\314\231\r\2621F\022E\035\342p(\364\034\032\326\206\007\311&CH\016O\254,O\211\r!\2609\332\f\207B\344j\224\3418\034\n\223\3105\311c\034\016\365\215\261\030\202\3410\2304\026w\222\303\241\320x,&\213:\353p\270\302\016e<\207&\371\301\315\212$\346$?"
+	.ascii	"\221d\213#@\360\030I|p\202\307X\324\371@\004\022\206$\224p\002"
+	.ascii	"\304z\303\243cc"
+	.string	",\202@&y@\230\300\236X\215:D#re\215\305\341\rqE\346\260;\303\341\005&V\344\316p\030d\223E\235\34108\034\006\207\303`\bl\216/\234@\006u\216\307\024\206\352\315\312\332\254F\343\321f\205\035\222P\303\032\213<\2325\362\034U`\215kQ\307\246\2055\256&X\030\262x\016\315\rq\206\021E\035\0204\027\370qgE\202`\217G$\210\226\225\206b2\257;3\260\231GM\006K\020W$\033bxC\234\341\246ee\217%Vd\220D\262\004F\022sl\262\233`\202\n\033`\240\002\021\32064;6\354P\207XD\256I\020I\344j\242\210\274\001a,\022K\200\260A&A\320\f\200\310\022o\202G\252\037\f][tOE\346\263\313k\3560\312s/jvM\032O\240\230&\\H\350\212>\nc6\025\345\210(\377\310F\370`p\re\255\f\205\312p\"Tu\243\270d"
+	.string	"\006u\251|Lv\344"
+	.string	"\312c(\240\004Z\265HN"
+	.string	"\243\244\020\323txaL\247\333\313\212'E\222\370\304\261\214\2510\342\323s\245\366\370\271\243B1\207\267\216\032e\3156\250dB+\302\204\"\f\372\221\366X\272\252\327\243\343n\2052\273\355\344e\321}\306^s/t\344\005J\351\020\353\363\001\250\256"
+	.string	"\261\265\304\343\363\336\236\352g\025\325U\264\212"
+	.ascii	"\325>WW\372\202(\215|V\253\\\264\013\366\340\366>\253\033~\362"
+	.ascii	"\362T\275\037\367\357\310\263h\212\253z}\323\274(\027\315\233"
+	.ascii	"ufQ\201Q\\\225\022E\205\322\242\006\223\024\0377\334jHzB\347"
+	.ascii	"j\035\235\n\205\312\352\247\\\375x=q\025\212\253w1l[@0\354\324"
+	.ascii	"\212\370\236O\324\2324Q\347\272\262|\264\366\\\234M\032<\234"
+	.ascii	"\270:Gv\366\f\373\254\312]\264\025\263\265M\343\254G\220\333"
+	.ascii	"\230\020$\356I\324\270\274"
+	.string	"\334\233\tB\313\234\273,\224\200\350\226\270\032\347*\334^\212\246\030Q`H\246d}V\337\256\230\2163\264=%7K\"3\334\316\357\330\224\314\035=\264\313P\221\271jF\246\2729nn\245\030B\025mLR\366\266\023\311CL\333\223X\340\232\253n\256\266]5\345\320\02065*\307\fi\217\317\376\201\346b\361|~V\213\250j11\330\374`\250\031\211Q\2321\224\3662\266\332\245\027%.M%\342WJQ;\"*\332rI\326\217\\\004\003!\220$\240\375\371\3141x\221\213\022\244\356\263Z&\323\023\304\325\260 \252\2300\212-\320lo;cxp\221\263\002\243\022+\362\344,C\362Y\005su\310\331\336\013/:\255\nq\365\313\310g\252\211\027Q\023\n3$\332c\304\270\270\324.\020\356\016\205o\2503\223\323\211T8\245\234\201J\251\231\221\021%\351\023\025@@PL,\034\256\253\236\017\023"
+	.string	"T\351\243\201\"\t\021C#3\"\222\244 \225R\273\001v\254\370\337\177\205a\314\364\300%\004M=\3349\"\030r\206\361\315\376\234{+y\307\261k\033F+\276\236\315\301k\323\304\213\231:\022\3158\212b\f\202W\023\370M\240\311z4s\210;\203R\277\377\374bZ\032\232\222A\212\367\002\365h\f\310I\262E\222\031\276\273\324\326\006\013A>\2104\212\366\203\344\257,\252\177\027P\017M>\310\305\206\3127\0326!L.\240\252\016\213\266\200E\251\027-\230)\005\377\250:i\333\254DZ\244\267\340["
+	.string	"4\0219\016\231$~m\2022\006\306;D\203P\226\342\277\246~\221\251\313\312B\323\031\021\207\247\341\336\023\035\330S\304\322\312\362qk\304\203\007\003p\036\357"
+	.string	"\3302\335\336$\345\311\247\232lc#\334\270\217"
+	.ascii	"\214\005\302\354\323\022\324bG\376\252O\276E)2B\360\270\017\276"
+	.ascii	">7Qw\020\330Y\212V\344J\357]\374\351\267\n\274\305q\rM$\226\272"
+	.ascii	"\036\360G\300\031\215\267\0302?f(\223\017\017\177\233\357\340"
+	.ascii	"\300\340\201\225v\3228\035"
+	.string	"\255\3067*]\325\030\006\246\016d\224\203;?\313\212\201\004M\324\304h\022\367wV5\"ex\337tZ\336\024\266d\271\323\\vT\230\020\204`\272\210\024v\361]%\372\313R\340>f\345\256\322D-\312\224\257 \033\367\351\205wR.4\321wnH\301+\314\025m\344y\367\236.\"\201\311x\017\002\354\244\b\361\255\255\n\2771\234\234\211J\274\266\026.\340C\t]^s\354\306\326u\216S\024\300\030F\027Tr\326\343\305\263\032;\310\221\203\027\007{\003;\006\242M\277&iB\035@\310\004\233\225\362$^`\265\234\0309\332\205\034\263w\356#\372z\026\221U\304\252`\263}\236\267\337v\332\013Qh\026\004\256l\177\221\035\237Q\257\255\034\020\360"
+	.string	"\302!\374v\252\022@^\026-\201\265r \253\003\244C\266\177)\217\320\273\302IKl\227\001`3G\306%\211r\232\37008J4\276u\202\366\277\2135\376De)\362\234\226\017\t\266 $+\314\022>\332\261gW{\337\201\321\375y\306\017\354\252U\253\320\277\322<\224\022\332\354R\016\331\262\224\032\320\261Y:\324R\344\002\024#q>,\365\240\212(,\373p5\370\231\001\004Rv\301\200\366w\2208\272\0200\0011\350nfR\316\220Q\"dB\213\032t\336\257fc\304\2750H\026\031\024\357\315\022Opn\337\032\r\260\234rO\205K.\025\370\036 \370\367Z\241\t\031KQ\372\342\235e?\215\375\201\240\337\212\204(\273\002g\202\243\224\261\267}\021\203\352K \025\222M4C\251\351\267y\350 \371\261\020\236\013\030\214`\327\216ZEI(9\366\365\003\335[V\300>\341\013T\030\225\363\353\366\302"
+	.string	"\254\013\303\336\033#Z\306\266L\324 \355E[Ie\240;m\347\270\006=sH\016Z\312\233\001\354v\024\341\261C\013C\243\313r\251\302\331A\277\243\223P\352\3210\241\261\316,\244\312\311!oOr\316\351\226\327\3505:\235Ay\340\305u1\344\276\037\263\f\274*iXm0\034J\202Cj\013\n\325lIE\t\265\363\266\233OI\240$nV\351zW\301\237\244\027\226\271@r\021\2146^[fI:\376>\361|\351\0161\304<\360\361e\t\025\0277\327\345_W\373\236\236X\031\365|j\312h\337\026\t{\315\272L\216\232\203\243a,\275\336i\207\213\206T\204\314\275\224\225\325\342\342XR\004\005\304ZNi\362\353-e\367\0247eN\333\347\342%\030\257\347\311]\256\031\251\367\313L\210wq\342\016\254F\224U\311\311\035\255\241"
+	.ascii	"\334\310~!,\250\2440\033jU\356\177\236\252^\356\273\265\231~"
+	.ascii	"5\027\255\306\331'\ts\310x\350\326n\251e\364\203^J^NX\250Z\356"
+	.ascii	"\214\242\030,\303\323I\233L\354ne\307\003\t\344\206\005\002\231"
+	.ascii	"\272E|\213.\341a\207\375\217N\036+O\250o#H}\262@\313\037+\342"
+	.ascii	"@\006\177\227\314\r2J\212T\037\021\355zo\\\334\220(\372\311\237"
+	.ascii	"\322\251R\034o\3314\200\367\023\024!\306A2\251,\371\3256\021"
+	.ascii	"\203\350\312\221\236\031\240u\214\315uF\244\030\013\372ab\016"
+	.ascii	"n\202\260Z\370\226uU\231\021Yn\350/A\273\230\210\021k"
+	.string	"5\330\022j%\2119G6J|=\327\341\205\345\341j\367v4\\\273\036\232\312\231i\021\272\034]s\235h\003\223I\250s\006>\222\203\314\253K\226\306S\344\332\306\200\242-\260\356\322\3612\306\344`\201\305\n\373<k\245\236\365\254\237\367c\354\220\007\276\333\177\356\322{\215\203\013|\246\375\037v\020xC\320\032}rb\006\r`\346y\230\201\205\310\341s\231C\217\212\275`\036\025s\3546D\3761\027\342.\003}\372\024\314\212c\320\022DX\375A<\021{\317\366\334~\245\352\2477\345\313L\334\034\333\321X\364=\257\377\037\371\035b\367\215\3106\202\001MxS\225\317Ow\300\214COS~\024\370\245\306\025\372\312 \267|\215\227\345\373gi\b\007K:j\367\003?\371\343\200!3\016\355\3634\252i\326{\324\273\370\272\032\275\331\254\ft\333\225\002L\207N\205E\372\244i=4\366FKO\026\227\216"
+	.string	"rmL\237`R\227\301\362\277\0060K\317\362\r\304N\344\245\201-\333\232\342\016\303w\366\250\200=\346\353\236\022O\210\256S\321\315\257g\023&\001\303\234\032\244\217 U\241\310fB\035C,'}\337\355\237\247\217\3229#\200\027\271\274\337\274\352\363\001\001\335(\256]\367i\r\347:\362/R\334\220x\201\024\233\226y}\244\325Yf\227;\\\"\346\026\005\304\344\212\340\243\310\362\347\265\023\215\247\334-X\3705\246\274-g&T!,\234\246Z\2345+\003+\013\254\324\371\354\364\221\317\274\206\r\334\211z\264\337o\327gWbe\270\007\312\261Il\365J\2114\005`\273\365\016\310\320\224\2448\007^}\030Z\267\246\351Vz\334k\255xp\230\237\214\037\257\324XT \006"
+	.ascii	"\025k=\306\r1-\034\371\346\307p\337\207\350\n\234\213\373\006"
+	.ascii	"\206\226\207\274]\232\327O\210u\344]#{\001\377`\210M\352\217"
+	.ascii	"\243\265\213\211\034\314\211f~1?\016L\314\350\333\346\300\353"
+	.ascii	"! \002t\261\352\002b\277q\f\341\266\305\204xFe\210\026P\177\004"
+	.ascii	"\034\337-\002\250f\fA\311Z\215 Q\017\341\317\013\271Q\003\346"
+	.ascii	"+\257`a\013\"\346\r\\A\343\257k\271lFF\225.@0\3501\372$p~\322"
+	.ascii	"n2\022\333\341\332\3555yQI\324\335\236W\n\200\352Y\237Pg\371"
+	.ascii	"\213\242\316 P\025v\b\372\002\336:\300{\177/\275&\"P\367C\024"
+	.ascii	"\314\013\252\236a<P\nr=\326>\365\277~?\314\364Uu\257\314\313"
+	.ascii	"&z64u\222\235\037\250\373u\300\036\354\024\003w\003a\222\271"
+	.ascii	"4V\013\223\227\031]\316\022\375\3279"
+	.string	"\"\006\254\274@\273\201x\255\267PY\230M\311`\006\201\201\371\327\324\177Q\203\336\271\244T\343\211\n>\017\307\227\312^\204\360f\207\201([j\207\332/\262N\332\367\215\210V\267\036\236\\\361j\336=\226oQ^\rP\265.1\035\224\264\006:\300\355\235\235\304\357\026\034\266\351\001\301\237\r\257\360\034\013-L\371?rvL\313<o\304l<\226\232\301\020~\325\372\264\"\356\004\344\330+\204&\200M\025\341\2112\340J\t|'\334:{\025\230f\302\tz\204\347\350\tTQxf\323\002h\375\334\037\3104\230\276\260\257\017\271\247:\007\271x\223v\307 gu\r|\2029\326\221\025c\bU\342\265\333i-\375\n\243.\035C\353\267\306\241L\255j9\360\316\243bNb\320ZN\377T;+o]\237\217+\273+I+\257\301)\032\346\221\f\261\373\251M\244\252\203\221\350\264\201\346\016u\177\\0\353\221\025"
+	.string	"_\342L]c\224\372\324)a\365\020A<C\305z\230\300\007@\370\007\233\n\303\f\204yUR\377\354\202/!\277\344\004\200\320?:\263\204\366TUs\ng\205,w_\257*eUL\026Vx\211\b/\376\314K\0258\177:dU\231\224\203\215\277\353\fU&\320\346%\304_hZM\030\026V\206\247\032~\025?F\315\374\245L9\212K:\017(\034f\236Q\340\223\260\321\232\"O\212\255\033\204-\317\305\276\350\231QNvY\360g\337"
+	.ascii	"\260\016\312\321\235.\270}@\377L\263\0316\376W\311\253\356a\344"
+	.ascii	"\236\036\217"
+	.string	"\234xi\302i\035[8\333cJ\362m\3701\243h\273\032\340\375\177h\277\232n4\033\270)\216\373\260\\Fd\374\256,m\241\267}o\007_7v\225\003>\240\303\361\317\207+w\237\302\2138\023\007\234\256\341\327\201\217\251{ \341_\376\236[\221\201{\346\301y\351\302\203\312\\z\272\341\231x\246#S\035A\341\024=\262-!GO\306\345\213\203\314ZQrO\324n\344\277\361\242r\300\214o\274\370\033\033\321\372\b\266\016cz\356F\336l5Ql\334 \343\204\354\2024{\235\213{~\313\017\306\032%\340"
+	.string	"\025s\271>\267O15\256\033/\260\377\346m2Y\370O\003\357\031\270\236"
+	.string	"\325\001\223\375\r\277>B\303\373\006\366\325w\310F\342^$?\005{\371\361c\27416/>\207\261\035\344\3506\357\331\035\217\205v'\315\233\367\300(,\267\221s\233\223\223o\351\034\342\316\371\213\034+\236v.\315\235\210a\030\374\345}\267\365\n\235\227\342\226v\337\230\326\217\205\213\231S\240\377\344\210\177`\247\327I(\267\345\033\256\037y\357r\rbz\207\336\bF\273\021\357\352)\3705\357\n\341x#\2148\373\034\033\261e\017y\313\363\345+\313\342L\230NO\373\273\371\216%\026Q\256\316W\f\214\356n?\304\377\355i\311\342h\227]\312\217\376^\264=\336\227\005o.\fH\327\331\251\374\222\331\215;\345\373\274a1\te\200\032\001\330\241\343"
+	.ascii	"\241G7K\f]\001"
+	.text
+	.section	.gnu.lto_.symtab.8743f7869c80780a,"e",@progbits
+	.string	"tcpTotalRxBytesWaiting"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\002"
+	.string	""
+	.string	"tcpTotalTxBytesFree"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\002"
+	.string	""
+	.string	"isTcpTransmitBufferEmpty"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\002"
+	.string	""
+	.string	"tcpRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\002"
+	.string	""
+	.string	"tcpIsStart"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\002"
+	.string	""
+	.string	"serTcpOpen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\002"
+	.string	""
+	.string	"tcpDataOut"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\002"
+	.string	""
+	.string	"tcpWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\002"
+	.string	""
+	.string	"tcpDataIn"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\002"
+	.string	""
+	.string	"stderr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\002"
+	.string	""
+	.string	"dyad_listenEx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\002"
+	.string	""
+	.string	"dyad_addListener"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\002"
+	.string	""
+	.string	"dyad_setNoDelay"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\002"
+	.string	""
+	.string	"dyad_newStream"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\002"
+	.string	""
+	.string	"__errno_location"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\002"
+	.string	""
+	.string	"pthread_mutex_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\002"
+	.string	""
+	.string	"dyad_setTimeout"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\002"
+	.string	""
+	.string	"pthread_mutex_unlock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\002"
+	.string	""
+	.string	"pthread_mutex_lock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\002"
+	.string	""
+	.string	"dyad_close"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\002"
+	.string	""
+	.string	"dyad_write"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.8743f7869c80780a,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
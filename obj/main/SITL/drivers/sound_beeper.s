@@ -0,0 +1,248 @@
+	.file	"sound_beeper.c"
+	.section	.gnu.lto_.profile.a02f1e8bf6a0bad9,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.a02f1e8bf6a0bad9,"e",@progbits
+	.string	"(\265/\375 )\r\001"
+	.string	"\310\035"
+	.string	"\004"
+	.string	"\354\301\314\336\005"
+	.string	"\001\274\205\242\255\006"
+	.string	"\002\003\240\342\234\212\n"
+	.string	"\002"
+	.ascii	"b\216\265\001,"
+	.text
+	.section	.gnu.lto_.ipa_sra.a02f1e8bf6a0bad9,"e",@progbits
+	.string	"(\265/\375 \037\335"
+	.string	""
+	.string	"\250\023"
+	.string	"\003"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\001\001"
+	.string	"\001\002\001"
+	.string	"\020"
+	.string	"\007\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.a02f1e8bf6a0bad9,"e",@progbits
+	.string	"(\265/\375 z\205\001"
+	.string	"\004\002n"
+	.string	"\003"
+	.string	""
+	.string	"\003\200\200\200\200\002d\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\201\200\200\200~"
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"\001\002"
+	.string	"\005"
+	.string	""
+	.ascii	")\034Ecs]n\342\261\2016"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a02f1e8bf6a0bad9,"e",@progbits
+	.string	"(\265/\375 \037\315"
+	.string	""
+	.string	"\210\023"
+	.string	"\003"
+	.string	"\001\001"
+	.string	""
+	.string	"\002"
+	.string	"\001\001"
+	.string	""
+	.string	"\002\001"
+	.string	"\002"
+	.string	"(\201o"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.pureconst.a02f1e8bf6a0bad9,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\200\004\001\200\004\002\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.a02f1e8bf6a0bad9,"e",@progbits
+	.string	"(\265/\375 $\235"
+	.string	""
+	.string	"H\030"
+	.string	"\002"
+	.string	"\001\002"
+	.string	"\002"
+	.string	"\003"
+	.ascii	".[\200\2547\200\005"
+	.text
+	.section	.gnu.lto_.lto.a02f1e8bf6a0bad9,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_systemBeep.8.a02f1e8bf6a0bad9,"e",@progbits
+	.string	"(\265/\375 \343M\006"
+	.string	"\242\013,2pM\322\030 L\251\340\214~\\\210\243\323\353\bS\307\035\207\245\250\233\226\252o7m\303TJ6<\376\177\356\2535\033\277\023\002C\001\335f\322\366\226)U\025\257\370<I\022b \204p\240\256\211\210=LB\nKR\357\262\036\"\336$\261'\031\0341P>\211\030\345\203\262U\307)\270p\030\237e\232\353x\275\254\343|\203T\bPv7ZX\266\344\031\371\370\025\372[{\205\205\251\235\212HSL:$\273\031\302\t\001\372<\377$\312\030\020\321\bY\331\335\347<tj\233\253\202\250\200f\223\321\006\320\260\2737\315\206Cw\372\037\374\f\277E\b"
+	.ascii	"3\003\316\231\301\341\313]\303\277!\264\222\032\027\356\306\242"
+	.ascii	"\235d"
+	.text
+	.section	.gnu.lto_systemBeepToggle.9.a02f1e8bf6a0bad9,"e",@progbits
+	.string	"(\265/\375 \303E\005"
+	.string	"\302I$+pm:\240{\267h\201\025\221}\327\341\247\216\035\303R\350\346\225\217\027\364\260\264\226\206T5\004c\344WF\342\237\013\020\351\275e\n\267\252:\2659\037\215+\223\320\215\267:'X\2758\303\034\020\266\352\306U\342T\233\225#\224V\246\302^\t\"(\262\362\207]\224\232\177\001\335\335\227\340\037\013\033C\250\033s2\265("
+	.string	"\352\374_\352\334O:X\b\243\313\247\324\335,9\313m\344\276\353\331\201\367u\033\005\214\356~\364\276\314^\356\177\305\377\305\377+\007"
+	.ascii	"3\003\316\231\001\340\313\3472\376e\334p9\026\355$\003"
+	.text
+	.section	.gnu.lto_beeperInit.10.a02f1e8bf6a0bad9,"e",@progbits
+	.string	"(\265/\375 \366\275\006"
+	.string	"\342\214/2pO\032\003"
+	.string	"\257Sw\224\305\210\237\033\356\372}\252\033<\r\\\204\310\204\036[\251\210\346\273i\311\264\376\377\035\304#\273\360e*\\\2307\232lR\246\024\024\324D%\247\250\223fFN\214\022\020\233\352BZ\320\232\021\203\232\033XQ\021\025p\232\026\324(Tr\342\204\026RN\230\311n\2075A\303m\264Y\247\271\220\326"
+	.string	"\377_\207\265\315\201xR\016^\376\216\230\320[\336\312H\246\255[k\022\227\\6\3110\301\217\261\250\374\031C\033$\277f6\210\374$\027D~\275Z\027\004\216\201\220\007\005\346?t\"\276\334\256\332'\026\370\200:n\001\017\377\333>\240\017\327\271\355B[\207\266\036\001\b"
+	.string	"2\003&j\006.\234\200y\227"
+	.ascii	"\232\325\224p\207\027\355$\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a02f1e8bf6a0bad9,"e",@progbits
+	.string	"(\265/\375 W\255\001"
+	.string	"\244\002S"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\b\177\002\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\t\177\003\n\177\004\005\002\005\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\200\036\340\207k\3151"
+	.text
+	.section	.gnu.lto_.refs.a02f1e8bf6a0bad9,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.a02f1e8bf6a0bad9,"e",@progbits
+	.string	"(\265/\375`\321\005m'"
+	.string	"*J`\020Fp\250\321p+\201hQ\233\316\372\322F\233\025\327\317\224\004\376\004\021\005"
+	.string	"G\346B\242'k\227\272M\231\b"
+	.string	"\303\277Cn\330"
+	.string	"\034\023\355\365\f;\310\365\213\b\317Jw\257[\225'P\355\232\362\237\215m\233l\231\002\335"
+	.string	"\362"
+	.string	"\363"
+	.ascii	"\350\333m\354\356s\330\317\373#(1\0313Y,AU7\326\217\241b\030"
+	.ascii	"1\037y\272_$$\244\002H8\256\026\303$(e0\034\206\233\rX\314\231"
+	.ascii	"\n\207\375V|\373E\217\360\301\022\206\246w\261\236\033\250\266"
+	.ascii	"\347\223\033\250\027\256\020\230HUY\200\372\021[\322\035h\206"
+	.ascii	"$A\323\213X\377a\275\206\225\253\260\025n\0261\026[Ke\b@\237"
+	.ascii	"'}\364\240\351-\254\b\250\264\322\007\254\347\"\225\237\\\244"
+	.ascii	"~]sL\244\242,@5b\"\365/\023\251+\013P\371\013e/\006;\177q\224"
+	.ascii	"GP:\316\330^\335/\177\245\335E\346\005\001\230\027"
+	.string	"\334\304h\025\303\324\364\350\212\376|\206\177\336b\373\371\312\377;\377\343\374?\373\317\346?\232\377^\377\325\377g\376\247\317\347\363\371\377\351g\337\177S\003\314\"\220\325\270L\272e\313d\316e\026\223\2561+\251S\"!\242\224af\246\204\351\270\306\266qT\026\2219\247\373.\033\255\233\2330\032\311\240[\271D\242\025y\360X\225\323F\225\226\342\222\337\3566p\254\n\262l\243\323\355ZvwU\231\350\343\204\366u\266\021v\266B\224]\003F\367\201cw\313\355\354\356\266\273\177\220\312\267\273G\316\335:\036\273\257\n\034[\331z\201\321\2156\341\214%]f\220%\317\213\025\346V\307x[\336j\264,\344\312l\247t\215\356f;\353V\022G\0354\3759\315\317R\370e46\267\306\262\233\335\257N\035sU\026\003M\313\336\002\2672\343\022.4=k\255\227\240\205\271\004\260ucA\331R\312\302b\354\274\252"
+	.string	"%\nOa2\376\302c\330Y\344\202\327\327Z\367\373\237\3130\0316\303g\270\311d\334\345<\306^\036\352\020\037\251)\232\004\355h\034g\355\356=[\351\0132\\D\324\316q\030\313\233\203O\232\320\330\232\225V\032\034\034\035\"=\302\224\2758\260\"keh\372\206\273\f\245uYy\203\270q\303g\353\253\340\315\r0'+\220\226F\361x\316g7\263\256$bhz\324j=\253a\347yM\223\3270\033\276j\233\232\226\033`y\372Jy$\244UG\312\020\2633\233\313\301u{uw\202\324\210\232\21644=\036\376\372\017\204\233a\005\006\253\315z\364W\273\210\354n\253\333\333\310*\234\3127\346\243\037"
+	.ascii	"\333\230A\367\213\324\272\177 \271\263ru)\372@\323\377F}'\335"
+	.ascii	"\255\256\337F\272\314\254\326\255b\226\324\275\r\204@3\205\264"
+	.ascii	"\373f%\323e\213\366\333\334\306\254\244\n\367]\"\335w\331\346"
+	.ascii	"\332\270l\273\337d\316m\026[v\231YI\227\271L\352\332\330m\007"
+	.ascii	"7\221\304\341i\003\210\035\221\365\t\241\210F\304^\004\t'\242"
+	.ascii	"\202(\234Xa\320\t\304\020\361\007\334\020\304\242\360\371\202"
+	.ascii	"O\2713\230bY\f)X\342\260\3050\350Q?!\013d}\353',=Xbb\361"
+	.string	"s\246&\bM\020\32435\361xMK\274\365K<\033\361&\222\250X\251\336\3167\205\340\301)V\270#\006\203\302\235\020\261\267\304[[D\001\331\025*Xa\t\240a\317\367+\001\f:Q\261\031t\304\336\217\017\352)\370\273I\261D!K\005\3340\374\005\021{LD\340o\305\317)Pp2\n\321A\303\032\225$d\247X\226DO\n\270\"8\334\r\205,\325O(\265\003\376\240R\354\242\204\303]\322\002\340\017J\230\001\310Ny\030\376\204P\004\203\030z\2679\347&\317\341;\251\361\355\244Z\305\311\016\254<\215$s\240\323r6AS\246\303u\270y\304v\316k<\345@\306\267\231\335\357\020\320\231\235\037M\260\365|\024[\250\201$\247\214E*\020\021\t&\030\t\222\024zp\002\221\261+z\021\320\2752\221Z\220B\233\001\017j\303`1\221\346\325\207\323\221=\275\251'\341\023A\325\021Nz\300F"
+	.string	"\314Yc_\311\247\300\220\231a\260\006D\351\020\020\303x\304\032pVnM7\016n\331\223\216\204}I\030P.\2016\215\225\027\036\271Lh\322\306\305X\316-\354\270\236\2621\274\242\266\211\242\374$-\244\036wr]@\036\217u\327`nU\351\201\270\245\007m7\ncK"
+	.ascii	"\252\224r\353\361\036\002U-A\337\354\3456\221MM\264<\350\017"
+	.ascii	"\222y\006bg$\201\361\364\267\336\302]A\315\326\302\370\266d\341"
+	.ascii	"\nd\233.<\342K!?$\314i\226\366Y\307&r\3157\005"
+	.text
+	.section	.gnu.lto_.symtab.a02f1e8bf6a0bad9,"e",@progbits
+	.string	"systemBeep"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343"
+	.string	""
+	.string	""
+	.string	"systemBeepToggle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346"
+	.string	""
+	.string	""
+	.string	"beeperInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355"
+	.string	""
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a02f1e8bf6a0bad9,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
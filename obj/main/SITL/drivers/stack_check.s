@@ -0,0 +1,243 @@
+	.file	"stack_check.c"
+	.section	.gnu.lto_.profile.cd18060941d43b80,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.cd18060941d43b80,"e",@progbits
+	.string	"(\265/\375 \"\325"
+	.string	""
+	.string	"\220\026"
+	.string	"\003"
+	.string	"\302\252\341\340\002"
+	.string	"\002\004\240\342\234\212\n"
+	.string	"\002"
+	.string	"*\343l"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.ipa_sra.cd18060941d43b80,"e",@progbits
+	.string	"(\265/\375 \024\205"
+	.string	""
+	.string	"P\b"
+	.string	"\002"
+	.string	""
+	.string	"\003\002"
+	.string	"\003"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.cd18060941d43b80,"e",@progbits
+	.string	"(\265/\375 VE\001"
+	.string	"\270J"
+	.string	"\002"
+	.string	""
+	.string	"\003\200\200\200\200\002d\001\201\200\200\200~"
+	.string	""
+	.string	"\006\002"
+	.string	"\006"
+	.string	"G9\354\f\260\031\356\315\3410\257\337"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.jmpfuncs.cd18060941d43b80,"e",@progbits
+	.string	"(\265/\375 \024\205"
+	.string	""
+	.string	"P\b"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.cd18060941d43b80,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\200\004\002\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.cd18060941d43b80,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.cd18060941d43b80,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_stackTotalSize.9.cd18060941d43b80,"e",@progbits
+	.string	"(\265/\375`\030"
+	.string	"u\007"
+	.string	"\322N44Pm\323\001\303H\032\020\240\246\210\022\360\2109\021\366\304\245d\213\030\362[$\246\331,\345o\336cm\354\344\310\314,;\265\236\261\350\223\020\325\272m{K\231R\236.\232\211J\230\0164\023fs\305\313\242\0342\026B\\\310`\024\342d]\3612\340\212\201\262\342\246\252\254X\351\366o\365c\265h\n\341k\352G\336\201\021\200v\265o>\307\273\006\337\342\320\017X~;\3641\351\360z\317\211\226#\273\353\244R\330\177\253\037\333\351\314\364\237$\022\021 \331\215\030\2116\004\202\\\330\346\330\025?t\r\216\263\327\2018\311#\344\3710\331\355\242\345\001\322\341;\200t\250\025\317\236\231\377\215\277\214\211\222\215\353<)\006\273\353\3348\211[o\273\300v\264\215\021\t"
+	.ascii	"\023\013\275\263\030]\b\351P\345\342\232x\034\221\263\020y\270"
+	.ascii	"+\246v\222\001"
+	.text
+	.section	.gnu.lto_stackHighMem.10.cd18060941d43b80,"e",@progbits
+	.string	"(\265/\375`\030"
+	.string	"u\007"
+	.string	"\022\01754Pm\323\001'\243*\310e\203e\txD\301F|\264\274\242h\f\371-\022\323l\226\3627\357\2616vrdf\226\235Z\317XtU\210\312\206%{K\231R\2362\234\211J\230\0168\223\246s\305\313\242\0346\026B\\\330h\024\342d]13\340\212\201\262b\247\252\254x\351\366o5d\305h\n\341k\352Q\376\201\021\210v\265o\276\307\273\006\377\342\320\017X~;\3641\351\360z\320\212\226#\273\373\244V\330\177\273\273\326\220\355tf\372\3172q\"0\262\0331RY\023H\202a\333c_\374\215sx\234\275N\304I \"\240\220\224\335.b\036 \035\276\003H\207j\361\354\231\371\357\370\323\240(\331\270\317\323b\260\273\316\215\223\270\365\266\013lG\333\031\001\b"
+	.ascii	"\023\013\275\263\030]\b\351P\3452\327\350,D\036\356\212\251\235"
+	.ascii	"d"
+	.text
+	.section	.gnu.lto_.symbol_nodes.cd18060941d43b80,"e",@progbits
+	.string	"(\265/\375 M\335\001"
+	.string	"\004\003I"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\t\177"
+	.string	"\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\005\013\001 \n\177\002\f\003\005\002\004\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	" \300\340G\204\245\236"
+	.text
+	.section	.gnu.lto_.refs.cd18060941d43b80,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\002\001\001"
+	.string	"\001\002\002\003\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.cd18060941d43b80,"e",@progbits
+	.string	"(\265/\375`\205\003\215\033"
+	.string	"\226\366\275I\260\326m\341\264\005\326\3776w\264\277\212V\2711f\374\013\302B\005\352\177\346}\265V\313\377\232\240\343\217\201\321M\004?%\r\343<X\375\315\217x\335\366\233w\fv\312!\305\nt5\327\356\212\241\344\254\031\022\202\224l\223)\231"
+	.string	"\236"
+	.string	"\260"
+	.ascii	"<\242\237\013~\245\364\274*\221\326\207\373\035\341ze\272\352"
+	.ascii	"\177\004:\334R\372\334\317\244\221\3764p?\277\r\251\376\376b"
+	.ascii	"\177d\013\245\033\021\375\t\256\376\272\237\334\377\376\223\377"
+	.ascii	"YN%\365O\341b2\351"
+	.string	"t\177\322\001\335\225H!D\177\213\327\304\207\232\353RJ#djez\221J\256i\224\236\351W\273S\\I\250\033\375\337(\"\023\212\002J\013\364Q\255\260\r\204\210\355\r\253\355\320^\235\355*\333>\333T\266{\266\247l\257\330Fb\333\225\225\225\225e\233\203\355'\266\213A\006Bp\013\204\346 zc\302\327\306\204\336a \253\377\3068\242\033\210n\331\341\313\363\377\211\025\365'\256\305\273\262\033c\017X\327.\260\r\336\365RO6I\021g\004)U\264@\333/\267\355\375\360\227\350\325\2370X\211u\207\376QH_[\034\366u\367\347\322\267\312\253G]\236\333\241\242Z>1\325\364\204]-\317\347Rr\277;M^I\302\314uG\302Lu\207>wr\315\\\324\315\\\212\302\232\324\335i\256%\352b\256;\224\251\207U\022\0303\367#\235Ry\272\374L5\375\325\277\001F\034\300b\374l@\371|\274"
+	.string	"V(\325\216\033TT;%\376'\325\233\by\360\212\216\354\223i.i\201^\030\242\275\274\247\345m\017$\243nB\307G\321\021\254?\311\301+\005\226\013\034-p\177,\020oo}\270\346\306.2\352N=\233\364/\267\367\252\362\227\257]\230]\030\020\307\222\214\037!\350u!z\221Do\216u\362\352xZ\035;\2653\307)a!\223\204J\217\031XOR\212y\371\212\300@\247x\247\354\232\233\225j\371\235\376+p5\261\361\223\321\002W]\250}\212\331(/\217]\r \247~\375\325\027"
+	.string	"&QV\360Z\340\313\006\376\221\261\220\241\002O\3546\372\330zn@\263\232\207\235\321V\333\t\032oC#x^\243\214%h\274\360\343C\243\320b\353\371\231\2012\036\231\020\355\202\354e\030\327>\214\266\330\255V\263\305\004\334d5\020nB4\020\242#D\330y\321\200a\2028\223\001\232\215?3Yl\3106\206\240\331:\304\204h=A\261\231m(&\3632\222\240\361x\350\271\3252"
+	.ascii	"\315znC\004<\243\331F\241\321G\264\r\316\003\234\034\021,\316"
+	.ascii	"\321\231\321\231\t\235\243CC\243\203C#\032\207\306U\304\336!"
+	.ascii	"Kd{.\336\257\302$\324P\341\244\005Z]\003\241\270\005\252\274"
+	.ascii	"O[\265R`N=\032J5\035Ua\375\f0 `\002\021BW\036W\346y\202\227\324"
+	.ascii	"\220\211\024\355\270\370\001\277\020~\244T\f\341_\357/\026\032"
+	.ascii	"k\255\2236f\345\353r\214Od\273\312-\206'8\340\026F\244r\341\323"
+	.ascii	"\003\220i\3615\214\360\220D\t\tD1%f\301\326/\314\3332\231\205"
+	.ascii	"BM\030\003\035\323\020a>e \3254\306=T^\262\003\273\227\336\334"
+	.ascii	"\274q\355\257\300\261\243\030\215z\351t\016\327@\001"
+	.text
+	.section	.gnu.lto_.symtab.cd18060941d43b80,"e",@progbits
+	.string	"stackTotalSize"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306"
+	.string	""
+	.string	""
+	.string	"stackHighMem"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316"
+	.string	""
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322"
+	.string	""
+	.string	""
+	.string	"_Min_Stack_Size"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314"
+	.string	""
+	.string	""
+	.string	"_estack"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.cd18060941d43b80,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,2012 @@
+	.file	"config.c"
+	.section	.gnu.lto_.profile.a9ff12e8bd163b9c,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.a9ff12e8bd163b9c,"e",@progbits
+	.string	"(\265/\375`\t\001\315\t"
+	.string	"\264\016\375\001"
+	.string	"%"
+	.string	"\321\211\300\200\002\002\002"
+	.string	"\002\001\001\240\342\234\212\n\002\350\223\272\372\005\003\347\305\362\361\b\002\002\002\002\003\005\331\333\320\201\003\004\002\004\002\004\006\b\200\300\367\235\004\n\002\002\005\013\307\360\226\245\016,\002\002\002\006"
+	.string	"\007\b\002\006\002\t\002\n"
+	.string	"\002\003\002\013\002\f\002\007\016\273\203\325\342\t\017\251\336\274\226\r<\002"
+	.string	"\002\r\002"
+	.string	"\002\016\002\017\002\016"
+	.string	"\002\020\001\002\002\021\022\022\002\022\025\340\342\243\321\016"
+	.string	"\026\304\225\207\302\002"
+	.string	"\027\247\315\337\324\004\030\336\310\256\264\f"
+	.string	"\031\335\350\233\312\r"
+	.string	"\032\316\323\201\371\t\033\354\301\314\336\005"
+	.string	"\034\035\036\274\205\242\255\006"
+	.string	"\037\222\252\354\340\007"
+	.string	" !\"#\277\343\372\273\r$\263\353\216\243\006%\240\342\234\212\n&\252\360\373\344\016'\331\223\337\236\016()*+,-./\240\342\234\212\n"
+	.ascii	"% \300\2022\253\016D\274\323\230\"\334%\215]\210\314\220\310"
+	.ascii	"\270\336\250\030B\035\034\260\205-Y4\377\314\026\3608\270\227"
+	.ascii	"\231\211\200\371\267<\274\313\334o\273\311\326\336\261\201\005"
+	.ascii	"^\261q\227\226]\237\346\001J\030\347\323\224-@\032\326\260\033"
+	.text
+	.section	.gnu.lto_.ipa_sra.a9ff12e8bd163b9c,"e",@progbits
+	.string	"(\265/\375 \357\205\003"
+	.string	"t\003\343"
+	.string	"\025"
+	.string	""
+	.string	"\003\002"
+	.string	"\003\003"
+	.string	"\003\005"
+	.string	"\001\b\013"
+	.string	"\001\017"
+	.string	""
+	.string	"\001\025\026\027\030"
+	.string	"\031"
+	.string	"\001\032\033\001\001\034\035\036"
+	.string	"\001\037"
+	.string	"\003 !"
+	.string	"\003\"\001"
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	"\031"
+	.string	"7\207\201qUfX\342dF\230*\214\232\213\240\031,cy\f\346\023\241\004HU\007\002\347\210\255\354"
+	.ascii	"y-\215s\261\375\364\354\252\301\201\033\212\2619\3737\200\005"
+	.text
+	.section	.gnu.lto_.inline.a9ff12e8bd163b9c,"e",@progbits
+	.string	"(\265/\375`\025\004U\n"
+	.string	"RK)1@O\223\016C\352\360v\276\214z\201i\013"
+	.string	"_h\202\\k\220\005\225t\265\034}q\356\270\3231\f\303*A\373\214+c\254\332Z{\267\266\367N\001;40,($ \344\007O\376\002x_3\310\216\266\323\005gP\004\243\323\"}\341\264\255&\230\370\201,S*.>"
+	.string	"\276\220\"=@X:\307!\201\034\213\215\222\313\260\002\266R\023}\206(+&\233\323\340g\226*\233\020\215O\2560\3551\r\002G\332R\021I\322\366\262D\335}\177\205\330\223\311\326V\032J\304\021\213\376\001\021\377\260l\333\347\257\241)E\250\321E\"\221@\301d\332\f\220\242\251\252\342\001\022"
+	.string	"\203D\bR\f\2032B(\200\306\b\215`\231\211\313\271\326\240(XHP\200\034\241\005\320vY\340\214\202\237k\025\337\365\266vxT]\355=+_\267\200\267\213<\263\334N\232\004g\003\335\306q_\261\252\3717\345f\220|\203\322\260\226I*\313\210`\245\0309k!\354\330\255\355:7!\273\367.\3527\353\337\323\251\333\242\347\340\223R\230\006\263s\022\224\247"
+	.ascii	"F\217\024b\363\265\357^\326\251o\3306\341\320\342\350\233I\233"
+	.ascii	"\374F\336\250\243\202\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a9ff12e8bd163b9c,"e",@progbits
+	.string	"(\265/\375`\317\002\365\n"
+	.ascii	"\302L)-\200K\322\030s\221\254@\213\337\036\307\177\270\210\036"
+	.ascii	"\242\266p\336\210\233\201\376\375\036$\023E\314\202\021\f\262"
+	.ascii	"e,\343\266\221\270M\310\226)\005F\247\317\240\013\321\244\n\232"
+	.ascii	"\020I\023\204\350\364\017\326\022{\211\335kr\324z\003\207)Q\001"
+	.ascii	"\201?\2607g2+\302*\034\315\007\307!\017r\2714\314G\263\254\261"
+	.ascii	"T\230=\2767^c\3129\016\004\275D2M6\333UUU\r\301\004\002\224:"
+	.ascii	"\352\n\373\n\273\2458\247\335\030gD\370\205\022\023\267\305\017"
+	.ascii	"\300\216\260\237u\2726\033H\335i\333\360\235>\272\364\324\001"
+	.ascii	"WGZ\250\261\311T\222\244\036\031\306\200\002\031\253*\017\021"
+	.ascii	"\300$\350(\241+&I6\366\f'S\314\353\374Q\352\322\267\273N\347"
+	.ascii	"\272\020M\223\303\254\227\236U\247\032\002f\231\bV\np\305\013"
+	.ascii	"\356\301\324H\225\342p\375\325\264\246\216A\031\344\037\251\241"
+	.ascii	"\006\202\343,\3101\255\231#\302H\344\332\"\330\034\213\321-Z"
+	.ascii	"\212\217\030\274\203\214y\271SF<\230\357\"Ri\257S\262\216\235"
+	.ascii	"\255^\243G\036\300\2106Q6\331Qq\034\0369-rd,J\275lhN\216\021"
+	.ascii	"P\005\346\007\235)\344\314\202\023J\237K\222\324\261$\007\262"
+	.ascii	"A\264\032I\217AJ\271|\032\372\005\2447\350X\316"
+	.text
+	.section	.gnu.lto_.pureconst.a9ff12e8bd163b9c,"e",@progbits
+	.string	"(\265/\375 D\345\001"
+	.string	"B\004\016\026\220+\035\232&#333\233i\377\377\377\377\377`\355\274i|\007S\232\321\204\3463\235\331Lf.W\271\311E\356q\215\273\256\212)\342\016W\370\202\017\370l\231\331\024"
+	.text
+	.section	.gnu.lto_.ipa_modref.a9ff12e8bd163b9c,"e",@progbits
+	.string	"(\265/\375`}"
+	.string	"\305\004"
+	.ascii	"\222E\021\030pM\013\007\374\377\377\377\037\252\320$\r\\v;+\230"
+	.ascii	"\356\363q'\231\002.E%\037\222\341Ba\002\341A\227E\262\213,(@"
+	.ascii	"\236\313\350\326.\355\036Oe\347\030@h\374\340<\317k@=\223\031"
+	.ascii	"=\rn\022( \340\002\221\273\016\266\330\3676\263\335\314\274\331"
+	.ascii	"v\303\036\226\300\340\232:\364\206\224@\001\307\205L\006\271"
+	.ascii	"\350,\322\002|\271\353\027a`\300\343\2541\266dY66\265\370\022"
+	.ascii	"s\210\203g\370\212\355\226y\307u\207X\033\034\312\030\330\031"
+	.ascii	"wh\005p\003"
+	.text
+	.section	.gnu.lto_.lto.a9ff12e8bd163b9c,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_pilotConfig_Registry.119.a9ff12e8bd163b9c,"e",@progbits
+	.string	"(\265/\375 \221=\004"
+	.string	"\224\007`"
+	.string	""
+	.string	""
+	.string	"%"
+	.string	"\005\001\212\001\206\200\200\374\342\203\314\221\025\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\336\006us\350\366\005uq"
+	.string	"\005\001\006'\001\021/?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\027./src/main/fc/config.c"
+	.string	"\004"
+	.ascii	")\"\301$\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_systemConfig_Registry.125.a9ff12e8bd163b9c,"e",@progbits
+	.string	"(\265/\375 \223E\004"
+	.string	"\244\007b"
+	.string	""
+	.string	""
+	.string	"%"
+	.string	"\005\001\212\001\206\200\200\374\342\203\317\301\027\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\347\006us\377\005uq"
+	.string	"\005\001\006'\001\016\222\340"
+	.string	"?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\027./src/main/fc/config.c"
+	.string	"\004"
+	.ascii	")\302\303,\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_systemConfig.127.a9ff12e8bd163b9c,"e",@progbits
+	.string	"(\265/\375 K5\002"
+	.string	"\264\0038"
+	.string	""
+	.string	""
+	.string	"\007"
+	.string	"\005\001'\002\206\b\177\005\001\006\035\001"
+	.string	"\005\001?\202\210\200\300\001}{\274\001y\274\001w\274\001u\276\001s\274\001q\275\001o\274\001m\273\001"
+	.string	"\005SITL"
+	.string	"\003"
+	.ascii	"@\204\224\373\007P\004"
+	.text
+	.section	.gnu.lto_getCurrentPidProfileIndex.128.a9ff12e8bd163b9c,"e",@progbits
+	.string	"(\265/\375 \357\265\006"
+	.string	"\222\f/5@o\222\016\230\355\b\2136\002\007\002\334(F\034\247@\315$\234\345-\027r\033\233=\353h9-\360\202*LQ\024\327\n\034\336\024\243\202\026\230ak\355\223-SW\233\206\016\307cU\257\342<Og\301\341U\327\347m\004\266\036\030\256\007aY\327\323lY]iG\2209\321\377\351H\004@fE\302\025\251I\342~\224z\002\204\325J]\020\246\024\272"
+	.string	"S\206\247\337D\3508\276\227t\245\037G\227\321@\031H\311\034\235Z\362\2042\001\371C\257\371"
+	.string	"!4\326\315c\204\331(\261 a\311\334\236\353(V\304nCzQ\311X\321H\024\305\214Bf\216\032\351\242\273\376\006\177\301\217\021\b"
+	.string	"\002\013\330\210!\005\205"
+	.ascii	"]\303\377\"\306\022\"\207;gj\347\023"
+	.text
+	.section	.gnu.lto_getCurrentControlRateProfileIndex.130.a9ff12e8bd163b9c,"e",@progbits
+	.string	"(\265/\375 \357\245\006"
+	.string	"\322\f/4Pm\222\016$\2439\ba<\250\254\265\260\bJ\371\303\324\\\375\373V\226\033\332\355h\243\025L\305\027\217%23\3472+o%\214\022\004^fk\202\310\226)O\032\007\316\246CMo\332\274\016\207\341\341MU\304\323\fLA4TO\202\242\252\227\311\2566\322\255\340j\240\177\242\"V@f*\334\220\226(\256G\335\025\036,Vw=\227:l\002\245\013[>\003a\333\370\002df\336H?\216\rc\222BP\222\031jaI\024G\362\361\177>3B\302g\253YG\350\242\241r1\262\222\231\275\306Q\253h\335\202\324\2152N0\221E\021\263\220\231#&\032\365\326\377\3407\3701\002\007"
+	.string	"\002\013\330\210!\005\205"
+	.ascii	"\357\232\267\204 \341\316\231\332\371\004"
+	.text
+	.section	.gnu.lto_getCurrentMinthrottle.131.a9ff12e8bd163b9c,"e",@progbits
+	.string	"(\265/\375 \375\365\006"
+	.string	"r\r14Po\322\001 \2173Z@3\314a>\020\241\001\"J\317r\274\243\265\037\371\250\365X\021V`\253\016\235\250\252j$)}C\t\030\343;xk\367&R\246\024\206\233\206\016\307C\301\0079\317\323Ypx\260\372\274\r\201\251\007\206\352APT\3654\361\272\222\254\006\227\212l\177n\022\221\331\255H\360K\036%\374\2177O\200\362\330\233\017ro\251"
+	.string	"$Wfv\024\245n\330\237VI\266\323\251\230\022KA\266{\221\275\354JS\001\261\035\2625~\310EB\2662z`\270\223\026\013\024\227\335\370\002>\340\336\362\002\356M;n=-\377#\237J\032)\330\210\342\211Q\330]'6\312\270\365\266\021l\037\330\346\b\b"
+	.string	"\002\013\330\210!\005\205"
+	.ascii	"]\303o#F\026\"\017w\305\324N2"
+	.text
+	.section	.gnu.lto_resetConfigs.132.a9ff12e8bd163b9c,"e",@progbits
+	.string	"(\265/\375`{"
+	.string	"\335\t"
+	.string	"f\222B9@\255\322\001\240\375\037N\376\370\210\232\255\205\232\016\007>WbH\317\230@\240\216|\273{zG\353AF\225\rAx\335L\f\317G\240\r\321\330x\2609\024\215d\223\275S\n."
+	.string	"3"
+	.string	"2"
+	.string	"\324\026\331\336\351=\217l\332_\252=\314f1\202\262\273ur|t9\362\337z\200x\"]\002(\354\256\245x\302\270\347m\023\330.\260o\020$\032K\243$o\346\244=A!/Z\312RF\323$\331/\223\234\033\366\271\235)\273\253x\234Xj\273\0277\333\216\324\244\303\366}\220\273D\3770C\314{3\314\007\312\213`\027\273L\343\257\274\341p\272S\tTM\314\360\303\356.w\016\013-\252\335M\360C.\002\341\257N\r\n\311\213\247~\250;\275\353\b\001\376.\232M\306\023~\365\313T\317\006\323\251\337\007T/\003\016\037\300O\215\b\303O\365^\245s;S^`\215\245i\262\200<\270\335\340\320ze\206\032+^\002\236\344\001\022"
+	.string	"2\241Wh`\270X6g\026oc\017\253\2330:%0\315\200\254\312[\262\262\3065\261;D\006*\240SA_\256"
+	.ascii	"\227n\321\316'"
+	.text
+	.section	.gnu.lto_activateConfig.133.a9ff12e8bd163b9c,"e",@progbits
+	.string	"(\265/\375`P\001\335\f"
+	.string	"\346VRB\020Q\234\016p~\006\317H\025\347\201`;\227\377\364d+"
+	.string	")\3469\252\370\035L\207\211\315Z'\th{N\362\b`\262\376\263\376\333\222\372M\250"
+	.string	"\340}\275\343\342Duz\327\321P\214\330\233H\231R="
+	.string	":"
+	.string	"C"
+	.string	"W\353\325\027\311<\324\b0\316\311adMQ\306(a\373\231;\033\307C\022\363\247\020\241S\2169\247\266#\336];\377&\016\002\212\274\253\007\2019\247\025\024u\270\367\266Ol\003\260\317\n\336P(\001\255g\337\364p\203_2\207\323\203\227>\207]~5\265\002\361\351h\201\222\302\324\316\240A\017Z[\240\304\317zv\370\321\025a\377\232K\262W\215\251Z^}]\275\001r\263\0246t\240\370t\304\264H\324\207\221\340.\376B\201_\272\364\002\006\224\373\006vi7p\300\022A\353=\330Q\321km\b,\256U\032\243];\302\212]U\255*\252ko\031\025\272\252\032\205\350\327\001\336,\0236\232\016\267i\233F\353l$p\264\315sA\263\214\230\253\220\361h\0308\316\243e\341\367k.\t\363A\374\366c\023\305\326\356Nt&\271\330\n\b\265\354\002\237a\340cN\320"
+	.ascii	"\037u\031\007\020\\.\330e\" \300\002\0312\242\007#B\003H\340"
+	.ascii	"\325{\227\teJ\017+\300\300\034N\325\356\220\031h\270n}\222\211"
+	.ascii	"\337v\2521\243P\336\032\371\302\265L\221\031~\264Q\207x\263\256"
+	.ascii	"m\336y\375\311%\035^\320\230\t9\304h\341k0\350\314\213V\220\001"
+	.text
+	.section	.gnu.lto_validateAndFixConfig.134.a9ff12e8bd163b9c,"e",@progbits
+	.string	"(\265/\375`{\021\rH"
+	.string	"\212r\224\031@@dR\007\027\006\022\323$\202\325W\034\003\305\025G\3077,t49G\360S\225P?\221\344cm\034\031~\335b\260hB\213J\324\261=\203WU\3029\336\n\241\232\250\366\204\354\275\267L)\005\201\001k\001\222\001\325F\231\312\276is:\367\250\177\267w\273\264\275N\215\257y\235\016\f\031&\315\313/1T\270\277\234\235\016\202\3166\225\350M\355\324\321t\017{\207\237\351\nH\020\271\031\237\353\326\341\322f\315\254\350\350\035\335Cg\273\207K\033[\211\363\327>\\\332R\320\264'\334\352r=l\207\363\270\327\243?\202Kgp\r\024O_\316R\005\316v\201\240\263H?\266\316\256\336\324:\333o7!\227\246e\027j'd\356/\347\234\205\257\370\353\b\016\030(@`\200\200"
+	.string	""
+	.string	"\220XWVUTSRQPOG\247&\246%%cR\2218D\022\006\335\226]\361\277\355.\006asl\351\b\352\370\201:t\336"
+	.string	"\033/\300\346\356\t\330\371"
+	.string	"\273\272\027@\347\001\350\326<"
+	.string	"5\216T\223\346\261\344\374*\372Vq_\005\367Tz\3161?\325\305)\247\347\024\363Ro\036\265&\350s\243\310\365\234o\3531\t[3\314C\265\371S\033\333\037\333\264\274\323\2327\255ey\2465\301\023\317\022\327s\256\255\307=U\004a\371%5WR\223K{#\232'\241\315=\277x\346\3043\263\037Fq\244("
+	.string	"\2728\241\274\020"
+	.ascii	"\025\2622\017vq>yW\310\267M\234]\027\374q\203\322TV\367g8\006"
+	.ascii	"\344\327\244\261 \3031\346c=g\331\212\3149\273\234\177\2211\261"
+	.ascii	"\177\027C\316\271\2779F\346\235\300\273\261\333\3358\272\223"
+	.ascii	"\376\002n\350}\353w\314\033\367\336|\343Zg]\314\3725\002\304"
+	.ascii	"\302\250A\202\206o\022\375\2654\347\034l\361\353M\371\230\037"
+	.ascii	"(\347\201\264\334\314\036_\006\ti\200|O\303\312\301C\353M\017"
+	.ascii	"\255\263-v3|.\206\322q\026\204\373\321\302\352c\342\310\207\305"
+	.ascii	"\256^\242\267\026\312\267Z\352\326\200==[N\244<\341\020\025p"
+	.ascii	"+\253c1\264\335F\273\342\0174\345\023\341xF\\\270c\002\202\235"
+	.ascii	"\025_"
+	.string	"P\363\234s^1\264\265Z\214\277\246\201\272I\370\034-\254\264\234\231\021\236.\307\304q/g\346\2048\216\207bU\261\242]\321:\213\261\253W\b\3201\206\366\373\201\3661\214i\036\346\007\266\261Z\255\362\371\201\326\001~\374@\313\242 O\261\257\266c\007\370\355\204<j\026\336f+\230s\216\320~\347l\\\264\2579\333/\270\336\233\\\255\263\216\223M\372\236q\321\260\257vK\305\036C\273\035W\253\325jc+\335\303o\013\036\365vP\374F\026\277\261\212\337W\305o\253\342wU\361\233\252\370=U\374\226*~G\025\277\241\210\337O\304\357#\361\333\211\370\335D\374f\"~/\271\337J\304o#\361;i\370]D\372&\272\337C\367\033\t\351[\350~\007\335o\327\375n\335oV\370\275\272\3378\370\375\356\267\267`\320\350i\006\275\303\200\2449I\213\274\316\335\310\335\035*\020\274L\013\354k\023\345\204\233"
+	.ascii	"?\f\030'LA\311\350\277\270\275\0270\245#e\365\275\251\254\266"
+	.ascii	"\3166aW\f\0170z\341\273_\261\027\310\337\271\241\212\341%\024"
+	.ascii	"\206\266\275h\004\330^!"
+	.string	"\316j)\212\335=a*\023&v!\362X\336#\236\247\366*q9iL\330\363\324\216J8\312\354\220\023\206\356A_\264\253\275\234\263\225*us\200$\331\322\204\241\355\002\362\367H\273\204\211l\323\274\"?\345=\"e\t\273\034\265\250\2635\237T\246\325\265Z%\f#\311\237i]\275co\366*\201\332\203\362Q^&N\336\262\262\326Y%\354N\353\336\2260\264_\264\326\211U\332\320\355\314\037\"%#N\3020\246z\230\037\030\345\231\030\261\317\361E\317^\311\213\366d1\336)\301\265d\353l\022\026F\235X\214\331\226g\334\023\243\005\334\177\344\221$\333\327\372\255\362B\241sn\200\013\241)\2405~ah\276Hr\265Kk\312\370\346{e\3653\301\331\376!O\344U\313\362j\321\322:k\001;\032/\341\345\354\217\213\2205M\222\266\332!\3669_\222*\332s\210O\336\020\023\201<s\210\205J\314"
+	.string	"\0261t\221\177\330/\303\252\177\210\210Z-R\233?r\204\204Y\277\352[\324\300\013q\367\353\366~yo6\222\211\227\035\304B\314 \0200\210\207d\217\336\206\030\272\325*\332\312\211\212T\034\205A\204\304\272V\353\276`\334O+\350}\001M\243A\215\027\311\257.\260,\257$\215\0061\2228\262r\320\230\221\254\021\005\226\243\206\216\0272\2726\304\250\341\365!G\215\027\306\256\030^#\276\272x$m\b\233\253\301\214\244\214\033^\\Y\\2\262n$_\330\310\342\372\002\313j"
+	.string	"\325^8\272\276\262rxy}e\r\245a\276fl\245ST\251aX,\373\331A\346\2477l\374I\214\347.JOd\301\3005\373\235\3613\347__\236&2:\246@\352\321\t\002\025\357d\036\2202\017S\355\371\003G\211\367\006\357"
+	.string	"\022{\031,S\016\3619\361^\346\371(\363\376\350\346\221\330\033\\\316a{^OY\347\2162/O\251G\271\347\275\211\304I&N\300>\003-}\245\177}L\274\\f\274\002Xg\260\260\361\r\201%\227\001WtW\330\370\024\220\245D\312\002X\331Yac\023"
+	.string	"JK\351\020>D6c\310*\f\343\325x\025NzDe\342\345\2125\342\337\316\273\225\200\224|I\177\324\317qJ\256\250\260\f\245\2343\025\036\202Y[\"P\246XMa'\266\234\2470\322\031frc\342V%\205\213\204\202R\270u\364\022\250\205\334\250\036\215Ga,\306\243\260\037\222\302\304K\237\362\256\026\n\303\230\006\n\361-\315\256\034\324v+\013)\r\2757\241\260\313\271\037\271[DeJ\201\2559S\271\320W\346\253\375\204\247e"
+	.string	"\237"
+	.ascii	"\217X\356E\303\212\262\211\232~^\367\242\005\217\330xh\316[\207"
+	.ascii	"_\231x\343\265n\347u\312\352\323^\263[\231H\031"
+	.string	"\201k\250q4e\031C4\"\242\240 )H!\035\241\005\204\030\005%4\017\021\340$c\216\251\222!i\n\355\006\316F\374W\345O<\347\036\315\202\323\212A\r\200+\302\325|\341\244\004N\025\n\016/\331\b\037l\022*O\357\r\022pRG\376\256\t\276Z\274\307i\2116\031\244~\277\304\273^I:\230FsQA\301\247G>\227C\362\210\035rlD1P\353\276@Y\323g\350\270\267\350\314\243J\344\004\311\037\254\217\316 \222s{\211}\2314uF\375r\213\362\020\025\225\343\226\324ms\265\343h\327\335\024\211`Qj\2579\020\340\\7<Q\363F)\264x\301\020\024s2\3040\343\252\246l\201\315d(\245w\353k\265\033\027\233BV\235\265\005J\342!\360\224E\020\224\224K\277k~-\360G$\306\365\235\277\373:\303c\343\305\353\307Q\267\016\320<\026\311e\346\202\2647\276\224\203E\021\312"
+	.ascii	"y\200\310\344\031\004Oz\333\020p\257\216u\231T\223\026\356\013"
+	.ascii	"\346\2708\301\343\314\242Gz\217\254\207\\\364\354\013\272r\340"
+	.ascii	"\224\006B\206\245\360\021H\262^\374\267\013\332\355\223\303\253"
+	.ascii	"\236a\321\355\326\314\204\247\177\003A\303sF\210\txgv)z#\367"
+	.ascii	"\277\356\305\366\0207\321J\222\355\021q"
+	.string	"\357\2176X\341\253\006\t\333\224.<LW\020\026\027\260\020I\251@$j\371\311\257\255\306\203\353\253\355\352\\\221r>\311\0347\272\034m\226\202\fu\230@\351\305\277z\212\224\204.8r\271-saz\353\262![h\177\271>W\370X\345\232k!\215\205F\370\312\302\230\320\0359\221\222"
+	.ascii	"\360p\264\b\r\340\340\020\362\244T\n\255\254\261\r\321\312{\206"
+	.ascii	"\027\226{6\340\b\bv\374\241U2\"\275i\317\257\202tk\365\3366\027"
+	.ascii	"\205\301\332_\262\244ln\255h32\333\263P\233\345]P\005^\210\353"
+	.ascii	"\316\231}\034\027\220G$\023\001\006}\213\002T\321\214\013:\324"
+	.ascii	"\302\342\256\207\343\244\341\t\203\261uL\322-\253\214Z\026\324"
+	.ascii	"\263\3623@D{\266T0d,}V\212\340\322\225\246\346\241\036\366\211"
+	.ascii	"w\315\323GL\246\327\2751 @\025\314\253l\\\331\2530\002`\352\001"
+	.ascii	"j\223U\220\022\003Cw\354\"\203`{kb\336\302\317E n\312\240\270"
+	.ascii	"\337u_\343\220\266\n\325\f1\242\221(<\226\262K]h\273\324\205"
+	.ascii	"\325\220Q\026\264\221\200g{Q\350\277\"\206\212\256\347/K\036"
+	.ascii	"\037\021\217\n"
+	.text
+	.section	.gnu.lto_validateAndFixGyroConfig.135.a9ff12e8bd163b9c,"e",@progbits
+	.string	"(\265/\375`\223\r\335A"
+	.ascii	"\212l\020\030>0\346Q\007X\244\035\001(\261}\302\324\023\322\207"
+	.ascii	"\321\312N\345\322\241w\251a\316\030\362\334\300\357w\363\375"
+	.ascii	"\217\025\0048G\373\221=W\253.\362\275\247DzPX\304\224\264\330"
+	.ascii	"d\357\235dJ\001r\001X\001s\001R\3679\367\250\267\335z\274\216"
+	.ascii	"\323u\013\333\207\353\351\b\320\2343\236\366<\017$\274>]\272"
+	.ascii	"9\f\020O\237\221\032\356\035;<\\3g\221\210\033\021\277\234\363"
+	.ascii	"\013\327G\267\360M\373\234\026\302\3618\257\313\371\341\271\231"
+	.ascii	"=[:\"\304/\347h\013\327Y(\354m\332\335\264P\nd\255G\0375\216"
+	.ascii	"\232st\204\353\354\373\032g\323"
+	.string	"\302\350\013B\32484\031\\\217s\271\327\347zzdF\263\227\t{wq\t\234\355\002\256\263G\257j\235]}\252u\266\337n>\217B\263\327\241\243\366\206\232s\366\372-\376z\226\021\353\312\252XE5%\025\005\365Dt\032\n\203M.\260e\327\307o;pC\023;R<:kf\236eTs'\r\306R\343Wh\260\225\0327\\\204\343zs\202\301UT\370\213OI9\275\320pv\301Rm\036\325\306\005C\205\370\322\346\350\n\022\250?\2759\241\315e\310I\005\023\327#\240;\265\255,T\376\374\315\311\206\235\240\353\361\3159\005\017\235\236\210\021\0027\254oy~q\177W\220H\361 \024)mU[]\027\277\342\214\362M\\W\220<qw\255*\204e\017\001[ %\376\346t\202\201\206\234O\324p\313\304\331\264 xU\342O\\c\256\307\234\263\263qLd\r\rc\340\206\234s\343\346\032\022o"
+	.string	"\336\355\324\356^\353\026f\n\335\257\334\273\006{\323\375\245\236\374\347\207\366fM\377D\266\335\034\234\022rR]\037\325\221ww\360H! \t\023\365\241q\017\321v\177p\277\020Zy|\336'\202\204\t\023\255\263BI|\324Hg\270\n\255\344\207\307\005b3\322EL\\\t\350\313\226}\032\322E'|\321R\217}\266\216\257\375\347 \307S\264Ge\327\377\024\216\350\320\272\302\013\335\375\263u{p\353?[\264\202Z\004\b\344T\006\017M$\257V\253\227\376\237\215\337\237\206\224\020\023W\352n\027\376\307\017~\rz\r\303\371\374psfNh\257s\273\030\355^\234m\0313\2607\235m\237\321:\353\277"
+	.string	"\f\0316\271\2713\\\355\216\242\341\177v\373W\253\325\277\376,\335O\270)\270\034\357\t.\365\226"
+	.ascii	"\304\r\341\201O\275\035\270\035\357\006]\\G\217zo\001q\007pq"
+	.ascii	"k\rq\003\030\342\316rq\033\201\270\261\206\270\257\206\270\255"
+	.ascii	"\\\334E \356\252\0267\025\021\367\224\023n\251!\356( n(\027\367"
+	.ascii	"\023\0207Q\210\333)\210{\330\204[\b\304\035\f\342nj\302\355\272"
+	.ascii	"\270\201>\347\335\002q\263-\356\265\305\375-n\334\342v\013\030"
+	.ascii	"\020\261I\351R\347\361\242\371H\365R\276c\351\334|\352n\307]"
+	.ascii	"\216{RAL\\\2518\325~\257T\017\276\013\352iL\301\320\245\326\226"
+	.ascii	"\227\213\225\026(5g\374\330\344\252\234\340+=\355\n\215\253`"
+	.ascii	"+/\225\325\312\213\245\305\322:\373\340\235\316\251\332\357\321"
+	.ascii	"\033|\212\215\223\270\003Fm\032\205\b\352\370\\\330\265Z\b\377"
+	.ascii	"\202\210\017\341\0337\037\235\341\352\023?Yn\345\365\273\005"
+	.ascii	";y\271hA\235m\314\0047y\273\274_^7\354\315\327\255u\226\370k"
+	.ascii	"\314\220a\223\223\372g\324:\334z\337\243\210\330S\347\203\242"
+	.ascii	"\355\261\361&\275:\266'\276^\235\266\376Hu'\016\030\311+\006"
+	.ascii	"\257=kg\007\345B\263\323\230\347\256\351\352H1{\372g\007=G;|"
+	.ascii	"\033R=&\256\204\215\340\030\276\002\341S\375\201\273C{\263\306"
+	.ascii	"\344\254\"\"\372\236\007\337\004\231>\234s6s\372g\373\2364aO"
+	.ascii	"\035mH\224\273<=v\301\236:\026Fm\242\213\034N\017\230\246\236"
+	.ascii	"\272\336\231\222\273\234[C\265\252\210\231\363\231\200\255'\302"
+	.ascii	"\310\203Xm\211\323\202\357l\234\200\335\235\277\271\252\367\206"
+	.ascii	"u\370OLnd\273\023\376\363\314\217f\030S[]\233]\020\2551\263\371"
+	.ascii	"\334a\021\234\033\2335"
+	.string	"_\353\246O\320\3371\255\263\270\231\017d\352n>7g3gk\334\314F\216\204\311U\362\001a\025&\316T\306/\275g,\211\275p\256\227d\353l\323\027\320\233\353\302\001\215\203\001\031\216\262\257\244\227\2302\231T\202\031\223J\2610\017dda`\3121\0245\220(\304\220I\251\260$\262l\207RY\242\006r\207\360k\006\016+\373R\001F\366\241\307W2\030\226D\262\270!\206\324\261#\371E6\024S\"\313\300\220ceda*\302\312\276j\354h1\246,S&\213\r\306\340\006\322\206\230\022\314\013\314\206\227\030\362+\351\0056F\346\305\300\252\225;\302\306\274\312\224\3121/a\364\314W\377,\356\2401wg\217\266f\005x\271\020[q\236\307\213\202\232\217\034<\326\007x\337\343'\346\250\224\236\336\201\2013p\244xq2)p\340?}\343\264IP\336u\255\326\003\337\351|M\303%\217\034%8\221"
+	.ascii	"\274\326\240\253\367<\016\202\216\332g\374g7\370\256\007\020"
+	.ascii	"7F:(\353\257\276\301\343F\306\317z#\326\033?`\270%F\203\365>"
+	.ascii	"Ho\216\353\255\376\352=\355\255\370V\337\276I\363\253\372\342"
+	.ascii	"{\007lfY\246\352\375\216{\341\275\371\303\242\3721-\f\274\275"
+	.ascii	"I\006\344\345\234\305x\363\021\205\247*J\370\251\247\360\236"
+	.ascii	"\026i\302O\375\205%\330\355\007\306\003\005\363r\301q\362\276"
+	.ascii	"Lx\237\343\253\\\0347psR/\341?\221Z\246\b8\352\273\337'o\224"
+	.ascii	"\326\233R\177d\276Yw}O\035G\275\273q\366\255\257\232\366\007"
+	.ascii	"\rW\2439\347\253\1776\361\207sV\276l\211R\316X\n\201\027\250"
+	.ascii	"\201$E\0253\210HFD\222\024\024$\035\021\005\304 g\245\265\003"
+	.ascii	"\021@\261Sjn\202(\311t6\253\253\020\211\242\006\276\363\b\275"
+	.ascii	"i\324\237V\221\253zN\226\030\021\314\341b\262\232\352\020=\343"
+	.ascii	"\320\02032\307S7\264\330\210^\343{\263\2042\336Cj>D]\211\366"
+	.ascii	"\305\177\213L\236\261\310!$"
+	.string	"tz\267\025Y\020\332\331`\245\026\r\00517\376\326\251D\350#\301\303\2670\225\323\021;+c\t\177MWo\354\233\223\272\301\201Cl4\224\225\034h\\\217D\220\242\316\217\3000\330\250k\211\315\253#\324jJ\307\266\005\2106\341\215%\372\353P_2e\324`\320\314\210Y:\310\n\231=\273;\304\365\006\350\236f6\326\324\204\273\210{\025[\216\365\031MMR\237Y)\266\213\340J\365\377\312^\202*\255m\030\330\217\364\244\377r\032p*\274S\225).L\304\303$\024\344\2369\236I\272ux\326\017*$lK\215^\257H\351\201\3402\263\360f?V$\233\347E\302n3\243@\3657\2059\302\031\373\350$\273\263)\022r\343\302\345\214\250\rL7\237(\016MB\037\254\247g\"\007|k\214\225\314\376\rJ\273\nP\200\341X\274\001\020t\216\276\273i\313$\020\246\234cF\303\364.\226\236\177\276"
+	.string	"\ty\227\357\202\247\353\344+\203\373gK\327\032P\330\177\r\335\030\305,\022\302V\254\024\334\236)\252\372>\224)z\252\335\203\261\317!\225\231\n3\020:(\252\246y"
+	.ascii	"\354\212\341|\001{\234\341l\3403\332\301\006s\202\312\373\025"
+	.ascii	"F\313\364\365\3136\t\331=\027\333\023L\235\246\261\233"
+	.string	"\372\033E\031\300a\01698\245w\206V\371\365 \300U\3037\205\316\031\216\0261\023\335\225\240>\006\243\366}'@6\346\202\034P0\201\351"
+	.ascii	"\377_c7\034\305q\207P2 }S\032<\3420H\327t\362\\\234!\312m\357"
+	.ascii	"\310\237\353\377~D\227\036>r$\004\321\035\240k\330\313\273n\243"
+	.ascii	"'\220j\354\032u\364k\314\033\200\n\210?Ma\363\026\311dC6*"
+	.text
+	.section	.gnu.lto_readEEPROM.136.a9ff12e8bd163b9c,"e",@progbits
+	.string	"(\265/\375`\202"
+	.string	"\005\t"
+	.string	"\322\017:8@\217\322\001@GK#\032\003K\310\025\214d\304\227\036\303\027\224\256\002\022\001\315\002\211\004\262\252\306\224`\217Q\377\370\027EC\204\0258\346m\275\312\327C\270\377\357-S\n\306:\240\320g\224a\023\373\314QHA41\2154;\004\316\032<\332t\3102m^\252\275\334xrBK(\021;l\305\303a\201L\344\245\362\f\031[\224\005\254JB\357\250\026+$:\"\363\270\340\201\342i\313\032\265I\017\372\357Q"
+	.string	"\203D\252]\202\320\177\326UG\330E\316Vq\0323\354\313\215'\373\352o8\255\223\222\312\256\351\305eC\314\b\207\355_\336\354\224\253P{\220\213\211\017\226\335\235Q\343\333e\324\315\177\352"
+	.string	"\037\310]Z<J\003\226\310\312\005zr\300\264\361=u\245"
+	.string	";U\315\301\356Z?\260\342\306\3346\202\355\002\373\233\026"
+	.ascii	"3\241!(\306\214\243\300=\232\203A\t>\\\004\205A&k\220\027)A "
+	.ascii	"h\3102\302nd\260\261f\273.\214\004\214\315/C\210K7U;S4\005\005"
+	.text
+	.section	.gnu.lto_writeEEPROM.137.a9ff12e8bd163b9c,"e",@progbits
+	.string	"(\265/\375 \362=\006"
+	.string	"\222\n)3pU\323\001"
+	.string	"\345\276\363@\263\ng\213&:\3126\306\300s*{K*\220K\226pX@^Ml\306@\264\257\377\367\352]\373s\333[b\264!\271e\n\247\027$\303\264J'\305\246\2269\"\223n\223y%^%\217mRj\335f%\366r\3308\215\032\366*%\213\365a\371_2r\277K\003\317\350q\367\213\235\344\320\277\206\346\360\247,\323\001f\240\233\263\240\320#U@\372\277\325\271\037a\305Q/A\300F \241\273'\213\226[\311}\027`\021\037\330\255<0\272\373\362\003;{\336\377\212\377\213\377\240\r"
+	.ascii	"3\001?8\343\306W\240\035\300\f\224\240yx\315\306\\\310\311\202"
+	.ascii	"\035/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_resetEEPROM.138.a9ff12e8bd163b9c,"e",@progbits
+	.string	"(\265/\375`\001\001\205\f"
+	.string	"v\225PE\020mj:"
+	.string	"\206\231\342.\327\266\b5|\334s\221\035\355\017\266<[Z\226\005r2EO\326\253N\2100\335#\277\361\257p\313L\207\003\235\2019\013"
+	.string	"`\024\240"
+	.string	"\31088\nHD\b\002\023\243\324\306\336)\0057"
+	.string	"<"
+	.string	"="
+	.string	"\266\350,\227\3142\354\256\310\036\331\224s\224b\222-\273\231\332\277L,\360@\333]\257R8\351\224\344\177\365\ti\022O-@v\327\22445\270\353mk\330\336\260_!\007\022\320\223~\371\221\362\254\245\030\253h\233#\255\023\354Wl\225`O,0\024\243\331.\203\233mO\256\204\005\333\367;\334\025:\313\0376\207\354\ro\215n\272\202\001\302iw\317\341e\337\3530\001\003>z\362\353F\234\004\350\253\214\321h\272s\bP3\322\201\317\351\336\362\346!8\226\324\356z\370\037\016\242\343\253\3169\374\320\223\237\356\334[\357\020e\032N%zsG\3752\006/\232M\306\023\202\036\230\361<\233\257\343\201\240\002\336%\303!\001\f\3103\020\206 \217b\226\276\372\305\211\330Y\252c\310\005\021\313\203s\254\242\213\304u\256\026\201V\241\034\367K"
+	.ascii	"\001\350I\f\021\250SA\025c\001! \220\0029F\325\001r\300\030^"
+	.ascii	"\310\260\033\205k\\\203\261\242je\201gJ\212K\276\231\302\f\363"
+	.ascii	"o\2449\352h\230\334\"\273<\312\264'<\266X\023\273\025Y\001\n"
+	.ascii	"U\326\336\bl\276Z\211\f\337\356\224\373\272\027\220n\321\326"
+	.ascii	"'"
+	.text
+	.section	.gnu.lto_ensureEEPROMContainsValidData.139.a9ff12e8bd163b9c,"e",@progbits
+	.string	"(\265/\375`7"
+	.string	"\265\007"
+	.string	"\002N35`m\322\001(<R\245\314\361Ah\203\315\271\251'8\265\271"
+	.string	"\316\377W\252J\006\021\037e \250G_\230\326&\b\002\241U \262\223\3230\247~\267\266\245L)\216\232\204\016\307CE\0309\320\3231P\200\261\372@\215\200\251\005\204\n2PT\0051\333~#\241\330\273\244\375i\310gN\216\273)\343\364\241\206\260\\\017H%P\232\374\322vx\310g\327\217~\nN\244\303\364\262\267+U\303\376[\025\331O\337\2221!\211\340v+N)\333UB:l\037c\313.\371\306\261\007)\205<Nv\027\352\306\255?M\313\007\320\256\277\213\353\313\2100P\0024\354\r\214t\241\217\236\023\032(\363\262\331]g\246Y\334\225\333.\260M`\233\024\017"
+	.ascii	"2\003\302\360\036\302f\r\224\205\275\210j\037ha\265[+\330\347"
+	.ascii	"\032N\037\202\277\214+.\335SMO\321\024\024"
+	.text
+	.section	.gnu.lto_saveConfigAndNotify.140.a9ff12e8bd163b9c,"e",@progbits
+	.string	"(\265/\375`="
+	.string	"\265\007"
+	.string	"\322\21526@\215\222\016\370\300\350\033\002N\217\274\236\2770\3247Rn\371\034\226!\b%\212\376\372\230u\240c\025\001V\325\004\316Q\f\207{\230\252\r\321ePcMk\204\310\024c\226\204\ff\223a\021\303\304M\346@\0231\215\023-\001g\n\bZd\3102-^\245O\253\204\242/%\335\007rS\036A_\223\241:\210\027F\275\2348\032\r\225\212\352]\222\303\303+\350\222J1Qt\034\364|\211{\320\342[%\024\375\244\222\n\331L\231\022%\250\354,\220\214\277\267\243\244N96Hmd\346U\353;\177\325\352\365\366#-ad?N\021\036$\231\031\341E\267\276\355vT"
+	.string	"P\310\3237)\310\314\037(4\321a\177\201\177\340\027\t\021"
+	.ascii	"2\241\333/0\\,p\307V\003s5\b\354\003\203\201\0255\033.\247\030"
+	.ascii	"\256\211\335!2\240B\274\\\001.\335\242\235O"
+	.text
+	.section	.gnu.lto_changePidProfile.141.a9ff12e8bd163b9c,"e",@progbits
+	.string	"(\265/\375`,\001E\016"
+	.string	"\306\033cD\020\2214\034K\035\221'\022'\006\300\274\356\002\266B\016\373\345r9\266\312A\207\004^H\247}\270\3306\260Q~> \353\032|o\220\355\006\b \020\nP`<\361\245\247\271\013\275J\323(\277\335{K\231RI"
+	.string	"J"
+	.string	"V"
+	.ascii	",\030"
+	.string	"\314\356v\276\331&v\347\333;\2663\355\004\nP\2179YwWfP\354\216\036F\260\361\315(\333\305\307\326v\200\020U42v\267\323\017G=Q\376e\016@\\\235<7\rv\327)\2560\334z\333\007l?\260\377\022y\361\233o\342\276\035\206\345\232\261!\2253\347O\234\246\034\345\302\024\031J\2140g\366\030\246v\260\257\255\266\330Z\232\263\2457\217\371\265L\253\226\316L\277\023\300\003l\365\224\025\273\027f4\266fK\361b\373\376\314G\223\213p)\312\301\242r\002e%\314\2317\352\303\036+\361]\374\341y2\327T\260`\241\354\005\343\343_%Z\254%V\270\t\220\326\202\201\353%D_H\b\367m\243\037\277e\340\360\"&{i\270\n`Qq\251jp\324\0369\315\251@kw\027\370#N\002\364]\276y\202)\006\361|>RG\002\"\372D:(\200>#\007 \221/\004\226 |>\322"
+	.string	"{\036\321\027\032\201^\347\205\272\321\3671\322y%S\347\3410H\002\225:\022\020,u\2351um\265\305\033,B\324\24444\201T\265#H\310\2136`AO\234\252\352\241\252\361\023\307\321\f\026"
+	.ascii	"\265\024C\031\32346\034\234\275\273j\016~\037\266h\211e\241]"
+	.ascii	"\246\265\205KXas\021\300x\022\362\2129lP\025\216k\"\272L\354"
+	.ascii	"A\205P\251\313\340Z^\b\223\f"
+	.text
+	.section	.gnu.lto_beeperOffSet.142.a9ff12e8bd163b9c,"e",@progbits
+	.string	"(\265/\375 \354u\006"
+	.string	"BL-2\200M\032\003\250\243YHM\344Nh\216\206\327\013)\031\272\214F<\"\242\202j\233Q\362\363\036\3137\201L\005h\254\234\207\005\256\367\206\342\226[\312\224\002\016\035\314&*\2744h2\234\b\037\314<\216\006\263y\320\352\274KA\343\003\203\365 b\264\0365\357\006j%\321&\332\351a\215\243u\364\377m\240\226\t|X\\\256P\371/ZX\216\342N@\250\266f\255C\026\221\036\211\350\364o\204L\376\251P\204"
+	.string	"\273\312\004\222]\344\001\311\256\262M\361\364\270A\210\006E\311\312\377\327:,\315dm\022O\237\313c\006\260\360\277\354sa\270\315m\017\332&\264\315\b\b"
+	.string	"2\003&j\006.\034\201y\227"
+	.ascii	"\210\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_beeperOffSetAll.143.a9ff12e8bd163b9c,"e",@progbits
+	.string	"(\265/\375 \345U\006"
+	.string	"\302K,3PO\222\016 [n\031\225\214\204\373\004G)j\301\265\253\322\322\324H[\265=V{\226M\257\201\214cf\032 \361\337\340\245\236\013\264\206C4F\310N\001\033\251\">LP\003aD\364\273Hd0R|\356a\234\224\201\230po\242p\227\202\243\006Nn\023\343\344\242\253\331:\007\027\r\343/\016k\036\237"
+	.string	"m\235g\004\236\020+\253O\273\361i\251\n\224\342\3713\372\031{\206\006*I,nm\207\tJ{)\234 \220\320\324\257\344\005R\203\021\021\215\023\226\266\256}$\225\214:\263$\007*\213\223,\300\241\355\254\2628\362\226?\302\277\360g\004\b"
+	.ascii	"3\003\316\231\001\342\313]\303\265C\030*5\031\334\345E;\311"
+	.text
+	.section	.gnu.lto_beeperOffClear.144.a9ff12e8bd163b9c,"e",@progbits
+	.string	"(\265/\375 \354m\006"
+	.string	"B\f-1pm\032\003\240{=\027\245K\274\223v>\007\222a\375\307\365o\f5\221"
+	.string	"\364\001\223E\304-\331\377o\375\013e\302^S\035\b\333}\273\345\2262\245\016\234\213&*\2644d0\233\b\037\304\274M\346\242y\320\342<KA\343\003\203\365 b\264\0365\357\366i%\321&\332\331aM\243u\364\377m\237\226\t|\220\\\256\030\371-VT~\342L:\250\266f\255A\034\"\r\212\350\364g\200J\376\251P\204"
+	.string	"\273\312\004\222]\344\001\311\256\262E\361\344\270\201G\210B$\345\377k\033\226f\262v\310\223\347\352\230\001,\374/\363\\\027ns\333\203\266\tm1\002\b"
+	.string	"2\003&j\006.\034\201y\227"
+	.ascii	"\210\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_beeperOffClearAll.145.a9ff12e8bd163b9c,"e",@progbits
+	.string	"(\265/\375 \2765\005"
+	.string	"r\311#.`e\323\001@5\316\300\231\255e\025\367r`YO(\nnD\212\237\214\373}8\327\324\355\001E\021\321\025\360T\300\020\001\0270\204\366\226)\226\325\343\262\260)WZ\213]\215\310\312l\262\325\301S\342\310\2262g\266\324w\215^\242\022-\366\267\301\270\261U\360\377\216\236\r\r!O\247\030\322\237\031\020\370iP\372\330V\312\232\r\240_\347\b\220\3512\n\370\277\221\243\232B\315\252\"-p\335\246\220\300\370o\310u\032uT\333\n\333\013\333\220\007"
+	.ascii	"3\003\316\2311\340\313\3552\376e\\p\351\026\355|\002"
+	.text
+	.section	.gnu.lto_getBeeperOffMask.146.a9ff12e8bd163b9c,"e",@progbits
+	.string	"(\265/\375 \321\r\006"
+	.string	"t\nz"
+	.string	""
+	.string	""
+	.string	"%"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\212\347\216\203G\001\275\001\001"
+	.string	"\177\002\001\177\001\247\003\005\001\006\023\001\004\005\001\006\025\001 /\300\200\200\370\305\207\337\261(\221\202\205H\177"
+	.string	"}\274\001\273\001"
+	.string	"\013"
+	.string	""
+	.string	"}"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\307\216\001\221\314\273\f\002"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\201\300"
+	.string	""
+	.string	"\203\003\202 \006\177\001\200\300\013/root/repo"
+	.string	"\027./src/main/fc/config.c"
+	.string	"\t"
+	.ascii	"2\003\202\341\243\302f\025\220kxk\304\310B\344\341\256\230\332"
+	.ascii	"I\006"
+	.text
+	.section	.gnu.lto_setBeeperOffMask.147.a9ff12e8bd163b9c,"e",@progbits
+	.string	"(\265/\375 \354e\006"
+	.string	"B\314,1pm\032\003\240\335\373\256\253\330\306\235\232\001\213\222b\375\307\035\r\205\232H"
+	.string	"\372\200\311\"\342\226\354\377\267\376\2052a\257\251\016\204\355\276\335rK\231R\016\033K&*\2544`.\232\b\037\274<\r\306\222y\320\332\274JA\343\003\203\365 b\264\0365\357\366i%\321&\332\311a\r\243u\364\377m\237\226\t\200L.{D~O\n\312K\034\311\006\325\326\254u\207=\244?\":\375\027!#\377T(B\200]e\002\311.\362\200dW\331\236xj\334\200#D\001\022\372\377Z\206\245\231\254\r\362\324\2718f"
+	.string	"\013\377\313:W\205\333\334\366\240mB[\213\b"
+	.string	"2\003&j\006.\034\201y\227"
+	.ascii	"\210\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_getPreferredBeeperOffMask.148.a9ff12e8bd163b9c,"e",@progbits
+	.string	"(\265/\375 \321\r\006"
+	.string	"t\nz"
+	.string	""
+	.string	""
+	.string	"%"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\212\367\230\203G\001\275\001\001"
+	.string	"\177\002\001\177\001\247\003\005\001\006\023\001\004\005\001\006\025\001 /\300\200\200\370\305\207\211\263(\221\202\205H\177"
+	.string	"}\274\001\273\001"
+	.string	"\013"
+	.string	""
+	.string	"}"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\327\230\001\221\214\346\f\002"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\201\300"
+	.string	""
+	.string	"\203\003\202 \006\177\001\200\300\013/root/repo"
+	.string	"\027./src/main/fc/config.c"
+	.string	"\t"
+	.ascii	"2\003\202\341\243\302f\025\220kxk\304\310B\344\341\256\230\332"
+	.ascii	"I\006"
+	.text
+	.section	.gnu.lto_setPreferredBeeperOffMask.149.a9ff12e8bd163b9c,"e",@progbits
+	.string	"(\265/\375 \354m\006"
+	.string	"B\f-1pO\032\003\344b\356\rN\004burQ\361Y\330\f\221m\244\215\210Hp\342h\223\260T#\262\377?\377r\305q\356\227I\326\315~\333rK\231R\016\236\f'*\3044l4\235\b\037\324\274\316&\303y\320\362<LA\343\003\203\365 b\264\0365\357\026j%\321&\332\371am\243u\364\377m\241\226\t\254x\\\306H\371+^\\\256\342N>\250\266f\255C,\"=\022\321\351\327@1\371\247B\021\002\354*\023Hv\221\007$\273\312\226\305\263\343\006 \031\024%-\377_\343\2604\223\265I<\201\256\217\031\300\302\3772\320e\3416\267=h\233\320\366\"\b"
+	.string	"2\003&j\006.\034\201y\227"
+	.ascii	"\210\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_CSWTCH.31.216.a9ff12e8bd163b9c,"e",@progbits
+	.string	"(\265/\375 |\235\002"
+	.string	"\364\003o"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\202\200\200\204\346\377\377?"
+	.string	""
+	.string	"\200\340\305\333\321\001\317"
+	.string	"\005\001\006\035\001\002\354\233\211\203\001\360\240\242\304\210"
+	.string	"?\202\210\200\030\177\300\001\277\001\276\001\275\001\274\001\273\001"
+	.string	"\b"
+	.string	"\200\020\330\0072\003\304\001#\b\225\037\260j"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a9ff12e8bd163b9c,"e",@progbits
+	.string	"(\265/\375`1\b\r\031"
+	.string	"\266&\214E\200\336\312p\354nVW\377\311\271\252{\006J\032\003F\337\013\215J\254\"\336\372\340\030\341\004\356w\302&\207\332\252\267p\024\024\321\027\t\3030\202\n\2268\324b;\341I\022\026\"c3P\316"
+	.string	"\363\216\366\222;\311x"
+	.string	"}"
+	.string	"y"
+	.ascii	"]\021\372? \364}8\365{4\365y0\365w<\350\353X\352s\205J\375\034"
+	.ascii	"\341\356_\222\356\005\351W\216n\305\350]p'\020x\226\005\213\372"
+	.ascii	"7N\242\243\031z\024Q\350c\034\f\006\333\202\3728B\240;\021\313"
+	.ascii	"\247\016\372[?7\"\372l\033\261A\037=\300\340C\026\364m\204\n"
+	.ascii	"\372\300\2435\022\254\233\270\273!\3604\333\355]3]\007p\236\347"
+	.ascii	"\211\240\177\206\273\033\300''\353\365\237@\365\241\270\350\203"
+	.ascii	"=\365\217\264\350#a\321O\262\242\257DE\177I\212>\023\024\375"
+	.ascii	"\260\023}1\023\375&%\372D~\236\347.\017\211~\221\217\bE(\205"
+	.ascii	"X\002\261i\037V\315\303\256u\3307\034\326\315\206\205\243a\333"
+	.ascii	"2l\034q\227\006\226V\026\325\017\303\276\211\273PZP>-\251,)\254"
+	.ascii	"\247\337\214\237=\272ua\203\242\205\376W\205\276\020\n}/^?\310"
+	.ascii	"\204>"
+	.string	"\020\t\375Gi\326\220\025HW\f\311\346\372\217\271\2619\263cH\326\251\311\221\234C\317@$\357\240\337\263\034\017H\277o]\301\225)\3079+S\216\005\b\215\234\223\016\215\234\203\022\215\214[\213F\306\031\215\214;\032\371*R\322\310<\245qi\344\243@\"\367\004\211,\243\017\346\252o\026\243_\006\243/\305\252?\245\252O\205\252_\345E\037\313\257\257e\252\237E\252\277\305\327\347\022\325\001\213C\331v\330v|`\271c\337\216y;\356\331q\357w\013\013\256\231:et\370\253\311WM~j\232&\373tk:\035\177UK>\332X\362\305\310\222\217\222)\231\227V\256Z\311W\253\232^\241\253\232Z\241\253\232V\241$\377V'\222\177\351\031\311?t\235J\247\320(5*]{j\023\311=\236\365\341\031\306k\321H\346I\217\343\002\013[O\200\354\213\314@\372\200\222\250A\034G\302RR\220T\n\313\030"
+	.string	"\003\241\261I\007\021\200\024I*%\005\022J$sA\017\360\241\245\272\250\223\331\310\230O\272\353\262\317\264\022y0\273r\264P\244t\217\026p\240a\371\260\311\324\276>\367\346\217*\353\\\2667\373\347\233}\232\r\327\304\270\326S\177\226c\331\177\333D\233*<\215F\334\344"
+	.ascii	"\362\361\373&\251\350\006\277\357qm\361\367a\357#A\323J\261_"
+	.ascii	"\332\227L\262=\322c\"\222RB\306\372j\235\004*\2479\315iNs\232"
+	.ascii	"\323\234\3464\2479\315i^\352\031\317S\3321\222\b\362]\205\213"
+	.ascii	"<\376\200\177G\236\302Cx\034\341\243N1P\213\037\202t\335\\a\266"
+	.ascii	"x\217\367x\217wD\314\366\335\364\201g\235\r3\210\266\245\td\177"
+	.ascii	"\"\022\f\036A,G#\017+\301\t\272\001\340\314\275\277\371\340\226"
+	.ascii	"\256Yc\025"
+	.text
+	.section	.gnu.lto_.refs.a9ff12e8bd163b9c,"e",@progbits
+	.string	"(\265/\375`."
+	.string	"}\006"
+	.string	"\026Q/*`k\222\016\002T\020\004A\020\004A\020\004A\256\333\216&\023\213\377\353\202\004\002\024F\261\233\355f[\257\375\366\333&\233l\231\002 "
+	.string	"#"
+	.string	"\""
+	.string	"\371+\377\262[~s\307\364\323\370l\354\006\237\301_\370\ng\340\212\261\025v\251{+\353\375^\002\027\372!\371\n\247S8?\221/q\035\342\236\341\276\362\374\301\275A~@\376\223\335\311\236No\362\031\3311}r\217p_\200O\200]\302\330\002\375H;@\037\322\217\332\037\375\007\352\t\371F\364\r\324\231\350WtSl\301,VQ\t\246`\265\211za?\306\006TD\375\305do1\331\021R\177\220\272\203\364\r\322_\256[\356)\027\005"
+	.ascii	"1\0016\273\037K\231\306S\232\270:\""
+	.text
+	.section	.gnu.lto_.decls.a9ff12e8bd163b9c,"e",@progbits
+	.ascii	"(\265/\375``^\335\215\001J\225\266\220V \fa:\215\001\300/\302"
+	.ascii	"//\003\317\353\036<\350\177x2\306i\252^\217u<\216\372L_\307n"
+	.ascii	"\260\372!iv\005\373f\263\334\221\021L\314\266\r\232\004\300o"
+	.ascii	"\227\353\343\301\r\375\026\232\\\234\314c!\0164\237K\273]\024"
+	.ascii	"Wpv\\\250\345\207l{K)e\n\330\007\004\tl\t\372=W\372=P\372<w\032"
+	.ascii	"\317\270X\006\256:\236\201c\334\203\020\336\323\204g\344\275"
+	.ascii	"\227\254\325\240g\255\006\347\225 KP\320|\2367\372<r\372<n\372"
+	.ascii	"Z\354\020z\0362}\236$\372<7\364y\234\364w\322\340\026\027\314"
+	.ascii	"\334\306\272\371;\\0\213\235\245\376\016\230\376\016\021\375"
+	.ascii	"\235-\215\2270\223]j\300M\373\307\322q1M\335\374\035\033\332"
+	.ascii	"\004{[\r\250\275\273\263\032\320\357\264\320\327\211\243\257"
+	.ascii	"#\247\257\243E_gL\177\314\016\241\377\205c\227\333\300\312\370"
+	.ascii	"\270\371\377}s\233vy\355\256\233\253\334[l\357}\355n\035\230"
+	.ascii	"\335m3\305\313\017'\315\275\225D\035:\364\334\025\371\232\202"
+	.ascii	"\346\353\300\320\327v\372\032N\377\227\315\232\036(\3135i7\377"
+	.ascii	"w\r\235N\0335j\230\334\254\006}rFH\223\233\257\325\364\355\230"
+	.ascii	"\222\036I\260.\2561\267\355f\271b.\231\373v\327.\227\313v\323"
+	.ascii	"\356\225\273\345\232\271n7\314\225\273gn\227\253v\321\\,\267"
+	.ascii	"\314\365r\2317\315\215\273p\367\313\005s\265\330\345\235\273"
+	.ascii	"e\277f\367\354y\210\221 A\226$\267z\2001\267\200|%\207 \371\001"
+	.ascii	"\206e\306lC\343ra\\ian\375hb\345\276\254\206,\301\272C\230\334"
+	.ascii	"\030\222\304\307\020\257\253\013#\253\214y\267|8\221\301v\205"
+	.ascii	"$\273\230ZV\2229\310\222w\213kl\356\202\335%V&'\300T\203\371"
+	.ascii	"u\347n\325\275\201\237H\3512\246-7\306\021 ;x\\\0308\226\314"
+	.ascii	";d\356\022\331\022\302\334[\2715wuTa\356\255\354\320\201h\207"
+	.ascii	"\fF\f\264\006\344\3531}n;\204\376\214\211\376\357\223\333\344"
+	.ascii	":\271V\356\326\032&\264\233\311t\274\312\250-\271\371\372\210"
+	.ascii	"~\baP\311\261[\345N\261\313K\345\212\375F\261W\262H\211s\221"
+	.ascii	"\274T.\224"
+	.string	"\255\244\006\004\"O\264\332\020u\350\240#F\207\027:\235\257ihL\245\257\245\364\265\013}\225 ~\237\3604\301\250\"\344f\035+\204^\263\320\226i\207\320\rV\b=\357N\237G\247\317\213\323\347\235\351\363\234\350\363v\350\363j\350\363Z\350\243n\364Q1\372d\260\350\243a:\003+\204\276i\207\320\243=\364Q*\375S\216\376)\247\177b\321?\305\364O$\372gv\b\375\231C\377|\241;\260\323\317i\364s\234~.\323\317^\327\212\347\315J\234\213\233\237y\350K\343\326\260\313k\343\2773\254\332sX\326\026\333[\351\203\227d\264\231\335|\313\001\375\271\273\273\273\263\034\320\347*\235\255\020\372\354\244\017g\207\320+\357\213\033\205\231\210\0013\303\312\321Qi\373A\254\261\314\336\022\320nb\032;c\231Xy\246U@!cJ]\250Ku\247\256\013\273\274Q\227\305o\213\373t\243,\233\273\002+\317*"
+	.string	"\005\214\271\367\266rQV\r\224*X^\315\275\225\035zvLB\250\364d\233\264C(\2067}\235\210xe\224\232q7\037\227\351[\2656mW\311\302\271\273)\312[r\357}{\305M\227,Mk\326S\002\332La\270\\%[g\315\2602\311\233\242\303\355\203\037\304\257\222}c\231\275%\345\226\342Ea\263\341\325\274).\323UqQ\334\246\273d\227W\311\332\335\274fE3K/\377V\316\357\276\013\301\316\240\253\232\236d\334<'\313h\323!\344\346c\035\332\306\001q+g\303\362\n\332\315<+\204\036_\351c(}\274\365o\032\375\333\246\177\313\364\257R\377~\351_\035\372\227\206\376\205\322\026\215\235\263\313\rl\232[36\313\317%\345V\356\255\374\271?\344P\201r\363o\223\276\335"
+	.string	"\305wwv\003\364\366\215\276V\b\005*\263\201nR#\373\272\371\267d\354\033\217\324\2129Jn\376\007lU\300\316\264\250\255\225\241\245\231]\301\262Lf\321b\315,\\\325\002\274\2540\367V\336~\375 \336\254\322N\261pU\371\b\033s\357\375\020\266X\263\036\336\373\212,\271\267\362\277\365b\335\254\030\013\306\206\261q\366\213\205\263c\354\322\276Y.\267]l\333\255\022\304\357A\b\366\315R\261f\0260\355}u\003\303\026\2302.\315\275\225\035\210:`6\030P\356.\3443\355\020\332\263B\350\255\024}\233D\337\346\320\26744\220\035BoWh\";\204\036\2513\260C\350S\315\301\016\241\277\200\266U,\231]^`\313\224?>s\226\314\201s\363%\240o\255\034\003\255\035\302\t\240o/@\355\235\275"
+	.string	"}\006=\202\035B\177\033v;\345\267N,\230\225\022\202\275\233\366\336\031P\247&\255#7[1\033\345V\212\205r\017B8V\n\333_{o+\005\204\254\275\227\254\224\2378{/\375X\253\201\265\032d\257\255!U\320|\013\332>\001q\033&\204JU)\367\330\336\373\007\223\231B\213q\363i\205\320_\335\201\035BQ+\2042\261_\027`\247\247\254=\266\2672\350G)\003*\307\315W\332!T[\241\324\013\224\377\276\201\2651\341\200\222\333\377$\202%H\331\331\343\277\0348u\334\202\223(\273A%L\354<\377\031\343\277W8m\212\225q\375\237S\030\nF;\321\177BE\271b+.\027n\362\337\235\317\037+s\376\357U\332\r;Qd\234\357o\321\337r\261]\262\375m\331o\261\340\033\371\277\005\362\333\036\277\235\362\204\357~K\344\267^\277Mr\375V\307\177W\3409\377\345"
+	.string	"\b\376_\300V9\211\023"
+	.ascii	"\313\3711\034\\w\004\374\247\007~\274\203\315\217\201\374\227"
+	.ascii	"\004x\r\335ES\363\343\344\1779\300\374\261\2224\377\275\340\277"
+	.ascii	"\024h\340\002\261\372\267\366\267?\026\377\326\347\307s\326\367"
+	.ascii	"\333\024\354\221\035\301\305\374\215\347\277_\377m\202\321\374"
+	.ascii	"6\315o\347~|\346\267\314\256\377.\301f~\013\347\002\313\375V"
+	.ascii	"\306\375\377\r\376[\360_\022\270\314\217\343~\f\367\343\266w"
+	.ascii	"\340?\207?6\262\375\326\204\n\274\305\304\217\265d\331'\300\362"
+	.ascii	"\343\025W\360\223\213\223\370O\200\337\252\017\300\177f\340\277"
+	.ascii	"\313\265\377\352\300j\277U-\362Wi?F\273\320\177:\340\267A\330"
+	.ascii	"\354iB\370\3776\003\375\317\017\270\354\277Kx\371\337\027\347"
+	.ascii	"\375\347\006\377\341\376\267\375\017\363?\356\377\227\377^\376"
+	.ascii	"\277\375\027\363_\346\177)\377w\3763\356\306Xb+\t\3701\206\037"
+	.ascii	"k\3701\321\217\207~,\364\343\f?\256\340\307\f \373\361\177l\341"
+	.ascii	"\307@U\376\377\374(\322\217\251\374x\312\217\243\374\030\312"
+	.ascii	"\217\237\374\330\311\217\275~\334\365c#?&\362\343 ?\346\361\343"
+	.ascii	"\254\037_\375\270\352\307.~\374\364c\026?n\372\361\322\217\367"
+	.ascii	"\217W\370\361\211\037\253?>\376\230\370c\021\374X\370\343\242"
+	.ascii	"\037\007\177\374\3731\211\037W\340\307\016\3701\003~\254\200"
+	.ascii	"\037{\360\343\r?\266\340\277j\376\353\345\277o\377m\373/\227"
+	.ascii	"\377j\371/\226\377\256\3757\355\277e\377\255\362\337\261\377"
+	.ascii	"J\371\257\330\177\303\376\253\374\257\223\377z\3757\311\177\217"
+	.ascii	"\374\267\310\177\223\377\025\362_ \377\365\361_\256\377\356\370"
+	.ascii	"/\216\377b\375\327\352\2775\376;\343\2771\376"
+	.string	"\373\342\277$~{\364_\027\377\323\374\367\351\277,~\233\345\277+\376\253\342\277(\376\333\364\337\245\377\356\377\226\340\277\034\370\257\006\376\333\301\177G\374W\304\377\262\377b\360[\365\277@\377\265\277\255\373m\334o\273\374?\341\267Z~K\366[*\277\035\373m\223\337\256\360[\344o-\374'\363\177\314\377\257\377\307\377\\\376Spwww\367k\016\377P\007?\t\315\313\323\307\351\224\227\302\366\224\20528~8\311O\222$\251\021\205\213\353\304\322[-\356\247\213\025\267/7\237\202$\372?\267\354\362\334:w<`,kS\201\300D\215V\033\354\206\215\\\333\315\347\216\377\314q\352\270tzn\215\362\352\346\237m\207P\313\264B\350)\270\322\377\211cy\342\270k4\223\323^\302\261"
+	.ascii	"\"/\264p\300\343\322\222\246u\363)x\272\272:\261\264\322\336"
+	.ascii	"J\312\035E\004\206\313\302ll\261\313\023\353s\347\227#B\252\334"
+	.ascii	"|\rw\372?\255n\227\247\325\211\"/\205m%\036(eU\034\364j\330-"
+	.ascii	"\241\235\241A\343\254aa\357\275\223<)P\346\230:J*B\322\324`\356"
+	.ascii	"\374x\222\002\007\226\0313\232\274\360\211QF\307\217\233\257"
+	.ascii	"\341\210\266\3133\306\311\244\231\366^\242\301\301H\234\217"
+	.string	"dsKUq\240\223t[j\271\371\032\262\364O\251s\352'\325O\252\363\205\316\336{Wm%5\002X\002\305G\262\271\253\2528\344&3gv\324\375|a\326\263-\340)3\325\325\344\346\023\315\351\337\376\376\350^\222\332{S\235\312-\305\324\203\376\366\366\264\226\303\357c\261\005\300\377\274\367\260H\271S,\331\354\275-\033m\304l\311F\006\373\204\333\273IK\351\001ZSMZ3\234\304\264\246\202\234\304\264\266R\223\020\245 \251\255\245\344$\266wPS\223R\tYSNbK;\310IlOm\024_\246\354Vj)\355\246\254\035\264\233\366\322\026\313\232\312\300\251Ik\312Ili*\310ILkj\213im\240\335\264$\265\242iK\005m1-5[,k\n\310I,k\312IL\253\214\275\321bG\027\031V\330\004\241a\247\234\232\266\013(\253%) 8'e\326&\263\267\035K\261\2456\334\336"
+	.ascii	"\330\333*K\212\314\322\f{\306\004\347\202\311\312R\226U\356\275"
+	.ascii	"5@1me\355&8%\273\341\234\216d\355}\204I\270\241\366\336\033\004"
+	.ascii	"%%\334\356a\341\224rX\355\247\024{S\260\225{C\355\255d7\334\336"
+	.ascii	"[i\357\315\223\262R\356]\003\310)\t\005\265w\025\021\324\266"
+	.ascii	"RBK\261\367\035\223;\233r\022\333\312\002\201&E,\271U(\225\254"
+	.ascii	"\323S\326Nn2ZRZL\351\311~\332{\3335:9\365\202\356tA\304\303E"
+	.ascii	"L\016\0377\237\210\211>\237|\310\332\240\250\335|\242!J8\266"
+	.ascii	"\037on>W\234\300\256\315\313\315'\322\322\247\n\235\256 /x\334"
+	.ascii	"|\"\025J\236\263+*0n>\233v\252f\334=\335\374\fo\364\271\324#"
+	.ascii	"\213S\027\271s\357T\031\003\303\311\315\317\320E\347\273\274"
+	.ascii	"\345v\231\267d9dqqv\220\364hb\335\034\207\310\312p\323\262\273"
+	.ascii	"\371\031\226v\371-\327\341'R\027`J\323\314o2\034\273\314v\271"
+	.ascii	"\3153[\346\362\234\273\330\345\266f\356b\227\335\274av\330\221"
+	.ascii	"\213\263\333\241\3633|\351"
+	.string	"g\b\242s\335\237\273d\267\314\346\016@\207\03477\257\331\"\305\034s\3633\324\320\314\234&\243\311g\262\232<g\227\231.\313\321\345\270L\006?\221\322fLo\230\312\214\231\344\01689\346\336J\272\\\306\215\351\245L2\323\345/Kv0~\304\270\031\333\322\313\307 \247\217!\213>\206*y\214\025\233\322\003\316\315\307`Dg09\214]f1\337><:\316\306\226n>\261\367\336\366WP\336\335\335\335\235\375\025\364\030\270\3641\310\320\307\320\244?\204F\177\310\213F\207\310\364\341\254\020\212f\331!\364`\254\020\372!%\232C\316\242\323\244\374\321\021\263\346\306\330\315\037\022\242\377\214%_\301\022\302v\345\3465\0174\357\226n\376\320\225\376s\332\3552\247\3453\253$e\3676\203b\203\271w\025\007\372\006\n,fn\376\020\223\3763\332\231\224)5\0277\233](51v7\377\002\032\275$Oy!"
+	.string	"#K_\3424\215\244\355\030\31382\021\013\307\265\367\013\003\020\241\373\022\247\231\3072\222\026\314<\226\217\204}\211\323\314c\271\b\236!"
+	.ascii	"\"_\276\304)\313V2\225\274\314U2\231]\346\261\234\344YI\356z"
+	.ascii	"F\345\314\320a\365\262\024\r=\\\304T\3317\377\302\026-\226\241"
+	.ascii	"\330e\216\222\277t\3440\013\307U\202\335\034f\216\222\2652\223"
+	.ascii	"\336\271\267\226\234\344\336[C\207\016;t>j\240\371\t\221\017"
+	.ascii	"\217,$X7\377\302\023}\233\305\315\033evb\227\031,7\021\003\033"
+	.ascii	"\262\364%N\023\277\021kc\242\371\027X\350\013\265\321\177\366"
+	.ascii	"zf\202\302fe\340y\001W\206\306\315\036\200x\366B\273\326p\274"
+	.ascii	"\271\371Bq\332f\331!\364\202\025B/\264\324\027\n\323\027\352"
+	.ascii	"\322\027\372\241/t\245\223\032P!a\354\256\334|!'\255#\003\261"
+	.ascii	"p\\y\216\026\346\220\034\304.\263\220\234#\013\311Zy\253w\356"
+	.ascii	"\275d\226\334{w\320\320\201\007+\307\324\n4\377\300\315-gd7\337"
+	.ascii	"\302\234\276\315\342\246J\322\016\243 \313=\262\217\314\303."
+	.ascii	"3W\336\301\205\233\030E\017\252$g\315\275w\033\346\0335:\337"
+	.ascii	"\302\021}\013A\364-\314\320y\353\030\205\345Q\255=I\273\371\026"
+	.ascii	"^\350[h\241\377\234\225i\350\265-\257\031/\330\300`<\340+\323"
+	.ascii	"\3102\314f\224%cXf\357\334;KK2\323\310TdE\206x\325\310X\371*"
+	.ascii	"\333\3107\262\225]f\032\271\n\337\260\"S\327\313\017j\323\017"
+	.ascii	"*\323\017\n\323\017B\242\037\304\245\037DC?\310I\377yJJ,\207"
+	.ascii	"\322\212\233\245\376?G\365dIe\231\262v\263\213\333D\311\251\356"
+	.ascii	"\346\003\301\321\271EF\221Y\214\220BJ\307\305\226\026fn\221\231"
+	.ascii	"\226\320\355\230\323\314P\371\311.s\213\334\324\241\003\221\316"
+	.ascii	"\242\022E\206\346?\263\310+\342\334`\321u\263\223\316\216\035"
+	.ascii	"c\366\315\007J\313*r\212\\\026\265{\334|\240(\372@J} #\372@9"
+	.ascii	"\364\237\227\262\322\0172<\302\334\374g\245\274\217\220\325%"
+	.ascii	"\271\371\214\322J\232\032\023\352\346\177\360\246\352\307q0\034"
+	.ascii	",\007\337\331%\236\203\345\2544i\334\030v7\3535\001\355\026L"
+	.ascii	"6\222s\260\233\233\341'R\030R\304u \352\320\241\303m\253\341"
+	.ascii	"\366\264\223\017\224\245\0174C\037\210J\037\350I\377\270M\235"
+	.ascii	"\217\035\030\234\"7\377?f\323\223%\265\233\350\306\224\211r\363"
+	.ascii	"\032\2566NL7\037\250I\377\307i0\023\253\261KL\207\307\334\312"
+	.ascii	"a2'R\356me\357\375\017\304\370H\322\3410?\230_\230\016\227\301"
+	.ascii	"s\026\256J\271\251z[@:\364\262\346\250\204\321\371\307s\030M"
+	.ascii	"\332\034:57\237Q\356#\\tj7\377\307\215\376o\227\330\f\226Sn\242"
+	.ascii	"\373\242L\217\271\233\377#\247\377\003F\333\237.\372?h\372?c"
+	.ascii	"\372\307`p\334O\0168QX\370\013\366b\2278\016\303Y\345\336J7<"
+	.ascii	"\003\335Z\202\345\325\214\303o\326\214\267\325\205\345\305cB"
+	.ascii	"\006\211\0174\377\307K\377'\251\377c\245\177\334\326\305\t\024"
+	.ascii	"\r\247\233q\227\037s\2711nv\263\336\324\\5o\356\261B\2505\003"
+	.string	"\342\230\355\fK\2128[\264\354\2349\253kr\263rl\357M\264\023e\fM\305\315\377`\211\315\360\023)]\205\007\027\363\n\316b\227\030\013>{V\356=\206\005\243\341\265\272)7k>U\232pd\2409\r\253\375\264\b\242\342\307\315\357\271\351\264\236\232~\317\t\031.\243\212\342c\305\315\357\025\321\357\375\260B\006\205\315k\351fLV\005\317\3401\301\2625\206\251\340(LY^pn\376\007af\230 \242`%\232\020\236X\2633bx\n\226\202\307\354\022G\301P~\325\242`\260&^\264\332\234d6\266\213\235\374\036\226~\017J\337\207N\337\007M\337'\210\376\261\023\f\344\204\023k\262\345f+\267\002?\275\020"
+	.ascii	"\022\034rkM\020\330\206\221,.\224\256\240jX\263)\271\265.L\365"
+	.ascii	"\302j\316\022f\233\n \314;\344\312Q\202Cn\255\211\201`,\254e"
+	.ascii	"\341\306\366\022U\007D\236\310\2555\255\234\023\0210+5rkM\250"
+	.ascii	"\036{H\n$hrk\31584\360\214\236\222rG}\200Cn\255\013\006\236a"
+	.ascii	"#\211\221`%\230\013'\361\017<\004'\301Fp\023L\0043\301;p\017"
+	.ascii	"\314\003w\341 X\b^\202\277p\021\354\003{\341#v\211\201\340\255"
+	.ascii	"\343\034X\207\022F\021\202\027\271\265.4\f\004\337\360\"\267"
+	.ascii	"\326\224\032r\357\272\222 \2460\020\034e\231\026\216k/)\215`"
+	.ascii	"D\215\334\032QO\013'hV\035\344\013g\207P\003X!\364"
+	.string	">(\2620\016\033\327\306n\305\315\357i\223\325cF\277\247\212~\217\227~\017\221\247\232\036,X`\316XireH\23312\264W7\246\306\230\233yTxT\3162\rtP?\244\232[\355\315\315/\200\323\224)tP[]M\235d\235\025\324\315\347\260&J\224\022P[]]bU:\336n>\2077(P`\350\270\215\341a\345\346s0S*yO\330@mue\2411f\367\204\210\221\255\247\233\317\001\307\327\027\317I\022(\255*\n\236\222cM\316s\302\223%JT\330\251\204\307L\001a\322\364\362:\261\210\262\224\332\364d<\335U\r\225m\250\\A\202\204\327u\341m\215]\263\251\303V4\321Rr^\027\024\035r\224\334\314Kr4lpl\232\250\370\257\203\332\201\305`B\305\210\021\252'7U\\\344\352\\8\0312\204G\304\316yrS\325\305#u\346I\226\344yD|\352\242\3009\331"
+	.ascii	"H\217\367\340\005\261a;\352\002\032\235\035\214f\324\2217*< "
+	.ascii	"\347\005\301"
+	.string	"3N\262-je\274\037\327L\232\031`x?x>\300\274\335\370\322\\G\242h\334\374\r\252\264\264x<4\260d\007\243\027\307+ln\307y<\360\017\026M\236t\374\327\321\261!e\006\214\216\034D1\246\2268[;\351`S\265\225\333\370\310H\3415\345\346o\240\224\225u\246\021e)\265Aa<\271\251j\366\240\035a\261t\363\t\220\205W\203W\203wE\224\245\304\246\003&Jrk\026\005\212%Q\274+\336\215\336\216\264(]\274\033<\253\035[B\202\370\260\251y\323t3\317\006>\243r\005\204\315\315'\200R\352<\031R\274*\336\032\321fj\332W=\204\340<\321\2355\267\223\025\007\243\035X]f\234W\325\005\275\213r\246u\213\244lI\225\233y0\316\213\361\353\360\306\204\341\022v\363\t\340\244yT\347\275\370uN\033/\314\034\271\371\004`\322?o\352\327\351\341\352\342Fw\363\007 G\177"
+	.ascii	"mx.x.\326\247\2719zEZ\031\264\262\247\247\023\253\310\223\230"
+	.ascii	"9<a\272\242`\335\374\001t\245H\301ca\303v\024\nD\264\332`:6\035"
+	.string	"9x+\316c\241\023\244\256\351\203\347\304\343V\203\212\f\317\211\247\342$\023\303\205\0205&\240i\222\345\346\017 \331\324\304|\222\303\262\324\364&\345\216\267\304[\342m\336\327\223\2309;5p\240\311\272\371\002 \213\3638\274m\303v\224\365z\212K\322\365\203\303J\224\333\335y\273\207\f\325\362\306\2348\251\2668sP9>\352\242\2227\243rn\031f\013\242e\315\315\027@\226\235\335\211\365\365\364\005\306YC\252\255\f\0336g\2036-\220\222)\016Hr\357*\016=1zt\001A\335\034m\306\351a\265\274\371uh\233\377:\274%sR=Pf\232&\312\233\321\272\234C\003\217\n.\213\2127:\272\020\322\276\304\331\201\232\362jq67\2072m\330\216B\273<1q\343\3611\345\006#\315Q&n\363aD\214\tf\244j\207\2173gN,\033\266\243|jv\315\256\275\2538d9Eh\334\335\374"
+	.string	"`\241r\250\334Yf\303v\224\206\257'%l\232{Wq\300L\312\212\270\001C\206L\326\242W\354\255Uc\207\371\224DFP\0208%7\037"
+	.string	"F\364\217\212Y\242b\360\214\254\244\334Q\027\320\224\264\332\2008\223r\272\371"
+	.string	"\300\322?\032\207\306\241`r\223rO\251@\265cN\217\312\0257i7\243`"
+	.ascii	"0\205\005\013\352\345\001U\312M\265C\367\304c\255\213\n\022\250"
+	.ascii	"\215zA\341T@\301Hr\363\033\236\202\245\b\234\233\017\200\024"
+	.ascii	"\372\366\n[\232$\312\005\3152\307D\271\240Z\022\300\3664$I\323"
+	.ascii	"\rmC\273\330%\312\005\335\302t\001\306F\347kPF_\0037}\r\272\350"
+	.ascii	"k\300\246\257\201\232\376\321%\272D\327\200RH\351\270\b\343\305"
+	.ascii	"\334RZ8\320\241\203!\243\271\206\252I\315\305}\2719\215G\234"
+	.ascii	"0\256\233\257\201R\377\003\364\f\025C\315\26029\201-9L4\273D"
+	.ascii	"\317\320\262\236\272\033J6rF\315\314tn\334\370\302t\3635\b\242"
+	.ascii	"\257\201\226\376\321'K\364\tJfw\262\002a\2300\267T\025\007\275"
+	.ascii	"7eN\311\233\253\364\220t\311\342v\3635x\322\377\3211\273D\251"
+	.ascii	"\240PnA\240TP1t\212\005L{/\335\330\241z\342\261\326\334{\023"
+	.ascii	"u\3501\263bI\225\234\177T\312\321)?\032\206\251\254Y\b\366n\022"
+	.ascii	"\361\246\310\327\315h\024\020G\2458\301\361\272y\347\214~\006"
+	.ascii	"X4\217\025B\237\301\030\030\330\226+,.\302n~\006J\364\217~\375"
+	.ascii	"_h\223(\355\004\316\315\353\346\036iSE\330n~\0069\320#G\275\320"
+	.ascii	"#\250U\n)t\300\240T1\267\224\025\007\275\"-\366\233\233\321."
+	.ascii	"t\t\252\004M\202\"\311 J\037\365aQ G\213,Q \250\017\016U\233"
+	.ascii	"\n\004#[=L\025R\346\334\214&Q\"\350\020T\b\032\004\2035\032\315"
+	.ascii	"\201r\241>\364vZr\200\275\361\303\t\333\315=\224>f\252`H\271"
+	.ascii	"\371\030\204Ay\240;\320\255\236\222r+\201\360\025E\325D\271\354"
+	.ascii	"\022\345\201\352h\342\211\302\304\314\216\234\217\001\234>\006"
+	.ascii	"i\032\335\272\030\230m\300S[\261\321\320\254\243[?\212\003\325"
+	.ascii	"\352\301%I\"\346f\353d\207\320 +\204Z9\020G\263v\312\230L\242"
+	.ascii	"\256\320\253\223)+\001\355\275\345v\266\245\25288\201H\321\341"
+	.ascii	"v\3631h\262\346g\234S\3169\307.\3175\250\025\b\246\275\324\005"
+	.ascii	"\202\221\270\263K\233)37\333\340\265\240A6v\3631H\352\030\347"
+	.ascii	"\035\252Df\t\335_o(P\025\026\216\353\001I\2720W\240S\026\256"
+	.ascii	"\nh7\225\235a\306@\231\320\335S\n\332;\207[r\006Z\003\245\201"
+	.ascii	"\312@a\240Uv\211\306@\235~\3129\347\234\b\215\2016\265\361\210"
+	.ascii	"\251\033\002\327\313\347\335\321X\300\344D\001'r\350\024\312"
+	.ascii	"\002\225\262\200\311i"
+	.ascii	"\347\245\021\273f\027J\205\276\260KtjL\203\017\2342M'h\376Q)"
+	.ascii	"4\352\214\205\r\0257\243.\254\030\227\0269n>\006R\372G\237\354"
+	.ascii	"\022\205\372QQD\216\220\233\321\026G\263B\211E\213\233_\367+"
+	.ascii	"\377ur\f4&m7\037\003(}\fT\350o\260CS\3500\314\033n7\177\003\033"
+	.ascii	"\375\rL\375\rf\3647\304\351op\323?\252\204n166n7\377\350\266"
+	.ascii	"f7\256\355\211\351\346o`\323Wi\207P\016V\b=\337\234p~\274\316"
+	.ascii	"v\220\335\374\323\356\277\316\005|\274\221\335\234\233\227\313"
+	.ascii	"\220$\324\315?\335\234e~\235\036\031!T\236\334\374\263\r\331"
+	.ascii	"\035\033\0327\237u:\305\006+\033\354\334(\303\262\301\346g\335"
+	.ascii	"\177\202\271EV\270\223\343\346f\314\005\304O6nX\230`7\177C\222"
+	.ascii	"\270\237\314\270S\r\207\252M5\002\022&+\016x\266\244\210\242"
+	.ascii	"r\263\322*J\024\213\233\3173\347\334\231\346\327\321Q{\212\263"
+	.ascii	"\272\371\033\204\350\237h\376\353\354p}\t\202\344\346k\177\005"
+	.ascii	"=\345~\232\371ux_RMTn\376\206\036"
+	.string	"\372'\231\263\314\257\203\345tQ[q\3637\340\320?\307\374\3279\201\031\034Kn>\305\350\024\033\2506\320\221\013C\363#\314O1RB\360d\243*\315\315'\030\020?\303\334!c\\\270\334\354c\205\320_P\347\305\213\221\0326\213\224\270'.ooFV\3700\3731w\363/x\322\326v\246]-D\232\314]e\305\001\355\222\344Qv\363/H\262\261\235\\2\330{\247\330'\310\020yc\2428\262\203\t\227\254\005\313)\201\033\202\245E\313\211\245\305g.N\213\251\233\177\001\024\026,g\032\030N\003\007\213\2249kkg\231\220\023j\334\360\232;;;\323n$w\225\025\007\036\325\215f\033\332\317\264\034\007&\206\314\315\257\313Z\376\353\240nQq\354n\276\005^\254X9\313\354\002\210\260H\362\234\224Z\f9\227vy\2261IS\316\270\371u\326\354\277\316\271\325\346\214\331Y\225*v\311]U\305\301"
+	.ascii	"s\342\340\370\032\033\223\353\261x\263\264t%E\312\211\245w\227"
+	.ascii	"$\034\263: 7\337\002*11\240\315\224\006,\331\242\231\004\356"
+	.ascii	"\346[\220\",l\r\272\235D\365\270\371\025\300\321\377\251T\346"
+	.ascii	"+\275\026_\206xE\261\301\025F\314\327\327\351D39e\355\027\006"
+	.ascii	"`Rd\307\234\346\336V\034\374dq\241\002\316\331\204\307\246\315"
+	.ascii	"\fN\206*\323\343\351\346W\300\246\377\263\253\353\364z@\025\220"
+	.ascii	"ro\261%\367\266\342\200\227%\016\215\252s\311\211c\215\034 D"
+	.ascii	"=O6\312\256\334\374\n\324\364\177&\261\3133"
+	.string	"\311\031\225\225\302\266\024\017\224/,\257\036&\026++7\277\002\345\221#'\226\005a\213\232\024\207W\360C\337.\261g\221\333\345Y\004w!Rr)\rmQK\301\301+\300\241\3773y\273<\223'\324\003\270\2626U\007`SZmt\330\300\304X\335\374\n\244\204\3748\007\026r\262P\202&\267\346cc\f\n\2719@\200hX\262\245\301\230\304\325\335|\n\302\350\377\364q\033\353\317H,:/\364\200\024\256\277\243\342\360\247\352XH\341\267\"\235\220\372xR\244\317\205\036>\030\207\310c\232B\340HM!\303ZL\221\303\013F\022\301bzD\"!\177.\364pdT\217i\3523\022w.\364\300s\241\207\023\352\207\023*\361W4\032\242pbDz\204\204L\325^\322\321\030bMQ\330\t\006\241\200\034\n\371\212\030.\364\360!U\221\326_Z\324\203\201\370\003\n\327\337\321\007\344:L\341\003R\321\350"
+	.string	"'\220\212C\342\001@\020\301'\302\b'>\244A$\"\2608\374\240\"\221>|0aT\205\253\261\310+\372\245\304\274\"\213F\340Y\264\026\207*\021\275\320\003P\365\001\213\214\212C\021\300\021\353\2608\004B\246\353oEah\035\026M\b\016\217\274\013= \201\026 \201#\220?\037P\375"
+	.string	"\\\221H\"\b\222\220\"\221\204\214\206%~E\f\220%\230 \"Ej"
+	.string	"y4\332\271\320CZ\364C\026\215\3035E^@J`\035\026M"
+	.ascii	"\002\177\275\013= \035\r?\244*\022\322\321\260\207H$a\347B\017"
+	.ascii	"G_\272\376T\242Q]\005`\001\022&\240\360aM\215\324\337\252\002"
+	.ascii	"\320H\f\221\252\306\020?A\022\220?\016\244A\343\221:\374\t\245"
+	.ascii	"\276\024\250\"\031QX\221\216\305\241\317z\241\207\017E\343\321"
+	.ascii	"\221\021X\302\"}%\220\302\035\241EZ$\272ZH\203\306\243\235\365"
+	.ascii	"B\017\307\241\272\"\203)\361\203q\250A5\022\215\300\023\351C"
+	.ascii	"\246CH\325H\004\246G\244O\322\321\030\302\302\205\n\326\364"
+	.string	"\350W\314F\342\360\350\363\337\244\2431D\320z\241\007\243\343\007\243\243\020\260\210$\001\236b\321=\221>\243c\317\352+\032\035\317\242\321\021\247+\f\221\031\211L\325`\360\307K:\032\201Y]\217\370>I\352\212\034\032\245#|C\301\224\027L\221H\031\311\373o\375\005}FG\017=_\272\376\210\307\243\224\304\232\"\323\021FG\013\220\301TU\323\242T\025\261\246F\032\220@* \177'@`M\215\200\210D\022\202\324_J\f\321#\022I\370YS\024\212\2120\240\246\3074M\241'5*\376\204@\240\244\242\341j\274@\260HB\211\037R\350\267\376J\b\016\211\277\r \213\303\337Z4\206P\221\220\305\364\202t\035\252&xN\300\300\b\021\021\210@\360\227\252;\027\220<H\324\302\005\020\037x\240@\b\022\034@!\204\016P\320\004N\f%\020,\222\220\256\277\340\220\370+A\204A/\351\247\252$ 3"
+	.string	"\203Rd\252\366X8a\210hT\327\2421\204\006B\027\261\026SUE\n\261\246F\032\016\034\252i15\322\007A\204\003\2100\302\t\336GP@\007\n\350"
+	.string	"\375\b\n"
+	.string	"\001B\001\"\200\320\027\001\004^\327u]S_\0324\236\220\252H\304\341\257\310gU\323\025\370S\177B\240o5\032SHU do\275\320\303\007\3430I]\323\243\224\230\256\031,\250\200\374\235PD*\352I}\253j\024\201a\270sD\036!\217FA\353O\r\"\375R\360\2350\246\240\002\360GL\001\003rU\215G\236\025\204\276t\375\005\217H\276!\342o\250\246H\241\325\347\301\007+\n\024\254kQ\032\364\255\031.\364P4\016\177"
+	.string	"@\"\371\204\300u(\"X$\201H4\252B\026\326\364\310\370\033\002\002\177;:\251\3723\021T\177@\340\257g]}EiP\303\205\036*@\242H>\344\321P%\201\004\016\217~\305\244\022\206L\374TlT\323\017"
+	.ascii	"\201?\336\205\036\322 \322:\\\211\277\013\210F\n\254\304\337"
+	.ascii	"O\257\250\376R\242OMK\030\205<\305\341\211\337\221\257'\205\243"
+	.ascii	"!\021\350;\361;\352\255\305\024\210L\203\276\023\277#\240\365"
+	.ascii	"B\017\310\n\326\236\224\210\244f\244\017\231\022\221F\364\244"
+	.ascii	"D\244\021\306\022j\212\354\231\370%aM$\032\325,\004\256\303\343"
+	.ascii	"\271\366\234p\"}\274\265\210d\f\261c,\241\246(\244H$\355\223"
+	.ascii	"\006\215'\350\004S\244\232\226HU\037\322g\342\227$t\241\007\244"
+	.ascii	"\343\221\317\250&\031\001\201\277\002\244\276\021\035\204\320"
+	.ascii	"\201\bH\307#\241\242q\270\"\021\215\310T\335A\372V\"\0222\035"
+	.ascii	"\261\246% \035\217.\244( \035\217x\320\340\360\310\203D\246@"
+	.ascii	"\243z\364\005\207\307\240\242q\270\026\323\022\251z\244 \003"
+	.ascii	"_\272\376\322\240"
+	.string	"\257\250\310\230\252\360[}I?\023\277\"\222\032\200\013=\030\325$\243\017H\n\214j\222QO\352S\215\310b\212\354\025\215\206\304\337\216\232\302\220\370\013\261\026\323\243\264\204\361\004\243\232d\224\301\221\261\230\006}\300b\022\262\350H\324\3511i\005R\221E>\241\321PH4\032!\340;W\020\252\340\301\007\276\024\211\324K\221H>\343\312\343\201\317\002\b\020\036\370V\020^\360\300\267\026\031\221D\251O\005`*\faT\223\214\204L\030\211EjZ\002\003*"
+	.string	"S!\320g\004\352\321\207g\342\227\3443\372\214j\222\321\217\tc\26084\321[A\350K\211\307\243\037R\205_z\364\255EE\276bR0h-\"\031\213I\301\237\013=\244\252\021\350\003\026}"
+	.ascii	"\022\205\240 E\"\376J\370\212\306\341\nLU\325\b\364iXw\220\276"
+	.ascii	"\236\365B\017\301\341\221\250\004\213\364\215\020\034\036Q\021"
+	.ascii	"\326\004\033\034\036\261\211_\322\316\nB_\321\221\330\263\202"
+	.ascii	"\260WTd\\\221\200>!p5\026-\244\307\244\325\247\246+qX\344\013"
+	.ascii	"Z\213)PME\254\305\241Q\304\021)X\034r \003\217\211\237\007\216"
+	.string	"\220P\b\016\217\275\242q\270\376\220\305\364xd\f\021\034\212X\177)\224\020*\016OXI\b\016\217@)\321\250H\0021-\221\022\177V`ZT$\264\252\351\361D\352[\211\303\325W4\2560T\215B\"\022$0\024\207\277\t\250\306\365\247\246Gj\272\016/\030\207\353o\304\211\0371\035aa\025\032\rS\016\240p\244\246kPh\204\211_R\320:<\032Z\200\230\002\201$\244\353O\355\005\215\200\202D\243\020\231\252\302\325\267\026\207\306\343\232\"\211\322\243\341\272\223\364#\246A\236\224hT\374]H\327\237\352\023J}#\204\310\237\032\"8<ZHR\323\022F`\252\366L\374\222|\353\360hH\364\t\221?\025\370s\241\0075=1<\372\260\n\215\206\304\"\n|\326\013=\254H\307\025\311\350;2q\374\200T\323\022C5\230\301\352\343!\215~$\214C\264DZB\272\376F\364\020\215@\343jTE"
+	.string	"\025\215C\244\232\226(\232pdB\204j\\\215GAG&D\004S`1\tY\324@\212D\352\255F!\262\204\025\251\"A E\"\371\224H\2038E\"\3766\260\246\310\242\"\f\244\304\240\t\304\337:4\032\0061\024\207G<)q]\215\252p=\361;\342Y}\"\200X\213C$\035,\376\216\216\214\300\342\360h\347\302\f7\036S\365\303j4\252\037x\220\276\020G\351\212LB\366N\244\301\242\t\301\341\361gDZb\270\002\177AFH)\244\301\035$p\270\"\207\353oE\372T@\376\326\037!p\035\232@\001i\024!BJ\034\026\031U\021\351\372S\207T"
+	.ascii	"\032\211@5-a\364!\035\201>\351\321\220D\n\374\251\0230*\016\217"
+	.ascii	"T\022\212\030PS\023\306#\206\3257\302Z\034\"\361\236\200\004"
+	.ascii	"\204\310@\003\027\230\200\006z0\032\026\025\215\300\017\300\242"
+	.ascii	"\017\305\341\357\350\003PE~\360\200!\r\032\217|jJD\n\246B \262"
+	.ascii	"\247\376\204\300\254\246\303\242\341ZL\203&\004\325\2371\205"
+	.ascii	"\237\377:\005\317\311i\346\013\023\"\032\305\023\b\320=\351P"
+	.ascii	"\036"
+	.string	"\231\322%F3\361\252\2444\313\250nV~\355\255\354\241I\200\250@\323J\274\253\334\305\\\341\245\367\t\205_p\031\221r\307\302\211\311\f\031\313\233\361\344<I\356\275\201z\344\330,\307n~\207\037\332\215\033\036\234\037;VPE\316\354\316\203\363+g\2123l\276\334\314{\243\341P\001\003s3\257\371+\\\334\266\260:\244P^\250R\342\242\216\307\003{\211\303\365\205M\226\023\026\007\305\032^\020\364\305\0313X\350\3164\2613o\344\250\341\021!\223\245\343\211\311\353\342\261\322BF\334\315\350\222\216\215\217\271\323\211\0261mg\224;N\230\206p9sz5eI~\231\211*\213;3ws\2300\2742_\034xb\316+C\346\246\365\270+Cf\314\316\2132Q\256\234=\340\274\260R\2005\274/\274/\2748\035\245\2707gq\274\037\\\230(\335\334\374\002\210\321oo<\270[X\332\233i\357\253%\006"
+	.ascii	"\013\263\203\321\334U08\300\361t\220\320J\202\226\306k;\022\225"
+	.ascii	"c\313\315/\200\024^\027\374\206\256\rQs\302\005e\236W\310\224"
+	.ascii	"\270\330N\247\236*kp\242\266d\"M\314\344\224\321\2026\253\304"
+	.ascii	"\2359\311\302\3337K-\206\023,<\026\367\212\215]\363\312Y\326"
+	.ascii	"d\013\263b\355\334ae\210\324\330\315\267K\236\332\211E\205\006"
+	.ascii	"\327\326\315<4\036\332Yf\267\024\223\027\005\350\322?\357\354"
+	.ascii	"D\3614\343\214\251L\331\023\025\365#\253\214\351D\223\346\206"
+	.ascii	"\233e\206\226\250#RDbD\244\305 \214\304\220R\310\251\031\322"
+	.ascii	"\2449S\025@@`P\"\226)\323&\037\023\200C\213\253\364\201\244&"
+	.ascii	"\235S3#\"\n\222\244\240F\235\016(H\f\334\0318\260w\302\247\301"
+	.ascii	"I\271\274\036\232NF\033\312\b\205H{t\003\261\255\374i\302\323"
+	.ascii	"\023\371[\023\250\024\250(\243=p\271\255\362E]e-=\030\241\023"
+	.ascii	"I1\275\213\227+)\027#\342\372\003\305\365%\036\305\203\033\313"
+	.ascii	"Z\002\035\254\224\2734[\026&\370\241\350;\022\210\371\f$P5\242"
+	.ascii	"\215\237\230@\320\371L)\315\244\036\312+\211\306xj\223\001\230"
+	.ascii	"&Nz\203<nk \364\357\207.\"p\211\020J\213\002V\323\2006=\214\227"
+	.ascii	"q\263\203\362\265\240\234'\272\241\377\337\027\301\270{\231\205"
+	.ascii	"\337\355\001\300Xh\"\270\017\330\353u\200\304\364z\b\323\226"
+	.ascii	"\205\025\005f<\331:\324\257Zf\236n\203\356o\177\352/\247\332"
+	.ascii	"\022\001\227\230\356\207\251\364>\263\351\2052\026=\255\226\376"
+	.ascii	"\374<dYU6\b\0029\225E\3160\242\252\301\021\273-\346\375=\002"
+	.ascii	"O\020\020\311\333\317\317\003E(:\320,\301\027m\343\351Fz\337"
+	.ascii	"\221\223\006.\333\325 \245t]\202\013\377l\007\024-\232W\034\""
+	.ascii	"\326X]\352\273\020\031\223n|\020\256\320\013\n/+\013\\\223'\366"
+	.ascii	"X\364\025_\325\202\377\322\021-F\326\350+\224\021\035\362\247"
+	.ascii	"\227\211(\264\237\214&\367\356W[AeR*\316\323\242z\311\004\036"
+	.ascii	"Q=\343T\365\3168C<;\0211\325\351\255]Q\345\321St\243\255\325"
+	.ascii	"\203\207%\r3\\@\356\347e\f\233\004\262\212\267( (X\213\220\357"
+	.ascii	"O$\fh\217\313nG\325!"
+	.string	"`\310\3112y\214\327\347MK\f\332p>&U.\372B\252\310\260\007\225\342:_\316$\326d\223\f\027\253\202\262cA\"+\226N9\232=\260\013\322o\r\310$\246\241\316R\271o\202\242\321r]\232\005\327\262d\326 \243\325Bg\314\013\246\023\353\tM\017\346\316\256^\266\255\247/\243\r\350d\350\307?=\256\274\362|/\203UL\023(h\236rP\"\274\260~`i#\262\223\024\233\020r\301\377J OY\021\031a'\225\353\"S\b\\\247\006\360z\0026x\230@\030\203\320\214\203\324Z\013~h\\1d\233\231e\021UXD\317\0029\313\266G[\277L\234\252\265Z\3105'\255\351j\324\252\320\366Yx?2\024N\225\201EC\004\320\020\243\376xqC\261\206\207b\225\005\210\233\217\306\200L\270K\321\024 m|\311\\g!\026\277bf\b4\022\213z\373\374\366\305&x\307q\234\373\321\212"
+	.ascii	"\303e\372;\fIM\030\023\364\270"
+	.string	"\372\300q\026\360\272\310\240i\215\037\355#u\203W\255P\376\031C1\235\355\237\215\234FCj6\330\321\306\272"
+	.string	"\177(/\355\207x.\305\206E\f\375\216\037\"4\253\006\325j\325\256i.?E\334\374T%j\033+a\025\006\024\241\f\334\200\025\300!\2443\346\216\267\007\303\273\200A!\224o:\240<\234\372\273\275\020\021\351u\275]\3117h\274\205q\177PX\232A\224\f.!\232\317\243\033]\217\tw\360q\204W[\2527\335\027\222\205o`7]*\366\245&\277\211\002'a+\033\252\211v#3'\261^\033\273x\207\274\005\t\n5ZHD\311\2431\230nU\245\313@\201\365\372\267\233;Z\030\234\035m\227+\274_\373\021\234\272\213\036\373\201\256\353YCW\n\261\r\026/\300' b3\214\347\355\250\205Q\020\016\013\013z%\263}\231\036\256\231\330*\365\013\017\267\275\235\264\312(\n-\3677\206My\030\273\023n\025PS\217\311(R\304\311\306L#q\3463`\260\031\351f3\021\202\245sVc!\251"
+	.string	"\221\007rp\203%q9\345\\X\335\341\341\302\230s\361M\367\320[d\260\207Q\213\177\005\367\213*\343*\331\364\266\274$H2\360\256>n\016\200\340}3\242\233\017\307\263\016\001\247\020\245\226~\2549JO14\257:\216\224o."
+	.string	"\300\212\277\374\303\r<\355`5+\2669\020\356/\340\337\253Q\237\036\253\376\236\312\241\340\001\203\374UD\320\301\017\303\033F\003\017\r\0337 A\0346\024\350Q?\317\227pu\326e\330"
+	.ascii	"P\213:\036\027\250\037\332\336\337\0366\363a\317\370\334\034"
+	.ascii	"\334\226"
+	.string	";$\203\272\265\315m\025\301\021\265\2066\025\373\t\344\212\303\323\001\005\316c\262T\327J\350/\347\374d@xT?\007\252\036=\030U|\213\350\346d\374\2550E\323\236\356\270,\300\205\020\243\261H\001\0210\364\272\241*Q\004/\257\350\0022'\326\377\250\304\315\365@\016\3521\272q\262\317\361\220\222\245\234\254\377\376\245\371\372\224 \364A\205\345a:\364\343\272\325^\314\347\340\270,\377\235IIFN\364\300\020\273W>\bkNj=;\233\203\201\031\344\277\016;\323D\245\006d\356F\033\302Z\030q\t\225E\004?\233\361\375WE\356/\373\307\272\214\3406\307jA\233\217\235\016H?\356|L\025E\"\0277;\302~\233\331\325?\261.\377Z\036\bq\253\246\203\376\314\257\221*UW\006cf\254\353\237J\004\001K\331\275\372\356G\202a\327rXrX\313w\302\257\2678\212\204\367\3577_s\330\251\313"
+	.string	"\232\034\320\354w%ko"
+	.string	"\254\303\304>\334\323\337\313\027\204\362?\213P\2730\221\222v\210\202Q\3415\213g\273\367K\214\210\240\212\351\320`\324,\305,\261R\227\224\252\273\347\277zI\235k\355\341\357\367\332\343\177\026\342\3074\006\301\256\r\370r\003M\017\266^\270\025Uukj\205\313\365\313f\246\2402\357<\025\346\203\312\004\200\2648}\276\3242\375\013B5,\362\250\207\2267\002\b\211\306\372\263\3466\021\371\206\236\222\023vt\0364\235\035\365\244\206S\273 \337ff.?\327\2047\377U\341)\206%\312\315\204\270>eR\267\221\022q\323Up\275\364\254\313G\236 \350\2264[\262\322p\245]\352\030\363\202C\351J\032\202\\L?\030B\317\201\203\027\212\302\334f\031\215\004\266\017\232t\016T\323\"\304\226^\351\301_\0307\336\230\314U\313%\360\373D1."
+	.ascii	"U\024\350%\224\206\344A\023J\032\223\210}\301{~\230\225!\007"
+	.ascii	"6+>,\205\276\rr\267\364\031\216\215\211\336-p\025_\302Qj2\037"
+	.ascii	"\f\fog\233t\256\322\235'\347\216\224^\211\265\"\336\3302\367"
+	.ascii	"\247\373W\332\304\362o\277F\376\177\265\215\343oR\215T\243\332"
+	.ascii	"j6&\023\034C\034u\223\017\025\224\217<\236\315D\351D\354V\372"
+	.ascii	"\036\212\227\276w\216\257\315\347\200\326\037dfw\2363\016\367"
+	.ascii	"\264\006%\332\032\241\214/\245e\001\375#\236\364i\346\326_\373"
+	.ascii	"\331^\341\002\346\301m\362G\317\366I\220&\201\240{\253\027\033"
+	.ascii	"\025P\022\324\2110\332 \347\025\n\273Y\021$\352\355\377\276!"
+	.ascii	"\226\006\t>\256\370\376\224\253\212\005\026O\002\361\221\360"
+	.ascii	"p\353V\006\310\3204\360h\216Yv4\253Q\200d\307\206\270\005\207"
+	.ascii	"[\215\216\250b'\357Apb\250\002\325\342\300\232\225(0E\353\215"
+	.ascii	"bX\0266oc@\370C\332\315qIA\001\3420\213\223\274h\371\016I\311"
+	.ascii	"Y=m^\237\003"
+	.string	"\366\301\362W]L\002\360\270OT\277\256m0\324y\205\037$,\243\300&.t\374YsqS\005\232\307\245\270\367Ki\350\263\317hr\020\025\324\352\361;\350\030\310\373\017\301@\373*\325%\2532 \340\203\350\305\236\326\034{\033\200\f\267\004Ss\215d\347\326\300aH\316\242r\207\326\002\337\326!\322(\027\336\343\002\023\025\255\203|Y\357\025G\234<\331q\262\361\377\245Z\"\007\310\276\226\303\037\317g\244GB\023\220\346L\321x>D\250\b\266.Ae\341\331!U6\316\265\304\213\253\325,\371\250\277\301\311\313\236\005\\\004o\360\252\004\314\231\223gE\\\252+\236\214\005C\342Q\241\013\250N\225P$\341\212CMu\323\304\223\220\2431(\2359\321\f\3579@Y>*)k6\326\255r\220\030]\232Z\254\247\020\220\244-\335\022\3262z\331\210)\013J\336,H8S\225kI@9\025\365\007W\365"
+	.string	"0I&H\350\325&r\327\276\217WC5B\316\342t\251\220\267\372\n\251\304\304(\303\223#^\017\365\022$\310\b:@\324<\276\n\034\025\256\260\365\032$\372_\377;_g\350\021\001"
+	.string	"\314V\3169\022\370"
+	.ascii	"Pf\263\374\030\2155\211\303\301(\351\333\n\254(C\007\351\241"
+	.ascii	"0):\034?k\2234\204p\356W\f2\233W\177\356\323\273\343\203\030"
+	.ascii	"\034'`\217r\220\b\320\033\177`S\342\373\373-\001+\377\367o\271"
+	.ascii	"\032N\031\036\021\310\177\234\022\"Q%5\2012Z<d\237$%\245\207"
+	.ascii	"\317=N\367\370K\362\027Y\bH\016\327\265\326!\203\300\245\b^b"
+	.ascii	"\206\344QJ\324\007\314PR\030?\032JH\343\242\205\314\201\372b"
+	.ascii	"\205\203\016\232\356T\324&I\222\334[\b\202~.C"
+	.string	"\201\037\3171\031\375#\333\322F/\2679\030]\316\305\301W\377L\231dUE_\0050\036\256\"\206V\236\305T\337\376\246\270-\377oU\303\003>\214\331\243\021\037\261\275\033,\203\312z8\343r\035\271,\302\372\223\336\261\346\224\033\\\022F\372\220`VM=^\r2\364L\346e;\347\036\021E\240\310D\336\215\026p\325\\\311\233\272\320\263\270\357\036T\026\3647\275\001\302\204\252\256j\371E\025z]\214\256\355\b\373l\013\371\301\254\247\315\375P?\007\344\221R@\325\316\251\016\033\305\360\256\225\343\264\024G\234\264Q\200u/\027\235\001\215\177\322\252\274%A\300u\242\207.\366\347<\020\233\325\274\242\273\037L(\353\200\260IU\327\311\035 s\370\220Y\312\310d\222\033\222\255\233\"JxT\200JM/\340{\226W>\2427\372j\033\021\336\024Fo6\332\004\222\202\373\003:&\324\214\231\212\234\266\2736\f\357"
+	.ascii	"RX\337\243's\216\230\347\250\377d;\344\241\343\240\372I3\324"
+	.ascii	"H,\373}\234\346\006-!8\360\264\004\360\330\353\376\301f\331\243"
+	.ascii	"q\326"
+	.ascii	"L1E\021Z"
+	.string	"\365E\002\304>\213\232\307\305\231\363\016\032\t\256<K0Zf\323\367y\320\223\246I`\247\241L\206eW#Er\177T\026\344Q\362\366@\346\331&+C\271`\016\001r\266\334\270~\025jf\221\313\2163\371\254(Jh\247m*\352\310\026\301\035R\001\201\235\244\004`zK\025?\221h\t-4\f\326C4\n\007\370\037-\035pB>\250\250\036\365\353\260\321\366\201&;xD\225\255\256d\254l\277\252\260U\215\002\300\004\254\307\352-\350\3235\226\2627;\214D\300\205\370\037\374\355R\332\352Bz\273\361\266\370\305\020\037\020n!\213R\030\374C\356\313'X0P\346\0055\351gw\366)\fvx\231\231P\001>|\\\254\200\024\372Jn\212sM\003\nQT\235d/ d\234\240\370A(\251\024E\311L[t\266\206\252\336\234\262n=\246\340\370\230\217\255w\264\350\315\244\177\237\230\314\205\345\216\256k"
+	.string	"\254+\3506C\030\033\006L\242bs;"
+	.string	"\256g\345\363\006:\230\211{\312\343\3011*=\340OD\020*B\322\331E\322!\352.v\304\322%\2063\257\2645y\330\314\372\002!\";V"
+	.ascii	"\020m\212\257\373\tE\221\214\207\037\3019~8\302\225\026 \351"
+	.ascii	"\246\027\250\2117\274O+i\225\315Z\023`\307/\241\206\276\250\231"
+	.ascii	"4\234\332\334\321^\006\004\373\231\025\307>\001\3660\bB\231\302"
+	.ascii	"k\302\256z\257\360\251\026\362[\205\305\265\232P\346WX\360\036"
+	.ascii	"\203\304\027B\215\273]\263f\340\302\340$"
+	.string	"@K\240I\264\267\235\036c\310\006\033.\030R\210G\236O\001\225\233\300\3462\013\031\354\327\302]\342\362\213\241\200\350\b\206\347\222\026\313\250\237\256\030\260g\243{@\f\233hO\3275\366\235\372\212s\376o*,\232\357\256C\304\2768\257\271\272\330\325\271\371G\217_TU\027\300\357\326\254;C\352\rq\035|L\206Z\272\317\200u}\326\304\2235\272\225\311\034N\243m\007\305o\317\263\354\372\307\340\233\330\277\b\341\036O\374\374'H\316\224\r\007\361r\222\364\306\317\241\216\322\230\033~_n\360\232\335\360\017\344\226\225\006s\032\333z\223\220\265\013\3562\364h\364\216\200\334\314\365-\350\263\277\330s\226#[\203w\324i\376n\224\366\b\370\355\032N\3338 \234\225J\333\362\304?V][\037s\266M\233\274\037]\272<\200\233<\377\026o\366\203{\311\374\033\351\f\352Pb\336\341p\204Y\207f\256\360}\030\376"
+	.ascii	"\345\001\364\363\032y\206!\3726;\310\264mV\256\231?\006\312\261"
+	.ascii	"w\323\237!\336\201\361\fG'\222G8\341\340\317\351\323\366\301"
+	.ascii	"\021\357\244B\273\001\b9\030\377\340\350\237\373\321\034\326"
+	.ascii	"e5\214+\037Y6t\005"
+	.text
+	.section	.gnu.lto_.symtab.a9ff12e8bd163b9c,"e",@progbits
+	.string	"getCurrentPidProfileIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\002"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\016"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\002"
+	.string	""
+	.string	"getCurrentControlRateProfileIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\002"
+	.string	""
+	.string	"getCurrentMinthrottle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\002"
+	.string	""
+	.string	"resetConfigs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\002"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\002"
+	.string	""
+	.string	"activateConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\002"
+	.string	""
+	.string	"validateAndFixGyroConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\002"
+	.string	""
+	.string	"readEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\002"
+	.string	""
+	.string	"writeEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\002"
+	.string	""
+	.string	"resetEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\002"
+	.string	""
+	.string	"ensureEEPROMContainsValidData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\002"
+	.string	""
+	.string	"saveConfigAndNotify"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\002"
+	.string	""
+	.string	"changePidProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\002"
+	.string	""
+	.string	"beeperOffSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\002"
+	.string	""
+	.string	"beeperOffSetAll"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\002"
+	.string	""
+	.string	"beeperOffClear"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\002"
+	.string	""
+	.string	"beeperOffClearAll"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\002"
+	.string	""
+	.string	"getBeeperOffMask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\002"
+	.string	""
+	.string	"setBeeperOffMask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\002"
+	.string	""
+	.string	"getPreferredBeeperOffMask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\002"
+	.string	""
+	.string	"setPreferredBeeperOffMask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\002"
+	.string	""
+	.string	"pgResetTemplate_systemConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\002"
+	.string	""
+	.string	"systemConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\003"
+	.string	""
+	.string	"systemConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\016"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\003"
+	.string	""
+	.string	"pgResetTemplate_pilotConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\003"
+	.string	""
+	.string	"pilotConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\003"
+	.string	""
+	.string	"pilotConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\021"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\003"
+	.string	""
+	.string	"pilotConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\021"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\003"
+	.string	""
+	.string	"specialColors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\003"
+	.string	""
+	.string	"modeColors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\003"
+	.string	""
+	.string	"colors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\003"
+	.string	""
+	.string	"inputSource_e"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\003"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\003"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\003"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\002"
+	.string	""
+	.string	"pidProfiles_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\002"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\002"
+	.string	""
+	.string	"throttleCorrectionConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\002"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\002"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\002"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\002"
+	.string	""
+	.string	"mixers"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\002"
+	.string	""
+	.string	"servoMixers"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\002"
+	.string	""
+	.string	"altHoldConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\002"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\002"
+	.string	""
+	.string	"setControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\003"
+	.string	""
+	.string	"pgResetAll"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\003"
+	.string	""
+	.string	"imuConfigure"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\003"
+	.string	""
+	.string	"accInitFilters"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\003"
+	.string	""
+	.string	"setAccelerationTrims"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\003"
+	.string	""
+	.string	"failsafeReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\003"
+	.string	""
+	.string	"gpsUsePIDs"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\003"
+	.string	""
+	.string	"useAdjustmentConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\003"
+	.string	""
+	.string	"useRcControlsConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\003"
+	.string	""
+	.string	"pidInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\003"
+	.string	""
+	.string	"resetAdjustmentStates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\003"
+	.string	""
+	.string	"initRcProcessing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\003"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\003"
+	.string	""
+	.string	"gyroMpuDetectionResult"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\003"
+	.string	""
+	.string	"featureClear"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\003"
+	.string	""
+	.string	"pgResetFn_serialConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\003"
+	.string	""
+	.string	"isSerialConfigValid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\003"
+	.string	""
+	.string	"featureConfigured"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\003"
+	.string	""
+	.string	"featureSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\003"
+	.string	""
+	.string	"pgResetCopy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\003"
+	.string	""
+	.string	"resumeRxSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\003"
+	.string	""
+	.string	"failureMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\003"
+	.string	""
+	.string	"loadEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\003"
+	.string	""
+	.string	"suspendRxSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\003"
+	.string	""
+	.string	"writeConfigToEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\003"
+	.string	""
+	.string	"isEEPROMContentValid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\003"
+	.string	""
+	.string	"beeperConfirmationBeeps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a9ff12e8bd163b9c,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,480 @@
+	.file	"controlrate_profile.c"
+	.section	.gnu.lto_.profile.414b63426f34b377,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.414b63426f34b377,"e",@progbits
+	.string	"(\265/\375 j\265\002"
+	.string	"D\004^"
+	.string	"\n"
+	.string	"\314\216\317\313\r\002\002"
+	.string	"\002"
+	.string	"\001\225\360\310\213\005\004\240\342\234\212\n\003\257\336\231L\004\002\001\002\002\002\003\002\003\005\006\266\275\324\253\007\007\233\236\325\350\004"
+	.string	"\b\234\366\337\350\002\t\n\240\342\234\212\n"
+	.string	"\006"
+	.ascii	"E\t\205\263\212\233\307\271\006]V\200A\033"
+	.text
+	.section	.gnu.lto_.ipa_sra.414b63426f34b377,"e",@progbits
+	.string	"(\265/\375 EU\001"
+	.string	"\2709"
+	.string	"\005"
+	.string	"\001\001\001\002\001\003\006\001\001"
+	.string	"\001\007\002\001\001"
+	.string	""
+	.string	"\001"
+	.string	"\007"
+	.ascii	" \b\237K\200\3055\007\266I\343%\214\r`\001"
+	.text
+	.section	.gnu.lto_.inline.414b63426f34b377,"e",@progbits
+	.string	"(\265/\375`O"
+	.string	"\255\005"
+	.string	"R\210\034'\200\265I\007be\314^g\356E \003ci\322\215\003\r$\202%0}\f\006"
+	.string	"3\212\242\370\365\343\267m\204\020\271S\357P;\024\027\303\326h[x!\334\303u_b\r(\317\036\266\215\330\f\243m\364\214\355\026J\243\002\240\355\362jf\017\003\n\b\034l1\336\374\020\024\220D\036\313\367\317y`\333*\017\021RMR\303?\210\223j\222\006\337>C\033"
+	.string	"\251"
+	.string	"X#G\206\301-\262\"D\300u\005\243\231h\332ze&\305\"V\303\300%\300\301\rr\207\310\322\204\036KW$\204\347\224\261!\330\r\306|\r\b\204\201UuBeV\331\f\273"
+	.ascii	"n"
+	.text
+	.section	.gnu.lto_.jmpfuncs.414b63426f34b377,"e",@progbits
+	.string	"(\265/\375 S\275\001"
+	.string	"t\002G"
+	.string	"\005"
+	.string	"\001\001\003\177\002\006\001\002\001\001\017\177\002\004\177\002\004\003\005\006"
+	.string	"\007\004"
+	.string	""
+	.string	"\001\300\004\001"
+	.string	"\300\004\001\177"
+	.string	"\005"
+	.string	"/\347\367\334Xe\260\232\227m"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.pureconst.414b63426f34b377,"e",@progbits
+	.string	"(\265/\375 \024\241"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"\232\004\001\232\004\003\230\004\006\230\004\007\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.414b63426f34b377,"e",@progbits
+	.string	"(\265/\375 e\345\001"
+	.string	"t\002Y"
+	.string	"\005"
+	.string	"\001\270\006"
+	.string	"\001"
+	.string	""
+	.string	"\001\002\270\006\024\001"
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\002\002\007\001"
+	.string	"\002\006"
+	.string	"\001\002\006\006\007"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b"
+	.ascii	"`\020\3607\247\245\240Z\313\\\246\373\013V\201\001\026"
+	.text
+	.section	.gnu.lto_.lto.414b63426f34b377,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_controlRateProfiles_Registry.17.414b63426f34b377,"e",@progbits
+	.string	"(\265/\375 \240\215\004"
+	.string	"4\bb"
+	.string	""
+	.string	""
+	.string	"2"
+	.string	"\005\001\212\001\202\200\200\374\342\203\246\213\023\001\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\375\007us\307\007uq"
+	.string	"\005\001\006'\001\340\214 ?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"$./src/main/fc/controlrate_profile.c"
+	.string	"\004"
+	.ascii	"*\303\303,:E\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_controlRateProfiles.18.414b63426f34b377,"e",@progbits
+	.string	"(\265/\375`l\001}\017"
+	.string	"\366]jF\360\222(\035\262\266>\026\270\346\214\317\370\037m+\240=\003\337P\004\262\252\312\\h\360\316\t\253e\345\322\300\3775\222\322Z4AkTi\277\f\254\341aQ\3011\314\313\202\246\320|f|U\262j\373do\271S\nU"
+	.string	"P"
+	.string	"["
+	.string	"\006/\302}zN\200\373t\312\356a"
+	.string	"%"
+	.ascii	"\215\224\033\220\335\355\024\205\271K\360\2261\365)5\246|\332"
+	.ascii	"C1\252O\371Y\261!#\340\205\"\033\360PA\273\355Q\345\305\212r"
+	.ascii	"\005\313\365\266\213\304X63^,\217\035\007\273\353\030\342\265"
+	.ascii	"rs\267\215\262-\301\376\211\366\347\263\277\363\332-\037"
+	.string	"\2551:\306\350\003\350\2202S \334\025\021\n\331\035\363\306\313k\267\177;\350\333\f\372\264e\016#\365\232k\344\322@\200\301\201\263\273#\237\216\340\371D \017\262\375h\037\3461\251\317<<\264\013\313\251\261\013\222\230\201\3473\227\372\321\333\256\240f\246e\202{\261*\230\254\204k\017\270b\264\354\312b\006\316\247\331\240\301\217\371\034\270\317\031\246 \261\212\241\243vT\325\302\217\026\213\001\267\016\356\032\365-\031+\206\226z\375\355$.b5\233\231!\253\030\252\266\270\361\021D\325\305\006UQa2F\270@Xa\001\246W0\225N\336\003\022J4!\344Q\t\311\304T\362\276\023\n$\224\3503\361>\324\311\033u\243Rw2\211.t\243\017CW\222\300\336\t\351\353P\236\367u p\2570\237v\371\322\222\203\263R\326T\027wr\350G\365&\216\\\252\212\355\032N\352g\265\233\0171\310\345\356\256\364\202\033"
+	.string	"\2423\341L\213\201\032\3224x7[\346\275,\201\025}\260:Z\331\326L#0-u\031\367UH\265\204\326#\007\341\374T\331"
+	.string	"M\254\222\333\254\256"
+	.string	"\315\342\260\210\262\027\030\222Ua"
+	.ascii	"E\331t\315'"
+	.text
+	.section	.gnu.lto_setControlRateProfile.19.414b63426f34b377,"e",@progbits
+	.string	"(\265/\375`J\001\375\r"
+	.string	"\246Y]E\360\262&\035\002\227\317\355\232\265\021Z\277-t\301A/\337\232\r^\376\330V/\213e\232'\211\017\333\202\241r7'\323\343\326\nQ%\2212\260\016\356\210\t\244z\023F\212*\343K@/hD\215l\"eJ\001I"
+	.string	"C"
+	.string	"O"
+	.string	"\t\026\224>C\262\356\236\300\311\331\375\016X\001\310\241Kv\016\001\034"
+	.string	"\360\270\330\354\330\335LS\274tK\263\344\177HB<\024\313\255\020\327"
+	.string	"\250\026\213\300\356\236\346\351\001u\312\374\220\354\256\323C\201\270\341m?\260\035\355w\b\313\242\n\003O\272T\237\362\221\262\321\222=\354\357\224\nc\337Z}\261\255\364\365\231_3}\020\004(Dvv?\364\360\254\016\254\261\302\366\375\232\177+\177\341\020\032*\027\273\213\035\332+6vx\314v\246\035\006X\250N8V:\376}\245\002g\334\333\360\030\025\340N\203\233\303\ba\020\211\256\303K\377\035\312\334\310\221i\261\032q}\t\0227.?T\355x\033\322"
+	.string	"\025\273\313\300O]\225\301\21794JJ\336;\364S\256\303\0135<L\230\262'w\003\266\240a\2430\202\020a\353@\022D\254\215l&\241\222\310\235L\330:\020g\022\271n\024\265L+\311F!\220(\3238\224l\244\200\343\311\306e]\214\\\206}\246[\253/\016D\350\230\364d\371R\037\3472T\374\030k[\336\333\256\303\323<\034"
+	.string	"\200@tN\254Eg\302\031\323\023\032\266\276V"
+	.ascii	"\227\327pXu\325\022\326\314,\276\376\326\022\366\332\\\0040\236"
+	.ascii	"\204\274b\016\267TQ\206^41\315\2720\006hL\017\312\204J\265\034"
+	.ascii	"Nd0`Q\345\266\253\350\001"
+	.text
+	.section	.gnu.lto_changeControlRateProfile.20.414b63426f34b377,"e",@progbits
+	.string	"(\265/\375`J\001\035\016"
+	.string	"\366\031^E"
+	.string	"\223\223\016\233\257\225\327\205\304\374?\030!\270\003\300\267/\177\275\356\200b\376\354\350\277\375\214\034p*c\013F\004\356@\312\037\264\2242O$\270\235\256\007U(\320\336\213a\336Z\003\315\253\325w\374\275\311\226)\005D"
+	.string	"I"
+	.string	"N"
+	.string	"6'6\212\335\271|\307\266\252\275\240\301\3500\"\307]\022\252\325n\230\300\f"
+	.string	"\\zd\343xX\332\243<\250\270\340\261\273X4\361\321u\344?\346\034p%\345\n\002aw\255\340\n\210;\336\266\001\333\234}S7dz\214 i\313\362\242\371xE\005,;:\350\370\264e\207\237\306\022\366\257\215-\366TOUK\251\276\016\363\2373U\320 p\263\373\241\345cYr\306\t\333\367e\216By\013sd\314\254\330\335\207?\331'ga\n\001_\205|\223C\262\f\001\212\231\317F*\307Q\217\021\222\252\022\350\335F\2237\017R\207\261e\370|\346\345\214G]\272\324X\271\274\244B\310x\021,5*?\256\370\2237\374\205\250@iw\035\3704\257!\361M\227\346L\364\240\311\274\374\351\032\326\300a\303"
+	.string	"\2220a\363\262\n\003\254y\266\221\217\b\327\225\204l^\326\215p\235\007\3424L\023\301@\237\214\004\323\272\020\3469`\256d\3530\217\343:\254\023\222~mlq\204\027\026)~\026\240\266\205\013z\320\217y"
+	.string	"\232\024\254/\246xF_\025\035"
+	.ascii	"\200@tN\254EgB\031\323\0316<\234-\220\305\303\306,\021\254\265"
+	.ascii	"\301\244\026\220\t!l\006\002\003WB^1\207\343j<\356!<\327p\023"
+	.ascii	"-J\020b\266\004\214\t\210p,pb\245\035\225\022\007\356\334\242"
+	.ascii	"\235O"
+	.text
+	.section	.gnu.lto_copyControlRateProfile.21.414b63426f34b377,"e",@progbits
+	.string	"(\265/\375`\377"
+	.string	"5\f"
+	.string	"\306\226Q? Q\233\016D\030@,\244\370\nJ\250\251\\i6\303p\001's]\216\261\316s{\205MLwe=Bc\375\220\223\326\247\022pQ\020y\244"
+	.string	"7Q\250D\341<T@\243\377ndK\231R="
+	.string	"<"
+	.string	">"
+	.string	"\006\214@\362\311\234=\343\341\210}\b\210/E\215\335\265T\304\271GM\316\257.\223\021(z\224p\270\002"
+	.string	"9\"\201\335=\3103\003\350eV\227\335u\216\300\r\367t\333\013lK\260\217\t\366\343j\207\235\351\311I\177\365\217\237\312t\324\264j:5}J4A\032\240bWC\351\306\212L,J\330>\305&\205\036`=\030$\032d\332\007\022p\377\bYwC\274X\261\213\"\037\371 \277`P\221+\215Z\215tY2\245\023u~#]\252z\330\276@\251F\b\221\301\2216\234zU\235b|\035\036\276\322T\001-\342C\024\245\327\177\360@\343;\341e\311\016\275T\217\227\006\252X\3004\036\006\016\260-\363@\301\006\322T|Y\260\016g\223i\037\b\330\226\321:\231\266y\262\313\2726\226\207\223\231`]\032\310\262\024p\366\3014k\3132\315\242\204\335\343\265\303\030\027\"\235z1R\031M\241B\006\031"
+	.string	">\353\341\211\265\365\0348\023\304\302 \025\216\002w\300\230W\355\024\324\"\340\002\212-\021f\231\314u\326\304\3145\334^\026`\021\306"
+	.ascii	"\205\3010}\006\006\356\0220\340P\223\267\253\224\001"
+	.text
+	.section	.gnu.lto_copyControlRateProfile.part.0.28.414b63426f34b377,"e",@progbits
+	.string	"(\265/\375`\206\002\365\022"
+	.string	"V!xH\300RN:\302eL!F\230m\024\267\242\353\2654=\312\003\200V\210!\b\007\023k\267\273g5\266Z\022\326\327\352H\2536\bb\364\316\324\333$\b`@\005\025\t\360\001\203\277\367\374oi;\002\334_[\262\211\334)\005]"
+	.string	"g"
+	.string	"b"
+	.string	"*\355\223\224\331\217r\254\273B3\242v\225\026|\032\005\344\323\276\221m\331\217g\366\216\213\267\375(\242g\351jw\277O=\361\331;\225s\346\177|H\315\246\363N\326l@\327n\244\312\204\016"
+	.string	"6\236\256D\210\006\320\307\313\f6\232\224\"\237-\225\3355H\207\333\273\355\025\333\033l9\"\277<\322\177\227\200\022\254]\237,\254%1\247R\310\237'\231mTh\030.tO!p\264\270Z\036Q\201m\277\351N7\266) \3368\210`\311\350Yq\265+~\237\026?\342}\202|\200\347\343\b\334\276t\246\233+\031E'w#\375Qf\273\\I\242\230\363"
+	.ascii	"K\263\201bE\345\221|\222\"\373Q\316\305\365\371q\037\237@'7Z"
+	.ascii	"\271\370q\246O\331L\250[\r\347R\025&\217\333\3562\200zT\214_"
+	.ascii	"\364i\220F\276F\343}vz\246O\0267\242\214>4y\220\252\352\251\b"
+	.ascii	"\202\352\371\261#\263\254\227R=\252J\250\022Y\352\325\200\206"
+	.ascii	"\2541\007\217\364!\225\310:\337\255\016\331\236tkJ{*=\247t\247"
+	.ascii	"\322\372\244\246\360\nkHp`-2\017 \300b,\021\032\304jZH\3742\201"
+	.ascii	"\301\274\270\200\341\214\004X\214%\204\001\303\230\f\370\372"
+	.ascii	"^.\237\314\013K\314\367\nk>\023\004\006g`\341\027\003\301\360"
+	.ascii	"s\275[\035\262\203\0305v\224\326\265\324\247\nC@\370T\026&\370"
+	.ascii	"E\376\213\367\331:`\313\215VNA\270\303\300\331\261\277\310yz"
+	.ascii	"\334uj7 p\002\021V\343\001<$\360\352\341\261\266\326\300\006"
+	.ascii	"\306`\331\300(\030A\350\242\277\0227,`\225\266kcp\201|/\224\211"
+	.ascii	"\016O-\b\376O0\2261[\243.8@\261\300\224\007\032ys\204\023\003"
+	.ascii	"\022\005\2408&\r\361\001o\334\343\037\334\030b\031N\232*\263"
+	.ascii	"\230\331K\203\335\356\244p\242\217S\314n\214V\230\230\304T\003"
+	.ascii	"4\007b\246\3543\020\324\336\244846\356]a\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.414b63426f34b377,"e",@progbits
+	.string	"(\265/\375 \361\005\005"
+	.string	"4\007\355"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\022\177\b\210\214\225\311"
+	.string	"\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\002\034\177\t\200\200\200\200\004\271\204\202\202\200 "
+	.string	""
+	.string	""
+	.string	"\005\016\n\201\204\001\023\177\013\272\200\005\027\f\r\r\024\177\016\002\025\177\017\021\020\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\017\021\005\002\022\001\030\177\023\377\037"
+	.string	""
+	.string	"\200\200\200\003\006\304\001\003\007\001\002\001\342\001"
+	.string	"\021"
+	.string	"g\004\315\261\304@3M\231\306p\356\261\260\233\307\220!\bk\206\203"
+	.ascii	":\200\303K\311\360\352\302\340\006\243B\005\024\335`\342\001"
+	.text
+	.section	.gnu.lto_.refs.414b63426f34b377,"e",@progbits
+	.string	"(\265/\375 3m\001"
+	.string	"d\002/"
+	.string	""
+	.string	""
+	.string	"\002\001\002\002\003"
+	.string	"\002\002\005"
+	.string	"\003\003\001\004\002"
+	.string	"\002\002\004"
+	.string	"\001\005\005"
+	.string	"\003\006\b\002\002\002\t\002"
+	.string	""
+	.string	"\001"
+	.ascii	"\3061\235"
+	.text
+	.section	.gnu.lto_.decls.414b63426f34b377,"e",@progbits
+	.string	"(\265/\375`\237\023\265a"
+	.ascii	"\252\247\324$O0\320J\352$\005\324\207&7\317\246\236\3742\253"
+	.ascii	"k\373Fm>\236\265+\223\177\036\320/\270\336\256,0pSB\2010\260"
+	.ascii	"\2636+\332\245{}\241Mi\323\271\313\330\324\234\356{2\217\371"
+	.ascii	"U\f\376A\017\002\030\340\265q\365>zc\233$)\245\002\0027\002E"
+	.ascii	"\002\356\226\366\367\021Z\344d){\225\224],eG\222\262s\245\354"
+	.ascii	"BRn9\314\235C\203i\2665LK\213\337v\303\304-\307\006\246*\217"
+	.ascii	"_ve\272;\363\252\224\237}\204z{h\363\fR\346\3303\305/\247(\303"
+	.ascii	"\245\331&\346\213\233\323K\rk`\302t\021\0233\246\331\372\231"
+	.ascii	"\365\200\0255\271\377\226\351\331Y\372\254\237Y7\n\0319\025d"
+	.ascii	"\232\215h\367_$M\354\277M\323h\032\207^\323lZM\337\32064"
+	.string	"\\;\373\331f\270\317\364\033w\313\215\306\314\304\314\200\212~6\227f\023A\365_\204\353\203W\034\254 t\377\255\211\020&vd\200\230\325\005pY\256\217P\242\256!\3456K\271\241\244\334I\322\"!i\210\376t\304\232&\211\220vZ\253\265\023\251\327\332\336\320\236*{\360\370\345\031)w\027v*{\025\234@\312\215\204v]#\241\f\"e\321G(\367\031s\233u\263[\023\376\221\377\017\002M\"\273\242\370m-L\334[<\240\312\254\366{;\270e[\020\277<\237\024E\037\241h\031\322\267F\275V\310\325\227_\346\276\322c\335\356\222<\230\177\366\311\326\250\221aje~\033K\323\300\335\366\f\314\200\n\336\031\313~\354\377\273m\200\371\177\354\266\227\347\377\330\353&\321M\342Z\361\n\343\202^\366\224\333>B\323\366\2006\261\200!f\217\200\271\221X`\356\025\230\035\002\346\2661\305\"\224\234\204N\231\373"
+	.string	"~\342\350\024\230\231F\007\314]d\3565\004F\231}\001\346\016\201\271I`\356\021\230\033\004\346\376\200\271E`n\237\220\271)`n\017\230\233\306\rf\3561;\031sG1w\220\271k0\267\t\314M"
+	.string	"s+1\267\002\314m\202\271\223\230\033\001\346.\200\271?0\367\020s\3770\363\032s\00717\0203\30313\0313\267\314\034"
+	.string	"3\227af\237\272\272\272:\346\036c\276"
+	.ascii	"0\023\221\005\314\213\244\202\326\306/\372\317\353%\313\215d"
+	.ascii	"y\021\364\277[&\226\362\263\224IZZ^\244_y\003\227\0219*N\036"
+	.ascii	"S\262p\261\027\271j\360\350X\363\353D|\013\350M\2342^\374\272"
+	.ascii	"\340u'n\315\357\275\222\362\305r%\373\222\227.\244\263~\027\347"
+	.ascii	"4\"G\367YYIA9\264\336\364\004a\027\3029\b\275\b\236\325\230Z"
+	.ascii	"\f~\331\216\003a\346\037\236\034\260\035J ?\266\234XUy2\250\005"
+	.ascii	"$\0356~\235\356\243\347\230\371\201\2600\t\203B&egF\377\250\374"
+	.ascii	"\177\037\274\366\225TB\334\274\036\352]\033\300\314\367w\020"
+	.ascii	"|\375\217\251\251\223\306\260v$\302#\236\251\374\033\215\276"
+	.ascii	"}e\262\331eLfI\2634j\377\b\210o~}\262\355Z^\346\373\267\337\217"
+	.ascii	"\354Z\236\220l\231\312d\3134\026=\222i\374o\227E\311\263\243"
+	.ascii	"\261\223\315\256e\262\311\\\032=\362\215\337<\036I\221\314e\322"
+	.ascii	"\fsY\224l\036\227Id\327\322h\212\2320\035;\260t\345\320mI\344"
+	.string	"\367\270\332:*\213\236\311\226\371p\377}V\365J\003\376\267\230J\270\343\220f\243z\366\240R;2\273\375\177\001\256\250\274\230\217|&\2430\377\243PA\375U\003\306\366\371J\372i\374\332z\036U\377\003\\\375\033\373\237\377o\374\177\037\345V\373\357BQR\354\352\352?+\304\325o\031\333\252\376\375\314\r\3332\331\364b2\265ii\212\275Ukl\261\207\353R\246M#\331\363\240\223\212-\177\314\361\353W\250\2220I3I\3321!,,&\314\035:\210d\350\021W\305ux\216\256\263\344\007\235_O\206\350\241\221\302f\364\313;\037)\247\270s&\006\206N\232\030\2348-\307J\027\2717?\366\016\275\247\237`.\306\326\344\374\330sZ\316QM\214\331\221\376\336\202Sy\225\033\273\316\255\332\351\307\236\343\246k\035\330\305\324y\023\247\302\217m\247\331\210\214-\001hC\254P\371oM\230\030\332\262CK\t"
+	.ascii	"\267\361t\236v\226h="
+	.string	"\334nZ\f\363\216\355\267\316D\017\232\231\232\224\273\004\272\253\253\353\022(\007\275c\2277oh\234\257\241<w~\204y\016B\256\224\271-:~\371\315\033\217\353\262\307\352-\314=w\222\322\034^\332\264\261\035\366\2704Q\236p\341\2222\273\032n\247\253\3616.\316\376\270L\n\363x`0r\362\234\342\327\3318\016\355Lr8\3665\375\205\177\220\3557\177\330\320\341:\363\313>\314\224;\t\355u\022z\225i\322\024\375#1\302\006$\305M\224\343\234\224\273J\273\030;\r\355t1\177\206 k\215=:\265\255\023Bc\224\314Q\372E\323\"}vh\245\235\255I\271\307\314<\013\\\323i\361\346\030\0324O\223b\306\313\272\270[?\263\212\036\351\214\223\033\033\343[\274Id4\372\377z\023+\343o~\306\311\270\0307\323N\037\343j\354\255\223!\305\214\361\2633rAl\354\204=\211\256\031\303\021A\225\304"
+	.ascii	"\213\033\271\024\314Ln\356\364/\375\f\352\"v\307\013\030\017"
+	.ascii	"\323Nw\343\020\355\2330!\300\020\2366tX\320/5\b\261\351 b\345"
+	.ascii	"\327\275t\263\314\216\257,l\355\364\266\236\025\fz\236\370\365"
+	.ascii	"5\206\223\303\250c\007\273\335 mW\316\224\245\214\216\245\214"
+	.ascii	"\206\245\316%]#\307\365\246$e\024I\312(3e4+e\364G\026o"
+	.string	"\362\232d\352\2745\233\315o8\303\203\n+\035\221t\305gp,\314?=+lI\322\254R\366\261\r\226\240I\363{\233\335P\257\302n\205\371\307\313\204\211]\371e\364\230\262Oq*\314?DpO\320\310vH\331\245\244\325\325\321\362\3532\244U\274\270\022@\\N#D\374\262\313\300\3541x\224nU\250\3233\347\227\341\372\b\035j\017\250Cab\207!\350\r\214\034\r~\205xkO\370\211\203\245\355c\265\031\017#rtCG\310\232pIi\342\364&\256\303EV\373>F\340\"\346\004\232\305\b\223\345\326\022n\247/\361\036\327X\366\306\022\316`\215\321\375g\235\330\235Y\261\265\371e^2I\022\007\353W\346\271knc[/\260\203]\361\322\016i\2669)\263\037i\247\037\361/\027`\355\033\32175e\326\tw\3418\327\345\327\277\230\275\313\275<G\007Q\303\341\004>\236\032U\343\307Ji0"
+	.string	"C)\001W\037\320i\t\350\364\341I\030,\026U\340p\215\001\224\301\006\205\301\"\206R\312\200\006\214\031K\254\372\264\376\330\021\254\217\201\024/\324u\370\2427E\034\276@b\211KOD\017@\241T\220\320\311W^\321'\304\372\204OD\236\360\211\270SU\b\026o\261\250\256MM?\237)\342\020xW\226\270kR\205O\301\250\237O\223Z\224\272\302a\220\005\252E\037^}OD\245\241\251\225-\006\237T\031\"\324'\341\017\n\030B\250\256\253\024P"
+	.ascii	"\017\254Z<\232\372\255\253\0043|\005|@\241\304\256?\242\322\213"
+	.ascii	")\342\020\210\304\300\242Oh\001\253\026U\031OD$\006\006WU\250"
+	.ascii	">\245\334\300\212\005V\260\300\341\303,Z\240h\201\002e\026-\230"
+	.ascii	"\230Z\254`Jy\005\323\216e\031\n\001\326\267\202"
+	.string	")e\205\301!\321\306O]k\370~D\226\310\003\213\246\240\006+\024\353\303b\205bS\2258\305\372\200\212\300\325gH\304Q\001pE\213<\n`\304X\241h\b\247\232~\030J\351)\350\004\202\207Du]b\207\303u)\250\350{\n:\t\207/n\250lq\252H\204Cm\022\302h\n\022{2T\024\202,\360g\364$UCm\002*\002\203l1\310\376\330\242\317F\361\307\366\240\200l0\205\031\305a\214\0251\216l"
+	.ascii	"\207Q\300UEa\350\223\"\002\207\324\033A\032*\360\267^\360$\f"
+	.ascii	"\336X%\020r\260\252)\f\211\037X\037\013V\030\224\362a\007\034"
+	.ascii	"x1\302\203\r.H\201JjT\320i\270\022}*\373[\243\206++\034\002\227"
+	.ascii	"\200NK\302\340\357\306\022p-.)\035\2406\ro\370V5J\252I\205\002"
+	.ascii	"\026\211V5\350\024d\205j"
+	.string	"\023\214\246\3657\254\321[\177P\300[W\344\207N\017,e\374\272\036\367<\276\207]\217\343\021B\376\230\236K\324M\202\347\346\344h\206^N\257v\210C\323\002\363r\035z\300\211\3035\347\327\216\035\237\3731\002\220\207\314\020+t\237\005$\211\331\357\260\3179\020\242%S\206\234\371\314Ic\360\240 i\202\304/\n\260\226\251\346\304\013\013\315\257\313q\227\3639\354r\030H\t\326\276\332\177\353rvf\232Do\327$\002\201b\250q(\207\224C\210\314\314\214\310H\222\244\003\361\004\204 \b\255t\036\022\300\0251\222!\211dH\202\031)HA\241\2621\007\203+\264q\007\275\245\363~\034\037\231\323\277k\b\2701\r\315L,\246\201sm\323m\340\330\016Q\276\016\013\256\002,\001\004t\330o\021\321J\036/\363\032\227\357!\325\214]!B\3548\020\007\034W\263h\004D\325\222\365\240\241R\205\022\270\b\346\243"
+	.string	"\220}\313\022"
+	.ascii	"\241!n\034\234\262\302w\022+e\211\244\"\226h\006\207\203\347"
+	.ascii	"\341\207\037\301\016\272;\356\247\332g\326\361\273\306\037\242"
+	.ascii	"\267\235\3011^r\201>\270\025\030\201\022\177C\243+\360G-`\336"
+	.ascii	"zP\230 d\250u[\322A\252i\253V\340F`C\240 \364<\300Z\333\005\264"
+	.ascii	"\2641<\021l2}9.\026?\365/^\036\356\301Y\321(\024\312\177\351"
+	.ascii	"\004mQ\354\322\356\2633&/\250\031E\320b\257\277\276]\202Ww\215"
+	.ascii	"\036\24145x\031\356c\364J\021\320\020\246\035\023X\220};\330"
+	.ascii	"\317\264 \023@\247N\274\343^\366\003\212\275\3569\330\374\237"
+	.ascii	"e!\201pj\b{\026\320\355\243\320\375\206l;\236\263\205\033I\\"
+	.ascii	"!\325\273\253&\372T|\034~\277\372;L+.\317\364\217N1\361*\003"
+	.ascii	"{1\251\202\345-\221-\013\242\247\345\310\030\"\312l\364\017\305"
+	.ascii	"K\025\021\2556yT'@?\035\036\030\206\336\030+]L;!\nl@\004\r\340"
+	.ascii	"e\316H\0052v?;:\247\267F\235;tq\202\326O\273\360\330L\343\207"
+	.ascii	"\206\314"
+	.string	"\235-[Q\003l`\243\351\210<\307\361!m\216\002\204\213\222}jn\322(\004w=\240\030&\005f\214\232=T\206\tR\322\343\221\333\201\021<*\323\210\350\f\360m\030\336V\241s\2752\233\363\346w\037\177\242\231\003\205\311\265\274D\243\323zS(\001K;\021N\036F\311\313\330\232\bt\265\244S\343\363F\346L\035\254Z%\353\333\340C\304d\213]6&\364;\306\210\254v\3427\200\365\243bp2\023\021\234i\035\367\023B\303\256\207\330\\\300_\300\275\367o\303\355@*\326\370\332\n-,P\rw\te\366\361\200\304x\340\235\266\001\311\317yx|*r\335\224\222\267Y\"(\342\233\360\260\027b\262\006\005e\003Wem\356\250\030)\013\376\374@\361\021\273K&~\225D\177\220L\362\033\025\210\222~\275$8\344\307\002v`\024\304\303Hs\333\233^\f\221 \016\033>\226[!\252\372\"\361\230\037"
+	.ascii	"\261\241\323#\225\240\034\023\302\245y\236?:\020\373\224\253"
+	.ascii	":\260\273\272\005;\275\035\353\270\350|\022/I\370(\236\274?l"
+	.ascii	"\035\363\360\257\262\177\274\027\360>h\033\220\r\365\354\034"
+	.ascii	"\372\177\037\374x'\200\273\t_\375\t~\235m\253\303\"\316\352'"
+	.ascii	"|\322\365\230\275\376\312\270\n"
+	.text
+	.section	.gnu.lto_.symtab.414b63426f34b377,"e",@progbits
+	.string	"pgResetFn_controlRateProfiles"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\001"
+	.string	""
+	.string	"controlRateProfiles_SystemArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"`"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\001"
+	.string	""
+	.string	"setControlRateProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\001"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\001"
+	.string	""
+	.string	"changeControlRateProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\001"
+	.string	""
+	.string	"copyControlRateProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\001"
+	.string	""
+	.string	"controlRateProfiles_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\001"
+	.string	""
+	.string	"controlRateProfiles_CopyArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"`"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\001"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\001"
+	.string	""
+	.string	"initRcProcessing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.414b63426f34b377,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,3286 @@
+	.file	"fc_core.c"
+	.section	.gnu.lto_.profile.11548313aa7dbd85,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.11548313aa7dbd85,"e",@progbits
+	.string	"(\265/\375`\240\003=\022"
+	.string	"\304\025\224\004"
+	.string	"4"
+	.string	"\374\315\320\306\007\034\002"
+	.string	"\002"
+	.string	"\002\001\002\001\002\002\002\003\002\004\002\005\002\004\002\004"
+	.string	"\001\352\263\360\321\b\005\006\007\b\t\231\357\210\200\005"
+	.string	"\n\331\215\347\253\t\024\006\002\006\002\002\002\007\b\002\b\002\001\002\t\002\002\007\f\240\342\234\212\n\020\255\272\375\374\n\022\002\001\002\n\001\002\013\002\001\002\f\022\023\030\243\262\274\213\017"
+	.string	"\031\357\300\251\237\017\030\013\r\002\r\016\006\002\006\032\033\035\036\037 \250\200\234\374\004"
+	.string	"!\370\220\225\322\013\006\f\"\223\354\335\232\b\007\002\002\007#\234\276\301\203\013\f\002\017\002\020\002\021\002\021%\233\304\365\321\002\002&\214\233\312\236\002\002'\334\265\254\341\004\006\022)\320\305\341\356\b2\007\001\002\023"
+	.string	"\002\024\002\025\002\006\002\002\007,-/\333\311\367\353\b\0010\376\336\373\325\0161\317\300\260\312\002\026\002\024\002\026\027\002\027\002"
+	.string	"\00257\225\277\200\233\f \001\002\031\002\001\002\032\002\001\002\033\024\022:<\260\206\231\204\013\030=\315\347\335\233\n"
+	.string	">\240\231\226\210\003\f?\361\247\346\227\006\212\005\023\004\002\023\034\002\034\001\035@AD\234\346\300\362\007"
+	.string	"E\362\371\346\320\007\016\001FG\350\300\306\254\005H\202\321\330\342\013I\374\202\331\242\rJKLMN\240\342\234\212\n"
+	.ascii	"y\250\241\275\241\021\262%\005\255\264\006`\202ADT>\021\340L"
+	.ascii	"\206\254\n\304\255w\3546q\266\320\347I85'\030E\251E\324\004_"
+	.ascii	"\003\017\235V\343\310\372\355\2365\213\227\331\246\223\274\353"
+	.ascii	"`B\256\247\365\341\316Y\026~\377\246\342<\210\2575\353\311\337"
+	.ascii	"\b_%c\0318\302\261Q\362\234]\363\342\312\260\203\341\004\321"
+	.ascii	"9\204\200\032\312\177l!\240Gv\222\0254A0\244\376\026\330\335"
+	.ascii	"\221\\@o\032\177zE\212\341\306\237\003\305\261\256D\235h\305"
+	.ascii	"\314bu?\252\336\352\247\013\b\035Y\233/G\261F\227TD\231u\007"
+	.ascii	"f\030@\333(\223\022\021\301\320\365\221\263?\210\224\025\334"
+	.ascii	"\345\347}\224;\371\323\277h\006C\275\351\367\341i<I\302\005A"
+	.ascii	"\261%\220-j\225\245\230:vdH\334\302\327dS\"\222|)\016a\003\313"
+	.ascii	"y\025\361<"
+	.text
+	.section	.gnu.lto_.ipa_sra.11548313aa7dbd85,"e",@progbits
+	.string	"(\265/\375`%\001\275\005"
+	.string	"R\006\021\025 \223\322\001\f\312\b\207<\373\233\270\035\302h\245\377\332\226)\005\226\223\325\225\350\352\310^C,\037;\252\2613v\261\212=\361\210\203a\013\373\242\240\267\2473\3006aP\n\002\246gE\357\033-\2315\271\024B\250\320\2626\231\326\300\"\263Z\007\020`6A\215\323fQ\220v\375\253\242\234;'/\202\322R\230\360\004i\332Gh~\320~\241\027\341\213\334\fT\330\350R\250\361H\222\021\272\243\254\024\320|\221\205J\236\270\352\202\277\240k\233"
+	.ascii	"\316\376\223B\024-{\367jG\277\215\311\004\325\"v8\022t\307\035"
+	.ascii	"`u88\244\331\240.J@k\374\357\310Q"
+	.text
+	.section	.gnu.lto_.inline.11548313aa7dbd85,"e",@progbits
+	.string	"(\265/\375`\217\b\335\031"
+	.string	"f\\iI\320TQ:\350\373\364v\240\02495\362\224\324\306nt\003\016\304a\261`eC@\371\306\221\262N\037\330\365!\235\226f\301\003\254\352\350\333\237K;\270\033\337\354\371\374D\277\\XD\237\314Q\017\347(\253\377\004R\267\2242\005T"
+	.string	"Q"
+	.string	"T"
+	.string	"G\321_c\274\377\2651\302\"0t\004\314\202\230\031y\250\355%\225x\225\270#\265\265\240\225P\300=8B\334\250|\024`Yl\003\213\325\234\354\257\257MR#Vc\272H\365?\211\367\273\332\356n\357o\261\214\241\034\n\227\375\325\305\270\222\234-\370M\027y\bF\236"
+	.string	"e?\226\344l\300WX\373\355\n\236\222\374\216 \303\356\212\347U\276\357;?\277/\332\336K\374\323\352W\247\273I?\260b\261\273EO)KR\306\342\332\031R\2063\335@j\fsA\020z4N\310r\323\257\035\272\033\374[\\\353n"
+	.ascii	"\001\021F26\032!4\032\263ai&n\374\270\356\017\272\373\302\376"
+	.ascii	"\334b\"\335\275r\007z\202\323\r\226\336@\365*\021\334\235\023"
+	.ascii	"6\226\234~h\b\335\240\316\340\373\253D\001\363\327y\f\274\223"
+	.ascii	"a\001.\350\375.\016o\037x\264\306\377Q\253\327\363"
+	.string	"\213g\364\344\320\361\267\260\273\035 A\251\275\365\214vz\005P\305\013\234\216\264c\342\243\t\201\273\350\234\363e\177\206r\265\371\357\253\205y\277\206\315\tBb\b\037\231.D\350(\005\017\265\034\276g\030\226\345\244@\302\341'\270v\204\305lF%B;\n\274%\245\254m\t/\276\351|\200Zt>@)\017\200\274\250!&\032\231)IA*\205\326P\"BDU\266\001\022\340\361`\nL1F\0213\206h4IJuZ\003\244\223\273\211p\356d\363W\325\255w\313\243\267-\224\254$5\"\326\t\023\265\325\233\f\310E\352\024\016r\037\266\214\354xT\304\346\275r\355\265\203m\360\351|\342\253\002\313\213\037\357G\031\306\024\200@\300UB\337\316\333\242\035-\374Q6\035/sv\371\235\272\342r\f\205\252\024\253\006n\210\221;\326\334\177\200\256\f\350L\230W>\364\366\022\272hZM\324g\247TS\215'"
+	.string	"\017t\226\372\016\215\202Oq\013\261\b\377K<\020h\315\036\311\3546\324X_Y\201\326\203\002,[q\304\275\212\356\263\217\210w\244<\355\366Pm\332|>\3531S\333k$\234\355\223\312\317\001U"
+	.string	"\334\335\025\333\223\367\031\337\330-\003{\243\327\230\017\f\341\257:@\373\013\263\250"
+	.ascii	"*\032\247\226k\361\225\036L\240\021\177\353\216\n\273r\340d!"
+	.ascii	"\026\n\366\323\006W\340\203\230\361lD\344#ev\256\310(\026\016"
+	.ascii	"~a\017l\340]]\236\2312\272\033/8<\271W\326\007\3765\243[v\206"
+	.ascii	"\313[\267\271\\\203V\364\234\\Jj\222\\\254\217\210\251\3212!"
+	.ascii	",\356\366\235\235d\f\221\2146\310\320D\334?\210\300\204\034l"
+	.ascii	" \216\363b\217\271\327p\276\214\217V\313:}}\317\231\371\r8\322"
+	.ascii	"\243\340n\276\t{Y\231L\037\262\b\267N\350\274\306\277\331\036"
+	.ascii	"\346\2522\360\004"
+	.text
+	.section	.gnu.lto_.jmpfuncs.11548313aa7dbd85,"e",@progbits
+	.string	"(\265/\375`\333\007\345\026"
+	.string	"\006\031R=0q\222\341\300\0259\004\333\351\345\376\373\337\213\357\272\350\310\232n\177D\r\3511\024\364\305\031\177\037\024\024\024\253\203\034u\306t\341<\031\261j\325"
+	.string	"\350\267\177\343i\315\346\344\357\266\211L2<"
+	.string	"C"
+	.string	"A"
+	.string	"%\336#\361\357u:#n)\242\250\211\270mm\207\222\311\034\342i\032\364{;\024\3266\222oF\243\321\210n-N\357g\326jw "
+	.ascii	"\344K\004\362\022M\220]\210\265$G8\255\b\375\302\2306q\2601\022"
+	.ascii	"\351\312\270\202\004\267|\251Rp\352\244G\300\003$\r\220\005\030"
+	.ascii	"\240\224\276\023\022\262\003A\200\034\360\361Qa0\214\215\234"
+	.ascii	"0\001\253\030\364*\212\252\252\267\003\255\023k\251\354\361\230"
+	.ascii	"h\257\275\034\222\225[\n\305\022\"T\0208M\323t\350\326\345\226"
+	.ascii	"b?\002\365\001\331\200\032\r\203j\212q\212u\222K. _\274\2133"
+	.ascii	"8\r\216\003\035H\313]\302\276\204uZ\230\305-\\\007\276\201\316"
+	.ascii	"\203\373\020$+Ph\177\002I\021\021\031\353x\307m\b\306'\032\215"
+	.ascii	"\016\017\217\034\267\037I\212q\333\024\217\n\213\t\213\211t"
+	.string	"\343\256\226\026IZ\265\361ik\334~X\333\224_!\032\255\2554\227\315f\276\314\230|\207\201\005\200\354\250Ai&5I*\245a\r\260\002\021*\242u\021\220D\254\234\221\021!I\232\306\300T\267\377\t\337\227\224S\0322\374nR\037}\361/}\247LJ\006R>%v\254+\355i\273C\307p\325\317Q\314\t\037F\232l\r\336|\321:5\311\234\024#\300\353\230\002|\310\300H\212\023#\216Je%\221Xgk\025\004\312\244\036\263\303\316\361\333\302\260\325\360\326*lR\202HDh5\344aR\037\230\260\234\310\237\2405\024\312\t\230H\327@3F\215\371\367\021\276\235\302\204\315\3311\233\326\n\276\005\261\270J\220\3060X\361x%\364\240\275\310\324\\4\017\321\341F\r\370\336\021Z\0266\323\0178\202{\277n\3630\244%hA\273R\222\206\205\266X0\373\004\311M\234}\016\022\275\351\023\006\256\034\244"
+	.string	"\034Af\335\217\315\007\323\276\243\250\227\227bI}M5G\333\022\242\267\343\264\225\207\030\316=\314>\023\034\247w\265\303b\177&\202\351\342\020S\013>\255|\217\025b\217\216C\035{)\327\265\342\265(\227\235\004y\315\265\312Q\f\004I>\336!2P8\2547kC@\214Q\023\343\375\031\324"
+	.string	"<0s\343\210\207fV\314\366\204\2058\311\337\202\304\036\225\005`\201h\322%\326\204\247\033@{\021\\"
+	.ascii	"\177\b\302\374&\315\374gra\021\003\321%d+nJ\206\243\353{+\323"
+	.ascii	"1sA G\246 \254Iv\tq\207t\277\262\0252\352\241\352`\017"
+	.text
+	.section	.gnu.lto_.pureconst.11548313aa7dbd85,"e",@progbits
+	.string	"(\265/\375 P\035\002"
+	.string	"\002\305\017\031\220G\215\001k\360\335\335\315\341k\224\307Q\274\234\211e#\213:>\274\233e.\203\027\234\340\r\\\340\001\027\300'O\362\310!\177\334\361\306\031oq\305\023G\\\371\341\206W8\341\246\314\354\020"
+	.text
+	.section	.gnu.lto_.ipa_modref.11548313aa7dbd85,"e",@progbits
+	.string	"(\265/\375`\337"
+	.string	"\225\006"
+	.string	"\002\311\032#\220\305\225\003\177Y\337\335\335\335\335\335\322\027\035\241\276\233dl\243\relJO\005\256!\300\206\307\226)\005\252\004\016T[\004$\024\034\340\225\202\301"
+	.ascii	"NW3\247l'\224\223\344l\235\207\216k{5t\037f\255\271\265\225\210"
+	.ascii	"\230\241;T\315#[\b\265e\341\243*\324\031h\013\315\233\355tP\r"
+	.ascii	"\322V\232G\333h\323\023~\020. \220\202\251\262\362.\222\202\277"
+	.ascii	"\270N\207\024\216\305B\205\362\202P\220p\004t\265\004k!\201\""
+	.ascii	"9\t\bv;\256]\250\333\313\226\230\356\002}\024\342!B\210\353P"
+	.ascii	"\277\b\006\302\330\023\341\021x\213Sj(p\b*D\f\024\002\002X\307"
+	.ascii	"!\316A\213\031!\034\224\273\257\031\326\341\237\t1WQ\004\026"
+	.ascii	"D\301\207"
+	.text
+	.section	.gnu.lto_.lto.11548313aa7dbd85,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_throttleCorrectionConfig_Registry.125.11548313aa7dbd85,"e",@progbits
+	.string	"(\265/\375 \222=\004"
+	.string	"\224\007`"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	"\005\001\212\001\206\200\200\374\342\303\315\202\031\031\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\337\030us\355\007uq"
+	.string	"\005\001\006'\001\004'?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\030./src/main/fc/fc_core.c"
+	.string	"\004"
+	.ascii	")\302\303,\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_throttleCorrectionConfig.127.11548313aa7dbd85,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001\240\006?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto_applyAndSaveAccelerometerTrimsDelta.128.11548313aa7dbd85,"e",@progbits
+	.string	"(\265/\375`*\002\275\017"
+	.string	"\226\034eE\360\222(\035R3{\271?\202T\340\023.3jg&TQ\213\341\303u@\233\032%\216J5\245\210Yx\220\360\177\003\215\341:0\354\254Y\024\331\335hh\315R\b\357l=\360\362\"\300\265_\362\271\255\224)\005M"
+	.string	"G"
+	.string	"Z"
+	.string	"3!\033\213/%>\266\237\366O\034\005\352!\312\007\354\262f.\273.\006V\260=\332u\003\332\343\366\002\332\243Qv\217\273Z\373\027\t\225W\220\335\345T\304QO\224\377\024\357\254VR\236\234\007\273\353\\\255|\270\365\266\021\330n`g\030*\336b\362Y\036\315\341$\277z\364O\264\307k\200\026\230\2110\2253\333\245J\ra\177\263\273ke\331\017\177"
+	.ascii	"\231\006i\372\243iO\246;\232\3362\315\311\264\246\351\250\351"
+	.ascii	"M\246U\323"
+	.string	"\231\351\023\360\370\330\261`f\327C\036\230\367\232\026\214\216VG_3\"\344\3506\272\215\227\032.\034MXL\250)\215\0312b|\005$\252\266\321\324\250!\230\016 T9\263\352\346\205w\032\231\213\322\326\302\202\311ed,(\332\243\352ix\\S\2572\304\030\376\362\034\264l\rgQ\032\361\367\025&\td\273;\022\242\023i\024\301T\362@\n\031\272\2237\341B\t\004\022\351\003\017\270\023\031\201_W\241#\341:\022\256\304\023\225\270\0164q\"!\177\033F w\372>\220\373\270R\337\254\262,\341G,\245*\013H[\324\345WN\03031\225\246\030\2449p\304\334\370(\310\243\233~4$\323\321, \260\202\231\032\355\"\241930\030\236\022\256\301>\344q\371\303\204\2737\214 \327\t&\331\334\353\320\264\034\ft\304\342q\035LA\240\024\267K\210\317\203\345\020\255d\304F\220w\035qm(\315v"
+	.ascii	"\311\250\024\343\032\212\243}\346A\233\3762\241\3675\353\253"
+	.ascii	"C3Y\333\354S\240\227\027m&\003"
+	.text
+	.section	.gnu.lto_isCalibrating.129.11548313aa7dbd85,"e",@progbits
+	.string	"(\265/\375`\253\001e\017"
+	.string	"\306\333cE"
+	.string	"\261&\035\273T\333\025\236I\250\023\253S\371\300\316\374\220\302*hA\2735\310\260O\332\227\367\026:n\204YK[\227;\263HmE\242\310\206\240\252^!\252\355;uY\377\362\205\020B\235\333\336\233l)S\nR"
+	.string	"L"
+	.string	"O"
+	.ascii	"\244{d\204\330[%\371\333=1$m\270\026N\207\024\226\313\227V\036"
+	.ascii	"C\240\254\240\024\226\240\024\373\250JH\364\275\003\034jT>\252"
+	.ascii	"\323\033\360\302\303\214\333\240\260\350\006P\235^\2019\347a"
+	.ascii	"\256&*\223j\f\3159\255)U\312\r\340\2669\333\006\354\323\004\266"
+	.ascii	"\005\f\372\324\3670\2270V\314\350\270N\273\331\335\246\313\331"
+	.ascii	"\177s]l\253A\252\226VG\253\241\325\230\325O}\001\ffrp8Z\314y"
+	.ascii	"\262Cc\272\300T\200\260=b\177\234@\301\210I\357V'\221\244\004"
+	.ascii	"\352D\316\234]\266\037\036!p\341\206\247\254\032\225\030\210"
+	.ascii	"\255\336(\266'\321r\332\355\247\211\031\261\302\336n\274<\020"
+	.ascii	"\321\247\336^`\321\351\270L\273yW/W\212w\326u\377\362\250-\022"
+	.ascii	"\321\247t\257\241\305\264\333\335m\3279\347\266K\202_\017\023"
+	.ascii	"2N\3722\324\367\n0\326:>F\"\255\201\006\222i Y\204\020\007\020"
+	.ascii	"2m4!\353 `\221\204\217QFA$\032e\237n~]\354\301\265P2\022\264"
+	.ascii	" \006\013\205\314\376$\030\035\327\241\322\232<\313Y!\3075\""
+	.ascii	"\270\\\023[.h\217\252Q\322\035)\227\273fh\335\210\210p7^\002"
+	.ascii	"& \220\202))\263\003\n\tx\302\370\241\2047\02085\331\316D\r\301"
+	.ascii	"`\336\364^\033e\260\233-i\233Fn\206=\331\222M\324we\013\262i"
+	.ascii	"~\\I\001\2043\024o\"\020\212\274\237P\222e\362\366\030h-k 7C"
+	.ascii	"W\034\243+O+\337:\307\334\006p\3276\301\224\001"
+	.text
+	.section	.gnu.lto_resetArmingDisabled.130.11548313aa7dbd85,"e",@progbits
+	.string	"(\265/\375 \344=\006"
+	.string	"\222K+3`M\222\016\300\320\276\tt\004\354.F\020\005\266/\332\342\t\004gC\304\232h\355Z\034\251\347[U\303e\030\030\207@\301\257\033,P\035li\210\020\231\002\277\211\212\360)\274\212{\025\347\300\260\320\340^\204p\323\300\360\201\212.\002\302\350\244+\3334\t\034\235K\233\330\240\327\243\037\217\334\214%\346\260Z\205\356\234\200BQ\211\211\007\345\302>\177YX\263\370\002d\323|\2236H\016@21\237\224\354@\"\032\177\245\253?\351\205\221\335\204Pl<\231\351\332E\253\262\352\266\243\002V\306R\026!d\346\314\312T\364\326\237\340/\3701\001\b"
+	.ascii	"3\001\0038\343(\276\3055\221,\004\3742\004\270t\213v>\001"
+	.text
+	.section	.gnu.lto_updateArmingStatus.131.11548313aa7dbd85,"e",@progbits
+	.string	"(\265/\375`_"
+	.string	"U\t"
+	.string	"\246\321@:@\305(\035`\255\376\317\252n)p$\211\320\314\256X\363W\254\354[L\357)\210\037?\245\374\246:n\350\024\001\240\264\020\265c\304K\306\030,\005$Pk\037\266O6\2212\2450"
+	.string	"."
+	.string	"0"
+	.string	"\034\367\034\323\364\370G}\340\003?\307,\030W\254`\344\361\021\200\036\206\320\032\021p\324\323\002\feV\024v\327\371\201\027w\274\355\005\333\007\266O\002\266\312K\335\260\257a\030\026\260\232\354\247\343\323\317Nb\271\002$"
+	.string	"\330\035\205\004\226\025I>l\377b\217\235r\325i\277*\021\255\\\273\253i\252\237\237^-\0215&\213z\324-&!(\241|\371\307d\327\250NQ\311{\352 \024~\207+:\371\357\321\357d\217\327L\206K#U\002e\030\3362\232\216\333\030\266\215\266m4\b\207\206\007m\3538Z\306\300\\\204\246\323$8\256\323.*\320\261U\223#\2115\240\005R\017\333\335\305*is&\362\237\003\016"
+	.ascii	"3\241\335/FV\301\301\025@\265\017RX\304\205\017\341jTxv\031\345"
+	.ascii	"e\bq\351\242j\207\006\246\240"
+	.text
+	.section	.gnu.lto_disarm.132.11548313aa7dbd85,"e",@progbits
+	.string	"(\265/\375`|\001-\016"
+	.string	"\006\032\\C\020\221\223\016?Bm\214\253\374\352:\340\327Cl${\361\031\326\307\265\260\003\360\237\013\267\213\364|SkO9f\224\017\0078\215\206\203l\212P"
+	.string	"(P\240\004\323\025\304\252b\323\nFld\357-eJ\001J"
+	.string	"B"
+	.string	"J"
+	.ascii	"\017\321\"\222\211\261\273\227j\270\347T\204O\323\343S \033\\"
+	.ascii	"\3679"
+	.string	"\265\271\360(\232\220\320\302\3373\340\242\004\f\253\223\360\006\244l\340\252.\224ju\242\327\261\273\177yR\350\266L\ndw\235\\W\341\336\334v\004\333\005\354\217\b\217\351\370,\206\200\222\347\016}\224xx\205*N\270\214@y\262I[j\006\373ow\327\252b?]i\232\312t|\032>\375\236\276%\240\003\n\004$vSN3\326\004g8\330~e\217\335\342\244\225\r40-+\257$B\325l\222\203(\331\354\206\016\3702\377`\342\263\034:;9\211\207P)\232\032\227\230\247\245s/^\343\235x}\272@D\215h\264\345\356~\324\034\261\322\277|\223\242\304\"\2242\374s\304k\245N\321h;L\306>8Z\206\205`#\0276r5 \0211\2710\255s}\020p\346\200\243]\017\262L\273*\022\350oU%\201\007\023H7J\201F\217H\251VZ\321q\217\030\225\322G#@\332!\"y.*"
+	.string	"\023\030\240\2256\207A\236\2635s2m\372q# \240\002!\261\263\003\263B\257H`,n=\271\317ba\227\310oi\231\005D\334Q\""
+	.ascii	"\367\356\330\226\242\360*:\200\307\030\264\234\275\265,\361\301"
+	.ascii	"C\252\255Kxm\202\304\314\261\200}l\0178\035l\234I\003^\215Tr"
+	.ascii	"\321,\361x\241\330v\2312"
+	.text
+	.section	.gnu.lto_tryArm.133.11548313aa7dbd85,"e",@progbits
+	.string	"(\265/\375`7\003\275\027"
+	.string	"6\353\227G\240\032U:D\247W\221\352\274&i\234\354\035#X\360\205w:\035\251\253G\237|t6\246\365`;\320\\\333\364\357\320\020-wG9o\260\212\036\230\204|P\300!\307P:$\217\3521\\#f\242\020\2737\2212\311\205"
+	.string	"x"
+	.string	"\207"
+	.ascii	"\271\235Z\253\370\271\353bW\374dqa\273X\336\373Q\237D\n\355\207"
+	.ascii	"K\255ul\037\207]\034\301\204\":\301f\330~d\233\271\030\303c\006"
+	.ascii	"\356#\3604\305G\273P\r\007*\260\3311t\235\032\016\206\361y\214"
+	.ascii	"N\r\027#T\273\301\341c\270\213tj7\0316\032\323\032\237\002l/"
+	.string	"\316\203\301 \2157\350\340\007\264E\200m\006\232hp\310\357\3161l2fQ\205Z\3532i\233\361\005\360\335E\262\273\024v\273A7\322\332\337|\356\212\027\237|\321\317\367w\347\234\036\277\034\017/\306\345nO\306\255\333}\227eYn\333\354N^\023\363\226\336\363%1\2578y\303\311+\002yi\363\202\315\313\314\373\002c\220\\\016 S\272J\257\322\224^\252o6\311y\317w\277\263\367y\357E`\357Y(\247Y\257\332<P\361\355<\370\\\006\341\347\351&\372\t\276D?\367<\347\271\370\316N\0375\001$\355\373\37486\206\370d\023|Y\204\300\264\016\350`\2738\200\335b\027d\350'\013\267\003\007\275\240\311\021\265\240L\200w?\200\340\223\034Z\321Q3\364\223\365\f-\361\236\027BDO\004T\f\205~\004\264\324b/\323n\262+\371\222\021\373\233E\245R\364\263\324\347\235qjp\311\361\334\300"
+	.string	"\f\341\273'V|r\0018\331\371f=\363\037]~L\272u\313\242o\022>Wf\334ewQ\374\b+\254u&a\377\0232\255\027J\345\241\204*\005\t\324ku\341\204\314\212\345B\r\330T\004\225\253\225\032\22121\246L\2142+\024kL\271^c\004\003\333R\241r\215,Z-\327(\366b\257\020k\031X\027\260\251wa<0\"4\202\200|\2446\3652\251\205\324RD]\226!\267\030\227\007jz6\243\326\221:\354\363x\320\243,\224\375\315Z\330'\373\204~\206-\352\260\f\335\022\260\250w1d\240'I}\242-\352\371C\373\022\343r\017\360\256\206\r\374@\250a,\346\214R\n\315\210\214\004\231 \206\206\003p\002\0311\255\007\020P\307jS\350\362H_\335\245\203\272\261\006\261-\332\247\355L\234\215\240\003\032\006\315x\266&7\245\n\230\262\335\205Ph\002C\374\203(\007\254\240D"
+	.ascii	"x\233\026\357E\227\021\2653\305\317\335%\220\336\354-\267\377"
+	.ascii	"\245\334\275\367o~@\351A<\312\215\312\352\221{j\253\351\037\207"
+	.ascii	"J\327d']\353\021\324\216'E\311Vjg'\n\360#\245\004\001\200\017"
+	.ascii	"1\225\031M\330\375epS\332R\003"
+	.text
+	.section	.gnu.lto_handleInflightCalibrationStickPosition.139.11548313aa7dbd85,"e",@progbits
+	.string	"(\265/\375`H\001\325\f"
+	.string	"v\325N? O\225\016`Fj!\304~\023\005g\361\342g\260y\310\212\213^\306\315v\223\320\f\t8\004\325\337\b;6ef\224\250\227_\264\275"
+	.string	"\200!\022BL\0218\bH"
+	.string	"0\\?!dK\231R9"
+	.string	":"
+	.string	"B"
+	.string	"\273\273\351\205\177\236aW\324\374\370Y\005"
+	.ascii	"\030~\3170CH\277$ha\204\214\001B\322U\022\212\"\201\335\275\206"
+	.ascii	"\347\2040\224\231Uv\327\t\206\025n\310mol\027\260\217\n\340/"
+	.ascii	"\277\203\375\272N2<L\252\022(?\354\325\227z\262\037W1\354\247"
+	.ascii	"\343\323\371\364\265\227\320h\251\260\264\330\245\360\341\261"
+	.ascii	"\254\213D\206\355k\376\330)\276B\355G\274\030\201h\005z\212:"
+	.ascii	" \265\021UDD\001\256H\215\372\221\205\020\016R')\r\223\252\024"
+	.ascii	"\365t\017\306\361\340@\ne\332\320\361\016\367\240\261\370\320"
+	.ascii	"\352\310\335\375\324\036\354\232\200\343\204(]\330W\235\203\307"
+	.ascii	"\307`\b\235|\346(\027\257\343,\034f\3430\333&\203@\263q\036g"
+	.ascii	"\243\bp\267\340\342m\r\272\316\333\264\325>^1l`\203\005\322P"
+	.ascii	"\314\"\031y\006\263\025h$&2\260D\213A\322f\300\311\203V\375~"
+	.ascii	"\005+ \240\202\241\301\036c\020\200 \\Q\336e\f\335\235\2604\250"
+	.ascii	"\2105\225\367X\031\346\274YAZ\375j\260\200\235s6f\032dGcs,:\235"
+	.ascii	"\213\fgH\367\006\246\204\306\030\334\035\327R\021\306\r\366\003"
+	.ascii	"\364\303mG\370\357\270\303\374\222F\245\352\372\325\227dg{\343"
+	.ascii	"\362\266\213\352\001"
+	.text
+	.section	.gnu.lto_updateInflightCalibrationState.140.11548313aa7dbd85,"e",@progbits
+	.string	"(\265/\375``\004]\031"
+	.string	"F\352\226J\320\362\250\003R\352\366\004\n\203\371\335Y\231R:\364B\234z9\274\"\3212\2060z\004\301\276\321\307\356\021%(m>\026\232\323\211;p\275\217\020\235D\211\346\002\342\323\270\373\336'\307`\214%\037\016\332n\273\367\226r\247\224R\206"
+	.string	"r"
+	.string	"\202"
+	.string	"5G\"\227G]R\301\314\2152\r\363T\007O\334\022E\316N\206\361\336\233\276\211\246\351\221\227\253\205\262N\263\264\225|\247\341>y\275[\217\274~\356\322\311\361V\311\202\262s\243\323(\312\316\rN\263D\370\td\203\023\302M\0376#P\200l|^\202h\273\353\340\225L\241R\252*\251I\301C{\034\234D{:\377WoG\026\270\367\366P\273\207^\316\275d\271\367\262\363z7\315"
+	.string	"\232\271K\230\331"
+	.string	"3i\022\337C\315b\321}b\375I\236}\347\313\365\213\206aaf6\263]\375W\210\355\367\336\333\263\315\366\307\b\245t~\305\334Emd\343\366\341\f5o^W\356\232\355\332o\262\202\310\257\310\207\363#s0\347\017dn\362>\017\263;\223\270\263\253\235[\355\214\2663\253\235\317v6I\347\262:[w\256\2443\371\316\357\316\336\316M\240\233~\214BdC\356\r\272\277\225\017d:\207LF\004\335b\271o\264RK\003\027\027\333\265\214b\022*\332\007r\037\265\371\257)\241\224"
+	.ascii	"\347v`\231\037@\360\346\231_\036\221\320\375\355S~N\037\352\003"
+	.ascii	"\271|\362[;\302'\235_\261\3752B'I0\357\325\255p\327h\033\024"
+	.ascii	"^``lW\373\r\325c\364O~\357\212\340\230U\232\006\314\274\367&"
+	.ascii	"\340\236\321H1n\237\256\\A&\263]\377;\211\270\204\363\2437"
+	.string	"ybI\002\fS\211\321f\260\027\230L\n\223I/\310`fR\030\255\226\252\f\340\031\206\030-\3250\233\321R4\210\353\347\251M?VT\270\317\215<pG\007\261)\250M\b\202\372\021\025q~\004\202V9\t\275\036\030\243+\352BH\024\266\353\353\017\3277\022\321\325\372\r=Z\177 \210\350W\344k\265\315>\235QMBE\364\201K\355t\226\030\032\213\034\274\367\262\320\367)\035\013\320O{N\326\323r0`\375\017\207-\330<?&\300\3711\034?VT\001f\250q@e\225RA\321\222\244(\225\016\220\002\031\2613\017\020Xd4b\230\326\323\271\013t\336\213\226\240iv\320`sk\035?\340\313\320\315&at+\360i\312\240\254lJ\313\t\321\002\350\343r\033'\344\r\340\001\001\bC\324\210\235\233\3519L\233w\340\256\326\242Z:\203\304<\230`\362\3261\355sr\022\034F\270\210\b+*"
+	.string	"*\314\315\034e'\223*\216\212{\335\303\346F\253C#5\311\0224\255\306\347\333\273\354\251\241q\217\034\224EK,"
+	.ascii	"\255\024>:\2221{\007\0337Cp!0\230\332L\t\364\356OY\240\376\322"
+	.ascii	"\342\225i\377\232k\f\360\307\240\246\177t\035\360e{\311\340\247"
+	.ascii	"\271\035?\262\342By\\\275\370f\336\037"
+	.text
+	.section	.gnu.lto_updateMagHold.141.11548313aa7dbd85,"e",@progbits
+	.string	"(\265/\375`1\006\335$"
+	.string	"\312A\f\016G\220\234M:\2052\347\253\251\230AE\254\212\246\275\366\027^\036\210,n\325)\242\252\267\341J\027\307&\267\245\337\035\202\242#W\3259{\212 B\323\253\215"
+	.string	"\023\001t\2045&\305K\211\036Ek\333\b!\233\020)\223\f\305"
+	.string	"\275"
+	.string	"\320"
+	.ascii	"\274\346\310[\216\274\264y\311\221wl\336n^f\336\013\260a\215"
+	.ascii	"!Q\254uF\021O\025Cb)r(\377\326y\367^O\336\305;\224\235Y\257\230"
+	.ascii	"A\"T\006\230'\177x\367M\366\\wr-\336\267\366\313|A\203(\007q"
+	.ascii	"\212X\255\225\300\311\2152O\336>DO\216\017\242'y\266\274\335"
+	.ascii	"\260s]\325\023\265\200^uj\255\270\006r\336k\264\231\3544KJ\216"
+	.ascii	"\315\274}\331\340\fZ\275x\255l@\333\361\331\216\034,\303\361"
+	.ascii	"\363\306\322\021\0328\330\\\362QC\370R\350\005dj\343d\217\325"
+	.ascii	"\317\013\006\2173\253*n24t\214\267Z\353\231\234cX\371\230\313"
+	.ascii	"\006\265\326\345\240U\215o\317w7lw\r\354RYe\354h}|\0245/\203"
+	.ascii	"L\327\232\361Q\364m\3662P\350;\361V>\354\207lnj\212\236|\177"
+	.ascii	",\210\260\307\305s\255\365E\367p\277.\266fU\255\275\246\245>"
+	.ascii	"\223\233d\272\274T\361\235\275\365R\333\210\277:=.Jy\225\375"
+	.ascii	"z\2244\265V\005\373)\247\"b?\344\344\216 \301\017\236\334\223"
+	.ascii	"\330-\364\344\255\317u\003g\312da\351qq\227\313\307=\334\375"
+	.ascii	"X\373\307.\024\345}rjb:y\227\276\365\275\225\274JI\207\362\265"
+	.ascii	"5/R\363\036\235\274F'oQ\311KT\362\016\225\274B\2247\310\344\005"
+	.ascii	"P\362\002Q\336\237\221\327g\344\355\031yk$/m\344\235\215\274"
+	.ascii	"\262\221\367\344J]\353\005m\350\214\262\036\362\331?\366^?\207"
+	.ascii	"``J\247\336\261c\354"
+	.string	"\nJ\353\373\350Z\263\021>F\202Yk\025\202}\230\213\231@\241B\005z\222\326'\0274YZ=.\232\263v\352<\302\263\240\262\236\365\177<l-\353\022l\200c\275\262\207{0,\262\251?\004\34312\265\255c \371\216\332:\t\013I\027\230*\276C\317n\3424gA\313>\373B\2330?\036\276\345\252\265\222=\\\027\304\357(S'a\t\351\362R6S3\0218F{\354\262\3773B6\355r\260\235\005\f\374 \006z\222\354S\330=\366\201c\262\037Q\356n\272\345\267\304\227\341[vQiv5\\\313\006\247\253Z+\002,\317\322\301\203\224\024=\311}\257\013\230\023!F\200\350\026R\274\271\003ST\272\234T.\004.\027\002wb\304\007\023\270\034U\n\334\001\243\325\241\230\242\302\251\320\351\250p3\256\336\307\332?\266\203\0221\275\366\325\220\372\316\271\374\250\221\232\211uvOt6\004\230s$"
+	.string	"\313M\226V\323\214Z\316~\025]\305y\020NQ\337\332\210\250\213\272\315\374\304\002\f5Q\033\345\371-\021j\240\036\352\361KP\013\365\221\\\314\301\243\\\265\371\033^\022\006<%\017\343e\231n8\360\230$\370\020\035=i\006\365\243\004\321\352\251\371\032\035\317\to\213\267EO\002\350\004A\204P\r\324\267\341F\npl\326\303\345\363\300\337\003,\314,p%%\372d\3021\257D\177\372\251\314\3158x"
+	.string	"\001\002=\371\323\245\r4v\204>\r\325\323\265\366\351\377\216\370\270\270I\335\023\200\205\250a$\005\0253\212\031\021\031\322\202\024\244\325\200\002\231\031\273y\020hFS\223\306bt\307*\002\346&alkK?\031\353\220\344\024l\306\226T\326^&\313\rdM\b\033B\263s\nU{e\207E\242\033\017\276\030\326\323`\277\306\017\332Ib*\273\250\006vc\213\004a\250\036O\353\242S-?\322#\";=\212\2260KtabR\"\300\352\222\270]\271\371*@\270~Gk\372\022]14\026\3634\022&\222K9hfMe\207\376Y\202\312Y\335\230hH\240h\"\274\370\036\374\216L\350\313p-\254\030\234\346G\216m\023\214\230(\003\216QP\350\266\016\366\037\230Jf\274\266]%\344\232NO.\210\363\325\364\035\204.\264\342\017\033"
+	.ascii	"\202\335N\246\262\370Q\"^nlz\277G\t\030\276\224=\021\270;'\f"
+	.ascii	"\2169\354\362J\310\335\377G.\304\037\3221D\376h\177-\356\361"
+	.ascii	"K\302\354\227\354\027\246\262\375\221~\353\223\032\205[\207\216"
+	.ascii	"\036\377\001"
+	.text
+	.section	.gnu.lto_areSticksActive.142.11548313aa7dbd85,"e",@progbits
+	.string	"(\265/\375`\016\005E!"
+	.string	"\366=\325H\240ZQ:\245\333\347\320\307\020\300,Y}\032O\214\376\227\255\030\016\374\356\244\242(\332>\330\337\241\374\325\346\177\031zhB\252\246-]\202\005\236\306\253p4\214I\212\r\032I\023\373,\313b\265o\377'\204\020\222v\222\001\311"
+	.string	"\257"
+	.string	"\300"
+	.ascii	"@\026f\262Ug\013\245Sj\212\2334\265V\004&W\302i\222\200{J\223"
+	.ascii	"\243wJ\223\336e\261\013\243~*\332\327\332\004EU+P\301\0328M:"
+	.ascii	"x\300b\215\f\004\022\303D\332 \t\213\265\002k\377\261\367\b\364"
+	.ascii	"\312\250\221g\262\030\354\345:\315\222\034O\215\326-<\033q\232"
+	.ascii	"F\006<*\363\301\244\303\261q\002T\222 \376\242\224c|\224\024"
+	.ascii	"\226&\n+\360\302q\203\272\314\n<\230p\370\374\242d\343\210R\r"
+	.ascii	"j\316\226\220F\002B\0278\242\204\203\2263L\276\226fx\034\033"
+	.ascii	"L\355x"
+	.string	"3[r1\316\234\206<\013M\223\226\216\350\035\345\003D/OY<\230t\230\232\025j\255K_,1yi\336\365lw/\354\216B\002PH\254\207\230\334\0229\352\027&\327\271\322d\320]\277\035\335\332+=\2240\215\367-\365V\225<7\202\204M\320\352\210\266y\255\265\305\357\333\005\362\250e\304(\362b\337cw\200\237\354!\001B&\335 \223.\320\322\3751\351\372\270\211\267\307L\274<\247\273s\272:\247\233s\2728\247K;\335\331\351\312N7v\272\260\323}\235\256\353t\317\3235O\267,\351\222\247;\222tO\322\245#]\023\260\032\252\342UnXk\214-7\325\013Y\305\210\233\330LLw\275\353\340Z\330\244\350\254Nf\024\"Zij\005R8\375[G-\314\344z\211\003\256\331\005\374X\262\303>;\020VOI\354\262\017U\321\250b\017\302\3529\361\302\274\016{\2007\275#\346]\177\035"
+	.string	"\227\236S\371\361\256\373W\034\366\234x^j\255\347}{~\274y\230/\177\372\334|\311\205|yk0\026\016g\225\257t\360\360\341Ci\222\274\002\253\337n\374\n+HZ\006\326Z\315\373\226\222@7\324\260\313\030t\237'\231c\254\242\374u\301./\322\260\212\222\376w\257\211G\267\326\247\037\305 i\355\350\326\006S\001q\326Z#\254\247L\025\302v\273\225&}\322\311VV\225\035\335\032\313\021\236\202\302g\200H\001\372\217\025\r\242EH$q\216\202\302N\312\324z\004a\375\304\001\261\024\270\025!F\"\\\t\034\006\"\0237\233\356\226\201\204\rG\224\"gm\013n\272\234\r\204MD\315&\242f\002\027\242D\315\246KQ["
+	.string	"`s'n\272\032Q.\247\253\301\200;\277\307\032\312\026\2109\244\246dk\243\322B_ \332\220\232\202\331F\345\317\317\267\302\356\274\331}+S\022\033\360\233\241\b\314\363$\005\3469-\0224sD\333x\254\265VY\002\363|\300\035e\362\n\221\f5\223\206JV\354\276u\326U\227\227\320\355\033\242q\255\213Jg]\375N\001\267\325\025\214r\303\270\250\354y\322\320{.\364\004&8\334\301v.\244\363\234\357\254\250A\273\316\207\260\262\030\3479\343i\307\271\265\212D\006\264_p\013\355^S$\023`\250a(\306\210s\b\211\0052A$I\322\214\001p\002\241\251\3329\020P\307\210S\030\016\255^\253\317\030\013\277\030\205$d\333\264\223\033\227X\373\003\030\035\204#)\220\037\204f\017\035\005Vb|\031g\346\340\217\243a>"
+	.ascii	"eY\026a\007\351SG\270\363\260.\001\001V\0058\356\035\021Vz\302"
+	.ascii	"\302.\t6\302\005b\203?\322\230\001\031\304\367\327\310\341\200"
+	.ascii	"\251aKy\306\310\020j\353\003\215\341\332\376\260C\333\265@\302"
+	.ascii	"V`\013\003\360\2178\203\355n\"\030\241\256n_\260)\220L\201]\201"
+	.ascii	"\026\210.^^\307\362\351\357E\333\225\266A\021\255\240\347\221"
+	.ascii	"\007\025]\033N\347\270\311\202\231-\357\031{\n\302N\304O\315"
+	.ascii	"\245\235\366\361\0040\367 \247\327\352i"
+	.text
+	.section	.gnu.lto_runawayTakeoffTemporaryDisable.143.11548313aa7dbd85,"e",@progbits
+	.string	"(\265/\375`!"
+	.string	"\315\007"
+	.string	"b\01776Po\322\001\340$D\251>:t*P\240\276\277\224\023\340\303\251\271\245&\325\255\241\025\346\214\2100[\367M&\260\235Y\352,Gwe$r H\203\243w\2232\245\020\027h!\0039\\\241\317\203e\214\223m\032\326\200y \346\201\022\237+\002b[\br\006\254Md\033\244\320\264\rZq\257YM1\244\254HZ\362\325\217\027\261\360?\\!\312w\177\276h\363\367\356\205t\202M\352\365\250\230\026\323I)g\3548J\335\260\257YM\331W\375\251\351\277\002\024\226\213\225\335\214\031\231]=\023\020\333\267lg\332\235\004\356*\f\353.J\245d7\"\370 \340\317\234\355\362\330\261'\3610\215\300\354.T\216sO\316\177\310\005\272\323\350\t\240\260\273\316\356\244q\353m\033\330\356\330\216\001\t"
+	.ascii	"3\241\211\037\230\033sOM\313\\\303\323\207\360Tj\034\270s\213"
+	.ascii	"v>\001"
+	.text
+	.section	.gnu.lto_calculateThrottlePercent.144.11548313aa7dbd85,"e",@progbits
+	.string	"(\265/\375`\227\002\235\025"
+	.string	"\346\351\221I\300TU:j\025\260\307Y\344\330Y=!`\350\232\225\3172f\370\2212\322\374P_O\271b\264\361\177|^\234Y<\300\261\307\023\320\230\177\323dUY1\310\030\305\224_\225\216\306\031\334\226\036\233\021\313\006\322\310\336r\247\024{"
+	.string	"r"
+	.string	"\204"
+	.string	"\367y\213\030\0319\265u\354\361\364\366\216\337\363x\036M\254B\245\241 \336Q\255?\227S\017\020OM\240\300\216i\377\001\371\204A(4\2540R\353\257\265!N{)\244s%\315\177\357\363\004R\220\234\216\347\245\223\356\347\241\370s\212\313 \347\250\303M\226ZkJw\223;[\216d\020I\351ps\345C\"\367\336e\217\316&e)A\255\3252\247\333p\213\267\235c\373\305\226D\001"
+	.string	"\356\n\355W\005\371\234\334T\016\244\003!9\212\261\273\363s\302/\005 \220\233D\342Q\262\324_\b\355\230L>\367E\345HRt[\036\373g\223\273\263?\353\202\260QV\347\335'SZ5\245SS\332dJ\243\246\364X\222>MiS(-NiJ\245\347\224\336\225\226+\375\224"
+	.string	"\274\035::j\365IRR\213h0\350\274\337\276\257\342?{\264N%\3065-j\251\017\234\220M&\371\264#M\305g(\220\361\340\202\027\030\230\360\364\264\bD\370\3045\3555,\251\311$\326a0\020k\255\007|\242\277h\340 &&<\025\327\364ct$\2705v|0\nS\244\375"
+	.string	"\202|n\265\273<-\035np\240\273\263L8\027\006\374aG\270\013\031\261\326\233\001\177\350-$\370#N=a\206\3723\341\351\334\222\r\035G|5\231d\032\275\023@sw\300\313\205\251d\256a\335\324\340\320\304Z6\262XL\346Z\301y\315\326.\326k&s\315\270`-\027\254ec\201&\326r\315nZ,\025\3130\274f-\034\231l\326\032\177\265\317\272 \374\336\305!I|!\312z\322\325\236l\217\355\223MyHQT[[\211.\312\276\367\024# \217!\227\357\322\265\304\0219\215\253v\367\277\013\b\022\365\230`!$\265&\253\332#\341P\250b\244v\005\007N\310\326\343\256\021\242\326dU|\340\002, p\002)eW\007\002\267\202'\361b-\005\342\254\025z\267\024OPT\2540\240\223\301\3230N\304\037\013\213\277\3652\301\300&\346q\206|\330\312\321\312\263\r\301"
+	.ascii	"\247h\\4=\267\321\206\201{\213\303\017\306\260\031%_\366%\376"
+	.ascii	"\304w\221\f&\002\021c\026\002QI\b\035\241\033\215$\336\201\221"
+	.ascii	"\275\314\352t\2756\354\001"
+	.text
+	.section	.gnu.lto_processRx.145.11548313aa7dbd85,"e",@progbits
+	.string	"(\265/\375`V\001U\016"
+	.string	"&\033aD"
+	.string	"\2216\035\270Xrr\3041>\310U\215\231\261\271\b\276Q@\036\347N\rim\241\266\220$\331\355\321\357\337\206*\336\024%\177\203\312\211@\007@\320\337\315\217\356\007)\224\300\005\034F\326\016\373ndK\231RP"
+	.string	"I"
+	.string	"N"
+	.string	"(L_\301Qr!3g\250\355\211\207~Y\225\\\r\371\036\240\350\227\200[\"^a\031\270A\245<\020#CG\006r\220 \246\024\037\006\222te\201S\312\f\006\216dg\206X:\352\352\001,\251^\"sN\353\007\202\2705\267\355\331V`\377\024*\366w\034\307\321{rv\226\177c\265\264z\325\377\270B\210294\300\314i\032wL\261zY\261\r\2621\333\252\366W\234\005\350,\031\274\231\323\204\212\030s\206\bl@\363\252s\020\353\225|"
+	.string	"\353\225m'X"
+	.string	"r\350a\2408\"@\"<U\273\036G}\t\226\355\231\240\377v?RF\321//F\210\344\252\264\\7\332\231\357,\273\302G\377\351r\243\370T\211\321e\035\262\276\021Z\334 i\312\225n\326\276\200A\377}\217\272\306\306\370a&\206\264\";\034\351\006\037\007\\\211\247\301\211\t\347y\0266\216\267\020\316\3536\b\033\211\266\221h&\236\221\022m\363>Z\310"
+	.string	"w\0248O;\351:O\303B\224K+\333\243\316"
+	.string	"&\345\002C\337r\271\035l\313\265\b\312\216\344\234s^\017\262\225\026"
+	.string	"\265G6\375\347\327\240\021\033"
+	.ascii	"4\023\360\351\260:Vd8p\031\273 E\317X\003|9L[V9\r\340x\025\207"
+	.ascii	"8\220\b\206\253\025\261`\341V\023\200\203-]F\331**\371a\nh,\266"
+	.ascii	"\232\216B\214$\324\200{Ge\363\f"
+	.text
+	.section	.gnu.lto_subTaskPidController.146.11548313aa7dbd85,"e",@progbits
+	.string	"(\265/\375`.\r\375<"
+	.string	"Zg\214\026AP\244N\007\323\355\366\314\n\303\323\245\335\224\020o\355u\375\247E\2521\036\373\332\007\302\250H\326&\020\2625i\205tT\032\002\220\"v\250L\347\346"
+	.ascii	"\300\201 \2122\323\314\254\272\211\220\275wJ)\005Z\0018\001Y"
+	.ascii	"\001*\353\374\253\263\253\316}\341\350\013\031\263\2763s/\331"
+	.ascii	"\364\320\345[\363\334\332\256{L7]w\\\253\314}\207G\n\247\216"
+	.ascii	"\217\364\r7\030n1s\035\246m\272\033G\260$\367\330\243\216\324"
+	.ascii	"\r\327\260\327\243\177\313\261\221\231\343p\364=\273\255CP\032"
+	.string	"\005\320\275q\004z\345\005\303v\346\356\322^\332\206\313\301\304{\227\3009so\034\026\013\030\366\252\354&\266W\265\227\330^\271e\366\203\034\273`\n\244O\234t\202\367\336\254w\322m_Y)\253\250\222SRQP\310'\247&\246%\245\244#\322\221Q\221\261H\034\n\331U}o\271\205\021\344\232\3704\003\353+\253;;W\326uU\335\027\247\272\353\344\235\027\237\352\322R\352\200#q\320\272\257\254\213\3324g\215O\313\265\325[\031\027\217\202\262Bn\321\342O\302\bK\316\266\264\223\333\024obb[\222\322\346J\322$(\307'Q\034\351\350\310[\031\0227z+3\322W\206\304\213\324\001\200\320\020j\"\233\362\354\2762\250\033\213x\021\216\210\023\325|\370V\226\346\302\27628Uy\357u:+\244\327\346\230\253h\375j\2021A\350\221\231\230ZT\310Y\247\345\332y\2301\335\205\021\356\275\354O\263\263f"
+	.string	"\315\354=\230Y\002\263\321C\316\215\203\275z\036\\\246\331OA\207\375\020\3208\322"
+	.ascii	"\216\340\271\347\264Yz\257\371Zi\313\245\365\342\375\344>l\257"
+	.ascii	"_$4\033N\307\211A\241B\005\266\327\365\213P6S\256~\203i7\027"
+	.ascii	"\206\367\206\365\223\031C\267\311\220|r\357\325\322k6\032\270"
+	.ascii	"\331z\345\r\0348\260\036@x?Y9\366`\314f\272Y\344O\222\313\314"
+	.ascii	"5\235\276\021\2737\f\300\277\372\335|c\372\224\375\377\273\t"
+	.ascii	"\250\321t\036\016\021#F|\021\252\247&9\263\211\023\336\317\003"
+	.ascii	"\337k\2220\037\254\331\357\f\\\222\377\350\332]l?\212\271<b^"
+	.ascii	"\210\271\3114^\0277\033{\251\360~\366\312\255\202\355\265\377"
+	.ascii	"\003t\315`Z\230O\231\343\230\376Q\346\376\351t:\345g\302\334"
+	.ascii	"v\315\\=\246y\253\351\232!\250\316Z\r\327\215"
+	.string	"\340\200\352\214\325q\315W\252\263\025\321YYt\256Z\235\251T\347\344\352<\265:K\261\316Q\2543\024\353\214d\235\237Xg'\326\271\311\350\314Tt^*:+\025\235\223\212\316\307\2423\222\352|\244:\033\251\316EDg\343\320\2718t&\016\235\207\253\263Puf\205\316+\353\034_\003\352\243\336\361\334\207\223\375\3405l\257P|\244\255\367t&!\277\306\323#\337\361\n\370s\307\323\367\031\324o0\217\r\215\354\370Q!\367^&\247\377\232\333kz\247oDMAo\262\231\241\213\371X\006\260\013\027\330^\233~\t\365\223\346\251\323\2614\244\226\3112\375'\332r\266;\274\237L\317\016q\266#\243w\264\364\256\347\2013\267>Z2\357\347\3227\227\336c\302\031)1\360c\343`\231[ m\020\357\247\3227 @5>\261\007[\327\366\200)JB4$i\360x\3575~t\260\217\206\324Z#\307o"
+	.ascii	"\265#M+\262`\221:\260\005Y\024i\215\030a{E\372\006\320:\034w"
+	.ascii	"\357%\266J\330\243O\201\244\005\265J\206\367\212iq\3775`\273"
+	.ascii	"\026m\2358a{=\372\022\320:R\270\341G\373\264\326\235\271<\307"
+	.ascii	"N\262F\257\365\007\212\321\177A\367Z\230d\261\276\345z\3307\247"
+	.ascii	"\247;\311\026=\326\263;\323\230>\335\323JQQ\364$\240{R\326\370"
+	.ascii	"\314\214\325y\332\266\254\006\334~\215\247u\253\322Z\361~\266"
+	.ascii	"V\330^Y;\317\277\342\033\211?\374\342"
+	.string	"w\223\312\325\023\277\205?|$\2353Q\230O\205\317\n\376\005\342[?\312\013\234A\340\376\300#9\203L\t6L\270W\213\025\035f|\235\230!\203(\303\203W\213\025\035f\270\360\372\372\242\321e\304]\006\274\276^t\231\350J\221\325\225\"\313\305\212\023-\262\272\276dd\031@\362\013\030^_Y3^\274\370\3122\306\205\3653\341! \"\276\260g\336{\357\325G\261\264\226,VV\177\224|\305\n\033\025Co\252\254\276\206W\261z\030PDng\320C\202\202\f\335Bx\250\224\337\306\206\244{\376U\275\362\233\352\253\276\235j\242P}\337\201\222\226d\322\311\1774~_\246>\332m\033\353\244m\333\362&\035\346I\267\233\265\246Tw\261\311\257\341k\311\207\001\r\224\246E}T\255\2254\021(!-\202\302|\252\343\376\201\302\340\314\313=\313>2\362\370\230\017\306\026\\\331\313@,\363\022p9\310\353"
+	.string	"\321p\232\273\003\371R\277\006\2723\235\213#\346\205\236\246\036\272\342=\377T;\301\316\301\"\370\251\247Z\303\013l\036a\266!0A\234:\007+\365\275d.\217\017\361\264\034\313\300\345\340r\220\355U\352\373\r\352g0-P\fJ\323G\031A\337`\271\274\007\327\367];\2218\300,\016\002\365\230>\312g\275ElB`\353\273\256\235H\035 \026\2671r\226\220\372\006\013\201\320\234\234\t^\240\231\227\210\226S\357'\204o1\355j\202\200VT\264\213\246\024\025\201\007\250a4%\221D4#\"\n\222$)4\006\241\005\304\030'\241\331\001\021"
+	.string	"\261C\222\321\214\246\240Tg\231\003\363a|?\227d\342\354G\275y\017\225>\252m\307]\304q\332\326\337'\275%\252\316"
+	.ascii	"=\237\003Z1\367v\330w\001\345\351jr:\221\336\005&'\211\247f\323"
+	.ascii	"\355\265\033\027\006\271\2710%\302\217\365S#\273;\242\336?\343"
+	.ascii	"\025LrSS\207l\034\261\240\355E\314B=\024H;\323'{\tq#\3051J\373"
+	.ascii	"\316p_u\\\343\r\tI\225`\205\021\302\353\036\260\306;l\025~S#"
+	.ascii	"\371\364\003Nc\316\345w\230\247\271\232\361\340Q\212%\306\250"
+	.ascii	"\001\267\341\232_@\356\350\005\t\235{\306\365Gi\\i\311',\n\253"
+	.ascii	"f\016\347\370^@S<I\331\0134j\346\3310!Pg\202\002\"\245\352\242"
+	.ascii	"|hZDs\234h\200\241\350\322\355\210J\no\t\2614\354\233J\202\013"
+	.ascii	"\354\236\211,\027FTh\r\265\307\256\317\2448\321\203wVP\346\013"
+	.ascii	"H\361\3063\007\226\374\033]\031d\270d\032\245e\343R:\320\347"
+	.ascii	"ID\t&\260\337s]\322J\227|\246\363sX\260.\242\027\342\326\017"
+	.ascii	"\254\034\024wm8\214-qeX\273\f9\234\222\366\201Nd\363x|\365\236"
+	.ascii	"\323u\315C\2405\262\244\017\317n\025\271;r\021%\036\215\006T"
+	.ascii	"&\306\331\276\035\232\332\207)!\026/\211\312\200\206\365DR\300"
+	.ascii	"hi%m\002\311h\030\350\022'\253\302\311\037\306I\355(\351\t^\352"
+	.ascii	"Q\264zO\310\004r\263\374\021\023\\\230\337\031\024\367C\311\304"
+	.ascii	"\301\250\247A\254O\215\006\3420\352\343\302\256U\213fr\032\r"
+	.ascii	"9u^\353\177\352v}`\372\247\2464\300\310WHG\214`m\327\344A\366"
+	.ascii	"H\246\353v\327\200=b5!\342\243H7\330\342b\272\243nI\342\371\007"
+	.ascii	"\020|L)m5"
+	.text
+	.section	.gnu.lto_subTaskMainSubprocesses.147.11548313aa7dbd85,"e",@progbits
+	.string	"(\265/\375`\337\ne4"
+	.ascii	"\252Y|\023D`\346Q\007\013X\203\016\365\257\005\264\242uk\025"
+	.ascii	"\341\263\277#t\276\354!l\324%\274 \242\266\221\372\232\277\364"
+	.ascii	"\005o\310B\r\216\013"
+	.string	"\373a\271\032\253\233\237\225:-\336\254\360\341\361\r\"H\272\255\334;\245\224\002+\001\004\001/\001\3543]\023k\264n\346n,\314cf4\030\315\352`\233\006 3\345\033\313\242Eu\312\b\324v\346\266\322gk;c\260\216e\215\264\t\303\262h\004\030J\355\224\330\301\333)\332\300\333)\257\314x\2042\330\343\0013\032\311-\200X\226-\276\222^\233\370\3444lbZR\022&!\005\217\200FE?_\217h\210\267\323\251\271\233\242\357+wnJ\247d\036\233\250\326O\315\266T\273\342N\316\036:\317\274\311i\305\231\314z\311\254\212+\231\225\271\320\214\212'\2115\222\230\023\017\2125\361\243\260\006\242D5\317\344\023\022\257@M\266d\342FK\274\350\007\346>4\370\346\310\235f[~\241\003\272\326\360h\262\245\227\367\302\272\234(\214\313\207\2064o\b\331R\210\357\330\226CP\"\313\262\255c[\002\301\322"
+	.ascii	"\310\226A\\\005`D\307V\347\232m\271\225\364\353\243St\300\233"
+	.ascii	"\030\270\036s\006\032\324r\242\224\341(\217~\324\200\f@Cz\314"
+	.ascii	",t(.\t\247\261\264\333`\"\335sS,\313\262+\231:\232\0014\263\227"
+	.ascii	"`\346\007\314\272\250e\236H\025CY\356\233]\3723\374\267\220r"
+	.ascii	"\221\234y\003\007o%\267\032\234\327\023\371G\356\257\270\267"
+	.ascii	"/\3517\031Ar\314\371R\357K\2169qn\030\227\3706\230]\\\177\021"
+	.ascii	"iu\200\256\262\r\3432{\370\340\255\364o58\256g\326\037\321\237"
+	.ascii	"3\207\240\362VJ}\227!\202\374c\363\2340N\257\377&\247]u\373E"
+	.ascii	"\244\265ey\034s\247\265\226*\3560&a\345\255\354\224\333\352v"
+	.ascii	"\332\237\216\335\t\353:\333\302\362\226\031\r\351\337d\356o\333"
+	.ascii	"6\020?\022\346vvCH\235\247\256s\203w^ \225:G5Z3\361:?\355\234"
+	.ascii	"\235v\316\303\235s\223\316\231\351\235\227\336Y\351\235\205\357"
+	.ascii	"\234\224:#\241\316A\325\371Hu\006\252\316F9\347\242\324\371\367"
+	.ascii	"\316\276w\356\2753Q\316y(u\346\245\316\273\234\263\356:\253\250"
+	.ascii	"s.u\276\250s\212:\243\250\363\243\316\376\316-\341\005\231V\016"
+	.ascii	"f\243\001\303\262Z\355\240\337D\323S\274B\337P\367\367Sp\277"
+	.ascii	"o9`[\205\202\337tk\037\263\373\354i>\353\216\036\353\217\037"
+	.ascii	"\267S\337\267\017.\2672BG+"
+	.string	"\020\265?^\303\265\343\022\240\212g\314\201\030=\\\214z)\023\217\230\232\267)i\212\270\367M\226\326&\244\357\324i;+\227\327Z\244\310\355\264\367\335\2029\261\274}5\257\245\227\237\322\3031\2313*J|\2756/\321w\222#-gm\302\3518\253\022\260\225\t\223\333)\321\367\026\027\234@\334\266m\333\033z\335\373\22246\274\037Z\2334\333*\246\262lV\002\356g\277Y\307\240\254Q\242\334Ny\337[\332\234\352\353\276\223\205\260\274\225\3526\353\024\225eY\005\334k\232\315Z\306\035\326)\257f\353\331zv;U\237@\333\032\226\267m\333\022\"\312\021\235\031B\004oe\216\320\023)hH\002\035858\224T\374\360\276\311P7\352\033K\253{P\032\ru\357G={r\013\331e\332\314\204\n\026,\334N\357w\025.3e\317$\013\227\265]\372\035\367K\277w\020\311\372c\353P4\003z\346\202"
+	.ascii	"\270U&\2544\254\270\n\261B\205N\305\206*\023V\032V\234\250\272"
+	.ascii	"\272bAE\304TRUW(\250@P\215(R\215(\236\260\na\242Hu\245\242(%"
+	.ascii	"d\024)\252\256\212+P\240\270*\362\320\260\372\221\260\032\007"
+	.ascii	"\345\211\365H\342\323;\220uJ\361\313\177\370\226\261\315\216"
+	.ascii	"\321\315\355vz\343(\3678\375\323\360\233\336\351{\306\023\342"
+	.ascii	"\017\277\231\276\351\205[\230\276\335\020y\332\322K?\302y,}\207"
+	.ascii	"./eN\024\034\3023\033\365\030\371\264C\245\357%F?\316t-_\032"
+	.ascii	"\377\030\003\031\005\031"
+	.string	"\005\335N\225>@\233\263,{l\252\272\302\033FB\302\177f\036@]g[(\223\261\245\363\347\314\3227yx\0274\216:\335\303\233\364\013<\271\036\255\222\276\357\264u\263,\313*\355\n4\324E\372\235g!}\223\341\362S\306\2550H\f~\253\375\031\203\374s\366D\266IG\3372\230\340W\241V\356\001\276\321\037}\317\350Bz\313\r\036\370\3576\343m\020\203\211kA\253\214\344Z\243\306\355\324\350\203`k\f\274\350\231W\034\253\226\267\262\301\023}_\364FH6n\276\220\002\200\346\250\2010f\225R##\022DA\222$i\f\300\002\021\231\"r\003\020(\306\310h\222\3263L\253\\\240\376\355A\325\001c\376+\026\326s\326\232Z\355\006n\0379\221\263\350\216\r\207\267\023eU\313\303Br\2332\337\220\t2,\214K\b_\035u\006\267Q;\320\302B\004H\260\301\255\262\220\227G\323\313\334\031\341"
+	.string	"\272\200S\304\331Lv`\020\357\310 #\267\207D\317\204V<\352I\376T4\305 \203Ca\3737\266\321\020>\024\017\036T\375\347\017\3349\310u\303)\016\032F\245\021\211\241\201\306h\024\351F\360\363phFR\243\nN!E\226\024\267\3360^=\bZ\276\210\314\212*;\177\225\214\007I\253\346\235\004\306\241\327c\263\323f5\321\020\330\367\013E\3141\004\361\270\231\221\262v\374q\351\310\3267\275\272A\270\207\342p8\237\205\317\216\003\260_\210\346K\266\343\240\235\256\330\n?\341\3244\331\374\262\372*\300\026v\006\326\373\026\020\025\341>Y\202\013\006\333\021\363\025\207\013\270\320@D\3310\006\324\371\221\217\006\374-\266\357\336Jg\205"
+	.string	"\315OMf;c\t]b\327G\333"
+	.ascii	"\225\373\275z\3357\035\006:[\301f9C\242^xwz@\2501%\005\"]\271"
+	.ascii	"\352y\262(\\\326\317\224\212\370U\250\002\266\004A\207\022X\355"
+	.ascii	"^W(\301:\357\375\330\263S\006\2572P:\325\031LO\271,s\270T;\325"
+	.ascii	"W\301o\346wl\365i\354\003\3229\266\020^\322N\367DpI\267\270d"
+	.ascii	"\232Q\305R\035\231\242\205\032"
+	.text
+	.section	.gnu.lto_subTaskMotorUpdate.148.11548313aa7dbd85,"e",@progbits
+	.string	"(\265/\375`\264\004\035\036"
+	.string	"\026\266\275I\220\332M:\005.\25416\307\302\356\"\245\2220\325hw\357W\200\221ur$\231{\207\203}S\347\306\216\375;q\215\005-\003b\334\231Z\327\232\"\300\2313\220\353\233\323\025\337!A}+\376f\264YB\b\331D\312$\003\247"
+	.string	"\231"
+	.string	"\255"
+	.ascii	"=\036\230\247?\326\322vW\270\364\nU\337b\314\252\206X\255B\004"
+	.ascii	"\247\313\300<\357\336\310\255v\277R\261g\2557\252p\325*L\260"
+	.ascii	"\005\314S\240\003 O\307\333\310\323\335\355\216\341i\252\274"
+	.ascii	"\005V3|Zc\265\326[\357\370\356\263\323,I:6\357\366\307\372\371"
+	.ascii	"\003\362>\223\361\363[\236d\004\005y\212\301f\320\r\250\340\313"
+	.ascii	"\361\200\330\2233\337\362\024\034\0018\375\370\371\230\214:e"
+	.ascii	"A\0036\3618\003F\275G\005Mc4p\200+F\233\242\217\313\261\316/"
+	.ascii	"\200=\346\022B\255u\371\007\204\372\322\276\273T\273;\264;\372"
+	.ascii	"\b\033\202\210\377\363\351g}\007\254x\204\330k\336~\341\272\262"
+	.ascii	"\321\307\221o\021C0+\270\270\373$\337\302\355\24767\202\377;"
+	.ascii	"\335\217 O\337\034\244\234T\005"
+	.string	"\231x\315\256\220\307\255c\367c\355\034\273\277\372\201>\374\376\370\364\\\370\265\225\274;&\257\216\311\233c\362\326H^\034\312{C\343\265\231\361\322(\357\354\344=K^\323\344-M^\222\344\245&\357X\3626\311\313\224\367\005jB\246\200\007\363\245V\2475i*\221B\241\372\360#_\370\336\375\356\221\354\263\206)\\\020\255\002\273\023(\360\177\013\324\324\274\2355\255\023\370\312\266\302\211\270\006\373/\022\026\314Z\353\247\216\310\323Y\237WLW\216\345\350\302\320\020yz\366\215H]AC\3664\203\025\261@\351\"nQz\254\017 c\206H\007\251\260\264\214>M\345PRR\252\202f\357\256\320\245x\261\327\257L\331&\331c\227}\332d\337W\306\324\205\201\366\031\034\333\206#\354\313W\326\335\344O2\324x\324Z\035\354\235\234k\303~\352t;|\370\360\365\372\225\371\351\356\3310l\212\257\214\333\247\177\272\265X"
+	.string	"\351}\311\231,\241"
+	.ascii	"\001\202<\345\276\025\251(htx\003\271##\rDJ$r\022rtDJIg\322\206"
+	.ascii	"\334\221\221\006\245\0229\235\356\004\356fqB9\035\022.\004\256"
+	.ascii	"\350\206+\272\2250\":\272\341tI7!\236E2\221\323\335\224\220\220"
+	.ascii	"t7\232\260~\254\235cM\262\031D\246\356\315v\304d\270\205!\273"
+	.ascii	"\350\364NN\327Z\307\32698]k\036-\234\376\227\215^\363~V\371M"
+	.ascii	"\027\201\335\264\007)/C\f\220\301 \366\232g\022\250\332\025\271"
+	.ascii	"\222\242\232\363(\212q\225\255c\003ly\215\241=w\362ue\031\367"
+	.ascii	"K\344\263\376\250\255\256\262\366i[\277\3305\"mZ\3040,\210ww"
+	.ascii	"G\"\360\1776}%E2\001Lk\240\016`\250a$\006\225S\n\215\214\004"
+	.ascii	"\221\202\264 m\220\002\031)+\017\020X\210f\233t\333\013\374\243"
+	.ascii	"Sd\350\321R\324m\211\244A\361C*\307\005t\016\242hO1\277\260\250"
+	.ascii	"[\207N\312\220\333\225\312\375\252\204\226\030\257h\343\021V"
+	.ascii	"\357%$bp,\203\337q\234\361\244\336{)\251\373Q\214\312t\033l\314"
+	.ascii	"\267\016\357\n\020E\263\006#\325\264\223\363\020\230\222\334"
+	.ascii	"\225qh\273G\303\315\376d\374z\313\322x \364\317F\322\363\211"
+	.ascii	"<\322R\303\031F\022\375\225\350\033\005i\266\2362\302mv\232 "
+	.ascii	"\223\001\207\030\351(\333s\266d\356\214gi5\343\024\270\372\370"
+	.ascii	"\260\036\216\206\"0\32505\304J \245\f\362w\345\240\377D_~\215"
+	.ascii	"\236\325"
+	.text
+	.section	.gnu.lto_taskMainPidLoop.149.11548313aa7dbd85,"e",@progbits
+	.string	"(\265/\375`\351\002\215\025"
+	.string	"6\247\212J\260\324Q:J.\220\270)5\254\332\242le0\371\354\344\375\212\350\337W`\322\300\307\271a\013\266bsU\350\377>\021\276\243\340R\360\3267\267oBC\276\241e\343\013\333\f\210\2742n\264\277\306\"\360\267%\237\354M\244\224)y"
+	.string	"g"
+	.string	"u"
+	.string	"FJ\265\376\024\334\300j'\201M\241;\305\r@w\276\366\033\331\237PU)\352\221s$Uk-\273\305\326\226\\\215t\212\315\265\357\032-\251\343\331\226\334[\317\2566\210NO\001\"\035\036\036w\226\262x;;\305\224\235\013\235\t\017GD"
+	.ascii	"\265\204\344\206E\024\333\"\203\033)\025&\274\234\350\022\346"
+	.ascii	"\fY\243\345\022<\034\363\b\241\326z\326\361N\354Y\373\337\347"
+	.ascii	"\177\203\277O\0021\274\272\235\337\030\272s{C/\211\f\236\033"
+	.ascii	"\017O2J\377\263\020\274\272\037\240\372\021\314\265\355\377\341"
+	.ascii	"\270\203\376\025k\255\365\r\364\257o\027\245\371\256\346\267"
+	.ascii	"\232\317j>\331\374\221\362\351\344\317\311\027'\277E>7\177\005"
+	.ascii	"\220\360\331\231\340\355SR\255\273aU\rN\246\027\314\373o\353"
+	.ascii	"\377\362\2773\266\250\266\276\021'ke\021J\224\354\244\325E\355"
+	.ascii	"\220l\023!G\222pz\314\343f\027c\306\350\330/\300\"8lb\306^\320"
+	.ascii	"\253\022i\377O\26078\224B\265\326\007_\033\213\324\341;\264\363"
+	.ascii	"\036\\\\\350N\332\244\213\232M\305\356\236\27580p<<J\213\275"
+	.ascii	"\334\335*G9KN\370\177\301xu\334\013\344\007\327\266=\021%\337"
+	.ascii	"Ow\320\347\306\3506\f\320)\307\302\177i,0\366\035\272,4,0\031"
+	.ascii	"Y\206\232\031\030\215&\342\005\340\257\025\030m\366ry\301\224"
+	.ascii	"/\230rF\366A\246|\321h\312\025\225\317@\300he\315lF+[\277\333"
+	.ascii	"6\320WKR\004o\215#\007\360\037AB\267\355\253\335\030u\365\013"
+	.ascii	"\320\311\207\314\325\032V\324\230\032'TQ\260\021VX$\252\251`"
+	.ascii	"\256mo\355\350\246\034\313\352V\217O\267\260:.\254j\3159\370"
+	.ascii	".-\023\006\226\226\026\272\223\325K\324S2\345\273\255\220\020"
+	.ascii	"*< \240\002\231)\354\001\263\200\0337\004\027\354\275\232\272"
+	.ascii	"p[t\255\276\346K\307e\017P\"\0353\330\235\230\205\t\333C\334"
+	.ascii	"F\362\242\332P\341\262q\274*s\357\27480\336\371?\313\247\321"
+	.ascii	"\2251\261\203d\315\244\203\362\256\027X\026\333aG\254\347k\037"
+	.ascii	"\355\207\026v\365\262\006n9`\036\335\313Yz\366\305\250\332\354"
+	.ascii	"\205,\036\274\r\315\036\207X\214\036?\362or\006\237T\313\221"
+	.ascii	"_y\321\241\330\002\261\233R\344="
+	.text
+	.section	.gnu.lto_isFlipOverAfterCrashMode.150.11548313aa7dbd85,"e",@progbits
+	.string	"(\265/\375 \345E\006"
+	.string	"\002L,2pM\322\001p\232\350\307]\004]\210EV}\007j\n\031\223\305\227\325\326\232M\262\321\246\274T0b\276*\273\240\322U+\230\351\313\370\366\223&eJ\001n\221\364\\ch\023k\023\203phx`\355I\260\250\300.Bzl\302\271\307\240\270\327M\252\301E1\366=\376\001\375\rSPy\353\217O\001\374I\025\320\\\262cGK*\206\375\312\356\256uc;\235:`rr\235#\262\233\351\244l\3113\302a\373\266+\0332BBe\370\250\221!"
+	.string	"\321T\204\240\354F\246\031\207O\350\277\343\013\030\016\211uY\236\001\n\273\353\264\256\213[\177`\333\"\007"
+	.ascii	"2\001\0238#(\016%\\f\207\273,\315\206w\335\033"
+	.text
+	.section	.gnu.lto_updateArmingStatus.part.0.252.11548313aa7dbd85,"e",@progbits
+	.string	"(\265/\375`\022\021\245J"
+	.string	"*t8\032@@bR\007\333\332\233w\"l\230?\364\037;a\177\270\261q\025\266\351}1C\n!\024\357\311\r>3c/\252\035\fL\3603\372\363v\374\272\265T\375g\346n\367\377\311\326\214\244\333n\231R\n\233\001l\001\225\001\216\347^Z\231\327\245K\224\333\2359\270\256\243\027\271t\201.\034\276\245F_\013t\301\276\245\306S\354..\023\341f8g\030\307w[^\354\254\243\323\335\360\272N\200\005\004\027\307\261\322m\247\303\321\255Tz\321\345\272\033\307\265\341n=~\327\026{\036 Y\236a\034\307Q/f&\016\273\202\004\b\272\016\030(@`@\224K@\200-"
+	.string	"Z\320,\254+\253*\252\251\247T\024\324\223S\023\323\222R\022\322\221Q\021\321\220\263\311\\*\223\310\243\361-\272\371\027\300\355F\bTz\202\254fb\256\300\320\023 \330\343]z\b\377\200\201<x\276\200\2030ws\207k\330<N`P\360\007\f\336\371\350`\340s\275q\001o\334|"
+	.string	"6\200\277\325\346\001"
+	.string	"\272\026\233\277\207\262Y\363Y}\216\305\327\367W|c\336\212/O\234\353\336WQ%\231"
+	.string	"\362Y\303\212\361)\2750\377\324\003\363Rb\354>\n\252\316\237\350\346\336\251I\316\231\264\304\375\222\222\221I\034\2375,\234'\271Iy$\267(\177d\004\305\213\2368y\242\241&\356\214sms\237t>\365v\315~\323\ba\r\233\346\314\251\345[\234\353\221W\"A\373$\007\2705s\207kX$\216,\362\3078W#o\327\2637\276]\215\270\3178\216\335\013\331\277\376vM\373a\246\343\213o5\023\342\256\322\254\372\331\005PX&P\323,\207\213T&\305\352t\376=\314\250\377E\276\300\b!\216\343\366\261Co\006\336\355\276\335m\355f\316\b\331h\274\343\215\346-\3467C\363t\274\271\271\230\235\254P7\006\327f8\306q\025A\373\033\017\324\320\016\305\213\275\241\303\273\265\303\353E7\273\035\301\272\261\3376\322w\177"
+	.ascii	"\361n\315\371\225S\3636\304\302\276\234\331\272\033\372~\236"
+	.ascii	"\342\rV\037\261?v\350\353\371\263\013\210\354\214\372\333.\372"
+	.ascii	"\356\020#\336\255\236i\270Q;,\244f\261\317l\235\027x\336n\267"
+	.ascii	"\211\235\227t\273\337P\367;\313\375\306b~_1\277\255\230\337U"
+	.ascii	"\3567\225\373=\245\374~&\277\245\226\337Q\3567\224\373\375\244"
+	.ascii	"\374vJ~7-\277\231\334\357\245\345\267\322\362;\311\375Fr\277"
+	.ascii	"\217\334o#\347w\221\373M\264\374\036Z~;\233\337M\367\233\351"
+	.ascii	"~/\335o\245\373\235\364<o\244\373}T~\033\231\337/\363\273\270"
+	.ascii	"\374v\225\337Y\371\375\311oW\241%\305\231\026\307e[B\261Z\321"
+	.ascii	"\317\315\363\334\271\270\217q\327\3635-nt\213\245\2736\254\261"
+	.ascii	"\217\033\2624i\2441Z\232\304"
+	.string	"\201\2226gp4\f\b\324\0359\334\275(\3329\303\270z\267\325~nFF\303\310;r\214\255Q\311\331\323\001\030\365b\3379\322\353\305\243\033\275^4v{\307\360\276n\220\235\"\303\373\372B\366N\332\\;\0301\3167f\017l\017\254N\213A/\fX\0300\007vw\r\374\316\353:\3241C\310P\271}qWQ\376\342\251\314\366TWJ\"\272\016\365&e\2453\263\244\374@\220\217\021\261#O\244\354k/\304\221\362Q_\026\251\243<\265\002r\224\235V\264\325(l\032\324P\037\332\223\221\020\243\354<\323R\263\230\323\377pb\233\216\361V\3134\307a\"oQ\236\342\275\351\267~\017\230H\021\030\r\355\365bQF\312\t\\z\262@\332\352\023._\326(\305~\332\222\210\362\353\251\"\312n\247\206\004\365\016\035\373\340\t\036\035\352u\346\241\334OvF\375\370\305`$Y8\t\234\344\365\2423\033\225"
+	.string	"\306\035%\376\031\365\235\232\"\207\225\274M\001L\340&\357\326fn\236\321R\211\f\275nh\250\311'\347Nf\236&\231\331\351\334\177\360\305i\253\333&2\377)V\331;dz\241wW@B\364\026hp\271t=\276\314ND\255z"
+	.string	"pmM\231\331\332\36382G\217T\311\302a\013\224<:\205'G|D\220E\364\376\220\312\354\205\360\264\276\035v{\273a*p\225w\2532_\375"
+	.string	"\342T\230\345\357X\343E\346\t\331\373\f\035\034\023c2?\"\236+\311\254\201\b\2414\272\263\261\337fAf\367\342I\265@2\207\205of\263\343\307\252\357\206\345`\272w\3531\323\b\234rX\330\016\366\266\323\361:`\355P\032\266\213\020\341\365\"r\214\020\334\237\\\214\372\217\235\302\333]\301\302\273\265\233b\330h\253\t\264{\252\270\231\315\230s^\326\301\013|\003\215\202\353D\n\023.\244^J\215\202+\006\013\351\364\313\305\364I:\255Q!Y\202\305\327\227t\212\302C\211\251\324\305\211\024M\032\034J\314 \201\342]\341EB\002\r\016_\322\n_1d\250`\266\027W\211\251\324k\204\227\211\250\227\211\250\213\024$ZD\275\2461\242\\K-}Qb\032\375\222J\247Q\245\273q^\302\301\215v,S\025\020\206\001Z\372\261I\260'\f\220\037\202\n~\302"
+	.string	"\371\331i\251\037\307\261X\0274O\241~tn\034\307\361\201+~W\370\332\264\004\032\310\312\216%++\371U!l\202\335\026(\232R\224\2060&\220\331\032\013+#a\263\332\252\20211\337\200\314\326[~\225]\"g\225\253\362U\020\352\023._\324D\251\262\2150AT\331\351WDKu\256g\331V+`+\200\273\341\266Nk\313\255\246r\330T>\352K\f\360\314\216\270\265s\350+\225\237\331\350F*_\365\t\322R\231\206h\204[\277\346Q\202a\207\017\305\311?\t\033\024\226\030\266\r\333\276^\214\312L%\211qu"
+	.string	"\322"
+	.string	"\203"
+	.ascii	"8\244\366\341\241\005\225\035\021\n*\177\333\366zX"
+	.string	"X\205f\266~\254-o~!$\353\273\n\340U\271\307Sv\220\335\2037\370\340\237\261\303\324\0340\331\273\365)\277\3326>,\314B\003G\t\036\2546\356\224}\020O\320\271\025\264g\353\320\267);\3457\261)\303j\324\253\f/Sf\220\315\302\343\223|\366\325\340\036\260\017\270\254\354\365\"Sv>\377\277\354\2244:\253\245\245\354,CS\205\346\316\271\201u\250q4\206\22133\"\"\222$\005)\f\007Q\005\304 \347\234u\036\021\300 \223Z\331LRP\310p\340\366V\313\216\250H\225\033\037\232m!\267\226\210\210:}\032\370Z\343e\232Ob\237`\fd\340\330p\266\301&P\021\2200\362\347B\021M\243\342\211\032\352\222\330\314\244\346\003\275\236\360\303l^\206\313\251\020\314\215\030\351\003\243\006YhZ85\251KL\206\327(|\013\332n\234\252\320~\222\352\260\006\242\215?\321\350\306\025^\210c"
+	.ascii	"\207M2\276\320o\035\007\340c\327\306p\030z\330U\300\332\276\034"
+	.ascii	"\361\343\256\207\001\272n4,:}\257i\363\232\371\022\376\301\312"
+	.ascii	"\253\337\347\t. \325\245\301\203\306U?2\025\351\327\274\261\311"
+	.ascii	"\272)T#\177\347\")\023\260\247yd\311\005b\364RA\313\215{\371"
+	.ascii	"#\n\263YmV\375\362\361\345X\247\217\030O\343\261\376d`\271Cx"
+	.ascii	"\017\337\025\354u\215\254r\335$\232\373\365\351\274\276\231\350"
+	.ascii	"j\371]4\342\230\272F\022\030_\215\220`\327\202i\376I\224\245"
+	.ascii	"\303\213I\017\013eC<\201\356f\321}\250\301\342T\b"
+	.string	"5V\206\344?%I\265\222D\n\373\211\274\305\332\225\361\331\331\212\221\265\223U\"\342\226y\320\027\217\256\005@In\223\n\363BY\023\266\b\030\006\352\256f\243C\217\203\202\272>\031\345\265\317\313\250\364\036\3260\037\241t7\022"
+	.string	"\324\001\004\310\242\303\3003\223\352V\2405\234\277'\231b\224\370\2031!\020#\333\004\262"
+	.string	"\326\314\024m\336\334\327{\273\005\307\317\227\213A+\207f\017\360\350\331\342\354\376\037y\001\240\231:\035\3242\214y\003\330gR\256/\\\315z\020\022\220\313=~\210\231\202S:E|t\301\371N\301\355\350\324me\200U\204\241\263\320\022\332\347'1\f&\025\033\305\305\234\n\034\307\256\n\205\007\257\035\374\025\204\016\303Y,\002V\327\020\021\352\305\t\332\306\241\316\214\214i\267>X!\\\246\353"
+	.ascii	"*\\\224\256\r\332\254\026\201u\301*_\351\202\033\320>\207\236"
+	.ascii	"*e\n\212\217\215\371Y7\357\343;(\316\251\325\360\365\363\304"
+	.ascii	"\304\223\004\233\321\031\374N\365\2540\001\276\274#\333\204\233"
+	.ascii	"\240y)\325'\021kH\001\341\027A\322cAfo\2047w(\204\003\020\030"
+	.ascii	"\306\032\243\324t\267\034\257\324y\236\214K\2626\373\034:\224"
+	.ascii	"\330\334\337$\241%>\220\365Q\270\352\r)\324'\200[\334\356a\226"
+	.ascii	"\242\017^\275\005\027\005\342=Fa\371!\216\263~\237\354J\233\306"
+	.ascii	"\36389\363!s?\2107\032JZ\201\304\257\270\365\366U&\257\216\224"
+	.ascii	"\301\007\025"
+	.text
+	.section	.gnu.lto_disarm.part.0.254.11548313aa7dbd85,"e",@progbits
+	.string	"(\265/\375`\207"
+	.string	"\365\t"
+	.string	"V\321A= \005)\035 \2416\002@8\200\274\202+8\316\337\212\2602l\354\312"
+	.string	"\007\337\034\007|_\277\337\244\307(\b\305R\033\026\201\205+\030T.\226\272\203EP)g\302h\277\221-IJ\001-"
+	.string	"/"
+	.string	"4"
+	.string	"\016\3609\333\317\320<dn\273+\337i\312WW.\256\374\327.\360\202\261\256\003\260\221s\005\217\036\321\356\372Crw\267\275`\273\301\276\003Sa\036&e\024h\316D\034X"
+	.string	"\234\334v\247|\347y\204\316\273\317\r:\277S\177\261\342\344\320v\327\273_S\331\236\367\356-\266U!^9\2522\333\036.\376\324\26134\270\277LpSbs)\213S\2315>\256\306l=`0\331\005\031 `Q:\033\225\030\225Q\242\326GG\254\241\231.\267u\005\216\bm\200\244\211oDAJ\360\027*\205\340\007\361\231\344g\222\026\022\243\n\371\205'\031\002\031\274(\205\022\003\004C\351\331\346\036Wc~X\261qh\313\032\025"
+	.ascii	",\205\227\307\n\002\215\206\013r\256\006\006\344\201\021\256"
+	.ascii	"\030\262&\302\317\020yne\301~\024o\265\242d\350\fe3o\247\005"
+	.ascii	"\340\332\213)\247\345\364k\313\030"
+	.text
+	.section	.gnu.lto_tryArm.part.0.259.11548313aa7dbd85,"e",@progbits
+	.string	"(\265/\375`\203\005\205\""
+	.string	"\366\274\324E\220^M:<(\265\027\265\305\303\372\200\255/d\035\246\\\275\362"
+	.string	"\322*\213\207G\3639m\303n\377\334m\271gZ\025\221r\202\300\201\016\210\004\326\002@\002`\213F\206\253\373\022\242033k\t\331D\356\224\002\303"
+	.string	"\260"
+	.string	"\300"
+	.string	"[\312s\361p\310'\254P\037\330pU\021\235\332A\354t\350\004\306S\361\002\306\003G\362\370\302c\211\361+\323)!1d\374\312\023\230P\221\252\022}+&\233F;\275\025\333L@\227\366\235\013\221\324wI\363\264\345\253\326\212;\335\251\227\257\321f\262\0309Rq\247\255\364\233^#\215\254\276\200\266`F\"N\025\025\021\034>.\203\002\3441c\207\002\214\232\244H\340F\223\337\333"
+	.ascii	"{\210\017\362\220\341\3634\307\371\203\332qz\203\242!\016\325"
+	.ascii	"ZiP3\246(!\fWU\037\"8~|E\005F\202\364\271A\371\304!5\\O\267\372"
+	.ascii	"\264\001\3454"
+	.string	"g\200\333H\243Z\253\337\003r\337n\233\215m\0216\255\020[\225j7h[h\234{\253\307\274\262\314\361M0\377B\343w\256\347S\224\323\f\263?\346dt\376\022\263H\232\377\235\372I\343\351\267\312\324\022)\253\250\336\f\233\033\364\332.\326Z\253\327\210M\247\001\320\351 :}\033\247m\344t\215\234\246\305\246g\261i\031\235\216\221\323$\235\036\3514\035\247E:\275tz\322\3513 \252\023$U\353\215\260?U\b-\343\344Y\237@0L\206a\344Tc\206\370\005\314\230\252\257\352\023\022\331\313\277\3100\f\003B$8H/ h\276\276j\025\342N-\214\255}?\353W~\027\323\260\230\f\274\225\217\245\345\001\3070\332\345\025\n\363?\333\336\264\372\020\335\237s:\036Z\360\031\237\031Oe\3015T\366\324\326\357z\034\f\0314h\030O\347\360\347E[rk\273vhH\315\226F\306\271\207\243lgk"
+	.string	"\f\r(\261\225\355\237\002\365\274\341o8\304j\365E\360\333\334M\007\177\311\251=\200"
+	.string	"\261Er\256\bL;\304\210\371\037\271\005v\260\t0\355\022&\346\177\256i\241\341r\332\246q\334\022/4\322\035\367Oj\350\222\301!U\224\001\001\303\336\320\245Q\\^\320l\360\334h#\251\230\377\211{\3232\303\345\333&\357j\375\347\325\333\245p\304d\351\302\312\261?\330\220\260,q\203s\254\374\310\252K\304\3739#^Q\264\324b\307{\241\304K\240\264[:B\372\200\002\251\305\211\243%\335\005\025J\272$\336\321"
+	.string	"\347\212\220x\273\234\211\\\n\\.\005NIw\224\204\313\361\226pE\006\274s\201\304\303\275\330\355x8\232\355y\261\256\021\033\365\326\311[\233MCt\324\241r@\017+R&\221\r\273\276\366\364\312\340\350\373\371\2372XN\225I\312$[\272h\264@\240\255/d\322\314\036\314\361%\023'\345\223\371\237oZ~\366\b\206L\360\310\304\353F"
+	.string	"\273`Y\266|\023,\312\367\350b\265\326\b\276\327\365\224R\312)%UI5\236\002\330c\311\2712C\347\311\233\330\006\315<h\246d^h\274m\020\036]i%\351\266\020\344D\365\246\264\334`\221\033Ds\333\202\371\032z\250\201(\005\215R\310\020I \023F\013\223t`\002\221rV\334\021\240\305\204TI\233\001"
+	.ascii	"\203\020\241\375*\3655B\312{\021\267\360J\374\316\220\337\027"
+	.ascii	"9>d\353\341\005\241\344\346\fdZ:0\373D\353\222\350\t\365\243"
+	.ascii	"aT\240x3\215\267\034R\356b\323'5\204\302\243\347\0328\202AC^"
+	.ascii	"\345\332[.~\t\213t\253\366\351\330L\223\214\242<\226\0163\334"
+	.ascii	"\343\240F\313\r\026\177\003\321\r\203\320\347\233\025e\rt\231"
+	.ascii	"S]\273\353O\003N\252<h\310r\247\3263\0034\272\310>0O\222~\371"
+	.ascii	"P\304\006\325c\315=\001CgqUG\322\375\371&\303!\301`IN\017[\360"
+	.ascii	"\t\004Y\031\024\226\002W\354\353\004Q\310i|\004\267Cj\\\030\216"
+	.ascii	"\034VT4\260em\350\nS\336\276\372|B?G\t/\310\223\316\316\260\240"
+	.ascii	"\201z'L\244\332\370\347\370\227\311\016\224\241\030\243\322"
+	.text
+	.section	.gnu.lto_handleInflightCalibrationStickPosition.part.0.260.11548313aa7dbd85,"e",@progbits
+	.string	"(\265/\375`\032"
+	.string	"\r\007"
+	.string	"r\214-3PO\222\016 Zn\305\261M5\252\034\004\221\204"
+	.string	"W\215Mk\256\275Gf\267\036\272\030~\216\302\354\236p3\313 j\301K\304U\001\274\203YB6\221)O\232MEM\013\023\347M\234\367\320\300\340\360\246*\342i\n\246 6\325\223\240\250\352I?kK\004\255`2\262\300\013\304\320\357\230\324\211\314ST\260^\013\260|\2140\320\30304\266\266D\320\343\201\307"
+	.string	"H\246F\314K\206\270\025\222\257\250\363\222T\327\223\277\263\261\365-E\031\311\252\300d\244\270d\346\253C\221ZE\326\254{}<\305\212\312\256\017G\031A\033@Bf\036\320\321]\177\204\337\340/\t\020"
+	.string	":\023\030\027\314F\221\001\310\003#\\12L\004\234\021\213:\247\323B\233);\r"
+	.ascii	"\327\236\013\352\230\355<\241\214\001"
+	.text
+	.section	.gnu.lto_calculateThrottlePercent.part.0.290.11548313aa7dbd85,"e",@progbits
+	.string	"(\265/\375`\035\006} "
+	.string	"f\270\306K\260\324Q:\243\201zZt\023\252\r\024\343\263\036\317s?\346q\316\251\305\346 \373\224@\221,\241\177)\250\265\006\347\333\353\301n\236d$x\334x\303\023<\350?x.\364\rf\347;\322=\354P\r\327Q?i\204\220M\344\226)\254"
+	.string	"\265"
+	.string	"\253"
+	.string	"ZA<\365Z\271\224E\344\035L\365\313.\304Sw\021:\013\265\356\201\247.\313\342\"\276\234s\020\235\323\313\244\030\007\3577 \322\233\244\364\341,u\031\3333\016\236y\241\312\252\247\033O\356Mq\330\336\200\311\226m<'\001\221\322\377\347$\370p\036\247\300$\362\251\306\021\025\361\336\024e\333,\230\307%i\307\256&\357\314)\2174\2568A\372\201\340\262\"\375\226\230<\362U{\376\226x\234\375B\2147\367^\331\317\250\366x \210\0255\373\025\2154QM=8\345:\342wT+\f\233\245\203{\357\271\307\304\217\361\377\242\377\035~\322&0g=\355\345\254w9\353gg}\313Y\317r\326\313\316\372\363\254\217\235\365\246\254\276<\353IY\275=\353\307X}\307\352\253Y\317"
+	.string	"j\026\034\2717)\254xQX O\234\203\2079\341n\230\023\356\2069\341n\230\023\356\206\271a.\350\271\026\021\242\227\242\300\222\240o\212\021\242\337\352\306(\005\376.\316\211p\021\241\337jL\201\277\t@(`(\333\233\261*\t\211\276\033/S\n$\221c\345\307\r\3425Jq\204\260\225\207\357lR \211\262D\213\255\031Oy\206dkr\f\311\226\366s\017IBl\240\025\033\202\345\003X\004b\021w"
+	.ascii	"\253\262hT\036<%g\313\272\354\362A\221=\366\331\034\243\350\304"
+	.ascii	"\007U\304+\242\232\202c\254\307\346\024f\223\035k\362J\331\346"
+	.ascii	"\003\366\352b*\020\"H\220@\262-\233\203[R\266\311f\n,\245\202"
+	.ascii	"y\257\221\2023\024\216b\341\202\216\016\311\3266\272%\325\033"
+	.ascii	"\033C1\253\271\006\261\242\232\272\235^b\361\215\354\326\351"
+	.ascii	"\030\032\325*o\342\022\337\310\332\335\3543QT\303\316]\333R\035"
+	.ascii	"\201\365jX\215\271v\314{/\2033\023nb;\273`{\236\f\225\221\330"
+	.ascii	"\2363\220l\271m\325\325\027\220^\r\253\355\3646\307\333*\376"
+	.ascii	"\032\232\263~\346\254\2279\353c\316\372\367\251\3556\340t@?:"
+	.ascii	"\324\326#\340>\265\235\017\320\316\r\375\301\335n8[\200\373\324"
+	.ascii	"\206t\350\220.\006\210G\327\267\325xt8\233\216\255\007\265\365"
+	.ascii	"\240?\032vn\250M\267Ck6\307q\340\321\241@8\234\016\255\334*\316"
+	.ascii	"2\276\300H\232\016\362\362a\317<\222e|\r\307\227f\247\257\027"
+	.ascii	"\365W\314#kz\304\377\232\236\235\260\241\244\327E\345L\323\310"
+	.ascii	"tL\317\f1\321Z\246\021 !2L\307\214Mk\230&\205\305\260\007i\n"
+	.ascii	"b\2214)\035Gh\315\305\242\227u\351\227\256\\G`\263fi\227\036"
+	.ascii	"\320\345\253\321\322\263>`\345\362\243\245\t\\\361\255HY\263"
+	.ascii	"\264\200+>\030f\007}\250q4\347\220R\002\231\022\2310\222\024"
+	.ascii	"\2449\240\2429+\352\021 \261\263jjA\3553\215\001\017@\341\221"
+	.ascii	"\362&]\300\220\3252w\374x9\220\363x\240\241\236b\207\205\004"
+	.ascii	"37\273P\330\247\355$T\362\201Q\350\301\fI\361W\313G<\032;\305"
+	.ascii	"b\027^\306\236\212\207\263\272y\t\360\276*<^\274\337\353\256"
+	.ascii	"N\032\036\274\177KwP\221A\211H%\211p6\312\354\242\030-\027\352"
+	.ascii	"H\277-\033\027\304\311\007\346c\302q\363\200\374\330P\2742\202"
+	.ascii	"\364\017\213H |\254\336V\336\350\024\356\315]\374\200\376<\214"
+	.ascii	"\253<\031\324\361<<\"\230AS\366\247-_l\0278\325\006?\264D\232"
+	.ascii	"\230g\237\264\331\3414\321+\210\302\271\336\346\006\330\262d"
+	.ascii	"8\224\311\237?\b\272Ky\270\005\"3@\275\243\272\301\257\n\002"
+	.ascii	":Rr\330\r \373\210\327\307\fLYg\374"
+	.text
+	.section	.gnu.lto_processRx.part.0.300.11548313aa7dbd85,"e",@progbits
+	.string	"(\265/\375`\365/\275\273"
+	.string	"\272\032=?H\020\020\246\355\214\001kMD\334\n\324\1775I\004o\231U\003X\033\007\320B\325Xo\252\276\371\3406\007c\270\354\036d\3578\323\rQM\327\335\366#7\273\310\315.\307q\f\243\206"
+	.string	"\030\360\2467<\325\030r\313\224R\n\333\003\217\003\371\003\202@\372\217\225~\352\2000W\365\037?\225\365\365N\347a\"?<Yx\262\332WJ\303\2540\214WP\037_\026_V\321\235&\213E\3520\333q3\245c\206N\3471\0231U\343qo\320\242S\354:wLdW\367\254{\002air\235\nR\303LD%\244\347XHk\315\342\230ZU\317\361\247q\3033\246\326V+cT8\230>.^\365\034\023\231Y\035\307\324,"
+	.string	"\212\320s\334\212S\370\330\230\342\270\310Dz\216\221W\366"
+	.ascii	"\307\3240p\253I\302\335\326p-\307Dl\342\212\360\022\027"
+	.string	"\333\033\026W\244\337'o+94\023;\314\340\315-\313-k\350\216\222:\006\202zMW\237\034\355\352sI\213\355u\342b\361\262\250\326\324H~\021\324d&\342\367fK\322h\220\264loX\224\337\231\373L\2575\033\r\022\026z_23n\336\227ME#\231)\250\221K\315\301md\333\033\334F2w\032\263x\221$\312\314\314\342E\223\237\315V\346\244\301\350\371j[|_\266\247F\376\226~6\377aGndF\306\362\"\373\341>\314\207\0259\221\3670\"\037\262!\0272!\353\341A\026\344@\006\344?\316\303~\214\207\357p\037\363\361\225\367\330\016\353q\036\343\361\035\333q\035\327a:<\207\345p\034\206\303o\330\r[\271\r\323\361\034\3131\033\216c8~c7n\3435\\e5\234\206\331n\330\250AcF\001\004\310\210\001\343\205\213\026,\006X\361\344\244\"E\023\n\001N0\231(AbD"
+	.string	"\"\226B\200\370\340A\251C\222\022\351\210Cr\203\206\fF\030\212.X \032\022\n\002r\221\355;?>\271\207\302\264\232\3778\376inl\027e\034\033\233\031\261\216X\347EFg?\213\206\316}\032\013\235\371\0206+z \203\036%\266-\272\026\251x \203\016\266\026\030\277\360\350q\336\203(\330|\030\b\350l\270\327\\\270g\307\231P\257Y\217^\236\363\240\036\236\263`\340]3\340]\235\363\237\235\3259\217_\233f<m\346\234\357\320\3119\367\351\361\305\261q\276\3025\357\301\241q\266\003G\205\f\272\346\254\227w\246\031O-\315\371\316\016\255\271\016\315\214s\23530\316t<\220A\317Tp\236\363\245Y\316\210/\315q\2724\303\351\302\305\371\r"
+	.string	"\234\335x9\262\246P\346\334f\254\231n\254\212\363\034\225f9*S\234\331\304\035\221A\247\316p\3117\251\023g\26761&\316kLh\256\232\320F!\203.qV\323\246iS\214!\374\262\236@\206E\254\231\255}\252\323\345\304\250\214\021\361\210\fZ\202\337P\222u\033`\217^\243\311\037\247\341\3503\216\310\240b\215^"
+	.string	"\243\023\200u\031\036\310\240b\213\036\003F\241\277 l\027\204rz\274\005\013CA\037 \260W\004\002\372\223a;\031\336\331q\025z\235\242E1\226wB\367E\365Z\016|X\364\264\230h\2367\355\3419\n \034\002\330\365\t\273\273:g\272k\023wm\274\004]\223\240\233\363\021r\035\200\034\"\033\027\021\327Kqp\036\002\215\203X\363\017g\334\203UI\315;\244\241yR\036\253\322\314\231#\201\271k\021}\3213?\022\023U\3019|\361\244\027\3370\330\3055\fr\361\f\203"
+	.ascii	"p#\fEe}a"
+	.string	"\254\212[\020\023M\201\212\023\365ESh\271\026!&:\305\207\200p\b\211 {\"\326Abb\242R\007\"\n\373r\267/:m\227\336\367\365r\244\203\205\241\320-QQ\030\227\177\213\342\360M\237\242\260\256\226\203\023\025\300Z\256}I\030\324]C\363#\020\216\367}\331\b\313c\363\263\231\205\332\230;\212\271\204\232\\2\350^\272\013W\\\242gV\005\227\270\n\317+A\357\373\302`\377\002\302\223\t\267\227\035n#\211^hm\213\213w\331\341\344\031\026\3466r\350I\220\346a\241 \"\212iM\261 \364\336W\025\334\"\344u\272\234p!*\342\376+M\350\302\227x'\220\313\031\207\236\232\005(M[\331\230\232g\263YF\241\247\366\323e\267\342W\236(<\245Hq\033\331Q\251uQ\361F6\233\r\n\372\366\231\325=\346\347\324\307\262\202\336\227\013\006;\025\257\362\234\302\355\245\221\374\254\362L!\205\357"
+	.ascii	"H\255gk\234\315f\037\201>\270@\337r-\324\375\301u\037\350\331"
+	.ascii	"\277\244P\3172\273\024\227>\257p{\341'\226'\325\033\354Iu\033"
+	.ascii	"\351\276\212@\351\226g\263\331l\243\033m\344GmA~\303\365\245"
+	.ascii	"5uy~\361\006k\277\005\354+s\302\3549\306\033\354\037\t\330G\346"
+	.ascii	"\n}-2\317\264\023}fW(\222\304\3313\r\256\257\3125\306\325PL\373"
+	.ascii	"t\375\275\260*(\302\231\237h\f\360\006\363o4V\240]\306xH\367"
+	.ascii	"Oe6\213\302\326H\334\376\327ZS\246j\207\313\031\031\204\3673"
+	.ascii	"+\300\2007\030\267\\\017\271\205\205\301\036r\275\026\277?\225"
+	.ascii	"\277?\233\315\372q~\026\346\376l6\353\207?\0133;"
+	.string	"\217\300\316H\222\316G\222\316YIg#\354\\$\351\214\305\316D\330\231\311\316\"\260s\bJ\316WJ\316V\354\\\225\344<$\311Y\210\2223\bJ\316T\354\034\204\235\201\260\363T\322y\231t\376\221t\226b\347(%g(%\347\017\224\234}(9{\320k\232;`\347\036J\316<\224\2349`\347\r\330Y\003v\316\240\2033\006I\347\035\354\254\203\235s\260\363\005Jg\013\224\316\025\0349Sp\344<A\322Y\002\245s\004Ig\b\216\234\037P:;\240tn@\351\314@\322y\001vV\200\235\023`g\004\222\316\007$\235\r`g\034I\347\033Ig\033I\347\032I\3164\224\3163\224\316\005(\235\tP:\313H:\307Hr\206\241t~\241tv\221tn\241tf\241t\036@\351\274B\351\374\244tvR:\2538rNq\344\334\204B\351,\200\322\371\204\322\231I\351l\242\004\t\245\363\b\245s"
+	.ascii	"H\316\"\220\234\227\220\234C 9\203@r\376\200\344\354\201\235"
+	.ascii	"\225\272\257\271\303\221s\322\221\263\362\310\031\251\375\232"
+	.ascii	"\217\330\231\003;'\223\316\033\222\316\032\3309\003;\033\261"
+	.ascii	"3\206\244sQ\322\371B\322\331B\322\231\210\203\363\020;\013%\235"
+	.ascii	"\203\222\316@Ig\227\235\221\375\326\3346\233\346ggo\266\356n"
+	.ascii	"\305\366l\f\303\330\373:\311:\276V\220p\3004\233\356\267\356"
+	.ascii	"5\335v\335~\335}\335\207m\302\006Bx\203\026\324/Q\326x(\3419"
+	.ascii	"@\230\347\f\3715\201R\307\303\275xT1\017\030U\354\223>ea\321"
+	.ascii	"\227\353\365-\356\240}\341\272Z.o\023\025w\320\262\225\205\031"
+	.ascii	"\251{\362\344\321\307\243\217G\037W\354\303\006\026<'\322F\250"
+	.ascii	"F(\021\030\352K\350\332\2722\003\252\326D\214G\027\223\260\024"
+	.ascii	"\016h\t]-\233\307\253\332\342\313\305\326\304}\332\017\021\226"
+	.ascii	"R\262\225=\031\n\323\270d\214\331\202\216\230\233\253z\017w\230"
+	.ascii	"\351\334b\342\036\3261\265\352A<L\322\206K&\354\302f\033.\227"
+	.ascii	"\266\330\336(Qu\n\247\266(%\250\221F\336\033\334\300\016U\016"
+	.ascii	" \033\343\270\250(\244"
+	.ascii	"\313\027'\230#74/\037\036\003\242\017\306,\312\264\317\242\242"
+	.ascii	"s\3143\rH\235\00536\034O\345\246~\340{\205j\236\003\377\300\177"
+	.ascii	"\333\327c\003\317\300;\360H=\2570\3132\3163o\260\006\276\323"
+	.ascii	"\254\360s\371.N\3024\347\2313n#\031\370^a\252\210\215\203s\303"
+	.ascii	"\323z\201o1h\276\354\265\374\026g\232\252\263\255\315m\344\002"
+	.ascii	"\337Q\246\212\314\007%\213\r\244V\233\254\032-p5\024x\246\363"
+	.ascii	"M\2013\\ta4\022\370\251\004\316\256P\241)\233\273\031\b,\275"
+	.ascii	"\355$t\021\370\006\374+sU:,cW\300\001\276\246\r\370\003\336\212"
+	.ascii	"\001\317\234\022\262\2343f\266\020\200\343\247\334\255q|_\377"
+	.ascii	"\306\\\271\332\310\270a\343o|\025\033\337c\252\347\2541\306\024"
+	.ascii	"1\030\377\246\315\226\027O\335j\2513\256\206\2245\355%\013Z\024"
+	.ascii	"\027"
+	.string	"5\336\b\n5\376p\212\347\031\363N(\323\202\006\224'3\236FW\027\3603\276\311\317\013\215\200\227\361\005|4\016\001-\2327t\212,\276_\306w\036\213\030~\006h&&\254\210\361`1\376\310\324\316\331\023\214gf\247/\341\353\305\303x\245\037\022\327\305\277\370\366B\203z\366\271\\|\373\005J\235\374O\267xd\030\335\240\212\247:\343\334\327r\306\335(\313\376\353\224\243sZ\235V\2672\305={\262\244\360\320\342[\213\343\363\312\233'\265\305\037\231\276\341\303\327\304\342\231\325@F\026\237\2247E\361\324E\2730\323:f\024\005\030\240O\034\260=+\376\351\007P\214\263\342\r]\030\247\357\177\372\266sf\347\345\204\3237\331\036\247\2464t^\332D1uLO%\353\303F\233\232x*\223p\033\323\206D\211G\362\03236\202\304\243\370%d)^\3057\020`\323\247@\361M\037\242\355\353\361\3043\275"
+	.ascii	"\337^cP\317\022\3069\321\232!\316\231\370~\246\357\304n\311\370"
+	.ascii	"\245\t\223\342\026f\320\304\353\230ZK<\265I|\211\327\200e\372"
+	.ascii	"\347\365\b%\301\246\263\3349\3039\016\350\254\363\342\217\304"
+	.ascii	"\367\230\316a\327F\370\231\231\276\005\260\327#\276\311\252\201"
+	.ascii	"wF|#6\322\314\364\355L\304S\231\257\335H\263X*J*d\226\032\211"
+	.ascii	"\033\300\267\230j\240\236\333Ab\347\304\303s\033\031\300_\320"
+	.ascii	"z[\\aF0\204\210\245\027\341s~g\267\204\345+\342\034\020!@|\210"
+	.ascii	"\024Ng\016\210?gi\356p\371\360T\2666\034\027q\275\357\326\210"
+	.ascii	"\017\337Z\252y\036\376\303;\241\327\342\226gU8\034\266\312`w"
+	.ascii	"\343o\234z{N>o0'\237\333H\017\337bRG,\234-\317B\335\344xx*w\370"
+	.ascii	"\366/h\251\356\375\233\257G%\245\377<\0238\206\3469~\316?o0\245"
+	.ascii	"o\254\025\256\327Z\241\213K\207\247\362\321\267\217\324z\273"
+	.ascii	"S\335K\372\016\325\27779\345'}\013v\213\006\2007U\336\334\024"
+	.ascii	"\275y\216\213\364\312o/1G\217\364H\325&\331\257\307-\317\006"
+	.ascii	":\233,\032\200qG\337y\272\355#\365\323\352\001\213\223\364Tv"
+	.ascii	"j\377\377\243a\232=%\207w\301-\034\276\323\366\240kH\311g>\340"
+	.ascii	"F\355$t\231\235\206NDo\260\344\367]\267\023\257*n\260\207H,\203"
+	.ascii	"j\2166\004\345\251\006\032\365\007W\303o\250>\257$>\251\032\236"
+	.ascii	")-4z\337\227C\206\237J\343\344\223\341eH\013\317\244KFh\374\030"
+	.ascii	"a\245\0330\374\324\231\247\023\373\224\202\341eH\t\317\244\032"
+	.ascii	":\313-\372\251\252\240\263\321\321\314\370\231\363\2173\373\324"
+	.ascii	"\322r\033Y\364\036H\365`\327\0343<\325\305\372B\220O\333\302"
+	.ascii	"_X\301\302#\371\334\256cg\260Fn\326\177\256\\\337\304\357Q\017"
+	.ascii	"\003G-\026\331\360\356g\227\313\374\374z*\001\354\343s\r\034"
+	.ascii	"\304\351\b\363\351\bsC\020,\250\252\037T!\004qZVQa=Y]UU]I%q\020"
+	.ascii	"'\"C\256\230XV\314')\017\034\304\211\271<BU\3654\325\201\203"
+	.ascii	"8!ab-\253\226C\226X\"\220@\rY&\260\304\2022B\205%\005\265\374"
+	.ascii	"\201!\353j\210\021\026U\025U\004:~PU\031a\005\001B5d\201\345"
+	.ascii	"\220((\254\034VTED\212`Aa\345(\302\262ZJ1\227\025,\207`a]1\203"
+	.ascii	"`aX\376\270\222\300\352j\004"
+	.string	"*\346U\003K\";\254\240\2442\020\331\261\254\242\322\201e\265d2\213H]`)\247%\363J\312\207\324\324\223\324\324\223\025\025T\325\223\024\223\310\223\223\222\257BX2\237\260\256\256\230OD\335\276\237\205\365\234Uy\263&q\262\036a\204g\034[\017mV\231\321f\3333\355\361\n\215\276\357KB\222\346\033\240!\366\360}\337\021\220\374\243\035!y 8C>\327\367}\221Xx\254\0369B\244B\326\037i\307d}\267\005J\267\262\214<3\2565\003\323\206i\312\3215\255V\267\221F\276\243S\034\215\024\371\250\267\310_}\221(v{\324\362\270a\025\375\332K\301\244\331#\022\324Y.\326GU\003\233o\332VK\273\245\031gN\263N\035\267\221X\337c\n\037,\023\313\225\033\021^\3033\327\020\210|T\020\221\277B\273z*s\323\316p\214\025\363\243\226\230\337p\206fUB|\250\235]\334\253'\002"
+	.string	"\306q\033\"\3027Y\023O\204w8\303\260+TH\b\026Bx\253G\020\2424R1\033\237 W\314\326L\256\325_A\261\312\303\002\251\002\252z\253\303\251\266\253\020\217\037\363NP[\016yn\231\264M\234qz\315\275=w\250\223\\!?\344\237\316\013\r\332\344k\301\234q*"
+	.string	"\271y\247U\322\3643\001\243\221\334~\265%4\377\232\201\315\301\346\240\333H!\337+L\231s\266\266\345\331\2660\3165\221\215\317\017\020\204\310\252\201L.\325\203\320nQ}G\231\"\347\314\265\260\f\256\221\n\362\314\017\362\rX\210\346\232\215\002\362\335'\b\310w\230\025\256\327\202\232\372\273\236\372\206+L\373`\371\215\335(\365\313'\252\236Y}\374\030Zk\373\203+\365?\374H}\214@\017\236\312Q$\242\276\335\024\232]\271\276\003n\023=l+\261kW\367P\342\030\334|7\r\021\233\211\205(\\\273\262<\240\230\334\017\036\212\360\203\357"
+	.ascii	"\210e\261\034\b\016b\3736\360\304\022_\356^\r\236\372{\355\303"
+	.ascii	"\233\311\365\340}\374y\360N1\307\263A\275+\027\225\f\236J\001"
+	.ascii	"\2234\255\304;`0x*\377 c\375\262\352p\262n=d\360\276\2549<\332"
+	.ascii	"\035\374\222\036\336\343\205\324]\263;\236\257\231\233|\232\177"
+	.ascii	"\342\\u\344\340\362\356&\326en66\377\f\236Q\001l\354\002&\227"
+	.ascii	"G\320\236j \223\313\301\363\370\274\327[6\263N--\267\221\034"
+	.ascii	"<\020\"\035E4\331l\326\202\r\376\3738t\203w\241X\341\362\n4x"
+	.ascii	"Gsvi\360=\306\n\005\031\220\340\335N%K\234L\274\3012\370\013"
+	.ascii	"^xQ\354!\327\004G\034\203gv\2069\241,q\305y9\0208Qp:1\370\016"
+	.ascii	"y\246\323A)\022\200\351\035\037\345\346ye\312\223\272\343?\214"
+	.ascii	"N\231\263\212`\3425\002g\n\202zW\250\025\002\035\037\325\352"
+	.ascii	"\370\206\023\304\273\302\342\244\272\315\t\203=\374\363@4\316"
+	.ascii	"\232\206\202\021\321\201\034\337kn9\036HK\316aoI\311\322\300"
+	.ascii	"\032\247\030\335\233\265\303\t\222\271r\275\026\233\023*\003"
+	.ascii	"'\230h\271\222xg\2014bnf\266<\323\034PP\212\002\027\254]\360"
+	.ascii	"\034\210\265\235"
+	.string	"I\023\260\340\325\236\017\330\236\n>\202\267\340\221t^c\024|\005^\330\023<\005\237D\350%F\202\237\340\033\355L\202\247\021\270\266\025\301\267l\177\331/8\b@\260\002\031\b\276\255\212c\001\204\033\2503\2424\t} \006!bfFd$I\222t\363\025@@pD(\034/k\353\003\023@\316\351RI=\031Z\306HJq\241\2621\007\200\021\304\326\351r\323T\254\326\020@ \200\224\325\261\272h\372v\245\245|aY9[r\304\361,mB\267&_\343\263MM\257M\304\026s\021\323pr\200\023\345\214\271\301D\371z\003\363\313\203Dt\357\202I\375\365\352\272S\016\366a\006\314\321}\031k\225\212\357p"
+	.ascii	"\273\211\227\271r\334=\017d\336\017\265\255\030%\271\206\326"
+	.ascii	"\003f\274\245\335\233{7\034M\230\177\247hT\251Qe\022z\244I"
+	.string	"\224\306\204\036\037\270@\276\314\323\312R@1K\344F\221\344\271\034i\255T\226\377\275\341\"+\234U\364f\331\231$\243l\255\202 \260\035\357\033\334\023,r\2779\\\220$\212c\301\356Q\004\204\311\215\004\260\npr\270\252,s\357H\276\251\361$\263G\252\0260\007\3047`\271\236\230\f\r#2\031Qs\232\246\030:\2213HM\221j\267\007\223\307Cb\\\005ka\\\202T\343\212\336\230{0pU\030(h\262\034t\316\017\224n\206\005\253\t2\217v\231\327[$\200\342m\370\301X\356[\035\"C\272oF\t/\255\221\2403\252\321\310\256[F\341\3560\324`oH\335\234\305m\371\233\204P\226\222\346\002\263E\f\267S\024\250\022yS\033\\\263b\tf\227\030\203\"?\262\270\274w\301o\341\276\237Ci\363\312\001\030\"g \354#\005\021z\250\255^\026\226\022)0\234\036\221\316\213\017\344\242\177"
+	.ascii	"\302\217\301X/+6Y^\225|\036\360'\331\246\005}2\331\025\270\256"
+	.ascii	"Dq\212/\203\343\321h]>\326\375\0160\322$\277H\311$\357\247\314"
+	.ascii	"i\303\027\004{\370\241\002\364\300\b\303.\n\372=\026\223\315"
+	.ascii	"\250\311\250K\341\300B\335\030\236\241\334.\214\356\343\2568"
+	.ascii	"<\232ULj\336\304U*H\005\0202\001PW\005JP\347\020\262,\\Tl\b\200"
+	.ascii	"^7\027\037\312)\305\034ou\001\334\310\"^\021\302Z=\334:\235\245"
+	.ascii	"\247\354(\226\204Yx\222W \353\376\230\264?\342\361D\202\376J"
+	.ascii	"\236\245\200\3610\302\322\334T\217\3436\200\226"
+	.string	"o\271\337\177\016\311\250\331:E\376c\260v\342\3035\006C\376a7\0266z\350\300\245j<\013\315\262\307[\345\n\256\246[\211\320\025\226T:\225\241\326\025\324\237\305\320\214\261\365I@\031\210\206\347\260\300z\022\211\006\201\366\022u\334.\205\030\366\2230\"\2115\212\256\336T\231\n\026s\255-\222@\024A\327\201P\374\226D\337f\240b\034\264|\007\250/\357\344\b\227\227\310\366\036`\326\\I\"K\21228\200'\220\246\251\266\347o,gu!Q\312\213/\213#\236\352\276>\373\327~\237Q:\231IV\005\222&\205\373>\314\224\251\036)\331\r\005r\260\257\340!\323\306\360\313^m:\223\345\222mK\346\220\227t\251t!T=+\007\222\247\234sO\\u\033\003\254\260\374:\336\304\036\350}i\022\247!\346\227\337\324\\\221\0256\353\253wS_\004\242\365%\344l[-\224\225\271\245\340W\200\327<l"
+	.ascii	"\rGfX\374\206G`\\\241\360\203B\031fww\030A\034\275\3300\210O"
+	.ascii	"\324(\221\300#\211\026I\313G\224\201\017=\354a\rw/Z\347 )o\020"
+	.ascii	"\320i\233)\352~f\022\nY\257\216\222V\3507\234\022\250\370\301"
+	.ascii	"G}\250\334\272[\336\003S\325\246%\250\263\322\275y\016Ll\206"
+	.ascii	"\216\007{\271t\214\271^\362\272\325EzJ\202\300a\237\333\372\241"
+	.ascii	"T\005!\347C\245\355x66P\215|b\310\357\203#x\327d\030{\357\364"
+	.ascii	"D:\225&o\343Y\246\310\025\002JM\036\017Z\n\362\315\005\006:$"
+	.ascii	"\334\306\226i\232\263\224(\272\034\324<\365\361\361\277U\225"
+	.ascii	"\223\006M\322\213\366/\363\250\273D\370\326\264N\002\362-\266"
+	.ascii	"\321\256\034\3505)\177\271\255]~\204\224\013\004\350\341\031"
+	.ascii	"i\267\311m\240\\\347\241+/\370J\353CI\r\366\312\267\257\373C"
+	.ascii	"U\253\316\306\214\201\252\036u\364\231\267\317\326\013!\002\302"
+	.ascii	"\302\327@V\b\272\315\347^>\342\024\352\314\376\304\005;\255\357"
+	.ascii	"K\247\301\350\376\256[ \233Z\006U\374\201`r\215k\310\036\366"
+	.ascii	"\307I\017\3044m\031[\2077ne\327\323m\324\351)\024\221\345\r\223"
+	.ascii	"4\316nm\307:\267\321\343\314)\001hO\216`\023\322w\243\354=\030"
+	.ascii	"\354\346v\020H\207c\213\220\253\336\001Yw\t\t\205\274-<*\215"
+	.ascii	"\234\340\224i6\255\224\221\310\330\016)\251x\022=-\215\246N\310"
+	.ascii	"\034\353\340\322(\027\217\2009L&\216\025\214\241;7\272Q\204\336"
+	.ascii	"\264\177LN\273uqS\225\353\370\326\313\037A\002c\250\020\214\310"
+	.ascii	"oS\3774\204B\326&\247f\303\033\235\302.\256\304\243*?\330\232"
+	.ascii	"\023\030\232\230\345\241}d\024%H(L\2766=\354\002\320\225Th\201"
+	.ascii	"\226\312^\327m\356\027\210\020\314XH\224\374\017\224\374\205"
+	.ascii	"\240P\310~X\023\002(\201\364\221e\243\263\331:\341\315p*\367"
+	.ascii	"j\213k\300\242\2712\327\2158\240\322\340x\251\240\232\005S\301"
+	.ascii	"\205\234\241\344\022\224t\201\214\356\271,\2003\375\306\264m"
+	.ascii	"\276\016IOSD9D7.\252\326\001\326\304\036\334\263\023\r\005\302"
+	.ascii	"9e'\016\301\302\240m\370@\272\246[\321\343]\323:t\037\021\003"
+	.ascii	"\220\377S\r\271\315\321\377j\200\331\377/\356\303\361\263\352"
+	.ascii	"\324\236C\260|\310\020\013\225\341\025\211\034d\32673\223_8\250"
+	.ascii	"o\340\343\254\006\232\3153&,\250\225\0208H\250\215\304\227p\256"
+	.ascii	"\200\312\021|\302\200\002\271\352\334dV\374\022\302\272c\273"
+	.ascii	"K\320bV\333%87\335\300^K\307\264x\344$\203\363H\272\265y\025"
+	.ascii	"q\001\353o\326\272\301\204[\tl\224\344\2108%\256G\311'\006\\"
+	.ascii	"\270\353\254\177u\036\"?J\367\274\210\200\220\244\251~\310K0"
+	.ascii	"\032\360\335C\340\360"
+	.string	"\215RM\234ES7\245\2562:\2410d\206\200tq\314#\217\304\263\335\355t\2717\364'|\274\375\310\242\021\375\224\310g\301\200\344\334\235\031\245\247_\263H<\332\236K\237D\022\245\3446`\234nl\272)\200\266Nd\343\256\305k\270\217\n\252\364\367%\004O\205\343b>\304vU\235\337\020\267H\221)\367c$\230\362\351\001u\226\356\347\025\204\3438\270\2505:^X\025l\016\260\357\263\f\210\n\256\222\350\213\237\261\356\230}\270xd\213\247\207\233\307j\016\324d,V\214\243\275]\312\237\3462\ny\227]V\343\022 \201\242\262\366\302]dF/\263\032\2449\033\023\354c\300P\326\273\324\340O/\355\n\007\0048q\306\203\026\357U\235+W\036\f\r\313N\324\b\2248l\264^n\3436\274\001\204\375\351/IhW\222Vs\"\376\334@\237\220\273,\221\035\327x \345M\013i\361\240\253G\311\251"
+	.ascii	"\326`uD,\363\307x\030Y\240\362\353;\227\341\\\212\235\030,Uq"
+	.ascii	"\027\036\336G\032\032\030%c\310bN\254\323\366\\\".\240u.\026"
+	.ascii	"B\307\017\246\265\3101Z;95\017h\020Z3\270\200\3133\266\3128%"
+	.ascii	"\310\251I\336\345\232\005J\237A}"
+	.ascii	"\264\263\217\323\277\005\b\300d9.|\364\350\336\267\030"
+	.text
+	.section	.gnu.lto_taskMainPidLoop.part.0.301.11548313aa7dbd85,"e",@progbits
+	.string	"(\265/\375`\203\0015\017"
+	.string	"\026\034dF\360\260(\035\031\263\242\212\351y_YH\343\242\206\330\031\261\212\334\307z\316[\334\325A\034\nhn\355d\307(\004\216\237\267\376\232\241A\360\262\343\364\352M\332\016\354\275\363\223\r\222oV\370\034pf\033\331[\356\224\002K"
+	.string	"V"
+	.string	"M"
+	.ascii	"\006\355rx\345\354\316\217K\023\370\\\016x\207v\031/@\273\334"
+	.ascii	".\017\302v\252\202U6\214O\327\206jV\260`\262\335\345.\265\303"
+	.ascii	"UW\030U\376o\016j\261\250\\7X,\034\006x\364 \330]\177.\334\362"
+	.ascii	"\266\r\330V`_F\0238^v)\354\324\330\rR\307\303\210\224O\342\272"
+	.ascii	"LW\313q^L\032\331\256L\017\303.\002\305'\241\351j\361|\200!\301"
+	.ascii	"B\266;\271K\317\317mn\224\343\330\323b\206\213\027\232\335\335"
+	.ascii	"\356\327\244\374\033o6\251\317\024\230`W\031<.\r\241\375\020"
+	.ascii	"\177\251>S\002#\355R\025\004\006F\303\005\252\355\002?\021\302"
+	.ascii	"\341\332\335\003~\211\233\350\374\231K{$\351\223Z1\256P\241\n"
+	.ascii	"\326l\005w\274\301\216?\320l\323\t\276u\205\261\031\206\330\212"
+	.ascii	"\252@\225\261\306\307\325\030[\203\216\036h\325\240\241\204>"
+	.ascii	"(\276\002\036\0219(\225p\250\021R\t\202\311\002\317T\002A\221"
+	.ascii	"x\337\027\241\003\340N\344}\247n\324\211p\235\bGR\n1q\335g\302"
+	.ascii	"\211B>\225x\037\207:\235>n\263\r\037Wc\374\231i\210\255T\202"
+	.ascii	"\252\214\355\370\361\024:\252Q\317\232\371(\236\303\300\237q"
+	.ascii	"\203Q# `\202Q\356l\003\252\346`\177\006F\003\317A\206al\\\006"
+	.ascii	"\036>\312\024\205dO\237\254\2715Fj4\274g\337\211v\230#\034u\n"
+	.ascii	"\022\024\202\357\030\nl\320\004j\031\361cD\016\301\336q\303J"
+	.ascii	"\271\235bA\323ea\0010y\241;M\323O\bc"
+	.text
+	.section	.gnu.lto_.symbol_nodes.11548313aa7dbd85,"e",@progbits
+	.string	"(\265/\375`\262\023u@"
+	.ascii	"\332f\354\02580\246J:\226P\030\215\"\350\316\354\236\212K8\016"
+	.ascii	"'\004\247\220\225\354t\021+\2426n\325U\254\027_|\215\256\232"
+	.ascii	"\035`\314\002\310b\345\246_\305kR}\333v$I2U\001K\001[\001]\356"
+	.ascii	"\t\271\334\273m\271\177C\273\257\243\345\036\356L&\223\271\353"
+	.ascii	"Y\356\327~\206b\341B36T\031\361e\\\312\310,eI\023&B\306\232|"
+	.ascii	"\312\310\314\243\t\017\261&?\230\374X\242c,\211\004\276jv2~\032"
+	.ascii	"\317\274'\203\336S2^\271\037c\345\036L\225\013\032\251\234\321"
+	.ascii	"\224\353Iy!cb\224\213\326\201r\377\005}r\237\3661iohN\356\275"
+	.ascii	"4y\237\221\311\230\260\342\222'*y \251$\367bP$\017t\204\017\215"
+	.ascii	"\034\220\261\310\377\030\211\334\317\220\373.\250\220\373-A\356"
+	.ascii	"\315\320\261#2\002aR?8Q\354\200\306\b7|\372\270\017\203\366x"
+	.ascii	"\036#\217{u\307}\031\252\343\276\371u3h\2239\227\343\236\211"
+	.ascii	"\343\242n7.\352Dm\\TEk\360(\032,j\006\207\222q\271\030\f\n\006"
+	.ascii	"\1772\276\270h\031\352\342~\021m\361;,ng\305W\025\177\223\342"
+	.ascii	"mP\260\247\023\247\343\305l6\325~>\237\247L\334\233BK\234\216"
+	.ascii	"\304+\215x\236\261\231\"\216)\304\023\031A\334\253\241\037\356"
+	.ascii	"\311P\017\317\322\341g\034\256e\303\321\322\013\n{\235\227\206"
+	.ascii	"\237\271J\226\341X\214\314|d6\233\314>\314\227Y\357\313\0010"
+	.ascii	"\231L&\206{.(3\027x\013\221\222=\246\216\261\347\261\366\037"
+	.ascii	"\322\336B\036S\217\310\372,G\233\230\f\230l\"\354\277iN\230'"
+	.ascii	"\357%\373\210z\326c\233\013dI\311>B\230\354#-\245d#Q\333d#\251"
+	.ascii	"\224l,\365\252QU_\251?\233\342\241\"vT\325V\354\243\252\266Z"
+	.ascii	"!Uu\225z\356[$\210'v6TD\267\306\214\252\372\270\036\245\373S"
+	.ascii	"\003\304\212\250\372\355\317\b\020\037\266\257o6\305C>\356\243"
+	.ascii	"j\261\223\361\"\252v\300G\325\310\366\330>\002\233?5\336\343"
+	.ascii	".t?\210woG\350~\322\335\375\037{/i\320\275\237\335}$A\367\220"
+	.ascii	"\352\356\037\005\272wDw\337\b\320\375\242?\367|~\356\025\315"
+	.ascii	"\335\357\365\271?\304\347\336\220\334=\241=\367w"
+	.string	"z\356\331<\367\203\360\334w\212\273?\274s\357\311\316\375'\270{\304\267{Pn\367\241\352\334\213\242s\257\247\355\236\317\234\373>l\367sr\356\013\343\334[\202s\217\267\336_zs\037\347\274/\343\346\276]\273\337\323\346\036\017\233\373\2665\367s\324\334\263\245\271\227\203\346>\316\231{8f\356\235e\356\335\220\271g3\346~\215\332\275\0321\367i\302\334\243\001s\237\351\313\275\246\264\373M^\3569\005l\250e\033XE-;\213}\202>\2626N\\\266U)\376[vU\373wA\343\023\212G-\365\220\307\226\324\262\217v\024\226}T\371\226}=V\\\366W\036\\\266X\033f\264\374\204>:\177\257\t\\ku+w\002kd{\b\326\3105\022X\037[O`}\264;\372\310,\rn\013\214\020\254O\230\004k\261O`\335\325\374R\266\202\366\274\210\251\205\001\225\315\245\376B\242#\366\207\303\003\344LJ"
+	.ascii	"jL5\316\244dC\211\034q\240\262\263\332?\260\214\2165)\215o2\331"
+	.ascii	"\361\240\262\221koR\366Q\345\244l1e#\233\007\276\372\270F\372"
+	.ascii	"\352\243\212\351\253\337LBhd{\251\201%\006^\375Vp\253\221\252"
+	.ascii	"\341V#\375\266\256\350\346Y\210\007\267\270\032\271u\302Z\177"
+	.ascii	"\300D|~\\\270Ux\240\035\\\365K\366\221\375R\260\023\036\244z"
+	.ascii	"\n\311NJv\025{\256C9?+\365Tg\016\3711`\262\302\237\323\311{\311"
+	.ascii	"\001q\2420]\261o,,,\366\035\230\354,5k%\260\022h\r\250o:vx\220"
+	.ascii	"\fhi9\337T\311\326j\021\250?\202\365-\230l\004\355\236\002\365"
+	.ascii	"\017\334\374\230\n\326\277,\217\214\"\005\354\373/\331]l\017"
+	.ascii	"v0\331>T \352\005\214J\263\211\003le\307\200piW\305w]\345T\362"
+	.ascii	"]_\345\273\247\361]\037\233)\341\027\263\334\207H\r\031\3571"
+	.ascii	"\333bx<\310l;(\225\266X\036\233J\373k\034\237J\373\354b\332o"
+	.ascii	"\003\323>6\303\322>\256\211Vk\032~\246}\265\262yW\355\2443\323"
+	.ascii	"6\300j\251\\\316\243{\314\3322\244M\245U\317u(\027\351\262\232"
+	.ascii	"\322\276S}\253y`\370/\355\277a?\301P\034\273\007\270S\367\225"
+	.ascii	"\366\345\f\266m*\373\245\375\267\365^g}p\352\271.\r\016\027\252"
+	.ascii	"\217\240\350\351d\315\264\037\327\016:\323>\036\366ej\332\337"
+	.ascii	"\323\232\235\222c\377cI\373s\352\321\347\363\271\310|\353\323"
+	.ascii	"746~"
+	.string	"\330\243\201\350T\272\366\354\t\r\231\232@\355\317\324\267\227J\213\204\317\242\256\177\332\247\304\356\255o\303\366\307\264fb9\261\234\332\243\352\231\021b]\250\237\255\237\330\243\210\352y\361O\355\017\033\262WZZD\210\013\323>\342z\264\264/jO=K\373\211\353\277\376\237\376\024\022z\226\264\2578\230\366\027\331\263\240z>\334\262rI\373O\366\377\322%\355\023.\b\333\013\033\f\353\256v\255\013q\331\\\240\226\255\325j\005\201l\250q\034\346\3044#\"I\222d9a\005\004:\306\330\325\003\021\300$(\225\231\021\221@B\021\021y\323\022\020\337\304)`1\304`\031\203\370M3\323\345\006\240\370\310>@\200\221q\017\261\273H\241\225\313\211\251\200\330\035\251I\006U\273\331Axh!k\337\252\375\3608\371:\266#\b<\306\307\240\001^\243\033\016\301\036\b\036\304\2304~\322%\356\300\322\344\265!\251\301\r,"
+	.string	"\204TbH\3738\335\241\250\252"
+	.string	"`\202T\210\"\354\206\214\001\357\301\364\357\225\021\213\261\002\032\007kI\220\362R\005\0030X8\304\246Ai\f\326\234P#\367\354Rt\324x\001\006\373z\365\316\334\r\354\374\260\246\226\002\032\\h\020\027\355\024@HCV\020\242\222M\346\211\002Hr\027\276\251\317\232V\364[\217\244\321"
+	.string	"m\313OQf\311\272\371\231\211\342}\357\202w\206|\212s\236Xt\017h\230\256\252\350\202\2277\206C\332\001aU\210\036\t\370\307\211\344\374vY\330!aPL"
+	.string	"\211\212\367\321$W\352o\204\007\030v\243\f\025(\367\f\303w\002\333\250\035U\036|\211\370\006I\244\02079%\325\322\256\330<\272]\242i\361\362\3403Gg\242b\350\336d\204a\267\266b\330\321 \334\325\231\332\201>\317\275\340\265`\307\314\221\330\035\316p\277\340g\0026r\353\221\005\272\235\246\302\245\357\266\3539\346\274\226\226{\310P\214)\346\341\230\234\367\234qSC^\n\300\025\230\033\260\345\275\027\344\314z\335\251p=\315\3377r\337B\2602\230=}\336\304)S\332\275Z\370\031\267\214S\034}\352\262\203\310\377j_\267\365^\355\353\266\336\253}\335\326{\265\257\333z\257\366u[\357\325\276n\353\275\332\327m\275W\373\272\255\367j_\267\365^\355\353\266\336, v\256\264\245\247\206\203\375\0245\312\346\215\305\302\243D\ne\313Q\230B\331]\203\370\261\321"
+	.ascii	"`v\276a5\037g\270\250\007\254]\316\220\215\362)\031,\257d\277"
+	.ascii	"\217\fOVm|ky\236\036\374\001u\354\001\030\241\302(s\217\353\361"
+	.ascii	" t~2,NeF\333I\314\207\230\314\370\227"
+	.ascii	"\201aU\034\t%\017GYl\236\023\335?\032\306t\271\304\325(e\376"
+	.ascii	"\005\036\363\263\317FK\033\237T&-\023\376\307\265#\210\365\325"
+	.ascii	"\204G\244\035\350\311V\313K\202\234\b\270L\242\231\220\3035\224"
+	.ascii	"2\377\207\271@\277WW\005"
+	.text
+	.section	.gnu.lto_.refs.11548313aa7dbd85,"e",@progbits
+	.string	"(\265/\375`\272\002\255\023"
+	.string	"\346\257\203@\360\262\25090s\375\231\003\210\360g\230Y5\305\002\337\313,?\317\265\323y\272\331\006\236\201g\340\031xFtt\005$\216\353\257\233\307;\307\365\337\311\302j\221\250MI\272c\311\326\332\275\267L\001k"
+	.string	"p"
+	.string	"n"
+	.ascii	"I\264\001`/\354\365\276\\/k\344U\352T\353E\261^\222j.{E\331\237"
+	.ascii	"\354}Y\221\217wV'P-\223\255"
+	.string	"\022rIj\021\324[B\315\235^\017H\223(I\367\262\270O\245I\037o\327\275\"\322\240\356\335>~\334\221\250+\364\216\200^\221\354\025h\325\347\r\361\274(\320 \237I\357\355<oh\373\243\255e\2777i\255C\236\367\026z5\320\373@\013x\236Z\257\251\365\246J`\373D\211\021\334w`o\021\335\373\003\3549\335\213\303}\003{\021\300\336\031\330.\261Wb\247\304\206\271\354:\335jY\204eUjT\366\251{9\356\321IVT:\264\222\365\220TZ?\003\366d/E\023\360\276\326CyI'o\350d\320\311\373N\232l?!k\335+\321\206V\177\266\237\026ib\023`9%5\212\313&\247IZ\206\261<\222\255*\215\2323\210i\316K\332*\030\"\244\355Y\305\321f.\357\346\035m{f\316f&\330\016\321\2757\3345\003\246\2619&\265\001\230]^\336\225\227Q`6\251\371\205\340\026\315"
+	.ascii	"\266U\332&\230\003\246-2\357J\314*/oI\351W\352\325\314#\231A"
+	.ascii	"1o0\277\227\006FA\357\r\223\310\232\310j\262\006\332w\312\340"
+	.ascii	"Mq\233H,ww\336\321\235E\335\233q\027\200>\036;\202\370\335\240"
+	.ascii	"\371\301h!\363>\0261?\025(H\350x\340\260\341\207\237\006\233"
+	.ascii	"_\006\f\027,T\250\363\243\300z\337\004\t\252_\004\bu\336\367"
+	.ascii	"\200\365s\240z\217\324wd\327\221\003\307\r\0335h\314\220\021"
+	.ascii	"\003\306\013\027-^o\026+T\264\274S\274~b\004K\b\327A\270\336"
+	.ascii	":\256qb\333\304\006- p\242s\245y21\330A\345\230G!e\024\327]0"
+	.ascii	"\206\300\270|\217\354\256\320X\022\341_\002\254\034\3670\257"
+	.ascii	"\270\307e\255l\217e\267\225,\356\301\227y\205\212{f\313\326\013"
+	.ascii	"]\301\365\362\342\3117\200\272\006\337-\312\"\017\204\t\007\022"
+	.ascii	"\206Q\346b^f\250\235(gGI\367\340\305\244\272n\nY\243\024"
+	.text
+	.section	.gnu.lto_.decls.11548313aa7dbd85,"e",@progbits
+	.ascii	"(\265/\375`\374\206M(\002\n\177\033\305T Ja:\215\001\300\315"
+	.ascii	"\b\272q\237\374\207>f\303\371\322\364'\244\376\321C~\336W\226"
+	.ascii	"\371A\036\204\257\232-\344k\030\230\337]o\b\212\306\260\255i"
+	.ascii	"\333\272\242m\017\237c\230G\270|\325uUU\205\230\360;\202 t\221"
+	.ascii	"\301]X\312\177\264${\313-e\n\302\nW\f\375\fxj\234\2305Q\243b"
+	.ascii	"J1\247\230Q\314*Wi~\231Pnz\3358\307_\346\2232\274\275\223Ay\252"
+	.ascii	"\320\250\202\362\317-B\017\344E\037\350\212>\320\023} -} \035"
+	.ascii	"\372?}L\266L\345\332\225+\234\377\233J\314%Win\231Inr\237\004"
+	.ascii	"\222\265-S\353\276\t5%\267\016\0034\201\361\b\333;i\004\002D"
+	.ascii	"\220\225+dn\240\371?m\372?W\364\177\232\350\337\314\002\002D"
+	.ascii	"e\243\017\030\316'\321\243\213\031\035oj\252\300\344Q\255Y}\361"
+	.ascii	"\332q\2001/x@L\032f\216+w\225\247\300}\300\343\276\t\231{\027"
+	.ascii	"Q\232B\314+\023\313,b\0321\211\230C\314 \346\221\2534\201\230"
+	.ascii	">n\376\270n~M \346\224\031\247\352\313-\314\204\343\201\245/"
+	.ascii	"C\026\272E\350\177\240\364\201v\364\201s\372\3002\372\300-\372"
+	.ascii	"\300(\372@-}\240\224\276\346\243\1773\352f\216\337\234q\315\230"
+	.ascii	"Rh\024T\326\024\234\315\033&\216\233R\246\215mJy\200\265\267"
+	.ascii	"\223)5\264go\247\241{-\270\327\202<\246\005\245\013\232\257\227"
+	.ascii	"\332\2541\342f\224\371\246*L\017\234\3177\032\275E\350oB=\331"
+	.ascii	"\311\002\304\f\316\277\371dn\034eRNp\376\275S2\3612\343e\213"
+	.ascii	"\017\323\301p\360\022\347\301y\270\r\236\203\345`6\330\r\216"
+	.ascii	"\203\371`<\214\007\357\301}\360\035\256\303}\370\r\326\203\365"
+	.ascii	"L'\263\t\337\301u\260\035\274\207\355\256\322\334x\315\361\034"
+	.ascii	"\246{\306Z\376\333\266\345\t\0261\2571330hd^m\\\232\230\251\262"
+	.ascii	"\206\347\006\312\231\273\037wQy\303\303cgW\330\206\250\371b\304"
+	.ascii	"k\215\bY\027./0E\274p\027\030\030<\226,\303\203\343\005\307&"
+	.ascii	"-\fw\211y\361rcE\211\307\312\324\360\314\215\333\260\234\231"
+	.ascii	"\364*\341)\b\036\231\271q\024<\305<\243\322`\236\314\300Qs\022"
+	.ascii	"\347\312\023\027/\334\025\366\005\257\315\3348\213V\027\036\036"
+	.ascii	"37&\303\322\005o\357$\b\020F ~\224<z\204I@>\367\325\200\236\355"
+	.ascii	"\214\306r?\016\203\305`5\031\330\200\265\364\236\302\340\034"
+	.ascii	"g\004\034\203\323&\206\363\365\030\375\017\334\350r\234\301i"
+	.ascii	"0\334Ub4\370\355\230\353\332\371\005c\206n\n\r.s\337\256\334"
+	.ascii	"\325n\312\363 \312\231\326\236\021\b\020\3006I\326\324\321\371"
+	.ascii	"ZL_\177\351k/}\335\245\361\230\021\307d\200\240xt\351\302\031"
+	.ascii	"\310\245/\336\325\200Rp\213\320k#\372\332J_?\351\377\360\364"
+	.ascii	"\177q\372?-\372\2771\375_\023\375\337\017\375\037\r\3757W\003"
+	.ascii	"ztO\037\235\323G\271\350\243_\372(\021}\364\206\376\271\247\177"
+	.ascii	"\262\321?\311\350\237i\372\247\024\315\301-B\177\006\321?u\350"
+	.ascii	"\237O\372\371N?\303a)@j\274\320M\341\374\274E\343\257g4,\013"
+	.ascii	"\246\223\2174k8?\207\351\347-\375LD?\371\304\311\213\253\253"
+	.ascii	"2\234\261\223\265\213%\264#KX\020\2341\327\210\343&\007h\202"
+	.ascii	"d\fg\0233\371`\201\257\315S\030\316?\336b\023\307\t\033\316\277"
+	.ascii	"dsn\234\220\023\321\206\232\241\003\316?"
+	.string	"\3428\353\356\301\333<\243\322[\260\364\301k[SW$\017]\337m\243\273oC~\\\205\213\340!8\t\026\202\2650\021\354\003\363\300Xx\t>\202\2470\0256\202\2570\020l\205\221`%\370\007\016\202w`\035\270\307U\342,\214\343X\n\347xN\356\ruGg\n\357\326\311\271R\243\207\303\f\034\023<6m\356\233\231\364\372mI\"\004o\357\344m\223\333\302k\273suDn\234\177\004~\272otz\366\356\322\206\235;7p\223\323\036\257\275\223u\367M]\020\022\377\b\234\205k\340\033f\322\013XCk\211\267\367\376\205\203\263\256\335\2153\223l\272F\026 x\030jF\236\017\370\3562\352\266\215\341\312\373o\335\255S'E\366\217\3004\356\233P\023\321~\242\343\363\332;\371k\246\203\017p\326\305\273o!\320\330\233ll\313\203+/j\364,\367N\2020\002\361\343\023+\322\303\203\214\345\256\006T"
+	.ascii	"u\364\217m\034\337x\313\300\336\360\223\3227U\007g\0345\342\330"
+	.ascii	"\006\005_\310\204\301\371'G\337\204\3237\325\364\325\256\006"
+	.ascii	"\364\346"
+	.string	"\025}\363\211\376\333\325\200^>\267\317U~\270}\277z\256\232\003\241\222;m\357\344\020\260\215\036\0215\234o\"\321\277\037\320\241\276\276\276\276\373\001\275\031D\347[\204\336t\322\307k4\236\354#M\222.\234\217\315\350\343\244>\356\322F\330J\037\317\320\037\362\350\337;\035\302\033\375\253F\237\315M_N\213>^\227&\272E\350\227W\003\372\353C\377>\351k@\037\003\332\303\325\200\3363\027\315Unp\323$\207p\023>\\\260\340|\025\364\357\006\250\331\327w7@\217Bsp5\240\227\314u\273\312\tn\231w\360\301\315&\264!\013}\304\372\350\301\371%\364\357\004\350\355\273\023\240\037\241=\210\331@C\265)\311\302\260\335$\226\030\237,\277l\377\325r\267\334\265\213\2657\324\336{\303\235q\227#\017\316W\355r\271J\016\327\313\357\227\013\346\247Sr'\367\336C\267\316\326S\025\316DW\003\212o\021\372"
+	.ascii	"\350\337.\307\340\264?\270\326\036\330\373r@o_\337\345\200b\254"
+	.ascii	"\253\001\305\340\026\2417m\304o\226\"\224\352*\271\325\366\336"
+	.ascii	"CBUbY\272\340|\341\026\241\377\305\302\341\007\026\306\210\022"
+	.ascii	"\264\t\206\222>r \301\371\277g\377\265r\311\256\231\031%\205"
+	.ascii	"\265\325\366N^\370Yq\323R\303\371\232\341[v\223\277f\367\312"
+	.ascii	";\370\340AP\233l\357\3445\313{;\335k\201\320\275\026\234d\236"
+	.ascii	"8aA\363\261~\362j@\365-B%\350\360\237'\021\336\"\341\002k\375"
+	.ascii	"\346\214s\303\217O@\220k\374x\312\t\301\376q\227SC\007\362\n"
+	.ascii	"g\206\337t\312L\310|<\213\376\\,\312\203\3610\370\361\0273\005"
+	.ascii	"\323xb\370\261\005\032_\220]d\342\177^\370\257\007\314\016\\"
+	.ascii	"\f\314\243<\005\223\t\222[\3409ix\205\024N\242?Gp\n\375g\320"
+	.ascii	"\3774\347\317y\366\375"
+	.string	"\231\357\317z\177.\262\202\221\037\275\363\337\257\253A\006R\347\317m\031\35779\340\360\243)\b\t\340\255lv\305\374f\005\331\3567u\207\bn\022\fgH^\302\002\3571\2158\370\321\021\031\316\237\335\024\241\001\300d\202\334)W\t\206\303v?\177\3362\373\354Y^#\317k~S/\313\345w\310j\376\234\346\317g\376l\346\317m\377\313\362\227\037\363i\300\177\352\371M\323\224\372q\370M\017\362\026|\20738\030<'\ro\275\202\037M\372M\272\272?\007q\023'k\371o\322\177?\200\361\200]\247\0169\013\276;\323\3409i?62\211\177N\221Ud\025\260\230\353oj O\340\307\026\370M5\243\375\370D\232\317\314<\271\002\331\002p\031\003f\276\001\213\016\030\270\202\347\307]9\231\315\376|AY\306\1776\377\234\377|%kpB\003\360\005%d\262\337\324\007\203\357\344\021\177\266\362\343\261\261\\"
+	.ascii	"|\206%\213\205"
+	.string	"e\260\337\224\313U\360nt\235\276A\232\255\237\360\24360\231\034\304\214A\305\224\201\341G\365\376[\201y\224\247\374w\n^\313R\262\326\200E\376\372M\021\267\340G\203\277yBY\231\243?\n\347\277\032`\021~|\200k\300\342\b\301\217\256\371/\005\376\213\201\377\256\377\r\376\367\003\367\311\324\t\370\263\223\037\207\311M2\327\217\007\360\343\016~|\364\233\022\310L\376\247\311[\246\212\247p\026\327\300L\201\036y\232\274\365\233m?n\222\227\374\267\202\254\344kg\303o\032\334\350e\247\340?\237\374\271\350\307Q\222\230!\336\312n\341GU\370M$\222\254\225\225M\300p\206d\007\034\371\257\022\013\031\353?\213\262_\360\243\"\356~\223\316\237\215d\017\330\350\317E~\263D&\262\301\217\235\374\357\360\242\037\335"
+	.ascii	"\363y\031s\353\177\207\353\377\344\373\315\016\307?\332\201\337"
+	.ascii	"t\303p~3\356\317C~\323\314\377\276,\004\333\005\375'\231\037"
+	.ascii	"\223\t\362\3374\377=s\353\376\253\346\307A\031\310\177\243\037"
+	.ascii	"\013\375\302\217\312\370q\213\037\247\277)\344\277\371\377\n"
+	.ascii	"\360\233f\277\211\366\233g\277Y\366\233d\277\231\374\315\264"
+	.ascii	"-\177\366\361\233L~\323\312o\212\345\036\377\207\376\037\216"
+	.ascii	"?\363\370\263\325\237\251\376<\365g\251?\337\370s\324\237\237"
+	.ascii	"\376\334\364\347\016\374\231\003\177f\3723\362\317\033\370s\361"
+	.ascii	"\317\304?+\375\031\351\317\303?\267\370s\006\376\214\201?[\340"
+	.ascii	"\317\025\370\363\004\376\034\201?\253\370s\212?\247\360\347\023"
+	.ascii	"\376l\302\237I\370\363\001\376,\302\237;\370\263\006\177\306"
+	.ascii	"\340\317\036\376L\301\237;\374\031\202?g\3703\321\237\205\376"
+	.ascii	"\034\364\347\237?\353?\243\177\316\277\331\3477\367\374f\236"
+	.ascii	"\337\\\376\246\235\337\244\363\233r~\323\315o\326\375&\335o\256"
+	.ascii	"\371\315\270\337D\363\233p\277\351\366\233c~\223\3557\301\374"
+	.ascii	"\246\227\337\344\362\233[~3\313o\016\371M\251\337\274\361\233"
+	.ascii	"$~S\306o\322\370M\247\337\334\277\331\201\337\\\3417E\374f\373"
+	.ascii	"\233\307\337$\376\246\006~\023\3517[\374&\006~\323\002\277Y\201"
+	.ascii	"\337\234\300o\262\370M\025\277\231\3427A\374\346\206\337L\341"
+	.ascii	"7O\370\315\006\374\246\t\277y\3427\027\360\233E?\336\363\233"
+	.ascii	"\t\370\315\003\374\346\007\277\311\301o\206\370\315\r~3\203\337"
+	.ascii	"\274\3407=\374f\207\337\214\3407\215~3\303o\022\375\246\320o"
+	.ascii	"\376\374\246\376M\3647\315\337\274?\346\363c\276\037\343\371"
+	.ascii	"\361\235\037\353\375\030\357\307w?\266\373\261\233\037\327\375"
+	.ascii	"\230\356\307k~\034\367c4?\206\373\361\333\217\335~\034\346\177"
+	.ascii	"\n?\006\361\237\305\177\355~\\\345\307k?\376\362c/\377\327\376"
+	.ascii	"\033\342\177\331\3774?\356\362\343-?>\373q\332\2177\370\361\330"
+	.ascii	"\217\305~\f\366\343)?\216\362\343\256\377}?n\362\277"
+	.string	"\314\217\267\376\203\371\261\222\037s\340\307\303\037_\340\307%\374x\204\037\223\370q\210\037\177\370\217\302\2175\370\261\004?\026\372\261\205\377\272\371\257\333\377\025\377\255\362\337\255\377\036\371\257\323\177\237\376+\200\377~\370\357\006\377\303\374g\373\217\366\377\354\177\362?\227\377g\376w\350\353\353\353\373/\030\375\023$\371) \"B\224RSp>\006I4\030\030J\246\267\nZslaK\232\354\251\261r\224l\250\306\036\025\030\234\177\007\035\373\017\274NY\246\360p\376\3211T\354\204-f\364\354\202\244\342\314\345\3019\314d\363\377Tv\240\241\201\3631hB\277\320)\350\027J\005\245\"E\312y\267\367;3\344\305\013\2264\234\177A\236\376\005p\350\023\324\013}\202BA\273\320.\024\312\335T\031\340\321z@\037&a8\243P\356\033\020\234\252\260+8\377\2023\375\013\2160A\2330\341\3422k\273zL\372\326p>"
+	.string	"\362\350\003\300\313\222%'\223\234\334U\020\240\233c\013\233\222$\311\311$\023m\250$R^"
+	.ascii	"\270\322G\217\\TK\353d\022F\n\037\375{2A\177\264\310\257\022"
+	.ascii	"-\202b}h\253\242\203\033\222\347\013\036\234Q#\27758tWp\276\005"
+	.ascii	"q\364-`\243\037\342\242C\206\234\214\t\333\251\212\2030;\304"
+	.ascii	"-P\352\037\r\202\006\301\333\204\355d\205\201Y\233\005h\250\017"
+	.ascii	"\364\n\365\201\376@\177\020\355'8p^\373\352\352\303P\032\333"
+	.ascii	"\023=\234o\201\025}\013\236\240V(\017\324\n\335\201\356\340\360"
+	.ascii	"\343\t\023\331\323\247\013\316\267@\211\276\005W\372G\251~\225"
+	.ascii	"(\325\311v7\333\335\033\214\226\227\023\326\242\310p\276\005"
+	.ascii	"NRR\350\324\bWXNN\007\260\022\005\214\3075\223r\006\r\232c\213"
+	.ascii	"\023+u8\337\203\236\276\0075\372Go\2407n\234\236\001\265\261"
+	.ascii	"\230\b\371\220\322\312\203\266\005\212\007$\372G\243\320\250"
+	.ascii	"\3736\302\025VS\035\017W\316\254=<b8\337\003\220\031|P\032\327"
+	.ascii	",\357\253\335\244\347A\r\026\017;\364=\340@\237\320\247kf\264"
+	.ascii	"\233\36280\223R\201\035\375\237}\277\312\263\017m\312Mh\273\t"
+	.ascii	"(N\230/7S\255\006[\030\234\321\315\244L\024\032\234_A\235~\005"
+	.ascii	"a\364\234|\364\234n\350\3367\211\245\203j_Q}\330\263\347t"
+	.string	"\323M{7%\267\016\2433X\256>\b\265u)\261\302\371\025\224\351W\200\204\217\317|\032\341\nm[\r=i\372r{\232\203\022\006\347W`\245\377\023\217\362\304\203\367\bjXNV\030\204\251\322\332\003*\233\003E\206\363+\330\372?\357(\317;\330IvB\333V?3\332\364\310~\312\314\312|\301\371\024\344\321\377Y\207\316\251\207\367\b6\366\316\022\373\221yJ\2068\005s\372\024\250\341\341\315\240\323#\013\342;\343\203\203\363)@\"G\316yw\242\275\367\323\336E\210\374\332\244\234s~\336\t\221\221\301\343\303\371wN&\377\201A2\\K\234OA\025\0348\247\035\007e\264~\332]3`\024)ZR8\237\202'7nv\314\261\205\241K\236\274\344\352\352\256\331\323\034[\330\246z\013\001\224DO*\016\347O0FGg\246\005\344\362\021\307\013\347O@D\377Ts\3175Wy\256\271q\037\266SS"
+	.string	"\314\244\234W=\266\304p\376\004Q\372\367\306\241\377\031\367\253<\343\316/\267\211\352\356\335\245\356\t\320\0270oqp~\207\245\376O4\312\023\315e\313Nh\273\351\003\252\271\257\260\275\257B\0045\321\340#\004\347w\310\323\377\t\007w\337r\023\332\326\361SCJ\0331\313\275\337B\230=\330\316\324p~\207,\372\327\354\236o\177\007\037\\\345\371v\315nr\353\320pEo\216m\271\251\336B"
+	.string	"\341\t\222&\r\316\357\300D\377l;\307\374$\243<\311\234nw\357\275\257vS\336\007mmsl\313}E\365\341\377\235\253<\335~\027\264;\234sS\272\272\340|\t\362\364\375\357v\242\332{[\235\311M\365\024\204\376\367\367\274\367\303o\341\232\027"
+	.ascii	"\377\363\336F\342\3364\372`\355\275\257\035-e\315I\210\207\375"
+	.ascii	"\377?\345\366\206\312j\032!\253**-\253\352B\024T\326\217\250"
+	.ascii	"\264\254\252\013QiY\273\t\252\253\351\002\325\316j\212J\333\373"
+	.ascii	"\302\336{o(\250\246\023XUQiN\373BT\332\256\3323\346\252\356N"
+	.ascii	"f5m(\254}aCm\247\235\206U\345!\n*\253**\315\251\352BTZV\325N"
+	.ascii	"\313\332D\033\312\211\312\006\324\246\272\260\323\262\362v\032"
+	.ascii	"V\025QT\032VUTZ\026\235\273\205\243\254\216\017>XO\370\356Y\024"
+	.ascii	"\324\236"
+	.string	"\3121\304\211\212H.*\211\265\337\354}\325hl\252-\2677"
+	.ascii	"\366\036\202E\365\306\351\307e{\222\233z\362\342\204u\223{o\016"
+	.ascii	"9\236\264\2606\224\\\323\335rQS\260\366\236\362\244\264s\354"
+	.ascii	"\275\267\007MI\271\315\344\3125!\031\262\245h\354\035\301N\356"
+	.ascii	"\235c\357\246\273\345\366\336M{\357\037\325\220\344\336A\210"
+	.ascii	"\242\274r\344\330\373\312(\307\036\322\024\206\306\336X\315\216"
+	.ascii	"\255**M\013kD\030-i^\273F\262\351FIam\257\375&\213J\2475\235"
+	.ascii	"m\251\275\367\325\323^"
+	.string	"U;\352\234a,,\217\024\031\203\363%\020\323\347\032\332\247\013\0178\234/\301\226N\002\261\025\341\302\003\347\323\013\035\037W\023\234/\001\021\315\345\354\022\224\303\314\226:\234/\001\016.Z\316-_|D\240\247\205\354Wy\222\235i#\250\351\rUf\207\267\367U\b`\033#t\356p\306\"\204D\352n\r\347G G\377\2529\317N\263\274u\345\324r\0255x'\332\231\274\312\363\354,\313g\347\025\274\205\240\222\273\352\247\244\253\"\306\214Z\203%\n\232\037\201\232~\004g\372\021|\351G\360$i\276\225y\"\205\363\177\212\375*O\261\023l\0045\254\275#\004)Q\354\330\226{_\205\320Df\270\305\301\371\021X\205\201i\251j\233\302\371\254\202s\264\265\311\263\347\234\002\243\016\027\\\236\024\2573\n\376\201\343\313\212\215\327\223\263K\323\361%9\263\366\204\353l\002\304\n\202\305\t\347s\330\302un\0059\371"
+	.ascii	"\263\006\347s(\323\377\271\344\324\342z\343\206\r\347\031q\274"
+	.ascii	"H\324\2003\342\254B\343u\0229\203\234Y\347\325Y\344Tr\n9\223"
+	.ascii	"\234X\347\220\363\310\t\344Dr\3768\215\\\345\251u\362\370\331"
+	.ascii	"\343\364\321\226\373\356\274\360S\034\234\250\023\307\225S;!"
+	.ascii	"\346\r\336\0168/;Pr\362\370,\361N\255S\352\324q\345\324N\354"
+	.ascii	"\251\251\243a\347\225\373\3209\265\3164^{'O\255\263\351|\232"
+	.ascii	"\343\005\346\324:\255\356\332\225\333\332\031\207\024\256e\030"
+	.ascii	"\bs\307\332\324\227\207\214\223W\003\372\341\026\241\347pC\337"
+	.ascii	"\210O\337\310\215\276\221\233\276\021\226s*\347\225u\341\300"
+	.ascii	"\371FO\316\034=\316\033?|\236\304\\\341|#\033\247\215\r}\364"
+	.ascii	"7\300\321\337 F\177\303\025\375\rL\364\177:\375|\372\317}\331"
+	.ascii	"\f\200M\216\0378\233?F\374t\322}}mLp\376\206 z\350\026\241\337"
+	.ascii	"@C\037\202:\372\020\304\351?\357\321#DeJ\216X\326\223\363\330"
+	.ascii	"\341\332\261\304\231oHM\025\266&\234\017A\027}\022s\324\274\354"
+	.ascii	"\330)\275\240\334\3447W\356*\217}q\243\227\351\254\341e\275\f"
+	.ascii	"'\277\0212\367v\362r'\347\345\275l'\343\311u2^^^e\326\313wq\332"
+	.ascii	"|\220\365\262\0348VzA\302,l\301\001\204\t\206|\b|\350C\340\244"
+	.ascii	"\257!\217\276\206<}\rm\3645\304\351k(\243\337\374\276\261P\200"
+	.ascii	"h\301\371\032\302\350k\330R\307&\2471\203\303E\227\347\2562\263"
+	.ascii	"\311k\322\330d5fx{'3\233,w\343\266\314\305![\366}\221mA\3635"
+	.ascii	"\354\320\317\300\247\237A\215\376s\\F\023\304\207\036,8\377\272"
+	.ascii	"\351\242\307LN\223\317d\270\253\314h\362\033\234\214&+\363d4"
+	.ascii	"\331K.c&\331\034\200\205\017\217\r\232\314\305\f\255\215\020"
+	.ascii	"\223=M\244~\3623P\321n\370\336i\022\245\017\316\317\200D\237"
+	.ascii	"\004\230en\313l9L\222<c\262\230L\346*s[^k\313_n\\S\bj\254\346"
+	.ascii	"\250\210\324\305\351\234\303,\365\025\224\224\017\234_\264G\277"
+	.ascii	"(\216~\021\234~\321\027\375\".\372EU\364\213\220\350\027\321"
+	.ascii	"\320\177V\313[\206\220\350\321a$k\311Y\2562o\311i\037\240\201"
+	.ascii	"Y\201UYn\311X\300\234\300\252,\177V\336P\341B\3631\244\321\307"
+	.ascii	"\320\246\217\301L\377\371,'\201\262XiR\227\315rY&\313W\262\225"
+	.ascii	"\253\314\311<v\263\306\315\373\245B%\017\214\307\262J\227W\230"
+	.ascii	"\023/\260d\026\243\022\005\214\307r\357\244Q\227*n\216\004\345"
+	.ascii	"cp\242\217AK\037\203\017}\fP\372\027\350\350_\200\323\177\236"
+	.ascii	"\222\277\272x\351\201\301\371-C\021r\"\332\273\213\016\236\224"
+	.ascii	"\034\345*\363\327\363\327\225\333\312cp\360r\227\245\026\034"
+	.ascii	"\232\177\301\314\311]\331+?\271\312\f\345w^\031\312\317\023\264"
+	.ascii	".+\266,\211\036\355\244I\r#ijr\223\377\326e./{\357\r\332\306"
+	.ascii	"\035>yp\276\317L\362VY\016 Q8\347\255\257a,5yE\226K\264\200O"
+	.ascii	"Xczp>\t\2548xZ\271\310\034<#r\274\262r\222\214$+\271\312\254"
+	.ascii	"\225\217\250\321\312D\256\254\321\332S\n\331S?\371\027\250\350"
+	.ascii	"_\320\322\277\020\245O\344F\237\b\213\376\363\220\034D\013]]"
+	.ascii	"\030\316\277f\250\340\340\t"
+	.string	"\311>\362U\006\222\177\\e\016\222{\250\355\210\363\262c\245&H\346q\343\256\334\326\bdir\220\\\365{\342\244\345c\271wR\0035nnA\371DV\372D7\364\211\236\364\207\226\372Cz\372Cv\372\317:\3148w\330p\201\303\371\317S\271\006\032\246\311\335\034\0343\316\225\333\332N;0\220\322d\307\266\354\023\306\216m\231k\230r\314=Wnk\357\035\002\210\222g\307\266\3145\362\023\016\274\275\223\271\206\331\227\235\2548\210rf\307\266\3145L>\327\f\203(k\354\330\2269G\306\221\243\262T\266\221o\\e\256\221\241\236gd\032\250]\234:F\204\362\305\272\032\320\f\267\b\375\320\030\375!.\271\351\322\355\345\261\201\363\207\306\362\036\362\322\037\322\322\037\362\241\365p@\273\352\362\220\301\371C[\277\231x\256\334V\356\363\206\227\307\\^\245\311g\322\3413\327\230wB\347\336Nk^{o\020\034@"
+	.ascii	"\031ARe\003\315{P\346\322\f\233\022\347\013\265\321\353\222\247"
+	.ascii	"\264c\3361\353\\\245\251g\342A\3511\251\332\363Z"
+	.string	"\236{x|y:_(M_hK_\310j\316\315\273\237\325\230318\337/#n\316as\243\261\007\347\013\335\320v\034\202\316\264\351\262q\276\205=}\013t\3727\337\270!\303\347M\f\316m\314\272\2534\335\230l\336L\271+\267u\"O\037<7\346\032\223N\350\334;\213\217\327\336\233\003\b\020?u\270\202\240\371\026\326\364o\316\335\244\273k\027k\003\320\01698@p\356`\304\31594l\314\021>\234oA\251\325\030YX\202E\305\b\316\267 E\377\2029s\327\204\316\275\261\370\274\366\336\377\3158\023\315U\232iL8\234\334;-\215i\346\256\t9%7\325\017J\223\035\233\311\227\226\006\017\315\267pC?hO?(O?\310\256\314\230\334\005N\216\t\316ucdcm\246\030\323\315\fc\2221\331\256\322\034c~\271\t\306\\\273uc\3140\261\021cL+V\3141f\231\351\305<\243j"
+	.ascii	"\235\030\336\336;\277\345\331V\204\362M^\r\250\321\233V\n\277"
+	.ascii	"\360`\301\371A]\364/\031\027S\313\023\274.\346\026S\355*M.f\226"
+	.ascii	"\233W.\234g\022i&\026!(\242\r\245\325\304K\215\311\30543\261"
+	.ascii	"\\9\265\355T\345\001\2253:\270\345\336\033\204\021\b\020?O\214"
+	.ascii	"\030q\243\363\203\242\350\007i\351\007\031\321f\322<\273\312"
+	.ascii	"\2231\321\230\224ib\202\363\203~\350\030{\357}O\006\375\235\f"
+	.ascii	"\372\240\035\372A:t\320-B\037\344\244\017\264\247\017\004G\037"
+	.ascii	"\210\215>"
+	.string	"P\032\260/4O\226\031.8\237D\327\225/\223\213Kd\310"
+	.string	"\315`"
+	.string	"\2657\215\035\243\217\326\031<3oG\364\372|y+\003\254\223%\247\307\r\315aaF\027*I\334\314$\277/\275\267:8_\0040\275\266\006l\333\022\200\330\031\030\21761xG\232\031%b\302\240q\224_\226\260\235k\300+Q\266\030\233\t\345\274\023#$\n\316\027aK\003\271"
+	.string	"\271"
+	.string	"\277\\\252\0044\t\363\345\006\374\002\364\022\204\317\231\030/@%\022\256:(\350\376\tsc\003\003v1}"
+	.ascii	"\241\304}\305\301\371\"\b\321?P\r\245\262\345'\307\306]\036\027"
+	.ascii	"\316\311\fW`SY\316;\264O\235,a\322\264\033\320\2205(8\260\240"
+	.ascii	"mP\340%\273\240\241sB`\350\344\334\235\375\226BJ\032]\354$O&"
+	.ascii	"h\320\366\270\231i$\270\314\306\033\2332\r\025\264\351\224Y]"
+	.ascii	"A\325vlI\321BvZ\251{rcE\177]/i\342\266\214\235i*\250]q\023\323"
+	.ascii	"c\230"
+	.string	"/\355H\2200\2745\227;9\034@\260\337\2327H\304pTA\371\364\021%y\240\250\240P\200\272\222bfL9\331\200z\\Z\226\340\f\354\002v\001\277\216\301\251\311\317\020\035_T\313}\305\343\303\017\214r\340\027\r9v\346p\006z\235\214\036.flp\006B9\2313qZF\n\260\247\205\320*Nj\204qr\212\301sE\362\344\232\344$Q\300X\341B\337@,\225\2401\271q\350\217\031z\224[\2771\026\362\306\366\234,9\277(\021\343\353\001T\302C\013X\0345`\022\324\316\022\256\316F\222,\016\036'\254\245\265\220\241\355\025\301Y\332\013v\362c\216\221#\350\224X\332\227\026\254\037\0354=\222_8'\311t\350h\202U\004E\003\342\263\241\347\006\221\323n\001u\244\222\f\371\301\r\275\301J\"\205\363\257\022(\304\215\013\220--\234\201W@ \007\00690\b\006\0061\373\372\320+l\266"
+	.string	"\177\240v]\306\350\321\001\364\361\033\342d\356M\026\316@\036@\036\347\235\230V\0251K3bOW8\277"
+	.string	"q\200V@+\224/\215\334\334\327\205:X\310\340\374\002h\001R\001\251N77\035M\314\364\320\025\301\371\005\260\002N\001\247F\264q-\315+Pe\274\340\374\020\372"
+	.string	"\245\200R$\264\270\226h\230!Y[8?\2049\340\r\340\215\262)\272)a\271\to_\251\001g"
+	.string	"g"
+	.string	"\243\214\260\232\366\204\276\244\264\362\374\272\340\235i\32580\n\315\022%\310\030\234\2014N*bs\3404\021\003>\001\237\200Mw^kDBX\322\327\007ljk\223\361\270q\365"
+	.string	"\356\003\2330\027\2315\271S\031'\013\307\034\316\017\301\007\037>pSu\330\226\370\314\324Z\030\234\037\302\f<x\264\036:4\332\352\312\266\312s\255\347gJ\017\225,\232\217\214\031\035\337\022=\023\253\242\206\3632\337\375\2245\201\022\005\357\316\235\337\224\251>lc\2263\320\210\351\351\375P\345p\263'\314\\\003\033\243\006\347\023"
+	.string	"\t\036\236\316C@\025\030\217&,Rw8\347\315Y\301\3318\237"
+	.ascii	"Rww\247[\\\326\242\307\255\n\316\007\241\217\235\235\226s\211"
+	.ascii	"\222Ou:\274\260\324S\335\2318\327r,\320\360\222\026\345T\033"
+	.ascii	":\333\322j\202\363Ax\363\346\r\004\326h\355\205\375\346\344q"
+	.ascii	"\r\301\371 \300\265is\272]\242\344\023\035\023\257!\";\304d\301"
+	.ascii	"\371 ha\303\346\334C\331\246\352\260\331A\213\022\005\347\203"
+	.ascii	"\32057\207\276M\325a[\006}\215i\023\242GN\356\274\273h[G\220"
+	.ascii	"m\356+\254\210\232\266)8\377\003<\035\247\343N7,U\304\204\215"
+	.ascii	"9\003f\205\363?@\203\006\315Q\253\201\343\223\304\371\037(\341"
+	.ascii	"\340\336\246\342\214\375\234I\325u"
+	.string	"\341\374\017\260\336\336\214\352L\265\331[\346\2634k6\316\377`\307\2301\332\315\b\253)\017\003\260\254.\253\245\320\232X\332\032\231k\267\273\346\325f\307\021\017\352\210\021\023\201\2516{d\272\314`\203\363=\350\302\306v\272\221M\321M\261P\346M\037\035\316\367\300\006\0300\347\235\021\226I'K\313G\330\217\226(l\264p>\211\245\356\242\273h/FVvT\301R\336\344\225\321\312k/\231\211\234\036q\256\331\r\2536:55\255*b\226a\332\216\024\301\371$\314\312\256\323\312\264\226\"9F\373\tj\027\031\362\2132e\245\310rG\r\371p\276\361\250\313r\255\345d\206\204$\251\202\322h\327X~\340\317M\335\0314\234O\302\210\326\311\353\263\037x\n\331\021g\n\316'\021D\377\332\354\007\006m\241\211\253\203\363I\360\320'A\245\3114\031j\307\316T\023\270\260.\\\264\240\361\2312E\217]\264\255\243"
+	.ascii	"N]VazXxh\211]\217\235\311>\271 8k*:lN\r\017\213\016\323`?@z\314"
+	.ascii	"\370\242\374\232\256r\346\265\367&\n\262\263\363E\r\347w\200"
+	.ascii	"G\377\316\327\250\200\021\353\322f\353[\372\353\242Q\260Fk\357"
+	.ascii	"M\353\350\353\233\322Q\256\2776h\"\307\006g\355D{\375\352\346"
+	.ascii	"\300y\361\322P\336\364\230\352\302Yw\031\241\230s\245\f\316\357"
+	.ascii	"\300\214\326O\360\032\270'oz8k&\272\311\177\240\256\021\365\365"
+	.ascii	"\244\211\346\212kJ3\307\001si\222\003\253\003\245V\242\225\234"
+	.ascii	"v\313\034n\366\bm\2113\244\013\347w`Eg\351,\215\344\312S\025"
+	.ascii	"1h\333\235\220\"Z\353\032\311\215+\263SfF\007N4\226\306\032\221"
+	.ascii	"\245\345#\314B\225\"D\2228\277\003\"E\212D\251\372r[f+nr\254"
+	.ascii	"\341\374\016l\\]\351!D\204\252Hi\345Y\026A\323\306\215\006r="
+	.ascii	"D\013)B\327E\206\263\0162T\346\216\0216\234?\202\217\376\235"
+	.ascii	"\223\312\177\340\206\276&5p\376\b9\332\207\366a\005\255\313\352"
+	.ascii	"\247\212\256\212\017\234?\342\213\266\322V\232\007\232\251&p"
+	.ascii	"a8\210^\034\227\336q\315\343\247\017\215<\345\327\177 \007vM"
+	.ascii	"\272\272\250\250\240\240\\OI-\"SS\247\333M\250]\344\211W\246"
+	.ascii	"\022\007M\016\347\217\300\241\245\264\024\336\324\222)K\254\245"
+	.ascii	"\316\231-\270\0337N;#\017Mzm\304\\\231N\350v\031\234\317\001"
+	.ascii	"\027\035\245\243P\252)\2550\013j\254\326\252p>\007H4\rM\343\307"
+	.ascii	"\312l\342c\215\016\347s\360\244\267\336\032\352\303\225&0\036"
+	.ascii	"@\2678)&\032J?\t\361\362b\005g\355\024\324\347\206\316\f\347"
+	.ascii	"\213\250\243\233D\300\365\351\363[\256\321\265\021\263<\253X"
+	.ascii	"\205\311\202\363E\250\355\331s\201\344\334\027\225\034o8_\304"
+	.ascii	"\224<yN\273\fW\242\200\361\270g[t\300\340|\021D\366\366~\313"
+	.ascii	"\273\246\327F\314\317\025\0320o\360\374\267\274}k\262\240\201"
+	.ascii	"\362\037\030$%k\206\036\316\027a#/\357g'O^\222\347\212\235\235"
+	.ascii	"\237\036\037\020,>\277:\303$[\306\340|\021[\377\210\357\356\356"
+	.ascii	"G\307\b\253\251N\bQv\264\021cJ\365\0303\205\016\224\337]\234"
+	.ascii	"\0328:8p~r\314\346\200@\256\020\211\363\213\363\237\234\237\274"
+	.ascii	"m\307\013\347\237\335\311\204\215\327\326\203s\343\346\2643\322"
+	.ascii	"\373J\022\035x{_}\030\232\243\373\262\304\371G[\352\352N\267"
+	.ascii	"\025Nm|\004\r\211\333q8\377\310\n\035\335\351v\321\266\016\243"
+	.ascii	"0N`U\202~\3208+\202\363\217\240\310\311\375\326\030a5\345}\330"
+	.ascii	"\313Q\347m\371C\212\230\215\337\232\223I\226\343\326\267\007"
+	.ascii	"\347\037\345\210\213\273{"
+	.string	"9\350\214\375\264\366\244yjC\203\346\264#\261\306\216-\363\031\021\3431\366\366\366\203S\300S\033s\314F\033#?3\377\301\335\311\"W\206\363\357\340\375\037\210\306\351\330\223\347\313\315\355\264\273h[\207\001\244T\021\023\266\367\325\007\275\205\312\312\030\316\037\300\325O\214\230\337\030#\254\246;\277:9\334\354Y\356}\365A\210N\311\r\034\277\266\377\306\f=Qq\362\305\311\177\240\205\2609u@\344\260\261\341\255m\354\235\025\344\007/G\233*\027\236\310\201Y\001\003&L\223\326\336\b6\252\250%J\345\317K\206J\356*\027Vm|p!\203G\f\316?/\002"
+	.string	"\242\377\037\227\037\227k\226\233\222[G\0063!\270!r\340\340|\001\344\320\377o\313o\013j\227\235\2106T\0228\266Mu\025\002x&\210\026\0328?\004\235\"\377-)\362\3132\342i;)1h\223\242\305\344\274\234\341\234\226\204\302\001D\251\206\363C\314\351_\262\255\037\327\233\272&?&\035\236\242L S\203\327\365\363\272r[#TA\203\367\365\033\273rWD\033\n\214\034\274\262\237\223\037\023\241\246\013{#\211\363J\376\260\374\320~f\277+\277\263\253\374\225\375\242\030\375\312~O\200\332\334\201\"'\224\267>\247\303S\224\tevx\277\261\237\224\237X\207\247\250\355\224U"
+	.string	"\267\034ed\313\237\225\037\331U\376\306n\224\334[\215\203\005=p\226eh\376\177baAl7\204\324\300\371\007v\323\316\340@\202\363C\240\351\377G\345*\177U\276\370t\341\374\233\36296\232n\340\300\371wN\346?0\367\bc%\r\316\017a\246\037BL?\204\023\375\203\242\353\360\210\304\341\374\020J\364Cd\351\207 \242\037\242\207~\b*\375\377\270~L\31648;qL0]\032\251'\234\037BJ\377\220\374\224\f\215\261)Q\342\374_\222\377\300\024\270\324(q\316Z\370\f\024\257\0348\377\227%\364\246\213\313\031\316\377\035Q\366\331\001\202\363\017K\323"
+	.string	"\321g\203\037\"`\214\b1\362\037\326\377\323\201\265\254\320\307\007\017\316\346\225\021\377\031\211s\3033\303\371 \320\350_\261\373\233\372O\310o\3527\344\303\225\023\217\017mmCB\344\033vNH\332\274\214P\341\374\373\361\003\362\013\362\003\201mRtCp>\2101\372\277\253\377\300\237\255\271'Tp\306=\376\363\361\003\177dTP\\p>\2105\375\337\216\037\217\037h\362A\323f\003\347\203\330\242\377\263\372\017\374@\234#b8\377\2524\r\020a\033"
+	.string	"\355\320\3464\301\371\377Q\375WeJe@J\310\025\035\234\177:F\374G\205\241\250\2359\203\263\205[\204\036\204\016\375\223\372I\235v\300\275\357\374\364\200[\315Z\032\316\017\300\236\376\257\306\375\331\230\362\273q\337Fx\332\273\210\223\337\031\255"
+	.string	"\320\351\007"
+	.string	"\214\376\275o\350\377\203\372U\376\240~42\024\332n\022Z\223\302\265\\Fy\022\023\007\347\337\f'\276'[p~"
+	.string	"\310\364\003\220D\377?\247\237S\326\323\004M/\210\221\256708?"
+	.string	"8\372~\373\232yhJn\035\227\017\335\007>\372\037\346\350\037\335\203\346A\371\324\261\200\217\336\0078\375\017Y\366\320<{(\037\036<(\237n\342\203\345Zeycgy\224\017\330\007\rX\220\017V\364?p\325\251\203\332\271\2435\307\266\374YSe\314\224\336U\242vN+b\222?>\340\270\273C\361L\320\240Fk\216m\t\226\227&\n\235\243x\327\314\002\031 U\204\340\374;\367\355?\360\324\332\223\263\206\3637\320#G\316\233T\237>B@\246L!\303\371\033\224\321?\372\346\rj\247g\354\235E$\2046)&\031/@\340P8aOv,\301\371\033\220\351o0\204\r\033\264\215\002\352\264\361q6\261Qr\2053Z\007\324t\226\344\r\347o0\245\257\201\03699t.\00404\260*K<\267!^\3205@g\332 \341\302\371\032\314\321\327"
+	.ascii	"...\212\006h\372G\321\374*Q4\247\230\021\256\260\366\016\001"
+	.ascii	"\200\035\251\222\343\362\302\371\032p\301\301\335\265\021\266"
+	.ascii	"\266S\023\006fW!N%I\244\264\301\371\032d\271\271\241oCk_]Vh\366"
+	.ascii	"~\350\300\031-\363\263\246\274\252\302\371\032H\351k\3604f\314"
+	.ascii	"\215\033a\013\313\311\t\003*;0\225\2614'8?\003=\375\243bP1\271"
+	.ascii	"\311\bjXNQB\240"
+	.string	"\322\004\306cyg\303\315\023\234\237\001\034\215\262\241l\247\233\336\034\312\320\351\251\301G\004\347gpF\377(\230\253D\301\344\255\021\324\260vU\bfyZ{\277=\005H\026\234\237\001\033\352\005\365\002\001\275\f\272\272t\t\323\226\201\225\376Q-JT\013\2526\302\026\326\266\342\300\254Jko\tg\326f\b\316\350\026e\032,m8?\003\032\372\030\334A\323\320\264\036O\030\310\351\037M\242I\024M\350\t\232\226\017\013WN\320\244\340\214\236\331=9\222\207\3631X\323\307@\254\254\354t\243\200^\016W:R\227\326\226\305qI\b\004\002\r\351 \241\240+\035!\225\332tID\321\270\264d\024\026\327\224\005\032Y\031I?$\024K\304P\201\301\225\216\202G\344\222\210#rImS\241\221H,ALWV]qD.A\340B\250*\025![\326\230b\250\262\251\322\n\025\231\252D\225\225\240X\002)#\225"
+	.ascii	"\007\027\310\224\205\312\n\r/\024U\"\225\250D\206+\035!Sd[T\227"
+	.ascii	"Z$\223\006\206\020 \325\241\021\205\f\310\r\252\260\250\022\327"
+	.ascii	"\025\0264,\261*\013\024\303\365h\241h\303\225\216\222\212+kl"
+	.ascii	"\327\242\021\005$\n\025)E\022\327\024)\003\212\025+~X\365\270"
+	.ascii	"\244\262\030\246\252\n#+#\251\bIt\245\243!\321hBK\fB\2561J\300"
+	.ascii	"H)\020\344\341JGB\026\202\244\365EZ\02414\2420$\032M\030\026"
+	.ascii	"K\250KF\023X#\t\310c\t\036Z\243\022\362\230\026W\030Y\031I\031"
+	.ascii	"\222\212k\261\310\244\202]I@\256\027\\\351\b\231T\\\331\026)"
+	.ascii	"B\0352\021\205\305U\004\213d\022\261\001\206\221Uj\215\305\037"
+	.ascii	"R\252\022s\213,\032\205'\022\t\311D\036Uu\001\022\300\320\246"
+	.ascii	"F\"\322ide\224\240\266)\233\244\266E\024LK+Q{\264P\002\271\016"
+	.ascii	"!\217'\3246U\201l!"
+	.string	"\244\204\\\213+\tB2\220\326\326\230\302\260X\342E\212,j\203\352\322\332\002\251K+\013\027\310\224E\253&\021\265\352\212VE\"!=@UY\244a\252\232P4\256EVmS&\b0-\255\024\\\351H\204qm\201^\270\322\021klS\341:,\256H\021\306U\t\231\022I\030\252'$\025\327\"\233\302\030\032\"W\242+\035\211PY\2466U\221~mQE\252l\212a\021\271zP\203D\033.\020\323b\322\272\"\251\270\276XU\241\252\002\211\"\006[\304\032I@\256\020\024\231\212\332 \022\005\344J$\256Kh\222\006\225\330\"e\021c]\322I\305\025\251\002\253\306XQ@\256\030\220\306\027\254\272\002\251\266+\013\003\350JG\352\322\332\"\215\254p]B\257t\224\266H\027\200\\9\240\020\nS\243\237\332\252\304\343\222\321D\321hde\224\200\\\205\254\b!\022\003\"\200\202\205\211\022A\006\234x"
+	.ascii	"\nA\023*\202+P\\\270\322\321\t,P\254\020\341Bh$\232PY\243\211"
+	.ascii	"\241T\002EjP\025\262L\306\025-\323\261\270Z\200\241\246\220\266"
+	.string	"\351\211\t\250@\256@2\216F\023\023\264W:J:\212H:\n\213L$"
+	.ascii	"\025\221\360\211\f&\035\203\332`1\351x\026\223\216\246"
+	.string	"\272\302\212\314H\244\312\016\207\351O\306\321(\314l{4oA\006\333\"\327$U\205\005C\3657T\221L\031\371{\332\246\303`\322\361H\210x\\RY\264*RU\221t\374@\002r5\3020\342\250\b\3038l\213LF\023\303\365\230\241\205\300\004\007\013\035\034\025\037\260\200!\f$\216\206H\024\352\320\270\304\256i\006`\f\025D\024 ]\b\327v\205\312\246CW:Z\211B\021\2520Eb\325\266\270\252C#\n+Q\370k+h1\264\030\220j\013\246\025\3055\335\260a\351\327\006\221\254Jdb\200\006=4,\246KKF\023B\0268$\032MHJQ\260\260\304\264\342\004\212\024\3105F\372#\203\270\262)k<.\251,,\030\272\020\252J&Z\"V%fh5\024\245-Q=\361\"]1,\226\220A<\036\323\013\206\212k\212\202\013d\332B`$$\246\302\n4H\341B\270\022\207\305Ti"
+	.string	"H\025X5)ieYl@\2520T\333\224\310\264\304$\024\226\220"
+	.string	"\251\302\t\026-Z4\"SU\305\260D\213L\211Fm\t]B\006\333Z@-\024]\351h\230\032OP\223RV}\221\032\265i\213\3749=8\212\241b\230*\375\324\241\021\005Vm\221J\260\352\213\007\034W\"\022\004m\021\006\016\216Z6=\036!\231\332\264]\301!E[TY\226Ixa\270\246\270pn\340\340H]ZY \231\214\353\013\225=r\270\322Q\022S\013u(bH\\\231ZpP\207F\024\200*\260\306\326\210\202\013d\312\242\005\023\022CR\021\271ZX2\262)\030\300"
+	.string	"c\253\276HW"
+	.string	"@-\032O\264EuIe\231\220\251\212B\006\035J$\025\205\031\206\3226=!d\321\240\272\264\266E&V\204\020\th\250.\261%\204\302\022\022\\\310\266X\211\251\211\"\n\265M\207G&\n.\\Y\265\250&\351{"
+	.string	"\302"
+	.string	"@\b!\306\357!\210\300\201\b\034\240\017A\204\021#D"
+	.string	"a\204>\b#\314\266m\207F\024.\250A\265M\333\025+qm\221\266+\206\353qC{\245##+#\t\311\304\211\022FVF\222F\242\352\322\332\036\215\306\023Z5\211M[!#+#)\257\210\240U\203C\024.\220)\013$\341\217\032<\252j\213 5\210LJ\211$\250\304\026)r=\221A\r\016Q\3040\266\370\265A\244\n\352\322\332\352+\035Yp!%J*\032O\210\261\222`L\001yL\272@\324bP\203$\fY\243\321\004\362X\202\2066]b\215HA\265M\213\353\2205\032\205\301\rj\260]\213*"
+	.ascii	"\265k\221\351\247h\\\221\253Pe\217Ad\212\364\"(\303\005\222E"
+	.ascii	"\3120,2\031W,\261)\261D\333\032\225 P\211*\013d\211\b\f\327c"
+	.ascii	"\0065)m\211\306\027A\"Q\025\006[\326xT\331\"dP\206\013\244\f"
+	.ascii	"\"\222\320\nJ\3016]\221\306\343\nJA\031l\253.\031\207\306\240"
+	.ascii	"\213\342J|\221.\025\265W::\006\3256eE\b1p\221\252l\213`zl\205"
+	.ascii	"\3246UQ\024\302pE\201Uj\177!\030\2171\030\300*\265\372\007\251"
+	.ascii	"\266\251\n!\3733\036c0@\310\242H\265M\331\363\004\212\024\254"
+	.ascii	"\022\213\242\214!\360JF&\"\b\026\215k+TY\326(\fJ`\241\275\322"
+	.ascii	"Q\313tl\231\214\301%\030G\021HV}\261\262C\017H\364\205z\002I"
+	.ascii	"dJ\301\252mQ5A\244\266\251\212%\030)\202^\250Cs\003*\213\024"
+	.ascii	"D\"\323#\f#1\210\301\370\202U\221\301\241\272\304"
+	.string	"\246E\246\340\312\266\027Z6mW$\025\327!\233\302`\215$Lp\245\243\b,\2501\326% \2225\266\306\245 \214TF\021\322\204\220\305\240a\2442\202.\250I-2E\n\016\211F\245`KL3\fU$\253\276P\331 \214TF\206+\0351-\255\"\214\206\353\021\b\211T\205F\366\030\034\256\307\013E\343\332\026\325\027*{\214\300\203\332\246\3520\210\204dT]\244mPF\n#-2\261\027\\\351\250\002c\013\027\302\224\330\202\350\370S\205\353\013u\210\n\205ip\310\032\205*\373\243\016\215Ky\311XT\207A\242Qk\020\n\323\0375(TLZ\211)PeS\030C6e\221HA\2410\rj\333 \222:\344p\245\243\t`\2442L\244\004LA\244p]J\2132Nh0\262j\005\204\302\364\327\262j\253.\03110\301HY\023I\035\006\333\rW:*\032\327T\004\2225\"\213*\022"
+	.ascii	"J\302v=\236\310 rieY(\t\3335\305\260X\202H4\262ED\242\221\315"
+	.ascii	"H\225\211\230\276@\221\301\264MO\024\215k\313D4\256@\036\223"
+	.ascii	".\264W:B\036\223D\030\327\f-15\221A\241\361\004\3441\311B\233"
+	.ascii	"\022\315_\321H4\225\210DS\0352\265kKL\203+R\224\0204T\325\343"
+	.ascii	"\n \025\3112\031M\f\213LF6)\350h\034*\3456]\261\304TDO\220 \202"
+	.ascii	"a$\n)%\255JCC\022\304\224m\231\324\"\260\r\016I\f\213i\213a\252"
+	.ascii	"\016"
+	.string	"\213\206$\206*r\350JGH\242\221m\213FaP\310vH\205\226\3304\330\"\331\025)X4\006\211\2510hde$iXbS\344:\f\032[\246\364\302\225\216\204Kj\213\224\201\024\212\241\016\213(\206T\250/\326V\230^Hbj\241\016\177\220\302\265E\256m\332\"\203.\220i;\244$lW\030+\220\306\024 \250m\312jp!4\022\205LG\241\005uie\241\nS\266\204\244\342\272\304\226(>\200Ua\030\217\020\260*\221i\250*\t\221Bl\252$\314\254\272\"\255mQ\035\242\030\262\251\261\305\0202\250\022W$#\233b\270\036\203\332+\035\r\327\243\210V)i%\"\031\235\270\310`\b\303\365\210\246\270(\356p=\2320R\031?+(\005\221\216\304\240\025\224\204\220\220\214-\2230\250$l\215E\f\352QF\033d\325\226\270\"\005/\264EU\310\252)\332\342jLqd\032\026W\tl"
+	.ascii	"\202\221R\200i\305p=\n!\213\352q\311hb\270\246h\323\026/\212"
+	.ascii	"\212+\nm\211\341z$\"\252/T\342P+T\221\220\212\324\241q)\330\262"
+	.ascii	"\3521\206\032l\211k\033,\032WXY\243\222\021\261m\215\254\022"
+	.ascii	"\013\b\212kZ\002klSV\315`\\\333TE\214\224\250\252\300\320*%\255"
+	.ascii	"\252\004V,\261j;,R\001#\225q\201\250\n\205%\3246e\205\206IDm"
+	.ascii	"\260-\256\306c\253\"\215\324\245\265\375\221\221\022\325!\220"
+	.ascii	"JL*\246\031\3246e\203EjP\205\0222eM\f\327#\006\031\254\372\302"
+	.ascii	"(TY!\030\251\214`\273.\255\304\240\0222e\205C\355\272\264\236"
+	.ascii	"\260\304\252\355\372s\245\243\030\254\210\030l\321\215G\225\025"
+	.ascii	"\321\032\215\254\b d0iE*\032M\304`\177\216\351\222\220=Yu\270"
+	.ascii	"\2760\262\307\241\032\203%\246+\253\"/\304P\211G\246\023H\304"
+	.ascii	"T\351\207h\024\032[#{\034j\203\035\220\030\256\300\266\310d\024"
+	.ascii	"\006\221\330\340zD\006c\260\033\324\341\312\262\352\013c\260"
+	.ascii	"\270zh\203\277\244\224\205q\r&1\021\217F\027Z\025\251\262\306"
+	.ascii	"\226)\r\016\213k\213`\233\"\203KLl\353B=\"%\bR\211\251\020\371"
+	.ascii	"\323\262\352"
+	.ascii	"\213\342\032\\\221H\026H\310\016\327\245\263\270.i\027BUI\030"
+	.string	"#]\322CH\023\304\364E\321\270\266)\321xd\325\266\210B\310n@\252*\233\244\236P\211I\305\022K\251\211\027G$\fC\242Q\t\251\262J,\3246}\261\266\302\022\352\320\210\002\273\246F\305\225I\013U$S0F\272\024\214\301\002\265\301\020\332\342\312\364#\252\305b\252$\f\306`J\2031\322\245\2416\b\302\210\266\270\376^\200\002\230\360\240B\n%h\341\221\312\032\205A!\222\b!\222\210\342\232.\211\020\262H\021G\033\210F\343\002\202\347\377\037 zH\316R\344\312\335\317\025\r\2414iml??\242\256\274 9\363\343\003\330\344\203\210\\\217\036Z\217r\314\035\231\037\036:\357\207OW\334\362g\007\212\227\246\r^\227\037+-\307L\025<0?U?TW}saAI\240\320\350\351\230\3022\027\267\034\322\222\303\345\345'\307\217\324\f,b^\362\2256ygp\376\251\361S\343\347\206\336"
+	.string	"\274t\214\205\375\330\370\317\215!\273%d\340p\376\2112\347\372<\301c"
+	.ascii	"\247\237\246\237\246\237\031D>\230Ui\355\375\314\370\201\312"
+	.ascii	"\343\366\346\007\352\347\211\013\b\0371t\013Z\226\207\317\324"
+	.ascii	"\217S>\202gG\2269\234/\302R\353\321\003\354+\302\001\030\032"
+	.ascii	"X\225>`\037<diN\372\360\261\300\030\2159{\3205P\260\300\325\330"
+	.ascii	"\223\3232X\016\034Zp\276\br"
+	.string	"\364\235;@>\rtH\341Z.\371\226\277%\3121vK<f]Z\236\225\275\337\214<\026$\316\232\275\223\007\2314%y8_\0044:\311\246g\212\213^\035)qn\306\316+/\250>8\313\221\003\304\033\342\001\031\266\271/<:\232\314\211\020!t\356P0\2605tsN/FhR\212\314\3018\202\260\336\330y\203\363Eh\323?0\016\2125tG\007\336\235\035\020\316\324\035\030\264\244\032\036 a\346p\246\243\003\272\251\003\2009hZ>\334\264\021Cdw\265\251K\341f\306\222\rz\3663\243O\317\0206\271\007jeEN\022\234/B\232\376\201sh\3239\207\016\021<k~v\3143kT\300\344\200j\334\214\260\221\203\207d\321q#\016\230\306\307\032:|\222y}\324\304\240\001\236\2411V\305\b\316\300&>h5p\016\211\320\2504\304O\026\006\351tI\f\206R\216\344 s\n\331\324\264"
+	.string	"\323\025"
+	.ascii	"0P8\032\021\t\006nj\024\200\016Z\336\230n>\240\353Y\224\"\246"
+	.ascii	"F\006D\004$\004\004@P\004\017\026\"\036B\031\220\251W\247\002"
+	.ascii	"\232\337\302\2740(o\327\016E\233*\340uL\205\245\322\250WN\253"
+	.ascii	"\372=\340\262\271Ic\252c\300a\365\013\026\337+\347\320\275\372"
+	.ascii	"\001\020\304\313\335hL\251\342a\001\252P\373\255\375\342\204"
+	.ascii	"'\n\241\232}\345\256\251\252\276\001K\226\017\375\225\370!\204"
+	.ascii	"\376^\026t\nR\376U\365\343T\n\305\271\027\331\302\227\305\355"
+	.ascii	"\341gDo.\262&0\240\305oi"
+	.string	"\234\255,\002\256\312\002\013\317|[\212\212\373\251\225\203D\230t!\004\323j\354\006\357\025q\312K\\\030\344\004\264\261\fQ\254t\343\024Y\355mS\0317\271\301>\307\351\372\265\3655b`i\016@\321\034\375\201r@\222~\305\274\"\353{\204\311\222LAu\326L\302P}\254\263\324\226zC#\240Lx.\324P\b\332\347\330\316\027\301h\213;\340\252\017\261\226\256\215(J\325\322\311\377\201O\366\337\257\034v\214@\024\334e\304-\2138\025\240Gw\332\351\350\3746\213_\253\320\230:\354\346\231)\022\f\260\371\300\3458\034\026-\020\330\n\327\324\365P\024ig\351\376b\355\257D\335\367\223_of\361\373\234\237\233\242\032\3338\306\340\200L>SL\237X&y\243\221\371\351=\367\263\262\035\316\375x\350\264\n!P?u-t\212l_\365\022\373'b\2209\2115\364\224\336\"\335\221m\n\344\341\227M\340"
+	.string	"\211\202\334:0\231\244\327\352(\026F;\206\337\032R\343kx\224\216L\314\223\371A\213\236@\306\333L\222\032\264!\034\266\367\227\020D\355\245t\371A\256N&\362Yc\355\334#\350\002\037\333Ih\023\326\335\034\274\250\230`{J\252\022\247\317\334&\261\244\234\210(1$\364[\307\204\362\2232\225\tMqD4\200\226a\3252\rF~\210\026\240\026\205\211R\205~\365\371\211w\022\305Z\357\r28S\260\301G\230np\373,C\035\335\361\363\037N\260\316\345<\273I*\251\001R\021\327\375R n\341U\004"
+	.string	"\341G-\033@\311o\25163I\347\313s\177\270\246\220"
+	.ascii	"\b\374\303\335\350O\004"
+	.string	"\343@\302\n\317\227i\253W\362G\337D\354\037v\001\312\013\242x\030hK]\b\217\252F\016\200\370;B\303'\001\327z\2636\331\020as5\270 \3639\262g\ty\177X\342[R8\357$H\233(\306\200\005Ig\264\321\037\265\351\366\242\221\253;X\177\240%[d\377k\f\300V{\243\252\233T\250\243d\363\330_\327y\363w\202\2039P\222\313\275lt\t\364\211\"\331\177\301\334\324\031l\270\373\323~~^\232yo\026IJ7\305\270X\016\374\274\217Lp\320\277\354\336)\202\303\217\007\n\222\225\370\036\n\327\215\t\236\032\001\315\026\356L\222\253O\354\313?\275\233>\200n\t\236\b\223n\335J\006|e_\377\267\320\271\267\002\036\352-\226H\370kb\017I\231\276\315\263\344B\314\276\375\023\200|Q\3402\360j\363\236\362\230\272\004]\207\3170e\312U\263\022\234z\346bP>3Q$\361\322#,"
+	.ascii	"\221\013\217Ru\331\310$X\357z<${D0\315\"\354-U4\314\347\272\317"
+	.ascii	"*h-'\300\032\334\341\315\300t\002\024\371\201; \336\3122pL\321"
+	.ascii	"\264q\250U\256\312\r\327\024\372\223\"#\002(C\212P\355\337\303"
+	.ascii	"\260\3428\367\017\355\216\023ZI,\021\376,\251\244\335qX8C\006"
+	.ascii	"\344\236\270\214T\004\314\231\212\237\343j\246\273\333\270},"
+	.ascii	"M\274\330\020\306\310\024\257\310\b\177Z\276\007]\217M\227\354"
+	.ascii	"\372|\336\356S\346\245\202S\034\221\022\240B\210 \335\243\255"
+	.ascii	"\277\352\020\245\233j\320A\371\276U\334c\377\016w8\023\270\033"
+	.ascii	"+\373\261V;l&X\222\346\013\312\356\307\213\003V\347\\G\217\200"
+	.ascii	"D\020\236aV=\211\257\272zKx\373P\022\277\216\235%\f\300\327$"
+	.ascii	"\221\323\232\034\020\362\276\231\231\256\327N\210i\326\322\207"
+	.ascii	"1\2242\261Ra\322\260C\240!\343\203\034fi\235/\2209;M\022\337"
+	.ascii	"\334g\266%\215\313\260\223\032l\230/V\362F\246\t\213\r]\243\272"
+	.ascii	"\204\230b\270$\241\021\206_Z\004%\351\250\027\206N\036\260\222"
+	.ascii	"}\346\230\220A\342\001\222\321r\316\236\216\247\262\365\223U"
+	.ascii	"\"\350\r\003h\306&5\205<\235A\203\342\376\355\245\246A\2064\347"
+	.ascii	"ee\002jW\254!\302\330\233YRT\310\002\241U\265\331\225\235\264"
+	.ascii	"\330C[\233y\r\367^\317\236\212\341\230\022\367)\276\244\246\327"
+	.ascii	"\360\2208v\337\346\031h\007\320n\241\301\220\217\260<\360\347"
+	.ascii	"\035\201(F\211w\344\0255!c\366\306\344\235\213\303$\316 \020"
+	.ascii	"\230\t\325#AB\320\343\272\322v\324\271\363\002\r)H \314(\304"
+	.ascii	"\2370\223\271L\201~\201\032~x\262\023\\\2133\246\353\271.4\016"
+	.ascii	"L\230\3676M\265\035\311\341\204\345\2077H\330\260\265\354\310"
+	.ascii	"\222\030\271\0310v\300"
+	.string	"[\027I\032\246\245\335\2477Y\235\322\030\357C\311\217\003\210\f\025\373X!\300\365(\237H\240F\261\350\212\r\327\246!?U\264f\326D\007z\177\221,\356\022\234c\257\234\224\304[\330=-\273\204\231\nsCe\267\274\373\370X@\260\372=yWg"
+	.string	"\231,n\227\356\354\013T\220\243)=\300\fx\303\375\177\300,\342\235\235z\301\n\300\024\233h\251\037+8\340\003\314\276Hy\37355O'%\034\314\222_\223"
+	.string	"^Fg\201\206\221>\337\nH\034\273\325\024j\261\356\304"
+	.string	"\032\242\025G{=\304\335&\366\005\004\271%\007\210Yey6\217E\246Z\331\274\256B\215\340\210\370\364\342\003\261D\374\370G4*\374\263$\204\243\243EgJU\200\356]\255\n/i\276\307\273\2721\352vG\333\343\250k\334\377VB \3039zN=\207P\231q\372&@\264\263\355\303\036\250\324;\033\257s7 \220B\264\276=\1778B-\260LfF\217\303CA\221&[1\236\025\275\260\221\345jr\340\350\005\221\326\305\025\364c \377N\031\245\377=\2240G\"5\223\301nN\004J\343\032\227\334G[\230\355\232Y\032N7\341\376f\301\303\032AW7\017R\257SN\275\321\252\371\"N\345\304\004\b\224\216\376\263\200\312\210c"
+	.ascii	"\225E@]s\303\371\206\356vgSW\324\217\342\253\005\223\3006\310"
+	.ascii	"\337\235\371\367\f\025\\\026+\b\023\217\264G\307\271\200Y:|<"
+	.ascii	"_\021H,IP91eD\036\024\263F \0362\036\201\002R`%,+\215L\243Q "
+	.ascii	"\350\253|\260\314\357\306_\340\355\375\307Z\301\300\035\036\217"
+	.ascii	"\336%\245!n\246N\022i\n\035$Op\344\250\003&\332\356\245f!\243"
+	.ascii	"\342\023 P9\217\272\261\202J\350vjCya\311ej\241\325H\244\347"
+	.ascii	"r\352\325=\t\220I\016E\225\336O\036>l\267\006\346Iv\031\347\276"
+	.ascii	"\337\n\306\013\177\001\373\231\020\214\201\347\264\3049(j\260"
+	.ascii	"\256{\333\357+\355\224\242\013\3711\035=\345\244\310\237\221"
+	.ascii	"R\253\262T\235\0134\003\026i\373\373\375\316l\001\031\242Jy\325"
+	.ascii	"\3030 yPF\324\253\261\331@=SCh\007$\375\231\223\004\231\247,"
+	.ascii	"\006\217\232\255\252_e\baB\353\377s\211|4.K\230+@?\330\360#\250"
+	.ascii	"t-)\264\330\203x\035\355 \260 Z\300\030\0047\272\2109\022\235"
+	.ascii	"\355FvW\3255-S\265\327\254\003A\202_\343\207\\\254\2024\245\022"
+	.ascii	"pUp\217\027@.#\n\343\312\206\0059N\267@:t\212,\221\323\241&/"
+	.ascii	"_\305Q\351p\257\251kh\027\016fi\025\fU^;8\244\032\324\260(>\233"
+	.ascii	"yj\356\026\314b\206p)\344\351\323)\016\261\353l\363\324\031_"
+	.ascii	"h<\214\034\345&$\361{\305h\243\275A\206[Z\322o\337L\023u\230"
+	.ascii	"\372\254P\204\376\356\264\341\260\021\220$\252\242V\352*\021"
+	.ascii	"\033\373\363\023\0205\234\352\270\212\300_\3451\003+%^Ep\300"
+	.ascii	"\324Z[\240\370\343k\360\235\222(\2555?\247\301\261\325U\307\t"
+	.ascii	"2*\177\333X\356\350v\314\367\017XFP\246\267\273\363\337\371\032"
+	.ascii	"\f'B\375o\225\177\365Q8\027\310\335\331W7.\022q\3160\016\243"
+	.ascii	"\241\254\"\022t\226\336\246\242H\315\022\364\214&^\371\212\375"
+	.ascii	"\330\352\221\222\025\233{"
+	.string	"k\"\001\246\241?\346:,<\241;-L5UiI\332\036\366\236d\331x\023\234\037\241Nc]\270\275\325\027\231\256\3205\177\335\2542\315\201\334\r=R\352T\352\277N\305r\345\246\2701l\226\237\262\240h\376\027>N\336[\354\333S,W\275\205\2032\230\362\230\365\223Jc\256\340Q\234g\321\3759\273\206\n\254A\363L\357z\nP\222!\020\tk\350\263Y\301\346b\331|\257\227\026 \363\177\t\355\373\337\256\227\273IAX\324nU9\327n\rW\336\021\3415\223\267\304\342'N\b\016G\306:\025\251H\275\372>[\345\006\020!W\362\"\352q\350\302Z\234Viq\337En=\232\375\272C\324\337\271\024\366\321\267-\337\355\301\310\222\2311k_\370e\032{X\032\265\266Y\205\325pdJ .\241'\003s\374\363F\031{ux\\\210h{$\021K\240\376\270\024\021&\026\275\336\002[d(9"
+	.string	"\f\324\2214\330Uo\312\204f\201\255!\211\320\330\204\r\245\220-\356\350\005\013\021k\210C\220>(\226db\213\t,H\334\021,\211\371\003\345Y\3423\346\003\330x\355\023\240\215y'\325\331\030\233\214\265-\216\025\bMV2\255\206\362R\375\275\020\220\2421\204\333\314\3214\t\003n\262}\024\325\212\005\237?\223\245[\tM\2019w\301/\221\314\nN\346\3765\377\020\026M\352&\"\263\324QB?7A\304\302\211"
+	.string	"\r\317PRk\372\210\313\013Bw|\311\006EN\357\202\345\b\334c\266\337_\245J"
+	.ascii	"v\250\224\022\217\323>\246ih\233G\247\375\303\372\351\216h\352"
+	.ascii	"\337\\PYO\321Z\352E\333\034\324\026\223\245\203\307"
+	.string	"e\323 i\245\232\350\bE6D\305\026\rW\316[C\310\301z(\206\030t7\t~\332\254q@\266]\346cH\013nW\347\037\246\250\257\271\035*\354I2\340\261\324\361\315\373iW\"\257\336\032\204YI\202\237fz^l\340`\206\260>\373[X\257\373z\305\340R\322\354KHHY\252#\214\231\222R\3746n\t\2359\347uw\233$/\211\203\222\322\313\315}\313^\312vF\315q\346\236\f8>\360\332'\255\313)KbSz\304\235\270\253\240\244\033\317x\260\"Mo\271\372\3375\023\207\342\264\376 \255\370\361r\316n\240sJ\352\261<zY\240U&\342\317&\002\255M-b\233\310\244\360\2400\325\204\303\263\022\210?\354\234\017\364\213R\3130\332\r\257v\372\302\305\354\020\224\235\334\022\337\304\346\231`\341K,\230\277\233\3245\202\265U\375\246\215\265>\025\b\217,-I\340\245\262\214\201eL\006"
+	.string	"\317\375\351\217.\034X7Ug\233W"
+	.string	"ZWg\337\346-\262\317\246h\347\220K\235F\356E\320K\361\002\3265\347-\013-\251~\017T\232\247\242)\240\215\022\364\347\017\333m\016@\276\316Q\314\214\323=\305\201\305\371\330`\326\376\376\327\254\240\271\026\210\206\251\340n\376o{\347J\242\032=T\004\226N9\353k,\3116\3670\370\363\376W\030\331\344[\366\n\336\363\322v-\211\257\200}\357\030\f\025#\331\230\017\242\276Pz(\2769R\361Wx\223\223\274b\236\337:\316\237\2418/\020O\203"
+	.string	"\346\005\306a\257\311\031\300\207\034\332?\315\257\313\tfN$\tF\226\333 4\r\251bU7\311\277\2400E\376&|+\343\300\353\262,\216L\261\024\326\373Y+\273\313\031\210\375U\326\034\340P-l\257\237\315\\\236u\347q\303\275\317\261\022\3767^c\325\337\216\366\204\247\334\367\211"
+	.ascii	"]N\275\262\002\024\265\330G\314\035\313\314%\323\016o\256l\361"
+	.ascii	"\013\031\t\344\221Q\363\204\303\"N\250\356:t\022\016]M\200\355"
+	.ascii	"\254@\334\016\367\2124\365\307\025\205\235Q\240\211Bq_\b\232"
+	.ascii	"J%\266k2`\027l\360\227\270\356\247\3032\363A!\013:h\326:m\334"
+	.ascii	"2/y|\n\306`1{\005\020\202A\254\254\235\252\336H\225\357\325Z"
+	.ascii	"\321\006\214l\221\267\331\345\353J\231\355\202\252@\224\270\365"
+	.ascii	"\276\na\033TY\367@\357Bt\335]I{\214"
+	.string	"5c}[\322\340\341\306l\223)\375N\221V\202k5{\211M\031\257\237\304\220\200\266=\341r\"\304\204\212\347\347\203=\230\305\251\363\263\306\305\027\026J\025\\\206d\345\265\031\254\320(\221\361\0250#\025b$(%\nI*I\026\342I\350\016x\321\215\256k\031\354\270\252l\331\202\024\271D\033\316\350\230\006\331\251\300\224\035dA\306A\321\214\324F:7\221z\320\214"
+	.string	",\303\006\036z\326/\370\276\264\261]\266G`\235)\325\221\262Kd\231eNE\307\3471\264\321\201\201\312\207f!\326\205\370\367\001LN\305\036\366K\346F}\236\362o\271\276 \244g\274z\256R\305RTJ\213\016n<\311\251\357dr|\240\031\035\325\363\316\326!.R\2075\322.\331A9L\373}>T\326x#\361\367\244\007NC\fb\007\007N\002Ij3xO\031\345\031\220i"
+	.string	"\226\0132T\301\330\002\006Fnbd\317\200}o\312\002\320\261\226\375\344s\231\252\355\n$|\212&\023aM\2351 v\331\350.}\016\300\200\022q.MP\372c@\345\346\373\255\234\006\274k\201Q\345\236O\302R\261\316"
+	.string	"\313\240oiHO\2167\363\300>w[\355i\267U\231\007L\343!\330\003\202o\260@\214\377\204\\\331\315\260\"\bl\267\362\026\t\341\322#\312\252\332\n\002\244\252\223\225\356\372\255\365\326\250N\231\315=\276h\007\336\252*d|/\3144\220\177\311\322J\346\276\021\rG\316\333\250\205\323(\352\005\374\242\363v\360\365\003\314\007\271\360w\261\270\315!\r\206y_\016\322\256"
+	.string	"\334\031U\242\361J\345y\364\367\032\201\357\002\301\346?\344Yd>\343\002@\034\003\350\001\254\030<\275\r\300\021\347s4\253T\301\255\333cL}\373\024\335\313\361\316\342q\244\331Rt\177\227{ \300_\026A\351AY\025\354k`n\263\355\322\256?\020\240\350b\325\271\237'\034u8\371Fo\243;\301\t2\2643\251\017\217\205]h\252N\361h\001\f\013\003\355\"\034\214\260$\027f.\206\177=x{\242\334\ng\033\236\365\3168\301\207\300\371a\320[\350\262\372J\352/\371\221\366[*F\232\367\312\272\025J3\302\260\001"
+	.string	"\374\026\006\307h\2240\362\371\331\261|\207V\372f \033\030ty\345R\377f\322\r\037\022y\317\215\336K\242U\334\016\231\275,(\f\364\343\213K9\303\024\276k\213\365\347\306,\2442t`\244\207\007\225F\223s\007\017^\0172V\r\205\202N]\3042\371q\302B\350\273\004!\360??\201"
+	.ascii	"\216\013\357P!Z\210\",\205\304\200(,\f\233}\002\337\262/\306"
+	.ascii	"\364\243\344\215$"
+	.string	"\346\335\026\215pFI\3031\235\260lJ\353\305]\f\316\270\313#\332\347s\3712\272\314\301>m\261r\275\243=w\221\306\306{\235\021(\272\336\326\036[\357\301\301hV6\230@\313\"\\\031P\341\016ctb\013\314La\316\006\006\332\307KXayl\355\211\362\333l\352\357\331n;\256\3577gAKJ\356^5Y\024\t\217\204\271\357\257\311\202/\030\rW\215>\323\205(\365^\n&!93D\336Xag\213`\006\nu\031\324\2073\265q\363\n\021i%\326\250\377-0U\224\212\211\334 \330r\264\016\200}(1+m*\334(\300\244\005\321-\317[\244vI\216[\032\307\366\230{\353\322\320\374Q\265\246\247\036\257\227q\b\"7\252\031\376\004#P\3175\030#r\374\0043o\303@\230R\345\nQ\265\345t!\265\332*\351\327\006\213\245\365\345\351`\021F%\341\312\347\366CW\323\200\276\256\003"
+	.ascii	"~%?\331ic\363\226(\033\350\334U\314\344\224;y\270\276\336\306"
+	.ascii	"\220\266\276\241N\275\315 \207\304g\365\236\265\365\227]\377"
+	.ascii	"\327\301\034C\222\234\252\225Om?\352\276[\335\256X\312\354\367"
+	.ascii	"1\322`\237\347>\017\267\251M\027\372I?\361\237o\236]\202\207"
+	.ascii	"7\3040\007>\326\300\367\276`\363\305;\353W\306\345\034\312l\203"
+	.ascii	"\317\275\203?]\347\373t\016\272\2063\326\335p\341q\"}eLo\331"
+	.ascii	";\321h\373\346n\262s?\325\374\276\352'\205\215O\3777\2243\300"
+	.ascii	"\276\001\b\037\243\327<;|\314\270\030\347\255\355\257D\267jS"
+	.ascii	"^\346:\306\240\355!n\223\034r\226i\327Y\026\201r?K\304Y\226\225"
+	.ascii	"?\334\331\341t\353&\334\007=\371\312\250\275\024W\242\345\205"
+	.ascii	"\323\257\335\022xUGgG\274\325\377\0138\030_?\013\2270}\205%\377"
+	.ascii	"p\364\037\350\254\302\300?*\334\321bw/,\325\370\024\255\037\311"
+	.ascii	"\332\343a\016tn\310\235\335\267\217\275\245X\346\301\277\353"
+	.ascii	"\317\006\275\343\341\001>\350pb\204_5\270\314\220\267\275\373"
+	.ascii	"7vM\302bn\247\236\202\302\336v\267ayB\276Y\300\373\f\034\221"
+	.ascii	"t\327_\315\212\357\335\311dsw\177G\007\037\276\341\fD\361\177"
+	.ascii	"\334\370\331:z.\250\016q\375\027\013ubV\352\007\224\217\335\032"
+	.ascii	"D\340\245\177)y\336\021\037\221\302\307\022\027\257\227\313\221"
+	.ascii	"^\004\352\377\326Gk:\350\315W\263v\201\353\031\260\007h\374\335"
+	.ascii	"A\2502\245\373\333\331\365\371\252\347\367o\367An\250\262!\274"
+	.ascii	"\037\375\032\001X\261\243\213~rG\345\365\361\361-wy\364\330\376"
+	.ascii	"6\256}\240\372;\357\354\360\372\\\013/^#r<\346\307\260\350\032"
+	.ascii	"\327\347\232\275\317\374\237\347\364\231\315\327>\333\367\341"
+	.ascii	"\344\371tQK\r\367\303;.7&\264}\236\355w\313i\373\315\236l\244"
+	.ascii	"<H-\2224\262\203<\020\322\277\244\231/\353Lz`r\364\360\221\366"
+	.ascii	"i\335ggn\331\365\260\374\327\367D2O^Z\337\351\354\307m\253\251"
+	.ascii	"\363\027\267\013q\250\362\002\257\242\217\200\231E<\276\243\375"
+	.ascii	"\006\351M\013\267m\215\267\376\244\312g\270\236\016\227\210|"
+	.ascii	"f\236e\226\272\231\3378x\253\030\277\253}\322\213\273\020\236"
+	.ascii	"\321\317\353\323B\262G\364\032M\315\224\257\027\2663\301~\230"
+	.ascii	"m\217\225\007\2453\373\327\277\037=\352\017\314\277:\354\017"
+	.ascii	"jC\316)\305o\303|\361\036h\270\027\036~\n\2269\264\267M&LI\177"
+	.ascii	"\215\023\315\b\315\314u\023\261\217R\270g\370\273\017\376U\351"
+	.ascii	"b\360\332ytg\333eA\342\237Gi\017\202\367\277G\243\322\027\312"
+	.ascii	"\310\376\003"
+	.text
+	.section	.gnu.lto_.symtab.11548313aa7dbd85,"e",@progbits
+	.string	"AccInflightCalibrationArmed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\002"
+	.string	""
+	.string	"InflightcalibratingA"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\002"
+	.string	""
+	.string	"AccInflightCalibrationActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\002"
+	.string	""
+	.string	"AccInflightCalibrationMeasurementDone"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\002"
+	.string	""
+	.string	"AccInflightCalibrationSavetoEEProm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\002"
+	.string	""
+	.string	"applyAndSaveAccelerometerTrimsDelta"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\003"
+	.string	""
+	.string	"resetArmingDisabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\003"
+	.string	""
+	.string	"updateArmingStatus"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\002"
+	.string	""
+	.string	"disarm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\003"
+	.string	""
+	.string	"tryArm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\003"
+	.string	""
+	.string	"handleInflightCalibrationStickPosition"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\003"
+	.string	""
+	.string	"updateMagHold"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\003"
+	.string	""
+	.string	"magHold"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\003"
+	.string	""
+	.string	"throttleCorrectionConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\003"
+	.string	""
+	.string	"areSticksActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\003"
+	.string	""
+	.string	"runawayTakeoffTemporaryDisable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\003"
+	.string	""
+	.string	"calculateThrottlePercent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\003"
+	.string	""
+	.string	"processRx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\003"
+	.string	""
+	.string	"taskMainPidLoop"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\003"
+	.string	""
+	.string	"isFlipOverAfterCrashMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\003"
+	.string	""
+	.string	"pgResetTemplate_throttleCorrectionConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\003"
+	.string	""
+	.string	"throttleCorrectionConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\003"
+	.string	""
+	.string	"throttleCorrectionConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\003"
+	.string	""
+	.string	"isRXDataNew"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\003"
+	.string	""
+	.string	"inputSource_e"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\003"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\003"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\003"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\002"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\002"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\002"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\002"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\002"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\002"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\002"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\003"
+	.string	""
+	.string	"averageSystemLoadPercent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\003"
+	.string	""
+	.string	"armingConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\003"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\003"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \003"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\002"
+	.string	""
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\003"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\002"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\003"
+	.string	""
+	.string	"axisPIDSum"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\003"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\003"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\003"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\003"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\003"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\003"
+	.string	""
+	.string	"servoConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\003"
+	.string	""
+	.string	"cliMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\003"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\003"
+	.string	""
+	.string	"telemetryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\003"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\003"
+	.string	""
+	.string	"isGyroCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\003"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\003"
+	.string	""
+	.string	"accIsCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\003"
+	.string	""
+	.string	"isBaroCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\003"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\003"
+	.string	""
+	.string	"writeMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\003"
+	.string	""
+	.string	"writeServos"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\003"
+	.string	""
+	.string	"isMixerUsingServos"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\003"
+	.string	""
+	.string	"mixTable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\003"
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\003"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\003"
+	.string	""
+	.string	"unsetArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\003"
+	.string	""
+	.string	"isUsingSticksForArming"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\003"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\003"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\003"
+	.string	""
+	.string	"calculateThrottleStatus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\004"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\004"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\004"
+	.string	""
+	.string	"isArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\004"
+	.string	""
+	.string	"warningLedFlash"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\004"
+	.string	""
+	.string	"warningLedDisable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\004"
+	.string	""
+	.string	"warningLedUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\004"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\004"
+	.string	""
+	.string	"imuQuaternionHeadfreeOffsetSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\004"
+	.string	""
+	.string	"getTaskDeltaTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\004"
+	.string	""
+	.string	"saveConfigAndNotify"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\004"
+	.string	""
+	.string	"blackboxFinish"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \004"
+	.string	""
+	.string	"gyroAbsRateDps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\004"
+	.string	""
+	.string	"isAirmodeActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\004"
+	.string	""
+	.string	"pidController"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\004"
+	.string	""
+	.string	"imuIntegrateGyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\004"
+	.string	""
+	.string	"beeperWarningBeeps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\004"
+	.string	""
+	.string	"isFirstArmingGyroCalibrationRunning"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\004"
+	.string	""
+	.string	"gyroStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\004"
+	.string	""
+	.string	"blackboxSnapshot"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\004"
+	.string	""
+	.string	"updateGpsStateForHomeAndHoldMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\004"
+	.string	""
+	.string	"processRcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\004"
+	.string	""
+	.string	"calculateThrottleAngleCorrection"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\004"
+	.string	""
+	.string	"resetYawAxis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\004"
+	.string	""
+	.string	"applyAltHold"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\004"
+	.string	""
+	.string	"updateRcCommands"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\004"
+	.string	""
+	.string	"gyroReadTemperature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\004"
+	.string	""
+	.string	"updateRSSI"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\004"
+	.string	""
+	.string	"failsafeIsMonitoring"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\004"
+	.string	""
+	.string	"failsafeStartMonitoring"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\004"
+	.string	""
+	.string	"failsafeUpdateState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\004"
+	.string	""
+	.string	"pidResetITerm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\004"
+	.string	""
+	.string	"pidStabilisationState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\004"
+	.string	""
+	.string	"beeperSilence"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\004"
+	.string	""
+	.string	"processRcStickPositions"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\004"
+	.string	""
+	.string	"updateActivatedModes"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\004"
+	.string	""
+	.string	"updateAdjustmentStates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\004"
+	.string	""
+	.string	"processRcAdjustments"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\004"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\004"
+	.string	""
+	.string	"enableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\004"
+	.string	""
+	.string	"disableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\004"
+	.string	""
+	.string	"rescheduleTask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\004"
+	.string	""
+	.string	"updateGpsWaypointsAndMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\004"
+	.string	""
+	.string	"releaseSharedTelemetryPorts"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\004"
+	.string	""
+	.string	"telemetryCheckState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\004"
+	.string	""
+	.string	"mspSerialAllocatePorts"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\004"
+	.string	""
+	.string	"calculateRxChannelsAndUpdateFailsafe"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\004"
+	.string	""
+	.string	"gyroUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.11548313aa7dbd85,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
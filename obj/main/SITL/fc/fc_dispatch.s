@@ -0,0 +1,346 @@
+	.file	"fc_dispatch.c"
+	.section	.gnu.lto_.profile.4ad71a8bd2a43e8b,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.text
+	.section	.gnu.lto_.icf.4ad71a8bd2a43e8b,"e",@progbits
+	.string	"(\265/\375 k\215\002"
+	.string	"\304\003_"
+	.string	"\007"
+	.string	"\350\300\306\254\005\002\002"
+	.string	"\002"
+	.string	"\001\352\263\360\321\b\002\236\376\250\313\b\003\373\353\216\267\005\n\002\001\002\002\002\003\002\002\002\004\002\004\002\005\004\005\306\345\3114\006\240\342\234\212\n"
+	.string	"\007"
+	.ascii	"K\031\374\f`\250\321\247.\2732\027\232\027o\240\r"
+	.text
+	.section	.gnu.lto_.ipa_sra.4ad71a8bd2a43e8b,"e",@progbits
+	.string	"(\265/\375 *\365"
+	.string	""
+	.string	"\240\036"
+	.string	"\004"
+	.string	""
+	.string	"\003\002"
+	.string	"\001\003\001\001"
+	.string	"\001\005\002\001"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	">I\327\fg\003X"
+	.text
+	.section	.gnu.lto_.inline.4ad71a8bd2a43e8b,"e",@progbits
+	.string	"(\265/\375 \264m\003"
+	.string	"\242\205\024!\240'\351\243\017\276K\303#\377\241\016\221\b\374w\242\354X\032\202"
+	.string	""
+	.string	"\034G\034\3126H#D\356\024\377+-$\006\307\332\250\2108\256.\034ki\344\300\001\037\323!\240_m\274\347"
+	.string	"\f\214\342\301H,\233\376\367*\364\202\266\217\312df\236?#\002\n"
+	.ascii	"\220`b\032\203%^\265\016\300\023X\322QD\262\310\353\022\352\006"
+	.ascii	"\332"
+	.text
+	.section	.gnu.lto_.jmpfuncs.4ad71a8bd2a43e8b,"e",@progbits
+	.string	"(\265/\375 7\245\001"
+	.string	"\324\002+"
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\003\001\001\003\177\002\007\002"
+	.string	""
+	.string	"\001\300\004\001"
+	.string	"\300\004\002\177"
+	.string	""
+	.string	"\177 \005\002\001\001\017\177\002\002\177\002\006"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.4ad71a8bd2a43e8b,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\204\004\002\230\004\003\271\004\005\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.4ad71a8bd2a43e8b,"e",@progbits
+	.string	"(\265/\375 \243\245\002"
+	.string	"\202\304\013\022\340\031\326 \270\324"
+	.string	"0$\376\226r\313\275\267L)\005\235\216\205\2621\235\314\306\033\371\252\300e\276}\022\316r\216Ed\301A\321\0166@\206\016"
+	.ascii	"@\013XBi.\247_5\250j\221\231\217\273\005\244\354\340\271\346"
+	.ascii	"\233\2100\217\355\314\001\3336\320\006"
+	.text
+	.section	.gnu.lto_.lto.4ad71a8bd2a43e8b,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_dispatchIsEnabled.22.4ad71a8bd2a43e8b,"e",@progbits
+	.string	"(\265/\375 \343]\006"
+	.string	"\322K,2`m\322\030@\003\0077J\2638V8\203s\202\234\323\276S8!\323\232\265\036\334\246P\376\177\326\333\002"
+	.string	"X8\213\336\327S\317\233\202\300\217\244I)S\273\352\301q.\232M\246\201\301a\232\303\264\210\314\005\242\271k\323*\202-\215\303\3258\226u5*[TQj\001H'\036?\020\344\215\034Kt\0221\224\306\016"
+	.string	"J\251S\006(G\237}R5\036-\253\242?O\235F\004Lv/F+\213\"\225t\374\236\247NP\360\374\006(4\205\244BDe7k\272\201\017\363\215\350\201\006!'X\350\203\031\260\260\273'\026\302\300\025\377\203\037\341\267\b\b"
+	.ascii	"2\003\316:#e\b\3055\321-\002#!\362\270\033\235v\222\001"
+	.text
+	.section	.gnu.lto_dispatchEnable.23.4ad71a8bd2a43e8b,"e",@progbits
+	.string	"(\265/\375 \346m\006"
+	.string	"\262\313,3PM\324\001\244\0340\350q\247`}5"
+	.string	""
+	.string	"\024}\235\263@\204]T$\206\265\375\3304\2340\017\013\2261\323\310\230\372`-\240\016\326>=!\177\357\224\002\256\017C\275 \312\222\024\022jDkD\035$\250\201\326\312\242\317\200'j\241\242\3274U\324\t\367\0234\240@)\341&\204\177\254\361;\356\201\371\031~\310\344\2753~\326\234\221#\242\005\207\t'G;\334\344\274\260_\331\t\332\023\241\003\t\030w'\306\224\025\031\021\r\333w\254\331$\002\021"
+	.string	"!\335\307\311\356\322\211q\355R\363\277\361\213\367m\227\226\203\335\265\364\276\212{\3366\201\355\002\333\022\001\b"
+	.ascii	"3\001\0078\003R|\241k8V\b\343e\210p9\026\355$\003"
+	.text
+	.section	.gnu.lto_dispatchProcess.24.4ad71a8bd2a43e8b,"e",@progbits
+	.string	"(\265/\375`\364\001\235\021"
+	.string	"\026\340sH\340\322&\035R\267\331I\317hZgr\367\344\351\351\3254\033\234\224\361\363\362>\035\200\244\237\022\364\261>d\332\346\236\303T\323\200>\254>\2668G\234gb4\246\220L!\276?\016\217+\317\341|\314\261\204\354-eJ\001\\"
+	.string	"Z"
+	.string	"c"
+	.ascii	"Np\272<y\tw\031/\200\273\364\313\3261\340\202\210\222M\321\217"
+	.ascii	"9\347\267\036,\365uN\306\325\227?t\325\320$\013g\316\221\204"
+	.ascii	"57aL\345\210\234\307\270@(\350\303mW\234\220&\256\355\b\206\027"
+	.ascii	"\326\350\276vu\321$\013s\256\035\2039\247U\026f\270\273\333\226"
+	.ascii	"\261\375\300V\223\253\363Sb\006\323\3332\345\260"
+	.string	"!\355\362\330\264\230>e\206\022\b\357\216\335\251\275U\237>\373;N\035\245z\243ZW}\221\221\027%6\346\304p\0232\227d\213\037\277v\242\230\237p\201\237\2409\247\3554;\306\366.\357\331\276\3327q\241\327g2\0060g\207\241\025s\322\024\0046x\0250#=%\273&@@f\272~\212'\265|\037\243X\3642\226\032\262\035\260\324\221,\234N\272\b\200P\350\354\304\210\236\300y{\333\217\263\241\306\203I\006\215\006\361i\275\355z\330\f\371v{\332\023=\222\bi$\3710\022\021\323\233m\325\217dHn\3149S|\243\n+\003=>\227~\213\273|nAiQH\271`>\227\225J\265\002MP\252\024\004\227\013\212\305\202\001=\203(-\240K\345\245\225\222\020\001\\\371\300\225\317%\245\242\372@V\353C!\340\325\013\212\365\271V+\326\347\321`\337\235\241;PZ\202m,\004\267<E\217\333"
+	.ascii	"\007\213\270\257\375@\217\246\033\0160\275=\3169\247\f\240q\275"
+	.ascii	"\353\023\232\235q* \200\002\231\262\363\306d0\f\254;z\007\017"
+	.ascii	"\n!B\246\224\017 \270HX\315JC\215\247/,*o\305\022w\262 +W\331"
+	.ascii	"\026\326\236s\246w\202\211+0\f\rM 1U\024\033\270\344\276V,\364"
+	.ascii	"X-_\250\370\362\023\357\355\020+E\2716\355\277pP\324M\333`zi"
+	.ascii	"+\336\350\b\224\f"
+	.text
+	.section	.gnu.lto_dispatchAdd.25.4ad71a8bd2a43e8b,"e",@progbits
+	.string	"(\265/\375`\355\002m\027"
+	.string	"\226\253\231H\300VQ:\024<\215\3137`\277\032\t\327\204\003\304"
+	.string	"\340;[\320\"R0\026\024cf(\"\022L\252\026\276XK\246\375\372+\310\223\325\317\277\352\272J\242C*\223Y\350m\272\007S~)\002!\331a\t\331D\356\224\002\200"
+	.string	"z"
+	.string	"\215"
+	.string	"\262w\037\266\0239\211cvY(%\355.\00378}\""
+	.string	"/\355\363\370\220\355\274\236\007\330\025\022\222\264\333c\340\005\247O\367^\023~\236\236\n?m\263\257\020\b\201b\002\002\302ewU\352\302\240\264=\234\240J\233/O\370r;\237\207\343\016''\250D\276%"
+	.string	"v? \204!\0350\356\273\324\355BH\320\006\211\353}O\220cJnG\342R\214\260\273\226\271\335\210[\274\355\016\266/\330\032\0237\371s\214\264c\034\344s\3277iY\302\251\217\335\303Ima\377&\212\223\030V![J\247hB\351\231\363~\231\033\335\250\023\375\243\030J\207\227\236\227\006_tk(-C\351\013h\3603\300\267\033\364\003\263K\363\b\215\027\375F~\220#\331\243w~d\005<\035\273;\356\330\343\347\017\344>\217\266\215x\300=\222\300\243\313\203\242Z\004\234\b\nJ_\260\354\366\026|\332\201\0357R\034\341"
+	.string	"2\252\241\204\247\346\305\356\336\034\bU\001o\007\357&\177\227b\205\bij\013\207LJJ\243\323\213\364\252\366`\210\313\356\3559QuC\016\352\207\037U@H/\366\221\310zN3\374\232\252o\212\016\005\270\273\013\372FX"
+	.string	"\250\344l\327\2232\020\351\260\241\206F5\007S\256\304M\3764\210\n!&j\224\332\257\027\3419\355\356\215O\244\265A\346\305\214\236\360\323\301\320\216\023R\257(}\323\317\n\234\374yT\251`\023P\230\326`\243\203\363\242\355\250`\261\234\234\030\253"
+	.ascii	"\316\213\006\253\320r\241d\327\251P[\341\270ZbmF\203\271\246"
+	.ascii	"Y6\032X\264\225L\347\325\262\300\302\240baP\301^\253\034\025"
+	.ascii	"k\246\243\2621\340\230\3145S\321b\261\231j\354\335\256B\366\024"
+	.ascii	"\325 (\252\252N\f*\002~\310\247\352&\354\226n\212\263\214\372"
+	.ascii	"H<\364H*\004ztI1\265I\206ibK.\313M\376d\204\026\302\224\336\367"
+	.ascii	"\007A\361\321\"\345\311\214\246TDi\2503z\244O\b7 P\002!\305\320"
+	.ascii	"<]\030\327\356 \3230\227\3652\331\"\024\326\"\n9\r\214w\300\027"
+	.ascii	"MXCx\330\b\373\216`\320)>V\367Xn\337\006\2201vc\022\274\376\004"
+	.ascii	"\342no9\032Q\225-R\031\272\022\331L\337\300\300\"\330\207P\244"
+	.ascii	"<\033\334\255\270;\n\016\375\002\356.\330\3335\3114\016})\354"
+	.ascii	".\265\316\220\307\177,\304\266\003-\2461r\214\256H\353\024\367"
+	.ascii	"\332p?\261\226_9\343C\271s\205'"
+	.text
+	.section	.gnu.lto_.symbol_nodes.4ad71a8bd2a43e8b,"e",@progbits
+	.string	"(\265/\375 \255\225\003"
+	.string	"\244\005\251"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\026\177\f\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\005\025\r\200\204\001"
+	.string	""
+	.string	"\003\002\027\177\016\002\030\177\017\252\333\3426\024\020\031\177\021\r\022\201"
+	.string	"\001\032\177\023\377\037"
+	.string	""
+	.string	"\200\200\200\004\003\330\244\235\311\003\001\225\006\003\005\007\252\333\3426\001$"
+	.string	"\b"
+	.ascii	"\177\204\"\3412\\B`\271\241\250\003n\333\n\211\"\264\322\003"
+	.text
+	.section	.gnu.lto_.refs.4ad71a8bd2a43e8b,"e",@progbits
+	.string	"(\265/\375 !\t\001"
+	.string	"\035"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\001"
+	.string	"\001\002\001\001\001"
+	.string	"\002\003\001\004\006"
+	.string	""
+	.string	"\004\t"
+	.string	"\001\005\002\004\006"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.4ad71a8bd2a43e8b,"e",@progbits
+	.string	"(\265/\375`R\t\2053"
+	.string	"\332[ \024G`\336U\007\211\004\347\303\031R\244jz\360C3\335\205W\257e\213 4I\261\277\227.\236~A%m1|\003\032\373\207\323f\366&<38\344,\271\200\r\277\241\n\373\261\323A\037\231\220\216\344q&\331\357/S\n\016\0013\001/\001\"r\267_\361\250c\3515=\377C"
+	.ascii	"\336\024\021\"\305l\257\271\264\273u*b\250y\245bnv&}\202\331"
+	.ascii	"\250\213y\330\373B<\310\253V\n\263\315!\367Rv*\016\365(\317\253"
+	.ascii	"\264?]J\353\222\357?\377_ \335\231Z\r(f[)\267\177\265\001\256"
+	.ascii	"\227\320\003r;/\007\344\274\\\347L\344\003r\254\007\310\005A"
+	.ascii	"\341\371\3109Cv\341'\335\356\345L\334ys\251\232\017\375\177w"
+	.ascii	";^[n@1\353N\354N\374mwz\223>\222\320=\311g\362\377\272\223\375"
+	.ascii	"?\272'\370qO\200\233\0029F\311\261\215s\277> \227=@\216\352\355"
+	.ascii	"<e\273n_\353\356,\335\335\345K\267\347\005\335\016 \250\333\313"
+	.ascii	"\252^\330n\027\353v\357\356kw\263u\267Zw\247uw\265\273\317t\267"
+	.ascii	"\231\356\326\322\335d\335=\326\335N\272\273Jw\203\350n\263\356"
+	.ascii	".\353njw\213\351\356'\335\375v\267\200\356\006\323\335\270\266"
+	.ascii	"\266\266\266n'\352vg\367\216/\356>\271\230\356\263\311\334}\362"
+	.ascii	"\333\177\036m\344d\223\351\206i2\203\334\347\221\351&\271\230"
+	.ascii	"\273\253j\216\252\024\022\263\037\336\306M~\225r\353\270\f\242"
+	.ascii	"\272o\363\321\376\035\032\365K\005\377[\315%\332\021\313\245"
+	.ascii	"Hj\025\022\354\330\364\367\377\013(\2217\232\237\244\272G\232"
+	.ascii	"\377G\220N\257\214\320\276\324\347\341\324\026\307\326SE\375"
+	.ascii	"\033\370\367_\371\337\372S\377\277\375\377\235\345\326\373\257"
+	.ascii	"\025\344\016Q*\377\263\204\224\277\325^\211\372\307P4R\246\373"
+	.ascii	"\274\3214\2722\3459\344]\274\255\017y4\256e~\266O\236\352\377"
+	.ascii	"]-\017a\306p3f\372\363X\210\274fd:\246\025\225K\031\325\247\214"
+	.ascii	"y\361\242\362\244\221\001\304J&\006K\255\207\016\314\216\t\341"
+	.ascii	"~X\331\034+\2673\361/>\305\301\234\n\265\300D\211G\351\342\322"
+	.ascii	"!\244\253\201mI\332\377\013\306\303\270\027\217\372\027\017k"
+	.ascii	"\337\342\\Z\350\375O\376\177C\3506\372\342V|z{\211\374\343\360"
+	.ascii	"\361\323\322q\321\304\372\3772` \304\340\346&M\0177\263\035\314"
+	.ascii	".4\325\362\303F\006\220\035\230\365,\336\346l:\205\331\016ej"
+	.ascii	"\271q5w\3735\352W\007c\223\3573sR\272\256\220X\177\331\245\301"
+	.ascii	"\016\b5\211\327\332\232\263\261\251\272ZoV\030[fr\332\331|\302"
+	.ascii	"\272\262\264a\326\341\2705\267\270.\221Z\343\374\244)\217QcT"
+	.ascii	"mb/z\312\316\270\3425&$\267\267q"
+	.string	"W\213\272\232\223\t\275\017\203\350D\332\240q\217\334\356d\2715k<-\277\b\300T]\273z\274\210M\271l\332\323\3301\31634\260\234\030\253+\033f\033k\245I\343U\257\206\371\324x\245fTqfG\202D1\333x*\267;\335\317D\375\214;\375}\253$\347\362m\320>'\267\223\3612\355g}\346ftY\177C\363Uu\265~V\026\217\r\013[\013\262\326n\246\373H\202;uD\214\334\240\002\313\215\273s\177\\\376?\f\334\373KdO\316q\356\274n\037\277\271\202\277\365\320\217\177\254\352\233lD\354H\003\263\335M\364\335\365\337\356\376\375\245\373\344j])f\314\335\3736\b\374\023\307\273/\027\223m>\376\367\375\223\\L\024\356\333\\\272o\263\r\372d\263\375\177\231A.\364\330\006\355TT|\n\032S\364\204C(\250\241o\347\b\302\t(\037\256\235\212zE\"PE\220\3703`d*\206"
+	.string	"B\005\215\2718$\372\202P\271v*\342"
+	.ascii	"b\303\207\236\021X\202\330d$2\341\033>-\001\211\303%(\240\261"
+	.ascii	"\310\342\003\320\357G\201\347\327\004tb\213E\240oH\364\360\343"
+	.ascii	"\373\001\237F4\t/\0247\354\332\027$\002\205\300"
+	.string	"\022\271# 9@JZ\261\323IJ\017\224\036\344:I\311\310H\t\311(7\222\321\315\330NC=<\001$\366\214\303!\261\307c\\\001\024\262>a\n\f=E&\026D\243\360\002P62\035A0\n\203)rO\230\260D\024\242C\206\354+r\362\031\233N\024\203?&\037\211\236\217DO\030l\202\352\371\210\305^\321\201\247\240Q\030\342\007d\321\364\004\374\365<\r\207\025\230p\335\215\251p\213\206C\311\024f1\022#\361\013]\373V<c\276hhY?K\006\257\033\267h\374B\n'\277\262\2760\213\243\260\013\217\366\024\273\017\344<\270\264<j\344\025;=\315\341\244\203\351\306h\2411s\303\312u\352\340\326\241 \360\302\262v\375g\3612\226\021%R\270\305_\335\322v\305l[\317\361*,\200\253\250\2214e\020DFdFDdf\222\024\016\200\002\221)3n\021@\251\262nj\322T\3668L"
+	.ascii	"e\006\371/\003]\352\307\322\340R\217\317\020[\001\027\202\017"
+	.ascii	"\330C\320\367L\235\343\346\344\224\342\240\240\323<\217\250q"
+	.ascii	"\200z\201bw\222\363\345\314\316\207\0337\203\207c6\276\272#;"
+	.ascii	"\211&UJ\363x\277\354?\301\350]\035)A,\300a\307!olaIG\022+\332"
+	.ascii	"\326\231\257!I\370\3022\321/\331\227\257\344\201+3I.\253\b\220"
+	.ascii	"#(\320JQ`\305\300\003\353\035g\265\206\264\2167\n\bT\263\374"
+	.ascii	"H\214[?\326\023\350\266\361\001\217\"\212\324\213.+\370|\316"
+	.ascii	"\220\244\252\202p\371 \177\251\211\274\335\304f\021\023\232%"
+	.ascii	"\273\337\330-D\231\244M\022\217r}\303\230\004P\265\324S#\331"
+	.ascii	"a\262\250\211\366\202]d\314\007~\310a4\001b\204\n\367\333K\317"
+	.ascii	"3\b\255\204id\031\270:\257\037\354\230\375s|\203\333\003\322"
+	.ascii	"{)G1n\255\373\227.\263\346&}\316\321%\237\321\375C%&\316\024"
+	.ascii	"V\213\016R\034\364\007a$\231j\367\f\364\277\020\214\033\375_"
+	.ascii	"c\036\263\330\252a\352\335\t\364\327\231k\254G\304\217\264\202"
+	.ascii	"\273]\016\211\007\300\346\213\334\354\362\364}P\272\027\353\230"
+	.ascii	"\3021\354\365\025\357\261\253\001"
+	.text
+	.section	.gnu.lto_.symtab.4ad71a8bd2a43e8b,"e",@progbits
+	.string	"dispatchIsEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347"
+	.string	""
+	.string	""
+	.string	"dispatchEnable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354"
+	.string	""
+	.string	""
+	.string	"dispatchProcess"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360"
+	.string	""
+	.string	""
+	.string	"dispatchAdd"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372"
+	.string	""
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374"
+	.string	""
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.4ad71a8bd2a43e8b,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,247 @@
+	.file	"fc_hardfaults.c"
+	.section	.gnu.lto_.profile.f7dac11e28091315,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.f7dac11e28091315,"e",@progbits
+	.string	"(\265/\375 \037\335"
+	.string	""
+	.string	"\250\023"
+	.string	"\002"
+	.string	"\371\324\320\376\006\002\002"
+	.string	"\002"
+	.string	"\002\240\342\234\212\n"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.f7dac11e28091315,"e",@progbits
+	.string	"(\265/\375 \023}"
+	.string	""
+	.string	"H\007"
+	.string	"\001"
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.f7dac11e28091315,"e",@progbits
+	.string	"(\265/\375 8\255\001"
+	.string	"\344\002,"
+	.string	"\001"
+	.string	""
+	.string	"\007\311\315\304\201\003e\001"
+	.string	""
+	.string	"\002\b\200\200\200\200\002e"
+	.string	""
+	.string	"\004"
+	.string	"\201\200\200\200~\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.f7dac11e28091315,"e",@progbits
+	.string	"(\265/\375 \022u"
+	.string	""
+	.string	"@\006"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.f7dac11e28091315,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\264\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.f7dac11e28091315,"e",@progbits
+	.string	"(\265/\375 \030\225"
+	.string	""
+	.string	"P\f"
+	.string	"\001\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\002"
+	.string	"-Al"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.lto.f7dac11e28091315,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_HardFault_Handler.18.f7dac11e28091315,"e",@progbits
+	.string	"(\265/\375`\200"
+	.string	"\325\t"
+	.string	"&RC=0\345(\035\300U\007=dx|W\326(\013\313\375\0177=(\005\"\301\360\213\212!g\366AQ\333\335g\330\226K3\243!e\033\016\006F\f\365@?\222\200(\001\317\302\222M\244L)2"
+	.string	"1"
+	.string	"3"
+	.string	"\247sq[=\371\t \347\006\300\220\307\202o\037\337M\001c6B"
+	.string	"\2466\016M5\363\225\253\006\370\251j\030\346\234\326\025\350qkn\373c\033\3016\200\366\013\245[b?f\310^\274\241}\265^\375\270\3201#` \233\223\243V`\306\242L\212\355o|\262\007\374u2\017cQ\301\314\346\234rM\0345$\375\312\234\030\221\330\267\250\177(*\353r\335\017L@Ji\216/q_\335\253X\337]o)\371-[\230\364\253G\337\304=~\003l\264H\\\254\013\255\005\356:\242\221\004\311\003r\360<\020\r\035Hv I\021\341\231\220\235'\222\235\003\207*\036<9\n\205<\271\261\277\241\271m\3169\343\206\377\266\241m\215\332\242\021"
+	.ascii	"K\005\005\311\\\255\377\20348\255\302B<XC\251\2153c\237-\255"
+	.ascii	"\274`\021d\006\267\237\245\221\026\321M\3351\245PP"
+	.text
+	.section	.gnu.lto_.symbol_nodes.f7dac11e28091315,"e",@progbits
+	.string	"(\265/\375 Re\002"
+	.string	"\344\003N"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\022\177\001\304\357\210\005\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\001"
+	.string	""
+	.string	""
+	.string	"\005\023\002 \002\003\201\204\001\024\177\004\377\037"
+	.string	""
+	.string	"\200\200\200\002"
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\003\270\252\203\001\001\204\001"
+	.string	"\004"
+	.ascii	"O\t\201K=\323\bd\225'"
+	.text
+	.section	.gnu.lto_.refs.f7dac11e28091315,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.f7dac11e28091315,"e",@progbits
+	.string	"(\265/\375`\231\003%\034"
+	.string	"\306\267\302I\260\230\321p\314\347\004\375\300\211"
+	.string	"P\270\323\212.c\201\266\267=\300\215\307\t>\362\250\314\"\341\267\b\365w\234\266\235~\241\270\242;h\320\237Vg\247\034\237\266\005\331\033\026 \370\243.@\227\234\311sX\006\352\212\304&[\246\234"
+	.string	"\242"
+	.string	"\262"
+	.string	"\tz\273%\337yE\324\311\367;\355j\277\205s->\306\026O&\245\027\r\375\n\276\376\275\377\334\027\377\237\377[R\245\365g\361\2026\365z\177\022\202\336\225\316\251\241\177$:\221R\321\341\222of\252\307\260\351D\353\271Mo\362K\313\341\311\343E\377WJ\331\244\246\2102\222\366\346\260\027\307>\301\264\320\"\337\211\377\372rYU\364\230F\322\353\032p\225[\300e;Xe\233h\304\366\202\322^\"\333T\266\247lG\331\026\332~\262\315b;\211\3551+++\313v\216\275\007\354\026\204\245\037\224\036m\327u\351\177\024,\353\323\335"
+	.ascii	"\227\275^\226]\230M`[\353\3006\371\226\313\372\0238\245\254A"
+	.ascii	"D\327b$m\307\334\266W\350\327\251_\237\276^'\206?\365\017\"}"
+	.ascii	"\310\364\327\207\277\237\347\373\250\373z\365\345\274\237Z\256"
+	.ascii	":(\350\352K__u\351y\276s\377KQ\242\356|\241\303\337\371B\327"
+	.ascii	"\237z\336\317Ey\301\243<\237\372\002\256\277\024\035\352\324"
+	.ascii	"\027t\370S\233|\\Y5@y7\352)\351\322\227\"\272\372\336\344_\342"
+	.ascii	"\320S\007\277\222/m\242CZ\251]\321h\027D\347\333\365\177I\260"
+	.ascii	"1\213\306NF\024 \336\340\002\331)\222\267^uA\001\215\212`=E\022"
+	.ascii	"\3415\243hc$w\310\022\331 l\245\274AV\210\001\360\326\017\001"
+	.ascii	"0\221\342\202H,\2750\227\313\302\\1k\300E.\260\264\027j\203\013"
+	.ascii	"\265Q\344\031\374\221\207\034&\256`\375H\"\214OV\b\253Fr{\254"
+	.ascii	"\217\r\302,\261u\006W\027\002Wn\\\2612\222^\244\322\013\343\332"
+	.ascii	"\254\205qyO\224^\035\273\303\273np\327\025\372\345\377\356\177"
+	.ascii	"a\025;\237\020\251XO\002\302J+\247\027@*^\241M\341\202\237\f"
+	.ascii	"\370\237\376/`\271r\242\361c$\315\303!\256\376\013\266\t\256"
+	.ascii	"\311\340h#l@1\263\346c\373\351Q\220\303\335\314\033\007\241\233"
+	.ascii	"\231\013\340\232\314\206\017\032tb&\315\007'3c\314\035\n\025"
+	.ascii	"\312\020\263\333\017\016\rw\303\321qq"
+	.string	"M\306\264\005\331\020\230;5f\220MD\013\315\224\231:@43G\"'\300\f|\023\242\341b\346\355\206\213\t\260\215\rN\f\210\016\031\312\231L\256\207\007'\253\355\314zb\263\236X\220M\006\024\233\341r1\031\030\034\355\207'H\226\263c\376\210\220a\340\301\311r^\236\331p\264 \232Oi\0134\022hjF\264\270\346f\302\315\004\227knffnhfJ\323\314\264\216\b\311\250\0250\226\2526j\\\242\244h7\222TT+\334\340\217\026\252\304Q\025\254?0 @\002B\020\226\323\001O\230z\346\211\266G\211\016\177\035\316-\353\206c\340\370_L'\200\240Z\260u;\232\272\264\033n\314W\027\313W\214\027>#)\304\373\020\273\330\006w\223aHh\274c\250{\274\213\t\247\241w\350\034\030C\204\305[\317\215\024cB\r\2642\r\021\346\023\006\222\2461\364Pi\311\216w/\265\271}#\3246"
+	.ascii	"\345:g\367\206\334\253u\325\036"
+	.text
+	.section	.gnu.lto_.symtab.f7dac11e28091315,"e",@progbits
+	.string	"HardFault_Handler"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303"
+	.string	""
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321"
+	.string	""
+	.string	""
+	.string	"systemState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311"
+	.string	""
+	.string	""
+	.string	"stopMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.f7dac11e28091315,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1687 @@
+	.file	"fc_init.c"
+	.section	.gnu.lto_.profile.16ec5d148e303172,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.16ec5d148e303172,"e",@progbits
+	.string	"(\265/\375 \240\025\003"
+	.string	"4\004\224"
+	.string	"\f"
+	.string	"\233\364\343\336\006"
+	.string	"\001\317\246\253\264\f$\002"
+	.string	"\001\002\002\003\002\004\002\003\002\005\002"
+	.string	"\002\004\006\002\006\002"
+	.string	"\002\002"
+	.string	"\003\352\263\360\321\b\020\240\342\234\212\n\021\022\023\024\025\026\027\030\240\342\234\212\n"
+	.string	"\r"
+	.string	"@\004\334\201\306\200\b\270\003\215M\021T\316n\200"
+	.ascii	"A\225_\311l\256\200\r\264\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.16ec5d148e303172,"e",@progbits
+	.string	"(\265/\375 \212]\001"
+	.string	"\240~"
+	.string	"\002"
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.string	"\001"
+	.string	"\n"
+	.string	" \0130\227\2251p\t@"
+	.string	"\006"
+	.ascii	"\177?[\226\263\020\006m"
+	.text
+	.section	.gnu.lto_.inline.16ec5d148e303172,"e",@progbits
+	.string	"(\265/\375`\374"
+	.string	"\225\005"
+	.string	"2E\022\036\240'\351?6zW\302\365\242w\341\341\206\261{p,PU\205\276\265\346tkmK\231\002/\307H\025\251\267_1\212\324\206\36341\236\376\033AWR\034"
+	.string	"}\016,\261\f\b\026\346\027y\302\335%\006zwg\337\271\b. P\002AP\326\001\017\204U`f \271\"\210\\\334H\250<P\200\244\020\340\036\360\013\220I\370?\300\"\002iQ\271"
+	.ascii	"q\035\245WP\323\341\230\213\305\016~`\273\007/\326\203\371\203"
+	.ascii	"\360\001};~]\363a`\016O\004\034h\320\354a\366\211\313\267r\244"
+	.ascii	"\021\020\001\304\016L\004\0235me\367D\016n^\003C"
+	.text
+	.section	.gnu.lto_.jmpfuncs.16ec5d148e303172,"e",@progbits
+	.string	"(\265/\375`\276\001\245\t"
+	.string	"\202\215*.pK\222\016\374o\004t\214\301\r\020\302\252\366\377\246W\303\327\310\027e\332\376\177\246\3745\220\032\377\377\0212C\350\236;\331&vk[&\031L`\240T\036\362y\346\307\225\002]\\`w\354\201\240\260"
+	.ascii	"\315\220#A@\024Am\255/J]\271r\347\351\311\361\311\365\2479n%"
+	.ascii	"\222i\323$58<\034f\240V\210\253\263\262\340\301\033\021\\C\211"
+	.ascii	"\211\216\361c\245@\255\257\317\270S\005\324\272\306\221\310\024"
+	.ascii	"j\313\275\345:1\005\250=\024A\321\027\313Xfnhp\273\26447\327"
+	.ascii	"\235\325hg\315FW\\Kr\222\345\221\325\004@\250\361L\310 \321r"
+	.ascii	"\222a\rp\002\tP\031=\021\220@\215 \244\n\353\326\f\215\262\306"
+	.ascii	"\210\253\032\355\3039\263E\023\336\013\276\035lg\302!$\312\341"
+	.ascii	"D\213\310\3310\0373-\335\207\364\350(t\210\263\274\352\007'Y"
+	.ascii	"c\331\253\033\242=0!\353\207\214D\205\004xh|\357\254F\350xg\375"
+	.ascii	"\232\347\351\247\352\304\340-\322n\256%#\344y\322\244\204$\264"
+	.ascii	"j\206\210\314\236^\233\362\307\257\230!\263\234\372\r-\320\365"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.pureconst.16ec5d148e303172,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\200\004\001\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.16ec5d148e303172,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.16ec5d148e303172,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_processLoopback.156.16ec5d148e303172,"e",@progbits
+	.string	"(\265/\375 \276\035\005"
+	.string	"2\211\",pU\323\001"
+	.string	"\215\337\301\205\213p\256^\254\026\343_\343\0301\201\232O\t\r)/\215\363\257\377\277\032@G{Z\300\212a\377\336)\005\226\3225\251\311\220\223\312I\251\331x\250\264\"*\025\\A\034\226^Uei\324\355#g\220\304\211\335e0^\354\0076r6\\\354\007J\204v+\001"
+	.string	"\353\021t4\266\037\031\263?\3572{\217C\361\276\335\325\2109v\210\371\337\234\240m\331\341@\261\273\206\332f\271\343m\037l#l\317\b"
+	.ascii	"3\003\316\231!\340\313]\303\323B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_init.157.16ec5d148e303172,"e",@progbits
+	.string	"(\265/\375`>\016\235E"
+	.string	"\np\024\031A0bR\007\277<\204\230\225u\001I\t\360\233\033"
+	.string	"C\244R\212S%\317\376NuDU\353\275\367\215\340\337\021'\0137r\"\036\005B"
+	.ascii	"\371=:J\007\n\360\\\177w\267\363\030\273\355n\"eJ\001q\001q\001"
+	.ascii	"\204\001\256v$W\373QQ\273QQ;\322\325~t\265\027\031\265\033\213"
+	.ascii	"\264\273\256\366bQ{k\324\316\272\332\211\256"
+	.string	"\366\355j\327E\355\177\343\353\b\276\265\305%\332z\250r\221CD\362\314\256\251\362z\377v\257\335\251\376{x\237\027\277\236\377Q9\2512Y\361.LP\206\340>KE\354z\252+\233\274\265\361x\252\027\r\271\361\361T/Jk\003\344\251\256!\355\317\213\007y\252o><\353\033\235,\313\307\366\247~\364\247\373\272\370\355^\252/\252<\226Ap\246\263\3122\225\301\263\216\300}6\351\223\355\263\372\231\332g=v\367\363\324'\362\347\031B\307XeYV\3568/z\"\365\375H\307\237lbZRJB:2B\036\213\214n\261e\211[\307\376\323/\300f\330\324C\206\314\353\223r\337$7E3I\371%)Q\264\022\224O\202\362D#\021Y\301\276\274\007\034CB\274\2006E\372{n\372\310I\331\333\033\0259\354=\313$L\220\356\272\244\354\355\221m\177\004\034k\3032\306\246\213\326\336\370X\306\326\b"
+	.string	"\216\251i\227\300\222\262\264/\022#<\255m\0178\226FD\036\202\336\201\352\366\310\263Gd`D*Y\226\237\232h\3447qA\225\257\320\021\231\223\230,B%\372\323\327adM\255\213\034dYv\035%+{wz\367\177s\367;w$_\b\004\257\177\b\276\302\205\260!l\330>ka\357<x\360!"
+	.ascii	"#\033\264\333\214\237\305\355B\237\220\240\037\024\017\t\213"
+	.ascii	"\305\304\332g\213\273\210'\346jWA\307\037\223\265\355v\217\315"
+	.ascii	"\3423\252\347\366rv\267\333\0014\221\004\355\324\217\325\330"
+	.ascii	"b7\375Qv\277"
+	.string	"\222\351|}\240\177\314\023\306pl\032\261\352\225N\226\277\006\277O\254$f\022\303\305pq\\\fe\315,\345I\213\002\355w>\256\322\272\307W\342,s\262\265\352\334^\361\026\335\327\205\270\357\304]\f\243\201\276<\226>`<\347\312\262\223\202\377\374v\342\272\024\2738\250\217\324no:\037\r\364?\325\352\275\367C\2154\365\241\373\303\3718\361\324\177\212w\360\240?\352a\263F\362H\323\276\364!\361\003\262\317lF\222\003$do8g\360\277\257\356\3708\365!\227\322\354{\234\366\251\317\006\204+\313`\037\025\341\202E@\360\254\277\037\2115\337W\302\177\312\263~\"\005\353\276\023\372\212\026\372\243\277\221}d3\230\213C/\254s\214GKb\255\312Pc\265\364e>\322\356YK\375QO\232Y\271V\233\333\313\235\332\324\033\316\375\253\306\264y\361\335\304\335\006\006\013\257\367.`\352\355\336\245\\\355\001\\\355"
+	.string	"\\\355Q\256v(W\373\223Q\273\223Q{\322\250\275\351\250\235\311\325\276\344jW2jO\n\327\267P\177\364-l_\303\367P\343\235\315\327j\254?\214\346\002CY$ow\205Z\364\026\270\371\204\241\320v\b\034\346'V\207\374\241][\201\311\252\300fg0\232\032\314\366z\200\322\331y\334p\336\344\326\264_\017p\013\022,J\2540\271Z\313\241\231\266;\034\007Cq\355D\3071a)\260\234\\\373,\323\206\302SK\253\262L"
+	.ascii	"\2106/1\321?\325*\355\245$J\233E;\274\026-\365?\234e\013\334"
+	.ascii	"e\200u\306\322\372\375\257\375\207\347Zw\270\016\236f\035Z\271"
+	.ascii	"V\237\306\351\207 \\\203\246)\372\277\255\023[\251=\265\303\022"
+	.ascii	"}\222\214;x\214\376h\322f\036\216]\2530\364\213\321h\360\031"
+	.ascii	"v\357\255I\345L\037\201\367\312\300g\316\264i`>\303\352\265\212"
+	.ascii	"\244\313\210?\325\036m$]\344h\263G\374\244i,4r\033m\327b\360"
+	.ascii	"\337\003M\004\036t\270\r\374\006l{\371\3246\332\017Mt\334H\024"
+	.ascii	"s\340:\372\243\307=am:7\267\227[B\277\341\273\303\2010\0368Y"
+	.ascii	"\214[\350\\\213\033\316_\216\317\017\213a\003\341CC\264\260\245"
+	.ascii	"v\030\361\343\271\266h_\335\355q\352Cz4X<7%\350\360\036\375\204"
+	.ascii	"\007\237\236\\\265\263h\027\271\230\221\332\265\204\372\0136"
+	.ascii	"t@\313\332\013\376\003\b\026$\250}\026\303f\271\344I\355\236"
+	.ascii	"\226\240ic?Gk\224\240\251d\343F\302a\233\235\016\023\372B\330"
+	.ascii	"P[\314'\257Q\365c\353*\312kTm1\265\230:\224K\035N^\243j\207V"
+	.ascii	"V\016\255%\023\207\325\f.\253\255+e\027\327V\227VV\227\001\257"
+	.ascii	"Q\205\303\212\311\225\325\245\354\342\312\352\301\344\232!\345"
+	.ascii	"#T\200H\3012?\253\013\007\017\023Y8f0\215\216U\265\203\251\305"
+	.ascii	"\224\201EC\211EC\251\305\264\312\241\304\342\352RVA\371\226\216"
+	.ascii	",.\345\216\255-.\345\221\372\365\273\211\273\177\b\315_\273\351"
+	.ascii	"\0014\241\374S-\200\035\200\017\200\215\202\r\321\333\205\316"
+	.ascii	"Rk\031\316\354|\245l\346\346\226\337,c\016\036S8\327\031\242"
+	.ascii	"^\243\266\035\367\247Z\250\035E'\236\276S\017P\033\005\233\337"
+	.ascii	"5\r\314RP\325\372zwm\234\252\265\352t\323\f\336\375\315{\367"
+	.ascii	"\006\347fg\362\327\364\036s\177\317\274i\006\2734m8g\237\364"
+	.ascii	"\237\366{\3320\326\b\371\336T\257\325"
+	.string	"&S_\341\222\223\353\264\333)\325Zu*\375-\351\346f\233\245\036\351\334LJ~r#\361\346\254\\\253\3167K6s3\316R\273\221\351\007\243\365\336@\235\344K\364\224\203\247\363\336:v\336\300@<\257\036\272\331\371\356\301\342\362\016biy\t\377I\340\025\244\r\347E>F6\366\346\203d\360\002v\230\200\375vO\224\033\274\200mc#\335\205\375\001{S\240u\335\353\005\236\315/D\273\277\200^A\326@\263\250\275\177\"xj\362\265\272\371\276\004\356\031\375S\377\235\236{\013\331\275\267g\024\251\376\362\032z\003\201?\250q(H\231B$\"\"\"\222$I\032\003a\005\204(%\245;\017\021\0209\307\230\032\322$)t\361\232j\214H\305o\2122| y\217.\223\200\210\202\207\225,\\@\370T\235\024\005\371\312\337h\002q\352.-\rG\325)LH},\330E\253u\272m\0174 7\374\354"
+	.string	"\356\031\235\332,D\273\0046x\370W\247\206\242D\210O\202\300B\271.\216\302\005\3203\240\202\360&\2110\306\007\326\247&%N\031\214(\264&t\036\177\345\320E\376\341\020\375\216v\342\215Q\005\350J=\321\3050 \rA\026\021FC\356/i9-\205\372\333\252\221d\030[d\312\340\3075\234\260\254\371BMa\247 <\303\331\026\f-"
+	.string	"\003\371\027W\332\036\352A\360\301{CMu\354\013\332\241\0322?\310\230\332\036\225-Cb6\365\302W8\252\023\037\244\373\261\177\214b7\201\203`\b\"8 \226\001\005\370x\352\243/\327\271a>\365\300\214c<<\224Y\023B\362H\234\240\030\002X\262\002-C\205\3660E\344\020\267\007]e\f#\027\216"
+	.string	"A\261n|gmb\270\352%%\203\031>V\202\263C\347"
+	.string	"\n\301r\235\355\340+\270\300\352\200\360<!\326*R\253\231\266\026gQ\244\205\234"
+	.string	"\235:\371f\232"
+	.ascii	"8*\301^,\234\202\004\300m \353\3366\367e\334\331&\214\tp\271"
+	.ascii	"\3021V\311"
+	.string	"\226\340,\373\264\240Y\037d\3413\271\rTB\205\030`\272\224\372\235\251\003l\360\357\020\211\34767C\t\253(s\201{\236uP\241\231|\340\370\007\236\317\301\224~\356\213\203\351Mp\342\026UY\304\337v\023O\236\033\270}f\032\215\211P\344n,\313\370-\263\253\334\204\3034\216\021\277\360\007\362\177\024\342s\310u\177D&\374y\375\f\006]\256\307`\317\245|%\3365\006\245Y\032T\3478\006\363\345\016^\246\244\216G\374g\220\215\025\355@\222\253\365\301\200=\231C\344\3528\204)\fy\252p\231\001\344\251\262\343\003b\275Y\227>\250\363\030\013\374\256\231\236O\202\257\223^\276\026\225\277!\340PY \243B\251y\023\242\303B\024vh\216\201\317\211\\w)\213\361LL~"
+	.ascii	"n\321<\254\221\0359\324B\203\313\2272I\266\362\224GQ\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.16ec5d148e303172,"e",@progbits
+	.string	"(\265/\375`\f\bU\025"
+	.string	"\006\346\201G\240\224J\032\003\300\3500:\274\206d\324\035\232[QU5\332\363\b\316\215\0377Eh\3164i\341%(X\250L\341\365\330\335\354\361\273\n\376)\370\247\340y^\265\252\252Z\021\021\021\225\025#\210E6\326\261FR\247\035w"
+	.string	"n"
+	.string	"j"
+	.ascii	"O\373\234\323\016\245i\257c\332\355\226v\035J{\024\340N\3660"
+	.ascii	"l8\347\357K\322.e$\230#"
+	.string	"\032\243\331V4\351\210f\335\320\264\023:,h\027@\277\370\231N\346-\005\326b\340,4c\361\031I\315Wz\256\202`+<\337\335L\345w\216E4\3370b\346\234\\8O\211\001\256\211\225\355\3541`X\204\231\315\271s\316\205\r`8\034\016uv1\2309\247\314\200\"\3661\304\216\003\304\316\343\303\336\303\303\376\243\303>\306a\007\262a\017\242a\027\222a\037\202a'ra/ba7Ra?Ba/\233\260'\221\260\233E\330\225@\330\227<\330\2318\330\2334\330\235l\355g\fv\264\005\373\016\005{Z\202]Mk'\263\3665\254\235\355jo\263\332\335\252\3667\252\335\307\324\016'\265\307E\355rP\373\223\342\324\232C\265\336\2209\353M\325jSZ\2556W\353\001\022k\255)\263\326\232q\031\262;/Z\353\314\314\331:#\242\255\004\322V^\031\264\362H\265\2257\222+O\004\256\002t\326"
+	.ascii	"\3434c]Z\314\265\365\222m\235l[\037\335\326\305\2675\005\334"
+	.ascii	"\272\025\267\002M\271\225k\227qb\237ab\247Qb\257Ab\2671b\277"
+	.ascii	"\021s\205"
+	.string	"\210\263\202\2259+\030\331[\301F0qgU\341[\205\345o\025\362\254\302\261g\025\212>\353\327\370\263~\001\255^^\243\320\352%\016\255]d\327H\264v\211Ek\2604Z\203\344\321\032\034\221\326\240\230\264\242\020K\245\365G\256uf\\\336\200\353oi\3751\255\276\262i\3659\255>\361i\355\225Pk/j\355\215Rk/\200\206\250\021 \f\212\232\025\324Is@\003\241Q\032\003\021 P\313\b!1\022\217|x\300\016#\341\322_D\240\005F\262\023[\266\241\\]\222\315>\nI:\001\263\021\225\260<q\300:x\220\022\307\304\020\360\240\326j\340Yy/#\331\023\224k\222,\33507p\203k\025\f\\\217\314-6l\252K\351B\022\240@\024\210\002Q \nD\201(\020\005\242@\024\210\002q\372\2212@\"\325\233\001j\317\315\362`\0066\364`\273\032\332\306^\201\247\201\323`\237\322\n\002\353"
+	.string	"\377\242\230\316"
+	.ascii	"\252\002"
+	.text
+	.section	.gnu.lto_.refs.16ec5d148e303172,"e",@progbits
+	.string	"(\265/\375 u\355\002"
+	.string	"RG\026 \220+\255\001\027\371\312\231\231\231\031mf\346\373\365?x\245\340\200\365J\b\t\330\320\370\221\224;\005\317\234\032s\277Hj\213\364JsJd%\220\215<\026B\260\017g\307\251\215\2331\260\213S\025wbY\304\372 xZ\033\232\013\001\033\001T\310~Nu\356e\246\246O\002"
+	.text
+	.section	.gnu.lto_.decls.16ec5d148e303172,"e",@progbits
+	.ascii	"(\265/\375`\377L\255N\001\2723\016|T \016%\235\306\274\031eU"
+	.ascii	"\025\025\225\230\b1\240\242\b\240!\212\200\371W\256*\242f\350"
+	.ascii	"l\304\314tb@AU\223D\207\350uo\265\241\361\346,/-\215\266\332"
+	.ascii	"\352\007\315\305\225;S;(o_\373\307\216\023\371\366\007\223\204"
+	.ascii	"B\2532\321~\273v\223R\312\024\343\006\242\0072\b\372\027\215"
+	.ascii	"\215\307V[\326V\336\270\f\276\303\177y\211\367p\030\254\207\363"
+	.ascii	"0\030l\207\3612\0226\203\323\344\243\254\002\223\301uy\005\026"
+	.ascii	"\223\2150_f\221\225\260\037>\203\3730\032<\3466s\022\246;\366"
+	.ascii	"\202\277\\\343&?Nk\002Yrd+\254L\354.LI\222\255\2645\037bH\326"
+	.ascii	"\356\254\004\241\202\265\216\300\335\205\235\201\3352Rl\270\271"
+	.ascii	"\335\330\302iQ\250\322\236\364H\203R\265\205\265\276\234\334"
+	.ascii	"\3410\2630!q\030\215\211\327\035X\223-1\265-\034F\206v\26773"
+	.ascii	"'\341)\270Kfn\221pD#IN\302C\260W\036sB\235\034M\301[N~\354\030"
+	.ascii	"\303ZI\232w8-'a5\255\273\275\231a9\t3\231\334\375x\270Q\213\212"
+	.ascii	"\301F\001\r\334\327\347\374\023=\024w\371\361\033\206\303\\0"
+	.ascii	"V\336\021\033\326[l\220xq;\202\365m\302\240\007\241\n\223\026"
+	.ascii	"\274\002\316r\233x\016_9\306r\243\374\312\315\275\330\302s\330"
+	.ascii	"\312r\314\007B\306\264\340~<x\260\341\242#\013\036\252o\323\206"
+	.ascii	"f5\3646i\350m\226\2408\356\3031\025\034\244(&ZX\333\224\241\367"
+	.ascii	"\356\372\234\003\270=\347m\274\320\333\370@oc\003\275\r\013\364"
+	.ascii	"\250\031\364(\026\364\250\033z\324\f=\272\205\036\275\201\236"
+	.ascii	"\356\372\234G\233\320\327\364\241\034n\317\371\275\353s\276F"
+	.ascii	"\013\372\0325\3645F\320\327`\241\257iB\177\242A\177\332\241?"
+	.ascii	"\255\240?\233\240\013\270=\347\317!\350\317,\364\247\r\364g\022"
+	.ascii	"z`\036\356\302\301\322d\356\005\326\007\312\241\230\b.r\233\330"
+	.ascii	"\310\217\271\256\3335\231\3256\333\233\251\223\215\244\254\254"
+	.ascii	"a\375\333\341\334\371\373\373\373\273\035\316\003\331P=\206^"
+	.ascii	"\356\372\234\007\032A\317\304@\262N\276\253)iX\037\004\026\330"
+	.ascii	"]\222,|\003+\355\316\r\207\230\225\017\314\003\367\300*\340\037"
+	.ascii	"\267\211\263p\216c\035x\3071so\244\017Y\370\252\001r_\360\274"
+	.ascii	"\366fz\310\341{\"s\312\321\177r}\316\233\333s\036\250\204^\237"
+	.ascii	"A\257\275\240\327X\320k5\364\372\013\375q\025\246\221\277\270"
+	.ascii	"\254 \343\226A\223f\345\377\220\346\366\005\215x6\322\021\232"
+	.ascii	"\231"
+	.string	"\333\227\231O\320\2442\265\273\032x\nSa\033x\306mb\0328\306\261\024\226\201i\334?\034\225\231O4P&v\367\366\33724\256_\031\023\017A\276#\255\264\034}\267\256\317\231\341\366\234\327@P\030?5^\226{sX_\333@\177\335\226V\226\360\n\354\"\270\344\331HgX\266\242\030Uy;\272k\301%\317>\332B\005/\341}\3272s\253f\211\216+wx\t#\335\276\240\021s;\325\234\305\335(\263\207\237\360\013\f\205\235p\023f\272M\274\204U`\235\307b\357-\250\177\254t\354\002\267@\301\326\200N!-Ia\215Yh)+:\264\260~\316Cq\322\207c\245\0014\243\260a]s{\316\347:\364\231\n\372\354\004}\006C\237}\240\3176\320\347\027\350s\013\3648\017=\356\202\036SA\357\336=s\233\006\270|@#\346f\356\315\334\301>\320\244\225a}\334\206\376\032\340\314\177\177\327"
+	.string	"\347\361\022\224\347\366\234\377%c"
+	.ascii	"\024\311M-\t\326\377\325\313\313\321\327t\003\353\377\027\357"
+	.ascii	"\216\271\315\233w\305\374\336\335\267_\346\336L/\267.\270d\356"
+	.ascii	"\246\023\353\b\f\257\275\275\231\007\221w\355v\236\363\202\341"
+	.ascii	"\345\2657\363\307\203\207\232/\272\"=N\215\253\320\343(\364\326"
+	.ascii	"\341\013\346\206\371\255\273_\356\001\b\317A\272uzo\243{5\b\336"
+	.ascii	"\253\0010\n\020\243\262S\037\277@\177\371\320\377\322],8N,\322"
+	.ascii	"ta}\020qL\304\236\300\271Aq\302\326\266\026EJs\353\r\356\256"
+	.ascii	"]\271)\t ir\2677\3637\311\377\001\313e\336%WnJ\023\211\273\333"
+	.ascii	"{\037\204)w-\230\367\256R\333\332\233\371\377f\271W.\227\273"
+	.ascii	"\302\335r\347\256\226+w\273\334\346\305r\251\374V\271V~\231\277"
+	.ascii	"h\377\207\337\003\020.\226\233v\32708\332\273\212*\003\326\226"
+	.ascii	"\027V\366\366fz\370\361\220\343\242\312\3760\350\337]\2373x{"
+	.ascii	"\316\337%\350o\027\372\253\003\375\245\201\362\\\237\363\267"
+	.ascii	"\005\372s}\316\267(\207\353s^\b\355p}\316\233\200^&W\35567\\"
+	.string	"'\314\035\2354G\322\364a}\022\320\337&\317\200l\203\360\002\240\277\033\316\373w7\234\327\200:\340\372\234\377%\013\273bW\t\n\366F\332{k8\225\220\256\210`}\315\356\331\257\222[v\017@x^\222\355${\357\253\344\003\253\275\215\256\222\035\277\275\215v\356\325\340^\r4\022\254 LN\375\013\350\035\373\360K\326s:M17\332\336{'\323=\261\305\300\032x{\316ct\001\327\347<o\317y\223l\310JKV\033mo\246\205\035\246\024S\016\254\317\274>'z{N\246()\252\354\202\037\317\310-\370\361U\017-#\377\355\312,\310+\370*\313)~\314\344\277J2\212|\342\307l\377e\313&rQ\334\237\333\314\376\330J\226/y\275-Z\3747\253\340\307c\376k\227\225?~\312\311\037\363\375\267/#3\321\237\363\237\2179\205?\237)\370\363\215\372\337\340\177\177\356\001~|\200l\374o"
+	.string	"\376<\364\3374=B\377\357~L\200\234\376\371\347\2778\212?V\341\277M\231\370\347\f~\034\314%\206\230\371_\260\214\202\0377=\313\237\205?\266\360\337I>\001\004\376l\202\257\022T \004\016"
+	.string	"\t\376\313\342\317;\377\301\374\307\340?\n\177\036\301\237A\360g\024\376\334\201?o\340?\337u\374:\002\277\277n\300\237I\370\363\005\376\034\342\317\"\374\271\002\177\236\300\237#\360\347\016\376\274\301\2379\374\031"
+	.string	"\177\306\360g\235?\343\374\271\346\317\372\307}?\326\3731\336\217\303\374\030\314\217\347~\234\345\307X~l\345\307T~\f\345\307m?V\373\261\331\217\307~\f\366\343\257\037\037\371q\327\217\267~\254\365\343\037?\356\361\343\254\037\347\370\361\325\217\255~\\\365c\032?\226\372q\324\217\241~\334\364c\246\037\273\370q\322\217U\374\370\350\307\373\307'\370q\007~\234\201\037O\340\307\021\370\261\003~\f\364\343\004\374\330\303\217\013\360\343\r~\314\341\307\033~,\200\037g\370/\222\037c\370\361\205\037\357\374\027\307\217\361\217\357\177\377\376\353\367_\273\377\202\371\357\227\377\322\375\267\355\277K\376\013\366\337\257\377z\375\267\351\277L\377m\361\337\004\374w\303\177\275\377y\377\273\374O\362\177\370\237\312\377\374\367\367\367\367k\007\374\027\230\374\f\b\023^iE\230\366\025+7ILQF\260\256\262D\nW\037\326\317"
+	.ascii	"\005\375\215\362&F\303i(vw\032NGi\266\345\341\355i*:NO\271M\r"
+	.ascii	"\247\245`\346\276{!\246\207\352g\350B\237\341\007\372\f=\320"
+	.ascii	"g\310B\237\001\007\023&\232\215g\205\223\315\213-H\356\266\023"
+	.ascii	"\034\002l\360\242\244\366\330\236\3308\331\315i\301z\r\253\340"
+	.ascii	"G\226\205\3653\274@\017B75\231n\222\231[$`\241\321NnS7"
+	.string	"\265\232\207\237\0342T\313\032Z\353&6TTZ\216\260\276O\037z\237;\364\327bM-\246\321\356\336\322\300\226\257\273\3554\205\200\340\031'J[X/A\n\026\251\362v\005\353\373\304\235\335\246V\242\307\220\264\022M\246\315\330\240\354\234r\300\2608\302D\227]\233\375\232\231\247\356\332\2103\\I\260\306:>\\\227\235^J}H\260\276\017\022\364>9P\234\333s\336G\n\f\354\326\351%s7a`[j\301}x\342\244\204\365}\214\320_#\321H\364\227Fb\356\247\024\236\370\302\202iQ\314\264a\255\2770\350\241\277\336\272M\275\245\275\364\222\271\2278`\332\2708\355m\247)\004\324\364\201i\261\023r\355u\335\245\305\306\256\214\301\332\310="
+	.string	"!I\316\225V\016&\254\217\341\n\221\333\324E4\327="
+	.ascii	"!\t\b]D\017\341\001\305\305i\017\007\313]\334\022\255\217\201"
+	.ascii	"\bz\fU\350\275\373p-\344\211\224\025~X\037\303\223\226\326]\013"
+	.ascii	"a\312j\211\307\001\214K\254\rxU\306\314\021\254\337\303\005\375"
+	.ascii	"\365\017\375#\267\ba\212lC\255\200\256)*\037i\t\302\206\365{"
+	.ascii	"\240\240\277\316\372m\352,\335#\204,\253\r\243\203#\314/x\033"
+	.ascii	"XSJ\202\265\346\221\206IT\034\326\357)C\337\003\004\375u\216"
+	.ascii	"\333\3249\364\016\275$\333N8eIr\356\244\330h\242uP\341\222\243"
+	.ascii	"\007\326\357\271\201\276g\t\375\365\325\325]\323K\262\335t\243"
+	.ascii	"BK\027\224\275\275\341\020\220sf\354\214\027\254\177\201\016"
+	.ascii	"\275\256\272\332\252\251\255\356\332\317^\216\351`\n\327\020"
+	.ascii	"\277\275\355\004\207\200\034.R\212\204a\375\013U\320\337\273"
+	.ascii	"vRQ\275\240m\210\237\327\236\232\352`\243\304\316M\013\326\277"
+	.ascii	"\360\206^O\351\031\3274\232\232\206\256\201\356\275\227\314\335"
+	.ascii	"\3643\245m\210\337\336\236\262\321\341\346]\271\221\221\271M"
+	.ascii	"]\343v9\033\003\240\026\"ZL\260\376\005-\364\277\307\377\271"
+	.ascii	"\215\234\366\336P@\346v:\3129\377\373\013\274\267\303\257s\363"
+	.ascii	"\335\340\277\376\006\204\230\033i\213\336\336\373\352\241C\326"
+	.ascii	"\214jp\330\377\337a\357\345\335{;)\231]--(\231\031m\2453\271"
+	.ascii	"'\013JfWOJ\314\215C\3036\313\261\225\230VKm\265\334{/\361fn\244"
+	.ascii	"\253\247\215d\265T*1\267\323fZ-y6\322\023\217\022\323h\251dv"
+	.ascii	"\365t\225\314\254\236\224\314\254\236,l\244\275\334HF8P$\253"
+	.ascii	"'\245*VO<JfFOJHWO\227i\265o\0267\346\325r\30563\322\331{/1\267"
+	.ascii	"\2269{\0339\355\245\026\314\264\257\356\230v\325\276rG\2309~"
+	.ascii	"\366\336K4:,+\033\346\321\226S\"be\\\2617\335f\372`y\227\314"
+	.ascii	"\275w\322>Z\336\275W0\235\366>\262B\301\324\336{[\335\025\222"
+	.ascii	"\234\266\316F2Z:\302\262\312Yqd\225\264\211\340\270{\357\375"
+	.ascii	"\244d\206e\365\201M\211\331\326>b.\257\322\222\325\336\332tW"
+	.ascii	"N\250\331\222y\363t\314|L-I]\313\370\357\330e\313qb\345l\007"
+	.ascii	"\326\230\353\303\265\224\316Q\246\211+\352\267\251\2434\224^"
+	.ascii	"\222\355\345\t\2544Ee\264\244'\027X\300\320P\3000b\250\314`\255"
+	.ascii	"\237x\274)U\301\372\026\370\320_#\37565\222n\272{\353\356\355"
+	.ascii	"\244\fe!\205\344\r\353\027A\033Y\304\256\260\276\005:\364\277"
+	.ascii	"n\241\227\264\213\333\324LZ\351w\207\n\257\255$\275\"\270\344"
+	.ascii	"\331\033+\310-\243\2314\013\275\342\312M\355\375\364A\027\224"
+	.ascii	"\226\221\034&\256\033k\250\276\0050\364\026|\240\267\200\245"
+	.ascii	"W\034\267@\301\016\227\f+&X\337B\r\364\026\220\316&\236^\017"
+	.ascii	"\254\177\275\374m\352e\376\323Fd{\211S\346\004\206\327^\220\006"
+	.ascii	"\237\021\033\326\347\031\203\376z\377\341%\031O\216\260\316i"
+	.ascii	"n\246d\374-a}\2369\364\317w\277\315|\227\375B@C7\022^\222\263"
+	.ascii	"\006\r\025vX\367\355\344)\251\321a}\2366t/\233\311gn3\363e2z"
+	.ascii	"A\222\224\311yA\033\276<&\347\005\221\214\260\220x@\217\350Y"
+	.ascii	"\031C\365y\256\320\363<\241\347Q\361(\031o\357\\\036oK\036X\177"
+	.ascii	"\007\r\372\235;\364;qa\262\335\r\223.QaX\177\247I\030&\032\367"
+	.ascii	"c\252\352\313o3\177\311tw?\271{\253\225\375\001\227+\354\230"
+	.ascii	"\302\372;G\274\320\211\270c2\301\272\013\316rL\007\034\326\337"
+	.ascii	"\361\201\376Z\201\322w\247%s\311+\344\271\333\314[2\226\3372"
+	.ascii	"Y\356\030o\375\037\266\344(|w{3\363\226\373\227\257\234\271C"
+	.ascii	"\313[r\026\2611\2760\017A\036~>\226n\364\203c\320\033\234C\255"
+	.ascii	"\220\361!$\r\326\017\266\241\007\361v\266w\347\226\343\360\n"
+	.ascii	"\354\"3\267l\222t\360Q\311Sr\225\333\314q\031\016\347\270,\345"
+	.ascii	"\314\2152{@'\252-WP\375\340\030\372\340\026\372 \026\372\240"
+	.ascii	"\023z\2354\350\237\323\2329-\267\241U\001\313b\312\350f`\315"
+	.ascii	"\206\226\345\224\252\354;'y\3556\363\223\334\004\215IV\013\346"
+	.ascii	"\275\257\216l\271=\311M\034vx\036\316\272\274,G\247\276N\033"
+	.ascii	"z\0353T\r\267\270\231\363\222\346\206\365u\302\320\353\370@\377"
+	.ascii	",\326\314byI\b"
+	.string	"S\3506\303K\362#F%\013k%6]\320\310^`}\035\032f\267\231\3172\323\354,\217\345\262\340\222\271\237jTx\372\342\264\267\367\376\361\240s\306i\263i\375g\262\347\262\273\206\202\255A\307\016\n\023\b\326\030\313\207g2\t\370\310\201\004\353\347\350\241\317\231C\237\323\004+\352X\002\005\353\347\230\241\177N\362\205\205\f\315\030\2543\022l&K\023\0243\311\336{\307\206\255\257H\214\247\337f~\312^w\351t\367V\233\363\273\333{\n\0017Ex\354\335\300\272\353J]\271\342\303\3729E\320\"YF\336\312cN\0348\022\363\347!\231H6r\233\271H\026\362\f\225a\\\347\250\"9\306^\216*\222\271\316\334\335|\231\343\333\201\352\347\344@\237\023\003\315[\177\216\312R9\b\266\"\200\0164f\260\326:\2478\335u\301\3729F\350\377\354#\367\310YY\205\374#\363\270\315\f$\347x\326\201\267>"
+	.string	"\311T\371*\2179\241kGX\362\324\01603\276"
+	.string	"\311XW\3562\215\032^2\220l\343\256M`)Fd\207\213\031\264)A}\23464\347\366\234\307\021C\217\303\225q\\\263%<\372\260>N\r4W\345\033\267\231\255\276upt<A3\302\032\305\336{\337G9k\036\345<\216\023\372\2334\350o\352\320\243EA\017\227\206\2367C\320\313\335\236\363\264\272>\347W\270=\347ont\310M6H\314\035\033.yThR\231\t\235;\243\203\n\326\277Y\346\245\354\"\267\320;\2331\005\353?\267\310I:.\302\226~\3402\234V"
+	.string	"f\355\320Y\351X\232\323MR;\254\224\235ZN\253+X\266\304\262"
+	.ascii	"\307\230i\216\200\301\232\231\323\324\344\303\n\313]\233\263"
+	.ascii	"\262ttE\313\350\242\244J\232\225\363\313\312\017\252\013\353"
+	.ascii	"\337\346YE\327H\233\221\205\205\365\224)g\034\017\016]dZF\366"
+	.ascii	"\342\316\252\0321*\032d_R\244\234o\027\017\013\311\324\333\231"
+	.ascii	"\034\0373\364\260\374ps;\241\340m\320e\354\213\023\024`Z\235"
+	.ascii	"\226\267,*'NN\266\353\344\264\367\324^\216\211@\022\233\035\036"
+	.ascii	"\333\223$\036gc\316\023-C\245\314\03063^G\256`}\002<\241gZ\332"
+	.ascii	"\331\344\027\214\366>"
+	.ascii	"\332\273\352F\007bcbD\366\366TT\207&\247\032\225/\246\231S\355"
+	.ascii	"d\242\263\002\026\252$]YD\232f`}\002 -YRe\251\313\026\232\223"
+	.ascii	"\037>\260~\007R\316\263\363\354\004K"
+	.string	"=\374\270\336\214\306\260~\007jg\331YV\023\2674\007\305\313\246K\027\020-\035cc}\271G\032\337\027\326\357\200\206\230\230\256\361\214\264\253\376\266p\270\336\336\366\260>\007~'\330\tV\207\246)j/\247\r\t\f\313\230\035?\177\3548\277v\232\334\275\247\366\021\322\256\262Q3f)\foo+Mu\270i\032\231-\211\374\374\372\211\304\003\020\036\005\245\312j\361\205\365y\344\227G\236\022%\254\177v\235^\277\215\215\220\272&i\260>\007l\350iD\001\377m0\025\037\016?\254\177\026\311\322\002\244\b\326\370>\312y\0169\271\322\226p\315\300\372\024rr\345&#\2731\\\031\311\316W\324\216\037[\377m\362\025\254\271#\254O \247\326m\236\312\031\344\314\235`[R\032\025\254\317\001\023\364\367T\316\027\334S9\317\036?}\37468aQV\314a}\016\310\3203\353'\217\337\346\356x!\247\005\353s"
+	.ascii	"\206\376\247\n\277M\316\230\037R=\260>\007^\3509\370\221#\207"
+	.ascii	"\256q\311\006\340\327\024\205\344\203\306\030\326\347\300\352"
+	.ascii	"\274:\257\204eC\252\254\351\355\200\303\372\034H\325\250qZ\021"
+	.ascii	"Y\352\202\363\262\351R3\023v\343\247U\\Y\225]\325\030\231\"m"
+	.ascii	"g\325I"
+	.string	"\305\004f\324\366\"\347F\030\267+\033Z)\007\312\222\030\2759)\251s\306%\333M\035\020\"F\344F\031\034S?g\254y\205\275a}\312\270uL\232\3340\273\372ocA\3052\b\\S\323\031uy\230Gsg\2664\0278\273\346\t\343g\224\037\263\212\t\353\2239\241\322\240aB\303\372|\332!\322\224c\n\326\337\240\311\351t\355N(A\334\302\260\376\006d'\323\311\324\007\303\353zm2;\254\277\001\220\223\305\311\342t\241u%\207\215H\013\243\263\305O\027zN\214\013\235\325\271\342+\316\244K\266\233N,00\274\316.*)pg\322]\303\361\362\344\005\206\3657\200B\203\346D\372\261\312[\352n\224\301sK7,\347\321O\244&rf\177X\003\377N\243\37767k4\230B\260\376O\243s\t\245\315\353\bF\220j\314\020\261sc\0256M[5\366\260\006\246\271}Ti^1\326\376\333"
+	.ascii	"\261\312\324\255a\375\rT\224)\003\354[\202\207\205d\017\312i"
+	.ascii	"\b\337\201};R]b\0249\203f-c\260\235\331k\002\345\245\325\027"
+	.ascii	"\246\026e\t\326f2\031\030Zp]X_\003<==\270%-${\031\007\2315&\254"
+	.ascii	"\257\301\227\0301@<\"K=\374rT\210\371\2232\346@<\355&\245\031"
+	.ascii	"\2055\360.\213)C\346\216\307\243\304`\373\262\202\3655x\021&"
+	.ascii	"\314\\\213\246(\265(\260\037d\266l\001\202\021\242\005\347\225"
+	.ascii	"\361\342t\344\370r \030\033 d\366zx\301\271B\003\212\316\013"
+	.ascii	"\035\220.\306\013-.\300.\"\302\200\275a}\016t(\027L\227\343\200"
+	.ascii	"\300\345a}\016rssnaR\274n\230\236\220\270`\313\222E\327\270<"
+	.ascii	"\314\243-T[K\256\025\300(\301r,\272\306\017\272\301\316l\334"
+	.ascii	"\235b\236t$a}\016B\254X\001B\261\215\341\013\333\333\3212\327"
+	.ascii	"\334\253\222\"\005H\345\307*oAs\243\f\272D:\213\021w \225SF\037"
+	.ascii	"\026\325\024\234\274\243\256\254)p5D\360\274\374\260\242S\326"
+	.ascii	"t&\351-\303\315\305mA\303\372\034\236\240@!\221\205/\f\330\003"
+	.ascii	"M\213\020\254\317a7\337\004\266\375Xe/G\177S#85\315\261\035\330"
+	.ascii	"\026\334b&\013\334\223\223.\356J\357\311Z\226\037Je\350\023\337"
+	.ascii	"\2218'\271\t\031\0356\224`\375\f\342\224(\001\252\225\245q\332"
+	.ascii	"\263q!'\267\205\311\201j;8\226\340hK\313A\363d\311R\032\332\017"
+	.ascii	"\261%9\224\2045\tB\265$3\201Fg3\226X?\203!ee@\263K\266\233>\260"
+	.ascii	"k\212\272\251\022\362\364g\226\235\276t\311\005\301\372\031\\"
+	.ascii	"\211\211\001\307`\360U\005\275\330]\241\301<p\354\346\213\212"
+	.ascii	"4\264\260"
+	.string	"\3776\301\270\261\247\025\260~\006K0\260\007\3000\263uFU\371\265\300\372\003\220\373\372\n\203Uf\312\213.\306R\027\254?\200$G\216\200p\204\227\306\250YD\t\353\017\340\211\353\\\300\256\037\253\334e\210\2308\257\213\346\b\226\027#\007v\255xD\342\200E\332\224\330\256\024!\262\203\307\330\224\256\213\021f\0038$\013\221Z\201d\t\326\337\020fk\013\204\233]X\315\027&FXX\177\003\231\226\226\t\260\300$\361\232;\372\022\003\353oP\341\307\017\017\344}\201\022\334\363\262\325\003\353oh\321\243\307U\303\352BdG\357\306\216:\254\217\001\225\035;\200Y\030\204\034i]\321\301\002\265\366\004T\341\300,\0352graN\377m\316+M~|X\037\003\267\0349t\215\017Xsm\231\206\036\213-\254\217\001\326\325\025\f-R^vQdT\224\261\262\002\322\270d\273\tD^\230\224\013F:\266\260\276"
+	.string	"\276l\330"
+	.string	"V]\262\335\024\001\030_Nx\b\335\2307\252\003\2534\217\272\030`n]\013(\267*\254/"
+	.string	"\027SS@\032e]Fd\234\311"
+	.string	"2\343@\032\331J\217!f\267O\213\r\231\332\201\365\003\320&%%t\033R\305\353\234\322\245g\345#*J\327\370\021\202\305\205$\030\346\304\016\f\326\017\300\362\351\t\b\305\003\217\213\023:\203\215\215\314\201P\267\316F\310\020\254%\275\246&1sZWp\254\200TaQ\306\304\244k\374X\345.i7\312\350\204\001\003\344\306\020\026,\200.~\254\262\030-bm^{Ou"
+	.string	"\032\201b;kq\240\213\373\227\345\254\n\326'\223_\374\267\311\031r\245\"\017\353\003"
+	.string	"\0070\t\230\244k\\\262\335t\317\346zT\355\355=\325\201\0025\300\310\300\372?}\350\017T\001T\221\235B@\333FO\035\336\216v\350Y"
+	.ascii	"\"\327\205\365\177\230\240?\320\bh\004<\2729\032\202\005g\365"
+	.ascii	"\244\211\013\326?\360\b\270u\030\031v~X"
+	.string	"\377'\007\372k\271\337\246\226\003\356\020\246\230{Y\263\305\355*jOKK\036\023\353?\264\025[^X_\203\036z\020\300 \271\013\3630\030\034)e\300\210\327]\024/I\266\336\276\3345\025\270\322T\331\233\323]\256\334\224\004\274\320\314h>\275\247\375t\237N\243\311h4\272\314m\3523:\357:\213\326\362\037\272[w\345\246$\300%v'\246\247\273\324\260\200JSeO\237\321v\032\017\203#%\021UA\356\366f\3523\272.w\201JS\305\013\365\341v\326\204A_C\023\364\032\302\320_\343\215Y\221\343\312\210\271\327^ \361a}\247\3050\367\217N\032\"Zl`}\r=\320k\300B\257\301\006z\r2\320k\200B\257\201\t\275\006%\364\0326\252W\320[n\363Gs\321r\364\302\006\326\317p\006}\301\276?\347\377\356\317\371\fb\320\313\274>\347\317\3559\237\001\213\233\233\276\022\302\024sC\201"
+	.ascii	"\312\316);\301 N\316\215@\355\232T*\213H\b\265HuUZhU\244\210"
+	.ascii	"\233\033\201\222\352qX\"y$\241U\221\"L\020\221\243\"\325\233"
+	.ascii	"a;\034\241\250\036\207\037`\221\352\260E&C\244k\021\213L7\024"
+	.ascii	"\207\351:\204T\327\226\rJ\213EG\"R"
+	.ascii	"\rZ\331\242 \r\307c\021\022\231D\326\264\302t\005*{\236H\256"
+	.ascii	"\3066\211\254\021\032\246G\235\256EJ\255$\"\246\354\220\210\\"
+	.ascii	"[\026\247\004\023N\030q\201\013\264)\233\25667\002\265\353\260"
+	.ascii	"H\230\256E\355:,\342ao0\254\303\364\030\"\247M\207tZ\025)\"\307"
+	.ascii	"\002\255\212T/\260\352q\250\266*Rm\211i\233\026\223m\221\b\030"
+	.ascii	"H\333!Q-\"\325\235\344\232\202\004\024*\006\212H\021\322vXT\217"
+	.ascii	"C\023?mQU\326\260\255\212\024A$\016\2037&\244k\021\006\022CH"
+	.ascii	"\225\365\300\232\242PK`\325\013\255\212\024a\"\035!\247U\221"
+	.ascii	"\"\326\264=\252\030`o\004\262I\2529)\260\303\022\204\204LXSe"
+	.ascii	"\232Z\240M\207xn\004\002\336\bTD\244\006\265*RD\021\221Zs#\220"
+	.ascii	"\222%R\262D5B%K\024\244d\211Z\025)\202\204\222%\322\271\021H"
+	.ascii	"=\022\203R\342PhM[\244\252\"E\250Gb\315\215@\251\320\220=\252"
+	.ascii	"C\241\234\033\201P\254A(\326\236\365\274\021\210U\016\005%U\f"
+	.ascii	"\312\241\232\033\201\202\206T\023Cd\260\346F \025)B\347F\240"
+	.ascii	"VE\212\310\271\021\b\231T\207\033\020\211C\r7\002%\327\024C\311"
+	.ascii	"5\305\020\206\033\201\326\264M\211\222kz$\246\b\261\226P\217"
+	.ascii	"\303\020mJ\"\271\016K\374\334\b\264\246Dj{s#\220\212\024\221"
+	.ascii	"bM\333vX\002\247U\221\"rn\004\022\nb\323\265\250\035\246\030"
+	.ascii	"H\215\304vx\354)!=\226\030\"/@tB\271S\024\241MY\0137\002\261"
+	.ascii	")\260\303\266U\221\"\330\024\330!\nD!\234\033\2016\200\202\b"
+	.ascii	"\022Am:\264\016\333\024\210\311c\210tM\206\330\271\021\210%\""
+	.ascii	"\006\261DD\237\020\312\235\033\201\216(VV\330\256IeR\325\240"
+	.ascii	"\275\021\250E\026%C\224\030"
+	.string	"\256C6\254P\207\025~\240\330\223\036K\fQ0q\236\354\211\344\252\331c\222\250C\300&\225Z\004lR\251\213\351:L\217\304\232\363D\362\2045\311\256ED\233vM\216H1<*Yu\204#\212\225\335i\203\220I\"\242$\321\304e\205&X\343\215\361\262\227=\333\013i1It\323\336\b\244T\327\226-\246\307\240\244\272&\217I\"\220\025\262\251\017\273&\217\304T\311\352\fA\220\026\223D\253:\354I\205)q-J\222h\213\224HU\247\275\021\210hH\024\006%\325\r\305\264\035\232P[\242\b\254\212\303\nI\244D\325DZ$\256>l\2160%R[d\321\032D\024\312\240\035\266\354\315\210\026\231\256k\021\321B\353\323^\270\021h\250\250DZ\f*\036\325\242\022i1Y\202M\332\016[\0228\255\212T\365S \016K(\223\311\r\260lJL\256\312\235\023\3255E\246C\350?`\200\002\030\340"
+	.string	"\0245=mkaM[\035\326\002\n\024P\234P\203T/\2647\002\r\203\3305\311\"S\266\203\023\303\0247,\317\361\230\\qj\3304]\207\322\021\214\304VU\346\264\310\224\b9\244\036E\360I\205i1YB\272\026\035\325\241\220\316\205\366F V"
+	.string	"!\332u\330\222\030B\252\305uxbMb\340\230\"\221C#q\203N\313\036\213F\254i\213LC\344\250 ]\205\204,;T\236H\036\205\027\222&\326\224\025\026S\242u\210,\022\252kk\241\275\021(\303\311\352"
+	.ascii	"/\2647\002\241H\226\b\032R\002\240(\242E\246\310!\321\232*qX"
+	.ascii	"\036\024I\013$U\244\252\364i\205l\t)\221\332\242\355\232\266"
+	.ascii	"\304\341:4\022\205m2Y\"]y\330`{#PPRM\261\266)QzL[\r\027R`\207"
+	.ascii	"% \223jKD\026\t\345\244\302vM\216\310\240\336(Y\"V9d\241\035"
+	.ascii	"\256\305\242a\t!\212d\211\024\210\303c\211\fl\273&\2258+0\n\323"
+	.ascii	"vXT\026\t}H\034\207\352\232\262=\255\320\003\020\251\220\035"
+	.ascii	"\032\0361\220\036K\fYu\204!\006V\230\323\336\bTT\225?#\\V\350"
+	.ascii	"\200\242\252<G\\\021\267\250*\363\211a\212\233\025\030\205B\312"
+	.ascii	"c\316\n\214A!\241d[D\024\032\211m\022y!U\246h\205k\332\036U!"
+	.ascii	"\241\205\026\231\022\327tD\213T\223#\224EE\244\n\002\r8'\206"
+	.ascii	"\"(\"QT\225AdRm\207,2U\022%C\024\325\021\355\260\204\211\036"
+	.ascii	"\244ZB+BQU\362\244\307!\244\b\307\324Dz\334i\211\251\220PO\273"
+	.ascii	"\246J\024\251\260=\252\255\020\231\\\201\272&\215?(\240\220\001"
+	.ascii	"\251\016IX\223\355pM1$\325vx\002\212\3411=\341Bk\034RS\020\220"
+	.ascii	" Z\323\266\330s\302\211a\n\013\307\224H\024!m\207k\2608\304S"
+	.ascii	"<&\215l\272\032[a\213T\223\3126e\177R\"\265\275I1<\246E\234\364"
+	.ascii	"8\204\034bH\333\341*\354I\205'\030\331\341\032\242\250*/\244"
+	.ascii	"XS\023Ib\272\006O\fS\b[\225H=\n\215\354p%\356\264*\221\272\001"
+	.ascii	"\2425m\325\233\033\201\330crm\221I\242\220\270\006\021\2050\030"
+	.ascii	"\001\004\317\211\3441h\034R\215;E\020\307\341\332\026\245H\033"
+	.ascii	"a\021D\0219,Q\034\246\305\236\"\210b\312\356\350\2647\002\265"
+	.ascii	"E\312\266()$:\241\fb\327\324\204\272\0269\264\302\032vh\210B"
+	.ascii	"R=M\244#\244\355\360\204\234c\222\230l\223\353\b\036dRe\327\324"
+	.ascii	"\004R\004\321\211\021\026\210N\214(\246Dd\n\026\351\201\224-"
+	.ascii	"\n\266I#;B\313\256E\026H\331\"\035\023i1\247E\307\341\007\332"
+	.ascii	"\224\025\0222!=\026E\034\207\255:\244\0263 U\"\234\364\330\266"
+	.ascii	"\311\325\330\242\030\022\341\264"
+	.string	"B\006|h\221j\021ZD\016\211\210\222D\244Jts#PPk\034R\217\001\320I\213\311\022\326\024\205JdsL&- \004\026SvMM\244\253\220]\223m\222Hxb\230\242\347F \342\223\312t\rj\223\3115\b\207\025\016\251B\310d\b\242\264eS\260A\024i\021)\242\250*wNHM\250-qha\250\250DZ\274a\211j\313\252\355\260e\205)\260\303v\307Hl\325\023$\330\344\b\006\244GU(\271\216H\333\341\352\223\0021y$\256\251\211\244\260HI\324I\211T\024R\342p%a\b\251\022\255\" MX\323\023Ie\206V\350\200\026\251\026\325\374\001\017\b\301\301\003\034 \001%\002\265*R\025\022\205\202\210BAHuH\024D\\\331  \ri1I$\\\323cQ15\022\331\340:4\022\365\232\252Bj\213L\213\"\212\3530Yb\347\377\231\006X\365CF\230\033hh"
+	.string	"\243\250-\263\374\262\027\266\"\363S\321\007\354\322\331v?\266\370\314vXT\331\365\235Yr\242\251bC\305\236Z^\016\25633\271\r\3706\003\310Y\031`[\r\327\030\251#2\271N\2531\355X\241G%\211\030?0y@0Uz|{x@\027A\265\025L\364\306"
+	.string	"\361pd\354\261y\271\203\262"
+	.ascii	"\336\222\0161\331\357\f\002\026C\213\035\260O\007\024\333\226"
+	.ascii	"0\372\250f\216\f\222\277:\244\017\316~\214\001s&\341h1\333T|"
+	.ascii	"9]\230\325\235A\343E\367\310\353\241D\005\254\2318O\252\322\242"
+	.ascii	"\272\234Q6So^>\270\354\b:\231\253\263\333r\316\2700v\004\205"
+	.ascii	"\222\250\3631\364qT\254\244\030\020\306\220RJ\025\311l\223\016"
+	.ascii	"S\026@0XL \023\253\253\256\017\023@\304\016\254\2245PC\350h$"
+	.ascii	"I\222"
+	.ascii	"t\0232\273K\324\207@\264\253\226t\247D)\232\234\241e\276tthP"
+	.ascii	"\235\255\r\326;\315^\267\274\322\202\330M\213\003\343\363\345"
+	.ascii	"W\236\241\230\261\223\232,u3\372\204|\220\367\b\013\201\261\377"
+	.ascii	":a\2121\360\333\337nG~\003m@S)\211\013\331\331\315\265\236bZ"
+	.ascii	"\376\025\276\214\342\340\211\253\035`\303:x=\362*\370B3\232\203"
+	.ascii	"\314K\372nv4\372\254\232#,\200\276\3038\304="
+	.string	"@\361M\240\367\306\242\313\261uPL\034\341\317\031\212n\345I\222\227#>\246\022\035u\314K\214\006\263!\213\264\030\025)\205\346])\004K\300\346\213\304SXs\342\016\372\336w\361<\274\270\240+u\260\203\314\270\314C\257>\221\340A\233X^i\226\035A\206\361\250p.G\231\254\017m\3104RLqQ\312S\221\264\026\201\273N\215\300\374|\022\031\037\366e_\250M\022&!\2641\361S-Uc\023H\3542\316\337W\307j\246\2038\250\267'\250\007\206\254\224E\301\033\025\233N\210i\376Z\3711\366\037\274\230\250\214\324\271\3722\223\253T\356W\230\345i\326,\232[\356\020\n\222\211\311\235\357\n\320\312\230\352I\\\204fV]#\b\257\211l\b\225\323\017WW\362\266\242W\035\267l\324\210P\344^ \212\035\371(\202\300\271W\207A\031\037\376CW\317~]\252P\321-\034]\366%\256F\250,\360"
+	.string	"\316c\253#\342\372\314\3113\021(\337\034!.(`z\343\340\243\365\222\030\215\002g\215q#\363\245i\203\201\034\027\220\332\333 \317\316a\363\351\2560m\237\324\210O\342p\001\245\017e\341Sp\f<Hv\033w\326k\370H\216|Fb\352'%\026\241>\177U\264C\035\302\246;\245\203\324\333oq\312\032C)/\r\351\346\276\200\312\031\306$\205\242\252\217:3-\260M\220\200\n\254.\236AO\310O\366\246Bn\245\274\036\310\216\316p\274\267\033\b>\352\361\256\023\310D>\t6:s\246\030\035\224\217gf\234\230\337\337B3\356\335\021\317+\300A\333\320\266\256\0132V\261\327\256\366\033*\250\363\302\243\020\272\007\003\215\216a\312\337q(\270\302\"\020\325)E\257\216\272\371\b\216\374&\242_\267z\2520\352\272\350\342[)\037\225\364\374\232()\261?o\213Z\016\267r\035J\212 \230\3348"
+	.ascii	"EZ\"\355-\247\332\353\027\216z\250\006\3138\317\317\267\277\035"
+	.ascii	"j\351\256 /\237\006\212\317\035\372B\312\017\337\245\372\022"
+	.ascii	"\263r\202\033\377\236\355\024eW\007\311\203X\335O\202\031J\301"
+	.ascii	"\217$\200a\006\303\375$\344\267\026\255\204\305@\377\2055\354"
+	.ascii	"\327x'\253\333@\345\214E~\370\251X<\025hp|$\210\266\353\200\233"
+	.ascii	"F\252,\317-\276\277\353\377\272\362~_w{\246\210}yCR2x6Zj\f\263"
+	.ascii	"\205\240w\035\312v\260H\272\333\363\212g\f}\357\237\320:\341"
+	.ascii	"\362\230\262\034\373y\245\265\243\020\313\271\001\267\355/\224"
+	.ascii	"\2319\020#\\\327\363%\245F\177\376\033\030\t\216\177q\254\242"
+	.ascii	"\374\334\331\303\370\202\342\307\325\007\250\\\274\367\352\353"
+	.ascii	"\357u\353)\356\270@\355R\217-\331x\213\323AVPV\313AAw\247\304"
+	.ascii	"Db0<\240^D\320\n0\224\256A\001\342:d\023\024\366\005n/g\027\024"
+	.ascii	"\366\n\036h\325)\336e\021\221\312H\016\325\337&\241j\337F\025"
+	.ascii	"\bt\242\333O\030\220\030Xr\262\206\240\263\246h\033\0134!$74"
+	.ascii	",\232\034\347\212\343RY\344q\236\256\324N\222"
+	.string	"\302\001\233\332\253\321\263\345x\026\221\205-&\212\n\362\344\034]\366\216\226\304$\365p\356&\006\017.\252D/\332j\222?\371\213\001?_\246S\340B\364\240\232\242 <\013ga\260M\331c\365\035\200\276c\361|\030\326\277\361c\274\334R\307]\334\017-\220\002x&\357\r\2235\265K?2\364\374\222\216s\017\352\205\376\273KC\210?X\273\304\230&\207\004<\302\022f\256[\027\0020r\344\225X\361gr\367n\251\037|\005\311\264\363\357\220\332L\235\200\306\302 nf\362:\206I\b'\366\227\353\361`\036\354e\201\252\\y*w\301\311\227J*\20176\312\037\256\311A\211AA\361\272[O\244\364\020+\003{\002\275l\331\374\274\3356\265\275\026t\002\321(7p\210y\335\034\343L\366\222*dzj\353\242\222h\311-/1\022\3616l\354\302W\246\364\201\317u\320\243\372i\254\240\036@\207Sa"
+	.string	"2,h\220~\266\246\006]?F\335\b\245\030\376\351\320\343\374\220W\\?\003\306\237\237\267\307\020\265+\246f\316\277\001N\"-\361\243\221\275\200{\037\310|2M\200\373\3029\204\n\232\006)b\276n\031\231\373o\031\216y\357\232\027\2702\016%d\250(8.7\235\013\256\3749\216\371\370\331?\260\352\350\224\021\027\332\34503\235\232\"\237\374\rv\004\306\032\023\275\255so@\234\361i\021c\235\334=\313\207\360|\202c\031\306U\346 :b\270\206\235\251\\\222\334\362%\301\335\002F>A\354\312f\025\304\363X\2410\266\250O\212\350\362\"\250K/"
+	.string	"h\037\337z\307\306A\316\331:|~\013\365\f\317t'\201\216O$oB\236\322\375\366\202If\333\337\256\264\262\321S\315\223bVJ\022[\347=h\320X\300t\351\213\001\251\212\020\350\222\377\247\332\321.\2767\376o\354\300\323D\030\202\202\004\204\217\365\204zR2\024\"\300\2122\354\340\251\365\204[4\003\235\331/\301r$L\311-@bq\262\275\225W!$^\f\240\343T\021TGSO\">\307"
+	.string	"\002\342\351\366\316\3218%cB\325i\344\202\017\314\013\344=u\013\312\325\227\001n\222t\361\210AJ\r\334_\375\365s?\367\375LE\370E\022\224\363\356\273!"
+	.string	"\367\310\367\203\b2\355\222/\220\224\fXA$\263\275\227\237\227\017\006\301M\204?\"m\263!\375\360\261\277\256\377\006\275\373Ut%\b(\324\322\305\277\311.M\231\243\370\301\004\001\001\232\242\300\314\326S\272^WBV\304U\336'\230\352_\304\343cs\306\344c\241@\315\275\324@n\315;Gs\264\213n7z\331\366\372\201\013\230\335\345\230\020\231\351@h|\241)cr\215C-y\245\347\227\305\326\022\214\333\367\024\023\257\214QS\244\326\306\356!\253Dv\323\320\f\317,\257l,\004H"
+	.string	"g\214\234\323?\222\006\210k\221\305"
+	.ascii	"n\271\307\201D1\021\275H\t\272\260z\275\21573\274\327\n\323\322"
+	.ascii	"?\020^q\323\275\234te#\372\212\256\3155\2275\357\334e^}\277p"
+	.ascii	"+\256\005\320\310\177w\261j\305\247_\307\316\"\374\326\311\213"
+	.ascii	"\366o9\345QP\310r$\243o\200g\275\235W\354cS\336\247\240\255\377"
+	.ascii	"\006\001\t,\f\265L\214\354\346\301\270\317W\243\332{\351\027"
+	.ascii	"\307\177\251\340\366\301\tK\240\364\304\317\3163\360\276\374"
+	.ascii	"\344\207kH\364J\200\033\345\331|\250{\270\31123\3538\003\222"
+	.ascii	"ti\277\337,a\333\227\376[~Z\346_\3616)\350\2455y\025\324\210"
+	.ascii	"\357\035\017\256cF[H\2143/\003\177<\244\322\312\2462\036\276"
+	.ascii	"\227\240A\022I\333\312^-,\030Z\213o\261U\206\304\2566\225\257"
+	.ascii	"!u\273\333&\272\263\355\\+\240\262@7)o\275\203!\252\021\337\356"
+	.ascii	"\244\215\340.O\323A\331\255\263\201F\215%\017\336\363\246\311"
+	.ascii	"X\177\347\230\322\267\213\177\251XI\325X\354'="
+	.string	"$\2735\026y\370\362C>\275\033\351b\330\335\034\263\020\016\343\234\3665\212\310\3713\022\251\231\333\374\233J\256L\332\213\303N\2007c\340P\370\f@'\006\232\343\325\263\362l\263O\276\362\277D\261\314\322\360\300\360\250\262\224\360H\302\013\363\300\201C\236\360F\300Ew\037\217\254\334\005Y\226]\306\270*\333\377\250\fL\013e\037\nJ4\250\273\007\312\307P=*\253\336\273`\327K\202p\203\222\341_\311\363\317\353\225\022=\377P\374}\244\255W\266I\200\220Xsvm\231\206\254}b\355M\265\022\235\342\036\224\327\230\366\030\032N<\001\031nf\335c\211\203\251\341\301Y\336\373\2124\374\203\002"
+	.string	"\356\226'\221$\f\343[>\227\353\025\230x\374\033\217,PE\254\375&:\225\261\375Q\337\230\200\323\346l\246n4\3735\365\216\350p$\274t6AW\267)A(kNx\356/X-_\250\356\t\261\347\260\003C(4\\\340\361%\031O\nT\217\273\350\237\202hc\201WBBe\017\371\256>\314\201:t\236\342/\250fE\224m\227\022\364\346\343\023\276\213\214Y\"X\255\255\222\326\2407\034\320\323z\276\307\025\323\030IV.\326q\261\264\264\213\370\322\340\032\235b3\"\366\f\200\270n\220\373n\372\322\033\225`X\025\207 w\r\336~e2\272\fZ\340\222\305\231\016\021\361?N"
+	.string	"L\035q\267\327\ft\036\024\355\311\337*\230\235Rl\313\216\313z\356O\364]]\260\005\361\204\301\031G\252"
+	.ascii	"\315\362\0040\027\237k\024p\244\361\3478\256\017@\205}\217\302"
+	.ascii	"\353\303\255\244\316\363\021\305d^\227\b\374\376\360,\221\334"
+	.ascii	"\221\216\302\225\004\267\237\346@E-b=\213\027\216@L\350\023\325"
+	.ascii	"8Y\311\203Ky\003\352O\364)\244\307T\030\207\253\\\344Km\276\245"
+	.ascii	"!\350\250\255\021!Q|\275\025\372n\343t\325\204YS\007\315zyV\371"
+	.ascii	"\355\312\"\334\003W\271\367\201\2650\347\346\002\026\016C\214"
+	.ascii	"\t\211I?\340\301\361\366\034H\233\337\222E\244)-\026\342\376"
+	.ascii	"\271\201\331\037\f\205>\261'E\t\354.\223#\002\356`\271\034Nt"
+	.ascii	"\227\270d\021\t-\357&}\315x\3346tv7\347?\0312\021\346_\201w\373"
+	.ascii	"f\207\276\026\263\254\275k<W-\335\315\362\021\350\326^\346\354"
+	.ascii	":\023d3CYRrc\304\211\305\r\231w\301>\320\322\235\365>'\3045\216"
+	.ascii	"]y\335}\352t\211K[9\024\3107#\232\021o\n\204\245\337\376\f8`"
+	.ascii	"\3317\250\362\207|\257\363\255\240c\241\274\300\342U\211O\313"
+	.ascii	"\254\250\227\342i\262\361\320d\227\274f\276)\242>Zw\202PL?V9"
+	.ascii	"\273\002"
+	.text
+	.section	.gnu.lto_.symtab.16ec5d148e303172,"e",@progbits
+	.string	"processLoopback"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\002"
+	.string	""
+	.string	"init"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\002"
+	.string	""
+	.string	"systemState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \002"
+	.string	""
+	.string	"switchStates"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\002"
+	.string	""
+	.string	"inputSource_e"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\002"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\002"
+	.string	""
+	.string	"specialColors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\002"
+	.string	""
+	.string	"modeColors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\002"
+	.string	""
+	.string	"colors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\002"
+	.string	""
+	.string	"srxlDisplayPort"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\030"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\002"
+	.string	""
+	.string	"pCurrentDisplay"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\002"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\002"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\002"
+	.string	""
+	.string	"serialPinConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\002"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\002"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\002"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\002"
+	.string	""
+	.string	"boardAlignment_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\001"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\002"
+	.string	""
+	.string	"servoConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\001"
+	.string	""
+	.string	"pinioConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\001"
+	.string	""
+	.string	"pinioBoxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\001"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\001"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\002"
+	.string	""
+	.string	"fcTasksInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\002"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\002"
+	.string	""
+	.string	"pwmEnableMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\002"
+	.string	""
+	.string	"latchActiveFeatures"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\002"
+	.string	""
+	.string	"rcdeviceInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\002"
+	.string	""
+	.string	"batteryInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\002"
+	.string	""
+	.string	"timerStart"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\002"
+	.string	""
+	.string	"baroSetCalibrationCycles"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\002"
+	.string	""
+	.string	"gyroStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\002"
+	.string	""
+	.string	"accSetCalibrationCycles"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\002"
+	.string	""
+	.string	"blackboxInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\002"
+	.string	""
+	.string	"telemetryInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\002"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\002"
+	.string	""
+	.string	"navigationInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\002"
+	.string	""
+	.string	"gpsInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\002"
+	.string	""
+	.string	"rxInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\002"
+	.string	""
+	.string	"failsafeInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\002"
+	.string	""
+	.string	"cliInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\002"
+	.string	""
+	.string	"mspSerialInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\002"
+	.string	""
+	.string	"mspInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\002"
+	.string	""
+	.string	"imuInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\002"
+	.string	""
+	.string	"delay"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\002"
+	.string	""
+	.string	"getBeeperOffMask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\002"
+	.string	""
+	.string	"pinioBoxInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\002"
+	.string	""
+	.string	"pinioInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\002"
+	.string	""
+	.string	"servosFilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\002"
+	.string	""
+	.string	"servoDevInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\002"
+	.string	""
+	.string	"isMixerUsingServos"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\002"
+	.string	""
+	.string	"servoConfigureOutput"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\002"
+	.string	""
+	.string	"servosInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\002"
+	.string	""
+	.string	"accInitFilters"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\002"
+	.string	""
+	.string	"pidInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\002"
+	.string	""
+	.string	"validateAndFixGyroConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\002"
+	.string	""
+	.string	"indicateFailure"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\002"
+	.string	""
+	.string	"sensorsAutodetect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\002"
+	.string	""
+	.string	"initBoardAlignment"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\002"
+	.string	""
+	.string	"motorDevInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\003"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\003"
+	.string	""
+	.string	"featureClear"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\003"
+	.string	""
+	.string	"mixerConfigureOutput"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\003"
+	.string	""
+	.string	"mixerInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\003"
+	.string	""
+	.string	"serialInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\003"
+	.string	""
+	.string	"uartPinConfigure"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \003"
+	.string	""
+	.string	"timerInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\003"
+	.string	""
+	.string	"resetEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\003"
+	.string	""
+	.string	"readEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\003"
+	.string	""
+	.string	"ensureEEPROMContainsValidData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\003"
+	.string	""
+	.string	"initEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\003"
+	.string	""
+	.string	"IOInitGlobal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\003"
+	.string	""
+	.string	"systemInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\003"
+	.string	""
+	.string	"printfSupportInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.16ec5d148e303172,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1529 @@
+	.file	"fc_rc.c"
+	.section	.gnu.lto_.profile.50bcaf1194e120d4,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.text
+	.section	.gnu.lto_.icf.50bcaf1194e120d4,"e",@progbits
+	.string	"(\265/\375`>\002\315\f"
+	.string	"\262\317:8@uZ\003\344?B_\245a\274r\213\025\335^G\250D\216\006V\214.\214f6V\215(\212\242k\030\351\335mG`\276.j\"\"$\324\204\354\275\345\226ro\231\244\f\261s\201\341\013\342\201NIZ\210\321C\341\360\346\261b\202\323\260}\035$\027\032\f\013\n\t\232J\365L-Q\327\323\362\323\367\356nZ\232\354\335un\217\307\211\020\313Ol\004\341\340\333(A\231\031\264\n\356W\253\327K\227\356w\t\013\266\200|\f\bL\352\023V\350\004\260"
+	.ascii	"\366f\240M\320J\345q\234\334\270\2448\230\035\221\034\024i\371"
+	.ascii	"J\224\"s\305L\245;\272\212B\333\277\277Y!\036XL\310HTi\347\002"
+	.ascii	"\303\327\266=\347so\357\356\272\335\316]\227\313\351t{\256='"
+	.ascii	"\030\311hT2&W\003\364\002{y<\316y2\026\341Ll\305\031\021[\250"
+	.ascii	"!*)\231)I\n\205\346`\002b\212\310<\021\220I!$J\262l\007\312\320"
+	.ascii	"[d&\035\n,]\234\"+\302e\377ez\204\360`\241\346\300\202\235\363"
+	.ascii	"\247\235\3140\223\034\020F\023\245\331\257\330\271\2172^CG\007"
+	.ascii	"\335\301g,i8\255\003d\314F{\335l\032\2619\317\361z\311\234\366"
+	.ascii	"8x\353e\255>\334\347?\241\246\231O\025{F\327y\324\357\263> d"
+	.ascii	"\227\201\244\265\\\033v\232.=\222D\321\314\365s7n@\243w\340\227"
+	.ascii	"\201\301\202\350\237s=\021K]\2326?\261\037\243\207\315_V\235"
+	.ascii	"\357\253\324n\211\362 \017"
+	.text
+	.section	.gnu.lto_.ipa_sra.50bcaf1194e120d4,"e",@progbits
+	.string	"(\265/\375 \242e\002"
+	.string	"d\002\226"
+	.string	"\016"
+	.string	"\003"
+	.string	"\003\002\003\001\001"
+	.string	""
+	.string	"\017\001\023"
+	.string	"\030\003\031\032\033"
+	.string	"\003\035"
+	.string	"$"
+	.string	"*"
+	.string	"\001+"
+	.string	"\003,"
+	.string	"\001"
+	.string	"\020"
+	.ascii	" \001\310\2073\263\025\222\335\005I\r\002\343\252\f\246\034\213"
+	.ascii	"\331\r\346\022,N\300\212eJ\f\"\201\001\026"
+	.text
+	.section	.gnu.lto_.inline.50bcaf1194e120d4,"e",@progbits
+	.string	"(\265/\375`\325\002u\r"
+	.string	"6\022A80\257\322\030\"\235\355\364\224\006q<g\";\320%8[;\233\356D\232R\255u\215\254\022\n\360\276\254\314R0&\t\247!\205\314\023\2777o\376\231\bo&\177o\271S+"
+	.string	"2"
+	.string	"6"
+	.ascii	"\373\020\273f\322j>\017\345\276\341RJ\251\367&\t2\222\322r\310"
+	.ascii	"\374\240\215\361\377l\334\337\263q\271<\355K\306\"\"z\316\262"
+	.ascii	"\026U\376\035\200\371,\355\tJ,\343a\315\245\275\251\310Z8\024"
+	.ascii	"8\223\\h\376\337n\374\346}+q\222,\233\205\356\332RsH\267RJ\017"
+	.ascii	"\346.M\237\003.3\215X\202\222\035\263\230\212H7\b\345\374\003"
+	.ascii	"}H\373\2252{\006\253\216$\344ea\337\250\273\225\204;\002r\260"
+	.ascii	"n6\242RJ\031\n6\036q\224\256F\023\f\006\273\274W\311\013\030"
+	.ascii	"m\327\240\222\0300\332\016a\2058\372\303\271\037E\003\223\345"
+	.ascii	"}j'b.\230\365Hm\216\003\367\021m\207\300\0327\373\001-\357Q\373"
+	.ascii	"\nG\250a-C\310\3044j\235\335P\0021\250\354n\022\340\3644\305"
+	.ascii	"\263\3120e,nb-\263\336\003\220\216\363\202~\246\202m\232[\333"
+	.ascii	":\201\006\336\253!\366,\205q1{\212\324\2477\277\3574Qn\272n\347"
+	.ascii	"\273\3433?5\274a>\306\310x\177\f\377\022\024%\237\357\213$\264"
+	.ascii	"l\352\020\203]\025\215\3400\330\267\214\273\326\200\004\025\007"
+	.ascii	"z\200\220\270\020\256x\215\210\243\314l\222\300(\350\344\177"
+	.ascii	"\035G\302\264\221\202E\235h\224K\036\030\325\371\364\023G\231"
+	.ascii	")\245[t\334\344\t5\254\r\033\343\004\225G\034o\336W\300\335\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.50bcaf1194e120d4,"e",@progbits
+	.string	"(\265/\375`\034\001\335\006"
+	.ascii	"2J\037#\240)\035?\252q,\341C\374\377{\377\212\257\252\202\245"
+	.ascii	"\tC\333\242\362^$v\023\325\264\031\333N\356\224Rm\021-\324\036"
+	.ascii	"\nq\304\216\343\210\375\236\214\n\245P\356\204\035\323N\211\335"
+	.ascii	"m\334}\2755X\362\337\256\252*\242\027\354O\030\362\275\376<\216"
+	.ascii	"\234\2665L[\006u\317=3\330/\361k\377x\317Q\370\t\001\227M\343"
+	.ascii	"T\343\344\266\211\254=\227\275\316<\233\347\362T\330^\005\364"
+	.ascii	"\202' P\0021\312Z\017\030\250\360\305A\361\360\332\220\310\030"
+	.ascii	")\223[\333\222\343\206\223A\367\216\324p]0\366\001\177%P\025"
+	.ascii	"0f(\362\231D\214l\347\022k\372>\303\262^\023\0361>\007\325\270"
+	.ascii	"r\020\351\030\315Z\227pR`\3023\367\006\211.\f/\021\004\001\234"
+	.ascii	"h\005riw\b"
+	.text
+	.section	.gnu.lto_.pureconst.50bcaf1194e120d4,"e",@progbits
+	.string	"(\265/\375 /y\001"
+	.string	"+"
+	.string	""
+	.string	""
+	.string	"\016"
+	.ascii	"\205\004\002\205\004\003\230\004\017\231\004\023\230\004\030"
+	.ascii	"\204\004\031\204\004\032\204\004\033\204\004\035\230\004$\231"
+	.ascii	"\004*\230\004+\204\004,\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.50bcaf1194e120d4,"e",@progbits
+	.string	"(\265/\375`\351"
+	.string	"u\006"
+	.string	"R\311\032\"\260\245\225\003\f;4I\3225\f\203\027b\2555\333\335k\2677AH\023!PM\220o\333\266\223L\001\252\253\236\325R\272\t\222\224`\201#\030\330\t\004\354\250\347\264\264\301\211\236\321O3\242X\036\263$v\r\341"
+	.ascii	";\346\311@\273\346\331\330)OeD-\030\354\360<\235\335\362dL=^"
+	.ascii	"\354~\376jb%Vr\035*\356 ( 0\002\"@\330\365\004*\204l\223@\001"
+	.ascii	"\2671\366\2676H\246\312\254\255\235b\201\326\f\325\002\"!8>\330"
+	.ascii	"Jq\257\374\0066\275\321\204\225\234c\273\307l\375\314Py\201\376"
+	.ascii	"q\033\345y9n\267\003\321\272K\330\225\024\f\020\232n\205\001"
+	.ascii	"\325\363V\356\330\360q\333\177a\325\037\330BX\024\327\r"
+	.text
+	.section	.gnu.lto_.lto.50bcaf1194e120d4,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_getSetpointRate.64.50bcaf1194e120d4,"e",@progbits
+	.string	"(\265/\375`#"
+	.string	"\305\007"
+	.string	"RO66@\217\322\001@\265\220\342>"
+	.string	"{MYJ\177\262'\021\260\306\365\357\361\217\352\2671T\243\206\206\236\254\261\233etg\272\346K\321\033\312\251$\344\375\243m\262eJ\001!\020\205\347j\326\3116\206\354\023\263O|"
+	.string	"y\034b\266\205b\207\240\032D\303\026#4m\213\230\352\276\376N\357mH\317\242\302$]e\376'\324\"\036\221\250=\f;!Jw\206\265\350iX\244l\265\252Q>\216\326\327\377\367\235\332\314>\247\354\274\002T\nV\376\214\326\313S \353\243-\327b\351TQ\252\3717P'\377\021\312\311\030\266\255Q\006\341\332\325\302\005\206\341R*i\371\0377\036\300\030^\026\300\030\276\016sN\256v\210\rJ,\235i\344\004P\370\337\354L\032\356s[N\333\203\266&\001\n"
+	.ascii	"2\241\233/p+\n\034\026oa\002\002\230\342\022KT`\001P\031;\355"
+	.ascii	"|\002"
+	.text
+	.section	.gnu.lto_getRcDeflection.65.50bcaf1194e120d4,"e",@progbits
+	.string	"(\265/\375`'"
+	.string	"\315\007"
+	.string	"\222\21765`o\032\003\024B\021/\274\215S\264\335f\253\327\210\357Z\263-\020>\254\017!9\216;h\227\321\247q\367 H"
+	.string	"B]\213\216)\357\341&jdK)eJ\001!\220\204'\366\352\\\231\302\365\231\327g6\200<\f\363\312B\263#P\314a!\233\017\030\226\315\rw\307C\023\204\034\022\244\2300I\273\314\177\204Z\304#\020\365\311\262\021\242\347\315\262\026A\215\212\364V-7z\220\243u\374\377BS\373^\241S\366\213V\306\312@\367_\254^\256\"U\037m\265v\363\234*J5\377\006\352\344\377A\t2\226mk\224A\264\266\213\234\307\311,\026\025%.\377'\307\001\226e4\200e\t;\254\371i\265C\034[4R\266\322\310\017\223\360\277o+a\270\320m\013\332\032\2645\t\n"
+	.ascii	"2\241\241/p+\n\036\026\317a\002\n\230\342\022KT`\003P\031M\355"
+	.ascii	"|\002"
+	.text
+	.section	.gnu.lto_getRcDeflectionAbs.66.50bcaf1194e120d4,"e",@progbits
+	.string	"(\265/\375`'"
+	.string	"\305\007"
+	.string	"R\31754`o\032\003T&D\354\244\005\252\022e\331\3061i7\3251\340\261\3658\332Z\216\343\016\332e\364i\334=\b\022\200P\327\242c\312{\270\211f\267\224R\246\024!\320\204'\326\352X\330\202\365\231\326g:\200<\r\323\302B\2633\320\353\201\001\233\020\327\205\315\rw\307C\023\204\034\022\254\240\260IQ\231\377\t5\211K\"\352\223e%D\317\232e-\202\232\024\351u-7z\220\243u<4\265\357\025z\263_\254@X\b^~\214.\346+2\365\3216k7\317[U\252\3717\266\224\377\b-\310X\266\255C,\222\265\250\310y\234\334raq\002\363\177r,PYF\007T\226\260\303\231_V{\304\321E\243\323J#?"
+	.string	"\205\377}Z)\303\205nk\320\366\240-J\013"
+	.string	"2\241\241/p+\n\036\026\317a\002r\r/b\302\271\204\021\025n"
+	.ascii	"*\217\251\235d"
+	.text
+	.section	.gnu.lto_getThrottlePIDAttenuation.67.50bcaf1194e120d4,"e",@progbits
+	.string	"(\265/\375 \363\235\006"
+	.string	"\322L.3@o\222\016\230\016\013|\260\r\200\370\231=b\312\204\002\220\221x\317!'d\254]\357u\\\001O\b\222,\303\350\242\306\025(h\005&\364\270\332H#[\246\277\314\253\022\236\306=\215s`Php\257\202p\031\202\251\207\205\312EPT\345.W\226}\220a8l\342K\322k\321\005-q\b\333i\273\207\2466d\001\027\034\034\375\265A\266\361\225\222}\2768\262\t$\245\340$\263b\324\222(\315\304\343\267\376rC*b\275H\272:@U\311\240(a\311L\207\351\300\324&U`jc\034\265\212\326\355H\245\017\214\225\216gS\004@\310\314\261\343\261\350\254\377\301o\360k\004\b"
+	.ascii	"2\003\346:\203i\b\3055q7\002k!2qWL\355$\003"
+	.text
+	.section	.gnu.lto_applyBetaflightRates.70.50bcaf1194e120d4,"e",@progbits
+	.string	"(\265/\375`\340\006\245&"
+	.string	"\252D"
+	.string	"\017I\220\\Q:$\323\250?\264\036\021T[\212-\244Z\002\004\321o4\216t\253e\226d\246\036\204:\245\314\246\217\264rX\331@a\373\007{[J\230\374V[\301\365Z'\032\2646$\002X3\321u\272f\t!\204\020\271\223\f\335"
+	.string	"\307"
+	.string	"\334"
+	.ascii	"W+\264\f=\244)\230a\207\302\267\212\262b\351\307\222\r\351M\313"
+	.ascii	"\254\304\177\362*\206Q\261\221\006\2242\304\340\204\215\251\013"
+	.ascii	"&\240u\214\021y\357ep\223+t\223\025e\317]\372\341p`\213l\314"
+	.ascii	"r\346x\357%\342\005\267W\322"
+	.string	"\202\325{}`\035\357\005\022\261-\275\311\314\374#G\242\304l,\213\302\250\217A\022|\362\346\336{\243=v\336,\377s\336\354 W:\354\245\246\350i\226m\225\370\350\204\032\0235Sf\254\232\\\034&\344cF\216\277^/\210\004\207p|\314\300q\365FZ.x\342B\343b\230\234\312X\230\037i~\274\020\221\t\207E\3050\345\b\332\323\306\315\365\205-i\274y\232\200%\355\336\373\252\333\245\246\237\265\350\204{/[\030M3\316:g\346,f\3661\2377\rb\352\f\320v]8\026\035\221\360\336\033\201Y\304\257\220H\357\275\017\264X\224\260\t\243P\2347m\023\t\311z\326\253\240\340G\361\216g\017\203w\336|\253=\276H9\371l\222\271\370\263\r\305\374\3626\020f\333\257\316\t\254\345\332\220\020\r\301\233\374\007\036\345<{\3617p%\177\201;9\007\235\352,{\361<\300Z\006\262\226c\326\262"
+	.string	"k\371\007\265\034\340\264\354c-\367X\313"
+	.string	"\254e\036ky\007\265\254sZ\206Y\313/kY\265\226Sk\031\265\226Ok\331\264\226K\324r\237\226\255i\371\nP$a\n\254\271WF2\316\005cf\021\371\325\037\345w\362S\275d>\177\312\217\3140Nq#\027m\335{\261\002%\255e\275\224\345>et\r\266p'\343\323\260\2464R==$\353\001\335\323\177\322\221\\\211\277\223\326"
+	.string	"Z\250\355\223\365\351g\223[T\332\200Iy\032@\267\326-i\315c:\351X\263\016\177fC\361\255\256\016\245b4\202\346\322\032\350\001\275\304\314Pzd1\212Ly\001\332\256\235\246\365\273\254D\235\336i\224kE\302Z\247\037\234\343\263\311.:\b\271s)\332\202\365\253N\024\246\f\234\254\362\325i#h[f}R\373\3253\255\225\310\306[\265gr\326\341\254\321N\233"
+	.ascii	"\227\201>\033\355\362\352lY\227\003}\240\315\376\025\035U+\361"
+	.ascii	"g\374\0174M\212\227%$\223l\200\367\372je\317\332r\255\304\237"
+	.ascii	"Mrw\3312\256\025i\273\373V7\343\344H\006\347\330{\257\213\326"
+	.ascii	"\2356<\242\biD\022nw;\342\355v\274\034\201\036/)\2073\352\351"
+	.ascii	"N\240\320\300;\241Bg\346z\247.\t\227AgB\304\021NE\002Aa\307("
+	.ascii	"\304\021n\267\343U\310\365^H$T\340J\316\025\345z\037rF\267\234"
+	.ascii	"\321\355\210\004nw\313\365\220nE@\314;\241\353\335\222x\274\336"
+	.ascii	"\rV\364\275\274\r\204\217u5\352\310\220\227\255MH\3159\207:("
+	.ascii	"(E\0369\302A\372\372\007k(\346\340F\005j\016W\322\037\257\362"
+	.ascii	"\320\032\272\221\201\326\022\364P\333\272\303\016,\265\0046*"
+	.ascii	"i\246\314Pmy5\024[IbD\2506\020f\266\265X\317j\024\231\342\002"
+	.ascii	"\264]\027v!\217iCQ\361\374x\353TC\270cjL\f\250M.\001\035\353"
+	.ascii	"\377\264\200~\200\376\351\2406+\322g\223\354\323\001\372X\267"
+	.ascii	"\220\265\303\030\234\343CyHy1\205\332\204\224\222\177\250a$\005"
+	.ascii	"\221B\206\231\022\031\031Ia\n\351\200\002\03192z\021@)e\210h"
+	.ascii	"\206IQ\322\001\335\001\242\n\341\222\310\340\255,\255\205\f|"
+	.ascii	"\266\274\204\344\364\323\204\247\324B\334a6\226)\023\302\n\311"
+	.ascii	"\361\021\2640P.L\n\231Nt]Y\276\217\312\r\323}\020\201A\253\304"
+	.ascii	"A\222 \3211\251\347\237\221\003\226\355\"W\0306\303\311 \036"
+	.ascii	"m\317'|\0213\217u\215\b\215\247'A\213\035\033_H\357\367E\315"
+	.ascii	"\277-\013D\342\021\266N\f&\340\304i\212\343\373?\305 \357?\210"
+	.ascii	"C0\201m\265\364\246D\234\033&6\206,5\030\304V\370\264\350\355"
+	.ascii	"s\372a-b\036\272\201\341\037#\356\360N\001\221\362~\373\b\026"
+	.ascii	"\213\371\356[%\020\\\006W\253\\\320K\225\007\273\247\302\333"
+	.ascii	"\305\351\223\016zv\240\363\021\342\213W\366H*p8\333\365N\325"
+	.ascii	"\317L\205z\320\001\\\321\274\327\224\222K\374\2229\353 \336\001"
+	.ascii	"j\006eI^\336\360\345,\371n;0\025"
+	.text
+	.section	.gnu.lto_applyRaceFlightRates.71.50bcaf1194e120d4,"e",@progbits
+	.string	"(\265/\375`\362\002\255\024"
+	.string	"\026'\207F\320\224\321ph\263\005i\215\006A\261U\263f\274\210:\035\341\322\374j\237\215 E\202\333\003\255`\333[\304\216\332;\035\267\260\321\rDs\002[\031:3d2)n#\247S\305b\206aV\354\3116\273\367\2262\245q"
+	.string	"b"
+	.string	"{"
+	.ascii	"9\276\317-\333E\376\251tH\314xMD\236vW\301E\277(\321\2070\266"
+	.ascii	"\"vN0\310\236\177?\204$\355n\213\023<?\024\302\253\335\025<\222"
+	.ascii	"vyZ|@u\321\266_"
+	.string	"\3436r\354_\330\003\nz\223S\217O\311\356\326\n\\6^\f\017`\274\250/\236\363\314\361\357{8#\305\221\317\217\31635aw\235>?%n\275m\004\266+\330z\023\343\305+\354\006T\224\211]\006\355\236N\252\013\373\341\356\256\265\205M;\321\277\362\242[\345\275{\366\336/\373\320\037 \323)\231F\311t,\32301\375\312\264+\323'c\272%\246Y\231^eZ\225\351T\246\307L\213\231\016\307\264\212\351\f\323\027\2202\022\204\300owDp\3112\211\300\030/\372\355\333\016\332\002\306\274\310\t\367\036\020X\272\340\007I\024p\267\322\231\246O\245+U$\036\n\026C\210z\022\202\301#)U\351yB\243\206\232\022\332\371\335\311\263\2733 \352\250,P<\0312\225\251\250\003\220xB;\031\264j\250\264%\336S\252\352{\232\3542x\341;bn\004\264\273\017l\231\353\330\240\332\335\0069@\314D"
+	.ascii	"\n\302\031/\246\336\b\006\360G\307\201\343\0079W\223\367\251"
+	.ascii	"\t\270\033\233\005\034\207\030\032\333\312&\003\005\027\214\006"
+	.ascii	"\032\333\314L\356\345\246c\331\310x\260\205\276\271\334t\030"
+	.ascii	"n0\265\033L\215F\3066S\273\351lj.3\347:\340t\265\233\\NWk\365"
+	.ascii	"\3666M_=E\230v\272c\025MQ\232\236\t\212\246h\350\213)\212\262"
+	.ascii	"\254(Lc:\372^\n\323Q\211\367\344#\346@nW\272\322K\035\374$\241"
+	.ascii	"\001\334\251P\271TE\2774\323\023u\351[z\2424\037+4 \240\002\231"
+	.ascii	"\262\352\006d/\024\026\3710>\nn\330pC\367\005]$\303\321\222\223"
+	.ascii	"\r~\007\357\t3\330W$\334\312Jl\034\245a8\232av\256\326\304\003"
+	.ascii	"\276\312\224\345rd\356\b\264\230\210\320\235\201\021\024\310"
+	.ascii	"/X\265\253\330\025\366v~n\013Y=\3242\302\325\225\023%BB\340\036"
+	.ascii	"Ph\003:\210\330\316!V\3303\254 \2025\036\0070\240\360\313cj\027"
+	.ascii	"\031"
+	.text
+	.section	.gnu.lto_calculateSetpointRate.72.50bcaf1194e120d4,"e",@progbits
+	.string	"(\265/\375`\003\n\2750"
+	.string	":S(\022E`^R\0077c\302\031\223\030\301e\305\262\342q\310X\016\025\\\335\233\334T\236\272\363\0075\362\304R\236\300<l\\\277q\026\304\330`k|\013/\302\207\f\315\006\314^\377\352\3011(\210/\262\265\275\367N)\245\f\001\370"
+	.ascii	"\031\001\354\356\334\021|Ya\216\310\334[cj\347\302\255mF\372"
+	.ascii	"\254{JwY\267Y\253\314\335h\2356\005kG\2063\246\034tBGa\366yC"
+	.ascii	"i)\373\314x\r\351\352w\235\312:\261\2462^\333Ye\t\227r\316\271"
+	.ascii	"{o\202^yi\327+3\2673w\223v\202l2vc\336\275]kW\356\275C>\260\353"
+	.ascii	"\025\251\203l\257j\003\331^\031\311\274\246\313\240\267\005R"
+	.ascii	"\207)e\316\275\227\370B\032\331A!`\020\320\357\307\247\207\307"
+	.ascii	"\327\343\355ZvU\337\221\334\322\3465\265\254:\330R\350\262\001"
+	.ascii	"\326B\235$\322@\2600\017\372j\240\257!\376\203\366\017\324\207"
+	.ascii	"\373puO\\\026W\017\347\341\321>\036;\274\247\243y:\242Y9|G\240"
+	.ascii	"\313\306V\267qY[>-\246\263K_\323\232@\\\026\021\025\351\336\213"
+	.ascii	"\345\352\215~u\211\253\313\r\037\255+5\030\006H\232\226\266;"
+	.ascii	"\265\224\356-\205{/{S\313F\263\260\231\233\311\314\036\230yF"
+	.ascii	"\001\315%\204\210\021#\330^\377W\263\2631 _z\245Oz\366\037>\322"
+	.ascii	"\362\255\230\373\255\265\300\340\016c\023\305\"\333\253\377\352"
+	.ascii	"F\n\335\326\222\033\257\t\241Y\214-m\245h\024\272\255\245\357"
+	.ascii	"(\215!\nE[\316Q\3726^\023*s\245\331\236PDE\261\275\266VS\272"
+	.ascii	"\255\265V\316\330\001wy\302t:wuo\262@\277\322\267\227eT\351\323"
+	.ascii	"h\253\361\332\356\336\013\201\233JWI\301\035\326+KQy7{\345\246"
+	.ascii	"b{\355\347iM\307\332\222>e.S\372?\231[\275\357\305\334\344\240"
+	.ascii	"\001\023\003\342\320\235\227Xg\004m\326\254\324d\335IG}\326l"
+	.ascii	"\324S\232\213\272\254y\300\352L\264:\013p\347\241\3259\200;\003"
+	.ascii	"X\235\205\356\034l\235\205Zg\240;\007\265\316@\255\363\317\235"
+	.ascii	"\177Zg\237\326\271gu\346qg_;\367\332\231\267:\357\334\271e\235"
+	.ascii	"\327\325YU\235\377=tz\r\236\304\027\030\336?\271\341\260\254"
+	.ascii	"i\031|\f,d,\361\213\336\311\364D8\204\024\375\3203\275\204/\264"
+	.ascii	"\245\230r\367\317 \006\277b\210\234\245\2302\201\031\232\226"
+	.ascii	"\366\237\304'\272\361F\372\305\347\211\337w\230ul]e\314\221\034"
+	.ascii	"U\306\034\371A\347\252\347}\276\227Q\236\357yV\212\222v\3434"
+	.ascii	",\303\214\034\3536H&I\320{\357\0036=\207t\202|R\241\002\333+"
+	.ascii	"OT\215\216,\351\005\340\207\236\215\243Dr\357\375\371\036\300"
+	.ascii	"\263/\341\364\336\367/\267\234\253\362\342}\357Y\267%\327\356"
+	.ascii	"y\337\314\272\244O\311\364\031\247]\2316c"
+	.string	"\341\002\006\fl\257\273\357\264N\320\246\306oX5\304\330\177\2627\273\261I\377A\332\357\275V\253\022\213\340[\332%\244g\324\333J\354\372\b\236\235\271\245\354\270\026\243a\003\007\016l\257\353\267]hc[\252\372pNM\320/\r\246\303\007\020 \232n\206\257~\253\266\374\222\364iw\221&\027\334\377\223w\035\202\375\207\222\232\271r:\314\275%.\212\"\252\246\236\216\307\026\306\236\213\242\210#\325\361\370\264\203:1U\224\222\242\262`<\366\236\252\212\036\236T\240\230*\362XD\275(\252l\\`<\2320B\021\215P\304\251\250\242\024\321xdA\\ d\252\025OGb\025\025\325\221\350+K\366{q\02362u\370ao\\\300\246\357&ld\353\360\007\274s\203\026\\\362\225\034\364,\257\361tD\235\003\2336\335$\205\355\007\351\340\204\003\276\r\022-pg\263\351\211\204\376\t\224\023$\340]\006\363\350\005"
+	.string	"\275\371\005\030:\326\325\320\007xV\356\347\237<m6>\302gf\005\236t\"\272U\321\013\277\265\200\275\025Q\271\203\326\223\326\274%nu>\007\317j\317\350\217\336i\240\b\007\032\251\031\241oz\367\002|\240\027zW\263\024\013z\340U\217>\350\337m\031U\326\375\036\350{\031\375\371_\327i;\274\206L\302V\274\233l\205\355\365\347}f]x\034\374R\235%\227o\211\033\031\257\301\307p\243\261cz\243w2\263\321\023\341P\"\355r\345\001\200\313\250q0&\021C\210\206FAARRH\007\260\002\021!#\326\001\021"
+	.ascii	"\255u\250\206\244)H\241\325QX*\016b\022\033\0306\364I\017<\220"
+	.ascii	"J\036\022\262\313I\371\t\206\033\217\003\247\312~B\322\004\311"
+	.ascii	"s!\326(?\252\341\\\307\342\t}3E.\343\017r\324*}\351q\232\026"
+	.ascii	"2\255\364\357\023\nUa\335#\314\f\021\204W\031\216o\317\263\371"
+	.ascii	"\255\306\377x\373\336\340\b~\263\t(\315h\355\250\216\326\024"
+	.ascii	"\024\332(\264Z\026\363\030CK\021\222\244[J\203\333\307-\030\316"
+	.ascii	"\243\0312^6\350\341c\344\257\371\363\317\035\220\211\272\214"
+	.ascii	"\300\336\3370f\242\276\317\336\205fI\023\322X\0370\314_\360\201"
+	.ascii	"\345jG\177p;\031\267\245\215\007\325\263\225O\363m\236\344\267"
+	.ascii	"\ns\300\236(\232\212\345\203\"0\216<\204A\021f\227\t\275\375"
+	.ascii	"(0,\3771(\022\200{O/z[\327\375\263\032\313\n\341\234\013\277"
+	.ascii	"\b\315\031\303\372U\031\213\004\271\347H \003\332\t\203\260+"
+	.ascii	"L\3172\345\200\201\207\273\020\021pB\024/\376^y\025\250c5\300"
+	.ascii	"\250<\370\371\361n\375n\036\037#dO\345Tq\245\313\246\334\204"
+	.ascii	"A[\020H\253\\\352\214\354.r\031\361\223-\037\033\221\265\004"
+	.ascii	"\263T\217\021\005\275\310%\250)\207\tI\326\273a\tmC\370\203%"
+	.ascii	"\363\377\370\312\177!\326\3250%\243\267\322\031\247\005\363?"
+	.ascii	"uC\2057\365\276\260|\363EO\321\363\037"
+	.text
+	.section	.gnu.lto_scaleRcCommandToFpvCamAngle.73.50bcaf1194e120d4,"e",@progbits
+	.string	"(\265/\375`\025\004\365\030"
+	.string	"vn\235F\260\032Q:\270\232F\001v\303OMm\320\357\332\232X\254\375\374\316O\374y\320\341\357\254\022\317\261\264Y\303*\017\335\\\235\247\237\0369?;\017\245\266\177\350\254\330;\024\3329\200)\372Z\274\006\325Z#\233H\231R\210"
+	.string	"x"
+	.string	"\220"
+	.string	"~N\210\344I\201\2439S\364\276\314\235\324\351\370\355\307}U\365*\355\377\307\205\034\342\234s\325R\323D\211\243\240\001\246K\277\307}\354\374\346\234\211G\005K\214Be\313\234\223\300\245\005\230.]\277\001/\277\257\300K\357\330Y\216\2531K@Dz\206\272\3149_K\343;\377Vw\374\013\3754\372\360\374c\361\375\\Lv=(\237\332\327\372\201\301\273\320\325\204\017M\265\304`\316i\035}V\334\362\266\033\3306`\177-\0025\365b_\310\207T\360o\230\304\205\013\340\245n"
+	.string	"\033.\214\341C\031Ls\326\020\370@\036d\203\177\343\3221\017\372\361\322\367"
+	.string	"^~C\335\025\336m\246=\033G\323\005\262\377\315\375\261\177\273]\307\335-\251\306\221j\226T\337H\265\215T\257\244Z%\3255R\235\222j\032\251FI\365\214T\313Hu\b\252c>\365I\252MR]\222j\020TK\251\376\244z?\265~\032>\002^\272vmI<t3\355\025\370\022\347Z5\346\234\t\374$W\362"
+	.string	"B\204\b\340ek\327\246\205\247\373f\220\2100\221~\224Y[\302L\27021\033\2366f\337\023Fg\344\264\341\214,<n\246\365\211\236sn\204\211Ld4\"\245\264\264\266\016L?\232\326U[\036;w\024`N\304\230^\320\353q\251\3159\313\001\267\264\027m4\355Y.\270\212E\334\"\367;p\034\365\204\371\022\271\n\034E#\322\275\310\350\r\331\005\322\375R"
+	.string	"R%\0324\304d_\b\035\021k\330\001\230l\002\314\302\013f\341\305\001\203\316\206\027L\366\341u\200\345X\207\n\262\027\210XL\366\nq\263\177s\177\354\240h7[\232\277\275bE\005f\367\303\331e\255\315\342\354\026\021_\320R\313\332\222\221hC\255\315>(G\221h\273\331)\316\331H\271\320WC#\322\354g\2657\013r\241i\217\267\233\223U\233s\226\243\332\325Z\305\244\232\245Y\325\356\0211\310\265\251\255\201\222Z\0056Z\213Z\232\035j\303\031I\274&w\342\034"
+	.string	"*F\372G\250Q(\346\024R\210\261\241\244\260$-\264\030\240\002\021\2619;\021@-c\214\211\220*I=\032\003\323i\223\334\250\330\321V?\333T\375\202\336\006\030Qw\r\004\236\253\201\005'A\367#\027\360b$\230t\242\337\320V\206\b\035\354\334\355\364\007C1e"
+	.string	"\265\265A\363\027\246\225!\227e9^\254p\273\323\272L\2374\245\257\242\233(\256rS\311\350\267\335\227\207\353\352]\205\237\322\f\007?{\242\310\350^"
+	.ascii	"\265\324\024\340:g\213\t\341DB\212\274MT\004}*\024\001\267 \227"
+	.ascii	"$\224\312\235\323&S\036\372\007"
+	.text
+	.section	.gnu.lto_checkForThrottleErrorResetState.74.50bcaf1194e120d4,"e",@progbits
+	.string	"(\265/\375`\210\005\205!"
+	.string	"\266}\323I\220XN:E\362\211\361\032\275P\307\245\021\372\017F\215\366\254\336\323\332\2107 \222\325\2330\214\016\352g\373\237\032\237}+\217\313\332?\365\340\2770\017\376\2409J\022D\2209\300-_}\016\305\330\236l#\204\020\"\245L\001\272"
+	.string	"\254"
+	.string	"\303"
+	.ascii	"l2\371\357\277`\033\266J\376\364&\026\354g\216\343\220Zk\272"
+	.ascii	"\345o\342O\267\344E\262\306\247I\326\013j\277P\240QTh\330\225"
+	.ascii	"4\016\320-udQ\005Z\307Pb\026\027j\265V\003[>\001\312\374\257"
+	.ascii	"\221=\002\265]+^\326\212\303\313X\255E\004\037B\267\274Y\036"
+	.ascii	"sK^\035s\313C\375^\266\270\243\236We\246\214ej\255\273\306Z\250"
+	.ascii	"\275\331\320\323,\311f\250\357id#VE\355M\310v\032\345\200Ac\321"
+	.ascii	"*T3\204\200PY\361)c\315\251!\2271\226\274U\305\330\316UI\221"
+	.ascii	"\272Z\353\032\227[T\t\231O\243Z\353\231X\005c\237\356\177\254"
+	.ascii	"\377$\3762D\353\301\374\223x\274\304\3565n\212\003M\315\214\232"
+	.ascii	"TG}\007\327\253dI.\036cA\260\300\306\004\365\255\354\315L\356"
+	.ascii	"'-2\333A\275i\246\326\202|\374\251e\t\230\001z{\273\264\276\f"
+	.ascii	"\271\204|\374\213B\356\253\177\311Zk}\353 \332\342~\250\371B"
+	.ascii	"\315\327\355\327>h\273v\0034\037(\345\377\244|\037\346\367\240"
+	.ascii	"|\236\033\177\207\371:8~N\312\307I\37175|\033\346\347\230\217"
+	.ascii	"\253\341\3270?e\376-\345\333P>z\343\237(\337D\371\345\215O\332"
+	.ascii	"\370\315|F\371[ \307Ee'V\353\213#\232\232V\222imq\367k\317aD"
+	.ascii	"\254N\003\253\245\305\030\313\2141\373\352L\352z\263\320\326"
+	.ascii	"Z\250\201\272\005\256\323\376\261\321\303\013\255\246\377\213"
+	.ascii	"X"
+	.string	",\023\004\354\260\262W(\2248:2m]\323\245q8%\355*K\fs\353\264wxC\210\266i7sz\331\313\314-oMT\264g\027c\360\215\262R,\374\027\220x\211H\346\226\266\306m}\231!\013\362\221,\321\3265\237M\255\005\2414\241O\316f&L\232-\324;\265v`\3136\233\317\206k\302gX\263\025h\255u\301\267\354\304\0064k\204\271e\331\266\256\257\223%\033\361\315:\207\016\274\304-\277\035z\245\360\260\n\362q\271\326\032\325}u\237\331\275>\274\266H\361\231\343\260\256\006_*rZzJ\362\355\230~>\337\217\007\300\351\310\006D\257\327\204\004\202)\311\347\373=\340\001s\275\247$\fKN=\240R\017C\n \356\274\"\036\320\003Oi\307S\3321\205H\362\355x@\247]Q\317\177M=\340\356\351\367\003\356\322bp\311\332:*\024I\013\266\360\267\213-\347\204\244Iu\224M"
+	.string	"\377\364\377"
+	.string	"\002/\361\272\213\255\220E\215\264\372\006\307\243\027\251Z\203\003|\372\247w\b\244\247}z\233\f\325x\272\247W\302\202\321\300\363e\247m\266\230\230\261B\373\352D\255\323\037\274\244"
+	.ascii	"\265N\257q\331\306YN\023\ruN\357\222\215\020\206H\330\360\fN"
+	.ascii	"\017M\271i[\343\364\016\177\330\364M\237\306\241\332\207\355"
+	.ascii	"2\001\345b\3236\262-\271V\260\025k\250a<\344\fC\210\221H0\222"
+	.ascii	"\244$-\034\200\002\0311\263\016\020XV3%\351\307\004\t@W\307."
+	.ascii	"\314\200\3113<J\354\212\232\024\243dBY\305A\275\230\027<\345"
+	.ascii	"N\307\32270\366?\247\370\350\021\355\240\215\305\220\212o\344"
+	.ascii	"\2175<\375\317<P\360\026^\021\253\243\214\315\020$\365\001p\222"
+	.ascii	"d\002G\006Q\204\335E y\007\213\025\220@\237\315\034z?\004\312"
+	.ascii	"K\350\257\b\253\004\264\252\251\330\3733\275>0\363b\006[\260"
+	.ascii	"\230\037bT\233N\0303\233\340\005\3236Ha\333\334D\345\302\357"
+	.ascii	"0%\271br\302I\027\035\320\241\0231\324\230\005uS4\035I4R#\247"
+	.ascii	"\007d\257\036xDc\236\367\326^;\317\272t\004G\371\233\234:\277"
+	.ascii	"\037\020\377\240\r(E\361\251Z\354\0233R\260Q\374\007"
+	.text
+	.section	.gnu.lto_processRcCommand.75.50bcaf1194e120d4,"e",@progbits
+	.string	"(\265/\375`e\021uV"
+	.ascii	"Z\217\204\037P0\222\322\031\016\265\"\0054\256\006*r\254f\004"
+	.ascii	".\372z0\264\033\216\210PB5rC#\305\215\t\022\320\020\023\253O"
+	.ascii	"\034?.\326lJw\342\276\273l\317\025'\3070\307\330\366\335\301"
+	.ascii	"X\303Aa\350\2002\2612\313\272\211\210\210\220\275\267\224I\006"
+	.ascii	"\343\001\272\001\351\001\034\344}\216+\311s\203\006\006\333\272"
+	.ascii	"\202\320\007g\255C\341\310\336\374\333~\263_\355\277r \3778e"
+	.ascii	"\224\203\273\277\227f\333\226\261\n\200\\v\207{,{\267\035\356"
+	.ascii	"\265|\213\372\266\225\003Z-\201nl=\344\255\353j\003x\324\350"
+	.ascii	"|\f\317\262;\334\r\216e\203X_\206Gw7\330\035\036=\177v\030\276"
+	.ascii	"\266\303+@\332\360\316\b8\332\323\324\253\005\001\256^\200Zl"
+	.ascii	"h+\200Gs\216L\217\362y\322\243\233\202\205z3!\300U\312\217\r"
+	.ascii	","
+	.string	"-o]\325\232\216\256\022\360\250\231\253\205\255gk\242\025\203\233u]\237\032\254\233\250g\317\237j_\343\251~\204R\022\222\210#\243\020EDCBA@ ~|\220=<K;:9Gc\2218\024\006\201\277\024=\233\325=#\301[\303k\333\262\372\210.W\352\302\205\223\336\2164e\351\306\"\336\332\370\350v\313\267-l\244\345!N&-'\362-\215\213\316\034\264\023\205\031\023\235}\310\313\017\020\033C\343u\344\354BV\036d\245\n\003\275\375\310n\371\006\202\312iT\306?Lv\237(G\222=\341\036\024\216@9\317\257\240|\351\f\352\n\203\344v\313(\247\022\016N\3124yGg\3549\247\212\016\3340\271\335r\354$\276\321\032\023\306\307\223x\267\302\222\333-\233\234*\224\274\335\335\255\0046\242p\244\353\305\237\f\267/\365\240\202\327\221\256\023\247,\231\360P\3544:\232\262$\201\205G\301\237\r*"
+	.string	"\1772\326~V1\3133\333\363:\262\344\277{-\271\204[Z)rL\356\311\036y-\225tj\267L\3414Z\3275\311h\222\237\303\255,\356\223)O\0066\306\255\016N$\bQ\224_;\023\331\302b\376\311X\327uY\271u\344K\342\273\315\263\273\352\256\221-k\246\315p\255\253\325\273\226\225\253\026\030)\253\tk\tbs\204\272,\346[\2711\271\261\024H\n,;\336\035\260{\214\rh| \351\257g4\317%\273\260\270\317\312s"
+	.string	"\002\\\327\254\026{\034n\247\236\355\241\034]5m\200\001\322\243\277.\306\321\355\241\241E\234\366\256\001\b\360\225k\204v\332\327\342\243C\273\343\302\354\355\264\2751;\2339\303\317\256\022\342\335\004\024\340+\3176vAS\207\325V\333\275\007\363\033\202P\321\240\241L\303\242\273\277\366\245\034\276\254\341\261\361\375vX\321,z9\311\346LL\370\312\245\334+\372Y~V\021\363R\366%\213\036\026\367\355\017\237o \335u\340\001\276\222;\311\210\230\272\254\266\202\n{s\246\233\271<\322\267\005kd\262\370\315\356\341\036\307c\017e!\210\200\257\214 =\372\006*\201J\327\031\327\025\367\355\252aq3w\3771\271\261\270\355\257]\034\315;\201\220\367\206\004o\373\332\250\301"
+	.string	"\215!\357\002\277\362\235\321\274\001\274\371\215\361\266/\214\233}_\334\354\013u\265\257\213 o\013!/\013!\357\212!\257\212 o\n\"/"
+	.ascii	"F^\024G\336'#\257\023\221\367\204\220\327\204\220\267)\310\313"
+	.ascii	"t\344-q\344%q\344]\022\362\2160\362*\031y\223tx\221txE\030y\217"
+	.ascii	"\214\274F9\274!\216\274EB^\"!\357\220\221W(\2077\350\310\013"
+	.ascii	"D\344\005!\344\3759\362\372\034y\221G\336\236#/\317\221w\307"
+	.ascii	"\310\253S\344\315)\362\036\213\274\306 oq\310K$\362\016\207\274"
+	.ascii	"B\"/\220\310\373\023\362\246C^4\310{\016y[\310\033K\035\204\203"
+	.ascii	"\352\021\375\245\026<-\276oQ!\315\b\317S@!\273[\352/\025,U\352"
+	.ascii	"\2525\272,~s\202R\007\307\304\260\223\324M\220:\251\373\372~"
+	.ascii	"#\025\321H\375\243\026\301\344\250\203q}e\\j\353\272\352\030"
+	.ascii	"\235\340%JB\264QQ\207\350'\351\210\272\250[\207d^\r\037j\242"
+	.ascii	"\376\371\220\254r\032>\324JM5uB-\202\n\366\023\206\204\223\250"
+	.ascii	"[!\250I\222\004\265P\267\234\026\337\n\006\352]U\211JBzeP\363"
+	.ascii	"\326\022\250\177kp\312\340\316\260/mr\232\271\277\013IA\364\275"
+	.ascii	"\326x\340\017\270\210\220\022\324&M\322\243 Vh\263\307ul\346"
+	.ascii	"\252 S\264\321(\031b\323a4\021\030\375\323\005\320\315\350\237"
+	.ascii	"F\327\234\214\334\030\234\321\304a\264\215N\315\320\304$\273"
+	.ascii	"|Z\271M\242\035<\360q\372\240L\203\354\236\366\351\2408I0:\215"
+	.ascii	"l!.\311<\236\336\351\236\376\315%\245`i%5P\231<\375.bpJ\316\332"
+	.ascii	"&p]W\250\345+\306ROp\2422\231\351\321\235\276\333O\204\300\246"
+	.ascii	"\f\356\212"
+	.string	"\373:\254\250\323\373>^U\260\fT1\261\234\326\351s\215\026\337\261\215\235\323OV9\234\307Q\237\250)\250d*Yz\364\330A\027m\354\207Ak\022\037$u\321/\23289\223\334\230\334\260\231{\275\037\350\2025:H\022H\243_f\217\356\307@\273h\"\305\256\332+v\307\351\225-\361\256\272\202\332\002_Y\243\213\232V\316\303\211\315\026\352\202\315Tsb\323\350'\247\f\233\330=\367\302\331\254\0316\345P\246\f\315\314W\0060H*l\006\272\323\b\273\350\344n\217\353\252\207\037\271\352\2548\316\020\0254c~\315<\263\317[3\215WC\263r]\313\354}X3@>Qz\364M\312\272\256%\310\354\006\253\303\311\207\216\037Q<\236zP\361\340A%\025\344c\007\007Q\247\324\317G\017\252\035?\242.\240\302\240j\352G\217\035\310\251\037Q5t\370\230\252\3121U\203\203\252\342\005S=zD\351("
+	.ascii	"\307\324\217(\034\030h`\\)'\251*\n\244r<I\345x\352\261#\212\307"
+	.ascii	"\223T\225\217''\237\245\302`\252\352\351\007\025U\325\323P\355"
+	.ascii	"\352\375\205*\311\333\313\273j\254\021\315\204Cg\270s\243\247"
+	.ascii	"\324\314m\321\026\260\227\026HH\356hH:\200w\207\254\031\322\306"
+	.ascii	"\030\267\225\302)\302\006i)]\340EPP\373R\252\242\027\350e-.0"
+	.ascii	"\354\026d\310\036\r\025}<1\026\221\2429\r\001\\\364!q\322\335"
+	.ascii	"!}\252\025_\231\242\237fBV[\235\251+\f\222\243\035\016@Wa1\033"
+	.ascii	"g\001\240Q=1{hF(\234\030\213\n\206\\{j\024\315k`\330&0\215\325"
+	.ascii	"\324\016\264T\017<H\217>u\020\313\334\036\234S\273\300g*\030"
+	.ascii	"\322\254\212S\243c\346\232\256\260\325\020\302\310Ot\025\225"
+	.ascii	"\023Jza\366\270\212\232\271G2C8\032\035\023jz\214\030m\242\013"
+	.ascii	"\020\023@\233\3503\316I\024\243q\364\341\264}Iv\301\340\030E"
+	.ascii	"T\020\356\3457\0027\327\253\206\365^\327\325j\250\231\313@\037"
+	.ascii	"s\016\232\240\003h\"{\n\335\350\tv\342h\3615\365\215~R\357E7"
+	.ascii	"\365\271\234\243\314\0055s\377v&\373j\363u]W\240f\262\224\277"
+	.ascii	"\350\023_j@\254\035\250\327\206\317\207\245|\317\036\250~\301"
+	.ascii	"\304,0u#\351R\306%\367\263n\302\336\234\361a\257O\t~\275\271"
+	.ascii	"\321\273\342>d3\327\305\033\036\t:\270di\211\314h\250n\273\265"
+	.ascii	"0\377a\316\214\232\236f\256\220\024\252%\350\224OK\224m\022\205"
+	.ascii	"\245p\027\264\234"
+	.ascii	")\321O\266\231\0246F\242\227\272D\247\\\222]Xa\333\004\202\221"
+	.ascii	"h\001\304\340\256\2460\363+\201l\250\241(D\021S\250DD$I\nRi\f"
+	.ascii	"\021\005\304 \007%\304\036\02105d\316F\223\2441\232\272\317:"
+	.ascii	"\0343Qs\263"
+	.string	"i:\005i\255\344\035\324\366p\357\265\013{\272m\336\"\2438\2743I\013\332\364\261\026\374?\202\321\265\375\206\020\250\323\326\321<f9\353\211\346N\007\214qJyW\335\374\234\234\2240\244\230\314P\356\2410r\355<\203\376I\310.\025\252\2356\206\344\340\241x\344\241\237\006J\262Bx\344\304\203\341\241\335xd\377\207C&\251\347\223HZw*\271\244\204\025\242V{\225\244\244\b,\330V\034\360\231.\350B\226h\323,\366\230Y\370\222t\244I\022\360T\224(u\273\037DQIDG\203\220Y\250\346\212\251=\327\002}\320\251\232x//TeXe\244\257\3077\024\362\245\211\254B\352\322\302U\271\351)\324\377\024\271l\200B\231w\007\374\245L\273\324&\237\371\322\0020f\256\374rK\337\005\264`<R\345\013\314\027c\323\3279\r\016\214):\323\211\270\346/\013\247`Z#\241m13\022:\202\246"
+	.ascii	"\017\357\231QN\2010\343wF\315%\274,\273\037\005\343\300<\r\207"
+	.ascii	"\004\314\237pT>m\215\016-\243E\213\3422])&\305\023,_]\303g\241"
+	.ascii	"\354 a\331.DGS\016\231(9\275\372d\037\r\026\226"
+	.string	"\036\241\333J\374+\033?\002\322leO\353s-^\302\277gBa<WY@\260\257\335b\351\365\020\261\r\210\277\324\345\276\365\034\036\346Z<<\036v\033\373\267> \237\267EMh\302%c0A\3258\374\367\305\217\311@Xh}&\370\263\363`$\340\035\007rsD,k\006\334\246o\t\225\025\261\220\022#\217\375P\235\335\273\301\314\005\3553\232\016\030\230\341\320\021\362WKl@4FI\332\327\345\205~K\246t \230E\263\3517I\3523\016'n\025\032\305&O#r0>\253\013j\302[h\263\322x\334\300\247\017:2m\331&.7\321n\307Yv\217\347!t`\2758\013\003\367\250J\254\016N\274QL\f\241\260\243C\363?\320u\301\177z\235`\342\215\332\261\263 2LCI}\265\217\340[\323\001f]\036~\351\026\032\210;\004\315\362\325s*\257v\272uYo\315\252\327\024\365*"
+	.ascii	"\2571\013\240*\340p\\\rX1\330\377\022\2506X\345\344\320\255\235"
+	.ascii	"EY\3463\311\035t\206\340\341 d#\0016??\355\256^\252\337c\260"
+	.ascii	"\005\330\217\242\244\2560\342\213\357\334B8%\204\016\363 \214"
+	.ascii	"\031\032\344\305w\324\036\235@\324=V-\232\240(|y\023\262\350"
+	.ascii	"0W\240b'\3716;\222#\345\251\250\227f`_\004l\237\314\376C\263"
+	.ascii	"2\323\246QJ\267\315\257\312\217\377"
+	.text
+	.section	.gnu.lto_updateRcCommands.76.50bcaf1194e120d4,"e",@progbits
+	.string	"(\265/\375`\351\033\355w"
+	.string	"z\304\250*J \224\322\031\016H\2338*\234\236Slc9\026\323\301\t\324\034X\243\275\207'$\300*\360\270\330\270\002\f``\270\264\340\327\004\277\207\251\277\b\323\255\216o\353\363\257\203H\266&E\245\244\242*\246P\331F\221\270\333\215H\231d\200\002d\002\253\002\274\002\b\361\0060\304\373b\210\027"
+	.string	"\225\367j\210\327j\210\327\205\312\333B\345\255Jy\251T\336)\"/\013\225WJ\345]Q\344\215\022\342Uq\344M!\304\213B\345\205Jy\237\216\274NF\336\023F\336&#/\223\312\273t\344URy\223\212\274&\214\274H*\357Q\221\327(\210\267H\345-A\344%\241\362\022\245\274CF^!#\357Q\345\r*\362\032U\336\242\312KTy\201T^U\345M\213\274C\225WH\344\r\002\361\266\312\313)\357of"
+	.string	"\033\322\320\330\336\364\036\334\272$\332g\225#\264\343r\272\017\371n\376\273\037\372\333\375u\177\232\277\371\303\235\270\373-\276\001l\363\364\005\207\002\257\315\2300l\240H\352\2608\373d\360\260_\263E\273\205Z\001T\023CU\263[\254\333?\267\210\206\255\317\036\207\275s\213i\026\252C\240"
+	.string	"\252\016G\263[\334$\307a\235\264\004\221d\367s\247\333\237\331\242\231$\n\307ael\221\2226f]\327\342\205\273(\354\315l\021\205\313\251\360\364\005\267\222m\340D\316\030@+\365\302\364e\036\267E\270\025\236\276\206\326/\2668mS\352\205\3731'\223|s\005\265kL=\203\205\255o]\327\252\0137J\275\360\351F\303\013\203/1\274p\223\273w\016we\275\016n\302\346"
+	.string	"\327u\275j+\333\017\302}\2158\371*\252)\026R+\242T\244@\001\365\344t\242\211iI)\311\004\322\221QQ\t\022DCB\307 c\221\b\244\246Ca\2609\271Oi"
+	.ascii	"1\311\272^\005\347T\301'8ox\212\205\233K\265y\362\212\340\023"
+	.ascii	"\234C\345\215\301\251\343(\025)\215\024iv`\024\316C9u\340'49"
+	.ascii	"\260\223\263\f\237p6\271\211)n\f/\211\271R\220*-N\331\363\306"
+	.ascii	"\336\202Fs\324\354\034\215\030N\"s\023d\272\214\205a\244 U\037"
+	.ascii	"\017\177\317\033s\013\032-\331\302|\034\027>\n\016m\t\002\340"
+	.ascii	"l\302FU\230hyQ\226\227\310\202\205I\020\261}\350\n\033\013E\371"
+	.ascii	"1J\032\007\321p#\332\213ych\301\247.cO\230\030<\266\375\240|"
+	.ascii	"\336\030\224\340\213\247\024?\177\036\252\313\230\023\006R\241"
+	.ascii	"\322\224\306\024&g\037\206-Yx/-\017\022\311\312\336G2\260\340"
+	.ascii	"\323\272\256\217;\213\221)\231S\032\353\272.3\311\230|[|\267"
+	.ascii	"\323\335\025a7i+\3750}5\3478xK?\345\227>\230\276\301\267\004"
+	.ascii	",\321D\375/=cn\331F\242K$\305\234O\222\214\272\256_0\366\200"
+	.ascii	"\017L\226Y\240F\215\341\205$:xG\2479\324D\213t\362?=C\3755\027"
+	.ascii	"\222\231\371\343f\327\353\272v\001\365\332\036\n]\372\265\317"
+	.ascii	"\006eK\t-\266+\324F\004\347\230y\2748\252F\004\016p3\242Q\277"
+	.ascii	"c\013\365\227]J\350c?\255n\317\262\317\213\243jP\377\316\277"
+	.ascii	"\032;\250\337g\354 \033\376\322bo\020\357j&6P\027{\n\272|\023"
+	.ascii	"R\363\205\016\211M\005]\266\251\2356P'9\227]\224\034U{\211o\331"
+	.ascii	"\246\344\350\016;\355\206:p;\020\f[\250\007=n\315a\257\255\320"
+	.ascii	"\3639\206o4+V\344\360\276\230\217\260\327\226\273\352w^\r\214"
+	.ascii	"\222\246V]F\213\355\203\317/\177\255\253W\212\375\336\207\330"
+	.ascii	"\247\215\255\3433\267nx!\320\027\036@\300\205[\327\265{m\205"
+	.ascii	"\315\375C.\316\027\363\331`\013'\270\336\r\030\373 N\260@\315"
+	.ascii	"\222\325@\315\317y^\326>\313b\200\003\307\360\302n\030t\316\336"
+	.ascii	"\334\017\373\343\305Q\253\377\220C]\3275\306\036\357>p\260\317"
+	.ascii	"r\341z\260\203\317\3341\274\360\355T\305/\215\214\235\027Gw\341"
+	.ascii	"\224\334k\273\377\332Tv/\027"
+	.string	"W\2469\346b\336\334\302\200\271\335\367_\210x\217\205\206C\277g;\335\367T\324~\367\375\024(w\363=\332Y\031\fcK^\270\030S\t\013*\357\303\300\210\274Wv\035\356\373U\345M\242\362\232\360\346\027\t\327\353\276G\266\016\367-\301\310k\204\310\253e\344-b\344\3152\362\022QyIPyG0\362\0161\362\n!\362\0061\362\002QyEPy\261R\336\037*\257\217\2247\004\"\336\036*/\bD^\036*\357\007)\357\016#\257\016#\257\007F\336\016T^\016T\336\rR\336\034*\257\006)/\016\"\336\fT^\f\210\274\027\250\274\026\244\274\025\030yo\030y)8\362N`\344\225@\345\265\241\362F\220\362B\240\362>\220\362:@\304\333\200\312[\203\310\313\200\312\273@\312K\303\310;\303\310\253\300\2217\201\"/\002O\363\225q\344=\340\310k\200\2217\206\312[\200\312\013\243\310K\200\020\357"
+	.string	"\307iq\3751\035\304[\322\217\353\023s\3137\345\331\227t:\267\354\242d\241\225\364,\333X\350\246\271\260?J\330p\0300}'\035;\257\227\265\222s\231FC#\351\237\265\020\272LK\242\321\320C\265>\226\323\355\256\360\205m\310\241va/I%bI\027\\P\3534\356\316\315\316\213\243H\372T\372g\036U\003\033\345\036]WS\001\375\027\304\032F\027@@\303hKz\211\201\200\276\032\240\365\300\300\005\366)\273\213\251\n\234\025\246^[\034_\224\222"
+	.string	"IY3&\3043IL"
+	.string	"-I+N\004\350\250"
+	.ascii	"\372\350\357E_\254\317\007@[\365\213N\371\226oW\r@\237\357Wm"
+	.ascii	"\202o\331\306b\350\242\255z\250\247E\273\230\352C\351\026Rzx"
+	.ascii	"\312=\2726\345RU'\211\341\\\353\224zm\253\320\234\317\312\344"
+	.ascii	"4Y\003\204\017T]\305v\205\252\235\350\330\261\350\251\276\237"
+	.ascii	"%\\\205\327Xt\0204\016t\216\232\235\244^\273s\251>\f\315\316"
+	.ascii	"\345\333X\257h\251f?\313.Q\275\202\214\325\222^\276D\365\225"
+	.ascii	"\212fb\203\027\004\370\204\317D\212\336\202\201\245$\255p\224"
+	.ascii	"\344[\322\314\307\360\302\024\035\305\326\034\200w\223M\222O"
+	.ascii	"\370L\024}\364F\216\262\273\366\2043\022\372c\301\2677{\313\264"
+	.ascii	"t\210\021\232\204\036\376\361\035\252G\350\345\245\337SC\365"
+	.ascii	"\375\260\023n\362\324\251\036h\240\035\222\330\235\372\207\\"
+	.ascii	"\235\027\374\264>\031e\270\233\234!\251\306g:\365\343\376\026"
+	.ascii	"\330@\345|u\327\0369?U\247\350r\275\301\240\214\336j1\027\177"
+	.ascii	"\377\203F-\276\325\227\353;/D{>\227iJ\216r\321\t\263\262\346"
+	.ascii	"k\352\023\335~\226y\230\311>U\262\246.\232\325\005\332\275\004"
+	.ascii	"S\026#H\fY\035\350\215P\213\233\300\304.\360\222\027\370\013"
+	.ascii	"]j\246n\276e\237\t\315\325K\375\030\334\334\005\211z\215\207"
+	.ascii	"\232\312\336\3132\250\206;\307\213i\256\026;\326P\251\371\313"
+	.ascii	"\0323\223V\224(\265\320\232\323M(IL\353h\263\247\212\t\024%\307"
+	.ascii	"$\023\235\304\306a\2744\321E3\272\300\346\262\241\362\306$\250"
+	.ascii	"\206\030\210U\377\rQ\376\024_\246\217 5\177\355\023\351\n{\261"
+	.ascii	"2\211EK\222\013\027f\236#\215\324)\264\371a\331g<*\323:\236\321"
+	.ascii	"e\233\362e|y{\212\017\323G\375)rq\214\372\250\006^\223^\376<"
+	.ascii	"\232\274!\t&\351\226t\033^h\324\305\262\250["
+	.string	"\223\331\340\314\341!\366\332\362\201\f\213zK\256\316V\027\365\237\017\372=\361\204\375i?0\001+\304\352\210\020.\037YWE\264\262\262\264\260\224\266\200\020\361\201\205\003\b\021..\255-!\\\307\023z\360\221!'\370\b\006`$\213+hDk\313H\320H\026W/\226\025\326V\017\254 WXA\256\212\f\361\221u\205\265u\344\312\352h\265\214"
+	.ascii	"\331\272\342\322\322\332\272*\302y\275\251\354\233"
+	.string	"'r\274ZYe\244\253\364\232\0363\217\332>\325)F\272\370e\316\255I\325T\363|]\253\337l)Z]\3743\023xV\244\323\240@\2378)\322\305\030\314\2705\263\272\317\366itE\2066\333gYV\027\301\242\201\315\016\370q\232\t\022O]W\2573\311\220< \327\360\231k\274\3633\225\302\205}6\265\220B\377\204\001dA\004\332\314}6)\351\260^\022\351\"\230\0377;\251\277\037\214\321\270\3545\330\220\273V\266\227\213^\243C\032h\256\217\233\235\220\336E\272a?\373D\272\302Gp\037$\234#H<<'3\217W\013\016\004\024\322\207\363\251\271=\201v+\244\206W\366\343\256\346\311\325\201\273\3240H_\331\313ag\313F\260\337\215\037\220s\346\f/\fb\364\327\344\314+\nH\021}\"4\020\254\006\241E\370\321X>\372h?Bh\037=:\004v\276\007\217\006\201\317\016\217\0162\363\373"
+	.ascii	"mG\177\240\243wx\320:\206\330\363\240\221[\372\350\375\315\245"
+	.ascii	"\364\340Q\321\001\020y\034t\007\0334\006\315A\216\336@\203\376"
+	.ascii	"\224\0348Z\203\f\032G:\304y\f3\270\2401\360\001\357\202\0162"
+	.ascii	"\273c\301\224\n\332\202\033]\001\005}\303M\033\n"
+	.string	"\032\271\305N\032\031\273c\r\227{`(\026\022\b\244\036R\257\315\245\364\360\205\361\023\252\021!\227b\0026\363\t\372q\177\331\235\027\024\022\360\260\317&56Z\202\016\362-\373\"\350\032m\243S'\004\035\001\005\374@\237\215\016\222\b>\023\002\007\372\201N\361\032h\007\204\324\234\307\260\201^\2022\32058\r\357\300@\007\231\355\2715m0?\371\002\275\213\304\203,\202\255\237\300\272ki\364\0023\232\206\017^\034\345S\244@\317hS\236\331\247J\247@\237\315\257\364\204\b\264\353\346\362\b\250\004\372S\344\352<\300MG\352\031\356\"\367 \003\371\314\004\272\350\256\t\361\314\035\330S\322\313\020\201\336\222\243\363\305|\216\3408.\303pH?\310h\262\253kx!\002\235\352\351\005:\035\260\n\200%\303\370\314\003Z\305\235\331O\364\332\"\271\241\016i\rL\035\323_h$`\266,\255\335p\307\304ah$-f"
+	.string	"\313p\003\332xg\026\243\305\354S\350\355n\035\303,\b\345\036]\237\333\230\267\3762\202>\250\322"
+	.ascii	"%S\242\322)T#2\222$)\2441\342\n\020\f\242a\236\306\262\003\022"
+	.ascii	"@5)G\243\222!\242\021%\323f\311\027u\236\003\274\371\031!\326"
+	.ascii	"\022bMz\005\005\300\342\330\321\374\364\007\006\250_D\357\221"
+	.ascii	"<\250\026\322'\367\272\342\247\016'$\355 \312\346\207t\355X\034"
+	.ascii	"\321\236\\\250\207-n\002\360\333-\207\376\244"
+	.string	"\016/z\212\270\222q\220cf5\306\267N\356\024j]\343:|T\317\256\207|u\346\037\334\026\236\250\266!\323ar\202\366\344\305\020\362\264\364\231\211\r\221\210\256}PIu\310V\321?p0\035Oa\201\321\036[\217n\365\262g\246\316\fF\264\356\367\232\305\226\\B$\003a\252R\241\270\334GqQ1\232\210\331j\255\343\3569\354r|\f\3776\206]\217\352\372\333\340a\352\351\356\344@n\271v\214o\201Hw\262\244k`\211o\261y\231\205\222\225\365>\273\"\342@\304\214>\202hP~\"\024T\251\302\027t\311\261\177|\005G\332\223\221^\203\205\360\325\r\276>\257\033\025A`\f00\210i\311\306D\371\240\006)o\350]\231K,\237\222r\"\017\251\200\213\234hz\234\332\246\024D\206\316\035\224\342KqD!\310\210Em\271o\3106p\360\315;\026\235\316\321\261\263\t\227\216\177\221X5\326"
+	.ascii	"\021w\304\337\266h\265\357\214\371G\b\354\2306\375@;l\335_\225"
+	.ascii	"\335~\211\220\207\232i`g_\267\023nX\344\177\344R\221\254O\212"
+	.ascii	"\243\324\233|\b'\317\345$\332\217d\210'\212_\334#]\220\227@\202"
+	.ascii	"}\332\232_)\025#\n\201c\345\240M\372\275\\\203B\341\200\363\315"
+	.ascii	"Ok\rI\323\263\034\210\212\344\336bpv\210\345\324d\320r\371\205"
+	.ascii	"\353\360J\202\006"
+	.string	")jr6\021b\204\007!\206\026~{\t\213s\b\310\017W\343\317\331\003\037\035\227\310a\352\315\2448Q\376\016V\346\367DFT\214g\344\243[\300w\301\220\263\374[\236qh\214\3412F\230\037X\226_\376,\362\f\363\301\212u\277]Y\215\245{LG\267\243}\223\272\346\361\352\325\327U\272\026|\327\233\272\231(i3\233\353\233\361\004\276X\252\013\343\241\376\343\324A\331\202\303d\270\233B).|\323\215\216;\246\352\311\257\323os\332\0044\205\252X\236FE\005\346#\b\245\027\237\3250\346ns.c\017\004\b\301\214\016\215\013\311\343\263\373ZZ\336_\313\222\370\223P\r\345\362?+\307\361\034)\322b\306\204\001B\207nC\226\350o\241\312\022\351\344tI\333I\001\254\274\n\024\265\024\376^\240o\362\335\022\365\267\376\376\017_\210$\\\313\024\351\005\354K?6\205\341\217\215*j\357Nj\217\274W"
+	.string	"@QEXD\020\222\302\032\355\237\240\205R5\272\335\003i\013\025c\t\024\347\245\204\032\2728\205\2549\347\237U\255\345u"
+	.string	"\263\223[E`\201\244\247\254O)\240]"
+	.string	"\223\216M`\377\002\236\213\006\301\225"
+	.ascii	"\346\377\360A\n%\361\3506=\032\021l\001U\203f\024\201\335v\004"
+	.ascii	"\206\361\212B\013\003\260\363\253ce\316\341)O#\313!\221\310J"
+	.ascii	"\334\300\332\262\354\221\244&,%\t\367\247\220_\221Y\266\212%"
+	.ascii	"\035\331\246O\016q\352r\b:G\3738\253\201\264\315H\332D4\234\214"
+	.ascii	"\322nUZ\310}v\215\350\3707\243i\201\n<\032=\211\367\330j\344"
+	.ascii	"8,F\233\376@r]\016\360\223\250\210\272\305\357n\267\004M\364"
+	.ascii	"\264d\035\274\025\2068\023\212P\033R\033\030\276\240!\216^\226"
+	.ascii	"\021\226\364\304y\235\340T\243N\331\021$\035\211\241\317\220"
+	.ascii	"o\257*\032F\271k\335\016\305\263\333\377\221\341\203\306\013"
+	.ascii	"\230iK\b\007\365\204\332\25535\230x\033\350\326M \341\340\374"
+	.ascii	"\254\023\034\242mNu\346\305:F\277\3667\204\233Q\366~\312\020"
+	.ascii	"\250mU\037r?\233\360a\214#=\021\307\305\035R\253\205r\331\001"
+	.ascii	"\356w\021q\3641Q\227G|\272g\350\273\035M\232?\033_\244\202V\310"
+	.ascii	"v\013\032\343y\360\220\356\316\246\250P\2064\273\365`\220\204"
+	.ascii	"\366\016hC\372\330zcZ"
+	.text
+	.section	.gnu.lto_resetYawAxis.77.50bcaf1194e120d4,"e",@progbits
+	.string	"(\265/\375`4"
+	.string	"\235\007"
+	.string	"\302\21524pm\032\003\240\326.\376\345^h\311E\263\340"
+	.string	"O\314P\f\232:vxw\225\264U@\360\372\200\227\021F\312\025"
+	.string	"\bI\270\375\344\0237\301\237\266\345\2262\245\235\231\211%L\215\234\032\331\260Q`\220\023\343\310\314@/\207\005L>\\\027&/\333]\035\216\0206N 8Q*'\200\022b\021\016D\247\243b\342\340\332>\214\207\267r\001\244\377\006\365\207A\"j\f\307Jx\2365\307\332c9>\367\304r\214#%]\007z\251v\373<h\321\272:\034\265\025\201\006jC\362\207R+?E\223\214\266\2764kS\274\221nS\210\242\324\375\227\360\302\231_V\273\303"
+	.string	"\232\350\343g9\370\337\247\211*\\\350\266\230\266\005mQ\001\017"
+	.ascii	"3\241\313\037Xg\256\002\244\006\230\200\201[%\003\353\204\030"
+	.ascii	"xd\b\3335\221,\004\3742\004\270t\213v>\001"
+	.text
+	.section	.gnu.lto_isMotorsReversed.78.50bcaf1194e120d4,"e",@progbits
+	.string	"(\265/\375 \341=\006"
+	.string	"\262K+2PO\222\016\240\234*V\240\022\201\256\346\n.\334\362-4m{\177kX\273\265\206\306\315\347DM'\021U\325\b\324\031\2531\017\"l\307X\263{\313\024\267L\233\026\232\2065\r{\33008\2606E\260\314\300\022D\303\304$$ib\030+\213\032\207\005\037\244\370\216\224\204\272\036Op\256U\243\313\001ht(\200\361\271\353-\317\341\306\367\222\250\361\337\207\004&)\233\225L\320\325\222(\321\t\310\337y\314\b\t\235\251Z\035\240~dT\224\260dZ\f9J\365\250[\221^BT\256*\344\351\005(d\346W\205.:\366?\370\r~\213\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_initRcProcessing.79.50bcaf1194e120d4,"e",@progbits
+	.string	"(\265/\375`M\005e\""
+	.string	"Z@\320\rG\200\234N\007\237-5\002\341Z`\007\235\315R \212\247$\203x\271\227\266\267\013\202\217Sg(Z\362\303\2261\310\025n\362\177\210\253\020%\223\035\2031X\204L\025\211\347V.~B\377\007\203\232\210\220\275\245\224)\245\024\315"
+	.string	"\266"
+	.string	"\315"
+	.ascii	"96\201\202a\2239\235\327\313$\302\245\303\313\275I\242\263+s"
+	.ascii	"\003\341N\362\256k\007\351\260a\213q\332\371d<\225h[^\356\275"
+	.ascii	"\006\272\362\320\331U@\357\330\256\264sl\327\336\361\220\231"
+	.ascii	"K'\265n\243\345\2302#s\357\r>\016\3465M6\237>l\336N\227;M[\351"
+	.ascii	"\373\220\333\227j\305\252\247\346\365\326v\354~t\004.#_jX\311"
+	.ascii	"h\035\335\3712^\321\002Xl,x\300\024c\f\317Q\032\346\214XO1\302"
+	.ascii	"\240\r\212Rc\235\214\362\363\206\325\261\315\027m}USD\257-\232"
+	.ascii	"R \026\033\013_\025\n:$\305\306\226V\266SUI\371w\262+\327\326"
+	.ascii	"\227\032V\307v\023\302\275\227\275Xe\325\334kf\346\302\314\007"
+	.ascii	"\230+QD\272H\t\356-VZ\362.v\345^\262]\377\037h9\352\272\311\366"
+	.ascii	"\3737\361+\312\343\030\370\375\255\354zt\3532\005\007\345q\277"
+	.ascii	"\226$+\305?\2229\371\344D]N\304\360g1\017\t\365Ys\020P\2235\377"
+	.ascii	"\264X3\260:\377\250\263\217\351\334\363\316<\357\274\363\316"
+	.ascii	":\3269\307:\343X\347\033\353lc\235k\254\263\317:\367\2543\317"
+	.ascii	":\357\254\263\256:\347\254\363\371\316\346;\333w\256\325\231"
+	.ascii	"R\347\177g\177\347&\360\323C\312\207\266{W\304\241\271Q\252\222"
+	.ascii	"\256&\353>\353\026\353gn\346\036\343.k%\357\204\264\331\260\317"
+	.ascii	"N\2347\311I\265\344*:\273\332x\007Y\272\311\356<\317\367\361"
+	.ascii	"\r\213\316\233\277\363\235\363:\357\203\3639\317\340\t\321\307"
+	.ascii	"\315\237\217\363\277%\361\313\346w\177\363\001\322\210X5\337"
+	.ascii	"{\233\017\232\021}\370\336\3675@\357\373\340\222\367\272\357"
+	.ascii	"=\2024\342\327\371\347\363\336\b\215\370\025\305iv\367\300\334"
+	.ascii	"\353<\364\222\334w\027-aA\177\376o\331C\272\276\371\026\353\255"
+	.ascii	"\315\315G\366\030\025 o\366\263\330IM\005\025\372F\246q\371n"
+	.ascii	"'\373\363TH\032K\031\233\224\233\251\364\271J;Y\241w\360\246"
+	.ascii	"$zE\271\213-Xf\320G\362\t\033\364@`beP\244\334\f\333\017zO3\005"
+	.ascii	"W\337\337>\265B\364\242_\277\247\3408\251\2178-\340F3\001\342"
+	.ascii	"\274\367\366V\t\333\225~.\214;\"\224H|S'5\013\215\204L\033\204"
+	.ascii	"\035\202\302\016\301\020I\034\224\202B\246\021A#\036^\022\201"
+	.ascii	"\304\024$\261\264\304\024\334%o\177\026\037\201E\201\372(\036"
+	.ascii	"\205,ch\334\"wr\325\333\2214\333U\260\320\243u/T\027\271\251"
+	.ascii	"t\225\013\031\216\274\213G\266+\206-jE\027P\036wj]\343\275\267"
+	.ascii	"\350\307\030\345\311\323\360\017\356\212\207\356\221\r\300"
+	.string	"\376\236\247L\013k\350\266\t\277'>\337?\272\350J[\231#\224\307\221\311=\222M7s\350\337\315\r4\360\251\200\336\005\306\243\314M\312\3154\275\367\336\363\221\334\312>\323\250\351\260\364\231\326\237\007z*\346\003\r\374\241\357dS4n=\317\314\022\272\311\006\240,\367^\006\334k\315\204\003\263\020\tiY\004\303\363=f`\250Q,\002\rc\006\221\222\031!I\332\264\006`\002!TW\334\021\240\265Td\224\2551b\264\256K\203\374\303\276\317\227\207\241\343\2125D)\026\372D\264m\017?G\030H\314b\3313\f[\335o\032eQ\227\220|\210\254\235\b\220\223%_\202\347\016TE\200\2728\206wC\347\361\317\006B\025<I-\300\214`_\016V\306%4: S\3161`J*c\205U9'\233_x\262\340\020\371\t\006\337\\\261\tJ0\372\314\216p\"\227\252\371F-b\036\247%\341+/F"
+	.string	"\322C&\270\202\263j\334\277i\271@UX{\263\317\220]\306\347\361(\230\252\267\327\3732\236A2p\217\023\"\323"
+	.ascii	"P\206\237;\244\211\213\316\246\270\217\224\221\311\356\223)\351"
+	.ascii	"\177"
+	.text
+	.section	.gnu.lto_rcCommandInterp.7.89.50bcaf1194e120d4,"e",@progbits
+	.string	"(\265/\375 Q\305\001"
+	.string	"\264\002D"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317"
+	.string	"\005\001\006\025\001\003\002?\202\210\200 \1773\300\0014\277\001\276\001\275\001\274\001\273\001"
+	.string	"\004"
+	.string	";3"
+	.ascii	"\343\222)+\006\340"
+	.text
+	.section	.gnu.lto_rcStepSize.6.90.50bcaf1194e120d4,"e",@progbits
+	.string	"(\265/\375 Q\305\001"
+	.string	"\264\002D"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317"
+	.string	"\005\001\006\025\001\003\002?\202\210\200 \1773\300\0014\277\001\276\001\275\001\274\001\273\001"
+	.string	"\004"
+	.string	";3"
+	.ascii	"\343\222)+\006\340"
+	.text
+	.section	.gnu.lto_.symbol_nodes.50bcaf1194e120d4,"e",@progbits
+	.string	"(\265/\375`]\004\325\023"
+	.string	"\006`wG\240\332I:\300\207\317A5-P!\277ON\232\313\252\341\307e\205\325\003\024(\001\275\n\257\320\300\013\204\r\355\314\327\241\210)\276A\362\226\""
+	.string	""
+	.string	"\310G\310h\365\217n<\034\216\237~\263\203O\341\035\313o\273I\"S_"
+	.string	"f"
+	.string	"g"
+	.string	"\031\372=\f\377\232\027\336e\341c*\\\f\205~\223o\302\275L\t\347\212\360-\b}\252\357\301\316\301\303\004\035\f\320\277\374\234Kx->\317\332\005\351\302\311\377\2125\3473{~e\376\247U\036\257\032\341\351O};}\251\034\334\245\314\377\037\257\007\365\367_\325cg\265\326z\3533\371\376O\241Z0\372T^\364\267\024\365\311\020\365\275\206\372]\266\326\372\037(s\321/\267\3057\237\304\"AE\360\2245\266\242\037EE\277*E\037\312\227\3633\023\005\320\211\213\t\2354\3614sK\364\237|$\236e\304\261\2108V\210[\231 n\365\341S\346:]9Yy\350;\351\36039\364\2436\364\227h\350+\371*T\n\200h\371\270\201l\304[f\220\013\2108\220\t\214;k\302R\263\003\262"
+	.string	"rq\212\204\225< \337\360v"
+	.string	"\025\031\222\032\3104\261\007\344\242\3155\221\201\341@\276!\031\330\230&\356\222\005)\233j`c\033i\0337iA\215w\324\251\361\212\361\354\250_\306F\037\254F\337\214Q?\214F\037\315\214~\025\031\375\253\030\375\337#\344\276Wk\315Q^\"OCF\035\345e*w*uE\355(\357\222\270BJ\035\345\036\227\223\354`\263\243\234\243\\"
+	.string	"RX:n\224\221J\037\312H\343\256\016\345#rq\226zL!e\243r\177\265\245\344\025R&\0227\300\232\037_!\345\2411\244l\200\334\245\214\203kimx\214\331@\276AnR\250!\fF$\323\214\224$\205\345b\300\002\261\261j\003\021pH\013\315H4\301\304\314\204y@ZN\350\350D\356u\224\217\264n\025\321(\205\242\n\341\252\025q\n\344\314\376\270l"
+	.string	"\221\257\020\263d\222H\020\t\"A\234\374\231\250\265\214[T\023*\366\260\2405L7\216p\023\032\340\007\226^\027r\030\324PP\023\274\246^}NQ\346\214\030\302\302l\214'|\214\0165\213\257\250\204\207t\037\321\324\225aX\027\035\237\"u]\233'\233\276\3102\355\177.:/\f\214"
+	.ascii	"U\r"
+	.text
+	.section	.gnu.lto_.refs.50bcaf1194e120d4,"e",@progbits
+	.string	"(\265/\375`m\001-\r"
+	.string	"\306\037Y=\020\223\263\214\001\240\024\205m\351\367\027"
+	.string	"\376z\327\365\377_\177=\240\360\003\n\267"
+	.string	""
+	.string	""
+	.string	"P"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\274@jY\005\372\017\374\027\247\346\300\177\303~7\221f\335DZ\333h\313\024E"
+	.string	"E"
+	.string	"D"
+	.string	"[\231\274k\311\310\226\321(\245OH\233H{\225\266D\332\021i\2215h4gT\364y\023Z\033\317&\360\354\001\317\326x\026\206d\323\310#\320#\237A\236\355t\026\341\034\"\262 !;+\210\250\332\355]=\b\250\027X\027\350L\363\2621.\303X\277\240\266\245\345\225\323\246\353\022\226E\327$\327\037\2269,\273\323"
+	.string	"/\267\022\300N\244\312.d\312.\024eYB\233\022\332\353\344\222iR\350Qh\321\311~\256=\246\265L\002\025X#\260\266&\346T\3143\326\242bV\271F\001}\262\262\234\225\005\331\003\2051\360\216\323\326\201\343s\033\327k\320\b}\206g\313@=F\3470Nw\201\332,\254\275\302e\253xy\n\227\035\240n\200\332\233\247\252j\212\2632\2532\234=\311\020\340\\\352\200\255B\023P\035\212\023&J\220\030!\202\346\205\240\251\016\304\007\017\0358l\240\331i\310\360y\030.X\250@\301\332M\270\236\004\353EH\355 \374\360a\275\307\314y\344\270!\363\027\240\267\270f"
+	.string	"\332\306Z\033"
+	.string	">\033\330m\316\307\020V\300N\306\030\201M\200]\313\230\023l\3124\001v\300X\213\211\252\254"
+	.ascii	"+`\007\214\001\023\201\361\215]\032\315\033\317\330\203bq)\363"
+	.ascii	"\336\262\320\0354$\023\224$"
+	.text
+	.section	.gnu.lto_.decls.50bcaf1194e120d4,"e",@progbits
+	.string	"(\265/\375`\353?\r\034\001z\354\371jU \fY9\351\214\243\343Y\027F\361PL\367\262\245/?\244O9\251p=5\347\030\343\f\347(\313\311\273\306v\215\036;\017)\305u\265"
+	.ascii	"\260 \333\250Fv\256#\236\032,\0349\205\027\216^&\236\022I\370"
+	.ascii	"1\362\341\361\330\3013\306\3650\261\255\226l\"w\n\271\005\256"
+	.ascii	"\006\357\006\270\203=\352\335\316\"\365~\301\340\337)\370w\b"
+	.ascii	"\376\245\201_\352\301/\337\340\227e\360\325,R\357\245\031~I\005"
+	.ascii	"g`\217z/\203\340\2277\360K\030\370M\207\337ip\007\026\251\327"
+	.ascii	"\\An_\340h\364}{\301-\244\267l\262\207\374j\331\312d9#/\224G"
+	.ascii	"\035h\322\372\336z\350\021y\350\275\303\360\233\t~\017\301G\366"
+	.ascii	"h\2553\257:\264\276W}c\350X\224\263\023;r<z\207M\266\226V\347"
+	.ascii	"h\035\366-\311\275\002G.\347\374\201\303\207{fG\304L\357\266"
+	.ascii	"\216\037\033,\214\255\320\367\r\004\337\212\325\240\3236\032"
+	.ascii	"Gg\331\344\f\213\226\207F\037\207\314\234\267\352\210\350\033"
+	.ascii	"\215\325\307\241#2c\235\230cC\313.\347\374!\351\303\0075\213"
+	.ascii	"\021<|o\363\360\355\035\276\305\203o\353\340\236\214\216a\221"
+	.ascii	"[V\3704\214w\214\277\253\332\252\217\326\272\250s\245\247ooY"
+	.ascii	"\244\336\005\366\250\327/B\274a\feYI\236\3655"
+	.string	"j\027\030`\2520^\302\232\252\247Vhie\351\251>\332\255\274a\350F\262J\217\2766\257\263Mrhc&\262tI\246\262\372\336\266\301$\310\331r\350\331\274<\313\241\367\333>\034~\250\254\t9\302g\017\220\325\n]o\366\340\005\231}\241\231\365\265z\200\216l\021s\326\367\266\f\376\255\235M\332\273_\203\021O\023\3129,\347\\Ak\201\243\005\247\257\235\263-\374\367\231p\270\312(\351k\351l\235M\236\315\336\271\305c\363\334G\205\314d9g\242;\345E\234\224\276\035,R\357\332\243\336-\033\226\3129g{\266\336O^^^\236=[\317\312\021\241\215\275Y\322\367x\236\366\337g\245\240Y9\263S\347'\313\025\217\252\276u~K\307\"\237\326[\3556\027\304\256\257\220=\352\375v\216\234\036\f!dnqn\345<\255\267r\376\222s\336\200\255\360\360\321\323\327v\tq\033\307\001K\212\\\201\003"
+	.string	"\"\244\216\253\"o\334\fI\2411\307J\337\337\272\261m\312\252\031[\331,g\244\221\275\323u\303\256o\\\022\221\333\0245c\337\3331|\021a\314\274\316\324\274x\231y\261`\354\233\326\275\002F\016\313\037\342\326\315\216\261m\366-\t\211\2604\271\234\221!\334l\232\0053T\346|\374\342\225s\376o\325X4v\215}\263p6\215=c\331\330\244u\263,\334\262Y1o\344\255\330\332\231E\216\331\262\2412\347 h^9#?\342\017\361k0\302\272\331\025lY\005S9\007\001\202\201+M\2145\273\234\221\037>|\370\360!\351\303\207\017\027\312d\360P\202\341Z2\266\214Mb`\315\334f\261b7\217\310\214\314\031I\324K\370t\331\322\367\026\006\276\305\240W\346\345Y\fz\227\3026\037\365\036\304\357"
+	.string	">\n\374\t\340\223\300_"
+	.string	"\316\300\"\365,\230\337v\261g\266\354\0039S\345\2347\250Oxp\351k\263\204\270\375\362[0\033v\324\303\322Bf\263\2343Q\251&\346\305\236\276\027\201\223,R\257\264G\275\233Y\244\236\325b\267\330$"
+	.string	",\227k0\342\245QK\016\313\031It\241\217\225>x}\017\002\337\222\035\203\226<\342B\370\026"
+	.ascii	"=\233g\001\320{\343\277Y\244^\221E\352\265=\352]\316\"\365\216"
+	.ascii	"\264H=l\217zq\267\377u\373\233\202\336\363\037\357h~k\341\236"
+	.ascii	"\324,\030\315\262\004\367\277y\377\371\357\335\337*\340\3756"
+	.ascii	"\317o\357~k7d\255\350\371;\313\235\235\277\221\354\376&\201\232"
+	.ascii	"^\021\345\267c~K\206K\013\026\355\357<\277\375rv\204\347\267"
+	.ascii	"`\177\033\375\314\177.o\377\315X\333h,\232\246\373_B\233$*s\177"
+	.ascii	"\323\371{\316O\370\357\321\3378\216\216\277\017\347\267O\002"
+	.ascii	"\360\246\335\264\351\270\337\346`\363\267\022\270\337R\371m\327"
+	.ascii	"o\2414\003\326\374M\0025\375\343\357\362\315\216q\340\177\t\030"
+	.ascii	"\030\300\212\t{\005.\017\341\277\311\277\253\334~\233\376\326"
+	.ascii	"Z\021\330a"
+	.string	"?\240g\3746G\232\277\321\374O\212\272\001\3144\013f\336\341\277,\260\302\374\347b\237\374\275\302\337Ek\257\340H\377\225a\215~\233\364[\f\177k\240\326K7\223\326 \270\240\375\327\3637\006]\200\266\300\204\377\006\370\237\204w\f\376\033\201\023\375W\001\377\325\374_\363\237\313\177\267\377_\376\307\335M\005\r\346\267|\360\212\376\273\364\022^\376\027K\001\250\020\340\204\257\377t^\347)\336\373\357\223\277\313\376\036\373[\354\357+\177\177\375\315\344\357\256\277\221\374\r\344\357\035\177\337\370;\353\357\253\277\255\376v\361\367\324\337\306\277K\360\267\b\376N\341o\251\277W\374\275\376\355\373[\375\233\370\267\360\357\364\357\246\277\203\177\253\370\373\003\177{\340o\016\374}\302\337\031\370\033\305\337\025\370\233\002\177\207\360\367\007\177\227\370\233\304\337\017\370\273\001\177+\340\357\021\177\213\370{\351\357\004\374\r\342\357\003\374\215\301\337\005\370\233"
+	.string	"\177[\360\267"
+	.ascii	"\376\246\340o\016\177o\370\217\367\267\320\337H\277]\363\333"
+	.ascii	"3\177\037\375m"
+	.string	"\364w\321o}\277\025\373m\b\376\307\371\255\372[\373\333\376O\347\177\334\337C\177_\370\273\374\373\277\315\361\337\314\377\024\377K\370-\237\337\342\375V\317o\347~\013\367[4\277U\373\255\226\337\216\3756\354\267\"\370\217\342\267Q\277]\361[\016\277\005\372\355\375m\371\237\317\377=\377\353\374\227\363\237\204\377m\376\277\371\357\346?\361\177\333\177\243\274\274\274\274\377\347\307\177\201\353\007\001$\030\031\244\026\244\013\216\276\027\013\356\256kI\337\017\235\341\377\326\270Wl\274\250L\365\375\257\213\337\030W\306\275\"1U\2253\016\013\260\254\321\231\261\313XX \356\f$s\346\334\372~\350\n\376\020\023\374\373\342\302\370\255J\336\252k\205s\316Fd\256\301\301G\026\235\031\273\254\245\345\201H\214\224\260=x~\255^\307\\\023\305\311Y\337\017Q\341\337\276\377^>b\345\234m\230\310\2145%\324\373\355\255i\255\207\377\202-\355"
+	.ascii	"\376\337\234\0330\002d\236rc\222s\266w\360W\332\321G\207l\276"
+	.ascii	"\345L\305e$\301\225E\305\265\243\212\214+\313\250\212\214+\033"
+	.ascii	"\251\234\030\215\2602\227\261\212,g#**\243\211\255\254*\262c"
+	.ascii	"6\252\"\313Y\331\305\232,\233\221\\\306L\265\225\2152U>f\262"
+	.ascii	"\255\254\016UT\\YUd\307,\243*2\256\254L\306\225\2132\325\021"
+	.ascii	"\313\212*c\031e2\256\271L\266\225UTE\266\225UE\306\005f\275X"
+	.ascii	"\331\251r#\r\023$`v\256\212*\323\270\372q\304*z\253Bn\34579["
+	.ascii	"\263\027\031+\277\345<\200\234\177la\2759\356\260jSo4\246\276"
+	.ascii	"\034\267,2\347\314\341j\212\310V\246z3\332\374V\025e+\347(SN"
+	.ascii	"\371*\347\23470\"\337\262\022\373f,\362#\317x\221\363\004\031"
+	.ascii	"\231\363U\316F\233\337r\316\306\234\363\017\326\017d\316=\212"
+	.ascii	"\252\274\256\256r\326J\272\312?\214k/rn\2638jYUdD\266B\254q!"
+	.ascii	"\363\3120\220F[5c+{\3457\\X\230\3148\226g\344\234m"
+	.ascii	"\035\366\312\272A\227v\247X\320u\231!\273\307\233}[=\266\034"
+	.ascii	"\373\376BX\231\227|Z\311g\314+\347\\$\024\347\016\030\263\276"
+	.ascii	"\2770\005#\311\322\270i\363\006\257\264KC\305\314]\337\333<w"
+	.ascii	"\254\360<m\210\252(\313\230\252*[(\365\224w6Y\332\225y\250\302"
+	.ascii	"\354\312\272\247\3317\263\354b\f\001P\206\304\311\363!\351\003"
+	.ascii	"\321\221H\023%\370\376B\026\376\205\032\370\027\256\360/\310"
+	.ascii	"\300\177IW\322\321\303U\246K\337\213\200\203E\256\244S\306u\221"
+	.ascii	"\313\343F\314\253\215\231\\Y\247\264S\316)\347l\262\244S\306"
+	.ascii	"y)\247\233\274K:\345\033\3336tDf,\005\250\001\373Q%g\244\220"
+	.ascii	"\236,-XB\027\310\036\365.\244\007_H\016\276P\033\276\320\032"
+	.ascii	"\276\020\026|\241&\370/\331\224p\226\017\225\327]\371\366\022"
+	.ascii	"\356/\325\224kJ4Xr\\\364\265I\366\250W\272\205x\371f\362h\033"
+	.ascii	"\262\244oP\231\246D\343c\254\317[\3373H\263\234s\322\00546cg"
+	.ascii	"}/\324\003\377/\315\224d\31226Y\266\225,\374\"s6k+\331\3121\366"
+	.ascii	"\315\314D\030\035\021aJ\244}\323r\200\nr\344\332\312\025~\232"
+	.ascii	"\214\211\331\365\272\222E\360\360\025#t\324\201\246\246\357\203"
+	.ascii	"\352\360\203\340\340\007\211\301\017B\303\017\332\202\377r\255"
+	.ascii	"TK\202-\211\353\373\277L+\321\312/%\230\322\213M\226je\227\227"
+	.ascii	"g\245\214[\262\022y\201\2249\260\037vI'^eL\274\2704)\325J3)P"
+	.ascii	"\300~\330\345\214L:\233\342f\210\3205\355Q\357A7\360\203b\340"
+	.ascii	"\003\361\301\007\222\203\017$\006\037h\f\377\345\026\017wm\246"
+	.ascii	"\252\364\375K-H01D\314\372\226\310.\305\312\261\227\3102\313"
+	.ascii	"5\030q!\252\022ys>Zk\301"
+	.string	"\220\265\026\230lM\216[z\367@`\370/\261\260\221\303D\255\357mX\225\213\032^!J*%\216RG9\206\205\313\266\364\221\0233\306\005\261l7\362\274DL\305\375(\217\224_%\224\362J\351UV)U(\227\224JJ)eX9\245$R\032)\243\224MJ'%\222\322J\tV2)\237\224I\312\"e\227M\226T\312\255\227CJ\256\"V4\344,[\tCK\356J\006Z\347%\225P\031\361!\227\223\310\365\224#\220n\302\003\317\313\262\325(\263\342\254\316h\304\360*wh\355)]\364\360*\251\224?J!%\322\313\007\203\210\235\\\316\331\262\225T\312\027I\036rf=\364\330(\263\252\272O\\W)cF\334\214\020>\356\3204\030QR)c\330\262!#2\327\260\300\332W\220*9#\223~\356\254\004\311\261\301\3557\213\324C\300\017\374\227A^\n1\373\312\243A\327\267\004\022\342e\220"
+	.ascii	"\200a[\353\373c\217z\007\322\201\017D\205\357\243\303\367\271"
+	.ascii	"\301\367\215\301'\343\241\314\201$\362\265\251\003b\326\367>"
+	.ascii	"4|\037\031\276\217\t\276O\006.\261\256\0164F\234\364\275o\n\037"
+	.ascii	"\307\301\307d\360q\030>~\202=X\244\336q\021|\254\205\217m\340"
+	.ascii	"c+|\234\361\177\344\360\177\310\340\377 \361\177\232\340\377"
+	.ascii	"\340\300\377\251\302\357\355\301\357\315\301\177\363\331s\273"
+	.ascii	"$\205\344\273\326\323xBU}v\344\350\333H\213\324\363`\217zm\027"
+	.ascii	"\342}\347\245\215\317\223\276G-\344!\272\223\344Q&O\335\005\031"
+	.ascii	"Yf0\351\373.\222E\211\027\232X\2229\275\246\317\264\234\246\323"
+	.ascii	"l\272L\277\265[\217i3\235\246\345\032\256\343\264\235\236k5M"
+	.ascii	"\246\351"
+	.string	"\272\255\353t\233\306\323w\372M\307\265\233\206\323hl\262\353\232\2057[\213\371m+\177O\271\322$\212\025\257./1\271\256\2570\257)aK\216\244\311a\371\321\326E\376\366a\204\214\\\227\nX,\333\226\037S\220Bz\212\026 S\260tM\031\013\322>\220\240u\027\224,rH fZ\n\225*rJ\276x-\361\322]O\314\344rF\3265\227\016S\"\275B\230\352!\027\326u\035\244\211\224cX\030m\252\f\022\214I7qb\333\206\216E\231j\252\213W\316H\037I\220=\245\256\253\330\262\022\351\365SF\304\211\\w\3255\023\333V\"\3250\214-grI\037\200\274\340\310\261\006\201kf\213\324\273\232\033\376\333\254\311:\331+|\200H\335\324Z\3375\337\0258a\254\364}\217\f\376\210.W\177\243\265Z\203\261\311Nk/\267_l\331\220\261(O\301\321\020\321i}f\313\354\233V6\316m"
+	.ascii	"\005Y\327'\351\303\007_\033#j\350\360}\017\013~o\n~/\n~O\005"
+	.ascii	"\334e!\336fAT8\316\234\364\3659\301V\316\"\365\002`\217z\357"
+	.ascii	"\021\301\357\351\300\357\301\3007\357\340\233k\360\3153|3\013"
+	.ascii	"\276\371\004\337\364\201o\306\300\177\243\007\377\266\t\006\200"
+	.ascii	"1C\r\356\202\231l^\214I\326\334<\t\320\3150\242\006\310M\006"
+	.ascii	"\301R\347\315\252\210\026^\0277\363\352\315\226\221\031}\315"
+	.ascii	"3&\232\233in\246i3M\231\227\267'\347#\221\265\026XkA\017\013"
+	.ascii	"\233\262\236\0301\246\231\336\332\312\331\353\347,\216\206\\"
+	.ascii	"\231\233f\330\314\027s\356\254\351k\222\301x]\304\330\3645\307"
+	.ascii	"\234\255-\r\021!\024d\234\211\206\364\300\325h\241\357m\322d"
+	.ascii	"\301\314\352\22277\247/2\254F\215%[+d\225G\254\334\345X\273_"
+	.ascii	"\037\354\216hQ\263m;\\\340yIk843\246\372vy\027\023\214\305\302"
+	.ascii	"\312\033\260\031\343\344\261\313Z8<\374\346\227\233`\360\224"
+	.ascii	"-t\326\372\232^\2366fdmM_\363l\002<[\266\230eI[\306:\004PY\023"
+	.ascii	"\263\213\241\365\305G\031\027\016U\340d.f\362\206\325\025\261"
+	.ascii	"3\310\\\366\326B\017\262\222\005\241\2711B`\364\375\004j\306"
+	.ascii	"\306n\236\2240St\264\321H[\353\373\tT\b{\230)f\213\220Sq3\274"
+	.ascii	"\202\266V\3001'\313M1\263\312\317\023<\3107}M,\27617\036`}\221"
+	.ascii	"H\221b^\271`\rJ\234<?v\234\310\200b\345\346\225>\312\231\003"
+	.ascii	"\203\353kN1\253\374\367\265\333\2206&T\312\270\0348\276\372~"
+	.ascii	"\002!\370x\372\370\3377\344u\207\211\261\357'\310\341\304\211"
+	.ascii	"\371e\265\344\032v\013\032\033Z?yso{T\270\371U\007,n\316\221"
+	.ascii	"\276\307cB\371\357\373y\021\345F\022\212\351e\342\210q\247\306"
+	.ascii	"\235Q\302\315)\363\244"
+	.string	"\357\237\224y\220I@_\362\342\344\372\236C\034\023&7/\f\027\235\035P\223+'I\372\236\003\030%J\314\256\244-\343\234\207\271\265\257 \345\035\230(VfW\333\222\261\027C\372\236C\230\220\233F\204\230H,\036\213\314Z[F\272\002\bi\353\252b\227\253~xh:\"\344\314\221\233H\316\364\362\222j\\&\221\233E~\337\217\233\2706-}\317\201\n\233Cnr\375>\323\307\r9Q\372>)\017\377\346\326\357\023Jr&\r]\337'\335\341'\321\361\340a\002I\3322\316mP\367uD\255\203\234i\343\246\307M \346\217\240 pN\302L\037Dc\360\bQ\353\373$2|<\227\352\277oC\336\022\030}\237\364\225#\207\271C\354\006\027\335\020\334\221\0302t\334\334A4%\205\t\230k\274P\205N\034\217\276O\202q\343\206\231e\213\220Sps\274r\326\362\200\215c8\242\354\251Q\303\314\252"
+	.ascii	"\013\2248yN\320\342\204\016\353fV\232-\213\243&\314\234\f\031"
+	.ascii	"\346U\006(\307>d.\270\331H\3132g\334\274\272"
+	.ascii	"\200'\371\226\245\357\361\224:\376\373zij\354\321\323\367\033"
+	.ascii	"\276`\0300L+\253%\327H\n\223\265<\b\305\260\303\007M\337\337"
+	.ascii	"\254\272i\025F\306\346j\203\024\374\233.L\027\245\016\022f\371"
+	.ascii	"\230\345a\314Q\017\031\243&oT\372~\003\025\376\315)s\252D^#2"
+	.ascii	"\327\310\260\226\353\372\330e,2 B\250aU\365\275\0069\323h\032"
+	.ascii	"\257\325\003\300t\371\274\304\254\264\320\367\032\334\372\364"
+	.ascii	"\271yHa\326\350\314\330\365\334\310\b\222\227W\"\241|\021\231"
+	.ascii	"\321\367\032\320\366\354Y\233{!\307\004K\337k\030\303/\221\366"
+	.ascii	"\352\321S\"-2\327\370\251a\324\360\205\377kw\233\274vW\007\211"
+	.ascii	"$[\371\306\005V\306\300~\214\220V\025\326\367\032\200\340\377"
+	.ascii	"\346\261\311\233\247\2043\253r\266\321A\212Q\303\f\374\337;\267"
+	.ascii	"\311{\347\342 \241\265\225o \200\312\020\260\037Yo]^}\217tg\216"
+	.ascii	"\316\312\2719IQ\246r\323\345\005\007\037\351\f\276\265bo\235"
+	.ascii	"\013w\355X96\307\300\362\235\225)A\372\202\217tE\316\234>f\200"
+	.ascii	"\007\n\322\020|\244\027p\340\224:H\230m\035m\\\260\206U\327'"
+	.ascii	"(\013\035\252\260\276\317p\007\377\267\315\205\273nl\333\315"
+	.ascii	"I\362\361\270\001\236\261\fn\370\031\314\330\260)\221?0T\200"
+	.ascii	"\313\362s\205\353\356\255\3573\020Y\263\346Z\341\244\272\271"
+	.ascii	"\013Hv\260\371\350\373\f6\336\336\236v\221\231\311\017\230\271"
+	.ascii	"#<4hn\232\036^\346\221*/:i\322|ZK\260\324\264\265]a\032Nt\034"
+	.ascii	"\321\312\224\201\253\362\312ZZ\036\202p\\\261\321\352\373\243"
+	.ascii	",llw\314\004r\316\306\242<U\007O.kiy\300s\324\240\221\"\346w"
+	.ascii	"L\232\320\031\226<2GN\360\257\232\275+\204yZ\007\252\242,\303"
+	.ascii	"E\232W\021\374#-\334\004\260hZ\260\202\323\367\367\213\275h\\"
+	.ascii	"n\332\323\260\021KC\214$\232\334\021\r\374\243#~\232m\252\234"
+	.ascii	"\217\004 2\202\345M\216\276\277f\366\236\375\032\214\270\\\256"
+	.ascii	"\027[v\263V6\322ePf\r\203\034|\f+\340[[\326\373o\331m\362\226"
+	.ascii	"\335,\022f[\331\006\002\330\326\276\202\200A##\247\3571hI&\257"
+	.ascii	"\225\2213\fG\360\177\265\334\260\273\245\367\330l\003\213\002"
+	.ascii	".\360\3440\314\3007\222\023\273a\027y\266\233\315\362\321F\007"
+	.ascii	"\267!\031\304\215\342\340\033\255\301\202\245\363\02059:\211"
+	.ascii	"2\265\346\311Z\337\033U\261b\345\202\331\234sv3\322\231\261\273"
+	.ascii	"\362\013V\242\351\372\"\263mb_ZG\372\336H\213\n\025[\247\254"
+	.ascii	"\312\tPCg\246\212\221\f\374_)6y\245<\215\204\0316z\205u\221\313"
+	.ascii	"Y\013D\005\30656}o\344\002\377\027\312m\362B\271_\367\250%\033"
+	.ascii	"E\200gC\313\236\311\263\243F\337\253\002\007\2404/ZY}_d\007\277"
+	.ascii	"\250\r\376\357\023\233\274O:\006\211$[\0050~\005!\223\263\026"
+	.ascii	"\b!\343\013>>\372\276\310\r\377\267I\3626\261m"
+	.string	"$\222l\035\217\027H\261A\244OK\271B\306\344\311\222%=uM\252\\\244\211W\316Z \200\262\210\215\001\323\367EJ\360\177\225$\257\022[v\215Zr\r \027k\270\262\b\335\215\335\301\351\373\"\027H\220\330=I\310l#(-\013\t\342Dz\214\030\261u\254Q\316\3077jq\360\177\211\330\344%b\353$!\263\221\210\216\032\"4\370\277Cn\223w\210\225C\302l\353\b\245\003)F-\020Au\254\3344\351{\2420@\200\\!\235s\316^?eD\360\344\262\026\226\207\377\006\371\025R\007/\317\231\024\266\377\276\233c\r\f\r\026\037>\260\030\273Tqa\243\357\211\222\340\377\362H^\036\326\r\t--\331F\ngb\330\331\345L\006D)\304\t\031\264\276'\242\261c\207\275\233@\005T\306\31410g4\372~\350\016\337\034\275>g8\314\364\375\320\033|o\\\260\033\022\204\205\276\037b\013#"
+	.string	"\325\242\037\037\3230=U\240\021V\264\351\350NJK\250\b(\323Y\024\246'S\321\n\214R\327\342\220X\002\004@\353O\203\020R)\323O\013!T\272\n\243H"
+	.string	"\201\257E\220(\001b\n\247U=?\300\300\223Jd*\016O5\005\212\252L\301\023\235\300\220\230\016Ut=\243,\020\365\224.\241-\326t\305\251\206\220\256C\017\212\351\206\025\rAJ-\022\236\300\342\232\252X\212\0326%@*j\230\n\023\260\001\007?\016:\220ZB\203QB\3400]R\213QKK,\210\252\323J\034\3760\235\250\360\256\305!\021h2\255\303T\025\366\356\244\244\242\302\250 \352\004,Z\260\376\320\247t\rB\237\322\024\347*DM\240P<S\254hS\321\235\224\212h\220\370\364\001\006DHQ\302\203\337\007&*@\302\257\304\211\037\n\021\214\212D \220\024Q\205\202:\177\303\264\bt'\245%T\215ZO\224\351G\204\025E\021L\2414\334Ii\204\024\"\240X\352\200\002\220(,\201\252\304\022D\301\342\231\0014H|R\323\363\250i\230\232"
+	.string	"<\261\246\303\264\350D1-*\246R\036\2608O\020*\252\304\225H\302\005\244\022'\240\242P \022\205E\033\2008PBSHQ@\241+\n\240*\244"
+	.string	"%\243\244\016\224\326a\024\261\004\024\272\242\230"
+	.string	"}JW(\"q\204`j\302\2126\251\347j\224a\001J\350z\236p*\242*\023zB\352\204\206;)\241*\021\310\002-\341\\O\023\0328QL\203\212E\024HT\241\2124D\r\321u\365\300\204\b+\332\304\241\250\302\003\f'V\264\211hE\233\210|!\206i1\310\247\201\222J\\\201'\bE\"0H\203\b\245\265x\n\223\236\320\265\330\002\005\021\b\304\024\024p\330@\251\030ELW\240\252\t\024\230#\224\244\320\3400\375\331`\202\021\272\236+\212\025-\242'T\242\252~\240\022A\020"
+	.string	"\272\236B)\020\325\026M\346\372+\252\2500\352\003$4\030\265\246\353z\342s=M"
+	.string	"\325\336\235\224\200?\364)]\207Q\352\022\220I"
+	.string	"\305\246S\b\002\032$\222@d\336I\251)J\005\032\\\n\n\323(\025\034\320 \221\204\246(\025h\320\007TT\341\001\321\220\230\256@T\310\204\232"
+	.ascii	"\252B>t=O\240\353)\214\002\nO \022\b(\360<Qb\035\242\252\032"
+	.ascii	"\005\344p\256\250\0042\254\353\312\204\006\177\277\225\350\302"
+	.ascii	"5\024O\240\353\031\204\212*:0U\321!\332\204\277\001\007\t\340"
+	.ascii	"\240\003\251\237w\300\200\f\030\220A\357\0350 D\b\006p\020\002"
+	.ascii	"\237\203\020e\006JLLQ\022\b\016\317\247'b\t\240J\204\376\202"
+	.ascii	"\"\240P<S0\001\201\320_P\004)\242\212\237\365$\n\231\314;)\025"
+	.ascii	"\235\326\363iiH|z\"\002'P\211+\020]\361\203b\362i\300\236`7`"
+	.ascii	"M\210(bA\024\01695\245NDA\021\302S]\243\320\241o\375\005E\034"
+	.ascii	"\005E\004Q'\340\232\262(\022\255wRj\241\242\353z\252X*\252\304"
+	.ascii	"\342\020-\002`\375\025/\200>\245+F\237\322\024\253z\256E_\361"
+	.ascii	"W\002m:W!\021\003,\210B\fAT\250\342\034\242?h\323\t\005t'\245"
+	.ascii	"\"P]\0022UP,\001T1`\026g\013\241\340\360T\021<\321\240\021\332"
+	.ascii	"\264\026O\246_PHt\372\255\3023C\020-\252\350\nT\375\375X\234"
+	.ascii	"-2\b\211D\t\374\314;)I\251KR\352\221\224\n\004u>\001USE\203\351"
+	.ascii	"\n\242\n"
+	.string	"\025D\245T\341\231\252h\321H\n\025BE\231`\022\236N@B\"\220\270\022U(\242\365\247\201\210`\352[\207QD\340\217I\375\245P\305\237\224\272\001\r\246\252\212\256 \376\206i\207\365\367\323t\246 \246\277\246(!T\222\321\212\026Q\225\270F\235\277\3400U\361[\317\342\357)J]Q@\241\212\024\b\241\302\023X\004ZUt\3050\375\245\305\242\032\004T\203\351\2239L\2370\n@\324\t(u>a\242b\t\341\271BH\204R\321u(\002P\335PDQ\265\t5\361t\226X\001\305\204a=W\244+\320\0034H$AM\317\244a\nD\213Q?\251\363\351'\245\006\t\321\341\360t\002\376\244\242\316\237\324\371DT\374\231\020L\241\204\326;)\005S(\023\266\370\353 \230B\365L\260\"\330`\nU\2628["
+	.ascii	"\245\340\364c\202\022\n\245\3404\304\304D\\\243\200?'\340J\034"
+	.ascii	"bP\321U\2302\375\214\326!\nTQ\023\326aJ4\001**8L3\260!\210\305"
+	.ascii	"yB\024\212`\n54$\246\353Y\034\242PO\304\022\301\324\204\365T"
+	.ascii	"\261\342h\230\222\260z\020L\241\212Pa\323\320\003!\272\002\025"
+	.ascii	"\022\255@\224\211\351\b\r\022\237~\253\212BI\241\277U\230\256"
+	.ascii	"\277!1\205T%:%\245@\205\353JT\235Rh\030\246g\b*q=U"
+	.string	"4\0031]\317\023R\247\020=\201aujJ\321\f\240xR\3215xt\202\305\331\302H\210\002\201\036\240\353\251\016\005\233\212\202B\242S\021U\235\326\337\212\026\223\320\247t\005jq\n\321`\020*l\032\236\031\320\365T\177G\350\357\204S\361TK\004S(\f-Tt\005\021\210\252C,\316\026\2775}J\205?\247\342\251\002\211\326\364)\035\341IE\327\024\210\305\251\226wR\212zJ\227V\247\246T\230$\024\022\325\353\004\\S(\223\305\331\242,\242Q\302sE\357g\bB\013!\024\324)\264\016\323r\275\223\022*L\231\210*\324\017]O\365\202\023\241Pui%\022\325\245\240\365\307A\210u\230F\341u\230\022\241P8QU\305\357\204Z\207\212\277\246\224iH,\201\256\347\t!Q]\207D\340Q\007\301\224\004\325i\375\351\200\b%\365\201\352\264b\024\252\305\372\003*\242\353y\002\250\376\020\241\244>"
+	.ascii	"\252\275\"\272\236\252\271\376:X\207i\324\317"
+	.string	"\027\260\200\022\035.PB\b\030\250\004T\177@\246% \323\3220=\237\226\200jqI\t\311\204\b&\250N)\206-\202\276\377&\037{Gdf\217\220'{\276rt\261\321\301\273\022\267\207\016\017=b\266\205\036YD\356\256\016_]\027\027$vf\031\330\022\266\031}\207zS\230\300X\313sq\254\t2\367\326\327\254+K\220\227g\326\265\211\307\274s\263\356D?o\252T\035{\327\264c\3321\347|\031\213\256\203\224!\246\334\3159\037\013wrf\230t\340D\031\002\243\357)\260\201\205\342\234\271\341\231c\225\2141*\351{\nb\340\337\224s\255x$!\022\307\3341w%\017\0238B\236\224\tqCF)\253\322\306\r\222\037.vh6\332\030\201\202\006\026W\352\300]\352\274\311`cv\005\204E\250s\361TZ8\222b\024\207r\n1\304\220\020\325\244\305s\025@`p8\030\225\213\350\265\036\023"
+	.string	"\003\fK\005\212 \b\025cB#I\222\302\376\214\001\213"
+	.string	"\276\230\271\033\353\377X7M\216\311I\343:\245\0011R\374\350\221s\311\031E\323\347\224\223\337?\005\n,\361\266\370iR\322\300\265s\232T\0031\004\343o\340\n\017c1\002\005\235\361c\257\327\305/\321\306\333\264B\374\r\264zfp\334\363`\362\312\323\003q%\004\270\021/F\343\275\276\211\276)\301\252\"\t"
+	.ascii	"\362\217\304\330\224\337:\242\362LG\221\240T5i\205\211\224H\363"
+	.ascii	"b\226\361)T\273m\373\315\305S\300=\342)um\333u\217\373\367\220"
+	.ascii	"\244\252\274sF\346\310Z\313q$\357\307>c\375\221\210"
+	.string	"\002\210\326\237\177\216\353\001\244\352\035\304\f\0179\204\216u,\2654\025\341\204\217D\035P\210\230y\256\214EI?\337M\2460\265\205\260\247\177.$\023\251\301GUu\257\334\321\270\3450A\024\337\265\254\265\232q\001\263Q\253q\034\240\213\375Q\214\213\273l\004\020\234\f\377\240\027\030K\357\243\027\321C\037\351\026\367\234\203!\374\003\201m\3316\301n>\325A?\004\213\333\343\250\311\216\377k\376\224@\3555\007\246\033\017\224\b%\373\0304\367\304\365u\312)\313\365J\237\023\326\313\210*A\n\373\257\"4\217\005\035\342\037\016\276\006H\325\354\356\305\016\261K;r\036Mp\265\337\0246|\320j8\300\003I\340\2741\271cu\305\227\307\350\025p\226w\024}`\332\306\203\340\333XS\215\200T\261\274\236\2714\225\200\224\222i\271\026\224J-p2\302\336%\017!f\034\177\240i\267\305\313\2136\252\376?\001E\221"
+	.string	"\227\355\237\342\272^w\356\003R\237O\266Y\322\023\352\236s\006\210^C\035\022\307\007\207\t\240\350\023\177\214\317D\2720\230\237Sp?\347VO\246\271\0038\313\212{\022\251IP4*\277\234\022\307\332\271v\214k\276\264\314\351Cp\313\204$V\334\n\254,\307\216h\314\247J\032b[F\223\262KGt\356v\350\367_\234\366__\006(\217\327\316\205\302#f\217\345\307\312\0017jf}\231N\324NR\275\256\261\036\334\206\265)~y\314\334\262]*\377\b\002+P>\251a\304\013\036\304\340Q\274\300\347\001B\345\364\223\224\361\223PC2\036i\313\023\034m\245\365&`\357\343\310\265r\241\323\021\026E\203S"
+	.string	"\316\267p|\022\260\264QP\t$U\023b\226ORf\003\267'\351\211\325\303\302\261N8C\307`74\021'\222\004\035\003\005\2155\0223\372Z)\247\200\326\005,nW\231\265\220\322\351P\2008\275\001\310Y/\314\001XB\331;\222\025\325\231\235\224\321r\305<\203\372\345\312PK7\215\013\312\242\022+.\324\275\206\205%z'\222\261\305\272ya\3518\025\360"
+	.string	"\r\177=\257!\307\365\325\311\263#\375\352\264\312\210\215\n\224\225\255\232"
+	.ascii	"UX\220\253^\220\313\365V\233\373w\300X\027v\225-G\223\337\033"
+	.ascii	"\002\370\313\2241\037\301\020\337\227T\023\035\241]\262\2340"
+	.ascii	"9n%\343Sdf\325\321fy)c\327k\215Y\026G^KHbC\252\366l\001Y\312"
+	.ascii	"Y(\256\361\377e \032\3243\360\202\345\016\2767\236\n\271\250"
+	.ascii	"\3420c~\355\322\313z\312\372\032CG\0321\024f\200\275\247\322"
+	.ascii	"I\fe\251\376\240\310\363p\033\321\231\227n2rL\304\"jq\310Z@\300"
+	.ascii	"\320S=_\335\225\224O;\260\304X\221\377\363\357\016{Pz_\216\016"
+	.ascii	"\366\303\255g\311\277U\220\270\354)\221\261\346\366\310>\377"
+	.ascii	"\035\242~2o\304pF\222\364\351\257>\335/\311\300\301\370\304\025"
+	.ascii	"\017~\303\240\377\214E\334=TG\245\204XL\346\006\026\321\257Q"
+	.ascii	"Nq\371t}\332\024\351!\256\224\024\2554\r\001\237n\002:m\262`"
+	.ascii	"\334t\177i\027\366&\301\372\3242\354+\240\006\350\030y\240*\330"
+	.ascii	"A\276\226\227\355\305\"\361W\313\205Nb\365p\264B\305Y%x\335X"
+	.ascii	"(\362d\002\013\265|fa\211\354Ee\242\311\224\030N\210p=\264\246"
+	.ascii	"B\b!\210\004\227\017\215p\304\023\032]6\2265M\024\254\235\004"
+	.ascii	"\307\302\""
+	.string	"\231`\221\332\016\200\273\376\352M\337\207\277\362\220\337+P;\360\225\224\360\037\"\363\005n\321\361M\326\271\236\277\225h.\344a2n\263\030\217\013`\352$l\361"
+	.string	"n&N\203\201[\313q\253\031\354`p\240e\234\234\2172\364\271<\0023\233Z\023\346\3047\245\313\002b\341\200:l\024\322\277\023\370\230\333\214\265\217.\272\346o=?0\222\210\310\3768\371\211>\234\246)<\214\375\237\006)TY\376o\233\237Qt\235\314;g\301\207\214\317\003"
+	.string	"\200l\344\273L\371\301\3419\314ew\351\254\314\312"
+	.string	"\b\022l\003?\260 \"\343\fn\022\304sc\036Y*N\221\242\332I\274\202w3\032\317\005\247\217\301\277\376\306\230\275\237\203\210\325\202\301\245yw\024\234\252"
+	.ascii	"a\210\373Rd\314cZ\314\2023H?}\377T\205\020\001\203\\\334J(\204"
+	.ascii	"\007\323Q\n\352E\254\333\317\020E\355\024r\271\225D\274/4\227"
+	.ascii	"LA\264k~\356\374i\266&\"\360\232g\265x\006\270J\204J\323\334"
+	.ascii	"f\275\326<\356.\034z\335\221\242\035v\301*\262\037<\227~^V<\320"
+	.ascii	"#\375\210J\002i\302|C\017\273O\245G\370\256\363\330\205\261\207"
+	.ascii	"\362\357o\320\210\027\"\n'\221+|1\3539N\233\3671\177V\004|\352"
+	.ascii	" \372\232\201~](\202Fg\023\347\366\2172O\326\217\024R$\312\\"
+	.ascii	"\271w\264i\217;\376\247\316\223\356\356\356Ab$9:t\306_\361o\277"
+	.ascii	"\225?\030z\335\206\263\266\001\223\242\321`\270\252@\217\005"
+	.ascii	"\370\314V\320\320\370\253\316=\306\034\021\347\363\313\230\020"
+	.ascii	"\036_*5s9\246H\0132\004\022\327F\345\332\231\317\217\363A\367"
+	.ascii	"9\314\024h\027\227\212l\200\351\362)Po\300\344\361\007\037\371"
+	.ascii	"ME\254\3066\2512-*j\214I\312J\005\301c\361\343\247Gn\260s-/\270"
+	.ascii	"V\037\243\2452\345F\321B\3570m\017\n\026\245\033\350&\013-\303"
+	.ascii	"\216O\343\313|\025bG\306\003\017p1uS\350D\252\202H\330\230\236"
+	.ascii	"y\357\036Y\021(X}\367\307M\002\252\227\224\2419=O\360\352\371"
+	.ascii	"\020\f\022\213(,\350\037\321\246YS\275\310\365kVp\245\227\233"
+	.ascii	"\247\347m\276\020\270:\253\024\210\314\366)\224\340\225v\004"
+	.ascii	"/\252\206\266\323.\273g\3072\273i\032\0075%\300\321\237"
+	.string	"\325\201\037lJX\n\301\343\005D:E\022\237\254\346\231\247\230\337\243h\330\354B\272)\225\202\347\314\315\200>\032\254\3619\355R\251&\215\203t~S\235\t\033?\0378\214\266\330\323\200I\352\306\353\260\032\203>\247B\212X\375\276\017\376}{\002#Yj\227I\236\211\t%\\\341\314\020~\301-\263\024\337g\351\343\033\030\334$\254L\273\314\354y\223\374\005I\327H\214\343]\232\303G\023Z\356\025\357\313\212\225\351\023\"\304W\210\250\324\023d\237\323\355\241Q\371\021\273v\376K.\257^\036\b\330~\024w\317\370<\350\247\004<\247JW\344X\243\212\266\334^\270(\327\324\260\227j>\021\240\267\371\222\210O\305Cc\230\304>3\365\321\237\263\344&\200_:\236\325Lj\3049\360Fd\276U\215q\247\276\265\260\223\202\357\303\344p\367\223\260\271\347\021\215\003\255\273\251b!\334Y\340G{\340\200m\217U\036\302"
+	.string	"\277\300\377\275\364\236\205F)\271\216L5\273\243s\353\377P\265y\235\016;\034\231v\\\\h\276'\357t\301j\t\272/"
+	.ascii	"\335\215\355\242\336\026\375Y\220\372\233\313\200\2209\247m\215"
+	.ascii	"\317N\017\377\350\0349\262`\367w\342=\207\251\013e\257jb\223"
+	.ascii	":\231\256&~4=\271\356\341|\207\261\363.=\364\302.\323\307\206"
+	.ascii	"\261s\351\357\302\337\023\270'|v\372h\265g\275\3566\354\331\376"
+	.ascii	"\013$\307\205G\360{\201\375\007\303\233\253/\376\336\223\007"
+	.ascii	"\246<\305-\217%\037/\235{\370\355\370i\322\373\276g\236\370^"
+	.ascii	"\367\250\201<S\364{M\331\020\376a\t\337\207\007:D\363\342\305"
+	.ascii	"|\355\372\230Yg\357\021\227\355s\337\030\235\217\360~\036\017"
+	.ascii	"\300\307\363a4\216\231\216?\213\321\2747}S]\001"
+	.text
+	.section	.gnu.lto_.symtab.50bcaf1194e120d4,"e",@progbits
+	.string	"applyBetaflightRates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\002"
+	.string	""
+	.string	"applyRaceFlightRates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\002"
+	.string	""
+	.string	"getSetpointRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\002"
+	.string	""
+	.string	"getRcDeflection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\002"
+	.string	""
+	.string	"getRcDeflectionAbs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\002"
+	.string	""
+	.string	"getThrottlePIDAttenuation"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\002"
+	.string	""
+	.string	"processRcCommand"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\002"
+	.string	""
+	.string	"updateRcCommands"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\002"
+	.string	""
+	.string	"resetYawAxis"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\002"
+	.string	""
+	.string	"isMotorsReversed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\002"
+	.string	""
+	.string	"initRcProcessing"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\002"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\002"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\002"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\002"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\002"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\002"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\002"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\002"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\002"
+	.string	""
+	.string	"gyroz"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\002"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\002"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\002"
+	.string	""
+	.string	"isRXDataNew"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\002"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\002"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\002"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\002"
+	.string	""
+	.string	"pidSetItermAccelerator"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\002"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\002"
+	.string	""
+	.string	"sin_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\002"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\002"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\002"
+	.string	""
+	.string	"getTaskDeltaTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\002"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\002"
+	.string	""
+	.string	"rxGetRefreshRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\002"
+	.string	""
+	.string	"isAntiGravityModeActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\002"
+	.string	""
+	.string	"imuQuaternionHeadfreeTransformVectorEarthToBody"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\002"
+	.string	""
+	.string	"qMultiply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\002"
+	.string	""
+	.string	"qConstruct"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\002"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\002"
+	.string	""
+	.string	"getLowVoltageCutoff"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.50bcaf1194e120d4,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
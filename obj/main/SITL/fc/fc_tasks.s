@@ -0,0 +1,1829 @@
+	.file	"fc_tasks.c"
+	.section	.gnu.lto_.profile.9aeb1a391642f3e9,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.9aeb1a391642f3e9,"e",@progbits
+	.string	"(\265/\375 \3525\006"
+	.string	"d\n\336"
+	.string	"\027"
+	.string	"\223\317\352\353\001\002\002"
+	.string	"\002"
+	.string	"\002\362\301\255\374\001"
+	.string	"\003\253\255\325\355\002"
+	.string	"\005\326\355\327\313\007"
+	.string	"\006\240\202\241\324\017\b\214\222\347\352\006\001\n\242\262\337\300\t"
+	.string	"\013\241\206\222\254\002"
+	.string	"\f\376\376\316\323\004"
+	.string	"\r\376\303\253\241\n"
+	.string	"\020\305\352\265q\021\370\327\366\255\004\002\023\316\305\360\246\003"
+	.string	"\024\335\251\235\247\b"
+	.string	"\025\256\215\336\312\017\024\002"
+	.string	"\002\003\002\004\002\005\002\006\002\007\002\b\002\007\002\002\t\002\n\002\t\002\013\002\004\002\f\002"
+	.string	"\002\r\035\352\201\351\374\002+\240\342\234\212\n,-./01\240\342\234\212\n"
+	.string	"\r"
+	.string	"@\004\334\201\306\200\bR\256\373.\037\316LK\227G-\003k\\V\371P\342m"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.ipa_sra.9aeb1a391642f3e9,"e",@progbits
+	.string	"(\265/\375`\033"
+	.string	"\255\003"
+	.string	"\344\002\017\001"
+	.string	"\017"
+	.string	"\001\001"
+	.string	"\001\001"
+	.string	"\001\002\003\001\005"
+	.string	"\001\006\001\b\n\013\f"
+	.string	""
+	.string	"\r"
+	.string	"\001"
+	.string	"\001\020\001\021\023"
+	.string	"\024\002\003"
+	.string	"\002\025\001"
+	.string	""
+	.string	""
+	.string	"  @\002\346\350\035\353\221\333\342J\216=\301\377]\217\214\251\311`\0016\252\r\226\177\267q\272\340\205\0074\337!,~\020\210\273\002\016[nf"
+	.ascii	"%@\021\210!\372\201\377\216-D\017l\031\3444\224\305\005\030\002"
+	.text
+	.section	.gnu.lto_.inline.9aeb1a391642f3e9,"e",@progbits
+	.string	"(\265/\375`\212\003\275\n"
+	.ascii	"\"L+1pi\222\016v*\326+\224\262b\b\243\304}!\006\220\367\354\352"
+	.ascii	"\215\200I\221\367J\372\0272\375\241\006TUU\305b\323\177\361["
+	.ascii	"#\0334\333\310&)g\243\344F\363`\001\013\234\001\206\003E;X \323"
+	.ascii	"\266q\3000B`\".\244#\234\266/#\3030\220!n\002\340\335\357xb["
+	.ascii	"i\3077\205\f\273HS\303\370\251I\260\256\367$\361\233\244\305"
+	.ascii	"\302\260\020\0359\b\301\272:\322\220\344\311\215uu\336\215\037"
+	.ascii	"\306\254\264\255~\3428\216r\231\266\242(\331\320V\221al\377\224"
+	.ascii	"\257\345)\201~ \3336\312o\004\256\"\303.\323?~*\001F\250\021"
+	.ascii	"\242B2b\023K\273\001`\242RH\346\001\022\3401y\006\203)\2202L"
+	.ascii	"\300\2142J\354\214\232\270\265\033l\023\354\b\370\360\372\270"
+	.ascii	"\"\300\0330XT*i\277\327\t\327P\245\275\3457LA\360R\360\227T\230"
+	.ascii	"?\327\333\237\006\203;N\211H\236\326\210\334\240Wu\214'\013\022"
+	.ascii	"\201\302\277>C\346\013\335\215l\310\255\345\256\316\213W\025"
+	.ascii	"\270\273,\223Pt8t\033\016\037\336n\331d\210\220\205\004`\215"
+	.ascii	"\236\322\023\247M\b\272\\\367\263\377*m\346J\030\027\036\252"
+	.ascii	"\020\323\032\314\207\334\036I\323\301q\246\353\260U\373\346\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.9aeb1a391642f3e9,"e",@progbits
+	.string	"(\265/\375`\341\004\225\016"
+	.string	"F\22171`k\222\01605h\237m\344"
+	.string	"\224\001|)\017\b\025\004\223\365+\bA\224%\302a\200\350\bP\245\f\254\333cm#\324f\277}\373\233\220\266\223\f("
+	.string	"&"
+	.string	"."
+	.string	"\020G\034t\207\"$\340\r\267w;\362\366\260\207\261\2767&\021\261u\327u]\263Mg\233\333f\030V\302\361\353\332:\001[\362-\013H\341\363U\366*\361\263\235\254\031\261\322\022\212\332 \221\265\215DP\023\262 \253e\276\344_\022\257\002\036c2\022a\032\211d2\221\244\367\226\030\361\213q\262\030Y\035\307q\306\3444=0V*S(T\005\020\240\362\036\246\276+\236\342"
+	.string	"|2\001\355\327U>q5\216\221\235\361\030\267\366x@\320\263,\013\002\371\215\0375F\206\370<\004\f\233\253t\005\256\263s\214e~\024\005\200\213\250A}6I*\245\235\003\320\302!+n\021@piDHFdd$))\2441\362\005\251\023)J}\245\027-\303\272@F\312\221D]\024\223UK|\366\226G|Eb1Mf\211\311\027\322\357G\036\021\372\275b\031O*\256\027sd\r\223!\240&\307\272\321\026\336\267#\314p\021v\003\273\224=\030\005\026\n\263\214\327\025\312 ]\363\006G\244\266\325\330\366\242\247\334\362A\210V\240\203~uX\"_\245\247\177\026\261R*\327\352\035\300\276erz0\b\235a"
+	.ascii	"\223\fQ\341l\n\333\305\216\235\004\255\273o\367M\273\036\257"
+	.ascii	"\355\236\266\211\200\347?\267\222H\234&\335\001\305c\215\224"
+	.ascii	"\360\377\344\240\t\375\234\204\025\206\r\027\362\307\376K\340"
+	.ascii	"D\371\223\212\023E\347\211\323\336\267\335\030\314\225\237\202"
+	.ascii	"\321!X\017W\3238AT<\177\333\0061u,R"
+	.text
+	.section	.gnu.lto_.pureconst.9aeb1a391642f3e9,"e",@progbits
+	.string	"(\265/\375 2\221\001"
+	.string	"."
+	.string	""
+	.string	""
+	.string	"\017"
+	.ascii	"\230\004\002\230\004\003\230\004\005\230\004\006\230\004\b\230"
+	.ascii	"\004\n\230\004\013\230\004\f\230\004\r\230\004\020\230\004\021"
+	.ascii	"\230\004\023\230\004\024\230\004\025\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.9aeb1a391642f3e9,"e",@progbits
+	.string	"(\265/\375 \357\r\004"
+	.string	"\002\205\021\036\2407\303\001\377\377\377\377\377\377\377?\240\331\377\377\377\377\177A\224d\263\233\234\210\270\235d\n\216\261P\354\3263\261C\354\016;\303\312\302\216\360\034\354\004'\223\376\222Q\340)\264\307\3615\314\002x\nr\250\335\262\021\032"
+	.string	"T \270Tf\007IV\254\003\343yEr3\300.\024%\0308\301i\257P\005\203\034\320"
+	.string	"\326\355\324,\253q \310R\345@18\003\226\341\254\006BZ\302\335"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.lto.9aeb1a391642f3e9,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_taskSerialCheck.131.9aeb1a391642f3e9,"e",@progbits
+	.string	"(\265/\375`<"
+	.string	"\215\b"
+	.string	"\226P=8@o\323\001x\255\220r\314S\267\311@\313\023\361^\305\303\3551\226oK\253\215\220g3J\005\035\021+\241\274~\342\006\221$\335\337\212\323\261\r\027\216\276y\333\233\310-S-"
+	.string	"+"
+	.string	"+"
+	.string	"OP"
+	.string	"\037n\365\030\255\206\311E\tKw\245\334\261\341\312\360\273#K\201\224VF\222\270\022\303\320\335\227#\tc\317\373\377\340\277\303\177\222?\370k\376s\245h9u\367\346\013\231\235\227\362\337\220\025\001\327Tq\200\356\f\323\251\273n\216\220\331i-A\265\223\332\201j\347\377\265\367\314\226\005\213^\311?4!wd\266D,\376U\224\314\361/\325\335}\336\370/\317\024\246\244bp\322=zq\351\224\211\362\361\236'\333\264\316\365Ed\r\002\236'\333\264\316\007\312\272.\204\005\034\343x\020\336\365=`\037\212}(H\2736\212u\036\345\024\234\223\310:\372q\\G5\001\t"
+	.ascii	"\0253\241L\213`\330U]|\327\220\210\t\021T\243\200\272hj\347\023"
+	.text
+	.section	.gnu.lto_taskHandleSerial.132.9aeb1a391642f3e9,"e",@progbits
+	.string	"(\265/\375`\256"
+	.string	"U\013"
+	.string	"\266\024NB\020o\225\016\200%+\377\220\344\257\\\220\0217\334\331\t\016@\036\363\344iEU\254d@M\201\326\320\257\367-"
+	.string	"\346\356g\317\f \225"
+	.string	" \017P\001\321\013\201x\366\273\026`\252\364\245\377\311&[\246\024:"
+	.string	";"
+	.string	"9"
+	.string	"\273\313\311\013\007?5\251\240\237!\216>'\247kR\\\321B\021B<]j"
+	.string	"P'\"p\210&\255\002K\2518\353\352@,\251J.\273k\rE\b\367v\333\004l\013\260\017\022\277\252\372\222\001+c\021\342\332}0{\261\257Ib\003\305\366\325>\207\253\300\257\030\030c\227\202K\304\356\030\300#\223O\221W\266O\355\036\333\247A;\366\021\303JR%\032|\220\005\326"
+	.string	"\241z\225\344\350\032B\324K:\264]\"h\2450\251\013\373\035\356!\344g\360\002\221>\374\364E\333\347\345Y\357\210\231\220@\322\231=\216TZ\260\257\355\356ZV\260\277\n\237\201LgS"
+	.string	"\344\311x^\250\333pg\3718\037\006t\240\323p\235\206\363l0\035\256\363>\316\362\341O\202\214\307\201>\037\217\243\214\373\013I\226&EmNG\352\210\026\260\t\332Dm\005\237>\f\023"
+	.ascii	"2\003\302p\311\302Z\021h`\366\202.\240\326\005\256$J\026\\\025"
+	.ascii	"aW\322`\241\300\224K\260\304j\312\270\3137\333\223\n\263\242"
+	.ascii	"VA\001"
+	.text
+	.section	.gnu.lto_taskBatteryAlerts.133.9aeb1a391642f3e9,"e",@progbits
+	.string	"(\265/\375`\302"
+	.string	"\315\013"
+	.string	"\026VQA\020Q\234\016\177Y\001\313\0244c"
+	.string	"\036\247c\203\\\033\361"
+	.string	"\340\025\376-\003\2267\n\271\320\304\214\020\241\373\033\303(\342\207\363\230\276\003x\206l,\025'\200[\201!f\256\360iOC\262\367\226)\005="
+	.string	"<"
+	.string	"?"
+	.string	"\233\375\342\240\307\036$U*!cw\257\310\341\333e\324\315?\352\022\357\343.7\036e\002\221\0241\006|$Y1y\360\216\272b\370:U"
+	.string	"\rv\327\352}\247{\336\266\003\333\013\3543\bq\203}\271\273\353\330a\253\332\372\307?U}\311d\203\205\201\025\273\246\221\031\033N\025\037(\266\257\366C\\\304\366\217\013\226\354j8\021\262\013*0\002\353\363\300+\325\247<\201\352\323\001\226\332\0254\275\347"
+	.string	"&h\204]\344\356\221\022\t\211\266TV<\352V\013\020\027$M\371\267T\217V\264\2268\272\2178\211\220\337\301\026Dz\357\323\027U\237\217\023F\r\020\034#\035\261AN\003Z\204Lg\003\001\344\311dY\b\023`\354\242q4\fH\002\246\2710\315\345\331`:\027\226i\327\245\200?\0242\331\005\372|\262\213\002\356\345\306\016?\310\020\216b7A\233\234(:\243\315\351(\212/$EN\006\023"
+	.ascii	"3\241\201(\006\210\243\\u\330\246a\254\232\023]\206\007x\023"
+	.ascii	"%\013\256\256\260\213\037\314\261(\373\n\246\\\202%VS\304]\236"
+	.ascii	"\252\311)\232\332\003"
+	.text
+	.section	.gnu.lto_taskUpdateAccelerometer.134.9aeb1a391642f3e9,"e",@progbits
+	.string	"(\265/\375`1"
+	.string	"\205\b"
+	.string	"v\020=8@\217\322\001\230\265\307\212\231\031HB\217\032c&\301*\361\266{\242\357:K\375\037r\252\233\205\030\354A.!k\325\254\366\250\345`0)%q3\374\321\366\311&[\246\024*"
+	.string	"."
+	.string	"*"
+	.string	"\331\245?;\346\241\307nZ\030\027)3\273;c\307\277\353\347\277\344\035p\205\272n\024v\327\n\2564\356x\333\007\266\023l\257\004\221e\337\365+\006\020\362\362\221\331\315\250\241\331\227l\001\361\330\276\332\0379\311wW\205;\273\034.,\273!\202?\234K\203\023d\227\330\007\002*s\324G\211\270\311O<\377\343\322'\t=x)p\303d\227\032\355\t\n=hU\331xYD\224\035\2524\266\354c\273\273\016^\303F\0321\230J[\327\235\264"
+	.string	"k \357\301\013\231\0344\321\324D\2634\n\221\246\326y\023T`\016b\353\246\211\343\272\351\tS\3076\262\274 \362J\305\t"
+	.ascii	"2\241\243/0\\(\033\025J\301\220K\260\304j\n\270\313\213v\222"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_taskUpdateRxMain.135.9aeb1a391642f3e9,"e",@progbits
+	.string	"(\265/\375`s"
+	.string	"\305\t"
+	.string	"6\322C:0\257\322\001\004\356\237(\370C\301$\332\r\002\247\261\026HRS\277\274\231\306\005u\260\206}\214h\2415_\021$\303cZ\013C\022N1\372\234@\262$\311uD\210\354\275S\n1"
+	.string	"4"
+	.string	"1"
+	.string	"\264\335\255S\344\341\351\224\241\037 \242N\273\216Oj\320\372\250q\304\024\355\264\310V\207]j\210*)7\237\335\265d\211\0347w\333\013\266\025l\317\0021\332\f\301ew\3436\2632n\205\204c\373\322~\311M\302\2770\f\260\033\242\022\333\035\023|\320\235\353\234@s\216~@s\316\241\035\363qd7.\217\025J6\220[\312\364\205\346\023\342\004F%m\346$\235v\205\205<\353\363\260w/,cMF5Q\366\210\222\323e\237\356\356z\266\354\277~*\245\277q\b`C\2104b8\225B\337G\341\t\330\363\200\021 \350\364\340\211\252'\252\245\021\210T\275\017\254\236\002\233$B_=\231L_\345\214\373O\306L\321N\332\023\240<\313\363\001\017"
+	.ascii	"2\003\302\260\036\302V\r\204\205\275@5\017\274\266\356\305\027"
+	.ascii	"V\021@u\261\213X\215\026w\271\251\366h`j\017"
+	.text
+	.section	.gnu.lto_taskUpdateBaro.136.9aeb1a391642f3e9,"e",@progbits
+	.string	"(\265/\375`\177"
+	.string	"-\n"
+	.string	"fSG> \305j:\340\220C\007H\242;\023h>\016\r\017\276\016\005"
+	.string	"\302\226' PVm\b\375]M_\212\b,c\306\201\302\021\004\204 $$"
+	.string	"\201\201,\007$\023\017sP\210hm\357\235R4"
+	.string	"5"
+	.string	"4"
+	.string	"\333Q\220\213\257t\212\376]\327\214\244\3515\343qZ\023d*\002^~r\220\250\272I\205\214w}n\220\24791\013\273\3539\222\035\267v\333\f\266\025l\007\b\233*@`c\332\212\210\375\322\346\316\331\376\264O\362\022\361-\fkv?R^\273%\307\b\231k\007\337l\327\352\013\266k\026m"
+	.string	"/Y\213Y\265h\234\f\330\r\246g\315d/\352\213\3554\302\344\0055g\336f}i\263+,\346\307\323\001\224\221\030\212\232\354\3224\351\312~\335\3355U\331o\375uN\037\303\261\270p`\033\341\303G\024r \215> X\362\b\354uB\211\320C\202\360@\235\007\352F!\217\250\363\300\260\353\030\370\233\370\200\035\351\373\300\216+\367u\251\312\r\260X\006=U\315\264?\212\3711\016"
+	.ascii	"3\241\367/\306\325PU\330\013T\363\300\013\353\336na\275\270`"
+	.ascii	"\251i\221X5-Nr\314+\361\fj\017"
+	.text
+	.section	.gnu.lto_taskCalculateAltitude.137.9aeb1a391642f3e9,"e",@progbits
+	.string	"(\265/\375`\026\001]\f"
+	.string	"\306VR@\020q\233\016< +\262S0\344\031hE\214\341 \331"
+	.string	"\346\261GZ\016\340\025\220]\3267\232od}\006\237\270\250\rW\377v\022\310\""
+	.string	""
+	.string	"D\020\207i\b\005\361b\216x\275\301\336dK\231R="
+	.string	">"
+	.string	"A"
+	.string	"6\214w!V\372\304\300\200\242\306\356F\005\361\3540z\232\231/}T6N;\344\360\350\302\2338\013\251\024\327y\035\273\373\022O\017\307\311\224>v\327\271q$\267t\333\032\333\t\354;\bow\327Zb\037\364O\231\326Lg\246o)\200\322!\005%\246\330\325\220\343\306\206\242\025\"&\333O\373#N\";\210\202+\273\037X\250\330\355\020\370"
+	.string	"\200G\035'"
+	.string	"\037\275\017\200\217\234\005'\002T)\017\216PG\237~N<\265\301I%m\013B~KM\223\026&)28\271\273\232z\002\274\336\004\310\303\f\027/:i\3030\337G\240\035AB~\273R\036\032\241\216jv\247\245~\354\007\330\202\213&\243`#r\271\256\221\312\342\312\003\013\301@6\f*L\2540Q$\003\242\211\325\205E\017\003\266\036\\\256\270\261\254+N\335\376\255\226X3l\bUP\016\f\220\223\332\231\220\374f\212$\273]-R\305\004\032"
+	.ascii	"3\241m)F\214\301\210\277\327\3024\005t\271j\023\344\353\206m"
+	.ascii	" oUvX5\205V7\200\204\\M$\r\266\f\230u\t\213X\215\026\356\022"
+	.ascii	"\0300\t\305\201,\240\2705OoW)\003"
+	.text
+	.section	.gnu.lto_taskBlackbox.138.9aeb1a391642f3e9,"e",@progbits
+	.string	"(\265/\375`\201"
+	.string	"%\n"
+	.string	"&\223F?0\247*\035"
+	.string	"\325\371\302`\013\315\241\226\003\375+\355\305\203i\020na\255ACtJ\r\013\275\277\341=\341[r\203R\032:\001\2056\243R2\341\026P\342\r\245e\f\367E\215\354\275eJ\0013"
+	.string	"4"
+	.string	"2"
+	.string	"[iqh\bP\260\273Zl\335\273\214\352\371\025\316\345\003O\227\026\220\307\f\250\222\232\335\375\353\272\001\246T+\234\335\265~\240\307=o\373\301v\203m\006\001w\375S\325\3172\256\003\016\261\335\216X\203\205M\003%\030\333W\373'G\361\356\312\360eWd@\201\335\220\301\013\226O\315\023\262Oy\204\354\323\236\235\340\341H\372\3172\2364F\226_\312\036)\002 P\351\002\373)\007P\362I\214a\322\177\237\276)\373|\214\037\004LBP\032\263\303\224F\226}\271\273\353\270\262\003\235\204'\004\212 \211<\034W\332\016\274m\272\212\256C\232\330>\332\366\321D\240NH\333\270N\333(xd\341\3414\322h\304i\230\020u\371\270\202x\301P1%\245Eg\264/\272\020"
+	.string	"3\203\200\030Z]\201>\260X\241R\2078\341\004\033\202k0"
+	.ascii	"\313\305Zb5\005\270K\300\200CM\336\256R\006"
+	.text
+	.section	.gnu.lto_taskTelemetry.139.9aeb1a391642f3e9,"e",@progbits
+	.string	"(\265/\375`\223"
+	.string	"\275\n"
+	.string	"&\325L? O\225\016\220\265\013,-\264Q"
+	.string	">dD<b\260\232\006\006\221\027@\202\201\t\206\305\321'8\fx\004\265\204}\332$\372-\365\020"
+	.string	"\024\032\027\246\232L\244r\023N\367m\215\354\275eJ\001;"
+	.string	"9"
+	.string	"9"
+	.string	"ai\035$\f\021>\264\330],\222\336]F\355\374\237\016\371@\357\362Q\341Q\002X\211`1\001A\222\022\322\360\375t\225"
+	.string	"~T\035\004v\327\372\201\023\356y\333\005l\013\260/\trw\327Qd\337\364KU\3371Qab\300\211\335P\353\305\252\346\210\r\021\333W\373\034\336\241\273\t\202!\273\027@\244v\303"
+	.string	"\336x|j\234r}\312c\\\237\356\354\024\017\241\367\227X\253T\214#_\273\036\025\240P\200\224e\337\303Q\232\237\301\f8\375\367\351s\327\347c\244@\302\205\005\217\266<\325v\360@\377YC\224P}\242g\207\236\306\221\375\034\202\313&s\240\303\271l[\203L\342\254\302i8K'A\206\3012\f\306\311X6X\266qX%\303\332\202\313\206u4m\303\"\341^n\024\031X\241\362\304\217\214\250\214\266f\243\377,\243w\007\f"
+	.ascii	"3\241'h`\255\267\350\260\027\241\232\0238a\002F]\302\"V\243\305"
+	.ascii	"]\216\331$\rL\355\001"
+	.text
+	.section	.gnu.lto_fcTasksInit.140.9aeb1a391642f3e9,"e",@progbits
+	.string	"(\265/\375`\272\n]3"
+	.string	"ZW\004\023E`\236\326\030sV\361Yq\304'\023\037r"
+	.string	"\345\236\226@\035f>:\365'\202\367\201\370\306"
+	.ascii	"^M\324J\r\376+h\274\022?\034.\312\360\302\016\206)\243\033:?"
+	.ascii	"R\025<\253\273\2155\226P\032\221R\246\224R\027\001\b\001\037"
+	.ascii	"\001\3169\2543\261u\036\266\3168\255s\260u\006\256\316?\237s"
+	.ascii	"\273:\373z\316=\326\231]\235\327\325YU\235\377\235\335\235\373"
+	.ascii	"\003\2027f\r5+\357\005\372zM\333\274\321\225\316G\277u?\333\231"
+	.ascii	"\273\235\r\307\300\247\220\023\357\315\255\201\257WN\300\300"
+	.ascii	"\355\267\026\305#\364\365z\360L\362\206\367\276\320\245^Y\311"
+	.ascii	"\327+\273\314c\032\272\366\266\\\025%\022\274\367}\233^\255\335"
+	.ascii	"\356\341\331\321\311!\016\2058A\340\257\365\365\330U}w\271{\021"
+	.ascii	"Z\256\345\261{x\330x\370N/\302\r0\266\326Q\025h\341\325h\273"
+	.ascii	"\257\035jp\215\262K\003\371\322\3419l9\234\330Yk=\\\023\332}"
+	.ascii	"1\315\034\247\254\203e5\034H\326\277\266\373\"k\270&\002\362"
+	.ascii	"E\303[\242\033`c\355k _c\336\263\373\232\001\\*\235\335Z}1ZU"
+	.ascii	"{\274zp\t\227Z\252\001)\2244\300e\322_\270D\252\305\367}\033"
+	.ascii	"\256\275k\231t\357Ex\337\227\235k\t\326\354\323\314\215df\f\314"
+	.ascii	"m4O\302,\315\367\275\005\357\373\337SN\371&\253\3356\266\367"
+	.ascii	"\013\276\335(\245 }*\244\241\270mOz\316\035\342\026q\235\256"
+	.ascii	"\223\355\265\367$\230m\230\316g\321\331o\271f\226@a}V}\007Ih"
+	.ascii	"s\035\273\376Z\267E\004\351S\376W\277+4\023\013Jz\311\005\f\031"
+	.ascii	"2\260\275\376\263`\236a:\237?\316\324k?\261\314\0326\f\335\242"
+	.ascii	"Z\177d\036\367g\356\340\241\230\374#\367\373\037P\276a\376\320"
+	.ascii	"G\242|\357\233t\3426\322qR\334<z\345)\2437W\257\334F\266\327"
+	.ascii	"\3766NL\3363\313\247\034t\346\021%\274\271\230\207\315Y\236\024"
+	.ascii	"\371Gf(\322\277\311\334\352\373i\314=g\250~kv\352g\363\202\325"
+	.ascii	"\271\300\352\254\264:'\255\316\004Zg$w>j\235\215Z\347\242\326"
+	.ascii	"\231hu.\266\316C\253\263P\353<`u\026\320:\007\255\316\001Zg\240"
+	.ascii	"\325\371\247u\006\300:\373\254\316=\2533\217\352\274\303:\353"
+	.ascii	"\264\001\337\256\262\247\026\334\364"
+	.string	"\033\327E\227\373\342\005\333\353\316+8R\347z\225\240\213\"\377\350.;L\212\367\375\304\022\321\371.\323a\235\346L\243q\305d\270c\356\030\333\253\316\037I\231e\336Ol\220\256-\370M\316\361\234\357\2603<`\213i\035f\264\350\304\357~b\311:\214\253\346{\337\327\211\373\256\301\270ef\256\r\033l\257\304\007Jsc:{m\215t\356\347[j\022rx\312'=\246V\372\256\341\203h\264\341\033\227sy\322\037W\372\026x\246\365G\266\375\246\372\276O[\352\244\377\356}\223}]j\341\0277cT\246N\372.\272\206\372\206k#\035f\\\332\357=\324\263+a }\352cq\0168\361}\333Uc\231\335\034\356\016o.\234\357\0259K\376Qe)N\267\265\365\233\375u[\320\304\250\337\324\322\301\017\342`\353--\242\301\357\272;\177\337\367\370\337\344>\301\002_\b&\016L\322\327\370\350,-\260"
+	.ascii	"\177\204\231\333\357}N\377\373\337\223J\020\266}\247\037M\305"
+	.ascii	"\r2"
+	.string	"\245\rF\021RW&\2508\\\2410VU\251\240\260\242\312xu%5\301h\245\"\207\247\020X\225\260\222\272\212\232\n\3214\025\242\t\305\b\251\023MSUVM\b\200\230*\205\261\252\351\212\212\252\252\t\b\315j\365\3754\2062\213f=\222\177\234\300\353 =\001,5H\357lC\240;B\316\362\244=\276\326j\202\320\326\356x\332%5/[[\232d\331\371&3\027}8\3476Z\030\205L\264h\f\315\214\216\257\243\330\243\257\212\273\303\312\363f\224\243y\032\026\033,7XS\254)\333\353\3217\251\2711\2359\306\262\271\034\341R\013\271\270\242|2d\352\002F\017\302g\364\3062h\2364I\334\241\213j\025x!q\207\0219+\303\"\261.\372V\343B\242\177\273e\023=R\224\266\342\343\f}\2218\364Ia?\204>8\340\205\324\001?\024\205L\300\003\203^\200\017-\350\221\302\304\002\374\017\350\003"
+	.string	"\375\020\3304\232\374y\026\300\377@@\272Z\336\\"
+	.ascii	"\336\331d|\345\251\375\304\366\210I\363\244Z8~\254\342\363\303"
+	.ascii	"\236\367\371v\242|\303\363\335\244{\236\025\263Ed\347y\002\200"
+	.ascii	"\327\250\2010c\231D\"\"\"\"IARH\007\260\002\021\241\252q\003"
+	.ascii	"\0200\205\214j\222\f\007X\324\037\032\356\023z\020\\\312s\255"
+	.ascii	"\022\021\t\2625\037\230\302J\240dy&\f&J\r\200\311z\270\226\211"
+	.ascii	"F\3139\312\275\343-c*\321\227\366'\354\302\350\"t]\r\210\233"
+	.ascii	"\242\371\341q\006\030\277\335o\222\257\017\211\214\213\331\365"
+	.ascii	"\315\036\215xd\277?\306\251\315\"^\233\220\203\024\305(\220\327"
+	.ascii	"Q\024ta\013\377f\344\224\375\230\314\241\254;\306\034\026G\365"
+	.ascii	"\332\351\024X/m\322\002\323 \034\257\274\243\313\324\2164[I\240"
+	.ascii	"\362[\2273P\242\r\024~[\312\313\317\302\211\325\210,\334\"@\222"
+	.ascii	"\320\003\"\303\331*f\307\262\253\352\0200\226j\004\241\211\""
+	.ascii	"\\\222\331\350\310@w\207\320\371\314\302*\272@4 u\313\240s\351"
+	.ascii	"\360\202z\316\212#Hl/\362\3461\233;\362\346P\275\305\026z\030"
+	.ascii	"\343y\203z\357S\374\002\nF\2073\325w\211\033\304\210\0231\232"
+	.ascii	"\273\244:\224*\346\333\337\310LRlSB_+e\327\201\234\016C\007a"
+	.ascii	"\023\252#\204~\004\352\347\302\330\035K&KJG,\300R\232\234\311"
+	.ascii	"R\302\n\337\211.'\314\327e\255\323\216\037^lC\233\017\016\302"
+	.ascii	"\362\007sA\303|\"\273\034\031\221\230zTHQ\325\375\362\271{Td"
+	.ascii	"\362\023\3621l\341\222\006F\037\n^Fl\215Oh\246&\233\223\033~"
+	.ascii	"\\\313\200!\225\234T\013P\360G\366\255i\026\324\230Mv\200\251"
+	.ascii	"&\037w\250\314\257O!\016j\376\264\251N\005"
+	.text
+	.section	.gnu.lto_cfTasks.141.9aeb1a391642f3e9,"e",@progbits
+	.string	"(\265/\375`\b\006\215 "
+	.string	"fu\313G`hU\007\2718\231\321"
+	.string	"!B\020\344\346A&\017\371Y\221\232\002"
+	.string	"+,3\r\200\242B\342\234\335E\254\264\201#\377%\206o\244\375\351\277g\373\277~$]:\363\323y\034%\322<\335\226\374w\305\215\357\277e\222\001\273"
+	.string	"\271"
+	.string	"\267"
+	.ascii	"\202\224\262 a\003\326\304\317\206?W\033\"\016\231\245\374\340"
+	.ascii	"\241s@f\315\217u\204\300s\370\320\370\315\360Gs&\t\207t*\225"
+	.ascii	"V\331H\330\325-f\264\366$+\020&\376-\376c\304\020qH6\363\016"
+	.ascii	"DW\267\264\314B_\006\270\f\277K\374^\370\203\371\"\002\207\304"
+	.ascii	"3b\225+\224\350\352V3\331\340\017d\031>V\374L\376YZ\210\270\250"
+	.ascii	"83\316DW\267"
+	.string	"\234J\252\345\254F2E\360\tf\257>\225\341/\343\277\342o\205\251\311A\361\311\311B\025\"N\212\251,\026e\025\253\374\240\366\252^\321\367\002)&V\327X\261\350\3642^M\3450\257\313<\203\331\253:\252\365l\r\335\266\344\242ZFU.\373\006\3379p\364%)\224\230\325*\177\263;\3516\253\252\035c\313\340\233\306\236AL\217Z\177\365\244G\261]\251B\237`\346\202o\371E\263JJW\237\315A\361.\362\355\264Y\364)\251\321\331\251\254\362O\365\253\256>\235\363\367H\322\374\304\377\207\377\030\240n%\205\0324\263\253\3743r\335\006%I\265\034\222\272\002`O\374Q\376|\304\332\364\350\265[\345\227\335\256B\275\264\023G\200;\374\303\360dH\217v\212Vy\205\257\253P\260\2419\374\353\3201J\217b\300Un:\352*TL\300\233\370\275\370\307\201\243!=\006\232\203\253L\242CW\241\001\267"
+	.ascii	"\372\257<\226o\376\226w\276\326\223\3712\237\346\325\274\233"
+	.ascii	"\357z9\377\365v\036\354\363\274\236\357\363\363\007zA\273\005"
+	.ascii	"\205\rc?\355\032\333\306\326\261w\354\250-\265\251\366\217-d"
+	.ascii	"\017\331U\023v\023\t}\307\346z\356%|[1\001\233\301jP\335\306"
+	.ascii	"$l\023\031\356\"\3616\3027\222~\334J\230\232\036$igQ\344W\355"
+	.ascii	"\210Qj\214\316\337\025\325\325\247\230R{\315\366"
+	.string	"N\362\035d\003iS\343\330\232\251\256>\307\346=\305\267\217\036\304\3248h\214\217\256B\231J\331\346\321\177@\361m\354@6\222\251)\302\261\013I\217M\"\253\374Z5#\035\211*\247\331\225\004\272\250\205\201A\240\220\326\271?\231\366\275\301\235\252s9V\006\2634\275\341M5\217u\337\026(\2441\344`\366\007tu4\335\356X\230\347C\202{\355\373\036\345\nh \374\266<6)\370\2660\314\022\021\320\300\337N\246\201@\366W\344\313\255\332\367\262D\252~[]\317\275\320\356z\354;\244[\335\021\354\302<\226\246{>\027fw.\022\333K\342\371\006d\310\261<\"\232\016\276p[\324\362Z\030\200ns.R\253\313\2754\275\301G\344s{\356\217\246\205\020x\t\256\224\"I\030\342&\fq;1B\311\304M\270\304o\020\024\350!\n\020K\267\024\303\341R\200\201\25018\205\230\305L\232rJ\222\345"
+	.string	"#\021)\242\007\0200\245\250\210u\261\207\236`\314e`\325\216x##SG/\337\212-\256P\032\220\351\263"
+	.ascii	"\264^Tm\213L\321)\232\251$\036CQ!\024\206\255y\242\b\340\324"
+	.ascii	"\236\216n\216NKa9e\016\2177\336\3009\266m\267\360\347&_\223X"
+	.ascii	")\377\334\225\f[\013\233\343%\243\251Y \321Y\251\211\233\223"
+	.ascii	"\207\377b\321\307\276N\335\0276\363ym\r\007\322F0\276X\005\367"
+	.ascii	"^x\033]\300B\304%?\002\310\350$ \304\213\360\031\260\177\027"
+	.ascii	"\022\004\210\360\017\262\b.[\316uh\305\360\033L\265\001v1\020"
+	.ascii	"\261\355\366\261\237\265\324\313a2\266\346h\261\376\330\342\326"
+	.ascii	"\261\214\275Fh)\310\342~`\022\034\373\267\230\230\322y\220\\"
+	.ascii	"xf3\374\016"
+	.text
+	.section	.gnu.lto_taskTelemetry.part.0.196.9aeb1a391642f3e9,"e",@progbits
+	.string	"(\265/\375`\276"
+	.string	"=\013"
+	.string	"\026\325K> O\225\016P\314\001\340\002\302\005\350`\310\344MP\022\310\021\265\226\205\320\200\230LX\034\247a\214\035\b!\224\250\227\037A5\234\007\200\b\241\361L\003\244\002-]>\317\267\204\354\275eJ\001:"
+	.string	"7"
+	.string	"9"
+	.string	"\025H\274\330\335y\tG\347\036\241J\316\277\351\216\316\353<j\347]8\214\bT&\\\b\360>1\002\362\320\335t\265\340yT\007\\^\013v\327\r\f\267u\333\fl+\260?\003~<.m\253\376\343\274\264\211\337z!\253\332\017q\021\334K\033;v5\224@\355~\t.}\240qi\340\021\3532\036b]\332\007a\233\0232g\257\370G\332k\324!Pd{\202ux\016#T|t\345K\033\373\315\2625\022\364\335!\201S\212\324\007v\024\212\fe\\\270\301\376\367+T\377\202HP\354\202b\300\330\f\362\304\007\333\267o\3428\233\003\312\305\322 \203\241h\232\006\013`L\262A\330&\231\007Xeb\225\211\261L.\023\323\266))\340,\002E\233\231,\323\346\343-R\024\240\3070f\250B\373\222\351;\0038\2618i\245B\301\025"
+	.string	"?\023"
+	.ascii	"\346\n\026An\203\275a.\242n\305\232sd\260\004\220\007F\270\016"
+	.ascii	"\237h\366\316\320PN9\2633\200\315\344\235f\203k/\246845\356]"
+	.ascii	"e\f"
+	.text
+	.section	.gnu.lto_taskBlackbox.part.0.197.9aeb1a391642f3e9,"e",@progbits
+	.string	"(\265/\375`E\001m\016"
+	.string	"\346\032aF"
+	.string	"\261&\035\200\3216\366\333\227\210h08\325\277\200m\346\375\n\342m\347pm\240c\215x\025|!\217\236q\341/\243\001#\325\233\255X\3216"
+	.string	"\024c\351?\356\025\214\270\225k(\226m\030o\350\326\310&[\246\024J"
+	.string	"J"
+	.string	"N"
+	.string	"\227\366_l\243T\234\262i|\252\266\323\262!\203\314kw\265\313\330\362\324\261\2502\345\237\365\017\030\232\034S0\344\360\210!p\275\250\001 \3740\217\224\022\340YW\r!\212j\200\313N\203\335\265\247\303\235\335\266\003\333\037\366=\004\366e\276\202\304#\002\246j\345\301\t\0311^\273S\273\364\364\334\276I\036cY\323r\331]\320}\026\312\006\201\254\372\211\372\252\004\233\033\252X\325\276\212\303\244\276*\361g7\304\f\315\356Tp\351\003\236\313\002\367\310.\261wd\001\217\037\0213\343\323\033\333\245\317\230<\273\337\002\277\305]p>\211K[\360\364\340\245\357\305OM\013\005\314\211\346hdq\224\330F\021\366\347\257R\375\254\303"
+	.string	"\316nJ\016\316\202\2200L\260@y\004\333\017S\265\302\300\305\225\342\265\337L`\007\236\020\302\300\201\2246\021\005\020\002\336\307\310D\202p\022\031u\335\205\215\303[\310+y\242S\204-D\333B4\021\222\310\244m\235\247\205\006\230\2530\352\264\023\307u\032\350+\233\223\210\202q\250F[\002I\017z\243\365b\363E\023\307_u\343\242\211\221\305\266)\013\034"
+	.string	",\205\327R\003\223\025\002\3468\026!{\203\302\201X\210\036\351\036\246\025\306J@\036\030\341:<\305\262\001\224\t\367l\005D\204\306\2153Z\034a\351\234rfg"
+	.ascii	"\233\311;\315\006\327^Lqhj\334\273\312\030"
+	.text
+	.section	.gnu.lto_taskUpdateBaro.part.0.198.9aeb1a391642f3e9,"e",@progbits
+	.string	"(\265/\375`(\001\235\r"
+	.string	"\206\330YD\020\217(\035\020P\005V\b\344\n\022&\031\342X:\265PJ"
+	.string	"m\034\3419\016\262\207P\3566\017\374\243~\353\326A;\007\022[\276\"\331\016\200)\200ZRT(\210{\021\\2\307/\346\017\210&{\313\235RD"
+	.string	"E"
+	.string	"D"
+	.ascii	"&\213\354\026\017M\026\343\244\002\203\352\305\356f\237Zr\321"
+	.ascii	"\245\306)\362\237z\306\007\216."
+	.string	"\343\007j\270J\003-\026\027\032`IfF@|_=\212\200\244\0307>1\026\354\256\261\r\367u\333\016l3\260\237!)*\2205\245pA\223\255\002a#\023v\"dE+\001v\324}T\310O\031s\022z\b\242\351p\340\3231\332\037q\022\242\207 \316\330\375`be7D\360\351\002\330\247\346\231\353S^\300\365\211\371\274\b\333\241\254\020\035Y\177\223\226\326\212\352\3116\350\272\022\340\360\202\302\242\024[|E\333\343#\376\273~\365\227\210\240X$\035E=Y\247\\%\271\177m(p\331\035yqY\017\023E\210\247\374'\217\366\375\022G\361W\001\033\307\241 a\2635\370\3308\214\007\302\326\341<\370p\233\347yh\001\254qx&x6\237\bZG\246ud\034g\323\3114\317\223q\fpWa\363\262O\327yY\274\\%I\035SI\301\272\240$\t ^3\357\\vg!\376\263\206\nK\036"
+	.ascii	"C\013b\271\001\0171\256\013t\213\364\336\204\306>@\024\fs]\323"
+	.ascii	"X\326\326\224%`\b\220\017d\034\005\202\254&&\303\360\026\215"
+	.ascii	"RX\027\210\202`\356\031\272\250s:-\264\231\262\323@p\355\305"
+	.ascii	"\024\207\246\306\275\253\214\001"
+	.text
+	.section	.gnu.lto_taskHandleSerial.part.0.199.9aeb1a391642f3e9,"e",@progbits
+	.string	"(\265/\375`\034\001E\r"
+	.string	"\026YYC\020\221\232\016K/Q"
+	.string	""
+	.string	"\020\b&\350\025v\314\231\023\202$\345St\250Ns\242\026\370\\G\326\264\026\337\212\r9\b\006\325\276\023\020HG\001\270B\200\013\342\003F@\222*\213\n\250\345\215\310\336R\246\024C"
+	.string	"J"
+	.string	"A"
+	.string	"3v?\006\217N@=V70=\302\027\230\0367\217Wa\373\263b\317\256\361\257\304v\214\240\021\221jv\327zT\022\367\256\t=\037t\r\260\201\303\223\300aG\310\356\232\352p\307\333n`;\202}\017\0010\375i\300\203\017\273*%\034\033\"\3228q\231\037\346i\337>\213\217\377\342$od\314\001\371<\346\304+6\007\304{\314I\005\372V\205\323B\263\242\306\001\365\b\363\371\207R\201X\360\350L\373-\356\302\373\207b"
+	.string	"\273\"d\004\033\372H\325\036\361\344G\2564(\310\251\252\240\245$\312\361#\230\256\251N\021KJ\226\354\303x\f\3157a\f\\~\364\350s\323\343\365\244\303\024(l\334`\te)\365\305\n\017W]\354\230V\230\316WwA(\341$d\335er\341\312\220yp\0242OgBG\222m\233\t&\300\330\0077\302]]\005L\304\302D,\222\316\345\261\260\215\263>\016X+\3116\253\323\264\315\332\330\316\253\213CB\232\242\372b\333#?\203e\237\261\320\2416\033"
+	.string	"8g\340W\357\201$Z\306a\025\272\262\n\020\020\005\303\\\341hc\305\346*\244\316\023\257\f"
+	.string	"-\f\365\224\302b@\036\b\341\236Q\212:\247\323B\233);\r"
+	.ascii	"\327\036p\243E\364\273\312\030"
+	.text
+	.section	.gnu.lto_taskUpdateRxMain.part.0.200.9aeb1a391642f3e9,"e",@progbits
+	.string	"(\265/\375`n\001\025\016"
+	.string	"f\031\\C"
+	.string	"\221(\035x\035\276\211\270\352Jw\2365\215\256\022\270~"
+	.string	"\n\277\270\312\306\032>\247\276\222\233ZM\327kU\024\310\002\371\227\036\377sD\257\001"
+	.string	"\030\200\326\027\362\f\221\342Lw\270\330k4\262\367\2262\245H"
+	.string	"H"
+	.string	"G"
+	.string	"w\261l\326\372\200\001&\307\356j\207*\342\247G\3704\263\223\237yv7"
+	.string	"\013\365\330\341\360\202\205|\271bm\270>\0061\0307\006\260T\257sRb\365\227g\006V*\323\300\263\314\263\273\326x\2705\267-\262\375\300~KNM\237\243\300\005\201\224\335\223\231\035\253\002c\230\270\313\355\2470\371/\336\270\230\356*\361"
+	.ascii	"\321\340\320\231\366U\274\345tW\211\001\354\206x\021\263\353"
+	.ascii	"rp\350\005\232C\217w\342\341\373\201x\2709\374\t\333&\024\237"
+	.ascii	"l\032\001v)^'\254\230\241J\031s\362\035\024m\221\220r^6`*EY\223"
+	.ascii	"v\205.\2772\002\0310\035\261\224\242\374\227\242\317\3420%\237"
+	.ascii	"\204GH\362\253C\237$\036\216\340\240\222\202\242\206I\316\244"
+	.ascii	"\266\254\331\337\352\212\255\031]\204O\b\004\201$\372p\334\310"
+	.ascii	"&\300\333G'\322\201\220$l!\332\026\242\211@ !m\343:\355#\201"
+	.ascii	"G\024>\234F\032\2158mc;\257+\366\230h*n-4@m\275\236\005R7(0\225"
+	.ascii	"\242\336\207\363\302\001\323\237E&\026\243\332r$ \260\202\231"
+	.ascii	"2\363(\206\330\227&ga\fm\222;\207c\013\3126G \026\206\375\030"
+	.ascii	"\202\316\022\354\377\332\262\233u\241B\353x:\310L\346l\223e\265"
+	.ascii	"\2266v\277\254p\273J\2218M\200\226\224M\003\245V\326\256,\212"
+	.ascii	"\314\240\325\270w\3211"
+	.text
+	.section	.gnu.lto_.symbol_nodes.9aeb1a391642f3e9,"e",@progbits
+	.string	"(\265/\375`\347\b\335\031"
+	.string	"\366&\214G\200ZN:P\270\345\\\377e"
+	.string	"q\302t\2379~\265\030!\376Z\004\321\331\243\276XS\005X\371\340%\26719\212\355r\237\366\032\375\034X\007\326Ab;\352\232\243\334\002^*\305\177\200\251}\224\2267/R%I2w"
+	.string	"w"
+	.string	"u"
+	.ascii	"M\236\256\345\364\256\246s\221L\217B.\365\203\214UL\251\257\303"
+	.ascii	"\327\357\221t3$R_\355\250o\216\003\372e^\213u\227hN\331'\363"
+	.ascii	"\b\375\264\021B\337\307\203>\332\350\240\217\325\340aH\006\375"
+	.ascii	"\263\005\367\242\240\017\244\250\016\2075,A\037\335\335\214D"
+	.ascii	"\320\347\201\253\303a\021\354@\377G\221\201\023!ww\034\026\305"
+	.ascii	"v{7M\326uj\255\265@\177\307\270\273\001\334\004W\362\032\243"
+	.ascii	"\017Va\364\301\324\027\375.\325E\377Km\321_RY\364\313\352\212"
+	.ascii	"\276\230\252\242\317\244\246\350\217\251(\372Y\365D\277H5\321"
+	.ascii	"7\362\022:\022\275\021\213\212\330\265\020\313\006b\333\310\017"
+	.ascii	"\353Fz"
+	.string	"\350s\351\320\337\302\241\377\265\241\257EC?K\206>\026\f\375+\027\372V,\364\211R\375*\025\372T(\364\247|B\377\374\356\336\274\222p!Q\367\372]\n\324\003\272\037\016\376_X[m\266\370\3037\243t\f\314\365\364\260\321u\240r\277\034\003?\356\360<\355\360\207\244\023\216\211\344`\023\271\304\374\364c\261\326\253\244\221}#\007\177\2454\262\221o\344\243\313?\217\226o\376\30478j\220\226s\364\217\340\350#\271\321wb\243\377\304\252\017\245\252\277U\243\237\204F\177\bU\177L\330'\233\321/\006\373g\246\372a\300\276\230\214\016ke\242i%W\235U\346\205\274\210o~%S\241'\240\345\025\347W\2620\025\236B3\2352Q\340\231\022\241Df:t\016\231Bh\311Bg\252Vr\020\032\324K\327J\356\241l%\367\316\236\311Cy&P\n\204\376J\366IK\366\311\245_6c`D\246\222y"
+	.string	"\240\270_\271h%\337lCS\236\tx\353\232\243\266\343-\312c\251%\333q\360g\331\316\267c\234\271f\273q\215\0347\256\200\246\250Q$L\261\271\234\244\324\032"
+	.string	"\003\031\242q1\021p\030\315\031\306L@\241\305\314<KKd\016\321Ce:\254\006\201\377c\211\326N\214\263\300\f"
+	.ascii	"J@\317\266M\207:r\275i\313\263@%\001\203\255\034\334\037\367"
+	.ascii	"\376aqF-\241\f\370g%\234\220`\254&O\335\371`)\204\207\f\261Q"
+	.ascii	"6\240P\034\007\213\241FV\\\224~\252\ro\326\005q\245\240Z\204"
+	.ascii	"\321\033\257p\327l\"\304^X\006\357\2617\001\245\305Y\330u/M\226"
+	.ascii	"\266K\024\027j\240Y\222\362$\345I\312\223\264\374\024\"Y\367"
+	.ascii	"\210^\351\027\277\322/~\245_\374J\277\370\225\342\273\024Ax\324"
+	.ascii	"\036BA\261\036\313c 9\002\341I\312\223\024\376\213\362lB\325"
+	.ascii	"\273\257w\327\332u\f0\366^\3759\340h\031\316r\007'U|\032-\206"
+	.ascii	"\365\017\317\222\214\254f\366.\331\227G\022\372\203\347EF.\031"
+	.ascii	"\023W\\\377\0327\340\02237\202\364\021 V\001"
+	.text
+	.section	.gnu.lto_.refs.9aeb1a391642f3e9,"e",@progbits
+	.string	"(\265/\375 \224\275\003"
+	.string	"\302\b\033#pU\323\030\374\377\377\037:\375\377\377\377\377\377\304h\032\016\327\261m\353\331&\003\313\300R\213\r\310N2\005j\316\374\034\215\371\257\t_\266\354\225)O\236\246\266\226\314\216\f\371Qi\200C7\r\275\030j-\264jJ5\225\232\016\232>\n=a\025y\210;\334t:\322:\206\013\314\203\214\316\023\0308\207|\316sf\347\235\236\n\020\002"
+	.ascii	"7\0031\004\352\t"
+	.text
+	.section	.gnu.lto_.decls.9aeb1a391642f3e9,"e",@progbits
+	.string	"(\265/\375`\301b]\250\001\212\302\252\233U Ja:\215\001\205/\342\351\254\2563\327\350\001\336\311\0278\334\231\333\271#\213\307p\243GGuh\337*\017\242\312\005\020}\364.\266n\254\302\272Z\227\245i\232\306K]\204Y\236Wq\004\3132\fBN\250)N\2226\031x+\230zyC\313\275\267\224R\246\242\b\271\t\037\n8\b\207(*\007\330!\303b\270\007\207(*\007t\001\203\324\\\202t\0313\363\201\262\350\037\007\031\253\312bd\315\017\f\344\207\206\027\\\227\233\017\024E\377\270\305\"\342\302\355\346\0031\321\267\307\303\301<\036'\013y\353rr\363\201\220\350\003\221\351\003\005\321\037"
+	.ascii	"\006\263l8\207\205[\033A\306\r\177\341\035\366\210\301\260\016"
+	.ascii	"\f\206\265\304\274!\207\312\2144qb\346\003\351\320Y\211\224\224"
+	.ascii	"17c\034\370\206P\234\034^\216\334|\240\031\372@Y\372?n\001{\331"
+	.ascii	"#\256\201\273\220\214{[\331{\327\300[\230\006\207(*\022:\312"
+	.ascii	" \317p\r\254\0054\204\250\344-y\362\330\002%\210\231\377\223"
+	.ascii	"F\377\230\006\236Q\203\352\212\036c\371\305\013\315\220\233\377"
+	.ascii	"\333#\346\302X\306\215\004\344\006\306\216s\363\177\310\350\377"
+	.ascii	"\264\351\377\\\321\377Q\323\3771\303VR\302\236\230\335\374\037"
+	.ascii	"2\034\343\307\207\376O\230\016\301\032\231\377\271\201\247\260"
+	.ascii	"\013{nuA\333r3\206\302Q\366\270\001Km\"K\007H\224\326\315\377"
+	.ascii	"\341\322\"\330\333n0\355\335\235\335`\376\307J\337!\021q\345"
+	.ascii	"\220Bu\363}\362\350\017\240\316\305\203\321\2624\225\037@\364"
+	.ascii	"\\;{\274{n\236\274\266\347&o\235\205[\333P\\\032\334\321\"c\""
+	.ascii	"D%Y\327e\346\271KG\024c\310\013!K\346\310\364}jh;\367\316\335"
+	.ascii	":\006\361\271\262\3433\245\257\353\350\263Y#3\316\225\023\207"
+	.ascii	"\207\256\352\346k4q\264\233\276\326\242\257\325\364\265\022}"
+	.ascii	"mD\237\372K_{\351#\355\264\335g.\234\233\234\034\221\233o\327"
+	.ascii	".\334\375r\303X\270\265\234\244\214\231[\306\036/\334\035\363"
+	.ascii	"[\274d\340\256\230\373vV\201\273\353\302Tf\242\0201\263=\337"
+	.ascii	"\264\207\353\346#e$\362QS'\307\332\315?\271\350\237j\372\277"
+	.ascii	"`~\303<\313-3GG\362f\013\005\304/\030\266\266)=7\377l\242\377"
+	.ascii	"\333\346AhNM\224\231\027\263\377v\331\"\002\326\013:7\237"
+	.string	"\004\264'\267\312]\273S.\226k\345j\271T\256\224\233\345\276p\257\\.\227\315\036\357\226\033\345W\355\036\213w\313M\202%\315Iq\355\311X\026\226#` \214?\220tt\311\"\022\373f\n\311\242\243K>!\002w\275\224\\&CR\306\25554\205\215\216.\271f\304\355\026\213\b1\322\321%\267\334&\327\211\205[\033a\207\n\022\313\226\013\345\034\333tt>U:\354\212\034\2625\332#\023\311\032\231?\257\364M:}s\215\276\311\246o&\3217\201\220\3353!\270\026\332P\271\371&\227\276\271\357\022{e\247G\222\233_\312i\263\022\214~\271\246_2\321/{\350\227T\372yN?\247\321\030\254Q\031Y\031E\f\023\250\233\257\013w\210=^\262\033\2050T\327\230,7\337z0\211<\b\271c]j{\210\334<v]\\1\214\226\245B\224\234\377\376\270@n\020{\274c\227\307o\217\353\343y"
+	.ascii	"\377%\216\335\250$\362\022\307.\324\034\362\307M\034\235\017"
+	.ascii	"\235M0{d\036M\233\276b\377%^\251\033v\3016\350\261'\317\315;"
+	.ascii	"\220\3140Y\31057?G\321\377\257\216\233\343\336\2706\356\327\305"
+	.ascii	"a\217\027\354v\375\266p\275\236\215\027\354\312\27030Z\226\316"
+	.ascii	"\022U\346R\325\220+V\301\260W\260\261xJ\021ss\301.\r+\005\033"
+	.ascii	"\331\364\213(d\2207\206\225\2752D\304\260\243\342\332\024/\330"
+	.ascii	"\275J\300\216Kb\266\267\021)\211HM\236\2650C\371\231K\037\316"
+	.ascii	"\036\231A\326\310|\336\372\270\316\345\262jR\306\352n>~\3237"
+	.ascii	"\353j\331\343\335\372/\226]{N\003\333j{o!\240\036lkP7\263\330"
+	.ascii	"{o{/\346ywwwg\357\305<\326\2423\024}<D\177\315\036\231\307]\372"
+	.ascii	"l\366\310<\030{d\336)\020\277/,\270\342E\313\315\24752\217ah"
+	.ascii	"s\333#\363\327\216\376\215\323\207\273\273\003-\305\245\312\331"
+	.ascii	"\315\277\275\303\003\224Ue\247\344\346\017`\016\225'n\300\254"
+	.ascii	"\301\301\"\367&K\234+E\243\034+g?\b<\026\316\256\261p^\371\210"
+	.ascii	"\030\344\336\373$ \253\024\223\366\216\335c\353\254\036Kg\347"
+	.ascii	"l\036kg\217\026\217\245s[\307\332\2715\356-\305\006\217mc\257"
+	.ascii	"\f\021\215[\206\001\302t%I\356mLBJ\302bfD\271\323\220\217\264"
+	.ascii	"G\346\22052\177\317\364\257\013\372\327\206\376\225\241o\357"
+	.ascii	"\364m\033}\353\246=\330#\363VM\337\"\321&\234\271]\363\3332\366"
+	.ascii	"\211U\343\201\275\245\366\336\023\230TRaGn\266hl\232[56n[5#\200"
+	.ascii	"\355\re\325\020\351\331\033\212\310\332\f\254\315 3\021+\243"
+	.ascii	"b\346\333\242\266f@\334\2361"
+	.string	"2\263\274\214D\230\215\226\026\0327\227\326\310\274\005\323\24652\177K\346\355l\322&\266v\263}\273\326\315\216\271}\263b.\002\t\017\222\262oyo(k3\030\2626\203\322\313\020\250(f\276\265\241\177\033\346\366\013~!.\215\331\315\267O\320\332\374\026\214\345b\275\3306\333\305\036\355\027\273\345\327\270\367\332\336\373\326\310f\257\f\341\275u\220)b\311b\257X8/\0040)3\200\037\304\355\027\253\305J\261p@\026p6\006\271\267\361v\355\007\361\213@\202\375b\247\330+\034\242\366\326\221\203\002\342\236\027N\222{\033\223\220\222\222\222\2228(\323\326\026\224\317\001}\n\350\253\240/B#\331#\323R\261U\354\261\203\265r\021H8&\246\355\263\275\215DBvK\354\352n\376\001\364m\007\323\336\331\016\346K\320\030\330#\323\246\331(\366\330\201}\341\026\2125\276\2042n\343\336F\242+d\317\224(7_"
+	.string	"\372V\355FP\233\204\003\351\333\016L|wg;0\1775\006{d^kd\206`\217\314\337:\371m\023{\326\001SY\201\355\265\275\215ED\306\256+\0367\337h\217Lm\215\314\353\346\356c\314\234\350/\243\374\370\013\266\002\226\021\220\206\271\374\347\360\206\341/\227\334\027X-\037\340\317\006\360R\206\323\274"
+	.string	"\311\005\310&\374\271\004\266\017\375\345\216\037\237\220?8\243r\240\277\244\361\343\022<\334\0276\370q\007\177\016\341\317\0370d\245?\013\340\277b\362\0079\351\317\036d\017\177\356 o\360g\r2"
+	.string	"\376\234A\306\340\317\027\344\016\177\346\360\343\0242\005\177\336\360c\td\t\376|\364\337)\"\3748"
+	.string	"?\326\340\307!\374\230\204?\033\3759\303\217M\234"
+	.ascii	"\277)\274$\374\227I&\222\203\341\277fy\350\307s\356\317\177\223"
+	.ascii	"d\241\337v\340\277Gr\320\217\313\316l\n\277\205\300oIX\0242\320"
+	.ascii	"\217\247\344\237\337v\220}~\354\346\277/\262\376\361\\>\377\333"
+	.ascii	"\371\361\317\177\203d\363\277n\356,\001~+\200\377\035\374?\361"
+	.ascii	"\237\203\037\337)r\006\374\345\027*\327\315\335\024\256\377B"
+	.ascii	"\301CY\276\204`\"{\324\252\376\333\226\313\037\223\375V\0039"
+	.ascii	"\227\370\317_\n\371/\\\306?\216\313\367\277[\031(?^\222\355\177"
+	.ascii	"K\334\347/\257.\224\241\261\264\013\375%\361\277n\371\377us\367"
+	.ascii	"\337\n\266\373\317\341\277%\036\364\227H~Ld\317\177}\260\371"
+	.ascii	"\371\227Z~\254\347\307t?\256\363\3439?\226\363c8?\226\373\261"
+	.ascii	"\232\037\243\3711\334\217\311\374\370\355\307b~\f\346\307T~|"
+	.ascii	"\374q\332\217\215?~\362\343\263\0373\371q\221\037\227\375X\310"
+	.ascii	"\217\307~\374\343\307=~,\366\343\035?&\376x\004?\036\376\330"
+	.ascii	"\367c\016\374\330\304\217'\360c\t\3748\205\037C\340\307$~\334"
+	.ascii	"\200\0373\340\307\"~\254\200\037'\340\307\007\370q\001~L\200"
+	.ascii	"\377\316\3757\317\177\357\374\267\316\177\347\374W\316\177\341"
+	.ascii	"\374W\356\277l\376[\346\277q\3775\363_1\377}\373\257\227\377"
+	.ascii	"~\371o\226\377n\371/\333\177\255\374w\312\177\251\374\367\205"
+	.ascii	"\377\252\3757\355\277\306\3772\371\257\331\177\223\374\367\310"
+	.ascii	"\177\213\374\227\310\177\213\377-\373\357\220\377\272\360\337"
+	.ascii	" \027\310\177}\374\227\307\177\301\376\373\365\337\027\377\225"
+	.ascii	"\372/"
+	.string	"\013\377\215\372/\361\267\032\370o\211\377\252\360_\243\377\006\375\026\375-\005~{\342\267&~\253\364\333\244\377w\377\355\376\217\371\017\346\377\331\177\247\377n\377\213\356\356\356\356~\323\370K\260\177\024@\020X\262d\311\232\023W\001\224>\005q\254Xq\021%I\227\241\032G\216\234\335|\n\250\254\225T\326J\243\271\2675\202\311\310\332^Y\036\246L)\215\232\370d\344L\237\202\037/\2740\001.B\332\314(\220\241\246V\032\355\336{\217\251#\244-\271\275\262<|\303\234\376\313\264c\231f\257db\332\226\361\363\302\b\031\235\344\336`>\3004\330\320\326n\376\206+\372\345Y\351\344\345\223'\245Q\357\275\211\306-C\001bB\332\314\266\227\227\007\237\030Shrn.\215Cg^\220s7\377N\326\362\337\207\347%H\362\346o\330\241\377\333\337\337\334PY{\357\255\322\270\263\242\202\314\337\336\226\326z\370\205,\266"
+	.string	"\370\237\377\201\r\354=\345\005l\357m\355h#Y\240n`\260\017\267\267T\030q\001aZRa-P\251\205i\025Q\251\205m\242\024\031\261(k\207\021\251\324\366.\222\222\"\216"
+	.string	"\323\242R\203\332ETj[k\2738\243e\2671\214\270\245\300v\321\226\332P[\rL\013\003*\2510-*5(\255\"*\2650\255\255\026\2661l)\250\254*\251\235U\264\325\302\346l50-\fTj`ZTjan,U\214 E\272\272\200\r\371\262hTR\033\353\n\007T\026\0068*#\330f\263\267]\233\332Y\033no"
+	.ascii	"\354\215\003,\213\rT\013\226-\n\016+\312\n\024\2305\356\2757"
+	.ascii	"\\E\211\201m)8\242\335pTG\300\366>\022\325\264\257\366\336{\004"
+	.ascii	"\242\021n\217Y8\"\017\034\333jjo\n\266q\357\253\275\211v\303"
+	.ascii	"\355\275\211{\3573\013\207qo\033\030\250\212WW{{!]m\034D-S{\337"
+	.ascii	"57lZTjb` \264\274\240V\334/\214DKe\005\266\213\233MX\226V#\242"
+	.ascii	"m\253\275\267\255\243\213Z\\tn.\231\304\315\005\021r\363\221"
+	.ascii	"\346\350\322,\337\271\331\321\302\315Gz\323e\022-2\343\233\233"
+	.ascii	"\217\324\246\313#C<\254\342d\271\371HY\264\361lo\343\220\231"
+	.ascii	"\304\205\027Zn\326J\210\374\250\273\331H\305\306\333\217\233"
+	.ascii	"\3132\242\242\025\036\0377\037\t\2126\002\261\351\2302\343\346"
+	.ascii	"\322\005\333E&\214\356\346#\025u\031d\354\013\325\333\315G\332"
+	.ascii	"\241K \367t3d\307\234\233\217\224\245\357\245\364\261\211\210"
+	.ascii	"\276\334\371b\273\371HR:,\254\344a1\030\243\336\274AV\301\201"
+	.ascii	"\241&\366\222\007\221\036:4P7\377\216]\262g\315\024\235\035\345"
+	.ascii	"W\025*UZ/\253^U~\331\264-\343\034R\304\356-\271\267\227\007!"
+	.ascii	"\267\242\032\0277^~\225:\260\2170\\On.s\f]q!g\356\346O@\245\304"
+	.ascii	"Q\332(\255\200\3301YssY\243\364*#r\005\353\346\222\253\364\362"
+	.ascii	"a\333C&\210W\013K\334\354\340\270\271\353\003brcn\376\004O4\215"
+	.ascii	"r\206\336B\263\251n\376\004E\364\357\224[g\333\233\266([Z>|L"
+	.ascii	"Y\273\271\314\302\3323\365\345\346O\240C\337\036K\031%V\n:\330"
+	.ascii	"\352\334\\b\3456.\252\270n\376\235\322\352\277\317\217\0327u"
+	.ascii	"pVe\214\323\005\235\030\2652F\t#HG\017\033kn\376\004Z"
+	.string	"\372\022\354)_\260@'\210\230\233/\001\035]N\271H\336A3E\314\315\177\031u{,\243J\242%f\331\275\263D\271\201\334\333\353\003\235\303E\233\334\315\227\340\213\376K\250\227\304\027\264\270`\335\\\356+.j\350n\276\004hZ.'-\034\220\r\305\245\201\021b\0352\231\323\330+#\020\321R\207L\202\310syKF\303\005\002\2219u\310d\236\313kb\344\271\254\206\bZ\0352\231\347\210\230\251C&\357\362\236L\227\355r]\326c\217y.\263yn\223\335$\231n\344\350|\r\345<\033\202\334\324P\3317_\202!\372N\266c\217\031O\206\343%\327\261p@F\320\331!\361d.\371\315P\271w\330\236\342\336{CR\322\017\235 6\314L\007I\350\007\030\222\257\233/\001\r}kl\233\233\223\345\330cF\3468j\3102b\035\022)\t\317\251\215A\232\371\022\020\365\217\340\350\374\306\205\005\333\023"
+	.ascii	"q\301\265\251q\363\217\304h\013f\217L\r\326\310\374\221\232\376"
+	.ascii	"\321\022\375\2432\375\2430\035g\222\245\241\363r\363\217\254"
+	.ascii	"\264\227\\\306\302\001\311v`\220g2\234=f3\271K6\223\271\340\251"
+	.ascii	"\241ro\250,E\240/\036ZUf&\203\223a\330\252\334|\rt\364\255\261"
+	.ascii	"\215J1\fv1T\356\rV\245\230\337\362\230,\306\036\263[\006#\345"
+	.ascii	"\226\277`\027\347\330\226\0320\311\275wR\022RR\211\00797G\347"
+	.ascii	"k`\323\327pD_C\231\276\2061}\ra\372\032\254\3645P\351k\330\231"
+	.ascii	"-\b\252\013\213\231\233o\224G\3779\013\0329\027\330n\276=\003"
+	.ascii	"\263R\206\2400l)\0272\212yJ\026r\3370Z\226\226\022\305\016\351"
+	.ascii	"\245\243X\frWD\263\201\243h\226\2179J\266\222\3232\225\254\226"
+	.ascii	"\235\344&YJ\306\222\3272\222\254$\277\220\241dc^\222\253\344"
+	.ascii	"+\371IF\313Lr\222|f\217yJ.\362l$\037y\336\201\205\274\305//\036"
+	.ascii	"1\236t\215!\363\r\034=n 1Z\013@\220\030\255F\216\252!uE\037U"
+	.ascii	"\305\036i`\\\252\037\204\013\366J\234\036;\377-\346\260Q\334"
+	.ascii	"\333\230\247\344b&\202\215E\237\027b\311[\314S\262\216c\r\262"
+	.ascii	"8:\022\376[\034\313@\250\212h4\322\004\221\023KcU,\233+\346)"
+	.ascii	"9l\002[\240t\231\235sKt\320\030!_8{d\202`\004&\023Y3r\207E\347"
+	.ascii	"\346\033m\32172\352\033\221\351\033\211\351\033q\351\033U\351"
+	.ascii	"g\230\243\237\201M\347\037\271kL\017\262\233\237aM?C\231~\206"
+	.ascii	"\034\372\031\210\372Ev\364\213\332\350\027\215\321/\372\242_"
+	.ascii	"\204E\277\350\250_\204D\277(\207~\322\036\231/r\241\217\201\216"
+	.ascii	">\2060\372\030\256\350c@\323\307@D\377y\306\363\226\236+\032"
+	.ascii	"m7\337\032\363V\306\342\312Z\366\230\267r\3265\356\255\226\267"
+	.ascii	"\262\214\235_l\t;3\263XpU\320\230\371Ds\372Dp\364\211\334\364"
+	.ascii	"\237\2572\214 $\r)W7g\030\267M\226\202*S\334{\247\3110\356\232"
+	.ascii	"\373f\341\326F\234\261\311T\271*\307\310V\366\230ad"
+	.string	"\027\317S\371\305M\223a\\57\314\220\224q\023M8Zu\310d\\\206q\321\f\331Q\207DJJ*\300\324\032\265\237\254\215\366\310\264T\326\310<Q\021\235\243\202\220\230\371\312s\363\211\306\364\234K\007o\013\267\206F\327\225|\342\306\252\361\260\204H\327\225\304hiX\212\tSY>XQ\312\360\036\\\205\225\2300\225\365"
+	.ascii	"\261%\310;g\017&\342)\013\007do\255\021\224\020\241\353Jf\"\326"
+	.ascii	"\203\351p]\206\302v8\017\276\303x\362\306s\366\210\367\340%\277"
+	.ascii	"i.\233#\311\311\315\301{.\234\213\334\nA\211\026\272\256\344"
+	.ascii	"\032\336s\337\3307\013\347\265\211s4Pbf\017\246\202\351p\210"
+	.ascii	"\242\332{k\004$Z\350\272\222\227X\007\337\261p^\033\2128\302"
+	.ascii	"\022-\272\256\344\034\274\007\277`\202\251\366`3l\024\363\240"
+	.ascii	"\204H\327\225\224\224\204\253\350\331\221\204\202\374c"
+	.string	";\307w\256x`OP$&\353\353f\021@\034\3331\315\272\354\230\273\371Cz4\236\263\201\210\307\017\25047\177\350\215\256\202\261`c\021\205(,8\030\211\343\330#\226#\205\345\340,8\316\204\251,\tD]!\345\3407\177\343\020E\265\241v\204@d\256\016\235d~\001H\230/\235?DD\337>q\333`\341\200,\240H\025\270%\310[\214\303lX\f\207(\252\b\200\261\202\034s/C>{\207\255\025\317\3120\361\"\343\301\302\255\215`;C\356m\214\303f\356eH\n\303\226\"3C\3428\374\266a\b\312\270\263\314\26119z\222m\260\034F\203\331`5x\rv\203\323\330#\216\303g\312\027\216\311\272\f\371Bo\364\205\322\350\013\215\321\027\362\242/dE_\350\250/\344D_\310H\030+D9gd\334|\241\2606\374\305\0361\030\274E\013\356\302\003N\021\f\366\202\273X8/\343\336\312"
+	.ascii	"\247\315\232b\022c\221\263s4\363\203\314\350\037w\341\002d\347"
+	.ascii	"$\207\035\027\274e\350I\231\025\217\233\0374E?(M?\250\211~\320"
+	.ascii	"\021\375\343+\307X~\274\206\247X5\036(\247T\271\275\270\031["
+	.ascii	"\001q|\305\005\020\253\255\233;\260F\346\203\206\350\007\001"
+	.ascii	"\321\327h\217L\017G\374\202\232\036\222\006G\227\233\037\304"
+	.ascii	"uT\213[\333l\242\034\253=\216\351\206\330F\027d\2451\260F&\206"
+	.ascii	"\342DO\227\226\262\233\017\224G\337\036\361\023'\367\312\221"
+	.ascii	"*+7c'oA\233C\020\335\033\231\0317\377\016n\362\337gH\315\223"
+	.ascii	",\\n\376q\023&CWgv\030\023\274\304\007\017\233=Mn>P\034}\240"
+	.ascii	"5I\256\234\223\026^\270\371@nF\360\021{\304H0\026\022\022\f\003"
+	.ascii	"_Y\270\265\021O\246 \30120\021\013\347\205aK\305q\203\334{#%"
+	.ascii	"%\331\027\332\354\350\2309\f\223\205)\026q\031.b\217\230\310"
+	.ascii	"1\021\234\205k\f\021\213\366\366\321\246H\004\333\300`\026n\315"
+	.ascii	"\001I\306 \367\336I\033\222\222\200\254z\344 \352\354\002\036"
+	.ascii	"b\217\230\f\013\361\021Et"
+	.string	"\350\034].\320j\340\270\316!\204\243\b\217\0367\233p \256q\2245\334v\b\271a#h\303\3718S\343\332\306\265\272\341%\347f\355\005\342\272\306-[ss\273Y\310\032\231\277n\241\013\310E\326\233\013\032\327]\277\031w\253\356\312\354X\335\254\267@\\\323\220\232A\205l\206\346*\321\250\360P\321\272\346\372\365\326\215a\325\004\005\241\301U\346f\037kd\332& \256\265\210\342\262\334!\313*\233`\037K\346h\310X\002$\026\365\006\bV\251\304\007J\262\315\327U\211\204\002kN\332\254\212\026k\213N\233\030T\202\274\254\360p\203Q\016\271`iz\\T\235r?G\352\224\315Q\235t>N\344\216dyQ\n)\341\310\311\221g\352\213\2132\"6`=\254\244\314D\241\321;|\320IA\235L\306\210t?n\3765\361M\357RnJ\r bwc\254\242N\273\237EN\240c\325\343f=z\326"
+	.ascii	")j\244[\225\215\346\316\235\223\316\246m\031j\035\2737\263\314"
+	.ascii	"\0055\305c\356'\235\222)j3\222\377}r\023\2570On>\363\f\0351\203"
+	.ascii	"\007\317\315\007\241\313\211\007\204(u\352\244\205\235\231\001"
+	.ascii	"\215m/ \3059s\312\rd\256\304\274\2225\244,\331\302C\216\234\020"
+	.ascii	"X\375 cFU\244\322\302\315\007a\013\016\234\243#VJp$\221V?\220"
+	.ascii	"\334|\020\366\311\346ds\312\325\021\263{\263r\214\320\2059\335"
+	.ascii	"\374\224\373Y\223\206l\355\346\263MIu7\244\352\206\r\202\261"
+	.ascii	"\305E\307\0345j\316\"[\256\224\034i\341N\311\226\233\377\001"
+	.ascii	"\334\2313'\032!\\\342\212\311 \027\324\224\021\317\270\237h|"
+	.ascii	"\354\336\224\330h\203\203+\345\216\245\266\2168\305\344\2142"
+	.ascii	"\033"
+	.string	"7\377\00332dJ91Wb^\247\222\263.nz\274\275\311\305\305\025\273\\\251\213s\363?\330:\305\234bJ9$0\274&J\222.CbG\346\314n\376\007/N+\247\225\023L\227+%G\314\262T\2361z\316/?\301\334\272\262\244\226\233O.g\333\177\037!\342\016\270$7\237^|;\224\240\271\371I[\316.'\333\271\205L\026(7n>\265|M \252X\343\346'5\321\277sf\371\357SN\r)\363r\363\211\205\207\217\2611#7?\311\207\276=\236WJ\036{\315\221\344\315O\242!E\312I\245\016\227\335[\362\244\202D\023;\247\374\244b\036\211\330\350r\363\271VR\301i#$iJM\355<\"\201\021\347x@w\345\343-\211\311H\311\361v\274on\224\300\225\335|\017\352\322\322J\243M\263\240\356\205\0353\354vFO\230\233\357\301\033\243\261\224\273*:\221\372b\345\346{"
+	.ascii	"\346\311\0233\n\022\030\021\217\211\343J\310\333\371C\314J\354"
+	.ascii	"\346{\320\343\354\354,C\002#\3361\263\256\202\024\223Be\266\262"
+	.ascii	"h\335|\017\366\221#'\023$Zu\3101Xa\320\316%?\231\234.|\324\315"
+	.ascii	"\270\3714\323I\356\320\261\235J\240\216XH%I\" %L\235<AVrg\220"
+	.ascii	"d8\0330\022\256\267)<D\210\234E\364\\\371x\263\02276\346,\342"
+	.ascii	"C\304\210\230\325\315\367@e\310\220\263L\003\224(2:\230I\225"
+	.ascii	"\232\257\223\354g\231\320\235#\334\023\017i\247\220S\b\333\225"
+	.ascii	"\230\227\031\320\327\2214\255\233\357\241jl\254\224\263\262="
+	.ascii	"\254\2208\251\363\343Gi\264\030\214Qq5\212AG)o\320\334\374\016"
+	.ascii	"\312\234=\316\036\245\234\0210::\017DM\240\336f\334\374\016\252"
+	.ascii	"\350\377\024;\305\356\233\256\332;\314\306\017\322\252\356H\321"
+	.ascii	"\0208%7\277\003\033\372?\243\316\250s\207\306 \211\025\235\327"
+	.ascii	"\020\030\233\f57\377\347\216\023\fN\013q\364\334\374\345\263"
+	.ascii	"6U4\273\371\034\340\321'\301\212\211e;\034\016QT\016Hb\206\304"
+	.ascii	"\002\343,\006\036+<\310\244\324Ie\341\274\020`\266\206<[8m\234"
+	.ascii	"^'\216\363\306\251\343\244q\3468\273\354\361\254qrU!\240\b\224"
+	.ascii	"\031'\025\210-+<\310\344Y\343\304:\267\312\220g\215\363\212\216"
+	.ascii	"\025\036\244\026\302\345(CC>\007X\36490\352\377\334:\265\246"
+	.ascii	"x\204A\re\301\222\242;\263N\031BvG\316\270\240\317A\017}\016"
+	.ascii	"\300\3649\270\241\317A\227>\007Z\372\034T\351\323\3059e\217H"
+	.ascii	"\347\2133QX8n>\007Pz\004\333\"\231\277\263H\3467H\352o\300F\377"
+	.ascii	"'\361$\332\267\005xm\342\235\237,\253"
+	.string	"8O\222;\013\314\007 \330\262\250n\376\006M\354\3301\357\026\340e\334[?t\254\316$\315\246 \271\332wv?/\256f$\271y\017\226\322V\244\356\346oP\324\267X\222r\214\346\234y'\316\234\211\247"
+	.string	"b\254\334\210I\232z\314:\223\316\036\31593\017RFbA\261\243\3637\340\322\337\200J\177\203)\375\r\244\3645\330\243\177S\316\2243\351`\230\312\362\301J\303\004\271\263\300|\340CgFW\222\316\034\237\2548qgnF\032\177\350I\003r\3635p\243\3158\346\031\023\0166\026\033 \266\007)\307\036\3158\346\033\213\024t'\007\361F\316&\234\373\344\310q&\352\346k\360E_\003+\3727\313\034\3152f\033\273\213\020H\323\004\271\263\274>\030\232\303BU\274\231\215\324\020\222\267/dn\276\006I\324\330\243\271\3064c\2561\317\230i8D\355\r\225\343g\313\352L2\031$W\265\204J\316\277\211\346f\232\337\204\273T\366J\211\271\"g7\233q n\242\241\252cr\363\21752\257A\227\276\006[\003\321\321\277\351\305\036M/\346\230\005x\355\275\225"
+	.string	"&VJp\234uN\316\304\001ss\314o\266Y,\346[\206\202Ff\316\315n\027\201\204\26302\036W7?"
+	.string	"o\372\277\031\306\036M1\346\227\213@\302\231)\306\004\263\301\226\225\022\034I\2402H1Rr~"
+	.string	"\330\364\003\300Dckd>"
+	.string	"C\270p\311\200\025\223\266S\207\226,g7?"
+	.string	"RZ\264\024\255\224\3400\333\333\313\003\013\260+Sn>"
+	.ascii	"\276d\311\"\267%\354\354\002\251;\023'\355\312\025s\313\312H"
+	.ascii	"\226E\263\223Bv\363\001\200U\245\212MZ\225\261\345-H\210ag\246"
+	.ascii	"L\371AZ\2211\031\202\021\247V$\212\024)\004(\322\321\231\371"
+	.ascii	"\300E\211\341\272\371\031\214\035\217 \212ttf\216)/w7?\203\031"
+	.ascii	"hhf\024;\253\037d\364\035\026,Qf\332\315(qP\324\260\271\371w"
+	.ascii	"\356\333\177\037\223\214\f=tk\240@)\331\330\264-C\303\230\"P"
+	.ascii	"\272\222\246W\334\031\033a\23481\351X\371\310\002\332=\356\330"
+	.string	"\2205iR\032\221\3000\034\256\270\242\031\224\221\256&7\037\003\035\332\\b.)\215Hw\304~\206\310\231\211\272\371\030p\351\333%\266\254\263\307\262\316T\342C\265\267\226\007M\270\262\274>\b\242C\323\026\343\356\246\222\277\324S\3561\223\004i\027\202Hq\335l\"\261F\310<A\273\371\030\300\210\312Z\216tH\263\210\t\303\214A\007\004\2678\265\377\346\017\263h\0361\313\314!&\231)\304\fb\272`\0321}\230<\314\036&\020s\314$b\217f\221\337\3542[8\022\215(\273\267\244\271\241\352\244\346\326\246\336\024]d-CR\030\266T\0178\305\252c\233\027r\030\315,bRY)D\023\306\210\331\275%\267\314\031a\036\334\270\354\336\222Y\246\326T\0321f\021\323\313\024\303hY\020Hc\207\264*\177\364(bb\2312L\230\312\362y\341\302\ri\0261\257\312\037\032\270E\261{Kb\202\305\306\005"
+	.string	"\331\f\303Zt\370\200s\363/H\232[\207\231c\310go(9E\363\313\264a\3468\257\304\331\275%\315\035&\230=\232_\377\2153\211\317HB\304d\r\036f\376\005S\364o\342\270\231\3437\267Y\343\276]!0q1d\334l\336"
+	.string	"q\023\207\335\\\214\265\233\211\232\350|\001\021\035\264f\215\314_"
+	.string	"d\206\311E\324d\206\017\0276\221\217\226:$4ph\261\261f\332\244L\335\374\013\266\364o\3120\232vt\216Zn\376\005U\372\026\324\351[ G\033\317d\310\020\002v\363-\200\323\267\200M\337\2024}\013\310\364-\370\322\267 K\277\303\234~\0076\372\035\274hm\264Ffi\007\342\345\035P\025\267=e7\033Y#\323\322m{d^"
+	.ascii	"f\215\314w\270\242\377r\356\366X\316\225M\026\260\006\266\267"
+	.ascii	"@\360\262\005J\027\320\025,`\344n~\007'\372/\363\334\036\313"
+	.ascii	"<\345\222\f\225\266\265\210\306\266\302\316L\0320\\@\273\371"
+	.ascii	"\035\304\364_\336\271=\226wJ%\013\360J\333\304\363\212\226:d"
+	.ascii	"\222\211\216*\342\315\357\360\245\377\262\316\355\261\254S\""
+	.ascii	"9\341\200\335u\371\250\371\222\023\347\346w\260\241\377r\316"
+	.ascii	"\355\261\234S\026\207dl:\272\263\205\255\271;7\277\203\013\375"
+	.ascii	"\227rn\217\245\234rH\226J\333D\005\030\275>\370A2\226\374\272"
+	.ascii	"\371\034\346\350\277\204s{,\341\224B21m\023;0\246+\t^{\301\246"
+	.ascii	"e\214\0337\245\034R]\224\220\266$\334\327\235\026n\226\343\240"
+	.ascii	"%M\232\222\215\206%QB\332\222D]fSX\326\274dc\3370\360\202\021"
+	.ascii	":7\227j\262\026\253\260-:~ \341!\344\310\315\347\200\026\027"
+	.ascii	"g\337\316\027F\342\212'\223\2609\270\233\317\001\007\231\022"
+	.ascii	"\216Li\306L\2312&\3048\304\320\257\240N\230\322-L\371\366&F\314"
+	.ascii	"\001\242*8\243_\001\225.e[\227\362\313\177\347\345\227\362\314"
+	.ascii	"\0212*7{\361\342\306\325D\277\202\036\372/\267\034\313-\345X"
+	.ascii	"\206J\333[\3037/\354$\367\366\372@\310\313\2054#7\277\002\031"
+	.ascii	"XJ\266L\276\024A\241\210\325\027$!\224\362\322%a\nD\351\2220"
+	.ascii	"\205551\304\260\372\202\276\f\253/H\002\005RI\024-\245?\024h"
+	.ascii	"\220\001*T\364\304\232\252CLA\337\352C-\300b\005'\237\025:,\375"
+	.ascii	"\204\016X\177O+\272\232\310\340\373\365~xN*\360\203\223\n\344"
+	.ascii	"\241+:\302IM!(T!]\321\247\037\272\202\001N*p\002\t\234T\240\006"
+	.ascii	"'\025\210A\205\212\236H\207C\302!\212\342g(\003\foR\372\220\016"
+	.ascii	"\237V4Mq\366z\250\317\233\224P\024\302!z\202\352\003:\337\244"
+	.ascii	"\204\002}\253\312\200\036\005i\257\204\n\034\242\277\020FoR\212"
+	.ascii	"\300\t\022&>`\240\242'\374\211H\207B\021DoRR\201\275\017*\260"
+	.ascii	"w\264\276Ii\r>\tE\240@\207L>*OH\345U`\035\nK,\031\245?\024\350"
+	.ascii	"\211\025\246\312\202p\230\325\237\260\227/\240\n\2352\006T\241"
+	.ascii	"S^J\207h\372\353\235&\013\302\025\206Bu\370\324\363i\201\376"
+	.ascii	"\234T\337\b'\2427)-\371\234P\013\244KB\340\320\207\032\255oR"
+	.ascii	"\372\020\024\002\201\302\336\n\253\362V\250M?MV\265\252\271f"
+	.ascii	"H\227\204\300\237\365MJN\276\341\252.\245\277\241\360'\354\225"
+	.ascii	"*OM\217\324\241\360'\024\361C}\275\324I\025Z\227T\037\220\312"
+	.ascii	"3q\244\246+\272\232P\203\336\244\304B\210\342\203\320'<A\350"
+	.ascii	"\013\372\234\206\336\244\004D{\274\017B_o8\244\341MJ\031\f\323"
+	.ascii	"\245\240/E\312\024D\207EoR\352\240\242N@aO\350MJ\252\023\323"
+	.ascii	"\007\241O\203\352\304\344#bC\005\336\244\304\241\251\267\242"
+	.ascii	"N\252o\211\210\305P\350MJO@\337\2075\304\023\320W\344$\024F`"
+	.ascii	"\311W\"\350CSP\241\242\353\317\312\323+\317\001EoR\312 \002\353"
+	.ascii	"\020]\325\240T\b\210\016\231\204\253\352k\362I\201\250\n)\020"
+	.ascii	"UA\205\212\236@\361\244\002\365\202O(\370\364\202O(\250P\321"
+	.ascii	"U/\245C\237\232.\t-\t}\303\264\004\320P\213\3257\024\372\206"
+	.ascii	"%\226\210\324\364\327k!\"e\n\241BE\327UMW4\002k\210\245\364\207"
+	.ascii	"\006\231|&V\025\375\r\001\237L0\005}+\204@\tX\240@\f)\320w\242"
+	.ascii	"\227"
+	.string	"\262`\300\017]\205k\006\365$\332\320\353\241X8l\301\2245\030\031\255\276 \tU\205\212\236\350\245"
+	.string	"R\321K\233D\274I)\035\n{,\244*\240+:\342\002+\250>\240\240\017M\201\305\n\030L\244\277\245 \352"
+	.string	"\341\020=aH8DO8:\n2z\223\222\357\327[\022\246\340\373\365N\241\020\224\326!\352\244tB\205\212\256\032B\250P\321u\202t\351i\365\255\277\020\351\212\376\236z?T\204\n\025]\217x)\320\267\006\237\206\037z)T&\364\207\002\n\364\023T\250\350Z\364\236o\230\006S&\375\021J\020@\t&\2608o\202\001B0@\b\346M0"
+	.ascii	"\b\020\006(\001\204~\t \360\272\256\353\272\362\320\365\227\216"
+	.ascii	"H\201\276\025\250\305\317)]\241\350MJN*\360C\332CST\220\362V"
+	.ascii	"\225\267\246*zh\t'\025\b4\\K\004QXUa\t'\025h\244\362\202\226"
+	.ascii	"\202(\020(\024\241\252iO8,\321C\301I\005\032\245\274%\022*T\364"
+	.ascii	"D\212\336\0170]\325\026&(X\327\024\351\022o\235@}\3425\365V_"
+	.ascii	"\211\245`\210\337O84\3120L\327\024(<\nA\023/\205\323\217\327"
+	.ascii	"\353\241?\275\036\352\223\016Q\026\226\206\350\272\362R\244K"
+	.ascii	"\033\336\244\304\002\332\002\253\025\374~\302an\352\255>\247"
+	.ascii	"RM\237~\350\n\363\211\247\002}\303\023j\317\007D\203-F\034\261"
+	.ascii	"\200\016\261p\230f\240\327C\317\225\247R \005\372V\375&%\026"
+	.string	"\303\017,\206F\303\037'\024\330\033\226\303t\311\267B8tZJY\f\213X\244?\247\247\021)~h\323\317O\330\023\256\302\241\023\321\222\317'\305\220\347sRy,\206\023\244K\276a\320\207\301\312;\231\320\023B\037\217\351\351\347\204T\264\246j:\024\256O(o)\350C\301[Q\225\007|\032\256*R'\265\202\240\364\207\366\324\237u\230\256\b\372x>U\035\002\365\206K>`\031\364\001\265\212^\332\324c\201\0025\221*\342't\352\r'P\323t\310\224\216H\177L\301\020@T\304\n\247\024\031\226~\302&5\0356\235HWt\205o\355\205H\227\204)\f}(R\320\327K\325'\036\013\024\310c1\004\372\245\301 \332\324\343\261xBy,P \321\233\224\202\274\237\360\303\332\304\344\373\245`\362\255@U\370\t5\254@\203@*\220\327\242\027LW\364\307+z\223RP\350[\321a\372K{=\024"
+	.string	"*\257\327C\313\365MJ\033\f\323\337\317\227\302\\\211x\347\233\224\326\336\323pUEPy,\322\365\tX\244\242'\374\361x\346\032|\022\366x\274s\230\006Y\020\362x\247:L\325\247 \217\247\227\202>\025<\236\251\006}N*\217w\376R\036\317g\345\255\252\357\207\341MJj\352\324b\025\300R:D\233T\001|PW\037\212\017OA&\001\260x\n\372~\002\030\241\004^\t&\260\370\220.=\375zA\337\207\241\372\364\241"
+	.ascii	"+\2134\370C\203\303t\r\372xKh:lZ\235x\274\tV\244C'\036\317\\"
+	.ascii	"U\337\217\3073\321\025]\342\361\3144\004>\225\3073U\364\204\277"
+	.ascii	"\274\372\202$\202(\254\276\240\317\034\256%z\301'\024\226\320"
+	.ascii	"t\205^/\204\006\225\267\"\035\321\353\241:\210\302\022\232\016"
+	.ascii	"\315U\345\371\234L\244HG\244N-N\360H\2240\001\224\366\202\350"
+	.ascii	"\252\006}z\345I\200D\016\372J\004\325\236\351sR\261\312\023!"
+	.ascii	"\002\t \021\"\220\360\351\211\340\303oRR\237PlPy)`\030\246\253"
+	.ascii	"\212\002MUM\207KK\350\231\256@\177&\236\234\200\372\211\267\""
+	.ascii	"]R\237Ph\2257B}B\001\224\362R\247\026'\324'\024>\251S\213U}B"
+	.ascii	"q\252O(p\003@\360z=\324<Y@W\0201\"\204\271\276I\351\311\t\310"
+	.ascii	"\023\016[0\365z\350\007u\230\256\360\r\227<Hy+\204@B\b%<9\001"
+	.ascii	"\215\202B\337\372\364\023\252\351\360G\345iHy&\236\234\200@\346"
+	.ascii	"\372{R\323\025\3225\035\361\344\004\314\220\362\202L\276\037"
+	.ascii	"\312\033\n2\371~!z=T\267XB\323\025\320\025]\362\031\252)xML\276"
+	.ascii	"&^\257\207\006\245KB\021A\241O\365\255H\207A+\322%\374CW\f\323"
+	.ascii	"5H\202)\350\3739\001Q\023\275\036j$bD\210^\0175\323^P\002\253"
+	.ascii	"\212\246\021XC,Q\340\227\366z!T\337\2067)\t\207-\230(Py\302a"
+	.ascii	"\013&s\345\2110\200\024\350[\235\204\302\b\254)\323\020]"
+	.string	"\207R\210\030\021B8l\301\244\337\244\364A\035\n\325`\252vPy,\320\240\017\230\201\005\t\326`\252\246C\247U\030\\Q\024+6\364V\374\204R^\206\224\247!\355\r\237\204&\206\351\232\246\260\006\323\341\360\251\227\241\305\352\353\241N\250\210\026\303t]Q\024D+zB\005R\365IH]\207\351/\204\210T}\322\2202\241k0\355\r\323\022LA_p\210Z (\364\255N\300'5(\354qP}j:LW\265E\323\212\242X1\2242\241\353O\270\342\367K{\277\337S\212\025E\261\302hh}\223\322\007\241\257\305pM\201\351/]3\250P\321\024\202B\337\332\013>\245\bJy\353PXB\002\337\217\223\nT\235\230\212Vt\270\364\204\242\340I\240\256C\241\023P\b\232x\351\212\016y\351\212.9=\361~\250o\230\252G\303t\355\241C\264\251\307[\205B\024\351\020\303\233\224z\037z)&"
+	.ascii	"\246\253\332B\035b\221.\005I,\371\234\210VHW\370\326\036Z\304"
+	.ascii	"\364\204\"]\372Q{\276U\365\255\350\252\362T\250\350J\324\324"
+	.ascii	"[},\230P\205%JH\177\276\024\302a\211tE\207G*z\302_o\230\256\020"
+	.ascii	"\362\236\234zB)\320w\"\355\241\303\0060\005}\300a\210\240\004"
+	.ascii	"\206)\013B'\t\322%!\2207L\177OKiSO\035\032\242M\275<L})|k0]\""
+	.ascii	"\2614D\205(\210~B\341\t\274\362MJ\027\\\350\224\016?\254B\341"
+	.ascii	"\360\003\220\312c\362\245\b\nE\260\020\242P\321C\177(08\235i"
+	.ascii	"\317\267\"]2{=\224\2674\024\366\322\341\317\3123a\r\372\236\316"
+	.ascii	"tI\b"
+	.string	"\314+\257\004\020k\320\367\244_\200\002\210\300\200\002*4@\367\224T\025*\272\362z)>\364R|\b\372P\340\207\336P\375\240\204\004\024\006\323%\336O\250\377k''\230\2416)\\\220g\347\261JG\234\272\233\215\032\274\224`1)\307\346\252\352`,1\303\212\203%\355f\343Z\236\032Z\316\334\254\213\350\":\211\017\361\247\313k\206\007\235D#\331\222c\223!9Rb\215\213d\t\344\307\305]\035\016m\304n1\267\232\274\351q\363A\240\243\177MD\027\225\240\361\230\322E\253\246\207\0167_ed\371\016\2321\\C\256\311\376;e\331\004\245\301B\007\310\315\266\f\210\353!N|P\005q\301\214\242\366fn\217\220 j|<!s\263\016b\305\347k\306\2153c@\202\304\262\332\364\370q\r\3447o\344\033na\342\352n\266u@\\\377\320ww\\\306|\364 \262\261\243\007\f\036\327=\324|\260"
+	.string	"\t\202\274\331l\003q\315\003\001Bx0\021\013\343i\021Is\263\016S\343\201=\301\320\236!1\312\354"
+	.ascii	"\003Z\363\302\333\224\257k\260\337\232\261rAX\306\034}\334|\261"
+	.ascii	"@\\\177e\036xd\004\206\334\250C\022\324qD\246\346 \016\306\224"
+	.ascii	"R\212\215\f\215\222\016\243\025@"
+	.ascii	"0PX \023)\253f>\023@\003\314L\205i$\347\234bdHD$IAI\2410\314"
+	.ascii	"\001\211\017mF;\"a\037\2554\036\224<\370\007\032\253\233\352"
+	.ascii	"F\237\020j'\231M\341\207\332\034\301n\360<\333\216\r\204\246"
+	.ascii	"C\r\362\213"
+	.string	"\207U=\032\213\343\345\357\224\250\377&m#c\034j\222\2408\0023\037Yk\006\220\336A\203\247\202}\246?j\2201@Q\333\207a\343\362\203\003\021bG+\345\327\346>=\245)\005\003tt\2224\353r\216@\300\237\306\377{h\234\353\365\347\365\354y%\306p\223\200\025=,l\fX\266\304\0030p`]\262p}h\372\343\302\364=\3034x\267I\236\347\274r\264\226\264f\025w\264)\303\323\277-$\213\255\260a\005H\032\313v\210\262\336nc\273\326\330\314?RS/v\215KZ\260CZ\216\265y\2340<f\003\272\246\340\362K\322\353R1*\377\244tq\341?\200\353\215\023\301h\274\002\254I^\231\357\260\300>\222*\311\336!\315\263i\311Y*\302\277\235@\373>\323|f\273\003\210sY\020cf\374q\240\030\tV\021\325\337\300Ym!\315`d\330\240\201*\334\3246\330\2469\261% "
+	.ascii	"\367\032\252^Tj\320H.\246U\335\375\362\025\305:\376>Q.\036@\020"
+	.ascii	"\237\3144\031\254\241\346\"\201\313/S)(VjN\327L\250\207\303\025"
+	.ascii	"I\220$\251\236\0163#rtQ\270\327\334\206\225'\217\f\341\204\222"
+	.ascii	"d1\344I\232\274c\020a\365\024\020\363cX\232\020E\375\330\005"
+	.ascii	"qzkp:*\031\342\317Nb_Z\324>]p=\337\260\327~&<\241\214\277\215"
+	.ascii	"f\021\254\343\204\345&\337<\247h\241,\246\377u\361\302ll\354"
+	.ascii	"\021\213\345\346\210 \377\231\333\374\305\310s\001\371x\2256"
+	.ascii	"\f\264\373\374\t`\230\242\306)n\231\301\361) \355\240\205\265"
+	.ascii	"\340\020\335\341\006\272LNi\273#\004\336^d'R8+jp\341\313\017"
+	.ascii	"x\343\003;**,\335\315\020\200\345\372\327\022\236\233\273\206"
+	.ascii	"\225\005\365.I\032\2752\363\233\343\3010\303\024\315\r\236\313"
+	.ascii	"\366\303S2\025]=\027\0211\211$\326\245}X\330`\023x\271\307j\201"
+	.ascii	"\245/m\315\0176\346e|\352\006\212\3341\232\f\221\302\021\021"
+	.ascii	"XL\333$\026;\235\372\226\206<\315N\347\337\251B\207\177\241\355"
+	.ascii	"H\346"
+	.string	"\005\327\006\241%\240\367\301\230!P\361\215\305\232\2712.\254\331\200\3701\344\024\270\322\016\363@\013\3432\363\225\356\\\360/!\230e`H\263\3068x\330k[\326P\335\360R\306\017\b\232\212\006d&\344@\"\b~\321$\222\372\326~\017\212\216QM{\225(\027?U\337\031\030\226z\330kjd-\004\317\307\241\243\r/\214\246>\357\327&g\244\002Y\252s\255\365ev\016u\267\262\337\270\032u\330\231\274\316S\337\271ug\324!\363a\r\310\217q\020\353`?\035 \212=*ZL\241\210+fP\327n\211\347zi47\254Y\212\261\276\032\026\020\276\006-\334\261\217y\275\2570\227\255\321\241_\"\341\265\001_B\335\260.0\222\016`\201\204\366\007\212\373$\324j\001\334z1:j\032\220\237\321q\306ly\357\224qQ\255\032wY\376(\225}\213E\361\223\346\307Rm,\335\3270\362 \362`\023"
+	.string	"\030!\360a\233_%\327u\233\375\027\024\301Lz\235t\342\337\005\352\362\n*\217\256\214l\271\350a2\301\322\3339\221\340E\030\351\271\361\250\243`\243\367\327v\033\217\367\325\005Y\323;\277?\024X\251\324I`\251\215*\n(.\372\334;\017\227\364D\005\264B\013\305\265 V~\345\347x]\350\320\302iWM\240r\224\230\035\347\330\363qS`\324KX\345\246"
+	.string	"\b\211m`O\023\204\003\007j \262\232\345\034\366\215\362?\262\013\332\036\321\t\205\330:gx#\031\213\366a\263\355[\310D\332\\\310zx\020\3168S\261\207\320\236\324\023\337\025\315c:\371E\2311\251\366\001\300k`\340]\033vp\317\0016Y\223E]K\017j\236\345\374\321\257\374\206\357\227\343\336L:&\232\353\225r\263\bYK\353\013\005\033;\352\274\233\377\244w"
+	.string	"\315H\016\036\214\263\325\257\205!\254Nh>I#\013\254oi\3513\327\326\301\207\205c1#\357\200\307\375\275\257\244r\302\003\357\260DC\231\037\350\257\251\350\313\034V\333\035a^t\361w\317\t\310\b\205_[\234\315\223\327\203\024\337.\230!w\327Z\231\233z!\275c(\0241\352\365\272\254["
+	.ascii	"Q\371\236Y^}Q\233Z~O\206\313_V\216"
+	.string	"\323\021\2429A\353h/\246\264\277>J\037!\001\005\200[\204x\261\357j\343rlt\354ph;\"\360\372\023\037[{\216f\341r\304\005\017\034@\227\217%\244LS\363=\371Ew\225k\340Dy\023L\205Jn\214\364}\360\202\363\021\313\033\372\024\354P>\357\215\232rJ\343p\367\202\352\230n\016\341P@l\347/\"\231\211|\264\324\255\254\204\035\370\026\3435\373wt\207N\263\004\254K7\344d\322\372\201I\\\372\025\335cc\214\016\231\bG\210q\210\223\031t\363\304o\256=\256Ad(\325\262\231\314\223\r\207\306~\231\372Y0\222\215\235\343q\253\361\272~\244{h4\244\023\227\200\005\240\261\337\022n \325\304\353\277K\260\005<4{\224\264\271g\371C\266C\307\241\361\240o\\\356\276m\360>7 \310\337I\350\211\2650\031\315\270\245K\235\267\017\247\251\211\306\206\314c\324\177\262\342\001\231\217\257"
+	.string	"\221\341f\be\227\274\231PY\3503:\322\373*\372\271\273\0338\243\326"
+	.string	"1\006\227o\244p\366\001\254\n|\3375\244\226\227\024\310\251\013\3644\347\207\335hSspLFu\276\006\206)\313\265>D\303\320\304\220\361\330s\272\204Ta\313\332\234\r\316\232B\355\270\316\270\262\255\f{\3318\316a\224\225\227\356\271\022e\372\006\243\335\234p\022!\261<ZJ\336n\266D\321\341@\221l\356\2541\363\371\247@z\373vjfs%>g\336"
+	.ascii	"J(\323\016L\253r\331\321L\\"
+	.string	"rX\221\206\211\317Q\357\365p5\217P@\215a'\001[\363\235+\212\306T\241\246\211\231\030\226\212\352\024v\220\254\302\205\r0\376d\314<\002!\202\301\223\333\023\003Q\004\207\t\213\371\257\270\247\263\217\355\224,\304\255\025!U\003\227\"\322E\312\367f^\361\370\361\307ig\314\271\355\323\276\005\301\270\"\325\227\245\371s\356\274\375\032A\263\341\260g\307\233I\241\217\020\333a\213\345M-2\221zaI\037(\371?\207\201\333\365\347v\367\333\232$\220B\274\371\214\232\003\t?_\224G\003\273g\017\202D\314I\025\354m(\b\025\315E\315\313\356d\030\321^\355\310t\350\341KpFY/V\376\032\201\321O\217N\213W \300w\016\242B\0319\336\224x\t\022xD\340\312\001\3522u\375\205\370\232B\316{s\332\200n-Y\007j\3527\031\377\201\303\262\247\034\251\340\253 4\203\200\3270\341\302\211\037$$"
+	.ascii	"\253\344\ni&Z\016(s\261\371O\205\361<\"\327>\323\322P\244\236"
+	.ascii	"\270\303\307R\n\324\235\375p\333\260\021\016\2579\320\272\242"
+	.ascii	"G\241\222^\261nJ\212\241\204s\363i\367\207\233\n\333\265%\327"
+	.ascii	"\002k\233\203\337vUw\031\273s\316)\"\350n\213T\345\252y\226\262"
+	.ascii	"\340\\=%f\273\025\234\265E"
+	.string	"\373#\212\351\357b\315\274m\377\343\311\365\325(\225b\213\026f\206\312\206%\303\305n\315\356\n\030\377nPY\343\360\372\366:#\240OAB_\325N\305\021\026.aw\342\004\245\252v\271\202|\317\330\217\301d\350_b\223\217\352V\332t\005\025\241K\347\301\271\317+\0131\253O"
+	.string	"\211:{\202\236\016\374\233\003\277\202\221\270B/7\332Q\250:\236\326\177G\344=0\352\200\327\252\277\005&\247\270]\204\336\237\240\275\020\354\232\f\300\003\032\230XO\bU\206\034\303h\033_\327\022_\265X3\312\031\324o7-\177\232z\254\343%\303\037IR\017\256\rJ\325\306\374\312p\373\271\262\356\234\264\274~\206t\352P;\326s\020\265,;-\230J\244\214\216"
+	.ascii	")V\225\003\202\337\005\252\006^\221R&\371?H'Y\005\nq\342k\202"
+	.ascii	"\301\201\221\003k\221\305\376\257\327\330\315\310\337\311\341"
+	.ascii	"\013\216\361\022\031P\2229\017e\201E\201\221\373\026\233+\376"
+	.ascii	"\235\017,>\336\203X\025@\271\013\211\003xB\233\300\311#\260\347"
+	.ascii	"\344r\013"
+	.string	"\363\243\352Er\002\203\177\365\205\322\f\311X\305\rU\226\311v\331\252n\024o\370rR\211*\t\362\332:\2104\315s>!\232\330\004\240\234\320\340cn\227\207\333\241\253n\023=~Y8c\371`k\004v\246\371\350\177\013\242\203\377\350\007\230%'\220\344N\223n\237\r\234\fhZc'H\033\365$\232\203\376\\\320 \321\035eJ&\346~\267y\376\242\301G-\022\233b\371\203\205\222\235\246=\217\224H\300\316\r\003\223\024L\004\361\324\311\261\007\242FX*\210\321\215\007hT\2027\236\244\006\232\017\344>\033\246(\250\377\220\221;8\257\267t\325\331\272\351\316\212\304\227Q{kb\330\375\332$PT\300\302\265\027\036\226\031\r\005\212K\031K\302\255\247\374\333\243\327\034\216Bc\272Z\240\026E6z\314Z\266W\337\357\246\223\312\202\247\327\344?\306\t\256F?\231\3101\261!\244p\351\335\344\272\202 \2106"
+	.string	"\005\273\326v\212\267\305\255\373\225\207/\230\215\t*S\274\375m\006\265\177\251=\237\230ST\030\023\303\317s\332\224\264H\213\030\214\225\345\321\326U\323\260\212\366\275\360{;_\367\321\275\354\273\232U<\356\323=\271\2019<J\r\bo$]\037\254\345U9\254\255\007\311\376j\331\305\360`p\003O\247\273\205\372\301T6vc`\244&\207,\\\210\363\\\250"
+	.string	"\202r\177\204s\224\233\234\1774\272\303D\362\r\006\355M\277\307h\004\275\"\230pj\245\236\020\371&\306\004_\177 \323\203\202\356\2117too\305\234\177\256\374\270a\333T\331\321\220\024\037\367\307\302\347\221]#\nG\373\n#\026q6\034\025[\205\272O7\270,\245\264N\346J\344\213\033\330\315\272\265\306\354\355`\305\006]EV\022G\0202\317\346\277\250\001\220Y\304\204\267\255~\343P\230\003\307\366\r\262I\001"
+	.string	"\001"
+	.string	"\0072\325L\342\345c\346\366\321=-\274\302\300\375\220+FC\367\366\275Z\r\036"
+	.string	"^<&o\206w|\243\243\351-\227\323\260\177\232\030~L\324"
+	.string	",\344\201\206\353\277\002R}\244\252$z\251\"\325\370\221+b\265R!\025\322-\214i1\211\307\367T\226\005\t\336!\007G\016\007\211\375\017/\221\354D\370\270\201\367\356\331I+e0\247\240=\351\301c\313IC\020$\"\264\310PV\2504\016HO\327\031\017Q\206,0\253\232\023\240\304\f\220\0011\326\001C\342\202h\262\202\337f2\271\345\364\222\\l\003\377T>\316\251}\200\357\021R[6${N'4\302\366PL4LXD\020m\300\344,\224\361\366\312J\031\304\3226*Y\276|{\332\214,\017Ic\242\027\303M\310v\035\361\200`e\335\236t\252h\337\305\202\fB8\005m\202\231\021\260(\376\266>\225\2363\300\211\257\372\247\310\337\253\f\013n\231Ox\340\217pu\264\243\364\367\004\227_\337\304\367\351So\267\004\314"
+	.string	"\330T\036\276\315\210\334\264\301\200\207^\343\3252\35489\357\r\316\377\307\242\374`\340\005\237\266\324M"
+	.string	"\273\220[5\020"
+	.ascii	"J\347rl\312\376"
+	.string	"\303\302\211\242\0033\351\235\253\355\361\212\334?\316)\231]4i\246-\333\224\260\220\372\345\\\024e_\340y\364!\201v-o~U\027\201b\271K@\210\307!\256q\322aP9'\026c|H\210\377{\200kkT\027^\266\205\357\360\265l+=\226\243[\306D\b\360\n9\347\213\224r\322\302A\266=\377\340\311\002\212\025\033kz\314Q\201!2\204G7\206\322\026\t\311\264\bL\216X\364\201\361.\377\334\213\211(\265\002\300k\223`D\335\374\347lNZ\253\353*\376xY\244\032N\262I\367\265\t<\275\241V\033#_\004\324h\007s\026*\322\035\352K\354I\013\263\320\204q\004}I\353\213\370\320\323\356|=cn\024v\225xd\346\236\314\314\030`\263\026\304$u<\234p\250<\335w\030B/\2112\260\177\243\204w\365\366AP\357\026\344\222\373K8\377A\377M\003\3676\016\250\025_GP\376"
+	.string	"\371\206\321N2D;T\225\273\355;\317\217z7t\035\t\313\351\025\027\232\347N;\220T\340\024\265\337<\271C\351\032u\345\013\327#0~\307\246\025\270\375"
+	.ascii	"\324\017$\261o\264\371\320\032o\375\020\330\226`\345\007h\337"
+	.ascii	"\346\214\270\214q\036\342\344ur\247\370\2757\302,\253\234\235"
+	.ascii	"t+'<\177d\215F\361\331\362'\001\037d\345\360\250\026b\3701\312"
+	.ascii	"? \363\315\354\376\330t>\366s\334U\334*\334\261\326M\004<\333"
+	.ascii	"\367(\364\274\223\325l\244/\313P\243\263\223)\317\360\250i\303"
+	.ascii	"\270g\240\266@~\357\363\333\035\ft/\277gr\006\361\003Q\376\033"
+	.ascii	"b \332=\233\030\317\035\317\243q\236l\370\303\373D\204#\364\276"
+	.ascii	"\372&\376\2565\026\326%\230?\030t\003"
+	.text
+	.section	.gnu.lto_.symtab.9aeb1a391642f3e9,"e",@progbits
+	.string	"taskBatteryAlerts"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\002"
+	.string	""
+	.string	"taskSerialCheck"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\002"
+	.string	""
+	.string	"fcTasksInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\002"
+	.string	""
+	.string	"cfTasks"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\003"
+	.string	""
+	.string	"switchStates"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\003"
+	.string	""
+	.string	"specialColors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\003"
+	.string	""
+	.string	"modeColors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\003"
+	.string	""
+	.string	"colors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\003"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\003"
+	.string	""
+	.string	"pCurrentDisplay"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\003"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\003"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\002"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\002"
+	.string	""
+	.string	"cliMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\002"
+	.string	""
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\002"
+	.string	""
+	.string	"mspFcProcessCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\002"
+	.string	""
+	.string	"mspFcProcessReply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\002"
+	.string	""
+	.string	"isRXDataNew"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\002"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\002"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\002"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\002"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\002"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\002"
+	.string	""
+	.string	"olNavigationConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\002"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\002"
+	.string	""
+	.string	"taskSystem"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\003"
+	.string	""
+	.string	"taskMainPidLoop"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\003"
+	.string	""
+	.string	"imuUpdateAttitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\003"
+	.string	""
+	.string	"rxUpdateCheck"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\003"
+	.string	""
+	.string	"dispatchProcess"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\003"
+	.string	""
+	.string	"batteryUpdateVoltage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\003"
+	.string	""
+	.string	"batteryUpdateCurrentMeter"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\003"
+	.string	""
+	.string	"gpsUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\003"
+	.string	""
+	.string	"compassUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\003"
+	.string	""
+	.string	"rangefinderUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\003"
+	.string	""
+	.string	"ol_navigation_update"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\003"
+	.string	""
+	.string	"rcdeviceUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\003"
+	.string	""
+	.string	"pinioBoxUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\003"
+	.string	""
+	.string	"batteryUpdateAlarms"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\003"
+	.string	""
+	.string	"batteryUpdateStates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\003"
+	.string	""
+	.string	"batteryUpdatePresence"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\003"
+	.string	""
+	.string	"calculateEstimatedAltitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\003"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\003"
+	.string	""
+	.string	"isBaroReady"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\003"
+	.string	""
+	.string	"accUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\003"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\003"
+	.string	""
+	.string	"telemetryProcess"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\003"
+	.string	""
+	.string	"telemetryCheckState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\003"
+	.string	""
+	.string	"blackboxUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\003"
+	.string	""
+	.string	"baroUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\003"
+	.string	""
+	.string	"rescheduleTask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\003"
+	.string	""
+	.string	"mspSerialProcess"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\003"
+	.string	""
+	.string	"cliProcess"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\003"
+	.string	""
+	.string	"updateArmingStatus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\003"
+	.string	""
+	.string	"updateAltHoldState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\003"
+	.string	""
+	.string	"updateRangefinderAltHoldState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\003"
+	.string	""
+	.string	"processRx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\003"
+	.string	""
+	.string	"mspSerialWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\003"
+	.string	""
+	.string	"setTaskEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\003"
+	.string	""
+	.string	"rcdeviceIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\003"
+	.string	""
+	.string	"dispatchIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\003"
+	.string	""
+	.string	"altHoldInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\003"
+	.string	""
+	.string	"ol_navigation_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\003"
+	.string	""
+	.string	"schedulerSetMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\003"
+	.string	""
+	.string	"schedulerInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.9aeb1a391642f3e9,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1001 @@
+	.file	"rc_adjustments.c"
+	.section	.gnu.lto_.profile.876db73bab0d63a3,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.876db73bab0d63a3,"e",@progbits
+	.string	"(\265/\375`8\001e\006"
+	.string	"\262\210!)\220;cXS\nR\003\212\266\024\2445\361\3777oYX\202\266\rbwww\267\271s\243\321\322&I\244\024\331\335;\311\024\266\2347~\001\20061\242E\314\276I\032\035V;\360\323\271,\323\354\002\032>(\214k-3\230T\264\342\t9\223\362\215\335\256\277n\375\276\272}\255\247\337.\341\220\320L\366\202\"\006\205d9o\374\242y\237:5I\367e\301\2728B\013)\037]\376\227\367\351Dl \2403\177\013\034"
+	.string	")\"~\316\270hI\340v"
+	.ascii	"c\240\023\363f\003\323\004\026xJ\346'`\361\256\033J\006;\361"
+	.ascii	"`Dn\300\313\300\352\356\330Z\b\320\350\177X\023g\303\301\237"
+	.ascii	"\231\300\3165y\231w\227I\316\262\002\f\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.876db73bab0d63a3,"e",@progbits
+	.string	"(\265/\375 \246u\002"
+	.string	"$\003\232"
+	.string	"\007"
+	.string	"\002"
+	.string	"\001"
+	.string	"\001\001\003"
+	.string	"\003\004"
+	.string	"\005\001"
+	.string	"\020"
+	.string	"\007\001\001\001\001\003\001\200\004"
+	.string	""
+	.string	"\b\013"
+	.string	"\001"
+	.string	"\001\f"
+	.string	"\001"
+	.string	""
+	.string	"\017\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\013"
+	.string	"{ "
+	.ascii	"B\263\004\354\263\260\326\035K(n\256\302\346\272 \026\340\b\f"
+	.ascii	"\260"
+	.text
+	.section	.gnu.lto_.inline.876db73bab0d63a3,"e",@progbits
+	.string	"(\265/\375`l\005M\025"
+	.string	"\366\\aB"
+	.string	"\221(\035V\325\307\n>\365\021\001\361s\335a\360\303\335\277<\f\017\301\026\035\326\252m\370\343s\023w\371.\005*\370k2\t \300\242\033\t\020\314\337"
+	.string	"\210\341f\347\326@\265\345G\354'm\357$SP"
+	.string	"N"
+	.string	"M"
+	.string	"\377/$hSE\013W~\234!\333\003\006\n\020\020"
+	.string	"\n"
+	.string	"\340\343\001\321>:\234\215GG\324`\031\370\234\351"
+	.ascii	"\373\030C\266\013\322c\013F\320\234`\022-9J\230\245\231m\263"
+	.ascii	"\347\372\344\366\364\376\037s[\020g\263)\301\334\377\216\254"
+	.ascii	"\232b!\001\207`\027\0311.7\337u\371f\235!\324\033B\025\242F\251"
+	.ascii	"w\224jL59\033-\020'\236j\252\227\274J\031\321\201\252\275\332"
+	.ascii	"\366n\242Wd\373e\345\345\235\332~\360JV)w"
+	.string	"!l\374\037\341\235\270\021s\217\351\275^/\027\254\025q\027+\235Gc\343\3118f\274\230\001j\334\032Y\\\255'g)\254\325\360\237\244\215\037\017(du\037P\024\024\226\304m\274\3018Ji\233\310$\2565\203_\345V\255\375\252\356\3472\177-\372\271\255\333Vo%\207Pi\241t\336\273x\324\0035\331\247\007\3731b\022\023\230U\203\221\267\302\004\246C\250Y\313\201m/\362b\374\327t\323\27669I\342\272\001k)<\016,\023\256d\271\315\n>IQ\322R\030\315\024\266\331\313\232\225\236\312C\r\021\260p+\f1\013\027/\024.,4Y\205F\200\240\250qM\242\231\231 IQA!\215\001\240\002!#b\035\020@4B9\3152\006\223\352\2366\216G\341\001\324\022?K68\341\032\225\371\177\325\004\foP\223F:\"\325\177\017D\315V\377\301i\233\302\273\375\370\241\344\2472\313\337\n\020"
+	.string	"\255Q\205\311O \367\314IT\367\305\210\252NdI\032\215$\307e\222}\2228\221s\353?\241\"E\"\260Z\264\3741\243\332v\224K\177\330\203\361Jtt2b\265l\304\337\3615\216\334\003.Q\2417j \344OE\005\022\t\244K]y\013$jV\362\217\2022\341\300\004\240b\036e\326\n\212L \356c\b\003\255I\357\030n\361\315\370\371_(x\021\007\341\330\261i\2167\257\254g\244Lj/X\347\347j\306(XN\355o\232~\354\223U\317\373|I 8\235_\206o \210dv\237o\r\355+C\354j\270\262\370\216\321\177\0055\315\242\341I\006\006\254$\016c\020\2071\210\303\030\304a\f\3420\006q($\355\024\340n:C\322\376"
+	.ascii	"O"
+	.text
+	.section	.gnu.lto_.jmpfuncs.876db73bab0d63a3,"e",@progbits
+	.string	"(\265/\375`\245\003\305\n"
+	.string	"\222\0171/`\211\222\016!\310k"
+	.string	"\3563\215\303\245]*\b>\206i\304\263\243\030\303\271!\003uQ\300Do\006\374\003\375\366?\332\027\037\357\223F\232L2\\\364\242\247\310\007\t\002\315\211V\362\206g8\350\245Q#\035\344\327\t\n\375\2165\362\312%f\254\022y\350\361\270\\\"\252^\305:\247=\247\365\250_\030\314\225\311x\250\321x\346f\263\207Q4M\020\310%I\0245\231D\"U%\221X\026\203\341p\243\361\340p\204(\224+"
+	.string	"\356W*\244\230\020-\340\316\320\244\305\262A+\233\364\252\036\353\t\374\321w\247}\247u\"\224}8A{\240\322\257\264zI\316>\323\3543\247\013Z\231\325\223\364\250/\027d\013\001X\250\201\254V\263\240\240$\331\343@\303\241M\007\022\340\301zFB\312\030%t&\254\212(\354n\tv \372\004WW\224\367\351\220=Y\200{_\316\310O\215\374\355\224<\240\002\327~\200\035\242\t2o\255\261\372\256\202\300_\246e\263\240x\240\327O\216\022\220\005\312\304\006d\220\214JHhk\375\023\324\022\300\013\362\222\221/E\311\203:\270,\021\253\261\271\261\271\315>aA\241\006 \0064\035\013"
+	.ascii	"36\213\n\244\274\215Q\3216\324:\253,\305\f"
+	.text
+	.section	.gnu.lto_.pureconst.876db73bab0d63a3,"e",@progbits
+	.string	"(\265/\375 \032\321"
+	.string	""
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"\007"
+	.ascii	"\230\004\001\232\004\004\232\004\005\232\004\013\230\004\f\232"
+	.ascii	"\004\017\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.876db73bab0d63a3,"e",@progbits
+	.string	"(\265/\375 \276U\003"
+	.string	"\202\305\021\034\220E\351\217\357z\377\177\330\376\243z\233\377\226\r.\356o\334Z`,i\204\354-S/\315\243\250\277\017\211@\004\032\324Z\237\251*\246\277\357qw]_w\215\313\314;\313\001w$\331\035\277\027\227\034\354\177\360G\001\r"
+	.string	"r \001np\006\242\2321\202-\241\206\343j\030\n\373P\253\355S\241"
+	.string	"\001+d\r"
+	.ascii	"\016"
+	.text
+	.section	.gnu.lto_.lto.876db73bab0d63a3,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_adjustmentRanges_Registry.51.876db73bab0d63a3,"e",@progbits
+	.string	"(\265/\375 \213\r\004"
+	.string	"4\007R"
+	.string	""
+	.string	""
+	.string	"-"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\203\267\317\ryw\250\367\005yu"
+	.string	"\005\001\006'\001\332%0sq\300\001o\277\001m\276\001k\275\001i\274\001g\273\001"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/fc/rc_adjustments.c"
+	.string	"\004"
+	.ascii	"[\005\2412\3223\211\033@\021"
+	.text
+	.section	.gnu.lto_defaultAdjustmentConfigs.55.876db73bab0d63a3,"e",@progbits
+	.string	"(\265/\375`,\003\205\n"
+	.string	"\344\016\037\004"
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\377\001\005\001?\202\210\200\b\177}\273\001\030\030{y\276\001w\275\001u\274\025\001\027\b\177s\275\027\303\001w\302\001u\301\026\026\307\306\025\025\313\312\024\024\317\316\023\023\323\322\022\022\327\326\021\021\333\332\020\020\337\336\017\017\343\342\016\016\347\346\r\r\353\352\f\003\356\f\360\357\013\013\364\363\n\n\370\367\t\t\374\373\b\377\376\007\007\203\002\202\002\006\006\207\002\206\005\005\213\212\004\004\217\216\003\356\001\222\002\002\226\225\275\230\002\300\003q3\231\0024\227\002\224\002\223\002\221\002\220\002\215\002\214\002\211\002\210\002\205\002\204\002\201\002\200\0025\375\001\372\001\371\001\366\001\365\001\362\001\361\001\355\001\354\001\351\001\350\001\345\001\344\001\341\001\340\001\335\001\334\001\331\001\330\001\325\001\324\001\321\001\320\001\315\001\314\001\311\001\310\001\305\001\304\001\300\001\277\001"
+	.ascii	"c\250A\330\224B\226\355\220\2234\305\006\020\020\b\211`\224\302"
+	.ascii	"\001\022U\310A\271\\'>\320g|m\226\267\236\305\314wx\241\250&"
+	.ascii	"G\302$>\3226\344\006\322\267e>\336%\231\267\353%\362\357&\364"
+	.ascii	"B.jC\023\267\240\033Z\221\033\2215\243\303\330\346\204\264\326"
+	.ascii	"\251\347\037\350W\202\266T+\252\250"
+	.text
+	.section	.gnu.lto_applyStepAdjustment.58.876db73bab0d63a3,"e",@progbits
+	.string	"(\265/\375`\343,]\202"
+	.string	":\324|.F N[\031\016\257L\033.\263}\267W\212I\213\353G\320\031#\302s\324\377\254\264\334"
+	.ascii	"\264Rmm\303~\325H\3661q\3275\347\327\231\360`\234}\303:\325\214"
+	.ascii	"\325\310\265^B\036h\301H,\r\t\331d')e\343\002\214\002\337\002"
+	.ascii	"\275%\324^\022\357\035\361^\021jo\b\265\027\304{\237\336\373"
+	.ascii	"A\355uR{=\274\267\303{9\250\275Mj/\323{7\274wI\355UR{\223\336"
+	.ascii	"\213\364\336#\265\327H\355-z\257\206\367.\325^\"\2657\303{\225"
+	.ascii	"\357M\252\275\252\332\213|o\372\336\253\275\315}\234\342\004"
+	.ascii	"q$\256+\225\307C+\037d\337\t\fe\336e\266\27385h\034\332\034+"
+	.ascii	"zf\177\213T\242\213S\366D\321\023G68\346g1\3540\256\235\206q"
+	.ascii	"\375\245\270\370\b\303b\343\241\030\n1\236=\026\252sT\224\363"
+	.ascii	"\302\335\2409q\211zq\207uZ\370+\324\263\b(p\361\017\240\270>"
+	.ascii	"\203q\202\207\213{\f\027\003a\210\303\223\030g\207\320b\035\305"
+	.ascii	"\305hc\034\235Cq|h\217s\354\034\345p\236\006\214\267O\203j\260"
+	.ascii	"\273T\201\343\354.\327\t\343-\022j\027\267\256\353\322\311\356"
+	.ascii	"\222\221*v\275\226\357v\271\273\320\215*\277\252(\241"
+	.string	"p \bZ\327U\212\221\033D\371\346\272\215\246H+\224-\200{\353\272Rm\003\357]\0271\274\030N\223\221Vg\237\267\034\334\273\334\206\335x\361\334\007\234\264\256\\\016\367\326u\216j\253\224\214\3349\345\356.\313\361\032\257\335h:\367f\226\034;4f\267\270\256\253\325\bfR\031\231\362\222\312\310{a/\3367;\207#\013\353\206\215\0324f\310\270\212\001\343\205\213\026,\254\252\250\246\244VD\251H\201\002\352\204\211\022$F\210\b\001\342\351\203\223\207\016\034\232\2306,)%!\035\031\025iX\022eP&Ud\372\366Z\216+\334Sf\366\305\373f\347\322\263\266- 0\216\2476'\by\217\235\205\325\3107\032\371\016\265\215\032\206\230\206\241(c\317\220\221\310W\211v\020;\006\fC~a\310\201-\264\213\026\205\314\242P\220\260\255\252\3640\225\236?\201=\225G\n\017\257\300\303\205w:J\005 \247"
+	.string	"\344\3039\215B\017*\217O\344\r\222\323&J\304a\022qXQ\205\036\201'\302\r\207p\303\214m\032\304\323\032\376\260\206\033\345\332\311\303\223;<\277\342\232\303\tMc\230iL\230\230\336\260\004\206\225\300\220}\351$\2447>z\233\222\245\215\260\024]a\rW\314J\350\245\t2&\"\321&\302\b\234\201Y\2502\002\032\223@\241\n[+\323\025X\362\2341\013U\326R\2464\255\315I\326I5V\323\025\202\370\b\031\231\215\245LT\306\2245\233X#\261\2549\306\260\230G\017\357\204\303@{\354\254\300FM\0308n\253B\002\221Y\230z1)k\033\332\234dL\351\031?u\302\222\347\314\310\314\231B\tn1\344;\356(fP\272\2239\326u\335.3\023\201\027"
+	.ascii	"\336E."
+	.string	"\355\256\007\273*\006\bw,\345\007\245\003t'\305|\347\254\366m1B\374\230\236\357\274\3258U\003\267\367\364\002\205\301\331\217\233\301\377\364\375G\f\213\363\377\025\307\034\301\372q\252\013\233Y\204\353\272\316\330\345jB#\312u]\257\030\271\r\350\211\030\222\253\2670\037\250\214\354\037\371A\237}`\375\270}\205\225\316\370|u\343v #8\207\274\333\366\247\330\213P7oTE\362(\335g\333\317\"\246\201\200O\202\213\230F\327>pS\325\263\275g\021S\2755\247<\213\230\332\001z\340\246jg\373\016\207)d\177\333u\232\016\321\331\366cJ$\263j\331\333\346[D\344\037\300\ry\333z\213\210\374[[\212\263\275\302\"\"\241\200Jx\213\210\f\\K\342\246\n]Dd\036\0227\325\272EL\033\217\270\251\276\331\206\263\210)\fkFn\0261\005\004X\304Mu\3156\233e\240\347\266\032\242@4\333i2"
+	.ascii	"\232\331>\243|\222\331.\223\2142\202\230\3551\252\241/\333`\220"
+	.ascii	"\207^\266\337R=.\333n\3073a\273\255\341\310\254Z\260lgYD%sSe"
+	.ascii	"\344v\331JVF\246K\330]D\365n"
+	.string	"m]\277\030\313\"v\331\032\305\310\r\336ma\3265\355\270D\215\344\273I\272\232\313v\004\224\177\245\351\335\232\371\024\005\265\374\\V\212382\313#\235\036(mhw\316\331w\333\345t=\227\335;\200\177~}{zr\342\340A\353\340\274\021\023\006\314\027\2707/]\334\270\264eaSK;\263bF%\004)ed\357\345\261\367r\330{\331\251\3662\330{y}\357\023\265\367\003\236c\366\340\275\035\274\227\003\265\327\t\303a\336\340\275L\336\273\204\353\2303x/\022\206\362\036Q{\215\274\267\310{\271\336KD\355\335J\366V\240\366j\275\227\202\367\016y\357\004j\257\220d\257\004j/\363\275\021\2747\210\332\013\201\332\373\300{\201\274\367\307{\035P{\033H\3662\240\366.\360^\005\336\233\300{\021P{\017H\366\032\240\366\026\360^\037\357%\340\275\003\250\275\002${\003P{{\274\227\307{w\274\027"
+	.string	"\265WG\2627\207\332\213\343\275Y\357\305z\357\r\265\327F\262\267\206\332K\343\2753\336+\343\275Wjo\214d/\f\265\367\305{]\274\267\305{Y\250\275V\311\336*\265\227\352\275S\357\225z\357\n\2657*\331\253B\355M\361^\024\357\205z\357\t\265\327D2\317\202{\001\306\227\321?\30659(\354"
+	.ascii	"A=9\322\240\023\\\006-\363\211\210\\\316\203^\334\260\t\325B"
+	.ascii	"\240\266'\177\021\365G\017\372'-\316\320s\"\213\267\260:\213"
+	.ascii	"4'\0044\330f\365\254B?U_F\365\236k'\230\321b\242\304z%V$\321"
+	.ascii	"\246\270\314\363\331\323vV\244z`\023*\217\227\334\023\036&\302"
+	.ascii	"\365TQ\321\2735\016K\235\361\316/\254\270T\324W\330if\275\001"
+	.ascii	"\326\031\023\365,\270\250\212/\243w\3175\025F\320\261\360%\302"
+	.ascii	"\371#\306\020Y\030\227y\276\275,g\306\024\327kB\345y\311=\311"
+	.ascii	"a\"t>E\224\037G:'\343A\235\343\234\013\2358\224\211\237\360z"
+	.ascii	"^\205f\026!\236\227\\\2147/6\277\363rs\250\227\032\035U\204\031"
+	.ascii	"\250\2144\361\254\3026`\247{]\006\313avG\217\036*#K|\351\347"
+	.ascii	"\370\\\013\223E\013\210\247\260#\271\361\003\0337.\363n\332\260"
+	.ascii	"\235\033I|\215\034\t.\205\350\302F\234\345\234c\020\361\021!"
+	.ascii	".\242\007\377\214\013\361\2433\205\236}pW\366\234<\214\335\350"
+	.ascii	"\253C\332\3272\177\306L\332\373\013\304\313\220\031;\2103\212"
+	.ascii	"\316\261\247\263\336\371\361\303\237\234\376aL\023K\214\323\217"
+	.ascii	"\316\3000\307\241\r\232\246\262\027\2051Y\t[\346\341\336\254"
+	.ascii	"\274\303<\274K\363\204[\331=\324\031\322\355\235\313:\234\367"
+	.ascii	"\336N\016\357\320t\016[\232X\002\274\255\351Gg\f\237}]\370lX"
+	.ascii	"\222\362\223)\205@\266\314c\271\022\302\233\354C\357\026p@s\331"
+	.ascii	"j\240\243\306\307\371\257e\372\bLQ~\177\234}g)\033\316}\357\261"
+	.ascii	"\245oP\372R\002_k*\225^T\347\207\261\315\026\2665\t\211\312\237"
+	.ascii	"\246\034\221MY\346\317\254\220\275\247$\335\254\tU\205\312\223"
+	.ascii	"\374\364\320\371\235\251\334\311Hg\277w\224\243#\031\375\350"
+	.ascii	"!4\263\246\030\375\250N\317\223\005#>`\336\024\231\375\203\231"
+	.string	"\006\0063[\346\311\016\002\203\275\315\212.\326\204\n+\252\373s\376\235\315\326\217\206\363\337\233\312\362\032\210\276\234:X3\353m\201\177\021\375\250.\312\330\007\246\205\371\216\177\240Ua\024\364\325\215\313\273\021\235\335\t\255H\f\2640\303\335\332\005\376"
+	.string	"m\231\335x\350\2037Z\206\033b<{\006?s\234\200\347\263\016\304\3123\340\333J\362J\365I\252.\324\314\"t\245\376\310O\217\261\017,\220\271\033U\254\221S\243\274\333\342\341\r\222X\330\"\370B\237B(m(\331\324\254v\017\374C\335f{ \b\362_\3120\303FU\210\352\344\025\320\005j\266e\366 !\312u\205r\265\235\330\202\206\354jm5\227m\251\214t\362\247\024-X\330\264A\376\260\te\b\202\313\\"
+	.ascii	"S;\362\034{\244\212\311\221&ZI\254\224t%I\322\265\345\304\245"
+	.ascii	"\301\005Z@\234p)Qj5\271\200\213\bRI\027\222&[J4\b@\311\b\222"
+	.ascii	"\"J\272vp5\321b\340\202\256%M\224tm%\355V\025\223&J\270\2224"
+	.ascii	"a\242\201\005D\264\206l-\261\332*b\245\004\211V\022\253\255%"
+	.ascii	"L\254\252Dl\027\006\\K\254\232tu-\261Z\316\201\361\271,\303\361"
+	.ascii	"9\246U\314|]r\0249\273\371\303\002rv#V\303\307\231\r\032\031"
+	.ascii	"<\316r\2030f\234\345\322ZL\235\237\320*&\3474h\24488\247\360"
+	.ascii	"\247\242\203\263\031(\324\223s\231\301\022\274\236\263@E\260"
+	.ascii	"\363|e\360\211\303\316W\322<\360\330\231\004\261&.;\263\245-"
+	.ascii	"\261\224\263\032\024\211\251\234\321\320\024\261\331\331\312"
+	.ascii	"\037\021\237\235\313\230\351%Y\355G\036ew\217(\007\321!\303("
+	.ascii	"\b\354\316m\022xs\374\361\361\221NG\216\"\347\220\207CL\3362"
+	.ascii	"\323\026\002\2119\347\0319a\221\033\021\263\233b~\363\"\\\347"
+	.ascii	"7\3478D\316\265u\"e\322A5[~*\370\362\317\356\t\310W%\013\013"
+	.ascii	"\310\233\370n\204\341[f\312gO\2303\237\326\003\231\b\201\\\013"
+	.ascii	"\355\321I\301\2018\0169\005\3479\023|\210\220O`&\275\323TBu("
+	.ascii	"\205<\003\240\004_F\035\031\327\242n\346l\324\360q\246(\r0\321"
+	.ascii	"e\246~t"
+	.string	"\300\234\243\314\363\245{>\316\224\262;\244\300}Dp\005\316t\202<\002\b\036$\325kf\021r\245y\020\374(z\350\331\327'h\206\f\036_\332\271\372bg\231\251\nx_\316v\0368\324\256\356\016\217?`G\310\231u\036?\236u\256\343\300\1774p\007\340\274\231\273\323@\033\006\276\214*2\312\261\321\022\003\306\214\023\005\276\200\013\\f\252\346\tw\016\\\340i\320\24408\343\013$\322\271\370\214\004\356\342\214\007\201'p\300\021H\223\232A\241\314\340\001'\030\360e4\361\031\267\347\242\305\3243\b\262x\023\\f\n\346\313\333Y\260\200\2775Ox\351\342\302\324\013\260;t\242\370\024\001Gq\3363\300\t\020\340\003\244\\\232X\204\351\226\266'.\bp,-\001|\0315LAn\265\252b\362\r\177\250\274\374YfZ\002\t^\316\177z\234\255\t\265\346%\367\244\306\344=\242\203tK\316d\307\227\234\373"
+	.string	"\360\035:\016"
+	.ascii	"Zz\226Zy\342\250#5\313\361et\3609g\352.\361\215\024\007O*\\\321"
+	.ascii	"\245p\231\351\224TJ\227s!\216\2275\241\310R\020\31288\216?z\340"
+	.ascii	"\234\003\2543\2343\240\033\307\262\361\033)\244b\315,B\2524,"
+	.ascii	"\205Rf\343Y\205)X\215/\243\201\214k(\244\211R\321\301\227\016"
+	.ascii	"S\270\035.\363\216\215n\347C\032\217\241\te\2101\255\203\323"
+	.ascii	"\210\326q\326\275\003\031\347\272s\013W\227\021\343W\205\b)\246"
+	.ascii	"\305\b\203}\250b\2209\227*\245DDDD\222$\225t\362\r\b1\3100\212"
+	.ascii	"\352\001\022@\0221\n\307\221P\"\006EHS\250\321\030\\2\307\023"
+	.ascii	"\343$\324\021s\005\347\247\365\305\374\326\267[\037\036\325k"
+	.ascii	"\220\345\213\320\305\367[\n\215d8\300s\371m\221\204^v\r\034\032"
+	.ascii	"\201\346l\247\320\251\033A\013\237\361\230\352\300C\214\262\342"
+	.ascii	")\371KRM\375\201\233\265\344aI\325\347i\0169\316\261_{\371\303"
+	.ascii	"\206\376yC\205}V^D\031\336\030)\212@\364H;\004\023\347oi\347"
+	.ascii	"\350\247\005p\330\037F\361R}\366\r\213\327-W\f\363\253\327P\326"
+	.ascii	"/\204\304\026\317\262\240\250\260\315\355'\265\026\034\024r\361"
+	.ascii	"_4\226\001\340\030\034!\340S\377bY\334\0202YZ\210\n\373\231\357"
+	.ascii	"xn\230\001\230!|iD\303b\374C\211\026<KT\016\223`\335\022Rj-\242"
+	.ascii	"\304\357\371\344\367\006\373\266\300*\023\365\260\t+\2000s\274"
+	.ascii	"2;\361\215\250\262(\3615\020\251\034\034\231\265\325\325RE\f"
+	.ascii	"\306G\244\2721J\243\301\341\344>\224\037\321\357I\261\262\234"
+	.ascii	"\257\274\306\203\242\352#\321\256\310\204)\235\213q\211\344\224"
+	.ascii	"\335\307<Y\230\202D\204\375e\331\204\361\356J\243\357\335\223"
+	.ascii	"\346yT\\\317\005Y\276L\262\343.\252\235d\314h\003\016\3540i\227"
+	.ascii	"\213s\322_\335\322\344\255\257\247\222\271\255&c\361SB}\304\253"
+	.ascii	"\274\223!\332\303\024\322\351/\272\035\222\026\242N\304Z}~8\243"
+	.ascii	"\212<\351H\367\n\3313\035v\3347\024\331\303\030G}\022\311\376"
+	.ascii	"\306\222\372i\246\223\261\344\221.\030`j\006\260]\241\233\032"
+	.ascii	"8?G\246f~0\3553\210\231\334\032\314\320\310\237\366\004\"B\201"
+	.ascii	"\265\244\234\2324s\254\311<_d\244\274\326\177\177\362`A\376\013"
+	.ascii	"\217\203\211\300\375\021E\0058\206\026\r\201P4\320\2737\034q"
+	.ascii	"\306\336<\241C2F\363\353'3g\375\222:\"l\304\004Bp\366\327\034"
+	.ascii	"\266\351\204D\204\322y\272\204\247\004\212o\023{\374\301\327"
+	.ascii	"\025\277I\252\316X\314\016\255\370[\370P6\225\260v\254\022\370"
+	.ascii	"R\030jn\246\027\310\255\3549\303;c8\347"
+	.string	"\254W\016\247\340\334&\321c\017\223\254RC\323#g\310\032\t*,<\334sb\272\315Z\027 )\332\221\312\315&\217g\216\347\234\210\370\177\016aa\313*ovS\002s\222\333O!\t\212\341\235*\334\220\273\267P\342\272\301\353\023\254/\324\241\223~\232\201\016S\006\374\3648\252&\245\rw6\337\272\004}\222\232\211g\334\215.\021Y\211?H\261\327\256\343\200~\314\211\225\024r\212\330A\031\020GL\225\270\0341\360'\246\237\211\265\335\267\202\247\241\226v\3058]d\007\310Ve\340\324w9\232\026\030\354\2724\254,R\201\214\374)r\361\350w\237\033\243\244\212\223M\\\256\020\351`\236\241c\226<\276\006\314ie\344kY\366\032\205\026CB\016\332\274b\321e\f&\217\377\326\300\232\033\013\302\211d\350\243D\030\244\241T\006-G0\002\273\004\210\272Z\231t+`\201\323w.6\300\353c\037\240\267\004"
+	.string	"\217\200o\337\225\347\016\324\210JO\034\024G@\325\004\313,\001\016\004\246"
+	.string	"z\204KVH\212\303\211\025\022W?\232\227\375q\006\021\237\351\004C\350\270\2135\311\234\031\305\275Q\216\013\315\r\312'\354\351\013\216vuoW\236\276\330u\355\345^h\b\253\334xL"
+	.ascii	"\275\206\305hr\264\250\330\252L\341\fQCN\037\245\016\025\272"
+	.ascii	"E\rO6\030\230\002\004_f\351W\003\300A\201\262\321\217cf\242\251"
+	.ascii	"\215\2120\273\345#&8L*\371\037k\322\235\3240\203\016\306\325"
+	.ascii	"2\353M\233;\373\200\220\352G\364\233\265_ \211\336\254\227\276"
+	.ascii	"\312\223\377I\355"
+	.ascii	"@\001rmc\222!57\325\f\234\336\250\236\244\262\322\320\216\331"
+	.ascii	"E\357\331\224s\210}8O\035\"wz(\252\320`T\030\366\210\376t\262"
+	.ascii	"\224*\344(\373_\260\"S\340\224\371\036x\372\372u\327\260hR\302"
+	.ascii	"\340\311\026M\222RL\366e\202`\365\254\366\264m\264+\272\277Q"
+	.ascii	"}\031\265M\023\032c5\334\003:r\221\336\352!!y\347\253d (\255"
+	.ascii	".q\3473p\276\225\267\340\004\252\331;G8\254\312,\335\236\207"
+	.ascii	"$\222\372\232\\H]K\3135/\0232\327j\345\rM\335\323\252A\022\314"
+	.ascii	"5\026\315\271\372?S\303qF\237'4\"\311f\233k\312\231\222\313\320"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_applySelectAdjustment.59.876db73bab0d63a3,"e",@progbits
+	.string	"(\265/\375`\261\005M#"
+	.string	":@"
+	.string	"\016D\200\236M:G-\234\215\301\344\r\354\271H\245r\363\353t\340!F\2628\324\362\306w\257\301\202\332\261\301\221\334p{>Q\316JU\016\007\347\335\201\222\"\260\304,?\213\222}\2144\327\246\326\244\021B\344N)\320"
+	.string	"\272"
+	.string	"\313"
+	.string	"\365\254a\237'\251m\303'\372\264=\344\231U\313\006\366d\211\236Z\207\016NZ\003\027\357\003\252/\316\020\013\224~\213\347\2555\330\206L\255\303\007\206`\236\264\355\b\022l\230\367\341\222\036\270\035\301\037\027\265Z\207\272Ur\336\001\344N\334\315\264\225\344\270\224\347\023?VA\313\003\264\352\035"
+	.ascii	"\326sX\304\"\364\244D\216K\220\345c\310o\207S5$L\b5G\002o\220"
+	.ascii	"\340i\020d\363\343`O \245*\b\265=\313\007\221\227W'\307\006z"
+	.ascii	"\312\364\t`E5\022\350\001\005x/\034t\034\021\254)\373\035N\025"
+	.ascii	"\326x \211\221?'\236\346\260\232\242\373\303Y\371J\002L\304\232"
+	.ascii	"<\253\nk\251\255B\255\325\024h\345\343\016p\333}l\227\260I\022"
+	.ascii	"\001]gS\024\220Mj\317\200\242\007\322-R\263\246\314\267=\037"
+	.ascii	"\314\013\214\225\365\350\2403\021c2\266+\364\311\370e\216\262"
+	.ascii	"h\325#a|1N3k\355=\230;\257<i\n\254;\232h}\261\235\366\007\235"
+	.ascii	"F\201\225\301I\001K\325\210\225M\3215{\350\243+\264\277\305b"
+	.ascii	"\361\2177\211=R'!Qj\243\242\177\335D#\365\320\271~\241o\375\002"
+	.ascii	">\274s\224\372\034\251q\224\372F\251MJm\033\251K\222\232\244"
+	.ascii	"\324#\245\336\221\232\036H\332z\303T\254\265GQP-#\315D\371\327"
+	.ascii	"?<\265\037\326\305\344\225\331\267\370`__\236h\361\360\256{\331"
+	.ascii	"\247k|\213\311+2\265Z\003|\312L\242-\355\f7\343=\250\363\346"
+	.ascii	"r6(XRk\245\300\341q:\230\265\326\tp\242>\030\250\343D\252<i;"
+	.ascii	"Y\356\003;\\~\233\273\221\362\2358\204\b\021\345IrmT\344X\tb"
+	.ascii	"\264DCh]n\261r\\\2435\245\332\343\243E\013\355\270\007;Yu\247"
+	.ascii	"\370[\373\230S5\201l+<\257\024Z\244=\361\013\372"
+	.string	"\260\351\242\363\025\364\225Et7w\023\245\357u\002\005\271\275\244\2566c\344\n}\245rhU\334\313)N\246d\326:5\301\027\373\330\222\357\344\244w-\350\201'\375\026\345\311\241\275\327\251\025\035G\202Y\270N\272k\277\210A\0174\202\251\355YhwA\234\371\371\255\335\240E\237\231RL\033\205\226\356\263\002;)\030J#h\354\232L(\031\273\235\n\222\t\312I\206\331\344\304\024\265\324$ua\310K\020\240\242\232v1\242\240\244\\\254PJ\261\364\244[b\241kbR\212\241[z\202\322A8`'\031\273']\224\223\323\223\356\034\336\370X7\311y\020\301Rvc}\276\227\273B\217\016\032k\255\025\300I\317\2651\344\366\334\bhd\3034g\302\344V\350\023O\222]\225H\267,i\202\270\242\315m\016\233W\346\366\210\n\035\0338pgd\266\324\352\26028\361\025\274~|\304\234+\304\215{\024\266"
+	.string	"\310\036\265\333\n\321<)\314)\216\206'i\037F\264gv\352\234s\314\254\004Ys\334\026-\035D\025\274-n\221\302\374\326Lso{dFu\305\266Fk\356hF\245U\256m\313*<c\364\224\tl\250a0\303\220S\212\221\021\021\tC\nR\314\001\220\002\0212\253\016\021\260\261cc\223\264\316\030<0\225\362}Q\367\344\316L\240\237pE\334\211J\365\202\267\344\255g\373\374\206F\267\362\036\025\214b\262&\034\371 k\242J=\322\223\214\351\272\336\177\306/.:\215S\241\2227\333\002?\rN\021px\365\001P\223\\\n\013y\207\327+e\311\207}\271!%/\244)\333\335\032P\327\220h\323\254L\205\204\335\216C\007\231\270\204\225\374\216\205\035\263\253\205\223%\240G\377\344\216\366\376.\326\366$]\320\211gH\2700\201\006\005\377\344g|\364\266\211?%C="
+	.ascii	"cX5\361\031\263\206\034\235\317d/\304\210\353\244\315\333\250"
+	.ascii	"\272\003HA\270\336:\362\243\260\310\356\241H\005?\f\023\253\340"
+	.ascii	"\"\222Z\315s1\357Q\001"
+	.text
+	.section	.gnu.lto_processRcAdjustments.60.876db73bab0d63a3,"e",@progbits
+	.string	"(\265/\375`\r\016\035J"
+	.string	"\372}\f\034?0\242N\007\374\022\245\307y\246\006+\001\327\364\250I\0200U\f\240I\207\245M\2132\036Exq\030+D5"
+	.ascii	"\001(\021z\364\310\245\003\004\244c\324\214\021\211(B&B\366\336"
+	.ascii	"{o)S\n\261\001\212\001\270\001\356\337\307\347|SR\243Y\352\346"
+	.ascii	"\346\215\n\273\361\217\343\311=\347\203\303\306\3405nm\206a\217"
+	.ascii	"\367o\334\223\236\343\335\370\366C\223\\\343\337\346\365<\231"
+	.ascii	"\007\235\n3\232\243\205B\336\2340\033(<\277\275l\n\261\030\316"
+	.ascii	"\263u\353\321\370\253I\343|\027\n\337\314(r\270'\277\335_\346"
+	.ascii	"\357<\351n\346\355\344?\263cJj\235\311Z\020\346)\001\177;\305"
+	.ascii	">\220 \277\225\307T\230u>\222\241\320J\2278\317\326\252o]\203"
+	.ascii	"\373k\367\247\3731\362\327\371\370\243y\236\322\347\315<[\031"
+	.ascii	"\370\025\374\255[\177\311\375\026\376$\367[\227\335\t\337je\376"
+	.ascii	"\274?\324\273\304y\236\231\273\212\263\317Z\337\243\264\374R"
+	.ascii	"QPONMLKJIHGF\313\"\"e\022\031\303\257\333\262[\313\376w?\340"
+	.ascii	"\321\257J\026\366R\254RP\016\355\001\307\350X\bgm\004_MTGQ)\023"
+	.ascii	"\363P\257\206''0\272\351\201\200y\246-}nz\211]0\307.\265i\245"
+	.ascii	"\265\262\271OR\003\207\224\005\213>B\272\325\r2Z\002\216Yy\242"
+	.ascii	"\213^\rkeW\236H-\316S\305\2159\321J\3001-\354T\334X\232N>A~\334"
+	.ascii	"X\223\327{*\30014\035S\255\225\235=\314B\251\375%y\300\2613\326"
+	.ascii	"\200\036)\201>n\314L\277\313*\234\313.0\204s\250\210\214\312"
+	.ascii	".\035\331R"
+	.string	"M\222Mu\373\266]\007\255\225\205y\226\215\020\210\f\255\210,\b\233DB(\370z\257\305\310\244z\277\232o\333\026\007\255\225\211y\375j\230\347\331u\225\254\354\035\300\273\353\327\335\341\334\225!\002\217\356\376\341\371hm?4{\002\365\336~h\024\037\260M\036\341[\230'(\352>\324\315\260\245\350\252\204\370<Px\236\245\023\374\361\364\030\361w}\346y\316\260[\3043sz\017-\314a\313\252\315{\355\361\342\262X\331\315\346_\356o/;?R\275\350\356%\336\316\327\333w\235\260\366\177&\226\207\034\023\347y\306\242\363uP\370k\371\326U\254\320_e\341~\373\373\365\036A\337U\261\016\210~\334gm\004\341\266'iw\027/\364W-\354W\3043\033i\367\255\246\376*\326~?v\254\212\206\321\035\346n\215\352\315&(w\246\347{\212\373\211\257\373'1BD\254]\353\325\376!\326\356\241\303\263y\347"
+	.string	"k\317\372\274\367\f\261v\f\261\366\013o}\267"
+	.string	"k\257\360g\336\261b\355\017\236\357\275\301\357\2753?\315\373\025\254\235\001\254\335*\326^\025k_\020kW\020kO\020kG\220\324~ \326n \326^"
+	.string	"\326N"
+	.string	"\326>\200H;U\254}*\326. \326\036 \326\016"
+	.string	"\326.\365j\217\202\265C\301\332\237\220\332\235\220\332\233b\355L\261\366%X\273R\254=\t\326\216\024k?\212\265\033)\265/c\355EI\355D\261v%\254=\tkG\302\332cX;\214\324\376\"\265\273\261\366\366\325\316\302\332\367\253]\273\332\037EV\037\265\2646@{\320:\037yl\234\363\264{n\317\367\277\367\317\346?\357?\315\277\365\377\314\277\001\217\270d)b\377\030CW\242\021\233\271\305\252^\300\037\253\017\260\005\354\247\232E\001\354"
+	.ascii	"\373\247W\251\r`\177\231\324n\231\354\2313\313\202\263\202v\244"
+	.ascii	"\031\t\323<J\217i\305\324;\211\372\2106\302\247\372\203\217\265"
+	.ascii	"\243\366\313a,\204\322D\236\366\336P\373\3438\355\255\253OM\333"
+	.ascii	"\211i7mV\020\323~0\214\203\257\264s\302\305hi\2138T\332K\373"
+	.ascii	"\205@)\364\241\366Q\332D\210\177O_\202\310-\223\352\354\376~"
+	.ascii	"\200I\332n\031#\336T-Z\204\264Gl\355\030EK\241\024\254\270,E"
+	.ascii	"Ge\266o#XA\332D\203~\212u\006\026\327\006\2116\233\037\255\331"
+	.ascii	"\335\221\352E>\327h\037\355\227o\271\215\344*z\226\257\\\377"
+	.ascii	"Q\316\322&\273\271\271\337.\267\204+uD\273h\277\214o\224\341"
+	.ascii	"`\377\305g\224\345\344.\362\027\371\213\373-\321\216\3678l\345"
+	.ascii	"\3768\317\336YD\244^\331\024\272\323Sn6=\237\334^\362\334'\302"
+	.ascii	"\311\035\343\365\315\325\001y\250\213\334\034\266v\024\363\206"
+	.ascii	"\3441K&|\205\b!\367\222\t\3373\361#\226\226\3645\201f\342 y\270"
+	.ascii	"\026\266\024\035\243\335\037\251^,\214\343m\370\325\303\n\033"
+	.ascii	"\336qL5{w\205\355\232z\365\027\364\204\362\030\177-.\223\331"
+	.ascii	"\240\277\272a\307f\356~\367S\321\332\355n6\217z\275\332V\337"
+	.ascii	"\356\177K|\2346\262\033\220\326\213\207\007\346\217"
+	.string	"\237\366\256z\270\013\275\226\213\265\331\375t\211\210S\265\0172\347O\nwp=\034\005\006F!\024\210\347\303\366\260_C\324\253\336X\373\303\3767\017\".-\r\037\"\232\267\250\016N\343\352\313F\027\030\224\351|\336\270\361lB}u}=O\320h\202u\345\370Zn\201\331\340\212\321:\237]`M'\024\004\222\r.\247s\213FS\251\203+\2063\3042\307\323\271\267\300\266<\350H\301\365\265\302\271\325T\316\350\222\341|v\340\002\333Ja\343\351\005\346|6\217\274y\365\005\346\344\272\001\366\005\255\021c\013F\323\213\331\224\301tvm\335`6\275\276\230W\002\374\211\203\313\213\t\366|z1\223V \277\247\334=\214\307P\036 ;\372Fj\263\271\203E\250\023{\377\321U\177\265\305\330\253\275\267<;\317\363\034e\365W\373\304~5\017B\255\320O\313A1\320[\262\266\325f\220\244jgm\327Z\254v"
+	.ascii	"?fU\355\222G\274ic\024P\336Y\235\247\315\346\232\215Q\255\311"
+	.ascii	"}6\305+S\207\335`\213\271gi\255\275 *\007\t\262\300\320\261\220"
+	.ascii	"z\375G\005[\313\354\302N\260\0254\0214\rS`_\330\256\253\207:"
+	.ascii	"\0321\354\004\032\315\320T\355\225>\330\030\266{\310H\016\301"
+	.ascii	"~\260]O\013\035\330\b6\353(s\321S\264\224\003\006\366\337q\034"
+	.ascii	"\244^\033\354\370\255\300\376?G<\3230Q'\002{_\251\032\n\024\326"
+	.ascii	"j\372\211<DL.R\304\375\226\300~9W\352\340@'z\232~\311K\230\021"
+	.ascii	"\246=E\231\240.p\300\356\260u\336\021\335\004\372g\3200\f\330"
+	.ascii	"\337\367,\034up\320\315\343\322C\335\244\316R'F\211\202\246B"
+	.ascii	"\"+\221j%z\t\027\023\371\354\314\375\226jo?AE\263\007\232\271"
+	.ascii	"\2476\211\355.;\221\237\350\257\372\324t\207y\206=\265q4\016"
+	.ascii	"R\257Iv\207i\002\346\310)\202\264\331<\201\035\250Q(\006\221"
+	.ascii	"s\250FDD\222\024$\031\306\001\005\304(H)S\017\021\200\2613EE"
+	.ascii	"\322\2449\214V\204v\203\034\013n\036\252\251\212I\357\350\356"
+	.ascii	"&C\234\322\340\001\2207\330p\342\335\210\020\"D\300\306\210:"
+	.ascii	"\337\376\252G\2432[\024/\217\223\253>\t_\202O%\347\r=\366\266"
+	.ascii	"\340\2000j7i\013|X\321\027<\265t\346K\323\036\327\336pW\337\356"
+	.ascii	"\222~E\236Bp6\223B\225g!\371D\251g\tB\274I\342\347\361\274\254"
+	.ascii	"\305{\312_z\214\261\035\313\325*\275 \267\325b\340,8\250\265"
+	.ascii	"\3106\336\246-\027(\220T\354]\215\347p\370:\263\ns)\355\317\251"
+	.ascii	"'q)\342\335"
+	.string	"4o\342"
+	.string	"\r\245\272\t\0252\"\235\223\341jX6|p\344\205\314\371.^\332\241\342\354\366\234\002\246\242\361;{\274(\227\t\367X\253z\036\224\033\302+|\300\226Wv\235\023\274\221\266\271\320\245{\373\2062\345\363w'\357\253\b\274\300I\247\021\007vZ\016\331\365OP~\341\364T\332\347\217b\370\307\301\022\004\337\002\216X \nl0&#\357t\334\220?\034\212MC"
+	.string	"Dg\272\264R\200U(\200\210H\206@J\021\377]Tp\025\343\016pN\233\366A)\333R\017\233\263\005"
+	.string	"\302\f\324=\272\001\262\327\177!\305\256\352I\260\271\233\323\374\244a?>P\212\351-\203y\320\271<\357PI\224c8)\3424\277\210G\2252\3668\245\323\024@t\350d\007\322\206\306~\226\266g\022*\344\300\235\r\037|\362\310\202T\271\36468\261\007\343\271\241I\352\320~c2\203\361\030\260\266p\300\230\323*2o\210\230D\350\300 g\325\3170\334'\364,\341x\203\2044\307PWF\226\036\323s#\351pA\372s\325Stg<\320\237\330\277\353Qn"
+	.string	"\306\277J\372bY3\230\201}kc\032<j0\213[\032\005\367w}2\252^QD \233\240\304X\265\277l\225\3029`\233|\251VD\303\221\366Hu\357U\317\031F\210\243\312\013\270\233\303{#"
+	.ascii	"y\037\027\262q \364\323OM\310A\005"
+	.text
+	.section	.gnu.lto_resetAdjustmentStates.61.876db73bab0d63a3,"e",@progbits
+	.string	"(\265/\375`\005"
+	.string	"\025\007"
+	.string	"\302\r25Pm\222\016\303\200d\255b\364*\240ak\237E\177x[5x\3413\214\255\335\207cc\333\212i6 \1773cf\0061OQy\360\252\346\3175\272YBd\nW\027,\343h6\031\326Q8\310`\252+V\b\221\223\220\331\304\352\302\342\305\262\265\240\271bfYW\254pYJB\021\246\324\201\340\303\324\273\353 \024A\253Q\316#0\312\004u\273\033\345\350\334\213N3x^\267N\327Cu\372\006\207\327\355\027b\322A\300\317s\237\007)\276\224\204\242\207\226\023\021\215$S\242D\312n\372\300\370[Y\373\221r\243\254\007)\242\243$3#\254\250\326\247\335f4`\013}\372"
+	.string	"\f2\363\267\205&:\354?\360\027\374\026\001\b"
+	.ascii	"3\241[\037\230\b\314=\256\211d!\340\227!\300\245[\264\363\t"
+	.text
+	.section	.gnu.lto_updateAdjustmentStates.62.876db73bab0d63a3,"e",@progbits
+	.string	"(\265/\375`\276\0055!"
+	.string	"\026{\317I\220XN:C\357\220N\322\327\001Uo8\222'a\371\274w\034\035?\205"
+	.string	"rR\205\3703\006Kx\377\226\372u\363&\302\360\204\277y\203\030\001\263&#\210\021\301\332\305`\231F$B\026P\243\246\226'\326\b!\233\310\235d\263"
+	.string	"\257"
+	.string	"\306"
+	.string	"i\367T^\302\026l\367\016\177\316[\036\236\337\225'P\\\b\337-X\266u\357E\231/\306\367\342\017\031\275\375\327\301\322\207\361\331/\325\275\324\233p\212\355\336k\340\226}\316\333\236\347\224\267\344w\345mE9e\376\362a\216\313#\\\341#{\273\367\362\032\007\01389<\2375}\3564-\3315\345\233@]'m\254h\362\003>=G\222i/b\220\fz\3654\201nP\005o\302\270%\177\200H\231\325"
+	.string	"S\220(\221\243\326\215\276J\326"
+	.string	"}d\217\330\353\0240\252\366\207\277 \234\002S\203*\370j\002\335{\271\376\200Tg\2323s\017f.b\2664\002\215@\007\330\221\224\250\321ro\324\177\314C?B\364]\2221\037V^\367F%\270=\221\371\303\215\030\365\016\230(=\026^\367^\005En\346\201\317\343\226\217B\324\377n\371H\345\355\373b\017\262!\265\366\253\202\252g\032\355\336\247\356,\346a\257\276\247\261\230me\036[y\307V\3269+\347\234\225q\312\312\273\256|c\363\342Y\367\2603ZV\246\261\225s\266\362YV6\313\312\245\255l\315\312dY\271m\345JV>\001"
+	.string	"7\212"
+	.string	"/\325\344^\027g\340.\232U\322\343\305?\354\225\371\374\261\033O\234\b/\b\026\207\220\275,}\321Iw\003gs\235-\355\262D\267\265/9+ncf\214\031\321\256lg\361M\353\232\003q\313\215\234~\275\213\223\331kK"
+	.ascii	"\342\\\3220\001Zko[\256\346\340\306\007\020jPy{\323[4\260\254"
+	.ascii	"\276\300rM\323\367\022\341Y\204\002<a\271\222\353\037\035`\022"
+	.ascii	"nE\3509Wc^iU\316.\231\004\213c\25085\310\301\">e\302\317\242"
+	.ascii	"\\\n\005\262\202\205\362?\013\345\255\256I3\277*\237\227mv\001"
+	.ascii	"2\025V\275z\206m\227}\f\207\"\364\001\302\261\255'Nl\177\310"
+	.ascii	"\203\252\202E.\260\223\235\305#J\262\227\210jQ\225\f\343\324"
+	.ascii	"w7s\006\r\365?\262{R\364\023\327\356\276\027_\034o8\023!\364"
+	.ascii	"j\211\222\032\374\301\303Q\207$\245\007:\023FEIG\226\211|\230"
+	.ascii	"\232\222\214\220\232\230H\200(\032\022\"Z\342\021u\340%\035\r"
+	.ascii	"!\361\210\226\230x>\005XI\204\321\022\257IIi\211\207\016\241"
+	.ascii	"\336X]\277T\332\0174\250\356\345:\213\321\035\246M\267Z5p\264"
+	.ascii	"\247\370\254D\373q'\357\275\367<p\264m\372\303[\037A2b\226\262"
+	.ascii	"j\362t\334\177avZ\247y\372\306\347|\301\234\336i\256\2768\250"
+	.ascii	"2\207K\273\370<8\025\246Z\251Vy\253\323\271 N\347\364}2v\215"
+	.string	"\323m\346\213\243\351\003\337\365_\204\035Q\001\327K\203\224?\376\226\006\261\304\343\333\321-\327;\276\265\351\272\315\311\022\217[b\302\230K\216\\3\002j\250ALd\fT\312\224\210L\322\2444\035p\002\241\232#z\021\220\26534$\n\264\305\372\033Z\305\fz\025\366\274\217\240\225x\037C*q+\310sI\3018\342)\221\251\263\017\314\202\216\332\263D\346as\177W\246\234\343\2273\207\237\343\030\220\022\221\212iq>Q\030\f\323\r\327\276x\300f\3001\365s\277\235\3258\371Y\316[1\034\003\207\201@|6\216\366$\277\tX\332\344S,\326z\317\243\377?\221\003\316C\214K\224\331\310\251\332\344wn\330\t\036\177\300\327\020!v!\356\177\247\027&\"\214\016M\216A\201\204\nx^\325J\n\275:\375\016\365GQ\315\305\212\236c;\027W\206\303\351\\\340\216Bb\250\213\376\225\323\342\017\332<G="
+	.ascii	"\364\324\254U\251\303P\002\213+\206zn3TQ\211\251\356i"
+	.text
+	.section	.gnu.lto_useAdjustmentConfig.63.876db73bab0d63a3,"e",@progbits
+	.string	"(\265/\375`*"
+	.string	"}\b"
+	.string	"F\220=;@\3056\035\340\245\373\273}\020\034\021v\017\203n\302H\306\347\002\001\307"
+	.string	"\370\325T\355k\366fJ\251\214\216\316\375\235\270&\272DA^\004>c\223l\036\b{\221\006m\262wJ\001)"
+	.string	"-"
+	.string	"+"
+	.string	"\247\006m\226\217\034\213\3601\262(\001\260\273u\226\016^\202\376O\027\b\305\320e@\303\356Z\206b\306=o[\3016\203mS\246_V\003\245\025\361\027-\273\030\251"
+	.string	"\213\242(\036\027\333\227\366C.\002\336\004z\301.)\345dw\\0v\235z\374\201uz\335\300\n\223\344K\345\204\022\315\n\313\351\217\234\004\344w\230\342#\037\236\372\037\353\024\243a\0022\022\311\224=\206\344\334\260_\355\356z\222\354\007\232\367\3009h\022\333\206\3530\232\315C\340\f\363\276\216\306\371\274\211\bM\006\"\353j\266\251\235-\303\251Y\347U,\301\234G\353\352\307q]\275\214\373j\003\b"
+	.ascii	"2\241\205/\260q\241\034\f\271\004\333\254\246\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_blackboxLogInflightAdjustmentEvent.part.0.78.876db73bab0d63a3,"e",@progbits
+	.string	"(\265/\375`\020\002\025\022"
+	.string	"\026\341uH\320Tm:\250jC\312!\022r\251\315\236\022\032`ObX\323\210\201\255m\324^\313\203\034+)\006\030\004z\337J\b\350\346\003;f\201[$\3370(\036Q\315\205\304\322\356\036n\250E\311T\234K\254\321o\255\355\235R["
+	.string	"d"
+	.string	"c"
+	.string	"\224\276T\225\373r\231R\3732>cu\032\035\262\001[s#\"\266[*\270\346\323v\r\345'\244k\331\013\220\256\331\207a[\345\362\312\026\3622g\033\024\371`\026\355.w\255\272\370\352\225f+\377\346IZ/\326k\311\253\304\251\311\263\222\312\356z3qk\267\275\300\266h\323\n\001 l\262\036\241X\214\242\255)S\274\343\261\030\213\006\312\034\022%'\202x\350Q\264[r\327\\n\324\276\217\3430\377\264\tH\365\037\322(5\345\262\\\276\317s\254\376Cn,\027\205\233\020D\273\256\224k\2260\004\300\2149\314\365ecgwM\3247U\266\311\344J\337\303#\343\312#\343\023\333\335\007\3335\007\255"
+	.string	"\357H\266\367\321\267\334\242\0233\"\262\251,\373(\222}\341'*\b\266C\244V\333\345\247L\251\206i\224\202V\033\346gx\222\263\273\f\336\032\362J\353\317'\360a\322\374\270qd\206\036\321\212\343\232e[[\330\357\371k\211\232\276\374_\202"
+	.string	"\205"
+	.string	"\025\273#\216\214\354\n\215\307\213\003=HeQ\205&\306p\342\020\262\270x\335\013K7v\020F\360\333\360\221|\344K7!\346\00370D\215\036HF0\261w\022G\360\203\031E2CK\267\342\2458\317\002\007\242:\030\316K\211\334\351\200C\r_\212\033\3030\305\231l\323\373\033Lgh\246\322\270\326\212c\233\314vY88\320O\304C\217L\200^\307\317\225\013\001\t/ \260\002\031\245\325\001\244\202\237\314GH{kD\271\343\006J@\303\3108\240(<I\266\\\037\035\307Z\2065\321\030fz\215\275\032\371M\340u"
+	.string	"\267pE\300\367\024h\327\346}0\200\331p5Q\273\321>\006"
+	.ascii	"og[\364/\275\303\022\266\200-\234\3239\273\372\246%\263.\260"
+	.ascii	"\234\225-;\212\013\271Sj\372\t}\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.876db73bab0d63a3,"e",@progbits
+	.string	"(\265/\375`\265\002\005\017"
+	.string	"\246\326WB\340\226*\035P\200P\344\007\0311\315[M\035\037\314|\237Y<E0!\007dp\213\240\201wtb\2651\373\200\212\266\2400\306\030\343\231G~\277\213\334\306\302c\007\f+\352\326c\310\252h\023Id\nB"
+	.string	"F"
+	.string	"I"
+	.ascii	"\034\272\006\274\241\033\375\207\3505\006\237\013Rr\263\352\300"
+	.ascii	"\316\361%5\\\340\024\260\206\313\216\343\030%\304\031\272\375"
+	.ascii	"\025\326\037J\202\356C\376\277|\030C\250A\260q\374\374\343X\250"
+	.ascii	"\327\335\235\200\217\353\376/\215\027\222\342\317.\360w\240\370"
+	.ascii	"\264\023\037\210\005~\020\023\237"
+	.string	"G\211o\323\356\376\277\261\002\277\207\222:\371\027\205\314\004\223\374S\270N\230\020\321\002\341\372\320*A\272\302b\022N2\002w\350 \250\344_\017J\241\356v\300\001\313R\225\025\221\251l\274U)Nf\313d\021E\035\342\rQ\306T\331\324\027\241\n\024\240\013$\021\206\b?\320\212nf(\231\035\320\355L\003\023#*\201\0306&\327\005 j\200X\223)\327eit\025F\346\273\342\337T\034W\230n\222\356\327g\300\212\004\354\210P9,CFO\356W\343\310\375@\375\214\020Y\241r=t\344\212<r\013\254\350gGr7\215\267\230\251\243\026O\240\334\333K\250\036\032\022\225{\2535}\316\306\330\202\300\013< \320\002!*\233\003\233\247rMU`\222\n\017\370\306)L.\300\342\233\302(c\007\334\005\347\013n#\303&\203\334\026\034$\270\004\377\021\354\b\013\ne\322\336\311\365\032O\314\301\2513\220"
+	.ascii	"\222 \t\222@\002$\003\222?\320R\226\352_0(C\232\3540\020\220"
+	.ascii	"\r\002\315#\311\016g\002\354\022.0\013\nG\036c\271\201E\033\224"
+	.ascii	"\033~\304\206\226$V\300 8[\030\304vw\271u\362"
+	.text
+	.section	.gnu.lto_.refs.876db73bab0d63a3,"e",@progbits
+	.string	"(\265/\375`9"
+	.string	"=\006"
+	.string	"R\216),`m\322\032\300\366^W7W:\363+B(\232\242\026UQ\n"
+	.string	""
+	.string	""
+	.string	""
+	.ascii	"\240'z\366M/\225m\212\335\255\267\255m\333b$R\2467\267Ns-\262"
+	.ascii	"\214\355(\313Qo\222\325$\233Iv\245-\353\312\232\202\271i}k[w"
+	.ascii	"\271\264t\026[C\331!u\214\311+*'D\203\324\007\311~\2245P{(\023"
+	.ascii	"L\356\2449\312\n\2501\311R\322Q\032\260\331\2713\321\352\002"
+	.ascii	"Dm\004\344\203c#\303\202bB\"\002\342\301\241\201\341\266\205"
+	.ascii	"hS(!\021\t\361\210\336\021\272_\334\b\367\347.\270\007\356u\315"
+	.ascii	"\263\201\002\025\004\001@\300\001\006D\253\003\f\b8\300\200\200"
+	.ascii	"\003\f\b\270\300\001\003\002\016\260\026(\0242"
+	.text
+	.section	.gnu.lto_.decls.876db73bab0d63a3,"e",@progbits
+	.string	"(\265/\375`S>\275\r\001Z\242\261\\W \fY:\215\001\356\357\024\354Z\347\260u\372\224\355\236\316\344\374\024\226\312\337\210\356\247\215\223\361\362\020f\252>\034\021\335\240\230\177\267\205\206"
+	.ascii	"\346\365o\0334\201_\300\361]6\007\276\315\256W\211NOA\264\004"
+	.ascii	"w\341\330=\0372\noC\331WiM\266\275\345\2262\005\020\005\312\005"
+	.ascii	"\373\005x\352E\225\346\214+#W\216\213\306\230\017\033J 5\260"
+	.ascii	"\266v`\375\250RREi\302Y\035i\2429\251a\026tt5e<Q\322\030S&\231"
+	.ascii	"\3157<\004\207\235K%\005\212d|\3417\374\204]\234I\240t\224\""
+	.ascii	"+h<x\340*\033\267N\207\350\3026*r\242\324\022\003\312\305\362"
+	.ascii	"\206\263\256\330\271T\372\232\\m5\361\2147\\\343\326\235\313"
+	.ascii	"2}\244D\254\351\343\201\315\230"
+	.string	"\213)3\b\344\353#\215\356\2623\3728\f\013\301J\360U]\221\031\316`5D\274H\361\302\371\276:\375\020D\232\224Hp\022|\3442\361\022\177\375\032qR.q\221\215\244K\200\217e\0322w5p9\266\214\321\371\276*\372>3}\037\231\276\017\212\306]\037\216\275n\214\\\210m\341\\\343D\337\346\355I3\360\035\321\367\371\320\367Y\351\373\236\364S=\375\364M?\265\242\237\212\351\247B\364\323\034\372q\351\224~\212\324\032\334\241q\372\250\231>\372\245\217f\351\243S\372h\221~&\243_\226\335\364\363\231\006!{\351\347-\375l\245\237\233\364O<=\302\355Iq\213\033-O\334\234p\376\t\2471\024\216\272L,\365\f\226\\\346\234D/\260\220qHw8\244?\251\350\237M\364\227\227'\305J'\023\267\267.\270\355\245\371\343%\314\002#\341$|t\231X\t\257`\026eQ\266\021]\261\313F\345"
+	.string	"\"Z\232X\t\033a\031\303J\030\231A\334\214\252.\237\002hIK\303\311?_\350\237N\372\347\221>F\243\217\355\364\361\234\376\357^\232KfG\213;\234\365|v\264\b)C\252\351\203"
+	.ascii	"\303T\266\305\215)\335\356\333e\243\312D\2404\261\\\273+\346"
+	.ascii	"\326]6\035$|\2215\341\376\017v\267\313}#z\242\334{\343\3352\367"
+	.ascii	"\314\275\273y\327\314%s\321\\\346\265\273a~\345\356\334\261\026"
+	.ascii	"/bJ4\266+\246s\356]\025E\031\302\356~\271b\fp\322B\355n\357\245"
+	.ascii	"\0079M\226bde\310\267y\351.\263\203;\3467\313\325r\224h\271\227"
+	.ascii	"XK\317\211\022\234\217y\350\337\016\322so\357v\220\036\327\320"
+	.ascii	"w\337\236\364\002N\322\307H\375{\247\177\345\364\357\233\376"
+	.ascii	"\315\242A\270o\377\335r\333\256\230\b*`[\210\301\004\347\233"
+	.ascii	"\345\303/\027\236\024\212j\271\231gY\032\01348\377V\321>\267"
+	.ascii	"'=o\024}\341\366\244\270y\005\314W$\355\212y\327\256\232\212"
+	.ascii	"\032x{8\377R\271Vn\332e^\265+\345w\312E{^\356m4\006\345d:F\313"
+	.ascii	"\315#u\313\333\277G\220\\0\035\344r?\245WzKTw\367+\204\020W\355"
+	.ascii	"\206]1\035\344\205]\344\206F\271\367\362 \376\017\277j7\312="
+	.ascii	";\223@m\243+3\b\200\301)\321\335\355\275}<\360\300\003\017\316"
+	.ascii	"9.\272%\233|\266\333\223\342\264\372\222\335\262\313<\3325\373"
+	.ascii	"}r\307^c\264\334a{\357\235\233E\005\231\205\363\207:\205\357"
+	.ascii	"\036-}P\237\003:_\236T\203\333\223\336%\227\311e"
+	.string	"bp\235\234H\260\235\2344^i\362p\376\t\372\267\311\203D;\304\t\240\1771H\357\336\305 }\006}\301\360Mr\225\374\202\335\345C\bq\034\243\375\265\367\362\202\345\275\211\356\335@\347\336\rP\264\036DJ\322|\034\315\274=\351\177\215\374\267\310\375\302\340DbJn\346\336K\f;\313\027M8p\376\362\366\244\372\362$O*G\373\237v\341\307<\377\251\223\341\317\027x\376s>\245\234\276\037\373\364\177\246?.\361c\023?F;\321\363\374\261\336\214\037\217\231\271\357\317\"\224\371o\335\217)@\006\373\250C\300\030L\367\337\264\0377\177,B\314\177_\374\027\206\212\023\227\004\377E\261\302\177K\360\343\rs\230K\356\307^a\n\360\337\347\307_\336A\334\217\335~\334v\022\376\214\"\013km\301\340\317\305\377\242\360_\340\177!\360_\022\376\373\200\377F\340\277\031\370\257\210\343\375\330\002l\377\353\376\333\375x"
+	.ascii	"X\313\177\365\217\263`\371\177\346?\027\026\256\374\202\037s"
+	.ascii	"\360\343\265s\3703\b\376\273\342\277I\377U\372\357\322\177\231"
+	.ascii	"\376[\364_\375\347\"?n\3721\324\217\237~\314\364c\245\037;\375"
+	.ascii	"X\n\355\307(~\234\364\343\243\3779?\332\301\217\247\374\370\311"
+	.string	"\217\211\3748\310\217\177\374\230\307\217\263~\214\365\343\253\037\337\370q\214\037\303\370\361\324\217[\374X\370\343\020\374\370\204\037_\340\307\025\370\261\t?&\341\307\020\370q\003~\254\200\037\207\360c\020~\334\341\307\004\370o\320\217/\370\257\367c\013~\254\341\177\222\037c\370o\366\337\311\177\024~\254\363\343\233\377\232\371o\225\377R\371o\214\377R\375\327\351\277M\3775\301\177\327\377\216\340\2777\377\323\230\370\257\366\377\353\377\002\376\257\375\267\331\333\333\333\3733\327\237\263\363#`\007>p\316:\256\230\r\231\215\035\344hy\312\254\b\026\234\237\201J's\216d\306\221\356}\227\311'\250\\\225m<\337x\276\221qh\344\336-XQA]=\343\370\034\316\276\300\227\326,\322\004\347l\225\237r\310,y*s\317\376\327\244^\270n\034\225\321\3070\246\177\374\247\233\bj\357-\205.7T\021\316/z/\207?\347\236W"
+	.ascii	"{\377\027\220\300\336FT\342\310h dD34\330G\331\3666\262B\222"
+	.ascii	"`\025ed\005\003)\314j#\215\266\220\030\240\266\025\022)lo\f\333"
+	.ascii	"\310\biBrc@\n\333Q{E[\324\335K+\3446Jn\f\333h\023i\200dd\025"
+	.ascii	"\205\024F\024\205\001)\314*j\207Y\355\013\333\210\b*\311hCa\330"
+	.ascii	"aVt;,\031u\001),\031\205\024f%v\325\224\264\322\\\244\305e\361"
+	.ascii	"\270[\220\214\266S\023\r\"\250\013lH\313\344\216\333\3732Yl("
+	.ascii	"\001\354M#\t\025G\004\343\226\025\2619\025=!J\336eS\321Ur\033"
+	.ascii	"\261!q%\367\346*\n\332M\t@.\331v\326eC\342\240\261\231X\354m"
+	.ascii	"A\323\336\310\273\331\366\336\310\275\267\017\212\306ro\031\027"
+	.ascii	"\220\224MM{S\3714m\032H3\026{c\346\227\262(\244\260\253\344\007"
+	.ascii	"3&a\312}\264D^\345\216\263\202\322a\310$\233\251N+\243Z\214\301"
+	.ascii	"9\323\360}\351q\203\016\347c\230zq\231\371E\226Q\203\264w\013"
+	.ascii	"\016y?\260\324\3566\024\324\007\31722\025N\203S3\346\203\311"
+	.ascii	"\027\316w\313\207\347\030\016\320\302A\004\347t\263]\3402\225"
+	.ascii	"]\334Ai\212\313-P1=-1K\255\267\244\252\3029*C\331\274(*\332>"
+	.ascii	"\262S\346\261E\013\036\215\334\304\224\227b$M\331\302Y);\251"
+	.ascii	"atAI?Dfq\342e\344\271T\352\245\242\252&\b<\246F.:\312+\262QN"
+	.ascii	"\312H\227\231Yd\242\337\363nGfq\303BD\355\220\352\302Y\002fE"
+	.ascii	"\r\234\374\2353\372;qy/_\200\321\275\300\371;Vt\232S\3572\317"
+	.ascii	"\2753o\211\206\f\304\336yf\001[\362\322t\355\275\364\361\300"
+	.ascii	"\003TIW\213\2754\177g\210\376\216\016\375\235*\375\035*"
+	.ascii	"\375\035\"\273\271\033\250\2444C\276\210\301q\2512\006\367F\326"
+	.ascii	"\005J\334\223\346\334\271v\266q\2515C\2145O\271\263\314Yw\222"
+	.ascii	"9\307\234t\247\230\323\314e\236s'\230\237a.\226\337s\356t\363"
+	.ascii	"iE\331q\235j.\224\354i\310::k\372:c\372:^\372:[\372:U\372:H\372"
+	.ascii	"9g\364s\334\364s\246\350\237m\377\251v\341\316-)\222\221\025"
+	.ascii	"\027\316\247\226\223\355\347\2263\313>\267$ \2717\321\271e\007"
+	.ascii	"\315\336D;\367np\357\006\231\310U\013bi~\016\231>\257|\370\211"
+	.ascii	"%.\312l\ng\024\211N\255\254\310I\266\f1\252\302\005\f\217\262"
+	.ascii	"\257\034+\236\224\037\316\263\323G\232f\325[\225rO\t\"I#\311"
+	.ascii	"\031\345|r\242\235c\247\224\023\312\311\344\f;\313N*\247\331"
+	.ascii	"y\344\\\236d'\363tr\202\235S\316\264\263\311)v*9\221\234K.\363"
+	.ascii	"<;\213\374\374:\215L\261\340\324\304Au\307v,a\321X\222u#\307"
+	.ascii	"\f\254\032:\2326j(\271\362\264\3608\267\336\222\332\264\224\224"
+	.ascii	"\347\017 V2\224\347\3319\344$r.\2255GWwh\347\331y\265$F\363H"
+	.ascii	"\2203-\234[H3\336v\234:\262\336\230\224B\360\316\263\023k\003"
+	.ascii	"f`\204t\371\360\274\252\246\022\220\361\001\222\372'\021\246"
+	.ascii	"\017\310\236\323\030\234\317\256\017?\2752\200\202f\206\263/"
+	.ascii	"G\206~\016\222>\216\031}\0340\3728k\372Up\314\364q\274\364q\250"
+	.ascii	"\364\331#\277\300\222c\013\347\343@\351\337\330\351\337\274\351"
+	.ascii	"\3378\321\277\371\322\034n|\350\337\344\320\277\261\241\177\363"
+	.ascii	"B\377\246I\337FO\337\346M\337\006\212\276\r\021}\233\033\372"
+	.ascii	"6S\3726I\3725x2:\320FR\306\276b\234T\313\244\227\036\316?\251"
+	.ascii	"\376S\352lq\302\270\311\273b\256\351\f\316\247\213s\35227\234"
+	.ascii	"/\306\350(\212\242\323"
+	.string	"&\330\373nH\357\336\336\335\220\342\344\355I9\270<\351\t\365\341g\224N\224\327\0221\2341\234O\033|C\314l\260p:\235MC\313\262(8\213Y.)\035\221\201\363A\3340\246$\214lj&\235\373D\032S\342\244t.\235L\227y&a9\033!\310$-\235\2176\350\263\242\245/l\032\271\247<\215N\026\227y\2568\211\036B\210}\2568\213\220\232\033<\270uA\356\306\244\3715e\3725F\364k\272\364k\200\354\245yb\226\204\263\036Vc\376\200\202\363kn\350\203\300\303f\360]\023%H\232x8\f\246\033\201\005T\315\223\333\221&\b\214\207\307(\300l\207T\027\032\234\207\317\\&\306\303u\307dp\231\373`'/nH\2359`\273\032\270\272\032\314;}=\247\257\217\276\242\257\237\3205u\332\320\240\344p\026\263\314bFS\300xi&\236\303r_\356\275q\3144\233\374`A_\333"
+	.string	"\363\005G\t\224\2723\234\275\324\230\241\243+\202s\\\232$\314\226\021\234\257\245\364\361T\013YJ8\245\216,x\n\216\202\261`-8\r\217\3413l\206\235\340'\270\f\267a4|\005o\301nX\n\026\303\\0\024\314\206\253\340.\030\016\253a*\330\n^\303d\227\211\337\360\222c&\270\3113\336\241\325#\207\227r\306\r$\315\0318\276\224X=\264`\2205\2610\327\232\0015\354\310\240?p\025\2313wu[Y\216\230a\341\345\027\325\220\245\026\360rySV\345\304E3\207\235,x\341M\211\221\221\234j\036\231\013\022\2011L9\344P\"kdA\206\340\214\202A\277\240a\216\2029\221K\024\314\016\032\f\344I\2134\351\333\033\032\347"
+	.ascii	"\257\026[R]\216\306\3353l\344\204\312\t\316(\034\276\253q\223"
+	.ascii	"\361\245\013\276K\263<\2419SD/\3034P\rq\302Y'\025\302\343\310"
+	.ascii	"\254\r\345\261\265<[\201n\031s\022C\307\025\316\031\007\033\222"
+	.ascii	"\0256\234\227_8OOZ\311,\271\006^R\236\022\026\254;\265\267$\234"
+	.ascii	"Q*(\025t\355BA\035\300\314M\013\352nS\271\340\360\243jG\327\320"
+	.ascii	"X\204!\323\2063j\345hyN\220p\301\031\255r4\337Z\226+\033\033"
+	.ascii	"^\244\345)VLb\240p\216\022\005\235\202\204./\215\235RW\023\225"
+	.ascii	"rt\212\316\234\013;*\234\321\263+\226~mq\031b\266\363\264\307"
+	.ascii	"pA\315\3202\255 \312d\3365i\364\252\222P\2623\357j"
+	.string	"\206\231\rH_G\227_\350\223\023\016g#\301\366\223\217l\r\353\354n#Qq\270I\262\224dK\223\243O\216\216\205\020\342r\272K\b\034\021\316\250\330Q'TX\316\2328\037e\242N\200\344\b\033\342E\037\001\032\354ET\024\316(\223\313\235K\216\211\016gt\311\321\250\272\334a\205\235Y\256\334\212pF\223\240`\227\3715T\311u\316\216\234\254\265\351\237\340~-E\217\034E\362\327\324\234U\345\260R\323?j\344\257\361\211\301\315P\242\351\373D\0312\004%\2226\221r\225\206u\306\310\027\"\250\027^\214\244\036F\273\2049\232L\331\241\357s\305\305\205\006\321\200%\t\030!\031/HS\225 \027\314\007\220+\246\247\255-\364\307\005\333O>R\222i\310\334\345%zU\210P\037G\177\324\364(s\267\003U\336d\221!\025\207*\321\026\320\270)\247\255\021rF\250\340|\037\244\226\026\312\303'\211\244\343"
+	.ascii	"\310\r;.$dpI\224\307\215\227\250.#Z\262\262P\254\013\226\201"
+	.ascii	"\226\026jd`R\312\230\344\310\201b\371$O1Ry_];7\266\024<\026\216"
+	.ascii	"b\0259[\302\250\340\305\325U\036\363I\236]\254\354\322t\351\244"
+	.ascii	"3/fs\3723>\003\275\341\223<\303\210\341p\363\002\r\021,h\362"
+	.ascii	"\350\215\264\345\336\2013j#K\341xAM\211\241U;i\244\334\360B\253"
+	.ascii	"\320\032:iUpV\320\032(\215\rYn\306\r$V\364)`\306\270L4\006\276"
+	.ascii	"#\201\271\211\2428P!\252\253\302\320\203m\b\f\030(\214\013\226"
+	.ascii	"5\230m\250*\037|(\203B\302\371\024\024M\241S\027\366\276z*\333"
+	.ascii	"\231:\262\221\024\007\367\\w\231\031\016mq\"Qm)\005\310\265\321"
+	.ascii	"\370 \247I\230$R8\243R\276\245\030c\3145\375\373e&\337\3055\361"
+	.ascii	"\262\335\027\232\234F\310\225&\272Q\244\313Fua\033E\t\303\224"
+	.ascii	"\317d;\035$\206\275qdQ:\241Q(\024\332\204.\241O\227\2112\345"
+	.ascii	"\275g2\271\314}P\246\234w\003W\246\0056\235\234\315\\\356\202"
+	.ascii	"\"\244\n\034\371\322D\221P$zt\331\250\240\374\230\253JB\225."
+	.ascii	"\023E\272\317\206\234</wG\322\374\243G(\2132\245\031G8\243+n"
+	.ascii	"\330\332\022\216\"\372G\213.\0235\3329\372\241\267\2053Jt\271"
+	.ascii	"\234\204TZ\352\351\322\357\371\241\337\223Cg=\375\326\254\221"
+	.ascii	"\305\206~\317\f\375\236\027\372=N\372=Iw\331\016\rS#\223\305"
+	.ascii	"\016\273aa*\302\371=+4^\336\236\224\303\345I\263\230L\227\307"
+	.ascii	"\3745;D\312X\030\323\323\317\315\f\354\3202\206s\316r\317s\177"
+	.ascii	"\r^kA\331t\247\237\301\3440\177\215N\334\226\223$M\375\374el"
+	.ascii	"\217L\f\234\263\027\315BC[\00765\242\330\310^\376\034\207w\234"
+	.ascii	"[V\330\323\263\3039\347\362\244w\312\207\347.Y\322\232H\230Z"
+	.ascii	"\264d.f\322\0268Xr8I\271=s\361%ybrk\263\031\263\345\255K\333"
+	.ascii	"\026\233\026^\226\240\305\241Yy-\236\260\341%\247Z\217*u8_\003"
+	.ascii	"\227"
+	.string	"\376\365\2729\3552sZ\306\342\202\003/0\027\037\234M6B\302(\355\300\371\371\312\237\251\344*y-\347k*M\023\234\305\324\025\311J\342\234\255|xV\363\355\270aD\013g"
+	.ascii	"\\\236\024MN\3210\203\35423Y\236B\202\216\345F\332\310\265Q}"
+	.ascii	"\220\245\246\256"
+	.string	"\224\341\374<\345\317e\331,K\321\321\3721\207\243\004XF\304\340|\206\371\360|\246\367\366\244d\341\214\226\251\361\244\321P\240\3441\007\370HRf\026\232L\241\353\"&\226\307\364\336{\303\036\030\226\332\335\327\031\f\346\313<\217\265qm\211\2311\371ef&\231\231\221`\033y\003\306\314\216\353\356d\036\225\231\341\234\233\244YT\220\256\200\351\363l\201\37523X\016\273H\250\273\267\330[\217\346\r\224(U\300\340\234\225\270\341\355\320\272\322\347i\261\274\314\274<\251\220!\242\300\b\351\302A\262\320\343a\322\317_7\037a\346#W\314g#\307h0\004\354\212\245^^\271\310\003\240|in**\016ZJJ\206\r\"\317E\320\243\257'@2\017:\035KPn\\\\y\310\230\r\244\264\ty\036r\305l,\211k\3029\007\001#f\355\354\212\241Wf\302\220A\371\361\003\177\361Yn\251\0332\242\345\007\317"
+	.string	"\246dfe\256\221\211\300\266\024\033fF\325\335\336T\037\344P\361"
+	.string	"\003\302\003\353Xy\353\202\260\007\326\343y\013-g\271\304K\030\234sV\346q\323\254\322a\224yd-\032=\216X\350\335\2540\252\203\3039\357\270al\216h\265\020@\353\017\261(B\207\035\002Z\177\216\303\265\035\n\001\204Q(\210\006\265@!\017\304\242\220P1H\\\201l{$\026\2035\352q\315!\256l{\364\240\n\207\206A\342\352\201=\016y\240`8\034\"\022\213D_\373KQ\024\331\240\266H\364\375"
+	.string	"\325an\325\243\220*\224>\250\203\207#\253\236XY\241\005\355\357x\202>\256\303\341*\224\016\201D\240\325\004\020q=\261\252A\265\304qD\n\226\007h\375Y\211#\204\2531\247%\252,;$\242U\2016"
+	.string	"\362yP\007\017\305\325\250\252\021\020bY\325\250\252)T\360\240\016A\366\027\374\361\020\374\241"
+	.string	"\210\270\222\b\226hW\342za\350\247!\250\003\006P\030a\302C\253\002\261\300V\003\021*[\024\261#<\002=\300\256@\036\025\306\242\b\013Z\243\007 \243z\274!\376`\364\370\003\"\002\031Q\"\220\361TWX\217\371xTY\241\020\350Sa,\0063\333\032O\241J\004Z\207@\237P=\016e\365\350;\373\0032v\310Q\301\266\307\025H-\261\3418\304s\034\016\001\177T\241\217\n \313\226p\274@m\201B\343\020\005=-O\273\023dS\025\216\300\023x\216\301\022\307\243\032,\262F\rmP\035\252=6&z\214jkB\305\320h\004\362\b"
+	.string	"\204\016-\0134v\030\001T\304\200\001\036\\Y\225\250\002\351'@\004\004\2100B\n\337G`"
+	.string	"\b\f"
+	.string	"!\375\b\f\370\360\201\001\"|\320\027\341\303\331>xl'\240\243\3764\264;\355\006!Q\365\035\177%t\214jk\242e\201\355\261F\005\"\002Y4\305\020\260\347A\035\200\326\237\n\204\324\366\250\342\250\263SB\005b"
+	.string	"\032JA\025\332\034\203k{\\[`{\374\251p\004\266;&\216E\022\"\364\250\020,\016\203C\306`\216*\264\242\240\006\201,\005\200\210\253\020[\002Q\003\254\212\242h\244\200U\207CB5(x\324a\201A\301\314\252\353\317\332\022U\341\b!\013,\246\300zH\301\362\244`m\214@\241 \213\262\252p=Qd\215B5\005;\004\256\254z\304\220B\035\032\207L\370\031\002\203l\206\305`\261-\262\306\035\341Z\323\022\207\212\301\337\017\373[\215\307_\n\266\002U\270\262?\342\252A\373\363\001\001Q(\256?\240\241\241\321\007C\253\036U\266\330\016\001\177B\342\232\302\257\005\036\177BCl\253\202j<\002"
+	.string	"G\035\002\203G\233\226UO\020\327\337z<\2627AV\270\n\241\304UH\253\020T\203\202)\200Bz\3478\004\236\030\026\215\254\332\022G\004\331\n\216\252\312\002\251&\b\001E\2340\376dh\201'\3266X\202*,\236\300\256@\037\342\032T\217C\277\024\354M\360\227b\b\370K\001\024\332i\177\300\026h\302\205\343z,\222\b\n\266+\212\343\316\220Qm\217\031\330\002\205\271}P\t\355P\261\346\370S[`k\002C\nUH\0341T\211D`\220\210\024C\300\2356\230\2666\307\037\t\341j\304i\037\324A\270\032=\370\230p\217\277\021\204\2531%qG\\\341j<Q"
+	.string	"U\330\254\020\364\3731\016qV\b\322\371\371)\266C\301_P\260-\0223\260j;\\\177~\030Z\242\032dU\022$\214CB\342\352\201\nnP"
+	.string	"? 4dB\270\032u\210G\242j\024*\212\020\256$Z`\n'x\210\353\tm\t\302\325x\241\204\241zB\035\356\264A\365\347\207\347\327\262\2521\205\372k\207k\373#\026WX\331b\220\017\n\352\260m\213l\020\n\024\020W \005\330b\013d\325UCqm\201%R"
+	.string	"\207j\211\f\252\007L\b\261j+\344)\201\002\250\002\003\006\206j0X\202\216\020\350\202pX\f:\252lP\373k\325\243\217*\264\2666*\200CUx\243\016\201\210@\r?\036\365WB\204p5fP\301\252'tP"
+	.string	"U\374\332Uh\035\376\202\216@6\270\363\240\016\001\270`\364\251\301\365\204*L\203A\340O\310\026\203*k\243\n\213BY\250HT\205\277aQ\267\017\352\240\016\327\237\"k\374y\b\376p\320\376D\370\240[\342Z4\252"
+	.string	"T\331\024~@c\253s\374\001\255?\304\242\210a\221m\211\305 \317\b\302\365\0046\250\365\215\300\006\265Z5\252h\1776%\202\254\257hL!\201 \233\036\325\026\310\242&\214 \301\006\241@T!\254yP\207\343\217*\024\016\325\365\347\227\242\230\202\nA\3400\005\003\274hTY\017m\261\310z\2709\376J \256\277\226\250\236\220"
+	.string	"P\021\003m\020\320:\374\031@\373\013\001DK\\}(T\242V\207\206\300\016L"
+	.string	"\205J\314i\177#\264\304u\310\367\005,@\204\006\034\310"
+	.ascii	"\005t\260\303\361\027d=\004\177<\020W\240\220\207 {\364\320!"
+	.ascii	"\003bqm\203\304\241\t\264DU\250=\016\215@\b\3140,\026#\360C\201"
+	.ascii	"\200\303\t\264\300\342\360\247\346\177*u\343r-=\031I\243R(\247"
+	.ascii	"\271(`K\246\215]\f\263\266T\351J\251S\rro\233\027afT\245Ni\323"
+	.ascii	"Y\215\275\325\2242\221\350\262\342.\323\260Y\261\227G#]\302+"
+	.ascii	"R\251\"a,@\352?M\312X\220\370 \022\223\"Mia\305\305\013g\035"
+	.ascii	"\245R\027\214\224E\272b'\211\304\341\274\374B\356\330\302yo/"
+	.ascii	"-\272\033j\357\274\263\224\350i\321\\\220%[\023\234S\344\025"
+	.ascii	"\3432\242B\"\226B\251\361$\204\356\006\253H[\0269}\367;T\357"
+	.ascii	"\031\210\366.\332\273J\013\204!\310\035RxG\365P48\342\222^h\362"
+	.ascii	"\322\264&\311+J\313\0322\",\033\350\231Lt7\345M\353\212\335\023"
+	.ascii	"6${Yf\206\354\345\335xR&3\345\304\004\205\032\250\303\0224bL"
+	.ascii	"V\202\230b\016)#5\"\304I\007s\024@@hP.\231\016gM\037\023\200"
+	.ascii	"\221\210#\302\032\250\225B44J\nR\220\202Rv\306\274~"
+	.string	"\n\213\262\\\325\317\217=~\3468\210n\224\003\023\205g\025\036P\310\013\202]\005\317\352\377o\200\b\317\177_KH\250\377\315\037\200w\006\246\261\264v5\177\b\272N\302\325\021x\237\\\352\274\312`\233\305\024N\270\207\314\261\234l\305`K\377\363f#!\"h\370EA\350\355\346\274a\375\245F\f=\303q\r\217\017\030\376\364K\316\232\334\037\275\301sUIV\262U\201\0067\352\261\240\r\227\024\024\271\371\357\n|?!\361k\\/\324\231ik\257\257\267jn\023\270`\305\205I\215L\305^/N\221\334\013\216\353\322BS\217\277\353w\215\017Y+\321\335g&\004.n\310\335\300\245[\301\260~\236\237\005VK\367=. \301\341\023\272\347w\001\360\336\033"
+	.ascii	"\325\235b\271\261\271^w\fc\2242\005m\350\260\346\032W\203\252"
+	.ascii	"y\321J\2434^]G?\323\370\030\025\034\335\316D(C`\033\236\231\350"
+	.ascii	"=\n\033n\031\236J\nJ\314\354\022{\374\225\340,\357\302}8lq\251"
+	.ascii	"\353"
+	.string	"\364T\235)\330\324\250\030jou\221;\030\256&\300\263\244\274\n\242\215\016\353\200\274/04\036\270\346\373w\316\304\275\366\027\305\275k\247\004\247\200\005x\246\370\327V1I9^\257M\250Z\373x\332\2100\326\254\200^V`\007\340\200\b\232/,\257[\030\004\016x\252^\217\033\033\0036\030\263J\214\271@\007\016\275\324\036\375eZ\372\346X(Sd\244{\375\262a\370\354\372\312\244a;\243*\246\211\275\257\0336I\272\300\274b\rTU\2010\241V}i\277\001\313\304\251_\304\217u\377\005B\317 \262\372j\t\203P\216g\373\252gg\211\027%\001%k\345\001|$I\327\025_\032\b\361\317\031L\034\227\367\2445\245\b\251\0010\355\0324\376\231\254#\032\227\204\327\247\t\374E\324?\270\321.g(\023B\374\210YQ<w|)!d\244\2111! \n+\251H\0378nY\331\340_\217\230\211\223"
+	.ascii	"\025%"
+	.string	"\"\005\003\353$&t~5\377\225#o\314\341\3032\335\034^\227\324\276n\226\300TT\324\310\253\322\351\002!\013\3640\027\374\246\250g\334W\032\250\003,\321\317\205\310Z\244\370vy\207\035\352\313\241\273\264\213\"ld\021x\310\203\374YD#\214\247\030\302\352\366\332\222\345\241\255\203\354\212\001\017\245\306=\355a\340C\2145\324\3420\177\2744\0379\\j\211\207\352\355Q\341\316\310\245\264\270y\335\270\355\227\237\222\336\003C\230\002J\364\264\334z\337\241\004_\024\331\221\323<\024\0057\3679\024D\352\224+'}8f\253\n\231\363\241\237\244\2561\331\243\357Mi^\226\321I\316l\ru\375\265.\2755\t\303\243~(\276\035\300\216w\200e'\350\310\312\272Od\344+\264\224s|j\224x\214\277Tm\301\201\013\312\333\233\363(\306\274\255\\\252\374\364\345\222\333b\2753\036\375\306\306\363\246\265\017\036\032%C\373"
+	.string	"9\303&|@i\277n\203\275l\001\220\253\252\314S\262\tP\274\003\364\336\250\034\230\332\361R\362\r\1773[\025\204=G\264W\370L:\233X\355\377j\220\2155\215`\006)\251i\035\240l@\231\363\274\005\213$\024\261\177\355\250\031\023\302\340\224(;P\244\004\251"
+	.ascii	"_\255\2125\362\023\354\035\302e\t\336\253\270K\205;t\375\317"
+	.ascii	"]j\362\311\n!GN\\\256E\033V\230\350\026\233OmO'\242\204o\255"
+	.ascii	"\352"
+	.string	"\261K/\212?>\317\260\006i\245\205\212\236\236\306\377c\330\335m\032\3060\\\206\262\001\236\205\343b\0069/eQt\177a\2613B\331B\267\310\nh\302f\351-Z~\363\211\277X\035f\216\177&\266Q1\377\003g\304\227\037\b\367\006\243\234\204\023}Q\236\357\262\033\370\365\307\013\266\t\272\017\373~\303\323\315\370\220|=\302\262\211\264\362\261{\231\005\347\3256\260\242\313\352:\026\335\321\033\334\330\373\031\202?\022\316O?\205\006Zgey\217\331\007gj\202\016\371\"D\220\025\nQ\034\340\272\237\346\234\316\032\214\005N(\243u\226\264%\001\305\025\266\307\020\252\326\313\t$\264h\224:\345\377\270fC\244\376\213\320t{\274y\3072\032\212X\363X\203\253\336g\374u1L?\302\177t^\n\2067\375\244H2\005\260\r\327\024\204j\203\221\bk\316\230\312\302\005\207\021\346\305\241Z\335\205\220\212\325\274+\371"
+	.string	",7\314\210S\302\242\276\275\207,\345\260\023\212\237vl\312#\016\253\342J\230\342\334\007\305\230\266\312\253C\033`\177\210\360y@\271?\2753s\277\211\351\237$\204\204\376Z\001t\370i\352\016D\272T\215\026\350\367~\301I\001\252\020\253\204\271\313\231K\255\300\007\027dB\373\005\323M\217\3673f\265CD5\333\004\346\217\235\341\353\355\rS\312S\215_\214_!&\302\224\373\201m\027X\366X\352\225\245\027\032\024\202\267\341\013S\005\302]\013LTZ\307W{\325\013x\\\337*\313W\320C\003(\2644\332\026\210\023\354Q\303\201@x\b\201g\245\346\254k\206\303,\036F\253\365\367\021\316\220\005r\214\300\344\031\221\302\370}zJ\312\t\310U\020"
+	.string	"\002"
+	.ascii	"'N-\303\360.\225\022EX,S\tY\326,\211\\\317QtI\201\225\032\201"
+	.ascii	"\265\\c\323\323\222\276E\277\315wi\035'\263\013-\232\313\320"
+	.ascii	"\200\330\310L\211B\226\210\212\025\277#e+\027\216.@\347;2W\245"
+	.ascii	"\256\276\002\245\232\023\261P\222\252\257+H\003\366K:\324P\240"
+	.ascii	"\0215\007\r\344\030\013l\2558\3341\226)\233\240e2F\370\250@\270"
+	.ascii	"Sb\252\304\344\210\317\345\230\3514A\023\303\370\340\037\321"
+	.ascii	"\340\203I\257\030I\032\017\223C.q\332\021\203O\025\307\202$\331"
+	.ascii	"\364v \236\313t\225\360\026\036H\254_\210\352\007\223.\320_\341"
+	.ascii	"\2573O\203\236\305\325\277\245\322\301-\337OA\326c\235\211\032"
+	.ascii	"\032\310\032+\212J7\036\220\003"
+	.string	"\002B'\313\313B,y\037\312\002\356\323\373\222\002\241U\016\373\275\340.\\c\344\335\021\001\305\343\023\3167\fd\372\007\fa8\372\217\212\244\327a\261\322.\251\316\307\201\013\243\201 #\357zz\324\3168h.\bI\225\274\305\032\272\345ve\336_r\032\030\264\241\224\363>A\352\177;\366e\347n\371I\332\364\244O\347U\230\013\370\247\315\215w\353\267\333\203\331]~\267p\327u\367BM\262\220\203\371m\2410^\312\204\324\006\n\273\025\307\366\257\2044\255\325\333\350i\207\221[\001\365\264\275h\3505d\372p~O\206\344k\262\217\334\341\240\302\250\260t\215\240\035\330]\310\262d\217\273\200f\025\330\006\277=\337\276\226+\303\006u\310\224]\270\325;\275\005MP\327r3|\232\220hhg\251!\335\350\031\rRc\203\346D\245:B\241p\025\332X-\227\226\360Jrg\315\325\242\250\240\254\366R5\302\236"
+	.ascii	"\256\374\254\352\252q7V\361tz^\211\321Z5\315tV\004\201\267\226"
+	.ascii	"\270\212\325\226\025\206!\216F\356\311r\023\333#\337v\355?\316"
+	.ascii	"H+\004\3467GY\004I\201c*7)R\212~\305\002)x\306|A\304\353yj\341"
+	.ascii	"\217\330,T\240\031\362\367q\201\217\2666\346\245]X\341\021\353"
+	.ascii	"I\220?Ai\b2\246v\002\3213\223\301D\303\275$H\332\326\254Nj\t"
+	.ascii	" .\321\353\0074\236\222EW\223{]dI\245\034\313\2359\255\357\367"
+	.ascii	"K\265\303\f\342#\332\023\312"
+	.string	"\243u.\201\\\030\224\370\b\354^A}\375r\360\\J\373\204w\215L\335\303`K\016\005ph\023\237\330\310\007\263\322\177\320w/\273\201\211\203\277ze**rX6\362U\3207\212\212\317\244XS\220J\035\006\375\377\330j\370XT\232;\t\207\251\215tG\326\224\375#\354\255\3708yP\255\341\034\003\220;\355\216V\230\2216Jx\\\354\332\372bd\372\357\024\302\254N\221l\022Y6t\302)\3767C\313@\026\372Oy\2120\220\316l\377K)\316o\024\306\b1\251\350u\225R\370\375B`u+F\b\001z+\323r:SG\304My0\362\021v0cU2\246p\366`\241]\312\310\375\326\365\2115)z \027\346jx\0305B\244vI\357j\226\201\226\246\347\354\373\343\271\203\255s\315~a\237\340\261\026\314\017\023B\333\360\242\371kD\"\322\022RT\336V9\377c2cw\346"
+	.string	"&\031P#\301\212\0256\350\264^\376r\307Y\300\333k\361a\220n\370\221Vu\264\340o(\300ZpDI(\366\347/J\235\363n8e7\254\317\bO<E\377\315\267a\310L\253\245)\367b\227"
+	.string	"\302r\313\022Q\177& 2\005\353\353o\342\025\006\020)\226V\250Z\2235j\267|\233\263;\266V&\223\034\330q\211\346\036\005\246\372V[\321\364\035\253\207o@%,\361\366;\340\324:XP\364\223\241x\215\211\357\331\277v\2433vk&\336C\335~\352\326\025\027"
+	.ascii	"\206\3562\321)\n\353\357\264*>N\333\200\221.\240G\276@\276\361"
+	.ascii	"\321s\004e\t\353\337SCX\344\r\321\0339[n\007\027\036\023\345"
+	.ascii	"K^\023\335\343\312\215\316\354R\324\260\031s\362Dw\321\257Y\177"
+	.ascii	"U\333\232>\346\365\f\326\303\007\260\265<\017\237\234L\234\r"
+	.ascii	"5\322\365\213\r\017\2120%\216\206\230\253\222y\356?\314\376\336"
+	.ascii	"\311\\\026a\305\375\237\032\336\311\216\271;\363\333\266(\347"
+	.ascii	"\317g\233\373\362\310\350\2257\027\377\344-\275\216|\023\342"
+	.ascii	"\324\277\365\315\355E\370\271\260\231\276(_\223\002\357#'\023"
+	.ascii	"\230\237\236\236\036\214\306\305\025\355\350\223\362\025\271"
+	.ascii	"4\273#\316\223\340o\366\372zf\254\364\304\244\327\351\270'\037"
+	.ascii	";\221\031\376\312\276_\fo\334\231M\322\324\314\305\376\341\370"
+	.ascii	"Q\267\257T\340D\212\371\242#\314\213=\203nc\303u{\016\331.\001"
+	.text
+	.section	.gnu.lto_.symtab.876db73bab0d63a3,"e",@progbits
+	.string	"processRcAdjustments"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\002"
+	.string	""
+	.string	"resetAdjustmentStates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\002"
+	.string	""
+	.string	"updateAdjustmentStates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\002"
+	.string	""
+	.string	"adjustmentRanges_SystemArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"Z"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\002"
+	.string	""
+	.string	"useAdjustmentConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\002"
+	.string	""
+	.string	"adjustmentRanges_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\002"
+	.string	""
+	.string	"adjustmentRanges_CopyArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"Z"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\002"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\002"
+	.string	""
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\002"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\002"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\002"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\002"
+	.string	""
+	.string	"blackboxLogEvent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\002"
+	.string	""
+	.string	"initRcProcessing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\002"
+	.string	""
+	.string	"beeperConfirmationBeeps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\002"
+	.string	""
+	.string	"changeControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\002"
+	.string	""
+	.string	"getCurrentControlRateProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\002"
+	.string	""
+	.string	"pidInitConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\002"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\002"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\002"
+	.string	""
+	.string	"isRangeActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.876db73bab0d63a3,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1402 @@
+	.file	"rc_controls.c"
+	.section	.gnu.lto_.profile.1b5701b796f9c41d,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.1b5701b796f9c41d,"e",@progbits
+	.string	"(\265/\375`\252"
+	.string	"m\007"
+	.string	"\244\t\236\001"
+	.string	"\034"
+	.string	"\350\300\306\254\005\002\002"
+	.string	"\002"
+	.string	"\001\242\302\263\302\013\002\302\374\277\243\n\004\002\001\002\002\003\240\342\234\212\n\004\326\267\375\306\007\020\002\003\002\004\002\005\002\006\002\007\002\b\007\005\b\311\354\212\260\b\\\003\002\003\002\005"
+	.string	"\002"
+	.string	"\007\002\007\002\t\005\t\002\t\t\n\013\f\020\220\237\222\215\004\002\021\202\244\276x\004\002\n\002\n\022\023\267\321\221\322\005\024\207\307\324\375\006\025\026\253\262\211\366\t\027\236\321\306!\030\031\032\353\227\221\315\013\033\211\236\236\264\001\034\035\036\037 \240\342\234\212\n"
+	.string	"' \200\202R\332\r\210\364.\032[\226O\307\250FW\345\205\217a\263\256\325\354v\024\226>\201\224\246o\013\340\336\222\350qdA\002{\004\016\b\370\b\343"
+	.ascii	"}\002\037\3016\3409\200\316a\023\330_\243Zk\001\367\f\"\356\276"
+	.ascii	"YS\341.\344\242\270\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.1b5701b796f9c41d,"e",@progbits
+	.string	"(\265/\375 v\245\001"
+	.string	"\310j"
+	.string	"\006"
+	.string	""
+	.string	"\003\002\001\003\004"
+	.string	"\003\b"
+	.string	"\001"
+	.string	"\020\002"
+	.string	"\003\021\001"
+	.string	""
+	.string	""
+	.string	"\013"
+	.string	"6\005\0069\270\206\230\013]-"
+	.ascii	"0\354\272\233\333\261\022Df(\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.1b5701b796f9c41d,"e",@progbits
+	.string	"(\265/\375`\025\001\315\006"
+	.string	"\202\211\036)\200EI\007s\316\2601z\335pc\344\370P!l\244AX\3246\250V\3777\030\230!\2103M\317\177\321o\332\"[\312\024s\311\372\270\273\347C\317\312;'\263\334\235s\304\371\004\376\206EG\363T+\212\001A'}R=\270\b\f0`9\374!\373\033"
+	.ascii	"U\004\223\350\223a\220JA\006\361\372_\223E\366\027\312\271-*"
+	.ascii	"\271;\350^\251yE\333\247dww\353\233\373\004) \220\"Sf\035+\n"
+	.ascii	"\021\347\260\272\013\325\362\302\004\362\026\333\210\326LZ\315"
+	.ascii	"\267\336?9\355\302\335\273\346\b\245\340\223!v\200}\030\b\230"
+	.ascii	"@d\004\002\307\3159R\004\204\233^-\260\321\264\227\0075\302\b"
+	.ascii	"\302\006@\tg\254-Yb\344m\001\002tx\301\\o\360\255\331U\265\340"
+	.ascii	"\006"
+	.text
+	.section	.gnu.lto_.jmpfuncs.1b5701b796f9c41d,"e",@progbits
+	.string	"(\265/\375`\345"
+	.string	"\205\006"
+	.string	"\322\310\033$p\305I\007h\235\017\240\371\003"
+	.string	""
+	.string	"\251\314a\252\226n}\b\252\252\006b\220\333\3507.\210\206\354 M&\031$?r[ 0e\202\262\346;\220\334:\316\t\362\211M\263\002zqmm\310\313\"\335\270%\245Pk\315\200\373\361\216\217\035\335G\327\311(i\370\303\355\234(\210\003P\203\332\322\253z^\325|\236\256%\027S\246|I\036\007\b+ \200\302e\325\001CI\005\270\233\223\001`\206\274{\233\337\245\230\005\335\216mj.\266O\374\b\322\226,@\373\3176\370>l\311\fy\205\226aJ\301/"
+	.ascii	"\"\203%y\256\375\242\037c\201\256\327\351`%\025\360\0162\241"
+	.ascii	"5:A\020X&\253%\3621CZ\na\035.\032\211\024\256PC"
+	.text
+	.section	.gnu.lto_.pureconst.1b5701b796f9c41d,"e",@progbits
+	.string	"(\265/\375 \027\271"
+	.string	""
+	.string	"\023"
+	.string	""
+	.string	""
+	.string	"\006"
+	.ascii	"\204\004\002\204\004\004\230\004\b\230\004\020\204\004\021\230"
+	.ascii	"\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.1b5701b796f9c41d,"e",@progbits
+	.string	"(\265/\375 \202\265\002"
+	.string	"d\003v"
+	.string	"\005"
+	.string	"\001\002\024\001\002\001\300\007\025"
+	.string	"\001\002\026\004\003\002\027\001"
+	.string	"\002\030"
+	.string	"\001\002\031\001"
+	.string	"\002\032"
+	.string	"\001\002\033\020\002\300\007\200\021"
+	.string	""
+	.string	"\002\002\023"
+	.string	"\001\002\023\001"
+	.string	"\r"
+	.ascii	"g0\007\301 XP9\\5\364\252&\244\004\001F\337<\202\331w\267\003"
+	.ascii	",\f\003,"
+	.text
+	.section	.gnu.lto_.lto.1b5701b796f9c41d,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_rcControlsConfig_Registry.79.1b5701b796f9c41d,"e",@progbits
+	.string	"(\265/\375 \226]\004"
+	.string	"\324\007`"
+	.string	""
+	.string	""
+	.string	"*"
+	.string	"\005\001\212\001\206\200\200\374\342\203\314\201\023\030\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\317\007us\345\006uq"
+	.string	"\005\001\006'\001\005\031?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\034./src/main/fc/rc_controls.c"
+	.string	"\004"
+	.ascii	")\302\303,\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_rcControlsConfig.81.1b5701b796f9c41d,"e",@progbits
+	.string	"(\265/\375 :\255\001"
+	.string	"\244\002-"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\177\001"
+	.string	"\005\001\006\035\001\001("
+	.string	"?\202\210\200(}{\276\001y\276\001w\275\001u\274\001s\273\001"
+	.string	"\003"
+	.ascii	"@D\312M\003(\002"
+	.text
+	.section	.gnu.lto_armingConfig_Registry.85.1b5701b796f9c41d,"e",@progbits
+	.string	"(\265/\375 \227e\004"
+	.string	"\344\007a"
+	.string	""
+	.string	""
+	.string	"*"
+	.string	"\005\001\212\001\206\200\200\374\342\203\325\301\027\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\347\006us\377\005uq"
+	.string	"\005\001\006'\001\002\220 ?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\034./src/main/fc/rc_controls.c"
+	.string	"\004"
+	.ascii	")\302\303,\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_armingConfig.87.1b5701b796f9c41d,"e",@progbits
+	.string	"(\265/\375 %\025\001"
+	.string	"\320\030"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\005"
+	.string	"?\202\210\200\020\177}\274\001{\273\001"
+	.string	"\002"
+	.ascii	")\242\f\240\b"
+	.text
+	.section	.gnu.lto_flight3DConfig_Registry.91.1b5701b796f9c41d,"e",@progbits
+	.string	"(\265/\375 \226]\004"
+	.string	"\324\007`"
+	.string	""
+	.string	""
+	.string	"*"
+	.string	"\005\001\212\001\206\200\200\374\342\303\334\241\035\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\375\006us\324\006uq"
+	.string	"\005\001\006'\001\n\032?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\034./src/main/fc/rc_controls.c"
+	.string	"\004"
+	.ascii	")\302\303,\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_flight3DConfig.93.1b5701b796f9c41d,"e",@progbits
+	.string	"(\265/\375 C\305\001"
+	.string	"\224\0026"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001'\0012\264\013\352\376\n?\202\210\200(\177}\277\001{\276\001y\275\001w\274\001u\273\001"
+	.string	"\005"
+	.ascii	"`\204\312a\320#ei\f\024\001"
+	.text
+	.section	.gnu.lto_isUsingSticksForArming.94.1b5701b796f9c41d,"e",@progbits
+	.string	"(\265/\375 \347u\006"
+	.string	"\022\f-3Pm\222\016$\243*\n\201\352\"yI\006"
+	.string	"\240[\250\360Z\376-\331U\373w;\354\354\316\301\234\300 vf\026QD\337\001\036\260\031<\253\265\366\311\226);\r\207\341Q\235\315s\007\216jN\241m\026\020\032\232\2438M\223\3719$P\255\363\036\3250W\226\221\220\005\204\030\304\367\243 \325\335\370\301\203\265:]\217\245\0232"
+	.string	"\212\020\226\376\002!\303\370V\222\221~\034\331\245\302$C\222)*\245d\3114\302\361\177\0363A\301\347\252\227\206\250\027\"\021!(\231Wc\031\255\212\325\255G+\035\026'\326\bT\274\030d\346h\215&:\353/\360\017\374\022\001\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_areSticksInApModePosition.95.1b5701b796f9c41d,"e",@progbits
+	.string	"(\265/\375`\257\001\265\017"
+	.string	"f_jE"
+	.string	"\257(\035\303\037\221@\020\325\271\273\233[\037~\255\037\222\030\373[)\343\177;\037n\206\315\036`M\343\327\253 \036\374#*y\016\205\257\377\377\267_\267#d\306\254\220|\302\244.\377n\332>!do)S\nW"
+	.string	"T"
+	.string	"T"
+	.string	"\025\034w5\254\250\331\375:,\342\0365N@{\314oh\217\266\235\340\343d\324\277\016\257o\230\261d9\273_\247\034\216z\204\232(\177\003i\240be\326\202\245\0361\034\202`)\251"
+	.ascii	"`+\030\332\335\303<]0\224\314\rdw\235-\330\205[\273m\007\266"
+	.ascii	"?\354\024\020\227\335\334_\376\r\246"
+	.string	"\265\307\356\250i\205\351\324\364A\233\210\027\bL\354\276vf\254\213h\023\342\262?\366\264/\023Zi\254+e\246\346\237\037c\220O\342%N\217y\306\245,\024\310\020cq\263\273\242G+\340\036C\360\033\366\311\006\331\326\264?\342.\247\277\004\003`<w7\245\332bMS\003|\210\265X\245\f_S\257r\263\351uE\306\322\211\252\251\001\034\225\034\233\343)<\373L\214\335]\340\2378\212\t>\210G\233N\362\255G\377D{\214\372\230\337\305\203\215*w\354/\225\332b\037\356\356ZYl\247?0\355\t\024F)\362\300\033\031\225\204l&y\230$x%\023\022\2174\"\225:\022\204\216$B\310HG*\231:\217\003\366JDJ\235\211\347\225:\320\267\207\253,N(z*\307U]\266?\032R)\212U?z\226\216*w\264\250-P\241\262x`\376\027\247\036e@\323q\032\317\022g\206\323\313<\036"
+	.ascii	"M\b=\f\022^\331\024\201\270\020\363\305\3355,\331B.\240\030\024"
+	.ascii	"\327\016\322@.\037\342\314*\302LdK\nB\340\340\207\325\205\310"
+	.ascii	"e\0340\b\200\2144\302\032\302\210\013W\325\215\365\2245Z\ryU"
+	.ascii	"\341j\336\333\256\242\007"
+	.text
+	.section	.gnu.lto_calculateThrottleStatus.96.1b5701b796f9c41d,"e",@progbits
+	.string	"(\265/\375`\262\003\325\027"
+	.string	"\306\352\226J\300\324Q\007h7\2604\267w@\034\266\211\006\316\f?\370, \001\365\017\216*A.u\335N\271y0\366\305\206PLyX\274\233\004\355\261\252ij\0328\n 4\232\353\325\261k\253\373\031\217_\352\266\367\336[J\231RJ\001\202"
+	.string	"t"
+	.string	"\211"
+	.string	"\247\221;U\201$\230Y\207\271\344N\321I:<\243\276\242\034\371\013\372,\r\271\327g\252\264\313v\245\335\262]?D\317\272$G1\264\225\276\317\270\311\334N\227\344(6\257\005\034\005i\360\260i\035\332\322\225\241\240P\337\b\342@]T\037r\224\271\036\257>\224\225\263Q\225{o\231\343\361\247+<\236\202\364\215\240\r\324\205\333\335\232\327\376\223\253\271\207,\367^\366[.C\363\252\231\271\211\231W\230\337D\236\3223\226\231\002\215\367\315\237\305\244\324EEx\300x\276`\373%\374p\330\274\b\223\256r\273\3062\307,x\337\372\233\327\r\304\304\233\262\375\016\263\257\346\257c\356?\317\363\344'bfgWuF\261\316\255\352|B\235M\252sIufUg\022\353\274\252\316\245u&\253\363H\235\305\352\034Zg[\235+u\246\357\374\356\354\356\334"
+	.string	"\302 T);\356\305\0052Z\242V\337NU=\362\313\004\035\003\212|\002U\342\217\300'\361\303\022@\210"
+	.string	"\303\327u\203\360\001\364\263\257\343\320\303/h?T\320/Z\\\264\323\002\006..\266\253}SD\217~\375\3669B\363\363\325-\032\210\367^\003\334M\315\302\301\203\227\227\257=~ \001i~\362\221\240PRm\030\373\357(\230!\364\n\030\361^[\001n\025\275\024\201{DW\216\221\251\3342\177\240\252G\363\223\241x'\212\350\353|\355/c\005\f{\341T\210\311rlb\260\030\230\314\204M0mhdjL\230\f\307|\005\340\330\315\214\314\314\211\305df\351\243\365\023\361\215\322\216\354\236\331\346\3658\305\033\262\3343\353\372\037fv=\263\320\276F\257\317"
+	.string	"\362\321#_\307(\177\362\030Z\217bC\252\365/\223?\251A\303\344+\225\020$\217\342\301\031\215%?>\353\350\027,\371\001:z\206j~\266\013\267\273\211\254\037\277w?\033$_>\353C\251\036\243\232\237\274z\022\004\035H\250Q8$\031b\250\2102\222\322\202\264\001\240\002\031\251\3329\020PU$SAZ\016\317aT\2524A\332\006\t\b\2443pM\360~\324}\036>\262Ry\212:\272M\034\253\231\236\232\333h0\372M\273\236\003f\303\311\323\035I\3302I_["
+	.ascii	"\307n$W\006\207We\222m\200\202\177\024\271\004\266|p\005JtM\033"
+	.ascii	"6\356\001A0j\316\351\003\224\360\036\317\007B\030 \255\347L\247"
+	.ascii	"\0215\333\213\337\242\210\255\\\366KE\030S1D\330\241\244\020"
+	.ascii	"\330\006N\371\026E\272\276\336\325"
+	.text
+	.section	.gnu.lto_processRcStickPositions.97.1b5701b796f9c41d,"e",@progbits
+	.string	"(\265/\375`\377\031\ro"
+	.string	"\332\254\324&K \216\352\031\003\267-\377\020\360n\322G\357\007\013^\340W\001"
+	.ascii	"\352\013\343D\300\250/\207\037\364X/E0\344\341_\231\n?<\201\300"
+	.ascii	"m\016\020\314\216\350y\314\370\310}\257\0370\002\351\213^\357"
+	.ascii	"\231\234=5\337\0277\221R\246\224Rf\002 \002l\002IgG:w\1775\347"
+	.ascii	"\322vPk\374\227\272\367\3065\206\267\332\372\035\351&\335v\335"
+	.ascii	"s\355z\353\254\277#\231;\257I\bB]u/\031\b{\322\250^\302}\307"
+	.ascii	"Kn&]\367l;\376KrI\223N\362\214(\276\357\033\"\331\255P\357\270"
+	.ascii	"\335\262\235\343v\353M\307K\206\222z\366\334\226\020W\335{\203"
+	.ascii	"\204\020\303\271\306\367\255c\352\226\231\222\335\362\2239\261"
+	.ascii	"\353\200\274\2357\026\315k|\337\267\371?\230m\266\2569\351\317"
+	.ascii	"\346'\354\204\3658\217\2330\036\337\261\035\327\231(\001\300"
+	.ascii	"\225\025\211*\252\021SR\"\242\240B\200h>951-)%!\035\031\025\021"
+	.ascii	"}\030\022\n\002\372\361\351\361\320\201\207\303\206\035\235\034"
+	.ascii	"\r\031pnlj\230K%M\022\351\266\354\373\223\233\253\371I\241\223"
+	.ascii	"\024\364\334\276\362R\004q\214\366\2315\261qc\254\306\264e<\276"
+	.ascii	"\263\343:\035\023\310\023a]\002\200\021t\326\240`\217\356\232"
+	.ascii	"\364\352:\266W>kP\261\030\334*G\031\022g\314xU\216/*k\243\217"
+	.ascii	"\030\323Sc\336\244\211.U(\202\354\204(\366\n\025\006\214\213"
+	.ascii	"#Etq\244b\330\020[\205 X*)o\037\362\355\352\326oRCo\036r\361"
+	.ascii	"'\303\250\023'\301n\022\324\342L\201\275\024\230\305\225\266"
+	.ascii	"\260\340I\035\244\200\204\345\210\rb\353a\355A\351\024V(\260"
+	.ascii	"\0325\222R\304.\245i1\353A)\037\273\323\305G\230~\223\3669\021"
+	.ascii	"\322\221\250\223\017CQZ\b\312\023\017\212\302\304\201\242,\361"
+	.ascii	"\237\2757)\235\373\320u\001?vD\373"
+	.string	"\314\326|L\273\307\203\222\356\220D\316y\224\3049\007%G|\003\013\025\205lJ\017J\347\330\032$\211oF|G\207\210\347\354\rq\rB<\303^\020\307\331\353\233A)\020V\350M\332\303m\336\244E\006\245i^\303\034Z+\343\321KvI\261J\231\036\224\362`wn\030\t\3537\251\016W\262Q4\032w\364\240t\007\3134\023m\241\351z\350MZ\202\323\260\314B\270\022zP\212\306F\241\361\025B=\211<qB\331\264\221g\355FY!\027#\373\3626G\2636d4X\241\367}\227d^\376}\327KB\024\347\254ke\323v\344\211\367}\331\303\310\312\232\rh\346v\213\231\017`\336i\n\337\206,H\255\212.b\022\267\345S\231\3714\217\344Z$\024\354\353u\371\314g\005\277\322<\230*\177\371<\177_I\200|\247\tp\231S\030\340\035\246|\232\252\265\315\353\2718\3714\235\245\003W|\200"
+	.string	"\002n\267I\243\305\026\344\246]:Z\026\305(\331\244\325\367\274X\317#\277\005\336!7`c\331\342&\302\035$\220\200\333-\222h\221\213u\332\345W\232\24722\013\262\275\222\215\177\211\316\324W/\306,\222\3047]'\031\377\2668\367\226k\365bW\337\314\241\004\017\214\227\233i\366}\3377y\3274D"
+	.string	"\247\270\r}f\333\252'\361b\314M}\365\355\365 \b\201\341+\r\352WG\326\365\217[\365\r}&B\367\251\334D"
+	.ascii	"\323\330\356z\021\376\036\253^\314\325\322\276\273@\373Ui\237"
+	.ascii	"\346M\320\272\244\253}\352\333?n\327G0\244/j\326|\205pS\366\251"
+	.ascii	"\314\276\277\026\336\026/7\303\377l\003=\305\201\344\373zMq\363"
+	.ascii	"\265\024\b$\230`\002\267\333\177\243\303%\375\376\035}\354\362"
+	.ascii	"\353WGY\221|\337\227\212\373IC\251\200\233H\267l\001\013\357"
+	.ascii	"\260n\271Y\270\335\366\267oZ\344\374\272\374\312\336\374\347"
+	.ascii	"Z}s}\3375\321\" \336\027\275G\250_\037\215\257\320\355\237\312"
+	.ascii	"\\\007\365g+\204C\243\302\317\306\334^\320\256\346\242q\336@"
+	.ascii	"\351\234\225tV@\351\254B\351\234\242\355\232\257\254H\364\\s"
+	.ascii	"\025\322\231j\351<b\351<\205t\226\242q\026\241t\216R:C)\235C"
+	.ascii	"(\235A(\235\233L\347'\246\263\023\323\271I\351\314d\343\274T"
+	.ascii	"\343\254\204tNb:#)\235\217\224\316FL\347\"\2443\021\322\371\303"
+	.ascii	"\322yh\351,\204t\016R:\0031\235\177\220\316>=\327\334\243t\366"
+	.ascii	"\240t\356\240t\346a:s`:oP:\3570\235u\230\3169Hg\rK\347\fKg\034"
+	.ascii	"\244\363\315\322\331&\351\\\223tf&\235\227Ige\322\231\006\351"
+	.ascii	"\234T:#\223\316.\215s\233tfi\234?MN\254\363\214\323\337\3041"
+	.ascii	"9\035\373z0\0278\025\226\232Nx\277\375\344\202>ix\2075\375\f"
+	.ascii	"k\325\252x\345L\315"
+	.string	"\374\004{\2121\373\316L\030\033\242\004\330[.\223\3031\375R\032\233[\213cK#\243r\260OG\222\335\230\025\306\220\222\334\245g\032\301\003#\324I\256\322/}\217ctZu\343I\346\035\246\364n\217\307\001bhw\004\325+\334\244\3775<A/73$\351K\034\372\220[\221=#\244\027 \b\022T\224\026j\024e%\007\217>\313\177\034}K((\307\347\347\343\007\321\007\033,CpS\376\220\224\351\022Jqh\364)|\030\275\t\036jit\323\2616\001G\237#\206\201\006\025\365(\372\242\303n\001\261D\201<\332D<\210\276%\323\267<\322V\343g\314\016\030\246v\370`\363\351\231r\241~\3468{\2425\033\231w*e\310\370\301I\030\372\017\377\370\3250\\\241\037\nz!\307\021\364H+M\254P~\323O\036=\236&\330H\253^\036t\366\034\273pJ\330\341\251fZ\205\265\201^\205\333"
+	.ascii	"\372\022g\214it\323\027\256\030\262\314\261\221\361\371\334\234"
+	.ascii	"\360\374|\233q\260\237/:l\344\224\320\006\0072\275\302\365\361"
+	.ascii	"/\237o\027\035\345l\334\364vl\340\322[n\317\007\235}i\"\345\220"
+	.ascii	"\311\316S\231}l\330\013<J\264\241\363\275\345z\370\24638\274"
+	.ascii	"-\036\234\253{\313\345y\017\217<V~\241\013X\016\207g\n\241rx"
+	.ascii	"\227\2077\342]\231\206\r\357\205MA\236C\274\3036|\313\251A\237"
+	.ascii	"\253\205\002h\315\360T\376q;\320\254\341\201\351\037w\347;<{"
+	.ascii	"t\332\370,\262\363\310\301\027\344\216,\375p\220\234\371\t\367"
+	.ascii	"D\342\035\3066{tU\350sq\3775\343\026\007\t \337\022\343\030\273"
+	.ascii	"\374\212\263\210\005\354F\347\265\212\234\373)\3472?\225<\351"
+	.ascii	"\274\303t\336fO\205\252\327s\ryi#\263y*\207\351\234o\201\007"
+	.ascii	"F\361\305\223\t\212\234\37721r\323\236O\004\"a.\215\256\346\251"
+	.ascii	"\374\302\345\006\323\210/d\240@\341v\333\372\02562\256p\277\264"
+	.ascii	"o\205q\214\\\345\312\t\204L\r\357\245\303\0263\274\006\234\267"
+	.ascii	"\371\f\337_i7\217Cx\3634S\005\336\346\3351\372\2104\254y\005"
+	.ascii	"\336}\241\005\273&,f`\2005\200\214\0300\264\036\320\302\232\201"
+	.ascii	"\025#K\013\013\003,\027.Xp\200\321\032\304x`\206\214\226]<\311"
+	.ascii	"\300 KkF\006Y.,p\241\325tqA3\003\030,b4]h\311h>\371p\226\006"
+	.ascii	"XZ\315\031YYZ\315eW\225>\321\365P~\260nw\254\242\302\351\212"
+	.ascii	"\216\033\315\274\202\226\342J\016\262f^\301Q@\323U\254\231V\034"
+	.ascii	"\t\200\342t\301\212\265\3725:\247L\225"
+	.string	"\307\213\312"
+	.string	"e\354\214`Rv\027\304\306\332^5\033\354\211g\332~\214\035\361\261\355\303z\314\312\013\325/\177l<#\023\340\347G\\\032\335G\233TOc\304S\271YO\375\b\251\237z\250\324#\315\312X\247\024\270\bC)\316>\016x\3245\213 \t\340\314\325l\314\230\306\322\201\242\261\212;\232\211Yl,\035j'\234f\276\0346\026Z\325j\342\251\275\302\212\303\260\302\311\220\331\371\327yN\300\243\251nk\330\27442v\205\351FSkT,\021\002\373\276k&\362:\203\342\335\227\346\023\\\356\210X\004"
+	.string	"2\354\214K\250(\262\273@'E\f{\242\022*sq`\330\021[\205$\003/\237\342\\\234!\026\232\324\252\370\345\217\354\200\263\315\201.S\267^\3479\003u\200\274\357\333a\314NA'\227\274\3561?\307\352\327s\261\325t\360\352\251\214\344n\360\215\344\212\370\r\274\352]\234]\b\235^\234^\334nE<\222M\320\nw\204\214U\324oa\373\307\205\372\250\357\250\031\324\257\201\316/P\337\256"
+	.ascii	"(\327\344K#\361\203\207\n\327\2031\220U\275\364\320ie\362\363"
+	.ascii	"\207\002\325Yo\271!\276\305_\210o\331\246XG >\221 \211j\254N"
+	.ascii	"]\351-\027\304\363\260}\301;\364&\335R\255\247\203\257\335\357"
+	.ascii	"LD\223\037\016\275\366\276k\224\001\3161N\027\316T\035J\337\224"
+	.ascii	"\251r\271#\373[%\017J\n\373\224-`bm\257Z\024\366=\3013m\357\353"
+	.ascii	"\204\375\t'&\337\227\253\3238\260e\017{\243\327\266W\355U\362"
+	.ascii	"<\3564\017{\225\204h\370#\036\210w\300Q.\331\245g\026\202\314"
+	.ascii	"\023I`\025Z\"\006A\020O\345,\275\3456\337\023\2314\377*\b\253"
+	.ascii	"\326%\256\371\364-<I?=\263\0170iw\247\370\364Tf'\002\\\331\374"
+	.ascii	"\007\203\323\252\244\352\025\202?\250\362\360<\322\322L)\222"
+	.ascii	"\021\221\024$I\2411\022\013\020\212bq\030d\347\001\022 DAK\204"
+	.ascii	"\320\034IA\222\202\2445\330\321\251\007\311\024\363\n\3571p"
+	.string	"GL\312u\327p\301\242P\367\250\013\027\006\223\3511b8\327\326\t\226\267\347K\221\177]i\023\025\203\206_E_\216I45\2674\031\022\330B0\017\333\274Rr\022\364\342Ub\275\303}\245v\364\200\267\205\002\235\346y\307\347\353\371\306>\376b\343:\224\204\374g\222\335\"\013\205*L\340\007,v\0212\275\313\363?\306\224\0378\252\021\032\321\341\022\251$\2148J\b\351N|k\3753\003\331<\264Ald\225\337s\343\214T\231\325\260\236:\326]f\261\346\340\335\350JD\360\371\335\311u\265\320\364\311;\036\023\272\212Y\250\317\033e\300\262\323\261\3760\366F\357?\314\322&\371\025\371s\213\f\206\031h\350)\225n\221\016\232\253\002\253\212\332#d\035\273\021C\341\304\253a\347un\216\npW\241\275\334P\371\245\365\204\215\223C?\261Tk\221\374m>\344\270#\361\312\"\307%\215\255\306\300\025\226\204"
+	.string	"d\353\331NU\266\300\371s\366\036\212ar\r\252\272\301\035\271\341\210\024\204\255\221\026\305\b\304c\342y\366=iM\226'e&\211U}\0026\330\234\235\305\b\246w;\375"
+	.string	"}\302\004\237\325\020\372\243y|\336\236=\267\036(\371'\026\037As`MS\206\f\345\344\205%\372)_\024BS\265'-\030A\270\223z\236\234\275a\325A\343\377\216`\221#\024Kj@\327a\0249\360\343\365\350c>\304\221\267\231#\225C\361\022j &\037\r\022~\027i\250"
+	.string	"L\356\324\343\307\017\240\037\363\205\t'\225\370\311\276o\304\2269\332\257|2\025H\214\220\241\334gn\322\203'k/\347\347\371\326{\372\0212\343}\364\274\364itu\335\016\271\267|\213e\020\214\261\334\201\035j\336`.(\240\rn\033\340\020\320P\246p\356vs\250\246\312^\256\202H\243\216\320e\031$\322G6\210z\351@\332\305|K+\216\002\200\236\266\223\277\200<\375<`\352O;\274\025\037R\360\252/(\365:Z$@]*\276RzF\236dr\334\362\221\253\243\242$6\242\365\303\254zP\03713$\353-\020\243\241\237\321\025*N]\311"
+	.string	"\1774\303\306\"\027\004\222\027\346 /L\030\247\256eO\215\344\223\225Bn\241`}\n\013\242\372F\n\016\237\b\026\312\316)$[2\202\206^k\355\025(LM\357\266\205\036x\206\274j{\214\250\021\310\343\"n\304\223\304\035\021\244~\237\347\273\323\252\210*\3006b\377\223<\317?\007\254\243\215'\315y\316\236\023.\211\203~\205\357\026&\250%\307D\351\247\030K\230\327\252g\264\034\0222\345\344\313\201\332\b\366pU5\n>\003\366t\354\f-.\206\364\222\262\323\216"
+	.string	"e\260d\201\304h\177\300\336\263\023v41Iax5t\001H\270\211*\270>S9C\211%\020Zx\214-p\365\350ao\206=/\300\202\361@\004\240\r\201k\325\374\211\216\t\320\261\323\230;Bx\204"
+	.string	"\316\240C\246\312\322nz\323q*b\237T\006l\337\373*\\"
+	.ascii	"\300#\020*\003\240\030\373|\227\025\220\221XO\264\317\322T\363"
+	.ascii	"\251\005 \037\326\013F\233\221\026E@*c\305s\265u\304!@W\177\223"
+	.ascii	"14\222\023\272X\31086\377\030\202\221$\230\244\273\027\225\\"
+	.ascii	"c\230i\361\n\315\243\207\033O\340\0168\213d\345I\202B\311\275"
+	.ascii	"8TbR8\025\001\201\263\213\261-\276[\372\237\327o\361\256\373"
+	.ascii	"\211\310\213m\357qK\313t\200a \260H\377\333\n\210\355u\017\327"
+	.ascii	"\363\003&\354`\320\020\017\274\b\360b\320+\210\240\262\207V."
+	.ascii	"\264\351\216\240#v\032\016\022\261\f\020\362T\b\240F\023\005"
+	.ascii	"Wn\265\233\006\357\302\016[\213q3\027\033x\367\230\241\232\331"
+	.ascii	"q^\036\024-"
+	.text
+	.section	.gnu.lto_getRcStickDeflection.98.1b5701b796f9c41d,"e",@progbits
+	.string	"(\265/\375`"
+	.string	"\001\025\r"
+	.string	"\026\333\\C\020\257&\035(\314=\302\2053\371\fv\243Z\r\257u\2443&@\217\234\223\036D\230/\235\277z\321\202\365\013\2116<(m\247bT"
+	.string	""
+	.string	""
+	.string	"h\\\317\002\220\261\"*D\216\377\334\232%d\357-eJ\001I"
+	.string	"G"
+	.string	"H"
+	.ascii	"\030\371N\314\247\214\254\331\245\020\342ew5\234q\035\332\366"
+	.ascii	"7\234\203\310\243\307]8E\024\027$(\231\335\305\004\034@<|\357"
+	.ascii	"\304"
+	.string	"C\265\360\321s\344\177\345\217E\t\022\246\223\310\323J\260\273N\323\251\344\326\333\036`\233\303\376\204?\324\264j:_\372\233\315\314j\345\021\261+\241[\255\t\b\223\341\251\333G\371-)\253\276%\373\b(P^\254\330\335\214C\027\270\316bs\016o\213l\216mM\373\334;\210\256\002\301p\327D\305\313.\247a\002\327a\235Zj\300\245\244a$;GU=p\342\232z\222\031Rv\241\203\320\256\335\345\360=\374\303\003\037\303\241A y\323\241\017\022\017\257oygD\n\030Rv6'\222Z\301\376\333\335\265\236h4}=u[W\371\343S\002!\236\3146\005\037\017\b\372\204t<g\033\240\006\332\026\372\3202O\266a\031\003\354\343\323\341\201e\033\b\333\b`\315\301\202\r\013i\332\206q\270\375[=\261m\215~\345\257\205\tIG\2541\267*^\252\321\263<]P\245\030K/E\240*\311\2202\020"
+	.ascii	"2\241\251I\343\365\204\337xa\271\006\311\304\004\3105\212\372"
+	.ascii	"pPgf\265\001a\370f\257\253\024A\022\250\300\202\237\031M\355"
+	.ascii	"|\002"
+	.text
+	.section	.gnu.lto_useRcControlsConfig.99.1b5701b796f9c41d,"e",@progbits
+	.string	"(\265/\375`o"
+	.string	"\365\t"
+	.string	"&\223F>0\345(\035\200{=\277^\353\030l\350m\nP\272\217\211]!\252$*4\323*]5\006\377\307>\033X\203\321X_\377?B4^|hl\241\200m\344\021+\212\374"
+	.string	"R\311&[\246\0241"
+	.string	"2"
+	.string	"7"
+	.string	"\323\343\025\264\317\355\t\332\247C{\300\307\224\375L\202\325\313\300\356r\022\345\3415\364\357r\003\221\225\272\026D\354\256Ud\205\334\362\266\035lC\330\327\002)\225'\366\263\335]\313\226}\327\237\251ZU\375maD\200\247\300.H\f\301\302f\315\312\306\366\325>\313[\302\273PG\330m\001\240\331\0359~\330\036\217\271\f\007\306h\244}\312\227H\340R%gU\262\251\237\241\331\240\206l\b \002\363\220)g\322\1779\f\312W\361\306I/~\372'\355s~\304\016\230\2504f\217\001\037\220\302\233\370\210B \357\223\270\b\225\016\334u@\221\367\231H^\347\351>\256\003q\244\220\305\210\353>\220\3530\330+}>\316\344y\037\267\031\367\331\312\226+H`*\331a\225\016\r"
+	.ascii	"2\241\025h`\270X\020\260\021\222\273\230\341\312\220}\332R0\352"
+	.ascii	"\022V\263\032\r\356\362\242\235d"
+	.text
+	.section	.gnu.lto_.symbol_nodes.1b5701b796f9c41d,"e",@progbits
+	.string	"(\265/\375`\307\004\005\024"
+	.string	"\366\"\201G\240\226J:\224\2726ZF;\356\2505\376M\231\374\367\221\341\255\275a\235e\241\023xG\230\207~\005\030\261\335d\275\346;\276\330\006'M\316E\027\016\031>\364\307\035\357nw\277\255\252\2451\261\354\241\370\220&\211L\001k"
+	.string	"k"
+	.string	"q"
+	.ascii	"g\232br\232z\002>I\211\2002\021t%Y\370^\026\364\257\021\250\237"
+	.ascii	"&\376\364\321D\237\017{"
+	.string	"\336e\3449\225\235O\321y\333\230\363(#\316\331\276\2465\003\354\246\377D\2649\224\232\336\327F\336\311v8\034\016k\372g\342\255hNd\246o&\356\257\344\224\371\220\361\277x5\271\376\376\217\300\320\335\234s\"\350;\021\377\217@\002\375*\035\372q\034\372V6\364\257h\350\273e\350\277a\350c\271\320\227\263\320\317R\241?G\241O7\241_\267\324\327\"\241\277%B\237\013\204\326\371\240\325\312A\353\225R_\250\377\3059\347O\323\240\257\246\f\304\244\001\013.D\301\215$x\021\244#9z\230\321\225\024=\311\357bD\037\033\207\276d\374QHM\001I@\t\235\311\370\274QA\037o\024\251\272%w%\304;\242\034\342m\022\022\3616\225\252kXi?\336\031Rs\336^\374xcJ\3256/\031E\2741\244\216_ctF\274\006H\037/\214P_\342\310Z\b\361\302\220\312S\333\021\203\307+@\250"
+	.string	"\332\270x\034\361\006\020j\201&qnG\274N\252Yup`\274\335\336\350\366v\033\242u\005\210\276\224\017}8\017\001_\322\335\234s\"\021X\355A\226:\310\034\245\036 \301lx\325\006\251>\034[7\274Z\203\324$,4\034\336&UF\314G\016\257\212\240\376\346\316tx\253\312*2E\251\342\f\013\262\303{\242T\245-e<\274T\245r\227\027\\\217\227*\330\303\013\364\341\005\226z3\255\037?\274@\262\307+%T\221\206\213\033@\274%\202\372\222\305\326\025\024E\2501\b\305\243Y\214\210\202\226\231b\003@\003\241\255\016\021\200 &\025A\302\215h\220\004\362\001eI\004*\223p\231:\034\n\206R\357}\303\373\307\316e,\261"
+	.ascii	"\037P\230\203\244\030\007\030\306\037A\212K\267T\0024k\314\344"
+	.ascii	"w~\347I\344:\201\"G\030\375k|p\004\322\216\n\030\256\227#^\231"
+	.ascii	"*=eL\350\353\270\006\273\n\306/\333\244\333\2605\204\204V\343"
+	.ascii	"|*"
+	.text
+	.section	.gnu.lto_.refs.1b5701b796f9c41d,"e",@progbits
+	.string	"(\265/\375`\026"
+	.string	"m\006"
+	.string	"\302N,0`M\222\016\300\270\202\006\351*\311z\006"
+	.string	""
+	.string	"\340\372\3058A\020\004A\b\201\305\301'#,\220\241\267\332\026\331\"k[#d\023K\bid\313\024\023\340\001\032`A\342\340"
+	.string	"vP ip\203\n\003\322O{3\005\300\273\306\364n\270^\215\354\315\310/\306\345{\021\365W\242_%\005\345\244\375&%$#\"\320\037\002\342\376\217\374=\\\277#\373\034\371\026\320W\270N\341~\"_\342\365\210\367\020\320?\274\336\320gh}\301u\205\354\t\331\021\3627\371\232\366\260\307\265\305\341\016{\316z\214\372\210\375[\337\330\263\365J\375X^\351\233F\274\337L\n"
+	.ascii	" \004\304E\211\342\031\027T\260\233!P\242,\231\301\\Q\263\r\\"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.decls.1b5701b796f9c41d,"e",@progbits
+	.string	"(\265/\375`\332>\275\016\001\332\243\261]U \314\250\235\016&5\373\326(U\360\035\205xM\207\325p\177\2044TMO\302\374\\sG@o\021\345\261!nP\026\224\355\275\320\310Q\\\344\245\271\267\224\013\277m!\336\345\022\366\247V\247\257K\320Q\024\251\303\260:\375~\251\217D\230\024=\222\354-\245\224)7\005\330\005\021\006\0252d\220\341\303\202J\367\247J$f3/\350\256\320\310;\003\237\317H\322/&7"
+	.ascii	"\005\271\021\236\032\035T^Sy?z\307\037\273\221\341-6h\357T\200"
+	.ascii	"\314\336{\221\334\304\316\\\226\211\230m\310ey\b\336b\263lv&"
+	.ascii	"\341V\337\002\343\257\367\236\201'\203\0064\213\362L\367\243"
+	.ascii	"c\374\321\035\374Q+\376h\224\030\225,=\330\306rO\341\002\013"
+	.ascii	"f\257\354\"\277\320eL<\211\2210O>\354w'\2654\310\334\360\027"
+	.ascii	"\205#s\345\255\374\225\265r\220\314\314<\262\216\334\225\303"
+	.ascii	"2\220|#[\345\0379+\367\310WYH\006\313X\331G\316\221\253\362\016"
+	.ascii	"\354\314^Y\352\363T\246\372\235\225y\331\34297\370\024\227\217"
+	.ascii	"X\260q\341\361\004\374rU\243\313\216'\366b\003\317\311\btS\221"
+	.ascii	"Y\334\251\310H9i\005\023\306\277O\216a\007\006\007b0wP\033\376"
+	.ascii	"}\262W\206\3126t\223\031\203d\365\367\024\314^8\314\021\032\317"
+	.ascii	"<\343\351\313\006J\231E\022\346\303}wX\331(\305\235\022\223\006"
+	.ascii	"^\263Q\342\364\";\300\354\225\213\360\032\246{\352\312=\r\332"
+	.ascii	"\330\26003\b\001\301\244bh\2603\035\236\220&@\220\177\266\261"
+	.ascii	"\026\202\336\317\204]\203-\370\362\3165|>G\t\300\t\327\226\267"
+	.ascii	"\320\013\377}\307\177\277\361?\333g\374\367\027\3778\246\334"
+	.ascii	"\204\235\030\262\323\347\0268\356c\214\232\335,\006\257\317"
+	.string	"\306Y\336\277\267\370c\f\351\r\306\220\376\276\342{/\361\327Zx^\261eD\271\322\312\3735\025\376:\215\277\006\343<6\370k&\216A\247\340\237\0019\207>\376\031\013\377\\\307\237\256\215\377\023\214\377\037\236\220~\276\301?\267\340\217\273\360\307W\370\343(\374\261\223_\330\263\200\033\275\245\215=\365p\223\nL0\357\307W0\026\274\005S\365n\204SlY\312\202\265`g\005\234\207\371v\0245\345\375\370\b'A\357\270B\212\007\007q\2054S\341\t\251\001\252\370<\266b\323\004vDI\3369X'\255 \024\3226\225\343\216\356K\325\bhy\377\0069\216dd\310s,\203\r0\035F\303k\272\311\024&\261B{\306\215@\206\331\336\260\023\233%N7*:c\366\336\264\303ux\n\226\202\251`'\246\303P\036G\301s\237\233\275\033\365\336\037\273\375\373<\246\303O\260\023\335d\353FEu=E\264\254"
+	.string	"\374\353\275\231!C\206\f<\031h\2764\025a\242\331\317\206'\2442\230\005\377\021\3607\362'\301/0\301p\330i\001n\362\270\r\273=\272l\366f\316\022D3\222\367{\200?\266 \325\203\203\330\202\364%\300q\360\2044c\235\024\003<!\305Jp\032vR\200\325\264\262\310MM\030\2600\201y\277\003\370\343%?\301\262o\360<\3741\005)\036\304\024\244\317\371?>\243\340\246)c\tG\336HR\244)3)y?F\362\217\315\360\221_\313T\275/\351\275S\340*\272\b~\311\033w<!\305\301:).\342\363\330\210N\312\364\324\3547\r\310\302\021\226\267\306:)\036\303d:I\211\252\237\365\336\314\021\2125\261:\313\033\223eL\0047\037\223\341!\237\301\006Oc\324\307zob\262\335\373\022\343\nl0\256"
+	.string	"\205\363\2614\222\356\317\374\233xB\312\261N\n\210\343g\376u\036\217^\314\277\226\002D\353\374c\b\374\343\016\377\370\303?\376\371\317H\264\004\235\223\323\2644\216\022}\023\227\345\264\315\177\236\323x\232\346?c\3213M-\343\3241\331O\013\377\263\205\177\214"
+	.ascii	"\013\376\361\226N\345|\374\277\332\177\340_s\341\005\374\343"
+	.ascii	"\f\264~\3239\307?\326\370?c\345\254\177\004\360\374\277\005\347"
+	.ascii	"\377\017\340_O\361\177\355b\377\353\242\377\237\362\377t\377"
+	.ascii	"_\367\377s\377O\363\377\351\377\236`0\207q\377\363\004\376\363"
+	.ascii	"\007\377\271\002\377\257\377\367\214\r\b\202\t\341?\213\340?"
+	.ascii	"\013\375g\366?\007\375\347\343\013\377\367\206\377\314\301\177"
+	.ascii	"\336\340?g\360\2371\370\317\032\374g\016\201\377\231\202\377"
+	.ascii	"\334\363\237\025\360\345\377o\3767\340\177\366\362\237\367\376"
+	.ascii	"\263\336\177\316\373\317Y\376s\225\377l\367\237\353\376\263\224"
+	.ascii	"\377\f\345?\307\375\347&\377\231\311\177v\373\317l\377Y\355?"
+	.ascii	"\247\375\347$\377\331\353?o\375\347\254\377\254\343?[\375\347"
+	.ascii	"\033\377\231\004\377y\004\377Y\204\377l\342?#\377s\007\376\363"
+	.ascii	"\006\376\263\210\377l\201\377\314\200\377\274\200\377\\\363\217"
+	.ascii	"\377\376\261\337?\326\373\307X\376\261\225\177\214\367\217\251"
+	.ascii	"\374\343\272\177<\367\217\345\376q\334?\206\373\307o\377\270"
+	.ascii	"\355\037\257\375c\264\177\234\344\037\033\371\307e\377x\354\037"
+	.ascii	"\213\375\177\336\377o\371\307`\377\217\201\377?\362\377D\376"
+	.ascii	"\261\325?\026\362\217\201\374c\256\177\254\365\217%\374\343\254"
+	.ascii	"\177\274\343\377\233\374c\034\377\330\002\377\270\203\377\177"
+	.ascii	"\376\277\336\377\337\375?\225\377O\362\377H\376\037\204\377o"
+	.ascii	"\376\377\210\377\227\373\377\232\301\301\301\301\177\324\302"
+	.ascii	"\277\315\205\377\004\264\b81,\220\261\2416U#\357\337N\377:0S"
+	.ascii	"\021aP\320K\336\233\311\347w\323\314\\\223'Y\3364\202\3741\030"
+	.ascii	"\326_~+}\331K\030\236\372\213\013BnD]`\343\303K\226\301\274\233"
+	.ascii	"J\301\"Hy\357\244\275b\263\370\217\211yS\262\213\352\302\177"
+	.ascii	"\253\3301\305\207W\336y\037\375F\372\217\021\2161\031\241=\371"
+	.ascii	"o\243\235\342?F\013BySa\205\377.*A\226\033`y\357%?\272\031\301"
+	.ascii	"\202\030,E\362\262\362\376\275\374\327\2028p+\225j<\351\345\255"
+	.ascii	"\007w\377\255\324a\372Vj@\325\373r+o\300\364\276\274\301\270"
+	.ascii	"\002\214+\330aV[J\322\3757L\270\r\326Iu\240\317k0y\353LN.\357"
+	.ascii	"\232\033\257?\247\376\3238tR_Vq\340j\272\301\332\333\323~\330"
+	.ascii	"\001i\202O\n4\213\300uy\355',s\241d\247\271\310\360\325\335U"
+	.ascii	"\341\322'\363\342\312\0218]\205\362\b|\261$o\276\357\372\211"
+	.ascii	"\217\270>\031Z\264h\275\230\003\2205\3250%)2c\313k=\315\243F"
+	.ascii	"\210\025\030W\336:O\363\240\231\252\303\372\272Qbqj,\330\211"
+	.ascii	"\007;\250\226K\003x5\371E\375e\2570\263\036{V\2548\200\313/\352"
+	.ascii	"\013\255\362\363\002\206\207\207\207\327\266\262Hw!\203\304\345"
+	.ascii	"\027\365\327{\334\005:\006[\231M\230\035\025\274\206\301\033"
+	.ascii	"W\017\3766Qtu\230l_x\263a\342o\263\214\242G\320sx\313\005\246"
+	.ascii	"~\301\327\374\361\257\321\362d\004-\207\327xg\n\323R\320x\326"
+	.ascii	"\330\361\257\211s\342D\307q\236\2662\n\254\214\305\375\226\232"
+	.ascii	")NWz\023\356\261S\303\3511\254d\302\275+\271\363\361\234q\252"
+	.ascii	"\305ea\2769\365\033\326\363`\007Uw\272\340\305\204\345\351\002"
+	.ascii	"\032\345\221`\r\036m\217\235\272M\207\361\024\275/\241.\bi\272"
+	.ascii	"\321\242\304\202\366\"-M\257\341\247\256\344\303 V\306\257H\211"
+	.ascii	"\342\\\323j25\230K\304\226h'\315`\025;\262\274\277f\271\204\006"
+	.ascii	"\013\032vj4\214\304\203\035\315\376\302\002W\335\323\005B=0!"
+	.ascii	"N\272#Gt\222=!\232\034\214\026\032\311\353"
+	.string	"$\251\336\n\247*y\177\027\354d\223u=\345\310\373i\220\360\307C\2606\342\324F0\031OW\356a\300U\306\324\274\340i\272\370k\"\232\354u\363_7u\031\005\232\335\305\016\330\215)P\376\372\323\023\206\23114,P\272\274.#\243\351\335B\fW\227\225\322 \307\371?\355K\246\336\273\023\332\354LE4\351?~\214b\214\341\277\006kL\200\336\277\307D\357\3130\177\\x\327\332\262\306\205\376(]\357FUJ\017\252\232\214\252f$\231Uu\245\221\2262\207\251W)\223\314z\317\351FFJ\017T='\311\2547\365\024S\232poV)\273\021U\317\351F}y!\311\250\252)\311l\331\224\223dV\325\324\315\252:N7Z2\2510\352L9\335\254j\257\233Q5\341$\231Q5%\231Uma\"*\310\244\234\004\377\256\002\361\215$\243\336b)j\311\204C\227\324\244\352Vz\307gG\235\211"
+	.string	"\275GQ1YY\316\300lEt-\212\226,\251ps\251\310\212\252\033\321%\001\241\352\035H\221P_\322@\331\244\353<0\235\022GTW:\352="
+	.string	"K\275+q\247\353\275+{\357B\246\250f\357P8I\314\245\245\336\237x\226z\224\262\355\250\367|\206\205\255)\311\314\212\312\247\r\211\031\263#5\225\230\331\255T1q3eYW\352\343\314\246\027|y7\2333lRh0\362\326b7v\200XYk\\\203\205Q\002\343\t\221 Z\210\t>\254']A\2724\220<\203\305\017\247\034]L\315\305\355"
+	.ascii	"\257\344\362\376\231&\346\226\326\022v\241\202\366D\373\250@"
+	.ascii	"#\207\247\244\013\352\254\030*(#\313.\032K\347\320:\260\363\341"
+	.ascii	"\364\016\036N\224<\362\370\t\341\303\245\377\372\n\007\215\021"
+	.ascii	"g\237[\306\241\255b\374\366\366\304\362\326Ui\231\026\255!t\374"
+	.ascii	"\263\362\n\017&\226\035O\272\205N\32234\r\315\244Sh%\315B\027"
+	.ascii	"\351#\275BGi\027Z\206\256\241m\350%m\244\2454\222\206\322N\372"
+	.ascii	"\206\246\3220t\223~\241ch\025\330\251\247\362\340\353\256\225"
+	.ascii	"T\356|\324\2011\343\242\220\271\321\2151\371\252d1Y{\006\352"
+	.ascii	"\245\3343+\337\342\236qR\206l\211\212\3132\305\314\2631f\005"
+	.ascii	"\213\251E\212\t\247\366d\233#\362\024T{\0028\345\353\351d\t3"
+	.ascii	"p\2044\346\030\224\263\247\236\312{9\214n2?(\202\032\323Sy-\273"
+	.ascii	"\251\025\215 \210\327cN\016\255\211\363\311\247\247\262\235\326"
+	.ascii	"SO\345'J\236<\031d\322`\304h{\300~\0318\216v\2663\3769L~f\301"
+	.ascii	"\020\364n\224\255\372\212\332\362\006\023\023v\345\r,\357\227"
+	.ascii	")\343\277\001\027\273%\300\034\230\377\2603\177\311~\217\213"
+	.ascii	"d\244\307^\354Z|\311]\270\312\272x2d\210\301\273\252\343\343"
+	.ascii	"\373er\360\227\231\342/c\203\277L\r\236\371|>\367\315\030\301"
+	.ascii	"P\242\225w\314\f\216\005 \243\304?f\220\177\314\223\177L\024"
+	.ascii	"\3761i\374c\272\370\307\350\340\037\363\304?\306\210?\357\343"
+	.ascii	"o\205\333\361\347k\374y\020\376|\212?_\301_\350\205\277\320\216"
+	.ascii	"\277\260\215\277\260\b\177!\027\177!\025\307@\210\304?\005\303"
+	.ascii	"?}\362O\345\370\247Ir\333\214\224%v-\200\360\314\366\273\bU\263"
+	.ascii	"F/eDY\313\373\323+\376i\f\376\315\274$\rN0\316-o%\031\r;sZ>\033"
+	.ascii	"\313f\230n\207\207/a\236i\371HNR%\030{a~=Re\226\025\252+\245"
+	.ascii	"\274uXL\037\026\022\035\203K\370(,\310T\230&)\230\331\017$\202"
+	.ascii	"i2\352\364\004\301|\311S\244\366\350\320\300\2557\003m\354I\336"
+	.ascii	"\200\200\250\216\2356\247> :K\306\232]\336o\241\367\365\241^"
+	.ascii	"x\250\224{\032\364u\021\001\223\245\240\340UA\271<\352\005\365"
+	.ascii	"\233\221\262\323\032C\273\3348\3512\305\346\306\277\213\376\242"
+	.ascii	"0\230\205T\266\267\007\202&\026\346\027\240\327R\\\336?\201\017"
+	.ascii	"==]\266\343\365\026F\344O\256\305Z[\230\274\274,U\201`\276fh"
+	.ascii	"Di\023\363r\345\n\232\205\207J\347\331\005\t\223\241\372\346"
+	.ascii	"\260\260<\232E&\314\321^\232\027\006X\262\264\342\356\356\320"
+	.ascii	"*{~Q2OP\324\254\340=Z\005\017\326\035\201\242\177tU\245\3503"
+	.ascii	"\263\263C\325^\033u)9f\323\t\351\312\220\272:T\r\247-\003\301"
+	.ascii	"\374Y\231\341`\302cn\016\225\302C\245\344\343\300\245\225b0\001"
+	.ascii	"\"E\377\3302'\345I\336\037\200\027O\236\240P\030\360b\353\371"
+	.ascii	"\225\273\254\3549\221{\024\312\346\241%F\026\262\025NoRvqq\250"
+	.ascii	"\032\217\2237\255\261\324\257\n\256I\220&M\320,\245_\324\237"
+	.ascii	"\016S\201WA\213\t\0234\215\207J\353\031\301\032\373Bg\034\231"
+	.ascii	"\341\243\213\233\033\2526%\020\314\327\215!\200jl\377l\350\026"
+	.ascii	"\306i\036Yy=\rq:Q5\247/0\276\266X\225\2455Tm\n\020-%<\320\320"
+	.ascii	"\320\264\347\026\030\177\022\226WL%\217\246\351(X]f<MB\036\025"
+	.ascii	"\023\202&\321x4]\270\366d\220\313_Oz\3020S\306"
+	.string	"\242\254\256\310\243I\036E\222\301\006\237\307\277\202\340-\363F\217<j\366\024\305\355i\0045\353\2722\023\302\307_\001\274\210\214\246\246\274\321\262\317{ yJ{y\243\315\207{\252\362\247\203\354\347\254\354\212\362F\307\320!\330\371r(\221\267qCB\223\313\302\277\004\370\345R\024\354\32107\251\253*;\376\217~)\301\253\301\234\343O\301\t\027\027\352\305C\245\257\270\005\202\371\272i\276\265Q\241@\036\365B\373\262\366\006\321\2564\352\306\362\017\355B\1778\265iq\371\221\317*h\257\027P\216\362~\nP>|\240[<]?\276\300\340kE\336\330P\255G\267P1\267\346\f\274\206Z\371iY\273\302\203\007\232\345\263\364\373\372\252\221\342\264\326\204\365hVM\227#tD\362\213t\316\005\230/f\374\257\376\n\325\201\213t\027;dN}@0\330\330\345X\301\002\315\361\250\216\233\"\257\036\316\0365_yw"
+	.ascii	"x\262r\242V\371\205\007g}\331\204\301\311Ro.\307\007\235\220"
+	.ascii	"*\035\355\350\r\017d\212~lq\263\241bs\201\207\336\240\332y3\266"
+	.ascii	"\200\311{\352\354\210\371\225\367O0\302\177\003\025x-,\354\311"
+	.ascii	"\342\363\202|=\221\360\232\215\356]j,\351G\026\250?%\232\342"
+	.ascii	"\353l\006\n\205>\241Qh\rT\n\215\201\332@e`'J\003mz\324\t}\361"
+	.ascii	"<G\230\f\323=5\340\007\331\023\006\232B\205S\026(\224\006\252"
+	.ascii	"\2042Y(J\372 \265\205\322@W\350p\312\002\365\307\263\336\216"
+	.ascii	"\270\330\331?\241\006\307<X'\375\tK\374\037eB]\034\341\250Z6"
+	.ascii	"m\326Z\030}A[\240K5a\200L\001\344\277\303\307\177'\013\377\035"
+	.ascii	"<\376;u\374w\240\360\337q\302\177g\215\243K\264\b;yP\243)E-\242"
+	.ascii	"\316x\t\372 \346I\177\207\b\377\035\2550;\f&\333m\312.\346_g"
+	.ascii	"\212\273\300\207\215)\t\n\f\230\253\025\025\264\352h\344\375"
+	.ascii	";F\200\377\200\373\313Vj\325,\201a\244T\363wC\212\211\226\275"
+	.ascii	"\337^\366\370\254\236b\236[Z\304\362\336]\266\037\227>>\035\267"
+	.ascii	"'\277\351\260s?\331z\030\2722\336\237\026\275\274\267\030\325"
+	.ascii	"\334\371U9\222\367\353\220i\331Y\366\225\215e[\301\316\235\267"
+	.ascii	"\361~\327e\243\307qU0Yj\265\305\202\371\207"
+	.ascii	"4E\213J\017\246\235\217\ry\373.KI\220*7h\366\353`\361\327\231"
+	.ascii	"\301_\247\005\177\035%\177\tz\374%<\341\350\334\226\022\005\212"
+	.ascii	"\034X\\\334\234\376\002\310\005L\007\334\206\333M\266\022*\006"
+	.ascii	"*l\013+o%Iz\210\335\345\375\022^8\177\27797\030\211\243\030;"
+	.ascii	"+\254g:\202\230\322W\336\273m\273\261\255\251\t\016\371md\017"
+	.ascii	"\331i\030\236\226K\016^e5o\201M{y+i\362\310\354\2059s\333\302"
+	.ascii	"\223\3543\354\334h\373H\323l\315g\243m$x\315Fh\025\307\202\311"
+	.ascii	"\223!\003\215\330\020\270\025\351\376\034(\374s\234\374s\204"
+	.ascii	"\360]\266\213\354\346&\333Dr\240\304\266\230\016\333K\234\336"
+	.ascii	"\255\376\330\322\261\274\300\300\274?\347h\273\370M\003;\267"
+	.ascii	"\213\r\346S\324\227a\t\020\322\264\207\364\220\252\313\373K\310"
+	.ascii	"\202F\332\031 \177<\026\265\245\254\230Mm\033cR\236U\033G\020"
+	.ascii	"(O\276\034[\013\323=\341t#5-?6\325\266a\243\314\351\035\307\034"
+	.ascii	"\023\310\026\262\203\354\256\315\265\275\260s\377\330W\277\241"
+	.ascii	"v\215\347\331?\366\r\354\004\323\355\360`,\312s\006\257\313\026"
+	.ascii	"\235\315\216\372<\013EI\024 \202\345\271\265\266\216\355\003"
+	.ascii	"\323=5\273\323\214\363\207\016\250\255\315\304\316\255\365<\315"
+	.ascii	"\336\3172T\250\t\274\362G$\365\261{\260\255\250\201\224\367\316"
+	.ascii	"\302fr,p\214\300\003;7\326\r\322\017A\255\274\367\216\317S\241"
+	.ascii	"\\\301\342\341b\264\211Ei\302\037"
+	.string	"\207\215?\216\021\276\255\370\335\323\306\334\020\3768`\374q\200\360\307\351\301\037G\007\377\337R\333\006j\366\204\313\\\266\213\242T\224\367\343X\361\214\001\353\244[\306~\272\tc\313\2216\003\003XR\322\362\3361\262\334\026s\t\206\215\025-\264\262\027h\332 \027\032yo'~\024\357qu\327\026D\361\210\3749\"Y\227\275\360B\032\332\325H\344V\360\016g\326!v\304\273\006\341\030\325c\020[\202]\211k\b\367\303\211V\347\2054\364\254\037V \3255\262*\020N\372B\032z\220\354\221Hg\250\355\200\242}\323\242N\207w\r\232\360B\032\002\320\252\257\210\235dP\017\222\335I\016\327!\244\320P\004\210\017( [\225\004\317\361\303j,\036U!\004\200\300A\001\304\276H\f\024\217\035\202X\240\022\252\253\343\256F\"\212\037\022\254Q\375yW\021D\242J\341\310\266\257\333\263\026\211\214\304#\333\323\272D="
+	.string	"0\032\211\216G\344Q\370\016S\023\310\243\020H]\215\373]\335\241u(\005\352!\252\257q\365\320\256\357:\204l\327\022\252\210\342\261\003\nc2\251\026\240\207\bDa\r\342y!\r=kK\364\252+\220\260\202\0046\360a\304O\207\241\004<d"
+	.ascii	"\204\341O\210\241\210\0179/\244\341\002#>\210\350y\327\240V}"
+	.ascii	"/\204@D\032\177\326\026\371s\363B\032\334!\342\204\367\2054\364"
+	.ascii	"\260m\221\202\037\022j\033\024\343\016k\334\341\006\336\026\t"
+	.ascii	"\242"
+	.string	"\2503\242D\272\022\331\022k1uM\030\221\304\335\001\017\270\310\344.\256\255\272\032\211\302\324\0042D\213t[\"b\f\n\325\230tY\017\357qm[\242\237\344M\321U9\320\262\252\316\004\n\025\336\325m\327\022k;\334q\207\0228M\316\032\364\272*\320p\370\032\325\235\366B\216\316\204\2678\314q\2076\257\333\262@\303#rhT\211Cd\213\"h\202\005\024I\344\217\316\233\354\tJ\022\217D\023xWw\346\b\224Qw\030t\fJ\242\307\240\244^E`\335\355\272k[,\252B\024I$q\267oR\177\r\212\366u\331\2405\304\220Bq=\006\261FUX\\]\242\355\n_}\325\3420(\251\301\246U\205\210{\230\034ZG\204\bJ\n@\346\207\030bu\211t\210\253\021h\365\360\256A;7\257\372\2722/\244!\210\005:\022\r`\246\006\003\r#\206Zb{3\343\243\341U\327\344\032\342Eb"
+	.string	"Y\254\211\311@\203\013\202\007b;\3037hp[\031\227\030\302uW\"\262MR\270Q_\325\003\261M\207\326\327E!b\302:\304q\211^\365\025a$\"\032U\"\205\342Q\035\032B\376\020\333\030\326E\202Hv8~X[\265\302P\333\0019B\302\023;\264\310\t\270!\020\331WD\320\221u5\340\262"
+	.string	"x\"\333\256\3075\210\277\006\034(\200\003\016'\204\317\241\003\f:\300 }\016\035\370\370t\300\201\017\177\016|\364\373\206\340\252#\200\2102\353pM\256+\t\232u\350\006\251\306\t\254F\022\252\313z\b:\262C\255\272\363\256\303\342\207\023H\022\302W\306\035\256F\026\b\331\202(\262I\232\267\310&{x<`w\310\241\310&S\020\370\003.\262ImBE!#\202\320\020(i\244\021A\310\006\b\b\371\022\021\207B\304\027y\224\260&Q\274\303v}\215,\3200\347=\256\304v\005\001\"IT<\262\034\2400cB\365\300\020\221\210\"\233\2649\272\30759\204\374)\262 ^\225D\t\235#\013\302\333\241\310&q\214k\211\325x\363\022W  \235\267]\223'\326\341kd\337\341\021)\002\333\"\205xF"
+	.string	"\340\310\252\037\264\310\016\354N\210\023\252q\r!a\345\200\210\241v}\213:!L\250(r.\320\301\246\030\204\363\036Yd\362]]\236u\210}eP\250\306\2658\243\356\254\257\332\016u\326a\210\237\"\233\224\200\202\270\2666&T\024\303\227\035b\215C!Wm\2117D&\324V\003\255\305\341K\341\2054\264\253q%\022\325\036\267E\272\307\325%@\022u\207\356\020\333\216"
+	.string	"Q<v\3201\032\221\355vW\"\243Z\"}!\r'\332\236\023\255\316\211V&\251\016\021[\264]\213l\td\233,\256'Z\243\312\266\253\233sb5&\211<"
+	.ascii	"\031U!\031#\222\210|\221m\362\346\035f\260\241\310\306\274G\""
+	.ascii	"$q\b\324\016\331\244;<\321RX\213l\333\256%\220\303#{\341\035"
+	.ascii	"\n\203\324\021Hv\030DdL\362\344\274\253\273\266\310\227H\035"
+	.ascii	"\026\217,\211\341\253\272\303!\242\366\raM\272\023\320\254F\225"
+	.ascii	"\350\312\274\355Z\342\310\016Y\327mg\210m\221\035B\217\354\020"
+	.ascii	"\017\201\270\n\021O\250C\374\306\3751\252%\216H\366U\215\310"
+	.ascii	"d\273\276\307\017\304\226\202\273\256m\320\352a5\006\035;\f\251"
+	.ascii	"?%\222@\022\212F\244\220\273\266B#\326W-\301\276\304\016k\021"
+	.ascii	"\tB\313\252<G\226\270\272D\303\023\355\214q=\036U!\342\360\004"
+	.ascii	"\221:<\241\016\335\b_\310\302#\223k\333\363\"\221m\317\214;\f"
+	.ascii	"b\201\216\310\037\017\033^\241 \326\b\204c\002i\264\021\nb\205"
+	.ascii	"n\212\033\214j\373\022\255\307\230w\310\201\017_\215\357\213"
+	.ascii	"l\205\336aqC\361\250\222(\252kQ\347\035rx\217,\221\360\027\260"
+	.ascii	"\200\237\013\032\300\300\007\234\250\3015\"\333\367\210$\016"
+	.ascii	"\211m\017\021\250\347\310\252C=\304\326\355\3210Aq\303ZD\016"
+	.ascii	"\r\213\253\020\361eM\2707F$2\002C\024\206\027[\017\0369^\240"
+	.ascii	"Il\350\310\006y8a'\351\214\024\201iM[6\177O\356T0\245\241pi\312"
+	.ascii	"\035.\240\344\0363\362\246ZH\021B\211\321\374\261T\305&\355H"
+	.ascii	"\t\227T)\013\022!Y\316X\350\262\b\360)]9\323\025jh4vX\251@\275"
+	.ascii	"\034\221\032\262%M\302[\256\270\324\304\362NS\244G\237\"}\212"
+	.ascii	"\224S$=8\230\016\241\222$5\322c:\007\030`\214\274\233"
+	.ascii	"c4.\\dQ-u\324\004\205-\250c\202\364\221H\031\202L9\245\320\f"
+	.ascii	"\315H\2234\006\003\025@PxT&\231\312\263\236\017\023\300Q)\324"
+	.ascii	"\251\224\2051\246\224\241\021\021\221$)H\235i\fO\177\263\241"
+	.ascii	"\355\301Z\204Wv\2448\321\262\2373&\334\203\004\364\352v\016\206"
+	.ascii	"\373\321~\333\221\354\331!e\202;\3122x\243\265\023\340\363\203"
+	.ascii	"\266\205\334p\257\020\267\277l\335\252i3e.zAQQ\320\003\265\211"
+	.ascii	"3\253\340\360D\227\354\333\324\333\177\005>\007\252,\025\024"
+	.ascii	"\204\206=\264]\"$r:\266\234|(\327\331A\325M\024\030\327\3468"
+	.ascii	"\335\277e\226E\361\217\251;\334L\361\205@\262Y\364\351\345\206"
+	.ascii	"\235\271\0312\016K\347\215m\343\353\300\325\350\374K$9\275\002"
+	.ascii	"\217C\n\253\230z;6_q\363H\322kO\025w\314\213\372\314\255\003"
+	.ascii	"\357\3774Do\006aow\314*\305\020c7V\215Gt\221\351\247A\225]\t"
+	.ascii	"\265\017\032%[\310=\003\216\275\026\025w\177[)J+&\304,cb\034"
+	.ascii	"u\036!\017\236x\\\376\207\307\212'R}\305\270d\234\265M\263\210"
+	.ascii	"\356\347M\r\354s\233H\342 \256\205$\326\005\230\261\3150\357"
+	.ascii	"mZ\t\001\f\004\340\271\274\004=\237\f\305\237\177\2608\251\340"
+	.ascii	"\001\220\n\266\375s \333_\301 \004\377\210\370\016\223n\205-"
+	.ascii	"\202Z\215-T@\0164\256\311\244\364\316\324m\303\034B\001\253x"
+	.ascii	"\246'N\341K\002\335\322f\002\366Sf\022*]\311Z\326L\235\356\311"
+	.ascii	"\212k\244\030N\017\332^\024\307\206\241\342t\r\016\264\320\361"
+	.ascii	"_\362.\302\352\222\021\266F})\366i\271\310d\372\356\225\0227"
+	.ascii	"\366\326]-\304\2251b\300\310\252H\301\246\257$\356NnQ\323\362"
+	.ascii	"\347\007(g\025\351Z\242\277\343\2674oQ\240\322\277\312MI\232"
+	.ascii	"=\271\341H\376o\354\030\252\262\255]\0213\347\322{\005{\272\363"
+	.ascii	"!|\212F\273\2442W9\211\207b<\b\265\322\363u\272bh=\233\325\237"
+	.ascii	"Y\276\333Fh\003\307\243\355\352\233E\321\233o\224\214@\233Yq"
+	.ascii	"\245\234&\375\367\266\037o\007;Y\316\330'\033\226\013D\364\362"
+	.ascii	"\343\314\237g \215\3436G\240;\240\035\264\347\""
+	.string	"tLu<\210\264\307\347\204\337\375]\335\021aO\033\346\354)\336\320\246h\241\261\037\207$\2251\330dP\337\031\366\347\206\031\2213x\0366G(o\217\354\372\302}\2230\324\333\315a&v\213[l\202\231\f\212i\370S\270\005\373\2624zuwDu!\324\266\334\375\301u\346P\243\274\035D\227\235a\352\245\r\230\303in\371\363\005\177\200\270\352\037\021\325z]|\001\306UN\021\020\b&\234\002%\371\f\216\r\275\375\254V\332\324Nk\345\035R\300+\240\302\270\360tS\353\307\233N\263S\213\003q\251\220\240\314\351\200\315h\020\271e\227\006*:\241%F\316E\224a\036\344\210\201\236\356\323\266\316\025\223\222\224u\226*\274Dl\340\2409\222\335\243\255\223\026M}7\254\370\216\341{MJ\311D\314\222\260\342 9\n\303\346\364\024\214\332\013~\266\2645\331%\224\365U\f(\n\037\342\2419m\212\275P"
+	.ascii	"\363%Wt\225\001\320\310\217\237\021W.\255\316\332\334\203(8e"
+	.ascii	"\227\213\211\304\277$K\251\247\321\264\347M<\224\353\037\331"
+	.ascii	"\346Y\341*CCZ`\370\b\266\206\361~V\352\3601ZS\007$\022\327\312"
+	.ascii	"\3747\224K\0266\366\257\335L=\tU\351=\227NP4\274\2121j\272_\233"
+	.ascii	"\252\237\225;\252\204m\025\212\221\n\244F\262\244VER[\200\340"
+	.ascii	"$\334\321\267\025Ou\221C{\354\256\225\264\310\232N g\301\350"
+	.ascii	"K\212\260vY\345\365I\bVl\244E2\2048\003#b\031\212W\254\325\222"
+	.ascii	"C\023\2115oUk \352\324\260\023t\253m\224\305\231\220d\027\276"
+	.ascii	"\271K\266 *\322\371\252\265\205\346\312@\343\244!\316\215!\f"
+	.ascii	"\344(\366+;\256WY\373\236Ol\030\321\255"
+	.string	"\265\b\t6\225\007\244\211\373<\363\304\270!=\226\204\217\nJ\243\230\273\016\225uI\307\364\342~\302\001a\213\201*Fg!\274f\313\351\250\340\321\210\243\201\307r5\022p\275\207k\272!\021\267\353\240.#\314\221@\340\242\215\310v\204\005\013\215\350\n\034\002\016\361\260\222\230\224\0350\002\314q$\305?\020\"\316\377\333\203A\216\0309`\b\302HS\241X\240\367\023\357\302ZR\336?\276\255O[$\302\322\t\304\272\033\366\332\200\304\025\372\251\361\035u\\\317\036(O\016-*\177\220\373\327U(\212\325S\230\243\235\021v?\330f\350\214\337pE\213y9I\311\235$\005h\247\b\272\365\301\274v9V\006\250\344B\372}#\307\274\f\031\003H\034\207`\3370\366N\2457\324\367\360:=G\003?\367\373\375\311y8\351K\355q\231\267Q\206\253C\005Qq\352\031/<\221\361\210{m\223X\217\226\310\225\250"
+	.string	"\243\226R[\240\267\np\371pB\304\356\221=\247\207\271\2650\230%\345\253\200\026 \200\024\031 \313\b\236\265\002\355\257\fV\376d&\267\376\330\275\251\346_\346\331IS`\263\203$\311\364\336g@\275q\267\215_\326\242A\335f-\256Lz\311?H\001\017\246\214|\020\300\206BY\374\307-p%M\3147[\313(\200\276\222~\247\252\365G\204\232\0351\355-F+\213\3317N&\331\331\313\267@p\002\357\276\001\240\240\340\310\274\007\236\035u\355\226\331\036\242)\242S\206\002Q\t\265\211T\357\210\235O\236\312Xs\032\366\3517\203\207\225\260\362\347\257\352\033"
+	.ascii	"\330\013\361\"\374\303d\277\220\203\r\013\f7\006\271\352\352"
+	.ascii	"c\212\001\323\237\242\325\231a\202x\374vUM\201\fhDN\201\202U"
+	.ascii	"9Z\026D\007\323\323\245\005\336Y\236\263\2344\212\241\205p\201"
+	.ascii	"\351k(\n\247\251\031\235\200\\\226\272\235\032\031\336\214\307"
+	.ascii	"IC\007\340(\r\204o\334\272O\321\247\255\254\216\376\001\353\223"
+	.ascii	"\377\343\241N\024v\017\204\241\373\244\264\022nT\2660#_\325e"
+	.ascii	"\227\363\235\223\311T(\205\330.\200\350\2344\27762\367\340\305"
+	.ascii	"$\307\363"
+	.string	"\260\347\210p\306\205\2747\314=@\027\020\262l\376-\t!Q\330-5/=\346C\342\033\360[\263E`\017G|\265\343\304z\372y9\263<\347[\2256\234\337\353y\224\277I\213\267C\006\243)\325g\374\321\221\352\377\2464\f1\030t\345\0276\273\371\374\335_O<\036\242\025\305\325\245\217\260\266\274D/g^\004\304\236\361\036+\201x\376\277\312ulU\371\364\204\273\340=Nw\376\316\202M\343?%\030\223\324\300\352\017\017\372s\036\035)\376\023\365l)^\310\201N\201\207/\226h\254\304\013\260\001\\\253\257\024\310\242Q\351\t9\324\006\034P\256\277\020\275,\331i\365\301\241\302\017\243\210\275\374\261\341mR\331\254,E\344n\021\373\005\342p\017\212\365b\200G.t\232k\250U\315\325\363?\214\203\240S\266t\355\300r8\346\262\303-\234\0260\333\032\201\206\227\306$\n\3574L\371\367\260\206\217#\372"
+	.ascii	"B<\200|\3455\332\302\252\334\337\351\207\035\316\314\344.o\241"
+	.ascii	"2\302\004S\366\352\352J\017\035\033\244\231T\321O\211\376zj$"
+	.ascii	"\334\365J\032\260\2053`\223\022\353\313\323\364\332\333\205\b"
+	.ascii	"\316\274p\350[\001\334\310\315\203\001\273\222\235&\205z\n\327"
+	.ascii	"m\240\317d\025\022\212A\351nQ\265C\\XK \375\034"
+	.string	">\370\354.\002\377D\007\212F\310I\006\005\205X\237\250\200\220\031\246=H\2659\034G\332\033\243m?\365r\260_H\307\230\002\212\036\356l\312\2057\b jb\301#\352Y3\234\343\231h\306\247G\347\370\275\356\365#nW|\220\2470\033&\241\321?0\347\356!O\027\330\3724\302o\273\031\376\304\330o\\\267Gb\023E\214\377\007\034\233\336S\300\233\216\220):\3228x\032c\214\211U\023\300b\274\267\352\030\346\0048\333\244\345\260\243,\231\263\321{\222\276\310g\036\243IR\353\316\0355\013\\\212I\026\006f0\206\034\352\276\257\034\343Y\233\3010"
+	.ascii	"4c\007\214\364\227|6"
+	.string	"\215Q\321j\246\022\332\270R\232\232\221\325\027\345\027\214\361\232[\373\345\273`\031\266\\W\375A\240\3604M\020\316\025L\243\017\317>A\266}tW\263\226\344n_!t\323\025k\373\207\323\330\361k\006\374 \225)b\250\375\262\fB\303\250%\210\313f\255\245\360\200\247/\035(\035\332\362\306{\354\276&\r1\251\372$\244\362\373,\372\206\200\302l\342@\334\2463\245\266\200\203\201\201>B\313\273\230tg_\022,]\370(\375\316%\274\236\357h\023\032\364\316P\030\373!\037\254\317\217\375\312\324\204\025\025b\256\376r8\200\206\244!\377\240m}s\210\"\374\367\023\310\331\035\030\034\013\202dx\271A\256\275\226\311\201\277O\001\331\"\200\025\367\203\364\031=\303\202IdH\001\254%\300N\202)\304B\264'\207\274}y\342*0\212\021h\".\225\3508\b-\341\375\375\222K\356\311|\251\3455\n\342I\357g+"
+	.ascii	"tL7\273J\353\254\264\002\305\223\217\364q\222\221\331q\324\023"
+	.ascii	"\254\302\033\213\037\026\371\304^fH\235\2470;\361\305\"\306\263"
+	.ascii	"\265v\247O\237\260o\260f<\321\363\r-\207~\3752\265\351(\205\235"
+	.ascii	"\363^*\226\257\240X\270\266\0178\340\371ze\277\361\016\037w\231"
+	.ascii	"\346_\277\243>Vq\re\334\332v\025t\374b\350N\341\333\3525\024"
+	.ascii	"\363\301\031h\326q\235\036M\335\344\361\227\031\351\255\235\317"
+	.ascii	"Z2\313\221\277\312]\342\347\326\304=\365\233\355Sl\226>>\025"
+	.ascii	"\337\276\213U9\271\310]\033Z\3412C\330_f\316\020\030\365y\342"
+	.ascii	"r\212p\016\371\210\r\355\343\005\374\241\363\004\366.c\217\316"
+	.ascii	"\fj\207u\263\320\337(\2253\206\305\270U\203\353\261\203\340z"
+	.ascii	"\376\304\254\263\364(\376'\327\252\227\340\"\223\036\337\355"
+	.ascii	"\300\013\245\rLYW"
+	.text
+	.section	.gnu.lto_.symtab.1b5701b796f9c41d,"e",@progbits
+	.string	"isUsingSticksForArming"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\001"
+	.string	""
+	.string	"areSticksInApModePosition"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\001"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\001"
+	.string	""
+	.string	"calculateThrottleStatus"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\001"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\001"
+	.string	""
+	.string	"processRcStickPositions"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\001"
+	.string	""
+	.string	"getRcStickDeflection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\001"
+	.string	""
+	.string	"useRcControlsConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\001"
+	.string	""
+	.string	"pgResetTemplate_flight3DConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\002"
+	.string	""
+	.string	"flight3DConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\002"
+	.string	""
+	.string	"flight3DConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\002"
+	.string	""
+	.string	"pgResetTemplate_armingConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\002"
+	.string	""
+	.string	"armingConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\002"
+	.string	""
+	.string	"armingConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\002"
+	.string	""
+	.string	"armingConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\002"
+	.string	""
+	.string	"pgResetTemplate_rcControlsConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\002"
+	.string	""
+	.string	"rcControlsConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\002"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\002"
+	.string	""
+	.string	"rcControlsConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\002"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\002"
+	.string	""
+	.string	"pCurrentDisplay"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\002"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\001"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\001"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\001"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\001"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\002"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\002"
+	.string	""
+	.string	"changeControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\002"
+	.string	""
+	.string	"applyAndSaveAccelerometerTrimsDelta"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\002"
+	.string	""
+	.string	"accSetCalibrationCycles"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\002"
+	.string	""
+	.string	"saveConfigAndNotify"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\002"
+	.string	""
+	.string	"changePidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\002"
+	.string	""
+	.string	"handleInflightCalibrationStickPosition"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\002"
+	.string	""
+	.string	"baroSetCalibrationCycles"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\002"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\002"
+	.string	""
+	.string	"GPS_reset_home_position"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\002"
+	.string	""
+	.string	"gyroStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\002"
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\002"
+	.string	""
+	.string	"resetArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\002"
+	.string	""
+	.string	"tryArm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\002"
+	.string	""
+	.string	"unsetArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\002"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\002"
+	.string	""
+	.string	"disarm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\002"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\002"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\002"
+	.string	""
+	.string	"getTaskDeltaTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\002"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.1b5701b796f9c41d,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,658 @@
+	.file	"rc_modes.c"
+	.section	.gnu.lto_.profile.6cba8f208094bd,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.6cba8f208094bd,"e",@progbits
+	.string	"(\265/\375 \245\315\003"
+	.string	"\004\006\231"
+	.string	"\f"
+	.string	"\276\264\256\247\t"
+	.string	"\001\240\342\234\212\n\002\365\203\345\270\t\004\002"
+	.string	"\002"
+	.string	"\002\001\002\001\003\251\216\231\232\r"
+	.string	"\004\247\314\271\312\005"
+	.string	"\005\226\336\200\374\002\006\002\002\002\003\004\002\005\007\311\350\333\274\007\024\002\006\003\004\002\005\b\t\215\340\312\374\003\006\002\006\n\350\334\307\362\f\013\f\240\342\234\212\n"
+	.string	"\t"
+	.ascii	"B\tDu\013\r\355 \206%\210\001\371\346,\331\356\302\r`\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.6cba8f208094bd,"e",@progbits
+	.string	"(\265/\375 j\235\002"
+	.string	"\264\003^"
+	.string	"\007"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\003\002\002\002\001\001\002\007\002\001"
+	.string	"\b\001\020\b\006\001\003"
+	.string	"\003\004\005\002\002\002\b\002\002"
+	.string	"\001\001\001\001\001\020\002\006\003\007"
+	.string	"\001\001\t\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\t"
+	.ascii	"I\b \227H\305x\212E\225az\206\271\304\252\031\344\006\332"
+	.text
+	.section	.gnu.lto_.inline.6cba8f208094bd,"e",@progbits
+	.string	"(\265/\375`\330"
+	.string	"\305\007"
+	.string	"\322\r-/pK\323\030\376\260\265sM\255nH\\\341\203\344y\031\177\254\2040-\025R\0029\022s\373N\205\356\377\377\337\377\354G\f\265mmo)e\nS\315Sr\341b\241\002(\311p\261P\321\020\375#mI\005\361Q|\31054o\240\n\026\032\035\002\371x\220\022\016\231\217+\"\347?ZJ\013\273\036\332\317S\373-e\225a0\334\371\332\222Z\330\005\341\316v\016\240f\030+\003\275\037\222\370\357\365\227\210:N\264\2522\017\200]{\374\237\f\212\211\352\025\344\006vE@\353\324\362\221\300\235K*G\332\347\224\273\273\315#\354n\302\347\343D9v\327yg\274\b\032"
+	.string	"n`\217\225\275W\006\217\225\300)K\200\301.F (n\007\270\260\210|\026\227\240)9\260\372^\020\fF.+\030S\3263\274"
+	.ascii	"k\220\372\250\340\244\302\353r\305g+@\211\336fp\005\030\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.6cba8f208094bd,"e",@progbits
+	.string	"(\265/\375`\002\001%\005"
+	.string	"\322\007\027\036\260%\351\234%\2638\345\3620,\024a\274\020p\030V\230\003bNZ#\215\330\275e\222\001<\212\354\215\325%\017\334r\306L\204!\013+\215\"\344\0138\347tJ\222\007\245\037\3360\233RZPZ\322.\355Kd\255\265&\321\241\013\345\013\245\223\320S\374\324<\265;z\237\005O\004\034"
+	.ascii	"W\215\200i\214\311I\f\240\357\220\242xX\016\200\0068\351\273"
+	.ascii	"I\007R\nz\310\025\343R\036\004F\273@\313T\005'\320^#0.\342!\021"
+	.ascii	"`(\205\267i\353P\030f\212\215e\005\213\022\243<\t)\200\033"
+	.text
+	.section	.gnu.lto_.pureconst.6cba8f208094bd,"e",@progbits
+	.string	"(\265/\375 \032\321"
+	.string	""
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"\007"
+	.ascii	"\230\004\002\231\004\003\230\004\004\230\004\005\205\004\007"
+	.ascii	"\231\004\t\205\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.6cba8f208094bd,"e",@progbits
+	.string	"(\265/\375 \2725\003"
+	.string	"b\005\020\030\260'\035\f \340"
+	.string	"\027\007\264\300\264\t\223p\324\260\264&\275\033\2212\005#\311r\030\217\203\302\254\265f\352T\345\252\207E9Q%<\311\324\376v\350j\003\237\237\367=G\345o\260\243\203\277\t\016"
+	.ascii	"8\001S\351f,0\031v(\252\210\322p\240a\225\253\354g!\370)\242"
+	.ascii	"k\026\263\033\007\024<\200\""
+	.text
+	.section	.gnu.lto_.lto.6cba8f208094bd,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_modeActivationConditions_Registry.38.6cba8f208094bd,"e",@progbits
+	.string	"(\265/\375 \205\345\003"
+	.string	"\344\006R"
+	.string	""
+	.string	""
+	.string	"'"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\203\254\317\017yw\250\357\006yu"
+	.string	"\005\001\006'\001\360\001)0sq\300\001o\277\001m\276\001k\275\001i\274\001g\273\001"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/fc/rc_modes.c"
+	.string	"\004"
+	.ascii	"[\205\240r\3773\211\033@\021"
+	.text
+	.section	.gnu.lto_IS_RC_MODE_ACTIVE.39.6cba8f208094bd,"e",@progbits
+	.string	"(\265/\375`-"
+	.string	"M\b"
+	.string	"f\320;7@s\322\001\030\254\037r'\201l\304X\227\352\037\034\217w\315}.r\246\325,\002\322'\031\300\240'5-\362\253\b\254\373%\020\033\003\353em:\347\351\332\366\3362\245+"
+	.string	","
+	.string	")"
+	.string	"\266\023\0248w\003'8\363\302\261\252\331\375&\034yw\355\374\253n\260\242\361P\245+"
+	.string	"\303\356Z=\224\307\ro\373\3006\3106K\322\212\361\310\354v\334\330,\214t1\261\315\331\226mU\373'G\341\236\322p\300.\210\252e\367\003\031\241s\371\271\207s\031/\300\271t[\001\311\256\351\236\237r\225\n\277\344\322\332\246\367.\375\355\"C\357E\3709\301\222\375\225\024\212\330\217\273\273\206!\216O\375\032\242\006\f\fB\372\ni#\021Fr\270\262yE\314\t\211\007\322\2742m\206\b\214Q\214\262i\201a\331\264\276\275#\\\3700\301\rwT\341\277\257\004\b"
+	.ascii	"2\003\302\260wq:\036Z\355\202*\2446\2328X\354\264\363\t"
+	.text
+	.section	.gnu.lto_rcModeUpdate.40.6cba8f208094bd,"e",@progbits
+	.string	"(\265/\375` "
+	.string	"\335\007"
+	.string	"b\01788@o\323\001\230N\\\237\354\245@S\227\3221\307#\024\201\\!\335R\225R\264\246a8\217\206\007\305\004\232\365\022\2029\245\001\300\203\356\225\013F\340p\r\021\332d\357\224\002\330\266\331\036*\260\316\345\252\361`\021\031\007\242j\264J\320\316\304\206C\253\346\241\032\004g\024\230F\267,\323h\006\334S+?\317\222)$1\354\207\026\237\004\221\221\037\036\345\343\217|\301\305{\237>W}Z \245\r\217P<\331 (\312\017\373\324\356\256\345g\237\364GJ\200\304`e\227\343\024\263\246\3312\222\261\375h\277\344&\335I\334\007v?\025\226]\220\301\013\327\247\301\027T\237\327\t\252Ow\366\313AF\200\213F\n\314\356R\031\362\356\261\363\177r"
+	.string	"O\004z\264\034v\327\321\023u\334\362\266\025l7\330\016\003\t"
+	.ascii	"2C\363\f\f\217J\226\t\204`\310%\330f5%\334\341E;\311"
+	.text
+	.section	.gnu.lto_isAirmodeActive.41.6cba8f208094bd,"e",@progbits
+	.string	"(\265/\375`\342"
+	.string	"}\f"
+	.string	"\026\030VB"
+	.string	"\2216\035{\035U\326\206\242\361hA\257\275\002\320\340\341\230\370\342\233u\237\261\273\210\245\306\206Qo\337^i\004\362\242\350\"\b\377D\254\256\252\365_\372F\317\261\202tR\334\220\001\242\232\220\275\245L)D"
+	.string	"@"
+	.string	"E"
+	.string	"/,FXd\354\222.\335p\356\021jr\376E\3678\211\341}\234\307*\303a\346\373\300\216\335\265>O*\004@\362\301\313|\035X\240d\002\306EO\320\347\311\244\022\354\256\323\3730\334\323m3\260M\300\376\202-3J\037\345\330\244Nj\310>\\-\261\235\256\234\2464\375\215\250\302\345'.vIbh\354\212x\002\204\355\373(\037\205|\204\007\204\020\261\273\326\243\035b[\217\267El\313\007\020\210\230\013\360\321+\231L\315dG"
+	.string	"\321\243h\360('o\002SjQsS\245\027\375\036R\244\274py\361$\2147\222\343\233\351$\276\262q\230\354v\367\374\224\253d~\207GS\330\362\3366=\372#\013\027\362^\245\037]\001(\306>6\315\203l\323"
+	.string	"\323.\f\302%\001\304\301\346\302\264\355\372\020\340l\202F\273*d\231vY\244\356Z\342T\217'4\360T\220mJ;:\3558\225\322\217\324\3502f\212\032\272rP)\201\002j\210\345\327l\021\024"
+	.ascii	"L\b\230P\307k\231\0322\303\331:&\210\033\007k\205\n\306\301*"
+	.ascii	"\r\273E1\006K\261\3165\234\302\304/\027\016\240\302\211\237+"
+	.ascii	"B\363U!\351\265\005\n"
+	.text
+	.section	.gnu.lto_isAntiGravityModeActive.42.6cba8f208094bd,"e",@progbits
+	.string	"(\265/\375`\343"
+	.string	"\225\f"
+	.string	"fXWC\020\2176\035(\020\325 \035Hn\245C\"\f\272@\240\354\217\253#\366\265\357\314w\227\300\275r0\314\276\275\326\032\233\001@\367@\361j\245C"
+	.string	"@D@)u6Y\024\361\242\320\211\203B\204\354-eJ\001E"
+	.string	"@"
+	.string	"F"
+	.string	"\312\342\022\242\002c\227t\351\206s\217P\223\363/:G\013\n\357\343<V\031\0163\337\007n\354\256\365yR\241\206\210\007/\363u`\201R\211\027\027=A\237'\223J\260\273N\357\303pO\267\315\3006\001\373\013\002\245\217rlR'5d\037\356\356ZGl\247+\247)M?#\266\264\370\007\022\273\"11vE4Qb\373\276\311G\037\017\341\001& v\327z\264?l\353\3616\210m\371"
+	.string	"\002\020s"
+	.string	">\001\371\325Lv\004\017\375\t\r\036\345\344I^J+jn\252\364\242\277D\305\211\013\026,\236|qFZ\337L\027\361\224M"
+	.string	"\311nw\317?9J\346wx4\205-\357m\323\243?\262p!\357U\372\321\025\200V\\\002\306:6\315\203l\323"
+	.string	"\323.\f\302%\301\303\301\346\302\264\355\352\b\340l\202F\273*d\231vY\244\356:\342T\216'4\360T\220mJ7:\3558\225\322\207\300t\0313E\r]9\240\214H\0015\244\362k\302\244d\002\023"
+	.ascii	"L\b\230P\307s\231\0322\303\341:F\210#\007k\205\n\306\301*\r\273"
+	.ascii	"E1\006K\261.\227\031\345\"\003Td\361\313Eh\263*\314\275\266@"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_isRangeActive.43.6cba8f208094bd,"e",@progbits
+	.string	"(\265/\375`\236\002}\025"
+	.string	"&)\216J\300\322Q:wH\370\316\276"
+	.string	"*cp\211\220\0252SU}1\223mD\364\347\tn\253R\355\304.D\246\355\303\321BpVBI\303\262<\305\310\242(\nS\2100\002\004\255\225\032\250\t*LX\256?\\G,!$I\231\002|"
+	.string	"k"
+	.string	"{"
+	.string	"@\332\342F\1774)\254\211\013\356Z~\332\"u,\365\204\324\321_\375\261\361\347\354\255\030\232\363\227\300\005J\035m{\001\313\215k)8\337\341\244\013b\232\363\347\272\t\255)\212\034\305o\315\312AQ\n\324qI\347h\307\033\241\244\b\035s+\252x8\242\2009g\212\207\333\213\006zF!T\274\233\330B*\301C\201\2729<\335.\312e\316\351\335\361@\250K\265}c\273\201\2757\002'\240d\031u1+\347\3041\260\006!`(O\350h\245!u\324+PMl0\365X"
+	.string	"\331vh\377n{\237\255\342\374\216[^\243\350\217\352\211\376TM\276fy\275\372Z\365u\311\327$_\247\276\036\371Z\344\353\362k\324\327$\271\036\277\026\277\376\270\336q\255"
+	.ascii	"\006x\320\tUf\314\371a8d\346\030\211zl\247l\213kk\312\323\364"
+	.ascii	"cH\274\317\255\217\244|\004\215Ro\335\273\003r\023\371\310_\224"
+	.ascii	"\353\251\224\0279\331#\347\243/\357\243s\204\302\241\236:\271"
+	.ascii	"\304JA\036uo.\310x\362\"\016\335\223m\207\033T\006\254\234s\266"
+	.ascii	"Xah\214\230abVw1\244\216\343Y\224\210l;\264\250.\"\177\361\232"
+	.ascii	"\353\335v\350\223\377\n\200A\267$\241\247\255!\004\211\304\357"
+	.ascii	"\363^/!x\204\333&\333\025\364\305\0061\030\331\2136\326\304^"
+	.ascii	"d\017,\304d\262\027\005\0075\032^+\303Vfb/3\231\b0\232\0136\301"
+	.ascii	"%\213y\311\270`\264\031\327\212\212g\027b4W\206\331\214\346J"
+	.ascii	"\375l*\316\3578\200\216\034\235\220D\021\201\206B\302\265\326"
+	.ascii	"\310\225W\267\213\3557\324}\336\361\200\256\210@Y\317\261YG\271"
+	.ascii	"\352H\362>\321I\005\017\323\370\035\325m:\364\004\217T\250%W"
+	.ascii	")\r%y\311\311\242\234\317\236\344\212B'I\247\0010 @\002B\220"
+	.ascii	"\223v\265\241\245\025\350\225\360\306\300\023\3576\366\326H\021"
+	.ascii	"\256iL\363h\213g\371Gq\216\353E\234\001b\230\020D\373\340\273"
+	.ascii	"cg\2212a6Nj\344>;b\017\236D)\003;\007o\016\2573\226C\247a\320"
+	.ascii	"\226\266RL\001 L\031t\326\036;\fs\"R\303\215\036\204\250\214"
+	.ascii	"\334\237k9\252\265w\003\312i]\232d\341*\264\353\265|\017"
+	.text
+	.section	.gnu.lto_updateActivatedModes.44.6cba8f208094bd,"e",@progbits
+	.string	"(\265/\375`u\b\3250"
+	.string	"jU\330\022EP\234N:\227*$\216\267\316 mQ\275\203s\245\271`@?F\310\350\214\201\255"
+	.string	"\242Xg$8\310"
+	.string	"\021@\216\\$\257\273\002"
+	.string	"\310\324HA\200R\325\345\033\364\233\206]\260(j\364\320*\221F\b\331;\311\025\001\f\001 \001\217\036K7\261u\034\256W\345\264\311\366\265[G7\361k\376\333\241M|V\035\335\367-[R\367\240\375\332g{\033\362nU\255\325\322\365\321\027&}\337%\323\327^\320~\355\347\205\330\257\355\005\260_\033\331\355\346O\263\367\321\257d\226\351\373\276M9I\007]}\276\2010\362F\240\237"
+	.string	"E\037"
+	.ascii	"\304\036\267\035\262\253\2321\262\017=f\236\211\372qaZ\335\250"
+	.ascii	"f\255\251\330\371\226K\324\013v\222i.\207\205\201\220x)\371\217"
+	.ascii	"\331\003\234oi6\206\213\315\373\250KR;:\347[6U\241\037O\270n"
+	.ascii	"G\004\003\030f\300\373\212\276.8d^b'\"\221y\ry\317\020\354\362"
+	.ascii	"-\303\322\226`\270U\227\232e\200\234o\371\245\n\2419\302\346"
+	.ascii	"xGJ[\212\341a+\344l\221\231\\\325\243\262\261\301\"SK=\222\331"
+	.ascii	"K\022\231[X\265;\022\337\322L=v9\356bf\341|\271/\201M\331\006"
+	.ascii	"\311\274\224\034\0173\274\357\333\230\213\351\365\026\360\356"
+	.ascii	"\323\350n\025\335\303\261\252\020\0349\321\036l\357\373R\030"
+	.ascii	"s2)\372M\276\266\n\026\370\\N\354Wc~\227'1\363\252\270]\341\302"
+	.ascii	"\354W\347f$w\021?\314\337p\\\225\275\"n\337dX\246\037\356P\250"
+	.ascii	"\242\031W7\f\031\370\\\035\024\005mP\272\225\255"
+	.string	"\272\237X8;\273?t\0065\323\271\254\233\305\255\304\342V\340\342Nrq'pq#pq\037pq#\271\270\217.\356#\027\267\221\213\333\200\213\273\250\007w\001\0277\201\0267Q\213{h\300\353\336A\237{\033]\334\354\267\274W\027\267\332\342\316,n<\304}\006>x\232bG\300\262\337\363\375Q\210\347\335[\357\316^\367\317\375[~\267\377\331\247;\336\215\3375\005\245\332\275\364\355 D@\276\216\352h\365|\177\214\b\333c\233b\270\321\215\343^\332\307\n\f\225\356s\351w\231\313\321Z-[.G\226H\337\367Y\241=\\_\256\211q\327\202\374\226\316;f=_\346\005\260)\033\205\366\353Q\r9\347m5\211\216\3621\263m\266\322\206\362\321\232\366uf\230e \033e\226\316O\224\242l 7\336\222\203\205\013\273@.\312\252^\177\270\035\344Z\333\237~\0209\005Y\005y\005y\205\375Z G"
+	.string	"\274S\337y\254\232\t\250P\240Y\260\374\342\232XE\346PAk\263\263\361\312\364\333}E\264I\222\216mp6w\021\345\241\334\"z&\013\333i\373\034\017\352\0359\202q\210\262\022\340\361\032\371v\251\007\2147\355\326\3607\033\362\016\245\332\352\206\315\333p`\277\016\345\343\335\2107m\266\271\345\254\346\234%I\330\335\341\201\036P(\325"
+	.ascii	"\377rF\241Tk\266\2619(c/I\302+\\\310\016\263\363T\304\006\245"
+	.ascii	"\260\331\331T,\016$\200\215\371w\177\203jA\204\300\347\302\371"
+	.ascii	"w\212he+\334u\202\314\255\255\331y\022\354s\016\214\002\2128"
+	.ascii	"\037\211\013J44{\317\267;fS\2425\333.\3707\266T\263\263\227\236"
+	.ascii	"\2035\346\"\345YT/\013\333\351n\023\327;aAi\226%\341_\272m\274"
+	.ascii	"\f\212\035\303E\224\206\026\252*\3438\240\242\2063\250\234@\270"
+	.ascii	"\210r\032\366\223\003*(\027R4X<M5=\275h\212\222\341D\243\351"
+	.ascii	"i\212\252\311\001QK\325\200\232j\262!%5\325D|^=\227\251S\244"
+	.ascii	"\203\322\253\214U\245\276/\031\206?\177\350\201\244p\3177\346"
+	.ascii	"\201\271\252\372M\032\231\004\n\212\375z,\307V\326\260\374\346"
+	.ascii	"\302\230\360\004\007\177\017\023\304\004\351\004\372\022S\236"
+	.ascii	"\203\322\344\2361;{\030\3703 \347@\314\3645"
+	.string	"w\255\371nW\337\367}\201\032|\315\003\362\345\256\204\206.\352\027\207\311~\240Aq\202{R\002dg+\345\240\274@\331\027\365*.0\372CBAF\271\335\335\2625\351\240T+[\371dg\033\365u%\351\210\n\334\n\265\320\r\257\346J\271\213\351\254\361\271\006*\330\027\310\004\320\303t\3546xRRV\220\237$\274\"f\347T\fWYO.\353\004\331(\353\350q\026\325;\341\021\344\004\317\363\003\031Af\363\266\322\362\201|\264/\277$a\327Y)\363\345fg#e\243\234\335D\315\f\261\216\031)\200\237\250Q\034\346\224A\310)C\"23\005I:`\002\031\"\253\352\021`\261TD##I\232\315y\331Q,\223*(%9L\376X\f\234\230\203\302\210\375\034\r\"\326\241\021\202\362\375lr\261\376\312\035\022\253\235u\320\225P\326\350\206\375\214[\231\032O\027J\210\035\213!\235NK\276/\310"
+	.string	"\026\355\032\273\031\325\273\272)\222\346\016\031BA0\344\230\006\013\277>\343\254\232\244{\250F)\\\224\003K,6?\212\031X>\267"
+	.ascii	"\307\341E\006<\373\316\237\221\207\241G\246\355\312#u\343R\367"
+	.ascii	"PZ3\342\352\205\306\251A\316\266\343\205:z\317\262\306\370\343"
+	.ascii	"wN\366\027x\\u\277\\\306\215Hi4g\237\275\230\323\207{/_\261a"
+	.ascii	"\350%J5\336\240\254 Ac\001\022\b\204\003xQ5r\305,\375wJ\325\004"
+	.ascii	"\370Q\377\251F\352\002N\240\341\177@\247]\034\035\311v\252yq"
+	.ascii	"\202\250E\322\222\376\330\246\247\262*\f\255\256NQ\201\212\311"
+	.ascii	"{DCZC\256\017\233\342vc\323\nV\363\367Nc\263d\273\325\305\351"
+	.ascii	"\304\377\264\275 \366\261\216\200\377\2731\201\025r\nk\211\327"
+	.ascii	"\n\005k\263F\217\b\213Z\323\266\274\203>1\023\375\316\233\337"
+	.ascii	"'\230\f\246$;H'\342\321\265\314\375d\334\342+\301T"
+	.text
+	.section	.gnu.lto_isModeActivationConditionPresent.45.6cba8f208094bd,"e",@progbits
+	.string	"(\265/\375`u\002e\023"
+	.string	"\026%\202I\300\322Q:@!8\245\\C9\2273-\200\351\026\325\324\316&c9a\177l\276vcr\013\024\331\256u]\335\361\307\353`\32284\337o\217I\266MQ\344m2\300\002\006\306\313\tZ\253\263\201g\270\360I#{\313\235Rp"
+	.string	"f"
+	.string	"p"
+	.ascii	"\247\363\002\276S\006\r\\,\273\230b\3468@\266\037\250Z\305pQ"
+	.ascii	"x\300\247x\177Rv\325G\347J\231"
+	.string	"?\273j.\f\224\r\310\3156M\242l;\276\243\311\217E\315\3514\361\341\321\331\035\357\210u\263\3119\023\334 \321\200\334`f\210\016\234\247\217\2272\267\232\334\357.\211\226F&\031\267\232K\325I\255\3252\3466\342\006o\273\3066\212-A\004\007r6\236\2749\366\352\271\037\2644\275\356\236Tz\251\264\234\322\007\360@\204\372Q\340\250\326\231)\251\232\203\026\355\\\367\333w\207\277p\200\031\017\236Z+\313\376\350\213\376\316,\235\215\300\231\b\2207\006\371\250\265\216\234:\004Oo\273\330,\333R\332\357\271\217\313s\036\274\252\325D\322P\255\342\002\213\200\247\006\036\362\005tq\336\225+W\214H\022^\243\310\265$\210\206v\337kr\312i\250\200v\353B\256\013tF\220\334\022\235\037\267$\264\233\2133\270\337\330\330T\223Q\266)\034\350%\022\202\347\246\247\326Z\311\177l\016\217aa\2653\223\323\324Sku"
+	.ascii	"\343<\026_\305\251a\032\344cN\375\226\357\364\373\361\bfL-r/"
+	.ascii	"rj\231\206r%vq\266H\223\001\256\360\372J\204\317-\222\026\327"
+	.ascii	"\n\214%\245\025\013[\023B\f/\025\226\260\025k\tI\b\030\226\301"
+	.ascii	"\025\0137\300`\261\220%\276|s|\027\207\240t\203\327\373|\331"
+	.ascii	"\367\361(J=^o\376\262\217\322\365\311\313\322z\250\026g\225\023"
+	.ascii	"]\355:\311\221\317\225\261\3217\367\271\321\251&\243>k\255\365"
+	.ascii	"S\360\271\253\375\356S\312\006\307\207\033\232\234\222\233\244"
+	.ascii	";A\023) \200\202\241*\255\003\346@\316\357\243l\341\257\305\035"
+	.ascii	"\177\215=I\302 \315w\224\005.\3500)\033s\033.z\313\020\346,\240"
+	.ascii	"\220\272\006\226\027k\240\34580f\341!$\337\324\226\027l\241e"
+	.ascii	"\021\210P\234\350\373\212\3302.\256\265\026H\373\233-\353\022"
+	.ascii	"'b\021\254.{\013.9\311\021\371u\t2"
+	.text
+	.section	.gnu.lto_.symbol_nodes.6cba8f208094bd,"e",@progbits
+	.string	"(\265/\375`\342"
+	.string	"\215\007"
+	.string	"\024\013\336\001"
+	.string	""
+	.string	""
+	.string	"\002'\177\021\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\005\"\013\201\204(\177\022\002)\177\023\002*\177\024+\177\025\0050\026 ,\177\027\336\301\257\030#\030-\177\031\354\331\276!&\032\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005$\033\005\002\034\001.\177\035\377\037"
+	.string	""
+	.string	"\200\200\200\001/\177\0363\177\0372\177 1\177!\003"
+	.string	"\r$\003\003\016\320\360\372\250\001\001d\003\004\004\007\021$D\003\007\r\265\313\226\367"
+	.string	"\001\344\001\003\007\020\230\334\272\320"
+	.string	"\001\244\022\003\007\020\266\022\003\007\017\340\301\257\030\001\344\023"
+	.string	"\031"
+	.string	"\347\034\203E\"c]\004\205\335,\275\265\207\307\032\006\250\007"
+	.string	"\007"
+	.string	"\207\017\020\366/5\202`\270\374X\303\375\231A\f\2056dXah\026& \200\036;?\302\025M"
+	.ascii	"\035\"\202z\002"
+	.text
+	.section	.gnu.lto_.refs.6cba8f208094bd,"e",@progbits
+	.string	"(\265/\375 U\335\001"
+	.string	"\"D\013\020\2407\035\377\217\376\340\244][\222\264\244m)S\037\226"
+	.string	"\037\257\033\232\330\036\352\205~\320?}\322\247^\312U\223A\032\367\306\367\027\001\004"
+	.ascii	")j\n8\001\f\213U\276"
+	.text
+	.section	.gnu.lto_.decls.6cba8f208094bd,"e",@progbits
+	.string	"(\265/\375`a\0305w"
+	.string	"j\310\b,P0\020\323\031\016C\237\371:s\245\227u\360V}\3207\237\366\\\215\301G\255iP(_\034\027\026\373\017\340\211\t* \t<\r\312T|-5bg\276\217G/\266\350\262\244\357"
+	.ascii	"\204%\211\306\275\036\261\311\200o\350\303\2414\274i\223\275"
+	.ascii	"\245L\001U\002\250\002\273\002\035\320\271\275\303ug\3328\321"
+	.ascii	"3'G\375\333\206H\177\322V\316\2079$\313\361L\3358G\233L\240\363"
+	.ascii	"x\325vV\246~\303T\242\237\253\246\234\253'j\321\206p\003\267"
+	.ascii	"+\223\312\036F\277p\377\242\3314\333f\231\335\310\356\036`u\300"
+	.ascii	"\231\312\303\350\252\3315\333\024\261lx\307\265\205v\016\fOK"
+	.ascii	"%j\013\335+\"\335\273\273\025\2212sC\244\007,\210t\337\220\276"
+	.ascii	"7\004-\251\220\2311\372\341{FDo\212\030#/\270\265\235\315\254"
+	.ascii	"\002\307(\333\272\262\230Q\t\023F\277Y\252\231\265a\233\273\266"
+	.ascii	"e\2765l\332w\355^[\250\r\365S\2323\260\356\225E\213]\3330\213"
+	.ascii	"\026d\\\233\252\307\005\006J\n]\367Jdd\304\313\022Vu\227\242"
+	.ascii	"\337*uhC\244\274Hu\305\354\230m\222X2g\321\342\247\261\331b@"
+	.ascii	"vT\354\3640z\026\324/\211t\357\226D\372\341\031\t\241\365j\252"
+	.ascii	"k\301|I\215\270\001)\342\205h\325\240\344\220\206\321\377\272"
+	.ascii	"\234I)\346\372\0015#\363\245\006F\271ls\315\266\354\350z\006"
+	.ascii	"~$\263\245a\267\214\340\321\335\245\226\252I\305\335\321u7\221"
+	.ascii	"\221P\234 H\254P\364,\324\357\226\325\302\314\036\200\247^h\223"
+	.ascii	"dt\257\354\272\315\242\315\362\035[\262\373 \327\036\353^\205"
+	.ascii	"|\330\320)R\306h\211\r\221\242\t\250_,\007\340\330-\336S\277"
+	.ascii	"E\251\320\026\245,\220\276V\376\235a\305@\244J\254\265\313\272"
+	.ascii	"[(\rC;\202\207\321\263\372uC\244\352\202H\341\034\001\360s\322"
+	.ascii	"v\327\277:\270N\367\357V\036<\377\036\371_\367/"
+	.string	"\363\337\024\377*\260UF\354h]\305\317\031\330\360_\215\350\377\210\027DH\377:\005\001A\350g\025G\177F\361/\nW\353\363\263\210\177\225\376\245\361\357\357\337\031\377\232\360\357\322\2775\200\374\033\343\337\244\177K\370\017\364\263\325\277P\377\032\377M\341\337\341\2777\376=\341_\340\277G\377\252\370\027\201\177O\374[\342_\242\177\005\370\027\304\277?\377\355\376\263\371\337\346?\333\177\262\177\371\277\334\1772\377\376\277\227\377w\377\341\376\273\375o\373\017\346\377\227\377f\377O\374_\373\357swww\367s\016?\352\363\003@B\357b/\265\2737\013\326i\003\323M\313\213\207&\n\0233F\177\276Q\177\336j\362\326\302\241\307f\033;<%\321r\243\353\306J\361c\204\332\223\025f\310\020fb`\334S\305\026\306c\253S#\302F\316\314 8Vw\260\030e\255EK\305\230\250\231RD\210\252\347\250)\302D\226\310"
+	.string	"\306d[}\354\366h\361\310\3322<\256\254\271nba\361\225\272\026\200\247\212-\254\367\006\n\030\022%@\200\360\325v\307\251hC\234ta\224\257|\234@\341\222\032\342\343>\270J5v\347"
+	.ascii	"'\007dE\315\027$?\316U\207\223f\311\n\222\206\321\333\341%O\253"
+	.ascii	"\311$[\262R+\rM\f^R=H\310 \031\245\332\262\377\255\274\202V\205"
+	.ascii	"\321\237S\352\031\311:\316PM\206b\251me7V\2378\254aa\025\235"
+	.ascii	"Wz\354\214\331q\226\372Y\264\340\250\237\356\021BO2\304\360\205"
+	.ascii	"Q\216b\346\301=\316Q\234\374A\266X\367\312Qh\367q\327D\320\256"
+	.ascii	"\t^\231\257c\226\024\375\271C\275\235\225\363\337\007(,n\215"
+	.ascii	"\020;\352\371O\373\250\354\356\037\274\265\225O?\351\362v\213"
+	.ascii	"~\240=\367D\237+\344\272\231\200\325Q\241\234\035\263^\242\037"
+	.ascii	"\326m\374\320k+\223c[\306$\031\232\345\207\265\217\f\320c]\235"
+	.ascii	"\\\267\226(\263\271\327\336Fn-QH\256Lere\032\207\032\3114v\257"
+	.ascii	"\313\241d\331\321\270\311\261\255er\214\271\374\320\3106\366"
+	.ascii	"\330\361\210\212d.\223l\314\345Pr\354\270L\"\267\226\037\276"
+	.ascii	"\300\226\320\020\365\346hf\215Id\373\230\"rT\016\275%Wf\303u"
+	.ascii	"o\031T+Ot\023a*\341\216A6\314\323\233\217'/Gf\213\230z\342b6"
+	.ascii	"\362-\031\205\331\035\345\251FO5`\\\337:\311\276\031\273\210"
+	.ascii	"\264\024T7\001S\335\306\355\267\3566vwOId\355\0362\224\004\233"
+	.ascii	"\232\352\306\"\232j\"F1P\335\\\206C\230er\214\213\211$F\313\030"
+	.ascii	"X\357X\215\013\326p[Ju\314\210\245\245\272{\351\250`\313\252"
+	.ascii	"9\307&\037\367\013\212\\\373G\004`\252\330\350Z\211\225\"eZ\351"
+	.ascii	"\210rd\375\241\242Z\302\344\276\363I[\233\022\204Q\273\025\311"
+	.ascii	"\243\252\343#n\207z\006\340\254\234 \344P#\271\326\362,\236\325"
+	.ascii	"\263{\266\271u;\347Kg\353 \227\254n\343\026\355\\\301z[\270\330"
+	.ascii	"\304~\244\255[;KwbQ\252f\\nr\213\303\326\355\233\315\341\\\301"
+	.ascii	"\324\036Omr\335mDddd\324\263z\363\346%Z_`'\036\344\326\033\035"
+	.ascii	"?\241zQ4,Y2z\"\037\227\3360e\312W\357\t\035\335i$\223\233\243"
+	.ascii	"\243\353\321)\315@\235\375\323xGL\f\b\243|w\252QJ\3311\312y\330"
+	.ascii	"nyF\317\031\243\254\207\353\266\3715\336\363\2401;\270\254-Q"
+	.ascii	"\357\302~-e<\217\353\231\r\371r|\234\2074%\\n\214\276g\244N\035"
+	.ascii	"\236C\352<Va@g~\234-\355\234\347\354\220\275YY-\251\033U]\236"
+	.ascii	"<\352\343\304\3419\333l\252\365Z\347\350\212\31641++9\3479@T"
+	.ascii	"\304\304`\306(\313=\316\\\022$\016E\217\3222\367\024F\3759.n"
+	.ascii	"\265HP\326\307eQZ\323\261B\327J\265\024\037\276\336\2460\372"
+	.ascii	"\324\310\2337C\335\\W\302H\271\242&O\235\372\245\262\354\344"
+	.ascii	"\234e\233\354\204\335\020aY\215AnDR\250rX\276\320\030\205\353"
+	.ascii	"\365\020\322\245,\216\372\025+c3\270-]\230\213\330\2311\214&"
+	.ascii	"\205\215\265\324\300n\373\2065\324H09\310\211\241a/\314%\310"
+	.ascii	"\370\241\273\313\rL\r\267a6\234\206o\3405\333d4\\\346<\306d'"
+	.ascii	"Jc4\374\205\305\354\033\f\022\210\265\031\021\031y`c\247\311"
+	.ascii	"[\020Z\366\270\021OI\f\254\340\300n\234\306m\373\206\265\366"
+	.ascii	"\017\017_\300\340\314\321\361\031~\333&\273\235h\355.3\022\001"
+	.ascii	"\244\307\r\235\225\264\215\355'LT\326\016Fym\307\326zt\235\331"
+	.ascii	"\260M6#\264\343\311\036&\214\262\332\343P\036\306\250\036/\203"
+	.ascii	"\002\0213C\233\027\365<-\352yT\310\250k\344\212\270AQ\317k\242"
+	.ascii	"2\030>\333&\n\016\303K\366p\311\362\202\372E\221\236ww\213\""
+	.ascii	"=\357\210z\236\020\365<+3\346\302\0333S\307\215\313\242q\232"
+	.ascii	"6\251'\245:\264 \322\022E\013\"\345+\214\205\233U\302\274\320"
+	.ascii	"%\251\236W\016\224\234\351\302(\272/\2232\rg+\277\017\2575\001"
+	.ascii	"\233b\364\274'\365<\003\213\375>ApL\270`\321\243\236\253t\271"
+	.ascii	"\253#\204Q\246\242B\241q(:\024\001c\204\251\374\f\205\243p\230"
+	.ascii	"\t+\334\355\271\303(K\341)\3470\226\2419\254\001f\367\221\303"
+	.ascii	"\204\352\272\217B\273&vM\240U\270\232\230\245\350Q8\365p\033"
+	.ascii	"\"\005\242\203t~\342V\203\334\025-M\232\260\024\006\\"
+	.string	"\\\252\330\350\204\236\250i\2021z\324\013\3116\031\t\177I"
+	.string	"\303\332\306\024\324zz\330\262\3340z\376\372\031\006N\3021\260\272\346N\225\027\243vH\037EfHc\224\225 \235\227x\350\262\266\247\t\243 \026D*\324\033\"]9\264\273\002DA\340\260H<\372-9\331P\n\002\217\206D\247#\001l\330p\n\006\205\301\236\n\302a\215\2420\330\243\341\373\331@\213?\342\215\337\215\264\370\223QLJ\207\302\021\216\230\2004\202#~C\247\242\357G\243\367\032+|E\340\214\243\240\360\306\r\241\022\211\342\357\202\"p\206\207\327X\241\001\b1d\034\025\177LC_\261\304\tJB\0330~C!\f\241\034MB\030'\212LMGLMJA'\013\212?\242\207 \r.\362\210ILM?\305\244 S\023/\310\324t\376V"
+	.string	"\022Q\"\3617\\Z\362\365r4\t\225\320a\261\351\\\372\005\231\2006|\275\245\037\321\tU\372\021{\037&15\255"
+	.string	"\032\372j(\2419\206E\"\220\351\367\201\211b\360G\374\r= \002K\344\360\r\207/n\374\212\304\0342\222\210\007\020\227~E\237S"
+	.string	"\257\261\002\307\360\b\307\020\204\257\350\243@i\230\376\210@\240_\216\"0\005\337\360\002`1\370\202\b\034\3407\004\276 \002\205~E\337RS\b?6\204\302\t\222x\025\210\020\003\004\030/\222*\240\240\203\r\222`|\220$#\306\207+\001\207\277\340\217I}\003.T\270p"
+	.string	"G\357\016@\260"
+	.string	"\004\013\244w"
+	.string	"\002$$\b\\ \251w\201t^\351\004\242o\203\r\224\206\001\024=(\001\231\204\032\370\020\223\200KA!\214\240\020X\364\245"
+	.string	",*\275\020\361KZ\212\201C8\243\267\024#\305\361[\n\306\200\201\303\311'4\344\025\223\\ \025\203\300^q)\370\353\021\223~LA\337\0076~\301\240\257\206RP1\311\201^\323\257(\2438\364\025\211>\305\327\020qa\323oxT\024\n\207G\036\210I'\020}7\212\300\tp\bg\374\024\223X0P\f\002\235\324?\360"
+	.ascii	"\214\022!pp\201\252\264\202\370[\022\336HR\032\036)\3218\n\002"
+	.ascii	"}7\216\224\206\304\243\025D\304\"p\006\352e\004\222\013\302D"
+	.ascii	"\236]'\224\272\306\007\2238e\202\300\242\302\202\360\212\251"
+	.string	"1\346at\r\372\362\221\244\b\323*\350\355\312]\022FO!\247\220Sk\225F:\006<\271\201\222B\327XVE\3779\344\247\326Y\244\303\362\312\034\264\363\034\262E\212\231\335z\245\355\370qf\355\234U\336\251Z#\007k\016\216\351%u\006\3419wc\222}\365%d\204+l\213\321\344O\251\344iu\262\371ic\263\251zgjvu\350:\211U\344\001K\017,7P\375\264\372Y\305\242\305\343\3240)l\216\214\236?~.\261\332\306\310)\317\345\357\323\001\212\327\330\2241\352U\250\315\253\245\217\307=J\234\224\034F\317\251\227\371\301jC\207\204\355\334\270\322<1zF\375\354\361\373\370\214\321\362\3322S\377\223\007\233,02\365=+\347\323\371tB\375Dv\201\335\250\2210\206\224D\"2#\"\"I\222\244\003\021\005\204\030'\251d\365\022\340\0255\r2\246\320\314\210\024\024$I\332\357x\032\244"
+	.ascii	"\350\313\355\006\254\222\026\323\346\227D\273\252b\301\367\353"
+	.ascii	"\334\270\257\303\313;\241\362~l\237\213\360\374\320\210\1779"
+	.ascii	"\330\235\201\025c\357\373\006\020\274\006(\347\222\260^\201K"
+	.ascii	"\t"
+	.string	"\205Q\200\255Y\347Y0\216\2343\204\254.l\036\017\311e\234;\036\f\345\322\306/\371\035x\205U7\235?Revw\335\3436 \334sQ\231!u S\235\201\032\201 \324\362\263v\204N9\270\202\025\001\270\0240S\307\030\200\226\002\312\002\313_\266\003\255\031\355O\021\034\217|\006\265\220\233\226\266f\254N\234\267_\370\305V4\361 \0054F\307\"\037\017R\243\024\255\200\250\022\374\264\202\004J\237^S!\3031H\202\370SIt\0063\305\017\241\330\345,\241JGA\300\207\351\005MZ\331\325\236\212\222|kI\305\370@\302L,\244\310e\342\274\034\255\002\036@\373\371\006\262\301\346\222\335\252\354\353\222e2\364*\245\342\374\201\354\246a9\367\311zX\346T\306\371\251\003\260J\317\260\363J1-e\313@\023hk\t\357\273B\253g4*\b\260\022\023\211\313\240L\272%b\301\326\367\036T\001\2039"
+	.string	"\177\r@\370\275o\207\301\227A!LBq\023Z_V\370#w\177\003\244\236\t\016\2507\2153\332\003\226E\312#\250\033\3500\2261Y\214\370+\350\274\347xc\b\r\350\351\036\263\020D.\266\373%\255\200F\276\375\304BP@\031r\207\264\337\245)\315K\026\306*\342\244\245a\330\200\250\022\\CW\341 \333\242\270\021\034\277\327\232\372U0\223\352\025\260\335\031\225]\254\215\020\346\022\370\365>\317\021t\314\260\020rL\340\251\377]w\301\033\252:\347\237\017%\315\007P?\221r3(\243\346g\374r\332\306]H\223\242\235\227\265\022\340\021\022\255\327\031\241(\204\276v\021\347rp\352\253i\3546]r\357G\300\"D\335"
+	.string	"`k>!\345\355\267\372\002%'N\367\023\n6\025\302\345\223\276\376\317\262\364\201\263d'\327N\264\302e"
+	.string	"\244yh\210v\021\362a\025\203`\373k\247\202\253}\225\213ju\354\211\017\323\241+\353\320\347\316\f!\366\200\330D\023]R\250\337"
+	.string	"#o|B\302\004\243D(\274\207.\317\337{\201\364\204i\210\230\335\365a\245\225\266\034\267\202\017\2038"
+	.string	"\254\347\307\322n\256?y7\273\2714\211s\322\241\242\266\207\001%0T\222\223\316\004\322\204\336 \347L\035\347\257@\330\004\016#\203\034\005y|\301\f\327'BI\213\355g\330\025\313\262\022AD\376\0328\03610$\340\323\360?\3428,\241\005\"=\034\021B:\210\020\210\206\373`(\245S+\256$\333\030xl\316\316\034\331#\350\3018v\b\266\017b\316\fe n\255v\362q4\343\007O#S\277\210\316\313\312x$\373C\223\306\323\327\257\253\363<\206TL'&p\017\235\221\311\017*\216\367\037\274\340\177\274\272\260\260\312d\376\2706\021.E\256\353{:\222\302x\213\267\241\017\023+]\205g\310u\t2'|"
+	.ascii	"\353\374x\305\017\327\376`SX\330T\231\321f\307m\021\263G\252"
+	.ascii	"\026\210\336\247\337F\301\035\321\2344\036\340\200g\254\177\336"
+	.ascii	"A\353\035 \274`\271\350\270\206\357\246\3353\315'\310\255\375"
+	.ascii	"f\355\3710\b\335%}\316\245Y\333\246/\203\276O\227E\340\317cI"
+	.ascii	"J\213\320m\307\330\005\320\262\344Q\217\336\324Y\302KN\207\272"
+	.ascii	"\3672\314\360O\227\335\340\233e\375\274\234\366\240\003W\226"
+	.ascii	"CZ\335\336\207N\203W\005"
+	.text
+	.section	.gnu.lto_.symtab.6cba8f208094bd,"e",@progbits
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\001"
+	.string	""
+	.string	"rcModeActivationMask"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\001"
+	.string	""
+	.string	"rcModeUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\001"
+	.string	""
+	.string	"isAirmodeActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\001"
+	.string	""
+	.string	"isAntiGravityModeActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\001"
+	.string	""
+	.string	"isRangeActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \001"
+	.string	""
+	.string	"updateActivatedModes"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\001"
+	.string	""
+	.string	"modeActivationConditions_SystemArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\360"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\001"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\001"
+	.string	""
+	.string	"modeActivationConditions_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\001"
+	.string	""
+	.string	"modeActivationConditions_CopyArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\360"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\001"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\001"
+	.string	""
+	.string	"bitArrayGet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\001"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\001"
+	.string	""
+	.string	"bitArrayXor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\001"
+	.string	""
+	.string	"bitArraySet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.6cba8f208094bd,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,581 @@
+	.file	"runtime_config.c"
+	.section	.gnu.lto_.profile.595e51c0d63a076e,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.595e51c0d63a076e,"e",@progbits
+	.string	"(\265/\375 \306\345\003"
+	.string	"$\005\272"
+	.string	"\021"
+	.string	"\354\270\344\363\013\004\002"
+	.string	"\001\352\263\360\321\b\002\267\204\341\306\016\003\342\201\222\246\004\002\004\354\206\342\366\006\005\243\276\342\320\003\006\002\001\006\007\320\253\336\204\013\b\220\352\317\274\f\002\t\n\013\f\002\002\002\r\222\361\352\340\005\016\017\020\240\342\234\212\n"
+	.string	"\021"
+	.string	")\"\260^LC>\310A\207|x\016=\344\035\325\f\267n\236\253"
+	.ascii	"\337\233\333\343\322e\250ep\352\224\033h\003X"
+	.text
+	.section	.gnu.lto_.ipa_sra.595e51c0d63a076e,"e",@progbits
+	.string	"(\265/\375 L}\001"
+	.string	"\320@"
+	.string	"\n"
+	.string	"\001\001\002\003"
+	.string	"\003\004"
+	.string	"\003\005\003"
+	.string	"\001\007\b\n\001\013\f"
+	.string	"\003"
+	.string	"\b"
+	.ascii	"*\2033/\003C\260\020\201y\215\312\340\22706\200\005"
+	.text
+	.section	.gnu.lto_.inline.595e51c0d63a076e,"e",@progbits
+	.string	"(\265/\375`\300"
+	.string	"\305\004"
+	.string	"\022F\023\034\240'\351\377\211\254\3702\325\322u\357\267\370\004\376\377\377\315\254%\344,ido\271S#r\f@pG!\201\b\\\336\376\323u\250\2033\020\016\2133IU8\026\311\207\247\366\376\253m\333*\367\277W5\325e\337V\025\231i\274\331\216\036"
+	.ascii	"(\026)\3409\234%3GIA\261\344\200\320\270\302B\035\b\200\006i"
+	.ascii	"caV\271*\00566\242\277\b\026`\206\003x\340\330Q&@;`\016\030s"
+	.ascii	"\001-\260\201\225QR\326u\212&<\305\2779\203KP\005\030\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.595e51c0d63a076e,"e",@progbits
+	.string	"(\265/\375 f\365\001"
+	.string	"\204\002Z"
+	.string	"\n"
+	.string	"\001\001\003\177\002\003\002\003"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	"\005\004\002\002\001,"
+	.string	"\001\300\004\001"
+	.string	""
+	.string	"\007\b\005\n\005\013\f"
+	.string	""
+	.string	""
+	.string	"\b"
+	.string	"*\203\201:\004-\313\371ng\375f3*\370l"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.pureconst.595e51c0d63a076e,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\037"
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"\230\004\002\230\004\003\204\004\004\204\004\005\230\004\007"
+	.ascii	"\230\004\b\204\004\n\230\004\013\230\004\f\204\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.595e51c0d63a076e,"e",@progbits
+	.string	"(\265/\375 \364\255\002"
+	.string	"t\002\350"
+	.string	"\n"
+	.string	"\001\002\003\001"
+	.string	"\002\003"
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\005\001\002\006\001"
+	.string	"\007\b\001\300\001\002\005\001"
+	.string	"\013\f"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023"
+	.string	"@\026=\027\266\354\250\331@z\003K\305\335\305"
+	.ascii	"*\030=\027la\2663\207b\345\247d\002\362\355\271`\013\263\235"
+	.ascii	"9`\333\006\332"
+	.text
+	.section	.gnu.lto_.lto.595e51c0d63a076e,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_armingDisableFlagNames.13.595e51c0d63a076e,"e",@progbits
+	.string	"(\265/\375`\337\001\035\020"
+	.string	"\366\\nH\300\326\324t(\252[\020#\304\b\315\bU\030\023\306\204\nN\b\002\333\262\213\343*\246!\353\266\353\272\204\3010g\032\240\377\356H<\021:\202\021\301n\327\277\275\270:\220s\343\017@:\013JN\273N\322\277?\311\205\222\fZ"
+	.string	"["
+	.string	"]"
+	.string	")\355;[}\006\345D\b\2415\337\311\352sJ\214[(\225\360\235d\237U\\\340@4\325\347"
+	.string	"+p`z\352\263"
+	.string	"\0248\021\032\366y@\t\234(e\320g\002\"p\354\341\203\315w.\350s\201\257x\347=\316\215\001!P4D\311\345\316_8O\370\316N\237\027g\267s /\362#Gr%_\362&\242?I\320\352\344\344,Ph\260w\342b\351\320Ld,\3519\364\271\223\304\325\362\372\316o\3503"
+	.ascii	"#\267\226g\350s7\004\326(\315w\036C\237\371+\036\220X\247\017"
+	.ascii	"\276\363\025\372\354\365\220\271\2406}\366\2447\027[\347\270"
+	.ascii	"yAc}\376\330\220\275\004\243nc\312T\267\257\020MlfF{\265`\262"
+	.ascii	"\230mv\253\201\257\031p\026s\311\300W\255\006\f!X\032\004X\r"
+	.ascii	"\264\321h50eO\241\211\222)Sd\005\355A<\304G\234\304M\374\304"
+	.ascii	"S\\\305Y\274\305_\034\306e|\306i\274\306o\034\307u(\370\216\363"
+	.ascii	"\270\217\377x\220\0139\221;\222,\323\250\362|\266,GqEzvE\222"
+	.ascii	"\352\310\333\022L-ET\205Y\215#\225eU\231\252r@~[\022Ms$O\346"
+	.ascii	"gK\242IU\275-\205\2254\231\3438\002m\212\254%2fT}\226TG\221w"
+	.ascii	"\204\022k\350-J\f\273-Sa\267\244r\354\326,\003# 0C\242z{f!'\306"
+	.ascii	"c\211\302.\310#'Gy\270Mq&\336L\214\265\244c>\312d\261\265\362"
+	.ascii	"(a8\267\201\304m\235\211\314e\"\363\231d.\023[\313\344\326\231"
+	.ascii	"\340\326-\023o\355\2255A~C/\002"
+	.text
+	.section	.gnu.lto_setArmingDisabled.15.595e51c0d63a076e,"e",@progbits
+	.string	"(\265/\375`F"
+	.string	"\255\b"
+	.string	"\206\320<9@\305(\035\340\271]F.\027\226<\243\240\267E\307\350\211\037]R\200M\345\237\372\337\020\335\\\013W\226\375\364'C\347\030\036\306sa\306\236$\302[@\273fd\023)S\n*"
+	.string	","
+	.string	"*"
+	.string	"\330\013\262C{\266\n\002\305\200\313\304r\355n\324\215{O\317\177\310-\337i\364\fp\330]\347w\262\270\365\266\027l7\330N\tW\375\230\2463\323\317\b<\016Jv+^\001\266\005O:.\266\237\366A\236\362\256\022\331\262\233\201b\262\273b\260&p\250p\203\3540$\312\372V0\275\246\336tQ\272\310GD>\207A\241\374w\350\207\262\303\353C\352\003\203\224/{5J\325\260\217\355\356ZQv\033L\204\006\363\246m8\032\017\267Ad:\234\217\007\324\305M\023=\034L'n\335D\324\022\314Id\272\370\341\270.^V{l\025e\b\240E\322\222S\003\f"
+	.ascii	"2\241\323/0.\020\0047)&Q\031\032Q\366\021L\271\004K\254\246\204"
+	.ascii	";\274h'\031"
+	.text
+	.section	.gnu.lto_unsetArmingDisabled.16.595e51c0d63a076e,"e",@progbits
+	.string	"(\265/\375`V"
+	.string	"\335\b"
+	.string	"F\321=6P\215\322\001\244\275|\005\234g!\002\204\213\241"
+	.string	"j\314\035\315,\267\220r\324\333\206\034\3636\260\262\346\335?M\314l\236\230\212xZ*\223\370\027\224\217\326\310\2262\245,"
+	.string	"-"
+	.string	","
+	.string	"\226g\360\002\226g\366l\223\002\211\200\025\224+ew\243f\334{z\376=\216\371R\245\347\205aw\235_\252\342\326\333F\260\275`\033%\366Y?\314\264j:3\375\213\302\004\001l\227\"\246\262\257ld#c\373i\237\343\035\336Y$cv/HDv[\t\326"
+	.string	"\236\035| \337I\352U\365(\325\351\037\007!\371\032\026\215\362\3373\177dy\226\252\225\250\240^3\260\030\312\302\2241\273UJ\305\260\017ww\255\253\035\315\003\007z\323:\036\016\210\333\0346\037O\b$\352\342\306\211 \217\346\023\267.\"j\006\346 6]\fq\\\0273\255=\\]\271!\3652\351\311\252!\352\n\r"
+	.string	"2\241\363/0.\020\0047)&\300\320P\331"
+	.string	"\323\002"
+	.ascii	"\263.a\021\253\321\341\016/\332I\006"
+	.text
+	.section	.gnu.lto_isArmingDisabled.17.595e51c0d63a076e,"e",@progbits
+	.string	"(\265/\375 \375\365\006"
+	.string	"2\21505Pm\222\016$\243*\n\201\244+kI\006"
+	.string	"\240[\230\324\275\374y\177\366\355\357\254!\370+\030\335\332\035v\337\314\314\022M\027\351\205\027U\244\216\320\266\3266\221)[\025\206\353\202e\226\202\005se0\215\006\255\013\304\256\005\f\2644\007X\0218k\260h0\223e\032\244t\261I\312\034\360\344\347[P53\013\372\370t\243\034\232{\361\303\346\225+u7U\251&\300\310\363J\337u^R|\247\230\244\377\235\357\335\251\212\020\t"
+	.string	"\2111T*\211!\224\007\306\317y\312\007\b\234\267v\026\241Np\240\016\222\030;\230\025\335\372\266[\215N\031\243\021N\324\351\233$\304\030\177\234\b\242g\177\202\337\340\227\b\t"
+	.ascii	"2\001#8c\216#D\250@\\\023\037#\362\022\"\207;gj\347\023"
+	.text
+	.section	.gnu.lto_getArmingDisableFlags.18.595e51c0d63a076e,"e",@progbits
+	.string	"(\265/\375 \370\325\006"
+	.string	"\"\r03`m\322\001@\203"
+	.string	"'t\246\300jp\325\343t7\224\020`ju\207i\r\365.\300R?\035"
+	.string	"\337\362\027Ee\301\242\t\346\275\3620s\030\367\336R\246\024\226*\013\323\205\252\244\004\013f\312P\016\026\224.\220\232\0240P\262\032`\245\300\025\203\305\202\231\252\262`\024\367\nJ\245t\024\302\276\307\343\345_\370A\223\307\356|\315\273K\r\230\350d\310\216\234T\n\373m\025d;\235\3722J\bBv=\241\223%q#\030\2667v\344o\234c\343\253E\213,\372\360D\200\230\354FH\371\300\273k\027xwZ\361\353y\371\357x\323\370\210`\031\347\t\200\260\273N,\223\270\365\266\rl\037\330\376\004\b"
+	.ascii	"2\003\316:#f\b\3055\3616\002g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_enableFlightMode.19.595e51c0d63a076e,"e",@progbits
+	.string	"(\265/\375`\034\001U\r"
+	.string	"v\231[C\020\221\223\016;j0\245\n\"\274\346\337Ui\3107\032\204fG\362\336\377\036\022p\347\355\021<B\332\277\241\235b\036\315\027Y\212\365PO\240\024\201\"\024\022\025\200\030\200\210n;\034\352\275\021D\366\2262\245G"
+	.string	"E"
+	.string	"E"
+	.ascii	"\326\262S\321`y*\333J\215\335\016\033\360\002\326c\236\200\365"
+	.ascii	"\250 \256\035jj"
+	.string	"\376\275\303\022(\037\207*\035\236\\\341&\306j\023\200:A\217T\007\231{O\f(S&G\203\335ur\250\rw\274m\007\266\031\3307\t\216\232NM\037\200\025\003s\240\305n\206\317\306\256\242\213\021W\375\366m\223|\317\035\276J\273\326\345\332\274\0201\273\035\202G/\2702\355\247\270\n\322\273\013\326\354~xq\331\355\024\230s=n\240m\377\304Q\220\002-\252)j\300\204\2047\343\2243Nm9G#\3525\365\333\211)?[z\205\200\"c\273\361\225\263h\276\b\217\220\344\271G\237\304z\214\2520/Lp(\311\317\356J\251)\366\341\356\2565e\315\273\337\272\352\001!\235\007\022B2\213\302\250\003\202\366p&|@B\231'\302\007\350#\022\032\021a\036\020,\364\351\2000\217h\204q<\234U\370\020a\"Y&\302:\272=\\MitS\242&\263\320\250\256\200!\003\257Lp\333\302(\3179"
+	.string	"\313\313\352\244\245\317x\370\002\026"
+	.ascii	"2\241')p\206\303 \270bp\2451\3626*\341\016\027\270-\2061\n,Q"
+	.ascii	"\025\017_YcQ\355q\241\252-,\324\204b9u\016\332\005\244\004Zu"
+	.ascii	"\323\224BA\001"
+	.text
+	.section	.gnu.lto_disableFlightMode.20.595e51c0d63a076e,"e",@progbits
+	.string	"(\265/\375`C\001\025\016"
+	.string	"\266\032_D\020q\224\016;Hr\370\254\205\002\223j}>\034t>\024\370\203@\273\264!\331\035g\377\367\212\022\231\265\226E\013\214\250Zl\271\252\b}U \200\nPX\252"
+	.string	"\361\002"
+	.string	"\335"
+	.string	"8\272\247\006\3627\331R\246\024L"
+	.string	"G"
+	.string	"G"
+	.string	"/q\023#s\372\241`\220\240J\267bc\316O\013p\017\371K/@\376\332\017\347\036W9\377\340\343\b\325\f\017Ez\324\360\215\005Z,j"
+	.string	"@\235\242\207I\b\357\340\325\002\312\244\212Y0\347\264z\250\f\367u\333\fl+\260/\"\316\374\3731_\335r\325\273j]\3655\030\225\313\200pN\223\020\307l\271Z\244|\365\333#\037t\346\2578l\262\260\016di\315\371\031\370\345\004\230\252}\225\237\030\375\253\340\2169;\274`\315\371!\360\006\373\365\021m;\233\272\220\002\3128\351\213\345~\263\265\356\262\334\243Q\322pw\337\245L\032\372\253\373\216\003f\277\016T.\272\034_y\n\316\007a\222\022\275\367\313/\221\277\344\256\013\f\022\251\222\206\366G\322\365`?\316=\261W\235Y\003\"\234\006\020D6)A\304\371Dw6\021<!\240\255\363"
+	.string	"\344\343\031\001\221\204\264N\210\006\362p>Z'$\3226\004\274M"
+	.string	"\ti#\333\026\322\262o>\316=\311\354GiM^\221\331E\021\343F\304\364\300m\n\"\275g\215\212\r-\247%\035\345\245\305ZNf\001\032"
+	.ascii	"2\241u)\260\206\303 \270vp\2253\3626J\002\034X\314\226\312v\276"
+	.ascii	"\267\326R\n\021,\006\004\303t0 \225I\026\325\210\013#\346\315"
+	.ascii	"6\322\354\326\204b9u\016\332\005\244\004Zu\323\224BA\001"
+	.text
+	.section	.gnu.lto_sensors.21.595e51c0d63a076e,"e",@progbits
+	.string	"(\265/\375`A"
+	.string	"\255\b"
+	.string	"v\021>6P\215\322\001$\351\252&\243\220\030 \252C\030\004\345%\376o\334\325\036\372\232\375\372z\352\337\"\224\215\037\377413\233m\242\270^\255o@\264]\375\311\336R\246\024/"
+	.string	"."
+	.string	"+"
+	.string	"\001\331\241\021L>\275\253h=\242d\365\241\262\333E\245\370\351y\362\317\361\227\362@\302r\241\236\226\204\335u\262\\\016\267\336v\201\355\003\333&\001\232NM?\263d\240\f\200\354\266b+{\002E0l\233l\214\355L\373\032\3370\035V\362e\027\342\"d\2673\260\006\3400s\201\354\360=\253\021U\306\374\364\232\372\325K\365\216{\224|\013\217Hy\326\241O\312\016\257\227W*cv\207J\235\260\377vw\255\022\206\207\375/\f\241\315\347Y\323,x:\240MS\340|<\"\320\210\213Z'\202<\233O\324\270P\324\020xk\340pQ\264m\\\304t{C\315\244Te\277\224\245B}\t"
+	.ascii	"2\003\302\260\200\341H\204\262\244\313(E\215\007t\004\274\b1"
+	.ascii	"L\327$\003"
+	.text
+	.section	.gnu.lto_sensorsSet.22.595e51c0d63a076e,"e",@progbits
+	.string	"(\265/\375`J"
+	.string	"\275\b"
+	.string	"\306P=9@\305(\035\340]\031\257\023\007B\252^\252Bt\322\220\376\245\334.)\300\246\362\223\372?\342O\317\302)\033\201t#\323\0316\236\3461a\306\236\224\372>\365u#{o\231R*"
+	.string	","
+	.string	"+"
+	.string	"\002\327\245;;\345_\306>\304\3044\322\262\273\023b\274\273v\376?\216\361N\243\353Eaw\255\336i\342\206\267}`;\3016J\177T\265\252\372\327euB\300\262+\321\n\260,Y\262\221\261}\265\337q\217\356)\2211\273\026\034\253\335\017\301X\300\245\301\007\256\313\370\367V\"<Tx\023E\351\252\203\210|\rG\204\364\336\245\037\272.\017\245J\005@\005I[\3667Rxa?\356\356\032\242\354\247\002\016\037M':\303\0324\216g\313\0306\035\r\344\201\340f\306\231\036M\323\231\031\367\231X\201\267\207\r7A\333\306\315\314\267\217\013Q^ a\221`\311\nE\002\f"
+	.ascii	"2\241\333/0.\020\004\027)\036R\031bQ\366\025L\271\004K\254\246"
+	.ascii	"\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_sensorsClear.23.595e51c0d63a076e,"e",@progbits
+	.string	"(\265/\375`Y"
+	.string	"\365\b"
+	.string	"v\221>7@\217\322\001Xp\373\346N\334\006\347{\030\"v\215fP\216\300\230o\311Q\353\177C\374q\331\224`\217i-\231\3143\272\341\360\375\300\352\331Z\365\236\262O\b\2212\245,"
+	.string	"."
+	.string	"-"
+	.string	"Z\366\200\355\232?\273\345\241\306^\204%E\002\333\335\250\031\377\236\237\377\217g@\225\351\211Q\330]'\250\242\270\365\266\017l'\330\206\005w\375Y\2465\323\231\351c0'*\004)\273\023\261\227}i&\035\032\333O\373\255{|w\225\234\331\275h\225\354\206\b\336"
+	.string	"\\3\270\300\366.\251W\325\247V\250\203<\244\344sX\202\224\007\257\371\244\355Z\352\300\306*\323+\203\305J\252\342\2241;4\245b\330\317vw\255,;\017\"\016(3\267q\370xB\035\327\320\001}F\241\b/r\236\030\372p@\221\363DqS\340\016\242\343\305Q\327yQ\023\356\263U\226\027P^'EYu\344`\r"
+	.string	"2\241\371/0.\020\004\027)\036\300\320P\331"
+	.string	"\323\202"
+	.ascii	"\263.a\021\253\321\340./\332I\006"
+	.text
+	.section	.gnu.lto_sensorsMask.24.595e51c0d63a076e,"e",@progbits
+	.string	"(\265/\375 \370\325\006"
+	.string	"\"\r03`m\322\001@\035\002rBg\n\254\006W\213\367]\020\2020\323\305\n\321,\352]\200\245~:"
+	.string	"\276\345/\212\312\202E\023\314\353gDv\303\266\367\2262\245\2262\007\323\206\252\244\002\rg\352P\n\026\2246\220\232\f8P\262\022`\346\342\nAc\301NUY\320\022\367*J\305\204\224\301>\307\343\345[x\301\223\307\356|\317\273K\255@\204rdGP\352\204\375\266*\262\235N\245\224\214\\>v\035F'+\342B.l\177l\213\237q\215\217\257\026+\262\327A\322\340a\262\033!\346\001\357\256\035\340\335)\305\257\347\345\177\343\rC\002\004\313@O\n\301\356:\261\354\341\326\333\026\260=`;\"\b"
+	.ascii	"2\003\316:#f\b\3055\3616\002g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.595e51c0d63a076e,"e",@progbits
+	.string	"(\265/\375`f"
+	.string	"\005\005"
+	.string	"\302G\034$\2407\035\330\367\377\376\370\\\374\025\372\365\245\263\237\177\364\377\377\243=\353&\"BKMDDd\344e\333R\246\006d\210\t\355\341x\211\303\005\242\206\330\030O\335\356\332\203\r\273"
+	.string	"\257\264\224jQ\312\321\351XJ\277\336\255t\0335\n\275zN\245\013\016\243\315'\346\322\362\227\312\243t6f\033x\324v\032Va\337n\034\020\331\335M\016\245m$\004\022"
+	.ascii	"5\033j\263.\303\345\007F\003\271\261\262k\330\340z\206\316\200"
+	.ascii	"\036\3405W\026\001\364\200\327l\260\b\240\007\370\306\316\217"
+	.ascii	"\210\320\252\f"
+	.text
+	.section	.gnu.lto_.refs.595e51c0d63a076e,"e",@progbits
+	.string	"(\265/\375 a\365\001"
+	.string	"\342\304\013\020\260%\351\f\3030\245\266\265\335\310&{\313\224\002z\t\330\251]9L\251\205y\031l\221\212!\016\322\241\235\0242\262\363n7\345}\235\032\b\004"
+	.ascii	")A\2119\233\022\327\273\346\030"
+	.text
+	.section	.gnu.lto_.decls.595e51c0d63a076e,"e",@progbits
+	.string	"(\265/\375`\344\016uJ"
+	.string	"\212\202X\034T@\020JJ\007\355\313A\220\333\001\031}\0133q\373\023D\326\271\311D\367?\006[\266\214[\374'\335"
+	.ascii	")\371\2719*\376o&\200\375\314\240f|\021C\322\021\306\215\315"
+	.ascii	"\007\354\361\034\213\243\035z0\351\343(4\251\026\206\224\373"
+	.ascii	"\017h;ww\236L\266\255\224)t\001\257\001\270\001\333\315\356\026"
+	.ascii	"v\267\214\021\231vK\345\024\261\234\234\272\243P85Rx\246\324"
+	.ascii	"\315L+J\216\305%Urw6\266\304j\031R\341bu\233\322\210.\205_\335"
+	.ascii	"\324\335\253\005\305:\326\220\205\353&Y\263MW\254\222\357\331"
+	.ascii	"\006\361\230a\332)\357\220#\013\343\232\263<'\243\200~W\234\272"
+	.ascii	"\271\271]q\366,\222\031b\2123CEK\016L\256'\001%[#5ND\024\231"
+	.ascii	"\302\365\030\240d[\004e\373\222#\215\353\033@\377\035\353\261"
+	.ascii	"\371B\005IKl\005J\\r\244\213\227\333\265a\272bS\262\231\335\251"
+	.ascii	"NL\230\223\255!\327\375a\2756\335\260\177\277\026\354\025,\331"
+	.ascii	"\313\356\324F7\264\241f\3065\305\362\234uw\316/\0207\241l\t\316"
+	.ascii	"\350\267\347\304\331\236\363\351\362\234\350\356\234\274rq1\377"
+	.ascii	"v\331\016\214x\213\362/\007\273\301\177\006f\376\035\242J\375"
+	.ascii	"\327,\n\031\230\032\327\002\375_\361\037\354\3747\353\337\232"
+	.ascii	"\1775\3707\203\177/\370\327\202\177\177\376\235\340\337\027\377"
+	.ascii	"F\360\257\213\177}\376u\340_\026\3772\360\357\002\377&\360\257"
+	.ascii	"\212\377:?\023\360o\001\377\242\3707\200\177\001\370\327\346"
+	.ascii	"\337\377\227\373\037\367\277\313\377-\377\337\376\273\375\277"
+	.ascii	"\362\277\312\177)\377\325\320\376\007\361\037\311\177#\377\213"
+	.ascii	"\374\027\373\277\374\037\366_\200\377i\377k\346\346\346\346\376"
+	.ascii	"\r\363\263\002?\215\220ZmDc\201\346\330\022b\266\003\375\356"
+	.ascii	"\222\323\b#\366\n\217\205Y\275\235N\254\bQ\304\312\367\312.\341"
+	.ascii	"+&f\315#W\224LkR(\025*[\305\004\226\314\221\260\2477\024\311"
+	.ascii	"\016`\224\2520e\334\212\200\342\204\353\231\b\005\312J\371 \355"
+	.ascii	"\247\245ZbB\362\231\034\216\263\303}\245\354\332L\026\020\252"
+	.ascii	"&\256\273\306\033e\331\276k\333\254!\246\273V\273\207\273*nv"
+	.ascii	"U\3040\3511\f;\3537\t\364{\004\252\246\266hhN#a\221{\273\361"
+	.ascii	"J\275\222\210@\277D\354\246}\323M[\346\007\033\200q{kc\312\342"
+	.ascii	";\206~\227y~\205X&\337&\3516Y\264\215j!\227\003\206U\226\340"
+	.ascii	"\274tTTO\t60\270%\327E\373!\220\340n5\335]\335]\300\316E\021"
+	.ascii	"{\302\365p\313\254\001\242L\322\302\365[D\317\377\331CcwC\305"
+	.ascii	"\244mD\25297f\267\347\267Y\335&\320\272\343\204\351~\352\332"
+	.ascii	"\202\0021\033\342\300\365\177\212\326\352\026\352t\332\306\342"
+	.ascii	"R),\212\255\035u\322\236:\321\313\252.\246\312cM6w\332\333D\345"
+	.ascii	"\321\205b\2324\026\323\2440\247\211Iawz\314)2\207\302-.\225\307"
+	.ascii	"\3422y\324ib\013{9\234B\211\311c\361I\362\230S\\\016\217E"
+	.string	"\242\362\250CC\027U[Q\313\032r\263\212\304\246\301\t94\3464\213i\262\333\272\227\251\324\306\004\272\221Ic\333\360\306*Aj\322\200\204d\230\334\264\273\005pB\242J6\261Y\f\222\354\016\202D\243\235^\b\323f\363\260Ma\025\262\233\224\272\007p\352\026\006S9\226\270\236u,g\222X]\275q\345\252\3359G\005;\252\266\270\352\230JI\223d|\222\304\365\254\3749\311S\274\224\3029\347cK\023\327+Y\236\263\304\356\234\214cw\326\201\206X\303H\017\\gv\347d)\226b\344\202\365\323\232\031\327\264\274tG\365\340L\365\222/\214\303\031y\267\030\256 \322\033\f\025C\305\005\213\331\026\364\347(\216\332\262JL\373x\212i\341h\342E\247GsH\230\r\033\fu]7\216-,\235\225TZ\324\020\364\f\265\\#\345\032\f\205\242\202\037\\o7hgJ\220\340\201~\031\352\344'6nj"
+	.ascii	"\037m\222 \222D\034\327\353\252\320\257\001\347\316\255\001\347"
+	.ascii	"\227\310\362pS\036\262\323\007i\013c\220E\261\250O`\256\220p"
+	.ascii	"=;\375"
+	.string	"\214\304Dn\252Iv\023\273\373D\205\313J\323\302M\314\204\303UC\007\217\264k\346,N\210\r\\\271\3103\234\227X\006\235\020\214\227^$\273\207\274\204\023\246{\210\263\253bWE\335\242\362a\344\254\327\351\200r\322\356\254\264s\032\243\322\306\2719\022\0213\302Ugw\316\231^\236s\215\272\":7\307m\002\t\033\033k>~p\227\351\254\fi\372\b#'\267qlV\260\266I[\230\023\022\350\227/\033\207\206\2511!\353\020C,O`\276q\225\r\b*mR\320/\334n\227.[V\323>\226\340\305\204\364\302L\312\316,Yv\013\332ycJ\021J\253\345\273\305\006N\254\351Uv\026\361\024\006L\031\372\366\266Wtl^LH-\032\245&&\027\027\372\305\262\353\366M\327m\227p\232\242\213\t\031\247\321\302\307\327;\001l\201\307\323\340\310\327\013\n\031\375\200~\274\026x<\025N\234F\213\020L"
+	.string	"A\206O\220G\364\023\n\246`a\310W\004\304\373\371\200\214xA`\f2ph\202BA`\211`\320\217\314O\210\306P\005\362\214\204F\b\200\005\240\220\b4?!^\021PM\220'\243\204\214\0317\300\237\017x\304\003\312\314\320\3019\342\345\020\361\024\371|\032\004\305"
+	.string	"{9G/\354\2308\002\367\265\300\373\371\004}\276\237\017\315\214\f\202<\240\316\207z?\336\021\217\b\375\013\030\017\300\370\201A\346?1\\\304pq\376'\306n\027\003\306\016=\214\235.\030\004c\027\f\202 \202\340Q\357\005t\206O\204 \r\242^\321\n:\274  \221PQ\007\274\"\025\204\200\275\r\210\216zF?!"
+	.ascii	"N\001\005@)N\030\301\003t\250\005Qo\205#\337P\020\317\250\027"
+	.ascii	"<z\341\3473\264\202"
+	.string	"\317QO\310\310g\350\007\364iq@\221-C\311\334\232Lc\214\274\361\342d\312\fbK\316\033IqG\226\313\354\255)\201\n\003\253pR\324j\340z\006\373\331\007\376\232\222$\213\025\327\237\3459\371jwN\371\007\035\305+ \274l$}\335\300\365\354\365s\027\377`\203\374Q\225\203\353\233\313s\326l\355\316\\17\244M\355\340JCD+\350\230\305Z\314\033\271\036LP\270\262\017\273\363\220\003\312\230\234q\225\021\302A\276\212\\\214p=\007\371\031\007\003\271\262\241\006(\\\317\344\332\235\177\340\260\231\301\365\220\205Ue\354\t\031\3273\326\317V\354\243&\211\232\230\016\256=_\273s\017\265\212\313\323\217\036<\340\254P\311\300\365\314\343\347+\336Q$*\203pu\261<\347i\265;\363\240k;\236\331\3005f\007\035R\001\201\032\250q$\207\2244F\221\231\021\021I\222$\035a\005\204 (\245\264\003\021"
+	.string	")\264L\210\024$M\n\373\034)xpk\312\317\351\013\350a\230c\251!\023\001\335f\245\321\"\f\300|X\336\212\201tb\017\220\212\214\203F\275\321 c\214\215\035\214\316\330{?#\331\322$\037\246\306\211jdR<E\271\371QPxg\227\335\270}\271\007\024"
+	.string	"\300\033\233\361w\316\340\006\327\034\257Q\310\343K\r\200\006\221[\334\245&\3546\0227\373\001\300\347\266\003FoI\366\3223Nu&W\333s6$\367\021\366\370KnJA\207\ts["
+	.string	"g"
+	.string	"\021\005\034\222\344\334\006\214-#\001\310\203\2332\224\305\305h\262n\2038\252H`\240\206O\177\334"
+	.string	"\27072\347\323\217\370\234\r\372]\272\276\025R\323\030]J\343B\317\375\032\331\370\215(\212\326\204e\263_\3020Y\0023\276i\260%\261\302)\f\2079yQPzp\254Q\200\032\nS5\260\226=LtX"
+	.string	"P5=\246\312\200\266\261\346\274\207\rd\210i\017\252\365\232\304#D\270\276Y\340T\024p\376.\030\215\362\217\177CM\007\006\030\354\202\365\275_R\206\311\2510\024.A\332\020\3038\026@[jcXW\023\022c\"f\342\035\340\222\307G\352"
+	.ascii	"\270\252\234\343\204>\375\341\250km\277\272\347\313\034\356z"
+	.ascii	"\321\t_\276bH\202\323\n\247_\306b_mQ\313\326Y\344\342p/h\342"
+	.ascii	"\247\345A\004\257\252\b^\016(O\272P\330\256\323\377>\237\313"
+	.ascii	")\256n\225\255D7\001\334\242\371*8\342R\310\374\231\336\224\302"
+	.ascii	"\344q2\231\202\257\007\"J@\251K\227o\211<\253\316l\333?\017E"
+	.ascii	"\357\203\023\007DR\347{e\366)\366\025\247\351\367.\b\326\355"
+	.ascii	"D\336\304\366}\00106\201\201\023\357c\t<\362\300\334\230\315"
+	.ascii	"\343K\355\262\244P\261\350\013\237\035\373\302\273U\376C\230"
+	.ascii	"Z\363\304\210(y`\274\2711\201\2712\177\320n\243\003>\342\007"
+	.ascii	"MS\017\371\336\327\343\260\206\246\317\326\034:q=\237\375+\362"
+	.ascii	"y\253\\\241\367\007"
+	.text
+	.section	.gnu.lto_.symtab.595e51c0d63a076e,"e",@progbits
+	.string	"setArmingDisabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330"
+	.string	""
+	.string	""
+	.string	"unsetArmingDisabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335"
+	.string	""
+	.string	""
+	.string	"isArmingDisabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344"
+	.string	""
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347"
+	.string	""
+	.string	""
+	.string	"enableFlightMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353"
+	.string	""
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356"
+	.string	""
+	.string	""
+	.string	"disableFlightMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360"
+	.string	""
+	.string	""
+	.string	"sensors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364"
+	.string	""
+	.string	""
+	.string	"sensorsSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373"
+	.string	""
+	.string	""
+	.string	"sensorsClear"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375"
+	.string	""
+	.string	""
+	.string	"sensorsMask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"armingDisableFlagNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\001"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\001"
+	.string	""
+	.string	"beeperConfirmationBeeps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.595e51c0d63a076e,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
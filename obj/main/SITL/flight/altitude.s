@@ -0,0 +1,1660 @@
+	.file	"altitude.c"
+	.section	.gnu.lto_.profile.1a5269929cf4b497,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.1a5269929cf4b497,"e",@progbits
+	.string	"(\265/\375`&\002%\f"
+	.string	"\244\016\032\003"
+	.string	"/"
+	.string	"\320\326\257\274\002b\002"
+	.string	"\001\002\001\002\002\002\003\004\002\005\002\006\002\007\004\002\b\002\002\007\002\t\n\002\013\n\002\f\004\002\t\n\002\013\001\240\342\234\212\n\003\005\006\f\352\311\246]\b\002\r\002\016\002\017\002\017\004\002\t\r\016\352\263\360\321\b\017\311\206\336\253\017"
+	.string	"\020\373\214\333\301\001"
+	.string	"\021\242\362\307\252\004\030\002\002\003\022\023\024\025\026\027\336\350\245\242\005\031\347\254\366\364\t\022\002\006\002\006\n"
+	.string	"\002"
+	.string	"\033\034\302\216\262\257\016\035\316\355\221\214\005\004\036\240\377\365\343\006\004\002\020\037\322\316\223\302\002\004\002\021!\241\362\220\273\r>\017\002\022\004\"#$%()*+,-./\357\330\360\251\017\0020\354\206\342\366\006\00212\326\241\320\377\0173\245\260\340\331\01645\355\314\246\334\0076\361\312\376\322\006789:\240\342\234\212\n"
+	.string	"P\250\221\315\340&\230\n\232bv\003\300\202\251\241\332\001\022@3K\216J\024d\260\354\326?\003 \204(\005\206\327\356AA\372\276Q&"
+	.ascii	"\021\3249\016P;@d\302\256\267\200\374g<'\346\3742|\006\371\265"
+	.ascii	"\351\227\264\254\305W\002T=\334\360q(\236w\223\315\240\323\b"
+	.ascii	"\\#\3179\\\337!\206L\2270\371R2-\221\243n\314U\330\256\253A5"
+	.ascii	"\"\035\327\252RWA\205%\357\203\2768\315\371\305\237\367m\275"
+	.ascii	"\273T\252\274\301\203\271P\233n\237O\310\315N\275/\324\023"
+	.text
+	.section	.gnu.lto_.ipa_sra.1a5269929cf4b497,"e",@progbits
+	.string	"(\265/\375 \311=\003"
+	.string	"\302\304\r\027\2605\303\001\f\3030\f\303\212Zv\255\030ag\212\3449\016\2212\245N\302\034\354\002\365\003R\255o\0036\350\322\362\310\220^VIF\366\320\2558\273f\tWc!\024"
+	.string	"X\205\350y\003\032"
+	.ascii	"\007@\016\\@_2,\344\"p'\226\204\210U\302\273,K1\261U\217\234"
+	.ascii	"+\001\2121\212u@\327\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.1a5269929cf4b497,"e",@progbits
+	.string	"(\265/\375`\337\002\255\r"
+	.string	"\026RA< \005)\215\001\301`"
+	.string	"\022'\306\304\004\264\266\361\355\005\307`\f-P\001X\276\211\001\024i\225 E\376'\345\002\331\301\220\340\002.e\001\335\275\320\336\336\372[Y\377(\371dK\231\002-"
+	.string	"1"
+	.string	"0"
+	.string	"\372\371E\316\241OKvw\364\251\315\356\202\006}\264s\345\017\212\272z\272\273\313\375E\244\255\fT\230~\304P"
+	.ascii	"#3\223\\\371\320Q&'\261S\214\321^bL\233\br5\300\362\234\360w"
+	.ascii	"\256\202\355U\nr\337R\020\025\0020\023Q\377\222f\352\261\245"
+	.ascii	"\260\331\200\226\210\017D\237\033\273\013~\272Uh\216\332\213"
+	.ascii	"\257\335\355\254\250\325\"\271E\2234E\311\222$\325\030A)\362"
+	.ascii	"\310\221\244\004G\322\2149\347\367y\301\213\273\322\227\302\351"
+	.ascii	"3\312\n\004C\250\324\213\333\017\001>Ph<;\334\205a\027\206\035"
+	.ascii	"7\"\036\264\fy\325\314\324\026p\303\235+\376\006\034\260\304"
+	.ascii	"\322\224\032\314e4\303\226zSqt\326-uI\2501\271\222Ff\212\202"
+	.ascii	"\244R\030\306P\002Q\306\250\356\022\200\224A#\2412LP\2024i2\313"
+	.ascii	"\273\325j\216V$1L\300\001\252\276\360\3617\244\033#\230\f#\261"
+	.ascii	"\203\rE\306j\270\245\235\356\366\242\033\266El\277]\035\220\206"
+	.ascii	"\035g\230\221V\322\301\372\225~\344\361\366D\256+\355Q\205\366"
+	.ascii	"Y\235\262\002\t\316_\3756\331\"\201r\264`\024\337n\260t\333\256"
+	.ascii	"\367\303\244\034\334\332 n\207M\332\224\\\263\350\202\253Hn\254"
+	.ascii	"H\344\ntT\262\036\353\370\001\237}J\376\274\274k[O\027\376\017"
+	.ascii	"\323\337\347\303\264\330t\213(\232#w\353\234"
+	.text
+	.section	.gnu.lto_.jmpfuncs.1a5269929cf4b497,"e",@progbits
+	.string	"(\265/\375`\305"
+	.string	"\365\006"
+	.string	"r\t\036$\2405\351\243U\221\300q5\376\177\331!\370\252\032\"\203\351\320\330\217\2155\221\260Z\354j\232\020'\211\334)\245m\027\255\242Nk\255%PQ\372\177-G\030\341\017=\225}\310\313k\363\220\335\354~n\204a\275\312.\264\004\206\231\f\356\334\260\304\207\2366\215\nx@\\"
+	.ascii	"\274\3237\265\307\236\354\371<\031\266\225\340\244\223V\353\233"
+	.ascii	"\026\337\344.v\340\037h\333\267u\352H- \220\002\031\273\352/"
+	.ascii	"\036P\220|\200\210p>\037\215Q\"|\335\202x\374\345\032\326\t\345"
+	.ascii	"\006\021\241\322\300xO\215p\b \217\363\nrXBm\3408TF\346\013\363"
+	.ascii	"\212\362\200\376\f\034\227\036\326\t\364\370X\200M\320\303|_"
+	.ascii	"-\226\027\013\020\001{X\264\037\240\255\234`\364b\227\f\346\332"
+	.ascii	"\fk\321\302\020"
+	.text
+	.section	.gnu.lto_.pureconst.1a5269929cf4b497,"e",@progbits
+	.string	"(\265/\375 2\221\001"
+	.string	"."
+	.string	""
+	.string	""
+	.string	"\017"
+	.ascii	"\231\004\f\230\004\017\230\004\020\230\004\021\231\004\027\230"
+	.ascii	"\004\031\230\004\034\230\004\035\230\004\036\205\004\037\230"
+	.ascii	"\004!\230\004/\230\0040\204\0041\204\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.1a5269929cf4b497,"e",@progbits
+	.string	"(\265/\375`\312"
+	.string	"\235\005"
+	.string	"\362\306\024\034\240\247\205\003\366\252\252\252\252\252B6\213\373\277\265\326mk\025\271u}y\311\2262\005\037\246\201\205\377\2742\222(\002J\360`\003\032\357\327Q^\215\373o\317\264\244e\023X\361V\336:\223r\244\246X\345\207\321\371\312\005\235\254\234u\272rW\364\004LD) p\202\251*\363\245\211\346\301`,d\001\373_\270\250\371\017\234\364\202Rq\030\3025;\302n1=\206?i\343\314}/\231\316J\307\fj\371z]@\032\036\b6\256X\230\240Y\304\t\020,\007j\244\322\b\340\273\370\3028!\335"
+	.ascii	"3@Q\260\345\2555\321o\265\243tjo1\207"
+	.text
+	.section	.gnu.lto_.lto.1a5269929cf4b497,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_airplaneConfig_Registry.76.1a5269929cf4b497,"e",@progbits
+	.string	"(\265/\375 \227e\004"
+	.string	"\344\007`"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\206\200\200\374\342\203\317\241\035\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\375\006us\324\006uq"
+	.string	"\005\001\006'\001\001\035?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/flight/altitude.c"
+	.string	"\004"
+	.ascii	")\302\303,\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_airplaneConfig.78.1a5269929cf4b497,"e",@progbits
+	.string	"(\265/\375 \034\341"
+	.string	""
+	.string	"\017"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\177\001"
+	.string	"?\202\210\200\b}{\273\001"
+	.text
+	.section	.gnu.lto_altHoldConfig_Registry.82.1a5269929cf4b497,"e",@progbits
+	.string	"(\265/\375 \230u\004"
+	.string	"\004\ba"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\206\200\200\374\342\203\326\201\033\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\364\006us\250\314\006uq"
+	.string	"\005\001\006'\001\f\225\004?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/flight/altitude.c"
+	.string	"\004"
+	.ascii	")\"\301$\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_altHoldConfig.84.1a5269929cf4b497,"e",@progbits
+	.string	"(\265/\375 N\025\002"
+	.string	"4\003A"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006'\001\226\001\254\002\354\016\376\b\005\001\006\035\001\264\013?\202\210\2000\177}\300\001{\277\001y\276\001w\275\001u\274\001s\273\001"
+	.string	"\005"
+	.ascii	">\307\200\303\240a\025a\006P\004"
+	.text
+	.section	.gnu.lto_applyMultirotorAltHold.93.1a5269929cf4b497,"e",@progbits
+	.string	"(\265/\375`\226\033\365k"
+	.ascii	"\232\260\210&I \016\323\351?\261\317T.\334$m\003\371\374p0t\037"
+	.ascii	"\333\235\243\377\204\264\005\005\311C\261E=\0277\253\361D\017"
+	.ascii	"P\207\253\230\034\373U\004\247 M\313\315\035\t\b\3011\255\032"
+	.ascii	"\340M4l'\261\211\242H\233\310n)\245\024S\002\037\002[\002\327"
+	.ascii	"\031)\351|\224t6R:\027]\347\r\327\231(\351\254A\351\234\341:"
+	.ascii	"\017\3758\013]\347\240\244\363ru\006\272\316\312\353\374\223"
+	.ascii	"tN\256\316\353uF&\235\357\352\254\"\235\217\327\371\257\263\253"
+	.ascii	"\316\335pGvqO\250\350\3718{l\222\306=l\241z\246\256\341t\037"
+	.ascii	"v\027v\023v\263\351\326\353\336\353\346\353\366\322\375\245;"
+	.ascii	"L\267\230n2\335\200\035\304\334\206\035\207\225\207yvM\340\254"
+	.ascii	"I\365\020\231\260\322\215\023?.*\020\362\224i\266\307\322!\021"
+	.ascii	"\257\250\341\262\270d\3552\334\203\254d\303\323f\335X/<4\214"
+	.ascii	"\322m\253 \222/0M\222\017L\t,\313\242\351@\"]\206\217\344\210"
+	.ascii	"0+\315\364\031f%\217u\031N\266\365Yl\225y\214Y\331j\262\273\364"
+	.ascii	"\t\335\327~\r\246Q\3501\375\327SV\002\032Y\313\330\3261\321="
+	.ascii	"\210,\273\327Q2\027 \021\223F$\214\232\220/\031<\340\205\003"
+	.ascii	"\035|Nf\354!a\232\r\261kgrv)\326V\271\271t\336\263\365\220\254"
+	.ascii	"elFj\3229D\226e\247Ze\252\265Uf\027\335V\217Mt[\345'\263\013"
+	.ascii	"\275'\307\"\2510\242\371-\262,{\365V\372\331UTSR\"B\200\370\020"
+	.ascii	"\345\001\352\311\211\331\304\264\324\201\203R\022\322\221Q\321"
+	.ascii	"\006\"\r\031\206\204\202\226@\312\237\344\212\274\352\361\375"
+	.ascii	"\311\215\204\341nx\242q\304\264\225uU\233\246j3\350SlZ\212\315"
+	.ascii	"\032\027!\330!\004\3258\210i\177\230\002z\324_{\370#\343Pc\372"
+	.ascii	"i\214\030wB\241\231(\204\361\246.\315\324E\317\227\362\272C\036"
+	.ascii	"\027\347\260\245\225\266\230\340Ix\215\204W\202\037\325\265Q"
+	.ascii	"\335\007^\224\2457\3209\021\026\327\220\345\212g\3102\347CY\344"
+	.ascii	"\\\310i\212[\224\016:F\275a\213rT\272c\213\363%\2247lq\016\324"
+	.ascii	"\320'\255|\362\363\206\215\203#s\352\304\223=\305\255I\257\375"
+	.ascii	"\206\rN\260\235\356\330\2328\362\247\215I\3376\r\232\2538\256"
+	.ascii	",\n*\212i{\353cP\233\331\221\311\262\254\262\355\314\377(\025"
+	.ascii	"7\270$\250-z,rC\245\205\016l_k;sG\302`Y\226]\255\315\255\331"
+	.ascii	"\252\231\377\0063\263aFz \005x\324\241^\006\364BP?<2\207Z\244"
+	.ascii	"\374<X\362\177\326O\366i=\315gO\2629\360\266\272\276\020\324"
+	.ascii	"K\036=\2507R\241\303\267\267\210\374\257\367\277\373\310G\266"
+	.ascii	"i\021\325\277\337h}\270F/b\265\220cf\253V\264q%\207e\331\024"
+	.ascii	"7\032O\216\225e\331\023\211CvT\311\321\t\271\255\252\337bN\017"
+	.ascii	"\032C\333\021\322\343\307\217WN\361\202\327\365\210[\222,\306"
+	.ascii	"\345\251/m9F\3042\307\257\322'\307\262OKoZ\372\b\315\234\321"
+	.ascii	"\315$\272\351\340_\312Sfv\250\377\016l\207{\223\243\323\263\302"
+	.ascii	"\240\23132O\273u\362\202"
+	.string	"\024\226_46\2561cY(\224\377\177\267w\026\274\177O;\312M\237\2768_\020\215\274\005\217\224\210\326\007\352\215\334\337\365F\276\317\364Q\004\303=\030\254|\261\213z#s\263\320t\200p\3231\003\rx\2535p[\355O\266\365\311\003\007\365F\036r\346,-o\265\256w\273.{y\020\243_\306\274\027\365\2272\367\221\375*\314i\r\247\271\333>l\3563\263h\02767\364:7{\235\237\327\231\254\t\233\221\\\347#\252\263\221\244\263\005\255\327<\326{\315E\2563\221f\323<\244\371\232\235\355\245Ylun\366\227f!\035\2469\254\3054\2035\231\346\257\006l\356J:/\260t\006\262tV\340:\377X:\373\270\316=\226\316<\256\363\216\245\263\216\245s\216\2453\216\245\363\215\245s\002Kg\033@\316\b\\g\254\245\363\001@\3165\256\263\001K\347\002\200\234\t\270\3164\256\363\214\325Y\306u\036"
+	.string	"\3109\206\322\031\006\220\363\213\353\354\342:\013p\235[\\g\026\327y\305uVq\235S\\g\024\327\371\304u6q\235K\\\347"
+	.string	"Vg"
+	.string	"Vg\022\327y\304u\276\272\316V\327\271\352:S]\347\251\353,u\235E\\\347\020Jg\020\327\371\203\3229\352:{\270\316P\327\371\351:;]g\346un\272\316L\327y\351:w\270\316\034\256\263\322uN\n\211\355\"\324\217\247\375E\316KC\277\335t\325\033B<=(\357\261,\253\341\245\f\344\201w\206\245\333\3741\241{\351\002\360\315gG\203\353\342{XmO%Jn\253"
+	.string	"<\212\271\241~2\271$\036\2027\347\362d\262\205\304#\241m\362\bI=\036Q\240\332\363\245F\374\363\352\255~\204\bW\3174\007w\344\253\336\352\225\374\332\273h\330W\375e\273\322(\207\021\321L\020\325\367]\337\240\330O=\325\335\324+\335\322\340\365\362\245\354?S\375!\004\352)\251z\201_\233\352\005\036\351mK\337\005z)w\277\362\253\220)G\350#D\362d_U\247]\204\212x$\337\344W'\342[\205\216z\362F\027\227\347,\313\226\375\254\312\2502-t\220!\276\323~\215\323~\314h\316\0257vV`\301\314\031\223\037~\354\225k\nw\305w\0325\351\233\035\373\020\337\202\275\026\3221\256"
+	.string	"\342C4\361,t \276\375\346\350E\375\207\177\303\026\321\211_\231\213z\025S\002\361\364\240\036~,\216\310C\275\207\347\340\327\256)\362O\017\3657\220u\247\177zd`\031:Q\nQ\274\323\337\022\256L\333\273(\343\006\346\027\261\243\002\205\001\231\337\323\256\342C\203\307\036\207<\221\227\372kG8\363\263\203'\025o\265!\337\203\235\001\215\230.U\002x\024\177\361D\275Q\n{\233>"
+	.string	"\3473}\323w\033\347O\034\nO\237R\006d\300\333*\323'\357"
+	.ascii	"\361\340\304\036\354\235/\202M{\267\364\315\276\330\273\025\347"
+	.ascii	"\240\311\322\357Y\"'.O\017\271\341;\374\212go\357D\275\361\276"
+	.ascii	"\224{\3409\376\367H\341\031;\260\223R\002\365\274\353\364\221"
+	.ascii	"_\353\360I\337i\276\236\303w\370\243\241\322\013y\016\237\364"
+	.ascii	"\327\332E\347|\003\236\256\276\304\337\236X\262<\353\352n\253"
+	.ascii	"J\337\201s\220>\351\350\221\214\376\350\373\257\215\241\350\215"
+	.ascii	"@\3606\266\242G\272\335!\372\r\032\236\350\033NN1\303kxj\361"
+	.ascii	"\f\236\"\2549\006O\022\370\211\367\334\342\255\366\334r[\315"
+	.ascii	"\360$\370\300\334\031z!y~\001\222\225e\315N\260\243=\360\354"
+	.ascii	"\262v\335V\207\276\275\31459\263\f\032\336jB\377A\315Ia\364\313"
+	.ascii	"\360\004}\330\362\203\200~\031\034\304j\353\213\313\231\304A"
+	.ascii	"\254\304\2028\263\276\256\300\302\276\276\302\264\224xxm\r\331"
+	.ascii	"\362Zvu\021\007<\313\001\027\353\261\365\305\305\303\t\266\325"
+	.ascii	"lV\240\265tz\305\240\240K\365\332\362\301\325\245:\301\270\302"
+	.ascii	"(pn\355\030j\2065\2334\306\234\\Za^[C\2268\300\302\270\234Y\315"
+	.ascii	"-\257--\255\254\245S\254\202f\020\036\315\255!aA\224D\262tly"
+	.ascii	"9\235a\315 N%kYmEP\201\223\313\351\225u\345\f2\001\227\227\004"
+	.ascii	"W`\\Y_WZM\261+\253%\016\243`\253y\345\f\013k^)"
+	.string	"\367\240}d\277\n\226`!\364\243U@^J\246X\342\253"
+	.string	"\241\252\233R\340\247t\360\343\025\210\022\367C\212\t\026\021>\376\211\223\036\357\243\t\\\217o\277\020/\345gk+ x\374\006d\212%\376m\307\363\370\233\330\022*\341\351\372n;\276\375><1\241\022\245\343\223h\200\301\257\351\360\200\247\021*\307\247]\320\376Y\216'=N8\252>\372P\252g\033q0\361(6\335\340C\246h%g\317m\303H\246\270.z\0362\030\354\220%&\336Vo\274\213\2713P\246\2272\263\261\256\235\245\004\022\357$\360\327\260%\204vx\201\203\215G\364\030`\360\346@\004\336\006\026\002u\260\036\305\0348\250\022\235\244\003\252\234\016\0135\376"
+	.ascii	"\003j4\373\006 \275\224\275M\313\370\244\r\342\034\275\224\312"
+	.ascii	"\017\311\024\257\340\270!Y\0362=d|\310\370\\\002\276\200\277"
+	.ascii	"\2064\bx\246\331\227\205\t\232\3614\376\362i\357\ny\272\2520"
+	.ascii	"\343\033\314\234^\177\240\026Wh\364Rfj\254+\343%\350\233c\346"
+	.ascii	"\214\203Xd\215O%2^\345k\001\017n\200\3675<\025\222cW\343\202"
+	.ascii	"\317\262\350\363\354\354\306\370\001\376\377Z\304N\213\001e\f"
+	.ascii	"\224\"\030h\036\370LkB\363\342a\374\365C\353\263\302Y<\3633\203"
+	.ascii	"g\222\333j/\336\304\032\223B\263/c\027f\244\002|\213w1\025\340"
+	.ascii	"\223p\320\026\357\244\233\266v,\310@Q\361\314g\361\237\330\306"
+	.ascii	"E\333O\361*\376\330\246\275c\246\370V\203\245\261\265;\361G\276"
+	.ascii	"\3335\354\361\310\237\370\206\303\242\330\306\231\370>{\257S"
+	.ascii	"\342M<21\355K|\307iu\020\313\013\255\335\020\313\262\033\314"
+	.ascii	"Z\003=\366\333\354\373M{]b\273H\364\322&d\016\367\372D\327\303"
+	.ascii	"\276\301\350+\005\202\033\250\342@%\024:\210\230!\031\021I\n"
+	.ascii	"\222\2445\302\013\020\006\"i\330b\274\001\022\200C)\b\224\020"
+	.ascii	"2R%\244 I\222\264\006\\O\316\202\007u\347\341\271\013\277\301"
+	.ascii	"\252\007x\320H#ye:@\221W\246 m\375\"\366\002\352\314\222M\\\306"
+	.ascii	"+\214\307l\207\217\366\346}\tR\2447\310\360f\355\367;o\341\252"
+	.ascii	"\313\201\\\3262\330\022x\013\036\363\333\372\037\032\021v\356"
+	.ascii	"\237\f\376,C\024t4\321\335\276\006\264\240A+\256\261\335\330"
+	.ascii	"\030\334\223\025\305l\243#\202\300\022\346\350\202\340\3542~"
+	.ascii	"\"m\342J\214@\307,=\352\325\261\370\201i\2264\212\236\364~\206"
+	.ascii	"\215\020\0324\223,\331\303\231\254\364\240\027P\336)\241b\376"
+	.ascii	"S7\007\005\207]\241\236\226\005\330J\3572\311?\254\177G\334\001"
+	.ascii	"Z\202\354M\007\231\217\261C\331Q\224$\310$\374\245>\324X\032"
+	.ascii	"\304j:\255$ \245\371\246GsX2zz\031\374\016|\326\362\3440\264"
+	.ascii	"`E\"\021\373\r\277\261\271l\001i\304.\303\361\202\333)\340\236"
+	.ascii	"\006\221'\230\221\202\200\037p"
+	.string	"x a\217\035\353\035;.CyK\336\227L?\333\231QDc\211\371%\201\227\231n~\322e5\"\034l\374\317\201\225pe\264\016^\033\352\232\362sa\316\320\331&\252\336\375\220\026%LvZ\206\033D\257\263\004k\346\275R5\360G\343T\204rIq\362\261\023?\263%\347b\"\234\177\263D`\376\217\3120=X\352\321@$-J\364Y\020\325\373F6\002\341\305\266\372&\t\373\301$\225G<>Q\213\313S\215\004\313\037<b\257\\\026\214\337\2745\024.\212P\251\313\270\327p\030c\3067\305\311\005\304\214\200G\337\031\276\277&LSV\301\321\020u\301\344l\001\027\331\201p[\202\344q\200\"v\003\230~\233g\003\244t\307K\252}-\254\332S\333\0048w(2\350\216\265\377'\305}\241\346\020\025\226\206 |X\332\213W\255\357qN\004\265\216\3337!\275\335\346)\353\031y\262\b\034\177\033"
+	.string	"\341\333g$\017G<\201*\022\212\2126z$>\203\241\366\017\215Yn\251<dR$=C\034\314E\001C\020\230,s\217,\316g\350\006\217\005\314\335\240X\037\021D\333/=\022\305"
+	.ascii	"B\367\354\303\366\242\035\304)Q\336\243\026 \";\335\371\341x"
+	.ascii	"\300@\300zr\236oP\2424\177\332\340\304\006\377\216H\313t\034"
+	.ascii	"\267\004\347L\323\032Hb\316\013\224a\016\016\252\237\0010\033"
+	.ascii	"\306\271\334i\323\214(}\315\354\033\215\002-\333p<K\271\0233"
+	.ascii	"\363bf\354\326ro\n\225\374\230\n\\\005\2405Q5\275\275%\216\215"
+	.ascii	"?4\177\214b\035\232\337\360\261q\352\205\220i+C\203\375\250\312"
+	.ascii	"\222\365\360#6v\303\222\"\004#T\275\254\356\340\2167'`\263\333"
+	.ascii	"y\203\f\220u)\26006\370\266\272(\317o\343\354\312\002\270\316"
+	.ascii	"\\\342\224\261\177z\034/w\241\235\340\300\357\303\027q\026|\342"
+	.ascii	"\312\202C\322\030\016J\tL\327*\260\333\300 \355+\235\363\002"
+	.ascii	"\246\332\341\b\327\350D\337O\205\0251\026\030\2260\363bW\005"
+	.ascii	"\243\262\t\315\353X%r\001\334\t<\317j\336\226t('\016\r\222\234"
+	.ascii	"\333\273\226\247A\231\005*[\340\244[@f\003\344\315\355\003\017"
+	.ascii	"\254\231\226\020\322\026\311\232}@0\260\361c\355S\0061p/]\321"
+	.ascii	"\240\206\207\202S\0027\350X~\241@\206\316\372\336M.P\301\362"
+	.ascii	"'\266\265<\310X\271\360a\321\366\256\370+\342\301|\252\245\362"
+	.ascii	"\214hru\022\235%]\026\372\0010\323\243\332+\217\r\037\253e\263"
+	.ascii	"\r'\016\207\343\370H\371\272H\325\213\037\017\001"
+	.text
+	.section	.gnu.lto_applyAltHold.95.1a5269929cf4b497,"e",@progbits
+	.string	"(\265/\375`\213"
+	.string	"-\n"
+	.string	"6\222D=0\305*\035\300\370\363\375-\227\033\322C!\336\"q\322\232\036\0045s\234\226\327n\322\220\213q~\334\361b\023\336\224\335\263U\225\0022\222\t\013F\036\207F\2145\370\005YB\266\224)\0051"
+	.string	"1"
+	.string	"2"
+	.string	"\234\\=\371\217}@\034Q\347\b\306\326e\246\365\225\007,\020q3\252$BME\300cW\2141T\305,\3149\255\342\230qw\267\335`;\301\276\f\256\224\336lY\250\333a_\316}\331WwW\037\263\331pQ8\231\223u+0i\334J\210\355k|\262\003\\\006\233\237\335V\263\001sNo=~z&\225\364\242wQ\332r\301\022Ys\272n\037{\346\245\004\200Jm68\247\373vk]\271\302\217\234\244\302\377\260\205I/\236\363M\335\271/\307bB \376t@\016%0\004\212<\036\030\001\021\022=x\023!\217\204\367\031\221\274\016\307\037\005h\344\201\3377\3624\262\324\345\334\227\0318h\251\r\271\257"
+	.string	"E\203\026\036f\253\245H\214:\023"
+	.ascii	"3\241\027(\006\206\241*o\037(F\324} a\240\332\007\251+\342\222"
+	.ascii	"\207p,*<\327p\270!\374\313\270\343\322\305l\247)\241i\f\n\n"
+	.text
+	.section	.gnu.lto_updateAltHoldState.96.1a5269929cf4b497,"e",@progbits
+	.string	"(\265/\375`\026\002M\022"
+	.string	"\006\340tH\300\324M:t\034\023\030m\250)\002Q2\017\277F \360\311]8\274=\354\026\352\376\254\365\025\006\214\306|\366\355\360\350l\227\006\204\021f\370\3476p\t8\334z\320\331\277a\266\261\275]t\004\323\311a\311\336D\312\224\002_"
+	.string	"V"
+	.string	"e"
+	.string	"Q\tjs\372T!\231\266\270$d\373&\376l\"?R1?c\306#\3436\347\3646\305\277\313\310\255~>\200\020v\371\363\310\031(\242d\004%\334\341\002\370\254"
+	.ascii	"C\204:\312\255~\276\334\001\235[\t\223P\306\235P\361\374\270"
+	.ascii	"\321\265'\214\251v.sN+\030\216\270\273\333f\331f\261\365C\256"
+	.ascii	"aE\237%\037w\273\241\246\242Y\216V\355L\b)\212;Q\273\225A\017"
+	.ascii	"z\r$\307\013\023k\020\362K!I\210L\251\\\242\334]\322\356\200"
+	.ascii	"\243\007\2777\372E\364\020\331d\013\263\217`\272@\366\2719\347"
+	.ascii	"\364\242\260U\235\022\325\035\247\226\253\216\252\336\253\257"
+	.ascii	"\202\"\025\261\247\026Sr}\245/\3010xy\031\322\362\032\314j\316"
+	.ascii	"\211\300\307qZ\003?\350\321\016bb\344\243\334\022&\247#Kqm\310"
+	.ascii	"<\2309(\225C\3435d \314\314\310\307\270\221\204\223\212\256\036"
+	.ascii	"A\332\022&\234\320\230l\262\357D\335\200\212+2e\345#)\310\352"
+	.ascii	"+r7e\255<\263\230V\331Gz\f\032?(\256iaU\360\360j\275lh\274\027"
+	.ascii	"\206\013-\033\013\336\206\026\215\006\257\346\006\307k\021`\027"
+	.ascii	"\007\326\215\367r\271n<\223\243y\227\234\215\311\005\252\331"
+	.ascii	"V\002~\217C\2716d\232i\362\261;\241\343v\353\326\337q\036\037"
+	.ascii	"\213\217\350+\372\212\222\200R\003\324\376\\|0\364`\267\005h"
+	.ascii	"P\266\330\302\236\024\224\f=\335\246X\336\264\240\0135 \300\002"
+	.ascii	"\221\251\344\006\"\340\033\366\220aQ\002\341\227\035\206\354"
+	.ascii	"\257\215\024G\310\367\034\355\"Es\034\277\003d1\356L\2607\357"
+	.ascii	"hB\274\027\356hRp\001/\231\025\223\206\rN\\\255\356\377-^\213"
+	.ascii	"\277pA!\217lq\371\264\f\302\013\272\\h\324P\030\004\370\341z"
+	.ascii	"c\375\n\240\371x\361\367\306e\253\260)\336\247C\200\346{nZA\027"
+	.ascii	"\254\2461x("
+	.text
+	.section	.gnu.lto_updateRangefinderAltHoldState.97.1a5269929cf4b497,"e",@progbits
+	.string	"(\265/\375`\030\002]\022"
+	.string	"\326\237tH\300\226M:v\334\377\3356\267\362\023T\262\271\223Z\200\377\365\244gD\323\352+!\256\217\277\347\003\203\t\2436\354$\240ZC\002G\334u\342\373\0339\r\204\006\317\342\355\3378\204H\264!H\b\\:;\310\336D\312\224\002`"
+	.string	"W"
+	.string	"e"
+	.string	"O\013ls\002U=\231\265\330Dd\373)\376\354%Gr1\177\343\310\307\306m\316\351m\213\177\227\221[\375|"
+	.string	"!\3542\350\221C\300\204\251I\200\260\207\033"
+	.string	"\364\002\034\021\362(\207\022\364\345\022\360\334P\244\2042Ne\312\247\310\217\256?aL\265\203\231sZ\301\260\304\335\3356\313\266\213\255!\0026\376\220oX\321g\311\307\335nf\304\211\320\216V\255\020Q\322\023\247\242vk\203\036\364\332\326cF\212\265\b\371\265\240\224D\246S^\351\352.i\177\320\321\203\337\037\375$~\250j\262\205\331H0]\026\366\271\271+lU\257Du\307\251\345\252\243\252\367\352\263\b(\n\r\272\230\355&%\327gz\223\214\203\230\030\250\227\323dP\346\234\n|\036_z\340\017=\032\302\314\214|\224\273\362a3j\212\253\203&B\315\301\250\035\034\317A#\241\246F>\306\215&\216\260(7?A\332\024*\250\320N\324d\357y\332\341\024[\344\n\n\021%$\334|\213\334]Y\253\217PL\253\354'\275F\276ya]"
+	.ascii	"\361j\275pl\274\227\206\f-\034\f^\207\226\r\007\357&G\307{!`"
+	.ascii	"\227\007V\216\367r\271r\274\024\244y\230\235\215I\323l\253\001"
+	.ascii	"\177\310\235L\233y\311K\362\261S\001Ut\353\326\017r!\037\214"
+	.ascii	"/\306g\364\031Q\201Q\005\324\376d|4\364`\267\007h\263Zla@\030"
+	.ascii	"\254fJ\212\244\\\376#6 \300\002\221\251\344\006\"\340\033\006"
+	.ascii	"\221aQ\002\371\313^\2507e1\322\023\241\263\223$\226\034-q\274"
+	.ascii	"\r\020\313\344Yc\017\337\326\230\330.\\\324$\343,^2,&\r\033\244"
+	.ascii	"\270Z\335\377[\274\026\177\341\203B\036\331\342\362y\031\237"
+	.ascii	"\027t\271\324\250\2610H\361\303\365\306\372\025@\363\361\342"
+	.ascii	"\357\215\313V1a\204\t\261\373t\b\320|\317M+\350\202\3254\006"
+	.ascii	"\017\005"
+	.text
+	.section	.gnu.lto_altHoldInit.98.1a5269929cf4b497,"e",@progbits
+	.string	"(\265/\375`*"
+	.string	"\325\007"
+	.string	"\322\21656Po\322\001 \306\311h\033\300\300\216_\312\200\036\225A\261\364\352\254\246\305\001\350\310\227\357\275\0213\302l\204\2701\232IW\013\004\243\377\016#\252\211\321@\233H\231R\346h:\f \355\322<\233\250=8\\\236\206\030qm \"'\373DM\2011\211N\0265\f\313\242\345q\257VI\013*)NEN\365I^b\024\277d\314'\237:\230k\252\256\\\274x\342#\037\201]\013\004_\344&\220_:4E(\337\035\372!\200\303\253\365\021\003b\342\362\263=Q\352\206\375j\225dg:\237>$@\265$|\273\031\337\314\246 \312\303\366-o\266\313\275\216\375\t\013\206\211\314\356F\345\370\366\334\374\207|\240\033U<\003\024v\327\331\2154n\275m\003\333\007\266S\002\f"
+	.ascii	"3\241\251\037x\312\334\266Ub\255\f{e<\244j\320\205\034a\260\377"
+	.ascii	"2.\270t\213v>\001"
+	.text
+	.section	.gnu.lto_isThrustFacingDownwards.99.1a5269929cf4b497,"e",@progbits
+	.string	"(\265/\375`\245\0015\017"
+	.string	"V\035eD"
+	.string	"\221(\035\373\216\323T\314\222\243\017\0237\322>\245V\265\210\314%\247&\305\371K\336mf\333\226\026\377\325\007~qf\272\323m|T\211\250\252J\260\024\254\222e\224\250\337\343\275\333k\246@\023B\366\2262\245Q"
+	.string	"P"
+	.string	"P"
+	.string	"\373\0250\t\367\350\357\004\264G\356\003\264G\3336`22\351\237K\365\230\032(\331\216\335\257\323\230\223\036\241&\311\337N\026\344x\335H\255J\217\033\0169\253\227T"
+	.string	"\253\023\354\354\356e\2360+\227\314\355dw\235\251\225\206[\273m\006\266\021\330\031\003\2171\2550\2350\375\217"
+	.ascii	"/d(\240\261\253\232\361\330\030\221\305\207\313~\330\323\376"
+	.ascii	"L\307\004\262\247\227\032\232\177~\314\034_\304G\214\016\023"
+	.ascii	"}S\373\235\201\262\301\261\273#\2176\341\036A2\355\221\315\261"
+	.ascii	"\235i\037\304C\214\376jy\310.\313\006\315\006\372\231\013\320"
+	.ascii	"\361\334\335\222j\313\032\207_\320\256\227\371U50\030\247\274"
+	.ascii	"\261\246W\221\026\031n\274r\023\242\273p\331\240\227\250\300"
+	.ascii	"\355\356\001\022\036\313W\270<<\372-\332\243\246\217=$\326\341"
+	.ascii	"e\312\231\375\225R[\366\341\356\256\225e\356\262{;\354\365\030"
+	.ascii	"\032\244\347\341\214R\222\342\300\202\367\361T<\235\027\001\302"
+	.ascii	"G\345A7\341\343Y\351PB,]\211\210A\024RB\235\007\002\205:\316"
+	.ascii	"\267\207\253,'\034y*\311Uals\3321\251\213U9=\252\207)gZ\324\026"
+	.ascii	"T\250\254\023\317MS\023\330H\270\n\221\242H\241\261-! \220\202"
+	.ascii	"\2419\343\001\275S\230\217\2676\003\001W\251`\347\2023rp\036"
+	.ascii	"(\201\025\242\203S\311~\367E\343\260\271\357\315m\353E[\022\221"
+	.ascii	"5\332\250@\265\243\230m\371 \316\315\251\026Z43\233\333\016\263"
+	.ascii	"\021G3\344\365\302\325\356mW\327\003"
+	.text
+	.section	.gnu.lto_calculateAltHoldThrottleAdjustment.100.1a5269929cf4b497,"e",@progbits
+	.string	"(\265/\375`\371\002%\025"
+	.string	"\026g\207I\320\320*\035\372\032\322aGU\325{(\371,\033\003C(\233\324\357]\033\323\315\205\343D\325\0020Y\313O\256h\0232\256\370\t)\267y\256\253\345\362\202+\360\006\362BO,\274\270\203>9\022\n#v\374F\310\336{\247\024p"
+	.string	"n"
+	.string	"s"
+	.string	"9[.\200<\020\315\246]\0134\200\273k\342\222\322\253m\337\303?\324\230Fw?c\350\203\2243\204\264\273,\325G\302Wz\221\360u\372\234v1\254tJ\232\177\032m.\226$<\244"
+	.ascii	"(\270\200\200\032q\350\210Q\017\215\363.\035\2149\262F8E\215"
+	.ascii	"7r\202\2147\252\332\335\367.s\243MJ\021ew-q\343\203\273t\333"
+	.ascii	"3\266\017\330\323$wx\240\277\206\322\264JOK\037$\004\311\250"
+	.ascii	"\300oW'\270cc\324\022\033\356\373\201\227\366}`\321\317\252\332"
+	.ascii	"nwv~\252Zjo7G\300\021\367\371$\214\"\252\371\320{\246\271\220"
+	.ascii	"gO\260\303\356~\310'2\210\207\240\271\b\231/n\2772rj\330\330"
+	.ascii	"\335\325\253\r\224^S\362\"!\215\215z\225v\215\215\262\2032\020"
+	.ascii	"\220;\377hj\003\341\244s@\215\327[\310L\037\013\226)\264\"\234"
+	.ascii	"/z\310\r\f\237S\347\220\3471\2418\337\373u\216x/n2\311\247)N"
+	.string	"\022\0248I\357y\345)d\256\242g\330Q\260\374\367\263\273\002L\374D\213\257\341\325\262\027y\334K\370z\232'q\312\301\206#\007PM\006\355\235MN\235\375\031\f\006\203\236\027\354*\375q\337}z\320o\372\356/\205\322\342\201\0013)R%&C\340r\265J.-\263\224\330\253\201h\327\311K\205\301\f6\213\265X3\005+\260X\002\326\002X\253\205\345\202\211a\235\220X\346\362\202a\315d2\030\026jW;=\rM\025\202=\352\352\3774Jm\332\250\230\222\246Y\232u\332-\227<\356c\236w\024\234i#\213n\030\361\204SgIW\237\301\003\306,\371\234\271\325\347\234\300\243\203wt\223Iu\352vw\251\212\323; \220\002\031*\264\003G\027\336\030\311\256\205\206\267\215W\210u\307\322\030X\032NP\376\215w\2420\".\226\313\331\243\374Q\270\215\300h0<\305R\332\224qc$\247,g\346"
+	.string	"\226\223Y9h>[TC\nB\263\023\005\306\020\016\312$\004\210\270*&_?\037,\246 \210\240\272W\274}\2325\226f-K\224\f2T\214\220\217a\f\"T\356s"
+	.ascii	".3\376\214aM{\t\217\233\205\253\275\267]F\017"
+	.text
+	.section	.gnu.lto_calculateEstimatedAltitude.101.1a5269929cf4b497,"e",@progbits
+	.string	"(\265/\375`\307"
+	.string	"\375\013"
+	.string	"\326\026TC q\223\016\034s\022CV \236\224S"
+	.string	"\311\312+\373]\213\216\354\334\034&\234\021\311\321k\276\375\004\305\310\001\"Ql\355\224\230\222\276@\256\026C8\032\0010\262\201\345\305i\221g\037$\215\354\275eJ\001@"
+	.string	"A"
+	.string	"?"
+	.ascii	"\037P]\272\263m|"
+	.string	"\222\330\2670\021a\201cw/8\362\356\021j\347\003\370\274G\253\303aDp\372\240\"\340+E\314\f\024\221\243\256\031\276\020U\313fw\255\246\217\303-o\333\201\355\006\366\031\004\227Q}K\201\0305\036\270\330\325\220\312\261(\022\206\211\317CU\373G\371b{zX\336\006\353\004\303\311\215\335\231\271\364\002\353j?\305Ut'\371p\307n\b\031/v\247\002'\260.1'P]\306&\320#\367\250*h`\004\212\022\032!\272\342C\t+\250)\027N\224^\362\025\037~\t[\340\364\246K\237\253.\017\217z\346\224\242\342\001DS\366\364\024\212\260\037ww\rO\366\347]\235\344\001X(\343|$\t\002\026\3128\233\b\3234\316\023\300\036\r\366\341\266l\003u\256m\202\204\f\024\341\022e\235\320\345\321H\227\346\200G\0240\355\332F#\355\272\314\375\006\004\226\242\245\022\332\025Hz\223#\364\276\002\"\025\021"
+	.ascii	"2\003\302p\306\204\275\032\350\016{\t\325*\b\304B\b\207\212q"
+	.ascii	"\244\0029\327l-\334\275(\np\352\264\270\226\233\022\217\306\240"
+	.ascii	"\366"
+	.text
+	.section	.gnu.lto_getEstimatedAltitude.102.1a5269929cf4b497,"e",@progbits
+	.string	"(\265/\375 \366\325\006"
+	.string	"\002\r04Po\322\001 Od\201\206\233\303^2\370\006\032`\333\365\020\225\b\205\255\241\326\363o\2100\033!n\214\312\315,\243\252\375\347jK2\235\017v\357-eJ\001\346h:\t\021Q\212\236\r\214\f\013\222G\001:H\233\006\310\241 \240\206\300\323C\207\202q\232(\210\301\366:J\315\210t\302>\311\261\312\357\260\304'o\335\371\237w\227\np!\312\314\306B\251\031\366\333\352\310v:u`E\005!\333\255\310Z6\305\235|\330\006\331\030?\344\" W\r\333\270\036\207\007E\t\313\356\302\314\005\336]{\300\273S\215W\317\312\377\310\033\b\212\211u\205\236\227\203\335uZ\227\305\255\267]`\333\3006F\b"
+	.ascii	"2\003\316:#f\b\3055\3616\002g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_getEstimatedVario.103.1a5269929cf4b497,"e",@progbits
+	.string	"(\265/\375 \366\325\006"
+	.string	"\002\r04`m\322\001P\030'4\006y@\0029\356\036\332N\255\357\323\234\262B4\213z\027bSO\364\304/k\b\\\0222\254\235[\222\213U\013\307q\357-eJ\001\316\\4\n\022q\212\033\f\214\r\f\323f\001>L\030\007\230\251\"\340\245\300\024\204\246\202\221\242*(e{\005\245Z>Ja\177\344\231\345{x\202\223\277\356|\316\273K\r\300\370\344\310\316<\251\032\366\333*\310v:\225@\204\222\220\262k1\022\355\211+\371\260\335\261%?\364\220\216\255\226q`\257#TA\262\262\273\320\362\201w\327.\360\356t\343\326\323\362/\362\006b\242ra\236'"
+	.string	"\302\356:/\354\342\326\3336\260}`;#\b"
+	.ascii	"2\003\316:#f\b\3055\3616\002g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_applyAltHold.part.0.143.1a5269929cf4b497,"e",@progbits
+	.string	"(\265/\375`{\001}\016"
+	.string	"\006\033^C\020\221\223\016\033bB0\301\260\205@Bg\350\225\215I\336\354\310\033S\343\326\323\351\036\033\316U\331\321\376g\361o\316\262l#\234\205\255\r\002"
+	.string	""
+	.string	""
+	.string	"*FC\0211"
+	.string	"\347\002\270\365\037.B\366\336R\246\024I"
+	.string	"F"
+	.string	"L"
+	.ascii	"&\311`\222m\343\235\312>\265\272\220\322\261\273\330\241\212"
+	.ascii	"8\351\360iF\222ouP\317\026\034\033WrhuXjl\034\207\277\334\270"
+	.ascii	"\r\327\rWz\004v\367\335\363\2043e\006x\264:\273\353\253\303m"
+	.ascii	"\335vf\333\200\375\031\001\320\027\305\303\353\273\277\0223="
+	.ascii	"N\270\230\344*5\305\032\377VQl\230\266`:\3024|\351\367\322\372"
+	.ascii	"\322\251\351\003\020P \306.\206\025\217\r\001cX\374\024\357F"
+	.ascii	"\356b\325\220j\331\335\221\373(\022[\2439<\n;0\254\272vw\201"
+	.ascii	"\357\342/\032d\036O<\204\3721\"FS\237\376d\242\224+\373,\336"
+	.ascii	"\342\343\257\030D\323\342aj\002\032\036^\356n\211\332B\274nd"
+	.ascii	"^dL\271\303\357\034\341+D\256]\223\002_\305_@\376\312\241)\210"
+	.ascii	"\362\333\003\366p>\016*\214\264QH\206\215 \200h!\0170\tZ&\202"
+	.ascii	"yB\"\2143\300\240\t\237\0206\002\201B\230\306v\376\255\242\240"
+	.ascii	"~\301|\220a\242%\250)N=p\006$\222s\325\023\333R\225U\037*0\337"
+	.ascii	"f\242B\265\364'\020O\243f\216\323\r\004\017$ p\002\031C\363\355"
+	.ascii	"\tx\3148z#\254\310P\bFH\\,\231oL\261\313C\0260\200\033dJ\030"
+	.ascii	"4\234\335\311\242\230\324\207\270?!\300\021\205a.\234\217\206"
+	.ascii	"\276\216'\214\271<17^ C\027\312\314\333n\201\330\357\262\322"
+	.ascii	"\2113M,\275\255'\2041"
+	.text
+	.section	.gnu.lto_updateAltHoldState.part.0.144.1a5269929cf4b497,"e",@progbits
+	.string	"(\265/\375`+"
+	.string	"\205\007"
+	.string	"2\31504PO\323\001 [|\213\261D\205\307\367C\231\312\264\340\353\271l\306\265>\"\323\354\334\263\372\203-\020j$1\351j\3354\367\305&*\255\bAvo\271S\n\256$\353\340a^\023\243\344TH\2700\004\311pQ\013\262\322\034\2444\340\254\301\322\344\3142MF\266\337\341\252\307\323\204R\250~\\@VV;\034\037t\b\215\035!\361\316\371\335\rFZ*\224\363\364c\205\207\253\036[\005\244\223\335\213\031\231\345\210,!\366\273\215\035E\2177\261\275\301\360f\277\034\345c\257\262a\221\022\263\273\362Q=\276]\037\334\374\307u8\327w\207\"$0\\'\343/\340\020`\332]C\032w\274\355\002\333\004\266K\002\021"
+	.string	"N\023\030w5T\032Z!8@\024\fs\205\243\206\2608#\026uN\247\2056Sv\032"
+	.ascii	"\256=\244\260\320l\351\te\f"
+	.text
+	.section	.gnu.lto_updateRangefinderAltHoldState.part.0.145.1a5269929cf4b497,"e",@progbits
+	.string	"(\265/\375`,"
+	.string	"u\007"
+	.string	"BM03PO\323\001#\017\221eT1\305MMg"
+	.string	"L\004|e\207\3553Z\037\221i\344\370\257\340`\013\204\032IL\272ZG,\367\305&*\255\002\372{\313\235R\236 JAbV\323\222\344l`\250\254\005\371PI\016r\302\"$T\340\013\202\302\344\274.L>\266\337\341\352\306\221\205^\250rZ4RVC\034\037\334O"
+	.string	"\330\024\025\357\233\337=\001f\005C3O9Vx\270\272\261\225\340\340cw#\346eA\242\n\211\375.\263\237\347\361\234\355\214\303\232\315\362\223\221}\207\313@q\331]\371\250\"\327\256\017j\376\3334\231\353\273\303\022\223\316\246\351\370\0338\f\210v\327\002\036w\274m\004\333\006\266\271\021"
+	.string	"O\023\030wuT\032_!8@\024\fs\205\243\206\2608#\026uN\247\2056Sv\032"
+	.ascii	"\256=\244\260\320l\351\te\f"
+	.text
+	.section	.gnu.lto_calculateAltHoldThrottleAdjustment.part.0.151.1a5269929cf4b497,"e",@progbits
+	.string	"(\265/\375`3\nU5"
+	.string	"\212\\D\024@P\350M\007L6\350z\020\002R\314\256\034\261nP+\267J\017T\221\337\344@\232\364\350`U_cL\373ligl\b\375`\033\240_8\265\2214_\233\206\311\355?\274C\210\354\266\367N)\2451\001\027\0014\001\204\\\254\235\002\275\225T.f\27126w\32215;\177(\256NZ\007\327t\372\215\371\307=z\016\177\035\033^\217\036w\233.\3567-\247\335\370\327\306\306\266\210*\016\0348\306\340\021x\217f\214\320\246\326N\327\334\0309xtc\\\275\224+\033\263Fw\367\336\250N\231\304\n\204\371\247\266f\r\026\017\357\235\326\345\274g\237\206\331P\340\035\0026\004\203\267\263\317\030Q\347]*\231\275\317\030\331\336KeP\333\275\227B\247,\265v\312\334e\272\224\314\314=\246\311"
+	.ascii	"a#"
+	.string	"\352l.U3\274\344\032\274{\257\260\323`3\251\235\242\255\244v\372fm\354\237\317\256=5E\337\221\214\334^\375\353\205pk\024\314\033;d\362\250\034q\322>\001T\2164iK\247d\322k\323)\227\274\365\202-\312&\336s\261\245\222VS\\\261\373\022\267\266T\322i\3222\f\r\336{\177\313\244\243(\024\231\334X\322\362\2102\355\2512\250\345\222\376(\324\235[\242\244%\022e2\222E\254\335\332\207,\301\334\0074R/\304\275\227\373\353I3\200f\3467f\356\301l\345\002-f\245v\332\337n\335`L-\314\222/\177\3723\371\221\372\237\317\347\223\277\214\331:KEYg(\353<\301:Kx\347\b\357\f\341\235\037\264Z\267\203N\353n\360\316\f\254\363\202\3259\330m\315\n\254s\002\353\374d\235\021X\347\003\326\331\311:\033\260\316M\326\271\300\352L\300:3Y\347%\353\254\264:\017\3609\013"
+	.string	"\266\263;@\022"
+	.ascii	"\353\214d\235\177\326"
+	.string	"\331\267:[\237\363\332q\232{\326Y\265\316\251uF\255\363[g_\235\333\302\222\360\311\275F\236\215\256\224t\216\226n\353\216\323\275\326\206\370B\206.\336\261^\264\245\244\232\031\336\335=:\243.d\340\342\035M-\245\214\231\240\273{\235\302N\033Pw\237\346\340q\0203\\\360\350l./\234q\222\301\273\307\033\325\203\031\316\327\247\br\021^\247?\346\346\006\024\310\216\203_\316\253\264\013~\001\3571,P\033\237\356\303\355\207\177t]=\327u\314\\U\236`\346\270\351\370\227\247\365p\365\236\255\276b\267/]2Ln\267\236\300$\311F\005\360TuR\244\247\362\202\372Y\313\265\225B\207\354\201\274%\375\020c\227=\375\026\\z\246oDJ\017\374\245\357\341\031\360JH\210\035\\\351G\246\204K\025\024`\330N\007|\207\"\002\376W\306\226\267$\300'=\3605\270Q\204D\003C\357\275\267\347D\214&\206"
+	.string	"\276YVGV\306\343\302\214\240\251\033\364\024\342\222~\231\237=\237\306\004\245\315}s!4s~\320g2\020:^K\306\3648\021\304G\256\357\357\221\336\341\220b|\337\373\337\367\034!\267\200\371\223\355\373\276\223\217\370\204'\211\037\230\271\202#\2472\330\335{9\240\3600\025\302\346\275WC\247\354\307\034T\334g8\324N\355\177\270b\306\275\374\013\307\212\026-\324N\327\377\325\261\311Sr\237\372\314/bx\213\365,s\251'\357.\354\275\370\007\221\364\325gG&:\324\f\247\242\237~\337iT\314\225\266/qj\207\300\336\037\375F\242\2011\222\361o\271\361:\317X5\034~:\246\226\327\315Ewm\377Lf&\252\3753\322"
+	.ascii	"\035}\021s\037jDD\3563\266a\345\001|\243\302\326\215b\025\226"
+	.ascii	"0G\026\026V\326\320\311\207\f/^qm\021\265T\255,--bzEdQ$n\251"
+	.ascii	"4\256\262\\\f\207U\253\016\254\242\214+\"\217\036\017+\020ip"
+	.ascii	"\025\255\212WU\302\342\r\033VW5\2049\254\252\260\204C\255-a\205"
+	.ascii	"'\316\322A\324\022\026\263\262\264\204?F\357\227\225\0202&\311"
+	.ascii	"\346"
+	.string	"\213z)\226z\016\361\365`\277g2U\035\313\364T^VW\322\375\246,\244\245\347I:\001\324+\370(5qi\177\324\320\202\004\232\360P\235D\302O\370\266\023\341%|;B\316\2615\203x>\357\216\367~5\200\360\021\336\t\017r\313\203g\360\020\034|\203\177\360M\216\220d\013\236\301]\360\027\210p3b\207\246\225)\241\035S\005\205f\360\003\034\343\362\314$\370\247W\360\335\007I\346\274\b\376\351\177\254\375A\212A\360T\332\255\037\250\201K\373\263f\310\370\344\336\003\217\200\353\356u\372\003\337u\f|\323;}#\311\300\032\317\311\214#\206\006\236\300\225\002\017\374\246\357\301\021\370\002%\374\tq\203\235\223)a\263\211\n);\002\205\230M\2622f\276|\317\264_\306\374&\n\2241;'\202\370\314\035}\221\033\242=S\326\017\200\316\250Q0&\225b\206\206D$M\nY\016\220\002\021\"\233\252\003\022"
+	.string	"W1J\025\322\226\244RX\366\277\003K\207)\344\243kI\215\237"
+	.string	"\257lMuo\200\032 ;\203\020\0321RJN>\005\240\226\260"
+	.ascii	"\236\035\b\260Ui\352]\326\037\260_\344\210\315\340)\003\n}E\237"
+	.ascii	"\033\2551l\216\242&(F\275m\346e!\375X\371\304\276\202\24145X"
+	.ascii	"\331\002\275-q\243\001u>\031\023\314<\202"
+	.string	"M\013^\362\324;\032\376\003\302D8\"\031\205Cn\263C\255\266\270\003\311\222\0309\020\035\346\321\263\r4\3767&E\341\316\\\224\"\306\243\265\331\200\325n\263\r$\371\2424JPj\007<+\006\262q\342\347-\257\272\306\355\304\267\322\250:\233\331\212\276\031\316  \334\360\">Yi\221\204\301\024[/\273h\201\023j\354BXd\312\247Q\260S\003\030\374=ks-1\2706i\276\302\202)V\361\244\261\347\302\202Op\316\031\350\377\332\030\253\226\312\213\351\030\\\274BI\252\020y\371#w@\022t\311\271\274ipA/\356b\223\303(3b0*\020\245//XH\222\342\317\013\315)\235$T\220)/h\266\240\242\004\002\204>\375tG\226\340r\b\004\2332wc\355\200\375\351{Uo\021\004\204\273\227Tb-\203j\034(\364\336zy9\234p\255.\273\250\377\b\241\354S\314\207A^QQ\376"
+	.ascii	"O\345\351`\252\361\211\264\032\2020\331\375e\027\305\n\357\017"
+	.text
+	.section	.gnu.lto_calculateEstimatedAltitude.part.0.152.1a5269929cf4b497,"e",@progbits
+	.string	"(\265/\375`x\013-8"
+	.string	"\332_\240\024B`\350M\007\367J\b\201Z\030\025\247$\f\017\264\037\361\204\330\002Z"
+	.ascii	"\004\034\027\344\f\217\315\320\213(\032\351`\270\221\341\217"
+	.ascii	"\247\033\357\262o\267\237r\373Q\004\201\204B\275|B\215DD\210"
+	.ascii	"\334{\247\224R9\001\026\001>\001\316h\352|\242\316\217:{\263"
+	.ascii	"u7\ba\025\242u\355\321\"Z\225\240h\2464\230\356/\355\314^pp\203"
+	.ascii	"\3517\376\265\341\350/n4x(\346FC\314\036\"\315u]'\360\032\355"
+	.ascii	"6\376u\261\301\3732\362\306\350\030\323\\W6\253F\331\001\217"
+	.ascii	"\335\233\rGs\271q\262\255G#\2733\267\226\336\2426\227\033\334"
+	.ascii	"[W&n\314\254+\033V\243|\305kt\330\302\264\321\263\225\322F\231"
+	.ascii	";\0133\3430\262\312\334\247\331\316\326\016\3636\346Vh]Wb\243"
+	.ascii	"o\326j\013\227\224\222\220\216\214\202E\300\237\257\307\273)"
+	.ascii	"z\2763\251\334_-\274\023\230\370H\353%\264VB\213\342IP\032\t"
+	.ascii	"J\322\217\316\332\250\351\030\317\222x\020I\027\251\031\2178"
+	.ascii	"\220\216\021\211\021\377M1\361Q\244}\347\360\215\334\230\224"
+	.ascii	"\223$v\255f$\342=5\343\020\3475\035c\221)5#\322\257\263G!\235"
+	.ascii	"\236UH\340\374\230\323\204\317\357Xt\324w\024\322\347\357\230"
+	.ascii	"\343\034\256\353\032<\212\371\237U\3153\203\202\307\261S\330"
+	.ascii	"C\n\333o\355;\216a\356I\315t'\254\353\312\r&\245\271\251\231"
+	.ascii	"{e\346\013\314\276\262my\270\325\364\032\013\0272dH\033M\377"
+	.ascii	"z\361\243D\242\317\r\327q\314\324\300K^\246\215:\035[w>\372~"
+	.ascii	"W"
+	.string	"l:9\363\206\016\336\354\371RdYP&g\376\020\302\233\345 \334\025\216\323\202\305\354\374\262e\377s)9\263\210\021\336\354\277\021Y\025\271\260\377\342\357>3\324\\\376\2271\263\214\324\337D\233\03617\304G~v\211\224\371\204\2267\353\017\204[\223\023\373/\356\347\026\323cnp\243\261\212-o\266Q\356\255\264\321~k\003^\356\330\031\001\363\326\277\214\237\251\277m\333C\374N\230\257\263\202\324\231x\235\263\2563V\352|\325_\232\255|\316U\3279\301uFp\235\251R\347\003>g\003\327\271\300u&\320s\036\220:O]\347a\317Y\352:\013\3509G]g\250\353\374\304s\016p\235\235\2563\200\324\271\351:3]ga\352\274t\235\225\256s\322uFJ\235\217Rg#\3249x\235\213\25630u\376\241\316\276\353\334C\235y=\347\313sNoJ\344\007\375\213\231@x\311\201\331\262uN\255\020"
+	.string	"\357\324\364"
+	.ascii	"\372P\337!\362\3464i\243M\337\373\321*\231\354\206\b\237\351"
+	.ascii	"O\272\245\027\022\032\264d\207F)\0203\213\360\322\323\260uI\217"
+	.ascii	"\364J\337E7F\237\364']\261y\364H\357sW]\247&y\315\376\243\036"
+	.ascii	"Q\223\250K\226\244\215\036}\357G\"%\0320o\333\266m\213\276\214"
+	.ascii	"\255\332\350+\350\241\353>\234\246\t\307\305\245\215\032\275"
+	.ascii	"\200<H0o\333\266M\004\fz\360\201p\204\356~T^T\246Vaf7\331\323"
+	.ascii	"\205m]YB\333\006\022[W0\002\300/z\007\313\266\250\026\346-\003"
+	.ascii	"\3570\323\214\227\336\354\357\201_cI\250\330|R\302\346\304\367"
+	.ascii	"e\255&\323\337C\231]\371=w\235\266\243&\325(j\232\232\2266\372"
+	.ascii	"nl\235:\345\367Qdm\344\302\030\310\371Y\353\371\336\255\264\351"
+	.ascii	"\241\362\3363\253kj\025o\326\367\303\002\316\254*\325,\336l\357"
+	.ascii	"\233\212\022\036\357\210\367@\2705rb\367>3c5\034U\013\003<\353"
+	.ascii	"\2726\340v\323oT.\334h\2152\205\n\025\330\272\373\227\256(\347"
+	.ascii	"\033\n\316[\2404\330\026\322\364\373I0Zt\221`\2415\343\242@c"
+	.ascii	"|\320j\261\345\241\313\205\026\027\227\214\023E|\"K\013\205\214"
+	.ascii	"\256\255.\026%\210]+Tl\261HAt\261U\242\005\361\004W\fbV\024\277"
+	.ascii	"\200\241\305E\354z\361\202\213\370cf\357\t`\037&T\360kT\024\374"
+	.ascii	"\317\305\331!\211S\324\244\027\235\232\366wl\035\006\307\372"
+	.ascii	"\254\377\343\005\310\233%\376\260\370_hY\337CBa\246 ^b}\017H"
+	.ascii	"\234\022yu\246&\275\b\251isl]\005G\255\236\331\353\220\327\235"
+	.ascii	"7{\365MA\224r9\376\213\253\336\352=N\202*\004\237\340\237\316"
+	.ascii	"\253u&K\020|QY\031\345\026\252O\362E\365\021\3320\213\315\003"
+	.ascii	"~DM\206\251i\006\376\300\373\335X\"\b^`L\325\2216k\200\300\027"
+	.ascii	"\370/3\004I\340\177sd\224[\230v\204p5G\226\006d9\220\037S?\340"
+	.ascii	"S\272\261D\303\237\362a6\374\007I\245\265$"
+	.string	"\251wc\017\001/\365\315C\300/\310\203DrB\233\322\226\347\373<\212\272\362\035\252\026\242\263P\037\365\351\333\272\256\301\247\207\372;WT\013Sy\370\0303\027\260\347\360\242\332\343\250\222\221\245\215>}\203In\001\363V\n\213D\316\210M\007\370\024\036\026\340Q7\267\200\361\250\201,%\031ShHDR\220\222\244\320\001\220\002\021\241*\253\003\0210\275Sj\210HR(5\007\276\343I7\242E\274\357\217\347\333\002\246\370\330D\320z\3270\332\300\210\247>\351%M\r\371[+;\243\001\334\335-\"m\256t\202\252\231\225\343\273I\033\263;vc]\231T\225/\316\304\215\004\314\036OK\244\214'\035`\b\250UG\006!\242\347\215\302\306\001Y\221\t\3703\020\317\353=\001\313\254\204\310\033O\252\204\322uQ\006%\241\271\201\025]\023:x\244\303G\340\tJY\251\321\211\001\265\371+\225\300\216\r7L<"
+	.string	"Wi\f1b\260S\003\207\363\233\247b\376\327\001*\261\302\024f#UB\307jd\0169\226\343]J4\235Vt\366\236'\206\n!Tq\221\214\032C\2052\261r\360\004,\302\211\002\307T4\252\005d\230\256:\240\357\t\233\035\032\266]\250r\354\276G\263\007H\033f\352@\334\006\027\257\375L\314n\211\325{c\276\326\307\325\343\200W\004\023\340\354 \366\250Z}\t\360\273\216v\246\322\016\314\264 b\215(dDf\f\024p\341\245\b\274Dz\211b\034J\307\201w@\334\260\243(3h\312\301G\200\267s\002\337\200L\004\355\314\222@\030\3556\331\203"
+	.ascii	"Ir!\362\216\326F\352\371\231(r\222\3102\177}\307VQ5([\306\245"
+	.ascii	"\272\020\222Q\206U\246>\252\202\354[\204\366\275*5G\025\210\310"
+	.ascii	"\2520T\f\027\2136\240F\227\250j\354\201\274\317\221\3434\230"
+	.ascii	"\263\006n&\255\351\022\200\037\342\204Q\310e\t\215\257\216\030"
+	.ascii	"Q\206\r\252\373)\177@\364\322q&\317?\f\004\305\341<\037\2248"
+	.ascii	"GJT\223\022\337\004\217\204\326#\256H\261\344\245\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.1a5269929cf4b497,"e",@progbits
+	.string	"(\265/\375`\275\005=\027"
+	.string	"\346\344\206F\200\234J:\037\210\324`\003I\035\207Tq$\354,:3B\020<\215\341R+\352#F\202\361x\226\250\b%m\275F\376\340\343r\350\201EAA\2210\242\364\206\230F\225(\211\205=\302(\342+4\323\036\222\310\024p"
+	.string	"w"
+	.string	"r"
+	.string	"}\266\244\217\031\313*\005\251\377e\274p.\026\256\245\302\357H\211R\370\026\312\305b\2618\241\367\210\204^#c\204^\255\021\302\273\320\003\037\274l\250\226\245\351\2407k4:\233\242\257ip5\fNf\301\341\024<\013\345\232\340X\020\034\r=\360\300\253\320\377C\006n\206\362\277f-p5Z\313\262v\375\375\017\265V\247\326Z\211\372k\343\377\235\256B\0317\213\3613\030\037\2768\032\375\201T]YQM\271\370\025\3727]5A]EYEU1M\365(\372\232X-\236FY\364\337V\364\305\250\350\207\031\271\246X,\024\276\023\3772q\260\022'\243\007\222\370\330\210\213\211\330!4\304\226 \036\366\341^\364@\017?)\327\016\237\243\343\320\213d\\:\034\272\241O\324\320\007\223\241\3576b\350\267\215\277{\241\276\273Q\njXYO"
+	.string	"\b\361\216\271\333d.\016\355\302 &\372\001\375~\270O!\301 \346\256\223\"I\330\220\316?\202\253S}\234\013t\026\020L:\373\230g\"\337\231G\257\271\243\027\250\243\267\346\350\027q\364\347P\365\353n\364\345L\365\351\244\372m\242\372o\240\372q\236\372rN\3752M\37536\372i\266\326\372\377C\255\355\025\231\372q[#"
+	.ascii	"\215\242\031\017\337rwnI\221\2144\342\2455O\222\367\f#\2376%"
+	.ascii	"\n\223\213\221\314C\327c&"
+	.string	"\221\334\023\034~\214\344\036\342\036\261\301A9\031\311>\301\035\260%\f\276\214d\237\263\356`$\0230#\271w\222\374D\024\222,\345\326#y\207kG+rmJ\202z<\036\020\217\307<\247o\307K\334%\322v\266v\257\035;\355\337\320\250l\375\354\376\265\343\345\022\342-w\fm\250A\fF#Y%IRRi\003\320\002!\252\232\016\021\260\030\344\212\224\310H$\201\310H\017s\3527}9<\271\177\314\231\235&k6\257+\222.\fw\242\337\2368\311s\347;\f1\344S\274X\365zp\223?\370L\270\327\\\254\326u\006dG\237\236\313@\306#\325\345\276o\327\375\272.\367}\373\372sh\205\034A.\215\013\"B\242L5q\203S\210\250s\205c-\026\347\335\350\007,\215:\004\"\217\224\027\345\\\274\207K+\004k\033\201\350\203\272[\310\262\302\271l\036\317s\366vD\222Q\356Hm \255"
+	.ascii	"\356\322\262\306\247\274\213\316\273\216^\262\232\346\234\302"
+	.ascii	"\340\207\001\\LL4\316j\202m\360\005Q8v\252"
+	.text
+	.section	.gnu.lto_.refs.1a5269929cf4b497,"e",@progbits
+	.string	"(\265/\375` \001U\013"
+	.string	"F\032M= \221\222a\fA\030|\272"
+	.string	"\3406<V\332!"
+	.string	"0"
+	.string	"P6\306\036+\325\375\002@\002@\002@\"\006\005>\370\033V\364F\025\377 \036\3049\216\215\250\240\277\241Fh\2545B\266L\0015"
+	.string	"B"
+	.string	"<"
+	.string	"\233\306\f\3522:;\206\264a\274p\301\331-\246\263"
+	.string	"\360\025\322Ul6\212\232\315Gl\246\221\236\221\206\341<\332,\232N\231.\221\026\221\366\254\253\355\332\243\327H\240\247\003\rPW`\310\236\200,\t\310\037k\017\002S\353\t\264\364\361\006\024\320Iu\226\323y\352x\237\034\323\205"
+	.string	"\361\301C\007\016\033:OC\006\f\027,T\2400\301\363$T\273\b78\267Q\243\n\"\321\206B\257,X\224\320'\n\226$\364\310\312!*\013J\331O\265\0255\205\262;Y\202\222\223\3113Y\262J\234\235\024\301\032\241zl6\300\366\323\261\034 \353\021\331\3123\365\261\235c\226\314\372,\b\222\203\365`I\013F\272\321\227\035h\203\fv\n\227\215\342D\3076!z\t\227\327\2146\211\251e\213"
+	.string	"-\315\364L\2652*\307T\013\303\362K\265.\323-\324,,\033\027"
+	.string	"\n\023^+\2726]\201)'\245p\3022\260\002\366\3002\260\002l\201=\260\f\254\200=\260\f\254"
+	.ascii	"\353[\266\240la\324.\330kP;\024k\331\003"
+	.text
+	.section	.gnu.lto_.decls.1a5269929cf4b497,"e",@progbits
+	.ascii	"(\265/\375`\353>]\016\001\252\237\005\\W LI9\351\351lU\345\334"
+	.ascii	"\305UW\346]\344}\306nU\325w\365\337\314V=\325e\357o\376f\376"
+	.ascii	"\366\346\346\217\355\0327\272f\250Ud\261[\021\310f\273%\370\331"
+	.ascii	"\325\345\371\345hyl\327+\217/\361(\355|\267\306\303\013uZr\177"
+	.ascii	"\001\252\252k-\331D\356\024\327\004\272\005\370\005q\037\020"
+	.ascii	"i\002&\344l;69\307\2611s\316Bb=\344l;I\315\f\304\327\245.\f\224"
+	.ascii	"<\234\273)\030/\344\334\017\315e\223\324\314e9\313\032kV\372"
+	.ascii	">=\303O\305\260\255\262\034|\033\206\340\247Y\370i\025~\n\205"
+	.ascii	"\2376\341\277\203`\320\254\301\264cK\213\247\314\222()};\353"
+	.ascii	"E\330\022\220'c|0\245\220\301\272\352\250\226\321V\275\243ot"
+	.ascii	"S\333\350\032\r\243\235\232F\277\320R\255\243{4VCu\214\366\321"
+	.ascii	"O\315\243s4\220\376\321T\215\243\247\272\252gXgg\365\213\367"
+	.ascii	"R3\375\202\t\243\305\344\322\305\234\303\"6\266\005\214\371\374"
+	.ascii	"!e\n\3333\214\214\312\363\t\224\270\347\234\226$L4y8\324\312"
+	.ascii	"P1\357"
+	.string	"\316\344\270\303\313\27233\305T\243\262\366\224\222%\354y\2066\245\213\027\256\247\234\0323\214.\215\tfg\366\314\262z\355\002m2#\200$\365\004\353,\333\304:A\307\232\360\032\222\22431@\254\\\261f;\313\236\234\204tf\305\2524y\346\334\274\313\262_l\034\332d\376\230\\m=\355Yg\331:k\2066\3330\013%hO\020? n\322f\320pk\300Ms[\212\204\3370\3304\335\002\004\025\364\025\031$\267\276J?6^]\236t\365\375U\203\037\202\215\201IE\263\350$\353\354\025\235\337\312^\3366sN\3129\337\2165\222\215\333Q\366d$;\030\314\234\233\377\340\027\372=\b\241W\330=\033\367\313u\231\005\223\253%\024G\234\026\272\274\234\233 ~@\200\260\321\302\303\312\030|\177\337\360\217\345\340C\327\360\257\032\376E\303V\215\320\355\032\r\276&\250f\346\301I\232\201\266\325\327\306\211m"
+	.string	"\276p\317\335\302\277T\370w\t\037M\203\217^\301G\341\360Q&\370(\021|\324\n\237\013\032\003\366\220\327Y\360{\r\277\273\360\273\007~?\341w\306\267x\370m\266\016\337\262\341\016\354\021|\373\003\337R\341[\027\270\2037\013g\235\030\330(\367 \204\243J\262\f\246\023CW\fzK|\213\201\317\356Y\f|7\342\020\226\203\317\272\341\320\251\331\301\350\373\016`\273f\331\254\323\266\3756\315\252\375\222U\345\262\234\233:\350\262\206\034[\337\333\017>\036\373\301w\025\260\007\313\301wG\300\257\263\034|V\211-\263\316\r,\223\333\246\035{\272l\346f\316M\236\376\261\346LI\337\177\200\377/9\005d9\204\353\340\333\r|\350\336\236\335\300\367\306=\226\203\257\233O\313!\311o\277,\330\007Ti\251*\233\345\334\364\321\201A\013\022W\3377-\007\037\266\032|r]"
+	.ascii	"\001\264X\324\337=I\254\r\027\036\331\006\317&\302\324\n\363"
+	.ascii	"\367\005\323\227\300\177\355oo_}\261\342B{\021\300\217&y\323"
+	.ascii	"\242\362\375(\2175\265\316rF\343\357\f@\\\340\303\375o\fmweo"
+	.ascii	"\357\267U\332\212M#w\237\037\375\372-\323o]\374\266\351\267K"
+	.ascii	"6\017\347G\361\360\354\340\336~t\351:\273\246\373{j\256\345\234"
+	.ascii	"\264\217*#\254\033z\025\244\251x\371\005\267\371Q\031=EJw\\;"
+	.ascii	"E\001\301o=\360\333\017\374\260#\374\226\204\277m\370~\213\376"
+	.ascii	"\217\362[\374[\r\277\265\371\355\001\372\355o)(\377\177\376w"
+	.ascii	"\340\277\001F\374\277\340\033\374\375\344\357&\177;\377^r\024"
+	.ascii	"~4\370[\025~k\201\337\256\360\333\n\374\266\001\377\177\377="
+	.ascii	"\301\021%d\371\357\365\267.\374G\377\353\345\357\341\337C\177"
+	.ascii	"\227\370[\370w\360o\365o\342\330\337\024\370\033\004\177\177"
+	.ascii	"\240\371\237\347\277z\177\213\375\235\344\357\257\277\273\376"
+	.ascii	"6\3627\221\277\205\374\275\365w\326\337=\376\336\3617\325\337"
+	.ascii	"7\376\206\372\373\351\357\030\177\253\370\033\351o\345\337'\370"
+	.ascii	"\273\004\177\037\375]\374;\004\177;\340o\020\177\177\370\355"
+	.ascii	"\336\337\005\370;\203\277\005\360\367\005\177w\370\233\202\277"
+	.ascii	"5\374\335\363\367\316\3379\177\333\374\375\373\373\376\375\337"
+	.ascii	"\246\371\255\334o\363~\213\367\333\267\337\212\371-\230\337\272"
+	.ascii	"\375\326\313o\317~\333\345\267[~\233\345\267v\277\265\362\333"
+	.ascii	"\271\337\302\375\326\311o\327~\253\366[\264\337:\177[\366[\262"
+	.ascii	"\3376\177\033\366[\260\337z\375\226\353\267G~[\344\267C~\313"
+	.ascii	"\374\355\323o\177\374\326\304o\263~\353\343\267F\277%\376g\362"
+	.ascii	"\333\027~\313\343\267!~{\365[\250\337V\3756\307\177\n\374\366"
+	.ascii	"\370[\251\337\316\370\255\214\377-\374V\371[\022\374\366\304"
+	.ascii	"oG\360[\021\3746\004\277-\361[\026~\373\200\337\226\360\177\002"
+	.ascii	"\277E\300o\201~\233\200\377`\377\217\377\251\374\337\260\267"
+	.ascii	"\267\267\367\343\342\237\323\365\2038\022=9\351j\215Ye\313\026"
+	.ascii	"4\3526\263\223\002\306\266\324p\265e\311\202F\241`B\033\f\317"
+	.ascii	"\2350;;4\352&5\263\223O\013\217J\0248\255#\370(\235E\255X\261"
+	.ascii	"q?Y9\306C\227\333N\017|k\343|q\350\\\034*'E\n*gs\223\006{\370"
+	.ascii	"\313\256\214Y\225\243rh\324N\230-\317\246\276(\0254\312\352Y"
+	.ascii	"mI\351\213N\341Y\033\343\362\243\357\315\234\315\032Y\353B\353"
+	.ascii	"\373\035$|\035)PP8(oo[\276\2306\3155oa_\370:5\332P'mnnd\224\250"
+	.ascii	"\223#]K\372^\007\t?\247\013>\007\026][C\243<t\341\345\260\251"
+	.ascii	"\251\241Y\030)\347))\017D\254\240ZX\344\230\3532C\321\314P\246"
+	.ascii	"/g\333\254\212\321tv\2062\2612ge3\307\370\241\303\203\372\260"
+	.ascii	"\303c\n\026\037}\237\003\004?\007\312i\235\250\263\321\334%Y"
+	.ascii	"V\206\340t\005\212+G\271b\315\2155ee\215w\323\244\274C\213y\023"
+	.ascii	"&\026\245\t\03222\025V\302\322\344\3000\006C\227'M\353D\233}"
+	.ascii	"G\202Y\325RH\b#\312\257*8aZl\321\002\022f\235h\230\215\273J\262"
+	.ascii	"\034\343\206\205\020/.\032mc8\031\f\354l\267'\277@:cz\361\362"
+	.ascii	":\033\nY\305X\210.e\346\3407S\270n\235(W\323\335$\262\254\324"
+	.ascii	"\220\226\2418\320"
+	.string	"\271\233\3133s;r\353D\217\240XXE\316\313(\020\214\214Aq\240s\205,\r\017\254\210u\242EZ\213\004(\262\374\304\243\245$\002\225\227s\034\007(\322\225 7OC\254\023\035\322](\344\345\223\006]MM\016n\243\006\037\325B\267\216\006\371\321 (\323Be%\036\bb:\266\324\344e\250\246\017\377\315\034e>L\316\005\351\225\"[hL\260//\233r\316Oi37!\345\334\246\326~\370u,j\007\2203\210\023\344\274\214\302U\006\023a[\336\270\207\374\264.\347$+%\tVNIV6\224\312\254\2622iK\351\323\224\255\224Je9\373\344\244$\245\tU\331G\251,;e\025W\234lnZ)sRU\366\311Iy\351A)\311\312I\251l\351\344\243Tf\345\224\313\254rONZ6\265H\312M>\271\314\n/\227U9\365(\225U9)\225Ye\331\265\026?\302\236\340\270x"
+	.ascii	"\261:\224\2222\f&\034\313\246\236:\245fU\346\222\2635[\221\233"
+	.ascii	"\006"
+	.ascii	"\2203\216\252&.K\033\266\r\251\016\006\222\332\262\3126\231\220"
+	.ascii	"\256\252rR\235R\221\252\234\213 \021e&\020\224\315\272\354\303"
+	.ascii	"\326)w\340\310K+r\266\200)g\245\315u9ge\316\371\327\204\243\231"
+	.ascii	"\263T\217\022\223\211)g\250\037\246\214C\351\266\"\3476\273k"
+	.ascii	"sR*\273\252\022rs\22613\213\246\32223\027\253&\\\246\034\313"
+	.ascii	"Kd0\323I\306\230\276\315&N\333\324\331\214\276\315\035\337\021"
+	.ascii	" ,\334\372\242>~t\326\262\226ON\030}a\003y{6J\214\362\340\261"
+	.ascii	"\321B&\207Y\036\266B\257l\252\244\224,\237VhU\016\223\024&Y\346"
+	.ascii	"P*\024\007\232\343\350\324\321\251F\247\320\275=59/y\254\315"
+	.ascii	"\300\332\f|I\2600\361\335\220\352%.\2266\372J\035\215\352\234"
+	.ascii	"65+j\364Ek\2406\254\363o(\224\217(J\037p\030\305\357o>\264\t"
+	.ascii	"\007\215If\r\235!\003D^\017\262\276\350S\207\033\2664(\247&f"
+	.ascii	"\2012\345-1O'4\206u\242MBh\023\232\204\256\260uX\327\253\313"
+	.ascii	"\263\003\210\213\226w5\305wo\307Z\200YBa\240/\254\023ez\253)"
+	.ascii	"\3653\f\312\204\272\350\347\316\262\231\233n\264\306\256\246"
+	.ascii	"\220a<\364\360=\266\302\3078\3601\024>v\302GW\374(\222\225\362"
+	.ascii	"{\2022\346\244\257m\n\035U\201\266\301\255P\323\367\230\t\373"
+	.ascii	"\254\206%\232\277,\311R\353\213\346\216\241\365l\035TF\273dT"
+	.ascii	"i\235h\356\275{\020\002\330\317\017\257\311\223\356\336\377\324"
+	.ascii	"\340\377\254\254\321\373\202\2732\353\333z\335iZ\315[\257a\310"
+	.ascii	"Ij\275\233\363\322\332\fv\254\315 }\323Z*\361\335\377\250\344"
+	.ascii	"\241\261\315\252\2565}\337h\3766\323g\222\254\2120Li\372\266"
+	.ascii	"\006V\203\257\311\b\275\313\3548u-A\353\353\323c\360L@A\205\341"
+	.ascii	"\365\323V\345l\266#c\t\227T\337\006\323a\254\263C\213\261c\260"
+	.ascii	"\220\234\372\376\367\004\233 g\333\301g\367\366l\007_\207\037"
+	.ascii	"\0227\252\036^\356|,\250\312\350\372\276\357\272\313\331\272"
+	.ascii	"*g5\334\302\314\2324}mV\n\275\271\214\360c\207\327\026\272\234"
+	.ascii	"%\263\351\254/\025.5\2703f\0243!)`gP\336\320\230jS\276\230m\245"
+	.ascii	"\2634\226\236k\273\256k-\326\331t]\345\366\256\345~\317\350:"
+	.ascii	"\356\2056\275\270\274\2343\312\264G\2253\334\376\345\300\377"
+	.ascii	"A\341\377j\340\377f\340\377\236\360\1771\360\177K\370\277\026"
+	.ascii	"\370?\025X\rC\271\362\262\001\266d\212\024'\tcjmf\343l\035\324"
+	.ascii	"\b^l\317\26355&\326l'\315\271*NH\255\313\254\231\255\303\312"
+	.ascii	"\367\005\023\315\024W;i\267^\353\266f\263\316Vk\264w\232={\203"
+	.ascii	"\370As\340\340bf\347\346\370\242\340\373\314\360"
+	.string	"}`\370\276 \370>+|\237\f|\337R\311\0068\351I\032\030\331X\233Y\023M\337f3\t'K\354\f\02038\254\223\364W{5\230u\266X\027y\033\351#\037 \351.[gf\002\0303S\3224\236(f\250\332\272\340\364\254\273~%\006-4?t\270\031\003\354\rF_\266t\311XO\316]\231&fR\312\260R\252\255)oJ\304``{\213J\321\254/+=\222\306\256\031\266)*9\372\212\211\241\314\037$cWSc\232>\236\214%I\222v\375\230\352\364\342\260\222\026Tdz|}],_\220+e\2420\371i\201\004I\332%\304jo*O'OI\301J\271\236v\245eogUP\214\030\271X?8\203\r\331{\342$5\270\2520\"DP\346\217\220e\232\0317*\262\224\364\350\373\n\254\230\314T\310O\025*fH\232\031\\\277+5rHB\204\020\271Z\342\002\004H\272\345"
+	.string	"\245\027\027\027\352\325B\013\225\326\323-\0353K\352\302z\314\305P\223\246\016\013+\315\332 \366t\006\207]\017\027/R\037O\263\220\214"
+	.string	"i\262C\207\013L\226\250\"=z\244T\037\222\270yq]4pY4\372\236\202+\035:\322\035?UJ<\r\220<\215a\346\335D\001B\307L\257\236\356\350$#N`\372\246Vh\224/Fs\314\023\215\362u)\242\203E\232\034\317\221RY+^\\\\?\266\034L\246t\352)\2255\353\2547\266:\035\367b\365\342\n\027)\251\364\206\217\311\2200^\330\006\221\256\0267\272\353~\201\333S\343\2341#\205\302\371Q\027\006\312\016\322\n8\250\324\306\r=\2549\033i\r\257\272%\222\346Y(\311z\322\227F\027\371\201E\313\326\017\247\337)}\262d9\306\005H\224WS\037\322\037b\304\\I\237\330l\240~4\365=\207\033\230\305S\246\224E\032\303\232\261\315\fU\245\034S"
+	.ascii	"\252)[\216\344e%\034\037\206zPUIa<\215\361*{K\332\254\322\027"
+	.ascii	"O\227\266d\241Bf\207\323\026O]\334\220\341\245\310\234\322o\223"
+	.ascii	"\203UenL"
+	.string	"\034\376\0067\025*\320\036$\230\345\245\323\207(K\2736\037\255:$U\370O\221\376\024\251\365\256[\336R#/7\305q \324\326\244\264\224*S\345\2204\317\033mlZ}\277!\357\375{h\326\315\273\201\262\242Z\361\005\315\357\0324\367\216\304\n\233;\273\251\347\3052\305\303G\337\253w\325\244\201!\017J\230\3372\036\204`\2357\3145\363\001JI\306\203\021\245\336\023\023\224&X\232\343\b\032\266\276w\314%s\361\356\363\212\321`\344\313\027\024\353^yi\303\312\274\246\025\253\261_\264\233v\307\356\235\020R^vu`d,\307\007[\223]\337.\277\027Qi\032h\340[\260&\227\215\013\232\266\273\006F\367\344\276\035\251\362\214r\351l\035TONZ\373\362\264\273nwmG\351\223\363\2169f\226\313\345n\271X\356\225\253\305:\257\335\205\373M\273j\377\271v\327\211\034\216\0263A\352vn\223\203\271"
+	.string	"I\t\205\260\273'\335\215\273s\266\016\252\231\237p\232\f\361z\252\273V\254\363\322\375\247\231\263Y\007\035\275.ya\276\271+\327\346\342\006\213\276\267\212-\243\362b\207\231)\326y\251\360\260\030\262f\253\357\225r0\267\205\322\305\213\267K\303\355Kn\f~\206/\370\031\350\360\205\202\263<s\314I\301\317\360\206\237\241\r?\203\031~\006%lw--\233Rfn\315\306\331\311-!\211\341\376\300\344\236\335$^m=\322\314(\220E\227\326\367:\233J\020&\323\222\035.[gcei\332^\231\250\276W\t^\221A\310\00679\326\250n\364\375U\362_-\013\306\205\2755h\372v\232\320/\331\034\334SL\n\337v\331\013\3447\f\310\025\373"
+	.string	"\225\237F0\202\203\003\034\033+\246\270\365\275y\206Y!\325\367z]\260\233\344\267\261y\262d\207\343\t\377~\335`]\3212\322\267/\327o\327o\363\003kJ:c\302\277G.\222\337\006]S\345I\213\276\317\240\002\377\0329\201\027\035]}o\021\274\302\347\314\0066wd`n\221\377\006\261a\227\310\322\r(1}\257\220;\344\227\310e\346K\004\204\252\234\227\227\b\317\365\272\n\202\346\273\367\301\303;V\203\357j\t\375nu\0203*T\372\352\370<\3017\353f],\024\262\227/\346\215\0231M\2651|_\370}\341be`\376\234?\266\236\276\032\3165\270\276\027\313\247\"\f\313\307\312\336\035<\316v\263YVAv"
+	.ascii	"\"x>W\370>P:t\344=}Z\340\337\034\366RQ\251a"
+	.ascii	"6\245\230G\366\244\354\305\201\343l_\323bG\256\322\362l\330\033"
+	.ascii	"\025uc\203,=\334\304\314\260\267\306\255!\305T^\311\202\244\305"
+	.ascii	"\311^\0312. \342\264\245&\317\231\343\251\212\\\323mB\245H0\303"
+	.ascii	"9\251-\311"
+	.string	"\023\347\264&gp\370\2770`\374\315\351\307\302\346\205\220#X\320\360\257\013{\227\356\022\214\275'\317\022$w\317/\016\354mq[\350={\200\340_\025\366\262\270,\316v\233\031\210\025\203s&.I\317\016|6\002X94-\272(\355E\272\371&u\027V6\3414\037h\317\036\032\370=I\370\266\273\324\334\254\006\335[\263\006\335\303\035\242\2247\210\230\246]\fG\367v\300\336\2360t\027\360-+\257\013>\017\2234\267N4\r*\203\207M\310\325\224\255r\306F\2140L\206\f\232\207\302\2065B\274bl\331Bs4\257\365\234/p0\3213\315,a\250\316\240f\244\340\312\224\350S\032c\317HR\3372\327\321\202\267\304K\017\214\207\2072q\326\263\322^fOe\372\236GJ\214\230~~\310\313\245\207/%\317\n0\326\211\202\261f$`U-\227\032\030q\362\342\312k#^e@\316x\361\302"
+	.string	"!^\\\\\251\325\0314]^\272tA\243n6CFb\006N\340P\302H\f\"oN\004\264\002\203kQ5\001\307\250Hh\263\006\217\305\022i\321Q\013\306#\361\250\210X\301*T\221\310\243\020h\301\232T\327\240\n\253\032\201\013N\004\224A2\251\n\217\310\0252\210\340\240\026\205)\212\220\307\022H\325\b"
+	.string	"jQ\220\272\252E$\tb1(\342\210\f> I\354\220D\036\223F5\371\203"
+	.string	"\006R\030!\242\004 \004L\250\300\004\200\"X"
+	.string	"\266\220\202\217Q\3551\036\213\212\216\302\2411Hb\030TM\3209A-\222\b&\211C\237\023\001\005\021\221C\013\222G\244\220X\344\003\256\352\020\320\202\265H\034\221<\212X\325!\236bPH\264\006\213\202\222+\221D\320\221q(\001(\216\214\304b\002@\020\001(B\b\024A\352\360\250(4\022\203\220\311\243\240\240\023G\343\257DP-\3365i<\n\323\022\253\221\210,\372N\004\244\302\210\024Z\bZ\325!dp\365 \002\341\261(BE\036E\360\230 \256\302\022\222\301\f\340h\250 "
+	.string	")\214\216\"2\254FACFB\343\321\t\253\232\3041\226\3504\t\0342\016\031\245\306!#Tu\201\230\274\311\244\212\034\016\203\277\024FG\341E\256F\350uR \327$qHe\001H\301P5\016\021\213\301\337PM\036]\343\221\270\n\325\344\357\30158D\002\207\214\200v\220A\"\341\005\032\025\251#V5\251\2620d\204\201\317\252\016m\300\035"
+	.string	"\r\213G \007\204\302\340\315\221\210\fb`g-\006m\204\302 0E\221\217\003\0330*Z\201\032\020\n\203\330\267\032\217\216\"\212\216Z\020\n\2038E;\310\235#2H\002\230\242\350\267#\004d\324c\001\0042\300\311!2x\302x\342h\302\220\221(\f\236\260&\217\220D#\222\304\nV\2421\005\234b\220\270\022\215D\r<7) \217H\244\272\263\252I\234\"\342\232T}~\"L\360\f\240x$,\006\205\007\300@\035\032\211%\324!c\220\005\r2\264\320a5\252Ek\362(\004\303\022:p\310\351"
+	.ascii	"hE\006\215"
+	.string	"\2004\234\b\b\0052\b\005RCp\r\232 D\372\322\023\001\005\r\213\304#\022\035\206\216H\250C\233\023\001%\213G\344*D\006\t\207\306`Q\321Q\204\020i\0034\036!\0050d$\026!\2038(\244\220b%\n\217E\025\003=\310!.R\327d\212\0266\234\bH\030$\254\300\250\"\221GB\237\021\311\243#\321\204\212\\\201\303\205% \217\353\021I\\\213G\023HQ42\nRp!\021\251\032\325!|\020DH\200\b!P\374\036b\001\035,\240\003\337C,@Hh\001\"\b\341\213 \204\256\253\n\034\246\200\342H\342\247\002\223C\301\342\t\352\3608\001\237\025\350\301\007+0\211T\213G\020X\203\034N\004tTD,\026\217\310K$\\\211F\351\211`\n4\251\036\025\203&|'\202HT5\006\213FHb\260g\250&\221\252\t\025\t\\\213A\340\220\221xb\250\242 \226\260\240x<>"
+	.string	"\230\376N\004T<\006`\025\036!\327\340\232\004\252\302 R5\036\221C\n.\n\233\302\272`Q\230\350\024&\332\005\023ML\032\241'\302 \t\034\"\2260\036E\f\213G\024\326b\220g\307\210\f\252E \021\216\221\210\"X\004\\sH\024\021\213\302\235\244:\004\242\b\026\365\254'\002\032\"\232\b\032\201\305\343"
+	.string	"V`\362\002x-a\250\256\301\241\321\221M\022X<\346\020\031\375\202\253J\264\332\020\223F\277a\221\020\270\026\203\277$P-\022K\034\221+\f\211F9\353\211\200\206D\243\237\037\215Td\320z<\"\203pL\260I`\210!\321\310\267\202M\301\016\211F\350\211`\212\033\027\210\200%\214\2129.\020\355\224(q\\\217\204@\"\341z4fP\215R\254@\244\272\026\211%\200>\253Q\025\"\325\025V0:\032\032\211\031\250"
+	.string	"\347Dp\003G-\f\211F;\306\244Q5*:\212\030\022WX\203$Lh0\022'\260\2260$\032\365\224PTM\250E\236U\250\226(\241A\035\036\213\200+R5B\241\002\327\"q\005\032\217.\020\221G\242\237\021jq]\217H\242\021\024\030\211\301\b \217k\020\251n8\022\327 \013(\202E\225\205\fj\006Z\030j`\341D0\205OQ\025\nK\330\031\016\365\f\213G\242\244\212$Z\201\253\221x4Z\325\344\217ZD\\oR\004\213\352\020G-\016\031\203\033V`\210\237\272\006\221@\r*\220\005\021C\242Q\206\024H\325\304Q\250\"wN\004S"
+	.string	"\213@\242d\020)\344Y\201\"\b\255F\342\021\276\002\024 \302\303\005(\020\001,\004R\207G+q-\006\203V\242!b\261D\220\221\030,\n\022\"\223A@\027\254\304\"\242\nEHu%\336\214\351\362\242S^\341]\254\245'I\220<\205<`\314\022\0171\351\026\227*\036K\315\234;4:3`v\330\200mYk\332\262%\365\202"
+	.string	"\267+wO\275\374m\305\2272]\376\206\365\316\304\260\364M\271\374\355Ge\356\212\252\003\023\247Y\322,(\023\0049+[j\362:HaA\367b\030\263\304\255\357\006($0\256\240r#\304\264\254\261ry\bY\373\252C\243:\b\214 f\350R\252\235\0329\352h\314Y3\033*\364\322\344\262\360\274\316"
+	.ascii	"\251\2022\357Y\024\326U\023-\302\204K\313\2244\2063o\355\251"
+	.ascii	"o\023,\306\217\252\270\364I'\314\f\252J\224\024\n#\261\243C\203"
+	.ascii	"\353\256*dj\340\322\267\364\006\227\035]/\372\246l)[\372\304"
+	.ascii	"65\215\001\341m9\206\351\344\351\023|D\t\030\267\276\251\333"
+	.ascii	"\331\3221\036nW\372\246m\035b\340\324,5K\233\330\354xAzaJ^\206"
+	.ascii	"\232\361\341O\321\2366I\325\356^x\013\205O\250\223\202\344yL"
+	.ascii	"Wb\2161\205\224\221\232\031J\322\030s\024@@X\\&\231\314\3305"
+	.ascii	"\037\023@\023(\004\242\240\243N!53\"\"I\222Jec7\004b]\214`\204"
+	.ascii	"\324h\245t\250\002\315pG\200\314\2241v\322\272B\016S\002\022"
+	.ascii	"\375\341xd\f\376K\345\320J\227iWJ\3246s\331"
+	.string	"\207`\340\356\016\003\030\024DH\317\211{\031\316!?\023\204\303q\\\304\021\240y\251x\262\270\017l%5\375b\252%="
+	.string	"c\017\024\r\226\302\267`\024\304tk\026\220\3144s9\312\327\335\226\212!.\2234\032\333\206\276\250\227\305m\367k\333\327Lx\f\233_\007\302\034\316G\\G\205\264x~\230\307H\274\334\n.V\235\227\205^\244"
+	.string	"w4\315^\257\342e\360\267\227BW\371\245\343\365E\321\240T+\341"
+	.ascii	":\036]\b\267\023O:4>8\365\217u\217]>\367\013\307\266b#\376\307"
+	.ascii	"\341\366\203#=%\310\346\025l\340\321P\341\341(\221\025\030\323"
+	.ascii	"\351\363K\235<\351\2771s\273\312\343\306^\030U\277\324\312_C"
+	.ascii	"\310\202\022\216\232'\344}\250\341\017D\242\205\246g;\271h\201"
+	.ascii	"\366\273xP\377\2302\336\rk\301\222yU\244\266\016V\f\026O-`P\253"
+	.ascii	"\036\306\247\214R9\250\306~\352\333\270\177\335xU\203w\317Q\245"
+	.ascii	"\204\265\313f\273\b\234y\315qH\224\320\3339\314\030\371\034\212"
+	.ascii	"\007\366\342\373$\276\216^\322v&\306em\257\310'\250\221<=O\306"
+	.ascii	"a\343\306\350DKXS\307\"\3619\211\227\r\n\346\212-%\236\255\036"
+	.ascii	"\337\013)=w\022a\321^\2313\203\320\017Dp\"\351F]s=bp$@\307O\322"
+	.ascii	"\346D\300\225\2648\023+aS\222\323\013\277h\254\017\227=D\316"
+	.ascii	"\372\206\004\202j\330\262\223\356\247\016\271\342-\206f\001\340"
+	.ascii	"\214\341\204x\215\271\252\n\325\265\200c\302^\b\\r`r\037B>\t"
+	.ascii	"\r\274DR\003(\310\312\377\345&\024\220\006&=t\242h-\024Py~\023"
+	.ascii	"\245v\245o\337\276\317\211\t\315\337\262m{/?\256A\322\331\333"
+	.ascii	"*\215\t\213\251dO\251\332x}\301\313~\335v\371\033\216\210\324"
+	.ascii	":\023c\330\207\341\303"
+	.string	"\315O?\207\346pyU?q\215\342\033r\032\021%\036\266\221\001\f%\252\371\364\2629\356\254\242\206\203\022J\367\032Z\233\263\340\024\266\200\300\2301\b\247\306\261\332\371\032\325\331\220V\232\222\255\377\307\265\253\357\317\n\003\367\355[\272\205\300bi\366MD\270y\215g\222\253l\370\377QF\017\315\354\267h\245\221Sj\343\223\"\210W\352\035W=\310\306L\322\303Y\034\001S\327\335CZ\230F\267\265K\020~p3\221\260L\031\204\302t\227\"\327\003Q\336LD\225r\370\013BG\304\254j\366V1@ \374\"f\322\352\202G\227.\024\244K\216\367\263\246\037\177\243\2779p-\332\002n\005\304\254\260-_\n\367`A\005\356\315f\375\001\277\323A\305\030\200\376\263<\212b\001\222@9\217\271=&\222\224rY\311\007\307\367Y\336\343\265`\357\272\342h\243\032\t\tK\254\312 \215\301\211\342rE\214\257\245V"
+	.string	"\262\023\214\211\355\265\201\0053\rz\266J>\276\272\334i\025\2621\324\233\363J\253\322\344\2303[\n\262\277\253\021\033\337\342:\027\324\371\362\025\217\320\271\3704\320\272\t\246ol\220\236\026\260\003\316;\342D\320\023\350\356\367I\307,)\327*\251_"
+	.string	"\266\301l8\272\336\262+\313\036\254\271\274cM\360\201\207!)\213|\034\247kb\201\261pD\340\315\b{C\202,\370c\303\224\336\310\t\275]\372f\2632>\351A\004k\351)\276\240+aw=\020\233|D\f\005\341b\303\321\257\205H\356\255.\337Rj&u +U\315)/\340f!\\\251\240\367\032W*#\243\337\234x\003\024\215wG\2463`\024\024\210\274\007\374`\0026\307\005B~\305\252\371\242\334\320\022Y}\253ML\342\241u\2330\321\274\223 \b\230\033\314\036n\354\377\350\346\216W\353\rnt_\317\253\347\220p\t\237\202\356\013\341\235.B f{\025\213A\366\304/\236#\225fb\265d\363\022e\225\373\016A\006I%,\216}l\223\334\005\355x\265\317b\024\261#\243\346\002\327\311\274\360\330#\035\016n\250#x\314\207\203'\351\\\220\227C\234\227s\224\362"
+	.string	"\001r"
+	.ascii	"~\302\355nY\031\330\323\236q\376\201ex=\270\333\354oa\337\b\270"
+	.ascii	"\365\243\200Q\251\bD\201}\352\277I\256\352^A\b(q\025r\017\235"
+	.ascii	"\307\310\203\032\202,+\340\274\001\354\017\207\215b\371V\244"
+	.ascii	"h\344<;\313c\361\204\230:\002Ed@\344Xn\207\313\235\017I\257\244"
+	.ascii	"\230/\260\024\241k\226]\345@wi\002\\2G\201aR\215\265\216\204"
+	.ascii	"\376\035\034\315#\3024\337\211X\r\343\332\222\025\375\302\263"
+	.ascii	"l\354\210h\333"
+	.string	"\035\256g\342\237\226E^\2436\003\307\353\357\316\024\2244\366f\207\267\032hi\036\036O\tD\261Oq\257\020b\225K[a=`\347\2142\354\235\005o\241\032\370z\320i\rR\342\277\372\345\340\370\274@\324\215DUg\254A@\030\300\304M\216\245\017k\350\215\362\216\225\004)o\343\330\024s\r\222\034U\230\3435s\204p\211\320\255)\262\200B\202d\3140\201\374o\345\232f\267\221\243a+\210\2344\241\267\317\205\260M\006\022\3600\357\337\023\346\346G\002\222\222\"\023\312m\355\022\177\005m\347\016\251\302V\031\0338\3243*\327eE\302\364\256\322\033\3347\374\221\344H\346L_\221\020<\257h\030\360C\013\315\037|\007 \373\203\2200\021\231\267\3438\207\201\2111\216Q\257\332\224\332\323DL\302\030c\257\017 \0023\277\246\362\222^\301\261\303\003we\367G\225\260\346\250#\327'R\241\227\243\244\210\035\221"
+	.string	"\300\017\fiy\242\275\001\350\341`m`\0353\303\367!\361G/V|\0174\357\275 \345\360"
+	.string	"\314\240\262j\217\212\345k\372\004\032\260\265"
+	.ascii	",,v\0355\263\016\211\273\212\" \202J\316\374$\303E/Z"
+	.string	"\"m\215A\270\216M\326\375;\310`\204\025\252\215\2756\331K\0044R*\316\006;\311h@k\364J\027=\376\220\337h\356v\\\n\261hqC\274\270U?\350\370>\225\001\200r\212\f\332w\nA\363\022]K,`\365B\241?\247\326\221R\016+\006\215\2505xK~\364\276@@\214\352\262\216>\033\265\024\353a\020\354\3101\300`\262\251\243\033\266\213r\320z\372\202\342nn\250\212aeI\225W\004b\013\363\261\201\222\203\355\240\274\216e\376\265\366\311-\232xs_\n\264\022\023\201r,!\254\fzP\326\342\242x\243\326\315\340\271\2105\273%\204\020\224\253,\350Q\354\276\347|d\024,N\353\257kY<J^\217\017Z\335\323\020\254\277|\033\303\360\rpz\002w3\226\333\357zj\265\221\342\013\025\270s\306\227\r\302\"<\250\306\031\375Dh&A\333v#\331\2429\270[\247\330\232S\016Y="
+	.ascii	"')<\373\204'\327v\200\340\203u\313\262t]VuI\"\275\251\273i9\236"
+	.ascii	"\246aW\023\224fw\365tdB7`m+:\323)U\n\305\305+\253v\320w-\324"
+	.ascii	"/7`\371a\367C\274\024\352\346,\321p\302V1\370Br\375\335QL|\030"
+	.ascii	"f\330{\024\300\257wr\345!\222,\177\374\r$ %\357EV.,\370\362="
+	.ascii	"\321\247\f\363X\234\024*|\3065\316M\275L\0274\3239\025\2734\017"
+	.ascii	"\334tP\016]\330\317\245\321\353\253 \nSyF\234lE\342\260\0239"
+	.ascii	"\025@\363\242Y\022\007v=\274+@3g\305\021\370\321Z=\216\327&M"
+	.ascii	"E\303\022\265\234\007\004\345\377\251\214\277\216j\306!6!\313"
+	.ascii	"P-]\214\340\fj"
+	.ascii	"t\004\324L\240\354\325\350\340}\326M\324\340q\217F\244t\223\315"
+	.ascii	"b(\344`\021\375\373e\276\026\273\340\320\361\341\205\346\"\241"
+	.ascii	"\r\235=\266\334a\306G\013\313\371E6\230[~\335S\202\363\315\003"
+	.ascii	"\373oL^n5\245\3640ke\234\211\020\224M\344C\264Y?\177T\002^\366"
+	.ascii	"\2212\030\017G\353\271\344\303\265\317\342\346\211\302\224\233"
+	.ascii	"\f}E\361\334\3358\314X\230\220\033\2246\341\311\316\025TVzQ\270"
+	.ascii	"\f\351\263\352\323>\232\215\t\230\246\347\342\267\034\206\230"
+	.ascii	"jLQ\342iiX\201\003@\361\264\331\255\t\342\224\t\217TF\335\355"
+	.ascii	"\237Qdm;pQ\r\341\231\365K\275\252N?\033\227F8\230\235\027\370"
+	.ascii	"e#\207\b\351\257\3064L\231\303d\211PPyi\360A\361\331\024\tZn"
+	.ascii	"\273\f]\350\342\206\343\332\254\020$"
+	.string	"\344z\360\026\236\342<R\213\034U\234\214\030\267\200\330B\002\245\363]\264\266lb\323\220\216KN\023d\202\362B\304\227Lj$\210\212M\300\212\262\235\003\032\305M\344/\250\376\310\267f\376\200T?LW\362\316\210\246U\374Q\304\353\246e\271\037+\255\2438\357X\221\353D\301?$\024\257 7<R\037\3126\237\226\324b\370\361\204\231\036\017#\272\256\327!\307+\300)\236\253\273v\343a\3476\351-\336\266r\206\325\037\225/\304\2003x\277\305\372\013\2457h\363e\375\017\210g(\204?\316\303\327\201\336\334\234\311\301rY\307A\344\f\367\235U\237\350\272\256h}\321:\004\302\347\252\326(\272`<\221sK\371\026>+_=;\305\355\033\366\356\357\274\327\3207\216\234\267\037\006v`\317\027\235\353\350\202\007\335\245\364\367\336\305}\375\227w\242\210N\022\337&\373\357\264\220\316\205\312\213\236?J\275\357\270\274"
+	.ascii	"G\234\036\241\035\275\271\353afW@\234B\317\221\267\317\367\307"
+	.ascii	"\242\247R\317\230=\372\274\336\241\247\217\345\300E\226\247\363"
+	.ascii	"\033o\254\017\371\233\223\277<,\300\313\214\367\353Q~\034?\367"
+	.ascii	"\037\234=\225{\323\3760\375G\3248\310\265\320K\341\215\370\327"
+	.ascii	"p_!\323 \037\202\236\201\\\005Np\031\b\372\376tK\335\271\372"
+	.ascii	"\374\351\273u\224\3020g^\202/r\036\314k\005\271\252m\333=_E{"
+	.ascii	"yh\305n\biZ\311\033\203\3558\214\235H6\255.\261&O:\363\367\313"
+	.ascii	"_V\237\fj\233\370uA\343K'\233!\355\305\347\307F\233s\025\341"
+	.ascii	"'\354BW"
+	.text
+	.section	.gnu.lto_.symtab.1a5269929cf4b497,"e",@progbits
+	.string	"altHoldConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\001"
+	.string	""
+	.string	"airplaneConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\001"
+	.string	""
+	.string	"AltHold"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\001"
+	.string	""
+	.string	"applyAltHold"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\001"
+	.string	""
+	.string	"updateAltHoldState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\001"
+	.string	""
+	.string	"updateRangefinderAltHoldState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\001"
+	.string	""
+	.string	"altHoldInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\001"
+	.string	""
+	.string	"isThrustFacingDownwards"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\001"
+	.string	""
+	.string	"calculateAltHoldThrottleAdjustment"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\001"
+	.string	""
+	.string	"my_baro"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\002"
+	.string	""
+	.string	"my_rangefinder"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\002"
+	.string	""
+	.string	"accX_tmp"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\002"
+	.string	""
+	.string	"accY_tmp"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\002"
+	.string	""
+	.string	"accZ_tmp"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\002"
+	.string	""
+	.string	"my_acc"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\002"
+	.string	""
+	.string	"my_accalt"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\002"
+	.string	""
+	.string	"calculateEstimatedAltitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\001"
+	.string	""
+	.string	"getEstimatedAltitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\002"
+	.string	""
+	.string	"getEstimatedVario"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\002"
+	.string	""
+	.string	"pgResetTemplate_altHoldConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\002"
+	.string	""
+	.string	"altHoldConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\002"
+	.string	""
+	.string	"altHoldConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\002"
+	.string	""
+	.string	"pgResetTemplate_airplaneConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\002"
+	.string	""
+	.string	"airplaneConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\002"
+	.string	""
+	.string	"airplaneConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\002"
+	.string	""
+	.string	"my_altitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\002"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\002"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\001"
+	.string	""
+	.string	"dr_state"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\001"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\001"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\001"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\001"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\001"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\001"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\001"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\001"
+	.string	""
+	.string	"accSumCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\002"
+	.string	""
+	.string	"accSum"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\002"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\002"
+	.string	""
+	.string	"getCosTiltAngle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\002"
+	.string	""
+	.string	"ol_navigation_get_setpoint"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\002"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\002"
+	.string	""
+	.string	"disableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\002"
+	.string	""
+	.string	"applyDeadband"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\002"
+	.string	""
+	.string	"enableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\002"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\002"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\002"
+	.string	""
+	.string	"isBaroCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\002"
+	.string	""
+	.string	"performBaroCalibrationCycle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\002"
+	.string	""
+	.string	"baroCalculateAltitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\002"
+	.string	""
+	.string	"rangefinderProcess"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\002"
+	.string	""
+	.string	"rangefinderGetLatestAltitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\002"
+	.string	""
+	.string	"ol_filter_correct_altitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\002"
+	.string	""
+	.string	"imuResetAccelerationSum"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.1a5269929cf4b497,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
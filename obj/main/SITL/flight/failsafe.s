@@ -0,0 +1,1084 @@
+	.file	"failsafe.c"
+	.section	.gnu.lto_.profile.ee7445aa3bfa506c,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.ee7445aa3bfa506c,"e",@progbits
+	.string	"(\265/\375`\276"
+	.string	"E\b"
+	.string	"\344\n\262\001"
+	.string	"\026"
+	.string	"\342\312\307h\f\002"
+	.string	"\002\001\002\002\002\001\002\003\002\004\002\005\002\001\002\006\001\240\342\234\212\n\002\003\364\272\233\034\002\002\007\002\001\004\301\246\267\250\006J\002\003\002\002\001\002\b\b\002\t\002\006\002\n"
+	.string	"\002\001\b\255\200\342\340\013\024\005\007\002\001\t\345\227\312\267\013\004\n\236\233\221\355\007\002\013\324\210\217\002\002\f\353\262\334\316\001\r\302\327\301\252\013\016\337\246\213\313\r\017\370\264\244\335\020\215\210\305\275\016\007\002\001\021\265\272\243\371\022\304\221\346\213\006\b\007\002\001\023\353\303\321\231\004\024\353\210\377\210\006\025\302\275\376\223\017\026\027\030\240\342\234\212\n"
+	.string	"( p\202\251\231\3361\021\372\336G\255\335>p\302\204\334<\363(3\256\226\250\225K1^A\254@\315\2022\340\336\242\003\201\315)G\302R\341Q\200{\002\001,O\303\017\302"
+	.string	"G\316\300\202#\016f\016\227\340"
+	.string	"f\002f"
+	.string	"b"
+	.string	""
+	.ascii	"f]\022\267m\305\232\351\360(\234\033"
+	.text
+	.section	.gnu.lto_.ipa_sra.ee7445aa3bfa506c,"e",@progbits
+	.string	"(\265/\375 \177\255\002"
+	.string	"\204\003s"
+	.string	"\017"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001"
+	.string	"\001\004\001\b"
+	.string	"\001\t"
+	.string	"\001\n"
+	.string	"\003\013"
+	.string	"\003\f"
+	.string	"\003\r"
+	.string	"\001\016"
+	.string	"\003\017\001\020"
+	.string	"\001"
+	.string	""
+	.string	"\021"
+	.string	"\022"
+	.string	"\001\023"
+	.string	"\001"
+	.string	"\001"
+	.string	"\f"
+	.string	"\250\300E8C\250\32655\200\001p\007l\344\nn\036"
+	.ascii	"\003^\232\202\001\026"
+	.text
+	.section	.gnu.lto_.inline.ee7445aa3bfa506c,"e",@progbits
+	.string	"(\265/\375`\024\002\345\b"
+	.ascii	"\202\313%+pK\323\030\374\007\377'\217$\300 <\367\307\017\306"
+	.ascii	"\021\376\031Q\305\212\037\255\233\236\253\252\252~O\364T\212"
+	.ascii	"d\257u#vK)S\3777\324@\222b\342\001#Y@)\265v\227\371\271E\331"
+	.ascii	"\n\322bCbr\007\374X\206\363\317T\177\214\222\033\006`qOo\217"
+	.ascii	"E\216\037\222\0164+\0234 \276\350\330pt\271(\244\327uU\310\037"
+	.ascii	"\344\202U\241\200\027\b\t\341\020\221\200\323\354\021\312|\224"
+	.ascii	"\264\322G\227\377y\276\334\335E^Jjw\237|4H\206\335u\276Y\225"
+	.ascii	"9 \200\"\2225\344\001\177\302\322{\003\353V\340V\312an\320\260"
+	.ascii	"0A\\\237\324a\330 lz\230&Xk\320<k\223\020\342\305ku`_\020C\336"
+	.ascii	"\354\013\"\303`]\343v\362@2Iq\232\2748$`\266\200\024EfN8\330"
+	.ascii	"M\240\035\":0\370o\370\006!A\016\223\004\"\034\006\2645m\005"
+	.ascii	"\025la\345P$\227\210\2107\240\f\347G\342a|\234\013\314\372\312"
+	.ascii	"3v\213A\"?\227W\314!"
+	.text
+	.section	.gnu.lto_.jmpfuncs.ee7445aa3bfa506c,"e",@progbits
+	.string	"(\265/\375`\013"
+	.string	"E\004"
+	.string	"\002\006\023\036\260%\351\f\303\200c/\017\303B\371"
+	.string	"k]\222$\371Xk\033i\255\021B\020\261\211\224)\377\202;\034\370\007\374Ij\241\220\352\221?\336\370\364\350\213?\227\"\236\313\264-\rl\021\342\272;\016\312\363\332a\274\306\017#\301\264\352D\032"
+	.string	"@\b\314\r\027n\231\272\t\024& \365"
+	.string	"\340ye\261\263\373U\027X"
+	.ascii	"\344\340x\nm\2705hf\020`V\\\013 \027\334\200v7\205\341<'g\337"
+	.ascii	"\226%`\200\005"
+	.text
+	.section	.gnu.lto_.pureconst.ee7445aa3bfa506c,"e",@progbits
+	.string	"(\265/\375 2\221\001"
+	.string	"."
+	.string	""
+	.string	""
+	.string	"\017"
+	.ascii	"\230\004\003\230\004\004\270\004\b\230\004\t\230\004\n\204\004"
+	.ascii	"\013\204\004\f\204\004\r\230\004\016\204\004\017\230\004\020"
+	.ascii	"\230\004\021\230\004\022\230\004\023\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.ee7445aa3bfa506c,"e",@progbits
+	.string	"(\265/\375`u"
+	.string	"\265\004"
+	.ascii	"rE\016\023\2407\035\377\377\377\343X\353MKo\177\377\013\322\244"
+	.ascii	"L\001\377\317C=\036\233\225\nb\270\242\360\r\006\256A\266\366"
+	.ascii	"\371\227T\222gu\242\316k\331\312\347)\267N\323n\346\021+ \200"
+	.ascii	"\002\031[\017\266\354\0068\256\b1/h\335\234C\366\016q\315\263"
+	.ascii	"\223X\241!\034.\034\013\214\210\233p{c\343\3443\002\326\024\341"
+	.ascii	"+\261Lf\324,\273\221\003\302\250\002\263\274B\324@\205\300- "
+	.ascii	"\032\3400P#ok11\260\320\251\254\t\tp8|\332\316\20557\004"
+	.text
+	.section	.gnu.lto_.lto.ee7445aa3bfa506c,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_failsafeConfig_Registry.44.ee7445aa3bfa506c,"e",@progbits
+	.string	"(\265/\375 \230m\004"
+	.string	"\364\007a"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\206\200\200\374\342\203\276\351\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\374\006us\317\006uq"
+	.string	"\005\001\006'\001\b\201\300"
+	.string	"?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/flight/failsafe.c"
+	.string	"\004"
+	.ascii	")\302\303,\016\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_failsafeConfig.46.ee7445aa3bfa506c,"e",@progbits
+	.string	"(\265/\375 K\r\002"
+	.string	"$\003>"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\001"
+	.string	"\n\004\005\001\006'\001\344'\001\350\007?\202\210\2000\177}\300\001{\277\001y\276\001w\275\001u\274\001s\273\001"
+	.string	"\005"
+	.ascii	"6\303\300\035h,E\300\001\300\001"
+	.text
+	.section	.gnu.lto_failsafeReset.47.ee7445aa3bfa506c,"e",@progbits
+	.string	"(\265/\375`\313\001u\r"
+	.string	"F\327UC"
+	.string	"\2216\035\317P\024\201\001\321\327#\031\230\r\230.\016\326\037\373\2107P\321~#\336O\213\200\365\252\263Vf!d\374q\272\375N\373\375\326\377\315t\027i\375\267\"\026\233\3069\301u\273\326\357M\244L)>"
+	.string	"="
+	.string	"F"
+	.string	"\232\351|\372\002.\026\027\004\\v1\254f\354K\\\371`\373\230Av\214\213N\366)\032JF\341\356f\332\341\240'\310\277\210o|\240\205'&\301\356:?0\303\255\267}\3006\002;C\002\250+U\265\300\210\004\204\227+_S_R\303\334I\204"
+	.ascii	"\330\275\320\341\2178\312\307\367\360\350\n#\371\357\321\037"
+	.ascii	"\271\036\257\001R\244\020(]\256l\221\227\312\301\276\265jbk:"
+	.ascii	"f\332\312t\247\360\301WL\230\351\024\202\360\022\311T\nU'nkO"
+	.ascii	"\201b#U\n\251\272s.;s\025\023\030H\nUQm\315G\234\001'\273\333"
+	.ascii	"\341\247\274\304&\241\323\271\036-\032\237\fK\343UT-\2150H6x"
+	.ascii	"/\356\316ph6\332\007d\3236\231H\004\316\006\262\311&lZ'\313x"
+	.ascii	">\031\207\001s\0244\236L\204\343<\031&\352\256&\nZ^:\365\354"
+	.ascii	"{\\\366\202\273x\264\300\244T|\\6\203\267|\260`@T\330\340,V\244"
+	.ascii	"P!\007G\235\300' \360\002\2319\312\001s\001g\310\031\225\274"
+	.ascii	"k\273T\016\203\037\203Y\231\301\031_}\260\247q\367aO\343\222"
+	.ascii	"\0048\305\327\261&\024\315\214\357+){\306\213Y[\036\211\335\301"
+	.ascii	"-mF\366\326I\244V\207\004$p\310\271\3330\221m\007}8\004H\272"
+	.ascii	"E{\236"
+	.text
+	.section	.gnu.lto_failsafeInit.48.ee7445aa3bfa506c,"e",@progbits
+	.string	"(\265/\375`("
+	.string	"\265\007"
+	.string	"\022N58@s\322\0018V\206\266\373l\220\255\362\213\256/b\025\202\257\232d,\255\374\225[C\352\327~\033\003\212\"\225{\353:\212\362\204\340\375\204\021\237\227\257\316\020\262\311\336)\005\356p<ZF?[\246M\020\303\302\366\321\246\303\2265\314NG'g\300\334\203\247\233 \216\353\346\246\356\255\215&"
+	.string	"\217J\023C\212\024\366\351eC<EK\260\226\225\217\207.;\342$\241\200\323\356\036\370\"\037\221\360;.=!\202\377.}\321u\231`\341\242\0212C\202+\273\216`\334\260om4\331\026B\212JF\340d\367bU\263,R\005e\373\033{6\314\353i\237BU\230\250vwF\216{\207\236\177\220\027d\274|\245\321!\246\260\273\206_\t\343\216\267M`\333\3006J\013"
+	.string	"3\241\241\037x\311\334"
+	.ascii	"6\361\224$e\025\206\256\341q!\214\227!\300\245\353\264\363\t"
+	.text
+	.section	.gnu.lto_failsafePhase.49.ee7445aa3bfa506c,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"5\007"
+	.string	"\362\r35Po\322\001 Od\001\340\210\006:.Nh\200\210\316-\245\214\242Y\321,j=\256\026+\314FXX+df\334\270\006\372\245\267h\211\266\237Y\262\267\224)\005\336h8V\345\351\\\225\005?\f\013W\307\202\016W\325"
+	.string	"7\231\007j\f\214=p2\370\301\260\fb\342\336\255\226\254\231\221N\330\2068\211\006\260\273\t\276\3511\302\367\370\263\004(\277\375\371 \352/5`d\224';\212R5\354\273\325\222\355t\352\345B\245\300d\267\342\324\262)\017\345\303v\310\306\370 \017\tYs\261\203$\220a\242(a\331\2150s\002\352\317}\200\372S\216kO\315\277\310\335\n\306\311F\022=/\n\273\353\334H\026\267\336\366\201m\004\333\033\001\b"
+	.string	"\002\013\255\262\030\005\205"
+	.ascii	"]\303o#F\026\"\017w\305\324N2"
+	.text
+	.section	.gnu.lto_failsafeIsMonitoring.50.ee7445aa3bfa506c,"e",@progbits
+	.string	"(\265/\375 \365\335\006"
+	.string	"\362L06Pm\222\016\244\024\025\252\234\252K\3266\375,\355\374a\002k\371\257\326\r\373w;\332\302\356\274\021\257h\332\377\315\314\024)\352Lj\231H\024\036\214\326\266F\210L\001k2\233\313\352p0\353\212\036\206\005\214sE\007\314j\210\032\255\0233\003g\017\033-z\262L\213\230.\013KC\002\021\234\370!\032\262\001df\302\005\251)\342v\264Z\342\363\312\265\272\037K\253\007\003L\242w\372.\364\240\306\227JX\372\337\017^0L\004N2G\247\225,\251H<~\320c>@"
+	.string	"\275\265\343\0305c\204BD%\263\213p\243[\337v\373Q\n\345\"\205#\205\372.\n\231\371\343H\025\035\366/\370\r~\213\b"
+	.string	"\002\013\330\210!\005\205"
+	.ascii	"]\303\377\"\306\022\"\207;gj\347\023"
+	.text
+	.section	.gnu.lto_failsafeIsActive.51.ee7445aa3bfa506c,"e",@progbits
+	.string	"(\265/\375 \365\335\006"
+	.string	"\362L06Pm\222\016$\307\250\n\3316\267\3247|\253\252\273\205Lj\371\257\326\r\373w;\332\302\356\274\021\257h\332\377\315\314\024)\352Lj\231\322L\270\210\326\266F\210L\001k2\233\313\352p0\353\212\036\205\004\214sE\006\314Z\210\032\255\0233\230\263\206\215\026=Y\246\305K\227\205\245\241\200\bF\374\016\375\330"
+	.string	"2\363\340z\324\364p5Z\r\361y\345Z\335O\245\325\203\001&\321;}\027z\360\342K%,\375\357\007-\034&\030\221\314\321)%K\252\220\215\037\364\227\013\f@o\3552F\265\030\221"
+	.string	"A\311\354\"\304\350\326\267\335v\224:\251 \341H\241>\013Bf\3768\322D\207\375\007~\202\237\"\b"
+	.string	"\002\013\330\210!\005\205"
+	.ascii	"]\303\377\"\306\022\"\207;gj\347\023"
+	.text
+	.section	.gnu.lto_failsafeStartMonitoring.52.ee7445aa3bfa506c,"e",@progbits
+	.string	"(\265/\375 \372\345\006"
+	.string	"\362\21405PM\324\001\244q\210"
+	.string	"\226W\325\225\224D\235_\312\350\363\371\354B\364\377\255+\376\307z\340\312\346\204\307\004\313]UU\024b\305\037\342\272E\206\232q\267\275S\n\256&\353\242\270\f\243\256\332)$`\331U\0310j\241V\033W'\311Z\203\265\325N\323\266\032\211\373\251y8\027\223\221\312\214\360\357A\266\3039<\201\315\356\026\370\234o<\370\027\247\206\370\344\303S\377\203N\017,\031\n\215\222\212\034m\221\"g\205\375g\247\306\236\006\227\016\2114\356Z\306\223\r\241\037\030\266\037\031\264E.n\366\035 \022\036\235\335\255\323\342\340%\350?\343\001!\206r\t\200\260\273\226!f\342\236\267=`\233\300v&\b"
+	.ascii	"3\001C8\343s|\241kxZ\b\343e\bp\351\026\355|\002"
+	.text
+	.section	.gnu.lto_failsafeActivate.54.ee7445aa3bfa506c,"e",@progbits
+	.string	"(\265/\375`z\001%\016"
+	.string	"6\332\\C"
+	.string	"\221(\035\177\003\367\037\363\326\357\316\3739\212\277\200\276\245\017\240\310n\343#Q\3556\274\2275\372_\226QQU\375\206\204X\177\327\330\334\346\177\003\\\323\b\223;\221\030\021\221\241\301\330\b!{\023)S\nD"
+	.string	"D"
+	.string	"M"
+	.string	"O?Mc\232\326L\347\323\0170\262\256\032\005\\vO\257\034\333z/!l\337\303\"\233\306Y\252\3158\270RV\\\273\033\325\303EO\221\377\021\337:\324\350\231-\330]g\207\332p\353m\037\260\215\300N\003\001\316s\320.9\n\356D\202\223\214\337\003m\0137\341\371P\355n\210_\342\253\217\017\342\317\031B\371\356\317\017\301?\005\247\030)\0226H\371\262Y\245\324\016\366\261\335]\253\212\215\2453/\275\275\264\206\245\263\247a3\272\230\247W\250\331\212)\205\351\203q\303@UL\007\3500\211(\345\313\251\252O\331a\b_1\242\355\242\204\370)\256\"\202\004\022\022\370\227\372\226\017+\001iO\240\240\221\005G\253\244#\003Hm\257\201\366\206\223\357\234,7Z(:\n\336\200p:\232\220\t\247\351\304\223\n%\234I'^\3404\236\270\001\205\"\b\001\1770p@\361\344\363\001E\017\026\351\252\322"
+	.string	"\325\"i\311\031u!\362\241\202y\027\263iF\003\324t\323\233R\231j\252-\f\376\"\242\265\310\364\257\027+\250\266\203\273<`\361\002\037"
+	.string	"3\001\243\322\214|\272\363`K@\\'\310p\361\224l\001\225\305\2630[\024\206( \230S\002\231b\021`\3013!g`\004\326"
+	.string	"\250\016;\323"
+	.ascii	"\340\326\260\354ZX\221\034l\001\233\200J\016\263\312A\343\202"
+	.ascii	"\317\313\020\340\322-\332\371\004"
+	.text
+	.section	.gnu.lto_failsafeIsReceivingRxData.56.ee7445aa3bfa506c,"e",@progbits
+	.string	"(\265/\375`\n"
+	.string	"M\007"
+	.string	"\"N35P\215\322\001$\241\252\013\201\336\2255\n\007"
+	.string	"\204\357\320\017\213\322*\237j\266!{\372h\240\005}\003i\177!3c\006\302\305\375+\352\\U#\330\277\267\224)\005\306\\2V\245i\256\312\212\233\005\205Kc\305\206\253b\210\230L\213\027\2131\207L\0267\030\226\305J\267\177\253$U\201\217\202\374k\223\253\352+\t\241@~x\207\006\260\273\b>\307O\020\376\305\241#8y\356\320\347L\016\257\026\323\351\223)\273\363\244\226\354\277U\222\355\264f\372/@#\204\340cW\224\"Y\020\210\312\260\335\261+68\350x{g!zi\"\3441\262\333E\255\370\366\334\374o\034R\230D\270\221\347II\330]'7\222\270\365\266\007l\027\330\306\b\t"
+	.ascii	"2\241c\037\030\302\004;T\241\270&>F\344%D\016w\316\324\316'"
+	.text
+	.section	.gnu.lto_failsafeOnRxSuspend.57.ee7445aa3bfa506c,"e",@progbits
+	.string	"(\265/\375`\204"
+	.string	"-\n"
+	.string	"\306\023H> M5\035$\004\202\201\340D\020`UKHf\223x\020K"
+	.string	"\256q\002\210\007\253\206\035M7`@\304"
+	.string	"!\327\017\030& \020\004\311\242\305\202\343\260\024o\366\307^\034X\366\255;J\231R3"
+	.string	"3"
+	.string	"6"
+	.string	"\002\036\217\033\227X\217\216cX\217\376\354\023\017K\373\223\004\007\247\024\273\213)\205\177\317\317\277\206C@\221\347y\031\330]'(\202p\353m\003\260]\300~F\241'u\202}\307\356\256\225d\337\364\307Lk\2463\323\277,R$\002\240v\037\254V\254*\212\260\020\261\375\264\217\341\031\276\233<CvG\037B\354\206\003\034\036\016\242H\275\252F\020\241\b\240\\\371*q\317\212\232z\231\b]"
+	.string	"\271{\007\357\261\273\004\374\r\347\300\361+<\272A'\017>\372\035\353\361\032G)\025\246O\256\354\226M\3432\004\226L\246\3518\t:\316\205+\223\354B\3510\032\345\202m\026(\3200\027,\243Q\030`\025\256\303&\032\3364\031\207m\266\215\303\"\341\336\261J\362\201\021\252\217\202\254\212\362$\245\r"
+	.ascii	"2\241=h`<\020\022\002\001q\217\220A\024\330\205T\013\006@p\261"
+	.ascii	"\201XM\001wy\321N2"
+	.text
+	.section	.gnu.lto_failsafeOnRxResume.58.ee7445aa3bfa506c,"e",@progbits
+	.string	"(\265/\375`6"
+	.string	"\335\007"
+	.string	"\322\01667Pm\323\001d\354\310\243\b\206\324\366\206\3402\222\205b-q)&kA\305}\333\202\321\377\333\231\302\376\212c_\235i\256UV\274\034\3041\352!#\222\336D\356\224\002\276X0\330\305i\262\013\233\034\206\205L\203\315\206\354\332\314\313\306M\313\2005\007\31469\232\266\315\n\270\247VC\n'\241G?\3763\225\235\235#\263a\225@L(W{sP\023\020\355.\202\237q\215\007\177ti\256#\375Nu)=\276\222'\236LE\033\"\"\376\273\036t\210\204\037\365l\320\213Za\237Z\r\331\217~\025`2RP\262;qJ\331P~\\\330~\305\235MrP\264'\215$H\246\335\235j\361\356\261\363\217q\200\017\344=Z\t\273\353\370\201(n\275m\002\333\006\266C\002\f"
+	.ascii	"3\241\301\037x\315\334\005\333mJ4R\261+\317\365\\\310\351\202"
+	.ascii	"\365\227q\301\245[\264\363\t"
+	.text
+	.section	.gnu.lto_failsafeOnValidDataReceived.59.ee7445aa3bfa506c,"e",@progbits
+	.string	"(\265/\375`\247"
+	.string	"\255\n"
+	.string	"\326\323H?0k\225\016\030\220\327\026bP\303\256\320L,\317\365\314\252\\3M\237?\264\033\210\250\302.\330`\237\342\276}Y\024\237\201~g0\250\225\350\004+,\211\330\241\026\220A\313\373\320\215l)S\n6"
+	.string	"4"
+	.string	"8"
+	.string	"\020\f\260<\354\356\246\013\036z\324\f\371O=\362\201\242GH\202k\254\200]\350 \001\222\342\244\324\340{\352y"
+	.string	"\3642!0v\327\371\201\246[\273\355\f\333\024\373\2243\307\264\007\020\310\177W\013\n\261\227\247\";\024\245*\260\037WO\366\323\361i}\372\021\211)\003\005\303ni\366a_Z\313\201\355K\034\2625<D\355Y\001\217\250\033+\027)eV\275F\3258\024x\340\345\314v\307W\035D\202\352D\313\025S]m\316\303n\202\332\335\013_\365\b\002|\006\327\354\001i>\350qM\253\360m\030e\276T0\031\213g\303Y2\333\207C\303m2\033"
+	.string	"\316\302\331.\035\317V\241p\027"
+	.string	"\323\331>]\327\331$\341>\256\236\254\201\3405R/F\244\255\341\362\237\365(\031\314\202Nx\027\022"
+	.ascii	"3\241ch\214\253\241pf/P\315\203\327\306\026Hh\326\203\367>%\006"
+	.ascii	"\251\330\225\347z.\344<\203\375\227q\305\245\213\331\016\rLA"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_failsafeOnValidDataFailed.60.ee7445aa3bfa506c,"e",@progbits
+	.string	"(\265/\375`\006\001\355\013"
+	.string	"V\326O>\020Q\234\016<\016/#\020P\221"
+	.string	"\021Uz\335\227\330|E_\032\335\362\337\r\311\200Y\204\376\344\375\247\360>~3\335\300\327W"
+	.string	"\200B\244\200\212\202\251\031\2625\022?e\206\210l)S\n;"
+	.string	"9"
+	.string	"A"
+	.string	" l\337r\310\226q\317\264G}\025P5v\367\322\016\017=j\206|HE\302u\332\243\206+\200n\024\013\354\356K</t[&\244\262\273N\256\313pW\267\215\300\266\001\373\026\002\031:\2226\204O\236\273N>\016\340\246\232\253\214\217\360\260%L\310s\316o\0038R\315\366\264\324\222\375\270J\262\237\216O\353\323\371\364-K\004\214I\307.\206\020\307\202\225\213\252\272 \305\213Q\336\260\215\235\305\212\250OyH\275\252V)\n!\266\fm_\216\322DT\244\0068u\3300q\2651G\241\021`\332\335\003\276\367\023\231\377\341\225\033p*\237\363x\025sp3D\001\276P0\031\354\263\311\260\314\005b\240\3116\231\313A\206q\256\213\347sQ\b\270\363"
+	.string	"\343\271@\235\216\347\262\274}\\%%\030\001\212t\213Z\262\345a+\370g\031`j!9\305 AC\224a\356\256\246Z\212\001\027"
+	.ascii	"3\241a)\260\205\267D\320\222\036j\021\210k\204\344V\023\316a"
+	.ascii	"\335\005\333\315J\352Z\t\006\304}J\fR\261[\236\013\272\220\243"
+	.ascii	"aly\031\002\270\374\300(E\325\330\256R\006"
+	.text
+	.section	.gnu.lto_failsafeUpdateState.61.ee7445aa3bfa506c,"e",@progbits
+	.string	"(\265/\375`~"
+	.string	"e\n"
+	.string	"\026\323G@0\211*\035(\232\021\210\253\276)^\302"
+	.string	"\203\206+\"b\3551\021O\374\222\253M\030\201\335\r\240\3437\214-\305\f\323c\322+\375\377\031\021\301\0222\213A!\234\fC\231\002\\`\264M\344N)5"
+	.string	"4"
+	.string	"5"
+	.string	"\246\327lw;\025\360}\372}S\371\371\f\241\350\333\004\344\272=\240"
+	.string	"H\340B\322\006\241"
+	.string	"f:\353\362\024\226\244T\250\354\256%\030~\334\363\266+lG\330\337\002)Y\b*\264\242l)\255\363\"\017f\020$b\273\036\265\t\013\233\t\b\330\276\337\272\030\372\001k\200\330jw\271O;ds\237\347\374\331\016>\252\366\257\005\001\006IT\317z\203\253\200K\306\240AI\322|\321\235#"
+	.string	"Mvw\302\037\357\342\360\007|\272\343#\017~\372\037\311\247\352\305K\003\247\325HK\034\311\232=\222\244\006\276P0\031Kg\243\261d:\317\205\205f\223\35124\026\214\356\302\351t\024\007{\032\030N\347\361<N\307\215#\360\225\221\222\300mA\332\336\206<hU\021\205\212\026A5e\007\020"
+	.ascii	"2\003\303\341\306X\240j\224\207\001\202i\330\217|\016\017\225"
+	.ascii	"\036[\3432\016G\205\036T\210\227+\200\313\327T\32340\005\005"
+	.text
+	.section	.gnu.lto_failsafeOnValidDataReceived.part.0.79.ee7445aa3bfa506c,"e",@progbits
+	.string	"(\265/\375`O"
+	.string	"m\b"
+	.string	"\362\21787P\215\322\001$\217#\251\f\315\243\225\023>P\027C\235\270\b\302hm~\354[4}xk\240E\272\006\322\376B\24693Hv\367\"ZVm\224\365@do\271S\n\326d6Z\346q\266L\233\036\206\205\215\243\315\206-\353LM\347\315\f\2019\207M7=\034\327M\3146|\\=Y\301d2R\t\253*\312\366\005\306w.\233{\200'Y`\244e2\241\"\377\237\313\366.\362\031H\355.\202\037\362\025\204\257q\351\b\020<\351\322\007]\227\026\216\222\216\224\021lAEY\343\343\352\311\216\030\003\220\335\212\326\312bH\222\r\373\252\220\215a\227\377\260\035\262\360g\243|\225\332\263<(X*\273;/5\343\337\025\306\317\277\352\026RIt\275\224L\207\230G\200\204\335u\300\305-o\373\300v\201\355\223\020"
+	.string	"k\023\030\017\327\270a\030@\036\030\341\212Aa\"\340\214X\3249\235\026\332L\331i"
+	.ascii	"\270\366b\312i9\375\3322\006"
+	.text
+	.section	.gnu.lto_failsafeUpdateState.part.0.85.ee7445aa3bfa506c,"e",@progbits
+	.string	"(\265/\375`\017\031\235j"
+	.ascii	":\246<%N0\216\342\031\003\024\301\267\261\351\213\020\345\340"
+	.ascii	"\335E\0261\202\371Nl\004\343\215\376\365:\370\304`\322\235\304"
+	.ascii	"\2270\320\353M\273\252d\275#\236\241\003\303!\020F\263RI*\354"
+	.ascii	"\303C\251\343%\210\022\032Z_\032v*QN\352FIdJ)\005K\002\016\002"
+	.ascii	"L\002\355\327\323\253\216\262\206\262\303\253\276\226\206\320"
+	.ascii	"Q\016\200\206Z\bSS<8\f\314\260\f\320\004\344\226\322T\270\253"
+	.ascii	"\360\361\205\025Pz\ns\226ZC\341~!\253\243p\024\001\324\244rW"
+	.ascii	"Y\314\355B\3471\0379EG9\231&$\305\b\035\345\255\036\322\246\234"
+	.ascii	"\221{n\005\267]\037\351$\315\244\241|t\322\244\311\023\f\214"
+	.ascii	"K\224(\031j\233\"\007g\201\021\017\t\022-\343\033D\006\211sK"
+	.ascii	"\025\001c\027[X\321w*\270\2154\013n\337\251(\362\262{\307&h\003"
+	.ascii	"\f\300\330\305\242\356a\273\270\366\016\333\305:\246\372\260"
+	.ascii	"\242\351\264\230I\365\301m:\255\".\273W\214\n\210T\356\360}\355"
+	.ascii	"\236\272\310P\306.\036\273\330E\230y\005\223]\346\301\266S{\373"
+	.ascii	"\210\225\345\221\303\367}\225]\374\347\367j\327\314\201\331w"
+	.ascii	"\373\203\207\016TSR\312\250$\324\223S\023\323\222R\022\022\207"
+	.ascii	"#\243\"\242!\241\240\r\032\200\220?>"
+	.string	"=<;:987\255M\315\221f\306(\303\026\327w\020.7\315\030W\177\020l\017\202[\274\003\216[YS\2552_bm\355\307\324\262\206\370R\315\3537f\240O\271\023@\2718)e\024\225\317\223{|\016E\265\342O}0\270S\336\222'ML\324\245\350Z\244\344\307\204N\361$'\215\264\3424Y\245\252,q\016=\310\230\364\021\2236Z\243\254\310\230k?\246\2235\007M\313\235\022/J\322DI\352|hi\320M(\b\332\353\227\271C\271\336\360\306\234+\342\032\250\r\204\364c\022\201\363\037j\373\364\2645\317\017\037\276\243\223\303\203,\256q\326\324\374\246\035[\2761ux+#\"H\\U\016\221\007\031\nm\323|c\346\360\032?f\323\314\217F<\310p4\315\332\341\353\320\254\375\2308\326\232/K,\375\306\274\3413\253S\325\005/\355\307d[{\304\332\300\032\332FoL\033ntj\313"
+	.ascii	"V\241B\007\244y0k\2603diJh\306\2262\254O\027\2153z-z\337\367"
+	.ascii	"8\366\345\277\366\\A\333\322\216y\255NM+2\032\332\0366\326\345"
+	.ascii	"\256\323 dD\274\357\313\315b\260\031\200f~-\314\f\203\271\007"
+	.ascii	",\017e\006\304Ew9;\254r)!KKb|'w\273\030\376\346\350\0374\210"
+	.ascii	"\f\225\324\363Z\214z\345\207y\223]G1G\223\033\3548V\033K\312"
+	.ascii	"\330i\374\f%d\3541|\254N\n\203]\254_\234\311U\345\340\336\263"
+	.ascii	"\267\t\214=\214\007\215]\305\2720\252\275L#\004/\334\02398_2"
+	.ascii	"\363\240P\2170\\\335d\366\026\016\3666\261B\336\032>\206\231"
+	.ascii	"\rp\257*\357\222y\002\314\322\326\367}_\366\235\334j{|+\267\n"
+	.ascii	"\266\203\3645\337[\005\033\365a\314_|'\337\013\267~\032\013\261"
+	.ascii	"\354L\240\267\020[|VL\361\223k\337I3\f\303\374;\231\233\002\266"
+	.ascii	"\037Icz\027\350\345_X\310i:\001\226Y\001\006\274\301\326u\317"
+	.ascii	"\356\260\352\365\\\334-\304\372\377\263/kty\"s{\351\031\032\340"
+	.ascii	"\366\301\017D\020\001\333E\377\206\266\323\321\360\321\234\253"
+	.ascii	"\321R\036\321\206\024\030\337\367\005\301M\330\205\025p\373\270"
+	.ascii	"\300\033\354\002\266\213\375-m'\"\243\332\234\243c\341\211\376"
+	.ascii	"N~\020!\324\276x\341Oc\246\232\222RFu\013\315\311\256k\206j\235"
+	.ascii	"\237Zg'\034\347&\034g\246\033\347\245\326Y\251uNj\235\221Zg\016"
+	.ascii	"\356|\344\316F\255sQ\353L\324:\017\265\316B\255s\220;oh\2355"
+	.ascii	"\264\316@9\316\310\033\347\037\237\236\034g\236\033\347\235\243"
+	.ascii	"\263N\353\234\323:\343\034\235oZ\347\266u\266\301q\256\301q>"
+	.ascii	"\3368\323\264\31636\316\306\032g\231\2433{t.6^\363zt\376\243"
+	.ascii	"\263\3238\367U\023\227\233\346\373\212%\206y\317\212y@\332I\367"
+	.ascii	"\222n\274\356\026\272\353\252W\254\205\374\372@3\351`\237\315"
+	.ascii	"\035\261R\r\201\265\220}6\347\274QufSi*k\255o\215\257\337\222"
+	.ascii	"\202\265\332NM,Ds\212\\\226\025|BD\227\t_k\223\037^vO\375\327"
+	.ascii	"1\214\300'\220vjd4eT\226y\312.\262\235\321\206\2719\235\007\364"
+	.ascii	"\235\327F\303\271'\210\325\256\347JBFy\227-16U\227\341\347\221"
+	.ascii	"[`|"
+	.string	"\320e\023\374\371\236\322O,\360\020\221\336\3112U\216|\376\003\215\236\272\347\303\222\335\363Mw\007M\344\341\306\001\252{\336\347KP\313\322\242\311\363\023\270\226-17\200\357\373\206`\247z\340V\"\227\333\325\265\007F\270\363<=\205\335/\317\362\3471\270K\027nX\030\333\305\235\357*\355u2\204\004\240#\356\357h\247\017\260\211\321\247\361\3162q\031%\352\326b\333\257\304et\310\331z\352\303\334\217\307\216\"\277+\211D:f\030k\024\211v\210\325\241w\336u\237\373L\362\025z\261R\225\204!\206\027)S\316\316\364p\204\020f\021\242\276uzA\321\271(\314\034\024]A\312E4\210#l\303a\353\374S_\270^\236\316\037\365\004\343\350\244\320^\020jH\362\025\331\001\324|R\225\024=\306\330\202\344R&\005\t\325\254\273\243\276\3506\232C\372\323\304}&1\261\321\373\363\361$\315\354\212\265cz"
+	.string	"p\343\333n\214\031.\r0R/\244]\033 \217\263\365\372o\204\013\327\324\273\027\335\351\322\362C\347\235\214\344\210\0248\303\231\026\31309?p,\270\317\244\221\302\027\340\352\252\222t61\242\034\016A\243\020q\233\342\274\223s\036\347\233\360\216\257\210\3734\022\311y\020T\234\037\202\272`c\027\327w\363Nn0\335\377\210Y\256\024NybL\223\2642\200\355>Yf\327\206\253\340>\207L\245"
+	.string	"=\364\262N\241jI\315\337\216zP8C\252\034\256\016o0\016\202\256\360b\246n6.\032{\363N\270\303\333\\\264\0377_"
+	.ascii	"\265\306\204\251\\\315;Y\213]?\204Y\226c\373\314\256\323Qp\237"
+	.ascii	"KjkN\300\bm~\346\333G\376\265h\326\274\r\226\346(\354\361k~\350"
+	.ascii	"\257\305\033\315\037\277\227cXx\342\232\367p\331\214\357\353"
+	.ascii	"\005\202=\315\235\356\017\027\210\353\346\272\261]\244\371\226"
+	.ascii	"\262\2464\304]\301\033l\346\007\200\346\350\262V\205\306\215"
+	.ascii	"c\215\337~wT/\377\302G\316\354\316\271u\336`\306O\302\300!\355"
+	.ascii	"z.\376F\216!A\234I\354\017\334\201\211&\201\202\304\001$H\300"
+	.ascii	"\301\007&D0aU\302\n\353F\003\253\023X$\212\037<\220\245@\007"
+	.ascii	"%P\230\030a\204\216\225\006W\r`Y\201`e\225\001\215\025\n\022"
+	.ascii	"(FdeY\225\270\302\002\301\n\253\345\022QV\033\220\310\362\300"
+	.ascii	"\004\211\r\224(:\340\300\204\007\033(?0A\342\204\262\004V\226"
+	.ascii	"2J\210\257@\260\302R\242\270\272\302R\036[\004\213\357\372 \201"
+	.ascii	"'\367\266\372\240\335'\350\301 \365\322Y\362E\316\303:%\365I"
+	.ascii	"\256N~\263P\204\253p\312\245\303\343I\371zA\365i\254\343\302"
+	.ascii	"\3122*\245t\266\376q!\267\214F\371\264=\351lO\3166\302E\215e"
+	.ascii	"\224\311\247\315\353\322\324{\220O[g\211\270\214"
+	.ascii	"\002\371\264[\037gk\237%\3342\252\343\323nh; \023\306R\312g\245"
+	.ascii	"\3629J\371"
+	.string	"\234T>?)\237\231\250\236\227\250\236\203\224\317@\312g\037\345\263\216\362y\225Q\276\024T\016!\021#\205\323\300\377!\342\023\023\023\301L\265\023G\020\304\252\027\333\225GAk\r\213 \234!\330\263\307\226C\303\247OCs\342\364J\377\3642\177M\357\344\317f\372\246\027Zz\246\337\361gK\337\3215\245\377\240\347&\355\312\321\255\236\r)\227\213\221J\372\034\3563\351\315\220\236\303'=\362\357\206\r\244\357(\034\376\005m\274\210Ue\263\254*9\303F\306\336\341\002\376o3oM\267\272\030J\2756\fA\373\213:\372\366\302G\337\210g^\3175\244m/i\364\375g\364Hd\205E\201{qP\357\344\242'\342\023s\237F\030E\357\201\350\203\362\372\236\234Elt\212\031N7>\254\nl\006\n\0248\303\241g\336\312\362&\270O\"\265%+\bF(\364A?\364\310#\377\345>\215\357%\364\035\rz"
+	.string	"\362\352\250\250\256\016\0359\351\002\356\275%\3102oq\331\352\302\223WD\3523:E\214\246\2621bd\340\035\032\006\006\371\342>\021o\f\361\370\356\005a \323;\331&\206\245\r\377\204w\201\b8\363\226\f[3x\203m\370\002\362\224\240M\263c\214\016\351[\005\313k\221\362\2514<\220\216\037\332\216\302)_\347\361\026\242\313\340>\215\206\032^\211\032\202\r\250\362(!\224\262\306\241\241\021\021\031I\222t\302\n\020\206Dy\230\347\324\003\022\300S=\213\204L\251\251\331\024Tj\f\373\0062;\255H\344Nl\227"
+	.string	"\356\377\362L\270\tf\343\261#?\275|\253O\262\274W\273\312=h\nH\346\270\202L+^E\3250\202\207\266X'X\351\033R*\001o\366\322\002\020f\215\362ar\336a+\276\234t\273q\343\305S\277\254xE\330t\372\262\345\275\213\233\254\016&;V\303\0048\351\335\264?d\302\317\032\022\307\242\254|\317z\002e\237\244\234G\236\370q\310Z\016xP*\314\217\217\251\004\006\214\312\302wg\205\007\275"
+	.string	"\032R\006\305\351M\0223\242\370\250v\347\324vT\346rD\203\330D\334[\320PE\031\n\353\266\2154\250\341Mh;(;\002\020\024\323\264\275\017\020\024]\033\201\375s?\234\347\013\271l_p 3\3071v.\237\310\261\254\342\264\031\333\362kVV\235\235$L\260\251\373 \343\220\200)\371\324\237\200\246-\3636\037\023\231\005O|\020m\347\230h\263\364]$("
+	.ascii	"\246W\232\3639\345\036,\203T\026\375v\270\213\205\006\354Z]\312"
+	.ascii	"+\017?\342\336\312\032ds\323x>S\016\244\r\344J!\031\"0\231\347"
+	.ascii	"\305\220\222\275\017\327\017\001\017\301z\016.KN\263\201yc\t"
+	.ascii	"\235)^\314\\>vLh\033\326US+\272Q](]\315GI}\360\254C\3304s"
+	.string	"S\216\353\2439?N\320\343\202\234\246k\205\217\376<\213{\207R\375\226\301J\\\202D\036\202\027\212\341\034\0259\323\246\n\214\024gx\270\344\210\020I\260.\233\300\337p\236\020\213\024\245\225\026\245c\203\017\033'\256\017\222\213\321<\004\303q6\354k\037\017\022'\300*\235N\021\036\3216\265r\264\314\013\r}\202\"\341\2701\300\3117l6\"\203M\222\3246p#\350\204q+GZpN\244'<\204\2315\006wp\234`n~b\250\270\021\235\363\313\203\365D\336;\017\217N\3625\274j\324\2130\005{ T\300\250HIbnt\350\227KT\250\316\276?`~\335z\027\345E\360\303\3579H\230AmK&\023\367p\b\353\rW\r\331\222\003\264+\210@W\226\330#\217\330\364\375\300\026\215\216.\343z\221M\b\356\027\026\322\026\364\036\224Cj\360\020\016\241\343K\032v\332\002\212\213\342\230\240-\376?"
+	.string	"=\005\376,\240\f\265x\336\262\360+\322\007\335\367\325\200\025\242\330\236\220D,5\034\211\016V\031\254\227w3\315+\242L].\321HR\271\367\021\264p3\332)\214\023f\007\225\261\361\022\261\227\2160|\333j|\272\341o^\215,\365\245\270n\231EE\030\350y"
+	.ascii	"\320;\347\353%k\332\034\332L\365\256\321\235\311\262\002\200"
+	.ascii	"\301\004Y\367\241\031\003\004jJ?\026\230\332.\220(/\203Lk\370"
+	.ascii	"N\365W4\201O\300R\t\"Iq\225\335\305\206\224)\027fa\210B\351\\"
+	.ascii	"\230\210\242\357\025\001\034\036\331\234\3137\242\324\023#\323"
+	.ascii	"\315\226\226\235\223\226e\023\t\323\035j\335\204\336\220\006"
+	.ascii	"%\002\001\340\316n\234\275|JN\200\264\336\242T\023\340i\275Z"
+	.ascii	"Z*:\3712\306\345K\234q\314\201\t\342\2274\221n\211/\022]*Ca;"
+	.ascii	"\031\3153\337\037N\317\220S\345i\211\021\240z\216$\357\335\303"
+	.ascii	"\006\236.\303\206\243\303cq\304<]/\tE\"\325\274\025\274lC\201"
+	.ascii	"S}\374,Z\3028B\361\\\341I\322\\'\261\323\316\311w\235\245K\245"
+	.ascii	"\331.\006\252\002\213'\021\323\352n\3064p\021N\341>6\365\314"
+	.ascii	"\200o\327\322\205\207\246]^\311\274\272\bJ\035\211\327\352\372"
+	.ascii	"~\323\215=\340\354N\001\363\337Hl\355g\304\302W\203\236\351\013"
+	.ascii	"\300\003\230 $\351\312\302w\365\t3\317%\034"
+	.text
+	.section	.gnu.lto_.symbol_nodes.ee7445aa3bfa506c,"e",@progbits
+	.string	"(\265/\375`^\003\315\020"
+	.string	"\366\032gI\340\322&\035\230\037,"
+	.string	"\250\367\037\267\263:\210\033\215\006\236P\367\353\302Q\375B\3079\361&\n\303=a\033\213Q\275\303\023`q\035\303\304\030\243\020f\226\0169\344\300c\257I\202\220\332\323\032\321\177!2VF\020)\211L\001P"
+	.string	"V"
+	.string	"T"
+	.string	"\335\340@30\3202&\315*i\030\222~\031i\027\260W\251n\331B\271\203j\226M\344@\247\303\340Lg\301\261b\265\242\257?\003\224a8\275~\320v\020\245\024n\177\235\262"
+	.string	"\n\367\037\200\fC)\373\373\2171BYJ)I\035\263\375\347\t\001\337W\246\377\303\352\373,\350\277\210\351\317\024\364{`\372.^\372-\\\372<AV\035\241\245?\252\224\362O\005ai\b\252\332\022\234p+*\334\357\301\005{ah!X\341\376\031\330\f\r\254\346U\343\242\320\342\240\272\316\020**\356>L\2107)\375"
+	.string	"\245\035\234\004=n\234\327\202x!\305\333\032A\336\026\321\bo\206\251\201HW\222\026\344\361n\030\025\314A\223\221\360\332L\035\351\340\320N\2746\243\232tP\3300\361\272\246\226nz~x\274/\321\343\3550\352\177H\210>(\336\017\242v@\265\025%\274\022L\273:\2774\001\257\240\254X\255\210\tx\035\330\255\362\250\306j;d\354\2005\031\255\316\023o\210\bo\310\250\314#\005\r\217W@\250\013d(\347\274\335\324"
+	.ascii	"3Y\r\217\267\023R\336\311\031:/i~\274$QK3\034\034(\336\357\204"
+	.ascii	"\246t\224\020q\336OHG*\0028 \360\002\251\032c\003\"$\030GRo\017"
+	.ascii	"\002J\302<\215\024=\226\325\033q\241\205\325\241\rC/\035\232"
+	.ascii	"\200\027\230=\006\352x\360$;M\006G\235\201$H\200$H\200\304\004"
+	.ascii	"]R i\b8#\317\240\331h\351'\021\f\371y4^v\244\034\263\274a]\374"
+	.ascii	"\271\237\3639>\367s?\347s?\347s|\267j\345\347\221\305X\036)\261"
+	.ascii	"\324E\200\322\342\316\201\206\220B\262\260\f"
+	.text
+	.section	.gnu.lto_.refs.ee7445aa3bfa506c,"e",@progbits
+	.string	"(\265/\375`["
+	.string	"\255\006"
+	.string	"\022\316$(pM2\034\037\034\013\251p\257BUUUUUU\017"
+	.string	"H\204\2518\027\322\312"
+	.string	"`Q D\340\177B\b!do\231R\026\354`\233\201\242\254\243k\t\226j\007\246z\201\271v\232\024\255B?Sz\2437\340\347u\336\346}:\220\236\230\224\220L\035\021\t\001\371\360\350\340\330x\325X\315hV\214\251E\263\025\214R\274\023\257\304\0331\205x\037^\207\267\3626\274\f\353\302\253\360&L\021^\312d\026\335\242\357\252\250\235^\200\025z\227\351\336_F\277\b\034"
+	.ascii	"S\203\334\341\364L+-+!\3134\260y\261\373\263\rQrB#\364-\214\271"
+	.ascii	"\241\004w\241O\324\254\203e(+\240\332\002{<\227\201\025\260\007"
+	.ascii	"\226\201\025\231{\026\312:\177\312G\007\363\t"
+	.text
+	.section	.gnu.lto_.decls.ee7445aa3bfa506c,"e",@progbits
+	.string	"(\265/\375`\255)-\266"
+	.string	"\332\030M>Z0\210IH\351\253\302+lr_\034\023\330\210@\214\207\245\274\n_\330\212\335z\025\021\201\260\233\363\nE\374\270\204\252\322}\333*\230\344\253m\302\254\377\215\254YK\375q^"
+	.ascii	"|\b\320\250\017\232E\335+`y\025\233d\353\"~Qk\027\351\325\252"
+	.ascii	")hq\350\250\266\355\275e\n:\003\334\003\013\004b\314\247}\262"
+	.ascii	"\271\347z\214\315\f\025\"L\202\273\204\246\002\331\203\177\313"
+	.ascii	"\240\277\\P\253\3022\365\327\007\273\302\376h\363\305e\361/\025"
+	.ascii	"\364\375aw\237\317\376\260\373\305B\177{\240\277S\350\3205\242"
+	.ascii	"\024\254i6\375\325\241\333\\c\223\254\3053\207dn\215\034\372"
+	.ascii	"\356\260\353gw\330\335\202A3\210\353\340\323\234z\312\221FL\307"
+	.ascii	"\225%\311\321\342\265#(!J\264\26241\213\264\264pn\341r\363\344"
+	.ascii	"\212\305\225\247\262)]\005\n\027\225\323IK\021C\233\341l\256"
+	.ascii	"\260&\273L\224(\330\225\f\247\226\025\250)f\\\005\275\326]:\255"
+	.ascii	"\347\330\314\312\020\317\\\204\345'#\257\234\230\335\344\357"
+	.ascii	"\027\336k\rCW\351A6s\324\r\227\213)\346\273L\2735\231f\353\267"
+	.ascii	"\036\323g\332L\303\265\230n\353\257^k0\3570\255v\334\314\031"
+	.ascii	"\231s"
+	.string	".\372\023pA\257u\f\275u\233\314\274\204\026\025\201\n)/\344\342rnJ $\301nL\212\230*\r`;\004\004m/\215\326_\034\372\313\373\254\315\256;6s3\347\354\323o<\226\242,\276\315\201Z \347\346\260\353\347\2639\354n\253Pk\245\320\037\333\204\nu\032\364\335\005}\207\241\357,\364\215\003}7\r5\025\034d\323\007\007\f\\\225\227\305\357#\372\023\350\317Yk\330\211\365\230\bEZ\310\026\277\004\261\021\032\214\007JK2\215\305\017\201\366\223\206\322_\035\345\357\256nr\334d\231\273rn\362\334\343\024\2271\213\337^o\300*_\360\f\350{h\347\323C\273\243(\016\332yh\r\273\277\231\374\235\325Z\275u\223N\313\354\225s\023\350&\313\312\225\227\305\275e{I7\337[\255\344\t\270\340;\310\254\225s\263\267p\316\307n\bz\272!\320U\tr\344\332\341fk\330\241\035\264\373\355\315"
+	.ascii	"\272\311F@\302\337\027\260\0208\203\326\303\231\277\321X\001"
+	.ascii	"\264\323\006\340\177\033%\006\200\373\037fq\254\003\277\345\360"
+	.ascii	"[]\n%~{\246\r\205\316o\333RX\362\234\337\302\301\215\261A\377"
+	.ascii	"\275\340o$\313\300\331\314|\347\277E\037\020\360\257\002\364"
+	.ascii	"\027\013\364\267\232\375\261>\357\360[.J\b\376\277\271\350\340"
+	.ascii	"\304a\367\337\240\377jc\216\376\227\347\177\0312\316\377m\377"
+	.ascii	"\327\376\273\375g\373o\346?\234\335\261:\377\360\337\304\377"
+	.ascii	"\007.\364_\234\277u\376\366\371\273\347o\236\277\177\376\026"
+	.ascii	"\362\377\346\277\274\277a\370\333\312\337S\376.\373\273\312\337"
+	.ascii	"Xl\316\337K\376&\373[\314\342\374\367\371\357\221\337\242\277"
+	.ascii	"\355\277\237\177\267\371{\315\337r\177\247\371\333\355\357\266"
+	.ascii	"\277\305\374\235\366\367\331\337f\177o\371;\313\337C\376N\361"
+	.ascii	"\367\214\277\223\376\246\372{\352o\251\277\225\177\273\370\333"
+	.ascii	"\351o\026\1773\375\215\374\373\370w\376\273\002\177\247\3607"
+	.ascii	"\212\277\327\277\207\177\007\377\226\300\177\260\377c\377\227"
+	.ascii	"\374\377\362\267\372\267\321\337\351\337&\374\315\373O\345\357"
+	.ascii	"\t\374]\302\337\032\376\316\360w\320\337\f\374\r\364?\315\177"
+	.ascii	"4\377\317\374o\376\017\361_\313\177\006\236\317\347\363\327\261"
+	.ascii	"\360\243m~\007\306\004d\235s\224\245\036\316\035#S\033\032\\"
+	.ascii	"s\237\273Y\003\257e\226:@\025\252\tt\302\304\256\260Y\374\364"
+	.ascii	"A\223\363\361\303\342\347`\241\317\341\301\346\313\262\3519l"
+	.ascii	"l\222\241rV\020)re\202\033\203\214\211\027\2338\253&NNn\013\363"
+	.ascii	"\032Y\266@\243\206\036'\314\214Ec\306\222\331\345\334\315%\224"
+	.ascii	"\362\314\031K\0065\346,\004\003\016\252\241\335\021)4S\026\037"
+	.ascii	"\207\bz\034\027o_\366\315\252u&\303a\"c\343\314J\252\t\360\261"
+	.ascii	"\013\023J\234\363\375e\235v\355\203f6\366@\341P\346\t\216\256"
+	.ascii	"\241\267lv\314m\333\227m\263dz\313\270\003+.S)\207,\231\223\331"
+	.ascii	"\311\371\001\235\027\026\204D\311B\355\277\313Ge\316YJ\327\314"
+	.ascii	"\312\245\235\267\256{\350\347\351\333\021\374\307\371\376CI9"
+	.ascii	"\037\237\250\231A\215\214\035i\334C\276\356,g\244\225Q\003\253"
+	.ascii	"(\244\225\n\311.\253lD\n1\002)\263\2251\331\2253PF\"\215\035"
+	.ascii	",3P\262+Ge\025^\242:7\255\214\031\271\314@\031\231\217\036\222"
+	.ascii	"H\253\250d\3271\n(\331e\025\225\273\254\362OF\036\225,\220Y\t"
+	.ascii	"\224\273\254\334r\3272\352'\331\265\214JvY\361\350$,\256\246"
+	.ascii	"\244\234\250\351h\321]\222\310\354\342\251\306Q\371s\226l.\263"
+	.ascii	"Z\316\355\305\224\225\021\344\\c\251T;\252\320dKg.\226\244\034"
+	.ascii	"\227\315\341i\351j\231\221gI\026\2269\263\260t\224\237,06\317"
+	.ascii	"r\217>3\346\250\221\235\230rn\340)gc\347\263\234\2631\347|\243"
+	.ascii	"\254\321\314y\306O\222\371\364\2243\225\320S\256a,c\312\331z"
+	.ascii	"\255\221E%\273\256\226EeO\272\230yE\323\330\314\254f\245D\273"
+	.ascii	"\214L\262S\316\271\341Pf\324\2137\213\255\030\241\f:\232dY|\224"
+	.ascii	"\t\r#\264\003\203\023(cg\320/6\rg9\203\353\330\366\245\213\365"
+	.ascii	"\202\242\311\351\320r\245\213\215a\347\t\013\2244\213\177\363"
+	.ascii	"\304\232m\351\346\022I\033\213o\263X-\235\326\313\234\221\255"
+	.ascii	"\202\314\223\032\213\355\2625\354\b\320A;{\245\350\026KO\024"
+	.ascii	"\022'Q,\006\202\341\013\033\020\262\0346\331s\374\311H\025Pe"
+	.ascii	"\266\314\016\231s\316\260\301\024\362dVP\243\006\263i\303,\230"
+	.ascii	"\245b\243\330\027\254\024\353\304r\3311k\305\222Y%v\313\212Y"
+	.ascii	"(\326\3132\261Sl\025\373\304~\331&v\211\355\352/[f\223\334fY"
+	.ascii	"-9\035.\234W<\232\236T=\234\266\312F\317A\321A\303\311%\203\207"
+	.ascii	"\223FZ\225\325_T\244\347\320\326\230\371\260@X0{\264`2\211\260"
+	.ascii	"a\336X\316`\226\331\026,\222\333d\342\254\270\212s\226Y\0346"
+	.ascii	"y\233d\350\n'2\234\326\310_\304B\317\241\251\271 \210\005\222"
+	.ascii	"T\301\007s\2054'f\321\221\237\274\204&Wfwd\243\233\005edk\250"
+	.ascii	"\334\310!\261\021\303\002l\017\260\002z\213d\216\002y\303\215"
+	.ascii	"\221\247\2137\213\255\013E\267XA;%U3{\005 \254J\231\305778\320"
+	.ascii	"\337@\241\337\265A\357\365\206~\347\005\375\225\335\025\364\273"
+	.ascii	"&\372\335\r\324\376\300S\\t\b\261\370;\025\320\353\346\320\353"
+	.ascii	"\306\240\327\221\241\327q\241\327a\241\327\001A\257\333\201^"
+	.ascii	"W\205\236L\007\003\275\016\211\3369\006}\034\246\202\0363A\217"
+	.ascii	"y\240\3075\320c%z\234\247>\240\310)`Z6F\024\030\034n\\(\273\261"
+	.ascii	"\343\305\020\217\034\230%,+e\237\216W[n\026\277\002\026_Nk\264"
+	.ascii	"G)v\251\347\372\214\212\001I\300\234f\366\311\"m\262\317xh\240"
+	.ascii	"\025\305i\235l\223UZ(\353\302F\365\227}\262-n\2339{\311\265\232"
+	.ascii	"\236\353\2719\333\b\330\005\206:V\036+-V\336\347s\247\344\013"
+	.ascii	"\024\374d\327\330\346\250\254Y\334\324\332\201\202\372\261l\262"
+	.ascii	"jP\314\200\260\265\030\262\033\342\325Tb1^\302K8\031\346\305"
+	.ascii	"\207\323\316\2003\363\201W\034's\346\230\334\3000\023\005k?\204"
+	.ascii	"X\214UX\025\232\212H5a$\020\022\033\261\361:ePB\344y\245\231"
+	.ascii	"\360(#\326\366|Z2B\313\313f\265\343\nV\316\\\312\262\302\332"
+	.ascii	"\264\321\265 U\346$k\315\232\353\324M\312\336f\340.i\232\310"
+	.ascii	"\270\222\223\273b\204\226F\267!%]\2120o\306\252~\242\340\340"
+	.ascii	"n\032\241\245\361mH\211\361y%\016\307\212\231S\2174\027M\016"
+	.ascii	"\r\246\224,\213\357\231g\030\264-\264k\006\254L\231\353\226a"
+	.ascii	"+j\315\013q=h;Z4]\347\257\233\317\322\021 a`x\260\332\322d\334"
+	.ascii	"`c\273m=\346\266ELm\314o[?\2738\331\202f\304J\005\234\305\367"
+	.ascii	"i\n\023\346\212\351&\031\252\001eE\230i\254\370\210q\325~\305"
+	.ascii	"\330\244\365Qe\354\314\236\355\260Y5yQ\203\336\213\227\233&\264"
+	.ascii	"\274a\312\320\314a\345L5\204WP\243d-\355~\221\223\261lc\361E"
+	.ascii	"\373\351\200B\305\n\372\236\261\263\257{\326U4\360\312\307\250"
+	.ascii	"!\030\214pZ@A\316\\\260\370=6\314\256Yo\3412\343\333\214\270"
+	.ascii	"\254\2742A\021\2312\351\266\345n\261j\230+\216\fM\326\022\t\027"
+	.ascii	"\"\277Z\227\310\315r\223T\371\205\004e\230\360\314\230b\241\303"
+	.ascii	"b,Md\316Y\350\246I\006\230\027\031\372\326Rr\267\324^h\336%Z"
+	.ascii	"18\271\256\223\026\266@\271c}F\365\223\221bc\234ZS.\223\273\244"
+	.ascii	"\307\b\224s\0163f\225{\345\302p\251\334\027\256\225\376\272S"
+	.ascii	"\356\023\241;\3456\341\342\324\001sf\310Y\017V\362\266\007\226"
+	.ascii	"\222\037,Ys\336\261\353u\305\372\214\252\231\245t\302\210\260"
+	.ascii	"\305\221\335\262\376\272c\027jf\t$\340\300\263FL\334\222\235"
+	.ascii	"X\330\016Y\013\032+,\276R\272KKS\016f\224\376\272`>+\212\264"
+	.ascii	"\371z\033\013c\213\246W\3011\312\262\270\004A\317\263\002z\236"
+	.ascii	"\031\267\013MsV\361\300@\317\243D\317\323\204\236g\t\375\316"
+	.ascii	"\334\326]\322\225\305\214\331\022\213\306\305iI\rz\221\334,\237"
+	.ascii	"$d;"
+	.string	"\300\222@\300G\f`\026c,\253e\b\363\311\205\0365!_LZ\320\201=\315\310\260\370\036A\231v\306|\310\251\022\273A\303\310\255\272,\244\360l\243\326\032v\267H\321\257\021\0353+\316-\213w\220\364\255\361+\344\326\270C,\223\246T\017T\227\032\023\340,\311\033i,\016\323\364\302\302\362%\304\342\353\343\002\271A~\034\234)Nh5\244\240\277?rxx\tr\304b\333\257\262\273<~{\37487ZJ\344\027\024\364w\307]\341\307\271m\266Laa\361w\266\320_\035\027`\303\201\304\342\233\003e\332a~\300Yk\322vs\374\367\206\275q\257(`\235hP\225\261\370\342\270V\277Ww\231\357\225\005\313\234\217\367\312\207M\316G\237n\b\272!\300I\256\206D\331\341\357\374@{:hw\253\212~m\330!^Z\264X\314\263\3434c\006\0303\313\0200oTTi@\2307Y^\262|\304"
+	.ascii	"\003\306\235rr\303I\325\343\006\334\215\361;\205\321\266\300"
+	.ascii	"\250Y\3743\307\331\231A\261Q\003\206^\251+u\235>\3100%\007L\212"
+	.ascii	")\206\210Ri\311t\003\270\314\234"
+	.string	";\246\2256\244\f\027.\256\323\007y\001Q;\260\260n\312\244\214ac\361u\222MM\327\351\003c\006$LvT\342\314<\235\266p\210\030\271r\202\273\311\233\274,p\336\b\340\202\233\016G\325r\210\305\227E\223\241[\314\266\230\24511\ra\352\310\360\262\004\313\025\364\"/\322\222A\263\221\033\004F\213\260(\307\257{\264[:\007\305\244ap\204\210\024\300\341p\003\024\204\020H\301\001\b=\021)\212\336\007\004\350\371\021\b\"\241\272!\345\355\254\3510MM\330\255B\017\210'\370\324\"\221\004\242\n\200\365\004\221\017i\335\001\245)|)\211#bo\365m\370\001\001\205k1(\364\361~\210I&\222|\300\236o\303\217@\020y>\016\016(a\204\t\021\033\360\034\320\201\b!\360D\220\340\225\030\001\364\333\240\230\022\203IA\301\364\347G \210\210k\212B]\177\r\024y\304\020P\242\n\004\252H\273\037\201"
+	.string	"\301\304\210\022D\305\324h\355\025=\234\340\023\002E\244\253P\304O\035\022\t\375\210\275\b\244?!\322\252\366\202R\f\205\"\212C\"\243\241/\230\344A1%\352\004OX\035\221\267S\344\005\215\206\272\240\321\360\246)\250DL$\246\353\357\327\273I1\024\372\360Z\034\336\363\244X\213D\325(%\301\373\245A#\025\330\273\371\245\304$\354K\2117\357\025{?\236\321\020D\317\332;\362a\340\020)5a4\f@\212\224DLI\374\202\351\220\230TB\211DP\004\022\034\212k\257XbCJ\034\021\002qDQ\r\216\330!\341[wE\237\037\201\360\361R$\265\030LZ\211|\002\320\t*\366~C\022\032\240"
+	.string	"Dq\355\rA\224\020\024!\002\244\264HLQ\202\347\276\373\3245\r\246F\350-\300"
+	.string	"\001\030d\240t\363\fBP\020\202\202\3353\bQT\024\002\203\"\364\030\024\335\"\3577BIh\302\r\320\204\036Q\355\300(\250\"\255\275\f)\217h\324\003z"
+	.string	"\364#\020J+\221\322\032\244\264\346\f{H\276U\267\246?\025\205p\035\376R\245\025\330S\327\224\b\244\224\002\207I\035\234"
+	.string	"\366\216r\200B\237\260(\\\207>?\025\247\030L\022\372x'V\236:$\362\224\326\r\351O]\327\024\205\220\027T=\024y7F=\023B\225g\224\004\034\n\001\t\213I=\336/\250\232\300+\366\210<\244\244\265xB:$:\260\223\002{>bNqMQ\004U\236J$\256:\276\365\247\"\351\202*\022z\202/=\362)\365\220P\037\242\b`\017EP\250\026{@\341pM\213\301\021\276u\0031MW\243\264\203\024h\024\334"
+	.string	"\251'\002\305\360\004\003?\240\360\210\230\256G&\322bo\203\364'\faU{BA\325\227\022\223xi0\330;\362\361\224\222z<\245\036\222\017\221g\244\236\b\nE\374"
+	.ascii	"\241(\b\201<\007zR\364\200\351\217w\342\204\360\310WTQ \362\200"
+	.ascii	"@\365\204\fE^\0067\351\232\364K}\302u\310c\340G\035.\034\246"
+	.ascii	"+QQ(\\\211t\210\274\"\017\203\242bP\275!\026\203)\212tg\024T"
+	.ascii	"WaQ\r\n\221rR\024j\321\327\333\245k\322\032DB\003P\355y\360S"
+	.ascii	"\201=\024A(\bAH\201\305\242p=*\002\0257\370\245GD5\250z\220r"
+	.ascii	"\360\003&\t\217J\030\005\325_\260\007\344\240\241\310K@\005\305"
+	.ascii	"\240\232\204\026Sb\272\216\360\023\252k:B\257\330\353@\211\204"
+	.ascii	"QPE\241\246\276tu \345\215\340\223\022{GC]\312#\241\341\nP\200"
+	.ascii	"\b\017$@\340\001\250\017Dz\242G\004\252\275\023D\305##\025x\202"
+	.ascii	"(\250\366\220\210|+\221\b\304\003i\261W,qBP\005Ai\325\001\n\205"
+	.ascii	"\034\360t9p2\347\211\013l^WN\034\2749\351\260\272y\007\022\271"
+	.ascii	"\030\0267\233:d6\276`\330\345M\223\313,\221\2627\334\334\222"
+	.ascii	"\240\001bqU\225%\203\343\013\r\032\327\251\2632g\n\224\020\331"
+	.ascii	"\201\025\007\264\205c\340\030X\006\2161g\n\013\025\214!,\003"
+	.ascii	"S\271\335\200q\206\n\253\240\342E\230\037a\256{\301\004\307\232"
+	.ascii	"\305S\266\305\r\2711YL\364\3070n[\017\030S\0243/,\031\374%\203"
+	.ascii	"\307\225T\332\3252v\304\005\033u\305\364LU\235\305\260"
+	.ascii	"8\203\222\250\242\341"
+	.string	"@\tZ\245\220!\222\021\031I\222\2441B\n\020\006\244i\030\350\261\033\022 \004I\017\203\214\031\031\022\021IAJR\310\264\033\357\312\325\223\227\203y\0375,\202\303R\005[\373\333\367\360A#\201$}X\270\250\347\213\354H\216\003T\312\374m\300X\023\004\363\263\037Z7\357\3300Cb\300\020\370\370\357\021\337\003\370\323\226=\276\220\361\256\213rYa\221\252-\353\356y\275c\3449\242^T4\213@2\223\023+F\031>i\276\212\246\2231x\363.G\030$*\334\234i\255f\007\033\2223\333\266-<|S\004\031\300\306\377\267\315H_\201\314keT\350\3761\355R9G\377\261\303dj\242\224Ad\237\300\304\304\016\3635\315\344\005@\331\210\311\202\324q\241\034\343F_\365\327$\002`\216\3630d\363\316x\364\312\347)\203[R&\234a\225C\360\223\257a8\231a\017i\250\303eA~\210g\376"
+	.string	"?$\334"
+	.string	"\314+8/^\322H\373\204 V\202\002\346\316\007\021\276\320=pBW\272\305\036\023Df\240\216TZ\250\246\264\215>Yk\310\"F\201\355\352\345\225\335r\321\"\262\214G\336a\341h\274\025\336\362\216z\233"
+	.string	"\f\213b\263?=[\201<\261[\333\334\316-+\034&}\362P\334\377\203Y\310\0059\022\022\241\263\tM\325c\373\367'\b\263A\350\n\013\267\346\245:\251\350\033\352\205\027n\346\244\220\003\222\245#\2608\202\232D\022\r<\"\223t\315\\ojCa\240\213 f\037\252\375\220\310c\343rC\216"
+	.string	"r[\234\0071<\022\013\333\342}'\336\201/\004@\315\013\330\334\032\364J,\346\017\261\367)Fjs\020\027\366\"\307\250}\242\246'\240#q\241a\246it\207\357\261\221\276<\035\323\017"
+	.string	"\323\026oe>u\230\220R|D\215\246\376\027\360h\024\004\331Q\316\300D\274\200\004\203\177\201\340\311\234"
+	.string	"j\257\270A'\3354\312\251?\345\255\252\277\0279l\n\212\212%]0\227\016\025&\246\363\311u\373"
+	.string	"\004\337\343\343A\363K\363\255\256\313|m\226x\335\235\300\260\223\207\252\252\247\251e\227\306\241^io\376Z3\366\243\031\261i\263\207\024}\256\031\232j\204\361)\310\310\340\300\343o\272\352\\\226\214\321\323\304\316\f\377\232\244b\327\2647H\0222\373\332\315|\265J\027\232\266{\025i\300\220\221\364&Y\246V\372\245*\213^x\271Ho\361^\212\276\243\334\350\b\232y\003\006\234z!\037\226\254\321<)\331U\215\030\336nk-\031\374\224\211\202[\024H}\024\240\3374\210\031\030\226"
+	.string	"\323a\"M\004\006\265\366\2615^X\227\233n\332\222`\321\340\021\244\236\366D\240\365\272\210\002&$m\022\024Pl{\274\370`\316L\t\344\266z_\203\214\213\f\340~yu\271\277\2578\226Z\377\212OeL\220\254\307M\342\275\245\344\201\344$\364\357\005\b\212\261+\331,\232\005\231\367\214\300\001@\310\217~\340(\226\210\370\323\351\351\275"
+	.string	"\321\322\362\204\314\203V\032n\353\267X\346\303\352\277\202D=\020\245\326d\243\263\242\001\342\363t\2756\350\314B\036\021\356@p\225\315\f\rT\275g5!\320\354F\367\272*\305q\345\016\263{\233\313Q\310p+\204\310\005s\306\267?Z1lq\234\223\271\356\016\307\n\rI('\005s\270wU\214h\252\213\264\277kq\261Y^\305\fU \341\t\254kw\021\2729\323\n5<\245\2262ZO\342s\312\336&\033\227 "
+	.string	"e}V\366\310\205\333 #\222s\t\277"
+	.string	"\272d\324\353\377'\007\300\210\023\371G\203\317\037p6\306\221\333P\032\336\331\331\312\375Y\001~{\273[r,\030\b\302\271\210\214$B30\263\016\201#a\217\207\315\321 \300\355\366\273\304d\023\016\223j\201=\202\f\343Ic\354\376\356\354\312\315"
+	.string	"\350(A\347\343\f*o\275\220\332\332\316\210\201)h\250[\016\201\366FXq)$\306\004\330\307\333\030\352\246\373\366\222)F\225\001\004N\276\001\001\260\005C,>NI\"k\323\300\273\347`m\351 \\\351\310\206\304\225\026prt\3450ea\300\216\275)U\224\260\037\225\337j\337\275\356\277x\244R\300\252\246\001(G\272\340\n\210\334\327J\200guEu5\260)\333\247m\314\350\270Q\315\021y\203\215\022b\277\221\377\223\224~$\321[\232s\022T\320'/Y\323&\333\367/Q\335\260U|t6\304\376\360*\243|S\207\t\017s\200>W\375\351\220\255\321\035"
+	.string	"\017\245?}2\rB\017\320\024\367\365\3453\036\351K\304\\y\210\2160\370\357\235\205`\027\375:_ \r)\343\355\271#\036?I\264?a\220\240\250>\037f,\035\020\247\242\375\317c\235]p\214c|\237\266\003\017]f\206;K\342\001o\362'\032\031\347m\005\220\204\237\f3\003\034!\207\322\0012\363\261\214c\244\217R;\270|C\311r\371\204\305\232\213\221B\020\311*+w`K"
+	.string	"t.C\376Q\301\001\220\305\316\222\344\2570\016M\302\367\310\267B\205\3428V\020\206\241d\335\tT\307\321\301\336.\351FW.\2000\322\240\016\025\t\355\214\211\277\277ex\204[\036\376\026\362\263A\350\037\302r\031k\350\267C\203o\032bT\335\020)\235*\331G\013'\227\237\340\362\302=?n4\345\370\263\201\206\004m\007-30\360\312\233\004:\341h\374\3730\026N2\257\302\200f\372"
+	.string	"\004\335\005\217\300ND\244\276=\177\025vYZ\022$am\211\235\0015\302i\240\323KvC\336\b\332\315&o\223\377L\371\233\207W\035\323\036%\200\300\367\023L\206>\t\327\223\354\260Wm\310n\314)M\212\243\2425\344+\304\0212\316\211\226\220\372\213b\241\357)\341,\302\367\317_)"
+	.string	"\313\346>9m\342\376\202\342\321\347Bm\347\\\366\322\306m,\337\337\274\201\215\223\370\334\027\344\246\023G\213\356\005\377\032>?\315\311\365\364\262\333\005\323\016\301wI%\006\270i\2125\267\361o\027Y\361\213ui\203\264M\273\001\340d\322O\020dp\006\214\273 \fE\361\\\027C\363ipw\233\323\357\375|_\256\0320i\177\374>;\177\001\233\213\374\303|\277\211\016\357\205\316\314\236\360\346\332\377\025\336\327\317n\336\307X%\031\026\365\272\330Gc\024dS\321\345\032W\352"
+	.string	"\335c~;\370\244\351\325\232\317\220-\256\037\324'\316\017J7\224G\323C*>%\362{\200w\226\215\277?\321%l/)~\013'\233/\350\013B3\201u\310L}\374,\346-\371"
+	.ascii	"\003\233\3434\334w\214L:}\265o\353\367IgR\340\021\232\226\304"
+	.ascii	"\037\031\036\013\206\364_NG\355Ohl\305\215\2321\026\247\335\033"
+	.ascii	"/(G\357\370\337\275\034\305-\260;<\ts+"
+	.text
+	.section	.gnu.lto_.symtab.ee7445aa3bfa506c,"e",@progbits
+	.string	"failsafeConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\001"
+	.string	""
+	.string	"failsafeReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\001"
+	.string	""
+	.string	"failsafeInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\001"
+	.string	""
+	.string	"failsafePhase"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\001"
+	.string	""
+	.string	"failsafeIsMonitoring"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\001"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\001"
+	.string	""
+	.string	"failsafeStartMonitoring"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\001"
+	.string	""
+	.string	"failsafeIsReceivingRxData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\001"
+	.string	""
+	.string	"failsafeOnRxSuspend"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\001"
+	.string	""
+	.string	"failsafeOnRxResume"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\001"
+	.string	""
+	.string	"failsafeOnValidDataReceived"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\001"
+	.string	""
+	.string	"failsafeOnValidDataFailed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\001"
+	.string	""
+	.string	"failsafeUpdateState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\001"
+	.string	""
+	.string	"pgResetTemplate_failsafeConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\001"
+	.string	""
+	.string	"failsafeConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\001"
+	.string	""
+	.string	"failsafeConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\001"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\001"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\001"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\001"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\001"
+	.string	""
+	.string	"enableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\001"
+	.string	""
+	.string	"unsetArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\001"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\001"
+	.string	""
+	.string	"calculateThrottleStatus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\001"
+	.string	""
+	.string	"disableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\001"
+	.string	""
+	.string	"crashRecoveryModeActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\001"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\001"
+	.string	""
+	.string	"disarm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\001"
+	.string	""
+	.string	"isUsingSticksForArming"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\002"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.ee7445aa3bfa506c,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1891 @@
+	.file	"imu.c"
+	.section	.gnu.lto_.profile.109b7fc9bc88658c,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.109b7fc9bc88658c,"e",@progbits
+	.string	"(\265/\375`\251\003m\021"
+	.string	"D\026\235\004"
+	.string	":"
+	.string	"\255\234\214\225\013.\002"
+	.string	"\002\001\002"
+	.string	"\002\002\002\003\001\335\276\216\252\016\002\343\267\245\270\f\003\240\342\234\212\n\004\344\332\221\323\t\036\004\002\004\005\230\217\315\247\f`\002\005\002\005\002\006\002\006\002\007\002\b\002"
+	.string	"\002\t\002\n\002\n\013\013\013\f\002\t\006\002\r\005\002\016\017\005\n\002\n\006\352\263\360\321\b\n\013\f\r\017\020\021\022\023\024\025\230\317\373\332\002\006\006\002\006\026\030\330\266\351\240\0050\002\f\002\f\001\001\002\020\032\033\247\320\217\212\001\034\035\214\353\300\262\002"
+	.string	"\036\037\233\326\340\375\t"
+	.string	" \302\260\206\302\t"
+	.string	"\002\001!\"\313\217\213\376\004\030\002\f\002\021\002"
+	.string	"\002\r\006\002\021"
+	.string	""
+	.string	"#$%\366\256\273\332\017\n"
+	.string	"&'\203\366\244\240\016\n\017\002\017(\350\243\342\330\007\005\005\002\005)\311\272\265\346\002\004\002\022\002\022\002\001\002\001*\357\206\266\302\002"
+	.string	"+\367\204\224\344\001\b\002\023,\232\372\246\216\007"
+	.string	"-\313\304\355\226\017\003.\313\332\267\345\r\004/\221\326\260\227\004\006\020\002\0200\373\377\236\340\004\b1\220\262\215F\034\002"
+	.string	"\002\022\002"
+	.string	"\002\0242\231\324\344\225\004\0043\240\202\262\202\016\030\022\0224\247\243\357\305\b\024\002"
+	.string	"\002\0255\213\324\307\345\t6\234\347\353\351\b789:;<=>?\240\342\234\212\n"
+	.ascii	"j\250\221I\251\211L\222\302$\323\030\220\002\262\241\232\007"
+	.ascii	"\021\360T\302\230\022\021I\245 \225\302\260\031\004\342\030\305"
+	.ascii	"%\223\335\306s\313\362\030\275\377\242\364\223\035\244\223x."
+	.ascii	"a\261\323\025.\024\335(0\235\304\243\177s\303\241#\251u$r\221"
+	.ascii	"\211\376eRF\371\373d;\251w\004\361\232p.y\221\205\236\247\261"
+	.ascii	"\263\214\241\371\232BZ\207\371[IjI<%\374\246p\221g\0347`L\203"
+	.ascii	"\310\345\373g\343\350m\250`vG\fXA`$;\267\024\031\332\353\214"
+	.ascii	"\3662x\021;t1\232\177\317\250GVX\023Z\206\325\316\376\371\267"
+	.ascii	"\255\235\023\243\350\307\320\230]K\323\274tsN\331X\322\315\264"
+	.ascii	"\023\257\331\255\212\372,\375\362\346\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.109b7fc9bc88658c,"e",@progbits
+	.string	"(\265/\375`\237"
+	.string	"e\005"
+	.string	"B\206\023\033\200M\032\0033\201\t\231\220\211z\004\005"
+	.string	""
+	.string	"t?`\344\334f\021!DJ\231R\027\263\224fE\007\241O"
+	.ascii	"\270O\213PW\224\335\311&\261,bB\352\341\216\300a\266}D\336`\330"
+	.ascii	"\213U$\026a\036\f\373~!\251\017n\2765y&+ \220\202\231\273s\001"
+	.ascii	"\225<\273`\200\203g4/\314\302\027\303\312P\345\202\003d\3370"
+	.ascii	"j\204\001\020O\030\034:\032\313H\332\027h\355\274\320\205\r\210"
+	.ascii	"\216\260\266\205y+\027\270\204\331\326\253\274E\354\244\353\236"
+	.ascii	"\340\300c\203\266\222\026/\266c\232\272\001e\272\320@\200:x\276"
+	.ascii	"\272\bC"
+	.text
+	.section	.gnu.lto_.inline.109b7fc9bc88658c,"e",@progbits
+	.string	"(\265/\375`\314\007=\030"
+	.string	"V\034`D\360\222&\351\"\374\357$\271+E\217\330k\214\302\325E\207\003\f/T\232g\023!<+\032\370\264n3\216R\377\177\373\300\310D\252)\370\263\335\375G\315,)\252O$c\017\250\274\216=\350\035\366\267\275I\nD"
+	.string	"S"
+	.string	"R"
+	.string	"\333\365\202,\332\230g\"\177\025|\277\223\003\326\350\372\341\037\237\016\206]\327hm\215.\017\300\243r\325\326\3025)\373<\005\337y\2460D\333\225-\034M\330\266\236Oe\327\266\003~\246\362\246\355\205\017}u\001[v\nJN\360E\211\031<D'8\241\205\312B(\224WN\251\243m\001\025m\007\234\235\262\263\001\017O\202"
+	.string	"\256\210q\003\304\213yI\031'z\330\354\343\320\317\300x\376\204\252\266)\370/\2056(\204\214P\031\345m\202%\356\223\227\270K\034\376 \313:\231\2375\374Z\313\3242\267\354\260[R\300\022@\217\260\313\312\016\376{\354\b\0332\b\214#\034\022\301\341\302F"
+	.ascii	"\221\021\232\026*\321\0204DS\366\201)w\360[v5\004\b\2069fR\210"
+	.ascii	"\300nP\342\322d\006&,*U\013V8mC\263lX\022\377\277L[\255\246m"
+	.ascii	"\206+\220\024\031\225\335"
+	.string	"\251\341bp\336\3623\2524\344xdH:O\333\021;\276\356\365\225D\0321\214\262\f\333\005\237\311z\330\017\334\362Z\336Ea\230\325\220\234\033\fw\320\320\350@O\030\261\204\020d\331\t\266\026\200\264\250!I'\221\b)JJ\205\016`\"2De\364\022\240\0231\203\"\2651\310LQE)IIAI\n\315\001\320 \320\274\367\t\t\331\004\322X\265\016:\013\330\313E\327\006\002+\360ps\252;\240\264,\001 \254Z\003\351\305N'\206\300\022\305B,z\002\305\260;TD\320\2778\365Z>2T\222\335\306\200\n\033T\"r\241\340u\355S\200s=\2320z\205\315.X\306\247\322\253\030\2131\242\2000\036\362nr\243nR\364m4\275\320Z7Wl$8\035\356>\274\"{?\2651\273Hd\025\017E\032\352a\r\031\222)\212/*\357!0\035\225\365\005\342\004gw\251\tw\t\037\203d"
+	.ascii	"\257`[\204\374+T\256[\224\033t\316+Q\341\370t\316\274h\201\033"
+	.ascii	"\005\301\204\230\221\007\007\035S\321\233\307?\361\f\250\352"
+	.ascii	"d\001\264`\300\356h]{\372\332\203+\332C*[\024\202\376}\274\323"
+	.ascii	"g\352\022\375\210\254!\007l\246\023\002\354\340\026\2045\352"
+	.ascii	"i\"\243\373'\377\003\304\341\202\037P\211\332\374^\321\222\301"
+	.ascii	"\327\257\252\325a\304)\200mic\257\006\230Z\004&\320\022\025["
+	.ascii	"\374?\315\334\362\344&Z4\374\232\235\244\023\306\370@\270\247"
+	.ascii	"\356BC\317\263E\347\213t\201\373yB\227#\352[#\027\274\"\r\022"
+	.ascii	"\355\300\215\312\271\260\201\232a\356\022\363\215\3055\224\\"
+	.ascii	"\337\n\220e\242f\023TX\335\216\033\003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.109b7fc9bc88658c,"e",@progbits
+	.string	"(\265/\375`<\003-\f"
+	.string	"fP85`e\323\0300\f\203>\022\004\214\304"
+	.string	""
+	.string	""
+	.string	"\260R~H\263#\356K\306tMHG\306\021\b\030A0\350\021)\366[!\367\375\266\326\242m\031;$\2212\245\024%"
+	.string	"("
+	.string	"*"
+	.string	"\377\253\212\264\007\332\036x\027\344\027\361=]"
+	.string	"p\343\333\263\322o\253\337\346\366\021L\336\245\263_\333\251V\373\004\002\360\231\t\363(_\216\267\212Nt\242\020k<qo\rJ\231s\276\233\304\036\361\335\214[w\257n\275\267S\0245F[\300\266\237\203\345\222\302\266k8\305\320.X^\214\317\371\253\315u\271\001\340\345\256\225\207\001\nR\002B\253\3614\005k\nf\226%\001\275h M\303b\207\006\350\002\013}62\214\017\017\216\210\205>\230\326)h\346\272\313\016\356`EB\222\336\210\266\020\003\227\322K\261\377\340\351E\250\361\\\246\202\"\031%q\341\220\002\021\252:\017\022\240\002B\002\n\306\0243\306\030\241\021(C\325,-\273:"
+	.string	"\225\230Qz\204\366\266\030%M\006\315\346\265\250<\241\270\272\363\217\277\262nA\2150_M\030\231r\020#\237\317\006F\200\367"
+	.ascii	"y\263\013p\314\305\224Y\360\222\032,\343\035\332\013\r<\376\202"
+	.ascii	"\217\343\361\037Fy\325hc\003C\024\365\233\364\267l\230>Q.8\234"
+	.ascii	"\f\371\005\271\027\260)\271f*\236\013\336\370\216\345\\\016\224"
+	.ascii	"\265\344\263l\223\314\277@\243]\033\363+\346\237)m(\241\242"
+	.text
+	.section	.gnu.lto_.pureconst.109b7fc9bc88658c,"e",@progbits
+	.string	"(\265/\375 M\025\002"
+	.string	"\322\204\017\031\220U\215\001\347\240~wwqU\034\004\264m\333\266\216'\353\342\303\336)\003\236\300\0138\300\233\\\362\310!\013\217\004\307\033g\274\305S<q\304\0177\324\205\023\276|p\345\351\266\314l\020"
+	.text
+	.section	.gnu.lto_.ipa_modref.109b7fc9bc88658c,"e",@progbits
+	.string	"(\265/\375`\362\001\355\t"
+	.string	"r\215'+\200\251\031\016\234\204\340\214\024f\02530}\274\257(\031\271\fj\243\336d\233m\326l\033\351\017\206\277#\202\016\352\320\377\326\244L\001\273\346\032\034\3322\003\253\346+c\231\304=u\255Z\265\310\371\230\266\207T\345\325\343\225\b\247\247\243m\203rd0\242\342=@\274\b\245\371\370\030\013\220\340\342\223\027\nF\311CO\203r\352\027\276\021\2420\237\023F8(\t~:\345\316\243\351\234\312\247::\033\345\214N\251\\\352\362"
+	.ascii	"\177}}=\317\371\"z\200\312G\205\332gS\316\312\013\026\370N\004"
+	.ascii	"N\250!=\312\024\235\024+\233\001p\202!\233:\017\020HTU\224B:"
+	.ascii	"X\224=c\302\025\340\204R\026{N\275\b\005\035\2355\3416\214\242"
+	.ascii	"A\022%w<\177\201\027\240:\335`!\371tB\244\256#\252\230daQ\362"
+	.ascii	"LB\235Z;\373\277\233\021\345{\200\0178#^\305\345\366[\227\272"
+	.ascii	"W\211\325\265\327\032\024\337N^\013\325\212\342\200\266\300{"
+	.ascii	"\035\271\216\265\366a\367\226\nM\347\201\006\275X\342J\263\212"
+	.ascii	"\013\326\327?\323S=\333\316\200yi\274\013\330\375\212\027V\266"
+	.ascii	"\213)T\b1\245"
+	.text
+	.section	.gnu.lto_.lto.109b7fc9bc88658c,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_q.71.109b7fc9bc88658c,"e",@progbits
+	.string	"(\265/\375 P\275\001"
+	.string	"\304\002C"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200\204\002"
+	.string	""
+	.string	"\200\001\317"
+	.string	"?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001"
+	.string	"\003"
+	.ascii	"8\202\263(>\200\""
+	.text
+	.section	.gnu.lto_qP.72.109b7fc9bc88658c,"e",@progbits
+	.string	"(\265/\375 \231]\002"
+	.string	"\364\003\214"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200\204\002"
+	.string	""
+	.string	"\200\001\317"
+	.string	"?\202\210\200\320\001\177}\304\001{\303\001y\302\001w\301\001u\300\001s\277\001q\276\001o\275\001m\274\001k\273\001"
+	.string	"\003"
+	.ascii	"8\202'\013\342\030(\002"
+	.text
+	.section	.gnu.lto_headfree.73.109b7fc9bc88658c,"e",@progbits
+	.string	"(\265/\375 P\275\001"
+	.string	"\304\002C"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200\204\002"
+	.string	""
+	.string	"\200\001\317"
+	.string	"?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001"
+	.string	"\003"
+	.ascii	"8\202\263(>\200\""
+	.text
+	.section	.gnu.lto_offset.74.109b7fc9bc88658c,"e",@progbits
+	.string	"(\265/\375 P\275\001"
+	.string	"\304\002C"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200\204\002"
+	.string	""
+	.string	"\200\001\317"
+	.string	"?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001"
+	.string	"\003"
+	.ascii	"8\202\263(>\200\""
+	.text
+	.section	.gnu.lto_attitude.75.109b7fc9bc88658c,"e",@progbits
+	.string	"(\265/\375 4\205\001"
+	.string	"T\002'"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\031\001\025\001\002\005\001?\202\210\200\030\1773\273\0014\273\001\274\001\273\b}{\275\001"
+	.string	"\003"
+	.string	"f\nK\tz"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_imuConfig_Registry.79.109b7fc9bc88658c,"e",@progbits
+	.string	"(\265/\375 \223M\004"
+	.string	"\264\007a"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	"\005\001\212\001\206\200\200\374\342\303\367\261\037\006\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\314\006us\350\345\005uq"
+	.string	"\005\001\006'\001\n\226 ?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\030./src/main/flight/imu.c"
+	.string	"\004"
+	.ascii	")\"\301$\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_imuConfig.81.109b7fc9bc88658c,"e",@progbits
+	.string	"(\265/\375 XU\002"
+	.string	"\204\003K"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001(\005\001?\202\210\200\020\177}\274\001{\274\001\031\005\001\006''\001\304\0230yw\301\001u\300\001s\277\001q\276\001o\275\001m\273\001"
+	.string	"\006"
+	.string	"H\005I\352*\230\340\346\255)\343\r"
+	.ascii	"\016"
+	.text
+	.section	.gnu.lto_imuComputeRotationMatrix.82.109b7fc9bc88658c,"e",@progbits
+	.string	"(\265/\375`\305\007\255\034"
+	.string	"\346\357\242H\260\226Q:\226ia\025\255\201\031@\243\033\271Tz!-_\024G]\r\003\303\321\217\300\f.|\301\335\3669s "
+	.string	"%\t\0266\254\3159\337q\177\360\314Pb[\375\350\277\374\227\377\323\234\031q\343\345\177+\3712\311\024y"
+	.string	"\202"
+	.string	"\237"
+	.string	"\264\337;\277u~\347\374\306\371}\363\333\346w\315\357\331o\232\337\262\337\261\3373\277a\277_\277]\277[\277\311\337\254\337\373\373\277U"
+	.ascii	"\f\207\017(\235q\316\023\3072S\212\\\242\303\266Z\177(\021\204"
+	.ascii	"\372p\202\230\2226\b;\246\244\306|doQ\246\244\351\242!\024\321"
+	.ascii	"$f\316\371\333\032z\244?\262\352\222\302\204)\220\364\256\001"
+	.ascii	"sN_\230B\205z\325\266\3156\316~e\bz\304Hmik\033\322\"Dj\253,"
+	.ascii	"`\030\255\210<\253D[P'\027gX\206h\023Q\221\006\r-%\377$\364B"
+	.ascii	"[\332\362\354Z)w\004\177\264\022\275A\203\270\370\232s"
+	.string	"\006\2602)\220\016\326\034J\332\303\207\253PI\353\207\226\222\264U\242\346\220\236x\f\177\020\201?\332L\301/\r[Ysg\330\277\203~\003\375\366\375\356\375\346\375\366\371\275\373\255\373\235\373\215\373\335\363\373\366\333\366\273\366\233\347w\256\375U\317\266\216\345\220\364i\0300_XK\356\257v\313ZE\221TU*\355vqq\226d\273\247\\\n\310\260\3149\201\266(\225\201\003\b\0204}\277\253\245R\260\250f\205\230\023h\323\375j\271\203\267\272\272\244\273)NB\246\234\206>\005\252%\013n}\307\336\002\235\272r\333^\025\217\201V\241r[\036\225O\003\225\"U[\237\251\235\003\215\002\245\266\273(\335\003\205rR[\335\326\004q\030s\020\264\211\021\267\264\315E\320'&8\253\036!]\242\344\266\264\355\221\240E$\267'=l\024\002\026\372\351@4\364\343P\201\302\320\205\t?\fC\021\210~BF\033~?"
+	.string	"\\\224A\202\321\217CQ\221\321/\306\004T\226\356\f\002PR\300\r:HF\f\030Q6\033\004\324\373\013\027-tIYIn\030\205\260\005Z\277\334Y\026+T\350\354\344\254\016ou\233s,\2078k\242\004\211\233\305\331_\331\366\246\252fm|\266\206\252T\232}\204\210\2274;\353-MT\251${\320w\340\221b\262\231\215\351vfU\206\rc9\f\276\026\266\277\312\355k\025\205\215b9t\255\225\226!3F\375\324jm\200\227\250Q\\\346\t\215P\220$\265\262\034"
+	.string	"\003\021\031\342\346\021\340\2404\210\020\003\025I\024Ic\030\306s\230\006\271\220\204\330\243\327\206Q\362\257\343\370,D\024\361n8\017\213\263\373\345\016\343\256\247_\232\",\221\246x\213V\274\356\264\002\201\353A\317s`e\310\207\353\036\326>k\\C\303\343\231\330m\237E\324\313\034\350g\312\220\267C\306\346\254\225\267\304\263-\371j\323Y\213jE{\233\265\313\2413\311\320+gz\321k\271\004\336\353;}~iU\300<\n$\201\314\003k\007\220=\316:\334|\225\360\207\372Er"
+	.string	"\335\331\001<\343\271\251\244\001\242\333\351=\210\354\323\246\300f.\t\2709n.\0017\337\245\235"
+	.ascii	"\370\233\321\365J\n\374\315\350\016\301\"\216\301\344M\263\231"
+	.ascii	"5\341N:\265\333\316;\355<cG\211\306\2649;W\225\250\236\370\301"
+	.ascii	"\351\257\245\343\030T\006%\031\203\261\200Cw\336\017M\f\371\324"
+	.ascii	"\342=\177"
+	.text
+	.section	.gnu.lto_imuConfigure.85.109b7fc9bc88658c,"e",@progbits
+	.string	"(\265/\375`\021\003\335\023"
+	.string	"\006%\200H\320\360(\035\362\215\275\n\312\274\244v\302\224\215L.d7\032\377T{m\231\2440]\312(M\267\252\367\343\377m\013s\177\0252k_?\305\003\301?d"
+	.string	"r\316m00\236c\314\"&\321\245\356L\332od\023)S\nc"
+	.string	"^"
+	.string	"u"
+	.ascii	"D\007\226\346\334\260\2431s\362\007\204\355\373#\256\323r\233"
+	.ascii	"O4%\360\322n\261\301\313\203\266U\355\337\034'\366Z\006\3139"
+	.ascii	"9\334\364\314iC`\003\250K\001\037\360]\352U\337\245c\266\322"
+	.ascii	"m\037\346o)`nMs\316p=<v\215\371\317yj\214\321p=\215\3149\255"
+	.ascii	"c\214\314\275\267\rb{\304^Z\373\231\b\027\335Yw\367\033\2321"
+	.ascii	"}u\017S\303\256\227\250\200\232\363E\304'\361\233\212Osi\221"
+	.ascii	"E?^\372,\337\345\027\244\035\331\324d\272\263m.\272\035\354{"
+	.ascii	"sg\354\327~\017\251VIu\207\2529>5\370\2517>uJ\252QR}R\365"
+	.string	"\347\251\245T{R\275\252VO\375\017\360&\337e\202\232\243Q\007\256\315\340E.\344\213\006'\312\201\033@&\311fcm\007o1\0044\352\036\\\250$hcA\035Rjm\bg\021a\205\2274\352$\034\250DEj\001\320\220lPkO\370\217\317iQ\337\236\344~&\347\331\2212j\336\332'Ga\234\007\2149\247\210o\342'V\254V\353\273\334\244Q\207\273\217\320-7\255`\2673z\231S\006\262\353\005\254\224\326\312\211\311\212\350\202\255X\257\227\2702a\245\300`\342\013\005F\300\253\020\f*\256\020\206\322r\245P\bW\\'*\341\352u!\f\371\260h\201\365\na\242\370\nA\233\354\336\334\031\022\234\234l]\334\2611\026<\347\036S\315\322\250S\255q\237Q\3044\013t\354gA\034\253\332\353\\\366\320\340fL\036\313\261\260\232%\230\032\262\020;\266&\337\350G\306\3714&1\217y\0029 "
+	.ascii	"\003\021!\243\003s\241Mg\340\276\357\330\333`\367R\316\262R\205"
+	.ascii	"R\004\330\332\213\354w[\207#\016\257\367-\324\355DYc\334\022"
+	.ascii	"\177\023\276e),\343V\372h\220\342F\352p\314\336\230Uf\230\024"
+	.ascii	"\227,\004\023w\217\\0\3067\352q\317\267\253\230\260\r\334\206"
+	.ascii	"\257\013n\250f\344l\273y\342z\205\t\311.4\fk^\306\t\215}!\022"
+	.ascii	"\261\277\002\271\345\205p\310"
+	.text
+	.section	.gnu.lto_imuInit.86.109b7fc9bc88658c,"e",@progbits
+	.string	"(\265/\375`\355\001u\021"
+	.string	"F\341rF\340\322&\035R]\f\321\266\216\315{3\260{F\032n\235\223Eb0FG\317G\274\243\005\025\301\031\272\326,!\262\362'\344hKZ\207\300\347\373|\017c\317\300\034A\233\337\332A\341\002v\260wH#dK\231RZ"
+	.string	"U"
+	.string	"g"
+	.ascii	"0\255i\032jZ3\235O_$Eh\211GIlwf\006d\213\264!\025\266\217\262"
+	.ascii	"g#\035f\263\3771\222\371Y\332\335NS\334;\324"
+	.string	"\364\374\347<$\276\276C\256\304\025\032\220\315\370\001\340\345\202\"38\3619\317\021\257V\346I\301\356:\343\213\304\255\335\366\211m\022;A\004A\333\265\314\021\223\002\244\252\255\262\222\2170\225\251\266jC>\252\022p\351\347kj*\311\0041\313yV\334\356\"\360u\276\363\301\277\271f\027\230|\274\346\303l\327\256\032M\330\240\320\331a\345\314\206}\2515\366\341\356\256\225\306\316tJ\323(Ms\232>ez\013\372y@\332\f\032\344\243\023\210\250\250\245\237Q1\007D'|\260`\034JC\340\350\340b<pP\312\210I'u\354\353s\264\353\004\263\031\222k\2275\302\351cn\264r\346MO\252\355\210\221i\272\351!\034F\004\022#K\370\213\t\005\214Z\334\005\205\n((\3335MC\206\224\230v\240\372=\367q\314\277q\212\203\034V)\201aQu/\0322\2508`\350:\250,\260t*-.]\211"
+	.ascii	"\257<\254\264t/\253UK\207\202\355\341*\215!\016!&\031K[\320["
+	.ascii	"\241\372\331\260\357\267i\222\t\251\326\370\300Sz\241\347\310"
+	.ascii	"\225M\036I\337\313\331\316\3426L\270]\326\243O\3435<\035\217"
+	.ascii	"\307$\037M\266k\366\202\223|Li\n\250G\221\210' P\202A\350\314"
+	.ascii	"<cB\363)\206\246\300\344,\007\230e\331\260ud\225\t/\216)\320"
+	.ascii	">\312\257x\\\t\303d\240dD\333\023\210R\273\227\343\210\333$j"
+	.ascii	"\241\013D\206\013\257b\202\224\336\"`\301j\211!\003'\323;\263"
+	.ascii	"\013<\017\2516Y\316\030\nw7\316\210\353`2\231\303&i`p\017"
+	.text
+	.section	.gnu.lto_imuResetAccelerationSum.87.109b7fc9bc88658c,"e",@progbits
+	.string	"(\265/\375`\227"
+	.string	"5\t"
+	.string	"\026\320;90\217\323\001\244\240i\227I."
+	.string	"hy\214\263\235\362x\334`\031_\267\227"
+	.string	"\363t>B\354\307\3000\274\3753\031]\214H\026<\201\2039\340\373\026\214q,\342s\333\275S\n("
+	.string	","
+	.string	","
+	.string	"\357\230\263a\376}\354\301\361\002\024w\267N\217s\227\234\177\221s:T\351r\203\260\273\226\035*\343\236\267=`\233\300~B'\251\360\275S[\220\344\273S\237t\235\316\030\225(c\222\243\375\225\344\354\260\257\331\231\2627\001\033.\037\224]\214qf[\264\005\304v\367<\261m\247P|\312U\314\362=\217\274\362\352:\245\032\341U\017Ay\263.\361\340'&`H\301m\033\274\204\002\340ew?\376H\006yF!\254\212\036\0340\210\206\032\201-\204*H\333\252G\300\231\004\203VEY\246\325\316\267\327\354L)p\264L\363d?\273\374\225\263d\016\025"
+	.string	"3\241\215(\360\rz\373\250\274H\355`0\362'\226y\030\f\001\343V%\025\b\006\266\003\2068\305"
+	.ascii	"\030&\252\032t!'\013v\274\f\001.\335\242\235O"
+	.text
+	.section	.gnu.lto_imuTransformVectorBodyToEarth.90.109b7fc9bc88658c,"e",@progbits
+	.string	"(\265/\375`\032\005U\031"
+	.string	"6\254\226G\260\230M:pj \333U\036T&o\"\204M\272\276\272\241\370\177\207 \252\210\017\303\372\224\206\256\\\006\236Bu\336\340(%igggc\365g\355\013\311k\365\370\203[Q\n/\215\241\033=\355\351nMZ\222)\005\203"
+	.string	"l"
+	.string	"\211"
+	.string	"\321\304\217KD\002J\301p\223\375d\373\374\326v2\224o4\346\343\361<\205\b0\202\026K\220P\212a\340\325\263\r\235\233B\274\210N\324\354\222\\P\2111\0320\330\002/\203\001X\316\3264\\Cg&\021\256\305\210t\325#\306\036Ow^\006\3333M\313\340\313\266\226\301\352Z)\356\361\242+i\005\t(-1F\334\223\254s\352j\3370l\207\202\310\351j\020cl\356P\244p\357\266\003\332\366\264`\215\tp8G\206\372\205\301n\350\220\336\031\254;\264\f\372.\247\037KRE\371k{D\371\026\255Y\361H\255\233\\\035?\2719\366\27173\331"
+	.string	"\236\305y\366\346Y\233gk\236\245yv\346Y\333\2632\317\326\236\245=\033\363\354\354Y\230ge\317\306\236}y\026\366\354\353Y\327\263\255g\301gY\317\376\331|\326\002fF\222(\310\022\003M\032\3720\241\202\271l\211\222\334-I\354\352\345\256\337\236;\216X\300\376\372\313q\250~|\244\241\247\2148\204\335S\026\342\"\r\035E$g\337\220t\247\356\250\326\177\327\301\035G,\214\362W\360\254\267\336\2722\301A\0322"
+	.string	"\262"
+	.string	"<\003\036\377h\350\343#\207\223b\335GI*\357\377,\250#\031F@\356\321p\207\327Vp\030\364\2121\"\340\341@\210@\325\013\021-\203\371\035%\246\250\206:\274\266\007\254#w\253\2121\006\036\374\301 \314\301\215\320\263!\b\b\247\201\302\004 \013\022p\027\200 \004\341\"\fe\300\365\334T\b\303\317\020N\203\220\320\020.\326\213f\305#\365\301\021$E7\252\316\333\237\214\277 K*p\336\205\213\251vVE\371k\316q\276`\306\224#\253\333\2674\224U]\235w' K*n^s\035\233\303~\223\005\313\025\033\232\333^3s\3604V\032\372XU\231\271m\212\224(2w9M-\325\036\363\034\332a\257Ay\222\263\317\tmv\331c`\016~\026f\250\201P\245\2244B\"\005)(I\322\032\300\002\221\031*;\021"
+	.string	"\235B\020\242\222b[c#\232\276RP\004\340\236\365\265\025N\361%\356[\341\216y\270\2515\206B\204g\310\314\254\361_?\340\366N\303cC\347\217X\202\375]\351`:\263\357\207x\266\255\357\366\334\323\363).F\247\245^\240Z\tG\326P0{\212\322\237#MG%c3\177k'\036\021\302\364H|\0246.\314\t\035=h\304\344\360dE`\211^\203\340\356\034\t\302L\016\224"
+	.string	"\336u\302o\257T\256\211\024\201\325A\n\222\316C&\024chbx"
+	.ascii	"\023\007\204\324\200\330\327D\177\263(c\207\324\212\230\316\364"
+	.ascii	"\330\323\rz|\335H\261,\017\222\nmj\261\255?"
+	.text
+	.section	.gnu.lto_imuCalculateAcceleration.91.109b7fc9bc88658c,"e",@progbits
+	.string	"(\265/\375`-\r\235<"
+	.string	"\212h,\026:0\350M\007\370\370C\370\243!\024\313\202\231qf\032Zo8N\224\017a\355\346 ;8w\302\343\037\007z"
+	.string	"\210\001T'p\017G\22696\332\311\344\t\r\262\245\354\226RJ\0018\001B\001Z\001\316\024\254\363\004\353,\301:G\260\316\020\254\363\203\353\354u\235\273\256\263\003\353\334\300:3\270\316\\\327y\301uV\220:o\245\316\t\2563\202\353|\300:\033\260\316\005\2543\001\353<\340:kM9\013\260\316Y\3269\200u\006`\235\261\254\363\225u\266\262\316U\326\231\312:\017\255\363\224u\026Z\347\324:_\353l\205\316h\352\034\274\316o\235\335:\367\217"
+	.string	"X\034yh\264\256R\236\244V>4/M\337\351\306\323\250\007=\310\334}\327L\03623\036%\\mX+\2247=j\326u\035c\273\266\243\366\235%\351\332\024\025b\372"
+	.ascii	"\256\353\024\n\215rX\332(\363Q\2653\367\234\246\243\366\222\t"
+	.ascii	"\013\327\325K\245@\353\272\2021\204\264Q\256\326\262\215\006"
+	.ascii	";\3136\312*\363_\333\321\255WL\2347f\250u]\211/\246\325\026\246"
+	.ascii	"\327\242\301w\225[xD\256\2650mf3\360B\005\256o\226\266V\310\267"
+	.ascii	" \327\272\256C\244\321\321~4%\351\346A+\375\301\tr\212\254X!"
+	.ascii	"\333\202Z\216\276\\jf;\024d\321\375\226\255\353\312~DRi\236j"
+	.ascii	"f\216c\346\016\314Uf\001\254\326\351I\355\250#Az\344\315{\266"
+	.ascii	"\321\364/'J\312\373\314\"\272\021X/R\224\350:\363\3543\223\350"
+	.ascii	"C\334\024\300l\242\357P\\\371\242B\334\\\300)\232\320\212\004"
+	.ascii	"t\353\272j\320\353=\026-\\\270\260\215\332\277\234&)\363\202"
+	.ascii	"\3503\363W\347\301\370\352[\327u\214;P\013\222\301m\246Q\236"
+	.ascii	"A\203\306q\023\372h\340[)6\177v\2439\312\361\375\317\261\204"
+	.ascii	">\263\301\347q\347\327\346\242\230\333O\3779\263\201\003\307"
+	.ascii	"\243w\222\224\311\177\356=\315\007\215\333\f\247\251y\037\033"
+	.ascii	"\345V\263\215\366\242\343&\377\377\306dd\304V|\022\307\367\347"
+	.ascii	"\337T\3464\215u\305f\033\3432qY\231\354\371D\324\266\256l\016"
+	.ascii	"\372\315\336\377\030\353\212\376\344\025\337_cN\036# \233?\231"
+	.ascii	"\355\326\374\347\230;\270>\030\346\324\331\307uN\273\3169\256"
+	.ascii	"\263\215\306\323l\326\313\356\025\327\031\305u>A\345l\202\312"
+	.ascii	"\271\004\2253\211\353<\342:\213\270\316eCg2\353\034\342:\203"
+	.ascii	"H\235?\\g\017\327\271\303u\3460t\036"
+	.string	"\273\316\033Rg\r\327Y\354:g\270\316\030\206\316\027\256\263\205\324\271\202u&Z\3470\353\ff\235\277l\237\365\020\274\376\301{`\327{i\351z\341\240O\312\344u\360q\r\336\301\267\221\021\203\317\372\006\\\317\340C\fZ\360\n\236\353\237i\224+S\360\013\276\215q\366x\022-\211\232\202\027B\352\344\344BnR\324\330\237\343-\353\343\233\331\351\246\356-\273\365>\236\375-Y\364\247[9\323\202c\353/\233N\312$\332}f\023\274\216-\216<K]\212OQ\273|Q\347\346l\243\t\376V\311\344\\\"\370(_}\340\021|\033\345\374\350PxO\f\353\351\331F\017<:\350\317\2314\360\356\304\337\n|\2007@\340\207_\340/\323X7\340\263\236\300\267Q\215\326\017\370\240'#\240\200\327\372\036\343nj\031b\237z\306\333\3244`}^\024\360D\277%\233?\331\327\270\351\325\327\227\365^~\313g\251"
+	.string	"\377\177p"
+	.string	"\236\324(\254\267z"
+	.string	"W?|\254\017b2\3269\257@q3\375d\365\217\351P^\325w\342D\365\302\257z\227d\224\033\376\324S}\033\353\212\r\330\232\270\251\256a@\f\3106:\374\007~\311?nzuM\275\327\230\345%n\246\225\332\322\n\225\215\352\306\373\250\272\261\215\n\037-bRvy\343\365\235\252L\327u\355#\263*G\245\343}do\256\341k\3735N\237\0031v\370\0165!8\200\250\245\245\241\tc\240\035\001\242\266\303rZ\030\222 ?\210G|\364\370\001\204\007Q\310\017\264 \304\264\"F\210a\005x\b\021\265\"\304#C\206\024!\016\355\326~0/\262\360\261}\221\227\004\327\325\013\031\340\035\1772\212Gt\342Q\030\342='\353\235\370 \023.i\342\t\225x\022o\242\204\017r\275&\243\232\0046yz\037\233<m\243$\036m\303\343\034\361\202\002\245\275\210\037\341\200\376\210"
+	.ascii	"\361eid_\026\202\354\271"
+	.string	"\366\204\370\2561\311\017\017b\315\363\234\265\036\236\n\327x\314\017/V\345\251\\\376\335\235\034\337\341=\200\271\035ZZ\247\303\206\347\220c\3549\\\215i\370\rr\342(58\227b\017\007\255\252\357\215\215\317\360b\337\201F\271\242\267A\033c\257s6j\321M}{\263\215f\370*\277<\017n\3411@Q\243x\037m<\227\333\257\361\205\3070\346SH\265\212\355\343\205o$\227\no\341}\357\212\2439\353\275,~F\205\353<}f*\274\030\233RJ\342\223\361?a\377\365\304\377@\260\237\360ao=}=\205\007\243\343&\222\257\357<~\3110\334l<\272fR\370\306\033\263\224\360f?\001\221\331Gx\t\016\206\233q\f(\302\0179\221r&\205\004\274\334X\202:nrA\236\034uI!<\027n\016\240\323\242{\020\201\001\250\201(\347\020cjh&(HJ\222\264\006a\005\204\020\t\235K\017\021"
+	.string	"\261S\f\025\221&\251\221\366\r\3230\034\344\3564*)d\016\301r\237\275\204X\251\334\"\004'\243v>[r\341>\027OU\016\023\030vS\311\255\311\036\017\227\347\177O\350\340+\3722\\\365\f\312W\240&;\253\375V|\037\030\215\244\205#\204\303%\202\220{3tc\357\330\337\n\330\007\306\240vv\365\352\254\326z\033\242+\371\024\325y\330k\343\346\372=\255\t\366\226g\\\242\177\206\213D[FhP\024\202\313\205\210{\0166\261M\334Y\242%\002\343L8\237g\035\342s\217q\237\347W\006\020\217\361\252\020\250d\366h\362\310\314\224\351\350N5\230\007\232\220\221\b\024\021\210+\2523s\227\345\266I\2424\243\"\322\037\217\205\277H\0249S\n\270\242Rl"
+	.ascii	"\317(\312h\226E\361\215X\340;\002\3760\242\001E\261i\227\236"
+	.ascii	"i\244\036pt\335\327\036_\322\265\274Q \272\332\235\331\312\374"
+	.ascii	"\331\024\262\223\266\252\254Ig\217\270K\267`\207K\360\247\324"
+	.ascii	"\001X\371\232g\363\016H\267\017p\2564\274i\217=\374\303\036\327"
+	.ascii	"@\201\340\334[2\300\001\324\3108i\327\323\361\013\261\3222\001"
+	.ascii	"x\265\264hz \267a\203\263]\357L\377\265\031\323(\006U\200\334"
+	.ascii	"7\307>\247.N\316\367\210\241\301YM\202\345\221\350\222\210\361"
+	.ascii	"\332\211s\331\n\342g?\207\355 L\211\332\356\022\365)\313$\365"
+	.ascii	"r\217\235\207\272\307OR\302O\351\246B\036s!\277\244E\021\324"
+	.ascii	"DD\327\256\243Cs\300\017\n\375\223\355\261F\205\024o\324\376"
+	.ascii	"\203\305j\224\334\274\371\370X\246\350\2410\266\004\016\255y"
+	.ascii	"2\023Q\211$\3209R\344vZ\271\267Wj\361\301\312\220\024\002\273"
+	.ascii	"GWG\254\367F\375\267p\312\377q\200\272HZ\324(\034*\004\376&O"
+	.ascii	"\212\241\351;\231\342(j"
+	.text
+	.section	.gnu.lto_imuGetEarthAcceleration.92.109b7fc9bc88658c,"e",@progbits
+	.string	"(\265/\375`\373\002E\026"
+	.string	"\346\351\216J\320\322(\035R\303oI\375\363gN\214\326T\324\006\207\340_\004\204\004\312\254\270\314\363\036:)t\033\226\234\f\350\377|\323,\243p\033\345\300\232\240\302SF\017\235\205o\207\224\036f\232\233E\033\250]\230{N\b\331D\356\224\002x"
+	.string	"r"
+	.string	"x"
+	.string	"\252S\237\220\247#\341\234\366y\216B\366\036\377\216\252u\267\202E\255e\211I\310S\227' \236\222O\211\247\n\026\310,\363\362&w\021\271[\257G\255\345jCx\037\226w8e.\322p\307)\343\217(a\221\017\t\247\233]\334p\032\006\300\020\236"
+	.ascii	"\325f\b\200D\315\227\254\371\030\242\263\205#\265\326\363>it"
+	.ascii	"\2679G\224Z\253'N\247\341&o;g\333\201\275\b\0028_\350>\n~\316"
+	.ascii	"\251Y^\363\270S\377e\341e\036\347Id\"ifgv9\233kc\177\326Zg\336"
+	.ascii	"\235S\250\367\374!\367\271O\357\335c8-\316iJ\247C:\275\341\364"
+	.ascii	"\f\247?@\300\021\r\bA\265\346\202@j\022%\032\361\336\357\363"
+	.ascii	"i\337\376\217\017\324\263\221O\310\003\003\362\364\266\314\347"
+	.ascii	"\331\344\227O!\273O\f9\313@\006\341\350\240Tk\r9\276\177\342"
+	.ascii	"\351\326\300\361\230\373\025cl\310\322\275M'\274e\210\273\341"
+	.ascii	"\336V\2426\203\036ww\352\270\0059\355\\\261gS\242\315\240\313"
+	.ascii	"]\030H\326Z\033\370-N\304j\245\244\210\247\337\003]U\363\363"
+	.ascii	"AD\233\301\335]\033\377\257\265\326qw\216\021O+\262\333\301\313"
+	.ascii	"13\177\330\037\372\317F~\216U\\\344\"\361\364\264\2734t\202\003"
+	.ascii	"m\006m\232\377\271\212\027Y+\355\001/\256\013\2540\326\002\363"
+	.ascii	"j\321\225\030\214\365\240\325b\221n\231\300\260\270V\261\025"
+	.ascii	"\025W\205\t\253\026\027\213e\325\202\275\254LD\374rI\201\255"
+	.ascii	"b\257\027le*\353w\227\332\021\332\326|\340O\233\332\b>\244\033"
+	.ascii	"O-\tI\202\221\250\372\214\363N\262+\332Y:]\033\233p\026\265\024"
+	.ascii	"gT}\\\232\222\217;A\334\345\354a\350\004\037\027\265\327\021"
+	.ascii	"\262a\373P\003\036\200a\240\201\233\243q\t\270\323C\\\377E\314"
+	.ascii	"\300\0027\002< \220\002\231\2612\017\302\200\265\316\200)\260"
+	.ascii	"\344d\260plZ\326L\220)o\267 \002sQ\026\360\343^\013\332\335f"
+	.ascii	"k\b+\023\355\232c/\267\256V\260G\326\305\034\210\027!\032\027"
+	.ascii	"\035\026#!\331\244]\305\260\030\264D\246\003\3771A\f\340\200"
+	.ascii	"\321T\244\225\t\t\330\372A\007\236\252\334\005\250\201\026\225"
+	.ascii	"\353\r\023\251u\332\347\n.\313\364\203\360\337+xT2\r\027\034"
+	.ascii	"\"\276\231\304q\036J{\223\335l44=\016\311\326\2322"
+	.text
+	.section	.gnu.lto_imuGetQuaternion.93.109b7fc9bc88658c,"e",@progbits
+	.string	"(\265/\375`\204"
+	.string	"\255\t"
+	.string	"&\022B90\221\322\001\200Bg\n\266\026\313\366\265\035\357\322\034\224,p.\324\3212hp\264\037\333\214\251\366F\304\2602\252\352\203\013\006.\202;\257T\210B\2001;id\223\275S\n."
+	.string	"0"
+	.string	"2"
+	.string	"\002\332\347vN\3734h\333\274\216\354]Z\032,7\273K\245\310\301G\320?\312\001B\025\352\261\223\260\273\216\241\212\343\226\267M`\373\300\276A\250(C\354g\273\273\226+\373\255_j\234\307\214Blw#\226\263\260\031C\342\261\375h\337\344'\340[\247\007\354\256^0\273\025\301\005\333\247\353\003'W\305\027kX\376I\373\224%48 \251\030s'\276~\305\264\355\246\036\372)W\031\371\254O\227L\361\341\247o\262\270\210\017\035eT\260\f\211\262k$P\211\"s\350S\362:Jzp\350\"\032\250D\007\362hH4\242\237\001\177\023\f\"J\372>\021\365\324}\266r\345\205\017XJb\274\274 \270\216\273\336\362\371,{\001\021"
+	.ascii	"2\2419\034\030\027\f\214\003\203\275\300\006\306\310h\255\fx"
+	.ascii	"z\3157U\263\035\017\r\024 \271X\333\254\246\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_imuGetRotationMatrix.94.109b7fc9bc88658c,"e",@progbits
+	.string	"(\265/\375`\262"
+	.string	"\275\n"
+	.string	"\226SH@0\3058\035\200\213\027\360T`\317:\205_\304\275\243$\216SI\225If\263\007\341"
+	.string	"`j\325\b\324\250\241\007t\236\025\217e\f\2425b\270\031\"\023Z\320\270k\201\264V\n\365\204\270\355\336)\0051"
+	.string	"5"
+	.string	"7"
+	.string	"\257\366U\354\315\253\033\264W\207\366\201\223\254\375+\200\207\013\301\356nT\344\341g\350\337\345\233Q%~j\"v\327sT\201\334\364\266\027lC\330\227\bT\264Iq\322\020\373\231\245+\373\344O\263\016\212\201\211\330\356G,\301\226u"
+	.string	"\t\307\366\247\277r\226\267\204'5n\260\273z\301vI\007?\220?\310^\265w\262.\220\275u"
+	.string	"\"\004\326\3531\241N$\312^)\265G^\307\244\354\240\2425\363\255\303\240\264\335\324G\377\345.\223?\362\352\023j~|\365Q\030\031\363\243'\201\222\222#$\257\003?\240\367i\034\250dR\b}\037\315\234\3474\3526\320\"\324]Tl\244\3563\332\270\317\264y\022\354\225@\337\006z\336\267q\310}f\351\212\"\245L\321\r\230"
+	.string	"\356\244`2<\025"
+	.ascii	"3\241\237(\260\t\275\005\306\201\301p`\003\226A\nvh\n8\0020\326"
+	.ascii	"*\221\260Z\231\207\006\\\030\273\030C\227]\"a\262>\003\203\273"
+	.ascii	"\274h'\031"
+	.text
+	.section	.gnu.lto_imuUpdateEulerAngles.100.109b7fc9bc88658c,"e",@progbits
+	.string	"(\265/\375`J\013=1"
+	.string	"JW4\022@P\350\315p\334\213F\252\346n2\252H\016y\254\361\025\233H\365\203\\\n\363\n\r\230\200\266{\370\255vC\330T\227\002B@#\260\3153\247\317\013\302Y\262\227\237/\226\030\b\t\331{\357$\245\f\372"
+	.string	""
+	.string	"\001\033\001\357}\360^\007fo\203\262\367\352\275V\357e\360\336\005\357\255z\257\002\263\227\252\354\235zo\202\367J\2757\352\275Pf/\202\262\367\351\275N\357mz/\323{\227\336{\340\275\301\367\032xo\001\263\227@\331;\340\275\002\336\253\364\336"
+	.ascii	"\357\005\360^\240\331\233T\366\376\336\353{/\372\336\363\275"
+	.ascii	"\346{\313\367\376\275\335\275lBj\221\236\035y\252*$\222#5\217"
+	.ascii	"y\207ewy9\f\323\361`0{b\232/\252\252\002\331\334\345\261\013"
+	.ascii	"d\223\201\233\356\n\342\2727\025\305\362\203h\267HUU\341\335"
+	.ascii	"8\345\244\237\017=\315\362\235.\243\030~E\2664N\242\372\241\030"
+	.ascii	"\234\020Q\302\276=C\222P\035\207\2645\212\204\317\222\201\236"
+	.ascii	"'\201\224\330\210\345\223\021\317\310\332\346\021.\223\330\216"
+	.ascii	"\360\225\330\326\312)UUy\216\373\007\333\260\033\305\240\252"
+	.ascii	"\352v\221\215\b/\220w\327mw\255v\2016\002\207k$v\263\037\316"
+	.ascii	"\220\330\313~8@a'\361\303\361Y\217\303\260\217\370\341\352\254"
+	.ascii	"\307a\330\311~87\353q\354`\027q\202\331 \307\222b\007{\210\024"
+	.ascii	"\254&\215\030\236\\\330\301\016\342\367\263\036\207*\030\315"
+	.ascii	"\231\260\263\021%q\222tL\267,\330\314\"}\252\252r-\333q\231\026"
+	.ascii	"\313U\330\334\027gg'\233`g:\276J\203\363\305\030\206\256UUM\373"
+	.ascii	"^\235\033\316s\354\333C\346\317Z3\332\255\343\253\223\277\341"
+	.ascii	"\333\304\266aG\332\345:\036\023c\271\312\316@k.\262\271"
+	.string	"\214v\262\311G\335\314$\333\324:\322n\335\220KUU\325~\224].UUU\367Pv\337[\342\275f\357-{/\211\367\216x/\331{E\274w\354\275!\336+\366^\020\357\r{/X\367n@{-\240\275^ho\027\332\313\365\336\n\357\245`\366N8{%\234\275\021\314\336-\263WX\366j\2757\353\275X\357\205\020{\t\246\202RO\360C=J*\213\027)J\343\272\022E\375wwh\221Wo\203\330P\032\307v^\204\270P\252%\345\222zi.\246^N6\233\027\316\311&\324\177yH\271\273\022\201\034\013\332\013\364t\004\277\037\247\247`\323\235\3767\025R\013~\211\351\300\227\216#.\342\007\356d\267\032\r\004_>*p\003\207\332[\217%^\366\002G\337$\363V#\2019\356\303g\317\200\023\370\021\t\030\020\024\360\322n=\0068CL\224G\351Nj\326,T\r\340\273\251\230\f\315\305"
+	.ascii	"\237Z\003\036\300\235\354\254G\022\017q\340\321-I<k\226\244\357"
+	.ascii	"j\340:_Lz\313\201\351t\b\276\311\3419\036>\204\205\235lr\261"
+	.ascii	"\320\357I\377\036\021\022S\373\276;Fvr\361\367\2515!F7A\364\276"
+	.ascii	"\377Q\260\313\237\33753\321\\D?\325\343i\346\317\243\331A\334"
+	.ascii	"|\323\243\325\370w\371\022\321\232e"
+	.string	"\221\274\345\232\252\252U\365\177(?\353\261\354d\357\363\034\227a\220\250\031\346\2251\216\275\304\003\313BK\307\2143a\016\030/\316d\270\020\3228S1C\310\342\006\016\241V\323\242\325hqC\230\003\r\355\206\020X\247\306\245z((\222y\324>L\262\320\205\025q:\345\364\272\2053\261M\213\327Q;I~]\217\363q\324\311\365\2563\321\310\266\225\276\222N\201K\255X9\331\344\272\031\007O\256\315\367([\341\024\276\202\314\235\246\322p\213L\261\354\232\346\342\2569\331\254\360\245)m\375\266\310\340\233[\032\247\324R(\334$\306I\336\241\023\016\345\013\352\255\237t\b\352\265\023\t\237p&B\202\032\3028\316\b\227\360\357\255\306\255Gx\rFyDH\334\006\221\236&\347\327\271\365\025d\360\326\232\321\032\277\240\336\232I\207\240^/\331:J\204\223\2443\205\255\244\223t\233\326\205YZX\317\202p,\007\177"
+	.ascii	"\241HV\023I\343.\260=\370"
+	.string	"\357N\310\"\257\364\202\244q\\\006\210\203\377\024\275\221\273k\320?\272\330>\256\336\300\352\312j\001\203\252\005\n^u';+V\017\027\311x\364Z-\215\343;o\235\246\340]\212\220\311;\265H\220\036M\235\352\017\200\331\250\201<\006\221R52\222\202\244 \205\346\320\002\021!\242q\003\021 \2552N\231\"ZR\244\326#\360r\371\\u\007h\002G6<\336\234b]\t\fO\204\221\244\357\342\006$\370O\307\200[\270i7\366\275/J\357\255\017\223\032Q\317$.\317\226\275%\343<\346\005n'\365I\237\334\237\214%\212q\220\204\220\267>\230\257\267b\260b\334y\3514\346R4<\213H\027\363\213z\224r\213\357R0\244P'\227\003\242\201~\363\321\376\372\350\016\340\354]\345\377+\351\216\241\314\353\334\376<\"#\272C\305\201\211\262\032\213\004\242\033L\366\275\212\346\036\230\raD\313\030\317\270\022\373"
+	.string	"xO0\224\215\302\372\n\211fz\306A\203\334\034\261\037@s9\002O\";+\"\215\\N\344x\020?\245$\n\251,C\370\017\023b\241\207\303y\2639,6\\#Op\221#\331\240\016\032\237\377d\2042#\326\013x(\313\r\031\b\266#h\224\230H\232\200\267Oh\007\260I^\202;\243n\241\341TW\0048l\27238\204F\311\276\212\r\214\017\332\313\344\254\246\201E\177\3375\021Nk\204\316\233\351\021+\346p\250\030\200\001\013\260\307)C]lI4\352\007r\302U"
+	.string	"\026x\361\255\340\r\243iX:\030\0161{lVR\214\273~\277\022o<"
+	.ascii	"\332\261L\351\202\311c\325\205t\374\253\341\250\257\003\033\340"
+	.ascii	"\363\371\223\241z=\271{\3447*qC\177\007\fXq;\226\032"
+	.text
+	.section	.gnu.lto_imuCalculateEstimatedAttitude.102.109b7fc9bc88658c,"e",@progbits
+	.string	"(\265/\375`\341\001}\021"
+	.string	"&\341tG\360\320&\035\333/\017\023Z\\7\031\264R\345\201\231\303\310\177\375\324\216\033\020\020\336\240\252\34014=\327\036}}\216`\253\266\310u\350:[\315OJ6\221\361\021\037\212\030\2035\003\362d6_[\263d\357-eJ\001_"
+	.string	"Z"
+	.string	"`"
+	.string	"s\212\030\002\232\363K`\003\244G\324?\344#\374"
+	.ascii	"\371h\230\215\343_\315\334lf\270\260\3101\347\344\266\004La\227"
+	.ascii	"\021\256\302\374w^\354\322\344\201xl9y\033\024\242\346\234'\257"
+	.ascii	"E\027\036 \212A\363\360f\360\343\005Ew\236+\007O\246\2725\230"
+	.ascii	"sZ;\357\303\275\335\366\3126\003[\025\004\361;\242\342FF\007"
+	.ascii	"\206Ek\366'\323\035a\177k\265Z\315Kc\377\273M\337\371KR\275I"
+	.ascii	"u\214j\030\325\013\325\n\325\027\360\237!\231\030\033\032k\343"
+	.ascii	"\233/5\035S(\312\260\371\367U\265\177\036\237l\177\032P\263o"
+	.ascii	"z#GB9\b\036\275\200t\265\237s\035\330wV\\\n\021$\244R\3621n)"
+	.ascii	"\346C\263&V\264\b\202wq\270\247y\250\255*\321wp\357\315\3106"
+	.ascii	"\366\327\030\021\001\255U\344\356\204\236\03335\362II\277 mV"
+	.ascii	"K\337\355\252j_\021\321lc.\355\317\206C+\212\3215\255\356p9\372"
+	.ascii	"\226V\367-7\262\367\334g\305?\341\f(\372\356\321G\221\017\"\251"
+	.ascii	"\227\211\212\202Lq\240b\255D^'*\227K\205\004\200IBTX+\356e\241"
+	.ascii	"deR\201;Y\245X\034\211+\205\013)\340\026\006\225\213{\265Z.\356"
+	.ascii	"\364\261\034\316\245!\325\300\021bY\231\t\250i\355\007\020\364"
+	.ascii	"'\204\0078\347\234\362\244(?hf\2661\355\320\245\240E\020\271"
+	.ascii	"\355y^\"\021\340 2\356\266V\027\230\027\207\021& \220\002!\301"
+	.ascii	":\007CC\353H`\026\267T-\215\031P\224Vw\360^\316\246\023\320\247"
+	.ascii	"b$\207\024\260\320\031\203\f\350\026\2621\237P\300H\013\321\002"
+	.ascii	"\343\r\256-\326\327\370\334P\r\330\177\3541\334w\237\223o\216"
+	.ascii	"\002w\256\004l\304\026x|\037)\316\233\356I\310\n(\024"
+	.text
+	.section	.gnu.lto_imuUpdateAttitude.103.109b7fc9bc88658c,"e",@progbits
+	.string	"(\265/\375`\272\001\005\017"
+	.string	"\306\033cE\360\262&\035\222\334\037\261Y\267^\211<\370\303\217=.1\272u\331\372\350\350\232\017\347~\t/\351W\243F\202\nx7\3613\\\347\270\311\024\036\343aqAa\311Pb\321&6\235\227\013~\2176\273\367\3362\245O"
+	.string	"J"
+	.string	"O"
+	.string	"\0270/}\262s\274\245\332\221\02242\324\300v7\203 ~\372\224\021\352\311\367\234\200x_\367\t\340\203\271\374\300<\306\003:^\354\204^Fx\240/\245P\344\303\020Iv\367\254\253\206\317E\325s\262\273V\357\343p{n[\263\235\300\326\001\001z\323\264+X\320{\207_\241\303z\245`g\267:\205\037\354\307\335]\303\030\373\253_\252ZU}P"
+	.ascii	"\026\216\357\033v\354\276\304z\354K\302 \001\262}\265o\3423\247"
+	.ascii	"\257.\030d\327\203\315\315n\253\304\006>\227$\017\315\313\030"
+	.ascii	"\232\210\352\322\306A\007\0370\030Jc\206!hT\314\220!*\241\235"
+	.ascii	"\262\351=G\330\331832\252x\232+\374\216-\341)Z>\273\253\300G"
+	.ascii	"\361\232\221/\342\322\244\025\351\257\314K\205\005l\254P\032"
+	.ascii	"\273\356n\007\3352\017\037\234\270\221R\036\236\032,\rD\243\215"
+	.ascii	"AIE\304q&-\304\232\211i\264e\245\b)\333\004\b\231\312\2062\312"
+	.ascii	"4\216%3\0311\211\202\210\313J$\022\227\201Z\373\2700\306\037"
+	.ascii	"\235\330\013\005]\346c\\F\016\216\3369\023V\362\033\227\213\037"
+	.ascii	"2.\333J\3006\202\267\260+Tcw\027\330(g\021$ \320\202\0311\333"
+	.ascii	"\006\002Co\311\300l\340;Y\016Zk\023\r\202;;\030\202|\005Q7\270"
+	.ascii	"\373`\240\206\240\311\251\321\n\304\251\234X\321.K(\313&'3\374"
+	.ascii	"\001\0260\037\302\342\341\335\246l\260\3045EpI\003\177\357\253"
+	.ascii	"gdA\310\355\312z"
+	.text
+	.section	.gnu.lto_imuIntegrateGyro.104.109b7fc9bc88658c,"e",@progbits
+	.string	"(\265/\375` "
+	.string	"\225\007"
+	.string	"\362N55`o\032\003\024\222\r\216\023\242\222\232c\3643\205\340e\026\013\356\277U\325\266Y=lc\254\206.6\204\2040\204\206\004\252|\033\006\360\342\241\305\332&\267\224)\005\232\302\013i\237\004,\213\030Y\005y H\227\324\026F\027\203H6\\\037\222\004e\017\322\263)\346\020\312\244\206a\231\324\314\273:\354\312\231\200\024\355,=\210\321\272\372\377\302\256}\242\024\324\211\363\305\313\217zq\271J<\331hkM\3337\035\262Y\244&\315\374(+\251\377\235\032X\216\234\312\257u\207=6\177H8\340\357JR\377\354\264\300r\354\364"
+	.string	"\306\321\262"
+	.string	"\306\261[\313\342\251\361\r\307\251\202\244\345\277\204\031\336\374\266\332#\316\230\270\222\037"
+	.string	"\302\377>\023g\341B\267%h{\320\026$\n"
+	.ascii	"2\241\207/0.\234\273\306\033\303\350@\fpE\232\232\002\356\362"
+	.ascii	"\242\235d"
+	.text
+	.section	.gnu.lto_getCosTiltAngle.105.109b7fc9bc88658c,"e",@progbits
+	.string	"(\265/\375`\034"
+	.string	"\245\007"
+	.string	"\262M36Po\322\001 \233V\017\"i\324Z\r\023\021\2505\026\\\374\330\r\350\217P\330\232\344\263g3C'\204\23453G\030e\036Z\351\032\265\246\013\246\f\262\267\224)\005\346l>\235+z\036\034.\210\206\030q-t\"'\233\210\233\002c\022\fY\364`X\026\255n\377VI\251\032\221Z\330\304\247\214\313\310K>\004\245\335E\350NB\341\233\016]\001\312o\207>\350N\251\016S\003P\242L\331](u\303\376[%\331O\247\n\274`p\037\251\354f\244b\226\005\242:lk\266\345\203<D\263O\257+\231\f<>.P`v7j\236\251\016\337\007\252C\345\270\366\324\374\213\\\241e\264\262q\241'@\302\356:7N\343\326\037\330>\t\016"
+	.ascii	"2\241\221\037\030b\202\2219\032\023A\305\201\330\fV%,\327p\341"
+	.ascii	"\020#fl\342\256H\263\341]\367\006"
+	.text
+	.section	.gnu.lto_calculateThrottleAngleCorrection.106.109b7fc9bc88658c,"e",@progbits
+	.string	"(\265/\375`H\002\005\024"
+	.string	"\306f\205H\320\322(\035\322N\313\315EU4Q\271\216\024\234\005\002\016u\245\243\021\320+\343\244\016\352\001\016\341\005T\372\266\277o\334a'\030</\373\372\003\220\253\031l\216k\020;\347\244\316Qj\251m<a\365\345\276%{K\231Rq"
+	.string	"c"
+	.string	"t"
+	.string	"\032d\354\264H\232s\"\270\264\203\323\345I\374*\\\265\025,\260\375\207\301;'\b\034Es\002\023\330\300\351\322\266\337s\0246\337\016d\310\341\n\354\374b\200z\3149[$g\205\227\372Ux\271$~{\\\275\371\270G\223\256\006F\317G\363\215\003lB,\251|\272x\342\002)\346?W\031\337N\325\2242\347\264\366|3\267\274m\b\266\037\330\232\023\275K\377\305G\341\345\367?\217E\036h,\031\3454h\003q\2727\366\343\\\033\333j\326\177\377\352>w\211\325*\251\036\211\352TT\243\242Z$\252C\242\372\264j\223T\207Q-\243:F\365\256Z\243\372"
+	.string	"R<6\370\376!8'\207\340\217\211$\215r\356\363\3336\377\307(\003\237\302v\037\037}\316\314\007\246]\311\352\206\272\032\"\236\222N\203\016\267d/\024\023\204D\345\332\256W\370^\270'qw\345\236\247\243\273\320\207L\344\343\030\346!}\317Ckr\243CJ\277v\214\202\276\267\273\300\032&\220v\213\273\017\021\301\240\335\033\023}G\214\021H\323\r\202A\245\335\2349\002_\t?/v\352\303,LdR\002\350A-*\033sN\006*\276b\346\343\\\332\302\213>0\331\212\213K\302`d\256\013*.\263X\355\005\243\321f/\025\230\254V\233\321Xj\002\374B\201i\211\265j,+1\331\204\226K\314\325\322z\321^Z(\001<\253"
+	.string	"\243\265j\263\031\255\205\002\316\257\215U\274\236\337\262N\303\343\321\241\376-T\255\214m\325:%\267\2728\262\254}j\004\265\247M\355g\360tt\"kG@\361\234P\2329BVD7d%\020^\322\236\366\274\244\325\2326* @\002B\024\273\363M\004,;\350\246B7v\257\003\233\372\030\347O\214\243\177\253\357\305<\210E \367N\337\306\371\3079R\"\004IH"
+	.string	"\303\301\306\211\2460T\202@v\307\312\021x\251 1\017&@\307\251\361yE\220\315\307\302\026\027\210\025l\201\275\315\034\026C\024\307xl\035\234+l\244"
+	.ascii	"\n3W.\317e\366"
+	.text
+	.section	.gnu.lto_imuSetAttitudeRPY.107.109b7fc9bc88658c,"e",@progbits
+	.string	"(\265/\375`\366\001\235\016"
+	.string	"\366Z_E"
+	.string	"\2216\035\333z\177\323\035\264\361\3767\026\003\200hu\244\"\322\242\246\032\323=\202\367\317\267\360s5\206}3\002\0043\036h`\006\213\b\261\177UUU\002\024\375\003\374\034Y\275\303!Kl\201\030m\"eJ\001G"
+	.string	"F"
+	.string	"O"
+	.string	"\330\243\237\366G\234\204\350'\3238\333\2759\265\330]\006N\200=\"\270\201\353\321z\201\353\321\"\033\307C\230\r\021\201\302pb\307\356n\352\341\242\247\310\177\211g`i\364\004"
+	.string	"aw\235`\311\345\326\333\026\261\355\300N\227\241<\030JQ\311\203V\240\262I\261\350\310\016G\251\035\354[\273\273\326\027\3731\377\307\303_\373\351\3172}=\0353m=\255\231\316\247O @\217\f\245\233dv5\254xl*\326\200\260}\315\216\311i\020\312X\020ZCSU\020\034\223*\325\356\234\005w"
+	.string	"\306&\371L\211\200\033\273\373@\305Wt\025<\357z<\250\343\232\252/Zl\220re\323|\2031\226]\222H\246W\020\016&TK\210\225\\\031\313\233x\212\020\266K:\350\243\270\314\005\377\303\243Q\002)\035\0255\341@\335I\364x\276\217en$\344u\033\310\244\244\363P\330,t\035o\343>(\333H\210\277\023\222\317\006\372\276\317\246\205{k\365\305\230*G\212\244+4fD@]jK\370M\f\030Q/\325\231\017\215:"
+	.ascii	"\307\224c\251=\34165.T-\r' \360\002\242Qm\0032B[J`\nl\2602\244"
+	.ascii	"\f\003\366 \331\232\266\304\314!~\205\345\2611\216\007\237s\273"
+	.ascii	"(\265\274\005\242\273%c\311\006\366,\215\337\026\030\230\321"
+	.ascii	"\032h\275X,\005h\334\021kc27\263\203\220\367\034sP\324 -/\204"
+	.ascii	"A\006"
+	.text
+	.section	.gnu.lto_imuSetAttitudeQuat.108.109b7fc9bc88658c,"e",@progbits
+	.string	"(\265/\375`\234\0015\r"
+	.string	"vWUA\360R5\035\262\242\007\363\234\374pV\320\310h\374\355\374\277\232R2\312\351gh\330\247:\376\341\231\267\r\"\232:PS\002(\341\316\303\312&\262\031N\232\f\023\346\360lg\315\362\340\022\tv\334;\245?"
+	.string	"@"
+	.string	"C"
+	.string	"+\303\314\355\212\260\210\355\256\305\007\266\327\002'0y\225|\300\344\325\241\315\343dj+)d\033\\>v\267\243&\036~\206\376]\347F\223\370\2519\330]\317\321\324\341\246\267m\300\366\305\236\r\002:z\224%*\332\2448i\t\373\222\335]S\224\375\326\317\235\365k'\377\372\325O\003"
+	.string	" \3612}D\310.\207\031\220-+\r\024\266O\261[?,\254\035\nH\221\004\333\253?\355\253\370\212\360\001*\215\332\232\333\250!\253\324\336|Fl\246\242\324\366.\3030\232\332]\006\376\3531*p\276o\362\272"
+	.ascii	"D\020Y\210\321\234Y\233oq\030\340\266;\372\350\273\370\013\217"
+	.ascii	"\177\342\325 p~\004C\242\371\321\b\002\032\036z\206\203w\346"
+	.ascii	"\002\342x\335g\302\306\263 \241\273\340a8]\246\343\351.\025\177"
+	.ascii	"\0304\235\356\363}\235\216B\356)\312\333\210\210rDI9p\370\201"
+	.ascii	"\350T\226 `(|\0200\355\b\230\021\017%\211\212\346\250\235y\310"
+	.ascii	"\215S+&  \203\021b\3502\001[\345\f\0066\030\030\342`\217\266"
+	.ascii	"At\314\357\302%)\326/\315\335=\266\226;\223\021\026\034\273l"
+	.ascii	"m8\335Xb<\211,\277\2328nm\251\213\341\304\230\346fv\020\3628"
+	.ascii	"\206\ty\350\230\003\242\206\267\274\020\030\031"
+	.text
+	.section	.gnu.lto_imuQuaternionComputeProducts.109.109b7fc9bc88658c,"e",@progbits
+	.string	"(\265/\375`\370\002\005\020"
+	.string	"F\336eC"
+	.string	"\2234\034\030[e\025\215\n3YHt\006\220\255\021V\034\210=\232\254!~\235]\303s\303E\024(\"\204\025f\220\300,\002\013\376\013("
+	.string	"P\200\026\243\263\210V\222\372\336\027\331Z\333d\357\235dJ\001R"
+	.string	"J"
+	.string	"T"
+	.string	"\255Am\361K!\211d\006\231\020\006\214\255SX\205\3132\025\217d\272\324\314\310\374\016\264@\347\255\237\005p\336:\007\340\274\325\325\376\360G\"I(^6\264\020\222\231\336G\330et\325^a\017,\266b\354(\310\314\",\346\301\275\333\022h\213\240=\210\335\213\n\347\315?i\231\305\310X0\247\375V\360\"Zk\231\231\275K\353\317\036\261\314\0269vt\254\350\330\320\261\240c?\307z\216\355\216\355\034\313\035\273\035\253\035\373c\361X\017\020\301p\210\271\304Mf\207\234!i\263\3258\3215\236\267&\323\374\236\003x\231\230uoKl\243s\27731\215\016\016\367\366\344\231\355>W\3012\266\0341\332[\224c\374\276\2262\214\337\037Zf82|\253\362\013\027\016PF=R8oH\003\003\342\373\370\357\320"
+	.string	"\363j\313,:\323ef\202Z\006\002\206\022R\253\005\254RK\325\261J-\225V\023I\013u\362X\024LN\026&x\027N%\224gZ\241x$\244\246NJV\036+\225Zy\240/\255\345]\332\371\210\331\260\374\325\321[\006\256\351|\224#z\333\300:\266\213\202\204\336>0\216\355\241\033\320\333\b\276\361\203x|\336\226<\373?\0011 \360\002\0219\326\001\002CwJ\201\241`}\364\b\367`\364\020n\006\263\356\031n\007\363\271\207p/\007#\334\263p\357\006S&\215\003\031\fW\213'=\302^\333\325\304\223n\206%\230v\t\262"
+	.ascii	"\267\2761\300\023o3\223\2535\276\370&\374\346\330\377\342Z\355"
+	.ascii	"\020P\347\210\226\241\025\346\260\200\021\032\304\345E\013\311"
+	.text
+	.section	.gnu.lto_imuQuaternionHeadfreeOffsetSet.110.109b7fc9bc88658c,"e",@progbits
+	.string	"(\265/\375`\206\001]\017"
+	.string	"v]hE\360\320h8\222\346n[\236\242x#\256xd\376\267\234\242\33050\306\214\371\341&\223\3544\267\242I\tc\233!e\226\001\253\246\275\313\355u\221\032\211\303\210\366'\202O\213\3611\"\227\242\250\276\266\335{K\231RW"
+	.string	"N"
+	.string	"X"
+	.string	" ']\200\367.m\225=\262\202\005*\257.\302\304\006\314p4\324\344\330\025A\r\361\325;Ns\345{\204\254w\237\207s\\\b\320\r\007)&\0026\n_\251\034\311\007\204\r"
+	.ascii	"!\013\027\342\362\242\303e\236-\241+S4\262\273NX\310\341\366"
+	.ascii	"n\333\201m\004\366u"
+	.string	"\004\026Y\2512\373:\216\343h}\261o\273?\247E\257\335\236\323\234\246S\323\3670\331\211m\b\037\323\263\033\033\2076F\307b\304m\177\355i\237\306@\013d_,=;~\t_\374\314i\252\327R_\330\336uc\226\003\264\273\t\336\371\300\367.\332@\307\3449)\265Iq\222;p>=\315\003\374\324x\336\202|>\250\312\254\266c\360\256\227\371'\303\004\214W\n\331\323k\201\240\fB6\375&\365\0260\366\3516'\327\241\261\273\fN\274\006\305\217yg\225\225<\354\235\277\342\275\363\364\342\301\233\013\022.3\264V\216\016\027\036\244IDTL%0eBI\211\202\004\260B\t\202\t$A\241\200\"\004|\262\020\001\005\246\234N(p$\356\365\305\231W\361\241\031\317\315\n\365W\2369\221r\332b\233S\217\264\324enw\267\373H\273\244\224\207\211T\225e\377\330xfp*C\361|\214\366i\006\035"
+	.ascii	"b\b\270\352\034\206&\034D\261\260\253m\330(\265\343\336\020\034"
+	.ascii	"\030\020\020\bJ\202\301\334 \021X\334a\371\370\032H\220\030f"
+	.ascii	"|\331\f\345p\031\001\006vT\217Ie\b\254\222\244\030\005\256\221"
+	.ascii	"\257\304\253jdV0\367"
+	.text
+	.section	.gnu.lto_imuQuaternionMultiplication.111.109b7fc9bc88658c,"e",@progbits
+	.string	"(\265/\375`\324\006\235\036"
+	.string	"\246\271\276E\240\330Jc\300\365\203y\037\320N\336\270.\340\352\021\001\331'\256\320\021\235\2400)\307\215\225\245\335X\252\307\030\225p\004\213\035^\207\327\341\261\223\005\236\252Z\0211333\323\021Q-B\321 \214l\222dJ\001\263"
+	.string	"\214"
+	.string	"\257"
+	.string	"\037\342\266\314\"\342\033\232g\330l\266\r\033\207\255\303v\263\337\354\036\336\2656\r\327\360\r\347p\233w\230\207\341\312\353\341\344\300\333\223\002nP\b\350\210\""
+	.string	"\307\225"
+	.string	"6\260"
+	.ascii	"`\323\220\233l\026\246e\021f\355\034\3032\306<C\203'\210)\215"
+	.ascii	"\234\245i\2212\347|\262\330\253\235E\242\034\f1_\315\344\260"
+	.ascii	"\026\214\032vq\262l\355\302/\306\254&f\2339\317\206\270\3159"
+	.ascii	"\214\352\322\316b\207\326\321Y\334\031Gg\261c-\024\017OL_Z\223"
+	.ascii	"\0162\256\3149\1777\3411\313\261\332p\206"
+	.string	")3\333`\371R`\316YYf\006\302\275\333\036\265E\320\276<\bfs\263l\303\3052\016\367\312:\\+\273\271U~s\251\334\303\235\362\320\376Y\315\226\272,\324e\237.\353t\331\246\3132]v\351\262J\227M\272,\322e\217.kt\331\242\313\022]v\350\262B\227\r\272,\320e\177.\353s\331\236\313\372.\313s\331\235\313\352\\6\347\2628\227\275\271\254\315ek.\333\273,\315eg.+sY\336ec.\013s\331\335e_.\253\273\254x\331\334e\177YyY\017\2309\222\302\314*\210\314\031\347\271\226/\310Cd\347:\317\312}\307\327\3611\006s\216s\254\034\234\266Qxs\233_\305\\\374\315m\336\003\242\321\030\2035\357\335\252\246\0277\006i>\363*\232 p\346=\240\n+\243P\3460\247\342=\3462B\240\022\036\222\230\335_\016#\344\362\221]\227\213\274`\321\375\237\272\3141\256"
+	.ascii	"\312\270\212\317]w\221\312\220\021\342\261\202\214\310=J\336"
+	.ascii	"\377\237d\f\002\277\fD\036\tE\303\374\243m\2739gV\355c\214D\206"
+	.ascii	"]\n\213\265\230\316\242\217AD\225\026jd2\256\035npn\3169\345"
+	.ascii	"K\264\316\3159g\177\326\032\206\r\3003\\\255\006|\300\b\234\300"
+	.ascii	"\n\274\300\f\334\300`\025\302\276\"x\351\252\272$U\227,\004\251"
+	.ascii	"0\013[?0\n\023\266*H\370]\330r`\341\007\301\353\353'\345+\027"
+	.ascii	"\206\b^?0..\257\037o8\235\233?\333A\tQ\204\354\300B}\212\325"
+	.ascii	"\237\016\345\364\247\246;\005\233\336[cA\203\351Q\252\276t\246"
+	.ascii	"\240\322\227\222\256$Dz\022R\334(<\272\023\243O\375HXt#\242\027"
+	.ascii	"\r\235\350\352C\247YC\263\"t&\0362\314,1\227\262)T\017\272\320"
+	.ascii	"\245\2201\330\346\346\346$;\002z\320s\\\306\025Z\3779\320spc"
+	.ascii	"0\353>\377\371\251\214A\254\367\334\347\207\033\205W\3579o\r"
+	.ascii	"-\3128\305\027~\250Q`E\315I0RJJ\n\ni\016 \003\t\204\210\332\021"
+	.ascii	" \235\203\314\310\005TY\206\032c\343\371\023\3513\325\324F\340"
+	.ascii	"W\376C\315\233\343 \320q&x&\216\3446\2142P\"\326\316\031h$\310"
+	.ascii	"W\031 `\272\243\250 o\302Qbx\271\245\211\211\323\232[\247p\017"
+	.ascii	"\347\275 {X\265Fo\260\225\\~\177q\b\004COZ\260y\026\304\\\202"
+	.ascii	"\205L\312\206\264\t\362m\221\241\207EIz\f\251\205Y\322\365X\273"
+	.ascii	"j\335\232:N\357\024\245\352\300g\367h\305\274\202\365N\311h\016"
+	.ascii	"w\347%\t\035\337\264\001\031\f\207s\265/too%\222\245%\t0D\314"
+	.ascii	"\022\200!C\006\021\330\222\033\204\2242\305K\021!\025\353\357"
+	.ascii	"_\321r\001\314*\234\240\026\207\377\003"
+	.text
+	.section	.gnu.lto_imuQuaternionHeadfreeTransformVectorEarthToBody.112.109b7fc9bc88658c,"e",@progbits
+	.string	"(\265/\375`<\006\245 "
+	.string	"\026\277\317G\240VN:\220\033\340\330\257\343\207\234\023\343Xo\334s\252\177H\r\267\220\002\216\350\261\026&o\004\330\306\177\256\234f\030\013\371v\254\034\343\345x9N\216\017\265\230\310\362\r\035=\224\252\376\017%\035\3732k\311NR\246\274"
+	.string	"\250"
+	.string	"\304"
+	.ascii	"1r\r#\3278\271\276\311\265M\256E\271\226r}\271^\271\326\0022"
+	.ascii	"Q\310\300\364\305\2239A|\3512\327\304\037,"
+	.string	"\224\206\252\rU4\275\255V\034\232\303\316YK\323\034\023\246\343\305\2343\247e\347TT\255\241gz\3039\264\022I66\310\231\246A\027aA\0026\323\031[Jc\203N\021s\227\210\2710ae\316I@E\013\300\2518$um\205\2411\266T\006\207]\315\354P\003D\2179\315\222|\204S\321f\252cS\021\24786\025\275eSQ3\025s\347\342\203\2073-s\316\337S\350\226\356\226Uo(\314\027\030\227\356\315\300\234\323\373\005&B}\265\r\300\266\317\266)\t]\373\305\272\3254\025\022\244\352\207\217\b\232\246jX\2709\273\364\313\272CyXY\311T\364\025\326\352\227\212V,[\205\013\253_F\242rbm<\227m\346\265Ga\253\234\027\263\345zJ\256\245\344:J\256\241\344\372I\256\235\344\272I\256\231\344zI\256\225\344\372'\327>\271N\222\353\236\322P#\251\r\365\221\242\251\215T\206j"
+	.string	"\271.\222k\"\271\036\222k!\271\016\222k \271\376\221k\037\271\356\221k\236\\\357\344\232G\256w\344ZG\256s\344\032G\256o\344\332F\256k\344\232F\256g\344ZF\256ur\235\223\353\272\357\221\245C=w\001gc\020\346\342c\316\033\216@5\265\3540g\027"
+	.string	"\334a\256\243\360v\333q\007B\240Nn\327,Oo\272\355?g#P\376\027\277\2332\n\355\004\332\204\311V\013\00582\016W\035+\246\276\377ogQ\327\357\305\341\030tz\322\365zC\305\020a;\274\236\240\001\231>\365\217qQ\272\324?\206E\351Q\377\230\024\337\241\3761&\243\320\313\367\247\177\314\310(\364\362\335\351\037\003\302\364\336\233\026\350\2225\246-J\357}\211\201&A\242t\244\314\367\336\177Tj\244\210\357:\242\304\220-\275\367\236\364\017G\241\327~\261\346p\003%b5\334\234\023jHU\357\232C\217\270\204\274"
+	.ascii	"\306\220\021\031TK5(\0065\225\357\202U\325\317\002\204\007U\022"
+	.ascii	"\034\374&T1\260\372QeU\370\371v\276\242\320 \353g\341\352*\353"
+	.ascii	"\2273\353R9/f\034\025 k]\3672\322\261\004);\372\225-F\257r\025"
+	.ascii	"Naje$\212.t$\242\353^4\365\241\023\r]h8\006\203.t\035\205@\367"
+	.ascii	"y\320\317o\007\272\317\360w\251\377\234\347e\f\366\\\336\007"
+	.ascii	"\352K\357y2\002y\337\371\321\356\274+\317u\337}\300\224Q(\365"
+	.ascii	"\337y\200:\267\371\316oHr~\273\316\201p\236\363\237\233\343\274"
+	.ascii	"g8\002o\316;\033\2035\267\271\322\\\276\346\266\341(l\372\323"
+	.ascii	"i\216\303\244L\311\314cn\364\335!\363\031\335s\227\371\200\003"
+	.ascii	"\n%n\250Q<\245\f%\247\002TRP\222\2449\340\002\221)\352\006\021"
+	.ascii	"@1T\254\202\232\226U\315\001\002\324\235\334`m\206b\206\245B"
+	.ascii	"0\262\252J\266\336\322\223h\216\334\315L\210t_\245\3017\260~"
+	.ascii	"wx,\225R8^]`\254\204\327'<\204\254\003\221\317\277C\237\224\226"
+	.ascii	"\022\276\260t\276\275\357\236\211\260\355\013\027R\202{\b9\201"
+	.ascii	"+\306\240\237\331\007\213\306\336\255\243aI\022*\222\267\317"
+	.ascii	"\353\026\360K\314\367mYL\236\245G\222b`Pa\323\3413\370w\213`"
+	.ascii	"0\3613\220\036nC{\214\254\021\351t\254\fF\335-\036,4\025\026"
+	.ascii	"e\213\021h\270c\241\300\3766\004\306\202d\250'\305\002\266\034"
+	.ascii	"\211\t\177\035\234\n\r\362\326\342hy'*l\251\305\001\377"
+	.text
+	.section	.gnu.lto_imuUpdateAttitude.part.0.141.109b7fc9bc88658c,"e",@progbits
+	.string	"(\265/\375`\330"
+	.string	"]\013"
+	.string	"&TJB \3078\035`\020\361\216\200rq\001\350<\311.\276\303E`|!f\306"
+	.string	"\234\001\362\016\306\257\353\0302\375\341\002\2657\206\206\252\177\004\017\2101P\fI"
+	.string	"\300u\316\022L\237a\003\020\243\355\266wJ\0017"
+	.string	"2"
+	.string	"9"
+	.string	"\245\224G[\301\313\225\335\270$\030y5\330\335\356\225\252|<\235\332\350;\240f\244\312tz\327+RP\005H\025\311\247\302\265\003\212\335\365Vr\327\333\226\260\035a\037#\266o\337U\2629\356\325\366\234/Ko\221\264rU)\317i\037\3461\343[$#\354\242\b0\260[B\274\372a{m8\203\346U\373\202\346\325\376\213\355\034\240\267`\233\2279"
+	.string	"q\333=\275>\363\341\263\274:$\316\223\257\276\b2\232'\375"
+	.string	"\261\0030\021j\232\224e\252iKW\366\313\377\232i2!\333E\315d{R\021\264\004\241\213\016\370Y\210>\2350\024\275\004{\034\021\374:\321\206\347\353\320\350>_\006\330ya\250\343l\f\362\350\204\235\b\004\n;\356t\345-6\203\235h\b\245,\233\300"
+	.string	"{F\f\270yj\007\032"
+	.ascii	"m\023\200\316\031x\340\tC\024\f\006\206(B\017h\327\246p\254\002"
+	.ascii	"ku\336PcD\246)\360\024 su#\326\0269\203\364\234wf\247\005\233"
+	.ascii	"\311;\315\002\327\036L\3414/\275\266\214\001"
+	.text
+	.section	.gnu.lto_imuInit.part.0.143.109b7fc9bc88658c,"e",@progbits
+	.string	"(\265/\375`K"
+	.string	"}\b"
+	.string	"R\21788Po\322\001\214^\341\321f\020"
+	.string	". ;{\203\221\315\263\0162\361\004\254[\347Qo\304.\223\021\205x\202H\020%\250\250\326\212\355lq\n\365\022\037\214Vl\"wJ\001>\230\336\234[\207B\363\034\266/\203\b=\214:\256\263}\3316A\006\326>\243\216\223\337\204\004W\021!-\270\254\223\332\024\311O\201\275\3206\345\347ySb\266\341\257\325\224\033dZ4tCUe{\003\375\024\221\235p\326\310\013\217\027\234\016\217\347\321\306\310\200?Y`\005\246\205CMPU\326\353\327j\312V\004\232\201\221\335\217\232\231%\211,'\366W$\033\303\036\217b\233\004\342\222\375r\226\311\276\345\342\321\212\331]\371\250%/]\341U\362\277:\300\te\272\006\240B\016\t~m\030v\327\034\221;\336\266\202m\220m\225\021"
+	.string	"O\023\030\027\314V\224\3003<@\024\fs\205\2730aqF,\352\234N\013m\246\3544"
+	.ascii	"\\{1\345\264\234~m\031\003"
+	.text
+	.section	.gnu.lto_imuQuaternionHeadfreeOffsetSet.part.0.145.109b7fc9bc88658c,"e",@progbits
+	.string	"(\265/\375`\276\003\375\026"
+	.string	"F\251\216J\260\022R:\360e/\214\326\023@\203B\342\253j\307!^\320\223;\336|\361\016J\001n\023\313\244\351\347>\332\223\376\366\037\032\032g\244\333p\275\222\004F0A\375\222\365\0022\304\304\271\306|(\346\235\272B\260}\262\211\334)\005u"
+	.string	"s"
+	.string	"{"
+	.string	"&\217j7\332q\254\004V\037\237\027\371G.\016\264\335h\347\225W\237\003\342k\362Qk5pj\002\257S\223\007\030O\347Q\306\323\365\213j6i\333l\362\364-\314\322R\363\261m\226\026\233o\007\236\350\001\340c\352"
+	.string	"c\253V\240\354tM\374\366\235\342\315\237\274\037\334\367\302\213?\240\036%v0\375\204\370<\271\350z\251\265\372%\342\246\267\215\300\366\001[T\020\303\271B^\361b\335 \333\3230:]B\247I\350\364\310\235n\222N\213\320\351\020:\375\242\323.:=\322iJ\247E:\275tz\322\351\247\210>+X\257\326\236a\220:\202>\2418\322\257\364;}\355\373LB\247\332\203:\216\351\200u(\306\233l\017\352\274\202\250\023\007\221/X\340u\032\023\2172\232TZJJ\212\225&U\3073%\343H\377\371/\002\213#wd\311\334\320Pd\311\235Y;-\330\244\033\262\366\f\315<Odc<\213{m\310n\225k\307}\255+\270\353\345j~C\312\265\t\256~\345\3546j\214\353\"\356\244\273U\273\024\302[\324\325Z\252\354\212+"
+	.string	"j\247\"7\207\236\373\335\035 \265\353\345,<\nj\356\247\256l\233\323\260\360Uku\361g\374\211\346\017\235Z\003\316<\017g<\375\372~D\021\365\212~\345\f:2;\313!fzfe\203\315L\226S\241fv\201\202\f\303L\306F6s\203#[I1-\003\315\215,\207F\273\221\221\027\353\006\371\302\237\314\3776\302\326\203m\330\372\245\334\234\367\342\256\020\213\236\017KuI\270d\355\005\327\372\301\240d'\025\017\037\225nq\r\236\205\265\265U\252\330\016~e\005\001\bk\305\026\311\332\017\256\303B\230U\216WE\220"
+	.ascii	"\003\003\305\323*\347\320'sd\355\t1\363<\222\215\351\002J\250"
+	.ascii	"q8\005\215r\002\022\242$\222\322h8\220\002\221\271\252:\0210"
+	.ascii	"\275D\024\bU\250\260\245\3550\004\353\"e\273\321\375\321\n\300"
+	.ascii	"1\311J\305V\235|\223\017\225\377_\370x\234\355\234&U\202\360"
+	.ascii	"\210\003\202\n\023\253U<|0\344\312VS\035Z#G\330z\325\303._S\377"
+	.ascii	"\246\016/\221\026\3000\264A\311\0326[\006\331\343\271]\252\231"
+	.ascii	"\353\276tX\333\344Ua\353\n\252m\005\021\016j\347\212\243\036"
+	.ascii	"\004(\2529#\022\232\327'\"\273\304\341\263\200]\b\260\212\006"
+	.ascii	"\312\316\250\342\025\334X\227?\345\241\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.109b7fc9bc88658c,"e",@progbits
+	.string	"(\265/\375`\013\007\025\031"
+	.string	"\246\345\213I\220\026R:\200c\\\203C\302\255\t\360\024\360rx\351p\312\225\260f\021"
+	.string	"@\2210\"\021"
+	.string	"\330\224\370\240\026\355\265\360\315\017\030|/\206\017\245\224RJ\303\372\241\026\303\357\227\226\362\025\267\375\340\317\032\367\301Y{\322$\221)v"
+	.string	"z"
+	.string	"v"
+	.string	"\275Ax=\276j4\242\034z\261\314\rD\032N\006\274\330\231a}`\350+\315\013Wc\341k\274\\.\227\025\372XL\n?\023|\316[Ih\020a\215IC\020\326\ni\353\203\247\016.\345(\310\350Q\212.\206\350K\337\320\327\b\025\235A}*&P\177\212\211\340_?\017;\371_\264\376\236<\377\337\252\321X\213\374\375#\021\262\266Zk\365\35131\377\003\300\005\005\242\214`\034\2758\027\324\221.\336\365t\257\263\305\315\316\277j\252H\365D$>\311\371/\025\227\206E'*\247)%\242T\360\213^\261\370\222\323\251\2576\354\2475\365\2770\365\275,\365\273\254\350sQ\352oQ\321\327\222\242\237\005E\037\355D\377\314D\337\212i\326Z\255J\364\253\230$\372P\314\021@\"\372OB\b\235 ^f\032\253\221\017}'\246\202\217y\350\035bv\b\251\001\345Mzc\243\264A\t\f8~\355X"
+	.ascii	"\212\334q\200\364\351\216qY\247\216q\350.\026\220\2552\253\334"
+	.ascii	"\325ZSSr/\035\357q\371]:\216B\241R\"\261I\311ur\323qm\025yr\316"
+	.ascii	"h;yG\377\214\216>\230\034\37518z{\334\350\207\251\352\223\261"
+	.ascii	"\3217S\243_\206F\357\325\214\336\037\305~\032\252>\232\251^\036"
+	.ascii	"\373\377\357\311\350EW\312\214\021O\260\266Zke\320\3634\344\031"
+	.ascii	"\232o\001\337P!\357\225\235\220\267K(\344\2332\311\303\3038%"
+	.ascii	"\3568\026\344M\221A\036\356\256\021Y\206\375+\310\233\265ord"
+	.ascii	"K\213\267\323\265\243\303"
+	.string	"If:\374\003\323\341a2'\207sI\034\376\201\341p\316\330\0032.%\003\036\310\213\002yX\006\344[\232\372\030'\346\343\334q\314\027\326\343\037\030\217\221t<\036&y\314\224\366\224\007\002\200\207\2501\020\r\233\253\240 )Mk\300\002)\252\332\006\021p\214\243\"\202&\020\t%\020\223\016z\020\216\276\371\0035~\245F\354\351j\307\020\375&\214\024gG\032$h\210<,]f|\302%\330\255\321\370\230Aks\254G \251\036~r6\356\276$\027\334\242\247nN\264\370\204\013@\324\023T\217O\355\361\303\f6\260\235\346\336\341\322\025J\306\307A6\377\336\277v\255\\+\327\nW\036\272\366\256\366\274;\320 \232\305,\334+\332\264\250\312\036L9\265\316=\213\234|`\253\261D\020\034\217\217\207\016\331aU\334k\255;\013\035\335\3564\342\031r~\241\f\307?\331\321\2520\206\tM\005\316\351W\206"
+	.ascii	"\213\332N\314\\S\226\247]h+\226Do=I@\354\225K\202\277T\257\327"
+	.ascii	"n\\(\354 <\t\n\303\2041?\032\036y\331\005W\025"
+	.text
+	.section	.gnu.lto_.refs.109b7fc9bc88658c,"e",@progbits
+	.string	"(\265/\375`\361\001\355\016"
+	.string	"\326hh; \2136\351"
+	.string	"\324A\t\245uYv5XA"
+	.string	"B"
+	.string	"B"
+	.string	"B"
+	.string	"B"
+	.string	"B"
+	.string	"B"
+	.string	"b\251\031\376\t\022t\003\213/b\206A\321\330\323\342\377\347\321\360\321\332\"\242\356nmo\231\002O"
+	.string	"^"
+	.string	"Z"
+	.ascii	"\356\255\366T{\327\276M=\222\036\212\nQ\f\221\177\311\267\344"
+	.ascii	"S\362\255|*\177\312"
+	.string	"\177\362\233?\355\003\331=\262w\262sd\307\310n\221=\"{\200\354\232\354\031\354\027\354\026\354\027\366\tv\013;\205\335\365\033v\251\037a\177\372\211\275}\314c\207\031\257G\274\216\275\336\260\227\260\207\260\177\260/\304\231\314\r\363\317\245\367\362C>\007K\177\203\345\327P\351g\250\374\030.X\240\374!\025@\"@\270\372\017\256\237A\365/\240\364\017\312#\230|G\362\005$=C\362\027\326[T_A\365\t\352%\\\317\332k\334?\3271\356/\256W\"O\t\024=j\017iz\253'\242\037$:e\322'U\227p\336\252z\305y\252\352\021\316\273\252G\234\207\252^\316\021\324\327\246O6]\262\351\326\246K\370\210_\\\300tfx3\004\200\037B\001\004\323\237\200\371%h\362\365\035\274\277\301\353\037\371\n\362\023\274\336\221\337y}#_#?w\240\001\344\240G>a\037!\206\267x7\330\221~\336\367M"
+	.string	"\2372\034j\317v,Gt$\303\335\353\322\353\317\353\006\364#\261\006\336<\243O\255K\255g\033\343I\274H\354\200|\222\341\022\252G\\\177\334#\265E4T\351\217\245\347\325\361\352\275Z\001me8\025\351.\027"
+	.string	"\232\233\"\313e.\2250.g\207\251\026Nm-\303\332"
+	.ascii	"q\214\341\327kX\217\364\035\3710\274\256\300 DK$\304\275\025"
+	.ascii	"\023\007\2040*\n\304\201` \004^\202)\005"
+	.text
+	.section	.gnu.lto_.decls.109b7fc9bc88658c,"e",@progbits
+	.ascii	"(\265/\375`\256Q\355d\001Jg\006\205U \fQ9\351\024d|\003g\324"
+	.ascii	"\250|C\263\362\363\311\345\376\231(\334;\307\363,\3009x\226\372"
+	.ascii	"\331\375A\365\236\227\201 BS\253\310\302a\305F\203\315v\221\233"
+	.ascii	"~I\205V\013Kh\n\027~\016/\271\273\314M4z\212\3577\006x\210B\033"
+	.string	"\261\233\354-w\n'\007W\bx\b\035W\233-\327`\262\217\217\032\034pG\372\376tBU\344\234s=\034\366\035\016\377\314\350\357\034\364\177k\351-\265\331\\:\013\0213\3475.m\245\261p`z\032!\007\230J6b\203\346\322l\375\366\263d\346*\036\260l&\206^\316L\242\016\035|]oN~\340\373[\005\375\033\013\234\255\361De\016\363\314\2025\006\254\331WZ\215\231\211x\352\242\262\232\276\277S\320nk\267\332\274\240\2530\201|\352,\251#\247\357\257\031\372z\001\256{\365\002\374\313\004\375%\202\376~\241\277YhZK\211\262U\246\244\357\357\213\264\033\205\376\266@+\263\016a\242*\204CT!\334N\232Y\233\031\364\023&P\003\241#\005J\337[:\350k\006\330\356\355\325\f\360\355\033\264\233\374=\3269:\252\372^\\y\362\326\367v\r\212\253\020^B\004\004\003G\224\247\276\267\\\3207"
+	.ascii	"\254\303\354\023+tJ\217\257\273\234\231\377;I+\251\315\026k\""
+	.ascii	"iNZ\254\2134\222\237&f\276\372\351\341\343\206\233^\316\314\016"
+	.ascii	"D\035|\246\350\311\231\201\257\221>\002$\005\346\004\244\357"
+	.ascii	"m\226\021{\205\276\347\240BzH\277h\376"
+	.string	"\270\023r\006}cA\357V\205p\373\250so\342@\365}GA\373\353\327L\313\307.\315\370\322\326\367]\206\276\217\240\357\036hQ\035\302\275\243\267\336\\\255\365\021\033\334.\3152Y\316\271\2714\320\312y\251\271\200\346\344\274\004T+\001j%\300e\3025d\n\276\357-\364-\003\rQ\207\360\345\252\020\356\240\016\341\367\025\352\313u\b\367\214\246Q\233E\215\365_\0233\237\345\314\004\372\225\301\303\221\326\367\375\204\276\026a\240\275\275\275\275Z\204_\335\240\257i\320\337U!\334W\335V\375\342}\325U\037\261\301{\2322Y\316\314\276\2729/\325J\200\237Z\tp\302\201-A\301\367\325\f\372J\005\255yJJ\005,\254\262\276-\325QU+k\370\201\321Tb\243o\267h\247\332\334\320O\257f\032\352\347\02233s\316@\265\315\027\323U\337\240:\204_\233\250\nr\256\033p\335\333\253\033p7\211x\263\210"
+	.string	"\220.&}m3m\360\211U\321\301c\351\002 \346\f\252^v\3765}\265\225\365\335\333`\237\200\030y\323\367u\t\272\246\332\331'V!\314\271\270\233S\353\324f\245S\357*\235\312\246\312\261O\254.\300U\265\241\303\317\222\221\247-\370\306!\372\365\260c\003\246\357\253\017\364\325I\033\2500\274\267\3754\005e)\246\247\2607\025N\325\253\315\332BuC\326B\315\303sQQdz9\347\016\035\210:"
+	.string	"-q\201\371@\357\353\024\372\272\204\276f\364*@\217\002\364J\350\215\350_\325\244\361\371\332c\232\245\371\353\231ZW\355~ng^ \351\373W\272\332\344m\255\225sS\316YC\203a\223C\257oO\025\302\255U\207\360\001\252\020\256fD\274\322\ta+,fN\3139\003Y7,-\346\364\3552q=Z<\210D\365\255hU\322\264Xa\342\206veHekc\313\222\003.\310_\303\324/\225L\365R\347\252\230\n\246v\251ruLm\326\270\277n\251\\\232*\233\233ZE{kB\026W\261\274\255\312\245\325\2607/w9\347\016D\035:t\250]s\316\200Yp\233Y\207pQ\025\302O\001=\022\372!z\024\320\003\321\207"
+	.string	"\275\007\320o"
+	.ascii	"\375\t\364&\240\030T!<V\311\352\232}\232\322\312i93/t\031\274"
+	.ascii	"\036]}\377\327\264\252V\245\324)\265\211V"
+	.string	"\243\3742s^#{\242\243\001Pn81{\333\317/g-8\334r\316\257M~\021\177-\253N\352Ze\276\355\247\211\231\203\354\370\300k\"\246\227s&\352\320\241C\207\363\352\355+\310\316\255\271\016\341\240*\2041\230\345\r\276\203\036E\217\321_\364\215bP\207\360\255B\370ru\b\237Y\2070Z\205\260\rA\334\030\026'\317o9\3607\220\217\2773\372\237\225h{\240\300\347\277p\342\250\375\335\241\023`\277\f`\345\354\361\177J\232\001\326j\374\315d\275\352\257\006\235\277\0354\2526A\t\317\360\237)\370\255\211\022.\364\237\307\337\206\240\251@\200\242\211\034\303\177\n_\302\361\177\202\340\177\t?N\r\020m\217\277\246]x\320\177[\370\233\204\345\301\344\365\333\016\376J\324\365[\256\377\0342\260[\177_\370\320\177\341\376zB\233\243\251m\376\352\246De\243\367W\274\277G\330\035V\002Z\025\004\253\303\346"
+	.string	"A\243}\001\377\235\273!\303\353\274\300oM\234Y\247\007GcK\210\361\377\003\026F\313\370\205\377\364\360w\212\ng;\\\375\326\252jL\203\240\222i\023%\264\004\254\213*\345?\232\266\300\tm\376z\306R\375\317\340?\b\210\216\002h\200\366y\211\377B\375\317\373\257\367\277\205\377r\276g\200\277\376?\377]\376\225\310N\375\235\242\326U4\377\375\247\001\354Q-b\245\242\376\346\300B\375mB\025\253k\177=\373;\204}\262$\234~\233B\213z\302K\340p\004\374w\357o\252Z\246\206!\363\327\023,\213\277\316\311\375\375\3016Y\246\226:\207'\340\267K\025\204s\370O\241\333=M\224)i;\030-"
+	.string	"\377=\376\335\177\327\277\326\371\373\177\245\363\3279\177\217\371+\334_\263\374u\313\377\235\377T\373-\372[\236\337\356\374\326\367\333\363\267\277\337\372\374-\245\202\277\361~{\177\3336\005\377\201~|\301_\337D\340\277\375/\032\0224\360_\356\277\227\377c\304\374\017\363?\356?\227\377`\376\317\235\347\277\311\377Q\376O\371\237\366_\312\317\377\236\360[\024\374\266\370[\244\337\206\340\267\037\370m\007~k\342\267\031\370m\211\337~\360[\b\374\326\203\337n\360[\017\277M\300o\017\360\333\002\374v"
+	.ascii	"\277\345\360\333\r\277\265\340\267B\277\r\372\355\317\337d\376"
+	.ascii	"\266\362\367\332\337M\177\243\375]\366\267\330\337D\376\006\373"
+	.ascii	"\373\307\337'\370\333\353\357\254\277e\374}\365w\325\337+\370"
+	.ascii	"\233\352o\251\277\241\376f\361w\376\033\005\177\253\370[\371"
+	.ascii	"w\362o\023\374}\374;\351\357\022\374\235\342o\243\277\203\177"
+	.ascii	"\003\377\006\301\337\036\370{\003\177\243\370\333\304\337&\374"
+	.ascii	"]\302\337\030\370\333\002\177\213\360w\b\177\227\370\373\203"
+	.ascii	"\277=\370\333\001\377\343\374=\342\257A\177\207\370\373\303\337"
+	.ascii	"\013\370k\335\177\024\377\321\374\365\367\327\235\277\236\371"
+	.ascii	"\277\367\337\356\357\337\337\347\337\035\376.\372;\001\177\037"
+	.ascii	"\340o\002\374=\200\277\177\376&\372[\350\257D\177_\370\033\350"
+	.ascii	"\257'\374\025\204\277}\376\227\3607\317\337;\177\373\376\306"
+	.ascii	"\177\333\277\302\371\253\335_\321\374\325\314_\335\376\332\366"
+	.ascii	"W\266\277R\371+\317_\373\257\365\377\211\277\376\177\232\377"
+	.ascii	"d\376\257\375'\341\377\n\376w\371\217\301\336\336\336\336\317"
+	.ascii	"S\374{\366\376\0074 \227Ys\316\031+/\331h\200We,N\357:\371e\002"
+	.ascii	"myQ\331\352\373\274[\366\377\207\347\276\214\241Rv\233d\271\330"
+	.ascii	"\362\265\347\363\006\245\005\234KV\3576\2346\230sc\372\276\207"
+	.ascii	"\316\222%"
+	.ascii	"7\n\203U\ts`\356z\342\240\277G.\222\337$\277I\256X\347\234s\230"
+	.ascii	"/\212W\324]\306\262*\272b\247\230#B\246\364}O\030\364\177}\377"
+	.ascii	"8/Y\345\234_\234\314l\305\324\203\377\372z\326Z\364\373T[\013"
+	.ascii	"\360\377\346\354A\brf\242\242\225s\256nP#mK70\310\247\\\316M"
+	.ascii	"[\313\017\266\256\232\266h<\235m]]x:\333\312\313&!\313\013Vy"
+	.ascii	"k\371t\226\363\205\246\246e\t\255\253\247\263\245|\341\351,_"
+	.ascii	"e\026b\256jfn-s\223V\276\220\233\362R>\323\272\302\340\251i\353"
+	.ascii	"\352\351l\351\352\302\323\331\326U>\333\312A\271i\311\n\252)"
+	.ascii	"[]\310g[l\362\231\326U\320\323\231\326\325\323\331\326\222\372"
+	.ascii	"\004U\246\b\2145\255\036U\365\311SSvA\225\265d\025$\367\304\324"
+	.ascii	"\312t9\327\264\026\331*\313\345\\\200\234\263\264\254\350\226"
+	.ascii	"hT7&9\027LkKZ\225\231s\336@\305\304\245\225\233\344\2265\313"
+	.ascii	"=\035\321\312\371\b\023R\246\3129g\r\226L\271\354\243\312-\273"
+	.ascii	"\262\362T\213\234\001\220\2319S\345\274\254Y.\347\274\3149\373"
+	.ascii	"\254\262\2309\333\bz\n\243\242\312\031\213\210*g-\253\264\310"
+	.ascii	"\271\323\352\334\256\236\316\270\264DTA;\013\313N\314"
+	.string	"e}\232\322\312a\231n\313\n=[>\311S9\347\212\207\206]\301h\323\367\026\331iS\303\272\352\373\036\036\350\r\303WB\230v}\337\243\205^!;n\304\300Y\352\373\036*\364\006\001\202\203B\005\254\357{\226?~\234\321Z\352J\323\367<z__S\346\342\356\336\240\257K\352\345\361\332\274<n\213\035\253_\024\246\272\273l\205\345\241\247\270\264Q\351{\2365\350\177\275n\327N\r\031,\2504\337v\271\236\204\345\234\203z\352\334PI\353{\2363\350\177w4\357\216\232\346\367\224\363U\007cc\264t`*X\272\274\372\336\034\314\263\234\363\206\252\006\207\034\270\276\347qC\301\324\356.\216{\2436o\0263\347\263\233e\247\256\215\237%3_a(\037=Sr89\341k\203\213\0049\237\261}\375\270\233\361[\343\2774.\326\255\002:\303\205\314\262o\225\253C\230C\025\302W\206\210\337\031\276\037;\232"
+	.ascii	"\351\033\200\013\343\265yaX#\"0\363\362\247j9\026\247\227\255"
+	.ascii	"\254<\234\307\007z\257z\226f\260\205\351{\036-\364\277VUc1x\004"
+	.ascii	"\351\313$\3139\003\375\252\310A\"\343R\001e\311\323\341\326\367"
+	.ascii	"<1\320\377N\311\371\031\023&\306t\245n\024\020-;\236\372^\250"
+	.ascii	"\033C\314\315L\337\363,\321\377>\365\325\030\026\256\264\276"
+	.ascii	"\377u\272-z\354\332\256\260\270,\256%C\322\243J\337\357\274A"
+	.ascii	"\377\333ts\326\326W\233\276\257doX9\252\356\274P\205]\246\273"
+	.ascii	"d\367\356\322\326\261tj\363f+\347v\216\265\362\276\331EC\201"
+	.ascii	"i\263\237\245\240\334\3044\025\2263\363f\033'u\2273\323\276`"
+	.ascii	"1"
+	.string	"\247\316\317\335\251B\370;uq\364\246\204\341\261\365Uc\335\374,\005\345,d\r\034\333BmZ==\373\34629s\247\350qq\301\367;e\3207\324]\2320<\233g\333\324\246u\363f\346\334\264\246\243~\316\234\265\324\270\261l:\252\312}}\360fG\324\241\003\262\314K\016z\277\023\006\375N\027\364;Y\320\357\270\245)\362\201S\206I\211\235E\323\315\250%\032\026M]\367\270\315i1\343p\366L\365\221e\351\243\357w\322\320\337\322\331\271\263\255\313\026(o\375\366\263\f\312Ls@\302\276|Y+\277\2109{\305r\261\31404j\356\307\035\230\034f,\031+\306\226\261a\354\230\332\264sV\316v\231\263^\372\3152\303|Q\270|\334\315\331\270\267\331'V\026\264\230\323q\367C\367%\245\312\317\375\016\022\364;B\320\357\364@\277\203\205~g\n}Z\035\302[\2100\0169f\222\276\377\325A\337"
+	.ascii	"+\375\366cs\316Q'\f\213\325R\2336\213\205{e~\003\233\2452\263"
+	.ascii	"\235\313\002'N\357\0029\214\320\300\367\277;\364\2771\350\335"
+	.ascii	"\352\020\376\217\r\375m\225\f\320&+jdnv\2762\252\032Om\225\016"
+	.ascii	"\352\302\005\2355lV\355NF\024\252\276V\255o\330\346\022\230\260"
+	.ascii	"\2343\f\265\226\3215\252\\Z\t2:+\305N\261k\226JmZ5\213v\033\305"
+	.ascii	"\24655\f\253\3261\252\335O\0233/q\232+ I\250\254Z\273\350+\f"
+	.ascii	"\266\003H\022\275\234\231\036\2640s\266sQf\035\302\365\251\n"
+	.ascii	"\341\377\274P{\326\203$\214\216\026\372\376\227\205\002\t\322"
+	.ascii	"L\252\\\332\223\036^\364r\350h\256\242%\313\036^\364\330,\013"
+	.ascii	"\033\325A\013\253\237\013(ClY\243\265\234\016ZXY\200k\311]\316"
+	.ascii	"\031\210-k\262nR\345\276r\276\322@\214H\017/K\254\231mb\307,"
+	.ascii	"\231\205b\235X%\226i\305\354\023\313\2446mY\323y\303h\033'\352"
+	.ascii	"./6\215\243\254{\364\217*\227\226\227^\204\020s2b\003[\326<\372"
+	.ascii	"\252\312a\345%\233\003\210\205)\263R\326\b\007\246\247\234_h"
+	.ascii	"\200\244\n\016{\304&\251rXyi\251\301\222\253\f\244\254\313\332"
+	.ascii	"\3142\335P'(L\032\3607\224\262\236c\233\270\212\304\226=\274"
+	.ascii	"\350\345\314\264jsv$\001\300\375-\222\333$\375F\202\254\341\002"
+	.ascii	"\027+\035}G\210\270E\202\225\\\331\001\247\357\3215\250-\002"
+	.ascii	"\324\325c\211L\337\243`\320)[e\231a!0Y!\226\210\035R\2336\354"
+	.ascii	"6\314Z\331\256\016ZXe\200\211\352.\314\202\335\013\007\246\247"
+	.ascii	"\274\264#\004\0218\\J\364.\332\327\026\035\350=\332\205\276s"
+	.ascii	"dm\250r_\037\024Qs\262c\311\235\355\262W\366\006\007\246'\fh"
+	.ascii	"Y\273\313q\270\237_\316[iaZL\356t\024U\271\264\022ndw93m\227"
+	.ascii	"\335:\334OSPn\022\242\344\316vY\034\033~\226\230\331\n\373\370"
+	.ascii	"\332{\323\263?l\020\353e}\330\036\366\313\002\261<j\323vY\256"
+	.ascii	"\016'ZSO\016\206{\037\030\364>-\350}n\350}i\350}N\320\373\224"
+	.ascii	"\240\367\205\241\367\361\260\261\266\\#\246\252\357}2\320\377"
+	.ascii	"\226\206\305\252M[\303\302xaet\245\t\2635\354\f+\243\312a1\363"
+	.ascii	"\013\fi\350\336\274\321\263lh\3344\361=\276\202\376V\206\215"
+	.ascii	"\301S\247\t\216:6\206\205\361S6d\252\253\3571\031z\214\004=\026"
+	.ascii	"\202\036\367@mUs\221\340\224\002\325\305\251\257\245\022q\353"
+	.ascii	"\202\305\327\324\213\276\031T!|\254\205\036\337x\262PN(\030\231"
+	.ascii	"\254+}\217[<9\315\245e\272\276\326\351jp\335\022K\234=\3134g"
+	.ascii	"F\225!}\177\326\241\257M\273d\227T\216@\255\365\375m\276]^\365"
+	.ascii	"d\016=q\274\304\305\350\373\274\336\373\377\373)S\326fe\257\316"
+	.ascii	"\017\225\230\274U\247\351\374\336\320\321\031\353\3733\f\372"
+	.ascii	"\223K\234F\323\204\006Z\337\237l-\264^m6\234V{\237u\363Dp:JO"
+	.ascii	"\251ri%\312\244\300\351\265\316\253rXA\271IM\335]E\303R\247\r"
+	.ascii	"\276e\272\315\22607\215\327oj\263\363\336yM\245\271\374,/\344"
+	.ascii	"\314\343LX^w\3511U.M\204$_:\360Ly\341X\242\367\256\331\324f\267"
+	.ascii	"\3515u\255\206\003\323\223\bn\326\332\264\231>\303\201\351I\204"
+	.ascii	"+Z\356P+?\256\370\300\367\247\031\372wC\265\0311\203\246\355"
+	.ascii	"vd`\311]\351\3733\t\212\346\325\005\021\026]\372\376"
+	.ascii	"\004C_\233O\323tWs\201x\231\321\244\357\317/\364\347\016\364"
+	.ascii	"'\2161\355\245\303T\271\264\022q]\356r\316sM\2466{L\213\031\323"
+	.ascii	"l\375V\345\260\"\300\305\313\335\317\020#cM\360\375y\205^\261"
+	.ascii	"\246(_\372\366\227>\032@xX\351\345'\254\" \260.gp\250\035\267"
+	.ascii	"\035\263\215\330\340p[\236H\335\350{\274\206\251\374\277\035"
+	.ascii	"#^gb}O\244\004=\003P\263\031WWx\212\025\234+\273)XJ\016/\027"
+	.ascii	"\266\b\2247l\346\372\246\275\f\233&\232\276\267U\\,\334\274\314"
+	.ascii	"\314\360Y\rb2\315\251\t\343\241\022\206\253\f\312\361\331\333"
+	.ascii	"\242\324\205\261R\243I\023\314\254si\242\310~\206\354p\321\006"
+	.ascii	";9f\266\355\240\253\321\243/.#\232\032\373\307\316&\"-\273\246"
+	.ascii	"\310\036\231\222\234\261\212\200~\220\341y\351{\r_\304\304\360"
+	.ascii	"\222\fN\226xn\226\tT\031\035X\311\361\222+\237\274\246\\Y\215"
+	.ascii	"\270\2529q\372^\003\034\330\261\0210\214\244\346Uf\306\322Z\266"
+	.ascii	"A\200\016.rl\350\345\247\254\242#\036:\274\340#\307H\274\354"
+	.ascii	"5\335\2660\221\343\"\377\317g\206L\027\263\276\327\200\003\305"
+	.ascii	"C\216\303\376\337y\003\006\232#}\257\001\013\375\261\220\377"
+	.ascii	"\327\363\345%\256M\337kx\201^\203\024\376\302_\030H5\313U\230"
+	.ascii	"k\tV\321N\226 `\302\360\217c \266\256\t\311U\232\276\330\207"
+	.ascii	"\255\303U\3146wu\377\177\370\314\221\035N}o\001\035\364\307<"
+	.ascii	"xt\215\017\322\362\322UQ\226\2457z\027\300\344\304\372\336\202"
+	.ascii	"5\364\307]\270\253\257\356\222\231\2532TY\302\303\242\227\255"
+	.ascii	"\264x\020\341f\365\324\367\026\350@\217\265*\336\332*;\317\326"
+	.ascii	"\320b\324\300Q\261\016\035N\256\213\246\2323\0306*\316\312J\353"
+	.ascii	"\211\242#\210\023\025\215\212k\324\230\302\223\355\252\2008\305"
+	.ascii	"\250x\306\214\267\335\240,\305\244\026\206\255|\225\221\323\367"
+	.ascii	"\026,\361U\30500\214\267\211P\211\314\255us\f\323\253\357\207"
+	.ascii	"\344`+lu\301\356RP\316\\N\334z\344\360\322\244\357\207\354\314"
+	.ascii	"\374ds\232\301.D0\345%!\0304a\303cU\006e\251/\246\362I\325PK"
+	.ascii	"\353\373!0\350+Y\233\323\r\035Z\336\211G\006\246\205\023N\225"
+	.ascii	"\373\372 \211\227\273\234\231\247\034\314\304fw\207\235\232\355"
+	.ascii	"\304\213\013\203\302SX\n?\341\0268\2526\261\323\031\007\n;\235"
+	.ascii	"o\332\254\312}}@\366\345\216\247L\336\020\271\237\333\346i80"
+	.ascii	"=\211PV\207\231\3169x\211\207J\0215I\364p\023fQ\233\230)m\203"
+	.ascii	"\217\2343ze\370\376x\t/\335\242n8\365\305\371\254\213TW\337\017"
+	.ascii	"9A"
+	.string	"\377\263Nm\236{@NE\350\b\351{\322y\032\250e\224\024\234\214*c_\372~\210\f\375P\022\364C>\320S\017%s\207#\256\357\207\270\320\017\351@?d\003\375\220\f\364?\335\340\235qq\023\207\327o_\246\230\372~\350\n=\325\234w@L\334x\250\365\375\271\346\377\257\204\037`\324\372\3364\335eH\030U\337\237v?tB\244<\351\373\023\215\332\236\233\032}\317:\264\305\020S\006;8\330t\3348\351~\326\375'\226\363Ls\261\260G\247\205\276\247\253C\270\242\021\361\223\216'\016\313\235\223\276\317pw\302\375\034\003w\222)\302\312/\026\340\344*\313\003\220\2210]\242\3722\233\202h\025\251\323\367\224;\305\234s\377\357gej.\253\3573\320\241?\303|\211\001C\322\267\353\341\360\031\367\023\314\377\363\221Y5I\351\373\fs\350O/\347\227\377g\351x\261\002\325\367\031\272\240?\273\374\377\255"
+	.string	"\315\216%}O.h\213\fk\031\374\352\314\322"
+	.ascii	"9\263\374\344\362\237Z\316-\315\325S7\260\326\364\375]\035\302"
+	.ascii	"?U\b\237XD\374\314\322C\322\272t\351\353S\205\3603\024ac;\255"
+	.ascii	"\210I\205\255M\215\301x\373i\245\216\221\261\343qV\361\2658"
+	.string	"\002\243yV9\335bD\271\251\212c\347\354\266\fi\253n\326\366\310\334\365}\206\245\264\264s\355\313\216\236\272f\216\265\276\347\232\317\232;)z}\317){C\302\350\372\236RN\033l\274\300\220\021*\303d\236h\350\022\303=\031\213S\302\303\324\261\214\323\374\211V\225li\303\243\357y\326\223\306\t\0263P\252\227Z\236\r(f;jo\364\254<\271P@d\330\324ty\"$\345\\r.9\313\"`\004N\330\316\334\023\"cM~\226\331.lyy}O\262\267)9\263E\247\3579\306$\311i\3444rj1\002\346.\254J\0363\311O\261\336\263\253B\326\367D\362\266'^U\304\364=\217\274\r\210\355\t\035\020\241\256!CN\"\030\344\234[d\025c\214\224\335\341 c\242\330\205\375$\322QgX\031\030;\336\376\377N\2567vm}/\304\204\006\tr\202\375rn\001\213]\375\306\326\326\300"
+	.ascii	"{\033\026\020+\274\036=\316\037\230H\230\254\"_\021\033m\300"
+	.ascii	"|\374\374q2\367\344l\364=\277\256\227\230\264;(}\237\367\253"
+	.ascii	"H\330\226L\351{\fb\316\034g\216\323\353\f[X\306\302*\262B\270"
+	.ascii	"TQ\243\343\247\327\317\256\356\202k\001\246\357\317\255\223\353"
+	.ascii	"\377\365\314\241qv\244\3571tAO\255s\307\377\337\257\215\220\033"
+	.ascii	"o}\337\030\3402\360E-\261\333\321\367\017\223\023D\210u#C\203"
+	.ascii	"\212[\337c`\322\240qfm\240\021\346ge\213Y\323\215\237Y\367\r"
+	.ascii	"\013\252 }\237w\332\370\377\363\231\2435\003\215\215\263\306"
+	.ascii	"\016\026H\302\\\026\271\f\316\222\276'\326\020\0300N\031CWl|"
+	.ascii	"jkN\254\2341~\312\360AC\345cH\337\347\235\355\377\017%\202\005"
+	.ascii	"*I\337c\240quu\305\300\260\371\375`B\366e\257\252\352m\037\244"
+	.ascii	"U\"sA~N\310\230\001\353\373\013x\350\177R\235TJ.\310\241\377"
+	.ascii	")\365\332<\245.XPTF\305p\255\271xlp3\372\376B\033z:\235N'\024"
+	.ascii	"\232\211\266<A\247\346\354\270\364\375\317\247\237P\366\313\017"
+	.ascii	"#gf\377\177\327\211\021,\036}\177\301\354\\:Y\234Kg\323\311t"
+	.ascii	"2\235Myx\313\2163M\353\305\215\276g\323\217\210\021\256\251\276"
+	.ascii	"\277\300\205>\210N\2353\327\271b{\337\273b\3502\347%3W\211`9"
+	.ascii	"\026\247$c"
+	.string	"a\025\325\033E\270(\351\373\240<\364Ae\342\3349qn\035\316\2712\265\252\2542\226U\221\0349\267\256f\2537\370\006V\021P\231\273fY\337\007]A\0374\206\376\276\251WO\357m\325\312\002'(L\356\202\202\344\2756o\3365R\224\363\213\b4\251\262\203\2676$\367}\020\027\372_\274\332\274xm\366\301\227\326\322\322\001\220\\5\022&gA\372>\b\006\0336Wl\0036D\200\352\254Y\263l\203A\223s\353M\013K\372\036\b\017\375\257\035\232\233\346\276@\227V\250\332\220\270\273l\305\364p\240/\350\201\232tt\267n\0039O\306\342\364\316\374\326\375\220\301\335\301y\361\377\007\204\373\241\327\367@=\320{\250\267L\231\303\211@\001. \230\207\327\236Z\337\003\335@\177\305\324;fL\327\250V(\032\224\037w\331J\213\007_Z\334\2137}\017d\205\276v\r\374\3370a,\232\017\322r\276:"
+	.string	"\222%\226\207\2369)/3}\017\004\205\376z\2517\016\314\333nN\313,\314\212Z\250B\007\375\317\032\364m\377\333"
+	.ascii	"\365K\013Pg\272ty\233\b\231\305\223\016\304\256\350"
+	.ascii	"\264\334\346\335b\353nn\341\311\027\364?nX\260\364\333]\232\345"
+	.ascii	"\252\035'\"xnz9k\361`e\270=I\353\373\237.\364\277W\256\334!\347"
+	.ascii	"S^2\262\200%a`\240\377}{;\234\by\351*\004\336\317\022\372_7\267"
+	.ascii	"\267]f\016\262A\230\2618%n\320\377\2625/[\265#b\346er\307X\234"
+	.ascii	"\022\037:\364\277k\257\315\273v\211|\200e\226\227>*U\200$\321"
+	.ascii	"c\222\003j\331\367>c\2464\357\224\226\272gS\356\002\013\313\031"
+	.ascii	"\313\303N\231\223,T\372\336'\016\375o\332?b\203\332\274i\375"
+	.ascii	"\366\001\226\226%\023F\r\226\222\234\265x\350\201\363\004\316"
+	.ascii	"\231\276\367a\202\336C\275\315\213f\353D\310K/0\020#\222=\334"
+	.ascii	"\347\210\231\331=Cs\316\313\240\314d\206I\030\224\3373\024^\246"
+	.ascii	"\226\\\374\377\355 \351\002r\244\357}n\214},\251\221h\003p\244"
+	.ascii	"\017GF\"2MZ\220\002\207,\020\223x\205\2220i\230\204\223\306 "
+	.ascii	"\321(h\342\210\"9\034\"\217\206FA)\321H4\022\223;;\311T\251\004"
+	.ascii	"4\022\323\"Q\211\002\020\370\223L\225J7\005\341\261hTf8\322\007"
+	.ascii	"\r\305\242\322h<\032}\030\222Ga\220G\305\021\251\244\024\004"
+	.ascii	"\2160\006\323\013V \245\305\340P\204\344\b\311dP)\351(\f"
+	.string	"\362\035\351C\262X\f\n\221\322`\022\210\025\216H\244\364h\364\245\b\016\2137M\032\217\3023Ej$\"\213xEQI)\350s\244\017\030@1\302\t\020\351\360\b\031L1HAx,\222\030\"\217$\200\216\364\301\210\250d4L\203*\020S!\b\311 \007\206F\307$$1(\244b\005\013G\344\212\243S\305\n\026\222\204\302\340\271B\351H\342'U\002q\244$$4*C\3401\246\3503\t<R\352I\201\306#\245\323x\244d\207,\020\223w\205\322Qx\221\251\222\275\317\nd\232$\036\rM`0\032\372\214\206I\345M\372\036L\203F\35109D\002\217\224>\374\024\225\222\206(\216\2246\2540:N\340\210\002\204\220XT\"\246E%\t\001\340\220\006\225'`\360\200\t&\322\341\te\022\361\002\022y$\201B\210AZ$\242H\036I\244\303#\240#rE\005\206A\311\344P(\fb\0214"
+	.string	"\004!Fpf\bJ\207\025P&\0215$)O\244\303\344\320\2042\211\250\2418\334\200P\030\344\031\026\323\364\210DJ1$\r\323\344\212\023\300\240!R\331#\200\341\211\f\210p\2022\211\210"
+	.string	"_J4\216\240L\"\376\\\b\361!E\006\225>\020} y$\361\203\032\035I"
+	.ascii	"\3120L\203irgh\304\207a\022\021\205\006H\030!\251<\022U\030\""
+	.ascii	"\2254$\021\323$\005.\340IR\236\030&\021Q\b\205\301\235$\345\t"
+	.ascii	"\2410\210yB|@J\217\307\244$\220\005\2410\350#\024\006\201\302"
+	.ascii	"\024xG\304\207\017\b\205\301\236#}\020\002\221 \204)\006\220"
+	.ascii	"<\n\026C82\022\223\220A\236\240\324\250<\222HR\006\r\213A\241"
+	.ascii	"O\222\362\204P\030\344\021\n\203\366<\322\207#%\nC#\020FE\242"
+	.ascii	"\022\205\241\321\221\204#%\nC\243_j\004\\\221t\016\323`Q),\006"
+	.ascii	"\221Rd\220\002G\024+\214\216\023\330@\022\362\230\"i\f\"Q(\223"
+	.ascii	"\210\027\230`\202VAD\246A\022\322\243\211a\252TJ\"\272\220\210"
+	.ascii	"\034\032\207G\3505\340\200\001\034t\240\302\367\016\036\020\342"
+	.ascii	"\001!\360;x\200\b\021\017\340@\004z\016D\330\024\230\034\026"
+	.ascii	"\217\214  \207E%\005\206F\312\224\230\246\301\2414"
+	.string	"\035\016\221)\214\202C$\324\0045\035&S\2448\3424x,\2468\323 \t\310\233\002\221i\032\024\2720\005\341\021\003\312$\242O\nLj`\230DL\321\024\030L\213\303\022\303$b\312\223L\205J\243#\322\004\f\306#\321\210\034\246A\245\tv\224ID\236\025\202H[,\036\221\027I\230\022\225\316\025\202+lr\250,\006U\300\276$\360\210\230\302x$1L\"\246F\245\te\022\021\003Q)\005`\222\320\b\027\203B\243a\0222hT\002\205\302\340\317\260xd\f\002\213\305`R\222'M\002}\214\214A\024\214\202<G\3034\210\004\036\221+\216\206\216\364\301x$\246A\344\2608,@\022(\024\006\317\364H\037\020\200\034\026\213\304\0248\005\002\372\216\364!\025*\221irD\022\250b\230*\223.\244 <\026\201@\234\032\225G!\020\350C\016\215+\034\201@_\0229L*\215@ jd$\246"
+	.string	"\004\342\244\221\250\224\004\002}\305!\020\370K\201i\222X\f:\322\207\344PiE\312"
+	.string	"\243!2\210\224d"
+	.string	"\210dJD\001\204\322x\304"
+	.string	"\025J#\261\310"
+	.string	"\r8"
+	.ascii	"r\320\201\n\020C#eQh$\202@&\225 <HU\f\215\305\240\0219L\215D"
+	.ascii	"\240Qp\210DJ\225\200@\r*\f\221J@ N\223\304\"\020\210\203i\320"
+	.ascii	"\b\b\304C\026\210I \020\247 <\026oJ4\216`\f!%\032\211\030\231"
+	.ascii	"\232 4*C0\n\016M\b\205 dH\002U\030\226\020\n\203\2501\004\243"
+	.ascii	"\340\020\211\323$\220"
+	.string	"\250t\"\305\260\304Pi\005\n\340\b&\234\340\031\n\215\3014i$\242)0\003#\\#\321\004cR\210\211JI\233\004\222\0301\002\017\211\021#\374\260p\004\321\036\351CR\211\302\206$\220\004\243 \3440M\006\223p\n\354 5\022\225\276dr\21042\n\372\206*\004\213'\224JI\250\022\250\302\320(\251D\001M\002\207B\242\n\303\022I%\n<C\340Pi\005\212\244\022\205\337PiE\232T\242\340K*Q\260)\220\003\021\025\020\001\024\n\203x\205\240\t\022%@\300\351\221>(\225\222\200G\344\212#\2410\b\"\211\034\252@D\032)`\b4\021b\203\020\034(\225\222\204\214Gb\252,\036\223C\344N\022\230axB\251\224\304\203\323\242294a<\022S\3410\035\226P*%a\030\002\215G\304b\020\210<&\215\303\344\217\361\210X\004A(\f\242+\214\202C\023\3014h\364C&S"
+	.string	"\221\216\210H@\2410\330\203\f\"\t\357\320\350H\302x$&\211*\f\221=*\f\215l\n\034\321\200\324HT\242\305\240\n\310aj\034\341\310H,*%\005O\b\205A!\022%@\020\n\203\270x<N"
+	.string	"x\016\205\306\f\244\311\340\020\003)\bF\3034h\244\244\201\342P(\004!I\334\220\0029\020\221\032\211>\236\024C#`\nt\244\017I\2444\230\004\302xLJ:\n\001\360\201_\007\252\007\352\006*\362\230\n\207*"
+	.string	"\225R"
+	.ascii	"\225< \324\025Vh\025+\364\212\025\232\205\025Z\205\212^\241\242"
+	.ascii	"YP\321+V4\013+\232\005\026\372HD?*\r\221 \322\343\021\t\202\347"
+	.ascii	"\036x@\002\003\r\224P\001T\370A\231D\004\221\"\035\021\213)@"
+	.ascii	"\030\211\301$\020Bd\022\304\007\r+T\025uEe\241\376\367\375\300"
+	.ascii	"Z|\230YX\336|\234k6\215S\221\265\257[\207\353\264iV\351q\317"
+	.ascii	"~\314\366~\350\3618\233&\320f\312\313k\t\020\235\226\327T\327"
+	.ascii	"}\341\305l\016\026\337V\222\255\027[\327H\007=\036f;\230F\226"
+	.ascii	"\224\354\371\264\332\214\006\0139j}}8|9\356\323q\237\216\366"
+	.ascii	"\351\260{{\270\311\230(\370\376\276\033\367e\265\231\261\343"
+	.ascii	"F__\r\237\r\261\260)g\236F\215\021\273\267\262\276>\032>\254"
+	.ascii	"\2570"
+	.ascii	")V\276\346wVzG\364\352f\314q1&\207\207\214\266\251\25031\037"
+	.ascii	"\f\346O\234\2312t}\277a\016\372\373^` df\330\254\230\366H\024"
+	.ascii	"%e\2540\022\037\232\036\333\213*\246\357\306\032\2149.l]\017"
+	.ascii	"q1$\217\252k\240R\324\310IMY#\315CN\023&):\031vW\342\372\276"
+	.ascii	"6}QbWJ\215/.\250K\344\347D\357\214\216\247\263\035){l\354|N\330"
+	.ascii	"N\213\032\275\276UU@\264|,\356\02001SJ\3722y\334rH\211\321\327"
+	.ascii	"\227}\331\267\304\00161\212~\337\362\276\2456\236-[\332\3006"
+	.ascii	"\310\241?\336\273`X4\260\3249\311l\351@3\322W\315\361\235\032"
+	.ascii	"<\307\316\365\344\245Y\256\362\251\215\t)\362#\265f\313\253\205"
+	.ascii	"\3439\307rFl\3604F\036hh}q\234W\037xhO}\217\341\374\210\330\255"
+	.ascii	"\325\351\213\365\030\200#\316\2169}\361\233\247i\2527$8\372\342"
+	.ascii	"\274\257\361Y{\362\225\345\346\377\317\306q\3151\365\305lp\233"
+	.ascii	"\332|\027\214w&\320\317\233\223\224.}\277\301\f}}\027\274\202"
+	.ascii	"\372.\030\257\371\275\345\360\332\352{\337\22427\302\372~\303"
+	.ascii	"X]\035\266s"
+	.string	"\022E\246w\336\355\260\363Bsl'#\r\216\026\035\025\346&\310\262\3577\374\210;\226\213\303t0\272p\341\261\266G\346\230\356\330L\315\262t1\245\f\036\203\247dm\231s\003\317\215\345\bK3\207\305,\205i\262$\314\315\301\3649\301!\225\303`0\277\027NC\3346\320\360\342\005MX\316XE\0360\023\322\246\3577Lq\341\202\317\354\320\345\223\030G\372~\303\362\312\017\207\265\\\251\234\231B0\231\350r\306*\262\340M\317\f\313\261\226\343,\037\3241c\322\367o)_\362\232X\211\311\221*\323\367Dm\320\023\245\251r\374V\005\267U\263\\\345#2\306\303JI~\302*\352\274\261(4-h\307Q\320p\333mS\316\221\025\205]\250\323\201sbD.\211Q$\t*\305\024CD$\244M\007#\025@0@D\036\025M\310I>\023@\303\214\fe\201\036E\031T\206fD$)H\222i7"
+	.string	"H"
+	.string	"\200\375/\221\321\343\244\326\377Z\025i\366\326\005\366<up\301\362X\252\036\271\343/\261\037\307\215n\303P\211\233\3106/\214oi\366\024Kz\023\204\301\335\016\370\234\177!\301\367dI,\376_\177.(\271U\236\315\007Qmz\227\006\355\022\230L\373:)4:\002\234B\374\333\031hk\0245\242\fnDsJ\020{\351\355\024\325\370\300\367*\312\325%\261)\317\331:\325\264\305\023a\301/n\3502\001\363\037\222\016\300o\356\215W\264<\\\274-9\316\267\032\035?\306\320\356\251\351\235M\327\271\002@\304\002\205\004\244\3704\365_\t\232\002\253\227\222&\335\2132\023\013\272\007\300\007\370\215|\013\340Pdh"
+	.ascii	"\366\347\376\016\313\222\242\351\313/\311OT\234i\203\334\235"
+	.ascii	"\037D\273\350\004\313\035N\024\322@]4P\005\273'\030.\275\331"
+	.ascii	"\013\t\314{\360\301o0\331\031\224\276\2032\362\262\277\360vt"
+	.ascii	"\324A\360B\005\261^\227\255\017\363K\347\266\331\206i\246\004"
+	.ascii	"\035\235u0\323\236m$)\332bk\004\270B\0348OY\334@Du#\003\237"
+	.string	"\262MT\"\314y\006\317\360,\372Vp\262\310\323\005[\005jm\336\023W&z\251\266\211\257\306\031$s\212\202\246r\225\326\0059\275\002\202$\232\304\255\232\230\017\t\204\224\275\306f\023M\202\236\353\246M\342\251\265\322$wGU\216\360\027\326\207\305\344\226\324\224\230H\225\267\221\276\177\337C\251<\370\251\246\345\035hm\317kDb\261\320/\276\0215\324\211\327\023BOk\311\344\221\237\376\243xr I\005c\\\204\004\241\266\317\366\364\023\362\277\300\221\304\341Z\350\203\026\341\036g\025\312\334sy\025\365\363\003*\020u_h%\324z\005\037\211\317\330\324.\026\023>\255\005@\004\264\341\333\326\243<n\b\320\217\303U\204\2510~)\245\013\255\303%\261\363 \372\304;\310\334B\251\037\361\002\337-\037\2515$&*'B\025\377\300\354\233\253\341\252\n\035\017\206\323\240\003^Hq\203\024\366\366M\250\026\316\365\332"
+	.ascii	"V\203X}\265\216\340R\325Iw}\257YHF\257W1\227\351~q\0220\325\346"
+	.ascii	"R\227RuI\245\005=\313\225\203\003\241\030\234\367\203\355\273"
+	.ascii	"\017\3732\301\005\300\200\264\344 K\371I\373=b,\334\036h\017"
+	.ascii	"-q\373rd\013\317\325\235:\261\313d\250\377\370\2579\267}\006"
+	.ascii	"\266J\032o;P\247\371\307\025\303\256{P\254\327C\001+,8\02392"
+	.ascii	"\321\360\022n\372\362>\216\005J\2415\213\304\334\324\251\177"
+	.ascii	"\260\264\374ha\244\235-\2573m$!\006\2248\237\327\3412[\026uk"
+	.ascii	"\235W\031\3517\206+\023\007\203\214(b\013\033\353c\220sM-m#o"
+	.ascii	"bFr\201\200\t\256\231i\336\305\262Y\334\020\207ubzx'\016\016"
+	.ascii	"\314\371\232\261\2372\333\232!\032\274#^\216\204d\004"
+	.string	"\315\215\322b\234\240|\255i\220\3438\336mG1d\021\037\224\374`9V\357H\206\307\305{\310Q&\263\260\205\203(\\\333~\347[ \013\277\232f\220\234\202Q\272]\342\024\306\2527i\023\030\265\252\374|\037xl\341|\264\306\037\021D\362\016\013(\315\371\005\207\246,\331\320\364y\224\276\330kPjP\002P\277bw\001Y\265\320\222A\022|\017\035\200K\261a(\250\031\016]\270\357/\217<&]\004G\233=V]\231\006\275\252YO\214\352\331\021-\340\033\007!\257G\240T\344Q\345\255\232+\034\005u\253J\034\361\265\330\334L\2310\023\333\003\025\007?\214\002\343\037\036)\326\263\003\002\030\352C\024\035\275\266W\017\357}\354\217\231\336\030\033\210\0205b\255\007vA\237j\200\241\276\030B\323\274\313\224\225\002\324\\\245\037@\303\2024\241T@K\324\353\371l\340\336s\241\003h@\213A\362\336\0269\344"
+	.string	"\347K\001\031 |\271\241\346\001\227\266g&\216LCw\246V}\202\354\300\263\343\347%\"\b\020Vk%3\360\305\270,d\330dR\377]\326\033\363\275U\262C[\342h\352iA\217\303\333v\264:\265c\3412\250?@\234{G\002\366\210\303<i\334>\307 \351\260 wj7\247\031\3216\021\2631\301\3531\026o\326\354{\"\005\321j4\3210\263s\231\021\003\376\016\243\334\3409P\034\310\240\321\373\352=P\240Z\325f-\b\200\277\\\026\223\201\203II\233\021)'5\230F\215\364\016\302\275\0036\271\027>\023\"{\002"
+	.ascii	"\252\245\344]I\004g\232pgE,(\n\027%\037\266\365~\365\357\023"
+	.ascii	"6\312\257\004\307\240\376\362u\266:u\210?\263]\024\215\376\322"
+	.ascii	"\257S\301\035R\351J\026U8\374\016\275+\372\007v\231Ays:\323\224"
+	.ascii	"A\250\025a\030\332\230r\031\247\366rZDj[\217\253\276\303&S\351"
+	.ascii	"\001\245eB\273\001|\214\030\036`G4\200\231b\023\246\2210\205"
+	.ascii	"V\036\207\225 \276\302\307\"\257f\3318\263\217[\256\301\f\356"
+	.ascii	"\026D\340Qa\324\311v\217H\030\333)\002\323B\321\027,Mc0\274\004"
+	.ascii	"\026\357\370\275%a\256\261fk\273\331\310\256\351\244\254\025"
+	.ascii	"\230*\320\024\234>j&\202\221(\031j\253\317\\\3149!\n\202\220"
+	.ascii	"OO\231\347\211@\016yc\254\f\003UcL\030\350\340+!E\036"
+	.string	"\355\310\246-U\320/r\350\206\020\312\006=\240\247\220\347\270\341\377\313\"`\206|\313\257\220\321c2\315\225\310\371+\375\264\3623\004b8L\242\252\342\034\017Se\260\262*\342*\225\306\217#\364\224"
+	.string	"E_1\177?\013\342<\r6\306\273\366\2555\006\325/\357O1\2248d_8\022\nE\n\324\033qi\001\263l\rl\255\375\313(\\j\240\262\343r\252Z\320\003b\fB\311"
+	.string	"7<J\3261\006u\033\376%\333\336c\036Y\310t\021\2205A\331\301\324\352\243\321\005\310T\020O\f?\312W\213\276\264\326>\364Mh\333AW\231/O`\343,\364k\243P\360\3023\202\257!\323\275b\264\001>\326\017\264\312\233\201\312E\300)\376K\250\200\235$\233\330\026\243\341\006\027Lg\202'\364K\"\032\226#1\234X\025[\246\271\315\243\310\220\301\375\232\021I_4r\300\212j\244L\273\332\336\013<7\276\020cR\240\302mn\020\341\f`\0254e\017\232\331w\330\367\343w\021\204\257p\235X\323g\035tV}}m\267d\303\022\177\251X:\251t\311\223\236\301\016\356\272\325RJ\317\254\304\245<\021\0165CpE4(\264\205\346\334q@\370\275\375>\260\271w\255\177L\277\336r:\f;\260\370\352<\363\225\0273\241/"
+	.ascii	"\305$\013\224>mo\f\310\256oB_\321\334\262\337\033\334l\246\361"
+	.ascii	"\002\253k\264\3413\254\3468\022\246"
+	.string	"\\\0364\030A)\275\272\200\327\344nc\274\177C^\255A\353\327\342C\2603\247\013\205\262\301t\223\345\016*\256\213n\016\201\345<\027\005\267\261\352\204N$h\264\024\344\030\213\337\033\207Z\006\371\273\177\250r\300\251\261\001\3316P\bb\342C\377Uy\037\341\253\rb\225\300\213W\036\020n\237\375G\004\217I\2158\2768\256\244>X\026W\017K\026\024\267#D\237\t_]\365C\217\373\250\322\307O\203\226u\306\002\003\322\236\211w\370\f\272A\351\214~+\3451\310\256\260+:Uc\245\002\303\335]\004\013\347J \255-\212\017Fh\311*\210\366\262\351\005RX\02760\272\253\265\037>\200.\213K\024\3665\214\214\034\207\256\204\341\336rt\347\030\222\312_:\271yS\363d\350\271X\362\001/!\354\3466\030M\353\342\235o\263\025\253\261\215\250Q\035\313\370*w#<\026X\rR\324\362\252\315\374>\227"
+	.ascii	"}!Z\275S\257\264\315\023\242\361fX\300\"\334p\225\345\325\002"
+	.ascii	"\275:\244\324\"A8\336\255\005i\223\227_\017*\246\300\330f\252"
+	.ascii	"\200\240A\035\334\3433\306PojPt\212'\016)\r\300\033MF\236:\302"
+	.ascii	"a?\223)I6|\004\255.L\nNk]\005\213\022\222$\363\356\333\254\030"
+	.ascii	"\355\fZ\027x\311\225\001T\333\357\257\302\274z\0055\302c\300"
+	.ascii	"\247K\207\364\371m\007\005\3673\310\002\022\225\276\\v\003\331"
+	.ascii	"\355\335\035\317\334\250\222\016\007?\323qG\325\035\0250y\002"
+	.ascii	"\345\201\235\n?\312\026\346\247\\>\202\003\226>jY#\311\322\233"
+	.ascii	"\322\312d/\310\024\330\331F\227\2407A\343&\304\237\001\036\222"
+	.ascii	"\267\032\032\035\310,Q\300\274\016<x\016v\311\247\236\022p\215"
+	.ascii	"\342\211\230y\r\247\364\224\214\001\363\201\002\f\024:\240\240"
+	.ascii	"\231`\366w\0234\360Q\360g\214\205\3068\300(T\352\021\374\027"
+	.ascii	"\035~\206M\215.Rx\230\303\t9\005f6p\221{\223_8=R\003\031X\207"
+	.ascii	"\313~8&\367\004\326\261\324\3666\240\r\263P4E\273\307~\0200\303"
+	.ascii	"\223]\277\326S*\3711tW\303,\272'cu\330\370\364f\356\266\261\215"
+	.ascii	"\360!\202\251\227\205y\246_J\2223P\311y\254\0066\312\177N\357"
+	.ascii	"\300\273F\274"
+	.string	"\276\347\347\375\272\231n/T\034\377\2213\245~\217\351\237=\373\272\37715\177V\373tr\323\013\0263\034\215!\343s!\036\243[y\333\363\220\261\311\303\004f\225\334@\362\226\357,\360\361\026|\314\231l\013\031B\337@ n\247DsK\356\306\324\203y7\234\203\237z\347\331?\357\352\033.\224u^\270\374\346M\033\304i]\262\002\355Z\204\243w\374\256\357?\371av\255Sj\003\260s<\017]\277\373m\267\337wo\303|\030Q\353Z{\026\373x\221\271Y\r\213B\216\333\307\251\326\007\334\364>\230\3113\034t\207=\341\215\211:*c\277\274F/\021\261*\262\t\001u\313\343+1v\021\202\203\222[V\374u8\333\357\236\335\273\232\320m \373\334\356\374\347\0311\316\3752\0016\200\227\267D\242?m\305\221'\260\203\300\360.jC\320c>\307\270\273T~\305\025]\265\347\225@\267\254\375\302\372\007"
+	.ascii	"\367\230\346y\036\343\207\253\035r\213\341P\376\\\343.\177\374"
+	.ascii	"<\362;\022\346Y\244oBu\f\360\266`8R\3674\347\251\377\300\310"
+	.ascii	"\033\200\350\004\244\rX\362\265\272v\323\267\276\312\317\235"
+	.ascii	"\003\266>\226\375\247\356S\335\027\230<\200\317\"F/{\037\364"
+	.ascii	"\322~\357U\337\203fO\361\337as \023\237\366\256lj\346\253\f\307"
+	.ascii	"\001\035o}\366\3365\210)\321\256\240\303\347\273\021\347\232"
+	.ascii	"\036\275\334\366\271\037\327\313~\363\276\272\223\230\221\337"
+	.ascii	"\017~6R[\350\343\344\343R\342\261\257\254~\004\364\206\022\036"
+	.ascii	"\ft\270[\366\276XO\330\372\310\t9L\266xxS(\351\n"
+	.text
+	.section	.gnu.lto_.symtab.109b7fc9bc88658c,"e",@progbits
+	.string	"accSum"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\002"
+	.string	""
+	.string	"accTimeSum"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\002"
+	.string	""
+	.string	"accSumCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\002"
+	.string	""
+	.string	"headfree"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\002"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\002"
+	.string	""
+	.string	"offset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\002"
+	.string	""
+	.string	"imuConfigure"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\002"
+	.string	""
+	.string	"imuConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\002"
+	.string	""
+	.string	"imuInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\002"
+	.string	""
+	.string	"accVelScale"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\002"
+	.string	""
+	.string	"imuResetAccelerationSum"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\002"
+	.string	""
+	.string	"imuGetEarthAcceleration"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\002"
+	.string	""
+	.string	"imuGetQuaternion"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\002"
+	.string	""
+	.string	"imuGetRotationMatrix"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\002"
+	.string	""
+	.string	"imuUpdateAttitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\002"
+	.string	""
+	.string	"imuIntegrateGyro"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\002"
+	.string	""
+	.string	"getCosTiltAngle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\002"
+	.string	""
+	.string	"calculateThrottleAngleCorrection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\002"
+	.string	""
+	.string	"imuSetAttitudeRPY"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\002"
+	.string	""
+	.string	"imuSetAttitudeQuat"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\002"
+	.string	""
+	.string	"imuQuaternionComputeProducts"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\002"
+	.string	""
+	.string	"imuQuaternionHeadfreeOffsetSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\002"
+	.string	""
+	.string	"imuQuaternionMultiplication"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\002"
+	.string	""
+	.string	"imuQuaternionHeadfreeTransformVectorEarthToBody"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\002"
+	.string	""
+	.string	"pgResetTemplate_imuConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\002"
+	.string	""
+	.string	"imuConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\003"
+	.string	""
+	.string	"imuConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\003"
+	.string	""
+	.string	"accmz"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\003"
+	.string	""
+	.string	"accmy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\003"
+	.string	""
+	.string	"accmx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\003"
+	.string	""
+	.string	"gyroz"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\003"
+	.string	""
+	.string	"gyroy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\003"
+	.string	""
+	.string	"gyrox"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\003"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\003"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\003"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\002"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\002"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\002"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\002"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\002"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\002"
+	.string	""
+	.string	"applyDeadband"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\003"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\003"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\003"
+	.string	""
+	.string	"compassIsHealthy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\003"
+	.string	""
+	.string	"atan2_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\003"
+	.string	""
+	.string	"acos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\003"
+	.string	""
+	.string	"pthread_mutex_lock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\003"
+	.string	""
+	.string	"pthread_mutex_unlock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\003"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\003"
+	.string	""
+	.string	"sin_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\003"
+	.string	""
+	.string	"pthread_mutex_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\003"
+	.string	""
+	.string	"degreesToRadians"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.109b7fc9bc88658c,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
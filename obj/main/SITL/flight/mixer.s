@@ -0,0 +1,2248 @@
+	.file	"mixer.c"
+	.section	.gnu.lto_.profile.706a235cfee032dd,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.706a235cfee032dd,"e",@progbits
+	.string	"(\265/\375``\004\375\024"
+	.string	"\004\034T\005"
+	.string	"O"
+	.string	"\332\261\223\025\016\002"
+	.string	"\002\001\002\002\002\001\001\347\235\243\203\006\036\002\003\002\004\002\003\002\005\005\002\005\003\240\342\234\212\n\004\005\006\007\b\t\n\337\365\221\232\002\250\001"
+	.string	"\002\006\002"
+	.string	"\002"
+	.string	"\002\003\002\007\b\002\b\002\t\002\t\002\002\n\006\007\f\352\263\360\321\b\016\017\020\021\022\023\024\025\026\027\030\031\032\034\035\036\321\276\302\334\f,\004\013\002\013\f\002\r\003\002\005\037!\313\206\250;\005\002\002\002\"\215\260\277\341\007\004#\224\257\304\213\n$\231\276\226\203\t*\002\016\002\016\002"
+	.string	"\002\017\002\003\002\020\021\002\022\004\005\002\005'()\350\300\306\254*\354\206\342\366\006+\260\216\270\207\006\002,\333\207\312\212\004\002-\263\233\367\246\005\004.\361\311\3712*\002"
+	.string	""
+	.string	"\002\023\n\006/0\332\201\320\271\013\002\0131\351\224\272\234\001.\002\024\002\024\002\025\002\004\002\002\026\002\027\002\026\030\002\030\00523\322\245\257\357\0054\220\236\340\376\004\031\031\002\031\0265\203\341\306\354\b\0056\316\313\323\260\017"
+	.string	"7\374\314\200\371\n\0028\322\221\266\3719\253\365\332\254\001"
+	.string	":\231\357\216\353\007"
+	.string	";\262\306\244\375\002"
+	.string	"<\316\317\221\317\017=\216\205\223\310\017>\314\311\255\300\001?\235\206\367\317\002@\206\270\257\235\016A\222\254\341\316\003B\221\260\327\363\002C\207\254\251\246\016D\325\233\244\265\013E\334\356\363\332\tF\335\372\220\202\003G\247\327\342\262\fH\254\275\261iI\321\256\205\311\017J\251\323\316\250\fK\275\225\333\350\001L\204\206\332\243\016M\322\222\235\355\fNO\267\364\260vPQ\347\373\336\272\fR\361\374\327\226\006STU\240\342\234\212\n"
+	.string	"v\250qE13S\013\232\024\206}\003\240\002\252\231\342\016\022`s3&\235\261KZXX?\2621\006\021H=\265@\001\253\375*\024e\367O8Yw\bP\367\351\256\031Aa+\004\003\002\300\243M\244P\327\275\365J:\370\2322Gz\034\253\210\323n\220s\006\2756\033vTt\\x\323\007\241\353\370v\261\3316\321\354\377Y\362.\246K\242\217ja\336l\365\211\275E%\227}\215P\244"
+	.string	"j"
+	.ascii	"\021\021\013\207lx\021\264%\013\370$\022\\\320oB\304G\244\253"
+	.ascii	"\215\266\252V\245\243\026vu;]\206\244\013\202>B\226\177\177\356"
+	.ascii	"\240\372L\232\344\212\210>\013\313\371\027\362\302\311,\001G"
+	.ascii	"\340\310\357\271\215\311L\022\3542\202F:\207\177\212=\251\n\310"
+	.ascii	"\271rN\0316K\237\366\337)\227&"
+	.text
+	.section	.gnu.lto_.ipa_sra.706a235cfee032dd,"e",@progbits
+	.string	"(\265/\375 \364\005\004"
+	.string	"bD\016\027\300\033\306\377\377\377\377\377\333\355.i\306u\227\bl\243\224\343\245L)Z{\225\276=5-E\013m\217s\303\330\275\234\212y&'r\036o\206\027\023\347\240\n\300o\340\025\037"
+	.string	",\"O8\222i\027\332\314\341]\200\250j\254\f\3708\263\300\360\214\305\005\027\303*\332R\3278\263\224\262\212i\227\0135J\330\226\033\027\003\300\206Q\255\300;\340\230&\264\232\310\300\332\225\301/al"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.706a235cfee032dd,"e",@progbits
+	.string	"(\265/\375`:\004\305\023"
+	.string	"\206\032aG\360\260(\215\001\314\007\252\306\352\336\033\222:\353\037[\362\270W\314'\354\212\354~\013\312\225\216Q~tWx+\324\301Lz+[\r\3756C\264_\254E\246\201\242\314\001\025m~\234l6\344\325\247\271X\022\311\2262\005F"
+	.string	"Q"
+	.string	"K"
+	.ascii	"\267G\366bHA\271\352\036\2456d\330N\350\007T\354Y\355\320\311"
+	.ascii	"\020\203\362\314O/\226tw\267\373\025\375B\260\206A?\252\364\325"
+	.ascii	"\262\271@!I]M\252\263\273\001\276\024mv\027\200~\236\024\266"
+	.ascii	"\273\240\017\331\343$\"t\270\316!)\341>iK\b\3264\005H\343\021"
+	.ascii	"\305\237\200\346YC\313q\0230\002\3227\351ST|\2014\036oEg&B\025"
+	.ascii	" \037`u\237\322\033\231\230k@Jk21\227\267\201I\337gH=t\257\212"
+	.ascii	"\035b\270\274$,\203\326jh7\016\\)\356.\007oQDq\363\242\006\307"
+	.ascii	"\375#m\221#e\311it#\325p<\236t\306\216\214\204h\006k\212\373"
+	.ascii	"\202[\2727\351\007\317\356\352\263IT\360\247\250\226b\202<\271"
+	.ascii	"\2179\225\312f0%r\204\210fZ\350D\224%5'\217T"
+	.string	"\330\360\005\342\311c\224\214\271\200\255\320\024R4~\023&}\251\022?K\2609\302\377\261f8\036\2145\303\371\f\241ec\361\352Rqff]%1S\321v{Y\021\362\203o14a\202\350\211\241\t\207\261\003\020\025\305\261#\203\361npaM>\341\002j\250A5Sh\206h\246\205\322r`\242!du\036\022@E=F\231\300P\346f\226\264\220a\277\003\240\367\267\353JeYt!\006'\302$9\264\301ps\254\244\225k\003\206\336\355\214%\007`\321xL\"\001\315\270\301\315K\363\364%\002\003UL\321\215*\276u^\036\202\315U`~:\201'\324\244\356\272\3411!5\232\271\375\f\201\031\301\235\361]\262\313\030\212\357\244Y^\346\tH\355\275`%v\022'\361\232\030\020Z\032\224\020\226ccz\233\266g6\234\273\016\234\360\022\374&Z\255\252\347|*\001\313\027`\253\375x\235+\215\025\344"
+	.ascii	"\2642\241\251v\020\263g\202AE\037\211\201n\275ei`\324\301\246"
+	.ascii	"\026\232y\001(\007pb\334\234\250\364!f\342\233\033]\234>\351"
+	.ascii	":$\3412c\036\202D>\222\263c@\245\t\237\016\256\206\031\n\301"
+	.ascii	"\233"
+	.text
+	.section	.gnu.lto_.jmpfuncs.706a235cfee032dd,"e",@progbits
+	.string	"(\265/\375`\022\001\025\b"
+	.string	"\262L(-pK\222\016\374\377\301_\325\200^\245\252\252\352<\275GUU\325\372\201D\372\351\322G\355\200\364\267\326\266:R\347\035\320h\355@\232\224)\037\365\032\322b\250BQ\314\345d\234\f/&>\213\205\247a\022\021\0171\320\223\364\036\262\017\016_i\230\341T\243R\322s\310.\374\364K\257\360\t\307\213\221\027+\307\350\263\326Z\237jAoR\006\220Ex\202\003r\220\033\020B6!So\360\025\b\3770\211\345s?\022aF\023Q0\024\f\257\303\332\377\t\300\322\264D\345\301'\266O\366\032r\201k\001* \240\002\t\352\316\003&\212\274\001\354\023\260\177\315m\304\210\370G\212h\347 \f~\354\352\327\252^\326\317Z\201\2319/f\305\033\\k\265\200|\020A\213\221"
+	.ascii	"\261\222\330=\200K\245\3231\263\t,\006\230\214fclB,\230\223\373"
+	.ascii	"dc\210|gG\013\210\203\330N\2046\360\213ie\b"
+	.text
+	.section	.gnu.lto_.pureconst.706a235cfee032dd,"e",@progbits
+	.string	"(\265/\375 M%\002"
+	.string	"\322\004\020\031\220G\215\001\307\200\314\314\2147\305\343\343c-Vi\005\257\031\257\035\330\333d\216\360\203\033\274\340\004\037\270\300\025P\001|r\311#\017\362\036\317\361\032\025\343\213+^\242B\334\360\302e\207\231%\002"
+	.text
+	.section	.gnu.lto_.ipa_modref.706a235cfee032dd,"e",@progbits
+	.string	"(\265/\375`\277"
+	.string	"m\006"
+	.ascii	"2\310\032%\220E\031\016\217\357\356\2720\004\344\356\356\356"
+	.ascii	"\356\356\375\255\375\307\245/\377\244\331\306m\300g`\336\001"
+	.ascii	"\354\320\020)SO\030\211\222#\220\307\216\006\217:#\250TR\031"
+	.ascii	"\213V\336\332\r\257\263PN\350\242(\023\320\204S\356 \376\340"
+	.ascii	"\224t\237\367\017\004t\256\374)\233\346iY\013\232\257\305f\354"
+	.ascii	"\371\023\033`\336[\373+W\025\036\230\224* `\202A\206\305\003"
+	.ascii	"0\342\023EEXG\n\241\265\211vyL\261\321\016\274 \336\341\266\216"
+	.ascii	"\237s\321\205e\303e\215\334\307@\276\\\035\254<>\004f{N,\221"
+	.ascii	"s\300\246\313\002\371\320\345\230\251\301;\334\204QgO>\023\215"
+	.ascii	"1+\272\361c\237\210\027@2\260\360\340\360!\210=ZP\343n"
+	.text
+	.section	.gnu.lto_.lto.706a235cfee032dd,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_mixerConfig_Registry.67.706a235cfee032dd,"e",@progbits
+	.string	"(\265/\375 \223M\004"
+	.string	"\264\007_"
+	.string	""
+	.string	""
+	.string	"("
+	.string	"\005\001\212\001\206\200\200\374\342\303\275\251\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\336\006us\350\366\005uq"
+	.string	"\005\001\006'\001\002\024?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/flight/mixer.c"
+	.string	"\004"
+	.ascii	")\"\301$\016\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_mixerConfig.69.706a235cfee032dd,"e",@progbits
+	.string	"(\265/\375 %)\001"
+	.string	"\030"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\177\001"
+	.string	"\005\001\006\035\001\003?\202\210\200\020}{\274\001y\273\001"
+	.text
+	.section	.gnu.lto_motorConfig_Registry.73.706a235cfee032dd,"e",@progbits
+	.string	"(\265/\375 \225E\004"
+	.string	"\244\007a"
+	.string	""
+	.string	""
+	.string	"("
+	.string	"\005\001\212\001\202\200\200\374\342\303\306\241\025\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\327\006us\250\364\005uq"
+	.string	"\005\001\006'\001\026\206 ?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/flight/mixer.c"
+	.string	"\004"
+	.ascii	")\"\301$:E\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_motorConfig.74.706a235cfee032dd,"e",@progbits
+	.string	"(\265/\375`@\001M\f"
+	.string	"\306TOA"
+	.string	"Q5\035\230%\254\330\324\036\324>[\341\027\034\316\301s\334\246\023b\366\200w\227\037Rd\307\030\252\323M\3063\270\265\330\205\331\376\377\277k\210\340\353Ou\b\372\264a4\r\035\252\321M\202\366N)7"
+	.string	":"
+	.string	"A"
+	.string	"\006\\\200{f\362"
+	.string	"\264g\334C\264g\036\355\033'I\373\023\241\f\252rw=\352a\234\343\347\350\337\304% \221\347sS\260\273\236 \321\206\233\3366\001\333\007\354\263\002~G{\306@\203\213\203)\307g\306l\3223i\007\373\221\335]\323\221\375\323?=\022\224JX\200\024\273\241\330\216ue.Bt\266?\355\233^b\374\251s\220\335\221\214\325.\031\235\250Un\257\357\253\311\326\242\365\261zp\026\342d\253A\343\257\232\r~EU\321\211\2301\202\272$\034\2058\340\345\315U\023\236I`\254\222\003qQ\263)<%r\273\213\300GY\270@!}x\026\231\017\243\251\013\302\312\251`gK%\274T\370@\217\343 \363A\300x\232\257\001\350Y\302\215W\021\340\032\341\022z\234ZC\257#\367\221\245#GH\224t\340\370P\f\366\3451*\005\206\004e\203\2462\177\021# "
+	.ascii	"\203\0219z\342C\003e` <\313\325\026\016#,9\"\326\016(!\270;\312"
+	.ascii	"\200{\223\361\301\336\037\251\033\020\367d\260\017\264\335J:"
+	.ascii	"\214i\345J4\343\302\252\222\214\223\206$4\323y\037@sL\211|y\321"
+	.ascii	"z2"
+	.text
+	.section	.gnu.lto_customMotorMixer_Registry.78.706a235cfee032dd,"e",@progbits
+	.string	"(\265/\375 \207\365\003"
+	.string	"\004\007S"
+	.string	""
+	.string	""
+	.string	"("
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\303\356\301\025\006yw\350\345\005yu"
+	.string	"\005\001\006'\001\200\001\0040sq\300\001o\277\001m\276\001k\275\001i\274\001g\273\001"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/flight/mixer.c"
+	.string	"\004"
+	.ascii	"\\\205\240r?h\2227\200\""
+	.text
+	.section	.gnu.lto_mixerQuadX.85.706a235cfee032dd,"e",@progbits
+	.string	"(\265/\375`\335"
+	.string	"E\004"
+	.string	"\362\305\026\"\200M\032\003\340\b\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\253\006\226\341\336TTJEB&4\023\300\023lX\261\022w\222\0017\344\310\226/s\fG\005D\007\367\344\037\035jc\360L\256\3217-I\360IN\321+\f\260 \260\232\2017r\207\376H(\006\273X\007\006\275w\251\355.\302\352\276;\n\022"
+	.string	"5\003\303\237\301\310R"
+	.string	"\346{\317\212\034,\001\024"
+	.ascii	"\337\001\306\300h\220\305\200\004\360/u\030\006P\212\234\027"
+	.ascii	"\203\3471P\004"
+	.text
+	.section	.gnu.lto_mixerTricopter.86.706a235cfee032dd,"e",@progbits
+	.string	"(\265/\375`1"
+	.string	"-\004"
+	.string	"\244\005$\001"
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200$"
+	.string	""
+	.string	"\200\254\325\252\001\204\002\200\200\200?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001\005\001\006\025\001\002\244\304\001{\303\001y\302\001w\301\001\252\311\001{\310\001y\307\001w\306\030u3\312\0014\305\001\300\001\277\001"
+	.string	"\020"
+	.ascii	"5\002s\237\341i\b\b\335\200l\034\214F\016f[\bC\347\203\311x\006"
+	.ascii	"\022\203\340r\276\206\363e\234\030\226\300\007P\004"
+	.text
+	.section	.gnu.lto_mixerQuadP.87.706a235cfee032dd,"e",@progbits
+	.string	"(\265/\375`\251"
+	.string	"]\004"
+	.string	"\022F\027#pM\322\001\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\300\022\002\027\266\241\343\275\r\377\377\377_\327\300H_\377m\242\221$\003=\262\344\313\230;\205C\204\203\307\376\334 \274:ck\356\r\316\241\326\304\246\334\025\334\022\035"
+	.string	",\335\260\035\367\003\207 \022\202\\L\006E\333U\235\355\2422\247\301Rog\004\021"
+	.ascii	"5\003\217\237A\327\032@\331\007,\326\342\003\223\001O\300@4d"
+	.ascii	"\200U\001)4\200\251\300\001\246\020\352%9-\006\317c\240\b"
+	.text
+	.section	.gnu.lto_mixerBicopter.88.706a235cfee032dd,"e",@progbits
+	.string	"(\265/\375 \275\375\002"
+	.string	"\004\004\260"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200\244\002"
+	.string	""
+	.string	"\200\001\202\200\200\204?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001\303\001{\302\001y\301\001w\300\020u3\304\0014\277\001"
+	.string	"\013"
+	.string	"5\002+\234AN\005\276~\360\242"
+	.string	"\230\300\205\2343\205\022\fGD\226\023\007"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_mixerY4.89.706a235cfee032dd,"e",@progbits
+	.string	"(\265/\375`\251"
+	.string	"}\004"
+	.string	"2F\027\"pM\322\001\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\300\022\002\227\221\006\213\373^\377\377\377\277j\202\231,\336\203\372$\311=\262\344\313\230;\206C\005\204\347\376\340\240|jgn\r\276\3119\222\232\334\024\274\222[\032`A\340u\343v\340\217\034\222P\f\330\":\264Y\253$\306\242\251\255\"\274z;#\023"
+	.string	"5\003E\234\001\314\347\260#<\204q4\334hlL"
+	.ascii	"\363q\325\031\214FC\0260\037\305\216\300I0\007P$\347\273\270"
+	.ascii	"\347,\213c\240\b"
+	.text
+	.section	.gnu.lto_mixerHex6X.90.706a235cfee032dd,"e",@progbits
+	.string	"(\265/\375`\247\001U\006"
+	.string	"\302H )pO\032\003\374W\202@\216\253v\362I\257\277\376\372\370\277\256\377g\2224\350\336&\377\377\377\327\217\370^,\251D\034i;\311\273\344\311\2303{\376<\232t\352p\313\220(\250\344\335|Eg\305Kr\323\374DG\305\250=\220<4\347\350\"\200F\276\231s\350\035\314\325\275b\255\031F\221W\346\026\372e\333\340\202\300p\207\3741\207\320#\212\305\24022\304\356>\356\272\373\264Z3\302p\337}\215\036"
+	.string	"4\204\200\202y]\373\002\376b\\`2@\013\370\007\006\203\241?\307\031^\340"
+	.ascii	"\254\013\003b\215\301\335\024\300I.\224\341\005\202\300\272`"
+	.ascii	"\300\301<4p\001\376\222\204ar~&\224\006\226#9-\006\304\017\240"
+	.ascii	"\b"
+	.text
+	.section	.gnu.lto_mixerHex6H.91.706a235cfee032dd,"e",@progbits
+	.string	"(\265/\375`{\001\315\005"
+	.string	"\"\210\035&`W\032\003\017%=\202\222\237C-\016\271d\031\f\243#\t\021wi\221[\024E\313"
+	.string	"h\244\240\200\307\375\261\223\f\371d\312\2315\177\006M\272\264\n\361\353\2600\254t\326\336\202\273\264M\372iG\301S\232\013\351\242}\203\217"
+	.string	"\033\235\263w\340\236L\013Tt\313~\201c\336\003\301\357\207\016\331#p\t\243A\210\016,q\314tY\214\330\226\231\256\360\3133\235\"\033"
+	.string	"5\002\303\237A\303R"
+	.string	"\346{\317\212\034,\001\024"
+	.ascii	"\337\001\306`t\035\262x\216\004\245\007.`\004\232\f\200\362r"
+	.ascii	"\332\001\346M\205\031\f\355\004\0130\n@\021~,e\005\216\340,\212"
+	.ascii	"\017\240\b"
+	.text
+	.section	.gnu.lto_mixerHex6P.92.706a235cfee032dd,"e",@progbits
+	.string	"(\265/\375`\247\001U\006"
+	.string	"\202H +`u\322\0300\f8\021\344\270j'\237\364\372\353\257\277\202NB\002\217%\230\277o\035\202 \b\262\346Bc\336\b\240\340\217\264\235d:\345\312\2327\203\016]\332\364\n\361\353\2400\260\366.\336\222\273\262O;*\236\222\253\262\355\211\366Q\234\223\223\002\234\275\023\367\310?"
+	.string	"]"
+	.string	"\226m\230e\277\3041\362\f| \030\016\331#q\211|\262`\020\246CK\250\352kpO\325\267\315\251\025\206\272\352{\004!  C\232\352_\005\264\346u\311\003I\005\220\315\270/\nH\237\317\f\201\001\315\372"
+	.string	"\257"
+	.ascii	"\251p\360\026\200\335\r\3046\203{\017\2241q\230f\276\030w\003"
+	.ascii	"B\363\200\2575`28D;\341Y\316\r\231\203\203\003"
+	.text
+	.section	.gnu.lto_mixerY6.93.706a235cfee032dd,"e",@progbits
+	.string	"(\265/\375`\253\001%\006"
+	.string	"\202\210\037(Pe\2451,?\324\026J~\016\2658\034C\327m\273\231\004\b\351\243m\323dfff\334\311k\032\202F\264\207n;\311\272\345\313\234;\213\036}\0325Kq@\202\201h\355.\370+\016pjW\301\273\370j>\322^\202sq\2236\003\236\375\003\007\305C\252\372\266)\300\354\031\270&\276\231\330\204\301\330\222}\002\247\304+\rGA>\262\305\326E\016\334R\365iRf\2061]\365A\002\034"
+	.ascii	"V+\340D\313\204\034\031<P\320\007\223w\327g\20010\364\300d\001"
+	.ascii	"\0240.\f\314Z\006\336f\311l\357t\006\016\360\017\f\006\206\036"
+	.ascii	"L\206t\2100\247\267N)\013\312\340$7g\306\200\370\001\024\001"
+	.text
+	.section	.gnu.lto_mixerOctoX8.94.706a235cfee032dd,"e",@progbits
+	.string	"(\265/\375`\266\002\305\006"
+	.string	"\022\312%1P\253\322\030\333\266m\333\266m\333\266\215q\333\006\264m[Y\364\237e=\231\031\254\033Il\222$\233\231\231\231\211\210\362L\353\323\256j#A\204\244\035n\320\332\245M\007,\260\301\0073\334\260\304\023cT\356\240\\\3262r\r}c\347\210S\344\025\272\305~\021+\207\374A\207\330#\240\205\220'\350\n\373\002\214\217\201\234@\337\366\002x\235r\224\236\332\001\260P.\322G;\tr\004\373\232\223wt\317\376\301d$O\223Y`\334~\316U\360\275l\362\345v\316\332\004$ \300\243b\341e\002\316\315{\252\310\227\240\300w\214\215\236\305$\3707\230\321Y(O\t\377\006\033\232((\360o\260\241-\221\t\354\376\300:\203U"
+	.ascii	"\361\241C)\364\337\314\030\361\003(\002"
+	.text
+	.section	.gnu.lto_mixerOctoFlatP.95.706a235cfee032dd,"e",@progbits
+	.string	"(\265/\375`z\002m\007"
+	.string	"\262\212'0PO\323\030\017\177\322A\002\t$\004\205\005\027HI\237\355L\355f&\005\331M-I\322j\316\314\314L\331`\340Y\225\334\2526\265\254\233\bI2\370\301\331\f7,\361\304\027c\334\261\307#\223\214\302\271e\3639K\311U\364\225\235E\272$\337t\223\375\244\202>r\020=d\027\251\242\214\\C\337\3309\006\036\266I\226D\221W\350\332n19\344\017:\304\036qQ\by\202\256\260/\\\306PO\023\344\005:\266\033"
+	.ascii	"\004d\234\300\353X\316=D\204\264\035\"t9\3674O8b\344\t%  #)u"
+	.ascii	"\f_\0054\363\332~$[@<\350/1&\016(\363\024\031\243\347e1\360@"
+	.ascii	"\004a\367>3\204\201\224A\220\234p\335\003\272\301\371$\\\\\267"
+	.ascii	"\201(\031\3705\220\354\003\240\\&\307g\205v\3027\311\013?\217"
+	.ascii	"\361\""
+	.text
+	.section	.gnu.lto_mixerOctoFlatX.96.706a235cfee032dd,"e",@progbits
+	.string	"(\265/\375`\316\002\305\007"
+	.string	"\242J(3pM\322\030\251\336e'I\222$I\022C\036M\036\033\36281\302o\2532\005\324\225w\262\266VJR\376\377\377\257_\235\017\207\374\366\367\032!\215\220\264\003n\203\255\025^\370a\210)\2568c\215?\006\271\204\263\312\246\263e\222\237\350({\312!\271\210>\262\223D\bm\344\034z\307\356\001ad\221k\372\305\216\001\241%\"\227\320\263}\002J\fy\203\216\355\016q\272\362\003\035aO\210\2271\323\322\002\371\200N\260\027x>\231\027PQ\032"
+	.string	"Fm\333\n\314~\316A\361\275J\263\344v.\272\002) @\303\022\267\001n\"\220k\006\240"
+	.ascii	"\034\f\222\255 @\320\215\030\214\304\327\200\204\336\317\fa\003"
+	.ascii	"\305d\240\363\r\b\214\\\303\177\203\035\332\217\270\375\331\313"
+	.ascii	"b\355\016\315'Z\002\273\036\210[\006\035\241\353\027\300}O\326"
+	.ascii	"\331d\025\276\007\217\350\314\030\361\303,\002"
+	.text
+	.section	.gnu.lto_mixerVtail4.97.706a235cfee032dd,"e",@progbits
+	.string	"(\265/\375`\343"
+	.string	"\265\005"
+	.string	"T\007\326\001"
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\202\200\200\004"
+	.string	""
+	.string	"\200\001\317\244\376\377\377?\205\327\307\204\340\307\302\353\002\200\200\200?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001\005\001\006\025\001\003\244\240\270\275\224\204\304\001{\303\001y\302\001w\301\002$\244\312\001{\311\001y\310\001w\307\001\204$\317\001{\316\001y\315\001w\314u3\320\0014\313\001\306\001\305\001\300\001\277\001"
+	.string	"\033"
+	.string	"v3\240\300\274"
+	.string	"\031\331\fS\210Dm\013r\b@*t`0\030=G\026C\230\017\347D\351\021"
+	.string	"\005A\f\007S\347E\0178@sR=\001 \201x\201\036<\211\306\2311 h"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_mixerAtail4.98.706a235cfee032dd,"e",@progbits
+	.string	"(\265/\375`\254"
+	.string	"\215\004"
+	.string	"B\306\027#pM\322\001\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\300\202\377S\221\315\263\373^\377\377\377\277j\202\211\361\365_\313\215$\031\3751\344\312\2267\204?\003\003\347\356\340\236\274j_n\f\236\3115\324\212\334\022|\222S\332\202\016"
+	.string	"\216^\334\f\274\221;\016\b\211%\246B\233\265\213\252\332J\214M\202\243\336\256\b\023"
+	.ascii	"5\003E\234\001\314\347\260#\334\260\306\321p\243\2031\001\314"
+	.ascii	"\307Ug0\032\rY\300<\212\305\f\276\020a\240H\316wqO\2778\217\201"
+	.ascii	"\""
+	.text
+	.section	.gnu.lto_mixerDualcopter.99.706a235cfee032dd,"e",@progbits
+	.string	"(\265/\375 \275\245\002"
+	.string	"\324\003\260"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\202\200\200\204\002"
+	.string	""
+	.string	"\200\001\317\002"
+	.string	""
+	.string	""
+	.string	"?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001\244\303\001{\302\001y\301\001w\300\020u3\304\0014\277\001"
+	.string	"\b"
+	.ascii	"g\020\260 \257*\f\261\324gY\204\344d\030<\217\201\""
+	.text
+	.section	.gnu.lto_mixerSingleProp.100.706a235cfee032dd,"e",@progbits
+	.string	"(\265/\375 [\365\001"
+	.string	"\344\002N"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200\204\002"
+	.string	""
+	.string	"\200\001?\202\210\200 \177}\276\001{\275\001y\274\001w\273\bu3\277\001"
+	.string	"\005"
+	.ascii	"k\312.\025.\216\340,\212\017\240\b"
+	.text
+	.section	.gnu.lto_mixerQuadX1234.101.706a235cfee032dd,"e",@progbits
+	.string	"(\265/\375`\335"
+	.string	"\005\004"
+	.string	"\022\306\026!\200M\032\003\340\b\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f+\026\005\177\023**\245\"!\023\232\t\340\t6\254\240\374\235d6\344\310\226/s\fO\005D\347\366\340\237\\Z;\346\316\340\232|\263KI\356\tN\311+\273\200\005\201\241\031w\003w\344\217\204b\240\213\350 \255fj\251F\204!\333\354)\016"
+	.string	"ek\300\201y\360\261\260af"
+	.ascii	"T\300?0\030\030z`2\300\b\352\200\r\311\211\032x\023\003p"
+	.text
+	.section	.gnu.lto_mixers.102.706a235cfee032dd,"e",@progbits
+	.string	"(\265/\375`D\003]\017"
+	.string	"\204\026\020\004"
+	.string	""
+	.string	"("
+	.string	"\005\001\212\001\206\200\200\374\342\303\365\204\005\177}"
+	.string	"\005\001\006\035\001\004\005\001?\202\210\200\030{y\275\001w\274\001u\273\001\005\001\006\025\001\032\005\001\006s\035\001\003\302\001w\301\001u\300\031\002\305\030\274\027\234\236\374&\177q"
+	.string	"\275\312\026\301\025\274\236\364\246\037om\317\024\023\354\246(ki\006\325\324\022\350&\177g\330\021\274\020\340\246\037ec\301\335\017\274&\340\016\274\236\270\246(a_\b\344\343\r\264&a]\347\f\260&a[\352\013\254&kY\325\355\n\250&\177W\275\360\t\274\236\244\363\001\240\246(kU\365\007\374%kS\325\370\005\364\245\037oQ\305\375\004\274\236\360\245(\177O\200\002\003\234\236\354%\177M\203\002\274\236\350\245\037KI\206\330\003G3\210\0024\207\002\205\002\204\002\202\002\201\002\377\001\376\001\374\001\373\001\372\001\371\001\367\001\366\0015\364\001\362\001\361\001\357\001\356\001\354\001\353\001\351\001\350\001\346\001\345\001\342\001\341\001\337\001\336\001\334\001\333\001\332\001\331\001\327\001\326\001\323\001\322\001\321\001\320\001\316\001\315\001\314\001\313\001\311\001\310\001\307\001\306\001\304\001\303\001\277\001\276\001"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/flight/mixer.c"
+	.ascii	"Z\250\221\270#Ej?\326`\223\304i\003\021 $\323\021N\003U\013c"
+	.ascii	"\354\022\200\214i0\023\344\231.\355\245\201\240\314\202A\224"
+	.ascii	"(\221\204\376] \005\2719s\351w\230\3165h\321\2648\245\303F\177"
+	.ascii	"&\352*\240;e\300\230\262\"\333|\344!\364R\002\307\330A\220\200"
+	.ascii	"D\271\r\344\002\206\356\207\344[\f\364\374\317\263\205\002N\214"
+	.ascii	"\342M\300\027\320J=\002<\031\334I\031jV\212\026\203\256\006u"
+	.ascii	"\250S"
+	.text
+	.section	.gnu.lto_getMotorCount.113.706a235cfee032dd,"e",@progbits
+	.string	"(\265/\375 \345}\006"
+	.string	"\362K-4Pm\222\016'\243\252\022\352\242n]\200\001"
+	.string	"\202[kn\370\317\313\256\332\277\333\211\334\002\250i\241\034st\226\030M*N\254\200aX\341\321\206\265O\266L\001k2o3Aq\\\307\241\201z`p\020\324\002\307i\236\204\313\f\\El\236\353T\325s\030,\333J\330\bB\255\342\033R\021\353vL\341\301^\235\256\347\322\t["
+	.string	"F\b\263\307@\3302\276\226l\245\037\307&@BQ\3102E\231J\236L%\036\377\3471\037 |\266\212m\210.\034+\026#)\231\230k\032\265\212\326-H-\037&$\327\bT\004H\310\314\361\032\221z\353_\360\033\374\027\001\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_getMotorMixRange.114.706a235cfee032dd,"e",@progbits
+	.string	"(\265/\375 \367\325\006"
+	.string	"\022\r05@o\222\016\230.\220\300\261.V\300c\366h_\214\002\220\2214\302H\215(\376_S\335\306\325\350\256\372\036\217)\n\204kL\225\216\256I\016\374e\2555\262e\no4\030G\302\352<O\003\203\345\260\360\036,\205\316\333`\021OS\360\005\301\301\236\347\272\260\207\331\262N\204.\003r\024_\222n\227\356\350\211IX\255\324\235T\225B\027\220\001\302\227\337>\3508\276S:\321\027GG\240\221\222\240\222y\361\342\222(\224\311\307\237=\346\206T$\373\322\264y\214\272bQQ\322\222\231/\323\201\252\324T\201\252\224\353hV\314nG:\201\234\260h\241O\021"
+	.string	"!3G-\204\321]\177\203\377\340\337\b\b"
+	.ascii	"2\003\346:\203i\b\3055q7\002k!2qWL\355$\003"
+	.text
+	.section	.gnu.lto_areMotorsRunning.115.706a235cfee032dd,"e",@progbits
+	.string	"(\265/\375`\f\001\205\r"
+	.string	"\326\331\\D"
+	.string	"\221(\0358\026Y-\305\"\300\311\206\275TH\351:*\235\007\377'\033\274i\273\257\270$\006\231Q\323-\003#\030\366\f\362by"
+	.string	"]\325\"\332\241\376\276\253\fC\322\325C\027\367\355\207\2214\262\267\224)\005I"
+	.string	"F"
+	.string	"I"
+	.ascii	"\263\324\321r\"\305q\351\002\330\245;\016|\354=\344P:\212i\264"
+	.ascii	"\2221g\250\355\006O\275\307U\317\307x\304\020*Z\244\017"
+	.string	"\364\210e\370\006\370B1\233s\036\274\226|\"U\214\307\234\323J\3720\334\362\266\027\330V`\337\013\266\252\345Uw\334\247nU\3651\006\\N&(\032\226E8K\255\032\323E\242\360p\325\237\272\332\267/\302Wq\346#\036~\2562K&\n\347\367\240\2055\023`\227\331\007\\\227\361\002\256\177|\320\231\247\274\f\024\006\243\025\345x\334\022\033S\273BGO\322\335\005\035\301\313\212\016\273(o\\r\017\036{!\321B\2444\374o\\_\271\326\221)\364\022_\211\370)\2660\242']\372#\253Iyq\002M$\332\262C\220.\n\306\nD\n\357I\333C8\033\207#\342\240\323q\036n\003\300\037\232\016\344\302\266\321<\022B\266\t\0214\316\006a\243}t\035MC\300\034\005\220N\363p\\\247e\302\371=\361\3017pa2Z\321\337\273\034Ww\2751>\260f\260H6\304\022\027\345\253\234\201\211S\026"
+	.ascii	"r\b\370U\323\240\006\226\342r\016\254\336\025\201\0232\343\032"
+	.ascii	"\215\220b\202r\315\020\204\b\200\212}\013\007\200\tX\255>\214"
+	.ascii	"\205D\021\035*\242p\227\0305\344P\223\267\253\224\001"
+	.text
+	.section	.gnu.lto_mixerIsTricopter.116.706a235cfee032dd,"e",@progbits
+	.string	"(\265/\375`\034"
+	.string	"m\007"
+	.string	"\342M25`m\322\001@\203\200\314J\006!\265Y}\203\273\275#\250\017Z\330t`\315\242c\235\252]\ra(xkY"
+	.string	"\240H\213_u\rA\254\007/\221l\"eJ\001\266X\360Rqa^\346\301\341\202hx\021\027\003\346Y\340\304\263\b\214I\\\340\313`\030|U\334O\253#\325\002\217~\234zU\275f1\220\277\206rz\275F\372<\344\"\032\237\303\024\233\374v\347o\250;\247\001\027\236,\331\261\223\212a\177Z\035\331\231vNk\372\224\200\be\301d\027TZ\331\023G\352\260\315\261+#$p\234=j\200\276\361\241\221\250\354\306\247\031\317\236\231\177\220;\217\222\224-\324y\002(\354\256s\013\211n\275m\003\333\007\266G\002\r"
+	.ascii	"2\241\215\037X\307\304\2028p\231L\242\021*\020\327\3045\004\225"
+	.ascii	"\237X\202\345p\315\231\204\371\004"
+	.text
+	.section	.gnu.lto_mixerIsOutputSaturated.117.706a235cfee032dd,"e",@progbits
+	.string	"(\265/\375`\317\001M\021"
+	.string	"f\341sF\340\360&\035\330\013\371\303\364+uP\033Y\201\032\343W\201\327c\021\256m\367'\231\365"
+	.string	"D\352'8\016\276\335F]\365\212Em\356\352o\306\213\030\0041\314a\246\272#\013Y#i\232k{\004\251Q\333{K\231Ra"
+	.string	"V"
+	.string	"b"
+	.ascii	"\273\005<\340\343\320\344%\361\360\235$\036\332\266\201\0031"
+	.ascii	"n\235\246S\363\035\0231\022L\2734N7\274\365\b\237f\313\227y\224"
+	.ascii	"\340\242H6\2639\2043K\257\245\0223\233\277G\300\006\n\035%5<"
+	.ascii	"\262m\006K\035\231\315<\223\335}\320\223f\366\312<\245\354\256"
+	.ascii	"S6\243p\237n[e\033\201\235'\001\326\034\333i\021\247C\234\336"
+	.ascii	"\234\006q\032u\332\177\202\351x\240\3779\235\232\376\310}>0\335"
+	.ascii	"P\260\264[\323\324c\225 \222\007\333\367\207N\364r!\237@\304"
+	.ascii	"`\332\335\355\305\336\016o\307\330\233m\245\271\246\242\005\312"
+	.ascii	"\307\2413\355\217\370O\314\201\234d\324n\006\243\023\033n\320"
+	.ascii	"\222\227\241\024\200\205\013J0\225q\212\037\021:\257\025E\364"
+	.ascii	"A'\021\302\201\203\343\305\214\020\335TD\037\253\020 \344_\305"
+	.ascii	"\250\233>\206\364\312&\373E7Z\371\034\034\201\225\227\035\372"
+	.ascii	"\254x\030\365DO\026\035r`\370\271qeS\356\256\214\336I\361\351"
+	.ascii	"\rO\210!\031\260\344a\323^\251\032\354\277\335\335)\027\225\004"
+	.ascii	"\335\252\353R(\226\nF\345y\005\245K\301\250Z8\027\006,*\007\013"
+	.ascii	"\270\007*\225\026n\245cq(\002\274\202\220\3528\227\325\252\343"
+	.ascii	"6\232\353o5\307\337\3413\001\202\240pzj<\224\246\322\250S\\\372"
+	.ascii	"\212\256\335\t\333u\235\\A\3641\240\243\327\\c\361\221\217\342"
+	.ascii	"\341\365\004\203F\217\356\b\025\255\200[\236\324\001$ \200\002"
+	.ascii	"\031\2622\017^\204n\2238)\004Rh(\213\356\265X\033\"\300\003W"
+	.ascii	"q>z\34304I\367d\341\2558\013\363\312\r\224\261Jg\357u'X\211\264"
+	.ascii	"u\200\264\025a\220H,\255\214\211a\221r\204u\215\007\224\302\307"
+	.ascii	"\231V\016x\261~\327\242%7\001\353\001"
+	.text
+	.section	.gnu.lto_initEscEndpoints.118.706a235cfee032dd,"e",@progbits
+	.string	"(\265/\375`\220\004\345\030"
+	.string	"&k\227K\240\226U:\305\237\374\351UO\240\371\251K\232o]J\301\027\364l&\006\365\005\212r~\030F\244\0018\304\002m3\351\264\223[\254h*O_\275\032\327"
+	.string	"\254t\244\311iB\265\243\213\323*dv\227\\\321F\2405B\266\2242\005t"
+	.string	"v"
+	.string	"\220"
+	.ascii	"\224\017c\376\253\371.\346\2474\337d~\253\371,\346\257\232\257"
+	.ascii	"b~\331|\222\371\264\371\315|^\376\nX&_\324\022\nG\265~\230\202"
+	.ascii	"R\213\244\216\024\377\327\374\355O\262\300\023u\221\202\354\202"
+	.ascii	"Q\265\326Y\233\330\333\222\264\371\366U\331\260x\275\240%\205"
+	.ascii	"\226\266zB\333\257\236\216\322\324Z\267h\331C/\307\254\262\251"
+	.ascii	"\265\236y=\020\373r\3773\370\037\340'[\001\033<\361Kt\235\017"
+	.ascii	"?,\227"
+	.string	"\\\036\024wwG9\237\276\2634xV\265\352\006|\201;\203\366%Z\362\027j\344\267V.\311\355\nqt4\302\361\024\327Z\203\372\035\312m[\r#:~\362\025\323\324\335P\376>\034xy\333/\037#\212\272\016\372\2019\356\022\377\322\332C\177\363g(_F\3712\315\217\241|\030\312\177a\276\013\363c\314oa>K\363W(_%\346\311\264R\204\200J\257\300\032\246\264_*U\232\0029}9\236\372\253a\275;\251\002\3334d\215\006\016\334\334\224K\276\332l\302\343\347\022\202 \245]\335\306\004[\f\222\322f\023\361h\002Q\320j\263\033\311\202\375\341\243\325f\023\342\217\325\243\301\252Y\335B\007\313ci\325\3469$U;r\312Vu\033\037l\016\245\262M\027\302\243\0219\244MB\330$\034\213$a\002\016Ni6\t\177\224\270O\036\323\325\212\003p\224\243\272\221\004#\252\373k#\327\251\261\355"
+	.string	"\321j\263\037\013<4\f\025f\031h9\265\231\216\315gV#{\217\206\035\333\354\247\247\30763\201\270\355\241GpR\304u\3563G\025\262\236i\272t>\311\364\022YY\357\351\313\311\364\256pb\332I\30589\221\005L\3074\025\236O@\"^\032\246\367\245\227\211\023q'\345\302\244E#q\351\325ad\352$\021\353\357\222\205\272\275\270\375nE\267\242r\3116\362\240Z\232\245c]\006O_.\306*I\322\322\033D!c\2178\261tj\250a\\$\22121I\031\245Bk\360\002\0211\342\006\0208\310h6)\016\003\3440\201\344\005\034\nH\352\371\367l\277\312U\224\343=L\024\261\t\027C\002\340\376~\026C\310\215;a\3779\354\220\271Lc=\250&\315\356f\027.M\233Gw`\353\330\300E\356\351\326\331\342\311\313,"
+	.ascii	"\222VD\313\234}\375[\016b\257\2102\277\235\250 H\0314W\376$\353"
+	.ascii	"Q\344\277\221\364J\351 )\346\330E\315\357\316\231\204H\364b\001"
+	.ascii	"2H\024\371Q\214\002\320\027\220\301\023\215\001\20722sn\217<"
+	.ascii	"\214\220\214*hB\271\200\035l~\247\247\301\336\374Yr\320\367\372"
+	.ascii	"L\f6\271\321\254\006"
+	.text
+	.section	.gnu.lto_mixerInit.119.706a235cfee032dd,"e",@progbits
+	.string	"(\265/\375`\022\001E\r"
+	.string	"\326\330YC"
+	.string	"\223\223\016X\335\264\001\261?.!\237\203}X\200\350i\001\301\353\033k\235\260\337\317fO.\270.h\203\261\020\373\021\260yD\033\266\200\021\001\204\202\002@\205y\017 \372,)\203!\215$\356\275\245L)E"
+	.string	"B"
+	.string	"D"
+	.string	"\"\361\360}@<t\310\326\361\016f/\2434\252\371\261\273\230\242x\350O3\344\337t\213#\255\374\271\\_\002\234\031=\002\220X\236H\313\n\356\246\347\006\322\226\031\302`w\235\034\251\303\ro\273\201\355\005\3669\004~\351\316K[/]i:^\346\327\313\200\210\032%>v[RA\026\005oX\3703\247Qyg\375p\303\305\356^\207\266\212}\035\376\262\375\264\037\363R\3502 [\273&blv;\005FP\035\036x\004\254\037\024\243V\372\321\315\226)\307\210z\232\347I\005\217\022\245\020V\332\031\206<\347<y@m\272bU\037\306k@~\n\237\244\344\271C?%\036B\0344\200\220\020e\312\356\266\324\023\366\337\356\256\365\305\001\236\b\231\003\313$#\232G\303\307\004C\2410\341SA\002f\341\003\301\004#\321N\260\221\002\316.x4\f%\3134\354\352D\177\253/~0\002%\322\355\225"
+	.string	"8\2018L\016\216\215:C\354\350M\027\360\242\305\314\016\0339X2\307\226V\332\321\217\\\002\031"
+	.string	"`\2212\023o\222\206\333\032`\322\254\020e"
+	.string	"\332\005\031\203\t"
+	.string	"W(\263\373\325\330"
+	.ascii	"&\240]2\277\202U`\305\351\256\262\260\\\0066\025zP\321\210\325"
+	.ascii	"\025q-O%\344\224B\355\001"
+	.text
+	.section	.gnu.lto_mixerConfigureOutput.120.706a235cfee032dd,"e",@progbits
+	.string	"(\265/\375`\244\n\2055"
+	.ascii	"\272Z\300\023E`\336Q:\377\337\214\302;V,\342\r,\257J\270Dym\303"
+	.ascii	"\277\300\376xs\037\177\336\346=\327\2431iE\272\006CLqJ\2160F"
+	.ascii	"6\007\203\372\374Bx\231xA\237H\267\221\252\274h\375F\b\331r'"
+	.ascii	"\031*\001\026\0013\001\377\302\273\342\237/\3467\371f!\330\340"
+	.ascii	"\356\345N>\031\363\272\fu\274\311h\023n\331\\\327\225\3670~\227"
+	.ascii	"\213\235\213\216\217q\032'\342\330z\025A\316\255\031<\312\bt"
+	.ascii	"G\235\016L\217\336\377\322\243\314:\230yGQ\336\220\271\355c\\"
+	.ascii	"\353\311\2601\226\301\255\353*\354&?#\225u\277c\347!tx\244\337"
+	.ascii	"\221\221\257\b\330#\032\342%\t\355tj\212\336\266C\276*aw\274"
+	.ascii	"\332q\244.\262'\366\267\205\005\345GI\316\270\254\221\223\373"
+	.ascii	",\224\02799\3606-\337\b)\020\305\366\256\323Y\222\245%\272j\217"
+	.ascii	" R\016\025\310\355\314\305\030\261C\252\204-\254#\347\235\352"
+	.ascii	"\310\223\356/\353L\355b>@\201\232\025\245\024+4`\t\226\362\273"
+	.ascii	"4+e\226\325]\265\312J\355iVH.\324\036=\312\233\365\260*\225\""
+	.ascii	"Oo\204\260/'\275\253\342m/_\326\334\354\003\252X!\261\350M\260"
+	.ascii	"|#\344iV\311\013\234\303$\317\325\025y\367\256\210\327i]\327"
+	.ascii	"\203\335\"\257xX\253JX\327\225\355\361\n\353\254t\346\363a\346"
+	.ascii	"\n\314;\024\001\017\303\334\341nH\250\313\037pn\240\330\274M"
+	.ascii	"\t~\327Q6q\202F\337\354\b\314\336\342\304\216&\216Z\033\264\231"
+	.ascii	"\274\004\366\003y\342\304C\264\201\016\340\313\231\2747x\276"
+	.ascii	"6\370\333H>\217\355\270\201\252\255g"
+	.string	"\363\215\264;\205\363I\264\201\330\366\273\373F!LV\351(\322\247~\337x\206\307\231\243A\241b\305\212\364\350S\363\266\332\342\222\217J\371e\216\026\305\357b)\027\366G\027\351Q\264\310\006\367Fe\0071\217\361\260\315d>\324\236\342\024n-\346\007\016\356<7\270\226\031\b\023\034\330Y~\372\230s\323\303\234\231\226t\226\225\256\345\244k\031x-#]\313\277k\371\350Z6B-\373\332r\221\316r\017\265L\224Z\036R-\363T\313B\251\345\035jY\207ZVQ\313\351\265\214\276\354|\333r\267e\333\226\017!\200\330\034\030k\3265\310 A\253\034\364\214\327\235\377\230?\314_\366\313\3743\337J\364\252\232\"\206yC\335\016+\335\0302sn(\2217\270\034\001C\260\224y\0306\344b\177,\372\001'K\016\261w\0205\223yO\336\201F\237I\30135\222\251{M\001\016Q\367\372\3069*\273\022\265"
+	.string	"<\007\264E\231\034b\352\003\375\246\036@\201XL8\331Z\0273o\270\034\211"
+	.string	"\202.\031\244\222\327\273\036\352\027\257\370\316nR\241\346\365\213UZ\250/\346\026\260\364\f2\316Q\331A\315O.\255*\336\211\256\376\034\223Z\253B\272\353)\347\223\302\341*\030X\003\244\001\270\366g\327;5sqB\315\344\277\251E\271\257\267\035\025/:\273frT\252k"
+	.string	"Y\3568\341\350\366X;G>T|\341z0\b\271\276\336\246!"
+	.ascii	"\327\272\022\241\362\234\215\303\365\360!\375\220\036\325\005"
+	.ascii	"\325\004i\021;J\213S\246k&+\323\004\315\267o/5\222\323\244K\375"
+	.ascii	"6\347\363\177\233\221*tT\005_\352\004},\266Aj\343\371\221\317"
+	.ascii	"\243\322\264\325~q\251\226\2660\313\225eX\362`\352\320\231C\002"
+	.ascii	"\300\032?\316\345\2008a\177<\221\036\305\321v\007\251\004\003"
+	.ascii	"\004\t\227\216`f\373\204\366\2278\3610\213\370\233\021\033\262"
+	.ascii	"h\021!\004\334B\352\254b\301\324\n\033R0\2045ZDI\275`!\214!\205"
+	.ascii	"\002\206P\305\024\r\341\202&\2261c\305\224\260\206\f\031SB\336"
+	.ascii	"\030\325\301^\241\217[\234\033U\363@\"\373\2016G\016\232o\321"
+	.ascii	"\203n\320\310\347\033\364\305"
+	.string	"\234\317\377\376\032\264\203\306!\307\240\357d\036\036\261[\214\246\304V\3132\207P\206Q\206^C\257\324*\261K\030\215\337\305C*\\\306\376\310e\322\243\f\372d\267`b\202\226a\311\376R\025g\346\310'l\364\t\f\276\251\221M\255\324\024|\255\324-g\234{\322L\013\233QS\013\373M8@\305eR'Y\"\001vR_6+V\231\225\004\266z\306\006\251\211\f\021\362k\244\276~\260\330+\253 \277V\317\262\304\216\032\310\017$\243\235\357\272R=\031\365Q_\271,\326\007\243\021\340Z\327\025\0023g\260F\022\001\326\326u\215c\213F\375\263[0\315\3462L\354\306\2642,\276f\262%\n\336\032\005\177\262_@\203cD\353\005\377\240\221\\\344\243\363\246\005\330Zw\356\353)\242\257U\243Y\\\262\327L5/z\262N\353\003\200\327\250a<\303\020S\246hdD\232\244\220\306\200\002\221)\262\362\022"
+	.string	"V=\210\235\031;*\025\246\375\r\001\242\n;\357\026\007y\204#a-D\331\326\007\265\300@\231\315\317\334*\347\241\026\347\256\024Z\263\267\367\2606\372\201p\317*+\243|\215h\346\226\231(\177F\262\235\026&\353\315\313\310\2220A\305\227lS\213\234z\3632\262$T\021&\360\202\336d\206R\335\372\020*'\204\026\3660D3\360\220\314<\252P\223\035a\316\355"
+	.ascii	":\236b\205rEm%\312\214\256"
+	.string	"\227\300\212;\226\263\322j>\225k\357\013>\271I\247\354\201$J`\207\013\027f\300\213\301\362\350\306\230o\3664\024mNO\317F\326\024B\310\030\302\031\222D\330-,\227X&\322\362\252j\250\331G\375@\001\303!\n\332)\007Z\362w\275P6\233!+\363\251\307\275\177\207\323\364:\036\204\330!)R\312<Za\217\257\324&\337TU{%E\343\204d\310\036\310\344L\2605\346\234\237J\241\267~\325\1777\307\251uK*!\205\201X\003\247\244\3161#\345\325\001\305]1\237V\021\373\032?\203\313\210\270(J\333q\222\273\243&4$\264 \210\201a\217\265\2650\311\247H\373$`\331#\"\2620\241\314\264\215\222\030\220`\335\bn\371\226\025\220-\177i\024\314\227\373\274\336\001B\236\372]\216\225\371\016\234`tBL\363\036I\230F@\217\274\250wb\002T\316\257\212\337\306\262\344\223\344\265-w5"
+	.ascii	"\250L\201\b\266{\345\\\365\227\017\315\323\247\230q\372r|b\317"
+	.ascii	"\017\310=\315\003\034\360\363\006%\331\306X\r"
+	.text
+	.section	.gnu.lto_mixerLoadMix.121.706a235cfee032dd,"e",@progbits
+	.string	"(\265/\375`\236\003\215\032"
+	.string	"F\261\253I\240\230Q:\020\025\317\036\3423\227\346u|H \3602\3608\333\002o\211M\020\036V\021\344^\002f$=\374\363\337\006Y\355:\2662\316\235\026^\203W\341u\230:\316\211\333\0078;!\017\230\216\355^\366\t!d\313\235R\226"
+	.string	"\213"
+	.string	"\230"
+	.string	"\265\272(Z\252\265\272\254\200|h\3400\342C\372\226\370\3205\033\312\313]\275\322\213\236#*\265\326\327\022=\370\340h\362\264\274\351\326N\216\242*\244;k~\357\023HI\357\347C\267s\222\216#L\3108\rp\212\351I\2709\266\320"
+	.string	"\272H\002]E[+\200D=\351\007\230\374\250\240\013\242l\004\275\367\0035~V\314\220\216%~\242"
+	.string	"\350FP\032)Q\202r\272\333\2444P|\217\364\351\344t\373\371\320\241\370\034#\324Z=}t'\356\226\333n\262\r\301\336\0323h\227;s\207\354\323H\301\315\360\n\331107\372[\347\335/\347\375.\367\335\254\037\335\253O\267\204\323\2529M\322\351q\247\305\235\016\3514\235\323\273\323s\247?"
+	.string	"\302\225\026,\212`\354\257\254&\202W\352\222\220\251\350\276\377(\311"
+	.ascii	"OYu\023\254"
+	.string	"\024\311A\345<|\244#7\221;?\244OI\306T\255u\346\241\037\220\017\347\312\366,\277\243v#\021\177\251U\b\311R\255\245\313/\362\241K\362\323~\216\353\250\235\347&\253\002RP$T+\344\203\020\351^\260\r\373\020\233\230]\255<\016lS8S,\200T\255<4K\027\262\201\336\310\304\373\310\366\275\313\374\222\340\340\331\302\035\362\370\2641\273N\346\314W\233s\223\270\332\363zNx&\360\264\326Z\351jc6\004p\nN\t\201\355\341@\254T`Wku\340\377\320\241\t\220\212!B|(\263\243b\233A\317m\355\356q7\\\356#\342w\356q5V\373=\322\351\0230\330\223\3056\203\273\276\022U\204\254\027\334e_v\211\210\334~H-n\001\261\323f0\235\230\204\033Y\016\355C\rK\007\206\001'\026\272\206\301\f\246\023\273y\345h\260\211q\310\360\302\211Y\270y\325\314h/\006\004,\353"
+	.ascii	"\233\275rd\262\331kU\326\257P\357$Tp\211mo\344\0169\200\217\b"
+	.ascii	"\263!\f\325\314Y\233cA\351A\251\266e\337\223\305\346\n?b\301"
+	.ascii	"\365\024\2231\242Z\327\013\236m\006?\233`\001\346F\326\302\354"
+	.ascii	"\247\254(\271S\207\232\006;\337F\374\201C+\260OrA\266\326\222"
+	.ascii	"\273A\304\245;\276\307\303\025Y\033\356\223\356\"\202\272\375"
+	.ascii	"|\323(\005\213\233\270C\376\023\004E\250Q$\243\020\204\004\231"
+	.ascii	"\td\002\2411-\264\030P\002!\307\312<\020hh\232d\031\003\021\344"
+	.ascii	"\272T\240;\326\226\035\311\217\266\361e\004ZR\266\020\313\036"
+	.ascii	"<e\321a\200\326\341\312\204\206{\344\201\"\023\374\257\330\177"
+	.ascii	"(d\021$\030[7\375\3421\b\343\277\305+\307J\204\304\202\352\017"
+	.ascii	"\002~\253\204\352\315\205\341\234\237Sa\020\024\013gGa\256vh"
+	.ascii	"5b\\\205\262#\016\005\302\245\003^w\343\355\3010\246\306\237"
+	.ascii	"c\333\032\341\3125\020\234)\006\307W\307\255\203\303D\236u\251"
+	.ascii	"\3053x\343%\024\025"
+	.text
+	.section	.gnu.lto_mixerResetDisarmedMotors.122.706a235cfee032dd,"e",@progbits
+	.string	"(\265/\375`\t\001\005\r"
+	.string	"\246\330XC\020\261$\035\333`\261\263\233a\342_.E\206a`'\354\256\267#\362\215\371\264\206\025"
+	.string	"`v[\341ak\rY\225\373O\241\365\312\234fUUU\345\033\276\256$\221\244\361\3121\200Z\026!do)S\nC"
+	.string	"E"
+	.string	"F"
+	.string	"36v\367\322\017\266\376\342\375R;|\232\232\017s\0039\272\215\023\035\276Je\005F\007\207\341\201tr:<>S8R\276\021,\327\307{\364\354l\034\313\263R\260\273\316\215\333pS\267\235\331\366\260\037\022\"\254-\366K\245;\237~E\240\346\205\205\030\273\032N8\366\006\326\204x\351\366K\370\321\237\233x\214\366\222m,\321\212e\352Z\320\330\335\217C#\260\016\013<"
+	.string	"u\370\016\200:\374\307\232=\343\021\304\276c\221!z\322\263\203\342\201\224'_m\237\334\344N\200\214\335\005\3713G!\301\1779\364\004\023\223\255\306(O\366O\\\306\235\377\342\n\246\311o\207\276i\364\361\007H\344\360p\030\345I\325\244\302\223B\325\305\216\242\004\351\240\004\330-\002\222\215P\300H\256\222\006\f0\007\013\256\007X\b\311%\222E\270@\0068\004a$\273JB\241\354\372\304\275\266\300\334r\241\342f\244$\250.\256V(\245\212\223\037OM\261\r\225\372\030\031\234\013y\343ow\3679\301S\251\027"
+	.ascii	"1\003\373\334q@\343\224}Yb\326|\210\342<\2042T\212\210\232\003"
+	.ascii	"1\366aZ\202v[\342o\233\030\272\220\301\352\364K\023\201c\034"
+	.ascii	"\276Q\366BU\343\375$\322\271\346\023"
+	.text
+	.section	.gnu.lto_writeMotors.123.706a235cfee032dd,"e",@progbits
+	.string	"(\265/\375`\206"
+	.string	"E\n"
+	.string	"v\023H@0\307(\035\260\364U\361\377a\273].M\334\340\313b\320\345\243\032.\204\3003?L\23084\341\264\r\"\210T\323\346T\276\205\332\036\206\201\001ReA\024\232\005{\274\002\346\215\317f\311\226;\2453"
+	.string	"7"
+	.string	"4"
+	.string	"\373\226\202\221"
+	.string	"\016vwS\024Oz\237*=\037\343\311\200\341\367\251\235\\\027B\323\334\354\356W\227\247\260$%\306\263\273\226`hrg\267=a;\302~B\017\f\016\204 \330%\211\360`\307\214\200\312Y\267\277\342\213\326\370,o\361\316r\001\355+\321\004\264^\260\335\345<3\204\366l\363\206\313\263y\206\313\263k\354\331\257\213\252\036q\310\203V\375n\361\273\204*\006SM\031\344r\255"
+	.string	"\220\300$c\236\322\366\370\220\007\257\n.\003cI?[\374\244\246`\003\026\214V\224}\326=/}-\334\375\351t\240\016.\264\2210.\270\f\213M\203\243\bm\237n\264u\034,\332"
+	.string	"u\033I$\3526\215\270W\324\352\232\253\301(\242\245\251)_|&\005\302Kr>\365dc\244\003\016"
+	.ascii	"2\003\376\031#\301q\332\341.I\361 .\343\332T\020]H\341B\277\\"
+	.ascii	"\021\\~`\224\241\206lW)\003"
+	.text
+	.section	.gnu.lto_writeAllMotors.124.706a235cfee032dd,"e",@progbits
+	.string	"(\265/\375`\354\001\245\021"
+	.string	"v\342uF\360\320&\035\332\357&\033_[\363H#\251H\037\257\f2-z\276\274\245\r\361\334\300\035\257\212\276\r=\304\rE,[LX\273\306r\245\335>\221-\\\025\021&\302\371\246\214+\265\254p\266kk\226\220\275\245L)a"
+	.string	"\\"
+	.string	"`"
+	.string	"\002\270\307\274\007\367\350\226-\3433\234\355tl\300"
+	.ascii	"\031\355\256\247\034L:\234\3350[\357\270\b5[\276\317a\315\007"
+	.ascii	"\003\026ky\207\341\034G\f\006~\320^2\302\316E\246\003G\314\005"
+	.ascii	"\222\034\331\206^{\306\304^\twd\327\327\036k\276\032,&{v\bv\327"
+	.ascii	"\t\213\315\334\244\333\226\331\026\261\323@6\225\336\363w\017"
+	.ascii	"JkL'L\237\243\204\306E\213\306\256\314\255\306\022\305!\235\007"
+	.ascii	"\335\376\314\257\371\344\2078P\353AN\361\235\331\177F;\237mw"
+	.ascii	"A\036\035Bz\374\200\007q\032\313g6\321\234\036m\026\373\364\230"
+	.ascii	"'\333\231\366?\234\247\365\236\n\216\273\033J\240\330]\021\037"
+	.ascii	" =\002xz\230\033\276\211\2378\361s\234BA\341\036S\007\304\240"
+	.ascii	"q\345\355pw\027:\344PK\352\361\363\325^4\274\362\346\253\355"
+	.ascii	"\t'a\241\016\234\335%\361E|\204\312\317y\364*%\017K\341\036\017"
+	.ascii	"\233\341\312\233;\275\276v\005?\237\320\213\315\2257\325\232"
+	.ascii	"\n\227\230\352\215={\345Ip\216lV\033\233\313\251\243Ti\324\b"
+	.ascii	"\313\204BJ\345\255<8IAp\340EH5Py(\226\2127B\300+\t&,oe\265by"
+	.ascii	"\247\231\353j\343\363\177/2\020\271\364\325\005X\300 \017\263"
+	.ascii	"j\213\013\310x<pW\341LZ\362S\324\221>\re\222\207\231\364\264"
+	.ascii	"\377B\213\025D/m\211z\343R\221\226T\213\022\344Pc\240\252&`a"
+	.ascii	"!\217\234\252\001' `\002Btz\261\300\337;\372\003+\352\200\217"
+	.ascii	"\275\255\253g\272\310\002\241\361\302m+l\255\177b\311\204\204"
+	.ascii	"r\376\254\310H\203\314h\016hY_\274\252.\267\273\353\314\036\240"
+	.ascii	"\365\210K1$$\312\365%b\264\262\342\242\024\201\026\304\023\263"
+	.ascii	"r\363\336,\023\345v\200\244l\272\326\023"
+	.text
+	.section	.gnu.lto_stopMotors.125.706a235cfee032dd,"e",@progbits
+	.string	"(\265/\375`1"
+	.string	"\365\007"
+	.string	"r\31766@o\323\001\233NL\253@t\227\331\367qo\372\204\231\016\262\207\267u\201XV\333\0345\306\344\"\030W}\036f\030F\027\301T\364\272vH\002h|?\371R\246\024\366t\264O\305\205\305\220C\303\005\301\020#.\005,z4P\354\0208\223\370h1\224eZ\264\276\275f\265\304y)\001Eja+\021\376\260\261\261l\201\004\254R\325\006M\344;\027\\(\347T\325\217f\256\251\307p9\312S\274\342\207\230\302\247|w\312\367is\352\032@2\231\220D\031\332\037\227\332a_\263Z\2625\255\231\316\247_\tx\230\274g\204\273\033\241\314\202\024\213\210\355[\336l\230\177 ;0\2421R\211\331\335\250\037\337\236\233\377\223\003t\036\367\254\022v\327\331y\034\267\336\266\201\355\003\333-\001\f"
+	.ascii	"3\241\275\037\330\314\\\260i\016\232\206\247\262}\244\332s!\367"
+	.ascii	"\031\354\277\214\013.\335\242\235O"
+	.text
+	.section	.gnu.lto_stopPwmAllMotors.126.706a235cfee032dd,"e",@progbits
+	.string	"(\265/\375` "
+	.string	"\255\007"
+	.string	"\242\01656@o\323\001\233\256\360\244\247S\321\"\247'\270\340O"
+	.string	"\267)\3212\031n\216\332\346\344\210\262\207\"\030W}\036f\030F\0275\036\275\256\035\222\200\231\260\357F\244L)\356p6\017\005\226E\020\303\002\346\240\020\0370\204,v\266O\344\fX\203\360l\021\244i[\274\300=\265Z\322\260\244\204\"\255\360&\257\225c\226\335\220%\230BM\246\332\021\237\274g\002\013\355|M\375(\346%7I\370 \236\b\345\275W~\310zu\r \241\214\220Dy\262\301.\225\303>\265Z\2623\235O\337\332|`|\277p\331\3158\301lX\251\204\330\376e\316n9\350\261\002\"\033#\223\227\335\215\332q\356\311\371'9\200\367u\317\314\301\356:\275O\343\326\333.\260m`\373$\013"
+	.ascii	"3\241\233\037\270\310\\\260i\016\232\206YT#.\214\032\203%/C\200"
+	.ascii	"K\267h\347\023"
+	.text
+	.section	.gnu.lto_calculateThrottleAndCurrentMotorEndpoints.134.706a235cfee032dd,"e",@progbits
+	.string	"(\265/\375`w\022\315J"
+	.ascii	"\032v\f\032>0\246N\007\370\373\353CV&\211\233\310\277\2043Fu"
+	.ascii	"\320?\315S\177\316j\340\035\204\221X\227\217L\314\354%\307B\270"
+	.ascii	"h\b\001x\241\334\334u\375\f\306\227\376\017\245\352!B\344\336"
+	.ascii	"2\245\024z\001n\001\243\001\\\371{+\177k\345\357,\3427\326\360"
+	.ascii	"\373*\177#\363\367\221\370m5\374\256\032~S\345\357\251\342\267"
+	.ascii	"T\376\216\312\337P\371\373)\177;\345\357\246\374\315\264~/\345"
+	.ascii	"oc\376V\312\337E\3427q\370=\314\337y\370\315\346\357\225\375"
+	.ascii	"\376\365\333\335\271\004i\213\232#\371k\333\264\302Hm\037;'\316"
+	.ascii	"\355\034\377?\356v\277kcw\333\365\324[&\355\367\001~A#\330\266"
+	.ascii	"\355\001g[\214\350\337\355f\374\314\322\353\204\254O-\332\233"
+	.ascii	"\2218mk\227\240\r\020\235M:Uvvu\251\354l/\273\003\217D\332!\016"
+	.ascii	"\276\320\025a\343\250m[%\276\342KOrmiea]!\217VUTSRQPONMLKF\245"
+	.ascii	"\"q\230\331\025\377\262}}kK\364T\033\342\311<\347\372<\337\252"
+	.ascii	"s\255\2723\237\205E\347Wte\036\251d\006L\234\242\343\234[\315"
+	.ascii	"\305}\025U\027\237\342\262\345\245\244QZ\340\036\312\017\252"
+	.ascii	"E\016\232\345\237\234\334\274\311M\016\332\366LX\326\244\034"
+	.ascii	"\224\355\227\25201\343\3065WZ\251\376\274\001\272\037tm\375j"
+	.ascii	"\343\343\304\357\274K\016*\345\213]\304!\206*L^\037\272E>\257"
+	.ascii	"_\202r\b\335\017:e\245J\353\362t>\373\304\327&5\"F5\264\307~"
+	.ascii	"P4k\262m[\277\363G\242\326\374\037bh\333\266\377\251\306\304"
+	.ascii	"\273\313\273\377@w\217\350~\022\f\206\274\276{I\267<\363\376"
+	.ascii	"\\\302\237\007HL_\023\017i#\337\022M\237\fF|\004\314\343*\341"
+	.ascii	"=\033Z\317\237T&\036\317\323S\016\255\327z\331Y%|\346\002J\335"
+	.ascii	"\256sf\016K\306\321.\342\214\313\324\364!\342\"v\247\340\020"
+	.ascii	"\023\261\027\231d\247\303\020\007(\004\346uzJl\333\026B\373\034"
+	.ascii	"\247\343\341\003\b"
+	.string	"\020\331\331\214Y\270\177\3229,\213\333\247\036GD\020\022$\330<\251\3146\341pP\020\333\026-\254\335\215\277I\321\276\305\331V\261bEv\226\305>\347\n\252\326\265m\333\256Z9\004\366;'R\325\024r\327\312\217C\340\376\"n\363\013\273\035\317\333\264h\337\322/`\260\3550\262\263\217\317\\AR\227\371\205\216\273Gv\034C\215!\264\177\324M\237l},w\323\260\361\376t\354y\200\232\364\241\341!\335v\315\307\321n\307\205\205\205\205\215\255t;\363\214\314\355\274cx\235\273\013\267\363.\301~\207\310\337\035\334\316[\203\333yg\310\337\030\362\367\205\374m!\177W\310\337\024\362\367\204\374-!\177G ~C\030~\213\345\3570\245\357\007J\337\016\212\337\r\3627\203\374\275 \177+(~+\3637X\376N\220\277\021\344\357\003\371\373+\177\033X\277\013\344o\002\371{\300\372-\200\375\0160\374\366\312\337"
+	.string	"\206\337]\305\357d\376\016_\330\375\274zU\327@\0309\003\330\241\257\2364k\272\027f\252"
+	.string	"\366*t\005\310\020\37084\317\205"
+	.string	"F\302y\007\300}\226\001\370\354}\023\301M\313\237\224"
+	.string	"\354t\367\206.\212"
+	.string	"\374y\203\334\232\324#Q-r"
+	.string	"\274\200\312\0332\357G[\204\365\277\275\225\345\332\222m\351\346\226\235\r\200]\356m#\255\213P\006\020\033(/<\244\342\205\335\313\213Wu\237\334zJ\245\365\316\260\267\275x"
+	.string	"\330\340\036"
+	.string	"\266j\272|]\277\226q\027\306.\035\247\237\177\342/r\r\236A\247\217RX\205"
+	.ascii	"\247\325k\362\344;I\026J]\256g\202\031=\251\314-\314\205\257"
+	.ascii	"\232i\211\234^\232P2N\315\264\277'u\353\227$y\333\302GIZ\377"
+	.ascii	"|#=\215\266\236\026>s%\355\375y\003d\302\321\316\302\031{\027"
+	.ascii	"5|X8\353\nc9E\\!q\205\335\213\033I\352:\\\2326x\226\320\2620"
+	.ascii	"\261\267\271\215\252.\362\231=\205k\275gt\304H+|\254\302V\337"
+	.ascii	"Va\257s\033I]\252IS\230\n\257l\234~\"A\232\302>\306%\254\316"
+	.ascii	"\361A\257\036\t\335A\243\013\334N\350\215\204\374Xr\341\222\235"
+	.ascii	"u\250\313H:E\254/\021\030%\034\365e\\\226j\247\372\242e\334\227"
+	.ascii	"%\230%\230\354\254\024v\327\035\254\026\243\004\241pT \007(\354"
+	.ascii	"v\334D\325'@C\031\236\022I\211N\204\304\254{Oj\023v"
+	.string	"\302\356\364\322\034\324\204\335\217\033(u\231\002\221\361\343\300\204\035\352\"\252~\265\361q2\304\3215\276\204\275\212\232c4p\300(a\306C\007\016\017c7\314\314r\224\325@\356@1Ff\343\204\031\216\261\2622\0362\230Z\006X\331\230\017\033dJ\263\0324l\334\230\241\304a\003\006\231RF\331\016%\330U\347\3201V\2464\313\221\243Li\264c\372\332b+\355w\356Q<\272:\256\022\270\327\255\fX\003FB\374\333\323\307\304\315\306\200\217 \201\363\244\342\"\330\211\001\373x\t\245sV\fw\347P\214\236\324\016x\305\231\260\351\375hm\313\364\272\200;\340~\347\240\006l\001_\300\356\324\323\304\255\005<\342eTu\327\344$\037\357\340\334`\205Hb0\005\\\001[5\331\n'<jj\2625\242\340\210\220\002F\006\346\2310H\235\200]\274\201RA%%\260Cy\021U%\004\356=\251\021p\030\226"
+	.string	"\001G\300,\0331\f!\355\001\377\220\030\016\313R\367\205\236P\030\006\362\"\342\302\321-\261&\313'\357\317vB\177Z8\332Y:\006+\006\316b\b\217d8\177\301s:\303\004\360\330&\031\235\2113`$M%\315\205\344\007\016\260\013\374 \220\003|\366\016\252~\333\266C\262\374\250\304\020\304'h\316Q\237@x\006\261\366\360E\021\202\024\346\252A\236\006|\f\356,\300\f\360UsM\301\336\332\002:r\026`d\037\005S8\n\360\331\333\347\256J\004\351&\013\331\235\252;\355\356\367\312c\361\336\231s\204g\007\317\340q\315\273W\235\" \020\2215+\034U\246Qbw\337=i\025\330\333%\300`_\227"
+	.string	"\273\235\267\216\024\301\233\3712\b\246U\252\003?\367\205\017\374\230\201\221\250\201H\006\2212D\"R\222\222$i\r\321\005\204\030\305\034\263n\021\3400\007\241\222\021\231I\222\215\003\026\232\232\345\221DT\023\263"
+	.string	"d\344\256\301i\240\243@\325i\f\262E\036\376h#l\244\337\"u\241\r\324\243\330\263\001\314K\3576\241\313\236}\253z\273;CQ\232E\266\346\021\233HJ\0174~9E\013\354\252\024u\230]f\212\360\3209\230\347\032\206L\233\232\363\036@C;\336\324\347\024,\366\006\te\360c\334\013\304T(\331\313=\216\r\261\303=\333\263\241M\n\237\223:@\230\370\320\303|\020\262\376\246\272=\347ww\323\210\250\317\307\320\213\360\021Z\236\2376\274\f\255)\230Q&&\004\357\2203\020\036Z(\325\\"
+	.ascii	"\374\306\234\031\361\210\027\025\341\320\033\252\024j\272\027"
+	.ascii	"\260V\t\007p\345\341\nT\204\207\314q!\312{\031\232\247X\3216"
+	.ascii	"(\372\372f:;4\343<eE1\027yr\277t\346\275\016\020\357\334M}\026"
+	.ascii	"1d6\017\353\013\346~\005P\357\\n:\343\214=\213\2379\316\244\270"
+	.ascii	"\362^e\253B[\005\300\032&\332\004\037\230\n\022\344\032&a\322"
+	.ascii	"\317bNT\b3"
+	.string	"\006\306\257M\305\210\200\261\213q\207 \2274\353\302\225\221\bI\305we9y\240N>\004\371\237\257\023q\221\246\344\235\240\260\252\361\332\225\370\257\246\2251\367X\004\213\210\243\320\322\365\372g\362\3560\203Zm>\230W+\342\310\006\004#\035\207\223\307\320<\300\247\276\247\023\261\214\213\350\271\027|v\313\330Y#\274\340xf\033\304\240Eu5a\301\244Q\230\352M\034\222\363\222\t1B\253\202v\np\034\006,\t^\207\370mE8\002\375\207\242\353\377\276\375"
+	.string	"\207\256j:E\336\035N\033\225\227k\"\206\214\355:\326\031{\223\347\001\222\211\332#5\242^\256\230r0\271\334\366s\362o\270b\237v\315\250\227\332U\256\t\020\357\374`\206\371\016\024\003\021\026\027\"F\027\225\247k\313\310\317\233\260\256\371\007\377]\2328P&\353\030\375!\263\031\026\227\273\257\037^\021R\023\313|\232\222\026\203\214\342\233\2525\374>\t\234F \325f\207\367\277\355\017\230\037\362\320\017 \242\241\330\211\360qo\372\022~\2769\367t7\245\314\307\256\330;\027?\231\360\264 \f!m`\337-I\361'\346c\370\020<\257\253C\352\220}\202\263\365+T\325\026G\207"
+	.ascii	"N\214\206\276\024?\363{\302p\270\240\017Rs0\302\372)\213e\263"
+	.ascii	"\272ov]P\233\021= C\206\230\336S+\037\370\253\250\027\367}\342"
+	.ascii	"\313\017U\002\302\215fe\016 \250\376\264\270\"a\3370H\355\373"
+	.ascii	"\246\324\031\351\357\017"
+	.text
+	.section	.gnu.lto_applyFlipOverAfterCrashModeToMotors.135.706a235cfee032dd,"e",@progbits
+	.string	"(\265/\375`\302\006\305%"
+	.string	"\272B8\016E\220\334\315p\006\345\246\001\223&\tp\002J\r\336\267\005"
+	.string	"U\326\263/\202L\n\247n\371\302\037L\2155\247\370{>X\016\221kw\365'\310\333{\n\320\342\275\224]^`\354\306\246\211\210\210\320&{\357$\223\f\324"
+	.string	"\270"
+	.string	"\321"
+	.ascii	"J\334/@\212\300``2Q{\271\211\273\232\354D\257\330\305\220H\332"
+	.ascii	"\002\323d\320\250\352$j.\305\231\264\022/i\362\026\223\317\251"
+	.ascii	"\323\204C\004\216\331y\236D&u\3104\271\247yJ\223A\336)M.\256"
+	.ascii	"I\365\314O\324\351\304\200\b\232\224\227\233\363<}\357qS\323"
+	.ascii	"#\227U\367&\357t9\334\315f\326Jr<\257\267Mj[P\350\344\235U\224"
+	.ascii	"\033\253\3431\205\303\271\032\204\253)+\343\306ZT\214 \036\223"
+	.ascii	"act\360\306\254\212\275\236\366\306c\252\312\266\002\246\257"
+	.ascii	"\246j\270F%\265%\r\2237!\r\217;a\024\230\367\205\020j\277U\346"
+	.ascii	"\371\207\303\2751\031\3031\350<O#q\001-\0319vk\020\316\363\324"
+	.ascii	"\r\n\247\2549V\265\002U}\240ZJ\bb\322\304\240\356\364\257,Q\302"
+	.ascii	"?\213w,\265\035\f\337\230\365\216\245\004J\240\033\211\315\261"
+	.ascii	"\2562\250}\2436\201\322\007\272\256\024\325\223\2458L\205\032"
+	.ascii	"\210\256XZ\007M\252\227J\223\276\207\032ihT\277-\252r9\355\263"
+	.ascii	"\314\250\254\021\323c\251\026}\365\300W\207\374e\025\n\332U\240"
+	.ascii	"\257\376\030\212\325\307N\254=\343*\317\256\002\370\352\316\270"
+	.ascii	"\252\263\2539_\355}\225\367\325\335Wu_\315}\025\367\325\333W"
+	.ascii	"m_5\277Z\373j\371U\362\253\343W\377\325\335U#\320\365(#t\216"
+	.ascii	",\347\031\243\b\347\024#\253\b1\024\373\313vboyTu\024\305\025"
+	.ascii	"\261\361D\r\246\270\257O[tM\350\275\353\264\272\270(\321:\364"
+	.ascii	"\006u\236?\003\274\367\016\264c\330\006h\305\373\356B_"
+	.string	".@\2530\034xg\340C\367\334w7P\353\213\307\224\330A\247\254\203:\2454\251\273\275\306P\231\271\227G\252\236\030\251\362\333b\211\273\035w\001a\266\233\277\275\026\366\301\\\224\350\260\341\226\020\376\"\323b\273\303|\024\231\277\233\262\031d\355\\J\034@v3\301\263\337\026\265|\355\001\322\200g\344\307\227\257y\001\265\024\204\263(\321R\310\316\363l\240\252\027\214%\204\277\206\347y:\260\342+\"\324@L\352\210\022%J\223\344-e\314\222\337\026\215\306\337\215\230\242\301\220i\0026>\353\276\352\352r\333\242\337[:nKd\325#\244upo0\353\200\005JK)\224\226(\340\214\314\302hB\022\222\022\322\221\251\"\022$\215`at\344S2Q\302\350\004\t\037\n\243\020G>\021I+|\t\004(R\212\021I>%$\244$\037\216\353\364\261\220\330-\312\266\304~\177\332\345\202N\376\350\021\331\307\347<"
+	.string	"\316\323\006\300\t\214\261\356Y\352\363\240\367t\371\360\262\3635jvM\360\354\267\305\n>S\242\231\206\211B\206\235;\212\311\033US\236c\032\317\363\352\201\267l.\347\2305\301=Kq?lE'\177\360\210\334\363\027=\327y\204.9\327\271\245\342\374\316XX\312\031\331\324\210\2036\336\236\245k\016\345`\001R9S;\360\237\277P-r\317\213n/k\350\312\201\346\347e\224\3103T\227\231\f\023\206\f\031J\223\036\252\276\320F\033\331\206\241\333\326\024\372\201\0338$\200\215\250Q8\346\220c\244FF$)(H\322\030\200\002\23192n\021@=uV\222B\215a\f\343\257\242\017\240\272)R\270D\232h\\\271\214)\246\213\267y\343\0170\211"
+	.string	"\314@\276\224% n+\344\342V\237\330\330\234sU\332r\303-z[?\335\320\200$\241\316H\247\033)\371\r;\t\360\264\2057r\\\266;3\330\207\315H\210\t!\2749\337\br\300n\344!\247L\024\2605;\230BN"
+	.string	"\276Z\250\222\200[\224\020\330J\243\232\033\001<v\224\322J\237/\277\261\207e\334\363\027\030\020\201w\016z\243\027UV{6\245\002mn\363g\033\246\263\005\016*\361}\365\364\315\347\225\357\025\002\2336\r3\311\215\3513\335|\215\rw\276r\364\276\022`.e\221\350#Y[\236-%@\026\362\242`t!c\322\216\243a#\316\351\367\024"
+	.ascii	"\374\325f\220\314'R\206\3748a\336\376\231\227\270\005w\016\036"
+	.ascii	"\247\"\242\320\375\311\251\272\343\207\250\217Yg\324\220Z\371"
+	.ascii	"\177rh\255\207`\233\271\336\331\227\255=.\357\017"
+	.text
+	.section	.gnu.lto_applyMixToMotors.136.706a235cfee032dd,"e",@progbits
+	.string	"(\265/\375`\244\f]C"
+	.ascii	"Zu\230\031?@dN:\377_\022\365>\207\330\363\366\240\2349@\025\342"
+	.ascii	"\272\2128\t\364\247qb\177D\332~\\\016\316\317\005;`\207*,\252"
+	.ascii	"\252\370\001\336h\200!\021K}\216\272\036\351\330\244\021B\344"
+	.ascii	"N2\206\001e\001\231\001Z\232\307\002\330\266F\016#\265\202\251"
+	.ascii	"\337\226\373\375m~\2757\363\377\330(\004\256.\217\234\317\351"
+	.ascii	"\3617\f\301\t\330\250\0073\037R\217\333\363\016\347\307\337\360"
+	.ascii	"\016g\0371l\370n\332p\337\025\214T77aM\303\337c\243\232\257a"
+	.ascii	"\257\307t\336\266\265\017\322\250N\316\260m\333\255\247\034a"
+	.ascii	"}\252D\1770\033\237\242Ff\376\345\337\335\314\317\260\307c\276"
+	.ascii	"C\265m\0258r\332\026\257\213\033\340\375\250>]/\245\276\fs\361"
+	.ascii	")'X\2372\313\\h\005\244-sP\027\227\266\246Q\333\266\313\276\202"
+	.ascii	"\344\365(\336\271\252\331c!\257\222VUT\307)\251(\250'\247&\246"
+	.ascii	"%\243Rq%\252)\332\227\345\023-\240T\346\372\324\232e\307\"\363"
+	.ascii	"gw\221c~5\346IT\371w\255A62h\312\\+\224\b\304\310\334\007\331"
+	.ascii	"\304\240_\217\f\375\276wv\253\210\026\254\264m9\325\334\217p"
+	.ascii	"rwJ\313\225\242\033d\313r\243\260\\\250\233\315\375\t\016U\306"
+	.ascii	"]\247\246\2673=\201\363v\227\334\\kJ\033\224\033\233\\\tU\360"
+	.ascii	"\206\007\311\007\331\234\350q\017\025B\347\273\026\035[\223["
+	.ascii	"$Z\230\322\306\344\353\351\330\334.\021U\016\2621A\225m\333\032"
+	.ascii	"\233iW\375 \233\023\346M\223\034E\025\030\316Y\324\324\004\202"
+	.ascii	"\036\215\314\251\335\315\357Z\023\355\366\367\216\242N\316\320"
+	.ascii	"\224\266-\277D\013m\333\362Uk\266\235\263\316|\271\230\031\214"
+	.ascii	"\331X\f\315\324\024\372\222\230o}J4\265W\234\333R\033\233i\360"
+	.ascii	"\304R_M\234\233R\023\333\330I?\314\267b\257\255\324\277 \367"
+	.ascii	"\245`\276b\277\220 7V\361@\356\273j\340\332\266}`\345yV|R\240"
+	.ascii	"\266m\277\356\034\017\013\276\226\247\334\302\205\213\276j\342"
+	.ascii	"\314\250}\233\330HEL\2723;d\334\267j\3413\237\372T\355\2579\315"
+	.ascii	"zB\247}\346\027\364|G\355F\373L\272\263{\310\\\335\235\\\223"
+	.ascii	"6\351}\373L\303\323y\235\027|-\f\006\343^\r\206\372\364}7\347"
+	.ascii	"\200\307\th\347fv\017{\017\020H\263\373\311\214wv\377\005\367"
+	.ascii	"\250\220\273\n\363z\331\304z\271\004\t\021K\227C| ^\366\220^"
+	.ascii	"\356\260\201xY\003\206\364\362\005\342\345\n\024\216\367O\220"
+	.ascii	"P\274\f\241x\371\353~g\006\013\226os\366z\233s\327\365\316\\"
+	.ascii	"\353\345\255\364\262\202\365r\202\342"
+	.string	"\345\003\353e\003\305\313\005\326\313\004\214\227\007\254\227\005(]\326\"^V\022/\007X/\003(^\316\"^N\256\227\261\326\313\310\364\362\325z\331*\275\\\265^\246Z/\037\323\313S\353e\251\364rTz\031\212x\371\211x\331)\275\334\224^fJ//\245\227\215\351e\245\364r1\275\274\246\227\211\351e\365\227S\3652\252^\356\364\362E/\377\004\323\230\3157\315M\322'\261qYX9VN}\232\325?\344\364\343\350|\006\245a\003\325\3177\232\273 C\236\372\311\252\035f\323\206N\352\001\026\032?\3642\211\340>\235\355\2422\263^\330\272{\265d\021=;\\\034\031\24291%\350\303YB\266\t\023\275\001=\344\354s\006H\317\260\311\252\261:A\363e&:\273\207m\360\232\364a\352'c5\262\017\247\253\261\256\032\351\210\314UU[1\252:\320\245N\224\267\273\333\345J\021IK\375\344\023`\224"
+	.string	"\024\243\374\261\375\331R<v\211\022\375A\004\225,\214\230\206F\251\246j"
+	.string	"\255&:c>P\344\254QB\325\256\023\251RW&\255o\355\320\214\022\273\332\253\327\250\372\330\347\373uC\"\310\344\r\037\257\246\232\352\243\242\251.\272E\265T\237\031hv\017\021\205\211\352\035N=ECv\035\272\370\002o$\255Y\273\032\252\231\254\344\005\242\335G\205\270\217%\303|P}1\316@~\263\004\222\032\261\237\374\324\237\302\336=\365eC\310H\360L\355''\365"
+	.ascii	"\213\240\030\332I\217NaS\350\256^#\274S\217\345)/\363\205\f\367"
+	.ascii	"jN\375@\204\212\004\317\272,\275\320\024\032Cw\034\346[\326\345"
+	.ascii	"j\346\016\037\356\325.t\013\022\032\022D\353\262+\331\262(\t"
+	.ascii	"\332O\306\241Vh'D\262\354A\304\207\020\355>b\017\255\241+\364"
+	.ascii	"\323\220\\y\370A\250"
+	.string	"!ZC?\315\357\317\001\201\b1\342^m\204\3724D\177\316\357\035\271DowM\001<\303+\307\f\262\027aK\033baab`d:n\220\351\030a\244q\0364B\214\211\221\211\205\255`0n\344P\312\030{\2612\230\327\030\f\0364\302\226d3d\320\250\021ci\203\306\213\260%\330X\216\245\027\222\305n\300\030[\222\211\211\215-\215xf\357*\214\346\0172\350O\320\254\317\260\372\311F,W\022:\305\222\334:\203^c\320[\375\302\274\267m[\206\354'3h\tM\225'\247\240\233p\337\021\316\331\274\212\324\016\231\335C\326\311u\343\276u\311\032{DA\377\357\251\023g!;?\263{\330WO\"\271\023\223\354*\374\275\177\211\036\235\300*\003\275u\333\177\255\203y\202~\370\003\375\225$\313\201>\232BC\253~r\221\220\212D7\341\335:W\257q\265\201\316\020X\240\r\334#l\034\021V\256"
+	.string	"\032\350\254\203\266m\333V\365\223\337\364\354\004\036E4\243O\313^\300u\256&\321\337\373\211<,\205\230o\013\3726\271\317\t\316\310ec\2154\331#G\324\247(\234\204\354.\325%\"\242}8\3778rS\231HB;\366\223\t\264"
+	.string	"<\003\232"
+	.ascii	"\233\344\256\261K\326\266E{\300W\310Uc\2314a\237<Q\237\016h\007"
+	.ascii	"\202\314h\265\200\276\327Mc\241\254m\333~\361\005r\231\254\024"
+	.ascii	"\226\n\373|\252O\265z\314\371\307\316o\311\313#!S\312f:tE\331"
+	.ascii	"\304f\224\263.k+@\211\232R\001z\211N\331\006h\265K\024\264.\273"
+	.ascii	"QY*\004\245?\177\226\232\325\020\002\201\003\250a,#\231C\206"
+	.ascii	"fD"
+	.string	"F\244)H\322\030!\005\3040)-\273\001\021\200\265s\216&Is>\205a\273\212\036\376\375\365\254e\214/A\241\004\024O\r\315]\211\233V\246PB\003\325^\302\034\207J\\\3506\254\371[C\034\332G\244LM9\216H\n\346G\202a\023\211:@\323\022\225\207g\340%Q;_\036\013\3310\354y\257\304\206kJ!g3\006\371k1i#\361\302\304\321\264\224\207-\346\032\001\243Bqg\370\036\336\346,\033\f\315\036\254\267i\354\326\301\226\233\334TL\204\016\352\333%z9\214\276\027\037\f\213C\017\023*\257\245\275\261\337\260uc\275\240\205[z\032#\307!\232d'q\016\207p\246\262\254pRIK\240\314\033\tn\027M\303,\225\227\005\031@vWI\266O\276%-G\322\306\355a\230;\245\315[\302Hvc\342\341$\202\354\234\343j\240\255E\023\222*[P\212^\016k&{\225k\307\327"
+	.ascii	";\343T\347\212\272]C\377\250\240u\220=\330\220iF*\253c\374\001"
+	.ascii	"G\r\204\005\\'\216\f\212n\030\177\001\360l}Y\215f\263\374\342"
+	.ascii	"\036Z\214^\332\322\244\003\0069\032\205\304yZ%\022\335\330\303"
+	.ascii	"iVi\3606\\\322\275\021\341\367\037\335\017\336"
+	.ascii	"\021\230=\035\310\210\t~\370\245myLGm\225p8\207\351z;<E\256\271"
+	.ascii	"\351\201f\315j \227\323V\350\211\256\240=\371\"\234\240\354\n"
+	.ascii	"[R!\032\231\306Cj8f\276l\263n&\022\213\002\3063\367\331\270B"
+	.ascii	"\375(\231\365\243P\0270\233\223\223\234\353\270L0\312N\256\354"
+	.ascii	"h\202\367\233\205\001\312\356\224\253PK\215\2455\364\232\346"
+	.ascii	"\266\321\rc\b7\315\302\236-\357\031\"V\355\253\305\034{\334\326"
+	.ascii	"\320\226\213/'\276v\264\350\032\206k\004\343\317\030C1R\220\334"
+	.ascii	"\352\341\361P3\242]\344\267\254\364M\263L\005"
+	.text
+	.section	.gnu.lto_mixTable.137.706a235cfee032dd,"e",@progbits
+	.string	"(\265/\375`\353"
+	.string	"\315\f"
+	.string	"\326\227XC"
+	.string	"s\233\016\233\236\366\307\202 \333Ia\265F#\354\004+N\251V\377\215\025\245\202220\207\375\027fS\243'@\322\202D\311\355\271\304\264T\251"
+	.string	"\340U\021T\251q\204e\272\373\362\026\337z\023)S\nD"
+	.string	"B"
+	.string	"F"
+	.string	"#\326\243?\373\307C\226\025\320\002\2452#\310\356bz\342\373\364{\2544?_\003\216\036;\257D\\\253\003+8B"
+	.string	""
+	.string	"S\252\316\016\022>~zz"
+	.string	"K\231\227gw\235&\020\304m\3356\004\333\017\354;\bo\371/Mg\225\276\206\223R\001~\005\217\335\0171B\026&\326`a\373\033\333\232v\002\005\337\303\r\326\335\025\035\0132\217~\332\207\361\030\337[8Xdw\204\013\032\273!\002\033\310<\026x\307z\254\036\367t\320\2213\232\352T\031B\312\030\006,) \225&\355\215\313\233|\027T\016\002#\033/\324\031\254k\211\214\036)\231\362\225\266\b%o\272\376\364"
+	.string	".\250\0330%\035\331a)\325\304\013\212\227\024\326\022\366\303?\023!N\363>\242Pv\262q\r(h\021\274O\t\206\021\321\204l\323$x\241\254\353P@\034\203H\272L\203\266a\236\005\023\355B\005,\244}6\f\324\2110\222\001\346N\262\016\3638\256\3036!\351\036\222\2262r2\365R\333D;\005\024"
+	.string	"2\003\302\360\312\302\246\0214a\305\250p\335S-"
+	.ascii	"y\211\272\352\252R\254\301j\206@\\\306E\325\260Ma\334\0025:\270"
+	.ascii	"#-\3555%\334\224B\355\001"
+	.text
+	.section	.gnu.lto_convertExternalToMotor.138.706a235cfee032dd,"e",@progbits
+	.string	"(\265/\375`7"
+	.string	"\265\b"
+	.string	"\306\220>90\345(\035\200\177\370\251\254\256\203)\206\bq\330:f\270\211*7)3\226\321Xk8$\336\267A\377\263h69\030\032H\030\304\222\321\302\340\002\204\275\316\030\311\336r\247\024,"
+	.string	","
+	.string	"."
+	.string	"-\030).\273+5\317d\217\360\005\331\243~|\373\333\374\237\334\001\265\022K\255L\177\001\r\273\353\227Zi\334z\333\b\266\027lw\001\253\212\001XWd\021\261\275\331\030\333\357\331g\335d;g\341\270\313\321\265v9\005'\b<\022<\333>\311K6\273\203\034H\310\301HP\0316:\224\227\n\354\364b\316\236M\252xO9s\021\300\365\002C\251\311\346LO=\354\303\325\016[\237\341\271_\343l\2512Vg\2756\032\351\303y\370pBS\033\225\264\001w6S+y@r$\021\341\371@\310\220\207\003\222\235I!7\006\026MhS\216D\242)1\334\336\206\2529)\312\252\001\t"
+	.ascii	"2\003\302\260#!h\327\304},\b\007&\b8\361\244Z1\t\223\f"
+	.text
+	.section	.gnu.lto_convertMotorToExternal.139.706a235cfee032dd,"e",@progbits
+	.string	"(\265/\375`n"
+	.string	"E\n"
+	.string	"\006\324JB\020\251j:"
+	.string	"\370\013/X\261\343\t\231=\3465pq\355\215\232#\270\353\024I\212\300&\216\316\013C\215\365f\207\316\037\021\013\343\214\300\001\020\001\nx"
+	.string	"\024@\263F\022\022\002PJ\205M\265\335\366N)7"
+	.string	"3"
+	.string	":"
+	.string	"/p\003\"\213\230\220\321\210I\001(%\220\355\226\233\303/\224\327\371\007\312+=\271\370)\372_=\203\304\300E\236\306O\205\213\335\365$O#7\275m\t\333\030\266%\004\373\252\r\004\\\365\333\"\177e\213\257\022\277\344~e\251"
+	.string	"\261\335\222\342\325\026\225W\333s\332?p\004\242\227fya\327\001\253\265\273\025\236\250\274Fh\266\035\003^#J2\245\032\325(\201\255`\n\036\214\346\314u\332\037 \363\244/%\222V\204\030\211\216v9Njb_[\212\262\257\272\265\227?\255\037\002&\221\323\027\270vM\263\t\001\035\310\3434\036\347\001\2730\3245t \217\323\200_\370u\030\274\311\200]\210\323\331\302\016\016\216\267\261y8\\g\333\200\237-\003\341\317\243\003\267\360\373\300\315R\356\265\245(\333\326\350_\020\002\t"
+	.ascii	"2\241\357\377\002t\r\377\321\342\235,\230\204B\0018f\244\232"
+	.ascii	"6\t\223\f"
+	.text
+	.section	.gnu.lto_areMotorsRunning.part.0.172.706a235cfee032dd,"e",@progbits
+	.string	"(\265/\375`\013\002]\022"
+	.string	"F\"wH\340\322&\035RW \327\037\252\240\314\222]\022F\263\362\034\211\255e\373\240\2136\016"
+	.string	"lL^\235\230^\214jqz\252t\226\254\3106 k\222\f\353\0317\2242>\234H\241W\036\302\307\220k\231\305\035i{o\271S\nd"
+	.string	"\\"
+	.string	"c"
+	.ascii	"a}9\r\005\2610}:\301\366\371\025>\215\270`N#(\006\037\226x\271"
+	.ascii	"M\f\214\247G\255a\367\271$\274]\206\267\214\340\247\334HA\377"
+	.ascii	"\341%N\215\243\226X\312gH\214\345\025elA\321\341+\033\310pL\204"
+	.ascii	"\304T\344\352\320f\234\366\350\022c\211\221\300)\311A\255\325"
+	.string	"\233\207\233t\333\033l\223\330\021B3\366g7iFS\031=\345F\357F\307\367\334\007`\302\021 S\353\313\021\220*b\n\235\370\354\357y\264\357\367\274\205O3\307\3432\314g>\217\316wP\356\3022J+a\215I\0302\252\f\266\317\322\013\320O\371\001\364\363\376\314\345\207\346r.\003\r\203\342\347\230\373\364e`)%\364s\356\001\242\230\227\254\265V\251\340_\271O1\304\203\203\214\212O\210\031\032\2734\373\021;:V\342\017\3730\016\344\232\177\343\224\201\fD?w\021\020\305\374\205k[\255\225\304\367\371\317\347\337|\032\003+\276\345\323g\321\317\270\247=\316n\200\310\310\204^\361\310\373\315Q\244\363\023\227\306K\027\340\260Q\343\r\336Q*O\245\312\020\201\265\372Z_*\200KDV&\032\274T\327\252\200\362,P\350T\336\204TW\262bu\"\006\374]0Yu\255\357[u\234\355\370\2351\265\371"
+	.ascii	"\253I\037\244\\\021\bX-\376 %\221\366\341\267\035*\214|\030\275"
+	.ascii	"V\305f.\215g\r5\235\253Y\027\333\246\373}pc.\335\303\202<\350"
+	.ascii	"1P\336\311I0 @\002\202\224\326\016Y22x\325\333I\322\"\231\204"
+	.ascii	"\361;\315iq\367\211\264\002 \376m\307(\001v\fmJ\314\320\200\253"
+	.ascii	"\307\340\032S\211\b\020\233U\210\273\304\030\252\205m\201\271"
+	.ascii	"\364C\002\277\267\333\225{\033\2308\030\221\372\3207\364u.O\026"
+	.ascii	"\313\361\253\312x\032\013?\330\246y\341\026\230\205\266\237\367"
+	.ascii	"f\013<h=\356]j\f"
+	.text
+	.section	.gnu.lto_writeMotors.part.0.189.706a235cfee032dd,"e",@progbits
+	.string	"(\265/\375`\246\001\025\020"
+	.string	"6 lE"
+	.string	"\221(\035\250\366\002\307<\276\034v\016(\222\376\203\202\246\345[@,\322\370\302&\235~\274(f\b\272\232\266\376\316o\r\202\352\003y\250\257\377\377\377\367\230\200\024\242\246\001\245\301\325\313Y=B\204\354\275\245L)V"
+	.string	"U"
+	.string	"X"
+	.string	"\367Y\"{\263y\274\b\333\242\224G\266\354\255\325<\354\305\211\211\031s\316\356q;\230;l\335\253\243G\270*G\376Y\337@}\244GE}\031\016\341vJ\361\020\3403ANm\026\373\353\212\362\225t9@`\270v\\n\f\346\234\3464\334\333m\177l'\260u\003\237\256\312+\317Y\325f\336\025{\325\333\252%TG\270\352U\265\336u\037"
+	.string	"\201\0053s\246\324\314L\225\030\373p\327o\337w}\204\377\362\306Ed\017Sk~\251\263|\027\237\304[\243\2270\013\216\224\342R\300d\2639\347\307\243\021p\217\036\037 \037\341;\344c4W\361\025\036\277\305\"\236'\037\343\032p\261\001\3169\347\256\312\266\202\177\341>\004\r\315\002\007\023\2551\207\252? =\312*\247%\371\273kE\305\260]\341(\f\343\346\234\034\377\304_&\370-\217\036)\321\243\036\375\022\371\250\373\327\017\300\320h\304JZ\343\375\276\300\234\002\336\335\001\ty(x\237\216\344\201\210\007\301A\027\301\013\371t\235\320H\007R\300 \t\236PG\002\002\205\272\215m\375\256p14\231\322\232\304U\371\257o\300\250![\271\233"
+	.ascii	"\335\326\016\351\260\376\01312dLK\362\236\263\252\315\340\252"
+	.ascii	"\034Y\344\3077,\n\367\213\"\367\333\240\205Ik\216+\367'\001!"
+	.ascii	" P\202QL\317\001\r\311p\200\211`\230\2252\213R\250\311\235\005"
+	.ascii	"F\213)\223\245\267'\243\211\255\260x\340>\016Nh\326\nXa1\261"
+	.ascii	"obM\261`\371\322\001\360`YF6\224-oe!\264f\356\302\022&Wr9\271"
+	.ascii	"\272\367Z\205\007"
+	.text
+	.section	.gnu.lto_mixTable.part.0.194.706a235cfee032dd,"e",@progbits
+	.string	"(\265/\375`\375\021-V"
+	.string	"z\217\330\037O0\222\322\031\016Z\257\205\212\200\303Z\r\305\273d\225$\223O+\003\216\204\2562\245\nY\327\264T\034\3546\357F\310h\273\376OeBD\024\005\300\375\363A\020UE\024ATQ\005\320\214\207H>\267B.w\273\273\373\355VjB\366\2262\311\344\001\275\001\355\001FV\274\270=\314\256pIx\333:\025\331\023\222\360\333\237U\355\261\274\207o9\020\347r!\316\266B0_\250\276P\241+\226;\311\241\215\023\032\274t\3512\204\310ZU\020\373\024cF,\353Wj?P\375@\265D\f\206\035\300\247\317\252k\351\001$\271\256I\037\236\345x-=\320\025\013*f\304\311\272&\241\200Oy=\220\317\307\227\306\003\017\373L\n\256\253\027\345\026\f\200\277R\265IX\315\025,\211\266\317\257]+\277\325\211\035\251[\327\225\351\351:"
+	.string	"|*\\\224\357\\\247\030U\257\362\343\315u\013\345]\247\030\307W\371\261\275\256_af"
+	.ascii	"\237.\363\233U\247\202\002\332\\\271\222\313\274\373\262\233"
+	.ascii	"\035O\005\205\r\256k\222([\326\265\351\342\351*\001\237&\035"
+	.ascii	"\310\367\024\275\217\357\351\356\247\354nUr\217\273to2\327\241"
+	.ascii	"\034\312\b9\303[\327u\370\264i\330Y\340\321\346\367\247\217"
+	.string	"G:2*\"\032\022\n\002\372\361\351\341\331\321\311\301Q\2057A\340\317\227\242\315%\216{\316\342\002r\244\037\216$]e?2\232\362\242\303%\245\344Ma\242\241(c,D\366 \2620\006\262\341\256\t\377\314\320\005v\037\260\367\240;L=\273\303%o@\207]\202l\235\215\t\363\240\277 [a\207K\326\200\322\320\253S\373\334\021\336\231\241\213y\035$\317\201K~\241ItH\030g\356\026\210}\331%\351b^5r!\272T\367\203\232\303%\215\240@[aYgS\362\315\211$]E\036|\222,\202&\261\375\004\\\022\006\006>I\227\327\177B\342~\342I\322\213}.<\r\362\206d\364\206\213\310\033]\372b#\222\303u\205\002\275)1\3630g-.,\346\236\227\370\341X\327uoe\3665\361]\226\261{\340\256\016\224\276\376\245\355\3534\013\362.\355_\233\2206\335h?\013\262n+\340\024."
+	.string	"\256\353*cy\310\t\030\354\301D\360=\355\016\232-\007a\244\b{\260\315@\003~\226\006\276\247\334>5E\366\362\274\254xoy\370\275\333\301\023?k\317v`\0315b\260\032\b\367r\273\004\r\246^\335\366\222\335\0348T\336\033*\357\001*\257\001*o\0016T\336\032*/\0018\2744pxg\240\2742b\250\2740T\336\001n\367uRy_\b0Dy\233rx]\264Py\231~\345\273\364\264\257\022\013\225w\305\317|\003PyU"
+	.ascii	"\240\362\246PyQ\250\274'T\336$\225\327\204\312[\342d\276H*\357"
+	.ascii	"\321\235\277Q\021\016/\321\327\276C*\257\220\312\033\244\362"
+	.ascii	"\002\251\274?(\257\017\312\333\243\362\362\byw\356\345\253\243"
+	.ascii	"\362\346\250\2748*\257z0_\241\312{\243\362\006U^\240\312\373"
+	.ascii	"Cy}(o\252\362\242B\336\276\341\3457\377S\300\312\032d\353"
+	.string	"\272\265\227\304\032C\252v\303\301\374^\376\265_\355\177\376i\377\225\237\314\177\346\267\373\325\334\252j\245\320\325\253\311\354j2\361\312@\212+\325C\202X\311`\343\212l\213\fo]\233\303\247\333\004n\022\211\335g\022V\223\tvg\230\0272\274\025ke\"a\367\2116\231`\302%\223\005.xOwv\237\207\267#(\317\340\241Y\243&\r\025X\032\252\267!\304\276P\001\326\335\255\320.\005\246\030\017u\227{\231=\335\n\317\2301\223\204\030\222)\300\"\336\266\237[!\231*\2561\273\366!xb_c\300\"v\205g\273\305\267-\f%Z\224\270\263\267\255\265h\216\322\215\240\245i\203\303\242q\2648R\267\350\317\275\002\347\330\032\344\027\213\376\226}\376\320\035\375\242l\313\363\322Yj\026\315\364\2702U\260\344\364r\225\232E\367\016mS\234n+:\200f\321?%R\344\220OT4\212\016\240\177qc{"
+	.string	"t\212V\321\235\306\006\016\333\347\320\206#\224&\260\024}3\345\332\330\2116\321(\332\310)\345\n\362+\251u\372D\243g70\223}\302\030S\303\021\312\220\311L\352\253)\203\310+\321\3026\321\315\006\211\003\317\260O\030\314\335\004xy\204\3224F\t/9\346p\024;\216\035\307|OK\364\351\236nQ\0061ff\325W\272\004\341\302\351\345\276\310\022\036\365\f\275\233}\236W\264\326\252(x\367Xv\244\302\317:\352\241&\035\0241W\rd\373=izd\302^.\022\322\316-X\3248hva\300\241\006\340\207\317\250g\330\261\3119\347\260X\357\246\227\273;\324Eh\224hN9\264;\253#\"eQ\202\277\240~\034\016sF\370~Z\250\265v\243|D\355\201s.\007\037A"
+	.string	"\270\256X2\226\225lD\001\006\032h\300\367\224\2509P\242\215\t\365\220\016\3123`/y:\350\227\342\364\337\320_\347\264\026P\377\364\343\\`\257\027\370\273\346{\n\344\323?=\355\323\351\031\362\256\247\177k;\315\343"
+	.ascii	"\023\331i\237\236\362,\317"
+	.string	",\247u\224V|\275D\033'\355\345^\300\245\203\3750\017\306\260f\306\277\276i-\365\315\005s%\325vRZ\311S{\376*\005\245\230u\335\033{{tX\353j\225\342\246\205}\266\243jE\366\256\344\320\236\\\361\036\332K\264\203\275\214Dsu\025-\240\301\353^\366\257\275Z`J\001\023\347\206\305z-x\205}\322X\326b\025 \210`\002~\326\004\035T\013\253CG\023\225\016\343\223\324\220GQJ\252\be\214\242\002\001\204\b\214D)\342\003Q;\214\306\342\224\016\243\217\017\242T\023\277cG\221\002\036\035PF\242\004=&<e\360\001Q\002*\242\217\034\037D\355x\202\242\332\231*\032\241\236\026\b\002\372x\"B\340\203\b\301T\321X\224\022\362(\022\215OT<\242F\220*\"\360\001Q\002\343\223\007%\370P]\020%E\264\300\310#jj\252\007\024\316B5ME\371 J\r\215:B \356"
+	.ascii	"a\310\203\370$5\204\232\242\0326\025mq\204\250\251\241\261X\234"
+	.ascii	"\032\n\217\303\252\257\220z\240\353\232\344\306\237\177]\025"
+	.ascii	"~\333\267\034a\020bf\355\036\225\307#7hl\326\274\272\243\242"
+	.ascii	"\003\372yD6\372\306\215NC\3625G\331\224g\234riwF\275,\240\017"
+	.ascii	"\370\255\220\327V\324\3135\240m\364\363\260\030\320A/\033]@\347"
+	.ascii	"\\\225\205A:\271\342\275\032m\343\211\225\032\3755O\365\224g"
+	.ascii	"\306\274n\340\300\200\021\021\320o\343t\333\201\200vA\306\353"
+	.ascii	"\367B\327\221!\0324\372c\214\310\t[\"E\b-C\262\201R.\n\336\017"
+	.ascii	"\233&\312\240^.\177}FO9\347\206J\216K~\326\214>\333y\306\030"
+	.ascii	"\241\004\352\345\n\231\370\304\350\224I\017\323\235d\264S\237"
+	.ascii	"\316\311\206\305zl\2420\363~z\271N\035\243\203\234dO\344\027"
+	.ascii	"\214\016\312\272{\321\0034\214\356,\310/E\200\003\364\357\210"
+	.ascii	"\030Sc \312\324\254\370(\351q\321\241gg\251\005\330Q\352ak\275"
+	.ascii	"\200v\004\335NS\313h\255\027\335@\334\2248\335^\364\262\016,"
+	.ascii	"\266O\032V\313ji\313\272\263\342\275\025\240\207\375\202\002"
+	.ascii	"%S\326 \235\360\364r\203s:-\276\205<\202Ne:R\216\025iK"
+	.ascii	":8\276\002\332\021n\352>S(\265VS#5\002l.\272\251/\244\r\016\374"
+	.ascii	"\344\307\261\206c\223&\276\247.P7\345s\314\313\n\335\311a\352"
+	.ascii	"\305Y\352\034\001\201g\250q,\005\021C\246HDDD\222$I\007A\005"
+	.ascii	"\3040'\245\273\r\022\340e5M*S\"3\"\222\202\202$\331k\016c\207"
+	.ascii	"#\221\277z\033\025\003Y\265Z\017\273B\200Pg\325\340\344\\\321"
+	.ascii	"\f\253)\021\240;R\233\n\365s\177\325\306GU\307\036\201\002\325"
+	.ascii	";%\307\353\367,l\301\007\350\003\272\350\f\253\343\214\272c\321"
+	.ascii	"X\177C\251-A+\230p\357\364\242n-\002;\006\253\333\342\227\213"
+	.ascii	"3!\244jz\265p\370.\021\006\252iJ+\372\020\311\3507\264\214\273"
+	.ascii	"=vw\230/\353\314\251wA\005\346K\020\306\0367\257J\021\016\325"
+	.ascii	"k\247\271\271,\274\013S\243\274ej\321\361\226\274Cv\207*A\244"
+	.ascii	"\237\022\035\362\370\"\212\020\213}\202s\003\211\224~,\337\333"
+	.ascii	"R>\253\r>\013sB\250\273=_ \311r\335J\243\fJ-4\331\225\342\353"
+	.ascii	"\206\n\212r~\363+<\031\222Q\337\335\274\035p\360Q\304\327I\235"
+	.ascii	"\224\0039\026\"\235=f\345\305Y\246|\357\020M\270\366"
+	.string	"\243dY\2266\316EEl\354\013\323WJ}\207\356t\223\n\332i*\315\376\244\200>m\353ib\021\342\364P\343\304>\240\250\301\020\311\375`pm\007;#\330\243\250IU\266\342\031\244\353\"\347{\027\021\200\275\266\356\303^\306\242A\353#\361\\o\243~f;\036#\343\t\236xrRvG\311}\004\200(!LwOS\214'F\033_\007\350\005\236/\357+\331\341h\365\337\341\224\252!}}H=h\013\343\007Y\372\034\223\343_\226\317a\n\021:\032\2207\257\237\371\302\225\2477\263\316.\267\007)\026\227dq\361\344\321]\235f\310\033*q3Q\006\330\311\277`=\242/\227\273.\b\220\375B\200W\022\305\b\341?a!sZ\352\2326\264\315\026\324\270\275\301\376\310y\370\021Tc\260\364\034;\\\301\334\252\345\221\367C\211\233\376\200M\260\353\021D\273\0066\t\337[\264\3572^\217\005>\331\323"
+	.string	",\330s\245`u\2265\306\320\3145\332\202\255\372=\f\237-c\324Zr\rX6P\005\314\240]K\b\017\003\037\204ug\350\207!\236\341X\264\007\300\351|\036\345\301\037\206\337\376u\335N\361\023E@\370\034\306.5(w\220\225\\-\303\005\271\350t\223'\203?;9\013\276\215\2543\2205\301y\022\221V`\321nN\353\334\326\3327%\357\212L\243\325G\3034\0227sM_\261\331\214o\203k\336\351\207\025T\370\304U\246\274\024qUMne\0011\231\201lA35\241H\324!\365\203\344\310B"
+	.ascii	"\230 \350\177h7\345\035\021\362\002Ll\314\371\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.706a235cfee032dd,"e",@progbits
+	.string	"(\265/\375`\340\007\265\035"
+	.string	"F\260\254<P\252I:\334\253\257\2525\360R\001\210\301N\250\263\3557:\023\300PKn\313d\352\220\330ZL\253\322N\223<?\374\360S~.Z\022"
+	.string	" :kQ\034\006\020~\363\360\306\222\310\024\230"
+	.string	"\236"
+	.string	"\230"
+	.ascii	"'V\236\221\rE\357\233\362\304\256\231x\242\2545\344\245\022\275"
+	.ascii	"TJ\022K6\342\227Dl\032\345\032\342{\364C\020\327\373\360I\036"
+	.ascii	"n\251\3031qx\222r\335\260j4\354I\271fX\"\206S\272\260C\372\241"
+	.ascii	"\360\221\262^\311\302\246\301Z4\025\026\215\223\311d\222BoY\371"
+	.ascii	"\341\204#\242\\%\274\020\3750\302\017]]\022\204\255\301\035\243"
+	.ascii	"\374\357Y\037\034.\201\203\275B\377OU\"\261\326\371\336\241N"
+	.ascii	"w\rz\247\224\304<v\376\376\t\241-\200Zke\320\017T\376\027`\027"
+	.ascii	"_^`<\276\216\004\277'\331\222\023R\362GI\236'vGa7\202\035\017"
+	.ascii	"\311\357\216\274\221\2213*\362:\"\247\033\362\243\220\333\005"
+	.ascii	"\371\" W\364\343q_\237\243>.G\275z\253t\365\236=\216-\316\rW"
+	.ascii	"\257\331V\277\224V\237T\331\243/\212G\037Y\356\350\207*u\034"
+	.ascii	"\022\315qA4S\231\034\034}P7\372\237J\033\357Ck\364"
+	.string	"=\321\350w\232\321\347tK|\346\300\311\350o\212\321\327Ta\3643\225/n\310\305\363\264\3301\224\305\212\241+z\335J\025\375Q{)z\333*\221\030\212|\354\343\\\341\0316\275\255\267\025\216i2{\235\217}\305=\\\033\235\265\323\371\330\\\276\321\307\001\316\343\256#Jn\177.\267\274\305=\227\375\314\221\245}nYKo\230\264\336/h\275`\262\364z\301\322\253\345J/\026+\275d\252\364n9\353\355b\326\313\205J/\233)\275m\312z\313\220\365f9{\213c\275j\304\3365\303^3[k\375\021l\355=\263]J\tF\271\036(\337C\177-1\255.1\257\260'\347\343\344~\232\034\020e\362A\364o\002&\026\006$\307@w\201W\315\024\362\326\036\030\326\335Y!\233\217$\344=!eq\227^\026o\361\221\225\005^\"\020\213\315\343aqU\361\306\b\273\206\3343\364\343\025\177\b^\261\271"
+	.string	"\2521\310\353\350\001\257\232\202\006\f\364\231\\U\334\252@H<\3173\231\353\334\005H\2719\\\307\245\202S\264s;\223\203\344\375L\236r[\003\\\332\350"
+	.ascii	"\255x\352\304\263\342\256F@\236z\373\035\220\177oK@\217S\332"
+	.ascii	"\355~\374;\367\202\276\210:+p4\376\230\352\215\356\307T\213~"
+	.ascii	"<\240\270\353%\216\247.g\364c%\307\200\221\250A\b\002D%\222`"
+	.ascii	"$MR\350\360\002\241!N\016\021\240\034g\232\021\021\221@\002\021"
+	.ascii	"\251\244\007>\027H\335\236\327\354$\355\227C\344\003\206\023"
+	.ascii	"\316\333Y\374\r%\2152I\213\243NR\322\354\271\202?\353\241\212"
+	.ascii	"\230n\377\206\243m\274\254M\320\306\365\005\365E\200\255\036"
+	.ascii	"\306\021U\024\247\352\224\203\335&\321\227\007~\354\344a\314"
+	.ascii	"\2371\370\254\341c'z\2001\226\333!\347\356\004\242\265\021\336"
+	.ascii	"\231\331\221X|Z\023Y\371\301\314k\322HSP:\327\024\224\3165\252"
+	.ascii	"\036\302%n\256\240>\231A\\\207\210\341 \232e\270z\326#\277\231"
+	.ascii	"\205\366s\335\265\005\270\320\375Y\264\302Ld\277k\036\030\300"
+	.ascii	"O\344E lu\2656\314\354\220E\343\016Nj\340h\371\021\311\277v}"
+	.ascii	"\336\334\020n\220\306\325[\343\241\201Q9M>\233\342+\016)<\302"
+	.ascii	"/Gk\304b\266\n!\2679\222$ivZ\341\267\374\f\324*"
+	.text
+	.section	.gnu.lto_.refs.706a235cfee032dd,"e",@progbits
+	.string	"(\265/\375`\301\002\325\023"
+	.string	"\346\260\205?\020\223\323\034\274\377\037\317\374{\377\377\373\337\336\335\335\235\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\254"
+	.string	"\240\361bm`\3728\200\353;x\006\177\345\033\"\332\264\324DD\320\241MK\332\2262\005q"
+	.string	"u"
+	.string	"n"
+	.string	"\rL\256\331\\\006!w\201\346*@\2714\3323\0347\246\343&8\271\bJ\206)\271/$\027\030\271%uksWF\253\204\\\001\242Q4\227\205r\003h\2578\256\t\351\222\216Kbz\204\343n&W#]:\271$\323\243\222+\"\375\031\235\211\366\204\\\354\0050E\226l\025\217\233\362\371$[\345qK\260Q\235O\234E\327\331\265{\035\350\253B\027\260m@\327\240L\363v)\335r:\005\033\345\364\t\366\252t\211\365\250s\210\363g\323\236l\035\205"
+	.string	"\256\233 \332I(\262\235\310\020!A\200\374\360\321cu\036;@\327!z\016\324q\230\374\206\215\0324f\310\210\001\243\344/\\\220\274E\352,6\367\n\315\255\002\345N\241\035\205\211\022$n8n\021!:n\020\035Nn\016\246o(\2715\220nA\265M\350\240MVn\n\364fr5\325'\022\267\244\232T\342\212`\016\221\\"
+	.ascii	"0\1770\327\0033"
+	.string	"Fr;\230{\251\276l\263\326\217\365\300\353X\r8\027\327\265\026p]\266\305}\342fk\375\303\266\2715-\227&\273u=\340Z\345zE\340\021\226E,g,\277\001WH;\036\247\342<S^,\373a\273O\001\3277#>\007\361\316!{\006\217;\233xQ<\002/\302\365-\361`\036\204\353\315\213y\017\336\002\005\356\373\270\016K\363>2g^\021o\210\367\341\365\360b\350\360rx7\274\032\336\f/\206\367\302k\3419x6\257\301\253y2\332\231\217+\203\375r\271\006\256].\267\345rY\262\313M\311\274e\256\226\271'\231G\231\033\312\006\305\f\272\334O\314/s\tR/\326\216\345\020\274-\023w%\345\242\214\270'#w\245Z\025* \240\2421\263m0\024\242^\342\277=\340\226\301B\240\307\240;\\ \314,t\315b?i\313\331\206\361\260\342\361V\216\254\323\217PNB\034K\256\352V"
+	.ascii	"\3554\226\t;\030\233b\302\206\225Sc\3546\246Iv\332\306>&del\363"
+	.ascii	"\213]\200\261\233\211\260\025\254\030.&\247\304\336e\213A\001"
+	.text
+	.section	.gnu.lto_.decls.706a235cfee032dd,"e",@progbits
+	.ascii	"(\265/\375`\306U5j\001\352_\n\204U \016\245\234t\352\272\256"
+	.ascii	"s\357\252\252*\256:\256:\343;\244\204\334\254\253\272\270\357"
+	.ascii	"\314\335\037==\235;?=S\327Ou\322\204H5\267\255\224\216O\326\265"
+	.ascii	"\221\372\327C\bT\005*\201TP\336\376\305\363\341,\257\2179\257"
+	.ascii	"~\240\365\355\377\3770b\t\331[\356\024\373\006=\b\205\b,\334"
+	.ascii	"\260z4\033F\f\032\315f\221\305\243\331,\264\274\270\200\350-"
+	.ascii	"sf\342\260\\\302PU\271\261b\351\343G\034k&c\306\262\331z\331"
+	.ascii	"b\227\271\374I\201\3455\233\255\267\234pu\220\337H\310\0278 "
+	.ascii	"\200Y.S\315\342*\214\2177\033Ud\277Q\330\2277\036\200\320l]\303"
+	.ascii	"N\261t[\271\311\356\2038\2705m\362rfr\360\275\031\253\001\343"
+	.ascii	"\003\334tv\bM\200\025B\217.\323\026\233\342\033\262\327\342\256"
+	.ascii	"\361Q\037\351\321\255\364hT\3725;\204\376\324K\177\236I/g\207"
+	.ascii	"\320^\241w\330\264\r\315\343?(fF\313\231\371\363\023\263\306"
+	.ascii	"k\255\361O/\351\355\006\364gooo\317n@\177\312\245?\231\351O\033"
+	.ascii	"\351\317\250\364\230Mz,\227\036\267\245\307\314\364\230H*\202"
+	.ascii	"\220\364XGz8;\204\036w\245\307U\351/\233\364yv\b\375\315\222"
+	.ascii	"\376\262\245\277\313\3647G\372\273\225\376N\245\177\267\260R"
+	.ascii	"\200\224 +X\375\315\242\253\376\206\206\231\001e\205\306\235"
+	.ascii	"\355\020\272A\257h\2529,]p\335T\277\315\263oz\252\2772\350\250"
+	.ascii	"Y\022\006\256qK\021]*k\324\3364~\353\245\0071g\353\357\247vj"
+	.ascii	"\250\216\262i\255\302\356\335\232u>f\346\f\245\314\312\341\202"
+	.ascii	"\323M\177\363\201\002\312,\236h,\311\364lY\253\260q\376\346\003"
+	.ascii	"\305\314@\320/32\007\"\016\0348\264\226\031[\252t\360\333Mj\263"
+	.ascii	"\035B\337f\322w\227\364\235%}WI\261\025BOg\207\3204\333!\324"
+	.ascii	"f\353F\203\037f\f\253\034m\360\272J\006\334Sc6:[2\366\252\032"
+	.ascii	"\277\327\322\203\370\255\031\033\3332g\246Q"
+	.string	"\233]\363q\002\312POkeiR\251\263\266\246\235Uc\327\330;[g\323l\323\232\271=c\321\330\246m\301\226\271L\270\013\234\2315\231\374\326\254i\233\3305\037'f\306\362\235=\321J\222\2273\223\003\007\016D\0348\370\300y\022\302\306\203\3378R\273\264C(\006+\204\276_\244d\210|e\232\362\2764~?\245\267eT\264,sf\032u\261X,\035\224\023.\313\234\363m\025+Y\230\310\331)>M@\371)\f\226e\316\314\3337\017@\260],\234\235r\231K\237\232\216-\315\234\231\007\361\033\335v\261sv\3552\3412\324\223\227\020\316\302\264\320\222\2273\363\277\025c\277\33016\214\005c\275\3304\333\305^\271\205b\237\274\2319C\345\2349\020\3415TyV|\360o\265\334\322Y.%\310\031\322-\250\252\030\215\267\340\030Zt\bi|\353\226\332,F\267Z\204P\254-f^\3139\377"
+	.string	"\240\005*q\215}V\b\275UKo\215\244\267=\322\333\255\3646*%\262C\350Q\2446\316F\261i\032X)\367"
+	.string	"\204\337\246&\231,g\346O\317\234\2619z\215\177Lo5@\355\236\325"
+	.string	"}0\335`\207\320\016\354\020\372\021\244>V\b=\005\3227\355\020\372\006\244\366\314\242\3314\016\254\332-\3232\371\351\304\314\314\234\231?\375C\016\333Y\343\033\245\267N\216\301)\203p\237\364\226\003\364\356\355Y\016\320w\nd\207\320\266B(\220\025B7\260C\350o\227\374V\211%\343\340NU}\345\265\234\231A)\224\2246\262\306g\332!4\265B\350\337$~\333s\275\376^\200\t\255l\246\256K\343o\344\337(\260e\277}\362\267\222\021{\366\367\t\232\350>\271]\244\377\316\370\357\013\036\"\b?\226\362_\r8\335\021-~\313s\024F\200\227\374\227\022\244\341\003\270\310\325.p\265\373\3763\304\337H\327\312w\324Iq\226\307R\340\370\367\006\256\tA\027\002\025\270!D\331\323\016Od\002\004\031nUk"
+	.string	"\354\027B\324\217\347E?\376\371[D\243(l\t\256\212\277;\270P\177\367x"
+	.string	"i5`K\334\023\366\r\007\3773\034@\003\b\366\356\016\3701\210\277\211~{\367\364_\r8y9\340\277\300\337\266i\372;x\363\337AD\377Q8\317\177.\200\307\366h\350\021X\343\205~\354\344o\364\242\270&\254\333\323\037+\341\002a\317k8\bn\342A\377\371\341\267<\266\247\255\225\253\273-\270\272,\370{\347\256 \375\273\312\262\271\024;\004\301o\347\216\302U\301\337\\\357\360\237C\215^\024nl\276\363\237A\f\270\332=\361[\022\374v\204\245\300o\365\356\222\rZ\021<M\263\241\332"
+	.string	"\026x\327\377N\340\267\033\224\377M\034\340\267n\337\360\237\347\375@\322\204u;\355o\331\\\024\374vh\335\260\233\277=p\221\375\273\206\277?\360\373\361\220\243\360\373\3435\315K\301i\376\276\272\307\277\303\2140\331\334\256\361*\375\035\345\026\357\t\376\226\023\363\3331\277%\363w\213k\202\377\032\374\247"
+	.ascii	"\376\026R\344o4\026\177\027\t\"\366\267\020\0357\274\376n\343"
+	.ascii	"ZAS\217\277\227h\375-\344\352\357\"J\177\013\001\376\335c\003"
+	.ascii	"\177\013\371m\377\326\376\366\376\366<\372\237\302*\373{\317"
+	.ascii	"\217f\360\337\313\177\273\377\315\377i\376\177y\227\377j\376"
+	.ascii	"\223\371\177\367_\355x\367\371\361\357\026\375\307\353K\374\360"
+	.ascii	"\333)\277\225\362\337\002\374\326\355?\376\321\013\374"
+	.string	"\327\367_\235\377\376\376\213\376\027\3777\375/\317\337(H\372\333\356\277\367\277\026\351\377\317\217\206\340\277G\377\035\376W\205\377\226\340\277\"\370/\b\376\313\201\377\232\370o\211\377\242\360\337\023\376[\201\377\232\360\337\020\377\225\300\177!\360_\007\374\227\001\377]\300\177A\374\327\350\277\037\376\253\200\377\032\340\277E\377\315\360\337\237\377\366\374}\345o\271\277\253\374=\345\357(\177\303\375\355\3667\224\277\331\376V\373\333\311\337\314\277\313\3766\362\267\330\337a\177\373\370[\307\3377\376N\372\333\353o\032\177\217\340o\256\277e\374\215\365w\325\337+\376\236\372\033\352o\247\277\363\337*\370\373\003\177\247\370\373\304\337\312\277Q\360\267\322\337'\370\233\370\267\n\177\223\340o\020\374\275\201\277S\370[\003\177\213\370\333\204\277C\374M\302\337\022\370\033\002\177;\340o\006\374\275\200\277A\370\333\350\357\016\177#\340o\016\3766\300\337\004\370["
+	.ascii	"\177\007\340\357\f\376.\372{\350o\241\277/\374\035\364\367\317"
+	.ascii	"\337=\177\357\374\375\373\333\3677\376\255\357\267r\277\325\373"
+	.ascii	"\355\233\337\346\375\226\347?\233\337\266\371-\233\337n\370\355"
+	.ascii	"\335\177\024\376\253\3757\361_\312o\215\277m\376\266\356\267"
+	.ascii	"j~\233\346\267W~;\367[+\277\255\362[\270\337\266\3756\355\267"
+	.ascii	"j\277E\376\366\350\267\352oU\370\255\211\337\246\360\333\022"
+	.ascii	"\277E\341\267=\277\375\375\037\361\277\315\177\274\377d\377\265"
+	.ascii	"\376c\371\377aooo\357\357A\363\003)\177\021:\020cL\275$\030x"
+	.ascii	"\233\"k\374\0132\322\0373\301L\274\224\211\323\f\202cf\026E\265"
+	.ascii	"\343FL\023\250\306\0172\263d\311\337,\026\006\027=\3364\253("
+	.ascii	"Qb\327H\244+z\350\225\215\215\2411\300\006\223 \034\351\261\021"
+	.ascii	"k\347\3309\177\273\220\233.O\314G\363\355\177\023\300jqCU\246"
+	.ascii	"\3611\013\026\023\3013p\221\273\306f\027\331R"
+	.ascii	"\021\021+k\006i\245\017rJo\357\032\364\307A\202`143\305\021\013"
+	.ascii	"kf\254\334\001\013\301a6\215\b/\275<\265\350j| \275\264\005\331"
+	.ascii	"\022\241\337\263D\350\201\310\374\370\021w\245G\217\277\211\310"
+	.ascii	"*\322\030`#\253\216,\017Hm\307\016&@c\351\217u\350\370\233m\302"
+	.ascii	"\302\320\242G\335\317\311+c5>\220\217\364\307`i\030\314\256m"
+	.ascii	"\310NN\006\260q\003H+\375\361\215\3334|\243\243\214\260\366\345"
+	.ascii	"$&B\221\254\227D\r\325\230 \215\017D\225\036wY\\\343x\006\266"
+	.ascii	"a\327FP\221\363W\020TF\\\035Y\336O\233\364?]\322[\273\206\376"
+	.ascii	"\230\306m\032\246q\343\214\260\366\225]$\200\312V\207\235\026"
+	.ascii	"\334\344\3164"
+	.string	"\376O\234\f\031\230K\206\030\336:\346\362!\243\322|\323\370xw\315\377\037\220\212\217\274\306\377\331\221\376\030\006\206\321V\251\212\251\363K\232f\306\332\352\320\343\324f5\243\361\177\266\322\377v\271]\354\224\016|O\236\31243\026\263\303\177\277\330\264\373\245\255F\340\301\314M\032\2260\301\332\352p\212\021\022\303++\353o\230\231\201X\033YudH~\242\256\256\376&\302.\305~,\335\244?\266\262i\330\352o\277\234\345j\2400\272\344\016\367\021\223\376\230\205M\303,\232\3527\225\263\213\017\314\232\352\310\3622\026V\207\373\314\245?\246J\303Tv\nnj\222\257t\244\304\326\334\345\345,\327\341\302\200c\262\026\004G=\nK\035(\347\374\224s\r/\324,\013k\003\226:\275\020\021\362\244\361}\250\322_9w\316\357\336\3670T\232snb\346+\"1\273:\262\274\274\265\265\341\204\341\344\265\366t\f\365{"
+	.ascii	"\302\325\360\344L\226s\326\240\023D\355*\254\361\361\260\323"
+	.ascii	"\377\337\225R\2235\326\370\307N\270\311\215\220\272\030l\362"
+	.ascii	"O\230\221//\234\255\231\236\030E\336\3044~\217\\\372\337\276"
+	.ascii	"\1774;a\345\234]\234\314\214\365\304\203\376\366\366\264v\303"
+	.ascii	"\337c\257\035\300\177\234\263\0032\300\314OY\310r\316\226M:\344"
+	.ascii	"\315\211\306\006\371\244\313\031\nG\323\b8\262\240p\310\230B"
+	.ascii	"\303\221\0254\205\206#7A\ti\n\302\3128\232\246\320r\016\202\202"
+	.ascii	"j*\341+k\n\315)\007M\241\345\254\254\302K\226\315L\034M\031\352"
+	.ascii	"+\007e\250\354\224\321\276\2626\230\202\302\2215\205\346\224"
+	.ascii	"\0254\205\206#+\243\341\310@\031\312\t\213\n*c\005e4\034v\031"
+	.ascii	"\355+\013h\n\355+k\n\rG\022[G\245\006K\313\n\331\016!Vl\n*\267"
+	.ascii	"\260\352r\302\002\242\233b~e29\333\265\250\214\225\351r\036@"
+	.ascii	"\316]_Xd\234dX\270'\272\026OP\234\276,3\347\\d\365\004\366\225"
+	.ascii	"\241\350\232l\246\233\"\362\2253\221\247\244l\225s\316\03741"
+	.ascii	"\351r\017K\327\224\243+WE\345\214Af\346l\225s\223\315t9\347\246"
+	.ascii	"\234\263\017\253\213\231\363\f\240\251\245\225U\316[DV\271\253"
+	.ascii	").*\347^3\003\2275\205\006\366e\024\227\206\266\314R\314&;U\365"
+	.ascii	"\225\227\231\f\016\254\024\255\211I\256\3129\3335\3512K\353\256"
+	.ascii	"\361\325\373\371\362\306\307\217\306\357\341\301\334\201\253"
+	.ascii	"\301\366\242\361\315C\347<yqEF\233\241\016\265)\215\337\323\""
+	.ascii	"\314e\363C\344*\307\\\343\3678\245\367\216\307)\206[\227\306"
+	.ascii	"\347y\223\376\327\256\247\362OL\232\027RW\346\230:"
+	.string	"eOaX\352\256\334\037dv\204Q\223\3464\303vD\215\226\3374\377\335r\271\\4<<qgX\260\032\237!By\264\231zj|\036\273\364\377\035s\311\33426\355\232\271^\210@t\361ad\346\322\375h^3\367\313\025c\351\266\230\331\205\017\030\020\255$y\034|\276\324\260\205I\305\3340Q\346\334\331\265\024\023%\302\343N\212M\273`\354\0363\023\265V\231\036j\032\237\347Lz\236/\351y\344\322\363\274\245\031d;\204\336\245\025Bo\026\243_-<k\310\240\2155\306\340bQ\301\202\02160\256\3349L\244\r\317\b\023J\024)M+9\333\274J\304\200\221a\245J\016\275+\033\227\312\235b\323n\225+\3052\363A\270Q\356\233O\0233_\241`cZI\362n\225\006s\277 \321\"\342\300\301\247\204L\021\037(>\017\223\364<A\342\336\224T\001[k|\337\372\272]\270\337\267\333\302="
+	.string	"\341<P\367\r\347\354d\255"
+	.ascii	"|\254\025\300I%\210\323\031\212\317\263#\375/\2246_\231\025\327"
+	.ascii	"\024\333o\333\177\237X8\177\353/.v5\362\032\363X!\3242\215~\331"
+	.ascii	".\\\225\2508kj?l\234p\315]\265\213\306\242\254\nH\343w\327U\217"
+	.ascii	"\245\033\026\217%w\310\rr\311n\331-r}\\\261\273\274<\356\217"
+	.ascii	"\033v\231\\\"W\311e\336&\227\205\333\343\236] \327\354\036\271"
+	.ascii	"i\327\311\035\273F.\222\233"
+	.string	"\344\n\261i\027\355\352\370]\341\3568\276+\376f\301\"\210\324\330r\316}2c\022E\266dq\255~\3345\234\267'k\260t\375}\327o\344\232sT,y\321U\226ec\251\345E\326\302\307\362\272\250\261,\323sk\366\034\250\262;6gW\246\2204\345@Y\366^\333\234\353\264\326D\2732n\216\313\\V\340iF\363\2425^\347]&X\251\333\323\034\234*0 Mw\035\247\205f\263\270h\227JH\263\347\\\264\233\2374sfr\340\300A\247\355\005\214\270\b\340\023\316\n\241\347\231\221\376\227\3537\307\177a\334\030\027\254\004\r\266\346)\2561\216_\2222R\306\032\237G+=\b3\276X]\033\367\306\255a\323\356\327\355z\303\331*\267^-\226\367\353\322\020cb\306\206\210\003\207\237\030\035]\356R\374\235\274\364;v\351w\352\322\357\244I\357\226\321/\327\016\324\213'B\032\377\312\244\266i\207P"
+	.ascii	"X!\364;[\322\357\304\245\337i\222~',\375\216W\372\035\025\351"
+	.ascii	"u\336\244\3271\223^\247Jz\035'\351\311\330!\364:E\322\353\334"
+	.ascii	"H\2573\225\376g\227\376\227%\375\217-\375\257H\372\037X\372\337"
+	.ascii	"\213\364\277\247\364\351]\332\201\025B\237\316\245O\335\322\247"
+	.ascii	"M\322\247A\322\247\\\355f\207\013\224"
+	.string	"/-\032?\215J\333\374:\305\320\362\326\370>7\351}c\322\373\262\244g\3325-\363kLN\0313}\246\353\254U\241\306\nN\343F\323ilZQ\253\311?\366\216\307SV\343\373\246\244,\310\331\026\241vo\317\026\241\375e\207\320\002X!\264\311\030\275\313\370d\2159y\3228hL\221\357H\234\215\025\304\204\2312r\225\033w\230\006\203\233|\365\240S\302\244\2245\276\357I\372\367\227-pp\314\2615>\210+K\232[\272\n\030[\263L\316li\245Ksi\272\326\322^lZoi,\357,\315e\324[zn\001tzI\220\344\314\344\201\223\325\004\213\007\353X!\364\276\256\364>\253\364\250\234\364\350\232\364(\227\364\350[\3727\225\ro\304<!\231B\324s&\216\226-R\242\240R6\320\2704\376;\356\035\345o\375\2253\024*<9p\0327\234\321;\356\001?r$i|\337\330|`\316"
+	.ascii	"\201k|KFC\305\025\034\266\326\321=.\023\254T\355lN\263Y\270\b"
+	.ascii	"S#\307\227\275f\361\242k\331H\332I\2375\224n\322O\032\255\227"
+	.ascii	"\264\222Vk\267^\353\"}\244\323\332\254\231=\326m\335B\2275\223"
+	.ascii	"N\322F\232\314\2465[\263\360\036\322D\216\273\313\253E\323\232"
+	.ascii	"\315\330"
+	.string	"\372\nol\223|\245a\310\2276dyV\312\013\315\255\361\001 6e\312\223\253\027y]f\247dH\343\003\300\013\016\016\215b\201\230Oc\222,S\025cd\260\305\33144\212\222(L\031"
+	.ascii	"\210jkC\335\324\220\\\275\310\323\201\241\025\343\255\005\233"
+	.ascii	"\206\272\035/\212\354\2551\n\245\271\230TM\r\362\330\330\320"
+	.ascii	"#e\264\324T\311\303Id\264\275\025QS\003A\212\231-\215\245\305"
+	.ascii	"[\\\343k\020\345\304\t\236\223\300\331\030$>jg\272\204da\302"
+	.ascii	"\004=\263M\362\225\321\323\2279Hr\336\332\320\303\305\305[\026"
+	.ascii	"\332\344\350Y\017\236\023\272\262\036\377\177\350\226\2538p\216"
+	.ascii	"\230\231\3419\242\257;fH\331\035\022\035+L\254%+,Y\202\347\354"
+	.ascii	"\016\252\253\027+\332\2504i|\rYJ\224`)\242\270.fl|i\354|t5\276"
+	.ascii	"\206\247\2611\364\310/T\256!d\231\363\326\006\013\034\341\262"
+	.ascii	"\325\370\0314\321\"h\021\364\210m\222\257l\030)ewy9om\370u)S"
+	.ascii	"\223\305\310\321#\177\343y\262dO.\003\266\364G\207\240C\272\307"
+	.ascii	"\bk\331)k\203\225'%\313\240 tG\032?\003T\f\025\273o\270\211\231"
+	.ascii	"\257.\210k2c\223\227\261\344:\030\301aM5~\006P\351\217\206\241"
+	.ascii	"a\330\0167\001e\250\247\271\0362UF\302\254\331q4\310\016\324"
+	.ascii	"\n\305*An\213\243\327\334ySk\3525F\177\240@|\364\340\261\205"
+	.ascii	"\306\321\034(\rT\307\206-'\247\017\304\232P91f\236\230L04>\240"
+	.ascii	"4Fo\240`?)U_\272\032\037\305\301\303K\220\"\215\033\375\362\221"
+	.ascii	"aA\2615>j\343\312\311\"\205\252\361\321\032\377\177-8sc\2541"
+	.ascii	"\352\225Fa\360\306\301\317L\2234?\032\377h\327Q\257\323K\t\252"
+	.ascii	"hl\3255>\267\030\035\355\352\2605,X\032\037\203!\351\217r\241"
+	.ascii	"\\\026\017;\001\345\f\326\302\217\215++\2704>\0068\320\254\243"
+	.ascii	"2\320\254\260\rb=X\326\214y\321\030\205\201\306@_\240Z\250\013"
+	.ascii	"\f\254\322\037\275B\257\232\n;\005\345\354\024\007\216\306\220"
+	.ascii	"0\270\306/\272\313\3623\315\251\346\254\263ig\026\324\312\350"
+	.ascii	");\001I\200\2228\237!Ue\\\215\321*&\024\013\256\266\265\306/"
+	.ascii	"\n\223\336\2225\317;2kN;\rOS\"\310\2704\333\234y\226\216\307"
+	.ascii	"\bF\2624\341\240N\226n\013(C\271\241\211:\331\234v>MA9\347\330"
+	.ascii	"\262\234BY\240+P)T\005Je\323\320\250\363\315O5g\335\211\320\250"
+	.ascii	"\023\317\256Y:\036#\220ii\356\210\301\013\243\363\301\315\247"
+	.ascii	"\321\3604%\242\314L\023"
+	.string	"u:\365\320\246\235\026\206\b\211\222\207>\241P6\ru:\0213s\340P\324\243W&\257\f\305?\332\204f\036\270\0254\244\032\237{\026\r\013\213\034\215_$\307\246\235s\244X\220#\244\361\031\347i\250\232V\2608\025\030qJ\2644~Q\223\364Ed\351\213\302N7i\230\246\327\226\306/\352\221\276HG\372\242\257\364E[\351\213\264\322\377\274\263;\321\256\260\331r\332M\371\242\245\352\251\361\213\256\322f\332!t\203\025B\3172\347\231\023\315\377\373I\002\267B[\343\027I\245?\315\374\377\241\340\203K[clO\005=\307\374$\363\377\032K\330\322\252\361\213\234\322\237aN1\377\317\207\214\0206&\215O\004'\375\t\246m\217\rW\343\363K\032E\204\206\003\035/7\0334\264\374\374\362\237[\356\212\323K\n\366\344\270i|\322\235]~z9\271\234^>\370\312\331\351\364\362\023'g\247\037k\005`\255"
+	.string	"p\022\260\260'(>\321\230\264\307\n\241\367\211\321O-[\2524\315\032\237\250\205+Wz\330X\226\311\311\235azK\026\252T9\215\210`\346&\233\205c\312\224\263L\00437\205@\254\216\f\t\221\214(Q\31604D,\340\340\240\304qs;\241\210"
+	.string	"\312y\307\3302M[\333\tE\00437)\273\324\221!Q\301\335\na]\330\330\3162\035lU\324\324\3160\021\314\334\324\201\246:2$nM\316&\247\223\r\314\254e\265\304^t\270s'\\\224\212)\347\331O\264\236\262PSSy\215\215\214~\236Y3=&V\032?C\031\223y\226\351@3\004\211M;\221\234eq\356\034\320G\226&d?\227\374\347\330\231\244\247\316\244\300q5>\225\030\375$#\223\025\007\243\361i\205P\224\316\n\241\317\360c\3109\3444\302\343\316\265\031\225\"uD~\026\351\251\264\t\247K\263\261\007F?\211\240H\246\334x\323\370\031\274\304\304\300\3642\270"
+	.ascii	"b\323N g\230\b\240\234ul-\257\023\035;\212\234B\376\276;\203"
+	.ascii	"\370r\314\215qk\2143H\355\260i\347\216\323\207V\002\342n\274"
+	.ascii	"\350p\347\256\220\211\0322\347\344\321S\215n\301\211mi|1\344"
+	.ascii	"\235`'\330\251c\206\017\306\215:\262\274\306*#\022\347\314\361"
+	.ascii	"S\207]\223B\207\206\013\206.\247\215\323\306y#\313\2213\326\312"
+	.ascii	"\026<\253\363\353\347\215\271\271\267 k\377\177\330l\310\326"
+	.ascii	"\nO\274\274\272\226\351\233\0320H\032\037\303\330I\343\244\201"
+	.ascii	"\245\354\003\304Z\264\2215\274\254\306\307 \204\213\013K\245"
+	.ascii	"MVO\254\216\f\211\227SZY\343c\200q\2728]\2342\212\360\262\352"
+	.ascii	"\310\362\360\233\230\336\2153\306O\031W\223~u\341\275i|\3028"
+	.ascii	"\225:#VO\032\037\357|\361\377'd\344\310\324\213S\3137cH\226\272"
+	.ascii	"\333\224\203\005\226\306\3070\225\336\216\331\263\205M;[\234"
+	.ascii	"X?\b\300\260\353\352p\223\364\210\322\346\274\372q!D\r\031\021"
+	.ascii	"O\025\r7*\215\217\241)\375\317\252\263\252\251R\025S9g\211\240"
+	.ascii	"\004\277\305\321C\322\370C`\316\025\347\n,\005\224\237\322\314"
+	.ascii	"-\363\326\326\006\fu\326B\332\333\031uF\235Si.\262\022\327\003"
+	.ascii	"\326\005\365\246\361\177J\375\234B\3430kX\341\315\221c\265\326"
+	.ascii	"\370CN\322\377\204\272M;\241,^\252\"g\247\255\004\210\305\201"
+	.ascii	"@\314\2225\215?\304Bz:\235NX*\315J\354\276\344\360\2404\376\320"
+	.ascii	"\r,\007\3139\263\035\023\253#C\302s&\214\231;\274\3673_\034G"
+	.ascii	"K\327\225\306x\316\251\370\23013\302\344\255\210\333\330\223"
+	.ascii	"\306\037Z\221\352\351\3419\021CGn\334..lp\275\311\313\303o p"
+	.ascii	"\206E\363G\n\325\025\013o\276\365\003\253\361/ \223\342\341\341"
+	.ascii	"6\277\234s\336\312Mv\006\260\321\345\004C\227\304\253\215\235"
+	.ascii	"\262S&\013\311\222\306\277\340J\372\3435kDXr\243\216,\357\002"
+	.ascii	"(uu\330n\204\255\354\324D\200:1\013d\316\312\n7\211v\260\210"
+	.ascii	"\311\341\243\361/(K\177\301\217\364\307il\032Ns\333FX\373\312"
+	.ascii	"Y\"\230\331\231\261\361e\"\\N\032\377\202\257\364\307g\322\360"
+	.ascii	"\231\2536\302V\223\354\342'\210\223\227\345\223\227\260\270\306"
+	.ascii	"\027j\003\006\227\001\203\311\240a\036\006\223\351\374\225\363"
+	.ascii	"\322'W\344L3omm\370)\333\352\262d\3141\031\035\273\314f\331\030"
+	.ascii	"\213\261`\226yM\343\343\331)\377\177'X\0334o\215/\224&\275\220"
+	.ascii	"\026::\354\245s\316y\351S\013\223\323\345\330\313O\035\334\016"
+	.ascii	"4\215\217\327u\377\177>K6@\232\032_\310-\013\336\222\005K\241"
+	.ascii	"Z\264`\251\264H\216\030\312\226\305\215S\343\0135I/\024f\005"
+	.ascii	"_\261\202\347\016\220\263e~]a\345-\254\rX\016\313\3419\021MC"
+	.ascii	"C\232|~|i\263\327x\356"
+	.ascii	"\355'6\004\254\252\361\205j\244\027\212J"
+	.string	"\177L\305\246a*\335t\261A\021\2545mx\232\242\344\320\330\223\"\345\342a(f\316\202\200]\035\031\222\214%\327\241\227\\Y1\032\377\202\232'Op\334\0069\347\250\314\304\246H\217f\333q\3341\\\233V\f\263\306\307n\370\355\377\235wR\254Di\374\013cR\f\005\267\360\377\367S\033\273\"\245\361\373B\027\016L\234Y\231\321\370\247\263\324\003\"\244\361\361\356\366\377\227\212U\2412\322\370\027\340\322\3434\213\327\326\324P\031YudyXv\304\345h\374\013h\251\023'L.\004I\177|v\233\206\317\356\233\021x|e\255\002\004;G:O\362\240LZ\203J\037\214G%\245\243\320H\f&W\245\361(\374\255\301c\361\350\004z\222\0075y\024*\211D\311#\005\224\252\262\270D\302\210\3428\\\227\222RPB\201\324@94\036\205\252\362\230\024\022G\004=\311\203\252D\\\317\225h<\341\202\362\004"
+	.ascii	"<\311C\212\244\272\256A\025>(\223G\245QUr@\303P-\252\0204\232"
+	.string	"@\202\022\n\244\220\272\006\207\310\r\250E\244\3221\204\022\n$\206\016(\241@\366<\311\303\n,@2y\f\241\301\223<|\320@=A=\n*\213\304\340\021\320\223<(\325\341Q\211\004%\361\347I\036>\250\311\2455\250\036\371J(\201\224\304\013\224\222\252\211\023\206Dd\217R\005\022.<\311\2030\t\024\036}\020\036a(\036\251%\bK\254*\322\317\223<`\300\304\t)|XU\244dp=\201\360X\f\241&\217!~\206\312`\007\324\341Q)I\f\n=\270\006\207\253\252\364\001\252k\260\210TRMd\220\002y\f\001tA\n\3441\004\006+\362\003\022Rh\\\3321\036\365\251\004\"!yV\240\021\ty\032\221\220WM\001Q\211\225J59\034\006})\220G!N\256\310;T\215H\304b\3207T\225K\330x$\256BU\351{\022\210\204\364\320\223\f&\tq\212\344\252$\"\251%\212>"
+	.string	"\341\201\221\007\206\301%\r\370\220\260S\f.\225\360#\242H\f\256\034\360!\261\006\213\0248\256\302\f\210\340\201\343*\314\300\216\007>@\036\223$\324\"\222\221\230\302\017\211\020\230T\021!|\3007\201\036\017\220\030\006\2274\240\343s4Q\f\032\223\352\312d\302Q\210A\t\005\t\344qU\002)\221\307U\251\243TK b\"\216\030\006\217\030\340Q\242)\202\311$\t\307U\271$\324\240&\227.X\211\306\023~\027\204J\023V\242\221\b4T\327`ri\r\246\200!\251\256\310\243\220\2304\241<\001\bh\304\252\"\3650\021G\\PZJ\241\204\023H(\211LA\235\f$\202R\265\250B\320\004\023Q\351\247X$\301gg%&Q\\"
+	.string	"\352\300\303\232\f\"= \031\211F\343R\t5\031\314\020\\\203%\b\223\250:<\216"
+	.string	"R*U\2410\210\216@\204\020t@\202\223\2118\002(\205\322\316P\022\022Q\204\206$$\242\210\237$$\242\210$$\242\210\f\031\370t\340\301D1\b\204\032\221\210)0\021G\\`\n\016A\\0\022G\2408b"
+	.string	"\305\021\003Ccp\002\303\240Z\302\020\004\206\020\302\344\357\202\221\007\345\322\221xBM\222\020&/PRWe\212\024~\224C\243\t\311\343z\f14\222P\\\022\026\203B\004\fU\340\b\245dPI\034\006\031\211#|T$c\260D\006V\243\232L.\ty\236\344A\bT\225\210\253q)\371A\030"
+	.string	"%R\260H\001$#Q)\031\334Q&\217\353q\304\321\204:<\216H\252\353\021\tI\365D\006\220\304\"\005R\024\221\310 \001.\004\032)\260\252J\265\004\022r\350BbR5\252H\351?\bA\001!\210\300\344\273\b\r\350\240\001\035\240\027\241\001FF\r\b\301(}\bFw]W\240r\204\nTn@U\"\256\351z*\201\276\325\270t\f\241s<\221TSP\225Ki\317PU&\325\023j\022\250\004\242\b\246\020*\036\217\023"
+	.ascii	"\236J\240Z$\036\035\223$\206D$\317\372$\017C\"\362\003Q\tV\t"
+	.ascii	"\024aHD\242$\354\tvHD^\024\301\024:)H\002\036!\213<)H\3629::"
+	.ascii	"\256KB`\222p=\032/\250\310\024+0\251\256E\342\0210h5\252\302"
+	.ascii	"\244Jb5\022\217$\220KC#\261\003\031vP\004?\260\224\302\220\210"
+	.ascii	"\364Q\032U\244\3221\304\220Hb\r\252pB\310H\034\261\2220$\"\201"
+	.ascii	"\212\352\t\265\370\263\n\325\243#\2415\251\"\231"
+	.string	"T\340Z$\256@\3431\005\304\3441\211\310\004\006#1X\201\344q\r&\325\013\216\3045X\202)XTK\\X\223\220\210j\007RPJ\252\353P\250\004\212`\212\240\242*\024\222\240\256\301\244\317\020\th\005\256F\342\021\271\252J\"U\211\270\352\244\b\026\325\341\216ZD2\006/P\327`\022(\244\002K$)\203\311\020C\"\362B\212\244z\342(T\223>(\202)\200+Q\211X\004&)\203I\341\317JT\"b@)\251\256D\035\237:<\216\370=\311\203\262xL\256\306\243\020(L~\020\036i(\001\004\020\212c\321'\t\211\230\3643\004Q\f&\327%\325\370\003\016A\f\215A\025\206Au(4\004\241\016\217J\300\241\232$\\\211(\224?O\362\300\224\374\300\224\024bJ\352 \203J\302\344\231T\207\304\023\307$r\2502%\213AbRU\0061\251E\344R\tG\305`\222\016\362g\005z"
+	.string	"bH\374\255\306\245\243\020x\224\004\022\221J S2\203:$&\223\352\211#\320H\334"
+	.string	"\210\264TD\022\005\255\252RM\036\327\245 ph$\252"
+	.ascii	"\\\203J\240\322Rr=\201\212Tf\300\243\026\203B\245\316\232TO\030"
+	.ascii	"\211@\242R\231\334\021&\207D\245\323HTJO T\223\204LA\245\364"
+	.ascii	"G\031\242\030<a<\022\327`\361\210L\252\253\361\004a2\203RU\223"
+	.ascii	"Hj\t"
+	.string	"j\021\311H\202R0\304\t\344\321\205a\361\230\244T\223I&\3245x\202\270\nIP\207\307\021Ib\220\310H\024\252\312% SP\t\310\224\334)\252Fc0I\bdZ\n\002\231\202J?+\212`\212\253\004&U&\342\210\264X<&q\222p%\"\317\365I\030\f\215A%\245\243\320HT\322\351Y\237\344a]B\256KG\240\022\n\344\007eR=AL\0167\370\021\251&?\254\307c\362\303\316\n\364)\221\202&\216DT\tD\"\036\031\217!N\250%\250k\260\004O\361(<\256\307$\t \343\221\250L\252'\214'(\241 \221<\256G\245 %\024$\206\252\320\230Bi\334\200\252\\\362Y\201\"\254F\342\222o=&)KX\225\311\245\t\250\312\245\236\023\352\360\252K\305 \007VUyt\224\001\2658<\241\030\\\211H\304!\006#Qig\005\206`\264\032\211K\351\031\300\200\020\033l"
+	.ascii	"\205\n\244B\017I\225\211\250\364aMB\"\026\217>\030\211A\245\017"
+	.ascii	"\302\244\362\203\207\"\265\270\256\307d\322\312\024T\332\371"
+	.ascii	"\357\253\201\343vz\270\300R\304\013\277)[\333\312\322\330\007"
+	.ascii	"5\002D*\256\261/\206/\206o\206\235\003\236\310|3|\\n\310\320"
+	.ascii	"\200p\371\266D\220$*\rn\376g\346\260\263+R>\031W\n>b\305\"\255"
+	.ascii	"\3617 \223ba\371^\364\327W\316K_\233\016\036M\255\373^<5r\226"
+	.ascii	"&\256\261\317\305"
+	.ascii	"\337N&:\342\2744\366e\375\2701!\363c\003-\351\357\273B\335\272"
+	.ascii	"\310\036\263\252\005&C\245\306\316Gc\337\224o\312W\365\013N?"
+	.ascii	"t\272\252Vx\341cq_\025\2253\n\r\033/\215}+N%\325c3\003\323\330"
+	.ascii	"G\345\303\262\005\314\006\222\364\367I\241GR55\304\300D\3355"
+	.ascii	";Y\232\304\251\242B\fe\241K\236\226\017\ns\315\271s\022\347{"
+	.ascii	"B\243\370\344]\tC\345sB\351\230s\306\3164\376}M\330K\335\235"
+	.ascii	"\325\223\306L\262\253\253\037_{'\226\030\267\"V\215\337P9L\226"
+	.ascii	"9g \0363lZXk\374\rX@\337\240oP=\213\205uw"
+	.string	"\200/5\264\222\344\345\255\027\033~\024\316Q\275+\006\375\322\364Z\261\301\215\364G\363\260\024f\343\342\001\346\306\256\2412T\350\265\265\211sW\030{\003\003\357\276\371\255\361\221\266\203\315\331\017\231/\035Uk\320+\276$\\\232\300\356.\336N\r\027h4\354\360\334\004\356\252t\240\315\323G\f\026\364^\324A\021\343\202&\215\032'\027\2368\315HS\206\0019%?\320\030q\372\"\307\315\2313\f\005pr\352P3\030\312\310\031\333\033\264\f\266\363q\373\202F\rJ\006\325q\346eK^c1b\206\246T\341X\346\375\352\2744\353\352\300\200A\243\020}\3351cW/\220\374\264p#\213\\\343\007 \316\213\027\314\205d\271D\254)\216\331\226-(\035\321\327\035\243\245\267\205\244\214\232-3P.G\351t\314\250`[\273n|\2560\311\002\323\370\001\250\221%\013\226\262@\314'4kM\2374+Q*\032?"
+	.ascii	",\344\344\320+k\324T\311\3631{\222\3235w\364\n\032\025\266/4"
+	.ascii	"U\252\340\206\036\250"
+	.string	"\263q\324J\236\2121\214\242L)\203\212Ff\322\244\003\343\025@0XD \022*\353\350z\023@D\213\355\324\211\032vL\251\031\022\005I\322,{\007\ra\022h\210\020\262[(\323\207\214\375(B\311\002\314Ai\b*A\224\240\\\354\332\315\205;Y\303\244l\204\355\220\325\222\262\263V\3205\346<\237\243qm]\230pQn\362\024i\\\002\245\366g\320}O\236\263&\320|&\266\003.\347\270\027\005J\205\265\375\303\314 -\r\272dz\263\033\246A\245\240\315\177.\216\250\333\034\366J\033Wd\214\232p\252\236\244\330Z\2537{\177N2'\311RM\355M\306},!\365e*\351\324\314\232\337\261#vu|u\r\221\227a\036\340\003\024A\313I\036\313\226g\206\"\370\2244J\234iZ\321\356\nC\261\025\003\224t\352*\032lD\3156y\245\003+xYd\325\306-\005\351\333\016\3401\351\256\306"
+	.string	"Rf\333\241``bEy\002&\376\001\371\004\367\005\326\222\211=\347\215C\310%\030b\351\247\026\244\251\221\034 ,\273\236\037G1\326)>7\375K&7GJ\034@\213Q\275bb\321j\004\374GJ\357N\b\030\200\230\024\346i\373\351V\006}i\374\314\207Z4\032\026\357\314"
+	.string	"\275\3705nV\235\0034@?\273n\2620\034\206\350\335`\256$9\301\023\024\233f;\\\236\222\307A\271}\213\265\017\356\005^$\345\320+\007]\034\276\274'\263\370 m\244I\250\033\264h\024\376&#\353\200Y>@!\344\037D\355\275"
+	.ascii	"\203\312I\357e\207-\243V\355t\247u\3438\316\224\216\005\331 "
+	.ascii	"\332\254\004c/,\320't\323\023\325\020\231:\272\257\363\322\314"
+	.ascii	"\273\246\217\245\224\252E\344\244\377\025Wl\304i\361\2423m{\351"
+	.ascii	"p\376\360\300\275w\235rIh\004\204\330\016K\031(\242JEF\017\275"
+	.ascii	"\n$\202+l\330|}\204\315\004\255\263b0l\360\244\366\304\365\275"
+	.ascii	"\013$\224\207%\217e\340^\245]U\212?\267`\343\021\3341\321\204"
+	.ascii	"\"\350\021\2140\037\263~\003W\264\3452\336h\253\265\377\375\305"
+	.ascii	"=I\347\302\310*2\270\317\275K\021\004\270\365E)\267#c\213\001"
+	.ascii	"\253\264\345\321Zj_\215\3123\241\234Ay\240\305\221A\212\b\314"
+	.ascii	"~\016Q\257\271Y\026\242\n\036\266\033\255\317X\311\350\211\033"
+	.ascii	"\322\330\370\303\316\317\233\262\305\226\237\376\321\341\316"
+	.ascii	"\314\375\321\357Ca\337\262@v\354\227M5\030\320\016^\275o\221"
+	.ascii	"\240\021\t\337\311\271\357"
+	.string	"\200+\022\2039]\362*t\331\201\013\315\261\256$l\325\300\200\354\020Xe\252\035]\260\033\335\300\365 \006\351m\2320O\b\205\256\336\036Al\347\3629\022\234\310\236\021\375\372\240\257\274\316)\300@]\031\t\310\360U\370\301\252\274\355\3617 ,R\317\252\362\006Ts}\346L\036T\334\247 V8\371\346\344k, \266,\370\201%\231\3662\232\340`OY\375J\242{'\204P\273\327\337\025\2719o9\241+OL\257O4\300\261\017\377\304\3041]\350\244a\250\004\343(\006\242\244\207?pE\237\266\235F\030E\374)\316\211\377]\335\007\225\200\234[\275\301\306\225\365\217\224\f\300\211\232\305\355b\221f\2366\361LR\302\277#\302\f\2231\303O\037\323 \277P+Zf\004ct\275\002^K\236\333\331\233\\\211\220\347$y{\204\326\023\0028*\273\222#\305\342b\277\3536\271\311\246\246\237\277Y\226\r"
+	.string	"\235ub\327l{\232\300\271\202\375Y\263\n\033o\255l\265\215\372&\313\324,\201aw\206Q\370\177!\311\252rN\013\262\371-\f\210\231\223pp\263\"\212\303\357\332Gi&\372\214\361\333\357Z\244+SP\356-\303\302,{\006\317w\342dD$\1778&\227\350\370)\254\320\316\203\310F\325\355\021yry\373\2354#2:\332\262\222\306\360b\330\206Tc\217\352\335\031\311MY\320=[\260\331,\\\262;\215\306\345\t+-\247]\026eD\350V\243\221Q\202\203\211n\023L"
+	.string	"\371\361]\206%@\367\315\001\376\241\007L\345Y@h\215*\255\fp#|CbP\217\306h\240n\333\303.i\3038t\216"
+	.string	"\033\222p\224\304\220JI3IP\375{Brb\024\371T\232\277\262\301f"
+	.string	"\"}\244_\324\035 /\245\210\n\2652\313\257gb\377\202\354\b\210L\351\305\203u\016Y\b\314%\027\t\251\231.L>\n=\236\003\004H\017\341\200\275E\304\344\306\271\035\373\206\303)\240\354\253R\225K\210\033E\242\336r$#\241m\344p8\013\323\177&:e{\237\001\f?#\236\031\2126\245\025ZA\321\347\336\320*\244[E-X\354\003W\227a\332\n^\263o\r\037+\242q\311\256\351fL\371\306\026\024\362\3631'\244z\226J\306\001B\202\216u\337\327\344c\320\200\211\332\310\020\215\237\247\323"
+	.string	"\333O\355H\305af\2053\346v\226\360\352\214\245\344v\0254(\304\366D\f\244\222\256\001\336\357\333lTT|\341\326\034\363o:\223\336\262T[\tg\220y\363\210<\027D \020\201\0330j\356\372\307\303G%"
+	.string	"#:O\312e\261?\331\2343\033\212u\023\341\203+\356\253_q\255\263j\212\214\002Q\334Y\021 ~X\254\202\307\270\347\244\243\356\270`\311\326I\n\3675\022\316_=\305\004\261<?\262\245\362\005u\275\271{/\371m\335\327Q#\371\211>\325\211\241=\r9\342m7_m\\\321\037e\277\016\030\001\320"
+	.ascii	"\037\250S\213\354f\002\006L\334u\202\355A3\341\226\251W\2522"
+	.ascii	"7\335K_\031\307X\375\364c\3741\266K\273g\224T}\n\214-\243\017"
+	.ascii	"\330\207\361!0\260"
+	.string	"_l\\\\\242\027\352\364\354D\375\325FrB\021Y\204k\260`\200~!\320)"
+	.string	"\334\001"
+	.string	"\245\305-\035\324\b6I4\t\365\247\312\021\252\252\371Q\023\027\364\305\363\340\244\344\024\2507\242\f\350\023P\204\025\267Mt\302:\260 x \340\017\2344\237\352[S\213p\340\"\317\207\030$\033\310m\311a\025X\235o\314\250LELs\336o\373\335\232\3629\251\262I\332d5$\264\276\364c\273'd'\2733\275s\224\nM\036\254\304\243+\341\334\274#\231l\363\214\262d\273\251\211<\273\2446\003\316O\360\337\250n@N\002\353\211&\244\264\274\363\224\332\337\007\375\205\325m!\324\237(\271\270v\023\201!\340\024\235\373P\377\234\315I\277\370\343Y\025\301\264\245\f\"*\372\n\300\376{\001\313Q\345\r\310"
+	.ascii	"\270\003\221\330o_C\030\277T\342\367\252\333\307\341\325\024"
+	.ascii	"\211\256X/\244M5I\211\032\221\213!\313\243\333\314"
+	.string	"Il\001:|P\245u\254\250\345d\2459D\006\002\221#\247uIOf\211\214\277\305\230\b\236\2043\314U\314\254\366\231\260\255)*\021\025p\3603M\252\303\314\361Qw\256\306\315\n\216\262h\n\304E\307c\035L\363\037\260\340X\212px\270\2658\002x,\037I\203\312\313\023\323\275\025\317\312\232K\342\264\002\262w\2345\332\007U\210\232S\271W0\340\352\232\002\331\245\226-\321\225\224\204+il \317\007\367K\310\271w+\202\351\375\241\270\212\274&i\263\330#2\327u\363\376\206\317\n\210\372\246[!\333\220\206\013\240\034\361\261\201t\203 \235H\357\274\377\254\215\001\375\337\205\3072\002(\270L\334\027Y\003\220\n\235\273\226\363\035\256bA\013\233\354\341z\013n\265\360\200{N\030F\356\202\235\245\261\316\277(\370\261\200'\002S\321\262~C\033\273\355\344\301\340\"\025\032\3775\031\342\0176\b\354\034\301("
+	.ascii	"q\356\221C\237A\355O\237w\354\032 \252\301\rd\203\033-O\255t"
+	.ascii	"\354M\356\375B#\307\324~e\317Xe\025\223-\013\005\301\023\357"
+	.ascii	"g\330R_%\203\347\345\367\3744H=\013ad/0T\342\\\243\314\031\230"
+	.ascii	"G\321\344\301\024\351g\367\036\276\215\005\346\335\320KZrg\344"
+	.ascii	"\034\222ce(<\023\2604H\201\332\373\206\262\305\006\236\331)q"
+	.ascii	"\334\244\f\002\023\330tHa\277\302\030\233#T\200s\275\351\350"
+	.ascii	"]-Y\262_\323\373\202;\275/\261J\2521\377A\312\304\355\340\257"
+	.ascii	"E\317u{\214C\376s\n\3752R\345\177z\266\2676\031I;\265\313\254"
+	.ascii	"\367\366a\033\3168\253\321\334C\327\022\243k;\317\035\020y\204"
+	.ascii	"^&\201\300\245\241\003\261LZ2\f$\301l{\312Z\024\252\310\376\020"
+	.ascii	"\227\207K;\004\373eMk\316\321t\t;\214B\277HE5\367_&\3440\372"
+	.ascii	"Y\217\207\210y\360$\304Y7\t\304\317\330e`\365\234\327\001\253"
+	.ascii	"\261[\261_\356\370\263\317\r\367\277\0360\275\337\373\245D\003"
+	.ascii	"\313-\001\332\235i\321;\200\326\336\007\203g\224\377w\004\250"
+	.ascii	"H\330\007Pl\313/q\006\262 \256\262\210G\267\224u\237\370h\241"
+	.ascii	"\341\017\314\3470\326\372\273o\260k\271]\246\254bW\307\325\334"
+	.ascii	"C\024\272\025H"
+	.string	"\0208.\271\037\211\333\372\322\033\213\215c\231\320\027z\207\025BC\367\"\242h\003\322\217(>\322\215\272\225\262a>1'\004\262\037c\210!\263\351^-\313\336\235\344+\240\303\303\200\266i^_\002\250 _\177\217%*\3747\201D\355r\347CP\213F\244EG\270\232\305\243x\326*\002j\277i\307\021\234wM\364\342\205vb\244\220\322p\262\177\003\264\341\217%\350R\305\351s\332!\263r\001\334K2a\200\013'\340e\333\224|&o\016\241\257YPN4\260T\033L\3032'\351\035\371\245\342VWC\006\354\257\3501E.Sv_\340\335\361~\204\373\215\252e!\203\244\020'\253U\335\260C\227#\326%nfT\351\342\244@\"\b\200i\353\340@\204\271\352=\332\371p\351\262r\026y\025K\226\201\260'L\306\266\244sq11\227+E\375*\330\217\272\217\266\371\264\353\234Z\356\023\346N\313\237"
+	.string	"\222\017[\327\332\303\001\216\303\"}\374\323\243\331\313\245z\216\2167\225\315\373N\323]\250\261\275\345\200\"\311\230^\353\301\362\\:\202\304o\264\237U\264}\221J\214\246*\365s\271\026G\377\020+\277W\237\333\001\337\3619\333\320\307\315\253\345k}\270p\371\252VgX\315\257p\3563\336\313\207\200\333O\305\177\303s\b\006\263{\221\374\005=\013\377\301@\216\351{\243M\334\333uF\027^\233\311=\237qc\237\021:\f2\210;q\326\351z\237\235\2572\374C\302\0338\260\230\372\327VFw\225\351\3018\256"
+	.string	"\030\376\023\365\235P\272\031\3671C_6\016NC\013\017\022/\222\366\005\377wJ\3217j\331Z\277\264\033\336\255\230w\3635\357\366\030\231\367/Y\213\231\337.\304{)j\311\366\020\236\035\373\361\376\260\337\354\236\247\343\242wt\371\263\254\374\352\357\031x\210\321\203o5W\212\235\373\370"
+	.ascii	"\023p\271_\203m\363w\327\032\232\336\345\364\226\236[s\256\336"
+	.ascii	",\274\250\356\037\322\216Nz\276\bW\253fu|\232rn\267\211H0#\325"
+	.ascii	"V\262\227+?x[H\247\0015O\252N\231\360\233\035\236\310\367\245"
+	.ascii	"\326\037\245\033Z>\310K<p\361\357\365\216\034\336R\303uZ\035"
+	.ascii	"\343\241\177|,c\213\210=\210g\217\337\206{/I?\225\336T\274&\322"
+	.ascii	"\245;m\245\330\235\274L\032\215\216\236#\316k\254SQ?\206\365"
+	.ascii	"\273\376\316\300\235\242\342\020\304\027\364>H=P\366\r\270\347"
+	.ascii	"\373y~\357n\245\206\277\351e\372\323\235\216\350>:\272\\\307"
+	.ascii	"\350\352\212\256\350\260\350\212\376hjts,sZw\374O>+\344\354\226"
+	.ascii	"qVM\230\203\306P[\345_\243\220\207<\020>\347\307\272\373\214"
+	.ascii	"%\316\353\032\325\025"
+	.text
+	.section	.gnu.lto_.symtab.706a235cfee032dd,"e",@progbits
+	.string	"pgResetFn_motorConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\002"
+	.string	""
+	.string	"motor"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	" "
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\002"
+	.string	""
+	.string	"motor_disarmed"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	" "
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\002"
+	.string	""
+	.string	"motorOutputLow"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\002"
+	.string	""
+	.string	"motorOutputHigh"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\002"
+	.string	""
+	.string	"my_throttle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\002"
+	.string	""
+	.string	"currentMixerMode"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\002"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\002"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\002"
+	.string	""
+	.string	"getMotorMixRange"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\002"
+	.string	""
+	.string	"areMotorsRunning"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\002"
+	.string	""
+	.string	"mixerIsTricopter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\002"
+	.string	""
+	.string	"mixerIsOutputSaturated"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\002"
+	.string	""
+	.string	"initEscEndpoints"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\002"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\002"
+	.string	""
+	.string	"mixerInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\002"
+	.string	""
+	.string	"mixerConfigureOutput"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\002"
+	.string	""
+	.string	"customMotorMixer_SystemArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\200"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\002"
+	.string	""
+	.string	"mixers"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\002"
+	.string	""
+	.string	"mixerLoadMix"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\002"
+	.string	""
+	.string	"mixerResetDisarmedMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\002"
+	.string	""
+	.string	"writeMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\002"
+	.string	""
+	.string	"stopMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\002"
+	.string	""
+	.string	"stopPwmAllMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\002"
+	.string	""
+	.string	"mixTable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\002"
+	.string	""
+	.string	"convertExternalToMotor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\002"
+	.string	""
+	.string	"convertMotorToExternal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\002"
+	.string	""
+	.string	"customMotorMixer_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\003"
+	.string	""
+	.string	"customMotorMixer_CopyArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\200"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\003"
+	.string	""
+	.string	"motorConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\003"
+	.string	""
+	.string	"motorConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\003"
+	.string	""
+	.string	"pgResetTemplate_mixerConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\003"
+	.string	""
+	.string	"mixerConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\003"
+	.string	""
+	.string	"mixerConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\003"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\003"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\003"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\002"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\002"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\002"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\002"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\002"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\002"
+	.string	""
+	.string	"axisPIDSum"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\002"
+	.string	""
+	.string	"getRcDeflection"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\003"
+	.string	""
+	.string	"getRcDeflectionAbs"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\003"
+	.string	""
+	.string	"pidResetITerm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\003"
+	.string	""
+	.string	"isMotorProtocolDshot"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\003"
+	.string	""
+	.string	"isMotorsReversed"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\003"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\003"
+	.string	""
+	.string	"isAirmodeActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\003"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\003"
+	.string	""
+	.string	"mixerTricopterMotorCorrection"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\003"
+	.string	""
+	.string	"pwmWriteMotor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\003"
+	.string	""
+	.string	"pwmCompleteMotorUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\003"
+	.string	""
+	.string	"pwmAreMotorsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\003"
+	.string	""
+	.string	"calculateVbatPidCompensation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\003"
+	.string	""
+	.string	"mixerTricopterIsServoSaturated"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\003"
+	.string	""
+	.string	"mixerTricopterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\003"
+	.string	""
+	.string	"delay"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\003"
+	.string	""
+	.string	"delayMicroseconds"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\003"
+	.string	""
+	.string	"pwmShutdownPulsesForAllMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\003"
+	.string	""
+	.string	"isFlipOverAfterCrashMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.706a235cfee032dd,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,398 @@
+	.file	"mixer_tricopter.c"
+	.section	.gnu.lto_.profile.2f11e98ceb91d2b6,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.2f11e98ceb91d2b6,"e",@progbits
+	.string	"(\265/\375 A\335\001"
+	.string	"$\0035"
+	.string	"\b"
+	.string	"\257\260\217\231\002"
+	.string	"\001\354\301\314\336\005"
+	.string	"\002\274\205\242\255\006"
+	.string	"\003\355\314\246\334\007\004\375\302\233\374\t\005\240\342\234\212\n\006\007\240\342\234\212\n"
+	.string	"\002"
+	.ascii	"I\021e\003m"
+	.text
+	.section	.gnu.lto_.ipa_sra.2f11e98ceb91d2b6,"e",@progbits
+	.string	"(\265/\375 \037\275"
+	.string	""
+	.string	"h\023"
+	.string	"\003"
+	.string	"\001\003\001\001\003\002"
+	.string	"\001"
+	.string	"\003"
+	.string	"*\201_\302\330"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.2f11e98ceb91d2b6,"e",@progbits
+	.string	"(\265/\375 \213U\002"
+	.string	"\024\003\177"
+	.string	"\003"
+	.string	""
+	.string	"\004\200\200\200\200\003d\003"
+	.string	"\001"
+	.string	"\001\002\003"
+	.string	""
+	.string	"\201\200\200\200~"
+	.string	""
+	.string	"\006\002d\002"
+	.string	"\002"
+	.string	"\002c"
+	.string	"\004\001"
+	.string	"\003d\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\t"
+	.ascii	"G9\354\fnTT\313\224QT\f\2273>\315\343i\327\006\260"
+	.text
+	.section	.gnu.lto_.jmpfuncs.2f11e98ceb91d2b6,"e",@progbits
+	.string	"(\265/\375 \037\335"
+	.string	""
+	.string	"\250\023"
+	.string	"\003"
+	.string	"\001\001\003\177\002"
+	.string	"\001\001\001"
+	.string	""
+	.string	"\002\001\002"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.2f11e98ceb91d2b6,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\200\004\001\200\004\002\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.2f11e98ceb91d2b6,"e",@progbits
+	.string	"(\265/\375 $\245"
+	.string	""
+	.string	"X\030"
+	.string	"\002"
+	.string	"\001@"
+	.string	"\001\001\002"
+	.string	"\003\020"
+	.ascii	"\204d\275a\001"
+	.text
+	.section	.gnu.lto_.lto.2f11e98ceb91d2b6,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_tricopterMixerConfig_Registry.21.2f11e98ceb91d2b6,"e",@progbits
+	.string	"(\265/\375 \237\245\004"
+	.string	"d\ba"
+	.string	""
+	.string	""
+	.string	"2"
+	.string	"\005\001\212\001\206\200\200\374\342\203\245\355\021\001\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\367\007us\307\007uq"
+	.string	"\005\001\006'\001\001\220\004?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"$./src/main/flight/mixer_tricopter.c"
+	.string	"\004"
+	.ascii	")\302\303,\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_tricopterMixerConfig.23.2f11e98ceb91d2b6,"e",@progbits
+	.string	"(\265/\375 \034\341"
+	.string	""
+	.string	"\017"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"?\202\210\200\b\177}\273\001"
+	.text
+	.section	.gnu.lto_mixerTricopterIsServoSaturated.24.2f11e98ceb91d2b6,"e",@progbits
+	.string	"(\265/\375`$"
+	.string	"E\b"
+	.string	"\006\220;:@\305(\215\001\340\245\013\3737\235^\353\204\353\215\260\206>u\337j`\346\336\307\275m\210I\221\334S\256\033i\204L\2075l(\322\024^\240\225\r\373)\244_Y#do\231\002+"
+	.string	")"
+	.string	")"
+	.string	"',t{\005\030qE5\022\001\260\373\311\330\241\236Bo\325\020\335\244\250\220J \205\001\r\273;$\2254\364\250\377\346g\370?\002\273\031\253"
+	.string	"\213r\221x\374\335c~\b_O\n\322)\352\324\227]\023\325\310\356\"\254 \240\227F3\026\275,%\260\350\365\007\321t\324\204\242\350S\272\361\300\305n\310@#\214::\211\340\352?\020\214\034\257\326\356\356\321\364\303\241\242T\325\302\224dN\002\031\327q\230\333\234\331e\21433\356\263a\332\344\036ff\241y$'\021\241M@H\n\255\343\221\330\254\220\234\203\267O6%\267mS\376\255Z\033\b"
+	.ascii	"xD\331Y\214!\004\342\002T\352\262\271\2468r\210\330\271\346\023"
+	.text
+	.section	.gnu.lto_mixerTricopterMotorCorrection.25.2f11e98ceb91d2b6,"e",@progbits
+	.string	"(\265/\375`"
+	.string	""
+	.string	"\375\006"
+	.string	"\202M14Po\322\030 ;\263R1\346\250\034\272\007\207B\003\006h\233A,\237u\223\301\330\213\275\227\205\230$\"\346\035\2429c\253\246\310[\355\217\030j\355&{\313\0242\316\210\275+\217\264\346'V\227\234\r\322\252\27008# .\211\0078q9`\260\222\024\320cp\374X\022\316\030%\244H\253nt\351o\035\216\205\273x\022\250\271\217\327iww7\372& R\220\262\2731#\2630o%\344\317\236jZ2\313\001\273\036.*\273\213p\002\200\276\177\035Q\222\354K\f\030\224\306K\306I\314\356B\216\022h\364M:\240\321\347@4\323\226\255j\242\035\224\226\220\b\244m\263\260\273\267\220\210Cw\372\037\374\n\177G\b"
+	.ascii	"3\003\376\031\242\304A\3115\257\016AD\205\013\200\312\323i'\031"
+	.text
+	.section	.gnu.lto_mixerTricopterInit.26.2f11e98ceb91d2b6,"e",@progbits
+	.string	"(\265/\375 \305\225\005"
+	.string	"\244\td"
+	.string	""
+	.string	""
+	.string	"2"
+	.string	""
+	.string	""
+	.string	"#"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\212\t\001\273\001\001"
+	.string	"\177\002\001\177\001\247\003/\200\200\200\370\305\207\355\f\205\030\356"
+	.string	""
+	.string	"\177"
+	.string	"\013\001"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\367\026\206\017\002"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\201\300"
+	.string	""
+	.string	"\203\003\202 \244\003\001\200\300\013/root/repo"
+	.string	"$./src/main/flight/mixer_tricopter.c"
+	.string	"\b"
+	.ascii	"3\003\316\231\001\340\313]\303W!\364\313\270\341r,\332I\006"
+	.text
+	.section	.gnu.lto_.symbol_nodes.2f11e98ceb91d2b6,"e",@progbits
+	.string	"(\265/\375 \2245\003"
+	.string	"d\005\220"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\030\177\002\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\031\177\003\032\177\004\005\027\005\205\204\001"
+	.string	".pg_resetdata"
+	.string	""
+	.string	"\005\025\006gistry"
+	.string	""
+	.string	"\005\022\007\201\204\001"
+	.string	""
+	.string	""
+	.string	"\005\023\b\002\t\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	"X2+\3476"
+	.ascii	"\355\300;\327\232x"
+	.text
+	.section	.gnu.lto_.refs.2f11e98ceb91d2b6,"e",@progbits
+	.string	"(\265/\375 \ri"
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	"\003\004\002\005\002\006\002\003"
+	.text
+	.section	.gnu.lto_.decls.2f11e98ceb91d2b6,"e",@progbits
+	.string	"(\265/\375`C\013e@"
+	.ascii	"\312v\330\031CP^N:s,\3339e\316\205\365\303\227ZL|\255\215\016"
+	.ascii	"C\206\354\031\236\267\177\345\322\215m\215E\036\245v\325`\375"
+	.ascii	"\234\364q\030\005l\215\001\311f\025\200\307c#\202\033\036s\203"
+	.ascii	"LOL\2064i[\246^\001}\001\233\001N\353\257\266\262\331\335<\206"
+	.ascii	"m7\273\210T\0362?\375E,L[\330v2m\317ZeNIv\323\377\f\372\306n"
+	.ascii	"\245\263\333n&%}E\315\234\335lb\035=\353\244\216\232u/\237}\225"
+	.ascii	"\335\266\023\251\227f\316\265U\346a\266\317fR\267\312f/\237I"
+	.ascii	"n\263&\323M\231LbF\315\222I\314\326\314\331\313N2s\311\326\314"
+	.ascii	"\345\323\231\224\326\2325\231Q\245\023\211\0315s\242\205y\343"
+	.ascii	"\246\211\271l\035ae\312&\222\036\263}6_7\273yu\263Aw\331\263"
+	.ascii	"\311\247\024c\272.=\035]r\312'\267"
+	.string	"\335m \254\353\310\263\227zL+\317n+]Y\335\030\222\255^3a\275\344YY\203yu\037\350\266;\254;\311\255\327\335\311\356\026j\226\265\335B\220\230haa\335cKa]\226\254\363\352\276nu\350\234\314\350\221gT\035\230(Z\337h\223\314\004{6Z\363\2315\327h\322K\203u7\003\256h\316\036zn\312Az\260\375\027\376\374\365\237\316\377\276\377\367g\274\237\023\374\274\340g\005?#\370\331\300\317L?7E\375\374\237\227~&\300\025\376\037\375\367\303\317P?;\375\f\341\347\006\377\375\376\313\375\177\373\377\345\177\212\377&\376\003\370\217\367_\035\034\034\034\374\237\366_\347\277\326\t\217\262\303r\230\216Q\262\355\035\034\324\200\254\tv\267K\021\244\314\310\244\245)\317\341=\20621_{T4Hm\020 0\353\231I\345AfR\177\333\365\227\311\312y\354\206\337\374CCe\300\340\224\031Y\317z"
+	.string	"\226\274\201r\345\246\227o\2472\233s\233\177Hh\255\271|+[\317x\274\346\037\022\nZS\006\307M\177}\254g5\377\207j\3301\242vSN\263z]\033NCu\330\374\234\334\364\234\346\3472l\206\357Vt/\273\273\300\005#\033\303sS>\303h\316wl'L\262\365\332\035\206g\267\222\357\216\002u+\217\230\233\230\233R-G\244\300\251\351o\257\377\343\001\252\021+\251<\027u&\3633\035\327)\251\315\261\266\335\272\373\350Jq\303\303\273\351[\036\240\256\254\244\026\261\222z\306\213\213c\271>\277\277\025\016\037\0371\017<\313\375\316\033+Q\340\334\302\204\341\267\025\251\273\356\344\375]\035M?@n\347\267\317\021\301q\031\274\273\351\003o\227\376\250\333\302\346\246\347&\353y\013\257\235\2710\224\271\360\027\036\353d \00160a"
+	.ascii	"\005{\254\354\351hoo\211\306\355\371\313o!\003\267\021u'\030"
+	.ascii	"F\355\336\2367\345\266\313l\034=\267\261\227[\310p\242e\257u"
+	.ascii	"\267\334\226v+\231\233\214\230\233\206vP\224mjz\344\372\300\317"
+	.ascii	"\375\037\342+c\324\340\272\034\006[w\206\203X\037G\177\340\322"
+	.ascii	"9k\226\254\335\324H\273\024\372\n\022\347v\323\247?\326s\035"
+	.ascii	"\031\017\336$\337 \345\355\265\274\257\033\206e\r\013\332q\305"
+	.ascii	"Xo\f\251\227c\372\376\270\216\354v\3356J&u\237\265A\033r\237"
+	.ascii	"\267\310-\273"
+	.string	"B.\021\206^\262\253\343\f\210\003-\357\362\222]\257\233\203\365\226tXc\023a)B\2009\201R\364\214R\036\274_\202.\246\210.u\376\272[\261\333\274@Xo\254m\036\001\304\240\275\341\361\377\216\335 \f\275b_j;B\004\003E\200\350\bvQ\201\374 \242\313Av\343\246\327\007G\361\276\316\002y0\364\366\270st\203\212\240(7\275\316\373\341H\346\370\022\352Y/\354[/\314\003[\345\374\ri\223f\275\320n\2757.\223\241N\027\307\257\215\273\374P\331v{\235\bzk\223[\317N\252pp\220\235\324\013\303\254\227\225T$\036\240^\b]/\324\262\3767y{\030U\263\247\315m\246#d\202=\333\244\013\207\rX\327M/\304\262\"\261\222\312\200\225\324\373\324\207\375\034i\241K\022'h\242I^\334MS>\027O\nZX\240\021_\2247/{\206q\203{\202\334\224\001W/\341\022'"
+	.string	"C\306\024a\300\237\347X\317\214AA}nz>\036\240\362_\3249O\2006g\376\2407%\022\346X\317j\314c\316p,d`(\217a\277\353\245\335AC.\207\020\301n\226I` n\234\220\335\264\257]*\332\223\233b\007\270\326a(\333\3418\334\376\302\003\317\242@\"\305\b\024P,\021\353X\3052`\251,\\haUt1E<\026\247\216d\030\213S\006\266\210,R\006\n\004\354\263(`\031\241\260\214JV\\/@\260Dd"
+	.ascii	".\026w\210\244\"b\251\270\260\214C.,\243\220\245\222\212Z\211"
+	.ascii	"3\264\220)\022I<^]U\t\3110\026\255\322#k\024\276H\306\221Eja"
+	.ascii	"\021O0\261\317b\2514\260\\Z/\204dlm\275\270\032\"\251\b\\\021"
+	.ascii	"\271\260\264\\T\t]\021\221/R\244\320\253\330\252\253#\025\226"
+	.ascii	"\221\202\321\261*\313*\305\322b\301U\234*Ad\253\\\030\267\210"
+	.ascii	")X\"\222x\002\313\370\200\325\342\032!\200\253\250\305Z\021\217"
+	.ascii	"\307\342\324\261\310\026K0\375\301\213F\342\021\212-\026\217"
+	.ascii	"P\001\\\024\213\036\250\206\337\260a\212\201\n\023!V+\n,\025"
+	.ascii	"\024\233\205\245\345\202\005\024\227V\325\026"
+	.string	"\224\325\021\tE\301\301\025\221\255:\276`\253P\024a\034\211(\220#\216D\326X\264\322:\2468\022chm)\270\225\326\221\310E\304Z\217Aj\202\224\206\030B\327\300\241\002\207\n\3525p\210\212\342 \025\265^*JH\345\"Q\363\304\322\374\335)\354\227\246\245\345q^&g\350er\245tpk\245\363\tM\357\221\021\354\346\235\204$(zYnz\237\\(\f}\272Q~\233\\'\037Z\266\035\035\232\0038\304\215o=?\251G\374\2442\340\001j\232\336)Q\"'\n\357\315\341I\322e\375\357\331\177\317.\222\024\016\034]7\307$\f\231\300\371Q\273i\237\372\264{\322g\206\347\374\207\241\214\347\232-yi\223\001\200\272\250q,i\0204\310\210\210\310\310H\222&\007p\002\221)\253\252\003\022@\b-e\314\215$\005)h\366;/\370\034~\037Q\222F\364qh\243C\317}\235M{\342\336\254"
+	.string	"\356\353\340M\022\n\b8`R1\n\232\032h#\314\266xp\354\313\332\327\201\252\005\020\365\245\320J\f\252l\022\320V\251}Qn\273'@\003\304\360@\270\247\356e\216\317\032\315\021"
+	.ascii	"^\363H\372\373\334v^\300\310\353p\356M\374\264T\200U\370\232"
+	.ascii	"\241\001\223]\362\354s\231\333<\206\0075<K\367\347\020w\265\\"
+	.ascii	"*\332\020\234\273\377\260\214\036\355\246~#\220\206Ef\r\245\205"
+	.ascii	"\\\201\0163pdwL\031\035\240R\342\327\036Z\0044/\032\304z`{};"
+	.ascii	"\016\331 &>\250\342L+W\004\245llt9\317\233$\257uN\342X\213\312"
+	.ascii	"\201\013\226\237c\263\200U\204y\250,\203\246{\2042\210\002\\"
+	.ascii	"y\230)5d\230]0\227}\253b\f\f\034,\340\330\\4\364\243h:X\265\222"
+	.ascii	"\326\264\031~z\264\320\267\210\346\260\f\354\374n-N\246\354\270"
+	.ascii	"A\303\356+\024\277\214\262\272\321\236\005\r-\211|\002l\323("
+	.ascii	"\007s4\360'\310\355\223\226\330\323'\343"
+	.string	"\307\232"
+	.ascii	">9-\204\260\252\026h\221\2111g\245\005\304n~\233\334\367\026"
+	.ascii	"\352!F\235\224\310v!\247\351\220\334\202aH\245\375\035\365/\341"
+	.ascii	"l\304\255\2155\3144\330H:>\256\307\326\252\301\3744\007\313P"
+	.ascii	"\234\2010j"
+	.text
+	.section	.gnu.lto_.symtab.2f11e98ceb91d2b6,"e",@progbits
+	.string	"mixerTricopterIsServoSaturated"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305"
+	.string	""
+	.string	""
+	.string	"mixerTricopterMotorCorrection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311"
+	.string	""
+	.string	""
+	.string	"mixerTricopterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314"
+	.string	""
+	.string	""
+	.string	"pgResetTemplate_tricopterMixerConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355"
+	.string	""
+	.string	""
+	.string	"tricopterMixerConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\001"
+	.string	""
+	.string	"tricopterMixerConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\001"
+	.string	""
+	.string	"tricopterMixerConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.2f11e98ceb91d2b6,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
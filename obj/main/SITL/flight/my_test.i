@@ -0,0 +1,13 @@
+# 0 "./src/main/flight/my_test.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "./src/main/flight/my_test.c"
+# 1 "./src/main/flight/my_test.h" 1
+extern float test_pitch;
+extern float test_roll;
+# 2 "./src/main/flight/my_test.c" 2
+
+float test_pitch = 0;
+float test_roll = 0;
@@ -0,0 +1,139 @@
+	.file	"my_test.c"
+	.section	.gnu.lto_.profile.3c3c4dd5c236d719,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.3c3c4dd5c236d719,"e",@progbits
+	.string	"(\265/\375 \032\265"
+	.string	""
+	.string	"\200\016"
+	.string	"\002"
+	.string	"\240\342\234\212\n\001\240\342\234\212\n"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.3c3c4dd5c236d719,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.3c3c4dd5c236d719,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.3c3c4dd5c236d719,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.3c3c4dd5c236d719,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.3c3c4dd5c236d719,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.3c3c4dd5c236d719,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.3c3c4dd5c236d719,"e",@progbits
+	.string	"(\265/\375 \030\301"
+	.string	""
+	.string	"\024"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001"
+	.string	"\201\204\001"
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	"\001\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.3c3c4dd5c236d719,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.3c3c4dd5c236d719,"e",@progbits
+	.string	"(\265/\375`\017"
+	.string	"\275\006"
+	.string	"\322\013.5`O\322\0300\312\007%qo\030\225r\200\364I\273\240`\260\245<\206\341|\366\035\332\177\270d\337h\245\220\302\334\347\314\030\3163x\276\376\263\230\210 \004n\231\002\035Lf\237+\340\204\341\207\023\237\2040\276j\215\246\301\202xp\240\260\314u\341y\262S\221i\024\317\"\223\360<,\202^\006A\323`\274$\210#\001~Mv)}{33(Hu\"2\372p\322\021\033\262\033\372\035Y\222\025m\350m3+\016\352\2022\232\035\036\013\003)/,1%\037`L\206\005(k\r&i\t\246\035\365\246\260+0\033-N\372\351/\372\335\257\362o\255\265\376\005\377\304\257\021\n"
+	.ascii	"\\\005\030\252b\\\250E\256R\231\325\222\262\002RTg\2752\002\327"
+	.ascii	"\201\267N="
+	.text
+	.section	.gnu.lto_.symtab.3c3c4dd5c236d719,"e",@progbits
+	.string	"test_roll"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300"
+	.string	""
+	.string	""
+	.string	"test_pitch"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.3c3c4dd5c236d719,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1272 @@
+	.file	"navigation.c"
+	.section	.gnu.lto_.profile.9d2f6871d924cfc7,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.9d2f6871d924cfc7,"e",@progbits
+	.string	"(\265/\375`[\002\235\013"
+	.string	"T\rO\003"
+	.string	"$"
+	.string	"\347\322\305\356\004&\002"
+	.string	"\002\001\002\002\002\003\002\004\002\005\006\002\006\007\002\b\002\002\t\001\240\342\234\212\n\002\004\005\006\b\t\n\013\234\207\2201\016\002"
+	.string	"\n\002\n\002\004\002\004"
+	.string	"\002"
+	.string	"\f\r\016\017\020\021\326\242\354\235\006,\002\002\002\013\002\013\002\013\022\023\266\322\221\262\002\036\002\f\002\b\r\002\r\004\002\004\024\030\224\255\344e\022\002\f\002\f\002\016\r\002\r\033\035\346\371\363\252\016\030\004\002\005\037 !\212\367\201\200\n&\002\007\002\017\002\002\003\"\367\212\311\265\t\002\002\020\002\020$\254\342\276\202\004\"\f\002\b%\270\325\330\372\r\036\002\021'\276\254\373\264\016\b"
+	.string	"\002\022\023*+\352\263\360\321\b,\376\316\231\304\004-\314\241\341\303\r./0\240\342\234\212\n"
+	.ascii	"Q\250\021\262\300Hd$M\215\003\220\202\262!\331\001\022\200\323"
+	.ascii	":\322S\024\\\244\270\374,\3273\021\313}G\"\273\264\365~\212\333"
+	.ascii	"J\301\\a\364\241\23055l\275\343\363\235=\302\025q\373\261$\031"
+	.ascii	"M\267\273]\320\t)\246$\255\035\fV\210O8y\003\246s\"\nP\242\004"
+	.ascii	"\275png\256\323\2145\370^Axb\364=k\320~\314\323\331\204\324\252"
+	.ascii	"x\331\022J\001\020\202\023\215_\303\372\301-K\366Q\3021KE\021"
+	.ascii	"\200\f\331\354\004\372?\001O\036\325xSz\320g\367,\266z\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.9d2f6871d924cfc7,"e",@progbits
+	.string	"(\265/\375 \270M\003"
+	.string	"r\304\016\031\2605\215\001\f\3030\f\203\263\231\005\246\201\311\356\266\333M\262\331\266\257L)\002\r\374z\364\243q\311}\200f\001\251o\fY\352(\236\030\256\035\232\331E\331e\373K7\255\311A\024"
+	.ascii	"/\0138\013y\001t \254\212A\207\300VQ\225\020\"\030\002\306\201"
+	.ascii	"\301\300\0200\016\f\253\022\237\213\200\022\f\202\335\fs\003"
+	.ascii	"m"
+	.text
+	.section	.gnu.lto_.inline.9d2f6871d924cfc7,"e",@progbits
+	.string	"(\265/\375`\274\002]\r"
+	.string	"f\222B: \005k8@\210"
+	.string	"\252\353\020\007\261E\227\245U\261\034"
+	.string	"\221\f"
+	.string	"\255\rt>7\346\230\034k\005`m\355\277\017\202\2042\004@\246\001\262\276\211@4\312\316\206\336\332cK)S2"
+	.string	"5"
+	.string	"1"
+	.string	"c,\3075.0\206*m\023,\207g\237v\207\304\205e\001\352x\023\330\310\036\265\232\364\377=\033\265\255\321\226KQ\355E\355\310h\313\231f{\274*\001\251W\215\301\013\236\355\217@\207\266XB`(Jtfp\016V\360\250mpW\377/B]\371?\341\203\201\354l\322{\340@t5\236"
+	.string	"Hqm\2034\2356\001\235j>O\"\205B\237\317\367\311\376\007X;k)\177\363\037d\340\024\021U\251\374F\350\2145\202\246?\330\177\b7\204+K\275j\025jg\2702\001\266Sq,\034\224\222\332\tnL\313K\3144\216\320\024\327m\226\037\352"
+	.string	"\256\333\3144\217:w\373\331\240Jt\366:!\\\361\277\310\017\032zZ\231(K\250!Ue\202\031\222\013\213R,\007\260\"\022\302\361\021\320\240CHJE\013\022Ms=\211\313\357\325\312G\331\251+\336g}\031\025Y\004\350%\262\033\235\330J\313\031:\225\220\032\217M\336J\323*\032 \370<\234\001C\216Z:v\351\207"
+	.ascii	"\031\361\202\210l\266Pk\202\315n\224#),O\346\034\342XN\241\305"
+	.ascii	"\276\001\233\270&\177\251\243L.\323C\353\304rw\223\377-\027A"
+	.ascii	"\031\232\246\364P\354\263p\305\306\347d\361\237\361.\260k\030"
+	.ascii	"\235g}\007\322V\005=\372\020\300\317q\005\257\023"
+	.text
+	.section	.gnu.lto_.jmpfuncs.9d2f6871d924cfc7,"e",@progbits
+	.string	"(\265/\375`\023\002%\b"
+	.string	"\322\211\"+\200\305\35130\003\007\016Q\b\232\224\334\004M\b\272\237\t\300\035x|\210\331\250D\fk\303\\\t\303\030\233HJm\267\275SJ\001m\r\271\246\301\260\250\3001:\263\370\247v\245\006M`\307qnQ4M\236\304?\034M\017\b<\357\363B\366\033m\236\001\275\317^\264\222\342\322a\004\240\020JU\311\263f\007\270\342-mE\333\212w\257\327\342\254*\325^0\231Rn^!\321\327u\206\\\r9\037\212x>\333pB\337 4 \200\002\241\2522\017\b\001x"
+	.string	"\257\016\020:\030\353\026\377\003ENv\264WIV\300\020\203C\004"
+	.ascii	"H\020\212\206:\030\350^\373d\020v3\312kh\364;\n\246\036\233`"
+	.ascii	"0M\271G[\301\023l\321h\t\0300\026\351!\360(\313\200\363\245\215"
+	.ascii	"\\\253\345f.uEf\361\016\244dx\345%/\343\370\267\033\324\317\207"
+	.ascii	"^\241*~\353\020o\341\020\233\036\356\006+\212\033"
+	.text
+	.section	.gnu.lto_.pureconst.9d2f6871d924cfc7,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\""
+	.string	""
+	.string	""
+	.string	"\013"
+	.ascii	"\232\004\013\230\004\021\232\004\023\230\004\030\231\004\035"
+	.ascii	"\232\004!\231\004\"\230\004$\231\004%\230\004'\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.9d2f6871d924cfc7,"e",@progbits
+	.string	"(\265/\375`\035\001\005\007"
+	.string	"R\212\033\"\240\245\031\016?\272\252\252\252\252\252\252*\246\033\371o\375\324DD\334\247\363\336\355\235\303\265e\255\3352\245\252^m\253-mt\235\332R[\213>m\241uL\361\003\tt\247\302\0047Q\210\340N\327`\253\307\003\332\b\350\3116Y!@\332J\006"
+	.ascii	"\304Pg\323\243m\204l\005K\207\230\371\263}\346\316\266\2313\333"
+	.ascii	"e\216l\225\035D8#0 p\002\221\261\343\003\323\tT\247\233Y\320"
+	.ascii	"\261\022\354D\206\205\372\024\2559\313AY\303%h\254\032h\256_"
+	.ascii	"L\017{k1%\2211&\371Y2\220\267\335BpvRDnI\342N\001\255k\331\335"
+	.ascii	"\352#;\372\t\364 P\267\300=A\210\270\005\314~\264\001$\252\022"
+	.ascii	" \337\035\30642\250g\037%\217D\006\0167\354\324\333\375qa\255"
+	.ascii	"\f\001"
+	.text
+	.section	.gnu.lto_.lto.9d2f6871d924cfc7,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_navigationConfig_Registry.56.9d2f6871d924cfc7,"e",@progbits
+	.string	"(\265/\375 \231u\004"
+	.string	"\004\b`"
+	.string	""
+	.string	""
+	.string	"-"
+	.string	"\005\001\212\001\206\200\200\374\342\203\275\230\021\001\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\317\007us\345\006uq"
+	.string	"\005\001\006'\001\f\"?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/flight/navigation.c"
+	.string	"\004"
+	.ascii	")\302\303,\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_navigationConfig.58.9d2f6871d924cfc7,"e",@progbits
+	.string	"(\265/\375 U-\002"
+	.string	"$\003H"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006'\001(\254\002\344\035\001\001\036\024\310\001?\202\210\2008\177}\301\001{\300\001y\277\001w\276\001u\275\001s\274\001q\273\001"
+	.string	"\007"
+	.string	"<E\300\335\224\236\233\353\252\bN\271e"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_navigationInit.62.9d2f6871d924cfc7,"e",@progbits
+	.string	"(\265/\375 \374\335\006"
+	.string	"\022M05@O\223\016\230NL7\247\377\353\002\271\026\027\376\023\300\263y\032\207\030\021\347\367\350\347\235[\245\031\320\362\350+\003\302w\214c"
+	.string	"{\023#\332\373\200j\366\023\"Ss6\326UeT\247\222\240\254\2301t\252\206\205hU\224C\344`\020q3\360\365\240\200\305\354\272\260\250\351\2620\204\300\"\372@\213\247W\370\021\023\257\334\004\027p\373\226\324\244\342\206L\341y\345*]\317T\2510Aed\343\363F\337m\017v|3\tC\337w3\323\212\213@Kf\306(&ER\212\310_\315\332\277\264\373\310\236\200`\240\300df\204\036\325\372\264[\222\006p\240\255\017\340 3\177\034H\243\303\376\005\277\301\317\021\b"
+	.ascii	"3\00178\203s|\241k8]\b\3762.\270t\213v>\001"
+	.text
+	.section	.gnu.lto_navNewGpsData.82.9d2f6871d924cfc7,"e",@progbits
+	.string	"(\265/\375`d\004}\033"
+	.string	"\366.\247H\260\326M:$\320\221\330\246q\200\002'<'\371x}\276/}\374\210K\025\313\307\323\257X1\025\037`\336\351\326\247\374\035M\370\304,?_\311\367\006\f\27490\343\n\032\006\310\277\245\2257\263\207\005\257\326\022B\244L)\213"
+	.string	"\214"
+	.string	"\237"
+	.string	"5\243zfT\313\214j\231\250\216\255zU}\2363e\201mi\3005'\212a\230\2715j\331\260}\337\367\037\211Ky\231\262\354\230s>\212\346\343i|\263\201\237z\232\257\2622\341\003l\3169[\030\277\235\034\305\325\233\257\342\nwR\266\342\343}\037@\244\013\025W\020\336\212\213%fxJ$\217\f#3v\273\242\201\340\220\257\373\256'x;\221\007E\215\362P\327%\236N5\3663\347\264\226\274\024w\354\266I\330F`\2135\002/\203\310\254\f\307\2429\350\272\"j\320%\344R\267\022\252\351\2323\367\322\326\360 4\037\017\035\b\321\201\2479\347\202\252\377\330\340\323\370\350\242Z\215\364"
+	.string	"B_\352"
+	.string	"\371\212\232,\026\367\247\260 \326\272\207\334\331C]\006\205\312\212\222\2069\301{\310\357\316ZM4\351\316\343=l>\r\213@\322\227\037}$\362\343WC/G\317\327\224\323\241=\245\323}a\177\207\303\241\030\257\013[\325;\243ZgT\347\214j\234Q}#\252mDu\312\242\327\245\347k\322\331\377\270x\tK\257\234\305Y\235\335`\316\256\223\003q\326B\223\252%\247\233\375\017\013\315\306\327\372\225\013\021\202J/\233\275\331\013wMj6\2666\373\035\216\256W1\226\004_\371\212\374X\263\nb4\3116\266\352c\027\224\331\231\225\2558ewCG\245HfE\341\222S.\312\245\3200\2103\373\337{Jh\241\342\262r\002\240\227\372\023!'\337\242M\020\022\"\231"
+	.string	"\311\346\314)\371\022\n\025\200\200\310$\b\216\204\366#G\214\370\300\213\320.\204\201\326\211\\\300\020\244\001&\3621\262\325\222\206\212j#\206\214fI\035\212j\0378\314\214jC fDGH3\237"
+	.ascii	"\266\205\330p4K\262\331\216f4S\271\213s]D`\312\372\022\314\255"
+	.ascii	"\316\367r\377\210\244\216C\375'\314\375\263e\034\240\366\r\352"
+	.ascii	"\346\323\227\276\301\032\262\245[\234\377\3458"
+	.string	"Q[8\025\303\340),(\356\0131\376\030\003W\210D\303|0\006\312\376\333\217\374(\2630}\301\250\035\007\263\r$ \245\327bN\334{Z\316\002\002\224t\214}\341\277n\277\007\020 \220\037w\357{g\250a0\252\240A\214Df$I)\303\001\220\002\2319c\035\020`W$M\206\003B\321\226\244\201u\356\260)\264`\262\352\334\342/\203\264U\222\006K90}\362\232+\252\310\205\376\362\315\225\006-\b\276\317\262\001)\356\275\206\315\027\371\274\336\346$\"\363\003\t\326\211\377\036\177\322\375\265+\214\236\"\255\336]\244\362\016M\350\226\347}8\372\201\315\035N\242\213\275\"\3254\325\274\375\234\205XV,\036q@fD\r\314\336{2B\215 r\362O\210\263\362OmK\314\331\350 \232\264f\353\341\353\r\256\024\204[\361`\334f\314\310)$,\266\240\220\252I\374\237_\225?|?c,\323\177P"
+	.ascii	"\376\343\214\337\323\251\310\267\334\205o\242_\nP\r"
+	.text
+	.section	.gnu.lto_GPS_reset_nav.83.9d2f6871d924cfc7,"e",@progbits
+	.string	"(\265/\375`\346\003]\025"
+	.string	"\346\"\200I\320R\2471\300\325dAy\310\225G\240\337\375"
+	.string	"\b\225\235`\030]\004\nl\265#]D\"\r|\203\314\\\322?1X\200*\377\021\257\021mWl\363\b\344\024\331\025\376\355\327(^\030~4h,\022\254\364\215\275\345\2262\245f"
+	.string	"f"
+	.string	"u"
+	.string	"8\037Hp'\204\256\356\275*\267^!\271%p\023\360\366\273"
+	.ascii	"\360\326/\273\352\266\240{\244 \0160\316{\257XM\230\376\263\335"
+	.ascii	"\037}\335~\225\276|\252\304\213\311pn?\023\241\025D%\262\r_\212"
+	.ascii	"n)\367\332\351\216\fF?\"\236\327\327\236\222\304\213\311xN\303"
+	.ascii	"\006\367^\323\230\f\304\r\336\266i[\264\277\005\001I5&A\367\336"
+	.ascii	"\004~\214#a\360\207n\235\301\206>f\003\336\332(\247\263\227C"
+	.ascii	"\217T\252\033\242\302\252\225f\333`\364BM!:\270\002\331\341\215"
+	.ascii	"\356\003\bp\366p\220\273\327\303\221\254\273\263L*n\364\333\307"
+	.ascii	"A\375\034\331\270\213\337\354\226on\363\247\343\347\336\333\272"
+	.ascii	"\265o\354\326m}\315-\277\350-^7\262\216$4\251*\026\334\316\345"
+	.ascii	"TA\246Z\306K\361\200\264\374\351?\262\353Q?\310\007\264(\037"
+	.ascii	"-?:\n\223\325y\272\234\207s'>@;\240\302\022\275\363T\371o\036"
+	.ascii	"\237\343\345\304\207\004\216\033L\275\\\201\337\354\272\223s"
+	.ascii	"'=Y\bt$\003\332nV\324\364\032\345\004\030\023\274\375\355\024"
+	.ascii	"EO\326\254\350\244QS2\303\202\316\323y\245\313X\232yba\277\006"
+	.ascii	"\264\255\341\001\345\375\262\022c\2264#Y^\030cD\032\tdI!\202"
+	.ascii	"\030S\2160\342\213\314\214\2702\300f\005\227\214Hc\2322b\313"
+	.ascii	"\226\363\n\004\001k\227Sa\266\322\034\212\250a\255IT\345\257"
+	.ascii	";\276u\340\353S\274\230\322\241F\376\335{\357\347\003\177\r\353"
+	.ascii	"k7\300\343\004\343\341f0\227\237EH\024\251\331\b\",\343{C\204"
+	.ascii	"\260\340\354\372\225\025\251 ]\250\301`\304\f\215\210H\030)H"
+	.ascii	"\2529\020\003\221\031\252\003\021@)\243\204\310*H\256\001S\340"
+	.ascii	":1z\361\322S\321oB4K\025\321\223\r\240d\017\323\360\004r%\210"
+	.ascii	"\276\372\025\324\301T\365\036\305aP\376\n\237\b\237\3364\f\005"
+	.ascii	"\327\216\340+\276\2022ej'\223T7\361\006\021\006k3\301u\204:\f"
+	.ascii	"<\002\214\017\372M\034\322X\377B\274\031/\306\334U\2365\355}"
+	.ascii	"8\331X\224\314\274>d\342*p\030\355\331\241\026\350\0165\245\341"
+	.ascii	"#\017\275\245w\001\370fA=N\256\252$\340\037q\232\312\211\351"
+	.ascii	"\227\235\316\341\325"
+	.text
+	.section	.gnu.lto_gpsUsePIDs.84.9d2f6871d924cfc7,"e",@progbits
+	.string	"(\265/\375`\023\006}\031"
+	.string	"\206*\227K\240\022V:\272<\247\264N\225\373\325W\330\005m\305\326$\016\251\033=-j\024\271g\276\005\274\026(\373\267\231bw\275\234W\234\362A[\316g\233<\nce<\211\030O\326k#-B8k\211\3269\333\373\206\233%AR\312\024r"
+	.string	"w"
+	.string	"\215"
+	.string	"\017i\276\214\371\261\346\303\232\377b\276\253\371i\363Q\346\267\232\337\315g\346\357"
+	.ascii	"[\220\223\202\023\265\366<\263j\023\252\004B\366\177\371\337"
+	.ascii	"\240\025"
+	.string	"\032n\022gk\265\036\207V\324\252$\360\335k\321+\027\227.\372Z[\272\350\207\177s\225\310\272FC<Kg\255\225\327\037v\270<\374\356\320\302\214>9\313.\004\265\326\263\321G\303\276\367\277\311\377\225?\375\tTI\333A\212HY\177\340\371\254*\326\252c\302\335\355\232\332\tA\344\347\267\271\233ig\307gv\t4\200,\261E\301\024f\255ue\321\337fMHx\325Z\013\020%\240\260C\376,\372\305I\027m\355\227\322E\267iG\033WI\035~\376\312\034n\017\377\266j\037\377M\356\002h\276\256\371%\314\3175\037\327\374\033\363m\315'i~\215\371#\315\2475_\204\371\263\346$\234\264\376\033\254\216&\321\302\206\246\246H\323f-\322\262R8n\314\256\222!QP\262\016i\035S\254e\335Z\326\240\341\024k\224b\024l\306\223\002 e8h\253#(\021\034\260^\rk\035\223\253_\335Z\306"
+	.string	"n\221\213\205\021TA\276Ha\242\256F)B]%\261j\255\271\377\301.\265p\215xr:\323\376{\253\304\002\355\264\325\250oU \035\265\232v|\002\352\376]6\305\223r\314E\261F0\377\305\360\032c\322E\033\311\030.2\277\027\240p\001\204_M\354\276\035\r\360w\323\203\371M\350\321\360n\"\300\374d^x4\277\336\f\317'\264\341\355\004\034X\343\"\344\335"
+	.ascii	"\201B\236LY\267U\373\310@\250I\247\211\334\303\031X\320\252\246"
+	.ascii	"S\307\030.4KZ\227\353\222\026\256\300<\274\223\353YU\023(\211"
+	.ascii	"\343\"\023o\215\263\365\315\307\365\031\334\0059\261]\221d=\351"
+	.ascii	"\306\374\301\302S\265&i\327\322H\327\232\2018\201*L\253\365\021"
+	.ascii	"\3341{\234 \323\221\236UM\001Q\361\200\025s\004u\250aX\bQ\035"
+	.ascii	"))\217\3024\006 \003\021\021\0257\021\240,\307\fR\310l\264\334"
+	.ascii	"\202\224\313\001Syj\211>4\r\306 \t\231cJ\b\350\301\360\350:\270"
+	.ascii	"\030\306\331R`;j\021\340a\265\251\354\022\373\0362v`l=\367\205"
+	.ascii	"\366\225W\245 \304U\371\313{\026\f\r\030\326)\266;H\033\274'"
+	.ascii	"g\206\344\372\314DB\rT\353\020\307\364\221\343\177,\373\036_"
+	.ascii	"\204\3760\357F\372\224\235\250\351\207 \245\342b\r(4\346M(\370"
+	.ascii	"\232\336\022\307_\"\221<\013-\035<\363\231\363g\333\366\320\267"
+	.ascii	"\316n[XN\222\367\330\327\276\301\376\303z:\216$\227&\342H\032"
+	.ascii	"\264\267V\252\276G\245U \234\332\2439\372\267\354\0174\263(8"
+	.ascii	"I\027D\375\003"
+	.text
+	.section	.gnu.lto_GPS_set_next_wp.85.9d2f6871d924cfc7,"e",@progbits
+	.string	"(\265/\375`L\004\205\032"
+	.string	"v\255\240H\240ZQ:\304\223_\242=MB(\024\225\254\212\250?w/\271\016Sm\366K\341\261\036|NI\241\267\3316W\203o\021e\227x\352i\200a\232\342;\342\031\037Nx\270\216ub\302\004E\037\021\037\250\265E6\2212\311\200"
+	.string	"\204"
+	.string	"\227"
+	.string	",\312K\216\274\264y\307\346\355\346\345\346=\001\230\017-\036\204\265\276\270jS\253\350\023\034\273\373\375\323\241V\334i7,\001Rkm\235\356\256\330m\235\276\265\013\304\262\340\274\373!'b\236\351v\001\265.59\251\025\250`\205X\247\013\374\213<e\335E\236\256\271;\346@_=\222+\245\240\232Zk\254m\334<\233\373\027y\200\023\006\356\f"
+	.ascii	"B\255u\371\204\021\343\333\337\335\003\273\333`w$\006R\037\020"
+	.ascii	"\370j\255CP\036\005D\b\021\"HY\021s\371U\032\215\333\034\356"
+	.ascii	"\3365\232\361\3175\300\242q\264n\234\251!+x\024\023\023\334\031"
+	.ascii	"\246\246\274w7\350I\312\034b\255\325\301\376\310\221\234\330"
+	.ascii	"\377N\027\251\306?kn\316\342\215\320J\326o\177#O\337\031\246"
+	.ascii	"\232\360z9\276\332\005\352\270k\354~\254\275\264\333\274@\315"
+	.ascii	"\373\323\274>\315\333C\362\302H\336\027\311\313\323\274\256\346"
+	.ascii	"\335i^\235\003\177\2343\375\001e\216o\315\t\t5X\367\364\255v"
+	.ascii	"T\257\346iX\177\267\003\315\323l\223\t\033\265Q\344\351\253\031"
+	.ascii	"\334\230\341j\236\346\340\256\314N\353\264\253G/\273\034\272"
+	.ascii	"3!vz\264\342\365\314\274\210\244\323\207z\202\026d\236\206Jz"
+	.ascii	"c\223\241p1\345\376\267\025ncS"
+	.string	"\031\30253\006\360\235\036\346f\344`\312\n7\"\021\353_>\264p\201\210\177\022\221]\270\224\227\332R\225\245\274\320wJuE\303\255\224\017\210U>\f\021\251\334\351SnL\2545\367sw\303\245\224A\333\341\001\264\332Q\333dG\275EB\264\332\314&3\232\251\220\321b\266\022F\263#\0221\332L\206\024+JJ\021\023*\2605\024#\222b\266Z-)\326\002\346>\326^Z\016?\252r\255[\262\227]\360i\3520y\230=z\220\247\035<\213\264\311\276\322\233\034_\375`%3\b\253V\026C\313-xg\n1\211\230Mf\023yJ\273\025d\022\204\211ue\204[\221'\220Z\3624LR\004\nb\034W\253\263\370\323>\r\324\375\346\247\333\212\327k\343\323\030\250\204\274^O\037\212Mc\250q4\351\0303D#R\224$Ic\220\002\021*\253:\020PeT\222\244\003b\024\251\344\b\356\223\002\300"
+	.string	"\362\313_$\350e\006\362\345e\265i\375%m\017ml\313\371*\017\334\311\234N\314\376\243t\207Z\020i\303\217$YxR\323\304\277\314\301\200-\003$\031\307\370/4\255w\352\210\277w\231\006\2422\370\240\225\t\303\255\337`\005\344}0Kc\362\017\306\270"
+	.string	"\261\320\200xO\031\322\240E!\0235\311o\362\326\302\306\272\306\353\216\030\336\265\323\246\026\265B/\241A\235)F\027!OU\203\253\200\3213\001\262\301"
+	.ascii	"I\213\311l\360\324\321J\331\367'\315\020\353\361\355'B\251\200"
+	.ascii	"\335\255\251T<\030\002\204T\300S\213g\376"
+	.text
+	.section	.gnu.lto_GPS_calc_poshold.88.9d2f6871d924cfc7,"e",@progbits
+	.string	"(\265/\375`\200\n=9"
+	.string	"\352e\f\026;0\350J\007\203\320\001\0344|A\233\313\026\252\021r\272\001e\232\342\275\315\026;\213\243\276\334\223/\344QlP\367\345\336;\373\224_\326\256\342\002G\237\222N\322\366\336r\223\224R\nB\0016\001\\\001\374\224:\007\270\316"
+	.ascii	"R\347b\352\354t\235\327\324Y\275\316\251\352|Sg4u&\252\316\237"
+	.ascii	":\373un\026R\314C9\236,;\345i\310\372\241N4\275\327\315\354\236"
+	.ascii	"\353gn\346\256c.\366\201\333\323{\334N.6"
+	.string	"\217Tes,\034\027\334\236\345\340\221\256\343\006l\310(\227G\270\233GZ\0177\325&T\020\264\213\356hP\353t\236%\215\207\215k~\312\245\235\276\303\234\244\353\370\336\001J\302\274\204\031\017\365s\007\247\355\372\216\271\310L\272\216S\263\303b\243\314L\230\213\215\336\236\323t\\\234\033\313{\033\334R\033\345^\266\234c3\231OmBE\305{+\234\304\262,V\243\234\2456J\325\007n\243\304.p\033\345#s\244\236#\303\246o\221\316\350\f\262,k\3741\354M\234kV\375\330\253\232^\224\370~\344\366\300g2\255I\257\304\003f\342\3244\"*Z\210W|z\315\246C\272*F-K\247X\372>\245\235\021\251ZG\235\322\326\232H\274R\022\262\362\224VF<p(\314\243\316\323\216\226f\346\337t\215\276\031RbS\313\322\236\216`Y\226=\231\246\326\354\324\314\354\206\231k0;\361\b:`|\205"
+	.string	"\361\215\227\276\r\300\274\263\303\373\212d\034"
+	.string	"L\024\343\371\222\202\350_\342\373\243\217\352\265i\220\376\344\177\342\367\331\341!\031\206\332\217F\215\0337n\243\377]\201\316\023\357\337t\215\265\366D\376\345\035\232\370\023\337m\241\022O\342M\374\353\265q\310;\306\321}\334\344\342\036\324\204tx}}\335FK\374T\031f?\211\357\273\256\252\343C\376\341M\"\363\347\214\0164\246\262,\273\201\373O\003\342\301\r\327(\373"
+	.ascii	"\363N\202\335F\373S\263CB'\231?\235\017\356\021\341\277\033\363"
+	.ascii	"\034\322\273\315\360\251\342\204\277\215\371:\247\270\316'Vg"
+	.ascii	"\023\253s\211\325\231\304u\036\261:\213X\235C\254\316 \256\363"
+	.ascii	"\207\325\331\303u\356p\2359\\\347\r\327\271ku\346\272\316\032"
+	.ascii	"V\347\f\253\363\326\352\214au\326Z\235/\254\316\306\3259ku\266"
+	.ascii	"p\235+\254\316X\253\363\325\352Lau\236\260:KX\235#\254\316V\253"
+	.ascii	"3\204\336k\256Z\235\03789;X\235\251\246\2563\203\353\274\340"
+	.ascii	":K]g\005\253s\202f6\033\350\271\346\002\2523\201\353<@u\026\220"
+	.ascii	":C\245\036\022~A_\233\306\352\265>\302\337\276V\020\262\352\255"
+	.ascii	">\212N\253T\343-7;\\a\343f^\006\341S6F\204\017\236\233\315f\350"
+	.ascii	"\347\307\262,\342\3714,cY\262\252\252\357>\007\377\340\243\326"
+	.ascii	"x\223c\033\225e"
+	.string	"\313\270\270\237\316\036\337\034\345\216q\216qn\243\016\276\213m\221\034\223,\301S}\267\202\024|\202\277z\355\244\005\337\257\340\377R\233\006\271\307G9\275i\254\305\332\240\241\n%l\310hZ\360\355l\307\2636\250\224\303tz\365\213\337\037\336\351\303\207xk\266\205<<\241\337`\246N\nvx\017VNB\350\273ix\016\317\336ZB\366!\26763\342\273\361\206\357\372\316\323\003\350\304\234iJT\250\314\013y\3537p}\027\327_\276V0\303kx\337\324\026\";\316\351K\2262\374\226\223\220\034\023\303[\370\255wHZ\177\3411\374\335\324\306!\233R\013r\223\033\216I\260\036\357$\353\271\215j}\252\207\266\305\370Y\177\341\211\227\3328\244\211\226\024\311\370\031\002\327\317\232Dv\207Q\364#nF\255-\225KG*\376\215M\233r\031\330\215V\264p\361\3426j\341\373N{\226\265\245RN\372\375\353\333"
+	.string	"l\266\312\021\257\022\325\370\271\023\361#B<\210\027\201\3078\372\217Q\374#\313\310\0171\257 F!aA\202\204}I\025\341!\006\004,\305\016\260!\353\2166\002\246\304\213\310_YB\302\300\304\274|\200!\361\022b\024\373\341\003\fH\017\243\0200\257 \306\257\"F\214YS\0346\204G\021\243XXX\021cq\216\254\277\215m\314\361#{\344\372n\274\232I\247\376\013\035\253\r<\232\201\347\200\246\222]\2432/l\242\372n<\306G\312\305\352#{L\224\301\027x4\346\nm\340\247\276\255\030\372k\225Hf\024\316\306M\004\200`T@\001\272\027\377\262\242\214\013\027j\201\222\222\202\004\274\213\214'2\316\205\306\333\r\251'@\240\357G\035"
+	.ascii	"/\365\027S\0028\003\036\200\200\037\3606\002\377\316\016\241"
+	.ascii	"^\300\323\027\037\352\273U\026\370'+7zv\236\372q\263\274\337"
+	.ascii	"\3061\334\0209|\347i\026fZ\274H"
+	.string	"\372\256\357\360hZM\344\006\370\246kU\320\256\357?\3007_\023\345\374\344\331\375\341\025\016I\223\342\031<{\213\tjO3\337\255\360)\276\373t\225SoJ&<KX_\341\352)<\326?_\033w\306\327\334\312\325\243NHrL5\2774*bg\362\222\202.e,\352\3122\n\024\324\371G\310\205\302\243\361$7\243\2368qHI\301\t\017\341)<\272\250UJ\370\b?\341\025\320i\343 <\325\007\200\314\250a (\2312\310\320\320HRXPHcp\002\021\242#r\003\020XU4\222$\351N\267\006\017\353\177- \020\236-\273<\336(\242\247x\220\275UF\206\262\327$*\213\347j\t\273\377\360}7\255\207B\336\322\324\350\247;\233\271\326w\017\302\362\0161\034nG(7M\303\373 \240\307\263\223\212\231jJiX>\305\226\306-)w\366\317\346\213\207\265\323\034\206\017\355N\210#/"
+	.string	"\f\272\351g2\t!\210$\n\227\030\376\037\211\005\200\220\247;6U\016At!t\352\251\303\2038\222\213J;\344\331\005:\031\005f\353\243\024Hu\020\224\021KSY~\036L\334\032\374z3E\315\371v+r\211A"
+	.string	"9\357\241y\243\001\256\301|y\317|;9\356\302\036\271\205B\216\340\204V\026[fg\276\256\370\374(x_\303\365p7\373^Q~\341M\f\307\2402\210\b\213v\005M\033\036\316}\001'9\020@\364\342\260C"
+	.string	"Qy\001\260\341\352\215\204\264\237\002\217\344\371\020\0079\266hrn\246\315m\276\345\023\236c\200\332v\247E\224j\234#\322A\370m\305a\r\355\300\360\326=\262\236\342`"
+	.ascii	"\006y|\224\264\001 \227\243\202\352\251\336W\202\316\204\221"
+	.ascii	"\234\253\005o\t\254\301i\306/\f\020\034\360&.y\276\227\305\375"
+	.ascii	"\332\022#$\251l\255\221\202Z\314k !\263\001\237\227(\352\377"
+	.ascii	"r\260\300\215\347\375\311\351\374~@G\035\021a\202\302\001\001"
+	.ascii	"A\330\022\221\205\026\211!\356AKM\313P\001"
+	.text
+	.section	.gnu.lto_GPS_calc_nav_rate.89.9d2f6871d924cfc7,"e",@progbits
+	.string	"(\265/\375`\n\013\345;"
+	.string	"jlL\027>@\246N\007\360\217\266x\331\331g \243"
+	.string	"\365\301\017SLt^e\324\322\377\220"
+	.string	"\305\215\260\274\324\236F%\270\252\035t.\372\245\370{\3542\033\022\275\350\354\205FgZHk{\357\224R\nU\001>\001s\001"
+	.ascii	"\2563\323\2223\361:/]\347\353\316\303\353,\274\316\353uV\257"
+	.ascii	"s:t\376\241\263\273s\277X\021\361\275\275\275_\223m28\211\215"
+	.ascii	"\252O2\275\327]\327\r\247[N\247\314\315\255\247\367\270\371\230"
+	.ascii	"\b\315\303N\006\310&\353v\345\246\307|\364\243\3470U\\t\311\374"
+	.ascii	"\301\re\342\217\316#h\316\326\320N?\201\364\035.\246E\227L\226"
+	.ascii	"e\235\255G\326sx\365\343#c\006\302M\247\3530\023YH\317aU\217"
+	.ascii	"\337\032\226e\211B\230\211\255~\277i\273\306c\342]\3071\266\034"
+	.ascii	"\"\f\220O,2oL\031\021\315aC\255p\33094sB\240\005$\343a\330*w"
+	.ascii	"\263\335\030\273\216\241C3'\303\273\2675\201,\313Jh\225\261\206"
+	.ascii	"\2552H\235\271\231=gl:#\254\262\254\026>=\226mRq\325\260\325"
+	.ascii	"\247\216Z[\365\206Z[e#3\242n\266\261\302774\273G,\313\026\377"
+	.ascii	"\013{\247\315\346\325\215-\\\325\364\335\310\355\200\211\222"
+	.ascii	"J\263\026\246Qa\340\3144)\321\322)h\236\263\361\216\276\232Q"
+	.ascii	"kuI\231\326i:\265\354\213\322\244D\246Q\200\270\374\365\263]"
+	.ascii	"\211\362\210\177\343\365\324\337^R\251\326.\004\301\262,{R\371"
+	.ascii	"\244y\330\314\254d\346\035\314D\017*\361\333\256\320\363\276"
+	.ascii	"\360\227\276\207\177\277\333@\b?|\325\216\304P\370WM\020\244"
+	.ascii	"\347\231\017\276C\335\376 =\257\023\\\254\357\304G"
+	.string	"\311T\215\307N&B,\313b5`R0\312\033<3\214\030\336I\365\235\366\fF\221\316Vc\206&\312\262\23458H\b\311\262g\016\322o\360\rm\341\376\323O\241m\240?\337\2655\367\255\377\335\2269\372 \367\3737Z%n>\3357\203\333\215i\324\360N\326X[\355W\343\376\310M9\363Avrf\033_\336I\366=\216\242\3077cn\036\375\331\230\273\303\340\201\202\204\277\013\013wVq\235\273\256s\212\353\314\345\316(\256\363\tw6\341\316[\356\\\302\235\265\2563\tw\036q\235E\\\347\020\327\031\304u\316\272\316\037\256\263\207\353\334\301\2359\\\347\r\327Y\303u\306\272\316\031\256\363\325u\306p\235/\\g\253\336k\266p\235+09S\270\316\305\353\\E\345\316S\356\034\241\351\272!4\234\346\006]\327\254`\3119\201;#Xr>@t6@t\226\":\027 :\023p\347(\242\363"
+	.string	"w\206rg\001K\316\001\334\371\311\235\235\226\234\233\256s\255R\370\fk\202\344\350\316\252\276\370\335\356\211\360U\277\346\265\201S\017\365\021\376\031\265e\216{l|\363v\006W\332#?\022u\344\3247_;\235\264G\3139:\002?\340\013|\267K\024O"
+	.ascii	"\305\177\020\343l\375\234x?\213\272\231\263&\376\304\203g\237"
+	.string	"\372l#~\013\020[\227#\351\263q\211\327\372~\266O\211\022\255B'\220\037\244G\342\020_\202\304k\221\370\025\332\n\212\370\021\357\224Z?gd\272\022%\021o\365\354\223\243\003\361\035>\304;`\273\314\372\017\017\342WJ-\3341RKb\247\321\f\333\361N\262\235\265\325\254\027\346)\251\302\365\036\376\303\247\214Z\270\343\231~\344\310\303_(Dw\246\307\3064\315\210\235Ri\314%s\221QM\2218\346\222)\330\212\214rF6\3069c\233\265\325\016\337z\355S\322\230\3139:\025?\240x\347w\364\213S\251\353U|\267~R<\327w\375\347\265pu8D\007\262\363\212\033Q'\032\241\265\265\265\266\232\342\027\200\241\343\372\256\323\016\352\240G\277\273@\250\227\361\347(\300\377qE\021:t\242\223\202\002>\3007^CA\207Lqz\001\2776\022\022j\206\256O\357\364\354\355\242\246\177\372!\177~h\225"
+	.string	"|\323?\264\365\303\364K\017\200\370L\277\002\266\201~\\\334\202zP\027\267[\253\274\242E\213\265\003\254\243\212LG\231WX\261\207XX\230\230\215\003c_e<\300J\334"
+	.string	"\363qs\200\215\225\245>\302\276\312R2\260!^\351\215\257/\037d5\206x\205]\266Q\325C\f\254\314+\007X\020\257\036\3052\0359\300x\340(\366"
+	.string	"\363\n+\332\030#+V-`1\037_c\30521\261\261\"\261y\326\337e\006\233\350\331\037\231H\312\262kY-\247;\260\316\007\205\317\3067\214J\365\037\311%\264\202W\302\n\240\350\300\271Q\024\310\020\322#57\217\235\256\317\306.\342\322\255\357g_-x\234\030\"\363Zo\342\2250Oh\005O\365\035\345o\257]\036\271\215\235\013\332\276\030\325$hs6\367b\224\243b\234\233C\003\370'\201s\341jj\363\265.+,>\201\200>:\344D=\213\002k\020|\324\201G\3602"
+	.ascii	"\367\320*\031\370\003R_\340\rpx\2514M\234\337\233\r\317A\303"
+	.ascii	"c\375\0068,\276t,\032^}\002\312\321Y\211V\241R\366\026')\b\365"
+	.ascii	"RfH\2511\325\322\324\247\037\244+X\237\305\241\260S\352\211\322"
+	.ascii	"\001\223\202\031\336\352\261^\025\324.\257\036\303gx\003v-\234"
+	.ascii	"\325\027\377\352\021\364i\313\\\370\254\307\360k\237v\317\321"
+	.ascii	"\302_x)\273v\271\305\233\260s\203\032\032&K\254^\2706\bR\205"
+	.ascii	"gg\257M\212N\262\360\335\207\302Wx).\2364\262\rY\026y\305\216"
+	.ascii	"\304"
+	.string	"\223\030\277\2001\212\021\263\006\200\315\250a$'\rC\n\r\215\210$I\222\345\200\002\221)#r\003\021\240%dL\206$\005\271\035\220qt\334*\321\021\020\001\023\3767\310\247\224\033\245\340\001\351\277\264\350s\331\003\027\333B\263\n\317\206\030lj\343Y~\211\001o\355x\227\215'+\310\312G\007t\267\346s\003\252\313\270i\352\260\303\355Y\352\330o\323\366Eh\232\207\251:\362|\201tHEW$\r\310\335\321\030\037\220.\351B\260_\346\024?3(\037\272\020\252\016\177\363\350^\325\217\203\322Qy\213^\255\032\231\350\\I\020+\b\365f\306B\004h\b\032\270\r\032r\020\3749\327\341r\210b\277\242\201o<\203\336a\232\n\337\350\235\226\355\321y Q\213\2105tk\263)\b\032\004\001\246{D\304\362\035\332\301k\004\307\260\253\304\335y\276\025D\201\361\3335\263\326\240\305\336|\2065\363*\265\024e"
+	.string	"\302{\335|\223C\201\345\247\316\231,]qJ\f\032`\240\004\362\024q#\206\273=B\026Y\023Sw\003\345\335Q\214\361\210y)v\214]\366$\201\034\274\024V\022<\266\366v9\234\n\fk\021\037{\217!tY\262$\373\325\314"
+	.string	"\331\264\205\237\034\300> \214\275\303\241\3018F7\024\306\tLZF\242\374\357o\374i@DT4\265.i\204\305\315s\223x\025R"
+	.ascii	"\257\307Xy\200\263\310\234\027\251a\373*v\314#r\234\023M)\306"
+	.ascii	"U\360'\251)\262K\332\243N\267\353\231\361W4\302\"\002A\313\362"
+	.ascii	"+\314\337\322\217F\332\001\337\037"
+	.text
+	.section	.gnu.lto_GPS_update_crosstrack.90.9d2f6871d924cfc7,"e",@progbits
+	.string	"(\265/\375`?\005\235 "
+	.string	"\006\272\314K\240RR:Z\223\3061\301Tf\370\277\305\324H\177\316NY\005]\b\272\277\013uF\226vJJ\223\243C5j\237\211\257\255\333b\201\335\225`$\260\026\274\016\343\351\203\214o\305@\236\247\257\376\274\356\341\325\276\375\237\354-w\222\001\266"
+	.string	"\251"
+	.string	"\272"
+	.ascii	"9~T\320\241~2B\34456\030\023\222\340\226)e~\216#\201\016\365"
+	.ascii	"\253\310k\374\021\023\211C\301-\327\330ne\036\340\274\255\007"
+	.ascii	"p\036\0073\020s\356\226\3468\210y\354\310\245[s\221\204\250\303"
+	.ascii	"\311\275\227\327+\036\364\235.\207\273\331j\247\255M\203\370"
+	.ascii	"\267\242Q\350;]\355A\323gN\030\225x\016Wi\300P(yXQR}Q\342\n1"
+	.ascii	"\202\336fN\030%\335\026V$\002\35332\212\220h\255\"(\353\261|"
+	.ascii	"X\021\211\032\200\350E\361MDz\332\241\007Z\217\336)Fa\225\271"
+	.ascii	"\367^\352t\310\030\244\264\366\340\336\313\264h4:\247\234\231"
+	.ascii	"\305\230\331\206\331\352\002]B\212\306\264\337\335\0372\005}"
+	.ascii	"`\240}{\326\265~\374\026\314\323\243"
+	.string	"/\366\316\333\367\235^o\250X>A\002\322&32H\373\310\374n6\233M\356\024\31410\277:\277\270\264\234\352\314B)\257<\352\254R)\247T\312\273JYW)\347j\224q\226\362\315R\266\235\224k\226\362i)\333J\271V\312])\323J\371\003`\320\300z\224\367\0225\231\367\313\372\200\361\253?\352\247z3\237?u\254\237\357\340\363\260K\346\225\325\317\255\322\252\030\330^E\305Y6\241\"\001\304%ce\013l?w\272\024\320\237\370I\006*\226\001\024\212f\267\306u\003\031v\331\372\354[\277\326\266\376\260\214\310\271*\334\340\340\234\267\265\256\021C\332Q\226f\326\331\241/\236M \311\353K\330B\314Y\257!D\343\353^v\320l\"\021\336\013<`\233\245\2376\224\021\244M\356\266\375\252\327\030GgA\345T\031p\t\255L\253\326G\276\324\355\223-\333\322\\+\004\262+bV\273\264J\017\035"
+	.ascii	"\361\337\271\322o\272-,YD\245W\206l-\223\312)'@\332\354\223\212"
+	.ascii	"0\321\3226L\262{\357\265}\344\016L\230\376{\232\221\344\022R"
+	.ascii	"\264\nt\344\353\f\344\354vi\033\246\327P)\370\376"
+	.string	"\240\365\337\331}\251\253$\315\240\230\030\t9\031tzn\254\006\236\034\237\352\353\371|9\226qjzz;>7:;\034nzx>\027tv2X\340\365\354\334\360\360p|\033x5\005\270\247!\307\307\363\351\365|\274\034\022\370z;\005O\200\362\005\354`\335\2115\235f+\215\006\361@\304\244\303\272\205r\004\007\323\\o\020\310\270\210Y\266\227\216\351!\346\230VFx\325i\266\230I\245\225Y\256\217[\3375L\333\244\235\031\350\001\305\002\327Gvy:\273\365\361\307w\375\3226iJ\376\341dc\311\366;w}\254\253$\227`\272\256\275\353\017\225\202Ft_\301\002\351BUJ\327>\227-6r\235\322L\207M\202\271>\023\031\0251\n\256\371]\367\2220\201Bq\250a4'\215Q\206jF\202$I\222\306\260\002\231)c\035\021\260\261\224\243Q\373\035#l\243H\332\027\235\242\331\354\177K\372\346\236"
+	.string	"\213\350^\232*\352\216\307\f8\"\247\022\301\3779_C\004P'\2458\374\003\001-\310@\310F\367L0{@\036^\204\tl6Ks^CB}|\210\217\333%\337\334v\232Y[\200\262:~\004Y)\353\224\370\341t\356.\372o\333\203\005*\354\240|\0215\216\260$\003_4\264\017\320\016\300\243\016\331;\026\220\364N:M\237Y\027"
+	.ascii	"\250\226\306\212q\233?\225#B\276\302\001\327\374\213\b\206\220"
+	.ascii	"#C2\022'\340\254\001\3640\022\360\201\245\020\205l\332\372\337"
+	.ascii	"\243\0353\337~G\307(\020\307[&\243\001\f\311$x\224\364AMP(\336"
+	.ascii	"d\363\272\032"
+	.text
+	.section	.gnu.lto_updateGpsStateForHomeAndHoldMode.94.9d2f6871d924cfc7,"e",@progbits
+	.string	"(\265/\375`\004\013\r4"
+	.string	"j\\\270\023@`\246J:\347\273\370R\247&\207VQ\3533L{\273\201>\273.\241\267\305\021\234\213\311\252\033\204\236?\253\370\2062\\\330\325V\234:]\300\315\302KF\375\302\023;\030\177k\215\020\262\211\2242\005&\001\001\001:\001?\3127)\277\034\371\344\310\247\224?R~\217|\036\371K\"\252/O\017<\265\016)\362U<zwe\351v\323\354\306\355\312\355\370/\321NMy\204\217\313\231E\243c\307\334\324\361\357\334\326\375\301\363\3301\3372\345\221E\301\245tdv\214\325\f\0271\0203\217%\263c\331\314;=3WK\277\305\343\017.\0357\314\212yP\356D)4\246\2726d\020\026-s\351\367\313\202\361\261q'\232el\003N=B{\265\326\252\245\3072\227J\255\023\271t\334"
+	.string	"\344\322\373\370\013\255\334[]b\2404:F\265\326aOY\037\333\304\264\244\224\204\024\004\376\314\222\244c\263\217\357O\215H\33161\225\034\246\240\024\241\262KNV\251\215\350\204\223\220\2320\341\340\024\224\"M\026\270d\224\262S\302\277\205R$\311\232#\204\266:FV\017\033\222\321)O\224A\213f\247\340\330\222pI\246\325\235L\217\354\250D\344G\035\032\267\036\266\267Q\252\326\272b\226\327\210\2341\227\034j\255g5\"E\366"
+	.string	"\366_\t\377[\374@\027\001\377\n\026\274j\031Z\n\255\313~\342\ny\024\344I\375\206bQ\021Z\255fT\335c\357\tw\306\305sw\357\271\007\\!\271\315\315\217N/g\367Z7_\026\336~\027\333\006\306\325\237Zk\026\233\275\003\373ZYz\031a\274jK\277a\344\322\355\244)\212\272\304\231q\361\227;\343v\373w\254-\345/\371!@l\232\375\207M\263\357*\371\\K\267\367\260t\373\016K\267\337\332\270\375\206\225\333g\030\371\030(_\213\362/P~\026\345[(\371\025J>\205\221?\201\362%P~\004\312\037R>\326\310\277\242|+\312\257\032\371\020F\376\003\312w@\371\r(\237\001\345/\030\371\n(\237\212\362\023P\376\024\345KQ~\024\345#\030\371\007L\276\001\223_\300\344C\225|a\311\177\032\371\004J\376\200\221\3574\362\005\230\374"
+	.string	"&\037\200\311o*\371L%\177i\344+\225\374\244\221\217T\362\203%\037H\362\003 \250\026\345\315\371)\323v\306E`\273\375\204\026\263\302\357I\033\266>C\312`s\365Z\240\025\366\332=\365\200\026\022\350'E\211\b8\365"
+	.string	"\253=d\310\251\223\216\360u\271\023\320{_Noz\253f(@\013\350\246\016\320{\266q5\200\346Di}fM\275bvt\323W\374\001{\253+\364\371D\364\346ho\215\331n\337\272\245\215\340\220\035\372#\355\322K\223F\034=\364V\257m\241YFb\004/\311\334\236;h\354\250\344$O:\264\006>\275\313\325Z\311\036\207\260<\305e\231\253\203\306\216(\217>x\3737$S{h\r|x\316\266\263\255\265\326\261\335\200\254\331\035$S#\211\2532wg\251\223\232\251\333\356\304\242\324K\200\376t)\365\222\241r\207\324I\275i}f\\\274\332>_Z_>\233\007B\304\210\021\344R\244\256"
+	.string	"\350\256\203\275\247\241_\003\233\254\257\230\326\307\265\326\262n\267\233 \177\335b.\020\032;\372_b\363\2300kE\313\372\342Y\274\023(R\360\252\245 \227\376\272\334\262\250\213\331\277\212\re\233d\227\373fi\223t\346\310\241\215\342"
+	.string	"\360\330\001\217\201U#\206\r\257\260\241\330XX\330\330\027\024\331\030\031\231\013\252C\f\254\306/\007\013\034^:X\324\030\373\372\375\013Kl\f\314\206\027\f\260\033^bC\0331`\200\315x1\024\003\363\n\033~\221\325\030bE}\214\206\013\262\241\215\2611\262aP\316l\307\332R\316\242\210g\326gM\030\206\b\321j\f\027Z\253\205vYm\241/4i\007\253\263\272\314\253j\013\275mE\275\t\274\306j\022zB\204\226\320B\272a[u\204&\337`\365\360\252\261\272\264c\305i\347U_"
+	.ascii	"tgV\325V\020\272\252\307D\347\036\243\361\031\204F\023f\257\r"
+	.ascii	"\f\223\022\205^bR\260C\364\332\377\340\212\313\270:\350\007\335"
+	.ascii	"\204"
+	.string	"\032\264\203\206\"t\3021\350\005\335\240K\273\263\355L\252\031\264\220\356\204C\320\013z\275\024\343(x\304\307E\325\n\272\363\316;f\\T\323'\213\243\004M\325Py'\334TGu\202.\351N,\031Z\252\247\244\372\351\321\206F\320Q\bz\271\024\211\347\336\201n\304\310@\037(\320Pm D\027\200*\326-u5\005%;\244\017\3751\b\004\321]]\304\244v#\264\302\376\2004h\205\301v\023\264\302\016\200\316\250Q0\205\rc\306f$%\005\005IZ\003\300\002\221\231\"\323\001\021\360\250T\016\031\311LI\n5\2265\035\346\321\222:k\360\024\005\214h\315\313\376\216\312\326=\250\333#R\0041\256k)\352m\2212\225\316=\n<\342\210\232\t\026B\002\305\3360\214\342n\351\223\nm\223\377\365\201\2620c\214C-u\207\220\214\371@\032\344\356\233\255\206\225\254\320\361k\3340=\"\214=@\\\226"
+	.string	"\005\224\257\332/z\271!\200\210n\242\216L\367\326p\206\2414\322\221\340,'gz\264\264\2426\304;\233\215C\210\240\2054\312/\214\275\272\247\003x\317\327\016Fl\177\226\260"
+	.string	"o\225\36109^\304/\"\271\265\201z\3308T\227K\023\230b5\2122\273\370\b\314"
+	.string	"\323\360\354Ny OJZ\221\3256\245\342\2236| K\342\270\217P\005\0039\226\201c\277+\344\305`o\344\303\004K{>*Z\374\023\323\205]\023n\325+\277\225Fh\276m\371\006\347\3551\233\035\307sZ46`\343\036\240\032\030\211\304\236\215\201T\021$d\032\n\277\217!\247Q\353A-?%\325V\310\264g\332\353,\305\372\376\222\335~\035\236~\020\006\002\177\321\004\212\363\200N7\373\031v\201\354\032\313\005\346\254\0339\024p\265Ch\235"
+	.ascii	"\377\350}O#\262\r\235\320a\005\223+\201\256\t\034\003\376h> "
+	.ascii	"\300\230\350%\206\203\022Do\231g?\372B\025\364F\204\376\001"
+	.text
+	.section	.gnu.lto_updateGpsWaypointsAndMode.95.9d2f6871d924cfc7,"e",@progbits
+	.string	"(\265/\375`@\tE."
+	.string	"*L\364\020G`\\N:\373&\266\301\326\250\261\360v\3507KF/\314\352_C&\005\260?\204\242\371\223\262\346\210i\200`\003\257\006\211`\n\210\234n\300\304\360\213|"
+	.string	"\212\035NZ\342\032\206Y\206\212T\315\315\314ZB\310\226I\006\363"
+	.string	"\353"
+	.string	"\377"
+	.string	"o\326Q\233\207i\2630m\016\276\031\2306\377\322\346\365\315\352mNo\363\037\004\260\302F'\245\231\274g\236mV4N\013U\261\224u_\355\315\374;y\310\f\032\260W\213\"\222z\266Y\353\220\032]\324\370\332\366yt\225\223\200W\231eV\363\247X\013\240i\343\252\215\257m\333\3435r\366BA@\306\037\237\236\"\317\016Qg(\f\002\177\253\232\336f\371?\n\301\344\226\324\205\312\036T\246\244\201\224\334X\226\244\177\310\356c\246E6\247u\244{\204[?^\374\324\330y\276\304z\207\370e\246\345\325:K3\255 =\\v\265\260(L\007\220\007\201\334\371\"3-\256\006\366\330\177?\276\216\321hU9\334\262\3524M\220\027\267\007\224\245$9\334\252\352;\247\205$%j\333\366\3167\326\026U\367\217B\333\266\334\311-\035g"
+	.ascii	"g>\0303G`\006\206\br\347b\341\002\006\f\353U\346\f\032\344\240"
+	.ascii	"VD\034Hh\021\352\342;\254\314\036>\364\223\334S\346\262\020\371"
+	.ascii	"\272\322\254F\353Q0\214\355\256x\243u\275GUn\005D\210\021#\326"
+	.ascii	"\253\353\275\017%\\Z\202e\030\036j\324\252^'6\274b\253_Z\231"
+	.ascii	"K0\365\223\352\275\335\334\023h\325\225b-N4\261\36429=rMo\037"
+	.ascii	"a\033\303\214\342nH`\333\266\016\370R\336\326\304Or\225U\260"
+	.ascii	"`\261^M/\322\335\332TG\377{\231\374\002\253\200{\347\201slxU"
+	.ascii	"\r\207\373\005\326_\001\227\373JIu(\177\"\371I\370\305S?y\225"
+	.ascii	"\377\264^\375U\343\244\240-\235\312\251\2162?\251\3722\231\177"
+	.ascii	"\243\321h\224/\021\346\264\371(mF\2206\027\245\315C\267Y\200"
+	.ascii	"\361j\347\237\264\331\347\315=isQm\346Q\233w\322fbr\342\360\244"
+	.ascii	"I[\333\271p\224\f\330\365Y\020\202!\265\222d3\344o\224\222\354"
+	.ascii	"\230e~\2175\242\300\356\252\233\235{'J4}kY\316\354\301\216\256"
+	.ascii	"\331E\314\344\210\b\314\330\356\210n\264\022/\2025\304\373\245"
+	.ascii	"\262\256o\215\203cO\3472Y\347\366\234\243\036^f\026\tK\326O\352"
+	.ascii	"\\\"\341\035\336u\313\325\234\251\216\226]\r\333\004\266m\225"
+	.ascii	"\003>\232\247a\231\260M\330\263\263\365\252\360>(\343\266d\351"
+	.ascii	"\034^&_\257\351\274\202\013\376Q\253\211&\326\025\034\360T\376"
+	.ascii	"s\261N\345\300\373\260\025x\215n\\\317\276\274\252+%\344\272"
+	.ascii	"1B\375\2703sx\023\274L\270\027\375\312\177\267\210\356w\203B"
+	.ascii	"\332\240K'\3602? \357\354\313\257\317\246\255|2\207\262i\354"
+	.ascii	"\023\326\331O\262\316\365*\224R\016M\217\250\277v1H\017\243$"
+	.ascii	"\001\314\327\356\245\202\321\256m\247\236df\005\357\242\204$"
+	.ascii	"\326\266-\2041\220\033`,m\200bzbr\032r\211\244\026\310&\250%"
+	.ascii	"\024M0\226Z\034\241R\240hZq\342\330\242i\211\305\261\204\323"
+	.ascii	"\323"
+	.string	"1i\210\221.\230\234\216PH\244\323q\370\234z\332^\"\f\254;\203N]\252\264m\333V\bB3\263[\354\216)uL\240Tgc=\222A\306\013\340F\235T\033: 0\021\\m|z'x\334\256n\307q$\321\366\214C@6lx\013n\264\372\334\241.\237\3737\276\245\027\222(o\\~.\023\357\\r\370\364\0324\361\354\217\225\231\345b\273\356\374s\270}\201\365\345\371\244<?\327D\023\353\nN=\225_\257Iv\005\367;\336\215=\334<\272G\224\f\326\313k\275\332so\334\233\231\2363\327\261\207\246\307\201\3130\356\316G\221@\221\247\021\236\240\031\233\027o\260\263\2127X\346\r\354@\330\225\345\316\373\306\f\245\232NV\bj\033J\023j4\215\nA\n\332J\351\330UgP\253+\305<H-\325\355\327\347\004\200\277\250q,&\231C52\"%)H\222\016\220\002\021\031\262\352\006\021"
+	.string	")d\320\025m2\354\033c\340%2\004G\375N2\270k\371\354\323b\374\253\026\215\215\206n*\0371\r\370lB\225*q,;P\320\206-7p\224e>\223\002\251\317]\256Bd\364j\327M\376-\021\265S:\f\006\271 \024\f\2244\201\022\320\300H\317\275\026\002E\246EA\250\263\212V\212\020>\256\035e\337\270\252\371AS\032bh\255\003h\323\314\315\247kX\352G\374<\233+)o2\2613\202\212\r\273\303s\017P`g%\357\354\246\316T\250\230\252Z\024>Cy\242\007\212q\302\0246\373\277\034\356\267-\334\244\202\3416\202s\232TW\333\017\021iv\252O\253!i\304\313a[4\210~\202\371\353\235\326L>\225x\232L`\013\270S1\023"
+	.ascii	"\323\"\202g\223\210h\226\324\2040\311\234\203>3\330\340\nH\231"
+	.ascii	"f\b9s\362\214q\354\316^fO\231\346\233\021AO\024)n\376+\354\306"
+	.ascii	"\320p)\253\026\0356\262 \003\320@\252\320\376l\3278\020X\373"
+	.ascii	"\273\340=u7\225\200\355(3i\350W\255[\231\201\245\253\324\247"
+	.ascii	"\233\242\037\324\210\177IP\232\231\016L\235l*\274\213X\374\007"
+	.ascii	"\242\313\355\324\207\206\266S\023\330\203qg\"\275\306q\216\312"
+	.ascii	"\247\246\005E\235\206\277\0053\221\250\262E%\377F\223\205\341"
+	.ascii	"-\321\232f\276\217\311\373\003"
+	.text
+	.section	.gnu.lto_navNewGpsData.part.0.137.9d2f6871d924cfc7,"e",@progbits
+	.string	"(\265/\375`\216\t\3151"
+	.string	"JR\b\022CP\244N\007D\306\222\262\350\2577\302\204\024\255.\002]\020\213\301&{\006IDZ\f\361=\243\001\034f[\360~;\336\036"
+	.ascii	": %\002>[G\372\200\350-@\230I<u}GAzI\333{\247\224R\b\001\003"
+	.ascii	"\001\004\001\375%J\330\026(\207\302P\252D\331\032U\323q\006\356"
+	.ascii	"-m\307-\205\371I\347\321h;\356,j\227\261{/\336\035\204\275\366"
+	.ascii	"\235F\337a\245\355\025k\037"
+	.string	"\203\255\202V9\302PJ\327qc\221\313\272j:\376\260\263\264'\334\275\267\247t\034\367\025+Y]\305\212\235Tzn\331U\254\222[\355u\206\200\372\265\r\206\255\376x\013\255\r\345+n\271\266\241\\u\024\254$\263\275b\022\366\360\340\020\264\312\013\206\255&{hm5m\241\225\206\220\033\232\305\\,\266\332o\314\234\345\344%3\234n\323n\317\321yM\001\274\367*[}\"\275l\243O\221\310\016\205\253\232\276\037\227\334\302%h\263_bZm$k\037\262\"1\b\020g\225\314t\004\351!\031\347\217\2741\027z))q\n\361\325G\253\315+]\236\372\227\030\217\376\243\0303M\336{\273\257\035\207\030\227{P\037\205K\367^\356\255g3\262\2319\220\231Y0\263H\001\255\362\222\226\353\361G\343?vz\377\214\031\351\254\304:'\223\220\032\257\371\250\353\232\215Xg\002\254\363\200\243s\321\321\231\310\350,"
+	.string	"\351\034\200u\036b\235\001\0049\013\261\316A@H\347\037 g$\220\363\021\310\331\310:\373\3748\027\177\234\211\2543\213t\036\262\316\302\365\350\254\036\235\323?:\273\321\271\021\030 C>\357\r\3333x\207\250yH\332J\213i8\334\225\202I\261\225\267i\316\017\201x~\355\3166Y\374\264\304e\243+\255\3535\315\206\212\237\210\3324\035D'u\3156n\207i\230\201\203,\206J\357X\327\273\201\323\203\003\274\314\026\001\003\007W\f\325mZ\030\204\275V\331j\343u\3275\221\271\271\315\364\031\026M\307EO\026\006\312\324\200i?\3561\\\334\313j\275\356\223j:n>U\313\235\266{\257\2300V\351M\273)\030\234\036\353,\325a\254\274\275\316\316\013\304k-\f\365\270\367\244\002K\267\265U"
+	.ascii	"\016\246\f\360\tU\037\215\273\2575\304i\363\272{\344s\352\353"
+	.ascii	"\003=\016\356%t\025\3726\223c\303t\3017\357ZB\235)\364,\233\036"
+	.ascii	"\267\270\244\007=s\205\013\336_\234d\276\026\003}\320\367\225"
+	.ascii	".\240\005\217\\\232\271h\232\376<\267\240k\365\027\035\344\377"
+	.ascii	"\034\337\370\310\357\346s\370\307o\2377\376\237\361\212\026\337"
+	.ascii	"\347_O\223\357\256\253\360\221y\357V\001\342\027\277\233J\364"
+	.ascii	"t\224\3570\260\035\333\255\255\022\2778\347%\360\333\357\275"
+	.ascii	"Z\377h\314\276\360O\310\3611]\220\207\317~{E\267\004;\017S\206"
+	.ascii	"\r\033\236\035\023\376\214?\365\327\357\276\016\022\223\376\277"
+	.ascii	"\372\335\254\323\237\376\001,^\321\004\355\377\177t\246\031\345"
+	.ascii	"\362=\314\215\247\001\243\270\325\230C\207\016\337c\272@\024"
+	.ascii	"\016\360\t\035\363\320v@\f\357e>\340\376\353:\"\270\325Z\345"
+	.ascii	"\021$\274\277H\254\255\366G\313\326\236\320\270-\3373\307\277"
+	.ascii	"\256\201\274\302\204\214&\027\354\t\023>"
+	.string	"\02555\345\244\246pr\202A\245\302p\341T\2252\212\005/\242\240\252\232\236\240b4\275PV\255x\202j\241B\371\002\252\311\205\022\305\024\225rA\022G\301p\232RVEEM)\213\315=\314{\363\333z\2563\243\222\331\020&\"\033\224^\270\205J`\367\262\310\312.\304\311\226E\214,\217\034Y[ur\246\366\204\253\363>y\255\006v!\"=\247,S\034:\257\273\341\321'=\016\266s6\326\232\034#c\226\364\311\357-\235\262\365\350\"\227\206\n`\321\177\fA\372\t\203q\270\275\367\022k\374\255\021\305\261\311\205a\272 \373hh\374\214\376\350'\f\3665\237\\=|40\274\306Z\215\276\363\032H\216\016\224\2772|\004~\300\033}si\256q\365@B`\007V\222\245\333\200o,\355oG\324\204\217V\364D}L\027t\261\242O*2&\340\211\276\331<\fD\016\001o\\2\305-n\r"
+	.string	"\306\304d\350\003\374\277\361\212n\231i\346\262\002\370\241\357\246\023.\267\3417\260\226M\226n\001\200\334\250q8%\225RdHd$I\nR\350p\002\031\242\262\316\001\022"
+	.string	"\3269L\231\020m\235\322\316v\301\005\n\373\375f%\371\221\313!\302\003M\221\252\250\211J\334F\260\341z{\013\336\301M\325\227S\233c\204Q\005\314\266v\240%\300\rNx\363\030\376\321\235\304Z1\031\254x)N\304\367dM\267t\224\340\036\231-d\230E\325\310\212\271\335\024\raU\311O\320_N\334\206p\032\371\315kaC\317\341\302\215\246\374z\314\2510\301\2648?\36338)\251\317\341\211\313_-\007\005\2418(6\235\260oC\215 \213E!\337\260\244\310&jS\314\371\315td\356A\001\013\307d\262d}#\262f\245\270\236V\321[\242yxv\270\237\001E\236\351 \343\223+w\341\006\266=\342A.-D 0\275b\016!GI\032P.\b\302e8\360\202|\b\365\013\335\341\007D\005\265AV\003\367\033"
+	.ascii	"2\216!\225_2!\246!<&\263\253\020l#\nI\315r\373A\276_\376\322"
+	.ascii	"\021x\fr\252\355`V\373|=\340\351\346\034\300\336~o\251Y\377\254"
+	.ascii	"Nt\253\355\203\026p{Q\264c\341\"\2009\200\2428\231|\365\234\254"
+	.ascii	"-^+\324\245\2509\233\341\371\246!,\251S\"\350\311\262\236\206"
+	.ascii	"\356\220\251\373\0374\247@\226\243\362\333\375m\206\235\017Y"
+	.ascii	"}\341U\375\340\036\340\262.\245\306\304\035\203\263i\311\275"
+	.ascii	" \037\305\335{\365t/\"\365\316\372\254\211%\376\347\004\230\034"
+	.ascii	"\367\367v\026<\233\021=\254f\240Fn\021<\331Zl\247B\301&M\007"
+	.ascii	"e\373@\005"
+	.text
+	.section	.gnu.lto_.symbol_nodes.9d2f6871d924cfc7,"e",@progbits
+	.string	"(\265/\375`\250\003m\023"
+	.string	"\366\235sI\260\230M:lV0\227\307\214\25109\316\335\\!\036\220\341\350F|\354\205\017\254}\035\"\236\036\024$\201\257\317\bg\354#6R\t\256\025\200k\205\222\300\253\232\231\r\326\215)7Y|\300\177'\201\2233\276\355\036r\313\024["
+	.string	"c"
+	.string	"^"
+	.ascii	":W\024\307\231{\357u`y\306lp#F\366P&\203K-x\022\234C\321\242"
+	.ascii	"?\035\370\222\016\006\203A\"\373\2529\364RH\210\036FP\r\350W"
+	.ascii	"\271\373p'r;\022\035\333\265\324\212h\377<\336\237\037\241\377"
+	.ascii	"]W\024o\220\337\376O5\230\177L\331\220A\263\1772\377\317\220"
+	.ascii	"\001$p\364\327\361tH\274\335\322N\351(\311\205\202\363\030c\004"
+	.ascii	"\020\025\3611;A\b\036\206\206\370\027\n\302~\312\207{\241\036"
+	.ascii	"\354\245\314\016\366M8\234\n\335`\211\246\006{\252\231\341E0"
+	.ascii	"\f]x\027\013\366S\263\302\263\030\270\022\032\273\025\n\257B"
+	.ascii	"\377O\361\n)3\301\236\311\224p,\021\376\203\360+\017\036\025"
+	.ascii	"\\\376\310\332h\207\247C"
+	.string	"_VM\254C\221q\275-\340c\315#\024-\326\241\017V\323.r\006k\376\371\300\232'\204\365\213d\356m\001\243fa\263\260\007\356\354\305 \331g\255\260\327Ra\017Fg\217\225\302\336\352\310~\013\337{\377\034\024\366\\\370\3044\221S\302F\377\027J\274\245\026I\001\277\36117\371\300\301\204S\333\346gS2\323`r\322\252\325.@\362\r\260\251\312V\233\300\310\241\324U\216Z\355\001V\262\332\002J\236=\2008\271\325\016@\342j\207$'\330\021\345F\2566M\371\342!\253\375\032k\265]?\006@F\007\326\255\236j\210S/W\333U\372\3644\223\263\236\346\037M\326\001P\250A\bE\004\331\304\231\202\2464\034\220\0029e\343\006\021\2400\257\215H \223QX\332\001\261\250\016_\343w\033O7\364\2264\326\237r\032\303\265\320\034\266\274e\271Ob\214\316\315<*.\025\027\325\237U\223\345\250\273"
+	.ascii	"k\2017\233\033\026\340\351K\3302B\262\265&\221z\247A\271\352"
+	.ascii	"\201s:H\024\370\371\265{\303\372\202\367D}A\234\257\002\210\244"
+	.ascii	"?X5\261\3314)\313\351c\250d1V\251\007\356B25\241[9ANv\276\034"
+	.ascii	"\035\207\302\tk\321{dn\301\3626U"
+	.text
+	.section	.gnu.lto_.refs.9d2f6871d924cfc7,"e",@progbits
+	.string	"(\265/\375`\236\0015\r"
+	.string	"\346\245`2Pi\233\341 \302+G 33\326UUUUUU\325\210\327M9\214\257\030\370\026\023\030\366\377\337m\266\227\306\350\355\373\251\211\b\331\273{\251\221-SP"
+	.string	"R"
+	.string	"P"
+	.ascii	"?\310^\261^\362\374f\275&\177Z\357h:\305\274\253VXkU\207T\375"
+	.ascii	"\212\336\242\3724\275\223\276\321\320\363\017d"
+	.string	"\337A\354\006\234/\360\272\304\353\021\257C\274\277\300gxOy}:\357x\276\341\374\342\375\344<\324\364\207y\306}\373\213w\013\002\321\212\353\253\366i\276\224}\324\036\037\377\346;\3317\221\273\231\262f\272\213\r\200\372\241\321\035\034\177\271\372DzI\364\333\364\020\370\217F\307\252w\300_0z\364|d<3\275\203/\250\227\360\372\021b\177\302\372\031\310\256@\366\004\262\037\220/\001\177\200<Ro\264/\346[\331+\036\017\315\227\331\307\252\303\350\237\310\375L\3313\273\313Za\\\312\223N\261\372\304\352\232\325\247\325/\2477\234\256p\272\344\364\350:t\275q\225@G\262C\262K\331\343\353\360\365\347\365\027\351N\2447\221\316\304\356\266^\255\220;8\b\007\335\003s\304\325\005`\017q\351\227\3137\\]\001\373\312U\212\305=\261t\311\374\210\245o\3633\354\352\024\366\323U\251\301\r\261o\3467\300\f\216\237"
+	.string	"A\3537\210\377D\324:\002\255\023\330:e{I\374\310\326\025\333S\361!\370o\341\273\260\0025\306\350\025\f"
+	.ascii	"v\321\fW\"\273f\250MP\267\013\316XY\235L\030 \213}0\345c\202"
+	.ascii	"\200\314\036<\270)"
+	.text
+	.section	.gnu.lto_.decls.9d2f6871d924cfc7,"e",@progbits
+	.ascii	"(\265/\375`;<e\003\001Z\210%WW \fQI\215\001z\r\177H\005\177\200"
+	.ascii	"\307\261#\361\373\235!\304\201L\307\340}>\rT\2479\3548.\252\263"
+	.ascii	"\373\177D7\250\021n\033\321,\b\035iI\265\030?\307t\347\211O5"
+	.ascii	"?pG\322\253\0252\243H7\005\250V\214dO\265n\262\177\377_\b\331"
+	.ascii	"RJ\231\002\250\004b\005\245\005O\237\350\247N\375\024\210\376"
+	.ascii	"\226\224J?]\322\035\360\362\235~\216\323\317e\372y\210~\246\322"
+	.ascii	"\317M\372x\215>\006\243\217\345\264\b<\246\217\273\364\361\226"
+	.ascii	">\246\241\217\211t\007V\203\357\342\300\261\302\204\316)\252"
+	.ascii	"\247\356\025\375\333\246\357\214Z\rQ\027\210\023\2202\227\306"
+	.ascii	"\23516\305k\350\346\033\343\312\260\317;\343Y\254\312i\001\017"
+	.ascii	"\315\240\262\346\301\267\343\001\306\005\272\310-\355\013\352"
+	.ascii	"\311>\261\233\262\346>}\315\206,\315\233\024\323\203\0054+\020"
+	.ascii	"u\335|\235z\300\251\305]\247\333d\277\024\351\024\031\273\332"
+	.ascii	"\272\371z\260\030|7)\347\312\324\\\222\2313aS\366\254\236\016"
+	.ascii	"\336\033\307W\363\277G\267\350*]\244kt]\\\"\373\274Iw\371;d\315"
+	.ascii	"~\361\224\330E-\031;\2275\342\353LM\006\013\270Iv\215\325\263"
+	.ascii	"sQ\017\360\002\213\332/[\306\222\321I\367\2562k\356\355\364\371"
+	.ascii	"M\272\333\222\321\031rn\346\003\222\300p\202\267\267\323N\345"
+	.ascii	"\330s\342\3119\027\207\376e\352\337$}\233Fo\260\032|\026\215"
+	.ascii	"Mc\237\025\330\274g\260\200\343\245\330\376\262\260\006\311\232"
+	.ascii	"\274;}[\201\317\356\331\n|\267T\364\355\232\026a\237\332\212"
+	.ascii	"\261w\366y\201\035\343\334\271Zj\316\306\272\364\355\005>"
+	.string	"\274\267g/\360\3356\365\331\302T\260\343\234\321\244\343\346/\231G\f\274\246\233\255\227\rv\207\030\224\213\233o\267\364-t\316\222\341'S/\301b\212f1zQ\305I\203+FK_u\326\212Q\023\027\273\305\256`\273X-\366\211\305\322\025\355\275?l\370\301i\321\242\222\223osh[e5\3702\330\031\372vI_\004\372\253\226\273zTeY\344\342l\325\336P\030s\\j\334l\241\330(\366\311\301J\271\205\263S\236\0169\267\363.\213\350\351f\036\253\301w\213\232\004{[\016>\273\267g9\3708\374\216\264Q\355x\322\226V\311\303b\345\346k\300\004M\323\354L\317\211e\263k\326\315>m\233m\362\354\334\233\311\027\332\327t\212x\366\022Q^s\357}\013\375}n\333l\332\327\360\223\271\227\210\202D\340\331\344\350\to\357\375\341\303\206\017\037r\304\304$\311\270\311v[\r>\036\b\350{\240\317"
+	.string	"\375\f\364\347\254\206%e8\211\251\312\3313\202\222R\230\233o\313,\331\255\332\023\340"
+	.string	"\231\361\026\346f\253\304\206\331\347\337\254\330\355\230\205\336\246\310\271\241\266G\224e\217\233;X\r\276\374A\337:\177\301j\357\005\374\352\024\366\336\373g\377\346\313\300'\211\375\302\340cF9\267\331\336{\307\327\365$\007\232\233\357\264\032|\332b\360\335/\327\n\002n\225\377\302]\2671\n\370\261\226\273d\273Hk\027"
+	.ascii	"aMF\240v\227\230\374v\252\004\005o\300\237\035`e\004F\277%A\232"
+	.ascii	"\221\017\340\317\032h\t\301\005h\327\f/\271bG\204\322u\300\362"
+	.ascii	"|\203\037\307}\313\035[\243\340\212\205\375\027\354\277F\376"
+	.ascii	"\333|\002~|\343f\335\026<\276\341\036\376\034\342'\336\366\277"
+	.ascii	"\311o-\360\337\311\rA\204\337n\340\267#\234\202k\370s\005\257"
+	.ascii	"\373\317e\205\373\273X\307\360g\314\344\342\270SW\350\036m\217"
+	.ascii	"+u\343\332\370_\202\206\377\b\370o\215\037\340\307u\377\205z"
+	.ascii	"\361\337\237-\370m\372[\374[\233\337\372~\233\177\253\177{\377"
+	.ascii	"\313\301\177\375\347\343\1779\360\337\017\374\327\003\377\335"
+	.ascii	"\300\177M\370o\007\376\013t\372\257\211\377j\340\277%4\375\337"
+	.ascii	"\371\363\363\277L\377M\372o\321\177\207\376K\202\377\252\360"
+	.ascii	"\337\025\377-\3767\004\377U\361\337\341\177O\370/\b\376\313\200"
+	.ascii	"\377\026\340\277\004\370o\005\377\025\300\1779\374w\202\377^"
+	.ascii	"\370/\317\177u\376\373\373o\372_\374_\373\333\275\337\252\371"
+	.ascii	"\355\335o\321\374\366\314o\313\374v\314o\355~\013\346\267\\~"
+	.ascii	"\253\345\267u\277\245\373\355\225\337Z\371-\225\337\306\375\026"
+	.ascii	"\356\267Q~\373\366[\267\337\266\375v\355\267j\277\325\361[\263"
+	.ascii	"\337\226\375V\350\267\312\337\002\371\255\205\337\216\375\367"
+	.ascii	"\362\177\312\b\277}\376'\373m\330o\301~\353\365\333\256\337\026"
+	.ascii	"\371\255\220\3376\177\273\365\333\247\337B\375\326\306o}\374"
+	.ascii	"v\306\3771\377\241\377\363~\273\343\2679~{\364\333\025\277]\177"
+	.ascii	";\301o\001\360\333\013\277\355\371\355\316ou~{\363\037\314\377"
+	.ascii	"/\377\345\376?\371\357\366_\204\377e\377S\374\377\371\037\367"
+	.ascii	"_gooo\357\327#\376\233\031\377\207\f\004`0\025\037C\2407\277"
+	.ascii	"\214%\363\337&\207\r\211\332q\363sxp\341b\3112\317.\342\021v"
+	.ascii	"C\333'\326b\343.\317.BRj\346(\325\325Y\262\214\324ccp\234;::"
+	.ascii	"./8rW\256\\\247\020\234{\3713\302\361f\305\212\225\273\316\375"
+	.ascii	"tC\204\243\215\312\355\023S\301\320<\344\334K\237\\\032\251("
+	.ascii	"Q\356\220\304\305}m\204Y\225\321\263\203\260'V\3622Tu\363q\206"
+	.ascii	"\300=1\334u\272\300\004\301\350F\364*J\024\262\244\243.\274\246"
+	.ascii	"\2677+\347ag\036IG]]8CnnVnDV\325\020T\207\260+6\311\021\273,"
+	.ascii	"e\332n\237\270\r\213ypn\0307c{Y\326\326\214\364n\252\350c4\234"
+	.ascii	"v\314\344\211\231`5\355\334/~Za\242\230\036\376\2279V{\230\234"
+	.ascii	"\275\277\366\336\024\244X\210\374@S\323\377\375}{\210\271\367"
+	.ascii	"\206J\235\233I\224s\233Z\353\341\267`\261-\300\377\274\367\007"
+	.ascii	"{\017i\211\222\321C\326\206n\274\303N\347\366.\262Z\216\260z"
+	.ascii	"*\262\242\221\004\265\332\313\242\037\313\036\346\266Z&A\367"
+	.ascii	"\356\331EEK\023U\273'\t\272\237\266\021\226'\273\235V\313]T\265"
+	.ascii	"{v\321\036\352\220Td\365\224\004\035z\352I\202Z=m\250\325\346"
+	.ascii	"\331ECL\027E\233\331\263\241Vb6\264\352\211'\tZ\365\224\004\265"
+	.ascii	"\332\262r.\206L\201Z!\212\245f\227IE\333\251Ij\210\3113\227\344"
+	.ascii	"\254\332[\366\266fG\233Y\200\275\245\252\230[\206hX6\2429'\""
+	.ascii	"&CU\326\331DtU\265\213\346\222\210T\355M\204\bh\357\r\226\316"
+	.ascii	"\271\335\303\316-uHm\246\243\275\003\320\264\367\322\356\271"
+	.ascii	"\275\367r\357\375cJ9\367\266\301\223\324lj\332;jC\323\226Z\266"
+	.ascii	"\035\355}\315\272\260=%A\257\252|\332\312\240\315\215\344\\\332"
+	.ascii	"\346\336b\305\324\320\345s3\215\321\315'\030w7c3\0167kiQOPN'"
+	.ascii	"\016\033\216\263\030\230\214\311\336\230\345\315\277Yj<\326f"
+	.ascii	"\005&\214\306O&r^dKY\302\302l\331\b\263\252!\253\016a\313\253"
+	.ascii	".<\254\247\227\206&N\177a0\233*\033cCn_^^\266,\02797\224\357"
+	.ascii	"\352F\024\006;ZQd~\240\351#\270\353\322X\022\002\005\206\217"
+	.ascii	"\340\"\026r\232\340\226\324ia\"B\204X2\244\033Q\251\037O\374"
+	.ascii	"\0037-S\243\361\350\212n&\033\006\0360\020\233\025\306L\231\335"
+	.ascii	"|\033\030\3726H[O\274e\313687\324\rR\323Q\027\336f21\270\315"
+	.ascii	"\316\272}\342,\354\303.\231v\357&d5\242"
+	.ascii	"{Ga\240\245\322\250\235\271\271\307o\215\013\035X\030}\255\205"
+	.ascii	"\007V\022(Wf7c\254\213u\340\035\307X\370*\247\bc\345\275\207"
+	.ascii	"\254\265@\307Z\013\3227\256\2411_\276\276b\205\2512\332\224\271"
+	.ascii	"\036J>L^8\360\024\316\201\245p\025\276a\237\230\nG\035\327\300"
+	.ascii	"6\2361\025Nr\341\203\251\360R\222(\246\302M\230\006~2+@\207$"
+	.ascii	"\232\245\244\331It\262\335`1\370\256\327\364\f\241\2203c7_?\265"
+	.ascii	"\017\216\201\237\270d`(\f\303>q\f\314\314/,Y\321\225\026\024"
+	.ascii	"\307\300N\226\314\316\231\355\241\247\r\212<\257\272n\270\250"
+	.ascii	"\250\264\350|\235\245\257m\350\353\031\372\032J_;\351\353\245"
+	.ascii	"\376\257\214\376o\213\376\217N\377'\247\177\214\204\215p\320"
+	.ascii	"\232c\232\334|\321\334\275\375\303.\212\217p\221}b#l\204\227"
+	.ascii	"\230\310\316ee/.Q\016\0372\032\336\325\024_>&\262q\366\007\365"
+	.ascii	"\344\351\344f\013\347s<\204\331\240\034\351I\321\267S\362\300"
+	.ascii	"\254\301\373\252\261\317\213g\315\244\261qa\366\256\236\215\273"
+	.ascii	"\341r\346\255I*\301\312\323\371?/\375\037\021\375_S\377\327C"
+	.ascii	"\373,\2063\327\314\016\031\262\032pfn\324\302\222\022\246\255"
+	.string	"2dl\314\210\021\223\344\3461\276\347\227\037`7\377'\245\177\253\220\364hzeq\271V.\334\335r\273\334+\027\312\245r\345\356\223\033\345\306]0w\356j\271_n\230[\345\276]\273+\345z\271t\367\356\212\271u\027\313\315rW\270S\354\363F/\333o\333u\362|\211\024\341\002\202\244\271C+,\272\343\307\227\335\021-\253\265\250[\\\364V\345\220\022\335\301\005\246D\n\232\204\252\t6\365\325\345#\310\027\216&\364\252\211\231-%Q\263\033S\232B\272\242XL\232<\322\232_>\314\242\321\373\274k\330\331\004\201\310F\364F\257\324\245jB\004gd\313\256\007\317.\":k\352P\273A\242w\210\325\303\316\346o\311\325\217\2505\213\336,K\006;\3314\322\030Z\364\303MZ\f\031m\021\310\377=\351t\263\375\212\364\357\332u\336& \330\273\350^\215!j\273Y\315\306\213\213\033\222\233\357S\243\277"
+	.string	"h\023\332er\317\354\363\246\335\262\337%V\315\355\0243\253\247\263\344\331DtNi\227l/\305l\020\304y&\312f\005\254+w:\337\207E\3438}\037\234\276/\212\276b>\277c8E1\320~\334l\343\246\355"
+	.ascii	"|f\372\276$\372\276-}_\r}\037\222~j\247\237\322\351\251\221\267"
+	.ascii	"\364\350\013\031,7\247D\376\246\363\316\302\262\334\234\016\371"
+	.ascii	"\333/\256\312\025U\206"
+	.string	"!\332\207\217\264yaW\355\335\374\241\031eE\201<mZ\262\035\255\241%\335\315\351\017K\226#\r\232\"\\8F[\366\021\327\326\316\033\027S\031-\374\034@\2200%-\256\0366.c\005i\222$+\247\301g\24289Jy`\261)\262'\334\315iUZ\225b\331\315\254\243r\324\325\245\343)\326N\231\273\032qWw9\274XI\257R+\037e@^X/C\350z<\345\270u\nb\024w\245\251\324\362Y\215\254+\034e\\\210\024)3\205}\354\224y\021\r#eF\352\212\225\033\226\214\217\206Q^\332\315i\2144FZC/\265\250\244QOk\214\325a\271\2729\245\0016E\r\307\315\351\214\033Ef\224\367vs\232aI\377)\324S\0309[\240\324\246\322':&\025\275\247\254\364\363Q\346E3ef'\035$`\254\254\245/04\n\021\025\036\251S>\202\311\254\330\334nVRJ\231$"
+	.string	"\025\346\244K\207n\207\322\322\322S\246\035\242\"[jJ\272\300\324\325\260rt\224&]9\035u\351#n^\310 =M\302X>;%(-diQZ\324\226\317@\361!\203H\272\323\235\016Y5,^xx\327\306\230*>\322\345\323\241\2335Gb\3220\022\021]\264~\310\320\323\313k6T-\305x"
+	.ascii	"\273\022\206\b\336om\252\331\244\346y\215%s}\274\255\315a#9^"
+	.ascii	"\254\226\260\334|\fDxx9M\235\222\246\017I\357\213\033\232\347"
+	.ascii	"4\026mGm\221\371\270\020\311\201\264%L\230lf\003\334\315\252"
+	.ascii	":\253R\346\331\214N\330\324\231\330\315\231\214\r\302d\346\345"
+	.ascii	"\346<\206H\236\226)7\347\273\033\265'%%\346F\035\211\034\226"
+	.ascii	"\275\233\263]\216^\357\355+\332<\0133\267\304\366\345K\356by"
+	.ascii	"\234Dt_\232z\371\214A\204L\177\313\226\334\305\212\355\027\024"
+	.ascii	"\200\t\031B\304\303\006\304~\334].\317]\276\266\244\313\025\267"
+	.ascii	"5[\244\t\022\264\233\177\201j\205\025ps\204\207(C@\364z\270\346"
+	.ascii	"\216\204\311\222\005c\345\fm\233)\005\003\0376f\322\024,\031"
+	.ascii	"\013\206f,%\266\224\t\264h\tE\362,\206$\317mx:\227;Pil\027\264"
+	.ascii	"/Fn\266\362[\252\221fvd,\223m)\313\320/+g9\315\210\334\r\242"
+	.ascii	"\226\337\354\\\024\317.j\362%\372\005\227\227d\250\316\262go"
+	.ascii	"\035U\232q\271J\246\222\247d)Y\316>3\\f\362\r\031.\233Q\371\200"
+	.ascii	"\263B\031 s:y\354`( J\nAI\227\267\334$?\261sQ\316\r\205\243&"
+	.ascii	"Dk\006\224\034\305>\363\333\006\347\336f\034,\344q\301S\342{"
+	.ascii	"\222\335\330\224n \335\234\235Xh\334\222\016\032l\366\231\333"
+	.ascii	"v\220\204\250\371qs^;\030\027K\245\245\277\311hKB\345\346\367"
+	.ascii	"\304\320\357q\322\357Yf4]\027\235\252\222\247\317sF\237\347N"
+	.ascii	"\237\247\213>O\035Y\206\246\320)d\252@\365\350\2500\021]\321"
+	.ascii	"9,?w\274\330v\2449G\360a"
+	.string	"%\355\346\254\344\306\001i6\201\351l\371q\366\274\371\371+M\333#S\343\346\234D\037\361\270]p3\325\204\352\306\315\317I\376\214u\211\250\260\247\346\314\315w\310\347\331\253\n\224h\030\022}\213\304f\035\317F\262\216|\344>\235\313UO\n\003\035\263\261; 7;\213\2444\r\211\2739\013\311Dr\221\337\306\306\215\211N*\310M\026\026\256\"7_\3737_n>\007\371m~_\314\242\263-\375\374#\003Q#\347\306\243C?s\225\300K\016$7\347-}\304#\343\002\233.b`\264n~\336\3723\217[#k1\335\210\262\2739\367\310>\236\265r\326\316Z\033T\355=\224\265v\364\366\036\332\261\326\002k-\310^W@\320|\371<L\255c1\3702\226\317\363\216\013\304,.\356f\013;v\372\030\313\346\034\031G\266\302X\035|\230\230N\f\276SE\177'\215\312>3\225\325\033\021U\265\274\353"
+	.ascii	"\026$\f\221\324\312\314\031$\316\251\251\rA\\\034u\341\351\251"
+	.ascii	"#]\304\354\270\361\3147\360Y\036\022\333\313\235\265f\336\032"
+	.ascii	"934^\334\374\235\251\0325\354\272\340@1\232Q\247\027#F\246\261"
+	.ascii	"\227\237d\201B5\343\231F\216\231#=\264\233\263\flE\315\216\241"
+	.ascii	"\033eAIS\013\224/P\031\352\232\031\021%\266\241v\270\226f\244"
+	.ascii	"`\",@\332\304\230gb5\033\2651\235\217\243\256\256T\252l\254l"
+	.ascii	"\210\013\027\331)\f\317\341P\202\322\364\354\364{\276`\242\313"
+	.ascii	"L7wW\352\264d\246\274t\003\203\013\331\333\230\264G\036\f&7+"
+	.ascii	"]6\347\336\200\247pI\031\223\205\224\221l\034u\341M\031e\243"
+	.ascii	"+\252\243\256.\035\030D\231(H\235\332\236\216\213\274\314\313"
+	.ascii	"\263\254\\\203\007U\231\274\275\275\266\253.<\237\236\217-f"
+	.string	"\0275j,\231!\003\024y\nC\344\026\361\202ny\345\345\3318\273\331\354NR\"\332\213\006\347\270\342v\240A\203a\030\240M\n\006:vO\013Sg\316\330\270\021YU\031i\331%\252\353\006\306V\0270ze\312\3308\024Z\t)I\224\213\030<F\fV\363\355m\235U/\230wwXM/\355\222\264(\017\227\251\352\214U\234~N\231\235\335T\016\022/^0\030\256-\374\3458CUE*\201C5IT\252C"
+	.string	" Y"
+	.string	"\207\252RI\f\002\242 T\201\204;\"D\210\340@\003\021\"Dt\340\003D\006\223,nL\2340\022\215G\241\r\n\340\252\376\244&N\240"
+	.string	"\332L \344@\001\r\234(\241\004\t \005L`@\004`\t\022\200)N\364\020\225G\024H\022\306\023J\024\204\3045\205\232\fr0\252!\216D\337\007j\361\204\240\2228\3741\036\213\001\b\022\002'P\036\2057@k0(\204\361\030\024t\024\006 \205c\022\211\f\002\215D\345\315\201@\\\240\204\023)Bt@Ax,\226P\223\307\022;Cu\r\256 \256B\022\312\240\tIb\020C\013\344\261\204\206\025\031\342\007\211Ah\024\372`U\2258F\0257U\002\177\214?\310\324\370\203\304\252\nDeV*\325\344p\030\374\265@\036\2059\271\"\361-\264H\256J\342\217J\002\220\303P5\376\020\213\301\337PU\ne\241\252\374=\270\006\207?H\020:\311 \2200\027\221Aj\t$\374 ;\360\210"
+	.string	"\241\032\217&\220\252:\201\026\303\240J\202\022\371sAyc$\2414\201\203\036\032I\250A\307\020\222\307\017\3245\270\246P\"A\350\200d\001\\SPw&0\252\311\244\220\260g%\032O\350(\225\031P\"\177nn\20666\253\252T\223\026\214,\216&\214\307\013\250\305\240P\t\004\342\207\250\302(\224\f!\334Q\241\342\250\242\020\\1\350\003\201P\223G!P\250\"\204pX<\206\360\023\f\372\2558\376"
+	.string	"[\004Y\\\260 \002\304\232\f\"A(\221 \260PG\310\301\341\001\026\203F\342\0171y\234"
+	.string	"\005a0\271*\225\307\244\020\250\256\301!RH\203\211\023(V\004\215\276\025A#\016RWe\213\024\023\254\b\032K\030\246;\032\2007\305\240\320*\f\346\360$\217\311\244\232\036\221@a1(\344\271\220\230T\215\352\217\376\006\034(\200\203\016R\370\275\003\017Dx \302\367\016<\360\361\361\200\003\037}\016|\360\nT&\325\242\020\005\326\240\006\236U\004\022$\220@\0014q\002\205\215\0324<\221\302\361\204\237V\201I\025\251\252'\344\250@\345O\260\370\201:<\212\320\363c$&\203\352\t\300U\375I\006W\035\2411\270*\211C \222\005\016\n\023|\253\257x<N"
+	.string	"\230*\201\3015hB\250xL\241D\376\364\254\007\002\241D\376\2048\0223\254\305 V\002\205\307\013\254\301\"6\036\213\030\250X\304\352Ph%\256\305 0\005\n\020rR\340\250\312\244\320\261\304\320(tL\376\344 \217C\240\274\006S\004\t\031},\202I| \020BA\304b\361\230\314@\302\225\210LY\004[`\245*T\f\256\360\2557J\240Z$\2528&Q\f\211\310\234\365@ \206D\344\006\023V\t\354`HD\372P\330\023vHDb\026\301\0267*"
+	.string	"\001U \2139*"
+	.string	"\351\250Pq\\\205\204@ \341z4^P\221-V`R]\213D\025\300\236\325\250\n\223*\n\024H\241\241\221h\302\0048,\202\033\b\022J1$\"u\214J\243\212\f:\226\030\022Q\254\301\023V`0\022EXI\f\211H\036\022Eu\205Z\334Y\205\252\n\025\030\326\244\212LA\005\256E\342\n4\036U &\217@\033JP\213\353zL\002\225"
+	.string	""
+	.string	"#1\b\202J\314@B\n\301\242J\302\005\325\204\024AIu\035b \201E\260E\317\005\212\252PHBg\370\3033,\036\201\224j\022h\005\256F\342\021\271\252\312\rj\020q\275i\021,\252C\034\265\370c\ff\300\240\002I(1$\"/\264H\252+\216B5\251\303\"\330\002\270\022\203\210E \2202\230\024\356\034H\t\374!\2520\036K\\P\n\021\207\301$\020\311\302\202\nd\021\250D\376\374\3245\230\004\262P\213\035\374~\214\304aP\005\002*\213\307\344j<\n3\030\211)\004\203\200CUE*\201+\202F\013BZ\035\036\203\200\310\340\317\304\t\024\370&y\\\203\311\037u5\022oV!\244\221x\243\256 \256\301\025\304\244:\004\256\312`qg\025B\256BG\337\n\344\300\207"
+	.string	"?\"\325d\210\365xL\206\300A\201\302=\201\3025\201\302M!\030t\"\257\300\f4X\215\304\337\033\320\200\022\03520\002\bZ\b\302x$\256\301\037\342\212\2401\304\n\364C,\252\ba$\006\203B\b\223\312\020 \006\200\301\274\245-\263n\216\213K\253"
+	.ascii	"\261A\345i\025\ru\227E\312\315\251\234%s\244!c\224`)A\271\341"
+	.ascii	"\270\371\032\366\333[\ng\343\305\004\206\023\270T\312\r-31"
+	.string	")i\024!uZ\236\3401'\027)[\226P\356\322\227\003\212\345\313.u\222:I\335BX.e\245n6A\206\\1Yi\033\272);\342\305\214-M\302\3712g\243h\215\206\205%q6\206\232\3445:3\246\346d\250\245L\026\304x\231\331b\202\317>\340\355\020\273hh\251\231\035\\3\303\223\264,-K\315\354f\332\231\305X\362\324l'\311\023\332\2303\262.g{b\276\334\354\374\312y\361B\253\352\346\364\231\212=\035{:v\3231\274\267\347\003\313\262\304\227\303\302R0\275\334\273\356\253\231aLwu\245`7F\\_O\301\310\236j\320\251\233\323$\226\354\\~\254\211\2739\365z\223\032fkMnN\221\244Wz\213\331\026#`\251\220THj\3042\231\313\273\004\264a\211\212Q\344\001\205U\250C3$j\032+A\246\2302\n\r\321h\222t\243\024@0XL(\031O\2709\037\023"
+	.ascii	"\225'\324\261\234\006\231R4\"\222$\005\251\f\373\031\270\324"
+	.ascii	"\2344\343\270\264\022\331\243\343\304\3500'f0\3513\201\321\317"
+	.ascii	"$\246\244\344\007Y\236\3126G\314d\3335{x\225i\321\314\r\360\377"
+	.ascii	"K\300\266\t\255\323j\333\324\206D\017\270\370\021\225s,=\315"
+	.ascii	"\304J\2121u\377\240\233\303G\211>9\"\277\306s\265\223n\373qy"
+	.ascii	"r0?k\006m\366I\035\233Y\2234\315\365\274\001Z\t9;x\006\325/\244"
+	.ascii	"n;\035B\223\334\375\311\266!`]\331\b\354>\021-\017\222\3218\311"
+	.ascii	"V\223\351h\200D\223`|\366\363(\223\346+\354\245\221\f\371\023"
+	.ascii	"\020)Z\337\333\230\257\360\2327?Qk8\264\261\243Ny\004\265\013"
+	.ascii	"\230\005\222=rF\016@%\214\213\001\361u\f\256]A\306%\257\032\022"
+	.ascii	"\b\304\321?~3[0[\232O\243f\001)\353\032\363\327\355\n:R\213Q"
+	.ascii	"f^\354Z\220\250z\002\253vS&\263\211k\032\220\316d\363a\312\240"
+	.ascii	"\013m\205\332\0247,\f\2071\374\310O\201\020\311\027\317\266g"
+	.ascii	"\031\247#?J\3247\263\261\013\224o\tE\336\206/y\357\020h\344E"
+	.ascii	"F\330U\375\300\315\252d/\330\210\252\021\253\241#\247G6\301\026"
+	.ascii	"\242{\372\267\223\177\355\272\2249\305\335{6\254\264v]QWimU}"
+	.ascii	"u\275l\214\230\013\177,\243C\035\037\342<\265\257%\363\025P"
+	.string	"\"\234\371\2606\2117\271#Y.m&\233\212oEZ\333\"\202\235=?u\3756\203\373\365\224<\221\345\371#\266'\360\036\211*\365\nK\f\261R\031\231h\311\312gDrt/k8A\2353\227\311]\220\275}XB\220\022\221\350A3d\013\235\331-\r\277\262\254"
+	.ascii	"\303\ng\342\272t\204=t\340\220\237)\021+\024\226\236\027\275"
+	.ascii	"\305@\\\036\246\004\254(\347q.\364D!\013{\370&\215\334#\335\f"
+	.ascii	"\026S\004\302\240<\244\247\302=\202Qjx2\321\371\372s\342b\260"
+	.ascii	"9wLto\257\324\036=J0\223\007\341\\=o\026\331\251\302;\366\223"
+	.ascii	"\021\223b\207gr\216\004!k\317\177\257\266\357\206\222<Ij\013"
+	.ascii	"\355\342G\243c)\233\247\216\354\374 \234\326\022\205i\253\273"
+	.ascii	"\350\325u1\270mu\336,\257\276L\363g\334x\302r\220Q\355\332\b"
+	.ascii	"\376\324\2428\307\247w\261#\350\304\220\312\362\253\177\035\322"
+	.ascii	")\342P \210\212vcpj\352bp\354:\330.\006\024\353$\001\337\245"
+	.ascii	"\340\202h0\260\357l\025\030\006\252Gx\213\222W\271\341}\244\026"
+	.ascii	"A\223hY\260\201\353\037\336\236\356\301K\213>Qp5\370\215\257"
+	.ascii	"\323\250\320\203,S\236\372\033\013\260\252\323\256\262\267vk"
+	.ascii	"\036\217\002:\314\264~*\326\325\364\220a\344\351\r\002\214\r"
+	.ascii	"\315k\223q\304\226"
+	.string	"\315\325\025\356\027\364\216\245\356\325\260_e\245\326\366\225\033\002\235\333\002L\255\316+\360/\020\214T\304m\307\237\034?\304\r\035\260\357\235B\205\247\002\363\351`\377B\013\2632\337{y\001#\347\375\247\210kthd\007)p\035\272\022\253@\211\215r!6\270\260\342\373~\263P\2712\021.\211c\345q\232\253\342\261\323\206\275\264\227\347\372\341\263\\]\271\277_\032r\364\365\301|\202\223u^\335\337\321R\240\3214\232\325\306Be5\006J+C\215g\207\317\374Z\020\025\311^\222\217\023\320\013+\207W)t\204JJ\215-X\330\b z}\337`\320\243\232\364\330\355a\237\326\312\223\304\217T\376\232\324\303\t\301\305PB\372\230\214\002=\345\257\273\324t-\022!\335\027\264\306Y\364\036\333\ru\311t'\n\3060\035\261\217\205\252\213\327\311\245\346\030N\336s\264P\252t\214P\217?\235\352L;\375\\3,"
+	.string	"\267E\227\307[\233\210\270\320.v6\317\227\335\307\353J@D\244\202\247=l\3241\340H\005v-\367\213g\303\316\250\034\275v\310+\024\240\001\022\223\351\203k\330\003Y9\205z\236\331z\347\221\241\337\367-cZ\b\207\320o\312y\255\002b=AM\337\264g5\b\302#\0018\344O\306k\025\205\305\237\313\256)\233\3731\232T\\*r\301\265\267\343H\305\341\236S\320\004\326\204::t\204Z\246\200\333i\020\222\353\324\320\301*\365\373PF\223\303Q\334\300\304\304\252\250\300s\263U\241\232\200\273#R\367G"
+	.string	"\210H\344\264\236..\301\332\306\031\352s\223"
+	.string	"\216\300\002;Q=\216\234Pfi\266\247i\f\007Bq\227\034\332\375\250\020.\211\275\223MT\027\371"
+	.string	"\"\231\020\037d\304(\345\r*\020\225f\023\223F]X\037\233\311u\007\335\263\311>F87+\240 )m\247{R\320S\3747\251#\263\232\330b\1777\333\246\f!.\2704W\013S\217m\315J\247Y\346\340\325\005\022\004\033V\246\244\370\355k\353\201\3344\001\340\n\372[z\rY\34372\205\346\3371x[.BJ\201\216\263\007\214\310\377\332[5\020\"%\027k\205\246\213\242E\013\377\205\343q\247\035(\022h\211\033\203\204Trv_\224\\j\006p\212l\320\266\205U\017\2506l\033+@T\330\2470\360*\017|\036\312n\233\210b\262\212\321\002j]\2552\253\272pk\fW\362\210\341"
+	.string	"&\026\274\330\007\230\340\304R1&\221A\017\22337\007\0163\316\302f\250\211c'\201\264\367\"\270\203~d\350\225\030\260\334M\266\370\234\256#\301?\364f\353\333\366c\221\233\237/\032\241\016\225B(\217<\357\323bw\255\341\252\302\017\247.`\307\377eRR\210rm\301,\267\025\202\2042q\261\366; \210;"
+	.string	"\006\020\341f\213\373i\2040\023\242\3360\214x\304\376U~\226\230S(c\"\304\0019\017`\206kV\371\257\336\036x-"
+	.string	"\177>\013\232W\243\275\031\350C\200\236\214\342?\267\336\303\376\021\321\263@e\255\250\244\364o\210\371\352)\270\033\3577uv\204\006\325\005\243\343\007\307\\\226\203\326\240\235\341\006W\334\362\b\003\2518\026\236\0248\365\344\370\177\215\203Y\306\031|\325St="
+	.string	"x\243\335\244\332O\215\334"
+	.string	">[0\274\260\353\347/\314\213-:(,\217/5\203\2653\341\330\025)n\206\2528+\005J*\3661\344\341\230\324A\035`\343a?\200\327\\\026\243\354Ts#\246\357`\207\322h&\204r\353\t\355\303\307qD\256\203\302\272\025\332\2029\211\227\315\335\312\004rn\215\016J(C\246\266\265f\255\277(\004\235\3031\3219\r\343\004\315q(\311\303\030\301\336q\024\030"
+	.ascii	"1O\217\320\267\3150\372\216\371L&\016u\315\324\350\201\257\342"
+	.ascii	"\016\277\003<F;\262\027 \037\214\224^\236^\020\363j&\315\373"
+	.ascii	"\317TF_y\277\265\205\256\242\340#r\335$\326\220* \234\351\325"
+	.ascii	"o\256_\002\357\350Rv\346pClZ\311\273\224\300\274\3019~u\256\343"
+	.ascii	"V\240\r\215\364\036\201`\004`Xp\007\024p\241\330&\374%\013\023"
+	.ascii	"_\025#\373\f6\304\347\261\003\t\272\370\340{&\341:\324\203\306"
+	.ascii	"Px\370\261r\026\007'\335 \fLY\272\271y\330w\366nx\007\277\217"
+	.ascii	"l\270\022A\021\276\360s\232\016\267N_9~\033\271T\364A\307\022"
+	.ascii	"\004\374\356\031*\322L\f|\346\030\222m\325u\275\230\365|s\301"
+	.ascii	"@\360\261\340n\261\341\220u\211\346\351\253]\325\215[\036\002"
+	.ascii	"\022\005YQ$V<\302\334\256\214\300O\013\242&\3154\241\310\206"
+	.ascii	"\230\035}e\3509Z9\363[\025\341\256bbA\t\360k\f\330\304\"\232"
+	.ascii	"\206Q\320\205\365\265\254o\030*;o\013\237\230\233|\274\261\272"
+	.ascii	"O\273\261\333\267\222\343\031\350NZ\213\026\177\204V\210z[\327"
+	.ascii	"\203)\344\263\364\264P\312\341\\\230\315\204\0052{4\016\f?.\301"
+	.ascii	"\250\2436\260y/0\317\312#6\005\210\035\377;]\037\334A\3675:\031"
+	.ascii	"\353dE\262z\233\300n\177\020\365\026\317,\236\360.\250\f|\273"
+	.ascii	"\031dsS\013\274\304B\007&\377\3778\225\fz\353uo\256!\020\255"
+	.ascii	"B\233\271g\n\360R\016\330i\376_(\t\225\212\267<\250\262\3474"
+	.ascii	"\230$@5\261\240\201\245%\306\271}\233v.j\036d\177l5\376u2\250"
+	.ascii	"\300ks+\334\363\177o\276y\3609?no\031d\302nk\0130Q$B\372\035"
+	.ascii	"\312\213_\321P\210\273z\016\247\234<.\211\346\344\247\301\363"
+	.ascii	"G\321\307q\030\230\205\336;q/\037\230\036\002\363o\236w\344\204"
+	.ascii	"\335K7\274W65\243\257\207\316S\277C\357Wt\273\322\367\244\257"
+	.ascii	"\253\036\254\274\370\214\020\376\333o\336\321?\247\373Y\364\247"
+	.ascii	"\002\333(\364n\221>\327\316u\324\303\352k\314\237\245\355\025"
+	.ascii	"\3026\022\253Y\315D\237T\363\241\206\336@\335\211=\255\273\261"
+	.ascii	"2f\343\377V6\247\257\255\372\351\021\371%m\270\2112\267\320\347"
+	.ascii	"\202\277\312\262\243\\\234\351\246\323\302O\346\353\322\347\306"
+	.ascii	"\357Gv\020"
+	.string	"\246\274\345\236\203\331s\212\026\305_\261\353X\231\207\277\357\253>\002>\246<\333\006\353\325\2710o\331\301\347\311\241\345;\316!\211OZ\213<6\227#\r\227\300\037\034"
+	.string	"l\266\300\240\346>\360sr8\302\333\331\037q\003\367\031(\276(t\313\360\360\355\262\037\206\254h#\364\037#f|\220/\3426\3554/\2305\217\276G\326\337\340C\224\370\177\375\305N\323\246\237\3417i\357b\277\311\364jn\334$Uo\211\035\324\007\t.0O\311c\351#|K\210\003\251N\275\277\213GO\224\337\002\350c|/\356\375\210[\251X_iG\360S\267\205O\337\b]\243\216\322\346\213\004\303\364\377(\003\225\363\236\346\217\246M\302\357\364}\316\236x\322\214\233[\277/\337\246\034L{\266\375\377\345\331\274#\305u\355*\374c\024<zx{h\3367"
+	.ascii	"\365%\361v\202\275\354Dc\035\301\210\335\177\367\206\344 \365"
+	.ascii	"\202\374\021i\202~\204\370\201\272\t\232\017\210|\037\377\210"
+	.ascii	"X\301\221^\3535\341u~~\035\266\335[\303\264\362\244\272\312\021"
+	.ascii	"S^A8x\027:\335tO\334R;\305\246u\005"
+	.text
+	.section	.gnu.lto_.symtab.9d2f6871d924cfc7,"e",@progbits
+	.string	"navigationConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\001"
+	.string	""
+	.string	"navNewGpsData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\001"
+	.string	""
+	.string	"GPS_reset_nav"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\002"
+	.string	""
+	.string	"gpsUsePIDs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\002"
+	.string	""
+	.string	"navigationInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\002"
+	.string	""
+	.string	"GPS_set_next_wp"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\002"
+	.string	""
+	.string	"updateGpsStateForHomeAndHoldMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\002"
+	.string	""
+	.string	"updateGpsWaypointsAndMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\002"
+	.string	""
+	.string	"GPS_hold"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\001"
+	.string	""
+	.string	"pgResetTemplate_navigationConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\002"
+	.string	""
+	.string	"navigationConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\002"
+	.string	""
+	.string	"navigationConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\002"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\002"
+	.string	""
+	.string	"actual_speed"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\001"
+	.string	""
+	.string	"dTnav"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\001"
+	.string	""
+	.string	"magHold"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\001"
+	.string	""
+	.string	"nav_mode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\001"
+	.string	""
+	.string	"nav_takeoff_bearing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\001"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\001"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\001"
+	.string	""
+	.string	"GPS_scaleLonDown"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\001"
+	.string	""
+	.string	"GPS_angle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\002"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\002"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\002"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\002"
+	.string	""
+	.string	"GPS_home"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\001"
+	.string	""
+	.string	"sin_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\002"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\002"
+	.string	""
+	.string	"GPS_distance_cm_bearing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\002"
+	.string	""
+	.string	"GPS_calc_longitude_scaling"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\002"
+	.string	""
+	.string	"disableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\002"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\002"
+	.string	""
+	.string	"enableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\002"
+	.string	""
+	.string	"areSticksInApModePosition"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\002"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.9d2f6871d924cfc7,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
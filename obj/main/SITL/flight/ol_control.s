@@ -0,0 +1,554 @@
+	.file	"ol_control.c"
+	.section	.gnu.lto_.profile.ed44c25d3220e500,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.ed44c25d3220e500,"e",@progbits
+	.string	"(\265/\375 \340=\003"
+	.string	"t\003\324"
+	.string	"\004"
+	.string	"\243\350\271\235\016\f\002"
+	.string	"\002\001\002\001\240\342\234\212\n\003\216\337\217\335\fP\002"
+	.string	"\003\004\002\004\002\005\002\002\002\006\002\007\b\002\b"
+	.string	"\002\t\n\240\342\234\212\n"
+	.string	"\024"
+	.string	"0\223`e\003\f\200,\300\024\004[\b"
+	.string	"\006"
+	.string	"\034"
+	.string	"\001/\034\254p0U\216\231m"
+	.ascii	"\365]\013\240\336\225\223:3\020\273\2366\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.ed44c25d3220e500,"e",@progbits
+	.string	"(\265/\375  \275"
+	.string	""
+	.string	"h\024"
+	.string	"\002"
+	.string	""
+	.string	"\001\003"
+	.string	"\001\001"
+	.string	"\001"
+	.string	"\003"
+	.string	"7e\344\002\331"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.ed44c25d3220e500,"e",@progbits
+	.string	"(\265/\375 \205\315\002"
+	.string	"\004\004y"
+	.string	"\002"
+	.string	""
+	.string	"\013\200\200\200\300\003g\003"
+	.string	""
+	.string	"\002\f\200\200\200\200\003e"
+	.string	""
+	.string	"\006\002d\002"
+	.string	""
+	.string	"\001\n\003"
+	.string	"\206\001\376\250\230\220\002j\364\001\275\275\224\205\003i\003\f\220N\002\013\001\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	" c\226\305ZY\270*\344T\005\224\262d(\033\260\330\261\2016"
+	.text
+	.section	.gnu.lto_.jmpfuncs.ed44c25d3220e500,"e",@progbits
+	.string	"(\265/\375 &\235"
+	.string	""
+	.string	"8\032"
+	.string	"\002"
+	.string	"\003"
+	.string	""
+	.string	"\004"
+	.ascii	"(\033X\362\002\2137\200\005"
+	.text
+	.section	.gnu.lto_.pureconst.ed44c25d3220e500,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\230\004\003\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.ed44c25d3220e500,"e",@progbits
+	.string	"(\265/\375 B\205\001"
+	.string	"\024\0026"
+	.string	"\002"
+	.string	"\001\002\n"
+	.string	"\001\002\013\001"
+	.string	""
+	.string	"\001\002\f"
+	.string	"\003"
+	.string	""
+	.string	"\002\002\r"
+	.string	"\001\002\016\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"5i\360\fXK~`\361\006\260"
+	.text
+	.section	.gnu.lto_.lto.ed44c25d3220e500,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_ol_control_reset.21.ed44c25d3220e500,"e",@progbits
+	.string	"(\265/\375`\b\001u\n"
+	.string	"&\022C:0\257\322\001"
+	.string	"\001\003\216'\"\324+7\232\272w\377e\277\f\215\216\236\021\332\001q\2525\322Q\320\206\357|\274\256\206\030\236\024\342\251\t\032\f\204N{N\240\303\376'\177\357\224\0020"
+	.string	"1"
+	.string	"4"
+	.string	"\0329\334\336:\233\207\355s\234\262[\016.\006\306\f\331\270\273tv<u\231\362\017\362\200\220\005^n\030v\3272dm\334\363\266;\266\023\354\273\002\235'N\362\341;\377\244y\327\255\304\306Q%s\024\307e\244]a!\037\232"
+	.string	"\346\266\232\240\r\003\345\344\260\237\331\335\365l\331\227\276\200\002\206\201\270\033\237\333,\002\240\274\006\362B!\315\273\317M\215\026\023\"\372\211\t\3555z\t\311\006\234\215\021\227\305f/\213\266e\307.}\304b\001\313\356.\370\"\207U\337\365\366<\244\372\241L\325\373\220*EA\210F\244\007j\032\201J\324\373N\324\203\340*\021\372(\252\326\217r`\373\314\316V\303\307M5W\376\264\035\256\222\"_B\027\007\033"
+	.string	"3\241a)0Dz)pW\fI\206F\0300\b\f\2744\231\007\307"
+	.string	"w\307\200` \017\340.\220\t\220\007p7\025\007`\270\262j"
+	.ascii	"\204\201kh\266{\027L^\206\b\227c\321N2"
+	.text
+	.section	.gnu.lto_ol_control_run.22.ed44c25d3220e500,"e",@progbits
+	.string	"(\265/\375`Z\023\245J"
+	.string	"\312\201\274\033N0V\252\244\003A)\352-z&\266\373\375\341\266U\021\333\277\240d\177\350\361~\323\366\247Dl\347\007\032\024\b\332\267\024\0240\237\263n\211&>8\005\301\020\253\373\251\272\340~N\253\002qy[D\r\256x\213C\227\034\277\265F6I2\311\223\001}\001\275\001^\205\341\325\027^u\341\325\026^\r\300\253,\274\n\345\325'\257\256\360\252\n\257\246\360*"
+	.ascii	"^E\341U'\2576y\225\311\253K\343\252\322\270\232\344U\244q\365"
+	.ascii	"h\256\032\315\325\"\257\022y\3657\256\016\315U\241\271\032\344"
+	.ascii	"U \257\372\306\325\336Wy\273Jzuzu\364\352\275\272^5\007@0\314"
+	.ascii	"q\212S\226Q\356\236(\345L6`\034g\313\3318\330cl2\266\031[\007"
+	.ascii	"\373\214\235\306>U;\214o\260\030\317\271\214s\360\016F\343\242"
+	.ascii	"\006\245\271\302v\344\f\225\":\020\201\230i\301\212L\rj\252\306"
+	.ascii	"h\021\312W\226>\354\240\006\007\016#\b\201\005\211\032rZ\204"
+	.ascii	"*+*\321\202?\260\321\350y\252k\260\r@\307i\2617&eI\230\002\020"
+	.ascii	"H\224e9\303S\247z\236PV\"=G#\221\236\nT\325c9\265\322b\252\230"
+	.ascii	"\3155Q\226%\325W0\320MLKJIHGFED\277!\241  _\217G\316\361\013"
+	.ascii	"T\363\254|g\30317\315`\246\031\300\354\322\027+}ia\223\274\030"
+	.ascii	"\311\013\013{\324\305F]\326\266H\315D#\225\033(QLG\212\332X\244"
+	.ascii	"\346'\t\024\366G\364\020\021\313\n]q\320\025+\013T\305\276*,"
+	.ascii	"\332\244P\331\036\213-\"L1o\224A|C\202\351H\2312*\315I\001\217"
+	.ascii	"\331\222&x\n\203\206Pv\004\032\232\340\377\206e#TY\226.z\321"
+	.ascii	"\206\301]\236UY\226\272gC\021\254NVu\233\252&Q=\032\022\277\243"
+	.ascii	"\305\337\235!|\266g\374~~\353\204\304\254\033\371x\027=\332]"
+	.ascii	"\211#l\013\356]\0027r\222Op\357\032x\002\327\025.\021$\271^e"
+	.ascii	"\205\t!\233\347\210\002\004%\304\320\225\255\237\361id\031\223"
+	.ascii	"WYq#$\006\267,\313\261?M\213\316\301\214\217\\\251#\227\262$"
+	.ascii	"k\261\365\t\202\020b"
+	.string	"\336\224\255\037\335\373[7\032![p\211\343\3001\335\003\020D\020\001\351\271\207A\204\004\016B\213\275\037\f\304\004YZZ\244\247?\307z\350\023\247\\v\243\305\244;eY\336P\267q\017\025\250\275xj\223\013. =\265\376\244\315[\234oU\277\236\254\317\324d\302\310\t~L\325k\314F\213j/\032\246i\326g\236jMCzf\375\3034oS\310\366NU.\270OS\365X\236\213\252q\260\212y\2145\314f\254`\326\301\372\304\311\227\227\345\254]L\270L\306\272\3453V-\247\261f9\316\352\200\345\254KL\306\332\200W\225x5\211W\221x\365\210W\261\274\312\200W\215x\265\210W\211xu\210W\205xu\001\257\006\031W\201\314\325\253\271\252\200W\177x5\201q\325\307\\\265\232\253=\274\212\200Wy\214\253;\346\352\001s\265\312\253:\306\325\034s\025\307\\\275\261\2536\274Z\303\253\006x\265"
+	.string	"\257\322\360*\001^\245\362\352\224W\245\274\032\345\325\031^\225\341\325\001\274*\200Wc\004y\204m1\316\343\002\374uX\266\315\205\0301\206\177\336\342\310\270\020\035\351$\2372\260\023\235\\\242\247\343<\262\224e\331{r\0350\376\342`\016\034\006\n\333e\355\305\247\026>o.\336\342On4\037\330y!\313\222\273\370\341\b\333\202ZV\205\264\026\237Z\352\212\0028\213;\271\347R\330\022\300\237\262\240\300\242\017\324\237\376u\317a\271\002\365\247*T\236>\207GL\355\212\253\002\323\200+@\225}L\263\256\342+.%$\006\327\326\204\022T\3347\324\323'\216\314de\334t@\264)\216B\314\033"
+	.string	"\216\342)\356?B\242\327\275\016\300\267N\327\273\216\3425\260\304\021\2669\275\351^,\254\bC\247\0266J\bM\237k\362\2741}\351]@0\373\201\026{\213\306\364\027kqd.\254\007k\266\035"
+	.string	"_"
+	.string	"\306"
+	.ascii	"t[\237\001\335H\317\245\3175x\372\374\224\246\026\312\226\001"
+	.ascii	"\331\211L\272\022\r\301\275{\333\261+\217QS \334\226@\033v\330"
+	.ascii	"\371\016\030\306\307\217\037\244g\322="
+	.string	"f-n(\214\320\321\375\370\t'\326\332\2064\372Q\321\215\336\004\307/:Y\027\004\0074t&\370\b}\350\263NHG\266\306uTP\233S\204\2357H\224\252BeA\027\272\323\234\260-\030t\036\0343;\337\323\360\230</\004\267\261\327\273\252FY\211\253(\265\262,s\250\223\360\236 B\210\020!y\357}\326\231\331\031\361\021\332F\017\357Cs\354\274\371\313\031Q\016\357i*\346\246gr}+\006\272q\353bn_\316\344\r\034M\312X$\371\025b\210p\0216\002\013\211\022%\244'\371\251\305\316\333\224\031b[\333$\314\311\267\274\2644\330 \203\271\345\2455\001\330\324 k7\310Z\r\270v\003\256U\255\251\256/01\f\276\264&\350\372\242\022\263\240\202&]L\2500h\222\345E\245\005\026F5\365\244_N\270\300\250\304\276\276\300\250\202\344\310<\226\347\242Cb\220C\366\240*\201\262{\222"
+	.ascii	"\232\355\021Z\\%\347\2619\323'.\211\007\213\307"
+	.string	"\210%B\213\275;I\356\333r\346-\016\311\355\324\371\334\331\221c\035\311'\034!\233\357GN\376a\340\277c}\254\023\2661p15&\204E.\004\235\255;\333C\344B^\344\023\215\2208\344\276\0239\2116\344v\313\262\300\177\027\362\261N\220/\360\317\t\367\350X\255(\300!\351\263 WqfEN\331\307\232\200\320\301\271:\020\005~\365\246??\256\300\b\013\304\017?\230\300,\371X7=X\335G\217[\335\t\r\002\357q\233\331\225\260<h\261\267l\0208\217\2658%\026\222vH\255\232\342\001\337Q\365\003n\337\253N\376AZ3\266q\036\t+\034\345\210\3323W1\356\354\0168\236\3433\317\215\343\270\205m\277\337\270\351\324\312\030=M)\200\263#r\362-\270/?\257;p4\n\340\364\020}}\013\216\370\353\372\222)c\2216\266\214\215\027[\306\274M!s\361\373N\362\031\305\376\223K\270"
+	.string	"\372/\354@5^\300\305\fx\215\023V.\214\0014N\365\002\b8\r\244\0230u\244SQY8\032\246\316\033\376\351#\365\031\017\273\r5t\242d\361\023u\251\247\230\023\266YY7\031\242n\2725\031\027\3403>\346\021\022\273\264\351\"\307n\200\313\270S\235\2667l=\356\356\236\340\361\001>\003\201V\250Q<e\215b\246d$JR\220$\215\001\021\006\204\030\246\314\310\r\021\300$\307\2202\314H\215$\005%\005)\f\007A\026:!L&\205O>8\200\274\254O*L\302\261&\362\207u\020\215\264\256\205\026\353t8\301\220\230OiL\215\266K\241\013\223H\022\355\244\372!\025<\310\026\251\225\255G\334X\205\211$BI'*\250\240\204\260\211\262\363{\251\005N\020\217\234\346+\234<\256i'"
+	.string	"J\222\035\006\241\034\021\316\203it\365\342H\220j!\251\317\017ZV\263\201\0066\270<I\304\037\244h\251\221"
+	.ascii	"E\3020\265\35734\004Q\302{\311ap\002\r}\315C\tX\324\246\030+"
+	.ascii	"\260\210N>\374\030\272\361\324\020*\227WFq.\212\211JE\330"
+	.string	"]$\267u\016\fD,a\276\211}\271\332\334\272VHc\343\023\343mw}\216\007i:@\251r\241g\346V\373\364LV\212\255"
+	.string	"\243\016\221G\236\005.\313f\021\023\337D\216B\363\331\245\004K\330\222H\007\313\031ew3\353\373\325T\t_\351\f\035\220\242J\367e\016\033\335\231\243\252\360\0201\347\263g\241\271`\201\2513\001 tC#P\375\314\3314\"\034\022\013s\030w%\026Gs\030\035\371K\314O \220T\311\255$\002@\254\022\274\304\205i\276\017\330\310{M"
+	.string	"<\342\031\272\311\217\024\204\356\225\247\207\212\277\263\007\026\022\023}Rm Esx`#\224\314\245]_\"\005\312\306\225\034c\370\310\225\244\036\300x\307\3160\326\336\213\220\005T\351\347 \325\032\023[\302\b\276iaE\375\335\3605\304h"
+	.ascii	"\021\203)\026D\314\327\nlCp\034\032\343D\213Y\027W\344\004Z\231"
+	.ascii	"\245\227\314dq\365b\230vr\346,=#\211\321\253mx=\371x\251\223"
+	.ascii	"\250,\253\214\307\200\177\347\237\344\365\307\363\347\246-^>"
+	.ascii	"\021\006\310\346(\207Wu'\306E\252\305\275\227:\200\344\357:\257"
+	.ascii	"\301\r\033\323\f\350J\224\305\373\313\201\316BWa\363\251l>\025"
+	.ascii	"\266\3067\262\224!\331c\027\342\177eq\302`\fP\004\314\363A]\301"
+	.ascii	"9\227@.+ \257\r8\031U\344M\021K \227\025\220\327\306\340L\253"
+	.ascii	"A*N\0328\353\303\357,1\304\330[\266P\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.ed44c25d3220e500,"e",@progbits
+	.string	"(\265/\375`Z"
+	.string	"M\005"
+	.string	"$\007V\001"
+	.string	""
+	.string	""
+	.string	"\002\025\177\017\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\005\022\020\201\204\005\031\021 \026\177\022\032\023\005\034\024\035\025\036\026\037\027 \030\002\031\001\030\177\032\377\037"
+	.string	""
+	.string	"\200\200\200\001\027\177\033#\177\034\"\177\035!\177\036\033\177\037\003"
+	.string	"\f$\003"
+	.string	"\013D\003\003\020\017\210\327\307\202\001\001\204\032\003\003\016\304w\003\003\r\244z"
+	.string	"\027"
+	.string	".C\0135\022(\2445\310\305\032\006\250\007"
+	.string	"\007"
+	.string	"\007"
+	.ascii	"\207\017\220\034\227\352X0<\277*L\003\327@k@\032\270\246\322"
+	.ascii	"N\250\265\201wKY\026\261\324\023"
+	.text
+	.section	.gnu.lto_.refs.ed44c25d3220e500,"e",@progbits
+	.string	"(\265/\375 \322\205\004"
+	.string	"\322\312\035'pK\222\306\300@\211\307\364-\202\0174\250\252\252\252\252\252\252\252{Qpy@\376?7\220{\341mI\333\2555\231\002\037\021Q\036\002\262\177xlwplh\354\031\030g_4\267\240\240O\324%\350\210\032\242~\240\035\352\006\232\241^\250'\264B\235@#\324\007g\r$\027\234%8;pV@9\240\031`Fy\241\307\\&%\333\243\334li\313l\227m\363\212\t"
+	.ascii	" JK\024\224(\020\007\202\265\004D\211y\265Dl\270T\031"
+	.text
+	.section	.gnu.lto_.decls.ed44c25d3220e500,"e",@progbits
+	.string	"(\265/\375`\343\023\375`"
+	.ascii	"\n\250\204$P0\222J\032\016\022\366(%qV)N\002x\227\237?(\315L"
+	.ascii	"\317p\252\372\221\300\351`\245\3214'\271\312\201\250Z\354L\022"
+	.ascii	"\326\022`\026\0230\233E8w\337\374\374 \206C\325\b\356\346M\276"
+	.ascii	"\027\037\344\317LtK\327\312S\350_\222n+e\n\346\001=\002@\002"
+	.ascii	":\252h\221&\221r{\251g\034\324"
+	.string	"\363\023\365\354D=3Q\317I\324\363\021\365\214\245\236\211\374\260\006h\254M\334\233\030*_\316\302v@\343B\263f\326\207e\263mV\315\266m\232u\3333\013\3355\333\303\227\314\226\251\002F\314K\032\017ac\\\276\266mf\313\005%\313\333\230{\001J\nur\013\354\215\255\013\2265\033\346k@Ig\tU\252\340\276\272{\305\212\025!\334\236]\312\004\2202\321\256Q\277e\324/\030\365\273E\375\232\251\3371\365;E\375FQ\277L\324o\226\372\r\242\016}\267\374Ke\3036M\247\344\321l\263n\347\210\024H\363\n\016\247\337\261\377\350\271d\377Q\331\220#\035\276\326\343\240o\\\201\340\337*\316\257\001\365t\203\271\342\332\260\377\350_\261\035\333\264\265\362\265\024:\272\301\004\341\221\341\201R\211\353\356,\273\266XV\313\252-t\323\326\354{\266hO\235\335\311\356^qB\267\344l\031\366\223nsM\360"
+	.string	"\240\241~\257|\351LG\360\007\324+\240>\205z\022\352}\324\267\255\t\336Y\035Z\023\274tK\360\204\234k\202\247n\t\236\332\261w\201\377x\376e\340\377\334\277\r\374\253\300\277Q1\374K\364\037\210\177\023\370\177\347\337\003\376\035\"\361\357"
+	.string	"\377\226\370w\006\f7\363/\005/<\215\334\177\270\026\036\302\377\023\377i\374O\361\n~\016\376\307\362\277M\355\177\332\377\265\377YZ\270p\022?\233\360o\013\377J\375\013\365o\n\377\206\360/\b\377z\360\257\006\377b\360\257\005\377V\360o\214\177\221\376\205\361\357\213\177]\374[\364\257\372o\317\177\264\377 \374W\363\257\003\377\022\360\257\317\277\377?\302\377\350\377<\377\335\376k\371\377\301\377\241\377b\376\353\242\321h\364\3371\277n\355\017\"\nc\260\230\235d>)\237\316\2432\211\265\304\240\227C\312F2\205\372\211\265\354g\003\031\241L\"\217\312d31\350e+\221\314\325\321M\246\362\211\265\034\241|b1\225O$S\250\235\275T:\265\226\333O$s\307\023\311\\\245\023\213\331O,\246"
+	.ascii	"x\2228\350\330\221\007\231g\311\224\311\356Au\205\\\n\265)\235"
+	.ascii	"\315f\323\275f8z\211@\367Us\311\006\td\265L\265\365\230\302\202"
+	.ascii	"l\256\263\273QPMe5;\331\246\354jvwM55\025\214\243\263\255\225"
+	.ascii	"l\333Q\353\252y\340\350\036\200\252\373\270\335\326\335\307\356"
+	.ascii	"\356-\257\234\335B\204\224\\TT\335V'\250\372\352\270\005G7"
+	.string	"\233\271ia*\237Y\315\243-W\236\\\235\303y\\\256f\203\265T\237G\262\346\321\335KG\345b\3160\207\227\030a\266\037\312\254qJ\347jl\3410\t#\322\204\314\006'K\270\310\344(\031\343\"6\274\205\261\221\235\323M^$!\302\026\30770\022N\302GX\213\2618\213\225,\224\215pSU#g\304\213Dz]\016\352uN\324\353\226\250\327!Q\177\276\022\022\002\215\213\216\032\247=\230\006 \244P\367V\234\267!\034d\241,D\b\377`\253mK\222\202\265yC\261\"E\213\313\342\201\227\236\255\222=\037]\310\3308\345\034Gg :-;\340\300\303\351uY\352Y\271|\3033p\r\354c\241L\303\317<\230\352\\\305:\200v\335M8\\L\0033Y\007\020\322\331K\021\334\b\351*\212\035\231S\323\353n\250\347\250z\236S\317uT\027k\202\307\333!\203\r++1N\3172\260\216m\266"
+	.ascii	"@3\350\360%\204SN\362\215\205\242`\034\347\034\254\374\016\351"
+	.ascii	"l\347\316I2\305\344ThM\360\230\335\2500t/\n\336F\243\213\202"
+	.ascii	"\307\310\243\363T\t\336\322\312\331A\0230\321\002\343T\307G\024"
+	.ascii	"=)[\212\334\300\255\"\310\371\203J\213\323\177\243w~\220\\\313"
+	.ascii	"3N\351|\301\201 \216\231\234027Y\336\214\315\241\002\304\312"
+	.ascii	"m\020\213g\341vn\3436\317B\367\316\326\371\262\255\235;\373\366"
+	.ascii	"\003,S\3208e5\3475\177\217\210\"\307(R\210\250\314\003\247a\037"
+	.ascii	"\262\200@Rq\372^\020\365\214&\2153\266\305\206S>\243\342\350"
+	.ascii	"\361h \335\201\026\367\344\364|\346\347\036\226\214\315\240 "
+	.ascii	"\342\n\212\326\021N\271\f\267\235\3150\231f30\232\335H6\023\204"
+	.ascii	"\247\033\031\264{\300\356\001)X\326\0234^\372^\016\365G\314\321"
+	.ascii	"y\314.\210\030#L8\r\261%x\274\003\203\3410E\256|\\\201S\317_"
+	.ascii	"\376\367\360\246xu\r\t\002R\207J\217\260\345\302C\036\353\024"
+	.ascii	"\341\224\273\234\275\374==>r<!\343\362\367\350\252\262nh\231"
+	.ascii	"\242\236\327\245EK\001d\252\340\276R\271\260&WM\365jj\274\265"
+	.ascii	"e]%\203\n\0216\" &ZV@pz\036\01733\306b\201Y#\231D_:\216W\\/\301"
+	.ascii	"\260\030\341\244M\n\247|\306h\013%\342\264\367$\235\375\354Q"
+	.ascii	"C\307\006\2633\352\227\210\027\024\215F\243K\304\373\216\355"
+	.ascii	"\312\0256\342\365E\204\355'\252DN\032\264\262\205r\031?SdY\037"
+	.ascii	"]\230\023\322\025\267c\340\200Tq\312V|\326\322\254\230]\352w"
+	.ascii	"L\234Pv\262\f\351.\331ZN\270\304\306\276d\341\364\273#`\377\213"
+	.ascii	"\b\026\312`,\226\036\313\272\312\347F\233\233W\\7\030\026?rd"
+	.ascii	"rm8e*\034\266P\025\\Ew,s\006\211\3103%\317\034\247\337M\251_"
+	.ascii	"\025\274\215\256\n\336S\271\257/\224\277\366\216\005fj\337\270"
+	.ascii	"\002\363&\302\215L\234\331\233\027\224\275\276\326d\2020?\300"
+	.ascii	"zt\300%}\270uu\235\210\322\3245\0355*1P\276P\206\262k\322dY\037"
+	.ascii	"\367G\230*\270\270n+\026>H\276\264\324x\341\372B\231k\323\322"
+	.ascii	"\244\263\217$\262\270\226V,D\034\241cE\n\03279;\201\262\023\336"
+	.ascii	"R\235]\265k\215\246+\256\255\254\210\322&s?4\355\234\267\376"
+	.ascii	"\027\021\034\316OwXw\247\330\235\351\332B\343\364i\020\365\347"
+	.ascii	"\237\327\310ew\373\3309{9\365\303\333\335\212X\335\"\360?\355"
+	.ascii	"\246\321}|\266\325Q\243\254!\207p\332\002t7SH\331\310\343\b\345"
+	.ascii	"\263\311T\006C\250\021@\341\223\223\317\b\300\3220hLW\343\220"
+	.ascii	"\370\333\245o\372\r}\305\032\303\340J\034\376\024}M\277T\311"
+	.ascii	")h\034\002\026}\302\037Pi\350\311\211(\364\246\"\243P\350\373"
+	.ascii	"5\255>'#\343\032\254a\0045dj\021\0055\f\n[\300@JB\212\021e\004"
+	.ascii	"T\202\022\376\206A\243\242\021\312\310h\311\007\024\246+\020"
+	.ascii	"\213M+q\330[2\022\177i\2117\025y@\243\203\021\214V S\321\267"
+	.ascii	"\016\255I/ PU\370\021\2053\200E\342\f'\340j\224\032!\250\250"
+	.ascii	"\324[\223\214@!\323\360\202\"P\b\225\201\t\240\022\324\032\\"
+	.ascii	"W\237\272{S\221\221\2220\bU\003\305\232\024c\035\006\241z@%\342"
+	.ascii	"\007LP5\200J=E%uUJ\022\022wC(\240\247\245\244\242\322\256\250"
+	.ascii	"\344\363\337\n4\002\213IB\377\005\213\300!\220I=\f\244\026H1"
+	.ascii	"\242z\217!\303\205\f\027\274\307\220qt$\003\351H=\322\221T\221"
+	.ascii	"\270\376"
+	.string	"\200)\370\212+\001\353\020\350\304\0044\366\242|,\345\343\025|E(\247\340\t\241\220XL\233~k\360i\267\202OJg\004B\t}6xk\022\322\321:\f\366\336TT\004\256\302\340\322j\f"
+	.ascii	"\350\024\\\323\250\225Z\0266\312\006K\331`\026lp\320\370\244"
+	.ascii	"{S\321\320'|B\340i\251Dq\330\213\222\342\255B_\320\370\224\004"
+	.ascii	"\\}Lj\324Nj\267\002\215+\320\230\244\004"
+	.string	"\004>\031{\336d\300\211O\300\242\321J$\026\215B\254?\250\342jL\002\376|E\340\220XT:q\t$\2301D\002\b\033\250\277\"!\261\270\016\211\277$!\321hmb\n\n\227\214\206A\237\223\321\257h4**`\tX\f6=\365|+\260i\355\t\032\237zJN\277\244U\350\353\335Y\247\315\023%G7\237\263\250\0347\272\226\013\322\262\232;\213>W\304\335P\226G\fM\017<\246\202\340\255\263 I\2628\235\233+S\005\367\245\025-rF\354\316\035\226\013\323\275\231c\345&\356,\007\207\303\236i\250\224\2709\333q\303n\273.H\322X\031\303)\327a9L\207\3470\034~\3438\373\264z\323\323b;\263ac\267\023\272q,[yE\344\223\345\f\330\222\333\234\335\326\026\352f\206\013\247\267\363\265\315A-\201y\250\261De\0203#\"#\"\"I\222\244\003!\005\304 \b\251\254\016\021"
+	.string	"\245\243H\325\310H\222\222T\246\003\241\366\016\250\335M\305\262\331\302\b'\224gG\226s\373\3705\312\246\310\235\324\301ST\323^&eL\322\244M\020X L\207_\332\025^o\210mE\b\313Ru\002%\021Z\025"
+	.string	"\365I22\276\261\224{\220X\341\026\271\320P\244\220,U\005\2234\020 M\037;A\267y\006 e\261\203\244\372\002\335\277\245\253\221q\021\374_w\376\210y\220\002\337\026 \320\032\365\226I\262\r9V\225\301(\305\253#Y\201\232\204+l\203\020\200\273\b\264&)z\312\023\225`\r\244B\355\273\241\365\220o\371\216\313\347\271\037\300\302?Y\274\220\236\371\334\265\367W>\226\362\346\220\253\244*\016^B\260\333\237 }\304\304\022\210+\224\332}v\nE\233\005\327&\255\374,p\311s\274\326\2175\370\257~N\247o\344\355@\202\240mQ\266\364\031%\025\3323n$t\312\244\306A\374\025\356p\330\353\030\245c"
+	.ascii	"\203=\364\211S0\212\235\244\347\374\206\f\275\311Y/\300F\235"
+	.ascii	"P1i\352\335\357\036UH\225\222\013\032\345\365\240\217`\212"
+	.string	"{\203VBG6\251\034\017\003\\0*\303\245\271e=\017'7\027\265\316&=)\221\2648QS\352e\207\030\025\306\3223`\357\274\227<Ie\325TVj\300V\025\3540w\332\250TBV\252\356\023J\257\254\237C\304T{<\341\324\245\345\267No}v&P\354\367\251\303\230\264=')\204\310&\313\022\025\337\362\202\257\027\204\017\233\374\036\354\017\207\245i\262=\243\207\300\230\n\244I\207h\230\201\201J8GEQ\3313L\300\016\013N!(\353.O\360\303\305\220\242=aPk\007r%\3234\205\231\321\221\231+L9l\232!E+\032\035b\274\303\374B\177\265+\340\260\025\352\032\367\260\305D4L\354\371\306F\270\301\246\237\333}\323\323+\364\231g\352JF\262\360\2777\b\304\"\212r\257\314\002zuR?\017d\346\361\331\252d\365\242u\323\240\377\377\331\177\342\001>N\343\334\276\316!\273\217"
+	.string	"\240\"QS2\f\236\266'\344\360\340\020\312\257G\253\021\271\275\227\272\343+\355\034\3132Mlox|\034)\312%\201\032\361[\250\320\360\001\215\225\336\306;\327k\024\317\026`\216\235\b?\345\221\300\253\337?\035\243\246\240\\q\035'\242d.\222\256\3061B\005\370\214Z\263\024.iq\363_\007\211i"
+	.string	"\203\317\340=\2505\\\354S\0323"
+	.ascii	"7\325\177t4p\006\356\325\251\213\263\207\003\034\375\356\025"
+	.ascii	"z\361z\213\370\344},\206\007\362\375j\271\221\336\355\313\211"
+	.ascii	"_O\"S\007LX>\212\277\300n\304{\341)\361i\335\232\365\032\243"
+	.ascii	"U\364\320u\025"
+	.text
+	.section	.gnu.lto_.symtab.ed44c25d3220e500,"e",@progbits
+	.string	"ol_control_reset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\001"
+	.string	""
+	.string	"dr_control"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\024"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\001"
+	.string	""
+	.string	"ol_control_run"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\001"
+	.string	""
+	.string	"dr_fp"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\001"
+	.string	""
+	.string	"ol_dt"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\001"
+	.string	""
+	.string	"dr_state"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\001"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\001"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\001"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\001"
+	.string	""
+	.string	"dr_traj"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\001"
+	.string	""
+	.string	"ol_trajectory_reset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\001"
+	.string	""
+	.string	"ol_flightplan_reset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\001"
+	.string	""
+	.string	"cosf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\001"
+	.string	""
+	.string	"sinf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\001"
+	.string	""
+	.string	"ol_trajectory_sample"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\001"
+	.string	""
+	.string	"ol_flightplan_run"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.ed44c25d3220e500,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,486 @@
+	.file	"ol_ekf.c"
+	.section	.gnu.lto_.profile.da4622c93a9d1c4c,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.da4622c93a9d1c4c,"e",@progbits
+	.string	"(\265/\375`N"
+	.string	"\005\004"
+	.string	"\324\004B\001"
+	.string	"\006"
+	.string	"\364\342\203\370\006\n\002"
+	.string	"\002\001\002\001\212\242\345\r\002\274\304\214\340\013\020\003\202\362\203\354\nL\002\003\002\003\002"
+	.string	"\002\004"
+	.string	"\005\002"
+	.string	"\002\005\001\001\004\002\004\004\214\215\224\376\005\002\005\203\374\372\213\017$\005\005\002\005\002\005\002\005"
+	.string	"\027"
+	.string	"S\021"
+	.string	"\345"
+	.string	"\t@"
+	.string	"t\200[\001u\244\t\032C\320\036\340"
+	.ascii	"\001@v\001\246`\215\027\004`\340\346u\255t\005\352\372\251)\030"
+	.ascii	"bWR\001\206"
+	.text
+	.section	.gnu.lto_.ipa_sra.da4622c93a9d1c4c,"e",@progbits
+	.string	"(\265/\375 a-\001"
+	.string	"\200U"
+	.string	"\005"
+	.string	"\003"
+	.string	"\001\002\003\002\001\004\004\003\005"
+	.string	"\b"
+	.string	"6=\346Hp!#&\2016\205\345\230"
+	.string	"\221\300"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.da4622c93a9d1c4c,"e",@progbits
+	.string	"(\265/\375`\303"
+	.string	"\305\b"
+	.string	"B\017450\217\222\016\260rR\025\252\224V\223\353\327#\247(I[\222\240u\341\341\016\370\374X%\325:f\315\fVKA!#\006\006\344\251>\2129\357\304\032\332[\266\024\377\343\330\271\006U\211\3075b\270\0319e\370\200 \351\330\235\353X\215\204\340m\320\255\274\25064Y),L&F\370e5\2314J\203\034`\276y\372p\201J]\267MC\270q\232r\212h\351\233=\305p\250@\301\261?E\322\365\240fZ\255\223\325:B\3755hU8\314\227\320\324)\243\204\215x;\315k\237\235\212\013f\262[e\246\265\2409$\005\210*\222\231\005W\255\255Ot'\231$\202k\375\367\003`\357\247\231\231\327\207*\221\231\003\375\013\035Kf\n<f\213#\034"
+	.string	"\2776\247\261\207\321G\253(\204\344k\307\034V\214\255\352\013\367T\023v\026Fb\t\306f\232\300l\037a\200\227*\020"
+	.ascii	"w\375`\345\306\260\303\226e\235\206\"0-\206f\204\333\222\n\326"
+	.ascii	"\213\2400\305\236\006\206"
+	.text
+	.section	.gnu.lto_.jmpfuncs.da4622c93a9d1c4c,"e",@progbits
+	.string	"(\265/\375 \331\305\003"
+	.string	"\342\205\023\036\240'\351\377c\277\241,c"
+	.string	""
+	.string	"\"\236\314\266\371\036"
+	.string	"O\304\203\217\203\335b\223\275e\222\0014\327s\343\277\352z\250\004|\311\216c\305'\276\002b \227\227\311\260\222\201{N\354\023\353$\264\224\272\224I\036\020\004\005d\3273\370\211\206\213\020"
+	.ascii	"7\023\371\263\004\030\302\260\fQ\230\373z1 $\b\262\200\034B0"
+	.ascii	"\224\312X\315\216\273%\262S<\335@\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.da4622c93a9d1c4c,"e",@progbits
+	.string	"(\265/\375 \024\241"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"\230\004\002\230\004\003\232\004\004\204\004\005\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.da4622c93a9d1c4c,"e",@progbits
+	.string	"(\265/\375 \327\235\003"
+	.string	"\362\004\020\032\300%\035?\360]f\365\372\377\337\371\355\337\346\246\227\003\304zB\b\331D\312\024\023\2051\234'k\373\247\345\016S\273\373\005TuEx\316S/\250y\"\304\224\355x\262N\325\276\312\317\350O\002\025"
+	.string	"U\310A\231\234\306\\\200\275M0\274\213\302\005@8=\344\220\033\252G\300\302\f"
+	.ascii	"\276+\031\0235g\027\372f(\b\354Os\301h\003\200\003"
+	.text
+	.section	.gnu.lto_.lto.da4622c93a9d1c4c,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_dr_ekf.0.da4622c93a9d1c4c,"e",@progbits
+	.string	"(\265/\375 H\325\001"
+	.string	"\264\002;"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\202\200\200\204\370\377\377?"
+	.string	""
+	.string	"\200\240\263\346\314\001\317\002\001\317"
+	.string	"?\202\210\200\020\177}\274\001{\273\001"
+	.string	"\005"
+	.string	"\270"
+	.string	"9\363\345I\005\bj"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_ol_ekf_reset.1.da4622c93a9d1c4c,"e",@progbits
+	.string	"(\265/\375`\t\003\365\023"
+	.string	"Fc|I\300\322Q:P!b\200\031F\007\0166#l`\237`\036\252V\n\200\177O\026\001\024b\310$\334&\313 m\365\b\267\200\357\341\264\354\366\340\017\246(\212\242\020\230\205\n\241\023\002\265(Tx\300T\261\325\353\266\221M\344N)c"
+	.string	"a"
+	.string	"j"
+	.ascii	"\366\177\276\342v \033\031\300\356\222\317\321\356\226\230D\365"
+	.ascii	"\251\340\004\302O\360\002\302O\337\354\036\006fX\":\364\242v"
+	.ascii	"WT\023\326\203\274\033\224\267OP\345\315\027\272\004\301B\267"
+	.ascii	"\303}\202#\273+\262\233\001\031\324\354d$\310cs=\321%\317O\267"
+	.ascii	"\263\271LA\330]K\335\356\303\035\336v\3156\212\255\022\002:\273"
+	.ascii	"{\342\342E\027|\024\237\266\301\310\353`\302O\033C\006y\235Y"
+	.ascii	">>\032\305\331<\234\324\034\373_\305\261]\347\375\255\003\375"
+	.ascii	"\253\007\375\251\367n)\245?\222\242\t\320\264\353\3417d}\023"
+	.ascii	")\305{\267?\344\023\365\234\004n\013\224\236\022?v\367\365\351"
+	.ascii	"\b\252\317\257\354 \037\017xK\rT\237\276\f\252E\362u\2515\266"
+	.ascii	"w\204\2368H!\007\301\005\227\352\322\t\365ki\215\r\247\3014#"
+	.ascii	"\301\t\227\\\352u\346\224hH\310\310\237W\272d\243\002:\2665\\"
+	.ascii	"i\024q\332]\007\2372f-\247\244\023]\376\330\004\031\221\223?"
+	.ascii	"\325\335\305\251W\362CH)\262\307\230\035\251XI\0047S\370\372"
+	.ascii	"\207\016cE\265\233\273\316n\371\213q@\264\327b10[\214FA\305\""
+	.ascii	"\213I\325b10\333\350\222r\212\211\312\212\f\3062\212/\025f4\026"
+	.ascii	"\025\321\002-\326\"\246\324l\242\311\001\217.\262\232\3702\216"
+	.ascii	"5q\305\333\177\025\307 \224/\2472\376\216\333\023\376\304\343"
+	.ascii	"u\023\345\307B\033v\0351\326I\016\222\233\036 )\305a#\327\233"
+	.ascii	"~cl\331\230\261|\341\235\024~\356\204\360\231\232\343)D]\001"
+	.ascii	"A\250AH\345\2342$\022\210D$\263\245m\300\002\021\033\353\006"
+	.ascii	"\020PU3\032\245\0034\2529\324l~i\332\273\007qu.\227p#\001\243"
+	.ascii	"*Z[G\374\013\304C\246\\\031%\255\326\242\202h\210\016[\342\341"
+	.ascii	"\255\031e0oA\230\221\255\344E\027/\240\002z\264\224 Nh,\2460"
+	.ascii	"\325\332\261~\210\346\222\341Hj=\231\376\315\206\335\342\333"
+	.ascii	"se\262Pvuz\304W\222n\350P\276\322\351\231\005\211\253\316\356"
+	.ascii	"\371\275]\035\n\251"
+	.text
+	.section	.gnu.lto_ol_ekf_reset_axis.2.da4622c93a9d1c4c,"e",@progbits
+	.string	"(\265/\375`\252\003E\025"
+	.string	"&\343\177J\300\322Q:PrZW\200\210DN\276%\354\024\037\375\371f\240c<\005\360Hn\004\037\323 \356{\351\316\213\254\251\205\003Nj\325\357\0228\016\253C\026EQ\024p\022\212l\027L\007P\036\202E\262\242\335l\366\333&{\247\024c"
+	.string	"e"
+	.string	"r"
+	.string	"\366\211^\244\273\221\203\006\260\353\201hiwW\234\300\365Z\340(\254W\361&\254W\353l)\0018\257\023\031~\303\335\035)\220[\027\311[\234\272W\221N\235\377\373\344"
+	.ascii	"\354\371n^E\327\356\222\370p\304\026\035\037o\212B;\247O\372"
+	.ascii	"$Q\366|;\237-\006\273\353\331\363m\270Y\267}\263\355\300\246"
+	.ascii	"Q\001\254\327\224\016\303\341n^y\345\224\212\224\276\230\312"
+	.ascii	"\351\341\315+\233\274\231\364\207\244>v\311\217~\221\223\277"
+	.ascii	"\353H\267x\243\237\036x?\300H\216\t\324\256\206\253!\373T\231"
+	.ascii	"F\034\370#\331O\341'\001\035\034R\321\300\365\372\377<b\033\311"
+	.ascii	"\202\270I\017L\024\371\330]\225W/\360\221\024\313$]6\2251\327"
+	.ascii	"\253?\003\364 P\354\3000\255.\356\356\212\n~ZBkU\231\323\303"
+	.ascii	"\313\021%\204\322\201\343\206\215'\b\037\206\356\364\032.Q\202"
+	.ascii	"h\330H\2043h0\0313H\217\252\311%\002_x\f\333\201\240\231\303"
+	.ascii	"\240\021\b\n:\375\f)%woh\356L.\226R|\206\206\273\322\3664`\273"
+	.ascii	"\302[\270\204\265\330\265\263\260\275\204\273\313\242\364\025"
+	.ascii	"8?\304\253)\330\314\367l\0022\237\311rt&\313\265n/9\027\\\215"
+	.ascii	"\246\205\253\321P\303\304bfd.\263\332X#!\202\314,f\234 \363B"
+	.ascii	"\033an\27016\3005\032\331m\254\251\325n\343\b\2717I}\\\205\236"
+	.ascii	"v\224g\021Z\345\362\004\210\rFE{\375\210\001\t\341q\321)\227"
+	.ascii	"'R6\230\260\007\355%\344\361\337\247\b\240\022<\273J\177\\\255"
+	.ascii	"h\t\245JS\345\247:\016\262\036Q\250aH#\245\232\t&\222\t3)I\033"
+	.ascii	"\300\002\021\232\262m\021`%3\210\230\232s\330\f8R#\034\002\371"
+	.ascii	"\377\224\020\257\333\343\347\363k\2144\262\021\223#3a4R\330\203"
+	.ascii	"\030:yn%\243\350V\275\265\200\325+\211\236\227\245gI2?\2724\344"
+	.ascii	"!\241\301\222BRjP\223b!X\024<\304\301CR\325\034\354\220p\371"
+	.ascii	"\310\0228\343qA\017\253vNr\323\351_kL\023\025\271\n\230\263\217"
+	.ascii	"1\021C\215(k\331r\247\203V\240\257\214m\b\221\262K\007\366\013"
+	.ascii	"\230^%\210P\025\226\267B~\274;H\246\002"
+	.text
+	.section	.gnu.lto_ol_ekf_predict.3.da4622c93a9d1c4c,"e",@progbits
+	.string	"(\265/\375`2\021\035F"
+	.ascii	":w\344\03070\352\311p\310\330O\360\370a\272\207\312h\256T\222"
+	.ascii	"T.d\234\206\007\321\314\215{\330{\f6@ \3636df\tMtD\324_\177\375"
+	.ascii	"\365O\263\204l\262w\222R\006\201\001Y\001\212\001Z\335\233\325"
+	.ascii	"\275X\335{U\354\265B{\221hoU\332K\325\275\307b\257\021\355M\321"
+	.ascii	"\336b\367\242\335{v\357\273\267\273\227\215\\\260\362\265\252"
+	.ascii	"*\224DSj#\2640\r\343a\326\303<\310\374\207\317]\346<\274\207"
+	.ascii	"\3710\341V-\367a?t\374g\310\251\016\236\201\227,4B2Wqp\r\333"
+	.ascii	"\204Zw%\020\005=kx\252\203\"\330`\222\200\207\2101I\224/\273"
+	.ascii	"Gp6\251\252\232dt!\354\266 \327\241c;\273\356QU\017\035\006R"
+	.ascii	"U\325l\317\214\214\0168\271wy\016\323\241\343\300#\254\245\252"
+	.ascii	"|}\002\251\252\240\331602\272\202\354Ud\324\310\\EF\351v3\205"
+	.ascii	"1AR\262\3133JUU\264\213)\246i\212\374\317\225\246i\326\377\253"
+	.ascii	"4M\251\214{>\005y\317#\035wqmieay\201]Y!\253\276\250\216ac\306"
+	.ascii	"\264\210\212\235o\272\345,\353]^\022\3562\323\327\\ex\353\200"
+	.ascii	"~^\244\224a-2[:k\fc\215a\257,\fv&M_5\331J\013\226Ff\341\252&"
+	.ascii	"\177\235F4g\332^S\245\036\302Ha\362\261\231\034f\264\302cp\b"
+	.ascii	"\374E\211\323F\002a\244\350qz\032UU\275\312\263;\323\230t\221"
+	.ascii	"\312\317\n\243\\\247\307bg\226\243(\200\347\003\274<%}\372Q\341"
+	.ascii	"3!\267\233\304\273<*\334\251\007UU\267\357\362\244\360\222\361"
+	.ascii	"n\273\355n\332.V\223\354\342ToP\313\246#\037\307+W<f\372\345"
+	.ascii	"FqXcT\265\216\357v\333\230\221\322A\233\n\207\274\350m\331\f"
+	.ascii	"\243p\347%\033%\274\211\212\305\247\347\345\237\213\027\257"
+	.string	"\\\355N\325u\342Wp\321#\352\363?z\024q\251F\211!>\264+\017\270\346\273\005\364\242!\036\323\320\370\243\035\241\360\354\237\207\374\335\205\300\204\273n\032#\336u\342\025\311\034\"F3\313G\212\214\362S7\223\360\230u\235\270+\230\244\017f\227\275\372\f\313\354\371v\213\f\0212'\367#\016\216\361\360\272\261\035\3466\016d\276!\203-\006\353\341\205\261\366\202\007y\325x\220\327E\367\266\350^\026\335\273\242{Uto\212\356E\321\275'\272\327D\367\2260\366\222@{G\240\275\"\2727D\367\202\350\336\017i\257\207\356\355\320\275\034\272wC\367j\350\336\f\306^\fh\357\005\2647\255{-to\205\356\245\320\275\023\272WB\367F\350^\b\306\336\007h/\032\332{\326\275f\335\353\240{\223io\203\356e`\354]\200\366*@{\023t/\202\356=\320\275\006\272\267@\367\022\350\336\001\335+\300\330\033"
+	.string	"\355\005\200\366\226\245\275d\335;f\354\025C{\303\320^\260\356\375\352^\257\356\355\352^\256\356\335\352\336\016\350\372:\312\256\002\002$/\240R\341\2137\370i\210\250\237\354jE\207F\211d\360\373\255\244\024|\333I\343\365\335\202\004W\300\366\004\177\260\227X\365u\234\373\231aI\216q\274E\344\030\334g\330W\210*\306\347\316\246\247i\331D\360&v\007^\340\b\316\230\226j\f\374"
+	.string	"\223]\313ZI/Q\202\3751\360\262J\205u\204:\311\256\310\304V\225g5\005\376\274=\244\n\271J\237a\231c\330\371\226\307R!?S,\311jjF\265\0139\372FT\247\007\263(\"t\310\037g,\3110\216\267\206E\030g/g\021\306\207|\206\336\036\00275\340c'\360>\024\360\001?\341\362\257\324\256\b@(\003\b\370\321\017\300\227G\211\n\025"
+	.ascii	"\023\227\035\300\037\211\354ej'\373\021\227\315B\374iW,J\252"
+	.ascii	"\252\246-{R\241D\216\211+2:\366s\312\003X\030\366eN6\274(\335"
+	.ascii	"\340M8.\264\201\243I\254\f\354aj\007\373\003=C\027T\325$\350"
+	.ascii	"\301,\213\235o\3218/"
+	.string	"\3623;\311.\216gv\307\322\222.\305\206}\206eN\007\354\342E\216\272I\374\312\341\365\254\177y=\035\204\307\354\372\307\360]'\256\037\337u\006\265ln\235\353(\242\326\257\276\365\037.\233+\357\251\252u\006\262\256\325v\254g\035%D\262\210\t\227\244a=A\245\302\272\034WG\337 \277,)\022$+N\304UG\276\017\227\177T\257:\333\2352\0137\370\215w0\020\236\313\3218p\334\370\3428s\343\321f\243G\034\332\234\016\345[\01774\037o7\340\320p\310\005A;#\333\270\037mrhsqqrhU\202*\237oKLiTw%;\344TU/\035\370\017\363&;\235\270-\216\347\016\213\247x\213\363\341\262\271\342,^\214\244\342*\276\342g\036\032]G\360mU\374\213L`]\340\256\247\243\354\024\007\002\t\260\260k\013\356gj%ym\215k\355pg\303\262.\233(.\347\304Q"
+	.ascii	"\23683\332+4\3617%\016\342&\332 \351T\342\027\264\210\324\210"
+	.ascii	"o\257\371\363#!\342#<\\\304\221X4\331\235\n\3614 \376\341!\336"
+	.ascii	"\2304\034\304O\302Sm\346\303\217\205k\367p\262G\313f\207\367"
+	.ascii	"\355zu\307\341\031\336\341\215\251Cb\342\251%\033\316a\303OD"
+	.ascii	"\267\267]\303\337\241\026\263\353\325]\206_\320!\251\013\337"
+	.ascii	"\006\303\367\005C\332/\254=\355H,\214\266\332n\341ng\304\n\267"
+	.ascii	"\360\"\342\362\217\302)\274\302\317H5"
+	.string	"\272\313\256F.oK\341i\236\"\300@\2558Xq?\323+\3112dd\311x\334\331\230\206\226\315\toJ8\204O\210p\tX:\313\256e`\305\b\255\327{\273\"\233\312\243\214B\370\363\n\001\242}\333J\025*\017\316\216&\343gG2'\331\235\302\362\002\263\372\3613\277\222\374\342\305\325\213\3778\333\036#\253*\271?\016X\222\331\330\220l\227\373\214\275K\331\325\312\301\031\334,\371\201_\250q@\344\020c\210h\244$I\241\320\034\301\005\204\030\306 [\017\021\260$\251\240BD2\322\024\244P\030\326\2428\004\004H\035\207\330!\301\221'\034 \367+'U\305W'/\003\275\276\013H\313C5\354`\272#,\346\270!\223\277\237La\020\200\265\0218\345\232\255\016\030p\036$\235\026\2751\313\260K\232\302\365x\006\221)\313B1\01681\356\376&\266\202^5\246\305X\225\021~\323yUa-\225"
+	.string	"\215\2244\341pq\356\276|'S\367\377\007F\230\003F\001\300Dg\237ed3\346\025\256ziN\016}\206\356$\032\324\021\312w\036\336R\260a\250P\304\362\372\033\276\004\316\025-aEA\3740\254u|\342\366P\213`\200,\3635<\352\336\315\322)1\242\274n\"\217\271\255e\030\253#\364H\202\234[}\023\312\230\334y\326+\370|\367v*W\245\210\2452/v\222u[d\216\\\204\234\273\341A\265n3x\324\231\265\244\304\276/!\275\356\3445\225O\316\323\314\3179!P\336\351<aa\214}"
+	.ascii	"\342\006J\020\224\220:-\024\320\361\251\332-8\347\325#\311:V"
+	.ascii	"-`<\332\242\226\032r\017G!s\335\306\016\375\034r3\177\243\345"
+	.ascii	"\376Q\232dB\2417\260'4Nn~\316%\305CXxX\0264k\374\205\\3\227\221"
+	.ascii	"\3021~\001\230S\301\030\322\007:\233\005&\232\030=\307\220\017"
+	.ascii	"\206\362\177\351y"
+	.string	"\333\354\317\346;SW\311\260\257\315\273\034,$Vu\255\017\271\315x\347\325\372Z\004I\032\260]\027\347:\017\374\311\230\211\352\235\020\300\315-\342\227\016G\312\246\013\371\355\312\001(\303\006\2470\346\217\313h\237em\347\233\207-\372}g\217\354\344\240\237\373n0\211$\035E\367\216\036\f\341.\373U\203\216\t}\257\340\222\221\204w\210\371r\354\276\021\314\025\274u\003\n\020M\033\210\006\007"
+	.string	"5\377\240\222\226\002\237=\300\242/\\j\023xA-"
+	.ascii	"R\200\204\f\263\022\252\235\316\f\257\005\037\256\\\025\232~"
+	.ascii	"\223\032\030PV\2018\323$\300\225\245\245:w\002+\303*+CTv\206"
+	.ascii	"Tv\002\251\355\004\255\346*\224\0045\203\366E\375`\274\323+\305"
+	.ascii	")\027Hm\022*\237\2109@A\274\353\234\004W1\324\375\005C\247\240"
+	.ascii	"\241\201\025\032\2408\302\006\336\336:\333\032Jx\003\366\372"
+	.ascii	"?\274\212\322\331\224?"
+	.text
+	.section	.gnu.lto_ol_ekf_gate.4.da4622c93a9d1c4c,"e",@progbits
+	.string	"(\265/\375`\016\002m\022"
+	.string	"6\243{H\320\362&\035\252\200\340dAn7fS\341a\266\344}\370\306l\304\r\242\276\n\006\330AU\235Q\030\303f\213\341\030\033\206q\317\366g#\250\360\001\264x\250`h\037Jy\023YnVU\333\022\231nM\255m\"eJ\001g"
+	.string	"_"
+	.string	"l"
+	.string	"^\355\232H\261\264\273\r\274\340{,\271\200\324\243\367"
+	.string	"\251G\333~"
+	.string	"a\3064\317\001\351\274g\207s\344c7\007\352\211\323<\025=M\032\377\272{K;4n\270\232\247>\022\217%\273\353\215\340nZ\270\017\251\236\001\036\033#Fp6\317\004G\017\324u\317\034\\-SUaw\2357\234\210[u\3331\333\030\354\314\020\276\206a\030Z}l\247E\236\373[7\372YG\272W'\372\277\017\375\252LGM{\232VM\247\246\017@\305\002\007\211nW'\f\262O\221i\305\221~{\306\327\271e\033\311\303W\023b"
+	.ascii	"N\216\246\036\273{\362\350\013\237QH\201\bj\202\346\274\253\221"
+	.ascii	"\344\340{t\246\375\026\027\232\371\220g\004\352i\201#\226\262"
+	.ascii	"T\225\200\222-\250\245-M\215:lA\265\f\275\007\355\334\204<\226"
+	.ascii	"Zp\272\311\250\247\212\033\317\223\356\022\254T\001\b\036E7n"
+	.ascii	"2\312\237^Wz!6\236Z\206V\362\316\004\310\366\313c\260\220Hp9"
+	.ascii	"\f\031\202\035\273\033\341\305\223:\370(\036\r\023\223\277=\372"
+	.ascii	"1\251\307\353\252\004\324\017&\233\f\355\\M\352\217\003\032\376"
+	.ascii	"\242\271V\274\231KFc2\030\315%#\213\305`\254\027\315E\203\211"
+	.ascii	"NAQaymh\221\2014\016+\260\026\0250\006s\271\200)3\030\020\345"
+	.ascii	"\200e/\257\031H\223\311f`+\267\367V}\234y\362\364N\236\221\301"
+	.ascii	"\243\346\330\026\321\022\033\2559\252\210\346\021\316\020\233"
+	.ascii	"\f?ow7\245?\376/\003H\223\213\250>\372\250\"\247\225j( \240\002"
+	.ascii	"\231\243\352\006\317\b\215+\211\262\336\302\370X\026\212\007"
+	.ascii	"'\304\320t\342P\034\224\201\360r\r\270P\272\327\203\327\b\345"
+	.ascii	"\301\021\203!~\016T\223\360\227mL\216\202\374\207,aX\032)\237"
+	.ascii	"\201!ew\"k\0055&\240\0248\007\303\245\007N\316\027N\215J\273"
+	.ascii	"\275mT\005\003\005"
+	.text
+	.section	.gnu.lto_ol_ekf_update.5.da4622c93a9d1c4c,"e",@progbits
+	.string	"(\265/\375`\224\n\0356"
+	.ascii	"\272^x\024D`^N:w\313d\306\242\006\306\241\372\241Q\347\263\230"
+	.ascii	"/\3603\224\027\r\007.\026\327j\034\326\245\3756`\263\b\203+\356"
+	.ascii	"8\273\270\rN\320-\342\314c\340\227\366\300\340rP\351m\254\355"
+	.ascii	"\337\2104B\344N2=\001\022\001=\001B\272,\002]\306{\315\356H\031"
+	.ascii	"\261>\345\207\271\234\326\347\262V.\261(\263=\020\353\323\263"
+	.ascii	"Qz\0210\216\237\366\303M\022\241\373\340\205\237+\227\330\372"
+	.ascii	"\346\326\027\365\226c\345\022;\362z\363\007\317\275\227\301S"
+	.ascii	"\366\260ra'j\274`\312\036\032\266\334\271\320Mv\226\t\363`}\312"
+	.ascii	"\3262\277\355X\264\236\205\237\034\274\227I\024\272{o\003vZ\237"
+	.ascii	"\022\370\021\370\024}\021\360)\004\tZ\274\365fZ\330\315\350x"
+	.ascii	"u\351\273\267\211l'D!V\2176\317Bt\353C\306\"\241\"qH$\f\n\032"
+	.ascii	"\255*0E\333n\361\271>\204\262=\001\324\346\207\t\231\332\215"
+	.ascii	"J^\224\006\305\n-y\221\231\304\022\325\rM\310\224|\270\344D\350"
+	.ascii	"\352F\354\t\nu\304\n\0134!C\362 uC\335\r\260u1\313\213\033\013"
+	.ascii	"\362 \222\033\241Nlbk\350\261\356\005\334\210\031\261+\201{\357"
+	.ascii	"\325\342\230\327\357^\200M\254\210\005\026y\212\n`\242)+\216"
+	.ascii	"\361@\021\2641\253\363\273\245E\237T{\243H10Q\212c]\250q\217"
+	.ascii	"J\335\353n\301\306\224\326\252\033\356\275l\277\306\310\316\307"
+	.ascii	"3\337\t3\223`\016\222\005G3u\324\2737\371/\346\026?C\245\216"
+	.ascii	"\361\351\273\367N0s\274\027\374\265\247\\%\303\376\353)_\006"
+	.ascii	"\360i\367\227T\224\316g\200o\333_\262)\355\037\037\350\367\353"
+	.ascii	"\216@\213\2372\017.P\322\37617\225\266\321\230O\224\207\207\b"
+	.ascii	"\367\031_h\313\026\332r\205\266\f\365\347\231B\004\344S[v:\227"
+	.ascii	"\177\301\233\177\323\337\316\n\276\345O\360,\377\001\266<\340"
+	.ascii	"^\316LK\217;+\005-'\005-\013X-\007P-#\251\226\001\264\345\243"
+	.ascii	"\266|l\313Fm\271\250-\023\255\226\207T\313F\325\262P[.\266eb"
+	.ascii	"[\036\266ea[\016Z-\007U\313\253jY\rZ\006\006-\247m\031]-\267"
+	.ascii	"j\331\252\226\217\341\310\206\231\304\254N\3475o\330\037\240"
+	.ascii	"\313&\265\213\362\347\377\366{\371\343\376\271\237\356@\346\363"
+	.ascii	"\307\374\311\277c\241\030-\276\272\035#\205\001b\266\335{\205"
+	.ascii	"W|1,\274\372[\016\002]\315\273\226A\211\227\266\2763k\361\341"
+	.ascii	"\376\345`\356|\035\007Vn\311lja\023\273\345\226l\034\365?\354"
+	.ascii	",\262\212\373\311\"\352\365\r\273\355\302\370\261\023\326\261"
+	.ascii	"\263\277\370\024tP\013\373\204\032\334\022/\250\2319\352Nv\016"
+	.ascii	"\343|\361%\367\260\363\2306#KH/\250\235\312\332\230X\326\346"
+	.ascii	"\363\345\241\252\020F\205\331\206'x2W{\355/\331Z\355\346\203"
+	.ascii	"skn\336{\203\200}G\212\250g\347_|\311K\001\323\006\266\215\303"
+	.ascii	"\342s\244V9i#);cb\311\222\304\333\353\023l4\262\263/F}\306\026"
+	.ascii	"\370t\253>\375w\007\241\304\363r\246`\f~\341R\376\332\350y3\247"
+	.ascii	"\313\376Y\033\215-4T\377\217[\205\246\320\026:@\227\005\275\240"
+	.ascii	"+4\222\\S75T\247qP9\3145uAwX\207\b\361\0026\032\377+\330\234"
+	.ascii	"3\3553\n\335\004\204\216\233\032\247N\320\024\342\260\023A\332"
+	.ascii	"\023N\326\323?\271\305\337P)\351\271q\352\337\335\306\001\201"
+	.ascii	"\303\304bG\264S\326D\033\355\301'"
+	.string	"\230\271v2\2635\240\240\201a{ni\272\354\037N\320h+\350\373-\231J\373\267U\345k\330\271\244w\357\205\342\253\321\221u\224\266f\325\352\024?+v\2669!\216\365\241DW=\306M\234\nk\352\005zc\nG\327\260\252\302\232\302aU\243FU\020\025\326\024\326U\312-\034\270\220A%5\303\n\211\005\343E\325\f\027\310\032US4\220-n\\!\035$\261\225\r\252\033H,+\253\033Ha3\371>c Z\0248\247\361\337\002\276\356Qo\374\340\234\315\337\002\016\030\320\274!\331\312\271,\364^&\032N\367\343\3312\224\324B\244\206\266\214\316\005tR[9\024\226\314\216\t\350&#c\305XT|\352>B\304\340KKBK\375\324'\324\366l\261\3218\305\033\"\273\257\024-5S\203\361\337\231\372L\320{\357%25\262S\250\375-\231J\0176LD\363=\225yq|H\315\366\207\017\260"
+	.string	""
+	.string	"\032\211\251\001\364\203'd\274\002\035u\217c\023\365\221\024\243.\352c[\277%\233\222\303\235F\315\244\346a-\352\243\034\273$\007\313\203\235D\275\025Y\3034\242N\022rfl\266J\233\264\\CBm\\j\241~\360\304\351\325\315{\223C\242>\343\364JP\204\356#F\f\256\324`\374\004*\365\016\267\177!;\373\"|\272RG\350\023i{\305\016\344\227E\324\003D\354a\027;\200\312\250a,\305\224S\314\314\214\004\221\246 Ic\220\002\221)\252\362\021"
+	.string	"%TPM\211\224\244P\3502\210\002\tM\003\353\364+]\223h &^\274\2424\320\202\224\005\373\202\244\241\253)2B\3638\210\350\334h\003\265\027;G\260y\314A:\205\237\252\355v'}\375\373\213\252`\314\002k"
+	.string	"$2~Z\330\330\036\212$P\240\213\241\201n\251\254\002\021\\\013\255\331\245\322Y\017\336^\020(\276\277PA\325\240j\342\032\346\2428\"M\3321\310\224YC%\332\253\312-\372\311)FW\210\347\223e\372\311\016\243\200\241\247\342\356\370\347\251l\353Wq\307\260M\2577\317\306\233\263\257\025h\022\312X\233\006\331\244\225f\276\226\263\003\231Ew\306\003|\226S\220\323\336\210i\022\261\037j\341[\033\352\215\335[f\263 lr\"\346\313\262\016p\002\3525"
+	.string	"F\314\334\034\311\341&\032f\261\245\035o\037\007\204"
+	.ascii	"\213\265\006\222\231\214\341bN`+\202\277\361Dk\n\347\354fH!a"
+	.ascii	"-#%Q*\272$\216YX\230I\307\307\232\264\323A\365se\032\355D\fw"
+	.ascii	"\013\252\204\323\005P\233\246\007\237yw\357\345\353\0379\264"
+	.ascii	" ,\301\017\006,]y\nX\253Lh\214\032\324\365\277\235\370-\2369"
+	.ascii	"}J\0203\f\020v\220\376l\036\020V\261\203\276\275\202\275\006"
+	.ascii	"\374\351'>\224b\037\345\tbr\345\r\346\236\215\032\336\214\020"
+	.ascii	"\332\205\205b`\371\247\345}T\305j\240h/w}:c\322\310V\253\006"
+	.ascii	"\273\"\211P\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.da4622c93a9d1c4c,"e",@progbits
+	.string	"(\265/\375 \264}\003"
+	.string	"bE\024!\240'\351\017F\177\225~\307\256]\376>\t\177\337\332\377?\372\177C\234#\266\221\207<\bid\357\024\017\004\351\323\366\003\013\223)H\004\001@t23\033LV\342\241Px\356F[\006\357~3\020\224\321\177\2052\036\337q0k\333\005\355\376\027\001\n"
+	.ascii	"\255\"86\243`B\177\036\343\314Je\021\235\235\331\211p\235\b?"
+	.ascii	"\351T\031"
+	.text
+	.section	.gnu.lto_.refs.da4622c93a9d1c4c,"e",@progbits
+	.string	"(\265/\375 \302\275\003"
+	.string	"\002\312\030 \240)\303\001\200\335\357\265|\253\252\252\252\252:\331\334\237\265=\361\370G\217\337\266\277\271\355\226)\005\ny\237\265\361\\<\023/b=<\roaU+zi\251\231W\314\305\362\264\362\224\262:yF\236\317\373X\035+\343\251x:\317\365l\0269\022^\275\r\340\005\\\357\340\025\274\351E\357\236?\225*\t\006"
+	.ascii	"c\020F\t\3062c\203\373\202\312\242]\314'"
+	.text
+	.section	.gnu.lto_.decls.da4622c93a9d1c4c,"e",@progbits
+	.string	"(\265/\375`\241\n\315:"
+	.string	"ji\330\026EP\344Q:\243\274\346-3\256;@\251\300O\b\213\346\247\251\304\247\256J\302@\025\0230Z0\262\375+F$K{@\210\341\373\341\265\377\201\004\260\001\b\212\001\242D\341\305\330\020\0359I\272\221?\211(i{\2476\001_\001[\001m\360\032V\303o0\034<\206\251X\315\361\032\314\346\353{\f\026\206\305\030\365\272\267\276\272\272\337\343\257\037{9\246b2,F\201U\367\026\324(\016\241*0\272\356\227\211\211\211\311"
+	.ascii	"\023\023\321\024\264\254 F\353Q\313\271h\257\242=\211\366\"\332"
+	.ascii	"\263\037\223\301e\260\031\357\n\232R\232\327\343).\3734G\273"
+	.ascii	"\227\335]\240hjEK]^\261\2023M\307h~\334\005\177)\261\315\347"
+	.ascii	"\333d\335}\224\301\232\270P\362\312\206h}Q<\200\305R\254\304"
+	.ascii	":\350\320b1\f\006\217-\3410\307_\360\373\336\362mi\367{\324s"
+	.ascii	"\333\243E\226\327\377\332c\351\225\304z\303\211\332\343%\366"
+	.ascii	"\b/\261\317\255\003<\200]\261\022\213\253U<\200\375\213\007\260"
+	.ascii	"-Vb'\020\t\370s\0016\314f\245\027?\226\240\364cB\021\332\374"
+	.ascii	"g\203\033`\005n\030\004\370\361\333\177\265\377k\273\037\257"
+	.ascii	"\371\361\202\037\023\375\270\367\277\320\177@\377\367\374\017"
+	.ascii	"\363\337M\331\3777\377\355\3747\373\237\342?\333\177\026\377"
+	.ascii	"\351\374\207\373\337\366\277\372\037\316\177\024\377\t\374\247"
+	.ascii	"\376\347\325\325\325\325\375X\355\307\304\277-\021\3756\356\345"
+	.ascii	"\226\363\206\373F\233\356\033E\"\3652\212\354~\235H.Y\022\211"
+	.ascii	"]\351\226\323\225F\235I\275ldK\223J\332e\324\351\252E\235H\256"
+	.ascii	"4\351t\227[\316$\250\024'P+66*x\316]\266\017&4\331D\252\272o"
+	.ascii	"\264\341\2721\031U7!tC\243M\270$\021\\\246\254\372P\232IF\361"
+	.ascii	"\333\335\007\230J\256h/\253.\226h7\026eT35 \337j?\301U\344\022"
+	.ascii	"hcQu#\350\267\233\331\215\304]\355ndw\363\232\320\267\333\b\222"
+	.ascii	"\333\305dv?\r0\033\2124\243\352\316du\312\234\256\224+\332d\026"
+	.ascii	"F\332\325U/\022w5\334V\263\225\"\303\032\253\273\361\236\266"
+	.ascii	"\313\031D\017\027\214\355\034\217a;\230\332s{B\332U\026]7\237"
+	.ascii	"\024\212\222P\307\324\240u\3142\021\254\036U\350\300\361\274"
+	.ascii	"0\213\270y=\206\373\361\033\006\3734\303\231CB\227W\337\234\246"
+	.ascii	"c\267]\231\032\252Ay\315XN\033\200\"Cx\234\311\353\024\263\255"
+	.ascii	"b\321\260\256\356F\362\325\341s\006g\265?\216\263T\004\310M\351"
+	.ascii	"U\305\324\235\213\025}\223\214\320\206\004R\346\365\031\376\246"
+	.ascii	"\264O\331D\301c\250\330\f>Kz\275\177S\232O\331H\351\352\356&"
+	.ascii	"L\305h\330\fW\311V+T\344~\354\006\007\031H\016\202\307N\315B"
+	.ascii	"\376\036\031\235U\215\241\206i\277\003\237\312\346\037\317\315"
+	.ascii	"\277\327;C\302d\313K\373g\037\177\217G\306\355H\027\227\366\331"
+	.ascii	"\312\325U\266\302\317\336\265\331\271\312\362j\321\312l\t[\222"
+	.ascii	";w\266:\201\354F\276\375\003sM\257\262\350xn\203\342\336\362"
+	.ascii	"\362\331*W\025M\351\316\272\3445W\345L\225\335\347\252\314\303"
+	.ascii	"\267|s\325\332\235\304\370\201\021\306\017\206\322\246$\301\260"
+	.ascii	"\3533\2226+\237V4(\311\025!y\315\311\214\004\"H\020.\004\327"
+	.ascii	"\265\302q\001\004\204\320q\241\241\267\256j$\257x\020\226\263"
+	.ascii	"\262\221\311\201\311\312>}0\240\266\273w\335H\272t\365!\224F"
+	.ascii	"\b\3351 \366\351G\nX^\361\237\247\3417h\326\316\362\212\375\314"
+	.ascii	"\265\307q\030\317q\2361\234\007\357i\221Zy\307\210\\?\237K>\346"
+	.ascii	"Xt\252\007\303\206\343\361u\177u\267\202\\w\307\354+\257"
+	.string	"xn(\214\211\031[^\261\334\021\2320\270(y}\237O\377\367p\0264\\\310\310i\237\177\266\223\315\356\0062\364vS\351;\036\302x\351/\302;\f\341\377\332\375\005w\272\265\244\360i\257L\223G\362\372\337A\337\253\033\231\324o7]\351\026\322\035cs&\275\255\244@K\227\264\373n9\327h\347\307\241p\367(\0132\206\302\342\321\370\013BMI\001\207\302_\3218\365# %55\034\022\207\274\243SP\207\320\310\342 \026\243\216\304!/\306SPj=\006\2155\2025\330\")\"Q\204\323P\360\370$\203\350\b\024B\005\2136\214\214\302\034ONI\307\2401Xt\362\035(,\006\207A\031\3555p\250\300\241C\016\336;|\270\360\341\002\373\016\037\232\232>phj\317\241iw`\021\212=>\021\245b\f=*\301\2116\202\305\337\221H,\376\210\216\300\251\342\321\350\024\004>\025\203Cb\021J"
+	.string	"\020\370\324\013\032\205\304\241\223\361I\b\003@\016\274\002\033\203\307'(\033S\274\243\023\206\f\307\241p\252\275\007\017#\034\264Ha\242\005Z\210A#\350$E\374\035\243d\b\245b\374\206\302\247\032?`\321\370\263\200"
+	.ascii	"*x\004\006g\004\213\355q\333\227\346\020h^\263\222\274\205\307"
+	.ascii	"\236\226\271^\251\321\332\233\033\334\2356Gw7\357i\354\237\243"
+	.ascii	"gG\202\314d\345\311I\262V\365K\335\223\274f\346\263\223\231\265"
+	.ascii	"vn\276F\212\365\017\020\204\324\270\241k\367\271D\024v\025\026"
+	.ascii	"\347\371\254\365\f\305\260\341q\255\227\026\267d^\363\221\033"
+	.ascii	"=\337\234\311\025\311F\376"
+	.string	"\036\200+L\244[\316\264\257\320\212e9\235y\315D\036\227\261\304a\315\3455g=\315\367|\243s\222\207\354\326\270\332\224y\r\200\304\250\321\2443\006\03232$#\222&Ic\200\002\221!3s\021\220!\203jFDR\220\024\0252\214\001\366\031\224\271\210y\2249\027d\034J\r\305v\374\036\205\f\3108MJE\260\271\311\221\255-[\310K\262\233*\024S\242\313\365BMM\326\035S\250\247yy3L\311/J-E\310\302\257X\\D\207\302\201t\256D\333u\350\0327\250\b\r\254\t\240\276.C1\322K\354~\323uRq\366\345\344\260\257\221\337\255\245~\003$\313\2517\337\344IT\021v\255\232\034\224\275\201\037\355\006\263\3009$w.\202\237\362\322\315f\334\2228nu\224\273X\354\350\251\351,\223\207>\201\227w\347#=\261\2249\311A\233%\213\247\266c\023\270\0238I\216\024\251\f\243O"
+	.string	"\252%@\333\372q`n\335\322+o0\250\230\003\fx"
+	.ascii	"\257\300\250\035)\245C\f\257\026\366\312\262\t\354d\324\016L"
+	.ascii	"\003\333\344\237DQ\332\332\177-\350\256\246(_(z\275pL|k\300\n"
+	.ascii	"\357\263\332\337\372-9\372\314.\226\021f\245\234\325)\340\247"
+	.ascii	"\036\371\013\213x\020\302\312\202\254\355\3159\\\321\330CH\351"
+	.ascii	"#f\376\027_B\022\201U\306\265\201M\377\036:N\360pq_D\023v\221"
+	.ascii	"\034\f\341\346\235\217`\016\"{\240\377\240\346\200\340B\260m"
+	.ascii	"\362A\303E\371G\017\356\t\210\365p\3119\315\331\350#\272\036"
+	.ascii	"\304\265\037\237\203\330</6\270\361\377\375@\265h\323s\376\007"
+	.ascii	"\025\347\376T[\206\275c\324\325\376\233\357\254*"
+	.text
+	.section	.gnu.lto_.symtab.da4622c93a9d1c4c,"e",@progbits
+	.string	"ol_ekf_reset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363"
+	.string	""
+	.string	""
+	.string	"dr_ekf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353"
+	.string	""
+	.string	""
+	.string	"ol_ekf_reset_axis"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371"
+	.string	""
+	.string	""
+	.string	"ol_ekf_predict"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376"
+	.string	""
+	.string	""
+	.string	"ol_ekf_gate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\001"
+	.string	""
+	.string	"ol_ekf_update"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.da4622c93a9d1c4c,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
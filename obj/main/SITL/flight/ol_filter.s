@@ -0,0 +1,1105 @@
+	.file	"ol_filter.c"
+	.section	.gnu.lto_.profile.711a714ddc4fe18e,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.711a714ddc4fe18e,"e",@progbits
+	.string	"(\265/\375`J\002\355\t"
+	.string	"\342\312(/`K\324\001\030\241\212\210\372m\324\026\317a\320\304\025u\302\027\320\344\220{A\020\224\204\025\005\023\246\250b\327\2650\320J\333\265d\313\022\222d\n\216\226\214d\004\013\013\024\344\302:\006\274\013\377\033F\321\215\260\\PhS\240\242b\006\003\204F\005Lz\350\207\356;\273\361\020\261"
+	.string	"`\203';\rL\332\rcz8\317\237}\354\334\315\343\2313\t\217\343:\211f:X\026\221YV\257\273\334\207\367\367\376\024?&8\256\247\327'\275\255\242SP\222GKF2\365\255<\371\365\276\017mC\210\234\256\234\034\004H\250\021\276\200\244B)(\024\2065p\002bSE\017\022\300\362)\232\b)4\025\314d&,\337\302r1"
+	.string	"8\205\312*\256R\032\205\353\355\036\360\366^\230?}\234\334\016\215\254\307s\323\376-\302\234\270\023\b\320\037_\360\204\362X\337y\346\341\274\366Z\306\317\037\347@7e#\001\333-\304\nIO&G"
+	.string	"\223\313\336{t\035\364\203J\3540\266\270\246\354m\270\002u\275\347\370\366\256\351\033/\254}\330\374\377-als,\343\260%\005b"
+	.ascii	"\017#\2013\333G\\("
+	.text
+	.section	.gnu.lto_.ipa_sra.711a714ddc4fe18e,"e",@progbits
+	.string	"(\265/\375 \256\275\002"
+	.string	"t\002\242"
+	.string	"\n"
+	.string	"\002"
+	.string	"\003\004\003"
+	.string	"\001\005"
+	.string	"\001\n\013\001\020"
+	.string	""
+	.string	"\021\004"
+	.string	"\024"
+	.string	"\026"
+	.string	"\003\001"
+	.string	""
+	.string	"\030\001\003"
+	.string	"\001\001"
+	.string	""
+	.string	"\025"
+	.string	"`\302\bG^\214p\0066-\310Y\210U\2119\213\246,\200\001`\023\020\366\255P\270\034"
+	.string	"\312\020X\240\330\315Y\002\f\001\231l"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.711a714ddc4fe18e,"e",@progbits
+	.string	"(\265/\375`\354\001\325\013"
+	.string	"F\320;8 \223\322\030@B\221\315\351\"\031?\320\217P\250\244\354\037\261\243*Q\265\t/\237\007\340\247@\312-\371"
+	.string	" \005\002\030"
+	.string	"\344\334\0134IB\331\272>\263\232\020\262\245L\001-"
+	.string	"("
+	.string	"/"
+	.string	"\341\356\226\346v\027\243\373T\334Y\213\345\220\212\024\263\026\013\341m}P\232U\315\n\350QZ\322CS\371\364#JS<dh\r\357\255\262\347\037\322\277\360/\324UF\210,]JR\301\201rm!\224'\320\315\356\222\366>\376\"/\267{\b\025\331\335\001\375\0045\232g\204\306:pxL\022\232\323\362\331H\230 \3638\333\335\203K\371I[\\'.\243\0075\006\363\361\232"
+	.string	"\243\316\305\313\3103\033\351\017\210\031\377\313\304\006\246\240\032\260\035\232i\203\356'\001d>\342\376\302\310\375\002\235\252{PU\260\332&H\f\313\217*-\030\n^E\333\032\n< p\002\221*\264\003\004\034\234\270\300\255\206`,b\202\025\320\276\n\217"
+	.string	"\220\200\250\027@n\234#j }a\371\004\004O\221\331\222\301VV\013\303\205x\r\215"
+	.ascii	"\221\241p\204\247\356\006\375\b\263\246:Z\266\357\311\206\336"
+	.ascii	"\f\300\355\241<X\352\324\036\2435\002\326 \305{6x\336\002\035"
+	.ascii	"\243\305-\270\271\341\3736\006\031v\210B1\254\200\222c\270bY"
+	.ascii	"d\371A]\226\305\310\026/\372j\214\343(u\024\007\316\373\n7\004"
+	.text
+	.section	.gnu.lto_.jmpfuncs.711a714ddc4fe18e,"e",@progbits
+	.string	"(\265/\375`\302\003\235\n"
+	.string	"b\313%+\200\251\351\300h\267\242M\213#\204\202\237\374\307\3421\211|h\374\323\270\t\231\210\270\024`\242\254\275\326l?\3234\241\322\312\235R\n\225\310f\202\016C\n\205\202``\341*\224l{gi%V\370]\207\374#\330\347]"
+	.string	">\344+\331\233\237mc\303\274\367\236\333\020\223\335\224\235\340\273\001\217/l\226\322\226\362\256\300\373\226\275-\273\321\307\317\3128\271\220\227\213\202\bj\232`p\303\303\002\204k\243\367*\002\347\006\234g[F\363\026\331^\3307\366\306\330\357R<\bT\250\301M\232\231MR\247\003\220\002\022\252\023\017\022 \342h\214\003j\220\t\2341\2421C1\023Q\314\314\270\032sL\262\245\315r\277\251\320u\025h6g\025\"\326WJ\206\035r!\352]h\037F\242fx\026\331\3353\260\254\001\370\026\205\321\336\341\337sAS\375\223i\022\371aVf\243\352\327\250\341R;I7\306c\362\323\3510)|\021S\335\266^\321\233\361$\t\322A7\341m9M\016K\270P\324\270\324dH\214\002\324\361\314\222Zq.\266\370\370a"
+	.ascii	"\225\235\217\261\217\205\235@VI0\340T\274`\346\361?\323^\243"
+	.ascii	"*;\020\322\377\025*\022\234jg\005*("
+	.text
+	.section	.gnu.lto_.pureconst.711a714ddc4fe18e,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\037"
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"\232\004\004\232\004\005\230\004\n\230\004\013\232\004\020\232"
+	.ascii	"\004\021\230\004\024\270\004\026\230\004\030\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.711a714ddc4fe18e,"e",@progbits
+	.string	"(\265/\375`\307"
+	.string	"]\006"
+	.string	"\"\310\025\035\300%\303\001\377\277\361\377]\377\377\277\271\244\221\326Z\333\204\354VD\3246\332\366N2\005\252CKt\256-\273F\254\362Q\233\244Q\036\322\023\323\035^u\016\303\2630U`(a\355\222\217\002D\236\310\307e\321\r=\235z\252\335\361\034\354\3223m\324\300\3025\234\"1 @\002\202\024\274\033:V\306}\033]\263 \007Y*\350\330\370\223\341\271\245\356\313\301B\220\350\226"
+	.ascii	"\013<\2322|\b\f\267\220\260>\342\241\200\330\336U\033z\345(`"
+	.ascii	"\025\273\034\n\003\301\344`X\021\"\302\274\034\223\314q\333\226"
+	.ascii	"n\372 \327\266D\233 R\200e\230:2 \337-\311\260\351r\213\235B"
+	.ascii	"\314\325l1#B\223\312\320w\220\302\271\001"
+	.text
+	.section	.gnu.lto_.lto.711a714ddc4fe18e,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_ol_filter_reset.30.711a714ddc4fe18e,"e",@progbits
+	.string	"(\265/\375`\017\002%\020"
+	.string	"\366ZbF\340\222*\035B\205\253!\321\265S\026\300\320M\221\266kJ\312L(\360E\bp\2606\n\316\341\030\017\2353\220jzb\204\002\246\273\325B)5\232F3\024\241\344\340:&[\034\037\220\034\362\221\255/\260\365\226)\005H"
+	.string	"K"
+	.string	"S"
+	.string	"$\234\330\355\023\263+\"\024\262\237\244Ya\373>\354\261\225\267p\002\332kw;\227\366\212\335\271|\307+\033\310\347\203'\f1\003w\227\213(\276\272\256\374\273|\304s\261\256"
+	.string	"\032\354\256\325s\215\270\343m\203l\207le\021CL\370x\221\335\314\327p\314\2765\2030\354\341a\267\003\331\032R\364\236\017C\342\003\021Y\366\264\255 {\303_<IlvW\201/\373\013\016~\313\245;\250\350\275K_\205s)]\263\027\330ih\313Z\032O\330\027\331\310b\007\217]U\300\300\233NC\n\327\221C\262d@0\364\033\236\036\033\377q\333m#x\r\317\0014\342\214\027\244\323p\206g\001\233\327NS\301D$\342\\\216\324b\346\225\346) \005\214\317\214\026\220.\203\342\211q\031\245\013\247\023\347R\357\232\0220`"
+	.string	"\365|\036\225\244H*S\351\304\304\204\342T\026PJ\246\023\016CIt\342F\251\024\256\204\200Q\031H)N\205B\245\270\216\254\273\310F\026\007.\276.\266\374Q\373\001\004\330\327\212,\036\021ls\271\201\033\r\334!!\024{\035\270\377\375\346\032\277\305\023l\323{\266q.\0036 \300\202\021\2429\017#B\343J\201A\312\375\352\017\265\314\202\207C5`#\036\027x\216\353\035\\\270@\330\231\023\204K\r\326\332\255\304/\234-G[\341\3025\276\031Xjd\323cL6\372H\2446:\345\201\276\005\021j\200\005"
+	.ascii	"\214N\326W\201\245\031\223`\002y\340\313\311\265\001\321VZ\001"
+	.ascii	"^\036\t^M\264\te\315x1F\3172PM|\233\brc!\b2"
+	.text
+	.section	.gnu.lto_ol_filter_reset_position.31.711a714ddc4fe18e,"e",@progbits
+	.string	"(\265/\375`\024\001\335\013"
+	.string	"&\225ND\020mj:\b\265-\253]\206\202\033n\037\234\r\232\330%f\201)\211Fp\241|\004 `\235\\\262\211\271;?\333\013\327\311% \255vUU\035Bd@D\212\337s\003N&"
+	.string	"\301$\242\216\356\270wJ\0017"
+	.string	"9"
+	.string	"<"
+	.string	"\252\257B\257\340\016\021\332\253\035\262\265\327k\026\331(\036B\330_\210\240\240E\356\356F\037\\\364)\362\237\372\004,\215>-@v\327\023,1\270\351mSl[\354S\b\024\273\300Y\0261L\354\256\207\037\336\202\001\377\364\352\003\240y\360\325\007e\257\265\004\002E~\263\264C\322\244\016\354K\226\232\354IF\3024H\354.(W\354X=L\260}?~\206k\360\007\377\344\216]ve\257_}JP\221\261o\226\226l\304\305\264\370\006'Xa\314\342;\204h\215\353\217\262,\201`\367\243Tn\023\360\314\203>\206\327\230\200\216l\321\366\f\306\\\274\314\207\303iD8\335\366\001\260\3418\232M"
+	.string	"7\322\3310\236g\273l\270\033\220\361\266O\327y\233\026~\227,5\205\250\030?Jr\306\2643\233\024#\211\2168pO\235\003\366\332\020\300\262BU\036\031"
+	.ascii	"3\241{)0I\272\237\375\206\202\314\300\020De\005\370\201\301\200"
+	.ascii	"Jgi\003\200\306\005B\024D\024.\302=\260W\247q\245bq\\\023\273"
+	.ascii	"Cd\240\002:\025\364\345\np\351\026\355|\002"
+	.text
+	.section	.gnu.lto_ol_filter_predict.33.711a714ddc4fe18e,"e",@progbits
+	.string	"(\265/\375` \020\025;"
+	.ascii	":_\350\024?P\246N\007\217\272|{\224\215\310\350\347\367\224\337"
+	.ascii	"\tm\216#-\374\\\373\0025\331\267&y\213 \237Z\306\n\342D \246"
+	.ascii	"M\3774\365\002q\235\360\302"
+	.string	"\325\213\t\261\3704d\244\355\275eJ)\005+\001,\001A\001\334d\235\231P\347\242u&\242\316K\326y\210:+Yg!\352\034\264\316)\352\214Z\347\023u\266\326\371Og\267\316\235B)\260\017k\275wH3\322\345;\363\262t\231\346\306\3533\314C\306\321f\270\201\241a\237\3148\230\207}v/y\310|\327d\324.\223#xL\343\340\026\t\360\3364\004}\262\204`\237\016\205@;s\207i1j\333\351`\341\275mj\340\334{\247\200\025\004\373\324j#\332\247m(\264OV\231\r\365\035\334\355e\235\036x\216\356\275]O\245\325\246\232\2222FA=951\025\211KC%a0EO\373\256r\247\026\204I\265cS\325\365T]\026\227\222kc\23749\253u\357\305\342QW\032\312Z]\261\\V\374\251J;U\211\363&\270f\202{\342E\266&\2629\361\245&=l\302\304\225\226\264p\211"
+	.ascii	"\2724%\036\024\320Fd\255\323\356\223\266\326\303Q$}\242\361p"
+	.ascii	"k\244\337\036`\313c\244\250vf\215}n\204z\331\016D\315\314=\265"
+	.ascii	"p\357eO\252\021i\256j\346\256c\346\f\314LU\001\221\3160\260\f"
+	.ascii	"\315t$)Q3Z\0246\365"
+	.string	"\247\310\202}\252\366G\371\265\241\021\001JZ\320\206x\275\372+\0246\365G\350\353S5?&\211\016-(P\373i@\177\374\274y\017\355\223\304\247G?\245\227\207\356\323\247\240\371\354\321\343\365\351\321\0173\217A4\036^\211\177\334v\372N\b\021^\336I\257E\311\300\004M\207\327\253\b}\206\277zN\330\024\334\275\027\202^\357\2250\201\002\005\332\347\210\3573m\340\350G\231\347\344\375m\246\363b\030\341\342\250X\241\305\243\335\364\033^\271\2570\013~\303o\320>\373\033\030R\256!\275\311Do3\315&\006\326\337\275H5\275\346\005\367\225>Y,\206w\262O\356\030\350\2141\357$7\032/|g\177d\2763\363\177cn{_\n\263u\016\263\316`\326\371\313:\223\260\316^\326yD\333us\260\316\017\254s\001\353\314e\235\tX\347-\353< u\026\220:k\245\316\001R\347\254\324\031\313:_Yg"
+	.string	"\326\331\312:WYg*\353<e\235\245\254\263\021u\216\262\316P\326\371\tuv\262\036P\377\306+3\373\226\325\243C\232\313="
+	.ascii	"\222\370\335\030\307KZ=\200\367=\264@\007N\365ULT'\336I\253\017"
+	.ascii	"\263|\221\240\352\205y_x5._L8\251\376\234k*\363\030,\325(WpI"
+	.ascii	"f\325M}\2034\365]\270H\275\361\247\276\321\330\314\274\351[\244"
+	.ascii	">*\320\032\222\212\317\361\032t-\306\377\271HL;\2447\237\242"
+	.ascii	"\344\260@}\324\323C}\025^\234W\211{rJ\002\246\311\211\312\224"
+	.ascii	"\246w\362\233\002w\267\304\364M_\265g\305\335x\rz\024oS"
+	.string	"\261dQ\347\346\320>\231\236B\234\035\222)\211\227b\361\t\033\361\213Db\222-KKL\226\f\177i8D\220EIi\201#9\"|%\260\027\n\255\004\203\317ND-\375\340\327\247)\025\024U\340B\202\234\217z\375y:\217\366O\207\270Y\373\314\234\300\223\352\026\003\177\354>\374\207\312E\365\242*\225\311\300\177\373g!\264=\274v\032.\236\335\213\334\032\361\377\250\037\032\235\2317\273\345\222l|\377o|\240U0\250\177\3262\320\231?bv3?S\301\250b\3241\352\030\264O\377^6W\224C\314\265\260\013~\364\013\251'I\n4\306\304\312V\224\215\221\005m\204\265\230!\006VF\243\005\031\331\r\026Df\261\200\254E\231\f1\027*d\214u\225\301x!&\303E\027\r\261\0253\272X\220\331\350Z\220\305c5Z\220u\225\215\215\221u\r\357\220m\357K\341\017\211\370\220o\3069\354\275m\025"
+	.ascii	"\313x\223;$\332\261H\tP\2033\357`\356\200\264\206\017\237\331"
+	.ascii	"\037\271\200$\207\304+\2069u"
+	.string	"\217\230\031\274\021\243\002\177\322\315Qr=\363\216\246+r\224(\320\315\006\007<\304\365'\335\036\223\300\321\013\361\212a\257\216\320\240\016\036\350\217\300\237m{\312-3\377\343\310\317\217\007\357\323\267\305\034\300\303\371\360\212A\257n\217\236\306K\006\"A8\036^\203w\006\374\331\246\247\264\343\320\303\353\350\300\260:\n\343t\324\037D\272\265\216}\317\347\250@\202\250C\324\320>\237ne6AzS\316\021\001O\244[\251\264\342\024\t\360Z\177\"\016\020\032\233\331\024\233\016\360VK=g\376h-\302z\001>E\272QJ\375\233\233\2746u\212\220\367\336\243\021P\326\243F\300d\375\232\004\215\365Y\216\306\323\360\336\021\326\323C\373\304\372\263\355L\324\025\036\257E3\017\376\312\352\301\255\274\266\232\036\214\370\320\007\317\216\246\305\345\222l}\001\201E\250qH\203\221\251!\021\221$I\241\322\0301\006\204\020\344\324\230\007\021"
+	.string	")CJ!2\241)(\251T\2061C\272\350\243\037\242\244\313j3\2262h\025\036S\314\031\314\341\233\350\367\363\356\240\361O\\\254\036\375g\034\337D??\357!\030|\223?\2777\214|%\3610r\007\254\252\255\275\b\226\364@g\234$2~\027\325\027C9c\005\352\3779\001_\325C%\240#\347~\355\016S\213Ph\032\361\306\251\006\220\213F\232\364\231"
+	.string	"d"
+	.string	".\br`\0335\264\276 \001~\276\201\207\316\326\261\255\032\325d\244ti\275\024\214\322\353\310\031\207\026\350\274\006\036+,If\261\260\213\300\243\031#\274\304\233\231\362\221P\265]\224\370 \345\203\305\267x"
+	.string	"\303\036f3M\306\375[T\3056h\310;#\324O\202\352\303\271H\241\326\2044\243\0214\264P\370\316.r\236r-W~\370\265\365SF)\022\177\267\026^\007\025\350\330lj\325\002\276\337t\\H\204O\017E7\201\370*\n4B\244{\240ATY-\362r\240\036\3500QJ\303\026K\330BL`\037\325\252\276\351B\316\210"
+	.ascii	"\316\376\346\326me\317\212\024g \340\031(\250\252\367I( a\244"
+	.ascii	"\224\223\320)\250\366I\241p&p\n(\321\252=\2566\242\325:.\226"
+	.ascii	"\375\261\327\250\213!\002{\"\254\037\037\025Cg\304\272>\306\374"
+	.ascii	"\263\247Y\r*\265\223\306X!_\244$\377G\t2\362\3624Z\272\352g\367"
+	.ascii	"\210\023dG\"\227\rGU\227~T\376\330\215\\i\246\232N\036c_\322"
+	.ascii	"#\037\\\234\242\336+\252B\322\243\017\tc*-\261R\0058D \363\332"
+	.ascii	"k\320\020\334\375\232\215\300\324\215\2331\220\210\206\367\327"
+	.ascii	"\244\205\352B@[\206x\037\322UL\035\255\264D\204\343`\207~\274"
+	.ascii	"++\027Z\320\316\374\310\233\3100\340n\377\204\326H\354mf\355"
+	.ascii	"1^?g\037\374\030\361\331\305\376\221\335\021\210\302\037\331"
+	.ascii	"\035\201\211f\214p\304\221\245$\261\266\3222El\324"
+	.text
+	.section	.gnu.lto_history_find.34.711a714ddc4fe18e,"e",@progbits
+	.string	"(\265/\375`\362\007\275,"
+	.string	"\332N<\021J\200VR:\243y\240\374\341#\320\006\036\324\201\210\257\177\223\322\004\026\346\023\210\305C*\337\216`\245\2717\212})4\217jl[\370\rO\020\233\260\231\333l\027y&\236\232|!L\316\031\035\0042CQ\254\375\204\020\"w\222\001"
+	.string	"\001\361"
+	.string	"\002\001M\312\002N4\"DO\271\001\357\351\312\314\304\3142\363\275\314W\036\214\351al\366\232\266\305\202[\240\344\361\357\277Pp\257m\257\216\240\265\2552\001'\340=\375\220\023abf\242\312\254\251\325\311\013\312\310\263m[\341\317q\324\247\350o\324\247}\203\327\273\273\2731G\225g\232\313\364\032\232\231\037"
+	.string	"\031\326\327\343\2556j\212\366e\342\247x\315o\252x\006uil\030\263>s\266Sp\242\333re\324\372\357x"
+	.ascii	"M\251#\233\214+\023\343l\2147\030\327\207B\360Jj\275)5\003\355"
+	.ascii	"\260\261\266\243\275\270=\240+\243\325yoJY\255U\3355\3536h\020"
+	.ascii	"\024\246\325\233R[(\317\214-\271/\017\304CJ\353\252TOQ\241(5"
+	.ascii	"\260\374\246\236P\001\307&-^\346t\321\023\265\336h\204-*s\277"
+	.ascii	"\251&\324\202U\325\227\277QS\305{W\tm\333\362U1e<\337\234\371"
+	.ascii	"\035\230\371\002\363\212 *XI\257D)A\252\316\202|8\r|\3669.>\233"
+	.ascii	"\251O\277|\320\b\367|\022\357\035\263\262x\033\t\245\213\311"
+	.ascii	"\rn,\346\364\362\220z\331\200P\320\335\316\301\3642\220z\371"
+	.ascii	"\207\200\317\325\316=\003\322\313<\352\345\235\364\262Nz\031"
+	.ascii	"\230\203s\262s\200\177\3757\352e\233\207\3754\351e\366fg\237"
+	.ascii	"z\271\267^\346\255\227\327\365\262\252^N\323\313\250z\271\325"
+	.ascii	"\3137\275\374\003\254\227(D_\332\226\305]\230\026J\252\326u\267"
+	.ascii	"_\355'\373\315\2162\337\311\004\027Xn\374\2676Vp\345L\266m\273"
+	.ascii	"\244\215W\242\227d\0323\313L\343\035\252\247\032\177-\215\025"
+	.ascii	"\020\351\236G\343\027\341\237\2311\223\227B\2127\346\364V\367"
+	.ascii	"\200\207\344IL\274\b\347$\2171L0\263c'\343\2271+\306t\342E\230"
+	.ascii	"\002U\362H\244m\333\023|1f\237\362\211\033a\346OE\037\320h\237"
+	.ascii	"\355\350\216+gQNL\200\231\f;_#y>\375\265\265\247\tt\024c9O\r"
+	.ascii	"\030\020\233\346\351\276i\233>sK\206\265\251%\331\266M\f\230"
+	.ascii	"Y\302\353\216f\270\320=\351\256eC\037\355\367\213\352y\364\372"
+	.ascii	"\"\366\032I\345=\355s\261./F^\217\257\201\335\323_\373u\266="
+	.ascii	"\351\350\270+adk#\371g\320|\333\262i,f\313\276R\234\242#Pg(\260"
+	.ascii	"\003t\0243\007U\347;z\200\331\305\301\355\264N\353t\201\032s"
+	.ascii	"\373\246w\372I\036\314\301\305\242MLG\221\215~\005E3\270\225"
+	.ascii	"\243\240\271\266m\035\314\275\312\007>\327S\036\206\b\241>\275"
+	.ascii	"\375\345\201T\311\243\327\227\332\310\2713S\0056N\337.O\307\342"
+	.ascii	"\320\212\246%)\260\027t-\233LA\002\366\313~c%\353\350U\005\327"
+	.ascii	"\345\243\2106\362=-\232o\335H&\372[\300\262J\323\005\303\374"
+	.ascii	"\346\343\230\311\347\342$Vr\037\f\242\350\bi\270$\034\221\204"
+	.ascii	"\204\224d\2643|\207\021\3036\342\240\344\001=B\032.\241lT\244"
+	.ascii	"t\264$b\350a\203\210$\341\022\210\017C\021\036\204#\206\034\220"
+	.ascii	"\204FJ%\204E>\234D\342HI\270\224\224\244$d\225\3047\026\237\355"
+	.ascii	"=\032N\350~hcxR\211\376\345yuL"
+	.string	"rt\321Y\266Y\002\261\213Y5\215dvk&\247\373\210\r\202\373|\375\376\217\345\321\266m[\032\004\367uN\377\354\251\017\034p\267L\006\026\333\314\217\3272\027\243\202\313\332j\363\372On@\275\266\232\345i\250U!\243\227\242\234X\235\201\036\272\351\264\r\364\227\3140a\213\002\240\221lP\377\315\027l!\f*PM\232\0200\273\270'?\r\324\353\264\177\372N\272d`\2718\237L>\356<R`t&\355\322\013\347\002K&\330A7\007r\351s\216\031Y\264\347\353\001\035u\264W0\362\004\352\254\327\335\353\250 \332\300\016\366\337\016D\026\345\002\200\234\250A0\203\225R\312P #\242I\222\f\007\200\002\021!<n\021\200\245d\356$Ia\331\177\003,\255\250Y\363v\351\301\036\007\211$S\341\226\355\213\245\225\322\215\023\332\325\207\243\241\213\r\313\316\331{\253|5d\265\272\323Js\366\b\234\317\b"
+	.string	"\334\356\253\b\202\201\031"
+	.string	"\274\236\364\"\303qF\213\201\371wz\230\020\260\375#1\351\310\316\227|\274\313%0Ee\200\374\352\357\346\277\006\262\366Q\r\022Y\317?H\36619$\313\020\036\034/\0362\331\n\221;\254\253\344I~\352r\347\343S]\233\311\026o\371\350\360\222Ii\261c\227}\274\250\016\302qm4g]\341eM\003\267\367%[\t=\321\371\256\324A\331\355\214|\276\334\261\021\257\243v\207\367\001\017\361\225\364W\b\214x4\204\372\031S\275\312\220\254\375\024\033\256J\304\301&\033/\217P\030\333A"
+	.ascii	"R\253Bg%\332\017\020\t\370g\316\026r:\234\215L\361G\273\331\372"
+	.ascii	"_o\345\351\306\351\356?J\326\367\004_\"\356d\302\202$-!\350\032"
+	.ascii	"\250Wl\f\376\323\345\013;\245\311S\301\316\340\2201r:\206\245"
+	.ascii	"\213x\370T\361\220\020\032KW\003"
+	.text
+	.section	.gnu.lto_ol_filter_get_past_state.35.711a714ddc4fe18e,"e",@progbits
+	.string	"(\265/\375`\036\013\3555"
+	.string	"z`\320\024CP^N:3S\247\207\206\341\001h+I{\350\036\331\343\f<\222C\035/\342\342\341\322b\317~(\227\206\347\375W\306\357\r"
+	.ascii	"\001\001 \310h\034\207W\265\263Y$\346\232}(\307\333\366n\204"
+	.ascii	"\020\271e\n8\001\034\001?\001g\2460\036s\0363\032\346/\314u\314"
+	.ascii	"aX\375\031\3159M\216\264\267\274\263s\302\037\323\f\237\371\211"
+	.ascii	"\257\301w\027Q\343L\206\361\316\315\023\377\363\230\257.\276"
+	.ascii	"{\226\022&\311\270u]\211]\3471'r\332\305b\356T\n[6\350S\006\304"
+	.ascii	"\345\024\375\277\316`\230\311v'\206y\363\362(+\200T>\373\326"
+	.ascii	"\265\254C\235\r\245\260\345j6\365\266\\/|\271\201\256h\313\365"
+	.ascii	"\214\255\274\365\3059qz\251\333K\356\362\305^p$\031\255ati\024"
+	.ascii	".\247_^k\177\216c\271/\236\323q\341\272\2525\313\254\353\362"
+	.ascii	"\351O\227S%&\240r\212\362\221\312\351\377S\250\360u#/\331\204"
+	.ascii	"\260\222\220\030\030@\353\272,\366\032\033y\2108\024\336\240"
+	.ascii	"\232\242m\215g\036<\204\272i\031\023\027\250v\226\306\304$<L"
+	.ascii	"\322Db\205jgG\370.\251\235\241qPN\031\232S\314\252r\312\216\260"
+	.ascii	"\035\322\246E\030E\037\304i\202\247\310\254\007z \311\206\b\247"
+	.ascii	"aKf\026f\033-\226\211\231RdvD\215"
+	.string	"\366X1\303v\274\344V\226fm\220\303\272\256\267cfg|\"\376\037\347\277\325?\304\013\234\336EU\225\312\251\223S\023\346q\357\316H\332J>\276S\215j\tm\001\221\311\243}2\222;?\037h+\357\304QMaJSKuTS!\333\216\366\371s\033vs\3479\312\255\236gy\354y*\247R\315i\370\310\016[R\016\r\314>m`\230\232\300\276\r\265\251\325\2645:6a6\320\211,\337\261\335\361\356\030\204\376c`Y\036kj\266ca\034\2375\260\257G\363\370\227G\333\312\237\321\265\235\374\034\030\217\277Ah\257ahO\225\001\003\347\361\247\204\366RQ\354\205\031\n\265\177\222\300_\370N\214\206\037\201\353\370M<\307\f\001\265wp{\246k\337\340\332/]{\245\241=\203k\277\340\332+\270\366\t\256=\202k\177\340\332\033\270\366I\327\036\351\332\027\270\366\004\256\375\200k\177t\355\005\\\373"
+	.string	"\327\336\350\332\003\270\366E\327\236\350\332\017]{\342\265\037^{\341\265\277\327>x\355\325k\237^{\364\332\267\320\336^{\356\240\200-\231\246,\324{\313U\310s\320\n'\r-\240\013\264\245\203L\016hn\002\215\002\"\335\004\364Q\017\350\316\203l;\3768\352\004\037\254\230\212\376\303{\263H\333C@\367\037\036\\\200\376C\330\243Q\023u"
+	.string	""
+	.string	"\315mD\324E\r`\204\345Q4\202\237\200\n\021\"\n\034\352\237\004\013\"\366\355\241as\023o\013{\030(,\301\177T\264\036\2317?\200\267[\217\f\334\\\260\177\023\374\367f\324\331\317\250v\242\371p\250\234r\2331?\265\273\203m\235\310d\332\334j\243N\244[7\332i\267\023\331v\354Sq\371\216\021\013\212\273\256+\332HO\346\236\202\365\250h\2751\200\3265,*\017\013"
+	.string	"C\230ow\030\317\r\225\323\266\311\2649I\27190\373D\205A\f\315Nu\25234Y\235\025T|H\346c\301L\266\275'\270*L\272\275;#\267\225ox\2521|\r\022\265cp\312\266TO5;\031Iy\334\253k\223\300Mm\233\312\037\223n\257\216\335\300\361\365\251\255<\321n\016\225"
+	.string	"u'\326\354\250\216\320do\376\267L\334ER\350\334p\030\346&\242c\006\242\201\315YQd\373o\204\302z,2\360\255\353j!\016\313iq\216\022\227\001u\225\205\345U\324\332\312\312\332\2622\360B\013\253\255\252\270`\240^ZWYW3\256\202Z\354\325UE\003\275\312\302\362Bo\005\305u\3455\003\013\206\213\031[E/\0311\260f\300(jaUe\025\255\270\272\212P\013\276E\343\212\253\350\265\265\305U$.\301\030]\333\311\325\265'\314&\221\331\250\262\035\203\330#c6\355\331\25021\3659\200\365\361o\242\353\252\266\201\3030\333q\200>/\36694\274\023c\n\245\232C\223\375\rz\rp\314o\251\027t\203n@d\333\261\311\310${\230\254\337\360|\252\t[W0&\245^jF\272ih\245+U\362\216{u}T\255\241\223"
+	.ascii	"\305\n\201\331\347!4\203\246j>\303\350\025:\313*kum\307+\326"
+	.ascii	"\211\016\007"
+	.string	";\n\331&,\242\330\342X5\006a\2240I\312\315\021\245z\203\225\242\244\333\253\033\266\362\366\372\355\t\021k\336\247v\320dR\315M&\236\305\371\323\313b\231,Y\320\301c\036\234\202V\222\007\316&A\242\240\323\277f\340\\\202F\333b\215\330\"'\214r8\022t\252\327\204\233C\320\277\221\213\035r\240\221\032\201\201\346>\200\324Im\300,\251\203\025\002(\b\020\244\002\375{\260dt\306\374\b\004\200\303\250a0#\215c\312\b\221\214$\005\311t\320\"\221\252\232\016\022\300E=\305\264C\"FJbZ\247\315\311\227\272W\224\367\332(1\re\363\315\265\214\210<\"\211}]\212Dc\"\0039\233\236\335,\262\225l<\361n=\367\"\2072\256\244\272'\224\212\ri*r\276PF>\023\371D\212l\001\377n\007\030\307\244W*\254\"vBN\230\251%\025k\351\355\210\256j\356\253\221\264\243$\214\234"
+	.string	"#\214\365\314u\001*D\226\024z\302F\030?\001\312"
+	.string	"Nn\230q\353V\211% \340X\321o\243NT\370"
+	.string	"\023\211A\025\260*o\236\241\021\006\317 \244\242\262\227\261\006\240tY\302\354\031R\354\270`\374p\216\303\017XN\025,\331\263^\003\2615K]\312\201 \361\203\005\270b/JNqYQ=YO\204\304\0331=\335\211R4@&7\225\244Y\203\314\370\336\205\002\236\020\250\202\214\346\217\225\020\357\357\265\341\2237J^\342\375\3666\3037__\024\275\373\241`\023G^\331\267\231\363W\327\036J\306\301{\223\342\222\360\233\236\211\352\245\375\201\252c\205\234\305\232\225\352!\301\205\216g\313P"
+	.ascii	"\030\257ra\300\304\325\275\233_\372\033\022\205\350\264:\021"
+	.ascii	"\326\277r\t\365\305%\236,\220Rl\023L\315r\rq\017\022{\325\200"
+	.ascii	"\213\371s\005\027E\266\007\275\250\352\361CD\261\250\316vG\246"
+	.ascii	"w\345\306%\033!\324"
+	.text
+	.section	.gnu.lto_history_shift.36.711a714ddc4fe18e,"e",@progbits
+	.string	"(\265/\375`2\004\375\030"
+	.string	"\006-\234I\260\226Q:t\270\243\263\206<4\232\016w\313l\021yi\241\335\241\247L\034\006\2228\224s\246Xh\366\020\253c\357\257a\030\311\360\345\364\326\237\2350vv\346\230\213\376-\037\347\205\323\332\240\271\215\340A\306\020B6\221;\245\206"
+	.string	"}"
+	.string	"\210"
+	.string	"\323\276\321\217j\337\331g"
+	.ascii	"\265\002\3515\325Zk\\C\236\312\034F<\r\337\022O]\263\237\234"
+	.ascii	"GT\307\241\026?7\202\265V\327\016y,\313\262|\310\273\305Y\373"
+	.ascii	"(\322pg\315G\372\f\215)\270\\\210\217\341\330#\302\005+\367\023"
+	.ascii	"\276\252\250x\274g\233b\200\030&NK<\f\t\024I\321\204\225\353"
+	.ascii	"\t\005\350\200$\316\364\t\224\273\315}\357\005\212J\\\316\304"
+	.ascii	"\347\330\240\326\352\211\313\215\270\311\333\016\262\275\300"
+	.ascii	"\016\037\004\273B6\3176_DUO\274*l\230\227/\335-\227\327\370["
+	.ascii	"\316\373Y\337\375+;\275z\322M\356\364\370i\361\323\364\323\341"
+	.ascii	"\247\367\323\363\323\217Y\"AC.v\t\257\212(\251\324(\312\343\305"
+	.ascii	"\227\376$?\307\227|&\034\265\235\3530\313\021\240\222\275\272"
+	.ascii	"\r"
+	.string	"\277\227Ts\257\242\240\002r\307\307\341\325\251\355\235\337\360O\346\306\233\211\322dDs\352\033\362\364+\273\206\223\004\274!\007\310S?\273\241\354P\301'\340\356>\005\331\315\025\022\004\310qPV\366;\367?\037\235-\334\207}\260\247\031\265\326\033\333\020\376\273\300\322\003\030\254\265\276z\334i\346\2638\265\206\r\034\304\323\357\225\036\203BJw\264\243+$u\377\304\326\276\354\224\342\243\263\275h\n\250'\\!\323\274\265\b^ \001o\263\312\344\256\266\265\f|`\330fi\337\367&\377|\026\356`\247y\234\235\304\323\325\236\351\255)\"\335Q\020\317,7\307\217\236\\\262\3070\310\026Dl~\210M\017\261i\230\r\rG'G6!B\316\314\245S\201\202,g\202\013\203L\302\005\027\214\266\301e3\300\263\f84\227\316lFs\255x<TG:\271\243J\024\317\332\250\306\025\324eWi\322\234\\ r\307u"
+	.string	"u\233UMp\3544\316\026(\214\036\326Z\253\270B^\365v\341\313\236\3516J?\276m-\314\002\331\006N\256\313\276w*\243\250\024w\212\211T\313\322\025)\\\211}0\250\031I\220\320]\250\023\341\032\t\026\211bmT\250QH\306\f32%BA\024$MZ\f\320\002\231!\343\006\021@1d\346d\202\252\335\201\303\",]\230)\262Slg\354\203\363\342@\004\221\326\221\017\030\311\362\346Y\215\232\030\304\362s\305b\001\247"
+	.ascii	"Cx\212\371W}\2412Dd\330\367&@\365\276a\201D%H\230\265\244\362"
+	.ascii	"$KF6\233\273\267Rj\266p\255\r\352\357G\013\340a\257s\016\222"
+	.ascii	"\310,\\\315%1\213\261\2742\200\340\b\016\026\265b\020\031Z,\206"
+	.ascii	"\257\271\272\353\004\351\332\210\323\332\367`\307\"\332\350\020"
+	.ascii	"\377 A\363\346\216\252\342\306\237{UoS\247\203T"
+	.text
+	.section	.gnu.lto_ol_filter_push_vision.37.711a714ddc4fe18e,"e",@progbits
+	.string	"(\265/\375`\217\002\375\021"
+	.string	"vauF\340\362f8\240\007\252'\020s/\214\206\026\bn\253\"\001\375\240\3141\361\310\377j\037\213\305.8\225>\221\310\276\277\004\372\215J~z\240\024\b\202#\310!~\271T\354\363\211\021\304\221@T\374\360\323&{K\231R]"
+	.string	"Z"
+	.string	"f"
+	.string	"n`'\222NW\262=A\035\234v\307\227U\216\250\030\214Q\013X\367\374\264O\364\"\332\215\334d\221\335\247%\247\335}\371\305\272\207\340\004V\367\272\013X\3353\315\246\372h\333\337XpX\021dwA5q\332\223\346\377v\021\021\250\366\374\036\354\256S\004\372p\353m+\260\355\300\326\004\001\376\211{\266\t\363b\270\272\301\311\213\237\032\370\001\221\333\2405{\254\245\226\260\337\355\356Z\205\354#\375%?\372]\037\177\222\033\375#O\272\277.\335yi\365\322\331\245?"
+	.string	""
+	.string	"\221\324\212\214\335\237\252!\233\363^\240x\322o\3777\267l'\345\260j\036XK7\246\037\273\343\311\275*\246\206\\jGx\324\f!$jK8\324S\217\241\021\265'<\206\233Ll\273\253\342\3038\216B\205\226\226\325\275/H\207\020\021;Y\345"
+	.string	"\371\272\355\362\222M!r=Z\263K\257t\027a\001'\303f\362\242?\022>Z\363O\263\372\364\272r\303g\004OV\271\225'\277\322[\204(\266\335\235\213\376\322\231h\00270\034\205\331\304f\235\206\230\314\211\311\f1i\230\024\031lV\023\223q\251\t\301\231\205\231X\215\fx!\366b\003\302\310p\300\224\003\0161\300d\340,\fe`k\334w\253Bf)\312\355(\217]\371z\307cGv\372\024E>Ts\030gb\303q\021\b\312SU\025gC\270\r\343XR\251:\005eT\2426\313k\350\320\b/ "
+	.ascii	"\003\0219\326\001sB\233L1\256\214\024\\\216-\026m\272E?\030\017"
+	.ascii	":\202\335\305\351\310\"\r\034I\b7)\203\214\301l\273\355\346\330"
+	.ascii	")\n6wN\016\030N76\030c0\333g\306\r\326\264]'\276\341\235\206"
+	.ascii	"Y\232\r\220a\"\215k\224\242\340!\270\334E%\245\273\030+%w\035"
+	.ascii	"\"\026\310-/\204C\006"
+	.text
+	.section	.gnu.lto_ol_filter_fetch_vision.38.711a714ddc4fe18e,"e",@progbits
+	.string	"(\265/\375`\336\004\375\032"
+	.string	"fn\244J\260XQ:3T\200\030\222\021L|\254v\323\211\033\267\226\216\354\361\016"
+	.string	"?\200\374\033\270\200\245?dLy\020\267E\246+\332T\264\274\006mb\347\205\345g\205\345G\036\\\3619\276\315V#\212\374\1777?\222\330\275\211\334I\006\211"
+	.string	"\215"
+	.string	"\213"
+	.string	"\"IDa)\n\324\275\227\201\370z#\001\367\3352\377G\274\342\343x\216\334}@\"I$.\tI\201\272\327\304ye\005\342k\354\003\354k\370"
+	.ascii	"\366\225s\314Sn\302\270_z\"\304c\313\275W\326"
+	.string	"/8\344\356\334\255\252\212a\323\034\377G\037w%y\273\342*\024\224W\n\321\n\200F\321\305P\245\033\222\321*uaN\020\352\367\243\327\324 \352\321\260\350\375R\2568UA\270\3672\335\225*\316\343\231\231\0053\333\230\3033.\230\233M\36290\202P\335.\370\324\366\244\212\270[0\337\330\324\304h`\257\031\231\230\377\376\003?\177\003o\372\013\234\351'p\245\177\300\177g\327\317s\353Mg\326\231\3160W:\257\356\363\235\355H\231\216\224\217\300\025L\362\300\351\336\241\251\250\373T\1773\200\374\022\2308\254#\336\236\324\363\343\254\360\343\243I\302\207\036L|\306\210\020\342I|\362Pb \307\212L\243\222\350\352.\016\347\210\257\314#\236\304@v\360\252\343;rG*\021\264Eq~\363Th\342\024\332/\215tM\322\332KN\272Rd \373\376\r$('h\220\177 k\373M\341\310I\250g\202Nq"
+	.ascii	"\372!g\266p\201~\307\364\274\362t\242Iv\322\323\304\305dIKI\022"
+	.ascii	"\026\022>\217\300\364h\204O\344EJ`\320\321\261\257\253n\244("
+	.ascii	"\033\276 :\305-J\317@{\363N\264\227\223{\203\276\343\003/\004"
+	.ascii	"\210\037\343\225g4\372\335+\237fk\034\350w\266Y'\222']\223\375"
+	.ascii	"\207\367\336\033v\263\0165\334\212\304\b\021\031F\034\317\016"
+	.ascii	"\202\027\236[\355\247\006\302\366\314~\232w\026\370\314p\266"
+	.ascii	"\232\006\f\266\233\f\267\201V\263i\220\361\324t:\310v|~d\013"
+	.ascii	"`|\3630\363\221\341n7\037\331\312\274\2576}\023\353\032X\323"
+	.ascii	"4\217\326\231~\325\230\226\231\300\345)\250M\360MK\365t\251i"
+	.ascii	".A\232\336\242\345\325Y\370\3042\366d\332\n\003\253T\350 R6z"
+	.ascii	"&i\033\fE\031Qu\013\246\241\253mZ\035c5\254y4\204\351\231\346"
+	.ascii	"y\230J\021\256:\246y\266.R\241\355\261yc\007q\250At\350\314\214"
+	.ascii	"\004\243\244 \005\005-\034\320\002\241\300\206\036\021\200-d"
+	.ascii	"\220\024\026\332\r\274\216\232\002,\353\323\352~\327#\361\347"
+	.ascii	"w\224p\3761A\250\314(\317t\216\361o\317\261\031\035\240N\003"
+	.ascii	"\343\347\375\340\2104F7x\312\216fw\017*O\013\211\n\261Zs\233"
+	.ascii	"j\274\247%$b\200\322\2743\326\022&e\201\024}&\357h\212\365|\177"
+	.ascii	",\272\025P2\fr\003\366S6\004\363u\005,\244\256\324\234\375\215"
+	.ascii	"T\306\232l,\211\205\375\277\330\372c\241\252g\345\301.\326\302"
+	.ascii	"W\327\257\035d\\0\276\263\346\376\027M\210\226v\006\202\212\250"
+	.ascii	"L\375 \002\3646|\333t\222\260\177\316p\037B\355\235\347\346\303"
+	.ascii	"d\205\306\316\035w\277E\005"
+	.text
+	.section	.gnu.lto_ol_filter_correct.39.711a714ddc4fe18e,"e",@progbits
+	.string	"(\265/\375`Z\020\365G"
+	.string	"\312{\264\03290\346J\007|\3403F\210}\013h\265[\377\013\013\013~\343J\005\367\344\013b6\366\271\233\026\033k\002P"
+	.string	"\247@W\310\375\336\366Ty8S\331\276\030\r\021\271\367N)\245\240\001o\001\236\001\3347\262\340\334\270\3145yDy\254\224\247%\0261\r\244k\274\356\274n\275\356\275\356;\335}\335x\272\365t\377u\003v\007v\013v\023v\377\351.\3546\354"
+	.string	"\314\315M\250\023\231\225l\244\021\371\307@\272\311\351\224\331\b\263\262\323f^\302=\247\351t\235\266\323|\355\327yzO\267\315\247\373\364`\373i@\035\250\017Y)\250\007-i\303#e=\245\017pH\262Sg[J\215R\013\267\210\375Q\302\305\007\241\222&c\027G\036\202o_\201\334\312\325\261,\353\005\310m\026@\226]\273\361\307\355\f<\213k1\364\234Q\201\207\333d\331Z\001\346\034\034G\023}o\200,\313\222\270\243d\311\304\262\177\374"
+	.string	"C\3545\241\036\310\017\311N[\217,\311\326]\276\271BG\226\315\343\312S\262D\013\300\2529q\326m%;\345\226\323wK\032O\311\022-\217-\003\242\005\224\003\311\262\354\204N\231B\262\323eK\251\235\242\035\245v\312\0270,\341\265\363\344\244\364\230g\323\016$\313\346i\375\230^\033\352\311I\331\304\224\274j\212\276\257\334e\r\245\346i\342\b\314\024\267~\352\303v\262\0023\245K+\271xS\2325-\316\224D\033\020\n\323\330\211k[\320)7AU:\315Z\233_T\202#\037IPlMTJ\312\231\2644kY\\\275\322)\023G\241\330\230\350\222eY%\033\232?\272"
+	.string	"\356\315\251d;C\227\201\020\233}\330V\211kn\356W\004\313\262\354ilS\232\0014s73\2171\003"
+	.ascii	"\024\351\243`\323o=\327\367\236\024}\310m\323\247\217\255\223"
+	.ascii	"\351\223\177aEGZbz\rsxfm\207Q\244\227\307\262\034\342\371|Dc"
+	.ascii	"Y\263\253\373\311G\0071\323\234\265h'\344u\252\237\276\205\027"
+	.ascii	"-)\222\032\243!=J\377V\371\263C\377\177\353;\222Yw&\243\035\271"
+	.ascii	"m\204~\2059\246\321\213\270U\324\2155n\340\300\241v\372\317\001"
+	.ascii	"\256\261)}y\362\375\307\361\252\372O\325I\204\346\224X\2007b"
+	.ascii	"\037\346H\246\3653{\351\360N\363_2\3712f\006\353C<\222,\313f"
+	.ascii	"\340VlCa\334e:\345\037b\336i\235r\213\251\235\366\367a{\033\\"
+	.ascii	"\235\333\035\236\231?\231\363\316\374\343\230\373\237\317\347"
+	.ascii	"\223\037\216\271\365\232m\\\347\030\327\031\306u~q\235]\\\347"
+	.ascii	"\026\327\231E\3435\237\350\274f\023\275\327\374\241\3574{\350"
+	.ascii	"\276\346\016\0346\264\236f\r]\\M\330|\241\3774[\350\302\346-"
+	.ascii	"v\226\320x\232#t`3\204\026l~p\235\035\\\347\006\327\031\353:"
+	.ascii	"_]g\006\327\331*\351\274L:/P\235\253Tg\252\353\254\340:'`\347"
+	.ascii	")vFp\235\017\\g\003\327\271\300u\226\272\316\004\256s"
+	.string	"\024;\017`g\001\354\034\340:\003\270\316PI\347\247\353\354t\235\225\327\271\351:3]\347\344u\276\327Y\275\316\351uF\257\363\263\263\253\036U\357\206\230ngk\030\017\263\306%\301P\375\257\221\324\214\262<RSN}\025\204\317\232\372'*n\020\233_\366X|P\b\233>\216\021|_\252\223(\313#<\344\203\237\320\314\353\334J\306;\r\301\373\334\026/N\307\346\2271*\024E\f\323\201\2572\360\007\276\007\273\276\300\033(\360w\257\321\311{\207\206~\311\217s)A\004^\352\323H&$\327G=\201o\246\333Y\324\277\0231\210nwmf\376\3641\204\205\370\356\307\261\247\256\245\303\260\030\242`X\316<\267\255F\360k\266)\207w\264\353\3259\271f\373]\017\341\325T\277\276f\233nxG\271^\235{k\266\317\365\017^\255\031{\300;\243\017\360\003\376#5\253\234]Ex\001\217Fj\006j\370"
+	.string	"\237*6\236!\342\323\342U\034\013\267\275we\245\013a\305;\375\360\030(\370\024n\265\330V\272\nk\036\036\2131\320\314\237Y\036\205\333*9\226e70\257f\034\312JG%\327)\273\232?Y\321\254jV6+\033\265\323\016\377\217\210\234\201*\200\347\360\327"
+	.ascii	"\234mP\277\341{\220\371\250\001\033\352\177O\321\256\rD\337\234"
+	.ascii	"Gi\223\251\032\376@\\%\216\\{*\242\037\307L\315\203\352\323O"
+	.ascii	"\3251dgz\223\007\271\313\360\352\206\005YP\355\364\351/\334 "
+	.ascii	"g\333U\333\210\315\207\377\3268\353\235w\232\206o;+\210NG\346"
+	.ascii	"\227\361\322\373-\374\326+\277\351\235\236yD\t\3574F\331,&\234"
+	.ascii	"\276k\320\251|\013\337\205B\371\001cE\274\206\240H\304\234L\314"
+	.ascii	"\223\2109\0220'\003s$d9\306v\204\021\371\272_`cca;T\2601/\036"
+	.ascii	"\350\026\022\337\"\363\255$\376\00566\004L\207\016\257$\222/"
+	.ascii	"'\373r\326Q\201\b\330\030\220\260\0359\200\b\321\032\353\301"
+	.ascii	"#\f\310\016\255 a^bZ:\210\024\321\252P\305B\206\200\021\321\032"
+	.ascii	"\023\"\204\210\2262\317\254Q\026}\262q\202Q\n_\353\315\330\022"
+	.ascii	"$<\2130\3733\346\366\257\005<\202\262,\230\020m\330\355\250\347"
+	.ascii	"O\224U\272\223\356\303F1W\330l\235\272\311T\033\257\306\034C"
+	.ascii	"\315\037!1rG\216\215\322\0300\240x\243\242\310C\316\270\210\b"
+	.ascii	"\205\361\227\355\220\335\013)\256X(\262\202\023\342V\301\"\342"
+	.ascii	"Jg`\361\360\305_6C.\3267\037$\250\020\320\037\027\177\313\f\331"
+	.ascii	"\265@\341\204\203}\002\371\264\370[\246\350\344\024\336r\373"
+	.ascii	"\264\310\276\307\377\216\260\345\310\021)1\017\267\n:\021\317"
+	.ascii	"Jg\300\217\305wb\373\233(^\334\356\0023x\203w`e\305\322\366e"
+	.ascii	"l\365\035\336\3017\263\216\301{\370\006\377B\021\263\356\314"
+	.ascii	"\261\376\304\233\330\262v\371\360W\217\365T\314\2723=n\261\026"
+	.ascii	"\351\254t\013\026\363\256\236\251J\244\323\3033\370\023x\334"
+	.ascii	"V\335\255tTr\030\374\335\213\264\013\354\360Vo\002\216\335\033"
+	.ascii	"\253\277{\226\372\236&t\233\213\366\b\371h\346\3177r\225XJ\n"
+	.ascii	"\336\251,\023\374\205W\360\024\326\267\004\177\037\037\355\242"
+	.ascii	"\360\020\263\374\313J\306\373\334!:5\201\"\307i\371d\262z\301"
+	.ascii	"/\277\347\026|\3728\311\256\255\352\307\254qO\213b:\355\221Y"
+	.ascii	"\257q*\325\007\201/\250\2010\344\224SffDD$I\n\222\306\221\005"
+	.ascii	"\204\030\006\025\236\035\021\340,\247\020B4b\022\363H2\254\001"
+	.ascii	"\327FM9u\213QS\376\324u\347)\320vO\343\305H\342&.7h\212\215\240"
+	.ascii	"\nZ\374\361T\307\237\206\361\226[\276;\331\373\301\310\316\262"
+	.ascii	"u\270.-\303\25171\036\277\377\214\214\261w\016:\314\350+\324"
+	.ascii	"\247\261\314I9\2600\267x\266\365\301\227W\246\247p\0213\266\326"
+	.ascii	"\335\022\353 F\242[\037\265u\377P\333\337u\251\263\221[\316["
+	.ascii	"&\300\324\225\260f\263\373\326V\346>\263\210F\270\341\031\374"
+	.ascii	"\241qT\027/\022 \220\242`\016\277s\t\335\322\246\356I\363 \026"
+	.ascii	"3\036\275\242CeY\032\213'\274m\013G\332\336L\023\343\302\241"
+	.ascii	"\367\332\304\343\332B\353\314\215\241r-\037\332\230\232\322$"
+	.ascii	"\tR\260lN\272\350\222\017c\245\316\203 \263&\360\272\246\321"
+	.ascii	"\377\270\234\311`:C3\357\375\363\346O]\213\236VR\216X\002\365"
+	.ascii	"\255\270$\034\201\225\263"
+	.string	""
+	.string	"u\263\350\b\226\227\004H\231\320\326{;\033\265\243\030\301\364\322\304\320\215D\313\026BO\331\034D\">\255U\330\b9\374\017Q\342J\\m4\202\230\224o\rLnx}\213\016\324P\221\303\335\002\217\304\016\365`\300\331\0064\r\306q\bK\020\200\270\315\023"
+	.string	"\247{N\310\231$j9\324!M\353s\250\227\205\327\362\354\244\346\003\2517\345\005\333X!\260\213\276~\240\376J\037\207S_\365\344\005\003\232\3731-\220V\032\031t*8E/$D\020\324s\001f\317\326\026\310\3565#\205\001\363\246\271{t3\335g\035\251\243q\355\031\217M6\271\013\003\304-\236\037\031Y\037\031\335\251\226Kz\004\236\0369#\265j\370\211T\362t\227\242\350*\222\262\257\306\036\330\252\217w\367\242:\320oF\2469C\t.\216\220\037\301\254p#\342\222\220c\030\204!\024\246\023\274\213\320< ?\252\321\216\204\0070\237\300\004\003BF\273rX\221\303\034+\022\370d\313C"
+	.ascii	"\245\025\025\244\002*;\3562r\232t\344\003\275\313y\347\300\247"
+	.ascii	"v\343\025\202\313\253Z\316\302\022&\272\222\317\275c\376\003"
+	.text
+	.section	.gnu.lto_ol_filter_correct_altitude.40.711a714ddc4fe18e,"e",@progbits
+	.string	"(\265/\375`\037\004\225\027"
+	.string	"V*\225J\240\024R:\264\217d\220\237<\036\026f\035\320\316 \200\272\354C\206\2540\223\224\030\nl%-\240k=\343\006\373w\352\300\352D\357\377T\227\245\361\343\3444qrx>)\342\321\3760\236|\313\252~\221\251\317\253\375\204l\231R|"
+	.string	"r"
+	.string	"\205"
+	.ascii	"2\036[\366\036\377\3112\333&\206\330\217\203\200\240\254!\255"
+	.ascii	"Z\253\313K\307\304v\3553\275\251\347N>MR+\f+\026\265V\233m\261"
+	.ascii	"\227\265\007x\275$\017\340\365\322\266\013\030\350\261\357f\322"
+	.ascii	"\320\2256\004Mq\325j\336h\211\373N\322\365\371\277\223\024\304"
+	.ascii	"y\003\253J\370\341\224dA22\312\204>dM\306U\320\237\276B\302\237"
+	.ascii	"]\030M\255\325\033\024v\270\313\333F`[\306&=\004\276\212W\371"
+	.ascii	"\\\221\261s\276b\247\222Tk\215\031\236\352\202\277\364\322:;"
+	.ascii	"\373\340K\177\347\365ro\027\257\2271j\264\304T\324D\004\356\321"
+	.ascii	"6}\226\222\260OV\212t\262k\332\256Mv=\333u\311\235~\222\233w"
+	.ascii	"\314\353r\327\344\256\251\327\273\353\243\330\216\212\210\224"
+	.ascii	"\204(\226Y\207\216E\352UI4q\363\267\357G]\312\226\231\347P\246"
+	.ascii	"K\\EL\265\3267l\267qUcFa?\034F\242\035\234\206\317Y\321\227\361"
+	.ascii	"\031\017 \324\354\2035\257\227\027\022\334\"\360\030>S.\345\234"
+	.ascii	"\303\330\241$\275(\241\227\372\242\020:\242-I}\203\333\007]\003"
+	.ascii	"\242\224\244*D\237,\305\026\273\225\"\013Jg\226\202\274K\304"
+	.ascii	"\221\212\372^K\007D\361\370\331.\227\254\317\026\237\037\221"
+	.ascii	"\005eV\317\034"
+	.string	"\217Z?\265\002[N?u;Ga\037\\Z\013\242?\307(\t=\205\2111\004:\341\3430\031\026\027a\247\227\353\351lb\276y\341\341z\272\034N\215nw\353M\220\220\323\341\334*\344lrn7<\235\333\313\212w\026p\274[o\267\343\335d&\360\024\311/%\243\341I\177\337\353Ow\t1\034\356\255^R\r\266Kj\032 \365!O\022\374\210\021\256\023\3512\226'F\232\202\017\021r\255\003\331\372A\322(L\250#\005\321d\301}\3640\362\362,\237)E\036;\224\342\016\023\n\023\3460\022)\203c\3518@\364\"\2705kp\034\001M\250aP\002\021CD\026\027\024\224\231\034\360\"\021\252\362\021@\2412\3100r\306\332\317\004\003\310\323\247\270\t!v9\217PG#\3741\364\353#\362\324\344\210\354{\314\372\375\311\222\201\364\353\221\305KZ\366\325\204\362\324\337\204D}\243\207\007\302\344\324\262R"
+	.ascii	"i\214J;\334\f\020\n\202\367a\270E\357\035\r\f*;@\r\020D\2070"
+	.ascii	"\270m'\037}\260\206\005,U\310\243\233\211x\202*\361\242\204\205"
+	.ascii	"T\263\257[B!$\3726P '.\216_nsypJ\317O\021\007\377"
+	.text
+	.section	.gnu.lto_.symbol_nodes.711a714ddc4fe18e,"e",@progbits
+	.string	"(\265/\375`\216\003\345\016"
+	.string	"d\025\212\004"
+	.string	""
+	.string	""
+	.string	"\002\"\177!\247\331\257\340"
+	.string	"\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\200\202\202\200\006"
+	.string	""
+	.string	""
+	.string	"\005\027\"\200\204\001"
+	.string	""
+	.string	"\003\005\026#\025$\002$\177%\356\372\2508\002\036\177&\200\200\200\200\004\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\005\022'\201"
+	.string	"\005*( \031\022\032)\037\177*\002!\177+\005\024,/-0.1/\002#\1770\002%\1771\005\034\023\0332&\1773\224\376\230\006\0234\002'\1775\377\377\377\377\00396(\1777\005\b8\001+\1779\037"
+	.string	""
+	.string	"\200\200\200\001)\177:,\177;5\177<4\177=3\177>2\177?.\177@-\177A7\177B8\177C6\177D>\177E=\177F<\177G;\177H:\177I\003\005\033D\003\005\032\344\006\003\n\034d\003\n\032\344\001\003\013\"$\003\013!\013 \033\003\013\037\304\036\003\013\036\304k\003\013\035\344k\003\020"
+	.string	"\"\003\021%\021#\021$\204\001\244\007\003\024\024$\344\001\003\024%\360\204\n\003\026\020\003\001B\003\026*\307\377\241\372\001\001\344\n\003\026)\204\013\003\026(\246\216\343\356"
+	.string	"\001\304\027\003\026(\326\215\307$\001\204\032\003\026'\274\215\210\f\001\204\036\244\204\037\003\026\004\310\242c\003\026&\310f\003\030'd\003\030\342\001"
+	.ascii	"G\2501\fM\265\220\244\205\032;\007\340\002!*\326\001\021\200"
+	.ascii	"\030\3209\024;\022Y$\017cY\373=\013\243\365\251\225J\265\301"
+	.ascii	"?&\207\346\355\266\026\3708\002\0247\376\\\313m\005\303\205+"
+	.ascii	"^\342\210\300\233B\271\353J\277'\255\274\310--y\3117\367\021"
+	.ascii	"\214\360>\020,;\303\213\316\366I\230#\304$d`6\016N\030lW9\252"
+	.ascii	"\264r\242\261\225=\366\267_\245\254\207\245\361}L\273Kz3?;&\242"
+	.ascii	"\n"
+	.text
+	.section	.gnu.lto_.refs.711a714ddc4fe18e,"e",@progbits
+	.string	"(\265/\375`\225\001\245\f"
+	.string	"\246`S3P\211\222t\300?\360\017<3aBUUUE\314\314\314\314\314\3146\243\3434\r^_@"
+	.string	"\2133C\017\263\203X\322l\263\2445k\t\331\2735Bd\n?"
+	.string	"J"
+	.string	"E"
+	.string	"\3477\330\231|\265\322\311\371\256\024\201\030Yo\332\231\004a\206\260\316\332W\352\211\035WoVgVW\331\213m\330\223~S\335Q\037Q\235uT\3374\263^P\017\251_\352\231\364\251\337|\212\020\025><:86420.\360\267P\375\n\212\366)\364\2370!\221~\t\330\035`_\200\375\342|\002\374\210\326\021H\376@\353\017\2227\320\272C\353\r\255\017h\335\322:\245u\350y\t\366\226\377`w\362#\330!\371\f\373\312o"
+	.string	"\f/\274.\340\365"
+	.string	"\257[^\257\274\016Eit\337\270g\334+\367\311Mq~\242t\304u\346~\271\236\256\243\353\215\353*J7J\023v\003\365\027|\b\374\007\365\016\352\t\250\267\250\217\322K\245U\032r>\037a\237\344C\330%\371\r\373\223\357`\363\233[\236\377\360\350\340\330\320\310\300\270\260\250\300>\305D\376\022\371\020\362\037\260\316\200u\005\354/\331#\362\013\3447\3443\344?\366\316{H\345\327\373\254|\363\236\251|\003\037"
+	.ascii	"\331+ |\261\203e`\005\354\201e`\005\354\201e`\005\354m\331\322"
+	.ascii	"Q\3268\351j.\266\360\241%\n\342@0\020\002\342@0\020\002\342@"
+	.ascii	"\260\226\230<c\242BH\272\tf_\r\321\244n7\333I\006"
+	.text
+	.section	.gnu.lto_.decls.711a714ddc4fe18e,"e",@progbits
+	.string	"(\265/\375`\370(\235\257"
+	.string	"z\021\025<Z LAI\351\346\254?\002\225I\265\372\234]\216D\252\t\231q\265l`\0249\262D\025\272\034:\252\356\305|RMi\233\26360`\024<gm\326\216E\374\027\277\272"
+	.ascii	"\207{\374\314\3067|\271\255\337\231\316G/y\006\033\326\273-\217"
+	.ascii	"\243\324fH\322\367\317\251\255{K\231\002$\003\235\003\341\003"
+	.ascii	"\367]l\"1\f'\205\265\274\227\371\326F,\003\303\345\030\2317y"
+	.ascii	"\002\311\222\325\rU\224\0310r\254\316}\213C\317l\350\371\f\255"
+	.ascii	"\341\3478\236\201\345vC\242\0245\333\236\345\230\206;78\205\024"
+	.ascii	"\231k\313\033<{\316e\222\3508\276\320Vg\206\342(\233R\306\324"
+	.ascii	"x\201\263\261\365\205\236\233(\237\205I\303!Z\"\271\332z]\245"
+	.ascii	"q9\331\352\341\302z\242\345\013\255+\r\311\032\177\3416\006\303"
+	.ascii	"^\230\215\325\330\215\235\234\306[\316\\\270KZ\216\221\031\202"
+	.ascii	"$HNW\367\336\020!B\324\244\271\033\327\002\333\036\260\022zF"
+	.ascii	"B\317G\350\317gSlx8{\314\220\305l'\305iKT[\346\016\203\t\331"
+	.ascii	":\203"
+	.string	"\205\257\240`Hd\222m\177V\302\344%<\245\225\0314\022R\226\224\266g\255&WL\234TaqQ-\265\272\356\314\251\271\267\354\307\222\253\260\024\246\302eL\306N\236\302c\347(\034\303-\363^#?\331\272\223\317\266x)\004\310\333\275\367%\376\236\363\024\366b\261\rX\334+\365d\243\005\314\2122\317{\231!B\204\b\261\023\"\004\216\026$\306\264\034\313;'\240\f\205\277\330\311\303a\347&k\275\306\310\274\315{\231:8D3\300\264\264\275\t\250\006R\227\204{@\317<:\035\346\321=\007=\016z\033\364(\3723\376\240;\r\372F-{\320q`\017:\017\370\203\216\237.\177\320y`\262\007\035g\365\234\225x\320!\231\230W\247\315\230\340\346\332>\215\2230\026O=\272P\336\255{\231\0356\224\361Rt\325\366L\376\240C\331\203\316L\315\300\230&\301\004\265L\233h\356\022\177\333\2140\001\013h"
+	.string	"\331=P-\302\002\376z\302\232\211\177\370\253\002~6\361s\002~&\341\347\022~\036AK\223\370\331J\217\370y\255\021\320\007\020q\r\376\332\363\234\277\311F\320!\332"
+	.ascii	"J\377\013\360W\020\376\016\341\357\0024\b!4\001\376\336\300\303"
+	.ascii	"\337I~V\366\216\221W\371O\345?\331\377\262\377S\376\307\200\244"
+	.ascii	"\233\215\001\207\3603\b?\177`,\366\207\377j\377\301\374g\373"
+	.ascii	"\337\345\377\332\3774\246\351\352\013\300\332\303w\376o\320\026"
+	.ascii	"\374,\342)\374\r\307B\232\303u\376\006j\235\177a\032~\336\375"
+	.ascii	"\227\343`\347\374o\353\r\007\361\267\225\277o\376\356\237\345"
+	.ascii	"~6\3633\334\317l?\243\375|\345g\347\317^?7\371\031\353g#?\023"
+	.ascii	"\371y\310\317T?\373\370\271\307\317;~\236\3729\352g\250\237\237"
+	.ascii	"~v\372\231\351\347\344\317+~6\376L\364\263\n~V\361\363\320\317"
+	.ascii	"\304\237Q\360\263\360g\024?\233\340\347\337\317+\374\\\202\237"
+	.ascii	"I\360\177\314\317*\374\\\342g\020\374\234\301\317;?o\370\331"
+	.ascii	"\376\367\362_\312\177,\036\370\371\003?c\340\177\330\317\033"
+	.ascii	"\370\371\304\317\007\370\231\347g\020?s\370Y\347\347\234\237"
+	.ascii	"k\376\273\375\317\362\337\354\377\225\377X\377;\360_\205\377"
+	.ascii	"\026\370o\345\377\315\334\334\334\334\257\003\372u\036~\016\202"
+	.ascii	"\001\314t+\2309&\236\035\022\314\bT\334\273\215\006\315\n\210"
+	.ascii	"\226\027/\275\2062\357\213\335\016\252\243\345\363\313{\315\255"
+	.ascii	"\347\300\210a\265m5\232%9\304\320\332v\332\235:`K\324|8\231\b"
+	.ascii	"\330\221\256\266\247\261\342\342l.|\245\346H\263D\362F\323\003"
+	.ascii	"\r\355do:;;\231e~\220\344hyu\221W\304i\216\350\233JWi+m\326\313"
+	.ascii	"\335\023\243$o\227\t\311\3637\226\267\331?\002\t'\303\271\027"
+	.ascii	"\353\336\273\301\006#@\202\244\265\355+,\206#\003\332\321E\333"
+	.ascii	"\307\035\354\177\r\032D\n\213\"4\240\375\353.\021\362\336\273"
+	.ascii	"D\303\274\310\"\2343\ro\340z{\353\320\275E05\031\320!N\242\032"
+	.ascii	"\355\301=\315\331\275F\251\342\003\244\222F)\032\307\246\324"
+	.ascii	"-\032\201\024; \257T\361\330\274\267\3035\032\213((o\207c\363"
+	.ascii	"&\257\021Z\222/S\252x\215\312\333\341\032/\221\007G\243T\362"
+	.ascii	"\330$Jv86\245\222\267)u9\\#\021\222\205\361\";\334\246\224\230"
+	.ascii	"\333T&9\034\233\312\344\261)\325\3040\034\323f$\277\324\246\234"
+	.ascii	"X\313\321x\225\222\236\210\220\034\316\216L\345U\273\227\267"
+	.ascii	"V\\\344\007\367>)\221jD48\254\350L\251\b\n\221\222\231\367^\020"
+	.ascii	"IES\312k<;Z)\357\265*\372\271I&\212\314\263\333\203\317\2128"
+	.ascii	"\236\256\213\025\367j\220to\221\357\331\275\267x\357\335!\237"
+	.ascii	"\230\367:q8.\223\222\356e\332I\272OE\261\025\367\366\326ZX\362"
+	.ascii	"\330\234R\366\2109i.\357\021\263\310\313\253&\205D\233\305%\327"
+	.ascii	"\305\275\227\341\320e\022\306\230\266\316\236b\265\224K8\340"
+	.ascii	"\254\311\360\265\325\3666\fu6\031\303\245\200\302X\230\267\213"
+	.ascii	"\f\023q\253\025\205\235\035\245\225v\230\267\310\200\265\243"
+	.ascii	"\345\363\"\221\"n\221\214\201)\371\362|k\253\205D+\213+IWo5\224"
+	.ascii	"vvX\177\365\223\366j\261\346bg\203u\363\335\244\235\224P\222"
+	.ascii	"\205\345\265\004\013\206/&0\274qA\002\005\254\231w\376\320\355"
+	.ascii	"\bC{{\336{C\334\2545c\310\202\201m\036kD_\345\320\3278\364\325"
+	.ascii	"\r}\355\202\276^A_\245\240\257a\350\353\026\372\312D_\213\034"
+	.ascii	"\261JRVT\326\226\317\266P\270\272\361Vec\t\004\352-\310\311r"
+	.ascii	"\214\034\256\021H\215\267\253.\322FzH\023ag[\265\020\255\266"
+	.ascii	"\352\345S\207\036fO\034\373\n\205\276:\241\2574\320\327\030\350"
+	.ascii	"k\222\352\307\006\036sL\255\037\177\277\320>Z\251&\354\313\022"
+	.ascii	"\221\266=\200\036S\226\206\362\311\r\252i\331\363Tcy\343\316"
+	.ascii	"]\n\327\310I\215\247%VO\265\r'\032cW9zG\343h\036\255\203\235"
+	.ascii	"=\325\312wTK\355\324\027\270\220X8\226\225\374AwA\227\241\357"
+	.ascii	"0\364\275\205\276\263\320w\021\364\r\004\375\333\251\251\005"
+	.ascii	"&\246\254\266\357\246fb\345\275[90\232\\9\265\355\030-\203\235"
+	.ascii	" z\306\033\251i\234\206\210y\231<\206GQ\262-\207\326\201\256"
+	.ascii	"\340^\006\241\343\2719\006\241\353\245\2367\f\006\370\300\001"
+	.ascii	"C\333\232\004\2613\"vC\007\222\003\035\346\214$\034\375\242\225"
+	.ascii	"\262\222\232\216m\337J\177'\361\223;\263\210\201z\266\305a\017"
+	.ascii	"\272F\352y\273\250aRV\310\265\355n\321F9Qd\230)j\373\022sw\226"
+	.ascii	"\371`.m\304d\270\006\242\2533?\332\210\273X\216\317\266\254\220"
+	.ascii	"\252\2676vQ\037{E\0375\013v\266Q\007WO\244\310P!\343\342\252"
+	.ascii	"\231\023_KV:j\307)G\312\274\232q>\307\220\264\255\317\223m\220"
+	.ascii	"\2731$F\333Jf\206\033\242\266\266\n\267dJNg\313\2230Vc^\341\334"
+	.ascii	"X\310\231+nm\253\230;\321\264-\2473m\353\333\235W_\244jh[\303"
+	.ascii	"T\2678.\257^\270T6\335\027\035\033M\314`\254\275\262\361\240"
+	.ascii	"X=\2248\332\326\264\372\245\317\234\301!\366E\255\335\344X\304"
+	.ascii	"1i\302,]\241\352\322\305\354\365\314\254\242\355\232\275\254"
+	.ascii	"\"C\322\362\212F\303\f]D\2628\305^\311\304\352\025"
+	.string	"\035\231{\213D`\026\251\335#\023O\316\230\032^_V^\257\264\222\361\005&m\353\224Z\005g\t\222\013\255J\245R\255\274\304\255h\353V\313p\256\022"
+	.string	"6P4\276\314\272\320*\205\007\207\206\222\256)2\031bH\260\264\255Q^c\030\203\312!\2455\366\327\354\272\274\324X&Ao\363\343\353\253:/0\"VuU\343U\024\365\002\354\325\311\226\324\243*\306\223'\325\313\004\257%\253\347MS\226\016%]\257^\314\2713\247\266u\253rY\264\2557&\\]\326$\303\350\313\306(+\2536\3311\"\246\352\352\331_NJ\334\224\2746ym\342 [Q\265*\0239\032M\253.he\326%5c\200\324\030k\373\256\311\022\302\256\305\0210Q6K\032~"
+	.ascii	"\351\0279]h|\205u\0359R\2616H\"\346#\253*Ji\f\222W\254;m\224"
+	.ascii	"Z\323\216\266\025\206\032)#F\222SrO]\0308*;\332\276\346H\204"
+	.ascii	"H\215B\n2%\367\214\262R\206)WUU\207\274\032/T\327\022]k3k\023"
+	.ascii	"\362:D\3074\303\217$mk\220\2231\026"
+	.string	"0\263\261\266u\271FE\325k\254\325\001\327\222\325\325\216\n\332\221&,\350}\370\3506\326\272/v>\212Sr<9`\254$\301\005\351Q{0\334\003\266.Q\222gJQ*\354y\221e\":P\235\031i{\364\346\310Qw\370H\2525\230\240T\251:^w4\311\270\224\273.Sgg\235j0\013\330\220ho\317\035W8\274dQ*k\324\016\264\311\tX\226\032\025d\310\224\213/(\250\266\262F\244\215j\265%\003\214\311\323S\267}9Z>\223od7~89\265\025\017\363\026\031\312\355h\371\3341\301\200Q\231\236p\3350\273`\311B\343\225\251\246E\331\022\255m\235\221\343\024\266c\253m\225Q\235hm\305\2665\306\2356iU\230\214\355\210\352\261\036k\222s\324p\264|\332\244/1T\252\213\327d}a\223\305\310\203\255m}\321U\251\"__\324$\034c}a\357%b\026@\016\263"
+	.string	"h\310\250\210\230\350\354urhE\322\005\231\001\013\225\332b\256\306\212\251\332\242\262@\301\245\372\321\266\262\340-8-\276\222D\266\2548;\353\212\236Z\336\2401\366Ds(q\341,C\377jtVc7Y\032\343\305A\265\264\311R2\345k\354\f;\373L%\262E\255\373\302\306\350\f\256L\004N\231%e\276\264\355\271z\331\311A-\326\242\326\305\332p\346\310\031\032\226\350\231\003\035\3171\007\272\353t\240o3\334rrw\246po\224\240n\324\222\326f(\321;y\212M\213y\257\003\346\346\306\030\357%\002\301\206\313\306\213\032\332\222!\323e8\334\242-e\313\034*M\0332\372\371.\223\203E\366V\206\305xd/<\333^\247\024\027\327"
+	.string	"&/\274\331pi\223b%\016\016\356d\226\355h\371D\023sv\266\2306\262F\255[d&%KV\317{\231D\320\004![\362\262\022\346\354\3540\234f\215\314[\\\301\023\223\210\024\374\260\272\032\003\003\246\333\002iP\260\376gD/\005\002\242p\343\001!\024\276\232\024\300_P\020\205p\350\223\223\372\004\207\277\033\023\274_O\b\244\003\364\005\001}x\277\036p\370\223~\370\005\205-\330\024\b\207?\2510h\347\323\003\002Y\023<\340P\030D!L{<\036\207!\020\b\350\363A\340'\035\366$\220A\316\177F\f\241\b\222\330!\022\201>_O7\202\022\"\020\201\0044)\202\303\264\247B/\025r \005R`\bE\360\202\377\214 \376\244=\024$\202\204(P\b}\032\244\020\016\205\204z\274\021\202zi\017\007\350B\220\310\033\002}|\206V\340\201\020\002\246D\336\r1\230\242\307\353"
+	.string	"$\364\365\210A\275!\316\177F\\\300\003\025\350"
+	.string	"\211\024\310\302\260\227zp\002\237\020\350\004\340Px\002\n`JT\321\001\035\340o(\rj \344\303\033\376hR\037p8\024\372\206\277\032_\n\364\301\340\007\374!\006\201V\030\022\362\360C\034\022\372"
+	.string	"$\024F\200G\223\022{B\274\024\310\302\360gC\363\237\021$~@\301\241\025@\244\274\023;\340O\250\002\013C+"
+	.string	"\1775\351\217\007$\244I}\301\037p(\324!H\030L\203D\241\020o\307\202\341O7\374\241)\220\b\034\362|\202?\304\r6)\261\007\244\223\006\r\t}@B\016\277\240\240\017\316}\301!0\b\310\002z\023% \240\204\023)v?a\202\b&\210\240\373\t\023zzL(\241\007}\t=5\355\t\201|hP"
+	.string	"\004\022n\360\371z< \241\356?#\202z@B\037\b\371x\030\006\355R\250\320\245@\275 Q\210\0054\005\215\n\232\024H\004\022y? P\210X\023$\f\022\203-d\220\006\371j\212_\253\370\265\013\277\376\317\210"
+	.string	""
+	.string	"\t\207i\220\320\347\003\034\006\177\204v\275\024\370\223\326\004\211B\273\037\n\037/\005\352\355R^\t=iPp\367\237\021>'"
+	.string	"\002\300\347\004\300\013|\276^\r\220\030\024\006\361\210\275\340\n6\032`\"0\355\375\204\206v)o\204\022iPp\b\375\001S\037\320\004\300!\372\037`\332K\211\030\270\320B\007\211B\365\035\\(\004\034\222H\205\302!\211\233\32474L\211<\025CaJ\f\376\360\200\276\336\020\030$\034\376vR\036\361\003\350\025\240\200\023<\370"
+	.string	"\006(\200\372F\f\201)P\320\207\007$$\221\376\260\020\004\362!\021\024\354\241 \341\033\022I\214\340"
+	.ascii	"\210\"\230\332\024\254\202]\340\024-\264\212\026\272\b\\'\201"
+	.ascii	"\224\331B\244\232\331])\035\251\262\"\212\242\344\226c\210E\352"
+	.ascii	"\322a\344\213\220\244\026\260-d[f\216\256\310\217#\261%\332\206"
+	.ascii	"\252'7\262T\325+S`H+\002\302p(\227\333\031\022Ue\303\322\314"
+	.ascii	"\2414\346\002&#J\326\207Y\fma\220\332\366\3101K\363\242\326\366"
+	.ascii	"8H\224\271\223*\"\265\324\226\331\304y\201E\246\324\026\n\312"
+	.ascii	"\346\250\311a+*\271\362\274L1\224\2679,\216\265\035dU\332\332"
+	.ascii	"(+\305\316\223\331)\235)q7\302\326\320\024\273\223\351\354\r"
+	.ascii	"\026\253hg\250\310\234Y'\353d\237R(\236\330:Z>m\215\333\247\032"
+	.ascii	"9\222\306\261\246\032\025\2011.r0a\355\206"
+	.string	"\020]\321hr\363\204\22147\203\250\267`qQ$\243zu\231f\224S\214\352\3345\341\241\344\306\322R\326\222\t\372\333d\035R\223l#\022\004\331\306\325\304c\312\276\3505\252\343\327\216\2666\311&u\033Z\354\240\314\321\362\352\206\2105Z\243E\212\312\021\213\001\212\221mq\213\364\243\243\n\263\255e\201C&\213\353x\247\234\f\\Um\355\221]a\215nz\2349c\211v\224\225MlJ\356\n\235s\262vf\213\267D:Y\274\320\234\264\265\367N\233/^T\246\264\255s\007;\242E\346\351IN\256\003(KV\001\203\212\250\242\3518\205\322\0342\b\221\210\310H\232$\035\222\n\020\206BI H\256\007\022\240\344T\321A\247fdD$IAA!m\006A@\t\005\007#\317\206\302Y\3138\370\340\303]\272\243g\025\202\355\211\223\207\341GA|\017t\214\366I\211t\017\035\037\306oG\350\251y"
+	.ascii	"a\024Z\343\263-U\233\204\373\317_I7\323P\007 Ag\337\2504\006"
+	.ascii	"o\220x\177c\342\r\202\324\302\310\307\276X@\316\032\340q\027"
+	.ascii	"\357~\265\335 \200"
+	.string	"zq\311\027\266g\366.\245\264\261s\227}\225\212`\r\222Y\306\024\030;\020\322\357\215:\214 \0223d7\237mU\247\355^\321\315\350<\302a\002\231\005U\374\326\fb\314\375H\217\023dt\356\030D:\210@\002\005\250\030Z*\234i!@D\361Sr\306\210\322Y.\034\335\316\372\225\t_Y\372\344\236\363!\317@\t\r\206\365\357KU\257\300)\376\310\350\302\325\275\177\273t"
+	.ascii	"\3772^\326\361\037N\230\247\345\273\357g\303\\\252>\321\013\314"
+	.ascii	"\003\300\203\327\374\2723R\347SZ\352\211\2277\224\0229K5\201"
+	.ascii	"\362oQ\rD\321\325a\211\205\177\013x\253X\205\271\313\202\372"
+	.ascii	"\030-\305\202\0177\261\032\030\033\273)i=\357\322LU\034\004\231"
+	.ascii	"\0250\253m\\S=\262An\257s\031IX%\004\f\204\003\314Cw\203 \f\316"
+	.ascii	"\204\005\242s\316\252\273;\252\204S\227\263\340\375\265\300\364"
+	.ascii	"7M\234t\345J\245\343\032X\007\022\376\237\221\320\346\315o\355"
+	.ascii	",*pU\206\260I\210\266B\377w\343\236!\223\215\275gJD\207*\220"
+	.ascii	"\262\265a<\315t\f\202\217&\377\254\237\353\037\016\320P\315M"
+	.ascii	"Y\377,j\206(\335\250\230\302\270\261W.\325f$1\216\007\332\200"
+	.ascii	"\005\275\026\237!\327\262L\206&\273\024\300\242\310\271\350R"
+	.ascii	"\t\303;@2\241n\354\376\317h\373\025D\200!\353\022\225a\253}\366"
+	.ascii	"F\210\330\350\224\324x\245g\336\276\255\r\345Y\260\245\033\035"
+	.ascii	"oL\366\207.\022x\224\233\360\2279\364q\001p\362\346\023&\b=`"
+	.ascii	"\2467>\030B\360y\220*\364z\355\335\200\366"
+	.string	"\230M\347uYKd\033\2049\233D8/\n~>\371^\200_\374k\372\277\322\2525v\031\207\025\001\200\246$\334\271e\342\264\223\216\275\250\275\251\267\276XF\205\310\342\277^/\020\204a\3133L\262OM\206&\t\251\352^*\227\210\177\345x\324\213h\261#\006\363+\361\355\b\312\177\233\264\346\343\027\\\325I\333)\300\374\311\023*\263\351\311gO\250\016\243aY\303>K\334e\362$\016(\233\007\310\002d\250\022\247\227\222\035\031\301p\325S\202c\262\027&\r\234\263\033\177=\237\362\237T\374<\271[6gv>$e\377\023\243\316a\016\273\362u\f|\027pb\351\250OB\271$2zu\217\304\361\\)\222\032\177<\001Z.\004\357c\306\022\272I]\177?y\362/\267\330\201\257\255\200\025\025Lb\3568&\305b\275\022\364Y\311\277%\344Z\007t\316\306\361f\"U\202\"\353\032\355\017\321\372ti"
+	.string	"\261s\322\375\250\222\331F\361f\244\220d\331\342\2627\222j"
+	.ascii	"\203\267"
+	.string	"\271\fR\245\255O\336\300\302E=K\231\372\027\232\222Hm\304>OH\344f\266\211\277\006\230$K\275\322\f `\232\013\365\3225\206\304\210\032\364\315\351\347'xz,\234\036B\035\n\212\232\214\355\311\240Id\030\255\362\001\363Ja2]\206fq\223\033\240\302\366\023n\005\005\335\350CE\327\321^\365\320\021\242\346i\204\004<L\331\271\276y\362&\302eJt\f\377\0163N0L\216<8\325\f}4\277\255\035[:NI$K\007*\3729S\273D\271V\213?\312q\022\234\307\341\253\350\325\002hd}\256\337g\244\363$\213\025g \262\3158\240YHtB\320\034OY\225\006\217\003Eg\376\nvC\334`tvIl\277\200\224\3444\256\020\346\327\"\322\223\021\301\237\353$D\360\245\212\023\004\324\206\002\270\t\342\375&\221\324\245\253\245\211\224\377\301b\003BB`\231\267\255\022\026W\315c(\370?"
+	.string	"\306!\321\033\200\257\003\003\034\336^\351qN\373\316HH\300\tF;\201\267\006\226\235\365\316S+\341\207\226\215\031\214\222\001\2638\221\370\316\004}\206\325\020\345\357\007\243)\354"
+	.string	"\031;\211v}\017\275]0\373z\241\031IL\242E\277\202\200\345d\031\371\034\366\270\312\\\225)\307\\\001x\310\354\020\372^\363\257lW\b\034\247\316\375Y#\236=\0073\246\230\3313\034g\204\272p\276\f\327\227\207}\235\273e`\356\2347(\207+\025\ru\232_\0237\273H1L\350\0011\366\253"
+	.string	"\367M*\"\317M1\001\263\031\263\006\256\202\323\313-\211\372ft\022\344(\213\346\344\246\276\312\272\375\204\306\256\2079\2135=(\267~\207oy\220\375\004\226\220\343\307KY\260\025\356\007\273\370s\303\370q\t\200v\371\027\022\203\346\327\024-\233g\353w\373\317\352Q\343\345\274\240s1\2413\026TU\036\356\002I\333t>D@\200/\316\353\275\327\305w\376h\213J\230\301\315\347r\004\356\217\007\177\210\020\302&\303w\344\003\374n{\245\220"
+	.string	"\225_3PC\200\342M\362\017\314{\354\342\033Gr\207\266 \3527\360"
+	.ascii	"\322~\312U\241\033\230\007\356E\307\204'\351\216\302\377\fi."
+	.ascii	"\353Y\312\200e\370&\207t\376\333\276b\365'(7Q\365.\".A\346\202"
+	.ascii	"\256\314\001x\f\331\344\266/\321\267\242W\314\223\351or\376\230"
+	.ascii	"qQ\371\270\313!f\236\177\360+tD\347\003\236\231\246\307\366g"
+	.ascii	"\003w\330\364z\354\205\212\334\203pb\261AA;\365\0164~3\253\367"
+	.ascii	"<\274\343q\\@\030\256\361\204y\346VX{y\336\276\013F\226f_Q\374"
+	.ascii	"s\306\262\303\257{1\013\354>\305+W\314I\271\005~\022<\374sm5"
+	.ascii	"\302\374Z\233\323^$\236\362;\234\357\321\301\275\271\375/\372"
+	.ascii	"\366\333K\257\231wo{\340\257\272\337l\247\372\273\246\256r\342"
+	.ascii	"\013\031?i\037#\324\250z\004/\b\233h\036\245p\347\242\230U\031"
+	.ascii	"\245:n\324g\254\211\312\225\370\034Z\264\240\374\021\215\325"
+	.ascii	"\346H\323 odo\311\257\232\310\316\307\354q\203Y\243\344\317D"
+	.ascii	"?A\307\237O`-\020\032\302\365\316\202f\233\322'u\256\333F\254"
+	.ascii	"\326\\\344C>p\301\020\257\370\3515o\036\230C\311sm\277\210\357"
+	.ascii	"\251\203\346\025\350\330\274\277=\257?\340\\9x\026\373K\273\366"
+	.ascii	";(8E\343\345(\231\021*\260n\224\355\347\377\302#\353\324\006"
+	.text
+	.section	.gnu.lto_.symtab.711a714ddc4fe18e,"e",@progbits
+	.string	"ol_filter_reset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\001"
+	.string	""
+	.string	"dr_state"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	" "
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\001"
+	.string	""
+	.string	"ol_filter_reset_position"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\001"
+	.string	""
+	.string	"ol_filter_predict"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\001"
+	.string	""
+	.string	"ol_dt"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\001"
+	.string	""
+	.string	"ol_filter_get_past_state"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\001"
+	.string	""
+	.string	"ol_filter_push_vision"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\001"
+	.string	""
+	.string	"ol_filter_fetch_vision"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\001"
+	.string	""
+	.string	"dr_vision"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\024"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\001"
+	.string	""
+	.string	"ol_filter_correct"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\001"
+	.string	""
+	.string	"ol_filter_correct_altitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\001"
+	.string	""
+	.string	"dr_ekf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\001"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\001"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\001"
+	.string	""
+	.string	"dr_control"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\001"
+	.string	""
+	.string	"dr_fp"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\001"
+	.string	""
+	.string	"ransac_reset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\001"
+	.string	""
+	.string	"ol_ekf_reset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\001"
+	.string	""
+	.string	"ol_ekf_reset_axis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\001"
+	.string	""
+	.string	"ransac_step"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\001"
+	.string	""
+	.string	"ransac_update_buffer_size"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\001"
+	.string	""
+	.string	"atan2_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\001"
+	.string	""
+	.string	"imuGetRotationMatrix"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\001"
+	.string	""
+	.string	"ol_ekf_predict"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\001"
+	.string	""
+	.string	"imuGetEarthAcceleration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\001"
+	.string	""
+	.string	"ransac_shift"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\001"
+	.string	""
+	.string	"ol_ekf_update"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\001"
+	.string	""
+	.string	"ol_ekf_gate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\001"
+	.string	""
+	.string	"ransac_drift"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\002"
+	.string	""
+	.string	"ransac_push"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.711a714ddc4fe18e,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,651 @@
+	.file	"ol_flightplan.c"
+	.section	.gnu.lto_.profile.2d0b0e44ee3b1fd3,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.2d0b0e44ee3b1fd3,"e",@progbits
+	.string	"(\265/\375`\020\001m\006"
+	.ascii	"\302G\035'\2209\215\001\260>|\235[\254\342\353O6\277\026g\374"
+	.ascii	"u\341\200\356\356n\377\022\305\317\027\271\227\240${\245\265"
+	.ascii	"\235\266\f\271\224\205]Q\324G\205\261\200\364\267\376\342\320"
+	.ascii	"\316\220\340)(Y\265\252\033\247\354\"=\353\005\223,\360\001\340"
+	.ascii	"\276\317O\341\303dB\250\323@\370\016\020$\230\311-ea\227\356"
+	.ascii	"\274[%\f\231\326nv\273\363<o\347\203\bqD\032\031\345M* \360\002"
+	.ascii	"\243m\036\020\022ZA0\037\200\240\233\2006\230\210\200\220c\330"
+	.ascii	"\221cf\276\265\2143q1qC\3712b$\340\331r\276\207\350@\370\034"
+	.ascii	"\270565\210\236\245\332\375\027x\253\021lS\016\f\310\366\237"
+	.ascii	"\361a\326\275:\233\311~2\266\013\263\373\223\2125\004"
+	.text
+	.section	.gnu.lto_.ipa_sra.2d0b0e44ee3b1fd3,"e",@progbits
+	.string	"(\265/\375 1=\001"
+	.string	"\330%"
+	.string	"\007"
+	.string	"\001\001\001"
+	.string	"\001\003"
+	.string	"\001"
+	.string	"\001\006"
+	.string	""
+	.string	"\b"
+	.string	"\003\t\n"
+	.string	"\001"
+	.string	"\001"
+	.string	"\004"
+	.ascii	"-QP\002\275\204\261\001,"
+	.text
+	.section	.gnu.lto_.inline.2d0b0e44ee3b1fd3,"e",@progbits
+	.string	"(\265/\375`7"
+	.string	"\355\005"
+	.string	"\002J$/p\211\322\0300\335\026f\016Au!\377\005\300\036\300s\226\266\327\265Z\333\376\354\322Gb\311\177\373\367\362\364]\247_\261-l\022#\215H)S\377;\274T\342\023\341\200\3012\341@ `\262\273R\333]j\312\222\231\217\225FO#C\257hx\3647\024Y\"h8\023H\220i\306\240\201\341\2077\351\337\341E\001 \026<\220|\2752\004\332t\034\253\225.\037-\035\330\335i\374\317\263\312\335]\3511-xo\243\344#\246\n\357m\017\311\2131\022\020"
+	.ascii	"Q\240qX8\210\r@3\005\216b\317W\210]a@&\006\313\231\334\342T@"
+	.ascii	"\376\251`\001\b;\n\361\270\004X\200!"
+	.text
+	.section	.gnu.lto_.jmpfuncs.2d0b0e44ee3b1fd3,"e",@progbits
+	.string	"(\265/\375 z\375\001"
+	.string	"R\204\f\026\260%i\f\347\3600\254h\236\204\016\3030\224\322\032!\230\220-S?\\\330|E[`\003\f\355\224\355\224\332\242H:\222\266\271|\274Qhl\203D\003"
+	.ascii	"7\357\222\234\262\300\240\r"
+	.text
+	.section	.gnu.lto_.pureconst.2d0b0e44ee3b1fd3,"e",@progbits
+	.string	"(\265/\375 \032\321"
+	.string	""
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"\007"
+	.ascii	"\232\004\001\230\004\003\230\004\006\232\004\b\204\004\t\230"
+	.ascii	"\004\n\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.2d0b0e44ee3b1fd3,"e",@progbits
+	.string	"(\265/\375`\f"
+	.string	"\355\003"
+	.string	"B\204\r\027\300%\303\001\377\377\377\377\377\013v\333\233\354\275(!d\257\275eJ\001\352k\273"
+	.ascii	"\247\020sX\230\332\252\242\247mZ1\207\243-\032!gkl-\266&\260"
+	.ascii	"\201\033  \240\202\231;\017\351\f:\244\312\227\337\242v\3349"
+	.ascii	"\306&\037i0\220\\\\\204:D\033\320\275\027\260\240\204\207\255"
+	.ascii	"\033\005{\022\314\240RW\270\206\211\241y\253\205\275\217\260"
+	.ascii	"7d\035(\020\022\300\316\020J\201\207"
+	.text
+	.section	.gnu.lto_.lto.2d0b0e44ee3b1fd3,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_olGates_Registry.20.2d0b0e44ee3b1fd3,"e",@progbits
+	.string	"(\265/\375 \235]\004"
+	.string	"\244\007a"
+	.string	""
+	.string	""
+	.string	"0"
+	.string	"\005\001\212\001\202\200\200\374\342\203\226\217\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\315\006us\345\005uq"
+	.string	"\005\001\006'\001\370\224\004?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\"./src/main/flight/ol_plan.c"
+	.string	"\005"
+	.ascii	"\3352\240\312\3600\213\006Q\344\r\240\b"
+	.text
+	.section	.gnu.lto_pgResetFn_olGates.21.2d0b0e44ee3b1fd3,"e",@progbits
+	.string	"(\265/\375`a\004\365\026"
+	.string	"\266\345\207J\260\022R:\252\030\275\342\002\275`\345BG]L9\334Um\213zv\340\270l\320\365\t\345\347\251\236"
+	.string	" J\327\225\266\323[\255\336mwU~\254?\350?h\003\037\204\315\3318\224\331&\356P\f$\350\205\216V\020\262\345N)m"
+	.string	"m"
+	.string	"z"
+	.string	"'\267*\370\264\237\342*~?\262yI\255AJM\265\016\023\230\305u\322\303\017(O\272nR\236\364\317\266\"\240\363\032\342I\322\252\265\306V\204\351\351\360\246\363w\222\356\374\371\304O\241\216\236\340\315I\372\222*\002\"\t\352\320\005?KR>A\340\244D\302\357\215\237F\305\236\240\360\023\200\203Z\253gOp\303]\336\366\3166\004\233z\b\256\325\360\223\322\346]\311g\027\333,'Z\360\313\311\003\037\264\260p\346\321\036\336\314\025\222*\372i\362\006\331\260\037\375(/\336\364\323\273\323s\247\237\022\300\204I\261\326\f\307!5\212t\032z\361G\262\317\3027&\275\305\357E\025Z\215\017\234\214W\265\016a\\'Q\350O\364\210=\374\212\337\221jh\035A\237P\\\325Z\021\2344\003W9\027j$S$|\233\362\244"
+	.string	"*\247\271(\273\373\035\243\327\rU~\347~\247\004p\036M\367{\343S\236`\360\024\301\231\307\335\237%)\242\2357\267\343\215\210\020\246 Y@\262\026\353\366\343ve\225\343>\230\252|v\241\2327)m\274\307\215\306y\334d7~R\356\210\361(\f'p\370d.\016\345\223\311d^c\353\006J\333\366\0317\246\3333\227q\016\2727\231\302_\004\266\363j\275\031L\017\347\233\305\324$\274j\264\334\254\307\313\331\\\246\255\344f8\232\b8]\2547A\306\206\213\211\345l\263\231\030m\307\213\255\300\254\243\251\355b=\235n\027\033\031\326o\220\311\016Q8\013t\r\2555D\203#\375\304\227\\!\221+\344\026\240\205-\t4\355\363*bU\316\334:\255\265V\272BW)\351\302\266EX\334\001\001\234\307\n'\322\nL\325\232\363\342\031Y\250\221<\253\224\231\231\231$AS\230b\003\220\002\031\2729m\021"
+	.string	"9\004\231\221@\246\242B\017\252\345p\260\311L;\331\224WD\277\231E\001\220\227\245\033=\2318\007K:\raf\312\306\314/\202M\350\033\225\366\233\303\322\215l\346\346\364\306\262Vs\231\200\336\3724m{\371$cT\265e\252\013\3640\334\262\007:T\266\210\002;x\304\3323\205\001\367\230,\251\017[\002k\241\333d\361\340^\254u\311c\263F\313 \352}\0055>y\220\302\006`\254\203;\033\327d\003\004\363^\255\212\276$\367\213p@\216\346\\\347F\t\230'T\374"
+	.ascii	"?\030\177_}\337K\374\356v\270\365\007"
+	.text
+	.section	.gnu.lto_ol_flightplan_load.25.2d0b0e44ee3b1fd3,"e",@progbits
+	.string	"(\265/\375``\020\345G"
+	.string	"\212xT\032<0\242N\007\357N $\031Q\334\234\031\367\311\222\\\234\222qx5\n\262\376\354\303\371\270\356L\016\271\366\026 "
+	.ascii	"\004\200\036\271\252\227\231\347=R\021\254\265gVUyI\3332\245"
+	.ascii	"\224\002\225\001s\001\243\001\206\334n\232\312\314\344\"\035"
+	.ascii	"\207{\016\222\337\240\274^\247\315\333\n\366]T\311\343\365\""
+	.ascii	"-\207\245\"\332\256\032\331\240W\0263\344\206\323\210\314<4C"
+	.ascii	"s\202\225\232\261gO*\266,iJ4!w!3\337\360\224={\262\201iq\217"
+	.ascii	"m\333\216(\302\314\354\365\233\257\375:\332\201=\310L\301%\034"
+	.ascii	"\330t\233f\003\262\024K\315\251mKcb\327\266-\030\333+\326\355"
+	.ascii	"(\345\237\024\013}F\260\220\332\026\r\n\207\002\333k\253\351"
+	.ascii	"5\315\3363\302\236=K\354\251>\266\355\263\253W\206\300\366\352"
+	.ascii	"}=\245\354u\253\243\224\2756\231\tu\037\264\355\250\222\2656"
+	.ascii	"\325\266m\275\236\013s\0223+IqR\337\276\346\246\265\331SRQPO"
+	.ascii	"NMLKJL\252$$v\251\\\357{\223{\251!\013\032\310\366v\326S`\022"
+	.ascii	"\277\270T]Gy]Cy\351'\306\247\227\2135\330\305\235\356\352\030"
+	.ascii	"'\260\031\237\320\373\005\245N\257\013\333\333\336\322\274\311"
+	.ascii	"J3a\201\223\353\245*S\\i\013\034\225f6\032\225\246\272\313#L"
+	.ascii	"\3024\3433\314\255 \371\210\330T)\236d`\013\\\\#Q\373\34212\204"
+	.ascii	"\005.\256\331\273\200QI\235f|\312]\252*\207\2704b\033\300{F\361"
+	.ascii	"%\224V&\275A\351\225\351\315y\261\332\266e\276\035\361{/\254"
+	.ascii	"\311\353\322\210\355K\336\324\356\377\005R\033\357\t\365\357"
+	.ascii	"\302\276{\342\fa\201\263\322\276\324\320\266-;\333\033\\3\200"
+	.ascii	"f\3565\314l\306\334t\025s\364\302\272\020K\377"
+	.string	"m:\201\231\2114!\261\246\273i\236\240\036\244b\005\013\027\203\330 \245\235%\320__\333r\206\311IDjm\213\246u\177\375v\342\245\371$\377\337\367>\316G~\321\177`l\271\32596\376\257g\323\310\275>\376MwS\275(X\230@Q\273c\312~\031\321?j.\311\3141\232q\314J\t\"95m\2536\241\35307\275\264\236\031\253\340\223\250\0305m\333V\310\323\213d\334u\275\262\r\0349\224\275\3667bk\315\031F\356\365\027\300D\201\236\273\232[\261\357\360\224\273\216w\260\034o\266^\271Y\216\262\327\327\363\246\212\b\315'\231\373\322\374\351\230\333\312\r\336\032\277\026f\024a'Lxhi3X\0376\177I\210\320u\232\273\372M3W\0036/h\301\346\255\353\254\340:'\270\316\b\226\316\007\226\316ZK\347\254\245\263\201\2453\326u.p\235\257\226\316\004\256\363\200\353,\340:[]\347"
+	.ascii	"\327\271\352:\003\350i3\325u\236\272\316RK\347(\2453\324u~\272"
+	.ascii	"\316NK\347\246\353\274t\235\225Xg\346uNb\235\221\2563{\235\227"
+	.ascii	"\254\263\362:\257\327\371\262\316\277tv\245s\213"
+	.string	"%=\365T\025j[&\223\215\332\305\025QLO\273\353tK\273\017\273\337t\357u\367u\377u\003v\013v\022s'232H\307\341\345[m|\265x\224QTQ)\354Q\374\222\221S\216\371t\334T\257\205\233\332 \n\031\"\235x\276l\201\217\360m|=Z\350\266\203k\212\026\225\021\376\3047\265\265\3164:\355>\220z\344\r\351\352\227\276\200\235\036K\333\320\321\203\347\211apt3~\206\205\262\327\253o\303?{\016\332\237\300+\361\252P\235r\025\240\222\217\254\177\325\222=b|L#\336\335Yc\265\272\fS\005SW\255J\231\331\265\272\370\311\203rY\357\374\344U\321\224\003\356\234\216O\236\226,`?\340\313\250\004:\023\005\214\3619\226\376]\236\352\025+w\254\376\353\005|\331\224Igb\032\037\256\271\371[\237\356\320\016`\353'\300W\271-\212\342\261*\343T\360\344M\211\233\262A\036\360"
+	.ascii	"z\3154\312f\263z,\265?\343\252\007\360\001\344\300\036\354\253"
+	.ascii	"\376:\372\372\257\007\360D\2464:\361\026<\373`/\300\316\326\257"
+	.ascii	"\377\365)\246P\235vS\317\334\\\343P\024\363\2368\031$\365S"
+	.string	"Q/\365\267\217\363\021\352\243\276\371\034n\254\202\333\342\333\023\352\227g\212z{O\317\274\301\227T\335\224x!\"\247\177jz\247\377>\316\307\376\246o\0217\271\366h\351\231;x\022j\236#\3615GK\034\271]Q\244\364K\314W\372o\363\301\325`p\271\345y\232\2431\177\235\243\352%=s\bo\253\223\217\330 \221>\351\333\321\210n\004\203\313\215\f#I\244_\347\346D\262\317\\\242\253s\362\026)Z>\253\374\245\211>\004c\313\315\016\322\220\362\327\263|\203L\207\r\036c\353\020\032nF\303q\364\020\263\030B\310|\224)\207\264Y\323 #+\373\261\362\f\007<\306t\224\305\320\321\303\013\310\r\0338t\324\360\342\201cl\207\327\f\037?\274\034dq\21722\037^@z\364\360\341\305\354C\353\327B\342m\021\355\323\366\372\214\334\266\305\222\341\361\317'\371\201g}\0236_s\356\312\321\2579G"
+	.ascii	"\332\204\035m\316\001pdcnfi\322y\263q\0176R\340\344\342\332\237"
+	.ascii	"\361Tb/ \2142\361|\241$|\327\267}\026\236\3566d'Q\241T\327\233"
+	.ascii	"\370\216bE\252\200\217\245K\211\356\260t\200\242\030\225\035"
+	.ascii	"\005\277<{\024\231\300\257\204\323\241\316I\360\253\337#\275"
+	.ascii	"=\004\337Q\226>4\314\343\260\224\n\nuD1)\307C\004\277\3729z\352"
+	.ascii	"3\n\030\365t\354N]\335\211\315>\362\311=u\265\204o\343\206:\360"
+	.ascii	"R\236.A\r\265\376\300\267S.-\353\265\276!\345\032\235\212\226"
+	.ascii	"\350\352\244==\035g\275\201\267\212\346QsI\177\223\365T\177\242"
+	.ascii	"pqB\236\262.\350\203\315.\315/M0M0\312^\rh\371%\322\333sz:^\022"
+	.ascii	"2\215\331\342]\315E\210\211}\264\340\333\032\261\331\3074x\230"
+	.ascii	"\326\357\301f\371\334\021\362\255ok\236*\271\276\315D\001\251"
+	.ascii	"\271d\253I\034lkb\006\315\365\036\276\013\373V\245P\235rX\317"
+	.ascii	"\255\350Q\006\355\217u\367\252L"
+	.string	":\323U\n{*\252\367c\351\025\264O\214\t\312\207\330k\223*T6\310\245\247{\304D\361|\251\"|\330\007\201;\250a<\306\220R\252DDD\222$Ik\201\005\304 \007!\262\036\021\3400\246\234\"\"D$IJ\231\346\f+\t!\244*\362\305\365\241\210E.\302\030)\364\246:s\277\r\362:\211+\030-\032^K%\021\377\024\233\243ws4Z\272\252\\\311\n\233\245I\"2\212\327yh[\250\253g\266r,\217E\225\205F\300O\311\027y2\030 \313\215\277Z\332%T\265\344\237;\361@a\330\002\375(\342]t\210%Jh\335\310umZ7}\2172H\214 U\304\242%?\032\006e\t\007\353\225\336_\211\231'\341\223L$\004\004\204\275\027\2420[2 _\361\215=\351\007r\250=/\"\005AM\254\013y\361\225\2558*Y\266\237\222\374\t\317o\3223\363\261\343\t\312\356\373+"
+	.ascii	"Bcb\013\027\217\001\226f\2653P\271\026\301\363\226\344\226D\037"
+	.ascii	"\260\356\367~K\204O\343\255/#\366\251pE\341.u\307\n\005\351\006"
+	.ascii	"%7\200\235\247\273\035[$\204\271\312\201\224\305\374\373\206"
+	.ascii	"\035\032\370\257\324\024\2649y\f\202\306_\302iX!\317"
+	.string	"wX\360`A\036\214\266q\022\020a,\254\305\240\030\254\r\334\343\226i\"\006\340\313b@/\n\327\203\344h\013\017\255\342,\211\247\273A\034\361\221+\305gASJfc\325a\317\261\244Q\344\225\337\343|.Vx\300rB\204b\016\252\353zto\274L\372\362\260\334\371'/\3501\036\036\021\030\026\360es\330\376q\306\036\261\367zL\357\345h\243\236?\360+hQ\256\307\205\2669\t\353Y\r\233\"\t\035QD\233\303\233\273\322\r\027\242\310\352\322/F\320\023P\211\n\230\272B\020h\351\013\277r3\206\006\213\021\364?R\215&\332\323]P\214UU\213\026"
+	.string	"\003\306\243\205\212\035\\0H\326\0253Y\246\031w\247\346\250\262\201\356\031\372aR\002\270\247\245\0314\250C\305\254\252\304\341"
+	.string	"\032\237\351\350\321\323Q\n\036\305\006\301\225,H\242[\261\311\241]\n\204\024E\003\304_\037Z\177a\205/F"
+	.string	"\026/\361\350-\b\350OA\221Y\217\032O\354Q\265\220`\347\020\264Z\221XFEN\301Y\fO\303-\3662\316E\360\220\303H\245\377\024\272U"
+	.ascii	"9\324o*\274?"
+	.text
+	.section	.gnu.lto_ol_flightplan_gate_count.26.2d0b0e44ee3b1fd3,"e",@progbits
+	.string	"(\265/\375 \377\355\006"
+	.string	"2M05Pm\222\016$\243*\n\201\255#Ge\370\203\242\2703^\006\270\026\305\374\216\2657\rV\003\353\217>4\346\354\314,\"\255l\005\304\246b;C`\033i\204\310\024g.\033L\305I\250\254\330i`\320T\013q\243\3018\304\314\365\020/\004[\034\205+v,\353\212\225-\373@\356Y>/\342\373\321m\322\315\030\342\221kVx\037Q\205\356\001T|\\\3517\217{\241\357\224\017\364u\273\027`Ab \2229Q:\311\021\030\242\361c_\271\034\355\300\2364m\"\255\241L\002\304$3\243\245\003T\341T\001\252\360a\024\253\303n=:m\210J2\315SGA\310\314]\246Q\364\327\277\340?\370/\002\t"
+	.ascii	"j\231'3`\2563\230\206P\\\023w#\260\026\"\023w\305\324N2"
+	.text
+	.section	.gnu.lto_update_gate_setpoints.27.2d0b0e44ee3b1fd3,"e",@progbits
+	.string	"(\265/\375`\245\002\225\020"
+	.string	"\326\034iH\340\262(\035\320\n\020\220\005~\205fq\326\354\366\345\335x}\364\364\252\303\365#W=\t\207\351\365$P\315\205\355\257\tP\0268<\353\210\022\017\201 \220\034\314\343t\216\027Rb\0346\005\021\372\370\216O\b\331D\312\224\002T"
+	.string	"K"
+	.string	"X"
+	.string	"W_\300H\220\\\202\2359gvE&N\316T\330~\310'\033\310a\255\t\262f@\304\206\3149\305=\361\323\245\267z\362Q\227#\253\232{a\315\327S`s\023\021`%\343\r\310\231\370\361\234k\210U\214*\2102\347\264\252V4\367w\333\017l3\260\227$<Br$\274Om\016\035\364*\357\242\236Be\203\333e-\370\267\200\216\017\031%b\177\305_\256\3718\366`\232^u\351\233\366]~\237s\004%d\350F\244tg\303P\272,\373\336\334\033[\325 U\207\252\006U-U\275Wk\340\206R5\\rm\013\237\361\\\270\214\306\f\271 \037\233\356\265k\247<\206e"
+	.ascii	"Z04\246\n\"\372\013\313JZ\366\207\357\214\004~\346\234\016bw"
+	.ascii	"\241\2622\032}\227\273%(^\326p\035\327\3029g\003\237\305[\260"
+	.ascii	"\3708\227.\275\274|\227\272\340\314\346z\245t\247\001\036OZD"
+	.ascii	"$\227\024RI\204\311\2602\"a\020[F\"\026q4m\020O\016\270\344\242"
+	.ascii	"b\022aJ%\223\030\202\315\357\215QR\033#AkCx\017\036=\021\276"
+	.ascii	"\3032\223\037\035#I\313\007\264!\232\233+\\[\302q9&\274\347\206"
+	.ascii	"#\324\201kS\370\r\033\265\n\267YfR\033\r\320\0025 0\003\231Y"
+	.ascii	"\215\001*\317\223\tXgH\233\274\264)\367\352\330\032w:C\266B\267"
+	.ascii	"+K\301p\0278\217;\030\021\354\022,w\235!\320v\fQ\026\301p\027"
+	.ascii	"8\216\353\301N\222\3350\327\313P\312\034\020\r@\235l\221\306"
+	.ascii	"8\306<Q\326F\260S'\005\310\375\3036n\213\025\320\035N\276\005"
+	.ascii	"x\035l\344|\351Z\355\321\300\342\036"
+	.text
+	.section	.gnu.lto_ol_flightplan_reset.28.2d0b0e44ee3b1fd3,"e",@progbits
+	.string	"(\265/\375`\331"
+	.string	"\345\t"
+	.string	"\306P?<0\345(\035\200\013\320\b\t\214\217A\223\353}U\330\307|\0073\177\222\200\320\371\001aP#\004\273C\205\315kl6\200X[U\020!Y@b<7\007`\301\002\0304\335m\357\224\002)"
+	.string	"/"
+	.string	"."
+	.string	"\3663\1776\314Y\251}ku\321\032w\267\316\216\177\227\237\377\325\007D\023x\251I\330]K\321t\272\347mk\266\017\354S\004\b>\310C&|\217SW\220\344\305S\237\024pJO+*"
+	.string	"\241\214\331,PN\016\373\231\235([ \323`\331\274\354b\304\002,\214\246|86\304O\\\364\344\242\372\334\244d\034_\266\245fw'\361kd\306\264\250F\215\264E\021\362\242\357\212\301J\023\364\346\266\304E\254B\220\332\335\366p@\035.\264\300uu\364\340\260q\r\025\264u>\325\343\211*\307\300]\210\301\253\243\256\363j\306\332gv\242\0246`\341,m\177\241<\303\005\026\273\241\026\030"
+	.ascii	"j\2317\023\332\217\002O\321-\240\267\rp\007\304\fpx\304WX\033"
+	.ascii	"!\001w\201L\200<\200\273S'f\007\361\2601 \344\031F`\321\205\234"
+	.ascii	",\330\3612\004\270t\213v>\001"
+	.text
+	.section	.gnu.lto_ol_flightplan_run.29.2d0b0e44ee3b1fd3,"e",@progbits
+	.string	"(\265/\375`^\007\005%"
+	.string	"\332A0\016F\200\334\321p\277\334\242B\213\217+~\022Z_;\\\206\035\354\366o\n\210\255\270E\215[\233\253\367#L!ey\306_:\217i\245@I7\242P\004\317\300\256\366\354;x\254~`\r\325,Jl\223\275\267\2242\005\306"
+	.string	"\273"
+	.string	"\335"
+	.string	"\374\036\346\3630\037\307\374\033\363m\314O\231_k>\332\374\223\371&\363\233\371\314\374-\220#\023C FUg,\355\250ag\026#{\334E.\377\273M\326\311q\310+\205\305/\f\322=\277K\226I\324\036\201\251T\325\320\020\r\f2UU\r\354\371\004\351\236"
+	.string	"v\207\356in\020\272\347\243~7\213\304R7\331e\2304SU\325\327A6jq7[ZCO\2639\352{\263\222Z\\\200\0374v\354M\007\333\3221U;\262\252ppm\230\203\321\033{\276`3g%4\001\250\252\212\263\232\3426\013\020\277\330\310Y\255\346N\354\212\315:\331"
+	.ascii	"YU;\230k\017TU=SY\321\330\363\354\377\256\377\016\376\332\204"
+	.ascii	"<\256\261)F\373\027\314\2069\330\267\310;\374\353_\350\236g\237"
+	.ascii	"?\354\030q\230\375{X/]>,\227-f\327\202u\214\335\177\210\005\373"
+	.ascii	"b\257\245\315\202\245\273\026,;\343\376\231Vi\245i\273\256L\253"
+	.ascii	"p\237c\312\214\307\355\337i\251\\\311\2035e\323\250\342\374O"
+	.ascii	"\033\345\312TUU\005_(\2334\361-\262\347Q\374x\251\366\374\376"
+	.ascii	"\320=\267\3171s\316\216A^\276\306\377\212\026\274T_'k\253\322"
+	.ascii	"$lm\251\037)\305]\374\327T\033\310\277\307}\322\"\367H\315?j"
+	.ascii	"~\317\344\363L\276\221\311/b>\021\363\207\230\277c\276\020\363"
+	.ascii	"\203\230\017\324\374\037\346\3730_\307\374\034\007gfAM`\354\030"
+	.ascii	"d\262t\2005-\257\255\2629@]\323\3622\376\213\311\026\326\331"
+	.ascii	"\305\377\364\331\"\270\302\034X\264\177\032\204Q\212\220\270"
+	.ascii	".\026\032\331\025\263\213W.\032\031\2260\365<\245\252\301\001"
+	.ascii	"H\215\362P\302\365\305\247s\235\324\233&$\352\032\327>}\004&"
+	.ascii	"\252\311\302\0012\250A\366F\327\313f\254\247\323\3165\232&\314"
+	.ascii	"Z!l\033\240N\313\224\202\377P\313&\202.\316\235\005jv\215\204"
+	.ascii	"\t\024*\240{\366\264NK\362\214\247m\215\324\233\024\022W^\036"
+	.ascii	"\327\270\346\351^\332\255\271q\315\003\263\260i\320\334z\303"
+	.ascii	"\bI;m[\233m\204Yko\247\335I\341\221\365\302\232!\263e0d\320\240"
+	.ascii	"\001\335\263\326\266+(\306#\207\025;X\030\332\t\262\3349c,eb"
+	.ascii	">\272\213\006\366\354,V<\2150\235R<5A\331\316\244\224b\351\204"
+	.ascii	"\212\020'~>\026%\234\236N\220\360\245xZB\341c\202Z\341S\022\360"
+	.ascii	"\237\212&(\037\213\337\017\312\207C\252\333@\376 \330+\356h\306"
+	.ascii	"\301X\206\322\236}\324{#\t\032!q\035\353:\223u\353\342{}vQ\017"
+	.ascii	"\"\\`z\375s\340\030\007\353a\030\275\336\220D\251%GW\031\333"
+	.ascii	"\272@y\035A\215Q\0275\257{f\2068V^\032\365\221\231\341\326\252"
+	.ascii	"\374\317\003\222\272\250{\311\341\326\312KN\273\b\334\2535O\220"
+	.ascii	"\016\226\3139D\335C\220\360\013\240\356Ji\306S\274\022u\003!"
+	.ascii	"[C\352\241\346\355z\327C\335i\302\254\325\310R\300SKi\306\352"
+	.ascii	"r\327\247\226\022\025J\2732g\247\rU\234\240\006j\2416\275\204"
+	.ascii	"D%\213\006\264\311\361\332\n\200\205\250Q(\005\025cJ\315\314"
+	.ascii	"HIA\n\222\016\300\002\221\231\032\363\021\3004\250\230#4\201"
+	.ascii	"5\324\350\002\002R\251\234\335UP\350\006 \314\257\006\333\220"
+	.ascii	"\303)\252\355\245\t\275U\260n\013\203Ny\375\334(\271J\204\202"
+	.ascii	"\327\025\b\002$r\273\220\331$\212b\353\302=7\002\346Z\301\225"
+	.ascii	"{B\237\332\253\272\321g\261\361\177\356\\\030N\222d\211\372&"
+	.ascii	"\246\236!Fr~\026\240Cj6}\304\270\366)\336\002jqE\177\252\305"
+	.ascii	"!\330\271i\240\245\005O:u\311\260\\/\235\030\213Kl\252\242\352"
+	.ascii	"!\202-\346\202\367&\316<\337\213hC\254\233\377y+\"\225\346u#"
+	.ascii	"\200{\254DbciS\254N\305\rs\373j\221\361!\274\326e\003\230TB\323"
+	.ascii	"\027R&H\361\224\223y\325\256\21320!T\264\314\306S\320\004\231"
+	.ascii	"\331j\232\304\274\224\0029G\320\302z@\202\300TidL\371'\223\031"
+	.ascii	"\355\tjP%El\203\277\322\342?\271|\t\037\275\203\376\001"
+	.text
+	.section	.gnu.lto_update_gate_setpoints.part.0.33.2d0b0e44ee3b1fd3,"e",@progbits
+	.string	"(\265/\375`\035\001\205\n"
+	.string	"VQ@:0\257\322\001$\031\030\031\021\003L<\315\225gT\250\t\253\203\267\2131\322\332\206L\355\300\230\001\333\223\201\rA\304\025\237\021\221D\303\314\243\234\035\022Y\320Z\240dl\262wJ\001."
+	.string	"."
+	.string	"1"
+	.string	"/\325r)\323\005\214\266\273\365tz\\\374\224\233\350\313\322\211\342\363\256\037\254\306\322)\343\362\362\215\313\354\256\0034nz\333\n\266\021\354\253\002\247\276\b\340\364\256\027\240d,\032I\326\344Lyn\337vv\330\334\305k\355\232j-\313Ag \366]#\273\353N\037b{\204a\321fy\263\025\026x\224\223ox\300b\227\204\261!n\022#\031Y\240\303J(JF\363h[b\354\210\217x\024P\355n\202/\362\227\204\377q\352\t\221|)\336x\036\315\367Y\370\300\032zp\340|\r\325\303\321t\352&\004U\217\300\340\207!\254!\020\fk\367\fiVx~\2333e\333`\325\212\355Du\256\222\022\" \260\202\031\253\352\352\346\377\007\3609\237\214\260\226\340\362\302\277\r\334u7@\313c\356\200\314"
+	.string	"\333#\275\202\216\220p\327n\224g\334\235\225\004y\002J\024\206y\341\250\t\213\217X>\247\261\320\220\262g"
+	.ascii	"\270\2753\226\311\346\237@\307"
+	.text
+	.section	.gnu.lto_.symbol_nodes.2d0b0e44ee3b1fd3,"e",@progbits
+	.string	"(\265/\375`l"
+	.string	"\005\007"
+	.string	"D\nh\001"
+	.string	""
+	.string	""
+	.string	"\002\025\177\027\320\231\263\346"
+	.string	"\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\002!\177\030\200\200\200\200\004\271\200\202\202\200 "
+	.string	""
+	.string	""
+	.string	"\005\020\031\201\204\033\177\032\006\027\033\200\003\005\026\034\002\031\177\035\207\262\313\032\200\005\021\036\032\177\037\002\034\177 \035\177!\005 \" "
+	.string	""
+	.string	""
+	.string	"\005\024#\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\022$\005\002%\001\037\177&\377\037"
+	.string	""
+	.string	"\200\200\200\001\036\177'\003\003\001\340\236\212\256\001\001b\003\006\020\204\227\217\242\001\001\304\022\003\006\017\344g\003\t\003B\003\n\""
+	.string	"\030"
+	.string	"\255<j6\232\261\271\206O\345\3163\365\030\301p\371\261\206\033\016C\006\324w^{\342CDe"
+	.ascii	"\316xB\016\264\233\006\315Y\206\200\030\020\\\243|\360\252)\360"
+	.ascii	"\334]\347\030"
+	.text
+	.section	.gnu.lto_.refs.2d0b0e44ee3b1fd3,"e",@progbits
+	.string	"(\265/\375`B"
+	.string	"=\006"
+	.string	"\206\220)$pK\222\016\020\265\252\252\252\252\252\252\252\032\370\b\243\304]\002\3623>\224\253\330\030[k\255\221\335$iR\246\033"
+	.string	"\037"
+	.string	"\""
+	.string	"\334L\177\341V\372\211\273\372\tw\373\210?4\322\\n\304\215p\223{\334\372\233\b\335\215\356\203z\203n\201\356\247>\240\333\251o\272\225\372\324\335z\204\236\265\3041"
+	.string	"\267\323o\002\t\377\205@i\332g`\\\364\267\340\276\002=\005_\002\355\210n\210\276C\367\243\273\241\233\241{\241[!O\207\305\006\371\201\373\301O\350#p;\372\215~A\177\240\3770\3570\277\240W\270\023\277\270\003\013"
+	.ascii	"PY\274L\023\030\362\365Z\216\316, m\003\246\r\206\231P\020\f"
+	.ascii	"E\211xj\240\316"
+	.text
+	.section	.gnu.lto_.decls.2d0b0e44ee3b1fd3,"e",@progbits
+	.string	"(\265/\375`\260\032\225}"
+	.string	"\312\320H-R0PJJ\007\252\272\251\266\352\263\356\362\363\3636vf\020?\243y\306\307\335\337\335\037f\177K\337\317@\f\377\367#\373\2120T\3747o\300\0279G\343\3418\326\241\021\310\351b:\032c\re\354\220\033\360)\346\220v\272? \"\031\373\255\021\"e\nT\002\315\002\330\002v\366Lg\317o\366\354\305\236\313\354\371\212={\331\263\024{^b\2038\313\236\255\254\312C>\0228\304\371\220q\302\266fF\214OM\216\031U\031\023v\351\305\354\213\f\217\331\201\303%f\246\325\363\230\237W\276\302b\370)"
+	.string	"\220\033\252,.\255\322\205"
+	.ascii	"r\202\3215i\365\234\303^\005\033\220\257,H\306\326X\355\247w"
+	.ascii	"\3573\310\326\317`8\f\303\361\033\313\361\034C9\216\277\234o"
+	.ascii	"\340\266\367z\357\322\2063V\233r\004\357\336{\026sc3\236;\322"
+	.ascii	"\242\253\006\274{\327s\027\216c/\2546b\306\275O\253\037\235\232"
+	.ascii	"-=\362\356\275'N\234\bq\342\304\t\037.lA\240~\324\233`?\307\037"
+	.ascii	"|=!\330\273\260\377\300~\003K\202\013\2431T\004\247\361\232#"
+	.ascii	"PU\255\276\205\225\341^\026\341\343h\224E\370.\201M\301\037|"
+	.ascii	"\254\205\2670\324\004\227\235\261\360\330{O\353]\357]\201:\t"
+	.ascii	"\035(\226V\257\302\236\311\016B\354:pk\317&|i4\312&|o\033\304"
+	.ascii	"\037|\235\306\037|\351\345\017\276\024<\344\343\260\243\263\225"
+	.ascii	"!_\323\271^ \t\222\024\251\322j\312`?{\361\227\210\224)\365\274"
+	.ascii	"d\367\256B?.5!Z\255~\345\017>\313C>\n<\374\035\303\211\237M\374"
+	.ascii	"\374\342\\\345\t\374\235\365\177\316\377\274\377\321\237?\301"
+	.ascii	"{\376\036\362?\316\351\274\221\303,\001\327\213\213\370\033\006"
+	.ascii	"N\377\006\362\263\325\224\377p\376\327\341\240\237}~\006\372"
+	.ascii	"\371\347g)Q~\026\342!\016\200\001\340\236\237A0\024~\322\301"
+	.ascii	"C8\371O\303\317I~\036\361\243\277\247\376\366_\356\177\231\333"
+	.ascii	"\377\270\377a\376\247\375\207\373\177\302\317H\032\371\363\362"
+	.ascii	"g\032?G\375\f\365\263\362\347\031?\3278\3623\361\347\031~\226"
+	.ascii	"\301\310\177\240?\375\360\263\326\317W?\347\370Y\352g\033?\277"
+	.ascii	"\370Y\204\237C\370\331\305\317\036\374\234\301\317\030\374l\301"
+	.ascii	"\317\023\374\334\342g\n~\206\340g\243\237\025\370\031\304\317"
+	.ascii	"\"~\026\340\377\213\377.\376\327\371O\367s\212\237\213~.\340"
+	.ascii	"g\002~\036\340\347\020\377G\370\271\377\203\360\337\314\3772"
+	.ascii	"\377\311\374\037\363\377\353?\321\1770\377w\242\321h\364O\227"
+	.ascii	"\277:\300\037@\007\277-YTx\327\331t\363\006\353\211\211\302\244"
+	.ascii	"\214\215}\372\305\276\2374\224w\224Gi*\354\274)\232&:\340\362"
+	.ascii	"\256\323I\244~5\253X\351zS\371\031p\340iz\356\375\272\367\216"
+	.ascii	"\340\241\202c\325\326\352\3354\227\2077\273\271 \\S:\313\232"
+	.ascii	"\024,t;X\304\324\315i\025\332R\370K\257\221c\223\216\331\367"
+	.ascii	"\357\273O\315{o\216\336z\233P=>\3561\023\375>\2342\002\377\325"
+	.ascii	"{\037@s/\227\2226\026\n\332\223\025\211\373\256{\225Bw\275M\346"
+	.ascii	"\030\021%3\213\230*\241\365\016\021\340\216\025\271\314\225H"
+	.ascii	"\225\372\274}\327\313wI\244\212\005\346\372l2\327\2472\350."
+	.string	"\237\312{\327\252 &\331\223\222\231cD\252\230c\317*\241\273\274\312;\3664\304.\237UL\270gU\020s\354\251\212\271$R%4E\311\022\270\033O\304\234a\035\230\313\213c\352\352\251\0314\307\\\237\267\356^&\213\272M\004\356\275z6\353\236zp\032\324\034\016(\033\236\236\274\336{ELAa=\357r\216\031\345yo\024\250\245;\325\200r\235\273HxNY\344\352JE\335;\300\324\275J\276s\367^\345\275\367\327\274Z\357\375\021\304\334\232\232\272\327\031b\352^)\325\242\356m\262\273\264*\346\030\326\363HM\313\330\326\245\261*y\353\326\021i\3321\345\225+u\357e6v\253J\307\032'[f\240\320\256\244Yf~\24451\322\363\264\325\204\266\212\325\365T1\204l\255\355\354LH\231\021f\363\252\241\221\364\222V\322Z\235\244\2174\023\206\266\221.r\256\353,#M\004\354G3\235\212\n\271"
+	.ascii	"\250\375\266\263o2\366-\306\276\303\3307\234}\273\331\277\203"
+	.ascii	"4\2208N\254.3\320zU\003\245v\325cg\b\231)QV?lt\315\301j\225n"
+	.ascii	"]\366\2724\313\264|\264\323\267B\245\336Z};\377\216j\032\335"
+	.ascii	"\243}\246\274h\200zW5U\343\350f\347h\032zG\363h\035=\305\320"
+	.ascii	"\356\321RY\340\276\274\274\265\235\2019ZsC\343\026\307<\363u"
+	.ascii	"\243n\253\306][\333\260\333\352\036\314v\264\237\345ZB\233\016"
+	.ascii	"\270\256{\357\233;7\035 \3247\017\373\246\262\357\032\366\375"
+	.ascii	"d\317t\254\210\333\344!_/\217\3363x\226;\312\230\264\272\323"
+	.ascii	"P\321\037+vyx]\330x\251\201~\245)\223\303p\230N\337Vr\035\316"
+	.ascii	"\3439\375\304q\030\312Qvs\336\201\337\\E\203\027\306hr0\333Z"
+	.ascii	"\363\325\345\356\354\250\315\331~\226Aw\311\244\n\236\212\237"
+	.ascii	"\353\316\034\355g\347\3366\033\266\332\354\270\013GY\207\243"
+	.ascii	"\361\034\031o=\001\303;\301s7\266\026\006\204\332D\001q\326\020"
+	.ascii	"\375\260\025\261\221g\365\364\352=L\220@Yi5\375\321\363\304\305"
+	.ascii	"\304\252\325\324G\352\364E\261\341\312\231VS\036\251\323\347"
+	.ascii	"LY\030\265\324\231\366\360\340\203\307\214\263V\217\226\322\240"
+	.ascii	"\212=\257\004\365\334\2659\373\351\260Q\034)\2164G\013\262\373"
+	.ascii	"TEt\303\335aN\336m\266\241\020Z2\307\325jJ\2256\031J\224V}g\271"
+	.ascii	"\336\261\0353l\200\220\261\3313\221\017\210\211|\367e\261\177"
+	.ascii	"*\225J\265Y\213#A\367b5I;\300,l\205b\317T\270\277\274\353\276"
+	.ascii	"\2446B\\Y\225<U\2244\257P \263\270\271\265\232\326\370\335\360"
+	.ascii	"aF\246e\317_v\255\246\016\r^\247\371\n\303\246\335\300\275\351"
+	.ascii	"(\3179\203\356\222\013\032\274\024\252u\3504?J\241{\213\310m"
+	.ascii	"\315H\231)\215t\231>\245Q\fM\241z\207\020c)T\257a\263\2578\036"
+	.ascii	"3n\232\314\375\250v\317a\004\024s\203\260;\274{\327h\347u\035"
+	.ascii	"\236s\2567\007\317\331\326\232\265\274{\327\233*\031\332\321"
+	.ascii	"\207X\357%\023\341#\307./\314W\207N\232\r+\032\255\366\034\036"
+	.ascii	"\003s\243HT\034\206\266\2344@4\236\320a\322j\303y\0165\2246n"
+	.ascii	"\234M\345\241\346\025\327\352}P\366=:\366=<\333ml\031< rw\366"
+	.ascii	"=3\366=:\373\236\233}oMM\232\336\330[\033\27149\214\211\223\202"
+	.ascii	"j\265\357\372\fC\013h4>u\250\324\221c\203=\027\340\343(\027\340"
+	.ascii	"{\217\3146\2316\3238\374;@U\322\264\314V\373.\343\242\2060f\255"
+	.ascii	"\252|6_\213y\217\371w\032L\223\255)/\373\236k\272\177\347\247"
+	.ascii	"\216\t\364\n\024\373\016\3233\213\266\361\321j\313\331\250^\226"
+	.ascii	"\t\017@\270\bi\271\277\333\332\255\343Px!J\347M\253\r\246\341"
+	.ascii	"\336q\375\226*\305:\256\201\347\275O\035\0074\347\336' \346\022"
+	.ascii	"\314%\324*XM\312|\352{O\373:\376\340\363\271\341\350}\203\334"
+	.ascii	"\027<+Tkgh\257\265\021u)v\225|\325\366\243\231w\257\023\205\317"
+	.ascii	"\235\\\036Y\253\357Euy\227\006\263A\027\252\314\333\226\305\213"
+	.ascii	"\313\302\325&--\213\027\217[\021\035"
+	.ascii	"Q\346\316\316\232\313N\226\215\376r\227\325\325*\0276U\312\035"
+	.ascii	"\230\223-d\320&k3;\203\331{S\262\264\362\225\306\354oh\227\261"
+	.ascii	"\030\376\361\022\303j\323\352\357y*\024-Z\032l\002,Rx\234EK\232"
+	.ascii	"\034\236c\f\355\261v\3560{ii\360n\263\211\342\352\0171h\213\235"
+	.ascii	"m\003\f\272\324\340\335\346Eq\225j=C{\345h\01325\257\006\274"
+	.ascii	"\333t\242H\253\310i\251\321\352\325\032^\035\346\325`\276{y}"
+	.ascii	"R5\277\276\032\254\357\363\336"
+	.string	"\255L\305\242\005\300\336oh\004\032\203G\027~_*B21\005\221\226\222\301\030F\310\3440\005\243&\242\322\0022\232\210C\246\005\032X\001\\\301B\206\2210\251\211\t\21184:\"\233\214\214\\(\036\227\222E\342\017FP\310\244&\221\304\"R\017F\362\310\002\262\367\245\242`\221\tF/\211i\330\224\002\320\351XL\"\tU\b\036\223_*\372\340\005\007#\030%\205J\307`\222D\022\310\200\212\025\220\212L\027\b\217\305\013\200\234\214\305\013\276T\244d4R2\016!\021\233x\2100\272\207\004\366$\201D%c\217\250dL\205/\f\221*\022)<&%\005\177N\306\"\222\232\004\262\370\035\223\3064IHT\0322\005\177IBd\223J,\016\223HB\344\357G\240\222\261\310\347\030\\BR\235\216I\344PI(B\3201\311\022\233\204\216C!\234\202\307c\0051\204I\244\323\b\300\241\244`\221\t\b"
+	.string	"\262\227$6\025\221<\030a"
+	.ascii	"\217I\275\017)\212\222\307\240\261\b\231$\016\213\306\244\020"
+	.ascii	"\231dl\032\201\004\0223H\n\221B\021\224\214BG\032\036\205D\241"
+	.ascii	"\222}\003+\026X\301B\306\357,\"H\021A\n\337YDpt\024\301\212#"
+	.ascii	"\373\025G\351\227\212\216\302$\323\320\200$\022\2040\3060\251"
+	.ascii	"\276\3002Zh\247\026\372\205\026\372H1\204\311!\220\204\f'\340"
+	.ascii	"q\230\324[J*\021\205L\276!\322\230\244&\221\232\216I$\320\b\003"
+	.ascii	"(D\n\036\205\304\3421i\350H\374\311p\362%\231\202C\244Q\311\312"
+	.ascii	"\3509\365\206Hc\222)\370K\n\221\300\235\344\227\020x\321(<\032"
+	.ascii	"%\213\305\243\021O\0229L\002\"\221A\343\016\022(L\0065`*Z\031"
+	.ascii	"\354\304I\246\340o\2104\246I\340\212\243$q\330d\017\001\004\027"
+	.ascii	"\220 \301\205\006\026\251\210\030d2\002\231\212F\311%\245!\023"
+	.ascii	"\f#\3420\030\303\b\351\2104**\221$\024\032\221\275\247^\235V"
+	.ascii	"I\277\236z\245Tz\226k\352\245\336\373\304\\\342\207\271D\217"
+	.ascii	"m\311\023\026\237z\313\243\253\301T\250\217#X\\\351\025\0332"
+	.ascii	"q\232k\267\261k\202D"
+	.string	"\212\0264\252\003\232V\177\342\214\241z\323\352\272\362\244\005\201\356hu\311\222\324\311\316\245\372\205-\241\021\226\367\224\311S'\351\226\r\342\304b\225n\245MX.\354\f\325\001k7\fi\325N\245I\376$\251\0263\225\367*W\003\340\350\200\353\272\316\035D\2673l\377\340\241\003E\214\013\211\331\f/L2\351\021*N6e\360Z\r\362\264H\220T\253\361x\275\316\247R\007\026^\362\352\274\345]\346\025Q/\311[\030\217\254\247ZG\333rG\347\005\215\245p\241R\326jJ\344)\326\277\363\303\241\f\030\2613\233>\237\016\261\322q&\n\231\220#prk\304\354\177_\366;\376tGz\305b\227\352g\344\031\202\037\250\222\0215\005\262\f!cHDdF\264M:2\n\020\b\243i\242\211\245\017\022\300\004A\323I\246\210F$I\222ztU\267\245\367r\244\231\302E\304\225\223\305\323{J\3526$\035"
+	.ascii	"s\342\0252\305\354k\225\300[tu\t1\357`\274\030gN=\325Z\351\233"
+	.ascii	"\"#\350\236`\025\215\270\251\304\262\233B.\352\371\tV\306\031"
+	.ascii	"W\023\237\003\033\037X\247!\306\300\236\334,\032L,\236\355\313"
+	.ascii	"\031+\265\302m\n\022\374\301\320\221HF\b+\201\235\2572\"\371"
+	.ascii	"ml\360\225\373\231\343\256\0025\347j\253\303\316\200N\277\f\314"
+	.ascii	"i\b\030w\030\275.`\276^\335\333\373T,X\353\236\325\"1\247\351"
+	.ascii	"\343\216RS1\210\370>|I\245a\024\355L\252\266\317#\357\220\204"
+	.ascii	"i\364]VaZ\213D\024 A\037\265n\362\013[\202\205:\237?2\321\201"
+	.ascii	"\216\372W\320\243V?\370\020\006\345#c[\235MW\362nJ\334G\005\r"
+	.ascii	"\2602!\206\213G\216\233\333g\360\0276\353\301\006:m\265\022\025"
+	.ascii	"k\3607\033\223c\220\020f\r\03166\367\366\n\nQ\bd\324le\334\236"
+	.ascii	"\261*9P\025\r\006\351\264\251\375\302\213\027\254B\2717\216\362"
+	.ascii	"\213\346\177\032\027\210L\264\323&\231\355Q\364\225\242\215<"
+	.ascii	"\260\340\347v\360\356\356T\037\035\357\213\272\250\315\327\364"
+	.ascii	"\203\303{\315\322\033B\346C\246\246<\350-\304\240\201\017\354"
+	.ascii	"P\250\027\345o\341\261\016<\232u\256\0363Y=\320\030"
+	.string	"\310\313\216\360\244\340\203\235W$k@|\260\217\363\303\371\251\215\227\212Fb\004\260>\017?\305Q\017\361\241\336\246LlN\026\r\274\032\347\237.\f\325\217\"(]l\263\216\273\265}C)\206\224\344\302\207MT\2546\207\f\322\0256,\004\330\275k\324\021\237%\355\361H\017\362\032\\\315p)e\306Lq{\376\346\213\035\320\372\354\004\343\217j#D\227\376\273Z,\003:\304\272\247K\365\260As\334\216\350w\211R\2126\302\036\220\bH\276\222\003\325\017Fd\030\013\351\372\003\300`\007(\340!\234L8\\\317{\t2\362*g\304\004M\376\354\021\032\336\306\236\030\272\362<\026\347\334\361\262k7\333\307\316\227\300\030\224\305Z\237p}\2374\001\316/ )\213-N\273\217\246M,[\024\237%\315\300<\026\244\023F\344S\223\356IX\0254|\370\336\004RmI\243\215\224\301\020CS\377\327\341\031\006\272/"
+	.string	"\240\330gz\316a\b\374\035:\277\212\273\272\022\314P\200\376\t\203\357\300y\365fm,\341@\317\315\240}\346\362\222hOZ\007b"
+	.string	"\006{,\205C|P1\212UX\211\215\241\221\212\212\312\017\230e\004\352\214G\311\330v\236\273Ct\b\360LN\231\021\231 \023\017J+\013\331,\244\213o\r\315uG\212\240\002w`\247\274I\023\347\345\263\334\243\364\300ECy\b\013 R\316\376\r"
+	.ascii	"\236,\372\263\021f\274A'o\200Z\216\307u\b\230Hq\001p\310\311"
+	.ascii	"\026\202\032\377n\177\350\237\305\356@G\260uy\202)&(\217\223"
+	.ascii	"\004\221K<\022Po\354w\346P\352\331\377B\027q\272e\257\215\204"
+	.ascii	"\344\224\232\032optD,;\345\2402b\by{\006x\272\305w2\006\\\361"
+	.ascii	"\005\346[+8\225A\315V\3341\013\332l\200\365\365C\316\0373l\357"
+	.ascii	"35h\313\005\242i\001\214\333g\342\020\370\275W0Q\032T\274H\323"
+	.ascii	"\035%\336\3067\375\211)yI\311\243\323\206V\026\004\215\242\304"
+	.ascii	"\327\230\001>\002\216Yj\354\373bv\006\241\371\207\240\007\341"
+	.ascii	"\016\363_N\244\036\212\364Bv\2104Hy\374\177\233'\205\255\251"
+	.ascii	"\306\363\037\257S.\347\266\001\236\274\177\322\3132;\231\330"
+	.ascii	"\343I\234\314\357\232Z\273\361\n\373\367\361\315\250[\2335\343"
+	.ascii	"\325?\377\330\032\242C\301\315\377\375\316&p\214x\311\374\322"
+	.ascii	"\255r\315\242\310\373\005\207w1\245\276\323x\277\275\215T_\264"
+	.ascii	"\017\310^\017\232\260\341\201\r\251.\024\307\232\253\346\337"
+	.ascii	"$n\0303\351\247d\324\274Az\r^\220u"
+	.ascii	"7\367\321\373?okN\327\026oCu>\234 \007\017\361S\316\317\370Z"
+	.ascii	"\234\n\307V"
+	.text
+	.section	.gnu.lto_.symtab.2d0b0e44ee3b1fd3,"e",@progbits
+	.string	"pgResetFn_olGates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\001"
+	.string	""
+	.string	"dr_fp"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"("
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\001"
+	.string	""
+	.string	"ol_flightplan_load"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\001"
+	.string	""
+	.string	"olGates_SystemArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"x"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\001"
+	.string	""
+	.string	"ol_flightplan_gate_count"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\001"
+	.string	""
+	.string	"ol_flightplan_reset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\001"
+	.string	""
+	.string	"ol_flightplan_run"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\001"
+	.string	""
+	.string	"olGates_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001"
+	.string	""
+	.string	"olGates_CopyArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"x"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\001"
+	.string	""
+	.string	"dr_state"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\001"
+	.string	""
+	.string	"ol_trajectory_build"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\001"
+	.string	""
+	.string	"sqrtf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.2d0b0e44ee3b1fd3,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
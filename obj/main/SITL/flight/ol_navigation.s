@@ -0,0 +1,659 @@
+	.file	"ol_navigation.c"
+	.section	.gnu.lto_.profile.635a32e14cd40f6e,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.635a32e14cd40f6e,"e",@progbits
+	.string	"(\265/\375 \242\205\003"
+	.string	"T\005\226"
+	.string	"\013"
+	.string	"\255\223\340\335\b\026\002"
+	.string	"\002"
+	.string	"\002\001\002\002\002\003\002\003"
+	.string	"\002"
+	.string	"\003\240\342\234\212\n\004\232\244\215\002\004\002\004\002\005\002\001\002\001\005\007\244\231\262\366\005\f\006\002\007\002\006\n\013\376\307\327\353\f\002\f\346\343\325:\r\225\272\224\276\006\016\017\240\342\234\212\n"
+	.string	"\n"
+	.ascii	"?\222\032\034\206\324\335K\0139\325:\233\341\246\314\317\300"
+	.ascii	"ZYl\003X"
+	.text
+	.section	.gnu.lto_.ipa_sra.635a32e14cd40f6e,"e",@progbits
+	.string	"(\265/\375 @%\001"
+	.string	"\2204"
+	.string	"\004"
+	.string	"\001\001\007\001"
+	.string	""
+	.string	""
+	.string	"\001\001\001\013"
+	.string	"\003"
+	.string	"\007"
+	.string	"1\t"
+	.string	"\002*\227s\031+v_\354\330"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.635a32e14cd40f6e,"e",@progbits
+	.string	"(\265/\375 \350\325\003"
+	.string	"BF\025 \220)\351\017\323*k\351\037Z\366>\347\200\314\320Ik\336E\356\256\"\204\020\370\241P%[\356\024+H\276\2413\237\304Z\034eY\017\003\337\324I*\216\306\341\200\300l\373\017\0317i;\340\237\272H[\302\206\023\261m\001\237\270\332\"\370\227\bi[x\363\022\r"
+	.string	"W@\354\nS2a\210\026\020\303"
+	.ascii	"/\034\340z`AP8\205AU\026r\024\2624\025\336\006\260"
+	.text
+	.section	.gnu.lto_.jmpfuncs.635a32e14cd40f6e,"e",@progbits
+	.string	"(\265/\375 c\005\002"
+	.string	"\344\002W"
+	.string	"\004"
+	.string	"\001\001\003\177\002\b\004"
+	.string	""
+	.string	"\002\002\006o\001"
+	.string	""
+	.string	"\001\300\004\001"
+	.string	"\007\001\001\002\002\002\b\002\004\177"
+	.string	"\377\377\377\377\017"
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	"\006"
+	.ascii	";_\004eu\317u`\341\316\266\r`\001"
+	.text
+	.section	.gnu.lto_.pureconst.635a32e14cd40f6e,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\232\004\004\230\004\007\230\004\013\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.635a32e14cd40f6e,"e",@progbits
+	.string	"(\265/\375 \\U\002"
+	.string	"D\003P"
+	.string	"\003\004\001\002\t"
+	.string	"\001\002\n\001\013"
+	.string	"\001\002\013\001"
+	.string	""
+	.string	""
+	.string	"\007\003\002\f"
+	.string	"\001\002\f\001"
+	.string	"\002\r"
+	.string	"\001\002\016\001"
+	.string	"\002\016\013"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006"
+	.string	"\b"
+	.string	"M\005\354\002R\002\2702\241g\364\226\340.\001o"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.lto.635a32e14cd40f6e,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_olNavigationConfig_Registry.19.635a32e14cd40f6e,"e",@progbits
+	.string	"(\265/\375 \235\225\004"
+	.string	"D\ba"
+	.string	""
+	.string	""
+	.string	"0"
+	.string	"\005\001\212\001\206\200\200\374\342\303\246\277\021\001\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\345\007us\366\006uq"
+	.string	"\005\001\006'\001\004\223$?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\"./src/main/flight/ol_navigation.c"
+	.string	"\004"
+	.ascii	")\302\303,\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_olNavigationConfig.21.635a32e14cd40f6e,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001(\005\001\006'\001\310\001?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto_publishSetpoint.25.635a32e14cd40f6e,"e",@progbits
+	.string	"(\265/\375`z\002e\021"
+	.string	"\306\337qG\260XQ:0E\274\034\275(\025V\0052Q\212\0204\321f\312\343\267f\036\305\376Pg\365t\264\335\316N\017q\352\355\210v1\263\355/\027\310a\324\314\270#\326\367\300\227\267\312W:\326 \230\276\226\222O6\221;\245X"
+	.string	"T"
+	.string	"a"
+	.string	"fq\002\005\262\217&\272\325q"
+	.string	"\004\212\224\335\361\364i\230\357\322\276\3557\331q5.\355\256\b\032\332\035]\214\340\373l\371"
+	.string	"\357\263\273"
+	.string	"\357\3232;\312G\027\333\340\tN\r\243\335\005\265\305e\2272\377?/\321rl.I\017v\327\222\226\203\342\326\333>`\033\202\255\0328Wf2\347\277\200w\375\3648)n>\3434\304\226\3638\004L\236\366\351\303\274\317\353\251\347HG\206\314\331\243\215T\026\366\273\335]\353\216}\334o\372x\177S\332\233\322sJwSZ;i\251\322\017"
+	.string	"\200\n\201\242\335\0239+K4y\274\370\370\333\377OSm\013/b!\322\315\207\310\020\240\230\013\t2\025u\253ujc\370\017#\037=\244\221\f\3371\324)\214\355H\325\326\360 \013\221l>v\211\003m\220"
+	.string	"\303gw\031\344\270\016\231\224j\345}J \332\224\231Y\307a\241ow\027\3706~#\364y>=\323jy\237\252([\r\367\251\324RO\225$V\035\\\021fT)\016%X\314\252\025^\210\271V\257\227\b\225\311\252\027\227\030\306R\254pD\312%C#\202\261\017\254\220\306\003\350\nS-P\365\202\201/\006,\202X\275\300\230(\276@\226q\337\255\356x\346\210fz\343O\235\270\304\250\231\324\236\360\242\032\022\256\t\223\023\256\246\302S\233\302\227\030)IR\341H\216x\212\272\035\005/ \020\003\221!S\034S\241\017&\206\245q\031\\\007\341aa\303\360a\231\211H\306v\035\215\221\0050\342Kj\"\025Gf\272@\206qIML8\005C\312i\n\324\206\277!\276\255\245\236+\t\200\367\255%40<O\216\355"
+	.ascii	":{P6F\206%\210\237x\375#\001kp\243\225\001\301\213\313\223\001"
+	.text
+	.section	.gnu.lto_ol_navigation_init.26.635a32e14cd40f6e,"e",@progbits
+	.string	"(\265/\375`\333"
+	.string	"\305\013"
+	.string	"\346\225N@ O]8\243\353AwX\005moZ\203\037\372\022\264\273\206>\031\2174\030\262e\376\271\214\033\216\"\023\336\231\247f\377\275\275"
+	.string	"0"
+	.string	"F\214\220\205\351\317\302F\210\265\0217l\210\021\273\267\224)\005;"
+	.string	"8"
+	.string	"<"
+	.string	"O_C\253 \242\343\303\356\202\027\213\0353\016\021l?\342\217]\342*\b\373\f\nF+\025\273\313\351\203\177\236\037\377\250g\210$\320\363\"dw\235\"\211\301\255\267-\261\375a?A\232\252$F-\374\035\203\001\214\335\020\210\177\341)\216oz\346\003\236\274\370\314\367h\317\256\033\247\325\212\024\230/[\025\246:\260\217\255\226\354Lo\232\3164\215eZ3\235\001y\321\271\3414\206\nr\246\276\206\257\334\362M\316\230eV\b\361\004\246n\335\031\332\005%\231^\004B1=\352X\207\006)D&Fl\252\252\241P\327\355AK\335\324)r\205\371\362\003\256L4\237\327\351.\036\202NC\301|\\g\300\305\303\b\3404^\227\341*\033\0167\361\360W\300\262\341:\337\267\341\"*\360\330j\311"
+	.string	",\214\240\206\346H?\200fS:\nc\2502\301\242I\330\322\366\b\004\030"
+	.ascii	"2\241\001i`\270\b\340:\220\005\214\003\305h^SM#\216\367\3260"
+	.ascii	"\353\246Z\217\213\265\230KD[\202A\356\314(\326\214\021R\335\355"
+	.ascii	"\232\bq\b\373e\bp\351\026\355|\002"
+	.text
+	.section	.gnu.lto_ol_navigation_update.27.635a32e14cd40f6e,"e",@progbits
+	.string	"(\265/\375`A\002\265\022"
+	.string	"\026\241wH\320\362&\035P\006\007c\317P\227"
+	.string	"*\3135x\247\002\b\366\252\017\271Sv\342\307L$5Ry\370\001\255m_J\025\230\304\312\217\306c\215\271\r\037K<\341\340\020\376xqg\320\313\026~\272\255l\255\021\262\267\224)\005a"
+	.string	"Z"
+	.string	"`"
+	.ascii	"7\004N\200\272<\271Iw\031_\322]Zf\377\370\355g~\b\204\215\212"
+	.ascii	" s\316o}.\273\327\311\270*\363S`8\273\327\201a\207K\016\217\361"
+	.ascii	"\244\006\316f$\254\211\005xB8\211\2046\335hr3\002\034\t3\304"
+	.ascii	"\003L0\200\\\350\252!\254\251z\f\346\234V0\304\271Q\267=c"
+	.string	"{\201\255\263-\335\345\327\333\261\341\224C\323\234S\232Z\373\005\323\341\300\331v\346Nm\031\032=h%\242\201\253\355\314\276\315t{\354\3079\347\364\362\330\252&y\320\237Zu\\\365\256ZU\375\022\317\303\322\200\334\23479!\023'c\220\020\261}\265\177\342(d\017\302\340\324\234\"\214\216\346\f`\023Ms\367Q\332Q\024\267ga\276\321]8\211\202\221\214\324]\356\022\350\221C\363\312[8\t5\347T\340\2578\013\225\017t\351\025\213\325]\352\312\245\033&\202h\232S\03157%\326(\035\311^\350(\035C>l\372\3448\217\322}I\326j\223S\323\234\375\241\247`\361\201\334j\321\203\227~1*\254\227V\204\230\213\005\203\311\254\002x\225\342z\265b*\226\326\214\312\265\342\362\372b\026XZ.\025>WK\365\362\255`1_\212\001\277.\260`_\354\365\202}\"\267\3718\227\307\r>\340h[s"
+	.string	"S\244\203\263yq\206\016\001\233\224\222\342\246vx<\240\361pp5\b4\336\206\237'\246\243N\005"
+	.ascii	"\321\020)@m\t\023F\210\234t_\314\350\344\b3 \240\002\221)+\017"
+	.ascii	"CC+J\f\003B\231=\361Z\".\337\2761\n\302\265\244\3379f\356\310"
+	.ascii	"\247K,\355\360,Yjb\035\032\0226pt$\242\273\364\254\270\300\360"
+	.ascii	"\306\222\242\030\n\034\302b[2\262\221\004\217E@h\270g#\036\206"
+	.ascii	"L\372L\332\021\233\212]=\367\024X\354\201Z9/\256m\027\261\030"
+	.ascii	"\035\376\222&\201\350f\005O\212\033`iq5q\006"
+	.text
+	.section	.gnu.lto_ol_navigation_get_setpoint.28.635a32e14cd40f6e,"e",@progbits
+	.string	"(\265/\375`M"
+	.string	"\025\t"
+	.string	"\246Q@80\257\322\001'\036\222x\263\32746x\371*/\005\"\267\r\215\357\346\353H\307,\364\214X\377?YjY\364N\303\300 \227\034N\277$\273\037J\304\036-\331{\313\224\002/"
+	.string	"."
+	.string	"/"
+	.string	"/M\006J\213\366\262\373M\177\037\330.\001.\260]\302\215\253\256*\377!\217\036\030'\236ku\315(\354\256\325s\275nx\333\007\266\021l\273\004-\0273\255\331\337J\241\206\375\270\273k\b\263\255\216P\255\252\276\314t\250\024\224\354V\324`6E\232p\330N\331\032\377\343 )\253\b\276X\366\304I\0366,\273\2330\373\210\310\227]\272#\221\266\313\b\277\342Y\260\264\346C\205o\305\260.\362\317\304\271\314\021(\275w\351\243\266\313\303M\376tF\035w\362\2008\t\317h!\324\315\223\003\210\0135\314\021\347\021\315O\3114;\006\356 \030J\363\324u\245\251\371\366q!,B\016\013R\330\247q\0011\317\001\013"
+	.ascii	"2C\353\004v\373\370\260&\224\315\220<\225MC\331w\327\024-D&\356"
+	.ascii	"\212\251\235d"
+	.text
+	.section	.gnu.lto_.symbol_nodes.635a32e14cd40f6e,"e",@progbits
+	.string	"(\265/\375`4\001\315\b"
+	.ascii	"B\r35`\213\322\001\220\241P7H\337t\036\344\234\214\273-(sNN\020"
+	.ascii	"\023\030\262\364\f\307&I\230\"\234\307\324\226o\033i\326\376"
+	.ascii	"/yR\362\271x\337{o\271e\n\007\340\346\316\3224wv\252\020\036"
+	.ascii	"\035\027\325\\\311\241/\203\324\020\021\231\372\200\261Qa\315"
+	.ascii	"5\230\253]s\245\306\341J\212\t\256,Qpe\007\201\353\341M\2079"
+	.ascii	"\032{8,\260\341\001\rg2\306\264\273\177\354\003\343L3\017C\305"
+	.ascii	"\177A\264\215\022B\227*\376\237\355\203\260\201F \321AH\201\340"
+	.ascii	"\332\221,V\205/\224\311\244\023/M\302\226ga\342\031\"\323\343"
+	.ascii	"z\242\342\312k\210$\2434q\177\355\272\351\212\377es\\K\374\374"
+	.ascii	"[8(\354\356\016`\312\373\377\n\002! \320\002):u\2163\301\230"
+	.ascii	"\321&H\312\331=\336\3614\236w<\257\203\273vA\007t\200.\350\016"
+	.ascii	":w\3102.57\301`~\204\321\n\314\223l\303\341;\315\331\204v\342"
+	.ascii	"\265->\323\215h\203\304\"\366\021\337\340X\276\f"
+	.text
+	.section	.gnu.lto_.refs.635a32e14cd40f6e,"e",@progbits
+	.string	"(\265/\375 iE\002"
+	.string	"\022\006\017\022\2405\351\377\377\377\237\360m\033\241\335\366\022+\245L\001\017,8H\364\226\205\003\310.\352\213l\"?\365\025\246\231fo\020\333Cw\351&\374\352\026\370\324=\374\321\035\360\267/\177 \002"
+	.ascii	"\253B\274P\201\202\002"
+	.text
+	.section	.gnu.lto_.decls.635a32e14cd40f6e,"e",@progbits
+	.string	"(\265/\375`\377\026\255p"
+	.string	"\352\276\250)Q0\224:\032\016\204\231\203\347\315\024\217\002i\t\226\f,\360\264\360\275z\217\025\347\307r\200\307$\024X\021\034\347d\220h\212\2371\r\2770\315/\343\317\252\005\001"
+	.string	"4\356\006\360\017\374\354x\206\236{\212\220\220\204\322/i\"\301'\347\315\376M\244L\001#\002~\002\251\002\353\346\253f\317\234\307\270\366\312G\354`!\343\363\334#\375\266@sqq\333\002=C\245\274E\350\n\261iv\251b\2078\214\b\236+\216uX\211;Q\356\300\335I\277*\320\215[\025\350\267M:\264&\314\264H\217\\\314\302\370\374\267\f3'\304X\235$|\262\031\345\320\276\264\341bK\307\254\230\005\263_6\314.\227\314r\351\262k\313\\n\020\366\305\255{\375\216\211\255Y9\013#C[\311\004\035\327F\022C\313\216\246\221\213\2375\\T:"
+	.string	"\235\253\266A\354\362h\275\334\347\270vY\367*\004d\264\322R\206I\372=B\205\366\b\375\026I\277[\351\277@l\226\363J\271\365\206\317\357\372+Y\331\261_\211LK\351\312\321z<\350\032\256<\360/\025\261\243\005\371t\257m}m\330\257\364o\225]7\313\226\035-E\216\356\265,T\354N\324\226fwk\331\264=\333-\213\266\313\315\262X\276?\254\331\317\265\373\330\335.\214rF\260$\303\200\316U\256\t4"
+	.ascii	"\024\322\257\017_\032\353\b\316@\372\004\322\247H\017@z\022\351"
+	.ascii	"\231k\002=\247+\326\004zn\021:\264E\350\277=\374;e\303T\344\220"
+	.ascii	"R\312^v\257DB\253\325\324\020>\277\256\t4\335\"\264\352?\320"
+	.ascii	"\3175\212<\016G\005u\024?O\360o\317N\t \245\300\213~N\372/\346"
+	.ascii	"\354\377\227\377h\377\327\376g\371\017\346?\333\277E;\322\376"
+	.ascii	"\233\255\217\216\024\377\346\030\340g\242\377p\376\023\361\257"
+	.ascii	"\005\377s?\323\360\257\357_\246\177\227\376\355\375\273\302\277"
+	.ascii	"6\376e\001\371\357\b\377\356\376\325E\375\027\372\331\313\277"
+	.ascii	"P\377\036\3775\376;\303\2778\376\205\341_\247\177\211\377\272"
+	.ascii	"\360\357\215\177[\370\367\202\177\027\370\027\201\177Y\374k\300"
+	.ascii	"\277*\376%\340_\024\377\236\3707\200\177\203\376\005\3727\375"
+	.ascii	"_\302\177#\376\273\371/\302\277\374\357\376\367\362?\356\177"
+	.ascii	"\215\377q\376\227\371\317\374\277\345\177\b\377\303\376\267\370"
+	.ascii	"\037\346\177O\\\\\\\334\317L\377\331\365\017\245\tGCB\301\027"
+	.ascii	"\2537\237\034E\034{D\311Zr\026\033\267\323\322+\3153\267Nb!\371"
+	.ascii	"\324\311\221u\006Hje\305W\213U\001Y\016\267\306\302:Z\"o^cs\316"
+	.ascii	"W<f\232(\371\201\317\237R\311%'\331\207\007k\027S \223L\"\235"
+	.ascii	"}\374\\\305=\226\311\312\023>\\QK\302\360\tC\351lC\021\232\304"
+	.ascii	"Z[\b\005\353\322U\207O>:\213T\337%Sm\226\3638\326\305\375\002"
+	.ascii	"\022\325lvc!\245D\252H\241\025\221\236u,K-Y\212u\030Q\020\207"
+	.ascii	"\315\255\223e\220\236K\223~Y\007S\b\350\316\2243]G\256\341\f"
+	.ascii	"\265d(F\246k\363\230\301\206\313\252\331X\311\243\237\243\316"
+	.ascii	"\310\277\001\352\016\353\356\024Aajnu\370\374\234\365\321\251"
+	.ascii	"\031i\362\371\034\223\364\374\243mLvw\017\236\265\223O@_\236"
+	.ascii	"\335\243\277\304\346\366\200\377gw\214\266\356'^o)\0234\243\326"
+	.ascii	"W\364\301\272\213D\275v\022Y\026\244\210\264b\246\212h\355\256"
+	.ascii	"\023]6\244\221k\220\252S\331\334ko\037\203T\271\200\\\225I\344"
+	.ascii	"\252,\016\365QY\354^\253\206\220Kcq\221eA\252\220e\312*\242>"
+	.ascii	"v\261\313\214]\351QY\205\024\243\254\032B\226\031\253\220\307"
+	.ascii	" UDN\274\222L\331adL\315\226A\036\233jj\313\230\034b\"We\267"
+	.ascii	"u\357\022\252\223\007to)\223m\306\253M{bR=e1*w\355n\024SOB\224"
+	.ascii	"}d\"\233(\273\233<1\365\024\004\305\225\331E\226Y\034\262\325"
+	.ascii	"RP\335\003Lu\027\267\231\335]\354\356\236\344\326\332\215\303"
+	.ascii	"\020\362kj\252\033\313h\252\267\212[\240\272y\271&\255\nY&D\251"
+	.ascii	"\264\345J\331WG\255\305\375\352\266 \311\264\254(\326R\335\275"
+	.ascii	"r\322\257*\033\342\360\271\376\244qa\361\301'\027\317\2705]W"
+	.ascii	"u\322\237\033\256\207\265\2475>\337\300\200\204\025\361c\316"
+	.ascii	"\321\226\271\334/\036\270\334\232W\013:\016\365Q\211\226[w\307"
+	.ascii	"\255\235\275\263F\354\021\273\\\270\255\003\267t`lY\275\271 "
+	.ascii	"*B\246\tt\236\307\3223\225\364<%=\203\245g'\351\371K\016\234"
+	.ascii	"#\246n\b\342\f\214\b\026\316\242\331\266ebQ \205J\234u\333\345"
+	.ascii	"\302Y\"x\355.[8\273f\337\004\361t+{\370\352^]\030\271X*\246\031"
+	.ascii	"\032\364<k\245\313f\333\354\262E\347\323\2479s\n\bc\365\006\206"
+	.ascii	"\002\201\224\"'\275\0349|\265c\315cF\221\250\346Q\320\233#P]"
+	.ascii	"\314\020A\004\303\301`\331\306\252#/}\247G\263\223kHDI\230P\230"
+	.ascii	"\335|\322\310\371\261\004K\337\343\345\306\r\033O\343P\037\211"
+	.ascii	"l\245u\022\013\t5Ce\\\222\024;g\021c6FbkQ\210\312\331\026R\317"
+	.ascii	"\016g8\030\301\347\232\325\250gG\226\331\222\317\367\204i\341"
+	.ascii	"\264\266-\214\026\306\326\205\203x\"\206\317\326\230\271L\254"
+	.ascii	"\241>ji\343\206\206\201`\264\240\"Q\367\0202_iX\r\267\261\020"
+	.ascii	"|\206\207\330%\243a/\3073\214\206\271\354\233eza\0206\306\355"
+	.ascii	"'\315\234%\314\240S\313\335\244xBz@e\r\223\2770\3332\261\326"
+	.ascii	"\356\361s\366E\207J\223\313\260\231]2\363Fk\367\022E\t85M*(\033"
+	.ascii	"\031\2404\035ZQ|\362\230-\013\263c\310\2310\273d1BQ<\330Q\302"
+	.ascii	"'\203\271\233\034E\035;\256v\336\260e\312\030fz\024Lz\364\214"
+	.ascii	"\325R!\334~\220\361!=J\226\036\245\222\036}\222\036\335!\215"
+	.ascii	"\321x\312\300\274\241m\033\237\031#\365\304\347\321$\351\n,l"
+	.ascii	"&$%-\007\263\037D0\302f\306\347\271\3440K\276\246|\bjS\202E\354"
+	.ascii	"\n\217Y\334[\026\237l%\205B\201\264 \361C\013\020->\317V~F\302"
+	.ascii	"e2\304\331\241\303\347\333\326\004\312cJg\262\0372A\270U\341"
+	.ascii	"\023\b}J\277Q\226\217\234\251\034\341*Gh\2275\321\334:\271\205"
+	.ascii	"T\002\rX\033:k\031\2248k`|\262\024\016\343\036~\037\037.Rg\266"
+	.ascii	"\340Hx\231I\342\204O\336\253\241\fv\216\362\373\364\204%\217"
+	.ascii	"X\2360\224\337'gG\f\227\034oh`\323\025\205On\222B\361\260\265"
+	.ascii	"\360Y3\346\346\b\237\347&?+\341%\314D\005\226\322\302\"\202O"
+	.ascii	"\336\201y83\341\257f&\020(\273\215\314D\350\210n\243\320.\213"
+	.ascii	"]\026\247\024!K~@\317\363\200I\357\266&\320\240-B\031\211\322"
+	.ascii	"9\t/Y\206\t\303g\t\036()\221\023\341\"\374\325c&dM\310\006d\022"
+	.ascii	"+E\330\313G\013\316\213\f{\261\016R\230F(l+\211(2#\\\370\314"
+	.ascii	"a\271\360\034A\223F\311\226\020!W;\327\256\222\241\246\221\316"
+	.ascii	"C\325\325\265p\\G\320\032\254\2226\360y\236#\220%\003\3317\030"
+	.ascii	"x)\215\306\004\234$\207\300jv\257!\261\023)eH\272\244?~,\031"
+	.ascii	"\027\227U\023\3652\004\214I\025-\255\300\340\217\370{A\307\304"
+	.ascii	"S}6\004Py\277\236o(l\n\0065\320\361\250<\337p\030\344\021\001"
+	.string	"\235\202~\304\240Pgt\246\027\275]\260I\007\3345\t\001\020\032:\323\013\020J\370\240F\222\352[\032\356\324\025\252\016\306\003-\360\202M4|\303 \r!\034\302 \215\023\2520iIX\304\003:q\240\372\210?@\033\314C\324\001\251:\340\222\220\007\270$\314\371d\370\021O\"\3217\354\365v=8\204A\3369T\205\271\227\3001T\211\277%\037\t:\002z>\340\322\257i\327\323\363\021\235N\236\217\330\363\235\272\353\ruK\302\027A\303\035\023\357\324\to\370JP}D\037\tKB\242N\365-\r\240\002i\234\240\022wM%\206=\2373\275X\372\331"
+	.string	":\r\223x\304\245]\023\007\276^0\004\241\236\256)\310s\303\247\022q\324@\241\376\200?\035"
+	.string	"$\206=\0221\370z\300\017\204\316c\"\376\232Vp\022\n\235\367\033\372\200\276\245\364\020\304h \206\214\030z.c\206\0033\034@/c\206\222\322\214\030J\351c(\345\3243\275\030\372\324\246\237\215\002N\250@^.\206\036\343\350\261\f=>\211\272\245\237\r`\220\206\bM\301"
+	.string	"T]\f\245T\006&\235O\335\ru/\354\200?\252N\206\n\3749\365\020o\350p\360\200>u\327\244\003\006\177\304\337\013D\352\001\252\216h\202\357\306OM\325\fz>u\327\023:\371\020u*\360\027\024\252\276\032MA\2403\2750\340A\241o\230\244\006\203\303\244\037\225\3474T\211\272\246\340P\005\006y:\037o7\364\001\203\303\236\321%\220\200\306\n\023D\350 \345\275"
+	.ascii	"\006\177\352n\351\367\302\016\250k\n&\251LK\277&\033I\300\337"
+	.ascii	"\356F\022oHLz\301\302\206o\370c\022\366\354T\037\223\352\363"
+	.ascii	"#\n{z7x:\265i\327\323#W%\224\266\\\351\374\030\251R\004\222d"
+	.ascii	"\316\250A\034)\"<\366\315U\rpfTH\364N\034+[\246\256N,Y^B\244"
+	.ascii	"|\004e\241\263\024\333\241\343k\311\230\033>\3270\036<\216(s"
+	.ascii	"\030\177\204<\265\361\312!\253H\231CD\215\317\034T\016\312\215"
+	.ascii	"\325\033\230\017kO\260\360y\237\035\271c\356\310\3105Vo\315t"
+	.ascii	"\253\013\017$u\354\330\311\031e\260\261zk\276\341\2225D\316\230"
+	.ascii	"\353\035\230\b\221\3423\327\314q\271\342s\315w\200\216k\256\317"
+	.ascii	"n\343.\213\240]\026<jI\214d\350\371TN\372\264\f\034\234\221\250"
+	.ascii	"&\030\t\"8\370(\003D\235:|\265\0324\017\2537,&\313\341\254-\n"
+	.ascii	"\035:|e\244\314\261\021\013\"\346\007J\226\021\311\001\201\300"
+	.ascii	"\250\2610g\2243\"3#\"\"I\222\244\003\361\004\204 \350\244\205"
+	.ascii	"\335\0210!\224\206hF$I\222\f\373\006e\317\331\201Y\2419k\276"
+	.ascii	"\364\272DRD\335Z\301Sz\031\260Y\246\b\\\303h\\\345\257^\206\312"
+	.ascii	"\260\251\300\314\333LH\274\263\f\001^\305\001\360\004)]\357Q"
+	.ascii	"V\031\200\2005\006{\317\217c\253 \255nW\270HC\340\336\321\300"
+	.ascii	"\357\325\005\373\304\020\376\221H\330up@<:\205\3176|r\001\246"
+	.ascii	"\360\213\036?Z\237\261\311p\177R\260\262\376\330\221\206J\031"
+	.ascii	"\"k\363\033\017\0067\216\200\b\362I\034\334.\032=Ll\3078\210"
+	.ascii	"\231l\006j\252\244m\004Z\214/\366\024*\035Q\302f\225\305\201"
+	.ascii	"\2669})\372\262\337\376\240\251\305%\002\372\213\310\264"
+	.string	"1\311\022\340\357 \313\210-\t\352J\177{\240\337\007\237\227\322\361\361ys\246\007\023.'\n_\035\b\334\2556'\226\320G\371\215\303&\347\n\360\267\016\204)Q\342\227\271\030\374\004#\273\004Ri<\341\271\024\214\342\217\371R0\2760\202\241\030\254\310AJ\2760\201\303\245-=\235\361\321\341\032/\3107\334\036\347biV\243(\315\320\357\221\370\002\002!RA\220\247\230w\353\355{3\273\013\201\316\241\304z$ho\367\207\225\336\302&\2149Hod\357\027+\231\027|WkV\320>Ex\204\303x\371\027\314\361\277\341\346\244@\37549\201\377\2133\037O\016\2344\260\023\323\032q9\236\312\024\301ON\004\323\276\022\260|\n^\201 \340Q\231\021\235\314Mh\214\237\204\032\216\342\005u[\033\354\307\324\354\204\350=\353\320\233\230w\246\255\245\213#V\361[\204\330\302\260\243\207\351\334\243\237\304\251\031\366\321"
+	.string	"*8J\266f\233XMJA\274\237A\240c\360\343C\314eM|z\230\227\372X\2340\217\367\337GpC\216\260b8.\336\277\273\343\177\373\312\035\t\351\307\357\304\206/p\034\210G\b\245\035\206\005G\360@\342\320@\3744\311G\235:\223\006\021\024.l\336l\332\023\004\271\200\t\346\253\377zv\234\315"
+	.ascii	"0\022\300\217c\222\301q@\205\236r\006\362\tJb\322\343W\354\247"
+	.ascii	"\372\033\254\260\b\016\351~\254\313j\211\031\236\376U\366M\307"
+	.ascii	"NAs\232\b\034\200\331@\343\207\341\342\206\233\304\031I_\266"
+	.ascii	")\261\235\334\225\2579\316\231QA\236\002\035\353\306\332\222"
+	.ascii	"u`\257\320\342\263\331\342\211\343$\264\224\314\214\r\224@U\227"
+	.ascii	"\314\267X_\215w&\210\360\307\205\027\230a;\037\303\247\314\366"
+	.ascii	"\2605\tWo\361\224xq\371\203\001\"\210$?\"J\212\302\302C@\"\034"
+	.ascii	"\bX\204\340+\240[S\353Ac\205yn\345\243\213\310\307\231\311\275"
+	.ascii	"OT\002fE\304\354y\020\233\225'\374\267cVf\323\225w\f\361\326"
+	.ascii	"\f(\004\030(\237\301\247\362\234+\376\036\203\242\200\023\225"
+	.ascii	"\001u\327K(\345\373\310.\342\371\207\312\234\310\343\230\346"
+	.ascii	"\341 \001\236\303\3461\031uC\354\261\211t\360>U\364b7.c\031\003"
+	.ascii	"{1\341\260\001\305\017\035$N\003\224>\222w\202\2006\n\246\024"
+	.ascii	"_\334\2612\323K\201\2271o\332]\230\324[\254\366\207pT\272\274"
+	.ascii	"\333,l\343\206\r&\027\346\356)\1777&\037v\333\377\b\3435\374"
+	.ascii	"g\351\225\255\221j\027\210\037\273\021\343\261\215\341\355h\003"
+	.ascii	"\253 #\372\323Y\341y\242\023\364q\366\306\256\355\311\331\316"
+	.ascii	"\325e\354\b5\264?\013\327\362\231\301\317\304U"
+	.text
+	.section	.gnu.lto_.symtab.635a32e14cd40f6e,"e",@progbits
+	.string	"ol_navigation_init"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\001"
+	.string	""
+	.string	"olNavigationConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\001"
+	.string	""
+	.string	"ol_navigation_update"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\001"
+	.string	""
+	.string	"ol_navigation_get_setpoint"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\001"
+	.string	""
+	.string	"pgResetTemplate_olNavigationConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\001"
+	.string	""
+	.string	"olNavigationConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\001"
+	.string	""
+	.string	"olNavigationConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\001"
+	.string	""
+	.string	"dr_control"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\001"
+	.string	""
+	.string	"ol_dt"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\001"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\001"
+	.string	""
+	.string	"dr_vision"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\001"
+	.string	""
+	.string	"ol_control_reset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\001"
+	.string	""
+	.string	"ol_filter_reset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\001"
+	.string	""
+	.string	"ol_flightplan_load"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\001"
+	.string	""
+	.string	"ol_filter_reset_position"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\001"
+	.string	""
+	.string	"ol_control_run"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\001"
+	.string	""
+	.string	"ol_filter_correct"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\001"
+	.string	""
+	.string	"ol_filter_predict"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\001"
+	.string	""
+	.string	"ol_filter_fetch_vision"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.635a32e14cd40f6e,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
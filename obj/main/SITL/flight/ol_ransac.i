@@ -0,0 +1,1165 @@
+# 0 "./src/main/flight/ol_ransac.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "./src/main/flight/ol_ransac.c"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 1 3 4
+# 9 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 3 4
+# 1 "/usr/include/stdint.h" 1 3 4
+# 26 "/usr/include/stdint.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 33 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+# 1 "/usr/include/features.h" 1 3 4
+# 392 "/usr/include/features.h" 3 4
+# 1 "/usr/include/features-time64.h" 1 3 4
+# 20 "/usr/include/features-time64.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 21 "/usr/include/features-time64.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 22 "/usr/include/features-time64.h" 2 3 4
+# 393 "/usr/include/features.h" 2 3 4
+# 489 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 1 3 4
+# 561 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 562 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 563 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 490 "/usr/include/features.h" 2 3 4
+# 513 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h" 1 3 4
+# 11 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 2 3 4
+# 514 "/usr/include/features.h" 2 3 4
+# 34 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 2 3 4
+# 27 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 28 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 29 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+
+# 31 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+typedef unsigned char __u_char;
+typedef unsigned short int __u_short;
+typedef unsigned int __u_int;
+typedef unsigned long int __u_long;
+
+
+typedef signed char __int8_t;
+typedef unsigned char __uint8_t;
+typedef signed short int __int16_t;
+typedef unsigned short int __uint16_t;
+typedef signed int __int32_t;
+typedef unsigned int __uint32_t;
+
+typedef signed long int __int64_t;
+typedef unsigned long int __uint64_t;
+
+
+
+
+
+
+typedef __int8_t __int_least8_t;
+typedef __uint8_t __uint_least8_t;
+typedef __int16_t __int_least16_t;
+typedef __uint16_t __uint_least16_t;
+typedef __int32_t __int_least32_t;
+typedef __uint32_t __uint_least32_t;
+typedef __int64_t __int_least64_t;
+typedef __uint64_t __uint_least64_t;
+
+
+
+typedef long int __quad_t;
+typedef unsigned long int __u_quad_t;
+
+
+
+
+
+
+
+typedef long int __intmax_t;
+typedef unsigned long int __uintmax_t;
+# 141 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 1 3 4
+# 142 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/time64.h" 1 3 4
+# 143 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned long int __dev_t;
+typedef unsigned int __uid_t;
+typedef unsigned int __gid_t;
+typedef unsigned long int __ino_t;
+typedef unsigned long int __ino64_t;
+typedef unsigned int __mode_t;
+typedef unsigned long int __nlink_t;
+typedef long int __off_t;
+typedef long int __off64_t;
+typedef int __pid_t;
+typedef struct { int __val[2]; } __fsid_t;
+typedef long int __clock_t;
+typedef unsigned long int __rlim_t;
+typedef unsigned long int __rlim64_t;
+typedef unsigned int __id_t;
+typedef long int __time_t;
+typedef unsigned int __useconds_t;
+typedef long int __suseconds_t;
+typedef long int __suseconds64_t;
+
+typedef int __daddr_t;
+typedef int __key_t;
+
+
+typedef int __clockid_t;
+
+
+typedef void * __timer_t;
+
+
+typedef long int __blksize_t;
+
+
+
+
+typedef long int __blkcnt_t;
+typedef long int __blkcnt64_t;
+
+
+typedef unsigned long int __fsblkcnt_t;
+typedef unsigned long int __fsblkcnt64_t;
+
+
+typedef unsigned long int __fsfilcnt_t;
+typedef unsigned long int __fsfilcnt64_t;
+
+
+typedef long int __fsword_t;
+
+typedef long int __ssize_t;
+
+
+typedef long int __syscall_slong_t;
+
+typedef unsigned long int __syscall_ulong_t;
+
+
+
+typedef __off64_t __loff_t;
+typedef char *__caddr_t;
+
+
+typedef long int __intptr_t;
+
+
+typedef unsigned int __socklen_t;
+
+
+
+
+typedef int __sig_atomic_t;
+# 28 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wchar.h" 1 3 4
+# 29 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 30 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 3 4
+typedef __int8_t int8_t;
+typedef __int16_t int16_t;
+typedef __int32_t int32_t;
+typedef __int64_t int64_t;
+# 35 "/usr/include/stdint.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 3 4
+typedef __uint8_t uint8_t;
+typedef __uint16_t uint16_t;
+typedef __uint32_t uint32_t;
+typedef __uint64_t uint64_t;
+# 38 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+
+typedef __int_least8_t int_least8_t;
+typedef __int_least16_t int_least16_t;
+typedef __int_least32_t int_least32_t;
+typedef __int_least64_t int_least64_t;
+
+
+typedef __uint_least8_t uint_least8_t;
+typedef __uint_least16_t uint_least16_t;
+typedef __uint_least32_t uint_least32_t;
+typedef __uint_least64_t uint_least64_t;
+
+
+
+
+
+typedef signed char int_fast8_t;
+
+typedef long int int_fast16_t;
+typedef long int int_fast32_t;
+typedef long int int_fast64_t;
+# 71 "/usr/include/stdint.h" 3 4
+typedef unsigned char uint_fast8_t;
+
+typedef unsigned long int uint_fast16_t;
+typedef unsigned long int uint_fast32_t;
+typedef unsigned long int uint_fast64_t;
+# 87 "/usr/include/stdint.h" 3 4
+typedef long int intptr_t;
+
+
+typedef unsigned long int uintptr_t;
+# 101 "/usr/include/stdint.h" 3 4
+typedef __intmax_t intmax_t;
+typedef __uintmax_t uintmax_t;
+# 10 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 2 3 4
+# 2 "./src/main/flight/ol_ransac.c" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/float.h" 1 3 4
+# 3 "./src/main/flight/ol_ransac.c" 2
+
+# 1 "./src/main/flight/ol_ransac.h" 1
+       
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h" 1 3 4
+# 4 "./src/main/flight/ol_ransac.h" 2
+
+# 1 "./src/main/common/time.h" 1
+# 18 "./src/main/common/time.h"
+       
+
+
+
+
+# 1 "./src/main/platform.h" 1
+# 18 "./src/main/platform.h"
+       
+# 105 "./src/main/platform.h"
+# 1 "./src/main/target/common_fc_pre.h" 1
+# 18 "./src/main/target/common_fc_pre.h"
+       
+
+
+
+
+
+#pragma GCC diagnostic ignored "-Wsign-conversion"
+# 106 "./src/main/platform.h" 2
+# 1 "./src/main/target/SITL/target.h" 1
+# 20 "./src/main/target/SITL/target.h"
+       
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long int ptrdiff_t;
+# 214 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long unsigned int size_t;
+# 329 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef int wchar_t;
+# 24 "./src/main/target/SITL/target.h" 2
+
+# 1 "./src/main/common/utils.h" 1
+# 18 "./src/main/common/utils.h"
+       
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 21 "./src/main/common/utils.h" 2
+# 96 "./src/main/common/utils.h"
+
+# 96 "./src/main/common/utils.h"
+static inline int16_t cmp16(uint16_t a, uint16_t b) { return (int16_t)(a-b); }
+static inline int32_t cmp32(uint32_t a, uint32_t b) { return (int32_t)(a-b); }
+# 106 "./src/main/common/utils.h"
+void * memcpy_fn ( void * destination, const void * source, size_t num ) asm("memcpy");
+# 26 "./src/main/target/SITL/target.h" 2
+# 152 "./src/main/target/SITL/target.h"
+uint32_t SystemCoreClock;
+
+
+extern uint8_t eepromData[32768];
+
+
+
+
+
+
+
+typedef enum
+{
+    Mode_TEST = 0x0,
+    Mode_Out_PP = 0x10
+} GPIO_Mode;
+
+typedef enum {RESET = 0, SET = !RESET} FlagStatus, ITStatus;
+typedef enum {DISABLE = 0, ENABLE = !DISABLE} FunctionalState;
+typedef enum {TEST_IRQ = 0 } IRQn_Type;
+typedef enum {
+    EXTI_Trigger_Rising = 0x08,
+    EXTI_Trigger_Falling = 0x0C,
+    EXTI_Trigger_Rising_Falling = 0x10
+} EXTITrigger_TypeDef;
+
+typedef struct
+{
+  uint32_t IDR;
+  uint32_t ODR;
+  uint32_t BSRR;
+  uint32_t BRR;
+} GPIO_TypeDef;
+
+
+
+typedef struct
+{
+    void* test;
+} TIM_TypeDef;
+
+typedef struct
+{
+    void* test;
+} TIM_OCInitTypeDef;
+
+typedef struct {
+    void* test;
+} DMA_TypeDef;
+
+typedef struct {
+    void* test;
+} DMA_Channel_TypeDef;
+
+uint8_t DMA_GetFlagStatus(void *);
+void DMA_Cmd(DMA_Channel_TypeDef*, FunctionalState );
+void DMA_ClearFlag(uint32_t);
+
+typedef struct
+{
+    void* test;
+} SPI_TypeDef;
+
+typedef struct
+{
+    void* test;
+} USART_TypeDef;
+# 234 "./src/main/target/SITL/target.h"
+typedef struct
+{
+    void* test;
+} I2C_TypeDef;
+
+typedef enum
+{
+  FLASH_BUSY = 1,
+  FLASH_ERROR_PG,
+  FLASH_ERROR_WRP,
+  FLASH_COMPLETE,
+  FLASH_TIMEOUT
+} FLASH_Status;
+
+typedef struct {
+    double timestamp;
+    double imu_angular_velocity_rpy[3];
+    double imu_linear_acceleration_xyz[3];
+    double imu_orientation_quat[4];
+    double velocity_xyz[3];
+    double position_xyz[3];
+} fdm_packet;
+typedef struct {
+    float motor_speed[4];
+} servo_packet;
+
+void FLASH_Unlock(void);
+void FLASH_Lock(void);
+FLASH_Status FLASH_ErasePage(uintptr_t Page_Address);
+FLASH_Status FLASH_ProgramWord(uintptr_t addr, uint32_t Data);
+
+uint64_t nanos64_real(void);
+uint64_t micros64_real(void);
+uint64_t millis64_real(void);
+void delayMicroseconds_real(uint32_t us);
+uint64_t micros64(void);
+uint64_t millis64(void);
+
+int lockMainPID(void);
+void simulatorPoll(void);
+void lockstepAdvance(void);
+# 107 "./src/main/platform.h" 2
+# 1 "./src/main/target/common_fc_post.h" 1
+# 20 "./src/main/target/common_fc_post.h"
+       
+
+# 1 "./src/main/build/version.h" 1
+# 18 "./src/main/build/version.h"
+       
+# 32 "./src/main/build/version.h"
+extern const char* const targetName;
+
+
+extern const char* const shortGitRevision;
+
+
+extern const char* const buildDate;
+
+
+extern const char* const buildTime;
+# 23 "./src/main/target/common_fc_post.h" 2
+# 108 "./src/main/platform.h" 2
+# 24 "./src/main/common/time.h" 2
+
+# 1 "./src/main/pg/pg.h" 1
+# 18 "./src/main/pg/pg.h"
+       
+
+
+
+
+# 1 "./src/main/build/build_config.h" 1
+# 18 "./src/main/build/build_config.h"
+       
+# 24 "./src/main/pg/pg.h" 2
+
+typedef uint16_t pgn_t;
+
+
+typedef enum {
+    PGRF_NONE = 0,
+    PGRF_CLASSIFICATON_BIT = (1 << 0)
+} pgRegistryFlags_e;
+
+typedef enum {
+    PGR_PGN_MASK = 0x0fff,
+    PGR_PGN_VERSION_MASK = 0xf000,
+    PGR_SIZE_MASK = 0x0fff,
+    PGR_SIZE_SYSTEM_FLAG = 0x0000
+} pgRegistryInternal_e;
+
+
+typedef void (pgResetFunc)(void * , int );
+
+typedef struct pgRegistry_s {
+    pgn_t pgn;
+    uint16_t size;
+    uint8_t *address;
+    uint8_t *copy;
+    uint8_t **ptr;
+    union {
+        void *ptr;
+        pgResetFunc *fn;
+    } reset;
+} pgRegistry_t;
+
+static inline uint16_t pgN(const pgRegistry_t* reg) {return reg->pgn & PGR_PGN_MASK;}
+static inline uint8_t pgVersion(const pgRegistry_t* reg) {return (uint8_t)(reg->pgn >> 12);}
+static inline uint16_t pgSize(const pgRegistry_t* reg) {return reg->size & PGR_SIZE_MASK;}
+# 70 "./src/main/pg/pg.h"
+extern const pgRegistry_t __pg_registry_start[];
+extern const pgRegistry_t __pg_registry_end[];
+
+
+extern const uint8_t __pg_resetdata_start[];
+extern const uint8_t __pg_resetdata_end[];
+# 185 "./src/main/pg/pg.h"
+const pgRegistry_t* pgFind(pgn_t pgn);
+
+void pgLoad(const pgRegistry_t* reg, const void *from, int size, int version);
+int pgStore(const pgRegistry_t* reg, void *to, int size);
+void pgResetAll(void);
+void pgResetInstance(const pgRegistry_t *reg, uint8_t *base);
+
+# 191 "./src/main/pg/pg.h" 3 4
+_Bool 
+# 191 "./src/main/pg/pg.h"
+    pgResetCopy(void *copy, pgn_t pgn);
+void pgReset(const pgRegistry_t* reg);
+# 26 "./src/main/common/time.h" 2
+
+
+typedef int32_t timeDelta_t;
+
+typedef uint32_t timeMs_t ;
+
+
+
+
+
+typedef uint32_t timeUs_t;
+
+
+
+static inline timeDelta_t cmpTimeUs(timeUs_t a, timeUs_t b) { return (timeDelta_t)(a - b); }
+
+
+
+
+
+typedef struct timeConfig_s {
+    int16_t tz_offsetMinutes;
+} timeConfig_t;
+
+extern timeConfig_t timeConfig_System; extern timeConfig_t timeConfig_Copy; static inline const timeConfig_t* timeConfig(void) { return &timeConfig_System; } static inline timeConfig_t* timeConfigMutable(void) { return &timeConfig_System; } struct _dummy;
+
+
+typedef int64_t rtcTime_t;
+
+rtcTime_t rtcTimeMake(int32_t secs, uint16_t millis);
+int32_t rtcTimeGetSeconds(rtcTime_t *t);
+uint16_t rtcTimeGetMillis(rtcTime_t *t);
+
+typedef struct _dateTime_s {
+
+    uint16_t year;
+
+    uint8_t month;
+
+    uint8_t day;
+
+    uint8_t hours;
+
+    uint8_t minutes;
+
+    uint8_t seconds;
+
+    uint16_t millis;
+} dateTime_t;
+
+
+
+# 77 "./src/main/common/time.h" 3 4
+_Bool 
+# 77 "./src/main/common/time.h"
+    dateTimeFormatUTC(char *buf, dateTime_t *dt);
+
+# 78 "./src/main/common/time.h" 3 4
+_Bool 
+# 78 "./src/main/common/time.h"
+    dateTimeFormatLocal(char *buf, dateTime_t *dt);
+
+# 79 "./src/main/common/time.h" 3 4
+_Bool 
+# 79 "./src/main/common/time.h"
+    dateTimeFormatLocalShort(char *buf, dateTime_t *dt);
+
+void dateTimeUTCToLocal(dateTime_t *utcDateTime, dateTime_t *localDateTime);
+
+
+
+
+# 85 "./src/main/common/time.h" 3 4
+_Bool 
+# 85 "./src/main/common/time.h"
+    dateTimeSplitFormatted(char *formatted, char **date, char **time);
+
+
+# 87 "./src/main/common/time.h" 3 4
+_Bool 
+# 87 "./src/main/common/time.h"
+    rtcHasTime(void);
+
+
+# 89 "./src/main/common/time.h" 3 4
+_Bool 
+# 89 "./src/main/common/time.h"
+    rtcGet(rtcTime_t *t);
+
+# 90 "./src/main/common/time.h" 3 4
+_Bool 
+# 90 "./src/main/common/time.h"
+    rtcSet(rtcTime_t *t);
+
+
+# 92 "./src/main/common/time.h" 3 4
+_Bool 
+# 92 "./src/main/common/time.h"
+    rtcGetDateTime(dateTime_t *dt);
+
+# 93 "./src/main/common/time.h" 3 4
+_Bool 
+# 93 "./src/main/common/time.h"
+    rtcSetDateTime(dateTime_t *dt);
+# 6 "./src/main/flight/ol_ransac.h" 2
+
+
+
+
+
+
+struct dronerace_ransac_struct
+{
+
+  float dt_max;
+
+
+  int buf_index_of_last;
+  int buf_size;
+
+
+  int iteration;
+  
+# 23 "./src/main/flight/ol_ransac.h" 3 4
+ _Bool 
+# 23 "./src/main/flight/ol_ransac.h"
+      busy;
+  
+# 24 "./src/main/flight/ol_ransac.h" 3 4
+ _Bool 
+# 24 "./src/main/flight/ol_ransac.h"
+      pending;
+
+
+  float corr_x;
+  float corr_y;
+  float rate_x;
+  float rate_y;
+  float fit_time;
+  timeUs_t fit_time_us;
+  int fit_cnt;
+};
+
+extern struct dronerace_ransac_struct dr_ransac;
+
+
+
+extern void ransac_reset(void);
+extern void ransac_update_buffer_size(void);
+extern void ransac_push(float time, float x, float y, float mx, float my, timeUs_t time_us);
+extern 
+# 43 "./src/main/flight/ol_ransac.h" 3 4
+      _Bool 
+# 43 "./src/main/flight/ol_ransac.h"
+           ransac_step(void);
+extern void ransac_shift(float corr_x, float corr_y, float rate_x, float rate_y, float fit_time);
+extern 
+# 45 "./src/main/flight/ol_ransac.h" 3 4
+      _Bool 
+# 45 "./src/main/flight/ol_ransac.h"
+           ransac_drift(float time, float *drift_x, float *drift_y);
+# 5 "./src/main/flight/ol_ransac.c" 2
+# 1 "./src/main/flight/ol_filter.h" 1
+       
+
+
+
+
+
+# 1 "./src/main/flight/ol_navigation.h" 1
+# 18 "./src/main/flight/ol_navigation.h"
+       
+# 28 "./src/main/flight/ol_navigation.h"
+typedef struct olNavigationConfig_s {
+    uint16_t nav_rate_hz;
+    uint8_t vision_latency_ms;
+} olNavigationConfig_t;
+
+extern olNavigationConfig_t olNavigationConfig_System; extern olNavigationConfig_t olNavigationConfig_Copy; static inline const olNavigationConfig_t* olNavigationConfig(void) { return &olNavigationConfig_System; } static inline olNavigationConfig_t* olNavigationConfigMutable(void) { return &olNavigationConfig_System; } struct _dummy;
+
+
+typedef struct olSetpoint_s {
+    float phi_cmd;
+    float theta_cmd;
+    float psi_cmd;
+    float alt_cmd;
+    timeUs_t updatedAt;
+} olSetpoint_t;
+
+void ol_navigation_init(void);
+void ol_navigation_update(timeUs_t currentTimeUs);
+const olSetpoint_t *ol_navigation_get_setpoint(void);
+# 8 "./src/main/flight/ol_filter.h" 2
+
+struct dronerace_vision_struct
+{
+  int cnt;
+  float dx;
+  float dy;
+  float dz;
+  timeUs_t time;
+};
+
+
+extern struct dronerace_vision_struct dr_vision;
+
+struct dronerace_state_struct
+{
+
+  float time;
+
+
+  float x;
+  float y;
+  float z;
+
+
+  float vx;
+  float vy;
+  float vz;
+
+
+  float psi;
+};
+
+extern struct dronerace_state_struct dr_state;
+extern float ol_dt;
+
+extern void ol_filter_reset(void);
+extern void ol_filter_reset_position(void);
+
+
+
+
+
+extern void ol_filter_predict(timeUs_t currentTimeUs);
+extern 
+# 51 "./src/main/flight/ol_filter.h" 3 4
+      _Bool 
+# 51 "./src/main/flight/ol_filter.h"
+           ol_filter_correct(void);
+extern void ol_filter_push_vision(float dx, float dy, float dz, timeUs_t time);
+extern void ol_filter_fetch_vision(void);
+extern 
+# 54 "./src/main/flight/ol_filter.h" 3 4
+      _Bool 
+# 54 "./src/main/flight/ol_filter.h"
+           ol_filter_correct_altitude(float altitude);
+extern 
+# 55 "./src/main/flight/ol_filter.h" 3 4
+      _Bool 
+# 55 "./src/main/flight/ol_filter.h"
+           ol_filter_get_past_state(timeUs_t time, struct dronerace_state_struct *past);
+# 6 "./src/main/flight/ol_ransac.c" 2
+
+
+struct dronerace_ransac_buf_struct
+{
+
+  float time;
+  timeUs_t time_us;
+
+
+  float x;
+  float y;
+
+
+  float mx;
+  float my;
+};
+
+struct dronerace_ransac_buf_struct ransac_buf[20];
+
+struct dronerace_ransac_struct dr_ransac;
+
+
+static float fit_t[20];
+static float fit_x[20];
+static float fit_y[20];
+static uint8_t fit_idx[20];
+static int fit_count;
+static int fit_n_samples;
+static float fit_start_time;
+static timeUs_t fit_start_time_us;
+
+
+static float best_err_x, best_err_y;
+static float best_x[2], best_y[2];
+
+static uint32_t ransac_seed;
+
+
+static uint32_t ransac_rand(void)
+{
+  ransac_seed ^= ransac_seed << 13;
+  ransac_seed ^= ransac_seed >> 17;
+  ransac_seed ^= ransac_seed << 5;
+  return ransac_seed;
+}
+
+void ransac_reset(void)
+{
+  int i;
+  for (i=0; i<20; i++) {
+    ransac_buf[i].time = 0;
+    ransac_buf[i].time_us = 0;
+    ransac_buf[i].x = 0;
+    ransac_buf[i].y = 0;
+    ransac_buf[i].mx = 0;
+    ransac_buf[i].my = 0;
+  }
+  dr_ransac.dt_max = 1.0;
+  dr_ransac.buf_index_of_last = 0;
+  dr_ransac.buf_size = 0;
+
+  dr_ransac.iteration = 0;
+  dr_ransac.busy = 
+# 68 "./src/main/flight/ol_ransac.c" 3 4
+                  0
+# 68 "./src/main/flight/ol_ransac.c"
+                       ;
+  dr_ransac.pending = 
+# 69 "./src/main/flight/ol_ransac.c" 3 4
+                     0
+# 69 "./src/main/flight/ol_ransac.c"
+                          ;
+
+  dr_ransac.corr_x = 0;
+  dr_ransac.corr_y = 0;
+  dr_ransac.rate_x = 0;
+  dr_ransac.rate_y = 0;
+  dr_ransac.fit_time = 0;
+  dr_ransac.fit_time_us = 0;
+  dr_ransac.fit_cnt = 0;
+  fit_start_time = 0;
+  fit_start_time_us = 0;
+
+  ransac_seed = 2463534242u;
+}
+
+
+static int get_index(int element)
+{
+  int ind = dr_ransac.buf_index_of_last - element;
+  if (ind < 0) { ind += 20; }
+  return ind;
+}
+
+void ransac_update_buffer_size(void)
+{
+  int i;
+
+
+  dr_ransac.buf_size = 0;
+  for (i=0; i<20; i++ )
+  {
+    float mt = ransac_buf[get_index(i)].time;
+    if ((mt == 0) || ((dr_state.time - mt) > dr_ransac.dt_max))
+    {
+      break;
+    }
+    dr_ransac.buf_size++;
+  }
+}
+
+
+static void fit_line(const float *v, const uint8_t *idx, int n, float *p)
+{
+  float st = 0, sv = 0, stt = 0, stv = 0;
+  int i;
+
+  for (i=0; i<n; i++)
+  {
+    const float t = fit_t[idx[i]];
+    st += t;
+    sv += v[idx[i]];
+    stt += t * t;
+    stv += t * v[idx[i]];
+  }
+
+  const float det = n * stt - st * st;
+  if (det > 1.19209289550781250000000000000000000e-7F || det < -1.19209289550781250000000000000000000e-7F)
+  {
+    p[1] = (n * stv - st * sv) / det;
+  }
+  else
+  {
+
+    p[1] = 0;
+  }
+  p[0] = (sv - p[1] * st) / n;
+}
+
+
+static float fit_error(const float *v, const float *p)
+{
+  const float cap = 1.0f * 1.0f;
+  float err = 0;
+  int i;
+
+  for (i=0; i<fit_count; i++)
+  {
+    const float e = v[i] - (p[0] + p[1] * fit_t[i]);
+    const float e2 = e * e;
+    err += (e2 < cap) ? e2 : cap;
+  }
+  return err;
+}
+
+
+static void fit_inliers(const float *v, float *p)
+{
+  int n = 0;
+  int i;
+
+  for (i=0; i<fit_count; i++)
+  {
+    const float e = v[i] - (p[0] + p[1] * fit_t[i]);
+    if (e < 1.0f && e > -1.0f)
+    {
+      fit_idx[n++] = i;
+    }
+  }
+
+  if (n >= 2)
+  {
+    fit_line(v, fit_idx, n, p);
+  }
+}
+
+static void start_fit(void)
+{
+  int i;
+
+  ransac_update_buffer_size();
+
+
+  if (dr_ransac.buf_size <= 4)
+  {
+    return;
+  }
+
+  const struct dronerace_ransac_buf_struct *newest = &ransac_buf[get_index(0)];
+
+  fit_count = dr_ransac.buf_size;
+  fit_n_samples = (int)(fit_count * 0.4f);
+  if (fit_n_samples < 2)
+  {
+    fit_n_samples = 2;
+  }
+
+  for (i=0; i<fit_count; i++)
+  {
+    const struct dronerace_ransac_buf_struct* r = &ransac_buf[get_index(i)];
+    fit_x[i] = r->x - r->mx;
+    fit_y[i] = r->y - r->my;
+    fit_t[i] = r->time - newest->time;
+    fit_idx[i] = i;
+  }
+
+
+  fit_start_time = newest->time;
+  fit_start_time_us = newest->time_us;
+
+  best_err_x = 3.40282346638528859811704183484516925e+38F;
+  best_err_y = 3.40282346638528859811704183484516925e+38F;
+  dr_ransac.iteration = 0;
+  dr_ransac.busy = 
+# 211 "./src/main/flight/ol_ransac.c" 3 4
+                  1
+# 211 "./src/main/flight/ol_ransac.c"
+                      ;
+}
+
+void ransac_push(float time, float x, float y, float mx, float my, timeUs_t time_us)
+{
+
+  dr_ransac.buf_index_of_last++;
+  if (dr_ransac.buf_index_of_last >= 20)
+  {
+    dr_ransac.buf_index_of_last = 0;
+  }
+  ransac_buf[dr_ransac.buf_index_of_last].time = time;
+  ransac_buf[dr_ransac.buf_index_of_last].time_us = time_us;
+  ransac_buf[dr_ransac.buf_index_of_last].x = x;
+  ransac_buf[dr_ransac.buf_index_of_last].y = y;
+  ransac_buf[dr_ransac.buf_index_of_last].mx = mx;
+  ransac_buf[dr_ransac.buf_index_of_last].my = my;
+
+
+  dr_ransac.pending = 
+# 230 "./src/main/flight/ol_ransac.c" 3 4
+                     1
+# 230 "./src/main/flight/ol_ransac.c"
+                         ;
+}
+# 241 "./src/main/flight/ol_ransac.c"
+
+# 241 "./src/main/flight/ol_ransac.c" 3 4
+_Bool 
+# 241 "./src/main/flight/ol_ransac.c"
+    ransac_step(void)
+{
+  int step;
+
+  if (!dr_ransac.busy)
+  {
+    if (!dr_ransac.pending)
+    {
+      return 
+# 249 "./src/main/flight/ol_ransac.c" 3 4
+            0
+# 249 "./src/main/flight/ol_ransac.c"
+                 ;
+    }
+    dr_ransac.pending = 
+# 251 "./src/main/flight/ol_ransac.c" 3 4
+                       0
+# 251 "./src/main/flight/ol_ransac.c"
+                            ;
+    start_fit();
+    if (!dr_ransac.busy)
+    {
+      return 
+# 255 "./src/main/flight/ol_ransac.c" 3 4
+            0
+# 255 "./src/main/flight/ol_ransac.c"
+                 ;
+    }
+  }
+
+  for (step=0; (step < 20) && (dr_ransac.iteration < 100); step++)
+  {
+    float px[2], py[2];
+    int k;
+
+
+    for (k=0; k<fit_n_samples; k++)
+    {
+      const int j = k + ransac_rand() % (fit_count - k);
+      const uint8_t tmp = fit_idx[k];
+      fit_idx[k] = fit_idx[j];
+      fit_idx[j] = tmp;
+    }
+
+    fit_line(fit_x, fit_idx, fit_n_samples, px);
+    fit_line(fit_y, fit_idx, fit_n_samples, py);
+
+    const float err_x = fit_error(fit_x, px);
+    if (err_x < best_err_x)
+    {
+      best_err_x = err_x;
+      best_x[0] = px[0];
+      best_x[1] = px[1];
+    }
+    const float err_y = fit_error(fit_y, py);
+    if (err_y < best_err_y)
+    {
+      best_err_y = err_y;
+      best_y[0] = py[0];
+      best_y[1] = py[1];
+    }
+
+    dr_ransac.iteration++;
+  }
+
+  if (dr_ransac.iteration < 100)
+  {
+    return 
+# 296 "./src/main/flight/ol_ransac.c" 3 4
+          0
+# 296 "./src/main/flight/ol_ransac.c"
+               ;
+  }
+
+  fit_inliers(fit_x, best_x);
+  fit_inliers(fit_y, best_y);
+
+  dr_ransac.corr_x = best_x[0];
+  dr_ransac.rate_x = best_x[1];
+  dr_ransac.corr_y = best_y[0];
+  dr_ransac.rate_y = best_y[1];
+  dr_ransac.fit_time = fit_start_time;
+  dr_ransac.fit_time_us = fit_start_time_us;
+  dr_ransac.fit_cnt++;
+  dr_ransac.busy = 
+# 309 "./src/main/flight/ol_ransac.c" 3 4
+                  0
+# 309 "./src/main/flight/ol_ransac.c"
+                       ;
+
+  return 
+# 311 "./src/main/flight/ol_ransac.c" 3 4
+        1
+# 311 "./src/main/flight/ol_ransac.c"
+            ;
+}
+
+
+
+void ransac_shift(float corr_x, float corr_y, float rate_x, float rate_y, float fit_time)
+{
+  int i;
+
+  for (i=0; i<20; i++)
+  {
+    struct dronerace_ransac_buf_struct* r = &ransac_buf[i];
+    if (r->time == 0)
+    {
+      continue;
+    }
+    r->x -= corr_x + rate_x * (r->time - fit_time);
+    r->y -= corr_y + rate_y * (r->time - fit_time);
+  }
+
+  if (dr_ransac.busy)
+  {
+
+    const float dt = fit_start_time - fit_time;
+    for (i=0; i<fit_count; i++)
+    {
+      fit_x[i] -= corr_x + rate_x * (fit_t[i] + dt);
+      fit_y[i] -= corr_y + rate_y * (fit_t[i] + dt);
+    }
+    best_x[0] -= corr_x + rate_x * dt;
+    best_x[1] -= rate_x;
+    best_y[0] -= corr_y + rate_y * dt;
+    best_y[1] -= rate_y;
+  }
+
+  if (dr_ransac.fit_cnt > 0)
+  {
+    const float dt = dr_ransac.fit_time - fit_time;
+    dr_ransac.corr_x -= corr_x + rate_x * dt;
+    dr_ransac.rate_x -= rate_x;
+    dr_ransac.corr_y -= corr_y + rate_y * dt;
+    dr_ransac.rate_y -= rate_y;
+  }
+}
+
+
+
+
+
+
+
+# 361 "./src/main/flight/ol_ransac.c" 3 4
+_Bool 
+# 361 "./src/main/flight/ol_ransac.c"
+    ransac_drift(float time, float *drift_x, float *drift_y)
+{
+  if (dr_ransac.fit_cnt == 0 || dr_ransac.buf_size <= 4 || (dr_state.time - dr_ransac.fit_time) > dr_ransac.dt_max)
+  {
+    return 
+# 365 "./src/main/flight/ol_ransac.c" 3 4
+          0
+# 365 "./src/main/flight/ol_ransac.c"
+               ;
+  }
+
+  *drift_x = dr_ransac.corr_x + dr_ransac.rate_x * (time - dr_ransac.fit_time);
+  *drift_y = dr_ransac.corr_y + dr_ransac.rate_y * (time - dr_ransac.fit_time);
+  return 
+# 370 "./src/main/flight/ol_ransac.c" 3 4
+        1
+# 370 "./src/main/flight/ol_ransac.c"
+            ;
+}
@@ -0,0 +1,736 @@
+	.file	"ol_ransac.c"
+	.section	.gnu.lto_.profile.cbbee09680497265,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.cbbee09680497265,"e",@progbits
+	.string	"(\265/\375`]\002\005\n"
+	.string	"\242I%,pm:\374\001\374\t\330\360p\231\340\tI\325\217O\034\334e\205\353?W\237\253_\321\253^\240\343\307\021{\251\221\275\367nk;\311\035\022s\235\350m\3329!H\321\362\023S\023n,\206\254p\217\373^\327{a1H\222\022\341\036g\023|D\276\201 "
+	.string	"\300\362=n\213\"\260L\003\002\272\252\\\211B]\247\302\327Vjmc\372\333\365\366\365\375\303\035\223\357BM\223\236\236\372\364[uT\031\275c\256\023\275\356\317\317\377}y\371L\307\217\007#79\025\001Y\250A\312`&1he\230\003`\202RSt\036\021\020\265R\020\311\314\320\342\026\306c\212P\225\037H\256\201\356{k6\023\310\255\261r\225\217\026\324J\217\016\031\253H\221S\314\337\027\343\367\273F/c\245\371S\307\255\257J\332\245\276\353\361N\346\371\206\205v_\276\320\023\327X\343i\342\311\2367\311\021F~\206\225\364\2114StX\t_v\n}E\t\271[\\\315\264)\356\202\354i\235\372@\301u"
+	.ascii	"b<\217o\361\254\005vR.S^h\247\326\013\272\205`\016m\031\005s"
+	.ascii	"\3373\317 \314\224\004\375\202\324\334E\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.cbbee09680497265,"e",@progbits
+	.string	"(\265/\375 \207\r\002"
+	.string	"T\002{"
+	.string	"\t"
+	.string	"\004"
+	.string	"\001\002\002"
+	.string	"\001"
+	.string	"\001\005"
+	.string	"\001\013"
+	.string	"\001\r\023\006\001\024"
+	.string	"\003\027\005\001\030\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\013"
+	.string	".d\300"
+	.string	"\202\222\b0\024eQ\016\201\235\204]\002\002\031\001\235l"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.cbbee09680497265,"e",@progbits
+	.string	"(\265/\375`\276"
+	.string	"%\t"
+	.string	"\002\317780\257\322\030\340>\255M\272\030]\316\005\274`\033\222\266\247\n\030\224\312&L\311)\312\260\214\017\f`"
+	.string	"\001\347` \202,\324\301K`b5\360\274~xW5B\266\334)k\254\2040\314wz2v\244<t3\\\265\204 \314\361\246*\024{\311\320\233#\241\330\353\326\033\371\034\250\275\324l\013\314ofl\214,\322\344\233\037%\250\231\264(8\350\250\307\3562t\264\265\273\233\r2\022\303%\"\215\276\231\2104\202x\340\342\002\202*\261\032L\250\022\213s\300\177yOM \350\023\241/==\201\240\217\302\033\007\376\034\250\375\232\355\357TD&\222`R)\030\212\203\256\302\341\252HX_\223kO\350\356\256\256+\305<\355n\346=j\222\211+\211\371\023\250T\371\364\250J&\256\026\036`9\006\034"
+	.ascii	"\035\253\024R\301\001\344a\004,\230\001\310l\r\254j\035\310\233"
+	.ascii	"`$EnG\200\352\200\006\342D!@\300\f\264\007\260}\024c\260\232"
+	.ascii	"\213A7\016\274B7\272]`M\3265@X\334^\034\324\300\020"
+	.text
+	.section	.gnu.lto_.jmpfuncs.cbbee09680497265,"e",@progbits
+	.string	"(\265/\375`\315"
+	.string	"]\006"
+	.string	"\322J &\200\247I\00730/\364\264(D\206\031\230\013=7\300\004@\f\364\214\304\243\212\2100\013c!\316oO,\3312\311\2747\302o\006\t\"\272(`\3033\334 FB\027g\255\265\346\203\352w\203\030\016A\215\031\250%g\251\275\360\nw2Uj\211\\\004\222\336A\364J!\031@\002\220\005y\374\022\357\373Q\377\250\316\006\251\221\327\004\361\004M\362\222q\267\336\361\355\275\243\307\236\365\216\376\023\023\334!\036"
+	.string	"8\202I!\031+\304\346B\b^(\364C\026\004\326"
+	.string	"\312A\301\030\006\204\310h\364Y,+<\320\224"
+	.string	"\345\240`]"
+	.string	"\002\364\315Y\006\224\253\263\020(WNQ\013&\270.F\034X\005z#U\022\311,\260"
+	.ascii	"C"
+	.text
+	.section	.gnu.lto_.pureconst.cbbee09680497265,"e",@progbits
+	.string	"(\265/\375  \001\001"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"\232\004\002\231\004\005\230\004\013\230\004\r\231\004\023\230"
+	.ascii	"\004\024\231\004\027\232\004\030\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.cbbee09680497265,"e",@progbits
+	.string	"(\265/\375`\335"
+	.string	"U\007"
+	.ascii	"2\212\035%\200\265I\0073`v\314\244\326=\202&h4(\212\242(\021"
+	.ascii	"H{\315\314\336\214*Dl\004\013\337\276%D\312\024\377\335\263\307"
+	.ascii	">#\025R\275\226\204]WT\0365\240|y\030*\207Z\3027\345\017\323"
+	.ascii	"\233\256\201S\356\360Dgc7\235\206\316\364\370\350\304hL\001\n"
+	.ascii	"\212\255\274Q\222\332\237\272\347\272\233q\361\244\317\227\316"
+	.ascii	"\244\\\351\344\363\331_\230-\020l\301\004\b3 P\202A\350\316\007"
+	.ascii	" \340aJ4\347\025\004\305\231\037\030\377\325\254uQ\360\240\253"
+	.ascii	"o\204\f\361\366h\215\340\001\006\234\334\215\321\246\261&\264"
+	.ascii	"\200\002\031 wv\243t\373\300\024\2735\322\225\033\006\277As\234"
+	.ascii	"\254\344\263\331\211V\227=\275\336\221\364\rC\310\r\347\324\267"
+	.ascii	"\031]E\303C\030\266.\0270\017g\341\2011\366\217\r\317\360\372"
+	.ascii	" x\341\025n\b"
+	.text
+	.section	.gnu.lto_.lto.cbbee09680497265,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_ransac_reset.27.cbbee09680497265,"e",@progbits
+	.string	"(\265/\375`\364\004\265\027"
+	.string	"F\247\217I\240VRc\204\341\236\370\276g\364\032\322\220f\031^c\220Nb\0245Q+\247\227d1\021\234}9\241\216\024i{\021r|\244\312\340\321\237t^\230\035+\207m\351\257_a4r{\201\3137\302\003\344\373^w\023)S\ns"
+	.string	"y"
+	.string	"|"
+	.string	"7\376\366\1774\213_\274\023\357F'e~\004\356\017G\330\330\275\227\346\246m"
+	.string	"\334\224\371\313ysv\227\363\246yv\030\f\221"
+	.ascii	"0\340Tz\357\255\331\0326\360\331\323=\253\274\312\363\013$}^"
+	.ascii	"V\302\241\2333K\224\316h\021\022\315\034\224\001\227\374\370"
+	.ascii	"j$\364\325Y\016\244\333\037\357\262#\312\313J\210\364\272\002"
+	.ascii	"\341\336\353\032\024\262\270\317\333\006\262M\263M\234)\210o"
+	.ascii	"\021\031B3\022}\036D++MsG\032\305\272\262q\"\246\337\2356\320"
+	.ascii	"\177\354|T5(\246\312^]\332\250\355:c\213\270\224\321\027\033"
+	.ascii	"\367\336\005\266O<j\304\200&\367^\006P\357A\302g\272i\023B\365"
+	.ascii	"\301\233\276\320y\323Fq\r\213i\257.\255\365\002bL\262v\311~\032"
+	.ascii	"\2520MP\\\266Jv\314\215\367\021\330\033\300\252\003b\367\252"
+	.ascii	"XR\271\\\246VSh\031\324\0251\303\245\030\215RsT\034\026\323\223"
+	.ascii	"\335\326p%\024\233#\035\303\2422\347\2647|,G,\211\212\310\341"
+	.ascii	"O\300\310\246:\374\313\211\331%\225\322\334\326\271\227\223L"
+	.ascii	"V\310\244\210w\375\335\333\233\261mWb\264\345]Or\333\341\251"
+	.ascii	"\017\362\2347\037l\231v\311\246\225\215\261VF\245\371\255\221"
+	.ascii	"\223\347m\211\250\257_-\373\354\336{g\256\371m\2145\251\226E"
+	.ascii	"C\037\356H\216"
+	.string	"\030\t\270\373F\273\331v?6\235NO\256\026\364\201\007\327\343\241\366\203\263\371\324n\272]\215\226\300\271\020;\272ZP.\247\253\261<\335[\245\tI\256\236\3659\200\213\"1h\\\301\351\372\242\302\340\361\3409\361\216\274#\231\220\212T[\354\"\334\334\234hZWT\241Q\237\311\022\2144\362D\211)\205\232\302I\024Y\310Tiu\033\247\032\355\202+B$QY\241\002\213\272\260R\013\325W{X\304\013_VI1|\212\003^\250!Tg\031\243`(IAR(t\020\003\021\251\211\033\020(dF\204d\312\346\342\230\336\036Z>\021%V\017\263\343H\314\216\321b\235\261\213!\314\203\037\234Y#J`\370\233%v<\357\207\221\356(xF\361\340\020:'d3\n)\361OQ\206Ux?\316\300\240v\2211^\021\2429m\t?^82\023 \342_\362\031\020 \333\302\3102\034\334hW\003DD"
+	.ascii	"\214n\362\207@\237C\231\034\3560\2405\214\004@\f\330\002T\357"
+	.ascii	"*hQ\355\236\037\240m\002\324*\346\253\002\324g{\304\213\367\375"
+	.ascii	"\215\351\025`\001c8\343s\307\247\346\003\335\243Iy5"
+	.text
+	.section	.gnu.lto_ransac_update_buffer_size.29.cbbee09680497265,"e",@progbits
+	.string	"(\265/\375`\312\003\r\032"
+	.string	"v\357\245H\240\230Q:\020<u\243G\356v\237\320\253\035Y#/\007\267\331\202\211\237\327\0035pg\300O\345$\324\030\372\301?z\3546/\253\224\365\36059^\216GO\317\002\022sj\253\340\234s\352\027\031?\"\371do\271S\n\222"
+	.string	"\210"
+	.string	"\223"
+	.string	"\265\326\235S?\030O\025|\200x:\037@<5\221\r\346=\250z\337\021$+\257Z\353lwX\300g\357\036%\321mF\230H\347J\"_\326\300\222\244+\272\315\334#/\032\317\322$c^\370B\332\372\324M\216\013t8\3058\fI\234\030\242\300`\272\325\345\222.7%\017\256\256O}A\220&\031\222\276\370\234\r\2048\276\310tG\323\300S\226\213_]*\351pr?\3659\304\352\272\341\024\343\022\226\241\326j\231\244s\272on\373g[\202\275T\001\224\n\267\274\310\030\3115v\357&wg\337\202\020-K\336\034\266N\316\177\267\f\347Uwl\245o\316\273\305\225\246+=\245\364Ji)\245\017"
+	.string	"FDx L\255Lk\320T-\372$\352\277\277\352\347}\355\373\276\377\374+\307\250\222D\r]\211\021t\251\265\306\336\363\255\252\f\034\213\232\b\344\206L\"\214\247\366\220O\345\330\351\320\2238\250"
+	.ascii	"\247Sq8\242~\314\306\323\177\3121\377\310\221\020\235\347\340"
+	.ascii	"\254W\032\206<1\001\342\351\035\024myp\353\210'\356\316/\"\265"
+	.ascii	"4s:\fQ\263\262\325Y%\240m\311 \266\005\226\244|\\\266\210\007"
+	.ascii	"\r\344\261?<\n\t\004\025\236\034J\315\204\217\217x\032\333[\235"
+	.ascii	"\001\220-F\350\356\034\024e\233\263\262L\356\351\366\237\031"
+	.ascii	"!\214)[\261\305\320\227\205\223_\026\367fe\213!"
+	.string	"\367\343&\327\370?\333\016tplr\263\277z\003\241\2243\274\345\342\204gc\275s;\305\2318(\203\252\265N\360\261\276$\310\357qj\025+\344\223N\375\025\342\003B>2\304Omk7\r\002\255'\350\247\007\b\304\t\333L\250\004\211\332\211\021\263\237Z\217\317\214\006\0244\203\220\3006\024\"\200fB6\033\320,\3263\372\346\360\006)-\243\2751\331\354\316\024\013\206\263;C\356\\\\\245;\271\270,|^p\362\353\263\326ZG\236\213\213\263ShH\241;t0\007*\313\223\306\360|.]\231&\367\244\345 \226\271+\374\"\253\226\314\350\202\355nW\356}\370\256p\270\025\003\263v)p\361b\373\225;\313\330\036^\305\300q\312\251\200\350\241\321\002J\250A \304\224sF\221\n\206F\202\026\030\246\003\200\002\2211\3339\020P\247\212\013\205\003b\220\272O\317\347\214\235\221T\232\001\r\033$\252\335q"
+	.string	"b7>\022"
+	.ascii	"\206-xY+\013:\022\035\035QD'\312\026C\266\035j}\203u\210\351"
+	.ascii	"\330\341\337\024\327;\252*\214x \220\006\355\f\025\333\340\355"
+	.ascii	"\202R\340AE\177:\001W\202h\230\213\023(3\214R\202O-f0@>%\276"
+	.ascii	"\016u\362\213y7\317\343\350\346\f\233\343r\230F\203-\351\032"
+	.ascii	"\243\376jM8\004\026\022\343e=\033XC\342\376\242\254x\232\204"
+	.ascii	"\241\002"
+	.text
+	.section	.gnu.lto_fit_line.30.cbbee09680497265,"e",@progbits
+	.string	"(\265/\375`O\006\365$"
+	.string	"\352E\310\016G\220\332M:\005\250\b\306\247fL\353\r\347+\255\032\304\304\361T\231D\264\342u\320[\242\213\2075\335c\3636\204I\3342\216\256~\026a\316\360|0C\214=\217~\320\275\013\351\240R\2150\315\263\215H#\204\244\235d\340"
+	.string	"\307"
+	.string	"\331"
+	.ascii	"&\333\333\030\016\fb=\304.\200mX\316\254\365\212\0211\013R6\314"
+	.ascii	"F\027\231\tP\266L\254_\027\300\224\211\360\305\242\214Q\243\347"
+	.ascii	"\007\306\rZ\255\025\311\343>\330\025\233,\230ON\245\352\272\321"
+	.ascii	"\340K\3345e&[\266f\255Xib\265V\245ePz\314\211"
+	.string	"t\370\342Lg\272k$\346\232r\022\030\326\2515+\212X\255C\245U*=\356\320<\244\307\3228\322\343N\355\236\361P\253\326tp\371y\261\251\265\352\316ck\347y\236\026\207^\221N\271\254\221\243x:\2656\240u\002\2031\\\026\325\260l\3340\211\023\374\211\271Z\353-\350\243\243X\223A\343\007NP\206\b\241\r\332\230\311L\253\202=*\n\261\362Mf\004\302.\300\240\225i\255B\255u)0h\303kzw\261vw\303.\351!Opz\373\206\364\350\271E\367mf\321\215\020\315/\215G\317\337\211\025\031\301\177\307\3560\006\205\240\325\006m\237\265\253\200I\267\344$\266R\222\313\274H\036\332\t\334\304>\340/\357\221\231\330F\206\342-\312\021\r\t\231t\203,\346\0052\351\376\230t\013\230t}L\272\004L\272=&]\036\223\356\216\307\2748\033\335\0016\272:6\2729&]\001&]\034\223n"
+	.string	"\223."
+	.string	"\223\356\315\244k3]\263\244[\226tk\226\342%\r\346\035OW\254\321=\245KI\272^`\023~\021:k\245q\272\251^\3061 .\263\277l(\266\024\033\314\026\263\307\\\333\365\256\253\254\315\366V\006\324q\246\241\364h?q\024Oq\230\251\004Ap\307]\300\305\262"
+	.string	"\037\217s\373\266\214\036\340\037\256\306\370\320x\364\034\277c\307#\\D(\222\213\204g\262i\345\302(\231q]\030\242\264/\231YC\257\262\231K/\\g\236t\021\\3\350\206\355.5\022z\225\321\213\356\242K\013\025mc\261\326Z\305Mr\321\025\334d\026\315\204]|\302\334\001\234\311v"
+	.ascii	"\227p\025\346\333\"\372\355\272{\212O\330C\372\355\022\256\234"
+	.ascii	"\370\266\206n\373\322\355\345\023\366\272\240`\001\203\364h+"
+	.ascii	"\257tS\364f!k/o1\276\255^\355\034\204\347/\r\351BO:\223p\215"
+	.ascii	"O\330\243\247\224\265l\230\220V\255\025\302\032\213\2634\255"
+	.ascii	"}x\334\021%\250\201%H\217H\337)3\366\213\367/m}\305\205S\351"
+	.ascii	"c\375\202\364\370\273*\007\217\236\353;\357\242\250T\024\335"
+	.ascii	"\355\242.\265\213\272\223w#D|\205U\270\205\b\247Ky\233\226\232"
+	.ascii	"BD\251\b\001\005\002\305\223ng\242\204\023\n\022:\025N!R\350"
+	.ascii	"\232\240\242tKC\373\264b\004\224n\367\364\004\245\273\r\253\237"
+	.ascii	"\265\031\256\274\360\336\333\240\257\317\350z\001\323\360~\036"
+	.ascii	"\364o)p\240\377\334j|\216{\201\323\263\322\347"
+	.string	"\035\264\326T\345(\217\325\244\b\033^m\t|Mfj\310\206]K\364\202\221\036]\006Ls\364\236\023\270\350\345\303\302\363\235\367\234\236\001\035w\236\237\374N\222\253\323\267\025d\305U\204\024s'\211>\016\035\350U+\212B\307\275j}\202\034\360\237.3T\264\315\352<\347\003N\276\371Ye\351\274\246\346W\204\205\227\302yV\241\252\225gt\364\234;\270B\363C\"\3408?\272\337\370\002y\250AD\304\214R\006\325\314\204\t\2224i\r\300\002\031\"\343\034\021\220\251dG\233\302\355\"g\017I7\220Cx\354\211\f\213\303l\317\351\305\230\350\263\\\233|\367\253\226\016*u\216V\037]Ip\340\005\332\005\371UM\376o\231}$\200\257\221\361\332O%\206\247U~i%\323[GTG:\344\006\320a\273\"\233\307\037\277\316\303!Z`w>e\304u\336,=\273\320Fc\231\361\340_\200P\342\303\n"
+	.ascii	"\002\225*\311s\036\276\302\300SFB\312\3043\221\026\207\316(\025"
+	.ascii	"\270\037m\003\310B\337rmj\254\r\031\234Z\243\363D\256m]\023x"
+	.ascii	"\3504\200\330\310\317b*W\"b\240)\215\234t\214\253A[\345r\264"
+	.ascii	">\210L`%q\225\t\330\200\250.\202\316\033R\311\203\022\006<\213"
+	.ascii	"0S\266\341\177\232\356x\342\017"
+	.text
+	.section	.gnu.lto_fit_inliers.32.cbbee09680497265,"e",@progbits
+	.string	"(\265/\375`:\004\375\034"
+	.string	"\3066\273H\240VN:\205\344\322\233\275\357\2448~\365Q\250\211\324K=Y\315\246\2167\320^X\005\241\032\0061\254\262\333grxgOa8\242=!\307\307_\351\225\030//\216o\344\274\262\247\206\344\362F\3336ido\271S\n\250"
+	.string	"\232"
+	.string	"\251"
+	.ascii	"\365\312\002\224 f\265V\235S?\030Os\246\024zK\212\356\322\376"
+	.ascii	"\324\203\034]H\212\347j\205\3322R\253\260\201\033\214\247\026"
+	.ascii	"^\200x:\036\200x\352#\333\312\205Q\265\006\004\322#\242\245\326"
+	.ascii	"\252\333\031\016\360)\274Eyt\333X\023\351\\y\344#\270\021\305"
+	.ascii	"\367C\272\355@\214\025->N\005?\316\222\234\254\251\305\264\261"
+	.ascii	"R\252q\251\246'Y\2335%\0258b~\275\271sf\326\365a\222\024o;\234"
+	.ascii	"NY|\306\374\224fN\326%\323\217'\367\303/\260\221\346\3739]\326"
+	.ascii	"(\324Z-}\277\025\367\355\266\245lO\260\347\205\363f\"~\345~I"
+	.ascii	"*I\246\231f\277\317\372l\022\344\352\241\355d\332\016\301\224"
+	.ascii	"~\273@[\210$w\242\316\314\274P6\316\315\261n\233\013\177\002"
+	.ascii	"\027\362\327\274\352\246\311\315\214\32225\351\230[\3350\242"
+	.ascii	"\364\213(\215\023\245oT\332F\245G*]\243\322\"\225\246Tz^z\247"
+	.ascii	"\264\234\3227\200\363\341DG\254V\025i\\\352\030\355\312q\254"
+	.ascii	"\277\352\267\372\332\267\177\345g\031\207e4\"5\r\360\001"
+	.string	"\261$\214\247?\221\017\215\263\362W\016o\246\362\200S: |\310\251\216^\345\257\031\fN\2638\373\341g\026\033i\222\306\254\355\016o\302#\023\265\344Lz|~~\304\323\373\256\354bVB\351\2411xnoVC0\312\322\213\244\227Q\031r5\027\350\"\361eAPM\341\3113\343\366\266/+\277zOP\270\225]zSF\267\344\325\272K`\263\267\235\020\004\353\371\260\355\\\233\225ZK:\306\245k\333\371\265\364\242\266\342\216K\2656\374\313\\c\255u\307Gr/ ?x\352\021A\362\276 \361\264\266\021ht\035\231\342\316*\\\031\314\345-\361\224\356b\361\265P\030\215A?\305\236\311\205\334\232\335\375\022\217>\027:\320K\374\304\335\343\240\207\247H\210\207\350\003\211!\235\t\021?@$B\350\204\200x\202t=DE:\007\006<T\302\207Hgbh\210H\207\023\326/\2241\374\030\333m\222\315"
+	.ascii	"$\201\205\331_\275"
+	.string	"\354'\200\224Zw\367\221\325\254\315\301\203\274\317\037\376V\244\307Xo\221\\\203C\006\217q\212\271\205\201Y\321\251\214*\214'\317j\013t\r\b\305\031\237\200\241I\235\323,\223'\235\331\002`[R\347\271e\242Y\231\255\020\346\207]\314_~\320\037\354e/\361T&\001\231\330\226\247\235L\373\024\027\350g\335\006C\311\326\274Y\317\315\355\3142\331\001R\250Q4c\230b\002\305\314L \201H\205i\213\001\200\002\231*\253\016\020pW[\303vbV}\325\004\270\204\013\032d\002\260r\2120?'\200\326$0\213\310\005!\234\206\305\352\330\236\336~\020\244\213Mp\204\212\216\301\205\263\022\005`\344\246\346\317_!\211\320o\304tX\334\372\342K\024\250\025\243\274\031\304\215\354:\226q;\270:\235\003\020\223\357\245\333a\221\262E\034\265a\f\n\216\202;G3q\200@BM!\375\350\240^*\211hd=\005"
+	.ascii	"'\017j\3708\214\002\347\002\346\253-A\305){H\215\177\305\303"
+	.ascii	"h\205\305\220\242\337\216\357i"
+	.text
+	.section	.gnu.lto_start_fit.33.cbbee09680497265,"e",@progbits
+	.string	"(\265/\375`Y\b\255*"
+	.string	"\312H\374\017Gp\236Q:OGp#f\274PTE\312\200.\374\037m\332\302\322kh\177\321\001L\025\354\032\031\335k\036\223\013\255z\220\030\002S\333h\230Bq\222r\224M\256\021\352\251\177\031\304Tf\304\267\377\255\021B\210\334I\006\347"
+	.string	"\330"
+	.string	"\364"
+	.string	"\314\357\342{q\361\217\235-\3163\231\237u-\376\026\347\264d1C\3268\223\035\030\351\223l\333\266\006_\013\347\236\326x\026n\032\020\002\265B#\362\352g{z\277\344\034\377\312\261\260Wr\023m\273,\250is\326\266\255\357)3\260=5\360"
+	.string	"\352S\364C\352Sf\231\347\234i\325\256G\262\247-g\333\266\277N\302"
+	.ascii	"\2162\317\271\313~\247\313\341n\266UM\321\276,\037\027e\343;"
+	.ascii	"\"\327\241\253\323\216'G\0035\004\215\240v\346\345K 7w$RB\216"
+	.ascii	"\353\031\221\242\372\r%B\003E\345\025\344\332\256\220\257?\256"
+	.ascii	">-\2077\355q\024%*3\306\341E9\241\003\252\312\360\370\326o1J"
+	.ascii	"x\033=\252*\303\203\027\025D\003\224\031\343|\371^\024(\"\367"
+	.ascii	"\256\023\332\266\345K\214\222:\363\316\314h\314\374\200\331f"
+	.ascii	"\024H:\303\2637\277y0\334\3447a%\026c\261\345\321*H6D\264\264"
+	.ascii	"\217\275.\352{gX\025\024P\004#\004\355#\373\336k5\207YV\231k"
+	.ascii	"1\212{\351\322\353o\235\250,L\004+\2659\335G\364\334T\337\003"
+	.ascii	"\262\306\204W\215\231U\034\214\233\266\266m!\360\277\316e\211"
+	.ascii	"\337\344)\263pqOt\241>}\247@<z\224\300\373d\333e\216!\343\236"
+	.ascii	"\310_^\303X\021=g\301\266\301\314\f\336>6\2274\255\270\2170\373"
+	.ascii	"\216\336u6Rp\255sQ\202{\2717t\345Y(\275\034\324\227\201\320\313"
+	.ascii	"?}\231\327\227w}Y\327\227s}\031\327\227o}\331\326\227\327\276"
+	.ascii	"\254\336\313i_F\373r\337\313_@\203\351\254\303\340\331\266;\236"
+	.ascii	"|\3323\251\027\344\273~\255_\371\016\267\340W\362\311\367\200"
+	.ascii	"p \325'\251\266k\004\025\356DJ\247\276\222y\360\350:\235\372"
+	.ascii	"\302\312\245\331\261\200\353[\347.\274\216\363\214\016\016\303"
+	.ascii	"\3458\343\300\271u:\305\325\314,\342n8lg\305g\3636\0316p\270"
+	.ascii	"'r\270\263\266\332\266\276r\206WA\017W\203\264\006\323\230\255"
+	.ascii	"M@\211\222?\274\f)\235\342J\266\255\020\202\325\317\200\3701"
+	.ascii	"\333\022\201\354fB\214(aB}\252\366\267\234h\212\013K\t\304\365"
+	.ascii	"\361\313\215\372\350U\336\024\2057#\241\356\265Q\337\353\r\250"
+	.ascii	"\236\303\253\346\n\343\004e\353#\337\324\367\023u\224\252\357"
+	.ascii	"C]\344\257\227\f\221\024\255d\032P\355#?IE\007Z\324\337:\211"
+	.ascii	")k\335k\005]\\\360\264\325\037{\262\306\3221I,v\271\020\321\320"
+	.ascii	"N\373\216\r\3118\354_k\244\024i[\226\360|\256\t\333\026x\240"
+	.ascii	"\033\355\017\243\004\273\357#'^,\365\322Y\251\201R\222\214\027"
+	.ascii	"IM&Z0\375f\254P\261\324\"\305\357\305R\222\213\237R\223\214_"
+	.ascii	"\203\002\314\004\003E\323o\006\023S\323/\307\004.\371\004`\007"
+	.ascii	"\227\354\316\036Uf\326x\211\260\307!\306\2463\315wf6\311\245"
+	.ascii	"\342&\317\352\006I\3554\223i>\224\210\211q>\237\3173\267\235"
+	.ascii	"b\302`m&\226t\0065_\250\033\305:A\262PX(r\244\\\035\354\224\365"
+	.ascii	"KX2\007\216\240^\277\204a)\201\232\357\215K\3440\226\n\203\201"
+	.ascii	"\251Oo\223\210V\341>!\255F\260'w\b"
+	.string	"\302\201T\237\344u\002\352\325\b\246Gy\246\353cQ\025\\\202ft\035j\241.\n\365\273j\b2\213Lx\325\376\243\355\355\250\357e3j_\027\205:A\343I\232\031V\375\334 \213\305\2736.\220\265\302ba\227\354R\250\177\272\003V\330\323\032\357\271Fa\327\272\346uo\r\257\202|\220\002\200\255\250Q4\305\030c\246HFF\222$\313\030\300\002\021\241\"v\021p\245\203\210j\026\270\3761\007\022\306lT\001\275\030\023hV\\F%\306>\231o\001\007\207kS \215\217\362\207\347\227t\004\363\220;lm^O\005\216h\025}`\354\334*z\272f9\374\013\377;\346\025\357\b\003\3504t@\023=H\237\232\\Z\310\251\337T\216\213\340\342I\302g\273\356\325\301\220\003\251\"n\240\376\364\255):vj]\035\035\3066\003o\346\370.\377\n\325\237\327(r\035\322e\330\234M\013S\317\371\361\264\336"
+	.ascii	"^Wc\377\001tu\0315F\250\216\341\375\350\266\340>\016&\272\367"
+	.ascii	"\375k\353\307\222\323y\330\033\262a\030,\342(\\\214\030\374\355"
+	.ascii	"M\n\275\263\234A\2132\323#\342\017\363xn\301G\035\241\205\024"
+	.ascii	"SO\257\240\311F\356\376\205}N\362\324\220\211\r\036\223\263("
+	.ascii	"\307\267\267\027\361\266\220.\264\336\013:\037o\237r*\342\334"
+	.ascii	"\036\235\340\374\306\231\332*\026\220\325\004^\352\t\020PJ\312"
+	.ascii	"&\001\025\310\352\202\352\261\210\034Ml\330\341y\224\3625U\030"
+	.ascii	"\254.\215\247\006\013\375C\240=4\301s\230#\b'\326\357WP\374\332"
+	.ascii	"L&\264\020X`\035\311\206D\025"
+	.text
+	.section	.gnu.lto_ransac_push.34.cbbee09680497265,"e",@progbits
+	.string	"(\265/\375`d\003\315\023"
+	.string	"\366\342|I\300\322Q:\320\316W\350\341]\205\374z\252\272\251F\264\225X\307\034L\370\037\332\331h\324j\3520\020\023\340?\203\3272@\255"
+	.string	"}\234T\375\245*\n\202 4\024"
+	.string	"Q\201\3422\213\377\213\300\266\244\264\033j\221F\b\221;\245c"
+	.string	"b"
+	.string	"n"
+	.string	"\026\020\fE\251\b\321H\351\031\031 /\372\323\376\210\003\341\036d\237Av_\370\034\355\256\313.\362\342\311M\306\213\341K\306\213\306\331Q\357\361\366&@T(\321cwK\355p\334C\2358\177\265\002\242\333\331<\324pe\355p\302\223\335\375\211\317\234]n\316\325\312\356z\352v\030n\361\266\031\330^`\253\212*>\212\033\331\374\017\027\035#3\257\223\031/^\005\3504\355"
+	.string	"\005\335\314*\273g3\265\307~\270\312c\237\350'\371\320\337\272\320\317z\357\037y\321\037\362\240\237\324i\325\351\251\3237\241\001\366\330\221\240j\367B\325\217]\022W\204\260}\021\333\263\250&l-\016\007\235\243\335\236\313\n\210\354\013[\233\223\013M\3661\325\020Aj\372\tQ;\366\245\032\245$"
+	.string	"\"\224\202\244\332.\237a\237\213g\317\\\206\214\365\264\273\007`<F\204\031\2156^L\361\260\301\205\177d\013UqJ\351'$p\026\376\005@\002\311\220\344C5w\327F\265\307%\367o\234:\352@\221H\302\231><\365\310?\026\317w\235T\201_\247*\017\n;9Ox\n\377\310\335\r\266\230\226\330Lv[\321\314\346\314l\322|\346\261\231\354\026\032\206\002{\331`^\265\226\027Zy\203\340\"{yP\302\310^\263\022V\263\225(\003L\223\020\253\2257\032\255V\212\364\366\341*\217\303 0\b\274\321\234\177\226\321n\360)\026\026OJDr\362\241\"Q\333\301\201:\242\202-\265[\236\003\n\007\223\215\037\226\332\257?9\335\b\216\250\r{C\2501d\243\2302E\023FIaJ\322b"
+	.ascii	"\003\021\261\325\001\0200\246f&H(\033\003s\264\375\274r\301R"
+	.ascii	"\017\031Y\240\216\367pj\336C\252\312\030]`\037Dp\262\034.\002"
+	.ascii	"\327\225\025\004\247\336^,\226-\327\364\305x(T\035\276\317x\367"
+	.ascii	"^\tb\355I7\303^\022\"\356\177\273|%\300't\220.\354#CB\303\331"
+	.ascii	"Z\316\233\210\271]=i]\337\260\233\002\035t\177\360\224\353\245"
+	.ascii	"Vm\n\252\001"
+	.text
+	.section	.gnu.lto_ransac_step.35.cbbee09680497265,"e",@progbits
+	.string	"(\265/\375`\330\024mZ"
+	.string	"*\225\210 N0\322\322\031\016-\246\200a"
+	.ascii	"\020\034\3770:\231 \023\311\2138\233!\321\0228\t50]\325\241\001"
+	.ascii	"\270\276\bR\220\333\361\340\337\317\234N\270=\310\231\336\233"
+	.ascii	"\253t\305\210\033\245\342~\2363\260\303M.\215\365\037\n-\353"
+	.ascii	"\376^\322\366\2262\311\370\001\302\001\373\001W\363\1779p\367"
+	.ascii	"\3738\267\263\233\256\007\257\263\"\354\300\355\347\234\316\246"
+	.ascii	"?\355\216\240X`h\rfR$@\177^N\022&\254\266\365+G\231\272\265\030"
+	.ascii	"\250\007\273o\366p^'\267\237;]\002\305,\304\265\032\316f\337"
+	.ascii	"\346n6-s\345v\3651\217\333+\277fS1W`fX\315\027\314B8\334\372"
+	.ascii	"\236\320\361Y\3275m\333\237y\232'7U\263\204\351\267\256eR\322"
+	.ascii	"\254+\230\003\350O4\177\273:r\t\212\005\366\363*S\002\336\272"
+	.ascii	"\2021\320\206\232Y"
+	.string	"\303X\220\301[\343\003\343c\366n/\263)\031&L[C\353\220\353,\313\013\224\006&^\305+.\320\020\366`.f\3230\213D\261\300\222\204E*-\320\237!|\206U2m\265\2310\303[\363\302\002\375\331\273W{\266M\367k?^\375\313*\315\225L\214:8\340\255\353\232\342\347\256@\1772\035\251\367\323\274Q\357\347\2628\340j\325\267\031\277n\345\206\2561|\326\265\315\251\255\f\245\350\036\335l\373\036\235\352A(%-!\035\031\025\021\r\005\201BA)\320\017\365\365N\263Y\335c\035\004\2137?^\256\3648`X\316\266\305Ic_2\033\214\033\233\243\027\263o\001Sc$\263\271\370Ly\034\260\027L\005\372t\3159\233\013|\204v\243+/\272r\306Dfk\310x\310\370\240\357i\315\037VE\314x`\0251\342\205\342\200\021M\246$\025\016\232B\367\022[\300\242pZ\242\0051)\007\242\273"
+	.ascii	"gmk\313*bR\3763}\\_/<\016\030\024\323E\037\274\344\223\347aX"
+	.ascii	"\027\243\276\247\026\304\306\356C{\317$\2008\367\004\311\006"
+	.ascii	"\026\356\266\370|\226\227\233&\2112\262e\032\306e2\311\325u\001"
+	.ascii	"\303\266\270\3230\241\311\264\256\353\331\316&\204i1\373\236"
+	.ascii	"\326u]\366\n\023\373\206\370.\027\355\356\004\273FV\001\302\037"
+	.ascii	"\240\372\177\272P\320\342\274\025\372*{-\332\200\276\320\217"
+	.ascii	"\326\227\3573c\217\2665l\330\350\375l\321\267s#<|\210\307\261"
+	.ascii	"vc\303\025\346\353\3422\247\270o\204a\027\362Lq\356\341\276\247"
+	.ascii	"\302\035=\275\263\245\366\250\250\236\263\317\264\037\226H\274"
+	.ascii	"{\003\007\337k\217\362"
+	.string	"\332\226xZ\215\305\203\0324\342q\"\273#\256\345a+>\3109\273\370^\332\230\035\314.\346\360n)\035\307\323\241\373L\333\2634\351\330\324\364\252\275w\2100w\266\270\317\356\356\370\235\212\256\353\212\300\376\316q\340\261G\373\271QS|\257\251\336\317\367\331\316fd\\\210\307/Y\234\267\333\246\305]\334\375/\206\274*\333e\273(\357\021\253*#)o\221\263\371\022y\233\357\220\224WH\312\033$\345\005\222\362\376Hy}\244\274TB\274\035\004\361N\005\361J=\356\033\205\362\366\340\301\301\216\224w\203\277\371\3528\234o\216\224\027G\312\253A\312{#\345\315 \345\305 \345\275@\210\327F\020\257\005A\2745.\367\245\361\343\235\361\343\255\340\307+\343\307K\301\217\027\352\351r\2760n\367U\340\305\217\267\305\217\327\200\345m\272\231/\212\023(\257\t\224\267\304\217\227)\345%\221\362\216Hy\003HyE\244\274"
+	.string	"\240\274!P\336%\224\027\304\225_\245\2247)\345EJy\217R^\243\224\267(\345%\372\334w\b\345\r\242\274@ ^\241\037o\320\2177\375\361\002\375x\177(/\212\362\372\226\367\\\336\376\227//\357\223\fPG\234b\345N\327i[\277\362\374\254ug\022\313\225\177\334\337\346g\363\317\375r?\234\377\315/\347\267\373\315\374\310\007j\311\241V;+\256\211xr\364\"D\367\b\306\030\273\220i\217>\322\3035\323\035=D\324C-\025f\216a\340.\213T\261\354\333[\357'Q\223\025\271\020\217A]\\_\f@J\341/\305i\364\360u7\2254"
+	.ascii	"q\320\035\300\275\371-rw\371\304\216\036M\243\037\230K\223\321"
+	.ascii	"\243\203\233\322h\036}\272\233z\316\334\204\304\035\275As\320"
+	.ascii	"G\303\344\313[\353\232uBGo\320\037\234\325\021\346\311\3219Z"
+	.ascii	"G\023 '\334\202\243/\350\034\315h\204Y4h\f\032G\233J!\361Fg\320"
+	.ascii	"\032\364\211F\270\345r\273M\336p\226E\242X\264\250G\276\321@"
+	.ascii	"N0\022\217I4v\301\314\240\177I>c\262G\313\201Aw\017\303(Y\306"
+	.ascii	"&m\230\234\252\367\363\202>\315D\261\240\005\365\bU\264\321\027"
+	.ascii	"r1\277r\275\032mA_\270\205F\327\350\327\275)\216R\253\216\333"
+	.ascii	"\017@]\334\257\340\204\210\002;\330\303M\263\202\nD*i\352\221"
+	.ascii	"\357\245l\342\303=\251v)\300\216W\260\017\307P\240\222\354\214"
+	.ascii	"\035\216QP\217A\343\272f=\341\023T5U\006\365\250\036{*[\003\234"
+	.ascii	"\204\253\353j,\027\306>x\277.\356/\212\357\251;\206\245\024G"
+	.ascii	"\321C\024\r\354\007\336lq\237\260\0076\016\330Gf_\327uEU\034"
+	.ascii	"E?\365\223?\305\312 a\364\227\tg\031Rm,\253I\210\0214\016Y\351"
+	.ascii	"\205G\310#\304@E\020j\037\227\267e2\213\363T\030X\030\243\311"
+	.ascii	"\270\256\253\213\345-\346\212`\217\006\005\325\373\t\243\317"
+	.ascii	"\2707\265dP+\320\214&m\240\016\352\013\211Zi\363\237_\317h"
+	.string	"\2406\377\b\223h\377\372]?\240h_\243}a\026\306\342\254U\312\330\270\215\353\375\364\365\351\234\357\312\356\210\307\261\031\235w/<\025\264\214\236q\312\350\n\332G\307M\350\207\202\206j\031DPMA\373\354\362\002BnUDI\177`\305L\254x\310\251\316\202\212\221 \241\352 \267\242R\222\304\334\251\002\246\242\222\030\211B\302\203H\225\223\022 ?\202\020\361\341d$HT\021\247)$I\234\n\030\261UVTH\234\224TU!qJ\333\262\336e\3333\323\301\r\251t\266G`e\351\2064\237\303\233\232z\237\262Z\013\304\216VA\005\032\233\254L\017\237<&\232\312*\201=\245D\233h\266\033v\224U\242\r\245D\233z\240|a*\241SP\277Ph'\375D\375\nS\2358\351\375dj\337\223\036\226c$N\350\260E\002\033\254MHa\337H\3649\247\007\265\261\021P\232\204\341\212\036A\204\021\313"
+	.string	"\244\264\260\271T\264Vg\231\005\320>1y\324DP\3515\217\377\370\021\261\004\200\214\373,\022\270\264\343=\213D\365"
+	.string	"\320>1:\344\341\301l\007\274\264\303\251\3259\361\3338\007\265\213\222\361\356m|G=\006\355\334\300\202Z\024\222\222e\211\307\325X\333]jZ\224\344<D\207\240c\027\242\317\255:j_\366$-\311Y\242\213\263J\266a\251U\334\320/\316\204\231Cb\273\251\305\313\350E\257\331\343>\321\303\023}<\377\027(cG\347\250\213'\372\005\004`d\220K\314u\255\302"
+	.ascii	"\036\030\316[\020\275\253Z\341\271U\006\215,\247\342K\r\242\255"
+	.ascii	"\316\300a\243$7m\314\322$\365\0317G\rI\031g\226\006\251\3178"
+	.ascii	"8K%5W\232\312\340\250\025\231CFZI\251\217Z*\314\033\344\225}"
+	.ascii	"\343#<\242 0\305\243zx7\301* s\271\221#\035\325 \fE\265U\177"
+	.ascii	"\215\221."
+	.ascii	"\322U\254\345D\272\310\220\036\322D\2044U\017\t\322>Z\b\220\376"
+	.ascii	"\321A\342v\233\2541\2323@jHs\367\203L\232;\037M`\240\232\032"
+	.ascii	"s'&\255\003f\341R=\025\325R}7A\240\321\n\0063\303\n\243e\262"
+	.ascii	"\250\371\313\"\201v\326\370\270\304\005\265K\227\336OF\343\205"
+	.ascii	"'Y\324g\334\\\201\251\250q4\305\024cfdDDD\222$I\007\261\005\204"
+	.ascii	"\030\346\034;\036\022@%-\312\222L!\252\031I\222\024\366?\016"
+	.ascii	"D\004cj\320\230\2257\003\3643\364/\245\003S\355\316\265\232Z"
+	.ascii	"\265l\273e\221\0037\006\211\227\001\211Rv\375\021\r\235@7\351"
+	.ascii	"\334t\313\253\226\240\321\266yh\2636\216Ka\362\223n\215\243#"
+	.ascii	"\0224\316\271\342\027\237\353u\212_\005\026\231\331\026\223,"
+	.ascii	"\314\325\366\337z\254\302p\334F\215*I*\202\213\371\222\340e{"
+	.ascii	"\347\310\027\257\0139\252:\201b\036\232\304X\370\254M\317&[\364"
+	.ascii	"4\002\275\274l\310\224\226\244\376\370\317\030u\233\354\244\323"
+	.ascii	"o\035\225?\307\227!\374\\4\t\212m2$k\302Q+\325\265Y`\340\177"
+	.ascii	"\203/\240\216\317\024\244\266Fs\272J\r\355\3720\227\277I\276"
+	.ascii	"w\365\374\217\242X#\324.\243\353\3253\374x\277\210\370\277\332"
+	.ascii	"\376\255@M\216\333\340\207n\311\333R\036\027\007\347\025\264"
+	.ascii	"i\304\330\235\305\371{\373f\032\306\260\362E\263\0313\0303\321"
+	.ascii	"\350b\336\330ur\002\204\001\002\334\246,\001\366\031\t\277\347"
+	.ascii	"\347\245\334L f}\267`\277\236\360\337\007\021\341\344\f\241p"
+	.ascii	"j<(\002s\254\276_\300D(;\213yB\273\343\356\210\257\016A\245\237"
+	.ascii	"\332\243\245SP\210\007\303\007%Y\254\b\343\005\276K\204)\022"
+	.ascii	"\316\301*/\216\\\236\303\313B$\005-\231|pp\002\210\261:\225\317"
+	.ascii	"\207\270\r\005\344\326\233\n\206\310\006\367\300\007\3665'Z}"
+	.ascii	"\323\361t\252\006\261\215cz\240\244\224\320\\\024@D\240\005\301"
+	.ascii	"\337\020F\305=\033\265\356"
+	.string	"\013'\301H\326I\211\005q\206\2406\325\205~\3552d\027+9\272\210\344\022\352\342\204Mx\036X\266\033(g\251u(x\314\250\002\202\355]\361\214\3003\225\367\244v\347\013\256\207\226s\026\210q\025\241\365\333\276x\343\030\364\006\006 \n\037t\264 ]G{\272j\344\334\220\310S\t\322.\370\205|\207'a\374)\244\376\363\227\217>j\330K\006I4\357\310}\035\336@N\\-\226\3067\333\304P\036\237\253=\264\r\0362\002\362\226\2229\2346\2419Y\246:\f8\021\371\265\210K\321ca\302\021\245\037\027\310 t\237\220l\001A5\341\007q\332\231Tt\263\204H\021\003\317\251\023L!3\306H\253c\201\344\227\250\002\305:YV(\360\376\022\321\244\026_Z#\344\231\243W\024d\255\255\204\234\201H8\330\375\365/<\"T\336\033c\"V\300\026\271#A\303\327\313H\031I\026\306\016\320\325\305Z"
+	.string	"\211v\247\272-5\205}\"\225\346"
+	.string	"aE\033\024\275\274\032\222\374\3743\2015\032\016fb\324\246B7[\223\201\021\334D\315\b\032:\201\356><^\206\"\224\231\333\376\035 \354cU\241\2528\020"
+	.ascii	"\374\0044\331\2751\250B\332\006,A\326@.\013\306\f\375\353]Yc"
+	.ascii	"\206\332\245\214f\202\253i(4e6\2512 \232O'\257\255\217n\266\204"
+	.ascii	"\n"
+	.text
+	.section	.gnu.lto_ransac_shift.36.cbbee09680497265,"e",@progbits
+	.string	"(\265/\375`\264\013m5"
+	.string	"\332\\\300\023>P\350\315pM\202\302\3639\006\245\233\262{\3005\030=y\223\327H\257@\t\317-\034\372|\330\306M\032\232\237\002D\327P\201\212Z\247O\247\347\266?\311ZuA\366\335D\310\336[\312$\0035\001\377"
+	.ascii	"0\001\202N4R\325$}\226\324;\224N\314\353\374s\277\234\367\356"
+	.ascii	"W*3'\025\r-M\333\231sB\200C\322\244\222_\224+>gw\330\227\333"
+	.ascii	"\341\356\312\331\346\251\312\001\201\350R\236\252\252XG7\305"
+	.ascii	"\302\3612\342\315\256\247\223\212V\206\346\241\315\242-\270\325"
+	.ascii	"\002\360\350\236w\237\346j\310\276\334u\203\252j\367fGU\325\254"
+	.ascii	"\315\002\036\245zTz\364\374Szt\311v\031\035\256\213z9KE\342&"
+	.ascii	"\251\252jl.\303\205\372\t\367\3755\331\213\304&\246\2410\b\374"
+	.ascii	"\245\350\331L\266W\340\247.\2516\344\305*'\236SJ?L\216\227V\345"
+	.ascii	"\274\022\224E\321\345\224\334\204E\t\2253\235\277\263$a\216\227"
+	.ascii	"6\345\314\260\227Gw\346\253\334\322\242\360\260j\213\022)\027"
+	.ascii	"\376\270\230G\277Tq\204E\211\224\007\361\322\250\234Tnik\f<\373"
+	.ascii	"l\322\224\343\245A97\354\025!t\2712\376\t\307<y\212\022\355\032"
+	.ascii	"%\325\234\374<!\344\335\211DT;;\243\222\204I~\316\031M\315\214"
+	.ascii	"\373rg`\027'\251\366\344\374\343RUu9\251\246\344\353\364\335"
+	.ascii	"_\330\335\026\273\303\003\001\335h\034\262\255l\301\276g\327"
+	.ascii	"c\034\273:\356c"
+	.string	"\034\206\323\347\354\021z*\325\306\362[\321;#\346\\w\227\255\3362\334 2\343\275\335\275\361<\2736\033\206(\307\223\243x\026wFU\325\fwN\027\266\007sty\364\340'}\244G\337\237s+\2668JK\"\334\327\206\354,\257t\263\355\302\r\341\001b\330\334mk\3315\361:_\021!\016\367w\370\233\237\353\313\237\303\333\374\033>\367\335:\234_C\205\313\371R8\357\204\363J8\257\361\274Z\347\315:o\204\363b\235\027\302y\037\234\327\301y\033\234\227\301y\257N\336\005\347\265:\257\202\363V\235\227\352\274\t\316\213\340\274\007\316k\340\274\005\316;u^\002\347\035p\362\n8\257\324y\243\316\013u\336\247\363\0068/\200\363:\235\267x^\342y\233\316\313\324\274\303\363\n\317\033</\360\274\277\363\246\347E\317{\236\267\317\313\347\375\t\001L\002\315\266?>\302\020\335h\202X\257\320h\025Z@\177"
+	.ascii	"\304*\017\331&\212\315\223'=*\240\241\274@!\302}\313h\020\223"
+	.ascii	"\320\260B\207\350 {\372\220J\251K|*\242\372\251\245\240:\252"
+	.ascii	"\330P\225\366T<5\332\\\013\320\223v%v\221\004\240\233:@s\034"
+	.ascii	"\262\315\251\001t7\221\312b;\365\371g\253\211]l\224\017\251,"
+	.ascii	"\323\203\304\202\330Y\210\350\240\374\321\256\031\366yw\344\342"
+	.ascii	"\005\f\030\351\321\246\356\270<\224\350\210p_/\036\035E\220\204"
+	.ascii	"\032\232\251\267\232\231_tF\273\356\301l\214\255\263u\322\243"
+	.ascii	"L}\346\0374\3277(LO\356\362\202\007\222\016{\312M\242\256'\002"
+	.ascii	"\002\374\241#\362\372:\362\223\307\364\350\260\3213&\260\331"
+	.ascii	"\026\235\223\232\350\216\302X\247\320h\333L)t\0207\211\314x\357"
+	.ascii	"\247\252\252\352/\302)\264\211\276\334O;\2738\234\n\273\020\241"
+	.ascii	"A\301\376"
+	.string	"\265\260C\003;\310\325\335\300\032\027\264\353q\356\314]\240_\243sk\313\264\377\370\351\363\344#\264\271\323~\023\251\344\320g\243\315\205\220m\033\272\373\354^\204t+\343\276}k\350c3\030\354\307\034`c]c`4\200@~t\035\307\274\304R ?\272\304\304\302\276\322\375\322\372\362\352\241\303K\254\013G\230q\314F\r0\0344\214:\300\274r\030\277\304z\030\265\020l\330\216\243\230q,,L\3148\204S\337Z\344\016\254krG\244\313\212\023\372\214\031\t=A\r\227!#\241QBk\306v\033\243\325\021\332\330\254\227\325Z\\\235\325(\223l\r\213\t\023\241\321@{\226X\r\346\013\204\306\352\300^\272@h4\320\332\362Ao\331\265\330\205\331\0344\203~\320\254\207lk\320\016\372\214C*E\364\206n\320(\023\351\366\201\263`a\320]\b\020\245\245\206\276j\021\315L\020le\327*W\375\365\r\364"
+	.string	"\275-\211ml\364\020\233m\261\276\240\247\334"
+	.string	"\022\301T\266\311S\026\\\235\375yk\262\212\2626BA[=q\242\240\321\272*&K\250\032AW\365\371\0224U7s\253\023\250\245\215@\320h\335\032\335\201Fr\304@\037\350\363m\026\243\355\nL\032hT\317\236\002md\327\246CE\246z@\027\350\363\021\350\251n\346V\023\350\263\211t\3433.c3\022%N\234H\217\016\350.\243\347\215\216)\200\355\250\221<\245\210c\244fD\024$)H\322\030\320\002\221!\242u\021\360,e\216\t\221\272n"
+	.string	"\217h\321\020\304\005\324\305@Q\026\237\200)\003'\325C\224]\304\032\333\306E\bh\252\302I{\260\373\017\322\001\253\3411\265\267\217\325\261;\314\233T\017Rv\031\027j\035\377\207\3331\206\232\354C7u8\231\210RN\262*;\206\035\037\334\363\314\344\026\316\235\201\371\371\016\230\200Q\003\331\300E\272B\020<bY}\306\330\203@pc\364\354\006@\304c\340\200\244R\n"
+	.string	"}3F;\234\026\341<\006\327\234\345c%\300R|\200\0312\002*w\027Z\f 0Tp\206\251\016'\250\210\025)J\234\031\016\354QC\206\177\020U\013\321\367\267\303\377\243_\362\373@\025\347\203C\035\027\263Y\266\024\200: \364c@\026\0368|;\326\026Q\f\202\214C\240E#m\311\224\034\263\030\201Gt\307\330\032`#\340]\277T\247\004!\304\304\354\237\352\243\376;\247\235\372\324Ua\247\030hr\250\341b\2736\020\304h\013}\354\373I\204\301X"
+	.ascii	"s\263\223\333a\266fv\352`\347\367\005>)&\345\321(\274\317\207"
+	.ascii	"@\3177\021\257\302[M'\274L\270\027\322\001\"\f~\343\246\025p"
+	.ascii	")\0165^lyq\377w,Jp\352xSR%\235\036H }\350j6\276\364\214\t\225"
+	.ascii	"\236\313\213~L\246C\246\234W3\r8:\220>\206\261\005\232c\326l"
+	.ascii	"\217\233\265\315A\376&\203\320\244\260\331A=cl]\253\365\205\317"
+	.ascii	"\207q'\005\311I0\334u\257\036~\354N-\324@\022k\016ig\023T"
+	.text
+	.section	.gnu.lto_ransac_drift.37.cbbee09680497265,"e",@progbits
+	.string	"(\265/\375`\303\003\205\027"
+	.string	"6\254\227I\260\226Q:\364\343\256\037\203\363\260*M\207\355\3015\340\312\334&\033\025\030-\004\251\373\n\032\017\271\257\322\215\333\354+\276}\032\270=\274l\271\264\247\013h?xy\373\307%3\201\377G\177\211#\225?\330}K\b!R\246\024\203"
+	.string	"r"
+	.string	"\212"
+	.ascii	"+\224(X\340S\340\256\3023\336\232\263HF\323\234\300\227eR\037"
+	.ascii	"\rL\251\332Gq\037\356?\007\255\2323\307\211\2469\347\313\257"
+	.ascii	"\324\307\002w\221\037\305\003 ?\332\266\f\002\234s\007\212 :"
+	.ascii	"\222\216\013KO\346\004\3026\304s'Gq5\347\377\234\334\rQ \210"
+	.ascii	"\274\340q\370hA\fZ\361v\272\242\201\036\017\r,\236NtA\201H\362"
+	.ascii	"\245\353\020o\247Z\316\3149\255B<\fwy\333<\266\027\330b*\026"
+	.ascii	"\246\346\234\t|\246\267\230\340\217\370\350\036\037\275\320G"
+	.ascii	"\337\207\374\370\025A\"I\317\367\003\322\241\r\374\3215\262\277"
+	.ascii	"\303\341p\350-\262\277\342\027p\025\177\200\377~\227\325/\252"
+	.ascii	"n\251\332E\325-\252f\251\232E\325+\252^\251Z"
+	.string	"E\325*U\247T]\252\232T\365\250jQ\325+\252UT\037\346\276\244'Lh\234\346$\032J\231?\306\032%l\343\354\225\035#|\317\020\"\324De\313]\355N\331\365T\233Z\225%\205;\023:\327\252\266\024\356\222t4\177\342\221\332W\354;t\224\013+\361\241\347s\206\016H\036\30652\271\343\356\020\245\036\262;\341 \367K\216\304\335\035w\300\323.I7\373\r\007m\210{\247#\333\234\206\203\3017\341\320rr\310\217\273gaD\357C\347\223!\212\267\220\324}\024\245\247\235\307\200\241\373:\272\322\210\202\372\260k\344\003\377\302(\031\t\322(\266kw\021\025b\267\033\232\255\246\244\020\273\335\320l5\245\315\016\355&z\0263\223\365\360\310l1\235\032\354\026\001\207\246s\003\343\241\311v`3[\017,\206\200k\022ll\260[\255f\203\255\200\363\342\334\"\253\250?r\022\351\bSp\374s\344\227\316"
+	.ascii	"\311\023Sp\375\034\371\262C\266_\3263@\253\2638\347\234d\253"
+	.ascii	"\201\313\256l\253eY\326\205\265\256m\331RX\204\b\353\301\205"
+	.ascii	"8\030\204\005\302\201@\255\354\030\345\004\312o\265\276\017\007"
+	.ascii	"\016\276\310\234\363\001H\250QP\002\215S\206h((*)i\003\360\""
+	.ascii	"\021\252\362\020PF$$\326\001\2704\t\202Pl%3AWH\033~\365\346\252"
+	.ascii	"\302\370q\333\200K\355\344\344\244\350I\nxm\030x\327\223\034"
+	.ascii	"\340z\325W\225\210\254\253\036\332\332\0132+\324\313\305\303"
+	.ascii	"\370e\355\334\036\\E?,@\217\351\237\354%/A\353`\240-\036&\372"
+	.ascii	"\362\007N\3651\374\250a$\211\377\203D\210\267R\003\263\356\020"
+	.ascii	"\303)t\356\2155\355)lS&\341\214\336\245\252g*"
+	.text
+	.section	.gnu.lto_.symbol_nodes.cbbee09680497265,"e",@progbits
+	.string	"(\265/\375`\273"
+	.string	"M\b"
+	.string	"\344\013\267\001"
+	.string	""
+	.string	""
+	.string	"\002\036\177!\360\372\2508\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\200\202\202\200\006"
+	.string	""
+	.string	""
+	.string	"\005\r\"\200\204\001"
+	.string	""
+	.string	"\003\002 \177#\020\020\005\021$\033\177%\340\301\257\030\272\200\202\002\013&\201"
+	.string	"\005\f'\023(\200\003\005\024)\031*\002\035\177+\216\345\264;&, !\177-\250\325\252\325"
+	.string	"\022.\005\016\025\017\023\025/\005\0260\002\"\1771\200\200\200\200\004\002#\1772\242\377\272\t\005\027\026\005\030\024\002$\1773\002%\1774\377\377\377\377\003\0025\201"
+	.string	"\003\002"
+	.string	"\264\243\256\027\001\302\016\003\r\013\"\003\024\r\343\373\247\002\001\302\001\003\024"
+	.string	"\302\022\342\022\003\024\002\261\271\207\003\001\342r\202s"
+	.ascii	"  \300\"\232\262\033 \251\224\260\266\256\302|\224\301 \204\234"
+	.ascii	"v\023a\307\330>\fM\347VsP\206\0347\306\003\223\361W\036\r\234"
+	.ascii	"i\007Q\3422\302\034\"\200\022\341\0066\t\354 I\262\341h\211\211"
+	.ascii	"q\363\370\200W\224Z\006"
+	.text
+	.section	.gnu.lto_.refs.cbbee09680497265,"e",@progbits
+	.string	"(\265/\375`\270\001\265\r"
+	.string	"fc\\;0m\232t#\265\344K-\236f\326\034\235\321\254\365\310\302\300\300\300\300\300\300\300\300\300\300"
+	.string	"\234\030\254\232\3335!\017\235\020\237\307\307\370\377\255}\230\231\331\370o\326\312}k\211L\001D"
+	.string	"J"
+	.string	"U"
+	.ascii	"\324S\372Q\345{\337\372,)=#qL\304/\020\317\312\261rK\371E\371"
+	.ascii	"Un\225W\345T\371TnQ^)\247\224K\345w|r\3749\356\034"
+	.string	"o\307y\234dc8\355\354y\313\341\345\355y\302\3477\007\001\227\304%\351\273%\3448\345\270t<:\016\035\357\361\353O\312\235r\366\013\312\005\312A\312?.N\300\342\003\".\340\336\003\342\001\3567\034\276!\327\270\327\334gT<s\217\271\277P\034\273\267\334O\023\257L\034z\370S\213\313\001&J@?\211\021\"Bd?\210\017\036\312\357\200\375%Y\373\222\nk\317\201j\277AC\377\f\345c\270\220\361-\\\374\n\327\037\201\377\203\252M\202q\006\030\037\261\270\210\365\t\236\377\340{P\355\016\247\335Q\2659\2346\007\325\336L\257qx\206\3031\234\3178\037\177\365\255~%\365\241\376U\306HOa\202\004\b-o\320')\037\351\213\364\027\364\025d<${\004\031?\220\275\001\214\203`\377\201q\017\354\001<\277Qq\215\3525\024\277\3603\352-\320_\375\351\243\347}\331\374\n\025)P\234\210\376\034"
+	.ascii	"\"D\036\260\030n\221B\260\205\205\340#\020\313[\234\205=\227"
+	.ascii	"\276\272Q\226}]\351\302^\260\005l\201=\260\f,\004+\266\354\002"
+	.ascii	"\213\300z\206\332\223\262V\004*\242Z\374\273fN\317\345F\323b"
+	.ascii	")"
+	.text
+	.section	.gnu.lto_.decls.cbbee09680497265,"e",@progbits
+	.string	"(\265/\375`\211\030\355m"
+	.string	"\232\256"
+	.string	"&O RJJ\007\333\271yR1\023\361\312\274}f}H\307F\304G\306\240\236\351\002\231\221#\003\"\036\225\327\363|\374\362?\030\310O\030u\2528\343\214\272\013\210\031D\315\314L\315\314\314T\325\226\320\326\315\314IZU\265\377\377\230\333A\210\224)\365\001R\002]\0021\254wae/\374\205[\"\206\352\034\333kf\f\302\006\246\325\227\260\236\211|@L\344\273\007\3539X\257\301z(\215\365\026\254A<\344C \205*\241%g\016OL\215\226\237\333\330\215\263\334\300]F\222\bs}\364\242\350\345\265\312K\016\300\007\300s\005P\033\304\352\b\333\332\216\020 9\326\376'\247\235\325\030\313\325\262%\031\363\336\033\324Sw\267\346l\225\005\007\340S\215\320\234<n\322\236\034[=;\177>\343+\177\366\362\336\343\275w\200\235(\316\302\264\212s9"
+	.ascii	"\337\333x\310\307fFg+C\276dV{\201x\324\270\274\371ju\210\207"
+	.ascii	"\252\374,\306M.K\221<\226\327yo+\224VM\271{\266\312S\230\n\267"
+	.ascii	"+\230\3540*xZ,k\233\367\266@=>|4Y\266z\b\326\363\330S\030o\005"
+	.ascii	"\357\365\274\302\307{\274\302\367\226\003\360\255<\344\013\262"
+	.ascii	"\321F%jq\005\3766#\002V\215\032\326\256\270\007\357\300\340o"
+	.ascii	".9\274\361\024\233\220\343\377\003/\372\033\354\347\r\216w\373"
+	.ascii	"\237\305\306\332\001\370\333\212\3544\374W\361?\305\201\376\016"
+	.ascii	"b\201\037\033R\037\372\373+\b p~\336\371Y\375\271\347g\236\237"
+	.ascii	"\201~\366\375\234\363\263\317\372\363\317\317B?\007\205\371O"
+	.ascii	"\346\177\231\377b\376\217\251\373\002\177\013\361\363\017?\373"
+	.ascii	"\360\363\323\317M?\347\360\363\321\317\277\237m\370\271\206\237"
+	.ascii	"g\3709\206\237a\370\371\205\237[\370y\205\237S\370\371\204\237"
+	.ascii	"k\374<\302\317\036\374\314\301\317D\377\315\374\334\300\317*"
+	.ascii	"~\206\342g\235\377v\377\261\374\277\3623\005?\303\370y\202\237"
+	.ascii	"_\374\207\376W\341\347\b\376\333\370\271\305\317\020\374\354"
+	.ascii	"\300\317\f\374<\364s\212\377h\376\237\371\377\302\177-\377\331"
+	.ascii	"\376\257\375w\376O\341\177\331\177\031\377\271\374\337\331\333"
+	.ascii	"\333\333\373qn\370S\t\376 \273\004X\335\255\242\333\324\275\355"
+	.ascii	"\254kS\"\315\272\226Fngf\314K\325\026\231y\311p%W\263\"\331\345"
+	.ascii	"q\357e'V\246\022kM\253\235\204\216\030'\2108[}\n\005\n\224^\302"
+	.ascii	"B\367\036y2\235<y2%\232\204\3316\263\227\244\310\032k\236K/n"
+	.ascii	"\333\213\235:H\265I%\252U"
+	.string	"D\333E\260\026\242\366\026Y\030\243\322\303\273\311\244\213\247WM\330\216\216\311\333\020&KX\2114[\364Z}/\371\323\251c\005\212\267\255Va\030\275\225\370\302\2240\342&I\023\301\303NJG{\344q\262W\304\023H\232H\217\221\231Dk\3651\350\302\260\b\201\306\314r\0321\227\346\026 k\314 iL,\334El\331E\272\253\271z\253\215\364\020}\204\333&\322Z\347h\017!\322B\246\b\001\227Z\355\025\271)\324\276\335e}oY\337q\353[\211\365\355\266\276\327\326\277\177\344\211\301u9\033\253\253~\312\262\302\210h\325\250/\223\250Q\027\213`5\303\342\236\370\263\b\030M\254&^s\257I\2147\234\307\320\254\233\242\371\212qG\205\311fJs\r\203\3719\266W9\303\211\325\304\373{\252wt\216\266j\036\235l\252Fv\217\326\321>\372\252\225\334vU\033\337R}4\322k\025\360\302j\206U"
+	.ascii	"\243\202\256b<\316\373)\006])4aX\332\210mQ\363\267\237c\320="
+	.ascii	"z\241E\243]\305N\374\371sle\030\303j\206\335{[\264h\361sv\246"
+	.ascii	"\314\225\n5\235\240\203\254o\037\353\371\315z\276[\317u\3539"
+	.ascii	"\314\312y\315Pp\024\347<v\323s\274\234\247\336kdN\340\2079\001"
+	.ascii	"\2347'\306*>\365\374e=\307\255\347\266\365\214\266\236\313\326"
+	.ascii	"\263\330z~\262\236\211X\317C\254,\322\020\371\270\021#\025\206"
+	.ascii	"\346\214\216\027\022$\2203?\2771\034\333\245C\250\260\335\265"
+	.ascii	"*\206\313p\035\217a2l\206[\266c&\316Mp\230\253\355\275G\272!"
+	.ascii	"[\270(a\306\230\373\223\241Nf>i\022]\202\3010\324\031B\330V\364"
+	.ascii	"\336\366\334\374\215\272\374\371\243s\257\\\221s\334\331\216"
+	.ascii	"\345\376T\241\343^9!<\305\275+qx\367^\002Z\360\270!s2\366\243"
+	.ascii	"2\001\001d\2320\022lQ\322\306\354\354\372L\22220\242\\%\317p"
+	.ascii	"\236\216\021Gt\3618\202\t&\272\356\212\027\225\036^\216\234\021"
+	.ascii	"?\216]\346]\267D\304\226\266\325&\323\323\206\n\332\030_\024"
+	.ascii	"wh_\255\266\230\037\255\266$\316V;\314\237\351\223\356L\261\325"
+	.ascii	"n\342\317\2351[\252da0\2777&x\255\036'\t\0300\177^J\333\326\227"
+	.ascii	"/lQ\345\022K\240\341Hq\341\322jHT7s\347\266\347\232\210z,\273"
+	.ascii	"E\336\222\313r\341S\347\005\317\031\215\213k5\256\322\244\322"
+	.ascii	"\303\003r\323\022C\002\356\355\255\301\256s/\327\0343M\213\026"
+	.ascii	"\006S#\204,j\321\233l]\\\rss\373\263\0063\233iQu\311\363\334"
+	.ascii	"\366\263\253:p\342$\243\260\227\334\217\266\"km\257\361\2315"
+	.ascii	"\007\022'\353+z\223Y.\032\356\312\250\344GZZ\253\255\367^;\273"
+	.ascii	"\350\315\312\"\342\262 TRl\336j8tP\274\322Z\275J\345l\333\371"
+	.ascii	"7\365\272x\372\246J\225>C\"\305\312\373\314'\313\224\321\252"
+	.ascii	"\3256c6\237+\267\b\226\03222v\326ho1\203\246\231\365\035\326"
+	.ascii	"Q\336R\332\226\322ck{}\344ty\311J\022\375M\345=v4=\3676\357\275"
+	.ascii	"*\3221mJ\252Z\355)\314\366s\247\2143\242\325nr\025\007\260\364"
+	.ascii	"\204\264\332b\177\363\205\351R\267D\253g\243\263\032\001\247"
+	.ascii	"#\t\272\365\375\373\2561y\357\275\302ioR\252\347\214\303>"
+	.string	"\234\262\002\377\325\233j\320\304\275S\216\334\255G<\215gq\037voQ\350\2667\2114\343*\"\255\320)\205\332kd\200kv\344\"[.\245\272\274}\333\313\367\310\245\334\001\331.\223\310vY\f\272\307e\361\336V\031\204t\032\213\2144\343R\"\315\226J\241{\274\305kf4\262\036\227Jd\227\2452\bifT\"\217\\J\241\346\221/\255\035t\\i\330\ry\274=\254\266\214\311 (\262]^2\367\262s\352&\025\270wk\231$c\024\202\333\244\240=\244\260\030\227\334\336{\013\260\222\352Z\336#\024\tey/\024\251\245kEA\261\205\336%\f-\036\331\272<\246\3565\340\266\367Z\335[\344\013\275\367\026\357\2759\311\255\366^\255 $\323\312\352\336\254\2540\230&\t\217x\206N\303!\220\005\336\320\371\322\013\024l\224\360B\021\013\2741<bY\350\200\344\304\004\002p\350\004B\023\220%F\275"
+	.ascii	"\304*\005\207IJ\301%\"\016 K\344Y\">\341\210\202\372\r\207\300"
+	.ascii	"\035\"\220\tG\323\021\361'\364a\203J:@v\230\264\016\201JJO8$"
+	.ascii	"\341x* \t\b$\362\020\237~B\303#\226\3703L\322\331a\201D\340\360"
+	.ascii	"\327\303\n\237\234\220t\210C`\220I\030\004\n\203LG\n\016\201"
+	.ascii	"B\340\215\365\024\310\220@\306\f\250\234\317\2401\001\215\t|"
+	.ascii	"\237A\303\310\210\206\f\243\3652\214R\366\007#\306\n\005\025"
+	.ascii	"\365c\211@\034|Q8PI\301\245\027C \313\024Tb\211\002\364"
+	.string	"\300P<t\024\017\335\003\017\035$\342H\2774"
+	.string	"\324Q\323\217M\362\261\304#\246\237\222\323\017\n\230$\f\n\001{\b\256B\247 {4\004\262A\235(\342\023\016*\223\223\323\007?\234\033\302`\222\020\210#\007*\3527\034:!\371\240\242~@\366h\350\343a\205H?6\250\224s\004\356\204\0038,b\235\234\206E<,\322\323\220%\376\224\236p\370\001\221\216\206@\241\3230\351"
+	.ascii	"\225\375\021aX\211O?`S\220\315\201\342(\206j\352\250\246f\217"
+	.ascii	"\234\230\224p\330\337\fV\030|\312\371\005\027\200\300\002\006"
+	.ascii	"\025HX\221^ \035\021\205G\303\037\223S\021\273t#\310\244T$\f"
+	.ascii	"\0365\025!\r\211E/V\3748SC\007dM\253i2Ur\373\267\364\352\307"
+	.ascii	"\313\0301d\230\254P9\177\363YY\245=V\027\272\244=\032\254\016"
+	.ascii	"\f\3725\304\212D\246;R\334\345\275\314\234+V\264\242UOw<wv\330"
+	.ascii	")\021\323j\252\203\331d\350\311\3211\233\357\316-\314\313\217"
+	.ascii	"\326G\363\255\307\224\232\212&DIW\232\243\307Z\f\025\027\260"
+	.ascii	"V\323bZL\245j\024\245\234\244\306\247R\177\033\202DyT\201\270"
+	.ascii	"\211\371\252\326?\275\r\266\242\241\201\356\330\003\323\245,"
+	.ascii	"\n\2707o\032\254\003\3475*\211\342n\232'x7)\347B\310\t\024l\256"
+	.ascii	"M\233\316k2\267\302I13\325P\274\363\200\276\250\321\235\265\332"
+	.ascii	"n\312\250\315\305\265\332xgS\243\224\265\331\302\222&M\263A\213"
+	.ascii	"\342\213\r\224\254\2737\033~\242\327\005M\253\355\304:\306\251"
+	.ascii	"\245\327j\257Y\303\312p\275i\265\325\340\220!q\243k\265\243@"
+	.ascii	"ld\001\202+\250\002\0325\005\2452\206jDD$I\222tB\n\020\210!y"
+	.ascii	"&\314\336\001\022\340\265DRJE$\"IR\220\032\255\001$\215\366\203"
+	.ascii	" \370?\003\224/\025!\201\277\323v\002t\216\230\013\347B\316g"
+	.ascii	"\237\353\t\255\333y\336\227\366%\230\027\261\0026\240\251\311"
+	.ascii	"\215x\252\2635\177>\240\242S\026\017\273\226\031\246\243q\200"
+	.ascii	"\fR\270\347\336\243\210\002E\037\225d\241l\302\327\367Y\b/\362"
+	.ascii	"k?\202\323&I\232O\210=\262q\035\003P\355\346\245\374\235\220"
+	.ascii	"\361\216\\d"
+	.string	"\036\221X\276\316\302\312/Oc\352\354\367\360\227\350\356\336\025\362~\322Q7\321g\321\207\236a6\215\353:\275\345\252'\272\213?\005|\361\214\316=\334\0310\204\212/\\f \354\320\317i\244Pp1\0027:%\307\023\024\375\300=\004\245\204\300\231u_\373\006'\200@I\016>\332\355\244!\022i\367\336\222\021\262\326\341+~\271\325\254\200\215\253\336\253<\246xu)\276\276\304\241\236*\032a\003\0360\002m\"\347\0274\2076\t>b\200\225)U]\375D,[\233\214\317P@\017\2157\244\030\230\212\330K \213\207\217\252\360\377\203\334y]lI\375\037n\233P\201k\343Y\331I\237(\212\220\036\273\232 P\207\332E\241\" \340\367\027\020\f\302\245A\270\375\216\226\311\263]!\201}\254\001\314\212n9\232\2147\361;:6\226\021p\364\344\211\023l\241\003M}#\237\377\352\214xSC\272\254#\357"
+	.string	"\3661Y\327\030\262\313L\247\354\025\003\265\356\276\2222\030\345(\305|\325\325\370\272\270\320\362\263|Y\320\276*\335\f\304\310"
+	.string	"\325X.Q\260D\312\022\256\333\240\n\2240'_\245\354\271\006\036M\200\265K\267k\004\202\303\213\203\266\013\".i6\372\\\033\020\333\001#\177\3469\035h9\004\265P\320u+\001A\206\271]\210\375.\271\272\352\313r\246F\027\355\\\306\023\251\313<\273\2764\307\214PT\345\023t\372\201`GU^Y.\207\353\216!\303\034\267\200X\200\211g[\263\001\343"
+	.string	"\310X\344\201\350\261gE\351\206o\375\333V;-~\312\203\005\016\361\314\201\374\006\1771\004nP\236\001b,\343@\311X\340W\362\353\f\317?\032\035C\364\306\243\335\352\302\244\352]\240\007d\337N\224yD?^\001=WU\274H\250\217!\366\353\020\313\304\235\325D\251!\271\331K \210\216\307\016\023.G\020\022\002\311>\212\255P\216\255\325\035"
+	.string	"\022s\315\360r\337\023&\035\307bT\237\226\202\261\331\227\037\315\017U\0045\025\227\027M\357\bL\004\240\031\226\b\334\354\013\260\376\032\001\310\202F\344?f+\240\240\204\315]\220\301\271\316\233\227[2cO\031\033\005T2\024\367\267\025[\030\271[,9`\227\267|$\323(q#x\023\bQ\233\322\007\255\004\250f9\255G\243\271H\035\351\336\237\365d\022\033\333\316\025\300\203\251\233\245\341\2363\001v\036^"
+	.ascii	"v\320\017\366owx\365.K\330\033=\332\274\235[\376\205\377N\274"
+	.ascii	"\332\363<\217\310<\372\247G\302\224a\002\317\317\317s\254>\266"
+	.ascii	"\261\347-\353C\364+\266py\310=\250\267\020\366u\362q\376\316"
+	.ascii	"\256U=\007.\342\2378$\372\265\277\203p\250\351\265\334\322\332"
+	.ascii	"\2017{0\326T%\227|2\370\\\232?\235\233\377\262>\213\340\251d"
+	.ascii	"\342\311\254\376\313\274\311\377\22008>\307P\277\220\034QN`\370"
+	.ascii	"v\302u\027\037\220\336eM19\ff\225\337\200\374\312\301\254\240"
+	.ascii	"g\265>\362\210/\363\317\355\263\272\323\374\013\356\322~\303"
+	.ascii	"o\327L\300\357\344\365\361\251\301\016\236\275\016?\322\013\315"
+	.ascii	"p\316}\230\335\233\236\350\2671\300\270\202fm\334\201\305\353"
+	.ascii	"v\177\205\301\342t\275[\233g\207\217\231\273\177\346\332zq\323"
+	.ascii	"\312p\371\216\236#oH\032`\006Q\374\266\035\342\333\263C\331%"
+	.ascii	"d\257\373\243\335\355\227\334Bx\b\316\036\367\t\370\266\237\005"
+	.ascii	"nz\361\235&K#\240}\2446q\1774\255"
+	.text
+	.section	.gnu.lto_.symtab.cbbee09680497265,"e",@progbits
+	.string	"ransac_reset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\001"
+	.string	""
+	.string	"ransac_buf"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\340\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\001"
+	.string	""
+	.string	"dr_ransac"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"0"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\001"
+	.string	""
+	.string	"ransac_update_buffer_size"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\001"
+	.string	""
+	.string	"ransac_push"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\001"
+	.string	""
+	.string	"ransac_step"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\001"
+	.string	""
+	.string	"ransac_shift"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\001"
+	.string	""
+	.string	"ransac_drift"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\001"
+	.string	""
+	.string	"dr_state"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.cbbee09680497265,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,535 @@
+	.file	"ol_trajectory.c"
+	.section	.gnu.lto_.profile.1db0c4ed2de8cfa5,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.1db0c4ed2de8cfa5,"e",@progbits
+	.string	"(\265/\375``"
+	.string	"\325\004"
+	.string	"\324\005T\001"
+	.string	"\013"
+	.string	"\262\241\206\374\006\f\002"
+	.string	"\001\261\322\365\270\005$\002\001\252\372\231\332\016\020\002"
+	.string	"\002\002\003\324\353\353\204\003\003\004\240\342\234\212\n\005\200\271\306\377\004\006\002\004\002\004\002"
+	.string	"\002\005\006\007\b\260\220\337\332\t\016\004\003\t\303\336\336\270\017\002\n\241\233\267\260\r\"\004\001\006\001\004\002\003"
+	.string	"\032"
+	.ascii	" \013\310\0072\003Y\362\r\242\306ASmt.\3039pJn\345\330\250\331"
+	.ascii	"!4K\221\343y,\260\356N\002c\330\262c\274\031\300N\032z\022h\305"
+	.ascii	"\002P\237\234B\005\030\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.1db0c4ed2de8cfa5,"e",@progbits
+	.string	"(\265/\375`\001"
+	.string	"\235\003"
+	.string	"\324\003\365"
+	.string	"\b"
+	.string	"\006"
+	.string	"\001\001\005"
+	.string	"\001\002\002\b\002\007\002"
+	.string	"\020\004\001\024\030\034(,04\004\001"
+	.string	""
+	.string	"\001\003\001\002\200\002"
+	.string	""
+	.string	"\002\003"
+	.string	"\001\005"
+	.string	"\003\b\001\001\t\n\004\001\001\006"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030"
+	.string	"*\002o\030"
+	.string	"\006\222\300"
+	.ascii	"\340[)\001\006\266\314FP\013\350\001\021%\260|D4bY!(\030\f\f"
+	.ascii	"\001\343\300``\b\230\253\022x\220\020P\t\f\260"
+	.text
+	.section	.gnu.lto_.inline.1db0c4ed2de8cfa5,"e",@progbits
+	.string	"(\265/\375`a\002\305\f"
+	.string	"&\023B<P\305&\215\001\224XK\244|\025\003\337L\370\233\033\357\246\016/\267oK\324\032T\312t\371\377\355\274g0\020E3\236*\354\023\266s\343\347\020l)VgQl\264\233\264-\345N\001,"
+	.string	"2"
+	.string	"2"
+	.string	"\031o\031\332]\315\030\017kZ\335\331\254\301\261kO\306\363\364d\267\273\327k\272\273[Y\t/\357\217\371\364\262n\212\332]\316\307\325!\035\003PRZN\241\240\321)\265\240YC\272\246\354L]\350\267q\255\310\225"
+	.string	"KR8\341\360\204x\237d\331]\204\3372ew\033\340\353\230|?\206_%\022G\013\347xR\"\202\322\344\353'CJ\036&\327\227\337\243\233\377>\326z\306]\272\303\314}\373\266\32397o0,F\270\204~\214N\007\364\204\001_z\306Y g\\\365\211a\"(?\r\240Ev\""
+	.string	"\242Gr\221*\032\002\020\234\340\314\027dD\246vV\346e\334\031wPmT\277i\001\002#\006\022&2D\250AH0\325H0\022\250\335\034\320\002\231\032:\007\022\340\3448\005\343\304\232I\025\226\326\267v(\002H\",\334\222s\2400\021\006F\037\"\300\270\275\2552\037\005\320b\242\225\001m\002\365\261{5\370\303~\363\017G+\245\2248s\211K4AHI{,r*\022\351\026\270;\"O9\003>\347'\304J\001\037Q~"
+	.ascii	"\233\025\177F]\234\304\370\"\314O\320\314\372\nR'0*\264\262 "
+	.ascii	"'\320X\272s\307\305\222\230PM8v\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.1db0c4ed2de8cfa5,"e",@progbits
+	.string	"(\265/\375`\353"
+	.string	"]\005"
+	.string	"\202\b\032%\240%I\007\377\347:7\277l\f"
+	.string	"@\354\037\203\315\377\337\267\026U\215\376J\370m-\273\232%\2665\322dJ\001\326A%@\352\bo\211\325\317?Z\234\305\246\006\033\216G-"
+	.string	"\001\037\274\301\333\002\005\006td\324\214\362\214\262\255\241\306Q\263.i\205|\322D\021\325\245\325&\3427}\026\236\223\323\312\225\342Y1yB\034"
+	.string	"\250\207\211\261"
+	.string	"S\020\344\020"
+	.ascii	"\347\362\334\004\373\022a#\275\360\214\270x\023\030\370\016\204"
+	.ascii	"\f\202\300\001\002\320\207sc\340\023\020\356O\214\212ZSK58J\330"
+	.ascii	"\316\203=\255\246\343\bZ\326\300\020"
+	.text
+	.section	.gnu.lto_.pureconst.1db0c4ed2de8cfa5,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\b"
+	.ascii	"\232\004\001\232\004\002\205\004\003\230\004\005\204\004\b\271"
+	.ascii	"\004\t\230\004\n\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.1db0c4ed2de8cfa5,"e",@progbits
+	.string	"(\265/\375`Y"
+	.string	"\005\005"
+	.string	"\022\307\023\031\260%\351@ \f\003]\222\314J\223b\216m7U\260\226X\322\366\2262\005\277Qn\264\276\363\213\024\356\316\004&\320K\242\260\362\327i\312M;\024\3657\241C4/ah\320n\247N\013P\376\344\370\006\316\304\304t\236\227rr\220\313$\004$ p\002bF>0\2734\202qM\314\334"
+	.string	"\225\263\255[\3123\304\200\275\317\203\251]Q\226ge\255u\033\232\203\020;@$\356%\002\032d\007\236\n\346\330\242\026\f\271\362\265"
+	.ascii	"kg{\257\230b\016\343\224\n?\272\346\306\260\224\202\017\001"
+	.text
+	.section	.gnu.lto_.lto.1db0c4ed2de8cfa5,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_quintic.9.1db0c4ed2de8cfa5,"e",@progbits
+	.string	"(\265/\375`\266\004\325\030"
+	.string	"\246o\234C\320\326Icp\003\234r\271\236\370\352\372\336\240q)\017\r\2439\354\243\250\222H\206\313m/-4!\225\211\274y\2145\330\301Y\030M\222FM\024\240I\321\023\203X\300U\177\375\365\337 \226\354\235RJ\001\220"
+	.string	"q"
+	.string	"\212"
+	.string	"d;\325[\201\220\245\312\006\005\252#\0017\232&\220RG\334\213j\323\023\216&\357=\003\355(\201?Z@\210\342\215\213y'\222N<\350!\245\001\217$\fl\253\216Yw\360F\330{D\246\252\336{\007\270\340\325N"
+	.string	"W\223uj\216Y\237HU\231\367\230\234\252\336\263\035 \320\253\035m\265q\265{\225\306\325\2163\222Im2\236\003\032&\240\262\336{\262\307\350\254\236\261\005R\230R\n\022\265J\204\367\036\255\224BE\371\222\214\221\254@v\020\002\264\246$o\2216\022>\f\262\334;\023\331\250\366\247<\332X\237\332\001\225*}JU\366\364G\313\323\252r\247;\332"
+	.ascii	"\355\321\002\260\251c3\307&\216\315\033\23366kl\322\330\234\261"
+	.ascii	")c3\306&\214\315\027\233.6[l\262\330\\\261\t\263\371\262\251"
+	.ascii	"b\323e\263\263\311\331\274M\333l\001X\r\032\037\357\241\330\232"
+	.ascii	"\362\256\272 4*\325R\265U},_y\313\037\345\255\260\234;r\265\362"
+	.ascii	"O5a\202\375Pn\257\263HZ\n\245\344\304\347*\177\275\264\"\217"
+	.ascii	"s]\345\235\022Z\255{\357\272\255hM\334\273s\277"
+	.string	"\317\375JhK\266\330\177n\352\275~\356[\253/\270R\342=\244\330\316\373c\371\240\325n$\035c\207\274\262\262bg\2558\0276X \261BfN\274Y\306{\2573XR\271\332\345,Ia\201\344-\366\234\347>\277\021\236\363\274\347\027B\253\0058\200\357\374On\001\030\252 \310\013\202\034T\240\021\006\"r\202\021N@d\241R\b\301Q\321\220\221P\006\017\027\212\214,|\030\222\031q\330\320\341\203\006Y\210\016\027@\310\204\212D\310\020\020\340\020Q\206\"\231\321\320P\221\214\305\366\312\2753\261[q\205\364$\352\234]R\223s\234\353\234\323\352y\316]S\264\332\315q\316i\331|\34676W\211\232\333\274\264\032\315k\316Y\375<v\032\333\314\2175D\346,VL\314a.S$\211\3471W\201\242\325^\016\363.\212\313a\177\271\217\320\226Z\356\362n*[\250AhE\220SbCAQ*\205\326"
+	.string	"\003\021\251u\016\021\300$.\025\321)4\f\233\001s\0300\006W\350\205\217\340x\004\3753:]\201\2052\242\372,\266\237(\260y\002.\251=4\214\220.m\243DF\362}-p\233\254\352\373\231\355\212\023\276\254\355\033\330\214/\266:\210\337pLGM[|\037\n\303\232\304\257\222"
+	.ascii	"r\247\207L\330\205z8\305\276\324\217\3778K\344\220\206\212b\""
+	.ascii	"d\005\224\262\"I\210\031z0CeVt\032\365-\373\350\f\037\315>\247"
+	.ascii	"a\354\022\206\332\273\254\\\245:9\324\";\177"
+	.text
+	.section	.gnu.lto_peak_acc.10.1db0c4ed2de8cfa5,"e",@progbits
+	.string	"(\265/\375`z\006\025 "
+	.string	"6\373\306E\240\332I:\240\353\200\223\203\350\227AH\202\335\023\244G:\241\017\031"
+	.string	"P\232c\\\177\243\230\276\335]\240\307\364l\317A\223\030/\307x9\316\314W\3217\253\261\2769\246\037VXa\205\025\326i\243\021\"SJ\001\272"
+	.string	"\216"
+	.string	"\302"
+	.string	"O|\326\235_\332\00335\007Mx\271\234\030\251\254\361\300Z\302\203\302\306"
+	.string	"\347\320mW\235\304e\335!\353\017\214J\314\303\007\025\005cE\313\365\200bOG\22521F+\207\275\302\375>\322\037\b\024\303\274n\234\305\030\t\024\201\337\272\210\215t\331G\002\t(\366\220\2708\213\321G\240\006p\016\353\303y\210\211t\265?\320W#\007\203'(\222\254\2111\352r.\2729\004=ts\2304\032d\320\347\202\357zW\2353\324\200\211\225p\bf\031\0210>b'@\006A\220\264\b\023\363:\330\203\205\323e\376\217501\026>N\203\030c\017&\266\302\275\271\355\256-\204\366&$c.zd\312h}%\3164\244\313Y3Fk\345%\256"
+	.string	"7q\253l\346R\331g\007\360\317\005\340#\366\324_\251\277QP\036ss&s\237\376:\375m\372\313\364w\351\257\322\337\244\277H\177\217\376\032\375-\372K\364w\350\257\320\337\240\277@\177\177\376\372\374\355\371\313\363w\347\257\316\337\234\277\270\2778\177o\177\303\277\340\337\374\373\277\036\320\223\206\250-F\025mn\"\226\020\312\016/\261\233\330f\366\317\036\263\311|k\335ZI\315\304N\034CbxWa\204\2002\210\215\367\344\301^\232\200\022k\007\233\237\004\223*o\346\223?\t\276\351\311[\372\344\355\315\327\013\236\354I\234\264\235\304%O&q\371z\341\005CG'w"
+	.string	"dN\352\244\322\230,\336\302\263\232\226+aNZ\315\206\017\207\223\270D2K\363\032\317Nj\250\231\254\006\210\223vb\303w\013\363\226!\227\002\266\302\273\252\242\013\363\352\013\230\tf&\211\342)\274'\266\030{\013\332\017F\003\201\213\261\227@J\027\217\020Ml1F\347pX\223\2709\274\213\226X;\204@\371\271Xmmmz1\232\220z\002\310\233M\245\363\351/\037^ok.\235>\363\024\0322_eL\274-\265\004\\\026\221u^\326\017d=C\026\205\016\240\226#\370\203;\241"
+	.ascii	"ok\3075\201\002\206\254-.\t\032v:\256\013\026\2644T\320q\320"
+	.ascii	"\312\332\240\233\260\365AW \252\273\016\024\266t\\\273\335\226"
+	.ascii	"n\307\027\r\202O\t%\2259\023\351U\235Ce\273aw3\230Tj\245a\351"
+	.ascii	"e\2110e4\264b\005\344V\316eX\301\214\312\033\216\024\357\257"
+	.ascii	"\355\245\2362"
+	.string	",\227#\220\200\351\275\215A\260\003\234K\253t\231\247\320\326\276^<\245\200\214\312\376+\215S6\245\200\252\254J\247\004\323\250\222*\233\022\247E\031S\006e\325R2)\345P.%\245\022R\026e\322Q\"\031\345\321\031\236\325\314\\1\"\312\2422d\210\2042r\250aL\003\215S24\242$\205IZ\016\320\002\021\"\023\035\021\2604i\250\252\211\212QQJ\007\361\340#FR(4I(\262\320\"qF\306\3442%^\255\023@\302\222\205!\200I \001\3314c\003\362\"\024\361D\314\310\275\221E\tKB5\037:2l\324\272\273\013\314\257R\245\306\266\222u$\205\376\2615]\357l\214\334\341Tn~\305|\005\207\303\244\034\\\200\345t\264\365\307\003\026\203\276\375\253\263#\033\030F\354\361\216i\266\263\345\017v\325\210\326\21358\231\205}F\331Q\013\264\b;\244\321\006\026@\3152vz\n\005<"
+	.ascii	"v\356O\277\377\326#\374\333\027\352\364\212\361i{P\1776\002\t"
+	.ascii	"\222e\223\324\026\263P#\322Uh/\220\270\242\322\232:\031\212\016"
+	.ascii	"\033Zv\225o\r\263\257\200\016\001\377"
+	.text
+	.section	.gnu.lto_ol_trajectory_build.11.1db0c4ed2de8cfa5,"e",@progbits
+	.string	"(\265/\375`\237\020\305Q"
+	.ascii	"\252\222\210\037H R[\031\016%\203\236\256\376L\372tu\217\333"
+	.ascii	"\0324\260S\332v'\303\270\237\355\203R\200\325w\"\330\372\350"
+	.ascii	"Aa\200\345\f\t\255\250\235u@\256<jP\357\0368\206T\376\216\274"
+	.ascii	"3\007\203\371C\"!\233\354\235d\222\001\355\001\253\001\357\001"
+	.ascii	"y\\\260#[\317fd\373`\373\261\377\330\201\354:\333\316\276\263"
+	.ascii	"\361lC6\";\221\255\310\246c\327\261\355\330x\3549;\217M\2506"
+	.ascii	"R\367\351\320\021\261\215\205=\263E\352=\367`>\035\372@\246,"
+	.ascii	"\310\250\314\0312\275.\025\300\202\336\243\316\301\200,\310\203"
+	.ascii	"\254\203\t\271\220\017y\007\363\340<\035*R;\323A\242\342\027"
+	.ascii	"\242\265\275.Cks\\xf\204\274h\335u9\221\2110\211cl\316L\261k"
+	.ascii	"\203A\035\2417\027\004\3522k\243\243\344\017\0076\3173a\261\r"
+	.ascii	"\320\236i\302!\361\243t\301\260\263\240\234\266@E\350\314Gu\250"
+	.ascii	"_\336\2436jx\364\245:4\271\266\3017\370\216\345\214\203\365\350"
+	.ascii	"0\217\332\220\2712s\023\340Q9'\241i\372Q3\007\201\035.qfTuT."
+	.ascii	"\030vv\342l#N\321Q\272\321\244CE(\204=\3234\237L\252\224\352"
+	.ascii	"\326\3408"
+	.string	"`\226\243t\243\b\223\254M\2059\3234e(\217\240I\247\321$\200p<h\022a\222\305m\301\001\247w\303\253j6n\003f7\036x\204i\212\221\2333M8\031Z#hR\341l\002h2h\022@\223`\252\213\fG\306t\034\beq\036\231\246\t\365\024J\224\030j\222G8\353\322\301\314\264\2444L\022\006K 9~\301\324K\246\217\031Z\230\231\306R\313\226\026|w\3066\352\360\333\313c=c\273\364\305J\343\265<\362\342\2733/c\017\2772<\347\231\205\333\231\332\016Y\240\300e\315Ic\2176oe|wV\034\017gN\037\273\235yYa\233 Fa\270\2549XF\205\341\222\346\362\356,\255l\201]L2\241\235C4-;\362yG@;G\247</\021\215lo=\036\tma\024\206\313\027o\031e\232\246\256\031\032\027k\b\253\032\206\252\022UC\f\n\327\241\326\307\264\303\253be"
+	.string	"\264Y\221;\221=L\223.\374\360\033\351d#r\"O:Iw\272\r\371\220\013\3573\265A\247\333\217\007Od+X\301\313;Q\353\343\343\343\207|\357\234g\306\034\311\253+hF\355\301M,\356\205\374\367\231f\264\002\002\372{\237nc\373\247S\367\235\347\261NM\256,\210\033i0 \272>Y\375\203\375\224NmF\263t\317\332\314\244Z\367"
+	.ascii	"M\222hs\336\370\304\366O\025nl?F\325\3002\212\356\364bT\251L"
+	.ascii	"\311\222\202\345?\326+\007\262>qR\2566\261\235\225\211\357\254"
+	.ascii	"K\224$\261#+\022\303\261\217X\317j\201\031Y\215\330\007\253\225"
+	.ascii	"\021Y\2138\221\225\210\341\354\n\254\310:\304nl!\226cSP\256>"
+	.ascii	"`?\326 U\306\263R\331\220"
+	.string	"\025\210\351X\247\\\307\352\200\355X\245\214\307\032\3459\353\017\347\261\372\020\2566 \\\355!\\\345Q\2562\220\264\272\243\\\325\221\264\272@\271\232cWq\354\252\002\345\352\215r\325F\271Z\243\\\245Q\256B\225\2533\312U\031\345j\214r\365\251\\M\240\\\205Q\256\"P\256\036P\256\032\340\325\002\312\325\027\345\252\213r\265E\271\312\242\\u*W\t(WW\224\253\003xU\200rU\205W\003\020\256\246\020\2566\tWQ\224\253'\312U\023\345j\211r\225\204W\001(WGxUDp5Dp\225\251\\]\332U\245ruX\256&\225\253\302r5\350\325\262\\\005\272\316J\226\253\243W\017\\]\340\252\255$\221\240C\223\234in\371\203d\332\221\0019\020\231uY/K~\2201MS\207I\335\342\2565Q\2331\251O\256\256\200&\257\016\274c\326\005\307\323l\326C\f+p\034\367\311\366\303vQ"
+	.string	"\r\ry?\244\211AZ:\360@GN\376\344K\327=\035\335x\362\206C#\273\"\277q./sl\334\311-\350\201\3338\221\265\2771X\343*\347\275%k\362\027\262\243\361\032'\033\235nK\316\3444\016|[\353s\3711\352<\013\315l\t\202Trr\r\325\211\316sP\021\032<\337\021\354>\007\367`XD&y\0254xF\225S\325u\001\344D&_\362\036\""
+	.string	"\021WG\266~Pg\362\2753\343\t\034\352MqN6\0313b\374\3512\336Dw\262Q\235\3521\036@\336\351\006\344@\376\364\024\202N7\030\t \360\003\016\343\243\240\223M\352RG\340\345\235\250G\375\200{\315\232\336\351\326e;\206\320\230\340Gf\300\2278\002Kc@\001\220\326\016\235i\306\200H\376\342J\\\274\305_\030\271\013\"oq&\305\277\363\017\222\263x\222\273\320\351\346t\002\316\342/t\262Yp\253;}\274s\376)\362!'\340L\212}\347\037\3234\307\025G\362\315\033\340*\276\342M\215N\276\252\001\216\\\200\217\221\3164\021\2508\362"
+	.string	"\356>\223{\212zg\032%C\"\254!m\005\230\342S\342\0225\035\305S|#\225\245\235x\323\037\251\214\215\234q"
+	.string	"$\3074M\375\361\367g\210\3144\305\\\f\217\342>\212\203\312\330\234\260\300\304K\374\304Ow\262\031\271\221\2338\231w\272Y\335\352%\356.\305>\247[\360$nD\t\211\n\016\300\271\212rg\232\361#n\365\025\344dD\210\013\271\b\307\231\351!j\330g\272\371<\366P\234s\262\215\245\260S\344\033?F)\270\3221\210\013D\266~\032\303SW\nY\354ue\277\256\\\031\275\242\354W\224\275\202U\345^Y\366+\313z]Y\3112F\271\322\245\205\301\223,\245\225\241@\271zbEn`.,,Y\243\327\326~m\255W\226\255\177e\331:\026g\031\313\225.-(d\024,\254\255\r\310/{Y\241\314\370\342\322\302\002\005k\312\025\027\226'U\264\240\260h\220AV\025)PW\262\256\254@A\341\332"
+	.ascii	"jF\013\325\332\302\342\202\302\242\245\305\0055\204\023\363\305"
+	.ascii	"\324)\301N\354c\372B\315\007L\r\330\fu\300\330\221=L\237l>\n"
+	.ascii	"\326f\343(\335\022\231\215\333\032\300\336HMM\001M\232\217\013"
+	.ascii	"pcRR\n\342\275\020\304>y\212\311\233\026\224\262^\210\301\201"
+	.ascii	"EJTId\244\360\336\324)\001\301\213\302\243D\345\326c\241\230"
+	.ascii	"\037vo\334(My\224\027ZX\037'\252\0267\360\251D=\316\343\r|\363"
+	.ascii	"\312\322\204S\357\361\337)[C\301\247\316\343l\322\376\312\336"
+	.ascii	"v\300\tSgiXu\035\205U'O\324-*\247\001\346\020\261(\266\204h\312"
+	.ascii	"i\200\031D,\222\317:\023\230>\344U\251V\215\312]Az{\223\001\r"
+	.ascii	"\222\2324\007\256\032daP\271\253\2764h\310\260\276U\372\030-"
+	.ascii	"\375\222\244\334k\206\272\340\223\203\340\265\251K\302\272\216"
+	.ascii	"A\340\253NT:`\220{M\\\"\262\365\363h\306p\220K\371\007_\364N"
+	.ascii	"\266\261\020\f\2411\241\352X\267\301\246\267v\016\325QK\372\030"
+	.ascii	" \003\237\022'H\305V\375\352\252\022L\2606c\340Ks\364\330iy\030"
+	.ascii	"\325u\\\352?\276\303\214\220]!\t\031\306\367\246B\231\035:\276"
+	.ascii	"\"\216XD\261U\007\362\034\217\272\217/p\325\"F\326fj>Sm\307P"
+	.ascii	"\t\036Y1I\3100\275\034&\333\226\204\320!\357\321\t\033\206\003"
+	.ascii	"\240\311\005\276q\314"
+	.string	"\272\210\3458\323\227?bQ\354\207\346\334\234 \374\030]\240\312\331{2,*\233\374\201\023\277p\020\2010\250A@\245\fBF\031\223\021\021I\232d\030\003\201\005\204(\346\240\254\016\021\020\245\204\220\214\310\330\024\206\355\277\021\225\200cq\243jWn\204uls\332\367Y\274\006s\026\201W#\357\356y\020\311\271\36041\035\343a\230\3721\220\237\306\313n\322\276\313\204\314\201"
+	.string	"h\317i\225\312\306m\003\244\276P\025\306\f:\347\314\020\352\315\032\350M\263\036 \203\255f\032\030$\021\324\344//\244\200T\272\254\300\331\203JP\205x\256E\217$+\215\360\314\350\323.\201\275=\f\371:I|\260]t2\020\003\311\020\374i\210\321\r\376H\247)\276\177\027\202\277y\030\253r\341\3038\036\343\210\"v\022\001V\017bx*\347\222\304\210\250\202\342m\2437\313D\311GL\235\302\030G\370\273\300("
+	.ascii	"\311\325\004\034W\257\257\207\024\2670r\317-\030\220\"$\207\253"
+	.ascii	"\243\342\0075=\244\250\t\255\266\364\215\302\311o\316\302\251"
+	.ascii	"\021H\004K\237\"_h\312\023\341t\247\261\364\215-[\244\332\246"
+	.ascii	"\240\007\354\002\035*\003\242\365\017=F\215\003\340\367y\351"
+	.ascii	"\303\305\306@\001\242$\231Pb\316\347\213\030\364\212S\2722n0"
+	.ascii	"\217\254\364\307\275s\017\036\326\210\244FW\343Qy(\036#+@\346"
+	.ascii	"+,\254\001\r\314W\032X\255\314\025j\326k\214\337\225\320\256"
+	.ascii	"yd\177\216\250g\331\001\033\260\203\336\310\274\276c\251S\371"
+	.ascii	"\277\240\357Wb\020\005D\350\031jF~\204\301\2003T\366\351\252"
+	.ascii	"\215\177\361\357j\\*\301\366%\262\031\233H\253\022\253\354/\271"
+	.ascii	"2!6\214\257 \310P\202\341\022\004\022Q\341 \202:g \017\326&\316"
+	.ascii	"W\351\223\222\206Ch\3113~+\232\2622pl<\334\214\2413s:V\2164c"
+	.ascii	"\273\315j[\b'0'Xb\266\313\023D\362r\264I\024\243\277\340H\303"
+	.ascii	"\222\276H\370&3a \226\247\363\256\242\320\356\024\\a\340\001"
+	.ascii	"\013\254\3555\264\354\214/;\207M\030\361\"2Q\364$t\322\030\020"
+	.ascii	"K\331\222z/\230g&\207\212\276&B\200\366\347\247K\346\321\226"
+	.ascii	"\216B\340\023\35186\203\256)M9\336\211\0047\372\270\346\336\337"
+	.ascii	"\233\271\325C\324EBG.\262\267\tN\250"
+	.text
+	.section	.gnu.lto_ol_trajectory_reset.12.1db0c4ed2de8cfa5,"e",@progbits
+	.string	"(\265/\375`\023"
+	.string	"\215\007"
+	.string	"\242\316580\217\222\016$6H\251L\302\246Q\036\022\270\331\221\227F~^*\303\353\231\341\b?5\302l\273\216~`\005O:0\300 -.\005I\310\016\006\246mv\264F\210L\001\203<\245M\343@\241\207\317\306-\214\264\31094\210F\f1B\364\201\210\240\215\024=\004k\022\241-r\232\266EN+\213%\\)\210\274R\320\342\315\233\345\177\235'M\274vw\205\343u\001Q\033\364)\232\262\313"
+	.string	"+3\021\356IQJ\367\243\331\025\246\327\256\3315\0014\313FTJdR\257\346[\250\007;\276X\302\325c\002!/\0051\231\03254\371\312Z@\376r>=L[\254\254+\003\3035\223\231\021z\364\324w\2725i@\247B\365m\0222\363\327\2516:\354\337\371\017~\222\b"
+	.ascii	"3\241q\037H5\314=\256\211d!\340\227!\300\245[\264\363\t"
+	.text
+	.section	.gnu.lto_ol_trajectory_duration.13.1db0c4ed2de8cfa5,"e",@progbits
+	.string	"(\265/\375`\025\001%\r"
+	.string	"\026YZD"
+	.string	"\261&\0358O\334\177M\337vv\0022\313\nh\365\f\036d$\031*b;\206\024\001\212\250\257\361\374i\021^\241\020r>,\351\216\347\272\252\252z]\213\026\0326\371s/\004\331/\337\201\021\273\267\224)\005F"
+	.string	"A"
+	.string	"K"
+	.string	"\233\375A\317\305\364\027\0352\320\344\354\356E\340\237\316#\274\200\316\243\202\370v\250\271\371'\207\207y9\215\272\225+LPb\261\022\240\343\340'\365!\306c\236*\035J\246\325\261\273\316QG\272\343m?\260\275\300>)7\276\311&\266\311\217\036}\333t\036\257\217\371\001T\n\021\034D\271\262\275\223\324\026\373p\225\305\316\264\225\351\230i\230i}:\237\276\007"
+	.string	"*\205\240\305\356\206U\215u\021Q!lo\366\206?\3420\001\"G\341\3575'F\034\234\240\276F%c\3544\3768`\354.\003\333\030nb\344\343\262\273\rJ|\206\3047=\372BI\211r\250dD\2712\350\327\324\223^N)%.U\340\244<\250\266(\370u\300\214\n%i\330'q\317\001\016\201L2L\013}P\360\3104\b!\330\245M\220"
+	.string	"\022\022\341\252"
+	.string	"\342!r\2052\222\013T\300\230\205\217\354\3220,\2736\274=\\eq\346\334hP\3133c\205\214\364g;\rDU\261\035\325\035\"\345 TUK#NJ\211\013\025"
+	.ascii	"i\013M\272q\352[\030l[\2012\315w%\f\330\003\214\313U\226*F\206"
+	.ascii	"M\240\021\246H}\313\216Hn\007\323\240\013\371Gfe\017\226\215"
+	.ascii	"ke*uyZ\265\007"
+	.text
+	.section	.gnu.lto_eval.14.1db0c4ed2de8cfa5,"e",@progbits
+	.string	"(\265/\375`_\005\355\031"
+	.string	"V4\247G\300\226M:d\005\025\f.A\352\226\230\235Zi8!\214M\023\301Ycs\233\313f"
+	.string	"\262-F\271\330f\316\242;\330\0040\b\202 \260M\333\n\251\302[=t\204\330B\206\216\302CG\341\241cm\315\022BR\222)\226"
+	.string	"z"
+	.string	"\231"
+	.string	".\273-\273,\273+\273\237]\317ng\367vm7\007\270\220\004\031\032\022#\207\252'\021\210\267cE\333|\2656:\025\203E\f26\f\250\361D\300gt\252\310\221q\t\343\2261\232k+F\037>r\304\030g\r\300JO\247K\267\311\"[\334\322\205\205d\211\021\352E\216\030q\263\002`\245W\\\302|\351\261\322\345K\257\267\326H\342P\304\225\211\024\031h8\2111\326~\"o\351[3od\353\311\303\205\364\252@\214\261~\362\360!\373l+kK\240\365\230\004\251\242i\341K/o\024uD\203\b&W\265\270\013\276\2116\273x\2506md\n\310\032\231G9#3@\306\3104J\027\231"
+	.ascii	"\354\326\354\322\354\316\354\026\331%\262;dW\310n\220] \273?"
+	.ascii	"v}\354\366\330\225\331\345\261\273cW\307n\216]\034\2737vm\354"
+	.ascii	"\326\330\245\261;c7fW\306n\214]\030\273/v]\354\266\330e\261\013"
+	.ascii	"\263\273bW\305n\212]\024\273/\273\0015%fN\363t\222\212}\346I"
+	.ascii	"\025{,\214_\314e\376\361\210\371\n\367r\230w:^\356\345\262\035"
+	.ascii	"\206\030\231d-w\271\2278I5\345Z~\020d\271QT\023\r\"`o\366\270"
+	.ascii	"\205h.\211t\352K\357\350I\311\312\363\260g\250\362\225\033L\271"
+	.ascii	"\257\362\203(O\371\303\327\177\224w\241\353\257{`\353\335]\377"
+	.ascii	"@\326[\377\302\325\275\263\276\n\235H4\271\252F\377\276z\ft\222"
+	.ascii	"j\242z\371\036\023\302\003\346}\005\352@\351\356\2059\326\337"
+	.ascii	"\201`\347;L\034\267\021\024X1\306H9!#\344R&e\223h\025\224lKI"
+	.ascii	"\b\032 )-\035p`\253--P\300\300A\202\032\004\006H\017jIJ\022j"
+	.ascii	"4\236\332\" P\252-\331lJ\265\027.f\027\017e \t\020\2467\265\326"
+	.ascii	"\201v\331k78;\355\016\213\356\363\331;\220\350E\357\302\241\003"
+	.ascii	"\235\350\037\225K\350CA\027\n\372\352\007\216\365s\240{?~\356"
+	.ascii	"-\371z\356\363S\365\374!\317eO*'\251\246\034\317\tDU\355\200"
+	.ascii	"8zR\242s\226\357<\303\234\353\334 \316]\236\363\337\034\347\235"
+	.ascii	"\315a~s/\254\271\315?\220\3462\017d\250!d\302\234r\006\025\224"
+	.ascii	"Q\224\264\006P\203H\223\034\003\021`<\214(FJ\n\013\305\272\001"
+	.ascii	"\243\321\224\354\023\335\003\256\310\335G\313\244\256\371'\036"
+	.ascii	"Y\303\222*\275j\212\t\213\031\026\032w+\203m\377\021\270\200"
+	.ascii	"\363\245\321\034\217\333\342\201\275\361\tH\032l\350R\006\334"
+	.ascii	"\366e\344\031\nX\215\"$\367\004\250>\024\300VS\035'Y\017\273"
+	.ascii	"cg\260\235&\356\0359/(\327\225P\202\362:\366 \202\036\31667a"
+	.ascii	"\365$I\220<\325`\001\201\313\266\023\224\\\264\216!\r\255\002"
+	.ascii	"\233Zh\372\017"
+	.text
+	.section	.gnu.lto_ol_trajectory_sample.15.1db0c4ed2de8cfa5,"e",@progbits
+	.string	"(\265/\375`K\005}\035"
+	.string	"\226u\271G\220\332M:\202\016)\340A\025\032"
+	.string	"r\355\241H\262\215~\304/K\350\177\f\314x\334_\201\363\240\034\2560\232\177ff\367\310L\026\026oy\252\020\bI\364)\346\204\313\215\007Ts\322\275\001\213\220Z\344\223M\344N)\245"
+	.string	"\223"
+	.string	"\254"
+	.string	".\307\335\222\200\244\337\327\231Zk\317\251}\306S\333\237\366\225|\211\321\255\\\332V\353\026(Vj\255\r\374`<-\360"
+	.string	"\342i\370\035\361\324Fv\331\201R\365ZIhh\241\325Zq\013\304t\032\375f\033oD\032.9\215|\246\335o\006\240|;n;\224O\307\3070\201\330\222S8\340\310\222\216yC2!M1\\\254--"
+	.ascii	"\230h\204\024\226TM%Mz3\222\343\341\334\361\035s\234\f\027\370"
+	.ascii	"\360\302q\261\245\2470@\330\2172\277\372Tb:\232\363\246B\255"
+	.ascii	"\325\263\307\344\273qn;\211m\t6\335\020\266\n\242\371\236ww<"
+	.ascii	"OQ\236v\177\376}\304\272\004!7\312=\377\016\310\022\2034\325"
+	.ascii	"\330\337\372\023w\371C\2343\227\271\226\006\275\2449\351\254"
+	.ascii	"\355"
+	.string	"\342Z.s\244j\255>~\326\233\274\360\207\234\032\206\214\371\336\251/C<\375\325\023\360\300\322x\360\346\232\r\334\315\375\005\333\374\264\274Q\366\201\367\316\255~\235\003\357\234\235\306\331i\362\323\267O\333>=~Z\234\323tN\207sz\347\364\005\220fa=c\265\336XS\253_h\220\352\300\337\376\257L\332\006\006;{[q=\223\314@\034L\004\365\235U}y\335\226\372\316\220\024\220\232\2521\356\317S\334\275\024\2276\253\344\322\366D\260\263b\323\232,/\333\352\354\316\236JR\221\243\271\306E\004\r\226\241\325\212\244\373\226\237\007PeUY\256e\204xj[\032,\023r\243\263\343\227I\234\313\345\275\354\030\307\362s-\262Z\353\204+\017\002\005\t\t\211\247\343\336k\312\2127\327\016\206\fV\024\361\273PY`\f\276\033\356~%\3718\232k.\3355V\331\245PciVa\255\265\322p\355\023\237\342."
+	.string	"RB\020){h\026J\217\250,\241\311\031\272\013\021\r\351B\0079\230Q\224\323\005\t\245"
+	.ascii	"*\322\375\254\310\341t(N\f\2550\201c1\004D\204\013*z\201sp\300"
+	.ascii	"\271\026BE8].W\204#\201\365\033\345\n\274=rr\333\237Kt\001\033"
+	.ascii	"\305\345\371\262q\223\263J\236<#&s7k\033\013g\243\246\346\302"
+	.ascii	"\323\320p\3160\334\f-\r\032\234\205@U\366\232x\346\261~&\303"
+	.ascii	"\315\270\214@VVF\303\311\270T0\346X's\225\223\325\312\333\360"
+	.ascii	"1\227\004N\303\344,\2716\207\016\272\352\264;\373`f\214\265\""
+	.ascii	"\275g{\270\330\207\365\251U\325\212\344s\032\366\205\334_=<B"
+	.ascii	"\265\325k\262\005]\250!L\305\030r\210D$\230\221\246P\030\016"
+	.ascii	"\300\002\021)\253:\020H\206dF\223\250\003\262p]#>\322@0\022\353"
+	.ascii	"/\002\270\355\203I\204\177S\r\220f\213$\311\314\004j1o\266#\351"
+	.ascii	"\321\350\021\307\222\206PK\212\005\032\357\341\034\034'<\250"
+	.ascii	"a\307x3p\304.p\355\354m\237i\33571\b\017Z`\242]t^$@|z\337\205"
+	.ascii	"\023\250\206\300\342y1t[\005]v\332l+\254l\305\3738z\221D\260"
+	.ascii	"\250\270\245\363\300\271}M\237\351\373\327\252H\353\303\203\216"
+	.ascii	"@\360\333\372\322\005\264\020\277\013\245f\311\265\361\305\355"
+	.ascii	"s\301\270\372zB\347`\007)\303\312\224R\357T]P{\277\307.a\r\004"
+	.ascii	"\026\021P\r"
+	.text
+	.section	.gnu.lto_ol_trajectory_sample.part.0.17.1db0c4ed2de8cfa5,"e",@progbits
+	.string	"(\265/\375`\030\002}\017"
+	.string	"\346\032aF\340\2246\035$"
+	.string	"\002L\3001y<\245\362\t\234\314\007T\201>\005\\K1\345?\265\216\237\301\003p\222E\325\351\fbH\030\271p\032\275\307\b1\306\030\0013\020Bw^\216;*\247+M\370\r\311\332n{\247\024J"
+	.string	"L"
+	.string	"N"
+	.ascii	"\027\013\030r\topvW\301\253\031\\\257\004.\240\363j=@\347\365"
+	.ascii	"'\333\035h\317&r1f?\236<\214\345\356b\257\024\305\275\323iy\376"
+	.ascii	"\374^XN\237z\002\031!\337\013\210O\320-\317\311\356\372\nq\327"
+	.ascii	"\033\202=E\0046?\315?sj\337>\214\316\247\371\370\224?6\335Q\246"
+	.ascii	"9@\\\030\260\3462\274\243L_\027\220dD\270\302\331\025\037\\\257"
+	.ascii	"\026\257\213\335L7%l\207\032\033s\3060y0\004\023\236\026\274"
+	.ascii	"\272\301\365z\321\237W\267\270\013\357"
+	.string	"/L\006%CpxTAX\224'okW\231\004p\343G\276\"&mO\003\266\206\3270Y\022\263\273\016\374\031\247Q\362e^\275ae\376{\365W:\257O\375\200\n e\3312s&\rM\255[KO\330\027(\302j\367C\216\221-QU)\036\245\217H\031gq\267\310\304\264i\234hd\001e\343&\250h\030W!%S\241\200a\310PH\230h+a&\005\254e\030m\030\247i\033\366\371I\013\345`Jih\033\301\n\022\250\245&\374\233\333)\377\341#\373\252G\251\343\366\205\363\3301G\322s\230\f0 \320\002\021;\352\023\003\334\234T\"\200n(\220\016=w7\203;&\213m\216\265\334\274}I\260\207<\027\233iB\"\004\271\f~\372\220y\346\2124\323\017\023|\343\373\005N\370 [\020\b!A\370\213\311wS\032c\213\206U\222\034n\372\343\260\234\3722\177\220\247\206\262\344-\264"
+	.ascii	"\330\336\031\313\344\346m\211\372@\341"
+	.text
+	.section	.gnu.lto_.symbol_nodes.1db0c4ed2de8cfa5,"e",@progbits
+	.string	"(\265/\375`\221"
+	.string	"\305\007"
+	.string	"\304\013\215\001"
+	.string	""
+	.string	""
+	.string	"\002\t\177\026\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\200\202\202\200\006\016\177\027\n\177\030\320\346\273\034\021\177\031\204\202\202\200 "
+	.string	""
+	.string	""
+	.string	"\005\006\n\201\204\r\177\032\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\005\b\033\200\003\005\007\034\002\017\177\035\305\245\376\322"
+	.string	"\002\f\177\036\013\177\037\342\354\251\006\001\020\177 \377\037"
+	.string	""
+	.string	"\200\200\200\003\002\013\244\026\003\b\003\233\312\233\034\001\202\001\003\b\001\253\333\3426\001\342\n\242\013\003\t\bB\003\n\013\350\265\2303\001\244\007\003\n\013\364\232\314\031\001\344\016\304\033\036\244c\003\n"
+	.string	"\241\276\320\347\003\001\302g\242j\003\n\002\302j\003\n\b\342\354\251\006\001\302v"
+	.string	"\030"
+	.ascii	"`h.\345\001a-\245\275!\227\306\343i\221P\332\271;\330\373\331"
+	.ascii	"\004\316\325Ru\333!@\355\035j\232\201\032\310a\031BT\340\341"
+	.ascii	"\2069\\\037\310\303*\317\200\0324;\235"
+	.text
+	.section	.gnu.lto_.refs.1db0c4ed2de8cfa5,"e",@progbits
+	.string	"(\265/\375 \237=\003"
+	.string	"B\007\024\033\260\027\322\001x\242]c\003\303\n\206a\030\206q\325\215I\337&Mn\"\311\226)\377\203{G\243{\306BQ\372D\355\021\265\200y\234\231\201t\241\004\322\203\322\247/\350\233~\361K\r8\227>\373\253\013\271\270\0137\271\t7q\217#\365\037\002\b"
+	.ascii	" \n\304EE\252B8\240\224v;\2005/K\351\001"
+	.text
+	.section	.gnu.lto_.decls.1db0c4ed2de8cfa5,"e",@progbits
+	.string	"(\265/\375`"
+	.string	"\017\375I"
+	.string	"*\177x\033DP\036R:s\3011\350\271\302\004|\006~8_U\242\2263\023,\203\356W\253\270\337\341h\243\373\226\335\202\337;\323:\377u\357"
+	.string	"\200Ik\261\001l\300\300\214x\270\023\260\201\231\260(.\370\263\366I\3332\005d\001\254\001\264\001\337\3603\225\f\2735\221l\020\2635M\3438\016\363\252\200a7\032\2569\206c9.\303h\034\307c\316o\\\375\332\236\317\376$\216c0\354\306"
+	.string	"HwSK\310$D\305\345OwW\250P\001\251\302\312%\020\225\034\200\3657\330\337R\n\366$\330+\261?\267\235\335~\366\302_^\275\322ngw#"
+	.ascii	"\312\331=\267\356\312lI\347\266\243 4\253\355\001?\273(\034\326"
+	.ascii	"]\201\033XF\342\243\240\003^\373y\013\237\261\332\357Y%m\266"
+	.ascii	"\356\326\b\200\026\226\2171w\375\031\355U\356rn9\355\253\232"
+	.ascii	"4m\332\335EDw\366\306\260\335\325\001\033\b\256\027\3303\227"
+	.ascii	"\0375\273\303/\373\226\r\004Y>\n\262x\200\377n\030\232\340\022"
+	.ascii	"\214D\342\256\317%\036\370_\003\007\360_\017\354\177S\374|`\304"
+	.ascii	"\3779q\377\345~6\022\301\314!\332@\374\354\341?\201\030\227\360"
+	.ascii	"\337\027?+u\370_\346?\231\377{f>\364_\t\353\177\201?s\370\271"
+	.ascii	"\302\317\021~F\360\263\203\237\033\374\314\340\347\004?\023\370"
+	.ascii	"\031\300\317\367?\334\377=\377\345\374\237\373\357\342\277\235"
+	.ascii	"\377u\376\327\375\267\373\177\347?\235\377|\377\373\374g\361"
+	.ascii	"?\355?\237\377z\377[\374\307\373o\346\277\332\377\025\377\037"
+	.ascii	"\374_\363\177\330\327\327\327\367_\262\377\032\375C\026\002T"
+	.ascii	"&\375l\275\242\253\264o\267\315\355\364\212\352x\266R\350\263"
+	.ascii	"\2252\213\332)ev\267\321\242'[\223\311O\252W\364I\225F\215\332"
+	.ascii	"\331\314\2466\227\260Ni\364\311F\032-zR\233\321\247\323+j\304"
+	.ascii	"\204,,I\220//6\216>\235-\304\252\253\t-\242{\266\322\266\353"
+	.ascii	"f\266\037\r\205\320\335%\205\3325\2170\231):!Sb\232Rn\273;\201"
+	.ascii	"\325\324\227\264\235tO2i7\331TS7\007fK\327aL\307d\322\325U?\272"
+	.ascii	"\025t\333m\325\315\344\246\353nfw\013\241]m\367V\321sje\325\235"
+	.ascii	"\205d\325]L\270\037\335\227\355\016\231\350\223\372%M\202\373"
+	.ascii	"B\2356U\313\344i\333yAY*3\255\253\272\233\371\260\323(\021=\276"
+	.ascii	"3\032\363q]\t\266\246\340\205j\357OC\263,\f\205d\005\341\273"
+	.ascii	"\353\031\220\237>m\323\211\217\273\252\375\334,YC\333\213\013"
+	.ascii	"^)\321\202\307G\357\007&7f\354\256g\275\237\363x\017\307\thB"
+	.ascii	"\353\204\271k\204\236\362Q\220\363$\235\365\f9\213\270\215\335"
+	.ascii	"u\310Gx\352n\334\335\233j\022\234\256)\033\261\351\232(j^E#\205"
+	.ascii	"\323\264\2012E\343\346U\246c\343i\225\2604\272\317\tp\026\265"
+	.ascii	"s\fI\336Y\035\277yU\200\263\205\001&\204M\231\035\276\303wl\307"
+	.ascii	"ux\016\323a<F\343:\216s\246\262\034\226\016\240%X\b\254\267\331"
+	.ascii	"@\360l\306\236\257"
+	.string	"\260g)\354Y\214=\207\261g'\354\371\213=K\3313\022\266\210\216\r\23413T\362\346\310\232\273\266H\3026rZ8w\rSr\236S\340\025\273;\274\260_(DcaS`\274F\324\3142\306u\327\373\204\327\202db\322\356\356z\235\360Z\200;\2677psXp[\332La\275\274\356W\025\325\336\037\340\232$hJ\356\372\365\343\222\242])\353\r\237@3`y\r\205Z\370\357*\t\332M\362\271\265\355\350RX[\370\317\311\305u\273\206\"\346l\345\261s\255s\313]\273\252\303,1(\236\"7\253\310\325\nvs+\035\002\275Zq\310\306\334\356\212\205u\217\260L\366\262%k\302\200>\275$WF~\217\344\271g\324:+4\354\357Y\325\253\356\225\212\266\207\204x\243\332\373\023\375\275\252\n\367\324\001\312\273\353\265\272P\"\247\027\025\270\013\275C\322\370\261B\250\235\232RH\315]\205\360\030\244"
+	.string	"`\320\262&V\256\363:o\220\376\315\021\243\332+\003\362\033\004Xh\016\255\313]\357\223\327\206qZ\322\360\334\365RA\311\223\307w\327\373\343o"
+	.ascii	"\322\274\365\301\272\353\365\361\267U\213\032_\327\033K\305\f"
+	.ascii	"\020,c\354\031\020\007:\013\372Y\320mrV\b\263)y\235\005\235\360"
+	.ascii	"_\346o\363\327\320\341y\210\272\317\272\233\301P\032\336\264"
+	.ascii	"\314]o\377m\255\313\n\343rW\356\253\303\266U\350\256\\\210-\263"
+	.ascii	"\343E\350\256L\b\230\326\004.\316]y\320\200\2674;\261\273\276"
+	.ascii	"\317\253\377\207|\345M\213\333]\177\235\260\277\177\260\233\320"
+	.ascii	"\356\276\002\266\r\235\":\003\231'\374\001\370\307\020\372w\t"
+	.ascii	"{\335M\310\366X+\325&\327]\377;\350\227u3\215\272m\350\223\352"
+	.ascii	"\305|z\211\0235j{\t\202\016\310d\362\004\023\360M\030\240\220"
+	.ascii	"\310\242\261iY\304A\204Z:\311 F=\325\270 \025\365\344\204\274"
+	.ascii	"\300A\211IiI\212x\234\021\2054>9\021\225PQD\"\217\244\262i\231"
+	.ascii	"|\022\322(\036\221\353\022\352)i\004\322X*u@\001g \235\242d,"
+	.ascii	"\217PG\345\021\024\273|\212J\032\003\034(\220\001\303RY\314\201"
+	.ascii	"\341\210\314\201\243"
+	.string	"\b\305\264\300h,2\335(\036s\260\310\342\216\343jtZ>9E\351\020\336\350\244<>\035k\260\347\240tAiIJ\370\245\017\031>d\b~\351CR\322\007\245$\366JI?\345\f\341\233\026\034q8-W\241\024\367`\251\035\267\307\216+U\274=\212\367\020\236\314qT\022\227\311\244\2228\324\303x\227\306(\345\323\021G\215#\024\323\321XT\036\237\222\312\031\021\226\312\342\022\212i)|J:-\213\312\250\031\254\224\361.\213I$\r\340=x@\341\340\005\213\024\254\021C\017eri<\332(*\227L\310$q\331T\303\tI\203\370\344T\304A4*\241\210\030\036\250\335 n[S~\356\332\016\235\025zv\253\265\266i\201}u92\200I\226\2406\264\253<\"\315+\\n\2235sR\251\234\261\033P\n\323\231\347\256\327\354^-w\313\257\331-\273\206\016'r\266\327l\355n2?\020\300\374"
+	.string	"8'\245\271\026\\\277V\261\355\236\235)aX.Y[\337\036\274\273\336(\277U\242\\\262\233G\324L\265\036\"\364\242\304\315\237?\375\354\232"
+	.ascii	"\024S\203\206u\255\374\2221\230;p\344\356\364\227\312?\024\326"
+	.ascii	"\231\263F\255\f{\307~\247p\021\271#\253J\001c\343F\257\215\375"
+	.ascii	"o\255\311\233\\(lw3\213:\201'\250\321(f\024CFfFDD\222$I\007!"
+	.ascii	"\005\204 F-\275\r\021 \245\264HfD$IR(\f\333\001wiQ~\306\335\025"
+	.ascii	"\022\220\364s\274\263x\246<\257\210\357\242\214/\305\rbvx\243"
+	.ascii	"\262H\366\324\315\020\374\351V:b\307\277\310US\\\252\323\252"
+	.ascii	"\305\232l(\246d\016\201\276\346\224\b*\300bj\376\321:S\022\274"
+	.ascii	"Ic\002\370=T]\341f\223\224M\255\304\302\266\362\363b\237\361"
+	.ascii	"\264\021P\fj\210\334jD\177\363R\013\224]\211\035\226D\277\225"
+	.ascii	"\"\212\325(I\006\005\375\230bi\324\226ck\376\220\016N%\304\374"
+	.ascii	"\364H\034:\261\234T5\233\312\202\2352\350\361M\222\252\232Z!"
+	.ascii	"\300D8\013\2020\"\341$is\\\334R\264C\254\244+\276\3020\201\317"
+	.ascii	"\020\n\215\234\365\331\371\275\355|"
+	.ascii	"\013\322\257\n9\023Lv\f\224NoJb\362\257\002M\345\b\300\202o\201"
+	.ascii	"\242\275\214\030\022\320\nr`=\374\310\030\033\352\340\002rhj"
+	.ascii	"\320\330a\347\266\344=0\265\242\235\324.\021P\276P_\373:\271"
+	.ascii	"s#\265\027\177e\274\fs\\\022\321\313^\233\256I<'\325R^p\304P"
+	.ascii	"\002\256.\231~\363\034\250\203\3728\337\003\266#@\356\223\367"
+	.ascii	"\331}\201\273\302\311*m\200C@2\270\r\220\0323V\300\271\016/\226"
+	.ascii	"K:\262\325\247B\346b\353&\2542\217)\200j\320\311\355\350\t\340"
+	.ascii	"c\252pl\304C\354\346'\236r\310>H9N\276\036\001\005F\005A`:\220"
+	.ascii	"\345=\2431\203\270\320\377N\226\260\221\351\022\360\355\227\305"
+	.ascii	":\023\235\323\321\342o\332\361\205\373\316\241c\350\337;\367"
+	.ascii	"55F\262\260\265\211h\316\213\332g\215\254\201\355g|2z\365\315"
+	.ascii	"\354\214\333\033\336\230\3265\214\2134\367|\270\307=\363\013"
+	.ascii	"\2156\200_7\232\234\350\342\005\346\357Y\017\243\336\354\226"
+	.ascii	"]\204\306\331\344\207\351U\341\310\306\225\314\364\335\340\335"
+	.ascii	"\307\353\235\243\316R\325\331\272\0276\207\374-\351\006\371#"
+	.ascii	"9!\033\256vS\311W\367M\266\023\244y\340A\365\"\265#\221\361\360"
+	.ascii	"\373\213m\271\267\300\023{5\r\024\366x\330\246s\315\375t\367"
+	.ascii	"\236\237\3406\013\037\367,\311\357_6\206G\350\377\335\323\t\022"
+	.ascii	"\224\356\350U\001"
+	.text
+	.section	.gnu.lto_.symtab.1db0c4ed2de8cfa5,"e",@progbits
+	.string	"dr_traj"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	" "
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367"
+	.string	""
+	.string	""
+	.string	"ol_trajectory_duration"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\001"
+	.string	""
+	.string	"ol_trajectory_sample"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\001"
+	.string	""
+	.string	"ol_trajectory_reset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\001"
+	.string	""
+	.string	"ol_trajectory_build"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\001"
+	.string	""
+	.string	"sqrtf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.1db0c4ed2de8cfa5,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
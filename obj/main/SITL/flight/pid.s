@@ -0,0 +1,1974 @@
+	.file	"pid.c"
+	.section	.gnu.lto_.profile.84c5d4fd3cccd4b0,"e",@progbits
+	.string	"(\265/\375 \nQ"
+	.string	""
+	.string	"\006"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001?"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.84c5d4fd3cccd4b0,"e",@progbits
+	.string	"(\265/\375`=\004\235\021"
+	.string	"\224\0231\005"
+	.string	"I"
+	.string	"\274\227\317\325\006"
+	.string	"\001\371\356\351\372\r\002\206\347\251\314\006\020\002"
+	.string	"\001\002\001\002\002\003\240\342\234\212\n\004\005\006\007\270\274\336\216\013\f\002\002\002\003\002\003\002\003\b\266\326\217\313\0030\002\001\002\004\002\005\002\006\005\002\007\002\b\002\b\002\005\002\t\002\002\n\013\002\013\016\017\020\360\326\371\310\003:\b\002\004\f\002\f\002\r\002\016\002\017\002\017\r\021\022\024\025\026\030\032\033\035\036\037 \212\270\277\352\b"
+	.string	"!\"\222\237\331\246\t"
+	.string	"#\303\216\256\340\002\020$%\256\330\276\211\002&\315\343\301\244\013'\356\363\250\233\t\002\002\021\002\021()\261\310\327\230\n\b\f\002\f*\211\240\256\233\003`\002\002\020\002\002\020\b\022\002\022\001+,-./0123456789:;\375\272\200\274\n\023\002\001\002\024=>\256\276\333\351\006"
+	.string	"?\301\225\350\304\005\260\001\002\002\023\025\002\025\023\021\002\002\002\026\027\002\004\026\002\026@A\352\263\360\321\bBCDFGHJKL\350\300\306\254\005M\336\215\314\344\rN\213\340\367\246\013OP\201\351\273\334\016Q\226\210\220\365\005RST\240\342\234\212\n"
+	.ascii	"\200\227\250\241U1\021MA\222\3020\006\260\002\"\242u\003\022"
+	.ascii	"\300S#e\"\022-\243\300\222i;[\302(9\224\211\307\353f\226\030"
+	.ascii	"\263}Ix<\037:\234_\326\\\241\2660\233`\007\320\250L\276\300\314"
+	.ascii	"\242\335\362\206[\336\236\346\013c`lY\262^]\362\177z\250^\341"
+	.ascii	"\314\246\335Q\200\3737\374\"\254\227\245\301\243\362\362\272"
+	.ascii	";\034p+\236\220%W\2426@\225N^+al\020\266\003\240\236>iH\001\201"
+	.ascii	"o\341\203\311?KE\356\200\232\3112\3011\254Q\342\361O\"-)\210"
+	.ascii	"\031\255\337\202d\214\006\250d`\270{\2160\023\323\016\236\232"
+	.ascii	"\373;\322\250\322\201\367n\212!\005\204\230QQ\344\374\360*\354"
+	.ascii	"\365\006\213{\036\217Y1\237\315\033E\023,\310\271\376\266\337"
+	.ascii	"\370\335t\3427\257\237!\274ehok\373u\274+\246Z\312\340p\t\275"
+	.ascii	"\021\277\226f\222\021\277D\021\036\024"
+	.text
+	.section	.gnu.lto_.ipa_sra.84c5d4fd3cccd4b0,"e",@progbits
+	.string	"(\265/\375`X"
+	.string	"%\005"
+	.ascii	"\202\206\022\031pk\322\0010UUUD\377\0045\t\201p%\032F\2506\201"
+	.ascii	"F\266L)\226\214c\033\217\361\342\023\212\236\346\021{X\303\022"
+	.ascii	"\024@s\215L\276\f\326z\205\267$\023l\247\351y|\351\321W\274\300"
+	.ascii	"\220d\321\234\265\25579\023& P\002BF\346\003\357\006x\200\267"
+	.ascii	"\n=B\3303\347\202X\210C\263\002\221\004\266\2040g\200\204d\336"
+	.ascii	"\f \2141f\217\372\f\304\210\004\r\322\272;\272\027(\030\300\202"
+	.ascii	"\321Ex\021\371(\263\357\206uC cX\366\314T.\361\026\f)\261;N\033"
+	.ascii	"\300\200\0137\004"
+	.text
+	.section	.gnu.lto_.inline.84c5d4fd3cccd4b0,"e",@progbits
+	.string	"(\265/\375`\253\006\325\031"
+	.string	"\346\345xE"
+	.string	"\261h\030\003\364\t\312\030D\364w\177\214\361\201\333\017\347\350\005\315\214\f[$@m9\006\365z\027>\244\300\373\300\203\350\223\255*\177\215\246\007\230\332 WO\363\370\307<\027\240\240\377l\022(\226\244m)e\na"
+	.string	"g"
+	.string	"e"
+	.string	")y\302E\216\021\270\201C\375I\022?k\272)\021_\301\243 I\256\034ZU\322e\007\206\314;s!y\352;\365\345_\332N}\256\3542hwG\f\214p\222*\367/\025A\243\347\223\220\257)\0323\203\242e\301\237\372\364\261\264\345\311\312\335]\321\277\362\333]\220|LQ\233]\030\351\273G0\001\247\276\365?\341p\352\013\275\215"
+	.ascii	"D\333\263\362\203\314C\213n\357U\322\354\302D\247wVP\332.,\357"
+	.ascii	"V%\312\266\246\007\351\207\304\313O\206\321\031\373\364S\"\326"
+	.ascii	"`I\306t\204 *I\2267\227\027\035-\337\270\243\360*snN\2253d\364"
+	.ascii	"\354 \275\275\251\224G\355\246F\332\273\225\264\335\025\271{"
+	.ascii	"\245zv\247\n\0031vw\002\312\333\266\212\243\237\264\246\237\266"
+	.ascii	"\230~\332\276\234\351&\245\351'\033\375\224A\2723D\331&\235\241"
+	.ascii	"\n4I\226W\032\035#\210Lr\345\221\325B\246\330\335yNp\352\273"
+	.ascii	"\225\260\030\034,H\271\214G\355&d\004\372\017Hl\205>a\351\366"
+	.ascii	"\201W\322\024 \360\032v\027\366) \021st)\316\356\216\366\002"
+	.ascii	"\343\003\021\321\370\330\215>S\037\206\244\211\0169< \177!\201"
+	.ascii	"df\276-\004\206\254\201\001\241\223/8\007\244[0\220\271P\216"
+	.ascii	"\256\254\341c\303\247t\003\332\rP\216\351\245:+f%\002\314`Q("
+	.ascii	"\317\353:n_\251\356.\3758Q\336v\335r\373\226Nn\367m7qqQ(o\256"
+	.ascii	"\2258\236\327\315JZKc\273\260\217W\311\200\242\250a-T\250Fd\024"
+	.ascii	"\224$\311\032\220\242!\032c\007\021\300(\205\230r\252f\244\240"
+	.ascii	"\240 )\264\035\360\353\222\237\177\032\364\311\267f\357\270\031"
+	.ascii	"p\2716I%\305\371\216L \205b\260-\023\347u\367-0>\032O\226\231"
+	.ascii	"@L\317\277\202\250\350\351\301\3358@\216<\344\264\\H\204\337"
+	.ascii	"\021[\350\345\270\364\324\366%UJ\336\347\235x]\314\027wn[\332"
+	.ascii	"\261\305j\206\214\314b\233\024\246\313\253\221\213\361\326\221"
+	.ascii	"\"\300j\310\212\020H\335^&\224\322L\037\2412\361qh\303\373\200"
+	.ascii	"\213\013\035\357\316l\323P \"&\363;S\354\b\323Y\007\335\372\222"
+	.ascii	"U\234\244\234\002\223\251\nv\317\022\232r~\b|^a\363\253\217\003"
+	.ascii	"(V\220\001\340&\213\003A1[Y\031\332\214\225\324\330\343\202\343"
+	.ascii	"\303\373\370\354\024\300\371\263n;JkS\rE\t\254(\224:\016\275"
+	.ascii	"\320\241\246\270L\300Y\340*\305\360\013\3028\207\342\203\020"
+	.ascii	"}\263\364\311\246+q\002\217@\335\022\035\365\200;\204\"\276\202"
+	.ascii	"\241\332(0%\354\261\034!\016\237\333\237\303\032\250G\034\361"
+	.ascii	"\n\371g\213*\001\262[\256\036N\240\364i\021i\216\243\356\203"
+	.ascii	"J\\\366;\357\322\363J\275\233^\356H\243\372G\273\207\345\032"
+	.ascii	"\3361"
+	.text
+	.section	.gnu.lto_.jmpfuncs.84c5d4fd3cccd4b0,"e",@progbits
+	.string	"(\265/\375`\372\002\025\013"
+	.ascii	"\022\017*+\200)I\007sC5\004\001P\366\006\214\031\314\300\272"
+	.ascii	"FD5\350\322!\033\213>,jl\250a\363\306F\240\024\341\227\374\275"
+	.ascii	"e\222\001$\035\230\353g?\355'\201j\013K\356ud\353\223\277&\274"
+	.ascii	"\255\201\3553$\324\020\n\234&B\032\3143\004\351\375f\213\373"
+	.ascii	"\350=z\215/\003q\320B"
+	.string	"\254t\372o\002\265\221\222\300\027O\331A\357\240^)\2319xV\222Wgmz\354\r\224V\022\364\2264@\300\025OqgD\215$\333\205\022*\334\262\254/Y\251L\f\324\373\243\240\316\007\246E^\355\341\366L\"H\257\236\016VFR\250\3011S#CR\330l\214\001P\0021\314U\361\022\240RI\002\024\3509\306\314\250\261\345\372g/\375\225\302%\302=ExA3[\236\016\230\376B\2350\362]\366\342\221\333\023XM\253n\241o\244\027B\300\312\242R\244\177\",\037\320\253$\024$\n\003M\304p\237\306\267+\361PBt\273\006\345\200R\033\320-X\207\006\027\310\001\364\327k\367\"u+a]\034\376#\370%\232\271\233\231\300mJ\20094\2240F\243\"\265\006,\346W\236\316\201x\305/\023\006\332\311\033\021\321I\243B\037\367<\340\240\352\376gQ\212\203\030/2\210\206\342\t%\232\244\305"
+	.ascii	"d"
+	.text
+	.section	.gnu.lto_.pureconst.84c5d4fd3cccd4b0,"e",@progbits
+	.string	"(\265/\375 5\251\001"
+	.string	"1"
+	.string	""
+	.string	""
+	.string	"\020"
+	.ascii	"\230\004\002\231\004\007\232\004\b\231\004\020\231\004 \230\004"
+	.ascii	"\"\230\004#\230\004%\230\004'\230\004)\230\004*\231\004;\230"
+	.ascii	"\004>\230\004?\231\004L\204\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.84c5d4fd3cccd4b0,"e",@progbits
+	.string	"(\265/\375`\021\001\355\b"
+	.string	"\242\r),\200)I\007^\206"
+	.string	"fBgZ*Cf0\263\222\031\234|\023Y\025Qo\243\370\017\373k\277\325\262\241\031\346\365\330n\315\222&e\nG\246H\303\303\324\220a\204\316\250<\352\234\312\2472OgYX\341\240\006m\302\303\026\005[\332\2743\312n\335U\322\312\034\340(1g\267P\224c\276\322\363QP:\240\350\t\312"
+	.string	"B}\036\322\t)\037\350\224\312%6\312\033\275+5o\214\024F\373\243\023\352\362;d\002\345\216\262\231\254jU\016/\356\333\255=P)a3\177U\354\232\250@DP3\023\316\276gE4 `\002\021B\303\007\214"
+	.ascii	"\216\356\005\374\020\301p\022\376Fx\\(U\035H\0379\004;\326\004"
+	.ascii	"\004\023\364\335p8lG\273\r\t\021!\271O\205\021A/]\213\375vz\256"
+	.ascii	"[\254\030\344\020\2218\315\255b\204\017\203C\316\204\025\022"
+	.ascii	"G{\270a\b\317\006\250\005W\345\240b\205\234\263<\342\313\204"
+	.ascii	"\356\036\312fF\330\f\274Z\235\260\031[\373c\200\314\340\240\030"
+	.ascii	"e\270E"
+	.text
+	.section	.gnu.lto_.lto.84c5d4fd3cccd4b0,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_pidConfig_Registry.67.84c5d4fd3cccd4b0,"e",@progbits
+	.string	"(\265/\375 \224U\004"
+	.string	"\304\007b"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	"\005\001\212\001\206\200\200\374\342\303\305\301\037\006\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\314\006us\250\346\005uq"
+	.string	"\005\001\006'\001\006\370\303"
+	.string	"?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\030./src/main/flight/pid.c"
+	.string	"\004"
+	.ascii	")\"\301$\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_pidConfig.69.84c5d4fd3cccd4b0,"e",@progbits
+	.string	"(\265/\375 8\235\001"
+	.string	"\204\002+"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\031\005\001\006'\001\364\003\001\002?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001"
+	.string	"\003"
+	.string	")\"\300\274\177"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_pidProfiles_Registry.73.84c5d4fd3cccd4b0,"e",@progbits
+	.string	"(\265/\375 \225E\004"
+	.string	"\244\007c"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	"\005\001\212\001\202\200\200\374\342\203\335\361\033\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\357\006us\305\006uq"
+	.string	"\005\001\006'\001\360'\001\216\300"
+	.string	"?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\030./src/main/flight/pid.c"
+	.string	"\004"
+	.string	"J\005\017\263\350\024E\336"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_resetPidProfile.74.84c5d4fd3cccd4b0,"e",@progbits
+	.string	"(\265/\375`@"
+	.string	"\315\b"
+	.string	"\346Q@:@\305(\035\340mR0\351\363\350\241\311\316\301\360\336\343\037\340\237^a4\023xgL\023\020?\232\026q\240\302Pm\237Z2\366\224\206\372\0263\215\217@\346\305\276%\233\354\235R-"
+	.string	"/"
+	.string	"."
+	.string	"\331\347\345\004\331\247?;\345\265\264O\2354J\\\273K\245\307\277\307\317\277\310\003B\021\370ha\330]\307P\304q\313\333F\260\275`\233\025\273kI\262\217\372#\3460r\255\034\250\354n\004"
+	.string	"\260\254i\362\021\343\355cl?\332?=\344;\352\342\003\273$\325j\267*8\341\362\351\372\202F\311^O\342]U\332\r=\364G\236\372`7}\332\302\313\036~\372^\366\031\245MQ\021\037Z\232@X\257VH\202v\005\243\354\260\217m\034\217\326\331\272\206\215\306\tX\223\331h\034\005E@h\236\016\235\320\036$\250\246\373\320\214\2017\216\323Q\320\266u\024S\367\330J\222\261\223\321\253\205!3l\211^=\007"
+	.ascii	"2\241\311/\360\301\205C\227\241\233\325hp\227\027\355$\003"
+	.text
+	.section	.gnu.lto_pgResetFn_pidProfiles.75.84c5d4fd3cccd4b0,"e",@progbits
+	.string	"(\265/\375`\214\001\305\017"
+	.string	"V\237jE"
+	.string	"\261&\035;.\371/h\335\361\345\275\205]:\206\r\212\007\251U\332\350"
+	.string	"\267\206\374_\307\326\034\320zSm[\2322\016\353\032\305\225\021\251\tP\t"
+	.string	"\f\252u\023\0367\306|y\206\017\233\021\021B\366\226;\245V"
+	.string	"T"
+	.string	"S"
+	.string	"\366\320>\r\236"
+	.string	"\366\251}"
+	.ascii	"\366\351\220\r\343 \314>\354\240\022\316\330]N=X/\301[\306\320"
+	.ascii	"\247\324\030\3623\221\231\037\370\260\372L\242O\031`w\001\230"
+	.ascii	"2\310\005q\305D\2122D\313\365\341\023\304\310\370L-\217\231\310"
+	.ascii	"\356:~&\226\033\273\355\217\355\006\366[\001\250?{\352\226\217"
+	.ascii	"V\215\216"
+	.string	"\032\375\216\016\226\013\0041v5\274l\254k\262@<\365\333\367O\\\225\362\032+\313\352\240\037zCq\232\320Sf\241\2116h\252\320egw?>\315@\3734 S\354\355\363\233\355G\373%n\"t\324\205\013\330=\265rvA\220\277\201\331-\375\363U\374\306\223\227\3714\005\020\366\357\323\007a\237\252\276\252\202\205\370\317W}\223!\341\242\261SR\221\243f\252z\234\322\b\347\334-\260k\324\227D\220\342\313R\257\017?9\304\274Tn\214\342KuwE\252/6H\212\337\335\265\236l\355\001\335A%'\235\211\367q@\322y6\217\204\220t\036\016%\002\204\356\304\204\233\320=\220\300\215|@\\H\001{\236\222\017\207\342y\037n\003G\377\352\311\237\271\226b\205k\244\244\251/\316Z\252\251\352\304\217K]\001\271\324\243ht0\304\032\227\322\n.U\363`\255H/j\\8\342m~\233\343\200\002\036"
+	.ascii	"3\241\363i\f\246\001\205\332\256\221\265\314\230]\314\214e\314"
+	.ascii	"\340\035\266\r\025\354\210\246\021\230\226\202\021.\207\246e"
+	.ascii	"0\0133\2101\340\322\006\325\002\272Z\016\304\365*M\263j%\020"
+	.ascii	"\0277D\224\rv\332\333s\300\237\224;\327|\002"
+	.text
+	.section	.gnu.lto_pidResetITerm.77.84c5d4fd3cccd4b0,"e",@progbits
+	.string	"(\265/\375`\352"
+	.string	"\025\f"
+	.string	"FWR@\020Q\225\016`55\\\005!\234\032\005\346\"O\234\215hah\331\"\272\004\001Y\t\307[\026\177#8\210\003\224\345\024\302\\NUUU-\207\by\221YE\234\020M\005kG\210%{\313\235R="
+	.string	"A"
+	.string	"="
+	.string	"\273\253\251\b\353ex\313\330}J\215\235\037\261\234n\300t\343\003\275O)`w\003\200\033\344\202\b\002?Q\226\020]\037\036\201\311\343\003E\217\021\313\356:~`\350\276n\233\263\235\331o\020\236G\335\277"
+	.string	"\204\314\310b\354zh\205\354\307|A\342\250\333G\341\207\226\370)\256\242;\31200\357\003\326Bu\252\261\273\331\247)\330g\201O\256O\371\001\327\347%\356l\032\017K{\325\211\016*\220N\360\353\324\2030yp\b\361\211-{e;\036\260\235\341,\274\232\224v\227\201\277\342\251\013\376\210Oc\350\304\177\237~\347\372|xJH\206\t\020Ol\251\356\256\247J\262C/~u\344\233\315\302E\032Sq\260i4\216\204\b\333\004\bZ\205\355BA\303p\033\255B\300\031\315\003N\343d2\234&\t\367:\362O\307\\\344\370\360\350g*\311\035,\235\252\254\230\375\nR\360\353m\244X\032\"\216\313\335]\031\026"
+	.ascii	"3\003\3769\204i@'\266\213g,\201\325\302\00530-\005#\\\207\237"
+	.ascii	"\306H(6t&\2053\375\322D\340\030\207o\224\rv\332\333s\300\237"
+	.ascii	"\224;\327|\002"
+	.text
+	.section	.gnu.lto_pidSetItermAccelerator.79.84c5d4fd3cccd4b0,"e",@progbits
+	.string	"(\265/\375`'"
+	.string	"E\b"
+	.string	"\026\320;:@\345&\035\340\245[\223\036\003\350\274\226\007\033\013\031{\371R\304b\206\264L\265i4K-\023\271\307\310*\362\310F\226\216\037\322\034\027\370\022\252c\005\025M\367?\331d\357\224\002)"
+	.string	","
+	.string	"*"
+	.string	"\227\346\354\230\177\037\373\022\312E\t\300\356\316\350q\356\220\363_\362L7\n\035\006,\354\256a7\312\270\343m\033\330V\260\355\005\276\367\303\352\322pAh\331\305H\005X\224\\\t\271l\037\332\0379\tw\317'gvYRTv7\301\007\002\227\005\037\260.\253k\254\221d\207\r\224(Z\030F\337\344'>\371 \256\260\t\276\273\364m\262.\345\013\214\b\207\b\246\354/\004c\207\375jw\327\221\344U\3338\225v(\2061x*\335\032(\350Gcl\363\220\201\346&\021\221u \346'\343x&V'\346\206\300\032\210\326\271iZ\235\327\267\2576\b"
+	.ascii	"2\241\205/0\340\002,\230w\t\240YM\001wy\321N2"
+	.text
+	.section	.gnu.lto_pidStabilisationState.80.84c5d4fd3cccd4b0,"e",@progbits
+	.string	"(\265/\375`<"
+	.string	"\345\b"
+	.string	"f\321@;0\345(\035"
+	.string	">\333\024\034Y\nXh{\260-;7\245\206\005b\373e\300\265v^\373\261\317`\t\"\210M\001Q\3314\030\020I\200\231)\356\024MF.\307\376\242&\233\354\235R-"
+	.string	"/"
+	.string	"0"
+	.string	"4;\201vj\321f\371\330\261g\225`\260`\273['\307\305K\321\277\3101%\223\3502\240aw-K&\215{\336v\202m\006\333'\001\273\236)\373\252_J\351S\210\023\314E\323\332\315\210\005\330\024\352\372\310\330\276\264\017\362\020\361\252\2201\273\250\227\311\356\250\261\202\300)\302\013\264\007-\243I\362\247?\362\325\205\357a\013\220|\351\324\007i\247\007+\025\222\227\221\214\371\017ir~.\240^\253\225\226\213$c\366(\222s\303~\266\033[\310\t\037\300\255\353<0\374x\016\036\356\033pg\343\341\276\032NHp]D\375p\034\212\332\001+\352\306\300\336\267\2015\364<\260f\306}\2663\345\f\345\004 \b"
+	.ascii	"2\241\261/P\300\205#0\352\022\026\261\032\r\356\362\242\235d"
+	.text
+	.section	.gnu.lto_rcAliasToAngleIndexMap.81.84c5d4fd3cccd4b0,"e",@progbits
+	.string	"(\265/\375 %\025\001"
+	.string	"\320\030"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\177\001\001"
+	.string	"?\202\210\200\020}3\274\0014\273\001"
+	.string	"\002"
+	.ascii	")\242\f\240\b"
+	.text
+	.section	.gnu.lto_pidInitFilters.88.84c5d4fd3cccd4b0,"e",@progbits
+	.string	"(\265/\375`\020\001\365\f"
+	.string	"\326\226UC"
+	.string	"s\224\016\360\257\240\325\t\223)\371\226_\211jC)\352\240\336\227\336\226\033\306\002V\260k\013\006\374\357mQh\026\036\231\316\022\254}\345\177'"
+	.string	"\020"
+	.string	"\225\207\206 \031$*Z\265\225A\213d\223\275S\nA"
+	.string	"?"
+	.string	"E"
+	.string	"{\025\220\f\252\036\273;c\bJ)\225\364\322\212\220\372\030\016uy1\271\325\240k\251\234\311\243\245"
+	.string	"\305\006\207"
+	.string	"\034\211\245Y}\320\361\225C\r\334\b\204!\235\3355\254\\\311}\335\366\003\333\f\354o \354\307\357\373>\307\024\373*\277\204\320\007@\300\304j\266\354n\370\202,\213\234Q\"c\373\320>\212\247\240W\271\360\001\273)5b\354z\013\274\271\\\332\273\346\272\274\274\300uij\357\270'\".2l\323:\032\365d\002)\001\216\335\324\253\257z\213\254\302\266\225t0\352\311IT\024\226\350\323\365\030\201E\016\022\370\303\276\212\2578\371#lA\004\276^\372\"\327\345\343W\2769\361\371\350\220\202\237\355\241`\f\240\021\026\3124\007\037\254\204\261\207\363\301J\323$A\204\215B\223\002\006\2014=\33269\006\234\225@\3324e\23163\336\276\223\212#\326\356\256\024"
+	.string	"e\264= \370j+\242\240\f\036+\017\026\202\027\"\f\335\215\003\001\036"
+	.ascii	"2\003\352\f'P\330\334\013\002\256\020\252U\020(\230X \b\330\003"
+	.ascii	"\215\001\354@\021G-\006\303f4-\016RAh\220B\bV\003\225\021q'\r"
+	.ascii	"\001\006L\271\004\333\254\246\fw\344f{PaF\323*("
+	.text
+	.section	.gnu.lto_pidInitConfig.111.84c5d4fd3cccd4b0,"e",@progbits
+	.string	"(\265/\375`\306\r%;"
+	.string	"jg\340\02570jM:\204\222+\252\340\261\234\246\252_\265\210\"\330\312tvw\3352\327\237\007\201\271\007Q\027\274w\356\265\3079-\346j\361\343l\236\352\177\267o\226l\"\245L\001,\0014\001e\001\030L\376\005\223o\341\344W\240|\n\224?\301\344K\240\374\b\224\017\301\344?0\371\016\232?\326\374\006\224\317\240\371\013(_\001\345'0\371\b\232\177\200\362\305(\337\200\311/\320|\002\224?\200\362\303L\276\200\346\203Q\376\027\345{\231\374\256\346sQ~"
+	.string	"\312\3372\371"
+	.string	"\232\257E\371@\312\377\231\374\263\371\224\362M\312o\223\317\315\337#a\255>\311\030U\253\226>Y\325\023\225dg\223\273\206\376E\364M\224<\035\220m\013P\021\243A+\200Kw\017}\353Gn\241\341\032\212\002d\333R\240\b\307\016\257\326\212a\3517"
+	.string	"\227\216\231\313\377\n\332A\303=JY\260Z\333X\202T+\262\354\024\200K\217\\\002\347R\340\206\235K?\374S-\362M]F\201\252$_\325Z\203\355\346\275&ro\362p\201\277\223\232\315\303\357\357\354\201\262S\021\216m\201\016~\277\2635\\\302\354i\216U1\307\016\021\231\232_\265\326.8*f\006\306\002\347\306&\036/\333\233h/8\272+\302yY\376\235\325Z\317E8.{\255\375\277\346?\332\317\025)\207J\2751\2545\315\216\373O\2663Z\255w\351\350\216x&\200\247N<\212\224\342Nmu"
+	.string	""
+	.string	"\275\245\325"
+	.ascii	"z\254\246L\230\264\232k\031\312\b\264T\311\007,4HY\277\006\236"
+	.ascii	"\375\243}\376\330\345$I\264\271\226\235\366\216fC\272\222\313"
+	.ascii	"\256\326\032\342;\267J \027\222\306[L;\2272]1O\271na\370x\252"
+	.ascii	"\365(\372\372^\275\325\332\006\241\333\354%\346q\343\276sw7+"
+	.ascii	"\"\3366\367V\231\325\306}\377\213\254#\341\007\273\377SDm#\265"
+	.ascii	"\240]\255o!\220,\2435`\255o\037\226~\027M\341\264\244\354\315"
+	.ascii	"\234\245_)\347\322\355M\264e\313N\306c\033\367\365\221l\333\265"
+	.ascii	"V\266\356\270\037\311\266[k\255\334m\376\335Zk}\267\3717\271"
+	.ascii	"W[C{\037{\334\265\261\311\375\f\312\227q\362cP>\214\223\377\202"
+	.ascii	"\362\321N\276\013\312oq\362YP\376\212\223\257\202\362S4\377\314"
+	.ascii	"\344\2430\371'\232o\302\344\2270\371$N\376\b\223/\302\344\207"
+	.ascii	"8\371 (\377\003\345{\240\374\016\315\347@\371\033(_\203\311\317"
+	.ascii	"`\362\203'\337\214\362\313(\237\214\362\003d\255\025\346Bch\004"
+	.ascii	"\250\210xm[\326B_\350\003|\304<\025\332\302\320\310_\206\201"
+	.ascii	"*\264W\250;\343\221B\227AI6\246\f!'4\005\t=\241\305\350\036J"
+	.ascii	"BO\221\273#\336\211\300Z\256\034\022\372\\\213\322#\006\311\020"
+	.ascii	":\302\203\206\320buD<\007\275v\036\264)G\2743\326\016R0\226\261"
+	.ascii	"\336Z\2462\036\033\364\331\n_Y\321\002\rmS1\017\006\023\033\264"
+	.ascii	"\226\036\252=\006\374&\203\257\230\267\240\031t\313\021\361z"
+	.ascii	"p\233\320\304\033f\343\272\240\275\332\2402*\230E\203\345\022"
+	.ascii	"\264\002\004\235\240\317\344\201F\020Kh\006KM\302\036\203\003"
+	.ascii	"\275\265<\265'\346\252\306\362=\022\245'\r,\003-V\240\r4%\320"
+	.ascii	"\005\364\204e\253jW\251Ex\223\267\300\356\267\247;\227\022\350"
+	.ascii	"\255=\247\214\307\005\016\350;FU\314\013\353+wQ\255\265k@/\021"
+	.ascii	"\223\200\016\003k\001\275{\036\271\2522\353\327q\312\377\f\301"
+	.ascii	"\324\r\272\024\365\347\325\221\265\326\263\343.<\301:\310!Ro"
+	.ascii	"\f\353?\216\265\003k\272\247n\357\370\325\337\272\025u\345w\316"
+	.ascii	"u|\356s\347\322\226ccc\253z^\375\325\325^\375\333\304\325];\026"
+	.ascii	"\224\020\b\254\265r\365\036Z\013\313:\343\322\216;W\234V\353"
+	.ascii	".\305\030vFc)\333\031\315u\002M\204P\200\230N\222\b\327l(y2$"
+	.ascii	"\211p\007\022&i9`|\245\035\021\022Ycbc\210P\t\200\0131\033\""
+	.ascii	"T\022tb\244\210\360\b\221`\022!\020$A!L\232\004\315\304\276\246"
+	.ascii	"$\215I\320\311\332\032\223\340\026\262\256+Om\355v\031\222\334"
+	.ascii	"b\264\214\346$\025\206\024\243\177\210\370\2140\346\252\274h"
+	.ascii	"\030\315\233\256\360\243\027\375\323\223\265\207\326\b\213\213"
+	.ascii	"F\353\256\313\302\213\\\364\326\233,c\213DZXt\213n98F\304\242"
+	.ascii	"\265\226\256\366V\030\352\242\242Wt'\2770r\030HEk!reLq\274\022"
+	.ascii	"\314Y\247h\346\023\303\202\204gm\266\272\204\242\317F\0064$c"
+	.ascii	"f\210\006\315\211F\321b\254L\364\t5\334Gh\242\267\364Z\031K\354"
+	.ascii	"a3\224\303[d:K\242K\364\231\034\321$\3428\317\210=\021}\266\303"
+	.ascii	"w\206n\340\f\345\f\345\260*\346\375\354B\264\210\246 :\004\035"
+	.ascii	"\2363\f\004\242\265\332\2602\036?\304\261"
+	.string	"\3639\336\242\207\017m&\211\230|x\350\2753\247$\336q\353\320>\232\3458t\2076\353\210xx8N\310\241\271\226z\306\343\206V\303l\326\360\236NC\223\365\206\f\255\241\177|\301\316\320?9\263\016\352a4f\255\265\274\333;\222\261\231+\007\274)\323e\315c\256\244\300b\200\374C>i']1\217\2541t\031\030?\001\201\017\250Q8d\025\202hF\202HA\222$\315\001\021\006\204\020\345\034\235\007\021\3200\006\231\242\221\031IAZh\f\002\306\236\356*\207)\206!\035v&\211aQae\222\030\026\025V&\211aQae\222\030\026\025\330\245\311\023u@\024\322k\3314\017oDp\360q\361\310\325\305A\006\367\b\311\363V\230\b\337\370\036!\326\0232To\372\033\342f\024mrH\300\006\267\016\375\253\304<\241\266\201\215\036\t,\215\220%\337~\202\301\036\034\\\233O2\230#\244\221\206\022"
+	.string	"\006\234\210\351g.\\;\212\353>"
+	.string	"\371\3173\033)\f\037\214\341\332!`\232\017\206Eh\017g;\003\033\232\364y\323\251\275"
+	.string	"k\207\020\036\275\300\007\334\200q\363\301\220D\307\\\327\343\230`j6\356>\351l\233\325\241\337\022\3371omeO\256g_\003 \005\237T\f\265\n\220\023\330\337C\217$\"L\005@X\006)\341\235\345\222g\032k\277\322\303\261t\220\t'\213\223G\201\203P\351\022\374\316\377\272p\037\234\243\365\276\340\354T\217\333\202^\212O\316I3\333,S\026\227Sq\264r\007\221\375=>\002J\324\331)\354\227\256\373\361\030*\2575\344)2t\247\365+G\330/\207"
+	.string	"\235\004-0]\252tkJq\033\223X\022\302\364\313'\235"
+	.string	"?@\\\177q\277\213P\024!\323\0052^\b\306\244]\266\3338O\233\230\r\035\366\354;\332(!\211\323\321\222\235\302\b\265\222"
+	.ascii	"\317K\264H.\205\256\325\326\nf<\036\024\300\363\022\315\221\304"
+	.ascii	"~2\322\fx\335\025\006\233{\310)\250m\251T/\242n\224JX\250\244"
+	.ascii	"\232\266T\227zc\013\306\354\244\232\233\206-\344\225z\353\200"
+	.ascii	"\256\301\252\227\354\f\022xi\246\242\303n\332\374\266\203o\277"
+	.ascii	"\356\034\366\037"
+	.text
+	.section	.gnu.lto_pidInit.112.84c5d4fd3cccd4b0,"e",@progbits
+	.string	"(\265/\375`P\002\305\023"
+	.string	"\306c\200I\260\326M:4G\213\362!\202N\237\";\360e\nf\212\355C\270\251\233;\227@\365R\t\0335\005\242\346\226}=\232\366\\l\236\357\013\204\rtrP\203\017\225p\276Q\355\376\245\307\267{\243\301\016\r\335\006![\356\224\002f"
+	.string	"b"
+	.string	"o"
+	.ascii	"\266/\355C=\252v)\020g\331]\232\201\265\313{1\002\327C\363\336"
+	.ascii	"\">t=\200\370\3205\373\310y,\366VR\212zNv7\246+^{8U\326\374O"
+	.ascii	"\235\200V\326\250#z8\027\354\210\214:\244\353L\240\344\343\b"
+	.ascii	"\200\0167[\200*\214\274w)Bw\223R\345\301\356Z\216:\243[\274m"
+	.ascii	"\032\333\nl\t\025\262[\361\270v7\306\217q\031>~\323C\317\200"
+	.ascii	"\344G \361\341UeH\360\211\224M\006m\336M*\223\375\271\273k]"
+	.string	"\262E\351\227(\355\272\324/N\3519\2455\224\226S\372,\002\216\2003MvG\004\243\354/\304\341\344W\275't\236\303\252\022B\366a\234j\350<_\b\302\036\332C6\354\241\204\005\243\322O\315#N}\357\257)\240\022![8\t\305/\365s\\\207}\032|\345\253\336\270\304\367\234\t$(\326v\020\f\362\300\355\332\n\270\364\245\363G\356\351\346R\006-\232\344\222L\365}\307\342\361\233\274\241\246\206\352\322\t\351\205R\324\t\325\353\324\227\334\323M\006-U\365ES8\334\206\215k\027\027\343\323x\215\233\234\235\035\361\241\324\006[\0169=2\235\031\215\002\216\354g\305708\262\237XP\207\035Y\217N\314\203\314\306'vC\373\020\203\031\340\331O\016-\0264\233\321b0\236\355su\311\031\220~6\275\031\202\214\234\372\312\016\022?\234\022\205.RT\277\027AF~\364T\"y\203\t0\305T&\333"
+	.ascii	"\020\t!vA\\zL\240\355\262\306\244\367f*\034(\262k\373\350g]\313"
+	.ascii	"\002\006\032\032\243\235oL\272\2133 p\002\021B\244\007cB\017"
+	.ascii	"K\f\353CI\0322\261p\273\3545\326\326\346\004\273\267e4!\036\356"
+	.ascii	"k\331M\240D\375\224\255%\213\214\2235\333g\202\026\033\302&b"
+	.ascii	"X\f\356\363l\324\346d\364\266\374\305@1\324A\317\253\333\216"
+	.ascii	"{\3138*G\203\346\270|0\236\005\333n\266B\274\303\016M#\r\002"
+	.ascii	"\216\202\025\2519_\031\265<\020#\225\0136\201\246\245P"
+	.text
+	.section	.gnu.lto_pidCopyProfile.113.84c5d4fd3cccd4b0,"e",@progbits
+	.string	"(\265/\375`\023\001\305\f"
+	.string	"F\227TA q\223\016\037`L\024\366}P\021\003\242\245B`,\335\204\336E\201\240\002\"7#C\354\326\272\013\235[4\021D\0053j"
+	.string	""
+	.string	"\210E\t`Zt\235C\006\340\201\022P\300\024\r\355M\266\224)\005A"
+	.string	">"
+	.string	"@"
+	.string	"!\366*.h)n\354.\245 \336\271\3644;~\314`B\233\347\222\307\206\277\027\362b\244\r\020yx\2316\225\324\217m\345\205\354\356]\236\0266Pf\314\354\2563\264i\270\341m\223\330V`\277\n*\2623\215y\313\037\317\362\303L?M\253\246S\323\237"
+	.string	"\220\200Abc\027C\227cG\022\213\021\266?\331-/\b2m\003\007:gI\261\356v8\261b\227+`\002\036\227\334\261k\234\013Q\237F\250\030uj;>\331YG\206N\306\213\nU\200\210\030\271\273\0365\005\250\332"
+	.string	"\005\r\225\304\341\324\253\352\233\241q\340\03655\266\370S \324k\005\027\235f\002\224\235\315\201R?\330\177\033U\266\001\231\240\261N\022hL\256\022,\033\261\256\021\316\306\002q%b](\024\347\201\203\313\244\204:\271\030@\240\252lC\211\0040\206\242\311(\016\206e\324\304}\376VE^Pb\364Q\220\004\3639\202\204|\310wyfE=\016\034"
+	.string	"l\263\341\214iN\262Q\241-\324\357\345B\017A-\366\"\036\334\002\322\202j"
+	.ascii	"\244\236\210\373`\202\311\274\034\315\301\\\303\rf\001\026a\f"
+	.ascii	"(\007\006\003#\364\031#\270K\300\200U\215\254\031r\273\212\036"
+	.text
+	.section	.gnu.lto_calcHorizonLevelStrength.114.84c5d4fd3cccd4b0,"e",@progbits
+	.string	"(\265/\375`P\007\005)"
+	.string	"\312H\304\017G\200\332Q:;\334a\003-S\241\322\351\257\032%\200\237\177\017U\267-1\273-\253):R\021}\0227&\216\263\277\327\324\261\260w]|\316\203\026\371\3269P\214\334\345*\224V\222\301(\002P\354m#\261d\313\235d\351"
+	.string	"\324"
+	.string	"\345"
+	.string	"0\324\240y\030\223a$\313\025>\226\260\250\337\255[\323\332\210\030\341\200\262\356S\370T^\205u`Ta\032\320\233HN\036U\375\\\242\025\232,\030\320\233&\263\024\377\310:\276\024N\242SYC\251\232!m\356\275\fn2\004\364fe>\224G\221\272\361\305\201\356\365\261\226\345^\243\003VBo\262\021ef\376\327\235H1'\2551H\2213,\007\f\244\234{o\357\350\273\333M\373\240\333\315\006r\251\353r8\364\274\231\266\253\024\377\244`\227\234\021s\2455u]\356jY]\312#\025\263nT\034\022zR\340\261e\343\247Z\026\227\022F\275\215 6q\303c\353\306M\253j\255"
+	.string	"\034g3\256\226u\303&\245\365X\323iU\325\366\321J\355\321\275\367\307W\242\026U\255'\205{/\327+\255\2553\317\231\371\n3C1\237g\026\242\372N\220\"\374\027\267\233\006\372X\276\241h\306\206\3305\254K\036\320Em\324\021\320\3226\252\272\344\2636\030\320:1:\316\312\340\314P+\352\257\212\372U\016\264\306\245lLUO1\033\251j\377`\276\275\355\203yI\201R\202o9'!\260\225y\266\362\201\213\235\221l\345\243\207\235\r\334\370\027\260\225\t\330\312FG\236\007\034\354\\d+\017\235\354\274\273\224\263\220\255\034d+\007\260\225\201l\345\037[\031\200\255\354c+\367\330\312<\266\262\316V\316\331\3128[\031\265\225O[\371f+\233\266\262\265\225\333V\256]\371\013\004p\245}"
+	.string	"\273W\306\262\316\035c*\221|\313O\366\213\375a?\362\007\373\245\374d>\363\265\360\313\266Da\021I\023\002U\222\005I\356\275?\271~\331M\2630]R\257\263\177L\365Pc\304u\360x\266\346\303\365\225_\262bsS\320"
+	.string	"z\251A\034\323\"\332\n\332\226\2458j\237\2156\321\232\324\254\212\317\255\317>\355\244E\243\276\365\2237\337\234\261I\331\206u\251k"
+	.string	"}kK\236k\325\275C\236\331\272\346\232\2761\373&\226\232\361\272\333\366\223\277\240\004\263L\275\370\013\0262\207\331]\217\2201\321-\001\315_\303J\206\227M2s\345\325\016\036\303\244]\215\223?\036\343\261\333\315\332'\0344&\\\303\272\254\367\336\251f\024\267\367\210c\232\252J\207\371h\017\203\202_\204S"
+	.ascii	"\353\257n\362\201\267\233\357\037\317\243q6\207\353@\0375\257"
+	.ascii	"o\345<b\031R\037\350\216!\006\306B\324\271f\221\372c\257t\326"
+	.ascii	"\020\273\f\364Qc \223\312\341\177\t\300\237\220\251\303O\310"
+	.ascii	"\364\364sjz\372\355\204ML\027\204?\250'\037T\256\205\210\312"
+	.ascii	"$\242\216\020QO\bM<\371\202B\017\031\236\200.~A\340\t!\037\211"
+	.ascii	"\025\302\237PX\301\311\307\302\347\324\303M\017H\374T\364\204"
+	.ascii	"'L\374\234J\364\236~L)zMA\250\336\003\"\006\252\360\005{B 0\330"
+	.ascii	"\323\031\207\267\267}p\355\343s;\276\216\330\3239Y\232S\312\t"
+	.ascii	"\371\3022\227\272\356\370:\202\023\"p\254\256\032c\206M5\324"
+	.ascii	"\004"
+	.string	"\204zH\027\324J\001\032\250\203\232\b\231\026w\035\240\211\354\244f@\375\2663`)[\256\177\360\2257\237\224A\021\340\322\236\214\235\tz\327Df\336\265\021\0223G\264\252J\007\367\346\207`\027\307\006\327\020M\352\237N\320\215d\373i\035\262\215\t\227O\343:\251[,\305\241\304\312\213\216\t\313%[O\373\364\323\"O\347\272\247\213\340\244E\034O\013X\223zq\362\001\200\220\250\2214\304\224R\246\244F\222\224\024$\215\001\200\002\231\251+n\021p)tNF\232\244\224e\r\206\222b4Z\321\206\006i\370\354\033\320\255\206\207\257\247\037\246^\0169\325B\222\332\020\302O]{\177\306S\030\032\344\275\274x\027\223\n-\241\3654\340\244\271I#\211\301u\b\001\264\036\314\036T)\004\371\007:\004\203\330\023\305\233JT^\225\f#G<2\020\206\213`2\336\350q#\217\247\274\b^\264\211U\277\023\204\177"
+	.string	")h\226\267J\271(\315\323\212%\026\366\201\307\204M\370\222\310\342m\bc\307\212f\300\305\212I\340IR\221"
+	.ascii	"\237`o2\331\200V\374\216@\270\364\326\003\345\215\177\030\247"
+	.ascii	"\205xM\027\314\341\370%q\016mA\327\200p/\215\310\323 \f[\343"
+	.ascii	"\240\340\306\345\200\372\216<\261\013 9\262\003\265\340\230\305"
+	.ascii	"\020*sD\370\243\367\247I\305p\244\212\240\216\301C\022\034\372"
+	.ascii	"\226<s\231\\~_\324n\372O\365\203\034\216\320\224\253\241\227"
+	.ascii	"L\324\272\364\301\n^\356\334\031\r\316\232\223\252\327\370\254"
+	.ascii	"\263\216\277y\370\017"
+	.text
+	.section	.gnu.lto_pidGetLevelAttitude.115.84c5d4fd3cccd4b0,"e",@progbits
+	.string	"(\265/\375`\331\001\305\020"
+	.string	"6`pF\360\320&\035\330\030\370%\373\357\273\205\362\277\325T\033\017\302\345>\332\242`L\256\006l\204\372\277$U\345\326-\243\026\202\326\256~\306\257\205\371\340\031\270\0341}\240T\374\032S\032\036\237\237g\334\267\021B6\2212\245Y"
+	.string	"T"
+	.string	"^"
+	.ascii	"\347\221\351T7\023\214:\034\355\336,x\364I\367\230\036\022<\355"
+	.ascii	"\263x\213\324w\f{\200\335\234\031@\273\256\022+\350\036\355z"
+	.ascii	"\310\366\330}\300\366\350\224\215\343\256\326r#ljzv\354\256\247"
+	.ascii	"!\236z\246\374\277N\nqTO.\302\356:C\234\r\267\3366\211\355\007"
+	.ascii	"v\266\004\312\335\370\341\0214\2233s\371\027\177\301\034h\205"
+	.ascii	"vL\206|\350"
+	.string	"\244aBF\243*\333\245J\005a_\333\335\265\346\330\337\371A4M\322t\247iN\323\233\246\243\2465M\253\246S\323\027P@\205\215\317g\327f\326ce1\210\304y~\373\177\271d\273\356\"\025\371\220\323\221\250\233\212\f\261r08\220c\037*\252\321\212\332\340\004,\205\246>L\305\261\020\021\276a\333\243\022\2059b'\342\200b\327\376\240\331\235!Q\325\224\300\020Kg\2253\227\362\232j_h\311\207\252#\032TUr\031'J\202\341\030\202\226\317_\247\367\024\355\256\203\307\274\205\266\307\007.\247\017D\001O\250\316\244\022\003~ (\201\305\204\301\304\002\342\024\023\225\357\305\003-\254|,\025<\227\017\245\305KA\301x&\">\275\230P\036x:\241\274\222k\257\255\346\230\302\n\331\214\256,\243\355~\200p\304\2233\223\324\027\322\214>Hj\340\207\245\263R\307\036\243F\207,;\025\371a\225X\345\314"
+	.ascii	"rS\333\264\022# \200\002\221\271\331\003ch\307\030*\024\277\331"
+	.ascii	"\200\357#c\225\307\230YYn\213,\233\f\004\033\013\264\242n\374"
+	.ascii	"4S\003[\234dq\243\335\262\257\032\217\373`\324\350\256\020\326"
+	.ascii	"o\360Q1\002P\243\260\377p!\343D\324Wn\333\260\t\301\376\n\204"
+	.ascii	"\344\305e\310"
+	.text
+	.section	.gnu.lto_pidLevel.116.84c5d4fd3cccd4b0,"e",@progbits
+	.string	"(\265/\375`W\016\315E"
+	.ascii	"\032y<\03290\246J:\341s\177\254~L\223\271O\241\301\264)\004\205"
+	.ascii	"J\037\322\017O\375_\307S_h\303G\324\202\n"
+	.string	"\320\345\001\330#\357\033\004\250\257\207\222\341\307\326Zkd\023)\223\f\224\001a\001\245\001g\345\355\3632\222\3676\256fL\2357j\213i\332d1TzX\t\307\234\320O\370\347\371\367\374\334}\241U\022\262\363St\344h\210:\312+\f\264FEG\236\316g\017h\227p\371\264y\207l\342\327&1M\005\337\216}\356gW\271?\316g[\220\341\2324M\225?v\225\257\347.s\257\347\203\253\334\263}\232\210_\330\362\274\035\343\356\266\352\374\006%\246i\372\340uqT<\333\347\254J\355\220HIq\332\021b\tD\323!\322U\225\322\315qs\201y\367\202\217\303\274\034#\267J\323=D?i*8\266b\202\307=?p\013\027\231\246Z\332\370I\323tl\303\216\257\273\273os7\314\335>\247`_\030\343\340\225$u<\245iZf\340Z\350\353y,\364\265\273\234y\257.\256-\255,\254+\253*"
+	.string	"TSR\312$\362hD\353\331\314\334\017\376\\s\311\260\016/\356^]\200\347bt\267fp\fo\211\271\226\230A?\316\322\342\344\313\261.\027\346W_\300\260\225\227Wy\351c"
+	.string	"WNuE\217\247\300\2648\261r)+UXYH\345\3113\272\243\362w7\205\221\306\017\206\007\323\342D\312\217\214\356\244\234\006\3224\375\337]\036\033O\007\211\177\024\017\350`\214\356\302\234ZM\304\324}0\t\243Q^\233\203H\370L\342=y\237\016\364\016=\241\302\233;\265\026m\261t?g;<:f\343\2074M\227\353\360\234|\277\276\373;\273\353\267+e\030Y\272\371\326\254\225\235\007\245\357\213\241F\211\350\030\324&[\211\354d\267\250\246&d\327\302$\243\214}\354#6\023\035\031;\202\242!`\240\211F\333\254\337\324\253\215\366\021\035\271tFh\3074M1\354\017\277\210\305\272\200\301\257\203\201\276\326\256\212\202"
+	.ascii	"\t\317\3566\321G\324\374\233\343\305\275b\022\275K\303\006\277"
+	.ascii	"\356\354\003\302B\327q\313\335]E5\023\337\334O2j"
+	.string	"o\034Q\216c\232\322Y\330\037:\222\230v\fc\004}}\033\005\025\002\006\312\361\342\256\340\0347\337\356\317\264\367v\225\2745h\3148\236_\306\t}c<\317\367\305\355\374.N\347oQy\317N\370M\241\344=af\342\201?\211\313\371GT^\017\225\267\003\207\357\371n\370\236\257\206\343\371f\250\274\030*\357\205\312k\241\362V\250\274\024*\357\004%\257\204\312\033\241\362B8y\313\244x\311\244x\307*\257X\345}\220\344u\220\344m\200\344e\220\344\r\253\274\013*\257\202$o\202\312\213\240\362\036H\362\202U^\003\225\267@\222\227@\345\035Py\005 y\003T\336\257\363z\235\267\353\274\\I\336\255\312\253u\336\254\363b\235\367*\311kUy\253\224\274TI\336)$\257T\345U\2367y^d\345=\"y\215\225\027M\362\326\312\033V\t\372\tG\201\302\b:\301\201F\320_\210\374\030\357@\225\031"
+	.string	"`c\334\204\211\201\006{\304\245OP\252@\033\350/\3041lW\240o\307K U\363-\313=@\017H3f\212@\357\256\030/A\243\300J\0064\001<Tt\002z\300\337\034\263\f#yc\272#\207L3K\364U"
+	.ascii	"\202)i\372\364\336\004J\025&=\364\236H\r\275\001\005\032\240"
+	.ascii	"\203p\\\200\260\346#\300<9^Tvh\017_\335\301\253\277\272=\275"
+	.ascii	"\253\275\332\310\251\311f\256\323\271\272\253\215u\266\232k\354"
+	.ascii	"\242BmMJ\263\247\367&\003 \336\244d\363\355\r\217\023\216\234"
+	.ascii	"\n/\031\317ZC\333\221`*i\272 \367\252zB\243\212s}~f\267\212."
+	.ascii	"M\345\020huUVkucuV\033\021\233l\340\366\276\205\350Uc5*\312\252"
+	.ascii	"\257V\354\212\233\316\211\211\206\251\206\t\310\004D_\255\232"
+	.ascii	"\302$\302\r\364fM\337\261\371\366\301It\2004[\346L:\300\273\314"
+	.ascii	"7L8\374\272\024}@\277\337\224N\207s\035\367>P\211~\214\017Ck"
+	.ascii	"\324\230C\351L\037\206Ru\215^N\2227\367K\307\004\"\204\b\021"
+	.ascii	"\350+U\033\243\034\002D\247\332\022Z\005I\224^i\304n\t3~\235"
+	.ascii	"Y\335YO\225\3311\234\023\311N\"9^\374\305\324\351\035\326"
+	.string	"\346[\026\202\232B\337\317\221X\n\313|\301\304\312>k\273\260\243@\245z\307\234I{H\217\204b\037fS\250P\201\276J\365\007\317a\320\270\321{\223w\036\333\254)\364rs\323\034\377\341\264(\333\203\354\255\007\334\r\266\262\266%\033\3332\307W\0178\036minph'\332\226E\324\334\226=\262\326\226\311\n\302m\351\346\226\226\204kS[\372\200KC\323\241v\006\327\226\346\346\006$\307U\232\016 pjpp \326\322\202\244\255M\261\251\271\255H[\343\321v\003\231\266\246\266c\351v\246C\315G\362Mm\310\215ss\220\351P\363Q\006\327\203\207\332\332\216\2626\265\033le9\334\336\312\310\272v\351#\315\255\fn\271t+S\n\312\375L{o_\350\025Q\263kF?\223\241@.\032\235!\303\231P)<\224\3539/\031\215\241g\350\305\350\013\215\241\275\020_\264\205\276\320\377\223\262|,4"
+	.ascii	"\305M\200\022\330E\3572\2550\257\360\353b\364\013\375b\250\300"
+	.ascii	"9\244\353\270\256\027]\241it?j\376\211\3411\333\207\231e\371"
+	.ascii	"\360\353\226\017\372Z\241\225Q\020?\345\311\031\"iR\206\253\371"
+	.ascii	"6\323O0\232C\351\017C%\364\t\006#\241\215\\,}\312\213\320/\232"
+	.ascii	"\007\233z\020Z\254#\364\371\250I\206\2750\261\274\355\205\240"
+	.ascii	"\257\020\372vS\310\332E\227\365\233g\316\257!t\254\311\372$z"
+	.ascii	"\254\321G{ \231\301\342aq\021\324\203\026\3537\377\034\364\203"
+	.ascii	"\376*d>\346\226\017JJS:\f\273L>\336cv\331r\204\220\351\345w\372"
+	.ascii	"\210\240\257\016zB\032K\200\204[\r\232\263\240U\300\302\241\033"
+	.ascii	"TO\226\026\233Z\347\325\206\006Rx\t=k\016m\267\222\316\240w\350"
+	.ascii	"1P`'\322\247\25402\256BeA\207)\350\005\375\205\b\f\347)\300j"
+	.ascii	"\276+5\001\201\023\250a,d\221R\246fFDAR\220$\215\001Q\005\304"
+	.ascii	"\030\347$"
+	.string	"T\017\0210\251DL\r\215$)Ii\030\003\210\366\216\240\277[&\260s\252\342\235k\210i\240\004\\\007\007\243\016\212\327\f\017\210\234}\020\242\361\243\031]ESu\b1\035$\031\340\373\341 \337\2749\235\273\262X\351\347-u\333\331\201\222\275P\272\234\003\252\b\340\021\335,\321\203\026\340\243\330\254a\365\36204*\240\325=j\272k\242\030\242Z#&\236]N\271\364\303\177\031\243\033\324H\247\206\177\373\334\206\\Qn@\310\323\243\034\257;g\227\322\335\233\312\013\344F\301l\375\022\317\t\321\317J/K@u6\334,\2069\326\323\2623s\247\"I\312\373\327;\244+k\236\372\207\210[\374\240\252\224u\363+\275F\020k\032\320`\343\316!\221\035\370{RBt \324\230M\203\201\326\356\370\177v\214U\300\331\215\203\275g(\033y\327\304\300e*\317\237U\342J;\271]\302:\266\233U\326^\237\177"
+	.ascii	"\373t\301V\n\313\003\217\023\272y\255%s\247<\027\261\016R\027"
+	.ascii	":\220\035\026\214"
+	.string	"\003\214+%\254\203\303\344\024\230\013O&\250\3413\250@*U\r\006\374\222/\347C\277\263\302\003c\247?`G\216\256\317k\262\240\276\301J\253Y\245\224\222\2325\370\003\254\376G\312sk\226\307\276\\\372\032\212\234\031\252H%\200\316\240$m\020\225\372\364;\r'\277\314S\375\370T7\314E\035\343Dn\245s\022w"
+	.string	"3\354\212\211\342\247\331\b\265\025A\004\324\266\220\261\345\301e\317\300\201\354\252]\357\320\277\031T)\237\3077\f'\364\256 \312\nc\320~\020\351\361\270\263(\367\376\025Nd\252x8\006\200\023\334R\232\363\013{p\034\032{P\337J\004b\356\272\352"
+	.ascii	"\017\215Q\300`#\305\226\210p6\t\216\210\326\262!1p\303}\022X"
+	.ascii	"\253c\030\247\354\220m\314L`A.\311\210O\362F#\005\250\017)\230"
+	.ascii	"\177\007\272\023&\275\025\211&\364\340\325\220\275?"
+	.text
+	.section	.gnu.lto_pidController.118.84c5d4fd3cccd4b0,"e",@progbits
+	.string	"(\265/\375`*,=\300"
+	.ascii	"\n3\255CM\020\030\305\355\214\001{.\322\"(pL\205\0012~\300*l"
+	.ascii	"\264M1\3016Q\312\001f\300\234\312n@\024l\310@F\270u\356\356="
+	.ascii	"1\262\300\341\037\317\375v{\\\004\202\373\356\206\351D\300\365"
+	.ascii	"(\224\313\252ux\376\264\2267\221)\245\024&\004\306\003=\004\254"
+	.ascii	"\363\221u&\272\340<\304:\013\261\316\025Xg\226u\016b\235\201"
+	.ascii	"\214\234\215F\316?E\316\305\2433\221u^Y\347'rv\"\347\3568]\367"
+	.ascii	"\325\305Uv\365r\330\332\254j\237\226\217hW\326\202\335\201\355"
+	.ascii	"R\332\237\355\315\366'\355\316v\252\356j\267awa7\265[O7\233\356"
+	.ascii	"6\335\322n\275n\276\356\273n5\335o\335q\335h\332\202\017y\317"
+	.ascii	"u\327\265\220W\360\r\314=\205en\305\215As-f\251m\223\266\023"
+	.ascii	"L\227o\f!;\0248~\345PX\210j\216\257k\214\023\007\301\255\334"
+	.ascii	"\351\305L\352\005\217\261\211\376\344\r\0273\277@?c\023\275\271"
+	.ascii	"d(\f\313o\f\341\324\330Df\227t\314\252x{"
+	.string	"w\304\032c6\302!\224>fY}\260\230a\361\241\362K\264\374jS\\}\231]\355\031\3670\253'JY\341\tF\300\036l;-\310\215\207\353(\215\364\224\373\016\220\0269h\334\201k\033\327f/\024\326\215\364\023i\204\253:*\3540\033\341\256c\244\351,qv!4c\234\003\0047\350\367\203\267\007\255m[8\035\007IO\231\250e\206\013\022f\366\204\356cf9\001=e \2527\261\2561m\333\342q\243\320n:\257\367\372\r\263|\374:\001\234\0134\323\263*\323\013\024\223\362\213\303\220\260\313\330f\tS\025[\313\205\r\203\0227\206\3205\272\210\241l6QLTlmVP\037\0246c\b\333\226\355\211q\315\035\337\301\275rLc\002\230\331N\303m\307\254\032~\273\215\322:\037\236\254n\215M\274\320p}\246\345\232\256_f\353\2260U\021\265VY\256\027\017\346\266\212\240Qb\244z\032\345"
+	.ascii	"\2752\210[b\244z\"9\313\320\002\333\266\275\200\371M\001F\252"
+	.ascii	"'P\023P-\260m\237(\232\310\017\030\233X\246\243\3126\303d%j\253"
+	.ascii	"\302\344l\030\233\310\264:[\0030\020\265UQ/\027\355\314=\246"
+	.ascii	"\325\224M\346\203>\266-\0266i\332\226M\005\22306\221\331\372"
+	.ascii	"\250\330Dc\033\025\233\310Jf;\315&\326\366\013\305\211\033a\333"
+	.ascii	"\266M\257\205\337\277W\266f\216se\363\031\216c8~c76\303Q.\303"
+	.ascii	"m\314\226\003\307\r\033\n\324H\200\306\f\0311`\274p\321\202E"
+	.ascii	"\323\n\025)P\2340Q\202\304\b\021!@|\360\300\324\201\303\206%"
+	.ascii	"\rJ\0310$!\035]0*:\022Y\030\022\252\300\006\001\031\177\212\304"
+	.ascii	"\365]\311\375\243\343m \247\026U\363\231\225hke\261\246\212s"
+	.ascii	"\334\205i\230\333\f\227\325\374\226\345\206\004\306\274\342\002"
+	.ascii	"cb9\233\211\376\350\200\322\\\206\333V\021\300\230 8\263\255"
+	.ascii	"S\300\302\234\235\003\307\364yx\366\254\372\rC\267\321\307\025"
+	.ascii	"(\354\032|<\201B\252\323($\364\031\205\200.\243\320\216\307X"
+	.ascii	"\002c>\251\3430\220\300\230N:\376b\t\214\351t\253\b\270\2139"
+	.ascii	"\335b\025\221\306gMO\237sV\245\267&$\270\325\237\263X\002cZ\275"
+	.ascii	"\361\363\246\275^\261\247\347*\362\246O=O!m\024n\326\243>\251"
+	.ascii	"\237h\323&\326\026\357\227aO\237m\326!/{L\024\274\304\217\016"
+	.ascii	"\022k=\242\316E\254\321y\210w\316A"
+	.string	"|XC\343\036\326\3168S/\331t\207U\304\364\271\266*\235=\343\234\003\0319\337\260\2446\3065\250\265\222\030?5\3170}\232p\366Ls\fgO4ObS\346Hd}\264\236 \353\342\027\270\264\321\232\324F\354\255\004\024OL\237=\267x\021\027\022\3748\326D\026\304zhU\352\222N\351\351\323k\025q\366\354r!1<V\274\302\330\312\364\246=\234=\271\234\005\341v\220\007\260(#4\320z\"P\215\236\236>GX\217\262\310\234}\366\334r\343\217\016\260(n\377L\237\356\312\324\266\255\023/\212\320\304f\023_\247\364\257'\272\244S\206\264\252\326\2437at\372m\267\322b\272\377\350h\333\226\335\251\025\245\371\201f&j17\r\346\021A\002\317k\205\274\267b\356\274oA9~\221\374\320\374\274U\323\270\210\216/%A\346\354\262\360\320:+\337\315.\246Wi\250\3113\035j0\377g\302"
+	.string	"F\365\252\234\017\363\265m+\364\320\260?\032\247Qi\203\371\016\373\036l\037z"
+	.ascii	"\361\232\204\313\272\007\343\205)\b\367v\245\224R\367\215\247"
+	.ascii	"W3=}\322\354\226^m\266\266m+<\364\370R\311\022<\312\257\261\315"
+	.ascii	"\313(\263\264\224R\244\024\233x\374\037'q\250v1\374\351\231\225"
+	.ascii	"T\224[!|\277\351\316\342\265\365m\333R\261F\024\335k\332H\245"
+	.ascii	"\222\001B\321]\365V\334A\017\365N\323pJ+\034\374\234\314J/\345"
+	.ascii	"\025o'W\320\253\362U=\025\237\350\222J\001z({\221_\020\177e\017"
+	.ascii	"\231\237\316\372#oE\242\330V\357\252\025F\347|\223(\016}[=\273"
+	.ascii	"\023\227\351\325\325\230\026\326Y\017\344\346\250V\253?\017\345"
+	.ascii	"VB\213C\377``\274\004%T\213rl\254\330\304\241g\251\344Q\205\256"
+	.ascii	"\336\351\276l\021\372\277\203\362\354W\3706\353\302~\277m\364"
+	.ascii	"\216\271\355\374\206\3624\3524\007\203\036\350\333\371Kp\232"
+	.ascii	"g]\234\214\3372\256\343\272b\023\203\336\315\374\271\313\345"
+	.ascii	"\363\333\354Um\273\004\001\364m\327?\322\024\3025\2750\231O\002"
+	.ascii	"\021\356\216\312\265\364j\321\370Y\\L\2137\337\031\211\376\325"
+	.ascii	"\305\317\240\266e\375yfV\341X\224f)\374\332\266\245\301\016\346"
+	.ascii	"a\312/\334\\\232\310J0\3120a\234\202?O4l\024e\340\360\376\241"
+	.ascii	"l\242\225i\305\342\017\211\376U9\037f\357r/e\232\322\004\245"
+	.ascii	"\232R\255\330\304\342\023\341N\240\272\304g\257\342\\\312\265"
+	.ascii	"\035<x\3449\005\327'~\327i\352u\223_\337\002>p\315\300n\362\031"
+	.ascii	"P\253N\016\375\377\177\362\232\201\375"
+	.string	"\315|\377nzaz\225\331]\337b\302\315\205\235zx;{\024\233\330\317Ry\323\334\245W\177,?\204\336\027>\r\316\fA\004\336\316n\277\363\340i\251\201\314\247bfc\372C\253\325\352!?\026\346\024\372\246o\370\366\364:\260\271\363\244n\354\\Js\253y\353\344\374\331\334h\342\340\274\331\334e\272m\315\235\315\255\226\206\326l\232;L\01367\230n\323\334\017(s\252\346&;:w\227\25667\227\2616ln1-]\330\334Y\240Mmn,aW\276ZOs{Yi\256\326k\356*[\315\326\335T\232Lw\213\320!\0249w\224g\026V\3075\367\025\353\334P.8\267U\253ing\243i\356&}\327\334Um\246\273\231=\327\334\313\256k\356\226u>\342O\232\215p\320\322f\250\"D\232\257yH\3635#\373\256\371\351\310Y\310\2213\002Xg'\326y\003\326Y\003\3269\003\326\371"
+	.string	"\254\263\001X\347\002\260\316\030\260\316\004`\235/8r\036"
+	.string	"\353l\001\353\034\344\350\f\204\310\271\202#g\nXg\001\260\316\023\260\316\0018r\226\240\3109\202#g"
+	.ascii	"`p\206\200u~\200uv\200un\200u\376\301:\373`\235{\260\316\f\260"
+	.ascii	"\316<X\347\005X\347\035I\316:\220\234s$9\343@r\276"
+	.ascii	"\301:\333`\235\025`\235k\260\316\t\260\3164X\347\031\254\263"
+	.ascii	"\214$\347\030H\3160X\347\027\254\263\013\326\271\305\321\231"
+	.ascii	"\205\221s\323\321y\205\221\263\212\243s\212\2433\n#\347\023G"
+	.ascii	"g\023F\316%\216\234I\260\316#\216\316\"\210\234C\260\316 X\347"
+	.ascii	"\017Gg\017Gg&#\347\016Gg\016F\316\033\216\234\227Xg\r\254\263"
+	.ascii	"\322\3219\003\2213\206#\347$#g\244\"\347#\326\371\302\005\347"
+	.ascii	"\242o[^\250\201M\236*\305\214\267\361Dm\210&FE\361P\266\3614"
+	.ascii	"\276\373\372\001\257\300\333\370\325\255\331\305\274\372\032"
+	.ascii	"\257\300gH\340k\374O\t\374\032\301\230\240\224\222\300\313\370"
+	.ascii	"\263\233\3614\376\013\277j\\7\343\373\351\302Is\337\214_\022"
+	.ascii	"\357\345\001\217\201\233\002\365\204\214'\3437\251K\035\247\340"
+	.ascii	"\006\376\342c<\303x\031\317\324\344I\370-\\\247-\031\215\026"
+	.ascii	"\233\030\343\201\334\327\362bI7\270\344\2313\305&\302\370\237"
+	.ascii	";n\203]j.\257\301\"&\212\211\2072Rs=\257\035\240\222\232\353"
+	.ascii	"9x+F\032\362\334\201\310\363\2324\344\213\274U\233\033\236\350"
+	.ascii	"\337\213\207\362{$\206E\356\351\234\202\335\276\213\177\361E"
+	.ascii	"\267\346\031\007\337\342]\374\372`\374\032\377\n\235RJ\213\377"
+	.ascii	"Q\343F\247KmY\302\213\325r\373\352\0323H\342\241\354\322\267"
+	.ascii	"\322b\334:\264\301\245W\327\262\367nD\331\247 \373.\373\025t"
+	.ascii	",~\3057\331o\310kz\026U\222}.\025\033\341\316\257\351]:\246\342"
+	.ascii	"W\270J\263"
+	.string	">\244\222t\323}DP\361\276\354\037|\\:\252q\317k\213\210.\237\242\312OQ\256\275<R\350\341\362\335\345U\3445\tQ\274\211o.\277d\330\364r\342QDI\366\371k\371\211\367\273?\273\022o\"Ki\326}\374\036+\351\246\365\370\375U\211\367\266\177\b\272tiG2d\326\204 !\247I\274\373M\315\370\252\236\352C\037\303- \306\306\276\003]\223\360\235b\017\2022\253\245~\377D\354\373\260}\220q\341\250v\313\242\\ \332\007-?b\032\325\323\362\035\352\250\370&\277\035G\354\233\370}U\226\357>\355\303\316\205K\023\242\302\007\350\341\241\f\375\021\337\323\250^\227_\362\253\206\353F\024\275\375A\277C^\223p\231\342[~\033NU\231\325y\207X\276\371\264\2174\356\233RY\333\036\023U\207\207\362\222\245\217A\t\243\302\323'e\023\343s\207\303C\371\254\354\315\240\001\310\260\252\267\324W~"
+	.ascii	"\3569y54\027\320\327\235]\331\253t\341\241\336\212\327\fC\202"
+	.ascii	"\336T\353\226\372\353Y\303\220\347Ui\310\023y\2537/\342\033\254"
+	.ascii	"0\231\007\002I\252\210&5f\270\274\t\301\367\035\207\032\342)"
+	.ascii	"p\335\250z\370M\022\313\223\274SJ\341\343\272\241mxh\225\276"
+	.ascii	"\362\311*`\323\013\323\353A|\177=\321\255y\306\304\203\007\342"
+	.ascii	"\205\360\016\323\334\345\333sq\276|\345\250V\371|\370\366\372"
+	.ascii	"\225\256y\346\341?\274\206\274f \323sx\017O\314\323\341\231\002"
+	.ascii	"\225f8\304Pp\300\244\033\033u\334N2/\271\227|\363\246\330\304"
+	.ascii	"\016\217c\314n\303s\370vr\270\214@\262\257\357\374\332\266\n"
+	.ascii	"\216\317I\3121\266m\325\337\007i\222\177\3756\227\006\024\233"
+	.ascii	"\270\341{O\257`\302\030R\3558p]\231[\322\353\245\357\263\350"
+	.ascii	"\234\007\334;Y\247\310\234\004L\336\361v.\001\201\251>\251\201"
+	.ascii	"6\320\242T4(]x\366\346`\222\t}^%.\277v7\00419<}zJ\257\341\273"
+	.ascii	")\270\204\303/\036\256S\372\037\274=i.\b\2701\177\031J\254\205"
+	.ascii	"\211\376a\350\275\317\360\236%*\235z_2\317\236$\225Zlb\006\020"
+	.ascii	"bkX\272\324\334\275\307\220\307\311!\206\326\373\236\323+\030"
+	.ascii	"8mZpo|L\204\364\300\360#\306\222\202\024\223\\\352yA\222\205"
+	.ascii	"I\303\244a\261\211I\377x\203T\267\312\017\371\346z\034\206\325"
+	.ascii	"\246\2276\374\256\360\343d\325QPf\215\220\201\347l\224TLe\223"
+	.ascii	"&U\236\210\007\230f\207\204\364|\2474\203!v\302\220G\""
+	.string	"\n\032\312i\352\365\022\016\357\311\321zD\006\215\025\222\031\365\326\363Z\204\374!o\345\341\350=Ps\364?N\354\244]\260\341\310\357i\317\2115\225o\021\036\004\245\325\326\257\020\320#m]\302;M2\243\207:\264\237\376\311\310\310\351\2421\252\035\242\316{7\243\326\261\035\302#\337\212M\350\3062\nF\347\270\230.\372\306\242+B\261\207\016\365h\241\245\215\005\335#3\324V\002\\d\205\222\"SNH\224\270\310\n$\022\250\251\246$QH\220D\t\311\360\204\224BN\035\201\362A\224$\nj\nJI\022'\251\251 \342\0024\360\035AL\246\240\204D\035AZ`a*\tTT\007S\310\n\236\240&(\212\222bB\304\210\234r\242@*JJ\n\t\204D\n\t\304\001\342\023r\312Ij\311\224S\005SK:\230Z\022eA\t\324\002\234V'\r\\*jJ\210\223\017\247\016\246\200\220D\2228Q\260"
+	.ascii	"\250\b\244\242\246\242\220\b\001q\232:\202|\322\200\t\022 (\036"
+	.ascii	"I\230<\021\221O"
+	.string	"K\246\240\246\246v\034Az\200<\"\244$\b\022\t\024\220\251$H)\251%B\204\220@I\001A\036!\222\304\t\by\004jH\224\324\004OP\035\004\261\220\025OP\0354M\025!\002udHS\022('$MB\244\2244\255\300\300Q\035 \245\232\246\242\242\244\232X\266ew\373X\330GZK\r\\>\223\025\260\266-X\216~\353~\373\030X\306\201\2072\t?\332\315\363\032\324U\377\364V\375\364N\326\2756\360\320~\372v\363\275\246Uh\201\023\225\363\346M~\220u\261r\300\226\036!\tcWzhY\240w\204+\330zEn+\017\215\220MM\2368>\204\274\213\021\362\375\345\353P:E\255\007\002^j\355\002\001\001_cKJ\255b\300\351\271\252l\360\032\274\323\226\273\301*B\b\032\234m\255\241\332I\341\221\301K\3417\311o\215b\225\307)x\200\307\3403x\fw\315.\003|\001\376"
+	.string	"_|f\335\031\340o\374\331-\257\3705\256P\n\360}\266uG\265\303`u\362\233\264\202pU\207"
+	.string	"\217\301\005O\200'\272\255N\326f\226R\312\005\017\244E'\326\245f\267\274\263@\325\331\326\2136\270c"
+	.string	"\337v\326\345"
+	.string	"\376\247mn\260KM\307\332\322\241\021\237X\302r\330\275\005\322C\013\324|\333\251y\237\362\305\231eYp\274\037\344\207\016\243z\205A\214\334\376\336\367(\355et\256U\250\347F\n\017\344]OT\357\251@>L\333\034_\337w\n\025\364\275_\355\251\340a\214u\205\260=tlP\360=\315C\301Km\315\245)\360xX\2639\264.5\256\016R\f\334z#\034\344\271685\344^"
+	.string	"zv\264\004P\364\206\346[\356;\3345\t\321\274k\265\217\020\030g\253\267\230r\t\304\375\004\021\2202\201\2351w\331q\357Y\356^\223\360_\251\030\r\270\017\300w\234\250\364\217\337\020\270."
+	.string	"\357V}\2143\346.\313|\303\275c\265\321N\324\305k\022\376x\241\245\231!\301\373\341\313\221\340c\214\r\221\271sE\306\017\325\234\226\350\036\0068@\274\030\033\212\035\005\350,:\2477\024#\370\216\362Se\032\025\245Z\004\337S\266\314\244\271-\262\366\312`"
+	.ascii	"\340]P\2113'\253$\001\360E\266\276*\037\363\251z\352E&\357\305"
+	.ascii	"C\231C\323"
+	.string	"\nY\213n\373\2437+X,\3705\222\274R\204\340\033,\351\365y\311+\374\322\017\354\222a\306\017\212M\204\340=p\253T2\3136\374\216\360C\201\b\232k\230V\344\361\370\r!\266\246\313\355Cu\277\313H\020\206\005\330l\263\244\007\243\224x\340\373\371\354\016\374\217\177`\355\033x\007\336H\037\326\036\b\330\021QZi\340\233\217\273\207\352\343\031\370\037=\276\310\373\370\237\273O\363u\377*"
+	.string	"\251\264b\245\330\304\036\337\357\237\335\2217\362\f<\333\207\265\247y\306t\301\343\027\370n\373\237\343\3613\376\334$t\201\377\300\276;\276\252\3025\252,-\036\272\343\033,\216_-\\\267\343\031\340\016\252\275\216\347\034\337k\337ZoncI3\035\237#\232t\333\222<\223\303\016\325\355*\217\343\371\306\267\332\267\225\257&O\325\306u~\355\331\222]\312\222ff\305&\342\370~\307\354\324\222n_\222gn\274[5\221\313\2653\346\306-\220\305C\371-\002\314&\023\370M\022\303"
+	.ascii	"WN\232\177\265\355rE\3327Z\tQi\247\275W\265\223\345i\022N\277"
+	.ascii	"\321\336\231\375\003\315\215\303\224\363FH\245\342\241\034d\r"
+	.ascii	"\n\242\357\276\0234\276\247Q\305\016\363\337\366\366%:\007\351"
+	.ascii	"\034|2L2-L\203\244\250\342\310(\323\322\230\203\210dDD$I\222"
+	.ascii	"4\006\302\n\020\210by\036\306\2207\022@T1\311\304\f\321\214h"
+	.ascii	"\222$\303\034\r4\311\223\305\t\200\020VA\272\354|\2612p,\305"
+	.ascii	"\212\227\016\224/\351\n\330\201C\005\n\201\3617\013\264\2158"
+	.ascii	"\312\244;`\211J\001e\334\351D\341)\n\203\212\220[\323\217\227"
+	.ascii	"\177>\001\350\212\n\272\004U\r\3728\020\373\337\361\220\333\210"
+	.ascii	"\261\317\031\242\204\334x\036\013\322\231\265\235\226\3120\262"
+	.ascii	")\"c\313\307\016[\324}I\351\247\207\212/\n\020\3403\020\026\""
+	.ascii	"\304j(\231\260g\265;\272\370^VE\321'\362\234H\247[\252Y~\334"
+	.ascii	"R\214XF?8\327\001\302\017\200\t\003\330\020Q\302\3641\310\275"
+	.ascii	"\030N!\226\204]N\373\344\373O\b\023\357I\241\240\221\\^\023\306"
+	.ascii	"1+\350\331O\b\3524\211K\r\032\226\"P#\322a_5'\217z\220\023\334"
+	.ascii	"\025\001\342\370\342\333\255\302\226C\f\020\003#\177\360B\231"
+	.ascii	"\210=\"$\322.\"\026\302\263\023\240\242S\343\0271\213T\312=Y"
+	.ascii	"\232~\320g<\027\024\334\033s\035\314?\340\257\030\323\344\305"
+	.ascii	"\340\002'kk\305]\317\333C&8h\216\213R\"3\tS'q\224\216\201'\016"
+	.ascii	"F(VE\247\332B\223\251\264\354T\376\212A\022\375_\205\374\305"
+	.ascii	"\373\245BQ\231\313\370~U+0\352!ZH\245\234\365{\376\r(\\w|{t\311"
+	.ascii	"\276\004\217s\322V)\245"
+	.string	"F\031T\rl)\036\025\301\365\205\300\b\325\356\020u\376\241\327\244\204\023V\233\2002\374MB-\231]\300!@Hy\375\370\202\251\361\006E9^\275J\355v\\\374\316XR\200\002\376Fp \031\311<s\303.\035\2210\377\375e\271\275\264\030\241]\021@N62BgfaPBm>\365\237\236,|\025R\3423'\376\001}\007\223\313 \"\256y\235%\357'\304\317\256p`4\274\241\2438\313\224\fy:\036\005h\304u\331\253\322\303\035=\246\257\360\335\250\361\261X;\031Q%\277\322\3132\222ex \\\037u\363\034\205\275J\036\237\334\221PC\257l\313\220)\365O\003Q\363Yjy-\202\366{\316\326|\303\373\301\310^\\\266~9N\334\265\320\271\201!\302/b\307TX\266\234\362H?Y\022\206\204T\026\361\237V\251\036\035W\263\303\2610\031\252\004\330\324\024\245\256\024\220\213\023\331\256\201"
+	.string	"\343.\244\316\233c\243\263\361:\357J\r.\257s\3062\245](9\324\307y\223\353\267#\002\3526\236\006F\323g\t;x-\355\220\367^w\006\232\352\201\177 \311\361\277\3470\237\241\b\261\253\371\203i\224*\016\342\224\223\033 \340Qm\346\375\221\030\021$\316Z\204"
+	.ascii	":\035AC\242y\235c\357\306/\344l\263\274G}\020\335W\034\322f\376"
+	.ascii	"\224\342\002\313\303\220b'^xc\3102\2372\325\332\201\375[\323"
+	.ascii	"K\030A7\367\222\235\225\002\346s\304\303A\030\t\362\214Q\371"
+	.ascii	"\262\345r5\371\256p+%\3001.\225\310\250\324I\306\370\223\245"
+	.ascii	"\036\326\2476\250\263\370\2118\300O\204\341\333\362%\222\235"
+	.ascii	"\033\337\273\004FJ\243<\222C\335\013\005\313bu\005\016\020\243"
+	.ascii	"\351\322F\270y\320j.\030\fF\252\307\242\262\307Z\276\332`V\355"
+	.ascii	"\006;Z\345\352p{\333\242n\336\350y0\275\362j\3044\005!\324\346"
+	.ascii	"/\3663\017\033\227p,\"\254\246x<\232\211 \207\222\265T\017s\346"
+	.ascii	"te\241\373\230\256i\266\217[*R\365\377\331\315\034\021S\257%"
+	.ascii	"\030\242\330\3751!\266[\005\\\026\006/\335Y\203\210e\310Y}\031"
+	.ascii	"\377\204(\330{)\220\004\276\250\027R@n\351t#\213f\031\024\234"
+	.ascii	"{\315\313\314\367\362\356\336\260E\350!\353\200\b\250\030<$\326"
+	.ascii	"\315\002\321\322-\251\001\307F\3023y\250\277\363\201\202\252"
+	.ascii	"\334\372BN\347%\326{\177`Ind8\341{0\231\317\331\325x:xE\2258"
+	.ascii	"\265\236\"\201\204\363\245HT\217\020\316\021\361\013Ts\203?\336"
+	.ascii	"\350\305\201\235\215\353\\}^\212\022J1\374\376\231\307\246e\375"
+	.ascii	"\223\370\257\242\215\253\315\\UG\341\357\251\005W\006B\270\312"
+	.ascii	"\nn,\001\\a\330"
+	.string	"\022\313\003\355\262C\234\0236\0225\275\227\252*H\233@\375\232\311\254\322\2428r\374\257P\016\214p\016\225\3266S\204\233x\340\355\363X\307Aj\f%\224J\277\214\214\227\222\333\223|\376\256t\025^\374\246yq\321\317\256\233\364#i\350\351\350 \327\303\235\317\352\246\351b\372\372\255\232\315\307S\353\320Gnb-G\346s}D\025\017\004\254\3468L\031.{\025\223\240\033Q\234Q\356\264/\2112\377\316\374Si\201\n\256\322\030\007>XS\241\352E\276!*\b\206;22t\211~\037\347h\256&\275H\205\273R\216\212!\214\307\244(P\3319W!5m}+\027\375yU\322\374wm\200=\304\301\021%,\230\254\364\346\327\322]\024fz>0\026WJ\377:PgB\255@\330}\017\004\203Dt\336\212zx\254\033\337\376\031\300\024-K\032\235\001\370\210\332\360\311y\301I\027D\3238\363\201S"
+	.string	"\264\031\200\322\350\004\221\0345\235\220\310yf\300\f\321z\340I\025q4\202<\033\003\n\357Zb\231\007l\226'\301\343\177u\321\001I;7Jci\273B\241\333'\252\373C\210mt\207\fz\265L\307\300!\006\254A\303\013p\272'\307\004J\n\026\354\361\007\022\212\033\245\013p\314bkG\272%\346\030\263&_\223\242\017\262\265\210\374\004\346\005I\240\212\007\263\030\001|/"
+	.ascii	"\326Ov\206\205*\304W\260!3\311F<\2754d\221V\3073\023e\216\026"
+	.ascii	")\265\215\324<\036\201>\342hM\314mI\005 \354\030{\031\244\327"
+	.ascii	"c\350\252\022 )6d\260\314\362\303\320\032\310\361.\271\270\036"
+	.ascii	"1\301\362\3124\211|qI\003\\\361X\311o\002t\370\306Bs6\020\241"
+	.ascii	"<\354\250\352\211\0028\234NG\223\356\\\257\016E5\217\273\023"
+	.ascii	"\013\215\207)\202\246\310\214\f6\254\264D?\257\242n\2512-^\341"
+	.ascii	"#\363L\256\247\356\275\272\207W\323\236\033\030*\372T\2624"
+	.ascii	"\270\026\321\316\"\007\222cB\032\3077K\246\226\365\017\221(\002"
+	.ascii	"z%\277N`\237\020\354\366\263\245\020\360\266zw\256\337\f6\254"
+	.ascii	"x\207\2332\276\004\221\2662\020\3655\204\343hf%\211\257\3109"
+	.ascii	"\002eE\325\311\330\017\321+#\301\032=lE_4+a\316\261\261\246\215"
+	.ascii	"%\356L\336\003\267\362C0\333\227\302\036Kc\352=\243s\357Cy\253"
+	.ascii	"\230\017b\242\233\365\265l\256\341Y\200\362\205*\376\324X\001"
+	.ascii	".\227\264\202\2227\353!p\214\324\234s\016\235J\302\371\222\210"
+	.ascii	"\314\227=\271\254\271\316a$\246\004\234\264"
+	.text
+	.section	.gnu.lto_crashRecoveryModeActive.119.84c5d4fd3cccd4b0,"e",@progbits
+	.string	"(\265/\375 \345U\006"
+	.string	"\302K,2`M\323\001@'\b\334@1\255\033\307\204Vb\252@\304ik\332\313\232\020\3339\330\210\341\177\374\211\026"
+	.string	"6\013d\327\333\027\266r\300\037\277Y)S\n\216\240\006\211zV\004\204$\361\360($\206\211\027U\025\017*\360D9T\317\232\246\352=q\257\231T\003M7\373!\027\201\276\306\026W\236\273\343_"
+	.string	"wR\0054\264\334\3301K\335\260oY\315\330N\247\016\244h\272cLv/\233\225=qJ<l\3376f?FH\300\f\037;.\004\037$\027#*\273\361)\307\341\023\372\007\371\302\206A\341\272\354\031\240\260\273N\256\313\270\365\007\2661\002\b"
+	.ascii	"2\003\316:#h\b\3055\261a\b\022\356\2624\033\336uo"
+	.text
+	.section	.gnu.lto__reset_template_94.8.121.84c5d4fd3cccd4b0,"e",@progbits
+	.string	"(\265/\375`H\001u\013"
+	.string	"\326\320@:\360\204\2515@,\254\300r\f6\322[\340\266lN\326\214\254\245\213\303\342\302y\370\315\334J\255\311\212Y\021.\026\032\013.F\314l\242\343j\353\023xu\303\304\337\254\215\275\223\f1"
+	.string	"3"
+	.string	"0"
+	.ascii	"e\275\264\237\r\002\307\352>\273/F"
+	.string	"\346`\306\206\246b\227X\263,\207\224\2304aC\3720\336\210\3011\300\262\001\341\344\2677\316\262\327.:\245\"EZ\0200\237Y\365\323~&L\016\257&\030\304\251\272\320NEK\007\203I3\340\330+X\340R\252/\331\231\026\bf\257\242\272\221\375\bA\001\b3\355\346\001$\227%\357L\316\235l\242\374K\371Ge\240\225y,\343Z\336ry\031\001\004-\364\320l\242\201#\235t\323N?\ru\324RWm5V\304\001t\332\325\231\347\356\\\273\264m\267\366\355\336\306Y\234\273X\207\361.\343\036\215q\033\3638.;\266y\354\363\261\016\3442\344\236\310\276\221\177\0014 \300\"B\233\007\177\023\357o6Z\215\343\256\272\314(\341Nc\307\273)\304c\240m\207\270\0328S\225$\2500\240\204{\035\306\256\3231\311M\210\373aM\035^\366:\322\275\361\205\220\205\201\305|\356\300\266\220%0\374JW"
+	.ascii	"\313\204q\341\341\033G\234\001\302rM\264\006.\371#\032\356\325"
+	.ascii	"3\216\300\004\023w\017\245\b"
+	.text
+	.section	.gnu.lto_pidInitFilters.part.0.165.84c5d4fd3cccd4b0,"e",@progbits
+	.string	"(\265/\375`\306\020\205I"
+	.string	"jxh\032;0\344J\007\311\321\312;X\350\213X\244\204(\210\322(\246Z\371\257\361HT/\257\261\312\2056,nt\265\363\250_x\252\033BPL0\245{\026\001"
+	.ascii	"\300 \214l\2627I)\245\227\001m\001\232\001q\340\274\361\321\345"
+	.ascii	"y\357}\343\203M{R%\271\003\343x\357%\301\02623\323$\271\323\240"
+	.ascii	"qO{\220\231\202h\035\b\204\275\330\244\027\256M\273i;\020\b\233"
+	.ascii	"\366d\005\335\336*\260\255z%\001\321\232\215\020"
+	.string	"\366R\223\336\347\263\325\364\232\266\331\ba\357\033\326m\372\304\361^iX\253\314\200m\325\311\231\255zK\321\372\217\210\225\364B\237\354\316\334~\035m\373\217H?\335\213\305\316\233{\245b\2552\030\333*K{jm\225\355\250\265U\346\356cf\264's\313\334\330R\274\333l\036\271\261y\274\367\216\265\372wK\253)\366NJ\233\241\324\266\267\264\262\260\256\254\252\250\246\244\242\240\236\234\232\230\226\224\230IKV\271\252\311w\256\226;\255\267\264\232\030\235\207\352\240~\235\325\213O4Xg\372\374j\021\214[\355u\325b\203=\352\325A\367\232J\261\213Oyi)\305\006c\324\253\203z\351(\276D-\016\265\245\237\022\033,Q\257\016\272\245\235\224\0268\334\0316}\341\262:\325=\361V\247'\225$\223\322\302]\340\241:(_/MQ\222B\347\314:h\224NJNm\t\243\327\213\317(\311\003\207\204\206\215\330"
+	.ascii	"\302<\347|\t \013\364I\263J\013\210\275\341n\357P\035\364I+\223"
+	.ascii	"\007\034\341,\232z\373\342d\302\271\371\332\346j\022\\\223N."
+	.ascii	">\2410\341\330\374\231\340\326\222^\367\336\036lO\002g\304\035"
+	.ascii	"\252\271\224\026\356\275\334j\321\346\256fv'3\263`f\212\023\322"
+	.ascii	"{\357\372v\334\202\0225&\227\337{\211\242\256~\322'a\026\262"
+	.ascii	"&\275\025\235\0305\203\276_\375_~\017>Fn\220\235d\377\377L\215"
+	.ascii	"\242\362Y\025MH\371j\242\302F\337~\357M\373\267[\377\037\206"
+	.ascii	"\032=l\356\210\325_\277\335 \325xE3\266`\357e\203\300-\350\307"
+	.ascii	"\013\356.D\326V\325W\305\020\362E\375\377\375O\233b?\0336'\357"
+	.ascii	"U\023\340\337m\211k\036\311\334~\372\017\033rw\341\030\\\350"
+	.ascii	"\355\344\302\265\325\376\036l\261>\323Fsj\036\351o\307\317\325"
+	.ascii	"\311{\357\345\307\302\274t^\300tV\260:\217\261\316\t\224\316"
+	.ascii	"b\b\226\316aL\347\003Jg\003K\347\002\2543\030\353L`\311\371\253"
+	.ascii	"\3714\017\020\260:\007P:\003`\235\275\222\234\273:O3\327\326"
+	.ascii	"\322Y\213\351\234\245t\306Z\235\257\224\234\255\332Ns\025\323"
+	.ascii	"\231\212u\236R:KE\255\316P\254\363S\222\263S\037675\234f\246"
+	.ascii	"\245\363\322\322YI\351\314Lj\300\346%\353\314*\235\225\254\363"
+	.ascii	"\252tV[\332\235l\301\346_\235}un\020R\004\244\334\373\026\t\351"
+	.ascii	"VQ\343\200i\301n\300n8\335\207\335v\272\363t\363i%ss\357Y\344"
+	.ascii	"\363\210G1\217\027\233\323e\273c\314\253\223hGp\232\350h\330"
+	.ascii	"r\270\021\017\321\340\346\360a\340t/E\0276!w|sV\317\205\013u"
+	.ascii	"\371\026\270\013IE\216W\206@\204\337\265q=\305k\342YZ'\024 \264"
+	.ascii	"\312\216\305\355\332'QZ:\272\265U\253\357\304V\363\374\364H\323"
+	.ascii	"\350\262<Qi\2558\260\342g\bm%C=\247\256)C\3200r\312\275u\023"
+	.ascii	"\224=i\036\211\277\275\336\216\243\260Kq(\215N\330\347ZNO\034"
+	.ascii	";\223\336Z\241U\352\344\335*\327\200?\371\336\264\236\302\354"
+	.ascii	"o,\336}\262;\257\033a\336\275\327@\203*F\034\362\212/i\355\250"
+	.ascii	"\376\001=i\246-\247\211\27334t\234r\277\364v<\365\217G\352\247"
+	.ascii	"~\375\343\006\251\364v\206Z\352a\250adsGZ\374\210\324\253b\374"
+	.ascii	"$\357\333qi\275|\271\221\036l\025\332g\350\245p\024\365Iz;nr"
+	.ascii	"\262Q\257nQ\206u\2237\037\256M\357\321\216*A\214[\"\350\246\217"
+	.ascii	"\372v\354\233\266M)\340\335\255\336\312\364O\017\365N\317\334"
+	.ascii	"\212i\311x;9y\347\240"
+	.string	"\276\333\034#\375\266fZ\276\266\257\355[[}\372\227\223\207o\316\351#q!.A\334\217\032R\353\327\376]\360v^\370\343D\244\326\250\006\030\236\213~\3140\001\357\336\033aQ3\322\300\034<xX[u\372FlUJ\237!C*\n*b\261\\\351\227\236\371C\bo'\323{\031\3714N\372%\346+}\2213\221#H@\020t\257Z;\271\0175\"\023'Px;Q\304i\025z\206\221S\256\302\027\347\024\345\333q\213\225\371\335\330\310|\346\032\"_4<\314\202\274H\216\300\261\366\340a\346c\207\020\020Bb\340 \363\261\203\354l\203\f3\035QC:\320\210\321#\007\210\033gd%d(\221\3310\233\221\343L\204\f3\035I\034#\201\f3\035c=h\224\231\331\2301\206\303\354\305\215\261\030g<\306\022Xq\016\035dgc=r\3448\033c\266\005\265_\333\222\340c\277\340\331\001\225)\261"
+	.string	">\376Q\360\013\304^\301\342\330?\223)\337\334\236\262-<Wt=m\\\223\261\254l\275\343x\270P\223P\263P\263\320\332\252\2166\206\036\324\t\344\224\3439~{xZ\003\016\233\206\232m\270\244\231\332\311JPF\354\023\374z\210%\326<\344r\304\276\306\254\271\252B\360\352 \252\260\0360\300j\300#\370~\374\233n\360\002\037\366_\317\334T\324dt\340\303\f\374\2017\006\276\247Z\242`_`\351\006\031\031\331\005V\002\017\366\354nsk\204\004^\215\213\3047\367\365\202\201m\310\3322>m6\352B\274\346#\007lFb\363\365\275\330j\336\237aU3\262MK\023\t%\017\225\224\200W\007E\2055\027\327\024\327\013\370~\214\032Rp\257\017\360]FZ7"
+	.ascii	"\037\340\235\260\315\361\017\3007 c\324\317\353\3258E\215\346"
+	.ascii	"\272\276\357\314^\r\fn&C\017\nB\342e4\220\351\372Vl5/JG*Lt*\327"
+	.ascii	"=\330\255\304\360/\352\355\270)\360i\353\325ANa]\365I\326\272"
+	.ascii	"\352\275\221\367\244\321e\201\252\372\255\357G?:\022\374\352"
+	.ascii	"\265\336jI\373\346\325\366i\234\365ZX\237\365N\b\246\005\326"
+	.ascii	"W`\214\252\271\227\253W\343\032\003\201O\250a0\005\225R\210H"
+	.ascii	"DD$I\222t\201\005\304(\006\335U\007\022@TA\313:\210\020\r\225"
+	.ascii	"\244\250\244Ni8\323\247\202E\362 \313\024\230Ae\270\323~\330"
+	.ascii	"iw\246\002b\200\t\235uT\274\210\270xc9_\344\017\335\031\344q"
+	.ascii	"M\331:[\233Y\200\n\275\036\006P\211\261\272\r=\272\216\322\272"
+	.ascii	"5O)U\244&\220\236\331\332\270\224\230*|g\310\\\341\210=/\334"
+	.ascii	"\275\006?\203\216\250\021P\020\030s<\310\202\036]\033\306[.\032"
+	.ascii	"To>,\333F\325\302oQj\223I\003\210\024\340\305b\307\247\356\344"
+	.ascii	"\245\177a\362,\265C\313\241\032\036\201\3749\211\221\341\261"
+	.ascii	"H\204\205\263\3048\216\355U\016^[\334yG\323\203\270T\276\022"
+	.ascii	"Am\217K\371.\227\323\037S\250\374v\346J\337\250n\210\313C>8]"
+	.ascii	"\013\230\022\316\314X]\326p\265,\245\265q\226\315Q\354~\212\226"
+	.ascii	"Tv&\226Q3\220\2470u\250\3338\037\214\037X\007J\324\202\225\201"
+	.ascii	"_\230\3128\307\001-\371\030%\232D`\230cI$\271\254,\226\220("
+	.string	"\323\020\360\345\344\005v=\375\322\222\034~\360d\364\225\025<]\261LS\336"
+	.string	"a^81E\363\\9\314\f\201\037\265\222L\266^\224\361\244\325\222\325#@\273\231\200g\002\032\251\305\2505m\213q\266\006\004\241\246\277\305\230rj\342\246I\345\261\270``3\255-\263@\370\313z{\177\200\265\366@\374\327\027\245\373e\221\240\203\235\302\251q,\031j(\\\265M\313\031\337\372;;\253\201+mA\020'\217\"\245E3\212P\306\231\303W\354\317\203CD\214\"\264(F!~LDx\306\211B\261\342\336\204\365\021k\037z\022>*\026\330@\231\200\365\033[l\220\212X\024\244&3I\215hJ\302\264^"
+	.ascii	"\265\022\023\321\305C+B\245\344\0139\250tN\036u(\227\224Z\226"
+	.ascii	">\207\022\227\202QD!J\035\250\013\230\205\021\344X J\227C\347"
+	.ascii	"W+u+\327\241! d\262\264\n\0350\210&Y\247-\036\025J\b3\224\017"
+	.ascii	"\261r\371\225\264>\231C\353\r\345\314;|\016\326s\350*\b\260\027"
+	.ascii	"\236.-\002}\241\n\004\377mC9\330\252\301\017\3059x5ql\232\303"
+	.ascii	"6\304\246H\314\036\334D6\003\302\023\227\020\2701\001\302\305"
+	.ascii	"\257\302\373m#i\004\212\2728\036\333\214\331R\2409\210\273L\200"
+	.ascii	"\n\306Y\3739\311\205\300\206\022K i"
+	.text
+	.section	.gnu.lto_pidCopyProfile.part.0.168.84c5d4fd3cccd4b0,"e",@progbits
+	.string	"(\265/\375`\031\002\325\020"
+	.string	"\206\336lH\340\260*\035\353o\260gh0|\312k0\030|.\274\005\200\337=H\021\310\371?\013*\240o\314\001\314\201\326Rk>\323\236O\025\326\260\255Z\022\332\313\270\220\307q\006\250\217#\t!l\306\321%\006\260\225l\"wJ\001Q"
+	.string	"]"
+	.string	"W"
+	.string	"#R\353\265\224\217\3532\263J{Dr\275\226b\335\345P\323\355\216\b>\375\001\372\264_\302vkf\227]\343#m\217S\201\305f\267\273\340\247z\270\353*=\227\177\3339d/*\327"
+	.string	"/\027.E\367"
+	.ascii	"\204\354\256A\030\356y\333$\333'[\212\001\257\371\317\321\361"
+	.ascii	"\241a\327\345\206\215\205\231: \244\307H\2630\313iy\025\002k"
+	.ascii	"\211y9.h\230\330-\205\361\200m\377\3468,\257\264%\366\3520\262"
+	.ascii	"\305X!\261\333\035\301O\217\357\370>A'\360\371\270\002\264\333"
+	.ascii	"\374\306\372\t\017\210\345D\354.K\372\266\226\035\n\325\214\243"
+	.ascii	"\217\002\225\247q\266\352,V|z\234\247So\273\201X\0166\003"
+	.string	"\305\317\355:+/G\223M\270\n\023\217\207\266\273\tR\\\207\362?|:\202(/\023\277O\325\337\316 \304\206\335\314\316M\206\253\324\367\274\330a\371y\311\033Re\254\336\275\325\030{J\177*=O\363{SZUZ\006&)\245D\221\204\223\351d\301\251$\034A\245DL\241\210J4\211\\\0021\205(\240\212\344AX2\002\236\204\016L\300RJ\004A<\214B9\245@\025\n\225\002C\266\345\275\325\0307\030!\343\2450U\031\333\002\244u7\214O\365S;\204 /\363m\007\361\314\300\370\364\254\250\212\217{\013\\- \200\202\0316v\202\032\006\3536\037\262F\354\3366R\336\340\311\342\202Lt\177j\301\263\357\264\333\320<k\253\315\f\214\354'Q\030f\013\307\313\201\326\016\234X/\0042\035\3342d\031B\232Nf\221\371nlHb\202'\251\006\264\243e%q\234\023S\013\320\034\210\221\262g"
+	.ascii	"l/@N\377\364k\315\030"
+	.text
+	.section	.gnu.lto_.symbol_nodes.84c5d4fd3cccd4b0,"e",@progbits
+	.string	"(\265/\375``\007\265\034"
+	.string	"F\256\247D`^N:?pY\314nz\342\034sNL\262+l\366\016\326\0256<S\013;\252\371CI\017i\3226%\222n\237\361\306\330\035\230\201\2318\314T\236\223LJ\343\303\1772ne8\226\223Z\265\310\337D\246\215"
+	.string	"\231"
+	.string	"\221"
+	.ascii	"\267\rD\237\313\371\341Y<4\257\235A\336B;\274\f\207\303mh6\262"
+	.ascii	"\206+\321\f|1\364\233|\341d,\364\377\360\213\025\214(|\f:\341"
+	.ascii	"x\327\355\376\007\232\022\372\200\270\351b\"0]U]!4+yp5\016\236"
+	.ascii	"&\3454&\026[\3420%\006\003\n\271\b\232\324\327s\"\365\363\234"
+	.ascii	"G_c\364%\332\340u(\203\263\021\272\252z\243\004-\350\3439\355"
+	.ascii	"\317\353\005\336\017\372\377T\335\332\376\376\275\034\231\357"
+	.ascii	"\275WA\377\355\374\357s\nSC.\036\013\337kA\177\255,\342\260\212"
+	.ascii	"j*\353\211\n+\301y\335\352oAy<\314\216>\237S\307R\016%\034\f"
+	.ascii	"D\213\317n\260\031j#\251\006\037i0\031\021i\310C\262\322\031"
+	.ascii	"\374\205\276\331l\346a\365\367\2342\372wb\334\r\006s\241/\372"
+	.ascii	"v\347\325\353X\235N\325\347\270x\034\252\313iq8S\177#u7Qo\303"
+	.ascii	"\342L\250\313\255\370\334\323\351T<.\305\321\240N?\203\242o\347"
+	.ascii	"\274\366D\337\314i\257\211\243\022}0$\356\005\035\321\377\"B"
+	.ascii	"xC\364\273\234\001\317\243{\273\373\334\317\016@\032X\323\374"
+	.ascii	"lT\222\357V4\242v5?{\265\362\311H\201\262v\272\237\265Z\236>"
+	.ascii	"+`e^\373c\007\346h|q>+\204,\323\263\274\232\351\331\340\231\236"
+	.ascii	"m\n\036\356\264\274\262\275\367\026\257\274Ek\356\002\322\354"
+	.ascii	"\365\243\271\307Y\263\017\263\346\261\262\346\037>\232\327c\263"
+	.ascii	"\332\243\271H\326\317\033\353\007\022k&\022\326l\004\254\031"
+	.ascii	"\355\2539\210W\263\220\256\3462"
+	.string	"\276\314\325\357\303[\347J\300\370*\352\257\240?\024\021J\212\030g6e\223;>\231\304a\261K\2038\211\222\017\207l+K\203\030\217\334\231\0247+\237F'jTVf!\3067~\222\344/\217L\231{]j\331\t\222\017\210JQ\355p\251\345%\352\327\244v\230d\242@xM\242\230\254\004\345\n\332\231\251-\260\344\367\271\303\305\346K\355Pr\231\332!\225\213\322\344\314z\251mb\223\332\340\333\244VH\345\343\035\233L \223\355Y)\022\332^\022$?\241e+|\206\271\253;\362C`\203J\"\313J\240\005\220\344\224\r,\355r?\033\200\311\001\200\211\2501\020\006\025q\224\024$\005\2254\006\320\002)1n\016\021` \2135\"\022\210H I\244\260\007-']\032h\226.\227\270\222\n\311(^\177\005\323\342<\006A\306\264\263r\"\311\247\322{\374\320\223\352\034\373\356\241\207\243\333P\026U\356"
+	.string	"?s\3746\305_S\344=\307^s\021\360\232\013a\242^\341\356\220y~:{\200\275\274Xg\322o\270\360\263\337\330Y\240\241B\374\207\035\360\006:\231\253\003\270no\345\313`\366TD\340\035iS5\275\353\305`\002\271\004^\200J\276j\034x\b-\273#\017`\371\204\214D\0024\274!\365\241\005#\020d\341~\202P\001\234\021Eo\017\2426zs\0321\327\305\026\205I\320)\334\343\366\272\301\034\006Z4\220\fD<\252\254\020|\262:\345"
+	.ascii	"\344e2E\200\375\222\032i\240n\251\364\004\031\216\024\324\004"
+	.ascii	"\276\n"
+	.text
+	.section	.gnu.lto_.refs.84c5d4fd3cccd4b0,"e",@progbits
+	.string	"(\265/\375`\256\002\315\023"
+	.string	"\2462\213>\360\266\262\214\001\214\235\2157\234]j\255\207_\2348w\272\231\241\241\315\261\306p\"\366\216f\340\031x\006^v\211\023M\246\310\320\264t\371\216\235icd\220@\rB\332'\244\217\b\3312\005{"
+	.string	"~"
+	.string	"t"
+	.string	"\006\256E\254\035\252Y\202\315\n\265\256A3\327 \3266P\315c\263\fZ\327\235\002\327\035\326\352\254\256:\254M\260\272&`\255\315\352j#\26345\023\240\331\031\002\327\230\231k\214\314Nu@\316@b\336C\300\225^\236\224\3323P\033\245\366Bj\207R\013\224\332\036\32490\267`\246y\231@jU\250[\\\006\030\020\3474\202\323\254\226aXN\235v1\275Z\236v\335&\026\001J(l$\023\266\221\241=D\302\376!\024\264wD\3305\200\326\bh3"
+	.ascii	"-\221j\n-+\304\262>\246\3559-O\314\346\b\330\003?\333\372\331"
+	.ascii	"\025\204\215\361Y\324\203e\351\231\203V\226\325\225\345fO\253"
+	.ascii	"\353\211\265\246\325\325T\263\001\200\027\317\030\354v\266`\247"
+	.ascii	"\263\234\335.\005{\302\271^8W\202k =T_Bp\275t`\363("
+	.string	"p\315Ciu\255t\263\217j6\262\331\f\255kQ\253P\211\264\247H\221p(L\224$\031\372\021\242\027\t\272\220At\366\322\2165\216d\341GB\027M\032C\244-\020]!\265C\250\177^\366Ic\027\244q\016\320\006 \334z\231\265s\215\352\231\b\253\036\355\200\324\302\244\026\205\332\345\2145=j\364\307\227\325\365\345fS\253k\212\265\250\325\025%\263\001T\313R\263W\321#\212\001u\224\013\333\211\205\315\244\302\016/]}\\E\027\007\323+\217\013\347\332`\272H5\354\240<q\322d\t\317S\222\004\311\221;vE\210\264\361\206\324\261\003\342\363~\364XR\322qC\350%\215\306\214I\273\243\311\250\360bLx0(\274\027s1\307k\021\307\216\305\033\273\025q<\025o\274\024(~\336\t\233g\202\365J\320<\0222o\204\316N\304\203\027\342\302\003\241\363>\314\303\201\327\341\346W\332\330Vz\016\036"
+	.ascii	"P\211l\275S\232\261\254i\020\210\200\2704g\310\236\005\253\232"
+	.ascii	"\020%\007\216\001\023J\255D\215a\242m>l\027\234f\237Q\266\234"
+	.ascii	"\271D\212l\227+\251\372P\226iY tw\256}W@\222\355\t\317\254\016"
+	.ascii	"\366\212\273\0264"
+	.text
+	.section	.gnu.lto_.decls.84c5d4fd3cccd4b0,"e",@progbits
+	.ascii	"(\265/\375`AXe~\001\252\212\366\214U \fQ9\351\324t\232X\005\327"
+	.ascii	"\n\024\036G\267\236\277\343\2730e\320\037\366\027\377\370\n\347"
+	.ascii	"U\343:\376A\214\355\273\303\243\264\206\332\325\225\35046\206"
+	.ascii	"\365\353\"7\313\340n\244\022k\243A\273]t\256\347=s\017nv\340"
+	.ascii	"3\301a\2160\257F,!{\313\235\002\213\007\304\b\372\bQ\314\\\004"
+	.ascii	"=3\267\006,/\347\\\304\203\006+\206\220\036\274\241\257\374\242"
+	.ascii	"\230@=I\033U\350\032\377\004\223\376\204Km\226%B/\330!\364'Z"
+	.ascii	"\372\223\231\376L\222\376\364J\177\006I\377Nk4\313\314ZB\247"
+	.ascii	"\247\274\321\242\354\212;\030z\215[\312\207\367\224\237\253%"
+	.ascii	"Q\324\032\013\331!\364\357(\032\244QokdgPR(\225K\2637\224\f?"
+	.ascii	"3\242\214\345h\334->\274\315\"@\344\007\2232f\317\351!eL\223"
+	.ascii	"7\363\211\315\312\371,\347\234\201g\306\334\031\034\215\233\254"
+	.ascii	"\235\330\245Q/3\220\305\343\202\272j\374\023+UA\316\326\b\265"
+	.ascii	"{{\326\b\005\361\341\335\004\035\303\342#\016\023#\237\022+="
+	.ascii	"\202,\351\261\337\033\216=&\215\2250O\020F\355K\343\237W\351"
+	.ascii	"m\0279C\300\302\314\3412\322[\315\243\213\264W\003\351\034\355"
+	.ascii	"\243\263Z\331:\272G\207\365\217&\322`\255Bk5\216>\322;\372\253"
+	.ascii	"\205t\222F\322C:HsuWc\331e\2135\215w\215\266q\fg\005#`l\226\200"
+	.ascii	"\325\331=i\3265\311\300\332\3308D\302\210ikV\351\033r]~\333\346"
+	.ascii	"%\256Y\267\306I\347~\332QF\247\007X\233=\036m\364\272\332\324"
+	.ascii	"\301\002+\033S%\314o\353\356\226M5+\\\360\334\214\331\2662T\300"
+	.ascii	"\252\230Y#\373m\235\032\264\246XG\365\214\313\004\023\001*G\223"
+	.ascii	"\254\305l\026+w\313\254\322*P[\324\362\212\240Ic\341~\222A9\n"
+	.ascii	"*\r\314\355\267md\330\252\374\266\215\230}c\351.\023\3147e\313"
+	.ascii	"\253\2313\363V\255\305\354\031\013w\231n)\013(j\315\234\231\034"
+	.ascii	"8\024q\330Y\243Q\303\312\004\360O\251\364\314\226\b\275\233\035"
+	.ascii	"B\217\343\244\177K%\033\252e\224`\253\r\224\225\306WE?&g\336"
+	.ascii	"\2264>\306K\337\001\013\030\177\307h\253\206a\227]\325T\357\026"
+	.ascii	"\355\342\226y\353\366\302\322\375<\005e(11\300rf~\001\377\207"
+	.ascii	"\037D\007]\325S\226\316\227\3472\213)[/\256\016\2642M\362rfr"
+	.ascii	"(\342\300\341W\006\b\035^\212\217\327\322\"K\204\336\263\364"
+	.ascii	"\330,=f\246\275\342\303[\212'\212\206\232W\343\037Yj\233\226"
+	.ascii	"\b\005@X\032d\207\320\343\037\351q\215\3648\231\3766\323\337"
+	.ascii	"\270\364\227J\372\353$\375\035\222\376*\323\233\261D\350\357"
+	.ascii	"T\372v\223f`\207\320\347Y\"\364-\227\276\317\322\367W\372\336"
+	.ascii	"\221\276\247\322[8\351m]z7K\204\336fIo\243\244\033\330!\364\266"
+	.ascii	"Hz\353#\275\255\221\336\346t\003K\204\332/\026\214]b"
+	.string	"`\347\016\242\203\337'\263L\2263\023\310\247\316\222:r\032_Ez\213\001j\367,\006\350\205i\bK\204Z.<`\250\210\211\321\370\033H\255\026\033g\227v\313\363Y\316L\237\233\264\341\245\255\361\355\006\024hooo\317n@_\201\324^\261ov\251\201\305r\033\305\272\375L233g&P\023\241\223\006\245\361\035\220\336j\200\336\275=\253\001z\004\244A\226\b=\323\016\241oZ\"\364\267lT|\270\366\230fT~;\305\242\331\265\237\333\031\031H\244\244Y\265\267uV\316Q9\347\f\r\206\rV^\343\317Y\"\264\307\016\241\235e\211\320\002\330!\324F\371p+e\b\265R23Z\316\031\350\272e\221\232\323\270\355\031\006@L\0330~@\371m\023Kf\315\356\324\213\254\214\2263Sh\007G\215\025l\215\333\354\223[\246-;6\313*\003\3139\007\365\240q\303\206\3268\003K\204b;\204\236"
+	.string	"\351\255\223\377\230\345\016\336\351\231\226\bM\355\020\372_ v\310\337*\260n\230\325\347\307g~\273\326&\270,\276\374\335\201\277E\360\267\007\256\227\377>u\371;\004\377E\201\234]\376\375\201\277?\370\233\004\227\313\335\362C\203\333\364[\263\270\337\256\330\3607\002\256\226\3772e\271p@.\226\337>\271o\367\312\177,\375\021~|\3766\001V\203\002\254\221\r\200\265\300n`9\374\326\203"
+	.string	"@\374\366\202\337\036\375\366"
+	.string	"\034\374v\303o\r\360[\r~\213\200\337b`\301\002\t\031\340\277L=\367\333\025\234e\177\273\350\342\002c\345\267\032\376\353v5\020\264N6\005\253\377^\365\325\3727\023\333\025R\365C\005<~\273\343\357*\267\312\245\361\333\025l\177\027\311j4*\313\346R\271\232M\301\2132\277\325\272k\177\323\300\023X^\265\033i\377\343\376/\255@\2035-g\377E\373/\224k\366\277\254D\210\247\340?\221\\n\331}\362\333\244\3772\177k\202\337\236\370\255\t\2775\361[\016\374\026\004\277\025\341\267s.\212\345\177,\327I\336\347\272\016\005<\030\332\242\337\376"
+	.string	"A\321\177\r\227\254\004\273t\342\034\374\227\314\177K$\371o\007\220\334\022\374\247\"\266f\353n\033\230[\302\221\377%\334\354?\377U\362\367\361\252\360\333\025|\356\276\037\327\375\r\243\261\375\321G,\213\266\033\366\277\004\r.\330oC<"
+	.string	"\377\t\264\t\260\003\260\031\330\f6"
+	.string	"\266\303o\341n\221\337*\300\026\340o\036\227\310o\215l\007\277\005\300\337Jk\301o\201\b\340\377\\\327\371\355\207\337\202\261\004\260\033X\037\013T\325s\207\374\026\203\377v\375"
+	.ascii	"?\361\262\337\2068\005\376\363\202\337\242]\256\277M`\233~\313"
+	.ascii	"v\205\374v\305\r\362_\203\337\206x\320\177g\374]\367w\230\237"
+	.ascii	"V\354\223\345\372\371\237C/\341\367?\317\377j6\005\307?\216\223"
+	.ascii	"\344 \260]\337\371\357\327\177\201\204\350\361\364\277C'\254"
+	.ascii	"\240\313\243\001\277\275\372-\215\337\316\370m\215\377\"\340"
+	.ascii	"\377\371\243&\374\227\350\277E\377\315\360\337\013\377\265\360"
+	.ascii	"_\f\377\265\340\357#\377\345\340\277;\376\336\373\257\320\177"
+	.ascii	"\201\376\313\341\277:\376\003\375\250\372\337\034\377U\376\267"
+	.ascii	"\306\177\257\376\373\342\277-\376;\365\337\344\177S\360\337\024"
+	.ascii	"\377%\376w\370\337\244\377\006\377\353\201\377\232\370\257\006"
+	.ascii	"\376\233\201\377\206\370/\003\376\313\301\177A\374\227\303\177"
+	.ascii	"1\370\357\005\177\233\371{\356o/\177\313\375\275\345o-\177c\371"
+	.ascii	"\333\312\337m\177\257\375\215\366\267\224\277\227\177\223\375"
+	.ascii	"\275\344o\344\337G\376\016\373\373\353o#\177\027\371\273\353"
+	.ascii	"o\256\277\203\374\375\343o\255\277\263\376\306\372;\307\337\312"
+	.ascii	"\277m\374M\343\357\031\177_\375]\3657\214\337\246\375\355\342"
+	.ascii	"o\252\277W\374\235\374[\005\177\247\340\267b\177;\375\275\376"
+	.ascii	"\315\364\267\t\376\036\376\035\374\033\370\367\003\376\006\361"
+	.ascii	"\367\006\177\037\375\235\200\2779\374\035\3647\3727\376\273\377"
+	.ascii	"\376o\353\374v\316o\365~\233\367[8\277u\363[\274\337\326\375"
+	.ascii	"V\314o\351~\013\346\267^~+\367[-\277\365\361[\270\337Z\371m\333"
+	.ascii	"oW\360_\355\377\322o\235~\313\366\333\006\374v\002\277\255\300"
+	.ascii	"oW\374\266\304o\327~k\366\277\204\337>\371m\222\337v\375\327"
+	.ascii	"\360[\256\377s\377\017\360\377\304o\201\374\366\307o\267~\253"
+	.ascii	"\365\333\254\337\332\370m\213\377&~\373\364\333\024\374\026\005"
+	.ascii	"\277M\341\267(\3746\305o\227~\033\202\337^\340\267\"~\013\302"
+	.string	"o=\370\255\003~\033\342?\225\377$\374\207\362\337\354\277\362\277\334\177\f{{{{?\317\006?\220\222\177\002\030\b?\277\234\265\320\200\221\241\035\316\316\241\211P!\315\0245\315,\370\rc\301p\330\212]\342+x\355\230\nf\303W\260\332\341~\214\\\365\\A\242&\325\203\177\334v\354\366\343(X\312\333\372g,\307\224[c\\\345\303q[\317\333[r\253\361W\260Ch"
+	.string	"\232v\b\275\320\214\364B,\322\007\311I\037\364&}P\232\024"
+	.ascii	"W.}\220Z\212\315\356\223\276[\212p\325i\374 f\372\240#\351\203"
+	.ascii	"z\244\023\310\226\b\365\315\331!\364ATbb\230\211\0266?u\316\310"
+	.ascii	"\345%\307L\242\314\001\242\2461F\202\307zf\370\310k\303cXI\230"
+	.ascii	"\221\0307\226o\232\334A%\271K\332.\306\2329\215\201\364TP\301"
+	.ascii	"\313\023\020\0320\260~\363\026v\326h\"\205\246\361\201\270xy"
+	.ascii	"])\034\305\314W\350\032\037q\035N4#s\330\032\037\b-\375q\221"
+	.ascii	"\333%.\322z;V\277)Q\3004\201\224\244?\226q\325p\r\334\345\001"
+	.ascii	"\325T\3163\"\360\306\312\227^^\266\262\352\200\273~<\003\323"
+	.ascii	"\300C\032\350nL\034\216\306/R\266\256-%\215o\311\376\017:\272"
+	.ascii	"4;+u\270\221\335Xz\371\220\243"
+	.string	"\013X\316\031\353\213\227&\217$]\232j6\336f\347\320,X\026/M\034M\3342\376\201\265p\020,\004\373\300@0\027\356\201\267\354\022g\341\026\3078\013\357\360\245)\313<J\267)3\027\360\201\304\322\003\205\245\007\362J\017D$=\020Wz  \351\201\264\322\003\365H\017\264#=P\213\0243-\021z4;\204\376\007\016\236\372\024\266\262f\271J\003\334\325\021\275\274\234\225\033z\352\232vu\270\352\330\252g*\371\306IcL\205cl\245\235\261\321\370\30710\f+?\270\222\215_\314\321\201W\327\370?u)v\201[\210i1\231k\374\237\270\364GJ\372c),u\253\334\251\234\334*\200\034\335\227^\336\217W\372\343(\034\025\"\354\352\207\bN^5\234\274iJ\233\235D\221\363S#\375q\306y\211\333\017U\235:o\273@^Q\346\200\031t_zy>{\351\177\347,\357\234F\363\200+\313"
+	.string	"Ok\222\304\345\254\354\320\363$EGG\343\373\214I\377\253g\227W\317\302y\300\225\225L\026"
+	.ascii	"\311\325\2352/\347\270\016\215\204\311Y\221\306\367\021K\377"
+	.ascii	"\233\267\274y\r\005\237Q\371\207\021\260\234\225\035v\226O\264"
+	.ascii	"\2605\276\217\027\0348\226\316\003e\326%C\207&n,\347\270\016"
+	.ascii	"=q\312\342\234i|\237\026n\3344\323\003\256\254\244\214\f\236"
+	.ascii	"\204\325q\311\313Y\331\001%\303\266\367&\315\2313\027\217\255"
+	.ascii	"G\223\315/^[g\001R\305E\343\333<\234\232\217-Q\215\357\232\237"
+	.ascii	"\244\0247\267\3067\315\275sR\203\314\324\335\257\335]\263\243"
+	.ascii	"\312\221\306\350wdE\222e\343\253\246\277 \231\321E\252\361E\203"
+	.ascii	"\303\2405\2414\356\tC\206\314\255\353\234s\006\363M1R\325,\363"
+	.ascii	"[wg\301LUIk\3747\257\362\377\227\206e\241J\322\370=U\304\210"
+	.ascii	"y\033\016\312.\240z4\241\243{\333\1779\307\305q\013\222\376\027"
+	.ascii	"\214]^0o\263V\030f\244a5\263U\356\360\036\032)\210\016\354\362"
+	.ascii	"z\261t\033\370\324\250\270\232\331\212\331\341<u\266l\271r6\347"
+	.ascii	"\234\225\371\211\215\003\216\260\261\332p\345\332v\324\350m\341"
+	.ascii	"\322\370o,\224\377?\324\215\225\261/\215\317CF\213\226+\226\346"
+	.ascii	"\267\fzp\265\245\367\355b\261\313\303]\270!Z\236\2064>\317\224"
+	.ascii	"TE\3169\333\303\241\276\303\241V|\326\274@yk|\236&i\333\317\217"
+	.ascii	"\027wm\215\317#\226^\266)0\312\324i|\236\255\364\277gjw\355>"
+	.ascii	"\261Y\312\352\027\203j\252\231\255\254:\234'J\224\233\006&l\347"
+	.ascii	"\013mL\223\3067\355g\344M^\327\024\236/9d\230\231\"\3454S#\206"
+	.ascii	"\027s\204\235\023-\215\317\303\"\375N^Zv\315.\23348\266\032\177"
+	.ascii	"\207L\031\363\311\027\026%^\343e\221\tu\313\033\215\277\263%"
+	.ascii	"\275-c\222\006v\233\334\261\247#zyN.\231]\336&w\tfr\340P\364"
+	.ascii	"[\342cL\n\305\337i\222~\347+\375\316\220\364v\211\275E~\221\334"
+	.ascii	"$=f\263\f+\r\210Y6\263\025\215\016\337\261\221\376\032\271^\277"
+	.ascii	"_\377\272b\351S\316O\314\\U\244\244\354K//+\225\033\260\213\026"
+	.ascii	"b_\215\257\330\235\257\254\352\205\230\306\177sU\370\377\333"
+	.ascii	"\301\243#SwU\270a3\316D\201Sr\016\2213\203\312\005k\032\227\213"
+	.ascii	"\221\2706\215\377\263K\377\333\367\217\346\244U\316Y\306\311"
+	.ascii	"\314VP=\350ooOk7\374>\366\332\001\374\3079w@\221s\322K3\347l"
+	.ascii	"\335\244G\332\222:\032\377\317 \237s9Gi=y\240u\025\245uc\352"
+	.ascii	"L\353Jh\352L+?Ey=\tYe\255\247\251\263\234\205\242\242\236Dd]"
+	.ascii	"M\235%\263\320\324Y\276\312+\302\\\331\314\324z\312QYY(G\345"
+	.ascii	"d>\313\272\312`*J\353j\352,y%4u\246u\225\317\264rP\216JZQEe+"
+	.ascii	"\241|\246\305&\237e]\005M\235e]M\235i\021\261;\250\274\270\310"
+	.ascii	"\350\322\004\262\304>ME\345\0300v$\255\202\346\246\230Y\331L"
+	.ascii	"\316\026M*[\345\271\234\007\220\363\216,+3\311\033\326\rj.\006"
+	.ascii	"\024\225d\226e\346\234\215`@me\345\250\271'\233\347\246\304\262"
+	.ascii	"r\026\203R\3120r\316\231\203'\346\\\036b\347\236~\354\310/\244"
+	.ascii	"r\266 3s\206\221\363\223\315s9\347\247\234\263\317j\0073\347"
+	.ascii	"\034AS`0`\344\254,\202\221w<Y\221\312\271\321\320\270]M\235m"
+	.ascii	"e}\260\"\345\f,\263`>\331\251\027Y\031,\233\321\262J\317\236"
+	.ascii	"\312\362\213\234\263m\223\202]\315\300k\374\337\221\364\277D"
+	.ascii	"n\027\0336M\032+)B\313\324x9i|\271\232\315\006\231\261\306\377"
+	.ascii	"\351\270B\230<nXi4\0323\311\252\252\210d\375\260[N(\\\230$\357"
+	.ascii	"\326\325\262X\326p\251s\265\336\326\277(zp;|\364P\003kS\2451"
+	.ascii	"\230\253\343'\031\224\263\327\232\254"
+	.string	"\213e\227\267G\324\355\321^.\017;\307\205\231\234i\346\2349\030q\300jy[\\\320\313\343\375\304\372d`)\273\322\370\326\315\016,\307\335qq\330\345\325\361\253\274\003\273:v\214\224u\321\340p\\\002\221\223\342\247u\322\377\336\2703\240\262\230\310i\374\005T\245\371pg\\\030v\035\304Pse\334\032\227\306\265a\227w\306\265\372\275\262a\336ew\306}a\351\354\2342?\261\341\300\311\\\031\274<\016E\034\3165\0359\306\016F\355\020\372\024/}:\227>\215\222>\375\221>\315\351\177]\\*\2714i\302\032_\252\013e\327\354\034\032N\002\246y[\334)\273\274T\227\305\245\272QW\352'\212\231\257|ks{9\356\024\035\2240\024\337\367%\275+~e\332\360@k|\037\\z\237\224\364>'\351\177\22377\311\262\205\326\370\346\356\275\373\364\233\273\316At\360\236\250\233q\316Ik\005\360c\255"
+	.ascii	"N8#I((\276OI\3727\2355\337\022\006\216\2519\033\342\224\201\032"
+	.ascii	"\223\243\007\224\365\364cL\357\357\334qn\327\223\2253\025)2'"
+	.ascii	"]\215m\356\274\333=\225)\331\262\002\234\0263\242\2164\276]6"
+	.ascii	"\2347<H\332\264q"
+	.ascii	"s\363~\363"
+	.string	"\203\350\340m=9\223\345\2345\370\220}\2311\325\270\357\272\315\377\037P2\r\235\032m\360\340\234)\2314f\303\243\204\354\n\215\306\367y\245\377\355\262\233\275\206\231\213zX\f\311\222\244\361}@\322\277y\333\377\237ERe\211\232\235\0322Pu\215\3230\317r\316F7N\213\221\027\215\357\273J\317\264\031\273l4\375\005L\327\3319.\021zu\232h\332K3\177\316\234\265\350\200\345\234\2158p\330\301\353\312\201\3422E>B\262\220\364h|4Nz\353\026\246\237\374\2349g\305\371\233L\213\261\313\036\323t\315\034\323s\375\344'\311\314V\276\257\f\247K^\316\231C\021\207\033\347\314K\023\305G\335\322\243d\351Q%\351Q\260\364\350\216\364\250\262\213\234\033\032s\205\306\\x\272\236\300)\322\370\250\213\364\177\307\265\226\206k,\235\305.{KWy\267\265\33313\347\250\316V\372\315\316\241\211 S\213["
+	.ascii	"\033\033\331\332\333~~9\307\265\201\345\234?li*o\373\tUs\364"
+	.ascii	"\274\362\362\32096\210\tEf\tf\351\202\f\341\222st\016O\024\224"
+	.ascii	"&e\032\243zx\214\314\026]]c4\216\245\303\301\244j6\316j6Q8Ei"
+	.ascii	"v\022\005\253\231\263r\303\235\222f\271\002\372\346(\034\036"
+	.ascii	"Xgj\032\243np\214\377?\bD\311\221i\214\266y\233\317\034\323\006"
+	.ascii	"\214\306(\336\225*\002di\2431\312\306\327Cm\316\033(ga\232\314"
+	.ascii	"5>\006Ui\322\240w\326,W\231\340\343\210\336\230\357\315\221\030"
+	.ascii	"I\273\243wW\207\215;\031\215Q5%\210\023\243e\341\360\223#\312"
+	.ascii	" \215\257a\357\314\231\267\037\335\362\256K\343kX#\346b\320:"
+	.ascii	"k\226\253x\210\314\255\001\313\203\222\312\202\326\241et\310"
+	.ascii	"\341\372R\206\f\223\271\244\022.;,\240t\275\241c\272\n\2211e"
+	.ascii	"\274\260p\341\202\322Y\263\\U\244\204M\027\215\274f\313\361\344"
+	.ascii	"N\356(\335\321\271\037pR`\032\037\375\202\202\371\177=sn\234"
+	.ascii	"\2115\276\006\266\024\355\202z\371\377\373\341y\351\270\322\370"
+	.ascii	"\255a\212\006\276\026K\324\370h\374\203\311)\342\325t~\310\334"
+	.ascii	"`sk|\r*\300\301\241q6\210\t%\306\016\354\313G\f<T\313\321\270"
+	.ascii	"6\354\303\f\016!\215\321,o\253Rf\206\210\006 V\254\240o\022\020"
+	.ascii	"\023Fl,g\345\006\0366\272\255\345\225\243oo\233\202\206\356\355"
+	.ascii	"\202:(\033\312\206\266Y2b\236`a@\t\030%Z\345h\233\232\223\275"
+	.ascii	"\270\013\260\240L\216.\177\273D\231\240kWLO~2\313U\276\265&M"
+	.ascii	"\364\362\362\224r\303\217\2135Z@\242\034];\252\006\242\203\333"
+	.ascii	"\021\203H\221\322\030M\273\035\322F\312T\343\243SP\264\377\367"
+	.ascii	"\013SC\245N\343_\200$E\245(\200\207\236\2179\350Y\303\270\202"
+	.ascii	"\204Gc\024\312\327\374\377\371P)\343\332\321\370oP\263\377\277"
+	.ascii	"\373eK\fTc\364\t\312\264\313\313\241eg\002\375\\a\221&\327\370"
+	.ascii	"\027x\245\267\227CW`/\207\242dG\235\374\277\337\025, Z\215\177"
+	.ascii	"A\220\364G\233\374?\237Z\031\035`\215\177\201\217\364\027\344"
+	.ascii	"H\177t\f\035\273R\036\240\345\344\325\006-PJ\204\214\314)i|\013"
+	.ascii	"\316\244?\232\004Mr3~b\346\252\013Vr\031\274\017nVS\215o\001"
+	.ascii	"\\\372\243b\250\330\275\202\223O|\326\262p\321h|\013\244\240"
+	.ascii	"E\216\252\200\026\361\312 ,\214g\314\n-\250\306(\030\032\206"
+	.ascii	"~\241^\250\021\013\216\240=\216\016A{\240]\033\224YF\002\216"
+	.ascii	"\320\375\242\254}\321\322\270\007HT\2276\215\321 (\327\357\355"
+	.ascii	"\205\230\035\215\217\n\341\nc\004I\343F\201\370\310\254\242\322"
+	.ascii	"\032\037\375q\351ty\243j|t\353\377o\005i|,i\214j\245R\026\374"
+	.ascii	"\320\340\207\306"
+	.string	"\314\216H\343\037\315:\252\365\243>l\225\263\371B\207rM\343\037;\204\236j>\034\315\352/49\271\306\267\240E\372\243<P\0368\216\007\\A9oq\351a\"\247\212H\343\033\271A\363S\3169\347\244c\227'\032T\307\007\250\234\034\213\200\022\037;-\2309\312\032\347\360\271\300\261\206\326\370Fu)\215\263\016\232\315t~:\3674@M]\200\fL3\n\225\262s\\\036$\351\322\234B\255\354\2342(GUQ\323\244\201&\317\275\237'\241\234\177|\001\263\201\342@\225h\rt\006z\303.Q\032(\213\237sN:/Bi\240P\026\316\316qy@\346\245\2313\263\314\233\257\271\037|\326\271\235\006\250\251\013,\321X\241Th\225\235S2\263\f\036\266#^Y\362\320+T\206]\242V/2\362\221s&o\211\342\037\255Bc\364\270\265\320\301\2421\n\343L\316\305\217\3067\232\222\376\250\013\273D_"
+	.string	"\261P\201\216Wc\264\305\355\250\236Z\270\200\253a\245\211\227\3067:Ko\264Lo\024\206\256H\3114y|i|#\"\351\215\204\2447\322Jo\224#\275Q\215\364G\363\271w\236qq\363e\317\322\211\361\362\002\252\361\215\256\322fZ\"t\203\035B\317\025\3168\247\336\377\003b\342\026d\255\361\215\250\322\237y\377\177%t\201Yk\214\355\341\320\363\315O8\377\257\345\276\300`4\276QT\372\263\315\351\346\377\375\230\361J+k\374\2429\351O\274\265=78\032\237lR\251\242;\rvxT\351\241#\315O6\377\251\306\3029\233)\354\321Y\241\361yw\256\371\331<\355\362\331\344 +\347\344\331\004\232\223s\022\310Z\001X+"
+	.string	"\314d\353K\r\305/:\223\372\330!\324\246}\370\231\346K\226\346\223\306/\302r\2069\303\234f\356TNjq W\266\243\303yv\227\304F]OV\022\033M&\316\241F\346\354,s\222\271B\256\316l5>\307\240e9\242\334\032\277H\312)\246\350\353\004s\2029\347~o\320%>v\362Th\362v\316\335\034vd\353E\343\027\335\360\342\305\256\341_\316I4n\331J\331\001\325#\223%K\343\027\275\220\223\033\252b\203\0057\207\326\370E\311-[,\035~2\313U;,\302n\r\2672\264\306\317"
+	.string	"'\213\226\253\205\2632(G\265\305"
+	.string	"\363\222>\203Y\372\237o'\223\023\313\325\362"
+	.ascii	"j*'\265\020\300\206\315\227^^\006\257\364\031\224\351\177Z9\255"
+	.ascii	"\240Ul\310\234\241c\322\370\031b\260\261\235m8i\226\237\200\332"
+	.ascii	"\302\272h\330.pnT5>\253\354\264\255)\257\032\037C^z\fk\324\326"
+	.ascii	"\372-\203(f\276\262m||\351\215yI\217!-\375\315\366DC\263\202"
+	.ascii	"\001\t\363\214rJ\261k6KYa\200mM\023\303\217\263\354,;\317l\266"
+	.ascii	"\362b\345\204\362\363\354\002y\332\341\246\361iv84O\222\224a"
+	.ascii	"\220\221\236h/}\007{.\2277\313\005rRF\006a>\276\364\362\210\342"
+	.ascii	"\244\377\331\344dr\222\365[\372d\225\256}\351 B\223\236h\313"
+	.ascii	"\211\344Dr.1bS\306\323\345M\326:\307~.1c\233\323\242\361\251"
+	.ascii	"D\002ha\242\032\237I\356]\033\030\236\221\306\177\323o\377\177"
+	.ascii	"@\270\256\274\306'ZK\377\363\310\355\362<r\257\244+\302\302|"
+	.ascii	"\366\334@M5>\021\223\364?\303\316\260\353\206\243\314\362\223"
+	.ascii	"\317.k/\307\257L\2175w\215O\204\344\353\353\246\245\321iF1\313"
+	.ascii	"\332\322\370DF\322\277o\364\215%`E\212\214\365\350\352\372\""
+	.ascii	"\232\342\3422\342&H\020\257\013t\351\177\3768\177\024iK\377S"
+	.ascii	"\353\324"
+	.string	"\272Y\254U\252FE\244y!,\375\317\2543\353\304\302A9jH\027\330\205\254\364?w\234;N,k\225\256Q\r9y"
+	.string	"iy\323\303\255\361/\320H\177\001*G\216\036k\224J\273V\024\224\363\020\035`b\322\377\264q\332\240\332\001\246%\375\255\235\265K\343\361s\306\f2,WWv\315\n\345\2344\342f%\375\317\252\263\312\256\241V\"\244\345\030\252r\3028a\334\2644\033\335\210\200\2323e\215?\304L\377\323\305\351\342f\313\314U<_a_zyC\\'\213\223\305I%\201(m\315T\231$,yN\375\244\362\221\242r\0266\244\214k\213H\343\017\311H\177B\331s\305\271\202E\024\264\346\320S\3726\333Q9'\t"
+	.string	"\004\304\211\231\032\215\317|\3463\271\305\207\317\210\f\261\363\351g\362\216\354l\f\f\013h\322\037\327\261K\\\307\256\341(f~\342ic\223\252\221\201dE\343[\230\303r\260\034<G\313\325%kb\225\371\233\3439wg\0301/\265\306\267p%\3751\034\273\304pp\034\233\255\344\234T\026@\211\262\003\276\243#F\244q\234\037\257\200\363nWz\327\206\211\325\030\310Z`\262\006\273Y\203\333\2409[fV\225UVZmh6q\033\233\255rVJ`\rF3+\225\033\320\"8\266\334\340\035\267\271\303c\344\264hk\214\331X\2724k\344\256\320\375\377\235[p\324\2645\276\005\"\351-\324\260\263\273\035j\365c\021%M\323\202T\2324>\204\232b\304\3403r"
+	.string	"\030\002&\213\231\3433;\\C\264,i\214\307\340\272\2370\267\251\264\27229n\264\021\323\222Nu\275"
+	.string	"B\006\257\355p\335 2\327Xh\013\035\335\031!\265\364\307d\277j\370\t\006#\004\355\213Q\252%\247\344\256\361\205\226\244r\370\fo\271eV%\254\310k\312a&\356\272eV\031X\261\306\013\356\202\271\330%\226\303P\260\034.\303fv\016-'U(\200\027\272/\275<#\0168\b\3302*\305[~\354\004/q\334\217\217\0274\2444\326\202\225"
+	.string	"\251\033\323\370BAR|\345\216a7\273fY\332\341\002\352\322\t\301\265\211\004\244\322\221\3124\\\215LH?\024\304a\360\270\"\211E\244\235\023\027\232\210\352\272~ b\004\211UM2R\223\210\301\022*\206$\034\213k\221\204UM\n\362]\351\310\203P]\203\307\2465hbm2\256M\032@\2168\252*\206L\030\3245XbU\223\200P(.\2418\252)4P<:%]X\207\304\021\027B 1\302:$\216\030\022G\370\254C\342\210\240\r\254\252\b@@\300UM\002Z\200D\252HHAt\004\013\b\301\006$8U\f\217k\220\204\265XbUEhb\032^"
+	.ascii	"A\f\256\301\236+\035!\225\326 \223\212\342\321h\f\002\221E\244"
+	.ascii	" \317\225\216\220\216@$\024\036\220P`@\236\360\301\022\nU\004"
+	.ascii	"R\211UM\262p\245\243$\342\360\270\"=\250\302\246%$\342\320\303"
+	.ascii	"\021\331\344\001\303\322R\023\221X$\372V\240\232\302\020\211"
+	.ascii	"\242P<*\255E\242\017EP]\302NF$&\225\t\275\322\321\b'F\230\360"
+	.ascii	"\220\201\t\220\212K \250\307\"\b@Bu\r\"\203\035P\205E\246\343"
+	.ascii	"08\344d,\202\360\003\264\360\340\032\024\256*\362\347\204\221"
+	.ascii	"\223\261\b\002\321z\245\243$\243\207$#\022\261\211\207\210\242"
+	.ascii	"O$0\311\330\263\002\211I\306\223\230d\274j\nC$F\"\325\243P\030"
+	.ascii	"\3649\031\213H\370\270\032\257P%&\r\227\202>\241\212l\302\304"
+	.ascii	"\342pER\221\276\037\201I\306#\237cP\t\t;\035W\3440I-qa\005\002"
+	.ascii	"}\214A\022T\250B\342\210\342\tdp\270\364\001\322\021\203\232"
+	.ascii	"b\270\"}\240\n\213$d`j2\261#\"\2118d:\006y\212>\034\tUu\r\226"
+	.ascii	"(\036\235D\260`\b\304\021\t\"\022+\020yT\227\232,@\024L\205\026"
+	.ascii	"p\2044\001I]U\021\302\"\t\304\341\220\320\006G\026V!\320\211"
+	.ascii	"\351\374\341\340\350\004\262\2518L\241\036\215AGui\251x\\}\202"
+	.ascii	"\212G\247$\354\363\301 \242xt\022\301\202\272\006K\b\r\221T\021"
+	.ascii	"H\030 Mp\n.\251\"V`p]RE\250L\303\225\007i\002\323\360D\n\342"
+	.ascii	"\210!\247u\210"
+	.string	"T\\R9\240\"\310\304\243\"\270\244\036y\204\031\350a\006\332\230\201\366\021\252K'\004\211\026 \n\032\261\252&\204C#\206\021@\021#H \207*\202?\246\243zb\204ph\364q\n\036\217\0370\251+\322\311\0040\303\217\223\221\b\205\340\007\230\216\352j$2\001\303\317\272\"\201\252\210\343\020\205\005\241\272\2644D\301\263\022\233\212 \360\250P\205\304\341\311\324d\"\2118LQd\372%\021\207\310a\221\250\n\201\232\200(\214#\374z\206\030pD,\016\211&\2400\216@D\f\001\205q\004\240\245\245&\"\220pHB(\b\204SopB\1778\241A\234\320\037\202\r\"\330\037T4\b\025\375\301\251\033p4\264\"\201?B!(!\255\305\0222\234\020\366\006G\3531h<\"\"\016\203\"\360\020\207A\021~W:Rq\364\240\3428\024\\\203\"\220\216\350\225\216\220\200*\323p%6\035= \241\b"
+	.string	"2)\270\024\202*,\222"
+	.string	"t^\351(\251\351\004U\350A\2704l:\301H\025\026IHj:A\025\376\256t\2044&y(\016/\230 !\302O84\246\252\260i\035\256\353\007\253*\202ph\034:\026W\244`\b\026\220\252zLRE\200p\201X\034\256C$1x\024R\205E\022,\260.\rO\020)\255ID\365\270\232XRS\250#\\"
+	.string	"i)\210T\204\004\022CXU\244Z\"\311H\264\002A,`=\256$\210!8-\031\215\037\004\365 \327!q\204ph\374\351\340\b\205\340\007~T\240jt:!\f6\235`x\202\205\365JG\036\210E&\246\"\322\005&\260\310\020>\254F\036u\r\256\310\323\302\221\216\204C#\t\240#\r\217*QMJ\317\001\003\024\300\200\020*|\017\361\200\r\036\260\001\372\020\017\370\360\341\001\f\370\220\236\001\037n\210#\016\034"
+	.string	"T\327\340\222\221I]\201\253\212T\217\300\013*P]\203\253\211\341\322\360\204\340jB84f\270\322Q\023\323\020\205\240\323E\002\223\206(\210E\020\204C#\017S\221\250\n\201H\244\212T<\032\201\302\241Q\210X\034\256D5\205z4Z\220\301\nT\327`\212\341\212\024T\205@\024(\212\252\t\202+\320)\210B\220\330t$\300\225\216\212G\247$\013\220\300\342\321)\t]\201 \026\2402\rWc\2618\302\252&\035\203\353\017\n\020D|P<:%\245K\305b\005\200\347\212LW\024\252\020\270f\bz@\036\213H\242\212TBZ\207\306\023\271\264T<b\244\332\264\024L\2016\001\221L\303\343\t%\244uHBH\374`i\251x\034B!x\274\353\225\216\222\206)\202D\340Rq"
+	.string	"+\020i\202\3124\\\323\365\003\241\272\006\205\306\246\037\022\270T\354Q\n\256\252\322\372\0232!\001\207H\243O\310\204\004\\\227\202>\337\272\203\004\252KC\024\305#\t\341\320\330\263^\251\350E\243z\364\260\026\213G\017<\",\022\030B84\242$\354\b+\034\032/\nA\247\235\024\224\200(\214K=)(\375\240@Q\\\233\220\200JHk\221hA5:\255\300\243\272.\rQ"
+	.ascii	"\205V\242"
+	.string	"\212tTI\254\304a\221\204\261IH\034v \003\017\n\301\01705\231\020\016\215?\304\342p\r\"\211\252\221\251\b\202pHb\r\236\220b\2108$a\375@84\006\251KI\304\017\226\324\024\352\022\320\212\244\242@1\244\n\213L\300\365\250\032U\250\300ui\270\002\211\305\024\206\307\242R\321\tui]\213G\245\023\030\210\303\240\b\307\342\032<\252LGu\035^(\016\327`\t\025\301%\265\204\205U)i\250v\300\004\323Q]\205C%P\b:\t\255C\246\341\bK*\022\322\007\352\032<\376\b\223\202\204KE%\244zTZ\201+qX4\256*\262He\032\256;N\301%U\310\243.%\021\203\027V`\210\2258l\362\251k\360\b\034R\201%\224\220\301#\b\302\241\321\202\323QMQDR\217?+\220\001\037V\342\260)E!\350\004\\\207L\303%\240\0222xD\002Z\203\305%\024\347\035\340"
+	.string	"\02020\241\004\021R\244#\341\320\350aUJ\032.\241\360@\034\006\231< \035\221\036\2162|n\316\027\346\026\2229C\345\214E\266\241I\263\f\036\335}a\256\n}e\310\336\231"
+	.string	""
+	.ascii	"I\177\037\030\337\024&c\343\004\356\313\231\036;3j\\x\361%\261"
+	.ascii	"\2240RK\272\240s\260\031\036\22389\f\306w"
+	.string	"\227\345#\216\013\023 *>\252\310lA\341\374li\315\225\211\303]=\332\214]\321\202\336}\335\241\201\312\202\255R!*|\301\202\303q\2764A\242\304\260\340!8\016\035-I\0323/(\225\304\360]9\347*\200\367\002Hc+\025Fn\205\233\357*\214\024\252\266\263\215C^\020\263*\276\032@f\262\200\274`\303\373}\325\371\242\341\243r\353lt\031\363\266\326o<]\314\346dQ\363)}\226h\312.\276(\276(>\264\337\323O\032(\275$S\356C\373Atpb\241\021\002\307\245\261OJ\277\3350u\214\254\020\200\247\364\007MR\204\205\225\306@>\255$Z2|fW\356\007\t\023!q>&\356\002u\305\205\236\230\252\025\236\240u\251\0221`\324\226\026\356\306\n9kcc>2k\205\307\001\034T\030\261\274\254\244\261\341\3675\271\217,M\002\305\316Jc\037\223\267\225\001\261\022\246\261o\t"
+	.ascii	"\340\244\267K\237\222\267\235\264=6j\222\304\371\216"
+	.string	"$\307\220\320\361\344\315\200\261'\206\266\245wXac\216\3406\27761\226r*\\7\023\320\234di\354\363\362y\371\3008\200\013\363}\335\007\206\305<)c\206.\375}Fn\226\376\212\361\365\306W\344\304z*sF\244\261\257\253\004zu\310\252\032_a<\263\036;\206\334\264\306r\243\227\307U%\016\207\r\">!W*\355n\316\205\017\310}A\360l\370\320\321\330\267\345\373\241\004L\355\314\355\356\216\250\271\262l\354\363\341\323\342\002K{\373\2327\255\362\304\362\320d\241k1\232\310\t\322\003\307\361Q\371\262B\303\022\373Yb\007\306\307\343^\231\301uD\212oG\027\252\334\0133\3268G\016\237\262(\353\222i\363\004k\fo\221[\221\246\361\0010\305w\303w\303\247\324\340\004\n^\026!.\240\320\371\224J\"VIf\314\360\325\260f\271\212\002Ow\312\261\313\204\252L\017\032\367\325x\023en\t"
+	.ascii	"/_\f_\f\337\325\005'b\360\262\230qQ&\314gu\337\025\236\343e\007"
+	.ascii	"\227\306\276*\f\346\370^\370^@y\202\265\223\225\335\256\032\037"
+	.ascii	"\0035\276\026\276\026\347\334\205&\315\275\034>Sfrp\321\342\213"
+	.ascii	"\362E\371\246\276\200\001\355h\242\003\317\307\342\276\251;\030"
+	.ascii	"?\254\254\032\373\244p]\232*0\2724\366\255\260tUnr\304\314\352"
+	.ascii	"\324\361%y\244S\324v\350\360=\335\227\0042{\301%Nc_\3061\200"
+	.ascii	"\264P=\241\323\030\335{\033\2163c\273R\350\227\206,\250c1\304"
+	.ascii	"Z@,\006)\214\345\220R\310\020\rm\222t\303\025@0PD\030\217\310"
+	.ascii	"\007\264z\023\300\303\314,\265\211\232\205\312\241\031\222$)"
+	.ascii	"Hik3\217j\250s*B\262\350\343\222LY \322\311\365s\337\021\255"
+	.ascii	"gk\371\206^;6\256\r\332H3\004\370)\255\216y\324\215=\266\267"
+	.ascii	"\363\342\306\024\315\227\251I\026\374\215.\311S\272\251\241\311"
+	.ascii	"tMk\236U\311\025\0314^\327\243HF\213w\222c\314A\372;C1wJ&*\352"
+	.string	"\243\223E\263\327\300\311\260\315\034\200c(ha\253A\314n\270\033\355U2\372\\O\364}\221\245\036\"fZkt\351\221\216Y\264\203\241\273\253\306Vn/\237{\005\321\367\205A}\366s\373t\033\355\f8\347o\231r\316\001\345\376\225\030\243P\2121rf\364ut6\367\2015t\301\357\3155\013\3445NR\007\260~T\375\020\213\371(\251\351\005\230\235>\005\356\224@O\341\030 \207\374h\327\227\361\f\212h\230\310\340\244\324\t\001\"G\346\254\177\nI_\240\221\026\355\016\360\250\223\300\307}h}P\300B\003\363\f\363\207\316\n\253\242\031\256>}\2108W\237\024\253\002\264\327DX\346\016\227&\313?\323u\300*\025j\246\324\t\331\350\203\200\272#{a\341\331\326N\035\267\274\212fZ\210`*T\316\357x[\266%p@\313!\223@\260B\334O\363\251\226$5\ne\356\250\251UE\212\206\021\330\024"
+	.ascii	"\370\313\347\220\220``\345L\311\261\221D{\321\212\226\025\277"
+	.ascii	"\254\220%\017m1\003\333P\023\217D\342(3z\321\335U\026\3208\276"
+	.ascii	"\023\247\252\020\205\247p\004\242vj\217'J\022\030OCEb\375\221"
+	.ascii	"&\002;\027Sg\303\244 \263\021\233E\322\277\226nd)L"
+	.string	"&\203\262\257\270\0203\\\247\271\324\342\324\3613\323\216\262u\261\036v\370\320\307e\202\334\363\367\310\270\332\005\016\350\345Yr\213,\372/\271==\355\2343\302j[\202\226\374\224?\207\031i\310j\235\302\346\017\240p\006\0348k\354\375\372\016\373#c\300\234\0304\220dN\340\017\217\251\3113a\332\016|\311\360bTQ\252\026\265\370 |\315\2220c\232\241\030\355\332\377\013k\211\332>\335\341\264P\242\024\320M6\375\357\315C\215\025&\272[j\367\220=V\2559\216\230G\356+|\203~\2271\r\3675Le'!\326s\201\033^\204-:\326\246\004\301\367\032\205\0072\202x\324]]jrb\004\313\364.\321\276\337'\351\035\251!~\360\241\356\307!/E4\r\215bm\250\232\373\311=>\275+y\005\037^\276:F\254\265\204+9\306\304\tv[\022>\243\203\026L\023\360\307\255\352\264\274v\247\025\310"
+	.ascii	"\200\245\206o\016\261x\270g6\031\325\n\021L\017V\262P\321m:@"
+	.ascii	"\244\3521\037\346\204\247I\204Q=Pf\030\336\275K\003\334$\215"
+	.ascii	"*?]q3\n\272}i\bCa\355&X\326H;\304V=a(?^b(\234\177\274\226+P\302"
+	.ascii	"\262\251\235\363v\220\273\347\335\nor\262\030\016a\265\361\305"
+	.ascii	"a\227Q\"\366\326\361o\025_\226,\260\324\022\r\321S\351\251G\201"
+	.ascii	"\264[\240\027\260\376\245\2341V^\355\2428_\241\212\226L\031\356"
+	.ascii	"P\332^9N\312K\254\252\205\222\234O\214wh\237\204\327\267\252"
+	.ascii	"\207\312\364\234r\307\373\003\350PX\301\225\n\205a\323=\337\265"
+	.ascii	"6\370\313\244\276{\300v\267+\373\001Q\243N\206flWXT\264\362A"
+	.ascii	"]zU\302J.\265\\b\024%)\217~\330\255$\002\2416"
+	.string	"\215\315VZIK\224\307\034\212\334|\315\234\232@\350\303\254\222F\214\335[r1\354\214@\347qZ\021\b\024\204!\326\362\237 t;\034DAWP\221\377\027\341yE1C\247\224\303|\320\203\214\001\233\020\361\320\261\356\345\364\023\005\f$\2103[\022\215'\346\232\332\216\356\215 \006\220\245\247\310\203[A\334p\233\233\341`\245\203\350\002\313\370\032\224\026F\205\302'\025Ac\216\271\367]PZO\345e\215\211\234}C>\2120\276\253hl\263@q\225m}\243\020\366\226\004\266h\271Gdr\263Ki\r\271\035U\321\200\240$\223hcE \204\350U\252\371,\227\242\202\317\007\013\"\364E\212\274Od\001S:\374\371tD\310\254\203"
+	.ascii	"\261\243cA\321TL\300\027z\352\3052?s\033\210V\035t\326\224A\263"
+	.ascii	"\0168\330\005\234\fA+PP\2260h\230\021\212\276!\355h\344\221\f"
+	.ascii	"#{\364`\333\265$\347\267\363\025l\n\n\262G\243\256U\306\376\316"
+	.ascii	"\b\265w\022\325\342\203\354R\266\356\200\224\026L%\275\214\213"
+	.ascii	"Lc$p\227_uu\230=\232\310M\037\351.\317\335(d*\370\265\221\rA"
+	.ascii	",\202\316\340\251\007\200e;lt\230\226]\316\323@\324\231\306\272"
+	.ascii	"57\223\031Q\205J\315\3429Q\366\341\032&\001?\"\247\234\234\""
+	.ascii	"\017O"
+	.string	"\222\013\231\206d\373\006\261\230J\233\032\270U\006\277\023\304S\177h~Q\317\026x\245\342Ng\345&\216\356\344\356\217f\201\266\335\373c_\364\227\336;e\320\t3\364P\356M\347G\344i9\342\367\205`P\2713\205n\201\245\247p\036_\241B\202\354\017\220\217ko\211\246\332\\\244\371\344\344\332\373\333\004V\221BK4mO'\353\362\006\241\243\030\003)%3|\005\f\332\310\t\313\033G\034L\001\004\226\235]\307\246f\n\004.\240\"C\214\366p]d$A7\243\303\261\301\362g\252M\"g\261uh\245\033\201\037\230M\307\r\213\210\272G\210F\236M\272\302\253(U \202}\037\242r\374/\253'\323p{4\273z\350\301\202\201\237\005\336\354K\204\265\001\246\357#\226Pu\022\250\357\360\331oo\200\312\013\345`\301\213\216\305\254+l\223\337\335Z\230D\204\024T\271}\350^\027\250U\235\372\363\232*"
+	.ascii	"DV1\351\005O,6,\377\326X\033!\273\351\207V\260\357\fz}\341\254"
+	.ascii	"S*\350/\033\240\177\202\035\244\f\206Xd\376\035\350\212P6\325"
+	.ascii	"\023\037\313\360\200\267\002\023\275\2432\224@y\256OBI:5|-\305"
+	.ascii	"\024\256~I\357\226@\345\214l\027\332\233\023\246Z\311\b#<YZ8"
+	.ascii	"\244\241e\007x\022\017\3774\256\256\220"
+	.string	"%o\026,f\207\215\373\031\020\"\222G0\370\247\262\326\251\376\316/\324\234\341\207\242`\335\005h\214\347\276\031\326\222n\266\200\224\343\351\220M\222a\343\343\3012\021\267\bLj\032\350\214\321\300\303=\216\214S\013\341\362\004\262g\330<\022\t\004\347.]\365$\256\232\rI\353K^\3669Ux@$4.\017\021\360\327\353eF\0028\316\362\242\320\374=\006\206U\212\201\366\333]\265\225vmg\356\320\234j\327\n\327\t\006\220[\007^\030\211p\255s\017\330M\267\323\337X\202\276\225:\023\013\340.\3401\344\232#\211h\211KfA\t\274y\257\271\\~\001c\241\254\031\bkW}\204\016#M\023~\313^\352S\204\033>\263#@\007\261\377v\231\364z\366d\260\301\030\343\254\333\006\251\203\201\323\373\247v;\3518\005-K\302%\003|\304\021\002B\004\313\257\016\020\205.\325#\013hW;eiu=\321"
+	.ascii	"\241:\023R\217"
+	.string	"\217\373\002\32260\007\375\005C\021\\\230\006\t+\211\305?\341\t\334UH-\327(\200I\200\210\253\267\256\r\224\3716\346\267\240_\b\263\t\330\205k\271r!\b\333\340`\336A\fZ4\003sG[\206Czq\374=\221\3353\236+\006\302f\316\317\342G\225\253,;\341;=R\300W\212\253Q\"\002a\300tx\206\375\335\032D\260\230^\032\232v\027k\306\214\2315\206\240&\350T\016UA\\P\334\024\221@\327\334ut\374\300e!g\271\360\272\023\210G\266\367\027U\271\273b\305)7&\277}uJ\365\214\240vLU\211\362\264'K\276\320\232$\311%\231\360\200\200\022J\270\251\203\227\317\325R\222l\372\221iJ|\016\350\254\256j\030\261\214\232\373N\312aDG\374Ae\022H\334\236\235\310f\203\001\013\337\251\307_P\223~\364\233n\212\373\363XD\321+\3328JH\345 \032j\257/\346:"
+	.string	"\f\316\3364,\342X1\310y\352\343\001\004<R,N\362\313\325\3003\2527L\336\022\356k\214\354y\030\202O?G\252\234\316b\332\273\216`z\2758a\362\023\242\270n+\217\236\361\323dS|\020R\f@\301\372\"6_\347\372\n\267\255fO\351\245\230_\325#\326\220HU\317\336\216l\017\001\306\315\202\263a\332\375C\324\341&OzQ\005Z\310b\324\317\307U8v\257\244M)\260\352b\352H9\240\254\233s\254[\316\356\325\241\372\300\n|\321\031{\312@\303SNP\344ncXD\367/v\232\344F\301\314p\341\251\347\240\234,4c@{_\202'P\330\275\273\232#\334S\203\346\3526\270\331D\026\205\272\327\360\355\026,\330\034B\344"
+	.string	"7,\367L\220"
+	.string	"\352}Q\326\323?U\370\234\2420<p%m\224\004\"\210\341\211L\363\006(t\272\316\311\330]\263\242&`\350T\264J\331\341d\274\344\307\331o'J\210A\327\025Aw\351\330[\335\265\007k\302\341=\037\270\335\333\031\f\021<\250\272\203\215\2547\013y\025\253\327`\200\345\f\361kg\240^\2358\016|\234\207|@\200\220k\273en\204\r\267{\tx\232T8\253\247\177U\370\235\033J!8\235\023]\233\345\260\016\336\225mX\201'\3441\336c\257\356\027\326g\262\316\203H\213\016*\t\332\255?\025\371"
+	.string	"D\372'\367i\035\270yN\177\320\346\246W\254:\267\310T\254v\025%\314\004\264\013"
+	.ascii	"Tu\333\205\313\005t\007W\372\277\274\035\247\244\365\022\255"
+	.ascii	"\223\271rC5>!\272\311!6a\211\230P~\267l\272\213q\027\243E\002"
+	.ascii	"L\243\204\321p@\216dE\312&\357]v\n\307}\372/\202\2634\304\r\376"
+	.ascii	"\367\305\312\336;\274\265\302\301:I<\303\226\273/\034\243\226"
+	.ascii	"\2460\t*\201xL\372\214\232%\336\033k.\006e\247I\302\373\216\320"
+	.ascii	"9\272\250\264\r\334\177A\333\267\330\250\233\262,K\035QW\343"
+	.ascii	"\320 \2562[+\354\310\003^\307\366\271\0079\0036/\006\007\013"
+	.ascii	"\222\\j\267\336E\021>\\/_\301\325E\255X\013T\317\372\305\026"
+	.ascii	"\226M\035\260\b\016\006\323\377o\320\037\303`\375\036<\225\356"
+	.ascii	"\247\334:\t\271\r\271?\333\276\001\305\367\\l\037\223\232\b\323"
+	.ascii	"\372\370\006Rv3f\277\203]\326\257\n\327\355\353\021\366\335\022"
+	.ascii	"~\001\370\254#\247\034\356b6M\34781\204Ur\347`\354#\364?\267"
+	.ascii	"|\217\033\316\322\030\257\3778\314y\326\236\275\003\376\255\033"
+	.ascii	"\215\300\301\341w\003\226\006\277\027\030\037\275\236\322\365"
+	.ascii	"s\341\343%\223S~f\303,L\227\037\246\3600\t\311\246\317g[\034"
+	.ascii	"\376\372\373\316f\335\226\334\355*\020o\313\236\277\362\033\331"
+	.ascii	"\307\201\023;N\275\3129\353`]a>\261\336\362o!\361\334@*?\f"
+	.ascii	"u\022\210m\004{\330\371\3771\375*\207\225\214U`\273\205~\333"
+	.ascii	"q%a\335\370\236\002m\272b\211\200\350Q\347\247v\036ix[w\301\306"
+	.ascii	"A\271O[\363\236p\2637\303\331\351\222\f\356\333|Q\320e\355H\341"
+	.ascii	"\027\221>\005\364\001\217\373<\370\252\361}\355\034\377=\342"
+	.ascii	"W\316\356\363K\371k.\277\2526N\233_\324\274D\366\351W}\352\207"
+	.ascii	"\232M\204\203\224\377ZnB\306w?\037\334\271\345\304V\357\251\236"
+	.ascii	"O\035\226\366\216r\034\312\362'_77{)\345\223\337}\364t\261sV"
+	.ascii	"\373\365t\277\263t\343H\276Qm\233\275&\326\264\263\337\271\351"
+	.ascii	"\346\177\315&7\266\231\377&\216\277c\272a\033\226\t\370\253\027"
+	.ascii	"\\\261`\312\372\303i\\\207f0V\360z\202k\303\342\027\3449y\366"
+	.ascii	"\326\314\035\264&\00759\230\177\211\300\2063\023\343\314X\247"
+	.ascii	"p<\340\266\320m\264\244\357\n"
+	.text
+	.section	.gnu.lto_.symtab.84c5d4fd3cccd4b0,"e",@progbits
+	.string	"pgResetFn_pidProfiles"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\001"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\002"
+	.string	""
+	.string	"pidProfiles_SystemArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\360"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\002"
+	.string	""
+	.string	"resetPidProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\001"
+	.string	""
+	.string	"pidResetITerm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\002"
+	.string	""
+	.string	"axisPID_I"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\002"
+	.string	""
+	.string	"pidSetItermAccelerator"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\002"
+	.string	""
+	.string	"pidStabilisationState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\002"
+	.string	""
+	.string	"pidInitFilters"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\001"
+	.string	""
+	.string	"pidInitConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\002"
+	.string	""
+	.string	"pidInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\002"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\006"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\002"
+	.string	""
+	.string	"pidCopyProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\002"
+	.string	""
+	.string	"pidController"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\002"
+	.string	""
+	.string	"axisPID_P"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\002"
+	.string	""
+	.string	"axisPID_D"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\002"
+	.string	""
+	.string	"axisPIDSum"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\002"
+	.string	""
+	.string	"crashRecoveryModeActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\002"
+	.string	""
+	.string	"rcAliasToAngleIndexMap"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\002"
+	.string	""
+	.string	"pidProfiles_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\003"
+	.string	""
+	.string	"pidProfiles_CopyArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\360"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\003"
+	.string	""
+	.string	"pgResetTemplate_pidConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\003"
+	.string	""
+	.string	"pidConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\003"
+	.string	""
+	.string	"pidConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\006"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\003"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\003"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\003"
+	.string	""
+	.string	"GPS_angle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\001"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\001"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\001"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\001"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\001"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\002"
+	.string	""
+	.string	"nullFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\002"
+	.string	""
+	.string	"pt1FilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\002"
+	.string	""
+	.string	"firFilterDenoiseUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\002"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\002"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\002"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\002"
+	.string	""
+	.string	"getRcDeflectionAbs"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\003"
+	.string	""
+	.string	"acos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\003"
+	.string	""
+	.string	"atan2_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\003"
+	.string	""
+	.string	"imuGetRotationMatrix"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\003"
+	.string	""
+	.string	"ol_navigation_get_setpoint"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\003"
+	.string	""
+	.string	"getRcDeflection"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\003"
+	.string	""
+	.string	"filterGetNotchQ"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\003"
+	.string	""
+	.string	"biquadFilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\003"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\003"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\003"
+	.string	""
+	.string	"firFilterDenoiseInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\003"
+	.string	""
+	.string	"gyroOverflowDetected"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\003"
+	.string	""
+	.string	"getSetpointRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\003"
+	.string	""
+	.string	"mixerIsOutputSaturated"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\003"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\003"
+	.string	""
+	.string	"getMotorMixRange"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\003"
+	.string	""
+	.string	"getThrottlePIDAttenuation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.84c5d4fd3cccd4b0,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
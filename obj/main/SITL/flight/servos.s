@@ -0,0 +1,2030 @@
+	.file	"servos.c"
+	.section	.gnu.lto_.profile.842e9217c823b621,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.842e9217c823b621,"e",@progbits
+	.string	"(\265/\375`\360\002-\020"
+	.string	"\304\025\344\003"
+	.string	"0"
+	.string	"\227\324\251\365\n\n\002"
+	.string	"\002\001\002\001\351\361\316\337\001"
+	.string	"\002\214\216\274\341\007\003\346\252\251\302\017\004\002\003\002\004\240\342\234\212\n\005\266\233\207\357\004\004\002\002\002\005\002\003\002\006\006\b\232\242\313\204\f\004\002\007\003\002\004\t\n\013\340\216\253\313\016\004\002\b\002\b\002"
+	.string	"\002\005\r\243\230\366\360\007\b\002\002\t\017\240\367\360\225\r\002\020\364\320\211\371\007\n\002\002\002\013\002\f\003\002\004\023\024\206\353\317\360\016\f\002\r\002\r\002\016\002\017\025\352\263\360\321\b\026\027\030\350\266\266\364\b\030\020\021\002\020\022\002\022\002\031\227\257\311\336\r\033\344\362\241\220\b\020\002\023\002\002\020\034\306\236\261\270\n\212\001\002"
+	.string	"\002"
+	.string	"\002\024\002\025\002\003\002\026\027\003\002\006\002"
+	.string	"\002\030\031\002\031\024\002\032\017\033\002\017\034\004\026\002\026#$\303\335\257\241\013@\002\002\035\002\033\002\007%&\263\263\236\331\005\"\n\002\n(\342\201\222\246\004\002)\230\227\377\334\t\002*\257\260\211\347\004+\265\371\317\206\t,\362\324\245\255\006-\303\306\351\344\006.\320\266\271\326\t/\273\300\203\322\0040\227\213\266\256\t1\376\312\360\275\b2\217\240\261\222\00434\247\336\216\365\00156\302\234\216\234\01778\235\307\214\342\0029:;<\240\342\234\212\n"
+	.ascii	"V\250\321\245\340\214\210.(()\335\f\200\202bU\334\006\022@\324"
+	.ascii	":\r\221\n&\232J\303\365\177\033\021\205[\241s\021\035\210\330"
+	.ascii	"u\211(L\220M\224r8\230v\fI\016B\0278\030\266\301\020\240~\362"
+	.ascii	"\020z\\\321,\326\266\360\304m\251\022\366\254w\001\343\031\210"
+	.ascii	"\340\321\320R}\216\2157\377+\376l+\320?\216\005~\313\273\230"
+	.ascii	"\347\237\363v^\016,\374\373\375\003\002\350\214\334)J\265_\300"
+	.ascii	"\354\205\3140\233\353P\\}\275m\360^\2119'\341\232\370!\351\205"
+	.ascii	"&\031\372$\357\346l+\360\020\252\277p\362\035\340\222\322\004"
+	.text
+	.section	.gnu.lto_.ipa_sra.842e9217c823b621,"e",@progbits
+	.string	"(\265/\375 \337\205\003"
+	.string	"d\003\323"
+	.string	"\021"
+	.string	"\001\001\001\001\001\003\001\001\002\001"
+	.string	""
+	.string	""
+	.string	"\005\b\013"
+	.string	"\001"
+	.string	"\001\r\003\017\002\003\020\024\030"
+	.string	"\001\033\001\034"
+	.string	""
+	.string	"$\001"
+	.string	"\001&"
+	.string	"("
+	.string	"\003)"
+	.string	"\001"
+	.string	"\001"
+	.string	"\031"
+	.string	"C\t\220\263\320\"\007.\240X\342\222\307O\3027oP\354\\,\277\214\325\t\270\3014\224\336b\302p>9\200\275-6@\240\230\003r\004@\f\225\300/al"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.842e9217c823b621,"e",@progbits
+	.string	"(\265/\375`\205\003%\021"
+	.string	"\326VTC\020\257h\030\003\270'=\365\271\213\361C\"\036pr}\2618p\273*'\005\225\212h\023\2766\337\027\353\263\317m]5i\220\255Y\003"
+	.string	"\200\242\b"
+	.string	""
+	.string	""
+	.string	"\350\301vdy\003\364\341/)\030I\333R\312\0248"
+	.string	"G"
+	.string	"L"
+	.string	"+HS\256\376\034\211\343\212\322\023\273{\261\316}\372\250e\245\334\335\365|*c\272\r\"B\253T\351JhFc\236\246\224\260\273\242/e'\037M\372\332]\320\0138[\020\343\t\300\001\024\006&v\2221P\022V\213MF\001<\245\313\n\313u\261\366y\031B\214Z\272\n.m\021\367aJU\264\036\310t\244\006\025\026\3276\bUy\263\333@#_W\332\235\244\260\310\270\303}s_\376#\r0\257\205/\333\206\312\224\232\025\230\347#\275\026+f<H\037\031\301\004\245\303\306\0332&DB\022\2442EH\314\b\2175\3262OA\334\324\344p8\300\261\360\"\360"
+	.string	"\024e\bQr.P \251\222C\027{\331\306"
+	.string	"e\370\223\022\317\377\207PO\237\021\374\245,\367\003\370\211\210\322\t#\0360`\211Ja%P\340\240\310\006V\311jA\240A\026\227W\214d\022w<v~\214\317\210\347A\362\003\3143\311\231|\005I\233X\2501\261R\202Q\212h\246 )\026\003`\002!Sd\345\001\022\340SEG\202J"
+	.ascii	"\261h\246&0\267Z;G\300\005\002\357,\"\2179\0261i\262\220\256"
+	.ascii	"!d\034\b\334\220r\022\0046A\356\235ka\250\327\264\351U\277\036"
+	.ascii	"\315\212\326\225\200\323\245\305\032\336\2020\335B\017\327\351"
+	.ascii	"\316\264\306\2559_[.\204e\033\350\301X\204G\025\354\307\033\267"
+	.ascii	"\276Q\312\303\"MR\260\007N\020\314\007\031\001\023S\356\032\b"
+	.ascii	"t\374\022Z8b\007\327R,\006\037$\362\253i\321\237\256\313\270"
+	.ascii	"\023\212\335P\316^\222]\241|d\316\266]U\250i\035x\\*\216\254"
+	.ascii	"\2166\200<m\256?\251\226\234\352BSv\rDnjU\237\212>\310\243\303"
+	.ascii	"xF\373Nrx\303"
+	.text
+	.section	.gnu.lto_.jmpfuncs.842e9217c823b621,"e",@progbits
+	.string	"(\265/\375`\006\003\305\f"
+	.string	"F\02064P\305&\303\001\024+\223]Uuu\025\207#\034t\006s\"3K\304dW\3477h\232ATUUU\003W\212#\304\321;K\272\036\352v\320\262\321\3362\311$"
+	.string	")"
+	.string	","
+	.ascii	"wzZ\222\"\360\233-,V*S@\253{\267\321:-\034\272HWVqVM\266\206"
+	.ascii	"\257[\317\003\256\001\001\255\257\2470%`B\241\315\255(\253\030"
+	.ascii	"\321\325H\204i\252(j\247\321Z\203\251n\252\223\276\022\203\205"
+	.ascii	"\322{\357M\026t<G\037[,\273\f\b\212*\231\344G^\344\036\362 /"
+	.ascii	"\321\022y@\036\320\345s\371\2603\352\214\336\273\240\250\031"
+	.ascii	"\240uGP\2145\r\263&$9AjHr\003\340\241\334|\362\234vQ\\\3068\227"
+	.ascii	"\2653m\223\373\300\036\267\2243\215gZ\227$\310\003Z\250\021M"
+	.ascii	"\353F\2024\226\f\007p\002\221*,\017\022@\002\203JA\007\005u\242"
+	.ascii	"\300Na?\306\344W\3438h\226\037\352\322\206\306-\024\\>\276\234"
+	.ascii	"$\275\224\226\202\340\221\211\024+`R\304\003\3418\360\204@\353"
+	.ascii	"\376\322/\013(\237A\032M=\255\320]K,\006\274\363\3046jvh\326"
+	.ascii	"f\306\272\346\215$\215\304\254\332\025\013h}]t*\305\361\340\314"
+	.ascii	"Z\304\360\235+\022\023WJ\272\316K}\024G\310[\245\320%\235\035"
+	.ascii	"\220\272\344\006\220\236C\362x\031\b\373\236\274X\030\2022\216"
+	.ascii	"\242\241Dxk\326 \n)\t$\2346\366\\(\325t\276\264C\037\3410\240"
+	.ascii	"8\210\366\304\250\252\261\346\236"
+	.text
+	.section	.gnu.lto_.pureconst.842e9217c823b621,"e",@progbits
+	.string	"(\265/\375 8\301\001"
+	.string	"4"
+	.string	""
+	.string	""
+	.string	"\021"
+	.ascii	"\232\004\001\230\004\003\230\004\005\230\004\b\231\004\013\230"
+	.ascii	"\004\r\205\004\017\205\004\020\230\004\024\231\004\030\231\004"
+	.ascii	"\033\232\004\034\231\004$\231\004&\230\004(\204\004)\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.842e9217c823b621,"e",@progbits
+	.string	"(\265/\375`\306"
+	.string	"\025\007"
+	.ascii	"\342I\036&\220E\031\016\363'\363\317!\257\263\334\335\315u\267"
+	.ascii	"\271\220\371P\022c\355\263\366\023Zp\0270N\033\370n\333'R\246"
+	.ascii	"WT\005\211PlJ\214\020V\271\325Y\225\375?\217\003\345(\r\377\312"
+	.ascii	"\037\033\245#\273\3520\312.\026\346S\376\0208\225O\235\213r\250"
+	.ascii	"MStB\255`&\312\245\262\tX\002$\023\312c\370\\\033`\316w\356\314"
+	.ascii	"\374\271\347=j\207\312\007\027\356\334\236\225/ `\002CSy~\262"
+	.ascii	"\200vhCct0\030\004\333\036\234\316\330\266\006N`Hj\301&R\327"
+	.ascii	"\310\325L\221\023 \035\367\210\215\213\370\302\332\201\365\030"
+	.ascii	"\007V;\032;\346@\023d\001t\313\0279)1\343B\"!\036@\205\330\240"
+	.ascii	"\341\026;fN\307\341\346\326R\273n\007d\317\376\240\030\242\346"
+	.ascii	"b\275w[\206R\004"
+	.text
+	.section	.gnu.lto_.lto.842e9217c823b621,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_servoConfig_Registry.63.842e9217c823b621,"e",@progbits
+	.string	"(\265/\375 \224=\004"
+	.string	"\224\007_"
+	.string	""
+	.string	""
+	.string	")"
+	.string	"\005\001\212\001\202\200\200\374\342\203\274\253\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\334\006us\350\364\005uq"
+	.string	"\005\001\006'\001\0204?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/flight/servos.c"
+	.string	"\004"
+	.ascii	")\"\301$\032D\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_servoConfig.64.842e9217c823b621,"e",@progbits
+	.string	"(\265/\375`\327"
+	.string	"\255\n"
+	.string	"&\022E="
+	.string	"%9\035@\236\265\336\371r\252\324"
+	.string	"\035\235;\326r\003\310\223^\001TRU\001\021n\021y\273\n\021\356\324u\353\301\355\377\367\227q\024\300\273\320\020\345*\365\377\322\211LG\262d\247\0240"
+	.string	"0"
+	.string	"8"
+	.string	"\347\021\274w\337\r\274w.m\241\205\223\001"
+	.string	"(8\266\335\255\\KI\313\323\322\377\354\002/X\3534\200bwM_0\225\233\273\355\006\333\022\366\307\366\331\242\034\213}\321\356\256\271\230}\363\247_\304\212\002\320n\312-\300\326\272\036\030\320\366\251}\231\317\2247Y/\330\215\371\320v\317\007;|\357\034\347Ye\314l\277\350\331\250\357\210\037\306L\006\001r\235\234\013\323\006\376|\345\331\344mV\tA\266\310kF\276\335\235\240!)9pyy\347\263\274w\032\246l\310Eo\001\247\320\224\022+@\223F\244\0302\226\310\252\3428\205\036\246\232\n7P\2254\222u\304`\361\2434V\225(\216\025<\367\242\345b\266\210\251\2718\023\213\302\323\bZ7\356\b\032"
+	.string	"i\221\"\023\257\373\242\341B\302u'\006\0330r"
+	.ascii	"o\023Z\002r =\357\202\025\200\034\253\344\202;\300\270W\351\320"
+	.ascii	"\325}\027\3631\246u\236e\004\363.\0014\253)\342\016/\332I\006"
+	.text
+	.section	.gnu.lto_customServoMixers_Registry.68.842e9217c823b621,"e",@progbits
+	.string	"(\265/\375 \210\365\003"
+	.string	"\004\007S"
+	.string	""
+	.string	""
+	.string	")"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\303\315\301\033\006yw\250\375\005yu"
+	.string	"\005\001\006'\001\360\0250sq\300\001o\277\001m\276\001k\275\001i\274\001g\273\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/flight/servos.c"
+	.string	"\004"
+	.ascii	"\\\005\2412\022h\2227\200\""
+	.text
+	.section	.gnu.lto_servoParams_Registry.72.842e9217c823b621,"e",@progbits
+	.string	"(\265/\375 \226=\004"
+	.string	"\224\007a"
+	.string	""
+	.string	""
+	.string	")"
+	.string	"\005\001\212\001\202\200\200\374\342\303\316\361\033\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\357\006us\305\006uq"
+	.string	"\005\001\006'\001\340*?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/flight/servos.c"
+	.string	"\004"
+	.ascii	"*\303\303,:E\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_servoParams.73.842e9217c823b621,"e",@progbits
+	.string	"(\265/\375`l\001E\017"
+	.string	"\226\336iE\360\262&\0352\323-\256\343\363\2346b\277\305\3260\232\324\021~\346a\373\3374\rk\203\177pWPpk\324\002.\007\233\206\213Y\212u6\003\317ar\006\250z\201\357V\374\2743Q,5j\322\310\336R\246\024V"
+	.string	"R"
+	.string	"V"
+	.string	"'\200=f\037\200=:e\347\2707b\377\201Hy\365\330]ME8;\364n\230\251G\250\231\362e\216\300\303M\307R=\302\317\n\313\215"
+	.string	"\254\r\320\204g\247u\327S\205\265J\210\242\345z\327EZ5\035\253\345\371a\260\273\316\216\325\341\306n\373d{\201}\025\001\006=\346\377\374\273\341\323\252\351\324\364C\260\0356\n\320\354r\350\001\2629\221\206\211\314\177\366_\367|\227C\217v\213\273H\375\263M\246b\311h>\022:vw\344\321\n\262\307\003\360!\333O\373+\316\"\365\230\f\027\260\353\202#c\327K`\221\354\321^\371\231\177\3461\266\334\301\261\313\275\363_\034\006\005\370\022\217\306\260a\357\036\375\r{T\265+\\\310w\016\341\t\301\251\312\251\037U%yq)"
+	.string	"\3345\260k\3529\230U\366\030\352\365\2577\200i\335\244\004A\311\036U\232\025\0373T_lO\225&<\334\t\253\213\003\244\217D\245\023\324V\"e\026\225l&\013\247\321\246\241 < Ep\240\225H'\0224\321i\323J\f\3304at\322P&\323I\013y{u\361e\236\315\360\310A\321U\324\027\177p\024\244\252\223#\207\252b\033\f\352c>\035\r\371\343pw\027\232\344PAz\327\341\217V\r\367!\013\031"
+	.ascii	"1\003\373\274\201[?ieQ\\\363!\n\210\305\032M\b\223\231A`\006"
+	.ascii	"\005'@\237\265V\211B\262\020\316S\2259hg\225\260fu:h\027\207"
+	.ascii	"E\224\275P\325x?\211t\256\371\004"
+	.text
+	.section	.gnu.lto_gimbalConfig_Registry.77.842e9217c823b621,"e",@progbits
+	.string	"(\265/\375 \207\365\003"
+	.string	"\004\007R"
+	.string	""
+	.string	""
+	.string	")"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\303\336\261\033\005yw\350\305\005yu"
+	.string	"\005\001\006'\001\001\0030sq\300\001o\277\001m\276\001k\275\001i\274\001g\273\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/flight/servos.c"
+	.string	"\004"
+	.ascii	"[\205H\271\t4\311\033@\021"
+	.text
+	.section	.gnu.lto_servoMixerAirplane.82.842e9217c823b621,"e",@progbits
+	.string	"(\265/\375`\005"
+	.string	"U\004"
+	.string	"\364\005\370"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\030\001\344\035\001\003\007\005\001?\202\210\2008\177}\277\001{\276\001y\274\001w\273\001u\275\001s\274\001q\273\001\005\001\006\025\001\004\035\001\006\303\001{\302\003\002\005\307\001{\306\002\004\312\001{\273\276(o3\314\0014\313\001\311\001\310\001\305\001\304\001\301\001\300\001"
+	.string	"\023"
+	.string	">\003"
+	.string	"\351\200\312\002x\332B\035\270\030\370\t\212\201\023\320^\360\211T5\257"
+	.string	",\302=\320\003\026P\301\221b\365"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_servoMixerFlyingWing.83.842e9217c823b621,"e",@progbits
+	.string	"(\265/\375 \3725\004"
+	.string	"\244\005\355"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\030\001\344\035\001\003\007\005\001?\202\210\2008\177}\277\001{\276\001y\274\001w\273\001u\275\001s\274\001q\273\001\005\001\006\025\001\004\035\303\001{\302\030\001\234\177\273\001y\306\002\276\273(o3\312\0014\311\001\310\001\307\001\305\001\304\001\301\001\300\001"
+	.string	"\022"
+	.string	">\003"
+	.string	"\350\200n\001\205\177F\025\fx\271)\323\026,"
+	.string	">I\225"
+	.ascii	"\354^\026X\204\366\200\f\b@eFJ\320\003(\002"
+	.text
+	.section	.gnu.lto_servoMixerTri.84.842e9217c823b621,"e",@progbits
+	.string	"(\265/\375 RE\002"
+	.string	"\224\003E"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\030\001\344\035\001\002\005\005\001?\202\210\2008\177}\277\001{\276\001y\274\001w\273\001u\275\001s\274\001q\273\001?\202\210\200\bo3\300\001"
+	.string	"\005"
+	.ascii	"@\006\004\2402#%\350\001\024\001"
+	.text
+	.section	.gnu.lto_servoMixerBI.85.842e9217c823b621,"e",@progbits
+	.string	"(\265/\375 \323\265\003"
+	.string	"\364\004\306"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\030\001\344\035\001\001\005\005\001?\202\210\2008\177}\277\001{\276\001y\274\001w\273\001u\275\001s\274\001q\273\001\005\001\006\025\001\003\002\302\002\234\177\004\306\305\306 o3\310\0014\307\001\304\001\303\001\301\001\300\001"
+	.string	"\020"
+	.string	">\001@\230.\307Y@\037\027\032\003*\2466\f\203\300\300'\200/\231j\017\310\200"
+	.ascii	"Tf\244\004=\200\""
+	.text
+	.section	.gnu.lto_servoMixerDual.86.842e9217c823b621,"e",@progbits
+	.string	"(\265/\375 x\245\002"
+	.string	"\304\003k"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\030\001\344\035\001\005\005\001?\202\210\2008\177}\276\001{\273\001y\274\001w\273\001u\275\001s\274\001q\273\001\004\301\001{\300\020o3\302\0014\277\001"
+	.string	"\t"
+	.string	">\003"
+	.ascii	"\0201U\016L@V\367\300\002\225\031)A\017\240\b"
+	.text
+	.section	.gnu.lto_servoMixerSingle.87.842e9217c823b621,"e",@progbits
+	.string	"(\265/\375`u"
+	.string	"\365\004"
+	.string	"rF\030#\220-4\006\177\375\257\205\277\205\377\266\265\221gf\026?\361\247|Qsw\033\027\345\254G\265\276\204\320N2\371\3457\346\314\2339w\366\034Z\364h\322%\303\246\202\342\027\243\202\200\017\033\264\002P\243\013\225\340\301\256\267\305\216q\245qs\354\0367\266\005\0229H(\023\304\272\257\323\204\327\256y\346\211\031"
+	.ascii	">\003\200tId\361\204\177L7\252\320\036\370\230Q\234\200O~Hx\331"
+	.ascii	"\021\314\002\017\355\201\217\215\036V\005\300\200\nh\017|\214"
+	.ascii	")\026\376\252\037,\240\202#\305\352\001\024\001"
+	.text
+	.section	.gnu.lto_servoMixerHeli.88.842e9217c823b621,"e",@progbits
+	.string	"(\265/\375`\235"
+	.string	"\225\005"
+	.string	"b\007\034'pO\032\003\374\374\327_\377q\333^\377\244\361\357\252*\244\237XD\321~\377\377zWH\002\005D\255\216\354\326\032I29\346\260\346\315\234;{\356\006\035z4\351\322\246Q\206S\205\305\335I\337T}\255H\217\212\300G_\255\362\"\214\013&d\262\271\301\313xklq\274\2177\235\313\276@4Dd\"I\374"
+	.string	"\326\330\352k\f\376\362\314)\001\033"
+	.string	">\001\264x\002P0"
+	.string	"\035i\312\024\261\026\024\r\034\332\300\001x\304\024\037h\031\360rS\306\223i\031"
+	.string	"y\202v\340c\200\005S\355"
+	.ascii	"\211\214\252\353W\347@\017X@\005G\212\325\003(\002"
+	.text
+	.section	.gnu.lto_servoMixerGimbal.89.842e9217c823b621,"e",@progbits
+	.string	"(\265/\375 \177\315\002"
+	.string	"$\004r"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\030\001\344\375\035\001\r\001\005\001?\202\210\2008\177}\300\001{\277\001y\276\001w\273\001u\275\001s\274\001q\273\001\f\273\001{\302?\202\210\200\020o3\303\0014\301\001"
+	.string	"\t"
+	.string	""
+	.string	"\021\250\253Q\347\206\352QY\007pP\231\221\022\364"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_servoMixers.90.842e9217c823b621,"e",@progbits
+	.string	"(\265/\375`T\002u\f"
+	.string	"t\022\037\003"
+	.string	""
+	.string	")"
+	.string	"\005\001\006\177\001\035?\202\210\200\020}{\274\001y\273\001\005\001\006\025\001\032\031\030\027\026\005\001\212\001\206\200\200\374\342\303\304\243\017wu\b\310\001y\307\025\270\304\203\017sq\002\314\001y\313\024\023\022\021\020\234\236\354\027om\t\330\001y\327\017\375\302\017ki\005\334\001y\333\016\r\f\013\n\t\274\236\260\227~kg\334\001y\351\001\007\006\244\227zse\314\001y\357\005\364\342\rca\004\363\001y\362\004\003\002\364\226o_]\001\373\001y\372\330\003[3\375\0014\374\001\371\001\370\001\367\001\366\001\365\001\364\001\361\001\360\001\356\001\355\001\354\001\353\0015\352\001\350\001\347\001\346\001\345\001\344\001\343\001\342\001\341\001\340\001\337\001\336\001\335\001\332\001\331\001\326\001\325\001\324\001\323\001\322\001\321\001\320\001\317\001\316\001\315\001\312\001\311\001\306\001\305\001\304\001\303\001\302\001\301\001\300\001\277\001\276\001\275\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/flight/servos.c"
+	.ascii	"3 @#\031\221\033M\022\200)/\210M\\.\334\016\265\025,\021\351"
+	.ascii	"\036\244\\\f\2757\302\"\0349[\221\005\273$\332\262Ap\321\314"
+	.ascii	"\262\355\301\354\346\023\226\210\344$l\022\203\226\373\241#\204"
+	.ascii	"\031\351\302\366\003\316$\271\ts\"%\351\032d\312]zT\223\257A"
+	.ascii	"/W\177\330\311%\354\022\341d(!2\350a\025\001"
+	.text
+	.section	.gnu.lto_determineServoMiddleOrForwardFromChannel.91.842e9217c823b621,"e",@progbits
+	.string	"(\265/\375`[\002\r\024"
+	.string	"V\245\205I\260\324Q:xS#\337)\374\315\253Kd[\036\322\021\254\367!\302s\364\372D\345hL\337\f\275\314\234\325\262\337\354$y\355\036\367k\333\352I\3047\317\035<\374\350\235A|\030\203\273\023\034\037\310|\251\331\222O6\221;\245o"
+	.string	"h"
+	.string	"t"
+	.string	"\366}\237q\373O\203[\265\242(s\324\372C`\224\361\324@h\333\227q\244\233q\363\227\342\203X$\242g\351H\255\025\006\340'\342\351|"
+	.ascii	"\361t\213\216\273H\303\2358\237\303\305\003\305p\2420GW;\036"
+	.ascii	"\320C\023\036\317\213\26737<\231\032\2422\341\361\204(BR!\016"
+	.ascii	"\374\364\341\351\346d\265\324Z=w<\0207\353\266i\266g\366\314"
+	.ascii	"\005\247>\271W\022\342\023\367{\340\351\213\243\037=Kr\263\264"
+	.ascii	"\177\272\271=\373[\226e\351%\262\313\323\255'\335\343\177\277"
+	.ascii	"\350iJ\247C\326\364\212\323\223N\377e\0025\245 \252V\017\245"
+	.ascii	"\222\n\204\006Y<\351\267\377\032jr\316\225\274@\250\327\264o"
+	.ascii	">\320/'P\271=Ig\254-XLAH\024\251\365w\340\324*\343\234\001\177"
+	.ascii	"z\360A\204\227\027\361\264\265\255\340\270\341\302\034]\271\252"
+	.ascii	"j(\030n\317\343\356\316%@\037\266\204;M\030k\255+~\323qP\250"
+	.ascii	"\020\233\337\305\366R*|\271Y~>YM\231\330\355\271\274\2168\356"
+	.ascii	"\200\240+\340\220\235\231\304s\307\235=,;\323l;\004Q\t!\325\272"
+	.ascii	"\263r\032\366\206\337\220\231\005N\\\351F \325ZYj\334\306\214"
+	.ascii	"ot\352\0135\363\273\246\325\2206\227\030[,\307F\272\220\020h"
+	.ascii	"f\265Z\214&\023\220a\026S[\340\262,\305\206\304\261\315l`74\231"
+	.ascii	"\031\032\013\260\332L\254\006&\263\331\300R\b\230\3040\263\301"
+	.ascii	"nH\322\006{\375r\017\353\022y\032Y\tQ\327\036\370\026\f#D\302"
+	.ascii	"\326\322\365\261M\327-\271\325\205\265\326*n\317\r\036\345\200"
+	.ascii	"A\t\242%\036;\\\333r\001\205\304\367\363#\265\202n\3178\327\201"
+	.ascii	"cq+ `\002\031Ch\036~\261#\215\350\277\342\305R\202t89\301n\311"
+	.ascii	"h\211\275{\260\322t\240|a\023\226\031\343\314\311\241\261\206"
+	.ascii	"\332\236&\343%\333\205?Z>\230\236B&\032\262\317\356\025w\022"
+	.ascii	"\006\273\377\330Coo7j\007\016\330\rhsw,\202Y#\247\344;!\310\006"
+	.ascii	"\245uD\233\200\326\305\no\274Qm\025\024"
+	.text
+	.section	.gnu.lto_servoDirection.92.842e9217c823b621,"e",@progbits
+	.string	"(\265/\375`<\001\255\r"
+	.string	"\246\232]C"
+	.string	"\221(\035\233y\355\355\3560\320M\361ej\2405\331\263\226\214vb2~H\353\b\364\350T\270\374!\307\215\277\215\325X\363\242h>\n\250\240\213\315\247\377\302\306\240\023D\326\327V(g\266\221\275\245L)G"
+	.string	"D"
+	.string	"O"
+	.string	"\0064\217\266}\226\253Jv\013~*\274\253\254\240\\`vW\373\270"
+	.string	"\354\021>"
+	.string	"\366\250*/\035j\226\374\222\303\007,\256\224'\342\352\341u\360cw\317z\232x\247\314L\310\356:S\036\210;\3366\003\333\021\354\237\004\371\262\277.5\305>\334\335\265\242\330\377~\315W\177\346\351\250i\250i}:5\375\215\007L\215\0057v?\274b\226F\224\261\302\034\336\302\032\302\225\335.\331\231\375\315@\360\374\312-ovQ\260\210\261\273\007\034\376`P'\264\3308e\016\253^\241b-\324\210._NU=j\207FA\236\212\351\350\020\323\371\302a\2144 \241*\241\332=%x\213\035\372\213-\t\234x\351<\250vW\201\213\273d\360W\036-\"\345S$\330\343\365\254\027\350\\8V\246\026\361t8\322\006aD\n\201>\331\006\017\005\220\003"
+	.string	"\356pD\233\006\316#\322F\"\026>\030*h\240\217\204\021\255\303\2114\316"
+	.string	"o!\017\247\215\266\215\323\262\317t\270\212b\222\024\n\362\263\2761\361r\222\234G5\261\035\325!&\355\240\246\344\356\226h\027"
+	.ascii	"\255\262+-)I\304\273vC\006\331\272\2115\364\330\n,m\037\027\353"
+	.ascii	"\343\204}l\266\266\274u\335\205[\013\213b\260\r\f\003Y\300\334"
+	.ascii	"\240\002\026@\345#U9\243.nm\321\003"
+	.text
+	.section	.gnu.lto_servosInit.93.842e9217c823b621,"e",@progbits
+	.string	"(\265/\375`\334\002e\026"
+	.string	"f\351\217J\300\324M:X%\230\237mkME\373\031O\217\0208\324\035Y\241]\243\271%hI\214\274\343\364\361\310\311\302=\372\234a\017k\357\345\376\374y\224*iQd\272\251\035\241\270}$nF\2474V\356\rD\023i\204l\271S\n|"
+	.string	"v"
+	.string	"}"
+	.ascii	"\340I\323\354\253\373\224\352\241z?OFj\255\256-a\361\324w\223"
+	.ascii	"\223v\223Q$\303\026\335I\363w\037\313\\\355&.\"\210\216>V\r\035"
+	.ascii	"}w\227\024C\037\246H[ACV\257\0322\242\257 @\216\336\303M\362"
+	.ascii	"$\210\220\036N\244\267\212NQr?\264\245\326J\346ns\251\212\220"
+	.ascii	"\211\022%g\243/XRE\276\373\004\312\335\346l-\250\265z\2269\242"
+	.ascii	"\373\344\266\237l\303\330\363\027:,J\265\336^N\177\001\243_:"
+	.ascii	"h\013"
+	.string	";\341Nxp\356\330\273\357.b\376\2225\314\346\313\203\376,<\370%m>\216\030\371\314,\333W\233\253\263\377\n\202c\362&\331+\344y\367\bN\213t:\004\247Ap\232\322\351\335\3519\247\317\222\322\353\221 \253V\241,%\365\007\3368q\336\355\267\360{&\r\034\240\235\327#V\246\326\f(\035X\265\372`\016\372E|\017\f\241\246&<\250\2424n\270\nxQ\273PAG\244\302\325y\356\245\376\336i\022\034\365{Br\201\374\226cn\003\034a\265b\210\253)G\rz\032\007w\252\260\257Vp\217\"\304mk\007P\305\343iW\347o\b\351\3368\375\270M$\0160[\036!\264%L\230/\351\236D\025\375n[\363\256\037\3432Le\343\251\371\322SDJ!sw\377\263\3048\207\221\023\203\300v\207?\005\260\033Gf\026\343 \313\231\271x*\350\300.Ppa\200\331\354\270pd3\227\314"
+	.ascii	"\3072\344\310\\<\261\230\314E\372\3527\3113M?\237\265\231\020"
+	.ascii	"\2306\203\006\363\245O\242v\243\2707\002\246\355`f\276\024\367"
+	.ascii	"\273\337C\024\213\237mk\342\352\374\336\013\034\205+k\332\"w"
+	.ascii	"\\ \361W\377i]\335{\302qW\366D<(\034\b\333\3142\271\3434\241"
+	.ascii	"m\331\251hR\224j\255/\037\307\247\002: @\002\203\214\241y\362"
+	.ascii	"\201\365#}\266,\3275\360\275u\013#\276\013A8D\0207\324\0243?"
+	.ascii	"\256\343\260\300n\355-\213%\303*2\025-\252\204^\333\252#\314"
+	.ascii	"C\204\f\022&\214qp\027\020\215\200\303-\2153\231\217X\341\020"
+	.ascii	"\237\231B)\353\0011\321R\207c\217\375\351\n@S\f\366\213\rg\321"
+	.ascii	"=U\327[Q\210\205\266\216\251e<W\364\314t\\p\267\005\203\027\032"
+	.ascii	"e\315\214\264o,7g\033\004 \362u\215\336\245\240"
+	.text
+	.section	.gnu.lto_loadCustomServoMixer.94.842e9217c823b621,"e",@progbits
+	.string	"(\265/\375`c\002%\023"
+	.string	"\026\344~I\320\362&\035V\230\fY\2731g\r\215>\375U\354\021cc\221\265\033RjHN\367&\202v.\233\202\020\326\314\332\366E\213\344keY%e8\234z\030\245tm\257\004\327\201_{$:\r\361\005\307\323\006\331[\356\224\002h"
+	.string	"e"
+	.string	"p"
+	.ascii	"\006>\300;\235\027\340\235\312\317/\033\307E\235\372QI\003\220"
+	.ascii	"S\255\025\334\034\003\370\024o*_\367\350\\\371\362}~ \305X\013"
+	.ascii	"a\367\346&\031\211\030\ti\023\305\226C\343\342eL(\223\224\247"
+	.ascii	"\346s\242\340zF\214\204\263\271?c\321\027\322"
+	.string	"\344^<\211n\254\2055\227 \fj\255\226\265\220\303\rr\3330\333\rl)\023wy>\212\003\271\374\035_\200\221\257\235\3720\336)\335\361\350\331\021\223Q\266(\223\213c\377$\210V\303{c\177\327\335s\245w\245\245\224\276H\200\231\244\005E\265\312D\371\250Ht\210\304u\277\375}\001\325\223\341'\034B\363\343\263\177\363E\177\247\307=\367\272\316D)\330Lj\034\235\230j\255%\247&I\235\006ED*\005t``\320\345\210\0011\362\364\3700\027\307)\336\267\265S\232\311'\333\017\356\"\305\201\315\r\333\255\326\231\202\357\354\227\267P\001\311m\b!\343Vk=\t\272\320\n\213w\372\275x\0044P%r\233\324\204\323\261\026\221f\272\217\274\222\377v\026\253\021\235Zc\257\371*\276B\345\357\234Z\302j\345\235\332,\013\3625K\241#$\332\302\354nQ\335+&.\326K\213\305\005\272\264DPM\200"
+	.ascii	"RP\251\254\300\225\226\0134!`V\005\226\026\350\302b\265\300O"
+	.ascii	"\214}o\356\363\324P\210\024[\231\roq\034bb~\273K\262\344scL\344"
+	.ascii	"\315}n\2674\223O\237\265\326J\023|\356\267\357\240\033wg\274"
+	.ascii	"\326t\227'w\3674\233LF9\206\\\320\306\311\206\363\020\223Q\376"
+	.ascii	"\217Q+ p\002\241\262\234\007\n\262\"f\315M\234\277\267\343\335"
+	.ascii	"$\004\323\374\213\342\301E\314\203\005L\231\335\207V\254\027"
+	.ascii	"\212X\261\347cq\301\001\354\240\335\310\333\300\255\313J\352"
+	.ascii	"\2654g\016\247\230\301\235\205GD\325S)\215\360\326)\241\276k"
+	.ascii	"\200\245+\031<\303\321R\260Z\371B\344\231Q^@\0138\306D\f\211"
+	.ascii	"\316\325\311"
+	.text
+	.section	.gnu.lto_servoConfigureOutput.95.842e9217c823b621,"e",@progbits
+	.string	"(\265/\375`\237\004\335\035"
+	.string	"\206u\273H\220\332M:\200\2000\343\365\205r(\232k\207X\360\370\317\237\236\031\235\300H\013`\372\354\350\271Yo~\350\177\356\0041\215-\007\306\270}\023b#d\022#\021\223)n\334\25715\017\361\366\267\2655#v\357-e\222\001\250"
+	.string	"\227"
+	.string	"\250"
+	.ascii	"\237\007~C?\345\003\320\317\343\226h\327\313\211S\365^A"
+	.string	"\340\226\231Zk\257{,\357\222\370\235L\364\034\356f\033ktJ]3\321\2766\301\026\024\026=\207\273\3017\004;\232\242n\223\017\220\314D\375\nS\224\314\241\001\261\274\212\311\006\217rA\216*N\277\302\004%o\310xtym'\004>1\2255\244% ;a\222\334A;\373:\361\210\347MH\215\313\261\306u2\200\215&Y\030d\031\002\365\253#\250b\302\301M<\323\020&\311\003\265\326_\235\225\204?\346\332\204Z\353rP\330\364\335}\367\272\335\325\331\225\"\002\263\333\206\365\255s\005\261\360\371\350'\267N\f\327\231\205R\004IY\377}B\313\354\210\321v\237\344Z+eO\265/\266\310\017~\356\267\330\355\304e\365d\304i\273\304\"\356\341\356\257c\314/\312\266\324.\363\346\340<\353\313k^\233\346\3355\257\256ys\224\027Gyo\224\327v\336Q\362\326&/\235\274S\362\312\346m\346\345\363\276"
+	.string	""
+	.string	"2d\030\304j]JKS\307\346W\220g\375\273F\366\304\305\375\310\261\210\236\265R\306\"\246\221\211\327\322Y\255U\347s\027\214\001\323L\247s^+\365\330\024\254t\217\335j.k\255u\366pw\031\234\3278\375\242\222\264\244\034\277\242\013\rwr\252\335%q*\033\022L\325Zw\366S\016\306a;|\340\007?\214Q\202\242-\273\326O\"R\373\206\321\331\264\237T\365\343\264\345\365\354\023o\201\210W\027p\215\021\247uw\201!5\311\036\356\2773\205v\246{\b*[hA\374+D\203\251(>\004\246\240\310\306IuYau\357\235\374\t\217\210\036\356\331\n\206\331\022gbBB\204\335\225\361%>\n\266\324z\264\243\344^?\362T\237\233\002\210\002\321\007@_\037\007C\276\030B?C=\030*R"
+	.ascii	"\255@\321k\001d\202E\317Gh\250\347`\300\372\\\374\b\365`\370"
+	.ascii	"|B=\034\261\276\245\326C\2311\243\376\345\300\334\304\302\304"
+	.ascii	"p=\\\001\017\242Y6f\377r\036\272k\233>\360I\313\256g\021\314"
+	.ascii	"\n\302\f\243#7\003\274[\341\002?\270\273/\260\261_\027\335\224"
+	.ascii	"-5\261\365P\3549M`\370C\327X\036\f\303{\001\232k\035\031O\206"
+	.ascii	"\236\\\317b\361\314\223\021\247q\331R\3444\346\214\220B\243U"
+	.ascii	"v\304h\265\017Q\334\255m\215\353\003\235v\267\361A4\247m}\340"
+	.ascii	"\327/,\247\177u\0351O\316\320\036\256\316\207\304\351_\250a<"
+	.ascii	"\304\020c\210H\002\031\205IRh1\200\002\031\"\273\016\021\240"
+	.ascii	"5UC\323be\fcn\211\327*P\206>\225\210\345\346u-)\016W\213n\252"
+	.ascii	"A\332\007\254\233\317\021\356@\371\350*%\335Z=k\030\017\306\030"
+	.ascii	"\221\367\236!\215\251\371\001u\237A\335/P\311#E+A\223\213\343"
+	.ascii	"\244\207\301\373\322)49O\002\213 Ux\021\204\277\01776\001\325"
+	.ascii	"\222\3213\204\"!))L\304u\360\370\352\333=\036\332=\276\351\226"
+	.ascii	"\257B \307l.\346\315[\301q\f\354\275 x\020\rM}j\304\310\204\001"
+	.ascii	"W\032e\301K\377\276'L\024\033'\235o\302<3\021\221eZ\3704\267"
+	.ascii	"W\252g9\034\261\227V\003\222\322m\356\213\370\017"
+	.text
+	.section	.gnu.lto_servoMixerLoadMix.96.842e9217c823b621,"e",@progbits
+	.string	"(\265/\375`.\004=\032"
+	.string	"v\257\245E\240\\M:\002\352y\272\021\257\337\305\265f\261\323\373\257[\353\0360G';\315.\316\205\251sPjth\345.+\362\346B\244x\347h\230\203e-\340@m\271\254\264\3531\360\002\377b\261=\022\262\367\226;\245\214"
+	.string	"\212"
+	.string	"\227"
+	.string	"\363e\373\321\276\356Lh\337\271\312<\265\362\320Y\251\265\006\231A\370\211\340\004\350\247\374"
+	.ascii	"\372i\232\315\346<\247\372\251\035\022\024\235Z+l}P\013\270\344"
+	.ascii	"\335ri\007\351\f\345F\232\337\344\n\246T\271\341d\034\224\340"
+	.ascii	"\f\033B\002\340\220$\205\2556T\227\232\021)\200\"K\237\341\322"
+	.ascii	"C\271W\\x\234\214R\016Y!\347C\314{\217I8[\224Ep|\337;\003\337"
+	.ascii	"\230\033\016\307#x\241\326\352x\303\335\270yn\033\211m\r\266"
+	.ascii	"L\020\323/\242\237\357]v1\203\225$Nm\257\3360q\263n\360\327\366"
+	.ascii	",\004_\225\243\234-v\331<[\334&\373\007h\364\224\274L\366\217"
+	.ascii	"\317ww\317w\377\353Qw\370\247\033|4\235\321s\243\245\214^\031"
+	.ascii	"\0357\372\004\006\030\271\302\320U\253\215.\256j5\251\206<\352"
+	.ascii	"\177r\214Oy\231\262\350HQ\351\371Mp\272\231_\214;1\207,XIj\255"
+	.ascii	"/\373<\277\347\327\247\355'W\2052\224\302\250))mj\255@\237~\020"
+	.ascii	"~\006\022l\2338\231\017\021~\265\032Y\375\n\204\f!\202\212\330"
+	.ascii	"K\035\306\224UgW\213]{8Q\224\324\231\333\344\207\313d\236%\373"
+	.ascii	"\263\253\025\201\016n\222\200\273\212\202\373\235\023-\243\270"
+	.ascii	"uYk\255\022\334\237\375\222o\314\273\334\036\3610\262\fQ`\276"
+	.ascii	"\3203\006\250M\342\\d\373\003\312\026-\005\354\334\336\304\250"
+	.ascii	"-t,\261\345\202\242\272\022\241~qj\227Q\373\304\251\310\246T"
+	.ascii	"\017\"9\t\177b\263\370\224\024/ 5vh\351j\255\024\244\334\267"
+	.ascii	"\302\017\362\351Y\213\370\333\003F!;\214X\211!\331\264\220\203"
+	.ascii	"\242\331\013\242X\021\314\005\212\0232\025&`C2\022+`BDE0\007"
+	.ascii	"\005<c\021#\202\271\230\315\210`/^\355M\036b9bU[\033\270M\366"
+	.ascii	"\3612}v\265B\240\207\341R1Fq\313s\351^\303\327l\b\372\251\371"
+	.ascii	"\260\300)\315\334 4\021\267\205\353F\303\365\331o\371\346\034"
+	.ascii	"\345lh^p0\255\207.\247\013\342{\210b\017=\013K\312I\322Q\213"
+	.ascii	"]\336\375\312\375\021\022\360\376B\343\356\376\310H\270qA;Hw"
+	.ascii	"\334\341e<Xp\252\325(P\250q8\204\224Q\002c\024\021\221\231\231"
+	.ascii	"-L\007\320\002\231\242\255\003\021\2205Cd\264\304Zk\fpV\305>"
+	.ascii	"\235N\330\347\202\020\023\200\007#\222$\214\325*4Y\02113\032"
+	.ascii	"z\354Z\037\320\354L]\353D\rXcN\224rq\231\343\310\351\017\271"
+	.ascii	"\263\363\007\341\360F\357\306\264\201\304\364\270\016\353\215"
+	.ascii	"\0356\342\273 T=\277\035\323Ix\222\330\325\377\302\210\312+\364"
+	.ascii	"r\036\363\313\260j\300\362j|aA\216\032\362\316?\224\2624\210"
+	.ascii	"h\211\273\350\302\347\3348\332\\\376\340 L\240\353{H4X9\201\301"
+	.ascii	"\273\2014MM*\346\263\357\204\236\n"
+	.text
+	.section	.gnu.lto_forwardAuxChannelsToServos.97.842e9217c823b621,"e",@progbits
+	.string	"(\265/\375`T\002e\024"
+	.string	"F\250\213J\320\322(\035S\341F*CL\372\267\r\236\260>\221,\020\340\020VZ8\324\bh\345\031\223S\233s\363\331\335\362\333\272\243\036\3762\330XFM\264\330\034\314\221\243\205\031\200\344w`\327D\365,2\201\207i\2154\262\211\334)\005s"
+	.string	"n"
+	.string	"u"
+	.ascii	"(\247V0\236\232<\200x\032\276D<\265=\247m\340\200\355A\033\274"
+	.ascii	"\265\356\360\210QkY\300'\343\251m\366\322K\237z\372\241\241["
+	.ascii	"\021\244\326\312Z\021V=,\357p\332N\303\2356\177\350\004\214\222"
+	.ascii	"v<\232\323\360\224\303!\241\342\345\302\025&\340\321{\2377<\334"
+	.ascii	"\fM\344|\337\373\311/\270\343\345|\236\030\324Z=w\274\017\267"
+	.ascii	"x\3331\333-\366\324\005\363\273S\177F<\375\242r\374@!t\233A\273"
+	.ascii	"\304\315\355\261\277\342\303\004\364\362"
+	.string	"\330\253\007\375$#\252\023\335\344\313;%N\243\304\351Q\234>\315iq\247\351N\207tz\303\351\271\323/)\231\201#\302\216Zq\202B\252\022=*q\242\277\374\264o_\205\337#\362\265\270\361`<\375\207L\372BOa{i\244\221\306\303X\364c\003Xk\r\247\2455t@\270\031|Xk\255a\312\311]\255\b\374\005WsW\\[\302\204\371\235MrKc\272\"\311\206K\367&7\334p\210\256i\356\356\1776@W8\f\227\261\326\272\342\273\370\213\226\353\345E<\235\273\340\347\3506\203NyjG\366\275;8a\344\263\331\301\315\340\256/)\307\333\355Y\325\376\247k2\354,,\214\265\326 \360\213\356\223\361G\234Z6\0235\027\355\365b!k.\332\353\305\022\343\212\305\\`Z\"\031\\\024b\020Zj\264\031\3545\342\226\nM\206a\346\242\261j0/\260\230\027+\006s\221a\265f4\226\312"
+	.string	"\313.\270f\254\232L6c\221\345\355\313c\031HJ\267\305\321\355q\202\335\256V\203N\323D9\2717\357\375\034z\204\3500\364Q\207\316\322Tmjol\232\210\332\006>j&\223\307=-jE :\020"
+	.ascii	"R;\256\200!: \221\033I$7' \200\002)3\363\326\302^\024I4\307%"
+	.ascii	"\021\013\363\330\342Xj<7\224x\301\213K\013~\036\253QN\\\344y"
+	.ascii	"4\302\312p\276sX\356s,\016\f\317\371\232\030O\313L\3107\250J"
+	.ascii	"\275\004DC\24060\034\321\030\315\2443\203\f\206\t\356%)\302\266"
+	.ascii	"P\215\337\203H\347ZO"
+	.text
+	.section	.gnu.lto_updateGimbalServos.98.842e9217c823b621,"e",@progbits
+	.string	"(\265/\375`\312"
+	.string	"\025\013"
+	.string	"\206\025L= O\234\016\243[\237s"
+	.string	"p\244\222.\310t0B.\220\"\254%$\351\016EQ\023\350\365Us\243\362rwV\306\027"
+	.string	"\240\206H\301\311\023@\266\240"
+	.string	"\202\022\332?\033\t\331[\312\224\0029"
+	.string	"6"
+	.string	"9"
+	.string	"6p\200\273(c\335\005\2410\261\353Y&\340x4g\263\270\327a)\017+<#\030\273{)\207sO\316\277\210W\335G\363\244\024\354\256\263\373h\270\365\266\007\330N`\337A\327\307\211\027!H\233\374lO\223\272\301>\\\r\331\027\375U\246\251\230\236`:j\032fZa:5}\b\200\r\025\fZ\354f\370dl)\222@\330\376\303v\246\003\035\020'?C\215\326G%`\f\022$SUmLB\276\263"
+	.string	"\f\252q\245\252\367\314\270\246Z\235\215M~\005N\302\342\330]\004\376\210{\231\377\341\321\025\266|\367\350o\323c\027(\017.\013$\230M\303*\032\236D\266\314\202F\331.L\004\b\330\204\312u\301\032X\256\211\266]\221"
+	.string	"\316(P\264\013\223e\332\365\360\366p5d\211\213\322F9\206dTjRJ\255g\246J'\205)\002\022"
+	.ascii	"\227\031e&\236\031\205\313\274\200\202|\314\340,\210\016`\261"
+	.ascii	"B.\027\030\033\324\016\327v8\231\005]\310\263b,T\251q\340\316"
+	.ascii	"-\332\371\004"
+	.text
+	.section	.gnu.lto_writeServos.99.842e9217c823b621,"e",@progbits
+	.string	"(\265/\375`*\r\2759"
+	.string	"Ja\364\024AP\246N\007\013\324\270vN\001\373\244\277\377~\n+\365f\232ok\334\341J\007\2476\3517|\201\304\346|\020\370\211h\"\232H\200\002:%"
+	.ascii	"Q\360\364\206*\261\234\007\202,\215\206\220-eJ)\005F\001\034"
+	.ascii	"\001>\001\367\372x*\272t\026.J{\351\346\322\255\245\237\271\277"
+	.ascii	" \227\303\273D\333\243\306\275\205\273K\267\265\033Ws\341\270"
+	.ascii	"\237\022\354W\306\314Z\336\275\267\301\257-\262\213h\333\332"
+	.ascii	"Jh[o6NyA\003\256\326\262\365\273j>1h\314\274{\335\222mY\352\327"
+	.ascii	"\226\213\331\331nf\267\311,\312\001\346\320\275\327\352\233\240"
+	.ascii	"(\032\344\332\325\255\231\370\\\335\304T\\RJ\"\016\221\204G\301"
+	.ascii	"\024h\364\363\241\266\276\361\350\\\334\004\364\030b\206)\273"
+	.ascii	")J3EI\363b\231\030\224^\252Rdr\200t\035\030\224Z\264\243\304"
+	.ascii	"O+u\035\030\332\023O\252\301;*D\030\f9s\327_\314\234\b\305D\314"
+	.ascii	"I\017\351 \371\256\336H)\023;ka\262\214\224\243j$\266\206K\327"
+	.ascii	"\201\235U\007xim\335\245\241\246\200\025\361 \0231#\235\002}"
+	.ascii	"Wl]\001\r\n\24021\"m\364\353\256\263\366\241\025Y\0076V\221\367"
+	.ascii	"\3364\f\207[\337\225\220\256U*oM!a\330\215Z\364\221\306l\266"
+	.ascii	"\366\257\260\245\277\2216"
+	.string	"\272\223>\256!!\3032\344\b0\314\013\375\335{\273\f\354\354\347\276\253{/;3L\254\331\251\231{\217\231\0350\247|\002\037\327m\374&\235\346+\245/\342nv\273\367\036\031\017;m\230cc\241u\354\264sn\214\215\205\326\341\246c\247\035T\224\303=g)\316\033n8Hg\344\270\347\330i\345\214\t\331p\267\371\235\251\341^S\333\324n\2227n4\354\374uc\241m\331\231\367\213G\224\031fvZCn\356U6\2313oT\275E|\217\271\3074\031,\356'\234b\2057\263-\367\n\264m\277\005\363f\254\313\237-\230\300\200\316\374\"\313\233\311\316\346I\347\365Jf7\245\177\223\271\377\371|>\371\2270k\230 !\002\004\324\371A{i\256j.\315TSI\251\326\322\034\345sV\360\316\t|\316\b\334\371\300;\033\3609\027\260\316\004\2523\224uFV\347\001\326Y@u~\262\316\001\2523"
+	.ascii	"\353\354T\235\217\326\331X\235\233\2543Su.Z\347\245\352\254d"
+	.ascii	"\235\223\2523\321\347<\264\316H\325Yh\235\217\252s\320:\247\325"
+	.ascii	"\031h\235\215\252\363\017u\266\326\271V\347\177gw\347\346\340"
+	.ascii	"d\304\316\006C\001\305g\232r \376\243\370i\363\316M\373\334\020"
+	.ascii	"\341\322O)\375\222\036\007\363\241\244\007\327\225\364I\342'"
+	.ascii	"9\217/\342\247M<kpi\200r\317\243o2\022\221t\302\267\223+dF\377"
+	.ascii	"\252r%-\225\360#$%\315"
+	.string	"\310_?*\240\225\3766\347\335\235\340TS\375\204\357@q\322\340 \363B\372\341G\375\360\033/\307^o\241Q/\341+\036\0162\341#}\343q-q/\357\022~w\351\244\335\234\367\247\363\016O\372\315n\267\243\237\n\376\321\367\333\242~\356\325\340\247M\2715\243\247\300O\277\337\252\032\221\036\360\323f\234\036\\\303\265\313\305\031q\032f\366\002LZ\350n\274\362\3473\372\275\321\373\333 A\277?j\242\301b\226\b}B\037|\263\265QY\367\023j\377\301\263\347\030\363\362's;\373\317\026\206\f\031\336g\367\2467f\215^?\331\314\034: o\274\222\377\3537\036\216\274.\177\352\351>\036~\367^\b\334{\232\017\b\356'mY\004\t\022h[\333\034\207\266\375O\355\316\254\301u\371\263\332@\375\265\274\360Y:\"&:s\t\023\336L\177\241\334\221>\323\315\326\037\306\350\224\276(-\272F\n\0240."
+	.string	"\031\253JF\026\r\255\0242\254f\260X\321\302\205\n+\030-L\274\260\302\322\222aU\005\200\263b\244\320\262\232\221\225\245e\225\272\335\376%#\216\320u\275W\023\224+\3102\365\n~\201\236:m\206(O\r\3237YJ\233sI\303sUJ\376T\002v\2737\301\007\341\004\241\253\305oN\351\344k\370\020u\f9\202g\346j\223\260|%'\037\301/\250\363'\307\236\0371\263H\314\3227\3316\026z\340\335\212\227=KG\344U\016X\005\331[\363\271\033>\324\224*Q\352\275\231\245\207\260\366\026\352\256\243\271\006\243\336\233U\320"
+	.string	"\275\267P\267\243\202\306\347\313N\376\327]\033\370\023\002\034\331\024Pf\013\027\274\231\006\232\307\234\036\335\262L'}\223\0310\207\021\276\235\260\221\035\251\272\352\277\252\260\245\r!\034]GK\375\227\257\n\210\310\333\236\317B\304\252\217\360\250\032\035\002_@\352\013\370\262\245\036\002\324\023(\363'hP\337_:iG\250\237\317'\241!r\300#\315\232\f\020\360\364\002\226(y\372\264\351\\\213\323>w\005)\300S\001\370"
+	.string	"U\236\004\t\200O\233~\234\336w\034\337\311\231n\244\310\321\330\364F*\037\023\322\364i3\017S\201\005\250a<D\025rfDDD\222$Ik\241\005\304(\306\244\263\r\021"
+	.ascii	"%c\f92rZ(\354\261\033i\246F\365\312\004\375\324\241\343\266n"
+	.ascii	"\354G\001\201\022v\225\"\332\004\345[j\001\255/\236\371\276z"
+	.ascii	"\030(\030Y\352\253\202\317\363A\333\345\005\236\"E\265\215\263"
+	.ascii	"\310\363\272!\343\342\013,\251I\342\356?]\362Y\347\252\340\370"
+	.ascii	"\324\200\306(!30\307\366\304\276Z\224\241\332X\216\036\201\002"
+	.ascii	"\217\303\333\264\331\206\261 +\317\264\367\215wK\2576\033\026"
+	.ascii	"N\031\317\224,\002 \374\220\217\216\313o\027\300\270\227m\364"
+	.ascii	"\315\305s\200\021\233\217\005I/\313nz0\254\223o\245\f\257\203"
+	.ascii	"\3751!#l\260\240"
+	.string	"\006$xx\245e2\370\346\033\327\316m\272'\262\022\242\201\307\276\026\030mi\242\030\004S\321&&\240g\350\211\354;+q\301r\266\n\313\201\326\007\030\353\225\035\357\227\263\220\340\244D\311\225\fo\373\363\336\245\017\364t\241NA\230F\224lT1\031\216;\307y\303p\033\003\310\013\036Z\317\353\224\262C\355^\033\016]Q^Yv,\344V{F\374\275\241\024y\363\374\bt\332\345!\365\223\326\357\3029\300\b0\336\\\2075O\247\007\234`\200\023\341t\230\372S\322\251\27047\354\241Eu\364\356!kt\347\264\030=\365\335\342\013\3033#\201\005\253r}/~\342\273\r\277\236\341\0208\212\022\256\320.\207\227>F\316\002\036\033\252q\253\356\304\2366\017l\324+\276\002\314\321\322v\220\360yY(\276\221\351\324\332\375d[\271\200\fZ\251\253\200\314j\205\365\253(\310\250\364\244\263TO\324\256\032\206_"
+	.ascii	"?A\275\222Bu\004>\203V\340\274A\375\300\200\020\bS\222\231@\310"
+	.ascii	"d\020%\316\364$0\021v$\265\212\r\035^5,\003(:\230\021)\026\230"
+	.ascii	"\221\250\001"
+	.text
+	.section	.gnu.lto_servoMixer.100.842e9217c823b621,"e",@progbits
+	.string	"(\265/\375`O\036\375\204"
+	.string	"Z\334 0H\020PKg8\307\266\320\371ik\3372\364\246\233\277T\335\2672\227\007\325)M\277\004\215\365\207\304\201\b\003\206\253:\341\304TM[\276\2470~\214\037\263\302\2640.x=8\327\207=\375\3776\233\246'\"\"$I)\003\344\002\272\002\021\003\275\004${\007H\366\n\240\366\"\251\275G\311\336\035\311^\035jo\016\265\027G\262\367\306\2617\200d\257\r\265\027"
+	.ascii	"\265\267\006\262\227\006\262w\206\332+#\355\215\221\366\032\251"
+	.ascii	"\275Ej/\214\264\367E\332K\244\366\016\251\275.\222\275-\222\275"
+	.ascii	",\322\336\025\307^\025i\257\220\332\033\324\323\013\244\366\376"
+	.ascii	" {}\220\275I\265\267\007\331\253\"{\221jo\212\354=\"{S\250\275"
+	.ascii	"FdoQ\355%\"{\207j\257\020\331\033L{\237\366\366\261\227\271\r"
+	.ascii	"\306\034\033\245\267u\215\022\230g\265\023\302ua<\346:\3466f"
+	.ascii	"7\3467\346$\230\3170\213aN\343\024\315P>\356\362\021\213\033"
+	.ascii	"\0367\373\264\2706\214\267\234\347\304\022\263Y!]\334\322\262"
+	.ascii	"\023{\\\342&\230\312\344Y\341\240\310f\211yqvo=\3605\340f\t\313"
+	.ascii	"\255Q\f`\232\343\223Ml]W^\202\321\354\036W\t\313m\017\235\222"
+	.ascii	"%L\267\227B\267,\206\347vi`\271%\346\231\031\263l\206\217`$\030"
+	.ascii	"\216\343\366x\346\311\b*\2716\367\374\300\326\025m\b\001<\230"
+	.ascii	"\234\304Sq\005#\266}E\021\344\215\211[\036\276uEK\300Mi\024\225"
+	.ascii	"\\\245n\370\353Qd!\031.\303\3446eqE\242H\365\005H@\221\205\311"
+	.ascii	"f\240!\233\221Tr\225\372\222\003F\303\356\221\205\273\214\266"
+	.ascii	"\254V\004\033\301\344\264\225+BU\025\331\334\364\004(\262\320"
+	.ascii	"(h\344\263=r\031\2331\031\332\244\270\"!\344k\007\276u]s\260"
+	.ascii	"pq\024Y\310v,4d!\021\003\rY\310\334\215\303h]+\273a=\327\360"
+	.ascii	"\254\353\212t-1\222\311\241-r\020\215\327\030d\262\214\030FE"
+	.ascii	"0^\020\315\030r\321\202\305\n\025BA@?>\311\036\025\231\036S\320"
+	.ascii	"0\026\211Ca\360\315\\>c\031~uSVP,\243\214]Y\307 \303F?y^EG\266"
+	.ascii	"\2549ZWc\030\306YX\025\264_\334U\235\345\2315\021\031\236\021"
+	.ascii	"$:\211\302\205\357\252\332\202>\374\370\340\230m\207\036\342"
+	.ascii	"\272\"c\027-\210@\330\270hg/:G\353*\f\263\020\343\025]\320\210"
+	.ascii	"\265\212g\2309ZW\\X\350k\216K\007\001m\341\237 \216\25449\360"
+	.ascii	"]\025\020A!6X\340p\232-\355\023\204W'{\272zh\225\bD\353*\bFf"
+	.ascii	"\305]\351\364\256j,ht\344\273*+l<t\n\216\"c\032A\"\016Ux|We&"
+	.ascii	"\350c\216\234\035X\215c\204Ua\2651\006\327U\025.\262\032\013"
+	.ascii	"\277\364\346h]Ua\"\025\036:[\250Z=\203F\353\272\036\255\234t"
+	.ascii	"0\205\025\025~P(\n\227)\325J*\210\203/\t;|\306Me\325\354&\002"
+	.ascii	"Y\327u{\312\352\212\267\006\357\266\332\356^\331\035\272\013"
+	.ascii	"\273\314\255\346\201\251\245G\327\272\256=X\270\275C[azma~}\r"
+	.ascii	"Y8\364\036\"\352\306\240D\027B-\356\202\305[\\\350\346\204\342"
+	.ascii	"\347,\336\301\023tO\300 \334\232\267\341\267V\\\350\315\225\226"
+	.ascii	"F\305W0\2734\025\246\020\305u\225\352\261\255COaz\031\202\t\006"
+	.ascii	"\314\220\205*\316k^\320\240\013\235\237\200Q\035x\324R\224m\325"
+	.ascii	"W\3141&\031\323\214i6da\320w\274a\343\226Y\2260i\b\364&\2436"
+	.ascii	"Z\331\201\341.\004\0224O\001]EC\307N\352P\373s\237\377<\270\227"
+	.ascii	"\274\317\211r\316\260fO=I\0369\205n\254g\207\372\236\007\377"
+	.ascii	"\220WO\354\333\321NZ\ny$\021s\321\364\370\364\215\275T1c\267"
+	.ascii	"\256\033\\\327\250\031)~<\261\2153\254\331+ \007\n\241`\310\220"
+	.ascii	"!\013S\034\31157\366S\306\217,h|\361\306\007\3678\312Q\370\255"
+	.ascii	"\334\220\205\305#\235qQ\342\216\341\211\017\376\355`;}\303#\271"
+	.ascii	"\342\306\340\204?S\366t\361\024\024\301\013\037\354s\256\211"
+	.ascii	"\352@\035\f\305\276\025\327u\365\261\314\307s.X\016\202\205\233"
+	.ascii	"\301\006\033\0349\345-\nWc\315\352\345\337\3322\3473.\336\245"
+	.ascii	"\351I\265\337\366\3126\206|.\363\355'V\223\237`8"
+	.string	"L\226\203X\"\0364Oy0d!\237\310uD\024+\252\003w\321\232\375\255]\366\321\345\027g\237e\267\f\2311b\324\322\320\240\334\306\313f\354\306o\274L\026f\214\223\340e1>\303\313`\276\004\3652\030\027\240^\336\302x\274\354\345\323\313Z\266\260T\341:^\206\302bx\231\212\323xyJ\355\345'6<\223\275\354t\222\366\262T\332\313\315\264\227\243\324^\206J{y\005\352e\246\275K\237\336&jo\r\311^\032\222\2753${\225j\257\fi/\223\2647\206\264\367\t\250\327)\355]\242\3666\245\275J\322^\030\322^&\2657I\332\273\224\366\276\220\366\272\220\366\266\240\366*\245\275H\322^\026\322\336\025\322\336#j\257\221\264\267\210\332\253\202\332\233\224\366\246\340\323\213B\262\367\204d\257\tio\ti/\ti\357\b@\275\"${C8\366\202\220\354\375 \355\365 \355\355 \355%\222\366r"
+	.ascii	"\324\273\301\261W\003\2657\203c/\006j\357\005i\257\005=\275C"
+	.ascii	"~z+H{)H{'\360\351\025\242\366\006I\366J\220"
+	.string	"\354\215@\355\205@\355} \331\353@\262\027\210\332\333\200\332\313@\262\367G\262w\001\265W\001\2657\201d/\002\311^\037j\357\001jo\217d/\217d\257\001jo\001jn*|\005#?r\006\303\223\267uQ\356\214\3501r\025\316abF\212\\\270\367\004\214\242,\342\240\302\215Z\326\242pj\322\241(\213>u\252e\235\013K6l\344\246\240\200\362\231\262\230t#\\\224\330S8\207\341y[h\017kMd\3471\ng\255e\023\177>\001\340d>k8A\341F:\265\023\316f&\374\204\022nB\0072\t/a\204\0239\t\037\266q\206\211\360\021\332\274\371\250C\211\360\243\235\3001h\b\347\262\367\036\b\377\340!\234\235`:\230\311\016\302\331\t\350\301?x\2135':\270\007g!\347\fC\344\034\274\203\2633\254Iv\"\037\266y\002np\016\362\032p\371\006\311\315\037\363y\324\225g\203\037\355"
+	.string	"F5 {\3679\3012\270\006O\264\337R\316\201\250\213\342\311\340,\347u\30118\357\265\235\245\034&0|Ye\274fw\211\327}\3139]\364\303\235\346[\031\235\256\263\244\263\354[\336YF\207,\274\340\007\274a0\267\340\214%'\357\t\030E\317y2\200\217\371<\222#v\341\334_\024\272\374\353\275'\036]p\230O$7O0\230s\034\327\230\373\033\203v\236\263\251g\332Qx\310;N\232\036\220\256"
+	.ascii	"\212\331l\236\032r#\n^\301\205}+&8\005'\332\023\362\tN\264\366"
+	.ascii	"\004\344)]\354\350p|\032\nyS\332\033\251\366s\322xO4\334t\033"
+	.ascii	"\346\263\310G\023\355\004\363\t\025\363\206\033\206,\024rf\343"
+	.ascii	"\033S\362D\241g\243sb\225\342[\3134\236e\211h\212<\346\327#\346"
+	.ascii	"\240Z3P\366\273S\365\304\370-\236:\217\371\fq\350\234Y\312\341"
+	.ascii	"\3566\321k;eO\327\232\256cF\261bJ\221\242\3065\270\372\360\324"
+	.string	"\211\352\300\337\210#t\260R\f\222\346(\301\203Dp\t x\004c\032\315\022\020\334\310Ug\354\001\272\024\016\374\001 w\240\201\003Ik\271\270\006\242\f\300\031\177\234\201\005\376C\201/"
+	.string	"m$\336\024\270\221KN\002nE9\004\236\200\217#p\241\333\001\367\321me\016\270\221+N\2171\304>\036\357a\300y|\350V\300\r\020\263V\300\215xq\306\bH\033\272\rp\002\004\370"
+	.ascii	"\017\376!]\200\"\320\220n\234\262\027=\202\n\325\354\370\221"
+	.ascii	"\216\357\270PM\216\353(#\313q#\021{cp8\306\202\227\273q\034\001"
+	.ascii	"\334\306o\2005\301\020\021\300{\274\001\3406\276x\001\340F.8"
+	.ascii	"Q\270\032\247\361\032"
+	.string	"dh\353\252Bj\306i\234\270\346\004\353\322_\315\205\251\003\025f\225*C\026\316\370q\316\211(\234\214-\310\030\227\361\367\265\026\367\017\334>p\367\300F1\212n\364\340\232\225\356R\376\350\322\302\324\302\303\rW\321{\270\352\242P\030\235\205\317\224\310\224Wn\n\212\027\207\361\377\r\320\257S\003\024\325\006%x\210\276\313\354\201\371C\363\324\213\007W\254C\355\320\211\036t\303\322W\224?\334\004\213\344h\t\022\247\244%\244$LKKLE\\,\222%\246\246 F\232\222\23041\005a\352\340\205#I\222$!)\022\344t\204\205\246$\247\341\022S\323\nA$NF\224\230\240pL\242\264t\031\222\226\256\304NO0$Q\022n\221\243%L14\035Y\202\344\204\204\005\245\027V@J\242\224\264\204T\244i\t\322\321\3202\301p\244\t\311\211\211\251\t\351\210\026\305\317\262'\320\331E\275\271M\202\353\252\325"
+	.ascii	"C\231\317\330\207\317\b>\031\337Z\"\032#\376\362\353\315\310"
+	.ascii	"\301\f\005Jw)\013\264\022\343[\333A\364e\025q\025\243\030\235"
+	.ascii	"80\030\313\231\314\251\240\234\277|\206\350\223\357\030eO\027"
+	.ascii	"\233\r\347'\347\247\rYM2\347'K\235\235\3012\277\267'\240\321"
+	.ascii	"r\355kK9C\256dy\243\226V\345F/qQ5gT\334\024}\013o\267\311\227"
+	.ascii	"\027q4\306r\343\326K\030\273\363\004\33468\374\245\301\360:k"
+	.ascii	"y\003\246\261\035\372T|\331\315\226d\226mK\267\245\233\226s\032"
+	.ascii	"///mh/\276\265\201\3144d\257\263\340\341N\232\236\327\033o\227"
+	.ascii	"o\037[\236\371\023\036\340\350\211\201\301\333r\316\343\240\020"
+	.ascii	"R\334\242\334<K\275\345\234a\242\270\371\241\032g\030\3249j\b"
+	.ascii	"e\361\013\324\177x\3011\317\353{/\211\207-\317\224`\346\303\335"
+	.ascii	"n\023\274\013\001\266\244\303<\333q\016\266\270\261-D|3\236e"
+	.ascii	"\217@\270`1\277\036\215\034TT_\036\202&_\376\353\\\236\226rK"
+	.ascii	":\272!\013\233|\305\033\254\340\020\325Y\314\371K\234\300\226"
+	.ascii	"\342\342[lx\213\362E\027\020\314\306\r-\203\223UVg\333\250D1"
+	.ascii	"\325bE\237\321\250Pr\206\326\360.\245P\227\026\032^\303\fW\236"
+	.ascii	"\206\2633\253\251\366\031~5O@\031\256\334R\026\237E\206\013A"
+	.ascii	"\317\\\316jv\242o\316\260&\013\030\316\344\315QTI=W|k\231p\t"
+	.ascii	"\351`\236\343\n\236b\317\267\240#f.\247b\202&\20639q\317\031"
+	.ascii	"\346\351K\036\303\211\344\234aN\177Z\342Z\3137\234\247\353\007"
+	.ascii	"\346\223\355\270\361\301\351\234\307\013\332\364%o\261\226\245"
+	.ascii	",^i:\327y\301E\225]\211\331a\020\372E\337\236*\276%%\364,\016"
+	.ascii	"\f\031\354*\244\3511\032\330\207rO\2540\3471\246\353`\016\363"
+	.ascii	"\341\2373Osn\227L|\207\245\232\t\256\224)\361*\307Z\322\3419"
+	.ascii	"F;\317\361\215&]\024\312d#\317LZ\036\033\240\rA\337Z\"D\374\334"
+	.ascii	"\350\303\031+-9>.\234\323N\265\233d\212\016iOr#\217\255\231\307"
+	.ascii	"\006\364\242\260\265\210\237o\355R\032n\254\034\354\272\230h"
+	.ascii	"\342\205\267\360%\260\027>\344\346\302\271\205;Hls~\360A\240"
+	.ascii	"\fL\332\032\251\366K*]\212\262F\327\025;\271RP\337\221#9;\371"
+	.ascii	"\266\263\016\013_\341H.\\sf\241p\026>\024\202l\250\322\030!\021"
+	.ascii	"\222\330)T3\"I\222d\230\003\022\013\020\b$\201\332Z\351\001\022"
+	.ascii	"`t5\211\223P\325\214\210\244\240\220\016\257\205\340\034w\310"
+	.ascii	"\306U\334\212\035\005\250 \323\320\247\030e\364}r\244\017\306"
+	.ascii	"k\003\200\333\221\032H\322\213\313W\257\005\ty\"\202\357\001"
+	.ascii	"_\034\001\013\217p]\3510\246q\b3\004\213\027\247\210\200\303"
+	.ascii	"?\314O\224\030$\300\203\212"
+	.string	"\272\371(\304\235\215\344\352\\1\232\352\211\346\316N\303c\324\225c\364!r\376R\252\030\223\271\024\312\210`\312<\332\342\370\345\211\177\"\377\321\003V\214\227\006\310x\203\005\343\377\210\316y\306g\321;o\\@\263\302\377V;\032&\305\004>\322M\206<\2177A\025i\005;K\370Z\023x\222\220\302j\245+Q\332T\021\267i\325GRb\375r\035h\334\313R\337\203\023by\300\376\372'V\th1\330\274C\265\357>\310\255\035\023\320QG\200\303%\302T\212\265=2iPm\005\346\003\236[/\264\f'E\2030\177\340H\367\203:\245\330\177\024\202\240\r\365\263\213Q\230\341\027\024\305\007u\031s\017\3021\330\360\232\374\263\r{\217\215|\231\307)\372\013)=\r\224\311\373\347\255;?\221<\214\367\034g\310\312\310\030d\306\306\307\271\346\346&\247\265@\310\363\033\347\026\330|u\202_o\255\r\r1r"
+	.string	"R0\212\211\203\257e"
+	.string	"W%\362q\242E\251\\\271C\336\360\315\354[\222\217^\315_\322\223\375\020\0343\303\220\327X\342\3160a\233d-$\371\262H\277*\025\246\363\355\001R\234\202\244TEH\335\t\211UKd\276\005M\306;\343\301\373\246w\237\205\004\335\223I\207*K?\023[\350\004\307\211\022I\210\347\221\"V\237@\025}\2416Z\320\3309\270\013I@7V\272\242b0MwV \341{V\027\b1\276\354\306Y^y\r\264\263\371\026yY/=\344\245rfU\3061;\330\t1\020RR\272\347\344\017\024O\342"
+	.string	"K\255\\\360\201\006)\336\234\340O?\0223\007,\360\331\217\304;\036\222\226\303n\377\027b'\344\2523\202\324%\373\025.jQ\200\016\226\331|\311\032\364\\M0$oJ\274\377\337\373TWOO_D+\242\363`\340>\350\216L\271|\252x\007C\227\307\f8\223v\271\377\364\264X"
+	.string	"\240\222q[\352\017F6\273\375G\363\343\"\337\201\235\214\371M\332\321l\353O\032\327L\252<\330-B\231y\212\334\202\026Sin2\356@\020d\236\236s\202\r\333\227\374\2459ObL.\261\333\266\305\252\366\315\254\310\025A(r/aC\361\346*d\357\231\345Z\026\024^\331\222\034q\021\372\031\210\317\272\202]~9\t$)3\231X \206sU'\247\207\347\251c\372%]"
+	.string	"\352w\001\252\003\036\006B>\023\361\303\317%\005?,\016-\005\033\256\367\210\"v\372\271\213-B\2012&$\220\203\300\371\323P,gPn\377M.\003\304\302\267\007\357\036Aj~(\327zA\026\023\316\231\344\b\030\024-\220tO\027Nj\330\250\fh\354\220\377D\030\"\354\216\215v\f\253\220\367\306\205\256\017\210\213\016\231\"\277\265\032\302M\337\312mA?\004\023 N\005U\326(5aB\327\016\346&\330\244\357%v\301x\221"
+	.ascii	"{\2777%O[\342\004\3022\267\031\214"
+	.string	"@\365\t%8(\253M\265\3763\322\005\326a/\255\004o\373I\350Z\002\033\3275\006\232\256(\370\021Q\215\376$\321&\001\033\312P\232\266Q\016O\203m@\253\250\301<\226H\251a?X\336|\367\263\363\215"
+	.string	"\262H\003\252\326J\034y\031\372mq3ogAt\221.\206\346\315\002x\217\fd\203\230\350Th\346\331\243\203\037(\313d\003]\177\332\016\367\016\241\270\204\311\243\240\367\f\177D?\220\330r\330\363x\024\004;\206R\343\243\351\207J\344\262\270\031'\267\310m_a\375\272\206=T9\270\212\370i"
+	.ascii	"\220s\026\255 \007*\021\340\353\217;\317\221\002\027\361'\356"
+	.ascii	"\233F^\323\212\343az\351\036\224\371\320\004\247\272\025\nh\362"
+	.ascii	"j\315\271\322_\r,\336+\"|8\237SL\177bvK`\267\304\216bn\376y\242"
+	.ascii	"\266\251\305b?T\366\3518\r+\207\023\324\022j\343\244\364\b\366"
+	.ascii	"\003\242\225\211\251/\004p3N\215R[\033"
+	.text
+	.section	.gnu.lto_servoTable.101.842e9217c823b621,"e",@progbits
+	.string	"(\265/\375`\374\020\315M"
+	.string	"\032\205(\035O0\020[\031\016O\236\206:\027X\006b[\223>\210m1\311f\210\270\322\334\007\341\017\001f\300\232K\003Zt\201\331\337]\302`{pIG\202*\321\002Gt\036\373\001\346a\001"
+	.ascii	"D\324\032\245t>\221\203\230\231\331F\366&do\"\245L\001\262\001"
+	.ascii	"\231\001\311\001GD\376\007\"\337C\3127B\371E)\237\210\310\037"
+	.ascii	"\"\362\205\210\374\240\224\017\204\362\177P\276\017\312\357I"
+	.ascii	"\371<(\177g\310\327A\371D\224\237\242|4\345\017Q\276\020\345"
+	.ascii	"\237C\276)\344\007O~\237|6\371k\300\202\251\341\bVV\326y\311"
+	.ascii	"\225+p\207\325\316\224+\333\344\356r\027n\373\337o\013+\027\301"
+	.ascii	"\2169\221\330\222\330\230\257\234\257\267\357\3327n\305\354\n"
+	.ascii	"\352\302}.\t+\271z\t\225OrX\001\030\256\231\264C\347\232\301"
+	.ascii	"\r:\327|[~\303\364p\263#\206\305I\260(\274\225e\342|\3356\371"
+	.ascii	"\375r\0303\324es\222T\225\\\271\204\244\231Y\2133\301\256\035"
+	.ascii	"\312m\355\270\266\256\353\004\3045a\314\230`\331\234\fW3\241"
+	.ascii	"\230\274*9\254kRi\315\263\030\256)$^\375\3676)\266\n\313\270"
+	.ascii	"d-\343\254\353Zl\020>\334`rO\304\352\026\021\r\t\005\001\375"
+	.ascii	"\370\364\360\354\350\020St(<\315`\263\372%\361\005W\265EA\241"
+	.ascii	"\224.\033\366\256\253,\350\324\206\257\203\215\023\201\211F|"
+	.ascii	"0\205\313"
+	.string	"\016mY!2\271-\034\004\264V\\\366G\370\224e\312\330\372\204 \306=W\230g\347\270:V\300\230h%\314\216\350\322U\205S\240\2741T\370\364vl\223eJ\007;\354\322\365\305\302\340\020\ral\366\256\213\203 \213\343\231\f\366\313\362\226W\026\237\301\244\273\256\261`\322\272\256D/#\233\024\314\321\362\242\262\301U\333\022\033\324)\363\304xQ\331\306\272:\207B\230\023!\365\262\240Y\370\264\256\353Y\313k\312\336h\377m\373\037\301\337\243\026}7\332F3]\026\340&\177c\337\344h(`l\260\232\026\314\277\264:\350`$\017\372\256\2408\265Y7<\276dkn\022\312\007\220s\315\033\275_\266\004\02406G\2666+\016\004\341E\371u6\362MNn\004\224k\260X\316\2118i\t8\377!Ex\265\270Wm\315?2qr\300za\377T\305\177f\246\0214VfX\256\373\263\013\376\360\177"
+	.string	"\022^\255\353\324\371\331]u\325\327\314&U\361\037\320\034\253\256n\344\3775\036n\3702J\2636|O\230Fh\350n\361\276xzV\352<\363\265\373\236\020\315p\245\3163K\267u\337\023\326\0204\317Z+W\233\331\212%\206\257\f\337\023\322\231\331\225:\327\034\376X\347\220Y\363\2620\374\337\003"
+	.string	"\313\021l]\253\366\310Z\353\212\340\312\001\003\376[f\347\244\276dO\262"
+	.string	"\257\326\232\337\005\3165\267M\266\032\216l_V\034\370'\257\270\221\377:\2651\226\275\265\374(\377\b\3127\222\362\013H\371ER>\021\224?d\341\366B\206\374 \273\334G\241| )\377G\312\367\201\362\241R~\017\224\277C\310\327\201\362s\240|\034C\376\215M\356m\b\371O\013\267\257\261p{\247\224O\003\3457\245\374\031(_F\312\217\201\362a\244\374\027)\337\005\221_$\362\231\210\374\026)\177\t\345+\241|\026)\177\005\312W1\344\247H\371(\210\374\023D\276\t\"\277D\312'\201\362G\240\374\244\224\217\204\362E\f\371!R>\b\"?&\035P\007\365f\001vQ\321\206g@]4&\367\323\304\206j$=\343q"
+	.ascii	"\237\376i\2474=\275\323>\335B\217\247{\262\230\213\212\306\201"
+	.ascii	"b[\324(\334w\003\031Os\340X\233N\3574\322_\b,\306c::\315ycm0"
+	.ascii	"\366sg\332\304FZ\032O@[\330i\203X\032\273\\q\340\207\215\366"
+	.ascii	"Ba\244\212\266on\270\272\305Z\324(\253'\266\3469\013\207\251"
+	.ascii	"\\^*\006\030\234k\016{\337\250i;[\330\346\237\321\215\331g\237"
+	.ascii	"K*\214%\307\025u\003(\037f\323\310\002L\013\256i\243\306g\235"
+	.ascii	"\234\301\336,J5X,\207\003\006s2<"
+	.string	"w\300U\324*V\324+W\330\315\215\315\221\215\007\314\003\270\236\035\037\275a\226\307\3331\213\005\235\037\335\243\267\226o\273\251\224k\212\274\263j\330\371\253H\025\004^\255n\0364p\354\260\272\352=\372\032PY\001\302\016Wy<K\fR\230\302^K\037;\257\300\rs\261\224\037Q\215C'\252u\250j|\001o\351\b\232p5\306\217\330\3103\031\234#Z\004\365\242\303\336\220H\027\320[\207\263QA:j\371\033\fE\205\277\005?\341\254e\220\3360\005\364-P\321z\304\370\212\261\3241\021\324-[\324\266\250O\211'\306M\252\226q\225z\306\303\212\026\345\277\304k`\221F\321\312\370\265\021e\2550\207\276\0022\373\247\2429}\347\354\016*\t\252\tj\232\232v\256I\244Q9\033=\244\217\244\365e\001\236f}\312a#o\243\237\232\001\225uX,GU[?\225m\270\256k\323\267o\343\250n\017@"
+	.ascii	"^-\001\3165\237z\317\214\001\335\241Y\n\033\031\270NN\033m\004"
+	.ascii	"\026W\302\324D\311\003H\226\024\231L-Y2%\365\341J\030\330%ST"
+	.ascii	"8\022\240B\022\001\325\024\216\251 \r$a\302\004\211\022)\241"
+	.ascii	"K15\231\202\200*I\223\342\003J\026`\240\001\005\212L\030@\262"
+	.ascii	"\244(E\325\244\310t\364)\007\222P\025\037\230\232\242*\022\223"
+	.ascii	"V\333Z\324v\237\334\241\331Y\365\325\213\032\371\215\333\024"
+	.ascii	"2\f\t\351\007\177j\264So9q\331\005a_t\300\333\335\340\272\256"
+	.ascii	"+Q#\037U\202\320\021\024\213\013]|eA2\332Ho9\265\220\356\t{\322"
+	.ascii	"G\243\361T\264\236;#M#X\346\353M\231\367\0068\324\310n\352#}"
+	.ascii	"6\276\271b2\263,T\204\032\371\246\226\321+\267\374\225\201]\025"
+	.ascii	"\034\360\352ft\223\035\232\031}B\215\\\214\226q\305t\352\331"
+	.ascii	"\016\rd\316\314\020\243i\214\275h\030\315i,\340\030\324\263\r"
+	.ascii	":\003\263\306\302\257Ja30\360\370\213\336\270\305Q\302\327\233"
+	.ascii	"_[\277I\361#\023\344b\256L\261]0u\213.\356h\246\245n!\327\302"
+	.ascii	"\222R\357h\021s,ZE+\365\021\335\212f\301\202\212\266{c\324(k"
+	.ascii	"C\334\212\336\275\024\255\242M\275\025\304\244\350\323\314\027"
+	.ascii	"\230\264"
+	.string	"6\024)\274\235h\024&\272D\237\310\321&Ht\211%\030\022#:G\213\320Kj\021=\242\217\364\220:\t\005\025m\371\276\250Q6/\211\324\3137\326\026\242E\264\t\247\215-D\220\204\274@\364\254\f\017\bHi\331TZ\366Q\332\215\333\3452z\355\361(m\215\336\372\376\200h\265\023\216\032\304\207\366\320G\275\306#\220\376\320\346\234Q{\360b\202QQ\023\033H#\2451\036\371\203\365\351\242\346\321 \220\317x\002Q\223\240\242\025\215\240\345f\250\211\204:\250\207z\215fP-\324\001\201F\250\201($\221b\250hD\024$)H\322\032\261\005\304\030\006\335\231\007\022\240T=\n3\350\030\211\002\261[\330;\257\305\361\326\252\342\307\257>FV\031\341\202b\207/\f\343G5\303H\030\275\277\344xL\3459\223\247=\204/\350\034?\023\271&\331G\255n\315\301\n\221\t\342\361\221<x\320F\313\357\030\034"
+	.ascii	"}\322\301-%\273\242\312S\336g8P7%)\3225"
+	.string	"? @\022\204\030\312\261\343}P\303\036\300\201\244\354\245!\322\345\370\030\200G\031\275\206\236\241\311I\367\335e\343\260"
+	.ascii	"\016\266@\227\"\352\214\330\336\271=\231U\035\240S7\366\351}"
+	.ascii	"\2161\305\324K=$\347\271nN\333x,\363\344\224+\371v\267\304Fx"
+	.ascii	"\333\211\017\n\352\224\350\031;\272\236\336\321\254*\233\364"
+	.ascii	"\016\262Xw~Tm\312\312}*\245\330\205S\237I\314\247\203WH\023:"
+	.ascii	"S\272\322\275\242p\360\203\326\350;\305:\016\037\212\207\372"
+	.ascii	"\245\037G\312Ea! w\216\003\212C\362\034\331\300A\240\\\003\223"
+	.ascii	"\322\251<\317\205\347i\202\271~\026\004\203\3325\2149J\335\t"
+	.ascii	"FC\255\317\242,`t\0066\031\352\303\250\3655\350\226\227\340b"
+	.ascii	"MY\277\250\366x\335S^\256\320=\033gO\251\177g\005\221\005\232"
+	.ascii	"<W\244\345\342#&\310\314\023\240\226\031]\001\005l\267=B\236"
+	.ascii	"\201\313\337\335\221.%64\361,\244\242\032\221\203\212\013\345"
+	.ascii	"!\365(\316\341rs\261\252D\213\b\367\202\213\253\244\016\240G"
+	.ascii	"'\3372\273\273(@\210\364\003]\221\220A\334Ci\t\277\215\001=\360"
+	.ascii	"\34731\021P\324m\204\336\236t\356\276\221\270\221\033\234\021"
+	.ascii	"\203\301\230\315\372zv\220\001\255\025\365E\271\335\234\006\265"
+	.ascii	"\313Ko\245\314`\032\214P\331\373p\314\305\237\346M\222\332\033"
+	.ascii	"\237^s \002\363\002\207\200\265;V\372MC\\\203b\365\3135\326\317"
+	.ascii	"\235\261\247\210~\236P\341\334\256\252\354\\o\341B\312\240\324"
+	.ascii	"!\0217\031.\252P\346\201\364l\354\213V\020\242\267 \226\252\202"
+	.ascii	"tl\002\373D{\300\360\233\030\206\227;\265 \306\202sqk\355\362"
+	.ascii	"\026\310I\261v\034<\316\252\024Q,\n\271/\fD|8\302\3013Qzm\346"
+	.ascii	"C\204\304\3022\260\353\376\002\035Sa=\2476/\037\022\326\221h"
+	.ascii	"*"
+	.text
+	.section	.gnu.lto_isMixerUsingServos.102.842e9217c823b621,"e",@progbits
+	.string	"(\265/\375 \374\365\006"
+	.string	"\"\21506Pm\222\016$\223\203\310\250Q8\n."
+	.string	"\220\001\252\r^z\203\366\212\366\334\266\2663bgW\334@\036f\307\315,\022\004D_\262 \304B\301\321\207mm\023\231\002g0WUai.\310\201x\330D8\300\211M\203\004\314X\027\304\020\\Qh,\310\251*\013^\270\330\034e\026|2\033\241\315\314\202\272\254!\025\331\344vlq\367\252\225\272w\226R\315"
+	.string	"\214\317+=\347y\271\361\235b\216\376w\276w'\001\022\311\326\020J\214\242\322J<\241J<\376\316_NP\350\214\225\343\020\r|d\200FTb\344`\222\212\365a\267 e\310B)\332\346\351\003X\2101\376\264\355\242g\177\203\377\340\327\b\t"
+	.ascii	"2\001'8#\217c\261\250\360\\\303SF\274%\004\tw\316\324\316'"
+	.text
+	.section	.gnu.lto_servosFilterInit.104.842e9217c823b621,"e",@progbits
+	.string	"(\265/\375`\264"
+	.string	"m\013"
+	.string	"\326\225PA Q\224\016\fA^\235\200\360\0278\202\220u\247D|L\006\016\365\253\026Xr\251(\3513\277j\2771\325\334\333\006\fB\371\333h4\004\300!\t\032\272\354\331\006EM\007e-O\032\331D\312\224\002;"
+	.string	"<"
+	.string	"?"
+	.string	"\236m\343\341j\005|\214\320\340\"\307\356j*\302K\357\227\246\347O2\224\017\f\375\312@\\\303\247\007\220tYv\367 O\0238\312\234dv\327\371\201\247;\336\266\002\333\006\354\027\b-k\312>\353\326\247s\342a\342\005\370\217\306\356\207\222\035\333\2120N\234u\373*\374\360+\036\342\235\345\030\337\323\236\303\352\243\304\215\335\275<\232@\366hy"
+	.string	"\354\361:"
+	.string	"\354\361\025\007io\026\362\237UCG@RB\241\252\262\007Km R\203\224:lwo\341\311vI\007|\026\027\271\340\223xt\006P\376{\364A\330c\352\202\0202R\204\210\262\304\016G\251*\222\221\016\001\030\034$\330>\334\246\313\254\301t\333\207\333tZ'\002\004\216\204\007\032\005\016\203\t\232\206\3534\314"
+	.string	"o\0256\234\326\3316N\253\204\242k\n\344\3370\202\243%\322\321\245*?\374Q%\324\214\274\\\325dS\002\017"
+	.ascii	"2\003\006:\306\022\003I\217}OX\336\0073\240\313\214?\025O\027"
+	.ascii	"\314\262\312\362\322Dp\356\001\\\216\032\304\037J\031"
+	.text
+	.section	.gnu.lto_filterServos.105.842e9217c823b621,"e",@progbits
+	.string	"(\265/\375`\345\003\265\033"
+	.string	"\2663\264I\240\326Q:$\026\340\306i\320X\215N\201\210\236\244T?\t:\t\242\023\276kO\270md{X\366\360\301\336\360\343\301\3236;%\214\0364V\202\353\30798\033\354\326B\242|-\300\005\336\342|V_\364\t!{K\231d\232"
+	.string	"\223"
+	.string	"\246"
+	.string	"\265\312v/\265'\256\354\364S\247\332\275j\217\274\256\250O\301\344\204\245\245\326j\340t\013\224\2478\257\031O\347k\343i\313v\267\213%\300P\025B\340\024\365+z\251\265\332\232\306\226\237\304\357\310\273\223#\235]\362nO.\210\001\203B''y\204\324E\013\376\246\316W\226\027'\366xtJ:\225\t\266\370\234\005\224\264X\320\202\276Y\343d\206\225\027\317E\301!\3562\351%\361|\024\374M\234Z\353\243N"
+	.string	"\007\222\220\231\\Pk]\006\006W|c\337]\032\273\373\263\333X\001\335\303\375u\276\210\232\312^\332\236\361\335\301\212\212\217\301v\227\347X=e\255\276\004\373\253\377\370\331\3338]\0208>\360t\217\033O\337\032\204P\240\250x\034\266K\354q\017\277\236\030mm/\355\332\224\2744%o\355U_\332\344\235)yg%\257l\362\312\224\274\261\311[N^\222\344\035)/\035y'\345\355\311\313\315{"
+	.string	"\263' \301\027y\325\252\",L\335\242Y7^\365\357~\337\343E\023\337\261\003\244\324Z\327\304*`:\361\035;j\t\273t\324`\270\232\370\030l\311\236\365\177cdZ\006\365&\273\251\327\276\254\230h\311\364\207L);\326-&\352KvS\277q\362\321\244$u\036JvU\024L\205\216*RH\236\204A\003\007| \204\361\264l\362I\330\005E56\331}\3457\346\206i\357J\2300\03686\216\257\2056"
+	.ascii	"w\317\336\245P\201\017\244\2153\324B\2737\242;0\313\302}0\021"
+	.ascii	"y\221\013\0302d\030Og\037\230\304\335\335b\210\264\3608\254\303"
+	.ascii	"\205l(k\255:{ \017\302a\347v\033O\271O\374\003/\302(PY<\016\353"
+	.ascii	"\276:\372R$\353\223\243\363\t\332\301\331D\344p\270\334M\300"
+	.ascii	"\372\224\360\020\241\334[\216.G\002\210Gg\013\362\351\371\t\361"
+	.ascii	"\301&\342g\007g\273\001\351l97\233\033\301\003d\013\312\345\200"
+	.ascii	"l2\"\357\275\024\365\243\340\312\261\305\353\036\331\303\235"
+	.ascii	"\241Bm\232\326(\r\234\326E{d\244\265\022#\0341\270p}\326Z\353"
+	.ascii	"\330\303\255\3604k\375\342c0\214 yeiY\323t\321\356\201\323\332"
+	.ascii	"\246o\254\214\206\020)\315\364:\331P\303\264u\340\026\232\236"
+	.ascii	"\231`\302\256\236\327\025\215\365\254k\275L\324\245\307a\313"
+	.ascii	"6\232d$\315\036\356\254e\375\342Y\310b\313EE\250Q \006\2312\304"
+	.ascii	"0\"\023\210\310\214(\331\001`\002)S9\036\021\2601F\264I\261\264"
+	.ascii	"go\337H=\r]|\200\b\317\021\347\024\225\301\362\366\221\307~\254"
+	.ascii	"\333\343\343|\326\037\340\363V\233\326aU\302X\bCu]@t\221\017"
+	.ascii	"\223Z\030\374\211u\026P1\205\323\f\334\333%\362\037\374\371 "
+	.ascii	"<k)\321\336\2112\265\307\342\031\374\177\031s\316g\217\373\234"
+	.ascii	"?\262$\245\007S\213\355\315\1772\b\253F\020R\262wxO\210\361J"
+	.ascii	"\264\236Nr\250\353\314\314\t\360g\212\370A\236\272\177\324>|"
+	.ascii	"\373\342\233\002"
+	.text
+	.section	.gnu.lto__reset_template_82.1.108.842e9217c823b621,"e",@progbits
+	.string	"(\265/\375 D\325\001"
+	.string	"\264\0027"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\030\001\177\344\031\001\334\013\320\017\350\007?\202\210\200(\177}\277\001{\276\001y\275\001w\274\001u\273\001"
+	.string	"\005"
+	.ascii	"@\260\312\021L\273)\255`\240\b"
+	.text
+	.section	.gnu.lto_servosFilterInit.part.0.174.842e9217c823b621,"e",@progbits
+	.string	"(\265/\375`=\002\325\022"
+	.string	"V$|H\320\362&\035P\203\3544B\347%\252\005k4\322\361\334E\201\200h"
+	.string	"\3350\r\371\222\022\r\024[g\200\243\213\377\032\033\0015iT\224\031<R'\321\227<\002\375p%\226\341\235\203\250\r\234\354v\215E,\331[\356\224\002d"
+	.string	"k"
+	.string	"h"
+	.string	"\027\300}\312\213p\237\246y\220\r\320\220N\354\256*\372@.[\245\372\274\n\333.\231_\266\216\207\265\035\371\351\271p\203\332]\357SE\270\273\fo\215\257K\215\363\345\037\350"
+	.ascii	"\300Y\315\245L\345\310\224Bf0y\362\324\344\341\267G\234\231M"
+	.ascii	"T\220\237\r\217\"\237)\004\273\353\216\303\315\335\366\212m\005"
+	.ascii	"v|\005\236\222\213\326\031\035e\364A\"mecWC\324\217\r1\215J\\"
+	.ascii	"\350Q\026\303\345\031\271\264\260\246s\033H\264\002ja\241\211"
+	.ascii	"_\034\006\215gF\302\232N\252\006\210\036HP\273\241\367\351\260"
+	.ascii	"S\373\246\271\013\177\007-\311\027z\220\177\263\271\\\002\013"
+	.ascii	"w&;\220o\013\317\342\365\026>\372\352\3543\324~H8\355\256\311"
+	.ascii	"\247\tt\237%\001.\211i\215\375\244\n!K\240m\231#5X-\355\356\t"
+	.ascii	"\215\0379x\200\202\302}N=\330!\252\352s\304\234\234r#\225n\027"
+	.ascii	"v\300'z\021\213\357\363\351\026\026\213\373\214\372\241\021A"
+	.ascii	"\276\214\317\210\340\373\370\345\213\007?\375\217\373\274\376"
+	.ascii	"v\231\202\226\204\202f\023\243\254\327\241\234\036EQy\254\363"
+	.ascii	"\344)f\302\272cs\251\030v\261\260\222\240\263\312\n\346\223i"
+	.ascii	"\261\300x1.-,\t\020\274\t\254\224\027O\245\005\343\255H\374Q"
+	.ascii	"`iy1\337\327\362T\266\343u\307\366\217\001\007\217\0336zc\225"
+	.ascii	"\312\343\3313M\036\200)r*\025\307\266\273\373\210\223\032\225"
+	.ascii	"lL\260\350\303z\271\273\253\312c\273\300\245rJb\003\233b\037"
+	.ascii	"nb\224\007\304\253\352\002\006\361`- P\002al\033\033h;\332Ii"
+	.ascii	";\270.6\017\210\355\270j\357\202\"\253L\213\300\230\227\247c"
+	.ascii	"\234\270\r\242wIY`a\355$\267\367\200\225\325\t-\016\020\021\020"
+	.ascii	"\227\353\030\bm\240\t7\345\313<\266Y0\331\335,\261\313\336`,"
+	.ascii	"}.\301\235\017\226\364HWY\375v+,\242\341\270\361\256\317\315"
+	.ascii	"\025\242\337\365\306"
+	.text
+	.section	.gnu.lto_.symbol_nodes.842e9217c823b621,"e",@progbits
+	.string	"(\265/\375`\320\005\365\031"
+	.string	"\266\347\223H\200XN:\373\312P7\254Q\264\332 \002=\373\317\215\250V|\224\241T\352\t\017\314\377.\2762\330\205p\213\264\331\215\337\342\026\226L\"B\004A\020\004\345\001\335Wk\230f\253Cg\333\320y\237_\323\204F\252$2\005}"
+	.string	"\205"
+	.string	"\177"
+	.ascii	"`\006\256fZ\370\222_\032\021\256\202\275\225\222\302\327\314"
+	.ascii	"\t\2373%\374K\222}\2252\202=\025\244{1\357W\257\353\272B\260"
+	.ascii	"o+\037\260\225y\207C\324\353\310\262V\t\274\230it-\247K\376x"
+	.ascii	"+\262\217+\340\340rf\203\242,\2749\006\366W\312\013\177O3\357"
+	.ascii	"px\275\026\330'\313\376\031\275C\357b\376\350\210\\\n\354\313"
+	.ascii	"\312\241\361\353\267\177\032\026\323\334{o\002{c\371\277\006"
+	.ascii	"-\\\243\244q`\006\221\f\243\247#\247\037\233\236\306\370X\360"
+	.ascii	"d&\214\237\231?U\324\224TS\220)J)\b\205\340\214Z1]\311\213\263"
+	.ascii	"-\035\212\213Giq&,\336D\351RV\374\211\251\342NR\330oAa\017w\342"
+	.ascii	"dL\330c)K"
+	.string	"\334l\213\204}\226r\004W\211\340a\210\347\201`\324\374\300\327\303\327\016?#\307\301^-\203\200\034\2616\330\277\225\032^g^\230\341S\370H]\325\032\006{\267\362\302\013\017j\200\364\310^\347\024\231\307\f/\311\323^\353$\371\306\255\315\255\007\250s\216\354\023w\205\326\003\324I\027\353\351\233\364\270\3237h\330\016O\322M\214\353\351Ns\021\f\247Y=\262iNo\264i$\233\225\020\240\3315E`7\243\334\310 wkF\334=\354\355x\330\337\355\260,\244\262\307\323a/&\207=\035\016{07\354\303LY&J\331\227\211\2627c\303~\f\337{\177!({.\001\347!\377\350\210\\8D\375\224d\316\302\233S3\317~B\231\346\246g;!\341\322\310\231\031d\237\035D\237\236\275\2042\257\353Z\247\n\005\241\004\212\003R\001\352\017\252\243r\271\312\301\251\300\263sR\034U\365\351\312\312\003\236\r"
+	.string	"e\237+-\037\300\363\306{\357\313\316F\2629{\210\333w\266N\312\275\256\260\"\037\363u\r\352k>\366|<yC\254\223\371Z\ne&\262e7\344c\275\376\tx\250q\020\tkhDf$I*\215\001\240\002\2511\352\034\021\320\234\245\206\231\221\tD\202\026\024t\220\200\342%\312\205\003\317\031'\273\206\222\333C&\347\256\fL\350\016@\253Q\367\312Z\220\006\202\007\330\356\227\257}/\303$.W)\b\b2\335\322\233\251AG\371j\266\253A8r\362\322\352\336\316\256.\352\036k\017u\217\265\007\253\317^^Y\226\336\212\257\177\210,0l%\234\212\220\342\262\212\345\200\300\214*M\261\013\273\224\352<\2412\264\276\247\263\027\202Dx\rf>\205\355\276"
+	.ascii	"\260\"\032z\031\334\372\342\373-bW\013K\206\016\233\027\367\310"
+	.ascii	"@\321\260\272\256*\347\216\033\266\261H4\f\301A\314\027\347\272"
+	.ascii	"x+\001\3715M\250\311\031bb\231dLSq\305\376\341q\204f\257\343"
+	.ascii	"g\312aT;\333\216\276\314t3s^\263\032"
+	.text
+	.section	.gnu.lto_.refs.842e9217c823b621,"e",@progbits
+	.string	"(\265/\375`\320\001%\017"
+	.string	"6\244eB\020\217&\351"
+	.string	"\002\270\326TEL\244\fW\346\006vY5\352\032h\204\252"
+	.string	"\004\222"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M/\343\032@\213)Fx\213"
+	.string	"\322~\373\337\333\377\255\255\0263\377GO\337\222\326v\3332\005L"
+	.string	"T"
+	.string	"Y"
+	.string	"\324\365\365\374\321\214\301\272\205}\245}\225uJ{\314\360b\315p_d\317xzz:b|\257;\325}\003(\306}\305y|o\362\314\340h}/\326Pcd\327\274\317\274\25728\225\030\353t_\353\n\257\362\233Sx\"\266\217,\001\356Q\334\227\230~\304}\210\306\237\266\347\330~dz\221{\254\364W\3517\245\177\244w\244O\322wt"
+	.ascii	"\221;\240\337h=\003\352\251uJ\353\250U\344\016\240\b\032\300"
+	.ascii	"\020\004\301\002\370\201\004\020\204y\024\352\242\320\177B=\013"
+	.ascii	"}\347zM\326-\320WXO\320\007\333\237\336wl\257\361\336\324\361"
+	.ascii	"\243\354\242\367!\367\032\3473\336{\262_\357;\3567\234\177\217"
+	.ascii	"\303tW:pP\341|3`\270`\001\373V\240\220\275\023$d\337\b\020\336"
+	.ascii	"\367\201\203\215\336\006\033_\006\033\375\026,V\250H\361~\024"
+	.ascii	"'Jd\377K\366]ZX>\270\177\203\373\224\217\t\320B\024\n\001jx\202"
+	.ascii	"E\023|XB\221`\007\216\340\265>\365z\036\320\027q\375*\371\n\362"
+	.ascii	"O\362Ir\220\374S\276G\276(\377\223\217\345w\3627\002\376\245"
+	.ascii	"\307\365&^H\214pi\t\261\375 V<\344\257a\373\005\357S\262\243"
+	.ascii	"\344\233d\027\311\377\b\" \240\242\302\332\016<\306\027\216{"
+	.ascii	"\314\265\266\354^\341\367.\303\212\223\255m\357]\352\256s\027"
+	.ascii	"y\220\020i\\VE\2258v0\243\200A\001\365\026\360\024\020\f \004"
+	.ascii	"q,\030\001\017ax\301\020R\301\302$:\004\362\342i\264}d"
+	.text
+	.section	.gnu.lto_.decls.842e9217c823b621,"e",@progbits
+	.ascii	"("
+	.string	"\265/\375`6S\275^\001\352N\266\177S\0208$\351\244\003\312UWhD\0200\374\177\357<}\253,.\220\030\270\231\221w\355?~\315I0\262i\351N\336\276\332 \355\263\344\320b\220Xb\026\236\344H\252\211\313&\222^\034\027\013\234H<\253\177\307\306\016\226\n\313:\317b\332\244\021\262\267\334)\341\006\350\007\005\b<\352q\222\365X\214H\027\031\"d\241K\223\\\343\343-\"C\210\342\234\324\204\274\207\264\345\304\260\243\233\321\270\311\204?l\0341k|@\233\366\177\230z\215\371\342\326\370xJ\254\307~4\021-'_\032\261\377\220\"\363\242\251q\377\260i\267,\314\237\231\306\007\354\036\377\207xi.\207\227\306N\234.4O'\230f\241\006L\236\023]\343_\271\365\026\332:\302\222\362\264\232^\35700\233\234AJ\243F\r\266\306\r\326\375\3259\336`\215\343 \214p\233\245\006\30397\255\335"
+	.ascii	"\307\332\r\322\270\036M&*\376ma=`w\375\037\342\314\351A\001\353"
+	.ascii	"\352\033rkleO\325yFoL\343\377\026\332\316\346zf\037,\005m\256"
+	.ascii	"\254\361\357\331\372;\266\376\275\325\246\326ha\306I\343\337"
+	.ascii	"\257\3657k\325\240\2578\334\224\311S*\322\370o\253\256\221\342"
+	.ascii	"Hfk\\\365\274`\345\216iF\343\337\030\353\255\231R\227h\316\271"
+	.ascii	"\247\332\251\241\356\022\251\265\t\023:&\353\207\323\324\311"
+	.ascii	"KJYz\251\247\272\205\365\363\322\353\250\226j\032M\3252z\206"
+	.ascii	"\205\366T\303\300\317\234\227\320\3304\335\304I\322\311Jw^\304"
+	.ascii	"\316\364T\307\350\346}\212\t\233(\355Es\316\035:t\350\340\323"
+	.ascii	"\241\2030\311\324\237\026\034\3746\263\276\301\254\355\242_X"
+	.ascii	"(\207~z7Y\270\017\227\236\031\232\3633g\230'fK\255\361\033o\275"
+	.ascii	"\345\240\346\f\016\016\016Z\016\352;n\305\226G}\303\255o(\353"
+	.ascii	"\007\266G}\247\255v\260\263\205\372t\222\235R\f\255\306o%k\013"
+	.ascii	"\262\365Q?h}\324\267\221\365oU\314\b>\235eh\032[\301\337\006"
+	.ascii	"\3322\326\317:5\330\026``\b6n\247\355Q9\260<\252\035\363sK\006"
+	.ascii	"g\252\f\215\255\361\216\005\324[\261\252\3140\371\023c\265\f"
+	.ascii	"R9i1\267~\326\231\363\223\234\263\206\034\300$\265\274\3066\214"
+	.ascii	"\215Z\350\006\333\227s\254_\230\322T\3437\220\225\0059\333\r"
+	.ascii	"\252\035\034"
+	.string	"\264\033\324\337\202\331 $\002\307\005\306\027\200\234g\025\f\034\215\177\373e\257D\364\311\326\330KM\322\222\257*\215\3378\326[%O\233v\237b\302&^f~\213g\273X.6\317B\255\236\325rkg\357\232\350Y6&\202!\374?\267z\366\315\326\335\347\233\005\230\224\211&\001a\004\253g\267\3304\234\244g\216\022z\235\241\022\363\351\320\241\003\216\2163;\240.\340[/\253\315\266G\325\231[\263\370X\300\035ci\032\337:Y\037\202\224\265\t-0\232\363\363\026\356\377\231\263qV\356>\305\206M_\202\321\234\363\177\213\305^\261t\026j\347l\013\267n\266\311\373\231\363R\316\371v\355\377\271\235\263Ql\333}\276\345%%;\bt\361\275@\023\230\363\263C\007\237\016\251\324\026\036\335\212\255\234\265\242B\326\260Z-AU5\256\202\253\260|\371h|[\265\332)?\267TxT)\253gV\3139\347\b"
+	.string	"J\034\\c\241\345Qo\243\326\263`}\321z\025V\rl\217z\021\2546\226G\265N\354\023\013\355\300B\271U\263kO\233\317\374\314\371\231\323;\320\2541i\374\023\353m\007\352\035\034\264\035\250\027\261\352\330\036\265-\217\372:\333\243\332%\366\314B\003`\321\016\302\b\277Ig\331,\347g\316M\232\2624f\032?\304z\313\344\032\354\362\b\317\260\336\006@\265\2036"
+	.string	"\352{}\324\366\250\017\264=\352o\221\374\366\2105\353\340:A9\263Z\316\317\235uI\212\023\263\306\177\332\036u\265<\352\177I\360\2625\267\353o\235\003\334\370/W\t\270E\006\fW\377+\006\353\352\277\037X\375\235\363w\210[\343\177_\b\376\326\371\001\316\301\217\215\177\207pS\320\027\374"
+	.string	"\277\360c\245\277=\320\204\3774\307\266\220\223\367w\006\267{\372BH\301}\036\201\037\243\261$l\316\177\227AvD\030~\273\363\337\243\213B\325o\2156\313\337,Z\370\357\006h\374\226\312o\347~;\345o\001\334\031\277\205\322GW\206\235\361\267\362\311B\331\f\376w\320<\227\352\267\0068\006~\200\023n\324\321\372\354\324I\360c+\034\256\013h3\241@\204f\301QX\n\274"
+	.ascii	"\177\232>\003\004\340\023\377\325\300\351\177\337\267\334\313"
+	.ascii	"\3670\360\337\347(<\b\2015A\n{\264%\363\031\334\246\377(\216"
+	.ascii	"\301\217\343\032\004*\254\262\351\036;\350&\031\340\210\342\003"
+	.ascii	"\370\361\222\273l\022\334\022\277]2\363\1774\350m\3011\374X\310"
+	.ascii	"\337!\244\340o&\024\264\207\013\201\337\326\260\260'z\003\177"
+	.ascii	"s\340\"\375\215\301]\341\267\006\370\217\302R\340?\332\005\360"
+	.ascii	"c/\313\363\337\025\035\374W\331\031\340\372m\206\377\036\365"
+	.ascii	"\217%\321>\227\371[\234\377.\177\373\345\357\007\334\021d\360"
+	.ascii	"_\303U\376\367\330'l\370\361\324\337A\327\004\267\004[\327x\211"
+	.ascii	"\356\320U\361\333\244\337\346\277S\360\374x\355o\032\036\374"
+	.ascii	"\375\205\302\337=F\3607\r\r\374\035\265\301\337O\033\032\360"
+	.ascii	"\267\326o\215\277U\361\333\241\337\022\3756\350\267)~[\374\255"
+	.ascii	"\t\322\b"
+	.string	"\344[d\362_!\253\201\004\377A\360\341\177\303@\340\216\340\212\200\n\t,\223\312o\376t\357\377\226\377y\377\365.\367\037\013\336\377,\337\273\315\217-\360\367\225\277\351\376\306\362\267\334\337U\376\236\373\273\356\332F\373{\312\337q\177\033\340\277!\370\237\363\247\203\377\005\301\177=\360_\016\374\027\003\377\255\300\177#\360\337\006\374w\001\377U\300\177\177\376\213\200\377n\360\337\f\376\273\376W\375/\376\257\375{\360o2\177\003\376\315\367\367\336\337w\177k\371\333\307\337a\177\203\375\315\365\367\326\337U\177K\375\r\365w\t\1777\375\275\364w\363\357\3747\013\376V\301\337,\376F\372{\305\337\312\277\215\376F\376}\374\273\004\177\253\370[\350o\025\376&\301\337\"\370\033\004\177{\340\357\016\374}\342o\r\374\235\201\277+\360\367\t\177\223\370[\002\177C\340\357\005\374-\302\337?\177\203\370\333\203\277=\374\215\200\337\222\371\333"
+	.ascii	"\177\013\340\357\f~k\367[\345oM\3607\006\177\373\374\366\202"
+	.ascii	"\277/\370_\346\177\337\177\277\377P\376{\371\273\347o\f\277\255"
+	.ascii	"\371[\347\267e~\313\367\037\305o\367\376\243\375V\357\267w\277"
+	.ascii	"\325\362\333\272\337b\371m\333oi\374\226\352\267P\377Q\370\255"
+	.ascii	"\323o\233~\313\364\333\026\277e\376\266\350\267\307\377'~\373"
+	.ascii	"\201\337\236\360\333\t\374\326\347\267\032\376\013\376\377\373"
+	.ascii	"/\346?\337\377/\377\367\376\233\375_\301\377+\3775\030\034\034"
+	.ascii	"\034\374m\240\376\033\001\374\fPAA0\331ur\316J9\333\330Rk\214"
+	.ascii	"\035\360\230\314\216\314\007[\343\337dY\177<v\013\305cVPD\230"
+	.ascii	"3Si D\312\312\203M\022\023\232\254\306\277\251\362\343\207\335"
+	.ascii	"\023\021\226\363\024\001\302$\325\364\375\335\231A\353\321#k"
+	.ascii	"\354\206\205\365\307;\240x\207\025\263\266p\312\3151\016\210"
+	.ascii	"\364Yy\310\t\363\007f\004G\216\034X\207\3159g\253\234\3247\302"
+	.ascii	"\326\022)\016?\016\263P\254#=\022\345Y\343f\n;\261\023\177\351"
+	.ascii	"d\245/\202\321\034+<\035X0\216\343\257!\236\332\023I\343\003"
+	.ascii	"b\257aS\214\325\026\366\302][5\222\326\274\344'\035cr\370\206"
+	.ascii	"\325\362c\306\017\267\306\2671\263b\033\033.\2709\261\232j|\033"
+	.ascii	"\274\025kA\367n`i|\233)+\306\312!\213\302a\245\361m\330Vl\365"
+	.ascii	"$K\320\256\361m\212\254\317\2327\033k3\032c\032C'\026\223f\343"
+	.ascii	"\333\210\341\031\230\312B1U\377\r\235r\246\022\241\354\206\221"
+	.ascii	"\277\300,%\345\34166\326\037Oa\2512h\250\fi\034\265Ba\301\213"
+	.ascii	"H\343\333D\2558\317E\255\035\232\2547\263{&\t\226\237\3019\261"
+	.ascii	"\2343^\242\303\315!sf\356f\353\324\254\330\024,\321\234\363M"
+	.ascii	"s7\234a\316U\216\274\341\027\330\tCa\030\270\t?\341\030\270\005"
+	.ascii	"va\241\230\t+\035c&\234t7\234\245g\346!\334[\242dJ`\215\325\233"
+	.ascii	"\223^\006\374\232\350\372\032-\353k\350\326\327\\Y_Se}M\334\372"
+	.ascii	"\232(\353k\334\326\327<Y_\263\266\336\226\331\033\3467\360\226"
+	.ascii	"\351\03263I\231\270c!\232\245fxx\315\220\3657z\373~\375\356w"
+	.ascii	"\311\2549\347\244g\216\362\t\322g\344/0[Yq\020\276Hr\265u\307"
+	.ascii	"\374\2229\230\266\273\212\262r\001q\250l\300\210^\300\373\007"
+	.ascii	"&\256I\246*\257.\326\270\246\256\230\206\201c\344\307\217\026"
+	.ascii	"\215_\263\264\376\267\357_\315M\251\2343U\372\314RJ6\352ooSk"
+	.ascii	"9\3747\366Z\002\374\307\277\007+x\346f\030\0369g\373\267\006"
+	.ascii	"qkfi\220\323\272\234\227\272\222DtM9A\273\246v\234\226\272j8"
+	.ascii	"A\273\246v\234\240]9i\311G\322\216T\356Jr\202\346\274\223s\316"
+	.ascii	"yi)\211\204s\312\t\332\314;N\320<\225[\330M\331\374\354J\312"
+	.ascii	"K\316\274\223\227r3C\235S\0328-uM9A\233S;N\320\256\251\f\355"
+	.ascii	"\312:y\251)\345b)K\355dhW_\206:\247t\234\240\316)'hW\017\353"
+	.ascii	"\304\005\221\"T`x|]\261}NK9\006\f\255\246\224N\235\323\323\231"
+	.ascii	"\365r\266jLY*\327\345L\200\234\265\234Rz\315\032\366M\251.\206"
+	.ascii	"\322\223\246\323>s\316\033`(y9\363R]\222\315uNd\316\234\311\224"
+	.ascii	"\2102\214\234s\026!\351Y\227u\330\272$\034Z\031\212)g\f\3623"
+	.ascii	"g\0309'\331\\\227sN\3129\013\245\264\2369c\3518\211\301\200\221"
+	.ascii	"\263\225\017\214\254\225\004\307\224s\253yy\233r\202z9\177\340"
+	.ascii	"\322\240b\271\351\231d\235\240\234Y,\353uI\255\320\244%\031*"
+	.ascii	"\347l\305\254bS2\374\032\377\002\033\030\276h\325\226\2764\016"
+	.ascii	"\r\213\251\361\335\253\331R\244KL\343_@\262^/\277\315*,n]\256"
+	.ascii	"\336\320\354\t\254\352r\261\320\253w\363\016\302\bfW\357\342"
+	.ascii	"\345\320\022\244\246-\354\f\r\214\177\241j\375\205\251\365\277"
+	.ascii	"[\356\035Fc\004\211\214{g\375l\016VU\017;\237\233\2753X\350\264"
+	.ascii	"\324y \245\007X\343\272\277\261n\226\273\265\212\207\365\004"
+	.ascii	"\254q\347Kw\347\330\304\304\2645\206\273Tp\232:9\373\b\023\305"
+	.ascii	"r\257X\350\235\273s\327\312\225\263ua\330H\227\r\0350[\240\227"
+	.ascii	"\234*g\375\254\220\252\205%Q\032\377\002\214\365vM\n\237\330"
+	.ascii	"\235r\253\3348\013\275T\376\373\326Ko\270(\326\017'\315\331\t"
+	.ascii	"F\354R\271-X?\234\3463K]\350\261\344G\225\300\234s\007\237\016"
+	.ascii	"\035\224I\276\314\254\370\3030\353\207]\326\017\361\326\017\351"
+	.ascii	"V\325mm\313\036\217\267\306\267f7l\033NS'/\265\210jr\327.\013"
+	.ascii	"i\242X6\304t\f\212\205\240\205\247U\344\242]&\367\311=\273l\027"
+	.ascii	"z\221\334#\267\311m\273jW\310%r\323\256\222\373\274e\327\311"
+	.ascii	"\205r\223\334%\327\310\035r\315,\364\256] \277A.\331qk\351\212"
+	.ascii	"\021\265vN+\270\257\247\250\225\216h\222\255\257\254\306\272"
+	.ascii	"\n\2136V\326\026\032\036f\354Z\016k\005\317\205"
+	.string	"\265\003\303{a\317\374?;l\332\335\031%\277\265\263\201%v\327\256\330\035\363\n\214Z\273\273v\271\256\242\267\207\017\3010k\305\251\261j\340Y;\034xPb?\312,\375\326\356\256]\257\244>\021\340\336\362\206\004v\020\226)\263AC\004\334u\266GM\200\345Q?\224\262\336\2614a\220\301\030~\215?\204\262~xd\375P\307z5\333\243~hc\3750\306\372\341\322\372\365\313\372\325\311\372\025\310\372\325\271~]Z/$\263^\370e\275\260n\275Pn\275\020n\275Pm\275\260\310z\241s\275\320i\275\n\270^\235[\257\276\255W\241\353U\262\365\277U\227F\022\030WN\215/\215\273ug\351\263\021\330\330\252\375\374\316\270oS\230\316\310\240J\301\214\r\376E]\251;e\375\354\006\245\272gc[g{\324\f,\217zc\374\374F\365\017\265+W\032\337\300\270Pj\023\0274\313}\372\205\272[\257."
+	.ascii	"\321\b6\276/~~\237\034\260\003\207\221\306\327\205\230\274\272"
+	.ascii	"5\353\2364\337\227\347pOGU\023_\017\036a\242\215\377\313t[\244"
+	.ascii	"gaH\2704\276-\376\016\3542w\311\346\3369A\322\326\370*5\222$"
+	.ascii	"'\300\306Ws\2547\367\231\036\364\252\022\315\371ys\013\272\211"
+	.ascii	"\335\346M\262\320\233\333\214\317\352\\\213r\242\342\277\007"
+	.ascii	"\323\f\317l\275(\2627\004\003\343\222\321t][T\326\321\370j\327"
+	.ascii	"z\225\306z\225i\005\300\025\033\363\363&c#F\017Z\326\030\003"
+	.ascii	"\300?\341\023h\030.\321\367\337\337}\355\327bT\300aP9\267\033"
+	.ascii	"\246jHTca\266=\352\243\226G\3550?\357\250\232\246\314\223Z\343"
+	.ascii	"\0340xX\313\215"
+	.string	"1,4\376\362\326\fk\321x\317f\013\326\037\\\343\247e\326\367\222\035\222\236\303b\204\351\210X_\351\026f!d\371\341\245\271\264^w\351-}\327y\026\332x]w;\245\265,\255\341\3314e\321\021\360\232\316\246\331:\253|\357\212P\211\025\311\371\331a\030\003\255\251\244\203\237\002\256!l\217\372To}*\267>m[\237\252\255>\266G\345\320rV\004\225\230\001\322\330\312\377w\025\033\247T^\362\343\322\005\2551\225\2601NJ\215\237>\327\377-\245[\3508\013\355)\375\304\347\371\020\234\3304\026\304r~~\204\236\322l;\2464\224\216\342\305\201\220\347\036V`\316O'\2305\274\025\377\035\005\356FI\343\327\327\370\215,\314OJ\343\247V\253[\267\265\214.:\3004~\372\264>m\261\036\243Y\217\375\326\343.k\255\3464$*7n\265n\202\317\2347j\013?\244$i|\234e\375;\215\t"
+	.string	"\304\242L\032?\004&}\304\246}!\261v<\032\210Z+\351$\275\244\241\375\354\263F\263\320f\322\\o\263Fr\237f\322F\222X;\033\275\343k\355'H\227\205`\222\032\306h\241\304,\353|!\230\244\206LxN\032\213Ik\365V\006JN\271y\303\001V\234yC:tP\363\270"
+	.ascii	"\021\243\203o\266=\352\0076J\3204V\311\356V\345\fJ\024\352\377"
+	.ascii	"P\245\213:#\330\370\032\264\354\330\241\216e\0207\245d\212\r"
+	.ascii	"\227(\037\027\261\253cn6NM@$\215U\036\352\217\377\303\034\257"
+	.ascii	"\265.U?T\037p8\302\232Q6g\262\374\270\250=\260\322%\3532R\347"
+	.ascii	"\346u5\207\227\252\303\002\332g\266r&\371\031\200KN0M`v\322\342"
+	.ascii	"0\004\3065\027vU"
+	.ascii	"\307\234:\210\366\326\245\202\t\271\340]9k\254~\245Y2\366\310"
+	.ascii	"p\374C\233\2609:\277\306\327p\265^\003\225\215\337\206z\303\236"
+	.ascii	"\345(\333\304\354\211,0g+\016\302.e\332\236N\013Uo\034\220\311"
+	.ascii	"\314\255\261\312e\323\256\236.\242w\023\322V\306\326\370\032"
+	.ascii	"\324\027Wc\374\026\252\276P\265\356\235MN:\313QB'F\310\030\t"
+	.ascii	"\314NV\034p\236\302t}5\376U\032W\265\256f\2010\302\371\220`i"
+	.ascii	"i\215U\254[\035b\322\234\032_\265R\257\376\341p\354\313\2234"
+	.ascii	"\215\177\001\336\252\326\360`K\360\306\231\306W\253\376\017/"
+	.ascii	"\204\331\365\020\322\270\355\343TuF\303\210\"d\253\261*\343a"
+	.ascii	"\376\017o\236,\t\323j|@\225\352\377\360\322y\335)5V\243T)\013"
+	.ascii	"\375\025u\352\317\034\234(MkW\032\377\002\272\365\366W\324\026"
+	.ascii	"\330_QU\250\2530\376\3410\212\215\257\256\306\277`\312\372\253"
+	.ascii	"O"
+	.string	"\377P\310\226\227%\326\370\027\300\255\277\200\315\311\251\241D\250\345\346\024\007*M1@vz\324\021i\374\013\256\326_eR\231\032\f\303%\215\031\362\363&\345\324\370\027\264X\177UIUR\227D\250e\ff\205J,0KU\361\200\263\026G&Jcu\251\207\314\372\253Ij\222\335\303M(\230I[S-\257\314\323\3012\251\026UJ\205\354\344/\260\317\314\360\350\032\247h\3224g\314\b\302\255\177J&%\323\177O\335\247d\314NH\230\247\200a\2140\311\032Z-YZ\3228\025\223\376\371\365E{\260\326?\345K\371p\022\021a:9{\311\251`l\030\331k\374\236%\274\247{x\251\226\024L\303\273\273\255h\226\322\362\260VaI\022\3268\355\222zI\365R.i^\2060wwx\013\337\234m|y\313RV\036\354\217/\0322\032?\003\026\261\247K\322\263\224\211\205\246b\251\226\037\245\334\324\221"
+	.ascii	"\"p6\306\325\230\260\306u\302\247+'j\215\237\341m\2755\203\246"
+	.ascii	"iz\321&)\232Y\026\266\364\211\255\013\0231d\256-\235b\353\254"
+	.ascii	"t\362R\333\227\250\\\252\226\242\341$\355\344\214\203Nl.\315"
+	.ascii	"\222\322\245WR+)\026\013M\345R(O\317R&\367I\345\3225\333f\353"
+	.ascii	"\302D\230a\211\346\374\314\003\374Q\207\203\241\347\313@\311"
+	.ascii	"\351\204$^\242\351\224\324-\215\263uV\317LU\003\005\310]``\316"
+	.ascii	"\317\377)\225\264\212\205\246S\3246\334\230\351\022\230D\305"
+	.ascii	"\177\032\327\202\315\333\213\254\246\306\251\024\013\275\362"
+	.ascii	"\204\243\3613\210\255\177\ng\241i\224& h|4N\337\316\347\"\351"
+	.ascii	"\305S\206\036\3533\344X\237\001kM"
+	.string	"\235\254x\321-\272\306\3170c}\006\251\365\031\236\326gPZ\317\223f\375\323\264\024\r*\367G\207v\207\005J\251\361y\004\327~\362\250)\222TI\372\374\2079F\336\300\2344>\217\337\3724\311\377!\006X\310\342\2441\266\217S\323#O\315\376a_\371!\006\243\361y\370\326\247e\251\221\177\210\243\347cmI\343\363\340\255O\2138\031\374\273j\234\022Y\231x\250tpa\253\215+k\354)\221\377\306H\201\244CP0\210\206L\343\224,\025\362tH\032$\035\"\2023\347f:$\347L\316\315\034k7\260v\003l\304\353\007\233\212\317\023e\275\236\355Q\255\333\317\323\261\032\272)Q%\215\317c\306\202\205\246,\244>N\270\372\342\365dNG\332\343Ow\244<Z\214\nid\354\370j|\237\266G\r\301\263#,\f\212G\353\206\205\2467R\260/\0366hTdOp<\375\372\323\256\324\253\277\252"
+	.ascii	"\231\322\330\036\371y\212#\347\316\r\320G\343\033h{\324\bX\036"
+	.ascii	"\365<0\270\270\252`\020\264\262\320\324*\335:A'g/\275\032\252"
+	.ascii	"(PcYO\265\376\364*\305\272{sP>\032w\323\317\323,\214cL\024\220"
+	.ascii	"\306me{\324\002\340QYhJ\225V\371\350\344\374\325&\226\352\205"
+	.ascii	"\301+3\343)\215?\225a\225\264\230T\212\352I`c\020~\236\316(\322"
+	.ascii	"\302\2152\215q,\217z\f-\304\260\3204F*\305A'g/4bYj\206\207/7"
+	.ascii	"M`c\242\322\250\026\243\346\351p\033\323\370\030\232\244.,4u"
+	.ascii	"\221B\371\344,#\001J\222fx\370\242\002\225-\351\213\247O\267"
+	.ascii	"\331\322\204\352\322\370\347\347\351\013\253\304\314\022*\215"
+	.ascii	"\217\241lM\231R\246\264i\2303\240*cl\215\263\202\344\253q\332"
+	.ascii	"4\026\304\013\252\3611\200\255\177\272\224.\3314\234t\226\243"
+	.ascii	".4]\032oK\324\032\037\003V\332L\233\\p\027*\251\n\254\3611\304"
+	.ascii	"X\3774\247\031o\211\260\312I~\032\020\201\033s\305\356L\343\357"
+	.ascii	"\b\246I\203\311:\347\234"
+	.string	"\305\204M~\370\210\356\204Y\177l\006\363\3413\367N\204\213\037)c;Z\326\357\300\255\177C\2016\224[7\025\342\210\330\036\226^\220\027]\201P\034\210\271p\363,'\345\270\215\375\250b\347\306\324\210j\374\035\265\365\307\177\267P\374\207\307\210Psf\252\004\304\275\345\r\201\322Ve\2571\006\314\271+\303\302\216\306\337A\262~\247\307\372c?(\366\2734\360\322YN\212@\337\230!E\204\231\354\n\255\361w\272\242\321;\026BH\223\005\254\0320.\270\364h|\0353\353\217\301@1\030\333&\"\314\331lr \204\252\205\030\201\362h|\235\275/_0\031\237\225X\266\262\3420,\203\n\326a=\254\207\275l\250\241E5b\247V\206\273\034{13\206M\210N\333\372\343<\234g\323DX9\223\3744@\002\304\313,\355\032C\306\013\333Y(\266\303[>\2702\246\345a\370\334\202\244\b\276\303\\\2022"
+	.ascii	"1\214.:\240\032_\247\006\256\303u\230l\303\224\t:\267\262\306"
+	.ascii	"\327i\256?\246\243\353?\235\027R\024`\222\025\315RV\0366\210"
+	.ascii	"\312\322\243\361s\266\254\307Wl\013B[\320\246\371\344$?\r\312"
+	.ascii	"\246\236\036nm\232*'\207\311\326\354\203f\252g\264\270\372r["
+	.ascii	"\377fk\266\307\235\220\233S\037\224\215e\017?\216\213\303T\250"
+	.ascii	"B\034qjy\020R9se\205\247\2447\304\240\341\361|\002\225\325\026"
+	.ascii	"\327\3709jR\244\340,\274t\226\247j`h1\362\207S\347\344\213\263"
+	.ascii	"\361s\210\300\301a\262\0074I\022\325\322#\216\253\361sx\340'"
+	.ascii	"\370\tv;!)\003\340\222e\036\025&\334v\354\36683\2615\274\306"
+	.ascii	"\030\312\343\256\320yq=\216\006\334\021,\215\237\263\265\376"
+	.ascii	"\230\355\026\212\331\360\325\252\344\344\31428`\311\251X]\214"
+	.ascii	"\"\215\237\003#-\r\253\r\263\024\007b\246\324\"f^P\301M\216\325"
+	.ascii	"\254\337\r\337\214\033h_\376\017-\033\032:\031\215\217\263e\375"
+	.ascii	"1\324B1\264\241D\2509\233T\034\300M\215\031\022\230s\025\017"
+	.ascii	"5I\370\226\314\032\037\247\354\211\317\236\230L\315\331>\235"
+	.ascii	"QR\331J\212\303\222%\230\314f\2511*\215\033D8l\3345>N\330z\034"
+	.ascii	"\251\365\307G,\024\037\301Il\206\313\271i\305A\020\270\013Z]"
+	.ascii	"\234di\234\344\307f\030\311\345\263sxTs\215\325\327\005\256?"
+	.ascii	"\036b\241x\b.\353\256<4\033\013\213f))\017\270\354\307Dp\021"
+	.ascii	",\325\371\211\\\214\306\030\262\355Q\333iy\324\337|\t\0225H#"
+	.ascii	"Q9,\036S\020\231G(\370\354\324l@\250xLADN`Y\202\203\f'\372\260"
+	.ascii	"$b\022\213\212CH\242\211\242P\262\b(H\t\"H\305\206\tp\240\004"
+	.ascii	"\212\021%"
+	.string	""
+	.string	"M\200D\006P"
+	.string	"\032a\002\350D\211\035fq\t\242\250<b\022\213*\204%t\214\222AF%\212%\217\t)\\\200iD\226\340aq42*a\347H\f\"b\022\213@,\231\306\024 \216\220C\036 \035!\215G\017D \001\210\204\020H \230Kd2(U\301D\032\225G\265\003E+\030\335\234\350\303\020\322\250d.A\024\205\216\216AH#\b\345\362\b\304\005\307\343\021\022\231D\n\231@E\024\030\227\352\nI%\0213\211\024\252 \026\217\230\205QPQ\261H=\321\207\013\240(q\002\204\t\202\222\307\021EerD\216\320\222\330\201\242P\262Hi$\362\024\201nt"
+	.ascii	"\200\001\013\243\344\210\036\240\245Qr\304\016\363D\037\206\214"
+	.ascii	"@\f\031\005!\217j\220*:]\002\r\031\3310\201\220CF)r\310\350\026"
+	.ascii	"Q`\\\342\345\262\250\024\022\"\nY\030%\203\260\222it\205\212"
+	.ascii	"\310!\343\221(\024*.\217\360Rx%\320\220\321\207\033%\221"
+	.string	"(\b\263P2\227\306\241\242\211\236\342q\bi<\241s$\036\2210\036\213'\340\024\221\304\243\221\322X\002\206!\244\261\003CH#\213\243\t\031tJH\300\250Dq\263\034B\032\227\033X\0321\f!\215EJb\315\222iT\256P\303S<\246 \242\270\371\340C\316\312\314)::A\242D\nK#\022\361\302\211>,\217I%\023\231\f\002\n\312@\bI,*J\216\bR\016\205\222(\344\\@2\242 DL^`\347D\037\202\200\224 \202\006\260\034\"\036M(2\211\314\345\205eM\006\212\312\243\fA\001(J2\227G#\204\210\311c\206\245\212\202\016\323\210,\261\274\200L\032\231AE\245\221D\216\t\312\f\240\2004\026)\213\314\242\020\207\023}\0202\032\025\213\214L\243d\362\002B\306\024vt>\370\300T\022\215>0\215\310\022K\026D\245\262\004\r56D&\221D\220R-*2\227,N"
+	.string	"aH\242@:*\001\203tI\201\"\223(dt\204\201\t\264T\026\217G\023(\n\0351\215L&\261\207\tT\303,\002\t\225@J\246\020\236`\"\213J\345Q\320\016\363D\037T\200@&\213\212\222A \260\350%\220\262\310<\032M\020\"\036\235\300\230\002\347\203\024\375\223\242AH\321?\304\006\201\330?H\r\002R\377\260h\f\017Z\002!M`\026\227E\023CF=\0172*\213\310\342\320z\021H\360\200\204\020H\302\207`\300\007\f\370@}\b\006\374\3740\200\204\237\365$\374\334\237\017 \204"
+	.string	"*2\211G\243\242\"\023\b(C\021\b\251(\204,q\242\017 \222F\rGb\212\"\343\020NQ(Y\204W *\357\211>\034\025\031}\216\307\244\022\023\0051\215F\351\nD\026wY<:\022W\250H\312\013F\304\242 e\252,\n\031W$\225FBE$\345\221hT\026\227;H\305\243\321\021\t\025G\"\321\205c2(\311L*\215r\204\214C&\362(\031\004\244B\td4Z\002!)5\024\205\214JeqE\022\bi\324"
+	.string	"h\350\350h\344\263\303,.\213\312$\363\210\b$\2044\246"
+	.string	"b\022\227@EGJ\246\t\212FK"
+	.string	"\330\024\217\304\240\345\005\246\262\270\002i\0042.\227\312\232 \245\220\261(E\032\213V\023\004\025\211\202\220\210Ek\316\362H\\\201L\032\231\304c\322HYd\"K\004)5,\213E\345P\221D\3618\204,\241\2108b\205\221\n\fB\307$\321\262\250$BQd\022W\030\231A%\030\211>HcPqy\004\204D,\002BR\326"
+	.ascii	"!\035\021\201\220\210E9\314\342\361H\211\227@\313\342\361\310"
+	.ascii	"\204M\361xd\002\207\211\224Lq\227\305!%\221y\303<2B\032k\204"
+	.ascii	"\212E\243e\312<\321\007\246\r\n6\351\022H\250L2\223E\027\222"
+	.ascii	"+\224\305\023\305\345\321Z\024J\242\240,\"\031\213\206'\372\200"
+	.ascii	"\244\004\201\244\344a\"\217\222#l\212L\242\t\242eQ\251\242h\002"
+	.ascii	"Iy\243d\246\2004\201\310$\222X\201hB\210X4\021\244\254Q2S\300"
+	.ascii	"\2004ay\304$2O\004"
+	.string	")s\224\314\024x\216\311\244\004\200\322b\221\221\211<2\201\244\334A\232P,\"*MX.\213AIe\nAJ\035\"\223H\242\206\310$\222(\026\021\225*\206\314\242\244\322\004\025\030\226@ED%\221\t\004B\b\313b\220\362(yB\250\270T\026W\024\2259Hc\321E\"\026\335\342QH\310X\244\252E&Q\211\205\314\023\001`\004SId\236\030B\032\205\224\304\025\224I\023\216E$\222H\024\024\200\033\346\211>0\217\214\230GI\240\242\025\214@,\225\305\025F\245\220\006O\032\025\225 \230\311\244\022D\r\023H\270\034\"\242H\032\325%\320\220Q\00529bE\221\304\362x\224\202\262\310D\026G\350\024\231D\023E+\244`\263\242(t\231@$\3740\221\306\243\365\004E\245\n\240\345\222h\264B\362\b\204\201\t\024\202\2114\036\t\277\200\005\214\320`\003\030\240\300\032\364a\t\202I4d<\252"
+	.string	"\2014\022\213@\004)\227 >`\220\\\241,.\201\204\212EJ\"\362\b\310\250d\356\374\027\342 \202\323\354\230\312\274\032j]\003S\367\324%\274aV\006\315\f\307)dK\234PK\250%\344\352k\200\322\240\220Kh\003K\217\276.\241\r\341V\032\305)\205e\2651\004L`\343c c}\2225)\222\207\245C\230\026\330Fu\245\216\2559\200\320\331\260\302e-\306g$\254\206\332\326gd\f\017a\225:%k\006\025\016\032\\\035\002\301\316f\3401`eeh4\026N\t\251.\224q\241\214\026\312\270\203\203*\222-MT\341\223\360I\030\225"
+	.ascii	"\270\273\034\202\2011.\214\212c\372\362g\327X\bC\b\205\201\213"
+	.ascii	"\365\027\276\300:p\002\345\360\\\b]\2507\204\f>\241\032\013\225"
+	.ascii	"\204J\302\246aR\227\030o\302\245\013\233\204L+p,]1\t[\254>\002"
+	.ascii	"\253\214\274\020\022($\272\376\302\346\026\272\031:\236\204I"
+	.ascii	"*[\235\222A\035h\320\250\203\034,\345\314\224Y\370\360R\213\246"
+	.ascii	"\271:\330\203S\252\254\375\240[\177\365\f&\303kWa^f\322&\t\370"
+	.ascii	"A}\t\252Jr\364\234_Pe\250P\0213\013\314\262A\005\315j\374\204"
+	.ascii	"\346\374\314\311`E$\206\340]\024\031\025\360\312\207\030\036"
+	.ascii	"\321\306Jr2\264\032\253`T0\252\237\225\362#\200\027\030*\261"
+	.ascii	"\300l5\203\303\257\206\271\352\247\366y)r\244\253O\215rY\tl\036"
+	.ascii	"oS\3346DY\237f9?sl\242\242v8\277@A9\341\371\330\223\302e^o;\274"
+	.ascii	"\244[M\346%\013_\227\024\354\202\027\030rB\364\322\252'\201D"
+	.ascii	"\304\270\244>\322\033N\\\316\362\266\262\300\260\246\266\\\305"
+	.ascii	"\313\361\253\272\221\325X\265S\357\210\210\261ui|\013=\037\230"
+	.ascii	" _\242$i\254\326\251Z\302\304\326\244\204yT*'\220,\320K\026U"
+	.ascii	"K\030\343\210\0310:\234\344f\307\217\035KX.\031+L|t\315\341/"
+	.ascii	"'L\372Zh,'\2276}\355\250)\202\225\306\256\3617\364\250R\005\223"
+	.ascii	"Y4\026\250\304R\"\177\\o\215\277\301\352\355M\235b\317r\324\002"
+	.ascii	"d\344\020\274\260t\325gC\215\273:E\b\244KR\217\306j\013\327\231"
+	.ascii	"\346v\325X\225R\203\225C\206\223\306j\224\307\231YS\262\245\261"
+	.ascii	"\n\347\367\344\211\332\246D\006X4\020\347\016\354\305\023"
+	.string	"\224\253mJBx@\301U7E\370\360\256\032\337'm\311U&KT\266\233\347&W\263\344i\211\226\264\253lW\327@\030\341|k\221!y\315\306\252\332q\254\260D\2116\276\332\344B\220/(\221\306\367\340\377p=\253\232\232j\254\242\221\361A\3655V\241\217\263\261\342\022\230\343L\t\022$\252\022{\226\243~\224\274f\024\311B\3456\245&\271\252\004\020\255.\t\326\221#i\223=\313Q\031\340\352\366\260\002o\344\270\230"
+	.string	"\033\337\307EY\031&\363q^<\035V\034,`\335Z\030\300 \017\242\022\361Y3\022\264\255\350\332\204M+k\310U\"`r\316\240\344\3124V\205Pq\021\205\276\250\303\261\343b@,\3070\212rJ!\204h\246&I:S\025@0HH\036\231\312\346\301>\023\300\303L\f\205i \006\231b\206HDD\222\224$5\2061E\360\233\223_\265g\260"
+	.string	"4#\217<&\037-;\037,\211J\371nbn\024\217\334\216\\B\b2}\356A\236\f\257\257ob\317+@\013\f\243 \202N\024\036\351b\371\232`8:6\2309\320U\227E\340\003\204\376\331\3775DP:\025\226\370\365\316\312\202#\372?\320\031\225<G\032rie\355"
+	.string	"Q\361\311e\265qiG\232E^\b\34278v!\275\276\262\177\322_\365\270\303\371&P\n\254\033\211\004K+\366Y\2647\210\026\344\223!\302\b6\310@\231\023\312\223\363Q\022\310\245\314\205dm*\333\327J\215\220\242\246O\031\221\274\023g\301rOGR3W\264/9\374W\353\216\305\257\005\002y\336\232!)\225\322\r\301\023\272\347b\303\254mHG\245n\024\b\270\262\372\244#G\361\326$0\350\335r9\013\277\345\320\304NX\303Q\001\217/67A\215\200k\361\213\361\336\311\226E\317\\\207m>m\371\032\360?\324\022t7\r(O\262\344\b\221e\312\t=`'IB}\342hs\375]\327w\276\241d\335\237\323\346\001J/G\231X\306B\307\024q\216\360wZ\256\204\310\332\007\210\"\032\277\217"
+	.string	"\023\210\200\252y(9-\245T\255\r\305\247B\021P\251\253\377\336b\275'\004I\375e\242\262S6\022\224\026\263{%\016w\240?_\377\351\311O\272\200Y"
+	.string	"\365X\367\016\201\031\375*3\356\367\r@\352(]\210\215\233\026\310\237\2160\241\350*\334x\306\345\261\214q\244w\032Ja\202\356u+\363|\327\200\203\224 \225h\215x\021\316\227\1779\023L\031f\303\354\340\231y\206\333\036\324\267\366\006\n\211\260k\220\212\b \257\330PBw8\366\226\352sWS\210\220\310\372\364\016B\216:\207\346\333L\032\271~\017\241\032\300\336\207T\264\243\320\332\356\241\205\373\t\202\020f\316f[\300K\210\306K"
+	.string	"\204\265\324\205N`\216\371\020\201\343;\274VI\341\037\220]\020\035GE\016\020\362\250\336@\037[>\312\n\370GB\233\334x\330\024\223]\005{7\257\313|\005\3375\311\334/\206\333a\244\255d\223\235_\275yn\226\205\331\323D\237\221\273\337\215r3$\323\331>\316\304Xhv\341rx\300\310\336\376\302\203!F\252\363\240\274\025\324\033M)\262\246\005\265\267\220\2074_\265V\366\302\023\030j\325\3661\231\337\312\346ir\213D%{4\230\271-c\231\320\226\322A\3152\033\257F\265<[\247]RY\022\3504\312\324\250;\001\215/v)f\377\036j\252"
+	.ascii	"\3364\301\250/\247<\f\370\030\315:Z\262\365"
+	.string	"o\243t\251\006\212E\320\224J\273Q\313\020\225\202\332\302\345\tE\302\004g\200\037(3\346D\362\300\340BOQ[t\233\227\272\006\241/\216o\227^R\304\rp\237\370\245\037\325{n\027\030\305\270/T\260\300\200t\366\250f\021-V\266OT\r\265\300|\t`\225\032\216:\223\351\362\020^\265.:`x2\301\035\213\342\254W\375u\023b\354c\205\232}\246\366-\fr\033{=I\331\306\366|\241\351\311>\357\013E\317b\253\346\260\352'\023\272p\215j\234#\216/\326\245\027\273\"\376\231\210Q\212\277\204>@\377\300\356\021{\211:\227\335%\337\030\313\212\352)\343Y\345}B\355Tof|O23\266\264\323H*\027\036\204\026\\\360\345\027\311\307M\007\256o6\030\004Z\303\2673\376\245\213\221\231\034\367\210\371_.\027 \353\203E\317\353\325\231\220\240\250\261\267\256lle\b\356\203\013T\336h\335"
+	.string	"QR\222}\002\242\027\351\377(A\252\322o)\305k\230,\203j^5\332\202p\270*\307CA\315\275\306\314\224\025HU\006\201\210!\311R\033\202\351h\313,\221T\263\3659G\3473"
+	.ascii	"\243kY\251Q$\277D\2562\034m;\002h\345;\255c\305.g\324~\2176+"
+	.ascii	"\262q\230\024\271|\336\265s\356jg\310\354\206Lpn$\354\242\363"
+	.ascii	"o\337\035\232\336\311D-z>\b\214\351\013"
+	.string	"n\376\240\221\206\332\003\0033\200\205\003\213c\332\365\032j3\006\275\375P\300\351\356\357\032\f^@~m\340R\016\371\313\204J\236^\005p3\321.\244\354C\253p\362\363\024\325\260.\b\364g\003\324\312\253\2634\257\340\"\033Z\376\002\204+E\204\331\0134;@\3173\353\267\214~*\3668\216p\005\302\nb\f\\\260R\362%Ix\004\262\254\255e\2611\262\013\233\336h\224\201\0031\352\243\206\265\352\245\311\372!*\016\013\334 \316\203\301\ntl#\244\2332\332\2074\230\2064b\240\314A\3321\016jU?<D\215\326\247\"\3224\310a\2437\025le\031\352\363\305q\205u\311\371E\320On\223\341\320f*\334j\002\005Ky\373\007#\275S\343\325E\363\bo\366\270\203ih\354\265\006\023\032\343\177(\210\204\252\243<$\262\022\251\006\363c\232#\327\007\252\263\023v0)\257Ch#\362\251d\234B"
+	.string	"q \304{\234\252\266\371.\277\332\272cg\003\274\240\356\201\024C \251E\016\333:h|\310{\265^\031\203f\304\242*\031\217=\205]\304\363\266\304\360\"\363-d\277A\246\216\2333r\304\207\3122\206\311\362\257\013\033\301t\305!\22443O\300\020\0234\367\207\031\3515\2350\312\002\225\237\357\252Jxn\261\007X\315\363\202o\223\316\031?f\021\273\021S\026\207\262NV\371P&n\033?\242$@w#?Cl\222D\202Q\233\341\270~O\336\271\033H\f\337\004\236,\352\022\177\241\242`+\321]\220\343%\001\"\\\222\211OJ\023\203\036\225\033\331xRy\243\031E\341\216W\334]\301\035\333X"
+	.ascii	"<\246t|FX\022:q\342\361\316n\021x\2428\210\303\271\f\342\261"
+	.ascii	"*\250\232|\323n}d\341\026\327S\013r\325\0053\354d\310b8)\252"
+	.ascii	"g\354K\003JI\215&\366$r*s\331\233-OT\373\237\342PI\341\221m:"
+	.ascii	"W?\001\322\350\2165\013\316\232\">\031C\2349\355\325\371~\202"
+	.ascii	"1\255\016\023\253T\261,\031\212LW@\210\243\340\004\315\354\311"
+	.ascii	"\205X\324\356\215\244h\270\031\274\300\200'\212|X\030\025\360"
+	.ascii	"\361E\021U\f$\273c\360\236\274/j\351\016\333\200hs\313Q\004\363"
+	.ascii	"\212]\267\323<\2344\204\3642\360r\243\277\2040\0022\211dQ[\225"
+	.ascii	"t\023\3319No!)\303\b\361\210\016\352Bm\3337[\306\365\245\207"
+	.ascii	"\004(\005\201p\260\t\275\030\204\370Jq+\3240\2664\260\002"
+	.string	"\260>6\236\310\337\270&\354\b\316AV\2031\234\213\256\316\025c\376E\214[s\214:\274\bn\325c\253\271\217F\270\245\220s\2351\005nm\240\265\312\f\247K$\313\226\277\246Y\265\004\203;\340\245\312\257\375i\375\035\017\316~zG\236\007B@\023\006/\033\210S*E\fy\242,\331@\\\243,$\370n\234\226\273\251\231\330V\204\373Y\302\242\343\235\"b(\354\364\030\036\007Fb\372y\244\\\347EA\360\307~\336R\002IU{\002tX\361iFyQ\222h\335)\243\357\t\253\0330\031\373\356\367\207\2273\323\273X\315"
+	.string	"+\2534{P\314\331O\221\210\3624\317\325jfU)\347s`\307\"q\251\343\243\3022\030\213\366\203\377\330\3253\311_\241\245\3631\rb\254\374\376\325\332\241i\006QO\366\2255\255;\017\f\236T<\343\033-;apW\321l\005\332\346\r\267\\X\323\330~zI\255\337\270a\356\242\224\312\256\364P.\002\341\337\254)dW\"\242\337!w(,\f&p\310\324z\256\235&\263\337\261\t\313\013\320q\302?.\344\r\306+\244\033!\222\204\315\021\373&\202\205\224\020\226\"\300~\2443PcN\0066\362\251LD\240\345,C\006\r\023\374"
+	.string	"/ \360\200ip`Y\200\212\210\2015\361\013\323\311`\367,H\274\312Ag\336\204\3055\333\300\002\234\220\255Q\\Dh\"\240t\336q&\353\031\002\277\244C\354\211\227\232\262\346\030\217M\270\220\231\206\354\274\016\3527\340Tp\324\212\271\244M\375\337\267I\020\021Jd~\222\035\345K\356`-\362\004Y^\203y\306`\371V6\207\212\027Ui\222\271\305\303\235\343\350\226\374\243\267Y\266\361\265\030\230\374\035q\t\020\263\305\272K\030e\032\250x\2015\323\227`0\303\375\004V\373\r\272\020\277#\252\b\020\235\177\331\310\245s\220Ho\221\241U\217\274A\203\017\356\271\226A\240w"
+	.ascii	"\371E\034\037\f\217\332\205\371}\3551Q`\007\214\363(!p\006\371"
+	.ascii	"\250\320t\025*B\312\245\336]s6<\214\002D\365\306\355P\n\362L"
+	.ascii	"&-Er]\234\271\373\354\216\221\237\356\332\251\\]\260\377I9>T"
+	.ascii	"L\270 \320\3325j\006[+.\276\212\205=\243!s9\007*\b\300B{\354"
+	.ascii	"\2455L\213m\226\031\263\253\227\023\030wS\240\255'TS\251\376"
+	.ascii	"\342\255\254i\267W\266/\206\314M\211\310\333\242R\277\bOr\304"
+	.ascii	"\021\037\350\253\356\263\366\235\211\226\030\350a\313\340`\321"
+	.ascii	"\324\304\230D\332\024\352\262K'7A\331\0214~K\270h\001P\037L\030"
+	.ascii	"\312\373<\222\361(\233\314\352\333\344oT\267\225Y\276\007\304"
+	.ascii	"\211hT\323+\212\301\f\023K\031$K\300H\270\346\260\320:\216\216"
+	.ascii	"Jo\211\363\203\222\"\034\020\303g\352V\"\330\316\340+\002\016"
+	.ascii	"\253R\222f\334\3320\361\245\205\274\362\303\252e\275\254c\\\250"
+	.ascii	"\r\211\361\373f\346\301B3\334\231\261\372\0364\221\377\263\372"
+	.ascii	"\261\024\344\270.\217\366\367wm\251\346\330\246\037\365y\263"
+	.ascii	"\365\230R\277#\032\277\206\214\347\364?\310\263d\020S\373\306"
+	.ascii	"mw\337\003_\307\370\323\367\016\272}\222\360T\311w\251\276\370"
+	.ascii	"T,\336\372\351%\374w\230\267\013\366oU\335ay\210\367\021f\337"
+	.ascii	"]}\026\311\371\311(\227\257[\272;y\333\020\230\337\"\356K\340"
+	.ascii	"\370\b9\336#\226!Q\354\016\363\237\202\017'\342:\210\371\274"
+	.ascii	"\367\n\373Gz\304\372\372\350\032>N\370p\275\202\304\357hv\007"
+	.ascii	"\370\025\302\221\316\337\251O\337\347\306\370x\274\214\364%\304"
+	.ascii	"\225S\317n\n\314^~\r\312x8F~\257\276,\232\313\305\357\202g\030"
+	.ascii	"p\236\230Zd\325\330\376\346\354x\365S\354/+[Q\364_G,\361t\343"
+	.ascii	"\017\303\366\036\024s\334\365\253\313\352\345\305\006\373y\263"
+	.ascii	"\036y\273}x\2439\373\3744\333>k\360\315\327\371\341\327\335\031"
+	.ascii	"I\021\233\360\254\303w\003@\377\n\027+\377-\305\354q3J\247j\276"
+	.ascii	"\372\234\250u6\366;F<\007\300\036P+\271\340\202\350F\037]QtD"
+	.ascii	"'\336\342\260_\344\b\030\333\200\340\271|\031\200\016\203\335"
+	.ascii	"\205\211U\246\377\250\246\222\377\305\327\320\346a\\OU\374/\203"
+	.ascii	"\236H\365f|\243\202\\e7J\370\277\201\231\274\311\341\333\336"
+	.ascii	"\226ku\277\276\235Z\224\243b\362H$\316\213r\021\276h/\200\213"
+	.ascii	"\301\305oy5\b\362\252\360\2316\376\322\216\251\317S\257{\252"
+	.ascii	"\036\212\237\216\245\227,\016\034\367\356\362\265\373\302\270"
+	.ascii	"\013\023nN\327\005r\333\373\212B\320\233\266\031\342C\305\203"
+	.ascii	"\220\316\256"
+	.text
+	.section	.gnu.lto_.symtab.842e9217c823b621,"e",@progbits
+	.string	"pgResetFn_servoConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\002"
+	.string	""
+	.string	"pgResetFn_servoParams"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\001"
+	.string	""
+	.string	"servo"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\002"
+	.string	""
+	.string	"servoConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\002"
+	.string	""
+	.string	"servoParams_SystemArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"`"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\002"
+	.string	""
+	.string	"determineServoMiddleOrForwardFromChannel"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\002"
+	.string	""
+	.string	"servoDirection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\002"
+	.string	""
+	.string	"servosInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\002"
+	.string	""
+	.string	"loadCustomServoMixer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\002"
+	.string	""
+	.string	"customServoMixers_SystemArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"p"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\002"
+	.string	""
+	.string	"servoConfigureOutput"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\002"
+	.string	""
+	.string	"servoMixers"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\002"
+	.string	""
+	.string	"servoMixerLoadMix"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\002"
+	.string	""
+	.string	"servoMixer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\002"
+	.string	""
+	.string	"gimbalConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\002"
+	.string	""
+	.string	"writeServos"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\002"
+	.string	""
+	.string	"isMixerUsingServos"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\002"
+	.string	""
+	.string	"servosFilterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\002"
+	.string	""
+	.string	"gimbalConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\002"
+	.string	""
+	.string	"gimbalConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\002"
+	.string	""
+	.string	"servoParams_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\002"
+	.string	""
+	.string	"servoParams_CopyArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"`"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\002"
+	.string	""
+	.string	"customServoMixers_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\002"
+	.string	""
+	.string	"customServoMixers_CopyArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"p"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\002"
+	.string	""
+	.string	"servoConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\002"
+	.string	""
+	.string	"servoConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	""
+	.string	"inputSource_e"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\003"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\003"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\003"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\002"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\002"
+	.string	""
+	.string	"rxRuntimeConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\002"
+	.string	""
+	.string	"currentMixerMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\002"
+	.string	""
+	.string	"mixers"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\002"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\002"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\002"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\002"
+	.string	""
+	.string	"axisPIDSum"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\002"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\002"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\002"
+	.string	""
+	.string	"motor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\002"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\002"
+	.string	""
+	.string	"pwmWriteServo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\003"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\003"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\003"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\003"
+	.string	""
+	.string	"servosTricopterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\003"
+	.string	""
+	.string	"mixerIsTricopter"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\003"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\003"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\003"
+	.string	""
+	.string	"scaleRange"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\003"
+	.string	""
+	.string	"servosTricopterMixer"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\003"
+	.string	""
+	.string	"servosTricopterIsEnabledServoUnarmed"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.842e9217c823b621,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,319 @@
+	.file	"servos_tricopter.c"
+	.section	.gnu.lto_.profile.4053c2d625a90e62,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.4053c2d625a90e62,"e",@progbits
+	.string	"(\265/\375 3\205\001"
+	.string	"\224\002'"
+	.string	"\005"
+	.string	"\242\316\326\257\007\002\002"
+	.string	"\002\001\002\262\374\202\245\005"
+	.string	"\003\274\205\242\255\006"
+	.string	"\004\240\342\234\212\n\005\240\342\234\212\n"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.4053c2d625a90e62,"e",@progbits
+	.string	"(\265/\375 \031\255"
+	.string	""
+	.string	"x\r"
+	.string	"\003"
+	.string	""
+	.string	"\003\002"
+	.string	"\001"
+	.string	"\001\003"
+	.string	"\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.4053c2d625a90e62,"e",@progbits
+	.string	"(\265/\375 \200E\002"
+	.string	"\024\003t"
+	.string	"\003"
+	.string	""
+	.string	"\005\200\200\200\200\002e\001"
+	.string	""
+	.string	"\002\004d"
+	.string	""
+	.string	"\006\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\003f\001"
+	.string	"\201\200\200\200~\001\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\003"
+	.string	"\b"
+	.ascii	"M\005\320\025v\216\302\362\022\203\347=,C\270\334\272\2016"
+	.text
+	.section	.gnu.lto_.jmpfuncs.4053c2d625a90e62,"e",@progbits
+	.string	"(\265/\375 \030\245"
+	.string	""
+	.string	"p\f"
+	.string	"\003"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.4053c2d625a90e62,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\204\004\002\230\004\003\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.4053c2d625a90e62,"e",@progbits
+	.string	"(\265/\375 &\275"
+	.string	""
+	.string	"X\032"
+	.string	"\002"
+	.string	"\001\002\002\001"
+	.string	"\002"
+	.string	"\004"
+	.ascii	"<K\200\320 \340\r`\001"
+	.text
+	.section	.gnu.lto_.lto.4053c2d625a90e62,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_servosTricopterIsEnabledServoUnarmed.27.4053c2d625a90e62,"e",@progbits
+	.string	"(\265/\375`\f"
+	.string	"]\007"
+	.string	"B\31635PO\323\001 ;M\020a\335\242\330\263\370\b\030\360\352Q\235[\374\031Hh\254\376\340\306\216\336\200\020;\02113\213\301\"D3b\213dT\2546\254\033\221;\245\2466\263\3028\222\262&\266p\311\212Y]\021{p\260 \032\242\204\305\020\021\251y\305\215\306\222S\315\210I9c\306\323\036\255\206T\t4\335\354\017LW\325\177R6O\274\344\002\330\305H\360I\336Q\370!\227l\321\201\347.\371\235\351\322\025\323i\360\263\275\r\252\207\375h5d\033Z!\364#LG\300\267\253\361\265\254\212\204\"b\333cgl\200\340q&\220\241+\335\307\204e\327\213\372\361\3540\363?\362\002\216\023\016tqxQ\330]C\016\264q\353mkl\037\330\006\t\t"
+	.ascii	"2\241Y\037x\301D\360SA\273&\372Ed$D\036w\243\323N2"
+	.text
+	.section	.gnu.lto_servosTricopterMixer.28.4053c2d625a90e62,"e",@progbits
+	.string	"(\265/\375 \331\005\006"
+	.string	"\342\312)2p\307\351\220,t\354 z\221"
+	.string	"\3309>\031\301\035^\276\021{,B\2046\007\345\276\240\373\231\305o4\253jP\234\357<\326\017\325\267\321\334\276\3342\005\257(jUlV\027\255\222lj\250\225\311j\251\\\027\212\314\\\023\214\254h&\251\307'fQY\347\244r\002{\371\213\004B\017s\347\370s:q\2733\002B\216\267\037\334\"\017\374\213h\376~\226\024\026\013\335\241\007\207\016\243\204\202\377;]\373\031\032\037\005\002\350\240\241\273%\023\254\266Q\373\256\301J\235\267mLD\272\373\261\363"
+	.string	"\366\274\377\035\377!\3777\001\b"
+	.ascii	"3\003f:\343)\334\341\232\270\nA\274\f\021.\307\242\235d"
+	.text
+	.section	.gnu.lto_servosTricopterInit.29.4053c2d625a90e62,"e",@progbits
+	.string	"(\265/\375 \306]\005"
+	.string	"\362\t%+pm:\240{=\337\037\266\321O\344E\244\206\253\203\323\210\315\213\265/\350\300\202?\235\243\252\3522\026\274\\\030\003P\204\350\357-S\277,\212Um^\031\255\214mV(\266q\215@2\311\203)Yc\302\027\335\330J|j\030\345:'\345*\354\225\340\301\"/\177\330E\311\371\027\320\335}\t\376\261\372\024D\335\232\024\252K\201\221\347\377V\347~\223\001C eB\247\356f\331Yn#\367]\320\016\274\257\333(Xt\367\243\367m\366r\377#\376+\376;\002\007"
+	.ascii	"3\003\316\231\001\340\313\3472\376e\334p9\026\355$\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.4053c2d625a90e62,"e",@progbits
+	.string	"(\265/\375 \214\325\002"
+	.string	"$\004\210"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\033\177\003\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\005\036\004 \034\177\005\002\035\177\006\022\007\201\204\001"
+	.string	""
+	.string	""
+	.string	"\005\002\b\001\037\177\t\377\037"
+	.string	""
+	.string	"\200\200\200\003\002$"
+	.string	"\b"
+	.ascii	"G$>\303\024\r\215\341\334c\301\246V_\0064\"X\365\004"
+	.text
+	.section	.gnu.lto_.refs.4053c2d625a90e62,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.4053c2d625a90e62,"e",@progbits
+	.string	"(\265/\375`j\bu3"
+	.string	"Z^\304\024DP\346Q\007\31300w\352\243\351\255\277\325\326|3\356\377Fny\373\236\251"
+	.ascii	"\375\344,\266\266\274\300\f\333w\330'\362_0\3630\n\226\333\211"
+	.ascii	".7\002&\216v0o\f\334\232\371\207\341c\353&{\313\224\002\034\001"
+	.ascii	"=\0016\001\276\346\313\316\361?\361\377\333\303"
+	.string	"t\357\332\333<\215\233A\343\265'\016\3356\224\261\355 \"\367\037GE\031\210\322\025\211\334\221\263\246\355p\374\r\213/\260\036\211`b9u\223\212\265%y\222\323\366-\253\263\331\265\267\031\240\026\217\361+- \303v&\247EnemW\262\266\377X\333\341\365\311\211\353\221\017P}\214\223\361$\004/\323\016\306\303\264N\030\177\234\315\020\201I\346\264k\254\355\020T\364\371t\bjk\255K\336\244f\346\212\265\337\274I\365\330\273x\322\311\225M\341B\243o\332\243\375\307JH\211\260$\232\313i\233H\353+\262\277\320Ok\273\223\352OwR;\257-\347Mj\267k\351\366,\216\346\204\302`\310_\376\307LJ\261X\030\222\234v\354M\352\352\003T\357\366B\335-\347\354\366\270\356nv\273\221\257\335\255 Pw\257\335\256\247\333\213\272]\327\355\336\335s\335\355\354nB\335-\250\273\371t\267\236\356F\353n"
+	.ascii	"\335\r\247\273\323\347\363\371\354\356\357\316\034\272U!\001"
+	.ascii	"D\344\373\037\033\227\340\245\360uXIf\204\225H#\323\023\377}"
+	.ascii	"\245\360\310JD\032\3418H\343\022\254\024\032a\"\231\221\251\t"
+	.ascii	"\322,H\0167\241\031\357\002\023\177G\330\230\260\270\304\204"
+	.ascii	"c\3447\377}y\343\213\r\376\307\220\305\246\020\210\257\r\231"
+	.ascii	";\206c\204H\217\377\377@\330\260\f\371D&<\005\371?e\250\365a"
+	.ascii	"\026\336\230\371L\234\371\"\031{\260\033\377\b\302\376_\177\346"
+	.ascii	"\377\277\377_T\034\213\377\205,\301gaa\377G\003a?\366\236\271"
+	.ascii	"\361\237\227{\326\214\260\262\f\271;\343Ey\366_\361\353g\337"
+	.ascii	"$+\256\312\267\313\203\375\277\307\255gF\037p9\345\023\340\355"
+	.ascii	"\222\244MN;?\331\323\\\205\210\315%\275|q54>+\372R6w\307\365"
+	.ascii	"x\036\307\343Io\272[{\035\267\263l\272\230\244\241\n\336\364"
+	.ascii	"3N\007\215\327F$\235o[(\\\360\246sq\265\2447~\036Ee\207z\250"
+	.ascii	"1\020\025\025\225\304\344\220\031\030\200\324\337\233\324\245"
+	.ascii	"L\\\231\006|\220\031\224DqkWP\263~\251\311\275\375\307\355h\272"
+	.ascii	"wm\276\306\341\240\361\231\321W\022Co\335.\307\343\370\034Oz"
+	.ascii	"\233\263u\313\027\032\241\330\274\333\033&'L+P\231hD\214_i\204"
+	.ascii	"'\216\3102\247\235\202\255\215\036B\344IG\224_\016\313O\225\270"
+	.ascii	"\351\241F\356\213m\"$\201a+\204&\247\376\314\357\311\374v{\""
+	.ascii	"G\323i\032\362\225\3771\022*\024k3\003\245*=\237\317\247C\251"
+	.ascii	")\372gn\316\235\353\377\243\377E\332\234\375q\f*I\211\2161\303"
+	.ascii	"7"
+	.string	"rr\356\364>b\224\332\332\242\334q\366\037\235\333\224'a\324\b\265'\235\220\367I\205i\377\006H>\217\021t\257\035%\307\2346\032em\367\343\177\332\001%\035\220\0132:>\272g\213\220+r\177<Be;W\350\300\rj\027\004w\364\217\366\377\n\214\240H)\003\313\251\303e\017\344q\355p\376vDt\270\364_\350\316 \311\235\201\216\315\2110\251\246\215\336X;\323Y;w\253/,\376\177\017]\374\305\341\221\352:w\250n$G\275\301\243-\201\371\357\004)h\225bF8$\247\335\375\364}\345\377e\372\370\213\260\222\354\205\325\334\214L\361\037)\360J$\017\307d\306\024\371\371\343\367'\222\031a\3001\262\b\307\310w\351\003-;\303W\002@kI\221H!\302j\312e\263\332\236\353\362(Txq\005\334\252b[`\225\022\313c\257Z/\240\225\353\325\365\363!\271\276\237\210\001-;\303W\202"
+	.string	"\027\353\006iX\t\350\007[@`\007\236N\205\025\026\273\325\242\367\373\020\024\221\"\350\240\257|-\373c\263\326\266@%\201\n\303\214\242\306\240a\202\206\tjc\320\260\333i\240\332\255M\265C\335\326\222J\200\344\266\226\224\353\325\345z\001y\\2\272\246\202-\033\303\327b=5\260\213m\247\\ \260\235\n\340\362\212\202Y\275\024@\237\032\344e\371\\\374\200U1X\017\301-\257\023-\353\376\330\252%\326\355\241\340\222q\342(\006\213\205\272<\252\335\n\203m]\360\202\301^\227\f\340\026O"
+	.ascii	"\017\213\345j{?/\236\257u\231\\\036\006\367\347\363*\352\f\031"
+	.ascii	"\252\236T\230\b\261^I\265\254\333\005\274\362\265./\b\214\321"
+	.ascii	"\262\301)W+\313\267\345b\352\347\353qM]\265\301))\007Un\333s"
+	.ascii	"\255\262~>\254\266'\243\005\202\330b\177\277\236\326\225\223"
+	.ascii	"\016g\n&\310\222\262\234\306hG<x\230!3"
+	.string	"\216>\"\336\34209\315_\371\313\235\236\366<\\\315\b\024J\305\351\007\254\312\332\235\207y\230mp\b\200\213\250a8g\024R\206\314\210\b\311\214\244-\034`\002\221\2414z\021\2209\203*\220&i\317\237@rA2\372?e0\006 \036\362\2073\377\016\364\177\333_\275\327O:\034`\307d?\b6m\246\250\233r\b\345\265\rS\214P\324\276\306`Jq(\310!\264\361\006\354\021\241\r\263\277\"\371\026\352\322z\227\256\302x\214\001\337=r\306\tF\334\361'T\244\261\004\341)h\n\276E\347\f\324\t\2363\355\326\253\017\027\221&$_D\004\332\273\312\320m(\356\340\273\266\371\245\021Y\t\337\343\323\256\t\233\262\261hPb\310\216B\322)\205\312k\005\031\224\230H\236\"2\375\215\361.\025\204\372{\272%YK\356+r=\002\224\200\352\322N\255\347\371\230OC\242\272\031\003\220L\343\222\363\240\333"
+	.string	"\321?=\273Qb\324\330Vd\346[\307\203`\032\262\206\336\346"
+	.ascii	"`P\0239Q\356q\234\270\206\024\226\300E\2640jj_E\017|_\256=!="
+	.ascii	"\003K\204~\231yI\031\266\"\207Y\342?tR8\273\205#%C\341\241'\313"
+	.ascii	"Q\033\023#\267\321\3737y\376\302f9\275\n"
+	.text
+	.section	.gnu.lto_.symtab.4053c2d625a90e62,"e",@progbits
+	.string	"servosTricopterIsEnabledServoUnarmed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364"
+	.string	""
+	.string	""
+	.string	"servosTricopterMixer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371"
+	.string	""
+	.string	""
+	.string	"servosTricopterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373"
+	.string	""
+	.string	""
+	.string	"inputSource_e"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001"
+	.string	""
+	.string	"servoConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366"
+	.string	""
+	.string	""
+	.string	"servoMixer"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.4053c2d625a90e62,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
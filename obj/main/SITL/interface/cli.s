@@ -0,0 +1,6655 @@
+	.file	"cli.c"
+	.section	.gnu.lto_.profile.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375 \tI"
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\233\001"
+	.text
+	.section	.gnu.lto_.icf.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`\235\n\005/"
+	.string	"*FP\020=0\242Nc\217\303\212\373\362\330C\202\311%y\3530\247\331\260\326\033c\0235\tz\330\351a\325>\212F"
+	.string	"\350\021\374\326UU\" \036*XYt\2563U{\333\356M\366\336\335v\2222\356"
+	.string	"\356"
+	.string	"\367"
+	.string	"s\242d\265\276B\217P\006\356\032\270[`\026\023'\346\320\023\201\353;\200\275\332\352\366\234\230\230\356~\300\335/\301x\204\216\376 x\342 @\270\003J\207\237\364$\001\237\037\313UG\351ZS\2008\332\007\346\305"
+	.ascii	"\200//\263\203\372(\"\026\230\345X\216\221\316\304\360(\360\215"
+	.ascii	"@\254c\345\365\233\342\2743xP&v\221\336\023p\300\226\034\025"
+	.ascii	"\267%\275\312\375\301#\244\004\377M\256\351\303\2238'\237\374"
+	.ascii	"_/3\276\247\214|\343\2109\031\221\264{\326F\255\306z}V\021\225"
+	.ascii	"\032\211\321[\025CX\307\212\300\266\b&5\322\320\230b\341\373"
+	.ascii	"\376m\223o\364\020\321\\\370Y\026h\326\276\177\177\245\330\243"
+	.ascii	"\263\217\325\355_\025\247#\022\311\210\327\025fu\357\3767\374"
+	.ascii	":\223\276}\373\263vk\320\273\315\"\327\357\377\373\372\313\331"
+	.ascii	"\260M\032\230N\242\225Y\002\332MK\233SGK\337\253\216#i\207\346"
+	.ascii	"\233\356\337\241`a\026\026\026\326\227\307\272\205\007H\332Q"
+	.ascii	"\003E\331p\341\0260|\326\313\013\267\360,\267p\312\205,C\333"
+	.ascii	"&\352\247\r\353\315\223\b\r!\206\247?U8\205/\377\302]\324C\307"
+	.ascii	"\n\024\254n\325|s\302%<\302!\274y9\031]\374;4\341\301\365_\330"
+	.ascii	"\021\372\327(\341\352WW\227\357\364)q\360\374Eh\340\300\352V"
+	.ascii	"\356\335\006\237bp\006"
+	.string	"\327Z\241\203yl\036\310v\234s\203W\354\235'u\321A\325\365\202\303\257\272>\354\372\211\331\2555\240:\025\225\324\254\340\372P\237\222\272\376\002\227\252W=[\300<\223\3719\352\363\241\016?\352QP\177\372\222\262\214\224\r\256*\216\203C$\206\312\351\360\333\244\230_\0244\n\022<\301\021\374\300\233\336\244\235\326\350\323\261L\212\271N\005\363\004_nr=x\3008\214o}\353/\016\337\305\335\267x\213\263\370\201\257\270\276\212\303I2\234\0270c;\220s\324\334\265\321\221\342)^WJb\325+\307ro9QC3\034\360^\023\371\320\352n,\333\307I\371\372\330\330_\376\362\225\272/@5P\350\023%\256M\2248\211O\355F\201\201\366\320p[Erw|3\270d\304\320\327\237?\177\304\335\303\354\236-sv0\224\016+mG7hg[\362R\026\361\345\231b\252\340\023\317\213\263b}\302\370\270"
+	.ascii	"\021\342\032\304\335\203`\367\244t{,>\374\303c\326\354\312\030"
+	.ascii	"\243"
+	.string	"\n\017Z\317:\223\013\22566Jau\253\016\317\372\213\324\265ge\361\204\226\025\371\240\034\232\320\3121\\\356\362H$\265\330\211\026\216\230z\353\316\351\025\232\212\210\313\334\240y!8l\270\206\f\317\360$\367\021\236s\314\007\255d\234{\004\346!\032~\226\005\232\355(\224\314\232\332\030\035\263)\2665\3560\033\214\324\265N\3426\245\333e\3157q\334\370\r\033\207oC\013\236\2561\343\334_\264;u\226\271\333dc\313/\241d\263\276:k\333K\215\303Gn7=\203s\273\213f\323\320\021\242m.I0\206\203]\266\030r\363\251\235\251\356-[\213\276\246q\032G\301|\337\374\316x\3550\215DF\310f\267\263\3505,\213\226\307\215\245j\006\f\233\032>\321\310G2\347\243\023\2756z\025Rk\242Y*_djLt\353\247j%o\211\022\256s\315\370\f\256O\275iE\\$\363\226D\257n\212\330"
+	.string	"!\321\357a!\035\232#:\216C\013\224gD\257\204_a\324\"\032f\324\347\207\f\021\031G\266~cp\240\f\321\310*P\004\025\205\304x\214k\026\220M\020]\220\263ar\350t\001\321{\314\215\234F?\366\025;u\215>\346\264\200\353\250a\271@\221\241\021\021\022I\232B:`\202SD#\321\003\022\200\264)N;\243\314\314\214\202\030\225$;\373\006\360\367\275\244\234\005Z"
+	.ascii	"\226\300\022 \007Y\004\3376\236!C8\257\355\024z\244\302<x\037"
+	.ascii	"\036o\342\267S\033\206\3567\025\n\327\001d\302\bDR\364\021&\366"
+	.ascii	"\364\337\366C\352\245\305\220]\272\227\033\300l\351\340\321\310"
+	.ascii	"\336;F\220\357\203\017\216_Z\030M\231\207Ky\361D]\241\206|H\034"
+	.ascii	"U(1\017\371\315\327u%\036W\364\261\264\272\013\314\341\364\016"
+	.ascii	"\324\320w\225\004p\177\321|\262g\027F)\"R$\310I\215=\002\344"
+	.ascii	"9pq\346l\032\307\032\366$*\3633\364\375k\177\223\017K\2779\313"
+	.ascii	"&!I\350{\033\005'!P<xJ\352=q\350\230Q\205c\356PC&\3419%\360U"
+	.ascii	"\324%\340\231D\023\350\002\356\225\373\003\321\330\235\356\036"
+	.ascii	"Y8\243\34242\025\230\214d\226\254~\275Z\360\306\257\367S\232"
+	.ascii	"Y\201\260Wy\257\355\361%\251^\026$w\325$-O\331e\201\361\301\213"
+	.ascii	"\200\353cQ\r\324\327<\306\b\364\373\343)\207L\020\t\373)\222"
+	.ascii	"\350\n#\350\236%!\316^\037\252\253\227yX\301\024F\237\345\221"
+	.ascii	",R\200\034\376\243}F\365\276Gw\307\257N\346\021\336\215\266Y"
+	.ascii	"\265\215<\3309\343\305\007-\316{4\310\350\356\314o\016EV\231"
+	.ascii	"\354\336\205\257\257.`P\336\035\2302M\371\372\036\323\344\336"
+	.ascii	"\024w\223\337\036\2105\327u\n \344\202\262\030\344\033\362\031"
+	.ascii	"\307B\327q<l\016KncE\362\250U:s\2226\333\334\2231\355,\366<("
+	.ascii	"Y\020z\001\0320\275\037K\377W\273N\303\006a"
+	.text
+	.section	.gnu.lto_.ipa_sra.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`\013\020\275 "
+	.string	"\346\026E5\020W\222\306"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\b\376\202\007"
+	.string	"H\370\025\\\341hm\267\t\317\262\267\310\302\352\222\247!\314\212\177\253[\331>\331\2224\262\245L)-"
+	.string	"7"
+	.string	"7"
+	.string	"Z6 C\344\n\200I:\200')\246\345w\307\363\264{;~\263\242\226\353\325\006Y\331ej\"\375T\265R\177\326J\225\251\242\200)\001\246\356\\\026*P\260\362\tW&\301\355#\234%\223\026J\227\255\r\204\007\353\340\267\006\f\232\005\365\254"
+	.string	"\241\004_\320\215\314\024\214\032\001\272\016\\\f\244\246\300ZF \005\365B\225\262]\224\206Z\250I\026\367]\255X\025z\n\325\236g\024'L|\211\262>I\254\215(\021W\210S\314\235\006\302\017\036:px\203\0324\241\f\030.\\\362\354\356x\276\224\243\354P~\342\344\021r\212\245\376&3\371%J\252\254I2\222?b$]\244\206\b\t\222\006\362\303|\364\230\307\016\0359\256\022\216t7,\331\270\3064\236\3412b\314\262\001\201\233\250\001R\233\244Ph\317\001\005H1\347\034C\017\022\240\002)\305u s\b\031eFF$\020\221\024\024\024$\2056\003\372`\303\317\307O?\032A;'5\321!\026,\203\f\007\265-\336\220q#j\231}+:\2700\320\200{\002B\260\306\004\r\340#\305\355\257fMv\226\256g\306\373a>\213\006\b["
+	.string	"\252\230<\345\273 \232\360\201\361\005\034B3\260o\202\356Iz\240:\324\254\223\331T\313\340=\324H\210O\266\306\244,3\350nB\223\207\017%\207\363W\322(\265\300\242\2254\001cgU\026\274\341\264\r\341e\300D\021\305\203\266OCW\206\205;Fi\243\351\306\236f\204\233\035Ox\263s\213BD>\247\317?\341"
+	.string	"j\317\247]\034o\0325\272y\312lP4\030\263z\242\003\025[h\314Nh\333:\003_"
+	.string	"S!\2725`\302 \001\317\246\t\033\331E\273\224\\\342\362\336\351\334X\325\245\224\267\333u2\306\357\324\221\361_\366LG\342\323ZK\272\3255gl\255\237{\027l\036\312\363\264\262\315:\300\277\237\254\366\211\346\301\006\264\033a;[\006\251\\/\361d\354\301fFU@S\204(\263\005\210\231K\354d\34047+\3074\332\221\345\263\003"
+	.ascii	"J\320\244-\331\337\335`\263$\365\250\341=\346q\242\035\035G\354"
+	.ascii	")\330\031\344\322\372\243>@\253\302\232L\224\b%\026\327\261j"
+	.ascii	"\b\261\255\344{{\275_\250\323\230\220\353\312=\227\020D\315\255"
+	.ascii	"\215R\303\t\023\222\314\304\3435Z\214\006!\343=\372\366\256;"
+	.ascii	"\330\230>\265\024-\270\307*1U\333\376\254i;\360<\212\3063\016"
+	.ascii	"\"\226\217\372\344\205\366\270\350\305\305\200@\346\333\227\036"
+	.ascii	"M\274\203\204\004v\351\325 $\340\306\237\276\335\261a}\341\301"
+	.ascii	"\366\221~\001.\006\352\241\372.=\246\341\340\345(5\256\327\020"
+	.ascii	"\327\333Sj\314x\235\314\021\025vj\253\252\211(\251J\210\026\230"
+	.ascii	"\251F\3510\200\227\246\345\303\351\336\002\237\2414\343\024\304"
+	.ascii	"\254)\346\364K\341R<\207\352\304Cc\375\245\224\027\214\031#\325"
+	.ascii	"\337r\344\317\226<\001\307\323\031]\225\b\3412F\323r\020\271"
+	.ascii	"\361U8\006\227\275Jk\006\212{L\335\276\272b\275y\354V\036(W\360"
+	.ascii	"\364\360y^\f\227!qc\252\317\"5\016\245\213a\343c\252\357\374"
+	.ascii	"\223y\247<K\212\020\202\373g\315I\314\306fLb\200>\\\334\340\032"
+	.ascii	"q\237\311\210\271l\237Y\020\216I\310ar\232j*\202[\026\023\231"
+	.ascii	"\001\261\343\030\355C\214\3000\266%\255\323\206\357Yh\r\312\306"
+	.ascii	"\005\310DS\222o0\241`\301\024\r\300^\207%\343\2303l,\372_\246"
+	.ascii	":\boT\306\245\233\017\263~\201\230Hdd\020\300\324mDke>Y\354\t"
+	.ascii	"\204Z\240\230\346-?_\276\214_\352i\306[\362/\243h8k\222Zh\321"
+	.text
+	.section	.gnu.lto_.inline.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`\023/u}"
+	.string	"\352\177\300\033: \250N\007"
+	.string	"\367Y\316\026\263 h\204\216\2051\260\216\370\341A\036\303\313r\325\225x\273\242=6\304\204\003\260|Aa\235r]\257\373\001\330\341\234riy\326\2336\3312\245\024\205\001\251\001\320\001nK\177*7\030\210\rk\273\265\360\340\030b\034\003\354k\265O\357\365\270}\013\037\232\031\202\3518]\345=55\245\345L\036!\333\313\354z\356r\374\365<\207\266\364\001\323\\\251SV\rh\326e]v\331\354\363\257\224\b\301\260\3756\026\236F\337\375+\256\215~\227/\375K\256\333\017\264\320\367j\266;\212\357\316\364\366\336*\252\026\320-\345\344Rs\316"
+	.ascii	":\312\333\273\245\310*e7\251\335M*\333\335J\343\\\316\031\252"
+	.ascii	"\241\2228?99\271\364\r\221\335k9gc\273\236\304\335\244>\275\241"
+	.ascii	"+]\227\244\217\227\233r\205\243\354\343C\337\233P\316\371\330"
+	.ascii	"\306nR\273IM:\337\335\333\243"
+	.string	"\030\217eC\264\3669\251i\334\335Y\277\005\321\332\347~\267g\275\033\242\265\357\330\3572\333}b\274\234\303\214\375.\263\337\355\361\211\342\322\256\336\313\306bs\333\375\225s\236v\033\261\336\333\306\355_mZ\347w\301\361\366\275|H\333~W\033\333\241X,.\r\217\333\336\375l\234\275\337e\277\313(\376\263\347\215M\200f6\323m7\212\317\344)&\276\375\354\347~\366\352\003a\261\303\363\366\334R\374\306\312\267F@\277\347~g\366\376~\254\3179\303\265\335R\034\306\312\367\246Ev\212f\342\276z\177\343\317\377a\347\317\347j\267\363\017\322\330-\370\201\266\237\217\345L\274\364\003\355\363\273\372\330\256\205\307\b\345\231M\350v\266\205cx\353-Y)\265\271X\006\t\016\305\376s=Z\337\3305\003\020|\350w\227\026\302\321Dp\362-\214\305M\021\n\001\256o\004\247\347g\325\017\330\366\247o(\026\020\321z\325"
+	.ascii	"}3L\205\221p\177v3\217/s\206\214\335\263\237{\260\355\262N2\267"
+	.ascii	"\331\334\343"
+	.string	"\r\177f\263\025o\317K&\323\3632\367\273/\017\034g\216\340\324\333}s\273XxL\\\232\035\002\375\346\327\305\244R\340\326z\357,\227\276\273\327\277~\240\255\313\273\363\347\007\351\362j\257\243\363(\270*X2u`7`\200\305\002.h\217j\273\373J\333\275\365\207m\324L\231\216gJg\007\242\023\260N\335>\365\344\343\257R\006\311\230\370\302R1_\316^\020\260V\357\357\242\265\372\201\003\013\315\205\265_/\275\311\272I\366m]\020\315\211b\261>\321\234U\315\373m\351#\026\2123\230\240\244c\267\326s\001\243dF\212\352]FK\205\307\006\222\234\004K\004\2564vG?W/\035\272\355\272lC\177\255z\351\320\330\317\032V\242\003\304<~\217w\3777\177\177\n;\257\r4\026\306{7\300\273c\307s\347{9\233\354\002l\333\355\357Q\212\333\312h\312T\325nC\361\342\342b\342\340\342\242%%"
+	.string	"\035-\200AN\304\250\016\232"
+	.string	"+\345T@\013+\302M\367G\265\\?H\250\330\027b\353\313\356\252to\277\235\365\031Lp\320\365\361Q\300\004\t-\215P\357|\016\365]\320\026\352\275\236m\007\362\231\016\325\370\372P[\261O\335. \311fa\303E\213\244P\350\217W\266\245\020\373N\340\330\320(X\321\250]\301\365m\024\361\351\323~\215\303\247\220\024\321\3713\365(\213\334[U\337p\302\312\256\321\244\266\273\216p\373\325#VI\204\351\331\322\006\3459\276\315A\242\203\002W\365\330Aj\300\246\301>\237/s\224^\274'yS6\343\211\245\245\241bQ|\035\266(\320\252y\3220\364\f\031\355\377^\356\356\2609\361\315\346\345\322\236\bd\f\217\322Z\001cch\003\027Rd\007S'\366\013\226u\273="
+	.string	"2\222\036\2376\b"
+	.ascii	"\301\254SX)\214\300\240!R\261$\2760\265$\360\217G\004cw\327W"
+	.ascii	"\n\315\265\276M\217\352>\254\251\311%\366\034\267\005\024\233"
+	.ascii	"\001\246-\006X;\224\b\261@\263p,L%\020M\231d\235\032Dg\006ZE"
+	.ascii	"\033X\241\032\003-lxh\345\323\320(\2763\243j\232Dg\341 \027A"
+	.ascii	"=\210Mt\227\210B\302Gt\263\356\213\263p\237\234\363\333\314v"
+	.ascii	"\256=\330\240)\235=7\216\213\302\270\2715\237d\b2\255\377\203"
+	.ascii	"f\007\n\216(&t\324\227\t@\273\035}\3011(tX\351\023V\353\256P"
+	.ascii	"ll\215\374T0vx\377&U\332\016of\0061\254\037\365\007\017\2161"
+	.ascii	"\027\353\236\241\362\333\216\016\255\252\354\r\355Gd\213\325"
+	.ascii	"\021\264\350\222\r\264\27411m\311\325\340/&g(\321i\223\233J\212"
+	.ascii	"\f\\\361R\007\222Ugh\254\3277\346\213\347\357\263A~\326\372\232"
+	.ascii	"\304\320\244\206\265c21,{p~\214a\224\2647\256h\301Bga3\326=\305"
+	.ascii	"\344\277\031\032[&\250\256\320\244\"\321\220z\270\373\225\324"
+	.ascii	"@k\366\026)|\217\351I\"\274\320\024\272\033;\262\241\370E\322"
+	.ascii	"\"\306\317\276;\215\333\277t\223\332\244j\345\001\355\\\376\377"
+	.ascii	"\241\3309\254G\210\372\344\363_\233\035<g\323\256\326\276%\255"
+	.ascii	"_3w~[\037!6#\017\234GN\034\240\207\371\301Q\025]\r\333\215;P"
+	.ascii	"\202\177\325\341)\0257K>\327\256\245\221z\252ji\300\250\252|"
+	.ascii	"\220\272 hG\213\242i?\303\313\371\311\261s\236\n\340\222N\001"
+	.ascii	"\264gq,~\345\350N\261\0262Lm\321\2745Q\250}\310\335\254\313\334"
+	.ascii	"\251\356 \222\324\\\217M\317\006\"\226\351e\371\237\335A\304"
+	.ascii	"\343\177\272\311\1771\371\271;\371/\251\330\205oP@/Q\342$L\331"
+	.ascii	"I\272\335=\227U'\331\355\300\263Wx\250\365T!a]l\204>W\364\353"
+	.ascii	"\374\300\341\343\366\221\247c\004\320%\314\213\264\346\355\""
+	.ascii	"D\336\342\314\361\343\302\t\206\225Q\365\220n\237\342Bg\213j"
+	.ascii	"\016\b+\275)\232\320]S\2729\202b\312\026\362\374\265-\177\225"
+	.ascii	"`\3408>8\265\336\343@\302\036Q\237>\207NV\236\320\331\211j\256"
+	.ascii	"nR\251?\272=zU\216`\231\217o\266\275\352\030G\203\200\305\272"
+	.ascii	"\236=\273S\247\260\201\233\353\275\257\350\372\234K\316\331\252"
+	.ascii	"\237\335OR6\261\n[XU;\377\357J\327e\352\177\274\367\207\221\265"
+	.ascii	"\331\023\240y\274\357\373\366\277;\360%\303\253\341\363\311\322"
+	.ascii	"\374\022!\237\3176\263\241\017\230\3634\331\313v.\321(\272Y\270"
+	.ascii	"\267\342\2701\260PP\fC\357x\231\315^1_\347\313\354\367\352e\366"
+	.ascii	"\277W\320\227\352_\"\377\334?6\351\007\332(U\353h\226m$\270}"
+	.ascii	"\344`\261\023\267\3058\016\355vV\203\354\250\362\303N!\205\234"
+	.ascii	"\231\221\024$I:B\t\020\216\343H\036\006z\217\017\022 \323$\305"
+	.ascii	"\363\034c\210\020C\b\021\021\021\021\021\021\021\021I\222$\215"
+	.ascii	"\001\257\345\301\027\211\214\215\026@\374jC\361\036\264\006\030"
+	.ascii	"E\325\341Wp2\353\023\241\227$$\304\013\236\236QeJ\031\2702_\370"
+	.ascii	"X!\332\305,\022\367\031\340\003^Zp\304\013'\304H\202\f\272b\245"
+	.ascii	"GzE\034\241!\f\364_\020\301\3029\342+t\311QptqKe\272\210F\204"
+	.ascii	"\371\226\372\203q\034\026&X\006\265\357i\345A\257\326U\222f\207"
+	.ascii	"\375\013\337\2458\034G\254\301*\177lUB\244b\002$Fn\022J\006\234"
+	.ascii	"\334Q\023\302\314u\261\200\224?\244\221X\325\225\226J\035\224"
+	.ascii	"v\272\332\025"
+	.ascii	"\332$N\347U\035S\227\343\030\302\247\214\261\214T^\\\241\314"
+	.ascii	",2\023\037H\001^\224s\357\365\341/J1\247\005\2443L\205\037\346"
+	.ascii	"\255=\270x\274u\277\207z\215\252R\274/\017\203\325\314\021\251"
+	.ascii	"\3046\025\332qco\272\243\035\263\256(\321(\020]\213\342P\214"
+	.ascii	"R:\0174$A\311\0014\002\007\f%\346\251\236\237~\004\362\365cL"
+	.ascii	"F\205I\177\267\214R\255\235\351\235\262\2639\034\\\372t\356V"
+	.ascii	"\242&\202\225{2\312\256\316\212\357c0\355\333\223\375Mr\021x"
+	.ascii	"\216\302\231\354\004=\263\341z\364\n\024\260\246*%\n\177\377"
+	.ascii	"&\2028\201BB\234 -\271\177\013\375\004\354\226\376\353U\261\355"
+	.ascii	"\300!4u'\270\377_\3357\312\223\240\3702\356\247\032q\375\003"
+	.ascii	"\r\300\320\234_\360_\022`>\n\235F\222\314\244,*\rmd\207Fs\257"
+	.ascii	"\2351\201\200>@\347\302L\201\233\354\034p\353\307\3421a'0\212"
+	.ascii	"R\b\361\310\371}\207\007\232\241c%m\002C\254\2064!\3561\306\037"
+	.ascii	"\036(\251\201 8\245^4\033\310\307\300\315@\245Y;H@\240}G\217"
+	.ascii	"\230\241\r1h\327\276\017\236*\f\331\177iP,<\310\017\"\\\020n"
+	.ascii	"\360@\262\220\322\253:K\337\254\236\344\276\bH\375\210\313\362"
+	.ascii	"\245$x\374\377\236\313\031G\364^\362Nz\"\323\210\241 \337\240"
+	.ascii	"\343]\265\352\212\337R\200V\223{\275Y\336C,%[y,\024\227\235t"
+	.ascii	"S\3518\252\004\b\374Z0\256\365\343-\021\221)\"\025\275\345\002"
+	.ascii	"`\247\306\325[\2763\214\244\3649\327\313\310IGF\331\036R\210"
+	.ascii	"\205p\211?\323\f<\021,\005 \n\367\336\306<\002\313\006\335xH"
+	.ascii	"\033\261\274Z\\b\322\306T\252\315\241.\016\367\363x\034K?\316"
+	.ascii	"bcXm\022\333\035)w\254\365\364F\326\034\365_A\035f8\242\363\241"
+	.ascii	"v\245\364\220\004OL\373Kg\005\271;\267\245\316\320\024\265\020"
+	.ascii	"2\3663\364\033b\250e\253\277\350J\312LQ\263\313qs\344m&g\206"
+	.ascii	"\3045\204\"\347\213\360\215\021\206\2527\360\235n\013\273V\351"
+	.ascii	"*}\f~\312\026\355\270\261l\314).Sw\261w\225\337\225n3I&\306\364"
+	.ascii	"Wl>\273\016\230\216e\252B\356\372\177x4\235\3756\325%Y\236\307"
+	.ascii	",~\217\251\265\304X\232a\231;c%9\2444\200V&GG\325\276\340\367"
+	.ascii	"\310^#\311\032\327U\275\317\354\257\324`\035\314\355?\256*\344"
+	.ascii	"\0309|\344K\036\306\226!ItP\246\3057\206\t\2158\375$A:\t\331"
+	.ascii	"\320\330\265&Y\316\351\236\021\347(\263\321\030Rar\221B\337\326"
+	.ascii	"\n\331\"Dl0\260a\314\031g\326\027\267\001\260ab\373=\255\271"
+	.ascii	"\013\006\373!\211\202K2\r\031j\312\022\374\232P\364S\021\370"
+	.ascii	"\277\276V\007\232\260\3769\n\304\236\\\331\034\227\201r4*J\261"
+	.ascii	"y=B\224Bl\272`\302\332\336\301\032\022\221\373\220$\\\202\365"
+	.ascii	"\320\261\0011\263\225f\026\271\361\021\005\020\344a\372$\264"
+	.ascii	"\300\371\202\214\250R>F\273[\016\305\004\311\311\334\215\177"
+	.ascii	"\026n\360\022\275\326?\005\303\357!\317\342,\013\202\034\374"
+	.ascii	"\366\305\272\265|\314\267\022\250/2\306\257\263\341$-\f7<\377"
+	.ascii	"\241\320s'\241\334\034s\304mQ@\315\327\367\001wPg\231\253n\362"
+	.ascii	"ok\203\217\226a\034\017\017\205\301\201=\031\362\262`\275\305"
+	.ascii	"=\367\217\3553\243I\207\216\304#\225M\017\346\202\332,\354fd"
+	.ascii	"]\221\203\nB\360ZPL\326\207\374u\260\227N\\\200\032J\265\326"
+	.ascii	"+{\007dUy\366m\321\270\331\253\334\345\252p\307~\002\177\022"
+	.ascii	"\204\320\261\207\270\230|\374\323I\177d\r@\200Wf\2233\002f!\032"
+	.ascii	"\305\260F\341\350~\346\2115\361\2650\207\221\005\016\245\200"
+	.ascii	"\201o\314\341\214=\226\241\031V\231L\326B}&q\352\212\305\334"
+	.ascii	"\260\306\322\225\252\305\327J4\273\327\331V\001 \227\210\334"
+	.ascii	",\b\256#\207\346\022\307\002\310\226\241\316E\214\356\025j\346"
+	.ascii	"K\225T\031\321\004Rf\337\312\020\230\353`\034\352\212\006C'n"
+	.ascii	"\361_\271S\321\234\016\024N\277#\204/Q\206\344\375\006\302\331"
+	.ascii	"0\245\312\337,\345\272\347\325`L\353\342O.\016\222\3178\304\002"
+	.ascii	"\\Dl\237\r\377\027QH^\254\2613\300\344\235\343bGm\353z~\0272"
+	.ascii	";WcN\003\304N\271\314\226\036\r\026\366fC0h\020>z$~\235N\020"
+	.ascii	"\235C[\363m\345X\023\206\331\301\250\332\373\247\320\214\226"
+	.ascii	"@\276\275\351`\t\231\212c\227\314?\342\346\326\334_\372\316\320"
+	.ascii	"\372\367M\232\242\335,\227\022\206\254\002\f\022\264}\317_\202"
+	.ascii	"\305x$\274;\326/>o\334\225D\252\326\237a\302]\037\3141\363X\355"
+	.ascii	"\204\340D\3015,\364\233\371L\""
+	.string	"O\236,\320T\214y\003d\177\003\3233 \023\036\343\362\252H\037\021;b\343\321!\360hSF\363*\243\016\022,\001$\367\224\335\225\265\200\215\276@\\\270\372\2158)E\274\334\t\320\3676A\202\312#+\305\316\323n\213\343CF\211\222\305s9\331\202V\330'q\301\242\026\274\274\220\347\241lw\364\312i\306\302\304\220k\"Px\352\363H*\315\2559\"T\262\276\\\214\347\354\244\372+J\201X\212\032e\301\325\322\204Fk\"A^p\261\230I\244@\020\037\207(\353\033aU\354\022\373\2003cT\267\347\313*F\320\351\033\344\370'\313|)w\023t\336%\347\222\256H*\356\364\236JnE_\326\246\246\233\262\303G\001\017U\r\365\264\277\004\b\277\360\035\375+\323\002|\264\224\034\212\305\375\336i\201\016\245\202Y\273VB\362\017\266[)+}6\232\245t\232k\332\023\260)vuL\243sAgS"
+	.string	"\236q\345d\243\246\007Cl\307\300\270$z\250<\344\035\212_\265\301\210\245\001\177\207\311\372\352P\357`\212\247\332d\267\030L \203P)\224\274K\307\344\304\252([~\366\323\317\214|Z\233\200\n\224\252\371-\270\240A\354\321\314\321.x\033\2460\343\201\304\353?\275\354\372Bd+\005\025\260\230Ay\210D\233j\375\261\231YA\224\005\315\005g}\002\330X\333\373{Y\211\3246\224"
+	.ascii	"\342"
+	.string	"4\031\272D1'\235w\022b\024\177\f\302\016T{\255\322ZY\352H\177\"\250\321\020!\257\251 \233m\222\355\357\346 f\315Kr\201\310\2763\205\021[\202x\346\017bTL<1\321\231\rT\344b\351'\233\202\231\261\230\311\035\343\203\326~\340\216\257=S\342k\332\271\214\353\021\306\t7\261+\243=\322\304T2\036O\336\f<\006\200=\236P\316\214G\212\026\226\326\247\007\224\224\247\"\254,\177/s\nc\211^\331\030\243\272\241\372L<\315\0020\363\331\020YD\034\303G\353\270\265\352\003\313e&\353\023j\236\n\371\0279\266\341}\235+cGy(\231\226;J/W\320y\370\306&EW\301A\206\322\3168\336\307n\235\342|Q<\324\232\215\307\376;\320\024+\374\373\016X\352\275\234{\244\214r\034V,\360c\305Q\033\227S\335,\364O:\263\323\233H\333/\277\375U\334\3147\3578\350\344\206"
+	.string	"\021H\260\275\356/\017\251\271hq\321.\0215\177\202E\274q\rP\375\310{p\201 \235\317s\344\314D\315\245\260\324\367\312\254\302\317#\025\320\256\002i6"
+	.string	"\224BN\223\357\274\363\374\246L\340\316"
+	.ascii	"\263\033\243%\024\316\200\265hj\312BH~j\271x\274kF\203\201\266"
+	.ascii	"\213\013[<"
+	.ascii	"\316\360\020\272\225_\335&\025\220\364\307\271\363h\301\216\221"
+	.ascii	"\206\205\355\3739\005"
+	.text
+	.section	.gnu.lto_.jmpfuncs.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`4WM\260"
+	.string	"\332\332`,F \344msC\0344\214\242\002\033M[6/\370\f!a\324KL\265\210\301\201`$Dk\0176!i\242\270\026\366e\355\325\337~i[\217?1\235&\374\032M\354"
+	.ascii	"R\313\377\b|44\3746bbwJ)\005\224\002\275\002\275\002\336\315"
+	.ascii	"\300{9\305K\352\345\002W\t\215\245:V^\224h\251\215\2455\030\013"
+	.ascii	"=\235\264`A\004\321\301\237j\032\025\366\035\r\337\241[SSSS\363"
+	.ascii	"\035\372\275\244\331\016U\240\275\233\264\034\373\032\nU\317"
+	.ascii	"v\r\t\373\316\254\246p\354k\314,\372\203}\215c\256\246\235R6"
+	.ascii	"\366\251\r\366\231cKv\250S\347)\265R)\314%}\301\276\326\212"
+	.string	"t'\322\247\323\376\251\220\023 \366\265\323\035\366\275l\276C\273\371\016\245(\242T\252\227\340\240';\366\251\034\233y\212\301\276k{\354;!\355Kw\250k~\330\257c3\2659\354S\376\323\216\315\324\246\260?\264\204\307fjNho\354\323?\317S\217\315\374=\366\267=6\363\353\330W\241\022\300\263\231\017\205}\347\226c_\343Y\236n<\335O(\367\023\352\335\244\373\330\314\347\301>\375c3_\007\373z6\363e\260\257\375\013\3665\245\363<\317\016d3\375\216}\312\f\305\r\373\232\243a_c\313}\376y\016\262\231^\206}\347\322\305\260\257q\351[\330\247H\334\001\314\245\367\027\335^\264\223&p\364\226B6\323\227\260e\2237\312&\207l\246\277Q-\361r\211\001v\232\273\267l9\021\331Lo\002@\211\227J\274\254n\364\222\"\233\331\211$\3612I\001mt\377a\331\350\266c;\342|\304\231"
+	.string	"\346\322\027\331\314~\303>\367\220\227w"
+	.string	"\224\032\315\177\236\177\236\250F6\263\301\260\317\375#\344\245\320\222:\275tnf+a\207Xi\364s\253\230\305bR\263\231\335\306>\023\265\253V^\256\224\240\321MZ\330L4\366\271\273\317$\354\343\245\217"
+	.ascii	"\0010\2676\307\211\223f;\324\335\221\274\274^J\351\356O\302e"
+	.ascii	"\227\032\227\315/l&\t\3667%o%o\224w\002\335\375H<\260\037\303"
+	.ascii	"f\206\031\243\3510\311"
+	.string	"\300-\207\231f`\252\301{M\237\266f=\264O\317\\\336\260\231\022\330g\263\231\002\330\037B9s7\213\271\025h\327f@]je3\265\241\335Lm\25073\221\376\033\217\336\324[\325\355\253\0377\2339Tz\251\271Oo\321\255E\003\261\231'\2253\365\366\356T\331Loh7\323\033\352\315$\304f\266}g\336\372l&\264\233\t\365v\212\322\356\211\373lf.]\233\303\255\315in.5\355\310K\f\274\201\272]Cy\211\362\222\325\355\217r\352\345w7\350%\350e;o\351\356\347#N\005\301\254\301\232\366\225\272\b\212BI\351\\R\243\264\005\rB\302~\251E\020\034\373LY\004\371`\237\t\013\034\354{)\303\322\f\214\345\253\360\017Zc\337\265#\376\206\315d\361\361r\272O\326\026\366\235\225\204}g\305\261\357/\247\2614\023\332W\264\367\226F*\2314\215\345\306\276{3\241\357K\224\262\330"
+	.string	"1\242\224\302\n\2030\261Yj\243B*\365\206\030\322l\007h\020\373\324\335h ?\354S\236ih\270\317\3366\r\250\016\373\376<\364\357\320\336(\277I\247fB\031\3252n 4H\022\2503\355\260\324\003c\371\361\243\264\247"
+	.string	"\206\226n\226\200\210\001\0011\245\024\204q\237\r\324\305\307@E\330\327\200rx\263\231+=\3667\336r\256\350\360U\033\2534\354k\274B\302>eojjjz!6\363\007\020\373\033\377\254a_\323\276I\323\316vgv?\341l\346\317\032\373?\205\330w\217\313&b3}\356\330\247\247\017\031\366\265\026\373Ta\337\217\372\354\317\004\376\363t\0379>B\330\327\370z\331\256\261\272\275\004\357\357&\201\333\371\273GhbH?\367\320\226->k\206.\360\362\002\021\274\021v\224\227>\335\036\202*\017\373\336\201\n\016\025\033\3665v:\355t\332\375h\025\035\373\256=\241\016\247\275Q*.\312P<\335Fl\246*\016"
+	.ascii	"\025xY\001\031\346\322\3078\037\255\300Y*\341\2579\026\355W\264"
+	.ascii	"w\331\235\204?\023\026\264#8\362n\215\203\030\035}\322\24156"
+	.ascii	"\335}\266\323\320\2323-\242\264\304R\023\214\345Q( 6`\305\321"
+	.ascii	"\317\255\251`\260\037\324\305\313.^j\340,5Xj\344\311\323lG\245"
+	.ascii	"\306>e\251\321\226\242\362\264\245\336\2543U\210}\232\322\303"
+	.ascii	"\276\306\031\244\352\330\327RV\364\023\233\231\272\301\276\206"
+	.ascii	"\344%\n\2032X\316D{\263R4\330\247A\211L\3610\226\032Y\232b)\212"
+	.ascii	"\247D\370\277w\1779\325\240\316\363\334\323l\207\316\232\232"
+	.ascii	"\232X\240b37E\354\373\226\207}m;\303>\345\262\275\002\225\212"
+	.ascii	"\212>\233\355\320\262\251\313.\341\370k[\316\336\270\244BB\333"
+	.ascii	"\027\366)J\202-\216}w/\333\017]\234\231\313V\203}\244\bf\240"
+	.ascii	"JC\270?\321eS\351\013\264\237\237\346;\020p\351Nt\211\032d(\213"
+	.ascii	"\227Y\234\037\360&\332\231h\007\236\373\317\263\257\270\236>"
+	.ascii	"\366@\341a_\323b3Qp\370\022\027\233\211\232\323]P\177B;\346R"
+	.ascii	"\332\231c\376\005u\346\016\203:\227@I\330wT\016\366\307\330L"
+	.ascii	"\324\013\366\235\237\362\321dl&\005\303\276\273i7\003\345\036"
+	.ascii	"W\374: V\255\212<\256\206d\365\270\n\013E\244\352]\027\330\231"
+	.ascii	"i\325\353\205\260\002\270\210|\315n\r\311z\277V\232V\025/\232"
+	.ascii	"0V\211\\\340\313\023;4bH\201\001L\336\361\212\224\275.\374N<"
+	.ascii	"r\325\273^\027f\240\342\321\331\343^\251\023\327:r)\312\033W"
+	.ascii	"\027\357\354\005Fub\243\373\035u\337\253K\342\242\361\205u`\365"
+	.ascii	"^_\227\004~Y\261\212G\230\224\257#C\262\326Z]I]\365\272\360\233"
+	.ascii	"u\260:\312\244\270\222"
+	.string	"\272ZG\231\224Y\007\253U\0053R.\331\211\03009\276>\025W(\243\025N\312H\205\305^\026\357J\003\334\001\3545\300i\3545\300\325\032\304\336\025\256zY\250p\025\f_d\013\224QP\317\264\256\031/\365\0031\225\027\340*\307yT\270\"\217\201*\\\205\222\001\227/b&\030S]\340\313\223}\255\331}R\277\216\f\311\024q\035e\225h\204u\242+$\307\227\231zf\354\310\020\300^\353\316n\20522@\205{R\243T\257\312\024\356\b7\217U\252p*\226]\341\352\211A\231(\336\244\260\312\270Jt\311\356\2532\256\032\215w\034_\260z\301\327\347u\327\253\022|\t\003\205G\256F\251\224G.\245ZQ&r\366\270g\024{\\\r\342\326\367\352\220f\342\212e\\E\301\353\n\340\221\253\261\016\206\342\221\213\362#\312\310\356\"]X\007n,\343\252\354\272\300N\234\211B,\343j\230$\336Q"
+	.ascii	"\026\357(\336\244+\"\341\331\01362a\217\253\036\330U\217\253"
+	.ascii	"\340\275h\310{T\311\020\254#\247\204\257X)\242rb*EV\212\254P"
+	.ascii	"&\315\270^\037RG\336.><r\325\350K\030.5\314\0300#W\241\214\334"
+	.ascii	"\223:rUJ\035\271\352D\001\256NT\253\023\213\241(\336zG\261\013"
+	.ascii	"\363\303\252\325s\2267\314\344\037G\034'\370o\334\215g3\207\362"
+	.ascii	"\330wnjj\245>\250\373\002?\324\222\271t:\335\211\344a\377\205"
+	.ascii	"hw\177\243\317h\327\206\254\360\023\312\360\247<$"
+	.string	"\205}\347=\315\204V>\273\335\f\305\261\357\355C\017C6\330\367\326\242\205\275\220\356=\255\204r+\241\032\021\321\220\013B\207\330\367\323w7\017\f\210}m\207F\362\262\335\201\272\275u\200y\331\336\254n\3576\235\303\037\264\331\0349R\002\321\306\241\211n@\265\rx\204\362\020\212\303jBubq\332\225\364l\246P\021\366]\250\215}g\241\032\354{IG\023\202\301\276?\235\336c\237;\b\2201\202\360\330\027\303?\210\016\373\036\224\206}\3562\2140\300\370b\216}W\362\242\212lc\3375c\253\030V\"P\224\221W\254!Y-\371\232][o,\r\tF\274$8\201j\325"
+	.string	"c \302"
+	.ascii	"\253\023["
+	.string	"@\305\001*\"\fpA\025\021\006\360a\033\373\256\031[\323\210d%\362\300\016\006\013[\025D\023\202g\3002\004\360V7\215\213\274K\212a,&\033+\031j\300\342jt\204kHV\362\216u\344|\030\210\362x\311N\244\374}\235\306)\006\303\327(\336\244\215\307\372\244\006\235\230\362\310U\361\316^\260\024L\265b1\345\331\013\246b\325\212\274\343\2127\216u0\215Q<\223u\032\247\370\222\235\353\304\033\243X\274\344\330\301PN\370~w\254_\007\276\\/1\254W\f\311\361\212\226\301\360Ev\242,\251\033\217\234x\343\233\324\215!\210\342\221\374d\035\322\365jH&ar|y&\214c\027S\261wol\244\374s\311Nd\261\307\325\373\275\220B1\346\303\243\007\206\255;\326X\231%<\222\251$xEQ\346E\210\241\244\021/IvGu\214\307=\251\035P)\232R\023\250\256\216\374\302\016\020`\025,"
+	.string	"\343qZ\316\264\302\317K-\023\306K\020\217\234\226\221\253D\033\267\270\"\215g\334lJ5\032\307+z^w\246\325\221c\016\350\352\254\203\251\360\032\253\353\205\004\206\255JT\275T\371b\304\260.\026\013E\257\316\302\2433\255\356\353B"
+	.string	"\303.9\246\031\363\201\230\r\304\200PA%\202\275\2108\316\343\214\312\204\361B\001\033\215\256\356C\252^u\201/\230\310%\t{\\\215R=\256\032\005`\206t\201\367\253i:Q\344\"\304Fc\365.\232\360\373\270\0049\361\341\252\245\216\\%\357\250\342\231\254K\302\344\030~u\364nR7\202\262J\364%\003/\365~\226\253\221\212\353\310i\343K\202\024{\367;\352\300\t\266Kv\256%Ly\204\001\300W\366uI\224\275\025{\\5\032\305\220\fa\365\373:\326\021V\255\212\306\357\353\252\013|\215e\352\224jt]`'\246\026\211\367\b&\003+)\213\221\262\320r\024\347X\025CQ\234"
+	.string	""
+	.string	"\366\270:\273\036\370\252b\210\024j\220D\026\216\325\005\276\322t_\030$\374]\020\354\314\2646\276^\b\253\342\365\272\360#\303\360\250\202\257\352\002_\244\330\221\343\025\013`\027\370J\352F\024\273\300\027\031\206GW\214j\365\303\337\327\275\304;2\341\231\370\374\201\230\347\031\371\374\001\231\347\352q\225\024\3030).J\203\364j\335\330X\211\274;\206_+\t\027y\327\373da\013\211\226\352\311\272\243J\344]\360\306B$\\\004\336XX\323x]\204\256\250\343\206\233\226\345A\206\024\241\221\021I\222$\035\363\022@@xP,\032\214F\303\252\017\023\200"
+	.string	"\013\004\301xP\036\013\006\304H\220\2028\206\2411d\0242\310\020\211\320\210\n\232\003\b\205\207\201\333Z\260\300\277\006\250\246gD"
+	.ascii	"L\007\345\fT(\341\274\231\001\300\3342\223\003j?L\253V@\270\223"
+	.ascii	"T\f\237\001\033\332\263\200w\3536m\211A\t\240\201\345\251\237"
+	.ascii	"5fC\327\222C\234\352 \326x\354\330\325Z\220\256\n\f\210\241\223"
+	.ascii	"\215Uk\226G\210\246\347\200\316\353bt\333\264G\244\200h\261\033"
+	.ascii	"ZD.\366\2515\r\035EV\030\264\321\304T\037\324Q}~\233\350\307"
+	.ascii	"\257\"O\356'W\0046\204\370\215\311\315\354\017\202E\211\256E"
+	.ascii	"\343T\222!G\254\333_\370\371C\354\255\202?\300\024\n\013\246"
+	.ascii	"\231\261\022\236\270VE\354p\004~j\217\350\2613\266B/%\264D!\362"
+	.ascii	"\036\376\260M\377\315J\346\270a\334B\202\276\264 \233[\322\205"
+	.ascii	"b\253\246\215\242\276\355j\265\302\216\306\242]j\353\310S\351"
+	.ascii	"BD \366\316'\220\317\340\325\277\267\270\360\372\017Q\317\335"
+	.ascii	"\332\230\206I zk=\201WgRQo\005\222\350\330\346\370 \002\370\006"
+	.ascii	"\365\236\013\n9\350\242A\247>\372\002\224\325\261\226G\243sT"
+	.ascii	"IZ\036\300\271\372\345\213\226\007\f\375o\\%C\214\332\004\003"
+	.ascii	"Q\257\234\210\006\335\215\027\237:U[\033\fF\031\264W5\b\031\322"
+	.ascii	"\242\302zla\005M8\"lIZ2h\246\3009\006\207[NQ\311\1779\006h\303"
+	.ascii	"V\301\315\n\366\276\345\300Cd\340\bO&9L\217\275\330\271\204\017"
+	.ascii	"\333\\\370\006\035\356~\"\2663\035\031\211\2400-IK\344\247JE"
+	.ascii	"Z3f^\370\310\022\313\210\322\037\2464k4\377Pq\355\217\217@\357"
+	.ascii	"t2&\351p\245"
+	.string	" J\f\016\n\n\314,\245\302r\031\252\374\3067\241\016\003\200'<\027e\344\240B3\216\260\025\204\277h\272\330\005\352+\215\243]\254\317\300\034\341\257Y\025\313\350\270\206\013\351\tZA\204\274\343\265\342\306\243\325\256^\032\214\330s\002\374\230W\217\321\206W\213\221\202\030\027>\262}\202\177\367\201\023\314\371\335T\325\364\031\267\357$\0337\203\271p\216U\360Xz\330\023\027\324;7;\213\350\026\312\314\022U\027`\204/\031op\235IQ\333\031_\344\3261\267\362\326\362\260-g\343\377\264J\270\003\021\222\360\016\214\r\205<\277\333c#\004\020\256\007\257\211;\026\020\214\203\262\223\350J\273\261\212\270\204\276\240\353\231\366z)\224\026\217R|mz\322-\002U\272J\026\3162{\241\341\317\032A(r\004\031\034fR\370\272\3302\005\260\310\3453\n\316\276\321\3712\034\376/0O\244\241\300\032\260\334W\335\027\352l"
+	.string	"\335\246_*\035\202\201\257\243\351\334\205&>\272"
+	.ascii	"u4F\3112\265O2BN\222\333\243=B\006\376\f_\355u\215\232P\263r"
+	.ascii	":\013\342K[!Ro\255\350\003\036m\032;\217\371c&\351A\351\370\007"
+	.ascii	"\304\235\t\345j\213i\376A1\254\035&<\213\256\317\245c\250b3\356"
+	.ascii	"$\210\360\363\325\177\036\254\357\022\364.\256\314<4\321\361"
+	.ascii	"\214\211\321\263g"
+	.string	"&\002>\320\365{fM\244q(\207\2212>\035\321\214\262f\271BOp\001\344\024^\273\001\323\021\345\322b\0372\002\013\313\221\264\310\2601\303\0312\322G\2121\030\254tw6\217\032\313\003m\312Q!\374\016\317ID\2572\376\367\004\203DM(y\b#\344\365\200\341\355\320\004\036\335\rt\250fh,\266\262\336\204\203\3741\270M\355\211\022\020=\373\232\n\002`\322\371\0071\335!D\333 \275\352J$\205No\372Y\300m\325\256\033\031\376!\207\"\212e\2554\272\335\302\226t\365/\221\344\260\373\233\013 \330L\220\026i\005{\034>%\264\234X\232\2676\370\270\016\261\201\203^qKI\2759J0\315\2443\362h\204D\275\342\245\217$N\016\037X\217K\230Bb\303\343\314J\250\025\271J\331\222l-\300E\260#CA\305\005\347\374\371\345\253J\005\026\367\034\302\372Bu\003\177\034\367\352\325\223g\360"
+	.ascii	"\257\005\331\375\317\204\205\266\211T\217K\356=\275\343\365\365"
+	.ascii	"\371&4Q\356\375\036\324"
+	.string	"\212\2161\030\266c\313P\0371\224KL\206J\333n\324\017\324\302$\006\254\252\231pQq\343LX(\256\216\340aE\322#\352\362j\375\361\211\215\323\022[WAm\262&5\027\037\263\304\231*\032\f>\005c%,?^\367\n$7jf\230'\351\037\360\n!6<7\273F\246\310%\256\333o\254\367\210\3377po3_\263\331~\300\024j\365"
+	.ascii	"\3330\320\035j/\356\205\001\017\377+f#\031AG\255(\270\303%\020"
+	.ascii	"\355\266\247\366\221hw\315-`\034Y\363\027G)\210\335\253d4\370"
+	.ascii	"@<&\370\250Y\304\325\363\222\377T)\204m\331\251\314!\037\b\373"
+	.ascii	"\016\0205\214\363\262,8\t\001E\020\305\373Mb\335\005\3619\367"
+	.ascii	"c\0309a.s\250$\263\272 n\261:\233\344 C\344\037:-\377\374\235"
+	.ascii	"\362\3312`7\254\370d\016\340I\3060\006)\326\323\022\276\301\200"
+	.ascii	"n\007\226D\376\315\263tKW\310\321\353\200\331\343\233\271\304"
+	.ascii	"\3754\222\025Oa\320\326\017\t\355\363\025\374\314r\307KA\300"
+	.ascii	"\n\013\013Aan~\313\254\005/^\177\r\263-\221\202\037\032\314]"
+	.ascii	"R\303\202\354\321\3751\326U\021\021z\324\005\037\207!\247%\016"
+	.ascii	"9\005U\225\0070\222y%\375\223K\244\210\315f\300\252\261\037\037"
+	.ascii	"\254_\177,\203n\232\235\250{\030\202\224\322\361\177K\374\f\356"
+	.ascii	"\b\327TP*_oM\3030h\230\033\036U\024{D\316\214i6m?w6\b\363\021"
+	.ascii	"\307\017:\343t\322\205\224Cd\210\217\035!Bg \344\032\304\366"
+	.ascii	"\245\221:$\375\266\264\363\300gA[%\267\362G\207Y\217m\007\033"
+	.ascii	"\177\345(\346\273\nf~\301\210\256\333\266\317~\333y\311\275;"
+	.ascii	"F\203\363\026#\312?\272|`\274\253RM\332\360\2135\365\2552\223"
+	.ascii	"\371\217\325\357\261\243\204\327J\007B\370\363\313\306\305\267"
+	.ascii	"1\241j\204K \366\342\024r\\'\362\007\314\250\332nx\355\223\372"
+	.ascii	"\006J\332\026\f\304\373\275H<\241\235a\251\257\223\220\3046\325"
+	.ascii	"\306\370\357,t\030\202\274\3560u\3343\274\004\020\274Ba\rd\t"
+	.ascii	"\f\373\3660\313\327x\013\307\007\030:\301B\252\334\332\331X\211"
+	.ascii	"\330\337\317`\024\217Qj\213Z\t\354x.\367\342\034/zl\"+y\370d"
+	.ascii	"\237\022Ke`F\364\372\222\n\261\333\366\233\212\257\356\366w1"
+	.ascii	"(\341\221\032\2533M\266m\240\032\350\365l\323:\263?\242\300'"
+	.ascii	"\246\025A\277%6\217\250\304{f\303h\207\246*\350\1778\237\003"
+	.ascii	"\340?\220iV\200\374:\262\374u\003\226o3\334\201#\263\234*\266"
+	.ascii	"\345\300\367\303\236\005C\216\201\324\324Li\021\207\243\254\246"
+	.ascii	"q\2003P\322`\247\301\rH\275\200\022\217W'\f\346h$\231\370W\033"
+	.ascii	"\270\223\347\314{\270\004\213;\206H\364]\007\2420]\246\342T\341"
+	.ascii	"\326S\242jf\224;\310\331v\341\263|Ig\251w[\341\342\027\240\022"
+	.ascii	"c\rN\373\263\216}\337\250.Q\212\332\366\312\221\265\320B\244"
+	.ascii	"\210\200\216R~Rh\214\033\277\\\201\365\027\212\226\215\321i\275"
+	.ascii	";Ul\314U\311]\256\035Dfb'\224*\301\004\311\276=5T\021\227U\202"
+	.ascii	"\356\022\325\030a\215\016\313\261\357\211\273\336\351\017%\""
+	.ascii	"\001\3423\207\226\321\346\3548dX\n\364\320=dO\345\311\313u\341"
+	.ascii	"\231k\346\2336H\255kG{6e\022q\262\304\346\362\322\346f\2648X"
+	.ascii	"\214\0135Am\t\3226\223R\210\200 +\302\177\346/&\236'\255B\"\306"
+	.ascii	"(\202\303'\352\211\243{\025\342\370sQ\352D\177\001,I\223\300"
+	.ascii	"\371\250\240\n\177\031\223\377\202\254\312G\275\017_L\240\266"
+	.ascii	"\313\350;7$\002"
+	.string	"\022\360e\315\267\372\205\336vQ>\276\200\207f\334\277\210\t\206\311v\372\327\241\220ay\260\207\343\231\341\\\336n:\214\332\206-\336\247\177vH\367\013\331\220\nT\214\375T\007](y|rT\357U\020@\201u\002\2468v\224F\256<3\007\271_\371k\361\277\255\320\305R\354\261T\247OHM\026\252\312v\246\254X\t\331\276&\347\212\334:\347\315+\266(R:\363\374\212J\2048\361<\312\003\300\332T\315o*G\002\273\311\022\375n\017&n\303\321\363^\022\251/\270\005\255\001v\32396&\325\006\321\344\376|\356\224\253\002\223\357\242\330\360{\032\302\332X\007k\016\220\224\371k\200\371._\275r\3348f(;P\316\033p\0356go$,\213=XT\3466\f\004\020\303/@\211\264\317\337#\244\231\260f\227(\356\370\251_\2444\020L\377a\366\"\017\350g \326\320\270u\323\271\364oD\334"
+	.string	"\366N\230;\331\240\315\025\324\271:\034^]\361\342\311B\220\016OYT'\235\b`T\205R\360\261\243\212\265\350\006UMH\333\220\343\213\003\264\354\030\302J0\346\276\002d@p\204[X\\\031\020\271l\371`\356GM\272\001/\323{*\263H5Q\267\027\031\247\252\024h"
+	.string	"g6\351\225\333\004\310\263R\225d|\303\003\023\211=\353G\226\245\3204\312\363\016\343S(\350&\365\205\211F\320,\332zR\330\346/\223\334Pga\210;r)\263'%9\332\234z7 )\020\204p\341\216\227\b\212\203\300\"\330=c\337\266o=\257\rW;\230DN\031\354ya\270\016\034(8\254"
+	.string	"\225\327{\262x\234\257r\350\360\355\025\252\251D\317\201\257x+l"
+	.string	"\250<\307*.A\003kA\220D\312I\304 \360gzDI/\362$\200\260-Z\342\304"
+	.string	"b\374!\023_J\354\247\037\222\253\025\310xy\236\366\004v\263E\013\257\255:m4\006l bE\b\204O\016#5\241\237\307v\247}\335l\034\211\t\333\226v"
+	.string	"V\025D\251i\322\214\371U\272\212c\257\340\327\206\325\320w\034\n\250`\323@\301\013Y3\344mk\303Lx\013\006\242"
+	.string	"\351b\235\353\353\001HPY\002@K@x\035\264hmh\370\235\326\317H\243EDbZj\225\206"
+	.ascii	"\341\265%N<'\035\"z\026\335t\027;\357\b\232\r\224-\021(\320\245"
+	.ascii	"\301\341\3203\361<U\025\211\373g\272+\022\263\340n\354\316\353"
+	.ascii	"g\005\256\241C\273\364\222&\006"
+	.text
+	.section	.gnu.lto_.pureconst.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`9"
+	.string	"]\007"
+	.string	"\226\3239+\360\244I\241\003\200\003g\340\222\"\354^\313:\247\304\253\216\267(G\333\334\245\326c\232\325\2753\337\006\321\214(BR\325\260\315\233\004."
+	.string	"."
+	.string	"/"
+	.string	"h1V\214\024\343\304(1F\214\020\367\341:\334\206\313p\027\256\302M\270\b\367\340\032\334\2027\202;p\377%\360+\340\354\3160\027\206]+\367\345\272\334\2265\226s\345\252\334\224\213rO\256\311X2\222\214#g\353\0249CN\220\263\217\353\261\326\261\306q7F\215\233q1\306\213\003I\027\351\036]\243[t\211\316\241+t\006]\240\373\363\3463\366\274\271\326x\306\235Qg\314\031q\316n\256\315X3\322\334\231Q\346\214\031a\002C]\200{"
+	.string	"\336.\353^\216\207\347u\355\260\356]\235g5^\325=\252\363\246\356I\335\213\032\237\256\323m\272Lw\351*\235\001"
+	.text
+	.section	.gnu.lto_.ipa_modref.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`\223\bm\""
+	.string	"\306l\226E\240\\M:\"j\0278\362z(\021\005\305m2<\301\235Y\217\246'\321\361X\305\257&\247\207`T\243\372\351Oz\325v\365\377\036\276\315\321\020\267\3418_\033}_\342\2001)\303\257H\tz$\352\326\210L)}"
+	.string	"\200"
+	.string	"\205"
+	.ascii	"\352\177\0245F\243}\016\0320\360Z\020f\364\f=\025\214\336A\206"
+	.ascii	"\355`;\331\356S\360\177\321\313v\232 \312\013\202\247)\365\255"
+	.ascii	"j\303\374.\007\316\205F\223\355>\003\005\214\300\036\330\373"
+	.ascii	"\200L@?"
+	.string	"3\372\021\020@\265\310\315\362\001\240\344\265?\366\366\236\220v\320\337\242\267a\023\234\372\251\035\333\377PzC\251:\f\235\305\327\242a\350\351\373\266\372]\372\331\216\315\330L\372\374\344!\273\247)IJa\227Hya\312V\224\255h_c\3448\372k\364\363\325 Y\030P\332_\241O\243~\024\251\257\340\237\322\t\2715\357\330\277oO\320\250\372g\324\277\231\321o\202\3052\252\032\002\344\371\273\251o\033XR\225DW\312\345\332 \273\263\315C\325\333\335\365\325U\222$\252\266\021XJ\230\221]\274,\037r\027JOH\217\222\214\336\217\020\332\341-\020R\3551bT?d\205 \344\244\267\323o\251\367\013\2730\020\271\273S\246\350\355\026\366=e)[U\330\243\250\323q|\n\331NQ\330\276\247\247(\032\016\013Uur\223(\232\347\250.X\357'\\G\351\350\0349\3721\201x\276\254\206\354v\325\204\355\227"
+	.ascii	"K\330\027\226=s\022\2638K\037Q\023\227\252\307\203\007Gm\021"
+	.ascii	"F\n\262<x\313\333(Qp\366\0337Jm\330\350AX?\274\327\303\353\211"
+	.ascii	"U\231\365\240\307\241\357\340\367v\255X\331\240!\2031\330\016"
+	.ascii	"\266\035\331p"
+	.string	"\272#\320cn\264\341tG1\2179[\316\226\323\025\201\036q\272\242\230\261\232|\211\222\232\270\273Xs}\224A\273[\263\366\220\211\016\253\252\255\271\273UWBRB-\022\213\026\271\363\246Gr\232\376\310\322o\304\366\213\230iw\317\305\245Jd\210^\b\216\2671\254r\215|\315\355R\233;\253\270\310\3152\027\365a;t\344\340\3605\037\354\036\207o\3300\321\225\262J\025\275k\230\206u\206e8\006\215]\030\246BE\003\200\374\250\341@\312\330\320HR\222T:P\002A\250\212\252\003\022\300u!\346Q\253F\fJ\013\3731\007gR\334\373\261\234\200\t\207=z\230\340lT\025\324\360L\301\b\025\3041\314\335\001\347%\242\244\232q\214\313o\304\202\343\244\206\212M\0242w\364\030w\342\373\250\022:<\005BO\\ \272\310\270\r\303-\311k\"\317;R\215\262r\005[?\033\034\376\bG\004z\032\333"
+	.string	"u\316\002\002\t\333\330\213\251\352\233"
+	.string	"\307F\215l>V[\2025PL\345o\221\324\213\004\247\373\264\204\375\326\\Y\375H\263K\235\272 \323\240\"\233\300\305\315\321\312{t\247\372\027\3770\266|7\236\360\322B!\202|\236\255\3440L\003A\323\343O\030\254\315\345\365$\316ih\250n"
+	.string	">Go\033&\f0\\\332\257t\034s\"\024\315\351\336\274U\200\331\0064t\025a\367\306\357\007\2248\243\340J\2600\216Ng\223\004\032\260L}\324\324\374t\220\363\035\025\035\303\3047=\341\360Uc\306\250\246\031\007\257\262\230\034\265\034E\272h\332Q\271y\234*j\256Q\017\252\357rGD\201\310\304K\330Z\204\214a\305!E\257"
+	.string	"cJ\204;\215P\312\266\370\333\237\211/Q\034\022b \234\001\355\026\377=\373\226\230\325|\361\354y^Z\313\024 \232RG\326a\301\271x\2501\032P\2337\340\016Q%\351\232\325Q\245\372yn\252C\244\341s\376\232K\240O5HAQt>\ba\215z\245\274U\357\213\345\225nAG\221\347L\031I\310J\236j\230\371\3436"
+	.string	"$;\025'H^\336\026\024&\323\206\340\210\370\331\331^\344\270\0023\363\277<X\227\007B\237\214\035\036.\230C\002\316T\237\274P\344\320\200\317\204\245\273\303a\\\311y\031"
+	.ascii	"@\301\337\036\"d\363\230uU2\267\007"
+	.text
+	.section	.gnu.lto_.lto.c39df695c615e75a,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_mixerNames.181.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`<\003\275\025"
+	.string	"\206e\214K\240\226U:*\347(1\0355]9\033\352@\026\206\240\302\225-x\013<\205OaUy-\344\033\230\333\360\311\371\013\213\236\203\235\221\224qd\230FdQ\024X\260m\325k\t[\276\3020\371uxB~8\304\214hCW\264;\355t"
+	.string	"t"
+	.string	"y"
+	.string	"]s$Xt\363M\340\267\215\224\360\016o~\023~\003H\036-V\362#\360;"
+	.ascii	"\020\t\227x\363\231\360[\200\217\342\325\200\337\003vL0\272\371"
+	.ascii	"\b\277\t\340(\332,'\0137C\300oY\215\037~\027\230q\274p3\212\337"
+	.ascii	"\006``\310ps\003\374>\320\002y{\360\033\301\0232v\"iUb+))_\304"
+	.ascii	"{\303\315\026\277\023\\v\016\257w\375M\255.Y[\276\365.\377b\223"
+	.ascii	"\254\222\365`\227h\026\004O\316\225LbRbPm\336\t\335l\233\360"
+	.ascii	"\007\022\370mm\007\033\002\277]^\210l\225\223]\302o\030.]\360"
+	.ascii	"\273/{i\321\302\357\327e\257\254\236\255J\372n\376\025~\303\254"
+	.ascii	"\250\260\025\242\013\274\371S\370\035CE\n\277cQ\2167\n\277e\234"
+	.ascii	" /\024~\3170AZ,\247?\3417\215\022\007\017n>\n\3746\325\344\245"
+	.ascii	"\271]\332\363\325bU\210C\244 \234\r\205E\021\214C\244#\342\354"
+	.ascii	"\210Xd4\023\032\2173\234\233Z\25404\316\220\212E\343L\246\322"
+	.ascii	"xvt~\266\322'\024\253Oq\025_q\026w\361\027\217q\031\247q\250"
+	.ascii	"\333\370\215\347\270\216\363x\217G\375\307\203\\\310\207\234"
+	.ascii	"\310\213\334\310\221<\311\247\276\344MN\365'\207r)\237\362*\257"
+	.ascii	"\372\225\236_\035\353X\236\345Z\017\325\344\2450\025\375\331"
+	.ascii	"J\237\320\253\232?\256z\226?9\023\007\253>@W\355\212\323\231"
+	.ascii	"DA\234\316\004\236@3\225\006t\325\237\202\037\254\242\277\264"
+	.ascii	"<\201vim\027\213\2519\264V\013\346\354\350\324T\334\315\026\314"
+	.ascii	"Y\0204\317[\320\314\020\254\006\371\374nA\257\272\033\342\335"
+	.ascii	"z\301]\032\314\241(\315Y\372l2\225wK\321]\355v\342tf\217\246"
+	.ascii	"\322N\263LKX\205\325\233\256<Q\236Y\006? \320\242\271\242\007"
+	.ascii	"\3654\233\201Y\006_\030\246\215`\n\201\\U\353h\234\331\215\f"
+	.ascii	"D\363\03227\325\203\333\216\366\200o\345ez\326\327]\315\356\306"
+	.ascii	"\361\003\326\374\3424\274Y>\023\317\036\276\302 \237\263{\345"
+	.ascii	"\350n\036#\031\335\346\361`\364\204\262\276\272\313\031'G\306"
+	.ascii	" \247\347\261|^Yw\330\245\233\307T\371\324\344q\333Z\306\"<="
+	.ascii	"k\231\317\030\376\344\006\211s\233D6;\357W\230\304i\257\305["
+	.text
+	.section	.gnu.lto_featureNames.182.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`\311\003\245\027"
+	.string	"\366*\235J\240\332M\007\317\2556\220\""
+	.string	"@z"
+	.string	"V\233"
+	.string	""
+	.string	"D\025\306\022nx\035\302\232\206\223\030\324\255\261D\030U\263\303LJ\220\264l\324\312cm\245\330\273\337'\323\310\336\336\203G\342\220\2153\311q\016\346\240\262~\355BKl2\311\213"
+	.string	"\213"
+	.string	"\213"
+	.string	"+\362_\234)\\\002\356O\225\377\346@\021\312\341\376*\362_\235&>\374(\362\337"
+	.ascii	"J\210l\330T\021\356\037\225\377\356 \021\020L\215pg\312\177y"
+	.ascii	"\206\350v\270'\345\277\003\200\370lX\220\227\377\022\360Q\200"
+	.ascii	"\007\257\207\373.\3775\220\203\302\021\356E\371\357\001\033>"
+	.ascii	"\013\270\243\371o\317\f\245\013\270\003\345\277\b``\300\031p"
+	.ascii	"w\220\377&h\241AV\305\365E\365\005\004\366\207\372\313\204\273"
+	.ascii	"\315\177\025<\317o\230\371[\277A\2551\247W~\353\263\274\226\337"
+	.ascii	"\362]\336\313\203\371\256\367z1\017\306\340\307X\240m\262\035"
+	.ascii	"\354\007\333\355\223\005aCX\021\226\204-a\243\026\330\023?c\254"
+	.ascii	"\013\370\324\364\240Z)[\225M\360\260\265#n\032w\233\"\377\215"
+	.ascii	"Y(+\225\377\3128)\331\257\240\355\371\357\365\340\225\377\316"
+	.ascii	"X\016\277\225\377\322<\317L\030\021\326\312_<\0136U\023\346\263"
+	.ascii	"\362_\331\027\254\374w\306\305\206\013\002\016\367\277\312\177"
+	.ascii	"o\260\230\026,\030\001\367\267\312\177\001T\371\242\211\333:"
+	.ascii	"\304\365\323\241MS\365\311Q\233\311q\335&/G\236\326\3708\253"
+	.ascii	"9T\007\205\373\226j\264\fo\252\316\247WAG\333\351\214&\374vK"
+	.ascii	"H=\032R\317\350\210\246\373)\321|z\252/i\367\243-\371|?\332\254"
+	.ascii	"\356\021%\265-\255i\\X\346D\234\372,\336\352]\374\213\217\361"
+	.ascii	"2\236\306\327\370\033\217\343u\374\216\277\372\036\377\343\261"
+	.ascii	">\310\013y\"_\344\215\374\221\317\372$\277\344\231\274\223\177"
+	.ascii	"\362Q^\312Sy\255\267\362\001\025w\236dXKk\2650E\201n\232\264"
+	.ascii	"\225ZGVO\023\345\3516Q\0237\253(\251\321\324\f\332#\237U2\324"
+	.ascii	"{\234U~\336d\264m\274\225\341\266\251\271\215\216\270\221\034"
+	.ascii	"QY\025\177b\025't\246\344H\222\341\016\317th\347\324\223\343"
+	.ascii	"jb\230j\316wM=\365Fy*\216\244\254\346B\362\344Z\304U\344\246"
+	.ascii	"L\275\225Z\334\241\3206m)9\226e\bT\333\251{\024K\363\344e\270"
+	.ascii	"Q\233:\006C\250!8\314\t\244#wYE)\f\007 #\231\231m\020 c0\013"
+	.ascii	"\323d\f\375(\337P\3008\216\235g\234\257\362\357h\232\325\361"
+	.ascii	"\016j&\035v\275\267\301[\303F9\017\202\363\0335+:d\361\352\366"
+	.ascii	"\261\357\273A\320\355\027\036\375`\020\215\264\222\262\335;\340"
+	.ascii	"\270|(Sk\211\335]\031\020\325H<\366\230\200\354\355\r\273\351"
+	.ascii	"\325\231\322\215\343\026gr gy\301f\201%\351u\021O"
+	.text
+	.section	.gnu.lto_rxFailsafeModesTable.184.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375 [%\002"
+	.string	"\024\003N"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\177\001\002\005\001\006\025\177\001\001\003\005\001?\202\210\200\030}3\276\0014\275\001\274\001\273"
+	.string	"\300\276\020{3\301\0014\277\001"
+	.string	"\007"
+	.ascii	"3\205\200q\2400;\307\202s)\255c\240\b"
+	.text
+	.section	.gnu.lto_sensorTypeNames.185.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`?"
+	.string	"\245\007"
+	.string	"\364\f\331"
+	.string	""
+	.string	""
+	.string	"Z"
+	.string	"\005\001\006\177\001\025\001\007\005\001'\002\206\b}\005\001\212\001\206\200\200\374\233\336\340\271\n{\275\006\005\001'3\206\by\bw\300\005\005\001'8\206\bus\303\004\005\001'E\306\003\005\001'J\206\bqo\311\002\005\001'P\314'U\316\001"
+	.string	"?\202\210\200\300\001m3\317\0014\315\001\313\001\312\001\310\001\307\001\305\001\304\001\302\001\301\001\277\001\276\001\274\001\273\001"
+	.string	"\bGPS+MAG"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/interface/cli.c"
+	.string	"\004GPS"
+	.string	"\fRANGEFINDER"
+	.string	"\004\005BARO"
+	.string	"\004ACC"
+	.string	"\005GYRO"
+	.string	"\017"
+	.string	"\255\020\202\370\024#\260\030\340\017\344\006H\004\231\250\212k\2201 \234g\036 \363\202\312\221b\337"
+	.ascii	"\340"
+	.text
+	.section	.gnu.lto_sensorHardwareNames.186.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375 \241-\004"
+	.string	"\024\007l"
+	.string	""
+	.string	""
+	.string	")"
+	.string	"\005\001\212\001\206\200\200\374\342\203\325\363\031\001\177}"
+	.string	"\005\001\006\025\001\004\350\317\001\177{\003\2507\177y\002\037\177w"
+	.string	"\002\177u"
+	.string	"?\202\210\200(s3\302\0014\301\001\300\001\277\001\276\001\275\001\274\001\273\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/interface/cli.c"
+	.string	"\007"
+	.ascii	"T\021\002\344\326\034\004\362\2659t\235\271\r\240\b"
+	.text
+	.section	.gnu.lto_cliPrint.187.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`=\001\315\r"
+	.string	"\006\033^C\020\217(\035#>\232DAP]\022\031<\274}Z\201\331\037`\373\021c\3745fUT\356\240\026|m{\355x\332\314\300\320\200p}\210"
+	.string	"\025@\251@\205\006S\023\210\"\032\344\262Q\007ido)S\nJ"
+	.string	"G"
+	.string	"K"
+	.string	"\327\243?\266\213\177&{)A\021Ia\331]MK\f\363\363\b5?~\236Xt\036\350\021^F#(\030o\0043\254\025\225\247\236$O\224\220\003\311\365\251C\017'U\347\221</\tv\327\331y\025\356\353\266\033\330\336\260\237!#O\325d\177\240\314\230\260V\254%;;\352\307\216\272/\230\2161\raZ5\235\231>"
+	.string	"\f\213\n\004\255\335\221\026\214]E\025\r\231\355\247\375\017\007\3619\n\344\001vK$N\354~\0336\200=\372\373\200\353\021\273\200)\334\206\235\370 W\346\244\"]\b\301\335]\250&\333\032\231\252j{p\362\235\013\214\024d?\304EL\360O,\241\223\357\036\375\316\365\250\232a\341\232\372\022P\257p\205H\214P\266|\340\227f\372\r'\023\024:\210\262\245*\024\001\234\247\243\326pl\0204\332F\323\341\200\333x>6\355c\353\360\3204\\G\343 `N\204\r\247y8\034N\313\276\275\226\274\240e\025R\2211\031\325\336<\b\031\021\225A\212\226\250&?u\215\325\013\f\232\251abz)\311\336.\250\nZ\204$\313~\031"
+	.ascii	"2\201\r<\002\303VA\023p\257\302X\035f\003C\253\241m\001\3426"
+	.ascii	"\336\313\006\230l\310\r,\374e0\314\243\240\t \347-Q.\3016\253"
+	.ascii	")\301\275\270\245J\3252P/\233\204\371\004"
+	.text
+	.section	.gnu.lto_cliPrintLinefeed.188.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375 \353m\006"
+	.string	"\022\f-2`M\323\001@c\003\264\013\263\036\032{\020\350d%\220P5\300`\372\210\215O@\333:\332\372Hn\031\031\240\033\270\354\261\212\202\303\337O\212|\271S\n\036 P\307\210r\210p\212R\203\234\256\212\202\025%=\300(#`T`\013b\222\360\262,\t\037n\257\0253ht\026z\341\346\335\343\030\t\350\262\253}N\004h\b\007ol\212\212\367\351\007\262u\030\232\331\\\366t\303>\300j\305V\210\"\242\220\331\235dJ\266kB8l\3771f\217\234\273\254c\301d|\220\354.T\313\261?\314\177\307\005\346\226\3759\013\273\35377\312\255\267m`;\301\366$\b"
+	.ascii	"2\001/x\006\340\002t\r'\013a\274\f\001.\335\242\235O"
+	.text
+	.section	.gnu.lto_cliPrintLine.189.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`\032"
+	.string	"\205\007"
+	.string	"\002O55Pm\323\001$\203(\251BT\t\025v\002\004f\331\305\333<\032\307\352\210\037\ra87\251=|A\2043m\246`\207\272.\006\212/\230\265\376\357'M\312\224\002\230\226\251)\216\245@\305\212\352$`\225\346\261\242\307\352,D\n\313\"g\300\027C\205E\355\272\260\230\001\367\321\252g\204\2140B?\236\322\316\0324\027\341G9G\231j;<\344;\347\210E(\241\234\rr\251\032\366\243\335]\253g\377\373S\322`\230\030\234\354R\254\250l(\225pdl?\355w\334c\373\007q\200]O\204d\027\334\270\340r\311\340\005,\227.\017\260\\\362f\243\034\334\330)\0242\001\222\262\273QC\337\236\233\377\217c:\020\367\234\016v\327\331\201*n\275m\002\333\033\333_\t"
+	.ascii	"2\241\205/0\\(m\006W0\357\022@\263\232\002\356\362\242\235d"
+	.text
+	.section	.gnu.lto_cliPrintHashLine.190.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`4"
+	.string	"M\b"
+	.string	"\006\020;7Pm\323\001$\023\212\241\202\244\262\024k\326\373o7\353\362\n\031\312(\345A\036\004\341\343\330\006\225\363OM8\323f*\252\r,_\300\026\304\3053\214H\226\266\335;\245("
+	.string	"+"
+	.string	"*"
+	.string	"\323\235\235\362*ZL\350\204cdew\251\f\275{\354\374\227\016\360\201\274GL\303\356:~ \217[\336\366\306\366\202\355S\244_N\215\t\205Ae\267\243\205e\303y\002\311\330~\264\037\362Qw\022\306\007vA\023\323nUpB\365\351\372\002\352\263:\001\365QJ{\242D\305\327\213PhD\273\237\177\025\325\307B\370\264-.\342?G\222Q\270!=\273zQ~\330\277\354\356Z\202\366\003>\330\004\b\314\215\363H_V\006qQ\354\342<l\030\327\311h'\343D\320k\363P\313\300\232\004\266QN\3236\232\251{\t\332\241$\314\220\032\246\002\n"
+	.string	"2\001\177x\006\\\250 \005\220j\245"
+	.ascii	"\311\305\332f5\005\334\345E;\311"
+	.text
+	.section	.gnu.lto_cliPutp.191.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`J"
+	.string	"\265\b"
+	.string	"\306Q>8@\305(\035\365av]\013\264\261\n\217\260gQ0\023'\r\212\353\253\264<5k\251m\332$k9\331\t\206\243\223l\273\"\007.\0053)\213\213\261\207\214t\177)S\n,"
+	.string	"."
+	.string	","
+	.string	"\177\231\027`\376\334\331+\217\035{\241TH#-\273\013\025\365\356\331\371\027y@\311$z^\017\273\353,\2314n\275\355\004\333\230mV"
+	.string	"v\365J<l_c[\323fh\350\036-\254\273\033$\252\335\335x\341i\037\344!\335Sf\235`\367\364\241\332\215\033+d\376\034o\200\tF\300P\221\257\251W\275\n\244XH\001F\331\262\243(\225\303\376ew\327z\262\237\372\337\343\257\232\316K\372\327\200\t\212C\312nF+\022Y~\356\f\333&2\250e\234\bN\013u6\330\3318\0240\343@\020;\260\347\243q0\344\361pP\023\367z2\304\311j\244\027\2762\365\251\r\252\310\227\002\t"
+	.ascii	"2\001\033x\006p\341\2019\226\271\006\274\n3\024Thp\227\027\355"
+	.ascii	"$\003"
+	.text
+	.section	.gnu.lto_cliPrintfva.192.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`\251"
+	.string	"\305\n"
+	.string	"\326\324JA \2518\035\b\004\321C\b\3120\300+\215\034\336\217\t\266\204\254q\372\253bT\265;\270\361\026\026\361\316\344\205\241\374\004\243~\235*"
+	.string	"\245\r\2403\013 \240T@\"l\202\314\351\037\320\247M\266L)6"
+	.string	"7"
+	.string	"8"
+	.string	";Rx\"\373\364x\b\3543\373\003\366\351\320\236\3601\300Z\004\210%\025\205\335\325$\200\207\327\320\177\202_D\323\350j\311\330]\253h:\271\345mK\330\276\260\217\021'\373\251\177\036\365_R\255R\375\314!%\202\006\204]\223V\205eM\007\004l\037c[\325G\220\022\221`\341\217\366\345\323\025W\373\006~ <j\344\r\273'\006\r6^\311\002\225\327\352\301\202Ny\311+\350|\331.\351\342\245\355\001\322\213\316\224\344\310\276\352\253\020\177\200?DzQ\204}^r\254\n\240\220\264e\217#\225+\366\257\335]\313\033\210r\335\007\224\341\200[\026\332:\340\267\301\314i\274\016N\353\270m\003v!\217\247y\274\255\243q H\323D\370\373t\240\026\372>P\303\214\373k\345\311\033*,\222$1\203\252\2649\001\021"
+	.string	"2\241\205h`\270Xp\017d\254+?\017\321\372\301,`.\274\3130$\230\006\256857f\240"
+	.ascii	"\025\005\334\345E;\311"
+	.text
+	.section	.gnu.lto_cliPrintLinefva.193.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`\272"
+	.string	"\r\013"
+	.string	"\246UL= O\234\016\240Y\243\013B\225\022U\234\006\027\246f\223\200\303id!\274y b\313Pc\217\236\177w\2360;\257\223\002\323\212\b\363\006p\030\223\334x\233\201\315\271\005\372\323&R\246\0249"
+	.string	"8"
+	.string	":"
+	.string	"\246\026\273!\002\037\260\036\035\236@\365h}@\365h\317\206\361\260\303:<\200<\244\030\273{)\207{O\317?\212?\300\317\367t0\330]'\370\321p\353m\033\260\275\300\276\203\273\273\326\220\375\321\037/\372)M\247\246\377\210\214x\321\200\305n\206\215\031{\212.@\330>\304v\246\177bdA\206\002?\264\037\217N\360\264_\342&\274\213.\\\300n(\237\001d\252]\3310\254H\245J&\215\214J\351SX8k\227s\360jK\310\344AK<\372\331']E\005\377\203'l\362\340\246z\274B(\211"
+	.string	"qr\303\016\277\324\r\366\251\030\205\3144LFR\3510K\203Y:\216R9\233l\021\262K\3130J\247i.\333u\3310\313\225u\231kR\300\034F\353.\r\307u\027$\334S\253!? q\342h\307\001\322\306\262H\210SG\003\022"
+	.ascii	"2\241\247h`\270PlF\005W@v\273\262\366\020]\036\314\002\346\302"
+	.ascii	"\273\fC\202i\340\212Ssc\006\nPQ\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_cliDumpPrintLinef.194.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`\265\001%\021"
+	.string	"\206 uH\360\320&\035\270k`}P\202\276ke\3105_9\364\332\370\017\222\265=\206Z\237c\357NqZ\233.\305\321\232Z\031j[a\253\263|\264\241\t\335(\023\027i'I\001\231\375\217\330\373\340\357\t\023*A\204l\271S\n_"
+	.string	"["
+	.string	"b"
+	.ascii	"5\212|\206JT\336\247\305\272\013\202\205\320\356\270\300\n\274"
+	.ascii	"s\266\315\240\201\313\257\217:4\034\033nb\202\216v\307OI\374"
+	.ascii	"un\252|\371\035\"\354\234\354\263$\302\314\003\273\013\"\306"
+	.ascii	"\244\316\022\230\243\017 \342\313\364@\212\211q\332\345\214\030"
+	.ascii	"\223\222\303dw-e\304\016ww\333\024l\237\330\022@8\366g\277\327"
+	.ascii	"Is\377\371\347}~\265\364=\356!\304\321\214\223\332.M\322\r\227"
+	.ascii	"\027\234\013\236\327n\037\205os\311\017"
+	.string	"z\n\327k\255\257\206\232\223\022;\267\335\232\221s\226\340\235\273\310m\227]\262=\245\375\361@\256\3172\210\204l\214\246#\364`\374\200\356\234w\001\335\317K\344\001&P6d\343\026S\230?$\202\"Om\013\250P6v\310\221_\305m)\003\034v\3672\266jE^\306\267\335#\222\365\330\270\301(\314\362D\321\2158_\335\324\023MFL\"]mx\200\210Ts\\\240\343\364\264\007\230\355\210\240\001\303(&\221\034\362\226N\225S\016\233\027\231d\2170\2519\366\347j \006\311\002S+\325\251c\241\264\300S\b\201\005\005l\255\204\037\027X\300\t*\251V\005\317&\022\024\212\351\013M\340i\025\262RP_\n\nL}\246\025\313GB\300*\225p\365\261T\252\325W\032\367s\025\307\247=AO\255\246_\361\333\036\301\310D\255\305\374_\335uFm\342\242/\347Zsw\204\203\333L&9D\202\001\037"
+	.ascii	"I\013m\306\302\201,\330\325\352\222\354\n\301Z\246\b\202\211"
+	.ascii	"b\036\b6\352\nQv\024\251y \224\240\312[\rg{\030\3175\034xV@]"
+	.ascii	"\234p\301\301\334\254:\007}\225Z\250gd \314g4\353\271\035\340"
+	.ascii	"\366\256R\327k\313\036"
+	.text
+	.section	.gnu.lto_cliWrite.195.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`,"
+	.string	"-\b"
+	.string	"\026\020:6Po\322\0015\211\004V]\013\241\276P\210\006Ud\310/}\357\240\232\027j\0049\354c\343\007n@F.\315\222\214F\240\316\226C\344\235\f4\264\266M\232\224)\005)"
+	.string	"*"
+	.string	"*"
+	.string	"\257\254\331+\367<V\363\321\225J\\v\027j\307\265\247\346_\344\034\316\264=5\n\273\353\344L\031\267\3366\201m\003\333(\001z\262\337\375\252\351\314\3643\001)\225\005\226]\214\357eQUJ\210\355wlg\332\b\t\332\273\n\353\356\306\310\311\256w\340\202MjK\204\362\234\007.t\263Or\217\302\007\361\304(\317\275\362G\231W\251\034\r\325+\200IK)E\312\317\366\266T\016\373\230\r\0161\035=\327C\204V\3744d\226\btA\320\365\201\2001\013A\217\200\261\b+\203\"\f\313`\307\333cVO\f\037\212\244\026\336\3445\003\t"
+	.ascii	"3\241\253\037\270X\346 \230v\271\2067`\302S\251q\340\316-\332"
+	.ascii	"\371\004"
+	.text
+	.section	.gnu.lto_cliDefaultPrintLinef.196.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`\322\001\355\021"
+	.string	"\026b{I\300\324M:d\346\266*;\212\237y\032O\033\373\025\371\271\332\b\r\002P\202E\312x\017P\232\f\321\302\336<\332\236\323\333\372\341\343\242\276\222\r\006\210\341zP\373\256\203`\252\210J\223u\211\204\300wDt\t#d\357\235Rh"
+	.string	"^"
+	.string	"k"
+	.string	"*'B\036\325h@\347\217pLw\207l0\355\222\013\274\362\275\263m\006\016^\206\235<\341C\362a\311\203R\324.\031R\023\207\275\253t\302\374"
+	.string	"\264\330;\021\257u%\3274\004\244\355\324\024\037\0253\023\232l\322\232\002U\302\207\tm\247\256\f9\205\270\355\223\207\2463'\211\313\356z\316h n\357\266-\330~\261g\202>-\313\2624%\262\275i\360\265\377;\322_\177\364SO\277\344BOQ@(\320\330\365)\217\344<u1V\374v\373,|\234A_\351-^\277\271\276\035~^P\274\310\355\376\260\274\363\204\357\335Un\277l\320v\235\366\311'\275^\343\240r\2622[\n&\b\344S\274w\337Q<$X\0270\b\001\025\311\235L\004;>j\213\251QhK&\313\277t\234\206\002=\273\373\231\255\212\021\203\242\212\344vh\314"
+	.ascii	"\346\201{\206g\257l\346g>\356\357\221\021\364$\2431\373G\022"
+	.ascii	"\016\035\025\346U:\215l\237MB\240FPZd\002\036Ho\273\200\232\021"
+	.ascii	"T\220\034=d\323\210\r\034\307\243\024\244$@:\263\264\311\330"
+	.ascii	"\244E\016\342\206\331\022gX+\030\257%\343\022a\306\b72\242\313"
+	.ascii	"f,\211\271\021+\324\314\2702|N\265\250dR\341\230\022aXc\213F"
+	.ascii	"\025\322\250\304\2310\305\272\t[\006xU3\262\302\326j\305\nAr"
+	.ascii	"_\227\022yN\333\0258\335n\364.~\334%\360\270q\203Q\177\230w\312"
+	.ascii	"c\273\344P\235\272\273\333\271\352.\211\007\271\332,\2152\003"
+	.ascii	"! \220\202\231\312ne\n\355\241\320\333b\024\024\257\016\362\250"
+	.ascii	"!G\353\256\304\005\204\200\005\366\260\241\213k D\306\335^\266"
+	.ascii	"\210\313\320q\355\303\331\216\343\261m\240\037'\016\356\334,"
+	.ascii	"\347\366U\\\250\217\\a\256h\326\272\035\320^q5\026\005"
+	.text
+	.section	.gnu.lto_cliPrintf.197.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`\241"
+	.string	"\315\n"
+	.string	"\346\023JA\020\307j: \n\213\244\325\203\004\022%\016^N\340G\314\340\020(\b';\001\004a\320.\323\025\177B\377\216<\324Z\221\034\004Q\f"
+	.string	"  \300\002\250\230\360\033\212L\262\004\225\2269\254-\356\235R4"
+	.string	"9"
+	.string	"7"
+	.string	"\r\231k6\337\331\256e~\260]\263h'\270\231\262\230\025LD@lw\271\212r\361T\364\357\272\206L\215\247\230\210\3355%S%w\275m\006\333\020\366A\001\257\230\202\t\002\273$\263\005\247\227f@\345\255\337\376]\336\330\346\001\210o\231\276!(\211\025\202s\027\345\271\346\207\314\265#\234\332gy\213xV\3079\273\252\001\005vM\007\007\006\364\2438 ;?\352h\rU\200\325j\203\027\235\322\334\250\347\017pW\306\302\biop\320\223\346\224+\262\023\244\216\2669\322zb\377\262\273\353\252\262\317\372+\346e\235\006-u\243\020\024m\366>_\205\307\205\274N\024\206J\244\217#}\335\210\363B\f\356\223`\320\"\024r%\020\f\271\215\271\277lUY+_\262\363T=l\272\354\232\200\316\026\2359\022"
+	.ascii	"3\241c\214\001\370Q;&\330 q\021\360\200\206\215\222\002\302 "
+	.ascii	":~\325\004f\327\0244\034\334)\213\301\020y\212\n\270\313\213"
+	.ascii	"v\222\001"
+	.text
+	.section	.gnu.lto_cliPrintLinef.198.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`\241"
+	.string	"\255\n"
+	.string	"\326SI@ \3078\035"
+	.string	"O\034\027\r\2606"
+	.string	"\004\016\254\361\274\033b\034\001\305\374\001c\020\320\374\021+\235bD\250a[\304)->\262\374V I]\211\374\020\207\241\361\236\331\0320\362\337\370o\373{\247\0243"
+	.string	"9"
+	.string	"6"
+	.string	"\f\230g.\317\321\236a~\240=sh#x\211\262\027\325\031\""
+	.string	"\266\273[=yx\032\372o=3\242\304\323\013\304\356\232\216(\222\273\336\366\202\355\007\373\237&,\201\204\201\335\221\330\002\323\201\254@\312Y\277\375\267\254\261\313\003\b\317*}AN\021*\005\346\356\251\363\314\016\230gG8\265\257\362\225\360+\216ovS\004\\\273e\203\0036\240\336\304\3534=\252\350\f}\325j\177\026\034\322\245\321\316\037\340-\f\005\221\321\326\330\240\037\275!\007\234\346G\025\355R\244\325\304\276ew\3275e\177\365\327\313\311\\\006%q\"\360\013i\356<\036E\267\201:.\004\202H#o\033y\234h\353\300\213\315\223\340\257\002\004n\244\357\0037M\271\267lM9#\315\3234\325\016\227,\273%\037\223Ec\001\022"
+	.ascii	"3\241c\214\001\370Q;&\330 q\021\360\201\271F]\001v\020\035\277"
+	.ascii	"j\002\263k\n\032\016\356\224\305`\210<E\005\334\345E;\311"
+	.text
+	.section	.gnu.lto_printValuePointer.199.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`\013\f\3659"
+	.string	"Zc\254\025@P\246\326\030\003A\351Y\307;\350\005;\357Y\241wt\346?r\344jb\305\226\374\343@D\314\002\250\260w\357\003\306\201K4\265\022|\003"
+	.ascii	"v\005\373\t\264<\325\2010R\356\022\312&\245L)\245O\001)\001N"
+	.ascii	"\001\334\031\226\372\354\254\250\363\276]\323D\257\335\352F\255"
+	.ascii	"\337\272\335\340\336\334\320\3366p\217\3416\303B2]\306m7\216"
+	.ascii	"k\231^\355\033\\\020\275\367}\031\364\312\031\332^\223\252\013"
+	.ascii	"\231Yuf\b\023\334\026\303\243\243\005\302\354\274\304\261\340"
+	.ascii	"Q\376\003\300\370f\2659\241\332\231\333K\177q\233\255G\033\275"
+	.ascii	"/Y\036\233\367\215:\340\005m\257\034\355#\333k\333Hl\257\354"
+	.ascii	"2\373\351h\331\373Csn\221)\364\276\357\362\243pO[\2156\013\335"
+	.ascii	"\355$\244##c\221X4\024\006\201\355\217]\325?\272\313\335\326"
+	.ascii	"\007\352L\235_\314Nb\220\250\nRZ\037\245\301\235\271\021\232"
+	.ascii	"Y\332\033\361\212tU\210p\355\001m\r\2401\260\262.z\366\230\327"
+	.ascii	"\022\366x\026\207\306Lc^L~\250\376\264\272\246\364\235W\232*"
+	.ascii	"uH\317M\233i\347\372\302r!\0240\261\0162\215\201\2055P]\240\327"
+	.ascii	"fP\337y\205\251\307\256)\316\266\342\225\304\333.?)\254\260\254"
+	.ascii	"\312\332f:\004\232\030\24010$\255n5\265X\343\373\276\301\257"
+	.ascii	",\365\373J\254\217\352\202\347\034\"}\347\245"
+	.string	"D=\332y\302\247\333\232\311\212\227\024\367_\206\367}\331\235_`\315J\315\334P\2309\005\263\360\003X>e\345\377\267\2409\351V\337\225O\271\341\264\322\323\216\351|\fh\317\016\231\372\320:n8jr\270\351\374L\312\035\247\327%T\336&\257\2028f\366\323\276/\263\237\354\316\227\253\213\312\373\276\nz\305\240\2565\321\362>\376F\262\376\030\334\370\267\231Vj\271\275\233T\353\353\037\312\335Re\207\364\216O\306\311F\262\313\357\266n\357\332\362\262\374\020G5\222\355_>\373\026\022,V\321jX\264\357\233E\201;\215;\346\242M\353\301\366\332\377qe\270\260]\371\2249\312\364\2072wC\335\344Q\341'c^\2351\\X\235\245ZL7\205\b\020\036t\264;ju^6[7T\2775?\265[\263\322\3109\201\321\331)\350\334\024tF`t>PtfR\235\223Dg\003\252s\001\2423\222\350L"
+	.string	"\350<`u\026\240:\007X\235\001\250\316K\252\263\322\352|T\235\223\210\316HE\316GAg\243\240\263Qu.\016\235\211B\347\242\240\3630\350,T\235\203@g`\353\334\262\316?\325\231]\235\327\237\263\312:\377\352\354\253\007\003\276E\235\224+\354\352\355\241\364\n\361#\274\327\271O\024\255\200o1\207\020WX_/\2055mY\023-r\254\206\323tu\316\344\21637M#\365\r\327\rD\232\304.\313\373\270\337t\277T\0373?\321\341C\271\350\f^\370\365\354\310\240\225\317\025\340\333\017\200\017\300\307b\231\310\005\323"
+	.ascii	"Q\023\200_\232\261]\371\264\325\267A+\377\302\267^\234?\036|"
+	.ascii	"\250\367\2316\344^A\226\271Y\332\246\b\245\253\305\345\222$\307"
+	.ascii	"g\227\365\3146\2426\250\b\360\241\254\374\245\357\2616:P\255"
+	.ascii	"\364K\277\3565\237\307W\372^\353A,\224e\354~\351=\027LS\231\206"
+	.ascii	"\026\304\241W\002e\307\007\342\241c\250M\n\204\364I\177"
+	.string	"Zt\230b{E2\372\250?j\2746\276\221\361[\020\335\2329M\224\253\363+\366!~qO\f\017Tl\257\304\341G}\2217\323\261\302\037~7\255\b\277\007\311\3213\327D\27186\250\007\370\301;5@T\261\275\002\177\037\365\355\357;\320\334T\256\211rk+\013p\366\373L\337\215@\342\275o\263\235$\332\346\007\245\211\023\336NNj=\223\327g\337\323l\365]u\235\035(\270o\260\275\256\337\\a\377Q\257~7\261\004\034\303)\031\303)\371\343\006\3161\234~\245\352\0313t\310P\253JL\351\230\361b\307\320\352\305\216g\030PT3`,\247`\274\220a5\225\243\006\325\262\006\325\013\032K\030V8\226P\003\270\312\306\224\3252GU\225\325R\030}\373\311\332\272\225N\355\256\036\213\335G\267\363aIJ\360I?s\261\270A\334/\266\327\004\337}\232\376\300;\265\b\276\351\273i\345\351\021|"
+	.string	"2]\036\305\375\3521x^\034\212;\304I\212\314\241n\021\225\335#N7\t\333\353\201\3571ylb>\346.\241\300\304\235\270N\226M\224L_\024\307g\210-H\017\245{H\005>\371t\237 \361\240m\223D\363\231l\340\223Q\\\314E\253\020\346\252IH\322\300\300W\310C~\201\3674f~\304E\3535xR\334\210\253\326h\274H\217A~\204=B\206\206Xfh\216\036\312<X\n\377\244\266\326\266G\200?}\243q\260\021KD)\235\235;{(\235\013c\264\006\205\b\341\233K\236\242\b\337R\326\372\212\017\376\351\271\204\260w\031\0179\027;\020\346C\345}\177p?\333\262\327\353\215.\177I\316\223\336&\032\032\2757\372*h\347\013c$\360\017\376\270\317\016\004\276E\335\364\252\207\322\265\342\200\207p\307}\202\b\200\345\250A@\305\230cfFD\202\004i\222\2441\260\002\021\031\"\252\007\021"
+	.ascii	"\251d\022\321hSF\n\303\032G{\350\251*d6\033\342_\323\273G\316"
+	.ascii	"\321\254\235\034b\347\210G\316ZdKR\034\344\375\305q\331\213\263"
+	.ascii	"\033\223T\314\256\366I\203\345bO;Bm\350\035\306p\242B\321\230"
+	.ascii	"\356[T\370!\227uG\347\206\324\ry\246\004G\246P\216P\337*\020"
+	.ascii	"]_\341\032\252Y\00720Vc\261\255\212l\t\344o8\001\265\261ak\""
+	.ascii	"/\223\\\335\347&\232;\364J\0371\315\031\357`\212E\327\226\201"
+	.ascii	"\215 \325@\033\207@\275\026\255\264\004\230\252b\3502*\006/\201"
+	.ascii	"\342\374_=$\276\274:\022\2507\276\377!F\226\n`\037om\3577\355"
+	.ascii	"`{\016\275CV\205\031\204\250\022\032$K\020\021\2614\212\333\315"
+	.ascii	")\206\264\006\355\037\263RK;g\302\245\306\311\256U\024`4U'G\266"
+	.ascii	"\364K\245\253k\376\266h\361ud\217\321\3551\002\200\332\365A\351"
+	.ascii	"\342&\267\260\303\332#\206\247\211\\AF1\fH\341\022f\247\203\342"
+	.ascii	"\220D\2568SD\206\021\031\177]\231\277CRa\2468\211\202\005\265"
+	.ascii	"\n\360\r\267:A8\316\351\025\216\241I\247\251\327\362D`\255\302"
+	.ascii	"\321+X\244\322?\201NB+mh\036\377\005\315I\017\217\267\204\024"
+	.ascii	"LH\317\364H&\206\351\266\277\321Y\272\372\222[t\376@\241'\030"
+	.ascii	"\215\252\0259\355z\265&\350\035\360\220\003\245^\220+o\271\027"
+	.ascii	"\021\224\373\n8?x1\t\224~j\310\353\236}\252\213\204W5\224\367"
+	.ascii	"/\354L\317E\240\346\2061\321\206$\344f\317.\253\303\266'\236"
+	.ascii	"\250\302\220\200*\221_,\307~\206\255aZ\371\226\032"
+	.text
+	.section	.gnu.lto_valuePtrEqualsDefault.200.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`\200\007u)"
+	.string	"\232I,\020Gp\334Q:\333\242w\233\346\371\242\273\252\360T<D?{Sd\273\177\257\350\021%\205*\200\375\210)\003\220\325Z\276\004\355\220,\226&\265ac\177\373\233\316\034G\352\245zp\r\320\366\277\352\267\377\033!\204\020\271\223\f\365"
+	.string	"\334"
+	.string	"\356"
+	.string	"(GX\217\022O(C\0304\223\343"
+	.ascii	"\371n\222\354\205\002k\231\337\344N\236\376\204\305\177\367\366"
+	.ascii	"x\223\345^f\002>\260\036e\346\207\351\321\365\301\364(\203\006"
+	.ascii	"O\fu\346W\f\365\305\225U\331\235{\231\305\376\301\177\373\311"
+	.ascii	"<\007-\324\205A\340\317\347\323\343\355t9\334\252\246\350\331"
+	.ascii	"\026\212\257J0\373\251\304M\231+e\324\205\247J\025c\310\317d"
+	.ascii	"\201\235\017\334\332\266P\331\240\017-!\007\022\371\001\271\357"
+	.ascii	"\013\210\365\371\322a{\t\202\030\341\345\370\216+\207\325q\211"
+	.ascii	"e\341\2609\013a]r\274\264\202\034g\344\245u\343\253X\326\r\253"
+	.ascii	"\236\3043Y6N\242\225M\357\225\265\225SV\245\303 iB\330\310+\253"
+	.ascii	"\253\321\243\035\r\333\222\343\245%\344\347\214\367y\240K\314"
+	.ascii	"\214\2362y\016\315\360xs\263[,\345\224\265\252\204{/\333+\245"
+	.string	"\326yx\346+\2319\003s\252\f\351[\250\331Z\331\230\342\244cQZ\357M:\340_\241`\\\357\275\007;\312g\221\036}\267\227)x\236H\3317ff\224\355%\363\037|\271\251\341\356\301|D`\200\200C\371\215\316\374\211\001\212\376\344':-\017\235\226\205v\226\203v\226\201v\226\001\374\354\374s)\347\241\360T\316A\235e`\316\362Og\331\227\263\354\203\263\334\303Y\346\255\226w\252e\335j9\247Z\306\241\226\327\323\262\232ZNO\313hj\371D-\367i\331\236\226_\240A[\027W\030V\257a\336\030oy.\033\272\205\310\317~)?\2257s\025>\032\353\316 \260\311\202a=z\346'\376\224\233\261\216O\005\212\030\305,j\2625Qr/\363\302z4\312\313\236.\205\323\210I\346U2h6\233\334\271\367\"x\215\352\321\365\262\314\205\035\001\311\0170\337\255i\311\365\222\355\212\340\352\232\212t"
+	.string	""
+	.ascii	"\232@\3334\351\021\\/\317=-\264\352\254\335Cm\264_\347\250\032"
+	.ascii	"u\332At\252\306nf\305\206\225\237\"=\212\366\261\266\244\354"
+	.ascii	"\033w\023\373\354W\215M\3317\376\351\356\264\354|\206\207\306"
+	.ascii	"\r\265\227\f\225\n;\302\230\035\2626W\273\220\022\266(\253\347"
+	.ascii	"5\346\200\211\245\275\034s\265\223\261`k\3740G\277\212\334\035"
+	.ascii	"\327\300\27703\234\365\336\250w1\034\266W\367\005W\221{\257\201"
+	.ascii	"\243C}\264\337\305Z\022\266\244\335\303=\324S\324\250\224h/\371"
+	.ascii	"K\270\300\350\2426j!c\221>l,>m\027\265\245c\265G\212\303\323"
+	.ascii	"\224\220\232\334\341]<\0345A\234K\210\243DM\333:\032hK\2022\250"
+	.ascii	"\350t/\231x\242T\250o\366\365\f\031\233\244u\343\005'\nKG2\251"
+	.ascii	"Ha<\246\310&\025N\023\220MF\023F&\343\016\311\244\"i\204\221"
+	.ascii	"\302\021y\"wD\236\350c\322\212f%\005KLJE\243R\322\210\243\021"
+	.ascii	"\331\264TlZJ2QT:\246(*\030b\247\023\306c\021\351\344t,\352\230"
+	.ascii	"\267\355gP\330\001\002\034\306\226\0356\251\236j\023\366\222"
+	.ascii	"uW\300\243\266\262e\205\345D\360\237\306\342\023\030\254\020"
+	.ascii	"\346\302\n\313y\254\237\036vq\314\r\031\231\244u\373y\357\275"
+	.ascii	"\3014\032\274\001}.^p\004\372F\322\340\374\004t\020\351?}\324"
+	.ascii	"/\302F\255\252\313\noU\030\216\266\313\274\006n\365\330-\240"
+	.ascii	"\317\007\351AA-\340\347\003\266\257\371\001\003\320\250\177M"
+	.ascii	"\021\030J\244G}\275&\266\217=\207Iy\335\353W\211\361:-\363a\""
+	.ascii	"\346\27350\275\235\016\351@@=\200\267\333u\016\r\t\r;\243\326"
+	.ascii	"uP\0324L\032P\244Gsk\023\033\267\006\200\224\250Q@#\021SHHdD"
+	.ascii	"\222\024$\351\300\002\021\261\252m\021p\255c\022\321\024\262"
+	.ascii	"\214\001_\374\301\303\204\021ZL1\t^\206\230N\035\0262\241iC$"
+	.ascii	"\256\361|\005\272/f\013\260$.\244\313\003\2756^}Z'\3541\354\027"
+	.ascii	"\2517\bn6\313\342\245?\322k\220 \335\226\2522\272bMau\221\246"
+	.ascii	"\3634\026\222\246\036\301\241\036g\246\357\004\213\0051\260,"
+	.ascii	"\250^\017\373\230,\227\307\260\\T\3330b#\022\201\330\034\315"
+	.ascii	"\200\227j\313@\022\362$\t\351\242gw\331IV\",2\266\321Y\"\330"
+	.ascii	"<\335\002-yb\337\022\351J\321\345\235\253\016\033\266\211\257"
+	.ascii	"-\216\215\370\232\020\335\350LM\307`\177\271D.\003*\2231(\201"
+	.ascii	"&C\265 \225i\254\331\273\363\364\372\233\035\363V\2649P\257\n"
+	.ascii	"9K\267\225at\205\200\363\337k\247\367Z\030\025\\\371k \224\316"
+	.ascii	"\277\346\323\342l\035tY\331\221\217e\207\320\364\333\216\202"
+	.ascii	"\017\035\356-v\222\274\n.z\322&\351\276\321\322\236\321\224\323"
+	.ascii	"\253\001"
+	.text
+	.section	.gnu.lto_getValueOffset.201.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`~\002\005\022"
+	.string	"\026\"sE\360\320&\035VX\2279\260\025\3767M\375U\361(=\232\371\241\314\370\326\013-j\343l\256=;\027\340}Z\231\031\216\t[\274v\263NaqX\034~\016|%b\034\035\035\332\361\325\307v\023\204\354\275\245L)`"
+	.string	"X"
+	.string	"b"
+	.string	"/\261\362N\345\003vkl\370\354v\013\234`;t\267\331\366G\234\304\212]\331q\260@\362\220\363\202\"\307n\307\235^ \036\346\t\304C\335p\327#|\232.\377\365hT\204\003n2\177\327\371\223Q\024#\006#sma\201\305\323\356\222`\\^j \273\353\214\301\304\334\332m\237\330\346\354\364\t\352|\301"
+	.string	"\263\311O\234l\273,\f|\023\016R\266\016\207\276J<\274^\347\0074\320\020\221\023!gv\367J\265\261\377VklM{8mr\272\364\356'9\275\275\264\366\322Q\323\360\245\337K\247\246\177B\341\314\020\231\355V\230\031\355\020\374\001a{\305\016`;\323~N\217A\375\021\rL_0\236B\240\032.\216\312"
+	.string	"KIR{%\222\217\245>}\371<O\241\013OmL\362\037\226I!\020\321W\034\0253\364\312\243\353\013\337g\353i\341\367<\236\233\245\331\361YX\266\355\276>c\350\214\355\204\235\233\253\260-\373gl\3132\266\b\016=\024\320\264\344\016\227n ^=\002\252\224\221\020\b\320\251\217\325H\212S\245B\032\264T(%+\256d\025B\302\245Z'\334\007\312\254\007\252\026\207\302b\2658w\373\267Zc\023!\n\351\273\242\216 \031,)\200\020A\037\324\244\233J\260\275i*\314Oq\203\274\250\351\323\222\352\r\227\231\323]1\252\246\032\221\013\016,g\206\032\365/;\004\244\235Re3 \300\"\231\253z\201\022\205\177\303\013\215\322\221"
+	.string	"\320\036\006\222\307\325\343\320\241\265\037m\267wI\253e\224\274\035\204\366\025\342\301\222\276ym`\356\273\030\363a\226hK\210\233\2620\177Y4{\360W\262X\021V\200\203\335+\325\214\304\212\221\\\013\036\030\320\200X\354&\022\212Xh\361\334\025\204\006\273\364\210\032_\270"
+	.ascii	"C\2547\345\343\231uY'\003"
+	.text
+	.section	.gnu.lto_cliGetValuePointer.202.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`\337"
+	.string	"5\f"
+	.string	"\006\230T@ q\232\016\214\007\333q\217\216\007\260@\207\217\260\253\211\205)\214\310l-\007(\267Q8\370\221\351\270\255~\255H\220|\327F\210\bH"
+	.string	"0(\024\212d\030 \327\257D\030\344\254\033m\"eJ\001@"
+	.string	"?"
+	.string	"E"
+	.ascii	".v#\002\033\230\016m\373'\216\202"
+	.string	"\263?\002\361\303\312?\030\235\025:vc\345\370\001\321\341tLt\250\036\316=9\377,\207L|9:\025\316Sb\260\273\316Ne\345\326\333.`[\201}\013\001\226\322\324\343}\271\367KQ\032j\032\202i\205\322\251\351\003\310x465v1|x\354\f\370B\304\343os>\213)\333\221\344\233\222\341r!\204\f\034\273\361\300\241\023<\357\225\\\300\256'F\220~\003\007\373\301[X,4\027\211J\032n\224\b\220\251v\204,\337]\364\003E9\276\246j\217N\213%\\\305f\332EY\340\247\020\321&\020\207~Itx\245H\330\330\341\231\344\307\216\234\324\016\366\241U\217\003\027\266)FAcU\200\276@2\315Ua\227\005a\303FB\262*$\2636\325\265M\250@2\326D\260\255\032\321\264\255\242\342\036Z\365P\372a\242'\206\252J\351\277\224\021'\3711\244P\337i\301\244\244v\003\007\371.\022"
+	.ascii	"2\2413\037\030\203\r\007\b\261\274\n\005\362(\261\367bM\253\204"
+	.ascii	"60\025\020m\202pMd\250\305\336\230 \033E\254P\243\r?3\232\332"
+	.ascii	"\371\004"
+	.text
+	.section	.gnu.lto_cliGetDefaultPointer.203.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`\336"
+	.string	"E\f"
+	.string	"\266\227TA\020q\233\016\324\253\236\366k\007\317\331\034\253\236E\357\2738\322\210\013\255\n"
+	.string	"\210`\212\033\033\003\275\216\311\322c\027\222\331\307\332\t\020\002"
+	.string	""
+	.string	"(Bn\0348U\200\364\361\020\345Io\324h\023)S\n@"
+	.string	"@"
+	.string	"D"
+	.string	"\273\361\200\013T\207\266\375\021'\341\3316\006\304\016)\224\212\f\320\t\035\273\361r\274\200\351\260:f:T\016\367\236\236\377\225K8j\304\370P>Oj\301\356:?\224\224[o\233\200\355\004\366-\004i\353\361\276\\\364SS\032jZ\202i\225\322\251\351\177d\\\300\360\264\330\3050\342\261/ \213\017\217\277\355\371+\266lG\221\357I\206\313\005\225\0317v\243\201C#x^4\362"
+	.string	"\273!\032+\002\0254\330\016\236\002C\301\311DTYXD"
+	.string	"\310T\033\302\226\377.\2521\321\217\257\251\332\003\324\342\b7\321\251vM\024\370%@\270\312\303\241?2\035^\255\0209v\210Hrd\307O\352\006\373\322j\310\246\002\231\326\2516\201\203Q\200\3166\033'\273\264\f{\320i!\236\355\362lX\347\312:\t\327&c\016D\353\256\020\216\353.+\356\245\325\220\245\032\022-\261\245\252\342\004DI\216,)\324\203Z0I\251\315\240A\376\2234\023"
+	.ascii	"2\2411\037\270`\303dB,_E\365*@\310N\211\025\027kZ%\264\201\251"
+	.ascii	"\200h\023\204k\"C-\366\306\004\331(b\205\032m\370\231\321\324"
+	.ascii	"\316'"
+	.text
+	.section	.gnu.lto_dumpPgValue.204.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`F\004\205\033"
+	.string	"f\262\260H\240ZQ:\034\274\366\234\320\253\226\216\302D\240\202f\r\314\320\231\301\343"
+	.string	"v\346\326\006\\\305]Aa\337\255\267\215\302\376\353\246\346\025\246\374N\274`*'\017\263 9\267\275\260\303t,"
+	.string	"\t\333(H#\204\020B\244\224)\230"
+	.string	"\217"
+	.string	"\236"
+	.string	".[Z\2154\374|\350\257\326\324\301\206\267@6\377\022(\234\233\352x\327\212T\025a\371_t\237\316\205\332\261\001jM\002\243\245\326\364\301\033\220\033>\335\226\270!\271\003\304\r\177\376h65RG%itT\277Z\353\253\213\354\271\344(\206`\363\371\035\177\312\035\317\266\344\370C\344\250\267c\220\025\301\006j\266\2741y:\260e\264\264c\361r\034\352L^\017\006\235"
+	.ascii	"\351\341\270Y\274\033\350\252"
+	.string	"\265.\325\262\017\036\216y\374\251\265\236w\274\243}\271\377\177\374\177\361\203@\001\334\277\013\030\357\216\247]\270\266}\233\273\335\350\344<\266Udd\255\270\n_*+d\220Iv\210\033n\257h\"\203\364\004\305\203\347\374\251\215[\351_\260v\322\277\351.\201\215\332\373\230\374\036\223\337\332\251=\317B\355\n(\371\254\221\277\263\342\353\224|s\344\257V\374\262\344\223#\177,\371\"\311\017G>(\362\273\371,\362\327\265n\352o\315\020\225Z\215\346\300\251\276\220\313\222\215\332\235Z\251\245\272\371\177\252\006\326^Z\217fi\252\200\210\312\021\"\026l\370s\350\300\273;\206!=\332\366\377\303z\001Q\266\331d\305i\303\322\016Il\245.\353\323\034e\323Zk\330J\\\266G\b:E\312\214\253\247\301\034\242O3\024)38\256Z\256\265\332z\r\210\255^\252\345\036*E\252\f\216\253\016`u\210\004\272\325g]\257"
+	.ascii	"\213M\366\b \336\235O\273rm{\330c\223\335qrL\267\022\233e\354"
+	.ascii	"\rG\302\006[\354\3151\335x\316\273\303\3568&\366\312\t+)P\324"
+	.ascii	"\304\r\301\356%\224\t\017\013\350_\005\013\336]\367\2010A|\001"
+	.ascii	"8\253\2732\270h\n\\E2Z\002S\006\021\027\t\325`1d\036hB\260\332"
+	.ascii	"\r\331\016\r\032\f\210\250F\r\006)\253\t\301p\204\217A\b\022"
+	.ascii	"\212\275d1X\214\231\254\310F"
+	.string	"\320\313F\020\254\306+6\243\275 \024\370\020\221l\366*\032\032\232\275\314\264.X;\251\305\026\037\217\276\221>\326N\263z\257\220\331i\022h\033\235\376\2169\221\\@\223\224\220\271\024\023\304\350t\251\303\342\324#\003\376\317&\347\223e3\344\247\346\326\266+`\007k\236M\247\323\252\315\33639\246\033\230U\317@\021p\331\337/\347S\b\324\b\022Zknw\347\0242\027N\250\2210\242\224r\204fD\002\th&I\216\001\240\002\021\242\333\r\021\020\265s\316\031C\335\001\225m\r\345\273W\301\270\027\177\211\177\240\232\326<?\262\253\324\377\220\033\030/\216\367\001\343\r\262\025a\364\207\235\225n\016:R\205\351\276\205F?\266\377B\352n\363\205q\223i\253=\334w\277\210U\n\032CP\331:f\340hy\3451\021\201\332\356yz\234C\016\362\360\376`eZ{\264\274\261\304\023~\217\275yW}\351\211\330"
+	.ascii	"g\2244\300\020\331\005\013e\307a\200\350O~:\375\366^\345\250"
+	.ascii	"z\3676\223\367\222\232\344\346\031*"
+	.text
+	.section	.gnu.lto_dumpAllValues.205.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`\352\002\215\027"
+	.string	"v-\235G\300XM:4.\263\222L8\b\250{\304\351\370i\377 p\032\260\031\364-\031H\001 \224\273\352\262s5\332\372\2377\232E\333\327\203\350-\226e\b\242i\362;(,\230.\351\304-\344\266\341\032\275\022B6\221;\245\210"
+	.string	"\200"
+	.string	"\213"
+	.string	")\274\265\346\310M"
+	.string	"O=\247}#?\"\373\320\n\323Zu8\221Rk\331\300\013\300\323\232\017\360N\347W\336\251e6\230\227A\365\003\322\303F\364Tk\025w\207\275)\373\347\321n\247\314G\362\004d\226\310\333\354_\367\325`\374\020p\263u69\247\244\027\365L/@\020\237S\032\357:\b\265\247\033\002n\265n&g\343r\244O\0277\332\334\027}A\216\211\274\371|~\025j\255\236\344M\306\r\336v\013\333\030\354\245\tQk\204\253\335v\201\354r6m\202rN\336\037[\365\362\257\371\320O\363\243;\365M\207'\272A"
+	.string	"\323\0378\355\315i:\247\2739\275\337\364\364\246\277:\020f\213\212\245ZaD\225\251Zh\022\220\037\375D\237\366\355\033\371H\016}&o\"\373Q\354\225E\f"
+	.ascii	"/\232|X(\301\257\274'\361\213\034\236\372J\276Dv\"\024\340,\006"
+	.ascii	"x\324$\344Tk\311\340\324\025\300S\004\335C\373A\004\331\313d"
+	.ascii	"\214lP\316\202C\310O\267@\356v\027\246\344\013m\346L\263\335"
+	.ascii	"v]\302\335\025\025\033\324\314\rxs\303\365\264\331\350\261\207"
+	.ascii	"_\371@\207\340\236j\245I\2602\206LU\236\252\034\027[:\0047fH"
+	.ascii	"5\2776\210\020\363\244\021\320vf?\351St|!\263Z\363dk\267\006"
+	.ascii	"\216\210\r\236\031e_JL\201\227Zi'm\277\036e\024\203j\245\331"
+	.ascii	"<9\024\022\335\205N\355\272\361N\236\3727\336ij\217\364.L\256"
+	.ascii	"\211\364\341\231\001c\f\207u\202\272~\243\303\322`\242DL\004"
+	.ascii	"\370\312q\355\264F\016c\f\207ub\306-\007.\234\2268\266X#`\343"
+	.ascii	"\316\313%\276\\\254\022b\013\246#:(\340\034\023#L\334\311\311"
+	.ascii	"\201\211aY\277?6\222\203Jb\264\360l\317\267@Na\241\252\245E\246"
+	.ascii	"]\200\373\355\005%o\277\275\rJ\351K\031\272\013Y\303\206\r\336"
+	.ascii	"\251\267\007x\274\253\265Vo\201\216\302\003W\265/:\305\222cb"
+	.ascii	"\221\243gF\315\031\224\300\244\233Z\233C\207\332\316\\\263t)"
+	.ascii	"\0043 P\202!\245\222\007\221\300\336\351x{\330V/\301\261\r\f"
+	.ascii	"vn\367L\003=9y\002c\326\026-\313\336\030R\223\272n\225\366\005"
+	.ascii	"\3509\266\202\034]r\313,\355\313\265o\273\225\337\241\203\367"
+	.ascii	"5Q`\027\357\216\253\032\307\253=\036\370\022\264[\311e\3530\020"
+	.ascii	"\300\226d]\334C<b\265\0233\267\035\204\260\251\347\374\215\026"
+	.ascii	"\f\365j7CUU\0346\367\326^u\212;\255!\003"
+	.text
+	.section	.gnu.lto_cliPrintVar.206.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`\204"
+	.string	"e\n"
+	.string	"\226\024J@0\211*\035\314P\220,\030Z\322{\373\002\030`#\257\367W\022\231\266KA\235FO\020\247\361\tNG\355\321\030\301.c\210\200\017\005\005\244\343)5\212[\207\345aN\\T\320%\215\033\311\235R5"
+	.string	"9"
+	.string	"6"
+	.string	"\363\302\025\331\245\347\037\260\313\354\016\330\245=;\302\347\201\245\240T\245\004\026vWS\003\367\036=\377\255W@\323\367H\341\330]G\320$\340\326\333\246\260\275a\377\022\273"
+	.string	"^\256\r%\003\324Y\277\375\267l\261\315\262\204/)@\005D!\230\260;-.\235\221i\26414\274OQ\304)\204\251\006\230G\373\251\253\274\257F\336\260{r\260`7\023$\375\214\351\225\301\245\240ta\024_\306\242\252\035\022\211\007\245B<x\205%\372\331\363\213Z\300\376dw\327z\262?\177\354\254[~\365\253F?\273\f\200 \252\020\035\350\243\235Nh3\3512!\352\r\303\351l\232f\313l:\r\310\303\321<\234\214\207\266u \032F\302\334G\323i \216\3534\313\334OVO\356 \020\216\224\304\225x\225\312}\304\203\016\f"
+	.ascii	"3\241G(\206\310\213\017A\005\250\256\201w\\3\bb\222p\013\372"
+	.ascii	"\006\250U\300I^\\\223\f"
+	.text
+	.section	.gnu.lto_cliPrintVarRange.207.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`\026\003M\025"
+	.string	"\326\245\207J\260\022R:v%\277\205\026\301O\362Y\270\212)^\245\273\266\3428\263\205\317e\002\270g\350Att\324\333Q}\r3\305\230o\207\236\376\255\367\306\272?k\027\246\211?\3207 \300\314\031O\262\0364\316a\247H#\204\354\235Rm"
+	.string	"k"
+	.string	"w"
+	.string	"=W>\366I\\\022j\331>\265?\342$p\377\341\234d7HJi\027\250\342\024\362\242\201\0170^$_2^4\316\236:\320\267,\241\243]\220jw\315\n\002Gq\037\305\260R\234O\257\242x\275\334Gz\365B$}\036\276\350)V2x=\237W\236\035\235qdw\001\364t!e\301\354\256)\257\307\341f\335\366\315\266\214]a\002\026My\333\323bh\327~\320\377!}\273a\201k\340bH}\321\017"
+	.ascii	"\361\320\037Fp\002\343kH5\335u\320q\205\233\270\221\273;,~\t"
+	.ascii	"\032\013d\210\213>\316x\361U\334E\211\370\345\320+\033\230\243"
+	.ascii	"\365\203\375Cy\300\001t\r\262)u\310\177\177+\244\006\241\324"
+	.ascii	"dH\315\252\324cH-V\352\220R_\344\204\nJ\203\216\335\206 C\317"
+	.ascii	"sXs\276\212S\033Da\t\025+\253\036\370\031\021L\244vu\347I u+"
+	.ascii	"\005f\\\364<\227\272\232\363XY\2573\311\036\214Q\363\002\203"
+	.ascii	"e\254\017\336\370\205U\254G\332\375\310\211}Iv'){v\0275g\362"
+	.ascii	"\331\\\311v\361I\276\260\266\020\3458\212\237\374<\345\250U\002"
+	.ascii	"_\217\035\025\311O"
+	.string	"*\247V\370,Fh\f-\220\221\237\302S\344n\356?\001\206\241\224.47\262Z\214Vfp\235g\f\211a(\245J\tC)]b\262\232\353,a1\f6\032-\306\344t]\250~\255\314h/3\366rM8c7\265\231Y\233\271l\314\327y3W\006\330F!v\23276\333i\266\200\373\032\344\231\252\247\234\252\343\237\370\251\325\b\002\265\200\001\251S\300Ss&+H\203\327\270\275\370\034\334\351AK\223IV\021#\036UG?i\022\005\320Vu= \260\002\0311:\017\262\200\205\230\001\023tP\373h&\323\266\262l\013n\004\230\302P\rv\373\210\223R\360@\276\213\271\372ws\271\206\240U6\345\251\214\214\203\352\260h\b\236Br\270\215\355`\006\3342\002@\303~\213\301G\326\002\233\203\3574\377\026rX\2028)\013\363\227E\263\347\376\312\213\225\200\024\340\327f5\201\005\004\003\203o\226("
+	.ascii	"\303\264\241\371L\t\036Q\266\370\336\365\226\370\"\2515\327\261"
+	.ascii	"p\242s\351\023"
+	.text
+	.section	.gnu.lto_cliSetVar.208.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`o\002\265\022"
+	.string	"\266\243{G\340\360&\035\343\272.\033\201\216Z\302W\366c\377\265s\363\021\023\353 x\316\312\231\325)\002>Yt\024\006\3330\356\005PCc\363\211kYq@\f\204p\204ch"
+	.string	"\304py4p\003\300\024\360\214\244\221M\344N)f"
+	.string	"`"
+	.string	"h"
+	.ascii	"&\336'\210\274\264_\342&\\\377\201\271\200\335\234\026\265]\261"
+	.ascii	"\304\b\274O\213\017\351>\275\017\350>\355\262\227.\202X\024\317"
+	.ascii	"\223\f\315\306\356~\372\341\256w\223S\351\362\017\204C\241\354"
+	.ascii	"\365\256\306T\232\"\356\264"
+	.string	"7\300\231\231\021\312l\2561X\027\262\223\024\002\200\314\202J\024\203\335\265\fe\031n\324m\243\330^`K\240\235\332\023Z\344CO%\321Mf\213\351\313\026_Ru\354\3538\216M\326\034\233\223\366x\320\317q\241\333\373\317\337Mi\345\244%'\375\217\223\232\013\327\270[3:\255m\"\361\\\350\267\177\232;l\013Y\006\310\336\366\030b\370\3140\355\212$\237N`\253x \327\203*x\356\316\234j\273\261\022\007\034*\365\003g\346\205\314S\214\034\375\242\237\330\330^\362\206-\276\376\235\244\035%U\035\377\350EG\222\033\214|\025\2375=;\333\221\243\260\275\344\355\276\336\341\263\365\271\320\263\273#\237\036z\332If1\371d\275\201\356\352\241\2262709\332f\375\004\212\267\033S\340\023\201*\236\b\230\356\363\352\340\206F\342'F\216\366d\240\013\213\256(\244\244^&\230zQ\253LX)\252o\245JE"
+	.string	"W.-\326\327b\245T>\025\330\362\231\024\360\n\313\n\374\\VV\300\257C\334k\216\275\333\221-Fa\226\004V\203O\310\264\342\216\234\333\335\3558\324g\321z"
+	.string	"\241\373\004o\214\2328\324.r\0331U}\245VJ\245\372\001\243\031Jq\221\233\007N\252\277\242\265\n"
+	.ascii	"\303\227\020\322\b- \300\202\231\261\352\203\200\353\207\300"
+	.ascii	")p\247;\221\305\315\364\364\320*\311\026\273`\343\3200{\226\242"
+	.ascii	"\200\034so\240\3330\003\354\2215\304\221\262G\230n\317 \254\002"
+	.ascii	"\255K\237lB\2424xJ0@;h\303\232x\3405#\020[\022\0036\306\257H"
+	.ascii	"\273)\200#[\334%\326\005\220\241\304u\334\204|\273L<\001"
+	.text
+	.section	.gnu.lto_cliPrompt.209.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375 \360\275\006"
+	.string	"b\214/6Pm\222\016$! \360\357N\021\032\216A)\266F\240\2300\032U%\006\306h\373"
+	.string	"\203U15\234Bk\234\231YDP\351A<\265\210\213\016<0\266YBd\n#d\004\b\246)\215\365@\305\212\3328`U\207cE\216\265\201\210\024&\0215\007_\021\025\026;\327\205E\314(\013A_H\245\356\002b<\275\212:2Q"
+	.string	"\222\351\351Fq\361,$t\372\n\213\327m\005\322J\227\001\265\037i\017z|-\tA\017\007B&\\9P2;J*\331M%\241\277\230\263?1\320H\215!D\264A\222\222\231\021~4\353\313nE\032\260qZ\037@Cf\3766\356\323a\377\314\037\377O\b"
+	.ascii	"2\001\007xF\340\002t\rw\013a\274\f\001.\335\242\235O"
+	.text
+	.section	.gnu.lto_cliShowParseError.210.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375 \367\325\006"
+	.string	"\022\31504`o\032\003\024\022R\326\230\206\313!_\340\220\244\364\004\025V\023\345\260\343\330C\3011\321\235\241\013+\245\351PpP[\316\177x\270\007R\\\037\354/eJ\001\235\326\234\322@r&\345\220i\324T\020\021\312H=L\331\331TpSQ\0210N\016\324\024\324\222\220\023v,kB\214\350~\241N#\217\355\342aTr6\361\311\304@\310\357qF1y\024\020,\265\025\026\316Y\023F\035[\306\303Z\021\346\336Gk\200\377\357\013\265/C\362\321\374Y\3719^\\\276I*\"m\215\351\325\262\020h\034[\030I\331@i\371\017\037\210/\273\253v\211\0052\r\263\013h\370_\227i \367\271\355A[\206\266\240\007"
+	.ascii	"2\001\007xF\340\002\264\313\370\227q\301\245[\264\363\t"
+	.text
+	.section	.gnu.lto_cliShowArgumentRangeError.211.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`\230"
+	.string	"\355\n"
+	.string	"&\025NA m\234\016\004\301\020\""
+	.string	"\265L<KTg\303\324\203\345\260\004\302\030\001\303H\006:\360U\033\215\364d'\275k`\220N\020 \004\200\007\002j7K\215\020\361\247\r\244\255\276}\302\237h\244\355\235R8"
+	.string	">"
+	.string	":"
+	.string	"\273\345\305\035\327-\227\247@n]\277\200\334\262h\223\300p\260\343\007\bD\207dbw+\265p\361S\364O\272\204\364\214\237\221"
+	.string	"\273\353Iz$\334\364\2665l\013\260_\t\241\177B(4\\\360\034Bj7B\352\304\236\254\020\030l\177b\217l\252*\266\001\205\007\036\263|\007\361\"\233,\331\235P\242\264\273\027\327\353\026V}\332\337p\016\342C\nn\261\373\021Q\nK?\276P\031N\013(\003GfE)\235\364\036\376AC\031\261\3139y\340\342"
+	.string	"\330\270eo\022\314\223\346@\201N\035:\332\3458i\005\373\325\356\256\351\307\376\350\257.\372\351\003\316X\260\214\227a\031\013\346m\333&\334\006`\341\347a\032K\005A\326Q\217\353\350\326e^e\r\303\025\320\352\246e\004\300-\364\270\352qYW5PS1\031\376\fl`\r\277\017\254\223r_\005\r"
+	.ascii	"2\241;h\340\303\005X\256\001\003f\f`.\350\234\022\202\005\002"
+	.ascii	"\203+\322\324\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_nextArg.212.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`_\001\025\017"
+	.string	"\346\233eF\360\222(\035\"\371\253\352\233>\255h< \032C\256"
+	.string	"\212\362"
+	.string	"`\006\217%\337\017\020\351V\300k\274\t\327\277\265iO\253\237\023\305\f\366Z\206\305a\361\275g*l\210/\236\260\346\211\221\030\326\320\310\336[\312\224\002M"
+	.string	"Q"
+	.string	"R"
+	.string	"\233\277\017\220\217\234\013\220\217;\242S\370\335P\273\313\bW;_;u\220Qy\245\313\216w\322\b\267\345\205\214\210\227\202\016Z\250 q\330u\345\241\024\276P\276\207=\202\214e\243\362P\256\332\2039\247U\345}\270\265\3336\331n`\037D\326d<\313\017\377\335\252\352sBV\350\360\316\2621\247\207\231\217\031\2133P\374\373\355\023\037\346\216\355\257\0030k\346\275\326\213\306\2169\277\003\217^\240g\351\036`\316\326\214\2149?\0046\300y\374\312Y\234\270[\016(\223J\202\027\315\206\227\2339\277\227\345h\211\021\327e\221T\312\217\225K"
+	.string	"&\245\206\306\325]\271\223\272\261\004\323\303\005\207\006\345\001\347\234\023*\270\256\\\355\304\232\245R\234t\2660D\264f\326QG\356\030\t\327\276\200A\257\212\2537\262\225\030jK\366W\322u\331gPCS\302\333r\034\311d'p\020H\241\017\307Y\360\200\330C\002\242\340\331>\236\022\t\334\207\024\002m!PI\205\315\303\2156\222\002\026\231|\270\215$\022q[\347\233\337\326\032\302\273\270\246\355c\262\230\230iO&\344\272<\362\221\374^\305\345\306_2\2148'\276 2\226\315*\204Ig\001\035"
+	.ascii	"Y\005VzCf\306\311hhf\236\300\362L\210F\273\361\245\342F\273i"
+	.ascii	"\037H!\324\325\246\032\316\324\312[\244\202\020\224\270o\305"
+	.ascii	"\303\233p\034EX\250|\377\314P\247,\341\210\225\312P\204V^\363"
+	.ascii	"`\240(\233\256\371\004"
+	.text
+	.section	.gnu.lto_processChannelRangeArgs.213.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`\007\004\325\034"
+	.string	"vu\274J\260VU:dm0\342\n\341\302\2763\364+g\216\031\013\213\301\214o\345Q3\307\262\317\237$\243^\324I@j\333\2256\335O\336\367\215\364j\005\2149\274\273\207\232\377\324\317>\\\374!\256R\374\277\250\334~B\b\331r'\031\251"
+	.string	"\235"
+	.string	"\251"
+	.string	"=#\214\232\372!\335[\367\006)\217\334[l\300\n\322\233\377q 9\254k\025:; \007\304*)\210(\357-\302\270\370\231\363f\372\327y\263ip\275-\236SUwU*EO\323v\325\361\215\247\300\023.\177@\024W\331\231\033:\210\207\322\342\307*PB2\362\344\353\016\220WS3\202>O\201\202\302\243/~\252\200/n\332\004QOH"
+	.string	""
+	.string	"}V\200N\017\216\025P\247Z\373\3629j\372\321\021@i!\264\f\232v\374\254\200\275\332O\036\003\321\351\nP\320\347\025\215p\357\345\372\003\006\317\25333\0213\333\230\333(\215\242*\tQ\341\322=d.\362\352o$q\241\202;\210\231\346D\177\200\027\377\227\353F\347\026\353\254,\363\241?\006\346E\347\364Cg\024\255|\242\225M\264\262E+\367Y\271\236\225?"
+	.ascii	"\246\211\005\360<P\367\366,\273\334%\023I\216\033\375E\257\314"
+	.ascii	"\347\023y\022\211#\261\006\241\027\345\275wU\204\177d\304JA\304"
+	.ascii	"\250\247{\257\205\364C\370I>\036\231\363\"\234\337\340\375\n"
+	.ascii	"!\242\323\323\275\305\0057\231Bz\363\200\375\353$\301\274\272"
+	.ascii	"y\346\034\346\02537\221\211 \017j\361\004\r\353\006\302%;?\273"
+	.ascii	"\272Dm3s\270\023\333/\236\020)\334\242\303\351\354a3wx\223Xz"
+	.ascii	"\357\205\300g\222Af\240\306\275\367B7\371'\316\233\377aqu\367"
+	.ascii	"\313\330\003\225\342\313\256.Y\311\356(\311\3049\3236\205 \241"
+	.ascii	"\214R\006\274]]\221|>Jt\221\351\233CB/\306(\307\030h\257\266"
+	.ascii	"Ls\365ma\3618+\235\255\256\375\244[\0376\216\364@\036\263\360"
+	.ascii	"\352\222c*\253\231mh\365\277V\377\350.%\223\226[Q.\203\330\036"
+	.ascii	"\262\356du\013AF1N\351\325(VU\264\231k\267\372\037\253\237|K"
+	.ascii	"\311te\251\027\f\242F\004\210\\\254\006\263\335j\265\233\214"
+	.ascii	"\300MlD\227\230y\260U\260\301\305\322\234\r\3476!g\233\325pl"
+	.ascii	"p\022<\320nb#\\3\033[\fg\342r!\232e5\264\033\031l&\213}\300\315"
+	.ascii	"r6\032\314"
+	.string	"F\213\325`2\234\bXM\001\276\205\230\341`\271\333\r\007[\025w\267)\264a`\372\306\267\226\232d,\355\232\247\352!\307D\2454=s\204\361\245^\311\323\336y\362\3579\312\340IY\315\266\3064\332;u\312\355\275\367\246zH\263\201\211g\351\253Q\351\33135\376\303\362\307N\263\317\266Z|1\370O.\304R\276\211\363\246\331*cK\250A4\210\214BH\021\022\232h\024\024d\213\001p\002\241:b\007\020X\312\244\311\264\006S\262[\207\237^D\376\304@;\205\204\362f \206u\315\342l\307\255\037\265h\177\244\341\241=(U3VJC\325\001\260\366\322,\f\203`\201d|EF\270\0061\021J\203\033v\035%\037\325\333\307\246\025\024Cu\\n\375\375\035C0\201\326Dn\362\201G\006\341\016\321S\210\253;3V\b\201\020\334\314\320\020\006\272\344\235\235\237-Nz.4\013\354\335_\256\354"
+	.string	"\252-"
+	.ascii	"\321\272\306\2172\312)]o\305j\022\224\n"
+	.text
+	.section	.gnu.lto_isEmpty.214.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`\263"
+	.string	"\215\013"
+	.string	"VVQ@ \217\223\016\303\002\021\030\217U\002"
+	.string	"\372\314\001\\\200\217\024#D\021V$\317T\245\3312\346\315\254\261\226\007\302\242*\233\341bs\021\022"
+	.string	"\330 B\322\007\375"
+	.string	"a\270UY\304\275\221\261\367\2262\245?"
+	.string	"@"
+	.string	">"
+	.string	"\030\016:|\232 \377(\207%\262\020\034V>`\241\303\311\302\337\005\003y\232\335\265`\244\324\207\321m$\027l\3640\231Jw\224\247\bF\312\004\260`w\235\023\260\nw\274\355\006\2665\354\023\b\024\260g+\273#%\027k\002\222\320`\373c[lg\3327\371\206\317O>\036`W\363 b\227C`\003\323\241\271\013\210\207\3231\361\320\266\023(\370\0304"
+	.string	"$\244Bc\273\020\322\201\305.Gi%\376S\245\333\262\247\232G\274fRV\234x\212\004\217)\303\265\300\b\005\b\022Q\2262\273-\033\241\376\210\252\fR\220\262\205\315\205RK\354\277\335]\253f\370\223__:5\375\310a2\022\0168\326\345\351\210\2562\254\007\025\265\25168\256\215\207cQ\034k\003\002U]\035TF\306\235\b\233\213\362t:\027e\341\366\2529\365\300\363a<U\3046T\215HGN\205\372\220\027\242,E\250\001\017"
+	.ascii	"K\b\230P\307\023\206\242\262\312\334\352\350\244\211\004\242"
+	.ascii	"\200\306\345\204\360\271\214*\325\370\211ea\"\341\252\252\206"
+	.ascii	"\364\256\002\005"
+	.text
+	.section	.gnu.lto_printRxFailsafe.215.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`V\007\225'"
+	.string	"jFL\017G\200ZN:Y\024\036JX\312mR\3259\206\037\317\247\201[\024\bg\347\306\334\300\210\253\232\317\357\372?\261H\f\235\330\237\305`\030\353\317\2028\256\177O\313\217ef\033r\037\255C\031T\342@k\226\020B\210\224I\006\336"
+	.string	"\311"
+	.string	"\341"
+	.ascii	"\365\255^k\314X\020\251\364M\366O\266wsov'\304\237\255x\325\252"
+	.ascii	"\207!6\006\004M\255H\0067\227)\275\351+\271\267\313\304\254K"
+	.ascii	"C\363\356\313\276\204x\344\224PO\275J\372\200\200|\320y"
+	.string	"3\375\317ys\231w\037H >I\213\355Z\275\322\250\324\212L\332\005\351\315%\356\316\t\271\250T\021\306|`\231\271\251\265\376\272\307\372\274D~yL|\217\267K\321\323,\233\211\373\344\r\034\327$\343\320\214T\357\225-D\215\214\277\325\350*+T\221\261\346O\254\230\307C\213\353\273\002\351\016\255\343\321\277\325\330\302\342\363\306\315\236\261\310e\271\300\313\213\215\035\243\2132(\314\227\231\247\235c\030\257\270\377\344\346\027\227\226$t;\264\270\316\250\205Z\353r\226Q\353\233\363\335m\333]\263\335\223G\t\272\271\312\364\201Fj\223\255H\306\337.\347\233\373\305\"V\\\267G\375~\3321\2609b\261\212;\213S\305u\r\367\"NGw\330.\222\212\211\332l\201\331\006\333Mz\222_\301\321\276\t\316\344Gp)_\244#\377\003\314\353\373\331\367\210y\t\240\274\003\230\327\350\344-b^\"\346\035By\205\230W"
+	.ascii	"\363\006@y\203\230\027\350\344\375a^\037\346\005\300\274='/\017"
+	.ascii	"\363\3560\257\016\312\233\303\274=\346\3451\357\216y\323\223"
+	.ascii	"\027=y\317\223\327<y\313\223\267M^6y\357`i\215\306\f\343\271"
+	.ascii	"\324j\245Q\007\247\272\231kC\216\366K\371\317\336\273\237r(\373"
+	.ascii	"(O\333\236\224)\013V/2\214\211\021\271"
+	.string	"1E\233\352\tqd<\375+G8\2722 \346\265N\037\365\036N\304m\034\277\030\251\265\370\254\021i\361=\022\334\364\365N\357\222(\301\317\332\262\036\233j\025\364N?\247uN\374\rHa\357\3660\301r\205K\347\263\226\316\2339\335@n\255\354^\007\223]g\314\271]\363\032\375\352j+z\r}\331\316\264w\335_\212E\320N\373X^\320\376\224\377\214in\274\224,\332a\313&\203\037ll\b\226Z\331\340\276\216\301o:\273\215d\314\351P#\346\354\260\262\305\352\200D1\033\354l\263\317c\313\331W\223\033>\013\231\331\r\344\312\252\270\356\007c\263\245\246\354\260-\273\3334\246-I\312]\361\0336\"e\277\355\307.\212[iJk\275\232\260_#\222=\245\265\326\213M\2357\273y\250\322\214x))\253B\320\001\253\263&\220|A$\237\n$\037\323\020\250\304\002\252'\030d\024D=H1\251"
+	.string	"*\tM\034E-\r\225\234\236.0\t\235\234\200'.\b\225\200QLC \006\026PB(\242\200\033R4\2510\221n\320\301\220)\370\023\006\201JPB)\247\341\317i\bl\372\005\241\242~\016\212\366)\205\020\352'\365\364\004\365\353!\253\333\223O\235(\251A\207\246\252\255\334z\035\266:\\vIm\"\341\215\301oI2W\374\246\254\265V^\207}\305y\324I\315\345\310\226\214s\342e\305u\274#@4\240\t4\372\225\243\r\303\351\334\f(j#6EsCk:\334\3061\356CZ\274\021\242-\"\241\036\252\343\3604h\204\004\364\325\236\212I\346P\303\212\303H\255)BR \366\351"
+	.string	" \202:@\210\233)\023\364\323@r?\3758G\270#eU`\016\240}\032\375\302q\366/\357i"
+	.ascii	"<\335\023\200\213\250\221@\004\tB\204JFDI\222$\351\240\002\021"
+	.ascii	"\262\252:\021 =\207\224\031I*\325jhS\262.\321\020\202,h\277\226"
+	.ascii	"'\275 \323\200T\f\006\005&[\206\251\231Iz\233X\316\270\002\021"
+	.ascii	"\216-u@Kq\302\351\307Q\340\017^>\020N\034\\\356MhZ\006<\246c"
+	.ascii	"!\314\342\272\n\001\330o\272\316\255\313\2261\025 \213\274\031"
+	.ascii	"Xd&\336(aX\346\312t\024\033\307[^:\262\372\220\352r\b\323T?4"
+	.ascii	"\207m;\365\216\210\352\376\261<\350cdb\362%`\203\325\333#V\273"
+	.ascii	"\216}\020c\036\304h\210\006\037[\335\343@\t\202\215\273H\240"
+	.ascii	"\227NK\020@x\301([\236\341\223TNJY\210\2411\240\013\037\317b"
+	.ascii	"2\022~)\352\306O\241\211\261tM\233\302\024\304*\271+>\311K\t"
+	.ascii	"\016\032\372\232\342\226\021<\033\036\020;\310\r:>m\306_j?\263"
+	.ascii	"\001.\303\276 \255\250<\016!\2430\343\034\224:\bgcg\263\261q"
+	.ascii	"\342.\304J=\3405O\260\243S\001"
+	.text
+	.section	.gnu.lto_cliRxFailsafe.216.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`>\f\rD"
+	.ascii	"Jw|\032A@\244N\007+A\237\366\360wSw[\265\252S\0206\r\212\327"
+	.ascii	"ZS6\\\305u\024\304\210C\207B\237!\273\244v\btC\306\275\261?\303"
+	.ascii	"\247?\301\t\313\330\230\252f\206\355\245\221\220\275w\222)\005"
+	.ascii	"\231\001o\001\230\001\215\304\353\362L\226]jG\256\007\2133\216"
+	.ascii	"\346\365;\031Oaty\354\210\252&8\347G\205\321\331\247\325\217"
+	.ascii	"\33223\276\230\310\375\020atv\f\215'']\006r\254\262\t\316ep\273"
+	.ascii	"\3660\215\004S\243(\003f\037\233\022\207X\301\350\354{\325\353"
+	.ascii	"\032\331\f\034\274\376\345\313\306\236\270;\2069\323=0z\227\327"
+	.ascii	"\275\340\360\f\315F\3018B\303\234\247S\3166\003\243\263L\357"
+	.ascii	"\270\333\347\\\313\353[r\2702g&b\356r\246\243j)\243\263M\347"
+	.ascii	"I\255\263F?j\235\355\267\233\220iGv6\210\253\023\255\363\223"
+	.ascii	"s^\276\2236\362\225\316{\305\257/)%!\035\031)\213\210\206\222"
+	.ascii	".\362(d,\266\354\372L\370m\037s\372\222R\235\233'!\035\025/,"
+	.ascii	"!cs#\300)\224\365)\357\tV\016XB\266\346Ej\210\326\bf2\032\007"
+	.ascii	"\234\252\255E\270\3047\207\233\242\341\241%dj\236\224#7\347\002"
+	.ascii	"N\221\2609\202\221gpS#\370X\2740E\016\n\236%dm.\2642\0303v\306"
+	.ascii	"\001\247fkR\216\020\316\341\246e\330\270\266\3244N\034pZ\266"
+	.ascii	"J`\323\346\347}Epq=*+3\307\001\247kk\2029qf\236\027\305\355\232"
+	.ascii	"\004\244M\352\200\323(\253\224a\232>\036\006\212\331\365\333"
+	.ascii	"\364\364p\300)\333:!M\217=^\347Xl\354\211\327\343\233\020\177"
+	.ascii	"\243\020g\032\032\333\261>\345\234\275\316\007\300M\255`\\\274"
+	.ascii	"\220sn,\035#\363n\362n\247\353n3\335\307\264\004\336\300{\030"
+	.ascii	"\377\020\007-\021:\345\211\023\331O\353\244\364'<;\310\324b\270"
+	.ascii	"\315\327\234s^?\315\277\332\246\237\360NO\264>\350\331\023'\366"
+	.ascii	"\022\376\357~I`\227\366S\022>z\357\265n\347U\023F)\376\356\023"
+	.ascii	")\260K\377\237\240\357\354\246\307_\244\242\275\211\"\202\341"
+	.ascii	"\304W0\367\207\355?\255\335\235\016\213\3741=\223\236\321\372"
+	.ascii	"\263\250\016\206a@\255\304\004\276{\205\025v\251\277\327\271"
+	.ascii	"\367\260\343\222\377\030\206\275\263\233\356\211?\255\333\035"
+	.ascii	"\020\276\321\3653\351\236\340c\274!\270\270\027,\253\374\316"
+	.ascii	"\233\312\375\274\0238\237\367\224\024\002\027\367\001\307\363"
+	.ascii	"\216\202r0\336\006\\\334\005|\213;\001/\343\355\344_\274\233"
+	.ascii	"\\\334L.\356%\027\267\222\213;\311\305\215\224\304}\344\3426"
+	.ascii	"J\342V&q\027%q\023\271\270\207\\\334I\027\267\353\342F\016\341"
+	.ascii	">\272\270\205X\334\306$\356b\213\273uq\263.\356\325q\277\213"
+	.ascii	"\033\267\270\275\002\200\272j\234/qv>\220.\003I\024\224\377"
+	.string	"X<7\367s\347s\037\343^\306\375\316\035\317\035\214\273\027\367/.\324\355\355l\334M7\262\263\274M\3530{\323\310\254n\244\232\3665~0nD\221;\222\245\327\336\307Wc\315E\3502\031\021u\355n\316\317\213-\327\353vjVg%\347\214\354v1\355d\334\214\247\361\274{P,7\310\016|\222\355c\366\246\032hw\306\022.\370\003\337\030\332G9f\375\005\357n|\305\262v\227W\305n\3173\321\375u\351\376j88h=\202\205L\362\303\f\036biY\230\213\303\234\352\235\215G9\367\352\264M\362\320 \227\317v\331\223Z>\3663\210\247\352\211\252O\016\243xB\271M\355\370i\270\373E\362\242a\2276\026\034\334\373{\276\363\357\334\314\b}Z\277\313h\251\240\272\3549\251\322\t\303\200\260\260\363U\002A\n\316/\265\201Z\316a\021\020=\361Ms\362\256\255\265\316R}\2005\274\004\217|"
+	.ascii	"\325\265\302\343'\370\265\215\240\367\315\030h\352\217\357k<"
+	.ascii	"\005u-\020J\005\t7\345c\3744=>\365l\027\275B),\364\256\306\377"
+	.ascii	"\274o\t\324r\206\272\264\375\320\375\274l\353\353&}\337\3327"
+	.ascii	"\356\225\303.\235\372\247\035\357l\343\013\375\352{\336'o\225"
+	.ascii	"(\306\367>7\002V\327\372\304\314\300\334\2736|\2125Z\251g\235"
+	.ascii	"z\201\325\301\002\330@\226W\013v\251\324c5\203o\177\330\277\332"
+	.ascii	"\342#\370\021f`\236\201`\360\2368\221\213\033~\271rLo\312\331"
+	.ascii	"\003\337\353~\255x!\206\266\tN\341\263p.\347\034\341\216\023"
+	.ascii	"jh\217\342lo\350\300\266{h\235-~Kff\367gK\373Q\317\266\371\366"
+	.ascii	"=\317\215\204U\265\300\350\234'\262_\340\033G\213\030\355@\343"
+	.ascii	"\244\3754\245\177\265P\377]\364\250\3256\354C=6\323N B`\227\262"
+	.ascii	"\277\300\003\255\305\344\342\262\302\2722v\262[@=]A=\321\200"
+	.ascii	"z\322\312\262ra\243Y\324XU3\260\274\254\266\226\\][[]WN\215U"
+	.ascii	"e\243\271\264\321<b\266\350\002\321\202\3515\203\231\214\341"
+	.ascii	"\314\030_^\353\312\244\241eU\202\331\314\242!\203\331t\233L\257"
+	.ascii	"+\253\246\025\226\006f\213\256\255d\323+\306k1\271\270\254\260"
+	.ascii	"\256\212.h\260x&W\226V\213\255\253b_Uei]-\231WV.\232L/\256\254"
+	.ascii	"%W\226\325\326\362\2529cY\005\240\273b0\233K\257\256\256\346"
+	.ascii	"\022I\007\346\027\300\376\371K(\314\366\376\264`_\300\224p\254"
+	.ascii	"9/\261P\347JC/8\321\227u\356lI\262\200\225S\356b\360\332\373"
+	.ascii	"\214\332a\204z]\364\345\201\303\270R\220p\354\017\372N#\0361"
+	.ascii	"W\220\230\232\274b>\214P\257\002e\372#\325\255/\212x\024\001"
+	.ascii	"+\375\322\027x\327\303\324wL\200\340\033\304\b\365&QC^\"\321"
+	.ascii	"w6\204_\302ROz\245?R\333\002\241g\270\207#}\322\377 (\334\321"
+	.ascii	"#%\371J\302\351\233C;;b\331\230\035\376\331\322:\353\360\214"
+	.ascii	"\372\334\321\240{\204EU\217d\227\206\260E\360N/\366\347N\317"
+	.ascii	":\373\334\252\203(\360\221\267\n\005?\304F |\322\032\036\330"
+	.ascii	"\033\275G\021\313\276<\311\311\267\247\b\021%\207;3B\367)\226"
+	.ascii	"\246,\342\202\207|\t\301\341\023\024\022\204\352\213~\211\312"
+	.ascii	"\326\027E\004k\317\224\351)\252\203"
+	.string	"\026\025\350\215(\352\215/\213\337\032\277!\2422<\375B*\341\303@\360\017\227\346\031z\242w\242F)\214\"6%\177\350\231\002\200\352\250q,\245\230S\250dDD\244)H2\034\200\002\021\2422n\003\021\220\275C6\222$\2054\006!\243\324\275\327,T\354$\347\257\321#\355@\267\224-_\204x\2240V\311B\310P\003\034\357R\235\216\301(7V\237*\2713-\262\214\f\222{\3445\367\2262\026\314c\221\037\2567N\"\371w\030Ip4j_\303\364\376d\347V\336C\377@'\3174)\fE\266n\262&\261\245c\223\257\263\002\246\364\377W\365\204\035\006\354C\203\312;}\177a\242v\364\225\2052\311\363S\202\361C\373\t\334\200\301o\311\370\024G\305\301*\243W\023\251\272\243\361\237g\275\255\356\243A]\327.\026\205C#\253\013?\342\377\327.\251w\354\bo\363\020\232?riN\254B\325"
+	.string	"$qm<\2666\373\0263}\3110\032\"'=\260\302\335\r\267\037%]\3038\0179O\321?\007-)\252"
+	.ascii	"\032\363\024\353\313*\204h\013\374\322B\214\017\253\317\204\242"
+	.ascii	",\233\356\022\302s8'\037U9RD\226\317N\366f\327\177\207"
+	.ascii	"\353\362\210-f.\030\305L\331\246\235L\315\344\366\320[\232:\220"
+	.ascii	"\032\001\034F\214\310v5\300\215AS\202c\034\322\332ES\257\244"
+	.ascii	"\200\357\003\217\372\213N\327\026\201O\333\013\242\020o\277\026"
+	.ascii	"\357K\016s\273\302m$\367\3448\276\322 \342\0229C\022]Z\234\005"
+	.ascii	"\263\244\036t\256yy$,8\275G1\bgLZ\236j\t\037S\340{m\363&\352"
+	.ascii	"\t\222&2\001\322\3013\312\263,\317\375KF\030\005\002EV@X\340"
+	.ascii	"C\2534\007\203jY\\sh\034#v\313i\232\036@\306\205\210T]\334\336"
+	.ascii	"H/w\323\210N\355\034\370\242E\323\324#\277\354=\356\325\357\215"
+	.ascii	"\264!\2467\032\377\001"
+	.text
+	.section	.gnu.lto_printAux.217.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`?\ne5"
+	.ascii	"\212^\270\024@@\246N\007\314\341\347\201I\216f\203\205/(\021"
+	.ascii	"Cy\223\021(\n\024\203~\255&\267\004k\350\206\257\013\275\305"
+	.ascii	"\017\260\201s\336\350^\347\267\"\362\367\025+?\241\207\376\b"
+	.ascii	"\202\365\246%m\357\224R\n9\001\032\001D\001\235\307E4hMS\250"
+	.ascii	"^_3eRJ\351%"
+	.string	"2\224\203\276!c\311\234\251\367\210\364\266\025\247Z\004\357\004\305\330\376\302\215\307\305^\271\301t\230d\213\271\321\267\355\266\017)un\200\356\225^\365\3123\330^\245\324.2{\001\023D\304;sG\233K\262\245hO\307\273\234\272I\2206\223\260W\266\225\204\275\262;s\004\255d\337\351\340\2777.\252w\257\264\001[\261\275r\222\331\317\023\217\253\234P'\244\tF\360\336\233\365Ox\251Uis\222'\373\230dD:*\266Dv(\\\325\367$\367\264\251\234}\246\201d\330\224}T\237\207 \\\373\255\315\251\027\0205\3554\236\232'9iK\322\306\270F\212\313C\342GL\332\336\272\330ip\335\252\005\376\344`i\277\2657\225\nnI\231\336\353)\2725\247\023\247\230\264\2715\333tkn>l\272\220\351\253j\025\307W\244\375\326\216\250Lu\344\370\024\331x\270\252*\271\231\001\354\275\236\362[\203S\261"
+	.ascii	"\255\274u^;\020\266\245\177\343\365*\007\305\273\033d\322\226"
+	.ascii	"\244}\230\341\336\313\376\203\255\255\031@3w\007f~2\023A\004"
+	.ascii	"\314+j\316&\n\030\247\372OF\023Jx\002B\002\225\203\376\364,\035"
+	.ascii	"\021\373C\370\b\277\262a^9j\216#\354\367o&\235\2327b\253\357"
+	.ascii	"\357\274\366@\347<\243\026(\206Q\2327\372@\275\350\222\377'\263"
+	.ascii	"T\351OT\272\320\341o\302\314\325d\232-\364]w\205\326k\336\322"
+	.ascii	"j5\315\023\332K\267\204F\323\034\241\245\335\020\334\031\253"
+	.ascii	"\3154_\265\230f+wf\340\316\013\334\271\252uV\340\316\tZg\004"
+	.ascii	"\356|\300\235\251\334y\252u\226r\347(w6\340\316\005Zg\002Eg("
+	.ascii	"\326y\200;\013p\347\247\326\331\311\235\233Zg&w^rg%w\016\320"
+	.ascii	":\003p\347\243;'\271\263\261uF*:\037\025\235\213E\347\266u&\266"
+	.ascii	"\316,\321yHt\026\262\316+\353\254\016\235}\350\334\030\240\372"
+	.ascii	"L\377\276\324\r\371@\351%\322H\321\245\263\252\241\322z\335j"
+	.ascii	"\272\311t\233\351F\323-\246\205\314z\334iz\217\213j\320\216\327"
+	.ascii	"\357v\233`\035\022@K\343\324\356\315\235\340\030\3562}&\257\344"
+	.ascii	"\n/\300\351\237@\264\340\236\344Z\b\247\247\341t3\030e\372\246"
+	.ascii	"&\243\021m\250\213\351w8\371\240\321\264@\255\364K\r\250\003"
+	.ascii	"\274\022\200\017@\242\t\r\002\3007\030\035.\223\376\370\255\234"
+	.ascii	"\335\037f\234\200f6B\343'\375/b\322!\275\361\273\371\247Kk\316"
+	.ascii	"O\003\244\3575\316>(\037\025G\277\303\331\327Y\272\370\031,\376"
+	.ascii	"\263\375';{\325Ka\nM\031b5\326\0039\023n\375\252\354\2632\325"
+	.ascii	"\343\344\3533\2338\341\375c\353U\251\0377t\226\257d\254\327z"
+	.ascii	"\343\037\364P\223Q\032\361\237\255\367\327\206\216\375&\305o"
+	.ascii	"\277\235\340QQ\374\t(\032PE\373,\234l\240\217\204E\311\223\341"
+	.ascii	"?\231\370\354\267\223\251\235..<\177\024\346\210\317\225gE\327"
+	.ascii	"\351\212\232\343\026M\007\331\253\023\236{/\3739\234k\006\243"
+	.ascii	"Uvs\256\360\237<|\341o\220cd\370D\275\016\323q\232\257j\213\037"
+	.ascii	"$\337b\360Q\370Pk\334\364\322\230P\223"
+	.string	"\310\237u}\365W\266\276(\323<KG\004\307\310\372[P\230\275\332\315\027{\357\222\002w\233\344[\f\366\336\333RzU\277\327\234y\320\250\277\204\237\360\275\327(\246\320?\001|\226@\n\307\031\262\311\013\031\326z!\303\236C\331\f\344Y\215/$\034c.\036\254G\230\3158C\302\370z\021U\006\366Bll\203\330\030\230\031\322\006\230\231\227\206\257\027caO2\312\220#h\204\235\275`\331\313\001\330\f\257\254//$\f\262/31\260,10dX\226\027YY\226\003(\036\243\361E\226e66F\226U\224\336\2366\033&Q\225A@i\257v\374'\023\355\214\\\277\3329/\265\240i\253\367\336\233tCh\365\\\337x]\342\017\232\347F\250\217\372\003\237\340\253\026<\203gNnap\365\013\024|\225\003\351\241\340S8\357 \370\004\356\243\013\301\247p\002B\251\376\300\324SI\375\024\to2\245"
+	.string	"\007\r|\324\017\345\356\362\n\274\201\377>\002_\300\227]Ux\\\r\301\034\201\3578g\240+U@\251o\234\201\203\321\264\245\234 nH\377\344\336k\"\237\272\270f^\253\365fu\316f\336s\227\t\257\036\210\236\266\360\337E\216\334"
+	.string	"\013\217\246d\371\312E_\003\256\352\364)\212\333\022\225;\222\362\243?\376\3227\375\323[=w\"\r\303%|wqw\3672\373\307\006\226\331D\252z\305z\001\317\334\341\203\367\017V/\\\200\271\250\201 '\021b\n\311\210\210\004IA\232t\240\002\221\261\252y\021\020\261d\216\315H\222B\226\003\276\2670\344\033\344#W\026\2644\250.\322\232\016@H\335\033\215Yb\373\227\001b\212\230\235\206\327E\351\306C[\f\365\005R\367 \201\355\201\206\364^\357\200\"\332`\0238."
+	.string	"MX\363Y\276}\324\b\024Q\226\246(R\255I\332\252(<Xs\2731\243 1\270C\343\315\336\245\207L\343x\274@:\267\234\321\241\276@\244\006\311\365\006\351\246n\306\333\037\027\027/\177M\034\r4\367\252?\241\335\350'>(\273X\032\247\263\350\247\363\334\242\021%5\361\213\360\232\210}\344=\352=^q\246a\326\336\016\017`\252<\350\002k\224\021\024LTmb\266\352\257\3312\317Fa\210\347{\b\311\206Y\231\001$AZ\300\326\225\022T?\026\301\234\256\310\265\346-\345M\376\372{|i W(\273z\366\004\254ko\272v\251p)n\360\346?\354<Z\031\025\024S\251\371\264\274zCH\244!}\250\276\272U]\316'\033\254b\266\220k.[\306\375\266!]\213\327\250\243\222\322\313\016\022"
+	.string	"\321\303\236\325R\017\f\030\206\"c\017\271\201\245\231f\343\336\330\253\216"
+	.string	"T$\177\335t@\363\324"
+	.ascii	"\314\004\313\213^\031\027Ll{\361\020\362\221RS\246IDa\177\272"
+	.ascii	"T\006\314\017C:\025"
+	.text
+	.section	.gnu.lto_cliAux.218.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`\f\001\235\r"
+	.string	"\266\031^E\360\2606\035\270\377\033~\272m\312r1\345O\243\022R\005\241\232 *\212E\313Q4K\343\371N\375\377/\342\372\214\342\334&\217Y$\232_d\363fLes\303m\026\237l\301\300\217\233\365Q\373m\357\275S\nI"
+	.string	"H"
+	.string	"K"
+	.ascii	"\235\027\250N\315\3311\f\234\254h\201\n\030\036^j\354n\225'\316"
+	.ascii	"\235N\0319\377-\347\350>\321i\007\345\263\343C\271\234\037)\027"
+	.ascii	"3\002"
+	.string	"|\245\351\341\245\350\336\362\370\341#\305\310i\260\273\216\335\027\342\256n\033\202\355\007\366\257%lR%)\262AR\224&\354\3130\fCK\223}\226\237\312\350sB#<\020\337Wh\354z\241\215\235\241/N\336p\320\nH\324x\356\261\375h_\345+\334Y8|\300\256i\005j\027L\340\217\316\251\301{T\247\001\267\252\273<\346\2225)\273\243ww\261A\336b\002\307\3113\321\250\354.\203\227\303`>\212SW\310\250\237U\247 \267\265\013\361\235\037#Cf\246\303SnR(i\r\325\245\004\0264\245x\343*Ric\310\020\337]\002\200\271\021\246\360\t]#Z\026bm\325\"9p\201\260\222\221\314\342\330\372`%V\275,\021\222\3552\001a\025\204\211d\325\332B\365\203\300\232\205k\253&\232\266U\0178\372\\i\262\003\021(\233\324H\222\346\356.%\020!$\276\363\2142'\336i\n\210\016\026"
+	.ascii	"q\224\301\231\320l\024\243\363\202\203+\241\355N\2140\220\245"
+	.ascii	"e\350g\263\351\201W\003^X\367\326\013\353\321\005\313\216E\007"
+	.ascii	"[kVM\217\223\274\363\312\246&\327\270\024\024"
+	.text
+	.section	.gnu.lto_printSerial.219.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`\207\r\2056"
+	.ascii	"\332\\\240\024C@\242N\007\243\307sR\264\305b[\250\373\373+9H"
+	.ascii	"\234\205x\026c\027|\241\310U\325\234J\013\266\203\215\236\001"
+	.ascii	"\302\036\021`\240\025!\020\375\254\217\2354\313\034\362\034h"
+	.ascii	"\004\304\270\t\032\264\311\336[\246\224\0023\001\027\001K\001"
+	.ascii	"\231P\n\267-*\302k\330/K<\320\335\317\277\033\260=K \231\222"
+	.ascii	"S\n\267\031\351\266 \342\341\031\341\372^\373_#\235m\347\363"
+	.ascii	"\276\246\373\305p\370\rv\033Hb3\2100,\225r\266E\270\316*\255"
+	.ascii	"\216\354\306\262\205B\376n\317s+M\227\3120\002\202\317\364l,"
+	.ascii	"\220:Q\353\254\353C\255\263\375\337\255\200A\323\361ft\206a("
+	.ascii	"`\027\030\226Ru\224\353l7\273\345\030\321\200\235W\261`\032\037"
+	.ascii	"\036\030\206\231\331H\273\276J\275\201\276\351A@?Ke\022\351s"
+	.ascii	"t\215-\273\346o\266\3539\223\234\0263\302\300\247\323\203V#\233"
+	.ascii	"\233\335\212\225x\b\347\177\376kO\263\007*\362\026\365\237\345"
+	.ascii	"\334\033\324\225Ksor\236\224{$\220\367\201\373\343\217w\335\211"
+	.ascii	"\233\2177\256Q\3203:\274\215[\334J\304\206\216\212|\246}\273"
+	.ascii	"\016\375\3202\350m\334\240\353\324\340\0238\344\023\355\331\261"
+	.ascii	"\370L\342\334[\020_"
+	.string	"\327(D/v\220O\032+Q\233\0225\317\342\317\366<\373\354\177\316\322m\351\202W\235{\213\372\033)\3000\334\257\366|\363\026\362n\017\321\335\316\356\244\221s\342\350\304.&\006\374\321\346:-\216\225\227wl\022\335<\023;S?v\205\302y\316\235\207\217\347\332\232\353\232\254\375\034\246\027\347\354\363\264\320{\3566\201\342]\355s\226\220\263\354\354n.\357\322\345{Q!.\370J\230\302\360\031\326\n\347\342\345\302\360Y\203-\3157\026WQ$\316\266\313\310\236\305\327&\316A*\264J^\331/f?\266\252\227\234\353\272\245\316\307JDc\322\231Hw\226\343\271Cx\340X\334\261\\\352\336\340\277\255<\320;\201\373y3\377\273\352\277\251\332\357\251\377\2262~G\035\277\021\374\367\001\367\033\352\370\375\364\337N\356w\323\361\333\300\1773\271\337K\307o\245\377.\340~\023\370\357\244\377F2~\037\035\277\007\374\267"
+	.string	"\367\333\350\370]\364\337\001\334o\242\3437\200\377\036r\277\205\216\337A\377\r\344~\377\270\337K\367[\351~'\335o\244\373\355\343~\037\335o\327\3756\032\277[\3437\333~\257\355wf\277\277\375v\tIZ\314\334\354\305d\002\331\331\020r\322QF\312F:.wH<\335V\203\271\367j\310\323Qv2q\2121\207\017\002\035`\224\005\204\3708 pF\212U\020\357\243G\021Q\016\360\341w\350\310A\024\227\370\247\033"
+	.ascii	"\241<\344\341\331p\334\020\322s\342\3250`\365\327x\033\031V\r"
+	.ascii	"\033ZW\333\320:\033\224\223\354\276\374d\240\354i{\312~\021M"
+	.ascii	"k\002\2157k\372g\314\237\354\212q{b\253\374 /\335p\361K\333\003"
+	.ascii	"\247\314u\336\246\244M2\023Yfe\207/\323\362\303\350;_7\234>\034"
+	.ascii	"]f?\264\353\340{\364(*\253\271\025\237Rd2#\363h\371a\365u9x\324"
+	.ascii	"$\263\037zp;u\350 \355\304o\210#\216\217O>\316ID\364\371\340"
+	.ascii	"r\f\251\307\252\333\204zwt\2631\216\226S\247\205\257\023F\247"
+	.ascii	"g\246nvja\b\037\324\202\363\306X'6\032\263\204\352\346\272n3"
+	.ascii	"\233\275H\233-\037\214\262y\375\315t\315\230h\233}\320\216\204"
+	.ascii	"\247\331\272B\363V\235ib\263w\211\243S\315+\373\305\376\003<"
+	.ascii	"Rh\3149\263O\302;\275\302\263\317c\246\313\r\247e^\247F\311\260"
+	.ascii	"\261p4kv\303\3021]\021\246b^\007\3210S\323\234=\375\225\302I"
+	.ascii	")I\354\213\213\f\306\253\364\362\261/2.\025\357\205\241\025^"
+	.ascii	"*\\\200Y\370\342\362\n"
+	.string	"{\305\222,\304\270:\274hA\226\302\355\256*\257\257.\346\333\305\245\"\354\035s\341\305t\341\305\325\202\331\025&\306\254:j\260\027o\030s\f\f,\214\211\224\302\256\347\256\337\023\270\212X\226\315\202r]\037\217\374dev\312\367\232\317Ya\030\206\201\334c\264\314\234\225u\304\031\232\021\366A\315~\361\301\374\344\272vj<M\023T>\310cq\2324A\326\277x\002\245l ?e\004Y*OQ\345\252\334\335\214\253\022d*\256\017\354\002\374\233\212\363\242\262Tn\351\004\027\373\266\246\370^\250=\244\250\354N\344\366\252J\036\313\025\004\271\b*\037\260\222W\005*\206\362T\246<\345\242\246\354$\345.J\023_s\312Cyb \027-e\246&L\226,Q\370$H\224r\021\201\\\340\210\026\203\351\333\275W\321\217:M\td\037#\327\367\267\314u\375I)w\"\261a\232 r\312\255\362Z7\323\007e"
+	.string	"\271(\017\310Hy\315\375E\232U\214C\006\337@\361`\030\315\325\232V\\\264\024P\316Z\345\244\334]\301\302\273Z\257p\\\200\370\250a@e\021C2\"\"\022$)H\222\0160\003\021\321\2509\021\260,\206\230bh\256$u\036{\250'g\364f\330\224\036\230>\\\003\330*g1q\253Y\"\310T\212\256\327\3622\013F-\237t\350M\206D!\245\3735\255\311\213\376$\207\t'\005\020:\f\213G\027\325\263:\256\251%W\007\005a\375\367\ff\033x\225<\003\340\350\262\347\020\333\300\243\344\031"
+	.string	"8r<Z\210\341t\300\231\3645\002u\320\257\221\3028\350\001\367L\336v\360v\320\204w\311\201\250%\331*\321\371\326\240{\205\312MA\302_a\032\300\244h\203\004\243\017\bo\215\0258\026Z\021}\003\270\204l\200"
+	.string	"\020V\247\027\312\316\376\221\250\202d\""
+	.ascii	"r\220\353\375\352\036\300M\254&-0V\362\241Hp\345\223\216\362"
+	.ascii	"h\325\350\005\t\3535\343p\202g\b\340\214\n\fi\214\324y\222\254"
+	.ascii	"\024\357\230\200m\274J\221\200n_E&\331$D{\356*\220p\346\342\016"
+	.ascii	"\233-\34571\001\207\013\n-ad\305y\334a\234]I\220\271T2\253\032"
+	.ascii	"\303K3\233D\310+'\270\220\370k\024\n\351\303h\365P(vt\270,_\016"
+	.ascii	"\255\314C`\005=\202\264C\370\203\336\334\232\316\0058\b\366\300"
+	.ascii	"\026\b#k!9\230\r'(\363\2535PF\271\333\030\345\20322\334j!d8,"
+	.ascii	"\273\332\335\200%\247\370\261d\236+g\300\266#|1\335\023\374\335"
+	.ascii	"P\317wG\311'\367Z\\'\303\016\371\270P\262i\245\226\346\222\346"
+	.ascii	"1P\237\021\037V0*"
+	.text
+	.section	.gnu.lto_cliSerial.220.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`j\013\365<"
+	.ascii	"\032il\027B@bR\007\207\310+HVP\356\t\\\376\024\231}\233B\354"
+	.ascii	"\367\321\327<\250\353\317as\366(\005b+MZ\341\322"
+	.string	"\016\264\013\003\320J\320.\326\357\031\3532\234\261{\377\377\363\316\252\221\255\355\275\223L)l\001Q\001a\001>\364\316\305hce\353\300\340A\323\343\300<\213e\031y\254L&p\231\241\314|\331\251kV'\1779_!\020\257\256\245\351[\272\314S\3305S_5\2749\267)w\233\001\321\335\247\326q\267\273\371[\323\261\320p\241\234\327\336\352r\276\"h\003Dw\373\352E\257\273D\037z\335\355f\267\037\322\215\354t`\r\002\355\"\230s\246\372#\335z{\365V\302MwjbZ\002\240\224\204tdTD4\264\024R\006%\221@Gc\2218|\335\366q\263\335Hu\272S\323\260\212,\2133\275-Yr\276\351\233\033\006\320\002\361M\255m\003\2732\254d\204\354\212'!\r9*3r\322\004\027\355 z\223\016-a\303\3137\034B\177\224I\242L\221\340 /\353 `\032\231\025O\016\253\326\254v"
+	.string	"\323\310\332\034\331\032\370\263\333\343|\323\263\266h\254I\324\357\3140\220\022\264W\231s\366\264\351\220W9e\322\036\205\030[\nw?\306\374\316\003\360M\203\264\230M\016\240\333y\200(S+.\342+N\f\220F\006\304\207\3167\005\002\305\357\017w\333\2412\2727I\252X{\340\215\224 G\352\r\334bY\317"
+	.ascii	"\323\310\260\370\267\006\316\362z$\251am\021\0335:\216u,\245"
+	.ascii	">1\036V\345\234\033G\251d\336O\336\2157t\267\216\356\"4\205y"
+	.ascii	"kJ\206\2701^\001\377\316:v\234\360\323w_\300\200=*\340q\234="
+	.ascii	"z\262K\0328`\217>\375\323\002_z\247\037\366\341\211\021\233\362"
+	.ascii	"\304\205\235\204\201\274\361\336)\3670\216\215\221D\022\355\366"
+	.ascii	"\360\001\313Q\231\362\371\363\347\234\354_k\204\333C\274.\306"
+	.ascii	"\361H\340\";\302\247\237[\3166\322\270\032\021\355K\334\355\021"
+	.ascii	"$\334v\022\257\273\007\274\273\204\t\354\321\366\271=\326\254"
+	.ascii	"X\303\351\201\026\371\257\266\213\327\377\004\334\2340<\330A"
+	.ascii	"x"
+	.string	"\351\273\257\262\260G\375\035\353\031\244\\\005\377\302\336\331}}\342\257v\273\313\355\305\241\366\257u/P\340d\274\247\244\242\n\020\200\3629o\001\276\305\373\311\311\210\273\311\261\270/\021-\205\224A\316\305;\211\004\302}\004\302m\004\302]\3648ob\021\367\360\210\3735\342v\213\270[\257\363~\"n<\304\355\021\232\362\236}\\\254B\036\3165\217\025\372\311Yw\214\023'\343^\347\276\305\235\213{\234\373\234;\235\017\273\275\333\307\264\337\365\221\f\330\232uO\205\207i\267\353c\335\020.O\020\305\013\017\323O\245\223\347\314-\347|\304\016\347]\\\316\2758\266\217_\034L\323\351\276<\223\345b\326\212\344/\347)\211,Pj\216\005;\232b\346\207O\0053l\240\311\257\236\345Os\247&qk\220_\355\243\203\275\305\36748\2750<\b\366N}\361\215\372\364\002\305\316\236w<\206\232\254\023\377\351\275\033G\332"
+	.ascii	"\rv\202\267\261\300vA\354]\346u\367-\207\236F\320\347I&\222\245"
+	.ascii	"\360t\267\0371g\247\237\271\023\311\326:Or\316R\356.\337\347"
+	.ascii	"\002\323do`B\354\307\007\332\364\370\325\036~\373L\246\0036\253"
+	.ascii	"\304\234\303$\264\333\361\277\346\221\266\231\244\311\3666\331"
+	.ascii	"^w\207_\034\323\364/\0078=9/\364\025\257\373M\337\030\n\304\375"
+	.ascii	"\251\307X(\241\024n\2354\241`\217\272\377$\365\355/\325\326\024"
+	.ascii	"FIY\243X<\202\306\257\272\361\250\177-~p\340\344\bE\275\337\271"
+	.ascii	"\220` \224/\243{\003\245\370\325\306v\356c\3206\302\341\224\377"
+	.ascii	"K\361\013\345:\344\332v\f\241>\371\322n_\344\343a\201'zi;\321"
+	.ascii	"\3418\362\013|\262/\017\216\330\031\226\342\330&\025\217\336"
+	.ascii	"!\360\370\227jy{P\302%\fE\340]0\320G6\354\235\303\2576\223\\"
+	.ascii	"\025=\327\035"
+	.string	"\354M\312Q\321k\333\301^\344Kg\274P\377N\277#P\330\251\255i\305\036\205zG\023H\315\206\275\3157\3076\263\024\305\3119C\250a\246\327\006\304\006\016\255\"\301\226\225\0263\353\005U\327\221\214,,.\rY^V \260\276\254N \265\234\331\325\302\230B\013\005\027\223\371u\205\364\342\372\352\272\340\305\225\305\342+\005\323\002\226\326\226\025\214%\323\253\305oY\301\370,.\255-,\026W\303\276J\240\265uE\225ue\205\202\231\345\305\245E\305\245e\305\202\352\212\371\202*\001\200\356j\221\305\244\362\352\352bR\035\2576xx\225\215\177:\017'\006fb\332\374O\317\rM\323W\233sZ\005\247s\377\333\202\013;\002\366=\2468\002x4}`\217v\324\340\336\031'\233\225\311\001\356n\2265\205`\254\013\315\r\236\311>\337y@\016\225*KJ\312ocQ\371\304\227\342\354\304\001N=lpk\356"
+	.string	"\370j\243A\333\b\223\026\374/_:&g\335\221\024\365ML\276\320K;)\350\273%\022\275\362\245K\002\200~Y\334\275\3159g\245!\345\267\221\362\273E*\335L\216\f!\222\202\357V\251\374\240\227v\037\360\345/x\267s\017py\2058I\371\n>\331'\2470@Unc\245\363\227\257Y\312\235\020/\314\f\311\f\313\031\366\310\b\351`\357\221\360\370GO9r|\334\347\006\321\212\320\352\316\342\210\206\276\332\256\353\314\303\266\307}n\220\307\262H\241\220\262u\260\327\330\307\247\336\370F}{p\362\270\317\005\006\006M\005\200\347\250QH\244\024S\204fDD$I\222t\260\002\221\241*n\021p\265S7%i\215\345\3273\342^\016\001)\001\251\235\317\211\031.p\234}$3`7lT];\306D\230\"\201@\343\372~\337\216\"\020\332\271)"
+	.ascii	"\276\274\262C@B\213-D`%d\203\262\215\216\367Z\213\332\035\234"
+	.ascii	"\337qyd\372\376N\036\242\321\203\255\335\373=\023*\353\237\331"
+	.ascii	"\314w\337\235\302\237s2:-\333]\023O\3408\0351V\345\023\307hJ"
+	.ascii	"n2\357\f\n\237\223K\177\003\377\254\376\344\341}6\027\016]\345"
+	.ascii	" 9_\226\021\351ATSBd\362C\234\274\345b.\225\212\\S\300\221nN"
+	.ascii	"DR\243C\316\036\255t\344L\030Z\343Ujh?T\200\017U\032CAk\220\""
+	.ascii	",\311\326\246Qi\021x\031\330\360\330\343q\223h7\370\016\006\023"
+	.ascii	"?\204\254\244\332\337\276\227\005kX\277\330\340>\026\036X2b\241"
+	.ascii	"r\332\247N^\004!\320\1775-\037c\003Wg$\351\250\306\307C\007C"
+	.ascii	"\204\036\363Z\321\\\263\362h\321\346\34345\370\371^\023\212K"
+	.ascii	"\304\251c*2T\344XY\366\256d(\260e!:i\323\224\004HY\020\021\f"
+	.ascii	"\343\362{*\217e\fK\346$\260\314\224\334\3345\013\241\037.\304"
+	.ascii	"\316\305\n\347\352\213h]\357\034xS\001\"t-\024\271y\361w\002"
+	.ascii	"&\333\320\377\366!\364\233\333D\251\372\215(\334\377\340?J\""
+	.ascii	"\256\361u\024\026\220\371\231N{\206m\017\027\310\342\357\022"
+	.ascii	"\016\350X\374\263\002\330\303)Q\021J\306\236\004'\312jY\026\306"
+	.ascii	"h\363h{/;[]h\222*\276\277\336\242\214\346A\204\032"
+	.text
+	.section	.gnu.lto_cliSerialPassthrough.221.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`\322\r\235K"
+	.string	"\272\201 \035R@PJ\352\376\276\251W-\373\273\177T\231G\370\326\316\326\332\365\221\300\275\306\336\355J\200i\b\221\362\201r\031*\242\214x\262\276\302\013\363\237\004\021\346\021\271\3459\224wb\037 Y\342\030\261\357\255ER\353\246\253k6\273\353I\221\351&{\357$S\n\307\001\243\001\263\001f&<We\2771'5\213\313yj\344>q\"\212\272\321\2004\212\221\234\321\210n\231\323\263\213T\312\00608\223\327\233\364\332Pj\232\251\332!]\346\362\005\256\263\303\325q\332%M5\331-;\325\226\364.\316\305\324\306\232yLs\325/\312K\034\330\\\316S g\033E\267\343n\007s\351\353aNn\2233\326\fh9O\007h\001\\g{\352\301\326Y\327qZg\373\355\206\363\240\314I\025\322$L&s9\347\241G\241y\325j\265\352\353\324\033\210_\367\031\212\020\366\360\204"
+	.ascii	"\361\301\303\216N"
+	.string	"0\007\347\306\246\006\370\363\321\364fd\\^\313\256\217\337v\036Q\322}\206>WUN\\\004\217\250J\352B\207\022\363\036i\030\346\001\363\020\353\260\215\312\024\201eE\347]\317$\030\004\030\022\374\241(\006\375rU%\346\036\350\250;\253\212#7\242\270\333\363\205\265\347$\214W\021\254\303\345A\267'\327:\3149{\327S\005\234\363sh`_8k\n\345\334\017w{n\2554b\230Y\274\353\231\002\276YG\374\020\002\305\335\236_k\017\226*-\330\270=\211t=\265p\315\312S:\271\334\355\231\265\266\020\023\247\246\304\300\023\252\254\374\347\203\322\374Hs\237\256'\020\334\343\021U\231\3403&\310\2548=\314\264\270\333\263\307\032\244\305\313\207w=}`\267\200\267\025x<\2424w1$\2077\250\267~\365\344\301\234\241Z\2665>WO\350\312\036I\331\276\\UY\371\332\016\301a\016\214\356\252\252\314\177\025"
+	.string	"Z\203\216\037\225\324\032\2742\244\213\2479\236\242\212\302\230G\224sn\334\244\252\362\036\341\335\370\203n\377\351\356\225\b\275\217\272\211\366\346Q|o\f\316\nSG\024\256voY\363ba\346\243[|}\314\305\305i}\007\022D\371I\357i\322G\2240\366D\346\243\355N\355\277_\361hq\300}\300]6\225p\026\202\b\2607\177\215\252\264\022\203\213_\305\3435\346\030(\\\305\217\251ubT\334\313\352\244\274\035\234\363\335\024X\200\275\271\3421Z\335\027\325\333\334\306\021j\022\337\365\0270W\260\332\217R\333\257`\357\265\326\331\033\252\364"
+	.string	"U\214\344 5tP\303\2719'\035\032$K\333\214\344\234O8\r\335\r\347\016u\263\3623O\363\tg\203OC\326\026\204.N\211\307<\331\024\345\223\315\301\256\346P2\310yk\272\232O\321\340\347-\347\24577p\227\036\224p\226\003\"\366\246\317\343\262: \324e\213,1p\353\017w\033c`o\266\227\211\271\243F\365$i@\362M\243\365\1771\306E\n\213\351\036\356\371\356\016f`o\372OA\233\213\223\372d\3674\211?\272\246\265\226\325\217\325\335\202\305\n\025)P"
+	.string	"\375\370\324\233\204\217\320\303\334{|\211\267\2167\361\016z\231w\016\316\215\215\233y\327"
+	.string	"\177>G\363\246y\334=\027\367\214K\361\226\341\341v\0377\317q\267\216\233u\334\253\343\376\0267fq;\001o\t\316\021\250\034\207-9;\253v\231\312\252\025\361\251\373\022\367&\356e\356O\334\315\334\245\270\243\271\333\355\256\304\307\234\314\2358\024\217\342g\236\326=\264^\313\"}\022\227sV\222Rc\315e\nH\241\030A\ndrF\350\342\330&\027\263\035\231,1\034\314\263\340\273\211\266\327\034\341\343\374\024N:\320\3638\265(\221\303\202\002\267\277@Z\234\227\371!o\177\255\332\366WH;\344\215bo\002=\001N,v\331\307'u>\372[z\t\023|,:\027\376+\261\363\032\343\301a\305KN\007aW\303R/\221\236\254\024\334\245\347xUx\213\274\215\311\301{\3325q\346\\\346y\234nI9,"
+	.ascii	"@\333\350n\232Z\336\373\230\025pnrs\316,\332\253\357\221\327"
+	.ascii	"\313\335r\226\347\002\2210(\\-q\344\352\315\006x\363\302\237"
+	.ascii	"j \360e\200\276\377\371\251\266\321\222\370O\206\251\216\335"
+	.ascii	"\360\203\177\276\373u\341\375\302\336$\361\354\\\335\335\b\374"
+	.ascii	"\363\256\346v\257\024\370\212\271K\017\241\004\002\t`o6&\263"
+	.ascii	"2\245\213S\306\325|\264\231\244s\314\263\037\213/J\317\230g+"
+	.ascii	"\220\007\177\n\004)\035\363\354\327\302u\220\261\301\255>\237"
+	.ascii	"c\303\326d\355\237\223\311\026\266\266\327h\201?\325\353\217"
+	.ascii	"\346i\310\330\270V!\367\345|\226\363\210\0209,k\3169\003W\232"
+	.ascii	"\232\257\342K\361\315\273\371no\276\331\233\267\001~\257>`\333"
+	.ascii	"\016<\025\337-\360\233\005\376\357\247\232\306\367\355\363}\257"
+	.ascii	"<\337\223\300l\223\322\256\370^Y\337\323\374\024\b\320\255\035"
+	.ascii	"4p\035\240[\355\013\264-\336\347\352\344\250\313Ov\220\007\237"
+	.ascii	"\305\363\306\274\220-\241\316\346\216\357~\330M\2645\237\302"
+	.ascii	"\213\357\243\335>\346\372\242l\177\215\253c\243\322|\264=\315"
+	.ascii	"}\007\223J\330\f\212\357U\346\346k~\212\205\363$\313FU~2-\264"
+	.ascii	"d\304d4\036\0255\025\r\221\306\032\307\244aP\f$\243\"\222X\003"
+	.ascii	"yd\300\347\2704,\376\fg\034\2210\206Ec\f$\242\214\242\241\260"
+	.ascii	"\205\232\212D#\362\210\370\353\031\237P\361gX\3000\310\210dL"
+	.ascii	":\016\215/\206KG\244a\361\210\306\261(\330B\303&"
+	.string	"\030FE\306$\245aP\321\250t<*\322\351a\361g(\323\030T\360\315\264\364\215\301\004\337L\310\357!.\032\341\"\r\342\213\325X<\316X\221KIF\017\210J\274\016\216K\317d,\"\031\261@c\f\242\222\005K\310\243\0042b\3208\"eT\240\244DL\3121\"\031\035\025g\024\361\272H\310\350\250h\310XD\204\2014.!\031\r!\031\021g\f\025!\225\206\204B\3641\311\210\034Z:\036\221C\275i\326r\"\250\217r-\237\217\366S\201\261\203J\375\004\020%\317a\026\261,\346Y\017\357\275\213\230\223y\346\001\350u\234\326\234\257\016\210[\202\253\355\002c,o\177\222ku\276\367\335O`\236\302\f\231\237\354\306B\360US\373V?\321=\325ao:\333\376T\327:\333\373\031+\033\276x@\341\252\325\323]\360\251\352.\261\224\211*U\020\016\035=D|\364\307k%\314\362.\253*/\350"
+	.string	"\205\253?\252\033\022\341G{0\323g\036\231\304>^\253\231g\262\242B\307c"
+	.string	"\026>O\3712\255P\225\302ww\274!\354L\271K\267\241\215\272\314\361\225\026\342\243-|\367]k\214\013\016\254\343ub\250\244\227\312\375"
+	.ascii	"f\2308\223\200\370\350\235\327X\325\233c\207\004w\3512L\t6\241"
+	.ascii	"a>\214\3002\357j\330\371\356\b\276M\307Hw\240\300\\y\020\341"
+	.ascii	"\335\321\303]\272\326/\201\016\250q \003\225c\210\220\214\210"
+	.ascii	"\310\314$I\007!\005\304(H%\274\r\021P\271t\212\246I\2469\024"
+	.ascii	"\300\217\372\377\200\225`\244&\332v\036\024\216i\236]U\003\357"
+	.ascii	"*\253\0015\215\316\033f$\026\205^\233\325\321ywZ)M]\352I\367"
+	.ascii	"\363\240\267\001\006\327H\020TS\244=\222\267\317E\205\300\234"
+	.ascii	"fvB\177\221\0202E\237!\027h\366\360\306\205\352qQ\b\031U-G"
+	.string	"}\243\211\307\362"
+	.string	"\020"
+	.string	"8\375;\372J\245\303mW\003\271\227\273\314\206]\201T\017\022\356\233A\346\210&8\252\036\3658\f\360PQ\371\3432\364\267\373\022M\251wi\251{F\277\231\246\r`\234\257{7\336\334\036\251H\253R\262\023\035i\277\201\323\3524\002/\005B\320S\202\013\303\233\207o\370q\373\245l\034\371\002\346\201U4\026\271\254\237\244\363\232\003\335\324\235\017\232\003K\251\215\"\001Az}\324X\220d\357\005y\351UZ\337\233\375\371\321\020\t\340,\271\266\264\253\316\370\030p\257\013\324\243\313\347\365\2605\016\023%\nn\023}\361\fPqB3\254\027\007\353[yp\232_K\375\270\006\352^K\025\321CB@}w\217\334\237Z\033\307\026\006\007\022S\302\351\037\333\306"
+	.string	"\002\277\215\032\207<\315\230\234\254qJ\314`L*\263|\332[\213P\362&\363\303\232\307\371p\tRD9\033{"
+	.ascii	"\232\373\253\340S\304\304\371\245\037A\021\277\247\343G\235\305"
+	.ascii	"\315\007a\2776\277\247\313\210\315\302\001y\262\222\237\\\215"
+	.ascii	"\374\256\021\026\3658\210p\025Y\024\031c\211<a\"\342\312[\323"
+	.ascii	"0\002\301K\257\222l\274\371O\0041\202\250l\325R\346rv\356C\f"
+	.ascii	"H`\232\220?P\263\2110t*\317\003y\t\322\260\372!\354f\242`\r\232"
+	.ascii	"u\037\266\325\302\317\347\252W\030\243:_Kx\037\177\001\362R\320"
+	.ascii	"\355\326*{\221y\024\234\222?\234\222\2373\314\022\021X\203A\253"
+	.ascii	"\200-\323\004\301\242\334\026\217\005\322\020k\033\343\002R\263"
+	.ascii	"\320\222\017\302F5nB>5"
+	.text
+	.section	.gnu.lto_printAdjustmentRange.222.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`x\nM2"
+	.string	"\272X8\023D`\234N\007\301\207\007\235\240\252\304\305Yh_\303\003\304;}\355\203\036@\025\356@w>\003\310\207Bh!\021\027;\3421\177\370\200\"\017\357\340\2467\003\257\226\211\325\252Z3\323u;*\322\222\354\235RJ\001#\001\373"
+	.string	"0\001~\335\177\335}\25527\341\006\344\"\024\350)\025\fS\302\275\244\231p\361\317L\2751\234w\356\347)\245\3625\364+[Bs^8k'\335\242\027\307\303\260\215p'\341b\257\334G\032\311Y\367\231\350;w{\305\016>+\202\367:\247ze\016\303^\227\324.2\027\2113\341\235\271\367\232\357\254\235fD>w\355I\227\345\354 a\257\303\006\022\366\312\356\314X\b\316Z\017\005\377\275uV"
+	.ascii	"\357uV\261\324\260W>cNC\304v\321\016\3605i;\022\347\336{\374"
+	.ascii	"\034\334\323\252\263\331\350g\315c\334)\352\020\207V\270\252"
+	.ascii	"\357g\3346\302\263\233\232\177O"
+	.string	"1~rh\315\243\252]\342\352T-57\342\230\243\353\235\033s5\272\310tc\216F\353\320p\242\f\037\376\210\213\341\266\315\205E\271\245\257\252T]\340\213\356\0227C\r\342bw\246\001\331\\U\201d\374\205\351.q5T\2520@f4\223\3667\2715\377N\322\253\235\024P/zc\216\256\335F\270\367\262\273\311\3155\3674sC13\ff\"\217}\341)\205\263\f\242\346\200\367\256\251\217\307fB\006\177\004\007\307\006\033/e\326\\\016\373+\370\005\257FY\006\0216_\021\366\373\367\362\207\232O\371\352\373\233I\257\202L4O1}\203i>\375-\367\242\375\3431;\321\\i:\035\344\277c\206\320z\335Z\016\032\332\334\240\213t3\350\277\346\005\355\354V\340\316Y\355\327\214\325}\315W\356l\300\235\217\356le\235\253\334\231\312:O\271\263\224;\027p\347(\353\f\345\316O\356\354\344\316\004\254\363"
+	.string	"wn\262\316L\356\274d\235\225\3349\311\235\221\254\363\221;\033\271\263"
+	.string	"w.rg\"\353<\344\316B\356\034\344\316\001\2543\220;\377Xg"
+	.string	"\356\354c\235{\2543\217u6Z\347\035\353\\\264\316:\326\231h\235\207\326\331Zg\241u^\255\263j\235_\350\354B\347\216\020\365\367\364b\204\017\372b\234\027n:\347nY\235\364hhw\317=\305`m\fn\251\323\273w\331n\031\206K3\250^\263>\351\2315l\360vc\365\322=\032k}\322\321#\3159z2&\034\365\215\340t\321\013\3507M\364ECO$':4\307\256\005\275\320\262\256\2509\2120\300\007\375cY\376"
+	.string	"\372"
+	.string	"\337m\203n\224Vm\240\200\276\2050\245y"
+	.ascii	"\376g\r\200'cJ\243=\357\363\326nPM\333\240`\317\2231\007\363"
+	.ascii	"\262\336\301\363x\221N\333\006\323\330\212\217\327\320!}ht\376"
+	.ascii	"\216\347\215ix>A\207>c|\016\3147y\337\317 M\342\316\027\313\354"
+	.ascii	"\374\003\035\037zLQ\335\303\002\035>\036\353<\361\033G\030\235"
+	.ascii	"W\200\354/\304\347\300t\223g\234\341C\317\016\337vQjqA0|-\256"
+	.ascii	"\326\222\305F\367\236\314\004\202\021\n\177\375\306\021\250|"
+	.ascii	"p%AS\370\017\222]E\2314\206C4\025\257^\207\232\353\237`\266\311"
+	.ascii	"\333K\3435u\2011V\365\377W\271)\220'\2315\227#\305M\375-2\314"
+	.ascii	"#\032\212rx\357Z\002\356'g"
+	.string	"-\302\206\367\336\336\321\353\177\n\246\232\350\236?\203o\360\r\030\\\346\264$&\242\013\231$\206$\212!}\302\330\027\262\254D\322\350\325\022\310\276\312\220 \222]Cc\311\020`H\013d`I%\331X\231\210.\244\317\2101$\005\022\312\262\256!sYy}q\035\223\\H\020bI20\257#\230\027Ry\344\022\033;Z\031q\030\211\244\330\221,,L\354Xt\336^\372\273g\017\375\\\304E\005\323^m\351\336\313\363xL\024\262\003\341W!\316o=zpo\210\364\275\367\032\037\217\033\260\211g\370\264\264A\213\016\206m\370\002\333\240\317]&\304\3526!\274z\b\337I\332\202\027\351\224e\235\220/}\323?\275\324S\275\325\361\r<s\005\003X\177\254z\253\016\316\242\352\267\232F\242SO5\302\337\246~\253y$\257\300KE}\001\250\217J\372\n\025PG\242{N\377D\340\235\336\245\313\037\003\236"
+	.ascii	"\227/\225NMgC\0323\340\373E\023I\036\3237!]\215\351\267\232H"
+	.ascii	"\242{J\277\364B\273\351\364\203\243\265PR\367\232}\236\266\363"
+	.ascii	"x\354:S\335w|g\332\240D\252\316\3727f!\367"
+	.string	"\371\237\027z\001o\364H\177\025\200\275\250\201,\305\215bfDD\244 )H2\214\001\260\002\221\251\242m\003\021\3204\347\240\232\tf$)\270\006\332'\314\b\203|\034b.\273U\261\033\257\342\030\335]\364\235m\335k\203\225\204/\340&\237[e\305]V\364\375\347#h\366-\026\234\371\367\322\177\366F\221\270a3\334\325\375\250\230\271A\334\307\271e\354q\210\314\247\231\215 \3374#Z\317\003\366=\036\313\350\220\214\2457\"f-\332\264u \033$\241FH\331\253\220\254\331\264\n\367\243\2325\356\232\323\326#\227\002\361\262\314b\002\323\241VL8N\262g\024\214\230\t&\246\365@&K\005\t\363\363\364\261*\037\333\361;o:^\177\217\323\375\n\\B\303xEk\242<\263\367\222\206.]\036\364)\030\313n\244W\302\3131VN\213\214\311\225\001\257g@3\262\220\376\241J\265\223{\234f4\217\341"
+	.string	"\271N\206%\3404\b\212\321S\221\361\3476w!\273\311Z\341\264\331F\001\222\263\223'\r\\\001m\034@I\373\336\252\332c\320\371\232\205\202C\240\326\276/%\r@Vg\262\306 \245\376s\325q@\254\023\230\311\217\247\002\255\320A8\347\306tC\2030m\342\361\367\006\230"
+	.ascii	"8\016\366\005\324\022\303\244\0014i\321D\251\016\241\036\335"
+	.ascii	"\352\006\253p\312\244\343S\267\251\373>F^\243O*\341\3034\372"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_cliAdjustmentRange.223.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`\023\001\325\r"
+	.string	"&\332_E\020q\224\0168"
+	.string	"\f'\222\305\013\310\346\223\365\247\037\005:\226\210\303\234\177L\244[\350\250\274\266|\330\267\372\2375\321\242\330\236\230\0303\022\331\020"
+	.string	"<\024\241HA@4\fQ,\322\254K2\217\215\220\275\367N)J"
+	.string	"J"
+	.string	"L"
+	.ascii	"\257\230\033\300^-\262u\0340\331\021\003\226\022\037X<vW\233"
+	.ascii	").z\245S\212\374\257\376\001\206\243W\f\352\024@\210\372\244"
+	.ascii	" /\226\035\002B\023\325\234V\200"
+	.string	"_]\206\bKRf\016v\327\022\fOn\354\266!\330\216`\277\023\001f\240\326\345e\232#[,\311y\302\376\034\307q\364L\331W\371\353\224~v\024$N#N\016\"\307\356i\354\261\256Z\003\305\034.z\201\352F\346\031\333\227\366S\336Bt\225\016'\260\233\242\321\332\025\025\030\004\363j\361\032,(t\200\3647\354+\217\301M\226j\227t\360+v\310aP\310V\"\\-)\273\333\200\365\027\235\257\342\325\027\274\352{\330k\310\355O\006y\320\227a\302\206\313\303U/\257\326\364\006\354s\202\213\026\223|1&\353\264K4\310\203\237\001\256\260\001\205<\234\027\002\225X\030\341\210l\237\266u\022p\236\216d\304\3332o\233\216d\323\270\215\323\371\270\220\247\323<\035\307\323\266\017\244m\020\370\203\201\373\264\320\347\363i\031\221t\2723\345\007,Z./\322,\321\335\335Z@\202\210<h*q\230\234\002\026"
+	.ascii	"q\224\301\231\320m\024\243\363\202\203+\241\355N\2140\220\245"
+	.ascii	"e\350g\263\351\201W\003^X\367\366\013\353\325\005\313\216E\007"
+	.ascii	"[kVM\217\223\274\363\312\246&\327\270\024\024"
+	.text
+	.section	.gnu.lto_printGate.224.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`w\006U#"
+	.string	"ZB<\016E\220\232\316p"
+	.string	"\300bG\222\224\253V\026\374P\224\277\fp\322q\206(\322\305H\t\231tcsV\307\320\346\351\221\211\353i\333Z$j\026S\2752\201\301\261>\002\325q\221o\213A,\224\252a\273\355\275\245L)\320"
+	.string	"\270"
+	.string	"\324"
+	.string	"[:\230d>\035\260x\322\300\r\267\302\200\265\261`>\212?\346\334I_\312\247\374.\326\342\247\326y\031C\322t\270\235gQ\301IS0O\352\306\347l(UC?\347U\230\020\b\253\366\233\334\311\357\305\252\003\235\247\327\033\203\342\205\312\223\346\203\312\223V\265\0278\370\035\354\205\367<\273\234\240\235g\261\311L\346I\377l4C1N`\2034\032B)m\316\363\334m\020\353|,\336\245\376\216+\311q\365\347\207\375"
+	.string	"\221\rx\334H\226I\023\353\311\022\216\021p\f\371\372\230\225\226:Fn\234\264\361qDZ\373\222\244'+\306x\200\313G\225\233]gd]\351~\354LD3\2536\262\254\033W\234\204\363<\255XYZ\267y\3339l\003\355\362)f'\271\210fambp`h\234\275\262d\215\312\356\320.\002\325I\n\227\022\257\227\335t\260\237i\351gw\202C\371\225^v#x\361O:\331m\340b\267N\325\005TM@\325H\246\372H\325F\246\272H\325D\246zH\325\003L\265"
+	.ascii	"U\013\341\324\001T\035\204S\003P5\220\252\177T\355c\252{T\315"
+	.ascii	"c\252wT\2353\325:\252\3161\325\246\252q8u\251j\022\247\036U\275"
+	.ascii	"\245ZK\365\235\226\330\254\326\242\244\345\330\266\342I#\316"
+	.ascii	"\2333\f\211\245\310\317~\262\277\354\027\373h\337\276\025\037"
+	.ascii	"\315\2713\237\341\226\033\b*~\225\2339WV5\2369\212\247V\317p"
+	.ascii	"+]L\224$Rrq\233\263\271\345Y\237\325\255/&\003\356G\331\230."
+	.ascii	"\260\363\f\036K\203\031,\241t\362g\201\326\336\300A\217\345\361"
+	.ascii	"\344\261@3-\320\322\376\354\205pz\326\307\303\301\364|\355,\317"
+	.ascii	"\207{\331Y\027\304,o:\233\003\361.:_\346\346\2048\027\021\346"
+	.ascii	"\272 jy+\027\307\273Z\371\325d\\rqC\035bB86\324\263\364\314\363"
+	.ascii	"\274z\340\247\375\210\2240\207\234\034\327\005Q\355\255\211\202"
+	.ascii	"\357.\355z\021b\311\351\257<\301\"X\333\004\n=\326\356\246\001"
+	.ascii	"\342$Lp\201\326U\332\004{\264g\030n\261\t\"\261z\03371n\343\016"
+	.ascii	"]U*\355Q\2156\037j\326\314\\\251\033\353&-\202]\263 \222\235"
+	.ascii	"\273K\371\325}\360\210\225\306\261n\277\017\366%\351|#\222t\276"
+	.ascii	"$]Qn\2340"
+	.string	"u\202\347c\321\343\211z\005\252\023>\036\211\336\210\235\251\036\025\257\004ib\212\207a\005\n\337\b\323PNQ'\240v=(\036\t\251\036U\212\250]\212(\036\212\035\224\324\324\316\311\310*V\364\244vT*TH\355r\305\363\353\025v\223\354\253\370\346\006c\255p;t\316\022\262i\311%\352\031\nV\203\355\311]\004~<\317\363,w\350\243=\347LZ\017\341\331\270d\256I\343\022\236\255\357+\r\354\f\373oQ\352\266i?\366'2[j\301.\"\rZ\241\035\260Dk\264H\004\266\300\332\027\n\030X\002G\213\204\346\350\253h\215\316\024\355\023\361\313\333\320\022\231\031\372\022\260\003\312\210\020\260OD0o\001V\210\355H\200}\"\216\001\260A[\016w\250\2159\002 I\313\212Ws\250\201@d\211Ad\204D&\216\3024\351\340\002\031\252\211\033\021`\3013R\246\300\214t\026\305\323\025\004f)\004K"
+	.string	"^\005\006\324k\352\033a\005\251,\206\207\371\004b\r4k\264\210RI\275D\331LE~\023A\2119\020\251\301\324\bE$&\027/12\363)\323\001\"5[\360\250k'\366\324\305\344\361\210\244J\203\244\344\231\r\313\266\310\324["
+	.string	"\204\357\030\306\006\362Q\251s\246\005\304\0174,\323g\264U\311\270\317\231\207\251\364%\277\\\030\232\262\302$b\3365\260\017\331;T\310Z\r\222\031QfT/\316+\354\303B\341t\332D\341i\021\255\267\200J:\377\270\331+&T1E\225\375"
+	.ascii	"\376\334\276\356W\226E\034\356\250\353\"'x\315\333\255\373k9"
+	.ascii	"~"
+	.text
+	.section	.gnu.lto_cliGate.225.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`\026\001\325\r"
+	.string	"\226\331^F\360\222(\035\260\326\335\223l\342o5\243\026\032#\005\\\032\331\362@J2\336\334\215\234\234\204\214\207\222Yk`\226\367\255P6UQ#\210\314\260\003v+\017\225\335\227{M\t\273#\230E\364Y\251md\223\275S\nJ"
+	.string	"H"
+	.string	"L"
+	.string	"\006\262O\1776\217\003\033\266\264\300FL\007\230\036\273K\345\352\373\344\367\211\311\370\371\1779H\005K\237\234\225c"
+	.string	"\300\225KL\344EcF"
+	.ascii	"\210"
+	.string	"\302BR'\352_\036=\200\247\0307\rv\327\261\202*wv\333\017lC\260_\022(Y\262\303S\224\"\354\277\316\270X,U\366]~)\243\277y\t\034\251\017*\007Q\263\233\252\371\261\256Y\003\2053<\264\002\022;:\357\330~\264\317:\213\357.\032N`W\3252c7\034\261\b\347\323\341C\262O\316\003Z\366\326al1f\304\256\351\365-\333\363\027'\236V\n\031\326\3562\200\271\013\316g\371\364\204\320\364C\331\247\347\266G!\276\3721V*\\\034Ft\254X\322\030\262K\t-dP\321\207\263(\245m\341B|\275\f \243%\004\315+F\371\210@]\nI\347Q\022\312\t\327\231$\330D\\W\022\3226\326>\\\247\321M\003\231\2146\222\210\243\"\016\024\242\332\250\002\375 \260\227\262\215(\311\363F\264\023\232.Uvp\303E\3632\311\223\211Y \002I|5\346\034u\305\013\033\020\375\027"
+	.ascii	"-\003\305Q\006g\006\3343d\363\201\337L\241\320c\021k\233\fW8"
+	.ascii	"\006y6\221\0328\264\253R\261\032\353\027,\251\313\350\235\210"
+	.ascii	"\016\216\326\254N\007\327\310N!\233\232\\\343RP"
+	.text
+	.section	.gnu.lto_printMotorMix.226.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`\212\b\215-"
+	.string	"ZR\370\021Gp\230N:\331m}\277\347!B\270\002\323>-\302\257\272\241\356\213fYn\236G`\034\335G\230\233W3\314\257n%\257cR\b\351S\314\032/I\236\272\215\366e\331?\265zZN\356\324\304j\304\310\232%r'\031\r\001\365"
+	.string	"\022\001N\242\036\347\364\233u\037#,\272\006x\357\223I}\320\230\376jg\273\333\241\\|#S\321\246\004i\355)\275Zi\264L\fy\264\247E\235\311\323o\325U\375\242K"
+	.ascii	"\357\275J\360 \217\230+\262\031\234\206\266\314/\373\222\250"
+	.ascii	"?\241zl\356\324Y\f\b\317\353\b\037T\217#|\220\255e~ !\352d/\270"
+	.ascii	"\357\335\341\346\344\336\347\002F\240>\310Q\314\\z\250.3Bt\254"
+	.ascii	"\2316\346\336{\354\036\254>}\236W\033\365\342JT\207\302`\332"
+	.ascii	"6\212\017\375\020\330\231\263\2766,\346\213\351\220\306U\216"
+	.ascii	"\224\202\227.\\\227\223\262+\217,\256\023\207\030\272\262\266"
+	.ascii	"\256\nuei}H\344J\313\nk\260\232\251Q\357V\006V\225\r\2468[o|"
+	.ascii	"\327\273\332J\025\360\025\341*bQ\3314\255\240\004\211\217\323"
+	.ascii	"\335\322\300\232J\333LM\312\211\\\345\260}\271\007\235aO22]"
+	.string	"Y\\\267C\f\367^\266VXYg\2323\363\0363\2431\017\245\004O\313\200Y9\353S;\003\303\006\266\032\r2q\335N\346'\323\266W\\\230\030\\\334^\314\307\223\375\007^w&\272\335y\350wg\241\347\235\2157\373\007\034\3129\350Q\316@\237;\377\374\371\373X\313<\217;\357X\313:\253\345\234\3252\316jY\300j\371\306Z\266Y-\007X-\327\254\226\001\254\226i\210\226\213D\313+\3212\221hY%Z\036\022-\013\333rP\265\234\266\345\036Z\266C\313\217\200\340\314\331\036Z4I\367=o\215@3\027/('\344u\277\335\177\367\347\375P\376(\377\334\037\3673\371\327\376\266\377\3554\314g\376\024>\225W9\336\365\270\230G\347\274\233\262eW'6\243ni\234z\336\260\032'\020<\2621g>\341G/\345t\\\234{s\241FY\246w\355bQ\250\330\275\227\205\nei\363\214D\233"
+	.ascii	"\336{\225o\302\227\343\"\334\003m\244j&\343\330\357]M\204jE\324"
+	.ascii	"\314$J\330[\321\364\377~,\301\243j\246\020\207\332\3164\357J"
+	.ascii	"\225!\303\366\022\363bgX\233\330\305\006\2026\265\210:\250\327"
+	.ascii	"\016Jk\312\r5P\023\333\007\332\374o\234\375\271\t\333\311JB\265"
+	.ascii	"k\370\316\206-l\265\207\320\246\226P\377\364\260{\240Mc\247-"
+	.ascii	"\354\037\001\343r\326\247&'e\003\303\020\265\022\214\013\230"
+	.ascii	"\345\323\276\374\206\274,\217\346wA\250\225`[\306\312`\330\300"
+	.ascii	".\313\2435%-\030\373\347o@\007\373z/\341\004\002WeD\312\002i"
+	.ascii	">\271\021l'\337\312\007\364\217\215#L0{X\220\337\262<.\b\352"
+	.ascii	"\020`}cF\317\262\214\360\345\007D\206\371\350\177\313\243\037"
+	.ascii	"\203\257\237\016\001\3067V\026\304J\314\225\264\235\274dfK\224"
+	.ascii	"\266\362\354o\312\226af\024\347[\022\370\272wj\002\377J\213d"
+	.ascii	"\220\337\275\367aPM\300G\231m\237\356~\225\021\233s\235\360m"
+	.ascii	"\373UD\244l \357\364\373t\001\274,`<Q\300\330\"\251\244\224\243"
+	.ascii	"L\321\264\026i4<!\241\326\244\244%e\232\302\250)\311\024|BBu"
+	.ascii	"\362\r\034<\200\200\344d\"\315\320\224\344\204D::\301\243<j\221"
+	.ascii	",R.5-\025)-5-\235\214lT,\221ELJN'T6b\220L2:\036\031!\221\224"
+	.ascii	"GM+\222\307\025"
+	.string	"I\244\322\321H\271<2\360\341%\246#\345\261iiIy,>\357\333\2137\3349!\003\b\243\245\230\254\265\375O\351\275]\027\376\366C\177\003hf\003u\024\333\311D0\342\261\203I,\313\370\227\364\336{\327v\336I\270\323\307\276\334;\244\205\251U\355\350\2617-\240q:'\301u\232\271H\007\232\346\270\375\340\260\001\t\230r\265\240\233\033\266\037v\226\217\330N\266\303\004\257\261\022\265k\302\t\025\234\247e0\367X\232\006\3205\035\240w\232-\223\303\260+\252e\007\331\275U\267\362\240V]\314\300\203<m\323\314\037@\330[qzs4\223\017\264M\277\t5\006p\023\252a\033\002\020\200\241\250Q\\d\214\"35\"\"2\222\024$\035\260\002\031\252\2526\0208\246\254$\005\315\032\032\240ix\rx\003\3629\031\007\376\r\210v\313\262\222\232!q, \242\311 \t\021j-,\371\220h\032\234\235/"
+	.string	"\345\210= \260\033\200\211GLN\252$Q\352r\364\250\307\304\211@\017\034w\330\003\332'\345D\373$\244Y+mv\351cM\007\031\367\203"
+	.string	"*|\024\033\310\304C\262\213\262\005f\351\230\352\301\240\204y\357\341\315\2667+4\262\346\315b\325\f\242\227\311\357\335+\200%\376\0044\245\251\325\246j?\335\301wK0\350\003\254d\341\277\352\276\376\321\221A\261o\030\t\341i<3\376\216|\203\204a#a\026I\215Ja\261\315~\327=[\337\254\005\215$|D|\366\2469\320\313\312\314l\023\035m\343<<hH\031I\236\316!\334\036\n\020u*\334\251\200\031\311\t\334p\311\370^\320\025^\342>$\254(\353,\302\\orP"
+	.ascii	"\"\232}\351\364\013,FP\023\353\262\314\207\023\370\256-\354\245"
+	.ascii	"\326=\023l\204-\273\372aXP\001"
+	.text
+	.section	.gnu.lto_cliMotorMix.227.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`\253\f\205A"
+	.string	"\312pL\031A@dN:/NSc\006\262\314$Hy#\322\001\003\303\232\305\233M\244@\r\022\342\241\250\026|\375\312\335\243\370j\007\354"
+	.string	"\3355\3751\310\376*\024\206\265\305bR\325\377\221\216M\032!d\357$\003}\001j\001\207\001i\305>b\002\235\203\032|\\Mc\345\255\265?sh\027\373h^\347>M\357\375U{\037\204\217\224\310\364}\337\n\355\327*\365G\366\371\243\351\375{\237\326&52}\337'\326\327\216\320}\334}\347\351\334\227\001r\247\367m3\343\346}\237\016\272A\373\265\237\207b\277\266?\262_\335\356A\001\312\336\344\004i\2203\350\340\373\276Z\371J\277qw\313\266\324\325\347\033IuO`\200\224\200"
+	.string	""
+	.string	"\242\240\236\216F\247&\246%\245\244\"\022\261\035\262\353\224\232q\001\267\017\275\225\026h\035\240]Z\362\004\006H\tP\241\364T\021\364?\346\030\265\001\033\036$bp\200\271\003\230\213\303Qp\207\202\333\202\237\264\374\250%\372\206\215Y\356\244N\355\351\003\363?f\026\325\352\311\224\273\3131\261\340&\025\312\b\334\362\177L2j\203\351\233D\217\272a\246\2621\201NB+jM\276\264\222\t\264\354\242v%69&\024\234Tl\216\031t\022\026U\rtsX\376\307|\242f4k\244\307s\202\221\232\234\210w\003\177L\247\034\223\tn\377\230Q\016\275\0019\346\032\036\252\303\"L?\377c:\325\013\205\b5y\2332\314\"uQ\362\265U\362\25139&\035VOE\315\371\254r\270\333\223e)M\251\376\313\2239\207\036\243\245\221al|\201a\207\367}\333"
+	.ascii	"\025\2652o\252w\343\022\335}\326\215t\027\217\306paF\272\262"
+	.ascii	"&e}\333T\316Tnk\254\343,V\367g\n\257\017\301^\315\377D\264#Z"
+	.ascii	"3\026\n\276R\345\356\022&\360\2278?-\017q\331R\243FO\315\315"
+	.ascii	"\356\006\200\373(\330\257y_\n\214(\360}\307\276\374\232\356\254"
+	.ascii	"\363\251\310G=Q\262 \316\367}/\3349\236\025}-_\233E\213\265\337"
+	.ascii	"\202\375\232\365n\027\\\370\313>\364\037bwH\n\341\324\354nw_"
+	.ascii	"2\336\257\354(=\357t\272\210j|S6\347\373\232}\211l\3158(\370"
+	.ascii	"\332j\201\t\231*\243\341`\237_\324\001R\342E\235\204\251r\367"
+	.ascii	"\327\f\374\345s\222\335!&\341T\231\223\335O\262g \244\226\304"
+	.ascii	"\271\331/`@\n\242\"\235\333\272\267(\274\314?A\002\004\007Y\f"
+	.ascii	"\026\\\375\371\266\272\336\273\352e\336T-\356\251\250\263yC="
+	.ascii	"\035\215O\363v\"\342n\"\342f\"\342^\"\342V\032\342N\372\335\273"
+	.ascii	"8\304\2154\304M\304\270[\214\233mq\257C\334\352\020w\036\342"
+	.ascii	"\306,\356k\310\202\326\355I#\025\222\001\237\257\221\302F\257"
+	.ascii	"\337\n'\356z\377\335\317\346\177\376i\016Hg\320\032\"::\356\246"
+	.ascii	"\261\024\255\371\270\233>\361\366h.\352&\275\313\353\025\016"
+	.ascii	"_ \233\023O\210 \251\026\035\267\353\255\267\350\\\367\325\364"
+	.ascii	"\333t\361+\033\036U\312\347\033eeM\303\363`\253rF\323\347\245"
+	.ascii	"\216/We\274\267\205\251\210\270F\360\227I\371\321\177\311\222"
+	.ascii	"\220\013\341T9E\312\026\246\334\004\364\250L\001Es\f\240\031"
+	.ascii	"[\033(m{KjRT.f\2647\222n9\213&\261\271\315h\335\026p\233\237"
+	.ascii	"\207\225\356\221\253\300$\255\331\216%.\023E\\\b\247\021\360"
+	.ascii	"\365p2\205\332G\257;\013\277\205HP\334(Ue9\331\305\214\224\213"
+	.ascii	"M2R)=(\207\224\210\371rS\231\315\022\210\306?p\207\374\314r\262"
+	.ascii	"_\370\276\303\256y*7>[#\313{\002\241a\223\244\205\237\367En\225"
+	.ascii	"+7\267\331\232\311P\340^q\261D\331\t\372\021N\225\004\220\320"
+	.ascii	"\315\025\355,Q\310Sv\202z\304\013zTF3t6_\356\304\025\271o\355"
+	.ascii	"\373*/\364\005\237\310\335\242\272qn\027\326\355\302~e\363\361"
+	.ascii	"\256>z\233C\bg\f\027\252o\002,\001\214\033\006\177\271f\\\007"
+	.ascii	"N\352\247\254\360w'\013\361\007+!g4|o\007\\2.\035\376RB>\034"
+	.ascii	"\034\277\013/\030\27467U\225\220k\306Ck\366B\315\207\336x\006"
+	.ascii	"\356\215\037\206){\213\206\271\331D@\353V^\027M5\032\246\362"
+	.ascii	"\"^\020Dln\236\007\013\225"
+	.string	"\267\362\021*\206\220\031\033\031.\354\216\036\350\376\360\300\216\022\r\341\031d\253\360\273\356\036\007T\261:%\373\334O\n\366+\005\267\3011\\\330P9\347\267y\210\246\030Eg\001\335\003\351\005\366\3056\216\253*/\244\027\227\r\022H\215\254\301\005V\345\365E\203k\007\230\b\245\366\342\262Ac\355\034H\034\3100\266e<\bC\366\370\252\241\225CF\214/\0320\244\372_\237\321\205\224\321\265\206\345\270\221\221`_4\274jt\r\273\353\301\027\215.-d\027\027\2140d\016\260/-\260/\256\032Z]a8\264\036\fh\0337\220aZ9l\330\b\323*>\307\236\333\240\277\020\271%~c\231\314\200\024DF\b\200\300C\254\337\rv\023\241 \360I1A1EKv\205S\302)\005'X\006<\317\377\0067\337tg\341\266;\270J\334 \002\276\251\324\007\334-\306H\314\021n\023'\350G\266\346J\022\001\217"
+	.string	"@\310\255F\035\363SFS\337{\354\023`\200c\206P\330\224\273\305\n1\333\034\034(O\362\0344e\266N\034\037"
+	.ascii	"GpPY\271\325'c>:\b\303\300A\235(c\316\312Eh\031)S\022\257\345"
+	.ascii	"i\213\263D\t\037\003\246\314\376\211\213\003\225\233\315\250"
+	.ascii	"\357\270 \267jt\312\306\214\306 \257cy\252\\10\363\224\233\355"
+	.ascii	"\224\027\344\"\224n\211\f\253M\345\2441\367\256\2262\253'N\314"
+	.ascii	"1z\342\234\224\316Y\324)\353\207\276\345#%r\026m\302\272SF\273"
+	.ascii	"\"du\005\306\250\224\273?\340!\035-\312\3659\367\272a`\264>x"
+	.ascii	"\311\n.\rm\300Vg"
+	.string	"\256\020\374\245R\036\236\211\213\342\247\374\353\342\224\233m\225\327\261>2V\031\327\211s\342\247\314\311\026\024\200\370\250Q@\003\225bfDdF$I\222t\320\002\021!\"v\021\0201t\016\225&I\322\034_\317*D\342\345\303xU\301a\001?\240\352G\264\200\273\020\376\347\231sTE\333\206\320\350d'\247 I\213\351D\341^\250\340o\206'\313\311:\205iK\221\030g\255Mvt\202\225\022(\r\376\313\365N\254\030u\001\372h\271\202.s%\002NX\376\360~>\262Q\245\314=>\276\002\tjC\224I)\203\310\036\270@\013\f?8\237\217\367T\330~\244%L\236\2777\206h\210\305Er\232K\326\221\364\f{\333\021p0\215\227\245\205\2450\255\013rC\317\3431\324\303\271\210\0311\2365=\\\222\206i\275\343\336\375-\245\363\023\036\233\337N\r\341\3660fd\231\22056`B\321\222\265^"
+	.string	"\206f\274\027G1}@\005y\243r\306\264P\302p\201\331\265&\340\345\255`\307\376\204z\350D\260\302\2453o\304\210\t\332\3535\241h\210\013\334b/\007\004o)\002\220\036\340C//\204dx\031>SO\227S\314\350\346\211y\006\026\322\001\257\022\n\025:R\316\006;\324z\002\265\252L\355\3009cH\256J=\200\376M\350\274\361<`"
+	.string	"\217"
+	.ascii	";\244\031\027\006\326(>\210\022\243\242\201)?80\377v\274\016"
+	.ascii	"\223SS\267\314.\370\300\\\243"
+	.string	"B'=\224\336Y\330Z\037\017\266C\034e\""
+	.string	"\021K%\275:\037\235"
+	.ascii	"\374\301a\004\332)\"0\260\237\350\320\017\302\366}?L\265\242"
+	.ascii	"\211\341\315Py\356e\335C\007\240x\037\204\214\031\"\004\271$"
+	.ascii	"\342\306t4\241\311g&\347\334^\343;S\035\252\244QWA|\312\232:"
+	.ascii	"I#\2768O\035\2334\243\n\300\005r\2266c\245\001"
+	.text
+	.section	.gnu.lto_printRxRange.228.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`C\005\365!"
+	.string	"\026~\332K\240\324U:\005|\001\360O\203w\210|\241\371\254\212M\337\343\2263\342\206\361\253\211\021~\355!\314\363\035\273\241\357\275\026\346\245>\313\375\004z\302x\n\340\347Hss\274\020\207YA-O\233>9/l\360\002\333\b!\204\310\235d\304"
+	.string	"\271"
+	.string	"\305"
+	.ascii	"\367\036\260\270\242\252\334\213<p\224+\254G{\316\313\230gt\201"
+	.ascii	"\320\226\371\307\313\370\035\311\201&s"
+	.string	"\227\222R\n\220\267I\217\256\237\245G\331Z\346\004B\277\033;p\337;\265\324q/2\210\r\254G\371\307<\205\306t\201\013\270>\bkd\271\367\326\032\005\237?\221g\230\375=\006[\325\024=\333\376\370\311\373`5\223L\226P\300\307\316\027$OR\247\002-%\013\263\032\022\277R\r\243\256\222x*\264\350i`\252)\"\006*x\332\0349\021E\006\305d\317sF\274\321u$OQ'P\227\013\251o\335:A-\331\276\326\321\242\022i\324B5$\336\252\r\356\275l\233\240\206g\331\2319\0073+1\237]\001\366\213o\372\235\303\244,\"\364J\262_v\252)B\306\331E\346\220\352\364\267>`\206\022(\311'KvK\023ot\261\350.2#\201\266\253\272\\\020spW1\373\334\370\013\3409\362\337\371\214_\307Z\246}y\306y\326\371\306Z\266\261\226k\254\345\231j\231\306Z\236Q-\313\264e"
+	.string	"\251\345\230\3242\214\265\374b-\313\254\345\230j\031\246Z^U\313\252j9m\313\250j\371l\313\235Z\266\251\345\017"
+	.ascii	"j&\223\320\340\002\321L\2207\304\027\227k\004\345\261\342\313"
+	.ascii	"?\353\314W\362\267\226\276\036 \362\206P"
+	.string	"\213J-c\226\241\3654\370Z,;\312\257q\033\277gi\370\035\006K,\266\305\332E\266\351\201\277\212\313\204\220\211\002\235\326N\31426\326\262\276i\276\020\233J\245\3048e\2747\370\246\333\032\354\0258J\353\227f\306\025\3317\361y\211\rd\001\375\222\266\254/\364\202u\254\325\242\222\212\320+\210\256v\025\004\353\033\261|\300\2405O\307,A\252]<\337E\311\264\221v\325\332j\337\352\207\356\314&9\326>\323\3111)\367\036\272\240\253\002j\007\2458&\331\257\363\221c\320\013M\373lt\250\304J\322\311\222\335\262C\367\346\025\022\357@\232\244\375f\n\235F;G\n\363\2053uBM\356]b\300\307\261\201\267\340\n\353\350\331BN\216\266w\272\373\301\027\347yH\372\266\375`\013\245\354\373\351\361\375\364\370~zz\033z3\017\216\214l\276\f8\230\334\035 \031\371lD\270\241\234\243\242\034\321\216\347"
+	.string	"W\264\263I0\302\355v6\013\267\331\205#[\004\f:\337\320\3127\0049\243[\rw\263\021\365pH\273\\m\227\263\351j\267\336Q\rA"
+	.ascii	"\346a\300\365jH<^\257&C\336wU\362\353\026\211'-U\222ZIG\254\213"
+	.ascii	"\fS\261\3724\032\303\262\223q\204\025\320J\222\237\367\336\013"
+	.ascii	"\353\"?\nW\t!S"
+	.string	"\345Y\257p\021\205\314\346\373R\234_Cz\323>}\255K\250\241\314\nN)\331\231\236\325\264M3O\260\301\351\032\232\236\021\241\351\217\300\002\242\345(\3233\235\026\227E\232\272\037\n<\0022\375\023\323;\r\3408\016\32310M\303\024]\250Q<\002\211s\210hDDA\223\202d8\200\002\2319\253m\021@\271EHTP\310\260\006]\274\331\021r\334TE;\300H\307\275\346\313u\343\035\226\314\202!\352\344\265\223\333\311\226\244l\211\b:jO\3607*\3146\332\025\034\004\300\313A\227\310\305BAn\360\013\317\313\237\002_:\246\210\023\224\257\335\030:\034\024\313\354\340\2334O.:7\245h\007\222\375\252f\235_\334\\\334\216>A$\035\276WY8TI\350\212\223\3502\246\273[62\035\370\341\320\226\300\210\177\233\222\026\311\034\314\224\004#\271\254-\002\017Ic\200\334|\361\223\200\270y:T\025"
+	.ascii	"\370\357\227Q\013'8\203\341\263piw\261\203\363\372W\365U\247"
+	.ascii	"\022\307j~X\334\377"
+	.text
+	.section	.gnu.lto_cliRxRange.229.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`\333\001u\021"
+	.string	"& uH\340\322&\035Pob\225\337\333\313Xs\361\301#l\037\211N\320\315\231+=~\005\327\235\f61\245\223\366\321m\200X\377\260\273N\275N\246\301\032\rE2\bt\030e\f\350t\035\f\331\255\001\013Z id\223-S\n]"
+	.string	"["
+	.string	"c"
+	.string	"H\273#\003\237t\237\036o\302}v/\341>\335\262\203\030x\255\253\301\216\031'j\020\331]O\262x\353(nnR[\376\205>\"\312\\Gu8\347&,%{\351\006@\206s\271\235\320\222\206\f\220\315l&\261\026\342\205\25642\031U\324\203\335\265\2122\233\273\273m\226m\t\266\232\004EM3\372\344N7i\207p\321\213\227\001\216r\326\2116#]\366(\243\222\307\276\254\325j5\313\231\375\240\177\233j\335\324\037\271\214\024\261\032\233\037\371\330\215\325\212\354\322Tr\341\021\037\255L\263\035\035\223\370hi\303\344\263\003\264\273)M\331\276\332\007:\215\326\203J\234dw\026\024<^p\225&\212~\024\320\217\317Q\241\333\205]\264\320\301 (\370\274\200A/\252$@\223\263\302\211\366R\035\257\330\317F\242~\006\356D7RI\036=\2731\027Od\243\034\3077\202\"\026\243\311\201\215\337"
+	.string	"}\237OwXM\177\305}\242\334\376\300\242\027}#\0307K\260\367<\321\220\244Ep\227\032\002~\001]\300\220\263\207\024\230\320\203\tK@\326je\003\313\207\362\227\262Z\371<\360Sq\b\301\027\326\312c\255T,\336\027\272x)\b\334\002\002\f\275\227\226\226\320K\2151\337V\316T^\3748\321b\244\314\266\273\213J\240\021T\364\242\267\367"
+	.ascii	"Rs\303\035\320\017]I5\231\206\222>\0015H\236@\001g\311BT\270"
+	.ascii	"t\246\f% \240\002\221\262\362\030qnpDh\017\005\226x\\\255\210"
+	.ascii	"\005_\n\246Y\262\355\360\373J\312Wd\037\252g\374\2058\301\261"
+	.ascii	"\bFcP\312\202\222\376\240\367\0327=ZM^\370{;\216\365\302\"\\"
+	.ascii	"6Dj\253\271\266\022.\344\376\312\344H\n{\212g\3235\004\b\005"
+	.text
+	.section	.gnu.lto_printServo.230.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`\036\016UC"
+	.ascii	"\372v\350\031=@\346\316\030C\357\216;\345\222a1\233\340[#)\353"
+	.ascii	"\f@\256\210\372~\344\232@\233\205\370Y\177\035\211\330\024\034"
+	.ascii	"t\372\247zh\032\267\363\232\307\245\273\376\356\273\352\356\225"
+	.ascii	"[J\231RJ\001\232\001b\001\220\001jA2L\031y\001\334\241\364\352"
+	.ascii	"y\333\r\321\224z\330\343\215b\033\356?N\3721=\251\321\030j\270"
+	.ascii	"\331t\037'\371v\254/\\\364}Kz2\362\263\302]sV\225\026}\217\030"
+	.ascii	"\237\214\016\357\022Gt\036\367\036'[\257\321\240u\232\034\375"
+	.ascii	"\276\275-d\313\364\356\360}\243Y\315r\230\333l\325\372I\3463"
+	.ascii	";\242\224\3365\251\031\t\357\314\215\327f\320:\272\243\227\336"
+	.ascii	"wn\221+\332\313\266Y\267\233\332f\331\235\371A\027Z\337\365\340"
+	.ascii	"\177\337\270\275\277\367\215.`,\267Yf4\346AQ@\3364\bS:\247^\342"
+	.ascii	"\373\276[oeI\251T"
+	.string	".\241\330\3555\332|d\321:\n\352i\351\324\304\264\244\224\244D:JN!\245\216\256\261e\327w4ni\023\240\003T+\\\343\226\326Qto\2348T\2257h?\rf\361%\227v\332\322M[\006\2658\323\272\312\205\371\321z\332\272\254\021\006\331,B\361%,\255t\245\223\256\bJq\245\225\334[\\#\255X\207n\020[O[\334\272<\322eH\177i\213\342G\202\215\341YM\304\322I.=e'\247\255\276\264=qd\377\200\266\324j4\322V\267\202\025\"\344\244\367\324\374X\345\255I\273ropmd\322m\322\315\351\354\212\025g'\211\322\255\271.\363P1\354? \276\256MM\370\372\264\2366\270U\253\017\030'\335\327\316\346\266\346\337{\315>\031\341\271S\224{k\322n\234\360\276/\373\020\267\267f\252f\366/f\316c>\202\n\035\366\244\246i\206Q#\200d\312\221\365\237\274\243\265\360"
+	.ascii	"\230\020\312sh\017\2405_\304\376\024\376\303\277\240f\230\243"
+	.ascii	"f\301\266\337\277\233_\324\274\312\\\337\337}\315\006B\357H\013"
+	.ascii	"\323,\376\360j\003>o\352\376\237\314\3214o\211\230\021\302?\307"
+	.ascii	"<\"D\3735\203h\276\346\017\355\246\331C\0076w\3509\315\033\332"
+	.ascii	"N\263\206\276\353\306\320\200\315\027\372L\267\205\216\323\\"
+	.ascii	"\241\243\335\024\334\031\254\3554\177u`\263W\273i\356\3525\315"
+	.ascii	"\020:M3\227;?@:;@:7p\347-\2443\003w^\340\316ZH\347,\2443\226"
+	.ascii	";+p\347\004Hg\004H\347\003H\347+w6\200t.\200t&\200t\266B:W\265"
+	.ascii	"\316\003Zg\001\356\034\300\235\001\2703\325\321y\312\235\245"
+	.string	"\216\316Q\356\fut~r\347\245\353\354\344\316M\2563\223;/\271\263\322\3219\311\235\225Gg$w>::'\335\031\351:\037\335\331u\235\215F\347\326\350\314\032\235W\243\363\267\316\336:7\t0@\265=y\323\272/\214\276G\252\324\027\017\373\006\332v\272\003\273\347t\003v\307\351v\323\355\327\275\246\233\257;M#\231{p}\367*\024j\342\245\016\267 '\003\r\247\3256\342\316\341\246\303I\344\263zx\227\b\207;N\313\231\020?h8-t\364\317\266\344\317q\267\322\315\027-S?7m\013\377g\252\212\244\200\006\274\205\277\360lu\317\200\247\360\025\372N\013\370\001]/\340[N#2H\251\237\343c\026w\304\263v\316lwL\b\245\265W!\2673\307\177r\377\365\321p\252\306\351g\f\341\"\232\3429\375\236\373\254\205\320\235\243\345\372\021\337{\035\246\307\250\260\031\007\345M\277|\250\227z*"
+	.string	"\037\340\231?\004\200\360"
+	.ascii	"\246\236jq\352Q@\021)F\275\0245\252\356\351\241\026\211==\nh"
+	.ascii	"\"E\247_&:=\n(b\035\3237}\373lTE\304\303\264\332\201\"*\272\235"
+	.ascii	"\373O\3666\253{n\332\347\364c\265\032\354\331\230\241\334}\344"
+	.ascii	"\037\275\362\225\236\353\271\021\2110\31252\214\273{\337f\017"
+	.ascii	"!\3416{\t\202f\301~\351\231K\230\360\036\302\353\013\345\323"
+	.ascii	"\030\303/};\027\223^\351D\027J\252Cze\212&\204d\250\230\374#"
+	.ascii	"\025-H,Yw|\344X\007:\nR4\276\373\306'U\221s\221\231\375\307\205"
+	.ascii	"\373\276k^\256\361\373\r:\250\016\017\354C\274\222\220\352\347"
+	.ascii	"\\\374a\374\347*\240\211\"\276\366\347\270}\366)\024\032\202"
+	.ascii	"\022\266f\032M\023\332\b\203\366I\344\001%d;\331\006\212!\373"
+	.ascii	"O^\377\337\027\305H\377\254\371\242=w\310\270\027\327?r\243i"
+	.ascii	"4\235\307F\030\224\220\356}\337/n<>\360\220qC\201\362\351-\315"
+	.ascii	"\376\207A\t\353\376\374-<\210\357\277\\\3064+c\342`\226U\351"
+	.ascii	" \223a\266d\026WUgWUQ1\2303f\210\275\0303*\265\230A\203\302\261"
+	.ascii	"\202Y\f\2613\033L$\262\026q#\306\231X\013&\013&3\031beb h\340"
+	.ascii	"(c\232%a\230\211u\250!\343\214\205\313c\f\310b\214m1\307\304"
+	.ascii	"Z\2241o\314 \333\232A&&ck\254\314l\213\001\025\323\250\301,\333"
+	.ascii	"\272A\203F\331V2\372\266\264\3356J^\305\303\037\257\026\365O"
+	.ascii	">fy\362\360\254\235\224\257u\327\263\261Zw}\033\222\346Au\275"
+	.ascii	"\207\3577\315&\201R\237\2344\274\321n\312\327\372\353\331\270"
+	.ascii	"\255\277Zp\214 9\313\257\327\360\255\035\035\237\323W?x\360I"
+	.ascii	"+B\246,]CW\247\311A\203g\360\016\276\325\333\372\006_\257\325"
+	.ascii	"[\337\njR\337\030|\017\366J\245\353\253\303\343#$\243\205\351"
+	.ascii	"\237\314\025\250\324\341\215"
+	.string	"vI_k\257g\313\321z\375\313I\327\367}\337\245\177\246\265\327w\370\326\016Z\225\026\242\211S\363\252+i\375\202\005Z\204\222\262\260\376\352\263\276\325s\302\025A\304\372\317\363\022\027E\371O\366\372\256gg\303`\324S\365\243\301m6\024A\263\t^\001\234\202\r\237\340\223V\202\314q.v\024:]\252H\377D\360\375\345\352\255\036\301S\025\006\361s\302\371Z\037\370\r\377\215\234\200W_\340\017<\200A'\234\201\277\362z\2556\360\001\364\232T\002_\340\327>\247\023\253\257z\002oL\344\\\242\026\304\220\3257 \026<\016\336\354\200X\365-\330Y\322\274)qe\360\002\200\376\250q8#\215QF\021\242\021\005I\222d\030\003\300\002\221!*\316\001\021\340,\310\034+\021\222\202\244\2251-\224\263\023\362\232/+\2763\351X\020Ry\035\227$\r\023T\b\001\340\241\274\243L\206\274\273\\\367<\023\247\354"
+	.ascii	"qW\230\022\004l~D\344L\"$\332\267m\020\016\030\360j\0274\357"
+	.ascii	";\374\206\333\361\270+\t\252\343KI\177\323U9\202\211\217<\354"
+	.ascii	"\366\341h\372\317+\366\374UA\230\325V\006\030\206\321\237#H\254"
+	.ascii	"\037\355\n\353\302\225\246\035\330\331I\244&j\350\001xTy\016"
+	.ascii	"\021\356\020\316\032\216:rEGb@\351m\323\202\371\306\035\330\267"
+	.ascii	"}DF\314\233g\022\351\251\274\314\261\250\nq,v\3278D\300\200\301"
+	.ascii	"N\"OS\021\n\321\203\307:M\312\030H\356\177k\017k\346\274\237"
+	.ascii	"\230_`\223\325\237\355;\023\306\361\202\177\372\207\251\3679"
+	.ascii	"\021[Lxz\324\033\354\330;\013\021d\223=\334\232|\025\232jY/\210"
+	.ascii	"q,\223oe\214\332\224\317\217\325\356\354\r\351\353$\rTM\316\374"
+	.ascii	"\200lq}\210\236\346\023\033\235\032V9\250/\273]\f`\270um\226"
+	.ascii	">\354\250:c\371\322\n#R$P%,p"
+	.ascii	"\257w\204\373\013\004\bJJ\345\345\224s\3615\313tZ\001Q:\034#"
+	.ascii	"\246\200\244J\2669\312\361\323vL\241i6;\314=\233\302\310\273"
+	.ascii	"B[\232\"8\304\005}\212J\265\f\002\023\313\224\231\304\252\360"
+	.ascii	"y\334\323\032\t\204\357d[{BHN\tQNHv*4f;\316\313\200RGd\341o\006"
+	.ascii	"U\247\212n\270B\322\3110\270\224\022\212\204pmdf\3351\270q\337"
+	.ascii	"\022\361\031uQL\202R\340\2340_\261\212\254\035\177\336\005\257"
+	.ascii	"\344\2561d\232L\220$E\343CM\257\031\277\241\373\254vT\025\373"
+	.ascii	"0M\374\001"
+	.text
+	.section	.gnu.lto_cliServo.231.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`\037\013\335;"
+	.string	"\272g\030\027DP^R\007\337N|\357\317\f\365B\354\360\262\374\333^J\rd\257\243\377\3200i\212\f\200\254:gE\005\232\370\341\357\342\007\220\rO\206*\266F\006\246\317\036\002\""
+	.string	"h\201\330\036\242f\271\333\336;\311\224\002d\001B\001^\001V\\\256\213W<\316\351Xhx\034\215a:\177I\230\360\214^\305\261N\207k;\217\253\261{\255\371\263\372\305q\374"
+	.string	"v7@\353A\357\265\306O\234\027;\225\357\217\315/\216\257\007\334\355\245n\317\335\356\346oN\227R\303\223q|\346\306%\216\257\t\332"
+	.string	"\354n_]\371\272\013{\320\353n;\273\343\020q\305Y\r\376\214@\255\340\211\343\270\371D\032n\237wz\022\322\221Q\021\321\020"
+	.string	"\245P\020P\362\007y\3641\026\211C&,|\335\366\227\331\331N\f\313\362$\2447?2\272\372\321\244\210\215hmh\t"
+	.string	"%\312$BH\202\216"
+	.string	"\031\261\346$\326\034\033?\255\201\262\273\034\236G-\322*\325\b\341C\266\f\270\360\214y\036\365Gk\314B\327\270\023jZ>\226me\03727\236\375\305)\232U\307\234\350yT\037by\330U\345\341\314V\310\005\246\304\363\250c-S\326\317\213\323\271"
+	.string	"'\324)\031\026`V\345\341\302'\177e\376\314\252n\376\266\023\300\350"
+	.string	";\206A\333|\304\315_1\254+\273\255\322]\2167\317\243\366h\223B\340`\235\216+\267.\347\002\314\252m\376\256E\346\313\326\200_\027;\236G\225\322*\301\224D]\316\2634\354\231\263\260B\034\307\235\243aU\357"
+	.string	"\336\2353t\367\213\356a\211o\373\356;\224\315\271\370\325\373\337\276w\225\031\377\337\241\202Zy\260\023\370\324k\374\374N\347mvm\017\273\027\347\345\231\007}L\025\036P\332\036\312\355 ^\327\342aBd6iq\254\345Q\327\322\215\300\355Ddf\220;\317$nq\0343}q0#\332\221\270\333%L\270\355&^w\021x\367\211\247\354\321v\271\274<x]\302\354\216\256\177\264v\377\301\341Cm\371g\r\343\365G\201}\263\225\263}\314\004\276;jE\366\250\277\313\271\177\325\355\270\006\372m}V\367\365\231\037\255\333\211n8\261\366\237u;XR\320t8\357\002.\305\235"
+	.ascii	"s\351W\357\244bn\244b\356#8\267\021\234\273\210\310\347\274\207"
+	.ascii	"\340\334J8\267\0201w\02017\020\234;\351\346\376qs#\335\334G8"
+	.ascii	"\267\3170\267\361\315]|s\023\207\271\207pnX\230[\350\346~\335"
+	.ascii	"\334\356\233\273}s\277\233;\273\271\235)\302\335S\017\356\357"
+	.ascii	"\310\357]c\260A=1\236\353e\211\317\271_\335\341\334\261x\333"
+	.ascii	"\355-\303\353\372\203\365\312Z\267gi\247\353\342\\\333\005\330"
+	.ascii	"\272\306aB\"R<nx.\314\360,\275\264\206\246\230\235\212\007a\017"
+	.ascii	"\270%\360\347\321ZX\340\277\206\370\033\227g\007\351\303|\242"
+	.ascii	"\227\376\274\025\026\371\307\377y\241\025h\216\003^\340\221/"
+	.ascii	"\354\203\256\275D\177| (\330 \024\214\317\027x?#\327\004\373"
+	.ascii	"\274\323\232\240\325\213V\036\204\307\344d\217\217\326a\207\235"
+	.ascii	"\345\001\357\3268\364\314\227N\353z\224-\t|\267F\007\277|i7]"
+	.ascii	"0n\200~\335\301K\343\305\304\247%2_\251\316\007\032X\301\017"
+	.ascii	"\275\024\300\224L\n\261\371HS\262)\274\364\016^\332\355\356\\"
+	.ascii	"\264\360\3551\312\351\231q\327\264\371\025\027\370\362\233_\204"
+	.ascii	"N\323t=\341a\006x\203\030\300\235\023w\004\353\306\313\240I\366"
+	.ascii	"\f?N\f\027\225\371g\355t\356cS\262)s\351\273\025.?\351\245e\274"
+	.ascii	"\370Mg\234\214\023\2778|\342\267u\240\202\355xN\261)\030I{\215"
+	.ascii	"\327\335\341\037\343\246[\244b\013<\351\227\376\b\235\306u=y"
+	.ascii	"\346Ao\3438\216\341G\373\356\256\340rMIiQ@\341\303\377\322!p"
+	.ascii	"\346+x\267\257\253,)/\277\033\203\206\354Q\341\277d\364\332\360"
+	.ascii	"\266\230\322\262~B\243\334\315\301Cv\243\247\206\367\374\254"
+	.ascii	"\034&G\356}\264v\275\355^\346\273\330+zX4[9+\201\355\215"
+	.string	"\325}\264\367\335\314\375\374\357;4\307\320\257\002\315B\351\252*\206U\324U\023\213\305\n)\027*\260\250`T5YH!\345\342)\006\320\025\026U\324\024\214\025VOC)\267\302z\361QTR.RLA\t\033JI\312\005T3\n\352I\205U\024\026\225T\223J\352i\252\teu\325T:\352\252\027QVM\254\252*\253f\361\252\345\025\264\376\351I$\326\372\254\216\314\363E\207D\243\215c3\n\216\305]\316\223~U\362 \\E\343;B\212\222\277\326\244Q\243Gz\240=\261;P\301#k\366r\266\275\036\335\023h\227\027\375\321\027\211\210\311\201\n*\337\362\026\223\374\314Z{b{B\337\355\234\222c$\203\202i\242\200Z\335\026\\O\323\353\321\245\225=\360-\335N'\236GD[\024\350\331\020\257\273E\250\230\230( \321\264\215\321[[\r\023+z\264\2447\275F\217\374rg\364N\326:\353"
+	.string	"8=D\275f\210\235\223\203E\003AI\332\220s\314\233\336\242w\360\234\203\203\275\003l\213\336\311J\367\305\217\017\200\320\373<\347\366\260w=(\rT>Z+?\371H5%e\240\373\025\213\232P2\313P\310\234\236\220<\257\240>oz\205\036\25167\005{f+g\373\262\273B\357d\235c\363\302\003T\274\363\026o\320?v\256\255?[\365\026/\320\007%\037\350[\273\004\311w\262\306\005\266F\200d%\335M\233\200\340\250q<\244\224R\206\204DDF\222\202$\035\220\002\2211+n\021`=S8#I\222\326\312\340r\210\241\3028\rj\346\244W\335cY\031-\007\311L\230\373\271\235S\244Ju\301\273A\243\351\324Pu\271\256>K\320@\217\237\311N\232\335=\201\f\265\206\005sVe\275\205\252j\3352\315\240\302w\2632b\242w(\333\335\263I<\020TC\024\3478e\036\234"
+	.ascii	"\377/\013\207\306\ra\326\005=\0033\262\313I\342\216\rn\367\307"
+	.ascii	"dw\005\376\210\013\331o\244`NC\037g\220\270\001(\241b\227\344"
+	.ascii	"\007v\247('6\034t\211^|9\321!#~h\271\024\275\343\031\225\363"
+	.ascii	"\225F2\234\231\225\257D\033\234\306\023V\353Q\331qjc\253]T\007"
+	.ascii	"\257\177$\377\354\322\217[\243\376\r\377\253\b{\002\360`\016"
+	.ascii	"f\002\200B[\247\201B~Q\033\336\260\005\220\303\034\235!\335y"
+	.ascii	"_\236\370};\310\205\254\025\025NX\222\327\371\362\366\034$\377"
+	.ascii	"\034z\371,\350}\030\231+\017N\346h\270t\273sl\253l\003)-4\265"
+	.ascii	"\247\3404\237\370\023\236\232\366\220uRp\372l\331h_\343\271\177"
+	.ascii	"\316\n\254\210f\256\323\001_}5\362m\332\331oO3\373\224\034!\317"
+	.ascii	"\327\204\026S\311\026?Q j/\033\353\b:\001\324\025r\36200'xuS"
+	.ascii	"tG\273l\244\265_=\205i\261\027;\\4<t<t<t<\326]\017\225\361\232"
+	.ascii	"\344f\250\271\351\235\177\276\006\004$\256\307\b\020(\030o\243"
+	.ascii	"\312\202\227\307r\006\321\241\021z\305\270\267M\330M\032i%\\"
+	.ascii	"\177"
+	.text
+	.section	.gnu.lto_printServoMix.232.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`\375\f\2758"
+	.string	"zb\270\025EP\036R:s<}\007\017C\333?"
+	.ascii	"7jf_\334\f\327\306\026\354TE\212\332 \247\035^\274(\fy\242]\312"
+	.ascii	"\362\215\326\242\267\223\0068 XB\304\004\212\262\023B\305\342"
+	.ascii	"\312e\227]\374W\373\t!{'\031F\001+\001Y\001@\304\336.\252Ts1"
+	.ascii	"\357\206\305:\250\036\r\327\3238\273\210\240f\324\351\362\367"
+	.ascii	"\026\202\257\314\317vbw\333\311\364\315\224\311b\352\242\276"
+	.ascii	"@|hfw\246W\026\277\257\365\307t\360m?\314\305p\235\315\306_\262"
+	.ascii	"\367<\246X\275\344\275/U\352m\253\370\275eb\037\354\006\363f"
+	.ascii	"C\306\335\357r/\\\247\336(\022\337/5\036\013\250Gr\337\376n\344"
+	.ascii	"\276m\214\273\0254\340\372t\253\363\373F\315\244y_*UG\375\336"
+	.ascii	"6W7\236\242\216\267\213\201u\n\rs}\337\367\230\321\232x\226\372"
+	.ascii	"&\302\\'\022\r\207\204A!\340"
+	.string	"\317\347\266l\306\\}\265;ii\363\242+3\326u\"\233\341\3364y\234X\024\226B\024M\316\307xa\"(dJ>lB\026\375P75!Kra\022\034,\303BH0\360\b\376Y\0213\202}\3011(v\331\250\350\233\220\307\211\231\261HpN\356\336v\334c\f\f\267\254\321\2216;\217\023\213\262Sv\256 \t\216\351\300,K\201K\232\224\2339\3761\366\305f0ln\272\311\212X\024\234?\346-Z\331u\252\327\204L\311\261\017\303\373\276\215\303\306\310\336E\357~\210n\334\240[h\0319\360^\206\333\303EO\316g\335\324.\f\241\nf\247\363\223\356\317\375\027\036\367[\370\234\277\302\337~\n\207\363Ox\233_\302\327\374\021\036\350\207p\275\377\301\375\374\016n\375\033<\357gp\274\177\301\355~\005\017\364Np\2757\202\373y\037o}W=\357Mu\274\367\324\355\336R\237{G\035\370\364/"
+	.string	"\365\270\367\323\347\274\235\016\346o\372\333\233\351\324\237\300\341\274\215o\363^\302\270\225^\346]<\333;\t\343\016\200q#a\334G\030\267\021\306\r"
+	.ascii	"\343.\302\270\211\0307\021\306=\304\270\207\276\346-\304\270"
+	.ascii	"\203\030\267\020\306\r\304\270\177\030\267\017\343v1\3566\343"
+	.ascii	"f3\356|\204\033\037\341>\006\tm^u\326\254\\2\035\365\005\262"
+	.ascii	"\027\350\245\323\252\241\002(\2201\007\272\352\0253\235>~\212"
+	.ascii	"ym\217\325\230\241\344\311+f\036wN\334\341\315\311\250\2633z"
+	.ascii	"\271\263\325t(\206lfW\264\237\334\034&K\001\027'h\305\335\224"
+	.ascii	"r\346\334A\306ys\263\272\033\326\0338\311W\252\277\005\306\335"
+	.ascii	"\224l\332<*C\315\232\253f\032\243.\t\301\251,D\225\201U\371w"
+	.ascii	"\314>\004\331\315O\220\333\354C\213\262A\007)e\250<\244K\302"
+	.ascii	"\006\035\224\303\311P>\373\2315\037\302\374$A\216\312\271\252"
+	.ascii	"\227/|\021\t\"\310O9W\373\\Z\305\217\3201;\345\\\325\3032a\242"
+	.ascii	"\007X\225\231r\256\342\t\325\336\304~T\331\230s\265"
+	.string	"\016\352\256\016\212o*/\345\\\235S\253\353\273*/ 7\237\265T\026\346CQ+\333r\211H\363\244%8rEP\344\204KD\212'\3558d\313E\"\305\273V\0059\341\032\221\342\245Q\215m\271Y\244w\327\251\374\224\322\351\001\331r\337\244wi\357\373\326p\276*\225\215M\231\315o\373\217\016j\266\207\273\304\001b\322\346\263Ao\312K\326/z\352\330}\341?lU\364\216\260\255t\215y\311l\017\023k\235\272/\374\247\273S`\037\327\250\0258\214\317\023\022\357P\002\325\252y\321\251\223\025\006\273c\312ZR9)\f\374\245\304!\225\273\032e\340\034X@\265\252\334R\366\251U\227D\271t3\361\213\025\\S\245\023\235\276\357\227\203\376\236\226\363kQ\336\367\375\224\267\375\033\356[a\036 \245\013\316\004r\316\007\303\342{\307q\237q>\230\025/\274\327I\371\371f\316AL*\347E\3076(\355\242"
+	.ascii	"\223\226\362"
+	.string	"\312i\324b\266\320B.\225W\002\214KO\005\222\264\230-\264\220K\345\325\221\213d\222\2063@\362\211l\"%\255\232YL\022\317,\032K\345\322\214\344r\211\214\221\341\231\204\321D>\241\006\02058g \263\260\222C\312gx\316\310B\276H\272(:\233I-%\bf\215f\222\304\025\363\351\314\262*\222\341D\202\240q\225\345\342\327VU\312\031V\307\244\025\362E3\371\\*\217K%\362\352h\325t\036\253\0044\223F\262y|2\231\315c\220\372>?i\240]\025:9\262W\033qw\007\017W\273P\325-O/\317+w\321\021\363Y\007\303\206\007r\253\005w\017\342\324,\017\234\365\357\373\276D\371\254\337v\340\235\365\r\024\315\020\324\217\217\365\f\024\r\333\317r\213\277\r7)\037\310\037s\023\320\262=\260\250\027\036f\242L\314E\031@6\312GH9@\356\376\020\240\230\221\204\371h)\033\0313"
+	.string	"\246\\\344\224\211O\231(*\017\321\224\314y\3310\2375\026J\375O\254r\240h\202SW\312=\272\225p\233\335\354\313\277\f\314B9\230\223r\343\250\b\237\2233W\260\207\215\370\201\261F\f\274U\312C\271\233D\t\374\260f\337h\356\352\002yH*\007\200\351\250\221@\007\2152%\"\"\222\202\224$\351\340\002\221)\032u\021\2600\312\240\021\021!\241\211a:\376C\352|\252\240\250\344\027"
+	.string	"\200\271\023{\341\330\324\311(\216$pB\345/6@\b\251\024<\331cL\0374{f:\016\334y\341\275\024\331\233\004qi2\234R\tH\372\230`Iu\r|drZQ\335\211\320\032\231\322d\276\345\036\330DQ\222x\323\007JE\201\370p\302\250\236\263\"%\347\202%\372;\f\2218\344\241\303r\274\333\3750\177\023\r5\347\022X\226\340\001k\032\330A0\330\213\177'\n\031\366e\313Cmy\324\227\207:\313\203S\023\276=\256Y(\023j\307%CC\036\361\202&\002\337\374\034\021\376\346\347\210"
+	.string	"8?G\204\300\346\307H\035B5\350\025\024\225E\203\204|;.D\362\376\017m\234q\004o\017\370e\364"
+	.string	"\334\337^\203\275A\004\344\265\317\263"
+	.string	"\b\353\016\275\037R\274\250y\355\032@\n\301\300\341\256P\376\313?\357EH\250beo >J\204\270\264\353\035@\216<5\021\037%\242\270\267\3519"
+	.string	"\365O\360\365YW\026\230\200\257g\231]{G\037\313T\330\305\016-\024~\276\366\216\364\325\205[\344\375\232t\334U\236\304\366\300\227\273\264w\252\225\225\263y\364<\234\372\240\231x\036\3200\302\345\203\bY\361]\350\035\256\026\372 \023\261\320tc\317\236\006\343\334\334g\026"
+	.ascii	"s\336\257\230\006\236U\f(>\354\362\031\242Z\334S\254\221\334"
+	.ascii	"\367\327S\275\016\275\252\2429`*L\203T"
+	.text
+	.section	.gnu.lto_cliServoMix.233.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`\222\037\335\221"
+	.ascii	"\352\355l5I L\333\031\003\223b\2354\246\360T]\2102\2272Ar\245"
+	.ascii	"8\005\343\bC\322o\220\215\323\330\031z\207\220\355\031?\243\r"
+	.ascii	"2\360Q\307\236\331\350\025\207\313E\026\r\b\344\026\261JX\341"
+	.ascii	"\341\253@j\354~\304\356-eJ)\005O\003\375\002F\003^\322\026\321"
+	.ascii	"\336p\003\362=*\306I\3042\263\335? \355{&\206\342!\t\357\353"
+	.ascii	"\346\200\036w\0373\371\236Y,\214\005,\333\235\222\023\303j=v"
+	.ascii	"\223\3601\216\255\341u\336\007T\323!5\024\367Hh\363A\373\212"
+	.ascii	"\271\275`\312\254\22654\272\216\333\216\231"
+	.string	"p\024\325\3300\223.\003\237\027\360\355//\212h\2110\260z\216U\244\265a\344F\303-\307\3148 \320-\267\367\213\231\265\202]c|_\267\027\0334\032\376$wP\270\203F\303\356\364\356ll\255\247\257]\246\341\230i\246\337\244}&\bt\347}\205,Y\263b\331\256\277\035\224\004J\222!RE\321I\324\322\255\305H{\f\337\365\013\366\366\020A\305'\211\357\3732\265\313%\226\355B\333v\346^k6i\267}\320?\357;\305\2045\357\353&\202\227\226\355\262[\007%\333]6P\262])\263\034\"\256W\313\204\"\023j\031\306\367}\237\336\214\233\177\27142j>\217\226\030\236A\356P^v\353\326\374\264#m~c3\\\206\311\360\225\307\260\030vs\321\202\305\212)\025)\244PD\2350\001U\202\304\210''\021MLK!@(}H\362\320\201\303\006\250\206\f\030\220\216\214\212\210\206\204\202."
+	.ascii	"Y\370\361\351y:\233L\236\235\2452\351\266\357Rn\236/\255\346"
+	.ascii	"73H\232\313d\231\314\265M,\026\026i\036#D6\365r\026#D6%\342\354"
+	.ascii	"&D6\035\342.\"\275\005\244\263X\301W<\372\224\n\256\302\321S"
+	.ascii	"4\272\024\243\243@\364(9~\"\216\233\200\343PHd\323j\366\320K"
+	.ascii	"\2200,\364\021\255\222\013I\226\006\264\022\266R\216\211l:\353"
+	.ascii	"\347O\177\355\224\355\345\343\242\2269d`\177-\342H7)\251\340"
+	.ascii	"\272eZ\n\241\244\"\003s\323 \332%\2756(\317\225\346\374\203"
+	.string	"\234'\265Fc|aI\\\254q\356a\217\213U\215w0C#\344k\016-\024\027\243\223\006\264\246i\233\216T\301\346bE\343\033\332 +\\\2664\240\025\256]\272\213\233\353<\023\034z\2465\344\365\362Q\021r\016\031\330\231\316\320\200V>\254\026\307\300\326Hk\200h~\244\244\242\002\246\326Fi]\324B\255aZ(\027k\232\023\001\366\316\024\3058s\310\300\324z\b\333\255\342\341\02620\266\026j[2/B\032\320\232\245\235\352K\003\331}g\036\204\245/\3645\r3,\214X\032\250]\032\343\013k@k[\033\364F\n\234\316\273\342\026\332 $Y\274\032\320\332\327.%\322\245\320pV\374\207I\275\202]k\244\002\346\244}\224g\201^[\222tO\025.V\021\374\351&\024\333\250sa\316v\005\033\332\b\rh\035k\177\314\033^\333=\361&\031\230\223f\332u\353\204lj\204M\023\347\001\264\216"
+	.ascii	"\327\033\270X\231\370N\253<b=\001\211lj\244\225\232\203\310\244"
+	.ascii	"\345\250\276\334@\005L\254\225-\3273\314\254`\327\032\311\300"
+	.ascii	"\304:\331\200\326%\314\257.w/\220I1\322m\333\"M\240\225\347\027"
+	.ascii	"W\333^\234\264i\270\366\352\327\226?P\273\222\352}_v\257/\260"
+	.ascii	"\346\032\315\354\312a\3469\346\"\270\322\2576\211TIRI\262\335"
+	.ascii	"\344C\246\371\205a#\304#\333\367}\337\246\373]}o/\367]\317P\021"
+	.ascii	"\033\005\350\306\n3\203d{\375_\357\262WC\023\276D\332\304\353"
+	.ascii	"\233M\003\351\031\316\301nI\275%\250\341i[/\"}\"\302\262\253"
+	.ascii	"\253\255\0051\206\177)\242\3349\356|\031\357\030*\033\354]\307"
+	.ascii	"\244S;\306W\235\354j\270\345\216\315T3\244\316\362\313\032H2"
+	.ascii	"\3067\330\003\275Y"
+	.string	"\311v\215M=\222\271\201$\231\245Q\274\013\310\216\224;/cQ\275\206\231\003\347\222Ji\213\242,\372\324\267\244eR3\351\b\336^\322+\311v\243\252\324\211\361\377-\327mZZ\233k\366\355y\314\304\240(C8'6\273I2u\247\361\367F\362\210.\222\245Z\244[\f\361\260S\022\355\222_\306\376\321\017\356\266\264\204d\243i\025\244`\226\3220\313\256\336RjW\252&e\363\366\362\277p\344\316\252\302\214\0319\367\313\230\031\352\334/\222\255\246\027a<\231*\357+\244\275Z\rsS\247 \343\207\336\bN\363\326\336\367\225\252\323\2124\270\317\332e\0337\\\356\033\311v\233\232y\200\002\274\275\270\210\334\335\333\230\330\325U\322xi\355:i\257\247\357z\316\001;I\332\234u\265\027\002\313.\n\224\332\345\326'x\006\276\312\324\r\374O\355\"\257\205[\356\310\375\r|\307Q!\205x$\0079\003\317\254"
+	.string	"\003\336^\375\r\327\215D\256nMc\342\326k1\273M{\n\021L\353\277\214\3337@\251s\204\177\ns\203u\221\2566]s{5\265\271z\032\rb\3019\013+\203\037V=\272\255{\202\026l\206\340\201\036\323\334@\26753\320\3167z\2609\200~\323l\243\377\370\232i4^\363\f\031\035\327\034\003\006"
+	.ascii	">\316/~\234\251~\234]\3708\267\370qf\341\343\274\302\307y\252"
+	.ascii	"\351\254\242\351\234\242\361\232\245\232\316(\272\2569\252\351"
+	.ascii	"|\242\3114\233h:C5\231\346\022Mg\022O\347\021M\347\247\036g\247"
+	.ascii	"\247\263\210\247s\223\322\231\351\351\274\364t\016\361t\006\321"
+	.ascii	"tVr:\177p:'5\235=4\235;8\23598\23578\235\241Mg\rN\347\fOg\fO"
+	.ascii	"g\244\247\363Q\323\331\250"
+	.string	"\307\271\250\351L\364t\036z:\013=\235\203\236\316\027\236\316@Og\013M\347\037\247\263\217\323\271\247\351\374t:;\233\316M\2463\263\351\314\323t\336i:/\231\316J\245s\222\351\3546\235\333\246\3637\235\235\351\334\255djq\032HF\261\311g\335^$\221\217/\326e\243\245\005\273\007\273O\350~\323\375\327\315\327\335\246\033\257\273\256\233\256;\256{L7\231\3563\375d\356:by\210byr\304\246\342\344]\320\204\374u~\204\203}Bg\333,b!\341}\327\320\245%\306a\300c\266v\346\265\352@\356T\351\021\007\226gY\3174\013\203We\302\034\223\363\301i\364\376\345\332'\304\306\227d\364M\345\372\267\345\216\"\214\376\207\232\232\306\017F\332<|\031+;G\262\350\257\256}D_\364\257\330\264$z\034jj\244\020\r;\224\351#rs\334\032\023\247\257\365\004s\205\003t\306K}\225[("
+	.ascii	"_\342\253~\246\207^\251\205B\240\320\007\375\320\177\031jX\211"
+	.ascii	"\027z\017\327\3017;\177k\251\017z\034je\256\33176S\217\334p\266"
+	.ascii	"8\204:\247!\372\036(\256@\235\313\200\3653\276\332y\275\263\246"
+	.ascii	"\030I\235\323\020d\247\212\242\023\352\\\006\246\006\340\253"
+	.ascii	":\222\027\036\006\320[\370\013\377@\377a:\370\226\366Ar\306["
+	.ascii	"\370\005\322\"\247\3317\273;\3061h\237\215\235\225\211\016\372"
+	.ascii	"\224\261\263\267d\364]O\316\027\366\347\035\033\216\357.\020"
+	.ascii	"~\237\027\n\016\370\2144\3218o\257\237\017\002\245\251\001\370"
+	.ascii	" \037AZ\3445kfl\332G\350\210hX\300[\257\361\242t=\204^\255\347"
+	.ascii	"m\321\301\fqJ\355\376\250\213\336y{a\375"
+	.string	"4\036\252\200\355z3S\222\341\313\230\304\036RO_\231&\344\324\256\361U&\3225\376\323\034\r]\025C\215\357\351\3530\313\362\367\207\235\276\226#\355\0315\327+\035\207\234\3326\276j\245m|\317\025\017\f\207/T\306\216\276\214\335\275\"\366\264\350`\327!D\243\324\256\273G\304\216\026\035T~I[D{Sj\367\306Wm|s\275\225Y\026\304\033\337\201\376E\nF\003\241\033\224\353\265Z\243/s\237!K\304\024Q\333\347\373\313\325\260\347\235\357\363F}T\261\347\367|S!m|S?\377\250L\327c\227(^\377$\301C\333\212jAf\n\234\213T\212k \301\267D\365\222\355:\277\311\024\266\325\370\3467`'\360\226e\021j\3552%\252\361\375\306\263D\335D\373\226]\275\206\325c/\243\323d\310"
+	.ascii	"g\216\276\211\006\346\365O\341a\035v*\364e\214\202\311\205\246"
+	.ascii	"\2762\r\310\251M\343\331@\2224\376\001[*|q\202h|S\337\207\031"
+	.ascii	"\226H\031N\343\333\317G\220>\301@\370\245\257-\300\035\322\275"
+	.ascii	"\026\344\n\027\276\214[\317\251D\007\207\262\313\256\356RXx\310"
+	.ascii	"\206\365\320\227\b\224\301\377\265\315\"\3633\370\216\363\203"
+	.ascii	"\371\335x\030\006\033\200C\233\357\222\3218QDo\257\037\337ym"
+	.ascii	"\241\360\260\004,\027\303\341\342\262\300\243t\021\242s\242t"
+	.ascii	"\226]m\205'\354\210\233\26711\n\024,?_6\244e|\027\371\266k\004"
+	.ascii	"\314\256\374u\215M\341\236L\271\363i\2372>\352\253\375\250\270"
+	.ascii	"F\235{&\237I\2063}\337\271\223\350b\022a\264q\331\325\"(EU\210"
+	.ascii	"\256p\030\206\345z-\246\362\035-\351\024\032\365;sT#\271'tz\226"
+	.ascii	"\337\\\224\237\374\366Z>\264\353\265\270\253\257|\246\331\331"
+	.ascii	"\033\025\362\003\017\307\234y\262\360\276\363\020\244\324\244"
+	.ascii	"*D\226]\375\245T\225\032\021\222\303C\ncCs\356\371t\221\307 "
+	.ascii	"\207\327\306tj\313\370*\222N~s\211\326\3610)\222\345\373nI\261"
+	.ascii	"\203y\222\fu\366\341|\345\f\205b%\355$yG\322\363\216$\036;.c"
+	.ascii	"9Wa]UiPu\265d\254$\350\216\252\0359\254\004\340\341*\fr\370\200"
+	.ascii	"\356\340\321#\207\006>l8yG\016\253\036.gUaU]%\331\002'\254\247"
+	.ascii	",\013*\340\321\203\202\346\240j\207\017\033V\032\\Ua\361T\351"
+	.ascii	"\270\002b\205@\026\220\037>x0\257\262"
+	.string	"~Ti\220\003Ky\225\365\343y4V\005W9\332\013tTY\240\303\365Q\325\343\253|\360\350\261\003\003\035J\326\341\304\243\207\216\247*\0359(\270\252\312\362\301\343\311\007\217\034\030<\351\270\302zr:b\253\037UWOYVVWOL7!\375S\230J\310O\223\3546\265\322\brF\311b\261pF\2203\335p\375\003\005|\244\"\243\335\030\210xb`\020\376\224\003\220\b\013\021\353\260/\264|\224?(\210PDP\361/~\350\255\355\215j\313?y\224\343\244I\212\247\212t\321\345\2270\306\021\013\001\305\273\370\2417\266\305\026%\274\222:p\302\222\234\370\026oDeCd\001\346\277\242a\230S\277\304C+\022\250g\361CY\266\354\n\2657\002\307\260H\225\304\257\370\2437\266?*\344\024\333\023\211\232\300\234\372\021\0262G\311\374\020\031nP\024\301\357zj\303H>\375\324g\240\262\341Q!\213"
+	.ascii	"\3702V\221\345\270\027*\036*\211_ \035\025.\204\352\3138\305"
+	.ascii	"\243\370'\273\362m\271\243o\271H\021\330\016i\221\342\235S?\023"
+	.ascii	"\246\311\024\217C\rN\230$\n,\036\033\305+\257~&8\005W\240\370"
+	.ascii	"\036:~j\257\345\242x7\211\337\332\030\333P\226\251/\213<\241"
+	.ascii	"v\355s\342Sq\342\235u~` \333vO<\016\265,\317\211\245`\301\235"
+	.ascii	"\251\037\230\036\333\"\345\004\352IH\361\353\342\004\325\350"
+	.ascii	"k\200(\344\232\304+\003\375\272\264\215\327(\022\357\354\342"
+	.ascii	"\247\005\r\211\307\241vB\230\345\226\300\023\216B?\275\222\216"
+	.ascii	"\237\026\366\t4c\342\351w\272\370]yz\034j\203\215\004F\021\252"
+	.ascii	"\247s$\235 x\247gR\327\360\220\b!x\034j\202\215Kh{%N\350\251"
+	.ascii	"\277%\331\3055<\200r$\236`\274\211\2576\t\213Z\250sO ~\204\210"
+	.ascii	"\021\337\364\"\226&\276\351\033L\315o\232\035\021\206:\347d\365"
+	.ascii	"\355e1\013uN\304\003\037\300W;\333;k\213h\3249\247\036\"\230"
+	.ascii	"\032\306R\210\007\361KJ\030\037\"\200\007\361\013\250\341]\263"
+	.ascii	"ov\201o\206<%\372\265\255\350(1\006\240\004\343{|\004j|\323\317"
+	.ascii	"R\006\353D\330\331(\235\020!\241\033F\007\225\b\037\370\316v"
+	.ascii	"\203 \247\210mL<\321d\004\021_\207'8\306\326PJ\2324}\320\276"
+	.ascii	"/\231\213\3041\036\311\022\fF\347\b\021F\257r\356\260[\257\365"
+	.ascii	"L\205r\350\240\240tY\372\360\206q\017\373\227\364\034\376\203"
+	.ascii	"\230\207O\352\360\036\236(\016\225I\207/\212\353c\334\343s\303"
+	.ascii	"\341\247\346\226\264\375^a\210\r\257\227\207\327^(@?\303ox\242"
+	.ascii	";j\230\206\207\032}Skx\242\025\272\036\357\2008\247|\211n\230"
+	.ascii	"\tp\273\272\f\337k\324\344\302\264\t\361\310\256#\007bMg\275"
+	.ascii	";\345Ct\347\300(}\031c0D\372\243\307\360M\r\223\203\364\215B"
+	.ascii	";\220\314\372\243o\343\002\202"
+	.string	"\224\250\022\001\031\316\222(s\210fd\302,H\2224\0062\013\020\206#Y\036\227\332\003\022@\205=*\25532#Q\322\032b\002\250\354~:d\344\323 T\311E\332\201\001|\017@\334e#\363m\345w\355\363\nu+\235\274\240t7r\022\226\007\022\323vrt\312\372\323\250@n'\320\211@\367x8\211\"(\304<*L\223j\036\003\234\024\317\t\206\237\262\003\316\007_G\b;J\005\fC\300\341\251\0251`[\307\252B\370s\321\023\267\252\211\326\2219Ly\001\255[l\332X\356\240\322n\211@\216\363\262\215D\022\035N\212\330\004\312.\031\207\240\023\244,u\305\364\264\376\302\200\342\034I\274&\246A^\265\002gG\341\242|Eg/y\304\233Lu&Z\023\227tK\016\027\251\261\2611\367!B\256:M\311\036\216\345P#<\353\330\332\217\251\263\363K\335Yo(V\200\226\3343\t\304\237\212"
+	.ascii	"E\264)\027\337\211\302\315\210h \202\240\374\326\231`s\352\364"
+	.ascii	"\177\337\321\371\247ZV&\302Y\237\372\304X\340\250\357)\246\365"
+	.ascii	"\253S\310\322\t\315W$\324\024\205rV\r\347 \303\257\221\243\002"
+	.ascii	"\013\001\330\341\250\032\241g\300@\f\226\264\315Y\001R\016Z\241"
+	.ascii	"Q\367aw\377\030e%\364\031A\252}t\302\234d\374\362\325p@&\265"
+	.ascii	"\372|W\323%\240\b\237h7\316\2261\334\214)\215\003H`\b\322\003"
+	.ascii	"\213\326d\356\034\350\244\322\304g2\356o\2326\013\323\223F\354"
+	.ascii	"\212\016\215\326-\034>'4aFs<i\353\212;G\345\364\342$4\242\002"
+	.ascii	"}\317'oc\300\202 \024T\312\030\264\220\252b\202\301\255\302d"
+	.ascii	"\301\223w\020\306\231-\2440~XK\235PY\206\304\204z!\013\007\356"
+	.ascii	"\222[\3467\350\225\233\026G\200\037\310-l\013\266\315e\314\022"
+	.ascii	"W\023T\271PgQ\360R\3438\350\016@\246\216\356'\231?*\351\r\206"
+	.ascii	"\343\262\022\033\206X\177\307\374H0c\261\267q\n\262\312\265x"
+	.ascii	"\237\344\333V\326\210\2758[E\302%Q\372\342O1t\f\210>{t\214\223"
+	.ascii	"\006\025\327"
+	.string	"\230\253\311x\252\"\320X\027[\353\222\246,\212}\224U}=\353Go\257\306\361\372\333\245k\332\320\326\tN\365v\321\2063\202%bG\205\224\024m\320\205\237gawp\031.\252\276(S\304\261\024\225.\346\225]b\315O.\305%\357L\332\345\243\364H\226\322;\220\2448\377\364\365\bg\362)\311 I\371d\262\fm\021\251(#\305C4\235\210F\353\337\206w\220iog\337\005\307\356R\017\332b:<U\214B\371\033\b7\322\275\336\373N\274.g2\230/\236\005\352\312\245G1-\244lH\245\231\250\204\0177\264t0\265F\235\355+\250o#Mj'FV\250\177\034G\322#?_\32544"
+	.ascii	"\213U\236\341\271\225\254\252\352\314T\215\256rd\200\352\244"
+	.ascii	"\313o\242\302\350\007\336\357}K\357\222\320Zj\354\207\306I\201"
+	.ascii	"\030\321\303\326\213\034A\275\264\214\302\020\005k87\003\277"
+	.ascii	";f\323\276V\371\345\0062\261\334bR\016\276ui\326\337\270\242"
+	.ascii	"]a\007\247m\026^Hk#P\275\207ah\377W:)\355\264}\202\n\205\021"
+	.ascii	"\344\262\263\264\217\243\023\376\244\363\321/\261\255_\265\370"
+	.ascii	"\t\204j\236\031\f\377\247t$\246\332\304](\252\b&\020H\246\003"
+	.ascii	"i\231B\2328t\004}\312\001\021\210\243RI \311Ag\250:Qk\346*:x"
+	.ascii	"Ts\205\t`\2716\002\244v\004\356I\323U\344\016\317\311\3355\237"
+	.ascii	"^\257\304]E\020\231\337\340\352c\263\221\220\353\205\330(=\007"
+	.ascii	"\277}\215\332ej\353\362B(1^~\300\205\031\350\335 ^\336\314\004"
+	.ascii	"\214\r\203\0368K\b\3664\366Au\"\361\030uR\221\205&\336%\357@"
+	.ascii	"\013\216 w\366\220O\363s\310\350Q\332\227TN\310\272lu\003F\r"
+	.ascii	"}\365\234\rv\317\rIeS\331_\236\355\304\372\335\334\355\351\371"
+	.ascii	"\346)\211Q\"\247x\227\026>ZVD\360x\016\300;s\214\032\253p\270"
+	.ascii	"kP-\035\270k\372\250\216\260mo\022\275\226+)&\221\334B\256\364"
+	.ascii	"n\207\302\374\236k\304\";\357\206n\001\377\226\026f\305\344\247"
+	.ascii	"\310\213\242 \\\225j\310Y\334\345x\232\177\003\366\230~\027\323"
+	.ascii	"\215g^\310\365\220\"3\260&\301\025\216\"\341\373\361@\2172\f"
+	.ascii	"i&2\\\265,\240\316\f\272\016\344\364\034\306|]i\320e\340\345"
+	.ascii	"\353\2533\350\267\253\352\312Q\200)/\261$.\322\367\022zV}\005"
+	.ascii	"\257\030\261=H\235>`\327\252\034q\326\252\275:\237\206\f\332"
+	.ascii	"\001Z\007\242\315\321<\tG"
+	.text
+	.section	.gnu.lto_printName.234.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`\261\0015\021"
+	.string	"V\342wE\360\320h8[\fyf\311$6\f\316\304\331\230%\332H\241y\250\224\024\275L\3779\f\316\t5\020\003,p\230\301\033\371\301o#\026C\343\373\243{>=\311\375\230\273J\005\027\245}9\317\212\355\266\367\2262\245`"
+	.string	"_"
+	.string	"c"
+	.ascii	"G\361\233\326G\226{\354\322\004-\030\377\321\235\363>\240;\347"
+	.ascii	"L[\001\203\326g\036\254\27337<\273c\210\017x\347\334\262g\020"
+	.ascii	"\370\260\256\221Z-\246Scw?%\361\3267\315\226\037\"\351\020e\256"
+	.ascii	"o!\256\002d-\333hwO{\302\310`\231!\222\335u\2122\0207w\333\023"
+	.ascii	"lc\260\263\013\013k\240\243R\031\3711q\316g\351\316]Oc'\307F"
+	.ascii	"\317+k\366\350J\255\261\277\255\322\330\237\375\035]\332;\316"
+	.ascii	"\035\372\370"
+	.string	"w]z\313\264f:\271\364E\024th0td/*c\334\230\032\216\365\341zN\034\347\267\177\232E\266q:\214\\\343\306\204\200^vf5vG\004\347\fA\323\016\372\234\267\3300b\263\353r\021\364\\J@\316\245\252\332\2440/z\024S\227;T\365\261\240\220\246\206\304\202^Y\3336\255aq\362\027?\273\260\213+J\217a\343\351E\231W\3262w\327\245Z\343\357\374j!\247\004\r\b\2267\354\243t\327\220>G\254\247%k\t\256\002\345\301\317\356:\260OO\221\3626\016I\257\f\214\302\023\210\362X\246\025\320$\224\2602\201+*a\200\223\222\t*\025\201\2252\225RD(+\260$\345\264\302\3013I\244d\"}!\t4Q\205,T\351C\225\300\323GR\255>\221\002N\245\204\252\217\225J\251>\321\270\337Vi\234\352\351\207L\214\271H\237'C\005\031\237\231\231\006\317\345\002\310\271Ma"
+	.string	"\214\020\341\363\322\026{\344\026\032"
+	.ascii	"UC3X\321\222\036:\215\031\274\231\365,\253A\204C`a2\370\030#"
+	.ascii	"\017\033\354D\324\\\2171\026c\232\025j\207k\242\360\260\021\357"
+	.ascii	"\270&\024\203Q\302\b`\304\227\212\007\334}`\224\242jlW)\003"
+	.text
+	.section	.gnu.lto_cliName.235.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`\"\002\035\023"
+	.string	"\346$\202H\300VQ:2'<i\274\f\002\374\271''\274\b\266\206\2772\224h2\317(\\Y\346J\317\351\004\377\332\376?\377\226\207\247\277\346\333~\322T\f\026\td\331\034\245(G\266%\274\227U\357\202]!e\266\021B\244L)k"
+	.string	"f"
+	.string	"o"
+	.ascii	"8\227\203~P:\310\362]\355\373\374\307u\240\023O\231S\347\306"
+	.ascii	"\320\234\270\027\267\224\016\032w\225\360`\351\005\302\203v\331"
+	.ascii	"JVl\346\013\202M\005m\007e\3169.\317]\007\277U\227\377\334M5"
+	.ascii	"\333\353`\213\177\242M\246\373\265\364z8\021`\263\371Tpf\324"
+	.ascii	"\236\273\246\260\305TI\023\346\234\326\232-\347\016o\273\203"
+	.ascii	"\355\013\266\252\002\244\335\035-\nLK\2334\\\233EB_\373.\223"
+	.ascii	"\333\013\236l_6.\246\273c\377\233sN\257\216\375\251\305Pmz\320"
+	.ascii	"M:\320\037~\352\005\325\372\251\037 \001\017\022\026G\361dN\234"
+	.ascii	"\362h\362@\0374\036t\373:[\264\211\353\f \007\017\033sNQ\237"
+	.ascii	"\263h\343\216\303\365\240\232\317\234\371\033#6\234\336\234"
+	.string	"\001\373\335M1t\334\024\2315\211i)\201\267\244\347\333\035\273\\\267\245\242\342^\367\241\r\2459g\257q(\315\"(8\350\341\203\276\246\373\334S\210n5x\263}y@Y\226\345W\\+\315ELK\023\320\224\233H\350r\177G\214\203\013\221\276\214\203>\241@;%B_\363\205n=\274\331a\030\365\206\3265!iW\246;\222#\222\251\221\277\001\016\001\203J\311\254X\344H\312\030\360\213\256N\252=\255R*\0203$\311$LJE\216'2F\246u\242Y\245\306U*ff$[%F\230\003f\2158\265F\032\026\2535\2128\330\277\271:\031V\364\212z\260\215\031\201~\367!(\006EGE>s\302\202\\\b\205\243\302\203\rnW\260\320r\373\341\331\200+\272\033\256\017\344\007\006\r,\246\335$\264(\260/\bIk\n# `\202!5z\033\350fp^\3509\005\006g7(\266r\222\370"
+	.ascii	"X\265\231\231\330&s\005-\210\033\202\301\302\201^f\307\230\315"
+	.ascii	"'_Z\006lDl#\203a\316h'\266\232\320\330\304H\243\205\3011\247"
+	.ascii	"\306M\017\330#\327\025yKe\274\\L\223w\232\253:\336\036"
+	.text
+	.section	.gnu.lto_printFeature.236.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`d\007e)"
+	.string	":K0\020H\200\332Q:_"
+	.string	"\311\005\350\340\237\bj\352\274\200\013\2528zE\007\256.:,I\302\247\303\354h.C\020\372\021\222\240\036\273\350o\252\b\211\255\332Ki\251\027q~!`V\227\b?m\321\276\355\331,!\233\020\271\223\f\362"
+	.string	"\332"
+	.string	"\354"
+	.ascii	"&\036\345R\246>\245\305\327\256\365ZG\220B\326\254\253\262\350"
+	.ascii	"'\177H\177\002\315\363\334'm\024\3322\277\311\235L]\351\342\347"
+	.ascii	"[\257\240\034\035(\357s\177\246\347\271?\331Z\346\006HS\027{"
+	.ascii	"\301\275\2568\310\322\326Uy\304\t\322\237<\305\234\346\207\265"
+	.ascii	"R!!\303\212R\336\254\353*l\037;\026\272\251<\337\236"
+	.string	":o\247Ss\270\024\355\335\323l;\305\037\273\031\266\365fDR\235\207\003\255hw\350\204\036]7\256\263q\325FZ\r\233\013\352\350\002;\356n\\`G\302E\303\246i\017\272q\3310\201h\017\"\341\372\262\350\253n\274g\242X0\210\334\215+\207)!\316\032\265\233\335\036\221V\366\346\216\310\370\031\343\246\231`\215\2256<$\226\351\003\203\210QE^\331\276\331\3170\243\032#R\306-:a]W\266Fd\327\331w\346#13\025\363\325\021\274\364+-\322u\275\202\300W\233\"\302d\364C\310O\276\213\373\223\250C,\327\3404\251\262o\314J*\333I\346K\370\021g\r7\017\346\0078\313\f\026\\\354?\302Y6\372\224s\321\237\374\t\276<\023]\371#x\225s\360eg`jy\310Z\026\262\226\t\240\226\007\\\313A\3272\320\265,\340Z\376Y\313\001\254\345\037\324\262\317\265\334s-\363\\\313"
+	.ascii	"\256\345\235k\331g-\367R\313<ky\207Z\326]\313\352\265\234\273"
+	.ascii	"\226q\326rj-\243\250\345{-\237\327\262i-\367\265l\257\345#\025"
+	.ascii	"Hr\306\353F\266u\205\3616g\365r\252\025y\225\277\354\237\362"
+	.ascii	"/o2\247\241\211\361\317\230U\346\223\361\315X-\223\032\202\034"
+	.ascii	"\202\"\375iO\345c\254.[\230\353\362\0022\210\221aG5G0\264\223"
+	.ascii	"\374^\363`\225\354|\320'\023\373\266\003\373\370\016\227\327"
+	.ascii	"/\323\344`:H\340\177\271\233\007\223A\210\2707\212\270?y} L\255"
+	.ascii	"\312\276\335\\\327u\275\235\274\324\005\366\003\020ZF5Y8\254"
+	.ascii	"\354\233=w#t\275{\333\325\326\345\332l\265Q:\305/\\\347\372\322"
+	.ascii	")z\341\372g\354\210V\004\333\261\274\346o)q\257%\333\233u\315"
+	.ascii	"\272q\230"
+	.string	"f-\035\370\211v\332\314ID{#\003\213M\305G\235\336F\371R\367\354\333GS\304b\266\355\263\177k\305\257n\263_\254\003l\243w\377\350d\315)\352\267m\364\254\350ee\337\230\250\337?;\t2G*\305\313(\322\306\313\354$7]\006\375\004\245\314\225\215\303?;\233\211\246\224\217\342\376d\3207;\2060\243\233#XSa\303B\366\032\020\246\bE\035b\231eI\fe@e(\003G@\335\322\231\240\206M\346\t5*\205\324P\211h\241\007\305\222\222\n\247\n\304'\251\250!Qi\307\0045\314\260\242I\352D\312I\n\226R$\t\211IC\245'b\224\212%\241\212\245a\2230\351\tJ\250 \210\235V\020\237\204QNNOBU\271~\3547\356\310\341\245\252\255x\235d\225L\267\240O&\275\267=\330\3070\037\022;\2323C\273Nvy\260\027\200\320:\212\321\021h!\241\001M \250\007"
+	.ascii	"\265\257\203\372\307\245\370%\240\201\032]\023\320CZ[]\324\037"
+	.ascii	"Q\373\372\327\352\330\026[\361+\267c\207\232?F\303\275\226]\224"
+	.ascii	"lH\263X\034\370\371\323\001\002\370\364OO\373\264=\343i_\367"
+	.ascii	"\364\217\r\200\346i\224\r\200\006\n\333\342\262\031r\214\270"
+	.ascii	"N\356\364u\024\265\257w\272\321\364\332\027l\243\367\372i\347"
+	.ascii	"0v|\313\232c\005\306\314\223e\332I-7J;\333\004\243>\3321\004"
+	.ascii	"\200\206\250q4\002\221r\304\b\211H\020M\222d8\260\002\021\261"
+	.ascii	"\242n\021\020\2555\222\315h\222t\300\266<)\363\301\n\017\360"
+	.ascii	"P\003\251N#\211\311\f\320\031Iz\237\251\210\037\342\247\310\216"
+	.ascii	"\257_y\17712\237\367!\227!\3000\242\365\232<\276\313\331\362"
+	.ascii	"\315\231\216&\221\261\034\214\253\na\301\002\207\374\311\372"
+	.ascii	"\037\226\230\201\267\220\2346H\023\023;\314\231\305=\034\247"
+	.ascii	"\202>\243Y\214mh\351\276J\355h`\025\033\"U\005$\274\0042M7\222"
+	.ascii	"-\313s\211\231b\233\020\001N\264\037\350\242.\233+\023s\366|"
+	.ascii	"\241\222\302\204\200c\261\320\273=\330\322\004\035b\242\235\210"
+	.ascii	"\322 |\241\364 \030\244\1778\221.\344C\217\203\016\343\022i\236"
+	.ascii	"\215\251\235\347\252\213E\310\215p\372^\327u9\004\037\236\361"
+	.ascii	")%\004\026\205\362\002\334\254\300\304\360\234\260\337\177a\240"
+	.ascii	"j[,\377\203\320\300\321:\006lt\376\372\243\346l\300\217\300+"
+	.ascii	"\013f\322CXN)\243\214\367J\233\035\361\234\\\003X\212\241\246"
+	.ascii	"\216R\001"
+	.text
+	.section	.gnu.lto_cliFeature.237.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`4\nU9"
+	.string	"\ndx\026DP^R\007\337w\215\300I\241\261\001\024kP\331\037,\037\\\363"
+	.string	"\210\017\372\323Wf'\225*\202\261\0048\034\232hN K\200'2\b\bpN\003\020\341\220a\033\220\241\254\216QhJ\322m\367\336I\246\024V\001=\001Y\001g\240L\200\251\256\205\351m9<\226\306\336\003\033E\243\027\307T\006\356v\023\354n\262\365\334\355k\316\306t,:\374\030\307fX\352\342\230\332\240\027\300\3566\325\221\257\273\260\013\275\3566\263\273N\200\254\370*B\264\314\363\215/\216c\246Gk\207M\300[\252\267P\313\364\001E\002\002\020\001@\016\t\005\035\215@E\342\317P\030\204\201\257\333~f\266_\371"
+	.ascii	"\241\217/2kX$\322%^du\005E\370\326\324\004\004Ps\242;h\2256\231"
+	.ascii	"\006}\222\001XI\203:\311H\341\364\013\316P{\201\255\312\324\357"
+	.ascii	"\240M\332o\213\033\343V&Y\210L\272\304\203\224\370\261]0\206"
+	.ascii	"\246\313\357\240JZ$\233\2629N7\315F\017S/\352\032\026h\316\025"
+	.ascii	"p\325\255\251!\221\206yq\314\211ciP\261\374\343w\320\"sF\362"
+	.ascii	"0\211L\032\346\302\366A\026_\021\277\203&i\177\372\236n<\r\n"
+	.ascii	"\226\203o\236D&\275\342\260W\275\255\253\352q\303\233\213\322"
+	.ascii	"\345@\"\376\026\243\317a\324\231\335\226B\237\336\265\030\315"
+	.ascii	"j\201Y\\N\274\352IiP\257"
+	.string	"\334v\371\267\013\364\276\354\361;\350W\213\344r\242\345o\236\267\242\315\234\201\031\3428\356\254\025\225z\033ywNv\367V7\254#1\026\205\3661N\206D\353L\334m\023(^\327r\267\035\305\353n\376\276\252\036\354\225G\316f)lQ9\355Pv8\027\263\002\231$\216\235\256\325\002vrH\360\002Fv\255\366\271\262,vIyfm\3379\336\243\177,8>nyX\271\257\201r\367\2232\273\026\322\3478ejv\315\277j\377\243\367\275\347\037\217\234\355\237l\364\335\313\031\331\265\374\375\315}\2104\f\nV\017\353\257\272\251W\371\317\336d\311\302\366\233u7-\005s+\0350P \251\315\235\3646o\244#\307\342n4\344]\274\205\\\316;\310\343\274\217\276\305\333\350X\274\201\334\213w\361\315M|s\377\270\271\207mn\241\233;\b\347\206\335\334\3007\367\013\314\355\002s\267o\356ws\3476\267C"
+	.ascii	"A\307\255\315[\324\314\343Qc\256\254_l\347^\237\270\027\367."
+	.ascii	"\356r\356q\356m\356[\374\355\366n\367\322nMbQ\343\3500\357\253"
+	.ascii	"n\215\217\256\207\356vS\004\246w\301\221\274\242\306\\\300\251"
+	.ascii	"W\335\032\037\006x..n\247\\\325\265*\016\327^\355a\234\017\266"
+	.ascii	"(\034\013\260\273\357n\376\326\303-9\332\270\332!\032\3213O\253"
+	.ascii	"\361\350\215\277\345tQ\352\034\223\276[\243\321\003\375V\007"
+	.ascii	"\025x\241\017\257\254s\314\201\033}\322\253\220\213k\342\301"
+	.ascii	"M\t\262^\217\034\377\254\201S\275\360W9\036\017T:\336\351\274"
+	.ascii	"%#\367\346\206\307\005L\302\335\031%F#zX\275&\220\032\017\372"
+	.ascii	"%?\267\"\360\235\213\333\221\301\007A\220\347\224\370g-\365*"
+	.ascii	"9\027\227CC\nf\322\316|\362\272\253\364%\252\177M<.`<Z\317J\020"
+	.ascii	"\265\237\342\322\023]\215\214\t\375\352A\277e\306\201,<\017\016"
+	.ascii	"\360}\256\217Z\3775\351z\033\276aFA&\221\002;Y\334!\346q\002"
+	.ascii	"\0212\360\367w\270\345!\310\311w8o\303\244\0023\325`\347\211"
+	.ascii	"\004\3562\2570\331\262k\275Amek\354\234\177\325@\331l6\353}\346"
+	.ascii	"\365O~\347\247Wo\021\303\206J0\231\2735l\370q\025\263\303\352"
+	.ascii	"5\341?\363\034\357\361\233\336\245U=M<\2701%\300\243\234\337"
+	.ascii	"\345<"
+	.string	"\315\207#8 `\347\210\020\"\362\\Y\031\273,3h^p\357\237]\335\215\203\364\355\273\237\367\236^\315\234\355\377\366\375\371w|%\377\277Q\335s\303\203\363kF\301\320\231\272\177\326A0`\323\023]\305\202\274_\375\370[6\336\374N\346\302\313\214\200\343\r\245\214\212\3414\325\001n(\253%\207`+\245\234\246\222P\313(\247\033S \210m\205 \331v\205\250\245\323\r\r\303\256a\265\214r;i\205\240\355d\005(eT\f\247\251\016B\345\r*)e\325\273\364)e\324\317\260r\222j\225S\313((\251'`?--\243\236\230\224ON2\252\2245\246\226LSK')\246\247*+\246\245\001MECY\305T\203\212\252\212iH\215\375\315:\003\217o\366\r\030z\003\357R9\272\346\313\211\231\205)\032\276\327\345\036\037\220\210\240\211\331e\375\225\200,\346W\030\354\364\246\227\030\023-\016\032\021\273"
+	.ascii	"\371\212i\344\b\354\304\221\321\244vK\371\300\031\023\315\255"
+	.ascii	"\356C\256j1\021-\b\226\250E\016}\361\267|OH\330\323\212\f\376"
+	.ascii	"\360\267z\317\205^\311\314\016\233<m\342\020\377\300\347\275"
+	.ascii	"\342+9\361\213r`c\234~\315\234-\362\"\226\007\300\317;\231\360"
+	.ascii	"\203\017\364\363I\343\013_8\005\213{\376}\0339"
+	.string	"mUd\235\3731\247HK`\347\ff\023\030CW)T\254\236Q\027[\225\241\"\003Ot\225\342$\310\257>\024L\341X\276\340\273\325\023\204\3512g\214\355\332\306q\034\013\375Y{\024!@\236\326\243;\216\327\206\020\255\247\325\330\216\343\025\n\036\021\302\365\264\036\013\300\330\200\273\250Q$\004\231s\210DFd$)H\222\016\240\002\021\251#z\021P)T\222\315&\231\306\001a\362\270\257\244\213\332\023\260v\267\262\275\365i1\327!\362X\263\322C^\342\231xB\2255\365\261#G\232\332\021\3069\226\361(\345o\371\230X\032\227^\325\315\304\237\211\006\320\332\"\213\006\355\362\310\223M<j\r\224\017\205T\231\370\222\207\260:$\367m\357\016P\3100\336Gg[\376\334g\242yo\234\n\216\351\265\271\327u\002A\200\203\302\222|\305\032]\242%\303l_!\n\203+YoK\212\266\025,\217\320f\rB"
+	.ascii	"gT\0134\020\216\024T\355odU\320!\373\365H\227'N\004\0264\352"
+	.ascii	">c_\307zLM\\\310\262\036g\240\004\276>\335\244\321o\2071\313"
+	.ascii	"!\207\313\017\343)0N\315\021`\244,\340Qh\254\270>\261u\020r@"
+	.ascii	"\267\307c\036\247\b\031\203+\361Z\362\"6\036\304w\373\355[\336"
+	.ascii	"\344\203\006f\003\221\354\3610\377\230\353\342\267\243\004\033"
+	.ascii	"\243P\307\020\302V\265:TS\036>\254N\235L\0361\261652\254\005"
+	.ascii	"\360\273\317*E2#\210_\250v\005A\277\256\036I!r\340*\257+yb\017"
+	.ascii	"s,\215X\210\022x\245gh\006\026\352`\232z\302+\3543E\254\317\267"
+	.ascii	"\013_\324\352\013\366\347\366_tD\306N\253\261\254z\241\317;<"
+	.ascii	"\334o\270A6Q\345\3663\326+\031c\371D\006\022\177"
+	.text
+	.section	.gnu.lto_cliFrSkyBind.238.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`-"
+	.string	"\215\b"
+	.string	"v\020>9@\215\323\001<x\270\nP\221F<\237\261\n\250}\022\345\224\203/\206<\345\322>\202\222gF\030\306\352\326k\004E\205\005\3531\007\273\311;Q\326y\367s\020\222\330\275S\n*"
+	.string	"-"
+	.string	"."
+	.string	"\330/\213v\312+j\01360.HVv\227\316\216\213\227\242\177\221\003\214&\321%\306aw-G\223\306=o\033\301\366\203\355U\353y\262\247\002\bKu\025\223\335\214\026\226m]'\036\031\333\227\366U_\211\017\251\370\300\356\351\203\265[\031\274\220\375r\275\006\373\225\235 \243_v\236\034\220Bi\215&\311\230|\375HH\203\332-}\224\310J\r\t\277\354\t\n\371\321/I\255Z\026SdW\222\234\034\366/\273\033\3268\\\b~\237O\bt\020~\020\002\234\327u8\236\r\343M\353:\033\345\266M\004\310\205^G\275n\343\241\033\b\242\232\201\277\017\007\322\360\373@\232\251\001\b"
+	.ascii	"2\241\203/\260\340\002\024\230w\t\240YM\001wy\321N2"
+	.text
+	.section	.gnu.lto_printMap.239.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`\307\004\245 "
+	.string	"\326;\324K\220\026R:\300\347"
+	.string	"\226\340\243J\363h4\372\342%\227\005\337V\201\004=6\300\3125\035\332\232\333\323\221\274\221\352\366/\231\266\264\335\254\361Q\247\nR\006\376\002"
+	.string	"P\035\214\214\n\362\302\265\202\214\260|gt\265}B\b!r'\031\275"
+	.string	"\267"
+	.string	"\277"
+	.ascii	"Gq'g\r\315\b\270B\255)\tm\231\217\365\035\301+\207\036s/\224"
+	.ascii	"\026\b\312\023H\217\256\037\220\036ek\231\037\334\004\237L\301"
+	.ascii	"}\257\023\226\330\275\312\006l\263\036\345 \263\224\031\025\227"
+	.ascii	"\350\346X\203\270\205v\357\3155\r^\177*\3175\033\274\255\266"
+	.ascii	"\252)z\266\r\362\025$\261\024\215D\267\235*\013$\246\023\347"
+	.ascii	"l\n\323\231\267GF#[\233\221\264\364\365)I\351\352\361\351i\343"
+	.ascii	"d\344\005\001$2\242\334\214D\213\302\030\207'\356\336{3\252\260"
+	.ascii	"\3479`\351\253\354I\220\224N\006e7\230nF\241\3553\237s\264:{"
+	.ascii	"JZ\272U)\334{\331\026\215I\347\333\231Y\213\231}\314\3470=\353"
+	.ascii	"\275\302\b?8\374\3104\251q\224?\224\036}\237X6\263\214\025\331"
+	.ascii	"\264\356\301\"\313\217n$\263\222\310\342\234\r\247\270\241\230"
+	.ascii	"kh\236\365\317\\\371\313<\371\307X\313/\347:\337l\265\207\235"
+	.ascii	"WkY\265\226Sk\031U-\237\253\345\266\226\255j\371\006.\230\031"
+	.ascii	")\331:\332h3\345m\221\306\345\222\241cT\347\372\275\376\257?"
+	.ascii	"\354'\363\337\343\313\203\235\3117f\016\373\341\210\224\267E"
+	.ascii	"*eE\005\304\027\360\274J\031\216TU\036\326\256\373\b\336\013"
+	.ascii	"\370;\274Wrr\324A\345^$\r\353\321_\001\347\361\255\340\271L\340"
+	.ascii	"\204\312kT}\\u%\321\356U.8\312\030\326G|\256\265\336\035\247"
+	.ascii	"\210L\373#\024G\023\212\326\223\363\336{k\215\3443\377\2461,"
+	.ascii	"RT\232\346\263m]\373M\244\267\256i\030\251\253!C'#\233f\327F"
+	.ascii	"\262M\027\374f\2052\370K\0371\2774Mw3U\033y\332\0259\220\\\244"
+	.ascii	"\ru\366\273\202\023\241\325\362\307@6-A\377Km}\303\321\334\""
+	.ascii	"\364e\257@\223\264Y\254r6Z\204'GD\303O\202\263\237\\\036\261"
+	.ascii	"X^W]g#\305>\323g\363L\353\211\320j\341nfFq\260\036L\324\275\027"
+	.ascii	"\347\004+V\031\022b}\220\013\321\235:\273\364\305]z\264\373\306"
+	.ascii	"\311\330\333\366\211]\212l\032\211\003\3419\020u\257\020\207"
+	.ascii	"\231\367\261\374C\200\013\322\375\250?\037\035\260\304\016\300"
+	.ascii	"\016PD[\330\001\212\260\361\316A\310\007\250\333\331\215\b\300"
+	.ascii	"\303\333\001\352U8\341[{~\272\fA?\300\021+\3538\340\371\350\344"
+	.ascii	"v:\272\035\337N\b\210\227\003\342\351~r:\276_\316A\r\367\202"
+	.ascii	"v\276\234P\257\347\313"
+	.string	"\335\224\267\352g\315\326k\037\331\250\232\310\212\332\310\013x\336\3734\201J\226M\003\313\371\225e\031\332\006\033*\030d2\366b_\346\234\313\262LG\221_\326\001\305\222\t\332\275\303\027=\254\303\236\004G\323V\233\371\003\b\373\"\343\210M\3041\255\366\327N\373RI3b\227\367R\262\203\365^\242p\226K\320\254\024\331\264*[#YeZk\372\314\257gG+\"\323rY\250Q$\243\020rH)#3\201\004C\232h\f\200\002\231:\252\016\020X\310\264I\2419ee4S\303\330\252J4y\313\300p%\240\211\351\035sthu\300\302\201g\341\331\214\374\307\036\237\321\003:\340\333\372\021\201\251\354\223|e\252\270\001\004\373\031\201\212M\\m\304\332\211\276\341\345b\371\"\023\314\326\343\020;x\301\337\240\231\200h\025\265\030d\210Wu\2256\270\3537C\037\276\023\375\211B\031`2Y$\260\271R\360\314"
+	.ascii	"\246.8]\215\223\226\301Y@\336\242>\022e\332Z\313\266\256\370"
+	.ascii	"\270gf\027\324\001\344f~\261\177\033\202]\360$ x\300\021\370"
+	.ascii	"\313H\353\256\275e7v\222\251/*"
+	.text
+	.section	.gnu.lto_cliMap.240.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`\260\007\335-"
+	.string	"zP\304\021CP\236J:\263\366=\220\257\222nc"
+	.string	"1f\006'\307\207%\305qv8\367\373\306'\001\214\355\355:\034C3\306"
+	.string	""
+	.string	"\020C\f\034x\203%\004w\221\361\021\316\217k\315lm\255\265\326\032i\204\020\271\223\f\n\001\363"
+	.ascii	"\n\001s5~\307\356q\024\226\265\271s\257\034\202\247\274`}\272"
+	.ascii	"\204\3362_\313\341\230\217\273q\240{\225`\031s\257\\\002>\260"
+	.ascii	">e\271\023\251O\327\013\251O\231\231\314u\214\274\256V\20324"
+	.ascii	"_^\366\334{\241\232\t3\377\030y=*wFQ\346\205\202\200~\226\312"
+	.ascii	"$\362h,\256D5E{\3102\371bZ\027\nrr\2405#\366G\355K!N%\312\300"
+	.ascii	"k\017\221\367\205\021A\221\206_q\316l\362[jG\242\215\021\371"
+	.ascii	"\361}aC\216bMk\374\335W\302\262>\202hcM^\034\260d\314\354+\232"
+	.ascii	"\300\315\315/HO/\310\333\302\202X\"j\235\374\t\276/L\b\n\241"
+	.ascii	"\f\220\036G\261/\253V\225\325\021D\0333{\212\022y\204\315Q\212"
+	.ascii	"y\241R\202v\314~w\013&\306eQ\343\024\262\367J\366!\364\300\331"
+	.ascii	"\032\262\367\205\025A\211\336$\241\363\273\017h\013{b-q\302\275"
+	.ascii	"\227\255Sl\354Lt\346\2131s\bfUK\026\355\264\233\360\353\220\037"
+	.ascii	"f\006\326\372\204\177\243\017ff\233\251\273\337|\343\262O>j\333"
+	.ascii	"I9\342\316\264\325\241v\247\326\235\306\377\200.yQ\206ZI\r\265"
+	.ascii	"\251\273\253\315\223\356\257\313\032\362\273\251O\370u\270e\237"
+	.ascii	"\234\264L\315\214\302\312\336\371\376\335\203\372\330\340\370"
+	.ascii	"\272Z\213Y\216\313vZ\037\031$n\334J\230\243\236\234>wnz\334\317"
+	.ascii	"\244\224\204t\273\363\021\321\262Q\3212\200\325r\321-\023\031"
+	.ascii	"-\017\251\226\205n9\250h\031\210hyY\264\254,ZN\256\226\221D\313"
+	.ascii	"\307[6\252\226\213D\313k\3212\261hY]-\247D\313\350-\267j\331"
+	.ascii	"\246\226\317\240\300\022:d\207;so\217'\237\313\227\356\261}\356"
+	.ascii	"\377\362\333"
+	.string	"\275\231\3172\216\307\013\362\236\307\237\356u\277\343\243\235\232\007k\227{a\376\013\215\337\346]\377\312\326\334\2717\314\201]Q\356\\\230\017|!\003\036\333\223\317\253\265P\303A/\307\325\251Sg\372\275#!u:\350&\313\323\336\233C#\222e\346\320\301\002\262\025\362q\265V\200;3\177\305N#s\244v\322\323<\343:\273\215f\217<\200\214Y\211\272\233\320\375\r5Q\237\315\021\241\346\327}\210\340\347\034j\225\260\371\026\365b\013\265Q\340\013\024\321\343\204\030\324G\243\003,\262@}\274\257\021\261\336\333\274\223\237\346j@\240\177\362\224C\210P\357|\312\027\241\216 a\357\f\352%\257\326\342e\003\265qm\213\230\257\303\245\006e/\223Jd'\217\215Tq,6S\033\221\272\370\374:4p&\360\212\332i\214\245\202y\035\226\322C^\036+\203[\366\231v\032\023\323\364S\247\316!\006c\275\037\365\343\350"
+	.ascii	"\273\254\341\241\004\222\231A;\3555\324\243~\352\345Z\234\230"
+	.ascii	"\346\331\332\314\274\341uXCj\367^\251;\361\020{m+\347\307\252"
+	.ascii	"\315<Ee\357$\366R\332j\007\374\202\300\222\213)\026DN\241`F\026"
+	.ascii	"\324\214,!\253\237\210Q\242\257\252Vt\325\225\325\n\023,\250"
+	.ascii	"\210L\245\300j\005\025T\025\325\324\211\254*\030WVPWVS,\240\250"
+	.ascii	"\262^@)H\342\026.\252\262\240`\264h\221\005u\224\333z\373\204"
+	.ascii	"\255\346\372\233\320\203\274\303B'\276!\\A4\320{\321$\334\231"
+	.ascii	"\263Ov\262J\307;\036&\033\221\037s\312\332\364`\200\351\306\244"
+	.ascii	"r\240\215\312\313\034)\245\247\267g\020\350\356\006\314\226Q"
+	.ascii	"\315(R\251\223\222\372Q~\364\336{\177\222:\252\225kvv\214<\240"
+	.ascii	"l\234x\002\231UV:F\355\340o\257\250\001\3641\034\220yE\200\332"
+	.ascii	"\275]R\314\314,\377c\302\001\360\273\267\313\301S\277\242\266"
+	.ascii	"\241Wwe\257\353x\024\222Y\342\265\371H\002\351b\246\3544\336"
+	.ascii	"{S\367`\234$\314E\207\031\257d\247\261=~\357XBv|\211I~\357J\r"
+	.ascii	"\306R\202M)\310%\373\274\313\261@4\373\361\306G\313\275[p\036"
+	.ascii	"\207\002W\260`-\250O\217\367\272\017\0018\200\240\250\201$\305"
+	.ascii	"\224D\250DDF$I\2224\006p\002\231\2512\333\020X\250D\223\fc\033"
+	.ascii	"\205\212\330\311)\345\350\207\364\240\350\032\023\340\364U\024"
+	.ascii	"!\022\253~\304\213\370-A\220M\207(7%\207\253\262\231\310\021"
+	.ascii	"\303\0069V\210\207\"N\306\227\273\0063\364\2721\371fx;pW\205"
+	.ascii	"Q\020elb\266\260kn>\221J\207\031\222\222\315\362\253MR\370\030"
+	.ascii	"\3156C\021\275w\300\300:\n\217\f\252=})\324\225\322TSC4l\263"
+	.ascii	"\271l\002\036\263\350\371C3\254\274E\267w\335\275\023\327\031"
+	.ascii	"\003V\235\002_}\221\003crL\361\246w\"\210\263\364qdV\360\267"
+	.ascii	"\035\272\226\002\006\353\211c\233'k\005E\347\220/\270i(b\374"
+	.ascii	"\337\245k\350>b\347~\214\t\215\240Pv\234\373gz\022\225\001Ya"
+	.ascii	"h\326\232\342z\363\356\251\313\325\212\370\276e\307\002\310\022"
+	.ascii	"\310\222\266\365\230&\2616\323i\224`\367+}Q\212v\316\326Y\267"
+	.ascii	"{\304\177\337\320\233J\366\031@\371\230\363\032\002=\031P\311"
+	.ascii	"_\226He\334B&\207\021\323\036\277\366YRQ\245\007\214\351i\004"
+	.ascii	":\322h\324\002\3043I\007\352N\372Y\343&\272\310Yj"
+	.text
+	.section	.gnu.lto_checkCommand.241.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`\246\001\315\020"
+	.string	"\026!tG\360\320&\035r6i\310\326w\342\327\213%\337\332W\343\032W\361a\307\255/Q\265\26519\213\247\372\035\340\350\353\355\037\217\253\315\252\276\215v\006\236\007\317\207\025\326p\274\326;\253\t\002\330\017k\032#\204\354-eJ\001g"
+	.string	"W"
+	.string	"_"
+	.ascii	"(`\334\332\t41\036R6\344\324\f\345\230\023\364\f~D"
+	.string	"\273\344.\242]n\317[\327d\\m\371\256k$\263\"#X\f\303e\f!ZAsb\002\304\216\030MtX\340|\304f\342H\213\0174\272\030\215n\354n\\\310>b\257\230\340F\016\320eW\233\230\214\352\2462\347\264\302b\025\356\355\266S\266S\354\343\b\227\035\344\210\004\020\322\314\272l\320\245\313c\177\3030\f\275;6\375\347\357\016\376%\2539M\275E\265\026\325R\252\243\325\033\325\272\352\007( \302\007\347\263\2449oB\036\023I\036\215\260\rcw\266\025\224`\003\201\376\247u\2209wf)\346\004Ol\302]\332\366O<q\367\3055\203\206\0160\242\266-A2\004\250\\\373;\351a\332\226\304\225\373\0325=\374\241\b/\334\234\363>~K\273\214{\033\0161\032\372\333\355\256\310\254\210\350UBF\303\036\327\214\244]\036\033\270\356\202\240\0303\252\303&\375\226\266[\033\305@\017\323-y\255\313"
+	.string	"\264\264\366\352\201\036\366\r,\252\225Tj\365m'\025J\001K\352\333\374\241\240\032|\336\351[ia\235\\T(O\205ZIy\037\013\202\207B\300+\007'\226\347\262Z\261\274\016\234\217sw\254z\241\017\260p\341'^\350\227=D\232\226[\033\333\334Z%fe\342\234sj\333vk\332\037\370w[\222Y\221\321KGU\274BP\220/Z\034"
+	.ascii	"m\204\346\315\304\003W\2366c18\001\225\301\016l\254\325\300\364"
+	.ascii	"\005\253\200jg\230\"\030\343\351\261\305\301\211\035~awM\005"
+	.ascii	"\334\210\3105\201\203Bp\031\030\001\352\336\361\223\317\205\345"
+	.ascii	".\370\324QFCY\323\f"
+	.text
+	.section	.gnu.lto_cliRebootEx.242.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`5\001E\016"
+	.string	"v\231_F\360\2624\035\220\266\201\210M\357\273f\375\f\274\t\327 \253HW\2556\325M\356\255\373G\256\246\216\302\246\333fX*\243c\270\bCI\202\033\303\335\222\r#99d\004\035\327'\352\332g\206\002\325\250\275\211\224)\005K"
+	.string	"G"
+	.string	"K"
+	.ascii	"S\245\300\241\221K\227l '\035&(2a\343\201\306\317\2343[\025/"
+	.ascii	"]Z\253%\037\023\301K\353b\241\263\n\305\021_+D\263c\306D<Y\004"
+	.ascii	"z"
+	.string	"P\374\370\315\365\203hR\005\2202\347\264\206b\210\373\272\355\025\333\f\354\223\bS\346a\206\021\031Q\202K\373E\203>\364o\376\026(\237\361\264\240\255\002uk\354[sS\330O\375 K\255\253~\t\002\324\316\314ur\346\004\261\"2G\211\303\306\366Il\253\332\013D\245\247`N\356\323#\225c\006'\036Bp|\234t\210\013\250\375\200EQ?\243iA\017P]\033B\204\032\317\331 A\323\256K]\025\036\035&\372\265\271\026}\350\003\237q\034\016\276\013w.\372\360\322w\271.\277\330\016O\214\0221\2722H/\343*O\300\212\031n\031u\334\n\026\240\344\343(h\236\n\311\363&`\336P:\013[\306mZ\205\217#\215\272l\324i\027\262\355{\311P\f\330\303\300}\031\311\363\276\214D5\237\022\263&\331 \004C\204\336\b\322s\302r\300b\003Ud4\375EH3\356\326\330\206\271@\273\001\035"
+	.ascii	"\b\002\312\f\b\303)\033v\213@\007k\217(\013h\027\013b\200\252"
+	.ascii	"\242\002\\=\034\264\246\211\346^\333\226I\302Z \b`\270*wX\225"
+	.ascii	"o\234p\217k\342c&\220\222\232<\356rK\373\251\334b.\226GP{"
+	.text
+	.section	.gnu.lto_cliReboot.243.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375 \336-\006"
+	.string	"2\013+3pK\323\001\360\244\227\303\241h\217\271\2721O\021\251\302Q[r!<_\257\246g\344\344\331\031\200\354\350WE \356U\254\267M\305\267\304\266\306Z)e\n\217N4\020!\024\037\001\tQR\004\245\350!\200Q\032@\247\362\251"
+	.string	"\222\220\232&\t\233\255\225\265\200\314\373\274\004V8/F\377\003\204U\353\253\221u\237\267\300\363\337\346\362\304\257\220f\355\347\265\220\270\036\"\224\343\350\276><\272\213dT\374\327\346\325\277Aa\350\231\3118\007\214\216\356\206L\241\225nu\325\013\235X\330\324\225"
+	.string	"t\367\327\302 \364\254\377-\377/\377\033\002\b"
+	.ascii	"3\003\236:C_\270\3175\234.\004\177\031\027\\\272E;\237"
+	.text
+	.section	.gnu.lto_cliBootloader.244.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`T"
+	.string	"\255\t"
+	.string	"f\322E=0\345(\035"
+	.string	"\276\332\t\034j\017\325k\246\221\234\235\3341\"\177\270\252\277\021\002\334\007#\230C\020\344Ch\231\3111v\204E\220\216\003#\022\325lX\245\244\re\316Z\373%\177o\231\0022"
+	.string	"3"
+	.string	"8"
+	.string	"<\300a\315\303\002\034\326\016\3764\005\037\0356\220\314\200\260\324t7\235&\f\262\004\317\254\302\037Q\025\262\3548t\367\245\250\022\341O\376\217\360\037\342\177L\377\030\312Y\362\363\246\273\373\223\365od\353\225\n\031a\027\231\356T"
+	.string	""
+	.string	"\035\323^P@\377Y\376\234\302.\220_\033\034\320\315j\201u\217\013\027yX\373\030\364\263\366R\320\330\274\351\311z\304J6\223q\314\216\177\244\002\377\326B\324r\3058\222G^\271 8\351F\261\210\341A1$\260\366ghH\026/aV\260\231\314c\206\001\257$k\n\335J\332l\351\263V\"\344u!\n\257\373\356\366\235\352=\250^\367@2q\235s\243\256\304\321\312m\023\267~^G\275n3Q\356\236\350\310\340\266\242\336\n"
+	.ascii	"2\241\263/0\\\004\244\"K\251P\b\206\\\202mVS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_cliExit.245.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`=\001\265\016"
+	.string	"\206\233eG\340\2246\035@\305\2763XB0\206\270\217P\347Iw\263\022G\214\b\033\371\200\030z5^;\3700\232\253\210\216h\366\242V\306\"\354\235\002\016\013\323\220\033\202\007\206g\231\272b\036iQ\201az)\373wQ\333)\005M"
+	.string	"P"
+	.string	"S"
+	.ascii	"<2D\266/\355\343x\016\325u\220\370\200]\326\215\235]\221\201"
+	.ascii	"QB\237\026_\200~\206N\200~Ze\0339`bW\017Z\0249\221\223dw5\f\306"
+	.ascii	"U\227*\377;\016 \254Y]\202&\354\256eX\243\342\306n[\201m"
+	.string	"\222}\032\00190\276\215O\237|\370\351\177\364\363X\200\021\211\r\0261\362e\220\274x\036\240\201\030\2733\017]B3\016N>m\021#\344C\313!.vZ?%\260\225-\256$\366\302\276\311\356\2561\226-\245/\2225R\320\240Xq\235\236]\232\227k}f\022\306\227\005y\243\004\201\2641h@\271i\371\310\214\250/\344<#\016**\3643\302\270\004\207D\375 \327!uXY\241\237\033FW\022\237\205\332np ,\222\310\356B\360}\374\307\346\333|\232\253\225~f\030]8G\004\310cv\007B>t\366\036\017N\201\237)\003k\213\267}\340\262R}\331@\317%[PK\337)\253p\201B\326\342u/[5\235T\2573\225N\034\310\\Jg\342\264\312m\036P5\345u\232\327m'\215C\201ZJ\002\177!*JK}\037J\023\211{\223\305X\036\315\330\326O\f&c\037\206\366\004\031"
+	.string	"2\241si`\270P\bn\323x\336\320"
+	.ascii	"\310\0057j\272H~\351\207\021\016\002\006\231\037M~\006\213A\362"
+	.ascii	"\255j\216*?\254\256_\230 \016\300\250KX\315j4\270\313\213v\222"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_cliGpsPassthrough.246.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`."
+	.string	"m\b"
+	.string	"\206\020=8@s\322\001\270\2641s\017\263t(\346\021\242%N\026E\251\227\310g\317\351\267\004\250\276MKq\367\305}\202\212UQ \301 \333\0302\357\246pP\327F\310&[\246\024+"
+	.string	"-"
+	.string	"*"
+	.string	"\330\245=\233\206\340b?\206\217\f\f\226\232\335\2351\344\336\325\363\237r"
+	.string	"0\365]\263\206\335\265\202)\216;\336\366\201\355\005\333.\001\266\252\177!\310ht<ffw\243u\263,\t3\342\261}\265o\362\023\357(\024\017\330U\255^vC\005'p.\035~"
+	.string	"\273\344\\ \217v)B\017\332\300\"~\366U\2762\341\213X\342\244\007/\375\023v\371\330Y\265\330x\240\264e\207\237F\020\373\327\356\256\243*\333\210\0139\210\264\314\332\207\013is\323@\017\335f\032qs\304\201DS\353J\363S`\022\304\326M\023\211\324MO\270\2776\252\334)!a\241b\2053\r\b"
+	.ascii	"2\241\245/\360\343\0024\230w\t\240YM\001wy\321N2"
+	.text
+	.section	.gnu.lto_parseOutputIndex.247.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`\360\002\025\030"
+	.string	"&m\242I\260XQ:\220\252\002\302@\300\245\211\236\2403\376\240"
+	.string	"\006\361ub\320M\371\b\004\246\021x\ngq\277\032\352\017\357\231\332\303_m\302\375$|\250c\354q(\214\376\\e\t\0325\335\002\247\3227\2507M\b!D\356\224\002\215"
+	.string	"\177"
+	.string	"\221"
+	.ascii	"\265\002\031X\201\371\321@\323\266\017\344Apv\024\006\240\037"
+	.ascii	"\237\003#\243\240\240\230Z\253\213\365\033\362\243x\033\362\343"
+	.ascii	"\3428\3563fI\216\342R\234\237\373\314\203\237\251a\264\243\213"
+	.ascii	"\r\241\242\233\377)z\251\362\r\235\0247\024\021\235\212\013\""
+	.ascii	"q\002\322\025,+\037\217\216\244\016\2510=\337\320EQ\001\227%"
+	.ascii	"`nZ\360\350\255|;\272\"\316\322\324\223\323\007$\036\200\002"
+	.ascii	"Bz\360\224\205OGiI\241\326j\332\363\t\335\252\333\036\262Md\323"
+	.ascii	"\244t\312%\245Y\373\346C\337;\367\301\013\230RZ\022\3566g\003"
+	.ascii	"st\177\366\305\272G\366\233\376\232?\335\347\201?\315R\233K]"
+	.ascii	".5)R\217\224Z\244\324\273\324T\244\376\315\200-U\222\034]jJ\255"
+	.ascii	"-\206d\252pd\322\343O\277\215\363\203^\371O\216z\025\252Wa\305"
+	.ascii	"H\006\227Z\353\202\217\226`.\265\037@\300\275\351\204\201\177"
+	.ascii	"\021\006\201\322:\265/\344Cp\007\242xM\255GE\224\004MJQB\235"
+	.ascii	"\221\033O\346\376\276c~Da*\017\365$\036>\230\274\016K\222rx\251"
+	.ascii	"A\356\317?A\212\233\302)K\315\356\212\273[\202\210>\274\243\310"
+	.ascii	"sw\013\254\220\032\0061\321\321\341.}\211ae\f@\317=\324\211\300"
+	.ascii	"\b\344\250\225\367^\314\344]H\240#\243\357\371D\224\230\204@"
+	.ascii	"\233\263\241zYd\210\373\363\351\305I\312\216N\371K\367Ae~\350"
+	.ascii	"\320*j\357\324\350{\3373\321\320m\356w\342\003I\311\356\317\013"
+	.ascii	"~\356\356\264\204q\232\262\013V\321\264rpX\254\006\254\b1\035"
+	.ascii	"\332K\003\253e\213\201\330\361\241\345\310f/\022\264\f\tn\263"
+	.ascii	"\331\353\306*\232V\016\016\213\245C\223\3356\330\230\210\345"
+	.ascii	"\3202\364\370\360\364\370\324V7\330\315\302lV\241Dm6{\001\020"
+	.ascii	"\001\343Y\303Z\262\031\314\025\203\275B\330b=4\231\213&{\355"
+	.ascii	"\270`\266\233\253\205\3005\236\230\315\325S\253\331\\+`\275X"
+	.ascii	"\367\310\347\213\2442\345a\274HBb\266n.\013\333\346\232\302\317"
+	.ascii	"\352f\312&\034:\230\274\021\254\326\311-\367Gx3\306%\3075\020"
+	.ascii	"1 `\002\021cW\036O\342D`\373\354\256\021\231\302\304\360\017"
+	.ascii	"\315,\301k\366rc\367\221\354\2665'\031\306\320\211\376p0\356"
+	.ascii	"\236\274E_\220\227\301\3514.\351\224c\207\205a\344o\236\277\350"
+	.ascii	"a\005\013\254u\267\026V{Lrh\202\227\275-\214\217i\2135\221\341"
+	.ascii	"hD\232\202\271\272\232\344[\366\025`yr-\345B\377\032@\356\007"
+	.ascii	"\037\375{MF\253\254\325@\001"
+	.text
+	.section	.gnu.lto_cliMixer.248.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`\006\006%'"
+	.string	"ZG\324\017D`\250Q\007\tU\201\306s\203\341C\320\272\375UL01\364&\216\2637\206\253D\201#j\364U\0237p\276\221\037b\3548+\0272\\\210\223\255u\347\372\221\273\266\333z\177\024h\345\332\266\333\2262\311\224\002\351"
+	.string	"\333"
+	.string	"\357"
+	.ascii	"T\331{\310\321\312\212\346\234!8\356\t\252\343\337u\333\355["
+	.ascii	"\316\265z\327\016'\312\331j\313L\316\315\b\375@u\334M/J\035\253"
+	.ascii	"\036 u\274v\343\021\020\225\215\025\264\230RO@9g\340Ki\357\307"
+	.ascii	"5\001\277M\357\334]\275\307\333\r\351rB*.\365\341\373vm7zO\314"
+	.ascii	"?$\263\232[mQ\250\2228\357\312\020\337UaQ2\261C8f\226\031\335"
+	.ascii	"\315\300\265e\212\253)\227\334\367\n3s1%6\347N\367\300\304J\023"
+	.ascii	"J2\337\220W\214\270z\223\002E\311\\My\344\342\242\204Pq0O\200"
+	.ascii	"E\211\304\342rSF<u\247$\356s5\345\225n\352hq\312d\252\331j{B"
+	.ascii	"\325\304\357\325\220\246\210\020\336T\324\265\3149z\334\3516"
+	.ascii	"9\005e?\200[\334\206\234s[\344\024\2257\221w{\210\356\036vc\017"
+	.ascii	"\001\366{\3172\266*\256.'\373f\211t9\273\277l\264\235\177\271"
+	.ascii	"\230\341\3131\273\252\332\312\371\350\310\031\3521\251\201\343"
+	.ascii	"\276v\350\213>\t\301\215\376\243\312\326\234s\240l\240\3667z"
+	.ascii	"\037#\345\346d\337Z\310\026}7\223\r\353H\177w\272\003\201\226"
+	.ascii	"E\333\242Po\354n>9\006#\230\261\377e\273\375e\201R\326o\325\215"
+	.ascii	"t\344^\336F\336\345]\344aOo\337\265\335\273\266y\330\366\316"
+	.ascii	"\273\334\207<\314[\227\332\316\245\266Ul\033\367\266\323\324"
+	.ascii	"6\306\266/\266\375\327\266}\333\216 E\037'\234\247\026\326\257"
+	.ascii	"5\263\220\267A9\r\223U\3610\367\247\273\227\177\267\213\375\240"
+	.ascii	"\232y*W\007\013\320\026 \377j\007{\352\360\301\245\325\025\315"
+	.ascii	"\271iAul\335\331\272\356\246\203Y\335\253\313<\007gV\332\242"
+	.ascii	"OB\277Dz\247Bs\363\264\0066\300\252\357a\036g\315r\304\246\245"
+	.ascii	"\036Oh1\301\203\236)\333\242Qo\364\321\3713\246\376\262\205\222"
+	.ascii	"\250H\177\0045\303\223\266"
+	.string	"\353H}\355M\251\372\376\244\205\273i\243\276\203\371\365\203\346\246\215\f@\037(Ap\n\254\1779\233\325K\321\325\312\245\036C\254_8XG\266\207\241#(\315\"\231\317\324\202\332\032\246\357\255\032\367<\016\330\364\254\203\372A=vh\340\030D\b\353H\334\377\216ol\243O?\227d\256I\271%\3359F\361/\273{\200\305\357_\016\035q\304FB=^\350\022&\254#\233\202\223\2507\342p4'\222\332\3178\031\212\253\202E\312\"u\214\0378\205L\202\377\337\037\360<V=\331\267\266\377\357Rn\355\302\313\004\325\234\241,\264\217q2J\355X\216[(\003\267\313H\035\007-\244\021\\\372\301\030\022\2038\226@\354n_\020\022_\004\211\303 \016\016\272\276\3214$\342nb\360\273P\024\346\030\212\310\265\017}IH|\341\322\220\b\203\206\022\256\225$\f\211J@\241R0FQxci\b\\\032\006i"
+	.string	"\225\212M@\t\005\232\251\206\260\b\274\301\304T\004\352\232N\376V\275\301\351\237~Y\240\230\365~)\307\211\376(\020\332\232s\rl\214\211\025\224w\207\210^\367\311\356\336w\273p=\353r\001[\3169\212\357 \3678\331\267v_\227)\357{\357\272\347=\001fV\036)7\002d\230\360\331\375r\367\305\334\357\336\351\324\341\222v|8u\274\302\f\215\271\235U\212\201\253)\352q\005\223\303\032%\022\021\256-\272_6\016\215w\364E\32037\237\277q\242Ov\232\347\276\270\302\347\260\345\336\305\374\266A\263\303\205\354f\007\266{\255\262^\371\001\rk\250Q(\345\0304J\215\314H\2224Mc`\002\22113\333\021 MlnS\320\314\001\226\206\212X3\301\356\307@\321"
+	.ascii	"\212\3453\205\341BW)\214\351\240\335^b\265\250e\340U\016\374"
+	.ascii	"\250\340\333\035W9\355\325\030\002\324jp\326\266\323\030J\222"
+	.ascii	"\223\\C8C+))\254\353U\nSF\264\034\271\334\220\331\267\330\003"
+	.ascii	"\342+\030z\341s\376\274b\003\362\231\351$\030\234\264F_'\232"
+	.ascii	"}\305\301\0249/\351+D\352\025\353\200\321\256\357\327e<Z\207"
+	.ascii	"\357\312\023\377\311\320C\217_\026i\3231\367\346/\304TA\243\312"
+	.ascii	"9\026$\340\277>\242\211CUH/\246\305:V\345W\277\n\230p\310\fy"
+	.ascii	"L\r\001:\302\341\n3\007\304\363\276F\027dl\322\306\323\246\276"
+	.ascii	"y\223#\333gA\027#\3165\340\2612\3342\351$\303o\233J\003"
+	.text
+	.section	.gnu.lto_cliMotor.249.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`\374\bE6"
+	.string	"\032`P\025DPdR\007#\350\365\271`c\200\203\251\217\237\031Vj:\365d\260\352\260b\222\004_0\003T\245r5l\b\317)4}\022\004\020\003\004\244\204\004"
+	.string	"R!\301\352\024\314zUK\242\264o\204\354\275\367N2\245E\0013\001B\0019{"
+	.string	"CV\315\360\305\352\002\326\r\016N\034Qrn\253\320\305j\230\341\2623\3578\225\324\234\237\023\336\247s1\372Y\233\361\314\225\375F\034\347\222\232s.:\333\021^g\211\253\343n/s3\243k\261\362\240\234\227\224\265\345\374|\320\016^g\373\351C\255\263\257\013\265\316\032\273\247EZ\371(\201l\232\364\322'\347\254\364M\336w\330n\265Z\255\372\372\364\356\275\321\207\002\b\001\b\032\n\203D@\240\237\257\367\272-\273>6\266\373\266\216>\024@m\314\205"
+	.ascii	"\004\255\256\026\217'\016\307t\262N\300\243\222\3611G\360\360"
+	.ascii	"\313\205A\277\372r\"8\346\023\266&\006\272\027\272\270\302\034"
+	.ascii	"\b\216id%\346\234}\n\263\b\376\255\b\226\034\271s8&\330JT#M\372"
+	.ascii	"\024&\021\354\203c\016\321\302\275\004L\270\204\370\353\206a"
+	.ascii	"y\006qw\255`f\305\211\3031\203\254\177\226\366\346j\236`\nS\f"
+	.ascii	"\267I\337\026\262\035\0023\023\326\t\272\230A\236\215r\346\250"
+	.ascii	"\353\342\022\342k\033\006\345L\331]\027\227\230\377\352\240\271"
+	.ascii	"\246Gp+k\035z\243\304\216\2539^naa\354^\31097Vnqy\013\360n\257"
+	.ascii	"\322\335=\272\335\257^\332\367j\323\017\264~W\344\312\254d$k"
+	.ascii	"\032\251\247o\316Go\"9:w\034\245\351\356\251{\363\375\312\314"
+	.ascii	"\374\314G\316\n\037\310\255\256\355\216\232\205\363>n\356,\f"
+	.ascii	"+\204]\214\247\225\b \247t1\376f\302H.g\244+Q\274\310(\006\316"
+	.ascii	"\026}\367\022\023v\245\201\307\320\251\017)\322\b\013\317\325"
+	.ascii	"\n\304\335+\236\260+\333\241svR,!\034o\272\374{5\215\326?\005"
+	.ascii	"Z\235,\214\327>\\\364\335QR\330\225\376\256\346\236\303\315M"
+	.ascii	"\276\243f\375\261\373y\304\357\325\355\023t\224\371\322\277\244"
+	.ascii	";\t\251x\264\300\327\274\211\007\f\020pq\017p-\356E\336\346="
+	.ascii	"\3643o\241w\361\016\002\035\2147\320\317\347\342\356\265\270"
+	.ascii	"_\026\267\313\342nY\334\254C\275\327\025\367\257\270\361\343"
+	.ascii	"v\b%\356\240\305y!\243\3739\317\314\243\352'KY2P\274\315}\315"
+	.ascii	"\375\314\275\213\373\027w0\356Pw\273\243\355c\372\327\206\203"
+	.ascii	"\2163L\013\027\323\316\326?g\327j\020\263\236y\353\247\226\245"
+	.ascii	"\255\254\017\211\327Yw4\367\342i\036\306\325\372\007m3k\006\243"
+	.ascii	"\201,/J\016m\024\340\001\337m43n\301\256d\337\331|\b:\325C\340"
+	.ascii	"\007|c%\236+\\\005\"\300\3026W\316\305\270\035\f\f4\274\310)"
+	.ascii	"\006\0338\324\231\326\271B\232$\201\336K\316e\264\377Thm\204"
+	.ascii	"\325j\237 .\243\305\377\357\004\036{\230\303RM\346]\341jp\n\233"
+	.ascii	"\216_O\370\007~\331=\340\023\350\375~\305\336f\332\003_46\307"
+	.ascii	"\305.\216\216\201\036fV|\357\3254\234`\311\350\213\364N\316e"
+	.ascii	"2\272\026]\370K+gX2\372&y\017\267\272'\253\201\017\276@\"\334"
+	.ascii	"\354Y\213\016|}\017\344\346f\272\026\375\367K\2536\370\r\306"
+	.ascii	"\342\216vqk\3169\367\336\253]\315Yg3\231\346\036}\267\300o"
+	.string	"\026\370@\277\354\325\375\365\3508y$\243m\361{e\177\357\373\245\215\246\030\034\023\236\247)\326\336\241Mz\307\233\276I\221\177l$\027>\322\273jX\336\220M,\\mG\343\376i\374\3548\276\003\260\207\017\330\225Gf\322,6\356\320i\026\251\373^\235\344\305o0&\347h\027G'\013\3435\021F\362\340w\207\030\201]Y\374'3=\"\325\372c\273\032'\252\223\366\241\036\361\037O\242d.\335dD\244\360\202\b\005\265$\354&#\"\205&#\"\260c\264M\304O^\005c\252\n\206\207!\007'\030PK\"\250\244\252\244\242|TUSN1\226^\270,\230\246~\206S\223\213'\326\311\305\023TS\024\223\333LIOPLJNLK*\250\234\252\\<)\271xZ\212Rb\242z\241\224T\240\245\246\234\250\224\252\244\244\250\224~\317\274\346\027\256\036\013\367\363\2706\304\276\331i\032)p\367\303G"
+	.string	"\2535\347.\013\3243\\u\241 (\035\025)\326\037\033\370\206.\f@\2361\211\222\027\351Z\316\346"
+	.string	"\240tD\202\336\253\201x\302\005\357\202\021\025}\370\313\341\367\036?Ak\363~\357=\231\367"
+	.string	"w\033\233\030\235`W\276\357D\220`\375\321\023\\I\0032D\362\341/\370\002seQ\367\204\343u\324\350\316}\037\343 \346\312\336\220\324+\\\375\003pP:\241\003L\374\365=\352|\214c\b\214P^\244\f\243\024#\025\f\235V\333\357\356\030\236\247\243\b\344r\316\023\332\361\270\235\221\254]\314\3316:\215W\260+\215WZg]\211\207\370\355\013Xf\241CR\377\f\314M\320\337\315\317\027\321/\251\256\317j\261\261C\253\303>\361\261\036d\200\261\250\201$\245\220SF!\021\031\231\t\2224\035`\002\031\272*z\021\240\265TD\2324se"
+	.string	"\310(\205\377/\201e34\016\025o@\033\013QD\372\256PI\030l\207\244\034\254\275D\201\332\221\326D\374\333\344H\031\n\340\347\231\336\274\bZ\252\244\207/_B\212@\371\233hm\224\217\375\343!\327p\262\277\n\204\311\243\340x\317\231\232c\327&\223@\244$@cr;y\377\241U\\\255\030\t\005G*E\317\353\032\310w\3730R\024x\260\366\277@0j\373g\026!\373\224H\022]\237\227\257\365^\237\331\351\323F\\\013\243\326'\223\363\262\031S\034\020J\275\301\026\223h\264|I\270\376\360V#\220\365\216|Uud\024 F\245\205{0D\f\246\360\260\037\343\205#\201\272\023"
+	.string	"}'\310\231[O\314lm\324X\303\273~$HQd\276\235\037\003\336\376\226\006=k\221+\257K\213\004*\253\314@@h\022_m\034\206Ga\n\303?\306(r5\213\031\305>^\016\337\373\243&;\355^LT\235J\357\265<\314,s \234\306\337<\330\257\235{\377E\372\306\312\350f\312L,\206\002\234\315\302\336;\326"
+	.string	"\020\322\222?\345\004H&^\302p\306\313\227"
+	.ascii	"\004\233\003t\254\376b\242\017\262\231\273\331\020A#R\307Xx\""
+	.ascii	"\002\3117%K\r"
+	.text
+	.section	.gnu.lto_cliPlaySound.250.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`\364\004\355!"
+	.string	"\306|\332Fp\236U\007\262D@\370\340\246I)\007\340\364a&\236M/\325 \232g\346_\261\005[ar\261\247\n\255\252L\031\372\b\363\270\213:\035"
+	.string	"\243\256\224\201\317V\336\370\rH\013i\243\377\211\262/\222\355\277\367N)\245\306"
+	.string	"\271"
+	.string	"\313"
+	.ascii	"\367\211\240U^\300\334\316\334NZ\213\330O\\4\200{\255\246\214"
+	.ascii	"\335\373L\300Fl\253\374l\241\265U\266\203\326V\231\310\334&@"
+	.ascii	"\324-2p\222Az\315\271\367\366\376\007\247N\354\036\036[\313\336"
+	.ascii	"j\253\232\372\274\023\271m\314b\367\020\361\324\206L\261\245"
+	.ascii	"\017\304\030\371\262\372\270\362\243\257\2269\274\255!U\030\002"
+	.ascii	"\005\352\004\255\207\324\216fqHh\364\255\313\226UWK\034^K#h-"
+	.ascii	"\trc\"\323\337\222\322\245\275\232\350j\251\303W\033\255\336"
+	.ascii	"\230\307(OY\032\355\223\036\241I\222\243\313\226:\322\240\251"
+	.ascii	"04}\265\244\362/[N\245\274{o{\265+\231F\367\032\322\275\227="
+	.ascii	"\311\224j\376i\346^\231\231\005sZ\"\235\324\275\203q3\206\354"
+	.ascii	"\250\375s\337c\216U\306\006k*\274\205\233\b?\261\026\225\233"
+	.ascii	"\265\254\255\372;\205\221\203\206\343\205\2475\026X\324\231\377"
+	.ascii	"&\253X\373Ep\235A9\035n\375\347\231\205(\274\223\375\355\325"
+	.ascii	"\035\203\313\235'\032\024\352\213\314\317\242\177\223\215\224"
+	.ascii	"\262\n\277\025\363\320N\227\003\302\365\223\356\237~6\333Z\266"
+	.ascii	"\273\232k\253\363\252:\253\252s\252:\277\352\354\251s\023y\224"
+	.ascii	"\311\f\0315Z+\355\336\031iv.\231\212\345\310{?\273\273\372\231"
+	.ascii	"\273\243\264\027\363po5\027\261\273xK_\251\3330\3168\325@\357"
+	.ascii	"\275\016\330Vyi\007\255\317\026\270[v\233\331t\232Ao\024\b\250"
+	.ascii	"\251\300\036/"
+	.string	"X\300p\353\302\034C\203F\001\200\363\304\262}\223\201~\310e\206\003z\007\023\235\332i\340\340\235\304}\237Eo\2649\357\257\316\342\241\b\310\275\307N~`\217\017\016\200\b\341\235d?sS\207\f\352\213CV\250\336\260\017Fe\325\345\366V\314\276jv\324\351\253\337c\351\267q\312@\253\264\336\314\232-*\265o\362\216KZ\225\212\240ui\307t\367\354+\303z\350\214\035\242\342\222\306c\375\246\337{\213jzc\237\311\311\006)\346\223\373\332+w\377\337W\\c~\234\331\367\363N\376?\3610\326~\367\035\302\3301\246\371\2522\246\367\336\233~\223\273\033\224\205\021\342\363V-V\335\017\271\314z<\367\314@\023\036\334T\304\203\240T\304\313 \304JE\274\025?\245 \2207\024\216\340\t/\350X)\230B\330\304#\021\004>%-\235\340\r\205\303\341\204\034\260\177LI\301\364\027\004.)1\371j\354S"
+	.string	"\\\362\365~\276\244\021\303\237S\020\330\013\002\223\230z\276aSO\201"
+	.string	"\026\236\370\r{NB\341\260\307\363\274\215\364\342\215a=\3166H)\257\373.\222\025\003)\326\002}\263q\322A\212\255Co{\345\347\3308YJ\244X\213{NW\366\333W2\037\3605\tQ\t\317\200\267\317L\314\"6\361N\256o\024\315\032\340\266o\311\020\265\204\324\020\241\260\307\237G\261\310\216_\344\002\316,a\202QT\t\231\361\213\334>\230\rb\302\374)V\304\007\317"
+	.string	"\307}\177\265\227b\250A0\344\020C\310\030!\221\021\241i\2129p\002\231\2423\017\020`\252&Ic\222\310|\232J\034\250\223)7R\002&\312T@\330\244\013\251 ^h#eI\013#\235\257\033\264\004M\277\274`\270B \255\210^\267\203H\b\235\006P\026"
+	.ascii	"\2742\360Y\230#\222\210\265@\260\005\203E\033\276\251\353\352"
+	.ascii	"\252\237ez\314\2309\021\024J\242\f\345\n:6c\235\b\361\314\004"
+	.ascii	"Q|\263\022\325\007\275\3516[J\330G\217GL5\347=\007\275\006T\221"
+	.ascii	"\253\026\241\216\306\310\365\300zv!\244\342*\213\340H\345PF\301"
+	.ascii	"\270\032\325]$\2263\373D\372\213\350\021\235\313\2067\035F[\251"
+	.ascii	"dY\350O\361H[=\273o\352i(\200\327\275\rN\315Qc*"
+	.text
+	.section	.gnu.lto_cliProfile.251.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`\266\001\025\021"
+	.string	"& rG\320\224M:\270\364\342@\273\266\343\302\205&\222\023"
+	.string	"\246\315\372\034\216!\005\357<\275\350\266t\315\260\035\217\220\201foQw\201\353\263\334\306l\r\204/\036\2407\\\222\037\b\263\226\021\003\336\237L\f\2214\262\267\224)\005\\"
+	.string	"X"
+	.string	"b"
+	.string	"2\007f\300=Z\366\002\333#\367\223\355\321,{\210\001\235\265Q\021\372\3411j\332\335NS\370\326d\035\265E\250\311\362\001\274l\216\202A\342[\311\213\347\264\235\214\334\211C\030a(HE\311K\007j\321\321\216\023=]\257\234\324\223'\212ew\235\255W\317\315\335\266\007\333*\366\213\0048\207\273\273\252>~\256\374\360\261\302\n\263\037\373I>\213\335[LC\230NM?@\n\220\b\023\257!\355\216x2\262K1\007\320g\267/\363i2^\304\372\354\303\267g\037\302\205\320\013\"\273\333\340\321\017\270G\004\360)\333O\3731>\304z\f\304Mva1\034\273\001\256\332\023\317\221\233|\362"
+	.ascii	"\027/\337\342\364\264\023pbRR B\212jQ}l\013H;\303\227o\371Dg"
+	.ascii	"\3019Pb(\b\322\236\240\307v\243\317\3200\223\224\324\264\273"
+	.ascii	"\363\026\f\267\003a\301\243a\222\350\246.\273\303v\2650\013\222"
+	.ascii	"\223N\346rS{\003M\276u=\321MjL:\226r\324\306\226\005\376wU\314"
+	.ascii	"\367r\001\306C\331K\371^\274N\345\271`X\251jb\276.\346s\201\351"
+	.ascii	"\274\025M\227\202b\231\031\325\252\253\221\221Yu)\331\315\025"
+	.ascii	"f\226\033\305a\201\202jK8\322\004\005?\273\273\342\333\370\r"
+	.ascii	"\n~\213GWh\211~K\213\211S\250(\256\032G4P\300xl\352\343<\207"
+	.ascii	"-u5S\322\324T$ `\0022t\326\003\342\300I7H+\0037\\pa&\020\027"
+	.ascii	"m\020\262\004\216\006\277o@4\334q,z\nM\331W\017\216\371\330\315"
+	.ascii	"\210\374`\033\232\320\313\252J\342\2710l\200\036\336\235Ec\315"
+	.ascii	"\212~W$RO\257n \262\374\306\332x`\r\227\340h\355\313\003"
+	.text
+	.section	.gnu.lto_cliRateProfile.252.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`\236\001U\020"
+	.string	"f\237nF\340\264&\035\330\317\350\225r=\225\333)\031:\213\371\255\322\242r\026EJ\227\371\224\363\252\212R\311\234H\377\215\321h\213\264\003]\220hR\215\031c\2141,fa\347\200V\243\313\366\026\232;\376\270\204\220M\244L)X"
+	.string	"V"
+	.string	"\\"
+	.ascii	"\f\270G\273^@{\344N\322\036\255\262\205\030x\331U\311M+fGhw;"
+	.ascii	"M\341[S\365M\213\231\246\312\007\020\256\276\275 q\215$\2149"
+	.ascii	"\f&#w\342Y&\001\307F\005I\370\222\251\316\214\034\317y\312\204"
+	.ascii	".\251\244\347f\332]'\030\316\334\334m\177\260]b\377'~F\370\301"
+	.ascii	"c\205\225e\377us1\275\275uko\375\232\245S\323\017P\202\321c\342"
+	.ascii	"6b\273#bF\326'\342p\361\327\355\273|\230\214\353\250\376\002"
+	.ascii	"\361\235\331\213hq\323Cdw\033<\372\001\367\230 \273\310\366\323"
+	.ascii	"~\214\343\250\336\n\361\321.\213\347\306\256\313\201\003\007"
+	.ascii	"9=\354\004\206\202P\350O\020\035\236\2505\266\005\244\215\341"
+	.ascii	"\313\203~\316M-\bJ\340\330d\260+\330\241}\34742t\350\001Dh\027"
+	.ascii	"\346\340\t\007\003a\301\243\263T\325T\306\366\240]+\274\200\\"
+	.ascii	"r\310\\jjoP\311\203\327\347|\304\023\024\372\270\350\312v\255"
+	.ascii	"\236\355\356\252\326\004\376w\024\312gb\341\304\333\354\225>"
+	.ascii	"\023\257Cy\247\013)\324\n\312\327\241|\247\223\316K\251t\245"
+	.ascii	"\003N\321\200Ju+))\251N\344\332+\313&\026ma\261\221rS{\002\205"
+	.ascii	"<8\002\n\242\341tS'X\204%c5hX:4\255q<\007-5\365\362\241\251\""
+	.ascii	"\231\236!1GX2\346\001'/\003! p\0022\203zB\201\263oPk}\303\177"
+	.ascii	"\013\357\213o(\210\263\353\221\f'\216\205N\241){\364\340\312"
+	.ascii	"\307NF\344\227mn\"{\201\"\f\033 \303ygm\254y\321\347\212D\352"
+	.ascii	"\341\352&\"+ol\033\017\327p\035\216\326\232<"
+	.text
+	.section	.gnu.lto_cliDumpPidProfile.253.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`\241"
+	.string	"\345\n"
+	.string	"\326\323J? O\225\016CbP\0360N\235\200/\031\377Q\335\001"
+	.string	"\230\316*"
+	.string	"\"0\240\021(Z#\330\354A\233\n,5\016 \211\002\230\203\022\315\221\340\007Lr1\030\315\310\343v\243H\213dK\231R8"
+	.string	"9"
+	.string	"5"
+	.string	"\013N<\240\030\205x\261\273\231r\370\367\250\371\371\033!\370\210]\270F\001%\r08BP\034pb5z\352I!\feB(\273\353$\205\026\356\353\266\023\330V`\377#\351x\324\257?\375\307$\037X`\370\b\027\273\025Z2vu\231\350`\373\021\033\345\271\307\202TL@\220i\037\230|?y\254\273\031H\224\330U\031p\001\354\227?\273\005"
+	.string	"Qy\031\202\204<\311O\235\"R\320\252\227B\256Q\235\243\031\237l\235\265\241%B\325\224\367h\\\237:\001\321\212\030 R\204\222e\253\300T\223\375\270Z\2623}e\0168\025\006\233\314\003\013\026a\263h\026l\030\356\322y\r,\334\246\303\232\204\303h\331\246U.\336\326\321p\231\206\253d2\315\343d\222"
+	.string	"\3566\233\227u\272\316\313\"\252\275\226L\371((^\001\022"
+	.ascii	"2\003\326\031B\341%\021\357\365\252\207\240\026{\021\177\364"
+	.ascii	"\270\215i\315\205\234!\263\245\b\303\201\022\301\b}\306\020w"
+	.ascii	"\271\251\366h`j\017"
+	.text
+	.section	.gnu.lto_cliDumpRateProfile.254.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`\242"
+	.string	"\335\n"
+	.string	"\366\223J>\020O5\035c@\216\240\tS\243QWk\300U\tSW\273\374c\374\001\260\210\237z\217\217\215ux\210\371`P\177M\250\256\352\222\005\rr\022\272\325\te\235\222\312\262\\\362\272m)S\n8"
+	.string	"8"
+	.string	"6"
+	.string	"\013JBh\204F\274\330]L?\374{\324\374|"
+	.string	"!\370xi\270\306\002\243\016\032\001BO4\240\"\025\372\351i!\374d:&\273\353\024\205\031n\353\266\031\330n`_@\351x\323\257/\375\277\"\252\013\033^\002\305.\206\025\214MY'@\330\376\3036q\016Y\217J\264 \323V \371^\342Xw9\2440\261\213J`\004\327-\177v\213\001\240iyB\205\274\310?}\002R\320\252\226:\256Q\235\241\030\235\\}\303\303\212\204*\311:'\343\372\323\017\200X\270\020\261\342\223\0336\nL%\331\217\253#;\323V\006\0214\331\203\314E\002\345\242\260Q0\0166\013W\351<\b\333&\363 \326\"\234E\3036-\253x\333\006\303a\030.\273`\232\247\301\"\004\334e6\017\333t\235\207=P{\035y\322QOTR\022"
+	.string	"2\003\326\031B\341%\"\356"
+	.ascii	"\260aA\031{i\376\250p\033s\233k8C\026J\021\206\003%\202\021\372"
+	.ascii	"\214!\356rS\355\321\300\324\036"
+	.text
+	.section	.gnu.lto_cliSave.255.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`H"
+	.string	"\005\t"
+	.string	"\326\320?;0\3456\035\200\313\275e@C\210\016\311DE\203\023\211I\217\236A\326\356\b2n\2541\007B47Jm\223#M\351a`\300@\205 \343\261\212\204 \306e\361\335h\333\275S\n,"
+	.string	"."
+	.string	"1"
+	.string	"\037\260N\375\3315\006\035\0132\244><`"
+	.string	"\354n\235$\377.?\377.\347\204'\360\362r\330]\313\360\024r\317\333F\260\335`{\f\233\335]O\224M?4&\"\237Y\355\202\254\002\354HeN:\266/\355\257\234\345{\213\306\005vQ\251\230]Q\301\036\354\324\342\t\254S,\252\324\2701K\022R\245\302\221vG\2212\226&hK^\374KEA\311\256\351\341\005fZH8\26512\344C{T(#\307\004m\021\224s\304~\216\3406\013\320\350\322\270-\364 \312.g\237-\224U-\003Ax\032\211\333*\267\201D5\363F\365s\340nB\363*\251\353\274\332\021\367\233\235(\007\004\f"
+	.ascii	"2\241\311/0.\030\034\003\315\325\024\320H\r-0\344\022l\263\232"
+	.ascii	"\002\356\362\242\235d"
+	.text
+	.section	.gnu.lto_cliDefaults.256.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`\255\001\255\021"
+	.string	"\306\341zI\340\320(\035\330iE(\217N\303\210\004\030\336\321\262\226#\240\364\031\003\374;\2272:"
+	.string	"M\313t)\302\332\037\335)\304\207U-\252\002\324\340\266\301\224\305\021C\200"
+	.string	"\f\350\200\330\255\203\313\004g\004L#:\322\b!R\246\024e"
+	.string	"a"
+	.string	"g"
+	.string	"s\226\005|\002\357\271\374\310w\017|\200\357\236]v\216\001\262\371R\271}\240\tB\232s\206\013\342\256\177^\267\352\362?l\257\177 \207{3\223M\246]7\"\303\346\006\210m\326\235<\300\330`\262\305t\273\223Q\213#\020\033\254\033\251\351\320\376s\255\261\305TK+sN+\315\246\341.\335\266\213\355\006\366c\0041\025\364\264\357\177\376\fC<;IF\261}\331\345K\027\307\376\346r\271\234\367\306\276\317\357\275\274w\325\252\352\1778\240\001\233\021t\313\331\032\345\254\345zL\"\317\305\210\227\277\375\377\330\344\024\025\327K\231\222W9k_\210\027*z\220\346,O\3569\005\274\332\357\271\t\327},<d\316\233\023B\001\277\314\267[\203\373\356\312p\354\300\025\211\250\275\200\301\351(\211\b\266/\207\350\201\276\342\001I\016\n\234!0\271g\247D=\315:T\242FG\007\206nq|r\335\0138\033"
+	.string	"\364\373\370\035\350(\"\200s\316N\203\001g\006L\356\221\023\3644]\221\016<BIF3\035\222\325v\3262\337\027\002\256(\246<\374\251\267vf\265^bP-\"K\t\331*qQ\215\255\226\310\022W\002L\252J,\227\261EE\036\020)\240X&Q5\276\260\300\244JN\241\214/\251PL\241ZVbK5\206\252\021\005\023\246V\254\020\205\200I\t\342*l\221\344*4\225\363{\343\225\231\205us\316\371\221\250\235@\301~\246\307\206\204\2678\376M\207&\305\036\367\363\334D\320\260\320\034"
+	.ascii	"\0373\240\314\200u\206\230\336\021h\005bRH\204\2139\362\231\254"
+	.ascii	"\021\026\266D\272\226$\204P0\274\3018N\260\021+\253@\026W\273"
+	.ascii	"\351\030[\3325\233\013\227\307\331\310SM\003\027\022\305}G\030"
+	.ascii	"\t\222\035\247UQ"
+	.text
+	.section	.gnu.lto_cliGet.257.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`\270\003\365\033"
+	.string	"\346\263\267I\220\330Q:\240\340\211fb1\323\373\243\340<Sr\352\240\242k\037\rv\302A\034?\003\036f\343\363#Ju\333\\a\302\375~~\376\327w\204\tH@\302\032P\201\004!r\257\223.}\205\254a\262\024\255\t!{\313\235d\242"
+	.string	"\232"
+	.string	"\247"
+	.string	"w\347\226%\230\267\264z\312|%\227:?\005\343\002\356]J2\345^b\004~`\3362\3613\362\326\374"
+	.string	"\362\226O\3460\005\200\3277a\370\304\350\212\314\275\267\326@\230\244\347i\314\222\264\265\351\311\027\372N\223\340\007R\216\233\025\301\022\2172\377\262\201\243\322\264\030\215~\365\004Fl\344\240e-\2015\206\334\b\215j\317X\330\326\263N\217\204D\224\254)\242t\233\364Z\017p)\036\271\021\002\253\002\035>\240\330\b\177\264\237u\353\324u\f\n\225N\313\013\367^\246A!\322\271\346\314\274\304\314$\230\373)\367G\201\231w\327R\201\240\351\336_\317\223C\321\325?\3352\217\005\371\340-\237\005y\373F\362\002\02355D\217\215\305\005\024v31\023}\264\247i,\214{\211\031gv\253\263\354S\377\315\261\316fI\222\224\255\245\\Ou\356S\246\225\362sx\316h%\275k\313\2755\216f\256\321n\0219\326O\365[\275\231\317\374&\374,\266\301r!C\310P\212\006\363\366\257\372\025\3330\263\325\213"
+	.string	"\367\353^(5\324\n\273\227\230\301$\236\311y*\266\362\213t\037\243\3130J\330\275\001>\344\203>]\302\013\026\034C\364\370z\357\275d3\361\263\376\0357\244h\324Ys\355\262\311>b\376]\220f\343\264\216S\327\221Z\b/{\326\262\243\"V\321\016\"zTr\200n\350\220\304\370k\037\033\240\314\036>P1$F\242\366q\016\335\271\254\231A\204\2002\022\240\357;\371\025\0219`\367\026=8\302,\342\340\240\204\t\372 \377\213\330\021\343\253\274\230\201\335\373{p\213\212\254k\234\274\244\004\225>\246\312\220Lm&\206A\322\356U}\371\3211\226\321\233\276\341\350\203\264+\364"
+	.string	"\266\217\231Q<J\216\001\330\r\214\323\331v\264\237\034\220\255\305\256\003"
+	.string	"\246Y\240\0055 s\007\262\265\350\240\237\235M\247\343\371\374\340R\334\204l:\031n\227\003\372\321\335J\276\361\344\200n5\334\315v\242\207\023\332\345j\273\234MW\273\365\202j<:\314[\201\353\325\204x\274^\315\206x\177a\250\211h\270\001}\223\177\235P\263\2463\312,\372p\016O\251 bct\252\212W\314fb\256d\331\275\363^"
+	.string	"\024\003U6\023\003\310bq\372Y\177\022W\324\031\312G\\-\331\277\372gpE\025\351\316\313>2\333\266O\261\266\355\033\235\271\327\213\347\222\372'\306\020C\250a,f\030\"\304(2\023H\315T\220\266\001P\002!\344\340|\020hj\264\311p\021\201\232O\263\361:\023{\351\265z5\001\3061o\231\002\003\233&3\221\255a2a\361\315\350\316;\201\022U\345)\221})\250\202\f\344\205\022$l\244Y\353\247\3622\303\322!@\261%\331K\244\345l\336-\b\220\r>!\007\355\307j7\225\237\025\022\207"
+	.ascii	"`W\352\302\237\303\206!;TJ\372N\220\204}:dl\355\346C\262%\224"
+	.ascii	"\343D\336\240\345\034\220\326x\374\324\257\265S\331v\023\f~"
+	.text
+	.section	.gnu.lto_skipSpace.258.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`\323"
+	.string	"\345\013"
+	.string	"v\226Q@0o\223\016\203\002\377V\217\374\nw\032^L=`H\254\"\233\326\340a\247\204\317E7%\034!o\213PL<\020\256|M\274DJ\322P\310\242\301\214\352\353\206\207L<\026%\032\331{K\231R="
+	.string	"@"
+	.string	"?"
+	.string	"\360O;\330\245\365\3474-_\302X\2008Y\310\237\223\256\016\b"
+	.string	"\331\3456D)&\377<\261l\223N\204\310\365\2377@\t\251p2\221\247\304`w\235\234,\303\ro\233\262\215\300\276\202\332\257\327\356\314\364\245\310\301\305\310C/v;\243\225=y&!l\203\330\031y\315z\200]\217\246bw;`\003\226\277\227\274\004\210-\305pi6,(Y\271\200\002\306\356\026\275}"
+	.string	"\374\263\\@\251\230m\027\370\007\274\236\304\211\026\025Rd\337\004\205\017\313\007\337\202\177W\t\013\251`\0324nw\3279\301S\241J(\241\221\205\021\233\034i\n\320\225\251\222\330[Hnx\020\245X=6|\017\025u\271Lp"
+	.string	"=i`\036L\221\2328.\025\345\321\201\211\035\030\016\bq\252$D\r\002\316D\240\252\350\221\311T1c\333\253\307v.\365=\375\n\321\310\211F7OI\374\317\337\001}b(T\273T\r\024"
+	.ascii	"G\b\\\324!\250\r\275\017-D\226\005 !\241\f\300l\024\210h\271"
+	.ascii	"C\261\313\226\275\2331\022\312\336?3\024*KpK\237\252e\240^6\t"
+	.ascii	"\363\t"
+	.text
+	.section	.gnu.lto_getWordLength.259.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`\034\001}\r"
+	.string	"\306\331\\C\020\217(\035\243\323\"\242\037\036: H\030\325\304`\345\342"
+	.string	"8\235M[\243\002a%\375\3505\370j{\375\321r\304\020\024=\366\321\rf"
+	.string	""
+	.string	"\340U\304\274\254\006\0234Sl\322X\017\335\b!{K\231RJ"
+	.string	"F"
+	.string	"I"
+	.ascii	"\006\t \205^\020`\301\200r\"\306\256\247\351\212a\202\036\241"
+	.ascii	"&\310\327`\255V\224\272\320#\304H\247\017\034\035\t\202\264b"
+	.ascii	"^\236"
+	.string	"z\232\272Q\302\020)\327\247\356\200\245\372J]\312\023[\260\273\316R\247\341\276n{\263\255\300>\027\031\247\263\267\374\330\275?B\230VM\347\275\373\032\332\312\205\rW\301\330=}2\226E|\001a\373co\330\236\013\004\231\366I\234\345\363\026\223\003\330E\241H\261\353\031p\201\354\321\336\003\\\217\331;\256\307\003\t>\001\377\tFE\006\315\250aF\205j\262m\217\227\\\251oQbe![\366MT(\311<\200nr=\246b&\325g\342 \202\273\273\320\240w\\P3\212\261V.'\"F\371\251\013\f\251SU\261\275P\202th\305XQv\017:\r6$\"W\207\003ac\260!\021\311\254\371\340D\320h\233&d\303m#\035\216\326\341\204H\3204\034\005\355c\200=\0236N\033\361x8m\303\333+\312\206\020\3523\365\020\351\310\252\231\036e\206(?czU=\0311\312/\252\212\237\n\027"
+	.ascii	"^\b\314\365\020G\364\370\332\365\376\207jK\313\002\220\020Qf"
+	.ascii	"a6\nD\264\334a\323\352`\214D\237\205\300\b\030\007\206\005\204"
+	.ascii	"\016T\270\270\245O\3252P/\233\204\371\004"
+	.text
+	.section	.gnu.lto_cliSet.260.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`\002\030\335s"
+	.ascii	"\252\302T+K \320\322\031\016\363\026"
+	.string	"t\310\023k8\252\017\030\005\317>\256\352\226\223k\235\234\036.\346\316\360\004\177n\001\313\263\335\236\243q\"\206\221AD\253\013(P\252\267\352s\020\233s\2718\341\360\344\270I\037\216 \0062\330\376\264\211\224I\006\243\002q\002\246\002\034\304{,\036o\332\372\334\236.\364\034\266U\205\350\236u/\245\253\362;\277\235\277\316\357\367\317\360\367\375q~\275\377\315\177\367\253\371\321\374s\277\334\017\367\217\371\331\3760/\332}\340\016\350\232\035\300*\30457\177\213\364\353\021\246g\rn\316\236\316\"\375~\024W$lkXR\334\341[Z\341\n|\207s9q\200|\355ZGx\256%i\036\237\366\225\260\246\344\353q\353\206\316\240{y\373==\021\226[l+\230\362/\220\215\007xo\260\206\316\002\317\360X\263o\263\310]\273\263a\376\356\203\345\020\266\365\253\350\f\260p\345\340\3704\311W\032\323\354\353\324`!\317"
+	.string	"\331PpD\263\24733\267?#gf]\300`^.\310R\213mU\001\350\354\2570\255\360"
+	.string	"2\373\270E\302\201"
+	.ascii	"\206\370\254R\300\305\354\337\026\371t\214\b\317'\225\032\307"
+	.ascii	"\247>\227\341n\213\004\3636\346\303\220\3605l\275\thO3\031\307"
+	.ascii	"\247\313\"[\t\311\225o\375\027\3403\212\340\272\262\245x\272"
+	.ascii	".\216Oy\367i\1772\257V\302\211\326\325\211\2273\353\312\266b"
+	.ascii	"Q\034\237.\333\217\214O\217W\032\237\3562w\357p\340Z\265`<\307"
+	.ascii	"\232n\205\353\272>5\224\335\365\331]\243G_d\3732\355\210\224"
+	.ascii	"y\247\022$F\210\b\321\264\004\361\201iI\311C\007\016IHGF\312"
+	.ascii	"\"\242\344\220P\320\006$\320\317\321\307\230\026\233\231{ 0\255"
+	.ascii	";\225 !wF\t\217(s\021>P\fLq\276\315=D\223\017T\030\334\227uo"
+	.ascii	"\f\202\357\312W\025\376 G\215\231|\240\236\204=\277\004U\362"
+	.ascii	"\363\2606\207\326A\307\331\241`\3329|\361\322\205K1I\316s\374"
+	.ascii	"A\375\236GZ\213\302G|_k{S\330\350"
+	.string	"I\230\224+\317^t\006\003\023\371@\355\375\201\263@6iP\2620)O\372@\205\275}\350\312\227\013,D\246\315\030\007Q13&\311\276\226\030\223Md_d\212\033\2125\236\\\2424\2301v\277\362\325\002#\371\276\342\212K:\026\030\350\314S\330\361K\353B\026V\346?Ee\2222r\316\367e\246\250B\016\026%w{\323\225\257$|,\372p\251@\345|_sE\031\206\202t\177\353b\0374\261\033\377\366\342\225<;\"s\340\300\304\236rq\261\210b\354M\221\363}!)\036\315\320\304\016\022l\213\273\210B\020M\rB`D\212G*Pq\336\355\354\005\306\305\354\003\265\256\353\262\023,\354k\342\273\035cw\335\354\032\301\t|'\216f\270C\261\026\277\321\r\264O\234\035\273\256,4\370F{1Q\340;\031\350\233\371\241\210\331\tB\005O|)c\345g\3607Zm\253#\203\t\370\326\031\025"
+	.ascii	"c\256\300w\336P\302\031B\367h\21459<v\331\016)1^uj\230\256\327"
+	.ascii	"\213\366i\004\362\214\355\263l\002;\231F\212\227\262L1f\222$"
+	.ascii	"\306\247\306\036\021\005\311\020\216>\317\023-2\237.\023\301"
+	.ascii	"\370\242\257\372o\317\340\254\016a\327\230\013\336e.a\272\300"
+	.ascii	"\2064\354\021i\255}\342\264\255z\227\331\204Y\266,v\332o&\036"
+	.ascii	"\317mt\261}\316\376\346\232j\210ptUp\367\313"
+	.string	"\360\0263J\222\037\363\354\330u)\314)\314*4\230p\265\026\032k1\261\260\020\200W\246\226\025\321\356{\311{\323Em\217\bB\t\277u\335\272\363\310\3670\265\2740[\327-\031\206?dn)^\312\323evq2\277\030\237Z\365\343\236\343\257N\324yd\bG\233\311\274-)36\361\305\274\220\271\226d\266\256]w\032p\354:\022'\004\022\340;\367p\206w{&\360\372\020\323.[\024\2272r?qO\203\232G\352(e_B\247r^J\206p\224\221\370\n\357\212?\f\007\203H\305Iw\331\222`\264\321\315\245\247J\033\235-6\334\267\215\3468\315\304!\034\335%V\240w\027h\200\357|\337\355_\"V\267B\005\267Zk\227M\213\273\254oO\263p\333\311\356\307|\257\016\367\265\352\361\273\357\224T\324\006\032\334\357\213\301\353|/\270\235\257\005\277\363\235@\307\343|#P\362B\220C\311\353"
+	.string	"\216\006.\367e\340l\337\033\017\363\265q\265_\201\317\360\255\361\276/\215\353}g\374\315w"
+	.string	"\0311\256\346+"
+	.ascii	"\214\217\371\276(\342\r\200\210\327E\222\267\305y\0010\342}J"
+	.ascii	"\362\262\b\342]\021\304\253\"\2117\005\021/\212$\357\211 ^\023"
+	.ascii	"A\274NI\274%:\360\222H\362\216\340\300+\"\2117\204\222\267)\311"
+	.ascii	"\273\344\300\013\"\211\367C\021/\223\222w)\311\253\224\344\365"
+	.ascii	"0\304\333\001\211\227C\020oR\020/\022\022\357\321\021\257Q\222"
+	.ascii	"Wi\304[d\304K\224\344M*y\207\216\346+\364\271oP\020\357\206$"
+	.ascii	"/r\210\027(\210\367g\210\367X\304\353C\304kL\362\246F\336\342"
+	.ascii	"\020o\013\361\006c\314\3268\215*\303\303\320\251\203C\\{\320"
+	.ascii	"\234\211\240/\347\351\230^\031\263A\244.[\241\030\232\t\355\005"
+	.ascii	"\350Q\227m\004J\224R\355d\247\247\226d\257\317h\257\357\035H"
+	.ascii	"\313sOsN\031\365\243\347i\330\234K\262\231\017\320^[T\n\360\243"
+	.ascii	"\345\351\2469\227\334c\031c\264\327\214fj\241\030\332\362\226"
+	.ascii	"\232\251\337\306r@\236\304Eh\247L\334R\033\005\363\020\241j "
+	.ascii	"N8\202f\264\367W\021\303C\245\350\3072n\221(F\013\300\315\317"
+	.ascii	"h\251>\331Y\240\036+\225f\264R\027\235\025\3165\023\177\212@"
+	.ascii	"\327\024u\331\017\027\341a\033\235\024\367\320Q]\004l\322a\300"
+	.ascii	"8\272\303\030\225\f\337\351\241\227,\346\001&\026U\316\370\264"
+	.ascii	"C\027\021\275\224$\365Qs\350we9~\335\030\221:\251\337ueF#5\207"
+	.ascii	"8q\334\246\312\r\271\021\nV\300`\324\271+\353\b\341\214\245\261"
+	.ascii	"\261\f*\0325\215Z\247\332\031\237\036\365\367\376\344F(8\366"
+	.ascii	"\\%\276+tDw\254\246\2729\0343<~\252z\177\343\227\246\016\376"
+	.ascii	"\310\b!\234/^\214\372x\267\361\225\267\007\252\306ezk2\007+["
+	.ascii	"\250O\2153\325\312\036:\273c\327L\\1L\274\f\025u\327\320\246"
+	.ascii	"7\207\267\250\177\307\363\213A\r\374\0323-\352\340\225nY\260"
+	.ascii	"\024\365\361\350\250\251\301\023(\324e\273M\324\317\323\206\267"
+	.ascii	"\305\206t\030M\375\253a\246\002\262\0255\360\205\237\212\207"
+	.ascii	"\253\250\203H#\204N\306\322\236R\231B\324\027\314\243\001\252"
+	.ascii	"\226\354\251.\3125\023\023`\034\204*\224\357L\366\333\374\b\356"
+	.ascii	"p\215\311\376\272\277\210\235\233=\250\240\026#F\351\313\013"
+	.ascii	"\352\262=\335\357\202\335\335\035d\216\026j\257-\"atP{\235\356"
+	.ascii	"H\300\347]s\016yl\240\366\342(\3130,\241O\226\241$\271\220\201"
+	.ascii	"li\\V&M\226\235\354\235\343\272j}l\317\304D\353\231g\205_\330"
+	.ascii	"\335;\377\030;\327\023O\035(\246a\302\305\211\013\300\231\214"
+	.ascii	"C\355@/7\221\020Y\365\220\307\200\370\244M\361\022\246\226 \256"
+	.ascii	"\032\270\214\245\2650\324\257\273\223[\r4\214=\203\240\244`\270"
+	.ascii	"aC\377\364\0069\f\364\206VBl&\036\217\236\031\234 S\034\331'"
+	.ascii	"k\243c"
+	.string	""
+	.string	"\377\364\261\325(S\213\357D\366\262\253\265v\211\217?-\001\223-$L,\205bL-?\2237\207\013\033\341# \364k\310\263\003\345\025\212p\030S\313\013\006\313\321\247{\216?;\204\316#\335\367\007\346\r\250"
+	.string	"n\200\213\331\fK\365#\312*h\227SU>\242\204X- \264K YK,\022\310]\022\260\304\"a\334\345\f\254\035VUYYTX\313,+\252\253\253 \b(\243\262\242\246\212\"D]]E!\257\262 \360\021%\304\030\002\325\224\325\002\025d\rMQ\361\220\312\212\372\341\223NQ\355\260\212\342\201"
+	.ascii	"U\020\037QB6\360\310\332aE\205\203\352G\324\003T>8\210\252\272"
+	.ascii	"\212\022R\344#JHW\335\212\312G_ey\360\001UJeU\345c\352\207\224"
+	.ascii	"\317J\261\250\362!\365D%\025\325\301\025U\226U\325\223UU\324"
+	.ascii	"\217'\251+\254'\026J\013\304\003\252\253\247, @\256\236\220l"
+	.ascii	"\253\341\241\2064\221\033:\005a\005\304\324$n'\212#\323#\342"
+	.ascii	"\263\213+1\327Z*\013I"
+	.string	"K\216]7sB\033#lP\301\255\245\"O.$D\364\350\324\360\207\275\016\003F\007\340\242\003HtQ\034\321e\013\243{\364\317<\315\223'\247m\216\2305a\260\314\211\b\341\001\253/\250M\236M\3745|\250\226\2210\203r\354\372\032\222\314\013\223\357\317\026\347\fM\234\342B\374G\266eO\005\003\365\3270\241\032\005\204\212\005\251\315\nL\240\202-\270\225dY\367\"&&\3635\212\321[<\212\321\034\005\315\t\315\271\017L\3462\332KF\253\310\362\344h\266\002\235\001\372\245\025\256l\353\211\327\035J\213\021\215i\306<A\320h\036U\346\2740\330\367\017\320\265hsni\203\276\236\265\026\232sH)^\243\275\030m\r\2619\267\244A\203\260\033\244\202\204\243i\324\350\026\335d\021t\213~\021=3ms\3060\251x\215\336\240\207\342\242\321\256\261\026\007\2405\350b\234*V\361\2553\352\250\242\242\361\235"
+	.ascii	"\030\345\211\036\356q-=\3652\036u\315\007;X\364\023\2136\346"
+	.ascii	"\211\342\255\350\024=\001\327"
+	.string	"\271\212^\241\"E?0z\247\227F\251\313z\031P=\243b\251:\321(N\264\3210\372\305D\227h\013:Ed\2476\341\324Ju%\372\200g$t\321-o\242h\036H\364\262\237\n\247j\3511\242I\214hc\235h\022\021\035\242/\350\024PD{\320\023\242\377\367\244<Q#w\277\234+\353$F;\3642\0345L\220\022~?\214OS<g\236e7u\n\250c\331\306<\211\204{ \372Cc\320\251\236\256,5\032D+\2715\023\247X\250\213\372\205\357\374\320\247sF\002&q\320\356\234\330f\317XX\246\216\303\336\262\035\035\274\345<fc\245\315\262\233\257\255Ya\263\333\004\245\245gm\212 \004P\rA\001LCG;\211\r\nB\005\223\236\254\006\310\003\201\326\250q$\344\224c\246fFD$IA\222\306Q\005\304 \006\2413;\0210)T\020\315\210$I\222\326\202\026(\300/\001\251"
+	.ascii	"\352\220\347h\365\0200%U\263\266\257\262M\304\314\375\226\310"
+	.ascii	"\232\360\256n\360\226\202\364\005\247%\001r]\202f~\325\200\204"
+	.string	"N\025\316\336\342Ph\215\250N\035\321/\300\244\220Z\375\221_q\336\225\013p^\265\305z\265\215\213b\301#\007\217v\201\253\"^q\374\024J\357k\340\b\325\3554\256\254T,(\rd\314\237\245\261^\210?\244\0038\235\033O\302\274A\214\025P\002\306I\237\211\255i\222\ne\212d\304h\311\301<\362\360\231[K\315\002\200[\272,\346HKi\224\232\007{=\346\256\271\301;y\247&\213\320B\001d\003\345K\361\274\320\337\246w.Kh\360\254\375`\026\245c\244U>\301e\356\026\310\244\263)\024\027MN\213C.\2529\301\317T*z\264m\373\022\367\332\026(\272\006\200DT\007~w\341\213Z\nr\225\001\340\254\267\3656\370\020\254\263\306[\233\344\300\346\023l\301\260B,%\024T\250\221Zj\t\230\316F\266Hj\032\206m\217\260!,[\370+\231\337\036\212\264\215\241\254 \023\330\216\352\b\333"
+	.string	"i\037\221\024\311b\354\344\226\247z\027mS\321\371NSWiD\243\236j`,7\201\260\021\006w\256\227\r\320\004\0161Z\020W\007\243\234\340oi\nd\0366\313\311\351F\315\230W\255\033\243\365\034\275\026\223\023\021"
+	.ascii	"h\256\033\035G\210\345Q\234\257\337\236\371.J=\243\272\0139Y"
+	.ascii	"9\207\207\030\277\030\b\355\367\213 \373\200\345\f\315\320\347"
+	.ascii	">\026f\226\204tD\\*\017\3014\300\017\230\030\255v\222/te\277"
+	.ascii	"0\033\344j5';\007\211>4\347@\216\361[\366\006\027\307\227\366"
+	.ascii	"\354\242\006D\027$\243w\b\241JE\241\217V\"g\211C\031\006A\304"
+	.ascii	"\347\001(w\201\374\035SrX\211\212.uX\257Pf\303\344 \274\217Z"
+	.ascii	"\3203\245\31636\"\241\b\306*$ \330\342\355\232xG\021\026f\333"
+	.ascii	"q\21523|\323\242<\301\350\217`?\211\324Lv0\244L\016P8\360\016"
+	.ascii	"\221\025\360\363l\324=~\3133\003\215\037j\023\211\017\t\342\026"
+	.ascii	"\200\340\226Xb\377\360\241\026B\324\300^\322\003\224\200\252"
+	.ascii	"\310\003\216\017\314\256\220\334s\026\n"
+	.string	"B\327\033\265\302\314\004B\001v\224\205nm|\036\355\b\035\n\177=H|R\210 \004_f\034\007w\275\345\3431t\343\302\242\022,0\226\021\352D\327m\3414\244\261MH\266\210)\213\302\245\337>A\330O\222s[\315\333P\341\"\346B\251\361 y\022\337O\031\236#\240\341\246\263\300\027R\005\312\037\001\025\233\031\250\222\003<\337\245\274\316\265\342\330\215\026\245\306\375\274\342\350\214v\030\317\177\025A\332{\236\213\030\274\nXt9ck\005\320\225\275;\361\350\257\215\027\314\027\335\005\0065\374\215W\234\034=\"\201\207\230d\356\324\r3X\036\"{9\307\302\r\007\373#:Y:\250a\264\313\262\335o\203w\366-\321RW8P,\336L\217FYp\250\313m\222\0263\177\322\025\303\2654\206\275,\266,\033}\3630\302\215\256J\020\354\346\251\250 \342~\215Z\332q\203\235\372\325\242[\225X\310U&\027"
+	.ascii	"\276\001\020\220\023\006\252&L\3471\373_\257\200\207P\274\023"
+	.ascii	"m,\335\346\241\347\316#\021\tp\274a(\242\006"
+	.text
+	.section	.gnu.lto_cliStatus.261.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`u\017\205T"
+	.string	"\n\225\020!P0\322\322\032\003MI\"\314b|\276\003\"\276\\JO9\3364\274\021(\300\031|!\336\367%\363\242Dh\250\331\267Ry\367\355rI\276vU\3334g\346\352\f\261\353\025+B\271\356\035o\217e\344,\3405#\016\326tb\020\312-\245L)\245\364\001\335\001\003\002<\316>=\316==\316<<\316\275\235\363\272:\357\350\234y;\347\335\316YguV{\316\272\3259\335qFu\316'\317\371w\316\276s\356\f\212o\224j\306\316\300\236M\330\233dN\316\333\206\242\241\320l\335j\335k\335h\335f\272\275t\177\351\026\323\rC\35307\032\346\26159\211\003\366A\f\3342\364\031\346\261\222"
+	.string	"n\257\031\213\2709\223\323,\252i\320\363\246y\273j\315\331\234&\005g\334i\314C\353\035Ib\306\243\313\270\315\230g\006\271s\203\244\271Cm\324[\254\307zL\2231\217L\227q\033\206!\375._\365\355\214L\223\001\265\321n\236"
+	.ascii	"\323a\334\026\303\001\013\025\366>\355\216\204p\206j\001\263"
+	.ascii	"]\377\244_\212\360\216 \221\241\206\365\013n{\361\200\215\n{"
+	.ascii	"\253zdN\334\300\342\274o\230Q\243\254\2446\312\236\355\314\r"
+	.ascii	"\326\\\334v\341\203\366y_\023\270\230\275o\030\022\027\251\215"
+	.ascii	"rX\007\245\215\252\375\2236\312.\363\033!\251\367I\200\263-S"
+	.ascii	"cq\336\367\005~\027\0031\252\3533\254\031}\267\203\200~|>=<\275"
+	.ascii	"u\207\267\323Qu)z\276\273\334HYl\230UO\035t\352\244\222\\\351"
+	.ascii	"4T'\2342\342\232hMV\305\201\242XY\351\237\324\215\223&\030\034"
+	.ascii	"\024++\355\243\322>T\246x\217\224\346\221\242\345=(VOz}B\226"
+	.ascii	"\345;\272\002\314\032\265r\203\243dC\006\313\222\346\245\200"
+	.ascii	"b\205\325;/\252+\3279\213\236\320 B\343\260\265C{Q5q5\215\211"
+	.ascii	"\353\372L\247HC\205u\262\357\373\362\252\246<=\005\240\342\205"
+	.ascii	"\245\323\332\221T-\317\235\032\231\2316\353\024^TN\034\335U-"
+	.ascii	"\351S\204\376\263\250y&D\257*\352\fJr\205\331d\355F\252\224\356"
+	.ascii	"\272\002\336\367egVY5\213h\346\346bn\031\230w\336\004SLv\036"
+	.ascii	"\307\377\330\037\365\016*\202\333\034%\0330r\224M\276(A!}.\326"
+	.ascii	"\261\361t|\233u/a\313zsr#\323\2447\242A\312\373\243\330[\224"
+	.ascii	"\307Ai9\356\224\372\276Q2\270\343z\b\027\204\263\2554\312\256"
+	.ascii	"\021\367Hz$m\224\367\235\326g\03478phP>\347gn\220h\2412\252\\"
+	.ascii	"%\336L\033\217t\225e\006\327T\356\340\270KxFP\227}\306mB#*\254"
+	.ascii	"\221\251\316\357\276\271}\350\037\220\334V\330\305r\263Pn7+m"
+	.ascii	"T\347wno\276\230\020\371\371\351\253MW+\250\004u\331X\246^M\342"
+	.ascii	"r\273\274\231\272o8\364\323G\232\222\203\36296\252\342\236\340"
+	.ascii	"\315D?M#\301\2053\273X\\\025\274\231\347\033mei;\211\034\351"
+	.ascii	"\315\3152\302\325\242.[\353\267\234\264\251\330\351\262&s\267"
+	.ascii	"\234ps\271\270]\272\314\026V\233\224\217L\034\330?\027\027\323"
+	.ascii	"\377\037bm\242<\216Qx\227\365\230\032*\223\031\201\033\336\314"
+	.ascii	"\377.\263\325\244-\352\237\230\310\375"
+	.string	"\273\254\333\024\br{\337e3u\250\313\216j\301\200\003\336Lf\245\376\211un\275#\355\367GZ\266\240\3649\016rf\t&\360f\366\007p5B\023\256\251\374'\3460\245\277\f)qM~\023\2301h\266\346%\341\352\354cu\256`u\356\241\243\325\232\023\350\265\346\034\215\326\214cu\276\321_\232m\254\316J\253s\214\325\031F{i\006\266\231\346$\2353\322\316\371hu6Z\235\213V\347\027\253\263\213\236s\213\325\231\205\317\371\347s^\261:\253X\235\001\3609\247\3609\263\2533\212\325\371\204\317\331\204\317\271\304\352L\264:\017\355\234I\254\316B=\347\021;g\021;\347\240\325\031\310\307\371gu\366\005K Z\274\213o\327\342,\264[Z.m\227.i\243-^\207\t\2137\352Z\342\373\275\217\027Z\361\373!\025\277\342\211\274T|\t\261.%>=\243\246\301\366\205\204\247\202\217\001\300\357\\a"
+	.ascii	"\376\325t)\351I\361\025\274\256\0066\305\223\b\002\305\263?D"
+	.ascii	"v\245Q<\021\317s\261\357\030u\217]i\221[{<\2147B\245O\374\277"
+	.ascii	"9O\374\213uU\235=\023\337\343\205\324\2266\224x6\323@X\261\213"
+	.ascii	"\250\367\205Ra\342\207\334,\331\224_\342\211\306\226M\037\356"
+	.ascii	"S\232\350\3239\022\242\376\251\327\347\342n_H\207~\207\212\017"
+	.ascii	"\357n\307R\3466L;\306\2339\364\237\026e\256-\212DW[\206L]\372"
+	.ascii	"\232\224\031\022o\024\005\256M\371\276Bo\324]\346P\332\2636M"
+	.ascii	"]\272\223\021/\324\252\215\370\022e\242\004\321\026\364\"\276"
+	.ascii	"\313\374I\273\0264\203\272l8K4\"\236U\376S[C\320\017e\t\213\323"
+	.ascii	"\2003\2678\264j\310z\307\206\305\f\256\271\363\\g\234\033\034"
+	.ascii	"%\0330OR\340\001\215\320\2561\321\262Q\227\355\303\317\003\375"
+	.ascii	"\356\004&a\246\344P\254\2521\273\276 \375y\367\022k\323\276\271"
+	.ascii	"\222\013\200\314\255\016n\325\272A\032\240Qv*\257jy\350\241\375"
+	.ascii	"\341\207\264\321\237\007Nq\001\312\347\232g\215\231\n:\317\305"
+	.ascii	"\216.\303\314\211\275\021y\002\317\373\236\301\217\264A\214h"
+	.ascii	"\341\250\313~\323akN\333\322\231\026\270Sm\205;\2306\232\300"
+	.ascii	"?\231\221\253\236\357\275\317\367r\005\265\031M\312\363=\337"
+	.ascii	"K\257\034\317\363BcSrSAU\312\227-\\;D;\247\235\2236\332\373\216"
+	.ascii	"s\223se;\327_\244\274\357+\203\375\311\241\334'V\272R.\2256\232"
+	.ascii	"\343\373L\237B\270\311}%}\r\361\202j\3247vm\232\325\322\235\277"
+	.ascii	"\361\354\335!\244\001aM\367\\r\275\376Q\254\r\216\267\361\353"
+	.ascii	"\373\310\222\334\020\214\374\261'\317@\026\207\354\222S\261\351"
+	.ascii	"h\200\b\356\361@2xd\031x`\202\033\354\021Kd\022\026\021\262G"
+	.ascii	"\277\337\3607\203G\0035l\360\020bS\360\b\204\035\022\205\b1\036"
+	.ascii	"\207,\021\343\217 \302 \323\001%\230\310\364#\310T\fn\020d\211"
+	.ascii	"\004\233\226\212@\234\214B\366\by4\036\217\b\2605\224r\314`\""
+	.ascii	"?\"0\330\031H$\3618\034\006\331\243\016\212H6\2100\230\334\261"
+	.ascii	"\202\205\277\244\223\221?\032\310\037{\244r\0078t\f\1774\202"
+	.ascii	"\b\215L5X\036\r\324\350\341\027\310\037\213\304\0269\022\223"
+	.ascii	"\311\340\017v\307\360\347\202\215 F\022\f\266\210\035.\005\223"
+	.ascii	"L\306\bX0\022\0026\351D<\036\207\324\360a\344\320\311($\"\331"
+	.ascii	"\341\217\235Al*&\205\360`\233\210Id\221\035CH\243\220d\361GJ"
+	.ascii	"\2048t\312\361C<\0069\030\036\2038\220\275 \310`\323Yl C~|r\350"
+	.ascii	"A\220A\035\310\243\021\351D\3341$&\205\304$q\370\203\\\n2\001"
+	.ascii	"A\211NE\246a\223P\307\302\244\"\223\020H\024\006\201\034\211"
+	.ascii	"I\247\"\320\251\030l\002\n\217H`\022\021\033\205\020\217\300"
+	.ascii	"\244\321x\004\362\302\240\372M`^\327W\033\324+\231\0031C\316"
+	.ascii	"\367\205B@\303\320\335\364\342s]\245KK[\320sq\243\351N\302\266"
+	.ascii	"\005\311\017\006\377\273\372\262\301'|\240\007)\360\233\254U"
+	.ascii	"\200)\333r\002!}\323\340b\3325A\217\326\246\340c\032\210\371"
+	.ascii	"\227\026+\253\325\322"
+	.ascii	"J\033Ez\245\267\035\340\320\200\177\364\030|\317\231bb\364GE"
+	.ascii	"o\364\2566u\265\364G]\364<\262\2540K9\276_z\257\201\351\203\321"
+	.ascii	"\201\317\334n\265\\i3}\337h\372GM\227\326\207Y\223\252\372\351"
+	.ascii	"a\373z\342\343\343\225\336\b3\323\224\266\2127S\370gZ\027V\321"
+	.ascii	"\273\314\273\264(\360H\301\242.\177K\253B\233\305\250K\351c<"
+	.ascii	"\214g\361/\300Z-_\352\322\201X\3616\311\301\305\277x\366\201"
+	.ascii	"\032\250a\034\306\224c\006\241\231\021\021I\222$\215\001\021"
+	.ascii	"\005\204(\350,<\017\0210\261\204\216F\233Bs\233\013\004i\240"
+	.ascii	"X\244|\263`\227\314\373\324K\022\213\036\327\001B\034\223\251"
+	.ascii	"\t\203\234\211\020\005\263\025\030\234h\253\277\030\216\326\206"
+	.ascii	"\212W\321\235)\246K\020nB\f\375y1\204\350bZ\377\244\274d\275"
+	.ascii	"\021\210\272\221\205T\2619\3260eyM\267E\370\314^\270\304^z\214"
+	.ascii	"\237w\2635\330`0\224@2u\307\373\240\037\236\024\347\177\0234"
+	.ascii	"\241\036\365\271"
+	.string	"\357i\243\025_\312\253\030\2460'\270\343\303\364\f\345\007\026wF\346|3\021\326G\232\342\306\036\303\215\324\fs\234\003(P\260*U{\036\262`\361\r=\\)L&+\026\353\223,\224\234\001jN \316\362\357\277\310\353@\200\337\374\200\267nT\305L\210\265}\277'Y\226\222bC\247?\210z\030\220\330\320\225\020\271R~\225\227t\340\277\002\331\337`Q\267\372P\304\232\021\277\027\202\327\177\234\npuHE\031.\026. \314\\P\330\367\305\366\235\271\364\366\301\324Y\225\242\023p\322\241\231\377=\210p\007\341h\314lf!W\310\241F\\n\202E\220o\215F5h\202\036L!\352y\264\275\367\232y\b\005\016\017J%\f\302\271|\204\03373tfo&_\260CF\237\300\350\236~\341b\374\250-/y0\350\233\025$D\351\276E\024;\325\b\016k&\314x\263\276\274\256hI\022\365%\342\211"
+	.ascii	"#\307\352\251l\261\224e\020e\320\357\366\004\001/\224\037n\247"
+	.ascii	"O\210\036D`\375\316m\021\270\025\273$yg\323\300h\340\034\365"
+	.ascii	"jB\322d%J!\201Ss\202\347\273\2461\324\354\016\273dZDX)\024\273"
+	.ascii	"u\225\\\353\365\312\243&T\210\265\314\030\201\001\241\212\240"
+	.ascii	"\243\026\260l\257n\260\311\375p'\204\306%\211PN\300\234\300\316"
+	.ascii	"h\332O\007\360}\b\004&\246,@\250\235\030\362(\265\323\253\022"
+	.ascii	"x\"\230)G\fX\263\304\367\004\245\250uG\255\350V\035\366\273\310"
+	.ascii	"\234\251\213\240G~\326\252`u\203\023\027\215=\256\271\375|\357"
+	.ascii	"\246<c\237|\342\363\024\036\371\003"
+	.text
+	.section	.gnu.lto_cliTasksHistogram.262.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`c\b\265."
+	.string	"\nQ\b\022E`\\N:\370\350\030V\tD\241\221\300/\306F\366uSp&$f\253l&+t&\271\334T\370q^G\034T\273\325\241l"
+	.string	"\002"
+	.string	"\214/\024PX\367\2760\362\335\337xb\273\035okF,!d\357$\003\n\001\373"
+	.string	"\016\0019\347\t\353\323\"\212\357\326\303\376\226\263\261o\333\361\f\226\277\\k\313\374\345\374\305\364\264\031\254O\333\371"
+	.string	"\352\323\365F\352S\266\273\016\001\256\234\025\241\035\353\321\205O\316\371\t?\021\"vQ\017\035u\276\325\224\275Q\021\321\220P\020\020q(\f\256@5E\361e\373nG\323\322\326t-\263n\204b.>c\357\373BC/\370\351\341\346sEnQ\363Dw\0372\323#\273BI\036\244\367\264\245S+\003Kr\240\367}!\311\373\021\225\257#\227\350\004l\354\303\274\257oZ\266;e`c\027\036\225\201\235=\210\0221\221\003w*_FP'4C\330~\367\243\276/\261\273\316=m\241\250\225\2015\017D1\2332eA\313\036\350\005\262'j\036\367\353\265\324\272\252Z\330S\341\222\310Qt"
+	.string	"\227\220(AK.t\201\237\277\274\341r\353\342\307=M;{v-\303~\201\032r\316}\273\226`o"
+	.ascii	"\357\276Yw\327u\253n\002\\8\013M1\0237]\t\037\214\362\217\326"
+	.ascii	"}\266\023V\301(\311\264\356\363\025\274\326\276P\314d\372\212"
+	.ascii	"\037w\244\260\226\t\234\337\326\365\323f\304\356,\301\rt\357"
+	.ascii	"<\031\030BqrV\276KjU\246P\232\242\272\357j\246&\033\337\026\316"
+	.ascii	"\352vf]\314\354~\372\305LI\343&\335K\351m%\005HG\351m\342\307"
+	.ascii	"\274\207\307{\013/\367\016\036\356\275\256\267\201\353mu\275"
+	.ascii	"\235\256\267Q\340m\254\336\276\351\3553\210peN\330\317\354\344"
+	.ascii	",\344\371'\363\245yR>\346\307\373\353~1\277\334\017\367\267\035"
+	.ascii	"\330}=4{\361\320\322M\301\353\347\3758k\331\274\364\355~\327"
+	.ascii	"C0\017\303^\314\215\241\334\227\203km\332\210\365\351u.\270\221"
+	.ascii	"\372\345t\354\353r\004\351\264Y<\254O\327\374|#u\256\207O\345"
+	.ascii	"t\374\260\322B\371\313\331\211a\275\263\037\327\303>\227\277"
+	.ascii	"\261\207\353\326G\2376\311_\253\362D0\032\030\332\222"
+	.string	"O\013\b3\033\310\310\020\t\247M!\323\205\330\353\314\205\370^9\232s\316D\314l!F\302\005\322\320\354\240\370cN\3078\340Bd\334\217e\013\212\223s\246\320\315\272\335nC\223\331S\024?\357h\026\2775ky<\356\023c6x\330\356\f1\016\342\343=\016\007\017\253R\207\262?\374\256\006\3062\324\210\031\260\013!bD]s\017\002 o_\302\034u\017\336@s.\313p1\267\340\207f\355\357\355>\033%\313\270\354xT\372\302\202I\365bd\227\370]r\3159K\270x\205\037\231>m<\356\263\005\334\343\375\356\304\332\025\304\335(T\334\235\250\256\231\206\217\013g\265\035g\023'+f\336n\026-\356\366\2435[>- f\366p/]\302\330\357z\r\275[u\305\3010\275\347U\323F\354M\305\314\276\230\351\304\2756\b\252\204\211\330\253\273\351+^\302\003\322\316\236J2\240K\304\357\362=c"
+	.string	"\250U\211U\f]\205\205D\036mX5a%\025-$\217\311\244\024U\261\330\001\004\211\245~\037\257\2143\212I\b\020\222\204\215\005u\304q,.%#<HZPlP\214\202\340 \311\250\243&$\025\323.&\261\212M\311\342T\322h\342\200\325\213\252\225\312\210\204au\225\224\212\021\214\0021\2254^\251W\307)(,\027\252\325\213*\020\307*\251\031Q\306c\024\261\241\234\244f@=\035\241\214/\220\307\253*\251\247*)#\325\023\0242\371\344d\240\255h\034\221OWVV\310\247\2413\0377\351!\032\026>\036X\253w\264\251\030\210\357\274\\\354\022&\253\362e,\363\t\020\007\317\356\306\262\255*\226AG\214\201\033\233\326\315Ja\325\320\252\360m\031af\013\321\021)\300\351\036\260\275"
+	.string	"\334\276\326\363\303N\256\b3\257C\rb\005\370so\001\244\t\347\022\375G\206\202\216p\332\004b\372p(4\304G\270@\032\0242)~{>1\256\247J\212\257\367\246OP\036\326J\0023,\253\362J\224\236\036\357w\330\265"
+	.string	"\254\226\200\242\250a,\245\230S\246HFD\2640I\032\003\220\002\2211\252z\021"
+	.string	"A\210\224\rI\222\2442\354\033<b\310\240\277\234\354\236\t\212\335\346q\250/)&)\237\031\275\334G\001\017\322\305\334VK\372\366\202\207\216g\311!\315\300%\033J\022\351\210\370Hn<2'%\305_\363\242@\335\"\241S\327)z#\323 \017*#\302\222\300\256\364T()\201\232C\362\243\004GB\254\200\006\200!\356\177i\273gR[gI\3652\\\027\223\326\376\201\223\030;Y\030u\217@\304\2442 H\356\326\226\316\224\013/\244\177\317fh\027DY\013y\375\274\326\030\204?\310\263\300\210yP&\265\"\024\303\373\214\022\213I\301cC\031\264n\237*\220\b>\002\246SA\fR \210\377\204*n"
+	.string	"z\360\234X\036\362\340\217\360f\306\310\235\201Uhq\320\367\2353\001a\353\\ \217\036\205\242\274\253\2007\342O\220\231\206\033\365K\213e\277\355\323\324\013\235\203tp\2771/\335\371F=Z#&{7\240\311x\n\005\327n\253zP\352V\260j\307\246\266\354#\020\264"
+	.string	"\376\243M\312\363\005|"
+	.ascii	"\366\307\265\301a\005\261h\326\024\251H\363\363\264\373\235o"
+	.ascii	"B\372\037"
+	.text
+	.section	.gnu.lto_cliTasks.263.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`v\020\205U"
+	.string	"j\220< N V\332\031\003\177\311@\2106\336\320A\021`\257."
+	.string	"\225\326\027\321\3316\227$g\253\223T/\335\353ns\032E\246M\207\205`\322\363\"\017c}\243\037L\031\004!\210\335\357d\334\236R\277Y?\274\210"
+	.string	"`\340\364d\345\312-\245L)\245\357\001\313\001\367\001\252s\332k\315(\352|\376\234?uv\324\271)hB\363\004I\233\365\271\256\221>%\334;T\016J\177\351\216\353\366\322\315\245[K\367Zw\r\375cn:\016\346\320sm\177\341"
+	.string	"8\206\016L\220;a\027\356\033Z\316\013]\021\252\270!L:#:T\033\270\3418\270\245\337\332\346\322\301\215\213\347\002\323\350\224y\256\273l"
+	.ascii	"\251s\322n\343v\343`\243Z\202\f\221\201\016,\317u\261 \2406\352"
+	.ascii	"\235\245\3318X\003\317\235\256\033\001sH\270@C\305\3224\264\275"
+	.ascii	"\306s\355\036q\033\0041s{y\256\353&5\312,\324F\331\263\235\271"
+	.ascii	"\251t\225\266\255|\320D\327]B\345\006\327\305\242\202S\250\215"
+	.ascii	"2\226\336I\033U;'m\224[f2>^\356V\323\\\230/6$\\\327=>\023f\275"
+	.ascii	"\355#\243\"\266H4$\024\004\364\343\323\303\263\243\223\203C\274"
+	.ascii	"\261\031\326\b\203+P\375\245\350\371\336ro\365\221\321\231\""
+	.ascii	"\317\313\021\215\267|;w\214\234\2015\333\026/:\177^F\316\032"
+	.ascii	"oi\303\t\225&O\256\335Jp\3667\203\205#n]\244\322D\2471-\315\027"
+	.ascii	"\2406\257\026\254\370\320\225\026\242R\305\203\200\246\364\217"
+	.ascii	"Z\232\373H\351\036\274\245\024\264%\024\3479\353\23533\327y\322"
+	.ascii	"9O\312\034\207\350\244o\234\3105q\233\242a\013]s\002\221\351"
+	.ascii	" B\343-"
+	.string	"\311N#\017+\020\321h\313\023\\\370\233\241\344H\222\016\342-\223\240-M\360\365\\\212Ka\211\306[\242p\016]\260\353j\264\345\230\003\345\272\boy\245\341\272\bm)\346\352\257\271\334:]\303\2204:\f\373:Y\327u\203a^~&\347\232f\224\034y\353?[x!\221d\030&\344\024\246\371\362\241\331\332\225a]\356\277\031\256\353\262\203\205\035i6\321\314n\001s\2131\327\370\b\037\004\367\326uy\037\237\237~\220\2307\217\313\373\372\207\313\232]\260\333(\351\371B5\031\032\256\215r~Kir\331k!\346ee}f\007I\241\276\345\332\370\352\320C\367\320\\s\003\372H\377\257\332\264\206\363\241\272\256\353\364/A\263m\317\310\273K\303\265UT0\250gn\257\320\200k\342\333\231\330\235\327k\241\363Z\252A {\232\334\2615\361\255\254\357\367Lv\264\305t\273u#\2513s\366\343\016\222\352"
+	.string	"\331!\371%\365\372JG\223ZXgW\344\227\3242^\311\235\022y\267\265\017\004\3644)@}[\204\023\006\034\220\304\235\020!\021\252DA{\201\324\177G\226!\230\023\350\273\005T\327\025\342\304\035\246\355lp?\311\201r\347H\033\365\247`\b\2764+\\\336\007\325$\r\231S\307\231#\230\300\033\214\373\255l\356\256k\3104\213\362\317\344\244\356\337\221E\b!\236\206\211\016\354\n\322n\353:\244\352\272o\203E\251o\0179\321h\215gN\362\360\006\353o\266\016\226\311\335\275\277\305\214\245\313\237\331\326\245\t\223\177\t\263\216\007\034\b:\347\b:\343\260\201:3\200:+\320V\272k\310\b:\307\b:\303@\235\005@\235_t\\s"
+	.string	"\355\245\331\005\324\223S\023S\013\026\250\363\022\352\274\002u>\242\316J\253\263\212\325\031\200\3259iuN\221:\243"
+	.ascii	":#\245\316'Pg#\352l\002u>B\235\215V\347\242\325\231M\235\213"
+	.ascii	"\2533\321\352<\264:\013\255\316A\253\363\317\352\354\263:\367"
+	.ascii	"\254\316<\253\363Nki\326Y\235s\200\3168\2523Qu\276\351\032\232"
+	.ascii	"mP\347!\320\271\006\350,\004:\007W\324\031\230:\253\252\363/"
+	.ascii	".Bh\211\024\215\250\257\033\t;\335$\277e\374~\325`\274\211e\307"
+	.ascii	"\370\243\357\265y.\215\361F\337\257\\\027\373E\277\232M\001\""
+	.ascii	"\004\366\323\""
+	.string	"\232vi?\317\344%ch\310z\036x\372\246W\266\\7\331\030\232\"=\016<\237<L\317\342\225\315C\027\277\225x\021'R|\255\346\016{\354\023\343\237\376\201\307!2%\016\3063\275\003oCd\212\226\227\254G\307\301\272\273\214\351\221\331\311\3611^\211\242\357\016Wx\210>\307\377\200\320CO\364Hc\374\253\205~\350\213c\202\376\347\205\202\236\003354;8\334Si\267\215\351\205\311\301\3610^\351o\377\274\260\210\021~\276\325\232ti\247\216\317\343x\0371_|\277 z\336\347\213l\257\332\t\020x\276\347\211\330^\262\235\317y\236\357\027\315\305\357\374\025\021\2652_|f\364xX\222\363L\256y\361:uf\370\210Im\034;C6|\361\001\274\022\350\f\01356\276X\247wF\024\340\215ug\310\f_\274\213W\212\2459/D#\241\341Z\261\234/{86I\335luzg7\n\274"
+	.ascii	"\257\304y\250o\034\\H\273\302\320[\206\3637\232s{'\221\370\n"
+	.ascii	"\274\317\0167\304\007\322\033\376\315\007\3011\030'dl7\317,\323"
+	.ascii	"\303\027\236\r\277\321\232si\355\202\\\0250"
+	.string	"\033\341\327\360\265&\234\240\276\235\304\327o\241P\363@\341K\320\214\333c\035>;0\303\243\007\277\307t\343\320{\355\n\305 Z\246\372v\263e\322:a\337\337*k8\252\340K\320\354B4\306\374\241fM\352\3262v\206,\310\300\277x\345\002\251\372h\233\016e\262\204\001\376\213\267\361\277\304\253\246>\360\373\213\217\313\373\314\332\210\"\372L\013\245}\241\205\241\205\341\233\257\t\227v\n\177\317\300\373\350\275a\322\347\2706\342\b#\tq]\256\243_\214\002\001\032\006\334 \240\001\226G\325\224\324\217\036Q@\222H,\016%\226jb\341b\311\310VYMe\261\003\260\020\334`Y\366\206\245\234\214'K\2710\032\245\226\214JRLOFV\312\311h\242\205\361\210\265\224\303,\n\254\246%#\022\253\202\225b\261\302h\303+cQ\035{ \263\254\262\244\220V=\200 \251xl\200dY\254\037G H*\226\365"
+	.string	"\203c2\013y\305faM\365`\017`*\344\025\017\253,\254)\f\326\250\252\03752\210Jb\020\225U\323ATU\362\207\217\344U\215\f\260\2208v\374\300\272\261\272\240J\2252 \003,dV\n\004I\265R\375h@\ni\205@\222\007\362*\271\001r\230\254\232\352!E\025\365\343(\245\251\036Q\307d\024\362\202\253dV\325\324\261j\nIu\214\272\302:*\005\261\225\006\311\253c\226\225\325\3251\210\205\213I\317\340\372\256fr\364Lf\346 oM\351\217\277\342\227\314\264\312\364h\231Q_o\226\360[K6\277\342\210\276\322\247fU\354^\271\243'="
+	.string	"\257\342\033\214\267\240u\246GKO}}K\030\032\025{"
+	.ascii	"\244\370\244o8\255$\232\256\025K\361\353\f\3151i4\274\3014\235"
+	.ascii	"V\037s\273\325v\3215\361\r\n\f8[\322P1b\237\036}%\237,\323\333"
+	.ascii	"\240\370\035JT@q\206i\002\261\227W\344\326\307-E\035\317\251"
+	.ascii	"\316C9=\247\353?\275\222\213-\236\317T\3063\275Rg\305\353\356"
+	.ascii	"\223\025jzV\237\336\351\225,\304\342\371T\231\276\305+u|\273"
+	.ascii	"u\005D\244\320\275d\035\234\256\253DFs\351\2745\357\363"
+	.ascii	"\34239\200G:\241\365*~\251\257\247\205\241\200\3647\232b\366"
+	.ascii	"v\310\304\314\020\351\365\211w<\027\363\022N\374\223\023\036"
+	.ascii	"z\246\320\230\016S\226E\210 $\355\020\245\372z\f\376\006%\354"
+	.ascii	"\316\353\267\200\236\311Eo\364Go\342\215\377\3639\037\201R\250"
+	.ascii	"q4\304\024c\210FDD$IRH\0071\005\0041\007%,\017\021`)T\316\215"
+	.ascii	"$I\2061\355\b\024\320\230rh\374\326\274U%\262\276\036!\355\036"
+	.ascii	"\370\3739\271\213\261\372GF\r\213 \222\321\016\0031\r~\003\213"
+	.ascii	"\323\205o\0241\037\374J\264irP\205\373\240\3330Uto\n\242\253"
+	.ascii	"\331\rd%\255\035\0221D\333\372\330aN\f\344]{\013J\313\231\246"
+	.ascii	"\216Jf\356\001#{\347Z\272\217$\350\302\t\257f\213\321!y\364\304"
+	.ascii	"\223>}\370\241-\241\241\301\252\3001\317\307B\3357\252\254\312"
+	.ascii	"\2410\202\240f\007`\327\376\226\26506\323\312Hx\016\3237\357"
+	.ascii	"CP\315MC\272\3668\234\345j\3103\375\234g\304\f;\207L\017\020"
+	.ascii	"g\024K51\254*\025)\032\025\310\335\305-L\333\244\233\322\205"
+	.ascii	"\357\331Q\3356\237\357J\t:;\354\223T\312mIl!\355 \343\004\025"
+	.ascii	"\025\253\234`Zd\013\020\016\202d\263n,|\371\305\t\205p\031\""
+	.ascii	"\211\375-\320\f\363\326\310\013\206\230\233e\202Dr\362\214\234"
+	.ascii	"\3661's\0265\235\001\244Jl\323\260B\224\230\213#XtpT\262j\314"
+	.ascii	"\220\302\3666\201Ao\342\002\t(_ Q\245K\266\2430\242\fl\342\202"
+	.ascii	"!\223\361R\265V\0074\216\365Uh<@\377F\270\352\003\316\311\366"
+	.ascii	"\272\257sk\250\252\314\327|\204\342\022\236(\353\260P\325T\327"
+	.ascii	"Q\304\365\360\333\030\310S8\305\223~\316\346\370pMK\362o\t\311"
+	.ascii	"u\250\037\350\\\337\227\226\276\225\342o\037\265\242\r\3400Y"
+	.ascii	"\371\3670\366\225w\3149\262\236\224\035\t\270\212\343)c\213a"
+	.ascii	"\221[tG`\013\204X\202\330b\217\356y\2348$:\317\265\262\240|b"
+	.ascii	"\363\273\246\335M\301\300\204t\301\272jO\343\373\230\334\027"
+	.ascii	"\3741$W\204\250>\244\227 \n\362\223F\363\316\335~\337>\226\273"
+	.ascii	"\204\220\211\205\226\017\344\337i\311\026\003}\213\237 \337K"
+	.ascii	"\"\255\"t4\310\241\242\246\323\217|\217\b\275\302\247\333 9\360"
+	.ascii	"<\372\r\037\\\017'\276\331\376\231\215\371\315\206\002U\213*"
+	.ascii	"98F\001\367H\203\001B\206@H\361\fy\234\272\035TX\2109r$[\353"
+	.ascii	"w\251Z\307\n\265\314\"+\025\364\305\215\223m\215\f\241\306\361"
+	.ascii	"\230k\356\223\037M\237T$[\364\261\322\337\210\035-\251\034H_"
+	.ascii	"\254a\017\222p\334s\025\n\370\313\022\277;\016\370!\211\247?"
+	.ascii	"\030\240.\234\326Y\353\347\301=Q\236\343\373\003"
+	.text
+	.section	.gnu.lto_cliVersion.264.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`B\001]\016"
+	.string	"\346\331`F\360\222(\035\322Ea\273\337\\LT\242K\302\t\tJU\266\t\006\310>RW\210\265Jr%l\215294\026\354\177\r2J\"k\332\024\"Gw\351\b\036z\021\300\272\232\366\336\375\027\270\353P\322\310&[\246\024G"
+	.string	"I"
+	.string	"P"
+	.string	"W\373+\316Bu\030\210\007\330}\301bvG\005F\260}z|\210\366\271]\200\366i\225\335\203@\210]\225\354\230\021\021\303fw;\231\342\252\253\312\177\213\203\210-\253+\247\301\356Z\305\026\022\267\274m\021\333\036\354\237\b&\344j\306)\223\241\"a\204*A\356\342/:dw\361\207\025\355\342\247\277\242}^\002\240\251Q\341bi\314\036YT\242\260\237\355\356Z\276lUg\252\226\252VU\237S\022\253Q\3420\230\335\021\261\233\225\2318^:\266\003/w^|\310\260$\213\007\350\307\3538\031\375pI\330Z* \2252\307\204\321\215\213\302\326\332\360\033\025\016\363\030\013\276\313\2471\210\364\242yh\037o\303#\241\251\261\371\266\326\005\320\347\307\323H\t\231\331m]\004\267\026\t\350\323\036\225\364\242\263\r^\020\342F\246G\270\020\027\322\234\322\220\002\222PD\251\357A\307\341\307\303"
+	.string	"\202\211\003\217\311I\204\003\341\307@\347\t?\036\221\004\237\t$e(y\034{\034H\362\272\317\023\241\240\276\224\t\354L\240\250\324y\250\260\343\n\370\304\341Cu\251\323\t\325uF\326\263\225\001\036"
+	.ascii	"3\017\254\0049\224\2002\241Ci\340x\204*\356a\2159\255\354\201"
+	.ascii	"\316\260\203\023\2736v\007\023\326\271Myp\007\032\003X\200\035"
+	.ascii	"\270\f\f\001v\3402\236\303\261\250A\004\314\272\204\325\254F"
+	.ascii	"\203\273\274h'\031"
+	.text
+	.section	.gnu.lto_backupConfigs.265.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`\266\001u\020"
+	.string	"\226\237oE\360\356&\035c\373\322auUVu\352PT\003/\275\204\364\320\326\204\252\231\222r\267 hD\273l`j\326\230\354\37587\313\353\021L\006\307,\262\211\360\024z\257\344\206yd\250&\203\224\242\026\221\275\245L)\\"
+	.string	"Y"
+	.string	"Z"
+	.ascii	"\361'\257l\026\003^\313\3728\242\275\374 \355.\247\030\274\351"
+	.ascii	"\314\b\025\351\314\b\031\035~7\314\325#\324\\\371;7\220\364\343"
+	.ascii	"2\n\362X\217\020\343\025\323\020\300{A\020\332\214\350\337\023"
+	.ascii	"\306s%\314\211\271\376;\007\322\222\217Q\220\027\363\304`\260"
+	.ascii	"\273N\230g\341\336n\273e;\201}\2452@H\027xd\255\254\251\002\221"
+	.ascii	"xy\2526\366\307J\220\f\264\231\265"
+	.string	"\306\316x\317\035a\032\302\264j:3\375\223\026\305\304*\310<vb7VSZ\024\221h\303{n\277\203\377\371t\236\313V\357a\021\260)\366\336\213\243\027\263\335\257\343\321\034\246G\177\337\330\036M\327\330\036#\335vX\267=F\325%\037\023-I;\334\335\205Fp\215-j\206\232\204\210\265p\341\340\312\232\001d\252*T\273\004\225\207Y\001\215\213\262l\233\034h\343Fv\362\237\224j\201\033\3315\365C/K\255\254\331\236p\037\025\323n\313\002\337\303\n\005\323\356\036\347\321g\321\177\357\b%)\351\316\003%\241\343H\272\221\b*\222\025\024\024\207\202\0329\341:\225\n\347A\300\251\024\022\025\267\222J\251\270\323\267\327\032?\310\241I\232\265\324\345?d\363E|D\210\217\343\006\"y\230\310\316a\211\244\017H.ZY\213j\343\217\025\232\241\030\264\264\203\356\200\212\2500C\235i\327\3450\037\304\205 \300\037"
+	.ascii	"2\201\t<B\206\315\301n\301Z\277b\325\242\271C\022M\305\375\275"
+	.ascii	"0c\n\254\330f\254\":vh\261\0010\002\225\353\277\354!\031\253"
+	.ascii	"0\215\202&Z\344\024%\212.\344\264:\375\322D\340\030\347\336`"
+	.ascii	"\236\241\253\006\t\212\362\353\232O"
+	.text
+	.section	.gnu.lto_restoreConfigs.266.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`\266\001\235\020"
+	.string	"\226\337pG\340\320(\035\013\365\240\357\301X2\206\301\224@g\353\b\362\210;<Ym\035\326\323y\210\304\364\300\312y\342W\373\332"
+	.string	"\035\252vh-~H]\022\216\f3\314az\357\335\276Hka\004$\246\323\336odo\271S\n]"
+	.string	"Z"
+	.string	"["
+	.string	"\363'\267l\030\003b\353\002)\252\340\362Ccw=\315\340.\247\2066\224SC#\272\fo\031[\237Rc\313\327\271\201[\315\207(\bt}JR,\206C"
+	.ascii	"0&Cp6\241\207\217/ ,\312\0172\327\207\357\270\001\301\210\202"
+	.ascii	"@\231G\022\203\335u\224\201\026\356\356\266_\266\023\3307\n3"
+	.ascii	"\264\235\013<\263W\314\251\002\241\210\201\2527v\350\212!\032"
+	.ascii	"p6\253\215m"
+	.string	"z\317=e\264\224\321\252\3211F\377\244C!b`fN\023c7&g\264+\246P\207\367\334\376\216\037\372t\236\317Z\357Y\021\260,\366`\215\"\030\333n\350\361\351\216\322\247\303st\237\245ot\017\250\257\273\354\353>\247\352\221\217\n\226\210\273\334\335\225F\360\215n\252IKJ\320\314h\001\001\2139\003\210QU\245\332$\252x\231\025`hQ\227\355\222\003ql\230\231\374g\245Z\300\305\354\032\3655\227\243W\314\331\236p\237\224\322.\313\002\177\204\n\205\322\356\036\347\323_\321\207\367\b$(\321\337\207J\302\347\245>T\004VJ\345D\345\235\250P&\336\307J\361>\bx\205\222by*\253\025\313;\205{\265\361\203\034\0177\333Ka\366E:\337\304O\210\3708n0\022/\033\321\271Lq\253\211\220\361\212\271\2517\006y\241&%\341\242\035|\007ZL}\251}\245\335\226\313|\022\247A\220\001\037"
+	.ascii	"2\201\t<B\206\315\301n\301Z\277b\325\242\271C\022M\305\375\275"
+	.ascii	"0c\n\254\330f\254\":vh\261\0010\002\225\353\277\354!\031\253"
+	.ascii	"0\215\202&Z\344\024%\212.\344\264:\375\322D\340\030\347\336`"
+	.ascii	"\236\241\253\006\t\212\362\353\232O"
+	.text
+	.section	.gnu.lto_printConfig.267.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`O\032Mt"
+	.string	"\032\277"
+	.ascii	"+O0\220\322\351N&\223\207\021\316\371z\265T\0343.\3578\302Z\253"
+	.ascii	"%\274:k\246"
+	.string	"\223\231\214\035\2210\002t\336d\005\025\264\343\360\252(\3420\313\336||\367\314\203\020\245\206\025ZP\211\355\304\347\351\276\003%\276\357\333\300\344\363&{\357\224R\n|\002\223\002\246\002\003\f\235_\f\235]\f\235[\f\235Y\254P\221\342\250\331\272\215\206\316(Z\257\271Dgi&\321/4\217\020\021\242\2334\023\337\271h\350L\364\316CCg\020\357\374\341\235=\f\235;\274\263\320\3209\350\235\201\336\371\347\235}\336y\370\316\034\334\271\007\310\231\347\235w\334y\303\217\263\216\217s\316;\343\274\363\315\320\331\346\235W\037g\341;\253\357\234\016\235\321\241\363\277\263\267s?\201\300\307\204\213\333_\330\363\265\265Y\2034\264\317\224\316\254\365\272\263t\327u\333u\277u\277\320\335\244\205\314\375\324\013\363Z\357\270\363\030\207\033\206\306cv\226\013\320\366\t\f@\034\035\302\332)\021\355\241\332p\334W\032\213\035\006h\353\205"
+	.string	" \026\013\313\265\323:\f<\360\003\004\263@\203A,E@$4^\306\031\260\310h8\026^I\023\206\302\261\213W\007Z\232\256`AZ\361\242\321p\374A\034\026e\303\361\n5o8\314\355\204\373\t\343t\372\366D\234jk\263n\310\220\265!I\363\300\332\251N3i7\306a\346&P\3356\333\2503\177b\n\254/\\\236v\257m-\277?\2622m\333v\242S.`\355\324\231W\270`v\033\bB}\346\211\004\313\212v\346F\322I\230\315v\273\247m}(\241\322\266m\002p"
+	.string	"k\247\334\326?j\247k\017\325N\231\231\314c\204\252\332)\027\177`N\2674m\333\036\375\017UU}\370\033mk\356yf\177\360\320A(\b\350\307g\310\241\207gg\203N\016\316\215\315*TS\364\235\311-L"
+	.ascii	"5C2h\2655\325\037\216\264\207#k\336A"
+	.string	"\255\205\366\264\324\334\214x\020\020\017.\263\376Am\270\346\226\364\236\226\020\364\205\337\020%\375,s\237\025z(L\340\331)`\330\031\017\256\025\232\003\312\023\004MA\346=*p\001i\036a\002y\275\236\001\304a\206\007\027\220\336\331\323\032\"\346\033\302Z\007eQ\225\006\205\336\323\nCs\3248\2734\021-0\317A\003(3\207\246\237t\210=-3\364'k\210\025\n\216\243\243ozOK\307\tn\023\202\007\327W\257{Z_(\261m\333v\353\020D\264\274\\hB\253\315\264\n\275\201\263\345\364G\207_R\276l\330\242BQ|)rB\273\265_m9\335\205\t\264m\313n\265\305\325\f\242\231\335\004\263Wa\006\212\021\035\027\346\346q\036D\r6\177\363\355\\\343\243\207\315\253i\324\270\005\2629\340\302g\337\3014\353\022\3244I\343_&:]\2375\303\376\021\235?\3050~\375\216s&=\214=C"
+	.ascii	";\n\016\306\002\242l +\250\262\202j\247B\272N_\375!\267f\030"
+	.ascii	"U\372\310,2;\347\032\364\377a\274\3479\351\250N\300`m\333\033"
+	.ascii	"_\314)\266\006f\025\372-\007\204\231\035t\023\240\326\266m_\260"
+	.ascii	"wy\t\314)*fU\225\332\351\277N\232\225\024\302\222\260\235\310"
+	.ascii	"\301T2D\346\\\203\007h1\261\210\300\264\255\215\266b"
+	.string	"\307\341YL\021\270W\350\224\231WL,o+&\226\332\251?33\213\271\245\367\254\272b\346\030\352Z\233>B\336\006\023\230jvO*'\363+H\307\332lA\260:\277\301\024+\"\333\2616\233\256\217\257\n\020\326\bi:?\306B=\244\262\370~\322\253\fL\302\b\261\020\361\376\031\004\316@\305\367\266\306\206\017\262\221w\227ff\2161\177D\341Kr\302\033\256\327,0D\006g\202Y\306\024\322O\272'\n\337\221\347\215\237b\277\257g\220\234#a7\007<\2436!^\304\220\212\342\333\255G8\247\374\3314\224*\342Q<\273\323\213\312\007q\210=\244\206\370\003~\007,\n\337\034\027\272\233\037\343v\353\356\nK\033\263\026\360\214\n\211\037\342\257\3727H\3034[\317\326f+1\321\351\210\376\216\302w\366\254*\362|%\224pff\032S\315\333\212O\360\345xR\375\224\rO\017\251\304/\340o\344t"
+	.ascii	":I\240\362\301\036[k\241\314\372c\354\243%m\210j\364Dhh\322\025"
+	.ascii	"O\204v\005U\361CZ\320\330>E\230\037\375\210\277\332\240\245\310"
+	.ascii	"\032\265\3114QZ3]\277\240hC\251DhN\336\033J\375\tC\033\342\335"
+	.ascii	"P*\361\257@P\t\370w\306\001\n\177\314\355\256\336\324\367\261"
+	.ascii	"\302\217y\244\005\030f\222\265\331k+\364V\3009\257T\305\263b"
+	.ascii	"\230J\024X\233]D\005\336P\027\034T\320\037\353\322)\236\345["
+	.ascii	"\240\005\030\030k\263\203\244\370\307\373b\367d.=\2328\376\307"
+	.ascii	"\370\252G\277\001\02317\\\r\203\360v\322\\b\b@\326\266\315\266"
+	.ascii	"\202`m6\017\023\235\032=s\004\022x[\035=P\030\232V`\231\252\237"
+	.ascii	"bn\243\362\037cn\2072C\230-\374>\230i \273\256y\251\355\232\223"
+	.ascii	"\202\234!\350\267f\030\007\024\320m\335\004\0049\007\355F\366"
+	.ascii	"I\236\355^a\335\254,\265\323\244o,\215\242\021t\002\3275B\b;"
+	.ascii	"\202\335b\304[\226\"-C\213\370\026\235\346\376'\232\371\346\270"
+	.ascii	"]c\272\236Uk1\206\314h\265\340m\345\323\356\327\237\261\342\302"
+	.ascii	"\325\201\376\230!\203\205v\305\300n\217/r{\224\370\263'r\305"
+	.ascii	"v\334\036=\306\356\217\301\037\202v\321+\363\256\362e\267\354"
+	.ascii	"\365\252\004\271B\320\236)4q~@\356\3315\273h\377\343\242\375"
+	.ascii	"\330\253p\317n\221\213v\321n\332U\353\323{\036(\336\223\2077"
+	.ascii	"\335\213\335$>\205.\354*\361\0166\300\234\245\001\273L\226\334"
+	.ascii	"7\035\367\355\277\376\204\313\344\272\335\267\373v\341n\224\276"
+	.ascii	"\273g\363K@\211\260\360\345=\3679\256\334\273\315q\3359\003\210"
+	.ascii	"t\264\235\005\331\272uU\356]\326\275C\201\3658n\235\335\275\273"
+	.ascii	"\303\273yU\336\212i6D\206\206\220\327jySy\347\335\362g\2500\243"
+	.ascii	"\370\346\345\202\376\230\231ANK\325\345\273^n\337S\335\276\237"
+	.ascii	"z\033\227\357\206\271}\267\357\372]2}I\326\204\301\243\342\364"
+	.ascii	"\226s\301\033\350?sk\262\200 Qs\317\334\277\033\230\346\006\026"
+	.ascii	"\201A\343\200\367\314\005\274\2017\360\n\336\032\372\266\376"
+	.ascii	"b\f=\\\231n\275\247x\031\326\331EtW\342\374\220\220a\251\246"
+	.ascii	"X\247\037\353$\352\363\030X\252*\326\351\024\201\275\022\004"
+	.ascii	"\303<2D\366,\330\265y\340\035\347^\330\256\364\b\033V\031\222"
+	.ascii	".\354V\026\333\265\307v\221 {\372\026v+\007\333\325e\002\373"
+	.ascii	"%\006\357\331\364\274\267\252kKzKq\030X\260o\"\345\216\025\373"
+	.ascii	"\240-]\260\260;\370\n\213f\305\353\330\035=X4\2641\366\307\334"
+	.ascii	"\034\013\244\337\312\326\246\323`\242S\016=\317\201\2335Sy\276"
+	.ascii	"G\210\307\261fQ\\\n{V\204EKS;\345\371\226A\215\\ \034\2536td"
+	.ascii	"m\272\031*E\357(\356\204U\342^\310\242\270\261K\274h\007\340"
+	.ascii	"\225\220&\254\033\023\026\356\005\026\256\210\254\315\227\260"
+	.ascii	"no,\034\\\0246.\355\331\374\251$Sr\264TI!\260\214\005\336P|\215"
+	.ascii	"\235\363\031\032\n3\nWc\253\374p\213\234\b}H\332\266%\240S#l"
+	.ascii	"\0357\234\273\300\206!\321\202\243\261ul\027"
+	.ascii	"F\355\364\216\305\023#\366t\340\214\315\353)d\254\336\332\364"
+	.ascii	"\036&:\335!6\177\2127\374\016"
+	.string	"\313\205\231}\204\316o\240\243\332\342BX.e\276\002\353\205\217\r\343}j\247:\337e\3248\311\361c\221\202\363\247\226\374\207\n9\037l\254QT\246<4\301\315HF&\243\222Hd*:\035e\034\223H\2421\211\\*\215\311\021\314t,*E%\205Q\311\225\227\214\234\212L34`B\212`\343\262(#]:\031\233\226\312'\016\222\212El\224\341TLr\220T\2641&!\2334@J\036!)u\340\250\247\"S\361\210<\0061S\361\2304*\205\274d\024\225<\212J\016yF\261\t\345%\243#\020lL>-\213F\245U\251\303Q\307&\342\r/\031)k$\215J\225\227\214\216\226K2\216LJ\036\370F\207\030ulj\272\321\331ae\t\242\r'\215Q\307&\225\215ME\247\224\2155\212J\244\023\221\207\2252\234\216\313\245QI$\"\227\304b\362I\306Q\311\t\211D\\\032\225\306$"
+	.string	"\354\204<*\223\306\032++\223l\230\211\251\210\262R\345\031+'\215Ke\261I\270,&mv\222\2163\206\306\032\305\n\242\214IN1\214LG%dr\002\343\262H\001\0232\271tB\"}X2=\025\225\214\f(\231\212O4\214:\035(\213\021\314hzJZ\225N\310\343r\006R\250\244td"
+	.string	"\231\244\032\235\216LIMHBF2:2!\035\031\221\212JI\343\322\351x\344t,6\035!%\225GF\037\0309\303\230<Z\"\221\311#\2346\033\375>\030\207\214\330\323\306SIm!\003\366\241\210\350\213\276\343\372\304\020}\257\tz\361\360BK\231\231\026\361/:|\370!\020?\364\035\307\367\005\304\267\021A=!\027\353^\231\026\361.>|\273\365\003rG"
+	.string	"\203<tx\017\\\366:|\323\t\346\251\261\331\020\nz\241o?=\250UKPJE0\213\032\211\033Vx"
+	.ascii	"e"
+	.string	"a\346\bJ\247\344\335Iq)\222\362\2626\323\265\2621xW\244\376\210\370\354\252H\205\351[\233)\227\025 \277\245\007Z\373\3711V\021d\210|\341\032\207g\322%\324\276@-\361O\004m\333\266\365\371\261%]\342\221\277\201\234\332\017\231\001\376\347\373\331\017\230\251\225\370\001\336\0051\177j\206Rf>\016\252\343\244,}\r\301)\201lP\244\376@H\235Y\233\251\226\024 \363\307\230\264\273\177\223\n,\222\022\\\233h\f?\246\205\347\022\367yf\251\301;\225\364>\r\230\251\3119\327p\3701v\001\205\207\306\013\327v\370\352sx\264\017+,\354\350\371\261\276@%\3614\276\203,#\200\31506\367\037V]'\004?\374\316\353\007\314\214\f:\327\220x\b\236\335J\006\033>\370xJ|x\361\374\030_\021^\tT\202\034\250\302\350,\322\262 CJ\215\214\210H\232$\035\222\013\020\210\242Q\336\273\335\022"
+	.ascii	"\004M\224S\307\206\2649\352\234[\005\323\320\314\373\355\211"
+	.ascii	"z\3260\320:\260+\362u%\204%%\205\323\\;\013\f\321^\r\b\324\274"
+	.ascii	"\314\016A\375"
+	.string	"\311\362\262\240_In\310\343\214^\343\274\356\236\211\\6\301J\237y\276\016e)lw\372\224\250>\256\215\024\247 [\356\243\353\256\342\262\352\341\016\337\276\266\016YaK\301\305S\342\357\216x\326\225R\245<iZ,\b-\205(\363D\277\t\t\b\322\3176\262o\216\317y\213.\310\250\022\261\"\357\342\272\271\260\330\354\317:\260\335\242i\263?tZ\230h4\206\021\324x\326y\371D\313\301\354\372\303\220\3426K\037\215v\377\340\320\220{\373@\256\223-)*?Z\377\266G\222\024\020\325\323E\220\215P\326I\211l/\314\003\312\306\240\235\310\025\006\217\316\037\352\354\371\035\325 RbT\303\360\353)\204ix\307;\304\235g\001~\252\264\247\261\036F\210j\340@\026P\277\334\262\212\300\27097\341\320vm\020<\234H*k\033\021\004\261\316~8Q\341Z\371LA1B\377A%/\203\326\235\031\342T\206"
+	.string	"\034\001\177\233\317\177J\314\272B\022\231.J]\b/\245D\340\263\354\024\002\345\221$\005f\226\343\265\347\237\374\231!\3235A\030\r \255\225\3523\342x\271\026\363(P\274\365}\373\021n\316\250\210\230\231{\236R\274\352LM\032W\244\bX\345\374\351\221\027\030\241\215\315\263T\226i\271\322\255\374\003\377\214\253\360\212\314\314o\023/ElA\271\2779\211P\013;[\342\345\020\263\320\233>\271\251\237]\353%\366\3071s\246d$hf\032\377%3a\030\307\245\261\\\310\"\2068&\335&\266\205\264\247\302cG\323\317[\335G\217\211\354\177\240W\034\030\232\303\304\371\341\321NF\326\367\\\325*\032\025??\323\201\362t\264[\323\212F\371\234\244\234\032e\331Pm"
+	.string	"^pj\\\212C\316\302\270>\352\344\376O\304\360\260\206n2h\036\360\340\220$*\017LTx\0206{\373q\370\321DZ\004\\\346\001\243\356\223\300\224\223\313o\314\2174F>\270\367\363L\333'U\327\223-+\311\311\350>\221\2133]\234\375\254\355\231\361\233\226\344\3276\344\212\213\250'\220\016\036X\320\324\340\233V6\304o_\022\275\321\357L=+\264H@\313\\\037q\346f\312\361\306\316\204\005\371u\034R\337\214\363\024nne\367\276\034\277G\325J\002\374\257w\200\374\263\3503!\335\330\f\266 \371E\202\356;"
+	.string	"T\213\233\315\216`l|\017\f\216\341\370\026\325\214\317\371\210*q-\241W\244V\2314!^\237"
+	.string	"\227\034\201I\t\006\376T\236\354\373w\371\312hx\327\345\bb\207\271\345\t\316\213\336D\006\356s!\034\307T\027\327\262=A!L*\031/\271\310\034[n\"0\317\276\f\262$\001#\342\322\265\304\201C\312~f\243l\2474DF\020b\333<n}\341\332\001F\215\355\013\377SM\337\352i\"/^\272:\321\021V\021\247\336\020l\205\fyc\ti*\370\313\321\246]\231TP\352\233\r\350S\026\332\277"
+	.ascii	"\232C0 6N+{]\233\246\201Q\3715F\036\030\232\021\345\335\355\361"
+	.ascii	"\202\306-\330\251Y\202\032B\f\2065\025\206\322\274\r\345 \276"
+	.ascii	"\244\231\351\230\250c7o\321;\334\276\272G\034\235*\256\032\245"
+	.ascii	"\343\355\254A_\332a\020\361_;5\274\371\367\251\031\312\255\277"
+	.ascii	"4\2418m\243\252\2449\004"
+	.text
+	.section	.gnu.lto_cliDump.268.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`\027"
+	.string	"\235\007"
+	.string	"\362\21667Po\322\001\2006_g\314d\250\021m\357\242\213\2019\330XiT#\360\312\215H\020\347\267\340H\264x\236X/23\210B\004\303L(^\316cfm\033![\246\024W\206}\032@2c\331\301>2^\322\343\260]\241\f\213\031\346\001E\271A\304\016\201\265\207k\213!M\333\"g\356\341g\206\324D\235(`\205+=\270B;BB\357YQR\035\250\223\bv\366\354\024j\330\257vw\r?\373\246_+\270\3621\272\310x\311dw\364\342\262)V\t\007\307\366\325~\310K\334M\023\007\330\375@Hv'\202\r4\267</\200\271\245y"
+	.string	"\346\2269[e@\264\235\002\313\211\305H\313\356F\270q\356\312\371\027\371\306#u\327\314\302\356Z=\022\306\ro\273\300v\202m\217\b"
+	.ascii	"2\001\003xFq\341\005L\271\004\333\254\246\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_cliDiff.269.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`\027"
+	.string	"\225\007"
+	.string	"\022O65P\2153\006,M\254\002X\335\245\021h.zT\020\035\036\021I\345\330y2\243\b)7\250\273\313\023\273\272bf\020\025X\251\316\034\024\361\267\346\255\233\020)S\n\230\226q\032:\227\245\227&\343\\\023\2736\016\034\346\321\262\251e\233\316\2748\210\251!\350\366\200q\323\263m\334\314\204wu\t\226\001\205q2Q\310\212V\361\300Q\266\021\022\321_c\t\365\223\351#\2756\364\242\334h]\375\177%\330zd\307J\232\220@\027\032\026\245~P*\345$\026\251#\323\326\2615\210E\235G\023\006\370\301\217\221?D\250\301\305VC\013Tl]\034P\261\325\256-\031\370\334S8)Y\210\240\374\237\222\303\235cW;\304\230/\3449Z\026\3767~\241\fW\272mA\333\204\266\036\001\b"
+	.ascii	"2\241w/pq\341\005L\271\004\333\254\246\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_cmdTable.270.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`>\020\215F"
+	.ascii	"\372n\374\030=P\354\252\003\351\256\0028\262\020\300B\201T#$"
+	.ascii	"\303\b\n\240N&\232/\"\262\373\346\367\367\327\362-\366\333@ "
+	.ascii	"\336\203\263\002 P\rr\300\241\336\304(\300\202\250P\320u\177"
+	.ascii	"+\223\224\001\212\001\220\001w\001\017%\326\345\004H\317\206"
+	.ascii	"\232]\311\003D\3227\362{$\352+I\022\213s\244\013\331D\366\033"
+	.ascii	"\363BU\244\033y%\222\375\306\250(\351YT\263ky\373\036\377C\375"
+	.ascii	" \017$\326\304Gg\342d\277z\024\224$\202\277\3619\324\327\361"
+	.ascii	"\257\356\3648z\224)\373\325\203\252t[\223\3202\001\223\224\372"
+	.ascii	"\306R\272\253yu;\"u\233~\245\333\232\205\222\n>\205Rs\330R\237"
+	.ascii	"\001\325\263\334\216\310-\373\325\307\336\245\333\232^\311\005"
+	.ascii	"\227"
+	.string	"\322\234\351\2277\251\271\023\247\356\005\314~\265\017M]\314&\263\337\257\204\251\233y%\232\375~\2334\235\346\247\271(\311 \322$5SR>\032*I!nG\344_\351k\272\255\371\325@Q\232\027\3752#5;j\324\331t7\373})T_\037@\354\367\207x\205x\245\210\375fR#z^\324\204\264t\020(\315\203~\271\220\232\017\031\"Qb\277yIh\267\263%A'P\354\227\206\212\016\240I3\322\203=}\324\354\247k\005\213\375\266|v\267#\262\347\242\333\232\227\222\020\344\244\231\316/\333Q3\236;:\253\375^\325\271\332F\343\213\356\327\004\325\234\335+\371~?\370zF\324\304\2644\032\267\"d\004\263,\313k\322\314\365\313m\324\374f\215q\032wlyp\323\356\341~7\260\221q;\"\215\306w\306~)Pe\031\3164fY\206mt[\023\354\206#\246\321\270\225{d\031\226\245\300\030"
+	.string	"\243ZG\252y\374\264\017U\003\371QK\322\243\310\247k\277\033\223\336Q\374\023h\277;\316\240N+\303\364Z\312H\245\332\370\323[\252\306\241ol.\255\265\265\224*\026:\264\337\255\225\250\317"
+	.ascii	"1\277\226\263\260Q\242h\243\274\272\215)\211\266)\375N\277\007"
+	.ascii	"S\037\324\247v\323:y*\206\355ET\234\212a\257\244\345\371\352"
+	.ascii	"\271@(Ie\216\\F\343\326+\323\257\364\373K\352g\302Db\323\346"
+	.ascii	"X\242i\241Tl\364\312G\373\235i\212\324i\200\230\237\226\265\257"
+	.string	"\364\033\375\376\221\372\221 UrT\f\3333BT\214V\274r\326gR\317\200\230\241\222S\206\020\251\257(\321\254\315\241\"\245\242\245\375\316\252\0241u\033\223\t P\232\271\006\t\"q;\"gP\212\232\272\215\331L\332>O\372{~\337G}?\3375[\302\247\310i{\332\257\214\251\247}\245\314\323\247\236\301\230\245\222\001\340\244/\347\367t\324\267S\347\322\234\253-K\024\247k\275rO\250\236\301\232t\004\250\341R\277\r\233:Tk\212a\267#\2628j\277\2621\315nk\326Y\016x1\351\223\371\275\031\365\321\374\031Y\2272]k\313\236P\215\351^^)\343Q,\325s\247\346\036\002\317\345\221\352\177y/\262\033T]\272\326\355\210\274\261\337\030X\216nk\362)P%\375+\277\314\245~\026,]\307\355\210\344\261\337\230\322J7\362Z|\364\026\315>\006\232\244\377\344\367G\365\245D\211}\005\353\256"
+	.string	"vy\033\303\276`\352\272\274=\271/\210b\355\006`\253\034\037\002\321,\\\207\034W\321 NW"
+	.string	"\023S\265\225\341\323\206\2035X\316r\"\017]\201\265\251"
+	.string	".o9[\233\n\220#\256/pg\216\210\006S\025w\346x\234\013[\027ew\354p]\263X\336\342\316\034\007\016Y\334J\303\355\320\206\333\031n]\324m\317_\213\272\004\260\225\212\262\276\325mS,\235m\343\340\232\266,\317:e\254Xm"
+	.string	"\274\273\220\002wU|\207\366X\356\006\323\252`\212\252U;\266\255\272\340"
+	.ascii	"\257B\316V\271\353\312V\001\300\031N\216\223\363d=\371O\006\224"
+	.ascii	"\021\345D\371Q\206\224+eK\331S\006\313\242"
+	.string	"\362\250\327\372\255\337\361<^\310\017\371%\317\344\247<\225\327\362[\036\314\207\371\344\247y7\377\346\357<\236\377\363\200\236\320\027z\257_\364\222~\322k\322\360\241~\371\314o\352\034\372\325A\264\020\255D/\321G\035Eg\311\240\275`(\242\321K\255\205\213\252\221]\246\360\350-S\3104\335\306\024$%\325T~\332\212\252\261\350+SYt\225\251$zJ\255\322\232>\023\304\024\264|\315D;Q5\224'E6\333\315~k\222t\223Z\0378\335\306,\224\324zH\252\213\374\364\021U'AR\264\263\347\030)\312\241\263\337\032\026\"E;x\366[{\242\247\317\2160\275\222\261\230\373\202(\013\203\207\326\334 W\335v\b\203\207\022\207h\f\267\234\267\356R\337\n\fr\026u\211C\340\013\215Y~\256n0=\025\340\032\004l\265\006u5\334\353\245<\031>\325\225\355\235-\367M\240\200e.z\n\325!\357"
+	.string	"\266\321\272\300!\332\343<\032\247\025\020\210\326hk\324`\271\333\242\252N\002vS\"\227av\350\242<g\241F\205\003X\206[\356\242\2763\210\002\205.\226/\005\366\3346\345]\245\255\020w\346\\ \212;s3p\033\260\313}1|r\340\0134e\321\254\323\345\276\003\330JG\303\255\3207\240\025\372\316\006X\b\344X2,D\325\030f9\217]w\254\003l\225\023\242*N\267g\004p\233\002\005\250\352\352\266\303\335\201\031fWwU]\356\023\240;\r`\031v{(\273;{\353)"
+	.string	"\363\202\303\265\275\232\201\002\205"
+	.string	"\266\rs`\332[Y\341yr\337\r[\345\210\234\027Lq\272)Ldi\270\355\241-0E{.o\253\"`\"\273q\313\236@\036<\211\354\003,\303\356\272\276\340\354\311\013\242'\317B[\002@4U\200\r`\227]\205\250\213\362N\fDS\226\267\347\352\236X\276\341\312b\271m\213\nO\016\247\025\347\255\252\356\264\342\r\321\027\2723\307Kq\025\360\f\267k\026\313\016}i/\030\201m\250a,\254\230D$2\222\024\244$\205\306\261\205\206!\351\320\016\021\3208\346\234)+I\n\323n\340H\253K\366\221Znh+l\273\013\241\357\262\3254\374\256\3535\345GP\262:\257p\034\024\"\2767\240l\371\242\230?O\246MNg\230\3368\363L\233Cr\230I6\342\372@\366"
+	.ascii	"\345@:E:\270\264\036\230\272\0300\310l\340\005\356\200\023LN"
+	.ascii	"\177\355\261\273\304\326\215\245\227+4.\323\252\356Kf\236/\017"
+	.ascii	"Y]\263\331*\023\255r|\223\365(\244{\377\022\230~\035.\206\236"
+	.ascii	"\361h\224\300\357E\tF\325>\322H3\210\200\363\216\273\364\313"
+	.ascii	"Q!d\263\360\204P1\352z\316T\274\305\374-\240%\246)j\316\335\257"
+	.ascii	"\nLmE\020\340\327fF\\h;\342{@\005\030~1\206x\220X\325\377_xn"
+	.ascii	"\253\005\307\261\210\026\3765\260P]\002\t\246\361\236\302\247"
+	.ascii	"R\206q\351\254\344\005\177\367\245c\213\326\350\350\374\236\237"
+	.ascii	"\007w,\270\334P\364R\364\360\343\224g\031s\3004\020\rX\033\210"
+	.ascii	"\251\254\2204\243\025Z\356^V@\226\336\025\324.\231\350\336\366"
+	.ascii	"w\270\2169\343\036a\201\005z\3007i\t\263\335\356\353\214\264"
+	.ascii	"|B\242\b\006\310\330\342\273e\325\360\3063\335\344X\b\265<T\203"
+	.ascii	"\003<M\220\352\013@\026\360\213\325*=\275s1\034\006\252\3347"
+	.ascii	"\371\032S6\361\250\021\224\233\n\\4O\265\306\345"
+	.string	"\362\261\372\307+\343=\3144\316\316\247P\372\343B\330\025\006\bi\241X\213\0061n\350\252\244\356\274u\235\2652|!\205\302. y\002\031\244\365\236\235u\024\263\300\332\247'\357\001\327\364\360\037qI\374\226\230\t\365\277\256\335N\260\302#\304l\026Y\324\270\200\346\316\226\271 \222\020J\271\020Rb\n\"\213@\033Zm)|\237\206\260|\003]\227\341\032\005\211Q\3343\371%8O-N$\202\250p\t\270\344\216K\200\350i\313\005\363\356\264w\023@\0054Xq\302\352\203\313\303"
+	.string	"\322<\r\334:\242PG\001\323:\bs\271p\232I\254D"
+	.ascii	"\020q\2540\020q\233?\253p\254\276\245\336k\240)\352\210\312\365"
+	.ascii	"9\364\302'+\233\020\222\177\f\036\256\276\322dTb\271)hF\364\300"
+	.ascii	"1\".a\234\216/+MS\207\220\275ma\006\005\323\253\221J` t\230\233"
+	.ascii	"\342\253F\3036\005\350\245\226\022\362\370\231\026\377T\220\272"
+	.ascii	"\007\226\bL\017"
+	.text
+	.section	.gnu.lto_cliHelp.271.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`\313\002\355\024"
+	.string	"\226e\210J\240\326Q:F\037\27585\257^\337\236\006?\247a\035u`y\005\313\232&I\247\257q\017\325m\203\244bU\365\337Z\351\351\203\016Is\177\344U\370t\030/\307Gi\340\331\2542m8\344\\r\320Sk,\371\204\020\271S\nu"
+	.string	"m"
+	.string	"t"
+	.ascii	"\346K\337\354\252\003?\025\027\001\253\n\310\251I\255\025\266"
+	.ascii	"-\334r\022x\237\364v\327\3312Kr\351\315o:\231D\274"
+	.string	"\342\365pw\221\264\302\220q##\212\310\n\307(\250\034=Y\370\210\336\032\272\tt\341\251PoG\313\022'I\226#T1Tz?\344\002\023*\242Rz:\272\027~\006\253\270d\205\217\350\264u\241\326j\312\353\371n\224\333V\262\215\301\246O\001'\213F\243\023&\037z\\\253,\"P\273?\033\210\243\001rFJ\336#\373\365\340M.\365.5]\352\253X0\222\032:\325\261V\021\307\254:,\247\222\036\274}\240/\274q\034\267\007{^}\365A/\260\212Jj\005:x\351\007\347K\027\362)\266O\355\327\270\215\333\231B\\@\255G4|\324\n\204q\203\363\245\201/`\276<O A\200\374\330\315y\"\234Q\016\240t\357\364\251\r\006\210\265\356\316\343p\356 0xi\323\304\236\344\3128\374Y\034\r*:\312\221\373\263M3\351\326\202Ht\264h[v\036\264\004H;tV\210Rts\214O"
+	.ascii	"\320\257=\363@\317\263L\n\335\342l\337\034\212\246\200X\253N"
+	.ascii	"\202m\020\327\241\303\202T\253n\302\323s\330\310\273x\351\017"
+	.ascii	"<\346y/}\236\2750\266\275\270P^\246m/.0.\346\3542\234\231M\207"
+	.ascii	"\233X\313\261\230\231M\f&\213\321\324\324d;83\030\316\214\346"
+	.ascii	"\006\026\253\331`1\bL\313\221\325`;4Z\r\226\002\254o\372\205"
+	.ascii	"\212'\206>\233s\355\3172K\255\327\226K\324B-gr\262\326Z\317\375"
+	.ascii	"\275\307$\367\2655VE\204\354P\344\350\321+\324\236\311\020U,"
+	.ascii	"\032\346\026G[;\204B\221\204\271\277\036_\r\0177 \260\002\231"
+	.ascii	"9\262\r!\360\036\037\210\331E-\022\276\365\356\261F&\2007\314"
+	.ascii	"\230\260}#\366\023Bw\243E\344mYC\340\300\220\344\210\307\333"
+	.ascii	"\344\016\007\213T\206f\244X\227\214\367\210/\2739fk-\231\215"
+	.ascii	"9!\337\260A\315\264\233c\366\341\226 \267t\347\350\366\324\f"
+	.ascii	"g \315ig!\254\371\351\274]\f\213\340f\255\307\2005\234s\274\213"
+	.ascii	"3EI;%+3\265\342\t"
+	.text
+	.section	.gnu.lto_cliProcess.272.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`\023\030-v"
+	.ascii	"z\275\300*K \220\342\031\003@\201\323DnH\0223\301\214\205d\025"
+	.ascii	"\013\230\210\235\207\276&\003\303D\310\373\363\355\254)\202U"
+	.ascii	"\353\231\213XG\267\"&\020\235a\221\213\\t\036Z\332]1\256.\271"
+	.ascii	"R\n)\035Te=\224NE\233$\221)\245\024\244\002a\002\243\002\355"
+	.ascii	"\344\005\373\252\335\275i@|\324/P\311>\362]\262w\332\276k%n/"
+	.ascii	"\201\301\224q\367\242-\371\250a\346\026\235\222}d6O\333G\266"
+	.ascii	"w\332>2\367\034w\035/\3738e\3456]\214~\235\357\213h\025H\230"
+	.ascii	"\367\275k\352#3%\373\350K\227\031L\337\271\275\035\252jfM\026"
+	.ascii	"\337\367\215z\037\356A\311\327\207\231oj\210\232\275k\206\342"
+	.ascii	"%\366J\272\315w^#\272\270\266\264\262D`]YUQMI\205\210\202zrj"
+	.ascii	"b\002\261\244\224\204\364\341\310\250\210I\344aH(\b\250\303\217"
+	.ascii	"O\017\017\207\235\r:987\254\304\246fI\243L\"\333#\373\356r\217"
+	.ascii	"5\337\t\261\225\321\220\312p\257\264k\217\350\242\201\253.\316"
+	.ascii	"1rU\317\370V\325\214k"
+	.string	"\3155z\326\034\243\213\300\232C\364+\226i\215\213\215\036\204.\262<1\360\240\241\343\240`\334\nI\202\0028\3040\326\256\242a\217\312\260\247\244\250\035b\020Z\030\007\375\342Q\201~\\\034\n\260\237\376\002\335\311\257\017\200k\024\004\354&\3038\350\026g\212\203\3629\210A\250\226\275,\276\204\245\225\260t\322^#\rB\367\366\364\374\303\241\024?:\314s#$\t\266\264\271.b\251f,\252\320\203\320(lM\243\231\f\035\007\205\342\314\233\300\3005\033l<h4\021\333E\345F\r\017R\230\330qP;\367\360\204e\326\325\371\220\265\205\346^\360 i\003\271\264;\310\365\017\213\234Q\343\255\007\241IX\021\215a\374\336\334\247G\032\\\367D\253\200\211lip\315#\307\201\275B\333K\322\203P!\254\022\f\221'\035\007\035\342;1T\237$\366H[\353\rH\022^\252{\211liAZ\007H\034\364\207\347"
+	.ascii	"a\231qP7\307a\271\350\222\374\350A\350\016\366\227\340]\351\274"
+	.ascii	".\212\203\006\361\233&[kV\302\032\r\221J\351Ah\020v\310\217\211"
+	.ascii	"\221\036\2662\021\334\206\365\327\b\222\036\204\352`\273\256"
+	.ascii	"yP:\317\3515=\322T\350e\021\r\3534C\221\024z\020\232\203\335"
+	.ascii	"\301!e\206\216\203\246\340J$\t\027\252r\211li9:\3112\205\351"
+	.ascii	"#\303S\343\355\331qP5G\262\314A(\016\226\371\276\357\022\315"
+	.ascii	"\314\333\316k\002\340\250\213*\364\221\205\342b\203\256\007\241"
+	.ascii	"t\254\016\017\303i\327\265\237\241\315p\266E\244>\231cdK\273"
+	.ascii	"\366\263NjP\376n\320\312\330\035\302#<Z\332\354\r\2662\032\356"
+	.ascii	"H\022\357\373\262?\321\322\232\003h\346\243\0253\303`\336A\021"
+	.ascii	"W\366\222Y/\342\317\230Ub\365\332\216+u4T\317l\022\353\257\376"
+	.ascii	"\214\231\331;-\325\203=\030\037\365\3524R\346W\317[~\224\317"
+	.ascii	"\254\2211\201\346\333\2724\226\341\264\360\327\320\002u(\331"
+	.ascii	"\265\367\331\234\373\250\325!\311\246V\276\367@r\344'\277\245"
+	.ascii	"4\325\225&\337\227\254\237\334_\272\320E\302\256\234+\365~\272"
+	.ascii	"\322\326\245s\355\274\237\312\357\034+8\031\200\366R\"\371\276"
+	.ascii	"2\256\270ep\325\004H\ny\321\3661\371^\205u\315G>{hf%\363kw\031"
+	.ascii	"\353[\033\022F\333\374#\236b\027\3043\\\240\264\037\025\354\030"
+	.ascii	"`\020`\200\001m\037\233\337y\215D\250\230d\215.\247\214G\222"
+	.ascii	"c\007m\373`S\352\361\331o\337\253f6\274\216\377^\224\035\243"
+	.ascii	"5\361\354#\021\251\201f~e~e \377gV\300\204\367\323\3043;Kkq\301"
+	.ascii	"@\003\r\264}\374\357\272f\265X\253\310m\r\371q\002\313\343\375"
+	.ascii	"\314( \360~rS\243\235\240\214\037\373\2647\030\376\243\354A\333"
+	.ascii	"o\301\264P\206727\225\256\342\001\267\020N!\201\367\263\217\334"
+	.ascii	"\022\264}\354oi\037\2410\346\313\032\235\032\231_\231\357\306"
+	.ascii	"\374\243\314\315:\3312\307\337\306\034\006\326\301W\023\305\003"
+	.ascii	"\255\327|\242\351\232M$\3405\242\213k\253\2274ke\211\300\272"
+	.ascii	"\352)\315VU\035\245\231j\351<\325:K\3218\207\260q\216Z:C\335"
+	.ascii	"8?-\235\235n\234\233r\234\231\224\316 \272\257y\251\235"
+	.string	"4+\3318'-\235\221\226\316\037\226\316G\375\244\331h\351\\\264tf\3428\023!\235= \235\207\220\316BKg\240\245s\007\032\347\237\033g\037\033\347\036\2453\317\322\231\303\322yg\351\274\301\306YG\351\234\243t\306\261q\276Q:\333\3248\327,\235\227Jg\032\032g\245\3229\231tF\"\235[\244\363\021\351\314\266\316\177t\356\017\\2e]\232Tq<\341\335[\343z\346\025<\372\301\365\224\356\276n\275\356%\335N\272\237tG\351\246\353$s37\037w_\373\345\274\203o\247E\257S\226\210\215$\366x\251\007\002\r\342\"\226\021I;\356i\3435\224\316\343e\224\027\3141\235\367m\243\233\242\365\344\005\2112\032\336\206e\016\013U3\351&nM\315!\210\004B{\342\217fg\220p\371\221\303\271\322\t\256M\026\337Dp\317\274\237'\336\363\2548\004g\374\030\t{\255chE\363=)9>"
+	.string	"\266\207w\266\241\027z\017\177T4\263a3\364\355\237\231\037\215\320\263\2129f\332\274\034\231\231R\213\310@\201bdF\260\314\207[\303\007-\351\\\200Q\257JB\321G\271\006I\031C&&N\2540\257\274\355\234\207+\355\371\302v\002\005nh&\221\275\330\231\021\025\362T!C\364"
+	.string	"\364\3756-\\\003\302b-\303\250\326\004d\306\337Pc1\352\030#\004\202\n\324\3013\333!\354\265\264\276\303\227"
+	.string	"T\241\303\373\374\350\356F\273r\246\205\2403\255\365\035\374\016\037\030D\347\332\3173}\376\347]\257\347}\276\315\254O\307\321L\252\365|\337\260\226\221\363#\363\253\217Q\301\262\b\364Q\346\t\374\253\373\351\301\366\331Q\005\f\207\346\207\375\031w\207\217\342psT\021,\373\311\353\247(=_\317,\217\321W\375Y\325+\275\017N\003\231\217\211\233\236\317G\r\273\352\277>\250\306a\031\247\021)W6Wi\231\335\035.\013of\212 \224\363|\212\025d\374\230\247\335\340\371N\263\"2\276\023\031\350"
+	.string	"{\240\274\2458\324\215\016\271>\222\316\002\224~\270A<\317\2144\031HE\344\371(+\275\321w\343\224j\203w\303\005\016\203\315\341\233\215\004\016\177\302z\310\270\263\343ggz\371;\277\003gx\275yf\316\300Eh\022\321\360\251q\210\367\024CE\007\231\266\r\037\345\244\300,%\344,\377C\004>CFO\261\316\260\310\354f{\304\307\232Hn\357\373\212\340\376\342\257\225\333\230\ro\355\247\230n\030\355\207\337\360>|4\020:\327\274\205\304(:\037\2556\214v\371\0377\375k\362Q\244L\216;\244\275y$\231\037V\366\b\301\340|T\347o\276\007\247\023\350\340|\316\3774q\032)[l\001\347\273~\3245\231\013\334!\334%\332>\336|\237\245P\3634o\363\3554\262\374\232\3571\313O*\024\363\002\rk\265\312 WG\346\327-TD\260r\363Q\356F\0361\201\b"
+	.ascii	"5Y\257T\203\365F\177f\344f\007\247\244\206.6\354R\304S\315\362"
+	.ascii	"\262\226W\357C\252C\314\370\216gY@\226`"
+	.ascii	"\177\244\n\271Q\375\231\224Ft\213T}y_\347a\203q\341X\"n\221\344"
+	.ascii	"\373:\221\202\315\207m\037\251^I\250h7\345\"\303\033\233\357"
+	.ascii	"\306\232\255\371(\273\222\n\205\035\001\234d&YVj\261A3\003%\346"
+	.ascii	"\013\2600\246\323\005,*\340\200\203/\025L\026 |\261\320\200\205"
+	.ascii	"\003B\\\200\324\226T\212\240\003\246R\004-\031\201\024A6G\027"
+	.ascii	",\276V\204\265\370B\266\350\0138P\361a`\025\204\271h\321^\300"
+	.ascii	"\242\331\202]\321*\232U@\255\330@ETSE\005\030\2005\303X\254\210"
+	.ascii	"b\261\242\002\016\242T\200\271\210\202\n\342\257\026M\260\250"
+	.ascii	"\260\257/\260\250\345\335\333\337\366et$>\201gv\204\325{M}\t"
+	.ascii	"\005\\\352\231\305\b\305\n\275\237S\256(\205\247\330\266F\327"
+	.ascii	"\245\307\270\202W\325\210gV\310\353\255\272\265\244Q\364FHy\b"
+	.ascii	"\023\037\342\221pV>3k\324\001.\246\351\223h\342\243\254P\210"
+	.ascii	"@\017\365\033\370\254x\316\2652i\237\222\256,W\310\270>\312,"
+	.ascii	"\224>\225l\2319\236\3406\325\002\354\030\355\323\227\370k\301"
+	.ascii	"\247GVi\200\3649\263\254e\246\177\034\252\260\215 \242P\314P"
+	.ascii	"\3540\351\004\341\212\244\207\317\320\034r\363\222\034\343\364"
+	.ascii	"]\216U\236b\\\332@\357\3647\210\325+\316\265W\222\345\3052\263"
+	.ascii	"\022N\2514~[\330\256>\312W$$V;\"\037\3257+\034W\035K\204d\251"
+	.ascii	"\232\352zf\231\274~\304\237u\214\266\351\233\315\377\0340\206"
+	.ascii	"\030\242X\242Xb\333\307\246?q\365\302\2506\200\373\333\274\245"
+	.ascii	"m\352\346s-\256\264\307-\213\230\242X\231+\232\240\363\307\250"
+	.ascii	">j%\204+\340\024\fNE\214\221\310M\314L\322\031\201R\037\337\272"
+	.ascii	"8Dx\225\352zfz\261\252\367\211]\337\230\276\375\232\rs\375\223"
+	.ascii	"\343\232N\t\001\265\365\354\264\365KP\\O\244h\305\351\201\357"
+	.ascii	"\342s\213$\271\371\236\320\227\245?\342U\t\243\374\272{\354P"
+	.ascii	"\004|r\"\315l\223\327s\375Y\026\365\t\305#\2014y\330\202\301"
+	.ascii	"\363\334\"W\036e\353\235:\345\222\024\002\235Bm=\212w\301\327"
+	.ascii	"H\210\354\223a\314\323G\331\211\364\003^\016\342\033\006\177"
+	.ascii	"\342J\253\276"
+	.string	"\340\225\2713\274\237\017|\343Xa\006\023\032 \276\255W+\214u\311g\226\033N\037u\366\234/i\016)\361\353c\013W*I\306h\t\302\327\004\342\350?\354\250\341m\211{\251-\372\263\242+\323G\311:\351=\316\210\3275\223tI_\365\303\017\347z\275^\033F{\364H\217<t\256\371\234\305\340\004\304\321{\334\013G\337\320\253\236\234\332\017\022/jKHIpj0\006\362\024\252U\225\222\230\177\344\017\237b\210\236\371_5\263\222\271\021W\232,r\342\211\276\223\\\361\312\b\235\034\t\201\375\250\2018\003\025SfDDDD\222$Ic!\005\204 \307\240t\347\001\021 -T\220\215\214$I\032\003q\374\3504\215\217\003\005\305\321\251\025\260\004B\230\216\243O\274:\322\2378\363\312\335\244\351A\020Y38d\027\264'\rN\241\321\003\214)\211/\321\220\355f\204\0337\344\210\nL\377\343\223\025\313"
+	.ascii	"H\021\\\031\211x\np1\311C,\305\334KP\257\276Wr\205\340 C\007"
+	.ascii	"\207M\315\366\"\304\210&\231;\215\237\226n\307v\025\372l\360"
+	.ascii	"\320\360\216\323.\2303?\246\265*\263[\311\026\352\313\037\202"
+	.ascii	"\007nh\220+#\250\257\316\022cm\236\037.R\331\031\3603qaUR\233"
+	.ascii	"\217\330\305\312\350\233\356\177\023\262\264\007\030/O[\223\003"
+	.ascii	"e\013o"
+	.string	"\265S\303qr\257\233\017v\326{4<'\213%5\310\327\314\2605\246\201\364BbE[\361\312\254\035\331\274\034\f\322\334\020*\315\306\246\331o\300\267\221%\023\345%g-\031Z\275\367\013\013>^\241\034X\236B\005:m2\374\223\343\025\260\263\377\001\322\327\t\220M?\337\254\314\341\205?\350\252D\261\362G\303\235\262\\hV\013:\320\276\324\204\317\227-\"w\302\234\263\272\"3\343\360\003\027\037\351A^\235\030=\267R\\\301\203\271\334\005\360\204\371\355B\245B+aJlk\207\324R\205\312\373M\224\b.c9\350VL\356\b\031\304\326\343\341P\304\030\363\321\352\212\336\021\005\244r\230\\p\006V\2450|7\232O\027F6T\017\021D)\230R\241\247 \273\023b\202`\262\021b\311\374\r\330\212\227\037g\214\224v\336\317\237\367t\237K\310;\006\223\235\230\017\214\3412:\202<L\324t;\022\336\200"
+	.ascii	"\263\002\320q\255.\364b\263\217\362\236/o0lR\324\003\3134\034"
+	.ascii	"\242\233\262\323\227\346R\0030\"\260X\t\223Vx\247B\256\f\221"
+	.ascii	"\027\200\\\206\235\243dy\340\370\201\247,\376\003\013\301\376"
+	.ascii	"X5?/\333\327\214,\27601\254^\005\326\360<~dh\263$'\256=\236\203"
+	.ascii	"\t\320\372\327$\003\tu\370\326a\215\312\253\025\227\321<q\276"
+	.ascii	"\204\267\200GEa\rO\214\027\223\270\266;\013\233C\030Sc?\004l"
+	.ascii	"\331`\204\271\2540\2341\225o\n\023\027\234\373\026\325\351\243"
+	.ascii	"\336\277\211\b\021\314\301\264\215\2062a\241\303\367\246B\313"
+	.ascii	"\232\214\037\026m;\303\305T\032\266\027\201w\356\226'}\344\362"
+	.ascii	"\312[\302\037\n\344\032\240\3157\007|\313Z\352\021Q\305oc)\313"
+	.ascii	"\236<K"
+	.string	"7\311rQ\365\200\337y\3559\t\013\317\024\315%\2172\211\037\031\026\366]F\251\f\241FnCW\302\306\214=\177t\365\235t\316\334^3\222\342\357\327M\271\001/\006\270hU\027x\310pT\005\227 \214Hp\013\347\252\025\210a\326\250@.\300.\016T$Mc/\013\226G\305S\202\352/\2715\352\334\221u\026Z,,@r[s8MCLYX8t\3000\243\027\005`\255\n\270\253\374\251\315m-\022Hn\376|\373;dv\373\034\357x\204\3318\002X\225\211Ez\300}N:\347\323\312\343\267o\236\335\f\005\002\216g4E\302\321\263\333\031J\222\204\371\374\"\027\217\030\234\0310\234\302L\261p\300\221\230\032\013\035l@\024e1\315\022C\2437\030\232\241\322\221\227\267\213\311\036\226\366\363\007Eb\335d\347R\177\327\242\2313/\\\017\255\027*h\261i\005g\226]:\027{\252\213\030L\206"
+	.ascii	",\333\240\020\026\340\364d\226\335w\225>\253\023\027\206Q\273"
+	.ascii	"\257\254\207\310\326b:\212\311\240\022\246\217[*\312I\005\346"
+	.ascii	"\357/\232n\212\206\360k\027\257\305\024\221\341\313(\021\336"
+	.ascii	"\217JS\356\205\332\310*%\020\274\223^\030d\216\326]\230\315*"
+	.ascii	"\002W\367U`:\314\356\362U\221\325\250i\242\213\355\366\231\326"
+	.ascii	"\271nb\025\313\177"
+	.text
+	.section	.gnu.lto_cliEnter.273.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`\277\001\265\021"
+	.string	"\026\242yH\340\322&\035\323\266'b\210\301\242\230\344\231\323\325\3375^\253\025\345\233\274\276L{\031\f1r\377\324\254\265\212p\235H}|q\370\220\246'\226\342$\0130\227Y\276\013\006\275\030k\017\310c\270(\366HkD\332\336)\005]"
+	.string	"`"
+	.string	"l"
+	.string	"\246tz\316\351\013\370\f\023>F\274\251\334\005Q2\355L\303!Db\373\323>\214\017\325\023\341|\300\356\317\020\322.\231\342\005\251k&o\262]K\235\300v\315\325^:\t\264\005\312%\231\321\220\335\355(\212\327\317\352\277\350"
+	.ascii	"F\236\327'\312\301\356z\216<\"nz\333\bl\323\330SA\251]\330G\277"
+	.ascii	"\306\217,\370A\327|AFf\305\242\363\250\0242\223\321\227K&\212"
+	.ascii	"\3323\337\374\350\2232\310,\207\276\214\242\276\321i\340\320"
+	.ascii	"\330\330l\327*\323\216\236\037\334\374\030\227\001\372A\336\340"
+	.ascii	"\232\037\257\371\256\355Z\203\222\251\005\020\330,m26\351\t\373"
+	.ascii	"\247\335]\323\037\373D?J\233>\235f\225\205\266\343Cb\026\243"
+	.ascii	"/'\230'\317\243\2720\001\332\325\371X_\244t\030\250\256\331u"
+	.ascii	"\250\026\005\360\t1;0O\324fi\341(=\321\313\232`w\331&\2454E\226"
+	.ascii	"\024\363\203+\271\244vsV\374\034O\202\360\002\003\263]\233\364"
+	.ascii	"=\312&\"D\324G\372\215\017\023bb\266k/2\3760\231(z\222B\005\035"
+	.ascii	"\267\322v\3626d\002V\335\324x\032T\\\br(\255\220\203\350\205"
+	.ascii	"\034(r*\361\353\340\2518\357\306\203\310\241x\030\300\027\316"
+	.ascii	"%\002\0137\323\372ZFJV\304\020\224P\263\372B\3175b\226\312W\303"
+	.ascii	"\352<\326*C\350\211\255\257k}+\233\216\025\272:\025\003\006o"
+	.ascii	"\274\260\023A0\354HH\330w|J\314`4\346\223\311\355k\212\315\256"
+	.ascii	"*\252P\217j\332uE  \220\002\221\253\272\001\027\016(\004\234"
+	.ascii	"\341O\t\353\330\320\236\033\360\270\033\354\235Fh\343\344\214"
+	.ascii	"1\261(\261\351\216\005\035\r=\351\250\336.\234s\201\027\227\344"
+	.ascii	"\\\330]s\005\333\"\236\0026H\376\223}8\007\374\020\232\341\024"
+	.ascii	"\300\345Ek\310"
+	.text
+	.section	.gnu.lto_cliInit.274.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375 \372\335\006"
+	.string	"\"\21503pO\032\003\344\016\351\336\007\022k{n\270\353w\300\210\270\204gOkd\002<\"\212\266\003*h\333\257\376\216.\201\305\315\2329t\035\331\033M6)S\n\017\222c]\016\235I\316\3123Pj#;T\254\250\2113\253\217%\243%'\210HMO\334\034\364\212\250f\374\\\327\214\231\355~Z\021&\036E\273\201\334\363h\r\360\377}Z\3534&.%\034\306X\3713b`\316\002U@2m\355Z\207X\004\363\210\204\t~\r%\345\337\026\252 \031v\263Ad(\271 2,\326\266h*n\021e\035\027'/\377\343\3730f\207\325&\261@(\003\331\0054\374\257\013e\032\356s\333\204\266\fm7\002\b"
+	.string	"2\003&j\006.\234\201y\227"
+	.ascii	"\232\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_getValueOffset.part.0.412.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`G\001\245\r"
+	.string	"v\032ZA\020\221\223\016\373\242\220\2775s\250\b4\363\234\366\207\204\3544\3275\274v\006\2229\177z\367\177\237\32674\036\004\202\033\b\361ZCUUU\305\367T_\355[\004H\373\240K\314^B\266\334R\246\024E"
+	.string	"D"
+	.string	"K"
+	.ascii	"Wg\227\375\020\330\311\266\017\342)\"\2170C9a8\250\224\214\230"
+	.ascii	"\261\233\275\353\306\005\270+>\200\273"
+	.string	"\246\206\217\236\330F>\232LH\317\253\336^^\2640\231X8j\336,\217\335\365u\341\326\333N`\373\331w\tm3e7\264\325\320\256\241\265\241\233\242\263\241\361,\3771\003:Rv)\254^\026\245.\035\354\2530;c\213\354\214\023\317\202}%D \333\n''\332\027\361L\364\225\320\001\354\246\\\264\354f\b\256>p\005\251\351`\220x(\341\312\231-_R#\203\366\002\020\274)\363*P\245$\331\376\334D\203kWB\207_\002\202\210\277\341\352\207\334\025SQ\260\370\240\022\001W$lc1.\224=-j\r\\\257:&\005\206\025$\244\201y\342l\017\035\007\037\233\007j\016\207\347\203\363:\234\215\002Pg$\304\363B<\033\220\307\001\211<\216\002\3760\350\200\336\310\347\003z\031\333\370\266\231\362U\327\240K+'\330\266\022\263t\3026\206&{d\236\330\326\304t\2312H2\224Z>r-\036"
+	.string	"\3157\330\307\204\326\274"
+	.ascii	"\013|\f#n\341c\026'\231\255W\210v[\003\016L\320\232\026x\200"
+	.ascii	"w\270\f\020\005\303\\\341\216\265\320\345\b\205\204\3209\357"
+	.ascii	"d\247=h\367+!p\357\3460\341\0316R\003i\036}m\301\003"
+	.text
+	.section	.gnu.lto_cliPrintVarRange.part.0.414.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`7\004=\035"
+	.string	"\346t\272J\240\230Q:\020\034<\266\346?\246\363\367\021\200\235\022\t\235\rQN\276\364e\247N\237\303sB\341\241\373\\\373\203\265Y\330\247jS\324\025a\332\257\360\\\036|\256\340\035\346;\270\210+\223\314\365\335\326/\242\265\204\220M\344N2\241"
+	.string	"\236"
+	.string	"\252"
+	.string	")\320\235~\024\244\367\310\210ke\276\2227\241w\3729\201{\225\264\240\334\233N\270e\b\346-\247\247!o\315\033 o\231\317\304\314@F\2142o=\005\3362X\325\223\352\272\367\316n\333\007\223\025\275Y\222v\354\nC\371\365k\213\357\247\273\371t\033\374\002\246\307\021\216\227c9T\024$\300\2577\336x\025\257.|%\372\tU2&\004\351\266\372~7>\216\020\212Q\304\004\370\r\2154EA|\347oW\373\302\217C\314\214\361\375\220^\013\034Vj\270\367\362\203r\234cg\346\035\314L\202y\304\020\024\256h\334\370@~\310\333\332\247\372h\244\267\225\244)\250~A1\223n\315m\035\036!\352\252\231\332K\334\260\337"
+	.string	"\275\212\334J\314\261\312'\254r\ffV6\311\312eY\231,+[\262\362x\253s\333\312\365\351\177\003\t2\354\270\267\350\253\314M\262W\301O\375V\347K\235\t_\310\247\025\320\253zX\266K\357\257\311\235\240\257\3521uF\246\023.,\025\314[\331\370\250C\361\251\370\374\324\022\237\032a\211\317/\317\bv\304\225U\2747\215p\3136f\024\363\371t\376\023\020\363yr\255\017(\223\311\023\201*A\235\352},\033\272\026\030\033\370@\3708\375/D:\310\036\273\354\363\212\230\347+\244m\262\317\033\"T\277\270\3336)\325;\303\341Yp\316^\230.\236qb\007\001X[H\356\335\335`\371\320\303\370!\004y\237O\237\2750d\354\223g\211`0\302\344\20180\214\322?RP\214\215\261\207\354\276\360\025\330\364\005\305eW\275\270\337SXC\277\356%fFP\317\344UJ\320"
+	.ascii	"\357\345\335g\302\344]xp\002E\275\217\001\f\231\210\273\3261"
+	.ascii	"s\212SQ\361)@f\332\247\324^\305\266Kq\361(\255{w\001\274\343"
+	.ascii	"@6\262\204\312\026vl1p4\0312\026\266\036\035\034n\303\200\333"
+	.ascii	"}r<986\334\n\032O,G\223\321\\\263\271\341j3[\215\326\"g\343\311"
+	.ascii	"\271\315rn\264\027\263Zngf\263\200u`\330r3\036\035\235\334\354"
+	.ascii	"|+\261\n2\304\240\026\342Jo\315\223tAa\361\246\177\272\006\263"
+	.ascii	"\2462\243AT\310\251\376\032C,\242P\353\312^b\001M,\254\255W\275"
+	.ascii	"\225w\02313\237\335]{@e\305\372\354\243D\356\0055rNq!\351\302"
+	.ascii	"%\3266?\232\202>\336{/\331K\260~\227\2311<\036\r\252\331\177"
+	.ascii	"\362-h\222\004Z\001T\250q,b\2204\002\207\224\220H \243m\306`"
+	.ascii	"\002\0313g\035\020`i\206\222B\007\313\003\224\340<\027\340d\022"
+	.ascii	"\200\340\374\001`\036&5f\226\240\306\263\207R\315o$\376\260<"
+	.ascii	"5#\326?;0/0,\304\320P\233\241\246\241\347\265\374\0331Cp\013"
+	.ascii	"3\263\0043\341\365V\314\3605Oa\362=b\214\023_<\024\203\230\350"
+	.ascii	"\365[|g\245\225\212\312?\216t.W\270H\300tjhP\223a\325\347X\312"
+	.ascii	"}\t\006\265\302\251\272\266\346\334\211\005\261\007(Z\027\302"
+	.ascii	"\f\317\362\361\302L\b1{\324\002\241\236\306\264e\031\355^\033"
+	.ascii	"\034\024S\356`G\312\2766)\332<a\220uE\005"
+	.text
+	.section	.gnu.lto_cliProfile.part.0.435.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`\204\001\275\017"
+	.string	"6^jG"
+	.string	"\257(\035\373\356\235\265@\273"
+	.string	"\b\347P\364]\241T\323(D\226\036\247\005\340\232;\212\262\036\203"
+	.string	"Q\024\272^\003"
+	.string	"0V\301\032C\030%h\325\356&\322\371\371\361\251\207@\251\277;\214\001\r\247ZZ\273\311\336)\005Q"
+	.string	"U"
+	.string	"Y"
+	.ascii	".\032\235\335\312\340\323\013\270O\327\033\370|r'\360\371\354"
+	.ascii	">\017\3026\312\346y}\255\213S6\217\306\312\252\034\310\274Zn"
+	.ascii	"j\273K?\345\206\247.\343\226\362\343\212\245\272|\354\017`\263"
+	.ascii	"\235\025\253\302\343\200o\240\216\3355g\341\236\267\315a;\202"
+	.ascii	"\375\235-\021\017,R\324v+\375|\315\245}\227|f\016\032\355\303"
+	.ascii	"\356v\276\3546>\211\034\324qL\034R\251\313r\371\214\2373\342"
+	.ascii	"7\251\343\230|[\373\t\034db\\\354n\003\3563\264\335\237A\371"
+	.ascii	"1w5\250\327\223\220\n\303\306\247c\264Os\021\251\327\223\013"
+	.ascii	"\330\r\037\307\002A\301\247\r\002\306\257\034Z\221*_Fy\023-1"
+	.ascii	"Pb\217\001D\273\024\306\257.\037{\201\026/P\250H\221\252(a,\267"
+	.ascii	"o+]6(:~\242\377\2114\372\262K\241\007\306f\230':\\\366\022&\331"
+	.ascii	"\366B}\265@\260Y\rQ[\225\272a\273\304$\032\365\025\376H\020\372"
+	.ascii	"H\340(<\205t\226 \002\001G\246\320\243\336(\003\374g\002I\037"
+	.ascii	"%\017dO\004\222<\372y\036\243\3237b\002\251\t\364(Q\357$BE\b"
+	.ascii	"\034\206|':\022\206'\332\331\216\337V\272\334\201\"S\244\204"
+	.ascii	"\261} \006\366\"[\251\301\001b\224\267\271\216\227\261b\227\345"
+	.ascii	"\253  p\202\241Rv\232\306\340~\006&W+\320\344@\236G\030cx\246"
+	.ascii	"p\204\033\327a\356|\2252[\031C\364,\330e\257_\204V\306\230\306"
+	.ascii	"\224\033\253 M=\230\367`M\274Y)n\267\253+\013\200\342!M\241\276"
+	.ascii	"\364Z3\006"
+	.text
+	.section	.gnu.lto_cliAdjustmentRange.part.0.438.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`\375\t\3452"
+	.string	"jXx\023F`\346Q\007\243\002\200{j\210\004\352UG\004\216v\371Q\f\330\030D\211\337\022\204\356\356\"\225\205\\\342\3751x\202\200A|\261\341)\031\276\254\263\034?4}\364Zd\313"
+	.ascii	"\217\276\221\255m\220]B\366\336I\246\024\037\001\030\001$\001"
+	.ascii	"\322\214\365\3149\233\371\331\322\247\364\232\347\254\3540\340"
+	.ascii	"\324x\300\345\234%\354|-\252>d]J\231\013lT\346\002\230\311d\307"
+	.ascii	"\002S\353\202\313Yj\344k;\330\371\312k\214]\032\345Q^\bIs\326"
+	.ascii	"\2631\356\366'\016e\351Q^x0g0,i9K\027\370\332\tv\276\266\324"
+	.ascii	"\211\254\257;\037\262\276v\273\223\356\216\352~\343\322\260\374"
+	.ascii	"\354e\367\033!\252,\005A\215\253j*\227s6\372\372?|\351Ca\020"
+	.ascii	"\370\363\365|xn\273\323\261\253\372\370g\331\336\276XR>\024\352"
+	.ascii	".\\\361\001\320,!\036\004\342@\265\350\366V\345d\236@T\001`^"
+	.ascii	"v\302\360\317\313}^]\270\347\305\003\373\354p\336\016.\354\356"
+	.ascii	"\030 \366\324\201\333\001\320\254-\337\271\330S\013\353\234\314"
+	.ascii	"s\253\n\263\370\305\302\341k1\347\314\303\242\302\252:\334BC"
+	.ascii	"\343\303r\252\n\320 \321\341mM\374*\361\252\310\353d\236A\324"
+	.ascii	"\004pjt\374\212c+\254)\214\205\376\243\273\220sng\016\361&z\267"
+	.ascii	"#\273\273Ew\013\fK\312\3024\361\235\366a\377\356\244\023\330"
+	.ascii	"\337\377b\363\245\272\201\373\343\327E\3374\316$Sx\016\177\264"
+	.ascii	"\377\307\325\374`\335.\356\"\0277\221\213{\310\305\035\240\305"
+	.ascii	"\r@(\310\305\r\344\342&\272\270\177Z\334Ca\020\310\303\375sq"
+	.ascii	"\373\\\334=\027\267O\213\233\347\266.\356]\213[\347T\274\331"
+	.ascii	"U\207[u4\357w)\336\330\245\356\376@\3352\343\327\225\363\325"
+	.ascii	"\\\236\334c\325b\304\321\334\251\270Kq\367\342\276\346b\232X"
+	.ascii	"t\023\324\030\246\235\324\254%\r\313\322Ecx\031\223\313M\251"
+	.ascii	"\021T;=\f*&\330\201)&N.r9K\215\276\352\272\275]\213\273A\371"
+	.ascii	"\2276\240&\347\274\305\261\264w\361\266\346yasbs\312\352\241"
+	.ascii	"V\304\303Z;\210\020\345\\\224\375t\020a\351\\\224E)i\276\342"
+	.ascii	"E_\2711\271\234\323*\354\310\272yP\335\236\305\323\272y\315\302"
+	.ascii	"\2614\002.^X\340v\262\250\366\251W\361+\315C\263b\245\327\212"
+	.ascii	"m\316\320\2554\n;_\251Du\261\031\336E\303\356\367\355wo\340\200"
+	.ascii	"\375\005~\321\251\007I\354\356\340y<\364\304\314\324\254x\356"
+	.ascii	"\374\336=3\203\355\305\301\304s\355G\377\215c\306\361\336\373"
+	.ascii	"\336\235]Sk\336{\357\nK\323D\313\347\273?\270\234r\2153KR\207"
+	.ascii	"\216\373>\017\024\225\261\353\371\022\313s\237\367\277\251\214"
+	.ascii	"\326}l\347+\207\356\243k\274\375\225i&dm\037\267}\325xk\276\024"
+	.ascii	"\373\321\341\031\253:\273\357\006\341p\3125n:\247k,\347,\001"
+	.ascii	"\316\210\2258\006\314T\22017\376\306\211\365\325\3378\366w\017"
+	.ascii	"\024\265\202S\265\247\345`h\241\255\037\355\367%V\367.V\026\206"
+	.ascii	"}\335\377\246Vi\252\366\370\360\312>\266\003\255\363\356p\317"
+	.ascii	"#9T\027\354\372+s\332\246\214\r\021\343\357\016!\002\373\273"
+	.ascii	">n\203\312ykW\262\276\346\336\346\005\264L\307\272\306\346\270"
+	.ascii	"\233\243qR\363\370\333\302\317\214X\331\302r\316\023\312"
+	.string	"\270\031\022\355C|\355\022G\354\357\361\335\315A\304qI\225\374\250\202\203\211\347\372\035\263Q]\035\371\217\266\317{\215\375\177\262i\335\"\t\211\t\3116\n\006\312'%T\n\244c\211\243\244\361\310\204\200\344\021?1A5exbJZ\202:\221\304\200\204T:\256\020\"]\351\270\342\223O*>\211\t\251\204\264t\244\353#\006H\245#c\322\321\321D2\351\211\tidB\036\227\214GI\245\221\301P7\251HJ\032\237\232\232\222F\236\253\371\301Z\037\\o\314\237\032&\300>\306\215\334\261`\033K\"\007\324\344\354\364wid\347L\036X\036Y\"\271\342\3015>n\204\335\201K\023*\325\234\241\026\340\310\202\005p\367r\311\262\211\177\355y\233z\251&\200Yo7\326\310\325\357^>YF\301\3766\246\362\245\347\315\371\243K\2313 \353J\266\350\035Z\306\246\211\357\024\275k\205\355\371\021\r=\321P\236"
+	.string	"\337\215\001\313x\303V\370\025\372"
+	.ascii	"\037t\346\352\314\367\321\3669\016@\350\001\374oJc.H(L/\350W"
+	.ascii	"\346\331\222`P\233\017\020\361\201\210s\354\374|w\006\354T\256"
+	.ascii	"qg=0\025n\n\377\347\203\250h\234\361\210|\211\035\n\177\370\277"
+	.ascii	"\351\214\271\240\360\211\033\254\003\f\276\1771)\302\376%\200"
+	.ascii	"\312\250a@\005\rR\206\204DD$I\223\341\320\002\021\032\252\315"
+	.ascii	"\001\021 \255ST\311\214\024$\225Bc\347\300\214\016V?\221\272"
+	.ascii	"O\002\247i\336\232\274\025\306IcY\021\333\365\370~\316\350v\035"
+	.string	"\332\232\204\201\0348\371?\350\027\232D\331\334\374\346C@\035>\360#:\372\367\321\3579\375\001\353lz\263o\321\303\343I\317\242\333\237f\300\\7\250)>l#\352>\247R\013\013O\027\200)Q\002vb\353B[\317\001\307\337\240O'\364\214\345\2008\315~b\3731E\366n\033\031\242P\037Bk\2512\246\347}\001}\270\207\2450\301\345\372Saml-\222\234\353$\360\375\203\224U\357\245\277QZ}\204\006V\347\3476\006F\342\313@c\227*\177\200\231\222\345\367%\257\\\246Yn\235n\337-\035\325j\223[\276\244{uV\325;\361\325]wgbo\354\330P&\267\204\237`\251\230#U\n_N0\343\240o\263R\255\3741\272\337\231\356\334\202\236F\032l\377*\361\343\n \317\352P\035s\231S>?\354\r\334\242U\303\371\257\"0\2056B\227A\031\016\271c10tF\223y\204\251\355"
+	.string	"\032l\264>d\263\223\037F\272\220"
+	.ascii	" k\273\030\211\220\256\007\2312\204\374v\341\b\345\337]\370R"
+	.ascii	"\220\326'r\362\345\"\372\030\366\203\353\031k\3606,\225&U\340"
+	.ascii	"\263xQ\001"
+	.text
+	.section	.gnu.lto_cliRxRange.part.0.442.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`2\007\355)"
+	.string	"JK\224\020Hp\334Q:?\007\202\177\002t\270CLK\223\007B<=\376\356\244\247\331\355\264"
+	.string	"!\267\313\264\356\344\333\036\231!\0361\315ba\366\303L\027\3175\020\226\330L\263\244l"
+	.string	"LJ\362\222\035\362%_\313o\244\021B\366N2\361"
+	.string	"\355"
+	.string	"\363"
+	.string	"A\353\2534_\\\242\346\213\237|\226\217T:\261\24093\211\256v\003\366j\333\367\236\311\364)1\204\2309y\354{\273/\345XM\237\022\343"
+	.ascii	"rVb}\345\314\\p\265\025\260W\233y\001\353U\366A\353\325\356C"
+	.ascii	"\351n\246n6gV\345c7u\263\021\202\312N\016\234P\212V\324r\316"
+	.ascii	"\273\253\330\310\233\336\223kq7\326\266\252)\276\272\246>\327"
+	.ascii	"\323eX\231\021\351\364\236\034\202\3266A\351\254\343\006wv\234"
+	.ascii	"J\207r\316\267\263#\017&\307\036\227\375\220\344\217\333R\001"
+	.ascii	"fD\324\374\354\270#U@5v\243E\026\357\232\2666\330\240\351\220"
+	.ascii	"\305\324\201\032d\324U\257\021\211\343i\032\304c\013M\207\204"
+	.ascii	"J\213\320\256z|\214xq*\240\006\022\343\317\216>R\005\320-s\316"
+	.ascii	"\365+\205|\272\027\350:\333\204\234s\177H\365\366yw\307\351\356"
+	.ascii	"\031\335k\221\267u\354\355\036\366v\216\275\335\342n\317z\263"
+	.ascii	"\017{\333\326\213\275\325Wy\247\354m\374\255\367=\363\277P*&"
+	.ascii	"\345C\225s\215\350\235\034D\345\222\344[\177\326_\345\027\373"
+	.ascii	"\303\376\262\247\261Pj\026C\"\214\271B\314\252\344\221L#\245"
+	.ascii	"y\007\263*i[j\205EQ\313D&\221\213F\3022\240\206\312\b\3155\305"
+	.ascii	"/\265\234\231\273\253\267\356\237\231\265\204\252/\027\323\177"
+	.ascii	"v[F\206D\206\224$\343\2643\202\005{W\337\3711\2610a\216x`\257"
+	.ascii	"\206\201\001\323`@K.f\0245\f,XwK\205\313\273()\225\272\357\365"
+	.ascii	"\257\356\266]\274\253/\232\025\225\217\234s\353\002\367\2510"
+	.ascii	"\365\255\\\313\271\272\335\322\322j\260\241[\316Cx|]`\257f1\365"
+	.ascii	"\020\221\231\221\307\234\363\225ciz\226\006{N\346\313\200:\245"
+	.ascii	"@s\316\017\330\253C\351\003\314f\021\317\r/"
+	.string	"\273\035{p\315\341c5\311\242\321\265\344\203k\213s\370QTO7\3328\334\342\2402^X\360\373YdM\214\r\272\335\"F\334\033\373f]\225=\237\346\220\335\360b\303\313v\363\033\224&\232\242w\021\220D/\335\360sX\311\251\263F\\m\370W^\246\200\230Y\255x\331\006\244\246\272R\025\007\320\232\242\201U6o\260\025\207\245>v\234\225SL\321+-\372\271\316B\235R\212^\230\350,\226J\363\025\253\3034#\351\212\257\363j\213\232\273\251\212\261\331\325\223C\217Kr\244/\326\024\253C\2646M4>=\337\2751\305\037;\220\363\252\311\005\003UC\t\306\313\306\017\256\030\013\233b\210w\255/\306\270\205\332\212\026\363\fo\264s\367\270\373\227\342\336x\361\317\\\375x\022\261\323\305\313\306\272\343h4\032m\254\354\276\335\376\271\335\366a\003}\344\003\002y(zl\243`\260$\334-\t\203N\374L"
+	.string	"\203F\034\216|@ \017E\017\b\370[\342e\360\235"
+	.string	"\362\204\354\357I@\245\240Q\022\320\247B\351\204\220B\211\337\021\257\005\2200i\005\366\001\177G%T\364l\335c\360;\352\355|=\236\t\241/\t\370\333\001\177<\025\273\236\020i\307\240@\007W\370\204\273\244`P\270k\237f\254\354\233\023\035\317!~j\3744\347\234{\016\334\005'\372\273\256\223Q\00239G\335X\201\215:1\301\325n\013\027\316u"
+	.string	"g\234 \237Q\257Z\203~\345~p7\206\347\211\203\347\316\017\036\260\364jS\314\343\203\2733|M\303\215I\032\224\352\301\317\272a\274\316\206\025\200\331\234\246\231(9g\bt\256\326\241ou\265?\204\2707\"\255Wo|3\364\301\177\036\304\322+mHH3\332\302y>a'('c8\274\214s\0356\";\234\367`\235\r\367`\002e\002\200\207\250a@\343\020b\304\210L \"\242I\2226\200\002\031\"\254:\021\200\275s'Ij\324h\f\345\266!\207$\342\2551!\270F\342d\343\365\302gk\267\206w\022rU\237)J\362\305f`\204+\330no\206h\252\034\214{\313'\260<\273\372\251\025q\333\003\330\f\341\206,\365\306\007\213pL\021\2666=~\317\031\bL\b\003\026\222x"
+	.string	"\n\277't\275\021\345\225g\314\354\237\350\330\271`\241\020v\301\37060G\320\177\266.\346\037w\007T\266\350\324\310i\035f*\324\324\021\034\361\n+\2360\320\347\307\301\364\321\2664)\206\347\364S>\354\376\3570z\022\004es\3467\354\361\201\321K\361\277\237\027\023C\r\206\245\215\302!\372\245\344\342\036I%\337\177\265"
+	.ascii	"\031\274&\034Ng\274\356\3442\360\357\306\223\037\362\265M@\003"
+	.ascii	"A\245C\306\222x\314\350\032\002\021\321\365H\004\256+\360\024"
+	.ascii	"\252\025\224\007\256\221\3754yua6K\024%FR\211\211\331\330\017"
+	.text
+	.section	.gnu.lto_cliRateProfile.part.0.444.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`*\001\315\r"
+	.string	"vZ]D\360\2606\035z&\3739\334\274PoD8\346^\313\375\275]\\\354\264a~\335\213\270\362@\307R\022\272\021\226\375\232*h\366%\345Qb\213\303\342D\267\t/\034\227t\334\n\n\351J\207\262F\321v\2232\245G"
+	.string	"J"
+	.string	"H"
+	.ascii	"\3419:\217\326\tt\036\257\307\243\260M\262q\036\212X\025{6\216"
+	.ascii	"\201\223\375 \264\274\244\310\314\330\335\354QC\334\273f\345"
+	.ascii	"\371\t\226"
+	.string	"\276\353O\2470\302\306\005XZy\016x\265\341\261\273\2668\334\361\266%\330\236`\377C>\3521\376\n_4\244\317\214\030\303\020nI\345.>\215\212\313x\237\031\371n\330g \321b\023cw\035X\217Xu\337\205\344\237|\301\220\036\222`_\007\006\217\316\264\377\362\024\336C\222\013\3305\325\260\330\r\033<z\201\365\3500vQ\016r\026\312\003\005\217\266\005P\0364v\242\237\257\251\277I\251Q\2229\266\322\276 \222\007\257?\235\243F\306\312\013\023\375RY\254\325\253U\223\035\323Y\245\337\311T\204\324\256\206\034\032\353!\2660q\324\017\363\264\037\376H\200m\037\016D\324\205l#O\027\200\373\026\342>\037 m\303Z\007\367\321\262M\363\200t\333(\304e!\316\003\312\264N$\353@`Q\310\326e#\221\250\313.\333\371j\325d\217\0225Qe\261}\240\304\211\024j\025\204\001d\352c~S\241@\033"
+	.string	"\265+0~\265\002\0039\200<0\302\025\343!+\312R!\220:_\312\202\313\352\302L\220U0\255B\341X\025\335TX\314\247@\020\342=\243\024u.0\335i"
+	.ascii	"\270\366\220\302B\263\245'\2241"
+	.text
+	.section	.gnu.lto_cliDumpRateProfile.part.0.445.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`A\001\205\r"
+	.string	"\266XYC\020\221[8K\271a\020\021{\274\361\236\322n\024z\245(\n\032X\217\027\370JK\327FX\215\b\355\037$\354;FVo\235 D\235\001\271\026\212\253\310\345\201\355\235\205\2568\304<\263O\0226!R\246\024B"
+	.string	"C"
+	.string	"K"
+	.string	"\273\037`X\354\216\t~\331\203\375\262o\302\266\311\226\371\270\262*\207\266L\201\222\025A%f\230\240\220\261\273\332/\r\361\360\232V\350\213W"
+	.ascii	"\033P\236\002nmt\354\2561\016\367u\333\nlG\260O\"5Hr\225\252"
+	.ascii	"b\265n\255\246\330\272\313\257\232\316\267\374\317\022\306\001"
+	.ascii	"\017\273'+\032\013\342j1\302\366\355\277\230\354,s\031\307\322"
+	.ascii	"7{\212\221Z\240\371\026s\200Lg)}\334\023\2255m\016Px\226\222"
+	.ascii	"5\266\204\t\235\022\025\255ji\006\363b@\332\024*t\2109\251\350"
+	.ascii	"\215\212\215\303a(\b\235\005\317\fJ\226?\361\024 \004VvQO\205"
+	.ascii	"0\024\003\004\277\354\357B\316\250b4\231j\217`\310\247\334\321"
+	.ascii	"\240\242\257\251\177\371%b\305\312$\276G\001@D6\007\243\320\210"
+	.ascii	"\007\226\241\363\0205\350B\274\217\017|\320\2216pc\356\343\205"
+	.ascii	"pZ\307m\037`G\022y\232\310\333B\032\007\212h\037\003\376F\035"
+	.ascii	"\250\221\276\017\3242\333yMq\007\211\236TUls\322R\354v\241\t"
+	.ascii	"! \320\002\241\333<\214\034M0\350'3\346\2221\242\220\"\320\200"
+	.ascii	"\001\317.\fC>\f6B\351qo\016Y\217\247F\346\231\353cN\202\231N"
+	.ascii	"HK\372\202u\013L\212JBM\254\346Q\313\302\002\356K\216\256\351"
+	.ascii	"'\3441"
+	.text
+	.section	.gnu.lto_cliGate.part.0.460.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`9\016\315E"
+	.ascii	"Zv0\032CP\244N\007#x\240\317\304\027\336\331]\244\320S\341I;"
+	.ascii	"9\360#\250\300E0i_B\246\302\363\n\271\210`d\001  8\" \242\"P"
+	.ascii	"\202\200\032\234 \305\232\365l\233(H\033\335h\223\275w\222)\005"
+	.ascii	"\207\001\203\001\211\001\356\235^^\214\034\303\263Wv\035iv\200"
+	.ascii	"\2029g$\274\273n\243\234\327\311p\272>\201\026\350`\274K\373"
+	.ascii	"\034\231+\037\323\3540.\306\351c\232\313-j\3562\372\211\tb!\254"
+	.ascii	"\340:\273\\\267\310\350\3668\367\322m\354\031\336\245#\240\315"
+	.ascii	"1\316p\333\267\\\265\303\265\261\273\235\313[\r\214\364V#(\367"
+	.ascii	"e\3572\263\323\023\314\231\212\344lGp\23556\306N\275r7\033F\324"
+	.ascii	"\354\025m\214\273\275\315\2638\335\315\206's6\2732\2273\025\202"
+	.ascii	"\263\355\300u\266\251N\324:\353\272P\353l\267_\351\356\253n:"
+	.ascii	"N=\313\321vv\3231\302\221\261&\330\215\341\202#\3149+9\373J\332"
+	.ascii	"\326\330E_\251\336\354;\235hHH"
+	.string	"\231\fB\036_ c\221\350\016[v}\\\344l'B\273\260\234hHOH\231\354\213N\327%[\024\r\007!\373\242glQ2|,\363Z\342\357\272D\263\307\345}\321\261\365\200\031\331\036\347\023\303@+\321\213N\213\367E\303\326\ns\326\334\210`\343Q\022/0/\256\031\332\250\240y_\264\310\372[\342\362\334/\f\023\301\334]\211~\254A\275/\232\266:\020\244\313\343z~\304\026\035\202\207\303\rGe^j\336\256\354\237]\334\261\353\271^\370J\253\342s[\230-:\t\342\253\033\304\377\330\305\265.s\316\016\347xG\227\026\306J/\032n\3109\267g\255y\003\360n/\322\335O\272\201\366\002f\215\344\370o\274\301\331\302|\272\b\263^\242\365.8\313\204\233\363\323\241(\334\247\003i\340\254\177w\n\025\330\241\370\207\240W\250{\004\237\217\205_\332_\364fj\240T\004\373\315\272\203p3\b\302\275"
+	.string	"\211[\301\213;\301\213\033\301\213\373\b\211{\371\342>\360\3426\360\342.\200\304M\340\305=\340\305-\340\305\035"
+	.ascii	"\211\333\350\305\r\340\305]\364\342&:\342\036zq\013\035q+_\334"
+	.ascii	"\311 \344\321\321x\277\356\306\033\350\305m,:\027o\342\021\267"
+	.ascii	"\353y\336\303\266\210\233}q\257N\306\373_\334\330\251\356\216"
+	.ascii	"a\305[C\216\345\374\243\352'\033a\353\2308\027w2\356y\356{\356"
+	.ascii	"h\334\335\270\303\361\252\213\031\355b\230\005G\363\026\265\243"
+	.ascii	"{\272\361\226[\324\263\256"
+	.string	"\214\304\354\306[\251g]E?\037\\v\b\365\264\323\232\207P\317\274\206\322\260-*\222\214v2\242\236y\035\207\250=\323\020\346LUr\366\330\355x\006\307\302\356\f\353\356\004\307\260\324\301w\200ca9g:\036\310t9m5\025C%\347\314\004\224\323\013\316r\316o\342\300\371s\372s\332\240\225\343\003\036\221&$\\/\343}\355~mt\323\246Im\323\004\264\3333\302\305s3\355i\234o\357\312\331@a\251\3615Ng\003E4\263\243\023\302u\326\215\\\250E\323\021(\\\371\031\251^bQ\363\217\b\024\234~F\312\3633\327\200b\027h!`\r\234jN&\370\313\024l\357\311\036A\233\"_\332\303?gj\225\357Y\336\326$_\371\253\032\256B0w\365\306k\235M\276\325\264K\225\272,\\%dR\346\350t\302\347\312/\323\257=-\344X\2373\257\361\375^\211\357\007I\265A\013\262\356\226"
+	.string	"\275\264%\024)\"\277\200\234\333\230\213{8\220T\316\255\260x|\347s\027\"\327V\350\366\016\367s\377\222s[+\026\337\365\332\262\270\376\304\326\233-\320c67\203z\371c|\351\016\007z\344\267\220\222\221q\227j\337?\276\322\217\254j\374\356n\341|\215W\364pP;E\343?\235\222?[w\304\304\024k\264\305g\267\220\t|\203\303"
+	.ascii	"\023\2438\247`\207\026\337\375\360\354m=V\277;\017\272$m\210"
+	.ascii	"\007\276\2264q\337\254\211\316\324\272O\365\246f\370\356\033"
+	.ascii	"q\214\005&\300\316+\3166\354\320\341\273\236+\367(1\263\2675"
+	.ascii	"\\\342n\016\035\340<\371E\211\335\236\326c\265/m\"\237\265}\226"
+	.ascii	"\317\367\016\\\366\026\347}\3159g\366\245\335\355\336l\377\333"
+	.ascii	"\027\362\023\323\363\034\323\302\325.\200\201\274\321\264H\316"
+	.ascii	"~\267\007\020\330\241\355s\356>\344\256\bz\035\316\341\364\200"
+	.ascii	"gP\257\353\266\302\\!\276\360,\347l\301\331\3068\360SD{\032\t"
+	.ascii	"\354P\022\255\263\354{\235\257}\262\376\242\274\221\023\362\353"
+	.ascii	"\373\234\207\300!V\345*\314\302\325~\177:+m\276\254IpaT\376\003"
+	.ascii	"M\243\211E\024\263\355\252&\223\305\212fsi\252\330,\232\232\246"
+	.ascii	"\232mW55\233\250\332~\221\324|Q\265\004\245\024%\005\005%\305"
+	.ascii	"$\240_$E-=M\255x\222R\252z\341\202\371\324\002AS\325\222\213"
+	.ascii	"\025\206?-Y}U\224\f\251\016UQMP2\\Pq`\301|Z\262R2\235\252j\352"
+	.ascii	"\233\242\230O,\240\230\206\315\224\304|bRjbZjA\325T\025\305T"
+	.ascii	"\212b.A)1Q5\225\222\006\264\324T\023\225R\225\224\024\225\222"
+	.ascii	"\321\337\314uL\325\354e\275\026\021\321\f\036c\242\201\232\353"
+	.ascii	"y\022\3164o\357\371Xjur\fA\2559\227i\340\363\244\340\026\\\025"
+	.ascii	"\242c\360\205\277\370\361\022'\364\f^)E\253r\025. \202\341\234"
+	.ascii	"`l\335\035!\227\267\344/x\244\024M\017W\241\0021\254e\220\352"
+	.ascii	"\226\340\025\\\rA\360\t\376\216\036\301;\236\244\243\301%\031"
+	.ascii	"\266\"X\205\312\201_\216\3212\360\007\n\274\201\367;Rp\201'p"
+	.ascii	"\004C\001|\3026\340\t\274M]\300\017\300h\036\340\005\274\327"
+	.ascii	"\201\020\340\207lw\200cmuF\337\355D\202\2318\245l\335\335\337"
+	.ascii	"\030\226\234s\005\007\354\236\302k!\206~\204\274\255aI\303jN"
+	.ascii	"\255\263\016\265\003\340\215\354L\305h\275\211+\274\221s\321"
+	.ascii	"\003\370\306\317<\325*\321\027\275\007\372j\005m\316\355\253"
+	.ascii	"\313\240\026\256> z\217\343k\236\251\030\345\017&q*\201\360\347"
+	.ascii	"Ds\237^F\266\344MH\362\007\235\251\035\022\372\2412V\350\255"
+	.ascii	"\246q\305\274gZ\220\003<\374Cr\357\303d& \374\005\201\033\250"
+	.ascii	"q@\345\220B\206fDD\222$\311pq\005\3040%\251\343\001\022`U=KC"
+	.ascii	"&6\322\226"
+	.string	"\n\355\377\006F\351\025@\250Z\332jBXO\006\341\256|\006\357\027+\230\247\021\236a\301o\270\370_\353C\344_\275#E\342u\245X\367\027\342?+c\2630\231\004p3I\b\2776&\235\242\215\342\020\244\216N\344\310W\276\032\267=\006z\235\351\342O\353\246\227\240\217\002\347\210\223\020\376\223\177n1\210\210\255\230%\316\207\336<\005\257\215\\\300\241\2146H[g\263\274\332\020I^Q\252\245\226\361B\251\350\211\315\373\216\230\231\336<Y\301e\316\b\212\342\034\\\377\004a\236[\354\262\350\266\217ku\252\2347)\026\t\310\002q\241Ck\343\354\304\352\332\306\353\027\310\035\231\037\373\250\273F\004\251-`\273\251[N\3716\371\244\242m\344S\264\325\252!\023\035\200\020E{\324Ou\026i\323I\316}\376\352CeF(\255\251B\237+Q'\035\330\202\004+\003\261)v\211\037\034\030t\347\314\023\340\207\237"
+	.ascii	"\312rQ\331\330\022$u\3218\301I7\217Z\201.\345r"
+	.string	"\317H\222i\261\277\f:\354\241<U\2151\261\324\334\214\224\220\234\321\344\232A\002\222\030\340u\3363a\267\342\321\363\023\347Ffj\373\001\264\3254E\210\257v\232\322+\3749\007da|\346Icn,JT\\\336\301\224\335d\023!9\204\365\337f\354\211|\305s\277\367\036\302\257\tU7Q\257\337\224,\302V\377\222\204\b\022\f\230\326\363o\001\207@\210\\@ZV\206\300^\345\371\243]\321\323_\257\025l-7E \361\312g\340;\027\030[\310\240\222\375\006g\007\030\374\210\246|\3066\340SQ+\2238-\362(9GN\320zA\343\031\275\202\334,\277\344\244;@#Gl~\374\316\030\t\006\241\373s\264\240\347"
+	.ascii	"\r\263{\0312\334|\261\362\304\254\251X\210q\360\264\356\230\001"
+	.ascii	"g\332\261w\n\003x\001\025\366\225:\354\004\323\024w\331r\325"
+	.ascii	"3nG\005"
+	.text
+	.section	.gnu.lto_cliDefaults.part.0.461.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`\307"
+	.string	"e\013"
+	.string	"\006\324KC\020\307j: \264,\0168\003J\340m\270E\200\201\bh8\364\030\256\022\352V\272\t\024_f\341\212\217&\224\376\225\214\375!1\324\321\031\""
+	.string	"\020@@&\231\237\322\035@dO\2774\227\035-m\332$\2454"
+	.string	";"
+	.string	"9"
+	.string	",\333\244-\373\t`M\\\3322\216\310\232 V\313\bl\266\273\335+}yy\252m\245o\236*\234\244\\c\370\206\t\355\2563*w\275\355\t\333\025\366/\002\035saW\265\222\200j\366\317#(\337Bq\316E\331<`0\223x5\305y\007\3565\363\006\356\365\006\254y\375\200\312\027\360\350\230\347\246\270"
+	.string	"\rb\004f\273g\304\253!2\257\017(\316\336\350\320N\342\303\376\222\005\003\034D\200\020BM\215\256L\267oKU6\255\254\330\206e75A\302\272T\005\002\376\372]\267\177\200\364_\207Yc\177@\244\213|\013\025_\b\2220J\036\306\224\001\216B\321\342\343\020\2314\366< \311\353>O4\032\277S\bv!(*u\336h\352<\017\0265\276\261;\211\342\330i\247*\207>(\210)\245+\333\234\346\007\030"
+	.string	"\f\023\004\316\031\3705\021\302x\200(\030\346\ng\307\006\356D(6\202\241\203@\017\354\372\210\004\303\311@\353\255\233\220\260\nZ\211\003Bw\006"
+	.ascii	"\356>\220\243\245\351'\2241"
+	.text
+	.section	.gnu.lto_cliDumpPidProfile.part.0.462.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`<\001\205\r"
+	.string	"\246\230YD"
+	.string	"\2614\035\243\035\b\314\337\201\314\260\261\334\n\264l\0028]3xA\342\364\272\251\323\263\374\266\337\b\033p\002FI\232M\013\205\032A\370})\221\323{\024S`D\343Z@/\342?\301\240\r-\331R\246\024B"
+	.string	"C"
+	.string	"L"
+	.string	"\273\037V\260\330\r\025\234\262Gu\312\276\t\333$;\347a\314\272\370\263s\016\250,\370)q\263\202\202\306\356^\2474\304\277k\306\317\007\257"
+	.string	"8tx\nx\334\b\331]W\036n\352\266\027\330\026\261O\"5Rr'\025\306\032\037W_\034O\363\253\246\3633\377\255\274i\240\263\333\262\243\263 \250\026#l\337~\r\311\266,\2320\034\235cK360\320\374\214A>\244\313\214\036n\213\2135m\220\317w\231\2215\266\204\t\035*\nZ5\252es\032\2206\205\n2pJ\n\232C\005F \253L\0204\013\036\247\030V\376\304S\220\030\210\3315\235%T\231\034$8es\027\362\364\002\307\223\2516\n\206<\213;4(\350k\352kN\211\260\201\261\022\276\273\212\304\004\023\351B(\240*\203\006\022=\320J\266\021\316\213"
+	.string	"\332\272"
+	.ascii	"\316>\266\222\354\3222l\304\323ND\333%\332\260\320\225y&\327"
+	.ascii	"\007\002s\235\346]'\034\347]\226\355\274\2768$EK\2520\266\013"
+	.ascii	"d\324x\273\360\004  \340\002!\333<G>\"\326!\214\271d\214(\244"
+	.ascii	"\b4`@\263\t\343\020\207\337F(=\356\315!\327\373\324\310\034s"
+	.ascii	"}\231\223\240\246\023\324\222Z\270.\201M\321I\250\211\325<j}"
+	.ascii	"X\360>\312Q5\375\0048\006"
+	.text
+	.section	.gnu.lto_cliAux.part.0.468.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`-\f->"
+	.string	"\332j\254\027AP\350M\007\314\236\200\275\333\2702U \n6\334\307WA\254\024\036\022\035\377[\r\311\376\321\324z\274y\271\263\017:7R\235\325\200"
+	.ascii	"q\327\226u\264\222\3628\"\r\222?Hh\204\204\354\275SJ)a\001Q\001"
+	.ascii	"m\001\367\2628\236[\f\017n2\215\246\341\230U\223&\r\307\025\217"
+	.ascii	"\356%C\322f\303\257\3253<\270\330\345\274`\312{o\2316\323\366"
+	.ascii	"\033\307\365\r\273\355\003\257\371\304\273\367b\370\265ZL\233"
+	.ascii	"\270\366\0307\035\016\301M\207\322\255\273\r"
+	.string	"\346\244y\207w\257\023B\253\\\341\327*\313\356\355\344\321l;\0048o\230\222\335\231;L\257\265\315\266\243\227\356u\362\245\315\275N\t\255\362\203_\253\354l\246\265\325_\023\327V\231\033\f3\363`\026\324\316\263\253\344\226Y\220\200\036\367h\241)\347E\006z\3575\266\372P\272\355\341\222R\022\2220\310\002\217~\276UM\337\211-\367Q\022\354\330\303%\270~\"\013\223\322JIi\361\016\235W\327)\317R\004N\226\3545\232r\211#\371<\220\205\235\2650}P\247d\246Ly\312\002)\361\340\262\331\224A\236\262@\003\230x\2104\232r\314\201\313'4e\022?z\"\013C\322\277\342\275\267\321\224b\356\353:%\022/_=\tf\244\325\224\210D\r\037$0d\032\201\217\226$,X\017OS\003z\346\2704]\273\0200d\232`\331$M\327\351\362O\231\276\254$\273N\031%}\200\347\346P\303\265\377"
+	.string	"\343r\0376\321\347\341\336\313\2755\245\031@3\367\tf\026\302\314v\b\355\007\0057\225V9\305\n\357\344\212\357;\315\"\214\371\306\005\021\032#[\036\345o\237\323\343\013\313\277\031\023\233\343\326\377o{\262\271\311uy\"\036z?s\013\027\336\311\377b\327\037\231B\367\373\373\312\326\020!\267py\324\337\214\237\330\037\215F\243\374N\230\203\316\013\200\316\nX\347\004@\347'\240s\021\350\214\200u>"
+	.string	"t6"
+	.string	"t."
+	.string	"t&\300:\017Hrvb\235\005\260\316\001X\347&\2413\023"
+	.ascii	"\342\020\311y\211uVb\235\223Xg$\241\2630\310\006\235\201\254"
+	.ascii	"\363\321\017\350\354\3533\315\253\352sN[M\363\367\230fogwkH\323"
+	.ascii	"\340\222\230\367~E\027]&\352\233+\255\246\373L\367\230n:\335"
+	.ascii	"q\335\317\336C\205\203\251\312\024\324\361Uz\305\234ga\276\262"
+	.ascii	"0wj\320\333\345\204\240\305W\357\243\307\226Y\003.?\3109\350"
+	.ascii	"\275Nc\253?\346\346\226k;\334t\314>\347\254\346\254\300\240M"
+	.ascii	"F&\340\274\351;Zm\207\215g\367^8\275\206[N\327a\226\316\234\253"
+	.ascii	"9WatM(\2118\256p\201G\307\311be\205\013m\307\311*\036\235\367"
+	.ascii	"\213-c{S\203\336\333\206\303O\f3\253\305\334l\272\r3\3138z\r"
+	.ascii	"\0230D\347\006\236H\300\267\330RN\232X0@\323\007h\212\263'\306"
+	.ascii	"4\305\277\332*\276\243\035\023!A\210\\h"
+	.string	"\314$\363\352\322\f5Y\251\225\t\3003}S\331\231(\021@\030 \021\321\220\370X^\034x\333i9m\226\337\322\263ZZ.\336\311\341\027\221\177dvd\024\023s\333\364\036m\232\260mO \265\313\271\226\036\250\347\3143y\244\364\035\327\211:\351\225\276\221L\256\270N\372f.\325\244\211!\201\361c\226\357\270G\315o\264\223y\301G\372&\267\267\250W#\206\372\020K\363{3\026\266\324*\374Fs\223\013\276\360\223\334\336\020y5\332b\203\357\320\2741<e\026#\2767\023\324\354\253\307=ZT\366\273N\017\351\344\035\241\353\372\343\372fD=of\200\317\334\206\351\275\226\315w|.b\252\335{1@M\254Ny\364\334\256\250\035jDWp\311\274\243\007~{5b\376\320z ~\367va\340.T\025\342\350{9\026\335[\333\362\350E{BQ\255\326\337\253mOE\005\334\367\314\"Fx'\177"
+	.ascii	"\350\006)\352\350\372\276g\367\022\033\272\272~\323\365\020:"
+	.ascii	"h\357\273\233]\2224S\035\253\372\352\3619\310\355\217\223\373"
+	.ascii	"3\223(\341\235T\337\351\f2D\307\235\265\326i\006n\236{\230jz"
+	.ascii	"}\247\001]\255c\356\2229\372\217\211\265O\206\273\234C\nF\325"
+	.ascii	"\324\312Z\f\2129\264\240\232x\306\204,)\030VT.\242\260\214Q1"
+	.ascii	"\234rX\275\370((\252\267Q\245e\005\302F\225\024\225\226\f\254"
+	.ascii	"\0170\246h@\335\030N5\r\250\033\217e\243\306KUM\321\200A\025"
+	.ascii	"\345\343\250\tS4\242\214RQP1\260\244lTM\031\253\246\240\250\214"
+	.ascii	"QXY\306\t\004\330\252\206\024\226\321\206\225\025\226\221\355"
+	.ascii	"w\302\277Bct"
+	.string	"[\317\305\337\351\275\367\0165x\363i\b\335k\274\331~5\270\003\373!\333\307\220\266H\303\365\322]\241\"g\211\360\332,e\245\367\222u\300\023\343Q\266\340No\340\237^\301/\370\377\266\343ZZ$\007\316\356Ev\262\035\373!\257\032\264J\332%\006\204XQ\273I\376\030\306\261\264lj\233]\240+V\026\274\212\245\334\336Z\202W\340\325\210J\226\332f\207\307T\233\"%\301\253X\316\245\255m\225u\361\237\234\254\021|\361\300#h\342gP\364\236\230\035\230\333\363u\025x\003\357+K\303\006\311t\"\360\005\376\345\220h\003\236@[\346M\262\032\3341i\323\216\216v\320%\314\001\317\264\265\345\242\261$N\257b\371\334[\313\242$\301\203\315wV\b\235Bi\243x'\331\337\362\236t\310?\n\212k~IRUBv`\352\266l\245!\275\031\267UV\"m\025\265\315n\313\220\260V.\345@\365\364\334"
+	.string	"9$L;k\025\360M\346\346\247+\200\364\250q4\345\0202H!\022\021\221$I\322\001\240\002\021\232*\326\001\021p\261SLd$\220\2445\032\003=B-\006ZgeK;\305-*\r\377\311\276\201c\347\302t"
+	.ascii	"Z\001\033\204m1$4\217\244\007\003[\002"
+	.string	"\317wz\025`\354\276\245\0379\313?\236\273\277,\232\203\257i\027\030\210,\030\221\020;\366\246cvCDv\214\\\232\004K\213\004\334\007\371j#%x*Z\200\236\274)\331\342!D'E\200\377\3220A\222'\307\r\250\343\362\304\241\342>\322\314\002V\327\334\360\221\313\2312\022\346\313*F'\314\236\374\017Rg\337\221AM\016^\210^\232\2661\370sk\021\320cX\237\337i\307O\034\364v\357\024\221\360(\373K<\247\211\312`\375\001F\024\365\t81\241%:\021[6\f\323\351\360(\242&\201\200-c\257\207\035\357\036\301\026\024\027\323\020C\361\205\272\311\240\302x\244\257\013\021\304\247\201\241\017\344I1l\240\323VD$\251\334\206\333\2431\323\370\352\2049\247\360\245;\347\304\032VV4\353\222\205t\t\351\335\241\305[\026\2028AAQ\004k\257@\204\243\226/VF\365Wj\213\255\340d\230a"
+	.string	"\330\370 \b\200,Fa\032\354(\tnt\214\342\353\245\2164\307\341\177\362+)\\\342Pfk>f\025\226\033\363V\337c\032\307F\251=\372\261\004\362\017C9\232k2\247\241\340\236D\327\344Oi\301\031\252\343\371V(\003\220\213\227\241~O\236"
+	.string	"C\252\320\222\240a\215\332\206x\233Or\352R"
+	.ascii	"\347\370]5\213R\354`\024\273\270W!\006\275\367\b\371N\235\364"
+	.ascii	"M]\002)\350\274\321\212\243\026\223\250\244|\207\3624\367W\227"
+	.ascii	">\373L\032"
+	.text
+	.section	.gnu.lto_.symbol_nodes.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`v0\275\247"
+	.string	"\212\007M8[`\b\245\234t\216\241\026Oi\271zn\003E:\315\to\370\375q\002\001\321_\336\032f\216\363m\020\373\021\344w\361\364}DnfpsG\301\217\271\340\207{\270\213O\366\"m\370\213\264\341/\322\206\236\001\031\0254\235\240jA*+TFk \324\252\321`[i\2316K\231dT\003|\003u\003\225\303\210\225\305ZTF\376TV2\254\234\304\2472WOe\",*\027\341\251ldE\345\256\235\312X**g\351T\336\362\240\362\220\234\312T)*W\241\250\034\244\203\312V8\225\257NT\366a\242\262S\211\312P$*\2377\225\237\204\225{\214\250\034TV\026\262\251lvM\345b\262r\214)\225_\304U\376"
+	.string	"\2562\f)\225\207\327\341\267\312>wsi[0\266\r[[2\265-K[34\346\021\205w\234\261\0163n\312\2251\023Y\345\235\032\254\232\335[\325\376y\220\337\310\215UV!ud\007C\251\254\363\244\236\314I=\225\030\\\2116nRY\310!T\266\3211\251\267r\343%\365X\\\3524)\251\007\202\254\357b\261\332Zi\345\024a\225Q0\203u\007\306\306\321\321'v\264\t\036]\302\251U\364h\022O}s\266\020m\035\250\036\021\325\345\245\332f\252kr_\234\314\375\340)9\006\222\326$\214\275*w\240KR\037\307Hj[\035\251\\\323U;\310q\326\300j\260\221\3720%fK\202c4\343\"\265\253tD\352\2470Wm\036[\365p\254U{\307\220z%H\214$'\244vSV\375W\216^\221\303\252\255\304W\365R\254j\037q\0206Vq\022\025\337"
+	.ascii	"\362\246\334\221\213~\234)7\245\222\223\252|\3630\241'N\034U"
+	.ascii	"\177\205\326~\301P<u\262\324S}\020\247"
+	.string	"\372*\235\217\372#\206\036\265\201n<\2011\217z#L;\352\317t\264\344\232\216#\007\344F9\246z5\366q\343\306\306\3721\004D\001\031y\251\036\214\225\352\327N\203{\322\254\240#N\2527\343\031\\\206T/\266Yj'Z\360Q}\232\203\235\344R\f\221b\034\365nF\365l18\204\334\215\372'E\f\306c;\035P\261\215\372\267\0327\346\232\330k\206\f\207\023\023\325\027\241Q\237\3063\352\223C\365hL2\352\243\334d\255\251\257\020T0\b\365H8\006\0131\342b\375\021\026\252\214c>GP\247\200\3219\037T>\361\3426\266hl\r\261\213\372$Lc\310\n\023\fT\277\305\r\244\310\301\304\304z&\374\303Q\271\3670\232\001FZ\016\267\250o\302\nH\217\320\340\237z\255\341\223r>|\206\341Hh\213{\352\333X0\bRVC1\230\247r\t\316\035\207`\360\212\312$x\237x\207s"
+	.ascii	"0B\310\310**{\300:|\3141=\206\220&F\354A\375\324ON}T\212z'\241"
+	.ascii	"/\345^\330\206^\214\242\236\b_H&\247p\007\365^L\304h\2713\022"
+	.ascii	"E\214S_\306'\256\224c\023\365P\230J\324;\331%G?VL\242\036\251"
+	.ascii	"C\341\343\004\337\324/\261\"\261\204\205\365!\374\214\250?\177"
+	.ascii	":\231L&\271\254G\331\246~\bS\200]p\r\003%\2318\205[\344v\027"
+	.ascii	"\002\217\343\237\034\\e\023?R\352\245\336\352\237\334\352\263"
+	.ascii	"\332\352{\260\325\013Y\253\347\301j\365;\322\352up\357^\350t"
+	.ascii	"\264\027\345\242\324Ca\031'P\357\343\254\362\b\263\233U.#\324"
+	.ascii	"\324\324\324\274\254\236KWS\226:L\273u\327J\347\020\f\275-9Y"
+	.ascii	"\375\017\336\335\004d\020\037Z\227\236U\224\035y\037\232\346"
+	.ascii	"\2737\037\022\025>\264\314?\364\217\312s0>\361\202\375\034\351"
+	.ascii	"+\004\203}\201\363\274\324\212\027l\016P\016\204\357\242(\260"
+	.ascii	"\r\320\317\020gh\220\036\2022'\301`kp\376\003\214#^\260-8\337"
+	.ascii	"[\"\342\005\233\246x\001\371\347d\235\2701\330\027\212\337)\031"
+	.ascii	",\276\024\354\030\225`\303\230\307\240s4\002\030\344\030hD`\260"
+	.ascii	"\177\245J0\202\315\2248`\020\230\304\f\030\354\tB\027\344\027"
+	.ascii	"\312\315\315\225\202\355R\374\203`\330hI{\301nA\377b\345\002"
+	.ascii	"\355L\301\356\025\177\034)\030l\036\312+\017AMR\225\207`\357"
+	.ascii	"\3203 h\353M'\374\213fZo\n6@J\312\352H\301\017Q!5\020,"
+	.string	"\333\261yR\260\201W\362\320=\341[\354\311\t\204%5\256th^\252\322\241y\346\001\340\204\355\b\354\3008DQ\273\016\020\214\2210;R\007\346i2\322\353\320\023<\002\233\247\343\223:t\006'\006f\217CK@x\027 o;~\304\241+HO\341\305\317\331I\201\331\343\320\023\314\337H\b\017\034 \007\001L\371*\002\344\320\"\306\022 \207\326!u\236\203C\353,\360\360XZ\341\3204\357\305\260\261\264\201C\003\217\304\241}foCO@o\264\241]\312\226\262w\366L\225\r\035\026\205\307Y\n\334\320\274\342cR\234:\307\261\241u\310o\231S\021\204\347\330\320\272Se\203\221\237\263 \340\206\226\001nh\235\251\342@\353\312\023?\305\021@\007:\304\273\f\016\311q\347@WP\35644My\006F\314\250\002j\350\230\363@\343\325\023PCO`\261\323\320.e\317\344\235\273\362{\246\026V\004j"
+	.string	"\022"
+	.string	"\b$"
+	.ascii	"\001\332W\3762\264Kzv\332\261*\362e\350\226\363\227\241Y\314"
+	.ascii	"\277\2706D\363e\350\013\347\033\254\246\246\374ah\337y\306\252"
+	.ascii	"\251\271\361ah\226\364\027\323,\247/\246\177\346\317BO(\277T"
+	.ascii	">Rp|\026\232\227\376,\364\316\374{n\254\361\370,\264\256\374"
+	.ascii	"\301t\213\371\376\251Z\222\343\367\322\274\363\374\002\t\217"
+	.ascii	"\223\357\245-(\277P@\214F~\025\232\346\374U\350\013\345\357\242"
+	.ascii	"HQ\322W\241'\244\017\"\2054\375*t\317\274\314\n\030\036\370*"
+	.ascii	"4\214\311D\245\201~1\337S8\334\210\277\006z\302y\356\221J\021"
+	.ascii	"\3625\320G\213~}S\302\217\217B\370@\305o\374\372\310\"_\377\224"
+	.ascii	"\340\353\027\177\303\327/\277eO^Kr\276\036\205^K\213xQ\257CH"
+	.ascii	"\3505\360F\257oJ\350\013kH\350\tlHh\231\035\003\035be\307\322"
+	.ascii	"2+\274"
+	.string	"\016\241\262\3222;\225\326\2415v\375\342{\212\310\215\212\023\355r-\202(B[\325\366\tR{XU\273\005Um\"\220\332,\216\265{~T\3761U\233G\2526\212\250\312qh\3455\250\312_ge O\225\2178U\226\341\243\362P\217\3123xT\246\261\2432\221\216\3125\232*\333`\252ld\254\214c\251r\016\245\312GI\225\221\220*+\035\325\216\221\243\362\n\034\225Y\030U\346\271Q{\247\250\266\0076*\303\325\250\354FT\371\215Fe)3*\267\rUV\223Q9\n\b\225\323bT\036+V&\023\252lfVn\022T\371\t\214\312P>\250\274\344Ee&.*\247@\001}\341\"\233\006\331\300E\366.M7]\261\326\231\275\025k\232\335\246}s\227\0027m\236\251\262\351\"q\221\243\270^\373\325\"j\354W\267\224*\251\206\365\352\232\232\032\033\340\251\262^\315bjX\257\007\024\341\274"
+	.ascii	"\256W\204\365\212\220d\275\304\326+\335$\213d\223\204-\222\216"
+	.ascii	")\317B/\024?\277=\322L\260z\b]\351\211\314\315\267Gx\213(\212"
+	.ascii	"x\260=\3222l\236\260\375k\273z\002\244\355j\340;i\273ZWr\365"
+	.ascii	"\221^\313\305\305\325/"
+	.string	"\351\371R<\262[\375R\356vK\202\214\034\267#\331\255\366\t{\3465\344\224\230\001\334-\th$R\354vk\321\255\260\245#\245*\273\265]2\206R\300\335\312\320\244x\356v\253E$\331\255\006>i\267:\253I\354\370[\255f9}\253\3656\263\324\354]\253ed\207\364K\331\333,\t=h\013\336fExK\213:\221\315\262p\344j\302\333\254n)\276"
+	.string	".\330\210zJ\233\325,\305;@d\214\t\305\320q\350E6\253\201O\332\254\216I)\2341&o\257\032F\370r\376\320_\351\023N8\031\220\342\370\226\351\0015\356U\267\224{\325=$\027\312R\356U\363\204\347^\365NX\334\253~\271V{\325!\366\252]\322_\321E\210\304Y[\322b\372\220h\221m\224\030\342s\255\265\222\020VF\304K\337\\pC>\34130M\371\\\310V\365I\343\253\207~\310V\355~d\224\240\200|w\301\345\330\350\320\033\323?H\350I\324Rm\225\206\021Q\312/mU\323|\302\2110\224\267U-\363\255\352\035\032\241J\b\355\244\241(A+\205\343\004\350YK\245eD\003\353B\226\312\270T\255Ka\366\270"
+	.string	"\260\262\243_\241X{\034z3\303z\323\036\223\366\330-B H\252\263\267S\354teC\350U;\025\2004'\245\036\222\207\032w\252y\346\312N\365N\250+Z\355\324\225\2167J\036d\247Z\346;\245rvd\242\220\306\230\327\331D\t\351-\352\200\024\034\274E#"
+	.string	"5Q\271\234g\234\037!o\321\225\232\242!\017\213b\335\b\302[\224\001\254$jWZ\324\345\346J\206\207E[\207\202\335h.\272hp\207\233\215\037\027m\231/\332!\240\240\232\346i\317\037,{\256\323>q\226ZX\320\321u*\302y\001\366(Tj\235\372\305\251uj\021\353\264NDl\210t\334\251C\223\244%\036\210\356\tO\020\315\202\276q\202\240\265\261\2248<\200\350]\361\213\244H\003H\227z"
+	.string	"\321GB\201\350\243F\020\037\341\004\314\354M \232\346\013\245V\"H\002\020-s\020}\241<\033\255\205\360\343'\301\267\230\216-|\022\364\004\357\251\034\267\254?I\020\201\323\002\372\002\362:f\372\202\371\016)x~Vf:F\370\0353\271\025LY\351)\340\274`[\231\351\227\363\277R\315\004\316\344p\234T\255\314\364\017y\013)\276\312\316cf\247\003\207\2632\323\023\220=fz\302\t\234\351\026!\213\220\207\312\364@\001\331\t}\314\264\256\210\274q\246O\366\245\231\246\371"
+	.string	"l\272\232x3-\363\231\026\361\223\265%y\334\370@\313\234\267j@q\363\360@\303\244\217\260\243\242\005\357CG\271r\343}\350^\371\034R\207\031\357C\357\204\306\273\023\302\035\210\201\003\255\034\250uq\007\352\013?\345@\311\003\365\006I\227"
+	.string	"\n\353\304\b\027B\357\200 n0\376f\236\217\240#\353)wb?\031\251\251@y>k\030\341\240\330tbop~"
+	.ascii	"L\222\030\244W\3011\322\263]'v\004\204W:\261-H\317VUD\025\223"
+	.ascii	"\201\023U\202\304\245\330\235\270J|\224X\256\023o\243U\244-\306"
+	.ascii	"d\300\314\235(\205"
+	.string	"\344\341\265;Q\345\313I\331\356\304\263M)*\036\351\304~\361\021\330\230\301\342RNl\021\357\235\242!\257q\342[\374\374t5\037\200\224\b\325}>\354Z\236+\366a[\300\374\312\022N\330JZ\201\363m&\374\001\"\225>l\r2\300@\002\345\005\302\b\230\026\024umU[\347\371\260)8\371\303\025\0367.\030\3640i\016!G\373p\245`4\235\305\2073\304\274n\374\260[\204H\310^\311\037n\320Qe\324\037F\360BH\312\335N\225\017{g\276\347C>\376p\021\003\370\241\001\222\210\305\255|\330\300'}\b\003\345\305\265b\352\312\025KU\316\367\334\007m\210\2166\340}z\002\037\367\321\360\236\363\274\307\355<g\3217\317s\236\357|\305\036\371\212\257\370)\\Rj\261\3646^/}\340;\335\362\235\366\025\277d[KMo\372N\303\234\275\357tL\371\035\025\311\353\364\005\"\330d[ \255"
+	.string	"\007\345\006\346\201B-s\247\234;S\203R-\315"
+	.ascii	"M\333dc`\276\225\234\240\275-\233\271c\233l\t\224\027 \277G\026"
+	.ascii	"(L\234m\223\035\201\363?\342\2438\334)\233l\013\312\257\224\345"
+	.ascii	"\314PA\371B\201\226IA\211\201\346\210ISJ\220\2361\346\205\322"
+	.ascii	"B\032s6\260\311\216\2011a\312\n\351\313\271V\233\354\227\237"
+	.ascii	"\371\333d\373|\233l\227\262\005\306T\331d\267\224\273M\372R\240"
+	.ascii	"XbI[6\271c?`4X6\331\274\022\371\265M\366\356\\\300&U\330\262"
+	.ascii	"\206\003@\346`\321|\305\204H\344\310l\327&\343v\n\333\306\305"
+	.ascii	"\215m\\\\\334\313\035BG+\005\371\265\205\353\016\212\320N\260"
+	.ascii	",\\\213@Z8\270s\245\364\313m\333\267\246\371\001\240\310\330"
+	.ascii	"\261Z\373\3262\337\267\006\036\251\370\246\242\016=\212,\020"
+	.ascii	"\304<l\333\205h.\202\334\270m-/\244t\361\266-\0274\203\206\213"
+	.ascii	"\031\203>G\004\325s\265mk\261qf\202\302\266\375-(\371c\327\226"
+	.ascii	"-m\327\232\206Em\327v\255\237~\355Z\037]\024\213<m\325\324\322"
+	.ascii	"VM--M\311\223\234\025{\266hg-l\200\036e\321\372B\243\243-\332"
+	.ascii	"\313\242\241\031{n4\215<\354\031\023?\b\253q\343\236}\315\213"
+	.ascii	"G\213\267g\353t\243\204\204\267g\335;\317\3727\226l\315\232\006"
+	.ascii	"\303\232\265\314\232\375\324\tw\274\236\371\300\222u\357l\021"
+	.ascii	"2\221\033\017pxX\262\233\351\340\360\271Q\370\246%\273\f.\261"
+	.string	")\336\222\365KJa\311\372E\343\216\365\313\205\262c\035b\307\032\b\245\267P\372\202\364\202\022\271\310\266@\250$Ev\005'\005(M\361\0022\006\215\021\"\213K\026\331/%\222\311\371\023\206\220\242M\234,\262}%2GTq\004.\022\001LR\236\200O\026\331\274\322DB)\216-\262uB\262\024-[d\203\250\250\362\2600\314\246R!\252\021I\223\244\003\342\n\020\032&Q(\241e\036\022 \024U\tR\211\210L$#\201\310\314\003\2402\207\0233\243\340_\025\225\3070\006@\217\245\rf$a\035#+\201\212c\205\317\213`)\236\270\245\020\217\262\344\327\231\214v\335\0014\216\375\337\201\374\020\371\212m\215\256S\251\303o\216\205\335\337\360\r\036F\001|\316\033<L\376\017\354&\250\264$\037\277b0\371\202\246\374\244El\335v1\212\313R\374\266\3208t\3569\354\354\2227\240\2569a\314\271\""
+	.string	"o\300\024\313\223\bQ4_\221\24676\263\013g\367\035\210"
+	.string	"NFF\367\246\326\200at\233\207\225`F\330\177\n\b#\364M\213{\034\207\214k\276\360\255\013c:\2170\210\3020\376\204\252\340\336=5\033\251\355\264A\346?\225|\3744\335\1772*\340=O\272\027\300\206HEMQ\016\274\202\317tl\344\177U\023m\to`\321A\023\226@\214\364v\321\201\376\322\317\217H\375\351\314\007\307\330\215\177\351\t\262\372(\325\355/P\360\016\262e\001^C\317\275\017a\316\273\317\342["
+	.string	"\326=*@\342\\\021\017I\214;\326lp\375\331\033+,^5\366[{<\2060\033\017a\370\222\020u\211,\212@\214\257\002\377\305w"
+	.ascii	";'`\262\335\271j\371\031\007\322\177\343\017\360L\030l\3269+"
+	.ascii	"S\013\t\233\237"
+	.ascii	"\222\317\237>o\200\315\342\265\353Q)\035\253\242\205\251\346"
+	.ascii	"\364\356IB&\315\215\366'\02772\325\231xS\227^_:(\205\341q\241"
+	.ascii	"c!\236\021\232-\244h\244"
+	.string	"\374\257\301\254\274\\A\206\241\315G\201\221E\003\220(\223\t\341\200\030\bgp\340\344M\307_\337\207\003\252\037\306'C\352\370N\\y$SBT^\221Y-\3311j\t\231\272\226\224\237\242\2024:+s\376\242\340\263\n5\203V\024\240\3354\346U\034\"\353\r\367\362\366 \355:\020\344\306\275K]\206 \030\004\305\037\001\334\026\371Y\204H\225!M\333\333dG\233Z\376\221\016\355\266\177\363w\255\242G\360\b\207\356%\037\226cFk\027\2011\006^y\3427\201qM\247.\001 \315w|\bK[\2040\263\333\356\301\034@`ih\3221Q\245He\220p]\025\312\206\320\327\264\351a\226\017\222\002\f\024^\346\337\270&\013O1\01620V-^n\267W\254\254J\b \331\f\247G\334<\036\347\203K\b\020\352\3473\254\342\363\241\370\350\364\252\241\366\251\fz\367\266Z\264\217\245\265\350\024@\333\270"
+	.string	"\321i\foc\240\270\241b\277\234\033\354\362R\225\221\320E\341\260\334\b\264"
+	.string	"\n\024\223\350\230\013\203;*&\246\314:\315\236<W\262\313\302\202\336\264C9\211\234\272\203\303er\360\213A6~\300\037\r\374\376\347\251\343\263}^n\302\245\216\277X\321\233\2142\263I\354\026:"
+	.string	"%}\177\234:\265"
+	.string	"\247 \233\312\003\221\232B\334\221\230\251\3460e\361\257\227\322\267\364\364\203\016\352\217?\315Y\247\203m\357\f\022\271\354\220\301'7\320\366P\027\312\267\002m\222\337J\346(.gU\215\0068\3133*\257\346\024\313'\277\237Adw|\032m\312\3155\266\304\021Ne\003\200\220L@C~\007c\3206\222\2279-\364 \213\216\274]d\n\301o\237#\361>XB\322#p\026\372[\320\337\032\352\036\324\002m;\347\240\226\344\f7\357\357\ty\317\t\220\020\371;\\\216f\370\216\376\270\274\261w\226|\204\335pF\350b\224\310\007\245<i_\0163\023!v\252\360X\217\262v[\267U\370\\0\207\260\322\303\3421\001\231Rl\304\347\277]\267L9\"u/\315\037\356[Q\027\027\034^\207\213Qy\033]\306\203-VW\003\326j\265!\344"
+	.string	"'V\303\016<\336\256\276\262\220\366g\337\251\037\020jH\336\254K~\375\320\272g1uU\t\022\206Z\315\221caw4\224\240\272^)\313\307\363\022NN\371y\242\335\310\207\006a\314i\023"
+	.string	"\345\300V\363\036\335$ i\243l\313\002\323\222\205\217\362\356H}&\345gPm\321q\032-\032>\221\376\002\246\203\001"
+	.string	"\365\033Cv,\335\2156\346\376^\314\2770\316\353\325\236]\246\366\275B\273\214\246\260f>.w\310K\302oL\242\304\326\210\250]\217_\352\363\335\303\3565z\367\343\023\365pp\355\207~\321c \236hn,\230\2025;z\244\304\316\216\272\266H\035\230B(?\321\246\366-Z\325\"\300BUS\231\273\372\231\324\301\335#\276S\030\321\272]X\022\201\0057\346\265v\373\245\302\334\003\231u\007\304#\340f\241b\b\251\260k\020\303\373\347\325\177\351\255{R\377\226_\273'\365\177\371\253\373\\\375\225\274\373\317\365_\371\253\367T\371\227\276\273O\225\177\371{\367\264\376-\275\364\317\353\377\322{\367\254\372)\277\366O\253\237\362{\377\251\372/}u\236\353\357L7\b[\224\007\\w1TD\\\211\364\240\242\301\"\345\344\241\032q\210%\273r\251\205\242\001-\242\235\312\340B\253aX\305+-\365\375U\213]\364"
+	.ascii	"&\320\026\230\261dz\224\232\251\023\236GW\204\235(\373\326\310"
+	.ascii	"\351\f\276\355\024}:1\255\336No\177\206\354\006XF\313\243\220"
+	.ascii	"\367*@}\234&\276\nS\235\\J\221\2020d\226\334\260\260\375FL`D"
+	.ascii	"\3072'!\\\316\345\321\225\316"
+	.string	"\210@\264J\335lQe\343\360\304X\341\230\"\321\273\222\330\372<I\255\365\034\017|I\313\300/bg\032?\r\245\211UP\224\353\022\376\360\270,f\275h:\251\323\350p\217\354\201\033\0013iP\231t;\t$\305\272?\354\366\367~I\3424_\374\260\356>}o\2518\202h\237VZ~\272 \230!\f\212\346\3207\232\\\"\321T?8\005\2508avQ\233\326\251\354\324\234\345\251\317\221\335\331S\203\255r\313N'\rlL\t/Dy\315x\323\fJ3\357/m\367\033\332u\241;\230z\001\270\220)\372\013\300\306\237\t\305\242\206\t\231H\371\020ZK\035 FP0\"\227\362K\faX\\+\325C\262\376K\025Q\360\0312\203\032NE\022\315@4z\006\331\020k\355-\350X)\360c\251\252\330;O\002\3161x*H\331\227$\224P\205\263\337\341\215\330\274\257]\220_\211\375\nF\334\267\322"
+	.ascii	"\233\266\201|a\214\250\271\250f\323\227\270\321\273\356\305\271"
+	.ascii	"q\234\023\334\274q\026:b@\036\001\037\3030\224\342\370\214D\263"
+	.ascii	"7\337C\363iH\033"
+	.text
+	.section	.gnu.lto_.refs.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375`\220\004\245\033"
+	.string	"v=\263H\260XQ\032\003\214,\214\254\"\3263\037d\247A\002at|\374)\375)\3751/\2202Bq\"1\365\256\274\216\027ox\177\252\330\243\270\311z\252\212\334\b\336TE\037\305\243\001\372W\034F\205@\313\364\243\021B\266\224)\226"
+	.string	"\236"
+	.string	"\236"
+	.string	"\277\210\364\034\333\333\330\236\306\366\"\321C\342?\271\376_\355y\256\317\251}\350\232&\332,m\307\262\267\325\2455\332\334\366\366\"\273\230\335\310Nf\377\262#\331\223\354Jv&;\2647\331\240\335\311*\216\275\314\016e\177Z\235\261Jc7\2633\255\332\330\303\354\f\3668\3739{\235\0354\237I6\220\376\314e\344' \277\207|\034r\237\360\t\033\201~{\275\316\353\236]t\355!\201\2378\277\003^o\266\021\237\343o\270\353x\315\2345~8\276\332w\\\324\027_\004\260\245\020\276\313\025\t\305\006\002w\234\201z8p'\260\006z\211N\276D%\354\001"
+	.string	"\334\264\2077m\204\371\316?\275\365\357\347\277!\314\217J\362o\373\336F\333\247\037\370\310\357\220\273\016\271\337\354\373\001\353P\367;\356`\237\rt\2747\342\375\215\367D\274\007\342=\311{\030\357{x'\3210\230\263v\372\ni\247Y\260\n\346=\3359\275W\352I\245\276+u\244R_P\352\263\\\243q\005\342\243\307\216\034K8]o\340\364\263\004\313\277J\251?\245\374\242r"
+	.ascii	"\245N\203\333E\334\336n\002\037\351\211\275,\325\304n\033\370"
+	.ascii	"C\266\027\222\331\236$z\037-\3610%\261#b\317\253V\204\216\244"
+	.ascii	" w\253\311\256\252\332\020\253\307\251\250\026\304\3163\225^"
+	.ascii	"`*\375\260\317\247\326\203NK\260\363\324\356\022\360\324\324"
+	.ascii	"v\030g\271\224\203\252\220\325 \253@V\177\254\372\330\r\342;"
+	.ascii	"\331\313\217\344.\3773\227\357y\313\037X\352\t\254\345[gY\303"
+	.ascii	"\352\226\354G\331\031\366\232\255|"
+	.string	"x\360\365\340b\bg\215\372x\224.\036\005J/\210\307^\237\363\372\325k\013s\325]A\247\301~\266\323\307v\332y\002?\272^\034{\354\241\362\330W\247\353Q\252;\3065\005\2113d\306\2009\352\377\342E\352\n\226\331~\025*G\375\004\345\311N\300\241f\232\b\203\241\276\3106T\243\t\275rf\373\316lo\r\025e\035W\035\261\257\332\367\020\331\343d\177\253\t\375\030\340\031\300:\030\\]\252\331fW\034\363iC\317\031\025\325h\252\364A>\006tZ\252\244\207\252\264Z#\300\223\t\323EJ\n\023\225\3617\355\333o\322\030\377\024\306U\373G\364\305F\324\205\322~\021m\321`\177\210\262\330{=]\241bO\322\024\373\016\267\357\024\305\256\303\375Q\271\001e\2501p\246\220\200Fd$\034\005I\223t\220\"T\305m\020\310\0276\003\336(^w~X\256\027\350Y\250;TGS\002a\336\301\303\303"
+	.string	"o[\263\226`\271\226\205\276Z\364/R\025%\225\255\226\260\344S\325Z #\306\023\374d\335\033\226\210\263\274\342\363\274k\314gL\211\227\203Wd\"6D"
+	.ascii	"\277Du]\320j\301C\303\325\302\020\036\207\034\230%\320\360P\210"
+	.ascii	"\236%8\253c\031\253\276*h\351Pa\257\230\314\201\263\367\"4\213"
+	.ascii	"\204\236\336\205eb;\356\346t\202]I\007\315\035\316S\002\252\270"
+	.ascii	"$!5"
+	.text
+	.section	.gnu.lto_.decls.c39df695c615e75a,"e",@progbits
+	.string	"(\265/\375\240\2201\001"
+	.ascii	"}\240\004\336\024G\013\031T\0200\005-5\006K\bc\327|\235\t46\343"
+	.ascii	"\235|= \205\220"
+	.string	"\016\017\n\211\362+_\302|]\300\325\026\323\300\360\351U\034\033\366\223\232\346\033\343\351\314\204\243 \251\277K\223$\365\027i`\373u\037\263\013\257\317R\333\236\232ZZi\215\254${%\221;\005\207\025\347\030)\032YD\033D\034\304+\"\017b\017\242\016\342\225\330E\244\"\372 \356 \336 J\265X\242\026\221\306\2115\210O^.z\262\031)\250h\354\005\213,Qg\247\325\352\231\201D\324Y\361\224%\352\360$\2411\rF\031\021\221v\262\212\346V\024\371Y\226\344\b\211>?sG \020\265\210N\304\031\304k\024\254\302)0\213\344\317HD-\"P\316\3712\212!\027\205\004\f\"\222\016Q\007j\316\006\026Q\006\232\343\211j\022\214\212\343+\022Q\2138tfvg\025\242(\370Ci(\004}\243\316\316o\355\312{\200\326\371\036.\334?Q\306\2113f\2109\024\251\016{\370\262\316AXN\224\021"
+	.string	"\"igY\037\006\334\207\347\366a\264}\030l\037\266\332\207u\354\303D\373\333o\023\2174Q\333\f\035Y\177\343\355o#\373\273k\177\323\330\337F\373\273g\177\327\354\027\t\367\213P\366\213v\373E$\373\331v\345}\261k\277hc\277\370b\3775\334\177\371\366_\272\215\201\nb\316\241]\020]\326?\321\346\304\234\237xC\304i\r\337\030k}D\262^^\333\225\267\rl\235/\261\206\345D\233c\341\020\276\232\254\003@\244!\306:\327\3461\255K\017/\347\303M\306\"\233\365\3375\303BbY\241\240X\326\204\032&z*\274\221\365_\260\035%\013f5\345\3155\006*\226\375@\361\0218\330bs\224\034\250;$\235\230v\304\264\376\213\264\377\262"
+	.ascii	"\374S\37259j\222\265\337\223wE.\260Y\337-\334\031J\033\230\371"
+	.ascii	"\2244\327\230\346\025r\325;\n\354k\261\031J\316\206\350p\374"
+	.ascii	"\272\272\243\241\365\237\367\236\371\376\\\223mZB\345\233\017"
+	.ascii	"\037tYg$\226\347=\262\354\225O\326w\325\366\237\365\362\216A"
+	.ascii	"\376\266`d\215w\005\221C\007^\326w\257\373 \220\345\034'Qv\371"
+	.ascii	"I\213\315w\331\311]k$\347\264oOq\r\215\bYLwV\201H\"1\245\301"
+	.ascii	"W\337\035\332\177\256\333`\337\240\215a5\001\221\024\244\263"
+	.ascii	"\261\242\363P\254:[\2421\307\204\206\253X,k9#\233\\\216\213\254"
+	.ascii	"\357\352\354\267X\331\211[N\313jD\256\237-$\210\033Y.Z\022\225"
+	.ascii	"\257\334Z#\271\210x5\333*\234\352\262q\034\377\317Jr[\216\313"
+	.ascii	"K\362[\206k\261\331-\257=\263e$\327\3278\276A\333\262+\342\226"
+	.ascii	"\223\334e\3438.j\001\365\301)\365\265\337\376[\273\362\"\353"
+	.ascii	"@\344#\360\315u\t\323AI\002\313\372z\311\276.\333\327`\373f\355"
+	.ascii	"\312\373\265\263\016\311;\30267\263\262\242Y\315\023N\326d\327"
+	.ascii	"\033&G}gY__\355\347\253\374\225\201\262\242\342\370\372\234\245"
+	.ascii	"5F\226\211\2244\314\330F\356**c\265F\260\262\\\031\310i\007\221"
+	.ascii	",\226\307\362\220,$csX\213\315`\271\3539H\366z\333^\2672\021"
+	.ascii	"\361\032U\024b\363#\313\002\226\2571\315^\bUq\234a\b\270\347"
+	.ascii	"\253\306\206\251\257\221\266\b\355\312[l\235\357u\317\276\216"
+	.ascii	"\367\211}\373D\275}\242\223\335\241]yA\264+\357\007\031Hk\330"
+	.ascii	"\326E%)\371a\345\372\005\376eU\265\330lu7$\223\221L\210\350F"
+	.ascii	"\326,,\317U\355\326 \227\232\217\036\032\214\212\252F\217\363"
+	.ascii	"Hr5\325\b\313\232\252C\216\233\033\312"
+	.string	"\312\372\304\266}\020\2262\215\0176:*\230Ye\343\370\232\221td\033\031\207\222\030\3075XQ $e\240\366\255\250\001@\200`\351\310J\307\373`\243\243\202\217\037\177\226\3129rT\336\221\247Zl\326\221k<?e\250w\270\3061\211?#\351\31002\220\222\346\032\373,\340\n)00\216\257!B\204\b\321!D\322\357\352I\031R\377\371\3063\216\377\317@3\304\361M\034\307\034\340$dm2\262>\313\363\215;\337\237\242k\f\026\307\361\322X\003\355\350.\353\023\253v{mW\336\016\255\363=\361F\236\341\304c\013\247)\353\023\231\366[l\226\221\235\226`M\202\2104=;=\017\031\177\320n\\\202>\262\31616\324\017\242\025Yg\246\343\355\320\254`\221\365\375`=tv\325\226\365\211F\373\304\241}\"\317>qg3[\347\373\026\233\217ZB\024| \335\031\025\351\031RdWY\363=\331"
+	.ascii	"\275\310DSp\201BYg\241\354\242\305v\310C\3136\316\246\007F\326"
+	.ascii	"'\326\354\023\304m\207\367\207m\207\367\317A\031(\313\265\361"
+	.ascii	"\330\3448i\370\303p\360\247\355{\221|\321\375e\375g\237\334\003"
+	.ascii	"W\035\332\210\263\316-\300n\3428\356`\244\242A\224#\353g\300"
+	.ascii	"\375\026+\263h\001\223\262N^\221w2OV\321b3\213\3660\323\344\232"
+	.ascii	"l\363\366\032\353\334\304q\374\226\253\355j\301r\346\236\332"
+	.ascii	"\260\314\242\035\322\376\021\275\242v\031\216RV+\263\31079\207"
+	.ascii	"\350\025\265U|Ae\343\370\232Y\264\201\255!\321+\n^1\003F6\216"
+	.ascii	"\257!:\204\b\021\"\004\354dL+\r\2513N\276Q\030\026$\353\347\274"
+	.ascii	"\375\334d\267:\355\312\333l\235/ll\0034\212\312\372\371m?\247"
+	.ascii	"\355\2775l\013\257\\\320\300\021/\341\263\301\036CY\267Q\332"
+	.ascii	"\301\267\204\255`K\030\002S\034\327\264\204K\3028\256Y\266m\006"
+	.ascii	"m\233\201\006\342\264C\354\325\317f\373yl?c[\277\253\007%\030"
+	.ascii	"W\216\026Y?\367\200\322\362\265{-\266\355{_K\327f\211\327\250"
+	.ascii	"b\031N\021\221\226\215x5\333cs>\331\276\026I"
+	.string	";\207\323\223\215\343\330C\210\020!\224s\327B\243\255\365:\350(LkQ\262~V\332#H\264xm]\373\204x\215*\212\315\255\310\306\261\327\3776\257\305\266xm\223\217 \361\366\032\307Xq\034\207\350P\374q\022L\323\272u\322\332\265X\013\332\273\217 q\"M\327\025+\216\257K\244\217\317\r\246\254\237\211\366[\013\336\366\260\265\340}\366\331o\003\367[>&\032\351\005\224#,\353\267I\366\3776\256\305\266rm\022}\020~\226\267r\255\222\026\216\310\365\263\313\202\030f\343\330\253C\210e\225\022\254\027Z\267o\327\026\b\237\213l\326o\301v\333\326\272\265\330v\311u\027S\354\025\307\327$\261\206\250\255,\353\267 \336\345\341\341\341a\013\342}\233\265\337\322\330o\227\366Z\207%QVNa\326o[\354\203@\326\026Q\3260\343\033\033\301\2508\276y{\375Y\336\246\265F\332\"\304\253Y|\203#\365"
+	.ascii	"\256<\025@\201q|\363\277=\322\252\265\3306\255E{+\326\216=_\343"
+	.ascii	"\330+\216\343\020!:\030\263\214T\261x\365;\260/\201\335\226\265"
+	.ascii	"f-\326C{v\275\306q\274TF\221\363\001\314\372%l\023\304q\353\341"
+	.ascii	"m\017\017[\017\357\037\260\237\200\375\0176\006\355\312\253["
+	.ascii	"\347{\260v\345m\203\264^-v\203V\310\333\255\366z\267\346\032"
+	.ascii	"_\343\370\272\334s\331$\267\254\037b\2474\305$\376\356\267\033"
+	.ascii	"\274\304\303\303v\203\367y\277\256]y\231\355\312\233[\347\373"
+	.ascii	"\300v\345\375\333\254\277\275j\261, \352\3600\305`q|m.\257D-"
+	.ascii	"dd\375"
+	.string	"k\273\362\356\326\371\376\256\215\021\"\006\210\031 n\200\b\303O4\361\377\016\316\306\026\371\206\330\002\261E/\200\347\207\251/\222dU\215\3037l\350\317;\303y\345\365jA4\2018B\t-\007\327\306\365\300\036\354p\031`\r\220P1\346\374p\3225i\263y\274X\311\021\340xy$aZ7\257\300M\2440\370\223\320\327\375\333\2461n\325\332%\371\306x\202\037\036zq\\\006c\212\267F2\206\337A\261@\233\374\320^\240U\276?\311\001\330\370a\023H\200\374\221\202o\341\223\203?\314\341w10V\215\324\337%"
+	.string	"\\\301o,\302\030\374\256\b\227\003c\b\2142\360"
+	.ascii	"~\243\261e\346\253\037\340OB\371\341\245qZd3\306\374\357\213"
+	.ascii	"\253\201\274\335\f\300 \270\0268!\354\374a\225\337\b\303\201"
+	.ascii	"|\245!\360\372%\357\262\322\265@\013\305mb|\371_8w\034\373\335"
+	.ascii	"&\377\213\343\177\221\274\036\274^\306\032~#\b\376W\215\006\243"
+	.ascii	"\211\337X\342\275s\347~\343\3637\316\360\2771\374n\366\204\327"
+	.ascii	"\001o\215\227\307\313\362v`\374\300o\364\200[\370\342\0319\360"
+	.ascii	"\0337\360\273\203B"
+	.string	"9\371g\345\237\217\1776\376\372\001/|\364?\236\251\355\370_2\243\005\322\2227\376\227\303\313c\013f\013\030e\370u\340\341\0173 ,w\340E{q\2141\374n\032SG\201\245F\030\364\016\373\334\366\211K4n}\345\"\203\224\031]c\005~\267\212i|\301\350\302\357\272pWZh]\200r9\274-\270\036\210 \210!\210\034\344\020\274g\277\021\t\200_c]\r\030[\310;\273\031\200Ax_\214,px\341\005\214\024H\202\251F\025~#\n?\274\004\236\301l=\334\354O.\315\375\271\216\203\007\177^\311\034\230\377\333\374\215%\310\345\273\r\274\310\377+?\322H\302\257g0\216\360\353\r\270(\376\266\317\265\001\3577B\340\327<\277\361\001Y\372g\020\374\271\206\277\350\363\033\035\360\027\177~c\0038\370\363\210?\037\340\317\025t\220M\270y\277\221\001\177\376\340\317\031\030\027\360k\245\f\374\277s3"
+	.string	"\203`T\311+F\005h\243'\377W\370\217l\277Q\204_\217 \227\360g\023\376\342\314oL\300_\264\3417\"\340\317\016\310\r\370s\0022\313_4\301o$\361\027O\360\033C\370s\210\277\250\3427\202\360\027u~\343\210o\220W\214,\277\361\003\243\007\277kwL\373\265\207\377\225\261\201\374\373\3527\212\370w\226\261\003\343\001~\355\3666\345\f\376\315\365k\243\177w\375F\016~c\210_\2530\032`\013\371\215 ~\355bL\303\277V\3715\362\177\227\376\227\3517n\360\302\370\211\326\020\374\357Q\013\345-\372\215\005 \362\303\204\357\220\221"
+	.string	"\277n\362o\254Q\203\263\215f\034\300V\262\333~\243"
+	.string	"\376\375\366\03330b \367o&\377\236\373\215\027\374o\241\357w\0270\006\340\327$\264\036^\375\223\033\374yg\230\207\340\277\377\2100\257\234\321\202#\305%\025\214\037~\227\005#"
+	.string	"~\030\376a\343o\254\200\303_\376A\206o\200O\223\200\367\337\206?\231d\260\005\3677&\271+\030\205~~\270\002o\235\321\303\316/T\336%\325\376\367\353\177\261\277\261C\241Wr\207\203\037\006\241\203\377\307\037\311\201,\254\024\377{\365\277b\277\221CXR\350\3277`\006\364\370_\037\277\221\002\031xH\377\334\001\335\201\247\377\205\372\215+F\225\277\365p\n\376\244\013\377N\300\277E\370\215)\377f\200\261\371\200\037\006a\237\360o\024~#\363\337$\374\273\204\337\270\334 0@\204\377 ~d\b\336\024\366\f\377~\376F\345\357\332h\247\227\004c\022nr\302\377\017~\344\316\3372s\b\334\021F\244\233\375/\342?\302m\r\354\r\374\306\343\277;"
+	.string	"\233\360\017% q\376mc4\346\253\327\002\310\033n\006`\020N\374m\363\215\376F\230H\001\026\214\373\327b\277\333\322\206@\303W\213\007\310\226\377\005a,\376/\007\377\365\217\304"
+	.ascii	"\001\366\006\201\3776\300o|\333\020^\003 c,\r\2760\177\353!\t"
+	.ascii	"\341\276A\233\375F\327\250\213<\266\t\376}\202\337H\374\207\024"
+	.ascii	"c\376\211$<<\304\217\254\321\016)\002\037F\375\260\341\007\307"
+	.ascii	"\276\274v\2404\371]\353\036\332.\376\375\342\207\013\333\270"
+	.ascii	"\270\264\215\376}\364\303\204\203\2053\374'\361#\271\200\300"
+	.ascii	"\203\"\370[\022\274\260\275@\t\356\341?\206\340wu\374\332\013"
+	.ascii	"\216\362\303\202\377\256\300\017\373\375\305\245}\201\"\033\266"
+	.ascii	"\357\207\367\034\200\034\001\017\254\367\303ym\365\207\361\376"
+	.ascii	"vf\260\265aGK\233\002\n-S;\265..\222\"\331_,\373\341'\355\f\231"
+	.ascii	"\004\256\213L\243g\300w\260\035\207&\177^\221\001\246\373a\270"
+	.ascii	"\037\376\202\307\226\374p\222?\227`\360\277\364?\002\266+-\005"
+	.ascii	"\376v\205\277\225\300\337N\340\207\323\3766\005\024\376\366\004"
+	.ascii	"\177\253B\013.\fq\360\267\034Xi?\300\301M\372[\227\021\374\372"
+	.ascii	"\tF\203\213\234u 2\366\303_\177\256q\013\377\023\340?\016\266"
+	.ascii	"3\374\232\004\256_\313\264\374\355\007\376\366\331v\340o9\360"
+	.ascii	"\303\327\277\205v\200\263\\\224\216\016\220\262\203\261\376\375"
+	.ascii	"\267\001\177\370\352wi\350\020\362~\255\367\303@\340\037V?\314"
+	.ascii	"#\352\277\005\177\362)\375\333\032"
+	.string	"~]\302\013\020S\343\350\302\357\332l\351\277A\360\303Q[\346\337!\370\341\035}\260\216\277\b\365\027m\374p\216\342\322\257\233`\034\377\333\302\210!\360\r\330\006\f5\343\177a\005\376G\340G:\305\370u\327\216\356\022?\314\364\023\t\360\0235\370\211\005\370\211 Z\017\355\005\210\034\270\360\277\202\037\271\304\345\001-\002\224_\367\375\360\022\254\224t\2451\372\365\221\023~b\t?\361\001?q\004\242\t?\021\002\277.a\377\374\033\350\207\213\376w\370\006\"\360\001dV\016w\210\036q\007\277\200\211\206ph\240]\362\267m\177\253\004\256}\373\177\367\017L\210 \375\305\267_\353\200\201\376\327\b\377\374z\352\317U\177q\356/\322\375\260\317\257/\310P=E=\270E\016+\376\375E\300\037\346\321N\377\316\233\370\303,\270\376|\202b\327\017\257\310;\177\206\361_\206|\325z\270\n?\262\371\303;\377^\376\260\315\366"
+	.string	"\327\264n\006\3737\006\377\316\340\207i\212l\177\021\311\017\307\377{\201\006\002\237"
+	.string	"6\301\246\240"
+	.string	"%8,\202\302\213\360#'\220\342\327'^\001\374\357"
+	.string	"~\030\305\237\007\377L\370g\301?\007\346(;\345\337\316\037\276\341\317\205\277\033\302\017\317\374D\370\207m\370\006\031\373\347\025$\006\3775\370\221$\274I\336\031\275\200\"l\205\2530\365o=\334\371'{\3001\277\266\"\226 n`\327\200a~\242\006Z#\304\f\374\360\313O\354\200\005\376\177 \266\360\177\003\304\032\210-\027\300\217\304\373]\033\270\206\326\211\007^\020^\0220\b\376\"\017\302\266.\n,\375\211\315\274\377\f\377\373\203\237\370\001>\361\273'\300&\376s"
+	.string	"\326"
+	.string	"\\\342\207g\370\211\034\376\274\3222[\017\037\341GB\335\035\330\003\032\013\356\300\337:\371\333\272\377w\037\334@\213w\344\230\343?aa^a\361\267F\376\026\355o\231E\261\2778\366\303\034\370\335@x\003\260\006\362\315\013\221I\036p\f\377_x\204\002\303\257]dpo\216\260\313\001\017\\=\203t\240\240\311\341\214I2\354\365\371_\240\037\256"
+	.ascii	"\374\302\257\331\340"
+	.ascii	"\006\374$3\200]\200'\220W\234\240\375\272\004"
+	.string	"X\002\377\033\303+\274:\377\273\363\303*\374\337 \204\366\0022\2749\377\001\360'\223K\340\b\274\356\bp\n\177\256\373\020\3236a\024\316\301\237$\306\354\311\215 \317\355\251\177S\375\360\t\177\013\267\311\247\310\220\237,In\375\273\003\377\306\361\303&\374\257\b\376\227\004?\\\302\337\026\177]\302?\274#8\363G\002\266L\031\362\212\321\246\215B|\371\335\270\337\225\373a\022\376\303=\373\303#\374\310\377\264\357\3750\004\036\360\353\033\360\376\363\375\260\003\376v\377\367s\335*\334\200\366\370\377\356\205w\373\337\341\005\370\006\376sxJ\214\373\366\177\001\377\221K\306jt\262\366\344\177\354\241o\300\fX\241\362\037W\016\377\306\030\177\321\304_<\361\303\013\370\335)\254\200\277\b\363\303\"\300\t\200\021\360\277\260e\346\225\243\2077\177#\\\261\245\230\0018\2046\204\027^\371\037\245\376\341\203\332\205\275\344Z\240e\353w3"
+	.string	"\203\360\273\026x\341\367o\254\372]\013\300#\376\376F\252\277\030\303_\224\341\207Y\212.\374\305\027~\370\203\337\205\341\2032\024~\371\033s\374\304\352_l\335\277X\204=\370_\374\223\n\370\337\027\306?\311\362\277$\3767\204\237\230\362\237\370#a~\027\310\017\213\370\333\020\214u\360k\033\370"
+	.string	"\2776\001\007\277\016\301\003\360\037o\370\335\276\354\017\207\370u\004"
+	.string	"@\342\207\r"
+	.string	"\203 ~"
+	.string	"o"
+	.string	"\027\340\327\325\037&"
+	.string	"\254\301\257K\360\n\376\343\335\017\017\340\2073\370\341\n~\270\303\017\253\3740\363\207\215?L\374\367\341\277\013\377=\370o\301\177\003\376\373\356\337s\377\206\373w\333\277\215\374\373\354\337e\377&\362\357\261\177\207\375[\310\277\275\376\335\365o\255\177_\375\233\352\3378\376m\343\337O\377\216\361o\030\377>\372\367\213\177\017\375\033\350\3377\377>\301\277Q\374;\004\377\006\301\277K\374\373\371o\017\374{\003\377\276\300\277+\360o\024\376]\302\277\037\360\357\006\374[\204\177\263\374\233\203\177\033\340\337\033\374\233"
+	.string	"\377\036\300\2773\370w\005\377v\376{\371o\342_\004\374\213\331\277H\367\027\341\376\"\222\277X\366\027\307\376b\327_\354\361\027m\374E\246\277\370\363\027u\376\342\t\376\242\r\1771\346/\236\370\2133\374E\031\376\342\013\177Q\205\277\330\301_\344\340/\202\370\213"
+	.string	"\370\213)\177\021\376\213\305\277\350\376E\342_l\377\267\360\177\005\377\327\357\177\241\374\357\336\377\342\375\357\335\377:\371_&\377\273\344\177\221\374o\222\377U\373\337\264\377E\373\337\263\377-\373\337\260\377\025\373_\257\377\305\376\357\365\177\271\376\027\353\177\263\376\227\307\377\372\370\337\250\377\225\372_\034\377\233\343\177k\374/\324\377\312\370\337\246\377e\372_\030\377{\364\277E\377;\364\277B\377\373\363\277@\377\313\342\177w\3767\347\177i\376w\004\377K\202\377\265\341\177a\376\367\304\377F\377\227\206\377\235\341\177?\360\277\026\370\337\030\376\267\002\377\353\302\377\246\360\277'\374o\t\377\353\200\377e\300\377\212\360\277\b\370_\226\377\365\340\177;\370_\016\376\327"
+	.string	"\377K\200\377\035\300\377b\360\277\034\376w\345\177\235\377\333\374_\344\377\032\377w\377\357\373\273\205\277;\370\273\202\277\353\367\273|\277\233\375\335\274\337}\362\273v\277[\367\273s\277+\367\273o\277\213\344w\327~\367\310\357\022\371]\257\337\275\372]\253\337\335\361\2735~W\351w\207~\227\347wW\374\356\315\357\232\340wI\360\273\"\370]\024\277k\303\357Z\177W\346w\237\277\333\362\273\036\370]\016\374\256\006~\367\002\277\013\303\357\276\360\273-\374\356\n\277\213\302\357\222\360\023A\360\273\"\374n\002~\342\007~b\n\277.\373]\004\374\304\020\377[\370\211\026\374n\b?\361\370\273 \374\371\356\317J\177\006\362g\262\277U\373\335\021\277\373\301\257;\360\267O\376V\356o\275\376v\346oa\376\026\372\267-\374m\b\377\375\3766\371\273\"~\367"
+	.ascii	"\277K\200\337\305\340w-\370\211j\277\013\200\337\365\360\273"
+	.ascii	"\034~w\345w\235\277\333\374]\345\357\"\177\327\370k\005\374\356"
+	.ascii	"\376]\342\357\266\277>\374u\341Od\376z\360\327\201\277\356\373"
+	.ascii	"u\002~\255\367k\020~\375\344\327,\277n\362k\271_\273\375\232"
+	.ascii	"\355\327G~\215\366k\263_\023\371\211,\277\026\3735\366"
+	.string	"\327_\277\356\372\365\326\257\257~\"\211_[\375\031\351\317,\376|\3755\217_O\375Z\307\257\241\376<\202?\307\277\246\361k\247_7\375Z\351\327F\277&\372\265\213\277\315\376\332\347\327<\277V\361k\233_\233\340\327%\370\365\b~}\303\337\216\375\332\206_\007\340\327\325_\207\340oC\360k\231_\303\374\372\304\257]\376\313\360g\025~=\303\257[~\355\201\237\350\301\2577\360k\013\374\332\205_\253\360\353\b\374:\205_\237\360\023\001\360?\346\377\331\337\272\2776\341\327%\374\177\373[\016\177\273\362\347\225\277e\376'\374\377\341\377\340\257I\370\177\367\353\021\376\026\312\257!\360k\007\374z\001\277\026\341\327\b\370u\b\277\036\361\353\017~}\301\257+\370\365\312\337\366\375D\353O\244\376\304\351O\204\371\2115\374\304\031\376\277\374\304\226\237\350\302Od\341'F\340'&\340'\"\340'\216\370\211\037\374D\016~b"
+	.string	"\376\263\360\023?\374\304\n~\242\363'6\177\342\362'*\177\"\362\317x\177F\373\363\223?\237\375\371\352\317f\177.\3733\326\237o\376l\363g\232?\237\340\317&\3703\t\376,\202?[\377\f\363\347\023\377c\370\263\007\376|\302\237\037\360g\020\376\314\341\317)\177\376\337\036\376\255\337\337\362\375\355\336\337\342\375-\223\277\035\362\267B\376\366\353os\3766\376\333\022\374\255\r\177\033\363\267&\376\266\304\337F\377\326\345o_\370[\027\376V\001\177+\302\337\222\370[\017\377\013\377\266\303\337R\360\267\315\277]\376\255\362?\326\337\226\375O\362_zxxx\370/@\346\007a\200\237\254IDLn\336\262~\001\332\366o\304i\261F\034\243\316\336\311\002\252:\022\270u\264\0030k\243\316o\3141\252\330@\362\236\003\024\232\221\365\262"
+	.string	"@\366o\2641\332\300O\216BX\366\365\334H\313\372\005X\332\277\221\306H\023\200/\031\036oK\262~\001Z\034\036\302z\314\025:m\021\237\034^\0269\343\bg\020\257\260\020\036\324\304\233\270F\314,\216\2138XJ\r\3519\312\372\004"
+	.string	"\333?\034\005\013G\201\007\267\315M\\\223\024\302\325\333\235U\276\212r\b\004\017\276@3\350\251\210\242\313\372\004\230\261\177\030\020\006\202\0035\215\224\032V\326\271\350\217\3450`\361k\257-\316Z"
+	.string	"{-\026\336\203\373tMWLc\234\201F\303\207\213t\030\377\361\301P\266U\333\345\324\227u\361\332\256\274\017l\235\357\t"
+	.string	"\264\1778\017\013\347\301z#<1\325P5 \013y\207\225\347\006\353}\363h\2318\2140&cG\326\327@o\377\260\223\026\013;\201\237\214P\304\024\013\201\250\242\321\302\202\363v\260\220<\371a;\370nO\335\230\312\223\221\265\213\244u\276\327\240\310\206\353~\030\fnB\0040jG\3269\252]y\3419\226\303tm:j\226\262&@\353|a&?\034\007\313\031\275\212\340v\262&\232\265+\357\002Z\347\013\277\261\034\206\313\342\b\001f\255"
+	.ascii	"%m\260\033\334\n%\030Y\353\250v\345=\266u"
+	.string	"\276p\022\226\303Jzv<\251\311\372_k\207\221\374[\017fsm\270 \003\314\272\255b9\274\366\204\303GY\326\260\332\257\377\340#9Z\330\020\313\2725kW\336-\307r8\255\354j\211\214\"p\021\030M\3230\257\261\323RT\034\303\340@\031\243\b\223\034m\341\361\n\211\016[\326\327\200k\377p\331[,\\\006\233\035 \315\354\316\352H\204l\355NN\320\306\215\254\257\201\324\376\341!-\026\036\002\023\t\201*n\252(\260H\267u\230D\344\235\312LyYsfY_\003\027\373\207\303\212G`\261\"^\\*\262\316V\355\312\013\203\261\034\016s\265|l\275\310\272"
+	.string	"\260\020\370+m\307\037\230\027\026\366\202\277\204d\365\216\364\220!\217X\021\240)$Y_\003\232\r\007\371\267\035\334\325\022\316\200d\206ZO\326-S\273\362\3025,\207\271\306\222\024\356\310\372pV\013oa\341-8\253C\\\023t\200\275\030vV\201\361\217\013\016>\200\272\rg\355\234\001\310m\220s\214T=)L\202\365\271\025\311\272\305\302@\340\253\021\300\230\342\240\006lu\331E\031{@\005.\021\2715E\311\372\003(\333?\354\343\360\217\037\256\202\255\270\226\020\376\310\272\215jW^\nZ\347\273\237\260\034\366\221\244\203\246(k\270G\346A*\322\313z\377\261\034\346\261\003,I\0228\3520\325\017K\301S8\201\331\303\254\263N\273\362f\320:_\242\016\313\341(.%h7\360\016X\007[\266g/k8G\030\016\231Z\326\037\300u\377\360\215\026\013\343p\257\212\\_"
+	.ascii	"\375\207]\247\277'O-\026~\202\241\364\r\363\032;\345E\305q\021"
+	.ascii	"\007I\277\033QgY\303P\23203"
+	.string	")\231\013R\222\365\007\360\264\177xF\213\205g\3004F(b\212\203B\370\021\307\031\"o|\272\266\262\206i\27043<y!)\313\372\003X\261\177\336\260t<e\r3\3011Z\354\223\300M\277.\225ET\204%\311\372\003\260\331o\237\344=A\373$0\016/\375p\022\254TG5\203+k=\326:_\030\211\3450\f&<r\334\310\372b\255\363\205o\340\263\201$\353\013 \020\206_\374\304\260V+\t\233\334`\326\032\215\3450\321\341!\032T\326?\034$\004\273x\207\342\376\002\263\316L\355\312\253\001\020\313\341 \025:Q~\262\036\200\317\341\237\023\t\233\3209e\r\367\260\034\366Y\253\221\315\372\202\326\371\302-~\230\005\314\003\343\251p)\353\234mW^\021\255\363\205wX\016\257HR\331\261\360\312\272\203\234\303:\377\246\203U\034w\342\002]d\335\276\265+/\214\303r8\247h#F\326\215\254\001"
+	.ascii	"\323\034\276\371\341\032\330\246%\034\212\233r\262n\213\332\225"
+	.ascii	"\327\331:_8f9L\003\207E\241\241\226uJ\353|\367aK8\003\007\024"
+	.ascii	"76\207Yo\303\267\2043\034\356\350\343\311\372\355\301\362]x\343"
+	.ascii	"BLG\326\233\360\337Q\366\240`\017#UYg\260v\3455@\353|\365\023"
+	.ascii	"\313\267\240\2172&Uy\007\266\204o\f\256\034i~\373\257\345\022"
+	.ascii	"\301a!`\326\311\326\371f6\226o?\267#\331-(\337}G\316\221\361"
+	.ascii	"=eML\302\362\r%g\321\320\261\221\365\346\003S\026\346`\261$\373"
+	.ascii	"\2757\344M\017(\353\255\307\362\235e\362Q\345\2245\207\273\357"
+	.ascii	"\274\177?\331x\330\257\032&Y\267O\355\312\273\322:\337m\307\362"
+	.ascii	"}\267\r\217\364@e\255\322\344\333\311\277a\354\272\226p\206\243"
+	.ascii	"\272\236\030Y\267u\355\312\273\351X\276"
+	.string	"\233\270>\210\214rd\375!n\313m&-\341\f56ld\335\202\265+\257\207\326\371\346'\226\3578\264\240.\265\254\013\001\341|\202\226\274\305\356%\273M\323t\3054\307;3\275\243\3008.\342\200\b\246\302\354,\353\013\200\311\376\267\333n\303\323K\002\314z+\201R\323Q\222\365\005\220\266\377\275\366\235\344\337l\033IK8\003\035\241\217\243\254\363Z\273\362r\320:\337\255\306\362\275\246\233r\206Te\035\342\310w\332\r\036\177\330\254wZ\361\253E\241\213\2547\032\262I\005\240a\326\373l\027\371\017'\017\243\034z\025i\237\254\310\352+\333b{\354{\310\367\220]\266\3438\246\271\306>%\220\262\263\262\212\213~@\374\233\354\273,y\330\225\247\227\365&b\274\263qt\225\365\375Z\302\377p\316Sr\304)\353\013\200\310\376\337>\377o\\\363\023\307q\220{\215\177l\220\357\337\276u\333\026\304\237l\211\255"
+	.string	"\376\3538fY\233!\216\213\232d\3438n\3736UY\r\022\006\361\377\203\210c\2326\216\343\037\035\257&\232\246\216WM\254\363\365\006\324\324\361j\002\322\271\30618\304^2b\235+\023\215f\242\211\343\230&\307\327\370\246\t(\276a\242\221\321\271\306?\361\225\211\206\031\337"
+	.ascii	"1u\25654:^M@\255\216\027\023\220\216\027\023P3\276\211i\342\233"
+	.ascii	"\232\030\373\206\tHG\t\023\020S\307\253\006H\347\246\t\250\275"
+	.ascii	"2\305-\034\332\265\211&'\366\252I\306q\314s\215\242A\306q\315"
+	.ascii	"OL\023\227[\304M\331\026\261R\334\276\375\270\312\210\343\230"
+	.ascii	"\006\254\316\211\t\276\332\304o:<\230N\344\304q]\334\"\004\232"
+	.ascii	"\226\346\032\307\261\212\330\206\246\215\343\234\353O\034\333"
+	.ascii	"0\315P\024\307q\314\3242Q\361\023'\343\233\032\036\033'&d\216"
+	.ascii	"\r\223\212\230G\2146\216\343\030H\307\313\211\211\345\f\353\025"
+	.ascii	"\025\333\\iZ\035\036\2468*\256k\372\331^4-"
+	.string	"\224\244\327\215\"\236\035v7\242\241T\217\030\033\254%\234\201\254\355\213F\326[\310[\302\031`L\311\230\221\365\273\203\345\033\353\032%\211q\343K\207\371\3319\251\310\332\315\341t\b\230\257\313\243\231R\230\213\254\257^q|]\252\024U\365p\351\025z7;r\256\337[\207iY\244\275e\230\006\247\265\263\234@\261Q\312\372\3777\326\f??8^[\034\304N\210\366\325\006\222\317^89\321IWj?\266\325{68\346\263,\312\202\333\261\253\266\017\342\214\031+l\266\217\247e\344\033\024\032=x\364@!\321\313\032Ok\311I\016\325\2362\326\220\221\006V\202\032YzRPTX%/\262~;&\203E\024\215\ft\030\205\345\324\"\206Q\326\214\235\r\265k\024f\241vS\006Jz\225x\250\\\004\346\3306\266\216\035\265q\354\035\373F\213\335P\373\351o\216\214\366|%\376m\025\3112\365\005@\264/"
+	.ascii	"\240}\001\260\330\027\200\212}\001\320\354g \270\237\301\336"
+	.ascii	"~\006v\373\337LK2}YvI\337K?\261f+\265\2043\340\035i\331\310\272"
+	.ascii	"\315\266+\357\206\301\362\235\364\203&IG\326\026\264\316\367"
+	.ascii	"\337H\373\210\255\307\225\323\213]\264\215ZC$\223\237T\022(Y"
+	.ascii	"\303q\273\362\266?\255\363\3155,\337/\224@?\276\3046\321\026"
+	.ascii	"\312\016\ti\221\365\026z\tw\213\232%/\340\026z\243\324m\240\035"
+	.ascii	"\264]\354\241\026\273\205v\317\267\317\376y\001\267\320\033\370"
+	.ascii	"\n\266o`q\f\324A\021\036\035J\032\310\026z\377\b`\204G\207\222"
+	.ascii	"\002r\232x\031\365\326i\235\3573\340\332\233\007\331\003n\t0"
+	.ascii	"\353g`\265\335\0327\305\240\017;\201\205-\341Q\361'&+\242\005"
+	.ascii	"\331\261s\212DE/\021r~$\340\364#\353\326\3309E\241\242\213\017"
+	.ascii	"8q\\\223\364\376\361\3300\022\270i\366\212\215\263m\366\315f"
+	.ascii	"\261U\354x\353\024\017\367\316\256i\261;\247\210\375"
+	.ascii	"\013\370\016\032\032\362\3300\022\250\267s\212q\321\346\303N"
+	.ascii	"\0347\341x\243\360\3300\0228\266s\336CM\364\301&\216\225\214"
+	.ascii	"^\302\353\316)\032)\022\326\344x\221\360\3300\022\350\352\025"
+	.ascii	"\026\r?\330\3041SR1\210\307\206\221\300\032;\2478\004d\347\024"
+	.ascii	"\277\212D\200\274Y\036\033F\002\211c\2041|TP4\274\306q\314\241"
+	.ascii	"\211\344g)"
+	.string	"\353g\300b\027\007=,e\324\250\231\313\372\030\f\356\264\342\032\361\032\225\202MO\026\260\030\245\030\330b\213\2027E\301\"[\021O\204\234\037\027l\212\202\305\277+\201\361.\361\320\210\n\324\330'\266\245\255\217\301u?_\315yh\337\236F\230\032\313\332\2010\373\201WDRd\362\301F\207\002kC\232<\r,\312\t\220\214\244\016D\373\006v\202\031V\021\257x\3674\035V\331\"^\221\316\003\001\206x\232\200\004B)\372\025\363\212|\305lq\257\330W\324k\261E\274\342\223\353'\355b\277\002\007S\364/\030\334\277\240o\377\202'\373\0270\331\277 \311\376\005F\366/\030\262\177A\227\\\207L\243\027\347\223\365/\220\332oE\270\026[\214+*IRt\303\213\212\343k1\256\270\244\350\226\202w\007\350\026H$\273\353\373z\365\003\220\335\177\321\255\355h\230\225d\330VT\242\324\332\301##\353\007`m?"
+	.ascii	"g\373\001\020\333\017@\220\375\027\325^\\s\303v\222\250\310\272"
+	.ascii	"x\204\345E5\234'\236\240\2547h\235\357\003\200\265\037\200\252"
+	.ascii	"\263b\021\263\235c\016\206\221\246\263\242\031X\\W,{\321\354"
+	.ascii	"\265\2439\022\005\2518D\214\220\350lG\326\017@\316~\213-\216"
+	.ascii	"\025\305\210\360\330\031\022\366\242\030\0212\212\0227\027Y\337"
+	.ascii	"\257\b\366\037V\322i\225\241e\375\027\301\204([\304\305MB\212"
+	.ascii	"X\370\257\256\360*\353[P\270"
+	.string	"o\301_\220\273\254\027\330\254o\201\335\265\310\325b\213]E\244\256\342\213\342Q\373\006v\202VXW\021FQ+\317.\033\307q\207\020!Z\354\021C\276W\357(^\261Ee\025\261\212[-\266\250\365\242V1\2518CI\323\214c\032N\242\264\2124\2129\33270\025|\264e\3438\016\341!D\210#\317\214$\232\255\177\024\201\264\330\342U\321\212\252X\365\301FG\205\276!W\305\250\342\324\007\033\035\025\214\254e7\232\r#P\257\276\005n\373/V\025}\354\224Q5\341Q\354a\034*z3\222\365-(\262y\274\355\221\302I\222\365-\b\333o\261\307+J=\357\206\022\242\254\254o\201\327\276\005Y\373\026\374\310Q\254Q\264\321\276\201\235\340\226$\033\3071\216\242\216\026[\314Q\274\001V\314\341\036A\242$\253\334Au\225\365\352[\220c\353\252\033!m\271\bU|J\346%\245\361\310\372\0268\355["
+	.string	"c\337\202\242\375\277\350T\224\321b\2133\212M\035@(\316(*\025c|\260\321YAiI\2668\303=r\314a\323\204PF\221-\033\257\376\007\274\375\027c\024\231\214t\210\020\272jELr\024\227\212HG\273\025q^\326\377@\267\377\241m\377\203\221\375\017`\273\250h$\244I\313*\353\177\320*\372\340c\377\303\324\376\207\033\273\350\342\271\250-\006\031\341*\222\365?\310\330@BIBt\262\376\007\237}\020p\212:5\236\262\305\236\342O\213-\372\024w\300\212>\305\025\305\026B\032\370\tm\035%\305\002\007\211^\315\242\310\263d\221C\305\2153\026\330}"
+	.string	"H\345\024U\344\240/\033"
+	.string	"\230\221\003"
+	.string	"\245}"
+	.ascii	"\260(\326\264r\177Qv\262~\005\204E\232\n\240\354W\340d\277\002"
+	.ascii	"%\373\025\224\355W0\266\213\025Tm\301\227\345\274dO)0\353W\020"
+	.ascii	"\265\237m\235\357+ \332\377\353\327\267\263\264\242d\365\235"
+	.ascii	"\350\207T:\275`*\203\302g7\203\f'\353\227\357\327B2V\006j\203"
+	.ascii	"\324\232vd\335\212\261\374\335\3232\376|\246\262zWtv[z\255!\222"
+	.ascii	"\351jHEM\336\2137\004t\004\251\203[x(\345\367\344\275\363zr%"
+	.ascii	"$k;$\205.\212\262~\005?\373\377\333\344\245{\353Z\354\353\344"
+	.ascii	"e\"\327>\331\021\025\307^\007\341u\362\316\265O\332\267\242\006"
+	.ascii	"\034\371\321b\275N\336\270\326\320X\303f\207Y\362\315\350\ni"
+	.ascii	"\353{`\262\357\301m\337\303\332\276\007\263\375\277pG\336\226"
+	.ascii	"\250%\251z\221\265\233\366\351\353\301\313\372\036|\354\203p"
+	.ascii	"\366\242%\211z\221\274lo\222\267\255\305\276J^#,J\210lJ^%o\332"
+	.ascii	"\273\346\226UB4#\256\265oEqM\315\007WgUG\212.\356\336\206\030"
+	.ascii	"\365\221W-\023.i\"\225\365=\330\330G<0\355{\310\331eo\021\230"
+	.ascii	"\351(HM\326\357`\270\337\001p\377\257YY\331K\366\022\231z\033"
+	.ascii	"\353\313\372%\362\277c\357\220\226p\206\345\017\023=\034Y3\343"
+	.ascii	"v\345\315q\353|\3370\226\277b+VH\365e\335\036\202\275BVX\021"
+	.ascii	":e\215-\362#F#\353w\310\333\007\001+)\233\241\256r\221\322\215"
+	.ascii	"c&\245\353\353\365r\275[o\220\367\253\305\276]o\326\315\325\217"
+	.ascii	"\\\364\224\325\262\262\361v\275@rQ\373\366\024k\033(4|X%\311"
+	.ascii	"\322\224l\224\372\035\270\366;X\355w\360\261\337\201\307~\207"
+	.ascii	"\250\375\0168\366\377Z\025\231\334\3410\253z}p\351\374\211\361"
+	.ascii	"\350\321\206\265\2043\330\030\022Z\2225\334:\337\366\212\345"
+	.ascii	"/\217\245\\\231\237\016\252)\230\016\317\205\n\235\006E\210\240"
+	.ascii	"\324\033\305\345#\304C\307\216\\d\004\017T\215\254\217\255\363"
+	.ascii	"}s\260\374\325\2413\b$k\343\213\343\275\301c\314\317G\3266\256"
+	.ascii	"C\212\240e[d\375\016K\373 4\025E\321xg\2745^\250\026\373>\275"
+	.ascii	"Nz,\206Q\224\214\227)o\2301\013\033\244(\254\367\351ezY\373\006"
+	.ascii	"\026\343p\035\200\252i\252(0\216\343\334v\344\306c\324\357\200"
+	.ascii	"\264\337\241g\277\003\316~\207x\237C\224\375\277KJ\035\240\345"
+	.ascii	"\240\361*\225e\246\370h\b\215$\030U\\2r\364r\226\236\241d\267"
+	.ascii	"\364\"\275Gn:6\332\262~\217^\243\354\002\250F\030\321_\243\277"
+	.ascii	"Eb\200i\205\357\213\244\215&K\220\262>\207\270\335n\261\374%"
+	.ascii	"2;\222C\230\365\b\226\277CVFb\b\276.^\241W(\350\005\"\366\350"
+	.ascii	"\341\263;\342\314\360\212\373q\017\343w\205R6\355\365y{2\331"
+	.ascii	"\017\253\253\267'\253\345w\316\354\246-\353\377m\361\362\370"
+	.ascii	"\345\020\222$k\026\313\032\247\033\251\254\317\001m\357\270|"
+	.ascii	"o\r\221\353\247\005\033\275W\305\253\363\256h\261\357\316k\363"
+	.ascii	"\367\346\305\321{w\334l\240\253\367\356\2749\202F;\271(4\266"
+	.ascii	">\207\256\3752\265+\357\231\264\316\367\034\250\366[\363\273"
+	.ascii	"z\356\336K\223\t0\243\0200\3537~\331~\262M\262>\007\246\375\337"
+	.ascii	"-t\t\335(\256\240k\350\016\266X\367\320\005<\\\222\r\274\213"
+	.ascii	"\202b\347\036\272\177n\331\260>\367\320\365\313\252\261\213Z"
+	.ascii	"\322\001\202\261)\3659\350\354S\340\267OA\335>\005G\366)\360"
+	.ascii	"\332\247 \307>\0051\366K\001\213\375\267<!:\r\bo\017\357\211"
+	.ascii	"\222=\257\276\254\357\212,\214\306\300\262\376\212\341~\213\205"
+	.ascii	"\346\032\251K\313A\037ltT\300Z\322v\265`\355\333\323\b>\224d"
+	.ascii	"\331\\\270\366\255\210\031\337\220=\311\316\271Gr\220\222\246"
+	.ascii	"\031\3072\334\242\232\270v\256\023\227\316e\342\326\265Xw\316"
+	.ascii	"]\273~\322\356\234\2536\002V[\366H\347\267\343M"
+	.string	"\251\321\264\354\340\\$\356[\373Vt\215\203\216D\246\364x\004\272q\256\\\213u\341:xH\016:\t\324z\365\357\276\271K\314V \251\310\332uk\275\222\260\220\221\365W\334\366\357*i\261n\233\212\251B\035Y\273IV\222\354\257\244\355\257\200\355\257\004\331_\271\332_1\222\203\274\220\364\271e\375\225\251\375\273EV\020\005\277`P\235%\271A\220"
+	.ascii	"\2511s\313\004\261\342\326\262&;\216\371\371\330\310\372+L\373"
+	.ascii	"\031\t\223\033f3$\353\022q\307\\\261\026\353\016q\261\317H\304"
+	.ascii	"\261!C\\-\227\213\310\365\263\311\202\214e\335!n\227\373u\200"
+	.ascii	"\037MvQ\201\313\034%\330\276\255]\260\326K\b\324`\326W\331s\205"
+	.ascii	"\304\311\343\f3\260\232\254\257\262d\377\356\227\353\265\326"
+	.ascii	"\223\344\006\220\370h\314\b[\020\227\006Ri\206\212\221\275\345"
+	.ascii	"^\225\177,\374\324\262\276\312\326\226\212\217\375\273YX\312"
+	.ascii	"$PVFXW\023h\242\242-k \020H2\225\227\365U\2406\221N6\216\257"
+	.ascii	"9.\217\b9?\260O\220\242\354\330\017O\224O\213(\267EOV\033+*\034"
+	.ascii	"\3321ra\264o`'\034\031|\221\325\3327\260\023\260\016]\035.\223"
+	.ascii	" K\fw\306\007\033\235\025\212\364\334\034\256\225\333\303\365"
+	.ascii	"\341V\2718\334\033.\225\373\303\225ry\270S\256\r7\312\335\321"
+	.ascii	"b]\035.\215\2735\334'\335\003\352x\"\344\374\3009rFn\013\027"
+	.ascii	"\210EV\207\033\344\272\020!\347\007f!\267\"\313\342\352 \322"
+	.ascii	"\271KF\237\2468+$\335U\332\n\f\364\235\205\3335k\235\357\235"
+	.ascii	"\331\375\2733d\200q=\261\213\247\232\224\355h\261\256\223\333"
+	.ascii	"t\215;\274ZrOH\262\276s\311\276sm\337Id'\271JK\300\026}t]I.R"
+	.ascii	"\214\344\021\344\243#\353;y\270GN\034\373N\247}'\321\276sg\337"
+	.ascii	"\031\357\337u\341\nE\355\350\302\313oK\244\341\225\\\214\254"
+	.ascii	"\237\002\270\237b\267\237\322\266\237b\266\237\022d\177\320:"
+	.ascii	"_\227\005\016\032\332S\326O\261\261\337b]\367\215\313\212\261"
+	.ascii	"\256\316\335e\01628\031Y\273*r\316!\231\222\264\254\357wT\263"
+	.ascii	"\341\344\226\365S\226\366\357\342\020\327\006\317X\334\270\261"
+	.ascii	"\331*RC*k\327\346\271\250e\272\371y\001\303\255qivY\315\333\020"
+	.ascii	"\242\036\221\017\0377\316GI$l\323\223CC\247\272xF\326\332\360"
+	.ascii	"i\031\031g\310c.\027\022f\211\230\354\271i_G9y0\312\233u\004"
+	.ascii	"\367\007\030\250\005[C\344\266b\"R\225u\362\332\256\274\355Z"
+	.ascii	"\353|\365\037\3135 \022J\235\327\217\254+\360\353[\312\030\364"
+	.ascii	"Y\202\242\371Z\254\356\323{z\232H\203\252\240\251\"\335\247\263"
+	.ascii	"5SE\305\253\272\0366^\375\346\337~\363\311~sm\377:O\343%\213"
+	.ascii	"tl\260\351;\375D\333\265X\215w\030N\242\2144\222]T\034_5\236"
+	.ascii	"N\322HDh\376\212\204\330w:\356\340\266\376\265\223\3539\033&"
+	.ascii	" \203Y\037\204\270\273\254\236\323oA\360\262pO\230\350&"
+	.string	"\232N\327\265X=\247\345\262\236\323K\034\020w\303\320\035C\212{\214\372M\252\375f\214\375f\316>sn\237\311\265\177\355\246\323~v\f\253\262>\bgbWckD\310\260\206\224e\221\021\211\272\226\r\311\3524\215\325a\355[\221\346\201\304,\003)\211q\2544\246\246\215h%\032\211N\242\331\364\232>\242\333Z\254N\323E\256\321\210>ou\232\026\313@\305\033?zGD$.\202\034\252he\353|\317\234\332g6\3553\177\366\2318\373K\277\375\345\222\375\345\331\376\022\310\376\362\306\3765\330u\330o^\235\233&\036Yk!,\327`\304:\240\263\241\254]\244\257.$T\232\335X\326o\307\256\204Qq|\325]\232+\253)\3418n\032\214\362\322AZ\254\356\002+tS\233{\365\227D\373\313\236\375\353-\215u\303\351P.\353\203\360\353\036U\332J\t\307q\215^\224\306\322?\264U\373\006\026w"
+	.ascii	"\367W\304Jk\351\254\026\253\261~\rD_%i\002\215d\274z\307\355"
+	.ascii	"\312\333\306\255\363\375RL\367\320>\262ZN\256\311\261\360\311"
+	.ascii	"\372J([_5\2170&E\262\2626\322H\355\033X\\\003$\002\025\b5h\376"
+	.ascii	"\212\004*\351&\"\327\317\026sj\221\225!%\365W$\220J\343\3209"
+	.ascii	"\264\224\266\241\243\364\r\255CO\265X\275\343\327O\032j\207\246"
+	.ascii	"\021\3274\201\220\002\372"
+	.string	"+\022\030\307\327$\215\244\274a\3067N=04\222OF\322;\364\fM\264\"J\357\320N\272\211\205\353\257\210U\034\307\035\222mMV8Tt\276\266+/\210\326\371^\t\266\257\304\332WN\355+\235\366\225C[/i\246\026\3734\035#^.\325\374\226\314\262\276rg\243\210\3438n\237\366\026\237\366>)\270\237\254\333O\246\351#d\r\021\031\\\326O\016\331OV\355_\027i\242\253#N`Yk\242\254\207\364\213k\"\355\342#H\034y\023c\305\361U\023\3518\256i\333\f\224m\233\201\233\226\243&\310\253\237\224\332\277\026\322A\333,\347iP\007\375\272F\333h \020\020\336\210\312Z\377l\0306l\260Y?\371\264\017\302Mk\b4\003P/#\251\320+\212q\\\334\376\354\001\nfu\217\366\321<\232E\213\325-~\242\216\316y\007,\215\323\032~\260\321Y\0010/J\267\270J\305\261\f\250"
+	.string	"\024r\331Y\005\306\3615/Y=\3313\352_\257\320;\232\212\005\026N\353\\\357\354\037\202XcY\337/\037\375\207\221\201`\330!Y?\251b\347\270]y\217\034\334G\376\355\007\304\355\312[|\363\353\273\332=\335"
+	.ascii	"\314\372\327\361\241\\\031\\W\326\207\206H\246\237\257\263(\301"
+	.ascii	"\254\013\211894[Y\037)\027\2058\330b\211\204\304\300w\270\022"
+	.ascii	"\022\001\211~\"\344\374\300=NVYB\242`\373\304(\367C\205U`\bx"
+	.ascii	"(\211\214\305\253\217\\\333G~\355#\265\366O\374#\372\031\305"
+	.ascii	"\332\342-?b\037]\226\220H\326\327c\221\016\021-(9\347}\20138"
+	.ascii	"\306\267w\024c\306\212\354\211{^dO6\262Y\023\365XN\3146\340\206"
+	.ascii	"\f Y\023\363\360\214Vo5P\262~rM\356\310\372<e}\244\f;\242\223"
+	.ascii	"\026K\274#6\251KrG\244\273b\272\263Z\306\230\232\033z\365\221"
+	.ascii	"K\373H\234}d\274\177\342\034\221\211\321\216\021\035Y\313\351"
+	.ascii	"\260\244\233\"Y\377\230\267O\202\270\204hF\\#^\2436\013\033%"
+	.ascii	"6\271$%r9\336\210n\3046b\034\021\256\305\022\227\020\221\234"
+	.ascii	"\230$_\215\221e 9\033,\304%\3042\022@ZXVq|E~\335\341$!\365\217"
+	.ascii	"Z\373m\235\357\2178\366\2170\324\210\272\366\210\262\376\261"
+	.ascii	"\305\376OL#\032i\261\304#\304\"W4\2712\342\021\342\331\017\270"
+	.ascii	"\252#\201q|\355\020\"\204\033\304J\350\360\3257\336\355\033\225"
+	.ascii	"\354\033\213\354\033\207\354\033\177\354\033\235\366O$B\034B"
+	.ascii	"GC\313M\354\304!\177F\"\216\265\2043\304\361\220%\027HqY\267"
+	.ascii	"q\273\362\022\303XN\024{\r\005Y\200e\275\004#\n\251\0234\372"
+	.ascii	"\311\372\377\211B\bg\370\331ot7\244\260\304/*\267&@\262\366r"
+	.ascii	"\213\242n\f\263\276\261h\277\305\022\31298>H\210ZD%\303,Q\207"
+	.ascii	"\305\234R\222\334!Q\247\005\214(b\016\"\020\242\025\221\213X"
+	.ascii	"E\334\"\376 N\021\243\210X\304 \304|F\322x\310\002"
+	.ascii	"\263\276\nkgg\3146\247\0335m\205PY_\005\257\262\262\267\310\220"
+	.ascii	"\023\f+8I\314\350,\353\253\340\202\b\221\346\321_\017\235\226"
+	.ascii	"U\037\237VT\326WAgl\254y\364#*\031\345\002F]\326\217\300`3\254"
+	.ascii	"\031\326<\222qa\310\327\201\212\030YbXlSH\333\025\373\240p1\250"
+	.ascii	"d\365\3068\024:\023r\203+'F\326\217\200P\323\253\351\3254@\240"
+	.ascii	"\013\300#(\340\300\326\262~\nH\232\327\346\265\331\325\201\211"
+	.ascii	"f/\004(R\177E\262\222\022\272&M\2567\273t\223\222\234\016,\016"
+	.ascii	"\2077Td\375\024\302\232Y\315\254\246\226\2167\250\207N+\220g"
+	.ascii	"\310\b\017-c\214<\267%H\262~\nT\315\036o\376h\366h^i8\030 \364"
+	.ascii	"\017&#\243&\2207\257\202\230\274\342\254\357\007b\005\366\317"
+	.ascii	"&\353\246U\261\311\\\222\256\254\233U.\222\320\035\017\037?\214"
+	.ascii	"|R\342\306\227\365S\310\261\237\302RSGSG\223jI\220\036\217W\254"
+	.ascii	"\352\r\312\2167\251\246\364\022\214\244\247)\251\343\016\024"
+	.ascii	"_\366\356o\315\n\255\031\345\256\371\t\271[j\301\242l\r]e\375"
+	.ascii	"\024\212p\340`\266\035Em\225\3211e}\024\376\2326\2326\244\314"
+	.ascii	"\364\216\356\216\354,Q\342t\247\346S\333\025\373\024\205\310"
+	.ascii	"\3550\013D\216\005\366\240i\312x\363\251Y\303\r\033\334\243\252"
+	.ascii	"\361&\215\240@\026=\354r\244|j4g\274L\21251\006\355\262\276\337"
+	.ascii	"\213f\2057g\224\365"
+	.string	"Q \322Tz3FS\211y\250\233\372\220C\361WX\326M\246\346\322\027\f\030F\266\255\"SE:\210\224\221\34102j\036}\320\306*\260Ax\210:\360\210\024i\036\251\331U\275\355`z\361\2429\3242\2576r+\242\316x\254\250\311\372(\b5\205\232B\315!\251\037(>\332$v~=.\336\034\222\333\242\253CA\247\231\363\346N3\247\t\264\324y\201~\330\3710\302\363&\320\233?#H<mH]\324S\326M\237fO\263E\223\305\365\220H\316\002\221\262n\256h\3524U\240@\323\244i\3224o:0\321\374\031\377\\4\261\nDB\rI\342\321\264y\363&\317\t\316\216P\326\367k\326\320\331\r\2765k\334 8Q\220x\251E9\2630\n\363P\327\030!\346Q!tAG\344D\004$hx\346!\322\f\240\033&!s\360\n\n\024f`\333\025\373\264\304wVV\311\273\025kD"
+	.string	"\317\f\fD\032\002%k\346_k\b\007\006.!\302\364+f\t\001\322\304\364c\366\021\213\230\230M\351\250\264\252\266\254\177\302\r\346\023\346\023\346\336V\315TQ\340\321\2540\266\221=s/\217\t\206\237`\326L\275\247\351\371h!\226\367\037v\372\250\322a\3461\361\212GTJ\364hd\260H\222\365OP\252\253c\332]E\265XJAN\316\264\243\3233J:\201\311\224cZ]P\001\261\"z\371\320\343\232;\223\356\210\250\004,\3470k&\223\227\305\310\006\035\235"
+	.ascii	"\264d\t\023\356\254\353H\244\2150\n\363\355L\270\227\261\261"
+	.ascii	"\225\345\310\331\242*\242\021E\211\022f[\007&\232=\r\262\246"
+	.ascii	"\246\212\002\337\252\244#kmN\200\254\262\262\276\tO\230k\314"
+	.ascii	"5&\022-\037;,\036:\036?\2663\221\244\275>I\354\262\340\320\316"
+	.ascii	"<\202\266d\"\3721c\2338\216jc\025B"
+	.string	"p\266\262]w=\274\262f\2461\215\230\300&\344\3140!\314\263\345Z\007\343\231O\224\276\300$ Z6\2109\344\314\2633\315\266~\364\001e\315,##2\226\217\\\270%\247\233\254\231b`g^^\314\257\226y\265\261;\214y\246\234\262f~\365\260\313\222\272\272^\231]@\f\335\030uP\246\270\316\354\232\273\201\345\244\245edk\231W\233'zY\354\340\021\037Y\337\204! @\230X\035v\214\205E\230=\362\341\355\350qu&\026\323\207\223.\031:\205L*&\025\323\312\203\022\027UG\371\b\212\233\rf\325\231V\2069{cY\337\217\351\343?\374\201\335\r\035<\230=\362\013\026SAY\277\2045\036%\234\345\310\301\224\372@\350\202\n\210\007\034\300\272\2503\245B\310\002r#k\346\216\2479\005\301\210\312\232\251#\037\225\371\210*|\272q\303\310\326\201\211\250\367\246w\2044\242\343#)\353\227"
+	.string	"\003\n*)\330v\305>\032\b\262\213\262:\372Z\202\375\253Q\243\002MSEV\\q?\262Y\237\2049\346\f\346\f#\333\222\255DPg*\353\223@\304\311\311\310\346\001\313\305\r\263\326\006\taU\326'A\006\214\303`\306\350\300D\303\027\002Z\215]T\240\306\353\332\363c&\235\031\203\311\024%#P\005\223\211\271\244d\b\213\2717F\3160d\323c*\271\200"
+	.ascii	"\300\323!B\202\316\320\020\363\250\003\023\315\336\007lS/\221"
+	.ascii	">\252(\2423\217\230FCh\020\036e\315,:\342\3358\233\221\365G("
+	.ascii	"d\276\310j\257\233\017a\024'L &\020SH\345,.\033\221\335\330\005"
+	.ascii	"\235)\344\305$\007\r\032\023\347L\025\177\213e\3420}\210r\310"
+	.ascii	"\230\246+\366i\253\224,\364\232fd\3753W\234\351sf\317\b\022\307"
+	.ascii	"\213\241\201\305f\315l\301\303d\301\334iQ\244GR\326L\235\353"
+	.ascii	"%\207p=\301`\346\2140D\360KBA\246\315\362\211\022\005\205>Q\372"
+	.ascii	"\226J\202\312\222\f\317\2649\263f\004\211|t\004\352\243\022\313"
+	.ascii	"\232I\303\214\227\207\313\302\326\360\b\365\205V4\030e\204\257"
+	.ascii	"%\337\222o\t\370A\033\253\030\303\201\312\236u\345d\241|\t\270"
+	.ascii	"\374\343\323\212\262d\371\267\364\36322\f#\213\263\2207#\243"
+	.ascii	"e\237\213\035B\246\004\244\211C\263cF]\3352\333\201\211f\257"
+	.ascii	"\001iqD\255?47\275/\263\356\027l\343\007O\217\254\227ynX\021"
+	.ascii	"P\306\022\252\254\227x.\327\361K\006\031U\326\313'.\017\224\035"
+	.ascii	"\020\235\254\227w\307\32372\244\222d\275\264\313jK,\245\"lY/"
+	.ascii	"\235\270K\355\240\031\335\216\013\203\210\205\232\323\312\372"
+	.ascii	"#\020\311\375rK\272\266+\366\201@P\234\225U\034\027\201p\241"
+	.ascii	"\304~\230-\347\276\244\32348m\205Y/\231\270_w-\242\214\226\036"
+	.ascii	"\244f\006\224\365G\320Q\242d\t\227$\310.*\351\"\210\216\247\345"
+	.ascii	"\333\227p84\256JY/\227\270_;\236\312\262Y/\335\334/WG\233\336"
+	.ascii	"R\326\3136x\307\215\334\027\033\274\003\255\255\351\307\337\331"
+	.ascii	"\227hgK$D\272\366\032\0271\321\354)`\360\310\305\202\013\356"
+	.ascii	"\310\227H\276d\033A\342x\333\312\007]M\326\3135\265\264\343e"
+	.ascii	"\036x<{Y/\215<\rY\324$\260F\021\b\350-\211,\211,\313\320~\342"
+	.ascii	"\f\003\227d;W1\310\276,\033\374\023\353\321\346\365\245\020\257"
+	.ascii	"\345\330\3338\216\251|\fa yv\336~\200}9\366\245\330\b\022O\003"
+	.ascii	"\262\344F/\f\233\364\333\363\321\224\365\362\213\253\352\313"
+	.ascii	"\037U\313\256\266+\366\341\220\345\023\245\317\252\315\326\200"
+	.ascii	"\"\242\365e\327\227\\#H\344\243%!_Y\224\254\277\274\022\301\214"
+	.ascii	"\344\221e\275\334Z\2665<P^Y_D\341\323\020\241\254\227Y\260\214"
+	.ascii	"\033Hv|\262^^-\261\212ENvK\255a[h\254;R\001\bd\307\215\302\025"
+	.ascii	"\311\272\253A\237\254\227Vp\220\212\035fsN8fV8\276\334\201c\331"
+	.ascii	"c\031\245\264l+z\r\366\031I}\331\343K\036#H\344\243b\r&cZY/\251"
+	.ascii	"\246\226Q"
+	.string	"\255\341;\327\3256d\251#\207T\323\2273\232\2266\226`K\025,\361\211\322\227$r\364\203\211\306\2276\276\204\032A\002v\352Ik\372\313z\371teQ[\221l\326_\3260R\315\360\252\312\372\035\354.\" \240\245\f'\b\b\005}I\024\264dZ\016i\343\270(\266\271\211\225`\024\367|"
+	.string	"\377\002c\235\"\020F\"5^4F_2}\2714\202\304\323\222\236V\\e\275Tz\013\005\005\253\223\365\2270\226I?\fK=\031b\230\365\037"
+	.ascii	"e/\221:H\212\022\2030\353/\217\236\342r\364\310:\267O{\227E\255"
+	.ascii	"a\230\220)\243\254\227/ZC\242OM\336\036\354\344\346$g\223\365"
+	.ascii	"r\350J\255\264\034\271\254\227.Z\032=oqB?\214\334\303Ad#\353"
+	.ascii	"? o\377\001q\313\025\313\025\313\237\026Q\310/\254\026\317\322"
+	.ascii	"\347\313\037?&\272\245\236\377p\005E5\324zZ,\247\270l\030\261"
+	.ascii	"X\362\020\367\222\330\336\314Xl-i\2264K\235\236%Q\024?!K\025"
+	.ascii	"_\352\250\305M\305e\275\314\201\217\204\204\204<Y\342\2740\373"
+	.ascii	"\342\312\372_\342|y\323gv\227\365\322F\tVh\003ejYC#0Py\3302\257"
+	.ascii	"6M|\242\342\270\b\304\007\220\224\325\031^yH<\373k\022\226\265"
+	.ascii	"\262\020>:\222\203cAxT\262\371\233\"T\016\226\300\302\272\t*"
+	.ascii	"\243\274G\327\244\027Y\377\001.\004\037`\243\314*\263\312?(4"
+	.ascii	"\177E\002w\322\22137\277+\377\226eJhD\372\212:Q<w}P\224=Nr\370"
+	.ascii	"\354)\371\210\212\204`d}\007\360)\367\222\330]\371\304N\231\347"
+	.ascii	"j\021\211\260nH\360\256\314\263\343\243\261\311\372\307\035Z"
+	.ascii	"2\226d\255\274\003\213\273\222.NY\347f\305\261\315\007W\233\272"
+	.ascii	"X\247\bD\361\257\257\306\\\223+\353t|`\253\224L\256\234\373a"
+	.ascii	"\270\210\322\214\246\254\357\200\353\376\225r?\\\024\243C\212"
+	.ascii	"\312\372\016\270\332w\200\215#G\224o\035\230h\374\212F|\354\260"
+	.ascii	"\002\337'6;QI\256|\273r\311\b\022O[\n\371\201+\312\372J\2676"
+	.ascii	"G\352*F\326J%\312\266\235\343d\207\225\003t6\200\321\214\360"
+	.ascii	"\016\225H\216w\243\265\225\224\265rM\311fDs[\001\307\266\313"
+	.ascii	"\200\274\356\314"
+	.string	"\262V\252\025\026)\2424r\342M\254D\026e<\232\252yB\273\322\310\321\206\321\332T\326\367S\222)\211bs#\3537 o\213]Li\326\201\211\370\204\bR \274\305$\310\\\331\225f\\vjLY+\307\224dSM\260FdJ\"C47Tq\322\311\316\247G9$\327Pqc\210\253\001n;v(\3016\006>|\350\242\230\314|\350\224`J!x/\362\b\263\306\302`9QVY\277\001@\366I\360(\326\360a\2255\205E\365\347\023\027\030\030\225\255\300\264\224\\\312-e\020e\227\362K\211\245\364Rf\265X\345U\tDJ\023\265oE\r\230\332\272\312D\355[\220O\\`\240\362\352\306P\376\370`\243\263\202\322\016\345U\331\203\317'.00\216\257\373\006\332\227\217\212~\003\202\366\033p\263\177\345\017\253\034\031M5\312\262\236\233(\312*\245\017C\036q0\262>\003\262\373\f\270\333g"
+	.string	"\335>\003\340\366\031\240d\237\001F\366\031 \266\317"
+	.string	" \373W\346P\346\320D\232\346\032\373\250\234\325\3340d1\373\321\311\372\f\240\261\177\245\r\245\r\345\r}s\215\201j\370\2113\fK\003,\222\265\362\006\003\212\222\222\224O#\024]\343 #\237\317\016>\253\260\036-b\345\223\262\206\212\026.|dM#\023\205\034\231\032\314\372\fh\261\237\263b\350)\233\224J@\362\224M\312\245\234\243"
+	.string	"$>UF\002\2253\2242\224N-V\331\244d\n\321Ag{\266\372\266\376\002\262\373\013\230\333_\200\334\376\002\340\366\027\200d\377J\027J\027J$f\316\017\3343\007$\033\377\254q"
+	.string	"\363\271 \nT\")\217~\362\344\342\2626\3125\b\273\236\262\376\002\204\354\203\240|\241l\241$\"^\243\"\340T\230U\026\265X\345\013\345\020\322/\211\006I+\2112\320\fIIq6Y\177\001<\366\027"
+	.ascii	"\265\177%\213\267X%\013eP\033GM`\356*\033\377\024q\240\024$\323"
+	.ascii	"\211\312\032H\331C\211\232[\326_\200\320\376\257\364i\261\312"
+	.ascii	"\037%\317[\345\217\262\205\262\347\203M\034\327$\031\203|v\360"
+	.ascii	"\005\"\357v~\210ie\317\013\202SXY_\001P\366\025\320\266\257\200"
+	.ascii	"\262\235\0352\240\244\255!Q*T\214\301r?j]F88`5\200\\\206Y_\001"
+	.ascii	"4\373W\332(m\22443\262\210\201\200kq\326\027\301\356\360PI3B"
+	.ascii	"\321\334\225\320a\234\031\261/y\244\252l\2052"
+	.string	"6D2\025\332\035\031\314\372\"\024I\016&\007\223\205X \243\250\270\b\006\bMv\304\007\026\341\223\2053B\364b\210 \006\b\230\024\274\240\020\316\316\312J\307r.\310\002\237\024\244\201D\203\225\365\375\334\257\267\277?0.??#\333\005h4R-\037\030Y_\004\037P\240\350\235\277\224=\2407?\247\034Y_\004(=\275\344^\333\006dgeE\2042\304\ta\366\311=\2757\311,NH\004\027I\274$^\226RT\213}w\247wv\314\341G\f\021r\350\350\222NZ\300\272'\235\034\233\340l\244e\235lb\334\0222\330%\030%\t\227\204K29\204\263\263\n\224{\222\311\322'v\302\226u2\256\003\234\034\216\242\250>\0344Y?\001\331\266\266\344\022\013\222H\331Y\005\306EE \216\206zP\342\262\376\223nO.\301;\006\201\262\225\225\2006\266d\0226$H\364\316\246y\007\317\216\354'"
+	.string	"LMM\357\f\302%\340\272\323\322\342"
+	.string	"\f\002%\300j\377I\264$\332n\033\241\210)\006\022\300\330\213f\007e/\353'\200\306\376\223g\3113\025\r\250\312=\354\304\254\262~\002\206vrHrH\262,"
+	.string	"TgvVVI\262'\313\362\332*@%&Y'\211$`\007,)\006\026\026\246$\np\037\001nA\222_A\222X\254\227\027\007\252=\004\024\331G\300\326V\222k\353z5\376@@\325>\002\236\222V\311\254\244U\022+\371#\371#\211\345\200\037\202Q\311\253'\2614\223\301\025eY'\201d \275$E\0200\264Ob\220*\331\203*\351\303\007\017\036\034^\300=\331'qdGRjGT\324\361\305\330>\211\0377\2229n\350\035\0348\364\316\2461\n\221\240\261O\202'I#\371\224\244\221\204z\022*Y#YC\357\234Y\303a\210\206\004\315~\bz\373O\312\300&e\354\243m\243\303\024\007\261\004\366\320iM]\237x\262~\bVMM9g\204'\246\232\032\r\366\3268 v\t\331\201\224\365CX\332\177R\351-6\251\224d\002R"
+	.ascii	"\022\036\035J\201@\224vh\262N.\001\351\270>\311\372!\030\355"
+	.ascii	"\2070\004\003\233\204\361\366}\340\007dg\025\030\002\315\376"
+	.ascii	"\223G\330\344\321\313\207\001a\317\026\021\321\333\r\257\254"
+	.ascii	"\017\002Z\362\0056\371\"Y\004E\212\330\207d\242\232\313\342\311"
+	.ascii	"\372 \004\331\177r(9\224\325\366N\0347\035\031\263=W.\2329\336"
+	.ascii	"\252\262>\bABBz\247\202\027R \350$[$\201\222-\222?\311\236dO"
+	.ascii	"\362\247\215\177\004\271\354\254\002}\236\374\321q\305\001\270"
+	.ascii	"?b\311\376\223,\222,v\22066kc\035\026s:\262q"
+	.string	"\254\204\203\035$\273\205\315\372#\304\366\237\324\321I\356(gX\251\260Z\232]\321\035\311=3\304M\260\210d\375\021[I\233\244M2\247\365\213\221\304y2\247n0\306Y\326\311\233\234\243L\n\263\032\2222\274a\222&\307q\034G\025\205\344\320\313&\343'iVvl\255e\215<4n]k\234\375\214\230\021\210$\fD\016\276q\334^\231|~\342\242\037\020HA\244 r\260\215\177\370\b\240\006\027\345\310\301\234CXS\024o)Y\212!\225\365G\020\355\217\210\221zH=\344\337\236\337\221\177\227B\263\361\312\032\331\227\201\202\020\016\306\310\032\t\005\311\247\024\3723\304\301\027\345E\020\337\336\221\020\037bn\355\f5\025A\310\354k\344\007Ph.\353\263"
+	.string	"\"\355\220vH\274;\205\316\220O\216\304\203\343\262Q\313\032y\227\217\342X\213\217\305n\037I\327\"\353\3522P{\215}\336\032{k\034(\353\364z\204\262>K\334~\233\201\336#\345Z\344\034r.\253\251\020\327\004i\300\306\305rd\277\315jo\\\\\022\020\331\333\033R\02055\244\233\324\236\235\225U\333\221nZ,\332\320\262F*\321"
+	.string	"\222\025\200Y#\223 \221$\257\334\3425$\377\341\021X\2007\220 \331\334\264\356|\260\027\030Q\213\261\366f\361\271A!\313\372,?\322\322\244\244Xj\240\241\245\f\002\2610\235\235\351\035\343\036\215\235\225\025\213\01300dY\222Q\r\210\354\310\262<\rZ@\325d\215$\0027\r\325\re\215\034\202\034\323J\342\372h\214\021iP\365x\201\034C\212\0251\344\333\263\361\362x\342C\013{\235\262\220\023\250\274\254\317\222\263\177$\026\213\304\276J#\2001\305@\"\\\021\307\374\344\334"
+	.string	"\275\274(h\203\313\333\332Bv\301pRI\331Y\005\"\273\322\370\202 \231e\215\274\346\243\272(=\272\017\332\262\262R\200\316\322\366E\264H \310\037\310\253\247\265qP\334\356\304\250\262\313\306?1\007\377"
+	.string	"l\377\203\037VV\024\f\302}\200\003I\205ER!}\270:q\354B\204=.d\217\334&(\006\210\344\261\261\202p]\275/\372\276\242\262\376\007/\244\244\336,\251\017vv\354p\"\001\r\346\310\241w8H\301A\271q\303\310f\304\345\201\223\0325\220P\316\241\247#\241\016\365d\350\256m\306\f\275S\244\212\201\266\177dS\023\322I*\316.J\203\035\251"
+	.string	"\334]\271\305^\203\030\311\372\036\204!\215\220FH\246\242\321\036r\351H&!\244&]Y#\2252\220\262\316K\357H\326\310\244\032\270)\232\254\357\207\204q\247\367\202\t\022\006\022\211\311\222$,\026\373\211\207\217\321\321k\223$\312\001\"$\353{\220\365\342\205\024\227\007:\3665Q\213\034\302\"\2074Q\207\230f\357\0036\017\226\366\217\024B\n!\201F(\352\311=\350\330\234d}\017X\354\037\331\323\203\004\3326:L\261\320\001\244\370\364x\274}I"
+	.ascii	"a\270O\220LX\303\251A\344\017\322\247U\242k\301E\200\240\036"
+	.ascii	"\264\254/B\020\311\203\3441\262\005`\351n\377\310\025\310\025"
+	.ascii	".\226\bip\"\344\220:H\235\242\232\024\331\341!2\347\314\2443"
+	.ascii	"d\216\212\023\246\267\254\2217\255\341\222oO\320)kd\214\264y"
+	.ascii	"\005u\360l!m\2205{7SSj\037X:\244\313\032IC,\362\030\351/\316"
+	.ascii	"A\304.,\277\255\254/\302Ga\241\336\331q\254\034\212!\"\307\340"
+	.ascii	"\240\336A\213!\"\306\021\360\bx\024<\216\027I\352\030\370\243"
+	.ascii	"`k\350\376@\331!\023a\324\207=\366\035\375\222\234e\371\2600"
+	.ascii	"\222\365E\364\354\377\310\207=\362\031\251F(b\252"
+	.string	"\251\021\241\252k\252(0{\004\306\220\254\337\301`6\253w(H\223\342\333\3771\357-\366\230g\224\032\341\211)\016\372`+\350\206!\222-:\030Y\277\003\270\343\223\343\023\275\323: \315-j\315\316\316\310V\001\032\027\266I\213=69\326\265@q\\\363t\201\320\036\f\016`\"N\200J\366\026\222\t\257\306Z_\326\357 knN\357\\\220\005\327A\217\375\037\343\342\216r#\024u\3054)3r\250\260\n\214c\030\034 \361\302n\324^<d\262\211\213\301\241\254\337\301\223\022%\3077\251\030vVVK~|[B5\351\263\313\372\350f\334\332\322\363\213\222\365\261\355zB8M\2124\321\212 4\245\254\337\001\321\021\311\021I\022\r\317\332\2321\333\002\305\350 .+;\036y{\320\244\375x\204\004\257\036 Y\037\215l cB7Y\037\321\216E\226b<N\334\212\264ri:EE\316\272xb"
+	.ascii	"y\002\245\004\312\230\031\261\t\022\220\310\333a\026\213=\022"
+	.ascii	")\n\302\331YY\r\371\221\310O\022)\275\254\217cy\013+\210_\326"
+	.ascii	"G\261cX\325\n\036YaM\242\314\376\302\300\216\baR\002\227\325"
+	.ascii	"\324X\022BDB\f42w#IV\326\321+\305\217+\310\217^\317;\301\246"
+	.ascii	"DH\326\307.\023\214\364\330\313\372\310u\274\342@YZ\273\376\207"
+	.ascii	"\217Oo\1772\216\327\343VU\025\234\234W\207.*%-\"\r$S]_]\326?"
+	.ascii	"@\221\375\366G{\004\202=\0029^\301:q,t\200%4\304>\244\333\336"
+	.ascii	"\230\324\227\224\324\321*e\b\250\352G+"
+	.string	"#\335\322\213k\326G\037/\024\2434\252\254\217=\216<\336\255\253\032Dxh\261)l\332\221\307\221\n+g\251\207\320h\224\265$4\225\003\333\034*\303/+(\250\343\216\345\341\236\216\037w \ri\232\324\262>\346@\241\250\254\016\007rM+K\f\307\215\234,\215\033~m_\330\n5\0339{t\302D\214G\007\023\323\261\006\320\231\235\225\025\215\037k\354 1\006\217d}\234\321\372\321\360\210\222\365Q\306\321\251\310\267D\203\344d\243\311l\356\350tl\n\262\371\213\361\362\234\b\035cd'Pl\360\271\310\372\007\210q|q|qT:\002\322\330YY%\375\250\264d\322BJ\312\372\b\303\315\266\311\205e}D:\036\351\":~JG\313-#I_GG#\232%\266@\271\214\303\354H\331\261(\257\001\331\261\003'\353\037\200\250\247\3478\244\254\342r\361\343P\306ks\313\313\372(\224\201\376\224d"
+	.string	"f}\f:\002\361\ri\341\"\353\373\035\201~x\274\030<\002\035\177\b\223VX\221\3014h4\211\263\366\311]\327d>1T\326?\200\316\221\347\310s\\\261\343\353\036\007\177\307\234c\316qE\033\353\030\001\331Y\005\036w~\\a\374\241\3313\313\372\250\223\201\210\344\235\271\310\372\250B\023\371\351\351\341\340"
+	.ascii	"\356\030\037\343\343\315\231q\034\033\301\035m~\274Q>1b\265\226"
+	.ascii	"\365\261&\037\271\202<A\332\262>\322<\255\230\304\315iI\210\241"
+	.ascii	"!X\261\207I\206\020,BB2\327\310\006\231\324T\224(\304>M\323\274"
+	.ascii	"\211e\260E\305\261\022\016\362Z\\\224\246\254\317\301S` \261"
+	.ascii	"o\333\3500\3258\031\200\250\005\020\253\3008V\302\001\221M\210"
+	.ascii	"S^\326\0171\370\367\247w*(\244\311\362\361\031\373v|]\002\202"
+	.ascii	"rc\337\237\341\230\234\254e\375\326\020kG\223899cv\267B4v7fo"
+	.ascii	"\324\033A\342yp*r\350d}#\2361\357\207\263\024\024\024W\326\017"
+	.ascii	"\221d\033\357\214O\376\303\305 M1\332\262~\016\221\266\201\222"
+	.ascii	"MG0j\020\207\216\254\215NZ\303}\243D\247e\254\373:K\362g\254"
+	.ascii	"36\201\303"
+	.ascii	"1\354\311\272\211\221\211\221.\353s\b4\367\303G3\031Y\252\254"
+	.ascii	"\037\302k?\204\217\375\0204\340\340^\300X\262\304xd\004\\!X\264"
+	.ascii	"\265\031\331\266\021\220\235\225\225`\222$\306#cQO\326\326\214"
+	.ascii	"l;\216c\032fl\323D+\352~-\326\310\026\307C\207X\3267@\022#F\214"
+	.ascii	"GB\360\203\263\263\n4\246\335xd\033:Y\372+\262\177#\326X$\367"
+	.ascii	" \352\3045M!\260\321\\9\270\001\300\314\314`\034-\211\027\006"
+	.ascii	"\330\032\0333\222\275Lq\034\347\304)bd\265\310\022\271\221,\003"
+	.ascii	"m\267\270LG\326\306!\371H\206\021\034%)!B\214am\373\023\307\261"
+	.ascii	"M\034+)q\330\342\002\2731,\037-\365\370\264\312\fPc\033\203\030"
+	.ascii	"\203\030\277Tx\251\214^7~1\021\273Kj\r\227U\203,\226\266\021"
+	.ascii	"\310\201\030\271\3408\216\343\242\230f\217\345,\206\235U\240"
+	.ascii	"\361z#\227W\215\"mY\033\261\214[\377a\"\315\021&:\343\226Q+O"
+	.ascii	"P\320In\221i\300\314\234\214\255e\235\325\036f\032\035\247\254"
+	.ascii	"\017\234\254\215W\313\243\256\253\271\353\215E\265\240\313\372"
+	.ascii	"\006\330\331XLh\242d\255\314\321\003\225\224\365\337b_f\364\301"
+	.ascii	"\025\025\3071\023i\327G\004,\353\033\300f_\213\\zfF\202\256\257"
+	.ascii	"\233\r%m\306\251$t2ld}\020~\333\030\225\034k\013\202\226\365"
+	.string	"A81\3520\352\330imW\354\323a\213/\316*0\216\213@\034\003\371\224\312\262>\210#\3737\326h\261\306\032F\034)?\022\300\t\313\336x\343F\034\277\361\311\b\225\201f\320\321R\312\332h\203\345\306\033MA\376\016\263\276Z\353|\335\253\363=\b!\3737:\335H\3437\3120\316h\tg`a\204\211]\326\304\250v\345E@\353|\215M,7:\001Q\3333\314\232D\353|\215L[NpF\222\254\017b\312\270dL\302\032\223^\"\260N\034\003\205\300&\365\303\301A<\355\337\210dD\272\240\t,4#\007\216\254\017\342\305\376\215FF#\230\210\021\b\375\203iIO\326\337\200p\377\306\027\306\0270\0243Hg\3139\345e\357\330|\340e\375\r\350\366o\0342\016\30144h\213\272Z`\305\204\204\214@\032\276\211\233\254\314\312\210\204)\311\372\033\364\330\277\361\307\370c\004\032\001\214\251\006h"
+	.string	";\256P|\344\315AQ\323/\016\252+\253\254\277A\323\376\215=\306\036\"\021\322^\245\0264\324\262\376\006.\366o\3441\362\300WE \216fQBCY\177\203\232\025+\214:\032F\006\321\027\032\236\326\031\026.Pr\330Ik\214\224x\264\306H\221\035\212M\016\307\224\343\312\007\016\314\"\023\331a\206\205\013~BD\365\204\365\t#}R\341b\211h\325i\225\306\254\220\214\241\206\352S\206\250\365\3712\363\3624\301\032\215A"
+	.string	".\325\246\3133\n\203\211\030\251U\372\304@5jMQ\002\n\030\230/\2500\253H\227\347\364\245%\345'D\310@=\200\226\320\340\004\264\003\325Z5Vaxy!A\003kK\225\205\023\254\321\b@\255T\245\265\305\370\362\204N)\220\2023\206\250\365i\215a\345\345%j\002\rQ\023O\353\313\364\002)\250Q\253\365Y\2025j\242YC\365\311B\365\b\023e\341\204\t\251\n5@\237\326\026\021HcxyZ\2472\324"
+	.string	"}Z\253\312\237\020\0013\245\312D\243-Q\021Hc\260FM8\177B\0045\005\227\250\214\314\224z\2025\032\201\016U\022\254Q\023+\326j\314\024\352\212\300\nM\272\304HS0!\363\276L\251\326\230\251\t\031X\243&<\270\254\200bZB\212\022PLKp\211\221\226PF\241O\231jUZ\254\236\320\241\206\352\223\205#\365\031}AZ\2431\030e`\2400\321\252\214\t\017\246R\025\031\023*?!\"*\223\302\n\245Fedf\246\326b\025\206%2\205\021$X\253\317\022\305\347\324ZBOe@\201\202\225\202\250\211\244\fL\n\231\342\n\314\263\205(4&\372\"\215!)\003u\232\002\207\237\020\201\244Fe\242Q\032\336\230)4*\223b"
+	.string	"\317\251U\252Yp\001\206\027P@!j\225Ro8Ja\2521O\252\f'\252\322\030i\nS\031\250\323\024\254\322\347\r\004\250\276\274\220"
+	.string	"s\303\0132Sk\2259\225\201\303O\2108\316\274\340\022#M\001"
+	.string	"\321\026c\t\316\350\013\r\317\027\351\323\006\022\254\324\351\013\325\025^\236R\031(L\024\346\245Z\253Tk\365MQ\202K\214\264\304\005V\352\364\205\030b\2422Se\324e\312\2025\032C\022&\n\363\242\220\262\340\362\234R\200\006\351\213\213tj}jjK\rS+\325Z\335\324\023P\nb\242/Tk\365\245Z\253\034^^fbb\2461\305(uFF\313\300@\243\325'4\206j\255\036\255-%\240\315i\211\230\025\24013)\324"
+	.string	"\215\2360\0019-\021\263\302\321\332\322\254\241\372\224\301\0325\301\264\266\224\2002\247%bV\210\306H_\\\236\321\023\\\244/L\251)\"`\215\232\240 \345\206)\365\204u\032S,\361\214\276h\227\230h\313\323\206\226\030\251\365E:CC\t"
+	.string	"x\200\205\003 |\300\265>a\250\323\022-2%\254\306\023\325\231\227\024\224.1Q\031\031\022\226?!\242\n\003\365\240\n\003]\261\376\204\b\032\236T\023p\265%YmqqVo\230Ru\365e\n\325\031\250Ne\264\006\252S\031\355\022\245>\243/\320\342\rS\030\250\323*u\006\n\247x\276\310T\245'Xc\242T\352\214\t2K\227\352\023\003Q\227)\fU\372tF[\222\326\237\020aC[m\261\241z\302x\242\255\266\325\327\232\022u\231\302\030\255?!BFJ\265V]\242/\036L\245\324\351\313\024\352V[\252\321\225*u\37225\341\345)\205Fe\252Ij\324%FZ\""
+	.string	"&\236,<K\340"
+	.ascii	"\205\222@\301\224\232\"\002\034\254\322\230\025\244/\320\"5j"
+	.ascii	"\215AA\372\002\335\325j\024\352\022#-!E\r1PS\220\276@U\254\357"
+	.ascii	"K}^\200\372\274\2005\032\001\351\0134\345E1C\202\364\005\232"
+	.ascii	",QBZL!35\241\231Bfj\002\263\331\341XM)Z\237\021\220\276@\225"
+	.ascii	")\036\244/\320\025c3E\372\002\365`l\266Da\244\326\230\031\252"
+	.ascii	"\007\320\022\024Xc\242Pj\364\005\227\347\224\002\035\254P\350"
+	.ascii	"\223H}\336\340B}\252\340\374\t\021\026Tcp\211\272,eR\310\260"
+	.ascii	"\374\t\021\024\220a\205\030<\250\001:}1!J\235\232\260\254\316"
+	.ascii	"X\237\326\030\250\317\013pPyy!A\006f\306%i\342\005\031\230\031"
+	.ascii	"\227\243\362\003\021V\352SF\204\013Q\023+(fHp\211y\302\300LM"
+	.ascii	"@F]\2124\034\255R\024(H_\240E\351\013\324\030\265>#P\225\211"
+	.ascii	"\200\364\005\332\224y\262 }\201\276(\244,\034]\2420\324gU\352"
+	.ascii	"\322\242\244N\255\323\031\031\353\214\013\321*\365)\303\214\302"
+	.ascii	"<[\220\276@\213\310\017D\240pY\301Z}\276(]bf\2461\244x\276T\243"
+	.ascii	".S\026T\244/\320$5\352\362\234\276X\247\323\022\244/\320d\324"
+	.ascii	"\206g\f\322\027h\021F\201\002\f\322\027\350\021\256\302/O\351"
+	.ascii	"\261:\265V\243Te\n\231\251\t1+TWP:]b\242\324\026\0232--\315\252"
+	.ascii	"\314L\r\320'\rI+uz\302\304\314\224z\302Z\255>_xyJU\252&\250$"
+	.ascii	"p\330\322\027\350\321\004\225\004+\212hL\321\230B\215\242\330"
+	.ascii	"\314\r\363\244\232\230Z\253R\025\2525T\2372H_\240M\027\030\350"
+	.ascii	"\226y\211\252 }\201\026\253\310\351\013M\370iC\211#"
+	.string	"\fK\022Td\236,\354j\024\346\331\0022\n\363l\001F\001\003\322h\215\221Re\222203'H_\240M\351\013Te\306\004\225\004\017Q\230g\013\306\250\365yB\024F*\003\374\023\"l\360\300\345E:C\003\fVi\004\254\324\351\211*3f*\255R\243\027\220\276@\215\311j5\n\205>_\017\260p\200\345\003.\006R\032\236-6TST\231&\236O\033ZZ\222O\033\226V\031\230)\365\205\030)\005NT\237*P\247T*\n\321*\365\371\302\r\323\0231H_\240M\244K4Z\"\032#\245@\214\224\372\202\364\005\272\251\360v\241N1`\215\232HF\241O\231\030d\2445T\341\024V\031\030\024\252\322\242\365e\346Y\"zB\365\3459\023\002\024\250\326\027V\254\317\351K\t\327j\225\236\210A\372\002UF[\252&\236/)D_hxV\245'<U\244/P8\205\314\324\004f\005+"
+	.string	"PI!35!%\205\314\324\204d\n\231\251\tM\r\004PA\363\002\rR\310LMh\251\n\300\231\301\207*5j\265F)"
+	.ascii	"\2452\227,|H\251\232\020u\231\262\320\341\325\023O\355\244Fa"
+	.ascii	"f\252\034\2521\300L\255\325\031\250\005\326\226\250\b\244\325"
+	.ascii	"7\332\342\262B\r\325\247\f%\240\306\030\234V\031\353\314\013"
+	.ascii	"\322\027h\361P)5\032\0235\261\037\002\002:@\200\b(\212?!\"\n"
+	.ascii	"#\265z\0203\205\201\231B\255O\227\226#\365\031M\241OXc\2460n"
+	.ascii	"\212\247\013\261J\235\231\236p\253Q\353L\214\024\246Xu\211\231"
+	.ascii	"B\243\325bU\372\362\"\205y\177B\0045\372\022\205B\237\036T\253"
+	.ascii	"-P\350\323\265\376\204\b\002P\243//\322\022\257u\331R\374\t\021"
+	.ascii	"V\350\f\325Z\035QmA\021\265\316\3004k\200N_ZZ\336\226\"5\032"
+	.ascii	"s\303\264\245\245X\245F\25331--\333%FZCK\313[\215\221\312T[Z"
+	.ascii	"\212/\321\226\026\330\332b\255J_\2302)\254\035\270D\251\317\023"
+	.ascii	"\325\016<\250Z\2454x0\023c\242\003\02431\322\227\016B@@\013\002"
+	.ascii	"D@\341A\324e\346\005\032#\365\200Z\235\361@\001V\024\321\230"
+	.ascii	"\227gL\213\3133J=a\225ii\341\320\362Z\253\322\227\226\226\367"
+	.ascii	"i}\272\264\264\274Q\021H\253--o\r\320\351\213\266JcV\210I\301"
+	.ascii	"*\215\221\276T\353\013\320\230\231\024\\\236Q\030\240P\022T\252"
+	.ascii	"-6DO\200B\237;&\005\227g\224\372Z\253-R\231\030JDO\210\312\244"
+	.ascii	"\220\241e\205\027b8F\2411Ok5F\272\255-.\254\240c\244/\304T\241"
+	.ascii	"\257T\246J\254\266\2300b\205\243\t#V\200_\350\b)\361'DTgh\250"
+	.ascii	"\266\260\340\302\244F\255\325'\314\033\265\341\371\022\303\214"
+	.ascii	"\f\314\236i\261!\352R\235\241aW[\242P\251\r\321\023\25234\034"
+	.ascii	"\243-Q\231\0242Tgh\200\2432)\254\325\031\032"
+	.string	"\212\325\031\032\210\021`i\201B\237\357\rO\030L8\201\204\327\372\023\"fd`Z\246\324\024&\240\320\247\001\242-0|@\342\003\004\314\310\3008_\246\325(\325XmQ\211\3060#\003s|\255/3\325(\fQk\364\204\031\031\230\224hK\214\t\351\313\263\205:\255\306D\253\312\030\023\322\027\022\240\320\347N\341\362\214\302\360\264>]`j\265D\313\t\023\322\023-P\350\023\031u\251Jm\210R\2216D]\210&b\244/20\317\030\240\320\247\323\204\023H\200B\237o\024\032\343\202\265\372\214R\300J\202\213\005^\242P(\tU\251\007\353O\210@1uY\301\032\023\215y\302P\2432\307j\013\212)\r\256\033\205y\266\200bJC\321z\204JML)\020u\231\302\300\325\226\230\251\324*u\211\231\232\0203\225\302x\210\266\270\254\200bJC\321e\205\250\313\024\346\265\376\204\210\230\347\213L\313\313T"
+	.ascii	"\326\252\324\245\245Z}\312\300\325\226\250\365\031\201\227\351"
+	.ascii	"F\321\246h\255/O\242\264*C\264\336\360L\201\334//S\252>\001\265"
+	.ascii	"Je\\\016Vj\324\n}R\237'\240-\326\351\224\206(\225\251\264\246"
+	.ascii	"\240Z\2430\321\227\2505\245\206\352\223\005\244L\025\246*c\242"
+	.ascii	"i}R]f\2364\264\240\230\322P\003\364\371B\003\005U\352T\346(\202"
+	.ascii	"\023-Q\353\223\332\022\265>]dfZV\254?!\302\204"
+	.string	"\214\007&d\242\325(\f&d\2161%\262[\225\232\210\302`B\006\031\025\201\264\252\253\325(\325\305\345YL!3\205j\252U\206hmN\245\321\026\n\252-Q\023\317\252\005\232\306h\213J\211m}Z\237'(\253-\310\013X\251\323\027\2306\274Rc\264%\3522e\301J\235\312\030\243-.X\251S\231duZ\214Z\2370\270\314<i\330Q\021Hc\210\212@\032\303\266n*\322\345\031U\341E\372\224\201\032-Qb\246\004\024V$\325\372B\324\006i\024\032\205\241C\r\320'\r//O\023PP\215?!\242\202d\024\205\024\006n\251R\247\326)L\313\r\317\024\316\237\020\341\"\225\351\340\"\2259\302Lc\242.-\325j\024:\245\312\264\270He\2321S\2515&jC\224*SA\212\347K\324\005\203\350\213\325:\245\236\260\266D\255\317\250KK\211\022\323h\rOkK\212\347\r\317\230\031\352"
+	.ascii	"`\242\326j\212\252\322E*\263\204!j\203\324\n}6M\314\320\020u"
+	.ascii	"1V\241Rk\265\245\206\352\323\272\254N_@@\364EZbJ}!j}RWj\200N"
+	.ascii	"_\24032\320d\024F*C\024\372\244F\300D\214\024\206JB\214\013\324"
+	.ascii	"\350\rS\031\n\224\324\250\264\204\324\032\023uY\301\205\372\234"
+	.ascii	"\322\260\214Z\237/:f\246\030M\246\200\306D\255O\nX\251O+5\372"
+	.ascii	"2\343\022=\001\255f`\335Q\230g\0135T\2372\3200S=\242P\225\302"
+	.ascii	")\254R\352TJ}\001*\265>\255U\245\313TJ\215\276\340\022\245J\253"
+	.ascii	"Q\227\244\265%\n#\265\036\2430R\031\236\326\227\350\t\326j\324"
+	.ascii	"\372|Y\242x\3020_\236\326\2515\305\332R\265@\024Fj\335Q\030\251"
+	.ascii	"\f1S\251u\006\032E\201B\324\304\223\032\265\341\251\3622\235"
+	.ascii	"\226\320\342Z[\\`\240\322\027\350>4"
+	.string	"f\246\204\216\231J\2552R*\264\032u9VMP\237\332j\215\231\231\232`\254\266\244\240ZcP\250\276V\231\250\265\252\243%\236\325\027\3513\005\024T\017Q\227)\214\266^\260\254\2664g\236K\353O\210\250F]\2460-P\252\007\320\022\036d\242\326\030\\b\242\305j\013T)\023\265\306`\245>\255U8j\"\346Iuc\246R+4f&\005kL\024\306Z\235\001\201\3133\345\004\324*\275!\006\0243\317\025+\212\231g\013\212'\314\222j\224y\302@\251.5\352\"\265aJ\225q\211\242\240\276<\245\324h\265\211\"\372\"3sB\211\227\347\t\343\313\024:\265N\2512K\027)l\215\231\231B[JP[\2442\325\026\024T\016Q\027)\225\032\265a\332\022#\305\300\332R4\361\224a*m11\363\"\323\241i\215V\243\324\251u\346\331\342\022#\245\241\305\372\254\266\300\314P\2555De\252"
+	.ascii	"\200\"\243/Oh\325h"
+	.string	"\245Fm\210\221\266H\253U\352\021Ju\221\302\2701R\230]\0034z\002\212\342\t\263\227\325\227\247\r1S\251\365\3712\225\241F\2551+@\251\034\252\321(\325D\364\204\350\213\211\030\022`\236&\330 S\"\305\345ez\242\032\245\236\220!j}\332 \265BI\210\272LY\240J\237\035b\244\320hu\246\005\305\023\246\005\005\365H}\236\200b\340\022\2151!\255\306\314$\255?!\302\203\017\325\024\\\242/4<c\242K\352\214\365\031-\261\264\376\204\b\017\240%8X\247/R\231\244\365'D\240\240z\200\202\352\254\232\210y\302\200\202J\201\025fJM\301\205\372\274\201:-\221Rm\201yR\237/X[F\200Pu\211V\251Q\033\242\324e\364\305\305E\n\363Z\177BD\325\003\353\t\023\322\227\022"
+	.ascii	"@1\245\201Xm"
+	.string	"\241FQHY\230\332@\215V\221/\321\230\230\347\t\023\254Q\023\324\2475\031\205Rg\2461Xgdb\244\307\250\365I\325.\321\250L\325\265\376\204\210\226\02234xP\245Fm\220R]\236\326\247\213\256\266P\217\326\226\250UJ\305@\211\031\032\214\324\250UJ\275\3415A}\022SX\245\320\247\314\023\272\255\317\374Zg\2665Z-Qb\372\272Dk\200>e\336jKt\346\345i\203\364\005j\244>O@u\024\346\031\243\2432)\254\332:\363\362\274\200\364\005\312\264Z[D\260\306Hg\212/\357\t\253\211\230(\005R<\251T\022\244/P\nR<\251\324\247k\215\266\274\244\240\210\272\304\254\020}\241\341i5F_hx\312@\001\351\013\224\002\231\231\032\246\323\227\327\372\023\"\252&b\244Vk\264\212\301\2472Q\252\007\326\351\224\352\301\021\305\023\206Xm1\001\305\223\205\030)\013\322\027h\323\332\202"
+	.string	"\026k\214\264\030#\205!\242x\302\304Ha^\023\322\0221S\350km\2111!\343^\001\n0\001\003\013\264\020\201\r\025!}\201z\020\205>KP\243\326\030\251\0071\322'\214\007Pj\325\003\021\025\304\230\220!\376_\351I\261i\325\266\214\362VtVtVx\330v\276\302\263\302\342\013\210\336\n\213\225\025:\316\222\020\345\332\236\300^X\261R\263R\263\2223"
+	.string	"\0344\032>Vl\276\222\263\202\003\346v\246d\005g\345&\177\031\351\021$H\\\035\341\340\376Wh\2209HA\033q]*\203*\203*\207a*\204W94<\252\370:\222\303P\245\220\305_\366\230ew\325%\347\347\247\"\b\245"
+	.string	"wfzG\202*\201\\X/\200\250\004\252"
+	.ascii	"\006i\025n%q?QGT\376t\221\035nSwY\337\205\262\375\253\364\245"
+	.ascii	"\024\215\345\210\365A\241\241\354C\322B\3423\342\270\t\264\353"
+	.ascii	"\332K\211\261\351hp\305\331\224\237\242B\035m\371\272\304\"2"
+	.ascii	"t\226\227\342b\004]T\013\274c\035\234%r$\354\311\335\023\023"
+	.ascii	"\323\233\223\253\334\375[M\305\256%\234\241\005\324\013\264\254"
+	.ascii	"\263Y\273\362\356(,Wq\262\202)LH]\023\244\335\020\240\036\223"
+	.ascii	"\2534\371U\346T\350b8\235!Y\023\257\355\312+B\353|U\344X\256"
+	.ascii	"\302\304K\207\316\217\254\023\020\247\002\227q\364\016\201\250"
+	.ascii	"\300\3750\216\312\033\034\303\354J$\353vm\211\212\333\227\324"
+	.ascii	"\217\212\333\017\307*m-\341\fK]]EY\267?\355\312\373\253(QI\322"
+	.ascii	"\346\200"
+	.string	"bz\242\262v\225$\277\n\233\n\222\303%\036\253\254\337\300v\345\275^\353|U\324X\256\262\026\325\204D\226\365\363Z\347\373\253\034I\226\035\253\200\020Y\222\006\013\352\242\253\240\016#\311\034\037X0\206\320\216G\246\240\260\250*r\364\n\301\n\030{gF\240\025CZ\2740;Z%\211\334\206\340\224\025\327\334\250\272\267\032dH<\265\260\026kY\213\211\251\f\321\340F\316\306-\2532v\225!E\274\232v\330\\\360\261\205\bQ\001\203\021B\232\331\235\025\330\361\212\205\003\t)\353\273\220c\253x\251x\251|A\240\354\n\305\307\027\2174%'^Y\337\205\245\375\253\004A\002\2519\375\325um\270\345\222\256\302=\256\235$\231\215\343\252\271\302-\230lr4\331\202\177\332\261\267,\230\026\020\244^Y\222\257\254\345\317Fb\"\006\207e$\n=Qa\257\340\245\267H\307U\337\222\007/\254m\310\217M\250\207\350"
+	.ascii	"\323\263R\211\3124\306j8U)\377\224G\266\206\314\371P\221Z\326"
+	.ascii	"\360\300\001\353\241<tu\330\035*\251\360P\231RF\355\235\251P"
+	.ascii	"\241Z\352$\311\253\313zic\203\255HM\326\312(\327gJ4\360\262V"
+	.ascii	"\362\271D\362\314x\354h^Y\375\350\210\350hj\025\225\f]\247r\300"
+	.ascii	"K\260>e8\232]_JYy7`\235$a_\240\240\r&H#=\356\224\240\340\241"
+	.ascii	"\245\325\f.\037OL\360V\240\223\245\032\311\242b\223`\316\013"
+	.ascii	"\032p\035\221\016\271\245\031B\n\240\202\307LF\323\b\217\030"
+	.ascii	"\206S\263\2558\330\225\207\327\244\2624\245\203\007R\214&\\\022"
+	.ascii	"K\311\017-\246\346\\\222\262\036UY7\327\254\276\350\262JI&\310"
+	.ascii	"6\253\234\"I\306\260\235D\210\f*\030F\262=D\214F\016\244\224"
+	.ascii	"\025J</\274\272#'G 0\304\342\214\260EX0\224\036\255$/|\020%\241"
+	.ascii	"T\\\2705\241\253\313\372. \355_E\310\312\210\255\272\003\013"
+	.ascii	"\302\202\311n\260K@\314\257\245\223\216\254\262\037f\327r/\307"
+	.ascii	"a\220\017\334Y\\\316\216J\017\262\253LH\336\230J\013#\025\231"
+	.ascii	"\334\223<\025\036&\222@B-\031*,\2327,(\231AQY\221\325\302\362"
+	.ascii	"\336X\250\354\300c+\346Z\250\350 \2412\216\027xK**\222\202\306"
+	.ascii	"\031yJ\242Tr`3\"\215\037\202C*8\314\300\034$K*7\314C\254\256"
+	.ascii	"?\245\254UhThTjr\250\3240\375\250\230\020\262e}\027X\354_%\206"
+	.ascii	"\321b\344\250j\312:\005$!4\303\346\220\366z\"XX\330<Z\356(\345"
+	.ascii	"\r\022\036\257\002\2579\234\203\307\0354\331\"8\202wF9\323l\004"
+	.ascii	"\211|d\0344\"\307$kg ,\303i\310\333[\326N\300%\026\266i\307\354"
+	.ascii	"\217y\346\032a\212\242\003\005\212\263\217\001*\262zG\201}G\034"
+	.ascii	"A\205b~Y\277\205\303\355\334\333Wc=\300\262~\013|\373wf\235y"
+	.ascii	"\325\2645\262|e\n\\1$\027\316\260\344W\364\004oY\226\334!di\311"
+	.ascii	"\023\230\306\020/\275&w\307\241-l\217]\326\316:b]v\3329\235\334"
+	.ascii	"Yw-\326Y\351\324\274ZN\316I\347\244\207\311\235t\3169\033d\334"
+	.ascii	"\030\3159\327t\004\022\001as\302A\251\321@e\375\026\316v[\233"
+	.ascii	"s\311\334\017\267;\227\034\201\216\254\205\355\330\332jj\316"
+	.ascii	"$\032\334\304qN,\202C\033\260\2543\t\222wmG\215\032$N6\370n\210"
+	.ascii	"\232\223\315\271\006\227\201\235\255\350\021\330#\353\267Pc;"
+	.ascii	"\323\310nrd\375\026\220\366\3574\002C%o\354\270q\203vT\n\302"
+	.ascii	"\321\024\226\265\323\314yvg\221;\213dg\021\342\341\341\233\305"
+	.ascii	"D\310\253\235d\331I\304Yv'\331\257N\262\013\b\227m\233\301\362"
+	.ascii	"hlm\352\025\"\3049&f\006v\347\230S\354\006\r\032\204N1g\2302"
+	.ascii	"/\255\006p\357\204-\001\265\240\263\203\004q~=i\220\365\026g"
+	.ascii	"\350u\347\327\361\310\352\252\211p\377\316\256\275\347T\204\320"
+	.ascii	"\006\211\020\214\254\235Z\355\t\016\017\017\017\t\343\270\306"
+	.ascii	"\251\365\236\320\004\244\343"
+	.string	"\305\024\3075\316\253s\353N\255/\365\017\"=\254\336\254\346]\021\016\030\027V\023\320K\007\224\321\025\254\367\002\226\330\215\023\310\261F\323\f\036\037>\234VswUwZ\035\235\262\241aZ\024\335\324\224\223\007\031\210,\263;\253@\252;y4\235$ip\201}\205\355\337)\305\264;\276\310:*\212b\356\355Y\035\3219w\034\375\200\252t,m\274f>[\330\034L0\023aP\025\016\"\233-\t\f\263\033\310\2621\276\246\240\254\2355\2345\234P0M\236\331\323\235P\314<\235\243\312\t\024\251\355\344\344\234\001u"
+	.ascii	"\252\270\251\"\031w\316\030{\345\262I+\230\366\357l\202\203("
+	.ascii	"\353\216x\364\305`\322\245\321\374\3418\231\340>4\035&KH\267"
+	.ascii	"\266\255\254\232\254\235HN$gR\373\363\223\20094\032>`\334\231"
+	.ascii	"\204D\262\225\212\202 \025\035\301j\313;\23692\243&\3202NF\215"
+	.ascii	"\216\"\370\t\262\211G\357\347\305\221\310\317\233\220S\310)\344"
+	.ascii	"\034\272\361A\025\215\026\226\323\305\235C\307\260\244\214:\246"
+	.ascii	"\037,\250\330\2773h\t\207\324\371\202\341\004\004S\275<O\206"
+	.ascii	"\340\374,\351\222dJS5|v\236\322\352E\032\230\263g\231u\321V\343"
+	.ascii	"l\261\004\324zX2 N\036\246\215\261-\207\214%N\026\313\256\034"
+	.ascii	"{WO\316\235;W,\371\210b e\355T\341\324\251\212\022s\222u\036"
+	.ascii	"\325\223\"ZY;q\2349\313\247\2500\264\353=\273\f\344\021h\347"
+	.ascii	"\274a\372\024{\256\006i8m\230G\203?\200\034:k\2301\266\240\210"
+	.ascii	"8i\226H\336\266\016\241\2341|\305\324E\210s\210d*\306E\201\013"
+	.ascii	"\"$L"
+	.string	")\\\322`\253\313.*\245\020\t#\311\325\0250\353S \312\376S\006_\232#\276$\256(\333\t\r\271\245\037\202H'\244\022\024\016] S\350\254\306\235\223\254S\376\362\236\322uH\373\0255\b\304\317\250\263\\r\262j\352C\376\035yT\340\360e\263)|V\037d\001U\035\331{\n\037\222\017h\213\317\b\334\376S\364\340\037K 3d\250H\311k>\371\301\325\310\372\212EcC\307\223\343M\022\313c\257\355\016\351\303\354\350\313*\305\016\036\264\321R\342\204)U\243#\215\247\316\370\365\272\360\361\363\024\027\227B\307\366\301\325\333\235\225\334S\350R\346\230 \251]\245\314\2450i}\226\224\205\t!\261\363\342Jy\273&st\254\350\262>\005\240R\226\270\035W\340u\035\262h\203\263\354\204(\311R\262\034\253\301\211`N\222\243\240Z\233\226^\326)i)i)lO\251\271a\2041\024\207\025\030\027\271"
+	.string	"\361\247\254=\205-\315\315y\322\027\227u\212\332\323\366`\330\026\223\254S\216P\340f\377)F\226=\2122\206\344,A\333sLKM\212\374\030w\214\342\234\234\301H\216\356\324x\244\224=\305\fF\033\312\001\205\214/[\244D\226B$*+\026\207D\312*9\033\222\\\242\253\224\240\201\215\355 p\224\017\221#bI!{Y3\302\222;M"
+	.string	"\005u\300\216o\304-$6\200B\214\\$nZ\210e}\305\212\343\253\362\365\201C\305\331W\223\312u\373\301\371\362b\266\035u\\\213\340\004A\0162\325h\023\322u\224[*\353+\314Z/{\342\270Zd\275\006\305\257\306\334\326\016\024\202\026$*c\301\001\301b\263\214}\257\034\216\232\022\026\214C\031\210dn\347JY\267\345\224\250\230"
+	.ascii	"1f\223B\366\354\226~\244T\035\003\2114\211S\254\224yo\f\241\301"
+	.ascii	"\260\024\037FKH\360\262\376\004\b\367\237\322C\371\366\242\357"
+	.ascii	"\206\\\326o\261)<\214laFON)T\306#JftSJ#tX;\201RJ\263\344\223"
+	.ascii	"\037\036TQJ\032\243\303)\241\224\035\231/NF\221\271\024\035\360"
+	.ascii	"\rP\016&LRr\354\303\2401;\0358\370Z\200\244\346n\2005\301*\t"
+	.ascii	"\263\001\367@\306o4\342\240\266\220M\204\303e\364\004H\343Kl"
+	.ascii	"(\245\306\356\363c\322&\224B\003~\341\364\343dF\312\214mx\304"
+	.ascii	"\371Q\202\223u\212S\212S\021\311nb\266\003G\035\f\030)1\332\256"
+	.ascii	"\330\247\001C\220\002\227D\372\346^0=%\206\222\354\313I,*\353"
+	.ascii	"\224\245\034\3444\005\204$\353\024\245\247i\t\031\262\313:%)"
+	.ascii	"\323\200\235\212X\004!9:BB\265]\261O\225\353\257\210\025\354"
+	.ascii	"\227uA\227\365'P\225B\224B\224RD\330C\247\345\372\b:\373Jy\361"
+	.ascii	"\224\242\366\020\356K\2111\006U\023\016\224\254?\201\031)A)A"
+	.ascii	").\364\262\304?\037\036/R\204\236\342\302\005[\027\215\t\034"
+	.ascii	"\245\360\244\360\244\374du\305Y\005\302-bp\035\245\370<\345g"
+	.ascii	"\206\034\016\247\254\357\227\322s\245\211\363zRZ\300|O\356nl"
+	.ascii	"\220\242jd\375\t\340\244\250H\321IYA|\362\323\n\246\325\270K"
+	.ascii	"Y\361\224\235\021$\362\321\331\220\034\326\346\227\225\365%\320"
+	.ascii	"\267SrRpRhRhRl\240\344\237\264\242\030)5O\261\271\343"
+	.string	"\313\362[rx\310\362\246wd\245s\234z\024e}\t\220\025\026\032\331:\364\370\321;\n,\n&m\251\310\372\022\340\032\0344\262\335\bB\303G`\225Q\215N\326\227\200\216\246`S\020\306\241545\265\313\272\320\314\262\376\n\331&\336\233\331&^\023p\371\304\346\003\370\247\264*2D\324\344{\023\360\315\277\021$\236V\fs\262\342I\326M\277f_\023Js\257\251\227\267\302\\\223&\315\273\275\370\316*0I\246W\250\324\264{\363\256\b\224\030^M'\3049\240#6\232N\232u\313\037&?\220\3440A\312\372+\\w\214\030\315\271\016L4{ \242\f\3358\252\021%\313n\256\311D\320\210\2510\353\246\234\313\f!F\262\376\n0\226,i\302\005\362P\271\260\"\342\324%!\362\366&\034\007@\202\274Vh\321<\322<\322l\353\300D\343\367b\361P\271X\246\335\330a\233J\336lsy\250\365"
+	.string	"e\335L\222\217\236X\365\360@\362\037\266@\217\265\"M$M68\2773\027Y7\327\2160\222\230Ie\375\025jvSm?-%\275X\313CCk\032Qz\225\206\234`\004\352\247\275\244\227U\250\024\205\315\230&\345\262$H\363(\305 b\212\210FI\002\003\026"
+	.string	"084\026\217\210T]\027\273\001\024"
+	.string	"\022R\320zz4\250O\224,\212\224C\"\002\""
+	.string	""
+	.string	"@\002\200 "
+	.string	"\254M\212\0253\345X)\364e\351\345Q\273Yg(\n\234\321%\243t\206\277\265\207\354dT\355*\275\257\215\217;\b\337\332\352\251\rLO,\2035\205\222\361 \330\200\232xP\200[\320\373\2351\277V\024\030\214~\217\344V\201!\361\201S\021q\234B\177m\"\270/}\214\312"
+	.string	"\035Z(|\340\341\227/\377\tY(i\331\344\224\371\026L\007m\376\262p\354=}0"
+	.ascii	"\204\277M\360\204\335\253\037\274\024^\207\200\177\222\326k\350"
+	.ascii	"<b)\177\210mV\nI\034P\341\303\255\033#`!j\344#*k\004\035\266"
+	.ascii	"\006oN\232\224o\215V\202\227\205E\rA\001\366\216a\367\254\343"
+	.ascii	"p\002\177>\200\315\007\246\273\323\376F\346\2360\3748j\rI\342"
+	.ascii	"\210\313}/\214#\247\323\324r\317HbF\033\244?\nJ\253\316r\013"
+	.ascii	"{_6\005\216\266#\213\274\022\004\t\225\002\037\227\371\021\030"
+	.ascii	"O<`;[}\006\0018\t0\030\254\204\212AK\342\b- K\232\026<\027\371"
+	.ascii	"\201\200\243"
+	.string	"\350\330|\220]\233'\210\223,m\367\360H\221\002\333F\244\0163\t7\316\215\310\253f\b\223\r\30560+e;\024\327\001+\177\270\350\314\372\003\320\031\255\367\021\226\250,\326\211\013\317\367Y6!\215v\026|\327-\207;u\220[{jn\277\251\275\233kh0\223h\246\376\025p\263\345V\361\264\302\017\353\2129\300`9"
+	.string	"@\311\022\364\261\253b\235a\225o\200\213\315\245r\220\345S+m.\260\001\375\200\277`t%0<\357\026\260\365\344\361l\214T"
+	.string	"R\003\216\211\302U\023cE\330\"\242dk\242\243\002\224o\327\t(\203"
+	.string	"\250*\375\177\316\204\211v\004\360$|O\035\330\034\266\256\221\305\207z O\203u\303\361Y\214\362\203\021'(O\177\206\n\203\340\220\337+\346\022|k\200\264\223U\337\230mB\246\361s\353\363D\034\354\320o\204\007v\r\214\205w\203V\220F5#\265\347\242JO\327\273.x\032\rS\004]\034yT\017\207\272\322\230\311_\"\254\301\3218_'\203^\332k\001\201[\255!\3112x"
+	.string	"\346v\276\t\262\303,\252iVD]\202\355Z\253pq\003\020v'G]\216\227\036\240c\236\327\027\376k\\\227\332\3118\331#IDW\276\236\352\244\247HU\354\244\001\367\322\317\251(\017\375\206\312\333h\230\327\022={{\272\031\326<K6v\\\367\316\362\354\004B\247q\362\234\235tca\207b\370U\212\263\264\322\316\022]2\031N*\306Z\r~P\222q\"XUw{\211\325n\316 \037\023lp\301gm\250l\305\372)\242\317 j\310?R\003\"o^\255\216Dp\b3B\017I}0\351\333\233\364\273JG\031\371\271f\277q\f\311wEsZ\223\351_\026\007S\276\334O\310\312\352B\217\301\030L\252"
+	.string	"\236\323\244\247uk\350\023\025\213\367\324\177\364d\026\372\321\025Z\305(\220\243\230a\026LR$\235+/\220@6\006\372\307\376G\345\031'\317\374\0138\324lit\244Z(\325<n\364\236!\2342\304\316\024w\243z\203MI\317FN\245\200T\240\244\377-\241\230I\206% \"\210b\022\245\203\360"
+	.ascii	"\275\006\001\245Tl\370\377\312\211\254W\355\303J\271\367\304"
+	.ascii	"y\257H\314\346\265H\260>\264\340f\025\227\346\024\3370d\033\330"
+	.ascii	"\225\307\331\022\225\235\331\3063yR(\036\023C\225)\334f\300\314"
+	.ascii	"\272c!1@\270\231W\006\210&C\265\233\225(\374M\033%\361;\t\253"
+	.ascii	"\335DR\267a?\360\225\344\033@\3743;\355\323\204\242b0\016\235"
+	.ascii	"\"I\354\025\233m\022P\241\340[Rg\230\ts\347]\325\356,\235\306"
+	.ascii	"\354Vp .w3*\023\271\220\353\270m\252RGG\347I\227\266f0a\347\300"
+	.ascii	"\326\263>C\032\004q\210@}\032\342\f\242\207\333G\356\002k\230"
+	.ascii	"}=[4`\200\2334f\301q+\361\351y\020\252\347\305\222?\232\2215"
+	.ascii	"e@\317\013\235\202\201\302\221\225\215rW\300Q|\214py\341\205"
+	.ascii	"ZL\366\030/;\270?\243\326nh\017F\206\243\347\243\243\363O[c\026"
+	.ascii	"-\345\301\025\303(\222\022,w7\313\013w\341\273\232w\352\320\301"
+	.ascii	"\251\202\207\016@\027\353\273\364\017IFP\335$H\345\024\275GR"
+	.ascii	"\331v\230\202~\336\212\375qA_\322\017\313X\305\005C\t\210\330"
+	.ascii	"\274;\316\272\355\355\021\246!U\027\"2zGC6+i\340{\207\2759\365"
+	.ascii	"\235\250\272\005\204\270\026DU#\263\007\330_\025\034\377\201"
+	.ascii	"Zc\322R\032\212\350V\321\363\336\"\311K8\bw\210\272\311\f\236"
+	.ascii	")!\356\017\271a\327F\356l\004\217\221\255Xdx\352H\221^\255U$"
+	.ascii	"\276\344\212\337\215\003\320\214\251-\007\021\253q\31329s\345"
+	.ascii	"V\311.\322\311O\314JG\325>4\204\214\224\354\337\024\326c\303"
+	.ascii	"\305\220\021"
+	.string	"x\304\331\200@\325\364\324X7\300\2506\301iEr\300\354\204\006\b\303m\2737\b6\205\200\016\234\327\204\201\320\\\202T\305 1\023\276upx\262X\203p\260\217\355\234zJ\006\344\226\200bJ\247\241\351l\363\246\235[\t\260\201\016\271K\350\n\343^\366\314\013\217\234\313\314\300\357\024\222$\271\261\030.\312\002%\340D[\322\370\007C6\366m\352%\363*\307\241\311\371W\177\231\255:\0330x\365s\334i\341\3228\255\002\204\036\333\256\271\020\211K\205\217ZJ\\\004\034\001\243p\004\0178\217-\245\221iJ\364r\246\267\202\242\252\241M\266\204Z%rY\023\372\250\215\322\350\305\200\220\2450\320\006\263\262\323\362C\033\215|\005e\323\035\007\210\364\301*@i\246Ho|\023\275I\205c1\0340\203\346 `\007\351\304n\022\336k\354\364f\\\212\214\026\276d\235D\310\026\017\261\262\335\020\004\033\361\227a\217"
+	.string	"\016\023\017\005\357\226\320\264\212\214\346\030\341\314\313yn\334\317\332\246W\226\274\276\334`\001X\355\265Vz\027&\033\253\037\021\205J\340j\225Z\211\253\334\233\334P-\031d\325\203>\b\254,\347\236\354rn\272\006\203\227\205\362w\253"
+	.ascii	"Ij\275F&\005i\255rE\3715H\003c\254\340Fp[\346uz\206\350\226V"
+	.ascii	"\032\312\332\bZ\272\347\036"
+	.string	"\342\244'\273CQ\013\353=\243'\007M\027]\003p\257!L\t\334o\356\357\n\247\224\236\fF\2443\214\027:\341\025v&U\204\036\023\213\376a\321\020d\224a!\213\030\274Qn\212$\206\231\375\025\032\224S\031z\367\032Y7\266\250\037\201\025\213\227\300Tvf\3004WU\225\035\017\376\224\270(7\236|\354\355p-\336\310B\312\216\t\034\354\272\307\342\212n\223I*\002\204\226R~o\241\224ID\360\326^\016\355\277\317\230\311}\b\202B\264&\003\273\274\360\223(\003 \n\002Z7\276&m\b'\022\350\301\260\031C@\t\235\366\2402[P\002d\262\r\351g_h4e\274\274\007\024h\t\304\210\036)`\tq\271\374\2165\023\244\300P\215\224\323\303+\333\371\005jj\332\350\257\343\344<\354S*\265q\037*D\302T~6}vn\021\177[;[\373f\006\001\243\2732\257\356\302\177\347\306\242P"
+	.string	"\347\324\233\241\317\227\022+\375'\371.\237\261}\303a"
+	.string	"\262\220\340\177Y\215\233\361\330\322U\224\353\223\265M|\376\352\235\240t\373\235G:\250\223C\210\301\242\025\310\013Q\207\322tl)6GC?\025\345\247\231\347\"|PG\275\2521\006"
+	.ascii	"p\346\272\024\345\252\0335M\313S\035\313\361G`\254\246h\220r"
+	.ascii	"\354\020\037-\344)3\007\211\236%\030|\255&\267\357tb\rn\245\367"
+	.ascii	"(\331E\032\277\230H\325\3712\033\375(J\322\211?S:~\033\207\230"
+	.ascii	"PJ\276=\323pF\200\364\027\f\034!\232c\342\214\361X\b\255q\036"
+	.ascii	"\231JY\304\005Tq\334F\370<\177.\352\003V\002\345\213\340\032"
+	.ascii	"D\276]\213\321VV\245z\227\353cd\023\240cU\311\305s\310\317\247"
+	.ascii	"\202\370\202d\211\200gL\232$j\266\243\247D\215`y\300e\225\341"
+	.ascii	"\337^\f;\204>\345\300/(\r\347<m\302\376\t\242\025\267\303$\027"
+	.ascii	"KJZ1\264\031A\240\2643\320\310\265\320\030\021\247\017A\t\371"
+	.ascii	"k\363\217_g\256g\027\272\262\247\257\305J/\006\005\253\036\352"
+	.ascii	"\210\002\271\303\270\023\342H\250\344\fvaFh\351\3315M\350\241"
+	.ascii	"\311\b\263\246\275\313\3166\375\201\210\365\324\036-;\017;T\213"
+	.ascii	"|\f\252\235\0317\227\321\252<\022\326"
+	.string	"\224C\262T\312\177\234\246\367=\312\376\217\255|\311)6bT\361\316\242\234\357\341\224\323\341\377R\f\262\276\262:Q\020\367\230\356\2025\256\272\203(\255\237`\251\026p\017H^\257*\371*o\226\205\007\343\276\006A%MV\013N\343\301/o\256W|\244\3530\315t\007b5\267\004=\024\240\n\252\233!\323\\{\347]\207d\274\033&\031\\PN\302\214:K\245SX\201\341,\237\332\022\215\177\352\303R+\210\243\316P\203\343AB;OHm\216\340\272\2438\212kL\231B\246E\335\235\264\250\006\231\330:\373()\350\037|\344\257\354\323\237\024{\214\b\371\331\260\002\305v\037\026\211\236\2038w\0317$g\372I|\027MP\255\0138\304\365l<aF\037\312\203td$7C\242\341\214\271\363G\tj.\204\254\371\314l\251\300\300<"
+	.string	"\314\210\313\177\354\231E\322\274sP.1g\364\036\277\371n\220'2\276\253\360\006K:\232z\314)0lA\261*\232|!\275\2529\325\322\024\245\b\373\233X\373\350#SZ\376\377\244\300\227\315\276\204\261 P\b\266\216\200*\225\271Y\026\001\036\327\207\326k\330\245\305\210\231\021\367G\200\\\345)Lx\340YtM\206b\037q\243\\!`\354z\241\260\"\257\020L\326\301\211;\3104X\232+TYB \335\273\024H\275\360\006\305\375\007\323tC\316\037\366\356T\327\344UJ\022\360\230\323\320\300\327d\242\306\"\"v\017\"\247\200\357\236Lr\252G\363\025&}\351\001\355"
+	.string	"\245\002\020\221\231\\\333\223\334\240\244[#A7\204\362}\217\244D\320(k\374\350\341B\303\371A\033\222m\373\252\371\241\025!\361\363\216\3518\204\250Y\214T\310h)S\256\177\037J\025\004~'\024\016\277\020]\262f\236\224\252q\340\b\225\340\324jG@.\305\2675\203\b\271\376\377\325[\006\327\203\037@jB\034\330\230\322\341\t?\233\\Q\343\202\013\377@\022\305\231\267\216E\006\323W\316\356\016(`\177\325\033(}\312\01740\222,+\330\313\355\332\272\006o\242\036\373\221\311c\001\250Hz:\254\374\017\242\037\313\364"
+	.string	"\307\241\310\331F\202\026v\304\356\216\254I\332\364u\242\033\221\023\340\036\007\364\324\265\251?Y\227\267\263<\214n+PbM\177(\261\212\301p4\245\327\335\304\370!s\005\352\247\224\\\300\303W\0375kp\216qV\227\335\027za\025\245\376\212\006\355\252\201n\021>\372\356\3332X\240\240\363 5U`1\034\365\234(\232\037I7\354#\351g\026n\323\"\361\373\324\331C\211\342\2014[\314\365H\n}\257\217\340)\330d\212q\357\235"
+	.ascii	"\177\301\304A\256\207L\343@\030\330w}7\260\ts\007x\312\206\315"
+	.ascii	"\326N\213\333_T:\274\264\350\013\270\276\033?\030s\376ai4\026"
+	.ascii	"\370\265\324\304 \332Uu\277\300p7\277\261\324\025\364\035\022"
+	.ascii	"V\210\fH\023/\221\263\347\352\026\312\207\222\372\236\363&\255"
+	.ascii	"N9\021\361\271d\337\220KlQ/\300v\332\240\352\242]J\315\033fb"
+	.ascii	"%v\352\277\251/3\275\363[\334\021\364g\026\311\355\227\232e\366"
+	.ascii	"/[\221\017\250\342}\373\237\362\303\2320\232\375\177\226\223"
+	.string	"\353KG\217q}\\#\"\n\342`o\200\223CX\350\025\346\231\243\311\317O\024\237\357p(3\016\263\034\354\024\304\370\343s\b2\325]x@\340\200s\205\257\207l\306\231\303n\270\0032\215\376c\351\312\025\325>\204k[q\375\252~\260PL05#\214Q\247K^\345\344\242\303\334\275y\337e\314\016n\\\030\3360\252\001\254$;[\355\206\242s\227b\275\001\021\344\271\200\301\214\021\320\300A\334\022\033s@TM\302Ht\235\330\257\326+(\217C\221\262\032\2623'6\376b\257.\200\301\207\226\227\272\250\\\372.l\374\236b\312\251\252\177\370\002KF[\234\225)\262\201\354@\250`\021\330g\253\263Ys$2\237\330\031\006\364)\177\304l\303\013\363\250\242\003\376\360\203NI\221\261\236\203\317{7LO\301\030Q\302i\313\336\020\307\250\325\f\334\232\001I\310\236\305\303\023\303\300\301\371\323\275\271?\033\231"
+	.string	"\251\276\324\277\rPl\372\374Z\213l\260\344\017C\200W\221bW\262,\\E\306,>\002\200\300\245\245\032\212\n\330\376\214q\267\373\013"
+	.string	"\027\022\275"
+	.ascii	"\356T\355\333\266\n\312]\276\302Jh\006\333\212i\335*\220az_K"
+	.ascii	"\300\253*i\024\264\rm\203\233\212fIBm\3019RX\212\211Y4\232]\222"
+	.ascii	"0\2279`F\237U\370\222)I\334{\030\202\270\360'\356\025Q#\241\363"
+	.ascii	"Rb!e3\206B\246\337\357!\3374\343\257e\332y\353\243\305\320 \214"
+	.ascii	"\247U:\300\317$\224H\230\224\007l\304!3s\320\333x\327\3720NN"
+	.ascii	"\340\266\302\326_\037?b\271\347\202\274\324\006\356\354u\376"
+	.ascii	"\315\n\2524gk\255\037\362\257\203\312\250\243\376J-\316`EJt\f"
+	.ascii	"b\216\333\202gT\323\024\013\031\256MSU\250\277\311\311<c[\251"
+	.ascii	"\324!\030\021\335\016\\\002L,`\314\276\034\224\267\327\335\312"
+	.ascii	"\355\031\274y1.\325\355\266\306\007Z\036\230#\314*\0163\310\354"
+	.ascii	"\211\316\340\264\350\rG\251I(\357\336\370\3717\211\251W\030\253"
+	.ascii	"B\325x\211@\013\271M&\267\375\245\333g\360Wx\222\370\312\362"
+	.ascii	"w"
+	.string	"y\n\314\234j\020\202R\257\271\234nu\t_\310\020\310{\006V\222m\360)Y\337\360>\324e\233|\020\\\237F\204|G\223M6r\311\001BC\t-\2352\032\235<\251y\200\\\002[\243LT\363\204\374fa\274\255\366]\021\213\264\r\361X|{NR\203\216X\001;\b\007t\272a\213\231\327Y\245\023\257\237Q\265.\035\221\034\222J/\301\036N }]\350`\024\211\366#\264\f\366$\016\034\200S\340\373\261\371\016u\254[\335R6\\1B\317\201\276i\342\001\004\257\324\312\326\364\342\355\251\314/\2654\211v\265\213\344zB\267\272[\036C\303\314@\324\341y\002\320\305\366:X\266\377\264\246\t|:<\023\340]\361(\340s\262\337\304y5u\032\204\2257\265\223\035\364BG\371\235\357\247\r(\304&\005glb\236\361\266D\366\333\007t\260e+\312\327\205\306\343\313\200kk\354\310\315\376.F"
+	.string	"\001\300\246\206J\274Aa\017PZ\"\226[I\204\221\r0\3017\260s0\214}\203\307\020\b\212\273\346\271\366\354\0073>\373Z:\365\370\023\305\261v\021D\350t\301\3152\004\236O/\260\rO\203\245!q\305\214\264\224\304<3dYt[P$s\331\352U\261\360>B?\210r\364\374n;]s\260\341\025\204\317\306b\265\363\243@\212\361\343n\273\031\003="
+	.ascii	"\221\263\004\365*\035\362\265\355\261N\316\302\254\235+F1\212"
+	.ascii	"\335\027\243\313\215\013\247v\377\032\177O\322\036\302)+\023"
+	.ascii	"\035\265\310p\333\263\377\f\025[\341eq\021\\!\200\323\360\331"
+	.ascii	"\331\223\211:\356\353s\223\331f\035h\3542\331\261\335p5\300\r"
+	.ascii	"\204\023\025\376N)oL\232h\2038\270;\0319\216m\274ou\261\253;"
+	.ascii	"4U\236\310\327\n\227rN(?!\214\t\324\036\345\276F\263I\374a\265"
+	.ascii	"\277\376jg\373\3509\2207=\306+\363;}\fx\222\371\240\236\264\237"
+	.ascii	"\277\036\362`\331\304\250\024\177-c\235\272\207D\027\022\221"
+	.ascii	"I\326\"\363\353\203vK\253\026\303\224\254\300\350\212\273f\035"
+	.ascii	"uL"
+	.string	"qU\231T\314\367H\213\362l^\260\340\260M\b\344\3060{\277\274\220\3526\317P\324\326\3031\262\357\3559"
+	.string	"\373\276q\357\271\tS\350\204\033Nw\324\026w\177\206'\237\232\305\017~\253\360\312\332\260\205\326hZ\333\027:4\243\206=\2064C\335\377\017\230\273:|\327\200\202:\b\225J\271Z\244\312\3300\265\034\376Ou\004\247(6&*.\323\006\202\363=a\032\205\036:S\\\004\203\221\352q\027\207\020\352\n\206\255\342\353\267\324\315\364\367\374\337\302OI\271\354\037\277\021_\027K\364\3067P\203\016k:\376\032\261\306"
+	.string	"r\356\265\244\r\b\264P\206\33166\317s3\201:\376Gj\230c\223R9'$\f\227T7Z(@A\035p\237q\024X\270\337&Z\033s\344L\237Q\367\307\006\021'\203\300\225\300T\330\317\354H\314\\]\316\204W\021n&\376\3348y\366\230^F\325\241\375\177\317\360\375\364\352\366\365\345\017`\307\250~5\243\226\247\336\363\261\355\267\231\313\234D\357\362K\007\362\023\261\201\023\356\210-\260\260\360\323\034\320\241O\016\022R\301\225\324@\207`\232\373q\340\301\271A\364\222\321KS\340\274\250\342\\\352s\347\\\365\261\267\234z\006.\211,\205"
+	.string	"h\237\314!y\337\020\305$\3700\256\352\255\031\335:\274\be\247\301\361a\350h\253L\326eN\210\025\020\324\016A#\213\367\231\352\301\354\2500\243\256\247\f\206\3633\265R<}/i\035Q\354NZ~\313a\027p\340\353\304"
+	.string	"[z\211\370^f\247*\262O\206\216P\332\027\342\251\370\277\003\2678A\265R\322\212\317\\u\252m\216|\221*\225\\\244}#\332\320\326\006\247S|\337\ffKh~\215\234(\340\327\376Z\252k\324a\036\030\251\335j\\\254\254\032\250\327\026\301\346\350Na\023\002W\022\351\247|f\214\365nK\245`\214\305j\2422\245Jd\020)\"\314~\214c\275"
+	.string	"\373V\327\241\2147\020\215\020\262+\007\247N\t\343wTU7\240\021\225\232\215<\352\024\376\002\037\333\201\216.\306\307[g\362\0056\373\244\243&r\363ag\204u\t\301\035[\263g\036"
+	.string	"\034\354\016l\222\023\033\340\241\022\314)\376\266\261#\211\251\257\222"
+	.string	"\374\262\346\3719<\312vW2\333\030\351CT\342\366\267\232\233\235\371|`\262Z\337K}/\036J\371Z6\027\034\207\274"
+	.string	"\022\251Y\2645\344/\007[B\273\332m\006h\375\035\206sj!\n\237\207\2102g"
+	.ascii	"\027\236\350\331\013/2\002\261\360w\006\265\020\233\030\035E"
+	.ascii	"\223s\257\314\271\260\234\351\252\303a\361M\231B/\303\"\320\372"
+	.ascii	"\350K\f#\2569\334M\303\203 2\033\025\216r\2616,\030\027\253!"
+	.ascii	"\241\264\200\300R\177\2156A\345y\301\303#D\201D'K,\216F@P\366"
+	.ascii	"\212\202\272\b\211\036P\b\204\177\211\201\020,\342\202\347\374"
+	.ascii	"\243\231jb\346\332:p\016\t\331\t\3145\2269*L\304\241\263\356"
+	.ascii	"p\272\277\320\353\252y\003\351\223\377\371\210\317\264\207\330"
+	.ascii	"U\005\362\325K\276\275\255D\203Y.\"\317U0\300<\020\005\334 \234"
+	.ascii	"\250V,\203Zb\321\354\327\276\264\211\321\341\"\024\352\301C\360"
+	.ascii	"\346\364\273\177B>\017mA\376K\242\355\377\225\"\221\323\274\211"
+	.string	"\320\215\341\240$\342\270}\230\320\266H\270\267l\250b\005\344\003\221\200\216;\361\261\201\023D\333C,\003\026\351\226\213-^W\3266*IX'\336\222\351\266\310t$\266\365\t\346#\253FC\320\270\030\242\3548\204^\031\244\363\237\224*^6Bk\031\242\t\243\242\316)\305\204\022Q$\213\346\370\235\326\212\002J C\302\244i\324\303\177\2228\316\2537h\355\317_\330\340\351\322\370\236\232C\254\300o]\272\257\344\251\271\030\250R9\bn\301\313\322T\rt\004@\300\3320\367\031\327\374\b\030/0A\344b\037\255&=Y\241\234A\300D\212#\f\214j\002\374E\342\257\373/\251\243&\033`\214\231\264\203L\004+\261\250~\271\345\263\331r^#|x\367,W,\254\236\037y\277X<\252v\314\371y\301\335\215p\250\373et\360R\363\004\225\320\335c\206\3713\254\215DQ^w\350\213\037\277\r|Wz"
+	.string	"\230z{\324BZ\206\271\336>!p\241\252\213P'\252d`8\335w\202\324\327\023\202\260N\t\346\027eJ\361$\220#2ex$\370\225<\325\305H\352}\336\211\376\b\004\242\237c\261]S\0321\242'rs\222\324\203\001\r\316N\247:m\241\370CF\335_W3\023\267\006|\336\265DG\357-\240E\316\241\274MN\202\255*\374\2513\354:\0243\344\377\026l\246\260\233x\321\267\262\322\215)5\026zy\025\2076C\331\300\337\2150H\027'l\204"
+	.string	"zfp/\036\210\367%\254\232\"\001\320\361\326='-&\031#\201e\252\301rc\b"
+	.string	"^\332g\265\007\275N9\371C\375\2516O\250\303u4\302\211\003B\177zp\244\234g\371GO\376\347EN\002U$\372.\312Y\375\341\006A\022M\214\373\227\006\221\301h@\330N[\341\022\020\347\215\327\250\212/\3579uWF\225\375\021\020\232AC\341r\024 \211\332_\256\022\361\262\335R%l\013\037\367\246\362\303-\027|@Q\275\024 \0323\200id"
+	.ascii	"\353\211\332\232,\r\367\005\245\372\354wo\316\f75sz\256\021!"
+	.ascii	"\005\310@3\242=\325\272\034r\365\262\231c\351\224Z\b\311(7\036"
+	.ascii	":\004\264 f\300(\247\030\320^oN#\266\231>`\267\233AS\254|u\255"
+	.ascii	"\357\225]~J\"\335oWn\302\341\r[\264#H\360dX<Q\366*\351b\270\005"
+	.ascii	"I\265\332F\325vb\343\302Q\263yw\302\360f\346!\247\342\266TBV"
+	.ascii	"n"
+	.string	"t\3425t%\257\350\205+S9w\255\340\365X\217\212>\272B\222\017X\2226d\340\245\257\341\024\245\033[\3334O\351\202*W\"\375\247\017\363\371\331\034\272\350\241$\343\222>'G\032\325\244\227t\352}t\3519\207T\344H\277\251\362\231\314=\307\337\356\245\215\260\316F\375\222\274l\315XD<\203\336\220\301[{\267\206O\216\247\256s\0041\372\216\026\273J\332#\242Y\330\252>\275\376\036\343D\272<eh($48J\001Is%%\326ZNG\341e\033)\234\352.\034H\243\200/\343,w\254\346\301\004\261\270#\266\223\005x\2641\005\021\n^k\204\200\207\270\001\232\315\342\037E\245\037\232\314\"f\305\314|D\240bq\340\017\212|z\356\234\273p%\320\030[\303\034D\335\036+\344\204S\003\257\341\225\001/J\250\347\r\020\213}vY\350y\325\n5\034\262\037\034w\0330\007\2214nN\365"
+	.ascii	"V\374\037\322\253\262\007\234#\241xg\222\337\003Y\341\317W\334"
+	.ascii	"FPA\276W\366\214\226\200L\006\356\bw\243\322\216\366 \203\032"
+	.ascii	"4\035X\300\3475\321\215\241r_4\025\342\205\022\234\210\365\025"
+	.ascii	"\201\251U\271E\314yT\264aN\344\300y\t\335\227\317\275\333\206"
+	.ascii	"y\3326>\031Y\245]G\232b\371\273`yg\237%\335\247\346\005\2350"
+	.ascii	"\020B\302\007\031\362\355\211U\301\245hE\b\305B\n\343\036a0\260"
+	.ascii	"\3270\245I\221\271\027\341?1\214\0326\205\331\255\025*H\243\275"
+	.ascii	"0{\362\247\201H\256\234pM\034o6\371\307z`\211\332\201@\026\026"
+	.ascii	"0<\311\322\272\3179\222\275\233,W\345\205&\203D\024\256\372"
+	.string	"\202\250\344>\373#\341~\336\322\354p\271\355\354\311b\243\304\237\300\025\345\\\223\250'6\372\027\347t\022\347\013\242\306\343\341\332\2444\350-\246B\334\005\372m0\345\262\340\017\t\276\250)\004\352\303\025\330\250\0238oV,\212\006\202\035\274Z\3542Q=\3069`\246\210\207-\252/\036\224\310"
+	.string	"\344\373\256\274\305c\363\211\376\326\202\330R8\232~\303\271\027\3453\224\215!Zo\351\2728{\2479C\005t\347\252+u\336M\247\223W4B\024\237\241\371|2\203\325\262\205\203\306jQ\233s6\325%\273N\376b\366\023\362\324\022J\202\007\b:KKp\021\372\311\bg\251\033\036^\333\312\245\205r\225H\016\321Uu\030\214\023\025\355\020U2\254\211\002\250\215\367%\227\276\276\3155\336\021K2nw\026P\211\037\332\007\205\207-\205\266\2300\205\276\235\226u\373\026j\247,_\022.\035,:\361\350\303\246\340\232\305[3\372\022\034\017"
+	.string	"`$l5Z\334i\221\362Z\221\351\016\005\021\204\fp6,\b\2452\224\334W\270\220\367\205\357\230\201[K\353\2174\331z\024\023\263-\035QU\252m\331,\377\346\210l\232\377\331\236\203pN\022\212X\320\363Eqd\265\022\376\350\356\237\344J\240\254\326\351\244\327"
+	.string	"\031\372\236\002\342[6\245\241+VO\002v?\017K\206@\032\f\262P\234@\034\243\231\032\242\316Z\311\004mq\267f*\224\262\314\031\367W\277I4\350\227\312\327<\202\201\272\236\247\257\244\266\2421\374\336z\t}\2334[\214\004\356\253\251\271F\333\254E\224\021\3078\350X\215\201\035\275\206\340\203\321\242W{*\241Ym\353u\016Q,?\013\224\b9\367\243$di\224\250\306{\225|#_\203\336\335L\353M\021f\375\223\\\352\2037\352\202#\360\013\331\200\023\354\374@}\345\3365\243n`)H\261\253\021\207\214\025\236P(\250@\r\016\274@\202i\304y\001\0252ma\347"
+	.ascii	"T\355\227\031\314\271v\232\207\021/iq1\033\234\250~E\"\236L\333"
+	.ascii	"\374\006(\205\022 \220\361\016-\264p\323\361\232k\017\275/\226"
+	.ascii	"\007C\332\3468\241U\364Q{\220\\p(\360N2X\240\004\255\001]\247"
+	.ascii	"w+\206\246'3F\216\003\213\206|\257\030\377\371K\275\374\331e"
+	.ascii	"\340x\216If\207\2265\336\334\004\037!{\307\336\302-\367bM\007"
+	.ascii	"H\340\030&\313\rQ#e\353~\212\320\265e\004\247'\352\314\216\263"
+	.ascii	"\246\030\346Y\021\372I\007i\231Q2t{\376:a\n\277PS\262\364Uoy"
+	.ascii	"\304\220\306>{\266\351\320*\n\230yO\277\266\223\210gRPN\232\207"
+	.ascii	"\215\226Yf \213F\317#\0059tC\306\315\017\324\253m\202\253\261"
+	.ascii	"\205\250\320\240\353\211i\204\013Y"
+	.string	"\341S\262\365#\t`\360\340\f\016%K\357\316\023\225\022%\272\202\367c\206[v\361\210SuE'\311a\017\212\334\373\246s\213T!\021\217t\201\301\006\n\213\267\021/\2516\r\341\271\004\352@0\304\202H\275\031E\373H!\274\0355B\375\004F\223@:ik\374L\036\n\243\301\202r,\377w\366%\364\351yR\376\224\t$\004Z\214\034\001\"\021\2323\270a\261\377\b\327\034\227\263\270\016\266\357\177\3449\353B[\035\236\222\020\345\255Z^]\235g\342\221\353p\224f\211j\022\244\234\364\240f\r\300\277\233j(\310~g8M]d\013\343j  \324\264-\221\315vy\306XA\003:\247\207\245C\004$\237\227\210T\370\031\251\266q\242\376~\302\225j\303\262\304\355\366\211\235j\263{)\220[E\307\222kV[\232_\201\2333\313[k\224>H\022vj\003N\312d\231\301M\345.u\244\223\247\210"
+	.ascii	"\035\234\265\353\306\237PE\252\225\260;u\263-F\211\241\201+\236"
+	.ascii	"J\326\266\2452\271A\3156x\261\\\177\347\002Tb\026\030\234\017"
+	.ascii	"~\253-Um=%_\276\252y\335\270\220\265D\365Q\236R\346\255\312p"
+	.ascii	"\004\024C\006\372\036<r\006\302\263&x\310\324\n%*\270\360\333"
+	.ascii	"\302Xe\b\214\367\330\263[\023\035[9\307\356\2628+\270!h\032{"
+	.ascii	"ms\344F\260\004\256ig\224\342\305\330\274\270e#\357\360\267\362"
+	.ascii	"`\022\273I\357XjC\221\214\351\231\2623j+5a\016=\017\033\0030"
+	.ascii	"rz\334"
+	.string	"\\\033\230P\250,Q[\265\323-6e\255]\030\272\227\355\024\375\001\f\217\234 s\367\232\325]\336A\226*v&\302\036\323\037~\201l\344?\b\236\236\353\0304)\222\260\"a\237hum\022\321\300\366\261\317\344\362\371p\250\350!\t\377u\343\313m\303\340I\2460\221\205M\265\376\276L\027\2726\337\242\305c\322\245\246\214,.\357f\273?\023\356d\032L\210/f\225x\206zL\230\333\003\251\232.\\\177w,G\371_]\003\221|-\210\306\353\207q\bAxY\353?\017\276\351\201\267\352\251\006\025\"\303\371\205\345\237\340j\317\017\203,\222\311\361\337\t\373\233\036J\313}\322\255\306z#SR\3776?\215>\301\016\230\r(\363\034\034\300\250\236&T<#)\210\007E\376\227,\235\254\255\262;t\002x\361\332\bi\364\022M\310\266\005\202-o\355\315\220}\234\314\210\373\317!\374\330\300\005m\261\214f"
+	.string	"w}#4\317\002c\241\001*H\277 \177(\337\236YF\302\344:\217\2228\354\340A\330\223\251!\314(\007\232\003fY\205\356\001r\341\262\022'\253p\215\303\035G\224|i\234\n]\230\024\r\254\377\316\005\370\243\266\235\344\372"
+	.string	"\200\255w\203\003\367\244Sq\f\2751\335\323\320\357{E\354t\225\301\323YG\242\337\241\353\2667k\\P\234\334\306\215D\217{\033u\024-E\006`I\031\023y\246\377s@\325\203\325\367\370P\245\325h\031\214\301\270\005\322\027\317H\310\220\330\022\355\240\243\tq\304\027<\203\346\261\321 J=\206\222\312bT\243\310\332\f\307~/\301\355w\226\230\264\354w!\230\306D\375\332\215\033\377\222ih\211\306\354\267b\317P:kE+\362\210J\rv\335\2051\334\361\303/\235@\273\333|\202L\217U\371\303\324]S\266!\216\213\302!\336\220KW\377\267!1\202\033\336\371"
+	.string	"_\303\023\302=\227\226\274'U\205,\323\262\240Z=\034_\203\031\021/\366(\n|\356gt5\311L\264\366w\006\233\356\031\345\354\031\220@\223Cn\236\r,/\2560\"\242\0179\250y\3400 z\364\204\33601\225\321\257kW(0\237W\205D\306\013z\304\304\n\305O3\321\334C\334|@\335+\005P4\347@]\031.Z#\310%a\226\311_\032\035T\322\356a`\211#t\236\022(\342\327\"\336\243\030S\206\206|\275\350\364T2\031\325\226\036\211\225\251t`\246GN@\001\334\251\224\226\231\322\242D\270\336\332i\"\364U^\375;\300\200\324\347\\\3600"
+	.ascii	"^/K\356/\215P\005IU\260\021a\f\034\033n\r.\336\271\004gW\213"
+	.ascii	"@S\206Z\311\277,g\342 P\366\377\n\022\223\306`K>\314\305\247"
+	.ascii	"k\301,!\020Ik\022o\373\312\2112\f\304\023\343\3563\233\267d\037"
+	.ascii	"5\276\330\337`\325A(\032\031h\300\364\342r\035\030&\013\255>"
+	.ascii	"\307\311\267\002\364\230v\001\024\250\321\303Y.\325\277\246 "
+	.ascii	"\361\006\272\b\003\225\025T\275\320\300\377|\267O\263!\2700\241"
+	.ascii	"\322\b\273\277q\004\270Q\341\034\320\230x\245P\313"
+	.string	"\347\355n\333\374\232\242\300Yf\210\302\025\263\377\212\tI\260/|4\323\275\313\343\250\320F\331\322-\334\305t\222\354\220\221Z~!\200]a\0038\005\320v \331k-\r\372\312\242\n\r\360\235j({\212\340w\213\304mk\217d\277\317 \261)\230xq\003^'SBW\006Q0\223Y\263m\361\357)\237h\234b"
+	.string	"\001-\025\201\274\202\223\227\212\005\247\301#\f\307\376n\3110\221u\363n\250F\030\202\236\244\250\304\245\031\247F\247\357\243Z\316\356\300u\2466\223\233\006}\334\313\021\020~P)\335\252F\365\272^\225pOP\037M\327\252\"\264\211\323L\005\220\264\300X\007N\211\260;jn\360\310\001\2224\352\030\t\0247J\243[\261F4*\235\261\250\210cH\227\006[\327p\325\021\265\347\002\245\350\364\006\254\303\331\315\305\264\026F\200\216\273~\021\247\240\2706\244\345\360\373\225w\032SQ\037\353\rM\347"
+	.string	"\300?Uq!a\333\235\211$_\304lt+\247\333\035\036W.\214_\310SY\244\033\256\2302\241\345L\317f\"7\245N4\311\216\340\360\352J\346\2539\013\244\227\213\366="
+	.string	"P\017v\017\016\230~\276\364b\031[+\rF\001&\214\366X\020R\273Qq\364\266\235\361a \325d%\313\307\356\346\334\376\034\335\003\224&\365\263m\302,e\366\016B\324\352\200\203\320\211\"0\021\3419\\\35014~\017\030d\037:\313<\364?BP\322n\341\321\356\230(\204u\367\177\314\322\236$\006$\025[\312pM\371UJ\020\367\310\365_\260\217ye\345i0J\340\026\tT\374\323UGE\313\307\335S\2302U\260\027\361q\332#@\331\220'\227\272\305\325\217\236\3534\205\257\330_ W"
+	.string	"\226\275\352\340\026"
+	.string	"\340\371\264>\265\326\215z+\351#\203\032\365m\335"
+	.string	"\322+\307\242<cc\204\376\206/\236\263\177\327\372\340\352\324\271\301o7H}\267\257\273{S\2440\235\365\334\240\f}\231$\346\274\335\2001x\257\221\364\302\tS>\212Nw\353\204\260|\036!"
+	.string	"\373>\033\021\357\257\220\204\005\351\240\307\352\371\226\302\226\026i\225d:J\257r\370\"\224\3255^j\030\222h\236\210\367\3727\235\237k\b6[\355\371\3124\230\256m$\264\366\256OuX\300\255\323\351\201aj\334\337P\214~f\330\237\006\307kz6e\363\340\263\371\270)\f*K<\253/\363\007\251*,\217R\342\203#\360\027/\315\321k\361H\355\013]\003R\030m\t\017pJ\005t7\252\213\320e)\323i\341\222Mo8\243\\\007=\257\2208v\004\265\236[\375.\266\220T\2168\266Q\255bR\360\3438\220j&\016\231\fg\374\256\0361\306\370\365&\307x\336\255u\201\321\340\034\255\357\367\034\220\232\352v\013\027\233#a\314\035\216\236\036F\001L!\315\241#\252\237H\212]\307\341\006\030e\304\307\221X\203\236\305|*\031\030\351\241\340 \244+\002\357$7\321\307mv1\316\263\204"
+	.string	"\356\333\263 pD\002+{p!{\340\027\362\223\3750X\273\215\236\201\311\013\003\2738\033eH\3236\\\026.X\212\363$Q\t9n\364\217Q\346\302\235AU\325 \305y\007H\215\203(\374\b\246\004\211\346\234p\020\035Z\244\207\246\021K\253\034t\265oA\213\361\253\277\023\334tV\343\302\245\213n\236l_#\244\263\214=\2233\r\333\003\036\002\265\275CQ\3310\021\303\233\252\371F\342*s\313}\254^\223\343\2307..E1\231\026\202\223\021b\332\364\345"
+	.string	"\234\350\b\301c\211V\003\320\367R\364\230r_\250\266\016\333p\024t\024\035z2\242\237\"\213\254\021~\027\214P\202\366L\003n%"
+	.string	"\216"
+	.ascii	"\013\340_\022\272\301\240\345.\007\364\204c\035*\324p\331\202"
+	.ascii	"\220\362\004\323\211\022\303\371C\032y\370r$4\211\246\032\356"
+	.ascii	"\367\203\032[\350/c\203P\270v{Y\022\360E8\326\240\331O\242JN"
+	.ascii	"\215\306, \332\260\nB\277\244\244\356\024\350\f\222\277y\002"
+	.ascii	"q\375v6\026uh\341p\262\304Q\324\270\354%\313}\007\346'\\R\374"
+	.ascii	"\211a'\033\034\206\n/\331F\343|\f\r\221\201\376\213'\353\312"
+	.ascii	"s_*\022\016D\371\240\261+G>\2665\304\234\330\243\265\361\235"
+	.ascii	"\357\254[Q\030c"
+	.string	"\"Fe\231q\241Tw\003\310D\305r\347?u\354\223\r\271B2hx\374\336\344M\323\"\023`\352\b%M\221\r\320\276\236\246\201\346\352\235\321\323c\354\b{\226\304\274\313\201x7y8\002\363\354\220\035c\374\345F\306NQ_l\237\225:4bg\034We\255\327\267\246\006\207\003\264\257\263\305\357t8\037\337\310\260\374'>C\202x\330\243\216\b^\023\342\252y+\217\005\365.&\006\252\347&\356-L\276\317\305\305\b\366M\377\257\3409g`/\201\300\266\205\277\216\rC\305`|\372\257\274\376\317\240\237\035!\017\to\353\n\267\211z\252\310\257y\325\263\020]P\210\177\"~#\034]+vh\277\277\240\017C/e\367\277\251\003\377\244\022\013\246\276<\r\274\357=|y\374C\260\251\0378\344\270\327Fo\273\347\276\201r\272'\251\301\301\310\333\231\343U~:\f\362\3362\200\262]\300\353-/\322\337"
+	.string	"\006\234\232\327y\225\344"
+	.string	"8\354\360\336\330\024\365\357\307\306'\"^\355\322\226@\277\231w<c_\237\326\367h\020\346\002\347\247D\360y\376V\033 \341i\375\257G\246|\263P\177\262\374+\352ql\036\0166\264\321\232\232\315\\(\237\023\375\250\343\376\027\206\337\362\261+\304k\f\235\357\352hP|Z\212z\206\240\363 \024\233\036\205\270\333\212\365\201\325\370e\361\262<U\263\221\247\007\020\037Wn\273r\376\251h\276\324t\361V\266?\320\376\327\371\023\356\306\213\240|t\344\017\r\310S\271\177\212\362[s\377I"
+	.string	"\333@\276\260\022/\227\363y\252I\232\t\"\266\235$\332O\234vN\2607\373_O\004\231\017\244\373\247\255\373\321\362\250\310\225\336G\345!\347\272\2344\376=\355|\007f\255\022\372\225\020q\b\016xnv\276w\366\025\350M\304\031\345\374,\365\232\223a\017\324k\034\313\177\260\230k\327\327\024\344\357\204F\366!\365\230)\345\204\026\247\026\201\227\344\240A(\177\365\305M+`2\003lU\375\343 \353\265h\315\376v\201\330\311\224\2378\351\235"
+	.ascii	"\230\003_9U\274\203\b\006z\372\277\036\354j\262\204\276>Q\344"
+	.ascii	"kc,\215\362^,\2370c\374\007|\344\037\317{:\r\300\013\341\347"
+	.ascii	"\257\312?\241\324/\232\371\227\272]:r737k\375\207\332\034N\032"
+	.ascii	"ik\247p\233.\275 \372|==\372W\323\360\367\213\217M[\342\251\317"
+	.ascii	"\226\374\311;>\377_\307\332?'\263\370\321c\216}=\315\321\377"
+	.ascii	"?\363^e\344\350\"\177\315\372\2771Q\247@\320)\006\317\023kq4"
+	.ascii	"\352\377s\302\037\235\226W\311wD\023\377\246\206\317\024\207"
+	.ascii	"m\222+\222Kr\347qS87\227n\213Y\273\b\207\255\336\313}\276\005"
+	.ascii	"K\206y\241\312\021\032\3173\354?\206\nG\3778\2218:\304\033\353"
+	.ascii	"\354\365\237\037\2372\007.\217\016\365\340\230^\362i\275\275"
+	.ascii	"\251\376'\246=B\302k?\317\007\325\214\375\243\263A\273$\377\311"
+	.ascii	"\223\355|V\377\rL\253\240\365\234Q\265\200@8\230/:\1774>\"F\\"
+	.ascii	"D\227\362\207!u\357\255\305\204q\373\005\363\343\0139"
+	.string	"\264\312\204\251z\352\211\213\202\336\260\367\0360x\020\035\342\035\370\267x\025N\200=\312\t\245\352\2571gIn\206\0255\027t#\f\327\023p_$~\300\351\277\241\311\201\3751s\315Y,\317{\357b\216\345\202\354\325\233-qZ\362\013\300\316e\352\270\215_\242\354\035\235\037\207\032\234\344\366w\001\346\365k\026\277\177n\002y\033}\326\270\263\363\204&\016\356\226Ui\213/\373\013\251\364n\200\310\036t\372\370\357\351\202\344\250_52\350|s \037\030U\232\303\304\370\307\362\372\213P\346\rq|B\204\330\b\200\032Y\204\271\363Y\020\312\353\027\033\023K\3603\346tHH\374\035\234mLI\023\002F\340\214\314 \007\301\305w\213\256U\345\356\213x\214\312\017o\275\317E\277+\274\030\034\207G\301\273"
+	.string	"\356?"
+	.string	"\272\016\350\277\206\363G\300z\311\035\374\"$\262\306\342\207=\323\274\337\3603\277u\207\b~~\005\360\213\225\2566\264\216s\215$s\007\350\360\210T\030\b\356I$\344\2318o#O\370C\313\375M\277\207\211o\234\357\224+\345pg<@`@\r]\233jw[\303\343\0257k\331J\302\316n:sU\377\377\360\306\273\320\215D\366S\305Y(\372\314\203i\020\260\317^\350\023W9\027\177\235\202\374\376\333`\267z\311\231\030\265\200X\371\343-\336\221\272k\226c\215\325\346\f\233\026\324Xm\270\307\200/\033\340\262j\"z\234\030\311\355\220e\212\243\357\362j~\252\266~\242y#\275\030>|z\347\027\006\235o\251Mf\365\277\261\334\271\323uXL\273B%\365\024\323\213I\234,\334\373"
+	.ascii	"y\033\3571\335\242\032\301\366K\245\300\306\315\220\367!\232"
+	.ascii	"\004g\32476\347<\307\036\375L\350\007\304\347\222\210\234BM\273"
+	.ascii	"2\231\007\006\327?\231\276\211v\357\261zS\221\030#\264\347\217"
+	.ascii	"\215\352\374\264\267\233\356\316K\321\017#\324\255\276\2275\305"
+	.ascii	"\\\306%\037x\360\205\r\233A|\353}\330&\300\374{\2103@\352\016"
+	.ascii	"\364\261\317\274\035x\351\177\317|,d\346}\255`b\317b/G\2315\025"
+	.ascii	"\266\200}8\241\022\336\266\224cS}\005\311\212|\234.\177\354\344"
+	.ascii	"=nb5\020gv\277U\251\2131lJ\300Q\2046\344\365\324\327\370\322"
+	.ascii	"\343\366\233J\303:\037S>\214\207\t\260\340\244]L\310\357\340"
+	.ascii	"I]\311\340\335\214\234\f`\373\020C\314\276r=\331\354\367/^\335"
+	.ascii	"\374\331$\324\027g\277]\030I\374\237\217\347x~\236O\223\363\326"
+	.ascii	"\322n\250\tx\203#\221\3078\365+\307\261\263\330\264\276{\200"
+	.ascii	"\220\367*\324\233h\2335\261\202\030~\250u\354 g\025\337A\270"
+	.ascii	"\327fAk\236[\345\b\017\202\262\276<\215?;b{r-eu\246\216\314\323"
+	.ascii	"\322oJ\007\215\260g\007?\347\250\257\371\332*\361]\325\337\321"
+	.ascii	"\334\013\362\2607\246\352/|\352\373\b\344z-\375P\370\376.\325"
+	.ascii	"\273\3005\200\271\213!\364\353\375\363\257\261[7\337)W{\340\261"
+	.ascii	"\307\235\231\354\264\201C=3p(\276S\345l2\361c\303B#\266\037["
+	.ascii	"Y\203\313k\3450I\245\327$y\235\325*J?Gs,W\365`\364,Vw\023L=s"
+	.ascii	"\333\241\307\360\302\307\230\274\201\357\363#d\234\003\231Y\334"
+	.ascii	"\373V\317\355\232\375\316v \352\006\227\332\247_&'\365\021\206"
+	.ascii	"\271\221vF\337\330\341\277\317s\274;\264\302\347Y\327\257\325"
+	.ascii	"\037\\\376\227\366(\273z\236\370\332\272\216\332\036\242\352"
+	.ascii	"*\016\236\302\324\227x\007\372\363q\b\375\370\300K\354\306\203"
+	.ascii	"G\360\367\371\003\366\363\211\262\354b\361=\315\3767\302\374"
+	.ascii	"/\333\247b\r\017\316Zs\037\007\\>\337o\352\366\317\357o\222"
+	.string	"&\b.\344\\f\3178\240\372\377\375{\007\377\n\0132r\255\213'{\367\323\276#JLz\216\375\263x\224\330\003\362\337\023,\375\005\271\221[\263h\205\367\177?[\3637\034#\357V3V\007\202\376\254\220\033\205\352_\340\233\017!\374*\221\315\217\355\336\200\313\037\253\212~\364\260\207\366w\273\345\257\225\035\217\324e\327GC\003\204\371\202\313v=Ga\342\003\342b\337\204oU\357S\201\315\034\375\177\206\217\244\367\036\356\036\347|\335\315\3074\217\263\335X\032?\217\252\221\361L\304\346\355\020\307\257\365i\242\027\320\215\244r\210:_\236\006o\224\366\310^h\327\257\004\366/\374\334\333\317\262\037\201Y\340l\305\313\201\305a\375\r\256\213 [\374\234\2551<\331\277{\352\215\245\027\177C\366$\352\305\272\360\003\374\007\213\275\273\026N\023\327\331 \233\217\255\306;\347k\302\340ZZ\027\327\214w\tMO\361s6\240"
+	.ascii	"\035T\306\347\225\301\245\274\263+\256\233\207\"'>\314-\273\203"
+	.ascii	"\265\317\223Ym\300\">\262\r{\tp{:`\265\261\214-\242w\343\263"
+	.ascii	"\240G\n/\206\266\026\210\277\025\2300\324\240\3607#\376\002`"
+	.ascii	"\334\262\253\320\001x\370\345\002\336\202\326\377x\353N\352\034"
+	.ascii	"e\332\353#\370\213\217\210\316\372\017\313\007\251\376\304\337"
+	.ascii	"\277f\374 g\357\377\226\317\241\373+\275*\347Q\344oc\r\340\306"
+	.ascii	"\361\026\216\r\r'\033\235\265Z7#<\276cN\303E\376v\323\352\227"
+	.ascii	"\023q\301\365\373\200.{^\255\207\342\317P<\032/G\252\250W\331"
+	.ascii	"\017'\370\317\312\256W\371jp\226\207\245\037&\225\343*\363lp"
+	.ascii	"\253\340\004\353/\303\337q\213\251@\036\214x\036\006\376l}\201"
+	.ascii	"\322\215\331\347^\251\307\337\334kj\372\004\303\236v\037\347"
+	.ascii	"v\345\267\250\211VuD:(\316\177\353;\343\337\013\361\013\340\356"
+	.ascii	"\333\021\365t<\304\327\277Q\265\305?\277\360\253Vo=^\3324Za\322"
+	.ascii	"\272\340\337\372\231_\366\"\301\001\242z\333c\315\264\370P\203"
+	.ascii	"\375\357\353\306?_\205\207\r\351\203z\302\362\362L\211\335\246"
+	.ascii	"\340z\022p\250`\273\221\357D+\244\266y\377s\353W\203\3750\374"
+	.ascii	"Ab\274\023\355:\032\035\201\361\027\370\017@\313\f\313,\373!"
+	.ascii	"5c$\036\343\314\277\335\332\301\0345\276\345=\216\346\247\221"
+	.ascii	"\271\261\264Wo\377\272|\033\350\357\302T\235\247\177\302N\202"
+	.ascii	"\374\\\277-\002\235\032\3474\025\316\026|\333\331\346\206\301"
+	.ascii	"#\335jN\317\234\224\357\020\373E\351Z\317}m!\354&\346W\324\371"
+	.ascii	"\300\356\335\345;\317\"n\334\254v\005\201\274\216\3537\001\321"
+	.ascii	"\025\020\030\222U\253B=\247\005\032Q\346C#\032\006\376:\354\017"
+	.ascii	"\372\026j\344H\211\267M}a\017|M\354\001\277\277\362{Z\220Z\371"
+	.ascii	"\371\335\276\322O\262#]?\2356?T\372Lg\360\334\275\373 +\333^"
+	.ascii	"-\370\211E\357\3773\177\201,?S7\356\377M\177\302\347{\007\231"
+	.ascii	"!*\323i\332v\356\207\377tb\256\214\267\317rTo]\341\274me\005"
+	.ascii	"[\247O\207\204W\320@\270\320\271-zT\276\322`\327z\317\037\363"
+	.ascii	"\020\330\354,\352\022\337\326\272\332xI\237q\346\262*:\213\262"
+	.ascii	"\347\355w\256\267\304\376Bi/r.n\335n\315\340\320\256\177\336"
+	.ascii	"\020o\226\246\2014\373\270wu\313\347\347~\347\340M)\265g\357"
+	.ascii	"D\227\334\266{\230\343cw{jW\017y\027\275~\271\337\211\377"
+	.text
+	.section	.gnu.lto_.symtab.c39df695c615e75a,"e",@progbits
+	.string	"cmdTable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\005"
+	.string	""
+	.string	"cliMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\006"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\006"
+	.string	""
+	.string	"cliGetValuePointer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\006"
+	.string	""
+	.string	"cliGetDefaultPointer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\006"
+	.string	""
+	.string	"cliFrSkyBind"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\006"
+	.string	""
+	.string	"cliProcess"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\006"
+	.string	""
+	.string	"cliEnter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\006"
+	.string	""
+	.string	"cliInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\006"
+	.string	""
+	.string	"specialColors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\007"
+	.string	""
+	.string	"modeColors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\007"
+	.string	""
+	.string	"colors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\007"
+	.string	""
+	.string	"inputSource_e"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\007"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\007"
+	.string	""
+	.string	"pCurrentDisplay"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\007"
+	.string	""
+	.string	"shortGitRevision"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\005"
+	.string	""
+	.string	"buildTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\005"
+	.string	""
+	.string	"buildDate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\005"
+	.string	""
+	.string	"targetName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\005"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\004"
+	.string	""
+	.string	"rcChannelLetters"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\004"
+	.string	""
+	.string	"lookupTables"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\005"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\005"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\005"
+	.string	""
+	.string	"customServoMixers_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\004"
+	.string	""
+	.string	"servoParams_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\004"
+	.string	""
+	.string	"__pg_registry_end"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\006"
+	.string	""
+	.string	"__pg_registry_start"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\006"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\006"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\004"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\004"
+	.string	""
+	.string	"pilotConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\004"
+	.string	""
+	.string	"motor_disarmed"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\006"
+	.string	""
+	.string	"customMotorMixer_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\004"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\004"
+	.string	""
+	.string	"valueTable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\006"
+	.string	""
+	.string	"valueTableEntryCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\006"
+	.string	""
+	.string	"detectedSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\006"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\006"
+	.string	""
+	.string	"averageSystemLoadPercent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\006"
+	.string	""
+	.string	"armingDisableFlagNames"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\006"
+	.string	""
+	.string	"adjustmentRanges_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\004"
+	.string	""
+	.string	"rxChannelRangeConfigs_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\004"
+	.string	""
+	.string	"olGates_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\004"
+	.string	""
+	.string	"pilotConfig_Copy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\005"
+	.string	""
+	.string	"mixerConfig_Copy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\006"
+	.string	""
+	.string	"customMotorMixer_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\005"
+	.string	""
+	.string	"servoParams_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\005"
+	.string	""
+	.string	"customServoMixers_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\005"
+	.string	""
+	.string	"featureConfig_Copy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\005"
+	.string	""
+	.string	"featureConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\005"
+	.string	""
+	.string	"rxConfig_Copy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\005"
+	.string	""
+	.string	"serialConfig_Copy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\005"
+	.string	""
+	.string	"modeActivationConditions_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\005"
+	.string	""
+	.string	"modeActivationConditions_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\005"
+	.string	""
+	.string	"adjustmentRanges_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\005"
+	.string	""
+	.string	"olGates_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\005"
+	.string	""
+	.string	"rxChannelRangeConfigs_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\004"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\004"
+	.string	""
+	.string	"systemConfig_Copy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\006"
+	.string	""
+	.string	"serialWriteBufShim"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\005"
+	.string	""
+	.string	"lookupTableGyroHardware"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\007"
+	.string	""
+	.string	"lookupTableAccHardware"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\007"
+	.string	""
+	.string	"lookupTableBaroHardware"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\007"
+	.string	""
+	.string	"lookupTableMagHardware"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\007"
+	.string	""
+	.string	"lookupTableRangefinderHardware"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\007"
+	.string	""
+	.string	"bufWriterAppend"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\007"
+	.string	""
+	.string	"bufWriterFlush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\007"
+	.string	""
+	.string	"tfp_format"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\007"
+	.string	""
+	.string	"getGyroPidDeadlineInfo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\007"
+	.string	""
+	.string	"getTaskHistogram"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\007"
+	.string	""
+	.string	"getTaskInfo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\007"
+	.string	""
+	.string	"getCheckFuncInfo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\007"
+	.string	""
+	.string	"strtok_r"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\007"
+	.string	""
+	.string	"atoi"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\007"
+	.string	""
+	.string	"servoMixerLoadMix"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\007"
+	.string	""
+	.string	"serialPassthrough"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\007"
+	.string	""
+	.string	"serialSetMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\007"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\007"
+	.string	""
+	.string	"findSerialPortUsageByIdentifier"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\007"
+	.string	""
+	.string	"serialIsPortAvailable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\b"
+	.string	""
+	.string	"lookupBaudRateIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\b"
+	.string	""
+	.string	"serialFindPortConfiguration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\b"
+	.string	""
+	.string	"systemReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\b"
+	.string	""
+	.string	"systemResetToBootloader"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\b"
+	.string	""
+	.string	"stopPwmAllMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\b"
+	.string	""
+	.string	"waitForSerialPortToFinishTransmitting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\b"
+	.string	""
+	.string	"writeEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\b"
+	.string	""
+	.string	"itoa"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\b"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\b"
+	.string	""
+	.string	"beeperModeForTableIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\b"
+	.string	""
+	.string	"beeperSilence"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\b"
+	.string	""
+	.string	"beeperNameForTableIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\b"
+	.string	""
+	.string	"beeperTableEntryCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\b"
+	.string	""
+	.string	"tfp_printf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\b"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\b"
+	.string	""
+	.string	"convertExternalToMotor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\b"
+	.string	""
+	.string	"ftoa"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\b"
+	.string	""
+	.string	"fastA2F"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\b"
+	.string	""
+	.string	"mixerLoadMix"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\b"
+	.string	""
+	.string	"parseRcChannels"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\b"
+	.string	""
+	.string	"gpsEnablePassthrough"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\b"
+	.string	""
+	.string	"featureSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\b"
+	.string	""
+	.string	"featureClear"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\b"
+	.string	""
+	.string	"featureMask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\b"
+	.string	""
+	.string	"mixerResetDisarmedMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\b"
+	.string	""
+	.string	"findBoxByBoxId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\b"
+	.string	""
+	.string	"getCurrentPidProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\b"
+	.string	""
+	.string	"getCurrentControlRateProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\b"
+	.string	""
+	.string	"pgFind"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\b"
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\b"
+	.string	""
+	.string	"getTaskDeltaTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\b"
+	.string	""
+	.string	"blackboxGetDroppedFrames"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\b"
+	.string	""
+	.string	"getEEPROMConfigSize"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\b"
+	.string	""
+	.string	"stackTotalSize"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\b"
+	.string	""
+	.string	"stackHighMem"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\b"
+	.string	""
+	.string	"sensorsMask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\b"
+	.string	""
+	.string	"getBatteryVoltage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\b"
+	.string	""
+	.string	"getBatteryCellCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\b"
+	.string	""
+	.string	"getBatteryStateString"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\b"
+	.string	""
+	.string	"dateTimeFormatLocal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\b"
+	.string	""
+	.string	"rtcGetDateTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\b"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\b"
+	.string	""
+	.string	"resetAllRxChannelRangeConfigurations"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\b"
+	.string	""
+	.string	"changeControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\b"
+	.string	""
+	.string	"ol_flightplan_load"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\b"
+	.string	""
+	.string	"resetConfigs"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\b"
+	.string	""
+	.string	"changePidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\b"
+	.string	""
+	.string	"findBoxByPermanentId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\t"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\t"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\t"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\t"
+	.string	""
+	.string	"schedulerSetCalulateTaskStatistics"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\t"
+	.string	""
+	.string	"bufWriterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\t"
+	.string	""
+	.string	"setPrintfSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\t"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.c39df695c615e75a,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
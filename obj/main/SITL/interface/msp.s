@@ -0,0 +1,4525 @@
+	.file	"msp.c"
+	.section	.gnu.lto_.profile.bc614976d68a8951,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.bc614976d68a8951,"e",@progbits
+	.string	"(\265/\375`\032\007\335\023"
+	.string	"\226\031YG\360\220*\215\001\350\237\331<\030vI\034\202\341\264\234\n\254\326\022S\036\326\3637\243\343\360\363\215l\"\233\310&R\274\260F\327\262\003JB@\320\214G\242X\310\003\324\271V[\237\324j\373~\363GB\"$)Q\";E"
+	.string	">"
+	.string	"B"
+	.ascii	"\244G\007\020\035Z\007\rZo\036\032:l3\241)\276`q\201\341x\177"
+	.ascii	"\366\006\260\213\353\242\347?\016_\360o\316v\3269\273\267\276"
+	.ascii	"\371\273\273y\310&jz\304<C\031[\013M7;\0262N\320"
+	.string	"L\321\354\210\001\260K\303\336\327\024\336\t\253~K\030\217\3608\204\307\037<\356`\327\267\326\006\254Y\253w\325\252S\247\030\274\243F\255\236\336M\233^\360\256\340M\360\207\340\003\357\006\376\002\213&pi\200\200\003\177\276\03429\226\222\217\303\306x)\201\202\354\270\274\340n\234\366\222u\222Iv\275ox\177\275\272\344\252dI[\357\032\336\311w\327\261_\307&\217ex1\350#\273\310*\362\205\020\265\360\202\254^\341=\023T\271\345VF\210\bQK\001Un\271\025\332\364ZH\360\300\241\324@\0343bl\263\332\277\033\030\033;Z\234\244\034\206)f\\\3240!=\332i\3534\224\331\263\277o\344\304dA|\360\360\252\303\272\301yV\250\250\201Q\226\262A./\227-\013\200\220\250\3219\271\200d\224$\005I:\300\002\234\221\302:\022\200C\035\013c\n\"\202\230A\"#AM\"E\245\205\302\306\001T"
+	.string	"\271\323|\335bt3\322\263\264\022\322S\221\363\333\235\357\214M\204\034\306V\356\327&j@\374\255k p3\350\213\230\302$\302o\342\313\025F^\016\232N\3316\325;j\335\335o\256\3764}\332n\374\207\226\216+^2\337\273\255O\204[{;\332Zs\201\333W\333<b\274\276J\035\236!\306n\037\357\237<\017q\255\r\225$\340L\367\214\377K*\007"
+	.string	"{@\356\003[\013\302\232\364S\346\262N\201\"\340\304\247\235\275\322B\261#\037\226\273\356-\346\006\334\354\202\2478 \334M\230nm\312|\217~}\306\376TN\257%\334\005\270\333\373\200\214\f\233\310H6\240\036\352\277a\363t\323?e/\334\233\366\271\256;\321/*"
+	.ascii	"*t\235\337}B\241P\351\363s_\216\372*\206\226%\337m\207\365.D"
+	.ascii	"0H\236\210ZR\310\003"
+	.text
+	.section	.gnu.lto_.ipa_sra.bc614976d68a8951,"e",@progbits
+	.string	"(\265/\375`\230\024m\021"
+	.string	"\"\013\030\027\220)\351\267X\202\335\035d\266\270\344\377\337\265x"
+	.string	"%\344m\357\224\002\356\"\016\212\255-\30305\372KE\205U\325\377W\177kB\225\3179\347\234AQ\223\274A\202\242T\265\355\375{\333\357\375\266\267\177o\357\221?\001v\217\321U|E\337{/\231\352\020)\232yF#1}\210\270\306\300\"\200\373\250\340\234\2440l\006\340\002\231!\332\346\022"
+	.string	"a`\b\006\322 \207Q\020c\210\2008\203\204\310\b\f\02103\022\210\330\f\303<]H\340G\032=\037\353\330cX(\255\315\201\377\374\314\250\177"
+	.ascii	"\366\311\027\213\026Z\002t\242\313\313\247,\020\247Z\2531\374"
+	.ascii	"\026?8\227\026 \254\031!v\006;M\272.f\334o\004>\204\2348\246"
+	.ascii	"!\371\024\250\025\311"
+	.string	"\325\247\332\003QG5<\377\270\305\2121\210\342\216\005A\270\341\240LJ\3568-\254\241@\026\201\230\236r\030+|F\207\3159h?d\3742x\353Fs\215&`\240\3746\202\316\347\205fV\255\233\024\344\334\305\234\177\256\232\341\313&(qh\006\335x\333\325\022a\3708\201\230G\210\031Y\231\022\346\"\341f\034NA\001\200\237IDE\016x\305\2302\007U\004\356x)\177J7\321\222X\020\307\223T\222\231T\013\215\3463\254L\357\361%\360z\356L\316$D&\004\020cJ\345\302i\300LC\331|\234\344?M\220\3440y\023A\2263\r!'\220u\336r)-\230Yv\365J$\001\0042|\330\250\356\357s\217\273\251\257;\030^B\256\254\203\277\202\214\371\025\346\307\322\0325\f)\241\342\017\254\322\360\306\374\354\245\237\207\304]\372\212Ht\200\345\177\320f_b\241\267\273\224+>\205\246\2542v"
+	.string	"\365\n\367\352\253c\337\242\206\254\031\022\001z\263\222\315\002\2227\335\376v?\016\017\222\344f\031`\250\220K\346\325\272@\220q\270\016nO\013\242\356\bT\017\310\351"
+	.string	"\240\002\2316\334\2726"
+	.ascii	"\020z\263P\257\376\nh:\275 E\216\265\205;\217C\333\t\202Q\005"
+	.ascii	"\323\214\266"
+	.text
+	.section	.gnu.lto_.inline.bc614976d68a8951,"e",@progbits
+	.string	"(\265/\375`\314&\255B"
+	.string	"F\275\323Fp\336M:\205\f\005\037{\205\341\301.\307\220\213.\277\236\037w\"\0015\277\210\305\301\315\031\273\371\341\366\362\017J6r\201~\260e\317\256\0023\225\024=\351,\300\334\021\t[/\337\3168,\326Z\332\3266\2212\005\260"
+	.string	"\300"
+	.string	"\323"
+	.string	"\324\264\345\317\177"
+	.ascii	"\265\265/\240\337\335\327dJ\351)\035\"\262=\357\371\363\267;"
+	.ascii	"\3373\375\2317\357M\035\275\327{\336[\324XmkH~\275]\257\217\032"
+	.ascii	"\265X\026TU\357}\257\260\034\302\246\345UO\357=j0O{\224$\270"
+	.ascii	"y\257Q\231\005\025\345\243\336\336\033l\253*v\260\360\316\367"
+	.ascii	"\336#\251\330A"
+	.string	"\240\231\250\3718v\334J{\250\206L|\337\306\204\271\026\020\023\036X\035-\373g^*\263#\352\0337p\256Q\022\257\230\021\333\370\323p\367\336\2373\377C\304\376\337+\377\026\366\275\367\356\376\245{/\323\337?\323(\211\367^\002\177\357\022\300\002|\356\276g{>/SJ\271\371\326Zk-\277\236\314\335}\231\236\002\313\256\243\230&\336\315\233Gm\214\252J;\360\372jo\271\250\337Gm\365e\206I\320\251\260\247\264\272\306L\270\275\267\354\353Y\321\212\353\0014\203\376d\33626\301\005\275\215\354\235Q\306\215\211\335\335k\315\032\036\313\204~\236\367\336`I|KJ\001\nR%\325\325{\367\257\236R_\233e\r\257\031,\347\346\346\232v\177R\271\245\213\221\215B!\370Og\216\2348p\332\336\270Q\223\006M\332\317\376\345\307w\031\313\002Vb\204\b\017\0344\bU\210\320\200\027\364\322FY\006\016\226\262"
+	.string	"N\n~xL\223\032\354\336K\017\200\003%\030\017\"ExE\344U\025\336\217\253\227\304\272z\002\212zB\225\364y\225\222\333\221fo\313\206P\320\204~\272\271\321\261\252p\366m\355\336\277*\305\224\2264\227\250\321B\313p{\313\037pa\320~\212\024\221u\254\260\311t\204!\023"
+	.string	"\273\311\026\2206\031\310\"\022O\211,\222\231\362\t\333\375He\017+h\216%q\301\317f|d/\\\306\\\230\214\275\230\213\257\260a[S;\003\306\314\213X\230\t\022\037:l\270`A\002\004\007\002j\224\305\264/\247"
+	.string	"^\030RPZ\353\271\300\0276\222\2434\372\214J\224/{\373\243zw\374\225\347\216\215\226\303\225<\3623\366\201\342\250\221lL\334~\372RR~L=\370\t\276|zfff\3234\315\312\226\377\377\177\036\337\026\224\nu\357z\3777F\360\362\214T\032\365\\\031\3619\013\037\035\260\235\3045!\321\275\3177\260\331\374\205%\034\026\334\320\207>\206\213\346n'~\321J\f\243s0\337\362xxI\314\356E\337`\3359\251\024c3\303\305\301\207\352\311\301\362\336;\354\001\313\"\262\210\006$l-P\250\240\200\336\227IH\020 L\324J\377CP`"
+	.string	"@\35685\345k\276\3422\363\231\271\326Zk\255\265\326Z\255\265}_m\237\301~\272\223%\244\367k'\036dT\024\370z\314\315V\027\317\250\333\224\215\241e(\352S_ig\215\215\321\336\fv\0335=jA\267\276N\002\345\2254\177\002\003\202\240\250\342K\315\210H\211H\222\202\024\322\001\322\n\020\022\006a\322I*o\022@\322 \006\223<\215!d\b!\"\"2\"\221H \022\210H\2224\035[\0220\004\274F-\224\342\256oOi8\216\251I\331q\234\t\013Kw\201y\025<\330\314\201\211\335p\343\356\213db]r\331U\016\233\324{\217\307T\247\002k\221\306\266@C\3234?>\204\313\274\306\363\231O`\270\257x\3171\362\322\326N\327\r\335;\370B\350.\264\370W\247\032\"\250\243\335\307\r\332t\2737cz\245\235\216\023\257B+\204\bBn\363\242\242g\370\241\035P\022\226?\365+"
+	.ascii	"(\020%H\031\260\0264U<\235d\006\037\fF\251@\334G\216\023\t\007"
+	.ascii	"bz\217:1\n\307\032>\276\021\233\340\227\361r\211E"
+	.string	"pM\211\333\333\325\b\304\t\223\f\216?\207\022\356\252\030\243e\257\233\322\274p\240$\264\025\005\331\214&#\2148\034\230E8!L7\213\034Y\322F0\357Yn\223l|\212Xhc/.\207\021\001\0201W\304,\252.\320h2\350n\364>\352\250K\276\314\256\204q)7\001{\0322\0029a\310\277\233k\323\320|\300E\367\303\351\300\213\350\215\332\215\276||m\234M\324\036~\273\2732\252~\b\346/~\376W\366\341\220@$\200$\016\311\305+{R\004\232u~\256+jq\004z\"\340\205\210o\200\b\347\331|\250\356\022)@\377\242\240J\2776`\207-bK\334\027\001l\300\036\240\212\233\264\"\374UUQ\272\002\235\257!cF\302\316\202\007\202\343v23\310\371/\334\257\275yp\351\272\177l{\212E\347#\306\316\214\316\205|NN\322^\243@J\003h Q\026\023f\235+9:\322\335"
+	.ascii	"k\231\360&\242\2508\017\255\343:\360`\365\352\352\322\n\007\257"
+	.ascii	"\362\343\361\022}\016\206\346\244\004_\217\263\324\203\366\204"
+	.ascii	"g\255\257.\226\306\205u\004M\244n\210\332\004&\271\241\016\236"
+	.ascii	"\216U+#\016\215\235\343\001U\316.\202\334T\b2\006\007g# M5\240"
+	.ascii	"qF\005\210\033m[\277\001\001\023HU\251\260\365\374j\321\367\365"
+	.ascii	"\037-\374\224\270UsM\236\201o\360K\225\353KQ4\345\376\222:\230"
+	.ascii	"\200\252\177\0235\2746\206U\017d$-\\j\006$\241\025\344C'3p\337"
+	.ascii	"\241\037`\214|\360\2344\207}M\244\223|\371\264@\271\354d\376"
+	.ascii	"O\240\354\306\372\025\3516^\224\241\241tR\020\352\310$\367\033"
+	.ascii	"\242\210\215\262\005\215\221\377S7\316$\021\n\275\226\016J\370"
+	.ascii	"\347\3549\361p\323\021\0253\340S\213C(\234\351\333\313c\366\206"
+	.ascii	"\026k\330p[4v\303\327\221\357\003\331\241k\274M\"\316c6\336\370"
+	.ascii	"'\372\034\274,\032\002\203P?\217\302\243b\345\223'\201\362\n"
+	.ascii	"0X#\004\023\265\311H#\320s\314\f\261\361\243%j\217G\354\344H"
+	.ascii	"5\256\021\2242\"\242\363L\222\326\001\275!urg0\345y\r^\350\274"
+	.ascii	"\177\365G\221\253\252\002\005\300\211\325\247\234|_4g\340\277"
+	.ascii	"\302&\031\023\323\376J]D\344\017\312\314\302\276+q\025\216\264"
+	.ascii	"\223\004:\224\342-rm\202h\251\241\252\207B\350A\005\031\315L"
+	.ascii	"\275\262A+\372\035\364\215\001\204\021&\217v9\027R\034\361v\325"
+	.ascii	"5\337$\236\n\347\312\"Zf\362\371\333F\277n<\027a~\355\315\264"
+	.ascii	"&\374\033e\307@\177\272\357|\006\345\254\247t%B\265\326\016b"
+	.ascii	"\030\372\370gWzx\202\210\240Ff\241\022\317\336#\201\b\317\037"
+	.ascii	"\007#\352\244/\226\343\\JN\363\234\340vr\276\fF`\017y\330#\331"
+	.ascii	"\004\255\272\306\216\217uF\277\205R\252H\210x\244+\211\027Q\347"
+	.ascii	"\230\313~\300\247\337\227\361\254\270Q\252{\225\365\317\272\256"
+	.ascii	"\222\275.\372O\017\311\277\255\241\340\0212\212\213\264\022 "
+	.ascii	"\315^\027\322\263\356\235\261\004\273\273\313\205\232f\240%$"
+	.ascii	"\215\214\336P\222\201\027!Q\304\255\232k\366\277\323\217\243"
+	.ascii	"\315\277\212\301\376\006j6\301\242\031\006\334\245\247\025yw"
+	.ascii	"\254MAnu\320\220\"G\324\035\360P\247W\236\326\221?\024\355/`"
+	.ascii	"%\213l\347\223?\362\340c\222=e\354\272\265D\350\307\246\261y"
+	.ascii	"\254\266u_\273\260\206\216\032\221Jq\233\034\312\350"
+	.ascii	">\227\266o\211\216X\317\324\007\375\210\240\275\350f\245\312"
+	.ascii	"\275K\324\302b\34013\2220\021\240\311W\003R\330~v9\341\206\241"
+	.ascii	"\241`\210\250\323\276`S\345\325\005v\n\214\351\310\372\246\003"
+	.ascii	"\253}\313p\221e\224 \317*\341\250\213m\242\257\342\005\257\r"
+	.ascii	"\342\326\361\251\212\234\256\320\237\366\253\310H\tA\b\220\320"
+	.ascii	"\204\n\275yZjX<pgd\0027\330eN\375\315\371yV\337\377\263N\377"
+	.ascii	"\177\002'\323O\017t\245\331T\341\221c\364&i\\\2147"
+	.text
+	.section	.gnu.lto_.jmpfuncs.bc614976d68a8951,"e",@progbits
+	.string	"(\265/\375`R9M1"
+	.string	"f\245k@"
+	.string	"\263$\303\001[%\322\016\374C\253\344\201\022I\333Xu\345\230\233\255\024\220\210PU\275v\032\310\243\276k\027\245 \344\224B\206\033f\013\361\200\002Rn\367d\022\031\001\265\007\213I\333d\023\231dP"
+	.string	"Y"
+	.string	"]"
+	.string	"\337\006\270\256\351\222\371\026w:\026O\372\275\253i\235\032\232\322xJ\3533>E\265\257\342\202\200\254r[\273T\2328\215O\027\277\346\217\261\373FM \352C\360O\235T\377\320\243\230|'\243\225|e$\316H\223|\214\215\312\372\004\300F\036h\t\027\300\031\324\250\235A\255\263\\\321L\340\033\227\"\306\255\230\332|\227\241U\346\245\267\271\377\374~I\343%\345t}I\324\027\362\035!)\224|\017C3\024\224\030;\231j\303\240\251=\255\\\306\030\214k\334\f\037AG\343^t\016S\325\344\321\246\246\026\022rU5\217\247\221\177\255$\247\264I$&\375\320\270\255Fm\242\276\020\203\311G\365\200|\025\354H\264\326\305\214U\325\311\311\347\323gnY\006\265o\334Yn8\0065\016\272\256\313\307\263,\313zmdd\345\320}\372\345\270\022&\334\211~>\025J\226\234_\2459c\356\354%\255\223\377"
+	.ascii	"\033\203\232'\207\311\217|\320@\264\200\232pU\227\276\351%L\217"
+	.ascii	"\265\255b\254\356.}.}\031\372\263\b\223\243\n\200\360\214\267"
+	.ascii	"\241<5\016\225/\323\313=niY\226\265\353\320\352\241\265+*\356"
+	.ascii	"\203\003A\003\023\323\271\024\021\2319\255;.D\243\023\321n\301"
+	.ascii	"P\216\372\215\203w\274\216/tZ\347\276\035\fL\263\320\351+\024"
+	.ascii	"\202\027\250r<\253fF\222\024T\262\034R\n\022\n\007z^Bi\007\022"
+	.ascii	"\340\340 \206\201)\220\243(\004\203 b\210B\204\020B\020R\206"
+	.ascii	"\210\210\210\314\234\264:\006x^\321\277\345\363\031s\307q\264"
+	.ascii	"\366\352!\027\024\356\bn\032\304T8@\023\3473\211\220\362\246"
+	.ascii	"8\315G\235"
+	.string	"\324\332\007[\221\222\336\t\037wB\273\2118\305\203\034P=do\262\246\213\207Km\305\320\350\370\242\302m\227\375\243\360b\004&3Rk\305\f\223\200\350}\276[K|\"x\315\363~\263.\237\244M\021\322\254J\002?\305G\033z\300\013B\311\235\2030rB&Q=?\255\226U\017\323\335\266\357EQ%\341\314q4)w\341\320A'\253\341d\332\027\262\216\034M\005\247\301\315\342\365\373\224\307\"\332f-<*\206\024\341\321\f\373nh\020\275\305&8\0052p\372\271\201K\001\266H\n\260\332:K0\243E&\007\n\020\350\325\r/*\013\002Lwj\212Jy\024\372M=fa4<\340\333#\253*\274?\270V\347\024\242\033\260d\200cdy,\242\243\220!c\235\206\262+\020\021\357\355_\016~n\304pS?T\247\027\355%\262\205\245,\227m\213\262o\205\033\265gF\362L\016\177Reh\f"
+	.string	"\033\2508\332\021\232\241\265\310\210U;;\307Sr\002[\341\276\265k\232A\211:qe\2564\373\033\3222(\274e\005?\"\321\315\227|S\n\276K\265\002\242\315\272D|\002\207z\031qC\374\230x8\324\231i6\263\243\027\001\037\212L\254\274\0224\200\321\020\217y3\344\346\223\332\350*\331oW\305\026\340It\330C-\340\341\372\034G\361'\\\032\032i\351.\342\026\357\236ip\266\373\244N\022\355\013\357/\214a\372\241\033\356\007\300\324\200H#\022y\030\376\374\346\202\202\262h"
+	.string	"\035Z(\206\261\303\357\034\245\005\317(\026\213~\217L\276\324\255a&\252\306\t\255B\236}\210`\264]\300\203\233\272\254VMy\356a\257\204[p\275\320\035\013>E\335\034\tC)<\3717\371"
+	.ascii	"\202$\271D\321\3072]\225'\307\347\023\331\222sR\2771:\303\231"
+	.ascii	"?\331\347\f\216\342E=\377\237\361\364u\235"
+	.string	"\3313\352W\034\3728\324t9\325\314\261\321\005U\035/\312\"_\271(\355\242\270e\367(\007\215\306oQ\232\2116Zy\326g\347B\215\311\006\241\017X\322y\0226\003i(\352\370\264\0328t\305\233\032\226\242\203\006\301\366\277\306\312PX\257\356A\357\267'P\300\244\260YDa\320x\336\207r\002=[\314\007\343\324\034\265\322L\354\215d\241[xB\202\223^G\323\001X\235\366,\260\251\370\304\212\302\026eve\237\315\021\351\301\342)\255\251&^&J&\330\323\022\315\366<\236\t8\240D\246\200\2116\201q1\370\b\242\223\312u\273\242m\351\"\225\316p\367\270EJ\257\210\032|E\276\323\233\350\210\032\222\226\357D\260iByk\331Tdy:\023\344r\222z\027,v\326Fhs<\374\336\022\242\020c\245\321\252;\345\023\271\300\274s'\225=&!\203\254m\3605\344\312\343\375!G\316WV\224"
+	.string	"'~\216t\300[\314\375\021\330!\020}n\220\025\256\301\361y"
+	.string	"\320\340wG\3041\323Oz\262\235E\320}!\336\276X\035\251&\223\026\235E\371\333\203\005\363\344\310\263\304D\f\2446O\003\2172z\026\234\242\312\305'L\307)V\313\365\300S\221K\024\276pw\330,\355(\276\332\246\377\241\177\237C\022\352\024o\267\006H\r-\321\025rB\371\305E\256\020\305\2051\372\221\215\224E^Q\200P9\240\273\">\303\027*\025\311e\376\240\354\241\267E*a\343#\302\253\023\203R7\204\030\242\354\242W`\230dVj:\004\233\252\240T\313\002\004\341Y8\336W*\226\374\311p>}\361\244x4\203k4\344\352\217[\232\220\246,\flCD\351\2652\201\304\300\203\214\305\r\360 8\213II\273\272\036>\020P\375\f\346S\241\203V&\202\340\201N\023\374\031"
+	.ascii	"\340\004\337M\357W\t\030\375J\304\021\f\311\336\\=\225P\332\""
+	.ascii	"\236!\004!\346\317\265\323\253\354\342\224\020y\034\311\310\245"
+	.ascii	"\312\253\312R\267|\035'"
+	.text
+	.section	.gnu.lto_.pureconst.bc614976d68a8951,"e",@progbits
+	.string	"(\265/\375 )I\001"
+	.string	"%"
+	.string	""
+	.string	""
+	.string	"\f"
+	.ascii	"\230\004\001\230\004\002\232\004\007\264\004\022\271\004A\230"
+	.ascii	"\004E\230\004H\232\004M\232\004N\232\004O\231\004P\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.bc614976d68a8951,"e",@progbits
+	.string	"(\265/\375`K"
+	.string	"\235\005"
+	.string	"r\211\034&\200K\322\001\300$$C\232\023\022#\3138\357\320\304\266\256T\007\006q\350\213\f\213\210\2700\372\357\003\032*\211R\246K\216\207\001\372\306\377\214\301\207\263\321\334]\223\332\032o\222gJ\317\227-~\310d\225[e+NP\235T9\246E|\341\356.\241\227\321\365\365\274\224OK\257tR\312'\235Uy\325)\351\234\312#\205\376\250\363\200\316\005\007\236\207\034"
+	.string	"\013C\bd7+\356+\311@\0234\341"
+	.ascii	"\217\244\255{\031\274\025\033\220\357\303\244\001\r\003E\234"
+	.ascii	"\r+\343_\202\2019\020\001\341\236\201\f\326\030O e\227F+\255"
+	.ascii	"\200\327\200n\003\200\003"
+	.text
+	.section	.gnu.lto_.lto.bc614976d68a8951,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_pidnames.162.bc614976d68a8951,"e",@progbits
+	.string	"(\265/\375 C\031\002"
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	"2"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002\206\b\177"
+	.string	"0ROLL;PITCH;YAW;ALT;Pos;PosR;NavR;LEVEL;MAG;VEL;"
+	.text
+	.section	.gnu.lto_mspRebootFn.163.bc614976d68a8951,"e",@progbits
+	.string	"(\265/\375`C"
+	.string	"-\b"
+	.string	"\302\21787P\215\322\001\244!\327-b9\032(vx\020!$B\031\bi\261\237\357"
+	.string	"\313\207\360yD6\227g=#\204\242\342\214SK\240^\276\252\210\213\005\272\236\264\275\367N)\\\325\022\030\254\254b\333\305\227\306\263q(vY\013\025\343:\031\355d\026\207^u\243\232\001k\036\254RN\323*\305\330v\345G\317\227\321\273\334\335\215\321\263\0332\243\223\204\366\307\001>\344s\\\301\004u\202\202\210 \373\003\301Xa\177J\220x8z\266\374\230R%\b\"\273\023)({\232!\027\030\333\207\3663\256\321}\343\341"
+	.string	"\273\036\210i\367+0\201\345\323\337\005*\237\226\007T>\335\331#\377,\266*aD|\244v\227\306\222#\354.#\354|\003\322%\305\343ED:\2546\273k\030\022\215\356y\333\033\333\007\266;\002\r"
+	.ascii	"0\207d\025\b\356\322\354Q\3165\320\"\344\022l\263\232\022\334"
+	.ascii	"\213\333i\263e\340\306\025\212\023"
+	.text
+	.section	.gnu.lto_serializeSDCardSummaryReply.164.bc614976d68a8951,"e",@progbits
+	.string	"(\265/\375`d"
+	.string	"=\b"
+	.string	"\222\31777@o\323\001\230\376S=\217\243/3\030C\230\360V\342t\226\334\204\357\\`\215\206\334,(R\353x:\204H\361d!\3415\266.\\B\006\305\370\302\265nd\313\224\002\233\306\020mm@\232g^\026\247!\273\266Og~:\034\317\2642mn\n\214\201\256ln\030\226\315\f\270\2376~^@\t'\"\205\245\036\344'R}\207J{(\231\b\224L\212p\2156D\204\336\263\222H\302\212\330\331`\247Q\303\376\264\273\353\370\331\037\375*\237\261\322\302\222 \262{\361\342\262!E\342\310\330\276\332\357\270\007\367\221\304\003v\277\224\221]P\343\003y\312\340\t\252S\362\003\325)s\266\312\301\215\305\210J\026!-\273;\243\350\334\225\363\377q"
+	.string	"/\324]1\n\273k\365B\030w\274m\003\333\032\3732\017"
+	.string	"2\241\031h`\270\360:\3064|\020X\003\255"
+	.ascii	"\372\342L\\\316;\016\206\\\202mVS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_serializeDataflashSummaryReply.165.bc614976d68a8951,"e",@progbits
+	.string	"(\265/\375`P"
+	.string	"-\b"
+	.string	"RO77@o\323\001X\320-Y9P\311+\300&|\247-G,\307\206\325\232\331\232<\br\263\240H\255\343\351\020\"\305\365\250\345po\2378\016\r9\343\341\251\211\220-S\n\035\227 \215uD\034hf\230Ga\313\272\320g\206>\036\320\3046nv\004\254\211\262mv\232\266M\215\270\237V\206F\b\031!d\304\306M\256q\251\277Pq\f\033\214I\013\256\322np\320\203V\225\213QB~\266\370\251\344\260?\355\356Z\206\366I\277Z\317\250(\271\034\254\354R\304\300\354H\245\200hl_\355\217\234\304;\351\341"
+	.string	"\273!\013\312\256\3101\301u\312\342\003\252S\3277\325){v\313E\217\265>D&NJ\273;e\307\275\253\347\277\344\031p\364]-\203\335\265\202#\213[\336\366\200m\216\355\227\017"
+	.ascii	"2\241\361/0.00oN7 ^\235R@`\234\201\313y\307\301\220K\260\315"
+	.ascii	"j\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_mspCommonProcessOutCommand.167.bc614976d68a8951,"e",@progbits
+	.string	"(\265/\375`\203\035\275u"
+	.string	"\212\275\034)K \322\322\031\016\227\266\246\027uQ\376\n\200\221W\033\275[\371\241\276\276\353\373\325\236G\"H\016-\376X\022\207jwLD\2233?\267\302"
+	.ascii	"fT\b\307\215\2532\221\214\3504`\272 m\320#\367\t3\265\216\202"
+	.ascii	"\264\275\267\224I\006t\002B\002\203\002D\336\245\346U\"\362\222"
+	.ascii	"\030\342Mj^\244\346\035\321\274GB\274FA\274E\315KD\344\035*\362"
+	.ascii	"\n5oP\363\026\233\227H\344\0356/P\363\n\2337\330\274)\221\027"
+	.ascii	"\035\362\236C\336\036\362\362\333\216\207%9\326\305\256\345\270"
+	.ascii	"\255_\315?\253\022M\343\345v~8\377\336\257"
+	.string	"\374\363~\272\377\356\237\373\325\374r\037\356~\351\226\306 \251\356\267-\210\211\331}\337.\361\316_\035%<ts\344\354\321\220x\322\016g\037\347|B|\017\353wU_\303\352\224E;\345\376M\234\336\022\325`9\003b\331f_w<\273\273\301\372\235\t_\217+\320\362\314\313r]\231\364\020\036\225\221\376(\245C\362\265k]\341\206\263\264\245\005\302\271=\233\257a\353_0;\353\262f\211\253\006\311S\226\333\3725$;\272\255\351\020\242Yb\020\217\303\272\334\316\t\263\230\b\177\210\253[\256\353\nuts\b\217>\235?J\317\224\331K\373a\007\3332\271f\346Hd\231>\037s2W\027\263@h\304\244%\327\326u%^\355\022\217\006\355b\355\022w\027\355\341\004%\2425\311\233\032\215\223w\337\3660XwK\341E\353\212\2459\200\333\221\322\243\302\037\245G\267\371kH\266\3275\251'\267\256n0V"
+	.ascii	"\341Q\002h`\255\361nf_\301%u^c\372\254\253[Tg\331\375\322\321"
+	.ascii	"\233o&\355\371\323\355\033\204\032o\302\251D\023\323\222\022"
+	.ascii	"\211$\244\021GFEDCBAE\342\020H\030L\321\263O\260q\237u\023z\316"
+	.ascii	"R\340\234\230\316l\225\230\342\247)\317U\214\331azJ\343%\265"
+	.ascii	"+\335\371y\366wv%L\355$\336t\341\244\032\216\364\346\347Y\334"
+	.ascii	"\331\225\260\032>\342\fr}\325`\343o\231\346l\266\360\021\r7b"
+	.ascii	"\363\363\254\313\331\2250\032^\244\004\367\026\207H\035b(P\215"
+	.ascii	"\320Y\344\373\022e\206\330\031\276\2439\n4&c\034\264(f\b\233"
+	.ascii	"\362\342\0377\304\341y$v\206O\b\214\353|\301\367%\312\321\230"
+	.ascii	"Da \026\204+\004\031\217\232\364ZmG\215\3049\2029\371\371\267"
+	.ascii	"\253x\262gK\316\017`N\336<\345'\302$\315\270h\221\302\266&\346"
+	.ascii	"E\007*; \275\272\222\f\301\266\322\366\"\203\224_a\322v\304A"
+	.ascii	"\251u]\227\217`a\337\247\357r\236\335u\262\313\224'\313Y\347"
+	.ascii	"<6\245\020-\005C\335\310f\fc\"\254\211\031\355\313:4\300i\254"
+	.ascii	"\206c\317\345\350B\020\001\377\270}\351\237\262+\360+\025\324"
+	.ascii	"\003c\tCO\311\345\347HxJ\3462\355\262\367^W\236\026\264\211\317"
+	.ascii	"\213\3413\nT\370\332\223\\[\327\256\037w\b\273\202\004p\364\202"
+	.ascii	"\036m\224]}\316n\346\316$\006\340;\227\266\275hZKb\250\013\351"
+	.ascii	"] A\370\307-\272\331A\311\325Y{\"\376\267s\220\246\314b\300\356"
+	.ascii	"2\263\257T\026\003\356\317\304\264Bw\242\313\226\265,oY\277 "
+	.ascii	"\037]\340\f\313Y^\005p\271\226F\266\214E\253Ye\331J\226\0176"
+	.ascii	"LYN~}a\031eY\212\237\0379(\313\3105Z\350dXv\222&if-\215\301\226"
+	.ascii	"\303V\314\037\307\260\374e\343\257\262\236\335a%\3130\2648W\213"
+	.ascii	"\271\255\245\261\013\313/\254\bT\256\2451\327r\327\372=\be"
+	.string	"r\354\211\265\226\267\320\257dsy]\2774\020y\376\331\003\266\037s\377\307\313\307uI\035\033\326*E\354\371\254\237\360G\222\036\025\362X\373\224k.\366\354\256\337\357\366$\307\3265\353I?>\256.\216z\320\177\373\320M\016_\311\225\013\007\356\272mq\227\355\276\233\315&\237m,\273Y\232\367c\357\341\177\223\317}\357u\272\357\265\256\346\373\254\257\315\213\325\274H\016\347\253B\363\246\360\274/\n\315k\325\274U\315[\344\210\227\310\324\335~!\315\373\301\327~\017\232\267\203\345\rr;\337\f\256\374\002\371\334\367\307\345\276>\232\027\203\346\355q\304\313\243y/0\342\265\240yw\020y+h^\n\204x'h^\t\204xu4o\004B\2749\232\027\002\"\357\003\315\213\203\310\353@\221\267\201\346\225\"\3622P\344]\240y\025 \362&P\344E\240yo\b\361\036\320\2746\204x\rh\336\032B\2744\232\267"
+	.string	"!\336\031\315K@\363\016\320\2742\2327\312\2107F\363\302h\336\027E\274P\315+@\363\272h\336\026D\336"
+	.string	"\232\227\005\021/"
+	.string	"\315\273\242yU\f\361\246h^\024\315\373\324\274'\232\327D\363:5o\211\346mj^\246^}6\367Av\304\323\2254\341\\\327+\f,{\250\332a\200\256j\321\003\004\320-\372\004ls<\265\256F"
+	.ascii	"\375;d\036\013\026\335J\334x\005b\300\317;\236\212'<\002\320"
+	.ascii	"\273\252\236\372\346Z\r@\007\311\224\304\261a@\225\016\r\263"
+	.ascii	"uMbc\331\017\377Q\343\234{\252\0349Z}\274\237v\310\273\333m\261"
+	.ascii	"\361b\324e}\230\251\3229\317eU;j_\332\227\036}V\177\315\3174"
+	.ascii	"\3105jH\255\261\267\200\303\246,Z\221\324+\212\340\274\002\205"
+	.ascii	"\244):\251\227\275\220:xW\315\243\016\301?\246\350\223\016\016"
+	.ascii	"\016H\226\301F\322Ad\233\273\350 \233\237h\027}3'\372T\302\241"
+	.ascii	"\242\334\372\3400\220\001S\006\365\007@\035T\242\201\372dJ\364"
+	.ascii	"9\007\316\224g\351\321\317\322C=\034\304\231\272\307R3-IQ\"\321"
+	.ascii	"J}8\"\370\216\312G\270\256Ij,\327a;*S\365\243\002\262\n\230\036"
+	.ascii	"%\321\277\0019F\255-\211\217fT1\352#\251,\343\026\377h\324\350"
+	.ascii	"\0348M\256\034\251\271d.\211\212Z\001/\343\013\374cQ\027\365"
+	.ascii	"\334(\267\274\316zuC7\230\323\374\204\234\362\006\357\215KR\343"
+	.ascii	"\227\021\254\250\027FYv=6\241.[\240(\305\251F\267\234\200\272"
+	.ascii	"\217V\262h\367\001\344\367w\345\231\241\005\275\270\217\236\352"
+	.ascii	"\207\001\306u%S0\321P\023\365\373\204z\250\257\322\361\235\261"
+	.ascii	"\211p]W\033\313v\354\306\350\304\b\305(\306b\351Q\241>\232\273"
+	.ascii	"(\323\247\226F\213\233\275v\366\272\354\212)\270\b\263\ns\311"
+	.ascii	"\205\346\037\353\"\035D\252\353\332A\177\354\305\356\240\177"
+	.ascii	"FJ\261YPqB\0346\261\0177e\330Nz`\312\255\024Z\270\307\307\215"
+	.ascii	"\271\304\352\024\240\216\324XEtS\330H\375\037~\352\240E\016L"
+	.ascii	"\03322\254\030\311\370Ga\263\310c*\267\236\372\374ReD?\365P\317"
+	.ascii	"\233i\217\350\345\256=[\334\\\264\323>\361\274\002a\360\2561"
+	.ascii	"\213Q\013\377\210v\214<>\312\255\316Z\026;\347\021A4\322`\354"
+	.ascii	"\262b\316\272j\001\201Eg\364\"4\207\213\372\307\347\370D\213"
+	.ascii	"\233F~l\200\303\023\3227\351\022l`\336\352$\341\277e&\347\274"
+	.ascii	":%P\360,svvpM\235\260\337\276t\007\327\21051\221\373\251\253"
+	.ascii	"\263v\271\215\303\030q8\317e\215`\216F\265\364(wC\211c\"\265"
+	.ascii	"\270\031;B\214!\"\b9R\244\n\205\250+\253\252+#C\256\234v\204"
+	.ascii	"\030W#\034\021B\025e\244\212\212\252j\212i+\310\361\303\001\324"
+	.ascii	"j\310\221!T(\bD\370\210\221\023"
+	.ascii	"\252\246P\"7\222\343\352j\310T\225\025\217#WU<J\270\242\":r\005"
+	.ascii	"B\363\360\261\003\004\252\251t\247b\224pE\0255dJH\bVC\216\030"
+	.ascii	"!\022e\204\210\020\252\250)\253\253\250\030M[U\302\020\253\250"
+	.ascii	"#UUVQD7\255\237kc\331\"`\314\312\304\241\2771\375\333\205\177"
+	.ascii	"\300$\313\304\245A\2024\367\326~\210\257\324i\202\204'z~\030"
+	.ascii	"\310\264\221{\362\026u\3008u\331.\0314J\346\262\311[\310Q\243"
+	.ascii	",\201\001\221\306@\203\224G\023Q\322y\352\022<\036x.\210\321"
+	.ascii	"\027p\220Z\3201\276\272N\005\243\263\300oG\005\275\203\210\236"
+	.ascii	"S\371\254\251\240\177\203\230\237\032\005\0234\005M\032\215\334"
+	.ascii	"\004L\tt\264\004N\032\356\214\216>\232X_\0049:\002(\355\203J"
+	.ascii	"\247\315\344\350\277\035E\023\273\303l\323J\362\225j\202\340"
+	.ascii	"\201\206\240\017"
+	.string	"'\326cT>b\036\300\341@\343h\240\035\220\322<\204i7u\n\025\325\212\225\364h\003B\250\205\260r\177j\370\237\222K\212\201\226Z\240\031 \35340\013(\220@+\200@'\320/\353\033\324,\215\326_T-4\250]\272\244G\021\350\263\021\273\313\353\257\337\245!\330q\236\027\231\341\233;\362\2351u\331\006\375)\2758\272\205\204\022\250g\320\277s\030`e\354\274\321I\302\177\247\241\347\315\313\322\215\003\372\206\227\326\302%\217Y\226\003\2306\fh\033g\215\305lIv\305\20015ht\r\365KSQ\351\004\3459\203%\271v<I\025\207\363\310\312\334[\237\265\261\236\242\202QSw`K\217\322\350\347\211\211\231\nTr\0250\243\013\350\367\275h\244JG\330O\032\212\032\206\007\365\355-=:\243O\207l\252\245\321B\373^4'\016\263\225\314\304\031B\271\244\216\004\322\327F\267\214\200:\020 M"
+	.string	"\nM@\022\220\376\332\177s\037d04\253\366\234\226&\332\251\251M\310\350\246~\235aT\313h\024\256\013mLT\177\211\304\303l\323\262\342{\016)\312>*\332\nE\253\200\321(\372s\312\234O\365\001F\277x\321\275\304\316\006|9\347S\341\240\342T4*4T\007\311\226\350\255i\027\332K\215*G\205>_\037Rs\315\251})\n}\275=&\222\312\315\3424\031agt\257F\267\024A\375G+\371\321\0024\216\274g\265"
+	.string	"\335x{\376\364\361:\372\321\017\202[\250\002!)\021R\250\f\215\314\210\314$I\2061R\013\020\210#q\026k\352\001\022\340S)M\303\3121#3C\232Bc<\302\341$U;B\327h\"\2609\rE\261\354\3400\322\206&\024\367\312B\003\215\241\234\036}^\217\365\247\0315\013\332h\335\020\210\006\001]fC\337y\310+a0\215<\243\322=[\030\264\007"
+	.string	"\\\323\"L\311\r\221C\325\334U\331\007\261u\212?\300J\b\333\257L\233\355\330l\215~\251\007|\031=\226\3716rh}H\2703H\352\333ix\345w\333\205z\026\361\230\t\206\224\365=\312\342\346\227@N\374\t`\026\361\334\3170\327s}\237\201\216\330\301\247M\233\214)o\023W\270\254:\217\177Pk@\342r\023\200=$\204?\022\375o\360L\255qq^87\243p\207q\301\254"
+	.string	"\217\273;\030\320\216Z\315z?\2016\031\223\\P_\204]\370\037z\202\037fE\367^\266\232.?c\241~\341L\005\"\324\025{R\213t^\230\326\3503\335V\370\005\363\334\313\343*\030\007UO"
+	.ascii	"\363[P\330\260\326BrD7\243KS@-\257v\344h!-\235'P\2707\301\023"
+	.ascii	"\350\017\230I\005\230\307\232F2\031\300\333\203\343'\302}\361"
+	.ascii	"\313v\301O\277\267e\342S\367\206/wc\213Xt\025#\336m\367\013\236"
+	.ascii	"\332\b\b\023\026\204\311\3076\337\031\304\006\243=\2151\241\356"
+	.ascii	"j3 H\333\030A\230\275O\t\245Mn\232\001\371\262\304\033\200\361"
+	.ascii	"j(\ne\222\355\355\026\237\035,\363\344OF~=\371\231\004\030J\272"
+	.ascii	"\302q\366\004\022\b\002\007\013O\210\r\343,H\331\313v\035\207"
+	.ascii	"\214iu\336\347\326\272\340\bf\177\3401\037\312\020\321\366n\371"
+	.ascii	" \206:5\255\024\022\322\326\230\255]\301\035$H\004R&\255\333"
+	.ascii	"g\020d\357S\026$!\0059\330\317\3166\2057_\246\305%\t\314L\001"
+	.ascii	"X\n\177}"
+	.string	"\222\374\216\254\326\005\t\360\0342\362\rR@U ro\346g\335\027\202\204\260\001.\246\261P\024\363\316\001\251\250C}\003\303\203\276\376\001\233f\231\263\212\331\365\217\206-\203c\3556\245\303\022\300>\320\214\301\317\213\201@b\210\265\335\370\361l\351\314>\351S\310\027Y\020<<A5\334\362\303\366\355I\355\366{\250\204\rD$Y\305\275W\005\"N\351\r\031e\306@\206pO\320\021X\220%[\263\005\212\006\001\257\030\352\004\363)\245\214\213ust;\274&I\306\031\261\032\322\301\031\022\262\367\230\215\037\205\334\006C\241\247\344\372\341\r\372b'\320\377\2349\260\316\362->\3229\236\352\177\213\231\212^i\fGr\263\201\021\237\232\250Q]\25446F\335\020@\350\\\264\b4\n\216\363V0\362\302\314(\230\277d\324\345\367\f\254\032q\262\256Y\231J|h&\257Mp:\243\023[Hs`R5\026n"
+	.ascii	"\260\337\376\360w\032\233\227\221l<\347*3\367\336\215\361\234"
+	.ascii	"\322\325M\225\246}q\200\240\311=o\t\001\204\343s\317A#H\221 "
+	.ascii	"\306s\215\275\3125:\243uHH\201\332K\300\200D\213X"
+	.string	"\306uHk\201\017\032B\260\004\355\037\0260\226\025Yx\025\016\305\2224\224\341\360\265\375\f\253{B\032kM\00230ter\357\360\233\277\234Il\272gn\236\313^\341\210\005g;\2138\342\204\361\304\007\323\366\271\222\217-v~\265\206\224Q\3344\325\301\352'U\366\231X\255\224s6\316\240=rH\366\263\024\377\"e\224\035\211\236\221\355PT-\250\354TR~\335\234\213\360\326J\245U\035\006\266\206\301DZ\327Q\275y\323daH\224R9\257\td\362\3036\031\036U\330\205\300\251@\203\307\366\310\036\026\307\321!\355v~\363(\013H\232\263\225&{#\374\264\207\004\363\211$\364\263\302\303\224/J\207C\326A}3\201\316\\\343\nD\231]\273\343!\026\264oK\275iF\372\367\343j\025\240^\274k\001,\2363U\260(\234\350.\342\203\361D\304B=\252\336m\002@\205)\260_V\211\321D"
+	.ascii	"X\240>_2P-\025\255\274\241\367GV\244\251\271j\312\025\234@\f"
+	.ascii	"\372j\fA\302\307\030\017\230`\360\330\345u\b"
+	.text
+	.section	.gnu.lto_mspProcessOutCommand.168.bc614976d68a8951,"e",@progbits
+	.ascii	"(\265/\375`\027\200\355\240\001:\327\002\230R\0200F\351\f\007"
+	.ascii	"\177d\022\330n\230\n\013!.b\256\242\352V\303T#\027\236\310\215"
+	.ascii	"\230\335\017\304\f\261\002\256\337\237\371\254\021]d\007\027"
+	.ascii	"W\300?w&>\235\231\370tf\346\327\221\321W\247^\1776\361|\364\237"
+	.ascii	"\241\275!\240o\212\031\b\332{')e\t\t\203\b\f\nO\305\336vzo\023"
+	.ascii	")\366v\323{\233\311\330\333\312\367\366\222\261\267\225\336\333"
+	.ascii	"C\212\275\235\364\336F2\366v\362\275}d\354m\243\367\266\020c"
+	.ascii	"o\007yo\003)\366v\321{\233h{{\350\275\375\243\330\333>\336\333"
+	.ascii	"=\214\275\315#Do\013}\320\333A\357m co\357\b\321\333?\034\364"
+	.ascii	"\266\317{\273\247\330\333<\357md\261\267w\336\333:\305\336^\337"
+	.ascii	"\313\205\305^&|/\017\026{Y\360\275\034X\354\3452\357\345g\261"
+	.ascii	"\227\001\337\313\177\306^&\023\242\227\307\274\227\305\030{9"
+	.ascii	"\314{\031\214\261\227\277\274\227\375\214\275\334\367^\3463\366"
+	.ascii	"\362\336\210^\326{/{\031\321\313]\336\313y\357e\274b/\337\275"
+	.ascii	"\227\355\212\275\\\367^\346\362A/oy/ky/g\361\240\227\235\035"
+	.ascii	"\3642\335{y\216\203^\226{/\307\275\227\341P\3642\226\367\362"
+	.ascii	"\333{\331\315\330\313m!z\231-D/\257\025{Y\355\275\234f\354\345"
+	.ascii	"+\357e4c/[y/\237\031{\331\354\275\\f\354\345*\357e2c/Sy/\217"
+	.ascii	"\031{Y,D/\207\275\227\301\214\275\374\025\242\227\247\274\227"
+	.ascii	"\275\214\275,%D/Gy/w\031{\231+D/o\275\227\265\212\275\234\365"
+	.ascii	"^\306*\3662\224\367r\263\330\313W\357\345'\305^\266z/;)\366r"
+	.ascii	"\223\3672\223b//y/+)\366"
+	.string	"r\222\3672\222b/\037y/\033)\366r\325{\231\252\330\313S'zYj\203^f\276\227\243\212\275\\\344\275\274,\3662\224\211^~z/;\025{\231\210\211^nz/3\025{Yi\242\227\227\336\313J\305^\036R\242\227\223\336\313H\305^N\226\350\345\243\367\262Q\261\227\205\224\350\345 \357e \305^.*\321\313D\357\345!c/\377(\321\313>\336\313=\212\275\314\243D/\013\275\227\203\212\275\fT\242\227w\274\227\177\212\275\354S\242\227{\336\313<\305^F\226\350\345\235\367\262N\261\227\327\022\275:\336{,\366\346\224\350\305y\357M\261\327\346\2759\212\2759\2747\005\357E\301{O0\242\027\307{o\274\327\306\210^\023\274\267\004\357\255a\354\305!D/\215\020\2757\274\227\004\306\336\021\204\350\265\341\2755\030{i\b\321;\303{g\024{ex\257\fc\257\bB\364\306xo\b\214\275 "
+	.string	"\321\373\201\355\365"
+	.string	"\211\336\016h\320\313\001\rz7@\242W\003\357\315@\261\027\003\357\275@\261\327\002\"z+\360^\n\024{' \242W\002\357\215@\261\027\002\357}@\261\327\001\"z\033\360^\006\024{\027\360\336\030\212\275\n\030\321\233\200\367\302P\354E\200\210\336\003\274\367\205b\257\001D\364\026\340\275.\030{[\b\321\313\302{W0\366\252\020\242\227"
+	.string	"\357\035\200\261W"
+	.string	"!zSx/\n\305\336\0236\3505A\203\336\022\336\033"
+	.string	"c/\214\fzI"
+	.string	"\321;\302{_\030{]\204\350m\361^\026\306\336\025\031\364\212"
+	.ascii	"\242W\005\210\336\024\357\r\001D/\b\306\336\017\336\353\301{"
+	.ascii	";(\366r\360^\024\306\336\023\3575Q\354-\361^\022\037zG|\350\025"
+	.ascii	"\361\336\r\336\253\301\366\206\370\320\233\301\207^\020\3575"
+	.ascii	"\276\267\270\275\037>\364z\370\320\213\301{/xo\207\355\265\340"
+	.ascii	"Co\005\037z\001\360\336\232\367\322l/\361C\357\360C\357\314{"
+	.ascii	"\325\367\246\333\213~\350\375\366\366{Y%b\301\005\271e\312\023"
+	.ascii	"\275\337u\255?\n\005Wgz\005I\017\341F\342\026\302\r\204\373\007"
+	.ascii	"\267\020\367\016\356\036n$\367\312L\310,\310\\\206\371\013s\036"
+	.ascii	"\363\035s\035\263\026f'\363\0343\034\263\025\346+\314j\314l\314"
+	.ascii	"`\314b,b\227\225\266\306\202\2361\277\244\255I\253\362c+\246"
+	.ascii	"\340\025\007\372hq\230\177\200\353\272\326\030\241\361\005\331"
+	.ascii	"\032\232%PW\026\240\007\272h9\311tvE4\264\004\202\366\261|\205"
+	.ascii	"i\n`\217\346\301\344\332\021\243\203\226\335\224\177W\333?\333"
+	.ascii	"@[\303\351\016\031}DCN\333Gk\217gk\0329\343\202U\313\312DxZp"
+	.ascii	"\374c\330:d\205ZF\222\fn\r\226\300\255\231K\201\305\345\026\227"
+	.ascii	"tkK\272\221`K\322\300a\026gi\r\020\314\224\031\240Y\022g\251"
+	.ascii	"\f\260,I\242\212\233\r\354e\217KU\256\326u\255\351\2625sL\254"
+	.ascii	"\037~w\313x\202v[\303i\035\215\254f\340\317p\213\227,\350*v\200"
+	.ascii	"&^\222u]W\310-\323m\315\334\256]5\345\270g\030\007\327\2449\246"
+	.ascii	"c\310\351r\031\277\355\326\254\t\330mm(\251]QYF\3434^\343\266"
+	.ascii	"\255a#\001\021\336\223\247\337\272\016\325P\243\221\365\244\314"
+	.ascii	"\fWv\215\327\242\225\201\240\232L~\353\272v\300\214\317r\330"
+	.ascii	"J\215\023<]+Q\007$YW\026`\fCNO\240&X\366b\262\335\232=\001S\331"
+	.ascii	"\027\251\371)"
+	.string	"\263\326u\255\341t\227\245,\207\361\330\326\210\335\360\352\263\346\200j+\364[\327\256\025\234n\nCNy\n\177\3450\330\215\023;]\253NM\217\230X\026\340\272\016\255\340tM\260B\263'\330\255\341\364\304n\316n\315\356\242\275\313[\314\225\303])`\f\326\025\352I\302\220\323\355b\243\312\351\220?\250\234\356\233\263n\366\353\252|\263\262\256]-V\204!\247\273\2730L\310Y\035!zt\276\214\360\304\313\317\027\340\272v\275x\024\006\030dP,\026\003\320\241C\007\023\326\314\203\007\260\027\357\341\002\024\036<t\360\177\205\213\335\035a\207\033\354n\027\r\rM\n{\001\243]\274#<\350\340\325\262Y\326\271t;\267r\033\267p\213e\337\326m\333\226m\327Vm\323\366\312\242\255\225=[\263-\333*K\266Tvl\3056l\301\366k\247\254\327J\331(\333\325\002\013+\250@\200\001\b \005\024N0\241\204"
+	.string	"\300 a\204\027.Z\260X!\202\212\024!\200\360\201\007\035p\200\342\204\211\022$F\210\330@\203\020\031\2000\026?\354\235\007\f\026\357\202\016\026T"
+	.string	"\200\032\032\342pFM\321\357\226\345\262uk\267y\333e\275\254\336\356-_\353X\326\341\325\022\2051`\361\306\025v\226\205\n\257\223\001GE\350\270x\347F8![i\253W\016}K\372\t\213\313\342\205COda\365by\262\275\375\221q\013\003\326F\307&\007\266\006g\247\366F&\355\315\350\212\326\317\031\032\031\243R\201V\326\220~\316\316:)\251\327L\313\223\222\267\254J\221\212\023\276 NOK\274d \234\220J\235\304\250\222\023rH/\025'FcJ\212\210-\200\311.\314\210Q#'d\217^0\037\274_KVS\206\024\361:2\222BE\210\331F\t\302(\226\f\025\366v\241A\264<\355\340\026\2020\363\b\002\342#\210\323\323\016f\001l\205B;\025Z\320\373\t#\300\323h"
+	.string	"\177`\002\030\352\353\024"
+	.string	"\031\205\036b\224kI\211S\021 \237\200\242\353\272\252\260\256k\363\320k\023\366\270\004\364=\200J*\224\371\341\322>]:"
+	.ascii	"^\030\206\\\021\022\232\207\256G\300\343\027h\212\227\0266\200"
+	.ascii	"\243\252f\353\310\265\2139n"
+	.string	"\221\2007\037\026\350\005q\350\bXz\005\034\213P\310\250\226\021%NEp\254b\315'EZ\221\020\320@\230\341\002\373@k\313\203A*\335\001\031s\020\250\325(\306\370\204\030\233\200\302\242\362\305\251H\214K\240\"\370\241\221\341%C\\\250\361\307\221 \016d\024Z\206\266\232\004\372,nN*(\243\346\030\fV\217\310b\021\350\214\217!\273/}I\334\245\331\033@a\r\230G\230\222\271\020\350L\317\217#)\224\361\273\302xG:\003$\f\002\217\321\246\240\022\247\"$l\034\333B\325\305*\376P\305{w\226\205Q,\031\222j\017E\212\246\030\003\336\231\342\305C/X\327u\204\023\322\r\035\001\305\222!\246\276\240H\021\223;\320\361PLS\356\213S\021\223-@\341T\244\344\n\226"
+	.ascii	"\240\244\354\232!q\214b\311\220\262ix\2141\360\240\211\365s\026"
+	.ascii	"\304\351i\214\211=KAX\236NEH<\3242\224DO\254\353\312K\206\220"
+	.ascii	"z\346\347\215Q,\031Bj\325\210S\032\"#FQ\021\224qA, \352A\215"
+	.ascii	"Y\236\364\270\215[\210\210\247\357\205wK\357\361rQ\362\326u\340"
+	.ascii	"\203\327n\2147\217\214\267\313\034\257\027<^=(\274{\235\305\313"
+	.ascii	"\2475\007\304\344\203BX&\360i\244\212J.\016\356\255\254\312\240"
+	.ascii	" \226\267\253$\032\"d\363\n\311\021\251)3\036LHI\267<\263\262"
+	.ascii	"*?\204\202\316\310\330i\310\210\312QGQ\212NH1\022z\306\205u]"
+	.ascii	"\267\203\210\212xk\360.\215\332.\253\260\213#0\030\350\257}\367"
+	.ascii	"\230v\\k\016jq\316\302E\2670iN\236\353`\360\345r\r\207Z\"\226"
+	.ascii	"\016\250\230\247],X\301W\273\320\356n\013\276\332\231\320\253"
+	.ascii	"\013O\227a\025u~M\027\260\340\253\035\025\363\017Oe}0\232\305"
+	.ascii	"\212\263\020\341+\336e\025h\025\337=\276\035\341T\016\022\341"
+	.ascii	"'x\256\263)\016\302U\234}\260 \273pCx\212\263\217\337N\027\356"
+	.ascii	"\323\036\302Q\271\335\034\330>f"
+	.string	"\317NHa\367(w1G:\027xa@8\323q\352\246\324\327\274\262\323\205\337.$\233\250j\222\354\360\345\316\f)R\001\017\361\001@\333\325\240|\243\316 \201\321\f\371F}\332\205\326\202/9\352(J\005\207z\241\235V\233!\331\001\3000\375b\367$U\232\343\251\371r\345c\240\372\301\331i\217Y\336\345\0308b\367\270\345y\307:\020\314u]O\340t\177w\274\343\3351\357\350\305\213\312\351\007\3478F\375\224\352\236[\\\230\307\230&\354\310\312\323O\247\007i\276\\\n\260\rS\240S\300j\246\303\033\023\233\322\210\250\220\250+8-\272\320.\t\320uuj\201\331\230\375\244t\341\306\320\251\217c\337\361\013\036\23000\364\356q\314\361\2579(\365qU\f\314\027'\322\003\357\232j#\316\331\223\026\235\335N\247\203\312\002\274\313}\216\004\313U\234n\013<NQ\336=\225S5\247\017\277=\001B\206"
+	.string	"\375z\256\263\234\026\235\337\210_6\217`\031\036j9I\"\210\027\2579\236.3\363%\277q'\2038\247\274l\221\343\3512;\344]S=x\n\364.\363\201\202\354\302\245\201wME\311\334\203g\200\034+\364Q\"\273P\375r\267\211\263\347:*\0309&i\013\335\001\007\357\340]v|rp\324\n\030%-t\013n10L\316\236\353\034ln\rM\342\023>\325\341\202\345\225\307\323e\026F\277k\271\360\256\251(\376\256o\373\210Av\341\2368\212}\331\315\216\201\313U{\034<\0266\007q\272|,T9=\361\243\022\3303\271\323\205\333B\233@\352\350)q\023*\364\256\016 \035B\315A%~?0HN\344uV"
+	.string	"}/\366\340\207\016\"#\247\017\211\237\350\271\316\2168\211\263\210g\360\021\033\\\304[|\245\032|\203\277\030\fq\r8\304k\234\200\270\207g`<\210\247\330Cy\327\324\342\215g!\367\341\305\013>\234\206\t\203Wp\017\027\034\203\223Xk\301\035~\301S|Y\360\016',\370L\023"
+	.ascii	"\037\276\202\232\003\340\032\f6\357\232J\363\232\217\330#\236"
+	.ascii	"fH\274\232\326\304s\235\235\371?<\377\004Av\341\252\237\271*"
+	.ascii	"\307\202\323\253\327`\315G\020\331\205\213>E\3213\\\323\177\376"
+	.ascii	"!\334\351\302=\241\233u\bQwu\034\351@j\016\352\037\020\214\020"
+	.ascii	"'\317\n\2661\344\354\271\316\302\350\324yT\347\273:\226t05\007"
+	.ascii	"-\2671\212\325\324s\235}a!\357\232\312O\235\337\376I\"\273p_"
+	.ascii	"4\263\216'uW\307RGTs\020\377\200}\317\025\315n\334\246\203\n"
+	.ascii	"\005\346\272\256\034\264\253\303\210\016$\315A(\231s\033\027"
+	.ascii	"\255\364\215q\362\\g;\013\363\030\3030\350\004\364\323\351\301"
+	.ascii	"\335.\344\235d(\221\241\311\214*3t\261ao\004]H\202\235\033z\230"
+	.ascii	"i|\271\273\247\342uA\247\007\227\231\246\231\265\003\207/\221"
+	.ascii	"\354\223\374\2159\263\256\326\246\252\275\221\345\343\275/\227"
+	.ascii	"\332C)\225\330\257\310>j\371ZM\217\271\236\366PY\177\2725\355"
+	.ascii	"\211`q\341e]\255M_\332+\031j\207_\326\325\207,\237\210\277\244"
+	.ascii	"\021\337\250\311=\322\362\361`\217\220\275\321\3621\241\240R"
+	.ascii	"\211y\212\366@\226\217\007\235J%F\376\330\017-\237\bb\222\204"
+	.ascii	"<\366=\226O\004=\267A\240}\320\3625[\225RI\360>\373\237\345#"
+	.ascii	"\021\226\004<r\317\263|%\366\222c\276\356u\226\257D\235\337\340"
+	.ascii	"6a\237\326T\231\355\300=\254\275\277m\300\345\033\352\311\001"
+	.ascii	"f]\255Mb\266\307xA\333\221dm\372\262\r\246\013!\337v\337\362"
+	.ascii	"\221\320s\313\363\262\255\267|$\350\222xx\333ywXBI\326\246\272"
+	.ascii	"m;\273\246V\022-\333[\226O\304\237[\335\226_\326\025\335\266"
+	.ascii	"s\371Vpqs\306m\313\315\265)\223\274mcY\276\025S\342\330\266\333"
+	.ascii	"\226O\204\277$\226\264m5+kLI\326&+\333hgTe\333f\313\227\202\214"
+	.ascii	"[\031\225m\262\345k0?\245\022Y\330\266\030XO\312\004\314\272"
+	.ascii	"\232\262\375\265|*\300\222R\242lKY\276\256\322\244T\352\332\332"
+	.ascii	"\346Z\276\022f\311\025\260\266\263\b\300M\253\026^\222\253\355"
+	.ascii	"\346\362\r\007\300=\247\363\313\272Z\233\234l[-_\227U\235\260"
+	.ascii	"d\233\311\362\361\237\240R\251\004$\333I\226/\005a\022F\325\266"
+	.ascii	"\221\345K!\347\306Bj{j\371\372\353J\251$B\221\355\250\345+\021"
+	.ascii	"\006\302\3236\324\362\225 \223\344\240i\233\310\362\361\035\027"
+	.ascii	"\245\022\r\337\250\234v\320\272\256\353\252\202\323\335V\356"
+	.ascii	".\337p]uX\271\273\313\307=)\2313\353jmZUpz\302s\024ff\037\226"
+	.ascii	"\037\312\325K\023\356v!\031]\327u\355/w\031]\327u\335C\355\362"
+	.ascii	"\035\257\352\203\353xU\036\335\303\253\n\365\016^\325\247\205"
+	.ascii	"xS\277F\342M\363<\350M\357\212\275\251\226\367\246\316\367\246"
+	.ascii	"s\357M\343\336\233\242\2757=k!\274\251\024\024\275\351\325{\323"
+	.ascii	"\"\266\302\233\372\340+\274)\020\253\361\242dx\216\027\025\303"
+	.ascii	"N^\024\fk\341E\373\270\f/\252\307\202\274\350\035\023\362\242"
+	.ascii	"j\275\362\242b\215\344E\247p\036/*\245\201\360\242R\357E\241"
+	.ascii	"@\350E\211\200\320\2132\365\017^t\t\204^\324\210\277\360\242"
+	.ascii	"E!\364\242A\334\305\214\352p\026\363\t\267\367v,\306\373\272"
+	.ascii	"F\342=\227\026\302\373-\r\204\367Z\372\007\357\263\264\020\357"
+	.ascii	"\235\335\303{\272F\362~\256W\336"
+	.ascii	"\3131!\357\343X\220\367p\\\206\367X\370\013\357\3378\217\367"
+	.ascii	"n|\307\3736\326\302{6v\362~\215\347x\257\306p\274O{\357\257\030"
+	.ascii	"{\217\366\336[)\366\376\354\2757+\366\276\354\275\257R\354=\331"
+	.ascii	"{O\245\330\373\261\367^\254\330\373\260\367\036\314\330\373\257"
+	.ascii	"\355\375\224\367\336k{/\345\275\217\362\336w\205\320{\256\367"
+	.ascii	"~\253\330{\255\367>\253\330{\254\367\036J\261\367\315\367\376"
+	.ascii	"\312\330\373'&zo\365\336;1\366\276\211\211\3363y\357\227\024"
+	.ascii	"{\257\304D\357\223\274\367H\214\275?b\242\367F\336\373*c\357"
+	.ascii	"\251L\364~\352\275\227*\366\236i\242\367Q\357}\221b\357\227&"
+	.ascii	"z\017\365\336?\025{\357d\242\367D\336\373\246b\357\231L\364^"
+	.ascii	"\371\336/\031{\257\364\336\0171\366>\351\275G2\366>i\242\367"
+	.ascii	"G\357\275\221\261\367BL\364>\310{\017\304\330\373\242\367\236"
+	.ascii	"\310\330\373\241\367\376\207\261\367>L\364\276\307{\317\303\330"
+	.ascii	"{!\023\275\017z\357\201\212\275\337\361\336\377\024{\357\363"
+	.ascii	"\336\367l\357y\336{\244\261\367;\357\275\216\261\367\353{\273"
+	.ascii	"\260\330\333\204\357\355\301bo\013\276\267\003\213\275]\346\275"
+	.ascii	"\375,\3666\340{\373\017\204\336&\363\336\036\003Bo\213yo\207"
+	.ascii	"\001\241\267\301\274\267\277\030{\333\357\275\335W\354m\276\367"
+	.ascii	"\366^\261\267\365\336\333^\212\275\335\345\275\235g\354m\274"
+	.ascii	"\367\366\235\261\267\355\336\333u\306\336\346\362\336\336b\354"
+	.ascii	"m-\357\355,\305\336v\276\267\351\212\275=\367\336\226+\366v\334"
+	.ascii	"{\033\256\330\333X\336\333o\305\336v{o\267\025{\233\355\275\275"
+	.ascii	"V\354m\265\367v\232\261\267\257t\320\333h\333\333V:\350\355\263"
+	.ascii	"\367\266\331{\273\354\275]\345\275MV\354m*#z{\354\275-V\354\355"
+	.ascii	"\260\3676X\261\267\277\336\333S\212\275\355\365\336\226b\354"
+	.ascii	"\355(\306\336\3562\3666W\261\267\267\336\333Z\305\336\316zoc"
+	.ascii	"\025{\033\312{\273i\354\355\253\367\366\223bo[\275\267\235\030"
+	.ascii	"{\273\311{\233I\261\267\227\274\267\225\024{;\311{\033I\261\267"
+	.ascii	"\217\274\267\215\024{\273jDoS\275\267\247\212\275-\365\336f\032"
+	.ascii	"{;\312\330\333E\214\275\275,\3666\324{;\315]\362\316]\316e7u"
+	.ascii	"3@n\356@\300\273\311\233)\272\361\342\001Q\3369\211I\360\271"
+	.ascii	"\205ww\306\273\331\233\3611\303"
+	.string	"c\246\307M\337\315\227\2330aTN\371\356<\304$\330\264c\265\263\035\t\225\353\316j3?3;n\226\253\366f\314\315\337\315\237\312)\327\235\225\230\376\3748E\241\234S\205/w\271t\320\231\213\023\225\267\274\203\2363\310\233\300\231\235-\317,\351\3359\313\023\225\235O\357n\006U\302\233\302A\347\230\346\\\373\234\347\260T\226{\373\350\250O\034$\240\3349\211I\f\\zu\206;\2171\006\205\254CKe,O\257zT18?`\32408@B8=z\250\2342\226\363\030\253@+lRj\005!\300\227\273nmg7f;\267\235W\346\2653\333\017\265\357\370\264\247\362\341\020\001\301\021\"d\255\t\023\227\346\021\257\013\003\370r7\355\3129\355H\355\222w\345\211f\345\214\206\244\332\325Y9'a\222;3;\237\235\313\206\250Zp\242\234j\026\234%&\034\"DTN\331\214)\356\271E\304\353\202"
+	.ascii	"P@\227\236N\235\260\202\237%\005\344g9\247\220\345\350\322{\210"
+	.ascii	"'\340\365\354\363Q\"\313\252\234\313\236T\271$qpU\330\310\250"
+	.ascii	"\234\311\316{K\325\r'\212\250d\260\252\215\215\312sL\354<\026"
+	.ascii	"v\026\223R\323\230W\320\302\326\232`_g\260)\347/*\325\f\252\254"
+	.ascii	"\312\224"
+	.string	"\247\227\224\263W\224\263\024#\352\330`\223XX\224\263\021\223Zs\253\213\353\334\265u\346:#Q\247\034\237\210J\004\005\201\354\346\220\245z\341(I\305\214\306|DQ\245\3400q\202\363\244\271\365&\342\324\210\351\f\205\024\220\260y'\302''\224\220\372=\235\222a\005\337y\241:\276\363\315c5\301\371\324\357\315\203'\340\005\030\346\243Dje\235\265\260\324\254,,(YaXP\316XZ\352\223++'P\316JLa\315\255\235\346\325\271\271DI\223$H\256\236X\235\237T\035\201\\\340q\251T8k\304,\202I\246\244\254\316P\230\300\232N\232\234\235DQ\213T-\241\232\234\225\230\276\236L\226\234\231x\251D\216@\304,\202\314\037\2739l\251M8_\317\340K\334\217\231Re\302\t\033\303!+[\362\356\301\251\022\323WSi\216\007\260\004\030\252\320\323)\031+\370tE\272\267\017\303I\021\332\013"
+	.ascii	"\335U\241\267\017O\300\213\257\317G\211T\222\344\254\344LEJ\352"
+	.ascii	"\035\031%Ar\344\214\004M\005r\004b\301\\\2344\265\bg\215H\364"
+	.ascii	"\207\247\314\"\032:rN\242\034ln\355\030\251:\033iS{\034\201\210"
+	.ascii	"D\177\\x\bq\325sk\207j\352Lu\336\303ySw\250?7\300\340\300\re"
+	.ascii	"\250\234\362\324\271H)\330\334Bk\226\372.\016\035N\226\346 \325"
+	.ascii	"\347L\324\204\263E\345\301\251\253\200\310_V\013\355\346\320"
+	.ascii	"\245\"q\356P\343\0271aJ\252\216\272\203\223\207\343\005g\017"
+	.ascii	"\247O\345\224\245\336@\234\252)\377\030m\307Y\035\f\026,\026"
+	.ascii	"\230\326P\002\321H\370rk\260\274@\247|f\352\206\305\371\202\023"
+	.ascii	"\306\004s]}8\350s\027::Q\231\371\027R\301\034\244\034\235\f\227"
+	.ascii	"g\250\2342\363\315\303\306/\241\244\021H\340\317\035\235\362"
+	.ascii	"\f\236\366\350|\232 \243\212\234\243\230\347\"o\036\206\200\327"
+	.ascii	"\336\335\017\341\213/\267\246K\013T\354\351\024\tV\360\345.\264"
+	.ascii	"k\352\345\336:`\236h<\\\310\035\025{\006^zt>J\344\022\352\274"
+	.ascii	"\034\223\216\021\023\346\n\352\313\323]\323\211\310\331\351/"
+	.ascii	"\345\333\323\333\312\321yA\244K\323yKi\307\244<3\235\367p\236"
+	.ascii	"\351\335\r\nx\233\303\224\324\016'\360\004\346\342\f\246u8\205"
+	.ascii	"\\r\246\344\350\274(\200\312)+\217B\336V\226TK\001\2209==*\247"
+	.ascii	"\274\364\326\341tKi\327L.^\227\020\236\026_\356*\r9+\315\311"
+	.ascii	"Q\031\362\025\362\340\222\350\220\222g\244\026\251[\233\225\344"
+	.ascii	"\332\021]\323H\310\331\350\n\032\233\220\263 u\026\344\231\334"
+	.ascii	"\001Rt\006r.;WZ\205,.\347\310\004\274\242\257\220we\214\350\314"
+	.ascii	"\246\234k&\207~\234\207~R\260c\240\226\037S|\234\335\224r\317"
+	.ascii	"\036<\316=\200\322(x<\270\204\344\232A@\347 \2414\213\017\b\312"
+	.ascii	"\2163\2332\356\231\334\371\3619\377\234\313z\244On\206)T\216"
+	.ascii	"\230\234\243\241\317\211[Nz\330\224q\315$\213/\2278%\002\252"
+	.ascii	"\366tJ\305\n~\\\334\031\314\212\270\243j\367\340\325\245\217"
+	.ascii	"\007y\3469\357\201\245KnZ`\376H\225\344\224\3119B\001\371\026"
+	.ascii	"\244\220\360\316\271\220\3239e[3\271\323\205\"\260\016\257g\235"
+	.ascii	"\252\233\025\360\210R\252\225\327\257\220'\245\343\314\246dk"
+	.ascii	"&\2179?\236\313X\244EnX`n\016\220t\231#d\230B\035}r\216L\300"
+	.ascii	"{A\3454\347,H]I\211\244N/,Wm\016R\316\220!*\2478g6\345\3323)"
+	.ascii	"\310)\312\254\251\270\261\371\315R\252<\002)\245K9LDr\236\236"
+	.ascii	"TNm\316I\312\263\347\326\316\n\266\311r\366\344\310\3419\316"
+	.ascii	"e?\204;\3134y\0042J\217r\242\244r\250\250TNsH\2424\323\342u!"
+	.ascii	"Ez\226\202\247"
+	.ascii	"gFR E)x\262\026\024\234\265 I\177\370@\301\331JY\245\271\265"
+	.ascii	"\223\242\235\340)\232\222T(\207\311p]yN\330\024(\r\312q\362$"
+	.ascii	"\247\331T9=\301y\214S+e\330s\311\353B\b14\216\033\307\201u\343"
+	.ascii	"w+C\364\204S\374\r\202\200B\2151\312\304\t\3338\n\245e\343/\206"
+	.ascii	"6A\tn\002n\352\335\234(9^\315A%\370\335\376\350\234\310\353l"
+	.ascii	"?9\305\037\334\0075px\2153\215\343@\303\032\2507\234\306\271"
+	.ascii	"\314\007\n\362\013-\314\221k\201G\230S\006\002s\360\206\263\325"
+	.ascii	"\322\230&\tFp\022\330\360\021\204\241e\236\2006<\267vj\240\341"
+	.ascii	"5\234\313f8\rc\350\230\034\271\0269d\250\230\234\262\017P0h\230"
+	.ascii	"\2343\264\234\2644\225\323\031\316M\226\3044\311\374q9uz\320"
+	.ascii	"\203/\267\003\025\016\320\273\247S#X\301\207\203\373\2143\237"
+	.ascii	"\f\237q^C\375n\206|h_N\333[\016\034\234\312\251\f\347A\346#R"
+	.ascii	"[;]\330\001\334\321\273\233@\312\265\311\020\301e\304\270\b\316"
+	.ascii	"bh\227\0349<4/\207.'K\316\226\234-*\2471\316\203\234&-\355\235"
+	.ascii	"\203/\227\330\345\004\252\367\264\214\r+\304\201L\343\204\202"
+	.ascii	"9\205z,G\365\376\301\013\356"
+	.string	"\004\214\016\301A\360\020p\217\376\300ws\356r\362\232\203@@\005u\356\331p]\327\024\026\235C\351r\274\344\354\345\364\345\364\251\234~\340\307%\273\347\225\024t\256\3700\221\302\007\030%\345z\247? \316\236\353\210 c^\225\370ru\250\0368k\311\371\202b\321\341\002\017};\202\345\204i\301\\\327\025\001*\247\036\270\213<\016\\\003\357\300\331\247\t\262\0137\005/\234\272\201s\340\354\263\004\331\205{,\337\300\3235\356\351\335\234\277\234gs\220\006\316\201\374\301\371G\344D^\247I\224\021\201\026=\235\302a\005\377\r\035\342\277\235\301\260\022,@x#\336\216\026\375\303\026,m>Jd\0060\360\f\344\004\242i\\\312\\A\303\300\363\002\026\370\005*p\013\f\242f\316gY\225\n\304Q`\002\247\200\004>\201\234Bt,\013P,L\002m\317\b@\340\021\320A\247\\\375yI\201\300Ym\251\255\271\365"
+	.string	"\007\374\001\r\270\003\316H\224\3538\244\002\"{M\310li5\340\311\200\005\234\001=(\224$c\232W\0138\253-\261\305\240\200\307p\336\373A\235\034\201* \262W%f7\207*h\223\243\3203\310\302e\t\312\344\330\343\307\221\b\210\312\251\002\316`8U[Zk*s\212\370r\211I\032\240R\236N\321X\301w\273\020\033\337\355\334\205\211|\353ce\266\201\333Q)\367\360\344V\030C'\200"
+	.string	"{\024\202\036\251Q\203\246'\346\213\221\252\004\234\241,\231=a@\300a8\300\021p\204J\371\3711\243\016p\276Z2kn\355\274`\200\277P\200\033"
+	.string	"\t\205:\016\251\211\242\247\327\367\344T\200\363\325R\331\323\205\026\356\002\013oa\te\302\343S.\261P\326\\A\205\257@\200\253\300\204&q\331CJ\022\340\fe\251\312skg"
+	.string	"\002\370"
+	.string	"\316{)\\"
+	.string	"G\"\250\220\343S\r\232\236S\231\245\267\233\203\031\032\344\270l\023D\376z\360\262\326uM\241\b\005r\214\222:R\031Q9M\341\334\205S(KU\232[iU\312\200i \200\276\200\n\372\343\310\244\004s]w8h\321\036\250\217#\022%G&LX\214\fR\3371\21713\311\0349C|\2715P@\250>\236v1\256\340\267\251<\376\2663\241W\034O\227\3419\302\273\275\f\332\256\3728\210-gw>J$\n'\034\005\023~\302\331\n\nttr\002\336\272\362\244\260{|\202\3568r\275\300[W\236\0238]\324\007\37596\275TNM8\343q\212E\211\360ye\247\013W\355\213\252\016D\tWy\274\007E\320\213\362\034\265\232\203v\004\024y\344\212r\364\332\343\3271\2549\250\204\263\035\027\305\302\3749\231x]0~\271D,\037\320\276\247]hX\301gc+\262\035\355\373\207'3\272"
+	.string	"\300x"
+	.string	"H8\214\021H\270r\302=\373"
+	.string	"o\354\203G:\027x\201\027<\222\225\035\317\316TNG8o\341\324H\211\314\007\0320@\301<\355R\303\n\376\332\232\207\265\243`\376\341\311,\354\205\213\277hq\027\001[\203\213\034l\274\310\301\306\207\255\301\005\0161n(\001\bn\250\361\202\203\255\301\305\r\0348\314\240\201\343\306\tF C\f\023[\203\213\0333d\250A\003\0042l\274\220\241\301\326\340\342F\r\024\330\230q\343E\r.n\324\200#\006\215\0278\324\240A\243\206\214\rr\250!\202\313`\034f4`\006\215\0308\314\330\3003n\210!\343F*C\r\007\340\250\201\006\033n\230\241\303\r\0346\030\200\206\0307\3140\304\201\303\tj\2740\003G\016\021\020o\320\020\343\006\030f\334 \202\0307l8"
+	.ascii	"\r8\330@\303F\f\0178fP\340F\f3h\330P\201\0318b\034@\006\016\033"
+	.ascii	"\027\340\220\241q\334\220\341\021\240\200\003d\240!C]\031.Jp"
+	.ascii	"\203\306\213\0312b\314`c\006\016\034lx\201\203\r1h\274\220a\343"
+	.ascii	"\306\013\027\"\266F\tf\330x\201\243F\r\033/jvw\273v\370P\313"
+	.ascii	"Qx\250\367\306\025v\026\203Y\207\312c<\024|\323\n;\013\001\n"
+	.ascii	"\307\267\273\335\327\205\235#\013\013\013\201D@T\2477\006\314"
+	.ascii	"K'\006\030\037L\035\031\245V/I-y:uz0\0047z\b\b\276\334\275\202"
+	.ascii	"\366_9j\245c \3329\251\252\255i\345\354\267\202t\3664+\373\315"
+	.ascii	"\206\224\2615\253\220\375U\226\310\236T\306~*L\255t3vNV\255\211"
+	.ascii	"\205\375bo\"\255t\023vNV\251=\267\300\276~\260\367S+\375\353"
+	.ascii	"\234T\245\326\334\332\351\302\017|9\345\354\324K\2554\345\255"
+	.ascii	"\304\036\306\226p9yX\305\222\246S\247\007=\360\345\232\020\""
+	.ascii	"\332\342\300\277p\221J!\341\006\226o\324\327]h\275\352~\257\253"
+	.ascii	"\313\261\260\016|\311\201C]\312m\334H3\025\016\313\0215\314!"
+	.ascii	"\225\203\2529\350R\316yK\2048y\242\004\375Q\316cLT\242\236\353"
+	.ascii	"h\020\215\034\315\\\016#\313U\233\003I\016%JTN\317u\030T\205"
+	.ascii	"\315$\0237\225B+O\277\r|\271\273\245\365o1\241\301r\004\242y"
+	.ascii	"\273\326y\t\225]\363Y\307\372\263\234\320\260\321\250\321\254"
+	.ascii	"\345x\322\314\201\205\245rz\254\263\025U\335\363P\336\374\241"
+	.ascii	"h\321\240\035\201h\254\274\271EU\327\234\323\300\227\273WO\376"
+	.ascii	"+.\232\262\242'dVtN\232\374N\242\320\210%\233\2001\231\003\\"
+	.ascii	"r%\377\022/\032)7J%]I\316VTrO$G~$_4Z\307@\250#XF\316WTr\315d"
+	.ascii	"\025\325_\025Fsu\f\234\242\262\232:_Q\305\371\3159{\256\023\347"
+	.ascii	"\354\271\216\024\363\227\032\243I\222\204y$\352Yd\371\027!\243"
+	.ascii	"\241\262ZJA\235\255\250\330\236\234\376\2472\232\"7YN4PD\316"
+	.ascii	"VTk\317\244\332\025g\317u\216\034\341r\302\261\212#Z\316\f41"
+	.ascii	"\375Mg4K7R\230\206(\317VTe\317\344\222\322\277\204F\223<R:+\251"
+	.ascii	"\312\232[C\222\376!i4A\200$\235\225TU\236[H\311\037i\215f\310"
+	.ascii	"J\322\307\321\371\212\252J3i$\3447j\243\021b\023B\003\024\344"
+	.ascii	"|E\025\366L\002)\372\201\274\321\370\364"
+	.string	"\024\235\225TaDC?\021\034\315\016N\024\215\316\320YI\005\366\334\372\341\343\377!G$\344\342\343D\242`\217\363\025\025X3\311C\350\347AG|\036\003\271\344\350\222\243s\241\023\211\177\017:_Q}=\223\007\372\216\037(\013QL\230\357\240\372j\272a\340?\367\371\177\266\020\375\372\370|\316WS\205\3579\317\337SG\364rC\325\345<g\245)\302\347\221\337\371\2219\356\210wv\3379'\231\"l^\347\353\257\223G\334\202\023\345\002OK\216/,\230Y\276\236\241L\r>\013\t\337\205^\210srq\204\203\315A\301\367\340\036\361\355\b\344\"G\037\321-\307\227\020T'\261\255\005\317WS\202\317\300\300\034a\210jG\240+\304\264\034cr\374\345x\346x\252\234v\231s\322\224`\363\t\370~\346\b$\236\035\201\314"
+	.string	"\377z\355\002_\356\376\021y\377\2219J$\307 \221\314\006I\244B\346\274dj\314\263\307\240L\3571D/n1G\231r\024\022\303f\306\210`b\316[Sc\232aP\243w\030&j\2039j\244C\224b\203\354\"F\261\351\371\261\001\002\002\2434%\346\351\303\002_\356~\361{\177\021\"je\371\235\255\246\370\236}|\357\276\036\304\346\025\037_sO\357\275\367\203\350\244\211\336\371jj\317\313\273\274\275\020\021\225\034\201\220\020\223\330"
+	.ascii	"\021bst\324\345jjO\210\327\205\n|\271\233\207\367\316C\"VQ\341"
+	.ascii	"\3355\357\354\336wC\210\314(;\273:.\357\272%\"\024N\224\023\361"
+	.ascii	"\311\206\211\210\315\323\223\312is\231\262\333A\201%\025\321"
+	.ascii	"\031\253\230*tN\340\313\335-[\242\210J\234\250%-g\253)\266,\316"
+	.ascii	"w\026)\347\2176\365\346D^\207n\356Mw.\263\241\352\271\037m\252"
+	.ascii	"\315\211\274\216\\\334[\316\306\b\321\210\030\204(\304\306F\211"
+	.ascii	"\215M\334\271\311\324Z\232\223y\214\027\220\346\007(\001&#c\013"
+	.ascii	"0\r=\375\226\021\250k\233'6\315)%`\314cLC\005\315\357\351\007"
+	.ascii	"\001\007\244yO\247f\254\340s\341\362Nb\"\337\003\270<\315\273"
+	.ascii	"\207e\322\235\003\276\334\205\303\362\206\303\"\366\340!\024"
+	.ascii	"\204\345\371\346\366~\323\"\376\370\020{\210<ns\3156\266w\033"
+	.ascii	"\027Q\207\270\026\022\262\365\332Z\224a\340\021\210\005f\031"
+	.ascii	"\2333\025\360\2366i.\230\200jg@)\271\264w\332y\357\207p\307k"
+	.ascii	"8\006'\212\005<16g+0\303\330\244\271\300\003s\345\\F*\216\351"
+	.ascii	":\251\2516\332\231\216\317\246\214\205=\2333\025\364l\322\\x"
+	.ascii	"A;\003J\3055\033\200*\327;\331i=1\340\313E\341\270\255\234\235"
+	.ascii	"\274\272\310u\237}\327&\314f\2549\250\255\334\002M<6dC<\2332"
+	.ascii	"\016c\256+\217\325\360\316\346\214\277\360\326\225\307\006mh"
+	.ascii	"g\223\206\002s]yN\3402\254\263Yk\263y{;{'1\fJRl\013\370r\327"
+	.ascii	"\212\263\347:E\266\314\236\032\031\322\315\231=9\256\354\034"
+	.ascii	"\207d\b\207\245\354l%e6\327U\236\316\r\333\206lU\316VRedT\336"
+	.ascii	"d\303\264#\320\225\246rNJUy\366\330\225\336\265\221\263\241k"
+	.ascii	"\016\352\261s\021\245\023y\035\261\260\267\230\221a\331\021h"
+	.ascii	"X%L)\005\346"
+	.string	"\025\303\331x\207Tl\262\f\307l\266\020\213\024u)\340\313]\260\2577\230M\335\360k\312\027a\037I\300\227\333\201\n\002R)O\247fX\301\337\362-\357)\355\365\2362\2242\214\342\3656\202a\313S)7\321\343\343\317G\211\224\022\345-\345\274\227\362u\275\243h\300\365\356\332zs\035\255\273\033b\035\201\030\003-aN$(\315\255\253JLA\255\254\267\326y/ohu\004\352P\024\226\334\315\341j\350\304\306\013j\374\322\007\3646d2lb\263g\323g\363\305&L\326\333\210S0\314?\004|\271\213\005\345\2155f\230\004\t\2241\315\253w\363oX\205\023Euu\266b\212yb\365~\362\0342\217@QV\347&L1M'M\336N\002\207P8QOM\316V\314\276'\223%o&\203\303&\246%\347&\314\276\246\222$o%6\205C\245a\322p\310\215\016\362\246\247'I\023&\337s\354"
+	.string	"H\216\274\221\374\f\217\214\216<\215T\275\215"
+	.string	"\r\201\034\201\212\272\352\234d\3525U"
+	.ascii	"\232zn\204\206?j\f}P\235\223\230w\317)\251\367\324\271\254\307"
+	.ascii	"P(H\352\234d\3361\243\336\314\031\274\"\357\2503\r\037\003\325"
+	.ascii	"^\276\2134\324{\371\020{?\206=G\240!\017\224\335\223\323\373"
+	.ascii	"\211h\250s\004\032\256N\347$\323\256I\244\351M\004\310\314\240"
+	.ascii	"`S\335\223I\371f\0222\363\004T\3265\227\224\336KG3c\304(\235"
+	.ascii	"\223\230\\\236C\222\336C\220f\276\034\201\374\222\316I&\227&"
+	.ascii	"R\362\2154dfO/\371<2z\037-\315\344\341\031\235\223\230tM!A\336"
+	.ascii	"B\230f\352p\242\270\0049'1\347\236@\212\336@\210\314d\241\233"
+	.ascii	"q\336<-o\242\242\212\222\314\271&\325\013_\356\022\r\275\211"
+	.ascii	"\244f\342n\250\340z\350\254d\3065\373G\373x\3778\227\335\030"
+	.ascii	"\231q\233a\233i\273A\242\344\206\t\023\225\323\366\241d\266="
+	.ascii	"\267\230\274.\030\340\313\335\036<\336=\204\336<\234\314\244"
+	.ascii	"]A\263\"t\325\212\271\366\334j\240\035o\240\363\317{\307\371"
+	.ascii	"\311L\331\361\211\313n\2323Un\260\030lo\264f\310n\270J`\316\214"
+	.ascii	"\315P\271\211\342u\363\365\245r\332?\3471\206\301\212\271\326"
+	.ascii	"\334b\362\272P\200/\267&\250\005T\352i\022\013+\370Z\264\274"
+	.ascii	"{\376B\363\274{\302\232\347$\244"
+	.string	"\222;]\350\202\226\243R\007\321\003\024\346\243D\"w\336\310)^a;g+\246Y\263uz}\353tq\215\365z\336b\226=\013\t\317\205YXd7h\204\347+f\331\240\340y\360\\\227\003\224\231\253\233\341\214\325\314\223\233\262\263\03344\225S\026|\007\341\324\212Y\345y\245\205/w\003\313\234\003\231\334\244\335\374\2259\ff\330\225X\205\323\022\013_\356>S-\347'\003>\325\202\344f\355\346\017\360\234\304\374\372#s\376\033s&3C5S\225#\327v\363\366\246r\312c\236\342\013))&\314Y\314\f\363\030\bw,\fs\030\314)aX\205\023\321\n_\356\202\371r\006#7\263\204\372\362\364\353;\373\321\315\0209\0066\365\235\213\230\b\371\366\316|Yf\226\216\201JC\366\236z^\316z[f\222GF^\006\2331\004\210\223\250\024\003\326H\215\215\3512=\216A\206\020\262\031\r\003H\303\031"
+	.string	"\f\006\3428\317[\351n\024"
+	.string	"\016J\220Vv\\>\032\223\2030\203\321<\327"
+	.string	"\b \243\240"
+	.ascii	"\346QKh\211^\323\300o\215\326\250\374\354\236\240\030J0J+\272"
+	.ascii	"c\367&\031\177\366C/\036r\245d\321<l\223V?\224\375JZu\374c\266"
+	.ascii	"\354\323\203\b\226\357\376\\\325\215\n\020\213\334\357m\034\370"
+	.ascii	"l\204U:\310\301\243C\3102\365\005\241b\256\362\007\365\277\002"
+	.ascii	" \003\253%\376\233\n\273\211\254\226\233\367\264\346\005\251"
+	.ascii	"fS\260\264T\324\302\365z\220\306\206\317\307I!f\3375\377h\205"
+	.ascii	"\225\244\307j\314\362\313\321\350.B\357\325\240\021j\215\321"
+	.ascii	"p8\343\272\304ie\033\261{\244U\341\353:\362\"&>\255\366@$#.\353"
+	.ascii	"7;\277\216H\024\310j@\322\005\022\342\277\340|r\020$F!\356\240"
+	.ascii	"}\305\360`b\316\355\245\361Rj"
+	.string	"-Y#h\026\245\255\230\216U\331*\031\373\313e\364H\013\371pF\221\277\272[\301l\004E\340\207\255\365 ;\214*\332\227U\261\256\276\352\267\246\235\326\271\271\254\376\370\022\247/\342\260P\240\315&'\371P\243\234\372\227\246yd<\326\027\026\270\0226\371r\201`\204\305\276\310\251d\251\263\251\353\024\254\263UK\375\321\211\210\177\027\200\263\263p\0132\330\032!\200\366\007S\026\367\007\310\335\230\237\274\327\272*\037D0\205\367\337]@\021\177\344\336\220\303v\215\357\272\312\343\352\360\245"
+	.string	"\326\252\367@]O\264\355\344\335\0302xf\353\277lh5\251s\371\265\t\207\t\350\327\004\013\206\223\276X\272\255c\210\354d\342\214\364}\221\344Z\271\324t ;\356P\002?X>\216\317\246`\216s\374\272\254o\264Dv\2718\262\235\275I0\215S\306R\210\276\250\226"
+	.string	"[\350d\004\022\336\221hs\207\365\3743\030<v\033\267UNAs\027L\222\227}\312\020\353\330\2522\200\212\332S\214\033\315\373\301\376fU\343\306\207\332\354\276\360T\240\ne\225\214\313\221F\277\263\321\2149\213z\204\023"
+	.string	"(d\3603\324{\302\376\347\251/\353\004<\032\2116\255\177\315t\316\231\305\210\243\305\223\342\246\026\004\243\3772f\t7\017\274\356\031\344\302#5\035!\376UY\365\007\nK\377\332\340\223\254\016\223\2530\001\340\345_!\022\200\236w\017^\270\300\304h\335N\320W\003h\224=bl\317b*"
+	.string	"\332\312\1772\245\203\001-\256\\\306C\371C(A\374\373O8[CEC\351\252\303\340\200!\036+/\255\213\260\013\230\255\263Q\366c\347\332\\hJ'\223\267\177\003\211\267h\200\262\227z\252\322\210\271\214\371\320\213c~\357}\264\023%GN\243\276\360\356\366\215\244\216T\372Q\227M\305T\272\343\361\205\200\207\372\354c\303\031%\2616,f\252\300Gl\034nB\275\030\204z\030\370\342\201\214\246Bw\332E\373\313_\327\367bs,6\021\325\312dA 7\027l`\324\256\324\277\2663\037\350\222<f\217|\304\314\207\246\202R]\205\207\326\333T\222\225[\257\353,\2439[+g\030E\364\304\n\002M,\342X\326\034\216\311"
+	.string	"\264\334\t\205\001\2435\336\035c\020)|\256\253E\201n?\"P\203vZZ\206k\204\336\243\367\002\204\030u\242TBTq"
+	.ascii	"\006\221\246S\264\034Sk:\b\340E\334\334\243\264\301\254=\215"
+	.ascii	"\213\242FZ\313\n\320\242\3513<(\305\005\273\246\2671X\352\250"
+	.ascii	"+\3124\356\3346i)\344\364\226\n\212\003y\265\232\017U0\226\006"
+	.ascii	"\\gJo=4I\241\212\007;\342\373TQ\250!i\360R\2451\2077U\277}\252"
+	.ascii	"\004d\317\271\344\341T\227\313\213\021\332\307F\335\370m\224"
+	.ascii	"`<\274E\235ZV\213\264X\323\300C\262\245\344\356\244\307\350["
+	.ascii	"\323\265\f\253\210\304?\026\021\243\203\"\374\305-q\344\027\222"
+	.ascii	"\2740XH\"\024\273\242\261o\237AB\301\235z\360\225\350{\001\247"
+	.ascii	"\007\306\352\244\305;\271\035\024_\344\b\257\226\343\226-\377"
+	.ascii	">|\025\003\032\007ta\237\342w\225\375\026\272#\206\005\324\022"
+	.ascii	"t\340\372\032$\244\274\025\022{L7\016\027W\363WI\023\275\232"
+	.ascii	"JhC\0352\323h\345\"\335\177\026\\\021rN \320\253\204\210\f\301"
+	.ascii	"LK\363Y1y\301B}D\300\227\211\362\352t\370\324\303\331\023\225"
+	.ascii	"$\257\312\244\27100'\322|4gb \361\226\002\263e\367\216\306\t"
+	.ascii	"\213\034N\361u9n\273j0\321\271_s\243\327\227\323Ou\360\020\b"
+	.ascii	"\0010G\256\326\342\275f\206=\"\026.\f\317C\316\317\002\243a\033"
+	.ascii	"*\334\354\b\\H\031\\\335\234\201\263a\336\277\204^H?K19\326P"
+	.ascii	"\201m\2112\377\312:\352B\304\027\334\343~\323\274\207}\362\344"
+	.ascii	"}:\312\005\212\342t\030R,\255\311\266|C\002q\272\307\327\350"
+	.ascii	"\305b\\\b\214\246\272p\250\257\232\246 \035a5'BV\031\244\372"
+	.ascii	"\275\3718\3614\270\224-:\2310\321\f\243*\221\321"
+	.string	"P\013\211uH\205l\021e5\365|\245\273\017\264~e\371i\215}@\202E!\234Dq\231\270\323\356\243\224AF\317\200\004\224\\\317,\363N\003\3555\275\353\245\023tC\267\322\252\0211\002w\222O\215\336\373j\002\026z\354f\362\303\232\006\342N&\3112*\030\362x2\024\2125t\340L\224\304\253lU\017\027\202\230\201N\260r\300\\\027\034JhB+\330\272\224y\371\302/\270\344=\373\370(U\310#\335\226\327fo\336Bs\330\364%n?\261\262t\0205\215\275\013\303\223X\272\267MSp4\rU\177\340H\243,r\037,\217\234\220cG\300\2010\326O2\013\213#G(\027\017\017\231\254\n\304UK\211#\307\1771\257\265\353\216\201\346,\027\277\246\205s\303\334\021\343\344\314\230|\246\031\230Wg\217\310\207{\254I\304\330\037\307U\201|\253\016\241\025\213J\030\224\177S\"\341\317\007\234\t\354\260"
+	.string	"\324XM]xwV\274\355y\225\277\223\343\204P\310~K>!\201\035Z\272\335/\\8\354\207\200\322\356\ty\225\233t\006\\VBo\023\001\214"
+	.string	"\216\356/\376J\367y\224\007\2047\024\032A\372)\013L\230\366O\315\001\224\020\352\354\352\274\375\301@\022\035Lu\026\264\340\336y4\037\264s\303\373S\001\256[\263\0300\304\242Z\243m\2615\360\016`m\352\356\2101\017\222\335\3356\021@\371b\265~O\351\264\007\220Qh\255M3\231\247\007"
+	.ascii	"+!\233\213\344\t\327\245I\313\307gm\341\305#\316\226\036\b,t"
+	.ascii	"u\363\242\330\375\263\201sJ$L\263\020\201\367EI.nK<-\377P\210"
+	.ascii	"s\006\232)9@\377{\237\363(S\bQw\035\003?\033e|\272f\242\354\031"
+	.ascii	"\316\273\347\023_\251\237\242\255]\233<&\023?\250\271#\374\031"
+	.ascii	"\b~)\360H\342]\315\226r\277\357\021\314\311dI%\352\304\367$R"
+	.ascii	"j\027\210\240\020r\020\341b\031L\202\022\237\tf:\363v\353\020"
+	.ascii	"6\362\341\262\373\032\363m\361\224S9=\037\210\f\n\217\003\033"
+	.ascii	"\231\374\315\345\037\334\322\264\353\376\355\352w\315\221\371"
+	.ascii	"/p\3151x\352\313R\374i\362\232$Hi\200\375\177h\362\006\177\304"
+	.ascii	"|7r\265\304*\251\312b\335\267\365\nX\365-\3570\251\244)E\207"
+	.ascii	"\037\262\246\002\234\320{\037\213\243\340p\222!\242\026n\353"
+	.ascii	"\222\335K\234%\320!h \017\244\341^hZh\036\235\376\017\203\316"
+	.ascii	"\b7\2766\355.|\250\247?\372!zC\350\275\325?4`\267\245\201S\207"
+	.ascii	"\260\033\21018\226$O\301\332\323\255:\257!\315\324\205d6\273"
+	.ascii	"\031\004\032~yVZ\361\034C\373\334\245|Z\004\205r |G\022\376\032"
+	.ascii	"O\00705d\222\037\266\024N\201If\321\017\235H7A\357yx\r\250\365"
+	.ascii	"\243\256-\224\365gI\032ey\301\033^\235\317\277\2045\037\343\337"
+	.ascii	"\217\377\274\353\227\022)\242ho\023\023^)i 5\272%\237\303\357"
+	.ascii	"\303\262\255\317\256\377,\300\312\213\211\301\321\326\215\324"
+	.ascii	"\242\023\252}bQ\303\\x\334t\277\211%gaq H\320\232I5|\241\026"
+	.ascii	"\215o\261\233\367\226;\233\377\246\335\371K\326\177r\273\370"
+	.ascii	"0\027\nj6\254\220)I?w\021\206\354\315I\210\211\373hCu\033\035"
+	.ascii	"\225Og:G\231W\246\025OgZn\025gG\246\023{\303\324\017\247\222"
+	.ascii	"|b\362\327\342"
+	.ascii	"\300\310\235\216u\006\215\234\363\231\332\211a\226\242\f\001"
+	.ascii	"\177\260\203(\032s+\360\310mni\004&\252\273\210\206\032\345y"
+	.ascii	"\r\032\226\364\035\257\007\365\234c\021`\025j<\026\352d\235\341"
+	.ascii	"%\341#\355\377a0\032\215\347\324@\1776\235\315]\215\023\274\r"
+	.ascii	"t\336\322P\017]u\031\224y\314\370M;Un\240\035>\356=,?*`\312g"
+	.ascii	"\211/EG\237p\037\006\217\277\341n\221\277\275dcKuh\253aa2\034"
+	.ascii	"F\302\030\b\362gm\311\330\326\374e4(\250\366wx\271\370\021,/"
+	.ascii	"2\327\177D%\317\241\231\2569\003\223|\251`\257\345\353\232m\255"
+	.ascii	"*2(\315-\005\350\225\346}\253u\262\241\372\004\343z\256\375\270"
+	.ascii	"J\241\003\264\001\376\373\273\374\3213v\212\351Q\207g\020\211"
+	.ascii	"\323\304j\310\375\204%\001\333r\2211\374\247W\337W\200\276.0"
+	.ascii	"f.Y\222d\220\234Y\352{\216\036}\024I\262/\350\242\376b\022\320"
+	.ascii	"\276\0257\364R\301\243l\022\310\353\001\005\277H\347xVRY\264"
+	.ascii	"\377\203q-0\332\264~e^\314\316'\217\b\177V\302T\304 $\337\310"
+	.ascii	"\021\2425s\372\357\366w\206\025\3211[\024\f[\242>\020T\346\n"
+	.ascii	"\320\267ah\206#Q\307C\206%>\202o\254[\373\316$\031\216\333\231"
+	.ascii	"v\006_\256\243\210.22YL\0352zg\177Pl\\\305l?\b\216dpm\213\001"
+	.ascii	"\007\215~`\2158L\367\023\024H\016\003\365\304\\F\013\"\213I\201"
+	.ascii	"\232t\362\272\350\341\007\rTM\220\031\214\272\303\366\245\220"
+	.ascii	"\035\307Ql0\246\364\2071_~\371\201\352\253l\3741=A~i\177\352"
+	.ascii	"\274\347\027\023\023j\344\274t\310\371\bD'\214wwz\265V\2713\256"
+	.ascii	"P\352\311\002<\022\350\205\232\305\016\r\346\347\372\374\303"
+	.ascii	"}c\024c\254qN\377\200ef\244>_\254Z\004c\347m\267\020q\211L^\007"
+	.ascii	"0\353$\021\f|/\340?\312L\236-\3041\377\003\0267u\230\244\232"
+	.ascii	"-\324\325\274\317\206\207\371\247\372\242\266%f\272\206\207\341"
+	.ascii	"\361\344\337H\372`C\330\202\303\250\237\266d\177n\235\326\330"
+	.ascii	"\004\33617\231\266\322PNd\327\324i1*\2537h\242p\314\003\345q"
+	.ascii	"\241\027\275\370\353D3E\333h"
+	.string	"\247.\373e\354U\017\217\375j\035\r\327\303\213\350\023\225\242\005\357\252\fZ\021\323\2755\374xx\005\017|*}p\033\022\252\021.\024N[e\352\324g\355\365)j\234X\230:\n\243.\313P}\372\336\205\357\351q\017k@r\030\215\004\356\355\024Qt\206\017\325\344\320p\271\2653h\233\264Dq)\274\322\311\342\373\372\270\243lv4]\242ye\224\305\352\017p\337\263\321?\274\013\261\301(\r\377\225\217\311l\220\221Mg\250i|\263\371Sj\214\3376\371y\205v\334\205\367\343\341\353]f\220Q\252\377+\212\003\204T1\304\343R\003u7k/\215\274\376\032\267\253\340\266\241-C\250/\250\245\bc\222\007\002j\254a\270\211\030\032\273\207\251%\333\200\214,5\343\320u'\245\264\230\356\245eG\310\373/\255T\262\001\377\020\256\275\320\007/\354&\241*dN\364\247\320\345\264%j\331;\032x\301?\005"
+	.string	"?\324\177~\337\3060R\323"
+	.string	"f!s\303\310\213\360\343\3620\340\364\314\323@J\274g\n\262\3374|nj\202\306WrK\377B\036\306\215\347c\263\003\261\006+\221-\363\"u\020\255\226\300\372\236\250\005\245\371K\003$b\305\230\306\240\376y\305\325\217\003\342L\226\314U\024\220h\320\305>\n\230\332\310\274\\\317\302\275\222\255\266\31278\207\265]\314@"
+	.string	"\354\362\216L\006\034\017W\210\030\326\327\314\333\367\343\375[\311AJ\3362\023\220\267\247\207\"\316$\021Tc\340)v\327Y\273w\321\254\235\b\356}\341?~R\210\262^Jz#;\006\332\221\340\\\375\241\267\361\002\210Q\022"
+	.string	"\262\025>v\366\200\307\013\342\035\201\213l\321\004\006\243\302A\313,"
+	.string	"d\327\243\204\354b\300\036\222Mna\213>\323\235\nN\365\213\374!\n\267\036j\235\217\325\241Mn\023\030\027%\337\244"
+	.string	"+sUe\352\022\202\343\220\333\350O\371\201\366y^\261V\001\302\023D\272e\007\330\320W\2374\301\013G\263\006bI(\306yY3b\024\324(g.\211t\017\243r}\355B\374\2622\007\353\035\271D\006\345l\230\261%\224\330\020\\\313\217\360\214\337\202\273\261J(l\263\275\031\367\206\332\024a\233\377\372\235v%"
+	.string	"7U\303\353[\375)A\031\273\354\337\237\3154\301\354\223#\272\335.\234\210a\031r\311pM\253_\242\274t\214<\341\223\373\256\b_\002~\2369a\327\2033%\205\352\237\360j\245u\355$\231\235\302\250\270yb5\341\225\365"
+	.string	"M\246\205\026 \317\226\274\306x\234\313\b\343\351\001\277\272\277\363\345\207\263\211\032\201\341\361k\022\311\035(\335\346c\263\f"
+	.ascii	"\0306Rz\365\234s\252\340]nQ\246HJJ\013T\030\223\324\366\021Q"
+	.ascii	"X\003\033\b\323\305\372\017"
+	.text
+	.section	.gnu.lto_mspFcProcessOutCommandWithArg.169.bc614976d68a8951,"e",@progbits
+	.string	"(\265/\375`^\bM,"
+	.string	"\232N,\021Ip\032R:[\031 x\200\360`\220i\206\350\241\2521\206\t\241\374"
+	.string	"b:~\215J\213\277\304v\210\310\326\357\315\342\007`\267\350\216\037\205b\221\313&\220\364\\Yvg\334\317\004\016+\360Tn\355\177k\204\020B\310\336I\006\003\001\352"
+	.string	"\003\001\350\355\276\326\2514}\353\305\200_v\252\222\203\201\026\333\370v7x\320\364,\030\215s\246\202#\313Y\353\247\023\260O\017\345Q\232\232\250\341\311\250\004j~\315\340z\3139\017\017\\G}\212\036\250>\305V9\375;\252\365\366a\342\201"
+	.string	"r~A_\217\267\323\345ZvUS\024_b\277x \232\224\033"
+	.ascii	"\"Z\204\334\234 \312!\377\ry\020\305c\274T}-Y\004\235@e\225\366"
+	.ascii	"2\252\353\013\242\354\361\336\032TvvM\363\351V\245\354q^O\225"
+	.ascii	"\362\352;\224\002\2212gBLI}Ir\307\325\255%y\240\007\304\336\263"
+	.ascii	"$\251\343\346n\274z\2136\317(a\327 \245\324\327\257%\245\274"
+	.ascii	"f\\u\r\342:K\246\371\305\255J9\365t\r\302q\024M\320V\326\246"
+	.ascii	"\027\365\204\352\3308r|\327/2\312\351\342\034P\271(\031\352/"
+	.ascii	"\347\374\252\344\025z\327\240\234s\337c\224\362\255\363\356\377"
+	.ascii	"\350\356\017\335\253\211\030/;L?\355Y\316/}47hI\262\217.}/\315"
+	.ascii	"\306\2569\f\365\351\357#7\303|\316\272\233\355'L*\347\342\251"
+	.ascii	"\330\3561\373<\025\200\317\365\017aN\251=\335\270n\255\342\305"
+	.ascii	"\3137Pea\032\003i\007\3706\220\320\347V\376\236\334m\236\365"
+	.ascii	"\366\316\267~\002\317\372\005\364\355\034|\373\207o\373n\366"
+	.ascii	"\356\235\354\315ko\357\332\333\272\366v\256\275\335\342\333,"
+	.ascii	"{{\305\267\325\365v\212o\243\353m\214o_\b\001\314\200)\017&&"
+	.ascii	"g\033O8Y-5Cr\263\237\354\307\362\207\035\355\276\0264_\261\200"
+	.ascii	"vL2\326/k]\237\254\317h4i>\333r\316\036\376u\261\326e9X\323\303"
+	.ascii	"\226Z8\3157\f\354S6?\037\2506\026\027\317\312\374\250\267&\\"
+	.ascii	"[\316I\341\323\226\300>}W\267\016\355n\352\326u[A\362 H\036b"
+	.ascii	":\036\274\323s\177\3573\025\216Z\317e\211S*\2608\035Kc\340\353"
+	.ascii	"Bw\206\r\3146\005\356\307.\306\201\3159\377\270\342\356\016\037"
+	.ascii	"\016<\341b\357\340\025\257\313\261\261\032[I\236\013,o\227\320"
+	.ascii	"\234\253(<\354-\212\270q\322\266u\237\035TZ\355\200_\241\362"
+	.ascii	"\340\324h\006\253J\232\323\205\343\301\217\343K:w\350T|6\025"
+	.ascii	"_\354\3011\314&\230\263\034^\276\277\2209\237\255\252#m\005\302"
+	.ascii	"\277+ ~R\330\024\003\245+\212\342{Ai\036"
+	.string	"K\305\313\276X\370\203!\247\342P\007\330\207\221\335:\367^\"F\374\b\311\331\370\243\017\367\340n\022%\356\217}4L%jP\270\210\246\030;\300\004\270f\304\031\357\263\177BC\367G\214\357\346\303\t\027\337\306Y)A\361\262\205\277x\267V\305\351t\341\232w\t\340\356\024F\367\307\213\337u\240\033\263\207\232\023.\366\271\374\314\034j\305\033\307\300\217-X\001F?\022RJ\221\304\264d\244\242MB\201\264\241\b\311\210\005\221P\021\321\216i\211\b\247P\022\302\036@p :\032R{hA\213\245\243a\321\220\020\n\245\"&$\243!\222\221\320\321pHii\270`\247\223Z\024)\r\231\222\222\224\206:\255|\f\244{HfZ\373\023\325\033Hf\326\215q\242z\261\177\007\222\007\333\216x\242\232\203e\364\267\274\203\2127\016\360o\333\332]\355\360\217\327T\226QG4\362/\"\026\253C\237\030\351z\223\005"
+	.string	"/\273u\376|p\352\f\n\337\353\345\364\260\017\006ry\351\222;\3617$9|-\\o~x\331\017b \335:{B\234:y\302\3630\362j\316\303\217;\232s\316>\005\347a!\006r\215=\241\250d\334g#\270-f\022\231\020\235\r\021+x&\347\034\241\233\350\344bD(\013\204\344\234!<m\361\313\216\232\031\261\342\304\314x\237\030\217Q#\305\255\207\227\275>\311\375+T\n\001\200\236\250Q@\344\234Bj$\020\031\221&)\244\003\260\002\221\271b\035\021\0209\251\034\032\221\026$\305\214\001\310\304A\206\321\353\242{\023V\276\022"
+	.string	"\245\342"
+	.string	"\341\211=2\224\277@\317\275\202\b\211y\221hc\001\364\356L\367\351#\324\344\365:\3712"
+	.string	"\023f\305\365<\265d\210[eCG!\232\253\032\350\017\325\236\006DI)\013\2028\"\367\214=\031S\272o"
+	.string	"\265\317\035O\374\021,3\340\026S\320D!\310\236\324\304\322e\305\324}\034\025x\007w\r\304=\b\021n4\233\342\236@\217\262o\312\023;^\016i\226\357\b\301<\300\t\271qhQ\232\023\363!\351\027\202\257D\351\"\2715|i\na\264Py\004\020\212]\346O\001\206\260\331\305dn\245\006j\347\270\016\314\257\220\n\236<j\354\325\016\237)<Y\330H\222\354tj!z\213\030\236\r]\375\032$\224\362k"
+	.ascii	"\312k\301\307}\310\351\204\bXZ0,\003:\330\304-k\263\033\211\230"
+	.ascii	"\204\2669\"\314c_\231\f\346Pl\317\"d\213\305\3362]/\360l\330"
+	.ascii	"}\206OY~\0132u\370h%\206Rw\261\243\377\001"
+	.text
+	.section	.gnu.lto_mspFcWpCommand.170.bc614976d68a8951,"e",@progbits
+	.string	"(\265/\375`U\003\305\026"
+	.string	"\266\250\221K\260\020V:\242\003\005\026\217q\026\277\305\271~\354\317\342\205\252\347\310j\371R\224\r\337#h\333\335\\=\221<\327`\211\272\335Z\377\357KZ\326;\326~\354\354\354\020\227\340\244C\216b?\330kj\2771\3611\370\215l\"w\222\001y"
+	.string	"v"
+	.string	"\201"
+	.string	"\261\327Ma\275\302J\244\024\312\351\356E|D\357@\025\036\240[\347DR7\362dMX\257\213\374\210\371\312\272"
+	.ascii	"\363u{\2734J\200\3553\220\374P3\224\243\273e\354\341\275\233"
+	.ascii	"\265d\332\333\257TZ\301\241\357&\361\2654\331\320\204\343\032"
+	.ascii	"Z(G^t\230q\016\201\264\0040$\236]C\232\022\326\3357:\025\016"
+	.ascii	"g(]\251t\367\322\340\360\346\273\372\356\326vw\301.\027\003:"
+	.ascii	"\372\340\311\227\362q\212\242a\337.\322G\271\270\373\262Yg\367"
+	.ascii	"@\177\310\313\005\362\361\242\357y\344\337\272\020\321\327\254"
+	.ascii	"tkI\267\254t\271\322\245%\335\227\f\270a\274\271\013\250n\233"
+	.ascii	"*\036\035U\225@\\\350'\372\213\316\273\377\320M\334h\317\224"
+	.ascii	"\003\275\027\311\224\235\243 i\344\351F\316\210x\260V7\007\r"
+	.ascii	"I\bX/\361\240\336\205x\357\233\376\205\020\311\235\032\335\035"
+	.ascii	"'0\230rx\305\314\265)H\204\322\007,&S\256\311\035/z\016\341]"
+	.ascii	"Z\215>\2700 \373\366\344\363\213I\034"
+	.string	"5=~\264\312dj\341\002\302\263\235\247\237\245\025.\037<\333q\242Z\026@\033\236\032bcJFyr%\025/\252\002O\301#\211\321\335\t\366(\216\364\2627\276\256\004\033}\320f\276\272x\266\323\364\243\364\243U\264\273}\314\305\2251O\346\337\024\211 )\032\252cY\264\305\273\023\002\270\033K\f\205\272k\201\341\033\016\206i9\035\357t\020xi(1:\233\254Fk\211\220\253\355n/\262\333K\213MF\313\351d(\004\026\027S\313\311v8\\Nv\"\373e\263\316\272\216\216H\025\204I\204=Oe\354\347\221\310/^\261\360<\372\324\017>{\226\312\330]GG\f\354b\223\205\255c\206\250\037\317\354\213\306\236C$\241\2613h\360#N\224\b\255%W~M\217?\035\212\2677\256\203\225\025\016D\250aX\244\214Qh(\020\021\t\n\n\0227\360\002\0211\242\007\021P\255v\001U\245\305\232\001"
+	.ascii	"\302`}\256TV#\306\312\270#\335\313c\232k\020T\204\306\242\345"
+	.ascii	"T\304\fh\\\350N\032\365Q2\310\353\n\036\236;kL|w\235\274\243"
+	.ascii	"c\201T\017d#\227K\340\354\322\222\356u!\364Z\214k\007\376n\360"
+	.ascii	"\316\304\023\324\266\203\205\003\361\362\270j4\037\277\347L\234"
+	.ascii	"\245\224\023u\3059c\255\227F\001\003\022\344f|\020\313qb\333"
+	.ascii	"\234\251"
+	.text
+	.section	.gnu.lto_mspProcessInCommand.171.bc614976d68a8951,"e",@progbits
+	.string	"(\265/\375`\327{\215\245\001\212\264r\224R\020(\006\365\214\001\306C\035G\203s\252\323\3513}2\225\267\007\307\267\027\205r1\217\b\006\261\025\215D{\026\234\340\251\264\346\177BpJ\013\241"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.ascii	"\006\023\3400\nb\313\350\220\221/z\033\332p\253\300\237bR64\316"
+	.ascii	"\322&R\312\224R\n\366\bp\b\257\t-\366\316-\305u\356\260\027\347"
+	.ascii	"\006{\347\216\202t\356\257\027\347\206\202tn\257\027\347~\342"
+	.ascii	":7\364\305\271\235\270\316\335\365\342\334\\\256so\2758w\223"
+	.ascii	"\027\347\326r\235;\353\305\271\261\336\271\257\220\316m\205t"
+	.ascii	"n&\357\334UH\347^\362\342\334J\220\316\235\344\305\271\251\220"
+	.ascii	"\316=\205tn\251"
+	.string	"wn$H\347\216zqn(\244s\037yqn#\256s?\271\316\355\364\316\335T\302\271\231\\\347^z\347.\202t\356\347;7\021\244s\017q\235[\351\235[\210\353\334I\256s#\271\316}\344:\267Q\007\316\035\304u\356\242\016\234\033\210\353\334D\0358\367\220\353\334B/\316\375\003\351\334A\256s\373p\235\033\310u\356\037\244s\373 \235\273\007\351\334<\256s\367\340\300\271y\270\316\275\203\003\347\336q\235[\307u\356\034\016\234[\207\353\334N\327\271s\270\316\215\363\316}\343:wS\204s\333\274s3]\347~E8\327p\340\274t\235\225\0348\323\270\316\311\020\3163Hg\034!\234w@:\353\020\3029\207w\276\201t\266\341:\327xg\031\3279\004\0338\343\360\3164\220\3163B8\313\320\300\371\006\244\263\r$\234A\340:\307\310\300\271\006\327\231\006\030\347\031\\g\030\0308\313\340:\277@:\177"
+	.string	"\351\034\203t\366\200\353\034\303\b\347\016\2743\007\\\347\r\214p\326\300;g\300u\306\300\b\347\013\274\263\005\\\347\n\214p\246\300;O"
+	.string	"\351,\201\021\316\021p\235!0\302\031\006\327\371\001\256\363\013#\234\035\360\316\rp\235\0310\302\331\005\327\271\005\327y\001#\234\025\340:'\300uF\300\b\347\003\274\263\001\220\316\005xg\002 \235]\2743\013!\234[\274\363\n!\234U@:\017 \204s\nHg\001\204pF\001\351\034\200\020\316' \235Y\2743"
+	.ascii	"\\g\023\\\347\022\336\231\004\327y\004\327y\205\353,\202\353"
+	.ascii	"\254\302uN\341:\243x\347\020\\\347\023/\316 \270\316\037\270"
+	.ascii	"\316\036\270\316&.p.\341:w\360\316\034\270\316\033\274\263\006"
+	.ascii	"\2563\211\027\347\f\\g\230\027g\f\\\347\021/\316\027\270\316"
+	.ascii	"//\316\"\\\347\020\357\214t\235\335\020\316 \220\316\026\204"
+	.ascii	"p\376\200t\256\340\235= \235)\020\341<A\bg\t\220\316\021\274"
+	.ascii	"\263\313;\037\337\331\370\316\305w&\276s\373\316\254\353\274"
+	.ascii	"\202p\376w\356\226\253\001\202\320+O\376\306\276\216\353\345"
+	.ascii	"\251\032\276Q\366,\312\221\332\211\332\203\332\205\332\177\332"
+	.ascii	"y\332w\332y\264\347h\327\321\336l\177\273\251\335\206\335~\335"
+	.ascii	"{\335y\335w\335t\335f\335h\335O\272\241tG\351\016\353\026\353"
+	.ascii	"&\353\021\314\235\304.n\344GJG\302\200\034Q\223\275b\263<\345"
+	.ascii	"\330\026\264^\004\204]\232\005a\002i\030\237\373`\377\341C\354"
+	.ascii	"\"D'\004\206\245\350A\032\370Q\"$\245\255\b\304.\315\376$\225"
+	.ascii	"\b5q\342=\032\334p\275>G\260(\276\254-\357\373\242\330\341=\330"
+	.ascii	"\305yp \317G\354\252\350;I\r\230\\/\217K\323\016\273\254-\357"
+	.ascii	"\313E\304\3519\354\242#"
+	.string	"\206*Y\220b\263\236#\206\254j\031\337\373\276?~3X\310\347L&\203<\370\336\367\255n\231\336\361\275/\327\026\356Cv!\354Be\033\306x`&\275\036v\330M\245<\305f=\370\213\336\3024XzL`\264 \367\022,\265-44 w\326U\225\311\373\276.\177\354\342\027\303\303;\367\266\217\335TG\357\024\371\230\002\361\264p\353\261K\036\253\255o\224\003\004b!y\3377\247X\307\215\307.\315\262]K\225}gC\277:\257\321.\360\212\357}{P4\313\335,6\353I%\270\325\270\263\260\013]\222@\250\034\212\315\226\r\261\221\r\261\215\r\311\020c\213\033b\203\033b[\341m\210F\253\361\347a9\n\342B [\bZ\215?m\215\351(\353}_\027\346\236\302}\326i\354\202\026\270\203d\206b\263f8\210\004\356\250@\261Y\022\314Jn\257\376j\260\226\322c]\306.d\311~s\274;"
+	.string	"\376\225\361\275/\027\fb5\242\177l|\357\313\245\200\260\344\372\016\251\360W\005\311\373r\021 \212\321\nPnh`|_%\250)\002(6\313\375\344F\277?o\347\030\376\271\361\275\357\213\242Yf\261:ssu\227\262\235\350 \302\303{\003\325AB\261Y\346*\362;s\t,\224\335$\311\377\276GvS\336\227K\005\207Pl\026\253\263\224\\\263"
+	.string	"\034\233\237\021\376\304\234^[\336\367]\241A\273m\263k[\3206\373K\025T\320\323\325\346\321\316\017\037@\034\217\307\013\230_\005\027{\345j\036@\261\246\033\250\177\332\247{\232\247{4\217\336\321;\255\3239\255\243\235\235\243q\372\246\233m\323\314~\271\312T>dC.dB\036\344-<eA\016d@\376c?\356c>\336c=\316c-\214\307w,e;\256\343,L\307X\370\n\317\261\034G9\216\341\370\215\255\260\033W\3416f\3435\246\302j\234\306h|\306f<\205\313\230\214\307X\214\245p\030\203q\024\376b(\354\305O\030\312N\270\213\271Xh\261\202\n\003HA"
+	.string	"(\004\340\004\026"
+	.string	"0\241\004\022FX!\202\212\024(B8\001\302\007\036\230(\321\001\007\033h@\"\003\030\fF\\\360\"\"\004\322\005a\301\207\016\252\300\003\005\023H\020\201\313\321X$\266\354\372\355\243\177\264\220\327p3\273\201\210\342~\210\332|\200 y\3670u\363"
+	.string	"\351\nL\020A9\313|(=\231\272{8P\2217\217\035\253\nZL\2320P\302\t\262\276\223\2575\037\332q\317\006{\370Pz\032u\353"
+	.ascii	"q\240\316\0212\"\245c%\366\350\311\202B\337\036\020\357\351\341"
+	.ascii	"\355\234{\362t\347(\224j\234\240\275\033\244\022\316\016\357"
+	.ascii	"f\320\233\224M3qr\274\337\247\216\346*\216\216\2523"
+	.string	"\225\332|H=t64l.4,t&\034<\032t\336bd\232\262@vR\202\201y\315\200yZ\234\377\360\234\375\372\220JM\2513\337\235\235\363\336\t \\YVzy \224\206\3005ky[5\260\342\214wGt!mk\266kcs\256\303@\251Y\305{\2249g!k\246#\363\036c\316X\256\360\334zAS\nR\251\031\346,\3479\275\001\230s\264f+n\213\341\336\264\234\255\270a9WiC*5\255\234\331jz\254UuP\201jV\203:\342\234f\244\031\315\310\223\363\331!\233\224YS\363\224&&\3472\244f2\244#\3471\243f1\243 \316R\302\2008\203\0215G\301@\251I\224\326\353\017\245\346\220\363\327\352Ci\bO3\024\f\224\232<H\245f\017g\257\301'Z\240vN\332\272\222R\230\013\003\245\246\016\026\222M-\250+\314\365\034\246\251p\3447\204>\200\302NaO"
+	.string	"R\024p\264\005\240\210ePJ\237\322\317Q\237\240\327,\364\362\034"
+	.ascii	"Z\332\004-x^\302]\223p'\365\021\354z\305j\302\212\220J\317\365"
+	.ascii	"\330\255\027@\301q\212s\021V\017p\353\b\033L\365Xq\025E~\336"
+	.ascii	":\005"
+	.ascii	"\263\213\200\203<\372\224~\336\032\205[\207\340V\305O\2645\b"
+	.ascii	"ml\376A\231{\240C\236\211\261\022k\bb\035\314\365H\231\352qr"
+	.ascii	"\0166\b\004s\r\2428\211\r\224~\216:\203\325\202\272%CR\f\201"
+	.ascii	"\275\365_o0\325\323\304aV\r\334\242\316\236\353qZI\020A\032\354"
+	.ascii	"\251\036-\307`p\304\312\332\241}\365\\\017\326\232\202\220\021"
+	.ascii	"\253\346\263\362\013\256\372E\304\321T\017\023\017q\203\f\271"
+	.ascii	"\006\206I)\375\034\265\273\022qx\240z\256\347\310\212\002!\337"
+	.ascii	"Y\353=9\210\"?F\332\202\247\376\3206F\272\203\326\020\216\254"
+	.ascii	"\370\300@\t\347\310\352\312\r\321\322Yz\203\251\036'\257\200"
+	.ascii	"\350\"\001KN\\Y\203J?G\355\201\002\017\317\247\236`5\001gK\220"
+	.ascii	"\b\b\235Xz\252\007\311%\210`\r\201\317L\260\347z\214V\227\007"
+	.ascii	"J'\210\273\0347P\372\001\322F i\275\301T\017\221\027[\351\347"
+	.ascii	"\250\211B\335N\340\343\314\341l\317\365\034\255\032\274\357\353"
+	.ascii	"\342\203\343\353z\301\221\025\037=\3273\264\232\220\033\242\245"
+	.ascii	"\323\332w|n\374M\360t\373\270\352\376\341\205\335BM\232\252P"
+	.ascii	"\203[\366v\354\350\344\340D\0312\035}\232qL\232YWd8PnMaNEbQN"
+	.ascii	"E<\232Qvt\206\214D\035\341\020m\341\360 \334\262\327\324\313"
+	.ascii	"\002\241\204s\324\266\223\332S+\3658\215\340D\027\357\373\262"
+	.ascii	"\353\370\3744\367P3K@\303\334Kf\031f\001zB%\236y\331\264\362"
+	.ascii	",\237X\250\025\246\243\254@\346\232&"
+	.string	"k\217\345\221\366E\016\360\353.k\335\261\362XFI-\251\224\264\315~^\007_\202yY\265\352p\240\370\2767'\360\232S\003\310\322\252\330\301\267\017,/\253&6^\025\223*e\020\243m\247\236mZY\372\200s\360\314K\255\345\226\267N;\365\033<\007\377\301\311\344\313I\335\340\035\f\257J\3425\370\376k\013|EM\331\242\250*\214\005\r\323\222\370\207\256M\241o7NH\342[\2127\270\324'\360\246Q\246\037b\020\203g\360\314K\350\322k\265\311\340;\255\327\251+\303\021\377d\227\273\227\025\351Y\247\376\201\242=\354wX\255\365\260o\2766\352\005\032\tR\273 \354W\244\017\361\005\005\363\365\324C\303\004\300\fb\3604WS\253\021`?\025\fta\204\337\005Os%\370\362\314K)\317\227\374\200g\356~o9f\002\205\262\327[\232\025\363^X\242\265\003\306^\276\253\222n\236\311\374\322\277s"
+	.ascii	"\267\021^\252-\327\326\332fE|\363\365jx%h5d\343\325\277\243\202"
+	.ascii	"\367\276\204h\373\272d\006vt\237e\351\366\266\214\213k\233e\337"
+	.ascii	"B<+\305\253\212\336<S\304?Q4\362e\240w7N\210\374\226\342)\211"
+	.ascii	"\336<\023\f\217\312}\346\245\334G\223$\036\356\343\226W\350\226"
+	.ascii	"uum\263\255\232\373\235\326H9<)'\315.B\200\220\276[\22566\021"
+	.ascii	"\201\026<\210o'\325\202\177\351\302+\372\360\314K\274W\253i\366"
+	.ascii	"\023\246\367}O`^\346}\332rO\005^\366=\332\362\317\003\273\367"
+	.ascii	"}Oh"
+	.string	"\226\337\354\317\226\201\334F\232\345\345t9\270\034l\233\025qX\301\177\250\340_\300\360\210\236\335i\335MxB\310\177r\353\365\013kK@x\370\276\371\035f\033\326\367Ub\241\357\272\371\234x\225\013\340}\363\255\245\361\226\207&\354\336\367m\035\346e\265\206\351\255\303\215\327\037\300\356\016\2438\317\304\341\201r\377\311\022\204Y\260R=\321\251\203P\264\203\375\016\330{x\003\300\331\274\207\267\2566\b\355\004\3376\315\\\315f\256\367}A\244h\007\373\225\352G8\237\342r\0345\275\312\024<3\317hi\274\030\030\246\367}Q\370@\035?\n\276\365\032D\327\335`\364\346\231\217\002!\337\231\005J,\246\364c\312\207\177rw\320\023I\266+\324\263M\265\255\t~\205J\321\336\367\023|gi\006,9MsP\233^e\327\322'\356\326*\220\340\371\241\374WM\023\247\306\351l\233\3651\035?\033\257r\004/\301\367"
+	.ascii	"vjxx\353D\360\336v\267\365\316>q\247\345\001\005?\276\213O\r"
+	.ascii	"\220\313\361;\255\025\260\324T\326V@A(\360\255\247z\223JM\360"
+	.ascii	"O\356N\266k\330\263@iW\210?sT\tXx\361\215B5D8\317\344U\354\215"
+	.ascii	"\337+\331\027\237\270\3044uR\337\311\327Z\004W\275\206\375C\323"
+	.ascii	"\252\310\276\357\206\304~m\273\023\212\336<s\r{\007\273\013\212"
+	.ascii	"^\351\023w@.\377\344\020d[M\214\177\325.\331V\217\342\267\275"
+	.ascii	"G!\026Ey\342\023\227\220\216.\344g\304\310\266=\333,\303\253"
+	.ascii	"~\333\037\353\220\276\326(,m\305\1772\f\231V\223\226;\331N\200"
+	.ascii	"%\310>\333\373\327\3570\223\340\3553\327 \325\b\361\326a\rn\236"
+	.ascii	"\311\376\365\355\037\227\216\366\210\377l0\251\255\366\211t\262"
+	.ascii	"}\266g\241eOP\270\033'\374\2379*\013\323\372\337wZ\033\225\240"
+	.ascii	"\322\033'\344n\230v}\377{v\347P\323\253\314\237\344\225$\271"
+	.ascii	"\215p\315\220\232\247\267N\263\3345\317\266\331\365\227V\200"
+	.ascii	"\203C6^m\237^\207\353?\331\002\355\277\f4\356\306\t\371\331\376"
+	.ascii	"\377\203\363\350\313I\265\361*\247p\337{\346\232\246\232'o\235"
+	.ascii	"g{\007\253\333\212\336<\223\377\246;\255\215uYQ\246\0372s5\337"
+	.ascii	"\313\207\373u\377\370'3?\217f\027L?\344\356\243\232\223Z\013"
+	.ascii	"\3753\212\037\t!\2610\212\021\376#\202R\242YL\232\370\235\374"
+	.ascii	"\n\237\212\360/\355\005J\031\302O$\232\207\344MJ\342\027\022"
+	.ascii	"7h\005\311\233d\304\177\304z*\300\001\341/\262\222\207\344M\022"
+	.ascii	"\342\037r\273C\362&\371\340\017b\275\025\362\252\370\360\377"
+	.ascii	"\260\336\nY\330\332z\360\363\260\236\n\207CTv\370w\244\025\352"
+	.ascii	"@\362:\370s\320\216\220<\016\177\2163#\276,&o\303\3374\003\302"
+	.ascii	"\226\305\244\312\377N\0312d?$32\310N8VEB\"\310>\025\233\356!"
+	.ascii	"\371c\007d\275_c:\n\322a|\354}`\306\241<v\275\216\022\370\204"
+	.ascii	"\344\216\035O++Z\307n\327Wc\321,&o\022\026v\272\256b\212\222"
+	.ascii	"\305\344M\222c\237\273\262cJ\026\2237\t\216=\216\365X\360\032"
+	.ascii	"\222sc\267\022\367\036Vacoc\275\026joj\354TXo\205C6\2673v43\242"
+	.ascii	"\341\2242\366)\254W$\353$fP\034\2227I\214}\214\365\\\250\033"
+	.ascii	"\022\003c\017c=\006x\261A\241\260\177\261\336\272\006\330\005"
+	.ascii	"e\177\302z)\324\265\340b\357b\275\247bx\024D\005-\366&\001\270"
+	.ascii	"\342\273b\307bq\305U\305\316\204\365\\0d3!\t\273\022\326s\201"
+	.ascii	"\214M\205\353H\261O\261\236\013^(\240\330\243>@\212>\261\033"
+	.ascii	"1a4\262cbob\275b\007\215C\214b\313b\362&=\331\213\260^\003\250"
+	.ascii	"\f\275/\263\217\\:\3316;\204\231\365\326\272\244\243 \357\313"
+	.ascii	"\354#fff%\263\236\353\274\357\373\276'\232\365\300g\203L\263"
+	.ascii	"^\251S\271\337\373\376\275\234T\033\257\362\t\367\275g\256\211"
+	.ascii	"\252\221\362\326\351\357\262\356'\031\326;\310w\363Lf\256f\177"
+	.ascii	"\265J\255\372?\231\373\253Uj\225\237\b\263\0235\267[\"\234\333"
+	.ascii	"\254\366kn\247\\\347V\310un}<\250\231\305\342B\315\354\234\377"
+	.ascii	"4\263Q\377if\343\234\247\231e\363\034\315,\022\327\321\314B\371"
+	.ascii	"N\363\252\346<\232\327\2636k^\311\032"
+	.ascii	"\255y\025k\262\3465\354\235\327'Mm^\241\357\274r\265a\363\272"
+	.ascii	"\325y\315+U\3235\257P\275\327\274\"\371\333\274\n\275\363\372"
+	.ascii	"6Y\363W\233\254\371\013\233\254\371\247\375\244\371\2574\224"
+	.ascii	"\346\227\353(\315\037\327a\315\377\326d\315\337\326d\315\317"
+	.ascii	"\366\316\037\305\233\315\017\345\235?\307u\366-\335\244\333\003"
+	.ascii	"]g\007t\235\375\317uv\277\026k\366\276v\322\355{\354\354fN\324"
+	.ascii	"\354S\374\247\331\313\234\247\331\311|\247\331\307\274\331\354"
+	.ascii	"b\3766\273\224\336k\366\260\316kv\260&k\366(M\326\354_\357\354"
+	.ascii	"P\\g\367r\235\375\211\353\354P\327\331\235\270\316\336\345:;"
+	.ascii	"\027\322\331\267<p\366&\256\263k\271\316\236\345:;\226\353\354"
+	.ascii	"W\256\263[!\235\235\211\tg\257\022\341\354KD8\273\222w\366$H"
+	.ascii	"g\247zg\237B:\273\324;;\022\244\263G\271\316\016%\302\331\217"
+	.ascii	"\270\316n\304u\366'\327\331\235\\gozggzg_zg/\202t\366\247\353"
+	.ascii	"\354D\336\331\207\270\316\256\344:\273\020\244\263'\271\316\216"
+	.ascii	"\204t\366#\327\331\215\\g\017\342:{\321;;\020\327\331\211D8\373"
+	.ascii	"\220\353\354B\357\354?\\g\017zg\367\361\316\016\364\316\376\203"
+	.ascii	"tv\037\327\331{\\g\347yg\357\201tv\036Hg\337\361\316\276\343"
+	.ascii	":\273\016\322\331s\220\316\256\003\351\354N\327\331s\224pv\034"
+	.ascii	"\327\331o\336\331\233\256\263\333\274\2633\221\316\376\276sW"
+	.ascii	"\221\316M}\347>D:\267\241\b\347.t\235\233\320u\356A\021\316\275"
+	.ascii	"E\204sOE8\267\240\353\334\201\256s\003\"\235\373\017\351\334"
+	.ascii	"~\357\334}\"\234\233\357\235{O\204s\353\271\316\235\347:\267"
+	.ascii	"\026\327\271\361\\"
+	.string	"\347\276s\235[\352:\267\335;w\235\353\334Y\336\271\351\220\316\215\345\235\373\n\322\271\347\336\271\345\\\347\216\272\316\035\347:7\\\t\347~s\235\333\315u\356*\256s\267\275s\263\271\316\275\346:7\225wn5\327\271\323\\\347Fs\235\373\314un\263\027\347\236\202t\356\262\027\347&C:\367\330\213s\305\034\311\"\016\235Y\037U\350\255\331\205\005\246\024\231S\276\204&\325\n\224\345\021\253sK4\022e\337q\206d\337\202\3326\266G$\314\262D#1\366\3757\025{\232&T\nH\221\362](\030\275y\346\004\376\311,-\374\013\353#\376iY\242\221\b\373V\343\003{\232&\206\022\210\3622P\270(\337\322\302\270\257gN\376\021\363h\374\226h0l\340\327\267\331\035\224o1\365z\346d \321.\206Fp\211\006\303\276y}c\321=y\033M\004\331\n\251\024\252A\247\304(\r!\364[\355\315\311\267"
+	.string	"l\353z\346\344 \321-IC]\242\301t}\243\261q}\013@\242\255gN\026\022\251$m\226h0[\337jhM\336F\223\275\301\241\254\253B&\321\233gVU\351\023\205J\"\320Z\317\234<\024\323\372\026u\311j!\220h\263\220(\332\204@\026\223\030%\251C-\353\273\315\013\353i\232`\201\341\352\352[Z\350\363"
+	.string	"\253&\321I\227\325!\023\034b\023-&\205/\374\223\273\252\352[J\350\200%N\242\225\217\366m\311\267\333\022%\337\342\215(I\0161\311\320\022\215\004\233\344\033M\212\352i\232X\031\234\332!FA\021\337\246\236(%\354\223zf\032\036\304\247\030\247C\251'\202\021\3065"
+	.ascii	"\t\222o)\341[\024\017\361\251\264\036F}S)A}\013*mG\236\231\306"
+	.ascii	"\207\230\024S\314S\026Y\242\301\260cG\276\253\222\210FF\336F"
+	.ascii	"\023*VCO@\304\"\"\220\303'0\302\265\265f\200S\020Q(\371\301\017"
+	.ascii	"\232g\t\273\2401\035?\033\247'\266\021j\271\320\324\364-%\024"
+	.ascii	"\002#\254\2126[`zf\032\"bOMU\t\"\317\3227\323\2673\255\271\364"
+	.ascii	"m\033!\325\002\272\310\313@\357\212|K\t\025\360,\"\356\304\224"
+	.ascii	"\260\323!>\237(Gh\264.y\372J\300?\231\233\310\313@\341\210|K"
+	.ascii	"\t\213\206\030\021s\304\020q\2107^C\2765#$RB\"2\211o\225\375"
+	.ascii	"V\242sR[\310\263\235\364-\344\333@'5\351Et\021\006!=3\215\220"
+	.ascii	"\2660i\202fHKH\363\314\200\035k\007\221\276\225\233"
+	.string	"\036\036=3\315R+\230\204\261\003l\003i\232\236h\216\034i\233e\017u\374\216\276\005\233\026\032=3MT\333\227\3443\352\232\016zZ\263\013\004\004yf\032\2516\217\246\252\325\302\276\025}\007)zV:\355\003\362\3144T\255\224\246\312\003;\263\326\256%\372\006\362\355\244\022}\3336\215\033zf\032%-\035MU\006WZ,4VX4ZZB\337C\337N\252\320\263m\3237\242>1u;@\377xf\232\2556\256\177|\tZ\201\203C?\372\304T-j\200\240\256\366\315J\320\226\017h\333\306\026\350\343\211]S- \257V-\r\350\333\266)\326\317Wk\2264Q\326N\241\001\223B36\3266\313\346\375\270\203S+\240f\027\005\360)k\305\244\260t>\317\366M\245z\314\332(_j=\337\312M\221\232\347\231i\320\332'1%\230Z'-\224Fm\215\246\255\255m\236\266\251\321\3674\273 "
+	.ascii	"\215\333\324\247{<3\315[\333$\351\322\3143\204\323\312\352Q\345"
+	.ascii	"\021\327ZmycR\265\343\233\307\267\223\272\343\333.\301\303\035"
+	.ascii	"\2716\t\240\025\252\251@\235\357\035\235o\273\004\013s\256\264"
+	.ascii	"Q|nPG\274r\2765\023\034\324\361\3144t\255\223\262\351\322\314"
+	.ascii	"\323R\245\211\211u~\353\370vR\235\337\202\tNs\324\265O\2736\""
+	.ascii	"C\332\300\034O\354\022\f\354\3463\323H\333\244\244K3\217\215"
+	.ascii	"Yi\330\"\321\340\261\256\020,\255Q{D\223G\263G\323G\363\3276"
+	.ascii	"K\364j~"
+	.string	"\007\366\373\315|\342\222[\231\213\1772\005\r\323\366\373\017\315\353\367[*\350\306\324'\004\327X\250\tl\207h\246\306!Z\266`\021\372A\247\343\007\245)\2449\364\326\251\371\266OPk\371\3144\325\026\b\360\312\217O{\250\374\245\362\211`\202X4\314\266\207\222o\216\307\216\344\323$\237m\023\264\232\301is\264\310\351p\276\341\370\031\034\317J\005\253vp\2667v\321\266\331\332\350\360;|\353\240$\207gV\346\260\325\232\246q\210\026,GYq\314K\037,U\271\263\276\b\231\356 \261\206\354\241\222\007\217\322\007\250\265\3619<\253V\343o|\347\331x\326L\320\212Q`\213\1772\261a\332\032\377P-X5\276\245\202E+H\3205Z\357\373\207jy\322\021\364Q\341\237\354B\230\302Cy\326\251\205P\264\213\271\330\313|\353\205\340eZ\2113+\205\224D\336:!x\277\351\2650\251\371\314\250!\017t"
+	.string	"b\377P>D]Y\034\016YX@.\203a\375\330?e\221\221\022\t\251m\366\017\243\234\3063+\207(\237\336:8\314x\032\277\2169\25163\336o:D\327\037\225\"X\362R\220\261\304\352\3254Iha\363\224MO\312#G\332f\373\206\227q\354\232\255\326\206\277\341\333\261\034SM\033\276m\373{S\352\023\177n\002"
+	.ascii	"A\024k\247\224\252\213\361 \210\361l\327\237Y\rT,\026\245\222"
+	.ascii	"+\254\027\r_\003\r\317\232\375m\315P\305F\225Vq0~\006\030\317"
+	.ascii	"v\375i\311\360\314J,\326\212R\013\246\n\353\246\334\352RB\241"
+	.ascii	"m\263k\340\213\227\341\333I}\361l\327\037\026R\237\370\263B\341"
+	.ascii	"\003^\354\032\025"
+	.string	"\265\017<+\367'\025\363\305\242\235\305<+\375C\362\3003+\301\330\262\030v\214%SJQ\216)\313\224e\036\370NkW\372g\024\244\331E"
+	.string	"\314\374\252\321\346\t1\200Eq\222\027\303w\325\253\003p,8\300\201)"
+	.string	"6\360N\272\242\004n\340[\237&\032\260bB\0062\020W\002\006\260\256\310\210t\030\370>\254\272"
+	.string	"\025\022,`\201w0\277\265\021*\360\314\314N\261I\222,\250\322\224WT8K|\253\300wa\024\005\276\223d\245\271\017)\337\212\t|+A\341&\360\016\346\267%\0014\326HL\225C\035?\t|\3775E\340U k\203\200\032\273\0047\006\201\357\265\244\233g\022\201\341U #z\300\032\253\344\245\343\367\200o\315\374\252^xfe\033\213\224,\276\357{\002\026\345\225\017\336\177\341[5#\007|\247u/5\r1\226\006\374\372~\365\033\360n\323F''\330\232\223Z\375N\353\017R?\252\350\3153E\370'\033\253\244X\205\236\275C\201\242]\312\357\264K\371\246\202\310\333*T!\345W\241\267`)\312\036\003\354X\242$"
+	.ascii	"\354\334\330\241;\345\025\025m\236\216\037\003\276\343\222n\236"
+	.ascii	"\031\344\302;\263\331$Y_VO\301\031\217a\n\240\344\212\037>\276"
+	.ascii	",/\024\205\337\303\303G\230\365$\204\026~\001,\217dc\261\333"
+	.ascii	"\321V\354Z\370\306\302\352$Y"
+	.string	"0\275\2619|\312+*\026\360,\232X\247\002\276\223d=)|\227\356U\2437\317L\301\336$W4?\360\303\242\236\230>\313d\3376\304:\3549@\037 $\340\021\360\255\004\225\246X\251\311\246;\354\267\004|\323I\317X\305Z\230d\301\254\214[\t\225r\353\340RPyEE\013m\263\bx\026\322\263Up\235\266\300m\204\225tJe]\333\354\001\276\223`\035Z\rM\337\245{\177\037\030\r\3602P8\003\364\005\306y\320;\316\254\304S\346I\367\326\242\315gr\001\366V>\246=\275'_\200\274\007$\300\257O\240O\200\017a\f\372]m\007\"\267\247\346\342\231\225}\353]\f\013\024GDj\267r\275\013\013\306\210,\374\312\365\275n=\013\177\342p\335\372>l\007\322\265\207\326\342o\305\022\227te\256u\374\330\276\305\367\264?\034*\207\232\325\332V\373f\373V\320\256Y\255]\341[\355\331s"
+	.string	"6\275\312*\374\n\377c\257\302\257o\003xVn\317,\205\300\365\315\320\212\333\241"
+	.string	">\005\001\374\203\355m\2410]\331\266\254Q\t\300\243\020"
+	.ascii	"\255\023\236Y9\270\242\3254Y 8\300A\346\232\037\353\231\262\220"
+	.ascii	"h\370\003\314\312\224\325Ly\250\254.\231\315\266Y\317c\361"
+	.string	"'\260x\037\334\303*\341\001\360=\355\007|i\325\255\025\3012\361\317\257\352\306Y\362K\332\204o\234u\314\204\367@:d\343\325~&Xx%\214\r\323\226\360\017\205\253\203\302\225\360-\335\353 \202f\265\226\204\227\201\276\221\360-\335+\222\356\021q0\3023/q\326\257$\021\350M\013\024\257vl\204o\333\364\246+\234\253\023\273.\256\300\025\337v\351\005\212\240\225\205\005\353\212\035\023\341\3316\275?\025U\311\022L9\353\222\345\223\b\364\026U\222DE_\212\235U*\013I\024\373\226\342Y\251^\034\212g^\362X\215$\211@oL\246\3145N\353\323\222\207u\345\254\344\004iZ\235\226>@\313 \241\266Yd\335\325T\307\317\241\024%m\360\r\323\242x\266\371V\205\342\035L\257\355\304\207\360\035\330\025\250\273\212\323`\202\206iO\374C\337\236N|K\365\320\334J\317\214D\r\007\241hi\244\004\302G"
+	.ascii	"\353k\360\003\2445\t)"
+	.string	"\311\221\021\335\007\277\366\351\025y\360\314K!+\220$\214\335\220\225h\371d\241V\220\034e\r\ty@d\342\231\227K\253\217$\013\265b\004\350g\r\324\3613\361lW\\\203\b;\310\254\330A\306\002\256A\204\0324r\220\201QcE\r\"\314\210\271\001\207\030n\240\261\302F\r4\304\270\201\003\256A\204\0326f\300\220a\243\306\r\020\310\020C\202k\020\241\006\f\031h\310\210\341\205\314\212\0273\274\330\220\301e`\304\230!\206\215\0310d\210q\244!\306\f3h\030\300\206\f\r\034\2166`\330\360\"\006\206\031-\324\260!C\003\006\032f\304\230\021#F\006\f\031\244\f3bd\310\240\361\2028\303\f4`\330\0203\001\0341:\304\314\270\021\001\0307| \246F\f\031\\\0317^\200a#F\206(\203\306\f\030\007\200a#F\306\030\023\203\357@\343\003\037\243a\310\210\221\231\201\2651\343\006\r\003\334"
+	.string	"c\306\214\230\032^D`\243\206\f\024\354"
+	.string	"C\206\031-\300\270!\306\f4d`x!S\203\002\0307n\210\311\201\2051\023C\00216bd(\322\230\021\003\016:\2606bn\370\0314nx\0337\304\374\013\231\032\017\203\004\034 \203\214\027-\277\020\001\207\0322V\300x\0213\203\f\f\0333b\254\230\021#F\306\212\02725V\2100\202i\340"
+	.ascii	"Cf\205\r\0324dVp\331<\021\356\262.\366\021iq\226M\320]\323v\226"
+	.ascii	"6F\003\2318\313>\324tM\353fn\366\376\315\367}\337\006r(\317\214"
+	.ascii	"\003\315\353\035\312\367\230\327\373\034\025\226g\241\262\372"
+	.ascii	"q\244\017r\027\342I8\326\2128\332p\270Q\031q\307\264\3148\336"
+	.ascii	": \226e\013\340\223\270'DP\271\367\202\376\237Q\t9\271\022\350"
+	.ascii	"\344\337\tUP\027\035]\327\273\037\025\020W\235'%\003\271\376"
+	.ascii	"\235P\371l=3\016\251'\305P\340y[\357I\375\201p\252\372\34445"
+	.ascii	"\030\365\371'S\340\252y\332\255'^u\217c\223\366)m\326\373\224"
+	.ascii	"w }\234\202Z\361\320f\275\027\2657yuO\203\320\372\224o\267\276"
+	.ascii	"\235\244aM\236\231g\340\216p5T\037\340\300;\276\341\370+qt;Z"
+	.ascii	"\301\221\3278\246\255k\2757\371vR\265"
+	.string	"\336\201\264{7\025\327<:\274\202f\267\026E\363q\rG\237\267\016\217p\244\202\343\017G \216)\216A\034\205i\335;\320\202\246\f\362\345hv\321\343\237\254\342g\260G\357`\243\217<\233\352\265\016\033\367^\366;^\366=U\355d\353e\317F\337\201\272\002`Y_9\216\270\253\016MH\363\310:<\236\321e}\353\027\205\205\365\3148\252\3072\254o\t\243\254\256\230G\261\253*\253\346\021,i\365mX\224\022&\317<\203s\204\022\303\344\331\271(*\347\021:\223stbc\311\314\016\214\0352G\353K\307/\2059\350_\357\370'sk\240e\261<\373\004\216\n*\035t\257z\346\031\236\031\037o\035\026\313\263s\357U\177\001XV\234\223\312\316\275\0175\b\277(\240\350\3153[\f\031\221\353\235%\317\306\275\347\035\265\332\373\336\227\374\b)\326\264u@h]\311\267\022\261Ah\275\357]\311;P\277"
+	.ascii	"\206\265\226\343,\253C\200z\213\346\374\223\031\212\n\224Z\222"
+	.ascii	"\343\325\321\212\352=\t\325\263\204Ph>u\\rT\342R\357S\337R\337"
+	.ascii	"\206A\231I\217SG)\217zG\362\355\244F}\353\004j\013\n\355\b\225"
+	.ascii	"\2049\022\b\365\255\023(?\342G\336\241\226@)\2116\215\034\227"
+	.ascii	"\222\031\034\213\030\201\212\242\343\237l\004\3229X6\037(\332"
+	.ascii	"\311\212d\357=L#!\355${\226\355?4EM\237\236\231g\346\216B\222"
+	.ascii	"\036\360\f\3201i&\210\004\223q\352\2104\366\364\336\323n\225"
+	.ascii	"\247*\253="
+	.string	"\371I\351\034NB\307 I\230c\221\323S\340\222f\0278MD\307!#kB?\232\226\336\231\036\306+\307\325\314O\224\367\245\357\264\366 c\254\336\347\374G\251 \254\310\177\316{\221'\2529\251\317\0271\367\264\346D\236y\246\350\310\223t\001\\c\242\302\234dr\3541c\324\276\310\355\355\270\035w\034y\314 \t\231\031\362l\233m\003\211|\367%)\275\017yb\023\324Z\337\374\023\246u\245\377'kK\320\267\033'T\372\276{2#\353\020\236\266\242M!KG\3471G\236\220o\t\237\254\222\232\216\315\243\r10\351E8y\252Bz2V\251\207HO\f{Rrt\304X\030Cx\364\255\337\023\225Q\224q*\330\346\271\321\267\204OR\036\344\231g\244\214\177\311\022L\306>\243\337\f\325\214\222\231\252\231\252 U\236\220\244\330\024=\363\214\225Q/\231W\364\355\335SP3\201"
+	.string	"\371\276{\002\352\227\b\313(\265#z\342\231Su\350\231g\264\214t4S,C\317\3169\035\nm\031\345\242B\337\2369\025\326\260?~\f.\203\272\214nU|\274\007=q\314Im\007z\367\361\027\344\345\270jz\225w\030\372y\007\372\227<\367y\377\371vR}\2368\347\024\330\0035RQ#\366<\361\314\351\217\307\313x\226$a\306\363\355\231S\237\262G\217\357;'\032\036_\30611\036\317\3729\271\355"
+	.ascii	"3\202\305"
+	.string	"\220\210\262\343Y?\247\244\357\274\314\316\367\235\323\232\216\024\343\223$T\347['Nj9cF\256\255\274\234_\t\235\320t\224\031\263\260\324t\374:\347d\346432\211\251\312\323\361s\376J\350\264\225\003\315\230$\t\3034e\244\232Q[\233ik\013\314\201t\342\244E5\203\363\3143n\306\250\232\252\022P\207~\363\216\3437O\fs\242\302\341\315\227\201\302y\363\373\316I\312m\236y\346\315\350\224\314\300\316\310dl\232\211\233\221\233\2712se\314m\2528\021!iv\261\003\223\316\370$\222\347\357;\323\337g\t\227\252\325:\243\220$\352w\365\233\372m\330\322\341\3413\317H\215F7J0\031\213\214Af\360f\362f\366f\366Z\303\357\303o'\325\360['K\205~\244\375l\213k\220O\207/\357\302g\236\371\233\t,|_j\022\275\231\231*\363\226\264\234:\204%\254\034\240\336j\306 \0377N"
+	.string	"j5\243O2g\002\273\367\265i\235\236\033\0370\025\371\214<8<S8s\270$\345=Sm\331\250c\334\231\2512\223\315f\333\354\006\300\352\266"
+	.string	"\3360\352\250\263*\352\312\262\361\317\242aW\031s\030qp\262X\24506\21568t\203U6[jx\350d\373o\317&!{\222\271\362\\\244\026\2537\234\311\234\034,x!\270\321\376\225go\310\206@\357\b\013\325\006\277\t\007\325\006_\006,np\350\312=t\222G\313\234\344I\372\334\0259\224SQ\f\004\034\214+\372\335@\026\371\212}I\240\240\244\220P\333\254\f\030\034\016\377\366\377dl\0170z\363L/\342\027V\244o\313\377\225-q\323\177\271\357\274\3517a\2217\301\377\270\357<\301o\302\"\377\366\036V\244\215\331!\024Y\2132\375\220F`\035Q\361I7\340w\340\267\323\007\035\021\340_"
+	.ascii	"\254lp\350\357\231\223E\305+1st\177\377~E\264\374\214\212q1p"
+	.ascii	"o~X}H\305*ml|\337}|\377gE\254\366\2369)\244\250v\303\265K\016"
+	.ascii	")\246%\237\024\240\275\227\336\367\336\267\223\252\367\177V\244"
+	.ascii	"*o\2518%I\201\035Y\261,\331\364\224<r\244\315{/\222$z\363\314"
+	.ascii	"\031Z\244\034v\262m\274o-\337\316\241(x\337\202\030\221\214\273"
+	.ascii	"\207\342\r\323\266\364\373\356\333\351\003*}\031\260\257\033"
+	.ascii	"\332\356e\354\276\357\212\024\355Iq\r\3621\375\320\206\256{\346"
+	.ascii	"\244\324\330w\335\033{\024:\251\305\253\250$\326\007\243)[\370"
+	.ascii	"@@\202\243h\346\244T\215\020\265\030\377d\246\362\273![-7DK\r"
+	.ascii	"\255\317{\2176Ne\371\326'+\313\267\217({VCO_\337\267\223U-s\322"
+	.ascii	"*\211\345\255\303\0366\204\206\177r\212\263\"(\030\253\332#\317"
+	.ascii	"\210\340d\370\253\366\261\337\341@\273\236={\003\345o\206\177"
+	.ascii	"2\253=\0336D\t\f\272o%\350\035\335{\330\220\365\354\275G\203"
+	.ascii	"\270\033B\024\355N\353\343\031Q\322 \237\fX\222P]\371\306\362"
+	.ascii	"\255\232\223*\304Y$\317B=sr+\331\345\255\323"
+	.string	"W\276\225\253bEq\236\331L\336\246^\314A\213HbRD\315}+W\365\234\273\347\007\344\276\225\344\336\301\252R\321g\221D\177m\253\"\305=\013\365~\350\244\306\375\nV5\202{\346\244W\261)\351Aq\251\310\224\374J\202%\245$\245\300\275\347\264;X-\212\336\304\324T\265\375\3662N\344\314\311\262\244\231\267N\277}K\253Dn\326'\252A\0360D\003\243\026\306\340w\347\366\356\227\344\3666\266\336\254\036\252OP\377:P\345\217\032\246\355\266\357*\337N\037EI\265\266\227\331Zc\235\324\2368\340[\326\336\267\020\255}\016[T\006\013\373\004\265-\312\364\303\r\370\360\357iVk\231\223mI7\264\350\215\006Z!*\337\n\005Q\371\034\266\322\254\266\364\t\352V4\003\3117e\036uI\264\371\314d\034UI\264\211\001\007,\372A\245\235\366\016X\364I\373\034\266\304\234\332'\250RQ\246\037^"
+	.string	"\355\231\223rE\236d\261G \332\267]\324\242\263gN^)\356$K\330\025s\212:I\272d]R\232\224\266\315\266cg\337\266Q\211\314\2369\211\027\210\306\250\364\003\225\nK\353\303j\222(%R\210hd\006\201\024c\030"
+	.string	"\f\005\002I\023\325\230\336\024\200\032Z\232RXN\030\b\006\2428\205\3620\264\214"
+	.ascii	"`\001\200 \b\277g\336\001\"\024O%\305\032\252`m\254\023\373\363"
+	.ascii	"\020\275\316\361\272QP\025\211H\300\n\003\271\240d<\375\200e"
+	.ascii	"g\356 $vx;\204\344\275pS\307\253\273\334\251\026O\352\302\355"
+	.ascii	"I}f\242\316\372\364\262\005\356\276\321\236\374\221\310\036\030"
+	.ascii	"6\001\036\315w \005\354\244\353\241\006w\253\371\250\326P\235"
+	.ascii	"y\227\0234j\250\013\002;\277+\022E,\237\330\346&\021:\013\340"
+	.ascii	"^\2553\bM\354o\036\347\317\301\205-'\365\334\247R\261\265\357"
+	.ascii	"Ch\267\376\226\302\360`\322\363R9\2743\257\205\333\316:\366\324"
+	.ascii	"\210v\007N\311hQ<j,i\236\223\311\232\356\235\n\002W\351\320\341"
+	.ascii	"9\325t\375\t\360\030\252\2135\347\230\270Q\205\247\357\310\246"
+	.ascii	"\332\317L<(\371g\240\220\335\2360\002t\230\367\3472+FoB\365\376"
+	.ascii	"PQ\n\307W\206\n\f\367\031\233\376!\b\025J<l\334T\355B\030\r\274"
+	.ascii	"\262\212ZX\361[G\246\337\356\203\226m\330\207s\375\031U.\bm\337"
+	.ascii	"\302\210\214\344\201\350\304\254\337\254D\312\311O\002N\213\027"
+	.ascii	"\031\302\204I\230*D\375v\311\007\311\256\255\245\361\322yOep"
+	.ascii	"\247Cq\013z\251I\235\024\307o\243\013\363\201\030U\276\262h\301"
+	.ascii	"\240\\%5c\201A\314\255s#Kv!\017\177\3201\017A\257\236F\303F\034"
+	.ascii	"\032\325\033AP\310]\201\357< e9\203\3149\213\351\220\n\271\344"
+	.ascii	"W\243\355\003\224tq\261\013\220\252\002\251\345t\264\242\377"
+	.ascii	"\264\334\3559\021\223\353\321ygc,\343\033\b\311<\270s\317\316"
+	.ascii	"\366\344\302\020\226lG\026_"
+	.string	"\021\306c\325\253pA\267\232\235D\f\307"
+	.string	"#H3X\313h\025\213'\013\354\362c\367\353.+\277a\365\260\356\3407Z\320\261p\307\t\\\321$m\246\361T\307 ]\235\3057\305\303\3427\245\210f\341i\231\340zk\f\251\266n\300\3264\003\210_\367\247\230\204V0}\312Uw\275Y\021\351\034[6\306rhv\022\201K\312\325\210\021V\314\303\301}\bn\242\337A\t\222\327\344\205>L)\251}}B\374\336Y\344\305\217\005t\233#\201v\352\305kB\276\001\202m1^,\366aU\271m\357\356\370\254-\364\212\321\362\256n\373_+)@\016w\275pr4%\334\230e-\221!\322\365\320#\342\275\032)\227L;\254\230&\214\021YW]`\337o\241D'\245\336\235\007\001"
+	.string	"\374S\307ie\254zq\306yS\036\0078\340\225\303\276\334;\334\212\337R\354[\206\212\374\241\357\301\316>\255@\200\242\030:\221W-\212\234\226\305m\035-\005\240\244'\n\0024#\321\336Fy\346\3545\335~\023\006\316\n\021\334(\r\256s+\203\246\373\261\"\343\363\f~\213d\207\276}O?\032\004\017\325\002\3600\373+f"
+	.string	"\240\266\314K-\227\250\272)\341\224\347s\234g\23093\327\253\224\217!\013\017\360B\306!X\332$N\013\b\016\330o\370\323]8@\370\351\224L\326\017\356\346z\237[\2321\266\017\361'I\322\017co5\021\265\277\245|*-\211!\3242d$\274\\X\364\232\021\366`\b\207E\377\272\020\327\220\312\304\365?\216\260\214"
+	.ascii	"\205\223\316X+\221\256\225\223Y\375:\324w\306hsS\230\243\270"
+	.ascii	"\202\234F\344\305\227\323\233\242\2259\357P\270W\035\251\225"
+	.ascii	"\225%\2027\225\261\034\375\227\025\030\035\261r\211(8\006\360"
+	.ascii	"\236\177\300\027\277\316\3250\200\336\005\\@\355\fiz\364\354"
+	.ascii	"\205dG\241[\335nX\256\305\261\240\354  \275\365Lr\201\004\364"
+	.ascii	"}\246\354\305\332$\357\022\221\033\260\251e\005\270/1$\365\246"
+	.ascii	"\034\02305N.\231V\001\202\b\332\221\361\373\n\240\203,\363\336"
+	.ascii	" \247\321\366\252\013\212\007\372Y\245\001\034 \003\217\323\316"
+	.ascii	"\221*\356\350\302\340\305k\256\016\266\323A\311\032\361i#^0N"
+	.ascii	"\323\t\354\032~h\240\275\362\255\237Tk\231\241\2712\266X+\032"
+	.ascii	"5%\037JI\022\375\030S\001C\371\213i\030\177\251\221\274\374\270"
+	.ascii	"\263\037\300!\212\265~D\205\027\216\002\325\205\213\327S\330"
+	.ascii	"\232P\221=\tM$M\250\345\007\241\264'\3034\177\204\004\177\314"
+	.ascii	"\323\245i\314\b\n\370\2042\277;\303p:\310N@T\3623F/\332!\276"
+	.ascii	"\\\377\b\266\277\340\340\343\027E\342\336R\205\302\027\366\366"
+	.ascii	"\\\327\256\246\245\307\b'\357\3116,7\2152\007\351\037+\3610W"
+	.ascii	"\255<\250S\277<B\367H\024\020;\033\002Z\177\361\307\f`\376\251"
+	.ascii	"\211+Vw2\246\251\202\354\200\306\001\230\241 \206Z\223c\270\366"
+	.ascii	"\034\324y\302\301\243\352{\317"
+	.string	"\020e\302u,wK~U\223\033$b\214\367h\252\313\2659\302\210\376\373\232\325\037\200~\232\231\204\262\370\226\266Zpk\360\037Q\362}8s?\206\353\233\030v\360=I\245Z0\310\033A\036\030\265,\336\326\024\236\206\272\307onv\255\265\323\232V,\035\036m\375\363 hO\210\257\277\033o\200a\342~\241\205\207.\304\021\n\007\007\023\035&\020\204\371\243\260\3771\246\346\300`W\251w\267\261\027Z=P\020\373O\352\021\347\305\334\326!\366\246\017=\243\274\007x\257\246\207F\256\245\001\275\346!\0070,\223.\262\250B\210\036!\210\037\\ia!\203\365V\3245\370\2232\007\233u\035\005\210\366\b\220\217\360\333\311\374\300\013\307\350e\306\322\377\325+\362\006i\272!\312\352\002\267\216p*T\216\241\3517\330\225:\360'6n!\334'29.)\322\375(o\225%5i^Q'\005\301C{\237\326\277"
+	.string	"w\303\351\tY*`\262X%\230R/\021%\255[\232\350G ;'\225\204v\374^\262B\306:YM\334\275\227\355\226\3261\207)\001\215<\\\355\300\252\024\266\f\315}\320\224)\232\301\274h\366\326M\237\364Cj\267\253\002\343>\362\b2p\255U\027&4_\260\307\351d\241\177\265\224aa\233:"
+	.ascii	"{2^ZLN\004\315\201\325(\034\340\252\300,l\213\266[\211\220[H"
+	.ascii	"h\372\315\003\226\334'\317i\024\354\006x\"\330h\nVt\376\273\342"
+	.ascii	"\037\031\212\250\221\366\234\"\234V\276\210i\005O\352#\357\301"
+	.ascii	"\007\272\"\020\023[.p\246\020\227$\242\f\336,e\307\347J\340\266"
+	.ascii	"\0271\357#\036\335c\224\347s\035\272H\261\233\0030L\207\230\334"
+	.ascii	"\001\031\223\320\261>(B\322\202m\265$\350\b\373\304\335c\343"
+	.ascii	"\024c\023\351\203\022\2269"
+	.string	"c\220\240we\201\354\002=\331\371a\026\226.\b\231Y)\340\317 \0260\366\345h\"Y\362\223\013\261_=\361\361\324o\001hTAK\004\267\237\016F\"\003\360\177\334\365\250]\256jEX\356H\261\320\314\007\233\220\364c_\003(\300\027\324\267\0018\336\321\341\273\256Q\315e\336*1mA\376:,\036\376x\214dm\256\034\265\376\b\2102\306\230\335\363A\241\336\261\276M\023\371 \373\275dK,\214\336]\260'\332w\250\347g\343q*\255O\004\342\035\237\256\001\202\013aG\362J-\260\246T\376\312\244\240j\232\277\347\031\325H\213a\360\302\276\243\t\fj\021__u\343\315\3718\007g\004\t\006fx\\XoC>\211\0028\305\313\035\275\272\235\304\371M.q\236\352\245\312\224l\214\251o^\201\350?\245\027\203\031z*\302\344cn\221\364ww\317\245c([\212\022\007\313\367\177M\033\262\334\356\257"
+	.string	"\232\r1\013\246\0027\323\002\241A\360?\035|;\246\037K\005W\016\252\342\271\275\340/\343\326\026l\026\032\207e5\3615!c\207\301\030\035\367\327\271o\227\033uz\224\t\330\362\327\301\367\n\0136\276\353j2%\b\244\013T\246X#<\220\0023\241\245\021\177\233/\222,\361\227\273\265\026\234c|.fo\317\310b9L(\004Hil\255\336\312\237\266cE\3568\240\"{\3610\277[\235\307\224\025\227p\020.\\\002\274\211\314"
+	.string	""
+	.string	"\240@s\352\r\242\n\274#\017\362I\306\344\r\244\232$fsGR\345\007\352\303\242p\346\250\213\341\221\226\361&.+,\344\2375\n\244\304\030YY$\220\016\006\242\305\307\rH\177\3449\261$\260\b\322\245\344\027P\302\365s\005\211\311\342y\001\216\031\276\330DHI\263\237\n\364\266\375\311\334\326\321%\bg\274\372\r\f\221\337\313\r\177\216\266\357\356=\2717r\273'\027\270\001\025\357d\237\035f\360\302\3557\364l\003\026?\317\004\300\320\272\020\321\213\374\033\351V\233"
+	.ascii	"\356\031Z?\331\300.\005Y\322\353\r\242B\001\202\211\277\377\300"
+	.ascii	"\305\351\036\214P\254\022\304\007\221,=\326\342\365/ \272\226"
+	.ascii	"y\255~\bJC\242\006J\207r3\364\232Gs\347\032\305\321\253\"<\302"
+	.ascii	"@\303\242YiC\212\354\242\303\310-\232\215\237\2651p\027q\273"
+	.ascii	"8R\332\177\027_\352\235JQ\232\326p\024\253\322\203\323U\211\320"
+	.ascii	"A.^\3338\324\253\317\257a36\361\304\311\236\375\nH4\031\3461"
+	.ascii	"m\343\373\027QN\036\261\2023b\340w/\224\365\237\036vk\221\336"
+	.ascii	"!\317\275hgP\204x\340.\370A"
+	.string	"\206\227\035b\324\211\207\356i\026\253Y\200\342\206y\224\220\370\272\357\302\"U\273Tnr"
+	.string	"\214\354\231\300\231\247`\004\301\240,,\252A\215\264\226\344\256[\301E\265ZX\212w\207A4&\026\005\325\227\365/\230\242\266?\224\300F\363\211`\326P\276\376\350qh\244\312]\262\316\203\372\211&\267R\230\021\352Gp\270\2130\037\324#\225bC\347\206\242\256\177\370>\315\207\257\327J\241\265\224'\332\005\201\206\365\253\345\306\206t`\3327\002A\023\241B\237@(qU\375P\034[<^@\363\214\275^\313V\013\f\311\277!\363VN\301\226\334\247\2304\344d\2656{\327\025G\035=\310\304>\264\250Ed\257\243\356\325;B\031B\303\224\\\206\275H\035\250>\244\221\2275\202v\231\276E\255\0331\0365\026\f'\027\272\217T\026\317X\347t&\016\213\251G\365\321\310S1\333\312N\210\226\363k\212\020\362\315F\202L\341\306\205_\256\274\224\363vq\202\022\224\232\375\301"
+	.string	"\2367\305\031\233Y#\n>\205\262\016iV\251\233:\222\027^\361\275R\r\316\373\034\211\022\"\t\003\f\241 \317~(>\023\363y\215"
+	.string	"\247\221l\350\227\332\377\336\204R\302\277%m\217\234\t\006\006\t\341\230\260d!#\273/\316WC\330\2558\241Z\001{\274|\313b\0319\366\005\250\377V8N\307\340X\306];\365\260V{\271]\267\277\n\252\277\377\321\310\362\317\361O\267\341\253\225\2125\360;q\354+\314Q<D\324\263/;\022k3z\230\251\023\t\241\222\312u\371$d\207\336\354\217\321\312\r\2719\265\016\360\345\352\357a\302W<=eh\214CM"
+	.string	"\032\203D\211\363\324\346\013\244+W\276/i\337\005\004\316\263\002X2h^\222c\236r\334\275\215}\263\360\315\327\355\242\260\224\020\326\034\\&\224\034%Y\250(\243l\330\270 \241\373\337\314;@\367\276\321(\016I\244=\246\235w\"\3114\n%\003~\237\0043\334\311\234\006\206:\205\233\266U\020\310<P9P\300\336"
+	.string	"\025[\254\277\300\272\212\354\021\227\021\301j\234W\232e-U\031\377\031\343_\205{\352"
+	.ascii	",\355's?\302H\032qa\264\027\354s\322\016\241\264f\214\362\317"
+	.ascii	"C\275\371\313h\037\370.=\377Vv)\256x\266\004{\n(\024\303\031"
+	.ascii	"\2109\235\271\334\373\360y\200\327\237\223\310\376\250{l\374"
+	.ascii	"V\037?i\330B\023i\2131\333\201\212\261=A\\\225\363V\343\254\n"
+	.ascii	"\"\317\227\317\226\220\270\260[u.\211\003\345V\341\301\332Q\241"
+	.ascii	"\306\366\020\217\026\033\301\na\bj\364\261\036\377'\0133\203"
+	.ascii	"\233\376\210\343\3551\225pFz9\374\210\214\303N8\351 `\331f\360"
+	.ascii	"\n\027\322L\303\331\030\266\013\326Oa\210Y V[\b\362Nx\335V|\t"
+	.ascii	"$\303b\004\376\235\030\006\336\342]\335\306\001s\211\020\310"
+	.ascii	"\301\263t0\324~\032,W\300\032\002\256E\225\377Ew+\313\343GN%"
+	.ascii	"\231\260f\374\335\0329\245!\034\256\001\005\006\322mSd\321\303"
+	.ascii	"I1\024w\030(\351\317\243\302\240\221\203.\241&O\344\204\017K"
+	.ascii	"\304&\025\\n\ryXZ\232\361\301\364\220;\263\214E\313x\237Q\233"
+	.ascii	"h[r\247\371\343\023u\335[ 4t\337\234\367\024g\216!\021aq\235"
+	.ascii	"\323\324!kS\007\016_\036\262\005Cj\300\030*\324\036\301\265\016"
+	.ascii	"\217\\X\204\225\317(\260v\004\260\237e<\221\257\220h-\260\353"
+	.ascii	"/\243\275=\177U\220\220\t\237H\237\230\362\324\357W\230X\302"
+	.ascii	"\377'X\302\001\300\241be\222\216\277\312\024\244\260\3143\276"
+	.ascii	"\212W(\021\\\263m&\334\320\200Hl\200\260\235\215y\034\365\035"
+	.ascii	"R\002'\340h\201\257d\370\264{\317\035\003\262\216\267\263\370"
+	.ascii	"ow\217\027\214\034\"=\244\253\305\306\331pCM!\364\221q\314%W"
+	.ascii	"AO\375\030\202p\214<4OqE'2\0020P{\032\035D\016\275p\301\316\236"
+	.ascii	"\371\273\223V*\032\364Q\320+\312]\245\030:\3706M\017\232M4\211"
+	.ascii	"\003We\336\367<4O\261\323\030\244\310@\035Gk\267\342sQ\373$\307"
+	.ascii	"\224Ue8\301\356t\t\247\025\323\361s\363Z\315--\234\257\374G\356"
+	.ascii	"\217k\244]#d\020\326:D\304\024\234..\201\317\333\b\263\236\341"
+	.ascii	"\205\300d~l\246\225p\034\220\211k\242x\247\341\317\006\304\231"
+	.ascii	"K/\202to\004\307\234\226\233cRg\236\013_\235\200\361\231#\254"
+	.ascii	"\224i\375\261\274\367s\230\025\211\3076i\013m\254yh\244\373\263"
+	.ascii	"VO}\003\262\224\265\220\342\350g\261\033\256\340\021\336\250"
+	.ascii	"\230\337\340\336\375Z\322\224\264\220\331\034\023\236\\\314\316"
+	.ascii	"i\223T \016\240\267\330\243\r\346\\\360\236\244KX\232\007t\234"
+	.ascii	"\017k\210\017M4@\222\356u\251H\347\217\342\305#w\215B\021\360"
+	.ascii	"u\274\302\t\200{\321\261\310_\3232\202<\275\327\2737jbB3\317"
+	.ascii	"\333\323\376xe{\345\241\354Ac\244\346\036\360\355\313\307~K>"
+	.ascii	"\3172OEa\273\023\301|\354\245P\"\262\242\024n?n\230\254@q8QH"
+	.ascii	"B#\336/8\370&\242\275&U\242\340\370\361\374\264\364g\311\002"
+	.ascii	"\277\222\204\003N\224\267\205\276\355\003\177\321\004\362\013"
+	.ascii	"\354\357\375\203-\020)\226e\311\364\361\030\222\313\207\250C"
+	.ascii	"\237S\255XC\215\273\2275\357\345\225\321\212\267O\363\355+w\232"
+	.ascii	"\200@/J\311\332Nc2M \033X\255\212\3744Eh\304\370\375\366l\327"
+	.ascii	"\203)\255\362~\232\256A\205v\327Bag\276\325\2751_.G\004\310\253"
+	.ascii	"\206\261:\254_IyQT\324\361\352?"
+	.text
+	.section	.gnu.lto_mspCommonProcessInCommand.172.bc614976d68a8951,"e",@progbits
+	.string	"(\265/\375`\200\n\2552"
+	.string	"\nU\304\022F`\\R\007\263\340\251\214/\370\365c)\032\271\247\033}6\363\037\372'C\256B4\233n\005\317\275G\323\311\003t\243\364\375\363\rr\270\320\310\321\301\363\353B@]{\207\253\244\235\"gE\250\021\262\367\336;\311\224\002\027\001\004\001\031\001{K\272=J\273\024gk\341\232\f5oU\350z3\353\320-\225A\224\204\346\253`U\035\\\032\002_\333\201\353\253\332\r\325-\354n\025w;\324\241@\271\032\r\240b\226\212\352X"
+	.ascii	"u\373q7\003\007P\356\344\251?\347/<\270\234\241\n\372\200\353"
+	.ascii	"+\232\247A\365\273a**k\001\027\034*)\234\234\363\221\310}X_U"
+	.ascii	"\357a}\375 \355\256B\275W\374z\2218\334\321\021\006\201n\313"
+	.ascii	"\256F\365\361\333\236\364b\213\254\352\203K\343\023\313\"sb\324"
+	.ascii	"]2L\2645\303\225\tv\266\343Qd\256\303\364q&l\221n\016l2s\254"
+	.ascii	"\tv\371`}\204\314\rq1,\346\003\213\334\026"
+	.string	"\231\345\345m\030\254-\341\222\n\263*Q\316y\270\274\241\022a\253\245\024^\213gZnT)4YR\346a\260\312\324W[\323\"\\\336\300j\213ds\365\310\233\232\250\231\266\245\226\177pi\203\353\213-\346\234]\f\013L\305-2\347\334X\271\314\362\346\361n\037\321\335-\272\201I\002\315W\246\246\214\372\315/\360Xj<\201\204]\211\337\331\234\347\316\331e\347Y\234(\211\373\374\277\331Z\332\267Hp3\303\322>\327x\256\001\017Kv\371\231\345\260+\355q\215\247\356\231}y\025\371\023\353+Vf\003n\245\273\361\334\234\223\376\205\347S\300>\266\264%9,\033\360\265\350\211\246\260_\027\275\277\227Y\311\243\362\213\302\177=\304\003\276[I\005ve{\324\275)\007\026\306\247'\365\311n\250\r\374\315n\377\277\277\277\277\376\261\356\306}\344k\336\005\334\211{\221\253\271\017h\334CBB\334A-n\240 \356"
+	.ascii	"-\356\037\027\267O\213\033@\213\273\247\305\315\343\3426\002"
+	.ascii	"q\027]\334D \356\241\213{\007\210[\307\305-lq\007[\334\300\026"
+	.ascii	"\267\353R\357\266\305\315>\356\265\305\255>\356oq\343\307\355"
+	.ascii	"\031>\340E\305H\271\370\336\f4_\375\315\311vk\234\021\227\272"
+	.ascii	"\257y\273\331\362\260\267\305\311\247\364\204\267\355\1778\277"
+	.ascii	"L\372E{\233`W\276MX_[\251r*|\035\"\013\027\260+\205\337\306="
+	.ascii	"{"
+	.string	"\274q\374\344aw`NH\226\240\234\3669p.\200y\005\247\235/\350\002\230J37E\310\274\307\364\322\313a\301W\261_\360\335\315y\342\234\177r.\304\331g\227\304}\300)v\352\3359\301\270\r\374\356#\3273s\313\303\033\222\002\177(\316\311\305\375n\r\236\206\b\225;4Bo\356\013uqja\277\233\203\227yr#\217<\262\007\336F\246\003\353\003e.\372\225\226s\216 \306\307x\350\017!\260\b\326\327 5\312)\373\\q\234svR\237\204\346\234\333\325\301x\253j;\020\333\276\325\027o\377\243\344\005a\277\331\020|\030\335\201X`\333\373\027\027z+\031\254\320\023\333\340\345\371T\216\316m\375f\273\367T\216\356\315\370c\275\376\277\213E\321H\3418\255\376\372\236\300\353F\2709KEh\247s/$T'\342k\2270\301\272\322\327v\023o\204&\256\300\377\013\253\352\314\004\275\302\350\350\344$"
+	.string	"\005\013\\C\t\305\022\207\013\030,419-)\211PR\201\024\303\005\323\f\237\244&\247\007!\302\003\212\027Il'\031\301pzqTJBJ\321\244\024c\211\305q\211\005\322\213cR\223\323\321h\250\231`(5\035c015\035\205\320(W\363\217\365p\207\234*:\356/\353Q\347!\036\375\320[u\367\32072\352m\250\305\tx\300{\216\367\n\273\362\350\261\332\023%vSU\034\313\311\301\342\323#\006-q\331\273\203\f\350\203\200\366\002h\341\346\333c\354\347\003\274S\371\375\260\361\341\302?\336\2620\366\315\347\331.\3175"
+	.string	"\2720\323\013"
+	.string	"\230\036&\346\332\352yv\372\254\343\001\303ZO\004\316\354\300<\336\037@\336f\223\365\225\345y\217\372\317\364I\007\347\215\034>\323\332\236h{Lv\276\351\237sN\352\030\203`\035oY\0165\312\251\361\3338O$\305!X\371:\037`\034\270\352-b\344=;#C\374\"\361\333\351\363,\216\373\335\023L8D\202\247\244\332\267\235\037\356|\333\345\311\245\363\335\257\022\234|\235\r\310\002\200\325\250q8\005\rS\210FDD\222\024\244\225\003\240\002\221\241*\326\001\021 =hjhFZ\230\2449O\r\266\215f\200\252"
+	.ascii	"\022\206\373\024\033\353,\030\302\036j\337}\320\333/\204R5\f"
+	.ascii	"\256JE._a\007\221\341s\263\266\331B\377\016\237 \270&\3323\216"
+	.ascii	"\220\244N\003\234\n\026\202\265\r\243=7y?\273\257_SP\264\376"
+	.ascii	"V(\326\300\202\017\005\304a\034\306Gc\020#\202\330l\236g\261"
+	.ascii	"\"\362$<\337\3647\244s\200yk\221\340\304\372[\245\230\352;"
+	.string	"\305\0262,\310\343\333\276h>\022~-\231\001M\025\n\276Wsd\256E\0236\031\256\272\025\237\345\264\016'\023\344l\256\r\202\362\207\354\240\031e\210\037\304\313\026\300\304\025\200\322\026\030\nu&\273\021Q\304\007\254\242\035= \034\233 \250\230\\\305\023\227\210\222 \251-\317;\363\177*\224\324\270\313\023\177c\036l\034)\207l\201gv\003\374\001\352\036\321\244\031)\234\362tv\371\262\343\244\265\"\321\245\241\273\353/\202\021\233\264\3655\310{{_\253\214\306\275r&s\2365'\n\256\266<N\216O\237\271\t\3049c\025\030\035J[\213W2\302\313e\237\360W\240\356\217\272\375\017\200\276\211\2757\225 ~#\201$5\261\f\310\035\221\240\374\362\365\"\343\017z}\223\360\360\275\334\372\347E\004\357\004\361\314;\264+<\311M\352&\\\200\213\350\377\244\b\003p7h7\034d\377\341\253\234\266\253-o\024\315"
+	.ascii	"\377\310\3344n\260\211\033*"
+	.text
+	.section	.gnu.lto_mspFcProcessCommand.173.bc614976d68a8951,"e",@progbits
+	.string	"(\265/\375`\025\004\225\034"
+	.string	"\326\263\273I\220\\Q:E\023h\003\b\234\025$\302 \0038\363wL\241\257\013\240\264IG\304S'\233\016\373\215 ~\007\377\227B\037f6`\226-\344u7\326\373\204\312\333\365\346\375\203\356\331\335\002\342p}\233\222F\b!d\357$\003\246"
+	.string	"\236"
+	.string	"\256"
+	.ascii	"(\371\244\205\361\002V\025\005lud \226\227\256lH\270\267\373"
+	.ascii	"Ug\222;\320\305\005\344<\245\206J\316@\b\355\203\276l \332\335"
+	.ascii	"\375$W\222\353$\016L;\337\204\237\031\236\02399\347\031\203\363"
+	.ascii	"\230/\311\0230_\342\035O\272\013=\315\222\3047\251\177\3417\364"
+	.ascii	"zB\326\247\273\253A\016(\251\243\251/\352'\361\251\306\216\217"
+	.ascii	"wM\222\007\214\01640_\023\351s\243\213\214\023y\222\272%\023"
+	.ascii	"\371\235\3241\311\343\004\204\205\371\226H\237b\0258\027\376"
+	.ascii	"\366|J\367\236\030r\316}Y\037\324;}w\343\350n\023\335d\032+\024"
+	.ascii	"\220\361\361\262\177d\276L\261\005a\034\2451A\032\273\333v\003"
+	.ascii	"u\027Su\037\267m\3336\236\352\356\221\375\311\037{\326\033\366"
+	.ascii	"\340\373u\253\177\347ZX\277\353[\357\363\274m\272n\227\256\333"
+	.ascii	"$z\033\237\267\177\340\022\3358\305\220\361\343\227\234\235Z"
+	.ascii	":yXZ\t\362\254?\370k\375['\273s\375(\227\362)\027\366N\177\253"
+	.ascii	"\261<C\345\277\020\363KS\3149\227\320Z1(\275\350\360S#DDp\215"
+	.ascii	"eb\376\323\233\337\032\020\022&\344\236e\364\334\224\217~\374"
+	.ascii	"\344\024s\006:x\331?\001\036\356\331~\220h\304D\262Cs\302\271"
+	.ascii	"\221\t"
+	.string	"\303%V\231\2532K\3278\300\2105\305Dzc1e\005n\212_\037B\334\2632|\215\304\250aS\205\341\232\"%\246\352\362\022#\311\356\b\022\367l\211\257\025\223:C&\254;\017c\221\n\211\251\216\267\266D\035\301\230\252\333f\222\370\304\225\231\245kl\0017\206S\214q\267\211\240{\226\304\f\232\260\256a\030c\263G;\206w\344\002\200G\n\243\325\302\2629\206\341\353\205wl\332\267\324\320c$!\035$UY\260\250XQ\340\205\317\036\307\226\375\225\225\207\355Nq+Ch\316\231B\025\026\001\270\232\212q\253\020\246\251+\006\372\360#d\243\231D\032\326\265F\273\251@\270\365\006T\264\332bG,\212jj)d\243a\234z\003\242\251\353\331\264\bE\253mV\243\005\241Pk8\242\241\031\321P\220mFS\327Y\204\004}+\252\2513\334\355\246\316v\200\371d\306S\375%C`\360\204\245\f\347\206"
+	.string	"\341\t\321\036l\364\253\303\023\342\007?q\257\273O|\"\261\315p\207\225\332\304\335\031\036\206esb\023\247gzPx\307\335m\311\234sv-\270\257\r\035\356\331\036\034 \313\214\341\234\"\023\326\275\2324\001\203\"\270/\234\342\356\237L\250a4\204\bD\b\221`\206DHAT\220\007\300\"\231$z\020@\007\211\013\351\305\006\022\206\024\335Z\211Dbcj\310\256JY-2B \361\177\264s\347C\373\236\225\037w\271@\244FxC\340\216\330\333\3209KT\211\336\236,"
+	.string	"\245l$\265\363j<\215\314y\017}>\332'e%\206s:\257\2149;\337\016\367\210X4\036\t"
+	.string	"\221\352{UGP\317V\020\244\026iu\214\205\304\\\220l\033\212&-\304ml\f\306D\202"
+	.ascii	"\275U\b*\300r\245OE\324\227\231\346b!\026\311\376\017"
+	.text
+	.section	.gnu.lto_mspFcProcessReply.174.bc614976d68a8951,"e",@progbits
+	.string	"(\265/\375`x\001=\017"
+	.string	"\326\233eG\360\260(\035\276\267\035\\\332d\352\177v\213\366\222y\3560\320\275!\030\356\231I\240\260:.\372\337\354K\301-\222\211\n\367(\335\355\311\035l:\207\203\007\223'\340V\273\222\353\347p\365\243\231i\351\210\310\222-wJ\001P"
+	.string	"K"
+	.string	"V"
+	.string	"F\300}\363<H\350\033w\002\241o>\331;\2373\033\322\242i\271\351\331]OI\374t\251\361\344G\0309\341\345_\227'b<64\330\312\303U\006\370i\321\351V(I\242\241\007\204\307*\025cG\311\356:\252V\035\356\355\266\035\330&\261\277\023\2532\366\345\356\256\225e\177\336\362\256_5\372"
+	.string	"\242\214\034.\034`\276\301\306\256K\020\216\225m/L|\336~\215\335\375/w\266\247\212\200\215\261\177\341i\271j\2733\3017/\340\036\355\323<\305\351\256\225\017\330e\271\300\331\235\n\002\361*\277\346\0377f\037d)\r\315\315\354\313\356\212\304Y\214,\214@\246\341\270F\250\312\204\204\256\005lh\244\342\217m\322YT\340\256\017b:>\256\257P\001Q\331\246\337X\340v\227\201\n\f\027\016\314(\361\315_\t}\223\332 \226\203\242\301bXb\220=\303\313\"\320\244\031(\224>p\263h\244d\032y\237\310$\002\370\245\240\234x('&#O\004\232\274\021\003&\225>\320K!\221@\257\233{\271\3122\004\0245\237\032\213\242\342\307\302\264Z\324v\256\310_/\t#\220li\215\231\b\217OB\274\312\0226\013\321E\251\366\204Q\037"
+	.ascii	"3\241\371\037#g\2013\230\t~[\031\030\013\232B.\230\004\344\342"
+	.ascii	"<\304N\033q\bV\037K\340\261V\254\200\250\316\246j\214*\267\271"
+	.ascii	"\022\302\363R\214i\342o\216\204\306\240n\274\013\326<\212X\236"
+	.ascii	"\272\"\256e\231\342l\206St\251="
+	.text
+	.section	.gnu.lto_mspInit.175.bc614976d68a8951,"e",@progbits
+	.string	"(\265/\375 \327\375\005"
+	.string	"\302\212)3`\207\324\001\240\260\233\244t"
+	.string	"T\334\005\332\236a\003\243\216\260ut6\346\301\020\261x \262G\236\2355CQ\314!H)2\024\t\001\237\003\370\221\3342\005\237\242L\263&5I\023JmW5\257J\262\346D\265\0315\216e\024\235\033\206\321\t\205\275\f.\306\216h\341\356,\177JE\256w\310\270\021;\346\376\220\223\354\371\367\320\f\376\034Q0\320,\007\241\033\323\300\320\"\342 \340\377B\257\177\302\206"
+	.string	"\315\020(\270\020,t\367\344\317\326\225\365\273\003\253\360>neB\322\335\227\336\227\331\363\376w\374\177\374\257\001\b"
+	.ascii	"3\003v:#,\\\347\032\356\026\302x\031\002\\\272E;\237"
+	.text
+	.section	.gnu.lto_.symbol_nodes.bc614976d68a8951,"e",@progbits
+	.string	"(\265/\375`\362)Ue"
+	.string	"\272\214D\035S\200\2142\352\263\nq0&\303\360\b-+fk\031@\032\343\237\205\364\377\240\253\004-\252\264\254\006\022\n\nD\200\031\363\2441\216\351@\013\331-\"DP\021\340\177"
+	.string	"U\261]\316Ql7\243dv\277\273\234\243\ba+[::\202'\353\374g5\225)\311\317\001\300\001\266\001\333\0235w\007j\256\217\226\271A\236\346\nq\232;\203\204\271\266\021\346\376\370\346\346\364\346\256\3102\327\005\226\271/xsY\354\246\016]\231Jdej\222\246\251JtS\231T\231\n\002\225\251NrS\213\230\246\036M\231\232\364S\237,M\225\202\233\252\2444\025'e\352\024\021\246b\21125\013\224\251\275'SG\baj\221\244\251F\220\246\3728\232\n\304hj\020'S\205\024M\2455\231Z\003a*\017\223\251\266%S\203\224L\365$SeDS9\320P\207\246\372(\022\nG\"\322\0071\311\203\230\273E*.\321F\215\304*.E\246\306\204\246\302\366&\354\361\251\033\354O\211L\355\261C\026H\320\356"
+	.string	"Z\034.?Kc\352\247\266\251\257}`n\013\2151n\b\024\306\270\341\347a\256\216F\250\022K\240\250\220\251\032l\220\225\001bc\370,\214\236\251\256\345Q\037\220MQ[\023\264=\321\301\222\370\261%f\313\262\035\341C\177\034\350\224\002k\023\333\020\266(6P^\017\335\275\364\212K\255h\240M<T\267\243UZJe\207\346Z\231XZ\302jU\350X\234\034\272%\003\225\302@\243\\d\214\312\241\342\320\325\r}\033\272t\201B\325P-4\366f\206\212 C\243\304P(04\204\027\372\344B\235j\024\211\001%\241\205\032\351h\223\034]\342\242,\246\362\330\025zD\205~\220B=@\241B'\224\b\216\0161\241@.%\364\207\204\"a\355q\261\271\001\002\342\202\303s\0351\225\2657\332\201\215\376\320Pg.1\306"
+	.string	"\022\320\233\213\374\375~Os\352\216\210\251\375\022\336\334\204<1\316\030\211ttB\030\206\241\005Swl\214q\200]@1xc\277\260}\375\272vg[\313\372]\375\217\247\244\370\237\330\351\350}\334\343\265\3217\201Rw\215\364V\\\233\370\n(U\3479\246v$\260"
+	.string	"\033&,\342\016\324p\204\007\220\210\004\362@\2513\227\305\036\346j\325\235\034CR\342\221k\213\245\253)\2025\202\200$\252H\005!^c\023\241\327\224\t\034\013(%\350\b\034\202\006\321\003\345\007\367\360\272\241\307\017\0321\013(k\214@Y\343\003eM\327p\207\177\351A\231\321<M\217"
+	.ascii	"\312\"Q\2124d\360#Pf`\022@\211\341\227@\211\301/0\370\025|\246"
+	.ascii	"e\330\235@\031\3231\214\004J\030\177\002%Lk\fO\020\234\250\005"
+	.ascii	"\224\b<\214\344\020\247\300H\3055\216\375\307\346\323\3235\247"
+	.ascii	"\375\354g,\343\217y\f\206\324/~\327\216\177\213\233\305+\026"
+	.ascii	"\321\024|\b\017\301I+#p\b\032\304\253&\215p\022\213!\254\374"
+	.ascii	"\340\036\236\254\364\340\016\270\003\r4P\323\341;lp)+7\360+\255"
+	.ascii	"\244i\032\326\360F+3\264\306\246)%\2220\364\205\206\262\362\002"
+	.ascii	"[p\334J\013\rv\224\225`\005\026a\245\314\313\364\3070\314#\255"
+	.ascii	"\204q\030\376\027^Z\251\336\031\240t\034\305\243\225\332FF*\027"
+	.ascii	"@@\245\362\002\b\030E\311!\036EYc.\020\215\2715f\314\275@\306"
+	.ascii	"\\\0331\346\336\2001\027\203\027ss\270\230\253\243\305\334\225"
+	.ascii	"\316\\V\316\334f1\267\265b.\017\025s5H1\327\205b\356\353\304"
+	.ascii	"\334\0368s301w\203\022sc$\346r\300sa#\346\372\270\231+\263\231"
+	.ascii	";\333p\356\217\337\\\332\324\334\016J\230[\3332\227Gj\006\257"
+	.ascii	"7\342MJ\300\036\001\253DRe\025\241^q\304\233\004\321\352b#\366"
+	.ascii	"\373\340\037\330E\274I\007\272\001\177\215:'Ma\rG(\357\320\033"
+	.ascii	"\236\346iXC+\f\211\034\230b\020o\005Daab\2415\2147\345yqC3\210"
+	.ascii	"79\304\210\221\346\360\236\221q\235\020{$\325\021o\322\005nJ"
+	.ascii	"W\361\026S\344*\212P\361&9\304-\361&/\374\205\266\300\257R\251"
+	.ascii	"'$K4\352\n|\344QQ\210f\305\020\235(\025\205*\350\350n\3044\314"
+	.ascii	"\303\360\213\277p\tQ\b\200\251\035\037\021*\n\311\005\224FG\223"
+	.ascii	"Z\334\022\205\244L\313\360#\305 \031\343\017\323A\362\345\203"
+	.ascii	"\240b\220\234\351q\244\2571\255g\3762V\311\003K\2121\314\235"
+	.ascii	"\t\2243\257v\361N\317\264|\206\3453+\377\371\257\247\244\220"
+	.ascii	":\212\377\311\311\347\275\3561\217\327\273nr]\356\231x\t\327"
+	.ascii	"?mk\037\377\036\2565\315\177\306\262\030\303\330\365.\336\351"
+	.ascii	"\226S`\371SX\361\357FA\251\232\362?\352\034(UR|\344T@\251\212"
+	.ascii	"j\177b\247!\240"
+	.string	"T\371\270\327<\377\0357\265\n\300$\204\245\343*\3369f\352%\034\356\347\225@\251\372q\233\253l\254\252\271\212\246\232\265\314c\037cX\277\\\376;\254j\251X\252U\377\374\350\247X\252\243\374\237\330\251}\335s\236\357\\\307\271f\362_b\034\377\330|\270\247e\315\237\306r\3262\217\301^\256\226;\314\362\227+\236j)\217zr\362\365x\275\363ob]\347\\\365F\024\326\362K\214\353\037\267\275\352\022\234$S\242\016\224k\353\036\332L\366\032\251\004\221\203N`E%\362\205\3375\214IbN\211-\211\204\301\251*(H)\016E\"\t3D_xn\254\304 \234\022 \2057\213B\221H\276\254TyDaQ\002F\"\2518\225\221H\322\340n\257\2013\270\206\032b`\277\320\026\034\374\001\212\\N4\214Cr\346]\246?\246#\220\206a8$9\fM\341\036\307\277x\373\247\340C{\233xs7"
+	.string	"G\304\247!\254\365\346\365z"
+	.ascii	"\215\036J\021\252\237\325\024XLa\345S\255\261\350\325;\242zR"
+	.ascii	"9\371|\275\036\363x\274\353\246&\235\262.\367\252%\\\377\330"
+	.ascii	"l\355\363>=5U\215\3663\226\365\217pU\254I\300^\267v\243EK\304"
+	.ascii	"\233\tou\370\254V\255~<\345\341K\261r\224\023\343\370\211x\303"
+	.ascii	"\361\261\252\022\313\212\242\350\261\272\270\212^\232\202\327"
+	.ascii	"\273\337\271*\020("
+	.string	"2U\321\304\272't;4\364-:v\231[\301\3049\266\327q\026>\335\242\366\262F\243\365\314_\306\037\203\361\353\375[\355\315\342\320_\304\233\302\370\375\257#\324\024KE\371?\261\223k\350\304>\357\365x\3671\342\255I\367:\201\3662\222s&\366%\034\377\264M\206\217\367p\315\237\326\263\326\031/\343X?\214\375\305\353\332q\345oq\204b\365\256\\\365\t\016\0224\374I\275F)[r\210(\r\257\021\305\032\235\264\376\312\223\023\373\272\347\317c\337\361\005\361\246\353\334\347\230\311\227~\251uaT\301\022\241\\\303\237\266\271O\355\265\002\223\234-*\213\261\215\327\177\213u\345\252F-\237\311\"\276\202~\nz\213\330\310\021\202'\350\203\313\250\222\361\204\255\321\314H\222\244\324\001\342\f\b\224\016\262*\235\003\022\300\362L\307\221L\017\211D\022\212H\017'\333z#8P\t:\026\220\347\341w\246M\202N@"
+	.string	"\247F\224\246\366\304+\251d3\232T\266\272\331\025\303\261M\373\320\037\261z\362"
+	.ascii	"\265\021\226t\322\210zs\210\343\254D\260\207\256\246K\003\376"
+	.ascii	"\204\200xVF\324\336\331\363\256\335\224"
+	.string	"\\;\013\026\254m)\271\331r=hC T\240\243\216\226=\244\237=\201\273<\241\264\3309p\260%\316nR\035\007\2072)\204\210nm`\350V\233B\367\006:\260\320W\036\257\311\315\300\370\357\030\343n\305\207\375@~\2432\375\364c\216\240=TU(\2211\227\353\373-d\343\n\220G\362\373\333\002\263!0b\357\312\rp\033F\371]\304\2427\017Du\363\n\3160\b}\333\026zv\224\337\275\345\001\325\036M\211\tHE\345\034\036V\300\341\024\310b"
+	.string	"\024V\026\025\204 \260M\375(\316\202`I\263\355\2161\303\223kY\364K\337\257\337\033\246\207\256\305<M\007\301\222\232|\033B\241\270\260\365\361\360"
+	.string	"&P\277\200w\224\330\030\300\273,\234\213\0161+\337z\201\3307T\257jP\344\263\240J\306\033\031|\373\261\336\342\336\031\371.\027\213\002\201t\362$\bb'\366\200\376\b\007\024\245P\313\031\234\313\003W{\236\342\360\262"
+	.ascii	"\302-\321\212\002>'@\tVcX\361C9\210_.Y\n\333\224tm\007\245\305"
+	.ascii	"\037\020\321\307\251\343;\001Af2\"p\020\274\200p\360\303\306"
+	.ascii	"@\267ra\256\270B\252\215\262\260n\2312\300\360\206\351Jb\357"
+	.ascii	"Tu\226DE\376\306\027\030\230\341\251\273\374\204_\003\016\025"
+	.ascii	"\302\002\201I\212\222\217\033\227\020\222y,\t\022;\3433'\301"
+	.ascii	"9F\350QZ@\350\2203o\345\001\204;}\231=LR)\242\372w(\354\335\301"
+	.ascii	"\217?\274\233s\257\336\003U\251I\236\225\227\340\342VY*\357\207"
+	.ascii	"\315\244\321\r\233\200\243\"\tKn\342\212\223\257M)_4\004\016"
+	.ascii	"\234V,y\357\226\3326\232\253CA\2353&\275L\207~\002\020\016\237"
+	.ascii	"\321>\223\217\354\370O\035\373\034X\244v\255W\331ZU\232\204\002"
+	.ascii	"\213\213\354\343'\004\230\212R\004\330\276\373\376o\323\017\225"
+	.ascii	"}`,\207\271\350\004\307\214\"?\373v\217\351\377\303%\347C|\215"
+	.ascii	"\370H\360\001\241\025\352;wM\345\230Z\207\247\272\353\n@\"!\306"
+	.ascii	"\366\355srK\362\343\354s?\360f|*\026Pl\317\221\305S\344\234\360"
+	.ascii	"\020^\323\f\332\210\223K\327\360\340\036\346\350\344\343\033"
+	.ascii	"\361.%W\250G\362\006\274\205\031\353\236\327\022\fe\"\023=\277"
+	.ascii	"\022S=\335\375@\035\310;t0\370\371\241&\245VN\364\3479n\377\016"
+	.ascii	"\272[p\330>\316w\347\323\250\222\016\341h\227+p\b\311\240\366"
+	.ascii	"E\244\330\375\261\236j\355\326\342\347\257o\313\270\022\200\200"
+	.ascii	"\242\020\236x\311b\253\273\276Y\177?\317\2352d\021\023\262U\310"
+	.ascii	"\3713D\006X\013C\261\\\351\352E{\270\317\277{]2\035~\234q\036"
+	.ascii	"\276\356\226]^\274\300\370'}\306\340\034t\317\276\2072TJ\027"
+	.ascii	"H\260'\244Y\323}\024o\362a\212\317w\366\006\251n\261\206\n\251"
+	.ascii	"v\316\363\256\335qJOh\020\233\367\233\211F\01322\001C\036\255"
+	.ascii	"&N\020\260\023C6\274\365\207'\017L\023\374$\346\334\261\216\311"
+	.ascii	"\336\001\307\f\001A6\301\226\255\211n\256\274C\324\271\211\367"
+	.ascii	"G\035\302\016\253Q\336\177\\tm\007\3640\371:\377\242\371%\213"
+	.ascii	"\370|\211G\\\177\263\227`\220\263Vw\277\226(v>\320\033\004\372"
+	.ascii	"\227-\375)\214\355\2148\0233\002\244\235"
+	.string	"\367\035:qs\272\r\005\224d/\316Yn\210\233\217/\276\224O\314\007`\276t\257\371\230&\232g_+\364$\335\352\265z\335\321s\360\375T\266\262L\326\377b\277+\377vW9\206\231\313\375\257?\2221\327Q\303\031\034\353tJ:\351}\330\037QD<\213\246\210\302\321w\233\375\035Y\2213\305\340\035h\236S\304\326\250\177^>\231\362\344\234\237\250\321\266\255\276Z\353\360`\031\370\336\330\253\024\376k\323\256\206\345F\311j0\207\217\257\262$}W0+\370:r\260\371u\210a\3220\326}\257H\317\nz:\320\226+\316C{5\036aK\025\347\241\375\232O\230\345\312s\350\356\223\326\261A\332,\276\306\357T\334\006o\212_\342v*n\2027\305\257\361\035\225\267\301\315b\227\370\216\212\333\340f\361+ng\345-x\243\330\025\267\343\225\201\037)\352\202\265\270\030\r\302\3206\247T#\363\273\344\256\2328"
+	.ascii	"\277\212\346\321\277\321\245S\354@\021!\307/\260\253\217\223"
+	.ascii	"\234\307O\030\r\347>\270\275Q\240yGE\300G\243\370\306K\202\025"
+	.ascii	"\322\274\212[\013\210\271D\355\030\342\255\002\315\013\310\260"
+	.ascii	"?,rnc\375\025\302\270\255E\201\267w\0359\226\007/s\271\341\326"
+	.ascii	"\252\335\243F\256\307<K;7Z\270\267\200\316^\305\3078_\345\221"
+	.ascii	"\334R*P\314A\207]\360\204\034Fm\005"
+	.text
+	.section	.gnu.lto_.refs.bc614976d68a8951,"e",@progbits
+	.string	"(\265/\375`\222\006\265\036"
+	.string	"\326}\312I\220VN\032\003\301\n\2412G\017\b\305\027\3652:\377Q\251n\2578\316>t\251\335\017\376(\335\347\016\326\260\022\211"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\250\212\303\321\352\033=\2503\373\303\204\3537\267\217\035\306F\b\3312\005\256"
+	.string	"\275"
+	.string	"\266"
+	.string	"\203\306\257M\376\370\360\222\034\271\371\032\367\366\303\007\233\232\315W\263\245\030\230\203\257]\r\352\265J\352\251\370\325I\005\222\221\220\022\250\346k\bA\300\276\232\337<\006\277J\026\374\326\315\311\021\177\327\322\316\024\374.\023\374\332@\360+\343\300\257\324\223\023S\322\021\315o\021\r\211\231\337\037)\202\2003\377\237\201\372x22\365\233\005~\266\230?-\346u\b\f\263Vo\215\031\\ZXV\303\337)\027/\277MJ.\277B'J\264\374\212`\371\357\006\374J\004\374p\001\3767"
+	.ascii	"\177\216\341\347\254\374\001\225\272\214\360c\322\207A\237\345"
+	.ascii	"\254\225\346U\210\002A\034^\250D\276p\304\224'\201L\226\330\321"
+	.ascii	"\t\t\342\326C\215y\266\304Q\374\324\306W\327V\326\213*\343\247"
+	.ascii	"S\033>\205bq\374\224\t\371i\222\317\247)\210\202\224\032>\005"
+	.ascii	"\352\371\364g\260\347Q'{<\217\316\311\r\201\003\322\306\226\341"
+	.ascii	"\3214\2642\342\2439\302v\036\005K\326Q/\256\004\217ZQax4\352"
+	.ascii	"\211E\323\022\322\205G\215\206\202\224\311GEL\211\"\030\350\307"
+	.ascii	"\227wg\227\374\223\316\310\316\237qA\220\177\266\255\351\374"
+	.ascii	"\271\303\302\237:*\374iF\341\317\345\204?o\344\374YC\302\237"
+	.ascii	"^\021\376\344\322\302\262\242\212\202\360g\013\234?\233\224\216"
+	.ascii	"\210\036\374\251<\376\td\374\363'\312b\024\301&}zyK\352\346\232"
+	.ascii	"E\214{\205s\353\261\3064\356\025m\303^\315\226\307\275\212!\367"
+	.ascii	"\032\346\263\327\257\0312\266\2644\354\025\353\252\252g\257R"
+	.ascii	"P-\234\232\226\222h\366Z4\204\302\004\320\314^\177f\366\365{"
+	.ascii	"\307\276{\307}\357\354\2164\037\354K$\016\316\270o\333\032\263"
+	.ascii	"L,\354+\253\312\305\n\245\024(L\334\354\013t\263?8\363w\022\370"
+	.ascii	"\307\204O\317f\037I\035]S\316\301~\233\032\363\254\370\2331\330"
+	.ascii	"\037[\260\373 w\036\344n<m\0170\363\017{u\313h\365\225\317\252"
+	.ascii	"\207\272\313e\257\"\234\354\321\227\177\276\274C\272\360\350"
+	.ascii	"\261\027\022\035_\030\237a\270'\207\273\316p\2570\334'\fw\t\303"
+	.ascii	"\335\370\262\333\274\3545.;\321e\217i\331aZv\227\226}\205e\020"
+	.ascii	",\2470d\366\364J\246\236\026\t\235 \356i\211\344\236\376<q\002"
+	.ascii	"\230\207aG\355\352\350\232rD.\354\250\020 n>\326t\234-\307\302"
+	.ascii	"\300hxu%wt\013kgG\255\250\210;\032E\334\025\223\325\321\246\325"
+	.ascii	"v\224iIi\262\035E\272lG\217pv\324\b\347Q\242\241\227;\032\"g"
+	.ascii	"?\007\245@\021\f\364\203\260\237}{zx\315\267\037<x\366\263l&"
+	.ascii	"\316~\216\341\320\230y\3068\356g\026\207\375\304B\356g\325\024"
+	.ascii	"\224\323\022R1\250\370g\200\353\250!\240\"\221\022I#\245\005"
+	.ascii	"\311rPSM\222\016\020\370\254\001\b\030\ny\034\246\336U\213K\""
+	.ascii	"\206O$UZ'\251\304R\004\021\214\264\\\2046\30440\002\220\344\373"
+	.ascii	"\025\200\307\321\277\0045/0\0327\200\021\365\027\202\034\252"
+	.ascii	"\034T\016Z\016\235\250\312\004%\306H\202\342\227\301P\366\273"
+	.ascii	"\231\274\211\266\337yk\315\263Y\350\313\227\273V`O`\004\301\004"
+	.ascii	"\340\002`A\300\312\207\006Gb\016A\247\"\257\373\022\235\021\361"
+	.ascii	"\375<\334\r\0161d\230\231\323\264z\021/y\366=\361\371\316f\210"
+	.ascii	"Q\037_\002\326O~\f\327\301\003\304*"
+	.text
+	.section	.gnu.lto_.decls.bc614976d68a8951,"e",@progbits
+	.string	"(\265/\375`e\366\225\335\003\036\024\006\225\025T\020(e%5\006\201\357\346c\310as\217\035\354\367\303120\027\373\301\032\365\204Q"
+	.string	"\031\266\371\231\035\364@\314\374Z\372q\215\241\211\f\021.\246\267\335\002"
+	.string	"$^Ew\320l_\215\002\t2|=B,\216\240(\212b\221sk\315\310\326\344\336[n\271S\276\022\312\025\225\026o@ENY\237\230c\217 V9\264\337S9\264'&\355\223\251\032\332\253i$m\004\226d\314F\326\332H\327\3206\206>R\236\244\261;R\245\332H\027]\345"
+	.string	"\224j\215\241\322\372C2\373\327D\3276~=C\323\030\2661a\022\227\265\312\006\342\232\350ge\252e\224\365\207`\266:\244jho\364\220\032]"
+	.ascii	"\223\035c\262\376\265\f\035\304\265\005\n\225\254\257\326\351"
+	.ascii	" \355\363\261\241/\216\325\254@u\220\376\021Sv\207\004O\307\320"
+	.ascii	"B\252T\007i \315A\350\004I\215L\253?\204\262?\334\332\037V\355"
+	.ascii	"_\307m\202S\034Rld\275\266\311[\3264?]\240q\034\247\265\311k"
+	.ascii	"yLm\003+\261\025f\272\256Y\331\254z\353\236*]\333\254x_\325\254"
+	.ascii	"y9\355k\233\254\226\265\f\203\242\261"
+	.string	"O[\006\251\256\351lm\223\321\212\364\250k\302\213\343h\n1\300|\375\364\216\252\032ZuH\315\320^\270\267\357\202K\334x\244\311\372\302\273\r&\207\311wj\033\330\22392\274\26565\032B\023\23792\274u\t\223U\013\205\030G\276\"(V\3534\257Y\207\240\020\343\250\001SM\246\031\314:\315i2\236\332V\025\307H%\\\035\231#\033\263\332\255f\3262\353\334\212f\245[\345\326\272U\314zf%\243J\327\351Z\3449-\263\235\303\233\033\335\034\031^\227u\232\275\344\270$\022\256\312\346\310B\230\260N\363\233*\247\2661\305>t\036\\\271MW\2565\356\002\240\2418N*aIY\346\362\347.+\2305\214\332\306\024\377\370\224\320\004)\006\263N\263\232\254\2347]\211\254J\246B\270\362\231#\303\213\343h\207U\214M\017&\025\3505\214\352\266\201x\303\215\226#\036Y_8e\257_( \372"
+	.string	"\362\363%\353\013\233\354\256\325k\215BY"
+	.string	"*r[\341\3267U\272z\tZ\275\254P\3264\024b\034="
+	.ascii	"\310\306\324\313\332v\266\013\200\206\342\237\036$\034Q#\347"
+	.ascii	"\204\247\243Te\341\261\365\203z\373\352\332\030\005j[\225\nH"
+	.ascii	"\304\340\2604\231\252li\353\327j\345\002\240!\027\324\250L\313"
+	.ascii	"~\006f\2265\255\273\022\202\332\006V\202lk\032\307\321\264\365"
+	.ascii	"\354g\303\240b\034d\004k\272\246\255d\024\264A\202\3041\301\333"
+	.ascii	"\262vY\325V\266U\313\272\266rY\263\250\3225mE\343\300F\221\342"
+	.ascii	"\255\301\321\0176\331\017\"\331\017\n\331\017J\355\007u\354\007"
+	.ascii	"\223\366\2034\366\203q\025*>f\336\214\262>\320L\330*\246JW*k"
+	.ascii	"\024\351\n\346\243\f\224\312:e\005S\333\230\242q\022N\0311ZZ"
+	.ascii	"\360V+c\354\244\255>\320\310\376W0)@='OzR"
+	.string	"\326(C.+\"\037Y\037\270\264\0174\332\007\016\355\003}\366\277>\371\352\365\257[\253\0235\272\001v\312\2145\031Y\257Q\020_\237\bU\021%e\r\202\232\241\375/o\377\207f\347\250\252\241\r\241\311\232\205\265\213|q\302\322\326\004\313\013X\034&\353\025\253\225\363A\313\373e\331\033\250\031\3325\311\0216KeVY\377\367\265\257JW$\353\221*JfP\311z=\242\312\005\363\330\270(e}4\253\325\177\3370\216k\314,\353\177\26522\264\361\026K\031Y\213\370\356\302\264\321\312\372?\255\375\237\022!\034\362\030'9\242d\375_\025\220\265J\225\256AV\037\016\321 \271\315\032\253m`%\270\246\004Y\177\326\037j\033S1\016\232\223\233\252Q\320\364\352Z\275\264Je\201\372X\247V*U\272\376\370\372c\005Z\211\206>7qL%\006\372c\265\261*\251m`\f`\262e\032\307q\007\n:t"
+	.string	"\022\375x\362\331:j\355\241JW\251\225G\323\nu\001\320\020\003\354\250H\2559V\035\027"
+	.string	"\r1"
+	.string	"\213\332t\233\t\301\022\244\325\3779\355\177\205Z\237f\214%\001\263cu\372\341`j\303\222\365\177G{\307\325\242#BkY\377'c_\225\276\314\312\364\271!lKN\262\376\357g\337\267f\337\227f_\304\252\264\026\255Hj\033X\t.k\323\365\306\212C\225\256Jk\322\252\264\006ia\233\016\255\222h9i\365}c\266\276\n\222\262%\353\365h5\212\205\302\271\2473%Y\337\347\266\357\323\262\357C\333\377W\032k\rU\272\022\2553\256\262e6\347\020\215c*+\321*\264\016]"
+	.string	"4d\002\252\313tk%Z\203T7`\021\237!x\256\217+]BZ}\337\220\375\257C\253\214U\307P\0256Q6\215\t\256\310\032c\365\001\312\321\210\347\262\276\317\307\276\317i\337wc\337Gc\177\353m\275\274'E\212\013\313No\223\331\352\016\263IP3\264\337nxW\323T7\t\313\223+Y\177k\331h8\020o<I\031\312\372[\272/BL&\263>9\332a@\252\352\262\235*\315gr\031\2703y.\323\335\360"
+	.ascii	"\r\222\324\2350\fo\315R\253\315\344)\261F\021\031C\262\376\226"
+	.ascii	"a\206\315\276\013f\313\34519I*dM\016\313\276\373d\237L\315\320"
+	.ascii	"\346/\252\227\273\274\031Y\337E\222\341\334 \373.\217}7i\337"
+	.ascii	"\025\332oS3\264(\250\032\332\273>\333\215U\r\355\3332\373\317"
+	.ascii	"Y\236\265<\250\013\035\024^\326\352\031\210\347,+\031Z\f6Y\277"
+	.ascii	"\215\333\237\252\031\332\267T\266\032g,f:\314\254\n\332\025U"
+	.ascii	"\232\315r\331u46\313T2\231\332\006\026\377\374\330`I\364\f\026"
+	.ascii	"<\242\231\034@\224\264~\373cg\262<\226\263\r*0CY\207\220\255"
+	.ascii	"D\211\276\2703O`Y\277u\332!@<Wi\261\260\364P\223\365\333\034"
+	.ascii	"\373\317bi\302\3245,\024-Y?S\300\204e\256\276PI\311QTi\006\313"
+	.ascii	"R.\225n\215\222m\031P\254\246`\271\313\b\324\335C\"\344\245\325"
+	.ascii	"g\363\276\240\374\240\361X\233W~\242J3\224\034\315\3218\376\342"
+	.ascii	"R\323\206?\3058\b\310\b\032\3071\224\334\245\246\201h\213\343"
+	.ascii	"\202\025\3071\207\016\035.\260FFM\253\317\272\355\263k\373,\026"
+	.ascii	"'[\254\320V]\230\254\265\242Aq\034s\360\325XZ\323&\353\263Z\373"
+	.ascii	"&$\341\001U\242\272\r}\2121\220\027(h\034G\257rVn\242J3V^r\225"
+	.ascii	"L\215\273\212\225\231\250n&\304oIXq\034\355\320\201C\207\345"
+	.ascii	"\227\221\036[\237\245\332gm\354\263@\373\032\315\3763\222#\272"
+	.ascii	"\310\254\313,C\237\217\250n\033\330@<\213\353\326\262\006\001"
+	.ascii	"\342\031\252v\255y\222f5\304\027m;2\312\372\"\252\304\266\244"
+	.ascii	"2\325\320\027\307RU\240pC2\220L\345\006\211\306q\301\213\343"
+	.ascii	"\370\177.\222\211d#\2524\017\311A\236\205\250u\035:t\340\240"
+	.ascii	"\241\246V3\266\016\252\031\332k\260}\335\265\257\241;Oe\037\252"
+	.ascii	"\364g\371\207/(\032\177\005I\363\t\222\365u\325~\021\307q\254"
+	.ascii	"\376\254u\177\326^\363\350\0215|\222\312=\311O\231G\206R\245"
+	.ascii	"9*\357xvR\327\236U4\035*\335\220\215\343\2501hTnR\351\206?\321"
+	.ascii	"\370\310\235\322\366\226\204\027\225\231\332!\361[\022^\034G"
+	.ascii	"9"
+	.string	"t\350\320a\315!\345\f\272u[\267\277\212\331_\271\354\257U\366\237s\344\245\\V$U\367\274\344\266\201\243\r;\n\216\244080\210.\331\360\221\365\237\225rR\210\"\031uY\337\004\037\325Mmc:@\026\327\237k\344\241<#\027e\242\214\224id\031\331(\307\3106\362\215|\244JsR\006z\016\312B\327\3218\016\212\343\370\"r\222ZF\245S\333\252T\330\262\"\342\007\221\177\234@\341T\275);\270\360T6\025\214*\027B\013\210\034\253n\005\350B#\243\312\205\310\262\203\013om\013\227:;U\3150(\032#\301Uvp\341\301}Q\335\206k\034C\255A\337~\225\315\213\3526\364\211\306F\005`\333\301\205\267\365\203\310Ij\236\332Fm\003+a\0276\215\343\350\325\270\037\304\037\302\204\234\244\356\251n\027"
+	.ascii	"\3051\324\023N\f3k9\360\3428\332\201C\007\337\f(=\350\005Z\215"
+	.ascii	"\252\032Z\016j\206\366\353\215\3755\336\317e\3663\332~\336\332"
+	.ascii	"\317F\326\250l\204m9\304\204e\375\254cM\216\241\342\2516\354"
+	.ascii	"~0\311\372*\335V\321\250w\252TM\363\253gT\270k\257\250\370+\216"
+	.ascii	"\243\302\365gi\313X\326WCh\211{{{{j\b\355U.[\253\031\332\267"
+	.ascii	"\251\032ZuN5\243JAP\247Qb\036\322f\n\224\254\257\236\355\253"
+	.ascii	" \264\353\336\236\nB{U\272\257^mU.\253b\3241W\345\3240\017a\302"
+	.ascii	"\203A\252\234\216\343\037U\345`\250\252\034\260gE~\240\264\372"
+	.ascii	"\352\221}\325isP5\264\037\301\336@\325\320\236g\207\240jhU.j"
+	.ascii	"\027U\212\201\332\026%\n\365\232\350\255\311\372:\373*\006\255"
+	.ascii	"\272\247b\320\036\206]T3\264$\250\032\332_\325\002B\220\231\330"
+	.ascii	"V\026\265\026LL\\eW\325\32445*\3360\274!\305j\312Z\275\242\232"
+	.ascii	"\251R\nT,W\317T\264\263?\3218\032\3071Q\255\253\002B\312\272"
+	.ascii	"\250jh\263\232\241\275\013[\004q\254R\320\252{{*\005\255J\006"
+	.ascii	"\342jY\206\366\210)\032\203\305qL<\300\020\037YY\257j\206\366"
+	.ascii	"W\307(\270*\343Ae\245\n\025\325\024\260\254U*\273\250M\214\264"
+	.ascii	"\254\217\302\276*U\305\302N@\221\235\231r5\354s\301\370\002-"
+	.ascii	"Fh\306\215\254\217F\005\373\357\373\305\311\255i\003\223\342"
+	.ascii	"\n\345i\371\312\372\277*U"
+	.string	"\245\250Q\2421\207 \324\217&0Y_\204}\365\3538^\261\tw\367\257B\361R\303@\237\330\262\376U\257_\325R\267\324'\353\020QT\f\026\307\321\033\242\226\022\025\221\350V\034\307D_\331\232%8\262V\271\324\256\253Q\325\311C\230\360\325\307+\336\212\343X\215\226\020\025\307?j\224\310&\216\177\210\252\312\201\252r\240\263\246\254\302Z\375\274\037U5\264[\315\320\356\353_\b\204=q\342/\354\361\263\r\360j\247|&\374-\324W\302\337\372|\"~\326\027\342gM\260-\374,\211\213\341\260\232`O\264T4\370\205:\376v\211\017\304\361\316\346W\213\237\036m5\341#\341\317\033\274\f\360\013\205~7\272\333\310~_\207?\007}\002\320\314_{\340w\323|!\374\372\204_\213\300\226\260\346\003\341w\337~\027\314\357\206\371}\001\370\333.\337\007?\353\345\216q\311\374>\017Z\026v\277K\347\336\375>"
+	.string	"\374n\336\357\256\371}\035\374z\206\333\306\307\301\277\363f}\033\354-\301\236`\225\241\276\333\202\215A\006@\027\237\006y\203\033B\003[\273\203\177\003\340\367e\260j\255]+\2245\312\376\240\275B\202\035\300\256\300\207\301Z\302\277\216XSX_\330\003\360]\360o\242\317\202\265n]\263A\354\020\277\257\2026\313\225\372(\370\367\t\377&\300\357\343\360o\003\374\373"
+	.string	"\277o\203\333\345\233\200=\300\273.\346\033|\0322\026\016\276\033\326\204\335\001\037\361\367\371~\337\312~\360\3576\377N\363o\272\177\217\371\325\017\230\2509~\341\216\013\307J\360\267T?\253\341 \250\037\264>\204&~\026"
+	.string	"?\333\301\317b\360\267{\027\374,\207\037\377\026\263\303\374\256\221\177\203\331q\256\326\376\362\273O\033\356w\221\374n\222\177{\371W\023\354\221\267\177\273Y\375\027\341\027\"\177\226\370\263\301\237-\376,\316\317\016\177\366\346g\205\277\313\200\237\205\300n\373[\250\277\345\361\357.\377\n\375u\336\3376m.\277\336\377\232\301\277\002\340_\203\377\212\363\257\303\177\365\340_7\374+\361_C\370u\331\257\327\376\365\202\177\245\340\327Q~=\345_1\370W\013~\235\345_\201~]\345_\215\3765\376\327\237\177\025\372W\242\177o\371u\230\277]\332l\277\016\373W!\277f\177\215\345\337k\177\233\364\2677\376\255\345\3279~\355\343\327?~=\365\267E;\313\257\231~\215\343\327M\177Kc\253\351\031\277\353"
+	.string	"]\343oc\374\255\214\177\247\375\254\332F\373u\317\257[\374\372\371k\347\257\341\337E\261\317~\355\342\337X\376}\345\327?\3776\373\333\237]\266\3114\210_k\340\327\031\370Y\021\177+\202=\246\342\327\021\370u\212_S\340\327\023\370\265\004\376\366\003\177\013\202\177[\371\365\001~\275\200_\267\360k\024~\315\302\257K\374\232"
+	.ascii	"\277V\300\257\021\360\353\024~=\342\327\f\370\265\t\277&\341"
+	.ascii	"g\2474\361\337U~=\374[\027\233\312\277\316\375\353\364_\357\376"
+	.ascii	"-\366k\337\277\303\376\366\271\247\254c\376\226\003\377Jf\203"
+	.ascii	"\255`\376\365\355_\267\374\253\226\177][\335\376"
+	.string	"\265\313\277\302\375\255qK\371[\f\374\354\001\376U\354\337Q\376\025\354\337\322\177\235\362\357\257\177\245\362o(\177[\201\355\365\257J\3766\002\373\311\277\026\375k\215\177=\372[\b\374m\212\177G\3775\347_cXu\376\225\305\277r\340_\227?+\302\337\236\330]\024\370\327\t\374+\006\376\365\002\377j\201\237\025\300\3372`s\201\370W\022\376U\001\377v\362\257#\376\365\304\277B\340wa\330[\377J\342\337Z?\013\302\337\256\360\267$\376\235\365\257,\354&\377\272\376+\373\257\371_\335\177\275\371\327\375\257 \374\355\tV\376<\345\317e\177\016\373\363\330\237\253\374\231\354\317O\376l\366\267%d\375-\210\215\365g\251\277\035a_\375y\307\237\233\376\354\364o&\177+\200\277\355\360\357%\025\270@.\372\363\321\237m\374Y\351\317F\177\373\301V\362g\031\177\313\301N\2227\360\267\031\270\032\330H\376|\201\277\275"
+	.string	"\002\177\236\300\357&\367\221?\233\360\347\020\177\026\361\347\022\376\374\341\317\036\376\f\342\303\337R\260\241"
+	.string	"\370s\006\177\326\340\337V\177\366\340\317\034\374\271\203\021\376v\202\277\335\360o#l\220]\344\177\364\317\304\237%\362\273-\376Md\017\371\263\376\333\f[\310\357\376\354 \377\256\332@~u\315\257V\340W\305\374\252\336\257\336\375-qS\375\355\236\320\376\361\273Cm\360\317I\032\b\260\361\253/l\037\356\215\237M\262\247~W\307\277\245v\217\237U\177\025\371\257M\376\325\311\257\221\377\372\344_\231\374+\001\376\265\003\0056\374\357\372o\201\013\374\177\341\177"
+	.ascii	"6\324\277\237\376\275\364o\243\177\017\375k\n\237\177{\340\337"
+	.ascii	"\317\177w\340\337M\026\305\277\231\355O]\362\0075\374\252\357"
+	.ascii	"\337\313_m\377\035\303\257\006\177\225\370\2538\277\312\302\257"
+	.ascii	".\340g\3116\007~u\304\257\252\320\256\377V\376\352\t\277\232"
+	.ascii	"\302\257\242\320~\353\260mv\316\257\216\360"
+	.string	"\253\003p5\374\233\305~U\f\\\016\376\235\334\310\237\275\333+X\273\177\037\177\027\204\275\201_-\212m\343\357\206\330\032\370]\023v\006\2166uE\350\2601\360\273\037\366\005~v\356\337\026\370O\305\313\317\302\375\273\002\277\353\333\024\370\367\004\\\004\374[\002?\333\334\021\370\335\377\274\337\275\371]\f~\327\203\377\027\374\007!"
+	.string	"\033\206\177\237\370\267\013\377v\300\377*0\374o\273\230\377\037\370\201P\262$\371\333\275_}a/\340w\365.\361\263/\334\367\003\257\332+\233\304\334\377\366\007n\371[\003\374W\377 \214\177\257\360o\025\376\235\200\177\037\340\337\004\370w\210\177\217\360o\001\374\033\204\177\177\360o"
+	.ascii	"\374[\203\177c\360o\013\376=\301\277%\3707\316\277\213\377\336"
+	.ascii	"\377n\377\235\377\375\337\325\373\3355\277{\367\273v\277[\367"
+	.ascii	"\273s\277K\346w\303\374\356\333\357\266\375."
+	.string	"\333\357\252\375n\331\357F\371]\257\337\215\376\356\326\357&\371]\253\337\245\372]\250\337m\372]\245\337-\372]\032\277;\364\2731~\027\350wG\360\273.~\367\375]\343\357^\340w+\360\273\023\370\335\b\374.\004~\367\304\357:\340wM\374\356\n\277\253\302\357&\340wQ\370\335\023~W\304\357\222\360\273#\374\256\b\277\033\302\357v\360\273\023\374\356\357w\331\337\375\337\256\371[5\177\233\346o\355\376\026\314\337r\371[\263\277%\373[*\177\353\365\267\321\277\335\372\333\254\277\305\372[&\177{\344o\253\376\226\352o}\374-\217\277\335\361\2679\376\366\306\337\032\375m\215\277\225\361\267@\177;\202\277\005\301\337\276\370[\370oy\376\226\371\267\313\277\345\300\337\352\374-\213\277M\376\355\212\277\335\300\337b\340o-\360\267\022\370\333\024\177\373\302\337\232\370[\022\177{\200\277=\341oK\370\333\020\177\353\341o;\374m"
+	.ascii	"\376\266\203\277\315\340o/\370\333\n\376v\303\337J\360\267\305"
+	.ascii	"\277\r\376\355\357o\331\277]\377V\375Y\275\237]\363\263j~6\315"
+	.ascii	"\317\332\375l\335\317N\177v\356g\303\374l\334\317\302\375\254"
+	.ascii	"\333\317\256\375l\226\237u\341gO\370Y\t\376S\371\331\262\237"
+	.ascii	"%\373Y+?[\345W\r\360\263b\377\323~v\312\317\202\375\254\364g"
+	.ascii	"\275~\365\203?\007\377O\1776\372\263\\?\353\344g\223\374,\364"
+	.ascii	"g\255~\266\310\317\n\371Y ?K\365\263>~\266\307\3176\177v\347"
+	.ascii	"g\227?\313\201\237\205\300\257\276\360"
+	.string	"\263/\374G\373W\023\3779\374o\373\331\023?K\200\2375\341gK\370\331\020?K\302\317z\370\331\001\374l\207\237\r\341g\003\360\263\036\374l\006?\253\341g3\374l\376\331\377Z\314\257\271\374Z\310\257\203\374z\307\257\213~\r\364\353\344\257W\374\272\002\277n\300\257M\374\372\346\327\277\177\305\373W2\377\032\346_\311\376u\354_\255\374k\225\177\275\372\327%\377\212\364\257\315\1775\376k\212\177e\341\377\223\177\355\360\257\"\374\031\313\237\317\376\354\344\317?\376\f\365g\034\177\036\372\363\361\317\030\3703\005\376\234\302\237Q\3703\b\177.\376\331\375s\373\377\304\257\356\375\252\212_m\300\257\232\370U\006\374*\211_=\300\257\202\370U\017\377U\374\352\006\277:\301\257J\360\253\031\376g\371\257\366\337\312\377*\377\275~\265\202\377k\377\207{{{{\377\206\013\376\017V~h\f\001\371\n\022\0222\373\007\006\221\002\203"
+	.string	"\205\250P\025\365\203d\203\2622\275<a\233\016%\267\254\201BN\005\215\017X\\\3267@\\\033\306\302\216\033@\252\177\033\331V\252\024H\005\364\241\002XT\2344\200\263+L\""
+	.string	"\253XQ\033\223\365\r\200\266\177\340\017\240\017\252&jpd\r\234\362\242F\310\220\254o"
+	.string	"1\251\036\016"
+	.string	"#cK\326\300(\005\254!\231\313\372\006\340\332\300x\210\356\227\006\205\030G>#(LS\270<\242-56\240xy\254\b\n\367\323fo\306\024\b\030Cm\003+\201\266\006\350\2637\335\002*\3552jh"
+	.string	"\213."
+	.string	"\0322\301df\n\274\001\204\002\356"
+	.string	":\001\237\200I@$\240\016 \017`\016`\023\220\tx\004\\\002\342P\245@%5\n\320\310\213\216\337\232\032@\245\037\233\237\036\n1\216|5\274\320\230\002\225\366\032p\006\007vFZ\3018\2553\032\033\350\033 i\377\300\"\240\r\260'd\3444\0220cV@\"`\215\226\313K\225\226\254o"
+	.string	"\237\375\002\344m\031\300!b\032\033vqfd"
+	.string	"\205\202J\222\214\214d\375\002\270m`P\001\262\354\027\200l\277"
+	.string	"P\366\013\300d\277"
+	.string	"E\364\332@\255\274\312d\335F\f\352iy\351\221\365\013\340c\277"
+	.ascii	"9\366\013@c?\205"
+	.string	"6\373)L\177wZ\310\314\254*\353\247\220\366C\363\263k\337\234\304Q~g\376\263+b\305\315G\326\277:\225n\317\n\333Y\326G\3632\377}\3004!S\\\262~\nT\366\3773\363\337\364A+[\244TY\253g@\374gF\373\2703B\222\237\244q3J\"sU\372#\363\223S\201i\307A\\\266L\343\230I\204\025L\006YY\326O\001k\377\2771re\314<\245\311ZL\220\264!\266\254\237B\220}\021Z\302\326\260\250\301\241Yy;\033\213KS\335\324\250\374\332~l?.j\033\223V\242e\232\345\355\327\345\007\346\367\345\027\367\203\373y\371\271\375\302\250\322_\333oM\375\265\375\314\306 \245\261\353\260jQ\202\262'\201\376\177[\376\343\362v(HJI\326\276)\020\377m\t\203T\206#\353\247\240c?\005\032\373(\344\355\243\020f\037\205-\373(T\331G\341j\037\205 \373($\355\243"
+	.string	"t\345W\206\304\210\222\035Y\223aI\343\246Y\237"
+	.string	"x\373\377\215\375\276\204E\222x\001Y\371\215IBcJ\326Tr\226\020\002\220\331W\321\232X\201\376\244\374\262\252@\177R~Q~R~Z\277\257# \230\212\364~S~b\277\260\037\230*\375I\371I\203g\256\312\350\370\351\023 \312>\001\262\240\274\231\265\311\372\004H\262\377\377\236\374\242\252\364\347\365\343\342\260\325\365s\222\365\363\372m\375\2348\213\362\324\2604\020\0241l\255>\001\216\366\t0c\377?'[\210\200\262>\001\204\366\t\340\263\177B\233\375\023\356\366\377\303\372]\345\020\351\222&\210\345\004-\f\223\275\246\251\356\351\311o\311O\311\272\244\250N\016(\364\343\353-\t\022$\277#?\350\036\373i\243\262\232Ybbd\36532]\202\243\323\354\231\264)F\221\037\2215bFD&'nVC~B~@|\234\201\205"
+	.ascii	"\210\0233A~U9\246\304d-}\322J\003\362\243\312f\276\350\325\370"
+	.ascii	"Q\321\251Qq\034\304j\331\202&\367C*\030\344LN,\212\r\364'\365"
+	.ascii	"\353\221\307\326@}\374\246T\351O\n\254\r\227\264/\255\376\tt"
+	.ascii	"\373'\210\331\377\217\207\323\220\251=/Y3\375t\f}q\374c\006\372"
+	.ascii	"s\3725\375t\250m`q\214\224\002[\321\035\024\336\017\352\367\244"
+	.ascii	"J\177N\177>\373\355\360\301\323\341\243\325\373\204&\373\247"
+	.ascii	"\343g\323~9\362\230P\315K\r\243\254\177\002\221\255\377[\302"
+	.ascii	"\361\002\r\032sY\377pP\001\255\226\316\346\224~DI\242\260\345"
+	.ascii	"\310\372*\234\214\032P\264\031{\320\267\030A:\342\206fL\177D"
+	.ascii	"?\032m\246?\242\237P\035\026\274\337\321\317\306\017\351w\343"
+	.ascii	"g\364K\372\025\251\322\037\321\257\306z\327ueZ\324?!\306\376"
+	.ascii	"\t>\373"
+	.ascii	"&\254\3317!\315\276\tt\373&\210\3317\301m\337\004-\373\377\001"
+	.ascii	"\375~~??\037\037\0333@\340\240\262\276\276AfmJg\005n:V7\206\255"
+	.ascii	"\315/\366\245\361\341\371\326\370\364|{\276<\337\235O\215*\365"
+	.ascii	"\261\361\2411\243\272\251A\353Z\275*P;1\350\\\026\037\033\237"
+	.ascii	"\026\037\033\337\031\225\251h\214\335\0271c\210&\3207\241j\337"
+	.ascii	"\204\035\373&\324\330/Ao\277\204\271\375\022\266\354\2270\266"
+	.ascii	"_\202\223\375\022\214\354\227 \265_\302\322\376}r\2768\240\250"
+	.ascii	"\2545Y_\204\2271\3238\237[\231\351\233\352F\346\213/\214\017"
+	.ascii	"\214O\214*\365\305\371\340\342|mN\274h\261b;\342\242\237~\t4"
+	.ascii	"\366E\340\355\213\330\262/bk_\004\323\376}]|U\330\266/'Y\224"
+	.ascii	"\370\256\232\264X\212"
+	.string	"\256\362\360@<\201\2425!\203\373\262\021U\335\220\024]\345a%9q*\322d\212\204\310t]B\304N\204\257\212O\232\343\210\264LI\320\212\256\362\360\274\240\212\256\362\260\202@\255\254\216h)\272\312\303\323\352R\302\245\312\355@\363\251\371\246\370\312|T|d\2764\037\026\037\027\337\025\037\233O\212/\314\007\346\313\342\263\342\033\363i\361m\361\231\371\304|k\2763U\352\253\342\213\002e+\272\312\303\362U\361Aq*\272\312\303\3232\202\265\345\253\342\313j\271\212\256\362\360\3428\032\254\301U\346D\202~\210\351~\210/\373!\276\366C(\331\0171d?\004\323~\b\031\373 \324\354\203\220\333\007\301e\037\204\330>\b&\373 \236\366A\f\355\223`\306\307$\303\315\305<\262>\tk\276%$T\331'\241k\237\204#\373$L\355\223pc\237\204\240\375\017u\373\037\332\366?\220\355\3377$\303\371\204\370\202"
+	.ascii	"\245ZC\276\370\252|@|?|T>\037\252\324\027\304'u\337\224\372v"
+	.ascii	"\365iI]\334\035\036\224\021h\024\0214\036\276 \276\036H\342\356"
+	.ascii	"\360\3340&`z\0045\253fh\377"
+	.string	"\301\311\376\007%\373\037\200\354\177\300\261\377!\336\3670f\377>'_\216<\251,S\262\276\b%'\323\034\276\243)S\270\244.(R\223\217\311\247\303\267\344\333\241J}9|8|9|7T:\002\274\305\335a\005\363\220\274\216\202\372\036\264\354{\020\333\367\240\265\357\341\310\276\207\247}\0176\366\3573\362\331\210\342\345\013V\326W\327\204\304L}E\276\031\276\032>\"\037\rU\352\263\341\033\312hk\021\027h\234/F\227i\034G}6|2\266L\341|6\366\032\231\r3Y\001\350\202\206\026\324\037\201m\177\004,\373#L\331\037!\272\177_\220\357g\351\253\315\221\254}?[\314f\263>9z\001\310\027\373||@\252\324\367\263\333|\353\355\275.\276\237\r\006\257\213\357g\307\251\231\306qT\316K\036\325\326m\224\252\241=\334\bG\330\374\271\313\016\263\327\344\017~\264I\223u^\233\345h\n&\353\217"
+	.string	"\225f\337m\273}f\343m4\252t\253\331tjv\231mf}r\264\307\200\272L\223\352\306@o\310\311M\325\354)\024.c\304@\267\232M\306%\263!\347D\214K\003\226e\250?\200\271\375\001\254\355\017\300\312\336s\352\227\224 k\262\376"
+	.string	"\256\366\007@d\177"
+	.string	"M\373\003\030\332\027\201n_\204/\273\025al_\004\256\375\357/\033\356\f\251\f\335\206;\360\007\031\330\217\227\267\037V\333\317\231\254\335\242Q\253\251QU\326\027\301\307\356\262\271\250\322\335\266\331\266\254A\333\366\232\226T\326\022\261\007\222/8Z}\021x\354\213 \264/B\274\377\255\345\354g\252\213.\353\213(\2332}\263\242\272Q\201\216\251nb\373l\223\205M\261l\263\255\266\3236\332\316\242J\367\331\276\002F\345lW1\241\311\306\225\022\036\220\027\241\240\241~\207\262\375\016]\373\035\246\366;(\355w\360\331\027"
+	.string	"\231}\001d\331\377\026\013A\250&\016\b+\353\177\207\271pc\210\220=\t\031\355\257M\2457]\202\202\376\330\20329A\223\354\350\346\332R\266\223-\335]\033k3\331^{\312\206\262\241\033\311~\262\263\266\326V\262\243l\260\335do\355%\373\310\276R\245\373k\027\3716\262\255\240\212\246*\233\023S\217\032\323u\211\2224\210\216\035\353\022\034U\323uI\216\247\033Uk\240S3\244h"
+	.string	"a\323\324\004\335_{\310&\262F\241>\031Sx*\333\376\332;tL\203\344\251l>Z\275\241\033_\204\274E\021A\205xQ\243\262}m\036eW\262\226\360\\5M\240p\224\240s\233\252\241\035\200\232\241\275"
+	.string	"\254\354M\304m\003q\f\226d\257\250.\353\013"
+	.string	"l_"
+	.string	"L\366\005\340c_"
+	.string	":\366\0050c?\204\275\375\020\300\354\207\020e?\204\"\373!\354\330\007ao\037\204\272}\020\300\354\203\260\266\017\302\331>\bT\366A\200\262\017B\222}\020v\354\203"
+	.string	"\264\037\200\351~"
+	.string	"\322\366\003 \266\037\200\256\375"
+	.string	"X\355\177'm$\242\2175F<\366\3216R\245\033i\027\021\251r:\332:\"\252&\274\215\264m\264S\"\252&\2550K\204\264\372\001\350\261\037\200\034\373\001"
+	.string	"\332\377\256\261\203\332\262!soy.\233\033\036$\361\251k\302s\365\216\224\3255\341\355 \267\215\033uc"
+	.string	"G\350\342\035\264\343\035\344\356\035yR\327\204\267\203\262\333\021\267\272\246Mc\017m\241=c\307\3302T\351\016\332>\337?\033\350\272\225\033S\307c\250\325(UC+\201\232\241\375\007e\366?x\333\377@m\377\003\261\375\017\240\3545\024\004\327\342\302\342\254\377\201\325\376\007N\373w\325\270xgm\324\256\244q\357T\251\213\347\242\241\341\236Q\333\252J\344\351M\361\330$\327n\310\306\261T\033h\034\307\024t\350\360\253\023\322\324\352\1770\264];5M\215\332"
+	.string	"\274\321&FG\326u@\242\226\360\310\372\036L\367U4\"5t\256\031U\352N\3359w\352Z\371\3245\341\255j\276\266L[}\017\330\366\357\226!#\327D-k\227\314U\267\rlX\223\250@Y\222\265+\007\342\356\230VOM\r\260\254\211\256\0307NK[\020,hY_\\87\214\353\305\005\343\276\251R7\316us\343\334+*\233Y\234{\2465\215\343\250\033\347\246\271m\353\223\243\006x\321jy\261\326P\337\203\260\335\005\211$\r\224\254\357\301\326\336\322\276\025\341\342\256\271l\252\324\335\342j\311\222\251\206@\267\270j\231j}r\264\245L\021\371\025\341\301\003\314\326\367\300\310\276\007B\366=\240\332\367@j\337\003\034\373\036\314\330\007"
+	.string	"\233}"
+	.string	"\244\331\007\300t\377nY\026\031\327\230\227k\305\0253S\303\313\216\254/B\352J!j\342ny1\242\342Nq\303\334*\252\324\025s\301\250<q\277\200ll\211\271N\334\350\0053\342X\252H\353D\304u\207\267\246)\275A\177\372"
+	.string	"\030\273r\243L)\211z\312\372"
+	.string	"x\262\017"
+	.string	",/\027\312.\"e\213R\304\313\007\227\333\225\243d\212W\326\007\200\022\027"
+	.ascii	"f\270Z,\\\026)gY\277\2035;\253\203\272\375\273X\356\225{u\227"
+	.ascii	"\211\253\244\314\210\352.\353\213p\225\270A\262\330\222\270D"
+	.ascii	"\\$.\324-\342Z\271F\334#\356\020w\211*u\225\270B\224\2707\334"
+	.ascii	"(\265\255J\337\315M\245Z=2P ]\240Scn\374\020\243E\025F'\371P"
+	.ascii	"\335\344\240\256\022\267G\253Wf\032\307QW\211[\225\343\2005"
+	.string	"\334\356\220t\020\352h\362\0047\201~\007o\373\035\\\331\357"
+	.string	"l\277\003\255\375\016\254\366;\210\332\357\340h\277\003\237}\016\320\354s\020f\363h\215|\311;\313\372\034\\\3314\334\035j[\225\326S\233B\271N\252\324}r\225\334\247!\033\307?cP \017\037H3Z\335\264\342e!\023\313\372\034`\205Ak\210\271L\256\016wI\225\2729\\\0349X\033j\232\tIDB\354\360:\260wS5t[\177\003\275\375\r\302\354o\320\266\1777\311-\322\212\203\313\221\365\031\020v`tbS#\227\310Er\217\\\033\252\324-rg\334\245\341\326xv\213\362\026wh\215\2229"
+	.ascii	"J\027\232[\324\326\251t\027\b\305q\024\224\253DD\3254\314\003"
+	.ascii	"22%\250U\250\252\241\235@\315\320~\203\253\355\312p\305\370\340"
+	.ascii	"y\311\372\033P\355\253pi\276lq\343\226M\2737\364)\306A\322.\320"
+	.ascii	"8<645_\334\270\275\3432u\3436/\376\361AaMJ\b\033\236+\344\376"
+	.ascii	"\2701\334 \027\310\365Q\245n\334\256y\213\206\355z>3\003/m\330"
+	.ascii	"\356\351m \216\301\230\202\210\226\262n\333\350\245-?\214d\375"
+	.ascii	"\r\240\3667\310\261\277A\214}\r\324\354k\020f_\003\264}\r\244"
+	.ascii	"\354k\320d\017\325\f\3555\220\332\327`i_\003\032\373\031\354"
+	.ascii	"\355\277\235\2765C\003\213\315T\326s\371\312Q\030U\326\317\340"
+	.ascii	"n_\004\334\223\016\022d\352\005\252\r\323\222i\305\264`\3321"
+	.ascii	"m\031U\332\312\265_\362\232\233\232\246\266U\251\300\244j\032"
+	.ascii	"\207%\004N\256}S\323\274\234\271C\303\213\343\330\312\031\024"
+	.ascii	"\320P?\203)\373\031D\3673\340\332\317`k?\003\254\375\f\224\354"
+	.ascii	"\277mk\273\350\230\201\305H\326\\\364\224\247\240+Y?\003\251"
+	.ascii	"}\023\264@M\231<\245\255\265YZ\265vK\313\246J[--\232\212E\b\264"
+	.ascii	"\325\322\236\251n%,\271Q\247\204\027\224\216\021z\n\352cP\267"
+	.ascii	"\217A\333>\006U\3661\270\332\177k\326^\371\"\243%%\353\262h\220"
+	.ascii	"PK\033%\246\254\217\301\021+m\225vL\225\266d\255\330sP\026\232"
+	.ascii	"\322\206YA\343\370\213\254\245\322\206\251mL\007@k2\215\343\257"
+	.ascii	"\226\254\005S\275~@\200\344\256\b\333th\355\330\372\030\b\355"
+	.ascii	"_\260\267\243A#\243!QY\377\0025\373\027\320\355\277\225\322F"
+	.ascii	"I[\273\312\221\265\2245\262+*\223\365/H\333\027q\325f\r\203\212"
+	.ascii	"q\320\324\332\2236\332z\265_\252\264\205\322jAi\231\260\265P"
+	.ascii	"\332\255\266k}r\264\303\246\270L[(m\221v\311\032\205\356\032"
+	.ascii	"@\256\322\2306*?\355\244\345\312l\272\2009\"\346\344\311\376"
+	.ascii	"\005@\332&\276\250&(?Y\377\002\036-\326\005L\373\027\f)\t.y\321"
+	.ascii	"-e}\013\324\354\377-\222\366\210*m\223\264VP\021m\222\326H\n"
+	.ascii	"mg\260\260P\260n\354\265\372\026\320\355[\360\266o\201\332\276"
+	.ascii	"\005W\366\337\022i\207\330Iud\311\372o\207\264U5\270\210\210"
+	.ascii	"d\375\314\305.\b\024MU\2176G\213\324F\265R\255\216\266\250\305"
+	.ascii	"\321*\265D\255Q{\243\375\3212\265<Z\037-U\273\324\332h\201\264"
+	.ascii	"G\355T\273\243\025\322\006i\237\332\246\326\251\205j\223Ti[\325"
+	.ascii	"\322x\006\323\326"
+	.string	"\270f\315\374\353\222i\2211M\2409\017L\3274\347\311mA\327%uC\272\214M\325\326\3304.j\323<1NT65Nw<\240xO\3208\216\236\021\262.I\003\005e\323\332\254\344\2740\\\323\272,Z\310\224\301\232\276Q\201z\021\203\306\201M\3438Z\305\262ig\254Qh\013@MS6\255\255b\265\260[\326'G\333\nP\026:\"\372\306\227)P6\315-\272.i\253\3309#\323\234\327V\261pa\323\237\230\022\216\262\004h\326\002\351ng\374l\036\273\246\035\332\300\324\031\240\262\254e\370\262\304\2305\311\372\026p\355\233\300\356\265Am\214\026H\225\266B\255\317O\221\210V\250\215A@\321j\302\212\343h\334\017\267\272\255o\301\324\276\005N\373\0264\355[\300\264\3316 \316\352\001\203\224\302\214d\355S\332\352T\325\320f\240fho\301\214\375\n\330\354WPf\277\002-\373\025\200\355W"
+	.ascii	"\335\257\300\307~\0058\366+\360\331\247`\272\037\246m\237\002"
+	.ascii	"*\373x\252\206\366\024$\331\247\300i\237\002\031\373\034\354"
+	.ascii	"\3669\264\355s\260\262\317\241k\237\203\221}\016O\373\034\202"
+	.ascii	"\3667\250\331\337Pf\177\203\332\376\206/\226\r\330\205\212\227"
+	.ascii	"\242\254\277\341\b\273\266Aj\177C\322\376\006\031\373Q\026\215"
+	.ascii	"=[RD\246\t{\306b\261\023r\003/k"
+	.string	"3b\027&d>Y\177\2023\373\"\244\200A\343\276\304\264\236\260^j\033\223\316\2522e\273~\020l\025v\312\030[\205\205\302z\r\3278\376\2412\306\212\261d\254\025\266\214\245\302\206\261WT)[\205\005\313\3220h\324\n4\216\243U\330(b\222\356\266\260\204Rj\350\b\202\243?A\327\376\004C\366'\230\332\237\240i\177\002\243\375\td\354O\020\263^W\3356\340\264\322\021%\353k\310\333\3270\335\237\252\032Z6\313I\252\252.\353\253[@\230\326\252X\350\032\205n\032^\214\246pHl@\235\260[l\023V\213\305b\257T)\233\305.9\313D\337xf\263\330#E\323$*\035\021\224\315b\225\324X\223\204\330\350\r\365O\315\320^\003\334\276\206-\373\032\320\3665\204\355k\320\332VOmQ&Y_C\221}\021A\364\240q\034%\302\032Q\245l\021V\b[\204\035\022\257f\352\264\262\260\034"
+	.ascii	"\225$G\253\257a\310\276\206\247}\rM\373\032\212\366%\300\243"
+	.ascii	"\372!6\346\204i\212\365\241J\331\037\254\224\032\215\343h\217"
+	.ascii	"1\023\330\037l\224\001~\342\356\260\202ZN\316h\264\372\022P\331"
+	.ascii	"\227\200\311\276\004>\366\317\362`\241\326\032O\342/\326\211"
+	.ascii	"\335\301>\251R\026\212m\322a\225\243\t\013\3052\001\371\351\322"
+	.ascii	"\303\353\260\233\330my\262\3653\314\355gx\333\317p\266\237!l"
+	.ascii	"\377\354\022\253\024\006=c%k\032\354\321\360\247\030\307F\314"
+	.ascii	"Lq\2607T)\253\304*\261I:K\214\016\303\233\322\322\352g\210\262"
+	.ascii	"\257\242\021\225\201\262F,\022[\244J\331\243\303\325P\323\346"
+	.ascii	"\240G\254\r5\355W\304K+\013\257C\007'\327\2175[?C\325~\006\251"
+	.ascii	"\375\fP\373\031r\354\237\235a\001t\n%k6\206\336\373\341d\252"
+	.ascii	"\357\300\330\037\326\207\rbe\260@\254\020;\244J\331\030\032\314"
+	.ascii	"s\036\033\243\2611\264\236J'\345\212\323f~LI\243\333\buyy\231"
+	.ascii	"/b\3238\216\26214\234\376r\200,RYKxq\034m\343\300 9S\324+\316"
+	.ascii	"\335>N\2305\232M\236+D\214\f-gk\362t\316\206\300\324\\\347\321"
+	.ascii	"\021\213\336\270(e\255\361\\+(\255-\267\377>v\352\216\314\330"
+	.ascii	"\024;\215\346L\276r\212*\303\304\356\f\360(\r\r\031u\327g\334"
+	.ascii	"\326&f\354\326\320\375\367\351 6 rt\0173\224j\023\215\242\322"
+	.ascii	"s\300\271\270!.Y\037'I\227\321d\\\2378\247\037=\346\232\f\213"
+	.ascii	"#G\2160-\307\026\246\n\225\234\030-S\302\232\264Ql\302\334\351"
+	.ascii	"0\032\2146\223\2625\311\3728\361\376\215\231/*]\233Ch\215X\326"
+	.ascii	"\277\361\262\177\223e\377\372\315-\032\325\244M\326\332\355\327"
+	.ascii	"]t\233\232\246\252Bs6\362\262\316Q\252\206\326\0035C\253g"
+	.string	"\200\270\3462Dj\"\r\333\3026\202Y\021*-\327l\377\272D\257},\267_\232\250Pe\235cUC\253\213\200\270\326\222A\225\263\262,jq7\366\302\262\326iZ\315tF]\326\277\231\262/\242\353c\353\223\243\tb|\2312\325XtT[ABB\226\037!lf\372\212&\323e\032M\237\251R\215e]\202E\217\255:P\210q\344\213!\255\242\265\266\274\204\260\341\251lX4\327\307\3246\260X\350\311"
+	.string	"\262H\ta\303\213\343Xc\321N\262 \021\302\326\241\203\332\245\016G\335P\377&\212>3C$.\353\337\\\355\377:L\213\251RM\345O\364\227\220\326TS\321R=E*\2044/!l\277<-ke\255\376\365\024\r6\326\245t\226\265\226\002$:b\206\224\365oh\350(7_\327P\304\230\330\324\320^mD\366\207\264\007^\326/\266\331/\252\331/\322\355\027\343\366\213Z\366\213T\366\213_\373`Y\252\234\026\332\024X\023,\262\237*\241\254\257\202pMveY\277x\265\257\256\031q\002\r\222\265C\013\372\326\2645Du\233\262\322Lt\022\255D/\321Pm\245\221\250R}D\023\271.\222\271(i\2465\nu\245"
+	.ascii	"5\231\306q\254\217h!XP_\221\364\007\250\250_L\262]5C\373\"\325"
+	.ascii	"~\221i\277H\264_\214\261\177]\005d\205V\034\2265\325/\213\227"
+	.ascii	"\030JY\237\250f_\335\322!f\332C;\345\261\365\311\321\226\002"
+	.ascii	"\205\313tG\027(\b\335C7\251iSa\246<t\224\376\241\245\364\224"
+	.ascii	"\366\241Ju\017\375tCI3\311\351\244\037\204\356\241\2414\023\t"
+	.ascii	"N\216\350\345\341\271\\HvnC}b\330>\321\311>\261\310>1\310>\361"
+	.ascii	"\307>\021jk\034zI\225r\3209\002s\304.^m\350\322~S0Q\330\246\024"
+	.ascii	"\321\270\220\3048\24326V\304b5\200%\320\267$\262\027\261\024"
+	.ascii	"\315\242q\320\270\242Y\361\n\22371zZ\256\264\311\\X\261,/I\233"
+	.ascii	"\201%\212\227=,\332\320&&\036\3035\006"
+	.string	"\215\251\254\254\213R\212R\212b\307\371\031\362s\312\021\007\305\213\231\224B\370\213a/\212\235\305 c\367\226uq\312\317\326L\351\202\313\272\b\206\001\256\375\027\243\304fv\\\310\212\322\241\320\335\223U\361Kh6EG\325T\326^^c\200\344\256`\345\300\022\335\313\372\030(\022\215\022\243 \334\322\330\305\230Z\302\224\3651\340\304\305E\214r\210Z\307\324\335ma\3551/3\262\254\217\001\240&M\212[P\264\232T$3uKZ/ne\331)QR\274\342\020\265\226I\272\333\302\362\235\001\232\202\306\344\305+\r\267\206\306X\326\305%\252\333\0303kW\266\024\255\212VE$\034\270\344\340\202b\021\233Q<\362\"\222\271<'\006\246I\326E\250\376\322\016e\265\211r\001&\305!\305!\305\"g\362\321\031S\217\"\221\027\213\3441uN\320\\\240G\220 \305\035]?qwx\277\237\240.Q\262\376\005l"
+	.ascii	"\0012\004\312\035\332\225\216\237\241\274\037?8\330\345\270Z"
+	.ascii	"\232qEL\331\225\036=\212S\034\242|\322\374\230\200U\266\260\311"
+	.ascii	"\223zqj\f\230%\313X\021\013h\025y\024y\270hDTM\355\325\023\232"
+	.ascii	"Z\326\267@\221\247'\241Y\017\275<,;31nY\337\002LE\246\"Sq\007"
+	.ascii	"\023\364\267G&N\252\351\305\035\3010IU\236tx9\332\302F\307\213"
+	.ascii	"5\320\030A\263\276\005\206\212K\305%\020=\322\330a\001\305\224"
+	.ascii	"\234\020\311\372\0250ST**\t\315\222\212\256\362\260\316\326`"
+	.ascii	"\035\311\372\025\350RL*&\025\217\276\350@\322U\235\311\372\025"
+	.ascii	" +\322(\322(\036Mi5ii\033\265\237\242\321\213GE\320\340\t\311"
+	.ascii	"\372h\212E\\\232\222\302\024\025m\204\301Qd$\353\"\221\2112N"
+	.ascii	"\322\262~\005\240\354b\215\226\306\252\245\210\332\231%CCB3\016"
+	.ascii	"Q\253\231'i\354\260\202\2064=\t\022\024T\214\241z\305F\"\350"
+	.ascii	"\352\232\260p~~@\213B/\306\330\"$\311W\005\220\212?\305\037\241"
+	.ascii	"\231\0364\210e\210\311S\326\257\200P1.\306cei\354\360\202W\202"
+	.ascii	"\234t\311\372\024\310#\266!\266!\352-\3310\223\205\005\024\323"
+	.ascii	"\006\304\214\336\221$SDpxx\3045\034\242V9\033f\262\324\3304z"
+	.ascii	"Gky'\2569\333\202N\371\2225Q\215\273\306e\212\007\005\250\334"
+	.ascii	"\335\021\353\330(\231Q\3022I*\223f}\nd\331\331\t\315\224\340"
+	.ascii	"\350\202\302\322\261\245L+\353S \311tJ\254\323S2\243\344\307"
+	.ascii	"\304f%\f\335\211u\352\236\233\224mJ\022)\2413Y\237\002<\210s"
+	.ascii	"\3049bT\rG\027\024\2235@h\262>\005b\242\034Q\216H\306eS2\243"
+	.ascii	"\304\035{\202\332\030s\""
+	.string	"\231,\344l\254-\312\030\251\032oY\177\002spp\3040XFq[Xf\236(\20191L\360.\006\233\260\254\211q\304/]\332P\375\020\277pA\301\240}\261*\262B\303\345\355Mh\266\004\214\352\252!e\205\013\027b\033\223\242<5u*\356H\n\261\313\211mC\300\360\312\274\264\\\013\221\215C\224\317]\233\244\256\311\241)Z;\221M{\351\212\0133\201+33\242Z\221\037\324\206\234\223.\343E\207\006\313\211j\3044\250\017<\031i'\242\261Q\251\361%\357\207^\0263g\233\316\2022CUv\200\235\030\006F,[\343\324h\314\024\345C\227\302\032\340\223\032O\334\252\234Xv\"Y\b\023^fc1\211\373\311\2328F\264B\244\3622YI\031\"\272\254\211bA&0x@\206w+\227)/@Y\023\247\370\256@\375\220\312\372nX\334\016h\326\237\200\022\361\213\370E\214\302!\312\207N"
+	.ascii	"J\212\362\324\210l@\254\216\210\322\023\243\b\241>\336\254L`"
+	.ascii	"\210\350E\364\312\313LR\246\024"
+	.string	"\311\372\022PC\344\"r\021\243^YKXj\020'5B\272T)1\252u%\232C\002s\304%\304\2553rW\262\332\304\212h\235\270u\2357\205&kb\026P\353\206\032%[Y\023\233\374L\212\232\030H\260\302lx\tB\304\"^\231iiz#2I\253\362\206\224\365%\320e_\002U\216\034!&\321\260U\224\247\246Rq\031)\202\344\304$\300\250\0362\360$\220UUE\264\002c\244\001-ca\214\234hUv\007fJ\326\304\"@%M^\334j\020\211@\001\335!!\022!\016a\261\025\205K\020\242\220\266)\372\224\243*\210\004rDE\021\2518D\371\334\r\241EwP\373\t\255\214\313\217\023\251\346\210cPfU|\270CP\2421>\246\206Eb\212\030\365 J-1\335p\312\372\022\210\261\211=\"`\206\350Dt\"B!)\312S\303\003\"\261\331!F|:\021\352\206\030\033@\""
+	.string	"G\\\".\021\233\202L\311]\t\022\375rB\324qb\323YvzR\245\b\221i\353\200*\251Ad\"\346\330\322\";%\304\034\271\354\250\013KV\326\217"
+	.ascii	"\031\361\210xDTz\0322)\272\203\302\313Plq`\210H'*\021o@y1\262"
+	.ascii	"\22551\211\230\206\206\007Y\326\217\300\327>\032\240\222\377"
+	.ascii	"\276\r{Cdd\375\b$!\022\021\211\210E\356T\311\214\2225kF\034\017"
+	.ascii	"\242\215\023\213\320H\333\270\"0\204H\203Hc\230\304\006t\f\332"
+	.ascii	"\214.Y?\002HCC\303$\034\242|\350<H\322#\215\035\036\260k,.*"
+	.ascii	"\353\303`\206(D\024\"\3060\322&)\231QB\204\003\213\022b\f\340"
+	.ascii	"\2249.]\264d}\030\262\020}\210>D w\253\350*\357K\215M]\326?\361"
+	.ascii	"\347D\240\264\f\324\270\201\003\206*j>l\243f\270\347b\341\020"
+	.ascii	"$\303\232\245\267<\274x\310)\204\034*\036lz\037\356\235\255\335"
+	.ascii	"\223\222I\r\331\270`\276\254ye=\\\303\356\2701FI\336\357\013"
+	.ascii	"V\261q\251\313\3720\344\330\207\341\b\314\207e\300\f\323\020"
+	.ascii	"\301\3248f\212\201\202b(\036\025tY\352\252\303\213\207\230B\020"
+	.ascii	"Vij\0225\367a\232\017\353B\2300\274\023\026\235I\335e=<3\264"
+	.ascii	"S\245_\033\242y\2248\274\"cJ\335\276\372\265v\004\352\327\332"
+	.ascii	"!\335\207L[\256L\263\376\320\314p\372\373~I~|]e}\025r\373#l\257"
+	.ascii	"%$$\257\377>\342\325\232\032qY\017\307|H\346\367\001\271\316"
+	.ascii	"bx\311\372*\336\366P\314\207r\277O\245*j{\313\372*\266\354\177"
+	.ascii	"\030\346\367\005\351\210,\t\311\372*\324\366U\224\271\271\r\277"
+	.ascii	"p\210\362\251\013!\315\233\020\266!\024#Th\276\f\3412\320(R\202"
+	.ascii	"\363\262\321\200)\262\366\246\323\204hK7\236d=|S\361\265e\313"
+	.ascii	"\260\313\257\211\210\252I\007\351b\203\306\220\313\207]\314\332"
+	.ascii	"\310t\031[b\245IX\326WQdmm8D\314~\323J#\313\372*\230\262d\031"
+	.ascii	"\016Q\261\340\270\342\002l\363Q\347$\353\253\210\221\2266\034"
+	.ascii	"\302!\312\207\356\0036KWLxB\2734)UY?\205\024\263\233\r\317T\257"
+	.ascii	"\330\310\225\342E\356\n^P\fo\211\017\226\017\317\200XS\326\320"
+	.ascii	"%\311\372h\332\254\377>!V\231/:\262~\n\254\261\261a\331\317\311"
+	.ascii	"\206\234S\326a%H\216\354\303\262/\270\">Y\037\315\276\021\362"
+	.ascii	"\261\222\252Re\017\032\004\313\273\232\221\365S\030\211\211\r"
+	.ascii	"\223\350h\217l\230\311\302[\277\276\324\245\311\373\372\032N"
+	.ascii	"\341\020\345\203\246\305+\252\303\"\024f\255\n\330\207SD\310"
+	.ascii	"J\372\222\362\337\027\201%jC)\303(nh\312\224\310\234\326\310"
+	.ascii	"\216H\1775x<\345P"
+	.string	"\033\343\345\365S\"\242j\322O\336\232L\265D\243B3\325+6R\267\226\206\344\001ias\225\365!pd\2305\314\032r5\025\345\251\341\255vka\234|\310\025\306\203lH\326\303-`Z\0251U\262\262\036j\335\f\032\275(\2743\034eZ[\262>\004\246\260\260\214oYKX[Q\324\264\311\372\020\330\261d\311\220\311\327\240\030\252\251eZ\002\302\006\317H\231*W\230\214\255rWmVuH\220\f\223\220\240\3062\242L\r\231\256?[\332\004I\342\006\024\203\204\345\204\213\225\325\020\n%\210\357)LG\031t\310\223\030=\262>\n*E\212\f\207\250\305(\220\227&\276\256\250-\252\250\020!\303!\355\224U\b\256r\270\r\311TB\\UM\262>\n%{\350c\350cX\365\003*\332\301\225\255\220\020M\371\260j\b\304l\315\226\245\037C*\340\332\025%{Y\037\305\217\037(p01\r\245\f"
+	.string	"}K\322?Gp=z|(\225\317~\f\271\221\365\360i\030\265\257(%m\201\032\362X\211$\231\221\221\365Q\004A9\2554\216\224\371p\332!\f\203B\362\242c\330\244\225`\221\242\202FG\3361\345\314\03208\242\023\r\227T\257\330H\005Y\\\b\304\272\2435'C\034\037.\211\341Um\311z\2104T\362\3615'#\353\341\rV\316*H\222\254\377"
+	.string	"\263a\322\360h*\n\3246<\032\032Y\201y\323\312zX\264\207\206\311Y\326\177\300\327\036\332\310A\2628\341\361\226D\206\214!\r0\240\017\261\257\273\031\037\3220\242\246J[\326\303!\037\0231Q\232\350\272\2220Qe\375\007P\r\177\206?C\241.\265N\252\311\214\254\377a\320\207B\356\020.?\222\262\036\002\001\323\264P\0226Q\017h\332\3026\3026\303\230\202\244\242<\265x\007\2330{\037\306>=\274\267\274\254\205z\3004!'!d\262>\232<\306\305\210M^\326\177\200\2155k\362\330\236\021\307RM\277)\2164X7E\332\256\262\376\013lj\324\250r\332'\032\033IP\006\244\325\004\202\354h(\353\277"
+	.ascii	"vw'L\243\203\2421R\fHzyx\361\221\232\b\303)gi\256d-L\363B\226"
+	.ascii	"\0301B;\025\352p\310\335aMYb#\266;\363\223aC\211I\326uR\320\220"
+	.ascii	"\254\311\372/X\355\253qe\314@\321\204sB\2719\341\234pL\nZp\324"
+	.ascii	"\251\341\t\351\204S\241\031U*\234\023\222\231\026u\331m\375\027"
+	.ascii	"\222\366_\220\261\377\202\320\376\013@\373'\330\264\265\t\301"
+	.ascii	"\024c\034\371\212\276dM\343#5\021|uJKx`\204Gs^\336\262\376\222"
+	.ascii	"\201\260\361\252\312\372'\304\354\213\020z\021\252\t\337\326"
+	.ascii	"(\264\205\2516S!\234*\025z\021\272\005\321<\371\354\320\3027"
+	.ascii	"\267\247\2477\240\254\177\002m\377\204\330\376\205gR\341\231"
+	.ascii	"\220\213\032C\035\360Ek\032\0371\2110Tce\b\232\365\226%li\\\262"
+	.ascii	"\376\211%\373\277pM\225\n\331\204iB6\241\232P\313\005@q\374\363"
+	.ascii	"\364K\302!w\027\0343\243I\230\326\2770\313\205Z~!\232NR\335P"
+	.ascii	"\250A\262\2255\313\004\304\205Y\206\326de\375\0238\366]\330\333"
+	.ascii	"@\272+W\204fh@Hb\n\201\030\324\226\225\206F\225\n\315>\367\246"
+	.ascii	"\304HX\326wA\214\320\212\320\212\220\354K\007x\023\270\302\006"
+	.ascii	"\312\330\205dl\362\340~\262>\032\265I\03301\262\276\013i\302"
+	.ascii	"/\341\227\220\n\026\005`a\nAS\t\003\223\212]H\205*\313\r\256"
+	.ascii	"\254\205a*X\225^\026\230\254\205S\204`VG\252\024e-\224\n\301"
+	.ascii	"\310\332p\021\222\365/\004\023Ji\262f\347D\205\003Sc\266\b\243"
+	.ascii	"\374\244;\t.\036r\001\212\227"
+	.string	"\227\220\311\227\210\251\013A\270\270\204\321=#(\226j\362s\"\342\272\033\232y\"WF\330Ee\357\214O\326w\201i\337\005\243\375\013\267\204[X\253\030\032/\\\262\276\013\361\376\205Y\302,5M\377x\305G<8\272\240\260n\020\221+\223\365\035\320e\377B,!\226\352\266\301\335\212\203\354\t\230Y\222$B&j\034\3071S\354s\006\004&\243:=\254%\0272\t*1:r%k\241\222.\241\020\241\020\341\221/^\"\224\204E.<\"\204\372\300\260\242K\262\026Z\r\253\b\231Q\223\365\035\220d\013\215\b\211\250n@\254\350m\311Z8\304\0018\252\2522\225\016\362\212\2210\200\343\212\013V\226\227\223P\326o\200\031*\252\037\016\037U\356te\303FLM\326o@\234\260\207\260\207\320\307\225\023\260\b\247.\364\3619\315\006\307\225Y\326B)`Z\233\343\307\324J\003\322\366/|\022>\ty\250"
+	.string	"\026\365\223T\302\332[\326\022^\026\27292B(\027\2104)l\277\001]\373\027\352\020\352\020\356P\241**\276!"
+	.ascii	"\256\2421v\323/W]\262\0266\375\224\352\320D\263~\003\212\354"
+	.ascii	"7`i\377B\034B\034\302\034]7\264\232\264t\3059e-\\\022\333\002"
+	.ascii	"\305,\3537\200\306\276\t5\373\027\"\t\221\2047\212\264yEWy;\300"
+	.ascii	"\b\311e-L\032A\336\026\267\254o\202\314\276\t-\373\027\332\220"
+	.ascii	"\nm\b\215\254x\311\232\"\265\t\201\n\213\204x=\240\260d}\023"
+	.ascii	"R\366MX\355_8C8CX#\005"
+	.string	"\257\270;\027\306\206\266\262\026\322\320\013S\322\222\365M@\355\233\030\332\277PH($\224\241f\303L\026\023\021\257$Y\013c\270rEz\320e}\006\244\331g\200\333\376\205>W\245B\037!\220\225\213gC\316\toI\020<\036Y\013\177\324%.RyY\237\001W\366\031\300\245\247\027\334S\201)*V\nA\353-k\t\357\b\225\242\246\340\336O\311\006\314\310\200\306e}\006\350\310\313\013\262\231\372"
+	.ascii	"\211\215+%)1U7\262\016\256I\223J\031\313\372\f\030\332o\241\356"
+	.ascii	"\356.\210\267\201\202\342"
+	.string	"(#-^p\212\346D%\230f-\316\207\220\254\337\002\334~\013e\373\017\326]\225\006\353\202v*\200E\3057PHr\244\256\351I\bmL\326\30136\314\342\362\262~\013Z\373-DM\247BZ9\256+@Y\277\005\244\271\271 ?3\256&)=2d\252\2401\260L\237\262>\013srr.\031\355S\214\006}\341\001es\362dG\2270a\324D\320s]\200Le}\026\316\342\342T7\355S\214\002}\331\001\215j\243\346L\030\034\234\232F\003(\317\275\032\303\344*\353\263\300\344\355M\245\243\241&\302\236\373\222\022&\353\2630\305\205K\260\355'\353\207d;\345UI\223u\260\213;&\306\213\223\254\317\002\322>\013lA6\325m\003\005\305PU.\232\222\031%\254\324]\232&Y\177\001]\324\324\202Z\366\214\240\230\212H\253\204\210\353\316\013.\354,\353`\026\275\346\210\231\310d\375\005\230\355/"
+	.string	"K\020K\020\315\b\351\016I6\272\341\204.\353\340\031\322\233\025\247\254\277"
+	.ascii	"$\373\013x\332\177\220\354\2524H\026\274\262\205\202\342\037"
+	.ascii	"#\256\323\260)\357\247,\353`\331\217)\307\036Q\326_\200\321~"
+	.ascii	"\t1U\032\024\013Z\371\3750\273C\333\261\027\337\351=h\345\017"
+	.ascii	"R\tV\371\021Q\243\264\274\246\354\262v\243xa\366\037\224\252"
+	.ascii	"\322\24048E\005\246\250\370F\bW@uJ\276\271\031[Z\300\036\234"
+	.ascii	"\362\007\243\004\245\374\204l`8\004\311\234\217\254[4 \036\004"
+	.ascii	"\333{{fA\262f\265\210\355?\310\245J\203\\A(*\200E\305J!89:\203"
+	.ascii	"e\t.\250\315\353A(\177\260+\030\375U\345\250/in\374\310:\370"
+	.ascii	"\004\304\203^bkm\254\262\316\240fh\211\261\252\241U\247T\373"
+	.ascii	"j\0235\210\205\025\334R\221\342\370g\310/\351HI\204'[\257\254"
+	.ascii	"\315\231\254\377`\326\203Z\276+3\212fd\035l\002\342\301\254\016"
+	.ascii	"\370\210\n\222\365\0075C\373\022OL\230\264C6\320P\224\256\342"
+	.ascii	"\223\306\016\013\350\315\252,\353\227\250\261\377\240\222\240"
+	.ascii	"\022\366L\005&\2578\2118\304\353n\213\207\0215+Y\237\004\335"
+	.ascii	"\376\203\320\253\322 4\210\204\204$?\2376\244)Y\007\217\020\317"
+	.ascii	"\240T)\222\365I|\331'\201\205\b\221\240\021\025\230\242~~\016"
+	.ascii	"\240\205$\356\256+\311\032[\260\bQ\n\021\255/Y\237\204t\237\304"
+	.ascii	"\221\375\007\253\256J\203UA!C ^]z;\232\204\346\202A\316\f\211"
+	.ascii	"\205\311\372$\242\366I\320\330\177\320\2074\350#H\245\177\274"
+	.ascii	"b\037\342\030\022\255,\225\355.\207Q\326\301\037\27711&\244\254"
+	.ascii	"\277\202\335\376\nc\366\037\214\372s\036\033\253\322`TPj\003"
+	.ascii	"\rE\3057B\330\362\223\265\304B\333\212\260\262\016\366`\251\354"
+	.ascii	"\310{\313\372+d\331_a\312\376\203P\322 \224vS\241**N\332`IR\326"
+	.ascii	"\022\236O\2146;\262\376\n^\373\017:\251\322\240\223f\3333\202"
+	.ascii	"\342\037(\227\t\021US\230$4\244\262\376\n[\373\017\352P\245A"
+	.ascii	"\035\301&0h\0343\211\020\f2\362\352\312:\330\364\347\264\314"
+	.ascii	"\366\203\352\252/-cY\177\005\250\375\007\227Tip)\230\243\004"
+	.ascii	"'nh\206@\313\2029~F2\333\227$\266\254\277B\214\375\007\223\202"
+	.ascii	"IA%\025\300\242D@\272C\202\025\307L\"\3544P\320\334\262\016\336"
+	.ascii	"\320C5^\242D\263\376\n\361\376\b6\373\017\026]\225\006\213\202"
+	.ascii	"G*0y\305>n\225\262\272,\250\031>Y\007\215\220\214D\311d\375\021"
+	.ascii	"w\373#\352\366\037$\222\006\211T\272-\024\024G\005\031.\251\211"
+	.ascii	"\260zI\261\332\221\365Gd\t\312\b\312\b\322PI\210\201\274<\371"
+	.ascii	"\200\026\234\361 \r\271\245-T\224d\035\034\352b\003m\307\227"
+	.ascii	"\220\020\260L\215\311\324x\310l*\213\230\005"
+	.string	"\212\216J\326\037!\265\377 \2204\b\004\264\242\177\274b$\021Qq\\\260\342\250j\264e\375\021A\373\017\306\322`\034\364Qc\250\032\307W\246\206\370\262\2441y\t\372\374w\365\373R\222krk\323\006\250\227\302\324I\204m\206\344\b\2176\314\225\261e\r\216\2605k~8e\221\211\371\222\245FM\033\246}\274b#\025P6\021\206uTq[\326W\201\307\376\201ww\3004\332\247\030\215\247\264@\343\330I\204\fE\210\022\2756,I\n\031\266\254\257\202\321\376\201\252\024h\327\206\251\300\024\345S\207\202\326\321[R\213E\226\367%\353+\300n\377\300\272?\007e!U\n\254\003R\321A^\261\017\017\336\016.7G\222\0324Y_\001]\366\017\234NU5\025\252\242~\2446\320b\244\327\364\343\352J\253\222\365\025\320%'\007\234\033\332AC\370\201e\016\234\373Q\355\360\331\002\222\361\265\335\335\201\001\311"
+	.ascii	"\307\254jEkC\200QMbX\262$\t\023Fl\315\"ejN*.\016\b\247}n\202"
+	.ascii	"b\037Y\240q\314&BV{\313\223\312\372\n`\332?\320\213\027 \334"
+	.ascii	"\006\032\212\372\231\022\200\223Q\032<\2748f\023\201\325!\304"
+	.ascii	"\312\221(\323P\025\256\254\237\200\272-[\200nN\026 i;\320M\245"
+	.ascii	"aD\312X\326\300.\026\270\022w\2275\220\0130\3557\005\202\243"
+	.ascii	"\263\202F\006\rJ\326O@\332\332\0320\313\216\343\330'\032\033"
+	.ascii	"\021\241FuzX\t\320\332\007\232\001\261\034x\3663`\226\027\343"
+	.ascii	"8\306\2513\252\323\303\213\231\216B\370\201"
+	.string	"j\007f\301\213\302\345J\332\177\037\f_\344\272\244\241\001\241Mg\332@Y\002\312K\313\372\t\210\367\177\365\371o\343\237\2438\216\223\330h|\004\024l\177\365*\253\252!\374BuU;\370\257\177\005p\275\210c\036\\\330\304q\254\332\355$c?;6\210\377\377\033\3428F\032\n\212}\324\241/)\244\241/\251\243\233!6)\2448\b\t+H*J\035\n\222::\n\212}n\342/\251\243\241X\n\251\030\177\3059\206\276~|\324\241\240\030)\216\245\342b<\364\203\024\177E\217n\206\276\244\216\206\276\244\220n\206\276~\220\206\342\250\2708\024\365q\024G\245|nj|\375 \305_QH7\361\227\024\322\220^\032:\r\270\264M\255\351\362\325\245\245\036\031\n\212\213l8\375\034\025\333\206\242Qq\2308V\301b\304Gq[\034w\020\307NQGa~r\250d@mE@T~\242\324h\034\307\024\330"
+	.string	"\232\212\212\203\332|\324\270mHIT\034+\001\322\211m\304q\034\227\340\023m\213\203\250m>>\234b\242\030q\\A\034\215c\033q\354\243\306mq\034\373\304q\354\0369E\343\270\2518\004\265a#\216\2318\330\210\235|\312b\304q\006\223#C\032\372\232\212\002Q\026\345\013\032\313\210\372\250CDQ14\016#u\264\277|\236\304Dq\034\253g6\024\351F]\326Q \031\324\024% \331*F/HJ\326G"
+	.ascii	"\327"
+	.string	"\216F\363\274\030\245\001V\031^\301\322\205.\353#\340\307\006\212A\211\356\250\262>\002p\204)\251\265\225-e-\005\b\266\275\250\371\261\226\365\021\020K\371\002Jmd\221\362e\356\013(\005z\375p\250"
+	.string	"\026\365#\305\001\224Q\334V\033\243\013\n*\353\037@\272\243Q\240\223\257AL!\254TsNOY\377"
+	.string	"H\366\017\354\002:\331t>\312\244\001.\371\022\240\023\325+6R\247\230\311]\301\213c\246\020\366\226\023#Z\266T)\320\311OH\017\036qY\003\233"
+	.string	"\2656U\023*W\264\262\332\245+obY?\256\247$\"]Y\037\r\020\353\277\017\b\244\b\030\031@,\340U\022^\215%e9\306\021# LZ1\367\247\307\032\271\254\177"
+	.string	"\246\215\004\230\304E\235\020-Y\377"
+	.string	"6\220<\331"
+	.string	"\0174Ld\254\244@+`\021\355\343\025\373"
+	.string	"\245\320\245\261\3238\364\210\302\362\214\024\031\236Y\335\201e\r$r=C\323\b\n\357r\305\021\3569\201\301p\203\0068\034\336\345\212#\334sB\003\230\251\334 \3712s\224OfO\220\203[\344p\003\204\231\312\025>\302\027\\\307\303S\007>\3560\225G\247\357\371\0269\300\340i\222H*y\2060x\232\310\t\256\343\201\347\271\363\341\205\223\347y\342\205\363F\202\024\357\263'C\362\330\\\032q\256\343\001\351\234 \207\251L\001+\231\312b\023\206\034!\211\344\261\271\224\200\330\302\013%\013I\346\210\027>&\225\313c\013\016O\026\2060\323DR\311#\004>\337%\022\006\211W\005\022y\334\360\302J\247\013\340\211\007\244@\261\200\005$\217\257\363\247L."
+	.string	"\306\361\204\006\024/|\\\366 \227G\022\033n\332\344\223\331\223\001\206\363\350l\362\354\2740\300\220A\362\206\307\205\021~\227\313\021\316\343\273$A\f!\002~U\374zP$\231J\026\340\367\271\363\356\264'\200"
+	.string	"\252@\302\316!\317\363\304\363\307da\370\242\271\302M\016S\311T\036w\336\024\317\027\206\261\002\213\236\025O\034\330x\263st\3464\341\247\222\001\260\221\005\262\330d\3014\3612\225\313\344\361-\221T\242h:a\264"
+	.string	"\2779\023\240\020\201\344\361M\301\242g\305\363\307B\f\310#O\006\330\370\356(a\340\273\243\204\341\b/\337\0221<\2170\300oN\321\245\200\004\374\346p0\002~s4<y\200\313#R\007>\356|\200\237\314&\222e\0013\225\316e{\035\0179L\245\023~N"
+	.string	"\033_\017(\237\355r\331\303d6\231\256\213\246S\007n2]\026\307w\251_g\017\217f\276K'\374l\237o\013;.x\202/\026\320\204\241\211\234@\202\246\322y\224@\362\205\217;J\370\271"
+	.string	"\370\315\271\271\216\207\017\317\021\360\363m\301\371&\231J\026\027$M\274h\256"
+	.string	"c\205\027\315\025\222L%\213\341\273\\q\\*\217-F\300\316&\212\247\211\235\236\027pv\232\314\267\304\013\037S\300o\013\022\224\200\337\026\220\260s\370t6\341\346\211\345r\304\216\013\024<M\370Y\274\216\007\370}\276)\204\312\3473\005\374\346\270\327\361\360!\206\347\361\304\353\354\201\217/\013\340\362%\221\341\346\004\374\346"
+	.string	"G\300o\016\3605\256\030\276\360\021V\261\002\374\346\020_c\322\004l,\276\306\244\t8y|S\024O"
+	.ascii	"\201\0020\204\210\b"
+	.string	"\274\260\3229\001\026=+\\\200\301\204\212\0171 \233K\022\257\263I\202\230|\036'\360&\233;N\3451\303k\024\302\327\361\320B}\032[<u~:\352S}\2660\316\233l\356\374\340\353x\340Q:\341g\362]~h*\235\315e\023\311>\215\317W\303\323\331\\6I,\217J\344\313\363\024\302J\246\t\236\347\216{\223\201\202b\213#s'\337\341u<\274\316&\322\210d\361\001\311!\271l2 \347\270\343\002\231&2\274Fx\331\363\314q\216\320\201\225\023\300\340:\036\222\313&\003\340\345\b\367\335I2\217\023@\262\300\363\334\031\276\306\t\340\033x\003\254\001\316\340\001\254\001\306\2015T\320d\302\200\225\313cO\007p\222\312\026O\"S\007il\262`*[<\215*P\2640\324!\261\323\3034\252@\321\202\357\227\341\335i2\240\t\303\213d\036U\240h\001\007n\215\316\017H\370\b?\177p\021\226"
+	.string	"\306\311p\201\007\317w\347\310L*y6\212\033\022\024\300E8\003\254\0016>\235\357\262g\001\032\340\343\206\211G\370X\002\351lY\025;M\370\371\334"
+	.string	"\347\034wV\030\211<\256\311c\323\205\026G\016<\317\035\t8\300"
+	.string	"\306\321\351\034\321\001\317\361D\t\023M\230D\211\021\023<\223&H<\223&\210\022H\276\260\263\311\303\323\363\254@\202\353x`\231,\244\340y\356"
+	.string	"S\300\312\026`gS\347Y|w\2240\\\307\303\207\027>\226H.\225=+|$\340\236\007\220\340y\356T\220t\036I\224Pa\301\2210\226<o\n\030\316\343\316N\217\n\235\347q\311\342\b\037Kdp\244\322\3712\337\234\375\022N\030\341\004\024^\270G\241"
+	.string	"$\024\200\204\366(\024"
+	.string	"\004\210\002\234"
+	.string	"b\377\004\020+\fs\200\227+\216Oe\t\t^\3433\347\270d\341M6O\334\344([\034\231\037T\240ha\277\200\303d\001\305\213\346\n\257\007\2241<\2170\260@\376p`\226\b\303\306\340\021>\226\030J\240\370.W\034ah\321\276\3067\331<\001;\233<\277\327\370"
+	.string	"\330\331\344\021>\233\356\013\037S${\216+\366\353\001\245\212\327\003J\025\033\336\316`\362\3702`\251<\302\340|Y\260\350Y\341\005\034t\302(\336\026\312\027\371\246\340\020\003\362\270b\271<\222x\341\374\251\310"
+	.ascii	"\023w^\370\t\343"
+	.string	"9$\246xorzV\274\311\337\023\251\204\237J\370\b\303\304g\023\305\t/|tj\210\001\331\\\"{x\220B\344\321\331\302\b\346\003\234\257\213&\317\004C\370\007_\307\203S\231\364=\215\360\033\003\362\210\202\347\271\003\204\257\343\201E\317\212\235\343\353\204\237\031$\231\357\3724\262\350Y\361l\2350\317\312\242g\305\232\334A\256\316\366\205\217K\315\354q\257\343\301\371.{\222\257\016\222\203wG\t\003\362}\361\na \231/|t\001v\036\341wG\t\177`6wv\232\310\035%\f/|L\032\201\316\343\013C\353\300\314\346\016\013\343\230\\\237\316\236\246\016\373|\341\036\246r\307}&\231M\344\373t\237\312\345R\271\323^\307\0031H,\noX\360,\215\357S\331d\016\227o\013xy4\262@\032\233\316\343\n`R\311\003|>\223J\036\346\333\342u\362T\260\301\361\215\341\b\033a\034]\034\231=N"
+	.ascii	"\\\307C\323\t#\247\351\204\221\023\374\255P.\217$`\346\273\363"
+	.ascii	"\266h\236h:a\344l\200d\302x\262\340Y\026=\240\023C\b\021\306"
+	.ascii	"\367\3313|\237=\306&\f\fa\304\001\001\"\204\321\003:\022\204"
+	.ascii	"0\302,\232O\016\2571\006\344\253C\242\351\204\221\223A\330\001"
+	.ascii	"'\217\320\305\021\206\221\350\242\231d*]\f=\240c|\227<;\307g"
+	.ascii	"\f\307\227\307\b\263`ad\302H\336\300\314\236&\023F\222H\002\351"
+	.ascii	"\304\331.\2160\2027o\016\374<\2620&\227M\035#\274<J\340\342\b"
+	.ascii	"C\202\022\"\212.\232\313\241N\216R\207\230\024\261<:\341\236"
+	.ascii	"\227\351K\212HfH\212H\276\304\353x(\362\270H\344\321\230t6\221"
+	.ascii	"\257\363\267\323d\276I\343\262\271\207\360u<|h*a"
+	.string	"8\341w\347]\276\360\006\234\030\236\307\023,\202\257\321\304\004\316W\311B\t3\337\244\362\307\363\334y\362\344\334\274\360\321\231\3549\2560\276h\256\210\001y\\\256\230\340\351l\362"
+	.ascii	"=\240c\3541jp\2760\362\350<\352 \215p\263\271\342u\026a\236\027"
+	.ascii	"~j\026^8)x\223\315\035}\035\017\037\2127.\232K\243\005C\026,"
+	.ascii	"\232O\343r\251\214A\202\327\331\223|\221M'\217\361eq|.\225"
+	.string	"G\0268/\234?\236\343\016\322\311&\337\027\316\233\027\357\222\247\247\004\213\345Q\347\307CL*},\234F%\317\323\370\302\271\341M*\235\316\267E\323\310Tn`\314\351Y\362p\270\201\337\347\353l\302=Gc\222\251\\a\204\217O\343N\217\023\216\341\345yZ\020|\227G\344\363\007;\337\026L\245Q\371|:\201HgR\271\3032\225;;\006\344\253\203|q\334\331\304'\211e\223\007\351\334\260s$\321\202\207\005\216\362\310\201\251D\276\317\036\343\213\343\216\361\205\023h|\321s4\2768\356\020\205o\262y\302g|\032]\034ad\320\200D\036\177H\344\261\351|-\200D\036]\330\371\302\357N\023\247\207\305\2334\302\033\236:HX\211\"\311\034\261\\6\235\031\236\306#|,\241\342\311\223s\003?\215\310\246\013O\236\034!|\\\256\314\346r\325Y.\3277\331\003+\341\345\321\250\002E\013\301\344\373\362\250"
+	.ascii	"\276OgO\223D\222\331\323t\346\004y\232I\035\r\037U\354\3640\333"
+	.ascii	"\353xx\362\344|h*%\340\311\001\276F\024O\236\034\241\363M*[4"
+	.ascii	"\235<\3735\376\336d\363\304\363\270\342\271_#\261\t\367\034\177"
+	.ascii	"\257q\304\223'G\230\3549\256\320\204{\216\233\230\3149\356\370"
+	.ascii	"^\347\321E\322y\3241\346\034w\202\300\241\021\031Bi\3149\356"
+	.ascii	"\020\207\314'\322\250\344\001\346\034a\200yz\234A\0306\262x\223"
+	.ascii	"\024\\\307\203\005=\306\347\216\322\t\303\023\251\33492a\224"
+	.ascii	"\320\320t\276\026\3109\356\270\327\361\340|_(w>\ba\330\350>s"
+	.ascii	"\21604\225m\213\267\304\013\037S\004\227Md\023n:Q\024\231M\345"
+	.ascii	"\323\371\266`\232\330q\201\302\331\204\233;7;.P$_$\023\306\223"
+	.ascii	"\031\201\367\3313\204\233:\317\022\360\323\331\263\302\373\354"
+	.ascii	"\021\276=\313\243\004\226I\023\313#\254\314Q&'`*w\200\360\213"
+	.ascii	"\343\0160\311<\356\3544\221L\345\316\017\276\216\007\346q\311"
+	.ascii	"c\\6\341\2472i|>\217<\276\247\361\205\217-"
+	.string	",\233\373\205\nC\205\227\307U\371\344Y\341'\361\206\331T\302\314w\007~\366p y\304\321A\302J\027*^\364\0345\300\327\361\360\242\271\302\250A\322\004\314|\231\307\035\347\313\003|\032_4W\260\354\273s|\341Es\205\013\003\221\312\234\246\013o\262\271\343{\032\231M%\254L2\233$Z(a\344\2107\331\334\241\3405&M\274h\256p\223&\336ds\247}\361&\231&^\364\034\211p\222\371\272O\343\233\303<\246\030\362\274\260\n\330y\204\237\2767\207yt\262O#\212\244\222'\b_\307CR\311SB}\032QH*yZ\024\252\t5\251\344Y]\034a\374<\240cd\301\263\fz@g\2104\352 \341&\023\307x\0033\225M\024<=I\246r\002\033\200.\216\025\350Q\221T\362\f\237\314\227g\247I\"\251D\301T\236\200G$\225<\305w\231\303\034\261|[\274K\"\214|Y\260\310"
+	.ascii	";_\236\027\257\021^*a#\263\351\001\245\263\251\303\001\206w\t"
+	.ascii	"\303M\247\016\f\0230\225\307\026\234\315\021\0224\225\3601\305"
+	.ascii	"\213\343\362M\201\003\353\344(\337\t\250\330q\276p2C\n\027G\030"
+	.ascii	"7/|t\016\2239\305\344\262\251\363|\235:\260\021~\237\034\336"
+	.ascii	"\035%\374\003J\220\3415\246\320y\036\235$\222J\036\034\030\316"
+	.ascii	"\267E\023\371:\207.\2160\214\260rG\2714\352<\217N$\021V\356("
+	.ascii	"]\330q\276\260\362\007_\307\303\273T\262h:y\226M'\f3\225M\236"
+	.ascii	"\030\216\257s\205\361\310\003\017\341c\212\f($\225'\234:\260"
+	.ascii	"\213B\223\347\305\002\234:\360~y`\300\306\337\363\205\217)\220"
+	.ascii	"N\267\311\363b\001Hg\373|\341\243\223-a\002\205S\007\006&\214"
+	.ascii	"\244\257gG\t\344Q\306`\334A&\333w\231\303<\032\227\313\343\316"
+	.ascii	"\023\270<\"\223\357\216\363\310\3541\"\221\307!\354\001\365i"
+	.ascii	"\024\302x\221\223\314\343\212\344\021\230\363\302G\347u<<\227"
+	.ascii	"M'\314l\"/\310a*w\234\307\341\216\363h\204\237N%\013#\263i\\"
+	.ascii	"\036\221\306\246\023F\216\006\030\307\345\2334\3568\217Oe\322"
+	.ascii	"\330\204{\2167\327\361p\364\340i\204\231\357N\322yl\256(.\227"
+	.ascii	"M'0\370|_g\316[\302\305\021\306\317\305\321\271^\307C\317\216"
+	.ascii	"\222\303r\331tj\035$\254\344a]\034a\254\317\267gyl\321^\307\303"
+	.ascii	"\013\347\207\027\316\f0\263\247I\"\370\302\307\024:\317\327\311"
+	.ascii	"\342M\361\302)<\302\307\022.\216)\234@'\214\002\207\311\302\263"
+	.ascii	"\007>\302*\220N\242\023F\221\341\335Q\302\314\236\024/\2347L"
+	.ascii	"\026\336\235\243\023\351,\036\341c\t\340\021>\226xw\216N\026"
+	.ascii	">\370\001;.x\210Me\206\215\316wG\t\017\257\343\001\356\341\201"
+	.ascii	"{\232\306\035\027<\033\2340\001\003pG\t\257\2601\005\t\022;J"
+	.ascii	"x;\221\310\025\351\276\313#R\305\357\001\357s\331\303\003t\321"
+	.ascii	"\\\262p\276-\036\360\"\235M\026\302\344\273\\qd\276.\374\242"
+	.ascii	"\271b}\032\235\357\013\345\t\370\315q\036a!\334\303\303T\002"
+	.ascii	"\223\357\313\363d\341\353xx~\200ur\224K\013\226/\223y\324!\261"
+	.ascii	"\323t\262\220t\036]8\233,p\236\306\235\243\363\210\242\331\302"
+	.ascii	"\371>\203\317\344\373t\276-^'\221\251\334Y_\034w\326w\231L*w"
+	.ascii	"\332\366\205\217N}\035\017\310\017H\026\033\340\346R\311#|w\216"
+	.ascii	"L}\035\017\317\347\221g\247\231s\334aI\224\030\221s\334i\231"
+	.ascii	"\312%\362-\201T\302/3\347\270\223\341:\036\230M%|t\276\313\027"
+	.ascii	"\211<v\3604\"\221G\026"
+	.string	"\276\216\207\017\234\357r\251d\321\302D\243{\035\0170\262\307\t?C<\215/^\270g\347&\006dsi4\2660\263\247\2114\032]\347\313t\3214\032\335\247\363}\3660\215\306\235d*c0\032\333'S\311\3634\032\335\345k4\372`#\374T.\213<0\340\021\222\257\363\250\363\034\341\303\023V\256\370\320\303\314\031\341E\017S\271\034\241\204\023\214'\240\360\342\303\233\354Y\"\231\312\017\316g\317\207\024\340\027/syd\032\223\307\327\251\003\363\030\215\033Z\274N\036\243\261\205\237\312\245\321\330\036\341c\322hl_\017(\237Fc\033\003\262\271\324\260\222i\202\311\002\254d*['\214\002\311\354a!y|S \221#$x\032[\274%\220\310\343f\262\220<\276\316\026~\032\225<*X\274%^\036\0300\030M\240P\001|\221\314#\374d*7l|\200\t\315T\242`>\221\255\222\347\271>\215$B\230"
+	.ascii	"\222\ba\302\327\"C(\327\353xx\366\2548\221,:_\370y\334i\237\317"
+	.ascii	"\327\231L\036\335\267\305q\251\242\207gg\367\030[\274\311g\317"
+	.ascii	"\212\3754\276He\213\267\304\263g\005\3605\276<0`x\366\254\360"
+	.ascii	"\275<0\340g\317\n\367\331\263bm\001\204\021\211<\266.\216)H\224"
+	.ascii	"\030\321\302\327\361\320\303\263"
+	.string	"cl:a\344 \221\307\017O\347\333B\351L\n\3405\246 \301\004\022N\350\341\331\311\300l*\341\236e\363\371:\177O\243\004\257\261\207g\007\330\302\313\236\347\233\202\331T\302\310\027~K\364\360\354\340\274Ff\216ry4\016\2319\312\345\b$\362\270a$\217o\212#|L\372\234O\026F\235\034\245\216\021\211<\006\337d\223\004\263\251|*[\274\316`\2137\271.\217-\234/\3144\221\303T.yv\216*\220\310c\006\022%F \221\307\366E2\037"
+	.string	"?\217\257\013\360\210\344\013\037\223<\021X\276H\344\210\247\222\202\353xx\276\311\346\216\021\351\374\200dA\301\323\030\303\363\270\003+Wx\321\\\021\204\215!D<a\345\n\275<\366\300N\245\004.`\341\367\311\202E\263\205\235\257r\311\243\204\227=;\022\220(1B\005\207wyD>\341\343\212\026\276\345\261E\013e\362\371:\341\343\212\026\302\353x\030n\370\371\302G\027\336\234\243\363\345\3319\016ac\b\0210S\3512]\034\235%tF\354\354\353xx\032\207;\371:_x\251d\301\354\371\261`\321\204{HH\300EsY\274\216\207\017Og\363\311|\237\030\274\311\363:?\300\315\246\363\003\360i\314Q\262`6_\034\231\312\035\034\027\360qE\213\t`\346\373|\235<p\223\t\037W\264\240"
+	.string	"\331b)|\2158\257Q\202\027\351\354i\252p\276\360{\002f\276Ng\017\022\247g\303\200\225\310#\317\221\004\f\347\013\303\307\025D\370\270\202\004\336g\217p\331l\256`d\237\260\363]\216 \361>{$xs\2160\363E:_\0249L%\323y\234"
+	.ascii	"\263\251\204yvz\236\314&\362\202\247\362\371:_\370\tC\007>\256"
+	.ascii	"h1\204\215(\300Le\217\373\346\034\341e\263\305r\371\"\227\313"
+	.ascii	"\036\026\360qE\213\f\260\361\004\0200S\351:a\024L\026\236\317"
+	.ascii	"\027\331t\242\200\237M\024<\317\235\fO#\354l\242X\036\225\316"
+	.ascii	"\367\031|\n)\220\330 \002/\264\260\221\036x\236;\037^\344\221"
+	.ascii	"\205\363\205\231\312\017L\345q\347\003\322\371\374\340\241\002"
+	.ascii	"\347Q\007\251\377\3430\021\372\360\211\246\301Y\"<\022\246\255"
+	.ascii	"\006\231\222 \r\272/MQI\200n\232+\213\027\021\022"
+	.string	"!\023\021g?\200p\210\340\020\301\201\216\241\200S\3448P\034\253\034&M\006\022\216\025\216\021\"\024U\227\034{\004\n\032\326\221\375\343\f\3216\204o>\256|\021R\326\326\265\027\004'\bQ\255+H\225*6\375EFM\033 \3040B)kM?T\302(Q\214\222%h~\020\311\f\227\236\332p\370 \326\r\305b\204\331M\021\327\b\t\"$\205#E\324[\241\216\350\007N\217b\21431\237*\234\2506\0357\215\032\202\303\2438U\366\026c\006\016Tq\207\031\016\256\247\"jZ\227\2169\247\243\fe\227\207\267\243\210d]B\203V\246\211\030ek1\242\324\244\343\n\207\251\270U\304\265\206\223\203\030\305\323\362eF\3268J88\216\263t\234\245\214\263\264\356\355\265N\340\244\264\032'\251\204\2508\376\301A\302\271q\234\244\257>Q\234$\"\033\242\252r\220\223P\271\241\327j\234\03285p\214\316"
+	.string	"@\310\354\016\215\3508FE,\030\2272\266\"\034\033R,K\240\314\371\240\274\205ac\224\302\021\302\021\302\2311%\306qf\340\f\311\220\242\025\301\031\302\251q7\345\002t\"\247\345e\244\261\267\207\003\224\005'>\016\020\316\317\2234\313\f\316\017\216O\227\221\2625\351\352eK\025\230\006\344n\324\334\250\271iS\007enz\223\367\23367l\324!TTln\330\334\254\031\316\235\375\244\3313\246\360@J\333g\316\334\244\001C\241\211\217^\036\236\335o\322\334\265\360\021\244\343\356\006\3156\202\267\224\225i,\301[\242\001\2562/sC\347\363\211c\237b\f4\306\211l\3567t\323!\334\2164\255\351\215\031\243.cS\334nh\221\373\322"
+	.string	"\324\315\230\255%\266\004,\353k"
+	.ascii	"i\3777r7o\231J\f\310\224\030\"\325\020\255\213\312\22707^\210"
+	.ascii	"?J\204\300\300X\031\221\333\203\212#n\261:h`9\372B\204\322Y\326"
+	.ascii	"\234\361\201#&\221\300\307L\225\254\211B\312\240\250\312dM\224"
+	.ascii	"b\253\314\221)q\033N\021n\2615\341j\3431\f\362\226\266\327e\307"
+	.ascii	"\232\235\021-YG\203\332*uvB\266\bs\334\250J\022%\353\037\224"
+	.ascii	"3Mr\254\to\354!\255\034KZ\204FoPtmY\2045|g\204D\001\242&\224"
+	.ascii	"\001T3c\r\2154`\0262\25634\320\312\312\200\214\021\223u,t\237"
+	.ascii	"\230!\303\222\365\215\031\220\016*JE\225B\327d]\021\002\345("
+	.ascii	"/6Be\300\252\237Tn\r\033\331\036\021\t\020\027\333\030\033)\\"
+	.ascii	"\210\214\311:\272\025\307\321a\313\204\210\214\262\233*A<+^\310"
+	.ascii	"\314e]G\304KJ\217\254\243\253ZZ\021\242\260\240\235\216\202d"
+	.ascii	"V4EM\373q\304\212\026X\033\032\243\351\\\326@S68\262f\315\240"
+	.ascii	"<\255e\255\036E9\021e\235#\213n\311\r\224\240\026U\207\217Y\220"
+	.ascii	"\033/\264\274\025\377\210o\236\004\257\020\345 \003\272\211\006"
+	.ascii	"\255\230\r\301u\005\247H\021\2319\312:o\371\b1r\343dx\306\206"
+	.ascii	"\306\rH\326\303\"EA\236\264\202PxLaIe\005\267X\032Cd\354\232"
+	.ascii	" \tb\312\201\206e\244\311\027\222(Y\007\345\302\272\240a\022"
+	.ascii	"\024b\345\004\307\333\022\252\016xT^J\202RF\316\020\231&\351"
+	.ascii	"\242\301\216$fH\206_\304\354\366\200\216\004\233\250|\231\001"
+	.ascii	"\223\265\006\322r\303\351\306*\230c\210\325\220 #@!\252\333^"
+	.ascii	"\222X\021\340\221\347\231\232\225\033\"\3034-\231QW\224\233!"
+	.ascii	"A\245)8bD\271\021B\004Zr\nC#\252D\nV\\\325p/\n\236\225$ \301"
+	.ascii	"\243.<1<n\250\2101\\6\034Q$7?\210E\3040Q?\210n|\020\225\244P"
+	.ascii	"N\346\246\212v<\270\340x\272\221\"6}qB\302\226\365\r\017uo\217"
+	.ascii	"M\034\377\334\360 \016}E\305\361\317M\217\233\250\337\3608q\003"
+	.ascii	"DSD\255fb\272y\322z\313Z\302\273\321\361\233'\247\374%5#\213"
+	.ascii	"\323\315\016/\242\036Ynj\020\2663bM\233-\230\246J\333\036\336"
+	.ascii	"\r\322\r\322\315\222ztDG\200/fwhI\277Y"
+	.string	"\302\261\241\230\240\354\300\241\304\205k\214\321\234\006X\322z\334h\277\344:.g\254Li\320\2701\032B\302\025P\235R\215\337\030\335\024\371\b\023\325\344\246\350\306\006\232\224(6.c?@xd}C\324\242\341a\3712\244\313\276\001\272\001\272\031\302\"\341&\3507C72\220\272\352\260\334\310\270\211\321$\205I\230T\375\221&#\351F\250\325R\217\322\334\370\022e\2639\233\033\037\017\202\3428F\f\303\310\024\330\264\315o|nb4\265)V7qq\217\315\023\r\254+\037\025\025\230XO\023\321V\214\342 J6\0324\305\274*\017\234\270\351\345\335\275\230WT\203\245%\245\006\317\207G\026<\252L\204\fm,\215~\032fYY\te\240j\027\317hU-\t\031/Y?\003;\212t\\\300\304\205\311\372\031\310\261\211\0220]\025e]\234+\316\375d`\202\201\274}u\004\310\232\254\243aMl@\306"
+	.string	"\313\2109\242\344h\"\007\2642\304\262\"\345\211\230\240\217\236\013\202\004\027\006\250\227\305\274\341\305"
+	.string	"S\264\"\226\026\005+\306\r\227\224\340\300x\371R\254\"\214RcH\024\334P\252\335\263\332\242\345\005\230F\335\301c\306\2267\032N\354\306\334\206UYQT4\332\250\250EIub\272\f\223"
+	.string	"\215D\257\bqaB\234\0015\267f\313pHKd\346\344\212m\b\r\200\f\"\2625\340\334\357\307\034\033T\013\020n\0307eS%\313\220\306ZteF\206\332/\221\375\250\004\005N\225\006\313\312\242\030\314\223\034\310)\346\220*\252M\020"
+	.string	"\323\025"
+	.string	"0X@\034\216\347\271\264\2717\024"
+	.string	"\017^\304~lB'M\324(\252\230B#\"\004"
+	.string	"\001\001"
+	.ascii	"\024A\002Q\036\205\361\0327\313\306\270\030\032\341\314I\035"
+	.ascii	"\006\203L!\f\357\277\241\007vr\017q\225Zd\032^\362q;J\335e\366"
+	.ascii	"\312\322:N\363\326\246\030\320\244\357\341y\034\026\nW\013r\370"
+	.ascii	"\371|3"
+	.string	"4\025\250\362A-\2568/\0051(p&\263b\343\031\271l\003r2\262/\355\340\227\314\034\372\303\220\250>\361L\261\341\320\231\341`\304\360\300\277_F\200\305rDf>\034\025\227\023\231O\320M\2475\373\001\fY\035I\342\372\203\002Y\233\304\276#\225\353\244\327W%yb\003\376\3042\212NJ_b\215S\232>\362\247\200f\332\373X\307\f4\375pW\r\242\321,\363\031\312Z\250\t\034\023\311\220\004\203\265\252\231c\340\307\034\226\243\332\333\247Qi\335K\b\034\256\026z\214R\2360\324H\300\263f\350R`>G\252\n\332z\334\360hS\237c\222\025eJi\\GB\347\037\217f\037#\306,B^\267\365\ta7\370^\212O\310:\302\376\213\326k\204\343\320sx\243\354F\207\246V\036d\324\364\b\004\025\004f\223S1j\022&Av\bb\272\025\035:u\34245\336\322\302j\272WciC"
+	.string	"\020\332{=\370\177?\026\337\004\033\376i\034\375D\036\300\200p\2261\364\016\270\276\222w\"W:.$\244\017\350\304\264\200\202\201@A[\030\246`\207\006\022\243\224\330;7\252q\324\375\225R\3117\235\330\334\r8d\214\323?F\354{\255l\357\237\303D\336\017\217c\276\013,\325-\370\340\202\242Y\022\324\253\252QIK\356\025\255}\026\r(\013\331\234\310\026_A\247\035\307\321\246\017&~\271\027[v\006\234\252\275\310\"\346\335S\237\315\367\340K\225\016\017P\347\036\262\337KH\204L\247\347\017\026\r\310\246\326 8\310lnh\006a"
+	.ascii	"/$\323\310\201\300\365\bqM'\263\025;D\024\203\211\025\307\251"
+	.ascii	"\001\206\201\241\217\327\211\001c\3707\016 \205mK\320\re\316"
+	.ascii	"XW=G\364Qo?\r\307t\205\271C\345s\230\344\035\307\032\017"
+	.string	"\244%\312U\205\254\234-\036\037^\332\350\351:[%\2223\320\351\231\206\260\f9\013\347./h]\217i\013\277\356\225\267\246\207F\201\261\327J0\307\374\335\357\307\344q\317\373\243\f\261\303\220\227\275\335)?\267\356\023a\265\350\341\203 N\340\260\207\021<\025l\006)\371D)\266\244\303-@$\221\214\203he\b\006\344\261\f\373\235\351\006$\252\305\025 R\233\361\336G\226\233\024\3210\225\272\r\301\375\033\234\315\333\025\346;\220\210R\321.f\250\275\034\266\301\375\274K;8\305xZuD\212\013\227\2502\341\032\307\357-4\001\036\363\242\343\016S^\0218A\350g\252r\201\262\006V\253>~\252\311*vv\265\245\020>3\017\305\243e\311\0278h$\226\332D\351%\246\276\365\224\216\267\212\271\223\2018\225G\343g\034\234\032\365\301\322\224\205~g\016\302\260r]V\342~\3622\024\246sR\202}\324\b"
+	.string	"\203\001\256\337\357\223\005\003\304C\2673\304g7m\251\354\201G!=\216\027\370\r\316^\256\273-\005=>0\265o\350,,t\322\t\0248X/\033Av\013R\205\f\355\034E\337\360\\\030\372\007U_7 2h\364\360\325AG\211\353\017"
+	.string	"\341me\344B\035j\247'\315\210I\\\364\2176wLp\232\023\233\325\200+\017\220\256\321\211\300\355v\203'\310\233\344PS\374y\371%\365'Z\t\346\207\242\024\321\342\023\205\246\207k\3114\270`\2043kZ\222\367?6lv\276\n\373\0138\350<tlF\0200\025\221tmR]\"\324\332\263\037\374\264"
+	.string	"!]#H\241\331"
+	.string	"\024M\2547\216b\361fK\"!E\340\347\376\232\315DJ\300,\313\02721\320/A\377\3554u\001n.\211p\021}"
+	.string	"%H\331\230\f\023M*\031\245\334\242\222O$a$\237\312-\247\261%\fV\022\007\350\375\036\234\320\244kw\364xc\366\216l\322\313\251\351\\_\021T\301\275Z:\201\r\3743w\342`\260v\221\332\3536\340\007QE\373\350\232$DB|(L\230C\232~V\024\354k\265\323\313\327\224\223\272ZY\255\200\201\005\3751n\313\2529\266&\224\336\233^\f\240\022"
+	.string	"A \b+|\f\353\226\276\243\357Q\335 x{I\270~\302Z\344\334I,~\034Mt\215\324\030\036Y\2276\276\024\310y\261\361\221A\243\t\234\f\336\201\207\227\r$\363\357\346\221ARb\222\205\007\236w\277\250\270\357\021:\352>\027YO\225%\200G\305\030\227\303\345\341\236\244\227.R\002\034|\365^\032v\341\036\214V\330\255\032\360\tg\354\236\277\rr\323P\202\260\213\345\370B_ \205\203\026m\336\303L\362\304I\313@\306\020,\376i\212/\3202\234EWK\2662]{d\233\005\372\220+\346Y\337\267F\256\020_U&\264\374\362\321\303\243X\331=\2712\241,\206=\222\230\330H\276R\302"
+	.string	"\232\352\305\202jo\342\020\3467\345\366SP\223&\355\037\317\352\303k\253\003\b\224Kh\b\230\207\031\366\246\324,\2609\333\344\225\24053\360/\304J\367\343\256J=\f0\262E4m\262\025\304\247\346\347\352\326?\223\233\347\271%\252v\236\330=\\\260\372\373\037\017\034\257\247\231\224-fX\246\036"
+	.ascii	"\256\006\343L\344\232l\364>\277\311\344i!\001\027\364iq9e0\217"
+	.ascii	"\022\264.Eg\024}\374Y#\224yTA\3043Z\372\217\373\020\036T\235"
+	.ascii	"\356\254\215\230'\3166-\270\325\265i*n\216*\307\315\377\341V"
+	.ascii	"_\007Y\233k\240\006\001\034#\031\301\300\035\270\301\364\346"
+	.ascii	"6\032\006^K\335\374\252P=\352\331\340D\373;p0+\342\372\227\232"
+	.ascii	"\2462\242\240\257H\032"
+	.string	"\001\rh4\331N\225s\246\035h\363Q\214\b\254\246\225\275-\222Q\234$\251\337ht\233\340\273\235\272\030\323yn\222^\210\222\354E*\3009:\324\277a\3401\264W\314\257\336\017\2566\355\312\033Y>I.c%3\244\2016\207uu\226\240\324\013~\221\267IJ<w?\260\214\225\232IV\352\003\314\3628\314t\277\021\004Q\275k\272\006.\230V\261<\320w=\377!\202\017<\206\202\300\231\365\030\331P}\223\037f\274\004AiP\226\313\237\305\357*Y\036Id\232r\370\013}iR\327\013U\245\322\t\006P\260\220H\004j\025\246\241\300t\302#'\2242V\341\263-\267\234\334Y\bX^s\337\214E\230\354\322\316d\375\214\250*{\225\204$\277\f\244NV\327i\266\212[\016\207\007T\026\277?\262\242~\204\b\"\200\245\3564\316\374}\346-\266\0314\265\310P\353\034R8\241\340\245\207\332\352\336"
+	.ascii	"^H\277o\"\3704\356\377\263\216\251"
+	.string	"\361Q\037\326dgF\347Kn\337\303\353o\241L\313\215\263\336\306\234\274\370\234\304\353[f\370xPO\346\243Z:+\3542\306\247\357\036Gp-n\240\006\233t\342\354\300\336\357\312D\254;lU\246/\025\232\350\375\207\004\327\347\232zu!DH\034^\031\031\305\025\346\007\003\346H\270\365\034 J\202\3727-\225\344\027\251w\032\271\013\t\004\252eL\037\002P;*gWX\250jtj\313<\353\245\304\334\352}\312=\232\034\225\200X\264\n\261\274\032\353\267\360\242\214\020U\241\361d@\240\373V\203\337\251D g\031\323\322/\240\274[\200\347\312-\270\f\300\360\316\232\333\217"
+	.ascii	"\032fV\377\031MX\2717\212[\327\237L\221\303\361Z>\242\213M\247"
+	.ascii	"k\206\244\bC`z\001\215>\313q\002\223\006\375\314;\364Tr\347C"
+	.ascii	"t\032m\336\230G\254\357\251b\005\242Y\226\373\251\213\257d\021"
+	.ascii	"v\t1\265\266\225\3029E\352\323\274\353\312K\005\025\204\207\234"
+	.ascii	"k\013\315\337Tx\263]\247\224\213p\031\030\234\373_\335b\304\347"
+	.ascii	"\306g\324s\310\377\214\334\307\024\220\226\204\326\301\036,C"
+	.ascii	"\027\n\363P\322\3005\026\250\002Vi\310]\007\245\216\203Ra\334"
+	.ascii	"/\005>\263\311\005\t\252.\224\022\313\272\221o4\342;A5\227?\357"
+	.ascii	"\234\337\020\244c\222E\263e&\024Oh\233\0079\363@9\020\221\003"
+	.ascii	"Q\3119\021\200m2\306\253U\0237\323\036\273!\205\234\242\372q"
+	.ascii	"b\036\314\222n.<\331\200e\266O\217"
+	.string	"\220\315\036\275\304\001V\257\003Cf\244.#\362\032\250\375\304YF\027\366\222\026\226\214W/y\022%\202s\306B\246\323\n\002\301\231$\323b\255Y3\257z\3658E\322\343\322\314\n\255\315b\034,\350\315\262k\256\321dL\327\017C@+j~VQn\004n\035>\365\355\335\373{Az\226\263\n~\311\302\rqb\363\362\316\3117\325_\335\254\207g \234\241\246\301\222U\351\206\026\226\275\362\272\215\226E\312\371\r\\\\B\241\341Aw\340=%\365\374tB%\346,\351\374\224$p\002\004\026\311 }av\236e]\3057D|\205s\311b\024\020;\251!}Fb\364\260F\004\201dn\020\313<\351\006D.Do$\240\306>F\n\225\030{\027=D\234\177]W\032V]\271\2364\206\2007\2553\200\035D\3469\013\203&\356d2\022\202\277\234~\027f\364\253\016\263\315\020\270[\337\277\223=\2443"
+	.string	"{\322\300`j\243\275=\236\222$\240\364\317\0253q\024\003\377\f4"
+	.ascii	"@\024\211\323\274\267\325\201$#R\361\360\366\f\246\253a^\001"
+	.ascii	"0>6\205L\223\037zA\003dq)\321\365Z<4o;\034\323b\223\027\361p"
+	.ascii	"\"W\277\367\022\315G;|[\r\030\t8\016aC\331h\274L\366\256\353"
+	.ascii	"\017\343\217r\376\243\t\342\325q\302\016\274Yu\220\237\202\021"
+	.ascii	"\231\365\020\330\313\246jz\272Z\225@\325\336\027+0\305\351\177"
+	.ascii	"\263 \301\352EP\206\353\201\017\271,\273!{J\202\212W\305t\024"
+	.ascii	"\177\264\364\374/\330\005\377\260[R\216t\264\314\213\223\304"
+	.ascii	"e\036\034\005\027\002\320\001\362\263\025\254\216\006o5\3602"
+	.ascii	"v\334\0319\366\016TX\345\026g\353h"
+	.string	"\264^\263\274\016\200\361\303\033\301|\253|\357\365L\324\365\223#\251(\216\337D\211\267\300\337\271\367\307!\177yl\340,P\177,\360\234\327ms\376\331\030\n8:\355\372\361~\377\315\314v\344\314\025\355hn\016W\351\2729V5\271\205\276\217t\275\232*=\303\030\260\306\253\007\255\210\317\r\256f\020\323\345<\316\362\034\230O\246,C(d\013\\\264\274j2\254\310\203\024\017t\214t\353\371|\361\361\357\367\254\222\006\353\232A\242\227\222]\"\007\022#\333`\354\023\306\316l\036\255\340\272\200\304vV\317D\323\210,\270,\037a\207_'K7\351\372\f\367!P\351N\227\335\323(O>\t\031\320\3048\210)\213)\003\bX\\iGL.#  \346o,\322G\316A\345h;\2439\322\327\037Q10l>\030\017A\346:\302\311\331&R\335\321j\036\230\255\307\013#\376\256\fD\277\266\t\273\3022\247"
+	.string	":\262_\260R\274=\321\243R\376+\036}KC\031\2019c\031g\247\320r@\304\236\371\312\222\225\267:\016\243;\302\362\234\346\016\211Dz\302s\032\"\036y\301\243\201\241\246wW\202\b\270\230\271\032L\256Y\252\020\347*\336K\016\255$ \251;\202\b|$-`\242\313\344\263\301\244=\220\2029\307+\320\005\031\260\221\317\276\342\203\215\317\3606\240+o\327@"
+	.ascii	"\377\322\334\350\353)\037\016\302\341\206\371[\213\331\2037 "
+	.ascii	"\335\272\004\307*:<Q\\\264\270\037<O!\001)e\004:\316C\316#zv"
+	.ascii	"\211\325]\213\357\336>\003?4\347<\264!gD\037\t\252\274pZ\360"
+	.ascii	"\217@\253\325\305:\236_\005\311\207\212\022\226\332\032\361\n"
+	.ascii	"^}_\241+\304\31504 M8{\254\354\340@x)\030\334}\004\bi\313<\236"
+	.ascii	"\224l#\016%R3\212\270j\277\377\003\3723Jv)\372\033\254\220\203"
+	.ascii	"E\n^\037&\243w\322\251{$[\177\215dq\237(\370\277'%\307I0Y>\226"
+	.ascii	"l@\342\312\314\277tb}\314I\261\314\263U,/1\327\005\271\345U\017"
+	.ascii	"\223\316\321\373y\f\243\005\265\340\027\204\201\253\031\263@"
+	.ascii	"\362\022L\324S\201k\200\261\237\3200js~\344\266SV\326\235\003"
+	.ascii	"N\254(\234\276\340{\030E\311\352\350p\216\034\2740\204:^\257"
+	.ascii	"z\311%\242\213\224\304\232fH\211\310\007\372\214\234{\251 \352"
+	.ascii	"3T]\304>\205e{\336N,\231\030&\251n#\204'E\257\250b\037\214\035"
+	.ascii	"\b1\377\025f\207\353\250no\213MmE\b`<\b\337\003R\262~,\325\331"
+	.ascii	"\244\3162\001\250\231%\241%\275\357Z\324\032"
+	.string	"]D\372\233\326\351*P\260]\336\033H\311\370\034\036,L'\274\344\321y\236/f\242\374\305\b\275l\274\307R\240=\022D\004\223\336^\326\236t\316\327\230A\363XeS\031\020?\335w\203%\2011\352\274\321-q\226\261\305\023\254\\\373\0019\005-\002#nL\205\276\344\207\233\264\005\221\200\311\f\004\026\374\033\003\230\252!%bV~$\njV2\325\002\334niN\206\034\301\253\025\360xM\311=>_=\315\211f\020\235\362\362\300)df{\006\002\220\002\363#D\376\330-\202S\241T\300\266v\262\270j\013\323\344\260\251\331K1\004\314c\222\242\377\211\272\320Y\357\220\346\336\241c\300/\345\275i\311\247\370\213\331\036\352\376\206\nOH>\nI\227\364<\242\320fLK@\020\333c~\206\227\020\004\274\3678]\272\207l\351A\325X\257\213\306\367\037\363\"\340\020c\367<[\223\210,\270\036\350\354A"
+	.string	"\233\265\331K\330W\335\027\267\326\302\377:N:\364\336\264\200\370\235\334\367^\017\305\246\337GB\246\235\345\3559>,]\374\323Q\274~`\331\036\216\336\\?e\256\"\256\005oHt\001\340\253\372\346\233\006\366q\371eDV\257\347\235\210\001\2443\254\367\300\243\333mT\273X"
+	.string	"T^\250%5o~\217=\376\344\277P\324BP\211\034+*\024g\030jo\3360\216\353\240e\341\233!\305\007G\246S.\332\266"
+	.string	"\212A?\340KM\345\362\253z\370."
+	.ascii	"u\223#LD\317\177~\216\360\231\376V\356A7\367bG3#\f"
+	.ascii	"\301\256\302C\246\243\340?\026\345-B\331\241/\357\311!O\240\350"
+	.ascii	"\rv\331\236\003\226p\300\013\3521\346mC\367\215\351\275\227\377"
+	.ascii	"[m .x|q\300\177Yg\234p\214\367\263\\<z\366G\362\375B\334\177"
+	.ascii	"\233\272&\214\024\264\332\247\322G=\217\030c\004\275\260"
+	.string	"\234)E\212\222\334#\216 @\3006\201\177\210\351\266qywWa\022n[\353\3651\b\3541,\213\322\020\225\231\201\255z\340\025L\246\302Hn/\024+\315m\376\245K\312\330C-\266\221/\327\200_~/\231\326~I\217\262Z\345\237\335KJ\037\013Q\234\312\016\320M\236\277S7\255\t\360\342)\305\365\324\n<\305\376\303\036V\216Q\204\002\214\"z\3662\004A\300\213\222Wq\007\234\267\023\031U\236bh\366\202\373pD\003\201?\324\204A/\360W\2375R\007\001\201\200\325\312\301Ab\205\003\353\217\204\367Bk\n\345;{\212J\022\200\275\217\006X\201\265\241\220U;}\243e\366C\317\244&\016OJ?\316_dJ\314\311\345_)\376\255P\033\n\231\246\275\n\362Ze`\224{]\375?\331\344\036\304\357\\\330\227\307\354\261J\374\330\205\017,\202U\213\013\326\n,\254\325\204Dc\352n4\n2"
+	.string	"\321\2110\031\006\340\256t\226\234@T\356\327&\306\274\275\206\221-\315"
+	.string	"\203\211k#\336\331-\f\347\013!N,\206\206\261\213\234\255QK\005\343\026\364\331\230V@\337j\267*\206\202y\237=.\235\036H\002`\004LZ[6\214\n\025%\023Hb8W\201\0348\252\275\254\363Z\024GJk\312\0033\354\242R07\201e\222zl{\216\231d\242\336\371W\361\005\264\372(\205H\231! \217\326%"
+	.string	"[\2379\357J\\\366\353]&\365\347\311\242\3040r2\334\214x(\033\031\341^e\222(\bM\002\242\035<\026;\227\365Y\3420\3013\\\177\311\325\266\320k<\007\303\344\025\216\370\t6ze\301\243\222\343iC\235\257\260\201\201/\031\373uW\200\021\026~\026\272\211\201d\343\030<J\017A\266\335\260\304\334y\22318y;*\251h\357\334\331\013"
+	.string	"\210$\004\030'%\270@\353#\021\236TERP\273n\233\344\373&\323G\237\035\331o\021\334\316\277\2452\2532\016\033\026KJ\313\353\315\013R\002\302p\301Y/\371X(\267@\005\316\300\025\361\250\020K\362\3250\"\3409g^{\032\344\246\326P\364\261j\230\260Fc\314G\245'\372\240\200\240tg\254\354^\273y\327\352%\261x\202N\206\035E\017\263\337\202G\317?\221\235'\260\034\016\231\nv\203O9\256\177\225\303}g}\216\005\022\376\234\362*Nt!\302*\347\342\331\034\363"
+	.string	"\237\264\220\260\375\346\370#\327\024Z\220\201\003,QJ\016\234=\364\031\331\202#_\001D\324r\361"
+	.string	"\300\263\240m\310\002\332\322\317\353{s\374\255\024\t\220\215\030s\\0\245*{\246\317\265\031vR\214&HxC\300v\331s\321(\0071\311\366d!\307v\256\267F+\362zd\360]\225\246\316H\314~\345R'\032\277\327\246\365\231\254Nip\265\273\013\001UK~%\303@\265#\341\244\362\310\365Z\bV\326\022|g\221\031M\2706p\301(^4\3305\227\t\342\245\370\222\240\344\220\335\260N\303\332@\235\276\233\270\217\346\255\364_\260\3773\013PE\271c\273T\004\267\245SU\267\245\272\226K\342\n\276\310\242\346\217\310\273\032\031i\250\032E\205\027\024%\366rA+\354\262i~@\017\372\262\025\002i\030$8.\320:\260"
+	.string	"\301\025\315\360\025$\272\310r\333<\377Y[\255\032\211\177\372\274&Y\366U5@\210FM\236\247\211^8w#\034<\007\273X\307\020\236\302a\355\003\356a\033\343?\373\222\372.yT{\361Z\326\313\317\372x\225\376\003\037\306\245l\331\243L\207\374\264\214nKg?J\265\345:\036\324T!\203\034\233\342\332\236\024\2441\364\2124\rW\235 \363\036\323\267\217\372\023(X\017\\\212\b`\230\335\340Hk'8\333\035/ `i^i\365\035\210M\024\303\204\007\366\002\351:\325,ng2\272\352\b\027\347E\334x\343\031m[ui\357g\353\026A\214\247e\235\237\304\032\354\225\006z\201\\\372\236{\206\025\211\235Ou\345\367\300B\222\023\303\370;\003\221\2125\311_T\317n;\217\332w|\t\265\350\225'\370a\216L\201\347\227$rV\306H\007!X\307t"
+	.string	"\316#fNe\326\254\217\234\224Dz\335\007)D\022\245J\302\022>\306\254\344\345\326]\305lI\035[\365\302\036\336I\262\214K\301\036\370\013\354`&a\347\270\333\327\037\254\361z3Z\264\216\323\270\342\241\366\022\027\004\227\233x\211\3062f\262t\f\362\202\031y\347\215\200\243\023%\013\241x\325(\271\262\267\331\307M\352\333\230\307\341\222\002\351\214U\207\0334\202\030X\254\274,\034\320\333\262?/\306\2034\260O\330\367\314\3231\306\030\022Wv\016z\224p\202\270\262\246L\236\342\003\204\037\322\236\370\243\354\325\243\013\272\321D\372\341\313c\331\2315\"{lK>F\016\201\n\352\035\216E\331\254#\2661Q\362\016\267\204\203jF\264%\350\346q5X\324\300'd ?>q\304De4\221\031w7\220\033\265\272\303XT@"
+	.string	"\320(\363T\331cx\366\265' \035\023\177\354\241a\331H\333(\340\033\266\315~o\f\346\3665D@\216\031\227.s,\227\310V\370\020\236\305\21297\030\036\274\017\336\227^J\3429=\261+\322>\323\203\367\266\313D\326\004\204;\205\032\241d\032\355N\262l\026\215$\026\251`2y\036r\311\216\337\017\\B\367\205\026y\353\363p%6\264\220b\254\3358\344\253#\226;I\r\220t\231k0\362\262W\360A\321\003)\207\235~\244\332\340\237\342\376\233\277\372"
+	.ascii	"\256\004\303(\030W\b\257\242=a\317_y\306\302\t\342\376Y3\025"
+	.ascii	"z\213.%\232/\304\266\241-L\210=\027\344\037\300\205p>q\220\232"
+	.ascii	"\320\231y\3655Tyc\343\211Z'L\370&\200d\365\232\225\302\215v\027"
+	.ascii	"\333\353,%\332\003c\276\355\350\371^8V\257\364\350\375\006\201"
+	.ascii	"gF\315U\203\226p\337\362\336\202)\253g\331\240K\300\370<\255"
+	.ascii	"\252\020\340\220\327\311\"$\374c\214\215+\020\317P<\200\3103"
+	.ascii	"\036\007Z\341\360\022\261\214S\334A\035\231\300\276$\235\302"
+	.ascii	"\211\215&bd+z\203\227`O\003\355$\214.\334\337\211\320Z\004\202"
+	.ascii	"\361\304\331\222j\220\001\355#\254x\250L\332\352\262e(\200l\033"
+	.ascii	"\237\024\243\030\245|\272O\356\364\325K\177\022v\236\004BM.<"
+	.ascii	"\256\214\001\267c\225@\027\354*B\3670\267\357~(\t\265V\037uv"
+	.ascii	"$\220\305\261T\2426\225<\327\304(+@N\315D\354\305!\377b\245\t"
+	.ascii	"_\227\257\240\fA\035z\212\272\315n7\202\217\214\217\207\006\330"
+	.ascii	"=\224]|\235a\205\257c.\371$\375\257\261\355@\240U\02247\220\361"
+	.ascii	"\332u\346\326\247$\323\366\365\016\n\315O\234\243\367}\352\224"
+	.ascii	"\262\232A\305\257L\363\322\314\004G+\272n\225\251\370O\213\017"
+	.ascii	"\276&\037\321!\213\024\306QN\344\251gA:\211Z\r\215y\007W\013"
+	.ascii	"\242\323\220\340\321,\274\240\233\265\243\005\354\004\022\221"
+	.ascii	"\210\0321Xr0mU\212w\276\222h\262''\267s.TdO\033\225\231\316\307"
+	.ascii	"\333U\357\302"
+	.string	"~\207\233\325W\231\204i\206\355JIc\027\005~\316;Kc'YA\"\036\377\206\364\337\031\300#\336 \237;\3310\346\265\330:\371\363,N\317m\352(&\206_r\326\357\301\n\337\031!\nK\342\344\210}VL@Ni\037\024h.\264\235A\357\3723\302\331%\345\342P\215\342 y\030"
+	.ascii	"\307`\366\004lN\032? \020\253\372\323\301\336\241\027\310v\013"
+	.ascii	"\350\343\241\202\236U\350\221\230\366\276\r'\016\002\036\273"
+	.ascii	"\001\367t\332\021[#=\355\255\b\374{\256\002\200\264\353*\r8\n"
+	.ascii	"\302\3507E*\222\252s\243\237\257k\336\034y\263\027\276\025\245"
+	.ascii	"nZC,\361\t"
+	.string	"\373\005\206\016\001\n\346\322\246\201\221q1\025\344k}\310\203\020\216e\243\256\310\017\302Xr\206\317\332=rn\351efw9\257\212]:\251\003=\333\247\307a^\333\203\237\314\334\213'\372\3321\300*\240\314\253\231\026\354\216\234\377\006\300B\305\250\007/0\037\221\222\34693H\274\367B\310\244\032\215/\337\352\260\343\314}\222{\227A\220\221+\265\n\317E\342\t\225\260o[[e\321\035X=\252>!m\2456\232\316\276\224\327l\317\344p\270d\rOP\303l\217\236Dg\264\253\022\374\314\247\231\276te\037\344,\021x$\271\246T\355\332\345\2741]+\355\236z\r\353W\025\022\020\200~\003\262{\"2\206V\353\035\336g\225\216\213\220\215\021g2\301\240\316[\312\337\236HU\337~\305l\036\301\027\345bG\265\2371\244\2272\315\030>Q\220;\343\b\034\352\362\322\357dkn\324\263Fj\310\2254u"
+	.string	"\325P\232\376\231\324:\313\2250X\310k\231\252\274(\222\344\\K\t\255\222\270\240:o3\354W\004@\245\245\310\313\006^\216h\306\r[\342\212X\033c5-\353zt0\3743\272\252\354i\366>\231\341J9\220\3726\356\fnG\363X\314\276\377\364\213w\350\027\\j\273S\353z~(\251\214U%\351S\035\235\317H\026Z\304\002\276Ve\217\037,\260s7\206z\\m\033\235B{X\241\202\024\243\365Es\254&\317<8\325\240\275ek5\307\230=\306\017\360\025\356\221\030Y.\232\213\322.-\315}^\340\"$\227_\252\017\212\001\\\270\211\325\2231p\236\230-j?H\377\333\206\036r\203\231\214\332EV\250Q2#\324k\355"
+	.string	"\b\271\317\326)\242\\"
+	.string	"D\253\257\202\260\211(\257\213\362?>P\371\037\313\213u\302|\326lG\263\3568\341n\220\203\3434\315\204\242\032\375\202I*${q\303\347\365\267\200W\366n\304\027\221v;\242\362\205\013[\032\205)6VU(S\227\257\026;s\0238\317d\203\312\246\031\217\271\374'\347\241\301S\277\265\033\007\337`\b\326\001\240\305[\307\3105\256\226\200\332\222\317z\bR\301"
+	.ascii	"\016\375\215\212p\302#\t\f\347\005}\271\004Hy\377\026\3443\325"
+	.ascii	"\273\242\331\032\r\3229\272\030\003\330\016\344\343\377\202$"
+	.ascii	")L\330\251\031\356\364\nu\313\232\022\263\205\216\251(\005D\177"
+	.ascii	"\025\331\320\226\204\265\220'O\323\"g\335\004\300\246\374;\340"
+	.ascii	"H\362P\262\032\340\206[*\r\036\306.\372\371=\316\204S\b\266\337"
+	.ascii	")\025`E)\207\n\036J>r\377\277\374\272\225\307iP\264z\n\367\243"
+	.ascii	"\260$\301%\016J(\317\031\003\320u\216\267:\024\312\321\244\013"
+	.ascii	"N!/S\301\323\003\017|\216\272\230\\\234\323t\224\006Q!\351G\325"
+	.ascii	"\225\260\304\356\256\335\353\020Q\321\212\007\34340\217wlC\035"
+	.ascii	"\3508\315\224\270\347h\331\256\306b\214k\340}\037:\370R\021\225"
+	.ascii	"\300'*t\016Pi\020\020)\202\274\347\222j\263\317\205\002l\034"
+	.ascii	"TN\336\275\325\375\210\374C\356\314Ej\232\270\325\023\321\326"
+	.ascii	"J\007\213\242D\220\031\277c\022\337\3150G\207\341\251\221\363"
+	.ascii	"\200\307\214\325cG\200\003\376\323\372\035\006ovz\246\352\321"
+	.ascii	"$\200\204i\363\322m\030\252\306\226\357\016I\333\225X0\377\026"
+	.ascii	"\235\177\265\243\344\f@\305\227\307\220\351\347\334n\256-\222"
+	.ascii	"\276\221{\232\003\364v_[\266r\224g'\341\n23\377X\322u\002\337"
+	.ascii	"\273\\\225\315\265\2008`\f{a\207@\352\305\002\234\376\025\364"
+	.ascii	"\331\206n\302\013@\307\350\3246\354@!\262\035\034\037c\005W\351"
+	.ascii	"\311\364\373\017\261\310\242\327\031\235}@f\260\377`{o\244\307"
+	.ascii	"\315\030\363\263&\\~ t\rh#\324\035~\230\252\224v\311$4\375\277"
+	.ascii	"a\257\300K\235m\301\206\336\223\353\004\371\345\354L\262\243"
+	.ascii	"\274\215\277g\327)=\377\034i\311PE\002t\271\3434\231\320\221"
+	.ascii	"\344\370\320\305\342Q\311\307\001)\306=\322\361mc\345xr}\233"
+	.ascii	"\035\253\231\266@\006e?\225\005\357\345\021:hj\323\216k\007h"
+	.ascii	")\027Z\215I&\"\021,\307\215@j\212"
+	.string	"\025\263\202QA\271J\3333#\022\255\031Rp\224\023\341\300sL\ra\377n\235qSR\2078%\365\235\205\230n\225nW\310\215\035\3069z\373>\374\035\272S\b\216\r\003\326B{N\034F,\350w\360\320$=%\023\366^\322\310\256U\370\337\330\260RqK\037\025\035\023\354H\n\025\327\274\273\030[\266\200\233\374\274\365-\202\013~i\343\305\341\245\204\rx\322\017\243\007\304B\341\274\302\327>U\307\\\230\206a\214S\356\255_\377 Y1\226`b\324\305L4EO`\302\202\357\216_k\204\037\320\323fR\"nH\017l\245\034\265\312\377\006\271v)O&\335\027Z\277h\336\262\273\311\024\030W\324v]\335\273q\2434\244?S\360h\241\214%e\320\2667\rw\030\301\334\025\364\214Nt\236\330\032\323\260;U\373\034O\315{i\202\272\235\031p\027~<rS\316\233\202\314\016\021\003\310\251\205\277!"
+	.string	"p\017e\226\373gxX?\211\036\257\244v\005\362\315-\301\251\330\377.~Y"
+	.string	"s\320r\004\322]\353\321\2152\366\203EP\242C\273$ty\370W\231\303\373\341>\332\007.\203~\037\"\314\304#\023\266\333\324\356\340\\-\006\260T6\253"
+	.string	"\237,\227\326@\334Y\255U\036)ScaE\016\244\030\204\203%s\022\340\310\005\037\321\223\032ew\004p\340\027R\\}\022\360\r\245w\033\250[\033\237"
+	.ascii	"_\f%Gk\321\304l\271\246\246}\311\005\003z\315`k\374}Q\223!F\314"
+	.ascii	"\f\376\2609\"\201F\202\374\026\035U\343\214\342\375u5\335&\225"
+	.ascii	"t\243*JA\231\323<x\217w.\377\352\315I\316S\034f8\360\032)]\262"
+	.ascii	"I9\347\035C\234S2\326\301b8\213\265\323@^o\253s\271\002\253`"
+	.ascii	"\305\323\353S^\253\202\205,\022\234\232\346qnH\030N\0167\376"
+	.ascii	"\245n\277\0329+p,#\353\007\340R\031\354#T\257\216Y\f \013w?\033"
+	.ascii	"\350\\\177\246\037B\305+\236A\001\360\357p\351Lc\367\022G\031"
+	.ascii	"\307'*\351\210\\b\265\003\245\016\r\214X\355\262\244I\374a\377"
+	.ascii	"\201\017s+\305\023\301\233#\373W\251\244@b\227\025Q\026BM\262"
+	.ascii	"2X\331\233\302\243\355'\315\333v\265$\241B\016\347\003<6B\226"
+	.ascii	"=\237C\335\277\t\317\221i6\036j\374\321\024U\252\324\276!\220"
+	.ascii	" A\260\004'\006\255\350 P\026d\372\004(\214\370ND\222\367\"+"
+	.ascii	"\307\337\324\333>\fzF1t\347\346\223&\353\037\022j|\345\332\246"
+	.ascii	"\372\330\262\325\346\302\220v\274\305\3446\013\214z9(\336N#\211"
+	.ascii	"\007\205A\327\224\374 *\211"
+	.string	"\017 P\243c+\035\334\375\230\251\024F\364\316k&\241\330\230!D\327\310\244mZ\263\253\341\345\320\245\343\366\035\213;\301\261\346uH\203B"
+	.string	"E\224\220\353\202\374*z\032\220\321\263,\205\3614:\026a\270'\265*Ir\335x\003Kj\r\363J\244\013\005S\006\230\375\236L\026\341\fm5i.\366\331&\241J\333\0014\332s\313L\343m\222\357g\003\003\037\00127\250n\225\376\n\245\200\301\367\370\356\300\323!\020>\272LB\274k\301\325\326\347'\263\3636\n2fI4\316\377Zt\"\264kU\305j'\236\347p\372zfe\"\352\322\006\372B;\323\206B\325\227\2517\256n\206\357\276\312a\236!\265\232\234/*~\004\201\240\344\302\362\272\037b?\246\251\n>\332\251\376\033\222\377\235\215\2662"
+	.string	"\245\360\n`-\363\224\023\0171\370\314$`\324\220\272\225X\217\036cu\007\202L\366\300\214\027\332_ \215S\315h\312\207\311\237i\020tHB\036*q\r\255\215\347\354\035\357\022\356\217"
+	.ascii	"\266\007\026\212C\017\367\017g\203j\246a\022\027\f\217$\n\340"
+	.ascii	"\200gvmr\251\024n\212\017\377\005\315\255\262)\221d\366\026\033"
+	.ascii	"\245\217\f\275M]<\335\f\342{qr1\217\214\030\242bN_\231q\221\374"
+	.ascii	"\377\216\2001\"t\374e\311\2745\310\316\034\216\334\317\027\303"
+	.ascii	"\277A\352\036\030N\364{\310P\344\2758\206\266\357>\232$\252Z"
+	.ascii	"t\024\004\0051\275\346?<\223\324\241\201\203\210\013\322D\035"
+	.ascii	"\336\037\020\022Y\341LH\367\307\222M\037C\271\273\340S\357\247"
+	.ascii	"\334\344\325x\033\007f\331I:w\335}a\342\251\f\002\352\021\214"
+	.ascii	"\356]M\365\316\2649(4XaIJ\177\310\311z*,A\305\026\322?\200\207"
+	.ascii	"T\313\334D\247W\240\237D\003RklUwb\311\277\212_\353=\305\225"
+	.ascii	"\3251\317\222LY\337w\255?\211\ri\b\333\3723\267dH\364\026,\246"
+	.ascii	"I\020ZuN\355g\354\230LY\243T\245X=A\377\367N\245\202U/\277\035"
+	.ascii	"\202<o\006A&aZ\245\201G\345\355\330M\225\3021\241U,\354\303}"
+	.ascii	"7`mf\330\342=X\276<\236\305\005\345\311&\215\357\037\350\350"
+	.ascii	"\356\007\263\306\275\321Z\314\"\2161\203\253"
+	.string	"O\005\331G\216.0n{\"%\347L\333\204\227\003@r\254\r~\344\364-\253\320\314\003\355\251\2373;4\"\273\251\362V\360C\013{m\275\025\327tDn:\222\267`]&5\360\326\240\001\363\224\030\370\271\374\337!\274 \016\362\203\224\214YV\234c\261Q\"3\320\342\327\255\036&\353\021\273 \220\347\374l\025~V6w\216paN\345\342J\311\337\361\240\336H~\r\333\312XZ\346E\266(Z\357zP\356|\027Z\023\310\261\345O=a\225\022\242\327\177\372\231=\237\360[.-;\307;\375Nl3)HOeh\002\221\227\363\324\203\323S\006\350S\342\222K7Y\342d8g[\217-9^\203WsS\357u\324\374\227i\270\364\202\271aG\264\331\035\321\253F\030\217A\350\271p\303y\362\345@Jh\230VnKiS\332\335,\320 +w~\356\234\344\2110\312M\331\277\177\351>?\315\025"
+	.string	"/\177E\334\007\271e;\027d\334\332a\301\345\02545\217\300\3538#\334P7`\247\347\355\331\362\312uO\233\327\030Czo xn\316\210\2741\006\311\177\034m\374\377\212e9\036\225|C\\\361^\342\360\003;\340\032=_!G9\226A\224cS\002\350<\317\003\213\205\220V\002\371:\016o\261M\231\341`P\002\270Q"
+	.string	"*eP\bX\037\356\233!\360\024,P\336E\3570^\235\272\317\001?'\310r\031\\?Q\324\007#\277/=?G\234[\321p\275cGF\371\217\270\340\256\377\321\364\223\243\023\376\320\343:"
+	.string	"\204n\276\r\327?s\230\356\247\256}raW\304\356\221\337"
+	.string	"\373\235:\003|\217 \376\325\234\030\274\337\315!oE;\371m|\fi\2222'\202\t\270\303\367\007\261\347q\370\027\272\277t\t\314\271\t\306\\\224\036\037\365b\273"
+	.string	"\261\257A\263\205\324\267 /y\221\227\036\204\355q\210h\035\376\036\233\2155\271\254\2427\227\274\203Y\344\305A\003\372Y\210a?\003\276L\375\355\337\301\231\254\242z\217\235~n\022>;!x\030\020\337(m\300'\275^\ttx\t\357!\004\260\327\325\233\370\317M\220\247e\375"
+	.string	"@6\213GO\203O\327?\037\333\3651\215\032S\037\030?\237\211\363\360ocTh\266DH\315\233\215>]\364#SnP~\207?\314W\342\376\006E\207\314\217\223\3441\354o\257\202\377\204\3119?\355\323\276\016\315\313'\265%\217\364\007`\375>\306\023\\\2108\277\343\361A\326'\315\377\350\027<y\020\205_f!\336\f"
+	.ascii	"\205?Bw2\322\366\376\177\244\272W2\363\364\210K\325\356\330\263"
+	.ascii	"\211\216\275\034s\021\257\346\3518\235\351\300\235\254\031S\344"
+	.ascii	"\217\277\337\270\003C\222\252#\375\232\024\300\252\3046\215\234"
+	.ascii	"\241\327\272c\236h\201n_J\352\265\017\275\267\365h]\347\201\001"
+	.ascii	"\370<\033\221,g'L\374F\310\\N\373\222w\262\251HG\241\303\351"
+	.ascii	"6\226\3547\364!\272\f\371*\256\337S\270\346Oh\334&N\270]>\237"
+	.ascii	"\347\220\322#\220_\355 \257\\\"\341\377\275\246\3478no7\266\032"
+	.ascii	"\303\307U\021W\223\213K}JP+\371\302\317\320\324\231\351\274'"
+	.ascii	"\263V\267Qj]\317\337Bi\254\343,\\\266\030\346~\342\240\360\254"
+	.ascii	"\223\334\352\376\231\0377\006\t\364_7\203\375\323\276\3569-\326"
+	.ascii	"\307\260vALF\241\237n\002\316\353Du\325\254-\0062{\2317\331\241"
+	.ascii	"\316?\350\235\373\005,\327\033\351g\375\367\365\365\362k\227"
+	.ascii	"\323\031\177u\242[\363\200\241<`\351\375\035\342\261\276\027"
+	.ascii	"\321A\376\257gf}\002z\205\354K\366d\t\274\257\360y\021\332+\364"
+	.ascii	"z\t\350\347\031=\260\362e\214\262\214\342\023\016\273\276\302"
+	.ascii	"M\244-JQ\214\330\016`\356\266c[\312?\206`LI\314/~\253\037}\210"
+	.ascii	"\375\254\346\265\0268\252u\272\251\0352\306\323\030\366\237\004"
+	.ascii	"\210K_\243\203\266=W:\247*Wr\376\370\312\224\311\301\t\017\375"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_.symtab.bc614976d68a8951,"e",@progbits
+	.string	"mspFcProcessCommand"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\006"
+	.string	""
+	.string	"mspFcProcessReply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\006"
+	.string	""
+	.string	"mspInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\006"
+	.string	""
+	.string	"specialColors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\006"
+	.string	""
+	.string	"modeColors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\006"
+	.string	""
+	.string	"colors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\006"
+	.string	""
+	.string	"inputSource_e"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\006"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\006"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\006"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\005"
+	.string	""
+	.string	"buildDate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\005"
+	.string	""
+	.string	"buildTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\005"
+	.string	""
+	.string	"shortGitRevision"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\005"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\005"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\005"
+	.string	""
+	.string	"supportedVoltageMeterCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\005"
+	.string	""
+	.string	"voltageMeterIds"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\005"
+	.string	""
+	.string	"supportedCurrentMeterCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\005"
+	.string	""
+	.string	"currentMeterIds"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\005"
+	.string	""
+	.string	"voltageMeterADCtoIDMap"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\005"
+	.string	""
+	.string	"voltageSensorADCConfig_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\006"
+	.string	""
+	.string	"currentSensorADCConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\006"
+	.string	""
+	.string	"currentSensorVirtualConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\006"
+	.string	""
+	.string	"averageSystemLoadPercent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\006"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\006"
+	.string	""
+	.string	"mag"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\006"
+	.string	""
+	.string	"pilotConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\005"
+	.string	""
+	.string	"servo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\005"
+	.string	""
+	.string	"servoParams_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\006"
+	.string	""
+	.string	"customServoMixers_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\006"
+	.string	""
+	.string	"motor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\006"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\006"
+	.string	""
+	.string	"rxRuntimeConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\006"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\006"
+	.string	""
+	.string	"boardAlignment_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\006"
+	.string	""
+	.string	"armingConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\006"
+	.string	""
+	.string	"imuConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\006"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\006"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\006"
+	.string	""
+	.string	"modeActivationConditions_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\006"
+	.string	""
+	.string	"adjustmentRanges_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\006"
+	.string	""
+	.string	"olGates_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\006"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\006"
+	.string	""
+	.string	"compassConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\006"
+	.string	""
+	.string	"gpsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\006"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\006"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\006"
+	.string	""
+	.string	"GPS_distanceToHome"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\006"
+	.string	""
+	.string	"GPS_directionToHome"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\006"
+	.string	""
+	.string	"GPS_update"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\006"
+	.string	""
+	.string	"GPS_numCh"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\006"
+	.string	""
+	.string	"GPS_svinfo_chn"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\006"
+	.string	""
+	.string	"GPS_svinfo_svid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\006"
+	.string	""
+	.string	"GPS_svinfo_quality"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\006"
+	.string	""
+	.string	"GPS_svinfo_cno"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\006"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\006"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\006"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\005"
+	.string	""
+	.string	"failsafeConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\006"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\006"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\006"
+	.string	""
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\006"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\006"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\006"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\006"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\006"
+	.string	""
+	.string	"barometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\006"
+	.string	""
+	.string	"rssiSource"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\006"
+	.string	""
+	.string	"GPS_home"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\006"
+	.string	""
+	.string	"GPS_hold"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\005"
+	.string	""
+	.string	"AltHold"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\006"
+	.string	""
+	.string	"serializeBoxNameFn"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\005"
+	.string	""
+	.string	"serializeBoxPermanentIdFn"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\005"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\006"
+	.string	""
+	.string	"magHold"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\006"
+	.string	""
+	.string	"motor_disarmed"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\006"
+	.string	""
+	.string	"nav_mode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\006"
+	.string	""
+	.string	"sbufWriteU32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\007"
+	.string	""
+	.string	"sbufWriteU16"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\007"
+	.string	""
+	.string	"currentMeterRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\007"
+	.string	""
+	.string	"voltageMeterRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\007"
+	.string	""
+	.string	"getBatteryState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\007"
+	.string	""
+	.string	"getAmperage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\007"
+	.string	""
+	.string	"getMAhDrawn"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\007"
+	.string	""
+	.string	"getBatteryVoltage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\007"
+	.string	""
+	.string	"getBatteryCellCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\007"
+	.string	""
+	.string	"featureMask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\007"
+	.string	""
+	.string	"getRssi"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\007"
+	.string	""
+	.string	"sbufWriteData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\007"
+	.string	""
+	.string	"systemReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\007"
+	.string	""
+	.string	"stopPwmAllMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\007"
+	.string	""
+	.string	"rtcGetDateTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\007"
+	.string	""
+	.string	"blackboxGetRateDenom"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\007"
+	.string	""
+	.string	"blackboxGetRateNum"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\007"
+	.string	""
+	.string	"serialIsPortAvailable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\007"
+	.string	""
+	.string	"findBoxByBoxId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\007"
+	.string	""
+	.string	"rangefinderGetLatestAltitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\007"
+	.string	""
+	.string	"getEstimatedVario"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\007"
+	.string	""
+	.string	"getEstimatedAltitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\007"
+	.string	""
+	.string	"convertMotorToExternal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\007"
+	.string	""
+	.string	"pwmGetMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\007"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\007"
+	.string	""
+	.string	"gyroRateDps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\007"
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\007"
+	.string	""
+	.string	"getCurrentControlRateProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\007"
+	.string	""
+	.string	"getCurrentPidProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\007"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\007"
+	.string	""
+	.string	"getTaskDeltaTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\007"
+	.string	""
+	.string	"packFlightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\007"
+	.string	""
+	.string	"sbufReadU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\007"
+	.string	""
+	.string	"getGyroPidDeadlineInfo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\007"
+	.string	""
+	.string	"getTaskHistogram"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\007"
+	.string	""
+	.string	"sbufBytesRemaining"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\007"
+	.string	""
+	.string	"serializeBoxReply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\007"
+	.string	""
+	.string	"setRssiMsp"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\007"
+	.string	""
+	.string	"rtcSetDateTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\007"
+	.string	""
+	.string	"sbufReadU16"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\007"
+	.string	""
+	.string	"serialFindPortConfiguration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\007"
+	.string	""
+	.string	"featureSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\007"
+	.string	""
+	.string	"sbufReadU32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\007"
+	.string	""
+	.string	"featureClearAll"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\007"
+	.string	""
+	.string	"GPS_set_next_wp"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\007"
+	.string	""
+	.string	"disableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\007"
+	.string	""
+	.string	"runawayTakeoffTemporaryDisable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\007"
+	.string	""
+	.string	"unsetArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\007"
+	.string	""
+	.string	"disarm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\007"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\007"
+	.string	""
+	.string	"blackboxCalculatePDenom"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\007"
+	.string	""
+	.string	"blackboxMayEditConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\007"
+	.string	""
+	.string	"readEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	"writeEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\b"
+	.string	""
+	.string	"accSetCalibrationCycles"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\b"
+	.string	""
+	.string	"resetEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\b"
+	.string	""
+	.string	"pidInitConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\b"
+	.string	""
+	.string	"pidInitFilters"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\b"
+	.string	""
+	.string	"gyroInitFilters"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\b"
+	.string	""
+	.string	"validateAndFixGyroConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\b"
+	.string	""
+	.string	"resetPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\b"
+	.string	""
+	.string	"loadCustomServoMixer"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\b"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\b"
+	.string	""
+	.string	"convertExternalToMotor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\b"
+	.string	""
+	.string	"initRcProcessing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\b"
+	.string	""
+	.string	"ol_flightplan_load"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\b"
+	.string	""
+	.string	"useRcControlsConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\b"
+	.string	""
+	.string	"findBoxByPermanentId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\b"
+	.string	""
+	.string	"rxMspFrameReceive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\b"
+	.string	""
+	.string	"copyControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\b"
+	.string	""
+	.string	"pidCopyProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\b"
+	.string	""
+	.string	"changeControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\b"
+	.string	""
+	.string	"changePidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\b"
+	.string	""
+	.string	"initActiveBoxIds"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\b"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.bc614976d68a8951,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
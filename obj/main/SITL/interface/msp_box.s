@@ -0,0 +1,841 @@
+	.file	"msp_box.c"
+	.section	.gnu.lto_.profile.93c42762a62334e7,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\007"
+	.text
+	.section	.gnu.lto_.icf.93c42762a62334e7,"e",@progbits
+	.string	"(\265/\375 \256u\004"
+	.string	"4\007\242"
+	.string	"\f"
+	.string	"\317\225\334\332\017"
+	.string	"\001\240\342\234\212\n\002\275\351\217\277\r\002\002"
+	.string	"\002"
+	.string	"\003\224\235\3043\004\233\217\325\320\n\005\232\303\344\257\001\002\002\001\002"
+	.string	"\006\356\225\345\247\002"
+	.string	"\007\332\273\273\214\001\b\350\262\252\277\001\024\002\002\002\003\002\002\002\004\005\002\002"
+	.string	"\002\006\f\252\320\264\320\f\n\002\007\002\007\002\b\002\b\002\002\007\017\316\270\307\242\006"
+	.string	"\020\240\342\234\212\n"
+	.string	"\n"
+	.ascii	"1E\343B\312-\021\325\347s\261+\256\022%;.\026g\336\267\001,"
+	.text
+	.section	.gnu.lto_.ipa_sra.93c42762a62334e7,"e",@progbits
+	.string	"(\265/\375`)"
+	.string	"\365\003"
+	.string	"2E\r\022\260%\351\f\3030\254\250\270FCvob-\3312\245\222\350\362`\212\303\256\273;\252\214\353k\023\004H_\007Qx\217\251g\036\355a9\200\220\267\311\222\023\002! \260\002\271);\231\300\2247\0016<X\367?\230j\f\373J.\233#m\002U\002\256\334R\224"
+	.ascii	"\226\3038\b+7\220\0056\223\001l\b  H\341\227\257\346Y\013\004"
+	.ascii	"\036M\006?\306\002\\\f0\340\342\r\001"
+	.text
+	.section	.gnu.lto_.inline.93c42762a62334e7,"e",@progbits
+	.string	"(\265/\375`E\003M\r"
+	.string	"f\321>7@\217\322\030\216h\001\260m\226\330\225"
+	.string	"\321\246*"
+	.string	"\216\263ow\223\267La\320\331rt\200\326|\346\350;\371\200\252\336\352\243x\n\227\005\240b\311\223\356'mo)S,"
+	.string	"0"
+	.string	"1"
+	.string	"\272\202\240j\316\251\215\t\255\312*\365\002\b\355\312*\365\322\336\275oN\374\375\354\234sf\3570\347,\375\276*@\2249g\3465G\204\032\250\213\226\226H\311\341\020\300\354}\372\372\211\"\250\212\275\210\034lF\013\313\220 )8\263\367\351\204k\331\336\347}\033\374\370v4\336\3015\253\032\335\322\263#-)\250xW\312\336\263\231U\017\335\226\364k\243\016\335\266AA\331\266\fc X\256\323\300f\323\241\352\234\270\243\215\235\2600\224\202\264\001\277\276\367\315\265\026\326\304\262\n\341D\320eb\343\201\340"
+	.string	"i\360\261\263&\025\037 q\311uK.\001\262\\'\330.\271%\367Y\213\222)B[\006F\250\301\035C\252\202\032*\254\263\254\001`\"b\250l\007\022 U\025\001\nb\312@\201\021\f\023T0q\225\265\260\334\351A\345\177\350\263\263B"
+	.string	"\225\335\004\217\221i\fF\375ZH\006\274\200\221fKv\363\254\241\006\355boj\332\007\354\310\204\344Bq\331\335q\253\305%\203'\256\020~\333\262yL\f6\303\201\342\361_{r\321\032\371\260\365\320\322\260"
+	.string	"p\300\361;\210\353H\221\356y\003\202\312m\036\206Ts\232\342\023w\320\025\264l\207\271Z\230\202O\317\300"
+	.ascii	"\226\r\317\331\310R\n\020wR\221\2172! \320\006Tw\327\004"
+	.text
+	.section	.gnu.lto_.jmpfuncs.93c42762a62334e7,"e",@progbits
+	.string	"(\265/\375`\236\006\215\r"
+	.string	"\306\2204,pW\205\016\374\307\032\002\002\330\177\255\003"
+	.string	" \002\240 t\177\333\256*\315\372?\330E[\002h\273\210v,\033X\324\b7\332D\246\035$"
+	.string	"$"
+	.string	"0"
+	.string	"\327c\264\213\257\301\302\252\230\364=\253\265\326\276\303\020\033\224\017\312~\241\342\350\306\321\247\250\204U\357\337\341&\202\033|\301\375\006\360\216\272z\027jgN\336\234\354\237\002\364D1F\017\370\245\351n\177\356\361|\t\331;\254\030\b\004EY\326db\261dY\245\222\311\\\227B\201\330h8\034TFe\013d\373x@ \221\210Dr]\227\013\006\323\346\344\242\206\037\274\350\3769\367\302\331E\333\267Z\235\302\235\233w\213\326hJ\241dY\"\321~;MU5\302-\242$\275\301\220\271\331 \036\016\001\200\212\250\001\311#IJR(,s\020#\021\252\315\001\022"
+	.string	"q;\006c)\242\210\200\020\"\314\b\b2\241^j7\034C\354y}ge\343\262\352\262\230\307cP\205E\016\204\024|q\2059Q\302\261\002<\324}\031M,\311[\035Z\254\006\362\303\214\0221\204\275\037\005V\006\0310\210\355\255\360\330\251\277%9%\341\272\312\350\371\244\3606\365,\327\371\320\007\214\372\306=\306\207\302w\"V\"\017\364\035\261\200\213\313\b\006\001\013\025\202\200\210O(\344U\251"
+	.ascii	"\311!\346\245_\006n\210}D7\242y\207\260&Vx\261{\304I\206\271"
+	.ascii	"\263\370\031\030\2540o\225\257\245\263\356\364\316\365\355\342"
+	.ascii	"TJ \362 \005X2\335d\352((y>\336[*\215\024\205\350>d(\301\367"
+	.ascii	"\227oe)g"
+	.text
+	.section	.gnu.lto_.pureconst.93c42762a62334e7,"e",@progbits
+	.string	"(\265/\375  \001\001"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"\230\004\002\200\004\004\200\004\005\231\004\006\231\004\007"
+	.ascii	"\270\004\b\271\004\f\230\004\017\270\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.93c42762a62334e7,"e",@progbits
+	.string	"(\265/\375 \273\205\003"
+	.string	"b\305\021\034\2605\303\001@` \r\235\265\304\335\353\202"
+	.string	"\271\212\250\ty\352\342\335m\357nR\2463\016`I?/\260q\241\274\3573i\353D:\217NW\264:P\204\007b-\276Ua\222\263\362V\376\356&t\303\316V\277 \021"
+	.string	" \0217\026\007k\270\336\273\305\252\332\n\253\245\341a\317\225?\005\003\312\004\027@\356\262\313\276 \023P\360"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_.lto.93c42762a62334e7,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_boxes.33.93c42762a62334e7,"e",@progbits
+	.string	"(\265/\375`7\n\0250"
+	.string	"jX\240\023:0lM\007\0030\264\215\257\017v\374\222$IW\206\220c\274\033!\005d@B\001F\001\b\033\215\332\360\273\021}\362\333\026#\001"
+	.ascii	"\030\212\231 \255\3403\373F\335X\031wJ2%\001(\001,\001\037d\277"
+	.ascii	"\020,\377\365\200(}\216I$;n\340\340\337\364\367\330\377\366<"
+	.ascii	"\224>W\206\266\377\226\035;\370\245\322\276j{*U(<\220\n\264\365"
+	.ascii	"L\331\361\357\001)\355\246\266\223*\265\302\003\261@[W\224\035"
+	.ascii	"?\200\360I{\250\355\237@\2459\235\307e\307\020RM\3329m\327\264"
+	.ascii	"\351\314"
+	.string	"\351\232l\262\3434B%\355\227\266W\262t\346uL-\331q\004\t\220\264K\332\016)\322\231\3275\321\320\326\223d\307\022&,\322\336h\373\"Fin\307|\201\2668\262\343\t\024\360\264\347m\307C\264t\273&\f\264]\313\216)T\260\323~\267\335\316P\f7\304TC[\263\354\270\202\2059\355\203\266\023\262 \210\206\3371\331\320\266Dv\234\373h\227\333>\227\001\265\371]\023\230\035_\320\243=n{\237\013|\332<\217\031\";\306PG{\236\355z0\340i\363\274\346W\326\3529v9\332\351l\257s#\207\0027 o$\034g\3609mXR\004\341AA\345\346\326\272\020\307:\320\366\263c\r\376\3539\276\357\273\327'!L?\331\361\225\377\356\364[\332OWi\005\321\274\223\035\373\266\350\227\264\377O\2445\004\363t\223\035c\t\321\337h\277#\314H\031\242I\006O\177\336\376D=DJ\021L"
+	.string	"\001\352\364\033\332\177\207\372\257g\247\024qB\311\216\003d\321\351\037\264\037N\320r\0043K\300\037\375r\373\357"
+	.string	"Z\216h\006\311\216\005\f\200\323\037\267_\016\237%\211sGv<\200\300\035\375y\366\267\301\263\222\020\242\355\223\312\216\t\024\220\243\237\316~4s\332|O\247\354\270\200\2016\372\337\354\037\343F\351{\232\223\262c\003\007\320\350W\263\337K\232\241\303\231@\333\277\313\216\017 \030\243\277\314~,d\212\016wD\333\227\313\216\021hy\321\017f\377\224/m\316\207\t\227\035kma\321\257e\377\026\237\377zYN8\237&\022m\377Mv\274\225`\212\376*\373\237PYz\034\363Lv\234@\301\023\375P\366+a.=\256\371%;V\260\340\225\350g\262\277\310/Y\272\034\363\257d\307\013\030\024\321\177d\377\017#J\227k:\311\216\0314\370\241\003\\ihg.\326\322j\310Xr\311X\236\305\340B[c\343\332"
+	.ascii	"\341\252\315H[\343\252\241\246\266\306\005\340z\261+R\331\273"
+	.ascii	"n\307\357\370\036\207s?\376\307\0039\235\027\362:o\372!O\344"
+	.ascii	"\212\334\221?\362IN\3111y&\357\344\236\\\224\217\362S\216\352"
+	.ascii	"\335~\307\373\370\366\207<\221G\362I\276\311;\371(/\345\255\374"
+	.ascii	"\225\347\362]>\314\213y3\177\346\327<\233\207\363q\276\316\333"
+	.ascii	"y=\277\347\373\274\237\237\373@O\350\013}\363\017\275\242_\364"
+	.ascii	"\217\036\322OzJ\177\351\3537=\247\377\364\240\236\324\227\372"
+	.ascii	"T\257\352\334q\276\235\355\371\343\034\342u\036\351\322!\007"
+	.ascii	"7O\"\3724\262O\"ET\256\246\225\217\354\370\372\017\210>\205\354"
+	.ascii	"\023H\2206\257SUv\354\376\353i\361\320\247\217}\3628{\254^\241"
+	.ascii	"\262\343?G\351\323m\277\251U:\350|1\355\240\355\271\311\224~"
+	.ascii	"T\373\361"
+	.string	"N\321\370j\236\215\262c+\354H\277\250\375\243N\377\365B\251\037\230@\264=\363\262\343^\"\375\236\366c\352\244\374\320$\244\205I\277\246\375u\231V\020\001\267\310\252V\267w\215\307\024C\366(\206\336#\253\202\341\213\"9$SYa:L\032\325\254+T\213Vw]\3310\337-\021T\203\352*\206^05\211\024\016\331dQ\005\242w-\006\211G1\337U\262bI$R\035\363]v\275\272fj\261\354H\f\256\304\253\213L\212\t\207D\"z\301\206D\025\330\273\354\321(\364\3352d\032D\036\007\\\024lr-\256\3045\211uW\2432)\354]v\r\032\207a\253\320\250\262\001n\007\017]G2vE^]\337]\303T$q\250\206\371\330\241\352\273\301\256T\f\230\034\226!S\256t%\202\251\310a\020\3015\033\026\323\225(4\252)\331X\230\200\213\201\215C\327\210\013\351\212T\33155;\202\231"
+	.ascii	"\252D\260\255\333\301CWJ<\262I\343\021\230\252\354ZT\201\005"
+	.ascii	"\256\030Re\201"
+	.string	")\273&\303\324\224]\311\216\351\330\220\030\266u\213\254\272\262cW7iT\036\201\351\232\034\022\211kRE\246\3101a:\266\256`\013\356\032<\026\323\344p,5K\222e\335\016\036\272\3206\330Pk\301b\006[\214\200\304\250A,B 6\034QP\222\242$\031\016P\223\210\2649\020(\347hf\266\031\370\310\237A\311^enI\324\362\020\274\3077\273\225\34789=\306\316\224\036)\270\351Z\211\320*\341 \312\202\255\262\004\326\373\220*\037*\275\306+E\346\315[g\250\017\"\214{vD\264\301\303~\332#\317\337\007\330\344IT\306z\207\305\244\201\266k\360p\002\357\253\342!\"u9\313S:\013g\325\221\315B\334\272\310\261L\222\177lG\306\3201w\033\362\301z\207\265x\226\261\265\247*\032\364o+L\200\351R\354\220\b\335\373'\273\257vM\371?\275\336\323\341\274\275j? \272I{\221\035"
+	.ascii	"Y6\373\322\\\236U)\324(\2649`\314%\360\301\365B~\033\330\313"
+	.ascii	"\026\021\264Yv\272\034\367\377\364}\007\316\323oCO\245]\237\345"
+	.ascii	"\316\315\234\032\310\3329\001u\343\fP\227\355\373m\243}\325\200"
+	.ascii	"\206\355\222\317A7\211\342\210d\352'\224\225\272\342\024\254"
+	.ascii	"\361\3225\0252\3010\001"
+	.text
+	.section	.gnu.lto_findBoxByBoxId.35.93c42762a62334e7,"e",@progbits
+	.string	"(\265/\375`6\002\235\023"
+	.string	"\246\245\204I\3200'\035Z\250\376\220N\330S]\026t\032J:ZU\371\003A\347\023\314\374\272v\362\326\300^n1\371PT\333\257\326\013\341>\251\274e\332\272\032\245^\226\224@\272\364\334l\005\362U\0039\230\230-K\b\331[\356\224\002p"
+	.string	"g"
+	.string	"s"
+	.string	"\363$^\242\305\264\001b\016\r8\n\311"
+	.ascii	"M\325*\266,^\300w\032>\300w\272\037\374\361)\336\237\244\035"
+	.ascii	"\374\350\\I\363k\007\347{\250\230:r23B\020\314\316y/\362\023"
+	.ascii	"QsJ\301\306\306-\307\341sB0\261\323\351\310\301\314\375\3515"
+	.ascii	"\275w\211\313\331\344\236w\251\344b\224\032\312\325\\\202\"\265"
+	.ascii	"V\313[\216\346\016o;g[\202-+\004^\034{\025^\374\301\007\335\324"
+	.ascii	"\322\363\343\275SZ\256\364\001<\230\231\232Q\240\251\326\rU8"
+	.ascii	"j\013\272\024\342A\377xi\337>\220\3373\313\017\242\275\306\314"
+	.ascii	"\254pcQH\370\037\237g\326\350\021\326f\302!(\"\031\265\212\037"
+	.ascii	"\247n\020\236\336n\261Y\266\245\264\357\363\023-\0275xU\353\215"
+	.ascii	"QR\255\342\002\203\204\247\007\002N1\230x\350\352\374]\317\321"
+	.ascii	"\322]-\316\004~R\334\314\325\031\\\271\263\361\205MR\371+\367"
+	.ascii	"29\214\341J&\364)j"
+	.string	"\252V[H\222\214U\213\332\035\035\211\366\235~\351S\324\r\237\027\321\020\374f\233\345D2\0059\265\332\034\b}(\303<\210S\247\254|\277\235\372+\337)\335\367>W\330H\335j\\d\325\326\340\331Y\332\325\331bM&\240\321Y\n0\025WI\254\344\304\365Z\305^2\201EFB\375\002a\221\221X@I1i\301^\256\0133\230\312I\254u\022s\231\264^\263\224\026\210\001\313P`\263\226\212L6k\261\\\2778>\212\217@9\365\220\276\033\375\275\257v=Gs\265s\256E\\\366\005\\\235\031\250\240\341\322\021\322\270\323\030a\330$\325g\255\265~\253\273\307\267\033\356y\037\351`\303\"\306\303\213\254\222\033' @\002\203\034\274m\035B<\271\221\252m%\253\357\320\230Bb\001\307O\032\267<cx\215\271\250MZ\241a\371\303n\221\030\301\321\027\034\021\260Z\333\b`\243\020Q\357\004v\201\255="
+	.ascii	"\312t\244\346\305V\337\300\354\004\036\247\332\222\371z\330\335"
+	.ascii	"H\004fee\202#\240\254\301\271Wk\236"
+	.text
+	.section	.gnu.lto_findBoxByPermanentId.36.93c42762a62334e7,"e",@progbits
+	.string	"(\265/\375`+\002\235\023"
+	.string	"Fe\204J\320\322(\035\320\354T\257\272\034H\376\356\317\021?\261\n\265Q\306\354\231MM\256\003\347g3!\203F\235h%\320\r\273_\260\300\256f\026\204S\236"
+	.string	"\342\013\256\252\322\215\225\225\351\366\342\247\352_\031\377\"\3364B\b\331r\247\024o"
+	.string	"f"
+	.string	"s"
+	.string	"<?13M"
+	.ascii	"\2113#\226F1?K\265\222)\223\017\020\036\034\017 <\270!<rJ\336"
+	.ascii	"\341\244]\fA\272\223\346\327.\322\227`*\n\311\305P\t\275\027"
+	.ascii	"\235\363\\fH\202\346 \005\033\337-\347\341\224\226\240\330\345"
+	.ascii	"\204\344^\350\372\370b\334\367\211\313\331\346\236\3679\244T"
+	.ascii	"&\001\345h>E\223"
+	.string	"Z\253\347-7s\217\267\235\263=\301\236(\001\342{\376\360\275\233zz_\336\223N\377\024ag\211\007\201\244Z;4\005\2517@\242\021\357\375\345\247}\373?\276\317(\277G{\205\2219\341J\033%\343I\237g\324A\253\270\317\354\245\310X\223\031\201\220j\354\250\225\0349h\b\343A\003\364\366\314F\331\336i3h0{\017\007o\2556FB\265\222\nL2\036|6.\263i\256\f\035E;\340\352\374\035\217\322\322\035\027\347\001>0@\320\3259\334o\254\304a\233L\2661|\310\005\036\375\226j\2659\020\202\241j\277\335\213\007\321\026<\372\001\351y\013\332\201\337lo8\013X\002\234Zm\017V\034(\003\275\210\203^a\t\177;\350\263\354}\2474j~\334hZf\323\372\330\321!\332\325\331dm\"\230\311!\362\336\330c,\231*\245\225\362R\255N\255\247\240\310^\254\227\312\025c\251\240\274\"\321"
+	.ascii	"\263PAe\305\225b\255T\027b,\331\253\225z\265T\256\324*\266\222"
+	.ascii	"\")`\230\n+\226\222\301`\261\024\312\365{\343\247\370\tR\016"
+	.ascii	"_Px\027\277\357\247\035\217\022\035w\027\2676iY\027qu^0\003\024"
+	.ascii	"\02741\215{\2172\207m2\235\326Zk\370\213\204s\305=\357'\037j"
+	.ascii	"~0\001' @\002\203\034\313y\235\206h\352\034\270\330B\203\365"
+	.ascii	"V\307\003\322,P\370I\224\037\307\260\031\033u\033i\215\201\002"
+	.ascii	"N\270\340QD\020\245\340\210\250U\266v7\263\017\335\022r\353\235"
+	.ascii	"\300n\333\026\372)\336\235\260\r\264\0247h\202\r\344\221Ix\232"
+	.ascii	"7l\201\031\265r\353\bR\326x\356\325\276'"
+	.text
+	.section	.gnu.lto_serializeBoxNameFn.38.93c42762a62334e7,"e",@progbits
+	.string	"(\265/\375`x"
+	.string	"\315\t"
+	.string	"\346RD;0\345(\035\236\301#D\241\326\241m\320B\006\347\206\f7\221\343\003\335\f\326\013\335\b\306P>>\214\30669_}\202\205&\b\220\214\367\"r\302`0\343k#\204\020\"wJ\0010"
+	.string	"2"
+	.string	"4"
+	.string	"\036o\260]\353N\260]sh\303|\004\331\273`\031("
+	.string	"vw\352\307\303\313\320\277\3113\252\225x\3115\354\256\245j\305q\353m\037\330V\260_\020V\226\375\326\237}\374U\245\317\005l\270lbv5b\260}i,\"\266\257\261-\307\323K\302\245}\222\227\204oY|`\227\225\242\262;\"\230\323]\013!\t.\300+\245\2423\362\232\251\355M\310\253\254\351H\251h\033\374\tE\267\213\261\340\273L\025]\310i\273v\345Vb#-\224\214\331\243(\325\303~\266\273\033&\317\243%\020B\375\341\230<\317\003\t\024M\320\247\023\361\201J\243\320\034\205:\242\371\371\300\311\331\330#\201\276Y\362\274oj\306}\266\312\262\303\352\205\322\013\013H\206\273e\013\017"
+	.ascii	"2\241%\034\030.*\210F\234\320\311\017\241\016!\210kl+\214\007"
+	.ascii	"\252\201+`n\200\212\002\356\362\242\235d"
+	.text
+	.section	.gnu.lto_serializeBoxPermanentIdFn.39.93c42762a62334e7,"e",@progbits
+	.string	"(\265/\375`n"
+	.string	"\205\t"
+	.string	"vRB:@\305(\035\265\256\2723\376\310:C\0222\024\322\204=\343\335\322'WS\370\217\330\267\240\263\036\263P\033\263$t\257\030Gtf\310\007\2001\207\331\374"
+	.string	"\257m\264v\023)S\n."
+	.string	"1"
+	.string	"1"
+	.string	"/\270<j'\270<\372\263[\036z\354_\240\352\005`w7\355\370\367\374\374\223\\"
+	.string	"\\\241\236\230\206\335u\202+\326\255\267\215`{\301~&\217\017\377,K\247\246\217\311h\260$\254\354f\304\004,,\246\200\330\276\306v\206\247"
+	.string	"\nO\373\"\037\371\356\252\370\300nK\005e7\334\230\243=:\f\266\210\313\203>\300P\224\257\251\033\325"
+	.string	"K\334\304\323v/\030\374\022\212\t\355\343ty\274bX'!\256T\306\354\020\225\312a?\333\335\265\266\354\273\036&\316\243%\017B\375\341\2308\317\003\311\023m\240O'\242\003\225F\241m\024\352\210\266O\347m\034\003s$P\267\2258\256\3334\341>[m\331a\003\226R\013g25j\016"
+	.ascii	"2\241\t\034X\270x\230\3366\315\256<\330`\256\261\2550\036\250"
+	.ascii	"\006\256\200\271\001*\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_serializeBoxReply.40.93c42762a62334e7,"e",@progbits
+	.string	"(\265/\375`\361\005U&"
+	.string	"\372EL\017J\200\330U:\177\373\004\310c\374\372*\265y\371)\372\370\260@{\033\242\026\215\364\024\317U\254\231U\212\332\275\201\326?\033EP<k[{\317\177\356\317TO8\233\317\323\316eF,8fZ\337\3610\276iA\032!d\357$\003\336"
+	.string	"\323"
+	.string	"\344"
+	.string	"\215\233\314\210Z\270\3153\031>\252\237M\313Y\211\353*\347,\241)\260Wq\351o\367\241\276dxf\215\347\344\274Du\225sSB\367\260W\273y\001\353U\366:\353\325a\367\2307\231\362\235\3540:)\3139\347\260\020\bO\233\357Y\267xx[[\243\261\263U\275\245\370\016\373P\316\300)\215QR\3506\244'\361\266A\224=^\233mPR\3628m\201\222r\307\331\364I\326h=\f\251#\325 E\344t\256\337c\222\350\316\214\344\370\232bX\202\244\t@\262(\305QS[\367\372\202'\244\216\253\2629~K{\254\034-y\030rG\232\003\004\214\363OH\0377MqaH\036).\347\334&\213\027\377yu\231TFI\331\343w\266!\347\334\327(\251|\003x\367\323\356n\321\255\312\b\255\336>`\240v\273"
+	.string	"\3556\201w\275\007\034\372\026\260\243s\346\237\363&\177"
+	.string	"\3666\316\245\336\267S\275m\217\372\333g\275g\353\253\336*{;eoc\366\366\275\267\217\240f\005\354\301V\3167\242mr\026\025\213\310\241\177\327\237\365K\375T\177\325\327\356\367\257\374\253\273m\030\327\352\004Gm\222\240`t\267U\336\325\367\352\026kxuh\237\353VC)\337\352\006\272V\337,h\224\376\263\333\254 \211&2\2502\337U\037\253\333\006:\225\030\317EH\332\321\031\205,\305\245\364\255\272\005\372\024\036\\\261\231\223%\220\240Pe(\200\272\333\253\367S\177r(\335V\365(A\305\203+\006\310\305%R\021\021\335R<\254\020\222\235r\342\203,\347&\204\253\335\241\003EID\250\030-\"+^v\001<\303@\247\027\002\270"
+	.string	"\276\361M\233x\230\023*\230XY\316\305\n`P\264BbH\274\374\313\267b\254W\t`\025LL\rsh\353c1\032\334\210\304\305PD`\312\271xa\313\271\244H?\344j\353v\353\215v\353\325\001\370^o"
+	.ascii	"&F\034\253\3021t\243\370L\021'**^\366\357@\331\204u\303KaO\361"
+	.ascii	"\2250\2768\305\251\030\243\216\033^1\306\252\033#\022\033^\361"
+	.ascii	"\305?NSF&\361F\217l\003\306\224\376V\034\374\347/\322Q\324\371"
+	.ascii	"\245x\327\364\355\316p\377\213\205\357\336\b\007\377\353\033"
+	.ascii	"\212X\350\376P\023u\205\033w\236\325\206o\370\001\230\242\244"
+	.ascii	"c\033>\032\343\233\241\033m\334\373\271\266\370\330F\323X\321"
+	.ascii	"\023\361F\273\233\304\213\227\335_\277\210\2704^\352<\337\355"
+	.ascii	"\tu<\037\317G\267\243\371\036\304\003\021\364S\261\n\201:\341"
+	.ascii	"\b\032\317\307\303,\350\307\241G\303\347B\347\003\366\202\266"
+	.ascii	"\036\013\335O*\f\362p\357z\202~*R\374\004_\344z;\335\n`O\350"
+	.ascii	"\343\313\371\370t/r;`0\327\243\240\177?=`N\370\373\001sms\350"
+	.ascii	"x\251\253\256d\031\302D\033^\366\355Km\007W\031s\373\330iM\305"
+	.ascii	"\207r\266\254\n\363\236\314\327\fGl\316\264Eu\244\305\313!O&"
+	.ascii	"M\007w\212W\254\342cp\235\341\035|+MinM\314W\254\323"
+	.string	"\340\351\351\034\223J\022B\303\313\017Z\240SV\263w\371\275\036\302\031\305h\245\016\300\007\360\261{\347\036\3009\270\003\340\376\3634\246'R\r\031\021\026b\361\262't\255\006\260\252\344\326\307\233Is\316y\206\227\347Y\005`\003\370\\\377\300\003\tKr\250q0f\fb\314\b\005B#B\n\323\214\001`\002\221rfu\020H\311\206\222t\023\310P\246$\030\217`\212\233\035(\255\344\020\206)\230B\3125\227\216\250\252P\026\220v-\213\013\354{L\224\307}\251XfGN\307Jm\210h\324\212\241Q\0062C\221\315\276f\331\307\265\210`a0\211\344\202a*\277\211\2411\324\247g\227\247a\220\244\275\030\272:\210\225\346\252dH@'\310t\275\275\236!\002\254\376)\t\231\277R\226\224\340\251\005\345@\250\364!\005c\352/f\262\326D\305=\211r^G\320\365U\023\246s\243\002\0250\225\307\221\214\364"
+	.string	"\210<\017\275\362 \204\325\247q\304(3\003\004\371\243\250\314\214\215\300\b\355\b\235\334\005I\024*\302\2777M\253:\216\027"
+	.ascii	"\324\262\261\"\345}\034\204S\2655\307\347eP\311sx\013\357\rA"
+	.ascii	"\223\300T"
+	.text
+	.section	.gnu.lto_initActiveBoxIds.41.93c42762a62334e7,"e",@progbits
+	.string	"(\265/\375`j\024\355P"
+	.string	"\212\201$\035P@\216\322\031\016\2512\f\224\343I\347 \360_\372\016\3329>K\006s\275\213\374K\002\367\344\236p\217\021\243\003\325duk\366FGd\210\356\236z\2773C\343\004\356\004\334\036\227\275n\200\"\357\335\212\317z8\217\020\t\213\"&B\366\336R&\031\310\001\223\001\307\001\177\353\2124:\272H\302\243\233v\237\364\250\360<\351Qu\327\314\323\210\254\247\362$\213\n\340\272\256I=\004\311\310hhU\354\3713\355[\204\252_\241\"\005"
+	.string	"IH(\216X\030)\025\235 2Qb\210\304\210\026\"\204\202B\200"
+	.string	"\372\340\241\003\207\r?\032|zxvtrpn\214E\242\315P\030L\321\263Y\335\363(c\025\206\315\213\352+\306\320\331\261\n!_}O\301w"
+	.ascii	"N%2^a\304\017\314\354\235N\f'\341y\351\302HwG\341\005\017\217"
+	.ascii	"\217\356\316\342D\352\302\303\354zH\276S\007\310\030\265\323"
+	.ascii	"\225a\243\276+\235E=$\231s\005\033\033\027\325\375D\333a\024"
+	.ascii	"!;\363\343\213\356Ds\313&N\0360\267\275\037\3551\t{\333\222K"
+	.ascii	"\234'S\303\345zH\270\223\200*WF\276l\343!!_o'q\016`"
+	.string	"\366\244\310\365\220ngO\261\"\367,p<\342Uooq\016\371\270\262\365\266\013\351!\351\316\016xN\\\370\022\244\031\026\021\\b{\321\032`Y\340\217\257\272\013\255=h\355\n\207@;\b\264%\3103\006\322C\242\235A\353\272\232\361\207\262{(\213\302\035\240\234\003\0242\336\360\344?O\224\260\206$\367Ib\002\367 9\017\222\235\263(\331\205\307\365\220FN\237< d\256s\256\270\002\024\273\036\262\310YT\223\005\346\b\347\0209\016\221\036|\223\27419\306E\261\023\305H`\233\260\017\303\204\226 \301X(\364\343k\204\007\257\207\034a\313+\213\323\020\216b]\361\311\343}\026\375ey\201\350u<}\272\222h\035\355\314\345e\305\034\\Z\327uY\313\353\353\033\300w\317\003v\327\200\335\034.\001mq\302\242Y0\n\223\335I\260\031\350.\2665I\211=\320V\2169\177\3456n\2151\217g\016\177"
+	.ascii	"\302\331\022\201yu\256$\223\336\013\322\267\r\265\276#\253\331"
+	.ascii	"\036\346\007\322]\bf\360\265\336\306-\020\230G\022\037\344\360"
+	.ascii	"\236(\375ir2n"
+	.string	"y1\257\232j\215,\374\332\245F\177\332\321\242n\210h\355\342\240\200\257\265=ri\201\177XM\265\233f\305\255\334}+\251B\263\035d\267y\243n\fy\241\202\274ONB\336&!o\r\032\307\362\225 \310;#\202\303}e4o\214w\371.\375\356\353\342s\337\236\257}yR\336\235 \257N\2207'\310\213\023\344\275Iy\215)o1\345%\246\2746)\3570\310+Ly\203)o\232\362\242)\357\231\362v\312\313)\357'(!&)\246$\3530ikWS\206\225\211jQ\362.\377\335\017\367c\371\347\376\265\377\354\301\335\357\345~\267\307\343\342\026\367.{/+\250[n\267:^\267\3501\314\223u]\351\3462X\300\215I\2000n\317E\207\333\337\226\375\n:\304\346V\307.q\355X\366Y\226xE\255r\270\375\222\212z)\177\333\335q\267\035\036W \266\355\022\323\366l\352U\330\270\001\326"
+	.ascii	"\313\214\252\354\257\354\270\225\r\276b!\207[jw\177J\302K\331"
+	.ascii	"S\231r\265\035W\201(\350\230\266z50&\246\fp]\323T\b\217\006\235"
+	.ascii	";v\211G\371hK|\331"
+	.string	"\315\324\237q \244B\016\265\250D\tg\3414z\313\350D)\215>\032\265\276]\303\222\004\034j%\340i\264\214\376\362/\302\306\374\260\222VjM< $Z\2713\232\357o\253\026a\027\230\320<?\300\026\324#D*\277'h8\215j\302\371\267\r\322\2433\032\315\363\013<\373\033\377m0t\255\277\355v\220\306~\352\221\2432lF5\341T\242\242\220\242\220\036\225\240\237\345Cy~Va\330B\250\342\246\232!~#Z\271?\212\005-\256E\007y\363LiNO\255\003\334\307\204\202\310\272\036\005\330U\2310\237\332\004\204\230\243\313aX\214\352D%S\243\250Q\322\2439}\266s\235\322G\322LK\0257\215e[k\"D\220 \004\306\274\n\372\022A\250\303\032\0161l\b\224K\266\005\265rYy\234-Zp\032\375\262&0\204\206./k\245\013\fD+\367L\351M\363\0223vc\3436\025\255"
+	.string	"\003\fH\217\336\364"
+	.string	"E\316\252\270)'\205\f\310(4vqi\347\023\307\274\372\300\323\205\346\241h\365b\027\227f\314c\007\243\023\016Db\027\227M\230\307\r#z\374\330"
+	.string	"\361.\002\t\360\265l\272\270\034cZi"
+	.ascii	"\352\022\301g\0304\354\342\022\004\346\021\304\217\261\313\303"
+	.ascii	"\317\0040\370\b\374\303\331\322#4c\260\037K\236\r7)\\\017\r\231"
+	.ascii	"\235\233>c90"
+	.string	"CtZ\271\3023\245\302\266\241\306\267\013\203\1770\t\327\365\330b\331\007\227\020c\217\344\350\312P\200\257\245@7\034\335Y\02577\207m\270\2340\257r\206\\=p\202+\004\301.\302\215\335\fq}\220ry\241Mc\nA\332\305\2665\305NCD\205h\027\333\316\330\234r\303\363d\340\354bO\th e\003\205\302\240\351\t\307S\216&\247!\2167\345\200\352uB\322@\312\006\r\013.\250 \t\312\251\351\306\024\024\0069p$\345\300\321TA\222\323\324\005IH!V\312\002\250\251$\f\244\244\246\222\210iU\357 \253@\023fU[-\007\347\272\376p\361\263\377o\312\331\267\273\032\311\301\036\311\252cQ\034\225\0365\"\004L\322l\204*n\256h\345\342\250I\021A\243F\224\226\223\3608\002&L\305\237A\332\323\0214N\013{Va\252\244\370 \246\307\351.t\001\354/\360\357\252\251R>!I"
+	.string	"\260\373\213/sV\226Hx\207\241\346\226\265<r\321QQ:}L\244\244\371\302\227\204\342F\243PX\234\205/\275\360\245s]\327\025i\251o\364\275\374E\230\030^\317\225\341\242\004\005T\367<5T?k\206U\207\264\007Lh\336^\326^c\331=5\232\267g\327\307\016fh\253\256r\321\307\373P\336^\267p\202\221,G&\276\212ha\321AvzJ\255/\211{\372uG\213\022\252@T%_k\247O\367sm!\001)C\336\020#\245\016\262\301\272\023N\335}BF\347\351\255\215Ky\372g\317\031\303UVtt\236v:\325\2545\261\370D\215\276\333\321\242L"
+	.ascii	"}\235\021\022Y\221\353\272\236\330\231cR\361\032!N\342\210\372"
+	.ascii	"Ri\323P\210\232\027\234f\263Iw\251\264F7u\232\264\342\346\352"
+	.ascii	"t\215^\316\232\241\212\233C\030\020M\007L\365\210p]W\035\216"
+	.ascii	"\242D\2224;k@$WL\274\375\305\227>+\313!>\363g9\f\265\273\254"
+	.ascii	"\345\b\t:Fo\235y\214~\333w\246\030\221\222\346K\211Vn\212:\022"
+	.ascii	"2\032\205\322\"\201\226\250aH\005\021C3\"\"\"I\nRH\007\321\005"
+	.ascii	"\204\020\006\235Y\035\021\320(\005!S$$)I\251\003\"P2\302a\\\224"
+	.ascii	"\rd\035\202\237E$*\204*\251\361\202X\325\031\200148x<\315\347"
+	.ascii	"2\f\017\216\006\324\376\306xl\321\340\362\204\202\354\245\263"
+	.ascii	"\225\304\0345\307\321\020\334*\211\227\f\315\037\231\241\336"
+	.ascii	"xK\203'Q\250\025\b\344\262Em'\030\221o\303B"
+	.string	"a\004K$\234e2Y\230$\302\200\306 \030\351M\372\301\356k\3524\256T\262`\036\354\223\n\335\321J`\206T\223l,\343\265\027\214\307\f\257Y\272\362\037k\273\312\016\227\354\3649\234\320%z\343\254\267\356\254\323\002\320\027\342\340\r\035\376\240\001~\233\005\002\320\371>-\243+\037\335V\350\357=\254r\210V8\323`\341Ol\306\253\034\316\fA4\343\334NN3*{yX\332c\324\264\365\247\036\3314\345\032"
+	.string	"Y\350\266\332\032\220\273R\244F\331\024#\001\376x&Q\252\256\201z\316\313G\274|\300\020\344\336\355&\300\204J\304\t\025\323\222\320\247\177\362\"\225\376e\314\317\376h<}~\233\240l]\276\255\203$\320\031\3277\320\243\233~\313TEXr\305\0030&\003??\202y\021\333\340\337\246\360\253\236\032-\212\200\225\214xs}\001\2065--\311z\206\214K\304Y\b\340i$o\030C\330"
+	.string	"\004\f\201R\r\341@J\246\257&0\261\341\030y\223,*\037Z\271\260\370\304H\016\371\315I\334\337\257`\362\354\017\301\0233\257\224\022\353\026.\314\317\257P\232i\245\266\255f\376\375\223U\251\312\033:\322\327G\311\034\302\3160xf\344SR\021\t}\355w\325gj\201S%3\237>%\211\300D\335\223{\205\263[\252\341\\\006\025~\342h\247\375\321\274B\333\0162\305]\263\270\235F\320\343\201\3531\347u\254-\311\364x\352C\265p\265\222X\366<g.h\345\214\200\rlo\242\r\202\343\2602d-\027\373y\240Y\346&K\215\027,z\222EQ\315\031\312:\016\223\360u-\364\301\342\355\002\327eh\016\017KF\004\204{"
+	.ascii	"\307%\201\370\036B\260)\023d>\305C\013:\032\007\037\364]\002"
+	.ascii	"\376\312T\bJ;\031=$\341\323\265\203\306[\251\376\340\327X\346"
+	.ascii	"b\017+e\267\2628X\205:R\271\006\345\243Q\320\343\\\254\326\352"
+	.ascii	"2N\253\213xt\366\201\353\362\350\317?\267\254\024\023O\272?\\"
+	.ascii	"D\005\210S\275\330\013\217\216\361\365)\314\216\211\r\036\276"
+	.ascii	"\004\bX\202\036J\253\27108\245\275\002\375!\026\f\fPP\0320 T"
+	.ascii	"#\256e\312\221\034\332\351\274\3337\305Y\376"
+	.text
+	.section	.gnu.lto_getBoxIdState.42.93c42762a62334e7,"e",@progbits
+	.string	"(\265/\375`C\002\225\024"
+	.string	"V\250\216I\300.)\035\303 9lR>?\310\026f\007\n[\215\257\353\212@\323\320\243gaG\324m\3310\350\373g7w\035\031\0061\210\225E\337z\247I"
+	.string	"\230\244\332W\036B \177\2160\301\027\246\2028\375}_\362\311\336R\312\024|"
+	.string	"p"
+	.string	"}"
+	.ascii	"\374/\211-\241\333\243\232\277j\0052RQk\320\300I\306\245\002"
+	.ascii	"\026D\\:\327C\\\372\377\007\022\350n\263\301\016:\353\341\311"
+	.ascii	"gBF\255\301Y\017\255\315\272D:\233m\2767\353z\260\264$\356\216"
+	.ascii	"RI'\210"
+	.string	"\016\321/\006\304\231\"ULW0`\005\236\024\224\250~@\f\333S\344\207\005O\f\330\233 R\034`\354p9\007\310cv\225\324Z\317?\340\316~\334\377\023\376\243\374\214\013\342F\003\030\0221\234\352\261\326i\330\204\300\nw\207;\240\210*\313\302\216\313?x\303-\364o\227eY\276\203\376\311\3578_v>\307\371\261=\332\3358\177\024\371.\221/\212|:\371S\3447\345\363\344\257\207\307\225\324\tV\255:\345\214\032E\233@\254p\367\327}\207\207}\203\213\244[!\315XC8\230jQUk\035Yz\004\343\322\257\200q7\247B\202z!\216\254\2539z}Nbw\273z&\371zh\027X\261\247\025\316\f\036\227\237MWvh\033k\355)\230\275`\252\211\273{}[\273\024\233\304rki\021\227r\277x\260\\\024\355FP\215\220!\243\341S\217\265\230\311JJ\303\354hY\357p_\276\255\335"
+	.ascii	"\342vG\237}=\274=\261(p\337\017'ax\177K\2770\342\322m\227\323"
+	.ascii	"UV\317\022\375~\242\272\205^\023\032\257Q\244\263y\177\330\013"
+	.ascii	"\355\304\246B\236\310D`\271Ih@\242\250\230\314\220)\037*\267"
+	.ascii	"\0312\205\276F2C\246@x\211\301\315l5\332J\316&\343r\233\271\334"
+	.ascii	"h\270Y-\0273#\t9\371b\313\315dH27\203\005\353\316\332A\337\r"
+	.ascii	"\031~\304X\263\220\317\026\345\260\362\201jY\217\235\363\177"
+	.ascii	"\354\227\354\232w\232Y+\020\203*!\227\263\326Z]2\336\350\237"
+	.ascii	"V\343\375\305\372\343B\214\250^\007$ \240\002\021\272\343\006"
+	.ascii	".\022\332\243\214\245\201\334@\332\362Zq\b\343+(\372`\321\340"
+	.ascii	"\332\241\003\022\253\332\027_\210\001\227\017\243H&\323b\002"
+	.ascii	"%\256Co?\f\353l\222\263\013\031\277\331c\344-`\034\271+\215+"
+	.ascii	"1\337\312\001\235\213M\2144)^\001\215P\367"
+	.text
+	.section	.gnu.lto_packFlightModeFlags.43.93c42762a62334e7,"e",@progbits
+	.string	"(\265/\375`\257\002\275\025"
+	.string	"vg\215J\300.)\035\302 \300\003"
+	.string	"\022\244\360e\250\032Rgm\325\225\373\220\020`\335\254\307"
+	.string	"L\232\247\274\267\316\342\277\243t\265/\243\357\312\031"
+	.string	"\377r\200@\002xA\300\221Y4\004\232\370 [M\222\366\213W\022\031i\204l\271S\nz"
+	.string	"p"
+	.string	"w"
+	.string	"G\017\261\263\241j\220\303\357?Y6J1\316\363\224}\334\203\374X\317A~\334\r.\351\356\256\262E\216u\351\316\037\276\202\220\262\352\375b\356\2527\302\212:\213\034\f\325"
+	.string	"\221\006\350\305S\337\217GK\037\235\235\2674~\027NZ\370XCCk\035Pe\002\306\353gS=p\204z\346o\206\356\213\037;\334\270\340\321\3319m\215\234\347i\332\373\351\334\032\267\355c[\201M=\004\246\023\324\220\267\307\216U\352\r\330k\2446\037\374]'\336u/\274i\245>G"
+	.ascii	"\244\025\013\212\347\211\223%\343\234"
+	.string	"\032\237>\234\370\013}\245/\331\246a>\302\013U4/\302/\022_\230\232nL`l\363\343\355\235?\264\351\013A\312\230\234\262\330D\241\352<\203!\037}\240\374H\355#=i\367\340\204\307\316\263\307\251\304y\006\tX\244\374\350`\371B\344k]w\227\256\357\205\254\013\333\317@aE[\013<\b\271\373Z\006R'j4\360h\026\t\243\2733\032}\317\035QES4\005\220\250\204\343\002I\374{\036\253|;\242\210\246\016\304\271b\252\022\310\215\315\020\2244l1C\261l\322\272\376\022\204\032}oc\277\364\221\231}1\004\364\264\013,\357\024d\310]kG\310\321\367L\243*L\325l\214\035\344\321\005\332\017)%:\033\312\250K)\321\331\020\334r5WN\345\204\205\204\226bK\340\362@e\205\205\344\226\253\001\360LDgCip\313\325d\264\331\211\003\034\315\245eE\326\262rR\223\315p9\231\210"
+	.ascii	"\333n4\234\314\305f\303\311\314\240\314\267\307\256\345n\314"
+	.ascii	"\334\017\231\3459\266\346\332\314\220\241Y\256\005\032\206\325"
+	.ascii	"\202\355\017\021\025\265\317\265E\367\303\227WD*\250}!&AG\257"
+	.ascii	"\347y\236\345\002\375\342]FE\0017 `\002\221a\307\r\351\300\222"
+	.ascii	"\207\244\321\374\252t\032Kz\214\246\t\266\372M$S\334\251\233"
+	.ascii	"h}\337\337A^=$\030\255r\223\207\352\n\355\233dX\376\315\231\013"
+	.ascii	"\027\036\303\016\005U\207\003+k\004\330\255k\233\034(\331\234"
+	.ascii	"\252\324(\336\205`8\35202_\017\234\230p\231\256m\240a\207A\027"
+	.ascii	"\305]\234\325\202\f\177\227\352\300w\326\303pi\211\037\322\350"
+	.ascii	"\356\325D\312T\276+\222\231\332\360\004"
+	.text
+	.section	.gnu.lto_activeBoxIdGet.part.0.59.93c42762a62334e7,"e",@progbits
+	.string	"(\265/\375`\250"
+	.string	"\265\n"
+	.string	"\006VK<0M\225\016Ha@\302\300P\300\370\250\206\224k7\264\314v\035\321\034\370\332\303i\200\255\356\242\226F\320\203\221\250`\327p0\324\202\206\210\256Irg\210\f\256\254\242o\177o)S\n:"
+	.string	"8"
+	.string	"8"
+	.string	"\224\020j\227\213\266=\241\210<:\327:5L%\036\274L\354r\361P-|t\3157\362sK\221\256\357\3762P\020\261\245\"<-\376\032\225\335\265C\302\ro\333\200\355\002\366c\220\004\006\333\267\337\205l\210-\262!\207\2665\317\205\356\002=nS(k\332\337p\016\242\273@~\354V\b1b\227#ph\211\343p\300\0010\016\337/\030\207\3665x\022\037\264"
+	.string	"\255\335\3227\377u\017\230\177\341\320\013\264\374v\350k\f\032\344\267\324wO\225\003%\245\262\254\357ow\327\272\262\235V\247\363\334\177F\344D\305\204\335S\n\024\253\n\t\016|\260\0134F\362\301.\b:\332&f0\026\005Y\306\303\321D\216\306\262\211\230L\213\022\001\306:\231,z0,\213\220\277\325\225\337=\002\"SU!\250+%5YUY\266\037y}\207\007\016"
+	.ascii	"\017\213ahC\241,p\2061\345\312\334\n\310\003#\202K\230\234'g"
+	.ascii	"\247\335\25194R\003i\036}m\301\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.93c42762a62334e7,"e",@progbits
+	.string	"(\265/\375`j\003\365\017"
+	.string	"\264\026f\004"
+	.string	""
+	.string	""
+	.string	"\002;\177\030\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\200\202\202\200 "
+	.string	""
+	.string	""
+	.string	"\005\"\r\200\204\001"
+	.string	""
+	.string	"\003\002#\177\031\322\251\222'\272\200\202\002!\032$\177\033\002&\177\034\002'\177\035(\177\036\345\205\336\006\002)\177\037\362\202\257\003\0056 5!7\"\002*\177#\377\377\377\3778$9%\002+\177&\260\325\317\013\002'\201"
+	.string	"\001.\177(\037"
+	.string	""
+	.string	"\200\200\200\001-\177),\177*4\177+0\177,1\177-3\177.2\177//\1770:\1771\003"
+	.string	"\021$\003\005\023D\003\005\022d\003\006\007"
+	.string	"\320\302\371\241\002\001\202\001\004\007\325\n\003\b\031$\003\b\025Dd\003\b\026\204\001\003\b\025\263\236\216\001\001\304\001\344\244\006\003\b\030\304\006\204\007\304\344\007\204\n\304\n\344\244\013\304\013\204\016\304\016\344\016\244\017\304\317\242\231\002\001\344\022\204\023\244\304\023\023\026\003\b\027\026\204\027\244\027\344\204\032\304\032\344\032\204\033\003\b\025\231\217\307"
+	.string	"\001\204\036\003\b\025\313\236\327"
+	.string	"\001\344\204\037\244\304\344\204b\003\b\025\325\267\246\001\001\204j\003\b\021\247\341\374\220\001\001\204k\003\b\024\256\246\351\006\001\344o\003\f\032\346\336\301\357"
+	.string	"\017\031$\003\017"
+	.string	"\322\252\260\364\003\001B\003\017\f\312\371\217\245\001\001\202\001\003\017\025\302\356\2766\001\304\001"
+	.ascii	"O\250Q,\326B\n[\\g\343\320\002)*n\003\021\220$d\310\026J0RPP"
+	.ascii	"\320\001KsE\356D\320+\225H\t\310\313~\254\016\017\\x\b\261\215"
+	.ascii	"\260\226\\8U\340\212\0266-\316\222\264y0\373\330\220\271\220"
+	.ascii	"\251%?]\005I\016\237\3115\247 )\004_9.\343Y$\246\225=V86.M\337"
+	.ascii	"\232G7n\277\306\235\"\032K\b\221 >%\340\320w[l\250VJ6\024G\323"
+	.ascii	"\212SE\2045\332\255\361:\346\356'\030#\202\022\216*"
+	.text
+	.section	.gnu.lto_.refs.93c42762a62334e7,"e",@progbits
+	.string	"(\265/\375 _M\002"
+	.string	"\342D\017\033\240'i\f\343Xq?"
+	.string	""
+	.string	""
+	.string	"\200\b\300q\376[%\354\177B\204pm\313\235\002\223\301%\030\330\r\242\031\013E=Q\033q6\224\013fB\t(Omj\344\330\325T\333\022-\375\020\003"
+	.ascii	" \004AxZ\224&"
+	.text
+	.section	.gnu.lto_.decls.93c42762a62334e7,"e",@progbits
+	.string	"(\265/\375`H&\375\255"
+	.string	":\025}=X0\nIJ\035~Z\021\025\221\304k\247`\334\355\275($I\234\375\243\263SI3\032\251\371\233\2329\003w\233gO\250\032\fI\305\267x\026\030\371\274\"\247\017\203a\035\263E\253z`$\375"
+	.string	"\222\314(VPid\b\270h\032l\254\224\2277V\301\303vG)SJ\001V\003\273\003\340\003)\334\215\355\351u\337\344v\316%y\345\351o\337\364\313oa\223\204f\346\217\307\023\316\t/\347\254A\203\006\036\r\027\306\230\013\037\031\360\367`\031kc\345\372+\236\205K/<RL\022\232\241\276E\307Qso\005A\316~A\365\276>\277\240\366\255[\373JY\373*Y\373\022Y9\370\216\372I\254\305\b\026\222\324#\223<L\005\276#\263\213\\]\317\367\\\352y^\327\370\313\231\2439Cknr\006\333X\217z\343=j\377\335\212\247Oe\355\017[\373\201\254\3759\326v.\236\305\335:\2203"
+	.string	"\022\200B\022\215\307\256\005\330\276EGe.A3\330\332\327w\266\343\261\315\277X\033\317w\324\2330+O\335\232\301\241\254\031\\G\355\361\035\265\333\345\342\242\364\224p<F\301\341\\\352q>m\247\342o\355\320\234\241\033H\3615\025j\b\322]\234\267\271\233\r\022\232\225~P[Hw?\"t@\252T\214\343;\352\373U\256\t3$\214\036\324\352k\357j\316\326\276\346Sh\224\331\327\260W`\343^A\f\332U\022\211\212\333\233\326\366\025+\206\033\350\214\244\250\264\250\323=\233\326\034\n\232M\324\n\221%\217\237@yj\246\360\305Xz\334~\264\266\223\271\231K\375\314\231\2647q'\315\003\315Y\231s\356\f\272\201I\\\314\346\346\354\224\365\314"
+	.string	"\203\r\374\314\307\\\314\247K\r\2002\304.\347(\360\314\215x\364B{\344\034\265\303\006\031\247\304\r/g(\217\006\r\032j\2465\210\334XqK`u\236\b\254\256\304\227\270\024\203\207Aoh\224\224x8\037\267\003\326v\260\026@2o\320;k;\006\325\373\034\203\3327k\267G\273\235\210\027q$w\331\302\231\301r\206\346\334\020\2111e\005\275\221)\323\003\"\343\261C\375H\373\227{5\006\033\364E~\345\"9g\377\322\300\231s\322\277n\366rN\336\270W\340^\001\346\202\312\nSqWX\373W\034\250\357\250\253\353\250R\245\237\306\351\276\0168\233\361\007\360\200\2007@N\367\245 \352\013@v\200\356'\300W\320\355\030>C\267\027y\n\272\373\355\0070\3441t\373\217\237\240\333\311^"
+	.string	"\317so\272\235\004\037\361"
+	.ascii	"\360\237\336\351\2762;^\202n\307\372\235F\322y\023Ty\013\335"
+	.ascii	"mAwOP\324\375:\335\037A\367\343t\377M\367\333t\177M\367\317t"
+	.ascii	"\177\205\356\227\351\376\265\373c\272\037w\377w\277w;_\267\357"
+	.ascii	"u\373\227n\277\353v.\335\276\245\333\261t\373\225n\247\353\366"
+	.ascii	"\271n\177\353v\266\356&\353\356\261\356.\213\322\355\005\350"
+	.ascii	"~\270n?\353\366\262n\367\352\366\256n\347\352\366 \335\256\325"
+	.ascii	"\355Y\335^\325\355R\335\356\354v\247n\247\321\355\315nW\352\366"
+	.ascii	"\244nG\352\366\025\335\256\242\333\225\335\016\202n\377@\267"
+	.ascii	"\033u\273\007\272]\250\333\201\272\375\001\335\316\201n\337@"
+	.ascii	"\267k\240\273\237t\373\005\335\216\201n\227@w\267u\273\007\335"
+	.ascii	"\016\201ng@w\217\320\335a\335\336\241\333\025\320\355\034t;\207"
+	.ascii	"n\267\240\3333tw\\w\247u7\224\356F\353n\f\272[\255\273g\372\372"
+	.ascii	"\372\372\2721\207nu\355\306\320\001^\334-\006\352\316\312\230"
+	.ascii	"\327\332>\304\277N\372u\257Ef\211\243\264\331ef\214\013\034\355"
+	.ascii	"\263\030\037\221\307\375vo\345\263\3208e\246\220T\366\036?\271"
+	.ascii	"=n i=\376+\300~,\370"
+	.string	")\005\023!\2175,\177CV9\271\247\3530\204\311\324C\343\225\221\360\230\353\247\373\261\030\251\236\226\037U\353\364Q\230>\234\232\263C\235J\314o{\267~*M\345\341<3s^\312H-\034\272\310\226\230=\335\377\326\017\267vs\004\304\252I\221\232\255+q5\036\367\357\306\332?\024k\367w\2539\311\3149\277\210\201f\346\021M{\214{Ow\215_'@w\343|\2731\200 gd\226g\227\365\307X\362F\206\3341\323\234\225OH\017\236\232\312'\032\313\350SF*\261\2209\314\374\204\\Fs\316\311J%\022\004g\316YFs3\243xkz\206>!\263\322\231s\2622'3,\225O\315e4\331\314YF\237\2329\372\224q\2622\311\\\241\314\314\234\034}\322\222\243\316&\3162\352l.\243OM\316d\371\205\253\211\345\t\265\346\310\2452\273HbJ2q\246K\2503\323\345\354`)2\223"
+	.string	"939\231tI\032Nv4uq\304$\351\364\013IGP\316\254\234.\265\2349k\035\t\345$\r\220\320i\336\341Sd\024Sn\221\"\347"
+	.ascii	"$\345\214\364<\3159#s\316?&\0234g\0338\313gRR\316K<I\231\tY\226"
+	.ascii	"\"\347\007\253#k.\243PN`\231\222\3503\253\200\"\375\231\351\236"
+	.ascii	"\230k\024y$\267\340\262>\2330\266\254\311\314\201}\271\030[\247"
+	.ascii	"$\363\256\324\256\365\243\360\314\250\311EUe\245A\2319\233b\343"
+	.ascii	"\355\361\243yZ\223\267\246\363\314\245\377\244\261\320\344<A"
+	.ascii	"\205\252\0348\344\036?\331\233\255SC\230\230\231\225\3150{\023"
+	.ascii	"+\373\2507\275\260\362z\334^^f\206\352jN\305\230\223\027xH@"
+	.string	"\236@?E\017%*\3517q&\335\235\177\311\034zuL\304\256~|\035=\016s\361v\306\367\270\325\032+\330/q\351K?\332\336\365I\230\024Q\362Hl\22099GqI\377\353\221\370t\t\232_\374\2260\263t\301GHRXSq\307\334\255\236}G\355\230,H\334\355\341\330Z\034U9\342\325&\243\251K\372]\357u\2279\371\244\201\020;,A\3602\223y\201\021\036\217\362\303\n\234\221\265cz\254\\OD\306i\003I\362q\307\354\340\202\316,-\233\030\331\262`U\236\211\025\021\022\244\306\254*\253\356q\277\326\003\261@\236\217\"\217;\212\357\2503\256\243\276\017`\377\217\245\036\327\343\n=\2368\354\254\t\224,\227\376\363\261\300\376\371;\376\312\247`9)\225\001\b\264\316\b\336M\026\032T10\356\230\344\332\177e\365\316\234\301>ijn\371\270\347y\310(\2419*#\307\245\t,o\305"
+	.ascii	"\330_\245n=\311\221\367\270q\027\035T*\016*/%\217\247\\\372T"
+	.ascii	"/\025\245\362\261\217\362\351R\306TL\271.[\032j\362\230\271\f"
+	.ascii	"\343\306\322\265?*Z\203\345\t\364\352\361?\001\373\241\032\300"
+	.ascii	"#\212\353\361\375\034\337\204\253\350\346\310\336\274Tyf\360"
+	.ascii	"%\005\340\253X\353~\032\037\343\231\376\305/\275\363e<\216\267"
+	.ascii	"\3613\376\306\303x\247o~\r\227~\323\273\350Wzfc\277\202\345\371"
+	.ascii	"\312n\340\243h\303s0\336gFg\227A\322\267\260\211\311\3319\305"
+	.ascii	"J\027+s)\270\033\027\236]\316\320o\372\374G>\005\003\341\316"
+	.ascii	"\315n\003\277\253\243\363*Y\346\276\351\003|t6\264\272<\356\313"
+	.ascii	"\327}\365\356\236\315\024\2514\027\217\335\351;\252\205<`_03"
+	.ascii	"bj|Y\217u\360\356\027\232<\235\272Z\356\235\177u\240\305\215"
+	.ascii	"\245,\217\333\316w\324\273\006\354\353%\013LM\255\013\227\267"
+	.ascii	"(\263\270\307}\271t_-w\213\3154"
+	.string	"H\020\271\307\276\364\0355\247\013\330\327\256\202\023;\"JY\260\334pIE],\335\327\312\2752s\304mo\310c\177\372\216*A\035\260o\225\233&,\344\322\343\235\024\350\274\240\300\006\343q_\272\356+w\347\342\234l\321\361\270\203\357\250\2774`\337\270\357\232ZV\241"
+	.string	"\347t\342\230{\334\027\256\373R\271o4o\311\252\252\307\016\346;\352\005\327Q\275\t\260\357\224\346\354\305W\332u\273mSI\302d<\356\333\326}\327.\333\t}|_\0367\235\357\2505S\200}\325f\332\240\330y=\246\271Rn\024/uP7J\367M{\245\177\251K\345\223\326c\325u\324\213\006\354\013\345\3225\313d<\216q\035\365\354\354\341\274\230uF\360l\340\246X }9\3227\311\221[v\345h\362oL\212\027\023//\227zf\216 \035\241\302\244oY_2\f6\350+\353V\020\271\261\266Yb3\263{\334\267\311u\322-S\341\207TTH\224\265\023\3605\243)\326W^\353J\013-\217oX\243-\315\341QI\333\240\340\216\036_%w\211K[\355\202\265\215\231\n\251Z\331\332!\360VS/\222\276\321n\031\0313'\251'\351W\267\314/L\356\3063\272\366L\227\227\327\345\202"
+	.ascii	"\222jo\213k\205\334\f\220\"En\227\007\232\\QX\210\241}u\365\370"
+	.ascii	"\001\325\242ok\353rY\350\201\024\022\243\306"
+	.string	"\355\305XsH_./I\246F\254\3246\245=0S\202\004\271ZW\317<\345S\025'=z\\-\036\347\215\243\342\343\271\365\303\002&\307\321\217\276Z?\026]<\232\217\257\217\276\242R\021\"\344\352\313\312\352f\365Uf''\317\020\270!A\261\372f\331\250\300Z\021\367\370^\321\210q\201\273\213\336\b\321C\222\363AEu\253\226\330e\351\342[\236\206\254\270;\372V\375x\264I\275x|u<\030\024?\366\234\025\246\326~z\272R\376\225\225\\\352\210\217g\317M+\022#FT_\251\232!eVa\217/Tg\301w;\224u=,\224\334\035\3559\235o\345\001XN6{\322\220Xwx\231\031\345\202\234\253\251\020\261\0325\256\023\216\231*4\030[nS_\247F\223\261\202\341\326u\231\234\276\234I\230\356\r\247\2647+#\252\036\325\231\362\332x,\032\246\327\023.\0300.\r\017t8\223I\003"
+	.ascii	"i>\020\256\250\325\343\033\343\312p\251\005w\306\363\340\223"
+	.ascii	"\312`\255\355\026\250\267"
+	.string	"\257\317-P[\306\251)\275MwS\252\240\242\007\325\036^\316Q.\2702\310\216\200m\271JW\351\341vn\220\365my\352\241\220$\275I\317\326\264\241\202\312u\341\361R\323\341\004\251]z\221^\r+\2772\322f\354\t\347\024\323\343\310\254\212\220\265\373\256p\351]\361R0\362+3g\220\024Y\272\200\306\016\n\023\223\250\024)\256\212\255\230)\013/$\355\245\257\2127-\2540\0307\337|\2255~U\246\320\210\273G}\225\277\244\274/\371\361M>\030&\237\213\344\343\213l\264\233%y)|\244\205%\301\355x\334+2L\030\234|\024\307\342\351Sx}ks_\372\313\357\2559g\036/\350RO\214]4\032D\257\177\317\367\272x\200=~\274\007s\221\266~D\301\344\315<mp\341\013\373\3158\002\223\366{\302\205\313{!\362\274\371A6\243\256K\277\227\257\262\245+\021\300@\210\021>|\020\214"
+	.string	"\b\025\240@\360\303\005\202\"B\344\020\207,\220\321\320\017q\350c<\032\371H04dD$\026\211\2776\310\2360<\252&\024\215Bm\221\370\013\022\262C\270e\217D,\221\3723*j\215\212A\"\023\212|\206F\240\266(t\004a\250\370Sl\213F\013P\3408\264\320B\033|&`\215F\255\220\r\372\265\254\b\343\320\007\022\304\241\261\025q\323\201\004\266\035\0323 l\207#0\264l\b'\204F\343\007\355p\304L\013m\230\300\b!D\370\264,\t\243\260\315P\302Oq\350\003k,~\270\001Q\302\217\260H\347\246\2056\374\004Y\242aK4:\222\020\016\201 A\034\022\031\2053l+lE\264,\211\232\035\t\210\330\366xBD\004\307\017\332!q\210sb\250\210\275@\016\021\304\005\"\b\226H(B\004\026\260pdOx0Q\364"
+	.string	"D\034\006\331\330p\330\320\032\205E\033Z6\204\235\376\031\032Y\"Kbm\r8H"
+	.string	"\007\035L\374\272C\007\034:\340\240v\207\016\200\300\0168"
+	.string	"\256\315\001\360\266mK\004q\302pH84\262G\233\266\2056\004\031\215 \022\262\306\366\350C,\022\021\025\177\210\354=\006\203\214F\034Uc[t\233\202\366\350\201-1l\177\2044l\020(\204\320\206#\013T$\n\376\030}~\202J8\n\211\332\241\007\023\305\0214m\020\203\f\326c;\034\201[\310\207D\321\005\023E\017\305!qX\204\323B\033*\310\021\342\264A\016\200-q\370#A,N\300\304\020DQ\204c\021\211\034\241\237vh\302\021\007\210m\215l\t\3420\330F`\202\035*2\002!hH(T\201\r\202\370p,\na\247\025\022\031\213AA\266\025\022\207@\306b\361'\b"
+	.string	"6\330\016\211$\314\264C\242Q\005bqx\034\376\260\306\242\340Q\030T\302\030daHX\"\004\020\321\250(\202\310(\034\372\240m\213B\022\260C\354\b\307\017\216\254\321\220\020\003@\303\"\013,\ta;T,\021\034\032b\177\202\255Q\347h,\036\211\3541x\242\204\343\211\241 \233\023\204\202,\220Q;l[!\2618l\207\307b\321\tB\301\023\306\226%*\002\025\203%\020\207C%\204D:-\264\301\247\025\"1\034\n\n\3001Hb\030D,~\250a\201\212\0240\262&\206D2C\305\242\207`\f\020{4\262%Xc\360h,\266E\242\240\t\302\023:m\013Q\320\305\"\326\350\323\026\213F\237\031\240\020-\221%\n\211\214l\321\3141\330\006;\264\304\241\321\257\027\260\200\017\031H\020!\204\365g\203\211\342\210`\321\221\310\207\375\021\006\031\331\2268\364!\016\205D>?\306\243\317\206\001"
+	.ascii	"\2050Q\034\021c\024\n\375`\226H(\202\211\342\210\337\324\245"
+	.ascii	"\241\322@\241'\246T\235\264\232jD]\251>\263e~,\366\302n\007\031"
+	.ascii	"~b\343[cB\221C\215-zF\346\274]\036\266\264\220\302\361R\234\300"
+	.ascii	"Y\301\342t\271\350\234R-\232\256V\234\013\254,\230\251l\352\325"
+	.ascii	"\267\3431"
+	.string	"\256qC\200k<\276\201m4\256\3217?\272\255eR]\202\253\321\302ugE\343V\3355e\315\270YXmI\330d\274\226'\236\016&1`\314)Y\223>n\f\243\373\242\371\234\023\266$S\217=\017\330\370\005\216\272S\362\201\233\230i#\207\024\213\307\230\371%\343DG\225\235\222\213`\263\007v\001\306w\205\344\366\370\312\001\033'\r\240\tZY\013\214\004\305LA\3521FR\223\002\247\207Y\340\025(\230k(\0367\366\201\227}Y]\310|G\305\031\330X\2052F\030\026N\201Q\314@q\004\243\350\276S\034\257\206\311G\224\324\343\327\0026V\306\324P\313\301\003\037\341d\314\221\345\035Nbd\225\f\030n\217[\206\b\260o\337\r\334\230\027\254\033\346\006\2037\250R\3318H\302\034S\004\241\031\031\032I\222tr\n\020\206\242a\230)\242\035\022@EA\216!'\221\214\210\244 \331\331\016\\!"
+	.ascii	"r\304?\341\205"
+	.ascii	"\367\225\207\fO<A\335\223ZO}\204\017\320\205\203^]\023\372\324"
+	.ascii	"C\350\350h\317\301\225\b\350\b\252K\216\265@\310\261\200\b\352"
+	.ascii	"\266\236\342x2\365\3774o\247sy\006\371R\320\326\310\233\1772"
+	.ascii	"\271\004(\245\273\212>_\305\207\302?\260\330\244wB\242\031\322"
+	.ascii	"\355*`\317\"\356\346\004\356\237Te\222-~\245\234\004\275\254"
+	.ascii	"\254\222B^\255\363\322\326\202\200\356#\344\332=\342\037\377"
+	.ascii	"\2526VU\211\212\321\370\241\020\242\200\320\005&l\037i\277 \365"
+	.ascii	"\212ou\373U\023@)5\225\rg\370\232\231\224\370\376\226\355\305"
+	.ascii	"\374.\025\307}c\335\030`\204\220\2353\271I\034\037%7U\240g\241"
+	.ascii	"\321\336\334&\260\335:\002\022$\216\300\335\220E2\203\326\374"
+	.ascii	"\372\347\220\312\200}QN\360\304\265\344\252\254?\254I\254\244"
+	.ascii	"\023\2126\356Z5\365\007\031\327\244\346\261\206<k\253\376\313"
+	.ascii	"3\320\003X*H\262\021\033\322r\265l]:f\375\266\227\373\377\343"
+	.ascii	"\312B\246\025S-\bO\262m\241\315\270PJ\325\243yv\227\201\026\376"
+	.ascii	"\362\207\tq\326\031E\007"
+	.string	">\304\327\3449\201F\321\224\357\333x\305\245M(?\275\270\336!8\270\363\263Vu\306\265\002v]\333\216.?\260\265\006=L\301\"}\020\327pUY\375\256*\235\034\317\231\233\275\223\231~K\3034\031`\n\376\343/K)\311)Hz\214\362R\030MW\032#\f\2757A\244\210\331\366\331\272\b\b\002\310\266\375\313\"\267\311\242\013\264?7\277h6\346{,\263\251\244\016\316\025u\"\311\310\342Y\352\302\373`+\375lB\346Y\225\200\314~r\303R\034\036@pZ\207\325\200\224\231\221$\337\260\347\346\022]\032\003\375\260\267$\215L@\226\340\230\344\376\017Z\362<\220\221\354T\342\201\332\345\027&\241j6Xk\rB<^\251Ib\310\023\310~\224\006\227\214\"{\211*K6\264\365\204h\353\374 \210N7\t>~\231 _\303i\003\264\020\n\213\324i\033~\236\032\305\226\222\202\253\341\207v\0358\200"
+	.ascii	"\003\003\344\204QrN\250s\255\350\261\005\277q\317\237\301\336"
+	.ascii	"@\377\264\242\251\023o:\241\263\365\031g\022*\210\231\204N\203"
+	.string	"'\243{[\212M\312\313&\005\341O\206\327\336\233\341\315D\277\006\r\211!4\247*Q\314\022(\001!$\202\f\241\304~/Wj3\234\330\024\266\312\333R15\300\305\"\002-1\t\222\316\204\237%-\211r\331`\2306\266\275\371\003\204\346\217l\362+\270\373JC\273\311\370\342h\202\337\203Q\345\246\233\004\222M\021\n\032\f!\370\035\227V(&\240\347;\305\224c\006\0020\241l\345\302\364\272M\364\004,\262\206\207\032\003aA\212\036_\223\037;Q\277\355\033\213L\367\324\002\304\\\006\025oO\272\032Y\2228\231\205\203*]d\036\343\342F=\310S\204\207\220\022@3HP\203\024\331DU\266\326\b/s\353YB\315\036h?\002`\336\020\215\236U\231]\3223\263\016-\031\320Y\017'\242\023'\325\t\267w\222\201c\2522=\r,\333\215\261ri\321 \355J&\246\246{\207\037\364\351x\376\206\265"
+	.ascii	"\355\263\013\265\r\300BL\206\326\035yX\333\252\r\366\331\271"
+	.ascii	"\373\\\310\305\374\237.\261 \354\031d\200i\247\362\223%\315,"
+	.ascii	"\343\263\022%\204,\207C\273\347\330Zi<\374\234\033\222-]2\257"
+	.ascii	"\370\341\026\r\031&\220T0iy\022\314V\032\261\3045\345\206+y|"
+	.ascii	"\354\206 $\002\031u\273d\250\034!\342Nt\3164\036\026\005*ze\206"
+	.ascii	"Q\277\033\363\005t:\037\250\270\226\332\354\270\220\2674\f\035"
+	.ascii	"\f$\227\233\205\224\321\f\362?\202[\311\224\n\016\272\373\331"
+	.ascii	"o\267\001\264\305\261@\236\370\323\205t}\315U\326\212\345\002"
+	.ascii	"\301!\367\033l}\200\370X\327"
+	.string	"\031\220\330YP\221p\2717\004fy+P\344\004\372\220\262\322\366Kc\b\020*\356\242o\235\033\021D\241\272\324XI\2704\366\231\233\224\324j\202S\253\221\224\373\2012+\034I\f\217\017\0304\032\324\263I&\034o\376&\230:\t\221\354Z\270\221jr\362\204\033\013\036dU\001 \n\307\207X\243UB\322<K\311\256R\3025\204\036^\272\2741,Q\2662\016\240\213;o\025\315/\373\322)\344\022r_\341\355\260\316\365\322\266])-\305J\270?C\341\273\b\006\261y\2775K9\220q\247\351`\252\224hz7'\036\217_!\351mc\257f\336\200\264\3721/\214:U\341\276\375)\002\2638w\b\233\236\027\233M\301m\205\202\313\241\034gD\224\321\353@\271\ruJ\357&\262\203\245T\027{9x\226\315\272:\302\033\024\312nb\rH\243B\221 \251\312\300\0266\3623\303\207\207\r\273\277\274\204"
+	.string	"\277\rY1l\020\334\3032\241$P\013\362\352\214\001\371*6Gk\324su~V\350.WF\t\373\3671\271\303"
+	.string	"\240\220\314\331\321\"\243\354{\217\225\252T\323\315o&\346\302\370\004\363\205\276L\361\241<*\036\002=\351\"\332\300g"
+	.string	"\2145\021?5\203\245\337\347/\251\341\345F`\263<\372}Y\207\005\377F\371\347\240\013(<\260\016\313^\224\314\037\377\250\244\331\001vW\373\300\340\367\306}\t\256\3469M?0\307m\237;\261r\360\325\024\263&\270\243Cr\332\260>\215\217-}\322\200S\316w\360U\013\357L\233\261\3754\344\027\333\237X\236\264\354\300\b\033\253\n\017\035.\313\003{H\310\007\250lz\371WaKQ\017"
+	.ascii	"`N\354\214b\355\377\303<\323\007V\3365\303\343\260^\340\271\305"
+	.ascii	"\033\351{\360\232\340\307/\303\314wg\202\257\204\037\255\037"
+	.ascii	"\320\177\021n\264k\326\311\206\257\302\342\303\227\203nc\257"
+	.ascii	"\367\2541\003\320\275gVc\313;\324\022\311\213\356\217\341\201"
+	.ascii	"\215\263\340\001+\371q\364\0356\303\277\007c\323K\374\275\025"
+	.text
+	.section	.gnu.lto_.symtab.93c42762a62334e7,"e",@progbits
+	.string	"findBoxByBoxId"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\001"
+	.string	""
+	.string	"findBoxByPermanentId"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\001"
+	.string	""
+	.string	"serializeBoxNameFn"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\001"
+	.string	""
+	.string	"serializeBoxPermanentIdFn"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\001"
+	.string	""
+	.string	"serializeBoxReply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\001"
+	.string	""
+	.string	"initActiveBoxIds"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\001"
+	.string	""
+	.string	"getBoxIdState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\001"
+	.string	""
+	.string	"packFlightModeFlags"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\001"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\001"
+	.string	""
+	.string	"telemetryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\001"
+	.string	""
+	.string	"pinioBoxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\001"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\001"
+	.string	""
+	.string	"bitArrayGet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\001"
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\001"
+	.string	""
+	.string	"sbufWriteString"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\001"
+	.string	""
+	.string	"bitArrayClr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\001"
+	.string	""
+	.string	"bitArraySet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\001"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\001"
+	.string	""
+	.string	"isMotorProtocolDshot"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\001"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\001"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.93c42762a62334e7,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,10824 @@
+# 0 "./src/main/interface/settings.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "./src/main/interface/settings.c"
+# 18 "./src/main/interface/settings.c"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h" 1 3 4
+# 19 "./src/main/interface/settings.c" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 1 3 4
+# 9 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 3 4
+# 1 "/usr/include/stdint.h" 1 3 4
+# 26 "/usr/include/stdint.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 33 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+# 1 "/usr/include/features.h" 1 3 4
+# 392 "/usr/include/features.h" 3 4
+# 1 "/usr/include/features-time64.h" 1 3 4
+# 20 "/usr/include/features-time64.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 21 "/usr/include/features-time64.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 22 "/usr/include/features-time64.h" 2 3 4
+# 393 "/usr/include/features.h" 2 3 4
+# 489 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 1 3 4
+# 561 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 562 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 563 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 490 "/usr/include/features.h" 2 3 4
+# 513 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h" 1 3 4
+# 11 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 2 3 4
+# 514 "/usr/include/features.h" 2 3 4
+# 34 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 2 3 4
+# 27 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 28 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 29 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+
+# 31 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+typedef unsigned char __u_char;
+typedef unsigned short int __u_short;
+typedef unsigned int __u_int;
+typedef unsigned long int __u_long;
+
+
+typedef signed char __int8_t;
+typedef unsigned char __uint8_t;
+typedef signed short int __int16_t;
+typedef unsigned short int __uint16_t;
+typedef signed int __int32_t;
+typedef unsigned int __uint32_t;
+
+typedef signed long int __int64_t;
+typedef unsigned long int __uint64_t;
+
+
+
+
+
+
+typedef __int8_t __int_least8_t;
+typedef __uint8_t __uint_least8_t;
+typedef __int16_t __int_least16_t;
+typedef __uint16_t __uint_least16_t;
+typedef __int32_t __int_least32_t;
+typedef __uint32_t __uint_least32_t;
+typedef __int64_t __int_least64_t;
+typedef __uint64_t __uint_least64_t;
+
+
+
+typedef long int __quad_t;
+typedef unsigned long int __u_quad_t;
+
+
+
+
+
+
+
+typedef long int __intmax_t;
+typedef unsigned long int __uintmax_t;
+# 141 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 1 3 4
+# 142 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/time64.h" 1 3 4
+# 143 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned long int __dev_t;
+typedef unsigned int __uid_t;
+typedef unsigned int __gid_t;
+typedef unsigned long int __ino_t;
+typedef unsigned long int __ino64_t;
+typedef unsigned int __mode_t;
+typedef unsigned long int __nlink_t;
+typedef long int __off_t;
+typedef long int __off64_t;
+typedef int __pid_t;
+typedef struct { int __val[2]; } __fsid_t;
+typedef long int __clock_t;
+typedef unsigned long int __rlim_t;
+typedef unsigned long int __rlim64_t;
+typedef unsigned int __id_t;
+typedef long int __time_t;
+typedef unsigned int __useconds_t;
+typedef long int __suseconds_t;
+typedef long int __suseconds64_t;
+
+typedef int __daddr_t;
+typedef int __key_t;
+
+
+typedef int __clockid_t;
+
+
+typedef void * __timer_t;
+
+
+typedef long int __blksize_t;
+
+
+
+
+typedef long int __blkcnt_t;
+typedef long int __blkcnt64_t;
+
+
+typedef unsigned long int __fsblkcnt_t;
+typedef unsigned long int __fsblkcnt64_t;
+
+
+typedef unsigned long int __fsfilcnt_t;
+typedef unsigned long int __fsfilcnt64_t;
+
+
+typedef long int __fsword_t;
+
+typedef long int __ssize_t;
+
+
+typedef long int __syscall_slong_t;
+
+typedef unsigned long int __syscall_ulong_t;
+
+
+
+typedef __off64_t __loff_t;
+typedef char *__caddr_t;
+
+
+typedef long int __intptr_t;
+
+
+typedef unsigned int __socklen_t;
+
+
+
+
+typedef int __sig_atomic_t;
+# 28 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wchar.h" 1 3 4
+# 29 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 30 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 3 4
+typedef __int8_t int8_t;
+typedef __int16_t int16_t;
+typedef __int32_t int32_t;
+typedef __int64_t int64_t;
+# 35 "/usr/include/stdint.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 3 4
+typedef __uint8_t uint8_t;
+typedef __uint16_t uint16_t;
+typedef __uint32_t uint32_t;
+typedef __uint64_t uint64_t;
+# 38 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+
+typedef __int_least8_t int_least8_t;
+typedef __int_least16_t int_least16_t;
+typedef __int_least32_t int_least32_t;
+typedef __int_least64_t int_least64_t;
+
+
+typedef __uint_least8_t uint_least8_t;
+typedef __uint_least16_t uint_least16_t;
+typedef __uint_least32_t uint_least32_t;
+typedef __uint_least64_t uint_least64_t;
+
+
+
+
+
+typedef signed char int_fast8_t;
+
+typedef long int int_fast16_t;
+typedef long int int_fast32_t;
+typedef long int int_fast64_t;
+# 71 "/usr/include/stdint.h" 3 4
+typedef unsigned char uint_fast8_t;
+
+typedef unsigned long int uint_fast16_t;
+typedef unsigned long int uint_fast32_t;
+typedef unsigned long int uint_fast64_t;
+# 87 "/usr/include/stdint.h" 3 4
+typedef long int intptr_t;
+
+
+typedef unsigned long int uintptr_t;
+# 101 "/usr/include/stdint.h" 3 4
+typedef __intmax_t intmax_t;
+typedef __uintmax_t uintmax_t;
+# 10 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 2 3 4
+# 20 "./src/main/interface/settings.c" 2
+
+# 1 "./src/main/platform.h" 1
+# 18 "./src/main/platform.h"
+       
+# 105 "./src/main/platform.h"
+# 1 "./src/main/target/common_fc_pre.h" 1
+# 18 "./src/main/target/common_fc_pre.h"
+       
+
+
+
+
+
+#pragma GCC diagnostic ignored "-Wsign-conversion"
+# 106 "./src/main/platform.h" 2
+# 1 "./src/main/target/SITL/target.h" 1
+# 20 "./src/main/target/SITL/target.h"
+       
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long int ptrdiff_t;
+# 214 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long unsigned int size_t;
+# 329 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef int wchar_t;
+# 24 "./src/main/target/SITL/target.h" 2
+
+# 1 "./src/main/common/utils.h" 1
+# 18 "./src/main/common/utils.h"
+       
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 21 "./src/main/common/utils.h" 2
+# 96 "./src/main/common/utils.h"
+
+# 96 "./src/main/common/utils.h"
+static inline int16_t cmp16(uint16_t a, uint16_t b) { return (int16_t)(a-b); }
+static inline int32_t cmp32(uint32_t a, uint32_t b) { return (int32_t)(a-b); }
+# 106 "./src/main/common/utils.h"
+void * memcpy_fn ( void * destination, const void * source, size_t num ) asm("memcpy");
+# 26 "./src/main/target/SITL/target.h" 2
+# 152 "./src/main/target/SITL/target.h"
+uint32_t SystemCoreClock;
+
+
+extern uint8_t eepromData[32768];
+
+
+
+
+
+
+
+typedef enum
+{
+    Mode_TEST = 0x0,
+    Mode_Out_PP = 0x10
+} GPIO_Mode;
+
+typedef enum {RESET = 0, SET = !RESET} FlagStatus, ITStatus;
+typedef enum {DISABLE = 0, ENABLE = !DISABLE} FunctionalState;
+typedef enum {TEST_IRQ = 0 } IRQn_Type;
+typedef enum {
+    EXTI_Trigger_Rising = 0x08,
+    EXTI_Trigger_Falling = 0x0C,
+    EXTI_Trigger_Rising_Falling = 0x10
+} EXTITrigger_TypeDef;
+
+typedef struct
+{
+  uint32_t IDR;
+  uint32_t ODR;
+  uint32_t BSRR;
+  uint32_t BRR;
+} GPIO_TypeDef;
+
+
+
+typedef struct
+{
+    void* test;
+} TIM_TypeDef;
+
+typedef struct
+{
+    void* test;
+} TIM_OCInitTypeDef;
+
+typedef struct {
+    void* test;
+} DMA_TypeDef;
+
+typedef struct {
+    void* test;
+} DMA_Channel_TypeDef;
+
+uint8_t DMA_GetFlagStatus(void *);
+void DMA_Cmd(DMA_Channel_TypeDef*, FunctionalState );
+void DMA_ClearFlag(uint32_t);
+
+typedef struct
+{
+    void* test;
+} SPI_TypeDef;
+
+typedef struct
+{
+    void* test;
+} USART_TypeDef;
+# 234 "./src/main/target/SITL/target.h"
+typedef struct
+{
+    void* test;
+} I2C_TypeDef;
+
+typedef enum
+{
+  FLASH_BUSY = 1,
+  FLASH_ERROR_PG,
+  FLASH_ERROR_WRP,
+  FLASH_COMPLETE,
+  FLASH_TIMEOUT
+} FLASH_Status;
+
+typedef struct {
+    double timestamp;
+    double imu_angular_velocity_rpy[3];
+    double imu_linear_acceleration_xyz[3];
+    double imu_orientation_quat[4];
+    double velocity_xyz[3];
+    double position_xyz[3];
+} fdm_packet;
+typedef struct {
+    float motor_speed[4];
+} servo_packet;
+
+void FLASH_Unlock(void);
+void FLASH_Lock(void);
+FLASH_Status FLASH_ErasePage(uintptr_t Page_Address);
+FLASH_Status FLASH_ProgramWord(uintptr_t addr, uint32_t Data);
+
+uint64_t nanos64_real(void);
+uint64_t micros64_real(void);
+uint64_t millis64_real(void);
+void delayMicroseconds_real(uint32_t us);
+uint64_t micros64(void);
+uint64_t millis64(void);
+
+int lockMainPID(void);
+void simulatorPoll(void);
+void lockstepAdvance(void);
+# 107 "./src/main/platform.h" 2
+# 1 "./src/main/target/common_fc_post.h" 1
+# 20 "./src/main/target/common_fc_post.h"
+       
+
+# 1 "./src/main/build/version.h" 1
+# 18 "./src/main/build/version.h"
+       
+# 32 "./src/main/build/version.h"
+extern const char* const targetName;
+
+
+extern const char* const shortGitRevision;
+
+
+extern const char* const buildDate;
+
+
+extern const char* const buildTime;
+# 23 "./src/main/target/common_fc_post.h" 2
+# 108 "./src/main/platform.h" 2
+# 22 "./src/main/interface/settings.c" 2
+
+# 1 "./src/main/build/debug.h" 1
+# 18 "./src/main/build/debug.h"
+       
+
+
+extern int16_t debug[4];
+extern uint8_t debugMode;
+
+
+
+
+
+
+extern uint32_t sectionTimes[2][4];
+# 50 "./src/main/build/debug.h"
+typedef enum {
+    DEBUG_NONE,
+    DEBUG_CYCLETIME,
+    DEBUG_BATTERY,
+    DEBUG_GYRO,
+    DEBUG_ACCELEROMETER,
+    DEBUG_PIDLOOP,
+    DEBUG_GYRO_NOTCH,
+    DEBUG_RC_INTERPOLATION,
+    DEBUG_ANGLERATE,
+    DEBUG_ESC_SENSOR,
+    DEBUG_SCHEDULER,
+    DEBUG_STACK,
+    DEBUG_ESC_SENSOR_RPM,
+    DEBUG_ESC_SENSOR_TMP,
+    DEBUG_ALTITUDE,
+    DEBUG_FFT,
+    DEBUG_FFT_TIME,
+    DEBUG_FFT_FREQ,
+    DEBUG_RX_FRSKY_SPI,
+    DEBUG_GYRO_RAW,
+    DEBUG_MAX7456_SIGNAL,
+    DEBUG_MAX7456_SPICLOCK,
+    DEBUG_SBUS,
+    DEBUG_FPORT,
+    DEBUG_RANGEFINDER,
+    DEBUG_RANGEFINDER_QUALITY,
+    DEBUG_LIDAR_TF,
+    DEBUG_CORE_TEMP,
+    DEBUG_RUNAWAY_TAKEOFF,
+    DEBUG_UART,
+    DEBUG_ALTCTRL,
+    DEBUG_MSG,
+    DEBUG_RCDATA,
+    DEBUG_ANGLE,
+    DEBUG_RCCOMMAND,
+    DEBUG_ATTITUDE,
+    DEBUG_YAW,
+    DEBUG_MSG2,
+    DEBUG_COMMAND,
+    DEBUG_DESIREDANGLE,
+    DEBUG_REQUEST,
+    DEBUG_DT,
+    DEBUG_OL,
+    DEBUG_FP,
+    DEBUG_OLCTRL,
+    DEBUG_PSI,
+    DEBUG_CA,
+    DEBUG_PHIL,
+    DEBUG_RPM_FILTER,
+    DEBUG_COUNT
+} debugType_e;
+
+extern const char * const debugModeNames[DEBUG_COUNT];
+# 24 "./src/main/interface/settings.c" 2
+
+# 1 "./src/main/blackbox/blackbox.h" 1
+# 18 "./src/main/blackbox/blackbox.h"
+       
+
+
+# 1 "./src/main/build/build_config.h" 1
+# 18 "./src/main/build/build_config.h"
+       
+# 22 "./src/main/blackbox/blackbox.h" 2
+# 1 "./src/main/common/time.h" 1
+# 18 "./src/main/common/time.h"
+       
+
+
+
+
+
+
+# 1 "./src/main/pg/pg.h" 1
+# 18 "./src/main/pg/pg.h"
+       
+
+
+
+
+
+
+typedef uint16_t pgn_t;
+
+
+typedef enum {
+    PGRF_NONE = 0,
+    PGRF_CLASSIFICATON_BIT = (1 << 0)
+} pgRegistryFlags_e;
+
+typedef enum {
+    PGR_PGN_MASK = 0x0fff,
+    PGR_PGN_VERSION_MASK = 0xf000,
+    PGR_SIZE_MASK = 0x0fff,
+    PGR_SIZE_SYSTEM_FLAG = 0x0000
+} pgRegistryInternal_e;
+
+
+typedef void (pgResetFunc)(void * , int );
+
+typedef struct pgRegistry_s {
+    pgn_t pgn;
+    uint16_t size;
+    uint8_t *address;
+    uint8_t *copy;
+    uint8_t **ptr;
+    union {
+        void *ptr;
+        pgResetFunc *fn;
+    } reset;
+} pgRegistry_t;
+
+static inline uint16_t pgN(const pgRegistry_t* reg) {return reg->pgn & PGR_PGN_MASK;}
+static inline uint8_t pgVersion(const pgRegistry_t* reg) {return (uint8_t)(reg->pgn >> 12);}
+static inline uint16_t pgSize(const pgRegistry_t* reg) {return reg->size & PGR_SIZE_MASK;}
+# 70 "./src/main/pg/pg.h"
+extern const pgRegistry_t __pg_registry_start[];
+extern const pgRegistry_t __pg_registry_end[];
+
+
+extern const uint8_t __pg_resetdata_start[];
+extern const uint8_t __pg_resetdata_end[];
+# 185 "./src/main/pg/pg.h"
+const pgRegistry_t* pgFind(pgn_t pgn);
+
+void pgLoad(const pgRegistry_t* reg, const void *from, int size, int version);
+int pgStore(const pgRegistry_t* reg, void *to, int size);
+void pgResetAll(void);
+void pgResetInstance(const pgRegistry_t *reg, uint8_t *base);
+
+# 191 "./src/main/pg/pg.h" 3 4
+_Bool 
+# 191 "./src/main/pg/pg.h"
+    pgResetCopy(void *copy, pgn_t pgn);
+void pgReset(const pgRegistry_t* reg);
+# 26 "./src/main/common/time.h" 2
+
+
+typedef int32_t timeDelta_t;
+
+typedef uint32_t timeMs_t ;
+
+
+
+
+
+typedef uint32_t timeUs_t;
+
+
+
+static inline timeDelta_t cmpTimeUs(timeUs_t a, timeUs_t b) { return (timeDelta_t)(a - b); }
+
+
+
+
+
+typedef struct timeConfig_s {
+    int16_t tz_offsetMinutes;
+} timeConfig_t;
+
+extern timeConfig_t timeConfig_System; extern timeConfig_t timeConfig_Copy; static inline const timeConfig_t* timeConfig(void) { return &timeConfig_System; } static inline timeConfig_t* timeConfigMutable(void) { return &timeConfig_System; } struct _dummy;
+
+
+typedef int64_t rtcTime_t;
+
+rtcTime_t rtcTimeMake(int32_t secs, uint16_t millis);
+int32_t rtcTimeGetSeconds(rtcTime_t *t);
+uint16_t rtcTimeGetMillis(rtcTime_t *t);
+
+typedef struct _dateTime_s {
+
+    uint16_t year;
+
+    uint8_t month;
+
+    uint8_t day;
+
+    uint8_t hours;
+
+    uint8_t minutes;
+
+    uint8_t seconds;
+
+    uint16_t millis;
+} dateTime_t;
+
+
+
+# 77 "./src/main/common/time.h" 3 4
+_Bool 
+# 77 "./src/main/common/time.h"
+    dateTimeFormatUTC(char *buf, dateTime_t *dt);
+
+# 78 "./src/main/common/time.h" 3 4
+_Bool 
+# 78 "./src/main/common/time.h"
+    dateTimeFormatLocal(char *buf, dateTime_t *dt);
+
+# 79 "./src/main/common/time.h" 3 4
+_Bool 
+# 79 "./src/main/common/time.h"
+    dateTimeFormatLocalShort(char *buf, dateTime_t *dt);
+
+void dateTimeUTCToLocal(dateTime_t *utcDateTime, dateTime_t *localDateTime);
+
+
+
+
+# 85 "./src/main/common/time.h" 3 4
+_Bool 
+# 85 "./src/main/common/time.h"
+    dateTimeSplitFormatted(char *formatted, char **date, char **time);
+
+
+# 87 "./src/main/common/time.h" 3 4
+_Bool 
+# 87 "./src/main/common/time.h"
+    rtcHasTime(void);
+
+
+# 89 "./src/main/common/time.h" 3 4
+_Bool 
+# 89 "./src/main/common/time.h"
+    rtcGet(rtcTime_t *t);
+
+# 90 "./src/main/common/time.h" 3 4
+_Bool 
+# 90 "./src/main/common/time.h"
+    rtcSet(rtcTime_t *t);
+
+
+# 92 "./src/main/common/time.h" 3 4
+_Bool 
+# 92 "./src/main/common/time.h"
+    rtcGetDateTime(dateTime_t *dt);
+
+# 93 "./src/main/common/time.h" 3 4
+_Bool 
+# 93 "./src/main/common/time.h"
+    rtcSetDateTime(dateTime_t *dt);
+# 23 "./src/main/blackbox/blackbox.h" 2
+
+
+typedef enum BlackboxDevice {
+    BLACKBOX_DEVICE_NONE = 0,
+
+
+
+
+
+
+    BLACKBOX_DEVICE_SERIAL = 3
+} BlackboxDevice_e;
+
+typedef enum FlightLogEvent {
+    FLIGHT_LOG_EVENT_SYNC_BEEP = 0,
+    FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT = 13,
+    FLIGHT_LOG_EVENT_LOGGING_RESUME = 14,
+    FLIGHT_LOG_EVENT_FLIGHTMODE = 30,
+    FLIGHT_LOG_EVENT_LOG_END = 255
+} FlightLogEvent;
+
+typedef struct blackboxConfig_s {
+    uint16_t p_denom;
+    uint8_t device;
+    uint8_t record_acc;
+    uint8_t mode;
+    uint16_t ol_denom;
+} blackboxConfig_t;
+
+extern blackboxConfig_t blackboxConfig_System; extern blackboxConfig_t blackboxConfig_Copy; static inline const blackboxConfig_t* blackboxConfig(void) { return &blackboxConfig_System; } static inline blackboxConfig_t* blackboxConfigMutable(void) { return &blackboxConfig_System; } struct _dummy;
+
+union flightLogEventData_u;
+void blackboxLogEvent(FlightLogEvent event, union flightLogEventData_u *data);
+
+void blackboxInit(void);
+void blackboxSnapshot(timeUs_t currentTimeUs);
+void blackboxUpdate(timeUs_t currentTimeUs);
+uint32_t blackboxGetDroppedFrames(void);
+void blackboxSetStartDateTime(const char *dateTime, timeMs_t timeNowMs);
+int blackboxCalculatePDenom(int rateNum, int rateDenom);
+uint8_t blackboxGetRateNum(void);
+uint8_t blackboxGetRateDenom(void);
+void blackboxValidateConfig(void);
+void blackboxFinish(void);
+
+# 67 "./src/main/blackbox/blackbox.h" 3 4
+_Bool 
+# 67 "./src/main/blackbox/blackbox.h"
+    blackboxMayEditConfig(void);
+# 26 "./src/main/interface/settings.c" 2
+
+# 1 "./src/main/cms/cms.h" 1
+       
+
+# 1 "./src/main/drivers/display.h" 1
+# 18 "./src/main/drivers/display.h"
+       
+
+struct displayPortVTable_s;
+
+typedef struct displayPort_s {
+    const struct displayPortVTable_s *vTable;
+    void *device;
+    uint8_t rows;
+    uint8_t cols;
+    uint8_t posX;
+    uint8_t posY;
+
+
+    
+# 31 "./src/main/drivers/display.h" 3 4
+   _Bool 
+# 31 "./src/main/drivers/display.h"
+        cleared;
+    int8_t cursorRow;
+    int8_t grabCount;
+} displayPort_t;
+
+
+
+typedef struct displayPortVTable_s {
+    int (*grab)(displayPort_t *displayPort);
+    int (*release)(displayPort_t *displayPort);
+    int (*clearScreen)(displayPort_t *displayPort);
+    int (*drawScreen)(displayPort_t *displayPort);
+    int (*screenSize)(const displayPort_t *displayPort);
+    int (*writeString)(displayPort_t *displayPort, uint8_t x, uint8_t y, const char *text);
+    int (*writeChar)(displayPort_t *displayPort, uint8_t x, uint8_t y, uint8_t c);
+    
+# 46 "./src/main/drivers/display.h" 3 4
+   _Bool 
+# 46 "./src/main/drivers/display.h"
+        (*isTransferInProgress)(const displayPort_t *displayPort);
+    int (*heartbeat)(displayPort_t *displayPort);
+    void (*resync)(displayPort_t *displayPort);
+    uint32_t (*txBytesFree)(const displayPort_t *displayPort);
+} displayPortVTable_t;
+
+typedef struct displayPortProfile_s {
+    int8_t colAdjust;
+    int8_t rowAdjust;
+    
+# 55 "./src/main/drivers/display.h" 3 4
+   _Bool 
+# 55 "./src/main/drivers/display.h"
+        invert;
+    uint8_t blackBrightness;
+    uint8_t whiteBrightness;
+} displayPortProfile_t;
+
+void displayGrab(displayPort_t *instance);
+void displayRelease(displayPort_t *instance);
+void displayReleaseAll(displayPort_t *instance);
+
+# 63 "./src/main/drivers/display.h" 3 4
+_Bool 
+# 63 "./src/main/drivers/display.h"
+    displayIsGrabbed(const displayPort_t *instance);
+void displayClearScreen(displayPort_t *instance);
+void displayDrawScreen(displayPort_t *instance);
+int displayScreenSize(const displayPort_t *instance);
+void displaySetXY(displayPort_t *instance, uint8_t x, uint8_t y);
+int displayWrite(displayPort_t *instance, uint8_t x, uint8_t y, const char *s);
+int displayWriteChar(displayPort_t *instance, uint8_t x, uint8_t y, uint8_t c);
+
+# 70 "./src/main/drivers/display.h" 3 4
+_Bool 
+# 70 "./src/main/drivers/display.h"
+    displayIsTransferInProgress(const displayPort_t *instance);
+void displayHeartbeat(displayPort_t *instance);
+void displayResync(displayPort_t *instance);
+uint16_t displayTxBytesFree(const displayPort_t *instance);
+void displayInit(displayPort_t *instance, const displayPortVTable_t *vTable);
+# 4 "./src/main/cms/cms.h" 2
+
+
+
+extern 
+# 7 "./src/main/cms/cms.h" 3 4
+      _Bool 
+# 7 "./src/main/cms/cms.h"
+           cmsInMenu;
+
+
+
+# 10 "./src/main/cms/cms.h" 3 4
+_Bool 
+# 10 "./src/main/cms/cms.h"
+    cmsDisplayPortRegister(displayPort_t *pDisplay);
+displayPort_t *pCurrentDisplay;
+
+
+void cmsInit(void);
+void cmsHandler(timeUs_t currentTimeUs);
+
+long cmsMenuChange(displayPort_t *pPort, const void *ptr);
+long cmsMenuExit(displayPort_t *pPort, const void *ptr);
+void cmsUpdate(uint32_t currentTimeUs);
+# 28 "./src/main/interface/settings.c" 2
+
+
+
+# 1 "./src/main/drivers/adc.h" 1
+# 18 "./src/main/drivers/adc.h"
+       
+
+
+
+# 1 "./src/main/drivers/io_types.h" 1
+# 18 "./src/main/drivers/io_types.h"
+        
+
+
+
+
+
+typedef uint8_t ioTag_t;
+typedef void* IO_t;
+# 45 "./src/main/drivers/io_types.h"
+typedef uint8_t ioConfig_t;
+# 23 "./src/main/drivers/adc.h" 2
+# 1 "./src/main/drivers/time.h" 1
+# 18 "./src/main/drivers/time.h"
+       
+
+
+
+
+
+void delayMicroseconds(timeUs_t us);
+void delay(timeMs_t ms);
+
+timeUs_t micros(void);
+timeUs_t microsISR(void);
+timeMs_t millis(void);
+
+uint32_t ticks(void);
+timeDelta_t ticks_diff_us(uint32_t begin, uint32_t end);
+# 24 "./src/main/drivers/adc.h" 2
+# 43 "./src/main/drivers/adc.h"
+typedef enum ADCDevice {
+    ADCINVALID = -1,
+    ADCDEV_1 = 0,
+
+
+
+
+
+
+
+    ADCDEV_COUNT
+} ADCDevice;
+
+
+
+
+typedef enum {
+    ADC_BATTERY = 0,
+    ADC_CURRENT = 1,
+    ADC_EXTERNAL1 = 2,
+    ADC_RSSI = 3,
+    ADC_CHANNEL_COUNT
+} AdcChannel;
+
+typedef struct adcOperatingConfig_s {
+    ioTag_t tag;
+    uint8_t adcChannel;
+    uint8_t dmaIndex;
+    
+# 71 "./src/main/drivers/adc.h" 3 4
+   _Bool 
+# 71 "./src/main/drivers/adc.h"
+        enabled;
+    uint8_t sampleTime;
+} adcOperatingConfig_t;
+
+struct adcConfig_s;
+void adcInit(const struct adcConfig_s *config);
+uint16_t adcGetChannel(uint8_t channel);
+# 32 "./src/main/interface/settings.c" 2
+# 1 "./src/main/drivers/bus_i2c.h" 1
+# 18 "./src/main/drivers/bus_i2c.h"
+       
+
+
+
+
+# 1 "./src/main/drivers/rcc_types.h" 1
+       
+
+typedef uint8_t rccPeriphTag_t;
+# 24 "./src/main/drivers/bus_i2c.h" 2
+
+
+
+
+
+typedef enum I2CDevice {
+    I2CINVALID = -1,
+    I2CDEV_1 = 0,
+    I2CDEV_2,
+    I2CDEV_3,
+    I2CDEV_4,
+} I2CDevice;
+# 55 "./src/main/drivers/bus_i2c.h"
+struct i2cConfig_s;
+void i2cHardwareConfigure(const struct i2cConfig_s *i2cConfig);
+void i2cInit(I2CDevice device);
+
+# 58 "./src/main/drivers/bus_i2c.h" 3 4
+_Bool 
+# 58 "./src/main/drivers/bus_i2c.h"
+    i2cWriteBuffer(I2CDevice device, uint8_t addr_, uint8_t reg_, uint8_t len_, uint8_t *data);
+
+# 59 "./src/main/drivers/bus_i2c.h" 3 4
+_Bool 
+# 59 "./src/main/drivers/bus_i2c.h"
+    i2cWrite(I2CDevice device, uint8_t addr_, uint8_t reg, uint8_t data);
+
+# 60 "./src/main/drivers/bus_i2c.h" 3 4
+_Bool 
+# 60 "./src/main/drivers/bus_i2c.h"
+    i2cRead(I2CDevice device, uint8_t addr_, uint8_t reg, uint8_t len, uint8_t* buf);
+
+uint16_t i2cGetErrorCounter(void);
+# 33 "./src/main/interface/settings.c" 2
+# 1 "./src/main/drivers/bus_spi.h" 1
+# 18 "./src/main/drivers/bus_spi.h"
+       
+
+# 1 "./src/main/drivers/bus.h" 1
+# 18 "./src/main/drivers/bus.h"
+       
+
+
+
+
+
+
+typedef enum {
+    BUSTYPE_NONE = 0,
+    BUSTYPE_I2C,
+    BUSTYPE_SPI,
+    BUSTYPE_MPU_SLAVE
+} busType_e;
+
+typedef struct busDevice_s {
+    busType_e bustype;
+    union {
+        struct deviceSpi_s {
+            SPI_TypeDef *instance;
+
+
+
+            IO_t csnPin;
+        } spi;
+        struct deviceI2C_s {
+            I2CDevice device;
+            uint8_t address;
+        } i2c;
+        struct deviceMpuSlave_s {
+            const struct busDevice_s *master;
+            uint8_t address;
+        } mpuSlave;
+    } busdev_u;
+} busDevice_t;
+
+
+
+
+
+
+# 57 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 57 "./src/main/drivers/bus.h"
+    busWriteRegister(const busDevice_t *bus, uint8_t reg, uint8_t data);
+
+# 58 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 58 "./src/main/drivers/bus.h"
+    busReadRegisterBuffer(const busDevice_t *bus, uint8_t reg, uint8_t *data, uint8_t length);
+uint8_t busReadRegister(const busDevice_t *bus, uint8_t reg);
+# 21 "./src/main/drivers/bus_spi.h" 2
+
+
+
+
+
+# 1 "./src/main/pg/pg_ids.h" 1
+# 18 "./src/main/pg/pg_ids.h"
+       
+# 27 "./src/main/drivers/bus_spi.h" 2
+# 49 "./src/main/drivers/bus_spi.h"
+typedef enum {
+    SPI_CLOCK_INITIALIZATON = 256,
+# 62 "./src/main/drivers/bus_spi.h"
+    SPI_CLOCK_SLOW = 128,
+    SPI_CLOCK_STANDARD = 4,
+    SPI_CLOCK_FAST = 2,
+    SPI_CLOCK_ULTRAFAST = 2
+
+} SPIClockDivider_e;
+
+typedef enum SPIDevice {
+    SPIINVALID = -1,
+    SPIDEV_1 = 0,
+    SPIDEV_2,
+    SPIDEV_3,
+    SPIDEV_4
+} SPIDevice;
+# 92 "./src/main/drivers/bus_spi.h"
+void spiPreInitCs(ioTag_t iotag);
+void spiPreInitCsOutPU(ioTag_t iotag);
+
+
+# 95 "./src/main/drivers/bus_spi.h" 3 4
+_Bool 
+# 95 "./src/main/drivers/bus_spi.h"
+    spiInit(SPIDevice device);
+void spiSetDivisor(SPI_TypeDef *instance, uint16_t divisor);
+uint8_t spiTransferByte(SPI_TypeDef *instance, uint8_t data);
+
+# 98 "./src/main/drivers/bus_spi.h" 3 4
+_Bool 
+# 98 "./src/main/drivers/bus_spi.h"
+    spiIsBusBusy(SPI_TypeDef *instance);
+
+
+# 100 "./src/main/drivers/bus_spi.h" 3 4
+_Bool 
+# 100 "./src/main/drivers/bus_spi.h"
+    spiTransfer(SPI_TypeDef *instance, const uint8_t *txData, uint8_t *rxData, int len);
+
+uint16_t spiGetErrorCounter(SPI_TypeDef *instance);
+void spiResetErrorCounter(SPI_TypeDef *instance);
+SPIDevice spiDeviceByInstance(SPI_TypeDef *instance);
+SPI_TypeDef *spiInstanceByDevice(SPIDevice device);
+
+
+# 107 "./src/main/drivers/bus_spi.h" 3 4
+_Bool 
+# 107 "./src/main/drivers/bus_spi.h"
+    spiBusTransfer(const busDevice_t *bus, const uint8_t *txData, uint8_t *rxData, int length);
+
+
+# 109 "./src/main/drivers/bus_spi.h" 3 4
+_Bool 
+# 109 "./src/main/drivers/bus_spi.h"
+    spiBusWriteRegister(const busDevice_t *bus, uint8_t reg, uint8_t data);
+
+# 110 "./src/main/drivers/bus_spi.h" 3 4
+_Bool 
+# 110 "./src/main/drivers/bus_spi.h"
+    spiBusReadRegisterBuffer(const busDevice_t *bus, uint8_t reg, uint8_t *data, uint8_t length);
+uint8_t spiBusReadRegister(const busDevice_t *bus, uint8_t reg);
+void spiBusSetInstance(busDevice_t *bus, SPI_TypeDef *instance);
+
+struct spiPinConfig_s;
+void spiPinConfigure(const struct spiPinConfig_s *pConfig);
+# 34 "./src/main/interface/settings.c" 2
+# 1 "./src/main/drivers/camera_control.h" 1
+# 18 "./src/main/drivers/camera_control.h"
+       
+
+
+
+
+typedef enum {
+    CAMERA_CONTROL_KEY_ENTER,
+    CAMERA_CONTROL_KEY_LEFT,
+    CAMERA_CONTROL_KEY_UP,
+    CAMERA_CONTROL_KEY_RIGHT,
+    CAMERA_CONTROL_KEY_DOWN,
+    CAMERA_CONTROL_KEYS_COUNT
+} cameraControlKey_e;
+
+typedef enum {
+    CAMERA_CONTROL_MODE_HARDWARE_PWM,
+    CAMERA_CONTROL_MODE_SOFTWARE_PWM,
+    CAMERA_CONTROL_MODE_DAC,
+    CAMERA_CONTROL_MODES_COUNT
+} cameraControlMode_e;
+
+typedef struct cameraControlConfig_s {
+    cameraControlMode_e mode;
+
+    uint16_t refVoltage;
+    uint16_t keyDelayMs;
+
+    uint16_t internalResistance;
+
+    ioTag_t ioTag;
+} cameraControlConfig_t;
+
+extern cameraControlConfig_t cameraControlConfig_System; extern cameraControlConfig_t cameraControlConfig_Copy; static inline const cameraControlConfig_t* cameraControlConfig(void) { return &cameraControlConfig_System; } static inline cameraControlConfig_t* cameraControlConfigMutable(void) { return &cameraControlConfig_System; } struct _dummy;
+
+void cameraControlInit(void);
+
+void cameraControlProcess(uint32_t currentTimeUs);
+void cameraControlKeyPress(cameraControlKey_e key, uint32_t holdDurationMs);
+# 35 "./src/main/interface/settings.c" 2
+# 1 "./src/main/drivers/light_led.h" 1
+# 18 "./src/main/drivers/light_led.h"
+       
+
+
+
+
+
+
+
+typedef struct statusLedConfig_s {
+    ioTag_t ioTags[3];
+    uint8_t inversion;
+} statusLedConfig_t;
+
+extern statusLedConfig_t statusLedConfig_System; extern statusLedConfig_t statusLedConfig_Copy; static inline const statusLedConfig_t* statusLedConfig(void) { return &statusLedConfig_System; } static inline statusLedConfig_t* statusLedConfigMutable(void) { return &statusLedConfig_System; } struct _dummy;
+# 36 "./src/main/interface/settings.c" 2
+# 1 "./src/main/drivers/pinio.h" 1
+# 18 "./src/main/drivers/pinio.h"
+       
+# 30 "./src/main/drivers/pinio.h"
+struct pinioConfig_s;
+
+void pinioInit(const struct pinioConfig_s *pinioConfig);
+void pinioSet(int index, 
+# 33 "./src/main/drivers/pinio.h" 3 4
+                        _Bool 
+# 33 "./src/main/drivers/pinio.h"
+                             on);
+# 37 "./src/main/interface/settings.c" 2
+# 1 "./src/main/drivers/vtx_common.h" 1
+# 20 "./src/main/drivers/vtx_common.h"
+       
+# 71 "./src/main/drivers/vtx_common.h"
+typedef enum {
+    VTXDEV_UNSUPPORTED = 0,
+    VTXDEV_RTC6705 = 1,
+
+    VTXDEV_SMARTAUDIO = 3,
+    VTXDEV_TRAMP = 4,
+    VTXDEV_UNKNOWN = 0xFF,
+} vtxDevType_e;
+# 109 "./src/main/drivers/vtx_common.h"
+typedef struct vtxDeviceCapability_s {
+    uint8_t bandCount;
+    uint8_t channelCount;
+    uint8_t powerCount;
+    uint8_t filler;
+} vtxDeviceCapability_t;
+
+struct vtxVTable_s;
+typedef struct vtxDevice_s {
+    const struct vtxVTable_s * const vTable;
+
+    vtxDeviceCapability_t capability;
+
+    uint16_t *frequencyTable;
+    char **bandNames;
+    char **channelNames;
+    char **powerNames;
+
+    uint16_t frequency;
+    uint8_t band;
+    uint8_t channel;
+    uint8_t powerIndex;
+    uint8_t pitMode;
+} vtxDevice_t;
+
+
+
+
+
+
+typedef struct vtxVTable_s {
+    void (*process)(vtxDevice_t *vtxDevice, timeUs_t currentTimeUs);
+    vtxDevType_e (*getDeviceType)(const vtxDevice_t *vtxDevice);
+    
+# 142 "./src/main/drivers/vtx_common.h" 3 4
+   _Bool 
+# 142 "./src/main/drivers/vtx_common.h"
+        (*isReady)(const vtxDevice_t *vtxDevice);
+
+    void (*setBandAndChannel)(vtxDevice_t *vtxDevice, uint8_t band, uint8_t channel);
+    void (*setPowerByIndex)(vtxDevice_t *vtxDevice, uint8_t level);
+    void (*setPitMode)(vtxDevice_t *vtxDevice, uint8_t onoff);
+    void (*setFrequency)(vtxDevice_t *vtxDevice, uint16_t freq);
+
+    
+# 149 "./src/main/drivers/vtx_common.h" 3 4
+   _Bool 
+# 149 "./src/main/drivers/vtx_common.h"
+        (*getBandAndChannel)(const vtxDevice_t *vtxDevice, uint8_t *pBand, uint8_t *pChannel);
+    
+# 150 "./src/main/drivers/vtx_common.h" 3 4
+   _Bool 
+# 150 "./src/main/drivers/vtx_common.h"
+        (*getPowerIndex)(const vtxDevice_t *vtxDevice, uint8_t *pIndex);
+    
+# 151 "./src/main/drivers/vtx_common.h" 3 4
+   _Bool 
+# 151 "./src/main/drivers/vtx_common.h"
+        (*getPitMode)(const vtxDevice_t *vtxDevice, uint8_t *pOnOff);
+    
+# 152 "./src/main/drivers/vtx_common.h" 3 4
+   _Bool 
+# 152 "./src/main/drivers/vtx_common.h"
+        (*getFrequency)(const vtxDevice_t *vtxDevice, uint16_t *pFreq);
+} vtxVTable_t;
+
+
+
+
+
+
+void vtxCommonInit(void);
+void vtxCommonSetDevice(vtxDevice_t *vtxDevice);
+vtxDevice_t *vtxCommonDevice(void);
+
+
+void vtxCommonProcess(vtxDevice_t *vtxDevice, timeUs_t currentTimeUs);
+uint8_t vtxCommonGetDeviceType(const vtxDevice_t *vtxDevice);
+void vtxCommonSetBandAndChannel(vtxDevice_t *vtxDevice, uint8_t band, uint8_t channel);
+void vtxCommonSetPowerByIndex(vtxDevice_t *vtxDevice, uint8_t level);
+void vtxCommonSetPitMode(vtxDevice_t *vtxDevice, uint8_t onoff);
+void vtxCommonSetFrequency(vtxDevice_t *vtxDevice, uint16_t freq);
+
+# 171 "./src/main/drivers/vtx_common.h" 3 4
+_Bool 
+# 171 "./src/main/drivers/vtx_common.h"
+    vtxCommonGetBandAndChannel(const vtxDevice_t *vtxDevice, uint8_t *pBand, uint8_t *pChannel);
+
+# 172 "./src/main/drivers/vtx_common.h" 3 4
+_Bool 
+# 172 "./src/main/drivers/vtx_common.h"
+    vtxCommonGetPowerIndex(const vtxDevice_t *vtxDevice, uint8_t *pIndex);
+
+# 173 "./src/main/drivers/vtx_common.h" 3 4
+_Bool 
+# 173 "./src/main/drivers/vtx_common.h"
+    vtxCommonGetPitMode(const vtxDevice_t *vtxDevice, uint8_t *pOnOff);
+
+# 174 "./src/main/drivers/vtx_common.h" 3 4
+_Bool 
+# 174 "./src/main/drivers/vtx_common.h"
+    vtxCommonGetFrequency(const vtxDevice_t *vtxDevice, uint16_t *pFreq);
+
+# 175 "./src/main/drivers/vtx_common.h" 3 4
+_Bool 
+# 175 "./src/main/drivers/vtx_common.h"
+    vtxCommonGetDeviceCapability(const vtxDevice_t *vtxDevice, vtxDeviceCapability_t *pDeviceCapability);
+# 38 "./src/main/interface/settings.c" 2
+
+# 1 "./src/main/fc/config.h" 1
+# 18 "./src/main/fc/config.h"
+       
+# 27 "./src/main/fc/config.h"
+typedef struct pilotConfig_s {
+    char name[16u + 1];
+} pilotConfig_t;
+
+extern pilotConfig_t pilotConfig_System; extern pilotConfig_t pilotConfig_Copy; static inline const pilotConfig_t* pilotConfig(void) { return &pilotConfig_System; } static inline pilotConfig_t* pilotConfigMutable(void) { return &pilotConfig_System; } struct _dummy;
+
+typedef struct systemConfig_s {
+    uint8_t pidProfileIndex;
+    uint8_t activeRateProfile;
+    uint8_t debug_mode;
+    uint8_t task_statistics;
+    uint8_t rateProfile6PosSwitch;
+    uint8_t cpu_overclock;
+    uint8_t powerOnArmingGraceTime;
+    uint8_t scheduler_mode;
+    char boardIdentifier[sizeof("SITL") + 1];
+} systemConfig_t;
+
+extern systemConfig_t systemConfig_System; extern systemConfig_t systemConfig_Copy; static inline const systemConfig_t* systemConfig(void) { return &systemConfig_System; } static inline systemConfig_t* systemConfigMutable(void) { return &systemConfig_System; } struct _dummy;
+
+struct pidProfile_s;
+extern struct pidProfile_s *currentPidProfile;
+
+void beeperOffSet(uint32_t mask);
+void beeperOffSetAll(uint8_t beeperCount);
+void beeperOffClear(uint32_t mask);
+void beeperOffClearAll(void);
+uint32_t getBeeperOffMask(void);
+void setBeeperOffMask(uint32_t mask);
+uint32_t getPreferredBeeperOffMask(void);
+void setPreferredBeeperOffMask(uint32_t mask);
+
+void initEEPROM(void);
+void resetEEPROM(void);
+void readEEPROM(void);
+void writeEEPROM(void);
+void ensureEEPROMContainsValidData(void);
+
+void saveConfigAndNotify(void);
+void validateAndFixGyroConfig(void);
+void activateConfig(void);
+
+uint8_t getCurrentPidProfileIndex(void);
+void changePidProfile(uint8_t pidProfileIndex);
+struct pidProfile_s;
+void resetPidProfile(struct pidProfile_s *profile);
+
+uint8_t getCurrentControlRateProfileIndex(void);
+void changeControlRateProfile(uint8_t profileIndex);
+
+
+# 77 "./src/main/fc/config.h" 3 4
+_Bool 
+# 77 "./src/main/fc/config.h"
+    canSoftwareSerialBeUsed(void);
+
+uint16_t getCurrentMinthrottle(void);
+
+void resetConfigs(void);
+void targetConfiguration(void);
+void targetValidateConfiguration(void);
+# 40 "./src/main/interface/settings.c" 2
+# 1 "./src/main/fc/controlrate_profile.h" 1
+# 18 "./src/main/fc/controlrate_profile.h"
+       
+
+
+
+
+
+
+
+typedef enum {
+    RATES_TYPE_BETAFLIGHT = 0,
+    RATES_TYPE_RACEFLIGHT,
+} ratesType_e;
+
+typedef struct controlRateConfig_s {
+    uint8_t thrMid8;
+    uint8_t thrExpo8;
+    uint8_t rates_type;
+    uint8_t rcRates[3];
+    uint8_t rcExpo[3];
+    uint8_t rates[3];
+    uint8_t dynThrPID;
+    uint16_t tpa_breakpoint;
+} controlRateConfig_t;
+
+extern controlRateConfig_t controlRateProfiles_SystemArray[6]; extern controlRateConfig_t controlRateProfiles_CopyArray[6]; static inline const controlRateConfig_t* controlRateProfiles(int _index) { return &controlRateProfiles_SystemArray[_index]; } static inline controlRateConfig_t* controlRateProfilesMutable(int _index) { return &controlRateProfiles_SystemArray[_index]; } static inline controlRateConfig_t (* controlRateProfiles_array(void))[6] { return &controlRateProfiles_SystemArray; } struct _dummy;
+
+extern controlRateConfig_t *currentControlRateProfile;
+
+void setControlRateProfile(uint8_t controlRateProfileIndex);
+void changeControlRateProfile(uint8_t controlRateProfileIndex);
+
+void copyControlRateProfile(const uint8_t dstControlRateProfileIndex, const uint8_t srcControlRateProfileIndex);
+# 41 "./src/main/interface/settings.c" 2
+# 1 "./src/main/fc/fc_core.h" 1
+# 18 "./src/main/fc/fc_core.h"
+       
+
+
+
+
+
+extern int16_t magHold;
+
+
+extern 
+# 27 "./src/main/fc/fc_core.h" 3 4
+      _Bool 
+# 27 "./src/main/fc/fc_core.h"
+           isRXDataNew;
+
+typedef struct throttleCorrectionConfig_s {
+    uint16_t throttle_correction_angle;
+    uint8_t throttle_correction_value;
+} throttleCorrectionConfig_t;
+
+extern throttleCorrectionConfig_t throttleCorrectionConfig_System; extern throttleCorrectionConfig_t throttleCorrectionConfig_Copy; static inline const throttleCorrectionConfig_t* throttleCorrectionConfig(void) { return &throttleCorrectionConfig_System; } static inline throttleCorrectionConfig_t* throttleCorrectionConfigMutable(void) { return &throttleCorrectionConfig_System; } struct _dummy;
+
+union rollAndPitchTrims_u;
+void applyAndSaveAccelerometerTrimsDelta(union rollAndPitchTrims_u *rollAndPitchTrimsDelta);
+void handleInflightCalibrationStickPosition(void);
+
+void resetArmingDisabled(void);
+
+void disarm(void);
+void tryArm(void);
+
+
+# 45 "./src/main/fc/fc_core.h" 3 4
+_Bool 
+# 45 "./src/main/fc/fc_core.h"
+    processRx(timeUs_t currentTimeUs);
+void updateArmingStatus(void);
+void updateRcCommands(void);
+
+void taskMainPidLoop(timeUs_t currentTimeUs);
+
+# 50 "./src/main/fc/fc_core.h" 3 4
+_Bool 
+# 50 "./src/main/fc/fc_core.h"
+    isFlipOverAfterCrashMode(void);
+
+void runawayTakeoffTemporaryDisable(uint8_t disableFlag);
+# 42 "./src/main/interface/settings.c" 2
+# 1 "./src/main/fc/rc_adjustments.h" 1
+# 18 "./src/main/fc/rc_adjustments.h"
+       
+
+
+
+# 1 "./src/main/fc/rc_modes.h" 1
+# 18 "./src/main/fc/rc_modes.h"
+       
+
+
+
+
+
+
+
+typedef enum {
+
+    BOXARM = 0,
+
+    BOXANGLE,
+    BOXHORIZON,
+    BOXMAG,
+    BOXBARO,
+    BOXGPSHOME,
+    BOXGPSHOLD,
+    BOXHEADFREE,
+    BOXPASSTHRU,
+    BOXRANGEFINDER,
+    BOXFAILSAFE,
+    BOXID_FLIGHTMODE_LAST = BOXFAILSAFE,
+
+
+    BOXANTIGRAVITY,
+    BOXHEADADJ,
+    BOXCAMSTAB,
+    BOXCAMTRIG,
+    BOXBEEPERON,
+    BOXLEDMAX,
+    BOXLEDLOW,
+    BOXLLIGHTS,
+    BOXCALIB,
+    BOXGOV,
+    BOXOSD,
+    BOXTELEMETRY,
+    BOXGTUNE,
+    BOXSERVO1,
+    BOXSERVO2,
+    BOXSERVO3,
+    BOXBLACKBOX,
+    BOXAIRMODE,
+    BOX3D,
+    BOXFPVANGLEMIX,
+    BOXBLACKBOXERASE,
+    BOXCAMERA1,
+    BOXCAMERA2,
+    BOXCAMERA3,
+    BOXFLIPOVERAFTERCRASH,
+    BOXPREARM,
+    BOXBEEPGPSCOUNT,
+    BOXVTXPITMODE,
+    BOXUSER1,
+    BOXUSER2,
+    BOXUSER3,
+    BOXUSER4,
+    CHECKBOX_ITEM_COUNT
+} boxId_e;
+
+typedef enum {
+    MODELOGIC_OR = 0,
+    MODELOGIC_AND
+} modeLogic_e;
+
+
+typedef struct boxBitmask_s { uint32_t bits[(CHECKBOX_ITEM_COUNT + 31) / 32]; } boxBitmask_t;
+# 101 "./src/main/fc/rc_modes.h"
+typedef struct channelRange_s {
+    uint8_t startStep;
+    uint8_t endStep;
+} channelRange_t;
+
+typedef struct modeActivationCondition_s {
+    boxId_e modeId;
+    uint8_t auxChannelIndex;
+    channelRange_t range;
+    modeLogic_e modeLogic;
+} modeActivationCondition_t;
+
+extern modeActivationCondition_t modeActivationConditions_SystemArray[20]; extern modeActivationCondition_t modeActivationConditions_CopyArray[20]; static inline const modeActivationCondition_t* modeActivationConditions(int _index) { return &modeActivationConditions_SystemArray[_index]; } static inline modeActivationCondition_t* modeActivationConditionsMutable(int _index) { return &modeActivationConditions_SystemArray[_index]; } static inline modeActivationCondition_t (* modeActivationConditions_array(void))[20] { return &modeActivationConditions_SystemArray; } struct _dummy;
+
+typedef struct modeActivationProfile_s {
+    modeActivationCondition_t modeActivationConditions[20];
+} modeActivationProfile_t;
+
+
+
+
+# 121 "./src/main/fc/rc_modes.h" 3 4
+_Bool 
+# 121 "./src/main/fc/rc_modes.h"
+    IS_RC_MODE_ACTIVE(boxId_e boxId);
+void rcModeUpdate(boxBitmask_t *newState);
+
+
+# 124 "./src/main/fc/rc_modes.h" 3 4
+_Bool 
+# 124 "./src/main/fc/rc_modes.h"
+    isAirmodeActive(void);
+
+# 125 "./src/main/fc/rc_modes.h" 3 4
+_Bool 
+# 125 "./src/main/fc/rc_modes.h"
+    isAntiGravityModeActive(void);
+
+
+# 127 "./src/main/fc/rc_modes.h" 3 4
+_Bool 
+# 127 "./src/main/fc/rc_modes.h"
+    isRangeActive(uint8_t auxChannelIndex, const channelRange_t *range);
+void updateActivatedModes(void);
+
+# 129 "./src/main/fc/rc_modes.h" 3 4
+_Bool 
+# 129 "./src/main/fc/rc_modes.h"
+    isModeActivationConditionPresent(boxId_e modeId);
+# 23 "./src/main/fc/rc_adjustments.h" 2
+
+typedef enum {
+    ADJUSTMENT_NONE = 0,
+    ADJUSTMENT_RC_RATE,
+    ADJUSTMENT_RC_EXPO,
+    ADJUSTMENT_THROTTLE_EXPO,
+    ADJUSTMENT_PITCH_ROLL_RATE,
+    ADJUSTMENT_YAW_RATE,
+    ADJUSTMENT_PITCH_ROLL_P,
+    ADJUSTMENT_PITCH_ROLL_I,
+    ADJUSTMENT_PITCH_ROLL_D,
+    ADJUSTMENT_YAW_P,
+    ADJUSTMENT_YAW_I,
+    ADJUSTMENT_YAW_D,
+    ADJUSTMENT_RATE_PROFILE,
+    ADJUSTMENT_PITCH_RATE,
+    ADJUSTMENT_ROLL_RATE,
+    ADJUSTMENT_PITCH_P,
+    ADJUSTMENT_PITCH_I,
+    ADJUSTMENT_PITCH_D,
+    ADJUSTMENT_ROLL_P,
+    ADJUSTMENT_ROLL_I,
+    ADJUSTMENT_ROLL_D,
+    ADJUSTMENT_RC_RATE_YAW,
+    ADJUSTMENT_D_SETPOINT,
+    ADJUSTMENT_D_SETPOINT_TRANSITION,
+    ADJUSTMENT_HORIZON_STRENGTH,
+    ADJUSTMENT_ROLL_RC_RATE,
+    ADJUSTMENT_PITCH_RC_RATE,
+    ADJUSTMENT_ROLL_RC_EXPO,
+    ADJUSTMENT_PITCH_RC_EXPO,
+    ADJUSTMENT_FUNCTION_COUNT
+} adjustmentFunction_e;
+
+typedef enum {
+    ADJUSTMENT_MODE_STEP,
+    ADJUSTMENT_MODE_SELECT
+} adjustmentMode_e;
+
+typedef union adjustmentConfig_u {
+    uint8_t step;
+    uint8_t switchPositions;
+} adjustmentData_t;
+
+typedef struct adjustmentConfig_s {
+    uint8_t adjustmentFunction;
+    uint8_t mode;
+    adjustmentData_t data;
+} adjustmentConfig_t;
+
+
+
+typedef struct adjustmentRange_s {
+
+    uint8_t auxChannelIndex;
+    channelRange_t range;
+
+
+    uint8_t adjustmentFunction;
+    uint8_t auxSwitchChannelIndex;
+
+
+    uint8_t adjustmentIndex;
+} adjustmentRange_t;
+
+extern adjustmentRange_t adjustmentRanges_SystemArray[15]; extern adjustmentRange_t adjustmentRanges_CopyArray[15]; static inline const adjustmentRange_t* adjustmentRanges(int _index) { return &adjustmentRanges_SystemArray[_index]; } static inline adjustmentRange_t* adjustmentRangesMutable(int _index) { return &adjustmentRanges_SystemArray[_index]; } static inline adjustmentRange_t (* adjustmentRanges_array(void))[15] { return &adjustmentRanges_SystemArray; } struct _dummy;
+
+
+
+typedef struct adjustmentState_s {
+    uint8_t auxChannelIndex;
+    const adjustmentConfig_t *config;
+    uint32_t timeoutAt;
+} adjustmentState_t;
+
+
+
+
+
+extern const char *adjustmentRangeName;
+extern int adjustmentRangeValue;
+
+void resetAdjustmentStates(void);
+void updateAdjustmentStates(void);
+struct controlRateConfig_s;
+void processRcAdjustments(struct controlRateConfig_s *controlRateConfig);
+struct pidProfile_s;
+void useAdjustmentConfig(struct pidProfile_s *pidProfileToUse);
+# 43 "./src/main/interface/settings.c" 2
+# 1 "./src/main/fc/rc_controls.h" 1
+# 18 "./src/main/fc/rc_controls.h"
+       
+
+
+
+
+
+typedef enum rc_alias {
+    ROLL = 0,
+    PITCH,
+    YAW,
+    THROTTLE,
+    AUX1,
+    AUX2,
+    AUX3,
+    AUX4,
+    AUX5,
+    AUX6,
+    AUX7,
+    AUX8
+} rc_alias_e;
+
+typedef enum {
+    THROTTLE_LOW = 0,
+    THROTTLE_HIGH
+} throttleStatus_e;
+
+
+
+typedef enum {
+    NOT_CENTERED = 0,
+    CENTERED
+} rollPitchStatus_e;
+
+typedef enum {
+    RC_SMOOTHING_OFF = 0,
+    RC_SMOOTHING_DEFAULT,
+    RC_SMOOTHING_AUTO,
+    RC_SMOOTHING_MANUAL
+} rcSmoothing_t;
+# 80 "./src/main/fc/rc_controls.h"
+extern float rcCommand[4];
+
+typedef struct rcControlsConfig_s {
+    uint8_t deadband;
+    uint8_t yaw_deadband;
+    uint8_t alt_hold_deadband;
+    uint8_t alt_hold_fast_change;
+    
+# 87 "./src/main/fc/rc_controls.h" 3 4
+   _Bool 
+# 87 "./src/main/fc/rc_controls.h"
+        yaw_control_reversed;
+} rcControlsConfig_t;
+
+extern rcControlsConfig_t rcControlsConfig_System; extern rcControlsConfig_t rcControlsConfig_Copy; static inline const rcControlsConfig_t* rcControlsConfig(void) { return &rcControlsConfig_System; } static inline rcControlsConfig_t* rcControlsConfigMutable(void) { return &rcControlsConfig_System; } struct _dummy;
+
+typedef struct flight3DConfig_s {
+    uint16_t deadband3d_low;
+    uint16_t deadband3d_high;
+    uint16_t neutral3d;
+    uint16_t deadband3d_throttle;
+    uint8_t switched_mode3d;
+} flight3DConfig_t;
+
+extern flight3DConfig_t flight3DConfig_System; extern flight3DConfig_t flight3DConfig_Copy; static inline const flight3DConfig_t* flight3DConfig(void) { return &flight3DConfig_System; } static inline flight3DConfig_t* flight3DConfigMutable(void) { return &flight3DConfig_System; } struct _dummy;
+
+typedef struct armingConfig_s {
+    uint8_t gyro_cal_on_first_arm;
+    uint8_t auto_disarm_delay;
+} armingConfig_t;
+
+extern armingConfig_t armingConfig_System; extern armingConfig_t armingConfig_Copy; static inline const armingConfig_t* armingConfig(void) { return &armingConfig_System; } static inline armingConfig_t* armingConfigMutable(void) { return &armingConfig_System; } struct _dummy;
+
+
+# 109 "./src/main/fc/rc_controls.h" 3 4
+_Bool 
+# 109 "./src/main/fc/rc_controls.h"
+    areUsingSticksToArm(void);
+
+
+# 111 "./src/main/fc/rc_controls.h" 3 4
+_Bool 
+# 111 "./src/main/fc/rc_controls.h"
+    areSticksInApModePosition(uint16_t ap_mode);
+throttleStatus_e calculateThrottleStatus(void);
+void processRcStickPositions();
+
+
+# 115 "./src/main/fc/rc_controls.h" 3 4
+_Bool 
+# 115 "./src/main/fc/rc_controls.h"
+    isUsingSticksForArming(void);
+
+int32_t getRcStickDeflection(int32_t axis, uint16_t midrc);
+struct pidProfile_s;
+struct modeActivationCondition_s;
+void useRcControlsConfig(struct pidProfile_s *pidProfileToUse);
+# 44 "./src/main/interface/settings.c" 2
+
+# 1 "./src/main/flight/altitude.h" 1
+# 18 "./src/main/flight/altitude.h"
+       
+
+
+
+extern int32_t AltHold;
+extern int32_t my_altitude;
+extern float my_accalt;
+extern float my_acc;
+extern float my_baro;
+extern float my_rangefinder;
+extern float accX_tmp;
+extern float accY_tmp;
+extern float accZ_tmp;
+typedef struct airplaneConfig_s {
+    
+# 32 "./src/main/flight/altitude.h" 3 4
+   _Bool 
+# 32 "./src/main/flight/altitude.h"
+        fixedwing_althold_reversed;
+} airplaneConfig_t;
+
+extern airplaneConfig_t airplaneConfig_System; extern airplaneConfig_t airplaneConfig_Copy; static inline const airplaneConfig_t* airplaneConfig(void) { return &airplaneConfig_System; } static inline airplaneConfig_t* airplaneConfigMutable(void) { return &airplaneConfig_System; } struct _dummy;
+
+typedef struct altHoldConfig_s {
+    uint16_t hover_throttle;
+    uint8_t hover_learn;
+    uint16_t throttle_min;
+    uint16_t throttle_max;
+    uint16_t max_climb_rate;
+    uint16_t max_descent_rate;
+} altHoldConfig_t;
+
+extern altHoldConfig_t altHoldConfig_System; extern altHoldConfig_t altHoldConfig_Copy; static inline const altHoldConfig_t* altHoldConfig(void) { return &altHoldConfig_System; } static inline altHoldConfig_t* altHoldConfigMutable(void) { return &altHoldConfig_System; } struct _dummy;
+
+void calculateEstimatedAltitude(timeUs_t currentTimeUs);
+int32_t getEstimatedAltitude(void);
+int32_t getEstimatedVario(void);
+
+void applyAltHold(void);
+void updateAltHoldState(void);
+void updateRangefinderAltHoldState(void);
+void altHoldInit(void);
+# 46 "./src/main/interface/settings.c" 2
+# 1 "./src/main/flight/failsafe.h" 1
+# 18 "./src/main/flight/failsafe.h"
+       
+# 32 "./src/main/flight/failsafe.h"
+typedef struct failsafeConfig_s {
+    uint16_t failsafe_throttle;
+    uint16_t failsafe_throttle_low_delay;
+    uint8_t failsafe_delay;
+    uint8_t failsafe_off_delay;
+    uint8_t failsafe_kill_switch;
+    uint8_t failsafe_procedure;
+} failsafeConfig_t;
+
+extern failsafeConfig_t failsafeConfig_System; extern failsafeConfig_t failsafeConfig_Copy; static inline const failsafeConfig_t* failsafeConfig(void) { return &failsafeConfig_System; } static inline failsafeConfig_t* failsafeConfigMutable(void) { return &failsafeConfig_System; } struct _dummy;
+
+typedef enum {
+    FAILSAFE_IDLE = 0,
+    FAILSAFE_RX_LOSS_DETECTED,
+    FAILSAFE_LANDING,
+    FAILSAFE_LANDED,
+    FAILSAFE_RX_LOSS_MONITORING,
+    FAILSAFE_RX_LOSS_RECOVERED
+} failsafePhase_e;
+
+typedef enum {
+    FAILSAFE_RXLINK_DOWN = 0,
+    FAILSAFE_RXLINK_UP
+} failsafeRxLinkState_e;
+
+typedef enum {
+    FAILSAFE_PROCEDURE_AUTO_LANDING = 0,
+    FAILSAFE_PROCEDURE_DROP_IT
+} failsafeProcedure_e;
+
+typedef struct failsafeState_s {
+    int16_t events;
+    
+# 64 "./src/main/flight/failsafe.h" 3 4
+   _Bool 
+# 64 "./src/main/flight/failsafe.h"
+        monitoring;
+    
+# 65 "./src/main/flight/failsafe.h" 3 4
+   _Bool 
+# 65 "./src/main/flight/failsafe.h"
+        active;
+    uint32_t rxDataFailurePeriod;
+    uint32_t validRxDataReceivedAt;
+    uint32_t validRxDataFailedAt;
+    uint32_t throttleLowPeriod;
+    uint32_t landingShouldBeFinishedAt;
+    uint32_t receivingRxDataPeriod;
+    uint32_t receivingRxDataPeriodPreset;
+    failsafePhase_e phase;
+    failsafeRxLinkState_e rxLinkState;
+} failsafeState_t;
+
+void failsafeInit(void);
+void failsafeReset(void);
+
+void failsafeStartMonitoring(void);
+void failsafeUpdateState(void);
+
+failsafePhase_e failsafePhase(void);
+
+# 84 "./src/main/flight/failsafe.h" 3 4
+_Bool 
+# 84 "./src/main/flight/failsafe.h"
+    failsafeIsMonitoring(void);
+
+# 85 "./src/main/flight/failsafe.h" 3 4
+_Bool 
+# 85 "./src/main/flight/failsafe.h"
+    failsafeIsActive(void);
+
+# 86 "./src/main/flight/failsafe.h" 3 4
+_Bool 
+# 86 "./src/main/flight/failsafe.h"
+    failsafeIsReceivingRxData(void);
+void failsafeOnRxSuspend(uint32_t suspendPeriod);
+void failsafeOnRxResume(void);
+
+void failsafeOnValidDataReceived(void);
+void failsafeOnValidDataFailed(void);
+# 47 "./src/main/interface/settings.c" 2
+# 1 "./src/main/flight/imu.h" 1
+# 18 "./src/main/flight/imu.h"
+       
+
+# 1 "./src/main/common/axis.h" 1
+# 18 "./src/main/common/axis.h"
+       
+
+typedef enum {
+    X = 0,
+    Y,
+    Z
+} axis_e;
+
+
+
+
+typedef enum {
+    FD_ROLL = 0,
+    FD_PITCH,
+    FD_YAW
+} flight_dynamics_index_t;
+
+
+
+typedef enum {
+    AI_ROLL = 0,
+    AI_PITCH
+} angle_index_t;
+# 21 "./src/main/flight/imu.h" 2
+
+# 1 "./src/main/common/maths.h" 1
+# 18 "./src/main/common/maths.h"
+       
+# 54 "./src/main/common/maths.h"
+typedef int32_t fix12_t;
+
+typedef struct stdev_s
+{
+    float m_oldM, m_newM, m_oldS, m_newS;
+    int m_n;
+} stdev_t;
+
+
+typedef struct fp_vector {
+    float X;
+    float Y;
+    float Z;
+} t_fp_vector_def;
+
+typedef union u_fp_vector {
+    float A[3];
+    t_fp_vector_def V;
+} t_fp_vector;
+
+
+
+typedef struct fp_angles {
+    float roll;
+    float pitch;
+    float yaw;
+} fp_angles_def;
+
+typedef union {
+    float raw[3];
+    fp_angles_def angles;
+} fp_angles_t;
+
+int gcd(int num, int denom);
+float powerf(float base, int exp);
+int32_t applyDeadband(int32_t value, int32_t deadband);
+
+void devClear(stdev_t *dev);
+void devPush(stdev_t *dev, float x);
+float devVariance(stdev_t *dev);
+float devStandardDeviation(stdev_t *dev);
+float degreesToRadians(int16_t degrees);
+
+int scaleRange(int x, int srcFrom, int srcTo, int destFrom, int destTo);
+
+void normalizeV(struct fp_vector *src, struct fp_vector *dest);
+
+void rotateV(struct fp_vector *v, fp_angles_t *delta);
+void buildRotationMatrix(fp_angles_t *delta, float matrix[3][3]);
+
+int32_t quickMedianFilter3(int32_t * v);
+int32_t quickMedianFilter5(int32_t * v);
+int32_t quickMedianFilter7(int32_t * v);
+int32_t quickMedianFilter9(int32_t * v);
+
+float quickMedianFilter3f(float * v);
+float quickMedianFilter5f(float * v);
+float quickMedianFilter7f(float * v);
+float quickMedianFilter9f(float * v);
+
+
+float sin_approx(float x);
+float cos_approx(float x);
+float atan2_approx(float y, float x);
+float acos_approx(float x);
+# 128 "./src/main/common/maths.h"
+void arraySubInt32(int32_t *dest, int32_t *array1, int32_t *array2, int count);
+
+int16_t qPercent(fix12_t q);
+int16_t qMultiply(fix12_t q, int16_t input);
+fix12_t qConstruct(int16_t num, int16_t den);
+
+static inline int constrain(int amt, int low, int high)
+{
+    if (amt < low)
+        return low;
+    else if (amt > high)
+        return high;
+    else
+        return amt;
+}
+
+static inline float constrainf(float amt, float low, float high)
+{
+    if (amt < low)
+        return low;
+    else if (amt > high)
+        return high;
+    else
+        return amt;
+}
+# 23 "./src/main/flight/imu.h" 2
+
+
+
+extern uint32_t accTimeSum;
+extern int accSumCount;
+extern float accVelScale;
+extern int32_t accSum[3];
+
+extern float gyrox;
+extern float gyroy;
+extern float gyroz;
+extern float accmx;
+extern float accmy;
+extern float accmz;
+
+typedef struct {
+    float w,x,y,z;
+} quaternion;
+
+
+typedef struct {
+    float ww,wx,wy,wz,xx,xy,xz,yy,yz,zz;
+} quaternionProducts;
+
+
+typedef union {
+    int16_t raw[3];
+    struct {
+
+        int16_t roll;
+        int16_t pitch;
+        int16_t yaw;
+    } values;
+} attitudeEulerAngles_t;
+
+
+extern attitudeEulerAngles_t attitude;
+
+typedef struct accDeadband_s {
+    uint8_t xy;
+    uint8_t z;
+} accDeadband_t;
+
+typedef struct imuConfig_s {
+    uint16_t dcm_kp;
+    uint16_t dcm_ki;
+    uint8_t small_angle;
+    uint8_t acc_unarmedcal;
+    accDeadband_t accDeadband;
+    uint8_t gyro_rate_integration;
+} imuConfig_t;
+
+extern imuConfig_t imuConfig_System; extern imuConfig_t imuConfig_Copy; static inline const imuConfig_t* imuConfig(void) { return &imuConfig_System; } static inline imuConfig_t* imuConfigMutable(void) { return &imuConfig_System; } struct _dummy;
+
+typedef struct imuRuntimeConfig_s {
+    float dcm_ki;
+    float dcm_kp;
+    uint8_t acc_unarmedcal;
+    uint8_t small_angle;
+    accDeadband_t accDeadband;
+    uint8_t gyro_rate_integration;
+} imuRuntimeConfig_t;
+
+void imuConfigure(uint16_t throttle_correction_angle);
+
+float getCosTiltAngle(void);
+void imuUpdateAttitude(timeUs_t currentTimeUs);
+int16_t calculateThrottleAngleCorrection(uint8_t throttle_correction_value);
+
+void imuResetAccelerationSum(void);
+
+# 93 "./src/main/flight/imu.h" 3 4
+_Bool 
+# 93 "./src/main/flight/imu.h"
+    imuGetEarthAcceleration(float *accEarth);
+void imuGetQuaternion(quaternion *quat);
+void imuGetRotationMatrix(float rotation[3][3]);
+void imuIntegrateGyro(const float *gyroRate, float dt);
+void imuInit(void);
+
+
+void imuSetAttitudeRPY(float roll, float pitch, float yaw);
+void imuSetAttitudeQuat(float w, float x, float y, float z);
+
+
+
+
+
+void imuQuaternionComputeProducts(quaternion *quat, quaternionProducts *quatProd);
+
+# 108 "./src/main/flight/imu.h" 3 4
+_Bool 
+# 108 "./src/main/flight/imu.h"
+    imuQuaternionHeadfreeOffsetSet(void);
+void imuQuaternionHeadfreeTransformVectorEarthToBody(t_fp_vector_def * v);
+# 48 "./src/main/interface/settings.c" 2
+# 1 "./src/main/flight/mixer.h" 1
+# 18 "./src/main/flight/mixer.h"
+       
+
+
+
+
+
+# 1 "./src/main/drivers/pwm_output_counts.h" 1
+# 18 "./src/main/drivers/pwm_output_counts.h"
+       
+# 25 "./src/main/flight/mixer.h" 2
+
+# 1 "./src/main/drivers/pwm_output.h" 1
+# 18 "./src/main/drivers/pwm_output.h"
+       
+
+
+
+
+
+# 1 "./src/main/drivers/timer.h" 1
+# 18 "./src/main/drivers/timer.h"
+       
+
+
+
+
+
+
+
+typedef uint16_t captureCompare_t;
+# 49 "./src/main/drivers/timer.h"
+typedef uint32_t timCCR_t;
+typedef uint32_t timCCER_t;
+typedef uint32_t timSR_t;
+typedef uint32_t timCNT_t;
+
+
+
+
+typedef enum {
+    TIM_USE_ANY = 0x0,
+    TIM_USE_NONE = 0x0,
+    TIM_USE_PPM = 0x1,
+    TIM_USE_PWM = 0x2,
+    TIM_USE_MOTOR = 0x4,
+    TIM_USE_SERVO = 0x8,
+    TIM_USE_LED = 0x10,
+    TIM_USE_TRANSPONDER = 0x20,
+    TIM_USE_BEEPER = 0x40
+} timerUsageFlag_e;
+
+
+struct timerCCHandlerRec_s;
+struct timerOvrHandlerRec_s;
+typedef void timerCCHandlerCallback(struct timerCCHandlerRec_s* self, uint16_t capture);
+typedef void timerOvrHandlerCallback(struct timerOvrHandlerRec_s* self, uint16_t capture);
+
+typedef struct timerCCHandlerRec_s {
+    timerCCHandlerCallback* fn;
+} timerCCHandlerRec_t;
+
+typedef struct timerOvrHandlerRec_s {
+    timerOvrHandlerCallback* fn;
+    struct timerOvrHandlerRec_s* next;
+} timerOvrHandlerRec_t;
+
+typedef struct timerDef_s {
+    TIM_TypeDef *TIMx;
+    rccPeriphTag_t rcc;
+    uint8_t inputIrq;
+} timerDef_t;
+
+typedef struct timerHardware_s {
+    TIM_TypeDef *tim;
+    ioTag_t tag;
+    uint8_t channel;
+    timerUsageFlag_e usageFlags;
+    uint8_t output;
+# 118 "./src/main/drivers/timer.h"
+} timerHardware_t;
+
+typedef enum {
+    TIMER_OUTPUT_NONE = 0,
+    TIMER_OUTPUT_INVERTED = (1 << 0),
+    TIMER_OUTPUT_N_CHANNEL = (1 << 1),
+} timerFlag_e;
+# 146 "./src/main/drivers/timer.h"
+extern const timerHardware_t timerHardware[];
+extern const timerDef_t timerDefinitions[];
+
+typedef enum {
+    TYPE_FREE,
+    TYPE_PWMINPUT,
+    TYPE_PPMINPUT,
+    TYPE_PWMOUTPUT_MOTOR,
+    TYPE_PWMOUTPUT_FAST,
+    TYPE_PWMOUTPUT_SERVO,
+    TYPE_SOFTSERIAL_RX,
+    TYPE_SOFTSERIAL_TX,
+    TYPE_SOFTSERIAL_RXTX,
+    TYPE_SOFTSERIAL_AUXTIMER,
+    TYPE_ADC,
+    TYPE_SERIAL_RX,
+    TYPE_SERIAL_TX,
+    TYPE_SERIAL_RXTX,
+    TYPE_TIMER
+} channelType_t;
+
+void timerConfigure(const timerHardware_t *timHw, uint16_t period, uint32_t hz);
+
+void timerChConfigIC(const timerHardware_t *timHw, 
+# 169 "./src/main/drivers/timer.h" 3 4
+                                                  _Bool 
+# 169 "./src/main/drivers/timer.h"
+                                                       polarityRising, unsigned inputFilterSamples);
+void timerChConfigICDual(const timerHardware_t* timHw, 
+# 170 "./src/main/drivers/timer.h" 3 4
+                                                      _Bool 
+# 170 "./src/main/drivers/timer.h"
+                                                           polarityRising, unsigned inputFilterSamples);
+void timerChICPolarity(const timerHardware_t *timHw, 
+# 171 "./src/main/drivers/timer.h" 3 4
+                                                    _Bool 
+# 171 "./src/main/drivers/timer.h"
+                                                         polarityRising);
+volatile timCCR_t* timerChCCR(const timerHardware_t* timHw);
+volatile timCCR_t* timerChCCRLo(const timerHardware_t* timHw);
+volatile timCCR_t* timerChCCRHi(const timerHardware_t* timHw);
+void timerChConfigOC(const timerHardware_t* timHw, 
+# 175 "./src/main/drivers/timer.h" 3 4
+                                                  _Bool 
+# 175 "./src/main/drivers/timer.h"
+                                                       outEnable, 
+# 175 "./src/main/drivers/timer.h" 3 4
+                                                                  _Bool 
+# 175 "./src/main/drivers/timer.h"
+                                                                       stateHigh);
+void timerChConfigGPIO(const timerHardware_t* timHw, ioConfig_t mode);
+
+void timerChCCHandlerInit(timerCCHandlerRec_t *self, timerCCHandlerCallback *fn);
+void timerChOvrHandlerInit(timerOvrHandlerRec_t *self, timerOvrHandlerCallback *fn);
+void timerChConfigCallbacks(const timerHardware_t *channel, timerCCHandlerRec_t *edgeCallback, timerOvrHandlerRec_t *overflowCallback);
+void timerChConfigCallbacksDual(const timerHardware_t *channel, timerCCHandlerRec_t *edgeCallbackLo, timerCCHandlerRec_t *edgeCallbackHi, timerOvrHandlerRec_t *overflowCallback);
+void timerChITConfigDualLo(const timerHardware_t* timHw, FunctionalState newState);
+void timerChITConfig(const timerHardware_t* timHw, FunctionalState newState);
+void timerChClearCCFlag(const timerHardware_t* timHw);
+
+void timerChInit(const timerHardware_t *timHw, channelType_t type, int irqPriority, uint8_t irq);
+
+void timerInit(void);
+void timerStart(void);
+void timerForceOverflow(TIM_TypeDef *tim);
+
+uint32_t timerClock(TIM_TypeDef *tim);
+
+void configTimeBase(TIM_TypeDef *tim, uint16_t period, uint32_t hz);
+
+rccPeriphTag_t timerRCC(TIM_TypeDef *tim);
+uint8_t timerInputIrq(TIM_TypeDef *tim);
+
+const timerHardware_t *timerGetByTag(ioTag_t tag, timerUsageFlag_e flag);
+
+
+
+
+
+
+
+void timerOCInit(TIM_TypeDef *tim, uint8_t channel, TIM_OCInitTypeDef *init);
+void timerOCPreloadConfig(TIM_TypeDef *tim, uint8_t channel, uint16_t preload);
+
+
+volatile timCCR_t *timerCCR(TIM_TypeDef *tim, uint8_t channel);
+uint16_t timerDmaSource(uint8_t channel);
+
+uint16_t timerGetPrescalerByDesiredHertz(TIM_TypeDef *tim, uint32_t hz);
+uint16_t timerGetPrescalerByDesiredMhz(TIM_TypeDef *tim, uint16_t mhz);
+uint16_t timerGetPeriodByPrescaler(TIM_TypeDef *tim, uint16_t prescaler, uint32_t hz);
+
+int8_t timerGetTIMNumber(const TIM_TypeDef *tim);
+uint8_t timerLookupChannelIndex(const uint16_t channel);
+# 25 "./src/main/drivers/pwm_output.h" 2
+# 40 "./src/main/drivers/pwm_output.h"
+typedef enum {
+    DSHOT_CMD_MOTOR_STOP = 0,
+    DSHOT_CMD_BEACON1,
+    DSHOT_CMD_BEACON2,
+    DSHOT_CMD_BEACON3,
+    DSHOT_CMD_BEACON4,
+    DSHOT_CMD_BEACON5,
+    DSHOT_CMD_ESC_INFO,
+    DSHOT_CMD_SPIN_DIRECTION_1,
+    DSHOT_CMD_SPIN_DIRECTION_2,
+    DSHOT_CMD_3D_MODE_OFF,
+    DSHOT_CMD_3D_MODE_ON,
+    DSHOT_CMD_SETTINGS_REQUEST,
+    DSHOT_CMD_SAVE_SETTINGS,
+    DSHOT_CMD_SPIN_DIRECTION_NORMAL = 20,
+    DSHOT_CMD_SPIN_DIRECTION_REVERSED = 21,
+    DSHOT_CMD_LED0_ON,
+    DSHOT_CMD_LED1_ON,
+    DSHOT_CMD_LED2_ON,
+    DSHOT_CMD_LED3_ON,
+    DSHOT_CMD_LED0_OFF,
+    DSHOT_CMD_LED1_OFF,
+    DSHOT_CMD_LED2_OFF,
+    DSHOT_CMD_LED3_OFF,
+    DSHOT_CMD_AUDIO_STREAM_MODE_ON_OFF = 30,
+    DSHOT_CMD_SILENT_MODE_ON_OFF = 31,
+    DSHOT_CMD_MAX = 47
+} dshotCommands_e;
+
+
+typedef enum {
+    PWM_TYPE_STANDARD = 0,
+    PWM_TYPE_ONESHOT125,
+    PWM_TYPE_ONESHOT42,
+    PWM_TYPE_MULTISHOT,
+    PWM_TYPE_BRUSHED,
+
+
+
+
+
+
+
+    PWM_TYPE_MAX
+} motorPwmProtocolTypes_e;
+# 110 "./src/main/drivers/pwm_output.h"
+typedef struct {
+    TIM_TypeDef *timer;
+# 122 "./src/main/drivers/pwm_output.h"
+    uint32_t dmaBurstBuffer[18 * 4];
+    uint16_t timerDmaSources;
+} motorDmaTimer_t;
+
+typedef struct {
+    ioTag_t ioTag;
+    const timerHardware_t *timerHardware;
+    uint16_t value;
+
+
+
+
+    motorDmaTimer_t *timer;
+    volatile 
+# 135 "./src/main/drivers/pwm_output.h" 3 4
+            _Bool 
+# 135 "./src/main/drivers/pwm_output.h"
+                 requestTelemetry;
+
+
+
+    uint8_t dmaBuffer[18];
+
+
+
+
+
+
+} motorDmaOutput_t;
+
+motorDmaOutput_t *getMotorDmaOutput(uint8_t index);
+
+struct timerHardware_s;
+typedef void pwmWriteFn(uint8_t index, float value);
+typedef void pwmCompleteWriteFn(uint8_t motorCount);
+
+typedef struct {
+    volatile timCCR_t *ccr;
+    TIM_TypeDef *tim;
+} timerChannel_t;
+
+typedef struct {
+    timerChannel_t channel;
+    float pulseScale;
+    float pulseOffset;
+    
+# 163 "./src/main/drivers/pwm_output.h" 3 4
+   _Bool 
+# 163 "./src/main/drivers/pwm_output.h"
+        forceOverflow;
+    
+# 164 "./src/main/drivers/pwm_output.h" 3 4
+   _Bool 
+# 164 "./src/main/drivers/pwm_output.h"
+        enabled;
+    IO_t io;
+} pwmOutputPort_t;
+
+
+typedef struct motorDevConfig_s {
+    uint16_t motorPwmRate;
+    uint8_t motorPwmProtocol;
+    uint8_t motorPwmInversion;
+    uint8_t useUnsyncedPwm;
+    uint8_t useBurstDshot;
+    ioTag_t ioTags[8];
+} motorDevConfig_t;
+
+extern 
+# 178 "./src/main/drivers/pwm_output.h" 3 4
+      _Bool 
+# 178 "./src/main/drivers/pwm_output.h"
+           useBurstDshot;
+
+void motorDevInit(const motorDevConfig_t *motorDevConfig, uint16_t idlePulse, uint8_t motorCount);
+
+typedef struct servoDevConfig_s {
+
+    uint16_t servoCenterPulse;
+    uint16_t servoPwmRate;
+    ioTag_t ioTags[8];
+} servoDevConfig_t;
+
+void servoDevInit(const servoDevConfig_t *servoDevConfig);
+
+void pwmServoConfig(const struct timerHardware_s *timerHardware, uint8_t servoIndex, uint16_t servoPwmRate, uint16_t servoCenterPulse);
+
+
+# 193 "./src/main/drivers/pwm_output.h" 3 4
+_Bool 
+# 193 "./src/main/drivers/pwm_output.h"
+    isMotorProtocolDshot(void);
+# 214 "./src/main/drivers/pwm_output.h"
+void pwmOutConfig(timerChannel_t *channel, const timerHardware_t *timerHardware, uint32_t hz, uint16_t period, uint16_t value, uint8_t inversion);
+
+void pwmWriteMotor(uint8_t index, float value);
+void pwmShutdownPulsesForAllMotors(uint8_t motorCount);
+void pwmCompleteMotorUpdate(uint8_t motorCount);
+
+void pwmWriteServo(uint8_t index, float value);
+
+pwmOutputPort_t *pwmGetMotors(void);
+
+# 223 "./src/main/drivers/pwm_output.h" 3 4
+_Bool 
+# 223 "./src/main/drivers/pwm_output.h"
+    pwmIsSynced(void);
+void pwmDisableMotors(void);
+void pwmEnableMotors(void);
+
+# 226 "./src/main/drivers/pwm_output.h" 3 4
+_Bool 
+# 226 "./src/main/drivers/pwm_output.h"
+    pwmAreMotorsEnabled(void);
+# 27 "./src/main/flight/mixer.h" 2
+# 40 "./src/main/flight/mixer.h"
+typedef enum mixerMode
+{
+    MIXER_TRI = 1,
+    MIXER_QUADP = 2,
+    MIXER_QUADX = 3,
+    MIXER_BICOPTER = 4,
+    MIXER_GIMBAL = 5,
+    MIXER_Y6 = 6,
+    MIXER_HEX6 = 7,
+    MIXER_FLYING_WING = 8,
+    MIXER_Y4 = 9,
+    MIXER_HEX6X = 10,
+    MIXER_OCTOX8 = 11,
+    MIXER_OCTOFLATP = 12,
+    MIXER_OCTOFLATX = 13,
+    MIXER_AIRPLANE = 14,
+    MIXER_HELI_120_CCPM = 15,
+    MIXER_HELI_90_DEG = 16,
+    MIXER_VTAIL4 = 17,
+    MIXER_HEX6H = 18,
+    MIXER_PPM_TO_SERVO = 19,
+    MIXER_DUALCOPTER = 20,
+    MIXER_SINGLECOPTER = 21,
+    MIXER_ATAIL4 = 22,
+    MIXER_CUSTOM = 23,
+    MIXER_CUSTOM_AIRPLANE = 24,
+    MIXER_CUSTOM_TRI = 25,
+    MIXER_QUADX_1234 = 26
+} mixerMode_e;
+
+
+typedef struct motorMixer_s {
+    float throttle;
+    float roll;
+    float pitch;
+    float yaw;
+} motorMixer_t;
+
+extern motorMixer_t customMotorMixer_SystemArray[8]; extern motorMixer_t customMotorMixer_CopyArray[8]; static inline const motorMixer_t* customMotorMixer(int _index) { return &customMotorMixer_SystemArray[_index]; } static inline motorMixer_t* customMotorMixerMutable(int _index) { return &customMotorMixer_SystemArray[_index]; } static inline motorMixer_t (* customMotorMixer_array(void))[8] { return &customMotorMixer_SystemArray; } struct _dummy;
+
+
+typedef struct mixer_s {
+    uint8_t motorCount;
+    uint8_t useServo;
+    const motorMixer_t *motor;
+} mixer_t;
+
+typedef struct mixerConfig_s {
+    uint8_t mixerMode;
+    
+# 89 "./src/main/flight/mixer.h" 3 4
+   _Bool 
+# 89 "./src/main/flight/mixer.h"
+        yaw_motors_reversed;
+} mixerConfig_t;
+
+extern mixerConfig_t mixerConfig_System; extern mixerConfig_t mixerConfig_Copy; static inline const mixerConfig_t* mixerConfig(void) { return &mixerConfig_System; } static inline mixerConfig_t* mixerConfigMutable(void) { return &mixerConfig_System; } struct _dummy;
+
+typedef struct motorConfig_s {
+    motorDevConfig_t dev;
+    uint16_t digitalIdleOffsetValue;
+    uint16_t minthrottle;
+    uint16_t maxthrottle;
+    uint16_t mincommand;
+} motorConfig_t;
+
+extern motorConfig_t motorConfig_System; extern motorConfig_t motorConfig_Copy; static inline const motorConfig_t* motorConfig(void) { return &motorConfig_System; } static inline motorConfig_t* motorConfigMutable(void) { return &motorConfig_System; } struct _dummy;
+
+
+
+extern const mixer_t mixers[];
+extern float motor[8];
+extern float motor_disarmed[8];
+extern float motorOutputHigh, motorOutputLow;
+
+extern float my_throttle;
+
+struct rxConfig_s;
+
+uint8_t getMotorCount(void);
+float getMotorMixRange(void);
+
+# 117 "./src/main/flight/mixer.h" 3 4
+_Bool 
+# 117 "./src/main/flight/mixer.h"
+    areMotorsRunning(void);
+
+# 118 "./src/main/flight/mixer.h" 3 4
+_Bool 
+# 118 "./src/main/flight/mixer.h"
+    mixerIsOutputSaturated(int axis, float errorRate);
+
+void mixerLoadMix(int index, motorMixer_t *customMixers);
+void mixerInit(mixerMode_e mixerMode);
+
+void mixerConfigureOutput(void);
+
+void mixerResetDisarmedMotors(void);
+void mixTable(timeUs_t currentTimeUs, uint8_t vbatPidCompensation);
+void syncMotors(
+# 127 "./src/main/flight/mixer.h" 3 4
+               _Bool 
+# 127 "./src/main/flight/mixer.h"
+                    enabled);
+void writeMotors(void);
+void stopMotors(void);
+void stopPwmAllMotors(void);
+
+float convertExternalToMotor(uint16_t externalValue);
+uint16_t convertMotorToExternal(float motorValue);
+
+# 134 "./src/main/flight/mixer.h" 3 4
+_Bool 
+# 134 "./src/main/flight/mixer.h"
+    mixerIsTricopter(void);
+# 49 "./src/main/interface/settings.c" 2
+# 1 "./src/main/flight/navigation.h" 1
+# 18 "./src/main/flight/navigation.h"
+       
+
+
+# 1 "./src/main/io/gps.h" 1
+# 18 "./src/main/io/gps.h"
+       
+# 32 "./src/main/io/gps.h"
+typedef enum {
+    GPS_NMEA = 0,
+    GPS_UBLOX
+} gpsProvider_e;
+
+typedef enum {
+    SBAS_AUTO = 0,
+    SBAS_EGNOS,
+    SBAS_WAAS,
+    SBAS_MSAS,
+    SBAS_GAGAN
+} sbasMode_e;
+
+
+
+typedef enum {
+    GPS_BAUDRATE_115200 = 0,
+    GPS_BAUDRATE_57600,
+    GPS_BAUDRATE_38400,
+    GPS_BAUDRATE_19200,
+    GPS_BAUDRATE_9600
+} gpsBaudRate_e;
+
+typedef enum {
+    GPS_AUTOCONFIG_OFF = 0,
+    GPS_AUTOCONFIG_ON
+} gpsAutoConfig_e;
+
+typedef enum {
+    GPS_AUTOBAUD_OFF = 0,
+    GPS_AUTOBAUD_ON
+} gpsAutoBaud_e;
+
+
+
+typedef struct gpsConfig_s {
+    gpsProvider_e provider;
+    sbasMode_e sbasMode;
+    gpsAutoConfig_e autoConfig;
+    gpsAutoBaud_e autoBaud;
+} gpsConfig_t;
+
+extern gpsConfig_t gpsConfig_System; extern gpsConfig_t gpsConfig_Copy; static inline const gpsConfig_t* gpsConfig(void) { return &gpsConfig_System; } static inline gpsConfig_t* gpsConfigMutable(void) { return &gpsConfig_System; } struct _dummy;
+
+typedef struct gpsCoordinateDDDMMmmmm_s {
+    int16_t dddmm;
+    int16_t mmmm;
+} gpsCoordinateDDDMMmmmm_t;
+
+
+typedef struct gpsLocation_s {
+    int32_t lat;
+    int32_t lon;
+    uint16_t alt;
+} gpsLocation_t;
+
+typedef struct gpsSolutionData_s {
+    gpsLocation_t llh;
+    uint16_t GPS_altitude;
+    uint16_t groundSpeed;
+    uint16_t groundCourse;
+    uint16_t hdop;
+    uint8_t numSat;
+} gpsSolutionData_t;
+
+typedef enum {
+    GPS_MESSAGE_STATE_IDLE = 0,
+    GPS_MESSAGE_STATE_INIT,
+    GPS_MESSAGE_STATE_SBAS,
+    GPS_MESSAGE_STATE_ENTRY_COUNT
+} gpsMessageState_e;
+
+typedef struct gpsData_s {
+    uint32_t errors;
+    uint32_t timeouts;
+    uint32_t lastMessage;
+    uint32_t lastLastMessage;
+
+    uint32_t state_position;
+    uint32_t state_ts;
+    uint8_t state;
+    uint8_t baudrateIndex;
+    gpsMessageState_e messageState;
+} gpsData_t;
+
+
+extern char gpsPacketLog[21];
+
+extern int32_t GPS_home[2];
+extern uint16_t GPS_distanceToHome;
+extern int16_t GPS_directionToHome;
+extern int16_t GPS_angle[2];
+extern float dTnav;
+extern float GPS_scaleLonDown;
+extern int16_t actual_speed[2];
+extern int16_t nav_takeoff_bearing;
+
+typedef enum {
+    NAV_MODE_NONE = 0,
+    NAV_MODE_POSHOLD,
+    NAV_MODE_WP
+} navigationMode_e;
+extern navigationMode_e nav_mode;
+
+extern gpsData_t gpsData;
+extern gpsSolutionData_t gpsSol;
+
+extern uint8_t GPS_update;
+extern uint32_t GPS_packetCount;
+extern uint32_t GPS_svInfoReceivedCount;
+extern uint8_t GPS_numCh;
+extern uint8_t GPS_svinfo_chn[16];
+extern uint8_t GPS_svinfo_svid[16];
+extern uint8_t GPS_svinfo_quality[16];
+extern uint8_t GPS_svinfo_cno[16];
+
+
+
+
+void gpsInit(void);
+void gpsUpdate(timeUs_t currentTimeUs);
+
+# 153 "./src/main/io/gps.h" 3 4
+_Bool 
+# 153 "./src/main/io/gps.h"
+    gpsNewFrame(uint8_t c);
+struct serialPort_s;
+void gpsEnablePassthrough(struct serialPort_s *gpsPassthroughPort);
+void onGpsNewData(void);
+void GPS_reset_home_position(void);
+void GPS_calc_longitude_scaling(int32_t lat);
+void navNewGpsData(void);
+void GPS_distance_cm_bearing(int32_t *currentLat1, int32_t *currentLon1, int32_t *destinationLat2, int32_t *destinationLon2, uint32_t *dist, int32_t *bearing);
+# 22 "./src/main/flight/navigation.h" 2
+
+
+
+
+typedef struct navigationConfig_s {
+    uint16_t gps_wp_radius;
+    uint8_t gps_lpf;
+    uint8_t nav_slew_rate;
+    uint8_t nav_controls_heading;
+    uint16_t nav_speed_min;
+    uint16_t nav_speed_max;
+    uint16_t ap_mode;
+} navigationConfig_t;
+
+extern navigationConfig_t navigationConfig_System; extern navigationConfig_t navigationConfig_Copy; static inline const navigationConfig_t* navigationConfig(void) { return &navigationConfig_System; } static inline navigationConfig_t* navigationConfigMutable(void) { return &navigationConfig_System; } struct _dummy;
+
+
+extern int32_t GPS_hold[2];
+
+
+void navigationInit(void);
+void GPS_reset_nav(void);
+void GPS_set_next_wp(int32_t* lat, int32_t* lon);
+void gpsUsePIDs(struct pidProfile_s *pidProfile);
+void updateGpsStateForHomeAndHoldMode(void);
+void updateGpsWaypointsAndMode(void);
+# 50 "./src/main/interface/settings.c" 2
+# 1 "./src/main/flight/ol_navigation.h" 1
+# 18 "./src/main/flight/ol_navigation.h"
+       
+# 28 "./src/main/flight/ol_navigation.h"
+typedef struct olNavigationConfig_s {
+    uint16_t nav_rate_hz;
+    uint8_t vision_latency_ms;
+} olNavigationConfig_t;
+
+extern olNavigationConfig_t olNavigationConfig_System; extern olNavigationConfig_t olNavigationConfig_Copy; static inline const olNavigationConfig_t* olNavigationConfig(void) { return &olNavigationConfig_System; } static inline olNavigationConfig_t* olNavigationConfigMutable(void) { return &olNavigationConfig_System; } struct _dummy;
+
+
+typedef struct olSetpoint_s {
+    float phi_cmd;
+    float theta_cmd;
+    float psi_cmd;
+    float alt_cmd;
+    timeUs_t updatedAt;
+} olSetpoint_t;
+
+void ol_navigation_init(void);
+void ol_navigation_update(timeUs_t currentTimeUs);
+const olSetpoint_t *ol_navigation_get_setpoint(void);
+# 51 "./src/main/interface/settings.c" 2
+# 1 "./src/main/flight/pid.h" 1
+# 18 "./src/main/flight/pid.h"
+       
+# 36 "./src/main/flight/pid.h"
+typedef enum {
+    PID_ROLL,
+    PID_PITCH,
+    PID_YAW,
+    PID_ALT,
+    PID_POS,
+    PID_POSR,
+    PID_NAVR,
+    PID_LEVEL,
+    PID_MAG,
+    PID_VEL,
+    PID_ITEM_COUNT
+} pidIndex_e;
+
+typedef enum {
+    SUPEREXPO_YAW_OFF = 0,
+    SUPEREXPO_YAW_ON,
+    SUPEREXPO_YAW_ALWAYS
+} pidSuperExpoYaw_e;
+
+typedef enum {
+    PID_STABILISATION_OFF = 0,
+    PID_STABILISATION_ON
+} pidStabilisationState_e;
+
+typedef enum {
+    PID_CRASH_RECOVERY_OFF = 0,
+    PID_CRASH_RECOVERY_ON,
+    PID_CRASH_RECOVERY_BEEP
+} pidCrashRecovery_e;
+
+typedef struct pid8_s {
+    uint8_t P;
+    uint8_t I;
+    uint8_t D;
+} pid8_t;
+
+typedef struct pidProfile_s {
+    pid8_t pid[PID_ITEM_COUNT];
+
+    uint16_t yaw_lpf_hz;
+    uint16_t dterm_lpf_hz;
+    uint16_t dterm_notch_hz;
+    uint16_t dterm_notch_cutoff;
+    uint8_t dterm_filter_type;
+    uint8_t itermWindupPointPercent;
+    uint16_t pidSumLimit;
+    uint16_t pidSumLimitYaw;
+    uint8_t vbatPidCompensation;
+    uint8_t pidAtMinThrottle;
+    uint8_t levelAngleLimit;
+
+    uint8_t horizon_tilt_effect;
+    uint8_t horizon_tilt_expert_mode;
+
+
+    uint16_t itermThrottleThreshold;
+    uint16_t itermAcceleratorGain;
+    uint8_t setpointRelaxRatio;
+    uint8_t dtermSetpointWeight;
+    uint16_t yawRateAccelLimit;
+    uint16_t rateAccelLimit;
+    uint16_t crash_dthreshold;
+    uint16_t crash_gthreshold;
+    uint16_t crash_setpoint_threshold;
+    uint16_t crash_time;
+    uint16_t crash_delay;
+    uint8_t crash_recovery_angle;
+    uint8_t crash_recovery_rate;
+    pidCrashRecovery_e crash_recovery;
+    uint16_t crash_limit_yaw;
+    uint16_t itermLimit;
+} pidProfile_t;
+
+
+extern pidProfile_t pidProfiles_SystemArray[3]; extern pidProfile_t pidProfiles_CopyArray[3]; static inline const pidProfile_t* pidProfiles(int _index) { return &pidProfiles_SystemArray[_index]; } static inline pidProfile_t* pidProfilesMutable(int _index) { return &pidProfiles_SystemArray[_index]; } static inline pidProfile_t (* pidProfiles_array(void))[3] { return &pidProfiles_SystemArray; } struct _dummy;
+
+
+typedef struct pidConfig_s {
+    uint8_t pid_process_denom;
+    uint8_t runaway_takeoff_prevention;
+    uint16_t runaway_takeoff_deactivate_delay;
+    uint8_t runaway_takeoff_deactivate_throttle;
+} pidConfig_t;
+
+extern pidConfig_t pidConfig_System; extern pidConfig_t pidConfig_Copy; static inline const pidConfig_t* pidConfig(void) { return &pidConfig_System; } static inline pidConfig_t* pidConfigMutable(void) { return &pidConfig_System; } struct _dummy;
+
+union rollAndPitchTrims_u;
+void pidController(const pidProfile_t *pidProfile, const union rollAndPitchTrims_u *angleTrim, timeUs_t currentTimeUs);
+
+extern float axisPID_P[3], axisPID_I[3], axisPID_D[3];
+extern float axisPIDSum[3];
+
+# 128 "./src/main/flight/pid.h" 3 4
+_Bool 
+# 128 "./src/main/flight/pid.h"
+    airmodeWasActivated;
+extern uint32_t targetPidLooptime;
+
+
+extern uint8_t PIDweight[3];
+
+void pidResetITerm(void);
+void pidStabilisationState(pidStabilisationState_e pidControllerState);
+void pidSetItermAccelerator(float newItermAccelerator);
+void pidInitFilters(const pidProfile_t *pidProfile);
+void pidInitConfig(const pidProfile_t *pidProfile);
+void pidInit(const pidProfile_t *pidProfile);
+void pidCopyProfile(uint8_t dstPidProfileIndex, uint8_t srcPidProfileIndex);
+
+# 141 "./src/main/flight/pid.h" 3 4
+_Bool 
+# 141 "./src/main/flight/pid.h"
+    crashRecoveryModeActive(void);
+# 52 "./src/main/interface/settings.c" 2
+# 1 "./src/main/flight/rpm_filter.h" 1
+# 18 "./src/main/flight/rpm_filter.h"
+       
+
+
+
+
+# 1 "./src/main/common/filter.h" 1
+# 18 "./src/main/common/filter.h"
+       
+# 28 "./src/main/common/filter.h"
+struct filter_s;
+typedef struct filter_s filter_t;
+
+typedef struct pt1Filter_s {
+    float state;
+    float k;
+} pt1Filter_t;
+
+typedef struct slewFilter_s {
+    float state;
+    float slewLimit;
+    float threshold;
+} slewFilter_t;
+
+
+typedef struct biquadFilter_s {
+    float b0, b1, b2, a1, a2;
+    float x1, x2, y1, y2;
+} biquadFilter_t;
+
+typedef struct firFilterDenoise_s {
+    int filledCount;
+    int targetCount;
+    int index;
+    float movingSum;
+    float state[120];
+} firFilterDenoise_t;
+
+typedef struct fastKalman_s {
+    float q;
+    float r;
+    float p;
+    float k;
+    float x;
+    float lastX;
+} fastKalman_t;
+
+typedef enum {
+    FILTER_PT1 = 0,
+    FILTER_BIQUAD,
+    FILTER_FIR,
+    FILTER_SLEW
+} filterType_e;
+
+typedef enum {
+    FILTER_LPF,
+    FILTER_NOTCH,
+    FILTER_BPF,
+} biquadFilterType_e;
+
+typedef struct firFilter_s {
+    float *buf;
+    const float *coeffs;
+    float movingSum;
+    uint8_t index;
+    uint8_t count;
+    uint8_t bufLength;
+    uint8_t coeffsLength;
+} firFilter_t;
+# 96 "./src/main/common/filter.h"
+struct filterBank_s;
+typedef struct filterBank_s filterBank_t;
+
+typedef struct pt1FilterBank_s {
+    float state[4];
+    float k[4];
+} pt1FilterBank_t;
+
+typedef struct biquadFilterBank_s {
+    float b0[4], b1[4], b2[4], a1[4], a2[4];
+    float x1[4], x2[4], y1[4], y2[4];
+} biquadFilterBank_t;
+
+typedef struct fastKalmanBank_s {
+    float q[4];
+    float r[4];
+    float p[4];
+    float k[4];
+    float x[4];
+    float lastX[4];
+} fastKalmanBank_t;
+# 125 "./src/main/common/filter.h"
+typedef float (*biquadNotchQFnPtr)(float centerFreq);
+
+typedef struct biquadNotchTable_s {
+    float minHz;
+    float maxHz;
+    float hzToIndex;
+    float b0[128];
+    float a1[128];
+    float a2[128];
+} biquadNotchTable_t;
+
+typedef float (*filterApplyFnPtr)(filter_t *filter, float input);
+typedef void (*filterBankApplyFnPtr)(filterBank_t *bank, float *data);
+
+float nullFilterApply(filter_t *filter, float input);
+
+void biquadFilterInitLPF(biquadFilter_t *filter, float filterFreq, uint32_t refreshRate);
+void biquadFilterInit(biquadFilter_t *filter, float filterFreq, uint32_t refreshRate, float Q, biquadFilterType_e filterType);
+void biquadFilterUpdate(biquadFilter_t *filter, float filterFreq, uint32_t refreshRate, float Q, biquadFilterType_e filterType);
+float biquadFilterApplyDF1(biquadFilter_t *filter, float input);
+float biquadFilterApply(biquadFilter_t *filter, float input);
+float filterGetNotchQ(uint16_t centerFreq, uint16_t cutoff);
+
+void biquadNotchTableInit(biquadNotchTable_t *table, float minHz, float maxHz, uint32_t refreshRate, biquadNotchQFnPtr notchQFn);
+
+void biquadRCFIR2FilterInit(biquadFilter_t *filter, uint16_t f_cut, float dT);
+
+void fastKalmanInit(fastKalman_t *filter, float q, float r, float p);
+float fastKalmanUpdate(fastKalman_t *filter, float input);
+
+
+
+
+void pt1FilterInit(pt1Filter_t *filter, uint8_t f_cut, float dT);
+float pt1FilterApply(pt1Filter_t *filter, float input);
+
+void slewFilterInit(slewFilter_t *filter, float slewLimit, float threshold);
+float slewFilterApply(slewFilter_t *filter, float input);
+
+void firFilterInit(firFilter_t *filter, float *buf, uint8_t bufLength, const float *coeffs);
+void firFilterInit2(firFilter_t *filter, float *buf, uint8_t bufLength, const float *coeffs, uint8_t coeffsLength);
+void firFilterUpdate(firFilter_t *filter, float input);
+void firFilterUpdateAverage(firFilter_t *filter, float input);
+float firFilterApply(const firFilter_t *filter);
+float firFilterUpdateAndApply(firFilter_t *filter, float input);
+float firFilterCalcPartialAverage(const firFilter_t *filter, uint8_t count);
+float firFilterCalcMovingAverage(const firFilter_t *filter);
+float firFilterLastInput(const firFilter_t *filter);
+
+void firFilterDenoiseInit(firFilterDenoise_t *filter, uint8_t gyroSoftLpfHz, uint16_t targetLooptime);
+float firFilterDenoiseUpdate(firFilterDenoise_t *filter, float input);
+
+void pt1FilterBankInit(pt1FilterBank_t *bank, uint8_t f_cut, float dT);
+void pt1FilterBankApply(pt1FilterBank_t *bank, float *data);
+
+void biquadFilterBankInit(biquadFilterBank_t *bank, float filterFreq, uint32_t refreshRate, float Q, biquadFilterType_e filterType);
+void biquadFilterBankInitLPF(biquadFilterBank_t *bank, float filterFreq, uint32_t refreshRate);
+void biquadRCFIR2FilterBankInit(biquadFilterBank_t *bank, uint16_t f_cut, float dT);
+void biquadFilterBankUpdate(biquadFilterBank_t *bank, int lane, float filterFreq, uint32_t refreshRate, float Q, biquadFilterType_e filterType);
+void biquadFilterBankUpdateNotch(biquadFilterBank_t *bank, int lane, const biquadNotchTable_t *table, float filterFreq);
+void biquadFilterBankApply(biquadFilterBank_t *bank, float *data);
+void biquadFilterBankApplyDF1(biquadFilterBank_t *bank, float *data);
+
+void fastKalmanBankInit(fastKalmanBank_t *bank, float q, float r, float p);
+void fastKalmanBankApply(fastKalmanBank_t *bank, float *data);
+# 24 "./src/main/flight/rpm_filter.h" 2
+
+
+
+
+
+typedef struct rpmFilterConfig_s {
+    uint8_t gyro_rpm_notch_harmonics;
+    uint8_t gyro_rpm_notch_min;
+    uint16_t gyro_rpm_notch_q;
+    uint8_t rpm_notch_lpf;
+    uint8_t motor_poles;
+} rpmFilterConfig_t;
+
+extern rpmFilterConfig_t rpmFilterConfig_System; extern rpmFilterConfig_t rpmFilterConfig_Copy; static inline const rpmFilterConfig_t* rpmFilterConfig(void) { return &rpmFilterConfig_System; } static inline rpmFilterConfig_t* rpmFilterConfigMutable(void) { return &rpmFilterConfig_System; } struct _dummy;
+
+typedef struct rpmNotchFilter_s {
+    uint8_t harmonics;
+    uint8_t motorCount;
+    uint8_t notchCount;
+    uint8_t currentMotor;
+    float erpmToHz;
+    float minHz;
+    float maxHz;
+    float q;
+    float omegaPerHz;
+    pt1Filter_t motorFreqFilter[8];
+    float motorFreq[8];
+    biquadFilterBank_t notch[8 * 3];
+} rpmNotchFilter_t;
+
+
+# 54 "./src/main/flight/rpm_filter.h" 3 4
+_Bool 
+# 54 "./src/main/flight/rpm_filter.h"
+    rpmFilterInit(rpmNotchFilter_t *filter, uint32_t targetLooptimeUs);
+void rpmFilterUpdate(rpmNotchFilter_t *filter);
+void rpmFilterApply(rpmNotchFilter_t *filter, float *data);
+float rpmFilterMotorFrequency(const rpmNotchFilter_t *filter, int motor);
+# 53 "./src/main/interface/settings.c" 2
+# 1 "./src/main/flight/servos.h" 1
+# 18 "./src/main/flight/servos.h"
+       
+
+
+
+
+
+
+enum {
+    INPUT_STABILIZED_ROLL = 0,
+    INPUT_STABILIZED_PITCH,
+    INPUT_STABILIZED_YAW,
+    INPUT_STABILIZED_THROTTLE,
+    INPUT_RC_ROLL,
+    INPUT_RC_PITCH,
+    INPUT_RC_YAW,
+    INPUT_RC_THROTTLE,
+    INPUT_RC_AUX1,
+    INPUT_RC_AUX2,
+    INPUT_RC_AUX3,
+    INPUT_RC_AUX4,
+    INPUT_GIMBAL_PITCH,
+    INPUT_GIMBAL_ROLL,
+    INPUT_SOURCE_COUNT
+} inputSource_e;
+
+
+typedef enum {
+    SERVO_GIMBAL_PITCH = 0,
+    SERVO_GIMBAL_ROLL = 1,
+    SERVO_FLAPS = 2,
+    SERVO_FLAPPERON_1 = 3,
+    SERVO_FLAPPERON_2 = 4,
+    SERVO_RUDDER = 5,
+    SERVO_ELEVATOR = 6,
+    SERVO_THROTTLE = 7,
+
+    SERVO_BICOPTER_LEFT = 4,
+    SERVO_BICOPTER_RIGHT = 5,
+
+    SERVO_DUALCOPTER_LEFT = 4,
+    SERVO_DUALCOPTER_RIGHT = 5,
+
+    SERVO_SINGLECOPTER_1 = 3,
+    SERVO_SINGLECOPTER_2 = 4,
+    SERVO_SINGLECOPTER_3 = 5,
+    SERVO_SINGLECOPTER_4 = 6,
+
+    SERVO_HELI_LEFT = 0,
+    SERVO_HELI_RIGHT = 1,
+    SERVO_HELI_TOP = 2,
+    SERVO_HELI_RUD = 3
+
+} servoIndex_e;
+# 86 "./src/main/flight/servos.h"
+typedef struct servoMixer_s {
+    uint8_t targetChannel;
+    uint8_t inputSource;
+    int8_t rate;
+    uint8_t speed;
+    int8_t min;
+    int8_t max;
+    uint8_t box;
+} servoMixer_t;
+
+extern servoMixer_t customServoMixers_SystemArray[(2 * 8)]; extern servoMixer_t customServoMixers_CopyArray[(2 * 8)]; static inline const servoMixer_t* customServoMixers(int _index) { return &customServoMixers_SystemArray[_index]; } static inline servoMixer_t* customServoMixersMutable(int _index) { return &customServoMixers_SystemArray[_index]; } static inline servoMixer_t (* customServoMixers_array(void))[(2 * 8)] { return &customServoMixers_SystemArray; } struct _dummy;
+
+
+
+
+
+typedef struct mixerRules_s {
+    uint8_t servoRuleCount;
+    const servoMixer_t *rule;
+} mixerRules_t;
+
+extern const mixerRules_t servoMixers[];
+
+typedef struct servoParam_s {
+    uint32_t reversedSources;
+    int16_t min;
+    int16_t max;
+    int16_t middle;
+    int8_t rate;
+    int8_t forwardFromChannel;
+} servoParam_t;
+
+extern servoParam_t servoParams_SystemArray[8]; extern servoParam_t servoParams_CopyArray[8]; static inline const servoParam_t* servoParams(int _index) { return &servoParams_SystemArray[_index]; } static inline servoParam_t* servoParamsMutable(int _index) { return &servoParams_SystemArray[_index]; } static inline servoParam_t (* servoParams_array(void))[8] { return &servoParams_SystemArray; } struct _dummy;
+
+typedef struct servoConfig_s {
+    servoDevConfig_t dev;
+    uint16_t servo_lowpass_freq;
+    uint8_t tri_unarmed_servo;
+    uint8_t channelForwardingStartChannel;
+} servoConfig_t;
+
+extern servoConfig_t servoConfig_System; extern servoConfig_t servoConfig_Copy; static inline const servoConfig_t* servoConfig(void) { return &servoConfig_System; } static inline servoConfig_t* servoConfigMutable(void) { return &servoConfig_System; } struct _dummy;
+
+typedef struct servoProfile_s {
+    servoParam_t servoConf[8];
+} servoProfile_t;
+
+extern int16_t servo[8];
+
+
+# 135 "./src/main/flight/servos.h" 3 4
+_Bool 
+# 135 "./src/main/flight/servos.h"
+    isMixerUsingServos(void);
+void writeServos(void);
+void servoMixerLoadMix(int index);
+void loadCustomServoMixer(void);
+int servoDirection(int servoIndex, int fromChannel);
+void servoConfigureOutput(void);
+void servosInit(void);
+void servosFilterInit(void);
+void servoMixer(void);
+
+void servosTricopterInit(void);
+void servosTricopterMixer(void);
+
+# 147 "./src/main/flight/servos.h" 3 4
+_Bool 
+# 147 "./src/main/flight/servos.h"
+    servosTricopterIsEnabledServoUnarmed(void);
+# 54 "./src/main/interface/settings.c" 2
+
+# 1 "./src/main/interface/settings.h" 1
+# 18 "./src/main/interface/settings.h"
+       
+
+
+
+
+
+
+typedef enum {
+    TABLE_OFF_ON = 0,
+    TABLE_UNIT,
+    TABLE_ALIGNMENT,
+
+    TABLE_GPS_PROVIDER,
+    TABLE_GPS_SBAS_MODE,
+
+
+    TABLE_BLACKBOX_DEVICE,
+    TABLE_BLACKBOX_MODE,
+
+    TABLE_CURRENT_METER,
+    TABLE_VOLTAGE_METER,
+
+    TABLE_GIMBAL_MODE,
+
+
+
+
+
+
+
+    TABLE_GYRO_LPF,
+    TABLE_ACC_HARDWARE,
+
+    TABLE_BARO_HARDWARE,
+
+
+    TABLE_MAG_HARDWARE,
+
+    TABLE_DEBUG,
+    TABLE_MOTOR_PWM_PROTOCOL,
+    TABLE_RC_INTERPOLATION,
+    TABLE_RC_INTERPOLATION_CHANNELS,
+    TABLE_LOWPASS_TYPE,
+    TABLE_FAILSAFE,
+    TABLE_CRASH_RECOVERY,
+
+
+
+    TABLE_BUS_TYPE,
+
+
+
+
+    TABLE_RANGEFINDER_HARDWARE,
+
+
+    TABLE_GYRO_OVERFLOW_CHECK,
+
+
+
+
+    TABLE_RATES_TYPE,
+
+
+
+    TABLE_SCHEDULER_MODE,
+    LOOKUP_TABLE_COUNT
+} lookupTableIndex_e;
+
+typedef struct lookupTableEntry_s {
+    const char * const *values;
+    const uint8_t valueCount;
+} lookupTableEntry_t;
+
+
+
+
+
+
+typedef enum {
+
+    VAR_UINT8 = (0 << 0),
+    VAR_INT8 = (1 << 0),
+    VAR_UINT16 = (2 << 0),
+    VAR_INT16 = (3 << 0),
+
+
+    MASTER_VALUE = (0 << 2),
+    PROFILE_VALUE = (1 << 2),
+    PROFILE_RATE_VALUE = (2 << 2),
+
+
+    MODE_DIRECT = (0 << 4),
+    MODE_LOOKUP = (1 << 4),
+    MODE_ARRAY = (2 << 4)
+} cliValueFlag_e;
+
+
+
+
+
+
+typedef struct cliMinMaxConfig_s {
+    const int16_t min;
+    const int16_t max;
+} cliMinMaxConfig_t;
+
+typedef struct cliLookupTableConfig_s {
+    const lookupTableIndex_e tableIndex;
+} cliLookupTableConfig_t;
+
+typedef struct cliArrayLengthConfig_s {
+    const uint8_t length;
+} cliArrayLengthConfig_t;
+
+typedef union {
+    cliLookupTableConfig_t lookup;
+    cliMinMaxConfig_t minmax;
+    cliArrayLengthConfig_t array;
+} cliValueConfig_t;
+
+typedef struct clivalue_s {
+    const char *name;
+    const uint8_t type;
+    const cliValueConfig_t config;
+
+    pgn_t pgn;
+    uint16_t offset;
+} __attribute__((packed)) clivalue_t;
+
+
+extern const lookupTableEntry_t lookupTables[];
+extern const uint16_t valueTableEntryCount;
+
+extern const clivalue_t valueTable[];
+
+
+extern const char * const lookupTableGyroHardware[];
+
+extern const char * const lookupTableAccHardware[];
+
+
+extern const char * const lookupTableBaroHardware[];
+
+
+extern const char * const lookupTableMagHardware[];
+
+
+extern const char * const lookupTableRangefinderHardware[];
+# 56 "./src/main/interface/settings.c" 2
+
+# 1 "./src/main/io/beeper.h" 1
+# 18 "./src/main/io/beeper.h"
+       
+
+
+
+
+typedef enum {
+
+    BEEPER_SILENCE = 0,
+
+    BEEPER_GYRO_CALIBRATED,
+    BEEPER_RX_LOST,
+    BEEPER_RX_LOST_LANDING,
+    BEEPER_DISARMING,
+    BEEPER_ARMING,
+    BEEPER_ARMING_GPS_FIX,
+    BEEPER_BAT_CRIT_LOW,
+    BEEPER_BAT_LOW,
+    BEEPER_GPS_STATUS,
+    BEEPER_RX_SET,
+    BEEPER_ACC_CALIBRATION,
+    BEEPER_ACC_CALIBRATION_FAIL,
+    BEEPER_READY_BEEP,
+    BEEPER_MULTI_BEEPS,
+    BEEPER_DISARM_REPEAT,
+    BEEPER_ARMED,
+    BEEPER_SYSTEM_INIT,
+    BEEPER_USB,
+    BEEPER_BLACKBOX_ERASE,
+    BEEPER_CRASH_FLIP_MODE,
+    BEEPER_CAM_CONNECTION_OPEN,
+    BEEPER_CAM_CONNECTION_CLOSE,
+    BEEPER_ALL,
+    BEEPER_PREFERENCE,
+
+} beeperMode_e;
+
+void beeper(beeperMode_e mode);
+void beeperSilence(void);
+void beeperUpdate(timeUs_t currentTimeUs);
+void beeperConfirmationBeeps(uint8_t beepCount);
+void beeperWarningBeeps(uint8_t beepCount);
+uint32_t getArmingBeepTimeMicros(void);
+beeperMode_e beeperModeForTableIndex(int idx);
+uint32_t beeperModeMaskForTableIndex(int idx);
+const char *beeperNameForTableIndex(int idx);
+int beeperTableEntryCount(void);
+
+# 64 "./src/main/io/beeper.h" 3 4
+_Bool 
+# 64 "./src/main/io/beeper.h"
+    isBeeperOn(void);
+# 58 "./src/main/interface/settings.c" 2
+# 1 "./src/main/io/dashboard.h" 1
+# 18 "./src/main/io/dashboard.h"
+       
+# 36 "./src/main/io/dashboard.h"
+typedef enum {
+    PAGE_WELCOME,
+    PAGE_ARMED,
+    PAGE_BATTERY,
+    PAGE_SENSORS,
+    PAGE_RX,
+    PAGE_PROFILE,
+
+    PAGE_TASKS,
+
+
+    PAGE_GPS,
+
+
+    PAGE_DEBUG,
+
+
+    PAGE_COUNT
+} pageId_e;
+
+void dashboardInit(void);
+void dashboardUpdate(timeUs_t currentTimeUs);
+
+void dashboardShowFixedPage(pageId_e pageId);
+
+void dashboardEnablePageCycling(void);
+void dashboardDisablePageCycling(void);
+void dashboardResetPageCycling(void);
+void dashboardSetNextPageChangeAt(timeUs_t futureMicros);
+# 59 "./src/main/interface/settings.c" 2
+# 1 "./src/main/io/gimbal.h" 1
+# 18 "./src/main/io/gimbal.h"
+       
+
+
+
+typedef enum {
+    GIMBAL_MODE_NORMAL = 0,
+    GIMBAL_MODE_MIXTILT = 1
+} gimbalMode_e;
+
+
+
+typedef struct gimbalConfig_s {
+    uint8_t mode;
+} gimbalConfig_t;
+
+extern gimbalConfig_t gimbalConfig_System; extern gimbalConfig_t gimbalConfig_Copy; static inline const gimbalConfig_t* gimbalConfig(void) { return &gimbalConfig_System; } static inline gimbalConfig_t* gimbalConfigMutable(void) { return &gimbalConfig_System; } struct _dummy;
+# 60 "./src/main/interface/settings.c" 2
+
+# 1 "./src/main/io/ledstrip.h" 1
+# 18 "./src/main/io/ledstrip.h"
+       
+
+# 1 "./src/main/common/color.h" 1
+# 18 "./src/main/common/color.h"
+       
+
+
+typedef enum {
+    RGB_RED = 0,
+    RGB_GREEN,
+    RGB_BLUE
+} colorComponent_e;
+
+
+
+struct rgbColor24bpp_s {
+    uint8_t r;
+    uint8_t g;
+    uint8_t b;
+};
+
+typedef union {
+    struct rgbColor24bpp_s rgb;
+    uint8_t raw[(RGB_BLUE + 1)];
+} rgbColor24bpp_t;
+
+
+
+
+
+typedef enum {
+    HSV_HUE = 0,
+    HSV_SATURATION,
+    HSV_VALUE
+} hsvColorComponent_e;
+
+
+
+typedef struct hsvColor_s {
+    uint16_t h;
+    uint8_t s;
+    uint8_t v;
+} hsvColor_t;
+# 21 "./src/main/io/ledstrip.h" 2
+# 74 "./src/main/io/ledstrip.h"
+typedef enum {
+    LED_MODE_ORIENTATION = 0,
+    LED_MODE_HEADFREE,
+    LED_MODE_HORIZON,
+    LED_MODE_ANGLE,
+    LED_MODE_MAG,
+    LED_MODE_BARO,
+    LED_SPECIAL,
+    LED_AUX_CHANNEL
+} ledModeIndex_e;
+
+typedef enum {
+    LED_SCOLOR_DISARMED = 0,
+    LED_SCOLOR_ARMED,
+    LED_SCOLOR_ANIMATION,
+    LED_SCOLOR_BACKGROUND,
+    LED_SCOLOR_BLINKBACKGROUND,
+    LED_SCOLOR_GPSNOSATS,
+    LED_SCOLOR_GPSNOLOCK,
+    LED_SCOLOR_GPSLOCKED
+} ledSpecialColorIds_e;
+
+typedef enum {
+    LED_DIRECTION_NORTH = 0,
+    LED_DIRECTION_EAST,
+    LED_DIRECTION_SOUTH,
+    LED_DIRECTION_WEST,
+    LED_DIRECTION_UP,
+    LED_DIRECTION_DOWN
+} ledDirectionId_e;
+
+typedef enum {
+    LED_FUNCTION_COLOR,
+    LED_FUNCTION_FLIGHT_MODE,
+    LED_FUNCTION_ARM_STATE,
+    LED_FUNCTION_BATTERY,
+    LED_FUNCTION_RSSI,
+    LED_FUNCTION_GPS,
+    LED_FUNCTION_THRUST_RING
+} ledBaseFunctionId_e;
+
+typedef enum {
+    LED_OVERLAY_THROTTLE,
+    LED_OVERLAY_LARSON_SCANNER,
+    LED_OVERLAY_BLINK,
+    LED_OVERLAY_VTX,
+    LED_OVERLAY_INDICATOR,
+    LED_OVERLAY_WARNING
+} ledOverlayId_e;
+
+typedef struct modeColorIndexes_s {
+    uint8_t color[6];
+} modeColorIndexes_t;
+
+typedef struct specialColorIndexes_s {
+    uint8_t color[11];
+} specialColorIndexes_t;
+
+typedef uint32_t ledConfig_t;
+
+typedef struct ledCounts_s {
+    uint8_t count;
+    uint8_t ring;
+    uint8_t larson;
+    uint8_t ringSeqLen;
+} ledCounts_t;
+
+typedef struct ledStripConfig_s {
+    ledConfig_t ledConfigs[32];
+    hsvColor_t colors[16];
+    modeColorIndexes_t modeColors[6];
+    specialColorIndexes_t specialColors;
+    uint8_t ledstrip_visual_beeper;
+    uint8_t ledstrip_aux_channel;
+    ioTag_t ioTag;
+} ledStripConfig_t;
+
+extern ledStripConfig_t ledStripConfig_System; extern ledStripConfig_t ledStripConfig_Copy; static inline const ledStripConfig_t* ledStripConfig(void) { return &ledStripConfig_System; } static inline ledStripConfig_t* ledStripConfigMutable(void) { return &ledStripConfig_System; } struct _dummy;
+
+hsvColor_t *colors;
+const modeColorIndexes_t *modeColors;
+specialColorIndexes_t specialColors;
+
+
+
+
+
+
+static inline uint8_t ledGetXY(const ledConfig_t *lcfg) { return ((*lcfg >> 0) & ((1 << (8)) - 1)); }
+static inline uint8_t ledGetX(const ledConfig_t *lcfg) { return ((*lcfg >> (0 + 4)) & 0x0F); }
+static inline uint8_t ledGetY(const ledConfig_t *lcfg) { return ((*lcfg >> (0 + 0)) & 0x0F); }
+static inline uint8_t ledGetFunction(const ledConfig_t *lcfg) { return ((*lcfg >> 8) & ((1 << (4)) - 1)); }
+static inline uint8_t ledGetOverlay(const ledConfig_t *lcfg) { return ((*lcfg >> 12) & ((1 << (6)) - 1)); }
+static inline uint8_t ledGetColor(const ledConfig_t *lcfg) { return ((*lcfg >> 18) & ((1 << (4)) - 1)); }
+static inline uint8_t ledGetDirection(const ledConfig_t *lcfg) { return ((*lcfg >> 22) & ((1 << (6)) - 1)); }
+static inline uint8_t ledGetParams(const ledConfig_t *lcfg) { return ((*lcfg >> 28) & ((1 << (4)) - 1)); }
+
+static inline 
+# 171 "./src/main/io/ledstrip.h" 3 4
+             _Bool 
+# 171 "./src/main/io/ledstrip.h"
+                  ledGetOverlayBit(const ledConfig_t *lcfg, int id) { return ((ledGetOverlay(lcfg) >> id) & 1); }
+static inline 
+# 172 "./src/main/io/ledstrip.h" 3 4
+             _Bool 
+# 172 "./src/main/io/ledstrip.h"
+                  ledGetDirectionBit(const ledConfig_t *lcfg, int id) { return ((ledGetDirection(lcfg) >> id) & 1); }
+
+
+# 174 "./src/main/io/ledstrip.h" 3 4
+_Bool 
+# 174 "./src/main/io/ledstrip.h"
+    parseColor(int index, const char *colorConfig);
+
+
+# 176 "./src/main/io/ledstrip.h" 3 4
+_Bool 
+# 176 "./src/main/io/ledstrip.h"
+    parseLedStripConfig(int ledIndex, const char *config);
+void generateLedConfig(ledConfig_t *ledConfig, char *ledConfigBuffer, size_t bufferSize);
+void reevaluateLedConfig(void);
+
+void ledStripInit(void);
+void ledStripEnable(void);
+void ledStripUpdate(timeUs_t currentTimeUs);
+
+
+# 184 "./src/main/io/ledstrip.h" 3 4
+_Bool 
+# 184 "./src/main/io/ledstrip.h"
+    setModeColor(ledModeIndex_e modeIndex, int modeColorIndex, int colorIndex);
+
+void applyDefaultLedStripConfig(ledConfig_t *ledConfig);
+void applyDefaultColors(hsvColor_t *colors);
+void applyDefaultModeColors(modeColorIndexes_t *modeColors);
+void applyDefaultSpecialColors(specialColorIndexes_t *specialColors);
+
+void updateRequiredOverlay(void);
+# 62 "./src/main/interface/settings.c" 2
+# 1 "./src/main/io/osd.h" 1
+# 18 "./src/main/io/osd.h"
+       
+
+
+
+
+
+extern const char * const osdTimerSourceNames[3];
+# 47 "./src/main/io/osd.h"
+typedef enum {
+    OSD_RSSI_VALUE,
+    OSD_MAIN_BATT_VOLTAGE,
+    OSD_CROSSHAIRS,
+    OSD_ARTIFICIAL_HORIZON,
+    OSD_HORIZON_SIDEBARS,
+    OSD_ITEM_TIMER_1,
+    OSD_ITEM_TIMER_2,
+    OSD_FLYMODE,
+    OSD_CRAFT_NAME,
+    OSD_THROTTLE_POS,
+    OSD_VTX_CHANNEL,
+    OSD_CURRENT_DRAW,
+    OSD_MAH_DRAWN,
+    OSD_GPS_SPEED,
+    OSD_GPS_SATS,
+    OSD_ALTITUDE,
+    OSD_ROLL_PIDS,
+    OSD_PITCH_PIDS,
+    OSD_YAW_PIDS,
+    OSD_POWER,
+    OSD_PIDRATE_PROFILE,
+    OSD_WARNINGS,
+    OSD_AVG_CELL_VOLTAGE,
+    OSD_GPS_LON,
+    OSD_GPS_LAT,
+    OSD_DEBUG,
+    OSD_PITCH_ANGLE,
+    OSD_ROLL_ANGLE,
+    OSD_MAIN_BATT_USAGE,
+    OSD_DISARMED,
+    OSD_HOME_DIR,
+    OSD_HOME_DIST,
+    OSD_NUMERICAL_HEADING,
+    OSD_NUMERICAL_VARIO,
+    OSD_COMPASS_BAR,
+    OSD_ESC_TMP,
+    OSD_ESC_RPM,
+    OSD_REMAINING_TIME_ESTIMATE,
+    OSD_RTC_DATETIME,
+    OSD_ADJUSTMENT_RANGE,
+    OSD_CORE_TEMPERATURE,
+    OSD_ITEM_COUNT
+} osd_items_e;
+
+typedef enum {
+    OSD_STAT_MAX_SPEED,
+    OSD_STAT_MIN_BATTERY,
+    OSD_STAT_MIN_RSSI,
+    OSD_STAT_MAX_CURRENT,
+    OSD_STAT_USED_MAH,
+    OSD_STAT_MAX_ALTITUDE,
+    OSD_STAT_BLACKBOX,
+    OSD_STAT_END_BATTERY,
+    OSD_STAT_TIMER_1,
+    OSD_STAT_TIMER_2,
+    OSD_STAT_MAX_DISTANCE,
+    OSD_STAT_BLACKBOX_NUMBER,
+    OSD_STAT_RTC_DATE_TIME,
+    OSD_STAT_COUNT
+} osd_stats_e;
+
+typedef enum {
+    OSD_UNIT_IMPERIAL,
+    OSD_UNIT_METRIC
+} osd_unit_e;
+
+typedef enum {
+    OSD_TIMER_1,
+    OSD_TIMER_2,
+    OSD_TIMER_COUNT
+} osd_timer_e;
+
+typedef enum {
+    OSD_TIMER_SRC_ON,
+    OSD_TIMER_SRC_TOTAL_ARMED,
+    OSD_TIMER_SRC_LAST_ARMED,
+    OSD_TIMER_SRC_COUNT
+} osd_timer_source_e;
+
+typedef enum {
+    OSD_TIMER_PREC_SECOND,
+    OSD_TIMER_PREC_HUNDREDTHS,
+    OSD_TIMER_PREC_COUNT
+} osd_timer_precision_e;
+
+typedef enum {
+    OSD_WARNING_ARMING_DISABLE = (1 << 0),
+    OSD_WARNING_BATTERY_NOT_FULL = (1 << 1),
+    OSD_WARNING_BATTERY_WARNING = (1 << 2),
+    OSD_WARNING_BATTERY_CRITICAL = (1 << 3),
+    OSD_WARNING_VISUAL_BEEPER = (1 << 4),
+    OSD_WARNING_CRASH_FLIP = (1 << 5)
+} osdWarningsFlags_e;
+
+typedef struct osdConfig_s {
+    uint16_t item_pos[OSD_ITEM_COUNT];
+
+
+    uint16_t cap_alarm;
+    uint16_t alt_alarm;
+    uint8_t rssi_alarm;
+
+    osd_unit_e units;
+
+    uint16_t timers[OSD_TIMER_COUNT];
+    uint16_t enabledWarnings;
+
+    uint8_t ahMaxPitch;
+    uint8_t ahMaxRoll;
+    
+# 157 "./src/main/io/osd.h" 3 4
+   _Bool 
+# 157 "./src/main/io/osd.h"
+        enabled_stats[OSD_STAT_COUNT];
+} osdConfig_t;
+
+extern timeUs_t resumeRefreshAt;
+
+extern osdConfig_t osdConfig_System; extern osdConfig_t osdConfig_Copy; static inline const osdConfig_t* osdConfig(void) { return &osdConfig_System; } static inline osdConfig_t* osdConfigMutable(void) { return &osdConfig_System; } struct _dummy;
+
+extern uint32_t resumeRefreshAt;
+
+struct displayPort_s;
+void osdInit(struct displayPort_s *osdDisplayPort);
+void osdResetAlarms(void);
+void osdUpdate(timeUs_t currentTimeUs);
+# 63 "./src/main/interface/settings.c" 2
+# 1 "./src/main/io/vtx.h" 1
+# 18 "./src/main/io/vtx.h"
+       
+
+
+
+
+
+
+
+typedef struct vtxSettingsConfig_s {
+    uint8_t band;
+    uint8_t channel;
+    uint8_t power;
+    uint16_t freq;
+    uint16_t pitModeFreq;
+    uint8_t lowPowerDisarm;
+} vtxSettingsConfig_t;
+
+extern vtxSettingsConfig_t vtxSettingsConfig_System; extern vtxSettingsConfig_t vtxSettingsConfig_Copy; static inline const vtxSettingsConfig_t* vtxSettingsConfig(void) { return &vtxSettingsConfig_System; } static inline vtxSettingsConfig_t* vtxSettingsConfigMutable(void) { return &vtxSettingsConfig_System; } struct _dummy;
+
+void vtxInit(void);
+void vtxUpdate(timeUs_t currentTimeUs);
+# 64 "./src/main/interface/settings.c" 2
+# 1 "./src/main/io/vtx_control.h" 1
+# 18 "./src/main/io/vtx_control.h"
+       
+# 30 "./src/main/io/vtx_control.h"
+typedef struct vtxChannelActivationCondition_s {
+    uint8_t auxChannelIndex;
+    uint8_t band;
+    uint8_t channel;
+    channelRange_t range;
+} vtxChannelActivationCondition_t;
+
+typedef struct vtxConfig_s {
+    vtxChannelActivationCondition_t vtxChannelActivationConditions[10];
+    uint8_t halfDuplex;
+} vtxConfig_t;
+
+extern vtxConfig_t vtxConfig_System; extern vtxConfig_t vtxConfig_Copy; static inline const vtxConfig_t* vtxConfig(void) { return &vtxConfig_System; } static inline vtxConfig_t* vtxConfigMutable(void) { return &vtxConfig_System; } struct _dummy;
+
+void vtxControlInit(void);
+void vtxControlInputPoll(void);
+
+void vtxIncrementBand(void);
+void vtxDecrementBand(void);
+void vtxIncrementChannel(void);
+void vtxDecrementChannel(void);
+
+void vtxCyclePower(const uint8_t powerStep);
+void vtxCycleBandOrChannel(const uint8_t bandStep, const uint8_t channelStep);
+
+void vtxUpdateActivatedChannel(void);
+
+void handleVTXControlButton(void);
+# 65 "./src/main/interface/settings.c" 2
+# 1 "./src/main/io/vtx_rtc6705.h" 1
+# 18 "./src/main/io/vtx_rtc6705.h"
+       
+
+
+
+
+
+
+extern const char * const rtc6705PowerNames[];
+
+
+# 27 "./src/main/io/vtx_rtc6705.h" 3 4
+_Bool 
+# 27 "./src/main/io/vtx_rtc6705.h"
+    vtxRTC6705CanUpdate(void);
+
+# 28 "./src/main/io/vtx_rtc6705.h" 3 4
+_Bool 
+# 28 "./src/main/io/vtx_rtc6705.h"
+    vtxRTC6705Init(void);
+# 66 "./src/main/interface/settings.c" 2
+
+# 1 "./src/main/pg/adc.h" 1
+# 18 "./src/main/pg/adc.h"
+       
+
+
+
+
+
+
+
+typedef struct adcChannelConfig_t {
+    
+# 27 "./src/main/pg/adc.h" 3 4
+   _Bool 
+# 27 "./src/main/pg/adc.h"
+        enabled;
+    ioTag_t ioTag;
+} adcChannelConfig_t;
+
+typedef struct adcConfig_s {
+    adcChannelConfig_t vbat;
+    adcChannelConfig_t rssi;
+    adcChannelConfig_t current;
+    adcChannelConfig_t external1;
+    int8_t device;
+} adcConfig_t;
+
+extern adcConfig_t adcConfig_System; extern adcConfig_t adcConfig_Copy; static inline const adcConfig_t* adcConfig(void) { return &adcConfig_System; } static inline adcConfig_t* adcConfigMutable(void) { return &adcConfig_System; } struct _dummy;
+# 68 "./src/main/interface/settings.c" 2
+# 1 "./src/main/pg/beeper.h" 1
+# 18 "./src/main/pg/beeper.h"
+       
+
+
+
+
+typedef struct beeperConfig_s {
+    uint32_t beeper_off_flags;
+    uint32_t preferred_beeper_off_flags;
+    uint8_t dshotBeaconTone;
+} beeperConfig_t;
+
+extern beeperConfig_t beeperConfig_System; extern beeperConfig_t beeperConfig_Copy; static inline const beeperConfig_t* beeperConfig(void) { return &beeperConfig_System; } static inline beeperConfig_t* beeperConfigMutable(void) { return &beeperConfig_System; } struct _dummy;
+# 69 "./src/main/interface/settings.c" 2
+# 1 "./src/main/pg/beeper_dev.h" 1
+# 18 "./src/main/pg/beeper_dev.h"
+       
+
+
+
+
+
+
+typedef struct beeperDevConfig_s {
+    ioTag_t ioTag;
+    uint8_t isInverted;
+    uint8_t isOpenDrain;
+    uint16_t frequency;
+} beeperDevConfig_t;
+
+extern beeperDevConfig_t beeperDevConfig_System; extern beeperDevConfig_t beeperDevConfig_Copy; static inline const beeperDevConfig_t* beeperDevConfig(void) { return &beeperDevConfig_System; } static inline beeperDevConfig_t* beeperDevConfigMutable(void) { return &beeperDevConfig_System; } struct _dummy;
+# 70 "./src/main/interface/settings.c" 2
+# 1 "./src/main/pg/dashboard.h" 1
+# 18 "./src/main/pg/dashboard.h"
+typedef struct dashboardConfig_s {
+    I2CDevice device;
+    uint8_t address;
+} dashboardConfig_t;
+
+extern dashboardConfig_t dashboardConfig_System; extern dashboardConfig_t dashboardConfig_Copy; static inline const dashboardConfig_t* dashboardConfig(void) { return &dashboardConfig_System; } static inline dashboardConfig_t* dashboardConfigMutable(void) { return &dashboardConfig_System; } struct _dummy;
+# 71 "./src/main/interface/settings.c" 2
+# 1 "./src/main/pg/max7456.h" 1
+# 18 "./src/main/pg/max7456.h"
+       
+
+
+
+
+
+
+
+typedef struct max7456Config_s {
+    uint8_t clockConfig;
+} max7456Config_t;
+
+extern max7456Config_t max7456Config_System; extern max7456Config_t max7456Config_Copy; static inline const max7456Config_t* max7456Config(void) { return &max7456Config_System; } static inline max7456Config_t* max7456ConfigMutable(void) { return &max7456Config_System; } struct _dummy;
+# 72 "./src/main/interface/settings.c" 2
+
+
+# 1 "./src/main/pg/pinio.h" 1
+# 18 "./src/main/pg/pinio.h"
+       
+
+
+
+
+
+typedef struct pinioConfig_s {
+    ioTag_t ioTag[4];
+    uint8_t config[4];
+} pinioConfig_t;
+
+extern pinioConfig_t pinioConfig_System; extern pinioConfig_t pinioConfig_Copy; static inline const pinioConfig_t* pinioConfig(void) { return &pinioConfig_System; } static inline pinioConfig_t* pinioConfigMutable(void) { return &pinioConfig_System; } struct _dummy;
+# 75 "./src/main/interface/settings.c" 2
+# 1 "./src/main/pg/piniobox.h" 1
+# 18 "./src/main/pg/piniobox.h"
+       
+
+
+
+
+
+typedef struct pinioBoxConfig_s {
+    uint8_t permanentId[4];
+} pinioBoxConfig_t;
+
+extern pinioBoxConfig_t pinioBoxConfig_System; extern pinioBoxConfig_t pinioBoxConfig_Copy; static inline const pinioBoxConfig_t* pinioBoxConfig(void) { return &pinioBoxConfig_System; } static inline pinioBoxConfig_t* pinioBoxConfigMutable(void) { return &pinioBoxConfig_System; } struct _dummy;
+# 76 "./src/main/interface/settings.c" 2
+# 1 "./src/main/pg/rx_pwm.h" 1
+# 18 "./src/main/pg/rx_pwm.h"
+       
+
+
+# 1 "./src/main/drivers/rx/rx_pwm.h" 1
+# 18 "./src/main/drivers/rx/rx_pwm.h"
+       
+
+typedef enum {
+    INPUT_FILTERING_DISABLED = 0,
+    INPUT_FILTERING_ENABLED
+} inputFilteringMode_e;
+
+
+
+
+struct ppmConfig_s;
+void ppmRxInit(const struct ppmConfig_s *ppmConfig);
+struct pwmConfig_s;
+void pwmRxInit(const struct pwmConfig_s *pwmConfig);
+
+uint16_t pwmRead(uint8_t channel);
+uint16_t ppmRead(uint8_t channel);
+
+
+# 36 "./src/main/drivers/rx/rx_pwm.h" 3 4
+_Bool 
+# 36 "./src/main/drivers/rx/rx_pwm.h"
+    isPPMDataBeingReceived(void);
+void resetPPMDataReceivedState(void);
+
+
+# 39 "./src/main/drivers/rx/rx_pwm.h" 3 4
+_Bool 
+# 39 "./src/main/drivers/rx/rx_pwm.h"
+    isPWMDataBeingReceived(void);
+# 22 "./src/main/pg/rx_pwm.h" 2
+
+
+
+typedef struct ppmConfig_s {
+    ioTag_t ioTag;
+} ppmConfig_t;
+
+extern ppmConfig_t ppmConfig_System; extern ppmConfig_t ppmConfig_Copy; static inline const ppmConfig_t* ppmConfig(void) { return &ppmConfig_System; } static inline ppmConfig_t* ppmConfigMutable(void) { return &ppmConfig_System; } struct _dummy;
+
+typedef struct pwmConfig_s {
+    ioTag_t ioTags[8];
+    inputFilteringMode_e inputFilteringMode;
+} pwmConfig_t;
+
+extern pwmConfig_t pwmConfig_System; extern pwmConfig_t pwmConfig_Copy; static inline const pwmConfig_t* pwmConfig(void) { return &pwmConfig_System; } static inline pwmConfig_t* pwmConfigMutable(void) { return &pwmConfig_System; } struct _dummy;
+# 77 "./src/main/interface/settings.c" 2
+# 1 "./src/main/pg/sdcard.h" 1
+# 18 "./src/main/pg/sdcard.h"
+       
+
+
+# 1 "./src/main/drivers/io.h" 1
+# 18 "./src/main/drivers/io.h"
+       
+
+
+
+
+
+
+# 1 "./src/main/drivers/resource.h" 1
+# 18 "./src/main/drivers/resource.h"
+       
+
+typedef enum {
+    OWNER_FREE = 0,
+    OWNER_PWMINPUT,
+    OWNER_PPMINPUT,
+    OWNER_MOTOR,
+    OWNER_SERVO,
+    OWNER_LED,
+    OWNER_ADC,
+    OWNER_ADC_BATT,
+    OWNER_ADC_CURR,
+    OWNER_ADC_EXT,
+    OWNER_ADC_RSSI,
+    OWNER_SERIAL_TX,
+    OWNER_SERIAL_RX,
+    OWNER_PINDEBUG,
+    OWNER_TIMER,
+    OWNER_SONAR_TRIGGER,
+    OWNER_SONAR_ECHO,
+    OWNER_SYSTEM,
+    OWNER_SPI_SCK,
+    OWNER_SPI_MISO,
+    OWNER_SPI_MOSI,
+    OWNER_I2C_SCL,
+    OWNER_I2C_SDA,
+    OWNER_SDCARD,
+    OWNER_SDCARD_CS,
+    OWNER_SDCARD_DETECT,
+    OWNER_FLASH_CS,
+    OWNER_BARO_CS,
+    OWNER_MPU_CS,
+    OWNER_OSD_CS,
+    OWNER_RX_SPI_CS,
+    OWNER_SPI_CS,
+    OWNER_MPU_EXTI,
+    OWNER_BARO_EXTI,
+    OWNER_COMPASS_EXTI,
+    OWNER_USB,
+    OWNER_USB_DETECT,
+    OWNER_BEEPER,
+    OWNER_OSD,
+    OWNER_RX_BIND,
+    OWNER_INVERTER,
+    OWNER_LED_STRIP,
+    OWNER_TRANSPONDER,
+    OWNER_VTX,
+    OWNER_COMPASS_CS,
+    OWNER_SPI_PREINIT,
+    OWNER_RX_BIND_PLUG,
+    OWNER_ESCSERIAL,
+    OWNER_CAMERA_CONTROL,
+    OWNER_TIMUP,
+    OWNER_RANGEFINDER,
+    OWNER_RX_SPI,
+    OWNER_PINIO,
+    OWNER_TOTAL_COUNT
+} resourceOwner_e;
+
+extern const char * const ownerNames[OWNER_TOTAL_COUNT];
+# 26 "./src/main/drivers/io.h" 2
+# 99 "./src/main/drivers/io.h"
+# 1 "./src/main/drivers/io_def.h" 1
+# 18 "./src/main/drivers/io_def.h"
+       
+# 51 "./src/main/drivers/io_def.h"
+# 1 "./src/main/drivers/io_def_generated.h" 1
+# 18 "./src/main/drivers/io_def_generated.h"
+       
+# 52 "./src/main/drivers/io_def.h" 2
+# 100 "./src/main/drivers/io.h" 2
+
+
+# 101 "./src/main/drivers/io.h" 3 4
+_Bool 
+# 101 "./src/main/drivers/io.h"
+    IORead(IO_t io);
+void IOWrite(IO_t io, 
+# 102 "./src/main/drivers/io.h" 3 4
+                     _Bool 
+# 102 "./src/main/drivers/io.h"
+                          value);
+void IOHi(IO_t io);
+void IOLo(IO_t io);
+void IOToggle(IO_t io);
+
+void IOInit(IO_t io, resourceOwner_e owner, uint8_t index);
+void IORelease(IO_t io);
+resourceOwner_e IOGetOwner(IO_t io);
+IO_t IOGetByTag(ioTag_t tag);
+
+void IOConfigGPIO(IO_t io, ioConfig_t cfg);
+
+
+
+
+void IOInitGlobal(void);
+# 22 "./src/main/pg/sdcard.h" 2
+
+typedef struct sdcardConfig_s {
+    uint8_t useDma;
+    uint8_t enabled;
+    uint8_t device;
+    ioTag_t cardDetectTag;
+    ioTag_t chipSelectTag;
+    uint8_t cardDetectInverted;
+    uint8_t dmaIdentifier;
+    uint8_t dmaChannel;
+} sdcardConfig_t;
+
+extern sdcardConfig_t sdcardConfig_System; extern sdcardConfig_t sdcardConfig_Copy; static inline const sdcardConfig_t* sdcardConfig(void) { return &sdcardConfig_System; } static inline sdcardConfig_t* sdcardConfigMutable(void) { return &sdcardConfig_System; } struct _dummy;
+# 78 "./src/main/interface/settings.c" 2
+# 1 "./src/main/pg/vcd.h" 1
+# 18 "./src/main/pg/vcd.h"
+       
+
+
+
+
+
+enum VIDEO_SYSTEMS {
+    VIDEO_SYSTEM_AUTO = 0,
+    VIDEO_SYSTEM_PAL,
+    VIDEO_SYSTEM_NTSC
+};
+
+typedef struct vcdProfile_s {
+    uint8_t video_system;
+    int8_t h_offset;
+    int8_t v_offset;
+} vcdProfile_t;
+
+extern vcdProfile_t vcdProfile_System; extern vcdProfile_t vcdProfile_Copy; static inline const vcdProfile_t* vcdProfile(void) { return &vcdProfile_System; } static inline vcdProfile_t* vcdProfileMutable(void) { return &vcdProfile_System; } struct _dummy;
+# 79 "./src/main/interface/settings.c" 2
+
+# 1 "./src/main/rx/rx.h" 1
+# 18 "./src/main/rx/rx.h"
+       
+# 43 "./src/main/rx/rx.h"
+typedef enum {
+    RX_FRAME_PENDING = 0,
+    RX_FRAME_COMPLETE = (1 << 0),
+    RX_FRAME_FAILSAFE = (1 << 1),
+    RX_FRAME_PROCESSING_REQUIRED = (1 << 2),
+} rxFrameState_e;
+
+typedef enum {
+    SERIALRX_SPEKTRUM1024 = 0,
+    SERIALRX_SPEKTRUM2048 = 1,
+    SERIALRX_SBUS = 2,
+    SERIALRX_SUMD = 3,
+    SERIALRX_SUMH = 4,
+    SERIALRX_XBUS_MODE_B = 5,
+    SERIALRX_XBUS_MODE_B_RJ01 = 6,
+    SERIALRX_IBUS = 7,
+    SERIALRX_JETIEXBUS = 8,
+    SERIALRX_CRSF = 9,
+    SERIALRX_SRXL = 10,
+    SERIALRX_TARGET_CUSTOM = 11,
+    SERIALRX_FPORT = 12,
+} SerialRXType;
+# 79 "./src/main/rx/rx.h"
+extern const char rcChannelLetters[];
+
+extern int16_t rcData[18];
+
+
+
+
+
+
+
+typedef enum {
+    RX_FAILSAFE_MODE_AUTO = 0,
+    RX_FAILSAFE_MODE_HOLD,
+    RX_FAILSAFE_MODE_SET,
+    RX_FAILSAFE_MODE_INVALID
+} rxFailsafeChannelMode_e;
+
+
+
+typedef enum {
+    RX_FAILSAFE_TYPE_FLIGHT = 0,
+    RX_FAILSAFE_TYPE_AUX
+} rxFailsafeChannelType_e;
+
+
+
+typedef struct rxFailsafeChannelConfig_s {
+    uint8_t mode;
+    uint8_t step;
+} rxFailsafeChannelConfig_t;
+
+extern rxFailsafeChannelConfig_t rxFailsafeChannelConfigs_SystemArray[18]; extern rxFailsafeChannelConfig_t rxFailsafeChannelConfigs_CopyArray[18]; static inline const rxFailsafeChannelConfig_t* rxFailsafeChannelConfigs(int _index) { return &rxFailsafeChannelConfigs_SystemArray[_index]; } static inline rxFailsafeChannelConfig_t* rxFailsafeChannelConfigsMutable(int _index) { return &rxFailsafeChannelConfigs_SystemArray[_index]; } static inline rxFailsafeChannelConfig_t (* rxFailsafeChannelConfigs_array(void))[18] { return &rxFailsafeChannelConfigs_SystemArray; } struct _dummy;
+
+typedef struct rxChannelRangeConfig_s {
+    uint16_t min;
+    uint16_t max;
+} rxChannelRangeConfig_t;
+
+extern rxChannelRangeConfig_t rxChannelRangeConfigs_SystemArray[4]; extern rxChannelRangeConfig_t rxChannelRangeConfigs_CopyArray[4]; static inline const rxChannelRangeConfig_t* rxChannelRangeConfigs(int _index) { return &rxChannelRangeConfigs_SystemArray[_index]; } static inline rxChannelRangeConfig_t* rxChannelRangeConfigsMutable(int _index) { return &rxChannelRangeConfigs_SystemArray[_index]; } static inline rxChannelRangeConfig_t (* rxChannelRangeConfigs_array(void))[4] { return &rxChannelRangeConfigs_SystemArray; } struct _dummy;
+
+typedef struct rxConfig_s {
+    uint8_t rcmap[8];
+    uint8_t serialrx_provider;
+    uint8_t serialrx_inverted;
+    uint8_t halfDuplex;
+    uint8_t rx_spi_protocol;
+
+    uint32_t rx_spi_id;
+    uint8_t rx_spi_rf_channel_count;
+    ioTag_t spektrum_bind_pin_override_ioTag;
+    ioTag_t spektrum_bind_plug_ioTag;
+    uint8_t spektrum_sat_bind;
+    uint8_t spektrum_sat_bind_autoreset;
+    uint8_t rssi_channel;
+    uint8_t rssi_scale;
+    uint8_t rssi_invert;
+    uint16_t midrc;
+    uint16_t mincheck;
+    uint16_t maxcheck;
+    uint8_t rcInterpolation;
+    uint8_t rcInterpolationChannels;
+    uint8_t rcInterpolationInterval;
+    uint8_t fpvCamAngleDegrees;
+    uint8_t airModeActivateThreshold;
+
+    uint16_t rx_min_usec;
+    uint16_t rx_max_usec;
+    uint8_t max_aux_channel;
+} rxConfig_t;
+
+extern rxConfig_t rxConfig_System; extern rxConfig_t rxConfig_Copy; static inline const rxConfig_t* rxConfig(void) { return &rxConfig_System; } static inline rxConfig_t* rxConfigMutable(void) { return &rxConfig_System; } struct _dummy;
+
+struct rxRuntimeConfig_s;
+typedef uint16_t (*rcReadRawDataFnPtr)(const struct rxRuntimeConfig_s *rxRuntimeConfig, uint8_t chan);
+typedef uint8_t (*rcFrameStatusFnPtr)(struct rxRuntimeConfig_s *rxRuntimeConfig);
+typedef 
+# 154 "./src/main/rx/rx.h" 3 4
+       _Bool 
+# 154 "./src/main/rx/rx.h"
+            (*rcProcessFrameFnPtr)(const struct rxRuntimeConfig_s *rxRuntimeConfig);
+
+typedef struct rxRuntimeConfig_s {
+    uint8_t channelCount;
+    uint16_t rxRefreshRate;
+    rcReadRawDataFnPtr rcReadRawFn;
+    rcFrameStatusFnPtr rcFrameStatusFn;
+    rcProcessFrameFnPtr rcProcessFrameFn;
+    uint16_t *channelData;
+    void *frameData;
+} rxRuntimeConfig_t;
+
+typedef enum {
+    RSSI_SOURCE_NONE = 0,
+    RSSI_SOURCE_ADC,
+    RSSI_SOURCE_RX_CHANNEL,
+    RSSI_SOURCE_RX_PROTOCOL,
+    RSSI_SOURCE_MSP,
+} rssiSource_e;
+
+extern rssiSource_e rssiSource;
+
+extern rxRuntimeConfig_t rxRuntimeConfig;
+
+void rxInit(void);
+
+# 179 "./src/main/rx/rx.h" 3 4
+_Bool 
+# 179 "./src/main/rx/rx.h"
+    rxUpdateCheck(timeUs_t currentTimeUs, timeDelta_t currentDeltaTimeUs);
+
+# 180 "./src/main/rx/rx.h" 3 4
+_Bool 
+# 180 "./src/main/rx/rx.h"
+    rxIsReceivingSignal(void);
+
+# 181 "./src/main/rx/rx.h" 3 4
+_Bool 
+# 181 "./src/main/rx/rx.h"
+    rxAreFlightChannelsValid(void);
+
+# 182 "./src/main/rx/rx.h" 3 4
+_Bool 
+# 182 "./src/main/rx/rx.h"
+    calculateRxChannelsAndUpdateFailsafe(timeUs_t currentTimeUs);
+
+void parseRcChannels(const char *input, rxConfig_t *rxConfig);
+
+void setRssiFiltered(uint16_t newRssi, rssiSource_e source);
+void setRssiUnfiltered(uint16_t rssiValue, rssiSource_e source);
+void setRssiMsp(uint8_t newMspRssi);
+void updateRSSI(timeUs_t currentTimeUs);
+uint16_t getRssi(void);
+
+void resetAllRxChannelRangeConfigurations(rxChannelRangeConfig_t *rxChannelRangeConfig);
+
+void suspendRxSignal(void);
+void resumeRxSignal(void);
+
+uint16_t rxGetRefreshRate(void);
+# 81 "./src/main/interface/settings.c" 2
+# 1 "./src/main/rx/cc2500_frsky_common.h" 1
+# 18 "./src/main/rx/cc2500_frsky_common.h"
+       
+
+
+
+# 1 "./src/main/rx/rx_spi.h" 1
+# 18 "./src/main/rx/rx_spi.h"
+       
+
+
+
+
+typedef enum {
+    RX_SPI_NRF24_V202_250K = 0,
+    RX_SPI_NRF24_V202_1M,
+    RX_SPI_NRF24_SYMA_X,
+    RX_SPI_NRF24_SYMA_X5C,
+    RX_SPI_NRF24_CX10,
+    RX_SPI_NRF24_CX10A,
+    RX_SPI_NRF24_H8_3D,
+    RX_SPI_NRF24_INAV,
+    RX_SPI_FRSKY_D,
+    RX_SPI_FRSKY_X,
+    RX_SPI_A7105_FLYSKY,
+    RX_SPI_A7105_FLYSKY_2A,
+    RX_SPI_NRF24_KN,
+    RX_SPI_PROTOCOL_COUNT
+} rx_spi_protocol_e;
+
+typedef enum {
+    RX_SPI_RECEIVED_NONE = 0,
+    RX_SPI_RECEIVED_BIND,
+    RX_SPI_RECEIVED_DATA
+} rx_spi_received_e;
+
+
+typedef enum {
+    RC_SPI_ROLL = 0,
+    RC_SPI_PITCH,
+    RC_SPI_THROTTLE,
+    RC_SPI_YAW,
+    RC_SPI_AUX1,
+    RC_SPI_AUX2,
+    RC_SPI_AUX3,
+    RC_SPI_AUX4,
+    RC_SPI_AUX5,
+    RC_SPI_AUX6,
+    RC_SPI_AUX7,
+    RC_SPI_AUX8,
+    RC_SPI_AUX9,
+    RC_SPI_AUX10,
+    RC_SPI_AUX11,
+    RC_SPI_AUX12,
+    RC_SPI_AUX13,
+    RC_SPI_AUX14
+} rc_spi_aetr_e;
+# 76 "./src/main/rx/rx_spi.h"
+
+# 76 "./src/main/rx/rx_spi.h" 3 4
+_Bool 
+# 76 "./src/main/rx/rx_spi.h"
+    rxSpiInit(const rxConfig_t *rxConfig, rxRuntimeConfig_t *rxRuntimeConfig);
+# 23 "./src/main/rx/cc2500_frsky_common.h" 2
+
+typedef struct rxFrSkySpiConfig_s {
+    
+# 25 "./src/main/rx/cc2500_frsky_common.h" 3 4
+   _Bool 
+# 25 "./src/main/rx/cc2500_frsky_common.h"
+        autoBind;
+    uint8_t bindTxId[2];
+    int8_t bindOffset;
+    uint8_t bindHopData[50];
+    uint8_t rxNum;
+} rxFrSkySpiConfig_t;
+
+extern rxFrSkySpiConfig_t rxFrSkySpiConfig_System; extern rxFrSkySpiConfig_t rxFrSkySpiConfig_Copy; static inline const rxFrSkySpiConfig_t* rxFrSkySpiConfig(void) { return &rxFrSkySpiConfig_System; } static inline rxFrSkySpiConfig_t* rxFrSkySpiConfigMutable(void) { return &rxFrSkySpiConfig_System; } struct _dummy;
+
+
+# 34 "./src/main/rx/cc2500_frsky_common.h" 3 4
+_Bool 
+# 34 "./src/main/rx/cc2500_frsky_common.h"
+    frSkySpiInit(const rxConfig_t *rxConfig, rxRuntimeConfig_t *rxRuntimeConfig);
+rx_spi_received_e frSkySpiDataReceived(uint8_t *packet);
+void frSkySpiSetRcData(uint16_t *rcData, const uint8_t *payload);
+
+void frSkySpiBind(void);
+# 82 "./src/main/interface/settings.c" 2
+# 1 "./src/main/rx/spektrum.h" 1
+# 18 "./src/main/rx/spektrum.h"
+       
+# 43 "./src/main/rx/spektrum.h"
+extern uint32_t spekChannelData[12];
+
+extern 
+# 45 "./src/main/rx/spektrum.h" 3 4
+      _Bool 
+# 45 "./src/main/rx/spektrum.h"
+           srxlEnabled;
+extern int32_t resolution;
+extern uint8_t rssi_channel;
+
+void spektrumBind(rxConfig_t *rxConfig);
+
+# 50 "./src/main/rx/spektrum.h" 3 4
+_Bool 
+# 50 "./src/main/rx/spektrum.h"
+    spektrumInit(const rxConfig_t *rxConfig, rxRuntimeConfig_t *rxRuntimeConfig);
+
+void srxlRxWriteTelemetryData(const void *data, int len);
+
+# 53 "./src/main/rx/spektrum.h" 3 4
+_Bool 
+# 53 "./src/main/rx/spektrum.h"
+    srxlRxIsActive(void);
+# 83 "./src/main/interface/settings.c" 2
+
+# 1 "./src/main/sensors/acceleration.h" 1
+# 18 "./src/main/sensors/acceleration.h"
+       
+
+
+
+# 1 "./src/main/drivers/accgyro/accgyro.h" 1
+# 18 "./src/main/drivers/accgyro/accgyro.h"
+       
+
+
+
+
+# 1 "./src/main/drivers/exti.h" 1
+# 19 "./src/main/drivers/exti.h"
+       
+
+
+
+
+
+typedef struct extiCallbackRec_s extiCallbackRec_t;
+typedef void extiHandlerCallback(extiCallbackRec_t *self);
+
+struct extiCallbackRec_s {
+    extiHandlerCallback *fn;
+};
+
+void EXTIInit(void);
+
+void EXTIHandlerInit(extiCallbackRec_t *cb, extiHandlerCallback *fn);
+
+
+
+void EXTIConfig(IO_t io, extiCallbackRec_t *cb, int irqPriority, EXTITrigger_TypeDef trigger);
+
+void EXTIRelease(IO_t io);
+void EXTIEnable(IO_t io, 
+# 41 "./src/main/drivers/exti.h" 3 4
+                        _Bool 
+# 41 "./src/main/drivers/exti.h"
+                             enable);
+# 24 "./src/main/drivers/accgyro/accgyro.h" 2
+
+# 1 "./src/main/drivers/sensor.h" 1
+# 18 "./src/main/drivers/sensor.h"
+       
+
+
+
+
+typedef enum {
+    ALIGN_DEFAULT = 0,
+    CW0_DEG = 1,
+    CW90_DEG = 2,
+    CW180_DEG = 3,
+    CW270_DEG = 4,
+    CW0_DEG_FLIP = 5,
+    CW90_DEG_FLIP = 6,
+    CW180_DEG_FLIP = 7,
+    CW270_DEG_FLIP = 8
+} sensor_align_e;
+
+typedef 
+# 35 "./src/main/drivers/sensor.h" 3 4
+       _Bool 
+# 35 "./src/main/drivers/sensor.h"
+            (*sensorInterruptFuncPtr)(void);
+struct magDev_s;
+typedef 
+# 37 "./src/main/drivers/sensor.h" 3 4
+       _Bool 
+# 37 "./src/main/drivers/sensor.h"
+            (*sensorMagInitFuncPtr)(struct magDev_s *magdev);
+typedef 
+# 38 "./src/main/drivers/sensor.h" 3 4
+       _Bool 
+# 38 "./src/main/drivers/sensor.h"
+            (*sensorMagReadFuncPtr)(struct magDev_s *magdev, int16_t *data);
+struct accDev_s;
+typedef void (*sensorAccInitFuncPtr)(struct accDev_s *acc);
+typedef 
+# 41 "./src/main/drivers/sensor.h" 3 4
+       _Bool 
+# 41 "./src/main/drivers/sensor.h"
+            (*sensorAccReadFuncPtr)(struct accDev_s *acc);
+struct gyroDev_s;
+typedef void (*sensorGyroInitFuncPtr)(struct gyroDev_s *gyro);
+typedef 
+# 44 "./src/main/drivers/sensor.h" 3 4
+       _Bool 
+# 44 "./src/main/drivers/sensor.h"
+            (*sensorGyroReadFuncPtr)(struct gyroDev_s *gyro);
+typedef 
+# 45 "./src/main/drivers/sensor.h" 3 4
+       _Bool 
+# 45 "./src/main/drivers/sensor.h"
+            (*sensorGyroReadDataFuncPtr)(struct gyroDev_s *gyro, int16_t *data);
+# 26 "./src/main/drivers/accgyro/accgyro.h" 2
+# 1 "./src/main/drivers/accgyro/accgyro_mpu.h" 1
+# 18 "./src/main/drivers/accgyro/accgyro_mpu.h"
+       
+# 143 "./src/main/drivers/accgyro/accgyro_mpu.h"
+typedef void (*mpuResetFnPtr)(void);
+
+extern mpuResetFnPtr mpuResetFn;
+
+typedef struct mpuConfiguration_s {
+    mpuResetFnPtr resetFn;
+} mpuConfiguration_t;
+
+enum gyro_fsr_e {
+    INV_FSR_250DPS = 0,
+    INV_FSR_500DPS,
+    INV_FSR_1000DPS,
+    INV_FSR_2000DPS,
+    NUM_GYRO_FSR
+};
+
+enum fchoice_b {
+    FCB_DISABLED = 0x00,
+    FCB_8800_32 = 0x01,
+    FCB_3600_32 = 0x02
+};
+
+enum clock_sel_e {
+    INV_CLK_INTERNAL = 0,
+    INV_CLK_PLL,
+    NUM_CLK
+};
+
+enum accel_fsr_e {
+    INV_FSR_2G = 0,
+    INV_FSR_4G,
+    INV_FSR_8G,
+    INV_FSR_16G,
+    NUM_ACCEL_FSR
+};
+
+typedef enum {
+    GYRO_OVERFLOW_NONE = 0x00,
+    GYRO_OVERFLOW_X = 0x01,
+    GYRO_OVERFLOW_Y = 0x02,
+    GYRO_OVERFLOW_Z = 0x04
+} gyroOverflow_e;
+
+typedef enum {
+    MPU_NONE,
+    MPU_3050,
+    MPU_60x0,
+    MPU_60x0_SPI,
+    MPU_65xx_I2C,
+    MPU_65xx_SPI,
+    MPU_9250_SPI,
+    ICM_20601_SPI,
+    ICM_20602_SPI,
+    ICM_20608_SPI,
+    ICM_20649_SPI,
+    ICM_20689_SPI,
+    BMI_160_SPI,
+} mpuSensor_e;
+
+typedef enum {
+    MPU_HALF_RESOLUTION,
+    MPU_FULL_RESOLUTION
+} mpu6050Resolution_e;
+
+typedef struct mpuDetectionResult_s {
+    mpuSensor_e sensor;
+    mpu6050Resolution_e resolution;
+} mpuDetectionResult_t;
+
+struct gyroDev_s;
+void mpuGyroInit(struct gyroDev_s *gyro);
+
+# 214 "./src/main/drivers/accgyro/accgyro_mpu.h" 3 4
+_Bool 
+# 214 "./src/main/drivers/accgyro/accgyro_mpu.h"
+    mpuGyroRead(struct gyroDev_s *gyro);
+
+# 215 "./src/main/drivers/accgyro/accgyro_mpu.h" 3 4
+_Bool 
+# 215 "./src/main/drivers/accgyro/accgyro_mpu.h"
+    mpuGyroReadSPI(struct gyroDev_s *gyro);
+void mpuDetect(struct gyroDev_s *gyro);
+
+struct accDev_s;
+
+# 219 "./src/main/drivers/accgyro/accgyro_mpu.h" 3 4
+_Bool 
+# 219 "./src/main/drivers/accgyro/accgyro_mpu.h"
+    mpuAccRead(struct accDev_s *acc);
+# 27 "./src/main/drivers/accgyro/accgyro.h" 2
+#pragma GCC diagnostic push
+
+# 1 "/usr/include/pthread.h" 1 3 4
+# 22 "/usr/include/pthread.h" 3 4
+# 1 "/usr/include/sched.h" 1 3 4
+# 29 "/usr/include/sched.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 30 "/usr/include/sched.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h" 3 4
+
+# 10 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h" 3 4
+typedef __time_t time_t;
+# 32 "/usr/include/sched.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 1 3 4
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/endian.h" 1 3 4
+# 35 "/usr/include/x86_64-linux-gnu/bits/endian.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/endianness.h" 1 3 4
+# 36 "/usr/include/x86_64-linux-gnu/bits/endian.h" 2 3 4
+# 7 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 2 3 4
+
+
+
+
+struct timespec
+{
+
+
+
+  __time_t tv_sec;
+
+
+
+
+  __syscall_slong_t tv_nsec;
+# 31 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 3 4
+};
+# 33 "/usr/include/sched.h" 2 3 4
+
+
+
+
+
+typedef __pid_t pid_t;
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/sched.h" 1 3 4
+# 80 "/usr/include/x86_64-linux-gnu/bits/sched.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_sched_param.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/struct_sched_param.h" 3 4
+struct sched_param
+{
+  int sched_priority;
+};
+# 81 "/usr/include/x86_64-linux-gnu/bits/sched.h" 2 3 4
+
+
+# 102 "/usr/include/x86_64-linux-gnu/bits/sched.h" 3 4
+
+# 44 "/usr/include/sched.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/cpu-set.h" 1 3 4
+# 32 "/usr/include/x86_64-linux-gnu/bits/cpu-set.h" 3 4
+typedef unsigned long int __cpu_mask;
+
+
+
+
+
+
+typedef struct
+{
+  __cpu_mask __bits[1024 / (8 * sizeof (__cpu_mask))];
+} cpu_set_t;
+# 115 "/usr/include/x86_64-linux-gnu/bits/cpu-set.h" 3 4
+
+
+extern int __sched_cpucount (size_t __setsize, const cpu_set_t *__setp)
+     __attribute__ ((__nothrow__ , __leaf__));
+extern cpu_set_t *__sched_cpualloc (size_t __count) __attribute__ ((__nothrow__ , __leaf__)) ;
+extern void __sched_cpufree (cpu_set_t *__set) __attribute__ ((__nothrow__ , __leaf__));
+
+
+# 45 "/usr/include/sched.h" 2 3 4
+
+
+
+
+
+
+
+
+
+extern int sched_setparam (__pid_t __pid, const struct sched_param *__param)
+     __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_getparam (__pid_t __pid, struct sched_param *__param) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_setscheduler (__pid_t __pid, int __policy,
+          const struct sched_param *__param) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_getscheduler (__pid_t __pid) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_yield (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_get_priority_max (int __algorithm) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_get_priority_min (int __algorithm) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int sched_rr_get_interval (__pid_t __pid, struct timespec *__t) __attribute__ ((__nothrow__ , __leaf__));
+# 138 "/usr/include/sched.h" 3 4
+
+# 23 "/usr/include/pthread.h" 2 3 4
+# 1 "/usr/include/time.h" 1 3 4
+# 29 "/usr/include/time.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 30 "/usr/include/time.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/time.h" 1 3 4
+# 34 "/usr/include/time.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h" 1 3 4
+
+
+
+
+
+
+typedef __clock_t clock_t;
+# 38 "/usr/include/time.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_tm.h" 1 3 4
+
+
+
+
+
+
+struct tm
+{
+  int tm_sec;
+  int tm_min;
+  int tm_hour;
+  int tm_mday;
+  int tm_mon;
+  int tm_year;
+  int tm_wday;
+  int tm_yday;
+  int tm_isdst;
+
+
+  long int tm_gmtoff;
+  const char *tm_zone;
+
+
+
+
+};
+# 40 "/usr/include/time.h" 2 3 4
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h" 1 3 4
+
+
+
+
+
+
+typedef __clockid_t clockid_t;
+# 47 "/usr/include/time.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h" 1 3 4
+
+
+
+
+
+
+typedef __timer_t timer_t;
+# 48 "/usr/include/time.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_itimerspec.h" 1 3 4
+
+
+
+
+
+
+
+struct itimerspec
+  {
+    struct timespec it_interval;
+    struct timespec it_value;
+  };
+# 49 "/usr/include/time.h" 2 3 4
+struct sigevent;
+# 60 "/usr/include/time.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 3 4
+struct __locale_struct
+{
+
+  struct __locale_data *__locales[13];
+
+
+  const unsigned short int *__ctype_b;
+  const int *__ctype_tolower;
+  const int *__ctype_toupper;
+
+
+  const char *__names[13];
+};
+
+typedef struct __locale_struct *__locale_t;
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 2 3 4
+
+typedef __locale_t locale_t;
+# 61 "/usr/include/time.h" 2 3 4
+
+
+
+
+
+
+
+
+
+
+
+extern clock_t clock (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern time_t time (time_t *__timer) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double difftime (time_t __time1, time_t __time0)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern time_t mktime (struct tm *__tp) __attribute__ ((__nothrow__ , __leaf__));
+# 100 "/usr/include/time.h" 3 4
+extern size_t strftime (char *__restrict __s, size_t __maxsize,
+   const char *__restrict __format,
+   const struct tm *__restrict __tp) __attribute__ ((__nothrow__ , __leaf__));
+# 116 "/usr/include/time.h" 3 4
+extern size_t strftime_l (char *__restrict __s, size_t __maxsize,
+     const char *__restrict __format,
+     const struct tm *__restrict __tp,
+     locale_t __loc) __attribute__ ((__nothrow__ , __leaf__));
+# 132 "/usr/include/time.h" 3 4
+extern struct tm *gmtime (const time_t *__timer) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern struct tm *localtime (const time_t *__timer) __attribute__ ((__nothrow__ , __leaf__));
+# 154 "/usr/include/time.h" 3 4
+extern struct tm *gmtime_r (const time_t *__restrict __timer,
+       struct tm *__restrict __tp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern struct tm *localtime_r (const time_t *__restrict __timer,
+          struct tm *__restrict __tp) __attribute__ ((__nothrow__ , __leaf__));
+# 179 "/usr/include/time.h" 3 4
+extern char *asctime (const struct tm *__tp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern char *ctime (const time_t *__timer) __attribute__ ((__nothrow__ , __leaf__));
+# 197 "/usr/include/time.h" 3 4
+extern char *asctime_r (const struct tm *__restrict __tp,
+   char *__restrict __buf) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern char *ctime_r (const time_t *__restrict __timer,
+        char *__restrict __buf) __attribute__ ((__nothrow__ , __leaf__));
+# 217 "/usr/include/time.h" 3 4
+extern char *__tzname[2];
+extern int __daylight;
+extern long int __timezone;
+
+
+
+
+extern char *tzname[2];
+
+
+
+extern void tzset (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int daylight;
+extern long int timezone;
+# 246 "/usr/include/time.h" 3 4
+extern time_t timegm (struct tm *__tp) __attribute__ ((__nothrow__ , __leaf__));
+# 263 "/usr/include/time.h" 3 4
+extern time_t timelocal (struct tm *__tp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern int dysize (int __year) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+# 281 "/usr/include/time.h" 3 4
+extern int nanosleep (const struct timespec *__requested_time,
+        struct timespec *__remaining);
+
+
+extern int clock_getres (clockid_t __clock_id, struct timespec *__res) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int clock_gettime (clockid_t __clock_id, struct timespec *__tp)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+extern int clock_settime (clockid_t __clock_id, const struct timespec *__tp)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+# 323 "/usr/include/time.h" 3 4
+extern int clock_nanosleep (clockid_t __clock_id, int __flags,
+       const struct timespec *__req,
+       struct timespec *__rem);
+# 338 "/usr/include/time.h" 3 4
+extern int clock_getcpuclockid (pid_t __pid, clockid_t *__clock_id) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern int timer_create (clockid_t __clock_id,
+    struct sigevent *__restrict __evp,
+    timer_t *__restrict __timerid) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int timer_delete (timer_t __timerid) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int timer_settime (timer_t __timerid, int __flags,
+     const struct itimerspec *__restrict __value,
+     struct itimerspec *__restrict __ovalue) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int timer_gettime (timer_t __timerid, struct itimerspec *__value)
+     __attribute__ ((__nothrow__ , __leaf__));
+# 376 "/usr/include/time.h" 3 4
+extern int timer_getoverrun (timer_t __timerid) __attribute__ ((__nothrow__ , __leaf__));
+# 452 "/usr/include/time.h" 3 4
+
+# 24 "/usr/include/pthread.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 1 3 4
+# 44 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 1 3 4
+# 21 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 2 3 4
+# 45 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h" 3 4
+typedef union
+{
+  __extension__ unsigned long long int __value64;
+  struct
+  {
+    unsigned int __low;
+    unsigned int __high;
+  } __value32;
+} __atomic_wide_counter;
+# 47 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+
+
+
+typedef struct __pthread_internal_list
+{
+  struct __pthread_internal_list *__prev;
+  struct __pthread_internal_list *__next;
+} __pthread_list_t;
+
+typedef struct __pthread_internal_slist
+{
+  struct __pthread_internal_slist *__next;
+} __pthread_slist_t;
+# 76 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 3 4
+struct __pthread_mutex_s
+{
+  int __lock;
+  unsigned int __count;
+  int __owner;
+
+  unsigned int __nusers;
+
+
+
+  int __kind;
+
+  short __spins;
+  short __elision;
+  __pthread_list_t __list;
+# 53 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 3 4
+};
+# 77 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+# 89 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 3 4
+struct __pthread_rwlock_arch_t
+{
+  unsigned int __readers;
+  unsigned int __writers;
+  unsigned int __wrphase_futex;
+  unsigned int __writers_futex;
+  unsigned int __pad3;
+  unsigned int __pad4;
+
+  int __cur_writer;
+  int __shared;
+  signed char __rwelision;
+
+
+
+
+  unsigned char __pad1[7];
+
+
+  unsigned long int __pad2;
+
+
+  unsigned int __flags;
+# 55 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 3 4
+};
+# 90 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+
+
+
+struct __pthread_cond_s
+{
+  __atomic_wide_counter __wseq;
+  __atomic_wide_counter __g1_start;
+  unsigned int __g_refs[2] ;
+  unsigned int __g_size[2];
+  unsigned int __g1_orig_size;
+  unsigned int __wrefs;
+  unsigned int __g_signals[2];
+};
+
+typedef unsigned int __tss_t;
+typedef unsigned long int __thrd_t;
+
+typedef struct
+{
+  int __data ;
+} __once_flag;
+# 24 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 2 3 4
+
+
+
+typedef unsigned long int pthread_t;
+
+
+
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_mutexattr_t;
+
+
+
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_condattr_t;
+
+
+
+typedef unsigned int pthread_key_t;
+
+
+
+typedef int pthread_once_t;
+
+
+union pthread_attr_t
+{
+  char __size[56];
+  long int __align;
+};
+
+typedef union pthread_attr_t pthread_attr_t;
+
+
+
+
+typedef union
+{
+  struct __pthread_mutex_s __data;
+  char __size[40];
+  long int __align;
+} pthread_mutex_t;
+
+
+typedef union
+{
+  struct __pthread_cond_s __data;
+  char __size[48];
+  __extension__ long long int __align;
+} pthread_cond_t;
+
+
+
+
+
+typedef union
+{
+  struct __pthread_rwlock_arch_t __data;
+  char __size[56];
+  long int __align;
+} pthread_rwlock_t;
+
+typedef union
+{
+  char __size[8];
+  long int __align;
+} pthread_rwlockattr_t;
+
+
+
+
+
+typedef volatile int pthread_spinlock_t;
+
+
+
+
+typedef union
+{
+  char __size[32];
+  long int __align;
+} pthread_barrier_t;
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_barrierattr_t;
+# 27 "/usr/include/pthread.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/setjmp.h" 1 3 4
+# 26 "/usr/include/x86_64-linux-gnu/bits/setjmp.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/setjmp.h" 2 3 4
+
+
+
+
+typedef long int __jmp_buf[8];
+# 28 "/usr/include/pthread.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 29 "/usr/include/pthread.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h" 1 3 4
+
+
+
+
+typedef struct
+{
+  unsigned long int __val[(1024 / (8 * sizeof (unsigned long int)))];
+} __sigset_t;
+# 31 "/usr/include/pthread.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct___jmp_buf_tag.h" 1 3 4
+# 26 "/usr/include/x86_64-linux-gnu/bits/types/struct___jmp_buf_tag.h" 3 4
+struct __jmp_buf_tag
+  {
+
+
+
+
+    __jmp_buf __jmpbuf;
+    int __mask_was_saved;
+    __sigset_t __saved_mask;
+  };
+# 32 "/usr/include/pthread.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h" 1 3 4
+# 29 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min.h" 1 3 4
+# 30 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h" 2 3 4
+# 34 "/usr/include/pthread.h" 2 3 4
+
+
+
+enum
+{
+  PTHREAD_CREATE_JOINABLE,
+
+  PTHREAD_CREATE_DETACHED
+
+};
+
+
+
+enum
+{
+  PTHREAD_MUTEX_TIMED_NP,
+  PTHREAD_MUTEX_RECURSIVE_NP,
+  PTHREAD_MUTEX_ERRORCHECK_NP,
+  PTHREAD_MUTEX_ADAPTIVE_NP
+
+  ,
+  PTHREAD_MUTEX_NORMAL = PTHREAD_MUTEX_TIMED_NP,
+  PTHREAD_MUTEX_RECURSIVE = PTHREAD_MUTEX_RECURSIVE_NP,
+  PTHREAD_MUTEX_ERRORCHECK = PTHREAD_MUTEX_ERRORCHECK_NP,
+  PTHREAD_MUTEX_DEFAULT = PTHREAD_MUTEX_NORMAL
+
+
+
+
+
+};
+
+
+
+
+enum
+{
+  PTHREAD_MUTEX_STALLED,
+  PTHREAD_MUTEX_STALLED_NP = PTHREAD_MUTEX_STALLED,
+  PTHREAD_MUTEX_ROBUST,
+  PTHREAD_MUTEX_ROBUST_NP = PTHREAD_MUTEX_ROBUST
+};
+
+
+
+
+
+enum
+{
+  PTHREAD_PRIO_NONE,
+  PTHREAD_PRIO_INHERIT,
+  PTHREAD_PRIO_PROTECT
+};
+# 104 "/usr/include/pthread.h" 3 4
+enum
+{
+  PTHREAD_RWLOCK_PREFER_READER_NP,
+  PTHREAD_RWLOCK_PREFER_WRITER_NP,
+  PTHREAD_RWLOCK_PREFER_WRITER_NONRECURSIVE_NP,
+  PTHREAD_RWLOCK_DEFAULT_NP = PTHREAD_RWLOCK_PREFER_READER_NP
+};
+# 124 "/usr/include/pthread.h" 3 4
+enum
+{
+  PTHREAD_INHERIT_SCHED,
+
+  PTHREAD_EXPLICIT_SCHED
+
+};
+
+
+
+enum
+{
+  PTHREAD_SCOPE_SYSTEM,
+
+  PTHREAD_SCOPE_PROCESS
+
+};
+
+
+
+enum
+{
+  PTHREAD_PROCESS_PRIVATE,
+
+  PTHREAD_PROCESS_SHARED
+
+};
+# 159 "/usr/include/pthread.h" 3 4
+struct _pthread_cleanup_buffer
+{
+  void (*__routine) (void *);
+  void *__arg;
+  int __canceltype;
+  struct _pthread_cleanup_buffer *__prev;
+};
+
+
+enum
+{
+  PTHREAD_CANCEL_ENABLE,
+
+  PTHREAD_CANCEL_DISABLE
+
+};
+enum
+{
+  PTHREAD_CANCEL_DEFERRED,
+
+  PTHREAD_CANCEL_ASYNCHRONOUS
+
+};
+# 197 "/usr/include/pthread.h" 3 4
+
+
+
+
+
+extern int pthread_create (pthread_t *__restrict __newthread,
+      const pthread_attr_t *__restrict __attr,
+      void *(*__start_routine) (void *),
+      void *__restrict __arg) __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1, 3)));
+
+
+
+
+
+extern void pthread_exit (void *__retval) __attribute__ ((__noreturn__));
+
+
+
+
+
+
+
+extern int pthread_join (pthread_t __th, void **__thread_return);
+# 269 "/usr/include/pthread.h" 3 4
+extern int pthread_detach (pthread_t __th) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern pthread_t pthread_self (void) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern int pthread_equal (pthread_t __thread1, pthread_t __thread2)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+
+
+
+extern int pthread_attr_init (pthread_attr_t *__attr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_attr_destroy (pthread_attr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_attr_getdetachstate (const pthread_attr_t *__attr,
+     int *__detachstate)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_setdetachstate (pthread_attr_t *__attr,
+     int __detachstate)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_attr_getguardsize (const pthread_attr_t *__attr,
+          size_t *__guardsize)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_setguardsize (pthread_attr_t *__attr,
+          size_t __guardsize)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_attr_getschedparam (const pthread_attr_t *__restrict __attr,
+           struct sched_param *__restrict __param)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_setschedparam (pthread_attr_t *__restrict __attr,
+           const struct sched_param *__restrict
+           __param) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_getschedpolicy (const pthread_attr_t *__restrict
+     __attr, int *__restrict __policy)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_setschedpolicy (pthread_attr_t *__attr, int __policy)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_attr_getinheritsched (const pthread_attr_t *__restrict
+      __attr, int *__restrict __inherit)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_setinheritsched (pthread_attr_t *__attr,
+      int __inherit)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_attr_getscope (const pthread_attr_t *__restrict __attr,
+      int *__restrict __scope)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_setscope (pthread_attr_t *__attr, int __scope)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_attr_getstackaddr (const pthread_attr_t *__restrict
+          __attr, void **__restrict __stackaddr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2))) __attribute__ ((__deprecated__));
+
+
+
+
+
+extern int pthread_attr_setstackaddr (pthread_attr_t *__attr,
+          void *__stackaddr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) __attribute__ ((__deprecated__));
+
+
+extern int pthread_attr_getstacksize (const pthread_attr_t *__restrict
+          __attr, size_t *__restrict __stacksize)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern int pthread_attr_setstacksize (pthread_attr_t *__attr,
+          size_t __stacksize)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_attr_getstack (const pthread_attr_t *__restrict __attr,
+      void **__restrict __stackaddr,
+      size_t *__restrict __stacksize)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+
+
+extern int pthread_attr_setstack (pthread_attr_t *__attr, void *__stackaddr,
+      size_t __stacksize) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 441 "/usr/include/pthread.h" 3 4
+extern int pthread_setschedparam (pthread_t __target_thread, int __policy,
+      const struct sched_param *__param)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3)));
+
+
+extern int pthread_getschedparam (pthread_t __target_thread,
+      int *__restrict __policy,
+      struct sched_param *__restrict __param)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+
+
+extern int pthread_setschedprio (pthread_t __target_thread, int __prio)
+     __attribute__ ((__nothrow__ , __leaf__));
+# 509 "/usr/include/pthread.h" 3 4
+extern int pthread_once (pthread_once_t *__once_control,
+    void (*__init_routine) (void)) __attribute__ ((__nonnull__ (1, 2)));
+# 521 "/usr/include/pthread.h" 3 4
+extern int pthread_setcancelstate (int __state, int *__oldstate);
+
+
+
+extern int pthread_setcanceltype (int __type, int *__oldtype);
+
+
+extern int pthread_cancel (pthread_t __th);
+
+
+
+
+extern void pthread_testcancel (void);
+
+
+
+
+struct __cancel_jmp_buf_tag
+{
+  __jmp_buf __cancel_jmp_buf;
+  int __mask_was_saved;
+};
+
+typedef struct
+{
+  struct __cancel_jmp_buf_tag __cancel_jmp_buf[1];
+  void *__pad[4];
+} __pthread_unwind_buf_t __attribute__ ((__aligned__));
+# 557 "/usr/include/pthread.h" 3 4
+struct __pthread_cleanup_frame
+{
+  void (*__cancel_routine) (void *);
+  void *__cancel_arg;
+  int __do_it;
+  int __cancel_type;
+};
+# 697 "/usr/include/pthread.h" 3 4
+extern void __pthread_register_cancel (__pthread_unwind_buf_t *__buf)
+     ;
+# 709 "/usr/include/pthread.h" 3 4
+extern void __pthread_unregister_cancel (__pthread_unwind_buf_t *__buf)
+  ;
+# 750 "/usr/include/pthread.h" 3 4
+extern void __pthread_unwind_next (__pthread_unwind_buf_t *__buf)
+     __attribute__ ((__noreturn__))
+
+     __attribute__ ((__weak__))
+
+     ;
+# 766 "/usr/include/pthread.h" 3 4
+extern int __sigsetjmp_cancel (struct __cancel_jmp_buf_tag __env[1], int __savemask) __asm__ ("" "__sigsetjmp") __attribute__ ((__nothrow__))
+
+
+                     __attribute__ ((__returns_twice__));
+# 781 "/usr/include/pthread.h" 3 4
+extern int pthread_mutex_init (pthread_mutex_t *__mutex,
+          const pthread_mutexattr_t *__mutexattr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutex_destroy (pthread_mutex_t *__mutex)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutex_trylock (pthread_mutex_t *__mutex)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutex_lock (pthread_mutex_t *__mutex)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern int pthread_mutex_timedlock (pthread_mutex_t *__restrict __mutex,
+        const struct timespec *__restrict
+        __abstime) __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1, 2)));
+# 835 "/usr/include/pthread.h" 3 4
+extern int pthread_mutex_unlock (pthread_mutex_t *__mutex)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_mutex_getprioceiling (const pthread_mutex_t *
+      __restrict __mutex,
+      int *__restrict __prioceiling)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern int pthread_mutex_setprioceiling (pthread_mutex_t *__restrict __mutex,
+      int __prioceiling,
+      int *__restrict __old_ceiling)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 3)));
+
+
+
+
+extern int pthread_mutex_consistent (pthread_mutex_t *__mutex)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 874 "/usr/include/pthread.h" 3 4
+extern int pthread_mutexattr_init (pthread_mutexattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutexattr_destroy (pthread_mutexattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutexattr_getpshared (const pthread_mutexattr_t *
+      __restrict __attr,
+      int *__restrict __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_mutexattr_setpshared (pthread_mutexattr_t *__attr,
+      int __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_mutexattr_gettype (const pthread_mutexattr_t *__restrict
+          __attr, int *__restrict __kind)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern int pthread_mutexattr_settype (pthread_mutexattr_t *__attr, int __kind)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_mutexattr_getprotocol (const pthread_mutexattr_t *
+       __restrict __attr,
+       int *__restrict __protocol)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern int pthread_mutexattr_setprotocol (pthread_mutexattr_t *__attr,
+       int __protocol)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutexattr_getprioceiling (const pthread_mutexattr_t *
+          __restrict __attr,
+          int *__restrict __prioceiling)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_mutexattr_setprioceiling (pthread_mutexattr_t *__attr,
+          int __prioceiling)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_mutexattr_getrobust (const pthread_mutexattr_t *__attr,
+     int *__robustness)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+# 946 "/usr/include/pthread.h" 3 4
+extern int pthread_mutexattr_setrobust (pthread_mutexattr_t *__attr,
+     int __robustness)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 967 "/usr/include/pthread.h" 3 4
+extern int pthread_rwlock_init (pthread_rwlock_t *__restrict __rwlock,
+    const pthread_rwlockattr_t *__restrict
+    __attr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlock_destroy (pthread_rwlock_t *__rwlock)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlock_rdlock (pthread_rwlock_t *__rwlock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlock_tryrdlock (pthread_rwlock_t *__rwlock)
+  __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern int pthread_rwlock_timedrdlock (pthread_rwlock_t *__restrict __rwlock,
+           const struct timespec *__restrict
+           __abstime) __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1, 2)));
+# 1023 "/usr/include/pthread.h" 3 4
+extern int pthread_rwlock_wrlock (pthread_rwlock_t *__rwlock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlock_trywrlock (pthread_rwlock_t *__rwlock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern int pthread_rwlock_timedwrlock (pthread_rwlock_t *__restrict __rwlock,
+           const struct timespec *__restrict
+           __abstime) __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1, 2)));
+# 1071 "/usr/include/pthread.h" 3 4
+extern int pthread_rwlock_unlock (pthread_rwlock_t *__rwlock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern int pthread_rwlockattr_init (pthread_rwlockattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlockattr_destroy (pthread_rwlockattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlockattr_getpshared (const pthread_rwlockattr_t *
+       __restrict __attr,
+       int *__restrict __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_rwlockattr_setpshared (pthread_rwlockattr_t *__attr,
+       int __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlockattr_getkind_np (const pthread_rwlockattr_t *
+       __restrict __attr,
+       int *__restrict __pref)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_rwlockattr_setkind_np (pthread_rwlockattr_t *__attr,
+       int __pref) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+extern int pthread_cond_init (pthread_cond_t *__restrict __cond,
+         const pthread_condattr_t *__restrict __cond_attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_cond_destroy (pthread_cond_t *__cond)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_cond_signal (pthread_cond_t *__cond)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_cond_broadcast (pthread_cond_t *__cond)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int pthread_cond_wait (pthread_cond_t *__restrict __cond,
+         pthread_mutex_t *__restrict __mutex)
+     __attribute__ ((__nonnull__ (1, 2)));
+# 1145 "/usr/include/pthread.h" 3 4
+extern int pthread_cond_timedwait (pthread_cond_t *__restrict __cond,
+       pthread_mutex_t *__restrict __mutex,
+       const struct timespec *__restrict __abstime)
+     __attribute__ ((__nonnull__ (1, 2, 3)));
+# 1194 "/usr/include/pthread.h" 3 4
+extern int pthread_condattr_init (pthread_condattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_condattr_destroy (pthread_condattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_condattr_getpshared (const pthread_condattr_t *
+     __restrict __attr,
+     int *__restrict __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_condattr_setpshared (pthread_condattr_t *__attr,
+     int __pshared) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_condattr_getclock (const pthread_condattr_t *
+          __restrict __attr,
+          __clockid_t *__restrict __clock_id)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_condattr_setclock (pthread_condattr_t *__attr,
+          __clockid_t __clock_id)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 1230 "/usr/include/pthread.h" 3 4
+extern int pthread_spin_init (pthread_spinlock_t *__lock, int __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_spin_destroy (pthread_spinlock_t *__lock)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_spin_lock (pthread_spinlock_t *__lock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_spin_trylock (pthread_spinlock_t *__lock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_spin_unlock (pthread_spinlock_t *__lock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int pthread_barrier_init (pthread_barrier_t *__restrict __barrier,
+     const pthread_barrierattr_t *__restrict
+     __attr, unsigned int __count)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_barrier_destroy (pthread_barrier_t *__barrier)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_barrier_wait (pthread_barrier_t *__barrier)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_barrierattr_init (pthread_barrierattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_barrierattr_destroy (pthread_barrierattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_barrierattr_getpshared (const pthread_barrierattr_t *
+        __restrict __attr,
+        int *__restrict __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_barrierattr_setpshared (pthread_barrierattr_t *__attr,
+        int __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 1297 "/usr/include/pthread.h" 3 4
+extern int pthread_key_create (pthread_key_t *__key,
+          void (*__destr_function) (void *))
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_key_delete (pthread_key_t __key) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern void *pthread_getspecific (pthread_key_t __key) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int pthread_setspecific (pthread_key_t __key,
+    const void *__pointer)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__access__ (__none__, 2)));
+
+
+
+
+extern int pthread_getcpuclockid (pthread_t __thread_id,
+      __clockid_t *__clock_id)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+# 1332 "/usr/include/pthread.h" 3 4
+extern int pthread_atfork (void (*__prepare) (void),
+      void (*__parent) (void),
+      void (*__child) (void)) __attribute__ ((__nothrow__ , __leaf__));
+# 1346 "/usr/include/pthread.h" 3 4
+
+# 30 "./src/main/drivers/accgyro/accgyro.h" 2
+# 47 "./src/main/drivers/accgyro/accgyro.h"
+
+# 47 "./src/main/drivers/accgyro/accgyro.h"
+typedef enum {
+    GYRO_RATE_1_kHz,
+    GYRO_RATE_1100_Hz,
+    GYRO_RATE_3200_Hz,
+    GYRO_RATE_8_kHz,
+    GYRO_RATE_9_kHz,
+    GYRO_RATE_32_kHz,
+} gyroRateKHz_e;
+
+typedef struct gyroDev_s {
+
+    pthread_mutex_t lock;
+
+    sensorGyroInitFuncPtr initFn;
+    sensorGyroReadFuncPtr readFn;
+    sensorGyroReadDataFuncPtr temperatureFn;
+    extiCallbackRec_t exti;
+    busDevice_t bus;
+    float scale;
+    float gyroZero[3];
+    float gyroADC[3];
+    int32_t gyroADCRawPrevious[3];
+    int16_t gyroADCRaw[3];
+    int16_t temperature;
+    mpuConfiguration_t mpuConfiguration;
+    mpuDetectionResult_t mpuDetectionResult;
+    sensor_align_e gyroAlign;
+    gyroRateKHz_e gyroRateKHz;
+    
+# 75 "./src/main/drivers/accgyro/accgyro.h" 3 4
+   _Bool 
+# 75 "./src/main/drivers/accgyro/accgyro.h"
+        dataReady;
+    
+# 76 "./src/main/drivers/accgyro/accgyro.h" 3 4
+   _Bool 
+# 76 "./src/main/drivers/accgyro/accgyro.h"
+        gyro_high_fsr;
+    uint8_t lpf;
+    uint8_t mpuDividerDrops;
+    ioTag_t mpuIntExtiTag;
+    uint8_t filler[3];
+} gyroDev_t;
+
+typedef struct accDev_s {
+
+    pthread_mutex_t lock;
+
+    sensorAccInitFuncPtr initFn;
+    sensorAccReadFuncPtr readFn;
+    busDevice_t bus;
+    uint16_t acc_1G;
+    int16_t ADCRaw[3];
+    mpuDetectionResult_t mpuDetectionResult;
+    sensor_align_e accAlign;
+    
+# 94 "./src/main/drivers/accgyro/accgyro.h" 3 4
+   _Bool 
+# 94 "./src/main/drivers/accgyro/accgyro.h"
+        dataReady;
+    
+# 95 "./src/main/drivers/accgyro/accgyro.h" 3 4
+   _Bool 
+# 95 "./src/main/drivers/accgyro/accgyro.h"
+        acc_high_fsr;
+    char revisionCode;
+    uint8_t filler[2];
+} accDev_t;
+
+static inline void accDevLock(accDev_t *acc)
+{
+
+    pthread_mutex_lock(&acc->lock);
+
+
+
+}
+
+static inline void accDevUnLock(accDev_t *acc)
+{
+
+    pthread_mutex_unlock(&acc->lock);
+
+
+
+}
+
+static inline void gyroDevLock(gyroDev_t *gyro)
+{
+
+    pthread_mutex_lock(&gyro->lock);
+
+
+
+}
+
+static inline void gyroDevUnLock(gyroDev_t *gyro)
+{
+
+    pthread_mutex_unlock(&gyro->lock);
+
+
+
+}
+#pragma GCC diagnostic pop
+# 23 "./src/main/sensors/acceleration.h" 2
+# 1 "./src/main/sensors/sensors.h" 1
+# 18 "./src/main/sensors/sensors.h"
+       
+
+typedef enum {
+    SENSOR_INDEX_GYRO = 0,
+    SENSOR_INDEX_ACC,
+    SENSOR_INDEX_BARO,
+    SENSOR_INDEX_MAG,
+    SENSOR_INDEX_RANGEFINDER,
+    SENSOR_INDEX_COUNT
+} sensorIndex_e;
+
+extern uint8_t requestedSensors[SENSOR_INDEX_COUNT];
+extern uint8_t detectedSensors[SENSOR_INDEX_COUNT];
+
+typedef struct int16_flightDynamicsTrims_s {
+    int16_t roll;
+    int16_t pitch;
+    int16_t yaw;
+} flightDynamicsTrims_def_t;
+
+typedef union flightDynamicsTrims_u {
+    int16_t raw[3];
+    flightDynamicsTrims_def_t values;
+} flightDynamicsTrims_t;
+
+
+
+
+
+typedef enum {
+    SENSOR_GYRO = 1 << 0,
+    SENSOR_ACC = 1 << 1,
+    SENSOR_BARO = 1 << 2,
+    SENSOR_MAG = 1 << 3,
+    SENSOR_SONAR = 1 << 4,
+    SENSOR_RANGEFINDER = 1 << 4,
+    SENSOR_GPS = 1 << 5,
+    SENSOR_GPSMAG = 1 << 6
+} sensors_e;
+# 24 "./src/main/sensors/acceleration.h" 2
+
+
+typedef enum {
+    ACC_DEFAULT,
+    ACC_NONE,
+    ACC_ADXL345,
+    ACC_MPU6050,
+    ACC_MMA8452,
+    ACC_BMA280,
+    ACC_LSM303DLHC,
+    ACC_MPU6000,
+    ACC_MPU6500,
+    ACC_MPU9250,
+    ACC_ICM20601,
+    ACC_ICM20602,
+    ACC_ICM20608G,
+    ACC_ICM20649,
+    ACC_ICM20689,
+    ACC_BMI160,
+    ACC_FAKE
+} accelerationSensor_e;
+
+typedef struct acc_s {
+    accDev_t dev;
+    uint32_t accSamplingInterval;
+    float accADC[3];
+    
+# 50 "./src/main/sensors/acceleration.h" 3 4
+   _Bool 
+# 50 "./src/main/sensors/acceleration.h"
+        isAccelUpdatedAtLeastOnce;
+} acc_t;
+
+extern acc_t acc;
+
+typedef struct rollAndPitchTrims_s {
+    int16_t roll;
+    int16_t pitch;
+} rollAndPitchTrims_t_def;
+
+typedef union rollAndPitchTrims_u {
+    int16_t raw[2];
+    rollAndPitchTrims_t_def values;
+} rollAndPitchTrims_t;
+
+
+typedef struct accelerometerConfig_s {
+    uint16_t acc_lpf_hz;
+    sensor_align_e acc_align;
+    uint8_t acc_hardware;
+    
+# 70 "./src/main/sensors/acceleration.h" 3 4
+   _Bool 
+# 70 "./src/main/sensors/acceleration.h"
+        acc_high_fsr;
+    flightDynamicsTrims_t accZero;
+    rollAndPitchTrims_t accelerometerTrims;
+} accelerometerConfig_t;
+
+extern accelerometerConfig_t accelerometerConfig_System; extern accelerometerConfig_t accelerometerConfig_Copy; static inline const accelerometerConfig_t* accelerometerConfig(void) { return &accelerometerConfig_System; } static inline accelerometerConfig_t* accelerometerConfigMutable(void) { return &accelerometerConfig_System; } struct _dummy;
+
+
+# 77 "./src/main/sensors/acceleration.h" 3 4
+_Bool 
+# 77 "./src/main/sensors/acceleration.h"
+    accInit(uint32_t gyroTargetLooptime);
+
+# 78 "./src/main/sensors/acceleration.h" 3 4
+_Bool 
+# 78 "./src/main/sensors/acceleration.h"
+    accIsCalibrationComplete(void);
+void accSetCalibrationCycles(uint16_t calibrationCyclesRequired);
+void resetRollAndPitchTrims(rollAndPitchTrims_t *rollAndPitchTrims);
+void accUpdate(timeUs_t currentTimeUs, rollAndPitchTrims_t *rollAndPitchTrims);
+
+# 82 "./src/main/sensors/acceleration.h" 3 4
+_Bool 
+# 82 "./src/main/sensors/acceleration.h"
+    accGetAccumulationAverage(float *accumulation);
+union flightDynamicsTrims_u;
+void setAccelerationTrims(union flightDynamicsTrims_u *accelerationTrimsToUse);
+void accInitFilters(void);
+# 85 "./src/main/interface/settings.c" 2
+# 1 "./src/main/sensors/barometer.h" 1
+# 18 "./src/main/sensors/barometer.h"
+       
+
+
+# 1 "./src/main/drivers/barometer/barometer.h" 1
+# 18 "./src/main/drivers/barometer/barometer.h"
+       
+
+
+
+struct baroDev_s;
+
+typedef void (*baroOpFuncPtr)(struct baroDev_s *baro);
+typedef void (*baroCalculateFuncPtr)(int32_t *pressure, int32_t *temperature);
+
+typedef struct baroDev_s {
+    busDevice_t busdev;
+    uint16_t ut_delay;
+    uint16_t up_delay;
+    baroOpFuncPtr start_ut;
+    baroOpFuncPtr get_ut;
+    baroOpFuncPtr start_up;
+    baroOpFuncPtr get_up;
+    baroCalculateFuncPtr calculate;
+} baroDev_t;
+# 22 "./src/main/sensors/barometer.h" 2
+
+typedef enum {
+    BARO_DEFAULT = 0,
+    BARO_NONE = 1,
+    BARO_BMP085 = 2,
+    BARO_MS5611 = 3,
+    BARO_BMP280 = 4,
+    BARO_LPS = 5
+} baroSensor_e;
+
+
+
+typedef struct barometerConfig_s {
+    uint8_t baro_bustype;
+    uint8_t baro_spi_device;
+    ioTag_t baro_spi_csn;
+    uint8_t baro_i2c_device;
+    uint8_t baro_i2c_address;
+    uint8_t baro_hardware;
+    uint8_t baro_sample_count;
+    uint16_t baro_noise_lpf;
+    uint16_t baro_cf_vel;
+    uint16_t baro_cf_alt;
+} barometerConfig_t;
+
+extern barometerConfig_t barometerConfig_System; extern barometerConfig_t barometerConfig_Copy; static inline const barometerConfig_t* barometerConfig(void) { return &barometerConfig_System; } static inline barometerConfig_t* barometerConfigMutable(void) { return &barometerConfig_System; } struct _dummy;
+
+typedef struct baro_s {
+    baroDev_t dev;
+    int32_t BaroAlt;
+    int32_t baroTemperature;
+    int32_t baroPressure;
+} baro_t;
+
+extern baro_t baro;
+
+
+# 58 "./src/main/sensors/barometer.h" 3 4
+_Bool 
+# 58 "./src/main/sensors/barometer.h"
+    baroDetect(baroDev_t *dev, baroSensor_e baroHardwareToUse);
+
+# 59 "./src/main/sensors/barometer.h" 3 4
+_Bool 
+# 59 "./src/main/sensors/barometer.h"
+    isBaroCalibrationComplete(void);
+void baroSetCalibrationCycles(uint16_t calibrationCyclesRequired);
+uint32_t baroUpdate(void);
+
+# 62 "./src/main/sensors/barometer.h" 3 4
+_Bool 
+# 62 "./src/main/sensors/barometer.h"
+    isBaroReady(void);
+int32_t baroCalculateAltitude(void);
+void performBaroCalibrationCycle(void);
+# 86 "./src/main/interface/settings.c" 2
+# 1 "./src/main/sensors/battery.h" 1
+# 18 "./src/main/sensors/battery.h"
+       
+
+
+
+
+
+# 1 "./src/main/sensors/current.h" 1
+# 18 "./src/main/sensors/current.h"
+       
+
+
+# 1 "./src/main/sensors/current_ids.h" 1
+# 18 "./src/main/sensors/current_ids.h"
+       
+
+
+
+
+
+typedef enum {
+    CURRENT_METER_ID_NONE = 0,
+
+    CURRENT_METER_ID_BATTERY_1 = 10,
+    CURRENT_METER_ID_BATTERY_2,
+
+    CURRENT_METER_ID_BATTERY_10 = 19,
+
+    CURRENT_METER_ID_5V_1 = 20,
+    CURRENT_METER_ID_5V_2,
+
+    CURRENT_METER_ID_5V_10 = 29,
+
+    CURRENT_METER_ID_9V_1 = 30,
+    CURRENT_METER_ID_9V_2,
+
+    CURRENT_METER_ID_9V_10 = 39,
+
+    CURRENT_METER_ID_12V_1 = 40,
+    CURRENT_METER_ID_12V_2,
+
+    CURRENT_METER_ID_12V_10 = 49,
+
+    CURRENT_METER_ID_ESC_COMBINED_1 = 50,
+
+    CURRENT_METER_ID_ESC_COMBINED_10 = 59,
+
+    CURRENT_METER_ID_ESC_MOTOR_1 = 60,
+    CURRENT_METER_ID_ESC_MOTOR_2,
+    CURRENT_METER_ID_ESC_MOTOR_3,
+    CURRENT_METER_ID_ESC_MOTOR_4,
+    CURRENT_METER_ID_ESC_MOTOR_5,
+    CURRENT_METER_ID_ESC_MOTOR_6,
+    CURRENT_METER_ID_ESC_MOTOR_7,
+    CURRENT_METER_ID_ESC_MOTOR_8,
+    CURRENT_METER_ID_ESC_MOTOR_9,
+    CURRENT_METER_ID_ESC_MOTOR_10,
+    CURRENT_METER_ID_ESC_MOTOR_11,
+    CURRENT_METER_ID_ESC_MOTOR_12,
+
+    CURRENT_METER_ID_ESC_MOTOR_20 = 79,
+
+    CURRENT_METER_ID_VIRTUAL_1 = 80,
+    CURRENT_METER_ID_VIRTUAL_2,
+
+    CURRENT_METER_ID_MSP_1 = 90,
+    CURRENT_METER_ID_MSP_2,
+
+} currentMeterId_e;
+# 22 "./src/main/sensors/current.h" 2
+
+typedef enum {
+    CURRENT_METER_NONE = 0,
+    CURRENT_METER_ADC,
+    CURRENT_METER_VIRTUAL,
+    CURRENT_METER_ESC,
+    CURRENT_METER_MSP,
+    CURRENT_METER_COUNT
+} currentMeterSource_e;
+
+extern const char * const currentMeterSourceNames[CURRENT_METER_COUNT];
+
+typedef struct currentMeter_s {
+    int32_t amperage;
+    int32_t amperageLatest;
+    int32_t mAhDrawn;
+} currentMeter_t;
+
+
+
+typedef struct currentMeterMAhDrawnState_s {
+    int32_t mAhDrawn;
+    float mAhDrawnF;
+} currentMeterMAhDrawnState_t;
+
+
+
+
+
+typedef enum {
+    CURRENT_SENSOR_VIRTUAL = 0,
+    CURRENT_SENSOR_ADC,
+    CURRENT_SENSOR_ESC,
+    CURRENT_SENSOR_MSP
+} currentSensor_e;
+
+
+
+
+
+
+typedef struct currentMeterADCState_s {
+    currentMeterMAhDrawnState_t mahDrawnState;
+    int32_t amperage;
+    int32_t amperageLatest;
+} currentMeterADCState_t;
+
+typedef struct currentSensorADCConfig_s {
+    int16_t scale;
+    int16_t offset;
+} currentSensorADCConfig_t;
+
+extern currentSensorADCConfig_t currentSensorADCConfig_System; extern currentSensorADCConfig_t currentSensorADCConfig_Copy; static inline const currentSensorADCConfig_t* currentSensorADCConfig(void) { return &currentSensorADCConfig_System; } static inline currentSensorADCConfig_t* currentSensorADCConfigMutable(void) { return &currentSensorADCConfig_System; } struct _dummy;
+
+
+
+
+
+typedef struct currentMeterVirtualState_s {
+    currentMeterMAhDrawnState_t mahDrawnState;
+    int32_t amperage;
+} currentSensorVirtualState_t;
+
+typedef struct currentSensorVirtualConfig_s {
+    int16_t scale;
+    uint16_t offset;
+} currentSensorVirtualConfig_t;
+
+extern currentSensorVirtualConfig_t currentSensorVirtualConfig_System; extern currentSensorVirtualConfig_t currentSensorVirtualConfig_Copy; static inline const currentSensorVirtualConfig_t* currentSensorVirtualConfig(void) { return &currentSensorVirtualConfig_System; } static inline currentSensorVirtualConfig_t* currentSensorVirtualConfigMutable(void) { return &currentSensorVirtualConfig_System; } struct _dummy;
+
+
+
+
+
+typedef struct currentMeterESCState_s {
+    int32_t mAhDrawn;
+    int32_t amperage;
+} currentMeterESCState_t;
+
+
+
+
+
+
+typedef struct currentMeterMSPState_s {
+    int32_t mAhDrawn;
+    int32_t amperage;
+} currentMeterMSPState_t;
+
+
+
+
+
+
+void currentMeterReset(currentMeter_t *meter);
+
+void currentMeterADCInit(void);
+void currentMeterADCRefresh(int32_t lastUpdateAt);
+void currentMeterADCRead(currentMeter_t *meter);
+
+void currentMeterVirtualInit(void);
+void currentMeterVirtualRefresh(int32_t lastUpdateAt, 
+# 123 "./src/main/sensors/current.h" 3 4
+                                                     _Bool 
+# 123 "./src/main/sensors/current.h"
+                                                          armed, 
+# 123 "./src/main/sensors/current.h" 3 4
+                                                                 _Bool 
+# 123 "./src/main/sensors/current.h"
+                                                                      throttleLowAndMotorStop, int32_t throttleOffset);
+void currentMeterVirtualRead(currentMeter_t *meter);
+
+void currentMeterESCInit(void);
+void currentMeterESCRefresh(int32_t lastUpdateAt);
+void currentMeterESCReadCombined(currentMeter_t *meter);
+void currentMeterESCReadMotor(uint8_t motorNumber, currentMeter_t *meter);
+
+void currentMeterMSPInit(void);
+void currentMeterMSPRefresh(timeUs_t currentTimeUs);
+void currentMeterMSPRead(currentMeter_t *meter);
+void currentMeterMSPSet(uint16_t amperage, uint16_t mAhDrawn);
+
+
+
+
+extern const uint8_t supportedCurrentMeterCount;
+extern const uint8_t currentMeterIds[];
+void currentMeterRead(currentMeterId_e id, currentMeter_t *currentMeter);
+# 25 "./src/main/sensors/battery.h" 2
+# 1 "./src/main/sensors/voltage.h" 1
+# 18 "./src/main/sensors/voltage.h"
+       
+
+# 1 "./src/main/sensors/voltage_ids.h" 1
+# 18 "./src/main/sensors/voltage_ids.h"
+       
+
+
+
+
+
+typedef enum {
+    VOLTAGE_METER_ID_NONE = 0,
+
+    VOLTAGE_METER_ID_BATTERY_1 = 10,
+    VOLTAGE_METER_ID_BATTERY_2,
+
+    VOLTAGE_METER_ID_BATTERY_10 = 19,
+
+    VOLTAGE_METER_ID_5V_1 = 20,
+    VOLTAGE_METER_ID_5V_2,
+
+    VOLTAGE_METER_ID_5V_10 = 29,
+
+    VOLTAGE_METER_ID_9V_1 = 30,
+    VOLTAGE_METER_ID_9V_2,
+
+    VOLTAGE_METER_ID_9V_10 = 39,
+
+    VOLTAGE_METER_ID_12V_1 = 40,
+    VOLTAGE_METER_ID_12V_2,
+
+    VOLTAGE_METER_ID_12V_10 = 49,
+
+    VOLTAGE_METER_ID_ESC_COMBINED_1 = 50,
+
+    VOLTAGE_METER_ID_ESC_COMBINED_10 = 59,
+
+    VOLTAGE_METER_ID_ESC_MOTOR_1 = 60,
+    VOLTAGE_METER_ID_ESC_MOTOR_2,
+    VOLTAGE_METER_ID_ESC_MOTOR_3,
+    VOLTAGE_METER_ID_ESC_MOTOR_4,
+    VOLTAGE_METER_ID_ESC_MOTOR_5,
+    VOLTAGE_METER_ID_ESC_MOTOR_6,
+    VOLTAGE_METER_ID_ESC_MOTOR_7,
+    VOLTAGE_METER_ID_ESC_MOTOR_8,
+    VOLTAGE_METER_ID_ESC_MOTOR_9,
+    VOLTAGE_METER_ID_ESC_MOTOR_10,
+    VOLTAGE_METER_ID_ESC_MOTOR_11,
+    VOLTAGE_METER_ID_ESC_MOTOR_12,
+
+    VOLTAGE_METER_ID_ESC_MOTOR_20 = 79,
+
+    VOLTAGE_METER_ID_CELL_1 = 80,
+    VOLTAGE_METER_ID_CELL_2,
+
+    VOLTAGE_METER_ID_CELL_40 = 119,
+
+} voltageMeterId_e;
+# 21 "./src/main/sensors/voltage.h" 2
+
+
+
+
+
+typedef enum {
+    VOLTAGE_METER_NONE = 0,
+    VOLTAGE_METER_ADC,
+    VOLTAGE_METER_ESC,
+    VOLTAGE_METER_COUNT
+} voltageMeterSource_e;
+
+extern const char * const voltageMeterSourceNames[VOLTAGE_METER_COUNT];
+
+
+
+typedef struct voltageMeter_s {
+    uint16_t filtered;
+    uint16_t unfiltered;
+    
+# 40 "./src/main/sensors/voltage.h" 3 4
+   _Bool 
+# 40 "./src/main/sensors/voltage.h"
+        lowVoltageCutoff;
+} voltageMeter_t;
+
+
+
+
+
+
+typedef enum {
+    VOLTAGE_SENSOR_TYPE_ADC_RESISTOR_DIVIDER = 0,
+    VOLTAGE_SENSOR_TYPE_ESC
+} voltageSensorType_e;
+# 69 "./src/main/sensors/voltage.h"
+typedef enum {
+    VOLTAGE_SENSOR_ADC_VBAT = 0,
+    VOLTAGE_SENSOR_ADC_12V = 1,
+    VOLTAGE_SENSOR_ADC_9V = 2,
+    VOLTAGE_SENSOR_ADC_5V = 3
+} voltageSensorADC_e;
+
+
+typedef struct voltageSensorADCConfig_s {
+    uint8_t vbatscale;
+    uint8_t vbatresdivval;
+    uint8_t vbatresdivmultiplier;
+} voltageSensorADCConfig_t;
+
+extern voltageSensorADCConfig_t voltageSensorADCConfig_SystemArray[1]; extern voltageSensorADCConfig_t voltageSensorADCConfig_CopyArray[1]; static inline const voltageSensorADCConfig_t* voltageSensorADCConfig(int _index) { return &voltageSensorADCConfig_SystemArray[_index]; } static inline voltageSensorADCConfig_t* voltageSensorADCConfigMutable(int _index) { return &voltageSensorADCConfig_SystemArray[_index]; } static inline voltageSensorADCConfig_t (* voltageSensorADCConfig_array(void))[1] { return &voltageSensorADCConfig_SystemArray; } struct _dummy;
+
+
+
+
+void voltageMeterReset(voltageMeter_t *voltageMeter);
+
+void voltageMeterADCInit(void);
+void voltageMeterADCRefresh(void);
+void voltageMeterADCRead(voltageSensorADC_e adcChannel, voltageMeter_t *voltageMeter);
+
+void voltageMeterESCInit(void);
+void voltageMeterESCRefresh(void);
+void voltageMeterESCReadCombined(voltageMeter_t *voltageMeter);
+void voltageMeterESCReadMotor(uint8_t motor, voltageMeter_t *voltageMeter);
+
+
+
+
+
+extern const uint8_t voltageMeterADCtoIDMap[1];
+
+extern const uint8_t supportedVoltageMeterCount;
+extern const uint8_t voltageMeterIds[];
+void voltageMeterRead(voltageMeterId_e id, voltageMeter_t *voltageMeter);
+# 26 "./src/main/sensors/battery.h" 2
+
+typedef struct batteryConfig_s {
+
+    uint8_t vbatmaxcellvoltage;
+    uint8_t vbatmincellvoltage;
+    uint8_t vbatwarningcellvoltage;
+    uint8_t vbatnotpresentcellvoltage;
+    uint8_t lvcPercentage;
+    voltageMeterSource_e voltageMeterSource;
+
+
+    currentMeterSource_e currentMeterSource;
+    uint16_t batteryCapacity;
+
+
+    
+# 41 "./src/main/sensors/battery.h" 3 4
+   _Bool 
+# 41 "./src/main/sensors/battery.h"
+        useVBatAlerts;
+    
+# 42 "./src/main/sensors/battery.h" 3 4
+   _Bool 
+# 42 "./src/main/sensors/battery.h"
+        useConsumptionAlerts;
+    uint8_t consumptionWarningPercentage;
+    uint8_t vbathysteresis;
+
+    uint8_t vbatfullcellvoltage;
+
+} batteryConfig_t;
+
+typedef struct lowVoltageCutoff_s {
+    
+# 51 "./src/main/sensors/battery.h" 3 4
+   _Bool 
+# 51 "./src/main/sensors/battery.h"
+        enabled;
+    uint8_t percentage;
+    timeUs_t startTime;
+} lowVoltageCutoff_t;
+
+extern batteryConfig_t batteryConfig_System; extern batteryConfig_t batteryConfig_Copy; static inline const batteryConfig_t* batteryConfig(void) { return &batteryConfig_System; } static inline batteryConfig_t* batteryConfigMutable(void) { return &batteryConfig_System; } struct _dummy;
+
+typedef enum {
+    BATTERY_OK = 0,
+    BATTERY_WARNING,
+    BATTERY_CRITICAL,
+    BATTERY_NOT_PRESENT,
+    BATTERY_INIT
+} batteryState_e;
+
+void batteryInit(void);
+void batteryUpdateVoltage(timeUs_t currentTimeUs);
+void batteryUpdatePresence(void);
+
+batteryState_e getBatteryState(void);
+const char * getBatteryStateString(void);
+
+void batteryUpdateStates(timeUs_t currentTimeUs);
+void batteryUpdateAlarms(void);
+
+struct rxConfig_s;
+
+float calculateVbatPidCompensation(void);
+uint8_t calculateBatteryPercentageRemaining(void);
+
+# 80 "./src/main/sensors/battery.h" 3 4
+_Bool 
+# 80 "./src/main/sensors/battery.h"
+    isBatteryVoltageConfigured(void);
+uint16_t getBatteryVoltage(void);
+uint16_t getBatteryVoltageLatest(void);
+uint8_t getBatteryCellCount(void);
+uint16_t getBatteryAverageCellVoltage(void);
+
+
+# 86 "./src/main/sensors/battery.h" 3 4
+_Bool 
+# 86 "./src/main/sensors/battery.h"
+    isAmperageConfigured(void);
+int32_t getAmperage(void);
+int32_t getAmperageLatest(void);
+int32_t getMAhDrawn(void);
+
+void batteryUpdateCurrentMeter(timeUs_t currentTimeUs);
+
+const lowVoltageCutoff_t *getLowVoltageCutoff(void);
+# 87 "./src/main/interface/settings.c" 2
+# 1 "./src/main/sensors/boardalignment.h" 1
+# 18 "./src/main/sensors/boardalignment.h"
+       
+
+
+
+typedef struct boardAlignment_s {
+    int32_t rollDegrees;
+    int32_t pitchDegrees;
+    int32_t yawDegrees;
+} boardAlignment_t;
+
+extern boardAlignment_t boardAlignment_System; extern boardAlignment_t boardAlignment_Copy; static inline const boardAlignment_t* boardAlignment(void) { return &boardAlignment_System; } static inline boardAlignment_t* boardAlignmentMutable(void) { return &boardAlignment_System; } struct _dummy;
+
+void alignSensors(float *dest, uint8_t rotation);
+void initBoardAlignment(const boardAlignment_t *boardAlignment);
+# 88 "./src/main/interface/settings.c" 2
+# 1 "./src/main/sensors/compass.h" 1
+# 18 "./src/main/sensors/compass.h"
+       
+# 28 "./src/main/sensors/compass.h"
+typedef enum {
+    MAG_DEFAULT = 0,
+    MAG_NONE = 1,
+    MAG_HMC5883 = 2,
+    MAG_AK8975 = 3,
+    MAG_AK8963 = 4
+} magSensor_e;
+
+typedef struct mag_s {
+    float magADC[3];
+    float magneticDeclination;
+} mag_t;
+
+extern mag_t mag;
+
+typedef struct compassConfig_s {
+    int16_t mag_declination;
+
+    sensor_align_e mag_align;
+    uint8_t mag_hardware;
+    uint8_t mag_bustype;
+    uint8_t mag_i2c_device;
+    uint8_t mag_i2c_address;
+    uint8_t mag_spi_device;
+    ioTag_t mag_spi_csn;
+    ioTag_t interruptTag;
+    flightDynamicsTrims_t magZero;
+} compassConfig_t;
+
+extern compassConfig_t compassConfig_System; extern compassConfig_t compassConfig_Copy; static inline const compassConfig_t* compassConfig(void) { return &compassConfig_System; } static inline compassConfig_t* compassConfigMutable(void) { return &compassConfig_System; } struct _dummy;
+
+
+# 59 "./src/main/sensors/compass.h" 3 4
+_Bool 
+# 59 "./src/main/sensors/compass.h"
+    compassIsHealthy(void);
+void compassUpdate(timeUs_t currentTime);
+
+# 61 "./src/main/sensors/compass.h" 3 4
+_Bool 
+# 61 "./src/main/sensors/compass.h"
+    compassInit(void);
+# 89 "./src/main/interface/settings.c" 2
+# 1 "./src/main/sensors/esc_sensor.h" 1
+# 18 "./src/main/sensors/esc_sensor.h"
+       
+
+
+
+typedef struct escSensorConfig_s {
+    uint8_t halfDuplex;
+} escSensorConfig_t;
+
+extern escSensorConfig_t escSensorConfig_System; extern escSensorConfig_t escSensorConfig_Copy; static inline const escSensorConfig_t* escSensorConfig(void) { return &escSensorConfig_System; } static inline escSensorConfig_t* escSensorConfigMutable(void) { return &escSensorConfig_System; } struct _dummy;
+
+typedef struct {
+    uint8_t dataAge;
+    int8_t temperature;
+    int16_t voltage;
+    int16_t current;
+    int16_t consumption;
+    int16_t rpm;
+} escSensorData_t;
+
+
+
+
+
+
+# 41 "./src/main/sensors/esc_sensor.h" 3 4
+_Bool 
+# 41 "./src/main/sensors/esc_sensor.h"
+    escSensorInit(void);
+void escSensorProcess(timeUs_t currentTime);
+
+
+
+escSensorData_t *getEscSensorData(uint8_t motorNumber);
+
+void startEscDataRead(uint8_t *frameBuffer, uint8_t frameLength);
+uint8_t getNumberEscBytesRead(void);
+
+uint8_t calculateCrc8(const uint8_t *Buf, const uint8_t BufLen);
+# 90 "./src/main/interface/settings.c" 2
+# 1 "./src/main/sensors/gyro.h" 1
+# 18 "./src/main/sensors/gyro.h"
+       
+
+
+
+
+
+
+
+typedef enum {
+    GYRO_NONE = 0,
+    GYRO_DEFAULT,
+    GYRO_MPU6050,
+    GYRO_L3G4200D,
+    GYRO_MPU3050,
+    GYRO_L3GD20,
+    GYRO_MPU6000,
+    GYRO_MPU6500,
+    GYRO_MPU9250,
+    GYRO_ICM20601,
+    GYRO_ICM20602,
+    GYRO_ICM20608G,
+    GYRO_ICM20649,
+    GYRO_ICM20689,
+    GYRO_BMI160,
+    GYRO_FAKE
+} gyroSensor_e;
+
+typedef struct gyro_s {
+    uint32_t targetLooptime;
+    float gyroADCf[3];
+} gyro_t;
+
+extern gyro_t gyro;
+
+typedef enum {
+    GYRO_OVERFLOW_CHECK_NONE = 0,
+    GYRO_OVERFLOW_CHECK_YAW,
+    GYRO_OVERFLOW_CHECK_ALL_AXES
+} gyroOverflowCheck_e;
+
+
+typedef enum {
+    DYN_FFT_PEAK_MEAN = 0,
+    DYN_FFT_PEAK_PARABOLIC,
+    DYN_FFT_PEAK_GAUSSIAN
+} dynFftPeakMode_e;
+
+
+
+typedef struct gyroConfig_s {
+    sensor_align_e gyro_align;
+    uint8_t gyroMovementCalibrationThreshold;
+    uint8_t gyro_sync_denom;
+    uint8_t gyro_lpf;
+    uint8_t gyro_soft_lpf_type;
+    uint8_t gyro_soft_lpf_hz;
+    
+# 74 "./src/main/sensors/gyro.h" 3 4
+   _Bool 
+# 74 "./src/main/sensors/gyro.h"
+            gyro_high_fsr;
+    
+# 75 "./src/main/sensors/gyro.h" 3 4
+   _Bool 
+# 75 "./src/main/sensors/gyro.h"
+            gyro_use_32khz;
+    uint8_t gyro_to_use;
+    uint16_t gyro_soft_lpf_hz_2;
+    uint16_t gyro_soft_notch_hz_1;
+    uint16_t gyro_soft_notch_cutoff_1;
+    uint16_t gyro_soft_notch_hz_2;
+    uint16_t gyro_soft_notch_cutoff_2;
+    gyroOverflowCheck_e checkOverflow;
+    uint16_t gyro_filter_q;
+    uint16_t gyro_filter_r;
+    uint16_t gyro_filter_p;
+    int16_t gyro_offset_yaw;
+    uint16_t dyn_fft_window;
+    uint16_t dyn_fft_sample_hz;
+    uint8_t dyn_fft_peak_mode;
+    uint8_t dyn_notch_count;
+} gyroConfig_t;
+
+extern gyroConfig_t gyroConfig_System; extern gyroConfig_t gyroConfig_Copy; static inline const gyroConfig_t* gyroConfig(void) { return &gyroConfig_System; } static inline gyroConfig_t* gyroConfigMutable(void) { return &gyroConfig_System; } struct _dummy;
+
+
+# 95 "./src/main/sensors/gyro.h" 3 4
+_Bool 
+# 95 "./src/main/sensors/gyro.h"
+    gyroInit(void);
+
+void gyroInitFilters(void);
+void gyroUpdate(timeUs_t currentTimeUs);
+
+# 99 "./src/main/sensors/gyro.h" 3 4
+_Bool 
+# 99 "./src/main/sensors/gyro.h"
+    gyroGetAccumulationAverage(float *accumulation);
+const busDevice_t *gyroSensorBus(void);
+struct mpuConfiguration_s;
+const struct mpuConfiguration_s *gyroMpuConfiguration(void);
+struct mpuDetectionResult_s;
+const struct mpuDetectionResult_s *gyroMpuDetectionResult(void);
+void gyroStartCalibration(
+# 105 "./src/main/sensors/gyro.h" 3 4
+                         _Bool 
+# 105 "./src/main/sensors/gyro.h"
+                              isFirstArmingCalibration);
+
+# 106 "./src/main/sensors/gyro.h" 3 4
+_Bool 
+# 106 "./src/main/sensors/gyro.h"
+    isFirstArmingGyroCalibrationRunning(void);
+
+# 107 "./src/main/sensors/gyro.h" 3 4
+_Bool 
+# 107 "./src/main/sensors/gyro.h"
+    isGyroCalibrationComplete(void);
+void gyroReadTemperature(void);
+int16_t gyroGetTemperature(void);
+int16_t gyroRateDps(int axis);
+
+# 111 "./src/main/sensors/gyro.h" 3 4
+_Bool 
+# 111 "./src/main/sensors/gyro.h"
+    gyroOverflowDetected(void);
+uint16_t gyroAbsRateDps(int axis);
+# 91 "./src/main/interface/settings.c" 2
+# 1 "./src/main/sensors/gyroanalyse.h" 1
+# 18 "./src/main/sensors/gyroanalyse.h"
+       
+# 37 "./src/main/sensors/gyroanalyse.h"
+typedef struct gyroFftData_s {
+    float maxVal;
+    uint16_t centerFreq[3];
+} gyroFftData_t;
+
+void gyroDataAnalyseInit(uint32_t targetLooptime);
+uint16_t gyroDataAnalyseWindowMax(uint32_t targetLooptime);
+uint8_t gyroDataAnalyseNotchCount(void);
+const gyroFftData_t *gyroFftData(int axis);
+struct gyroDev_s;
+void gyroDataAnalyse(const struct gyroDev_s *gyroDev, biquadFilterBank_t *notchFilterDyn);
+void gyroDataAnalyseUpdate(biquadFilterBank_t *notchFilterDyn);
+# 92 "./src/main/interface/settings.c" 2
+# 1 "./src/main/sensors/rangefinder.h" 1
+# 18 "./src/main/sensors/rangefinder.h"
+       
+
+
+
+# 1 "./src/main/drivers/rangefinder/rangefinder.h" 1
+# 18 "./src/main/drivers/rangefinder/rangefinder.h"
+       
+# 27 "./src/main/drivers/rangefinder/rangefinder.h"
+typedef struct rangefinderHardwarePins_s {
+    ioTag_t triggerTag;
+    ioTag_t echoTag;
+} rangefinderHardwarePins_t;
+
+struct rangefinderDev_s;
+typedef void (*rangefinderOpInitFuncPtr)(struct rangefinderDev_s * dev);
+typedef void (*rangefinderOpStartFuncPtr)(struct rangefinderDev_s * dev);
+typedef int32_t (*rangefinderOpReadFuncPtr)(struct rangefinderDev_s * dev);
+
+typedef struct rangefinderDev_s {
+    timeMs_t delayMs;
+    int16_t maxRangeCm;
+
+
+    int16_t detectionConeDeciDegrees;
+    int16_t detectionConeExtendedDeciDegrees;
+
+
+    rangefinderOpInitFuncPtr init;
+    rangefinderOpStartFuncPtr update;
+    rangefinderOpReadFuncPtr read;
+} rangefinderDev_t;
+
+extern int16_t rangefinderMaxRangeCm;
+extern int16_t rangefinderMaxAltWithTiltCm;
+extern int16_t rangefinderCfAltCm;
+# 23 "./src/main/sensors/rangefinder.h" 2
+
+
+
+typedef enum {
+    RANGEFINDER_NONE = 0,
+    RANGEFINDER_HCSR04 = 1,
+    RANGEFINDER_TFMINI = 2,
+    RANGEFINDER_TF02 = 3,
+
+    RANGEFINDER_SRF10 = 4,
+    RANGEFINDER_HCSR04I2C = 5,
+    RANGEFINDER_VL53L0X = 6,
+    RANGEFINDER_UIB = 7,
+    RANGEFINDER_FAKE = 8,
+} rangefinderType_e;
+
+typedef struct rangefinderConfig_s {
+    uint8_t rangefinder_hardware;
+} rangefinderConfig_t;
+
+extern rangefinderConfig_t rangefinderConfig_System; extern rangefinderConfig_t rangefinderConfig_Copy; static inline const rangefinderConfig_t* rangefinderConfig(void) { return &rangefinderConfig_System; } static inline rangefinderConfig_t* rangefinderConfigMutable(void) { return &rangefinderConfig_System; } struct _dummy;
+
+typedef struct rangefinder_s {
+    rangefinderDev_t dev;
+    float maxTiltCos;
+    int32_t rawAltitude;
+    int32_t calculatedAltitude;
+    timeMs_t lastValidResponseTimeMs;
+
+    
+# 52 "./src/main/sensors/rangefinder.h" 3 4
+   _Bool 
+# 52 "./src/main/sensors/rangefinder.h"
+        snrThresholdReached;
+    int32_t dynamicDistanceThreshold;
+    int16_t snr;
+} rangefinder_t;
+
+extern rangefinder_t rangefinder;
+extern uint16_t rangefinder_idx;
+void rangefinderResetDynamicThreshold(void);
+
+# 60 "./src/main/sensors/rangefinder.h" 3 4
+_Bool 
+# 60 "./src/main/sensors/rangefinder.h"
+    rangefinderInit(void);
+
+int32_t rangefinderGetLatestAltitude(void);
+int32_t rangefinderGetLatestRawAltitude(void);
+
+void rangefinderUpdate(timeUs_t currentTimeUs);
+
+# 66 "./src/main/sensors/rangefinder.h" 3 4
+_Bool 
+# 66 "./src/main/sensors/rangefinder.h"
+    rangefinderProcess(float cosTiltAngle);
+
+# 67 "./src/main/sensors/rangefinder.h" 3 4
+_Bool 
+# 67 "./src/main/sensors/rangefinder.h"
+    rangefinderIsHealthy(void);
+# 93 "./src/main/interface/settings.c" 2
+
+# 1 "./src/main/telemetry/frsky_hub.h" 1
+# 18 "./src/main/telemetry/frsky_hub.h"
+       
+
+
+
+typedef enum {
+    FRSKY_VFAS_PRECISION_LOW = 0,
+    FRSKY_VFAS_PRECISION_HIGH
+} frskyVFasPrecision_e;
+
+typedef void frSkyHubWriteByteFn(const char data);
+
+void handleFrSkyHubTelemetry(timeUs_t currentTimeUs);
+void checkFrSkyHubTelemetryState(void);
+
+
+# 32 "./src/main/telemetry/frsky_hub.h" 3 4
+_Bool 
+# 32 "./src/main/telemetry/frsky_hub.h"
+    initFrSkyHubTelemetry(void);
+
+# 33 "./src/main/telemetry/frsky_hub.h" 3 4
+_Bool 
+# 33 "./src/main/telemetry/frsky_hub.h"
+    initFrSkyHubTelemetryExternal(frSkyHubWriteByteFn *frSkyWriteFrameExternal);
+
+void processFrSkyHubTelemetry(timeUs_t currentTimeUs);
+# 95 "./src/main/interface/settings.c" 2
+# 1 "./src/main/telemetry/ibus_shared.h" 1
+# 26 "./src/main/telemetry/ibus_shared.h"
+       
+
+
+# 1 "./src/main/drivers/serial.h" 1
+# 18 "./src/main/drivers/serial.h"
+       
+
+
+
+
+typedef enum {
+    MODE_RX = 1 << 0,
+    MODE_TX = 1 << 1,
+    MODE_RXTX = MODE_RX | MODE_TX
+} portMode_e;
+
+typedef enum {
+    SERIAL_NOT_INVERTED = 0 << 0,
+    SERIAL_INVERTED = 1 << 0,
+    SERIAL_STOPBITS_1 = 0 << 1,
+    SERIAL_STOPBITS_2 = 1 << 1,
+    SERIAL_PARITY_NO = 0 << 2,
+    SERIAL_PARITY_EVEN = 1 << 2,
+    SERIAL_UNIDIR = 0 << 3,
+    SERIAL_BIDIR = 1 << 3,
+# 46 "./src/main/drivers/serial.h"
+    SERIAL_BIDIR_OD = 0 << 4,
+    SERIAL_BIDIR_PP = 1 << 4,
+    SERIAL_BIDIR_NOPULL = 1 << 5,
+} portOptions_e;
+
+typedef void (*serialReceiveCallbackPtr)(uint16_t data, void *rxCallbackData);
+
+typedef struct serialPort_s {
+
+    const struct serialPortVTable *vTable;
+
+    uint8_t identifier;
+    portMode_e mode;
+    portOptions_e options;
+
+    uint32_t baudRate;
+
+    uint32_t rxBufferSize;
+    uint32_t txBufferSize;
+    volatile uint8_t *rxBuffer;
+    volatile uint8_t *txBuffer;
+    uint32_t rxBufferHead;
+    uint32_t rxBufferTail;
+    uint32_t txBufferHead;
+    uint32_t txBufferTail;
+
+    serialReceiveCallbackPtr rxCallback;
+    void *rxCallbackData;
+} serialPort_t;
+# 86 "./src/main/drivers/serial.h"
+typedef struct serialPinConfig_s {
+    ioTag_t ioTagTx[10];
+    ioTag_t ioTagRx[10];
+    ioTag_t ioTagInverter[10];
+} serialPinConfig_t;
+
+extern serialPinConfig_t serialPinConfig_System; extern serialPinConfig_t serialPinConfig_Copy; static inline const serialPinConfig_t* serialPinConfig(void) { return &serialPinConfig_System; } static inline serialPinConfig_t* serialPinConfigMutable(void) { return &serialPinConfig_System; } struct _dummy;
+
+struct serialPortVTable {
+    void (*serialWrite)(serialPort_t *instance, uint8_t ch);
+
+    uint32_t (*serialTotalRxWaiting)(const serialPort_t *instance);
+    uint32_t (*serialTotalTxFree)(const serialPort_t *instance);
+
+    uint8_t (*serialRead)(serialPort_t *instance);
+
+
+    void (*serialSetBaudRate)(serialPort_t *instance, uint32_t baudRate);
+
+    
+# 105 "./src/main/drivers/serial.h" 3 4
+   _Bool 
+# 105 "./src/main/drivers/serial.h"
+        (*isSerialTransmitBufferEmpty)(const serialPort_t *instance);
+
+    void (*setMode)(serialPort_t *instance, portMode_e mode);
+
+    void (*writeBuf)(serialPort_t *instance, const void *data, int count);
+
+    void (*beginWrite)(serialPort_t *instance);
+    void (*endWrite)(serialPort_t *instance);
+};
+
+void serialWrite(serialPort_t *instance, uint8_t ch);
+uint32_t serialRxBytesWaiting(const serialPort_t *instance);
+uint32_t serialTxBytesFree(const serialPort_t *instance);
+void serialWriteBuf(serialPort_t *instance, const uint8_t *data, int count);
+uint8_t serialRead(serialPort_t *instance);
+void serialSetBaudRate(serialPort_t *instance, uint32_t baudRate);
+void serialSetMode(serialPort_t *instance, portMode_e mode);
+
+# 122 "./src/main/drivers/serial.h" 3 4
+_Bool 
+# 122 "./src/main/drivers/serial.h"
+    isSerialTransmitBufferEmpty(const serialPort_t *instance);
+void serialPrint(serialPort_t *instance, const char *str);
+uint32_t serialGetBaudRate(serialPort_t *instance);
+
+
+void serialWriteBufShim(void *instance, const uint8_t *data, int count);
+void serialBeginWrite(serialPort_t *instance);
+void serialEndWrite(serialPort_t *instance);
+# 30 "./src/main/telemetry/ibus_shared.h" 2
+
+
+
+
+typedef enum {
+    IBUS_SENSOR_TYPE_NONE = 0x00,
+    IBUS_SENSOR_TYPE_TEMPERATURE = 0x01,
+    IBUS_SENSOR_TYPE_RPM_FLYSKY = 0x02,
+    IBUS_SENSOR_TYPE_EXTERNAL_VOLTAGE = 0x03,
+    IBUS_SENSOR_TYPE_CELL = 0x04,
+    IBUS_SENSOR_TYPE_BAT_CURR = 0x05,
+    IBUS_SENSOR_TYPE_FUEL = 0x06,
+    IBUS_SENSOR_TYPE_RPM = 0x07,
+    IBUS_SENSOR_TYPE_CMP_HEAD = 0x08,
+    IBUS_SENSOR_TYPE_CLIMB_RATE = 0x09,
+    IBUS_SENSOR_TYPE_COG = 0x0a,
+    IBUS_SENSOR_TYPE_GPS_STATUS = 0x0b,
+    IBUS_SENSOR_TYPE_ACC_X = 0x0c,
+    IBUS_SENSOR_TYPE_ACC_Y = 0x0d,
+    IBUS_SENSOR_TYPE_ACC_Z = 0x0e,
+    IBUS_SENSOR_TYPE_ROLL = 0x0f,
+    IBUS_SENSOR_TYPE_PITCH = 0x10,
+    IBUS_SENSOR_TYPE_YAW = 0x11,
+    IBUS_SENSOR_TYPE_VERTICAL_SPEED = 0x12,
+    IBUS_SENSOR_TYPE_GROUND_SPEED = 0x13,
+    IBUS_SENSOR_TYPE_GPS_DIST = 0x14,
+    IBUS_SENSOR_TYPE_ARMED = 0x15,
+    IBUS_SENSOR_TYPE_FLIGHT_MODE = 0x16,
+    IBUS_SENSOR_TYPE_PRES = 0x41,
+    IBUS_SENSOR_TYPE_ODO1 = 0x7c,
+    IBUS_SENSOR_TYPE_ODO2 = 0x7d,
+    IBUS_SENSOR_TYPE_SPE = 0x7e,
+
+    IBUS_SENSOR_TYPE_GPS_LAT = 0x80,
+    IBUS_SENSOR_TYPE_GPS_LON = 0x81,
+    IBUS_SENSOR_TYPE_GPS_ALT = 0x82,
+    IBUS_SENSOR_TYPE_ALT = 0x83,
+    IBUS_SENSOR_TYPE_ALT_MAX = 0x84,
+
+    IBUS_SENSOR_TYPE_ALT_FLYSKY = 0xf9,
+
+    IBUS_SENSOR_TYPE_GPS_FULL = 0xfd,
+    IBUS_SENSOR_TYPE_VOLT_FULL = 0xf0,
+    IBUS_SENSOR_TYPE_ACC_FULL = 0xef,
+
+    IBUS_SENSOR_TYPE_UNKNOWN = 0xff
+} ibusSensorType_e;
+# 86 "./src/main/telemetry/ibus_shared.h"
+
+# 86 "./src/main/telemetry/ibus_shared.h" 3 4
+_Bool 
+# 86 "./src/main/telemetry/ibus_shared.h"
+    isChecksumOkIa6b(const uint8_t *ibusPacket, const uint8_t length);
+# 96 "./src/main/interface/settings.c" 2
+# 1 "./src/main/telemetry/telemetry.h" 1
+# 25 "./src/main/telemetry/telemetry.h"
+       
+
+
+# 1 "./src/main/io/serial.h" 1
+# 18 "./src/main/io/serial.h"
+       
+
+
+
+
+
+
+
+typedef enum {
+    PORTSHARING_UNUSED = 0,
+    PORTSHARING_NOT_SHARED,
+    PORTSHARING_SHARED
+} portSharing_e;
+
+typedef enum {
+    FUNCTION_NONE = 0,
+    FUNCTION_MSP = (1 << 0),
+    FUNCTION_GPS = (1 << 1),
+    FUNCTION_TELEMETRY_FRSKY_HUB = (1 << 2),
+    FUNCTION_TELEMETRY_HOTT = (1 << 3),
+    FUNCTION_TELEMETRY_LTM = (1 << 4),
+    FUNCTION_TELEMETRY_SMARTPORT = (1 << 5),
+    FUNCTION_RX_SERIAL = (1 << 6),
+    FUNCTION_BLACKBOX = (1 << 7),
+    FUNCTION_TELEMETRY_MAVLINK = (1 << 9),
+    FUNCTION_ESC_SENSOR = (1 << 10),
+    FUNCTION_VTX_SMARTAUDIO = (1 << 11),
+    FUNCTION_TELEMETRY_IBUS = (1 << 12),
+    FUNCTION_VTX_TRAMP = (1 << 13),
+    FUNCTION_RCDEVICE = (1 << 14),
+    FUNCTION_LIDAR_TF = (1 << 15),
+} serialPortFunction_e;
+
+typedef enum {
+    BAUD_AUTO = 0,
+    BAUD_9600,
+    BAUD_19200,
+    BAUD_38400,
+    BAUD_57600,
+    BAUD_115200,
+    BAUD_230400,
+    BAUD_250000,
+    BAUD_400000,
+    BAUD_460800,
+    BAUD_500000,
+    BAUD_921600,
+    BAUD_1000000,
+    BAUD_1500000,
+    BAUD_2000000,
+    BAUD_2470000
+} baudRate_e;
+
+extern const uint32_t baudRates[];
+
+
+typedef enum {
+    SERIAL_PORT_NONE = -1,
+    SERIAL_PORT_USART1 = 0,
+    SERIAL_PORT_USART2,
+    SERIAL_PORT_USART3,
+    SERIAL_PORT_UART4,
+    SERIAL_PORT_UART5,
+    SERIAL_PORT_USART6,
+    SERIAL_PORT_USART7,
+    SERIAL_PORT_USART8,
+    SERIAL_PORT_USB_VCP = 20,
+    SERIAL_PORT_SOFTSERIAL1 = 30,
+    SERIAL_PORT_SOFTSERIAL2
+} serialPortIdentifier_e;
+
+extern const serialPortIdentifier_e serialPortIdentifiers[8];
+# 97 "./src/main/io/serial.h"
+typedef struct serialPortUsage_s {
+    serialPort_t *serialPort;
+    serialPortFunction_e function;
+    serialPortIdentifier_e identifier;
+} serialPortUsage_t;
+
+serialPort_t *findSharedSerialPort(uint16_t functionMask, serialPortFunction_e sharedWithFunction);
+serialPort_t *findNextSharedSerialPort(uint16_t functionMask, serialPortFunction_e sharedWithFunction);
+
+
+
+
+typedef struct serialPortConfig_s {
+    uint16_t functionMask;
+    serialPortIdentifier_e identifier;
+    uint8_t msp_baudrateIndex;
+    uint8_t gps_baudrateIndex;
+    uint8_t blackbox_baudrateIndex;
+    uint8_t telemetry_baudrateIndex;
+} serialPortConfig_t;
+
+typedef struct serialConfig_s {
+    serialPortConfig_t portConfigs[8];
+    uint16_t serial_update_rate_hz;
+    uint8_t reboot_character;
+} serialConfig_t;
+
+extern serialConfig_t serialConfig_System; extern serialConfig_t serialConfig_Copy; static inline const serialConfig_t* serialConfig(void) { return &serialConfig_System; } static inline serialConfig_t* serialConfigMutable(void) { return &serialConfig_System; } struct _dummy;
+
+typedef void serialConsumer(uint8_t);
+
+
+
+
+void serialInit(
+# 131 "./src/main/io/serial.h" 3 4
+               _Bool 
+# 131 "./src/main/io/serial.h"
+                    softserialEnabled, serialPortIdentifier_e serialPortToDisable);
+void serialRemovePort(serialPortIdentifier_e identifier);
+uint8_t serialGetAvailablePortCount(void);
+
+# 134 "./src/main/io/serial.h" 3 4
+_Bool 
+# 134 "./src/main/io/serial.h"
+    serialIsPortAvailable(serialPortIdentifier_e identifier);
+
+# 135 "./src/main/io/serial.h" 3 4
+_Bool 
+# 135 "./src/main/io/serial.h"
+    isSerialConfigValid(const serialConfig_t *serialConfig);
+serialPortConfig_t *serialFindPortConfiguration(serialPortIdentifier_e identifier);
+
+# 137 "./src/main/io/serial.h" 3 4
+_Bool 
+# 137 "./src/main/io/serial.h"
+    doesConfigurationUsePort(serialPortIdentifier_e portIdentifier);
+serialPortConfig_t *findSerialPortConfig(serialPortFunction_e function);
+serialPortConfig_t *findNextSerialPortConfig(serialPortFunction_e function);
+
+portSharing_e determinePortSharing(const serialPortConfig_t *portConfig, serialPortFunction_e function);
+
+# 142 "./src/main/io/serial.h" 3 4
+_Bool 
+# 142 "./src/main/io/serial.h"
+    isSerialPortShared(const serialPortConfig_t *portConfig, uint16_t functionMask, serialPortFunction_e sharedWithFunction);
+
+void pgResetFn_serialConfig(serialConfig_t *serialConfig);
+serialPortUsage_t *findSerialPortUsageByIdentifier(serialPortIdentifier_e identifier);
+int findSerialPortIndexByIdentifier(serialPortIdentifier_e identifier);
+
+
+
+serialPort_t *openSerialPort(
+    serialPortIdentifier_e identifier,
+    serialPortFunction_e function,
+    serialReceiveCallbackPtr rxCallback,
+    void *rxCallbackData,
+    uint32_t baudrate,
+    portMode_e mode,
+    portOptions_e options
+);
+void closeSerialPort(serialPort_t *serialPort);
+
+void waitForSerialPortToFinishTransmitting(serialPort_t *serialPort);
+
+baudRate_e lookupBaudRateIndex(uint32_t baudRate);
+
+
+
+
+
+void serialPassthrough(serialPort_t *left, serialPort_t *right, serialConsumer *leftC, serialConsumer *rightC);
+# 29 "./src/main/telemetry/telemetry.h" 2
+
+
+typedef enum {
+    FRSKY_FORMAT_DMS = 0,
+    FRSKY_FORMAT_NMEA
+} frskyGpsCoordFormat_e;
+
+typedef enum {
+    FRSKY_UNIT_METRICS = 0,
+    FRSKY_UNIT_IMPERIALS
+} frskyUnit_e;
+
+typedef struct telemetryConfig_s {
+    int16_t gpsNoFixLatitude;
+    int16_t gpsNoFixLongitude;
+    uint8_t telemetry_switch;
+    uint8_t telemetry_inverted;
+    uint8_t halfDuplex;
+    frskyGpsCoordFormat_e frsky_coordinate_format;
+    frskyUnit_e frsky_unit;
+    uint8_t frsky_vfas_precision;
+    uint8_t hottAlarmSoundInterval;
+    uint8_t pidValuesAsTelemetry;
+    uint8_t report_cell_voltage;
+    uint8_t flysky_sensors[15];
+    uint8_t mavlink_attitude_hz;
+    uint8_t mavlink_position_hz;
+    uint8_t mavlink_odometry_hz;
+} telemetryConfig_t;
+
+extern telemetryConfig_t telemetryConfig_System; extern telemetryConfig_t telemetryConfig_Copy; static inline const telemetryConfig_t* telemetryConfig(void) { return &telemetryConfig_System; } static inline telemetryConfig_t* telemetryConfigMutable(void) { return &telemetryConfig_System; } struct _dummy;
+
+
+
+
+extern serialPort_t *telemetrySharedPort;
+
+void telemetryInit(void);
+
+# 67 "./src/main/telemetry/telemetry.h" 3 4
+_Bool 
+# 67 "./src/main/telemetry/telemetry.h"
+    telemetryCheckRxPortShared(const serialPortConfig_t *portConfig);
+
+void telemetryCheckState(void);
+void telemetryProcess(uint32_t currentTime);
+
+
+# 72 "./src/main/telemetry/telemetry.h" 3 4
+_Bool 
+# 72 "./src/main/telemetry/telemetry.h"
+    telemetryDetermineEnabledState(portSharing_e portSharing);
+
+void releaseSharedTelemetryPorts(void);
+# 97 "./src/main/interface/settings.c" 2
+
+
+
+const char * const lookupTableAccHardware[] = {
+    "AUTO", "NONE", "ADXL345", "MPU6050", "MMA8452", "BMA280", "LSM303DLHC",
+    "MPU6000", "MPU6500", "MPU9250", "ICM20601", "ICM20602", "ICM20608G", "ICM20649", "ICM20689",
+    "BMI160", "FAKE"
+};
+
+
+const char * const lookupTableGyroHardware[] = {
+    "AUTO", "NONE", "MPU6050", "L3G4200D", "MPU3050", "L3GD20",
+    "MPU6000", "MPU6500", "MPU9250", "ICM20601", "ICM20602", "ICM20608G", "ICM20649", "ICM20689",
+    "BMI160", "FAKE"
+};
+
+
+
+const char * const lookupTableBaroHardware[] = {
+    "AUTO", "NONE", "BMP085", "MS5611", "BMP280", "LPS"
+};
+
+
+
+const char * const lookupTableMagHardware[] = {
+    "AUTO", "NONE", "HMC5883", "AK8975", "AK8963"
+};
+
+
+const char * const lookupTableRangefinderHardware[] = {
+    "NONE", "HCSR04", "TFMINI", "TF02", "SRF10", "HCSR04I2C", "VL53L0X", "UIB", "FAKE"
+};
+
+
+static const char * const lookupTableOffOn[] = {
+    "OFF", "ON"
+};
+
+static const char * const lookupTableCrashRecovery[] = {
+    "OFF", "ON" ,"BEEP"
+};
+
+static const char * const lookupTableUnit[] = {
+    "IMPERIAL", "METRIC"
+};
+
+static const char * const lookupTableAlignment[] = {
+    "DEFAULT",
+    "CW0",
+    "CW90",
+    "CW180",
+    "CW270",
+    "CW0FLIP",
+    "CW90FLIP",
+    "CW180FLIP",
+    "CW270FLIP"
+};
+
+
+static const char * const lookupTableGPSProvider[] = {
+    "NMEA", "UBLOX"
+};
+
+static const char * const lookupTableGPSSBASMode[] = {
+    "AUTO", "EGNOS", "WAAS", "MSAS", "GAGAN"
+};
+
+
+
+static const char * const lookupTableGimbalMode[] = {
+    "NORMAL", "MIXTILT"
+};
+
+
+
+static const char * const lookupTableBlackboxDevice[] = {
+    "NONE", "SPIFLASH", "SDCARD", "SERIAL"
+};
+
+static const char * const lookupTableBlackboxMode[] = {
+    "NORMAL", "MOTOR_TEST", "ALWAYS"
+};
+# 218 "./src/main/interface/settings.c"
+static const char * const lookupTableGyroLpf[] = {
+    "OFF",
+    "188HZ",
+    "98HZ",
+    "42HZ",
+    "20HZ",
+    "10HZ",
+    "5HZ",
+    "EXPERIMENTAL"
+};
+# 237 "./src/main/interface/settings.c"
+static const char * const lookupTablePwmProtocol[] = {
+    "OFF", "ONESHOT125", "ONESHOT42", "MULTISHOT", "BRUSHED",
+
+
+
+};
+
+static const char * const lookupTableRcInterpolation[] = {
+    "OFF", "PRESET", "AUTO", "MANUAL"
+};
+
+static const char * const lookupTableRcInterpolationChannels[] = {
+    "RP", "RPY", "RPYT"
+};
+
+static const char * const lookupTableLowpassType[] = {
+    "PT1", "BIQUAD", "FIR"
+};
+
+static const char * const lookupTableFailsafe[] = {
+    "AUTO-LAND", "DROP"
+};
+
+static const char * const lookupTableBusType[] = {
+    "NONE", "I2C", "SPI", "SLAVE"
+};
+# 271 "./src/main/interface/settings.c"
+static const char * const lookupTableGyroOverflowCheck[] = {
+    "OFF", "YAW", "ALL"
+};
+# 282 "./src/main/interface/settings.c"
+static const char * const lookupTableRatesType[] = {
+    "BETAFLIGHT", "RACEFLIGHT"
+};
+# 297 "./src/main/interface/settings.c"
+static const char * const lookupTableSchedulerMode[] = {
+    "QUEUE", "HEAP"
+};
+
+const lookupTableEntry_t lookupTables[] = {
+    { lookupTableOffOn, sizeof(lookupTableOffOn) / sizeof(char *) },
+    { lookupTableUnit, sizeof(lookupTableUnit) / sizeof(char *) },
+    { lookupTableAlignment, sizeof(lookupTableAlignment) / sizeof(char *) },
+
+    { lookupTableGPSProvider, sizeof(lookupTableGPSProvider) / sizeof(char *) },
+    { lookupTableGPSSBASMode, sizeof(lookupTableGPSSBASMode) / sizeof(char *) },
+
+
+    { lookupTableBlackboxDevice, sizeof(lookupTableBlackboxDevice) / sizeof(char *) },
+    { lookupTableBlackboxMode, sizeof(lookupTableBlackboxMode) / sizeof(char *) },
+
+    { currentMeterSourceNames, sizeof(currentMeterSourceNames) / sizeof(char *) },
+    { voltageMeterSourceNames, sizeof(voltageMeterSourceNames) / sizeof(char *) },
+
+    { lookupTableGimbalMode, sizeof(lookupTableGimbalMode) / sizeof(char *) },
+
+
+
+
+
+
+
+    { lookupTableGyroLpf, sizeof(lookupTableGyroLpf) / sizeof(char *) },
+    { lookupTableAccHardware, sizeof(lookupTableAccHardware) / sizeof(char *) },
+
+    { lookupTableBaroHardware, sizeof(lookupTableBaroHardware) / sizeof(char *) },
+
+
+    { lookupTableMagHardware, sizeof(lookupTableMagHardware) / sizeof(char *) },
+
+    { debugModeNames, sizeof(debugModeNames) / sizeof(char *) },
+    { lookupTablePwmProtocol, sizeof(lookupTablePwmProtocol) / sizeof(char *) },
+    { lookupTableRcInterpolation, sizeof(lookupTableRcInterpolation) / sizeof(char *) },
+    { lookupTableRcInterpolationChannels, sizeof(lookupTableRcInterpolationChannels) / sizeof(char *) },
+    { lookupTableLowpassType, sizeof(lookupTableLowpassType) / sizeof(char *) },
+    { lookupTableFailsafe, sizeof(lookupTableFailsafe) / sizeof(char *) },
+    { lookupTableCrashRecovery, sizeof(lookupTableCrashRecovery) / sizeof(char *) },
+
+
+
+    { lookupTableBusType, sizeof(lookupTableBusType) / sizeof(char *) },
+
+
+
+
+    { lookupTableRangefinderHardware, sizeof(lookupTableRangefinderHardware) / sizeof(char *) },
+
+
+    { lookupTableGyroOverflowCheck, sizeof(lookupTableGyroOverflowCheck) / sizeof(char *) },
+
+
+
+
+    { lookupTableRatesType, sizeof(lookupTableRatesType) / sizeof(char *) },
+
+
+
+    { lookupTableSchedulerMode, sizeof(lookupTableSchedulerMode) / sizeof(char *) },
+};
+
+const clivalue_t valueTable[] = {
+
+    { "align_gyro", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_ALIGNMENT }, 10, 
+# 364 "./src/main/interface/settings.c" 3 4
+                                                                                                                                  __builtin_offsetof (
+# 364 "./src/main/interface/settings.c"
+                                                                                                                                  gyroConfig_t
+# 364 "./src/main/interface/settings.c" 3 4
+                                                                                                                                  , 
+# 364 "./src/main/interface/settings.c"
+                                                                                                                                  gyro_align
+# 364 "./src/main/interface/settings.c" 3 4
+                                                                                                                                  ) 
+# 364 "./src/main/interface/settings.c"
+                                                                                                                                                                     },
+    { "gyro_lpf", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_GYRO_LPF }, 10, 
+# 365 "./src/main/interface/settings.c" 3 4
+                                                                                                                                 __builtin_offsetof (
+# 365 "./src/main/interface/settings.c"
+                                                                                                                                 gyroConfig_t
+# 365 "./src/main/interface/settings.c" 3 4
+                                                                                                                                 , 
+# 365 "./src/main/interface/settings.c"
+                                                                                                                                 gyro_lpf
+# 365 "./src/main/interface/settings.c" 3 4
+                                                                                                                                 ) 
+# 365 "./src/main/interface/settings.c"
+                                                                                                                                                                  },
+
+
+
+    { "gyro_sync_denom", VAR_UINT8 | MASTER_VALUE, .config.minmax = { 1, 32 }, 10, 
+# 369 "./src/main/interface/settings.c" 3 4
+                                                                                                          __builtin_offsetof (
+# 369 "./src/main/interface/settings.c"
+                                                                                                          gyroConfig_t
+# 369 "./src/main/interface/settings.c" 3 4
+                                                                                                          , 
+# 369 "./src/main/interface/settings.c"
+                                                                                                          gyro_sync_denom
+# 369 "./src/main/interface/settings.c" 3 4
+                                                                                                          ) 
+# 369 "./src/main/interface/settings.c"
+                                                                                                                                                  },
+    { "gyro_lowpass_type", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_LOWPASS_TYPE }, 10, 
+# 370 "./src/main/interface/settings.c" 3 4
+                                                                                                                                     __builtin_offsetof (
+# 370 "./src/main/interface/settings.c"
+                                                                                                                                     gyroConfig_t
+# 370 "./src/main/interface/settings.c" 3 4
+                                                                                                                                     , 
+# 370 "./src/main/interface/settings.c"
+                                                                                                                                     gyro_soft_lpf_type
+# 370 "./src/main/interface/settings.c" 3 4
+                                                                                                                                     ) 
+# 370 "./src/main/interface/settings.c"
+                                                                                                                                                                                },
+    { "gyro_lowpass_hz", VAR_UINT8 | MASTER_VALUE, .config.minmax = { 0, 255 }, 10, 
+# 371 "./src/main/interface/settings.c" 3 4
+                                                                                                            __builtin_offsetof (
+# 371 "./src/main/interface/settings.c"
+                                                                                                            gyroConfig_t
+# 371 "./src/main/interface/settings.c" 3 4
+                                                                                                            , 
+# 371 "./src/main/interface/settings.c"
+                                                                                                            gyro_soft_lpf_hz
+# 371 "./src/main/interface/settings.c" 3 4
+                                                                                                            ) 
+# 371 "./src/main/interface/settings.c"
+                                                                                                                                                     },
+    { "gyro_notch1_hz", VAR_UINT16 | MASTER_VALUE, .config.minmax = { 0, 16000 }, 10, 
+# 372 "./src/main/interface/settings.c" 3 4
+                                                                                                             __builtin_offsetof (
+# 372 "./src/main/interface/settings.c"
+                                                                                                             gyroConfig_t
+# 372 "./src/main/interface/settings.c" 3 4
+                                                                                                             , 
+# 372 "./src/main/interface/settings.c"
+                                                                                                             gyro_soft_notch_hz_1
+# 372 "./src/main/interface/settings.c" 3 4
+                                                                                                             ) 
+# 372 "./src/main/interface/settings.c"
+                                                                                                                                                          },
+    { "gyro_notch1_cutoff", VAR_UINT16 | MASTER_VALUE, .config.minmax = { 0, 16000 }, 10, 
+# 373 "./src/main/interface/settings.c" 3 4
+                                                                                                             __builtin_offsetof (
+# 373 "./src/main/interface/settings.c"
+                                                                                                             gyroConfig_t
+# 373 "./src/main/interface/settings.c" 3 4
+                                                                                                             , 
+# 373 "./src/main/interface/settings.c"
+                                                                                                             gyro_soft_notch_cutoff_1
+# 373 "./src/main/interface/settings.c" 3 4
+                                                                                                             ) 
+# 373 "./src/main/interface/settings.c"
+                                                                                                                                                              },
+    { "gyro_notch2_hz", VAR_UINT16 | MASTER_VALUE, .config.minmax = { 0, 16000 }, 10, 
+# 374 "./src/main/interface/settings.c" 3 4
+                                                                                                             __builtin_offsetof (
+# 374 "./src/main/interface/settings.c"
+                                                                                                             gyroConfig_t
+# 374 "./src/main/interface/settings.c" 3 4
+                                                                                                             , 
+# 374 "./src/main/interface/settings.c"
+                                                                                                             gyro_soft_notch_hz_2
+# 374 "./src/main/interface/settings.c" 3 4
+                                                                                                             ) 
+# 374 "./src/main/interface/settings.c"
+                                                                                                                                                          },
+    { "gyro_notch2_cutoff", VAR_UINT16 | MASTER_VALUE, .config.minmax = { 0, 16000 }, 10, 
+# 375 "./src/main/interface/settings.c" 3 4
+                                                                                                             __builtin_offsetof (
+# 375 "./src/main/interface/settings.c"
+                                                                                                             gyroConfig_t
+# 375 "./src/main/interface/settings.c" 3 4
+                                                                                                             , 
+# 375 "./src/main/interface/settings.c"
+                                                                                                             gyro_soft_notch_cutoff_2
+# 375 "./src/main/interface/settings.c" 3 4
+                                                                                                             ) 
+# 375 "./src/main/interface/settings.c"
+                                                                                                                                                              },
+
+
+
+
+
+    { "gyro_stage2_lowpass_hz", VAR_UINT16 | MASTER_VALUE, .config.minmax = { 0, 16000 }, 10, 
+# 381 "./src/main/interface/settings.c" 3 4
+                                                                                                             __builtin_offsetof (
+# 381 "./src/main/interface/settings.c"
+                                                                                                             gyroConfig_t
+# 381 "./src/main/interface/settings.c" 3 4
+                                                                                                             , 
+# 381 "./src/main/interface/settings.c"
+                                                                                                             gyro_soft_lpf_hz_2
+# 381 "./src/main/interface/settings.c" 3 4
+                                                                                                             ) 
+# 381 "./src/main/interface/settings.c"
+                                                                                                                                                        },
+
+    { "moron_threshold", VAR_UINT8 | MASTER_VALUE, .config.minmax = { 0, 200 }, 10, 
+# 383 "./src/main/interface/settings.c" 3 4
+                                                                                                            __builtin_offsetof (
+# 383 "./src/main/interface/settings.c"
+                                                                                                            gyroConfig_t
+# 383 "./src/main/interface/settings.c" 3 4
+                                                                                                            , 
+# 383 "./src/main/interface/settings.c"
+                                                                                                            gyroMovementCalibrationThreshold
+# 383 "./src/main/interface/settings.c" 3 4
+                                                                                                            ) 
+# 383 "./src/main/interface/settings.c"
+                                                                                                                                                                     },
+    { "gyro_offset_yaw", VAR_INT16 | MASTER_VALUE, .config.minmax = { -1000, 1000 }, 10, 
+# 384 "./src/main/interface/settings.c" 3 4
+                                                                                                               __builtin_offsetof (
+# 384 "./src/main/interface/settings.c"
+                                                                                                               gyroConfig_t
+# 384 "./src/main/interface/settings.c" 3 4
+                                                                                                               , 
+# 384 "./src/main/interface/settings.c"
+                                                                                                               gyro_offset_yaw
+# 384 "./src/main/interface/settings.c" 3 4
+                                                                                                               ) 
+# 384 "./src/main/interface/settings.c"
+                                                                                                                                                       },
+
+    { "gyro_overflow_detect", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_GYRO_OVERFLOW_CHECK }, 10, 
+# 386 "./src/main/interface/settings.c" 3 4
+                                                                                                                                            __builtin_offsetof (
+# 386 "./src/main/interface/settings.c"
+                                                                                                                                            gyroConfig_t
+# 386 "./src/main/interface/settings.c" 3 4
+                                                                                                                                            , 
+# 386 "./src/main/interface/settings.c"
+                                                                                                                                            checkOverflow
+# 386 "./src/main/interface/settings.c" 3 4
+                                                                                                                                            ) 
+# 386 "./src/main/interface/settings.c"
+                                                                                                                                                                                  },
+# 413 "./src/main/interface/settings.c"
+    { "align_acc", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_ALIGNMENT }, 35, 
+# 413 "./src/main/interface/settings.c" 3 4
+                                                                                                                                           __builtin_offsetof (
+# 413 "./src/main/interface/settings.c"
+                                                                                                                                           accelerometerConfig_t
+# 413 "./src/main/interface/settings.c" 3 4
+                                                                                                                                           , 
+# 413 "./src/main/interface/settings.c"
+                                                                                                                                           acc_align
+# 413 "./src/main/interface/settings.c" 3 4
+                                                                                                                                           ) 
+# 413 "./src/main/interface/settings.c"
+                                                                                                                                                                                      },
+    { "acc_hardware", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_ACC_HARDWARE }, 35, 
+# 414 "./src/main/interface/settings.c" 3 4
+                                                                                                                                              __builtin_offsetof (
+# 414 "./src/main/interface/settings.c"
+                                                                                                                                              accelerometerConfig_t
+# 414 "./src/main/interface/settings.c" 3 4
+                                                                                                                                              , 
+# 414 "./src/main/interface/settings.c"
+                                                                                                                                              acc_hardware
+# 414 "./src/main/interface/settings.c" 3 4
+                                                                                                                                              ) 
+# 414 "./src/main/interface/settings.c"
+                                                                                                                                                                                            },
+
+
+
+    { "acc_lpf_hz", VAR_UINT16 | MASTER_VALUE, .config.minmax = { 0, 400 }, 35, 
+# 418 "./src/main/interface/settings.c" 3 4
+                                                                                                                    __builtin_offsetof (
+# 418 "./src/main/interface/settings.c"
+                                                                                                                    accelerometerConfig_t
+# 418 "./src/main/interface/settings.c" 3 4
+                                                                                                                    , 
+# 418 "./src/main/interface/settings.c"
+                                                                                                                    acc_lpf_hz
+# 418 "./src/main/interface/settings.c" 3 4
+                                                                                                                    ) 
+# 418 "./src/main/interface/settings.c"
+                                                                                                                                                                },
+    { "acc_trim_pitch", VAR_INT16 | MASTER_VALUE, .config.minmax = { -300, 300 }, 35, 
+# 419 "./src/main/interface/settings.c" 3 4
+                                                                                                                       __builtin_offsetof (
+# 419 "./src/main/interface/settings.c"
+                                                                                                                       accelerometerConfig_t
+# 419 "./src/main/interface/settings.c" 3 4
+                                                                                                                       , 
+# 419 "./src/main/interface/settings.c"
+                                                                                                                       accelerometerTrims.values.pitch
+# 419 "./src/main/interface/settings.c" 3 4
+                                                                                                                       ) 
+# 419 "./src/main/interface/settings.c"
+                                                                                                                                                                                        },
+    { "acc_trim_roll", VAR_INT16 | MASTER_VALUE, .config.minmax = { -300, 300 }, 35, 
+# 420 "./src/main/interface/settings.c" 3 4
+                                                                                                                       __builtin_offsetof (
+# 420 "./src/main/interface/settings.c"
+                                                                                                                       accelerometerConfig_t
+# 420 "./src/main/interface/settings.c" 3 4
+                                                                                                                       , 
+# 420 "./src/main/interface/settings.c"
+                                                                                                                       accelerometerTrims.values.roll
+# 420 "./src/main/interface/settings.c" 3 4
+                                                                                                                       ) 
+# 420 "./src/main/interface/settings.c"
+                                                                                                                                                                                       },
+
+
+
+    { "align_mag", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_ALIGNMENT }, 40, 
+# 424 "./src/main/interface/settings.c" 3 4
+                                                                                                                                     __builtin_offsetof (
+# 424 "./src/main/interface/settings.c"
+                                                                                                                                     compassConfig_t
+# 424 "./src/main/interface/settings.c" 3 4
+                                                                                                                                     , 
+# 424 "./src/main/interface/settings.c"
+                                                                                                                                     mag_align
+# 424 "./src/main/interface/settings.c" 3 4
+                                                                                                                                     ) 
+# 424 "./src/main/interface/settings.c"
+                                                                                                                                                                          },
+    { "mag_bustype", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_BUS_TYPE }, 40, 
+# 425 "./src/main/interface/settings.c" 3 4
+                                                                                                                                    __builtin_offsetof (
+# 425 "./src/main/interface/settings.c"
+                                                                                                                                    compassConfig_t
+# 425 "./src/main/interface/settings.c" 3 4
+                                                                                                                                    , 
+# 425 "./src/main/interface/settings.c"
+                                                                                                                                    mag_bustype
+# 425 "./src/main/interface/settings.c" 3 4
+                                                                                                                                    ) 
+# 425 "./src/main/interface/settings.c"
+                                                                                                                                                                           },
+    { "mag_i2c_device", VAR_UINT8 | MASTER_VALUE, .config.minmax = { 0, 4 }, 40, 
+# 426 "./src/main/interface/settings.c" 3 4
+                                                                                                                       __builtin_offsetof (
+# 426 "./src/main/interface/settings.c"
+                                                                                                                       compassConfig_t
+# 426 "./src/main/interface/settings.c" 3 4
+                                                                                                                       , 
+# 426 "./src/main/interface/settings.c"
+                                                                                                                       mag_i2c_device
+# 426 "./src/main/interface/settings.c" 3 4
+                                                                                                                       ) 
+# 426 "./src/main/interface/settings.c"
+                                                                                                                                                                 },
+    { "mag_i2c_address", VAR_UINT8 | MASTER_VALUE, .config.minmax = { 0, 119 }, 40, 
+# 427 "./src/main/interface/settings.c" 3 4
+                                                                                                                        __builtin_offsetof (
+# 427 "./src/main/interface/settings.c"
+                                                                                                                        compassConfig_t
+# 427 "./src/main/interface/settings.c" 3 4
+                                                                                                                        , 
+# 427 "./src/main/interface/settings.c"
+                                                                                                                        mag_i2c_address
+# 427 "./src/main/interface/settings.c" 3 4
+                                                                                                                        ) 
+# 427 "./src/main/interface/settings.c"
+                                                                                                                                                                   },
+    { "mag_spi_device", VAR_UINT8 | MASTER_VALUE, .config.minmax = { 0, 4 }, 40, 
+# 428 "./src/main/interface/settings.c" 3 4
+                                                                                                                       __builtin_offsetof (
+# 428 "./src/main/interface/settings.c"
+                                                                                                                       compassConfig_t
+# 428 "./src/main/interface/settings.c" 3 4
+                                                                                                                       , 
+# 428 "./src/main/interface/settings.c"
+                                                                                                                       mag_spi_device
+# 428 "./src/main/interface/settings.c" 3 4
+                                                                                                                       ) 
+# 428 "./src/main/interface/settings.c"
+                                                                                                                                                                 },
+    { "mag_hardware", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_MAG_HARDWARE }, 40, 
+# 429 "./src/main/interface/settings.c" 3 4
+                                                                                                                                        __builtin_offsetof (
+# 429 "./src/main/interface/settings.c"
+                                                                                                                                        compassConfig_t
+# 429 "./src/main/interface/settings.c" 3 4
+                                                                                                                                        , 
+# 429 "./src/main/interface/settings.c"
+                                                                                                                                        mag_hardware
+# 429 "./src/main/interface/settings.c" 3 4
+                                                                                                                                        ) 
+# 429 "./src/main/interface/settings.c"
+                                                                                                                                                                                },
+    { "mag_declination", VAR_INT16 | MASTER_VALUE, .config.minmax = { -18000, 18000 }, 40, 
+# 430 "./src/main/interface/settings.c" 3 4
+                                                                                                                     __builtin_offsetof (
+# 430 "./src/main/interface/settings.c"
+                                                                                                                     compassConfig_t
+# 430 "./src/main/interface/settings.c" 3 4
+                                                                                                                     , 
+# 430 "./src/main/interface/settings.c"
+                                                                                                                     mag_declination
+# 430 "./src/main/interface/settings.c" 3 4
+                                                                                                                     ) 
+# 430 "./src/main/interface/settings.c"
+                                                                                                                                                                },
+    { "magzero_x", VAR_INT16 | MASTER_VALUE, .config.minmax = { 
+# 431 "./src/main/interface/settings.c" 3 4
+                                                                                 (-32767-1)
+# 431 "./src/main/interface/settings.c"
+                                                                                          , 
+# 431 "./src/main/interface/settings.c" 3 4
+                                                                                            (32767) 
+# 431 "./src/main/interface/settings.c"
+                                                                                                      }, 40, 
+# 431 "./src/main/interface/settings.c" 3 4
+                                                                                                                            __builtin_offsetof (
+# 431 "./src/main/interface/settings.c"
+                                                                                                                            compassConfig_t
+# 431 "./src/main/interface/settings.c" 3 4
+                                                                                                                            , 
+# 431 "./src/main/interface/settings.c"
+                                                                                                                            magZero.raw[X]
+# 431 "./src/main/interface/settings.c" 3 4
+                                                                                                                            ) 
+# 431 "./src/main/interface/settings.c"
+                                                                                                                                                                      },
+    { "magzero_y", VAR_INT16 | MASTER_VALUE, .config.minmax = { 
+# 432 "./src/main/interface/settings.c" 3 4
+                                                                                 (-32767-1)
+# 432 "./src/main/interface/settings.c"
+                                                                                          , 
+# 432 "./src/main/interface/settings.c" 3 4
+                                                                                            (32767) 
+# 432 "./src/main/interface/settings.c"
+                                                                                                      }, 40, 
+# 432 "./src/main/interface/settings.c" 3 4
+                                                                                                                            __builtin_offsetof (
+# 432 "./src/main/interface/settings.c"
+                                                                                                                            compassConfig_t
+# 432 "./src/main/interface/settings.c" 3 4
+                                                                                                                            , 
+# 432 "./src/main/interface/settings.c"
+                                                                                                                            magZero.raw[Y]
+# 432 "./src/main/interface/settings.c" 3 4
+                                                                                                                            ) 
+# 432 "./src/main/interface/settings.c"
+                                                                                                                                                                      },
+    { "magzero_z", VAR_INT16 | MASTER_VALUE, .config.minmax = { 
+# 433 "./src/main/interface/settings.c" 3 4
+                                                                                 (-32767-1)
+# 433 "./src/main/interface/settings.c"
+                                                                                          , 
+# 433 "./src/main/interface/settings.c" 3 4
+                                                                                            (32767) 
+# 433 "./src/main/interface/settings.c"
+                                                                                                      }, 40, 
+# 433 "./src/main/interface/settings.c" 3 4
+                                                                                                                            __builtin_offsetof (
+# 433 "./src/main/interface/settings.c"
+                                                                                                                            compassConfig_t
+# 433 "./src/main/interface/settings.c" 3 4
+                                                                                                                            , 
+# 433 "./src/main/interface/settings.c"
+                                                                                                                            magZero.raw[Z]
+# 433 "./src/main/interface/settings.c" 3 4
+                                                                                                                            ) 
+# 433 "./src/main/interface/settings.c"
+                                                                                                                                                                      },
+
+
+
+
+    { "baro_bustype", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_BUS_TYPE }, 38, 
+# 438 "./src/main/interface/settings.c" 3 4
+                                                                                                                                      __builtin_offsetof (
+# 438 "./src/main/interface/settings.c"
+                                                                                                                                      barometerConfig_t
+# 438 "./src/main/interface/settings.c" 3 4
+                                                                                                                                      , 
+# 438 "./src/main/interface/settings.c"
+                                                                                                                                      baro_bustype
+# 438 "./src/main/interface/settings.c" 3 4
+                                                                                                                                      ) 
+# 438 "./src/main/interface/settings.c"
+                                                                                                                                                                                },
+    { "baro_spi_device", VAR_UINT8 | MASTER_VALUE, .config.minmax = { 0, 5 }, 38, 
+# 439 "./src/main/interface/settings.c" 3 4
+                                                                                                              __builtin_offsetof (
+# 439 "./src/main/interface/settings.c"
+                                                                                                              barometerConfig_t
+# 439 "./src/main/interface/settings.c" 3 4
+                                                                                                              , 
+# 439 "./src/main/interface/settings.c"
+                                                                                                              baro_spi_device
+# 439 "./src/main/interface/settings.c" 3 4
+                                                                                                              ) 
+# 439 "./src/main/interface/settings.c"
+                                                                                                                                                           },
+    { "baro_i2c_device", VAR_UINT8 | MASTER_VALUE, .config.minmax = { 0, 5 }, 38, 
+# 440 "./src/main/interface/settings.c" 3 4
+                                                                                                              __builtin_offsetof (
+# 440 "./src/main/interface/settings.c"
+                                                                                                              barometerConfig_t
+# 440 "./src/main/interface/settings.c" 3 4
+                                                                                                              , 
+# 440 "./src/main/interface/settings.c"
+                                                                                                              baro_i2c_device
+# 440 "./src/main/interface/settings.c" 3 4
+                                                                                                              ) 
+# 440 "./src/main/interface/settings.c"
+                                                                                                                                                           },
+    { "baro_i2c_address", VAR_UINT8 | MASTER_VALUE, .config.minmax = { 0, 119 }, 38, 
+# 441 "./src/main/interface/settings.c" 3 4
+                                                                                                                          __builtin_offsetof (
+# 441 "./src/main/interface/settings.c"
+                                                                                                                          barometerConfig_t
+# 441 "./src/main/interface/settings.c" 3 4
+                                                                                                                          , 
+# 441 "./src/main/interface/settings.c"
+                                                                                                                          baro_i2c_address
+# 441 "./src/main/interface/settings.c" 3 4
+                                                                                                                          ) 
+# 441 "./src/main/interface/settings.c"
+                                                                                                                                                                        },
+    { "baro_hardware", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_BARO_HARDWARE }, 38, 
+# 442 "./src/main/interface/settings.c" 3 4
+                                                                                                                                           __builtin_offsetof (
+# 442 "./src/main/interface/settings.c"
+                                                                                                                                           barometerConfig_t
+# 442 "./src/main/interface/settings.c" 3 4
+                                                                                                                                           , 
+# 442 "./src/main/interface/settings.c"
+                                                                                                                                           baro_hardware
+# 442 "./src/main/interface/settings.c" 3 4
+                                                                                                                                           ) 
+# 442 "./src/main/interface/settings.c"
+                                                                                                                                                                                      },
+    { "baro_tab_size", VAR_UINT8 | MASTER_VALUE, .config.minmax = { 0, 48 }, 38, 
+# 443 "./src/main/interface/settings.c" 3 4
+                                                                                                                                  __builtin_offsetof (
+# 443 "./src/main/interface/settings.c"
+                                                                                                                                  barometerConfig_t
+# 443 "./src/main/interface/settings.c" 3 4
+                                                                                                                                  , 
+# 443 "./src/main/interface/settings.c"
+                                                                                                                                  baro_sample_count
+# 443 "./src/main/interface/settings.c" 3 4
+                                                                                                                                  ) 
+# 443 "./src/main/interface/settings.c"
+                                                                                                                                                                                 },
+    { "baro_noise_lpf", VAR_UINT16 | MASTER_VALUE, .config.minmax = { 0, 1000 }, 38, 
+# 444 "./src/main/interface/settings.c" 3 4
+                                                                                                                  __builtin_offsetof (
+# 444 "./src/main/interface/settings.c"
+                                                                                                                  barometerConfig_t
+# 444 "./src/main/interface/settings.c" 3 4
+                                                                                                                  , 
+# 444 "./src/main/interface/settings.c"
+                                                                                                                  baro_noise_lpf
+# 444 "./src/main/interface/settings.c" 3 4
+                                                                                                                  ) 
+# 444 "./src/main/interface/settings.c"
+                                                                                                                                                              },
+    { "baro_cf_vel", VAR_UINT16 | MASTER_VALUE, .config.minmax = { 0, 1000 }, 38, 
+# 445 "./src/main/interface/settings.c" 3 4
+                                                                                                                  __builtin_offsetof (
+# 445 "./src/main/interface/settings.c"
+                                                                                                                  barometerConfig_t
+# 445 "./src/main/interface/settings.c" 3 4
+                                                                                                                  , 
+# 445 "./src/main/interface/settings.c"
+                                                                                                                  baro_cf_vel
+# 445 "./src/main/interface/settings.c" 3 4
+                                                                                                                  ) 
+# 445 "./src/main/interface/settings.c"
+                                                                                                                                                           },
+    { "baro_cf_alt", VAR_UINT16 | MASTER_VALUE, .config.minmax = { 0, 1000 }, 38, 
+# 446 "./src/main/interface/settings.c" 3 4
+                                                                                                                  __builtin_offsetof (
+# 446 "./src/main/interface/settings.c"
+                                                                                                                  barometerConfig_t
+# 446 "./src/main/interface/settings.c" 3 4
+                                                                                                                  , 
+# 446 "./src/main/interface/settings.c"
+                                                                                                                  baro_cf_alt
+# 446 "./src/main/interface/settings.c" 3 4
+                                                                                                                  ) 
+# 446 "./src/main/interface/settings.c"
+                                                                                                                                                           },
+
+
+
+    { "mid_rc", VAR_UINT16 | MASTER_VALUE, .config.minmax = { 1200, 1700 }, 24, 
+# 450 "./src/main/interface/settings.c" 3 4
+                                                                                                             __builtin_offsetof (
+# 450 "./src/main/interface/settings.c"
+                                                                                                             rxConfig_t
+# 450 "./src/main/interface/settings.c" 3 4
+                                                                                                             , 
+# 450 "./src/main/interface/settings.c"
+                                                                                                             midrc
+# 450 "./src/main/interface/settings.c" 3 4
+                                                                                                             ) 
+# 450 "./src/main/interface/settings.c"
+                                                                                                                                         },
+    { "min_check", VAR_UINT16 | MASTER_VALUE, .config.minmax = { 750, 2250 }, 24, 
+# 451 "./src/main/interface/settings.c" 3 4
+                                                                                                                               __builtin_offsetof (
+# 451 "./src/main/interface/settings.c"
+                                                                                                                               rxConfig_t
+# 451 "./src/main/interface/settings.c" 3 4
+                                                                                                                               , 
+# 451 "./src/main/interface/settings.c"
+                                                                                                                               mincheck
+# 451 "./src/main/interface/settings.c" 3 4
+                                                                                                                               ) 
+# 451 "./src/main/interface/settings.c"
+                                                                                                                                                              },
+    { "max_check", VAR_UINT16 | MASTER_VALUE, .config.minmax = { 750, 2250 }, 24, 
+# 452 "./src/main/interface/settings.c" 3 4
+                                                                                                                               __builtin_offsetof (
+# 452 "./src/main/interface/settings.c"
+                                                                                                                               rxConfig_t
+# 452 "./src/main/interface/settings.c" 3 4
+                                                                                                                               , 
+# 452 "./src/main/interface/settings.c"
+                                                                                                                               maxcheck
+# 452 "./src/main/interface/settings.c" 3 4
+                                                                                                                               ) 
+# 452 "./src/main/interface/settings.c"
+                                                                                                                                                              },
+    { "rssi_channel", VAR_INT8 | MASTER_VALUE, .config.minmax = { 0, 18 }, 24, 
+# 453 "./src/main/interface/settings.c" 3 4
+                                                                                                                                    __builtin_offsetof (
+# 453 "./src/main/interface/settings.c"
+                                                                                                                                    rxConfig_t
+# 453 "./src/main/interface/settings.c" 3 4
+                                                                                                                                    , 
+# 453 "./src/main/interface/settings.c"
+                                                                                                                                    rssi_channel
+# 453 "./src/main/interface/settings.c" 3 4
+                                                                                                                                    ) 
+# 453 "./src/main/interface/settings.c"
+                                                                                                                                                                       },
+    { "rssi_scale", VAR_UINT8 | MASTER_VALUE, .config.minmax = { 1, 255 }, 24, 
+# 454 "./src/main/interface/settings.c" 3 4
+                                                                                                                                 __builtin_offsetof (
+# 454 "./src/main/interface/settings.c"
+                                                                                                                                 rxConfig_t
+# 454 "./src/main/interface/settings.c" 3 4
+                                                                                                                                 , 
+# 454 "./src/main/interface/settings.c"
+                                                                                                                                 rssi_scale
+# 454 "./src/main/interface/settings.c" 3 4
+                                                                                                                                 ) 
+# 454 "./src/main/interface/settings.c"
+                                                                                                                                                                  },
+    { "rssi_invert", VAR_INT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 24, 
+# 455 "./src/main/interface/settings.c" 3 4
+                                                                                                                             __builtin_offsetof (
+# 455 "./src/main/interface/settings.c"
+                                                                                                                             rxConfig_t
+# 455 "./src/main/interface/settings.c" 3 4
+                                                                                                                             , 
+# 455 "./src/main/interface/settings.c"
+                                                                                                                             rssi_invert
+# 455 "./src/main/interface/settings.c" 3 4
+                                                                                                                             ) 
+# 455 "./src/main/interface/settings.c"
+                                                                                                                                                               },
+    { "rc_interp", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_RC_INTERPOLATION }, 24, 
+# 456 "./src/main/interface/settings.c" 3 4
+                                                                                                                                       __builtin_offsetof (
+# 456 "./src/main/interface/settings.c"
+                                                                                                                                       rxConfig_t
+# 456 "./src/main/interface/settings.c" 3 4
+                                                                                                                                       , 
+# 456 "./src/main/interface/settings.c"
+                                                                                                                                       rcInterpolation
+# 456 "./src/main/interface/settings.c" 3 4
+                                                                                                                                       ) 
+# 456 "./src/main/interface/settings.c"
+                                                                                                                                                                             },
+    { "rc_interp_ch", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_RC_INTERPOLATION_CHANNELS }, 24, 
+# 457 "./src/main/interface/settings.c" 3 4
+                                                                                                                                                __builtin_offsetof (
+# 457 "./src/main/interface/settings.c"
+                                                                                                                                                rxConfig_t
+# 457 "./src/main/interface/settings.c" 3 4
+                                                                                                                                                , 
+# 457 "./src/main/interface/settings.c"
+                                                                                                                                                rcInterpolationChannels
+# 457 "./src/main/interface/settings.c" 3 4
+                                                                                                                                                ) 
+# 457 "./src/main/interface/settings.c"
+                                                                                                                                                                                              },
+    { "rc_interp_int", VAR_UINT8 | MASTER_VALUE, .config.minmax = { 1, 50 }, 24, 
+# 458 "./src/main/interface/settings.c" 3 4
+                                                                                                        __builtin_offsetof (
+# 458 "./src/main/interface/settings.c"
+                                                                                                        rxConfig_t
+# 458 "./src/main/interface/settings.c" 3 4
+                                                                                                        , 
+# 458 "./src/main/interface/settings.c"
+                                                                                                        rcInterpolationInterval
+# 458 "./src/main/interface/settings.c" 3 4
+                                                                                                        ) 
+# 458 "./src/main/interface/settings.c"
+                                                                                                                                                      },
+    { "fpv_mix_degrees", VAR_UINT8 | MASTER_VALUE, .config.minmax = { 0, 50 }, 24, 
+# 459 "./src/main/interface/settings.c" 3 4
+                                                                                                        __builtin_offsetof (
+# 459 "./src/main/interface/settings.c"
+                                                                                                        rxConfig_t
+# 459 "./src/main/interface/settings.c" 3 4
+                                                                                                        , 
+# 459 "./src/main/interface/settings.c"
+                                                                                                        fpvCamAngleDegrees
+# 459 "./src/main/interface/settings.c" 3 4
+                                                                                                        ) 
+# 459 "./src/main/interface/settings.c"
+                                                                                                                                                 },
+    { "max_aux_channels", VAR_UINT8 | MASTER_VALUE, .config.minmax = { 0, (18 - 4) }, 24, 
+# 460 "./src/main/interface/settings.c" 3 4
+                                                                                                                           __builtin_offsetof (
+# 460 "./src/main/interface/settings.c"
+                                                                                                                           rxConfig_t
+# 460 "./src/main/interface/settings.c" 3 4
+                                                                                                                           , 
+# 460 "./src/main/interface/settings.c"
+                                                                                                                           max_aux_channel
+# 460 "./src/main/interface/settings.c" 3 4
+                                                                                                                           ) 
+# 460 "./src/main/interface/settings.c"
+                                                                                                                                                                 },
+# 469 "./src/main/interface/settings.c"
+    { "airmode_start_throttle_percent", VAR_UINT8 | MASTER_VALUE, .config.minmax = { 0, 100 }, 24, 
+# 469 "./src/main/interface/settings.c" 3 4
+                                                                                                                __builtin_offsetof (
+# 469 "./src/main/interface/settings.c"
+                                                                                                                rxConfig_t
+# 469 "./src/main/interface/settings.c" 3 4
+                                                                                                                , 
+# 469 "./src/main/interface/settings.c"
+                                                                                                                airModeActivateThreshold
+# 469 "./src/main/interface/settings.c" 3 4
+                                                                                                                ) 
+# 469 "./src/main/interface/settings.c"
+                                                                                                                                                               },
+    { "rx_min_usec", VAR_UINT16 | MASTER_VALUE, .config.minmax = { 750, 2250 }, 24, 
+# 470 "./src/main/interface/settings.c" 3 4
+                                                                                                                               __builtin_offsetof (
+# 470 "./src/main/interface/settings.c"
+                                                                                                                               rxConfig_t
+# 470 "./src/main/interface/settings.c" 3 4
+                                                                                                                               , 
+# 470 "./src/main/interface/settings.c"
+                                                                                                                               rx_min_usec
+# 470 "./src/main/interface/settings.c" 3 4
+                                                                                                                               ) 
+# 470 "./src/main/interface/settings.c"
+                                                                                                                                                                 },
+    { "rx_max_usec", VAR_UINT16 | MASTER_VALUE, .config.minmax = { 750, 2250 }, 24, 
+# 471 "./src/main/interface/settings.c" 3 4
+                                                                                                                               __builtin_offsetof (
+# 471 "./src/main/interface/settings.c"
+                                                                                                                               rxConfig_t
+# 471 "./src/main/interface/settings.c" 3 4
+                                                                                                                               , 
+# 471 "./src/main/interface/settings.c"
+                                                                                                                               rx_max_usec
+# 471 "./src/main/interface/settings.c" 3 4
+                                                                                                                               ) 
+# 471 "./src/main/interface/settings.c"
+                                                                                                                                                                 },
+    { "serialrx_halfduplex", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 24, 
+# 472 "./src/main/interface/settings.c" 3 4
+                                                                                                                             __builtin_offsetof (
+# 472 "./src/main/interface/settings.c"
+                                                                                                                             rxConfig_t
+# 472 "./src/main/interface/settings.c" 3 4
+                                                                                                                             , 
+# 472 "./src/main/interface/settings.c"
+                                                                                                                             halfDuplex
+# 472 "./src/main/interface/settings.c" 3 4
+                                                                                                                             ) 
+# 472 "./src/main/interface/settings.c"
+                                                                                                                                                              },
+# 489 "./src/main/interface/settings.c"
+    { "blackbox_p_ratio", VAR_UINT16 | MASTER_VALUE, .config.minmax = { 0, 
+# 489 "./src/main/interface/settings.c" 3 4
+                                                                                    (32767) 
+# 489 "./src/main/interface/settings.c"
+                                                                                              }, 5, 
+# 489 "./src/main/interface/settings.c" 3 4
+                                                                                                                     __builtin_offsetof (
+# 489 "./src/main/interface/settings.c"
+                                                                                                                     blackboxConfig_t
+# 489 "./src/main/interface/settings.c" 3 4
+                                                                                                                     , 
+# 489 "./src/main/interface/settings.c"
+                                                                                                                     p_denom
+# 489 "./src/main/interface/settings.c" 3 4
+                                                                                                                     ) 
+# 489 "./src/main/interface/settings.c"
+                                                                                                                                                         },
+    { "blackbox_device", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_BLACKBOX_DEVICE }, 5, 
+# 490 "./src/main/interface/settings.c" 3 4
+                                                                                                                                            __builtin_offsetof (
+# 490 "./src/main/interface/settings.c"
+                                                                                                                                            blackboxConfig_t
+# 490 "./src/main/interface/settings.c" 3 4
+                                                                                                                                            , 
+# 490 "./src/main/interface/settings.c"
+                                                                                                                                            device
+# 490 "./src/main/interface/settings.c" 3 4
+                                                                                                                                            ) 
+# 490 "./src/main/interface/settings.c"
+                                                                                                                                                                               },
+    { "blackbox_record_acc", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 5, 
+# 491 "./src/main/interface/settings.c" 3 4
+                                                                                                                                   __builtin_offsetof (
+# 491 "./src/main/interface/settings.c"
+                                                                                                                                   blackboxConfig_t
+# 491 "./src/main/interface/settings.c" 3 4
+                                                                                                                                   , 
+# 491 "./src/main/interface/settings.c"
+                                                                                                                                   record_acc
+# 491 "./src/main/interface/settings.c" 3 4
+                                                                                                                                   ) 
+# 491 "./src/main/interface/settings.c"
+                                                                                                                                                                          },
+    { "blackbox_mode", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_BLACKBOX_MODE }, 5, 
+# 492 "./src/main/interface/settings.c" 3 4
+                                                                                                                                          __builtin_offsetof (
+# 492 "./src/main/interface/settings.c"
+                                                                                                                                          blackboxConfig_t
+# 492 "./src/main/interface/settings.c" 3 4
+                                                                                                                                          , 
+# 492 "./src/main/interface/settings.c"
+                                                                                                                                          mode
+# 492 "./src/main/interface/settings.c" 3 4
+                                                                                                                                          ) 
+# 492 "./src/main/interface/settings.c"
+                                                                                                                                                                           },
+    { "blackbox_ol_denom", VAR_UINT16 | MASTER_VALUE, .config.minmax = { 0, 
+# 493 "./src/main/interface/settings.c" 3 4
+                                                                                    (32767) 
+# 493 "./src/main/interface/settings.c"
+                                                                                              }, 5, 
+# 493 "./src/main/interface/settings.c" 3 4
+                                                                                                                     __builtin_offsetof (
+# 493 "./src/main/interface/settings.c"
+                                                                                                                     blackboxConfig_t
+# 493 "./src/main/interface/settings.c" 3 4
+                                                                                                                     , 
+# 493 "./src/main/interface/settings.c"
+                                                                                                                     ol_denom
+# 493 "./src/main/interface/settings.c" 3 4
+                                                                                                                     ) 
+# 493 "./src/main/interface/settings.c"
+                                                                                                                                                          },
+
+
+
+    { "min_throttle", VAR_UINT16 | MASTER_VALUE, .config.minmax = { 750, 2250 }, 6, 
+# 497 "./src/main/interface/settings.c" 3 4
+                                                                                                                                  __builtin_offsetof (
+# 497 "./src/main/interface/settings.c"
+                                                                                                                                  motorConfig_t
+# 497 "./src/main/interface/settings.c" 3 4
+                                                                                                                                  , 
+# 497 "./src/main/interface/settings.c"
+                                                                                                                                  minthrottle
+# 497 "./src/main/interface/settings.c" 3 4
+                                                                                                                                  ) 
+# 497 "./src/main/interface/settings.c"
+                                                                                                                                                                       },
+    { "max_throttle", VAR_UINT16 | MASTER_VALUE, .config.minmax = { 750, 2250 }, 6, 
+# 498 "./src/main/interface/settings.c" 3 4
+                                                                                                                                  __builtin_offsetof (
+# 498 "./src/main/interface/settings.c"
+                                                                                                                                  motorConfig_t
+# 498 "./src/main/interface/settings.c" 3 4
+                                                                                                                                  , 
+# 498 "./src/main/interface/settings.c"
+                                                                                                                                  maxthrottle
+# 498 "./src/main/interface/settings.c" 3 4
+                                                                                                                                  ) 
+# 498 "./src/main/interface/settings.c"
+                                                                                                                                                                       },
+    { "min_command", VAR_UINT16 | MASTER_VALUE, .config.minmax = { 750, 2250 }, 6, 
+# 499 "./src/main/interface/settings.c" 3 4
+                                                                                                                                  __builtin_offsetof (
+# 499 "./src/main/interface/settings.c"
+                                                                                                                                  motorConfig_t
+# 499 "./src/main/interface/settings.c" 3 4
+                                                                                                                                  , 
+# 499 "./src/main/interface/settings.c"
+                                                                                                                                  mincommand
+# 499 "./src/main/interface/settings.c" 3 4
+                                                                                                                                  ) 
+# 499 "./src/main/interface/settings.c"
+                                                                                                                                                                      },
+
+
+
+
+
+
+    { "use_unsynced_pwm", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 6, 
+# 506 "./src/main/interface/settings.c" 3 4
+                                                                                                                                __builtin_offsetof (
+# 506 "./src/main/interface/settings.c"
+                                                                                                                                motorConfig_t
+# 506 "./src/main/interface/settings.c" 3 4
+                                                                                                                                , 
+# 506 "./src/main/interface/settings.c"
+                                                                                                                                dev.useUnsyncedPwm
+# 506 "./src/main/interface/settings.c" 3 4
+                                                                                                                                ) 
+# 506 "./src/main/interface/settings.c"
+                                                                                                                                                                            },
+    { "motor_pwm_protocol", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_MOTOR_PWM_PROTOCOL }, 6, 
+# 507 "./src/main/interface/settings.c" 3 4
+                                                                                                                                            __builtin_offsetof (
+# 507 "./src/main/interface/settings.c"
+                                                                                                                                            motorConfig_t
+# 507 "./src/main/interface/settings.c" 3 4
+                                                                                                                                            , 
+# 507 "./src/main/interface/settings.c"
+                                                                                                                                            dev.motorPwmProtocol
+# 507 "./src/main/interface/settings.c" 3 4
+                                                                                                                                            ) 
+# 507 "./src/main/interface/settings.c"
+                                                                                                                                                                                          },
+    { "motor_pwm_rate", VAR_UINT16 | MASTER_VALUE, .config.minmax = { 200, 32000 }, 6, 
+# 508 "./src/main/interface/settings.c" 3 4
+                                                                                                                __builtin_offsetof (
+# 508 "./src/main/interface/settings.c"
+                                                                                                                motorConfig_t
+# 508 "./src/main/interface/settings.c" 3 4
+                                                                                                                , 
+# 508 "./src/main/interface/settings.c"
+                                                                                                                dev.motorPwmRate
+# 508 "./src/main/interface/settings.c" 3 4
+                                                                                                                ) 
+# 508 "./src/main/interface/settings.c"
+                                                                                                                                                          },
+    { "motor_pwm_inversion", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 6, 
+# 509 "./src/main/interface/settings.c" 3 4
+                                                                                                                                __builtin_offsetof (
+# 509 "./src/main/interface/settings.c"
+                                                                                                                                motorConfig_t
+# 509 "./src/main/interface/settings.c" 3 4
+                                                                                                                                , 
+# 509 "./src/main/interface/settings.c"
+                                                                                                                                dev.motorPwmInversion
+# 509 "./src/main/interface/settings.c" 3 4
+                                                                                                                                ) 
+# 509 "./src/main/interface/settings.c"
+                                                                                                                                                                               },
+
+
+    { "thr_corr_value", VAR_UINT8 | MASTER_VALUE, .config.minmax = { 0, 150 }, 39, 
+# 512 "./src/main/interface/settings.c" 3 4
+                                                                                                                           __builtin_offsetof (
+# 512 "./src/main/interface/settings.c"
+                                                                                                                           throttleCorrectionConfig_t
+# 512 "./src/main/interface/settings.c" 3 4
+                                                                                                                           , 
+# 512 "./src/main/interface/settings.c"
+                                                                                                                           throttle_correction_value
+# 512 "./src/main/interface/settings.c" 3 4
+                                                                                                                           ) 
+# 512 "./src/main/interface/settings.c"
+                                                                                                                                                                                           },
+    { "thr_corr_angle", VAR_UINT16 | MASTER_VALUE, .config.minmax = { 1, 900 }, 39, 
+# 513 "./src/main/interface/settings.c" 3 4
+                                                                                                                           __builtin_offsetof (
+# 513 "./src/main/interface/settings.c"
+                                                                                                                           throttleCorrectionConfig_t
+# 513 "./src/main/interface/settings.c" 3 4
+                                                                                                                           , 
+# 513 "./src/main/interface/settings.c"
+                                                                                                                           throttle_correction_angle
+# 513 "./src/main/interface/settings.c" 3 4
+                                                                                                                           ) 
+# 513 "./src/main/interface/settings.c"
+                                                                                                                                                                                           },
+
+
+    { "failsafe_delay", VAR_UINT8 | MASTER_VALUE, .config.minmax = { 0, 200 }, 1, 
+# 516 "./src/main/interface/settings.c" 3 4
+                                                                                                               __builtin_offsetof (
+# 516 "./src/main/interface/settings.c"
+                                                                                                               failsafeConfig_t
+# 516 "./src/main/interface/settings.c" 3 4
+                                                                                                               , 
+# 516 "./src/main/interface/settings.c"
+                                                                                                               failsafe_delay
+# 516 "./src/main/interface/settings.c" 3 4
+                                                                                                               ) 
+# 516 "./src/main/interface/settings.c"
+                                                                                                                                                          },
+    { "failsafe_off_delay", VAR_UINT8 | MASTER_VALUE, .config.minmax = { 0, 200 }, 1, 
+# 517 "./src/main/interface/settings.c" 3 4
+                                                                                                               __builtin_offsetof (
+# 517 "./src/main/interface/settings.c"
+                                                                                                               failsafeConfig_t
+# 517 "./src/main/interface/settings.c" 3 4
+                                                                                                               , 
+# 517 "./src/main/interface/settings.c"
+                                                                                                               failsafe_off_delay
+# 517 "./src/main/interface/settings.c" 3 4
+                                                                                                               ) 
+# 517 "./src/main/interface/settings.c"
+                                                                                                                                                              },
+    { "failsafe_throttle", VAR_UINT16 | MASTER_VALUE, .config.minmax = { 750, 2250 }, 1, 
+# 518 "./src/main/interface/settings.c" 3 4
+                                                                                                                                     __builtin_offsetof (
+# 518 "./src/main/interface/settings.c"
+                                                                                                                                     failsafeConfig_t
+# 518 "./src/main/interface/settings.c" 3 4
+                                                                                                                                     , 
+# 518 "./src/main/interface/settings.c"
+                                                                                                                                     failsafe_throttle
+# 518 "./src/main/interface/settings.c" 3 4
+                                                                                                                                     ) 
+# 518 "./src/main/interface/settings.c"
+                                                                                                                                                                                   },
+    { "failsafe_kill_switch", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 1, 
+# 519 "./src/main/interface/settings.c" 3 4
+                                                                                                                                   __builtin_offsetof (
+# 519 "./src/main/interface/settings.c"
+                                                                                                                                   failsafeConfig_t
+# 519 "./src/main/interface/settings.c" 3 4
+                                                                                                                                   , 
+# 519 "./src/main/interface/settings.c"
+                                                                                                                                   failsafe_kill_switch
+# 519 "./src/main/interface/settings.c" 3 4
+                                                                                                                                   ) 
+# 519 "./src/main/interface/settings.c"
+                                                                                                                                                                                    },
+    { "failsafe_throttle_low_delay",VAR_UINT16 | MASTER_VALUE, .config.minmax = { 0, 300 }, 1, 
+# 520 "./src/main/interface/settings.c" 3 4
+                                                                                                               __builtin_offsetof (
+# 520 "./src/main/interface/settings.c"
+                                                                                                               failsafeConfig_t
+# 520 "./src/main/interface/settings.c" 3 4
+                                                                                                               , 
+# 520 "./src/main/interface/settings.c"
+                                                                                                               failsafe_throttle_low_delay
+# 520 "./src/main/interface/settings.c" 3 4
+                                                                                                               ) 
+# 520 "./src/main/interface/settings.c"
+                                                                                                                                                                       },
+    { "failsafe_procedure", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_FAILSAFE }, 1, 
+# 521 "./src/main/interface/settings.c" 3 4
+                                                                                                                                     __builtin_offsetof (
+# 521 "./src/main/interface/settings.c"
+                                                                                                                                     failsafeConfig_t
+# 521 "./src/main/interface/settings.c" 3 4
+                                                                                                                                     , 
+# 521 "./src/main/interface/settings.c"
+                                                                                                                                     failsafe_procedure
+# 521 "./src/main/interface/settings.c" 3 4
+                                                                                                                                     ) 
+# 521 "./src/main/interface/settings.c"
+                                                                                                                                                                                    },
+
+
+    { "align_board_roll", VAR_INT16 | MASTER_VALUE, .config.minmax = { -180, 360 }, 2, 
+# 524 "./src/main/interface/settings.c" 3 4
+                                                                                                                  __builtin_offsetof (
+# 524 "./src/main/interface/settings.c"
+                                                                                                                  boardAlignment_t
+# 524 "./src/main/interface/settings.c" 3 4
+                                                                                                                  , 
+# 524 "./src/main/interface/settings.c"
+                                                                                                                  rollDegrees
+# 524 "./src/main/interface/settings.c" 3 4
+                                                                                                                  ) 
+# 524 "./src/main/interface/settings.c"
+                                                                                                                                                          },
+    { "align_board_pitch", VAR_INT16 | MASTER_VALUE, .config.minmax = { -180, 360 }, 2, 
+# 525 "./src/main/interface/settings.c" 3 4
+                                                                                                                  __builtin_offsetof (
+# 525 "./src/main/interface/settings.c"
+                                                                                                                  boardAlignment_t
+# 525 "./src/main/interface/settings.c" 3 4
+                                                                                                                  , 
+# 525 "./src/main/interface/settings.c"
+                                                                                                                  pitchDegrees
+# 525 "./src/main/interface/settings.c" 3 4
+                                                                                                                  ) 
+# 525 "./src/main/interface/settings.c"
+                                                                                                                                                           },
+    { "align_board_yaw", VAR_INT16 | MASTER_VALUE, .config.minmax = { -180, 360 }, 2, 
+# 526 "./src/main/interface/settings.c" 3 4
+                                                                                                                  __builtin_offsetof (
+# 526 "./src/main/interface/settings.c"
+                                                                                                                  boardAlignment_t
+# 526 "./src/main/interface/settings.c" 3 4
+                                                                                                                  , 
+# 526 "./src/main/interface/settings.c"
+                                                                                                                  yawDegrees
+# 526 "./src/main/interface/settings.c" 3 4
+                                                                                                                  ) 
+# 526 "./src/main/interface/settings.c"
+                                                                                                                                                         },
+
+
+
+    { "gimbal_mode", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_GIMBAL_MODE }, 3, 
+# 530 "./src/main/interface/settings.c" 3 4
+                                                                                                                                      __builtin_offsetof (
+# 530 "./src/main/interface/settings.c"
+                                                                                                                                      gimbalConfig_t
+# 530 "./src/main/interface/settings.c" 3 4
+                                                                                                                                      , 
+# 530 "./src/main/interface/settings.c"
+                                                                                                                                      mode
+# 530 "./src/main/interface/settings.c" 3 4
+                                                                                                                                      ) 
+# 530 "./src/main/interface/settings.c"
+                                                                                                                                                                     },
+
+
+
+    { "bat_capacity", VAR_UINT16 | MASTER_VALUE, .config.minmax = { 0, 20000 }, 11, 
+# 534 "./src/main/interface/settings.c" 3 4
+                                                                                                                __builtin_offsetof (
+# 534 "./src/main/interface/settings.c"
+                                                                                                                batteryConfig_t
+# 534 "./src/main/interface/settings.c" 3 4
+                                                                                                                , 
+# 534 "./src/main/interface/settings.c"
+                                                                                                                batteryCapacity
+# 534 "./src/main/interface/settings.c" 3 4
+                                                                                                                ) 
+# 534 "./src/main/interface/settings.c"
+                                                                                                                                                           },
+    { "vbat_max_cell_voltage", VAR_UINT8 | MASTER_VALUE, .config.minmax = { 10, 50 }, 11, 
+# 535 "./src/main/interface/settings.c" 3 4
+                                                                                                              __builtin_offsetof (
+# 535 "./src/main/interface/settings.c"
+                                                                                                              batteryConfig_t
+# 535 "./src/main/interface/settings.c" 3 4
+                                                                                                              , 
+# 535 "./src/main/interface/settings.c"
+                                                                                                              vbatmaxcellvoltage
+# 535 "./src/main/interface/settings.c" 3 4
+                                                                                                              ) 
+# 535 "./src/main/interface/settings.c"
+                                                                                                                                                            },
+    { "vbat_full_cell_voltage", VAR_UINT8 | MASTER_VALUE, .config.minmax = { 10, 50 }, 11, 
+# 536 "./src/main/interface/settings.c" 3 4
+                                                                                                              __builtin_offsetof (
+# 536 "./src/main/interface/settings.c"
+                                                                                                              batteryConfig_t
+# 536 "./src/main/interface/settings.c" 3 4
+                                                                                                              , 
+# 536 "./src/main/interface/settings.c"
+                                                                                                              vbatfullcellvoltage
+# 536 "./src/main/interface/settings.c" 3 4
+                                                                                                              ) 
+# 536 "./src/main/interface/settings.c"
+                                                                                                                                                             },
+    { "vbat_min_cell_voltage", VAR_UINT8 | MASTER_VALUE, .config.minmax = { 10, 50 }, 11, 
+# 537 "./src/main/interface/settings.c" 3 4
+                                                                                                              __builtin_offsetof (
+# 537 "./src/main/interface/settings.c"
+                                                                                                              batteryConfig_t
+# 537 "./src/main/interface/settings.c" 3 4
+                                                                                                              , 
+# 537 "./src/main/interface/settings.c"
+                                                                                                              vbatmincellvoltage
+# 537 "./src/main/interface/settings.c" 3 4
+                                                                                                              ) 
+# 537 "./src/main/interface/settings.c"
+                                                                                                                                                            },
+    { "vbat_warning_cell_voltage", VAR_UINT8 | MASTER_VALUE, .config.minmax = { 10, 50 }, 11, 
+# 538 "./src/main/interface/settings.c" 3 4
+                                                                                                              __builtin_offsetof (
+# 538 "./src/main/interface/settings.c"
+                                                                                                              batteryConfig_t
+# 538 "./src/main/interface/settings.c" 3 4
+                                                                                                              , 
+# 538 "./src/main/interface/settings.c"
+                                                                                                              vbatwarningcellvoltage
+# 538 "./src/main/interface/settings.c" 3 4
+                                                                                                              ) 
+# 538 "./src/main/interface/settings.c"
+                                                                                                                                                                },
+    { "vbat_hysteresis", VAR_UINT8 | MASTER_VALUE, .config.minmax = { 0, 250 }, 11, 
+# 539 "./src/main/interface/settings.c" 3 4
+                                                                                                              __builtin_offsetof (
+# 539 "./src/main/interface/settings.c"
+                                                                                                              batteryConfig_t
+# 539 "./src/main/interface/settings.c" 3 4
+                                                                                                              , 
+# 539 "./src/main/interface/settings.c"
+                                                                                                              vbathysteresis
+# 539 "./src/main/interface/settings.c" 3 4
+                                                                                                              ) 
+# 539 "./src/main/interface/settings.c"
+                                                                                                                                                        },
+    { "current_meter", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_CURRENT_METER }, 11, 
+# 540 "./src/main/interface/settings.c" 3 4
+                                                                                                                                         __builtin_offsetof (
+# 540 "./src/main/interface/settings.c"
+                                                                                                                                         batteryConfig_t
+# 540 "./src/main/interface/settings.c" 3 4
+                                                                                                                                         , 
+# 540 "./src/main/interface/settings.c"
+                                                                                                                                         currentMeterSource
+# 540 "./src/main/interface/settings.c" 3 4
+                                                                                                                                         ) 
+# 540 "./src/main/interface/settings.c"
+                                                                                                                                                                                       },
+    { "battery_meter", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_VOLTAGE_METER }, 11, 
+# 541 "./src/main/interface/settings.c" 3 4
+                                                                                                                                         __builtin_offsetof (
+# 541 "./src/main/interface/settings.c"
+                                                                                                                                         batteryConfig_t
+# 541 "./src/main/interface/settings.c" 3 4
+                                                                                                                                         , 
+# 541 "./src/main/interface/settings.c"
+                                                                                                                                         voltageMeterSource
+# 541 "./src/main/interface/settings.c" 3 4
+                                                                                                                                         ) 
+# 541 "./src/main/interface/settings.c"
+                                                                                                                                                                                       },
+    { "vbat_detect_cell_voltage", VAR_UINT8 | MASTER_VALUE, .config.minmax = { 0, 200 }, 11, 
+# 542 "./src/main/interface/settings.c" 3 4
+                                                                                                              __builtin_offsetof (
+# 542 "./src/main/interface/settings.c"
+                                                                                                              batteryConfig_t
+# 542 "./src/main/interface/settings.c" 3 4
+                                                                                                              , 
+# 542 "./src/main/interface/settings.c"
+                                                                                                              vbatnotpresentcellvoltage
+# 542 "./src/main/interface/settings.c" 3 4
+                                                                                                              ) 
+# 542 "./src/main/interface/settings.c"
+                                                                                                                                                                   },
+    { "use_vbat_alerts", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 11, 
+# 543 "./src/main/interface/settings.c" 3 4
+                                                                                                                                  __builtin_offsetof (
+# 543 "./src/main/interface/settings.c"
+                                                                                                                                  batteryConfig_t
+# 543 "./src/main/interface/settings.c" 3 4
+                                                                                                                                  , 
+# 543 "./src/main/interface/settings.c"
+                                                                                                                                  useVBatAlerts
+# 543 "./src/main/interface/settings.c" 3 4
+                                                                                                                                  ) 
+# 543 "./src/main/interface/settings.c"
+                                                                                                                                                                           },
+    { "use_cbat_alerts", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 11, 
+# 544 "./src/main/interface/settings.c" 3 4
+                                                                                                                                  __builtin_offsetof (
+# 544 "./src/main/interface/settings.c"
+                                                                                                                                  batteryConfig_t
+# 544 "./src/main/interface/settings.c" 3 4
+                                                                                                                                  , 
+# 544 "./src/main/interface/settings.c"
+                                                                                                                                  useConsumptionAlerts
+# 544 "./src/main/interface/settings.c" 3 4
+                                                                                                                                  ) 
+# 544 "./src/main/interface/settings.c"
+                                                                                                                                                                                  },
+    { "cbat_alert_percent", VAR_UINT8 | MASTER_VALUE, .config.minmax = { 0, 100 }, 11, 
+# 545 "./src/main/interface/settings.c" 3 4
+                                                                                                              __builtin_offsetof (
+# 545 "./src/main/interface/settings.c"
+                                                                                                              batteryConfig_t
+# 545 "./src/main/interface/settings.c" 3 4
+                                                                                                              , 
+# 545 "./src/main/interface/settings.c"
+                                                                                                              consumptionWarningPercentage
+# 545 "./src/main/interface/settings.c" 3 4
+                                                                                                              ) 
+# 545 "./src/main/interface/settings.c"
+                                                                                                                                                                      },
+    { "vbat_cutoff_percent", VAR_UINT8 | MASTER_VALUE, .config.minmax = { 0, 100 }, 11, 
+# 546 "./src/main/interface/settings.c" 3 4
+                                                                                                                 __builtin_offsetof (
+# 546 "./src/main/interface/settings.c"
+                                                                                                                 batteryConfig_t
+# 546 "./src/main/interface/settings.c" 3 4
+                                                                                                                 , 
+# 546 "./src/main/interface/settings.c"
+                                                                                                                 lvcPercentage
+# 546 "./src/main/interface/settings.c" 3 4
+                                                                                                                 ) 
+# 546 "./src/main/interface/settings.c"
+                                                                                                                                                          },
+
+
+    { "vbat_scale", VAR_UINT8 | MASTER_VALUE, .config.minmax = { 0, 255 }, 258, 
+# 549 "./src/main/interface/settings.c" 3 4
+                                                                                                                                                 __builtin_offsetof (
+# 549 "./src/main/interface/settings.c"
+                                                                                                                                                 voltageSensorADCConfig_t
+# 549 "./src/main/interface/settings.c" 3 4
+                                                                                                                                                 , 
+# 549 "./src/main/interface/settings.c"
+                                                                                                                                                 vbatscale
+# 549 "./src/main/interface/settings.c" 3 4
+                                                                                                                                                 ) 
+# 549 "./src/main/interface/settings.c"
+                                                                                                                                                                                               },
+
+
+    { "ibata_scale", VAR_INT16 | MASTER_VALUE, .config.minmax = { -16000, 16000 }, 256, 
+# 552 "./src/main/interface/settings.c" 3 4
+                                                                                                                                __builtin_offsetof (
+# 552 "./src/main/interface/settings.c"
+                                                                                                                                currentSensorADCConfig_t
+# 552 "./src/main/interface/settings.c" 3 4
+                                                                                                                                , 
+# 552 "./src/main/interface/settings.c"
+                                                                                                                                scale
+# 552 "./src/main/interface/settings.c" 3 4
+                                                                                                                                ) 
+# 552 "./src/main/interface/settings.c"
+                                                                                                                                                                          },
+    { "ibata_offset", VAR_INT16 | MASTER_VALUE, .config.minmax = { -32000, 32000 }, 256, 
+# 553 "./src/main/interface/settings.c" 3 4
+                                                                                                                                __builtin_offsetof (
+# 553 "./src/main/interface/settings.c"
+                                                                                                                                currentSensorADCConfig_t
+# 553 "./src/main/interface/settings.c" 3 4
+                                                                                                                                , 
+# 553 "./src/main/interface/settings.c"
+                                                                                                                                offset
+# 553 "./src/main/interface/settings.c" 3 4
+                                                                                                                                ) 
+# 553 "./src/main/interface/settings.c"
+                                                                                                                                                                           },
+
+
+    { "ibatv_scale", VAR_INT16 | MASTER_VALUE, .config.minmax = { -16000, 16000 }, 257, 
+# 556 "./src/main/interface/settings.c" 3 4
+                                                                                                                                    __builtin_offsetof (
+# 556 "./src/main/interface/settings.c"
+                                                                                                                                    currentSensorVirtualConfig_t
+# 556 "./src/main/interface/settings.c" 3 4
+                                                                                                                                    , 
+# 556 "./src/main/interface/settings.c"
+                                                                                                                                    scale
+# 556 "./src/main/interface/settings.c" 3 4
+                                                                                                                                    ) 
+# 556 "./src/main/interface/settings.c"
+                                                                                                                                                                                  },
+    { "ibatv_offset", VAR_INT16 | MASTER_VALUE, .config.minmax = { -16000, 16000 }, 257, 
+# 557 "./src/main/interface/settings.c" 3 4
+                                                                                                                                    __builtin_offsetof (
+# 557 "./src/main/interface/settings.c"
+                                                                                                                                    currentSensorVirtualConfig_t
+# 557 "./src/main/interface/settings.c" 3 4
+                                                                                                                                    , 
+# 557 "./src/main/interface/settings.c"
+                                                                                                                                    offset
+# 557 "./src/main/interface/settings.c" 3 4
+                                                                                                                                    ) 
+# 557 "./src/main/interface/settings.c"
+                                                                                                                                                                                   },
+# 573 "./src/main/interface/settings.c"
+    { "yaw_motors_reversed", VAR_INT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 20, 
+# 573 "./src/main/interface/settings.c" 3 4
+                                                                                                                                __builtin_offsetof (
+# 573 "./src/main/interface/settings.c"
+                                                                                                                                mixerConfig_t
+# 573 "./src/main/interface/settings.c" 3 4
+                                                                                                                                , 
+# 573 "./src/main/interface/settings.c"
+                                                                                                                                yaw_motors_reversed
+# 573 "./src/main/interface/settings.c" 3 4
+                                                                                                                                ) 
+# 573 "./src/main/interface/settings.c"
+                                                                                                                                                                             },
+
+
+    { "3d_deadband_low", VAR_UINT16 | MASTER_VALUE, .config.minmax = { 750, (1000 + ((2000 - 1000) / 2)) }, 26, 
+# 576 "./src/main/interface/settings.c" 3 4
+                                                                                                                                        __builtin_offsetof (
+# 576 "./src/main/interface/settings.c"
+                                                                                                                                        flight3DConfig_t
+# 576 "./src/main/interface/settings.c" 3 4
+                                                                                                                                        , 
+# 576 "./src/main/interface/settings.c"
+                                                                                                                                        deadband3d_low
+# 576 "./src/main/interface/settings.c" 3 4
+                                                                                                                                        ) 
+# 576 "./src/main/interface/settings.c"
+                                                                                                                                                                                   },
+    { "3d_deadband_high", VAR_UINT16 | MASTER_VALUE, .config.minmax = { (1000 + ((2000 - 1000) / 2)), 2250 }, 26, 
+# 577 "./src/main/interface/settings.c" 3 4
+                                                                                                                                        __builtin_offsetof (
+# 577 "./src/main/interface/settings.c"
+                                                                                                                                        flight3DConfig_t
+# 577 "./src/main/interface/settings.c" 3 4
+                                                                                                                                        , 
+# 577 "./src/main/interface/settings.c"
+                                                                                                                                        deadband3d_high
+# 577 "./src/main/interface/settings.c" 3 4
+                                                                                                                                        ) 
+# 577 "./src/main/interface/settings.c"
+                                                                                                                                                                                    },
+    { "3d_neutral", VAR_UINT16 | MASTER_VALUE, .config.minmax = { 750, 2250 }, 26, 
+# 578 "./src/main/interface/settings.c" 3 4
+                                                                                                                                     __builtin_offsetof (
+# 578 "./src/main/interface/settings.c"
+                                                                                                                                     flight3DConfig_t
+# 578 "./src/main/interface/settings.c" 3 4
+                                                                                                                                     , 
+# 578 "./src/main/interface/settings.c"
+                                                                                                                                     neutral3d
+# 578 "./src/main/interface/settings.c" 3 4
+                                                                                                                                     ) 
+# 578 "./src/main/interface/settings.c"
+                                                                                                                                                                           },
+    { "3d_deadband_throttle", VAR_UINT16 | MASTER_VALUE, .config.minmax = { 750, 2250 }, 26, 
+# 579 "./src/main/interface/settings.c" 3 4
+                                                                                                                                     __builtin_offsetof (
+# 579 "./src/main/interface/settings.c"
+                                                                                                                                     flight3DConfig_t
+# 579 "./src/main/interface/settings.c" 3 4
+                                                                                                                                     , 
+# 579 "./src/main/interface/settings.c"
+                                                                                                                                     deadband3d_throttle
+# 579 "./src/main/interface/settings.c" 3 4
+                                                                                                                                     ) 
+# 579 "./src/main/interface/settings.c"
+                                                                                                                                                                                     },
+    { "3d_switched_mode", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 26, 
+# 580 "./src/main/interface/settings.c" 3 4
+                                                                                                                                  __builtin_offsetof (
+# 580 "./src/main/interface/settings.c"
+                                                                                                                                  flight3DConfig_t
+# 580 "./src/main/interface/settings.c" 3 4
+                                                                                                                                  , 
+# 580 "./src/main/interface/settings.c"
+                                                                                                                                  switched_mode3d
+# 580 "./src/main/interface/settings.c" 3 4
+                                                                                                                                  ) 
+# 580 "./src/main/interface/settings.c"
+                                                                                                                                                                              },
+
+
+
+    { "servo_center_pulse", VAR_UINT16 | MASTER_VALUE, .config.minmax = { 750, 2250 }, 52, 
+# 584 "./src/main/interface/settings.c" 3 4
+                                                                                                                                  __builtin_offsetof (
+# 584 "./src/main/interface/settings.c"
+                                                                                                                                  servoConfig_t
+# 584 "./src/main/interface/settings.c" 3 4
+                                                                                                                                  , 
+# 584 "./src/main/interface/settings.c"
+                                                                                                                                  dev.servoCenterPulse
+# 584 "./src/main/interface/settings.c" 3 4
+                                                                                                                                  ) 
+# 584 "./src/main/interface/settings.c"
+                                                                                                                                                                                },
+    { "servo_pwm_rate", VAR_UINT16 | MASTER_VALUE, .config.minmax = { 50, 498 }, 52, 
+# 585 "./src/main/interface/settings.c" 3 4
+                                                                                                             __builtin_offsetof (
+# 585 "./src/main/interface/settings.c"
+                                                                                                             servoConfig_t
+# 585 "./src/main/interface/settings.c" 3 4
+                                                                                                             , 
+# 585 "./src/main/interface/settings.c"
+                                                                                                             dev.servoPwmRate
+# 585 "./src/main/interface/settings.c" 3 4
+                                                                                                             ) 
+# 585 "./src/main/interface/settings.c"
+                                                                                                                                                       },
+    { "servo_lowpass_hz", VAR_UINT16 | MASTER_VALUE, .config.minmax = { 0, 400}, 52, 
+# 586 "./src/main/interface/settings.c" 3 4
+                                                                                                           __builtin_offsetof (
+# 586 "./src/main/interface/settings.c"
+                                                                                                           servoConfig_t
+# 586 "./src/main/interface/settings.c" 3 4
+                                                                                                           , 
+# 586 "./src/main/interface/settings.c"
+                                                                                                           servo_lowpass_freq
+# 586 "./src/main/interface/settings.c" 3 4
+                                                                                                           ) 
+# 586 "./src/main/interface/settings.c"
+                                                                                                                                                       },
+    { "tri_unarmed_servo", VAR_INT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 52, 
+# 587 "./src/main/interface/settings.c" 3 4
+                                                                                                                                __builtin_offsetof (
+# 587 "./src/main/interface/settings.c"
+                                                                                                                                servoConfig_t
+# 587 "./src/main/interface/settings.c" 3 4
+                                                                                                                                , 
+# 587 "./src/main/interface/settings.c"
+                                                                                                                                tri_unarmed_servo
+# 587 "./src/main/interface/settings.c" 3 4
+                                                                                                                                ) 
+# 587 "./src/main/interface/settings.c"
+                                                                                                                                                                           },
+    { "channel_forwarding_start", VAR_UINT8 | MASTER_VALUE, .config.minmax = { AUX1, 18 }, 52, 
+# 588 "./src/main/interface/settings.c" 3 4
+                                                                                                                                          __builtin_offsetof (
+# 588 "./src/main/interface/settings.c"
+                                                                                                                                          servoConfig_t
+# 588 "./src/main/interface/settings.c" 3 4
+                                                                                                                                          , 
+# 588 "./src/main/interface/settings.c"
+                                                                                                                                          channelForwardingStartChannel
+# 588 "./src/main/interface/settings.c" 3 4
+                                                                                                                                          ) 
+# 588 "./src/main/interface/settings.c"
+                                                                                                                                                                                                 },
+
+
+
+    { "thr_mid", VAR_UINT8 | PROFILE_RATE_VALUE, .config.minmax = { 0, 100 }, 12, 
+# 592 "./src/main/interface/settings.c" 3 4
+                                                                                                                           __builtin_offsetof (
+# 592 "./src/main/interface/settings.c"
+                                                                                                                           controlRateConfig_t
+# 592 "./src/main/interface/settings.c" 3 4
+                                                                                                                           , 
+# 592 "./src/main/interface/settings.c"
+                                                                                                                           thrMid8
+# 592 "./src/main/interface/settings.c" 3 4
+                                                                                                                           ) 
+# 592 "./src/main/interface/settings.c"
+                                                                                                                                                                  },
+    { "thr_expo", VAR_UINT8 | PROFILE_RATE_VALUE, .config.minmax = { 0, 100 }, 12, 
+# 593 "./src/main/interface/settings.c" 3 4
+                                                                                                                           __builtin_offsetof (
+# 593 "./src/main/interface/settings.c"
+                                                                                                                           controlRateConfig_t
+# 593 "./src/main/interface/settings.c" 3 4
+                                                                                                                           , 
+# 593 "./src/main/interface/settings.c"
+                                                                                                                           thrExpo8
+# 593 "./src/main/interface/settings.c" 3 4
+                                                                                                                           ) 
+# 593 "./src/main/interface/settings.c"
+                                                                                                                                                                   },
+    { "rates_type", VAR_UINT8 | PROFILE_RATE_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_RATES_TYPE }, 12, 
+# 594 "./src/main/interface/settings.c" 3 4
+                                                                                                                                                   __builtin_offsetof (
+# 594 "./src/main/interface/settings.c"
+                                                                                                                                                   controlRateConfig_t
+# 594 "./src/main/interface/settings.c" 3 4
+                                                                                                                                                   , 
+# 594 "./src/main/interface/settings.c"
+                                                                                                                                                   rates_type
+# 594 "./src/main/interface/settings.c" 3 4
+                                                                                                                                                   ) 
+# 594 "./src/main/interface/settings.c"
+                                                                                                                                                                                             },
+    { "roll_rc_rate", VAR_UINT8 | PROFILE_RATE_VALUE, .config.minmax = { 0, 255 }, 12, 
+# 595 "./src/main/interface/settings.c" 3 4
+                                                                                                                                                        __builtin_offsetof (
+# 595 "./src/main/interface/settings.c"
+                                                                                                                                                        controlRateConfig_t
+# 595 "./src/main/interface/settings.c" 3 4
+                                                                                                                                                        , 
+# 595 "./src/main/interface/settings.c"
+                                                                                                                                                        rcRates[FD_ROLL]
+# 595 "./src/main/interface/settings.c" 3 4
+                                                                                                                                                        ) 
+# 595 "./src/main/interface/settings.c"
+                                                                                                                                                                                                        },
+    { "pitch_rc_rate", VAR_UINT8 | PROFILE_RATE_VALUE, .config.minmax = { 0, 255 }, 12, 
+# 596 "./src/main/interface/settings.c" 3 4
+                                                                                                                                                        __builtin_offsetof (
+# 596 "./src/main/interface/settings.c"
+                                                                                                                                                        controlRateConfig_t
+# 596 "./src/main/interface/settings.c" 3 4
+                                                                                                                                                        , 
+# 596 "./src/main/interface/settings.c"
+                                                                                                                                                        rcRates[FD_PITCH]
+# 596 "./src/main/interface/settings.c" 3 4
+                                                                                                                                                        ) 
+# 596 "./src/main/interface/settings.c"
+                                                                                                                                                                                                         },
+    { "yaw_rc_rate", VAR_UINT8 | PROFILE_RATE_VALUE, .config.minmax = { 0, 255 }, 12, 
+# 597 "./src/main/interface/settings.c" 3 4
+                                                                                                                                                        __builtin_offsetof (
+# 597 "./src/main/interface/settings.c"
+                                                                                                                                                        controlRateConfig_t
+# 597 "./src/main/interface/settings.c" 3 4
+                                                                                                                                                        , 
+# 597 "./src/main/interface/settings.c"
+                                                                                                                                                        rcRates[FD_YAW]
+# 597 "./src/main/interface/settings.c" 3 4
+                                                                                                                                                        ) 
+# 597 "./src/main/interface/settings.c"
+                                                                                                                                                                                                       },
+    { "roll_expo", VAR_UINT8 | PROFILE_RATE_VALUE, .config.minmax = { 0, 100 }, 12, 
+# 598 "./src/main/interface/settings.c" 3 4
+                                                                                                                                                       __builtin_offsetof (
+# 598 "./src/main/interface/settings.c"
+                                                                                                                                                       controlRateConfig_t
+# 598 "./src/main/interface/settings.c" 3 4
+                                                                                                                                                       , 
+# 598 "./src/main/interface/settings.c"
+                                                                                                                                                       rcExpo[FD_ROLL]
+# 598 "./src/main/interface/settings.c" 3 4
+                                                                                                                                                       ) 
+# 598 "./src/main/interface/settings.c"
+                                                                                                                                                                                                      },
+    { "pitch_expo", VAR_UINT8 | PROFILE_RATE_VALUE, .config.minmax = { 0, 100 }, 12, 
+# 599 "./src/main/interface/settings.c" 3 4
+                                                                                                                                                       __builtin_offsetof (
+# 599 "./src/main/interface/settings.c"
+                                                                                                                                                       controlRateConfig_t
+# 599 "./src/main/interface/settings.c" 3 4
+                                                                                                                                                       , 
+# 599 "./src/main/interface/settings.c"
+                                                                                                                                                       rcExpo[FD_PITCH]
+# 599 "./src/main/interface/settings.c" 3 4
+                                                                                                                                                       ) 
+# 599 "./src/main/interface/settings.c"
+                                                                                                                                                                                                       },
+    { "yaw_expo", VAR_UINT8 | PROFILE_RATE_VALUE, .config.minmax = { 0, 100 }, 12, 
+# 600 "./src/main/interface/settings.c" 3 4
+                                                                                                                                                       __builtin_offsetof (
+# 600 "./src/main/interface/settings.c"
+                                                                                                                                                       controlRateConfig_t
+# 600 "./src/main/interface/settings.c" 3 4
+                                                                                                                                                       , 
+# 600 "./src/main/interface/settings.c"
+                                                                                                                                                       rcExpo[FD_YAW]
+# 600 "./src/main/interface/settings.c" 3 4
+                                                                                                                                                       ) 
+# 600 "./src/main/interface/settings.c"
+                                                                                                                                                                                                     },
+    { "roll_srate", VAR_UINT8 | PROFILE_RATE_VALUE, .config.minmax = { 0, 255 }, 12, 
+# 601 "./src/main/interface/settings.c" 3 4
+                                                                                                                                                    __builtin_offsetof (
+# 601 "./src/main/interface/settings.c"
+                                                                                                                                                    controlRateConfig_t
+# 601 "./src/main/interface/settings.c" 3 4
+                                                                                                                                                    , 
+# 601 "./src/main/interface/settings.c"
+                                                                                                                                                    rates[FD_ROLL]
+# 601 "./src/main/interface/settings.c" 3 4
+                                                                                                                                                    ) 
+# 601 "./src/main/interface/settings.c"
+                                                                                                                                                                                                  },
+    { "pitch_srate", VAR_UINT8 | PROFILE_RATE_VALUE, .config.minmax = { 0, 255 }, 12, 
+# 602 "./src/main/interface/settings.c" 3 4
+                                                                                                                                                    __builtin_offsetof (
+# 602 "./src/main/interface/settings.c"
+                                                                                                                                                    controlRateConfig_t
+# 602 "./src/main/interface/settings.c" 3 4
+                                                                                                                                                    , 
+# 602 "./src/main/interface/settings.c"
+                                                                                                                                                    rates[FD_PITCH]
+# 602 "./src/main/interface/settings.c" 3 4
+                                                                                                                                                    ) 
+# 602 "./src/main/interface/settings.c"
+                                                                                                                                                                                                   },
+    { "yaw_srate", VAR_UINT8 | PROFILE_RATE_VALUE, .config.minmax = { 0, 255 }, 12, 
+# 603 "./src/main/interface/settings.c" 3 4
+                                                                                                                                                    __builtin_offsetof (
+# 603 "./src/main/interface/settings.c"
+                                                                                                                                                    controlRateConfig_t
+# 603 "./src/main/interface/settings.c" 3 4
+                                                                                                                                                    , 
+# 603 "./src/main/interface/settings.c"
+                                                                                                                                                    rates[FD_YAW]
+# 603 "./src/main/interface/settings.c" 3 4
+                                                                                                                                                    ) 
+# 603 "./src/main/interface/settings.c"
+                                                                                                                                                                                                 },
+    { "tpa_rate", VAR_UINT8 | PROFILE_RATE_VALUE, .config.minmax = { 0, 100}, 12, 
+# 604 "./src/main/interface/settings.c" 3 4
+                                                                                                                                                  __builtin_offsetof (
+# 604 "./src/main/interface/settings.c"
+                                                                                                                                                  controlRateConfig_t
+# 604 "./src/main/interface/settings.c" 3 4
+                                                                                                                                                  , 
+# 604 "./src/main/interface/settings.c"
+                                                                                                                                                  dynThrPID
+# 604 "./src/main/interface/settings.c" 3 4
+                                                                                                                                                  ) 
+# 604 "./src/main/interface/settings.c"
+                                                                                                                                                                                           },
+    { "tpa_breakpoint", VAR_UINT16 | PROFILE_RATE_VALUE, .config.minmax = { 750, 2250 }, 12, 
+# 605 "./src/main/interface/settings.c" 3 4
+                                                                                                                                                 __builtin_offsetof (
+# 605 "./src/main/interface/settings.c"
+                                                                                                                                                 controlRateConfig_t
+# 605 "./src/main/interface/settings.c" 3 4
+                                                                                                                                                 , 
+# 605 "./src/main/interface/settings.c"
+                                                                                                                                                 tpa_breakpoint
+# 605 "./src/main/interface/settings.c" 3 4
+                                                                                                                                                 ) 
+# 605 "./src/main/interface/settings.c"
+                                                                                                                                                                                               },
+
+
+    { "reboot_character", VAR_UINT8 | MASTER_VALUE, .config.minmax = { 48, 126 }, 13, 
+# 608 "./src/main/interface/settings.c" 3 4
+                                                                                                              __builtin_offsetof (
+# 608 "./src/main/interface/settings.c"
+                                                                                                              serialConfig_t
+# 608 "./src/main/interface/settings.c" 3 4
+                                                                                                              , 
+# 608 "./src/main/interface/settings.c"
+                                                                                                              reboot_character
+# 608 "./src/main/interface/settings.c" 3 4
+                                                                                                              ) 
+# 608 "./src/main/interface/settings.c"
+                                                                                                                                                         },
+    { "serial_update_rate_hz", VAR_UINT16 | MASTER_VALUE, .config.minmax = { 100, 2000 }, 13, 
+# 609 "./src/main/interface/settings.c" 3 4
+                                                                                                                __builtin_offsetof (
+# 609 "./src/main/interface/settings.c"
+                                                                                                                serialConfig_t
+# 609 "./src/main/interface/settings.c" 3 4
+                                                                                                                , 
+# 609 "./src/main/interface/settings.c"
+                                                                                                                serial_update_rate_hz
+# 609 "./src/main/interface/settings.c" 3 4
+                                                                                                                ) 
+# 609 "./src/main/interface/settings.c"
+                                                                                                                                                                },
+
+
+    { "accxy_deadband", VAR_UINT8 | MASTER_VALUE, .config.minmax = { 0, 100 }, 22, 
+# 612 "./src/main/interface/settings.c" 3 4
+                                                                                                          __builtin_offsetof (
+# 612 "./src/main/interface/settings.c"
+                                                                                                          imuConfig_t
+# 612 "./src/main/interface/settings.c" 3 4
+                                                                                                          , 
+# 612 "./src/main/interface/settings.c"
+                                                                                                          accDeadband.xy
+# 612 "./src/main/interface/settings.c" 3 4
+                                                                                                          ) 
+# 612 "./src/main/interface/settings.c"
+                                                                                                                                                },
+    { "accz_deadband", VAR_UINT8 | MASTER_VALUE, .config.minmax = { 0, 100 }, 22, 
+# 613 "./src/main/interface/settings.c" 3 4
+                                                                                                          __builtin_offsetof (
+# 613 "./src/main/interface/settings.c"
+                                                                                                          imuConfig_t
+# 613 "./src/main/interface/settings.c" 3 4
+                                                                                                          , 
+# 613 "./src/main/interface/settings.c"
+                                                                                                          accDeadband.z
+# 613 "./src/main/interface/settings.c" 3 4
+                                                                                                          ) 
+# 613 "./src/main/interface/settings.c"
+                                                                                                                                               },
+    { "acc_unarmedcal", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 22, 
+# 614 "./src/main/interface/settings.c" 3 4
+                                                                                                                              __builtin_offsetof (
+# 614 "./src/main/interface/settings.c"
+                                                                                                                              imuConfig_t
+# 614 "./src/main/interface/settings.c" 3 4
+                                                                                                                              , 
+# 614 "./src/main/interface/settings.c"
+                                                                                                                              acc_unarmedcal
+# 614 "./src/main/interface/settings.c" 3 4
+                                                                                                                              ) 
+# 614 "./src/main/interface/settings.c"
+                                                                                                                                                                    },
+    { "imu_dcm_kp", VAR_UINT16 | MASTER_VALUE, .config.minmax = { 0, 32000 }, 22, 
+# 615 "./src/main/interface/settings.c" 3 4
+                                                                                                            __builtin_offsetof (
+# 615 "./src/main/interface/settings.c"
+                                                                                                            imuConfig_t
+# 615 "./src/main/interface/settings.c" 3 4
+                                                                                                            , 
+# 615 "./src/main/interface/settings.c"
+                                                                                                            dcm_kp
+# 615 "./src/main/interface/settings.c" 3 4
+                                                                                                            ) 
+# 615 "./src/main/interface/settings.c"
+                                                                                                                                          },
+    { "imu_dcm_ki", VAR_UINT16 | MASTER_VALUE, .config.minmax = { 0, 32000 }, 22, 
+# 616 "./src/main/interface/settings.c" 3 4
+                                                                                                            __builtin_offsetof (
+# 616 "./src/main/interface/settings.c"
+                                                                                                            imuConfig_t
+# 616 "./src/main/interface/settings.c" 3 4
+                                                                                                            , 
+# 616 "./src/main/interface/settings.c"
+                                                                                                            dcm_ki
+# 616 "./src/main/interface/settings.c" 3 4
+                                                                                                            ) 
+# 616 "./src/main/interface/settings.c"
+                                                                                                                                          },
+    { "imu_gyro_rate_integration", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 22, 
+# 617 "./src/main/interface/settings.c" 3 4
+                                                                                                                              __builtin_offsetof (
+# 617 "./src/main/interface/settings.c"
+                                                                                                                              imuConfig_t
+# 617 "./src/main/interface/settings.c" 3 4
+                                                                                                                              , 
+# 617 "./src/main/interface/settings.c"
+                                                                                                                              gyro_rate_integration
+# 617 "./src/main/interface/settings.c" 3 4
+                                                                                                                              ) 
+# 617 "./src/main/interface/settings.c"
+                                                                                                                                                                           },
+    { "small_angle", VAR_UINT8 | MASTER_VALUE, .config.minmax = { 0, 180 }, 22, 
+# 618 "./src/main/interface/settings.c" 3 4
+                                                                                                          __builtin_offsetof (
+# 618 "./src/main/interface/settings.c"
+                                                                                                          imuConfig_t
+# 618 "./src/main/interface/settings.c" 3 4
+                                                                                                          , 
+# 618 "./src/main/interface/settings.c"
+                                                                                                          small_angle
+# 618 "./src/main/interface/settings.c" 3 4
+                                                                                                          ) 
+# 618 "./src/main/interface/settings.c"
+                                                                                                                                             },
+
+
+    { "auto_disarm_delay", VAR_UINT8 | MASTER_VALUE, .config.minmax = { 0, 60 }, 16, 
+# 621 "./src/main/interface/settings.c" 3 4
+                                                                                                            __builtin_offsetof (
+# 621 "./src/main/interface/settings.c"
+                                                                                                            armingConfig_t
+# 621 "./src/main/interface/settings.c" 3 4
+                                                                                                            , 
+# 621 "./src/main/interface/settings.c"
+                                                                                                            auto_disarm_delay
+# 621 "./src/main/interface/settings.c" 3 4
+                                                                                                            ) 
+# 621 "./src/main/interface/settings.c"
+                                                                                                                                                        },
+    { "gyro_cal_on_first_arm", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 16, 
+# 622 "./src/main/interface/settings.c" 3 4
+                                                                                                                                 __builtin_offsetof (
+# 622 "./src/main/interface/settings.c"
+                                                                                                                                 armingConfig_t
+# 622 "./src/main/interface/settings.c" 3 4
+                                                                                                                                 , 
+# 622 "./src/main/interface/settings.c"
+                                                                                                                                 gyro_cal_on_first_arm
+# 622 "./src/main/interface/settings.c" 3 4
+                                                                                                                                 ) 
+# 622 "./src/main/interface/settings.c"
+                                                                                                                                                                                 },
+
+
+
+
+    { "gps_provider", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_GPS_PROVIDER }, 30, 
+# 627 "./src/main/interface/settings.c" 3 4
+                                                                                                                                    __builtin_offsetof (
+# 627 "./src/main/interface/settings.c"
+                                                                                                                                    gpsConfig_t
+# 627 "./src/main/interface/settings.c" 3 4
+                                                                                                                                    , 
+# 627 "./src/main/interface/settings.c"
+                                                                                                                                    provider
+# 627 "./src/main/interface/settings.c" 3 4
+                                                                                                                                    ) 
+# 627 "./src/main/interface/settings.c"
+                                                                                                                                                                    },
+    { "gps_sbas_mode", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_GPS_SBAS_MODE }, 30, 
+# 628 "./src/main/interface/settings.c" 3 4
+                                                                                                                                     __builtin_offsetof (
+# 628 "./src/main/interface/settings.c"
+                                                                                                                                     gpsConfig_t
+# 628 "./src/main/interface/settings.c" 3 4
+                                                                                                                                     , 
+# 628 "./src/main/interface/settings.c"
+                                                                                                                                     sbasMode
+# 628 "./src/main/interface/settings.c" 3 4
+                                                                                                                                     ) 
+# 628 "./src/main/interface/settings.c"
+                                                                                                                                                                     },
+    { "gps_auto_config", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 30, 
+# 629 "./src/main/interface/settings.c" 3 4
+                                                                                                                              __builtin_offsetof (
+# 629 "./src/main/interface/settings.c"
+                                                                                                                              gpsConfig_t
+# 629 "./src/main/interface/settings.c" 3 4
+                                                                                                                              , 
+# 629 "./src/main/interface/settings.c"
+                                                                                                                              autoConfig
+# 629 "./src/main/interface/settings.c" 3 4
+                                                                                                                              ) 
+# 629 "./src/main/interface/settings.c"
+                                                                                                                                                                },
+    { "gps_auto_baud", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 30, 
+# 630 "./src/main/interface/settings.c" 3 4
+                                                                                                                              __builtin_offsetof (
+# 630 "./src/main/interface/settings.c"
+                                                                                                                              gpsConfig_t
+# 630 "./src/main/interface/settings.c" 3 4
+                                                                                                                              , 
+# 630 "./src/main/interface/settings.c"
+                                                                                                                              autoBaud
+# 630 "./src/main/interface/settings.c" 3 4
+                                                                                                                              ) 
+# 630 "./src/main/interface/settings.c"
+                                                                                                                                                              },
+
+
+
+
+    { "gps_wp_radius", VAR_UINT16 | MASTER_VALUE, .config.minmax = { 0, 2000 }, 34, 
+# 635 "./src/main/interface/settings.c" 3 4
+                                                                                                                  __builtin_offsetof (
+# 635 "./src/main/interface/settings.c"
+                                                                                                                  navigationConfig_t
+# 635 "./src/main/interface/settings.c" 3 4
+                                                                                                                  , 
+# 635 "./src/main/interface/settings.c"
+                                                                                                                  gps_wp_radius
+# 635 "./src/main/interface/settings.c" 3 4
+                                                                                                                  ) 
+# 635 "./src/main/interface/settings.c"
+                                                                                                                                                              },
+    { "nav_controls_heading", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 34, 
+# 636 "./src/main/interface/settings.c" 3 4
+                                                                                                                                     __builtin_offsetof (
+# 636 "./src/main/interface/settings.c"
+                                                                                                                                     navigationConfig_t
+# 636 "./src/main/interface/settings.c" 3 4
+                                                                                                                                     , 
+# 636 "./src/main/interface/settings.c"
+                                                                                                                                     nav_controls_heading
+# 636 "./src/main/interface/settings.c" 3 4
+                                                                                                                                     ) 
+# 636 "./src/main/interface/settings.c"
+                                                                                                                                                                                        },
+    { "nav_speed_min", VAR_UINT16 | MASTER_VALUE, .config.minmax = { 10, 2000 }, 34, 
+# 637 "./src/main/interface/settings.c" 3 4
+                                                                                                                   __builtin_offsetof (
+# 637 "./src/main/interface/settings.c"
+                                                                                                                   navigationConfig_t
+# 637 "./src/main/interface/settings.c" 3 4
+                                                                                                                   , 
+# 637 "./src/main/interface/settings.c"
+                                                                                                                   nav_speed_min
+# 637 "./src/main/interface/settings.c" 3 4
+                                                                                                                   ) 
+# 637 "./src/main/interface/settings.c"
+                                                                                                                                                               },
+    { "nav_speed_max", VAR_UINT16 | MASTER_VALUE, .config.minmax = { 10, 2000 }, 34, 
+# 638 "./src/main/interface/settings.c" 3 4
+                                                                                                                   __builtin_offsetof (
+# 638 "./src/main/interface/settings.c"
+                                                                                                                   navigationConfig_t
+# 638 "./src/main/interface/settings.c" 3 4
+                                                                                                                   , 
+# 638 "./src/main/interface/settings.c"
+                                                                                                                   nav_speed_max
+# 638 "./src/main/interface/settings.c" 3 4
+                                                                                                                   ) 
+# 638 "./src/main/interface/settings.c"
+                                                                                                                                                               },
+    { "nav_slew_rate", VAR_UINT8 | MASTER_VALUE, .config.minmax = { 0, 100 }, 34, 
+# 639 "./src/main/interface/settings.c" 3 4
+                                                                                                                 __builtin_offsetof (
+# 639 "./src/main/interface/settings.c"
+                                                                                                                 navigationConfig_t
+# 639 "./src/main/interface/settings.c" 3 4
+                                                                                                                 , 
+# 639 "./src/main/interface/settings.c"
+                                                                                                                 nav_slew_rate
+# 639 "./src/main/interface/settings.c" 3 4
+                                                                                                                 ) 
+# 639 "./src/main/interface/settings.c"
+                                                                                                                                                             },
+
+
+
+
+    { "fixedwing_althold_reversed", VAR_INT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 29, 
+# 644 "./src/main/interface/settings.c" 3 4
+                                                                                                                                   __builtin_offsetof (
+# 644 "./src/main/interface/settings.c"
+                                                                                                                                   airplaneConfig_t
+# 644 "./src/main/interface/settings.c" 3 4
+                                                                                                                                   , 
+# 644 "./src/main/interface/settings.c"
+                                                                                                                                   fixedwing_althold_reversed
+# 644 "./src/main/interface/settings.c" 3 4
+                                                                                                                                   ) 
+# 644 "./src/main/interface/settings.c"
+                                                                                                                                                                                          },
+
+
+
+
+    { "alt_hold_hover_throttle", VAR_UINT16 | MASTER_VALUE, .config.minmax = { 1000, 2000 }, 533, 
+# 649 "./src/main/interface/settings.c" 3 4
+                                                                                                                                     __builtin_offsetof (
+# 649 "./src/main/interface/settings.c"
+                                                                                                                                     altHoldConfig_t
+# 649 "./src/main/interface/settings.c" 3 4
+                                                                                                                                     , 
+# 649 "./src/main/interface/settings.c"
+                                                                                                                                     hover_throttle
+# 649 "./src/main/interface/settings.c" 3 4
+                                                                                                                                     ) 
+# 649 "./src/main/interface/settings.c"
+                                                                                                                                                                               },
+    { "alt_hold_hover_learn", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 533, 
+# 650 "./src/main/interface/settings.c" 3 4
+                                                                                                                                   __builtin_offsetof (
+# 650 "./src/main/interface/settings.c"
+                                                                                                                                   altHoldConfig_t
+# 650 "./src/main/interface/settings.c" 3 4
+                                                                                                                                   , 
+# 650 "./src/main/interface/settings.c"
+                                                                                                                                   hover_learn
+# 650 "./src/main/interface/settings.c" 3 4
+                                                                                                                                   ) 
+# 650 "./src/main/interface/settings.c"
+                                                                                                                                                                          },
+    { "alt_hold_throttle_min", VAR_UINT16 | MASTER_VALUE, .config.minmax = { 1000, 2000 }, 533, 
+# 651 "./src/main/interface/settings.c" 3 4
+                                                                                                                                     __builtin_offsetof (
+# 651 "./src/main/interface/settings.c"
+                                                                                                                                     altHoldConfig_t
+# 651 "./src/main/interface/settings.c" 3 4
+                                                                                                                                     , 
+# 651 "./src/main/interface/settings.c"
+                                                                                                                                     throttle_min
+# 651 "./src/main/interface/settings.c" 3 4
+                                                                                                                                     ) 
+# 651 "./src/main/interface/settings.c"
+                                                                                                                                                                             },
+    { "alt_hold_throttle_max", VAR_UINT16 | MASTER_VALUE, .config.minmax = { 1000, 2000 }, 533, 
+# 652 "./src/main/interface/settings.c" 3 4
+                                                                                                                                     __builtin_offsetof (
+# 652 "./src/main/interface/settings.c"
+                                                                                                                                     altHoldConfig_t
+# 652 "./src/main/interface/settings.c" 3 4
+                                                                                                                                     , 
+# 652 "./src/main/interface/settings.c"
+                                                                                                                                     throttle_max
+# 652 "./src/main/interface/settings.c" 3 4
+                                                                                                                                     ) 
+# 652 "./src/main/interface/settings.c"
+                                                                                                                                                                             },
+    { "alt_hold_max_climb_rate", VAR_UINT16 | MASTER_VALUE, .config.minmax = { 10, 1000 }, 533, 
+# 653 "./src/main/interface/settings.c" 3 4
+                                                                                                                 __builtin_offsetof (
+# 653 "./src/main/interface/settings.c"
+                                                                                                                 altHoldConfig_t
+# 653 "./src/main/interface/settings.c" 3 4
+                                                                                                                 , 
+# 653 "./src/main/interface/settings.c"
+                                                                                                                 max_climb_rate
+# 653 "./src/main/interface/settings.c" 3 4
+                                                                                                                 ) 
+# 653 "./src/main/interface/settings.c"
+                                                                                                                                                           },
+    { "alt_hold_max_descent_rate", VAR_UINT16 | MASTER_VALUE, .config.minmax = { 10, 1000 }, 533, 
+# 654 "./src/main/interface/settings.c" 3 4
+                                                                                                                 __builtin_offsetof (
+# 654 "./src/main/interface/settings.c"
+                                                                                                                 altHoldConfig_t
+# 654 "./src/main/interface/settings.c" 3 4
+                                                                                                                 , 
+# 654 "./src/main/interface/settings.c"
+                                                                                                                 max_descent_rate
+# 654 "./src/main/interface/settings.c" 3 4
+                                                                                                                 ) 
+# 654 "./src/main/interface/settings.c"
+                                                                                                                                                             },
+
+
+
+
+    { "alt_hold_deadband", VAR_UINT8 | MASTER_VALUE, .config.minmax = { 1, 250 }, 25, 
+# 659 "./src/main/interface/settings.c" 3 4
+                                                                                                                  __builtin_offsetof (
+# 659 "./src/main/interface/settings.c"
+                                                                                                                  rcControlsConfig_t
+# 659 "./src/main/interface/settings.c" 3 4
+                                                                                                                  , 
+# 659 "./src/main/interface/settings.c"
+                                                                                                                  alt_hold_deadband
+# 659 "./src/main/interface/settings.c" 3 4
+                                                                                                                  ) 
+# 659 "./src/main/interface/settings.c"
+                                                                                                                                                                  },
+    { "alt_hold_fast_change", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 25, 
+# 660 "./src/main/interface/settings.c" 3 4
+                                                                                                                                      __builtin_offsetof (
+# 660 "./src/main/interface/settings.c"
+                                                                                                                                      rcControlsConfig_t
+# 660 "./src/main/interface/settings.c" 3 4
+                                                                                                                                      , 
+# 660 "./src/main/interface/settings.c"
+                                                                                                                                      alt_hold_fast_change
+# 660 "./src/main/interface/settings.c" 3 4
+                                                                                                                                      ) 
+# 660 "./src/main/interface/settings.c"
+                                                                                                                                                                                         },
+
+    { "deadband", VAR_UINT8 | MASTER_VALUE, .config.minmax = { 0, 32 }, 25, 
+# 662 "./src/main/interface/settings.c" 3 4
+                                                                                                                 __builtin_offsetof (
+# 662 "./src/main/interface/settings.c"
+                                                                                                                 rcControlsConfig_t
+# 662 "./src/main/interface/settings.c" 3 4
+                                                                                                                 , 
+# 662 "./src/main/interface/settings.c"
+                                                                                                                 deadband
+# 662 "./src/main/interface/settings.c" 3 4
+                                                                                                                 ) 
+# 662 "./src/main/interface/settings.c"
+                                                                                                                                                        },
+    { "yaw_deadband", VAR_UINT8 | MASTER_VALUE, .config.minmax = { 0, 100 }, 25, 
+# 663 "./src/main/interface/settings.c" 3 4
+                                                                                                                  __builtin_offsetof (
+# 663 "./src/main/interface/settings.c"
+                                                                                                                  rcControlsConfig_t
+# 663 "./src/main/interface/settings.c" 3 4
+                                                                                                                  , 
+# 663 "./src/main/interface/settings.c"
+                                                                                                                  yaw_deadband
+# 663 "./src/main/interface/settings.c" 3 4
+                                                                                                                  ) 
+# 663 "./src/main/interface/settings.c"
+                                                                                                                                                             },
+    { "yaw_control_reversed", VAR_INT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 25, 
+# 664 "./src/main/interface/settings.c" 3 4
+                                                                                                                                      __builtin_offsetof (
+# 664 "./src/main/interface/settings.c"
+                                                                                                                                      rcControlsConfig_t
+# 664 "./src/main/interface/settings.c" 3 4
+                                                                                                                                      , 
+# 664 "./src/main/interface/settings.c"
+                                                                                                                                      yaw_control_reversed
+# 664 "./src/main/interface/settings.c" 3 4
+                                                                                                                                      ) 
+# 664 "./src/main/interface/settings.c"
+                                                                                                                                                                                         },
+
+
+    { "pid_process_denom", VAR_UINT8 | MASTER_VALUE, .config.minmax = { 1, 16 }, 504, 
+# 667 "./src/main/interface/settings.c" 3 4
+                                                                                                                             __builtin_offsetof (
+# 667 "./src/main/interface/settings.c"
+                                                                                                                             pidConfig_t
+# 667 "./src/main/interface/settings.c" 3 4
+                                                                                                                             , 
+# 667 "./src/main/interface/settings.c"
+                                                                                                                             pid_process_denom
+# 667 "./src/main/interface/settings.c" 3 4
+                                                                                                                             ) 
+# 667 "./src/main/interface/settings.c"
+                                                                                                                                                                      },
+
+    { "runaway_takeoff_prevention", VAR_UINT8 | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 504, 
+# 669 "./src/main/interface/settings.c" 3 4
+                                                                                                                __builtin_offsetof (
+# 669 "./src/main/interface/settings.c"
+                                                                                                                pidConfig_t
+# 669 "./src/main/interface/settings.c" 3 4
+                                                                                                                , 
+# 669 "./src/main/interface/settings.c"
+                                                                                                                runaway_takeoff_prevention
+# 669 "./src/main/interface/settings.c" 3 4
+                                                                                                                ) 
+# 669 "./src/main/interface/settings.c"
+                                                                                                                                                                  },
+    { "runaway_takeoff_deactivate_delay", VAR_UINT16 | MASTER_VALUE, .config.minmax = { 100, 1000 }, 504, 
+# 670 "./src/main/interface/settings.c" 3 4
+                                                                                                                     __builtin_offsetof (
+# 670 "./src/main/interface/settings.c"
+                                                                                                                     pidConfig_t
+# 670 "./src/main/interface/settings.c" 3 4
+                                                                                                                     , 
+# 670 "./src/main/interface/settings.c"
+                                                                                                                     runaway_takeoff_deactivate_delay
+# 670 "./src/main/interface/settings.c" 3 4
+                                                                                                                     ) 
+# 670 "./src/main/interface/settings.c"
+                                                                                                                                                                             },
+    { "runaway_takeoff_deactivate_throttle_percent", VAR_UINT8 | MASTER_VALUE, .config.minmax = { 0, 100 }, 504, 
+# 671 "./src/main/interface/settings.c" 3 4
+                                                                                                                            __builtin_offsetof (
+# 671 "./src/main/interface/settings.c"
+                                                                                                                            pidConfig_t
+# 671 "./src/main/interface/settings.c" 3 4
+                                                                                                                            , 
+# 671 "./src/main/interface/settings.c"
+                                                                                                                            runaway_takeoff_deactivate_throttle
+# 671 "./src/main/interface/settings.c" 3 4
+                                                                                                                            ) 
+# 671 "./src/main/interface/settings.c"
+                                                                                                                                                                                       },
+
+
+
+    { "dterm_lowpass_type", VAR_UINT8 | PROFILE_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_LOWPASS_TYPE }, 14, 
+# 675 "./src/main/interface/settings.c" 3 4
+                                                                                                                                      __builtin_offsetof (
+# 675 "./src/main/interface/settings.c"
+                                                                                                                                      pidProfile_t
+# 675 "./src/main/interface/settings.c" 3 4
+                                                                                                                                      , 
+# 675 "./src/main/interface/settings.c"
+                                                                                                                                      dterm_filter_type
+# 675 "./src/main/interface/settings.c" 3 4
+                                                                                                                                      ) 
+# 675 "./src/main/interface/settings.c"
+                                                                                                                                                                                },
+    { "dterm_lowpass", VAR_INT16 | PROFILE_VALUE, .config.minmax = { 0, 16000 }, 14, 
+# 676 "./src/main/interface/settings.c" 3 4
+                                                                                                              __builtin_offsetof (
+# 676 "./src/main/interface/settings.c"
+                                                                                                              pidProfile_t
+# 676 "./src/main/interface/settings.c" 3 4
+                                                                                                              , 
+# 676 "./src/main/interface/settings.c"
+                                                                                                              dterm_lpf_hz
+# 676 "./src/main/interface/settings.c" 3 4
+                                                                                                              ) 
+# 676 "./src/main/interface/settings.c"
+                                                                                                                                                   },
+    { "dterm_notch_hz", VAR_UINT16 | PROFILE_VALUE, .config.minmax = { 0, 16000 }, 14, 
+# 677 "./src/main/interface/settings.c" 3 4
+                                                                                                              __builtin_offsetof (
+# 677 "./src/main/interface/settings.c"
+                                                                                                              pidProfile_t
+# 677 "./src/main/interface/settings.c" 3 4
+                                                                                                              , 
+# 677 "./src/main/interface/settings.c"
+                                                                                                              dterm_notch_hz
+# 677 "./src/main/interface/settings.c" 3 4
+                                                                                                              ) 
+# 677 "./src/main/interface/settings.c"
+                                                                                                                                                     },
+    { "dterm_notch_cutoff", VAR_UINT16 | PROFILE_VALUE, .config.minmax = { 0, 16000 }, 14, 
+# 678 "./src/main/interface/settings.c" 3 4
+                                                                                                              __builtin_offsetof (
+# 678 "./src/main/interface/settings.c"
+                                                                                                              pidProfile_t
+# 678 "./src/main/interface/settings.c" 3 4
+                                                                                                              , 
+# 678 "./src/main/interface/settings.c"
+                                                                                                              dterm_notch_cutoff
+# 678 "./src/main/interface/settings.c" 3 4
+                                                                                                              ) 
+# 678 "./src/main/interface/settings.c"
+                                                                                                                                                         },
+    { "vbat_pid_gain", VAR_UINT8 | PROFILE_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 14, 
+# 679 "./src/main/interface/settings.c" 3 4
+                                                                                                                                __builtin_offsetof (
+# 679 "./src/main/interface/settings.c"
+                                                                                                                                pidProfile_t
+# 679 "./src/main/interface/settings.c" 3 4
+                                                                                                                                , 
+# 679 "./src/main/interface/settings.c"
+                                                                                                                                vbatPidCompensation
+# 679 "./src/main/interface/settings.c" 3 4
+                                                                                                                                ) 
+# 679 "./src/main/interface/settings.c"
+                                                                                                                                                                            },
+    { "pid_at_min_throttle", VAR_UINT8 | PROFILE_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 14, 
+# 680 "./src/main/interface/settings.c" 3 4
+                                                                                                                                __builtin_offsetof (
+# 680 "./src/main/interface/settings.c"
+                                                                                                                                pidProfile_t
+# 680 "./src/main/interface/settings.c" 3 4
+                                                                                                                                , 
+# 680 "./src/main/interface/settings.c"
+                                                                                                                                pidAtMinThrottle
+# 680 "./src/main/interface/settings.c" 3 4
+                                                                                                                                ) 
+# 680 "./src/main/interface/settings.c"
+                                                                                                                                                                         },
+    { "anti_gravity_threshold", VAR_UINT16 | PROFILE_VALUE, .config.minmax = { 20, 1000 }, 14, 
+# 681 "./src/main/interface/settings.c" 3 4
+                                                                                                              __builtin_offsetof (
+# 681 "./src/main/interface/settings.c"
+                                                                                                              pidProfile_t
+# 681 "./src/main/interface/settings.c" 3 4
+                                                                                                              , 
+# 681 "./src/main/interface/settings.c"
+                                                                                                              itermThrottleThreshold
+# 681 "./src/main/interface/settings.c" 3 4
+                                                                                                              ) 
+# 681 "./src/main/interface/settings.c"
+                                                                                                                                                             },
+    { "anti_gravity_gain", VAR_UINT16 | PROFILE_VALUE, .config.minmax = { 1000, 30000 }, 14, 
+# 682 "./src/main/interface/settings.c" 3 4
+                                                                                                                 __builtin_offsetof (
+# 682 "./src/main/interface/settings.c"
+                                                                                                                 pidProfile_t
+# 682 "./src/main/interface/settings.c" 3 4
+                                                                                                                 , 
+# 682 "./src/main/interface/settings.c"
+                                                                                                                 itermAcceleratorGain
+# 682 "./src/main/interface/settings.c" 3 4
+                                                                                                                 ) 
+# 682 "./src/main/interface/settings.c"
+                                                                                                                                                              },
+    { "setpoint_relax_ratio", VAR_UINT8 | PROFILE_VALUE, .config.minmax = { 0, 100 }, 14, 
+# 683 "./src/main/interface/settings.c" 3 4
+                                                                                                            __builtin_offsetof (
+# 683 "./src/main/interface/settings.c"
+                                                                                                            pidProfile_t
+# 683 "./src/main/interface/settings.c" 3 4
+                                                                                                            , 
+# 683 "./src/main/interface/settings.c"
+                                                                                                            setpointRelaxRatio
+# 683 "./src/main/interface/settings.c" 3 4
+                                                                                                            ) 
+# 683 "./src/main/interface/settings.c"
+                                                                                                                                                       },
+    { "dterm_setpoint_weight", VAR_UINT8 | PROFILE_VALUE, .config.minmax = { 0, 254 }, 14, 
+# 684 "./src/main/interface/settings.c" 3 4
+                                                                                                            __builtin_offsetof (
+# 684 "./src/main/interface/settings.c"
+                                                                                                            pidProfile_t
+# 684 "./src/main/interface/settings.c" 3 4
+                                                                                                            , 
+# 684 "./src/main/interface/settings.c"
+                                                                                                            dtermSetpointWeight
+# 684 "./src/main/interface/settings.c" 3 4
+                                                                                                            ) 
+# 684 "./src/main/interface/settings.c"
+                                                                                                                                                        },
+    { "acc_limit_yaw", VAR_UINT16 | PROFILE_VALUE, .config.minmax = { 0, 500 }, 14, 
+# 685 "./src/main/interface/settings.c" 3 4
+                                                                                                            __builtin_offsetof (
+# 685 "./src/main/interface/settings.c"
+                                                                                                            pidProfile_t
+# 685 "./src/main/interface/settings.c" 3 4
+                                                                                                            , 
+# 685 "./src/main/interface/settings.c"
+                                                                                                            yawRateAccelLimit
+# 685 "./src/main/interface/settings.c" 3 4
+                                                                                                            ) 
+# 685 "./src/main/interface/settings.c"
+                                                                                                                                                      },
+    { "acc_limit", VAR_UINT16 | PROFILE_VALUE, .config.minmax = { 0, 500 }, 14, 
+# 686 "./src/main/interface/settings.c" 3 4
+                                                                                                            __builtin_offsetof (
+# 686 "./src/main/interface/settings.c"
+                                                                                                            pidProfile_t
+# 686 "./src/main/interface/settings.c" 3 4
+                                                                                                            , 
+# 686 "./src/main/interface/settings.c"
+                                                                                                            rateAccelLimit
+# 686 "./src/main/interface/settings.c" 3 4
+                                                                                                            ) 
+# 686 "./src/main/interface/settings.c"
+                                                                                                                                                   },
+    { "crash_dthreshold", VAR_UINT16 | PROFILE_VALUE, .config.minmax = { 0, 2000 }, 14, 
+# 687 "./src/main/interface/settings.c" 3 4
+                                                                                                             __builtin_offsetof (
+# 687 "./src/main/interface/settings.c"
+                                                                                                             pidProfile_t
+# 687 "./src/main/interface/settings.c" 3 4
+                                                                                                             , 
+# 687 "./src/main/interface/settings.c"
+                                                                                                             crash_dthreshold
+# 687 "./src/main/interface/settings.c" 3 4
+                                                                                                             ) 
+# 687 "./src/main/interface/settings.c"
+                                                                                                                                                      },
+    { "crash_gthreshold", VAR_UINT16 | PROFILE_VALUE, .config.minmax = { 0, 2000 }, 14, 
+# 688 "./src/main/interface/settings.c" 3 4
+                                                                                                             __builtin_offsetof (
+# 688 "./src/main/interface/settings.c"
+                                                                                                             pidProfile_t
+# 688 "./src/main/interface/settings.c" 3 4
+                                                                                                             , 
+# 688 "./src/main/interface/settings.c"
+                                                                                                             crash_gthreshold
+# 688 "./src/main/interface/settings.c" 3 4
+                                                                                                             ) 
+# 688 "./src/main/interface/settings.c"
+                                                                                                                                                      },
+    { "crash_setpoint_threshold", VAR_UINT16 | PROFILE_VALUE, .config.minmax = { 0, 2000 }, 14, 
+# 689 "./src/main/interface/settings.c" 3 4
+                                                                                                             __builtin_offsetof (
+# 689 "./src/main/interface/settings.c"
+                                                                                                             pidProfile_t
+# 689 "./src/main/interface/settings.c" 3 4
+                                                                                                             , 
+# 689 "./src/main/interface/settings.c"
+                                                                                                             crash_setpoint_threshold
+# 689 "./src/main/interface/settings.c" 3 4
+                                                                                                             ) 
+# 689 "./src/main/interface/settings.c"
+                                                                                                                                                              },
+    { "crash_time", VAR_UINT16 | PROFILE_VALUE, .config.minmax = { 0, 5000 }, 14, 
+# 690 "./src/main/interface/settings.c" 3 4
+                                                                                                             __builtin_offsetof (
+# 690 "./src/main/interface/settings.c"
+                                                                                                             pidProfile_t
+# 690 "./src/main/interface/settings.c" 3 4
+                                                                                                             , 
+# 690 "./src/main/interface/settings.c"
+                                                                                                             crash_time
+# 690 "./src/main/interface/settings.c" 3 4
+                                                                                                             ) 
+# 690 "./src/main/interface/settings.c"
+                                                                                                                                                },
+    { "crash_delay", VAR_UINT16 | PROFILE_VALUE, .config.minmax = { 0, 500 }, 14, 
+# 691 "./src/main/interface/settings.c" 3 4
+                                                                                                            __builtin_offsetof (
+# 691 "./src/main/interface/settings.c"
+                                                                                                            pidProfile_t
+# 691 "./src/main/interface/settings.c" 3 4
+                                                                                                            , 
+# 691 "./src/main/interface/settings.c"
+                                                                                                            crash_delay
+# 691 "./src/main/interface/settings.c" 3 4
+                                                                                                            ) 
+# 691 "./src/main/interface/settings.c"
+                                                                                                                                                },
+    { "crash_recovery_angle", VAR_UINT8 | PROFILE_VALUE, .config.minmax = { 0, 30 }, 14, 
+# 692 "./src/main/interface/settings.c" 3 4
+                                                                                                           __builtin_offsetof (
+# 692 "./src/main/interface/settings.c"
+                                                                                                           pidProfile_t
+# 692 "./src/main/interface/settings.c" 3 4
+                                                                                                           , 
+# 692 "./src/main/interface/settings.c"
+                                                                                                           crash_recovery_angle
+# 692 "./src/main/interface/settings.c" 3 4
+                                                                                                           ) 
+# 692 "./src/main/interface/settings.c"
+                                                                                                                                                        },
+    { "crash_recovery_rate", VAR_UINT8 | PROFILE_VALUE, .config.minmax = { 0, 255 }, 14, 
+# 693 "./src/main/interface/settings.c" 3 4
+                                                                                                            __builtin_offsetof (
+# 693 "./src/main/interface/settings.c"
+                                                                                                            pidProfile_t
+# 693 "./src/main/interface/settings.c" 3 4
+                                                                                                            , 
+# 693 "./src/main/interface/settings.c"
+                                                                                                            crash_recovery_rate
+# 693 "./src/main/interface/settings.c" 3 4
+                                                                                                            ) 
+# 693 "./src/main/interface/settings.c"
+                                                                                                                                                        },
+    { "crash_limit_yaw", VAR_UINT16 | PROFILE_VALUE, .config.minmax = { 0, 1000 }, 14, 
+# 694 "./src/main/interface/settings.c" 3 4
+                                                                                                             __builtin_offsetof (
+# 694 "./src/main/interface/settings.c"
+                                                                                                             pidProfile_t
+# 694 "./src/main/interface/settings.c" 3 4
+                                                                                                             , 
+# 694 "./src/main/interface/settings.c"
+                                                                                                             crash_limit_yaw
+# 694 "./src/main/interface/settings.c" 3 4
+                                                                                                             ) 
+# 694 "./src/main/interface/settings.c"
+                                                                                                                                                     },
+    { "crash_recovery", VAR_UINT8 | PROFILE_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_CRASH_RECOVERY }, 14, 
+# 695 "./src/main/interface/settings.c" 3 4
+                                                                                                                                        __builtin_offsetof (
+# 695 "./src/main/interface/settings.c"
+                                                                                                                                        pidProfile_t
+# 695 "./src/main/interface/settings.c" 3 4
+                                                                                                                                        , 
+# 695 "./src/main/interface/settings.c"
+                                                                                                                                        crash_recovery
+# 695 "./src/main/interface/settings.c" 3 4
+                                                                                                                                        ) 
+# 695 "./src/main/interface/settings.c"
+                                                                                                                                                                               },
+
+    { "iterm_windup", VAR_UINT8 | PROFILE_VALUE, .config.minmax = { 30, 100 }, 14, 
+# 697 "./src/main/interface/settings.c" 3 4
+                                                                                                             __builtin_offsetof (
+# 697 "./src/main/interface/settings.c"
+                                                                                                             pidProfile_t
+# 697 "./src/main/interface/settings.c" 3 4
+                                                                                                             , 
+# 697 "./src/main/interface/settings.c"
+                                                                                                             itermWindupPointPercent
+# 697 "./src/main/interface/settings.c" 3 4
+                                                                                                             ) 
+# 697 "./src/main/interface/settings.c"
+                                                                                                                                                             },
+    { "iterm_limit", VAR_UINT16 | PROFILE_VALUE, .config.minmax = { 0, 500 }, 14, 
+# 698 "./src/main/interface/settings.c" 3 4
+                                                                                                            __builtin_offsetof (
+# 698 "./src/main/interface/settings.c"
+                                                                                                            pidProfile_t
+# 698 "./src/main/interface/settings.c" 3 4
+                                                                                                            , 
+# 698 "./src/main/interface/settings.c"
+                                                                                                            itermLimit
+# 698 "./src/main/interface/settings.c" 3 4
+                                                                                                            ) 
+# 698 "./src/main/interface/settings.c"
+                                                                                                                                               },
+    { "pidsum_limit", VAR_UINT16 | PROFILE_VALUE, .config.minmax = { 100, 1000 }, 14, 
+# 699 "./src/main/interface/settings.c" 3 4
+                                                                                                               __builtin_offsetof (
+# 699 "./src/main/interface/settings.c"
+                                                                                                               pidProfile_t
+# 699 "./src/main/interface/settings.c" 3 4
+                                                                                                               , 
+# 699 "./src/main/interface/settings.c"
+                                                                                                               pidSumLimit
+# 699 "./src/main/interface/settings.c" 3 4
+                                                                                                               ) 
+# 699 "./src/main/interface/settings.c"
+                                                                                                                                                   },
+    { "pidsum_limit_yaw", VAR_UINT16 | PROFILE_VALUE, .config.minmax = { 100, 1000 }, 14, 
+# 700 "./src/main/interface/settings.c" 3 4
+                                                                                                               __builtin_offsetof (
+# 700 "./src/main/interface/settings.c"
+                                                                                                               pidProfile_t
+# 700 "./src/main/interface/settings.c" 3 4
+                                                                                                               , 
+# 700 "./src/main/interface/settings.c"
+                                                                                                               pidSumLimitYaw
+# 700 "./src/main/interface/settings.c" 3 4
+                                                                                                               ) 
+# 700 "./src/main/interface/settings.c"
+                                                                                                                                                      },
+    { "yaw_lowpass", VAR_UINT16 | PROFILE_VALUE, .config.minmax = { 0, 500 }, 14, 
+# 701 "./src/main/interface/settings.c" 3 4
+                                                                                                            __builtin_offsetof (
+# 701 "./src/main/interface/settings.c"
+                                                                                                            pidProfile_t
+# 701 "./src/main/interface/settings.c" 3 4
+                                                                                                            , 
+# 701 "./src/main/interface/settings.c"
+                                                                                                            yaw_lpf_hz
+# 701 "./src/main/interface/settings.c" 3 4
+                                                                                                            ) 
+# 701 "./src/main/interface/settings.c"
+                                                                                                                                               },
+
+    { "p_pitch", VAR_UINT8 | PROFILE_VALUE, .config.minmax = { 0, 200 }, 14, 
+# 703 "./src/main/interface/settings.c" 3 4
+                                                                                                            __builtin_offsetof (
+# 703 "./src/main/interface/settings.c"
+                                                                                                            pidProfile_t
+# 703 "./src/main/interface/settings.c" 3 4
+                                                                                                            , 
+# 703 "./src/main/interface/settings.c"
+                                                                                                            pid[PID_PITCH].P
+# 703 "./src/main/interface/settings.c" 3 4
+                                                                                                            ) 
+# 703 "./src/main/interface/settings.c"
+                                                                                                                                                     },
+    { "i_pitch", VAR_UINT8 | PROFILE_VALUE, .config.minmax = { 0, 200 }, 14, 
+# 704 "./src/main/interface/settings.c" 3 4
+                                                                                                            __builtin_offsetof (
+# 704 "./src/main/interface/settings.c"
+                                                                                                            pidProfile_t
+# 704 "./src/main/interface/settings.c" 3 4
+                                                                                                            , 
+# 704 "./src/main/interface/settings.c"
+                                                                                                            pid[PID_PITCH].I
+# 704 "./src/main/interface/settings.c" 3 4
+                                                                                                            ) 
+# 704 "./src/main/interface/settings.c"
+                                                                                                                                                     },
+    { "d_pitch", VAR_UINT8 | PROFILE_VALUE, .config.minmax = { 0, 200 }, 14, 
+# 705 "./src/main/interface/settings.c" 3 4
+                                                                                                            __builtin_offsetof (
+# 705 "./src/main/interface/settings.c"
+                                                                                                            pidProfile_t
+# 705 "./src/main/interface/settings.c" 3 4
+                                                                                                            , 
+# 705 "./src/main/interface/settings.c"
+                                                                                                            pid[PID_PITCH].D
+# 705 "./src/main/interface/settings.c" 3 4
+                                                                                                            ) 
+# 705 "./src/main/interface/settings.c"
+                                                                                                                                                     },
+    { "p_roll", VAR_UINT8 | PROFILE_VALUE, .config.minmax = { 0, 200 }, 14, 
+# 706 "./src/main/interface/settings.c" 3 4
+                                                                                                            __builtin_offsetof (
+# 706 "./src/main/interface/settings.c"
+                                                                                                            pidProfile_t
+# 706 "./src/main/interface/settings.c" 3 4
+                                                                                                            , 
+# 706 "./src/main/interface/settings.c"
+                                                                                                            pid[PID_ROLL].P
+# 706 "./src/main/interface/settings.c" 3 4
+                                                                                                            ) 
+# 706 "./src/main/interface/settings.c"
+                                                                                                                                                    },
+    { "i_roll", VAR_UINT8 | PROFILE_VALUE, .config.minmax = { 0, 200 }, 14, 
+# 707 "./src/main/interface/settings.c" 3 4
+                                                                                                            __builtin_offsetof (
+# 707 "./src/main/interface/settings.c"
+                                                                                                            pidProfile_t
+# 707 "./src/main/interface/settings.c" 3 4
+                                                                                                            , 
+# 707 "./src/main/interface/settings.c"
+                                                                                                            pid[PID_ROLL].I
+# 707 "./src/main/interface/settings.c" 3 4
+                                                                                                            ) 
+# 707 "./src/main/interface/settings.c"
+                                                                                                                                                    },
+    { "d_roll", VAR_UINT8 | PROFILE_VALUE, .config.minmax = { 0, 200 }, 14, 
+# 708 "./src/main/interface/settings.c" 3 4
+                                                                                                            __builtin_offsetof (
+# 708 "./src/main/interface/settings.c"
+                                                                                                            pidProfile_t
+# 708 "./src/main/interface/settings.c" 3 4
+                                                                                                            , 
+# 708 "./src/main/interface/settings.c"
+                                                                                                            pid[PID_ROLL].D
+# 708 "./src/main/interface/settings.c" 3 4
+                                                                                                            ) 
+# 708 "./src/main/interface/settings.c"
+                                                                                                                                                    },
+    { "p_yaw", VAR_UINT8 | PROFILE_VALUE, .config.minmax = { 0, 200 }, 14, 
+# 709 "./src/main/interface/settings.c" 3 4
+                                                                                                            __builtin_offsetof (
+# 709 "./src/main/interface/settings.c"
+                                                                                                            pidProfile_t
+# 709 "./src/main/interface/settings.c" 3 4
+                                                                                                            , 
+# 709 "./src/main/interface/settings.c"
+                                                                                                            pid[PID_YAW].P
+# 709 "./src/main/interface/settings.c" 3 4
+                                                                                                            ) 
+# 709 "./src/main/interface/settings.c"
+                                                                                                                                                   },
+    { "i_yaw", VAR_UINT8 | PROFILE_VALUE, .config.minmax = { 0, 200 }, 14, 
+# 710 "./src/main/interface/settings.c" 3 4
+                                                                                                            __builtin_offsetof (
+# 710 "./src/main/interface/settings.c"
+                                                                                                            pidProfile_t
+# 710 "./src/main/interface/settings.c" 3 4
+                                                                                                            , 
+# 710 "./src/main/interface/settings.c"
+                                                                                                            pid[PID_YAW].I
+# 710 "./src/main/interface/settings.c" 3 4
+                                                                                                            ) 
+# 710 "./src/main/interface/settings.c"
+                                                                                                                                                   },
+    { "d_yaw", VAR_UINT8 | PROFILE_VALUE, .config.minmax = { 0, 200 }, 14, 
+# 711 "./src/main/interface/settings.c" 3 4
+                                                                                                            __builtin_offsetof (
+# 711 "./src/main/interface/settings.c"
+                                                                                                            pidProfile_t
+# 711 "./src/main/interface/settings.c" 3 4
+                                                                                                            , 
+# 711 "./src/main/interface/settings.c"
+                                                                                                            pid[PID_YAW].D
+# 711 "./src/main/interface/settings.c" 3 4
+                                                                                                            ) 
+# 711 "./src/main/interface/settings.c"
+                                                                                                                                                   },
+
+
+    { "p_alt", VAR_UINT8 | PROFILE_VALUE, .config.minmax = { 0, 200 }, 14, 
+# 714 "./src/main/interface/settings.c" 3 4
+                                                                                                            __builtin_offsetof (
+# 714 "./src/main/interface/settings.c"
+                                                                                                            pidProfile_t
+# 714 "./src/main/interface/settings.c" 3 4
+                                                                                                            , 
+# 714 "./src/main/interface/settings.c"
+                                                                                                            pid[PID_ALT].P
+# 714 "./src/main/interface/settings.c" 3 4
+                                                                                                            ) 
+# 714 "./src/main/interface/settings.c"
+                                                                                                                                                   },
+    { "i_alt", VAR_UINT8 | PROFILE_VALUE, .config.minmax = { 0, 200 }, 14, 
+# 715 "./src/main/interface/settings.c" 3 4
+                                                                                                            __builtin_offsetof (
+# 715 "./src/main/interface/settings.c"
+                                                                                                            pidProfile_t
+# 715 "./src/main/interface/settings.c" 3 4
+                                                                                                            , 
+# 715 "./src/main/interface/settings.c"
+                                                                                                            pid[PID_ALT].I
+# 715 "./src/main/interface/settings.c" 3 4
+                                                                                                            ) 
+# 715 "./src/main/interface/settings.c"
+                                                                                                                                                   },
+    { "d_alt", VAR_UINT8 | PROFILE_VALUE, .config.minmax = { 0, 200 }, 14, 
+# 716 "./src/main/interface/settings.c" 3 4
+                                                                                                            __builtin_offsetof (
+# 716 "./src/main/interface/settings.c"
+                                                                                                            pidProfile_t
+# 716 "./src/main/interface/settings.c" 3 4
+                                                                                                            , 
+# 716 "./src/main/interface/settings.c"
+                                                                                                            pid[PID_ALT].D
+# 716 "./src/main/interface/settings.c" 3 4
+                                                                                                            ) 
+# 716 "./src/main/interface/settings.c"
+                                                                                                                                                   },
+    { "p_vel", VAR_UINT8 | PROFILE_VALUE, .config.minmax = { 0, 200 }, 14, 
+# 717 "./src/main/interface/settings.c" 3 4
+                                                                                                            __builtin_offsetof (
+# 717 "./src/main/interface/settings.c"
+                                                                                                            pidProfile_t
+# 717 "./src/main/interface/settings.c" 3 4
+                                                                                                            , 
+# 717 "./src/main/interface/settings.c"
+                                                                                                            pid[PID_VEL].P
+# 717 "./src/main/interface/settings.c" 3 4
+                                                                                                            ) 
+# 717 "./src/main/interface/settings.c"
+                                                                                                                                                   },
+    { "i_vel", VAR_UINT8 | PROFILE_VALUE, .config.minmax = { 0, 200 }, 14, 
+# 718 "./src/main/interface/settings.c" 3 4
+                                                                                                            __builtin_offsetof (
+# 718 "./src/main/interface/settings.c"
+                                                                                                            pidProfile_t
+# 718 "./src/main/interface/settings.c" 3 4
+                                                                                                            , 
+# 718 "./src/main/interface/settings.c"
+                                                                                                            pid[PID_VEL].I
+# 718 "./src/main/interface/settings.c" 3 4
+                                                                                                            ) 
+# 718 "./src/main/interface/settings.c"
+                                                                                                                                                   },
+    { "d_vel", VAR_UINT8 | PROFILE_VALUE, .config.minmax = { 0, 200 }, 14, 
+# 719 "./src/main/interface/settings.c" 3 4
+                                                                                                            __builtin_offsetof (
+# 719 "./src/main/interface/settings.c"
+                                                                                                            pidProfile_t
+# 719 "./src/main/interface/settings.c" 3 4
+                                                                                                            , 
+# 719 "./src/main/interface/settings.c"
+                                                                                                            pid[PID_VEL].D
+# 719 "./src/main/interface/settings.c" 3 4
+                                                                                                            ) 
+# 719 "./src/main/interface/settings.c"
+                                                                                                                                                   },
+
+
+    { "p_level", VAR_UINT8 | PROFILE_VALUE, .config.minmax = { 0, 200 }, 14, 
+# 722 "./src/main/interface/settings.c" 3 4
+                                                                                                            __builtin_offsetof (
+# 722 "./src/main/interface/settings.c"
+                                                                                                            pidProfile_t
+# 722 "./src/main/interface/settings.c" 3 4
+                                                                                                            , 
+# 722 "./src/main/interface/settings.c"
+                                                                                                            pid[PID_LEVEL].P
+# 722 "./src/main/interface/settings.c" 3 4
+                                                                                                            ) 
+# 722 "./src/main/interface/settings.c"
+                                                                                                                                                     },
+    { "i_level", VAR_UINT8 | PROFILE_VALUE, .config.minmax = { 0, 200 }, 14, 
+# 723 "./src/main/interface/settings.c" 3 4
+                                                                                                            __builtin_offsetof (
+# 723 "./src/main/interface/settings.c"
+                                                                                                            pidProfile_t
+# 723 "./src/main/interface/settings.c" 3 4
+                                                                                                            , 
+# 723 "./src/main/interface/settings.c"
+                                                                                                            pid[PID_LEVEL].I
+# 723 "./src/main/interface/settings.c" 3 4
+                                                                                                            ) 
+# 723 "./src/main/interface/settings.c"
+                                                                                                                                                     },
+    { "d_level", VAR_UINT8 | PROFILE_VALUE, .config.minmax = { 0, 200 }, 14, 
+# 724 "./src/main/interface/settings.c" 3 4
+                                                                                                            __builtin_offsetof (
+# 724 "./src/main/interface/settings.c"
+                                                                                                            pidProfile_t
+# 724 "./src/main/interface/settings.c" 3 4
+                                                                                                            , 
+# 724 "./src/main/interface/settings.c"
+                                                                                                            pid[PID_LEVEL].D
+# 724 "./src/main/interface/settings.c" 3 4
+                                                                                                            ) 
+# 724 "./src/main/interface/settings.c"
+                                                                                                                                                     },
+
+    { "level_limit", VAR_UINT8 | PROFILE_VALUE, .config.minmax = { 10, 90 }, 14, 
+# 726 "./src/main/interface/settings.c" 3 4
+                                                                                                            __builtin_offsetof (
+# 726 "./src/main/interface/settings.c"
+                                                                                                            pidProfile_t
+# 726 "./src/main/interface/settings.c" 3 4
+                                                                                                            , 
+# 726 "./src/main/interface/settings.c"
+                                                                                                            levelAngleLimit
+# 726 "./src/main/interface/settings.c" 3 4
+                                                                                                            ) 
+# 726 "./src/main/interface/settings.c"
+                                                                                                                                                    },
+
+    { "horizon_tilt_effect", VAR_UINT8 | PROFILE_VALUE, .config.minmax = { 0, 250 }, 14, 
+# 728 "./src/main/interface/settings.c" 3 4
+                                                                                                             __builtin_offsetof (
+# 728 "./src/main/interface/settings.c"
+                                                                                                             pidProfile_t
+# 728 "./src/main/interface/settings.c" 3 4
+                                                                                                             , 
+# 728 "./src/main/interface/settings.c"
+                                                                                                             horizon_tilt_effect
+# 728 "./src/main/interface/settings.c" 3 4
+                                                                                                             ) 
+# 728 "./src/main/interface/settings.c"
+                                                                                                                                                         },
+    { "horizon_tilt_expert_mode", VAR_UINT8 | PROFILE_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 14, 
+# 729 "./src/main/interface/settings.c" 3 4
+                                                                                                                                __builtin_offsetof (
+# 729 "./src/main/interface/settings.c"
+                                                                                                                                pidProfile_t
+# 729 "./src/main/interface/settings.c" 3 4
+                                                                                                                                , 
+# 729 "./src/main/interface/settings.c"
+                                                                                                                                horizon_tilt_expert_mode
+# 729 "./src/main/interface/settings.c" 3 4
+                                                                                                                                ) 
+# 729 "./src/main/interface/settings.c"
+                                                                                                                                                                                 },
+
+    { "gps_pos_p", VAR_UINT8 | PROFILE_VALUE, .config.minmax = { 0, 200 }, 14, 
+# 731 "./src/main/interface/settings.c" 3 4
+                                                                                                            __builtin_offsetof (
+# 731 "./src/main/interface/settings.c"
+                                                                                                            pidProfile_t
+# 731 "./src/main/interface/settings.c" 3 4
+                                                                                                            , 
+# 731 "./src/main/interface/settings.c"
+                                                                                                            pid[PID_POS].P
+# 731 "./src/main/interface/settings.c" 3 4
+                                                                                                            ) 
+# 731 "./src/main/interface/settings.c"
+                                                                                                                                                   },
+    { "gps_pos_i", VAR_UINT8 | PROFILE_VALUE, .config.minmax = { 0, 200 }, 14, 
+# 732 "./src/main/interface/settings.c" 3 4
+                                                                                                            __builtin_offsetof (
+# 732 "./src/main/interface/settings.c"
+                                                                                                            pidProfile_t
+# 732 "./src/main/interface/settings.c" 3 4
+                                                                                                            , 
+# 732 "./src/main/interface/settings.c"
+                                                                                                            pid[PID_POS].I
+# 732 "./src/main/interface/settings.c" 3 4
+                                                                                                            ) 
+# 732 "./src/main/interface/settings.c"
+                                                                                                                                                   },
+    { "gps_pos_d", VAR_UINT8 | PROFILE_VALUE, .config.minmax = { 0, 200 }, 14, 
+# 733 "./src/main/interface/settings.c" 3 4
+                                                                                                            __builtin_offsetof (
+# 733 "./src/main/interface/settings.c"
+                                                                                                            pidProfile_t
+# 733 "./src/main/interface/settings.c" 3 4
+                                                                                                            , 
+# 733 "./src/main/interface/settings.c"
+                                                                                                            pid[PID_POS].D
+# 733 "./src/main/interface/settings.c" 3 4
+                                                                                                            ) 
+# 733 "./src/main/interface/settings.c"
+                                                                                                                                                   },
+    { "gps_posr_p", VAR_UINT8 | PROFILE_VALUE, .config.minmax = { 0, 200 }, 14, 
+# 734 "./src/main/interface/settings.c" 3 4
+                                                                                                            __builtin_offsetof (
+# 734 "./src/main/interface/settings.c"
+                                                                                                            pidProfile_t
+# 734 "./src/main/interface/settings.c" 3 4
+                                                                                                            , 
+# 734 "./src/main/interface/settings.c"
+                                                                                                            pid[PID_POSR].P
+# 734 "./src/main/interface/settings.c" 3 4
+                                                                                                            ) 
+# 734 "./src/main/interface/settings.c"
+                                                                                                                                                    },
+    { "gps_posr_i", VAR_UINT8 | PROFILE_VALUE, .config.minmax = { 0, 200 }, 14, 
+# 735 "./src/main/interface/settings.c" 3 4
+                                                                                                            __builtin_offsetof (
+# 735 "./src/main/interface/settings.c"
+                                                                                                            pidProfile_t
+# 735 "./src/main/interface/settings.c" 3 4
+                                                                                                            , 
+# 735 "./src/main/interface/settings.c"
+                                                                                                            pid[PID_POSR].I
+# 735 "./src/main/interface/settings.c" 3 4
+                                                                                                            ) 
+# 735 "./src/main/interface/settings.c"
+                                                                                                                                                    },
+    { "gps_posr_d", VAR_UINT8 | PROFILE_VALUE, .config.minmax = { 0, 200 }, 14, 
+# 736 "./src/main/interface/settings.c" 3 4
+                                                                                                            __builtin_offsetof (
+# 736 "./src/main/interface/settings.c"
+                                                                                                            pidProfile_t
+# 736 "./src/main/interface/settings.c" 3 4
+                                                                                                            , 
+# 736 "./src/main/interface/settings.c"
+                                                                                                            pid[PID_POSR].D
+# 736 "./src/main/interface/settings.c" 3 4
+                                                                                                            ) 
+# 736 "./src/main/interface/settings.c"
+                                                                                                                                                    },
+    { "gps_nav_p", VAR_UINT8 | PROFILE_VALUE, .config.minmax = { 0, 200 }, 14, 
+# 737 "./src/main/interface/settings.c" 3 4
+                                                                                                            __builtin_offsetof (
+# 737 "./src/main/interface/settings.c"
+                                                                                                            pidProfile_t
+# 737 "./src/main/interface/settings.c" 3 4
+                                                                                                            , 
+# 737 "./src/main/interface/settings.c"
+                                                                                                            pid[PID_NAVR].P
+# 737 "./src/main/interface/settings.c" 3 4
+                                                                                                            ) 
+# 737 "./src/main/interface/settings.c"
+                                                                                                                                                    },
+    { "gps_nav_i", VAR_UINT8 | PROFILE_VALUE, .config.minmax = { 0, 200 }, 14, 
+# 738 "./src/main/interface/settings.c" 3 4
+                                                                                                            __builtin_offsetof (
+# 738 "./src/main/interface/settings.c"
+                                                                                                            pidProfile_t
+# 738 "./src/main/interface/settings.c" 3 4
+                                                                                                            , 
+# 738 "./src/main/interface/settings.c"
+                                                                                                            pid[PID_NAVR].I
+# 738 "./src/main/interface/settings.c" 3 4
+                                                                                                            ) 
+# 738 "./src/main/interface/settings.c"
+                                                                                                                                                    },
+    { "gps_nav_d", VAR_UINT8 | PROFILE_VALUE, .config.minmax = { 0, 200 }, 14, 
+# 739 "./src/main/interface/settings.c" 3 4
+                                                                                                            __builtin_offsetof (
+# 739 "./src/main/interface/settings.c"
+                                                                                                            pidProfile_t
+# 739 "./src/main/interface/settings.c" 3 4
+                                                                                                            , 
+# 739 "./src/main/interface/settings.c"
+                                                                                                            pid[PID_NAVR].D
+# 739 "./src/main/interface/settings.c" 3 4
+                                                                                                            ) 
+# 739 "./src/main/interface/settings.c"
+                                                                                                                                                    },
+
+
+
+
+    { "tlm_switch", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 31, 
+# 744 "./src/main/interface/settings.c" 3 4
+                                                                                                                                    __builtin_offsetof (
+# 744 "./src/main/interface/settings.c"
+                                                                                                                                    telemetryConfig_t
+# 744 "./src/main/interface/settings.c" 3 4
+                                                                                                                                    , 
+# 744 "./src/main/interface/settings.c"
+                                                                                                                                    telemetry_switch
+# 744 "./src/main/interface/settings.c" 3 4
+                                                                                                                                    ) 
+# 744 "./src/main/interface/settings.c"
+                                                                                                                                                                                  },
+    { "tlm_inverted", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 31, 
+# 745 "./src/main/interface/settings.c" 3 4
+                                                                                                                                    __builtin_offsetof (
+# 745 "./src/main/interface/settings.c"
+                                                                                                                                    telemetryConfig_t
+# 745 "./src/main/interface/settings.c" 3 4
+                                                                                                                                    , 
+# 745 "./src/main/interface/settings.c"
+                                                                                                                                    telemetry_inverted
+# 745 "./src/main/interface/settings.c" 3 4
+                                                                                                                                    ) 
+# 745 "./src/main/interface/settings.c"
+                                                                                                                                                                                    },
+    { "tlm_halfduplex", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 31, 
+# 746 "./src/main/interface/settings.c" 3 4
+                                                                                                                                    __builtin_offsetof (
+# 746 "./src/main/interface/settings.c"
+                                                                                                                                    telemetryConfig_t
+# 746 "./src/main/interface/settings.c" 3 4
+                                                                                                                                    , 
+# 746 "./src/main/interface/settings.c"
+                                                                                                                                    halfDuplex
+# 746 "./src/main/interface/settings.c" 3 4
+                                                                                                                                    ) 
+# 746 "./src/main/interface/settings.c"
+                                                                                                                                                                            },
+# 756 "./src/main/interface/settings.c"
+    { "hott_alarm_int", VAR_UINT8 | MASTER_VALUE, .config.minmax = { 0, 120 }, 31, 
+# 756 "./src/main/interface/settings.c" 3 4
+                                                                                                                __builtin_offsetof (
+# 756 "./src/main/interface/settings.c"
+                                                                                                                telemetryConfig_t
+# 756 "./src/main/interface/settings.c" 3 4
+                                                                                                                , 
+# 756 "./src/main/interface/settings.c"
+                                                                                                                hottAlarmSoundInterval
+# 756 "./src/main/interface/settings.c" 3 4
+                                                                                                                ) 
+# 756 "./src/main/interface/settings.c"
+                                                                                                                                                                    },
+    { "pid_in_tlm", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = {TABLE_OFF_ON }, 31, 
+# 757 "./src/main/interface/settings.c" 3 4
+                                                                                                                                   __builtin_offsetof (
+# 757 "./src/main/interface/settings.c"
+                                                                                                                                   telemetryConfig_t
+# 757 "./src/main/interface/settings.c" 3 4
+                                                                                                                                   , 
+# 757 "./src/main/interface/settings.c"
+                                                                                                                                   pidValuesAsTelemetry
+# 757 "./src/main/interface/settings.c" 3 4
+                                                                                                                                   ) 
+# 757 "./src/main/interface/settings.c"
+                                                                                                                                                                                     },
+# 853 "./src/main/interface/settings.c"
+    { "task_statistics", VAR_INT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 18, 
+# 853 "./src/main/interface/settings.c" 3 4
+                                                                                                                                 __builtin_offsetof (
+# 853 "./src/main/interface/settings.c"
+                                                                                                                                 systemConfig_t
+# 853 "./src/main/interface/settings.c" 3 4
+                                                                                                                                 , 
+# 853 "./src/main/interface/settings.c"
+                                                                                                                                 task_statistics
+# 853 "./src/main/interface/settings.c" 3 4
+                                                                                                                                 ) 
+# 853 "./src/main/interface/settings.c"
+                                                                                                                                                                           },
+
+    { "debug_mode", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_DEBUG }, 18, 
+# 855 "./src/main/interface/settings.c" 3 4
+                                                                                                                                __builtin_offsetof (
+# 855 "./src/main/interface/settings.c"
+                                                                                                                                systemConfig_t
+# 855 "./src/main/interface/settings.c" 3 4
+                                                                                                                                , 
+# 855 "./src/main/interface/settings.c"
+                                                                                                                                debug_mode
+# 855 "./src/main/interface/settings.c" 3 4
+                                                                                                                                ) 
+# 855 "./src/main/interface/settings.c"
+                                                                                                                                                                     },
+    { "rate_6pos_switch", VAR_INT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 18, 
+# 856 "./src/main/interface/settings.c" 3 4
+                                                                                                                                 __builtin_offsetof (
+# 856 "./src/main/interface/settings.c"
+                                                                                                                                 systemConfig_t
+# 856 "./src/main/interface/settings.c" 3 4
+                                                                                                                                 , 
+# 856 "./src/main/interface/settings.c"
+                                                                                                                                 rateProfile6PosSwitch
+# 856 "./src/main/interface/settings.c" 3 4
+                                                                                                                                 ) 
+# 856 "./src/main/interface/settings.c"
+                                                                                                                                                                                 },
+
+
+
+    { "pwr_on_arm_grace", VAR_UINT8 | MASTER_VALUE, .config.minmax = { 0, 30 }, 18, 
+# 860 "./src/main/interface/settings.c" 3 4
+                                                                                                            __builtin_offsetof (
+# 860 "./src/main/interface/settings.c"
+                                                                                                            systemConfig_t
+# 860 "./src/main/interface/settings.c" 3 4
+                                                                                                            , 
+# 860 "./src/main/interface/settings.c"
+                                                                                                            powerOnArmingGraceTime
+# 860 "./src/main/interface/settings.c" 3 4
+                                                                                                            ) 
+# 860 "./src/main/interface/settings.c"
+                                                                                                                                                             },
+    { "scheduler_mode", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_SCHEDULER_MODE }, 18, 
+# 861 "./src/main/interface/settings.c" 3 4
+                                                                                                                                         __builtin_offsetof (
+# 861 "./src/main/interface/settings.c"
+                                                                                                                                         systemConfig_t
+# 861 "./src/main/interface/settings.c" 3 4
+                                                                                                                                         , 
+# 861 "./src/main/interface/settings.c"
+                                                                                                                                         scheduler_mode
+# 861 "./src/main/interface/settings.c" 3 4
+                                                                                                                                         ) 
+# 861 "./src/main/interface/settings.c"
+                                                                                                                                                                                  },
+# 894 "./src/main/interface/settings.c"
+    { "displayport_msp_col_adjust", VAR_INT8 | MASTER_VALUE, .config.minmax = { -6, 0 }, 512, 
+# 894 "./src/main/interface/settings.c" 3 4
+                                                                                                                       __builtin_offsetof (
+# 894 "./src/main/interface/settings.c"
+                                                                                                                       displayPortProfile_t
+# 894 "./src/main/interface/settings.c" 3 4
+                                                                                                                       , 
+# 894 "./src/main/interface/settings.c"
+                                                                                                                       colAdjust
+# 894 "./src/main/interface/settings.c" 3 4
+                                                                                                                       ) 
+# 894 "./src/main/interface/settings.c"
+                                                                                                                                                                 },
+    { "displayport_msp_row_adjust", VAR_INT8 | MASTER_VALUE, .config.minmax = { -3, 0 }, 512, 
+# 895 "./src/main/interface/settings.c" 3 4
+                                                                                                                       __builtin_offsetof (
+# 895 "./src/main/interface/settings.c"
+                                                                                                                       displayPortProfile_t
+# 895 "./src/main/interface/settings.c" 3 4
+                                                                                                                       , 
+# 895 "./src/main/interface/settings.c"
+                                                                                                                       rowAdjust
+# 895 "./src/main/interface/settings.c" 3 4
+                                                                                                                       ) 
+# 895 "./src/main/interface/settings.c"
+                                                                                                                                                                 },
+# 918 "./src/main/interface/settings.c"
+    { "led_inversion", VAR_UINT8 | MASTER_VALUE, .config.minmax = { 0, ((1 << 3) - 1) }, 505, 
+# 918 "./src/main/interface/settings.c" 3 4
+                                                                                                                                                __builtin_offsetof (
+# 918 "./src/main/interface/settings.c"
+                                                                                                                                                statusLedConfig_t
+# 918 "./src/main/interface/settings.c" 3 4
+                                                                                                                                                , 
+# 918 "./src/main/interface/settings.c"
+                                                                                                                                                inversion
+# 918 "./src/main/interface/settings.c" 3 4
+                                                                                                                                                ) 
+# 918 "./src/main/interface/settings.c"
+                                                                                                                                                                                       },
+# 934 "./src/main/interface/settings.c"
+    { "rangefinder_hardware", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_RANGEFINDER_HARDWARE }, 527, 
+# 934 "./src/main/interface/settings.c" 3 4
+                                                                                                                                             __builtin_offsetof (
+# 934 "./src/main/interface/settings.c"
+                                                                                                                                             rangefinderConfig_t
+# 934 "./src/main/interface/settings.c" 3 4
+                                                                                                                                             , 
+# 934 "./src/main/interface/settings.c"
+                                                                                                                                             rangefinder_hardware
+# 934 "./src/main/interface/settings.c" 3 4
+                                                                                                                                             ) 
+# 934 "./src/main/interface/settings.c"
+                                                                                                                                                                                                 },
+
+
+
+    { "ol_nav_rate_hz", VAR_UINT16 | MASTER_VALUE, .config.minmax = { 100, 500 }, 531, 
+# 938 "./src/main/interface/settings.c" 3 4
+                                                                                                                                                      __builtin_offsetof (
+# 938 "./src/main/interface/settings.c"
+                                                                                                                                                      olNavigationConfig_t
+# 938 "./src/main/interface/settings.c" 3 4
+                                                                                                                                                      , 
+# 938 "./src/main/interface/settings.c"
+                                                                                                                                                      nav_rate_hz
+# 938 "./src/main/interface/settings.c" 3 4
+                                                                                                                                                      ) 
+# 938 "./src/main/interface/settings.c"
+                                                                                                                                                                                                  },
+    { "ol_vision_latency_ms", VAR_UINT8 | MASTER_VALUE, .config.minmax = { 0, 200 }, 531, 
+# 939 "./src/main/interface/settings.c" 3 4
+                                                                                                                                  __builtin_offsetof (
+# 939 "./src/main/interface/settings.c"
+                                                                                                                                  olNavigationConfig_t
+# 939 "./src/main/interface/settings.c" 3 4
+                                                                                                                                  , 
+# 939 "./src/main/interface/settings.c"
+                                                                                                                                  vision_latency_ms
+# 939 "./src/main/interface/settings.c" 3 4
+                                                                                                                                  ) 
+# 939 "./src/main/interface/settings.c"
+                                                                                                                                                                                    },
+
+
+
+    { "pinio_config", VAR_UINT8 | MASTER_VALUE | MODE_ARRAY, .config.array.length = 4, 529, 
+# 943 "./src/main/interface/settings.c" 3 4
+                                                                                                                 __builtin_offsetof (
+# 943 "./src/main/interface/settings.c"
+                                                                                                                 pinioConfig_t
+# 943 "./src/main/interface/settings.c" 3 4
+                                                                                                                 , 
+# 943 "./src/main/interface/settings.c"
+                                                                                                                 config
+# 943 "./src/main/interface/settings.c" 3 4
+                                                                                                                 ) 
+# 943 "./src/main/interface/settings.c"
+                                                                                                                                                 },
+
+    { "pinio_box", VAR_UINT8 | MASTER_VALUE | MODE_ARRAY, .config.array.length = 4, 530, 
+# 945 "./src/main/interface/settings.c" 3 4
+                                                                                                                 __builtin_offsetof (
+# 945 "./src/main/interface/settings.c"
+                                                                                                                 pinioBoxConfig_t
+# 945 "./src/main/interface/settings.c" 3 4
+                                                                                                                 , 
+# 945 "./src/main/interface/settings.c"
+                                                                                                                 permanentId
+# 945 "./src/main/interface/settings.c" 3 4
+                                                                                                                 ) 
+# 945 "./src/main/interface/settings.c"
+                                                                                                                                                         },
+
+
+};
+
+const uint16_t valueTableEntryCount = (sizeof(valueTable) / sizeof((valueTable)[0]));
+
+void settingsBuildCheck() {
+    ((void)sizeof(char[1 - 2*!!(LOOKUP_TABLE_COUNT != (sizeof(lookupTables) / sizeof((lookupTables)[0])))]));
+}
@@ -0,0 +1,1249 @@
+	.file	"settings.c"
+	.section	.gnu.lto_.profile.61bca6fb06857629,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.61bca6fb06857629,"e",@progbits
+	.string	"(\265/\375 \337m\006"
+	.string	"\304\013\323"
+	.string	"#"
+	.string	"\233\364\343\336\006"
+	.string	"\001\314\257\276I\002\260\235\253\244\f\003\276\322\242\367\004\004\376\367\260\205\006\005\323\347\261\306\003\006\330\264\373\207\t\007\221\327\373\372\t\b\261\372\215\340\017\t\367\316\327\257\017\n\243\224\377\222\t\r\216\307\310\264\005\016\356\214\300\203\f\017\336\337\356!\020\244\275\245\360\r\021\210\270\313\332\b\023\355\316\316\363\b\024\327\222\361\365\013\025\365\236\302\302\r\026\342\223\240\267\n\027\302\260\202\373\013\030\263\374\313\376\005\031\345\220\314\235\r\032\264\367\311\243\003\033\375\275\346\323\005\034\330\201\352\215\017\035\217\257\347\375\002\036\373\344\335\202\007\037\240\342\234\212\n !\"#$%\240\342\234\212\n"
+	.string	"\006"
+	.ascii	"@\004\334\201\306\200\210W\312\225\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.61bca6fb06857629,"e",@progbits
+	.string	"(\265/\375 \021m"
+	.string	""
+	.string	"8\005"
+	.string	"\001"
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.61bca6fb06857629,"e",@progbits
+	.string	"(\265/\375 2]\001"
+	.string	"$\002&"
+	.string	"\001"
+	.string	""
+	.string	"\003\200\200\200\200\002d\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\201\200\200\200~"
+	.string	""
+	.string	"\006\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\334\034c\003m"
+	.text
+	.section	.gnu.lto_.jmpfuncs.61bca6fb06857629,"e",@progbits
+	.string	"(\265/\375 \021m"
+	.string	""
+	.string	"8\005"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.61bca6fb06857629,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.61bca6fb06857629,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.61bca6fb06857629,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_lookupTableAccHardware.165.61bca6fb06857629,"e",@progbits
+	.string	"(\265/\375`\303\001\215\016"
+	.string	"\204\027\362\001"
+	.string	""
+	.string	"\305"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\300\235\002}\273\001"
+	.string	"\005\001\006\025\001\020\005\001'5\206\b{\370\347Qy\276\017\005\001'=\206\bw\230\347\001u\301\016\005\001'G\bu\304\r\005\001'Q\206\bs\bq\307\f\005\001'\\\bu\312\013\005\001'f\315\n\005\001'p\206\bom\320\t\005\001'y\323'\202\001\325\007\005\001'\213\001\206\bk\330\346\001i\330\006\005\001'\227\001\by\333\005\005\001'\237\336\004\005\001'\250\341\003\005\001'\261\344\002\005\001'\272\001\b}\347'\300\351\001"
+	.string	"?\202\210\200\310\002g3\352\0014\350\001\346\001\345\001\343\001\342\001\340\001\337\001\335\001\334\001\332\001\331\001\327\001\326\0015\324\001\322\001\321\001\317\001\316\001\314\001\313\001\311\001\310\001\306\001\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\005FAKE"
+	.string	"\013/root/repo"
+	.string	" ./src/main/interface/settings.c"
+	.string	"\007BMI160"
+	.string	"\tICM2068949"
+	.string	"\n08G021"
+	.string	"\bMPU9250650000"
+	.string	"\013LSM303DLHCA28MA8452ADXL345"
+	.string	"\005NONE"
+	.string	"\005AUTO"
+	.string	"* "
+	.string	"\2431\342\006["
+	.string	"\312\222\324\206\262\255\236\216\320z\2431\"\303\007\201\024\204\274\037^-\fC\273d\367Qd\254\235\347LL\1774f\363"
+	.ascii	"\260\013eM\236\257\263\013\361\260n\256g\234\360\214\215?^v\220"
+	.ascii	"\367\343\3319\307;\273\373\311\3579\372\363k\230\3110\341"
+	.text
+	.section	.gnu.lto_lookupTableGyroHardware.166.61bca6fb06857629,"e",@progbits
+	.string	"(\265/\375`\232\001\225\r"
+	.string	"v\326WD\340T5\035h,\246pc'\215\306\320\340\323\202\307k\360%P\0045\026pT\202L\367E\317\025\323\202\342\201a\361$\030\004F\267o\230DUl&98ml8\213\200\271\214\341\254\223\3613\273\265Z\222\001E"
+	.string	"D"
+	.string	"F"
+	.string	"\234y1\243\017\372\254a!\201\226\364T\365Y@\212\031\r\373<\300\304\354+\267\t\364<\320g\002$h\252%\037(\320\023\354s\201o,\347}\210\032\267\201\311\r\245\211\315v\376\302\271\002=\271>/\210\335\253\004\037\362\"7r$\236+\371\"p)6\013'\b\366I<\364\221\032}\207>sD8\364\031@\220k\350s"
+	.ascii	"\037\031\372\3147\332WP\216\241\317\226\034?\351\363\345\033"
+	.ascii	"\313\rZ\327\200\215\364\224\365\031#\303\325\017\235\330b\271"
+	.ascii	"H\321\214\275\272\330\213\005\353Zd\331q\f\354(\023\311\316\034"
+	.ascii	"G\262\323,\211\201h\001\357E|\304K<\345'\216\342*\276\342-\356"
+	.ascii	"\3420\036\3433N\3436\300\343\270\312u|\307y\274\307\177\034\310"
+	.ascii	"\205\004\233r\260\022\361\222P)\024o\005G\265z\236\3603a\266"
+	.ascii	"\202\365\363F\341g\272l\255\265\202\237\nz\241U\203\023\335\216"
+	.ascii	"WCP\315l\310\023\002}\252wRP\302l\375tJ\247\004\227mqJ\b\261"
+	.ascii	"\227i\212e& \360\"B\312\003\207\254\372@\227\203j\250h\214\222"
+	.ascii	"\201A\030\205\220\247\207\315$\f\266\273\234\335\373\321dL\206"
+	.ascii	"C\314Dv\264\263&\277\213\354v\276\255k\031\2678\3023\026\177"
+	.ascii	"\314\262\203\332\217g\3079^\331\331O~\314\321\227_\203L\206\016"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_lookupTableBaroHardware.167.61bca6fb06857629,"e",@progbits
+	.string	"(\265/\375`\017"
+	.string	"\275\006"
+	.string	"\244\013\254"
+	.string	""
+	.string	""
+	.string	"W"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\305\366\021}\273\001"
+	.string	"\005\001\006\025\001\005\005\001'4\206\b{\270\366Qy\276\004\005\001'<\by\301\003\005\001'D\304\002\005\001'L\206\bwu\307'R\311\001"
+	.string	"?\202\210\2000s3\312\0014\310\001\306\001\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\004LPS"
+	.string	"\013/root/repo"
+	.string	" ./src/main/interface/settings.c"
+	.string	"\007BMP280"
+	.string	"\007MS5611085"
+	.string	"\005NONE"
+	.string	"\005AUTO"
+	.string	"\013"
+	.string	"\341L!\332d\f,\006\204A\306"
+	.string	"\177<\263\003\373\371\314\217@e2"
+	.ascii	"8"
+	.text
+	.section	.gnu.lto_lookupTableMagHardware.168.61bca6fb06857629,"e",@progbits
+	.string	"(\265/\375 \3575\006"
+	.string	"\304\n\220"
+	.string	""
+	.string	""
+	.string	"S"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\330\237\002}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'7\270\375Q}\276\003\005\001'?\206\b{\by\301\002\005\001'H\206\bwu\304'N\306\001"
+	.string	"?\202\210\200(s3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\007AK8963"
+	.string	"\013/root/repo"
+	.string	" ./src/main/interface/settings.c75"
+	.string	"\bHMC5883"
+	.string	"\005NONE"
+	.string	"\005AUTO"
+	.string	"\t"
+	.ascii	"\020VC\264\311\030X\f\b\347\231\007\310\334g\326\nj\277\001\024"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_lookupTableRangefinderHardware.169.61bca6fb06857629,"e",@progbits
+	.string	"(\265/\375`z"
+	.string	"%\t"
+	.string	"t\017\376"
+	.string	""
+	.string	""
+	.string	"p"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\300\250\002}\273\0015\206\b{\370\377Qy\275\006\025\001\007\005\001':\206\bw\bu\300\006\005\001'C\206\bsq\303\005\005\001'N\206\bom\306\004\005\001'U\b}\311\003\005\001'[\206\bki\314\002\005\001'c\317'k\321\001"
+	.string	"?\202\210\200\310\001g3\322\0014\320\001\316\001\315\001\313\001\312\001\310\001\307\001\305\001\304\001\302\001\301\001\277\001\276\0015\274\001"
+	.string	"\005FAKE"
+	.string	"\013/root/repo"
+	.string	" ./src/main/interface/settings.c"
+	.string	"\004UIB"
+	.string	"\bVL53L0X"
+	.string	"\nHCSR04I2C"
+	.string	"\006SRF10"
+	.string	"\005TF02"
+	.string	"\007TFMINI"
+	.string	"\007"
+	.string	"\005NONE"
+	.string	"\022"
+	.ascii	"\216\241\203D\002#\260\030O\376@n@\242\023\331\005\314~ 7@\""
+	.ascii	"\310\r\220\3103;\253r\342\264\017d\276\323\266\001\024\001"
+	.text
+	.section	.gnu.lto_lookupTableOffOn.170.61bca6fb06857629,"e",@progbits
+	.string	"(\265/\375 {\255\003"
+	.string	"\244\0068"
+	.string	""
+	.string	""
+	.string	"7"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\246\305\306\022}\273\0013\206\b{\270\306Ry\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\003ON"
+	.string	"\013/root/repo"
+	.string	" ./src/main/interface/settings.c"
+	.string	"\004OFF"
+	.string	"\003"
+	.ascii	" \t\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableCrashRecovery.171.61bca6fb06857629,"e",@progbits
+	.string	"(\265/\375 \237\255\004"
+	.string	"t\bV"
+	.string	""
+	.string	""
+	.string	"="
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\310\251\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'5\206\b{\270\314Ry\276'9\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\005BEEP"
+	.string	"\013/root/repo"
+	.string	" ./src/main/interface/settings.c"
+	.string	"\003ON"
+	.string	"\004OFF"
+	.string	"\004"
+	.ascii	"8S\373\264\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableUnit.172.61bca6fb06857629,"e",@progbits
+	.string	"(\265/\375 \205\375\003"
+	.string	"D\0079"
+	.string	""
+	.string	""
+	.string	"@"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\350\251\002}\273\0017\206\b{\270\316Ry\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\007METRIC"
+	.string	"\013/root/repo"
+	.string	" ./src/main/interface/settings.c"
+	.string	"\tIMPERIAL"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableAlignment.173.61bca6fb06857629,"e",@progbits
+	.string	"(\265/\375`\221"
+	.string	"\225\t"
+	.string	"\304\017\f\001"
+	.string	""
+	.string	"y"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\235\362\310\253\002}\273\001:\370\327R}\275\001"
+	.string	"\005\001\006\025\001\007\005\001'E\206\b{\230\327\002y\300\006\005\001'O\206\bw\330\326\002u\303\005\005\001'X\206\bs\230\326\002q\306\004\005\001'_\330\325\002q\311\003\005\001'f\206\bo\230\325\002m\314\002\005\001'l\206\bk\330\324\002i\317'q\230\324\002u\321\001"
+	.string	"?\202\210\200\310\001g3\322\0014\320\001\316\001\315\001\313\001\312\001\310\001\307\001\305\001\304\001\302\001\301\001\277\001\276\0015\274\001"
+	.string	"\nCW270FLIP"
+	.string	"\013/root/repo"
+	.string	" ./src/main/interface/settings.c18\tCW9\bCW\006180"
+	.string	"\005"
+	.string	"\004CW0"
+	.string	"\bDEFAULT"
+	.string	"\027"
+	.ascii	"D\205\252\"\262p/k\214\"\f\002\006\317\255\341\020\3146`\037"
+	.ascii	"\310\021\344\007r\004\371\201\375@~ G\220\037\310\321g~\254\312"
+	.ascii	"\027\254\270\323\266\001\024\001"
+	.text
+	.section	.gnu.lto_lookupTableGPSProvider.174.61bca6fb06857629,"e",@progbits
+	.string	"(\265/\375 \200\325\003"
+	.string	"\364\0069"
+	.string	""
+	.string	""
+	.string	";"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\231\332\360\253\002}\273\0016\206\b{\370\336Ry\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\006UBLOX"
+	.string	"\013/root/repo"
+	.string	" ./src/main/interface/settings.c"
+	.string	"\005NMEA"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableGPSSBASMode.175.61bca6fb06857629,"e",@progbits
+	.string	"(\265/\375 \352-\006"
+	.string	"\324\n\220"
+	.string	""
+	.string	""
+	.string	"N"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\231\332\320\254\002}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'6\206\b{\370\344Ry\276\003\005\001'<\by\301\002\005\001'B\b}\304'I\by\306\001"
+	.string	"?\202\210\200(w3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\006GAGAN"
+	.string	"\013/root/repo"
+	.string	" ./src/main/interface/settings.c"
+	.string	"\005MSAS"
+	.string	"\005WAAS"
+	.string	"\006EGNOS"
+	.string	"\005AUTO"
+	.string	"\b"
+	.ascii	"JX\314cG\205\267\346\231\007\330\332g\326\r*\277\001\024\001"
+	.text
+	.section	.gnu.lto_lookupTableGimbalMode.176.61bca6fb06857629,"e",@progbits
+	.string	"(\265/\375 \204\365\003"
+	.string	"4\0079"
+	.string	""
+	.string	""
+	.string	"?"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\233\336\300\255\002}\273\0018\206\b{\370\347Ry\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\bMIXTILT"
+	.string	"\013/root/repo"
+	.string	" ./src/main/interface/settings.c"
+	.string	"\007NORMAL"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableBlackboxDevice.177.61bca6fb06857629,"e",@progbits
+	.string	"(\265/\375 \315\255\005"
+	.string	"4\ns"
+	.string	""
+	.string	""
+	.string	"N"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\360\255\002}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'7\370\356R}\276\002\005\001'?\206\b{\by\301'I\206\bwu\303\001"
+	.string	"?\202\210\200 s3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\007SERIAL"
+	.string	"\013/root/repo"
+	.string	" ./src/main/interface/settings.c"
+	.string	"\007SDCARD"
+	.string	"\tSPIFLASH"
+	.string	"\005NONE"
+	.string	"\006"
+	.string	"6I\363\f\003d\3563k\005\265\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_lookupTableBlackboxMode.178.61bca6fb06857629,"e",@progbits
+	.string	"(\265/\375 \254\375\004"
+	.string	"\024\tV"
+	.string	""
+	.string	""
+	.string	"J"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\320\256\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'7\206\b{\370\364Ry\276'C\b}\300\001"
+	.string	"?\202\210\200\030w3\301\0014\277\001\275\001\274\001"
+	.string	"\007ALWAYS"
+	.string	"\013/root/repo"
+	.string	" ./src/main/interface/settings.c"
+	.string	"\013MOTOR_TEST"
+	.string	"\007NORMAL"
+	.string	"\004"
+	.string	"V-\366iu\203\312o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_lookupTableGyroLpf.179.61bca6fb06857629,"e",@progbits
+	.string	"(\265/\375`e"
+	.string	"\245\b"
+	.string	"\244\016\364"
+	.string	""
+	.string	""
+	.string	"e"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\250\370\330\274\002}\273\001"
+	.string	"\005\001\006\025\001\007\005\001'=\206\b{\370\344Sy\276\006\005\001'B\206\bw\230\344\003u\301\005\005\001'H\330\337\003u\304\004\005\001'N\230\337\003u\307\003\005\001'T\330\336\003u\312\002\005\001'Z\206\bs\230\336\003q\315'a\330\335\003y\317\001"
+	.string	"?\202\210\200\300\001o3\320\0014\316\001\314\001\313\001\311\001\310\001\306\001\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\rEXPERIMENTAL"
+	.string	"\013/root/repo"
+	.string	" ./src/main/interface/settings.c"
+	.string	"\0045HZ"
+	.string	"\0051024298HZ"
+	.string	"\00618\004OFF"
+	.string	"\022"
+	.ascii	"*\301A 8\006\247l\374\230\305\300j\2209\310\032l\r\262\006[\203"
+	.ascii	"\254\301\326 k\220\271\317\254\033T~\003(\002"
+	.text
+	.section	.gnu.lto_lookupTablePwmProtocol.180.61bca6fb06857629,"e",@progbits
+	.string	"(\265/\375 \370m\006"
+	.string	"$\013\216"
+	.string	""
+	.string	""
+	.string	"^"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\233\336\360\275\n}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'8\206\b{\by\276\003\005\001'C\301\002\005\001'N\206\bwu\304'Z\206\bsq\306\001"
+	.string	"?\202\210\200(o3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\bBRUSHED"
+	.string	"\013/root/repo"
+	.string	" ./src/main/interface/settings.c"
+	.string	"\nMULTISHOT"
+	.string	"\nONE42"
+	.string	"\013125"
+	.string	"\004OFF"
+	.string	"\n"
+	.string	".I\"\313\032$\320\003\241\001\022A&"
+	.ascii	"\327<\363hP\371\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableRcInterpolation.181.61bca6fb06857629,"e",@progbits
+	.string	"(\265/\375 \310\225\005"
+	.string	"\364\ts"
+	.string	""
+	.string	""
+	.string	"I"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\360\276\002}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'7\206\b{\370\366Sy\276\002\005\001'=\b}\301'E\206\bw\bu\303\001"
+	.string	"?\202\210\200 s3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\007MANUAL"
+	.string	"\013/root/repo"
+	.string	" ./src/main/interface/settings.c"
+	.string	"\005AUTO"
+	.string	"\007PRESET"
+	.string	"\004OFF"
+	.string	"\006"
+	.ascii	"Q\245\346i\007W[\373\314\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableRcInterpolationChannels.182.61bca6fb06857629,"e",@progbits
+	.string	"(\265/\375 \237\255\004"
+	.string	"t\bV"
+	.string	""
+	.string	""
+	.string	"="
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\320\277\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'5\206\b{\370\374Sy\276':\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\005RPYT"
+	.string	"\013/root/repo"
+	.string	" ./src/main/interface/settings.c"
+	.string	"\004RPY"
+	.string	"\003RP"
+	.string	"\004"
+	.ascii	"8S\373\264\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableLowpassType.183.61bca6fb06857629,"e",@progbits
+	.string	"(\265/\375 \241\245\004"
+	.string	"d\bU"
+	.string	""
+	.string	""
+	.string	"@"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\205\377\023}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'4\206\b{\370\376Sy\276'<\b}\300\001"
+	.string	"?\202\210\200\030w3\301\0014\277\001\275\001\274\001"
+	.string	"\004FIR"
+	.string	"\013/root/repo"
+	.string	" ./src/main/interface/settings.c"
+	.string	"\007BIQUAD"
+	.string	"\004PT1"
+	.string	"\004"
+	.string	"U-\366i5\201\312o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_lookupTableFailsafe.184.61bca6fb06857629,"e",@progbits
+	.string	"(\265/\375 \204\365\003"
+	.string	"4\0079"
+	.string	""
+	.string	""
+	.string	"?"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\320\310\002}\273\0015\206\b{\370\304Ty\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\005DROP"
+	.string	"\013/root/repo"
+	.string	" ./src/main/interface/settings.c"
+	.string	"\nAUTO-LAND"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableBusType.185.61bca6fb06857629,"e",@progbits
+	.string	"(\265/\375 \304u\005"
+	.string	"\264\ts"
+	.string	""
+	.string	""
+	.string	"E"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\231\332\360\310\002}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'6\206\b{\370\306Ty\276\002\005\001';\by\301'@\206\bw\bu\303\001"
+	.string	"?\202\210\200 s3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\006SLAVE"
+	.string	"\013/root/repo"
+	.string	" ./src/main/interface/settings.c"
+	.string	"\004SPI"
+	.string	"\004I2C"
+	.string	"\005NONE"
+	.string	"\006"
+	.ascii	"Q\245\346i\007\330\332g\326\r*\277\001\024\001"
+	.text
+	.section	.gnu.lto_lookupTableGyroOverflowCheck.186.61bca6fb06857629,"e",@progbits
+	.string	"(\265/\375 \236u\004"
+	.string	"\004\bU"
+	.string	""
+	.string	""
+	.string	"="
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\305\324\024}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'4\270\324T}\276'9\b}\300\001"
+	.string	"?\202\210\200\030{3\301\0014\277\001\275\001\274\001"
+	.string	"\004ALL"
+	.string	"\013/root/repo"
+	.string	" ./src/main/interface/settings.c"
+	.string	"\004YAW"
+	.string	"\004OFF"
+	.string	"\004"
+	.ascii	"8\027\373\264:@\3557\200\""
+	.text
+	.section	.gnu.lto_lookupTableRatesType.187.61bca6fb06857629,"e",@progbits
+	.string	"(\265/\375 \213%\004"
+	.string	"\264\0079"
+	.string	""
+	.string	""
+	.string	"F"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\236\364\340\313\002}\273\001"
+	.string	"\005\001';\370\335T}\275\001"
+	.string	"?\202\210\200\020{3\276\0014\274\001"
+	.string	"\013RACEFLIGHT"
+	.string	"\013/root/repo"
+	.string	" ./src/main/interface/settings.c"
+	.string	"\013BETAFLIGHT"
+	.string	"\002"
+	.string	"\354\334n"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_lookupTableSchedulerMode.188.61bca6fb06857629,"e",@progbits
+	.string	"(\265/\375 \200\325\003"
+	.string	"\364\0069"
+	.string	""
+	.string	""
+	.string	";"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\330\315\002}\273\0015\206\b{\270\355Ty\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\005HEAP"
+	.string	"\013/root/repo"
+	.string	" ./src/main/interface/settings.c"
+	.string	"\006QUEUE"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTables.189.61bca6fb06857629,"e",@progbits
+	.string	"(\265/\375`-\003-\020"
+	.string	"\224\030\363\003"
+	.string	""
+	.string	"."
+	.string	"\005\001\006\035\001\002\005\001\212\001\206\200\200\374\342\303\347u\177}"
+	.ascii	"\005\001?\202\210\200\020{y\274\001w\273\001\005\001\006\025"
+	.ascii	"\001\031\330\345\005\177u\277\030\003\230\337\005sq\303\001w"
+	.ascii	"\302\027\t\330\335\005om\307\001w\306\026\004\230\327\005ki\313"
+	.ascii	"\001w\312\025\230\325\005s"
+	.string	"g\316\024\324\005\177e\321\023\324\005sc\324\022\317\005sa\327\021\230\317\005k_\332\020\005\330\316\005][\336\001w\335\0171\230\316\005YW\342\001w\341\016\315\005]U\345\r\006\330\307\005SQ\351\001w\350\f\021\306\005OM\355\001w\354\013\b\306\005KI\361\001w\360\n\376\004\177G\364\t\230\375\004sE\367\330\374\004]C\371\007\367\004sA\374\006\367\004k\277\177\377\365\004]\275\202\002\004\230\365\004\177\273\205\002\003\364\004o\271\210\002\330\357\004\177\267\213\230\357\004\177\265\215\320\003\263\1773\216\0024\214\002\212\002\211\002\207\002\206\002\204\002\203\002\201\002\200\002\376\001\375\001\373\001\372\0015\370\001\366\001\365\001\363\001\362\001\357\001\356\001\353\001\352\001\347\001\346\001\344\001\343\001\340\001\337\001\334\001\333\001\331\001\330\001\326\001\325\001\323\001\322\001\320\001\317\001\315\001\314\001\311\001\310\001\305\001\304\001\301\001\300\001\276\001\275\001"
+	.string	"\013/root/repo"
+	.string	" ./src/main/interface/settings.c"
+	.string	"U\250A\214#pm\37730C!\342\006\020\020\245\224Y\017r\003\001}\017!\353\207*\312D\226\246+W\340\245\370c\374\244hs\242\270\227\212\007\356\016W\353\201MC\031O\214\017P\325\254\324\216\245!\311\034\005\326>\2404\263\r\361\305\226#\240Uf\374v\223\312\035<\024\330\317f`\347\020\205\254\374\272\216\354\0072?\223\3115n\241"
+	.ascii	"(nkD\006!\243\230\256\202S\003"
+	.text
+	.section	.gnu.lto_valueTable.190.61bca6fb06857629,"e",@progbits
+	.string	"(\265/\375`\352[\325#\001:\247\035`W0\214(\335\034\034D \214\274\f5 \217e\301\314\303X\363\3639\320\200?\0164\340\237C\f{Cc"
+	.string	"\"\202\300x\332\333-##\267<C5\0224\272\316\373x\035o\r@\343\3538|\273\310\245s\326\3635\312\203\264\213\334]"
+	.ascii	"\374?"
+	.string	"\323DDDH\310R\"\001\371\005\024\006\037\006B\224\005z\204\032\335?o\026\244\"\331\033\357st\205\017\351,B\021v\002E\201\022A\261H\357s\324\004\267K1\207\212\230?\216FI\240#:\374\231\024+\364>GC\250\260\"D=\314_F\243HT\350\026\372\263\252\017*r\325\362>G\203P\240\"\274-]8\227\370\317\260\326\272\275\025V\204\374\312l\032\321\034\213^\207?s[\323\336\347<\257\210\305\325]\025*\367\321\237\321\255\\Sx]\347v1Fxr\363\307\321|\216G\311\300\237%W\247\3679\207r\024\326d\3765\232\3039\271C\374\231\336\b\025\271\"\337\347\374\255\005W\"\344k\363\227\321\274\215\355\036\372\263=\023*RU[\342\323CBr\226\206\006\325\365>\347f\274\354\001\002\222\212\200\315<\214\346cb4\217&\305\343}\236r#\002P\022\3225\204{\325<\032\225:\203\213"
+	.string	".\256\264~l\335D\217V\225BE\252(\262\260\372\223\225[|\f\360\202\212GU\017\232G\303R\203v4`\211Gq\034\263\217\004\315\247\270\324=\365hn\251\335\373\234\337p"
+	.ascii	"\223\f\247\032\374\351.z48\026*2E{\237s\032|F\004\f`(-\301`\272"
+	.ascii	"\217\036M\016IE\246B^\270\350'\323\234T\004b\360\025\334\210"
+	.ascii	"\267\340G\035\036\215.\215z\237s\026\031\232x\tN4\177\026\315"
+	.ascii	"Sp\024\267\322\243\335\275P\221\351\212\3679?\301M<\027\r2>\204"
+	.ascii	"\030\301E\320<Z2\375\360>\347 \222L`\006\367\341@\363\211Ds\017"
+	.ascii	"<\350\370hz\350\336\373\234\377T\200\006\026-[\3668<\332\336"
+	.ascii	"\\\226\rNU\222yV8|\332\022\232\004O\203\247\271\272)\247\335"
+	.ascii	"\275\343\323\232P-:)0d?j4\211\203r>\271\263>\315\t\315\001\347"
+	.ascii	"\344\005\021\304\306\0226&mP\250\2145.(3\264$gZ\207O\223BM\274"
+	.ascii	"\317\3173\257\250\023\354\034;\217\234"
+	.string	"d\367\324\247Q\361,bgX\227!7\272\206\0209\277n\253O\253\342Q\274\300pd\375\230}$\3503\310\t\244\346\323\260\270\332\373\374\334:\265\"\224_R'\217*\037V\361\247\301\031\351\241\326\315\022\357\024\216)\0359\344\264\336\347\247\224X\016\247\032P\247\215\370\323\350\270\324S\002t,\305\220q6q\370\264;\356\342}~\3028\231\372\253\311-\200\3524:[\314'\022}*\235Iw\324\247%9\321\373\034=J\002\200\035s)\212T\334O\237\266\307A\274\317O\024<~f\310D\211\245.\357\363\223D\217\363\303\031\342\004q?\375ZS\036\262\352\352\3749\203N '\273\367\371\351c\205\247e\313\036\324\223,>\254\\\311\273\231~M*\206\212<\333\222WCS\250\334Q\245\331aE\2212WE\366>\367\311\2759\211\203\303\"\322D\325R\262\326\306&\027d\311\272Uv\226\206Fwe\306\376"
+	.ascii	"\023#\033\273\243\nk\201t\r!\362\225\214\362\272\020D\353G\020"
+	.ascii	" z3\266*\020\322\303\352\312\307-\343\327\366h\250\310\363E\225"
+	.ascii	"\005\\R9\250t8\255\230\232\351z\262\021\005\0055TC\202\027\214"
+	.ascii	"\246\0312\356\247g\223\262\241\"O\017\357s_\214\tC\216\224^\270"
+	.ascii	"\270\243\236\255\n\207\212\364]y\237\373\222|-\272\017\211-\225"
+	.ascii	"\\\360E\244bE\321=\365ln:T\244\257\311\373\334\227\302\207\342"
+	.ascii	"\263` \022b\304\354#A\373J\370\206\356\035\317\006\327CE\372"
+	.ascii	"\276\336\347\021|\"\036P\304\007\344"
+	.string	"\363\340C\372\204\216\317F\227\365>\367\005\271F\264l\351\302\345\370lw\276\034{?\260\260<\275+\307gK\372hX\t\263\273\253BE\017i\n\214\030\224(R\346\356\254g\3333!\02736\325\004\316\311\222/\350Mh\255\215\355\370mMzK\376\210\031Z\222\264\343\2679\325\275\317\3153\bH\300d3Lh\216\315\237E\233G\310\216\337\006e\225\324\344}n\212\275D\370\267l\b\221\257;\353\333\334\320\274\314\266\200\b1\203\304\337\006g~\375\340gC>\260\256j\276M\256\312\nm\212\212\307\216\232g\"e:\275\317M\035f\216\376dz2i\246\220l\326\020\232P7\242\356\254gBe&\331(\n\300\277I\346d\320\230q[}\035\325\225\2124G\274\317\315&\265\027LKw\326\327a\335[*\362\273\274\317M\027J/\037\002%,f\323\2106[\034q\370:\267\272\367\271\214\271\242\003E\037"
+	.string	"\201\032\202%C'\346/\243M\024D\034\276\356\016\003*\362\227\274\317M\023f\211\376d"
+	.ascii	"@\327L\017\262)$4A\314\037G\233\"\314\0205_\227|#\357s\363\203"
+	.ascii	"\211\254\360 \375\227\355\252\213\371c\372d\340\247\350\341x"
+	.ascii	"\237?\227-\034|\2056<\371\223\302\2772\277\036\375Y\260d\340"
+	.ascii	"\247\354i@"
+	.string	"E~\212\367\371\347\221\365\267\222\002\237\177\231\314\311/E\370vwSh\336J\025\007T\344{x\237\177\035]\177\262\024\213\317\355M\370p\363\307\321\017\345I\207\317\253\"\276\317c\234t\240\311\007@ \341C\200>?M\374\373v\265d\3765\372\333\330j>ON\004*\262\004\357sSI\222\376jp\276\344Wh\022&\277\230\360\221\314_F\377\231Y\207\317\243\263J\032\201\212\334\300\373\274<B\202\261\376d00\346\277\276\002\372\374La:\351\222\337K\370_E\210\304\237\267g\225\204\243\"+\360>\377!D\347\303\375\f\372\374\257\344\307\022\376\326\374?\350\017r\002c\002\312\007r\344>\273\257*J{>>\310\027\361|GE\232\357s\001\274V\017\n>+\005\267\352\003\002h\203\347\347[\200>?Q\374\213>/_p\224\245\0070\004H\334\356\202V\305\n\243\226\305m\265\201n\202\336\373\274-\032"
+	.string	"\006\023D\355\t\016\033\356\236\274\317\333\022\355\320\003\204\200\230\277\214nE\204\350\300\312\005\250\256\250\310\t^\357\363\366\003\004\256Z\240\326C\033tG]\240\312\352}\336\376`\300\221\354q\331rG]"
+	.string	"k\002\224\226\f\330\244\220\315\323\273rO]\300m\002\213\3679k%\002WS\250\334q\320"
+	.string	"n\202\220\235\004\302\242H\231\273\2554\220\223\220\224\203\30234\201srOi@'\201\311\233\206\26566\032\r$\220-Q\202N`K\310\236\245\241\335G\032$%d\275\317Y3\266\254\013\005\240\210\221\215\305\0334\341\b\253\200\320W\021\"\361\006N\022\230\206X \b\227\220;j\003(\t*\336\347,\220\r]XZY\0346\220\223"
+	.ascii	"tu\2010\036U=n\242\r\350f\354\336\347\354\016\226\nF\003\034"
+	.ascii	"SR5\033\334\265\275\317\331\033c\033\f\t\331'\0335\356\251\r"
+	.ascii	"\2223D\336\347\254\323\217\260\0302\232j\236k\311\352}\316\302"
+	.ascii	"`\231\200\234<\204l\222\013\245\232\347jzz\237\263Hl\213\316"
+	.ascii	"\355R\017E,\330\0255\317%5s\244B\310\026kb\3762\232%bOP\315\b"
+	.ascii	"\275\317\331\022c!\346_\243\331\021\254\210\252*\357s\026D\327"
+	.ascii	"\343\t\331\240\371\343hV\210"
+	.ascii	"\365\320\341\271\260\"\254\275\317Y \257-]V.\035`y.\267\016\264"
+	.ascii	"\250\310\b[\357\363uo\325bB=\236p\315\323\273r\023=\027\\\004"
+	.ascii	"\033\357\363\325\312\232\204p5\205\312z\307\341\271\356\"\034"
+	.ascii	"\331\021\211\"e\235\273\217\236+\031\001)W\344\303\204\253\223"
+	.ascii	"Y\225\243\3278\270\333\352\271\364 Xy\237\257MV\267\276\276\201"
+	.ascii	"\311\031\231\023\256K\330\326\265;\352\273\234 \310)Q[\301\314"
+	.ascii	"\346_\243W\264\365,\376\256*\bJ\336\347k\331\212$i)\354*lL\f"
+	.ascii	"K\b\330\020\"\353\327]\364]n\020lx\215\341\001\021\262\006\271"
+	.ascii	"\225\276\013\016\202\212\037dWY+\326\375\363]r\017\260\370P\247"
+	.ascii	"\272\017\351\310\216\036<\350\344\336\347+\025\022 \034SR4\337"
+	.ascii	"u\247v#*-s\252\261>\321|W\362A\221\367\371Jc\235\241\2321\255"
+	.ascii	"1V\030\367"
+	.string	"\216\357\322{ \365>_\227\316\204\220\224\222n\253\357\332{\361>_[\224hE\363\307\321+\213u\305m\365^\017J\274\317W\025i&\210\326\0237\321{5\311d)\221\004L\270\206\030\261\212\270\247\336\313)\356}\276\202(\325\326\037\341\0324\177\031\275\n\255\036\356\254\367\242\222Q{\237\257@&\220\222=.[\334\300\264,\301\023\252yzW\342\367\202\323z\237\253V\324d\007H\237\265+\273;u\312\035\365^w2S\357s\265\216\rN\250B\231U9Z\235\213\022\277WR&\306\373\334\367D\215\273\203|\314\23760\241\312\344Mu\273\247~HR\246D\033\223+\265%\252\222\333\352\301\226b\266\274\317\325$\352\221\236\006\t+;3\343\360`MR\220\250G\326\336\300\304\302\356\254\007\213ab\244\211\327\227:\244\303\203A\305\020\351r\242j\t\325\037\363\307\321j\020 \034\036L\252\307\373\\\335\262"
+	.ascii	"weu\245\372\270\211\036\314-&\306\373\\\255\212\323\261C\245"
+	.ascii	"\252y0\270\230\024\357s5\207*\325\325)\f\252<\2611\377\032\255"
+	.ascii	"F\251P\034\036L.\346\247\306S\1772\337\t(aM\263iD\2533T\031\367"
+	.ascii	"\321\203\321\301\330\275\317\325\030\245\034W\022\252.\346/\243"
+	.ascii	"\325%\365\305\275\343\301\356`\314\336\347\252\222\212\324\325"
+	.ascii	"\244\007Q\256V\030\251,\356\247\017[\2021R4\247\236PQ\250DM0"
+	.ascii	"@\336\347\252\t)j\210Y\025A\253$\324\021N0;\336\347\024T\020"
+	.ascii	"\352\007\nt> \241\n4\247`\264\352A\r\212?\f\206\306\373\\\375"
+	.ascii	"\251\333\343\262\205\346\303\244`\214\264\330\345\351]\241\202"
+	.ascii	"\031ae\312]\025*\307\017\253\202\361\231r7G'\005+\031\205\312"
+	.ascii	"\033\334\2238\2679'U\224\264\2711\271\263>\f\356\245\215\r\257"
+	.ascii	",\311\234\202\321\251\022\265;\352\303^\216\244%\301\220\230"
+	.ascii	"\245e\307\017\243{\361z\237\247G\254\030\231S0:\025K\303n\241"
+	.ascii	"\017\273{\301z\237\253E\362|@\302\224kN\273\350t\210W\315\207"
+	.ascii	"%_\240\336\347l*\004HO\203p;\231\"_\341J\025\226V\232\305\341"
+	.ascii	"\305\226^Z\\\245V=\365\361\200&z\351\224lj\021\246:v\244TM/A"
+	.ascii	"\357\3634\207\232\033\226!\250\033Q5/&\205\367>Om\250\225Yf8"
+	.ascii	"\2454h^\214\352\007\367>Oe\250\225Z\226`\244L5/V\3653{\261w\325"
+	.ascii	"\"\t\t\353\353H\305\374kt\272\"-\272\263^\314\355\207\365>OS"
+	.ascii	"\037.C\363\307\321\251\211\264\304\375\363bp?\246\367yJ\242\354"
+	.ascii	"\342{\022\246\037B\244 \356\250\027\373\251x\237\247\310T\250"
+	.ascii	"?\031\225"
+	.string	"\017\024a\352\223\002\245?\367\321\213%\177?]\270l\3701\241\bQ,Z\262\334J/\246\347\316\351\001\341YA\223\361\217A\271kU\250\370\202\350\354\352h~L*\354}\216JA\347\316\367\360\026\007\005}r[\375\030\225\213\005't\032\tQ&on4?V\025\325\206T[\242\204\346\307\350\\\027\357s4\311\207\2623\263\016?v\347\202@\002\"lL\214\346\307\222X\300B\f!\362E\363czs^>$\021B\204(\020!h\020\232\037\333k\227\274\317\321\037#|=\204\350\325l\032\321h\026\212\225\2017\223j\267|\220\330\321\203\007\\;\203j\b\307\024*\325\341\315\344\332\023\357s\364F\211'\0335\350\2608\231\210!\003m\272\225\336\214m\362>Ga\234L'\336\224^\270\350`\313\233%;\350\242\"Y\"IDhQ\266\035\0331\304@\370\246\216m\242\214\201(\3033\006`m\304p\201"
+	.ascii	"J\272\030\327\030l\232\2561\264%\017m\323i\231(\027\331\362\205"
+	.ascii	"<\327\033y\260G\373\264g\362n/\367Q\236\312Wy-\277g\002\231A"
+	.ascii	"\346\b\223\204\231\302Ta\"\231I&\f3\206\351d>\2318L)\263\207"
+	.ascii	"Yef\231Z&\227\331e\0261\215\230H\3142S\315Tb21\335\3148\363\211"
+	.ascii	"Ig\326\231xf\322\304bf\361\371\370~|\037| |&|'|,|F\276%\037\223"
+	.ascii	"\217\206\317\311w\303\207\303\267\303\307\303\207\345\313\362"
+	.ascii	"\t\361q\371\212\370\214\370\216\370\220\370\222\370\324|L|n\276"
+	.ascii	"'>(>:_\235\257\212\017\317\247\347\303\342\343\342\353rz8\205"
+	.ascii	"N\021\347\210\363\304It\2568Y\234.\316\027\347\214\223\306\031"
+	.ascii	"u\3368\251\316\035\347\325\211u\n9\271\316\"\247\221\023\311"
+	.ascii	"Yv\252\235JN\267\363\355\224;\243\234w'\225\363\312\251wr9\273"
+	.ascii	"p!\216\344$\370\020W\301\2138\022O\3421x\023\267\301\241x\016"
+	.ascii	"\256\203[q\037\034\b\017\302\2778\021N\306\217\360$\\\2153\341"
+	.ascii	"n<\216?\341R8\035\307\343I\236\205kA}\320\037\364\003\n\002\035"
+	.ascii	"BK\240)P\025h\013\024\t]B\231\320\031(\r\024\n\215Bs\240:\320"
+	.ascii	"*\324\n\325B\267P.\264\013-\202\032A\311\320#(\032\232\206\256"
+	.ascii	"\241lh\023\324\t*\207FA\247\240wh\036z\005\335C\267\244A\251"
+	.ascii	"\207TD:\"=\221\022\245,R\243T)u\221\306H\233\322\247\264F\212"
+	.ascii	"#\225Jy\244=\322\255\364G\372\225\022I\307R\262\364,EK\227\244"
+	.ascii	"k\351[\332$\205\222\312\245u\251]\212\227&S,i\226\264\213\352"
+	.ascii	"\243\n\251HuH-\241\246PU\250Gj\013\225I\205\241\322P\235\324"
+	.ascii	"\033*\016\225\207\332C\305R\263T!*\227JD-\242\216\251d*\232\232"
+	.ascii	"\246\256\251lj\023\325\211*E\245S\251\250UT,j\026\265\313\352"
+	.ascii	"\263\"\327\017+\211uhE\261\246X\215\326\243\325\305\372bmZe\254"
+	.ascii	"6V\2505\307\252c\255Z\255V\255uk\345Z\273\326\"\253\221\225l"
+	.ascii	"=\262\246\255I\326\266\225\311\372d\205\262\322\255uk\225\025"
+	.ascii	"o\305\262fa}\330\037\026\311~`I\260C,\n6\005k\304\036\261/\330"
+	.ascii	"%v\006K\203\205b\243\330\034\254\016\326\212\365\301n\261?\330"
+	.ascii	".\326\2135\302\202\261GX$l\022V\215e\302\272\261q\354\023\226"
+	.ascii	"\216\255c\253\260x,\0266\013\333\245\365i\205Zd;\242%\321\242"
+	.ascii	"hS\264Gm\213\366E\273\324\316hi\264Q\355\215VGK\325Z\265>\332"
+	.ascii	"\255\366G\333\325z\265FZ\260\266\2545k\325Z%-\223\326\255\215"
+	.ascii	"k\237\264RZ\272\266J\213\327bi\263\270>\356\217\213t?\270Cn\t"
+	.ascii	"W\205[\344\266p\221\334%\227\311ur\237\\\034\256\224\273\303"
+	.ascii	"\345\341^\271X.\0207\210;\304\375r\305\3341\027\315M"
+	.string	"s\327\\6\267\211\353\304\215\342\316\271S\334;7\317\275\342nq\271\374\202~\036~!~\"~&$\360S\361+\372\265\370!\375\226~L\277\031?\032?\250_\324/\307O\307\317*\002?\255\f:\300\333 wu\225\365\303\272\263.\270\263\240\351}\376\3631\304\243\252\307-tA\322\202\026\357\363\337\216\037\025k\342\230\222\272\25504Y\020\342}\376\273\301\355\236\346\217\243\1776~5\356#\fN\025\344\275\317\177Ng\f\031M\267\025\006\250\n\342\336\347?\030<L\351\205\213\032\fRgI(\213#\243\233\b\003\025\220\025)Q\212\037\212\032\fU\025L\235"
+	.string	"#Qb\350&\302\200U\201\322\210\325\007\204\234\177\215\376\201\370p\027aHV \364>\377\t\375|\346/\243\177@\277\237\333\n\303^\362}\356vi\263\354i\271\255\"\260t\301\311\373\334\305\342\352\361\030\271\2762\241\213g%\331!\002N\027\302\252P\231\360\243\263\253;J y!\210\224\227'rPb\t\350]\240\212\203ka\230\314\277F\273onwV\006\247\013N\357s\267-FHm\211\222\232\fP\027\214\222\310\270dB\267\354\3145\243\311 u!\304\373\334E\342\0361+\300\003#a`\307\fn\\\212\0201!(\341\362r\273\356\250\fp\026\250\b\211P\246\365c\253&\203\334[\326\fX\225\017\253\333*\003\035\331\373\334\355!\001(\007\225\253\243&\203\205\037\357swJM\232"
+	.string	"u#*\316\220\264\220\303F\215\037\005\0314f\334V\031\364,05\2710\272\033\003O\212\004Y\005(J/\\\0343\354\255H\262 \304\342\310\350\250ai\304\212\323I\350\022\315\252\034\355\246pQ\03454Y\360y\237\273'\\\023>>\025\\\271$\334\021\261\206\252\nU\336\347n\b\027\304\214\005xn\220+\344z\270\2554`\275\275\317]\240\271-]\270\334V\032\334*\220\275\317\333\275VK\177\262"
+	.string	"\344\351]\341\240\001\256\202\226\225d\177\262\362\212"
+	.string	"\266\246\264T\332;\032\rr\025p\274\317[\273\266\316\035\200\334\\\024\032\rt\025\226\240\244>\b\360\326\244\205k\235\324h\250p\342\255"
+	.string	"ekmlw\224\206d\205\240%\006@\"l\321\222\244\335Q\032\364\362\336\347\355\031\331\001\330$\031\222#7\323\006\nv\357\363v\254\r\353\255\230\324\257\t\001\352W\021\"\307\rPN\206\274A\270\204\0347H%y\237\267@\022\2005\277\036\335je\305\033\250\212\274\317\333\253'S"
+	.string	"\217\252\036w\326\206*\nZ\357\363v\307\002\244f\323\210nsL\335Q\033\260(L\275\317[\034\f\250\001e\343\270\301\215\302\214'\247\230\006\2305b\314\037G\2672\332\246x\003\034\005\243\367y\013\243e\222q@\222\213V\211f\203\034\205\020\357\3636%]\367\340\264\345Mq\270\002\211=\306\0071\020\200"
+	.string	"\006\0200\210q`\3338\201\256\3519&\246\264\201\261}S\307:\364L\t\004\302@ \374+9\310\3517\305v\226k\273\343\3003\016<\27308\360\f\203\003\317?\242<\004\306\301\216\003\3171%O\017\007\235\256c\016p\340\2315\036m~r\321\030S\032\215q\035\f\302\035\210\201,C\327\034\310\306n\003\333/\345Mq\330c\243L\023a\312a\254s\003\354t\r\333\270%\260\356AyN\331R\b\214s\330\362\327\226\266l4\326n\311\2269\300_i\023\345^\254\201\365Ki\214\343\032'\016v\036y\356:\305\233\230\3228\214\211<G\270\363\300\263L\034\244\347Z\206\003@\224\201\261\361\310S\273<u\204\242L\031\003e\2358\030S\002\201p\017\32640\256_\206t\347\241m\204@xh\363\340\307\003\317\2772H\204\347\231v\313y\247\330\2031\220\330c$\036{l<\312\224C\032H\333t]\204"
+	.string	"\023\241\214\217CX\247\256i`\257sl\030\230\262\007\036>(\207CY8\263C\017{\005e\\\037\203\361\rl\034\312\360\r\004\231\362A\r\3236\235\210#\017\341\230!l3\3138n\331c\313@\270\b\377$\f\207\307\233\tDy\226\200C\224\2115\274c\2414\312\306\270\216mcON\214M\214\353\372\b|)\353\330\216\347\336S\307\266\r\333\274\2241\016l\017i\235>\034\306\300n\003c;\016V\3201\366\330x\214\261\353x\bw\033\266\001B\210\320\302p<\204\201F\267\264c\343\315\r\335ul\330F6\326\264M\317}\007\356\211P\356\320\303\2302\007G\316\031\302\265}\214\211=\230A[f0\023\214s\200\266\274c\354\301\fd\312\3308<\026{\035\333\304\030\ba\336)\302\224\034\344t\231\222\326\251cc\227k\373Ai\327\260m\3548D9X\303;5}\323\2071\221\b\347"
+	.ascii	"+\224Ay\356u\216\255\3269\366\032\333p\335\376^\2005\333\226"
+	.ascii	"t\221'\356;p\317:\034\322u\353\032\373\016\334\303\226p\321^"
+	.ascii	"K!\034\3276\035.\3320e\035\333@\270\246i\233\270\226\211m8X<"
+	.ascii	"\366!,\327\261QB\017\017\020\b\303p0\204\201\301x\256a\342\261"
+	.ascii	"\003\2010LY\224\205}\006\006\373q\226\333\222\210\023\333D\271"
+	.ascii	"\037g\331\302p\b\317Fw\256a\243\034|P\3165\334mc-\337t\"\335"
+	.ascii	"\2070\260\323u\017\216\204\262\216\203\262\016]\377\214\260\215"
+	.ascii	"1\246\f\036a\233N\333G\330x\224\203p\335\213;\335X\304y)q\210"
+	.ascii	"r\020\216s\272q\246$\312\3018.\356\304Cc\327\201\211/\366\020"
+	.ascii	"\3568Dy'\030\363\3107\027Jb\r\307\303^\307:t\016Q\346\201g\t"
+	.ascii	"6\263<\004v\036x\246`\023c\2401\016v\036x\266\360\240\214q\210"
+	.ascii	"p\016\260\333F\370\246\007\207tN\267\207\360\314Z\006\211\260"
+	.ascii	"M\020\216\203}\007\356\371\225\301\330X\307:q\335\207tm\023i"
+	.ascii	"`\337\201{f\312\231&\306\301n4\306@\272.\366\240\\|P\022i\331"
+	.ascii	"&\306:q]\2740\200\322&\306\300:.\366\330\206ud\033\b\307\301"
+	.ascii	"~sC\307B\330\356=\360\016L<\326\r(\343b\217\335!\274\224\034"
+	.ascii	"\344\300\22477\264}\004\366\034\240M\023!\004\345b\267a\033\235"
+	.ascii	"\2272\036\3326]\347\330\235(\317\335\206{P.F\230P\022e\030\247"
+	.ascii	"\367\330\262\016\\\343t\331&\302\017JZ\266\341\272\363\300\303"
+	.ascii	"\270\236)\355\034\0349\336\tJx)\201@\230\r\342\310\224\301!\235"
+	.ascii	"c\214\353\034\273\333D\231.\332\261\261B\031\317\262\335\226"
+	.ascii	"=\3600\016\272e<\304!\3023el\303u\217\020S\366\324\261\016\r"
+	.ascii	"\214\353\236c\204k LY<\006\211\362\316\257\254c[v\313\337|4\006"
+	.ascii	"\345\242Li4\302\305\035z\330w\340\036\267(\253\305\036T\213r"
+	.ascii	"Z\016\207t\335\203iQF\313\035\270\247\007\2132Z\332C\270\007"
+	.ascii	"\2132Z\016c\235\036D\213\262Z\366\240Z\332\362,\017\3730\326"
+	.ascii	"\211\207ni\003\343\233\233\be\034\244\347n\327q\221'\356\366"
+	.ascii	"P\266;\221\346@\256\351\234\neQ\016v\266,\312\301^\033\351b["
+	.ascii	"\026\345\256\003\023\273\261\210\303\226\301\256\003\023\273"
+	.ascii	"\261\210\303\2269@[\3361\366yh\267e0\266\353X\207(\367yh\377"
+	.ascii	"J\236xX<\006o\206pN\237\2076Li\023\345>\327\360\020\356\266M"
+	.ascii	"\347\300\224\363\320\356D\271\007\345b[\032\201\262m\224m\330"
+	.ascii	"6v\241\021\266c\3128H\317\035\347h\023\007\3332\007h\313"
+	.string	";\306n\244\213\031zl\303\265L\031\003\341\032\247\3175\334\211t\257w\2122e\034\244\347^\307\303c0\316\001\032aJ\333x4A\020\356C\032\330\213\306\271\3335]\354\201\207E\243\034\274P\332\306\243\t\202p\337\241\353^4\316\335\256\351b\017<,\032\345\340\205\222H\313\306:\326!\312=\030\017_\312\270\206w\2025\234\323\3538H\224ob\034\"\\\317\224\034\344\364\330\206\353\256\003\023\373\220\206)\215s\357\001\022c\033\036v\"-\033e\235>\244gJ\034\371\206H\003;-\023\345\342\257\004^`\304!\312\001\207\352\250\003\242\227!\222\347\221$D\"\"I\222d\230\003\323\030D$\204\345@\021\\\347\001\023"
+	.string	"\306\317\350a\240h\227\023\231HAR\340j)\"\033\367\2336\207S\236\361\236\323\257\305)\315\353\253\034t~_8H\251\006\021\357\2644\030\263 =\254\324\244\f\2450Q\020j3s*\211\223_9\252\207\365\250\320B\242N$\257C\340M\203\253\277\250\316\207V\260\0035\023\b:Y4\005\345\344\322\n?\271\360\311\317\023\277Q\265B\b\245\371\"\034\210\003_82jb@\252\036\252\216\026\341\3326F\t\355\256%\345\220\t\222:wRJ\375\210\365\353\320\272\020\370\216\3316\036\226y\261o\005\026\351z\313\201m\033\224\365x\352a,\nF\261\2729\234\211\362\222M\327G\234\220\350\026\346\267d\0010\304\332\324\b\237\021zN\211\323\2609\374\250\035\250\207[\306/t\222\232\\ht\240zR\32578\207\300\267t\257\261\330WG\030g\013n2\321\031\001"
+	.ascii	"8\177\271\003\265\327\302g\331\374\026\031\334\331\221q\356\023"
+	.ascii	"\004M\311\334\203s\257\316\367\\\242v\345q\331j\205\240[?\374"
+	.ascii	"\327\032\266\026\t\264\013\024\231p\002\351F\315\271\355\336"
+	.ascii	"k\300\0355>cJ\177\375l\230\b\246\235\003(\030\\\271\003\3735"
+	.ascii	"I\005\351\227[3\371\r\254\\\017\006\1775#=v\262j\301uU0\244\346"
+	.ascii	"\326;Zth\254\265\001mLW\b\261|\3474_\245\354\307<L\272T\211\210"
+	.ascii	"AFx\302\001\2362\332\024\021W\022\005\032\337\225\bn\373\257"
+	.ascii	"\232\362X\333\227_\203U]\364Z\356\003\025\311\004\340\253\363"
+	.ascii	"\357f\276\337\236\230<\255TD\037,\224[CP\223\232Z\2201\323\270"
+	.ascii	"G\276\305\201\323E"
+	.string	"\034\263\020\2278Fjl\375\315;\262\024\200\2339r\355]\355Bo \216p\243q\017\353a3\032\206\0323\277\2778\224\024T\366\316\353lSa\233(~\"\362K\252\273l\254\346<\223\237\3604\177%\207f\3240\2414%}\353\261u\226\236AM\270\224\225zPS\033z:\372\251\302w\345\277!\3742RO\223\256\301\374\030\276\252\242\f\3057\006\004Xi\020\227T\327`\304\335\262\211h\345\3441\250\026\235\f\030O!\310\237\305\272\266\262\355)\254M\271\236\214\254\026\312\366\330\203\372e\202*A\363\211\235\345a\322\222i\024\254l`l\360y\205|\277J=y\326\226\243E\320\377\035\215\202\270\017\301\342\262\020\376\236\025\364\274$Q\220\b\243\247w\361\270\035\275\371\350\t\b\370\001\"|\024Q\017\377+\226\267\"\303\377\253\306\352\336n`\204\235cS\244{8OX\306\005\250}\022\363\370\255?(\251\234"
+	.string	"Y_\005OY\302"
+	.ascii	"\227\344 m\356\364\373\272@\347gQ\311\345\337\027iN\216\227\226"
+	.ascii	"w\363h\353\315\307\245\177\333Fa\207W\024\304x)\262\001&\245"
+	.ascii	"\202\007O\3227\330[d\005\367I\205(v\206<\232\217(\202u\274h\272"
+	.ascii	"B5,\324\331\206\215\024vA\344.\022\266\f\273)\304H\332\201\302"
+	.ascii	"\377\f\013\315\036\271\0271\026\rH\231\006\277\023\255\032\033"
+	.ascii	"\007\221|\3266k\235\255v\025\275ijwv\027[\334\374?\352\023\273"
+	.ascii	"\324u\005\337[\277T_&d\343\243M\026N\327\246q6\354eRy\342\266"
+	.ascii	"r\347\204\246 *\212|\374+\032\272W=[\337\356\001\341$g\377\013"
+	.ascii	"\bU]\356F}\211OAf\037\261Q\342Un\b\375\243\260$\267\337Vb\233"
+	.ascii	"\357T\371\004\226\375\242\353\332\3121\0024Y`)\243/O\324\022"
+	.ascii	"^\243\207\300\302dF\003\001\350\320cdpu\335P\337\334\265\222"
+	.ascii	"\024\024@^y\005Fx\005\246\321\343\001\303\230"
+	.string	"\272.\3457(\220\345\200n\262})\300Gc@\350\304\205\030H\b\t\210\354UK\322C\020_Cm\244\357\207\243<%\264\022y!l\261\317\243\032\323\367\311\262F5\352\200(\032\303\023gn\030 \024R\267$y9\n\016\2078\247i\233\016r\320<\263,^\325N\227\355F\255\322\315\316\2565>\236\344\211]\204\225\353\316C\213\235\245\b3\245fT\205h%\202#CJ\341\004z2\027\356\263p\022\036v\351\225\0012(l{kA\025\347X-\304\025\225\"\241\255\212zK1y0\273\343r\303\222\316\232\036]g*=\347\246\322\305\232t\335\225H\271\021\252^Q\303PO%\256\241[\211\371aG\032f\020Z\316\217#J\314\362\313\320\372\374\006\232\374\rV\tq\213\223aznOv\356\035\b\202\004\267\202h\363B\266B\370a>\005\242\356\213\332\242R\265\020N:m8\303\370\204\374\236\221\254"
+	.string	"d\347w\273\321\213'\321\323E\267\210\231b\330\023{\2139\337\311\232\260*\203w\002A\343\272\204H\030}\263JE\333\301\032\204\210\007\202\374\3267;Y\211\342\016U\265\343\272\356J\222\016\272\2431\204 \252\333\313\215\315K>\207\001\275F]wD\333\254\316\260\237\2011#q\2102\227\354\320@y\304IB<=\234\351\254\361k\277B>\307<"
+	.string	"i\325\370\376\031\330\3136\344\263\375\213\256\266?A\345\225\235\337}a6\335\260\246\352\210\210\354\200\275D\230\376\244&f\212\"\214/\354$\226\364\341\203|\240\f\223\023\250\333\022\331\233\267_\304\017\003{\313@\304\324\214\232)`3\nH\270r\250U\240]6\270%\0271n\265\317\002N2\341\245\363\007\341\222\223\266\240\002=3-b`5\036P\310A\310\234Xij\274\360a\202\337\n\031e&:_\34422\272\332$\021x\257\204=\335\235\341-\027\004\371\n\330\312\365IK\262m\031\2049\226\177\b\237Bw\333\336\254\262%\030\t\006:\304\342\350H%\335\033\267n\217_\310R6+#k1{%\t\006\377(.W\370\357r\034B\201\370\314\005]\370\325\251D\022V\316\023\2426\316uW\017\340\256U\271\00286\223\336z\032\200\310\004b\277\217\257\275\370\021A\007q\215\241\275\026\177"
+	.ascii	"\251\212\022\035-\"\317\375\016\026\006\212\"%z|\266~eNftq\212"
+	.ascii	"4BM\350.$P\027\356)x\321)3*\204\320\337\337\365;\260\206>h\001"
+	.ascii	"\247\323Lo\367\177K\001V\353\276\336\t2\033d\262\246SY\353\366"
+	.ascii	"\017\327\013\247\256\350\352<\355\304\206\305h\220\n\263\360"
+	.ascii	"\241\003\n\263\264\222h6\006Mf}\365{\226b\326v\344IYU\001a\333"
+	.ascii	"\211\212H\324\364m{`>\265\320\340\371%k\266\231g\321F\365\377"
+	.ascii	"\344\313Dy\312=\224)e\367/\252[-&\365\200\221\250$\311\270e\335"
+	.ascii	"H\243\246\342\271\333\021\330\232'\220+\306\037\3344\237\224"
+	.ascii	"\242n\300f\243\352\331\215\007\026\320\217\017\271e\020f\fG\201"
+	.ascii	"\207\356Yx\242\371<\013\241k\213\321k\325O\331\273\b\276\021"
+	.ascii	"\365\203"
+	.string	"SA\026\030\035*\177\323-\330\254\r\232\nA\304\2216!\2312'9\231\242\335"
+	.string	"\035r\247L%\331\217\272\313\324d\340\006\255\036\254\335\rz\307\203@\035j\233)\006\367\313\035C\031\307\372g\n\322\017\224\211ed\227\225\213A\231\265\003I\224kQ\f\223h`5\253\226%\002\226;\025\304\302\021KrwTZ\351n%c\251\356\224Z\362\376\"Y\0251\253\340*-\334).\255L\225\004\034\314G7_\244\177o\250\375H3\0230Z\300\201\307\202B\033jK\\U\013\"B\356Q\300\316\242G\2474$1yrA\322\021\322\325\016IF\026|\207\34101}"
+	.string	"\360\311\364\221\324E\364\327\375\371\366W[Xv\313\301\215+vn\n\272nv8\2044\355K6O>\264\361\217f\332:\232e\027\026\224k\031\3543\364\3106?y\264\264\025ut_\255N\032\336\261\357(\017\214+\317\025z\214+\246\256\\\213)\3348r\306\265e\344\301E\021t\001\237\365d;/t{\376m\001T&!\240Y\227 ];8\255E\371\037\331\242\365\036\341\376q\300a\304l\200"
+	.string	"0w\303*H,O\262\266\023_4\325\320J\325>/\312\2670\3527\350\246\034\266\022i4\271\356\302\221\001\225\261h\301\241\351\204\337\360(ur\347Z&\371\"x\302\226\316\"\255\253\204\275\347\314\352jZe?\220\245\342t\331\362^\263\233X\\\245\303v\252\006I\273\2427u/\327\252\206\312\266\351\270o\276^\262:75\330\377IA\230\026K\210F$\254\251\320o\276\240\310B`\326\374\b5\327\023\272\322n\250e,\r]$ \355IjBT\355\374i\243Q\251\357\032\023LV\n"
+	.string	"\362p\"\334D\f\024w\020Hl\340\013\242tj\246\231L\336\3100\211\230\242\fW#\206Y\023\026I\030#;\"\376j}Mq8$\366\32472\251\017\236\253\370\0050@\242\220d< \242\004\r\005\255\233\352S8\033\"\307w\037\321\0236\212\260\320\276\316\256\007\347\335\311\300\372\205\t\241\230\256\243\240\204\253\026u\234#\027\214\006T\016\230(\314\245\217h\2146a\n\310\352\320T\363\222Nr\300\035\\\313\215\355\246W\261\241\r\266\330\353\036\261\241\206$\244\032O\353^\254\374\252o\227b\312\035\362N\255\366\376\025\030T\202\230\254^\271\305\262\nk\255\342\276\n\206\022F/\020U>\240(\030RAKE@&\201U0\312\224$\246\220\333\300\372\267\260\025\333F8\372\210\272\031lBr\013g\206\364 G0D=\370?\031'\350\371K\270\366"
+	.string	"\3610\006_\2649-\231\341\361B.\313\336\263\016q\270\302\336F\250I\240\361=\f\321[\357+\375\326\367\277\232\3240N\324\277\330b5u\025s\013\364n\2507F\242\351\275 hqCd\022J\314\3359R\013e~\312\312j\255\214)\341\343\356\255\353\300\3311\345@\t \351\336`\235\205\336\305\220[\n\253u\320\f\326Q\245=\231\240p%\272\206V\215Kv\367\311\004\036\365E\017\004L\253m\030\377\363D3q\246\262\341\233!S\0227PqH\325\261\306\256\005\033kY\fA\034>\314J\316>G\024%;\276*A\006\177V`\234\034\r\007\260\025\027{/*\255\f*Wl\272\336\353\200Y\227\022\324+\322^\364N\330X|'\244\343\023"
+	.string	"\353P\037\343\2058\242\217\317V\261\036PQ\373\262\344\316\254\207\037\271l}\2155\006R~\363\025e:\304\302K\236\263\317(\n\2675 \233\355\333\030\013E\212wt\227{\375^\006Z"
+	.ascii	"\305\204l\262n\343\254P\t\334\263\235\356\325\373\032*A\0042"
+	.ascii	"\321Np\244\374\317;E\244\0073& \263y\214\223B\2355d\232\344\367"
+	.ascii	"\314T\215I\347,\007|\346a\341X\032R\204\324\177\274\353X\253"
+	.ascii	"\206\257\276S\234\030t\263\363\324\312\301\3638o\310Pa\277}\303"
+	.ascii	"\372\261\204\261\b\231u\240\354\224\251\377\372]^\217Z\327X\340"
+	.ascii	"\217\367u\244\005Q` \370Q3\200)\246\003\217\f0\230\262\262\333"
+	.ascii	"\320\210o\247\004\240\036\f\030|\032\222\221y\204\271\026\233"
+	.ascii	"G\356\374\312\261NV\rP\t\276\221aP\032\243\2042p\220\3176-K\327"
+	.ascii	"\247\205\354\213W\327w\025\225\314\356\212p\205\376\0367\225"
+	.ascii	"\332\007\217\355]\001\326\367\335Z/(\t\004\201\236\320\353Y\317"
+	.ascii	"\202=\247$3G\313-0'V\352v\017\221D\246\240\327LQG\253\235\244"
+	.ascii	"\260\361\303\3130\371fB:\254\337\007\365\033\324\221Q\001\253"
+	.ascii	"\241\374\262i\203\327\025\f\215\302<\017.\365y\203{\0274^\341"
+	.ascii	">9\022\340\304y\207\300*\367\342E\376\341I\327_\205\251\004\244"
+	.ascii	"]:M\"(^b\355J\034\232:\223\220\330!\375\2233\007\273\201!\245"
+	.ascii	"\361\321\001\317\320\311\262r\335v\027\022\235\332+5[\261\200"
+	.ascii	"\240\311\230\201t\277\272l\375d\366\2564\220\366\3756\343m\227"
+	.ascii	"Q\307c\304\244\340\271\330J\356y\377i\265\225\277\352\245V"
+	.text
+	.section	.gnu.lto_settingsBuildCheck.192.61bca6fb06857629,"e",@progbits
+	.string	"(\265/\375 \306E\005"
+	.string	"\262\311#+\200\305\351 p\003\2703\036\246\200\246\nu\254\\\312\244\214\262\241\366\316{\007\373\332\243\333Z\224#\026\346\032\310\230\222\201?\331[\246\227b\205\230f\255\262b)E\007*\3534y\232Q\202%Zq\204N)$\345JQ\224\037\256\027j\320\0022~\356z\020\362\257\323P\373\237\263m6s\351v\004"
+	.string	"4&`\231\374\337\347\326\257YN\322\204\255kT\272\356f\030Yk\237\365]\312\016\260\354\332'0t\367\037\226=\366p\377\027\376\307\3773\b"
+	.ascii	"3\003\316\231!\340\313]\303\323B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_.symbol_nodes.61bca6fb06857629,"e",@progbits
+	.string	"(\265/\375`\211"
+	.string	"%\007"
+	.string	"RK). U\222\016#P\320\231\366\t\376\327*\200\007\300\020\001rEA\001\202"
+	.ascii	"\221\001\001\001\001\001\001\210\267\221.\343\355\263f\255\265"
+	.ascii	"v7B\222\fm{\225\031\fc\272hZ4\247\242;\024\345\231h\0176%\366"
+	.ascii	"\210x\006b\031l\357\341\013\233\016\2074\034\303\360\b\266\267"
+	.ascii	"0\f\266\247\360\013\266\227\260\013\302-\007\263\030\214\203"
+	.ascii	"\315\202A\260I\360\0076\007\356\020x%`\024\200o4\246s\264\212"
+	.ascii	"\350\224\320'\240M>\227\340$\330\236\264H\233\206]\203U\276\r"
+	.ascii	"\266e\033\326\325R\255\216\265\344\234s\245~\254\355\034\001"
+	.ascii	"$ \240\023c\003\314x\036y\344!\217\324\226\310#\265\025\226,"
+	.ascii	"\217Jm\305JK\362\330\034\275\365\026[\026y7\262\270\261\227\361"
+	.ascii	"\n$\217<\346\221G\036S[\202<\372Ih\254\375\004"
+	.text
+	.section	.gnu.lto_.refs.61bca6fb06857629,"e",@progbits
+	.string	"(\265/\375 ;\331\001"
+	.string	"7"
+	.string	""
+	.string	""
+	.string	"\032\003\002\004\002\005\002\006\002\007\002\b\002\t\002\n\002\013\002\f\002\r\002\016\002\017\002\020\002\021\002\022\002\023\002\024\002\025\002\026\002\027\002\030\002\031\002\032\002\033\002\034\002\035"
+	.text
+	.section	.gnu.lto_.decls.61bca6fb06857629,"e",@progbits
+	.string	"(\265/\375`\261--\304"
+	.string	"\232:eDW JQ9\351_\017\377H\334\313\033\361\231;M\310\215\276.\266_\346\241\217w\255\177\374^\253!\325\235P\325\327\336% \006"
+	.ascii	"\314\n\232\305\016\326l\303k\303u]g\251\252\243:\212\263\024"
+	.ascii	"\327u\035\004G\241\274\227,8\301\"\bB\354\224^\236j\311\344\357"
+	.ascii	"-e\n\236\0034\004_\004\315\"\375\"\364\363\"I\323]\333\367M\037"
+	.ascii	"B\026\rW\271T\327\305M~_\027\346\3023\370(=/s\207\213\033)<\272"
+	.ascii	"{\225q\354\205\235\334\205\341\316W\270\355\375\274\227\354\336"
+	.ascii	";4$\264\223D\006\257'\324\236\261\244g')k\341-\354\354\300o>"
+	.ascii	"n\270L\265\021KEp/w@9/\217;\240\347$\351\331Hz\346J5\340 \324"
+	.ascii	"\232q\020\225\233\306\315]i\331\221\236q\244\227\343 \364t\034"
+	.ascii	"\2042\024\337Y\312\317Qx\r\beZ\3750\023\025g\236\034\204\246"
+	.ascii	"]\030\b\3454:8\b\305\240\b\313H\317f\314gg'\237\261\331\316\345"
+	.ascii	"d3I\231\271\313t\373\320\363\006LJG\3333S\312q\314f(/a2vr\300"
+	.ascii	"eg&\334\3448J\317\347\363\336\347\017O\224\032N\252\332j\340"
+	.ascii	" \264\031\b}\b\3223\007h\315\313c\016\320\363\021FrN\342\344"
+	.ascii	"$,\306\037\334\24515\026\220\314\302\304Iw\255hx\330\2012\306"
+	.ascii	"\243\r\347Hsm\256\355\363\007a\204\227\351\335\213\344\336kA"
+	.ascii	"\017\034\0130W\311\201cw\204\023 =P\372\243\367\262\300y^\346"
+	.ascii	"R\017e\034f\017\177\017W\016\300\177{\357E\270w\251&\035\002"
+	.ascii	"EiFkp=\334\233d.\311\260\222\033\226dJwY\366F\265a\371\27478"
+	.ascii	"\\2"
+	.string	"\255\273|6\223\266\231\354\373\274J,\252\253l&\223\226\317\313\274\317fR\303URiX>\225\222K2,*^\2225\2516\\\345M^\245\322\215T\331\244Z\2725\2514,\311\224\250\226J,*~6/\317\300\366\304J6]2\245\236{/\324\263+\331\273W\211y\223p\035u\261\346\242n\215\313o`O\255+t\357M\232\311e5u\236K\367mI\244y\324t\257\334\215\022!\311\311\347\275\327\351.%\371\336\246'\363\336\245&\t\253&wqb\336\236\253T\202Z\312j\366\232\226\232N\227\310\r\276\367^\252%YV\323\267\306\204\254\353.=\223\274\204j\336\256+\207\305L\311\222\317kv\357\3454=d=\254\240\332.\375\214\301\337H\177\017\3776\372\333\304\337%\376\376\375M\364\367\007\332\003\177w\340\357\f\374\215\201\277+\360w\013\177\263\360\367\n\177\247\360\267\210\277OX\300\337\n\370\373"
+	.string	"\177\227\360\367\b\177\213\360\267\357\357\017B\374\r\342o\017\376\356\340\357\274\377s\377\323\374'\363\267"
+	.ascii	"\376\016\300\337\031\374\215\301\317\377\337\345\177\334\377"
+	.ascii	"/\034\3643\207\237)\370y\202\237/\340\237\355\177\273\377x\377"
+	.ascii	"Q\370\233\001?\207\320\035Z\25094\005\035\324\0234PK\320\301"
+	.ascii	"\317\036\374\fBo\370\317\301\337B\017\nP\377:\200zAP\335\320"
+	.ascii	"Su*\316\317F\032\376\376\371\277V\344g\027\266\304`\250`\332"
+	.ascii	"@\355\3603\t\315\363\367\316\377\343\317&\350\374\235\326\r~"
+	.ascii	"\216\300\323\374\214\242\321\3779\177\233\371\371\212\347\257"
+	.ascii	"\n\370\231\3707\316\337\366\357\372w\377\315\177\377\347\273"
+	.ascii	"\237\355~v\363s\335\317l~^\363\277\347\357-?\253\371y\356g\265"
+	.ascii	"\237\315~.\373\331\353g\037?\327\370\371\305\317U?\263\370\231"
+	.ascii	"\371\263\324\317P?\257\370y\371s\323\317\312\237\225~\276?\247"
+	.ascii	"\370\031\206\237\213?\037\375L\342\347\017\374\354\201\2379\360"
+	.ascii	"\363\210\237%\360\263\003~>\341g\004\374\\\302\317\"\374\234"
+	.ascii	"\301\377\263\377b\377\t\360\037\313\177\013\362\362\362\362~"
+	.ascii	"\034+\177\316\206\177\203\257\312\252l\266\2551]pU\251*5Z\226"
+	.ascii	"\034\2647\354\3547\365\336\026\035\200\315\275\221B\227\036\351"
+	.ascii	"\241\202\311\026\330]X\347\375m\327wj\232Hii\333h|o\274T\315"
+	.ascii	"\353iK[\241\272\314\301\252\253k\264\272\037$Q\317\251\266\317"
+	.ascii	"y:\303\316>\323m\262\304t\345H\361\001\306k\013u\203\252\302"
+	.ascii	"\322\366\315\346o4\235\246"
+	.string	"\243z\234\322\224\224m[\215\357\275F\216j\315E[\034\006B\353\007i\302\260\263\303\264\031\236\245':b\252\b\241\333\212\333\361$J\333w\231\277\305\364\230\2344*\272 m\233\207\357MfGm\356\310T\333\364\271t\203cg\303\265\234\316\362r\020\326\304\346kkH\\\222\376\3627\227\356\342s\304\205\223R\333\216\363\275\275`\2206e\255m\016\003\241\366>Q'oo\r\206\263\2746N\255\211\315\027:D\213\226nc\242i\373y\252\222v\347\346\326h\351\322\262Y\200[\006\357\353^\032\037p\230\316L\265h{\234&S\330\331S\272\315\203\334V\216\017\274)\030m\337W\376\246\322U:j\350L\f+m\231\211\357m\245F\241\322d\327\226\205\270\322\330\331i\315\346\266\003\304\211)M\333\267\224\277\325\032J\3652\345\305\244m\257%\240\207VX\333\312@hk\200\343\202\t;\233I\243\231m\365\314"
+	.ascii	"y\333\322\366}\366w\2236\303Q\243\"\212\256-_\361\275\235X-6"
+	.ascii	"SB\332\266\007<22$_\222\260\263\223\364X\n\032\356\305a\243K"
+	.ascii	"\251#\004\213\215\335\263\225\264\263\243\246\354h\306\265\345"
+	.ascii	"(\276\367\363\207\013\2245@\332\332\247\231\224#G\032\314\203"
+	.ascii	"\206\253\214\233\321e\307\214\260\263\2154\230\207\347m\341\023"
+	.ascii	"\367T\365a\013=3sb\322\366\375\365\216zb\233N\252\356\332\202"
+	.ascii	"\340{{\241_2\334\250\013\3227\330\3317\232\210\217\223,\350\215"
+	.ascii	"0c\234\206\264\212$\025\262\266]O!\234\273\274 k\332\276\205"
+	.ascii	"\374\215\325Y\035\244\327\344\361\"\006\rZ\333.\241\312\324\224"
+	.ascii	"t\266\275\255\221\376h \354l\256\336\361\346\321=.\364\274\367"
+	.ascii	"\311\275\227\253s\264\016\022\232\230:RY_\\\355\203\337\370$"
+	.ascii	"\237wj\207\013\230\024\036\335\220\216\213+5\333\"e\r\366\352"
+	.ascii	"\330\362\3612g\227\326\366\311c\265LSR\227\266\226\357\215C\007"
+	.ascii	"\312\221-Zm;0\020Z\301\345 \2646\353\230\364\f\306\374\204\235"
+	.ascii	"\374\244m\244\360\274\311\035\264\266&6t\227I\343CKQ\"\326\244"
+	.ascii	"\306\317\022\025jn\314v\206\344x\361\243\355\373\352\3474Vk\032"
+	.ascii	"$.\207\022A\242\300\332\316\020\372p\301\274\230!=\257u\214n"
+	.ascii	"\272z\321V\r\243e\264\013vv\214\226jfS5\213\245\222e\340)\\\245"
+	.ascii	")N\007[\211\301X\232\t\nS\2159\266\216\321-\272\252\222u\245"
+	.ascii	"Ne;b\264SGU\262.\235\0258h\314\335\373\034\022\032\032\032\032"
+	.ascii	"\322\001\203\246dJ\317\226u\217;'K\332R^r\020\272\201\201\246"
+	.ascii	"~\235\235,mbt\261\245\257f\351\337Q\rU\227P\315\347\206\237#"
+	.ascii	"U9|\350\254\275)\342\242m\253\350\025\357\247^\366\223\b\315"
+	.ascii	"{\225\372\351\307\356^\245\037\346\r\2307\260aY\\g\250}]\222"
+	.ascii	"\276*I_\301Z\371$\3631\023\373\021\245\243\225:\331\227\235\275"
+	.ascii	"\364^\3425\234\007\205\311\312\215\345\3523J\212\02675\327K\f"
+	.ascii	"\206\3250I\315\335{;\f\r\r\371\304=\357b\244\026O\310\272iZq"
+	.ascii	"C\225\262\035\267\3417\365\331\225s\026\267\202\235l\307l\370"
+	.ascii	"y/\022\241\034fV\335\024k\231\216"
+	.string	"\353\330y\001\273\251\311\261'\222\336\324T\217f\333W\025\351\371\002\224\363\370\002\364U)}\213I\337qizdT?\234\250\245g\330\311h8\214}\b\277\217\321\260\030\236\253b\314\024\312\022\274\271{\311\204\206~\274\334\220\300\260\226\315<9\fM\325\334\221\224\3070\031vr\231\333\261\346\263\247*\275\310\002\305\003\372\303\036\320wW\372\216\221>m\031"
+	.ascii	";|\267<zi\344\310\300\332V\240\303n\365\356[\016\273\365\333"
+	.ascii	"\0336G?\221\200\232ae\246\355\347\246|\2678\270\314\260`\321"
+	.ascii	"\262YYL08\332\336f\375u\006\263a\271\302\345M[{\303w\213\225"
+	.ascii	"\227\307\266\243\255O\323\332\370\2021\305\254\355\255\215\337"
+	.ascii	"^\331\032\375D\202I\231R\227\266\254\203\203\320\240\031\276"
+	.ascii	"[\032)\036\025\251\035m'\220!\207U\327\004#\206\231\234&\267"
+	.ascii	"%iV\335\306\007\214\n\034g`\324\373\303\264\203m\307\0134\036"
+	.ascii	"\250/\2677\027l\035$\307ES5\326\273:\303\345J\2136\364I\226,"
+	.ascii	"m\226E\203YQRqC\305\314Qv\346\242\355-\363\267S,\003\b\362\356"
+	.ascii	"\332\264\355\211\362\335Ji\2412\347l\333\263PO\355%\246\325d"
+	.ascii	"\237\376\216R\303,\216\032al\254P\321\263&L\226S[\025Jt\251\304"
+	.ascii	"\"\262\264N2n\340Xa\235\310\324t\360\230kb\352\211M\265 \322"
+	.ascii	"\226\t\004\250\035[\312%\"\252 qv\311\354\356\307\323\026\253"
+	.ascii	"d\223LL7\246\266\267\311\277\342\260\267\237H\240y\\j\242\330"
+	.ascii	"\371^\363x\224Ug@\360\356p\304\226l\316\352\335_\355\330\n\017"
+	.ascii	"\027-\266\264\325y}\343fM\227,\325\315\337q\265.N\r\215\216\266"
+	.ascii	"$p\371^\351:I\216%\2176lx\2760qsR\325\324\265~\"\241\226\245"
+	.ascii	",\007\0324UM\003\314\256\022\225\207*I3R6\374x\363j\0175\215"
+	.ascii	"\216\362y\311t\274\244\2712\223K\337c%J\224:\267\263\024\244"
+	.ascii	"L\025\235O3\312\224\22793\226\f\2142vm\313\350\2305u}\265}\017"
+	.ascii	"\221\364#\264\205\315\255\271\235\214\005K\313\024\214|\315\205"
+	.ascii	"YAr%H\0307\2725)\225\312\227\231\227\n\246~\251bj\230J\246v\251"
+	.ascii	"cj\034;\253\\\205k\253R\323\2048k\027\227JEE\225\253Y\352\f\026"
+	.ascii	",-U\250\301U\345*\226\272\345\223\263E\025\306-\355\301V65\201"
+	.ascii	"}\017T\372\036\336\fo:MZXJ\317\013EJ\351\246m\335R\265\274\007"
+	.ascii	"\217\b\\\230\364=.\351{n\351{U\322\367\244\244\357\245\245\357"
+	.ascii	"\231\245\357=\323\312Ve`\247P\235\002\267$E\243\355{`\351\bn"
+	.ascii	"\036\013\241\357q\245\036z6\316\330Y\317j\232\235`-\tG\303\027"
+	.ascii	"\205\271l[\323\272>\251j\257i\025\255\247\254i\366^%\346\r|\230"
+	.ascii	"7\300\231\362Ci\tj\337\273\351y\30649;k\223jf\225\317K\365\002"
+	.ascii	"\225\222(t>N\246\264\221\322\266\232\361\214\201\201\325\262"
+	.ascii	"\006X=/\213\fP\ry\361\345\244H\324-#\333q\212\2522\322vI\023"
+	.ascii	"*B\336\264=\217W\372\032\246\244n\371\324{k\230\351jR\235\365"
+	.ascii	"H\335\3427\253\004\204\225\231\013\241:+\222\256\312I[\013\243"
+	.ascii	"\243\273\3679V\305\352\223\235\325Y\223\f\t\3319)\247\232\324"
+	.ascii	"\236GFz\236\251\364<Q\351y\236R!\036"
+	.string	"%\020vV \325KC\023SG*.l\3562\255|\320AS\365\202\256\275\252\021\035f\031.pm\213<\205z\313nL\307\231tH\325\252B\352\263\013\205\254;\"\354\254Cj\020eo\315Ur\206\255B\376\312U\273\352\026\211\253+\270%-\351\007\034\204\242l\351_\233ggmV\037|\273$\020wd\3562\255>\370\324\251-\273\332\366\360)\342VEK\333\357$Iw\260\263\362\250YJ\036U\253\352\3407\253{\251DX\243\032\362\202n\250'F\005\330\231\265\257:\376z\243b\325\255\026\352\204 \351\036<0\2747m+\016\337k\216\345\233\260\266;;W\351w\234\322[\341 \224\247\316\212\235\325\252\326\300\302^qm@\266\322%fZ\254h\373z\365\327\030UFGIq\341\322\266\316\360\275\322@\361\352\236\314\332\3760\020\232\336\2533\303\213\027W\314jU\255\002\023\2463\204\005\213n\363"
+	.string	"\306F\023\033:\235\027\225Y\231=\206\327\304\206\256\007-\311Tj\373\264\215\224T\263\351,o\001\240\232\330|u\201\202\3526\234\345\035\300T\212VW\324\025`\226^\313\245]\332l\252M\335\346\201\356\256\006?\002\261\202\005T\030\021\002\03142\376\220H\"\020Bx\001X\034\212\b\032\213\"\220\202\310c\212\021G$`\020\362G B\034\215A\024BcQ\211\237\321H\347H\324s$\302"
+	.string	"\322Xl\241\b\b\005Z\204\036a(\032\355qX\004Z\rl\340XL\262EA\343/8\004\346\2400\024]0\026\217\306\023@\235\024\277a\322Q\350"
+	.string	"\021I??\002Q$L\022\032\026\213'\020\341\024\005\221?\024B$\320\204\343/\003F\341\017\350G \216E\024\306\3401\004\362\310H84\001\200 \021\362D\022Q\330\203\374\021\210\020\304\"\022R\021X\001\n>\022\2418\036\355\034\361\221%\b\026\025\221v\220IB#\362X\024\034\206(\n\2018G\242c0\350h,\016\213\"\206?!0\230t\3541\006\207'\212\202G\300\021BA\344\317\005\030\212C\023\306 \n\nX`\f\026\021\205&\202F\304\237\013\030\2348!\2051\210\242\b\f\272pt\374\031E\b\005M\374\216C\341\017\002@\301\244\024\0268\036\177I0\024W8\016\203D\342\357HD"
+	.string	"\210E!\3627,&\251"
+	.string	"t\241\202a\021XD\026\215- \301\320\302\217@\204(\321\301\350D\211`\221\217\321\217\005\n\212\306\237\361\007C\221\361\227\002\020h\002\005&\222V(\032S\2400\374\225@\022\242\020\364#\020A\243\037rXD\301\341G B\034\215\305#1x\274\340\030D\372M \b4\236(\2160\006\221A\026\220\304\240\321x\002\310\201C\020(D\021t@\f\305\022/"
+	.string	"\177\303\023:\004\213\212,\2140\341\204\021\306`\221\020E\321\330\302\210\026P\240"
+	.string	"I\f\"\021\215\204C\023&@\n\211\027\370!R\300\204\t\nh@\036\211\216\350\261\207D\006\217&L\024\321\242\340\013\300_\022z$\022\016\201;\306\337\021\320\006\221~D\033LJ\201\264H\f\b\207@\rH$\021\t9C\364\biD\f\256`B\212\237\321\370\303A\006\211\206\022\304\020,\"\252\200\334YA8\004R\220t\342\205bq\210\"\177\024\303\017\251\036\211D\304\360c\201(dA8\004n\310!\n\221j\f?$\242\020\t5\022\232 \026\201(\222\210h\224\204C4J\252;H\342\211\242\210\024F$\361\001\301a\211\237\005\202'\206?\024\023 \211\f\340C\022\205'\322k\360bR\320\030\002Y,\032C\360\274\204\022Dhp\201\t\240\220\002A\204\b\002\177&\214A$Q\030\202(\374!\205"
+	.ascii	"\032\217!@d\360\0020x$\242h(<q\302\321\210(D\"\203G\t\016\024"
+	.ascii	"\032\203\304\240Qz\021\f\340\201\001H\210!\247\f\031\031PT\246"
+	.ascii	"\264\275%\363[1v\f\231/mSm9\0030\276\3330wO\320(\265\305\200"
+	.ascii	"\201\344\276\330\251\241\253k{\373\345\267q\326\013\217\n8\272"
+	.ascii	"\252\266l"
+	.ascii	"A\017\337m\227\034\0367\222\364\260\\,\\\227\311\222b\341\376"
+	.ascii	"\344\315\fU[\213\346\273\235\241i\304+\353m\313\217\030\2508"
+	.ascii	"5\034\267[~\273\303j\351'\022?\242x\234qP\0267\024j\314\023\353"
+	.ascii	"\366\3336\213\245\237H0\321\315\345\265\355\r\324|\267W\304\334"
+	.ascii	"\330\224V\2528\031\022\304\255\355m\225\337N\261T\370f\361\261"
+	.ascii	"\326\266\3378\b\355\200\315w+"
+	.string	"\203E\362\245M\232\266\037\244\3305\252\037]\272\264\275]\373\255\227\215\302..VS[\266b\342\273\205\242\343\304M\216*jiU\206\230*6\355\267h\366\t\016\217*\2656m\371\213\203P\016b\276\333\263\036\035>\214@qbVV\026\204\331\366\326\354\267Ll\023\033ccVm\231\311A\250\004T\276\3332\037*\260\2623\262%a8\264\234\332\336.\371\255\230\035\343\021\333b\007\326\226\2738\b\245\340\312w\373\374\271\002\222\264r*I_0\211\305h{\253\344\267Q6I\017\r!ZoHpb`\271\321\343H\230\234\f\"j\332\336\206\375v\206\005\363i\303QE\252-7\275|\267_hX\356\270\332\002Y#\266H\263i\343K\333\333\"\177kY\"pJ<x\264e3*\276\333!l,\306\252\b\261A\274\344P\242\305\006y\242c\243j\006\\\027\027\234\226\2248\313\365\367\023\2117#F\274"
+	.string	"\261?\230\314\344\205\265\275\375\361\333\036\326G?\335\210\362L\013\203\240\250r\3314\306\301\230s\310\020\225\210H\232$\035\"\n\020\204bj\240\326\324z\022@49\313b\320\"\031\021\032)H\n5\2469w\331\n-\2627_x\351\343\201\236\347!w\352bU78\366\340T\217E%"
+	.string	"c\236\242\350z;\006\204\013%\213\341\215\211*3\3437\nO\\"
+	.ascii	"\334{\213\325Z\203\202?\242\007\300s\330\220/\243\310\325\376"
+	.ascii	"m\036-m\3462\0328\211"
+	.string	":\030\020\b:PM!\303\345\220\\\\\3018\342\266\2436'\363\236\220\f\240\030\253\316\275\353\324u \203\036\365\341\004\026\2130\0273<\311\340\022h\245\244\241\351\330&\375\333\\u\311<\363\332t\3466>}\244\313\376]\256,\324\3700X\0053C\275\323\202\r\310\253~7\323G\307$J\2622\300Q\202&\017S.[p\207\212C\235\371\316\375\221\030\031..@\373o\303I\016\032Z:\320\224+D\302C\360\227H\205j\342\264\001j,^\213\302L\264\244\002\301\306lH\277\325H+\311\017\336\032\016\\\307L\007\220\324\020\374\243u\t\232\fDY\026;\033\254k\326\020\226\270\037\245\331\335\n\354\374^)q\024\212\2546\207G\260\343r\0064\321j\241\321{c\205\203!\025\307\301(%\033\342\226\027\364|\366/d\264\245G\222\003\350\327\017\273\270\252B\221>\365\\\004F\004U\007L\3069\2576\003"
+	.string	"\327\261\334\203\037\351\233$mqG\351<R\356\003\362\021\374\226n\004\224\303^&\341\310\234%\344\201\030\037\016E0\232Q\022\246\330\260*,\240\257\203\004\231k \344k\230o\376\033B\002\2048\207\375\036\261\210\034[qD\341x"
+	.string	"\363\007- \020k\324|\326\204\303\021\336\201ya \220g6\305!\260_\357\326\237\250\332W\320\006\300p\026\230\017\025.\336\017e\023x\344;I[\ne\375iQ\020l\2105\313 \034\252\313\330\274D\217]\346s\227:'T\321\007\341oN\235\026\220T\267\022\277E)\240\2435\032\272k32\231NY\345\250;\226\353\3214Y\241J\320:\030\216+\276J\317\022G\345\230D\267\367'T\203Rs:\361:\374\372"
+	.string	"\331\305Q\362$S\"\227\020\177\031\214\246\3401\320\370\242\342\225\342\006\260x?\002\3545\177\236\374\372\323\254\227\302V?\367\243l\243{\3010\227\177lY\3170\356\304\327\365\375\312Q]\246\315VS\365r\325n\016\276;\251i\016\003\257\316\247ls\2454m\350\227\212:?\020\264\234\214~\030?\r\300\026\364\240l\327\023V\352\351\301/6\004\367[\327#0`\022\210\304\325\036q$\330\202}\377\306wL\212\227\243X\270\276L\027\356\315\302\177%F\313Q\317+h6\374\361=\362s\360\255\205"
+	.string	"g\333\251\2549P\303\347#%"
+	.ascii	"\3757\305\002}\371%\353TA\347+="
+	.string	"\f\354@\352\024D\342<`\215\232:\013\306\206\346\3005\025\343n\214p9p}Y\221\360\205\373\251\366\271N\211)\233\023Wkn\2300*f0u'\307\336n\202\356 \200$\002\223\340I0\232\307\302\221Ebw\205e>\240\034\246\306&D\016_p\371\264f\375\017\310\240\033\245\001\217z\f4\274\274\244\316\336\375Q^D\351q\\\200@\327\001\256\375N\227\371?\265\177va@\177\327\n\f\365o]\351F\035]\026\024q\332\363\233?l\223g\371w\204Gfz\251C+\177NVp\210T[\353\017G%E\004'z\022\306\321:\230&MHa\316\265Q\276\003\270W?a\213wvA\001i\300\215\276\205\264\267\017N\205\034/\032V\312J\344\016\307M\241\377\343\024|<\240\315\322{n#$\013X\007\037\361T\"\306\255]\261\245EK\201sp\264\b\006\251\225\356\247\261\232\215\273\002\2340\375\t"
+	.string	"\206a\367\356P\361\205\223\224M+\002/*\"\315K;g1R6\205\352iU0\b\353\234\274\312\0049\013\226\212\246OhUG\020\220(u\307\315#\261{\031\235\344U\264\274\360\210M\n\200\202\003F\271f\374g\264,\021|\211\206|\270\r\224ha\030\002!\316\240-\361\032V\250\004Ay\343\345\227\262\023z\351\324\277K\3108\2108 \371H\374\370\241a\332#\007NQ\2015n\2546\310\001\263\242\212\204z\271_\370\352\224\233\243\013@\363& \377\313#\322\001\013|x&%\210\211\017\021\226\254\327M\023+\314l\246n\210\nz\034\305Y\330L\322\202\356\364@\034\027*\375\210l\251\2268\340\370\310t\036\241$\332\024\030\251\006\0037\f\t^f\200#m\372_\227\031ax\201\211\221\252\275\003*\325\224\230\254\243L\020C:\240\312Pf."
+	.string	"\203x\t\213}Y\275v\310\342OtM@\\\273\205ZY[\221-\266\f~M,,\362s\t\250#D`i\242K\340\314\250\026b\306\206\373\352\bU\340\t\026d\217\205\004\262Z\254\035\344\2054H\001\312\250@\330\235\363\345h2\317^S(\266\226u\2350\344\376"
+	.string	"\030#S\211\034\262\244\206[\305>h\236\244X\237&\006\363e7\236xe\275\251o\326\202~G\027,{\251l \230\333%3\251zk!7\216\007\203\257\307\005<\324E\006P \215\3631\350\007\365M\0052\272\211s\352\177\243z\272\325:\341>\2073\20532%\342?a\005\257\220\342\303\001\212\311u\"\304a\374(\310\347\340s0+\320\b\326k\237Q\326Wm\206\373\2534\350\360\361\b\353\212\357\035$\020\240\263\24786A\307\362\354r1G9\240B\277Gp.\374hV\024n\304\320\3212\313_2\311\200E\322g\332\221\306\332pp\370\267\233\307PY\266!\223.\036\336\274wX"
+	.ascii	"9\236\253\004\354-Pz\233k\355\251\363\262:\334t>i\017)\2406\211"
+	.ascii	">qGM|8\242K\222\217\366\232\037\216\221s\b\340\024z\n4\210\312"
+	.ascii	"F\211\274\223\306\346\334%\340\214\227-\037\277\251\363W\213"
+	.ascii	"\223\030\204"
+	.ascii	"\314\277\222\b\312\216~\256\342\275\367\345\342\207\203\323\322"
+	.ascii	"\340&"
+	.string	"\016\2053h9\372\351Eg\270\017W<\213\3377e-\276\365\210\261\303\027\007\027\230\334\211\032\350\005\240\217\376~\377%\034B\372\303\312\035\327\337H9C\373\013\346+\230\2370?\342\366\017\t\273A\203\025\030\374\001k\002;/p\253\377\222\371'\353\247\217Glw=]\333\362\007\277\307<\033\233N{\376\311fo\027(YI\036\260WL\\\366k\270W\267A\242\317\344@\346\260\013\364\206\311d\316\037\261;\331\337\272\347\345\315l\004\334\345\271^\242y\004n\312<!'X\262\201\335@\366\256\233r9\320\370\242\301\023\351\345\341\220\221/\324C`\357\246\363\336g:\340\321$I<\r6\262\233\222\316l^\306\003\262\3728+:\314\232\233\242\277\247#\225\223R\233\345\275\216AF\247~\003\310_\342~\276\r\027\217\335rf|e6\332\333\377\376H\354\352hw\357Ul\332\200;v\016\242\377I\330\237\301"
+	.ascii	"\20694\230\323~\235\337R\267\002"
+	.text
+	.section	.gnu.lto_.symtab.61bca6fb06857629,"e",@progbits
+	.string	"settingsBuildCheck"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301"
+	.string	""
+	.string	""
+	.string	"valueTableEntryCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312"
+	.string	""
+	.string	""
+	.string	"valueTable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\001"
+	.string	""
+	.string	"lookupTables"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\001"
+	.string	""
+	.string	"lookupTableAccHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\001"
+	.string	""
+	.string	"lookupTableBaroHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\001"
+	.string	""
+	.string	"lookupTableMagHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\001"
+	.string	""
+	.string	"lookupTableRangefinderHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\001"
+	.string	""
+	.string	"lookupTableGyroHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\001"
+	.string	""
+	.string	"specialColors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\001"
+	.string	""
+	.string	"modeColors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\001"
+	.string	""
+	.string	"colors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\001"
+	.string	""
+	.string	"inputSource_e"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\001"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\001"
+	.string	""
+	.string	"pCurrentDisplay"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\001"
+	.string	""
+	.string	"currentMeterSourceNames"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\001"
+	.string	""
+	.string	"voltageMeterSourceNames"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\001"
+	.string	""
+	.string	"debugModeNames"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.61bca6fb06857629,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
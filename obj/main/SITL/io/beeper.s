@@ -0,0 +1,459 @@
+	.file	"beeper.c"
+	.section	.gnu.lto_.profile.dd57047eb277ecd3,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.dd57047eb277ecd3,"e",@progbits
+	.string	"(\265/\375 a\025\002"
+	.string	"\324\002U"
+	.string	"\f"
+	.string	"\354\301\314\336\005"
+	.string	"\001\274\205\242\255\006"
+	.string	"\002\003\004\005\222\252\354\340\007"
+	.string	"\006\317\253\250\341\002"
+	.string	"\007\b\t\n\013\240\342\234\212\n"
+	.string	"\b"
+	.ascii	"*C~\216\003\203\005\243\202!*\343\2129\326\006\260"
+	.text
+	.section	.gnu.lto_.ipa_sra.dd57047eb277ecd3,"e",@progbits
+	.string	"(\265/\375 K\215\001"
+	.string	"\370?"
+	.string	"\013"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\001\001"
+	.string	"\001\002\003\004\005"
+	.string	"\003\006\003\007\003\b\t"
+	.string	"\003\n"
+	.string	"\003"
+	.string	"\007"
+	.ascii	"1\007\203\3034\033\001|*\203\265\f\272\2016"
+	.text
+	.section	.gnu.lto_.inline.dd57047eb277ecd3,"e",@progbits
+	.string	"(\265/\375`\232"
+	.string	"U\002"
+	.string	"\224\002\216\001"
+	.string	"\013"
+	.string	""
+	.string	"\003\200\200\200\200\002d\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\201\200\200\200~"
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"\001\002\003\004\005\006\007\b\t\n"
+	.string	"\r"
+	.string	""
+	.string	")"
+	.string	"y"
+	.string	"\311"
+	.string	"R"
+	.string	"\362"
+	.string	"\222\001\244"
+	.ascii	"\344\001$s\0249\233Kp\023\217\002\270\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.dd57047eb277ecd3,"e",@progbits
+	.string	"(\265/\375 K\215\001"
+	.string	"\350?"
+	.string	"\013"
+	.string	"\001\001"
+	.string	""
+	.string	"\002"
+	.string	"\001\003\004\002\005"
+	.string	""
+	.string	"\006\003\007\003\b\t"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\b"
+	.ascii	"1\007\203\3034\233\002\301TF\300]\024\3137\200\005"
+	.text
+	.section	.gnu.lto_.pureconst.dd57047eb277ecd3,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\""
+	.string	""
+	.string	""
+	.string	"\013"
+	.ascii	"\200\004\001\200\004\002\200\004\003\200\004\004\200\004\005"
+	.ascii	"\200\004\006\200\004\007\200\004\b\200\004\t\200\004\n\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.dd57047eb277ecd3,"e",@progbits
+	.string	"(\265/\375 [\r\001"
+	.string	"pO"
+	.string	"\007"
+	.string	"\001\002"
+	.string	"\002\003\004\006\007\b"
+	.string	"\b"
+	.ascii	"`\013\330\0076\003[\300>\227\315@~\033h\003"
+	.text
+	.section	.gnu.lto_.lto.dd57047eb277ecd3,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_beeper.40.dd57047eb277ecd3,"e",@progbits
+	.string	"(\265/\375 \351=\006"
+	.string	"\022\214+0\200M\032\003\270y\300Y<@\257r\201\026\004e&\261\320\242xDD\0055\211\221\247)\031:F\f!0\335\021\343P\240\356\356H\266\334R\246\024\217\001b\236Z\250\3702\357-8xq\r\027\005\214\263D\007G\r\024f^t\017\020F'\315\233U\235\"\230D;5\213a\264~\376\277\254jW\202\253\316O\221\202r\2226\262!\265\365j\335a\017\351\017\210F\377\005\207\310?\017Z"
+	.string	"\3406Y"
+	.string	"r{\034"
+	.string	"\271U\266%\236\032w\310\311D\307\344\277c\031\226^\2626\210\243\rG\343UA\370\337\265\341X\270\314m\t\332\032\264\255\b\b"
+	.string	"2\003&j\006.\234\301\270K"
+	.ascii	"\304j\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_beeperSilence.41.dd57047eb277ecd3,"e",@progbits
+	.string	"(\265/\375 \273\365\004"
+	.string	"\002I!)\200M:@!U)B\020\354U\324\275\332\022H\200\342\021\021/\343\306\354\200o\3170\260x8\300\211\032\242\306\203\326\366N)\256\250\031\257\030\027*-uX\212\206V\363\241\024\301\362\212S!RN\235\272=\344\n\021(\261\273\354\301\213}\300B\316~\210[>\273\224\022iA\001\217\306\366'cv\350]f\337\031M8\242\335U\2109\366\207\371\337|\240m\331\237 \261\273~\332V\271\341m\033l\037l3\002\b"
+	.ascii	"3\003\316\231\001\340\313]\303c!\364\313\270\340\322-\332\371"
+	.ascii	"\004"
+	.text
+	.section	.gnu.lto_beeperConfirmationBeeps.42.dd57047eb277ecd3,"e",@progbits
+	.string	"(\265/\375 \341\035\006"
+	.string	"B\313)2Pm\222\016\300\bs\213\210*\001\241I\275E\b\032\356YeG\024\373\350+\345\372Z\030}\326\336\204\231i"
+	.string	"U\034\322\006\016*\252\3571X\273\211L\001\235\315CS\260\234\301L\022G\222\030X\323\260\215f\241\201e&\007\206\021\270q\244\211uZ\233\330\245*O4\020q\237\257<\353.\236\224\236\350\327M\020\343\243\2458\031\225\2442\262\361\363\362\257\365\007\b\0249 \276\326\002D\244\255\f.\b`e\352KXi\224!#\t\017\223\266\3542HqQ\223\035\264\200B\036.\200\204\266/P\250\202\037\177\202\237\375\237\t"
+	.ascii	"m\21173\340\234\031\036\276\3345\034:\204\241R\223\301]^\264"
+	.ascii	"\223\f"
+	.text
+	.section	.gnu.lto_beeperWarningBeeps.43.dd57047eb277ecd3,"e",@progbits
+	.string	"(\265/\375 \340\375\005"
+	.string	"2\313(/`m2\034Ha\241\024P>\241\216\237\244$v\242\005\333Ui\323\232\335`\213X\357:\334y"
+	.string	""
+	.string	"Y0\343\3329\211s\001\233Q\t\332[\246\233\f\204[\240|\261HM\323Z\003s\030\226\30108\260\213\364\300,\003;M\223\330\3069\211U\246r\201\b:K\342'\216Z\241'@\027\350\325cH\244\2458)iH\004\222\361\263\362+\365\b\t\217\032\021\257\326\242\343\243\235\0166\020`\364\373\021N\030\245\207\311\004\007I[\266.\370\250\336\344\006)\236\017\207*@\241\355\312\363\251\340\213\177\301\317\376N\t"
+	.ascii	"m\21173\340\234\031\035\276\3345\374\034BS\251q\340\316-\332"
+	.ascii	"\371\004"
+	.text
+	.section	.gnu.lto_beeperUpdate.44.dd57047eb277ecd3,"e",@progbits
+	.string	"(\265/\375 \363\205\006"
+	.string	"\262\314-1pm\032\003\020\377\025/\220\207\020\225c\304%\325\244?,\274s\210\210\204\240\244\200\226\300Jv\251\030\252\256P\2414BX>b\207\376&\267\224)\005\034\206\227\231\026:\232\027\343\203$P\t\023\337\346=\007\007'\247\231\0322N\212\034\207)(\334\274\350:\020Fg\2317\373\364\022\301$\332\351Y\f\324:\372\377\262O\273\030eP\310OqRr\221\006\222ai\353\325:d\r\351\r\210V~\213\320\307?\021z\020\340v1\001\305-\362"
+	.string	"\305\255\262\035\361\304\270=L&:H\376;va\351%ks\270BU\036/"
+	.string	"\205\377]TU\3412\2675h\233\320\266\n\b"
+	.string	"2\003&j\006.\034\200y\227"
+	.ascii	"\210\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_getArmingBeepTimeMicros.45.dd57047eb277ecd3,"e",@progbits
+	.string	"(\265/\375 \314\245\005"
+	.string	"\"J&/\200\251\351\230\031Q\026\227\354\371\177\006\256\020[p\031\300y\374f\333\036\272\253{!oG\003\230\031 \315O\001\245\016X\026\306\004\266\255\355\235R\206\236\031\245\030)PF0 \232"
+	.string	"@h\n\300\347a)\305\t\007\244\234\260\251{\372\234\002g`W\252\271\313\376\262N\301n\225_\330.BV\261\023\214D\203\355\311n|\207?L\246Ke\260^Dv\200Q\354V\350\274\361\316,g\2743n\341\364\215\372\207\270\003\253,\352m!\331]\267\312J\270\335mClGl\023\004\t"
+	.ascii	"2\003\202\341\243\302Z\025\220k83\242]!\310pW(\355$\003"
+	.text
+	.section	.gnu.lto_beeperModeForTableIndex.46.dd57047eb277ecd3,"e",@progbits
+	.string	"(\265/\375 \360\235\006"
+	.string	"B\314-4PO\222\016 :\203B\227\301H\370\016\240\270\200\352\266\270\232\026\033r\310\332\255\024\231\366\\S\301\206\005\252*f\022&`\327\\\016\263=7c\215X\262e\n\024\017T\273\303\261&\31749\274\212z\021T\003\304\353X\022\217Sp\345\231\2547QU\326\323d\331K\332\204Z\305g l\243o&\233\307c\003\351\b&3#\346%Y\\J\310\377y\315\217\330\222U\026\310\354XA\311\314\204\017\002\352\376;R\222\317\027\203E\bS\020\301\2708q\311\314\336\246\004R]\246\003R]\373\350U\274nM\212\034-\"\fT\004X\310\314Q\204i\364\326\337\340G\3707\002\t"
+	.ascii	"2\003\202\341\243\302^\025\220kx\203E\263C8\001\2504\235v\222"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_beeperModeMaskForTableIndex.47.dd57047eb277ecd3,"e",@progbits
+	.string	"(\265/\375 \360\235\006"
+	.string	"B\314-4PO\222\016 :\203B\227\301H\370\016\2408\243\272-\256\206\202\345\324o\355V\212L{\256\251`\303\002U\0253\306\030l\361'\207\331\236\233\261F,\3312\005\024\017T\273\303\261&\31749\274\212z\021T\003\304\353X\022\217Sp\345\231\2547QU\326\323d\331K\332\204Z\305g l\243o&\333\307c\313\350\b&S#\346%Y\\J\310\377y\315\217\330\222U\026\310\364XA\311L\205\017\002\352\376;R\222\317\027\203E\bC\020\301\2708q\311\314\336\246\004R]\246\003R]\003\351U\274nM\212\035-\"\fT\004X\310\314Q\204m\364\326\337\340O\3709\002\t"
+	.ascii	"2\003\202\341\243\302^\025\220kx\203E\263C8\001\2504\235v\222"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_beeperNameForTableIndex.48.dd57047eb277ecd3,"e",@progbits
+	.string	"(\265/\375`"
+	.string	""
+	.string	"\355\006"
+	.string	"R\21505Pm\222\016d\364\214Y\312\003`\332q\240\350I\210\316\026\250\324/\374\234\303o\267Y\213\333\270\260D\035\00333\255\252:z\327\303\005,$\017\266\266\233%D\246\021\f\327\333\323\311\254\217e-@\354\202\016\227B\003\364d\017\260C0\366\2612\b\201a\031\324\304\354VmBO\342#\310=\322\367\222\231\371\333xWp*\365c%\323\242\205%S(\223\216_{\315\357\3347\244\"Z\343'\003df\240\224d\346\301\234L\251\315\345\277 -io\257b\"\204\201\340!\2420\2352#<v\240*\225\251@U\352qt\253\333nG\032`\322P!\031\201\3520\t\231\271\023\215.\372\353\317\371\r~R\t"
+	.ascii	"2\003\202\341\243\302b\025\020]\363Z0\361\340.(\325\240I\230"
+	.ascii	"O"
+	.text
+	.section	.gnu.lto_beeperTableEntryCount.49.dd57047eb277ecd3,"e",@progbits
+	.string	"(\265/\375 \313\265\005"
+	.string	"RJ'1\200\267\351\2003\242\271\025\330\00351\034\271\032\261\323\333\020F\365f\2333\233oK\257k\332hP\230\030\021\345W\202J\357\271a\214?5\262wJ\001\256(*/)'qZ\261bI(\261\242\226H1</I\343eN\032#n\017\267\307\247\f\324\330\034\366\340\200}g\341f\277\310\267n7 \002b\035\036\006\003\333\325\216|\204'T\273\301\341\n\264\305\001\300f\341aw\343t\t\372\343\\\001\375\201\004\257\177\325\277\302\245.\323\260\277\004dw\3752M\340\206\267\335\260\355\260\215\t\b"
+	.ascii	"2\003\326\231!\340\200\\\303\235\021\r\013A\210\273Bi'\031"
+	.text
+	.section	.gnu.lto_isBeeperOn.50.dd57047eb277ecd3,"e",@progbits
+	.string	"(\265/\375 \302u\005"
+	.string	"\202\311$.pe\322\001"
+	.string	"}"
+	.string	"1\252\260r\326\347\207\202\330\222\006\221k\0076\022\273\317\336\214\215\206\3563T\365\365uL\353-\210\f\2106D\366\226)\307\256:\2659\033\222f\022\2221\036\022\253\021y\025N\265Y\245\204\322*\255\333l\005\206I\244\374\227\203\221\363s\325q\363\303\352\033q\b\325\335\005"
+	.string	"\364\0270}\376o\277\365\204b\273\345\353\351\b\240K\205\224\352\2762v\3302\264g\0261g4\247\222\3071\034,\272\373\320\342a\370\221\377#\376\037\376;\002\t"
+	.ascii	"2\003\202\341\243\302b\025\220k8\\\304XB\344p\347L\355|\002"
+	.text
+	.section	.gnu.lto_.symbol_nodes.dd57047eb277ecd3,"e",@progbits
+	.string	"(\265/\375`\027"
+	.string	"\355\002"
+	.string	"$\004\023\001"
+	.string	""
+	.string	""
+	.string	"\002(\177\004\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002)\177\005*\177\006+\177\007,\177\b-\177\t.\177\n/\177\0130\177\f1\177\r2\177\016\005\002\017\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013"
+	.ascii	"\200\036\340\033\340\033\340\033\340\033\340\033\340\033\340"
+	.ascii	"\033\340\033\340\207k\3151"
+	.text
+	.section	.gnu.lto_.refs.dd57047eb277ecd3,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.dd57047eb277ecd3,"e",@progbits
+	.string	"(\265/\375`U\b-/"
+	.string	"\312Qd\022H`ZR:\367\225b\204\221"
+	.string	"\364&\303\327#P\232\235\317\351~\223\244;\314"
+	.string	"\3775\320M\357\311\307|C\314d\345_\304\346T\f\\Y\007\257`\230\n\034\323M#ni'\370\360_p\f)<\025\021\233\263\222Jv\n\361"
+	.ascii	"\004\001'\001T\335\b:\356Vv\273\271\245\335\355v\267\316\022"
+	.ascii	"+\356\326\001|\233Je7\016\003\312\306r\241T\335\352SN\215\371"
+	.ascii	":\271`#\250\231\263\331U\261\233_+\270\233\035\267\265d\235\256"
+	.ascii	"\224\266\352\356\\\3076\2314\326\250kQ~\356$\343v\366 o\240\211"
+	.ascii	"Q\327W`\2633\227e\261\005\331\354\021(<\307\035\353\260\356\030"
+	.ascii	"\310G\317\211\036\236\272>\310~//\370\3451\365\n\006\222\031"
+	.ascii	"\352z\006l\006\313aY,G\311\361\3271\270\235\335\261O\016\362"
+	.ascii	"\006[\232\272\016e\002\2775\013\370\375\207\362\237\255\246p"
+	.ascii	"\225}.\372\001\345\242\037^\234\2715f\240T\332\2440Y;\222\363"
+	.ascii	"\347\256\314\365\177L\375s\326\237\377_\357\277\233\377v\377"
+	.ascii	"\343\376\277\375\227\256\375\217\376\207\376G\373\277\364\377"
+	.ascii	"\371\337\354\377\330\177\340\377/\377{\366\366\366\366\376\314"
+	.ascii	"\376\231\307\377\323\nF\316\324\365y\311>\237\345*\317V\304\262"
+	.ascii	"\225\214v`wOuk\225\271 %\257\312\311]\343\300*\362i{r\306E\276"
+	.ascii	"\362\214v5=\335a\335\255\200G\217\212\256\212\272\236M&\373\277"
+	.ascii	"\003A\256\313\210\272\276e\377_#\227\335=\303\027\367r\252\347"
+	.ascii	"\227}9\027\375>9'3\370\277v\337g\332\255"
+	.string	"l\332\261I\322\220;\324\365\377P7\351v\203:\356\345\353\334r\33727fP\334=\204\332\351\243\337x\213\271\302\255v\334\271\223[L\025o\f/\337\030v\201\235\204\335\356\230\t|\237H7\277\316-\346\353\204\231A\235l\267\235\310\036l\022f\276``&\360u\"\231or\213\031d\325\344\312z\307 qd\367Mv\f%\026r\t\224\2761\334q\335\371I\325K\006\335X\3602\016y\225\325\246\2441\246\254 \341\034w\367\001\345\024\027\334I\351\373\005w\177M\241h\345\0047\226\266\220,u}`\265UD\276h\021$\231\031\366j[\2336\331\r\333\335n\3342\006x\301\250\232\336\351\004Aj\225\271ytU\"\007\305\353)'\227\355\354\274^L\177:\236?\320\234y\266\313ud\272\302\352\376\214&\247\311kr\236\335q\020\020X\r Db\240\035(\236\022\033\352\232\347\362\364\231.\253\241\233"
+	.ascii	"w#3\035P^7\022(g\242\234\211\326'\\G\316~\353U2\366q&\360c\263"
+	.ascii	"\200_\027\034\\\216\213\363r\341ENF\231\347\2700<?z|\271Pe\270"
+	.ascii	"\271\345\267\241\356\246j"
+	.string	"\026w^\357t\247\210\363\2539\346\371-\223\231\031\363\361>\272\332\200\202\261\271ac\313R\265\251c\226\2667\345\321\321\306v\366,\315ar\344\230H\217\264\355\300\325e=\325\260\317[\272t\311_\364|X\262\334\336\274<\177\371\t\213N\337Pa\212\016\271\243\262\266\026\007F\016\267\306\222,Yr4\257\371\003dm\007\234\226,\226\243>0,\361\325\024\037W\0334iZjj\031\312\002{j\016\257\271s\267\314J\236M\026\313P\237\333WG\361\300\303R\007\021\301c\353d\024\036\207R4\025\237\224ZcQ\t\252=J\265\020\001\364T,f`\362\021C\030[\251!\317\221\270\242\250\324\302x$j `\024\242hZ[(!\b\241\024R\302\017\tX\264&\210\035\332\247\022\302%cq\203\320\221)\202\004V\252hl\032~h\241\206KPF\f\307\326I\250=\nMD\215\350q\"\016\211F!\211"
+	.ascii	"RQm\233\201X\034\036\205P\306\341\tbQI\250m\"\266OC\021>\027"
+	.ascii	"z1\2525\006\217\305\2421\b\340\367\246\241\261%\266N\354'\034"
+	.ascii	"98Bb\241s\244$\bI\020~GJ22J:"
+	.string	"2b\177d\224sd\222\032\321B\r\217\354\221\t\351H\034\256\320i\231Z\023\305\017=\267`Aih\004\b\016l\323\003c\033\325\266%\202\305a\2208\024B\005\233\214R\301\007\005:\213\251\235\303\254\311\270\231\277\262&Wzw\275\344\322 \250\210\224\311\334\2337Y\317\310\252j\332\344\f\215\272\037z9o\307+\t\227\225\272\346<5\343\3458\317y\031NO2\347\255\231\350'\347\200\251\250q0\305\234D\"\301\210\214\210\026$M\007\260\002\021\032+n\021\200%\303pR\220\024\232\003o\246\\\201'\b\266f\0368,\263\274\013\373\345';4\330\320\b\365\362f\007\314\344\331n}\220\221K\310s\226\331\306\246R\313X\235L\324ez]\337H\212\017\246TO|\177\351|\227\263|\364C\t<\350a\262\307\305\030\003{\301\253\307FNZE\224\320\371\333\313fu\030\2107Ir\003\350\276\350q\243$"
+	.string	"\033u\377\0012\222t\026\256\255\332\271Z\t\265M\322\"\336\336\252\201M\271\220z\035\350\356\210T\023'\251\310\201\366\247\230\212\003]\301v\224\202s\f\331\r\310\273\331\bG\257\226~\256\335\226\351\245\376x\310FA\376\034\346+F\273\034\025\033\241\247W\205= \270\255\323\034#\256\3766\247d\365\255\255"
+	.ascii	"\317K\345\336m\017l\361\204q2\220r\314XQ\002\265Z\342\276A=\215"
+	.ascii	"\020\205x\314,\033\360\243\257&MC\211\203\325\317\342g\302.\321"
+	.ascii	"m\030\332\216n\230\223`u\305\200\275\355M\334\023\260,\233\027"
+	.ascii	"\210q\340\005\370\217fj\221|\321\034\350\311\336\312x>+<s\207"
+	.ascii	"\347T\302\331\3604\327\223\325"
+	.text
+	.section	.gnu.lto_.symtab.dd57047eb277ecd3,"e",@progbits
+	.string	"beeper"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316"
+	.string	""
+	.string	""
+	.string	"beeperSilence"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321"
+	.string	""
+	.string	""
+	.string	"beeperConfirmationBeeps"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325"
+	.string	""
+	.string	""
+	.string	"beeperWarningBeeps"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327"
+	.string	""
+	.string	""
+	.string	"beeperUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333"
+	.string	""
+	.string	""
+	.string	"getArmingBeepTimeMicros"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340"
+	.string	""
+	.string	""
+	.string	"beeperModeForTableIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344"
+	.string	""
+	.string	""
+	.string	"beeperModeMaskForTableIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350"
+	.string	""
+	.string	""
+	.string	"beeperNameForTableIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364"
+	.string	""
+	.string	""
+	.string	"beeperTableEntryCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367"
+	.string	""
+	.string	""
+	.string	"isBeeperOn"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376"
+	.string	""
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.dd57047eb277ecd3,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,597 @@
+	.file	"displayport_msp.c"
+	.section	.gnu.lto_.profile.99095b1f5ad64a9b,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.99095b1f5ad64a9b,"e",@progbits
+	.string	"(\265/\375`\023"
+	.string	"\255\005"
+	.string	"\004\t\007\001"
+	.string	"\023"
+	.string	"\317\333\366\301\006\004\002"
+	.string	"\002\001\001\317\253\250\341\002"
+	.string	"\002\312\332\260\336\t\b\002\002\002\003\002"
+	.string	"\002\004\003\240\342\234\212\n\004\215\377\300\244\017"
+	.string	"\005\320\235\262\314\006"
+	.string	"\006\224\217\236\327\t\006\002\005\002\005\002"
+	.string	"\002"
+	.string	"\b\t\230\232\324\211\b\n\263\326\341\254\013\013\262\201\245\301\003\f\330\271\210\336\b\f\002"
+	.string	"\002\006\006\r\253\301\343+\006\002\007\002\b\b\002\b\016\353\323\300\246\002\t\t\017\020\361\253\302\312\n\021\334\347\232l\022\023\240\342\234\212\n"
+	.string	"\017"
+	.ascii	"O#\t\\\204\314|\206\344\356\246\246\265v\335\004\007\004\007"
+	.ascii	"\004\007\264\351b\300>+\324v!\025`\b"
+	.text
+	.section	.gnu.lto_.ipa_sra.99095b1f5ad64a9b,"e",@progbits
+	.string	"(\265/\375 \353\355\003"
+	.string	"RE\020\031\260%\351\f\3030\224\226y\030\206a(\005\t\2665K,\261\244\355-S\n.9\330\205\213\312(Z\034\277u<\252B`\002\205\030\335Z\206\213T\"f\375\b\340\361\211\354<\341\2173\333\032\036\002\031"
+	.string	"\r[\2210F>\r\202ZP0\344\301M\314>\334\n\230\177SW8\214\002`\021\020\006\210"
+	.ascii	"r,\2049E\231\2510B\005\256D\200yM\314\301\226\212\245\022\374"
+	.ascii	"\006\260"
+	.text
+	.section	.gnu.lto_.inline.99095b1f5ad64a9b,"e",@progbits
+	.string	"(\265/\375`\330\001\r\b"
+	.string	"\202\313\"(\220'I\007\327wA'F\206\357d\023e=;\271\222\0372\262\315z\273\353\356\366\305\361*d\033i\315\022\333\032\331r\247\333\317+\337\034j\206CD\273ch\273\2209k\026\203n\326\303"
+	.string	"\003F<\032$\004\006\324\242,\322\333\177?\003\371\033T\230x@(K\354\233\005\220\330\2669\270\220\345\271\205\266\310\350\277\364\312\263\230o\316m\352\002\236\322D\243I\300\266\245\303\036\264Ex\305\226\260\365Vhsk\320\241m\362\314|\b1 `\0021DF7\372\002(\324`\033\246\t$L\341f"
+	.string	"\2028\372\001\345`\277\rk\342\273\233]\003\3463\262\006"
+	.ascii	"\266\325s\f\311\306\314\253\204Hxt4b\230\210\300\002\257\t\271"
+	.ascii	"6=\343\270\031\335\001\362\016\302M8\332\261\006K,\347\f\304"
+	.ascii	"\335\233\035\217\346\034\354\344\311\316\272\335\250F\220A\037"
+	.ascii	"\203\357\310\355\321\b\376\353 \220\204\341\321\321\n>\004"
+	.text
+	.section	.gnu.lto_.jmpfuncs.99095b1f5ad64a9b,"e",@progbits
+	.string	"(\265/\375`\021\002}\b"
+	.string	"\302\315&(\200)I\007<\030\b\226\234\301\245\362P\301\fLcZ.\024>\367\206\201\031\354Q7\255\177\240\337\214 \255\354\266\211L2\\(\350q \350)2@\301V\006\372\274RP\3573\2262\006\223\302\316\271J\030\250_O\027\250\275\236,P\317\r\366\251\002\365\242\035<4M\003\361-\320\242\036\352U9\244\034\b\240\261\304C\216X9\341\336\214=c\235W\362\361\230\023V+#g\260\362f\257\310\353_\361tExE&\225\245;:\352!\374'aU\357|/\371_\236\347\302\223\0042 \260\002\021\262\242\007(\"/\203r{\3058O\200\002\230\201-\304\250 '\013\330\200\034\340aD\243\376ua\021\221\030\001\215:\025\200\200\n0 g\322:P\332\013 \t\344\013\310\374\314CF8\017\034M\237\261\r\0225"
+	.ascii	"\336\257\036\r\320OfN\261\317\333\227\3137\340\217E\004\341\273"
+	.ascii	"t.D\003\353\235xu\335\275\221p\215\310\033\217V\200!"
+	.text
+	.section	.gnu.lto_.pureconst.99095b1f5ad64a9b,"e",@progbits
+	.string	"(\265/\375 ,a\001"
+	.string	"("
+	.string	""
+	.string	""
+	.string	"\r"
+	.ascii	"\205\004\001\200\004\002\232\004\004\230\004\005\230\004\006"
+	.ascii	"\230\004\b\230\004\t\230\004\n\230\004\013\230\004\f\230\004"
+	.ascii	"\r\230\004\016\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.99095b1f5ad64a9b,"e",@progbits
+	.string	"(\265/\375 \344\025\004"
+	.string	"\264\004\312"
+	.string	""
+	.string	""
+	.string	"\016"
+	.string	"\r"
+	.string	"\001\300\004"
+	.string	""
+	.string	""
+	.string	"\001\002\023"
+	.string	"\001"
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.string	"\200\001\b\020\001\001\002\002\001\270\006\024\002\025\020\020"
+	.string	"\004\005"
+	.string	"\006\001\b\t\n\013\f\004\200\214\260\006\r\004\374\007\0071cO313"
+	.string	"\005.cR "
+	.string	"\027"
+	.string	"I\005H\254@h.\340\022"
+	.ascii	"\343\256-\374\001#\330\fl\001\373\\\226\201\0268\027\262<6\025"
+	.ascii	"L\253\260\340\024\343Q\306\220\352\304mP\331\361\347j\030(\002"
+	.text
+	.section	.gnu.lto_.lto.99095b1f5ad64a9b,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_displayPortProfileMsp_Registry.14.99095b1f5ad64a9b,"e",@progbits
+	.string	"(\265/\375 \214\035\004"
+	.string	"T\007R"
+	.string	""
+	.string	""
+	.string	"."
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\203\255\334\ryw\350\375\005yu"
+	.string	"\005\001\006'\001\005\200\0040sq\300\001o\277\001m\276\001k\275\001i\274\001g\273\001"
+	.string	"\013/root/repo"
+	.string	" ./src/main/io/displayport_msp.c"
+	.string	"\004"
+	.ascii	"[\005N\271\351\231\304\r\240\b"
+	.text
+	.section	.gnu.lto_heartbeat.17.99095b1f5ad64a9b,"e",@progbits
+	.string	"(\265/\375`8\001u\016"
+	.string	"6\334cE\020\221\223\0168\212A\020\002\364(\311\177\267\217\333\277i\220t7\221[y\251\334\241z)\247^n\346\243\366#\357?\320B,*\225\331aI"
+	.string	"\250\240\350`\315\213U\211\256\202x\307\261\274\232\034\033\331{\357\235RN"
+	.string	"O"
+	.string	"N"
+	.ascii	"\340\306\266\317\342.\235\0353A\023\037\203\326\311\213\216\335"
+	.ascii	"\315:'PO\347\007\324SY\342\335\247\214\235\377\360\023\265\222"
+	.ascii	"\303\373J>=\\N\003\247\026\032\001\237ivl\310\234|\365\210\362"
+	.ascii	"\231\304xA\330]G\357"
+	.string	"\353p\323\333\016\261-\301~K\340/\001T\226\033\005X\273)\255\035+Ck\240x\352\267\357\277|ec\036]e\371\202\205\332]ldc\357\374\320\230\025,\350\236\"m6\305\305\032\301afW\345\343\324\0166\247\321~\213\273\350\016n8g\3674\203\306.\230\300\331\346\324\001,\224w\025wL\365W\026@\361^\225U\226\274&D\013\206\264V\251\034\tq\230\304\032\3731.C\363O8\003\027\357\235\372\\=\245\362\203\313\212\025R\214p\340\251K\030\025\215J)\266l\320\024%\t\373s\345\311\246\321\027\215\2563\232>>\t\3103\242\201\253\242M\233\200\331\003\022\342@\024D\233\026\032\211\\\bq\037\222L\373d\030>\"\240\314\263q\031H\307Z\250\302\226\2114m\3130\260\364)\253\374\352!),\361\343\227D\261}\311\006 J\322d\322\334\025\361 <g&5\003D\004\277\352\341\307\003&\027"
+	.ascii	"\266\311\"x\266\201\021\201xQ\013ta\230\305\332\037\325Z\f\244"
+	.ascii	"\254\210K\247\305cYA\316\f\30151PX\021\245\2066\232(\342b\004"
+	.ascii	"Udp\002\220j\320*\221\246\024\n\n"
+	.text
+	.section	.gnu.lto_grab.18.99095b1f5ad64a9b,"e",@progbits
+	.string	"(\265/\375`\177\001\235\017"
+	.string	"V\035hF\360\260(\035x\337SnL\242\037n\216\332\332\266\334$b$\351O\214w\364\3740\006dZ\267#\251\302l# |\275\276E\247\366\215\236\246n\223\340\"\250\375\244\255\305\314:\"\322\210Qv\277\200\366\367\336r\247\024R"
+	.string	"U"
+	.string	"R"
+	.string	"\237K\177\037\333~\213\303x6N\374L\270<\254\027\013\215\216\335\345B'0/\343\007\314K-q\357Q\241\347_\366\030{\331h\271T\036;\\\243\001\030\b\035\001.V\f\325\260\261\274v\330\342Z\201\320\323`w\r[.\016\267\274m\022\333\017\354\343\b"
+	.ascii	"f\354F\001\032\273.\267\035k\2233P|\366\333\367e^Ky\215U6\213"
+	.ascii	"\355\356a|\346\323,2\342\245\036c\225\331\244|\032\213\214\244"
+	.ascii	">\243\372l\n\317l\204\206\234\335\027\220K/\370\244\330\240{"
+	.ascii	"6\b\332w\361\027\336?\f\377\330\205\321d\354~\n\314\005\023<"
+	.ascii	"n\336\272\212\033g\372\265\021\005\370V\324\251*\337\tq\243\251"
+	.ascii	"IS\325D&\307\n\334\261o\363\030$\377\204;\024\370\026\312\274"
+	.ascii	"T}\355\360\005\303\302\203\n:@@\373\201\233\031\235\227\025\274"
+	.ascii	"\331\037\013*\t\373q\025fOh9\241\243\204\326\177?\f\376\tIdr"
+	.ascii	"\3414Q\246\016\002\310\242\220\322\211\024\001e\352J\252\222"
+	.ascii	"\n\245\323\350\204\353F\234\205Q\t\211\023\231N\\H\310]I\202"
+	.ascii	"\211Cu\235\211\003}\253\307U\230\0355\222\270|\200 \227\332b"
+	.ascii	"[\352e\377\206\f+l+eY\025wE0\370\310\211\211\001`\202\277\346"
+	.ascii	"\264  0\002b\b3\037\266\263 bO\3336<\330\267`\030\007\276\230"
+	.ascii	"\346\023E\330\257\262\355\352\302F\0011e3\2029\253\\\206\007"
+	.ascii	"R\002\372\207\027\nf.4\254Qu\023\240\201nJt\001\270\303\337w"
+	.ascii	"zsP\227\223\033\351\203vKS\264\007\005"
+	.text
+	.section	.gnu.lto_release.19.99095b1f5ad64a9b,"e",@progbits
+	.string	"(\265/\375`9\001u\016"
+	.string	"\206\234dE"
+	.string	"\2216\035x\rDA\324\350\036\376\203\007\376\273\005fe\341\3322,\254\2337G\224\321v~H\361\326\377\b\334\fpF\263d\273\241\013\003w\351Nu\307P\315i&F\255P\220\256\227\027V\264\266\367\336;\245O"
+	.string	"O"
+	.string	"N"
+	.ascii	"\340e\333"
+	.string	"W\361\230\316VM\360\345\263J-)3;v7\343\234@=\235\037POe\211w\2372v\376\303\317\323\207\033\336w\362\311\341r\0320\201\340!\340+M\016\216\232\224\247\036U>\224\030\255\007\273\353\350}\033nz\333#\266#\330w\t\007\177\t\240\332\310Q`\265\273\262\352\2615\224\306\211\243~\373\376\314S6f\321e,[\250N\273\213\211l\354\235\037\032\263\202\005\335Q\243kQX.F\274\330\354\262\204\234\272\301u\032\355\2578\213\356\240\206\203\354\232d\314\330\005\0238\273N\035\336S\334\252\352\247*|\342\275*\253<\371M\210\325\013i\255RY\022\352@\2117\366a<\206\346\2330\006.\336;\365\271zJ\245\207\030\230\016\243\b\341\300Q\22745`XHqe\203\245(I\330\237\273\273\226&\233F[4\272\316h\032\277\311\247S\222\201\253\241M\223\200\271#\002\342>\023B\233\006\022\221X"
+	.string	"q\036\223L\363d\027<$\237\254\263q\231\b\307\032\210\302\226\2054m\3130\220\364)\253|\352#+-1\344\226T\261mI\006.$Y\362h\356\212p\020\036\304\0065\003D\004\277\314C\317\007\215\352\024\026"
+	.ascii	"\266\311\"x\266\201\021\201xQ\013ta\230\305\332_\325Z\f\244\254"
+	.ascii	"\210K\247\305kYA\316\f\241q\231(5\364\321D\021\027#\250\"\203"
+	.ascii	"\023\221T\203V\2114\245PP"
+	.text
+	.section	.gnu.lto_clearScreen.20.99095b1f5ad64a9b,"e",@progbits
+	.string	"(\265/\375`9\001\215\016"
+	.string	"\006\034dF\360\2226\035P#\254)\f\236\n\377~7\310\375\310\0023\302\005\226w\373\272j\211\3538\017\324\221.\002\232E0\354z1z\244\\\274J\030\224\3051\302g]\1772\3264\337\254\231\212-\323\022\237F\366\336{\247\024N"
+	.string	"N"
+	.string	"N"
+	.ascii	"\266\375\027w\351\354\231\t\242"
+	.string	"\370\254\223\n\024\230\233\335\315</PO\347\t\324Sy\342\335\247\214\235\377\360\263\005\210\030\3573\371\354p9\017\240D\340\f\370N\323\243\243\006\345\252\307\224\357$F\013\302\356:z\037\207\233\336\266\210m\t\366Y\002\007\177\031\240\366\330a\300\307\256\312\352\307\326P\034-O\375\366}\230\253l\314\244\277X\312\240\301H6\366\316\017\215y\001\203\356\251\322\265+\254\031%ZlvW@N\355\340:\215\366a<Fwp\303;\273\250\230\033\273\240\002g\327\251\301+47\336Y\3343\325WY\b\305{UVi\362\234\021+\032\322Z\245\222$\344q\022s\354\327\270\r\315O\341\f\\\274w\352s\365\224\312\017..<\224b\004\004O]\312\344\300Y1\305\225\r\236\2424a\177\256D\3314\332\242\321uF\323\361%\241\017\211\006\256\2166m\002\346O\210\210\013Q\030m\232\2104rA\304\201J2\r\224a"
+	.string	"\215\204\262\317\306e!\036k\242\n[6\322\264-\303@\323\247\254\362\252\213\250\204\210 \267d\212mK6`1\311\223Ks\227\304\203\360\035\233\324\024\020\023\374/\017A"
+	.string	"d\002\030"
+	.ascii	"\266\311\"x\266\201\021\201xQ\013ta\230\305\332_\325Z\f\244\254"
+	.ascii	"\210K\247\305kYA\316\f\3015\221\0276\266\036BH\r}4Q\304\305\b"
+	.ascii	"\252\310\340D$\325\240U\"M)\024\024"
+	.text
+	.section	.gnu.lto_drawScreen.21.99095b1f5ad64a9b,"e",@progbits
+	.string	"(\265/\375`9\001}\016"
+	.string	"\006\234cE"
+	.string	"\2216\035x\021\232\204\253]\2171\231\3417\223\206\210\321\372\216\351wq\333\356\320MaajX\361\326\377\b\334\fpF\263d\273\241\013\003w\351Nu\307P\315i&F\255P\202\257\227\027\212\033\331{\357\235RM"
+	.string	"N"
+	.string	"N"
+	.string	"\266}\027?uv\314\004Q|\026\351\204\362B\263\273\331\346\005\352\351<\201z*O\274\373\224\261\363\037~\266"
+	.string	"\261\362>\223\317\016\227\363\200I\004\217\001\037inp\310\240<\365\230\362\235\304hA\330]G\357\343p\323\333\026\261-\301\376J\007\177\031\300*\3450\260cWe\325ce\350\r\025G\375\366\375\227\247l\314\241\273X\302Pa!\033{\347\207\306\274\200Aw\224\350\332\025V\214\022-3\273%\220S;\270N\243\375\226\277\350\016n\370\307\256\251\206\215]P\201\263\353\324\340\025*\032\357,\356\230\352\247,x\342\275*\2534y\315\210\225\fi\255RI\022\3528\2115\366g\234\206\346\247p\006.\336;\365\271zJ\345\207\023\213\007Q\214\200\340\250K\030\025Ki\024W6H\212\322\204\375\271\322d\323h\213F\327\031M\003\363%\036\016\211\006\256\2026m\002fN\310\207\363P"
+	.string	"m\332'4r\341\303uJ2\255\223a\350\214x2\316\306e!\033k\237\n[\006\322\264-\303\300\321\247\254\362\251\213\250\204\210 \267d\212mK6X\031I\222Es\227\304\203\360\0373\250) &\370]\036v"
+	.string	"\300\004\030"
+	.ascii	"\266\311\"x\266\201\021\201xQ\013ta\230\305\332_\325Z\f\244\254"
+	.ascii	"\210K\247\305kYA\316\f\3015\221\0276\266\036BH\r}4Q\304\305\b"
+	.ascii	"\252\310\340D$\325\240U\"M)\024\024"
+	.text
+	.section	.gnu.lto_screenSize.22.99095b1f5ad64a9b,"e",@progbits
+	.string	"(\265/\375`\222"
+	.string	"\315\t"
+	.string	"F\223C90\345(\035\236\301{p\004\264\201$R\200&l\255\007%o}1\202\272u:\3767\354\002\324\006\2110\276;\266.\202\204\001\245X\2606\351\215\356A\033\\B\b!R\246\0243"
+	.string	"0"
+	.string	"1"
+	.string	"\240\255r\205\033)\315tr*\001\260\273Q\363\201\354\330u\201\354\230j\034|\202\376E~\2610^P)\322SC\330]'*eq\353mol\037\330\337\004\231VMg\246\277i\027.\005,\273\025-\326\266`)\035\266A;c\373i\177\365\020\360\341\350\001\273\252\025\224\335\220\343\270\035s\270\331\366?\016\022z=\334D\225sM\375)\200\277\223@l\273\023\006\376\210\027\261q\034\363G\331\261+\001\314\252\224-;$\245f\330\277VU\266\246\265\207\177\246\351+\"\217K\310\370\323\351\276\220\202\310\343:\tOC\367\201\026\"\007\212\016 O(~\274/v4\346:\006/\2128\316\213\231pok\252)\251\311\227\246j\2521\024\036\246lY\003\017"
+	.ascii	"\266\231E\246m0\302\210\t\003l\356\251\344\252\232M\351\255C"
+	.ascii	"c\231k8\264,`\t&\036\334}R\255\230\204I\006"
+	.text
+	.section	.gnu.lto_writeString.23.99095b1f5ad64a9b,"e",@progbits
+	.string	"(\265/\375`\322\002\255\026"
+	.string	"V*\224J\300\322Uc\203\002M@=Y(\344\034L\032v\226P\363T\317\203w8\361n\246\247\235kl\215\310\300l4\261\216\263\240\224\205\224\233\245!\270\rA\001\211\252\0221\344A\031Bdc\263\261y(\250\320:\332{\357-eJ\001{"
+	.string	"y"
+	.string	"\202"
+	.ascii	"\020\210j\037\2719\036:*\266\332\n\026\330.T\263\275\327'\345"
+	.ascii	"\340\325\276\213\277\260\375\307\341\252{y\222\204\367\376P\334"
+	.ascii	"B"
+	.string	"_\372\207\332\366[\034\310f\017\311_O\357\314%\355`<\335{[\254\0130_\222_\231/\355\211\333N\332j\363\037<\351\343;\362z\267\223\036nI\003<\"\240Bz9\222\245D\334]\370z\323\323\325z>\270\367\272\362z\035\356\362\266WlS\260\355I\376\345\2525a\237\274\226\307+[M\202V\253\376\373E.\364\247'\372Al\365y\340m\276\350/m\265=\253\353Y\375\001gqG\001\243{q\216R\227X\326Hq\340\177\344']h\247\236\035\3116\310)\235\331\351m~\214\007\235Z\306g\330~D\203^\025\021vp\024\357\315\221\200\276\2549\007\016\364\020\275\345\240E;K\305{\357\311K\257\240dQ\r\201\221\253\033b\021Ga\026W=\317e\276TY\035\240\237\0178\245\237\326Z\223\0376>\221Zmi\217\364\034\256\220\036\336\322\203\265\222\227\344=|\201\251\347\231eco>m\265"
+	.string	"|L\273)\247\370\3601Z\033\365\036\0065A\201X\333(M? \354k\246m\004\017\326\002\364\334{\031\330 \343\223\321\344\036\232\246=m\202\020L6\306\\=\372\326\264\017\356\246p\365\350\264\226\326\326 S\317\273\0251\372!\352\354\315\001\031h\\\354\314K\214\205\231y\311h3\263\006&\26310\227\245\311`\023R\273Rb3\031\026\232\f\026\333\320\022\023\233\2750\264`\257\326\314\253E\246\345\222\315Z),\303b/\262\026\r\006\223\265\322\037\356\244%\261\027~\005\307WO\276\2627\266W\266\301\b\234\315\231\206\274\267\204\312\217\376\340UE\241z$K\252\rV"
+	.ascii	"\241\341\364\364\025\276\320\302\205z\036\2115\037E\342\b\264"
+	.ascii	"7\256\262.C=t5\312\276\216\023k\0167 p\"\031\263\363\266\262"
+	.ascii	"\b\260\215#\030\353P\326\272\002\333\203\367*:\004'\016\336Y"
+	.ascii	"6\030\020s\033<\304`.\331\233n\035\221\355\323\304\030\244\275"
+	.ascii	"\313\006\351%\227A\032\267\262\315\214;\215Z\306\255\\\3771\026"
+	.ascii	"\267\224\r]4\0134@k\270-1\007\301\303\250r\300_\023\302\246\227"
+	.ascii	"n\247\023\275\242\253&n\364\bE\024\013t\257\205\302\fL\036y\004"
+	.ascii	"G\330\346\n\032\336\335Hm\320^\244)\205\201\002"
+	.text
+	.section	.gnu.lto_writeChar.24.99095b1f5ad64a9b,"e",@progbits
+	.string	"(\265/\375`G\001%\016"
+	.string	"\226\232^D"
+	.string	"\221(\035\240\321\366+&\246\212J\241\017\217\002\200\246Ml\366\336\230\217\262\005`g\001\264\006\233n\3002\f\265\347p\035yx,\210"
+	.string	"\257\226\333\2559\2317\013\f\023\006\372L\006$\232-\277%D\312\224\002H"
+	.string	"O"
+	.string	"G"
+	.string	"\377.\034\300\356\312\245\305\356\367a\250=\363\247\331\366G\234Dg\277\300>\226j\203\212I\245\200\331]\370\271"
+	.string	"\3153\354\0014\317\324\303\273g\347\337uL\004\213\305S\235\236\033\005\273\353\364T)\267\336\366"
+	.string	"\333\r\354\273\004\232VMg\226>G'E\206\007\214]\224\227\314\306\310\\\200x\313ow\276\313\036\253\370\212\356-&mCh\030P\310\274\354f \360\314\f\264g\035\271\362a\201\212\311;\0265\003ED\3236p\240{\313\304\272\253!&\301\323~\211\233\350\002\035\265+\214\362\336\246\237\224\236\314Q\325\247f4M\ra\261\274\244\261\375\241'^07\256\266\013\334U\332X\273\033r\257\006\246W\017\033\251\231\223|\331\337)\265\203}lu\345\355\337\337y\353\347\\\345\327\276\362c\001\023J\020\024tS\344\224$\202\224\304E\007\036\203@D\243\222\007$.\212,\214\220\210F\241\b0\206 \205\320H\t\004q#\b\362q\024I\340 )F\016z\276=\266\272\332\024\301\206\023E\331\204\355r\020yi\345\313\234<\213\273\"\244\341\245\252\006\035"
+	.string	"\266\231E\246\275\246\326\306\315\224\247\231\342t\231S\312\232\257\262\331YZ\316\b_BuM\324\331p\307\262\330\003\033\373\225\271\001M"
+	.string	"\306\001\320\007\006\003\203"
+	.string	"\234\3010>\003"
+	.ascii	"#\004*\034\334}R\255\230\204I\006"
+	.text
+	.section	.gnu.lto_isTransferInProgress.25.99095b1f5ad64a9b,"e",@progbits
+	.string	"(\265/\375`\002"
+	.string	"\035\007"
+	.string	"\242M25Po\322\030 \356\024\300f,\254=\346\033\016E\022\240j\352\267Ly\340h\b\222wdg6\026\tw\233\r \r\023\275\266N\240r\013V*\255\205\304\275e\n\231\214\f\325\036\316\205}\0342\031\257\211N\304\205Y\0170ZP\302\352|\240Gb\220\2639^\020\022f1JX\315\325\215\332T<\213\237 \367<^\001vw\177\243w\r.\245\027\003\322n(\006fY\246\225\220_\373\352w\356uDI4-\241\320\200\335Q\213\312\356<\030jtz\352"
+	.string	"\245\223F\005(\235\376\021\022\2647\235 \241\314\205\006\306Iiw\302\367\241\233\272mU\023%\020A\351 \245\210@\3522\013\273\273\313\020m\350O\377\202_\341\347\b\b"
+	.string	"\266\231E\246m`\344\250"
+	.ascii	"X\005D\327<d\2070\257k\222\001"
+	.text
+	.section	.gnu.lto_resync.26.99095b1f5ad64a9b,"e",@progbits
+	.string	"(\265/\375`\364"
+	.string	"\245\013"
+	.string	"\366VP> Q\233\016\217\203\024\taV\201\033\307\312/\027\2319\b\002\n\215\342\007F\030\345\241*\365\273\3260\301\255.j\301\301\230\377\007\3000"
+	.string	"\203T \354\b\026A\224%\214\256\310\337\335\244L)="
+	.string	":"
+	.string	"?"
+	.string	"\027\260\373y\021c\267S\340(\375\271{\001\370'}"
+	.string	"\374\263f\327x'\262\223\220\016\037*n\354n\324\017\327\236\232\177\023\007\260\201\\xN\030\354\256s\003\341p\353m#\260\275\300\276\206\357J\001\221\340\340:\031\262;Oj\210\375hw\327\372\261\317\375\222\246\241\246_\246#M\253\2463\323\237\002\210\230\221@\306\356\206P\216-y \020\223\355\247}\022/\241\235\363\b!8U\233:\213J\332]\213\277B#\201\200\310\356~\304\003\376\245\216\315\006\345\025LUU\032\031<x2\344k\352?v\330z\n\n\322.\006\213\177\342(2\177\344\317\0258\371\355\317\347\300\007\033\314r0\031S\271\262\352\301\006\263.\013\227\tWFA\210\026\0255\324\245\212\030,\213\225\003\266\256\f\0267\226\205\305\251\353<Z\375\270\301\210\222\216z\f\325\316\234\304\300+\370\024F\372\"\334E\213H) \030\001\023"
+	.ascii	"\266\231E\306\036\344Y\213[\245\006\277\300\336\240\f\260\007"
+	.ascii	"\266\013\00711\345\241\304\306MX\"\244\022\273\301\254KX\315"
+	.ascii	"j4\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_txBytesFree.27.99095b1f5ad64a9b,"e",@progbits
+	.string	"(\265/\375` "
+	.string	"\225\007"
+	.string	"\222N45Pm\323\001$\243\352\246d\277\243\242\311\220P\033kF\270\325`\003\363g\243\021\364\2714eV\315.\336\321\321d\220D\2555y\273\r\257\243\311\333o[\356\224\002\230%\021$s4\325\325I\300,Yy6\f\325E)DI\305\006j\323\211\034\353\212\232\311\262Z\260\"&\245\025\245\271\267\352\004\241\037G\317v\360\274s\252\323G7{nOC\366\341*\310\n3$'\004!\273\022+*k\022\215`\330\316l\311\366{\366;\356\221}>\034`\027\204\"\262;\013\0341\217<1\266\375\215sd\326\340\264\3502!\212\b\220\224\335\031\247\013X\036\301\007X\036i\305\265?\315\377\307\241\306E\t\327m\177\227\203\335\365\343\272\211[o{\300\266\201\355\214\013"
+	.ascii	"\266\231E\246m`\304U\335\341\232x1\321\022\215\333\201\t\002"
+	.ascii	"N\030\251VL\302$\003"
+	.text
+	.section	.gnu.lto_mspDisplayPortVTable.28.99095b1f5ad64a9b,"e",@progbits
+	.string	"(\265/\375 \375\375\005"
+	.string	"D\n\303"
+	.string	""
+	.string	""
+	.string	"."
+	.string	"\005\001\212\001\202\200\200\374\342\203\344\302\005\177}\370\337\362\003{y\270\337\242\005wu\370\336\322\007sq\270\336\242\005om\370\335\302\005ki\270\335\262\005ge\330\334\002wc\334\302\005wa\327\202\005w_\327\322\003w]"
+	.string	"?\202\210\200\330\001[Y\305\001W\304\001U\303\001S\302\001Q\301\001O\300\001M\277\001K\276\001I\275\001G\274\001E\273\001"
+	.string	"\013/root/repo"
+	.string	" ./src/main/io/displayport_msp.c"
+	.string	"\013"
+	.string	"\240h(\332\nE\003R"
+	.string	")\200\024@\n %&)f\222:"
+	.ascii	"8"
+	.text
+	.section	.gnu.lto_displayPortMspInit.29.99095b1f5ad64a9b,"e",@progbits
+	.string	"(\265/\375`p\001\325\r"
+	.string	"\266\231[B"
+	.string	"\223\223\016\257C\001$\255\t\323\364\235\f\226\n\t7@\354\2348\3243\272\002\322\376\033\027}\231E\365\001\001af\245Z\027\252\306"
+	.string	"@QCU\275\252/\034\016\b-T_-j\024i{o)S\nC"
+	.string	"D"
+	.string	"J"
+	.string	"\273{\375\331$\366\365w\273\304\276|\023?QbS\201\310\262\002\340$\225\002\263c7b\216'"
+	.ascii	"\377\254\013\200\177*"
+	.string	"\342\246\247\311\377\313\235K\313JS1yj\026\354\256SSY\271\365\266\021\330\336\330\031 Oq\025!\277\345\317\331(\257\375\371#X\272\220\327\234\251\0162'jbGTj\b\373n\025\204\355\322\226Kk4\r]\372\271\264\323\264^\027\t\034\tfv9\254z\254\314S\215\360Q<\222|3\203\031\227!0\322\207\246\343\034\350\364\251\346@\361\200\312\225U\235>\345\307\243!<&\202\265\233!\304O\335\205\210;\236\364\300?\325\307+P\305\360\330N\2712H~{\013\220\265\213\262\342,(\270\017\b\202\340\337\267\303\214\254\335\3235\007\366lD\245\220\310\b)\023a\350T\020\225>\022\260\354\203Y\370tB\230\207T\3026\007\234\211&\220\260\221,#aW<\375\206\215\277\374\0334|\2209)\312V\203\327\240a\340\034\250Q\013\252\306\301g\310\200\n\242zQb{\372\350\007\217\301\031\300\262\273\001\037"
+	.ascii	"2\003\3020\342\206\301n`\235\225\006\026\0132\362\001\033\020"
+	.ascii	"_\240\f(\003\230\201\355\312!\006\022\270\302*:&\211(HkU\004"
+	.ascii	"p]WM\006\361\300u>:\244\033\002pM$\310\204~*\036@E&\356\264\251"
+	.ascii	"\235d"
+	.text
+	.section	.gnu.lto_output.part.0.37.99095b1f5ad64a9b,"e",@progbits
+	.string	"(\265/\375`o\001=\016"
+	.string	"\026ZZB \217\223\016#\352i\343`\200\360\315\375\310\026[\255\344\b\024\340CV\201z\353-\264\2136\024Y\264o\005\326L\006)\322\023\377\026\2520\325l\310\333\023\f\274\017\316\334 \r\202iZ\021O\366\2262\245E"
+	.string	"L"
+	.string	"D"
+	.string	"\216\326\241\375\021\241\022\333\276\210\243p6\314\353@\224\026\244\030\235V\354n<\304>\240:|\027P\035\352\207s\327|\234\237\244\222\350\372\324\r\240P\220J\032\236\027\177"
+	.ascii	"6v\327\326\206\033\3366\003\333\016\354\237\b\206-\240\007\330"
+	.ascii	"5\2614\2608\373Z9j\2172\314\323\354\210\007\223\227\335U\360"
+	.ascii	"\362\247P\267\031^\332'q\025\356%(\020\320\354\210\n\206\004"
+	.ascii	"\235e\315w\316\320\b=%\344\335\222\224X\323\316\320\340\236\022"
+	.ascii	"b\3355Q\361\262\333!8\fOUS\355\t\236<\t*6R\221\257\251O=3j!\222"
+	.ascii	"1\251'\326\367\267jr\245i\370\225\377\375\364\253\246\363\335"
+	.ascii	"\377\314\013\240\354\222\304\260\330\016\320D\210\273\334>K\310"
+	.ascii	"O\371ri\001a\"\016\007\016\003\237-{p\201x|\250\004P\004\355"
+	.ascii	"\350l\324\033\f\315\323\201\360\3312\255\002\307\207\346\341"
+	.ascii	"t\304\214\023A8\034\235\270\331<\021\003s\246yl\361\223e[\274"
+	.ascii	"l\347\325\344\247~\221P+\275`\273Ro\210\250\005\325\023\333\231"
+	.ascii	"\364\263*' p\002!#\353\001.\236!\003\306(\236\350\221\207\021"
+	.ascii	"\376\030\201\305\310&FQ\243\031\n\f\220\314\326\030\265\366\355"
+	.ascii	"\227\250\003\265!RF\204\357p_\f\036\354\332\331\236\rZO\255\335"
+	.ascii	"\f#\372&\327@\200\003I\204\306q\254\254\006\311\027\271\0204"
+	.ascii	"\257p[x\2362}\376\265a\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.99095b1f5ad64a9b,"e",@progbits
+	.string	"(\265/\375`\246\001\225\b"
+	.string	"\224\013\242\002"
+	.string	""
+	.string	""
+	.string	"\002\026\177\026\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\270\300\202\202\200\006\031\177\027\032\177\030\005\013\031\201\204\001\033\177\032%\177\033\271\200\202\202\200 \021\177\034\005 \035\022\177\036\002\025\177\037\024\177 \023\177!\002\027\177\"\030\177#\035\177$\272\200\202\005\017\021\200\003\005\034\022\016%\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\f&\005\002'\001\037\177(\377\037"
+	.string	""
+	.string	"\200\200\200\001!\177)#\177*\"\177+\036\177,\003\004\024$\003\005\025D\003\006\005\310\377\241\372\001\001\202\001\003\b\t\n\013\f\027\f\026\244\006\003\f\242\007\003\r\f\302\001\003\016$"
+	.string	"' \340\002\241\031\223\007d\222\t\371\320\204\2314\260#\301\233\331\362}9\267\252\006q0\f\365"
+	.ascii	"\034\001\016\037\310\365\245\240[0\226\0373\\\236\035\202\312"
+	.ascii	"\\A#c\254\341\030\250G\264&(\243\324#iM@\007q\215\323q\013\212"
+	.ascii	"cX\003\230-\225\3415h\3668\001"
+	.text
+	.section	.gnu.lto_.refs.99095b1f5ad64a9b,"e",@progbits
+	.string	"(\265/\375 oe\002"
+	.string	"r\005\017\024\240\247\031\003\377\377\377\217hm\213\375-d{i[\231d\n\022\256\007\003~2\035\230\330\315g{\2700\317\2559\222\224\216#/\226nA\321\212\204\0353\220\027\t9J\251|\265\020\005"
+	.ascii	"U\305\203c\240\t\220+Wi\002"
+	.text
+	.section	.gnu.lto_.decls.99095b1f5ad64a9b,"e",@progbits
+	.string	"(\265/\375`\230 -\226"
+	.string	"j\361\\5O R\322I\007\312\325\3144\026\301Y\306\242\031\270|x\007\247\223\200\347w\273\341\377ww\257\256\240\267\350\214\340y\264\210\314\210\326\204\310\363\003\r]\t\021\021\025\021\216\252\312\nQ\025D\253%\240x\016\210\262\264\031\230\322\2122\211 \262\245L\001\327\002Q\003N\003\357\013\2242\261\234Wm\212\233\263-\205qP@\036e\3364\372\027\244\243\006\325\034\203C\310a\240\350\244\262\234a7\026\201Qc\203i"
+	.string	"\243\306\006\271\r\277a6\354\206\237L\310j\316k\330y\306bf\260\251&\330&jl\260\305?D\310h\312\260\016#MZx\320\234\336\241\276o\250\347B\365<\250\236\373\3243\0275\250\207\314\233;\274F\001\2238U\2415\372\347|\262r|\\m\032=\263\251o\241\205\347\242D)\343r@\023NK\020\304\306\004\261\274\361\234\217\275\227\253\254\231\205\216\347( \213\032\033t\236q\332\230\232 \017\301bx\f\3671\031\326c?\336\343'\3631\336\371\013\347=\310y\357\023\253\255\261\033\347aY\260d\n\233\201\3414\037\245\363\346x\261\02656x\357\035\342\343.|g\302i\031\002W\022\301{\235\217\340\347)?\213\026\314\307[x\316\204\323\275\\[>^e\242\252\006\357u:\020\344\200\003\0168\240\036\231{\346\b"
+	.string	"=_\251\034\304K\365\347;\366\242\003\025\304\253\311\351\363F\365D\330\350\331\216\353\2347\250'N\023\275\244\372\031\352e\250/R/\203\372\026\324\021p\034\307\317\023,\347\374\351\211\003%\216\233Fo\202z>\221r!\237H/\202\032\344\326\334\306W\316n\314\306\363\344d7\364\336&\346\004|\230\023\310\241\003k\252\222\242\347@\275\005*\n.\2212\025\256\302\317 \266r\026-n\225Tn\331\275\367\207\365\234\250\264\032}\013u\200\246\333\342<\352\017\267\220\203\322\267*\304%\322\021\f\224B\300%R.;a\227R]W\355^'\211\037\347\325T\220F\357\344\022\251\312@\351\317h\204\035\310~m\006m\013?\313\360s\f?\247\360s\214\237g\370\031\206\237Y\370y\205\237_\370\231\210?\250@\202\007\032@\341\377\001\177\237\375,\205\215\t\377\323\277\351\b\327\374\274f"
+	.string	"\244\267\267\375\267\177_\371y\003\030?\027\361[\036\252\t\374y\257\f\f\351K\374]\370\337\357?\030\365\3576\036\332\364\340\306\00789\334\347o6?\343"
+	.ascii	"x\023?\037\177~\233\371Y\311\317M~f\362s\363\347\260\237\227"
+	.ascii	"\374,\306\343g\260\237\217\374\357\371\255\361g2?\207\371\271"
+	.ascii	"\313\317\317\237\315~&\373\031\312\317O~v\372\371\376\374\303"
+	.ascii	"\317>\374\334\303\317<\374\274\303\317:\374\234\303\3174~\266"
+	.ascii	"\341g\342\317H?\313\370y\375\017\347\347\032\376\377\375L\303"
+	.ascii	"\317'~\336\371\331\200\237\t\370\257\302\317"
+	.string	"@\377\345~\006\340g\022?\217\370\231\347\347\341\317\374?\316\3777\377\313\374\007\374_\366\377\201\377v\377G\024\026\026\026\376h\322\2172\360\007\265\tO^UK\264\246*\022K4\257\252\213\346uG\334\247&\346\215\247\313$q\321\274\314\\\264\256\252\021K\264\256\252%\232\027\026\343-\367\360\252\254\f\002\231\342\037\313\247K5\245\325\304\034\221\267tv\335\276{Y\r\3522\025\270W\253\213\331\327\304\203\341\234\362\250\234\334\232\272\b\230r\002\322u\237\362\226M\272\356m\342\224t\247$P:\363n\021\316S\006\321\272RP\367\0260u\257\222o\336\275Wy\357\0352\265\234\367\366\030\261lNM\335\213\0254u\265\224qP\367\266\232\037\\\325\022\rH\327P\234\025\264\346\265\341Tr\363\366y1U4\345\331\225\272\3672\032\265Y\265\343L\243\255\327cM\276.A\250g(\334B\234\237-D\347\201\340\274J"
+	.ascii	"\236`V)\372\013\017\222\035n;\032=\252T\317ef\215\346%jl\020"
+	.ascii	"H\22062\326'\b\344H\207}\221\362l5\273!\267\016s\361\3667\227"
+	.ascii	"\276k/=\327Y\032\257\355zKki\272\256\343gw\341\272wW\377h\257"
+	.ascii	"+-w\302\230\262\265\272&[\227\346P[\207\371(I\334\033\204KS\254"
+	.ascii	"\313\026\270\213\032\033\353$]\272\331N8\017\313yu\270\300\213"
+	.ascii	"\032\023\262\305\325\026$\027\227R\375\375qay\3075\\\032\347"
+	.ascii	"\345K\252Q\241~\323yr^4\035>4[j\203\352\237z;\204z\373E\275\235"
+	.ascii	"So\325\324\322P\273A)l\254\274\323|\246\240\324\335\220\202V"
+	.ascii	"E\304\335^\2300T\336U~r,\2374\332g\375ueH\034U\243\355\3449\237"
+	.ascii	"\264\272\261\037\215\366\224\0352\253\265'ZO\334D\361)QQ\224"
+	.ascii	"\221\371\310\301-\303\242\274\311v\372\256\304\2745\332P\372"
+	.ascii	"\353'\253k\307Y\243=6\324\241\244G\217F\373\t\317\211 \023h'"
+	.ascii	"\307s9@\326\374\275}9i\242\256i\343T\303\344\335\204\335\030"
+	.ascii	"\f\341\023j\211\017\030\251%>\226(\031\202"
+	.string	"\211\002\346f\350\244\b\027\033\035*\004\f\024\006\226\252\2611y\203\344\rF\207A\227\225\233]\032)\"\302\210\032\"p\210\274\213\274\f\3175\321r{R\312\032\275\232\376\372\257\303YV\204 \3625d\310\227\036\217\277;\307\207\303\252\2050\336\320\206\025 \223Fo\225\352\235p\f\224\3468\271\374m\235\237\275\305q\204\234W)\203\227+\261\301\313d\246x\227i\371 \263\032\202D'\316\215\223 \032\355\254\224\217Y\b\325\350\033L\355 \372\212\237\215\3657\017V;J\245\353\242\335\353\354\261MWwo\215\242B\351\017\013Y\361\\\357\335I95\352\344\311\221\343H\227\216\235(`\266\264\252\230i\332\\\225f\243o\346\33798KK\321p\2573\375q\006F\327h3P\312b\350M\225\216e\371\321\346\331SR\035\210\371 \323h\343\350\250\267T\337h)\t\272\356mj\251\2377\3676\3750'\300\234"
+	.string	"\032\005H\022\266\024}\023Y\332\230R$LL\243o\033\177\003\321PO\"\256\260\320di\264\231\\\"U\200\201\322v\032z?\345\370\371\241\331k4\001\006jj%\325\334\224\271F\337\3129\032\356"
+	.string	"?t\367\214]\243CC\001=ngD\264\354\033\036\220=\247F\255\233\275\302\317\333Y,\367\221\263\261f\347\247\376\007\276]j\327n\331~\035\0359.!^zjl|>\232w\352\207Z\234\326i\237A\352\225\002\004L\260\347\271\305\007V\243\335>\271\351K\340\215Fm\025\236S\315p<\221k\324Ri\2532-5\263F\355\331\351,\225+uf\335C\304\324\222!Yj\352\245H\261fL\345\346h\221\347Fl\354^,\241\324J`\224/3\353\367$/I\243\037^\221\361\323\2225\\\006j\267\251Jh\313eS7x\231\\R\220"
+	.ascii	"\313{\"\006\212\2052\342^ Yp?\204|f\254\260Y n\255\370i\201\260"
+	.ascii	"O\202\316\234\312\235,Z)Dxi\021;kTl\030\225\325\246&\205\207"
+	.ascii	"\305\352\023\314j\253\262/\202]\326K\314\213`\020\213\204\363"
+	.ascii	"\260F\334',\177\202\367^\333\264=\332\n\257\271\304:\261M\254"
+	.ascii	"\022\233\3042\341\247mZ \267A\330\253\007e\261M\353\303\n\301"
+	.ascii	"yD2(\273\023\334\341S\223$\317\007\345q@3?A\213\304\n\261Gv\256"
+	.ascii	"4\321,\001\263a\374\264H\324\b\350q3f\320,=b\215\360\300\341"
+	.ascii	"\360a\243Q[\004\315.*\310\326\027?-\22126\226\300\tk\324\016"
+	.ascii	"9 zC\211#*\355\241>\265R\237\332\370\241\212\021\334J\225\352"
+	.ascii	"s\340\250V\313n"
+	.string	"\361\223\001\313\365\234&\347u\366\0218kU\322\250g\006R[X\310\f\244\317\tT\2373\204\372\034=\365\267XV9hui\360\360\324\026bZ\035vG\024\270!mZ\324\333\252\022\214|i;]j\251ns\374:m\227\2449\025\247\336J\331\251\276\260\265\2635\3656\252\2550MV\243\026\207\n\225C\306\200\210-,BX\034\277]\332\033-\245C!\0346\215\276\217K\244=\f\224Z\250\241[\033;xZ\004\2474\312\223\243e\233l\223u\002\242\rK\250\263D!dr5\267N\375\365\267%\366\274\241\212\2115\031\241\231YWykk\343bc\003[[k0u\304u\332+k\272\2715X7\207iNY\202\204\317&\344\271\f\260\324[\006\367E\360^.)|\262\2324\311Q\252G~\244\301T\345\275\205\315\213\305\374k4\177\315&\275\227\235]9\230k\336lz\360\364\240\002\033m5i"
+	.ascii	"\001\373\314\013\277>C\027'\306'\245\321\026\354\257t\213\262"
+	.ascii	"GZ\243\035\310s\266\t\306\257H\243]\246\255z\246\2244\245\235"
+	.ascii	"\016\r\"\216\354\216P=\372\247^\271\322q\252\b!B\364\230\363"
+	.ascii	"\263\307\364\036\252\254\303J\221ZA1\303\362\246\006\t\322ET"
+	.ascii	"\245\220\254f\263\2330\326\265b\242\256\304\306.\226\225\320"
+	.ascii	";L\213y?\377\3544\020\356\275C'6,\246\320\337\177z\233\230\367"
+	.ascii	"^\0359\316\313t\342I9\207Y\350\357a\313\n\374G\357%\340\203{"
+	.ascii	"\225i\203iT&oM>P\334\347\344\335"
+	.string	"\373\344\245\314\300\253\352\311\213\307\022\315\353*\237\302\224$\230\327K\271D\273\227\304}zRr\320uI,\321n\325\005B\257\212\257\323Ky\237\272.\211\373t\233P,\003Ib1\204\235\365\310\264\204\026W\245c\022\231>I\005r\305z\304\244dT$\2568\"\231V\b\240\244\304T,\032\213\303$QJ\303xLJ\032\213C\031E\253\022Zc\311h\306:#MB2\235\200$ZB\3160\241\202R\021\361\270\306HR1\202\n!\304X\221\\\221\216E\311\033\214\214J0\326\243\021\306O\215%#\214\002\222OR\201\264\264\002i\t\310\250\310\344ArE\356\024etrE\256\307\034$\021\322\022O\222\250\210\264\224SDZ\262I\"\027C:\020\221\350\321Q\321\260\306\222\321\b=&\227\354\321ZD\"*\025\r\217V$\023\212\034\376H\204\264\244\242\247\3061\211$\"\255)\034\220$\026CXB\222"
+	.string	"\300zd$\201\250d4L!P\221<\026-\251H2-%\231\214=3\326$\262F\f\242%$\t&nD<\256\305\025I\275\004.\036p\361\"\207\341_P"
+	.ascii	"\001\005\020\244\177A\301\320\020\005.\206\324\273\030\262\311"
+	.ascii	"$\021\213\b\324u=z\200\\\22356\310!\271\203\256\310\242Ui=\016"
+	.ascii	"wb\320(:\036\211Xu \306(\256\353\321\b)\002\251H<&c\354\034\213"
+	.ascii	"\222`\254I\342\221\206\016\022\271\036\221\214\307\023\212!\034"
+	.ascii	"W\031\310b\321Q\005$1\200d\321ZC\362X\264&\351\030\025k \327"
+	.ascii	"c\032\300Q\254DE#1i\264\036\211\034,!g\370\034\213\222\214P$"
+	.ascii	"\321\252D\224a<\236\020\200\222\321H'\211d\262\341H\003\032\306"
+	.ascii	"\243N\362\270\342P$\2467\030\025)\325\360\203D\256\305d\022\022"
+	.ascii	"\361\270\301\232$&\321\370I>I\005\362\270\342@<\036\235\270q"
+	.ascii	"i=\256H\032\215\307\025;\311\"\223\021F\rEG$\035$Q\017\222\210"
+	.ascii	"\205\344\321x\002\320\252TC\221\n8\244\253\021\021\207\365(E"
+	.ascii	"\3220\036Q\244\222\321\bu\201i\370\002\322\270\204*\031\215\033"
+	.ascii	"\020\345\034\255\307\242U\311h\230$z\221,\022\323O0\001\f\024"
+	.ascii	"+\224\360\201j\244b\t9\203(y4.\325(RZB\022\217V\030\211+\212"
+	.ascii	"\304\242\031+\214\216\310\025*\020\240aL\341hD\036\231\214t\334"
+	.ascii	"\330gO\223\315\021>\302\316C\225dS\332\264\261d\266\224\254\211"
+	.ascii	"\262\203\326\354\006W\0317\215\242Nu;\264\324\334\2569s\365\303"
+	.ascii	"G\243\026\215M\363\244\3116\246Q\3002L\376\344\314\3303?D\232"
+	.ascii	"ks\017\274 s\260\311\240\237`\227!\025\231\233!\2016\f\\\216"
+	.ascii	")V\312\260\251\"\365\305\004\260\367\354\023\327ZX\243||\226"
+	.ascii	"\fW\351\02156\330xQ\342\\\361\273%s\2362B\345\217F\355\230\376"
+	.ascii	"\032:\231YO\372\316\325,\342\244\317\016Q\007\306\305\243\277"
+	.ascii	"\250kc\366\266\264\354n\277\330\3310\366\214\212\325\2454s\001"
+	.ascii	"\335`\317\225\036P\272\362n\303\334\356\261ha\337\250\350\274"
+	.ascii	"\3264j\365|\260\356\344\004\301X-L\204\240=\240R\271\252\252"
+	.ascii	"\262x;ftP{\215\332\273[\265!Tyz^~\035\0363H\256\2144z\225\207"
+	.ascii	"z\225\231v\333\226f\273"
+	.string	"\330=\236\253\244rs\f\333\306\n\317\f\336%\226\220OT\240\227\020\271\333.\267\\X\2648`q\210\025+\215\332-\267Z\212\240\261\262\244\263Z\224\374\271\3051\243\332,\017l\021\376x3GD\017\314I\243\035w\300\236\222s\262\325\250\205{`\202\244\250B\t5J\342\0203\206HDd$M\222\016R\n\020\006\243a\036\250\251\036\022\240D9\021:\347\314\214\210$IQ!{\314\001\252\215kJ\336\363\007ZM\004\004\201\324\34142=\331\212\323\"C\270\370W\013]\rx\202\330\2347S\245p\241$\267\372\2326\377:r\211@\315\001 \364A\304\031\303,\013\374\373\025^\240f\367~a\n\274sH\247du\210\312\272^Rs\033,%+Qy\377\231=oO\310\b\321V\217\277\230\324\311\320\244\354G\341Y\266\n\365B\t\331F1\360JQnj\327\006\254\024\037o\262\320P\023a\005\224S"
+	.string	"\007P/\226\006\025#\336a\264^\025\330\006\263!!\360\356\261\005B\212q[\271H(\210\376'>n\346\"eN}z\320\\\004\031PVL\001\336Qu\256\214\2502d\025\375\224\241\374\327h9\214\\\352\030\003\2728Afk\nL\3735\217Z\3456\231\235_\336\267\353\325\247An\270Q\265\253\276pd$\202\023q|\356\302[\277\313\255\301\265\211D\f\233\255l?\301a\3335\375\006\314GT\267\020\024M\030\023\304VUM\226\314<\351\265O.Z\002\002\353@\tb\f\223\fU\303\204\021\022@\n\241l\2602\331S"
+	.string	"\257\333\"\245\313\355\005\374\200\237\342r\324\340\322B\004~IQ\351uT\024|\255\350@\3615\275\357Y\245\237\313G}>\211\030\033\330\225\330\017\355\267\361\212\362H\3173h\340\322"
+	.ascii	"y\340A\277\033\346\004\005\221\224\003\263\276a\016P\262\336"
+	.ascii	"UW$\005\322`\335%\210\r\222q\321\337\223\207\004\2411\001`e4"
+	.ascii	"\343{H(\025\213'\372\276\370\230\213;\346P\031g\200\207\034\373"
+	.ascii	"\262\236'\305\350\353\317\333\266y\213z3\b\316&t_\324\235\275"
+	.ascii	"R\216\232&C1%\243\300E\202\202NeXYc\3449\331\031N\350\300\250"
+	.ascii	"\357vn/\241\341\177\376\341\020\375J\242\342W\201\304[Q\037\321"
+	.ascii	"\353\021Th\204_\331\327\262+Y\0049\210f+\250\302\300\2039\315"
+	.ascii	"\242\343\215AB\be\253\257\217[1fFD\345"
+	.string	"\300\202\314\231\224\217\353>\346\317\254\221k\374\301\350\327=\275\302\221\243\342%\200!\t\312>6\277\030yJN\335\233\025$\\\032\037%\214\353\267L\301\t\340\225\350\272\356}\004\243\372\023\344\223NE\034\242\311E\354\221\263o\367\210\fI@{\036\031-w\224W\331\372\372/\327\034W\201\226\003.\214\214\215\237i\030\234\312!\232f\304\346u\002Y\033\370\023\020d\330\310&\nY\372\246\n=\347\267/\300"
+	.string	"'\256N\261\374\nz|Q\336HRX\005#\350\347\024ZR\360=\215\374FxwQ\311\234\227=\254\340i\375}\017\346\301s{\334\276\002N<\331O\355P"
+	.string	"\004\233\207\2157\335tO(\006\350\307G$\260\377\313\002O,\316\365\354\033\343u"
+	.ascii	"\013\006M\214\264\354`\262\300k\302S\304\033\352\007\205'\310"
+	.ascii	"\267H\240D>\230};\234"
+	.string	"\236t\2110\225\337\207\232\233x\260*~\242\002\247VH\243\376\253\30291D1\363\366x\214\314\344\344\327\3630\301\355\034\343\\\340\265\021\321\336\346W\035\234+\357\377\266\202\361\tb\304\320\352\246=\237\215\277\203\027\272\301\253Q,\330\3154\004q]\250K\214\326NP\365\007x\177b\243D\254\031%\341\355\270\250D\020\2138\022\357i\361\315\273\267\200p\340\005F\020[\257\207=^\270\001\357\023\304\272\261\334]\320\013aI\211>\007\3322\270\202Y\177&\257\314r\b1\204\332\0047\016\213\2533\t\r\323\354Ma\267\214\217\242\311\306\214\205\314\301\231\252\213t\006\t\257\r\334\022SG1Dx\363\231\357&|\241P\262\337\013\353\314$\351\331V#f\206\256A\247\344\265\353+\216\261\016\315\206\201JB\314l@R\370\025\244\327#\360g\264$\204\376C\234\0047\340\342\353\227!\241\360\237\200\213\0011\240O\375"
+	.string	"Lx\353@\207\240\321\350\020\222D\333\375}\314.\211}"
+	.string	"\244\340c\270\344\303\352\2679\317\032\250\276\215\203\312\306\344W\242\223\230\016,\f\241\304\033R\346\275\177\007O\205\317\177\330m\306\016"
+	.ascii	"M\3045\314\261\306n7\261\261\340\257kn\300i\354\266\314\243\313"
+	.ascii	"{\300t\034H0%\031\321j\221\022H5\200>\030\246\264B6i\261\311"
+	.ascii	"W\345\017\235\033\267\253J\342-\017[:.ac\207<\317V\fx\221\017"
+	.ascii	"H_G\371\366\177},\032?\277\3307\311b\200\037\340\372\205\347"
+	.ascii	"\325\341\355\225/\365\265\345\217\324\235\341\234\365\353\200"
+	.ascii	"\243\302\257\017\256\270\215\263U\274}\214\031\230\017!\277t"
+	.ascii	"\355\346z\035\342D\207\367t\377\375\322\241gT\326\325\201\237"
+	.ascii	"\345\214u\277\021\216\t\370Mw\325\271\021\333a\363\030\366\376"
+	.ascii	"\366\356 1\207\360^9\036\242:\350\253\357\003\027#\312S\\?D\366"
+	.ascii	"8\371^\177\3562\250\237=\2370\246\224\207\022>4\221\345\260\013"
+	.ascii	"\351w\206Wf\254X2]\031\250\254\002\266o\005\256\374\254F7X\336"
+	.ascii	"\350_Z?\360\204\204[\327\273t\244\037\347\300\366\314\233Z\320"
+	.ascii	"\345\376\3227\336\255\305\360\277\016\265\002"
+	.text
+	.section	.gnu.lto_.symtab.99095b1f5ad64a9b,"e",@progbits
+	.string	"displayPortProfileMsp_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\001"
+	.string	""
+	.string	"displayPortMspInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\001"
+	.string	""
+	.string	"displayPortProfileMsp_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\001"
+	.string	""
+	.string	"displayPortProfileMsp_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\001"
+	.string	""
+	.string	"cliMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\001"
+	.string	""
+	.string	"mspSerialTxBytesFree"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\001"
+	.string	""
+	.string	"mspSerialPush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\001"
+	.string	""
+	.string	"displayInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.99095b1f5ad64a9b,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,526 @@
+	.file	"displayport_rcdevice.c"
+	.section	.gnu.lto_.profile.605ba428029af9b3,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.605ba428029af9b3,"e",@progbits
+	.string	"(\265/\375 .]\001"
+	.string	"D\002\""
+	.string	"\005"
+	.string	"\255\237\343\252\016"
+	.string	"\001\240\342\234\212\n\002\361\253\302\312\n\003\367\202\306\263\007"
+	.string	"\017\240\342\234\212\n"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.605ba428029af9b3,"e",@progbits
+	.string	"(\265/\375 %\r\001"
+	.string	"\330\031"
+	.string	"\002"
+	.string	""
+	.string	"\003"
+	.string	"\001"
+	.string	"\001\003\001"
+	.string	"\020"
+	.string	"\007\003"
+	.string	"\002\001\001\200\f"
+	.string	""
+	.string	"\b"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.605ba428029af9b3,"e",@progbits
+	.string	"(\265/\375 w\245\002"
+	.string	"\264\003k"
+	.string	"\002"
+	.string	""
+	.string	"\b\200\200\200\220\003g\001\201\200\200\200~"
+	.string	""
+	.string	"\006\200\200\200\200\002d\002"
+	.string	""
+	.string	"\003\f"
+	.string	""
+	.string	"\001\002\013"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\003"
+	.string	"\n\260\207\234\340\002\004\002\013\001\220N"
+	.string	""
+	.string	"\t"
+	.string	"_\005h\352B\200\002\252\271\262\272"
+	.ascii	"T\2776W\205)\346\006\332"
+	.text
+	.section	.gnu.lto_.jmpfuncs.605ba428029af9b3,"e",@progbits
+	.string	"(\265/\375 p}\002"
+	.string	"\344\003d"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	"\004\003\002"
+	.string	""
+	.string	"\001\300\004\001"
+	.string	"\300\004\002x"
+	.string	"\001\002\006}\001\001\006}\001\177\003\002\002`"
+	.string	"\001\002\001\272\001\001\273\001\002\003\001\001\002\001\002\003"
+	.string	"\002\004\177"
+	.string	"\001\177"
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"Z\225\3279\004\251\220\307\316\3626\200\005"
+	.text
+	.section	.gnu.lto_.pureconst.605ba428029af9b3,"e",@progbits
+	.string	"(\265/\375 \nQ"
+	.string	""
+	.string	"\006"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\230\004\003\030"
+	.text
+	.section	.gnu.lto_.ipa_modref.605ba428029af9b3,"e",@progbits
+	.string	"(\265/\375 \"u"
+	.string	""
+	.string	"0\026"
+	.string	"\002"
+	.string	"\003"
+	.string	"\003P\002"
+	.ascii	"\245l\001"
+	.text
+	.section	.gnu.lto_.lto.605ba428029af9b3,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_rcdeviceOSDVTable.11.605ba428029af9b3,"e",@progbits
+	.string	"(\265/\375 \367\335\005"
+	.string	"\004\n\270"
+	.string	""
+	.string	""
+	.string	"3"
+	.string	"\005\001\212\001\202\200\200\374\342\203\257,\177}\370\256\037{y\270\256*wu\370\255=sq\270\255*om\370\254,ki\257+ge\230,wc\370\247,wa\270\247(w_\370\246\035w]"
+	.string	"?\202\210\200\330\001[Y\305\001W\304\001U\303\001S\302\001Q\301\001O\300\001M\277\001K\276\001I\275\001G\274\001E\273\001"
+	.string	"\013/root/repo"
+	.string	"%./src/main/io/displayport_rcdevice.c"
+	.string	"\013"
+	.string	"\200h \032\n\204"
+	.ascii	"B@\321\200h@4 \032&\321d\0225\200\""
+	.text
+	.section	.gnu.lto_rcdeviceDisplayPortInit.12.605ba428029af9b3,"e",@progbits
+	.string	"(\265/\375`\231"
+	.string	"\265\n"
+	.string	"\226\224J=0M\225\016\003\356\252\335\004Q\252\021\213\257\030\317\315R4\250<\207R4\375y\372\250\222\214]\f\265\263\202q\021\224\230`8\364\302\246\317\261\234|\364\361\276\027\017\025\320Z\334dK\231R7"
+	.string	":"
+	.string	"7"
+	.string	"\363\362<\200x\253\361\214xk1\274;\\\355\374\307\347\0356*|\341"
+	.string	"\217\303\214| H\200\205\210\371\323u\364}T/&RJ\253\350#\335\326m'\260\215\300~$\361\246\037Z\255\253\276\243\023B\0050!%\205\026+y\302*\261\301\266\307\206\330V\275\251s\f)K+\022RN\003>\320\270e\333\357p\017\036w\002f\006\022%\025\n\241B\312\336\270\272\243\365d\302~\240C\355\r\202^\024w\325B\n\020r\315\211_\006\037R ]\341\250p\355\b\022\364\242\357OW\240a\252P\200\326\263\247\247{\301>\224[r\331Ek\260q\024\013\266y\030\223d\230\266\311,\030\267@\303m\030N\345\202\311h\226k\323\256\007Z\305\301\205q\231KR\300\033&\343.\315\266q\027d\312o\311?\035\232T\250\021\352w1\017"
+	.ascii	"\\\b\230\2473\364\b\020\013+\202j\txi\335\3732\254\347B.1\206"
+	.ascii	"\025\325^\304\330\033~\246i\252=\032\230\332\003"
+	.text
+	.section	.gnu.lto_rcdeviceDisplayPortInit.part.0.26.605ba428029af9b3,"e",@progbits
+	.string	"(\265/\375`\030\001\275\f"
+	.string	"\266\226RA\020Q\234\016\3003"
+	.string	"\345\b\264\t\260Oq\353\214 \253\336!\304\221\312\344\333F6\310\024\232\353\020a\213\237qO\331w\200]\336\310\f"
+	.string	"\250\252\003\\\024 `H\024\311\346\351\324[\024i\023\271S\n?"
+	.string	"="
+	.string	"B"
+	.string	")\256\342\343\357@h\372P\321\261!d\307n\230]:\274\001\353\362:\001\353RK\374\273\306\352\363cH\004^\177z4\241@\345\020\021\215\036%\257>(\273\353\013\304-o\273\201m\007\366G\001Z\275Z%\331\216\276\214<\004\210\330\355\320#\265#d\215\023\007\271}\026\036\377d\f\344a\007\001hRpi\215\017;\037\260KJ\321\330\r\027\\\232\301ui\177l\354r\205\307\203m?/VI8\300\f\031\336\"\304\033#\030\0244\026\217z\214y\355j\200q\021\tUfZ\323\272<\352.\276k\027\024\362\026\024|\023\227\366\276\370\320\245\377Y\025,\304\207\374\323/\0346F2(\030\265\344\033\206\2030\273\312E\343"
+	.ascii	"\2606\3314\216\263]\264\356\301\246\233\232\216\005\243\361\270"
+	.ascii	"K6\271l\002g\311dZ\347e\223\004\236\232\255\3136sv\031\366j\225"
+	.ascii	"$\211\366\256\034\324\024\220^\260\252\226l\027\b\221\n  \240"
+	.ascii	"\002\0313\362n\212q\232\3005\0021|\216\034YN\327\251r\0206\256"
+	.ascii	"\205&y[\230~\033\316\370\017\033s\321.\211\3260\033\316\336\017"
+	.ascii	"\354\321\r\354h\236B\264B\tH\272\336.\301\216#d\027`z\212\242"
+	.ascii	"\373\257\355c"
+	.text
+	.section	.gnu.lto_.symbol_nodes.605ba428029af9b3,"e",@progbits
+	.string	"(\265/\375`\332"
+	.string	"]\005"
+	.string	"\322G\034%\240)\035c\325\230w\345\220\252\"n\255\266\345?\376oU\237q\263o\3777B\366&d\023\322\254\265M\266\334)}\254\234h./d\254\361\312\034\256\354\225\335)K\013f{NL\236$#\234\017\221\r\220\013\217\t\003W\002S\001\303[\336.6"
+	.string	"\277\3256\343+\315Q\262'\324\"\220>\255-\3431F(\255[\214d9\377\357X\221mW&\030"
+	.string	"\240\220\326 \202k\006\\\027\314\001\354\326\354$V\013\033\240\036"
+	.string	"\034"
+	.string	"\034"
+	.string	"\034"
+	.string	"\034"
+	.string	"\034"
+	.string	"\034"
+	.string	"\034"
+	.string	"\034"
+	.ascii	"\f\037\321\005_\206\313\350S\367X\"\323\004\352\t"
+	.text
+	.section	.gnu.lto_.refs.605ba428029af9b3,"e",@progbits
+	.string	"(\265/\375 /y\001"
+	.string	"+"
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	"\002\001\001"
+	.string	"\002\002\001"
+	.string	"\002\001\002"
+	.string	"\002\001\004"
+	.string	"\013\002\002\004\002\005\002\006\002\007\002\b\002\t\002\n\002\013\002\f\002\r\002\016"
+	.text
+	.section	.gnu.lto_.decls.605ba428029af9b3,"e",@progbits
+	.string	"(\265/\375`\224\023U]"
+	.string	"\032\232\214\"P0\220J\352\327\013\356Y?\211\240\302\276\267ik\032\226\026\304\026S\234\347\346\306\235\004\357h\271\250\r\211\036S\250\215\024\344\326\251\365\310\336\371\265\223\030]K\273QN\030\207\221\263e\357\247\211\271\2232 T\214M\227\274\261\f\363\212\3447I)\005\345\001\027\002\f\002Pt\270:\307\203V\345\024\213\273\214\"\206^\033\033ckc:\020T\310\013\240\210\325u\361\322k@\275\377\2572'\030\030zM\005Y\3229\255b\245\261\210\241\325\375\277\231>\32344\232\226\353\032\372\255\3234\\?;\256\245\334em\306D\355\377\261\321\262t\264\245[\0204yv[\246\261"
+	.string	"\025\333\307J\221%\351\234\376?7\300\214\024\327a\232\f\b*$\213\257%u\377-Saf"
+	.string	"E\307\265\f\275\006\202\352\377\313\013\b,\272\303n\372\337\222 \"A\202\004\211\213d\355\f\313\203\312\335\344r\013\271\314M\206\271gh\266\036\323CZ1\037\355\277\035\342\251\022\3224\266@^\222\307;W\237-\246\335\332'\342\200\347\344\255\225\227;\307\3456\336\333\252p\271\306\345\341\025\372\322i\375\f\321jm\020\007<)xr\\\345\022.w\b_\347u\b\037\307\270DQ\357-\315\205;\332Z~\216mG\325\177c\367\b\240\356\021:0(1Z\361\251<\302e\017\256\210\376\340kh\237\365\223\250\2570\003(\270W\254\362e\377\037\324oT\311.WY\203\273\302\3475\221\217-\270E\375\301'\324\035|&\372\203\217{\n\033P\345Q\360"
+	.ascii	"\267\333\376\340#\352\016>\366\313\314vR\235\0023\317\241\020"
+	.ascii	"\304\354.0\267\0066\230{\252\0063oY\352a\366\026\230\033\211"
+	.ascii	"\271\223\230\033\005s+\300\334\0130\267\003\314}\202\271M0\367"
+	.ascii	"\021s\0331w\003\314\375@\001\004\374\3500\036\337\225`\346\002"
+	.ascii	"\230}\006s\323`\356\023\230\233\004\346~b\356\030\314\355\304"
+	.ascii	"\3340\230{\004\346\026\201\271C`n\020\230\333\003\346\346\200"
+	.ascii	"\271_\264\013\346\256\200\271U0\263\032f\246cf\017\314\034\206"
+	.ascii	"\231\325\274\274\274<\346^b\356]a\016\212\nrWa\334\\\225{r\267"
+	.ascii	"\027\346r\257\313\345\336\331\345\226\322]\307\375\354:\037\273"
+	.ascii	"\240\375bkE\265J\270\224\366\370\223$+\232\305\344r\263a9\220"
+	.ascii	"$\2677-GL\256\256\335\364\234\316#\343\311.\017\022\006\t\254"
+	.ascii	"\363\222\2740{\023\217\342P\\\211\277\340b\376\304\231\270\323"
+	.ascii	"\227\270\223~zX\273q\263i\033\332\b\361$Kh\330\230m\316\026f"
+	.ascii	"p\"5;\017\2508\364/\204\315\211\303\257\020\020\223t\212\371"
+	.ascii	"\207y\321\253Z\272\325>\217\2441I\247\013^_[\210\222 \361%\347"
+	.ascii	"\346\276\\`G\342G|inD\254\\\365!N\244\237E^\204\335H\2431\317"
+	.ascii	"\261}(O\\\033/4W\325^\221\313]\344\013\352\"_\257\353r\317\307"
+	.ascii	"\345\036\326\345\036\325e\237\006\361/5\314\324,\216{\261\177"
+	.ascii	"\001]Ii\313A\007\204\253G\f\234\0313?\330\271\202\260\220Q\\"
+	.ascii	"\365\255\236r\031\222\226t\325}\364\032\020\2266\261\026\\u\026"
+	.ascii	"|\310\264\262D\361\036AQ\344\354\210\363\036\256E\2465$I\313"
+	.ascii	"\223&\347I\017W}\351<\330\263\\\351Y'\230\377F\317\n\232\363"
+	.ascii	"o\f\352\036\321=B\035\003[\242\305\247\262\313]v\267+\302\257"
+	.ascii	"\334\nH\355\013\362\005\337\301n\345#\307\002\r^\\u\035=\r\372"
+	.ascii	"\301\314\242\342\252\347\330\341\301\204\213\313UG\366ZO\rk\302"
+	.ascii	"\250\255\351\200\301\231\363\242v\231\275\312o\\8v\355\033?\262"
+	.ascii	"\337\350h\227\271;\253r*\2402VM\2008\225\033w\312\214)\221\263"
+	.ascii	"\363\304\310W\034\263k\202;\017\317\207\246%l\316\r\334x0H\300"
+	.ascii	"\324\212z\230\234\273\236#o\212\334`\307}\307j~\036\204\253\301"
+	.ascii	"\231\225\271\312oz\312\314<\375\343J\220\"\3238AC\210\274\371"
+	.ascii	"\230\373\2658\035ZpZ\272\203C\213.\314U\366$\227\333/\335\301"
+	.ascii	"\247\303\306\265\206N\245\363\241fN\223q?\233\254\351&\330j\277"
+	.ascii	"\030\201\026,\266\351+\267Jp\230B\027\316\2351fpueoo~\303y\006"
+	.ascii	"O\214'\251fM[\227T\352Vh@h\276\332\370p\214\031\343\\D\314\336"
+	.ascii	"\231\235:9\270\031\352\334\334\374\213\210\331CSw\006O\314'\354"
+	.ascii	"\b\346\207\230\2666\263\013\244\310\026\023,llZ|\226VUZg\f14"
+	.ascii	"\036\367\216\377E\346t\270\036\321\250\253\254\343u\031\f\203"
+	.ascii	"i\274\256\362XM\204y\006o\372\277Ut\361\354\214\320\255\271Z"
+	.ascii	"<M\213\253\371\376\273eb)\177KY\304\314o\330\325\346\274\240"
+	.ascii	"\234\241y\026\366-\274\305\277\334\342\377R\232\255\255\" \026"
+	.ascii	"\262d\230\301\013\373\227i\262\311\006K\027\225\254\314\215\""
+	.ascii	"\336\205\313\024\214L\330Y\217\2167\251\321\243>\205\314\215"
+	.ascii	"2\0342\\V\305.\2633\373\336\250\374\177\036:\355+\251~\270u\272"
+	.ascii	"\213\2309t\257\017`f\365{\314D\302\366\213W\312\334\3340/F ,"
+	.ascii	"\342YG\372\177l\026'h.\217M\037Hh\363\213\307\027\212C\312o\026"
+	.ascii	"\221\320\377\241?\036\213J\314\037BB\177\3717\336\226\375"
+	.string	"m\263\370G\346\017\375\361\215\"\220\307\346\022\t5.\207\220\320\346\362\241\315\027\372\243Q\231\343\370\312\241\2076\331<\224\271\024BB\231K$\264\271\325K\220p\312\345Y\031\230\216f\202<~\362\252\313\250\024\222\"[\346\313\3757Z\325+\017\370\357b*\345\214>\372\013\2254I\02552\007\270\242\002c\376Q\212t\302\374wB\365\364W'\212\255\364\215\264\264(\244\353\255\252\376\t\370\366\377\352\277\330/\375\377\342\377\357(\273\332\177.!\244\363\352\352\177\213\350\352\273\212iU\377\216\226\346\313\022\t\005c\"\245]\201:\037G[l\347\3135\225\027Z\244\362V\377\337m\256s\231e\003\226+G3\036\255\253g\276,R*d\256\262Zu\271\301\264Y\352\314\236u(\230\221\234\212\227\241\005Q\203z\025\267\322O\247\342S\330\237\335\205\373\006\304`\024\013\037~2\302\340\005\013\246#\342*\203\375\021E\224"
+	.string	"\024B\255XY\341\n\246\240\027..`a@\007JL-<t\300\244\364a\205\013%\246\026"
+	.string	"\f\205MG\302 \214\037k\201\022S\213 \001L\030\021\331\237\224\0211\030\305\242"
+	.ascii	"\006\006\3315j\225q\371D\322\002I)j\354p\n\025&T\230\360q\n\025"
+	.ascii	"HH*\222\220.'!\365\210\374d\344\004\234:\222!\345a\352\016\233"
+	.ascii	"V\250`\f!\273\344\004\234\3721a%\016m\f\233\204\253Sp\352\207"
+	.ascii	"\270\016c\304\0206=]\"\261\211\201\006\356\272\262\025\fW\242"
+	.ascii	"\r\nj\020}\324u\370[\241Vv\307\207\211\306\217u\352YQ\b2E\255"
+	.ascii	"+\013\034\366\260\277'\240*#*\310\022\231|\330\337\323\212\225"
+	.ascii	"\030di\360\f\207++C\310.E\261`\327\030\303\250\037\373b\030\364"
+	.ascii	"@\374\2550\210\354o}\342\001F\331\030\256\254O\211\251\305\020"
+	.ascii	"'@\344'\243!\273N\005Y\247\020,\224Z\331#\242P\310\036\371\020"
+	.ascii	"\243f\bW\300\370\2612x\206M\034\206M\0348uX\241`\374^L\371|C"
+	.ascii	"\032BV\035B\t\201\252\0073v>\030\n\245T(\241\220\202&\035\247"
+	.ascii	"\225\375\255P\300\035bS\nbT\320GC\350\202\025\016\331\031@\036"
+	.ascii	"~\340\201"
+	.ascii	"\025\"6\310\300\202\0134j\"\262B)\247#a\360(*\3703\341\b\310"
+	.ascii	"\016\217\214\020 \262\302%\033?(\251aPI\211\251\305\n\fN\255"
+	.ascii	"N@6\2009cj\221\354i'\207\215{1\201\263\343N\215\203\263\215\203"
+	.ascii	"\263\213\263\344\n\356\315"
+	.string	"\3256m<\216\362\f\336T\355\301$\203\303\036\247\207\231D&\337tW\0207U\336\270\261\303*3\353\261,7\036Q\346\346\234\215\025\256\244s:f\f\217\213\327\261\263\371)\273+\256\351i\253\374\021E\215\317\227\323\310\0235t@mJ\276|\210q)7\013\0328/Wy\007I\032\356\247\247\361#\352\261\375e\007\177\347D\354\225l%\206\224H\243\334\311\3119\022\242\373eN\272\370\234\201\001;\003\027\027\327w-\324R\315q\251\3439\302\305\016N\232\0313\321\201\225\250q8\307\230$\"2\"\"\222$I:\201\005\204 \310\240+\017\021\360,\224\312P\215$\005)\025Z\003K\030j[S\330W9l;\330*\025|\365j\333Ag \237\016<^\300\0206\336\366\310q\254\20737\030\210z\335\207=\310\035\230\3552\271fw\307\236b\341\215\003\306\031\240\306\221\360F\353\362c3\302\342\311l\\"
+	.string	"\017\201\243\034\234"
+	.string	"`\302\006D\"A\n\320\032\241\235\353\301\\\314\n$1\215\002\2641\264:\033\361\372\363~\347\202\222\334\346d\262\f~\231\313\345\032\260:\024f\220"
+	.ascii	"\302\235\242\264\343;E)\356V\377\267Z\276\330\002u\351\177X\001"
+	.ascii	"'\221K\332P\223\260>\013[/;\252\030\215'\265m\305\374\024\364"
+	.ascii	"\341\246\370\210\034\036\306\004\372\253\312Ss\322(\224\t0F\034"
+	.ascii	"\327\017\372\214\r\335\216Z\245\323\017\246\236\035bD\t\301\230"
+	.ascii	"@5E\274\210 \222\"\365\207\202\347\026DS\235\b\2736\244\353["
+	.ascii	"\341c\214T\300x\307\326\346\r\n1\032\027\241i\032-\242HK\242"
+	.ascii	"d\257)=\016\257\236\333"
+	.string	"\013\377\372t\302\222P\2530\2610?%Y&\025\223\034\362\350\257i\326\263\263\005\346\203}\316\202k[\034\n\350C\004\300v4yjt\370KR^s\226\020\234\333\330?@\222\245\023\017tJMI<\227\234b\331\201\372\3171+R\330+\313^\203!\307;j5\r\217%\243X@3V\356<\353<09'\313\017%C\222\347\0325pU\025M}\326\223\005\263h\240\024\344/\315SZ\322\226\251n8\\P\251cG\207\245\361\021\316\363\212\314\331\304\361\363{7\320=\t0\347\023\340\314F\"\377\270\001\226\034\0042\210\214\007=\027t\024\216\346\203X\343X\032\200;w\210\317\001Cy\341\341\177V\264\\\354\204\335]\022#Ce'X\036\200q^,[\235^\247\333\373|\343\336\247-\370\352\223\321>\336\347\223\223\"\221\036%\334pv\276\237\365\2522C\266n\267\204)1\201\023\001l5R 4"
+	.string	"\020\030\005}\346H\355\346\351Cb\215\2661\330\275E\227\264\031\001\020L\312\211\265\372\373\210\237\337\250\372\207}(\001EJ\234\354\343\301\037t\027\035q\364\264\243#\366\325\322\322}a\272M\025\023\254\266\266\n\240\207M'\r\315\242\315\214\276.\272\344\205\202\260\315M\264\336\322\367i\246R\250~\356\354M~\026\325\207\016\352\b\217\265\240T\020\200K\034\322K\016\225K\236\222\253\304n(\247Bn\001U\035\322\021z\374\303\373\231"
+	.string	"4,&\331\351\333\2249y\243\023v\245~yB\205\217\353\255\002\t\354W\025\322o\346)`\213\323\304\261N\254\034\001\273\322]"
+	.ascii	"\036\330Y\247\240\365\200Q\302E\324\365\352a\300\337}\337\373"
+	.ascii	"\3069\333\266\263O\330\241\346{pQ\311\301\207\225\227\362\375"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.symtab.605ba428029af9b3,"e",@progbits
+	.string	"rcdeviceOSDDisplayPort"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\030"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355"
+	.string	""
+	.string	""
+	.string	"rcdeviceDisplayPortInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\001"
+	.string	""
+	.string	"rcdeviceOSDGrab"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\001"
+	.string	""
+	.string	"rcdeviceOSDRelease"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\001"
+	.string	""
+	.string	"rcdeviceOSDClearScreen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\001"
+	.string	""
+	.string	"rcdeviceOSDDrawScreen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\001"
+	.string	""
+	.string	"rcdeviceScreenSize"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\001"
+	.string	""
+	.string	"rcdeviceOSDWriteString"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\001"
+	.string	""
+	.string	"rcdeviceOSDWriteChar"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\001"
+	.string	""
+	.string	"rcdeviceOSDIsTransferInProgress"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\001"
+	.string	""
+	.string	"rcdeviceOSDHeartbeat"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\001"
+	.string	""
+	.string	"rcdeviceOSDResync"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\001"
+	.string	""
+	.string	"rcdeviceOSDTxBytesFree"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\001"
+	.string	""
+	.string	"displayInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\001"
+	.string	""
+	.string	"rcdeviceOSDInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.605ba428029af9b3,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,2654 @@
+	.file	"gps.c"
+	.section	.gnu.lto_.profile.1e3ebfca832d24ac,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.1e3ebfca832d24ac,"e",@progbits
+	.string	"(\265/\375`\341\007}\033"
+	.string	"\364\034\325\b"
+	.string	"]"
+	.string	"\302\372\202\311\007\006\002"
+	.string	"\001\224\367\311\301\rr\002\001\002\001\003\002\003\002\004\002\005\006\002\005\002\007\002\007\002\002\006\b\t\007\213\326\277\344\004\003\240\342\234\212\n\004\005\006\b\t\n\013\f\r\016\017\352\263\360\321\b\020\334\307\272\354\tt\006\002\006\t\002\n"
+	.string	"\002\013\021\022\023\024\025\026\027\030\031\032\033\357\256\365\200\f$\f\002\f\004\002\r\016\002\017\034\035\036\331\351\335\210\001\037\315\343\301\244\013 !\"\326\353\250\370\005\266\001"
+	.string	"\002\020\004\002\021\021\002\006\b\002\002\021#$%&'()*+\224\360\252\367\004\n\002\002\002\022\002\t\002\023\002\024\002\024\002\002\n\002\025\002\n,\207\245\203\341\004./\216\261\346\202\nr\n\026\002\022\t\025\023\027\002\030\t\031\025\002\002\032\033\034\00201\352\301\345\224\t2\234\247\312W3\341\313\326\317\0164\245\210\357\367\n5\355\355\377\300\n\022\035\002\035\002\016\002\016689\242\364\327\300\006.\022\002\002\002\036\002\037 \002\036:\262\231\260\274\002\n;\265\244\343\267\f\002<\343\376\252\366\003\002=\370\262\277\340\b>\262\273\233\244\013\n\002!?\327\327\240]\b\"\002#@\360\237\325\371\006"
+	.string	"A\322\277\262\337\n\002B\263\222\374\340\013\004\002\005C\377\331\231\340\001\020\002$\f\002\f\002%\002%D\242\365\310\247\017\f\004\002\004\004\002\004EFG\263\254\244\241\0032\r\002\006\002&\004\002'\r(\002(\005\016\002\016HIJKLMNOPQ\243\334\230\230R\211\376\363\336\017\nT\257\335\357\337\016UV\303\366\213\251\f2)\005\t\t\002\tWXYZ[\367\334\321\267\n\\\332\260\306\224\006]^_`\240\342\234\212\n"
+	.ascii	"\200\353\250\261\315\300D\204$I\322\034\240\002\242)\0327\022"
+	.ascii	"\340\262*\022\211\224\221LfAa+\323~\007\027\002/$\207$\024'\345"
+	.ascii	"\337xd\211\203,eqn\240G\234\273u9X\275:\205\fl8\375\326q\347"
+	.ascii	"7\226\001K\247\357\3330\370\230X"
+	.string	"\034\2175\337.\305f\221\002\2608\201)\331\360\302\364\345\210\033\017q\366\335o\231\366\357=\324\244\300$v\233Q\242\370\354\017\306<\346F\033B\23129R\"\2275\237|\202\3738\366\003W\366LE5\250\265@\002\237\252\321\3252\230\2559;t\207(\243<\241C\376\356\372BC\r\215\371\3324+|\302\005\251bO\333\026\3753g\353v@\327\202\306\367\257\007\337\271\030\202\330x?_c\037\251\357S\266\304\365:DZ1\262FO\223\206\360\202\2064\321J5\036\277\272\254\340N),\263M\233\177\237\007~\233\330L\360\2050_P<\226w\212O=\254p\307\0132,\263u\307\t\344l\256\354\303\343\030\024\f \241\306\376v\360X\f\354\356-\302G(\013\316s\003\216\307\177\003h\327\331k\003\274\314\372\004\312\0036\266\315d\320dv\250/\260\305\257v\261e\353\320\246\022\026\r\321\007ND\036w"
+	.string	"\024\261\373[w\367\237\022\364\312\034\344;'V|M\033\323\334i\233[1Ja\026\217l\330\263\216\233\222\270b&\203?\217\033\272\271\266\342m\b\017\267\312\333\2301\276\352\306\346\034s\273\256\367K"
+	.ascii	"\300\325\267\022<\232ky\3744\346\004\236"
+	.text
+	.section	.gnu.lto_.ipa_sra.1e3ebfca832d24ac,"e",@progbits
+	.string	"(\265/\375`\237"
+	.string	"\255\005"
+	.string	"R\307\025\034`W\032\003\360\320\270\222$Y\354\205\371?\224\250\253\\\310O\347\264\231}\345\226)\005\352\233]\263\031\314\305\242\006<\235\350V\025\307\314\240[\237\0053\330\252\262Ky\362\022\200\277\027=\344\362\310\007\261\323\217\035\332`,\024\211E\350\356\201\260\003M+y\322\024\370') P\202\201\222\314\001&I\200\031 F+\314\r\260\253\264\330\202X\240`+\213\350\213\300\215"
+	.ascii	"\272\304\275yC\276x\372\032#\001\314.^\256\340kp/\316\2030\017"
+	.ascii	"\023\205\003G\223\347 \023\240\366\344J\200\352\216`D\220\307"
+	.ascii	"E\031\322\006\032|\257=8d<W?\223\302\r\001"
+	.text
+	.section	.gnu.lto_.inline.1e3ebfca832d24ac,"e",@progbits
+	.string	"(\265/\375`q\007\315\036"
+	.string	"\326\353\227H\260XQ\032\003\fE\335D\302sU\336\330\221\033\013>4\242T\257\031(\n\031(\321\356\026(3\"\305\266\206\273\345\017\226\231\332\275\265W\036\263\367e\367\036\n\300\245q)>?$=\330\002G\371lG\022\310![\356\024\200"
+	.string	"\177"
+	.string	"\211"
+	.ascii	"7\313\003.."
+	.string	"\362\254\214 %\214\235\234\034\2616\234\364~\373j\230\213\021\027>\215&\t\36124\261\204J&k}\236\220|\006\2374*\246\244\262{\315\344_\202NMM\221\t\277\266SC\236\224&\226\375Y\243AC\236\224\206z\202\203\263\005#d\204)\\\\F\321X\3412\003|\337\330\326Zo\341\3336JG\016\242\004\340\317\3329\377\271\342G\310Z\024s\2376\312\303\227\344\247\363:\213\262\265\326\001;\216Zk\316\254\237*:\237\257\027\360\254[\301*V\262\306\366\250\326\252\263j\025m\233\214\226\340R\300\350\352\025\317f\251\301\353\355/\261\222\240RPMQ\341\257U\375\005\373\001\177\375\222Q#\270\243\335*yU\227\325\002,\302WQk-\177\334\331$\211\311\022\336l\265\026$\020\360\343\\\321#l\255\3177\317\332\362\244z_\226\350\003\177\305Qk\311a\237\322(\222ZK\005\357\004cl\3060\347\343"
+	.string	"\240\276\240\" \022\310\207\024\024\201/|\211\035\234\264\335a\246\2507~\317\032\3550S$g\347\263g\325\324z\303\331\302\234\321]\2557\362\n-p\316"
+	.ascii	"\361\035"
+	.string	"\251\246P\206\037\243\264\215b\372\021\031\237 \201>\347t\345\002\37496?[\204\337C\2018\t\271\341\301\266b\272L1Z\351\b\324\300\020\026g;\203\351\207$\376\300\225\233T\312R\251f2\355c\256D\341\315\0277p\345v\345\366\331&\005\217s_[\0044\224foe\222zPN00\261HPSd\\e\021\344\223C\224>\035RSk\027*\217\360v\006\341\333\302#\214\312\n\017\211\217\361\017\247\251J=f\265\255.\006n\351\336\035\302\237\f\240\"E\016\016\216\201\257V/I\276\252e\342\242\370\202\203/lR\335P\226\03264\234~\202vT\223.\330\271\340\264Fm,9\375 x\303j!\372\025\021\272Y\003\270\224\322vWk\035\317P\027\214\242\223\022\200\260\250A=cD\206dFR\322Js`\002!Cd\325\001\022`\024E\207\302L13#U\nR\254\177\034\214\020k\345M"
+	.ascii	"\226\212\250-,\205\250\307\027\245\007\213\234\277\204\r\325"
+	.ascii	"\274S\037\344\345\177D7t\225R\\\007u\370\325T\237P\034T\201p"
+	.ascii	"\302\006!x\233\333\267\034!\354e\020\353=\236b=\002\302\272\313"
+	.ascii	"o\254\370A\376\336U{wyZX\233}a\372\254\210\214\006\271\323P0"
+	.ascii	"\rR\2219\024\f\205\320\233\005\231\234\325p\f\203A\243mnl\033"
+	.ascii	"\300\202\304}_p\231\215\305\332F\234{I!\321~\376\331\323\212"
+	.ascii	"\024\242\3040\225-\252<`B\013\025f\363J\016?\320\bm\271\370\254"
+	.ascii	"\357\215\024\246<!\240\367\204\022\3279\372\202\035\336\262\313"
+	.ascii	"\232\002&1o?\257d\214\301\240\243\360\303d\371\272\217\221\001"
+	.ascii	"\327}\034E\323\303\020\020\274\267`\277x\006\3307\370p\200\314"
+	.ascii	"\200\017H3\355\324R\232\375\254'\f*h\203I\225\363\366%\ru\364"
+	.ascii	"\227\317$\206)\031\204\350\037\255\275\371#E\203\034\001\007"
+	.ascii	"\013\222!\332\264\226!\007\224\211\035\301\351!\013\322\017\241"
+	.ascii	"\345\250\034\020\343\016\245'\272l\202\013\272F\273!;%\232\301"
+	.ascii	"\206bc\364\023\365n\342\270-\036B0\2208\373\242*w\336\033\034"
+	.ascii	"2\350\027C\200\236D:\360\270\001@\255\323=\251\"\223\250\355"
+	.ascii	"m\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.1e3ebfca832d24ac,"e",@progbits
+	.string	"(\265/\375`\342\004\275\016"
+	.string	"\346\222;7 \005'\351"
+	.string	"\f"
+	.string	"\314\210\007j\b\316''`\323\204\330\330\207\310\030\301\330\247i"
+	.string	"\t\200\361\f\261\241\254\207\341\327\344\375\377\340\360\232\233-\330G\315a\304\266&e\n)"
+	.string	")"
+	.string	"/"
+	.string	"\375z\254c#\312\2201|b\354\221\007\323\312Ez\255\346\265\342\f\265\256\021\302\033\214\365,\222\340\211\365\356u\310^0\007@lgX\226V\213\242F\212Zi\225\330\017)\257\245\365\226\347\322\372q`\024Q\274\227V\210w\370M\263\177\351;Y\226e\027d\323\3703\0260fv\321\225\226J\221\230j\335\025\220\320\226\264"
+	.ascii	"a=P\217\031I^\025\037\211QLH\374\021{<<@kC\255\366\244\t\377"
+	.ascii	"\2257lI \377\371|x\374\035?\007it%\247\372\301\2046#'\2549\325"
+	.ascii	"\247?\224K9\225O\344X\002\277q\205z\n\275P?\310\002c\250\221"
+	.ascii	"A2\021#))\024\226\003P\002!\305\254l\003\022@\204\021\204\321"
+	.ascii	"\030\205\204\004r\"\n\252\202\024\025\324\251\264\006<\364\344"
+	.ascii	"\337\021\205\364\262U\033B\210\376\337t\224'\273\271\007\001"
+	.ascii	"\335{\253\024$\002\361\002\006a\314\311Y\0231\336\207 \324\270"
+	.ascii	"j\303$Id\215\025\277os\252;\262\211J\346\027b[X\243\201\353\264"
+	.ascii	"l\310\303\b\320\031\034\"\271\376\b\002S[\240\360N\234\255\177"
+	.ascii	"g\033X\306\376\354\277D\250\237\305\216\335k\207\f\324\r\354"
+	.ascii	"\232\204[\376\276\357@@\"\320p]\002\232\373\031\021\006\266\023"
+	.ascii	"\274\317*\330,\204\367\242\322\212O\n\275\322\217\022\220\216"
+	.ascii	"\203\261\235\377h\334\205\t\025\273O\317@\315\340\246b\363J\345"
+	.ascii	"i$j\323A;\336\004\343?\241\030\244\340\020\333\230\375\323\301"
+	.ascii	"2&\352\236\024\3039\001"
+	.text
+	.section	.gnu.lto_.pureconst.1e3ebfca832d24ac,"e",@progbits
+	.string	"(\265/\375 SE\002"
+	.string	"2\005\021\033\240\3270\006\376\327\310TU5\330\307\317\373\275=\331\3562U9\235;\004'\3352*\020~p\203\027|\340\002/\340"
+	.string	"\277\3342Qy\224O.y\344\220\213\307\035o\234\361\305S<\361\016\317\360\f13B"
+	.text
+	.section	.gnu.lto_.ipa_modref.1e3ebfca832d24ac,"e",@progbits
+	.string	"(\265/\375`\347"
+	.string	"\215\007"
+	.string	"R\312 (\220\247\031\016\360\335\325\252\256\"w\367\202\316L\331\205va\364\324DDD\210\213`a\300\024\341\365\265\266\311\357\336D\312\024\02708\020\0347(\312\025\235Uy\325N\335\203\2133-\235s\316\271\365R\276\264\013\266h\25556I\013\345\321\320S\345S\377y\003A\236I\302 \332r\232\237\n?\023\020\006\336{\357\201R\031\035\320`\250\363iwj0\257\224+\235M+P\376"
+	.string	"\023K\242\007\314\236\021\0011 `\002Bf\346\001m\202\204\347\n4\326\372E\310\b\344\334.n\217X\232{A\013\255\020o\2647l`\370Dv\244bG\303\303{\201\033\336\032\025\030\021\001\023\312\273\004G\246c\253\366\002HE\230\332$czqK\007\352\0300\216c\223@\242\337\303\276Lf7\246h[zk2k\232\307\314b\036\225\305\332\004E\374"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_.lto.1e3ebfca832d24ac,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_gpsPacketLogChar.34.1e3ebfca832d24ac,"e",@progbits
+	.string	"(\265/\375 <\341\001"
+	.string	"\016"
+	.string	""
+	.string	""
+	.string	"\""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001\202\200\200\374\342\203\307\221\t\177}"
+	.string	""
+	.string	"\013/root/repo"
+	.string	"\024./src/main/io/gps.c"
+	.text
+	.section	.gnu.lto_GPS_angle.38.1e3ebfca832d24ac,"e",@progbits
+	.string	"(\265/\375 \037\371"
+	.string	""
+	.string	"\022"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\031\001"
+	.string	"?\202\210\200\020\1773\273\0014\273\001"
+	.text
+	.section	.gnu.lto_actual_speed.40.1e3ebfca832d24ac,"e",@progbits
+	.string	"(\265/\375 \037\371"
+	.string	""
+	.string	"\022"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\031\001"
+	.string	"?\202\210\200\020\1773\273\0014\273\001"
+	.text
+	.section	.gnu.lto_gpsInitData.60.1e3ebfca832d24ac,"e",@progbits
+	.string	"(\265/\375`\265\001\375\f"
+	.string	"$\024\201\001"
+	.string	""
+	.string	"(\001"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\204\305\304R}\273\001%\206\b{\by\275\006\035\001\001\004\005\001?\202\210\200 wu\300\001s\277\001q\276\001o\274\025'G\206\bm\330\377\001k\303'\\\206\bi\bg\305\006\035\001\002\003\310\001s\307\001q\306\001o\304\003\005\001'\177\230\377\001k\313\224\001\315\307\001s\310\001q\316\001o\314\002\005\001'\267\001\330\376\001k\321\314\323\277\001s\300\001q\324\001o\322\001\005\001'\357\001\206\be\230\376\001c\326'\205\002\206\ba_\330\005"
+	.string	"\333\001s\332\001q\331\001o\327(]3\334\0014\325\001\320\001\317\001\312\001\311\001\302\001\301\001"
+	.string	"\001"
+	.string	"\013/root/repo"
+	.string	"\024./src/main/io/gps.c"
+	.string	"!$PUBX,41,1,00031,9600,0*16\r\n"
+	.string	"\024$PMTK251,19200*22\r\n"
+	.string	"\",0*2338476576CD\r\n"
+	.string	"\025115200*1F\r\n"
+	.string	"#,0*1E\r\n"
+	.ascii	"/  \243)\362\005\002\300\252\376\322\021/\270W0\356\"\\`/\005"
+	.ascii	"c\343\224\374\025\250\361\037\301\315\324\326\3124\201\016S\363"
+	.ascii	"\005\270K\367ua,w\373\352\303.\031hL\220u%\2147\035\352a\214"
+	.ascii	"\254n|\304d\007jj\017\253'\2513\246\313n\334\331\254q'\364j\002"
+	.ascii	"4\002"
+	.text
+	.section	.gnu.lto_ubloxInit.61.1e3ebfca832d24ac,"e",@progbits
+	.string	"(\265/\375 \306M\004"
+	.string	"2G\032&\200K\322\001@\\d"
+	.string	"\243\016\326C\006DQ<\322O\374j\232\036\227\004\252W,\034b\350\332@5\265I#D\246\022\314\275W'\224\356E\020\225*\214\246xHMGT\326"
+	.string	"t\265\320\371\031l^\021|\201\346\02283C\274efM\367&\207\277\372_\334\304\220\341\360\366T\200A1>M\351^-S\326\242\276\374O\r"
+	.ascii	" \023\220\t\310\004d\r\006\001\231\200L@& \023.\271\242\030\233"
+	.ascii	"\323\256\001\024\001"
+	.text
+	.section	.gnu.lto_ubloxSbas.63.1e3ebfca832d24ac,"e",@progbits
+	.string	"(\265/\375 \334\345\004"
+	.string	"R\210\037+P\345$\035(\202\2537\253\004\022H \001\003\352\2145\263\273P\363\034\344\314\314\264\031\0351J4`\205\354\325v\032\220M\032I2\001\212\266}\017L+\200\274\214\241\016\300\275\201F[\353\023\330\264g\257{\376,z\264\351\323*\306\255E$\261\212\263z\200\347\250x\352\002<\033)^j\030</P<t\r\340\351&\274sN\274#\231`\331\305\3428\335\224wVZ\203g\021m5\001\f"
+	.ascii	"/\202\240\334.\344\003\345\202\254\301 P.\310\032\f\002\345r"
+	.ascii	"\250\374\006P\004"
+	.text
+	.section	.gnu.lto_gpsConfig_Registry.68.1e3ebfca832d24ac,"e",@progbits
+	.string	"(\265/\375 \216%\004"
+	.string	"d\007`"
+	.string	""
+	.string	""
+	.string	"\""
+	.string	"\005\001\212\001\206\200\200\374\342\303\335\263\037\006\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\314\006us\350\345\005uq"
+	.string	"\005\001\006'\001\020\036?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\024./src/main/io/gps.c"
+	.string	"\004"
+	.ascii	")\"\301$\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_gpsConfig.70.1e3ebfca832d24ac,"e",@progbits
+	.string	"(\265/\375 7\271\001"
+	.string	"*"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\177\001"
+	.string	"\005\001\006}\001\001\005\001\006{\001"
+	.string	"\005\001\006y\001"
+	.string	"?\202\210\200 wu\276\001s\275\001q\274\001o\273\001"
+	.text
+	.section	.gnu.lto_gpsInit.73.1e3ebfca832d24ac,"e",@progbits
+	.string	"(\265/\375`\340\007\025+"
+	.string	"\372K\214\020C`\246J:s\036\227\356+\323#\005\255uL\350\240\265\213G\221\243\223\255!\262\020\203>\350C:\347\317\246t\3038\312\362B\316N\343\245\343LcK\017\234\250\233iN\340\202\240h[k\244\355M\266L2\362"
+	.string	"\346"
+	.string	"\373"
+	.string	"f]J\356\345m\314A\316q6\256N\316\272\316\356\275\301W\346\034\314\301\327>\227#9\310W{\227\363k:~\247\214\277!bI\036\230\257\254f\362\317\216v>\215\207\371d4\337\200\230\365\271W\r\302+#\231\257\n>\300\276\226\017`_\371d\336s\265'\367_\bQy\311\273\367\016i\030\333>?\024\004\376L\237%\252\302\222\366\311\177\372\220\217C\333\217\270\004\305\264\001\226\025\260\374\030\3639\343V\031\004#\250\354\310/\250bL\322\277\005^XZ7\347\214Z\245\202*F$\355\023^QI\2655\217\234\350\310\227Z\336\350\212WY\257"
+	.ascii	"\250\034\271\260\324\200f&\3669cWI\327\276\260\t^\371\350\222"
+	.ascii	"\002\230\2723=/,%\247e\0068R\334|\316\310U\332\2573aG\276\253"
+	.ascii	"\256\242\272}\034\356\275\334\305+\254s\321\231o\231\331\002"
+	.ascii	"\263O+\257\363@\367E\310\f\357\210\336\215?\334NR\235\006T\274"
+	.ascii	"C\320|\267\020\"\372\305#\212\300\352\217\\\324\335x\304\347"
+	.ascii	"\310\371\220\203\022\330\2731\211\307\021\341\334\355\345\232"
+	.ascii	"\264d\361\256@\0178\277\261\020~\266\273A\001\365\"\237\315\333"
+	.ascii	"\2308\201\002\205M\241\242_\344\206\313\222\233\242O\3743g^\361"
+	.ascii	"4h\352\260\345%Yf\0267\223T\246\262\261\231\235h\231]\\\fQ\370"
+	.ascii	"\344\336{\201\377\3660J\374(\257\274$\243"
+	.string	"_\224a_\217\274\203\262d\036\036T'\231\325\242\232\036\231\257!\316K\016S0\346\262\031\251l>\372\332\331\350i\347\242_\263\320l&*\233\207ls\2606\003m\363\2576\233\276f_m\266\265\271\332\346\2626\323\332\334e\363'|\353\346\371\331 \350^\253\344\240+W\341\246<\355_{3\337\215Ak\314\237Z\326G[ \355\262\372\307\251e\366TS\235[\314u.\351%\366\325G+[\234\336\230\217\036i\2454\020\362\216T\3575i)\242\351\007\304\371e\336{-=\031\2734\250N\036\033\352\f\033>\271W\352\0023\343\350\247S\254@\335\275R\030\222}\317\261\362$;\247\330s\212}\255t(\226FiIOU\210\020\321\034D}xi\262\244\225\367\336k/\314\275\201BD\301\306|\217H@\357gE\315\0012\\\177*=\362O\301p\201\251\021R\260\362D\333\024\301q\f\031\247i \242"
+	.string	"@\305\273\237h)m\272\343\255\314TWT')\035<kn\245\203\376}R\331ye\b.K\335\373r\205\322#\353\260F\324"
+	.string	"\030\037\244\235T\3571\203\356\237Y,\363\271\345D\353\027\215h\004\270+rR\224\371\344r=y\350\030\016!\202\036\371s\301Q\221\213\242O\314\367\320!JK0h4y\270\341\324T\302F\r%\"\342\213&\246\222]L\260QCi\330\2644\244\261\224\3044t\341dc8A"
+	.string	"7\325 :\ro459\r\203jP\347"
+	.ascii	"E\243\344\206\350\321\256CKi2$\3726\376\320c\r\245\r\251\215"
+	.ascii	"GtX;y\033\223\350/\242\260\275\332\336\240L\020\222\356\355."
+	.ascii	"\302\236\263=\301\273\023\265\230\350\365\371\341u\241\001\351"
+	.ascii	"\221sd\2211\177\036\026\b\304\214\252\214\217\236\207-\242UL"
+	.ascii	"VH\277V\245\311\037:vB\312\275\325J\230\370Q\270\007\241\036"
+	.ascii	"\311~\261G\322\276^O\361nC\363\317([D\207\350\360\374\323\207"
+	.ascii	"=\237\023Q\235@\372E!-o\022\372T\325GN!Eu\022\352\210\350\216"
+	.ascii	".\262\030]\344\2642\271\261\232\310yE\3444b\304\276\016\321\307"
+	.ascii	"\331\301\001i\320x\206=9\243\255N\261\323\r\001\322'M\372\353"
+	.ascii	" ]eR*\307\t\223.\264\037=\032Q!\013\200\222\250Q\034\007\031"
+	.ascii	"S\312\324\210\210\204\221$I\007\220\002\021\251"
+	.string	"\252\362\021p!T\f\331\004qag\ra\300\364\373C\222\202\316\253\221,\303\027\241m\220\367\262\332H\266\363T\023f\201\007K\224b\332\311\274'N\031\345\024)\203\356(\235b\341\275i\366\264\321I1E\034\221\032\202\365\345\325'\201nT\207\331p\244A;\020\237=\006\343\247\2133\362\234\305o\024 \245\316\034\237,\272\3272\315\030`<enn\313\230\tI\355\264\031\265\2201\tgSI\253\333j\237\352H{\032&\221\001\200\310\345?!\031\007\210\360\340$\367\310\326\360UJ/L\357\312\0344\215\376\356\240\333C\274\365\361\2223.o1\241X6\307\2401N\200\007\212Ca\232^\005Yd\237\030\241\311NS\263\215m\302\026\317\215\257\243\203/\036-?\330@2\353\370\300\37145S\254~;\251\314\222l\037\232R\231\206\236\334\003\026jj\254\257;Ug5\230`=\265\027\262\007u\240\362\024"
+	.ascii	"\366\007D\003\216\\\375\3037D!\365\202\231<\213\033\037\270\351"
+	.ascii	"\b\002\227\235\230#\356\352\244`r\374\376&Y\250\001"
+	.text
+	.section	.gnu.lto_gpsInitNmea.74.1e3ebfca832d24ac,"e",@progbits
+	.string	"(\265/\375`\246"
+	.string	"\245\n"
+	.string	"6\224I=@M\224\016\253\241\312\0178!u\312\t\207\254dC\022!\232D\206\330\342\022\325w\226"
+	.string	"\030X#\204\360\357-m\307Y\177\320O'\314ua\246W\357\223\223]\236nM\376O\366\2262\2457"
+	.string	"4"
+	.string	";"
+	.string	"\347J{\021$@ :v7*\351\236?M\217\377\323\001d\232\3657\271\276\002%\017\016\211\206\275\230a!4@\373dB\026\354\2563\3232\334\360\266\025\3306`?A\317\016}\016ux=@\332D\026\027Wv6\207\245j\260\377vw\255#;\3230\323\357\351Cn\332:8\030\230\330\ru*V\003\216\350`\373\022{l\024\001K\021\200\201\241a\345\307\257\020\031\027\364\035\n\352Oo\360\241\304'=L\240\353\272\356\035\352)TJ\204e\347\353S'h\205%\334\303&\262\273\b|\213_P\3609\034\272\002'\003\266T6\031\b\261\272\304\b\027\007\230h\321lbe\342*\363@\023'T\225&J\270\353:24m)6.\305\276Y\033Nl,\267\224\347\307\013\2206\246\312gV\265\"\245\305\260\033\020"
+	.ascii	"3\003\266:\204\215\2003X\376)\263\254\326\366AM\254  G\254lL"
+	.ascii	"h\231\352nq\031\373e\bq\351b\266\363\026f\031"
+	.text
+	.section	.gnu.lto_gpsInitUblox.75.1e3ebfca832d24ac,"e",@progbits
+	.string	"(\265/\375`k"
+	.string	"]\t"
+	.string	"\326\321@:0\345(\035`\373N?'3h3\024\331%T\322\372\360\250V\313I\244\234iD@\327~\362\363@\255\231\310\177\n\321\36200\344\302"
+	.string	"}{c`\301"
+	.string	"\263\332F\210\224)\0050"
+	.string	"0"
+	.string	"/"
+	.string	"\273\0135\344\250g\232(\277\343q\317\004X\327L\201\343\205\345\361T\031\001\354c\346\256'\206\267\312\344\200v\327\331y\032\267v\333\013\266\017l\307\002\b\255\030\223\215TF\373S\245\266\354k\2141ZA\354L\347\323\347\024\254\300\030\342nF\214-\214\326Rb\373\036\243l\232\177\"{\225\327EJ\200V\345\222\005"
+	.string	"\254C\265e\273b\223\352\200\"\263J\001\346\344\3256M\344\273T\203\225r\366O\376\262\360ILq\312w\327\374\323\346\332\365\256\007\016}L$\b\270\211`\204\250a\004C%\023\374\fx#=\224\240\304\266\225\240\347K\035\224R\325=\270\021\227\232\3756\3419\340\331\356n\326I{\264\345\273\016"
+	.ascii	"2\003N\035\206YX'\002\202iX\001+\200\266\217\205x\241\207p\350"
+	.ascii	"2\364\313\020\342\322\2654M\003SP"
+	.text
+	.section	.gnu.lto_gpsInitHardware.76.1e3ebfca832d24ac,"e",@progbits
+	.string	"(\265/\375`\n\001\375\013"
+	.string	"FUMA0\211*\035T\006\370\227X>\271l{\365\271\340\245{\3221\274\022\276\262\365vL\254\250\030\207\022a1\222 R\241\006\231a\224\021\252A\270\215\202B2`\300\302\021\275\251(l\275?\"\233\354\235R:"
+	.string	"9"
+	.string	";"
+	.string	"\251}\003\n\037-\331\356v\024\300E\257\033\235\"\177\312 \210\343\367\372\325\267\0022\2278\222\276]NC\220\273\250^\001*c\007\235\223\314\356z\212\343\310\315\335\366\204m\b\373a\006\316\332\360\005\274\232#4/\276\372!\356\365t\342Qa\306\032\315\322&\301IQ\366iY\2263\323\223\375\351s\016$\022:\023vCJ\332\302\252\203\001\266o\261\310\216\235\f\337\254]\365R=\240\024u\006\276\3131\312=\305\005\241\021X\223\002\177\201c\234\205\222\335\357%\037\203{\235\242}\004~\211\222Z\221%7\302b\n\347\005\333\240\037\320\240\354\206\022~\326`@\236\213\316\333t\235M\005\247\323|@\035\246\301\236\307\342\323ex\336\247\263\220\243oKO\024$\330\210\202>\371ou\303\020\241\006k\375a\253L\233\343\315\213\376\352\031\220~~\202;\023\035"
+	.ascii	"3\2411)p\215\327-L\366zV@]p\204\251v\300]\233\336\370Y\213k#"
+	.ascii	"\021\\\"\252~8\225\231P\2138\013BMW\314b\204Y\216OY\b\227Q^\206"
+	.ascii	"\030\227\016f\3434%\025u\007\344\333e\345\t"
+	.text
+	.section	.gnu.lto_gpsUpdate.78.1e3ebfca832d24ac,"e",@progbits
+	.string	"(\265/\375`%\ne3"
+	.ascii	"\372W(\023Ep\336Q\007u\265\370\314y\204fq\211!\271\026\241y'"
+	.ascii	"\213\254\360j\n\306\212\267G\027Y\004u\323\024'\211\033\212\354"
+	.ascii	"\231\201\242\270\236\fD\322q\017P.#\311\303\231g~\321\254\375"
+	.ascii	"\304?\266n+\367N)\245#\001\005\001#\001^\324\244tSE39\305j\263"
+	.ascii	"\243\202\271\241t\331\212f\362c\271\201\335{"
+	.string	"y\2352\257`\346u\212\362\230\271\235\271\237\264\330\332c,Xw\357V\330\225{\231L\214@\355\224\250\201\266S\264}\266S^\231\3414\223\353\266\225\244\261i\347\336\033\374 \374c\373k\373\202\200~z>=\274\235N\315\375,:\364@_\271\001\274\025\317\230]\021\333\327\325A]B\034\b\025\240\024S\303\250\214\017\265.\343\362\237\256\035\336kv_\371\240IkX\352\264\031\244\022\005Z\0259&\275'\347\344\354\003d_\236<y9\247\0319zg\006\231\003%J\202\304\341\272\234\023YG0\"&gk\206\262U\035Y\275\205\324\262@E[H%\232C\277\314\351\205\201\030\230\220&k\207qU\364\237{\265\335!\271\321h\325\f\257\036B\r\374\330\361\344]Q\241Da\320\214m\326Ef\220E\374\325\033\rD}ZT\324\364\256\214\350\222\232/\034M\326EI\220D\334sN\367^\366\343\325\214f"
+	.ascii	"\315\334Z\314\234\200YG!\313\241\265\377\024\300\323g\256`\301"
+	.ascii	"\373h\273\244\337dmd\334\362\314\352F\357\275\367\347.\266T\341"
+	.ascii	"b\031\350\334f\0314x\037\371\237\330jLd\022m\267\256$]C!,\222"
+	.ascii	"\220\243\317m\266\201\203\367\021\351\333\254;\306\216'\332?"
+	.ascii	"\372\375\306\230\347\307\375\231?"
+	.string	"@y\037\377\211\250\236x\305?g\344\362g\334\224M\371_r\367\200\032bL\200\214\302\366{\210\322\206\312\35707\225\256\202\202\333\213ADy\037\243l\247\375\217\265%,k\312\343\230\231E\377%s\037%y\314\341\377\301\254:'\260\316\301\234s\223\352\314\244:/\251\316J\252s\322\316\031\251\307\272\217v\316@\325\371\247:\373Tg!\353\034d\235\201T\347\037\353\334\263\316>\326\271G\347\314S\235w\252\263\316:\347Tg\233:\2479g\324:\177\352\354\251s;0\260VF\205\333\275Vqo\027-\315b\204{J\233\245h&\347\270d\245`v~_nQ\322\314\202\036\006\\\013-\320\007}\033\263\212nt\027\3025\307\232L\332N\201>\207\245\026\2265\325B\313\274\356p*!p\215Oyq\355\341c].\231\244\331i\373\t\3427\016\255rdS\352Z\211x\037\177\336\350,\311\353\375\233p"
+	.ascii	"\236\264\366\371\336\267\362-\255*KQh{\336\347Q:F\332\216\320"
+	.ascii	"\255\347s\3064\317\264\270E\306\256\327/\313\373\336B\322m\353"
+	.ascii	"\227z/\225\002n\266\236\263.Y\231\254ak\230\355\224\3679'\232"
+	.ascii	"\347\330\356\327\206C\\q\372\3106\264\272\337\375\277\251R\026"
+	.ascii	"=\316I\253\r\335\350>u\242\t\033S\323=d\342tE\316\274\222A\350"
+	.ascii	"\221y\242\025\237\310}\326\005\330\320\210\016\2673r%\325_\246"
+	.ascii	"q\257I\311\320p\247A\331\217\327J\314\021\264.\323f\030\216z"
+	.ascii	"/\261\225\375M\300v\352\277[e$l\355\362\270HM\206[\251r]\344"
+	.ascii	"e^$\036\217\026\236\207\231\237Z\214P\275\367*\340\006\323a\""
+	.ascii	"p{u\312\022&L\260\235\346>uvy\216\265\345>&0@\211\210\272pb\004"
+	.ascii	"\224\224\024\212\017>\374\241\311D\t\020A\022Q"
+	.string	"\301\021Q\035D\004?H\231\b6\375\230D\t(\251\340\t\022$\244\202<\346T\377\21739hS_\364\375\362\301\322\034\331t4\326\232\205=\372\004\337YOg\225\262\230\272A\201\013B[h\203\377I\272L\211P\375\n\376\003!c\2748\305'\320/Y\251\233\336C\2243\246o\372\256b\314\263\364G\317\364]u\344\210#\031\022\327b\321v\272\364]\326HX\316\347O\306\225&?\277\324\322\300\006\356<\232y5\256/\274\217\300\207\202\273\362\\\243\032\343Dt\270\236ku7\211x)}7\207\bi*5\201,\273\311O\356c\253\271\300\211z\030c\265\372\235aA\243z\"\327\232\032>\277d\237\224^\257\354\217\214\357\205\376\367\317\245\352Hr\250\352\360\275\021\2331\241\377\235\211\235\351&k5\r\036\346s\215\350p=\277\264aix\326j\003\313\007\034X[\322c\271\215a\317k8\235v&\375"
+	.ascii	"\2539_V-\277\032\"sQ\336\300\332\312t;\371\311e\b{\036\303\331"
+	.ascii	"F\001\200\315\250a$\005\231C\n\211\314\210h\222\244\320\030\240"
+	.ascii	"\002\021\251\242\252\003\021 -S\220\321\214\246(\205\326\322"
+	.ascii	"\251\327\357\374E\211 \nj\310\252G\t\343Gm\223\021\271\031\333"
+	.ascii	"8\310"
+	.string	"\373\275Z\"\264^[\245.\376\257\2049\b\310)\367J\025C\\c\240\252J=\206\243[;[d\346\222\254\"\235=\022w\346\216B}\220\246N\360\232\\\242\b\304\017^s\377\302O\037&\225\272dd\021\033\325t\340\360\355\346\307\315\242nE\333j\211\236O\377\266\202\025b't\261\213\242\331b\275\241@M9\t\345\303\215hC!\232\275\340\203\234~\204\320f\257\2554\265|Vy-\022.\003\211r\276\021\355[\024Fl\026\360<\r3\327\303\205\001\246QM\355\025\332\221\243\217\024\326.\377\310\205%\217:\335\350\033N7\346\253\230\361\263\033\267\343W\336\023ZV\215\215\257_2\226\205\307+\f\355\007\313\211\270+g\246\316\262\034\035\327\342\305\302d\226y\n\314Nz\334A\230\266\217v\225\307\310\212\204\223\302\337\266T\032\315\177\220\022\200\320\031\003o\200\310\343\355\272\266\356\017\226\216y\026sf\247c"
+	.ascii	"O3\366\037\037\304\335\207\300y\\\276\346\213y\204P\232B\210"
+	.ascii	"\241\224\272\006x]\bf\306F}\034\313\325\202\266Z\310\020\370"
+	.ascii	"\304\361\377\2152\332\034\251N\371\234\356\022\232\254\235\200"
+	.ascii	"7\317\270\312\306\363\304fF|\330\251AK\365\373\034\201&\260\031"
+	.ascii	"\206\312p\1774W\273%v\b\232\240f\360\342\220\322P\204\032"
+	.text
+	.section	.gnu.lto_gpsNewFrame.80.1e3ebfca832d24ac,"e",@progbits
+	.string	"(\265/\375`\230\001-\017"
+	.string	"v\035eD"
+	.string	"\221(\035/\023_\201\236\245\360\017\234\326\241\271\016\324\004\244\203\315\177\304gI\263o\016c\377\333\fk66S\032\240kN\321aPk\031\252\252Z!\250u\r\003\357\230\002\250\r\275Z\"\251do)S\nT"
+	.string	"J"
+	.string	"S"
+	.string	"y\227\013\326\335U\313\314\256\247\300\006\262G\333^\300\300\304\243{\036P\036\256\017'18v\275M;|\364\b5G>\351QO0\272\224\352\360/\2073(4\034\215\025)\325\325\304a\004Z/\020Z\n\203&"
+	.ascii	"\220\335uv\251"
+	.string	"\r7v\333\017l\037\260S\013>\314=\220\277\362\350\n\242|\367\350\213\260\307k\r\224\327\315\210R~\266\307\245\252\330\327\357\373n\254)\266\323\035\247\265\273\374\231\323Q\323P\323\032\323\t\323\017\340\321\200\312\220zG\263\213\372rlMl\021\302\266\211\315\261\255\001j\213\214\344\273\216\0260)\311\251\252\3174U\343\272\033';J\371\371'\036\341E\r)u\274\365j\271PUy\n_\305[X\226\025\343\243\260M\266K\372\312\377`\217\254u\255\260\334\204m\233\177e\333&\273M\300a\231r\207m\t'A\222\355\232\032\004\236\333\363!*\031\331@\237\215\302'\204d\363\204D\333\207\207A%\"\241\315\002\b\024\3328^\351p5\305\023\\02,\322\037a\030\007\021P\323\277\334\201j\206v4\352\311V\316/q\203\300\335\3358 \241\332\020B\362\235\226)T\215;\305\270\314\021\310\260\001\005\244\006\037"
+	.ascii	"L\023:*$\236\336\n\034P\0017u5\270VC\201\274\217 \332\230i\304"
+	.ascii	"?~\204\246\340e\200fO\271(\312Y\234\242B#H-$\220\231\201\013"
+	.ascii	"\314\247Q\214&\320\3035\321c\342X\317\205\t\256\001\3638\250"
+	.ascii	"\232\002w;\267<\001"
+	.text
+	.section	.gnu.lto_grab_fields.81.1e3ebfca832d24ac,"e",@progbits
+	.string	"(\265/\375`\350\003\365\033"
+	.string	"\206\263\264I\260\326M:%\344\306\030&\004\301A\2713\200b\230\320\240\036\216!\246\3047\354\241K\016,Q\317\3563{\330\234\347k\361\370\370=\317yJ?\324\037\360>\340\331"
+	.string	"\332\316\277j\003\007L?<e\277I#\204\020\222d\222\001\245"
+	.string	"\230"
+	.string	"\235"
+	.ascii	"\263\251\t\202]U\333\360\r!\373>\030f\316\247\036Zs\372\030\250"
+	.ascii	"\001\322\241\372HK\271\206\220\342(\200 \342\035\210\342\241"
+	.ascii	"\323\221eN_\255\200\005\210\016A\313\210\016\017\245\345\342"
+	.ascii	",+c\344(\206\340\027\247\036\262\254+\351D\321\2269+xK\216\271"
+	.ascii	"+\311\304\3179d\216\n^\t\217]I%\300\002{\264\323\255\250\344"
+	.ascii	"\020\214\020D\ti\266\003\001n\013'T,#\351\304\202`\202\246\""
+	.ascii	"$f\273\034(@\211\023\024\331\316h\357\237+DeQQ\301[\362\216\022"
+	.ascii	"\346\234\272\""
+	.string	"v<\253\213UuKU\035\250^H\376\021g\367\317\006pd\335\240rb\264_\217\222\"\306\327\337S\365\rm\002.\030;\364O\252876\316a\327\320\330g\317\350\252L\214\253\2540/\266\262\322\306\325\331\256\002\020W]\302UY\270Z\222\2531r\225\034W\307]\025\305\325pWAq\365\341\352\206\253&\340\242\305\305\316(\220\314\211\024\266e&\t\201\300p\225m\345U\025R\353\360OeV8p\356\230\020\205\025\243\201\253p\236\274\351\020Y\242|L\231\323\247\300\241.P\005W\365\001\004!\347\360\240\237\001//+_:5\375t`DU~P\242\214\357\251\1776RNjDHs\005\377r\332\217b\266\211\261\337\250\214h\331&\222\217\215'\177#:05\326\355\207\034\357\243\245\3603\027o\332\303\227ELa:\260\32281\3466\037\235\230\260\344d\334\013i\b\021\361\275\037Q\215\325\341g"
+	.string	"\013\027\352\017\242C\002M\254\3743\007\277Lr3\366\277i\356\357]s_\266\204\311K\007F\224\342\252h+\364 \326<\034\312\362\262q\342\313i>R1\375rME\033f(.\256+\340{\252\023<\366\351\tz\220\006\016=\340\316\r\350\272\243\003\344\223\241f\343\251m\340\261\320S\333\271\001\325t\002\250\315\007\303\255\026d\263\335j2\337\364\237t\313\230\317rSY`\314\225rS/HoYF\346\373\242+\031\030\2039-G\343\310z\3131?\032\277b8?\217\325#\365\341\331\335E\365\304h\277.\314\\>s"
+	.string	"/w\3712\261\372\206\f\3169g\371\336\225i\3079m\t\n,\273\325\323\242\021{O\003XM\215\030o>\263\222\222\"\332\034ff\234H\373q\374\200\242:b\264_$-,,L\3138Q\366\033\233M\250A\034\203\210sH1\205Dd\204\244i\306`\002\021c9\017\020hi\242\016\\3\344\030H\215+\2404\311\240\305\323<\206!B\345\377\022\030\030RF*\004\346\272A"
+	.ascii	"D\364qYq\236\b&\225(v\222\346^[\204\037Rt\2727F\242Gv\327\004"
+	.ascii	"\003\260\330\312\312\341\t\344\340\002\346\363\t.i\226X\243\274"
+	.ascii	"\314#\216`3NP\345\252b\027\025\366\310vt\220\fR\222\305\023\246"
+	.ascii	"+,B\306\272\366\256DY\001\312\016\224v\016N\302\222\263\031\275"
+	.ascii	"\221\035\326\301\356\222U\344\276\230\240'\245\b\201\201\240"
+	.ascii	"\300\312\224\303\037"
+	.text
+	.section	.gnu.lto_gpsNewFrameNMEA.82.1e3ebfca832d24ac,"e",@progbits
+	.string	"(\265/\375`\177'U\223"
+	.string	"Z\342\3141G N\333\031\003_L3\026-X\356\377M\364\277\373\252[S\353\332\b\260w\276p\033L\346\227li\023`#\232\355`j\343\013\277\375\226\324\341{.Q\377a\263\344\351\")#\316T\204\335c\313\257\275\245\224)\245\024\007\003\315\002\031\003L\357\274\344\316\035\336Y)\351\314\341\235\223\336y\203;#\275\363Q\322\331\310u\316\340\316E\356\234tg\327\235\211\334\031\203;_p\347!w\026r\347 wF\272\363\321\235[wf]\347\365\235\337u\366>\363x\200\274\246O\036\317\333+\2451\320\033\310\266\t\323{\335x\335n\335o\335qM\344\030\374\202\017\271\220\0079\322;M\037\235\210\271\271\327\364\0367\037\017\251\341\200I\3531\017(\035\333\373\276CM\307\235\307Cx\312&\256\267W\n\021\232\235\240\016$\023n5<\324,w]\3331\351\273\255&\257\267w\354\252\355\260-\321"
+	.string	"d\263M}\3246\273\266\206\266\331f\346\200\033M\303\265\\\317\361P\032\345\372>\257\246P\324n\304\231]\275)\233\314\360U\271)\373\375z58\234b9|\3377\250fy\304{\267-\371\337\367\354\216\357}_)\016\201l6\205\025\007\314Lr\302\305\247j\352\001\330\\\342\373\276Q\375\0266\352\365\255\271\2053\233\325\360\035\333q\035\323\361\034\247a9\216c8~\233!#\306\025"
+	.ascii	"0^\270h\301\302\212\327\254P\221\002E\025\325\224T\024\324\211"
+	.ascii	"'\023%H\214\020\021\002\204S\323\007\017LK\035\2248$m@:2\322"
+	.ascii	"\220\241(\351\022a\2700$\024\204<\266\354\372\316\344n\342\265"
+	.ascii	"\340\034\343jV\303wDc^X\234\355\236\315uO\244hS\2123]G\251\273"
+	.ascii	"\302X%\212F\326<\307i\344\216XAv\252l|\242S\b\233\343\326*Q4"
+	.ascii	"(\315pK\321&\224\274'\316oN\243h\323\003\302\237\261\024m\206"
+	.ascii	"5\272\214\030\214}\265\030\310\001\200\001\250_\374Qt\027\353"
+	.ascii	";I\2046\035\261\304\365\352\017\230\235\346+\364\026G\254\021"
+	.ascii	"\246\0306\213\020\037\264Uw\0316\257Y\233\362\332\211\216\030"
+	.ascii	"\341j%\332,\363\025*\216XU:\205\236<\216\342\2105\206j\310\247"
+	.ascii	"*\017\325\236\230\350\024\301\236\002\224#\370R\177Qq\326\246"
+	.ascii	"5\261A\207\"\341D\232\230\350\0248\375\224\002\np\336D\013)%"
+	.ascii	"\250PH\354uTL\257=J\353\363\302NQ\261\301\037a\265(F\304\237"
+	.ascii	"\020 \216XNj\356\274\351\003\032\367\260N\343\210aZ\032l\363"
+	.ascii	"\016A~\246y|\242S\006[\to\215\235[\213<\323\"\315\264\3102-\022"
+	.ascii	"\311\341M^upMb\353\rla\034\211\215\004?b\003\343Fl_\\\003\233"
+	.ascii	"\027\317\220\326Ei]<\231\306\305\335\264\020\234(\355\3141\244"
+	.ascii	"\315\265\323\232\230\231_p\212N\201\366P\231\013\221y\020\026"
+	.ascii	"G\366\232\330\323\217\353\211\2638U\232\216\030t=\232\203\266"
+	.ascii	"gh\f\314[:blk\223\207\215}9\233D#\353\365\2105\327Yhiu\316\261"
+	.ascii	"*\375N\204\306\232\035\025\333\323&"
+	.string	"\337\3675\2126\243\254~\304z\337\227\33596\245\271\200fnWf\376\301\f\")\207\357\373>\271\032#\271\274b\357\333\373\304:\243\223@$\303\303 \003\254&\275\227\277\r'\364\262-\342\262\245\b\311M/\333\244\026\264\344\221\233E\004\327\210\350\314\214H\203\236\fN\026\247H\256\227-\206+V0$\363z\331^\2402\345\202\333\246\227\355\220K\2112D\364\247\205\034\212\207\ta`\237\205\353\253s\341\245\356A\007d~DV\314\206\340z\331\006=Q\2327\335\211{\255A\337\204\353\223\037 !\344_\3703\345\\\376\"\277\375\236\377\350\275A,\364\361?O\007j\306Eo\356k\233=~\317\271\013\352\r\"\371z\331\266\357e\244Z1\261}\252\301Fjasv\254\353e\313~\257E5\342\022\351\207}%?,m\272\274\261\017\221&d'$&\205\201\013l_\272~G\345\006\275\374\017\037\256\377"
+	.string	"\331\t\325\347\262e\346\f\232py$\370\276\257\013n=\275\247\007\367\227f\331\210\017\037m\263\036\270\370\361\377o0\306A\177\005\310\372\024\237p\272\355\362\270a_\312=\305\314\t\267\342A\242\264\367\246N\337I\262"
+	.ascii	"\331\036\033\267\262\345\236\323t\224\334_X\311\017og\263\334"
+	.ascii	"?\332f\025 \323K\364\323\345\215"
+	.string	"\334o\372\b[ \227/V\0016\337\236\001\271P\311\204\2508\334\177\\\250\324wb\332\005\005\356\024\270\020)b\nU{\337\367\311\217\013\227\322\274\301\320\313\326\004\356>.\\\232{\n\365\262m\266[\204\267\372D\255\r3\027\"\337\227\253\317\270\320\t\353\265S\265;|Ex\237\232U\276\211<\324@0gd~k\372K\231\273\343\002Ey\371\2650\273s\227I:w\265\367\232\233\215\235\233\332x\315\275e\204\325\271\245\253skY\235\033\255\335\232\333\253\343\232\273\331o\315\335\325m\335J\327\271\211\353\274\265:#Y\235\217t\232f#\235\246\231\002\327\271\210\353<\201\353L\344\235%p\235\265\\\347!\032\234\205\0249GP\344\fA\221\363\003\256\263\003\357\334\300;3\340:\007q\235\201$\235\027H:\377\320\340\254\200\353\354\303uN\300u\356\341\316<\\g\004\336y\307;\353p\235\017xg\003\336\271"
+	.ascii	"w\316\341:\023\340:\343p\235\007p\235\263\\g\001\222\3167\222"
+	.ascii	"\3166\\\347\032\357\034\300;\323H:c\271\3163\222\3162\3369\306"
+	.ascii	";_\271\3160\\\347\027\256\263\013\327\271\205\353\314\302u\266"
+	.ascii	"z\347\025\357\254\302uN\221tF\341:W%\235\251\336y\252\310Y*\351"
+	.ascii	"\034U\344\f\225\301\371D\006\347\247\f\316&\222"
+	.string	"\316%\212\234I$\235G\270\316\"\222\316!\\g\020\256\263\223\353\334\344:\177pg\017\357\034[!0\263di\233\265\301\202\342\263Z\345FI\325\006\215\t&P\231\237D?5:\370\363|J)\301=)\023\f\326\327\370c\037\030#\215\017\200\306\267\204PyxX\177\f4dcx\206j\306\235r\212\213\335\026&\030\031?\343\217Pts2\376(h\310\314L\257\217SJ\t\376\333\3031\2730\2750\3010\301\264\315\306\350\362\234\352\253\217\321\315\277\372\016hm\206`\214]fZ\211\225\346Z\0343\345\306\317F\225\363m\354N\352\227\031CUs\330^\357$\021*\365RN\266\262\355f\243\234\034\377\3230\276\275~\235\373:{\361\353\303\370\376R{j[\375\213\337\3204c\330\325\374G\\[\331\266x\027\337_k\315\306V\266,\276\305\367\224\3057[\231\234\352\363I[}w\375\232\367u\266\342\255"
+	.string	"\265\212_\361\354\342\027\343\006S\257\342\221\344\314"
+	.ascii	"~\235\265a\207lQ\376\245\327?r\375\325\221\373\373,\335\276\310"
+	.ascii	"P)\326\230a~\240\370\024\277.B\251\205A\361\254]!\034\251\337"
+	.ascii	"\211\252\377\242\365\203\352\253\236\355\203J\353B\365l`\241"
+	.ascii	"\033\264\256\300\355i\004/N&\204\217\256?\365ChU@0F\352\364M"
+	.ascii	"H\211y\021B\210z\251o\377\314\240Q\337\036\026\232E\351\267+"
+	.ascii	",+\001U\302caR\237'\036\352\331?0\306\243\340\323\237x\016\213"
+	.ascii	"_eL<\233\343\264&\376\351\223\020\277\326J\274\211\357\250*T"
+	.ascii	"J<\233Xx\345\241t\005Ux\005C\344#!\205_\fI\375\340?"
+	.ascii	"`WCu\256c\332\355\n\307|\004\211\351;\231\324'#\236\304\263\210"
+	.ascii	"`\3775BqM\013\"D<3\263\372M\345w\205x\021\317\336\001c\004\341"
+	.ascii	"P\335t\37762\3170\321x;C<{\250g\205@'v|B\200\b\324\213\255l\235"
+	.ascii	"\036\3047\330S\321\351\225X@\001D\323\267\340\323\376\360M\337"
+	.ascii	"`U\232\336\210H\343\307\207\3572d\210\212\3179n`N/\345\252^\266"
+	.ascii	"\036\344\364\341\343\001\261:\347\246\211\351\r\013\227\236\351"
+	.ascii	"\333\277=z\226\f\025?\370\365\262\355 \210\247\203a5\316\214"
+	.ascii	"\007\245g\256\341w\262H\330a\0279\274\022\2359\034\276\265\323"
+	.ascii	"CE3eJz9YQ\\\376\332\271\341\223\276\355\373\352\003'\013\231"
+	.ascii	"\302\206o5\262=U\267.o\3448\251sI\332H\357Q\177\263D\372!}\237"
+	.ascii	"\221\341Qls\246\337N\217Y\207\243g\276\341}Y$\270\274\357\313"
+	.ascii	"\202\335\215\233\200\343"
+	.string	"\202\0349\332fYDg\037\243?\342\340M\347l| \337\267\253\235|\254\003\001o\247\321\267oz\260\004z=\027\273\231FbE\t\217=/\b\320\035\273\232\3434\221\216\275\256\235\016\312\261\247a\247\177o\354pk\nn\354\325\251^\033;\031;\3235\353spFv1}\204\261/\\\t<\344\300\306^}\262);\031.Dz3Q=\3605\366\022\272\231\332f\271\264L\321\004I\266\230 \321\"B\201\026\322H\347\320A$\211\220%\023\034\223l\035\200\314@\002\034\030\020A\242%dG\023&CI\204,\021\262\003\003!=\2320\021\322j\326\232bbA\021*%F\250*0\"$\t\225\326\022&TSF\254\304\002\"K\2500P\242d\t\325PWW\2577(\370\265\353\264\221\017\243~S\3277\331\3107\365\217M\274\026\272\b(\262\3665\371\t\276\310\367\\\007\201YQ~\223gw3\301["
+	.string	"U\241\372\304Ad\220\r\221\347\001\2753\200\222\314\272\267\334 \270\352\215\350\002\035\362\022h\255xI\206\274\326\273rx~\234\365R&je;\344\357n\310["
+	.ascii	"\265\243\370d\323=\327Ev+\214\005\n\220\327\035B\035\025=\033"
+	.ascii	"\376\244\211\350\330\350Yu\235\246\340\303\326\272D( \333\215"
+	.ascii	"\227\332h\213\023\362A\240\177I\347a\\\215\b\026\32774\204b\326"
+	.ascii	"3m\021|\307\201\372)B\360\314\0354\256e\230\324\017\325\022V"
+	.ascii	"*\223J\006\002\277\252[\237%2\320\023\304\332\005\373\240\020"
+	.ascii	"\300\003\\\353\032\223*F\355\316t%\201I\005\363\200\t\0164W/"
+	.ascii	"\312\264?g\237\225\213r\213\003"
+	.string	"\337o\240&T\033p\262J\265\240\325X\263\210\320\200\"\003`\353YV\tAf>Y\315\230a#\004\233\345\265l\2052?\220\302\034\033\273\343\\\261\254O\006\276S\200\356\265\032\235C\032L\355\326\347\t\362[\317\276\202\020\344\373\f\252\247\370\354\302\263\241\327\240yk\224^2\306\347\314\001b\275\224\3271v2\325/\253\024\366\022\310\324>\017\020(@>\b\024O\361\271\300;\337\257\177\374\002\253\007[T\230Y~|?\241xN\253\223\016\332,\221\004\277p\003i\233-!\350\247k\355Z\233@@`^\271\362A\240u\2123b\264\364\033O\335\230\234\253\036\341\221|\330\226\367\361\275\266\276>~\003h]\365\211\344\217|o\371\317C\312\340ke\233\300\2674\201\207\272\323\306x\351]+\333\036\337#\374\322\"\217\357\361&\b\331\253\227\262\303h\264\367\027\255\345\217|\030\267\320<>\020 \036\337~\006W"
+	.string	"\020\370F\333\361\b\354\320\361;~iN\307w\270\3430^\312\326\007|k1\340\017\370\245E0F\034\005\274\0019\276\200O\"\354\027/\345\267^\2669\236\310\355Yx\304\034\337y-5fg\314\331\031\027/e\025\177Xt\365_M\016\2430\376\347Y\235\267\314Gy>K$\301\303\317s\366\331c\346"
+	.string	"\312\027.\221{\236\220\211\245\214ifV\346K\f\266q\033\033\033\033{\253m\266\357\3527_CQ\331#\207\207\016\017\237[\026\026\356|_\306\352\226Z<3\307\352\245\3349^\013\001y\004\tx\036\3209\305\247\233n\273>TV\340x\025\232\251\035\340q|\203Y\251\203d\200\267\240\254Q\261\t\2049^*\346\024\021+cL\336E\317\244\210\323\312g\271"
+	.string	"Wx\300\262\305\254\377\023\340\263\036\216"
+	.string	"\237@\331b\230n8\0247\036\205\336jm\374\r\376\276?!\203X\250\002I-NJ\250\324\310\210\210$I\ni\r\242\013\020\b\002Y\332:i\036\022"
+	.string	"T-\207\224\0161u#I\222L\007\253j\367'\355\260\350wDv?\213@\b..\fs\303U\225\224\222\375ZVJ\316F\343}"
+	.string	"\227,j\275\345\274\342\327\021\251\203\265\353\262\320>\307EUL\327H\314\253\347\235?\323{$!\225\271\321\342\373\273\317\377\021\264b\212-\216\344\264\205\364\322\342*\233\267\307Q\234\263\221\211\256I\302\374\313\023\316\267\222r\236b\216\r\233\273\351\027`\271=\202\354\b\004\277\021eo\373\226\345c\336\226&\220\272\271\t\312\214\366\277T1o\305[\001u\210\331\206\"\324o\332\344\317\257\340\335\016\215\273\363\032\304D\350\026\024\017,\353@e\273\007\236\b\260\222\323\n\246V\315Yt\031\344q\264{\267\005\322\303\251\232\203\252j8"
+	.ascii	"{zp\030\315\345\336=%\220pc\337\353\202%\217\353\207\227\224"
+	.ascii	"\326\305\"|',\276vp$>\177\306P\205\236N\240$"
+	.string	"US\220\364\213yg\230El\255\215\262Vz\254\305\257\252\201Z\214\372:>pI\006\300V\304q\210O\243\224\2529s\177\217Q\210\274\251s\376\033X\225\210\r\320H\276\215\204\321p\260\366\177\226\256\017\315\305Y:F\340O\220\341\346tm\t'k\243\364\372w\364\361\311\225\301\273Q\245?\320\332<_\262\3449J\226\233\242[\240@\376\215\370\327\307\177%\271\n\321\240\356B\2600\304(\202D\227\274\r\246E9\341\275\235\245\201a\374\273\333\013\233'\360\235\310\211;\324\255\362\354\234\373\003o\334rT\204k\337\260L4\324\346zZ\371\222`V\273\226S\032\301\227\026CH\266\261\242\032\353\344,\366G\372?M\216q{\207\256\321:\222\254\346(b\374h%d_\237K\016\225\367\364\311\306a\347{y\205\355\026v8\240\242\341\371\\@b\360\321\350\nP\373C\266F\237}\260H\022\222\353,'L\205"
+	.ascii	"iy5\313\240\332'0\f\256[\237W\336B\315\201\365BLi>2\026\342\205"
+	.ascii	"M;\305\346l\265\346\021\342\321\220\233\204\223do\3436\302$\367"
+	.ascii	"\214\022\357\031\260\371\314:\333|\257\214\215cf\374\256\367"
+	.ascii	"\221\021\340y\257\326\205b7\307Z\256\226\322\252d!%\205@\307"
+	.ascii	"7g\bR\201s\225\351\270\202\240\242\023\241\005\234\354\277M\\"
+	.ascii	"6\345\331\274\202o\243x\242\345\332\320\274\b'b\232v\336\021"
+	.ascii	"\277\315\354\035\216\017/\300=&\352\362-??d\002\211\214\013'"
+	.ascii	";/\275\272v\242\002,\200\2070\037\034\326\350\254\316\315\236"
+	.ascii	"\222\310\270;\334\267\374!r\221p\260A6Br\306\335\326\345\253"
+	.ascii	"EA\335g\360\314\331\373n\330~K\201=C\025p<\321\322\035yr\351"
+	.ascii	"2\303\270O\f\361\222\031\037pR\263}gf\274\322?\\.X\037*\027\245"
+	.ascii	"\341/p\346\221i\f\0047\346\006\300\251\313\0310\336$r\334\243"
+	.ascii	"\322jE\274"
+	.string	""
+	.string	"\003\236\23221\3774\003{\025\024\242f\201\n\370\200\260\233\255\321\351\"\314\3779Nh\0264cE\\\034H\332\353\3772il\254S%Q\272\262\bV\302\021&*s\237\333@\326\302)\350\254\304\200\00586\340\002\276d^\300\277\357B}e\347\241\330\304M\307!\254\310b\306\0334\231\020"
+	.string	"\r\035\321\244\322\262\007uq_\312\260EI\357\335\3100\001\025v\033\225\330\247\270\361\215\264\025P\262\200\321\226\207\222\234"
+	.ascii	"\352\244\371\006\357H\235\204\303\274\007\033\343\310\t;\001"
+	.ascii	"|\301\266K\247\021\021\224{]\005\003\345Ta4\347\361t\303\301"
+	.ascii	".J\021\036\027\353p\266^\013\343#\372~\016i#\254C*}\236P\300"
+	.ascii	"\214\373\2548\261\nT\307\277\317>\337b\311\256NMCi\333\305R\333"
+	.ascii	"\037\204]5m\246d"
+	.string	"\355\245\202\354c3\034\335D)\357v<\210\\\311L\033Q \325;\310N\332\327\373\024\337o;\327\350\2039U\002\274\251\006\330(@\353k\371\242'\030!\307b\201\177>O\254\002N+\314\201\0177\260\202Nd_7\r$\233D\302$\273\0331b\003wc\356\265R\214\021\250\365%\027\t@\213\300\243{\034u[n\020\350\204\244\3658)\342;\224.\246\234\022}Tj\206m\261d4\351P\023\243\231r_:\332P\254\221M}+\373\366\036\004\202\\\301\234\206rMY\244iY\345G\t\260\266\373\277v\310\300\252\024\023\375\257\316P\252oPq\201Lxw\360\356\233\331w\234\200\337\267\t\334\243g ;\365\236z\252\3047\202jl\243+]Z\304p\024\253\222F\3219\255ME\006\231\325B\260%\363ouxv\240U\020\021\252\366\262\204\266\316\234}\363\245\220\031\0360\320\340*\257\253L\241!\034"
+	.string	"E6\001\274Q\013\314\007\026\020\237\344U`\226\2765\225|<\330S7\"Z\203J\353M\n!\245\337\333\205,d\0276\354_\f\332\016\232\375\023\2145\027\215;\314\325Kj\234sUD\232b\017\333,*\260\234#\340\250\213Yc\306\334\216\237\255\254\316\f\244#\257G}\3028r1\001?\242\224\020< M\027\343\303\316.\337\356?\350\242\266bh\020\351\t\033)iO\373\030a,\336I\304`0\317\177\366T\2453z\241y\022\376\254]S&B\232\002\377\272xg/\006\017\232v\211+\204\244\034Q\304[h\204.S\200O\233M\230m\030\227\034?u\247\\\235f\024\274\033\224\030"
+	.ascii	"\006\206djb\237aj\034M\331 \251!k\003\322d\fl\370\035h\207\344"
+	.ascii	"\020\033J\340B%T\212\027\251\323\340t0X\002\203\017'\372~\315"
+	.ascii	"\021)\354\205h\001"
+	.text
+	.section	.gnu.lto__update_checksum.98.1e3ebfca832d24ac,"e",@progbits
+	.string	"(\265/\375`\344\001\215\020"
+	.string	"\246^lF\020\255(\035\273b\214\374\233\"Z\205\205i\270e\362ogH\233!}u'p\351v\213D\361^\333\275\206\"\374U@\325D\177\273:\320\277\001"
+	.string	""
+	.string	"A\204@\033T\304+\031\200\b%\277\034\r\342'\204l)S\nV"
+	.string	"V"
+	.string	"W"
+	.string	"7\320\235\353\234@w\316(\373\304\303\226\251\301\341\025\201\246b\316\371m\005\177\274\fo\251\250sr\025\345o\334>\260@\224s\322S\271,\004"
+	.ascii	"U\322\343v#s\332\265\005\246TbX\371\236v\0064b\r\013\\\271z\013"
+	.ascii	"\346\234V\0268\341\356n{d\033d+(\007\340y\370_|\366[<\274\275"
+	.ascii	"\317\356N\2529\251\226R\275R\255R\375\001\0316.\340\305\022s"
+	.ascii	"\272F\2349\303\311\\\300\260cN\032\002\246\n\f\205\216\027\034"
+	.ascii	"\004\253\266\002\020\352\241\311;'\214"
+	.string	"\304\201\253}\r\337\200\372\354\364\317\234\261\016 \346\f\023x\243s\316a\260\224\234sN\2712\333\035\357\366\263\036\2138\2562\244t4\007\"w\227\0031u\344\256hk\275v=&\316J\241\373\335\375\212\025,U\322U\021\257\205\230:.\376\251;\367\355XD\024\255W\212\216[\033\241\002wev\210\242\036-\267\033o\314\376<\346\317\370\313\003\r>HD2\364A\"\222#\221\007\033:\t\205H\2138LJ\034|\244\221o4\022\202\360\211J&\037G\001\223JDJ\337\t\211T\3720\302\371\215\271\223\023b&eS\334\312\354\252\331<\254\347b\275m\235\366K\250\331r\366\263\226j\261\335\266\\\202\261Q\321\233?\336\324y\353Y\217F\254Y\005* p\202\231\224\333b\340\225#A[3Q\221\243`\024\003C\214\273\r\030\351\263.\235\346\363`\333\240\013\347\005\217o\230\255;\030\2363\340\324\006\263"
+	.ascii	"7:\"\312\035\243\371\2256p\255\r\216\035\003\263a\006\246\224"
+	.ascii	"\035|\f\343\006\340\210\200D\t\367\022Y\310\023\224\335\f\242"
+	.ascii	"l\272\350\023"
+	.text
+	.section	.gnu.lto_UBLOX_parse_gps.99.1e3ebfca832d24ac,"e",@progbits
+	.string	"(\265/\375`M\021]H"
+	.string	"\332sd\031@P\346\316\030\333\006\005\316\216\333}\025\250J\321\376\305\241z\271\356d'\207\376\344\313\337\372\255\326m7\234\212\020 M4\021\021\021\321\fh\006\024"
+	.ascii	"2\211\243\333\357\356\356\356\356:\266\2242\245\224\002w\001"
+	.ascii	"s\001\216\001\316E\242sU\353L\265:O\255\316R\253s\024;C\255\316"
+	.ascii	"O\2533\323\352\274\264:+\261s\322\352\214\264:\037\255\316F\253"
+	.ascii	"s\321\352L\264:\017\261\263P\353\034\304:\023Y\347\226ufY\347"
+	.ascii	"\265\361\232\177u\366wn\017\355\346f\207\216e\027\002\276\357"
+	.ascii	"\216\252\341\313\307\236\221k\274n\346f\346\031\334O&\342\266"
+	.ascii	"\353\273\031\215\027\243_\265\267mH\237q\201\357\233\267\325"
+	.ascii	",\007\bj\026\253\235\332f\327fj\233\345\004\013f\260\033U\206"
+	.ascii	"\354\203\340\tw\266E\372\276y\306O\302I\275\3465G\271\333\305"
+	.ascii	"*\252)\251(\250'\247&\246%\245$\244#\243\"\242!\241 b\313\256"
+	.ascii	"\357.7\262\213D?e\232\273\256:Z&\355\234*i\305\2476\260=\221"
+	.ascii	"Z\211e;\342\272/\255nuP\030xF\316\243\210_H\324\350\032\212\256"
+	.ascii	"\237\342\332)\256\2117}\225\317\256\216i}\376=YZ\322JK\224x\222"
+	.ascii	"\263\221\230N?b\316\245\265\271QQ\225\254\276\264!N\224\345\246"
+	.ascii	"&\244\207\326\003mpz8\315y\333\323siB\\\250/-\310\2125\227\306"
+	.ascii	"\346A\304\257\no\206R\273\251\233Z\225&\002\351vh\t\244\331\243"
+	.ascii	"\245\331\212\365\276o?\333\321\226e\276\372]?\034\023\"\355\226"
+	.ascii	"\266V\243\035\322[\2427\264L\266N\374z"
+	.string	"\337\227]\271Tk\266jf\357bf-f\244\300\255\320\217e\311S\303\013\231[\332S\327\275s\237\356\263mV\350\0370\353L\327\202\236yB\377\001#\034l\245\340\007\375o9;$F\233\365\332\366\211O\214cV%I\241\373\004\002\266u\352\330g\266\320\177{\364\\h<\321;\354\024o}f\f\355\007\302)\232\241\353h@\352k:\0338t\360Vvh\233\375-JA\366\320| \270\234\314!Z\216\b-\006qz\217\0047\\\263\\\342\304\211\266\331\365\333\tSN\035^\231\242\027\314=\272\301\006\323\375l\013\200\234H\003\221Nu\340,\f\\\277\351\245\371\013\351T\356v735)\377M6\334m\020T\243vtz\334j\226\370\234\341F\323v\221\367\271\347\204\fw\231\247\346\331\321\275E\302p\213a>A\336\305\266\331.\373@l\354\350\230\373\013k\211\266\ry_d\26713\363q\345k"
+	.string	"\353\314\017\231\033\332]\216(\302\302\332f\375\257\342\260eu\212\226[\213\214\024\036\205\343\206\3216\013\025\035\354+\215\005\0067\034\253\020\363V6\313-\3266\333o\206\312\327v\267F\303\253\314yH\377&s\273\031\3029p\374G\230W\347\n_\253\363\003v6\262\316^\254s\027\027;o\261\363\001\242\263\001\242s\001\2423\201\325y\300\352,`u\326Z\235\003\254\316"
+	.string	"V\347\254\326\031\213u\276b\235\255\332V\177\365Q\177fU\222@\\\013\b\b\321,.s\001\026\253oA&\265\310\346y`\317\252/\376\373\235\035\322\020\342w1\274\234D\334\316e\016\210Z\251\372\246c\032N\325"
+	.string	"J\323\005\252q\230\250\2148\025\260)\177o\036\005\214"
+	.ascii	"\024W\356j\216\352\273\215\371\247n\352\231\335\246;9\"u\237"
+	.ascii	"\3139\325M\342M\216\\p\256\234\026\223\251\3579&\341tIJI\324"
+	.ascii	"K%\211\3721&\241\022\322Vw\030(U\307\021W{y\375_\251&\201jz="
+	.ascii	"T\022\322\037\341\321O_dG\211\277\035{\317\315\225k5F\236\276"
+	.ascii	"\367\216\276\351:\372\201\035\317\321L\377\200\2113\217\003\232"
+	.ascii	"x\233+G\204\351;\bs\220\f\240\231.P\275\343C:\325h\211\315\221"
+	.ascii	"\255\364K\016D\351\307\230|\212\276\311>\264\325\r\205\006\212"
+	.ascii	"\023\342\352\256G\333\352\256\377+\207\200Y\362$\275\017\327"
+	.ascii	"S\nv}\322wK\364\315\325K\016\225\301\241?\362}l\221\276\b/\013"
+	.ascii	"\236\032^\370\304\325\216\rg\351Ri\2754\244o8xZ\250\330V\370"
+	.ascii	"~v\343\300\353.\266G_\341\331\317\326\222.\024\307q\024\020u"
+	.ascii	"\2458\232K\305\312\351\312\243\357\037\314?4{\244\203c\332\241"
+	.ascii	"\201\336"
+	.string	"i\3207\333m\271\245^\346\326\271\317\021\314;tD#OR\373\330\026\275\321\367\331\232\277E\177e\207\255%\372\303\016\323CO\364}\326#\351U\303\243\225\260\241\037c\372\325U\365\270\243c\335a\315'\274Z\260@a\024\0133\256\b+\241\302xb\254\205\321\253\211\305X\034\307\214.\304\304\306\214Dyo\377\021\336\260\004\n\255r\263 C3B\240d\276\013\333h|\377$\277\025\321x\370\335\3505g\032\351\240\021p\314_\325\326\203\235mq\036\022\n\033\3257\013\373\300\233\370\003\377j[\212\260\205\26137e\340\223\206]\340\r|\233\265%\377}d\f\262?2@o%\031`\333l\201\3574g\230:\251or?\333\200\033\250\257\347\365\351\237\353\321\270\236\300\203\rx\002\207\003\036\n\317\032\r\257v\367\372\276\357\033\025\243\345\372\257gj\332Xc\326& \320\261X\330\207\314\217K\001\375!\034\024"
+	.string	"\255\323\022<^E\373\020\256z\200\034\360(\201\217[\006\341\317\275\241`\217\273\354\322\243\365-ur\231\006\300s\264rF\247.\362\251d\201\334\3161\202\323\317-k\020\255\343\3360F\351\270K\256\276"
+	.string	"\337\203N.ux"
+	.string	"\236\357X\214\262\357\271\0342*Y\325E\"\t\223\016\347\b!\212\304\337\270e\r\034\234\271\033\367\206\321\331\306]\022\210\262\001\360-\350\3342\375\207\256)S\203jr5\335\244\\\3069q\307h\377\321\270\237\320\264\336\b\247\026\351\240\3237\217m\326?\026-oY\366\262\316\034\321\302\342(\005i\344\3602;\234\214\273\034\223U\235z\251\322\255i\207V\313L\003\233\276i\326_x\270\317\017L\252t\020\313\207w\201\376\337\325c\375S\317\016\307\244\005\201m\250a4\346\234S%\"\"\222$I\2415\301\005\304\020\005\331\335\016\021\300,\247\23434S\222\024\322\001]\303HB\243z\026\021\220\317\215~+9\347\317\212\271p\242\273a.\253]-\216\362\204\256\235\351w\264n\356[\334Fr[\310\342\024\373\233"
+	.string	"p\217\310\202\246\302\3250\037Mh;\216l!p-\261\272N\233'\342\007\325\2170\336<Q\026\310(\007\247z\256\323\213O\340\355\311\rCyCMQ\347\b\206J\007\242\270\267\230A\037\317\243\276\312G\230\0166\212\215\370\004\004`\315\245\025\335\001\016\027n\204L\221\366\245Rq\237\211>!\374\366\220\2378\320j\034\215'\032\310\363\307\234P"
+	.ascii	"m$\267]F\371wh\371\270\220\324$(W\034R\355\020\210fh\247\017"
+	.ascii	"\006\260n\277\266\364Y\271r\237\247o\222\325\341\b\325L\364\347"
+	.ascii	"\314\275\206>Z<\031\331\r\343\002\226\366\242\215\274\271\231"
+	.ascii	"[H\213\235\253+\004\206\"\302vq\2609\300\020\302\370\322\226"
+	.ascii	"M:\376OZ\351\343\206B\220m6K\"l\311Tg\355#\366\007\311\307(\272"
+	.ascii	"\313\203\231$b;d\237\025\231\016Zp\251%M\272\250.WJ \353s\226"
+	.ascii	"K\261v{\274\266\265\020F\256\t\207p^T\367\241h\265\271\303\214"
+	.ascii	"f\240+\367\013\252\321\022\243#\211I\031"
+	.string	"I\347\007p\325\225-Z\373[:\255\t\320\276\332\300kn\2767\302*|ZV\315\333\300\201\241YbrY\204\362C%\275\033/>\2000\022^\357x\037\232\r{\3431\325\362\345\352/q=L\f\032\226\264x\335s\336\324\327\300\021$w\337\022\224\271\030\354G\004\t>\037p`|\214\332j\002\353*\017Pe-\023\355b\312\336!\366\365)\0300\316\271 y\2005\033\224\240\361\026s\307\006!\354\323H\037\032\256\256=\307\214\270Hs3\033w\036\020\3449\376\247\221\001c\030\006\277f\326"
+	.ascii	"!\220NT\333\013&\347\371\354\274\324\004\310\343o\260@*\367H"
+	.ascii	"+\214\216\2410\234\311\323\016I\221j!\363\003\214@\372\333\277"
+	.ascii	"\334\342l\351iY<\201\357\314F\"\016\211\237\021\310\3758D\364"
+	.ascii	"\261\211\002R1%N\376\352G\201*A^\251UF\206\344\020\0344\220E"
+	.ascii	"\266@Y\206\312\322+\261\241-qcz\226\271\213u\354\3331\b\217\025"
+	.ascii	"\235\243z\020(O\372P\221\240\242\372\324\200dS\2156\362\255\033"
+	.ascii	"\304\016\203\no\0378\267#\360\332st\352\215\177\366\343\241\230"
+	.ascii	"\270\247\f\233\346H(\250 {\313H\355\353\022\372\017"
+	.text
+	.section	.gnu.lto_gpsNewFrameUBLOX.100.1e3ebfca832d24ac,"e",@progbits
+	.string	"(\265/\375`F\020\335C"
+	.string	"\032l$\030B@bR\007k\335,\346B\301\025\315\th\204\375d1\204\360\016\207\244\340;\032\303\024\360\275xhT\035\333\375\315A\202(kd\3759\372\325\236\301\216\301\217\037\207(K\036\210x\024\260\330V6\2212\245o\001O\001\201\001\332\027O\355\343\376\257\237\335\337\037\356\343\374\345\334\330e\207\215\307\272\306\243\263F\255q\034\333\360\357\342\306\177\375\267<\027\033\237\335\202\372\302\306O\bV\301*\370_\250O\356\177\207o\264\377}\367\035\376ont\367\353\022\252\013\033\213m\351\017/\326\003\377\372\224\316o\345r\035\307Q:\2738\306\"\360"
+	.ascii	"\360\277\n\032\354\360\245\022\254\313N\202;\26508\3028\306V"
+	.ascii	"i'\216\374!\366]\231\227\357\324\304\264\244\224\244D:J\"\215"
+	.ascii	"\212\210\206\204\216A@\306\342\017L\334\357P\347\245\377\003"
+	.ascii	"\352\034\346\337\334\263\353\235\256\271\311,\r\3230)&\245\371"
+	.ascii	"}N\267\241\001\301;<\277\346\264\346%\352\032\246R\233\226\234"
+	.ascii	"4\324`\204f\337\347\254\016!\350\t\363{9\265\254l2\306\366H\304"
+	.ascii	"\tro\300\rk\345\236\215\261\375Q\362\370dF\311H#(\271\350\311"
+	.ascii	"\023=\241\346!\241\343\223\371\366Qk\316$\371\030u6\026\375\240"
+	.ascii	">gt\b\025\307\361\2579\221d\240=F!y\3057\210\234\037\2424\210"
+	.ascii	"\034l5}\223\375\233{\016yb\237\023\032\226\367\220\177\207\006"
+	.ascii	"\242j\210\034\237\314a\222\r\223\300\177\373\374\343\t\226\207"
+	.ascii	"\371\372ZJ\332\324\254\354\310\237"
+	.string	"9\311z|\355]\205\214\256\370d\0263qB\034\307\236\233\317\261\367\247w\317Z\356\236\300\375X\026\376q^\316rE\213\026\373_\035S>\266A\257\334\205\321\356\242\357\225\347\332T\372\365\202\313\223\005\374\312z\374\351\376\337>\203\021,\241`W.T\252m\321\016\265\024\314\373\204\256\\\350\377\277Ms\336\321o\374\377\340#Z+[\033\177?b\036\022\255?\233\r\325Z\331\366\374\327\274\204h\374\323\f\345\350\371\233\321k\306\370\223\311\257$\276;3\345\316\037\357\037\354\005bge\213\225\210\361\257s:p\034w}\324\277i\377\0335!\366\273\263\n~\030w\247\363\037u:\271\031\027\030\306e\271\217\373\177\3719.\3774w\221\225\277\371\257\177\226\266\202\013\214\272A\275r\327\035\313\314Z\352\376\177'\315\263\352\032\315\275\230\375\n\316\016\342\343\336?\274\365\237\352\257\357S\236\235\300O\366\001\236]\n\316."
+	.string	"\316\036"
+	.string	"\316\016"
+	.string	"\316\036\365\223\035jg\177\202\263;\301\331\233vv&b\366%bv%\235=\211\230]\271\263#\355\354G;{rgG\022\263\033\021\263\027\021\263\023\021\263\017\355\354B;\373qg\017\332\331\201\210\331\215;{qg\377\331\331\341\235\235\270\263\357\235\375\335\331\207;\273\336\331\177D\2019\3316]\356\330\364\0376\026\353\362\211\003\236\341\214pdz\315\255\321\222V\342\313.\351\001T\250\222\336\002\327\334*\351\242\224\254\256\310}C\276r=M\3351d7\rL\3238\216\035\374\353\271-[9\370\247\375\353\035<x\330\3772"
+	.ascii	"4S\352$-\004\007\355\206\365!\322\373\253\255\324\177\226\335"
+	.ascii	"cS\352'B\225\253B\221\260\034\351\244F\262r\224\324kH\235\234"
+	.ascii	"\202\3249\250q\\(\337\377\227&dC\304\347\332QRP\273\bA\3710L"
+	.ascii	"\262\200\376W\373\311\325\007\022r|\242fG-\315N\372\020\002\031"
+	.ascii	"\321\n\006e3\177\265\215\364\353%w'\273\306H\243\025i\"mtV\244"
+	.ascii	"\235~j\017i\"\375=\3700\207t\021\230\030\237P\222\243\016\322"
+	.ascii	"BH\216Ae@:\210\fH\347\230\026V\265F\304\352\324\330\0012j\317"
+	.ascii	"Dr\221+\021$Hl\243\026\222\n\311\023\326\2478\366\243a]t\376"
+	.ascii	"\300B\210\032\006B\3249\246x\270{\271)\344\357\214\236\321"
+	.string	"\207\211\022\323A\256\331\356\201\342\325C\275\277^\235\004\204\016\265\3277\267Z\017\365\367\2102s7\307Z\347\230\016V\241h\372t\313\270\025\371\240\310{\315\255\036\0257\246t\252fT\232\020k\304t\016\327L\017O\020\275\346\366\363\252\374h\351\230\037,\302\001\3516\267\260\226:\327\266\223b\372f\250)\310\205\350}qj\3318v\377_\230\024\321n-\365\247sb\312\227\375\233\333\376r\007Y\317\242\005\215\031X26V\r,\026C_AEC\206\213*\255\254\252\030YX0\252V\314\240QE\205t-\031-fT\325\320\322\232Qe\304z\275F\363\327\346\325\205\3255\345\351\263\270\253\206\325\351\017\374\251)}l\266)\341\nzi\246\347B\254\023\201\002\331}\251\266\244\222\277I@\277\0233-Sw\3455]eM\021\326\360\f\320VT7U\350\033g\367\305\244\245\376\201/5(\245\255\250~\\\250"
+	.ascii	"\275\r\240\005\324\311\202[U\226W\256\354\177\003h\034T>.t\t"
+	.ascii	"\300\234\300l\367Q\032@\234-\0300J\313\240\356q\257\022\376\305"
+	.ascii	"\366\374fy}\201\204\023\307\361\247\371\303\330\377J\301\031"
+	.ascii	"\364\312m\262\037\214e\226e\265\272\377\205\322V\324\275*T\351"
+	.ascii	"I\377\031\233'\375o/\265\245\363\213\272%i\251/\320\203\004B"
+	.ascii	"\353\271#\344\017\r\215\266\031*\257\264\231\274\367\342\b\216"
+	.ascii	"\032M\027\347\316\243LF\363\002\316f\362\231e\333\322m\371\266"
+	.ascii	"|\333\377^i\002\200x\335n\267\373[\373\203\006\241_\356\017\f"
+	.ascii	"\t\314\376\305E\231\372\317\356\272\004iK&\004\265\f\341\240"
+	.ascii	"\2333GN:o\213i\212\367[\273I;i]\350\024r\335\026\354\231.\213"
+	.ascii	"\251`\341\302\205\375o\223&z\321\241E\335\256y\372`tP\307$\231"
+	.ascii	"\364\237}a\322)\250u\3347Y\216,Os\333\327\246\355\312\205H-\r"
+	.ascii	"\201e\250qH\307\034\242\021\021\021)H\222\2445\001\006\204\030"
+	.ascii	"\246\356\352\001\021\3408\306\034\232\271I\n\351\320\007\302"
+	.ascii	"\342\2470\246\230\351X\375t\262\323\036\223\017s\340h\347U|\331"
+	.ascii	"8\260\246\303\362\320u\376\024n\266\203\341\"\331\203.\340\341"
+	.ascii	"\260\305\244\261n\311\357\323\032>\332\323\224\361L\343\241F"
+	.ascii	"\316\365\34501\016\366\326\037\234\344y\263t \216I\024=\226\304"
+	.ascii	"t\255\370\327g \272\254v\210\r\223^\344\204\312;\341\207\256"
+	.ascii	"I*2\252\rC\334\177\306\247\343\267v\207\224\253H\027\223\277"
+	.ascii	"\211\002\265~y\332N\221\265\340\273\325p\236\240\313k\316E\024"
+	.ascii	"\3078\2408\370\201e\260"
+	.string	"\375\310\023;\037\246g{e\r\f\003\325WbL\f\301\f\335\024\363e\260\345\311s\3566\230C %b\303\322\217\315A\376\347\355\204\223\326\204z\263\207Y\023\225\002H?\374)\001\200\324q\365i\210\tUSgH\351\330\212\326\333^\274\370_\270\205\374)\337\253]{\201\372q\212a\t|\210)\332b\356\322\330\356Nb\274Uf|[\373\355\356\235{x\347(\351\334?\236\235G\257\002q\2674M|\\O<\272)\024\306\320\262B\277\004^c\203K5\270?\346O}\031\271/7K\373\306\303m\t\260\266\340\034{X\023\242\321-\344O\331\005'\272E\222\236\005\243a\027j\013\325\225\217iZ\020'&\251y\303n\336\220\030\270y-\366\030\321\327\245\335I\264\034[\352\210\245\030\376o\t\363/\354M\001$\b\r\303\rm9\312\001k\210\005\262\033H\243\326\bwq\033\365\207!\211\300\212\022`\320"
+	.ascii	"\254P2\225Q\264\313\211\212\204\317\026\307\304\321\376Ci\215"
+	.ascii	"\215.D\231\265b6t3\r\377\322\275\361o\242tSu\232&\3524M\324i"
+	.ascii	"\232\224\2223\022\362\335\223\200J\245\342\f\330\274:\226\347"
+	.ascii	"A\215(\342\324,\232t6\234O_\b[\324Y\355\230z2\2112'\367a\006"
+	.ascii	"-o\257\321\274\354\324\252\020`\325@Z\001\204\n(G\244/s!\362"
+	.ascii	"H\223k\301\270\364\262\034\213\212\300\203zY0\177h?\270Gp\254"
+	.ascii	"D\001\364\322\335Q\332\034\004\244\344D*\255\206Ex\r\213Q=\263"
+	.ascii	"%\337\\pm{%R\351\360diP\216\324$\020\202Ad9\334\016\004\377"
+	.text
+	.section	.gnu.lto_gpsHandlePassthrough.101.1e3ebfca832d24ac,"e",@progbits
+	.string	"(\265/\375`\231"
+	.string	"\225\n"
+	.string	"\206\224I? m\225\016\003\2559X\031d\b\004w\311\\\213]i\035\020\276\212=&\341<\241\002\356\217>A\343\210AKY\301\354f%"
+	.string	"\314(\230\311`\235\354\316\005O\246\213\314\005)o5\331R\246\0247"
+	.string	"7"
+	.string	"4"
+	.string	"\234\307\006\017 \324\210\335\315\024\302\267C\315\315\377\351\024\235\307\035\212\256PBr\260\302<\017\314\350\220\002=>\027x\237L\b\200\335uv^\350\276n;\200\355\r\373\222\r\276]\006_kS\227\006\t\266\357Wx\344\234\202-\"\210\230\260\273\330/\233cc\277\216\331\316\264;>\266\233\022XwG\0342\354F\016kD~y\263C`(\330\026@|\222eH^\375\2509\220\357\240>>\362\341\213+\325G9\247^\217\032]"
+	.string	"\225\350\344gGOj\311>\\%\3310\ro\3723\323\217\244\210D+\364\224\re"
+	.string	"te\242\301\024\3104Kf\300B\271d\225\214&\233\\X\303\020\310d\033M\313dX\354\\I>\251V\252\216z`E\372\361\242\345;\253rg=\3700\250\226l#\230\200* \017"
+	.ascii	"3\003\016j\310k\200\216\275\206\206\275\2026\245\204\370\243"
+	.ascii	"C\200\256\341=\232(\203\n\241R\227\305\265<\225\220S\n\265\007"
+	.text
+	.section	.gnu.lto_gpsEnablePassthrough.102.1e3ebfca832d24ac,"e",@progbits
+	.string	"(\265/\375`i\001\005\017"
+	.string	"6\035gF\360\260(\035xw\177\307k@n\032\334\177\236\230\333\031\t\351q4]'\353\275\200\241C\336\347\001\357\337\366\312\334\373x\312N\373L\001\370\036\203}3\272\007\223>\016\007\227\226\246Q\244\323\274\300B \331D\312\224\002R"
+	.string	"L"
+	.string	"V"
+	.string	"\273\257\0316\273a\002\037\340\036\035\036d{\344>`{\364\311\276\361\020\266\005ntX59\273\333)\314O\3274O\376i\336\001\272P\327X\256\032\002\031\f\034\037\327J\003i\201"
+	.string	"O\363\334\340Re\002`\260\273N\320\265r\307\333n`{\201}\032\001&L\276\214ST\362\340\243\257\262=^\037\274\260\321a\246%\2253;D\245\276\330\327vw\255/\373\261\337\363\364\246\351\250i-\323\372t>\375\317cD\2648\254\334E\306nk\226cqb\214\020\036\266\237\366I|\346\364\230\351\001\002\0364(\312gq\325\250\004j\\f,\026\325a;2\033\325\027\333!\233\246\025N\324X\345\216\363!\233\252\246\332\202\325\242\262\350+,p\273;\342\253\310\200\302\311\230\266G\325\216X*g(R!|\230\215\340\322s\230\034\034.\2576\206/\017\332\300JQ\366K<%\222Gr\022J\361H'\245\357\003\221|\243\220"
+	.string	"\227\210|\243P\347\211\272\013\"\020JWB\372:\221\017{#\023RW\362<R\347\021\356\265\325\227\035\334\254\216,\245*\177\244\037a{(a\302\bl7u\320\243\233\332\024@,E\271\330\324\023\223BG\373d\324T\333$\244 \031"
+	.ascii	"3\241\221\037C\016\213\20767\320\336\223q\3656\362^\025\304b"
+	.ascii	"\201\355,=v\263\241a\006D\326\304\030\314\241eD0\\Bs75\037M\013"
+	.ascii	"\001\230s\t\266YM\021wy\252&\247hj\017"
+	.text
+	.section	.gnu.lto_GPS_calc_longitude_scaling.104.1e3ebfca832d24ac,"e",@progbits
+	.string	"(\265/\375`\333"
+	.string	"\005\f"
+	.string	"\006\030TA\020Q\234\016@\217\347R$\001\250\333F\367Z\361U\373\n\225F\t \361\334\250/\261\"\007\273\313\375\207}\024\016J\332\356\331\275{\013\007"
+	.string	""
+	.string	""
+	.string	">\001"
+	.string	"\210A\303\344\256\344\005\246\276\342&R\246\024@"
+	.string	"@"
+	.string	"A"
+	.string	"&\266wT\260\265\353\001\006\310\356&0\206\362x\271e\362X]\300\344\321\233-\343]\210%\020\302\001C\n\222\335\275\024\304\267\347\346\337\273\305\225@O"
+	.string	"\013v\327\311\225L\267\3366\306v\306\276\2051\323\325Q\035\177f\372\226\345\224\301t\216\221]\ra\311\202\321\305\210\243\376\316>\n\337\003\345\357b\355\276(\001A@y\374=Wlw\376\276\246M0FH\207\324\356\036x\264\001\312\323~\211\007\024\362\334U\275\323\tp\244 \373\373Hj\303\256\025\204\241\212\321n\bSi\324{\017 B\"!\312\320\252\225\026\020!\221\244\252\336\343\232\013\0345H\251P\206v\007J\375`\277\332\335\265n\330\357\356\0234\2511\330d\325g\363@\315\311h\036\007\027\326\271\"t6\020.N\246]\231\001\306<\r\262\353\203a\331U\351\366\325u\303\326\251\005\030R\221\257\376\212\263\360\347\213\260\346\217\350\373c\362\2304\270\0311\243\332\022\002\021"
+	.ascii	"2A0\034#\\\214\237\240.\0309\016>\202\246\275\273\006O\266\310"
+	.ascii	"`\2706S\007=M\335\005k E\rN]\001\327\362B\230d"
+	.text
+	.section	.gnu.lto_GPS_reset_home_position.105.1e3ebfca832d24ac,"e",@progbits
+	.string	"(\265/\375`\274"
+	.string	"5\013"
+	.string	"\246\324J>0M\225\016\bM3M\265U'\f\305\211)+6>\032\027V\372\254\212\311\to\326\303\f\366I`\307"
+	.string	"e;J\034\270>\346q0\310\004\216\003\366\265\262d5\034\260@m\223-eJ\0019"
+	.string	"8"
+	.string	"8"
+	.string	"\213\351\204\177nA\315\217\357\250@\270\016t\353!\341\020\0220\241\341DdT\201\273\272P\252E\007\001\n\330\335c<#t[\246\243\262\273N\256#\335\361\266\r\330\036`\237\022\367\304[\327\003\236\207\024%-?[\265\245\236\354\303U\223\375t|\032>}G\344\202\004\351^\210\335\321\267b7\254\r\027\266\177\371c\227\270\n\265\001:P\020e@\261\033\307\320y\354.\305\277\360U\003?u\313\033\016'\026\020\241\241\345\367\334]\220Z\022\243\036\343\017\020\253\021\241T\341\274$^\243:E\245\355\031\327\350\370)?\360\344\271[\016\266L6\031\005Xv\301\030\\\020`0\213f\203M"
+	.string	"8\313$\320`\016\262L\203]*\355j\202x\337\206\246\233u\245\275"
+	.string	"\223\347\254\n2\207\f\013(\250'\303w\"\324\364V\037\354,\026"
+	.ascii	"3\003\3469#\3535\240\331\013h\373#\223\343D\240\244\b\243\212"
+	.ascii	"lBc\033\254\256\260\313\037\314\261(\373\\\303\255\206\360/\343"
+	.ascii	"\006\227\037\030\245\25295\343lW)\003"
+	.text
+	.section	.gnu.lto_GPS_distance_cm_bearing.106.1e3ebfca832d24ac,"e",@progbits
+	.string	"(\265/\375`\345\003\305\031"
+	.string	"\266/\245J\300VQ:4\366N\300&\306\250\002\013\b\032\364\004\3533/\364\245\260\277 \205\354v\351\177{\272\001\222\254\r\237\363\346f\354\364\377\312\n\016@\223@\"\013\021\006\242\330\251@3\220\273=5\276\016\203\241\377m\237\220-wJ\001\222"
+	.string	"\177"
+	.string	"\220"
+	.ascii	"@6\276q\034\267\023\271|\335\251\363\b\351\367#I\255\325\300"
+	.ascii	"Ac8\035\204\241\037\272aaa\326\340\320\033Q\201\206\221\004\031"
+	.ascii	"7.*U7C\305\002\336\023\361\323\376\213\303\270]\350\346+\265"
+	.ascii	"\372\224:j\345\035p\314\351\240y\007\020\036<\275\025\036\364"
+	.ascii	"\315Fr^\212\352\362\363y\3501\251\265\212\213\342\267\323\235"
+	.ascii	"7\377\345Q;\035\234S\021_Z`\210\t$\226\216\216\276\364\004\021"
+	.ascii	"\361\3623G'7\247\251A\255\325s\247\263s\203\267\375\300\266\006"
+	.ascii	"\233\022\b\277\t\017~S\275\0256rxps\311\346\341\314=a\237\326"
+	.ascii	"\365\261?\364\303\274\306?\340D\367\353\274_\300i\374/\367\335"
+	.ascii	"\256\013\375.\227\361\007\330\351\226\235n\321i\026:\275B\247"
+	.ascii	"U\350t\n8\315\242\323(tzE\247Ut:E\247Qt\372D\247M;\035\3564\270"
+	.ascii	"\323t\247w\247\347N?\006\200\013\244\235\377,\325\032b\311I="
+	.ascii	"\002w\2608\321\357{\216\227V\371\\\322:t\240\237\217\257MY;V"
+	.ascii	"3\277SY\230\016\213c\327\246\024!Y\353\003q \233F8\354\224\240"
+	.ascii	",KHy\020B8j\365\324\325\212\213Y-\312\206JdPj\252\326\266\031"
+	.ascii	"\303\357V\013\243[\034\247\026\265\252}\022\331\363\332\327\246"
+	.ascii	"\026$\342Z\327\242z\234\326\264\257 \036\357\341\322\377\261"
+	.ascii	"\006\373\346w\366-\203##\3025\355\374\201K7\\\020\002\270`R\016"
+	.ascii	"\017.\002]VoE\231\303\263\353\332\033\221I\346~w\251\021\t\224"
+	.ascii	"\2330\227&\275\210B\355\364\3436\230\f\r\235\21524\264f&\243"
+	.ascii	"\301b\027L\266\232\214\206*\230\215\nl0\231\331(\263\301f2[-"
+	.ascii	"F\223\222`6&\260\301dl\263\030\215\266aF\345\031\004\265\f5\342"
+	.ascii	"(\023g2\230\2158C\253\211\bZ<f\210\321D\3338\322D\025\257\236"
+	.ascii	"\326\365A\251\210q\204\333\034mYM\022%\356_\330\332\226%dO\356"
+	.ascii	"EJCJ\354\236p-l\355\342x,\231\021D7\233\270\265~\321M\2506\215"
+	.ascii	"\260lk\257D\n\301}\320Q_+\313\262\333#{r-\310\024/*\273\262!"
+	.ascii	"\0212(7\003P\2501Xf\f2H\231L\234\2400-f\f\300\002\021\262\332"
+	.ascii	"\016\020H\007K\223\341G\210\354I\032m&d[\321W\021\356\371Q{r"
+	.ascii	"\207\013\236\220\360\022\314\2516\030^\036\366\033\374\300\375"
+	.ascii	"\261\270(W#\254v\377\300\n\325\311\3567\230\203^\260\020g8\036"
+	.ascii	"b\236Y\007.r\\9@g \251w\031\005\376\"\251s\303\313\023\205\373"
+	.ascii	"\211\033b\036q\253\340/\004$h\032\2370\310\352\335\006\036\355"
+	.ascii	"\214\274\306\255\370\255\220\025\006\320\347\276\245\312\212"
+	.ascii	"\016j\241YD\210\224\244\003\352\251\324\234 h\212ej"
+	.text
+	.section	.gnu.lto_GPS_calculateDistanceAndDirectionToHome.107.1e3ebfca832d24ac,"e",@progbits
+	.string	"(\265/\375`\273"
+	.string	"M\013"
+	.string	"\026TK@ kL:\300\274\250\022 \"\262\003\274\361\221\366l\022\267&\344\264\032r\017\034\326\304\263H\332X\202\266\327+H\343\232\217p\321F\004\t+\200-\200N3\365V\t\\\0328\253E\2627\3312\2457"
+	.string	"8"
+	.string	":"
+	.string	"\265z\262\300=\237\234\\\217\377\326!\342\370\371|\030K\347\036\245K\216B&A\003\304\030\342$#\226\370\326\227\300\b\332\355,j\255^q$\335\364\266/lO\330\257\b\237~\207~^b\2502l0\205{\263]\237\225(\373\\\225'\373\353\356\353?$\fV\244\263`\265\216n\035jlN8`\373\021{l\fw\245\252\004\005\013\"\007\264\032 H?\001\250l\tf\341\336\0266`\204\200\353\326\346p\354EK\371y\252&\213 =\241\235|\353\217\n\257\013\241\255\371\237\320\313NzE&\320\025|A\207\277r\200\316^\f\256P8\232\213\007~\236\306\227\221\361*\033\216G\2110\250\261l\274\r\020\334x\021W\275<\031b\200C,\224\240)Q\026\352?8\004\313\345\373\350\247"
+	.string	"\225\2156\0131\324\177\275\001&\023\027"
+	.ascii	"3\003\346\031\362\370`\226\266#\017\315\301\302G\035\262\203"
+	.ascii	"p\bX\016\231@+\200\222\017WW\330e\017\346X\224}\256\341\202C"
+	.ascii	"\370\227q\307\245\213\331N\213\3204\006\005\005"
+	.text
+	.section	.gnu.lto_GPS_calc_velocity.108.1e3ebfca832d24ac,"e",@progbits
+	.string	"(\265/\375`\b\005\245\033"
+	.string	"\246\260\250H\260\326M:9\2447<x\221\344:l\037\204k\036\252>\025\035\301\013\243J\004\224+\250(gK\027\366\313\2620\372m\245\205\367NN\033\326\306\244_\341\302_K\243\017c\255\315\240\307\324~\370A5\266F6!R\246\024\210"
+	.string	"\204"
+	.string	"\235"
+	.ascii	"1Q=\212j)\325\242T\207R\275\242ZC\365\t\320\234<Y\272\r\2549"
+	.ascii	"Md\t\233Y\"\225\214;}U\365\032\332\267\217\303\177z\216\377\214"
+	.ascii	"\356d\340\347\322\324\2540\253\024\\s\316\002\027- v1\300i\362"
+	.ascii	"b\370\032y\3613\033\331Ql$\346Q\002\253\036\017\352k\316y\333"
+	.ascii	"\0267z\270j\344\217\016d=\245\243\207'\2760JIa\2009\347o\\K("
+	.ascii	"!\251\216\016\346\234\326\236\322\322-\336\366\003\333\003l\321"
+	.ascii	"DS'\300g\217eW\004\351<\336\303@\016\236\362\224\274\250\373"
+	.ascii	"\247\207^\276(0\235s\036\355\2620N~3\354h\222\244V\354\353\370"
+	.ascii	"\016\234\017\303 r\372\336E?\267\b|QL(t\232\305~:\322ea?\234"
+	.ascii	"\273\302\276\323\355#\325=R\3153\252w\244ZG\252s\244\032gT\333"
+	.ascii	"\244\372fT\327\244\232&\3256R]3\252i\244zfT\313\210\352\030Q"
+	.ascii	"\r#\325/R\355\"\325\263Q\335\"\252e\242:\347\005uG\200\214\374"
+	.ascii	"*\202\b\t\022\344E\232]\300\204\252eg\266F\202I\n/\030\26320"
+	.ascii	"\033\263\266\253\227\205q\331\331\276\030x\021\".\023n5\244j"
+	.ascii	"\006\366\223m\313\256\324\356\210\317\306V\2669Tv4\306\225\033"
+	.ascii	"\333\357h\b\241\340\251q\017\305\004\205\270r\367j\307\025\356"
+	.ascii	"\256\270\262j7\003\311\007\036$(6\347d\340\003\017\244B\b\013"
+	.ascii	"\372\236\205m\360\202J\347\013\227\n\372\2611<J\310\300\326\234"
+	.ascii	"S\201\217\377\320\340\303\270\350\rCC\362\342\356\233|RL?]\003"
+	.ascii	"oM\232\001D\270\017k\241\037\017D\033n\271\241[\207!\f\270\233"
+	.ascii	"P\221\207\333\217\215sD\032\212n\037r\271\242\333\354i~WX\026"
+	.ascii	"\003+K\267H\356\311\022\f\273b\245gG\370\254\230~<_A1[U\364\252"
+	.ascii	"\327E%\b\200\227\020\317\024\236\035\341\033\002\366;Nr\375\306"
+	.ascii	"\303\032\276\252/\2570\n\024`\257\313\t\020\315E\223\031TS\217"
+	.ascii	"^\327\316n-\321\331\235c=gup\366fsl\213\243\245\304&\2637Ux\301"
+	.ascii	"\332&\001\252m!\201\360^\027mk\273R\274\340]%m\226\266\243\326"
+	.ascii	"\256\251fg\326fE\255\235\n\232\255\331e\250ADd\025R\204h\204"
+	.ascii	"$\251\221\326\260\002\031\241\272\016\0210%TN\215i-\255\0013"
+	.ascii	"\234\300\272\270 \274R\376@\207U\307_\033e&_h\345\236Mr\230\330"
+	.ascii	"I\231s\235(\t\356\323\260\257\310\003\013/\250\300\026\246\263"
+	.ascii	"\227\027!'\355\211x`i\257e\357\022\313\204O\252\316\200\300\005"
+	.ascii	"\b\003cybgb<f\213\013\277\322gM'\023dl\220\274\336\367\266\316"
+	.ascii	"2\261\325\367\2559LT\353 \023\024N942\034y\314Y\\\r\346\360\271"
+	.ascii	"\035\3571\034\374~|?/*\322\207`B\273MD\3168El\325\021\026\306"
+	.ascii	"\307E\003\0223L\230\\k\344\354\207\017M\267\324~\212L>\247\036"
+	.ascii	"B\265\f\363\3756`\317\216\"\374\266\216\252\001"
+	.text
+	.section	.gnu.lto_onGpsNewData.109.1e3ebfca832d24ac,"e",@progbits
+	.string	"(\265/\375`\250\002\025\023"
+	.string	"\206awH\340\320(\035Z\305\360\324\362xZ\306\226\246L\277\234\276\005\333\347#\374CF\327\337m^\257\r\025y9*\027+\331\316\202e\247\242m\232\n\246\212\030c\214\305\031\3040q\254\353\f[Y\231\264\355\251\376do\"eJ\001g"
+	.string	"W"
+	.string	"d"
+	.string	"6\020s\300\317\216\253\247h\316\t\356\007\226\262\376\225>H\236\214\335*\313/\301`\376i\315K#\035fh\376Q\333\240$\035\231\230z9\031\232\323\256\025`.\225\032\036Q\260\t\035\2019\347\007\223\240]\314v$632\240`\255.\304\206\007\034\247}DG\246F\3253\231sZ_\260\231\333t\3338\333\005l%\021\372\327\243\357\"\037\277\247\275\2431\003\332\021\013\365\310\266\265te\366\327\025\304\303\306{c\253\032D\325(U\237TmR\265\247j\251\352\250\352N\325\007 "
+	.ascii	"'g\346\264\2379/\034\361\230A\021\206\b\333\367M\274\366r\036"
+	.ascii	"\037\230\t\025=\332/\366\367\370\317,;\307\003+\367\223\361\340"
+	.ascii	"\\\261\226}B\254H\021Wv\373\351\027\221qO,\034\270\304U0\253"
+	.ascii	"q\234\030\030(t+s\367\225\354\266\301\r\310V9nE\232s\"\360{\256"
+	.ascii	"\"\345\347<\032\202J%\037\273-\031\252\205zt\rq?\026\326\"\322"
+	.ascii	"D\312\335\206b\324\310z\021\3715\255\325\025k\335\366\023+?\307"
+	.ascii	"-.\001>)Q\255\240\200\251\024\360A\312\002\025\360\204E\005\226"
+	.ascii	"\004pj\205\001\013\030!\225b\001?[\370\275\261I\270-\016\237"
+	.ascii	"ON\273IkaJ'\365k()\372\227waBptF|\200\354k7\020\372\224\270\021"
+	.ascii	"\241\270\267 k%\221q#G\322\334\215(F\215\356\241Z\334[\324\213"
+	.ascii	"\026o\023\314\204v\244\\\027\177\351x\217\257\344\0039 \220\002"
+	.ascii	"!\"k\007\242\200u\rq\221\227 H\301$\t\227\257\265\327\016M\321"
+	.ascii	"\b\255e=\344\306Q\300:\025g\013k\023\213\016\365XW4\024\3622"
+	.ascii	"\020,`\370\306\216\201,\200\310\321\301\305m\3078\270\246\334"
+	.ascii	"\236\t \233Y&i\341U\376\267\265\261wc;\336/C\202U\036\033c\300"
+	.ascii	"8o\315o\0323\350H-\217\337\214\261\241\324\276\265Z\343\3245"
+	.ascii	"?\243y\217\302\032\326}\316l\032\033\031,("
+	.text
+	.section	.gnu.lto_last_coord.1.149.1e3ebfca832d24ac,"e",@progbits
+	.string	"(\265/\375 \027\271"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\202\210\200\020\1773,4,"
+	.text
+	.section	.gnu.lto_speed_old.0.150.1e3ebfca832d24ac,"e",@progbits
+	.string	"(\265/\375 \037\371"
+	.string	""
+	.string	"\022"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\031\001"
+	.string	"?\202\210\200\020\1773\273\0014\273\001"
+	.text
+	.section	.gnu.lto_gpsInitNmea.part.0.156.1e3ebfca832d24ac,"e",@progbits
+	.string	"(\265/\375`]\002u\022"
+	.string	"\366\037rG\320\362&\035&\347]\274\2704\362\377?\320\273\277]"
+	.string	"]\345\322uyF\257\221\234;\302[N\2401\342a|I\036G\340u\347]\3533q\336^\211\366\302\021\021\271\253yS^\236\310\277h\362\243\027\255\355\275\345N)Y"
+	.string	"V"
+	.string	"b"
+	.string	"\273;WU\373#\231J\370*\376\321\374\310%C&|\214v\227\346>\256f\273\\\227/\262]\343\261g\007\371w\333+\331\320I\232\332\335\356RG\334\273\302\350\371\270\223\340\270q\312\365\324\\\377}\200\025\222S\256\307\303\241\200GV\312\356\272\365\341\226\267\315\300\366\001\033B\005\363R\365M$\256P\257Sd\366\026.\255\335E\361Y<\351\305\027\2724-\006\336v\351\307\314\313\253v\030\272\371\340\216l\340\325\n\333\265\223\326\311e,\004\017\025T\r\264\202\032d\215\217\273\273V [B\263&\364\224\3202BG\205\326\b\r\025\372\001H^7\002\361%\363\237!\274\311e\3446\343\337\021\234 \202\364#\027U"
+	.string	"J\235jG\220"
+	.ascii	"o\263I\216\326\330\227q\246\031_\310\023V\340\312\274\234:\362"
+	.ascii	"\004\302\033\036\203B\313\207\361\245\n\321\002\313\274\215e"
+	.ascii	"^JM\360"
+	.string	"\304\244\032/\374\005\2067\335vqPlsx\256e\001\220]\034\005.\256\004\2131\331\224\005\206\275f`d\035m\326e\230\265\274t0\231\231\356E\3004\230\230L\247\201F\223\351\\\266\341\343*\220%\212\037*(\033\275\361a\273\226\003`\3513\232\332\357\270\247\250\006\331+\232)\336\303+\342!\302\212H\212\245\377\354\341\256#\007\034b\2132\201\376\327\300\001\274\215\245\006v\204\354\270Qy\360\032*4XHUDR\0019 p\002\021\223\305\r\t3\306\023\203\007\0234A2\320,P\225\306\351)\250\236.X\220Cr\211\001\017\272\215\275uv\260\007\343\016\023\222\030\333z\271\006b\273P\321\252\331\367ee\245\303\306^\f\037\336)J\204)t:c\207v\320h\207\321\036\315qQ~\3336\025\026\200\355kk<\230\255[\220>|D\347\260r\261\261\361\206A\027'\206\306Ke\350C\231y\333-"
+	.ascii	"\333;zz-=!\214\001"
+	.text
+	.section	.gnu.lto_gpsInitUblox.part.0.163.1e3ebfca832d24ac,"e",@progbits
+	.string	"(\265/\375`\363\022\265J"
+	.ascii	"\232w8\032>@\346\316\030\344g\355\337|\262]\026\321\202<\f\013"
+	.ascii	"\002\215\312<,[\344Y#U\255\305\002\262\203>o\177\025\375\202"
+	.ascii	"\276\335\013>\207\276\217\340im~\"\242\252\272\001!F\244\224"
+	.ascii	"R\246\224R\224\001k\001\232\001\255\263\332:\247\255\363w\231"
+	.ascii	"fg\235{\305\323\004"
+	.string	"(\357k\3440\321;E\325\323\322e\272\363\332\233|?8\007\327W\220\260T\315\034\3011\205/X4\213\335\364\036\017\316\021\025M;\302vi\222'X\370\276\321d\253\034m\233\211\271\271\327\264\034\267^\036\233\035lv\254\031\373;\3206\034\336\231\267\273\347\243S\255\340\275\331\341\025\362h9F\242\363+\344>\323s\314E\366\321r\254*\001\364\346\203\345\206\373\301m\206\213e~tT\311W`\321\227\254\031\327d\334\216*\333\256f[wg'\370\276\321\254Vy@\333\352U;\255\255\246\315\264\266Zl\265\3050\363\217&\273\314\200:\232\366\366]\034\220\271\302\367}\223\255>Z\273M5%\025\005\365\344\324\304\264\244\224t4\"\035\025\215\210-\273\252\351;\322\345v&YWS\315M\211\t\343RQPoZ\374\t\332NY\260x\023\224\315\231\226X\256#k\255t\305\255\251\346I\235\247\271\226\346\307"
+	.ascii	"fG\244\264QJ\231#\331u\223\035\245\t\004\363\006;O3J\352d$\013"
+	.ascii	"\323\255\t\305\213w\335dFx-\200\f\2341\206\3046\323\001\332\342"
+	.ascii	"Z \226\211\036\020_\323\253<\315&\351\325\373\276E21WY\2565:"
+	.ascii	"\202\314\216\210\3514MPF'\211\221,,u\302s\366\247\315\264\217"
+	.ascii	"\221\201\371?qbD\366\265&\275\357\333fM1\251/5\222\345z\337\227"
+	.ascii	"\333kLsU3{\312\314\036\230\225\226\004\314\254\243\t5TH{_0\t"
+	.ascii	"\206zpC\312\241\303\332amu\375\326\353\324\313\263\320\372ON"
+	.ascii	"[\271\252\314\037z\220 \365\331\260@\320ov\003\367\226\246z\032"
+	.ascii	"B(v\357\233\361w\226\231:8i]+\327\364\333L\256\016\230\037\342"
+	.ascii	"\177\377\364=P\254\355\313\017\231\031D\003R\006\376\263~\201"
+	.ascii	"\206P\316<\242\2047\323\337\351\215\227\276\257\357\342\356k"
+	.ascii	"(\267\276.W\304\337\375\377d\006\344\356\303\200\326:8\377\307"
+	.ascii	"\364\343\336\343z\246\2603_\"cm\357\224\027\013\017w\036\006"
+	.ascii	"\324\276oW\227uW\255}\2577\275bkq\004\337\367\305\262\303]\306"
+	.ascii	"\334u\332\350\213U\234\022\346\213\230\331D\3179\321\276\357"
+	.ascii	"\033\201;N\313A\301\315\326*\247P\341\315l\225[\305\332"
+	.string	"j?[\226\2762\2708/?\364\177\362#;}\277\ns\353\274et~\320:;h\235\033\020\235\031\024\235\223\254\263V\353\274\340\350\254\240u\316j\235\023\020\235\261\212\316\bX\347\003\255\263\001\243s\201\326\231@\353<\200\350,\240\350\034\200u\276j\235\001\030\235\255\214\316U\2553\022\311\231\252u\236\":K\265\316QEg(\326\371\251\350\354\304:7\265\316L\255\363R\353\254DtN:r>\026\235\215\2543\022\321\371\250u.\0329\033\265\316D\242s\313\262\316kp{x\316\376 \331\271i\203\374\266c\020\236\307\306\016i\307\037\034OMj\307&\034\215\235\335\321\330J\005\b\346\207\204\370\234;\326\272\234\237q\211\260\021\227\214lm\225\n\256\313_\031\334_3W\021\255\373\256Lt\352\373\216Ax\034\334\335\224K\371\340a\240\200\335wl\302\301|\271\323\362\250\227\342\"\365\306\020\276\245-\352\267"
+	.string	"\365\236\036\352\333\263dh>\022\216E\203\005\266\247o\276\246w\272r\242Uk\372\006|t\3208=\335f\272\365\313k3\0244\372\247\353t\221\270\025\327\371<S\364V\210\351\033\217A\370\231\231\033b\016j<\246G\032!\324\367\245\\\033\217?x\2312\n+\227\350\255\220_7\036\233\360''\214N\360\272"
+	.ascii	"\027B9>i\006\021\227\236\211\022\231\266\244\231\203\272\225"
+	.ascii	"\253\322/}\252H\254\354\313\017=\211\022\211\322\263a\213\f\267"
+	.ascii	"\374\370IM\334'\315\244or\243x\021WJ\253i\341D4l\375\371\220"
+	.ascii	"\343\267\032\2658\2447~\273T\234y\242u!H\177t*2\214k\021\375"
+	.ascii	"\321\362\342\037=]4o&_\205\271\330\321?\0012\361\362\303\033"
+	.ascii	"\016\346\252\265\354^\376\345\256\245.\026W\313\252em\265\370"
+	.ascii	"G'!T\2175z\366\333M\256\317\001'rq\275x3\215\bx\373\314.\324"
+	.ascii	"\025\343\315$\376\025\330w1\267\242^D\203\233\215]8\227\2147"
+	.ascii	"\323%\363\352\336\240?\"%2\355\020\361i\b\312d}\366\337\017\310"
+	.ascii	"\"\257\013]\230\241\367\"\004,\243\007\214\02758\300\320\301"
+	.ascii	"B\304\213\035,0\360\200Q#\211\207\215\032\317.\264r\334\210\221"
+	.ascii	"\2641#Yc\006\013\032I\0278r$\265\232\330\306\r\0308\222:l\330"
+	.ascii	"\300\221,\266\327\177q\327I\251\346\272<\227\255\3579\006\361"
+	.ascii	"[\276mn\353\303cy6O\323=\307&\376\312\253\315!\255D\321\246\020"
+	.ascii	"\365\003;\217\346"
+	.string	":[+\017\236\025\013\204J\375\237\271N\2537s\373C\2104\346\245.\312\301\024)\r\336A\024(\r\236\245\333\003M>\203&\f\264>Y\345\227\360\222\317+Y\0026^\253V\336\271\364\003\341\357\221|\222e`\240\245 Ak\253Z\337{jz\307\303\303\303\301\005_\265\267$\364\315\245\2417\242\340\217\203~\206q+\324I\033\324\221\302\227\265\247\254\037\362c\t>\353\205|\220\004\317\322\351A\360X\037\206u\340\021\270n\377\365]\357\265$\\\032.\021-\021\255\255\036\370\243\022=N\377db+W\003\213\024\031x\226\356N\223\0278\344:[\303\002\317\212\335\2012\371\240\353\2642\344\346\347\r!\245U\332\240\"\035\235\302BLg\326\020.\021\020TZ\005rg\017x\002\257\326\t\3743\340Y\2727\206q\027<\300\013x\346\345\241\333\005(\340\211L\256>\300{ s9\237\f~\276\307\375\ns\201"
+	.string	"Y[\275z\244/o\210k\332\240)\375\223\333\255\225+\200o7\317\243\304\003\340Y:>\303\270\252$geIVv\\g[\307\352\327\2758\307\177\266\213U\216\353D\306q\322\247\216i\254z\343:[\276\252\267.\211\312\002\201\206\250q0&\225S3#\"\222\244$Ic\321\005\204(\305\330\231\007\021\300(\306$B3c\n\222\244\320\030\326\330\252"
+	.string	"C;\346.\260Q\251\230\226\230\322K\331\263\2141!\371\2778\253\024\335~Xs\314\017\035\275\222\3751\220\006!H#$`\016\340(\370\342"
+	.ascii	"\336\nl\\v\023\217*\332e\302\3665[\370\0041\223\250\251zaJ\202"
+	.ascii	"-U#\264\343_i,&>lC\200\363chD[l\fD\005\305\377\240r\375|\210"
+	.ascii	"So\270\002>:\005:t\370\367\3645\335#\265\322\356_\301\3644}\273"
+	.ascii	"a\031\346\264\327!\324\356G\003$\026#\201n:\315\025Q\236K\323"
+	.ascii	"H\376b\267\231)\235\b5\3557\342\002\267\210\201E.\371\314-\003"
+	.ascii	"\260Nj\207\326\300-\371\234d\203k\272\350\332\322\233 e\021\271"
+	.ascii	"\201.a\253\f\237MB}\354\037\234\nR\374\2163Y\232\330\026l\200"
+	.ascii	"\217\034KJ\366\330\310\361\004f9\345T\271'c\356\321\247J\031"
+	.ascii	"\203\256\375&\337,\n\363g\035{\370e\337\023z\341k\255\355\241"
+	.ascii	"i\336~\213\034:\200\022\356\2022\225(\244"
+	.string	"bM\306\305\361w\337\245\t\214\225\331/\362\315K\301&>\203?\202*\3627\302v\006\rL\027\305sRr\346\324\222w\375k\345\342\035\343\374\372\340\247\220\314g\247/\021<\0334\306`\340\215\356\266`\252\225\216\303\360\032\317#cI0\217\023\343\2217\312\2634\303\263\303\306\375\213\301\345\220\241\330\224\371\265D\bA\212T\362+\305\017\352 \\\326\305\311\"\262\323K\231H\031\037!8\330K\216\024d\351z+q\375\333B\257\301a\261^\333a\033\325\3448\370\022\204L\253\331\337\357\351\301t\032\366\336\241v\215\200(T"
+	.ascii	"\236\341\357m~9(dp`n\340<D\200\324\204q\376`\365\b]+/)H\250j"
+	.ascii	"\200\027\250\2269\276\342,\252\255\342\267\250l}\362&\320A\220"
+	.ascii	"\335\\\226\253F\214#\b\301\323\020\245i*<xf\021\341z\003~\203"
+	.ascii	"\321\363P\034\212\360\231\377#k\253B\366/\343\222\311\225e\270"
+	.ascii	"+\f\322\224\227\375\022\306\205\t\202l\222\005\355q\351\227\234"
+	.ascii	"\270\362'\351\027\215\001\"\340\f\375\360\250\"\371\366\371\034"
+	.ascii	"f\03152p\346\214\033\031\030C\027\304\353\253\355\311ri\255\315"
+	.ascii	"j\333z\013!Pl\206\343\t\347\335R\027r\\\376\21189!\305\343\321"
+	.ascii	" tI\n\307\361\301\023\340\254\301!cI])\316\230\233\340\367\032"
+	.ascii	"\005\355\335\311^\022AKCK5\320J\231A\030nB\233\227*(\240\\\250"
+	.ascii	"\331\336\314<|B\247%H,\376\322"
+	.text
+	.section	.gnu.lto_gpsInitHardware.part.0.166.1e3ebfca832d24ac,"e",@progbits
+	.string	"(\265/\375`\260\001]\017"
+	.string	"&Z^D"
+	.string	"\257(\035?\003\252<\230=\257,\257\037g\177\007\321m\227-$\236\211\004*\265\310\216yC\275\230o\377\253\027\201\206\026\301\003\024\002\003\374\366\277\356\3357\363\346\"T\330\021\270s\227\351\217\326\310&R\246\024G"
+	.string	"O"
+	.string	"H"
+	.string	"v(\364w\016\266M(>\331\261\307\327~\304\212\022\032nw\341\237\276\374\364L\363\235\374\303\216\321r\241\236\201\\\027\256\231\200\227\016\213\220K\225A\034\326I\206k\2259\340\317#\332]\177Rn\355\266\035\330n`\247\202i\325\322\3519\220"
+	.ascii	"\305\356I\267\263,\317&\003\215\311\"\"\225\t+\023\021;\021\303"
+	.ascii	"\355*.\230\271\207\021\213 \210/\013\036\r\030J\250p\273\021"
+	.ascii	"\3769\336\200\366\3679\001\355\357\366=b\242\005\347wx$\271\214"
+	.ascii	"Ueg\303\356\222\244\0173\005\232>\230I\261J\035\007\350\272\256"
+	.ascii	"{IKU\325VT\232\352,y\361\350\321CL\370\354.\003\377\303A|\370"
+	.ascii	"0\177\336B\362\255??D\037\2370/,+0\231Tv5\331Z\215?\213P\351"
+	.ascii	"\"\325\305\372\236\255\266\330Z\226\300\261Q\002\361\200\333"
+	.ascii	"\bR\030E\370\200\034\244\022\334(\340\r\244\203\004+l\033\t\206"
+	.ascii	"l\347\263\325\026CH\311I\251\312&\256\006\013\024S\021\303m<"
+	.ascii	"\354\242,#\375\330\341\221oY\025E\"\366y-\n\200\233\233\234\247"
+	.ascii	"jpLT]\354\227\0022 \200\002\0314e\036GA\317Ex\274lm/\352\306"
+	.ascii	"\330\002^#\234\3402\262\200\201\315\345\350\024\273l\324\031"
+	.ascii	"L lW\2232\210\250\203\244\bB\342h\3770\302\307\363{(qqCT\r\220"
+	.ascii	"\307\305dODu\230\037\016cA\037\n\375\304\315\272\225\365.\255"
+	.ascii	"\303\335'^s\0271p\274\270\207\272\312\364\333\265BH^x\347okO"
+	.ascii	"xc"
+	.text
+	.section	.gnu.lto_GPS_reset_home_position.part.0.169.1e3ebfca832d24ac,"e",@progbits
+	.string	"(\265/\375`\r\003E\025"
+	.string	"&\346\203H\260TN:`\004\\\f\233\022\025\006\325R\322\222\341\037R\\h.\276\001[j\277q\346\224/\311\257Q\371\307\330#\215S\316\225\324\207:\327\2146\250\236\261\373\353\267\364\025\031\272\217\311\321\224\016}Tw\267F6\221;\245j"
+	.string	"i"
+	.string	"s"
+	.string	"W\362\227f\330w\"\333\325\361e#A\f\307O2\372\021\316\221\354\373\376\254\27422\205bkw\027|\032%\366yr\001\341'\370"
+	.ascii	"\341\347}\036\316\246\321>/\3036\256\204s\266\326\217\206v\300"
+	.ascii	"T\213\236\245\256\335\025?u\305sW\t\346\374\363.\033}r\2563\037"
+	.ascii	"\023\227%\007a\022v\3271\240{\336\266\003\333\nlU\0212\b\354"
+	.ascii	"\231G}8\200\265\273\017h\274\006\215O\364i\233\215\374h\243\377"
+	.ascii	"\331Q\025\365t\344O\252\220\025<\270\032d\207\322\263PZ6\245"
+	.ascii	"cS\032\006J\207o\272'(\r\376\351V\225\226*\375\022\271\023\277"
+	.ascii	"vI\374\2766\305\224r\361\247\277\351\322\276\317\364'\037\312"
+	.ascii	"\264%\334\225\336\344;%\341p\336s\203]\017\030\273K\013\347}"
+	.ascii	"\366vUE\275P}\253\373\260\317'r\006G9\n\311\310e\"\247\372M\032"
+	.ascii	"8\310\217\241*\322\316\350\212Gsl\337\217l\001\355:\302\357\307"
+	.ascii	"\304\263\253\203\002\352\324;\035@\225\356\305\216\374Y\025\324"
+	.ascii	"\002U\272.\325C\375e\004\213$\272-\311\340<vt8U\216)\351\325"
+	.ascii	"\273\332N9\016\031\023\b\376\215K\275\300\324\344\307Z\370)\263"
+	.ascii	"F.;\346\276\"^\344\215\007\230\033\350\232\312M\215\214h\233"
+	.ascii	"\021A\314\300\320\210\265\333\215\250bb[M\314M\fa\263\335D\232"
+	.ascii	"myp5\310\262\335\357JGw\254\007U\205l\317T\3537\020\312t\246"
+	.ascii	"\357\001:\221\027\311\361rF++\341\247L7\354\254\274N\304\324"
+	.ascii	"\037r\254\226\t,,#\327\354\004B\230\306T\263t1v(\\H\213X\341"
+	.ascii	"A,\244\f\3758\220\013\030\\\\\302O\230\006D\250a0\347\fC\b\t"
+	.ascii	"\021)LQZ8\220\002\231\271\234\007\021\320\271\272Q\030%\313\032"
+	.ascii	"\252\023\003\035\b\3305\033\r\253\315%\210\226\307\334\303l?"
+	.ascii	"\004\201j\253D6\035\006\007YmN;\352\300\0277\001\256d\346KI\341"
+	.ascii	"\377M\354I\352j2\310\267^R\260 9\354\264\346S}\330u\027xq+\032"
+	.ascii	"\005\310\020\016\246\212\241\354s\364'[r\032\032\221\224*4p#"
+	.ascii	"\245\236[\333\206/(L\345\005\nD\320\265\bT\342X\337\366\027@"
+	.ascii	"\376\321S\237\345\335\306\017"
+	.text
+	.section	.gnu.lto_GPS_calculateDistanceAndDirectionToHome.part.0.170.1e3ebfca832d24ac,"e",@progbits
+	.string	"(\265/\375`\211\002e\022"
+	.string	"v\340qF\320\362&\035B\024G\317\224\221\250z9\312\242\207[\035T ;\242Bgx\274\221I-\356\026\2734\316\007\233\217\230\375\f\347\260\374\254\035\360$\372\344\261\3603:\002\275\301\017\341"
+	.string	"\260o\267\207\3505F\366\2262\245X"
+	.string	"Z"
+	.string	"f"
+	.ascii	"_A\373\221\367\345\260\327\371\261MQ\355\356\224<:\301\352\221"
+	.ascii	"\344\005\270G\370\001\334\213\356\027\325\330,\326\343\211l\327"
+	.ascii	"\354\230f\377\270Q\320\036\260\365\310I\022\262\273\335\243\216"
+	.ascii	"8\355\232\220\346\177<6\327\027=?\236\016O\001\207#\017v\327"
+	.ascii	"+\017w\274\355\023\333%\266\"\b\377\036}\030.&\226\377\374\245"
+	.ascii	"\247\317\007\"\250\365Q\233T +<\\\375\261G\322\034\227\216\\"
+	.ascii	"\032\306\264\302t\302\364\003\244\020\n\212\335\r\267\252\r\021"
+	.ascii	"\237J\\\351\257=\355\373*\236\302G\372\222YJI3\247\244Y\220\315"
+	.ascii	"\007\325\256\223\202\325c\255\346G\236I2\030-\317\216Q\252\252"
+	.ascii	"Q9E\274\3433\356\232z\r'p\362f=\b\241 Czn\362f\003y\246#\261"
+	.ascii	",QX\235\351P\013n\303"
+	.string	"\373\215\0324l\362\031\336\233\030\330.\243\202\205\225\374\267\302\305\270\360'\317\201\024\214W\003)\2473\275\211\005\200\324\356\315?\273\345/\274\226]w\3612\t\332\335\023\026o\361\342\017=\032\006\223\001430\027(\203\271\250]\255\031\231\227.\006\3530\300Zb:\227l\246k\021pL\346%\353hb1Y\307\262\235\367\257C\202\b\216\033\305\261\252\002\331\366j3\270+\002\205\352(o\346\324\217:\017\b\021RR\242r\252S\266qPc\355\260\312D\217\252\237\343:$\370C\236\240\242\302=\376\003\222\001= \260\002!\253\332\0060\202/\343\026\313\340\321\035\326\270\342YP\262\337\342\231u\303\207\002Q\316A\270\203\203\2121\315i\234([\320\326\006\257r8\272\231\251\231\223\225\020\271sk\355\302\222\377\243\331\003\277\354\206\357\354\306\372\245\215\374l\260\027\255e\2777(\2746A\221fZAF\013\026\331"
+	.string	"\340\0364\002\264\333j\016\346\202\023\310c\003O\216\027\365P\254\262\375\326\257"
+	.ascii	",\2369:~\347\265t\f"
+	.text
+	.section	.gnu.lto_onGpsNewData.part.0.173.1e3ebfca832d24ac,"e",@progbits
+	.string	"(\265/\375`\034\n\0056"
+	.ascii	":\\\f\024D`^R\007;'\323\362N1\333=b\352\260T8O:V\t\216\217\301"
+	.ascii	"\020B\246\b\264\212\217\250\355X\204\373\302+)\317!I\016q\374"
+	.ascii	"\022\307\342\224\034\363\035'\316R\320\302\342\3760J+\261[\356"
+	.ascii	"\224R\n3\001\r\001=\001\334a\326ZJ\206l\f\257=\371\332\026\215"
+	.ascii	"\334\030"
+	.string	"\003\275\276jdbxm\310X\244=\220#I\032f\201\036ZG\271\323\030\bF\006?m\235\265Ke\227\366\302\366\027f\353\266\253\355\032~\332\320\344i\333\326@_\216\352\365}j\342\332W\355\242\265\241Zz\313\213\216\262\20218?/\270\263\364Y\214\216\362\217L\214\225\266mc\250\334P\031\314@`\3376cf\031Jf\231\357\364\031X\233\324V\306\205\346\247m[\252\276\277\204\275\325\263\346\240\263M4$$\f\n\002\177\276\036o\275\352\373\220\345\236\321Da=$\004\326BU*\017\031>\375\246$\242\022w4I\366YC=\225M\017R\211bO(\375\246\374R\245\330\304\254\035=\250\244kH\003\241~<\tG\272\274\332\327oJ!\375T\006\361\336\323S\311t\236*\325d\323\243\337\224^*\021\016\222:\235\326~c\311\345\253'\227?\372\376\226?ZU\013\324\345\221\n\2274T$\032;\232"
+	.string	"\227[\376\235\326\034\332\320\3509\3225\244}\330C\236\204\266m\271\215b\315E\315\334\r\230y\212\3317\026\315%\356\215\025\20487\275g \327j\314\2508\271\357\344\017\355V\\\300\034\242\331X!"
+	.ascii	"k\333\226\201\232^s\305M\326\227I\224(\261\366\345\275/\372\315"
+	.ascii	"uz\250\244\251\357d\003\275~\247\365\224\264\315\234-r[^\307"
+	.ascii	"\337\316FV\207\356\337\311\314\367\321tr\252\376}\337s\233\331"
+	.ascii	"\326\177\365\257\035Rz\240\375\377\033\331<\372\035\367\3737"
+	.ascii	"W n3\315f\202\233\214\261Nx'\373r\237X\373\3667\264\257\224\261"
+	.ascii	"9tL\243\337\371;\371\207\335bex\324\340O\302\254:\017P\235\243"
+	.ascii	"|\316\002\232L3T\317\371\311\347\354\344s\016\320sn\35293\365"
+	.ascii	"\234\001,]g\245\353\234\264:#\361\234\217\2563\361:\033]\347"
+	.ascii	"\242\353<\274\316D\327y\350:\013\255\316\302\353\034t\235\203"
+	.ascii	"\327\031x\235\177\327\331w\235{\327\231\327`\232W\325\371^g\365"
+	.ascii	":\377uv\325\271\0378\231\024\226\266\335q\007\250-r\245N\032"
+	.ascii	"L7\231n\265~\346\016\314\037\\G\321\311sX59\016\025.95\372\335"
+	.ascii	"\001O\026{6\222\276\315\214\365\241\223\032\215\246m\230\357"
+	.ascii	"jqc\346\340(\347J\357\235\314\223\323U+\322\367\221-nw\201\272"
+	.ascii	"j\025>\322\0279\243x\220\315#\317q}\231\343\275\223=\355OS\345"
+	.ascii	"\275\357o0\263S\326\243\327b?\372\026;\205\255\302\226y'\331"
+	.ascii	"\262\265\357\321\203\030\343S\306$\372\214\342\221\267\032X3"
+	.ascii	"8\243'\036\331%\247\306\2427zv\344\2233=\374\242_\202\213\272"
+	.ascii	"A^\031~\240\"R\234\035\321\007\177\370Bh\3216d3\370\177\212L"
+	.ascii	"u,\224H\207D#\272\226\234\016\275\320\023\375\357A>9\266\350"
+	.ascii	">\305\005|X\350\324\\\357a\263L\240@a\355;\364\013\344\246\305"
+	.ascii	"\236\036\r\025:\b\275\210\261\2712\251\020O\025\021\314N\337"
+	.ascii	"\261p\001\003\2065\350\205\377b\324\224\301\017z%6\344\025\340"
+	.ascii	"\373>\370\327\r\331\214\361U\346\367\300wB\203\366A>\177rEb\\"
+	.ascii	"\206g{c\322\372\376\367Gp\3206\344\025\3373\263V\303\025\215"
+	.ascii	"\342\332\266m\300\035\247\345h\330\320\301;\331a\355\313\024"
+	.ascii	"V\267\276\223=4\234bWV>\302\312W`\271\270R\231\004\202\025*L"
+	.ascii	"PeaQ\245\300\272BAEBk\005\025\002#\316RQB\213\212EV\226\026\025"
+	.ascii	"\260%\030\377H\364N\346"
+	.string	"\3453\232\200G\330\263l\350\235\254\217\225\035\212?Y\037@\330 A\326\2760\304\354\374\314U\255\354L\274I\225\027\373\365\265\366u!fge\3168\025\2333\023J\340\334g\254\021\026\211w\222\277\001XSM\330\264\016\350\275u7\255Q?\340\331\271\230G\0073\341<\021\365}\326\252\032\261=t\002^IC\273s\3101\035\352\005|\223\033r\016\t\324\267\264\257\224,L\031\363\351\215\270[r\372\364.\367\374rz\366/o\362\332\022V\363N\262\232[rj\\\353\243\r\2577m\313\021\356\356\356l\265\2551*\300;=\233>\300\267\035d\036\246\007\360M\337\310'G\017\342B\330\2601\226\t\223w\nc\026pf\026\n\033\305;\t`(\367\364zs\374\031\374A\357d\037\035\340\322?\035\277\261~\363\331BGm\333\266\r\276\263\327_\372\"4\250\027d\363\bTzf\017\356\243\007\217)_*\225"
+	.string	"\021X\312Y\376\222>\200\334\250q0\347\024C\246\204d\244\240 \005Ic\200\002\021\"+\326\001\021P=e\246I\322\312vn"
+	.string	"u\360\026\234\f\001w\324\374\236~\277\006\3602\254\341\203\207@\317\377L\200(\232\032\326\3628\035\001\333\2701@t\242\021A\210\030@\256\244\344Jt=\251\347\227\356\333\t\377\264\300\373v\322}\016\325E{\026\346L\026\032\354Z\246\335\365\367\020<D\213\217\245k\bC&\374\027\222cH\265I\376f\310\224\206\035D\253\357O/ \0015\342\035\311A\232\304\227 \206\2640\230<nX\235\fB\324\210\355\024\365>\257\245\024R${\266C(8\26478\233\255}\355\002\312\027t\204\255\0265\353z\206\"\302\223!`\r\251\332\2034\215\373\365\300\272\214\007LG\310\234+\351\035\366.*\351h\023\t/3\203c\346\373$\2243\233\230\t\334\3433 \253z\351G\302`1\202b"
+	.string	"\027\346\354\370\304\313\347\251\262wQ\033\bs\025C\031\037\250\312\353\n\016<\\\013r\021q\030{\256\254\037b\231Et\317\273\236c\006\b\331"
+	.ascii	"I\362\315\"\3408\350\356'1f\274\302\336\341\006\375\030Ie)\245"
+	.ascii	"\300\330\3211?{F+9\024\202,\200\374yDdZ\002gjB\304\rl\311@-P"
+	.ascii	"\325I\333*g\227I\241\b\325\204\201\315\330\333\370Hz\225#\013"
+	.ascii	"\313\203\272\023\377\034\230\353\210\240\200\307$;\363b\304l"
+	.ascii	"\273?>\313d\366\313\314\366\254S&0L@R\251\017\203\006\362\300"
+	.ascii	"\b \375\223\220\250y\346\253Q\013Y,\325\253.D9g4~\"\312\346["
+	.ascii	"\236\336<Sp\032"
+	.text
+	.section	.gnu.lto_gpsNewData.part.0.174.1e3ebfca832d24ac,"e",@progbits
+	.string	"(\265/\375`\325\001\345\017"
+	.string	"\266\234eF\360\260(\035\260\276c\300\035\325,\255%w\362\367\373Z\337\177\267\006R\322+\033U\2529\340\241\324j~\257\376\353e\344\2570\255\032\341Q\370:\031<\021\357\360p\271\200\243\262\005R0\0227w\204F\266$R\246\024Q"
+	.string	"O"
+	.string	"P"
+	.ascii	"\004\340W\364}\n\333+\017f\3315>k\211\334\313\317\006\232\034"
+	.ascii	"1\306\356\253&\316:\334M\223c\371\255C\020\337\364`\261o\035"
+	.ascii	"\260\330uc\260\022\343\303\b\366\332<xH\3148\355\311\001\346"
+	.ascii	"\312\034p\216\013\2111:\244r\207n\273\202\355\004vB\bz\332"
+	.string	"7\3047\343\023\223\222A\2512+\367-j\t{\323\272\245sK\037@~\n\200b\354\020\004\024YV\347\3452\267\017\263\362i\026\311\254>C\371\020\321\340kM\3731W\301\372\f\305\033#\213\215\213\030g\016\276F\020\372\006\270\007\374\346\003w\361\204\221\021\370U\025\371j|>\001\371\361\023\264)\220\344=/\350Q\251\275\264\345T\234\033\234Q\332%&y/Uwzb5\227\266|\265M\2679\215ZZ(\r\317\206}\3415\247P\214\361\201?s\032\224\357\362u\006U\336\373\372*\370}\245\273\004\242:1\351P\246\016\203\211\344\324\225R\252\016\244\200Q'%\251N\003\n\225\352D\266\363!)\352\202\006\322\216 \001\246\346\322\226uU\366\342;\007n\276\314\301\3013bS\031\t\302\020\371X\240\270\241\377\to\245\246*\263O\202\252\026V\310x\345\217\375\234\353\220\034, \220\202\231\302\35202\230"
+	.string	"\211\003MW\370-+\032F\253\031\005\026\2606w\216\214\257n\257\"\213u\360\226\220\021;\\\314\211"
+	.string	"\303gV4N\235\t4\262\204H\t\021+\203<edns\312\222\021o-e\314~Z\341~\225\002q\312"
+	.ascii	"\215)K\006\006\266\327\272\221q\343\216\345um<\301\340\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.1e3ebfca832d24ac,"e",@progbits
+	.string	"(\265/\375`\245\n='"
+	.string	"\266\375\336?0dN:V|a\252\262\355\033:y\336\353\304\"\353\223a\024\372\226\366SQ,\214:!\001b\005\344cmL\243\006.\310\335\313\377!\266\330\322Q\252\201H4\316\001\344?7$\177\023\231\002\323"
+	.string	"\314"
+	.string	"\316"
+	.string	"\201\224\344\307Q\177L\002\001I\257q-X\217\344\356\242\032\311}\247\026\361\"\242aH\327*\344n\314r\333\251e[d\177\264\006\341\232b\333\326\005\222[\213\212\331\037\355d\254\323|4Z\217>\273j\227G3\331\321\255\216>\276\225\326\330\034\371\177\252\030\025\216\246\262\376\030vC`=\345\306\003\033\r\307\304\262,\373\225\277H\255a\301\202\202\365G\032_\316\270\037\031\357\023\343y`\374\371\342\200\\\\O\213\357i\301>n{,\362\245\352\n,\025\031R\030Qh\235\300`\342B\211\013\"\361@S#^I\304\377\254?jU\b\361A \316g\305\177\273\354\007\342\252\332!\034\364\305C~t\310\266-\273\367\347\277\257\255\253\370\204\201\323!\337\216\372?"
+	.string	"]\027\374\222\357\310K\356(\312\374I]\362%%\363#\341\345C\272\313o\304%\177\260Y\226\375\02342w\223\266S\353\246\350\034\314\375]\177#dfe:\304\266\234\271\376_f_`faead4\304\200\\\275\335\263\226\373\233\270\337\321rg\226\343\301\322\354J\0257'\330W\362\373\254d\255Ur\347\251M\245\335V\214&\250\222\\O\311g\004\227\257H}k)R\252\334\212m\021\330$\254Q\2102\001\312\325\212\331~b\245\274\363\226\326j\271\301\250N\032\254\235\306"
+	.string	"-\267\262I~\242\263|Dn\376\241\245\036V>\241f\222_H+Y\030\330m>\364\230\3577\251\331|:x:\235Ns\376\234%\371r\324\226U\303\365\247.\310\276"
+	.string	"\355\343\345\211\214\270\211\331ka\363\314\021\031q\223\253\310\210\207Li\324\210\333\375\"\343\241,\334\320\356\266\231'\315\n\013\267\333$\225\026\261\023\241\"\016\340\n`6\001\266<\265\027*\342'\267"
+	.string	"\263\273\210\243\220\335R\310\256\222\363\003g\203)&m"
+	.string	"u\356\340\215!{\270\207E\314\r\0251\031\263\017\334-\361\036-\342\241\013\265\302Ci3\261Q+\334v]\327v\037-\2319\021\017){\177@\307\332fB#\364;\021\357\020{\211\030\201\324"
+	.string	"\362\203\210\230\f\332*\240c\226\036\200\327\344\027\252\311\247\264\227oI/\377R\232\374)\232\334ogr\263\231\311\335V&\267\032\231\334O\306\344\206\"&\2370L>`^~ \230\0347\200l\252\270\271\301\023\376\211\243\2208y\b\356\220\376\304PO\002\230\217\376\211\233\240\355\204\226\214\343\212\364'\036\266\335\213\226mqw\276]\177\342\250\2427\316%\375\211\301\242w\342F\016\336\211\207\357\337\235\330\351m\376\017;\3255\001%\2311Y\377\303\3352o\007\027@FE\337\304R\320\326J\312\365\235\371J\275\211\021H/\370&&\362\235\211\235\034\235\01771\037\235\357\3166z\311\254\277\270\357\246\220n\n\347\316/\361\206\256/\001\275\360\020\331\235,\f\364{#/\f\306!\320\013\017\353\006\020\273p\277[\255\304\243|bq\341n\267\024\2670\207\306g\264\205\373\315\200\241\244\035\001\220\r \224\333"
+	.string	"\006\345\332<\005\200\307\250Q\020\013k\247D\206$)L\007\300\002)\032\242\346\021\260\224\303\320\220\004\"\"\"\"2\322\003\027\2600\370\363\200\344>\333\323\023>++\324\346EHn\033T"
+	.string	"\327y\336W\372e\177l\270\024\020'\260\\\024\034\025\025\374\356\004\360%\361\260\332\243G\2250\212X,\376\236\242-\203\211\031*\361\"T7\t\243\355\264\254\361\272h\222\247\253\027oapUh\303\302\270$\353\234\221\336\233"
+	.ascii	"Jm\232lWR\324\206\244V\023\374\nE3\261\252^\312F2\334\204\227"
+	.ascii	"\030\341\265\256\243\367\235\233\240U\202\250\217\311\350\343"
+	.ascii	"\224\370Z\214>N\211\257\305\350\343\224\370Z<\002|J\306\363\222"
+	.ascii	"\315\321\005\245\001\377l\t\0302\333\177IeX0\310\314(\016\017"
+	.ascii	"x\313\265z\027\337{\006^\304\0050\217\002\255\217F/\256\242H"
+	.ascii	"\036\3310\0130<7f\021\263\332\374lm\306\206\332\332x8\336\226"
+	.ascii	"o\227\340\222\334n\030\237\204\201\361N\240\034O\355\021\274"
+	.ascii	"\036\337\026\nV\327\026\313\004\320L\314\356\226\354 g(\017p"
+	.ascii	"F\320\213\304\270\230\016L\002\372\2444\310\241o\273|n\326\313"
+	.ascii	"\372\350\325\267\333\272\327LX\255\233z\rp[%\373\320xl\027n\265"
+	.ascii	"^x\r\262E1\357\032\224\221\264\337\221-\357@;)mR\035\311\001"
+	.ascii	"<\r\234*"
+	.text
+	.section	.gnu.lto_.refs.1e3ebfca832d24ac,"e",@progbits
+	.string	"(\265/\375`!\006\035\""
+	.string	"\212Xh\016J\300\222Q\322\001(\nY(\225\302"
+	.string	"T51\027\263\261\226"
+	.string	"\204\336u\023\032\202\200\207\210\372\200H\003\211"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\320\354"
+	.string	"\220\262\305\306\314\354\354\f\245\231>d\305\237\220\277\301\260\203\237\370\3213\036\241}6\333d\n\320"
+	.string	"\326"
+	.string	"\326"
+	.ascii	")?\340\325{^\317\343\352:\256\307au\233\224.\240\325s\260\036"
+	.ascii	"\302~\346\325e^\177su\320\3655V\237\301:\314\253\273\274\276"
+	.ascii	"\305\325Y\\\277\302\352\261R\317W\207\275\376\345\352(\256o\261"
+	.ascii	"\372\311\253\257\\\335\004\245\253X\235\204\325S\254\376\261"
+	.ascii	"\272\251\325\313\372d'\326u}\037=N\375\035\250?\307\351\307\261"
+	.ascii	"\352#\255~\032\251?\206I\377\b\206\252oTT\322'zA\322w1$\224\352"
+	.ascii	"\007y\277\nT?E\354\004\274\377\211\335\307\373\235\330u\274\317"
+	.ascii	"\211\035\307\373\233\257\013\370>g\3528\357e\274\007\277N\373"
+	.ascii	">\306\324[\274_\361>O=\345\353\257\357]_o}\177b\372U\354%\336"
+	.ascii	"\223\304\236\362\036\025\373\311\373R\351\333]\233\377d\001\267"
+	.ascii	"\302\352KA\325;\301\244W\002\330\335\b%\275\020\216\030\221\371"
+	.ascii	"\213\020\031\"\323\027\222\344\203\307\r\0322\216n}#\260{\242"
+	.ascii	"\257\305\327g\361\375A\340\017t\273}\001\360\177n\335\007\354"
+	.ascii	"\346\271u\235\333\343\200os\3535`7"
+	.string	"\316\3663\266.\003\276\r\374\032\3703\360al\335\005|\031\370+\340\307\300O\261\365\027\370(\340\263\300_\201\257\002\277\304\326S\263G\201\375\243}\254u\217\326K\263\306\234\264\255\245\203\361k-\235\026\177\306\322c^:\314K\177\201\351+/\037\203\351\256\2277iyU|\224\313\233Z>\306/\311\276,\257\264>\311G\353\357\241\242\362\353\300\201\324\3755^\277\214X?F\254(\373/\362w\321\352\017\271~\026,V\037\b\226\322G\341\365\237%;=\245\323\275\234^\212\337\345\364\306qPw\371M?\b\220\244\037=xd\216\0336lri\024\376D\002\206R(\373A@)\302/P\363?\371>\371=\331w\362u\262\347d\277\311n\223\275&\367\001\262\207\331q\331g\262\313\204\177\243y\020\367\264\374\230\3540\331]\262\267d\227e_\311\217\205\237\270\207\345\243\204\337\242y\223p\022\334\243\362c~\363"
+	.string	"<\253\262\227dOeGe\377\3027\321\274\207\373.\2379\335\244\036;t\200\2758l\320\2764\216`\030\025\021\265\030b!\024\264\002(\366\252\270}O|_\023\266o\t\225^\022*\337\021\335WD\b\020\340\367C\254\327C\354\333\001\300\227C\255wC\355\253\001@o\006Z/\206Y\357\205\331\327\302\252\001\257\243\233G\227\353\036\224\356\031\251\353\304\267\031\311\226}\366\362u\331\367,\261\257d\217e]\271\316\312/\311G\205_r\020\033u\272F\215\367n`\232\344\373\324\327M\317\230A\334\264\2404\317\316\315\3676\262^#\373\334G=\224u"
+	.ascii	"\037}-v\332,\366\230\215^6\214g\331\250\347D\035vQw]\364(\023"
+	.ascii	"}\353\027]\265\213Nr\213\216\212\177\212oz\250\367\241\025\304"
+	.ascii	"F-\324\343A\315\271\261K`B\320\275\370\375>\320\035]j\240\223"
+	.ascii	"\214\242;\025\276\027^\300\373\351\315=\2407\334\347\236.\223"
+	.ascii	"\375\226\035\314^\313\036\023v\027\232\227\341\316\334\277p\217"
+	.ascii	"\222\337\312~r\312n\312\036\263{\261\356R\366.{\263<\260W_W}"
+	.ascii	"\037\\\250adE\020A\022#\022\bIP I\033\260\002\251\231\251y\020"
+	.ascii	"\330\222\264o\221(\2303\215Si\2143\255\272\353\003\f\334F[O\021"
+	.ascii	"`]\206M\333\024j&\365[g4q0h\331\304\344I\n_\250\334U\2277o\177"
+	.ascii	">X\314\272'\347\\l\207\021\353\302Dc(\203 \331L\006i\t/f\200"
+	.ascii	"\224\n\240~G\327\202\262\204<ao\036a&Q\004\254\226%\324\251\306"
+	.ascii	"J\363.\202\374\207\244\263\324\0306F\351\331rK]\210\032\374\340"
+	.ascii	"\265_s\303\317@\270\013\030\203\372Ae\327\034\260\242\240S\340"
+	.ascii	"h\025"
+	.text
+	.section	.gnu.lto_.decls.1e3ebfca832d24ac,"e",@progbits
+	.ascii	"(\265/\375`\277p5\331\001:\027/\253V LI:\215\001~\231\021Ut\264"
+	.ascii	"+qe\021%P\001\021PUqd\243kbF\304lS\022\002QU\025\021U\2552{p"
+	.ascii	"a\002\236\210(8Zc\233Bv\273R\037}\251M\375\277\022\033}\340!"
+	.ascii	"7\352E\231/KR\262\357\230\245U\325&\367\336RJ\231\002#\t\252"
+	.ascii	"\n\004\013`\356\363\206\261\315\273\367_-\027/\351\372\200\243"
+	.ascii	"\n\262\223\217\006\321Gq\350\2435\364\321%\375\354\247\237\363"
+	.ascii	"\364\263\235\266v\266'\365`y\322{\347\243\n\371\022\303\357\346"
+	.ascii	"\347'\3726\256\nS\331\024\2471\0276\213X\240\334\322\245\"w\207"
+	.ascii	"4\311]+Os\027\313\245\273Y\256\335\275r\353l\023\306\215k\262"
+	.ascii	"\367\006\001\302\247fL3\317m'?\263\351\347\"\232\204\355I\237"
+	.ascii	"q\350g,m\267\355Io\024\27553<n~v\322\277G\306\260\212\360pr\333"
+	.ascii	"n\223\213\344\256]\265\233v\231\334'\327\355&\271K.\224{v\225"
+	.ascii	"\\\264\313f\233=\256\017#;\202\b\t\273@\256S\354\271\267\263"
+	.ascii	"j\210\020\346\205\001\326\343\371f\263\314x\356\355\374\021\263"
+	.ascii	"\361\274U1\200\224\325\200\021v\243\352\355\022\t\342\365\203"
+	.ascii	"\371e\377|0\353\336\256\031\215\333|\273dW\314\275\235 ,\027"
+	.ascii	"\024\234X\007\371\271\205>\006\324\307}\372\030\214\376\333\f"
+	.ascii	"\372TlOzL\247\217\245\350c7}|D\037\367\320\3074\3641\223\376"
+	.ascii	"\005\324\277g\364\237\266'\375\335\323\357\263=)\b\226'\375\325"
+	.ascii	"\242q\226\355IE\260<\351\335q\305\360\205}\335\374+E\337\232"
+	.ascii	"\241\261\366\337\033\227\353\332\270Zw\353\352\270Y\027\307\355"
+	.ascii	"\262\315\233\343\277S\227\352\307f!\253\273*{\232\211\321\004"
+	.ascii	"\306\f\213\267\344\302\260b{\3260{\356\275\037\302\177\253\260"
+	.ascii	"\234</\214\034W\206\375#3\306\344\271\367\276RN^\3408\344_$\372"
+	.ascii	"w"
+	.string	"L\377\022\321\277<\364o\226\376\225\241\177\235\364-\240\336\261<\251\006|\372f\331\236\264\003\313\223\336(\234+\"E\330n\276\315\323L\226\212\235#\301\264\355\356\033\003\363\244\273\262\307d\355T\220\031\373\362d\262Y,\036\t\252m\227\372\306\274<\257\213\013u\237\256\323m\262\315\313\364\3337\373\204\311\346\335%\022T;\370\034\353{\356\275A\324\214\271\032\223r\223\177\313\305F\261p\267\305\315\322\261\201\207\327\342\346\253\344Sc\226\207d\306\315\267o\372\226\016\314\225\020\312T\251{\322\3756\360./\213\213d\323\334m\001o\222m\336\243\337\362Y3\317\316\275\223\342\356\221\325\263{\326nG\tcuS\306\310\331\262\377\347\367\310\366\331?k\267\206\302\330\026\346\336\3736\214\030\333f\355\254\02606\307\334\333\371\021\376\237\177\304\b\367\310\222\261m$\224\366n\036\301\"\001\r\220\211Y\337\336N\020 @\370\200"
+	.string	"\001\002\004\b\273d\362v\264!\3333\026\215m>\316\372\361\230\262\344q\363\255\016\255b\357\275\355\343R\365q\351\255\226\276\235\355Io,Oz\213\245o\255\364-\225\276e\322>\266'\275U\322\267Km\273X/\266\331\301~\331:V\314\016\244\251\233\277B\233`o\333!\265\201\201\266Cz\245\266[~n\271\244i\3164\255\335\254cy\322\027\265\275\2633\330\346\007\253\345\026\213\255{0\311\271\325\366v\352\004\361\306`\255\335| }\373!\325\t\f\f\f\264\037\322\177@g\313\223^\003Z\003\333\223\236\005\375\301\366\244\266\212\265b\233\036X\271[)v\312\321#\347v\356\355\324\271>"
+	.ascii	"\227\244\335\374\023\364\255\007)\016\f\264\036\244G\200\336"
+	.ascii	"\261=\351\265<)\b\266'\275\331\266'\265\316\021\372\306\256\261"
+	.ascii	"\335\272\3756\211Ub\333@\260w\322\336\273\202\340\031\265(.n"
+	.ascii	"\266Ll\023\333\304\300:q\352\340\244\021K\343w\363A\350[\fR\033"
+	.ascii	"h1H\355\222\237[6\236T\312\312\271\327\366\336::ucdx7\337)\226"
+	.ascii	"'}\007\272\307i{\322K\305\362\244\277E\202\201\2163\306\023\216"
+	.ascii	"\233\177\253\226\206S#\311\226\227\233o\2336\355\267d\266\314"
+	.string	"\242\341%\247\254\275\266\267S\003\004\212\324\350r\263u\332\263[4k\366\021#\034/\321vs\357m\321D\310\332\373\310\242\351\374\355}\244c\355\006\326n\220\217p\taK\3633\320w\332\236T[\236\324\006m\217\360\253\215wrO\360\202\327\265\334\203\034vR1\270{W\355Z\356\021>A>r\227\376\353\342\307#\300+.\322\217c\300F8i\231\260\b\\hz\001\037O\342O\353\360\211\377\036\271\260LY\354\005-B\030\374\251\033F\341\202\340\016\375w\370\343\007\34405$\367\363i\3009\370\323\022\340\016\b0\312F\360\b\271\310\177\025\200Ed\260?\243_?6@\366b\346g\"y\310o\305\260_f\376\230L\026b\004\314\342\260Wp\337\177;\300h\376\034\344Z<H+\200\273\344\035\267\003\013:\370\323\021\374~\253\006\346\307G\334\002\033\351\376\033h\2250Y\265\337\"\271\037\231\373\270p\305"
+	.ascii	"\336\202\037\245\373\377%\353\300\304/\371\3519\177\352\344\317"
+	.ascii	"+\344\350\372s\211\213\346\036"
+	.string	"\274\200\201R%\r\200q'\230\001#\310A\034\367\273\372\247`\177f\300\177\273\266\270\376l\302\326\1777\340\013h]\364\277\035\274\347O\201`'-\364\204\377\212\345\254#\033fc\370\337v\271|\343\277eW\356h\036\252\200\370Q\257#{\017\370?\213\177\233\376V\377V\265\371\255\212\337\352\374w\r\003\r~;\202\337~\370m\325oQ\260-\374\266\204\337V\340\2672\374\326\304o=\360[\341oW\374\026\310I\004\306\337\2728\332\022\3746\305oI`MP\366\263\001\240\035\221\300\217\032\375\367pOp\364Oo\374\326\352\267/~\353\364[\030\026\352vy\332\215{\263YV\313J\371m\224\337N\261O\376[$\333\260p\277\215\303:\177\306\3721^\276\372-\223{\202\016\374\037\300=\330\\\253\\\343N\316,\026j\200?[\375?\273\007G\323\202\036o\225\013#\307\370/\211\2379\261XS?\236\2213"
+	.string	"\203\003\030\314U\2630\376\273#W\375\226\210X~a\277\020\220=@\365\343\247<\365_*Y\352\317\303(\017\234\376\274\374\261\214\377F\275\204_%\300\217=H\300%A\302o\3764\371!\223"
+	.string	"e\261\260\007\024\370\357\227\374\364[\260\314\364\337\303m\3764\204\037w\220+p\361_\025\377=\376X\203\037o\220\227.\021\f\342*\377;\002\\"
+	.ascii	"\214An\361g\034\245?\003\340\2775X\374\226\310o\307~\233\343"
+	.ascii	"\267E~\374\314I\2775\362[\260?\203\360\3333\244\337~\3756\314"
+	.ascii	"\212] \371\210\350/\374\367\360\337\203?/\325\233\360\247O\377"
+	.ascii	"e\300\177\023\360_\005\374\267\001?\036\362_\022>\374\367\203"
+	.ascii	"\377\301_]\177\034\367c*?\236\362c\270\037C\371\261\224\037["
+	.ascii	"\3711\210,\303\217\315~\374\344\307ny\305\177\235_5\362\343\021"
+	.ascii	"\376\373\302\1771\360c\021\376;\342\277&\376\247\177J\364c\003"
+	.ascii	"\244\036\3701\006\177V\361\347\030\316\376\234\3743\362\317\306"
+	.ascii	"?\023\375\026\357\267Y~\253\345\2673\374\330\303\237C\360g\342"
+	.ascii	"\237\327?\007\375\337\360\247\f@\003\177\253\344\277\375U\263"
+	.ascii	"\377b\375\376\350\212?\237\370\363\007\376\314\201?k\340\317"
+	.ascii	"/\374\331\002\177.\361g\t\374\031\002\177>\341\317\r\370\363"
+	.ascii	"\001\376\374"
+	.ascii	"\363\347\f\376\354\363\347\234?\327\3749\375\263\375\361\337"
+	.ascii	"\217\313\3748\314\217\275\3748\357\307w?\306\362\343\272\037"
+	.ascii	"\323\375X\356\307D~\274\365\343\033?\276\372\361\214\037W\375"
+	.ascii	"X\352\307P?n\361c\343\217Q\374\230\305\217\217~\\\202\037\217"
+	.ascii	"\340\307+~\034\303\217\215~\234\374\261\b~|\3741\f?&\376X\350"
+	.ascii	"\307@?f\300\2179\360c\f\374\230\002?V\341\307\b\370\261\007"
+	.string	"?\356\360\343\b\374\030\205\037\233\360\343\006\3748\001?&\341\307#~\034\342\307 ~\374\341\307\035\374\230\203\037\003\340\307\026\374\230\202\037\363\374x\347\3076?\326?F\177|\377\033\343\277\201\377\005\374/\232\377\232\371/\231\377\212\371\357\336\177\273\374\227\313\177\363\376\253\345\277w\377\305\362\337\272\377\322\375W\356\277U\376\033\367_(\377}\373o\333\177\233\374\227\355\277k\377M\362_\265\377\242\375\327\371\337\262\3776\377{\344\277F\376\177q\341\277\352\177\003\360_\"\377\035\301\177\207\374\227\371_!\377\005\362_\037\277u\361[\246\337R\375\227\307o\241\376\333\365\337\255\377j\375\027\353\277\370\267d\376[\343\277\226\377Z\3757\352\377\331\177'\377\375\376\373\364_\247\3772\3757\351\277G\377]\376\267\203\377\356\377\236\340\277&\370o\t\376K\202\377\022\377\313\201\377N\340\277\022\370/\004\376\353\200\377\022\340\277\036\374w"
+	.string	"\377\025\300o\275\374V\357\267T~\333\344\267k\277M\362[$\377[\370-\332o\233\277\335\372\255\326oo\374\226\306og\3747\361[\023\374W\373\237\366\037\355\177\363\277\334\177\001\004\006\006\006\376\032\376k\370\371)`\202;*\345rB\345\003\334\345H\016\300\233\277\363bm\r\333\260\316\035\305"
+	.ascii	"\272&\276\260\235\245$I\254\240QS\263m%Xe-\305h@6$\r\231\276"
+	.ascii	"\275\251|\200n\361\231\021\273\371:nhh\330\206\317^\206\001\201"
+	.ascii	"\254-\211\376Qg\023u^@\025\234{ycf\325\304\327\247S\246\177\264"
+	.ascii	"\254\211\226\3316\237\275\024\243\001\031[\021}+f\321f\323\246"
+	.ascii	"\37187\225\232\006\345\374\340:]bb\350\021\263\037/s\364Hp\210"
+	.ascii	"\027\227\323\315\327\201\241\277\276P#b:\360b+r\324\310?b\004"
+	.ascii	"\213\227\226q\345\351\270\031\005\263i\377\203\371\214\214)2"
+	.ascii	":.\256\214#a\300n\266RYWN7;\243\244a\311\335\214\n\3012\266\225"
+	.ascii	"\227\233\237\003\250Q aT~0o~\316\030\375\243>\232\250\017\214"
+	.ascii	"\304.\245\202J\\4\236[\312\352\003M\206+M\354\346\347\350\351"
+	.ascii	"\037\325q\333Du\240<r\222s/k\356\326rd\034\331\211\335\214\356"
+	.ascii	"P\335\270\334\221\335\374\034*\3729O\364\217\346@\273\252<\241"
+	.ascii	"\302\334\214\342\310KX\264\241\351\037\345B\265\372\254hqq\363"
+	.ascii	"\215\033\250\226\bQ\256d\331&\252\205\216Aq\312h\373\037D\271"
+	.ascii	"\370\274\270\335\374\034 \372G\261\232(\026F+a\207s/m\332S\023"
+	.ascii	"_\337\226\262\372 g\201\202\313\221\205\326\310\341k*3\345\346"
+	.ascii	"\3474i\032S\250\f\324\n7\331\331Yv\020\007\030\324sKI}\360\234"
+	.ascii	"$}\224\n}q\264\352h\025\032\303\356\275\267\325^\206\001\001"
+	.ascii	"l\251\211\257o[I}\370Q\030Gc`\033\327\316\013\340\225\233_\306"
+	.ascii	"\242\375\017\336\2759)\\7\037\207\214\376\355\357\237\356#\251"
+	.ascii	"\2757\025\352\334RH7\351ooQk?\3748\026[\016\376g\374+\200\310"
+	.ascii	"\271\221\256\374\330{[2\332\313\355\250\206\006\033\265\333;"
+	.ascii	"ikY\302\326\324\222\332\326\224\206\245\244-\031Kj[S\032\226"
+	.ascii	"\324\266\3662)\310R\203\324\336Z.\251\355\255a\357\275wR\322"
+	.ascii	"\022\205\254\251%\265\243\255aImOm\026Y\246\354vn-wR\326\326"
+	.ascii	"\260\223\366\321V\313\232\322`)ikjI\355hJ\303\222\332\326\324"
+	.ascii	"V\333\332;;\351H\312E\322\226\322\260\325\266\302l\265\254\251"
+	.ascii	"\235%\265\254\251%\265\2551\353\303\305^\337\013\272\037:\304"
+	.ascii	"l\230\245\244\r\365tu$\265c\267\344\314"
+	.string	"\332[\366\266kJ[j\333\355\315\301\336WYR[\216d\3307$;(\244&GY\326\271\367\356\360\204\304\225\265\223\354\226v\333-}e\355\375\2054\264\237\366\336[\204\245\323n\363\260vK\034W\333Iio\013\266s\357\247\275\227v\333\355\275\227{oU\352\312\2717\215\235%\346\323\323\336V>O\373j\371Di\357\273\246\3676\265\244\306\225\365\363$\211\032s\267p.\355\222S\326f\356-[RZmy\266\235\366\336v\214fN\275\020s\363q\222\240Q7G1\332\260\334|\0342\375\243P?\236P'\324\tmb\n\3620\033\243\301\364\243Jh\013\324EN\033\031\213%\352\342\307e\350\222\375\323\313%*J7\333,\333\223^\247\355I?\240,\320$\234)\037rM\320\24495j\006\250($<\275d\317\256\351\350\n\201\022Rf\251\204n\333v\357\350\234\220\002\367r\334\324\2270i\214"
+	.ascii	"\376\321\020\203uv\263_ZE\352\231w\363qz\350\377\271/\233\311"
+	.ascii	"e2\231|&\363\331fF\223\305\240\311.\362\023\237Ii7\244\272\347"
+	.ascii	"\2211]\230\267\331E/\243\311a\256<\361\016/\\\230{;3\232\374"
+	.ascii	"\205l\251\007\327\267\267\323\007\317\314Z\225\234\374\0334\372"
+	.ascii	"7y\3727V2\030\253\246\204\207\337\315\277I\323y\357\033\307\246"
+	.ascii	"\353m\355\350\346\337\f\321\277\271\241\177\263\244\377\254\267"
+	.ascii	"\305\206\2159\246\355\346\271\234%\347hg\357 `\236\\r\236m\346"
+	.ascii	"-[\362\f\031\317\332\355\310G\270<3[\037\227\025-\317x{6K\245"
+	.ascii	"\202;\203r\263\225\362\363\254\345M\212\322\337\315\277I\322"
+	.ascii	"\267S\256|\311X\362]\266\263\315\234\345\267\216\316\356\345"
+	.ascii	"\240{g\3551s\226\\g\367r\216\234[\252\006\310\231Y\021dY\227"
+	.ascii	"\237\316\267\301\323\267\261\323\267\231\323\267\211\323\177"
+	.ascii	"\226\313V\256\217\277\264\032\331\312\237\235\344\266\\\345f"
+	.ascii	"\341\030cQ\346f*\033|\031sv\363m\226\350\207 %\263\310`,\322"
+	.ascii	"\304\345)\266\231\245\344\267,%?\311p9K\347^\252]\201M|:p\311"
+	.ascii	"d\222\346?Gy\206\373\263\233\215\303\302\312\202ts\206\362\363"
+	.ascii	"\034\005o\231z\002\343f\324\362\244\2679\323\267\001\323\251"
+	.ascii	"\345I\261\235\355I\027\320${1a\013\001\311^\322\3323\333\237"
+	.ascii	"\227\334\246\227.\266\272\233k\224\374<\257\331$U\261\005\271"
+	.ascii	"9\230$#\t\342=1\261\201\366\214\344\317iY\315\266\201@L\0163"
+	.ascii	"Mn\266\261\262=\251\365\262<i>\373yF\303\211+\242\365\274\331"
+	.ascii	"\022\261<\351\237\235d`\232\356j\334\374\020\212d1\0379\310]"
+	.ascii	"TY\036\313\315lf\233\231,\037\251#\222\301\360\231\224fCzzf\262"
+	.ascii	",$\017\241\022a\210\235\2304}{;\361\224\252,\314\232|\033\036"
+	.ascii	"Fr\030\327W\026V\r#6T^\371K\003A2\227\344\346\333\264\360J\243"
+	.ascii	"3S\350k\t\332\315\257\331\323\257\371\221\201\2403TQ\022w\363"
+	.ascii	"k\342~\3244\321\177\356\221y\360\330Qg\2670\261\346tt\245Y9r"
+	.ascii	"\224s\344.9\036a3n\376s\027\216\t\344\265\240\273\231\313\001"
+	.ascii	"rD\366n~\215\231N\263\204\367\300\3402$\224\244\202QiV\317\272"
+	.ascii	">\24723O@\370\240\230uy\003\002\272\310\313\234$\305/\260\031"
+	.ascii	"X\226ed\027G\316<\2312\224\007\244\245\025\254\300"
+	.ascii	"\344\030Y+\333\3107rV\206\221\253\362U\336\31242V\256\221_\344"
+	.ascii	"\031\331\3126\263\214\034\365,\225\247\360^\246\372\027\022J"
+	.ascii	"RA\245\273\031\370LS\225\f\214\006\377\221P\222\n6\3351=\263"
+	.ascii	"\214\314\"/\345$9\367TM\224\226WU\037\210\033\274\2618&\r\362"
+	.ascii	"k^h\364\315\362\244\257Q\322\177\206\312Okg^\364\234\231H\236"
+	.ascii	"\233\020\333\314N\271\311\271}\322\262\273\035Vn~\260\214~pO"
+	.ascii	"?x\227[\350\230y\"\203w\363\203T\262R\224\214t\363E\025\025\344"
+	.ascii	"\346\007\221\344\243 \231~\360K?\250C?HC?8\245\177\374w?\224"
+	.ascii	")\004\355\213\235\316M\232\261;\255\233\037\\\322\327~\372zO"
+	.ascii	"_c\321\327p\230\214\030\026Q\242\354\270\371zL\3376\361\0301"
+	.ascii	"i\026\262\235$\314\261\230\357\335l\017:@\332\260\340\270\031"
+	.ascii	"?\355\\`\333\\\334\315/\363/\377\2036Szp]\271\371\232\251\357"
+	.ascii	"\374\342\245M,l\354\346\377\307^\360n\226T\252\345-\211\256\213"
+	.ascii	"^\025\333\226\233\261\336\217\345\360\034\346rc\263\261\250\311"
+	.ascii	"\270y\213\031\267+\1777_o\351,\270\216\204\222T\220\211\013\314"
+	.ascii	"s\206\234\345\316F\272\373\302\234\001\333y\311\303w\030\017"
+	.ascii	"k\261M<\003\306\342\343\334;i\006L\207\353\254\235\225sS\325"
+	.ascii	"p\3555\361\3358'\200q5\371\332\206\276\226\322\327L\372\307u"
+	.ascii	"W\306\252r\374p6\367\336:\301'~`0n\276V\322\252\323\366\244\357"
+	.ascii	"\263<\251\305\362sl%\343\340\213\"R%J\360ni\207\333\315\277\315"
+	.ascii	"7;g\355v\224\340\345\327\006\350\325\307\374\301Q\256\027\257"
+	.ascii	"3?8\nv\363\372\233\202\3410\025\f\005\307a)\266\211\243\340'"
+	.ascii	"e8\n\336{\031F\004/4M|\250W\f&[r\362\325>}\025\214\276\312E_"
+	.ascii	"\225\323?v\322\344\206K\212K\027\223\343&\277\335r\203\334\310"
+	.ascii	"U\271\363\273\031\263\375\0343\t\f\214\302\343\346\234%k\367"
+	.ascii	"\357F\222\031\326\354\236\315\332[\355\205\035\227\031J:\030"
+	.ascii	"yr#G\022$.01\355\251\035#\261\1777kW`#$F\334\336\315#~\216\325"
+	.ascii	"\302\340\264\316\244\241\205\311\210[\273\031\243\375\330\211"
+	.ascii	"\317,\032N\022$G3\334lw\330\236\264\307\362\244\270\354\347\330"
+	.ascii	"L\247\221\002\305\343f\016\230l\354f\017\215\337\321\3158\260"
+	.ascii	"\016|&\245\231\334\3515\361\021\\\004\033\301a\370\013{a0,f\233"
+	.ascii	"x\f\017\371\255\302D\360\016\036\\\230U\230?\256\370\260x\370"
+	.ascii	"LJ+I\253{\216\341\036[\236uB\254\230\0012\307\034\303A,\236\234"
+	.ascii	"\217\316\025\225038\344\253>\321W\331\364\3253}\025L_\355\322"
+	.ascii	"Wc\350\253O\372j\013\375\364\214\376\232\355Iq\016\035c\255\t"
+	.ascii	"v\363\323<\334\365\214\226\205\203\217b\320\271\335\374\324\212"
+	.ascii	"\3761\327\2073xHa[Z9zbT.\326\272m\003A\005\230\252I\032X\226"
+	.ascii	"\ruL\n\327\332\315\330\306\305X\370\306\261\r|\365\021#\374&"
+	.ascii	"\t\333\310{\037Y\273A\216\265\033\240q@\216\322\322\374\024N"
+	.ascii	"\377\270\206\007IQ\2304o\3761\r,#\263Y\261\343q\363C8j2\223\216"
+	.ascii	"\304\3000\360\f\\\205\255\360\013\333\3042\260\324\361\024\246"
+	.ascii	"\0321\002\226\201\267m\303N\246\252\204\253\3549\345\2770\226"
+	.ascii	"v.\347hg'!\2211e`\244\261\347\336N,\003\263\300Q\370LJ\002wb"
+	.ascii	"\231\n\232=\226\223\255\323\366\244>\226'}\212\246\241\200\210"
+	.ascii	"\230I\273\371\351\227\276-\303N\330\205\235\303\3167\335\"\r"
+	.ascii	"\b~\302L\270\3116\261\023^ja\377r\222vv\022\027v\302J\373hJ\004"
+	.ascii	"0\247\2304}5@n\334\310\323\371i\r\375\364I?u\241\237\262\320"
+	.ascii	"O\227\372(\031}t\213>*\247\217J\321G\335\364\177\003/\240F\022"
+	.ascii	"\243$w\363\005\274y\327\214\265[\313fL\314\276{\346\376]\277"
+	.ascii	"\213\346\246\261\315\013x\001\357\213\313\343\351y\001\357\217"
+	.ascii	"\013G\202j\007\303\314\234\236\027\360J\2713X\2735\026\314\232"
+	.ascii	"\230\027\320B\271R$\250v\220i\006u\001\355\232u\263vV{O\211`"
+	.ascii	"\026\325\304\327\267\367\006\321\241\207\027&\0309\371\362i\030"
+	.ascii	"U\332\266\334|\324\251o\313\276\370\351\365=\267\240\341\"v\346"
+	.ascii	"\271\367\336\373\342e\217\271w\273\210\201a\356\275\313\3341"
+	.ascii	"W\314%s\003]\236\2303\226\250\246\274M\335|\r\214h1-\246\313"
+	.ascii	"\344\246\364\340p\252\322\202\354\320d\327e,r8m\334\254\233)"
+	.ascii	"\234\220\035n\317\233\365\030\032\204\016\314\215\233\365\021"
+	.ascii	"4G\322\035\222*9\242\320m\211\335|\r\272\274\274\264\021\213"
+	.ascii	"\266\2438\230iyU\331liC\262\243\310\265\021\234\267\030=\332"
+	.ascii	"4\330\215s\271\3674\230\376\n\212\361\322%)\007\251\006S\307"
+	.ascii	"\315\327\300\205\326u\227\226\036\202\361n\366\022mG\251nr\201"
+	.ascii	"p}{\311\352\203\315Y\323\031\226\037\327C\256\231#F\370\227\260"
+	.ascii	"\"xG7k!\317\261\242\203\362\274\371\032\210\016\362\007k\274"
+	.ascii	"\272\324\214\334\374\f\364\364\r\240\321bLM\335\254}\374\313"
+	.ascii	"\375\372\342\024\346f\335\343q7Vy}:4\217+\\wH7\353\034Z\207m"
+	.ascii	"^N\357\270S'\007J\213%r7?\203;}{\271\364\004\366r\251\346\272"
+	.ascii	"\306\361\007\203Pltm\335\374\f\344\364"
+	.string	"\257\267\376\240\312\206W\203y\3633\220\242\237\201\233\246\241i\350\033>YK1\"D\321\322\203\303\351\001#H\213\032\3277\264\231\246'x64V\236k\322\244\305\257+M\0250\372*\213\271\340\313\222\023\364\352\306\t\226$N\216HIi+\237\254e\230\005\304a\321\203\353\303e|Q\256h\031\327V)\\\0171'\260\233u\214\374T\315\340\250\363\272Y\303@\257l\220\340h\363\272YW\3412<\364\216,\335\254_$\341\030\"w\263\246\262xM\033P\252\334\254\247\362\222\337\033\236\213\234\204\223\360\320R\346\303\311IC\371\f\341B\323\274y\362\305t\364t\r\365;3\274-\031,\227\2264\223E\333Q\036\310\322\314\\\365\351\345Y\325\227\213k\246\273)\321\303\022\345n\026\254M\214MN#i$\255d\321v\024\003\206xU\205e3X\206\260\270V\372\236\326\322\367\347\342f\235\224\302\371\200\223\341\005"
+	.string	"\2674i\364rH\312\005\351\306\233\336\327\313\034\251\030N\266\233\325\300\033&J\002\263\244\2311\243\376\371d-\303\200Pe\210\036\\\352\204\214\027S\355\273\372\347w\323$\307\037\215\233U46_|<\351\272\371"
+	.string	"\b\323\352\031"
+	.string	"\340\0303F-c\321v\224\003\316\274\252n\264\240\244\340\221\271Z&\250\003\357\311\t"
+	.ascii	"T{{j\230TI\0240W\262\0164dz7\253a\324\347\231\031Y\2007\253`"
+	.ascii	"\202\272\224\300\335|\f\366\3641\310\343\302E\365b\321v\224\217"
+	.ascii	"\331\322\253\252oo\253\0177T\2368\235\250]\256zQ\237Q\2264oV"
+	.ascii	"\365T\267+V\274\340\375\017\246W\242\376\320\334|\f\342\364\377"
+	.ascii	"\253Z\264\250y>YXKZ\027(a{[}P\261`\t\003\304\273\232w\200\030"
+	.ascii	"S\304\334\3742\270\356\177P\307\210_\023\336\315\307\340J\377"
+	.ascii	"\352\335\235\305+am\037M}\230\202\224\307\247\001\210\235\221"
+	.ascii	"\233\357\241\213\376U,X\260\215\374\004\t\017\356\347Mj\351\346"
+	.ascii	"{(S\353\324:\254\340Z\223*n7\337\303\227\376U:\225\016e\346\244"
+	.ascii	"\235\235tg\366\266"
+	.string	"\245\254>\030\202\311s\272\371\036\272\276\256\226\251_\252\034^\262\332T\th1V\2634\305\305\f7[i\232\301d\355\346{\260\322\267ef\252s\013\2143t7\353\324\324$\326nG\tE\346\252\326\3247kg\265\263\223\332\274<\341T4t\347,5\354\215\343\nS\212ZE\245\242\306\251Q\324)\266\251\302\251J\3563E\205S\323\232tO\033\2742B\354r\262\331\277x@ZR\241L/\004\365M]\242\272\3318\361\312b\325\247>Q\241\330\246\372\266\326\001\307\217K_Y\232\177\325Mm{c\252\321\342f\325\211\232\\\023\216\233\177A\237\376U&\266\2516iA\0040\310\315*\333\277\270X25=\016\306\2231\272\233\177A\031\375\013\300\350_\220E\253H\264\226'\326\234\376\005T\364/\210\242\177\001\023\375\013\222\350_u\242\033U\263B\346\312\315\277"
+	.ascii	"M\253c*\231\316\221\267\034Ln\276\332\374\037t\241G\035\223\233"
+	.ascii	"\363\221+'\204\371t\363U\261\234-A\226\234\335|5\354\177\020"
+	.ascii	"e\022Hf\306\315\252\021\255t\301\227\0075Xm7j\200\251]j\021\213"
+	.ascii	"&C \240\231\233\277\305\366\244\226\357\347*\230\315\025)O\263"
+	.ascii	"\233\177\201\226\212\343\352\020\025\207J$\2379_\324\344\221"
+	.ascii	"]}`\203w\006\n\323\331Dj!u\263\nD\025\2422\377`0\212\323\335"
+	.ascii	"\325\315\277`\206\276\032\344\177\260fG\026 `7_\037W\177\374"
+	.ascii	"A\265)\225\264\344\346_P\245\257\362P{\314Eqq\363/p\322Ww\374"
+	.ascii	"\017\236\240\213\226\330\315\252\016\255d\001\240\007A=\264/"
+	.ascii	">r\\\325\361c\266\313\264h \270N5\254\300\334\254v\375\\\315"
+	.ascii	"q\205\254\311\311\335\214cy\322[p\247\245\245n]\241x?\240\\m"
+	.ascii	"\275\331\260\241\336(a\r\0052 \314`\331\023'd7\314\364\257\326"
+	.ascii	"\250\241^\345$\347\236\272!\023\253Y\302\025$\314\315\352\225"
+	.ascii	"\005>\364\257\306P\255\324\031\026O/\2454\023!PO\013\262d\310"
+	.ascii	"P\253\356\316\332\233\251*\021\342\364\264\340I\277C\240J\245"
+	.ascii	"R\251U\326\r\253\211\257\017\267\330\333w\352\213\253U\315\270"
+	.ascii	"\347\031\251\377Aa\\\217\276\233\337\241\214*%e\333,\023\233"
+	.ascii	"/i\222\274\334\374\016z\252\013\365Iu\241B\251P*\223\312\244"
+	.ascii	":\251B\320\250MW\2350]\017/\26593/\253\0347\277C\235~\007'\372"
+	.ascii	"W[\250-l[^\242\355\250\232\026\030\306\333\331\332\315\357p\246"
+	.ascii	"\1775)\005\243\262\260xyWq\352\340\245\337\201K_\335V=R\217\324"
+	.ascii	"m\2454[\032\017{%\307\202\356\346w\240\241o\325\235:\245\201"
+	.ascii	"7M\002\307,o~\007\027\200\200c\314?\375\247~\266\231\372\241"
+	.ascii	"L*\354\354\315\025\306\fs\346\fF\222J\005\231\220\304\236Y\364"
+	.ascii	"\237\232I\315\240I%4\033\027\331\223J\2312M'c\306`$>;;)\355\b"
+	.ascii	"\323G-L\032\246\006I\210\217\327\227\024\314\227\275=tO/}\246"
+	.ascii	"\210\315\225\251\325\335|\237\034\372>T]\272\330=\273\337\264"
+	.ascii	"\022\327\325\001\304h\244\341\302\305\316\245\325h\342\353\373"
+	.ascii	"\201\307\264\274\371\025t\321\222\346i\301\303C\367\354\226\342"
+	.ascii	"\302\334VV\037\364\0217'Y7\277\2024\375\n\252\322\271t.\275["
+	.ascii	"@\\\033\363\"\301*3\225\345\351]\216\031\326\022\264\233S,\350"
+	.ascii	"\321\020\247\265.7\247v\350\021\316\227_\236\225\233\323:\364"
+	.ascii	"(\007^]\261\335\234^A\217r\304\346\262\004\336"
+	.string	"\234\322\241H\200\177qM\364\b\247\214\231'\345\217\n\225\324\212^^\340*\007\311\222\035X\252<\265b\331\266\325\217\277\377\301\224\313\227V\013,O\236\244RL\234i\342\013\003\342\224#*\356\251\224\232\0345\226\315\233_&\205\373\037\f\332\361\361\255\301\245Q0\025(9\037\\\233\006\023\270*)\224\034uc\243\213F^\0236\266\324\315\307\214F\212\204\013\354\351\346?m{\352\246\357p\024Q\2729u\222\343U\007$\352\346\264\211u\033;\243us\312\004\335/^d\t\271\371e\320\375?\210\321\232e\314n>\005czm\r\255\2427\207!<l\270\226nm7\237\002!:I\022tOo%\200mWrTn>\005:\364\237\252\245jv/\0379\267T\312\265c\006\222\261\0327\237\202\027\372O\235\315\324\231\242\345#\264\275\324q\033bV\244oo\253\017\354\034\237\214\250\233\323\263\0165nL\254\246"
+	.string	"\365{\3104\323\262&\031\331\005|4\361\205m+\253\0177D\362\276`\334\374\2369\375\036\262\260\364H\230\230\230\223.AC"
+	.string	"\255n~\017\020\375\236\030\372\3136\323\257\264\310\006)\027\224<=\267T\325\007)\230N\221)%8U\313\324\221\277\233\337\343\244\2372mJ\244\231\022I\231xi\013"
+	.string	"M\023_\030\207?\2352/\2070\036\210\220\242cJ\201\200"
+	.string	"\213\371g\343\346\037\315\364G\032\304\006\311\214\024\310\215\0220\273,*\312G\326\315\347\220\247\377\264G\332\003e\226\260\266\217\206p\240c\354*E\r\271\222\222#\335\221C\207\016&e5{/\204`\335|\016K\3649\200\351?\305\221\342\310]>\316Me\223\306\205\003\020\375\247Y\317J\267JX\313\332T\013\030\202\345\352\203\274F\243\205\231T\313&q\246\301\335\354\344`e\004\352\346s\340J\257l3\275Jm\250\340\334K\035$\277\252\017R\254\232%^M7\347\013\"O,n>\007\031\332*\245a\205\356\245{[gV\224\324\266\222\372\220\316Hg\240{z\271\367\322\271\243\354\0229\253\017WKImy\36394\351\363\364\351?\205\021\303\266\345m\265"
+	.string	"\260(&\027}\036*T/\300\254\230\350\3634\365\237>\2412R\250Tjg\271\265\355\214-`LiTN\031<=\0377\237'\210>O\016}\236+\246&\031\230`QO\036*}\036\245\026Kr\201\372\033\370\222X\3306\r\360\3366\314\336\300\350o\320\222.e\244G\266-\203"
+	.ascii	"\366\264\241N\177\203\224\300@\274v\235{*\345\272\321\304\327"
+	.ascii	"\267\245\255L\327\315\337\260D\377\241`P@\274f7\323\266.\230"
+	.ascii	"S\234\236f\372\033\274\364\321>\213\242As7+E\301U\234\352\245"
+	.ascii	",\311\307\315\337\260\245\357fo\322\336G\001\320\351\"\333\002"
+	.ascii	"\343f>0\250\031\214\244\004\244\245}\264\005\302\224\247\375"
+	.ascii	"\3017\310\320\337\300\244\177\224\f\231\273\375\260w6\254\336"
+	.ascii	"\331\323\331\315\337\220\244\217\202\261h\230\177\304\b(\030"
+	.ascii	"T\214m\263[i\257`N\201z\006\352k\350\323\267\266-\375\362\005"
+	.ascii	"\335\023a\n\323^\226\257 l7_\003^\227.\026/;\367T\232\266\004"
+	.ascii	"-\313\302\204\346\346k\220\242\177\224\313m\023\345\202\006I"
+	.ascii	"\363\302\276\264 \243\273\371\032\332\362\362\354\334\207\022"
+	.ascii	"\310\232h\261MT\213\235\373\260\217\216: c\002\344\356\316\266"
+	.ascii	"\371,\200\214\214\251\003\013\026\333\326l\342\013\323\252\253"
+	.ascii	"s\243AG\207m\244[\305\223l\355\371$'\267DC\213)S\320*O\204\240"
+	.ascii	"T\216V\301\211\233Q\244\306\016\237>\032\305\242qM4\316\342Y"
+	.ascii	")\235$\215\355\271\245\250|pg\324X\262\335\374\235+\372\326\342"
+	.ascii	"\245?\n\005J\025\346\214*2\244\334\336\336\250\264\320EE\325"
+	.ascii	"lks\323\2111&\314\323\315\337\371\241\177\264I\023m\202\265J"
+	.ascii	"\330\261\263\223\356\332\230[\312\352\003\034*\037;\200`\261"
+	.ascii	"\261\331\266\274t\006A%\n\342"
+	.string	"P2g\025&\213\204j\224\253\211d\221\220M\320\260F\310HT\022\207\031H\256\312\025&\250\260\300\215\252\\M$\221\307\244qM\326\244\020\303\352B\212\241\021\347C!\222\305\342\020(\251$\236\020ad\0242\200\n##\261h"
+	.string	"\021H\020\222@B\205\be\322x\004BQ(\221\"H\242#\214C\345\360F\310HT\016%\211Fb\004\216/ \217\021P\022\2071\b`\r:\266\200\263BYD\004\001\023\224D\242\244q\210|!I\274\340C!D\254AFE #Q\0042i$\202\202b\321\310h<\032U\245p\225\201\230Lc8\"\207\224G\243\212b\270\026\263rM\022\255Di\220\221\210\202\203\t\343Zt\314\371P\b\021\310\341Z<aE\032)\207+\212\233\017\205H\016)\207D*\216\310\242\242\2410y\004\252Y\225Dd\006\224F\"\262\204\315*\254)2\202\341x,\362\244\260\022\021\225\026(\205\311\026\222\304b\221H\224\232\240\\Mh\370P\b\343\221\230D\256)\214G a\262HH\204\361HDt\004\n@\362\250\024\006!\217G\016\037\n\301\302\013+\230\020\241\\\205\220C\245\0060"
+	.ascii	"\035\213'\254\310\343\t:\037\n\021D,\nZ\225\303\024D%\320\003"
+	.ascii	"\222\303\f\254AG\"$q\310\263\026\205\214\303\025E\307\023r\224"
+	.ascii	"\037\n!T$B\250\b\310h\024\001\033#\212\213&\205BE7J\241Q\250"
+	.ascii	"\b5\n\025\341U\006b2'\223+2(h\250\256(:\002e\244\262\b\037g\005"
+	.ascii	"R\231$\n\255\026\020n\bZ\215B\304\342P\rZ\223F9\251~\250\034"
+	.string	"\006\t\025\205\310Q\016\213ED\353\013\3125\271Z@\250\250\203\260x\004:*\217\310\"\241\212\023F\033\222'\214v\222J\342\t!O\r\362\250\034\002\021\203\214+$\213R\3300\342'\304JD|\001\005\b\260`\242D\n8\027H\026\t\005k\2044\b\031\211D\310\241\rN\b!\220+\021\361\205\242\343\261(L14\352\254AG\"a\212\241Q\013\021S\f\215;A\353M\r\221Q2'\204!\022Ep]\221BkM\320pE\n\221\253\262HDq\243\034\242\220\202\361\310\303\263\301\003\242\243\n\307\027V$\021\205 \343\003PX\225\303\242Q\b\" \341\nd\034*\223\304 !#\2618\004J\n-814B Y$\304A\270*\207AEF\302\035\033U\310HD\016\327\023B\024(\216+\fC\2450\305\320\310\243\024&\327\242\220\361\001\310\265h\004\201\036\345PW\240\\\223+Rh\242D\n"
+	.string	"\320Y\221\303\030\202\220C\025(\b\252 \242X\221%t\216U|MAz\002\254FI4\256\020$Z\225\311\025&vnT\034\213'.\300\243D\036K$\213\204\324dp\250\034\242`\003B\b%rX\024b\270\022\271\260!G\204\020B\"\243$\f@\353\020\320\316\315\b!\210\214\\H\221\314Q\252$\204\020J\266\020<@\210\225h\210D!L\026\t\331\244\b\b\261BID\016\213t\n\302O\b\345\232D\201\342\030D\177~B\020\r\221\303\"]\034\032)\201\2067A\020B\004\025\217B\033c\fG\024\214G\026\326\342\020h\247\346'D\020\362x\004\022*\223\303\342M\212\241\361\205 TI4\022\363\210\020J\242\221\230\002\025\207@B\023%R\320\240\"W\245\321\350\b\2643\244\0242\256Ea\320\360X\\1,\022\352\234\030\na"
+	.string	"\022\242\311\344\260\b$L\213\204ED\030\222\302\233\242U\231\024\242;J\243\321\361\204\240#\n\343\n\025\034\215\033\202\210)\222:F\023%R\310\021\232(\221B\260&\206\325(\304\371P\b \243\021R\004\020\212\fjT\254F}B\250\006\021\205BI\"\241\212\034\016\235\260\223,\022\022\256I\344\260H\250\001\n\260`\302\005t\222A\305\225\210Bxb\210\024\262Q*W\242\343\220\320D\211\024\2642E\256DFI\343\361\204\234!!\243#rH\231L\016K\254\305 \343P\205d\221\020\007\241#\013\312\025\006\240a\211d\221\320\315*\214"
+	.string	"\207\364\001\020h\301\205\225h\210\214@\f\253\013\311\"!\235\003\021\221\253q\025\322\027\201\004\003\220@B\205z\022\t"
+	.ascii	"!\001 \244'\221\200\237\237\004\220\360\243O\302\017&\021B\310"
+	.ascii	"HD*\223Z)L^@\271\341H\254`\005R\271\022\255\305UY\301\006\030"
+	.ascii	"\222\303\026\214G\242\022\310h\204\342"
+	.string	"f\025\256@AQ\222(Y$\244A\250\342x\002\006\240a\361\004\0051\f\221\370C!\214\210\210\"\224CB\304\"\n\237b\361\210\314C@Jb\021\032\303p\005N\256F\305a\212T\251&\205\311\341\t\023*\216\305\023F6\311d\221\220\315*,\221,\022\302A\256A\304\024Gd\221^\2055k\320\261\205\344\360DR\257B\035!\"\n\343\361\204\243\322hX\263\n\037\220,\022\302\t2\032\232pT\032\r\265\362C!D$\221k\n\"2\310\303P9D!')\274\301\200\022y,\261\263\026O\f_H\221\"W\"\n\242\322\270\006\021kV\341\032tlA\211<\026\325\254AG\242\274\n)\240D\036\213p\222\306#QYtTW\345\320\002AF\303\023z\225\201hb\225\201hB+5\362&h\270\252P$\016_@\256(P\030\231\240By\203T\226XS\020W\240\325\002\305!\021\271&}`"
+	.ascii	"\032\236(\026\207'\250@\326(aP\022a%\321\270B\262H\bG\305\032"
+	.ascii	"d$\242*N\030\341\244p\270\022\271\200\243Q !N\262H(\230D\036"
+	.ascii	"\221\3105M*\215\216+\021Q\251\2136\312\344\220\005erX\324\311"
+	.ascii	"I*\205zU"
+	.string	"\016\225IT\305\032d\\aU\016\221AF\303\0238\253\260\205d\221\220\206U9T\232X\205\206\311\344JtS<\036M\020\242I\341P9D\301D\262HH\203\362C\312\342\020'\207@G\026\222EB8\312a\021\033\217E<T,b\241\211\022)\334\004\255k\221\t\2335\2114:\236\020d4:\"\205n\212\216ACY94AddL\201\210J\344\232B\203\220\361X\f\016\213:\210xL\026\021\213\305uC1I$\\\203\214\224DeqxS\034*\215G\031\210\310\343\020\317P\261\230<\026\245+\021QYd\224\026\207D\245qE\256(P\020\203xT\020Q\b\225I$\021\205\360\250\324\220\356\214H\256\310\f\264&\215\302\225\210\250\f\302\260\2561\344\265h\205R\250\202\210B'\215\224CeR\250\202\210\242F\305\2124(\004!\007\025+V(\211@\307\342\232B(\203\020\305\n\264\352\224\240"
+	.ascii	"\nB\343\221\250$&\217E7\311\025\211\223\253\222X,\256\312a\262"
+	.ascii	"\306x$*\215\212\307\244\336\031R\"\217\306\24029\\\2151\034\203"
+	.ascii	"\204A\253Q\007\205\240\203F\b\205\214\304\240\341:T\263\002h"
+	.ascii	"\2104\002\002\032\n\203\326\265(\231\023\264\032\213k\2124G("
+	.ascii	"L14\nU\2340\242\340\034~,Z\221\"\224\307#R\204\215\232\\-\200"
+	.ascii	",B\215C@8\210\230\"\231\223B\303\"\nt\205\222X\034\032\211@="
+	.ascii	"\032\201p\212\265\270f\225\210(\3030\027W\243q8\004\244*\205"
+	.ascii	"#BX\211\210\312<t\002\221\221\021M\n\r\213\021(\016O\034\213"
+	.ascii	"B6J!\t?J#\321H\217\bZS \327\344\212\f\036Q\030\211)\222\251R"
+	.ascii	"HBi$\032\251\311U\271"
+	.string	"\342\004\212\034\016\001\345#"
+	.ascii	"\001'hp\001\027R\320@!\222EB\"\216D\021F\342\220H\004\0202)\""
+	.ascii	"\004\317\377\340\230\272u\270|\201\2259\222\336\211]a\251\023"
+	.ascii	"C\003\321\227\003\355\246@`pq\224g$-\222cEG\332\230\")Sms\022"
+	.ascii	"\205\006\230V\312)c\303H\216\2574\210\223\031\027x\327K/\313"
+	.ascii	"\270\220U\335\354\264\261ZrR6D\375\253\361\023;\022\310,\243"
+	.ascii	"\217\246\312r\364x\217`\220o8\332\033io\033X\037\274\262\304"
+	.ascii	"\244\351\333VU\301 A Cb\314\200\346\002\t\376\bl1f\004\025r\203"
+	.ascii	"\350I\001\023\364\221\217\004c\030\301c\273\371\034\354\320\177"
+	.ascii	"\220\207\352\005\023I\262b\261\303v\ri\033\013\352\320l^Ga\201"
+	.ascii	"N2\\\204\360\350\322LK\002\303x\301\241\313n\226\220\\qq\351"
+	.ascii	"\2646\033Dtl\245Rj\272\366\346\230ZGL\020\343\324\225e\347R\031"
+	.ascii	",\374\230\3340\"5&+\354\332H\245n\226\226*iXj\336\024*ol7\007"
+	.ascii	"k\004kl\234\327\244\211/\214\203\031:8\343\006\255\2024\036\234"
+	.ascii	"qgpF\006\177:\326n\240C\203\t\025\"\251\f4FpO\257y&\206\246\262"
+	.ascii	"%\253\313)\b\003\345Q&\352\271w3\322\363\017\306\213+5V\200A"
+	.ascii	"\350\250T\250)\264\212\r\035\336\223MJg\031\201\307|\212\322"
+	.ascii	"F\364\231\270\2523P\350\336\222\031;\270n\0166\341\023\004\006"
+	.ascii	"\006\006\376\355}\024l\272\301\247\240\323\203M\327Q\267\204"
+	.ascii	"-\035\245L\332\n=\253\242;r\261uc\203\007\013\274\245\324FMs"
+	.ascii	"\352\005_\013\250\254\346\345\f\240\222\276\221\243\244\317l"
+	.ascii	"F\220E\030970#\301\244!vf\201<n\376\203Hh\2207#B\264\350?\375"
+	.ascii	"\027\\\352\370\022\334\017.\257Z0\225\002\261\300\226\034\335"
+	.ascii	"\254\323\\?5(\0277\237\003(\255\00198\322\277\366C\231v\3062"
+	.ascii	"\n\017\215F%\362,rd\306\231>+\347\231 e\256\373~\315\247\315"
+	.ascii	"\344\345\220)\315\233\257\225\355I\003\020\346\347\272\214\212"
+	.ascii	"$\f\335&3&K9S\003\355y=\346\327a\264\230\324m\254\371\342\346"
+	.ascii	"+e{R\016,O\252\267\374\\?Q=\2751w`\364\336\026\032_d\364\227"
+	.ascii	"\353\275\034+]S\240n\326^~\256\2770\221\003\024r3\217\356\242"
+	.ascii	"\365R'/MX\350\274k\275_o\321\\T\026}\317\300\233\357\222\355"
+	.ascii	"I7\260<\351\255\372\271\316;\233\213\222\204\247\265P1\321\013"
+	.ascii	"2\303\265\0264\020T\240\"\t)\360\346\237\237\353\031\254\231"
+	.ascii	"\337\331\224\233\355\354t\026\020\354n\221\204\013\f_\324\227"
+	.ascii	"\f\215\345:\213m\253\252\202\226\303\314\334\234\276\342\223"
+	.ascii	"\265\f\363\201\354\314\253\252/"
+	.string	"\370\244uFC\323]_\271\351\272\373\301\225\305\212\025\r\345\2437Y\032\232'\316\022\257\244\2518)\277\024M\305Go2\256\276'>\342\002\357\306\224k*8e\220\330\225m\340\004\016NC\245!\023\306\3074f\351\346o\200\006\005\n\2727\345)&M\237\312\324%\n\360\346o\360\325\344\372\255\211f\262q\372l\244\244m\303F\215\231S\017\253\276\275t\365\001\365a\245\f\306\315\332M\315\323\"\207v\263nCk\274\350\362\345\344\017\336\354\230\273\"\346\346k\220F_\203>%J4[\0243W}9B\264\240\304,\271fs\323\3322C\307\315z\355nmg[|tA\202$\225b\321v\324\006\246\364\340\302h \251Kr\3635@\242\235\332\251\323\246\274\252\302P\036lboh\327iy\311\202\016\360f}\226\302\351\004\210\001\250\244\243\320T\205\247Ea\034\n\305 LbP)\345\224q\002s\025"
+	.ascii	"@@D(\221\n\226ik\024\200\020W\324\240bV\243\212A\224\"\245f\006"
+	.ascii	"2\003h\001\006\221\301?\233\217\242\256Z6\362\227\260\332\351"
+	.ascii	"\373*3\207\230\273\211=LE\313L\220V\342\243\202a\204\026g\204"
+	.ascii	"tY\034e\243e\352\335v\241\bD\022\017\177,UQ<\344*N\221LX\261"
+	.ascii	"\316\362\353\233\006\341\244\222\220G\371%\211c0\252\234v\273"
+	.ascii	"y\310\313\r\2403v\324\237\340\013\r\016\321\242Ig\271\263\344"
+	.ascii	"\342o\3717\267\215\334\221\021\013\311\001\270oSC\251ID\331a"
+	.ascii	"\244\234\017_\201\003\305|aL\204\226\034\340\320\244\276e\243"
+	.ascii	"i\207\227\037\266\250\330\255\\\235\305\363\364\312\255\251\250"
+	.ascii	"\034Au\253\325M+\224\274\037\002\312\357\375\332$\370\210\024"
+	.ascii	")\314\303\b{\246fp\354ug\005~a%\227\030\331\274\344z\030*RJ7"
+	.ascii	"\345\374\006\353\024y\337)\221\207nFjn\031\030\323^X\234\034"
+	.ascii	"\322 ?!\303\376M`\236\\n\r\t\3166G\023\222\241\234\237\204\260"
+	.ascii	"\b\266\271\213A^\024\232(0E<\021\006\360\305e\2453\320\220\303"
+	.ascii	"\3656\025\373\347\2631i\025\215\222\304\226@k1\233\233\257]\227"
+	.ascii	"+h\260F\220\\@\354BM\332a\275\177\"\251@\301[@\016\240\360\361"
+	.ascii	"\345V\004\302\213p\361r\2460T\0213kmTR\365z\230R\233&G\002\024"
+	.ascii	"\177\330\\gO\024\fZ\021\236\215\276\266\2719\246\256\346\312"
+	.ascii	"}S\236\302\204U\320oh*\221\300\203\232\241\300\242\022LG\no\336"
+	.ascii	"\t\352E[4\203\013\243\327\225\353\333\022m\341Jx\210\204\263"
+	.ascii	"\211\303\326\334\242\210i\257\177W\332\030\312@\023\022$\274"
+	.ascii	"\352\307>QO\203\276!\030\373\267\233\3216\307m\352\252\210\207"
+	.ascii	"\004\026r\"r\376h\363{\220\020\325\231j\\\375&(\002f\263p\216"
+	.ascii	"\250fk=\374\312\0219,X\254^\216{v\374\212\247\313`\007\006\236"
+	.ascii	"\222\371\232(t\340\355\355\022\377tS\345)\244\211\314\216\330"
+	.ascii	"\233\020K\b\334^\314\216\300Z\\\f\034\312\246>\253Z\026A\036"
+	.ascii	";\232\245\300\370\0179\206\r\345lMa\343\203v\357x\371\270\177"
+	.ascii	"\250\374\322\031W\213e%\347y\251pd\035D6\005\021\2107\037n\353"
+	.ascii	"W\b\221\311\245\376\205\300\217f\344\205\251\357\030!\331\366"
+	.ascii	"\245\3344\275\204\0011m\016\007P\0064\372\252\331\276\342B\316"
+	.ascii	"\277\331\260\274\235\363\314\305r[\275\3325\206\355O\352\177"
+	.ascii	"M\336?\270\201\377\3006\023\346\320\366$\232\035\235\226\364"
+	.ascii	"\223\335H>\006~\277]rl\241tm\265\353u\005e\007\270\226\n\273"
+	.ascii	"\260\267\202\236K\027n0\315($\203\374\343\005o\224\2754\317x"
+	.ascii	"\363\017\\\206\263c\377\365\013\bvM\251`\326\272\237C\301\227"
+	.ascii	"q\330[\n\367\216\306\003+)\317\225O@HiT/\021Gc\016\\_\231\306"
+	.ascii	"\330Q\326K\306&\005\377\227\211X\316S\243\344U\031g\260\301\342"
+	.ascii	"]\316\311\244\222\373}\313\320R\004\\.>E\317\351\362y\336\027"
+	.ascii	"X\325\364w\203\354\004p\334\0020\r\207\327\fH\211\006\025\267"
+	.ascii	"\323\030\335f\013\311\213G\004\371\003\035:(\325\241To\230\215"
+	.ascii	"\025\270H\212\370\370\337\362F\023kj\333\033\266'\030\251[vY"
+	.ascii	"\245A\242:V\321X8\213\200iu\214\\1\036\004\3228K7\262\364:{l"
+	.ascii	"\023=\334\354\201\004.\\A5\223\3530\254Q\013\352\357_\030\221"
+	.ascii	"v\255k+{H)?UN\023,L\3273\221I\030\352\213\"\220\357\b\217}\021"
+	.ascii	"\001\271r\325\314\027(Sm\337k\247\375:\2052\314\334\034\212\311"
+	.ascii	"\304\327;]o\276\222\236\223\005`\324?\271z\220\023\376\\\024"
+	.ascii	"/\263AO\346\354\262\333Dz\232\036\031G\246\304\f\023_\232\006"
+	.ascii	"ub"
+	.string	"\314U\253\266\347\021\370\320\202\210\212\252pm\306Vm\233\323\237\310\254\202\346\020\246d+]zw\246\340{l\263\351\226\306\324.\t\2515q\355o\"r\025\215\227\203\367^\303f\336\377-[t\026\356\335G|\266\177\342\021\345\353h\325\203\024\316\261a\3658\300\373\324:F\314\334\370\342w\263\376k\346\317F\001\307\004nB\bvS\177\327\265\317\022y\026\277\347^@\236,\210\241B\023\322\253G\024|W\304U/\223\r\251Of\225opa\244\025=\260\247\003\357\333\271\247D\023p_\025\212\016\001\025\210\273\332x\336\264\304\003(\245\031\366\260\310l'\353Uw\232\253\332\026K^=\311\025\353\223W/7+V\312\025\200}\013\331\301\247p\340\244*\307\243\\\334\222yo\3132B.G \305\214'*"
+	.string	"\326\0258\370\326\246\0218\r7\320\335\206u\264\375\320aS\337\310\024\365\363\230\264\033\220\342\317{)\r\243?\370\0371\332\321\357\325\226B\275\026\227\243\\CE\356J\256\034\2123\217\271\346\206\371\212\003N^}\340\213y\263H6\266\325\214P>U\\FQ\204\037LU\203\207\206\026\346I2\001\231t\255\312GX@!\202({\035\372\260\225\t\004?\313-\326p\274o\327vc\372\214\243\340\030h?*\017\t\237\003\301\352\021\321c\025\336\213\251\200\365wj"
+	.string	"\2018"
+	.string	"\351)\340\242\276\244S\324\376ea\272\200C\003\230\214Gd\334\304\330\334\327\301\232aJ\225*\243\213\230!\337a\312R\312\255\305\234UA\002\030X\360\221\365\0044#TQ\177\013\312\251?\274\223\301\354\311\373I\204\234\303k\022CSv\275\266\250\235\317I\233E\370+>\013\201\026K\254\272\325\343\344\230^\031/\3730\214C)\362\205\007]\177\276OC\207\362\225:'\006{\332/E\233\207\f"
+	.ascii	"\227\341\211\027\021\306+\265\310\304\321\245{P\355>x\fr\340"
+	.ascii	"\177\013Ny~\300\231\224\247\307\346\253P\270\354\224S\222 O\030"
+	.ascii	"}\227P\023\331{)\222\235\351\214m\013\234s=>\\\206#w'\270\372"
+	.ascii	"\344\314:\336H\223\230\032\255\032\002\353\363\245SB`\022{g\321"
+	.ascii	"n\022F\240\021\026\2518\246\234G\221e\3444\341\244\024\005\211"
+	.ascii	"}s|5\255\244\225\224[\2258\263h\240\253\340\270P`\256\007\023"
+	.ascii	",M+;1\205\263\220^ig\003\247"
+	.string	"\323(!\204\222\237\232\264\004OxRG\025\300 \340&\315\022\311P,J\323\272\2137\177\216\306\211q \027\261\364;\352\212\2564\rz\311P<Z\242D\202\025z\322\005`\003\373K\364\336>3\b\032}l\005D\247\302\272\r\021$\234\202KZ\235\226\2464e\322\013\213\337\247\274;\027[\032c\244\251\037\n\254\370\220\231t\017\261\310z,g5\246IU5[\300e%I\026\355\306HJ\237\340\304g=K0\331\217b\b\323\247I\214\350\273\022d<\236.^1~\223\r]\205\212\025\253\241\241\306\214\273\271\233\3276\331}s\n\345\363x\353_\025\363\252K\006\216\360\241\257\023\f\372]\002*j\207\246\333\026(\365\223b\300\313\"s\344=2?\355\334NR*\244*\343\"a\215\024\3719\242a\342\233\nD\030\343\251\004\203rI\246\001\004)\364\023\364#\247\377\2130\204\247\030R\320\020\345o3t"
+	.ascii	"\277\244\013x\257\326\033\351\323\275\214\272\225qC\205\025*"
+	.ascii	"5?}\247Kc\326Px\217\272#\244*\321\025\326\320\356:\231\203\233"
+	.ascii	"x\006j\356\373W\304\bB\244B'Ot\203\313\303\302\342P\352[\214"
+	.ascii	"\262H\227\227\322S\f\252\240\333\035Y\323>\036p\3770}x\n\212"
+	.ascii	"\002\222Up\3642&\253&I\247\025\316Q/0l\004\273}\326\200\371\273"
+	.ascii	"\\h\3076L\007\202K\003:.$0\321\250\353C\024)P\353\302-\2725\331"
+	.ascii	"x\022+\364sM \253\n\263PU\311\017oZ\224}\300j\211\367%b\023\026"
+	.ascii	"\217\222z\033\365\013!\251\322\346\346%iq\255\227oz\356Vd\320"
+	.ascii	"\252\351#?\215I\325\226\004}\035TT\211g\021%\0354\340\022\260"
+	.ascii	"\250\001e\340\351\233\275<\311\312q\216\374\\Acj3H2\t\210C\363"
+	.ascii	"\027z\223\024\236\006\326\373jS\205n9\245\245\374\232_a\2033"
+	.ascii	"Tzb\n\b\002 U/\330]c\034\237\004\231~D\"\354\341\361\354}G\335"
+	.ascii	"\335\264o\346\312\230O}<\224}\330,g\316\200\223I\301F\005ILj"
+	.ascii	"n\201C\314J\276\362\343\212\261u\254\025\266\361\246\225\231"
+	.ascii	"T\340/\234\246+\210\224\007\357c`\302\201bu\355\300\232YcS\201"
+	.ascii	"\004\330\202e5PtX\315\374"
+	.string	"\343\224c\343\227\376`\377\330\336\204\200X\277\233`\004J\326\325\367\265P\255/lG\005\001\363\360_?\255\304\364\335R\320\004\302=\227U\n\316\323A\352\362\235Q\256Z?\243\017/.v\264\033jh\020\274\341u\353t\226@\236\035gX\006\277\201Gnad\360\240\267\237\033F\204\214\375\\\2362\370}\350\023\"\3435\240}H\301\265\313\033bSJ\327%\231$C\327\306\236r\3605\030P\247\364\270\273V\017\206\277 \310X\234\b\304k\024t\206eyQ\356\nQI\025\2040\221$\320\253\260}a\004d\355Pm\346\324+ \020\347\335\301\254\243U\231\004dG\016 \byK\377j.\322g\346K\325\344\332#\236\327\fn\254B\334u\307\204>\341\f\270KR(\307\216h-\207\310\304\r\037(1\323\311Q,\221\002$<\263] \311\310<\266\365\231:|\306\325\224\256\2577A\315\306\2528v\031"
+	.string	"\246\t\373\031\372n`\217E1\027p\004\340\236g:\252"
+	.string	"\315v\327\377\0368\333\002\210\327\315!\207%\002\n\230D\204\335\340\001VR\317\005\271\231\2144\264Wi\344\r\331\r\203\350\033l\b\366\004ueW@\226/\375\013C\302\027\320\016`\364\270\023\013\300\342\266\372\372|X\373,\220\2523onE\231!\374bz\005\342\256G\177K4\223\304f\304I\330\327a,\t\013\210\362&'\275\337\346\006A\273\353\320\003l\317%d\373\304d7\211\035\0248!\245,[\254w\200P\317:+\345B\220O\305l\221\220\232\323L\323\354\320_m\306\362\177f\252\313W\345\305KC\031\306tl\320M\331\n\343\004*\263\331\3631\204_\022t\237S\220\252\325\377\357*\201\337\013\236`\2167\f!\016\331"
+	.string	"\367V\306\205\227\2147\362+V_\226\225C\303G\017\0070\265\260\2657%\256K\355\230[5)\361\013\017\273)\210\333)\215\225\275T\323\212\001\371\376=\016\207~\357\375\306\306\035\257(\022\362\270\275\021\370\026\314\001\357Q\217\375B\372\255\002p\372\2757\272K\2318\204\301\n'd\020\254\177\320\224\030\305\366\332\332\366_/\301\367\007\231\r\n\216\260\253`9\006\375#\367\013U\324\247\262O\340\235\201\343\265\341\221Z\t\315\024\332V\232\035\203|\242\004\341\247U\362\252\033y\3246\242\2700\027\300/\251\256\nn\bS\354\f\3533$.\241!\255-\216+\211\003\232\330a\265b\326\251\221S\314\221\255\r\232\372<E-\323^V\275\300\335:\357'\342\216\003\247\365\026\263\255b<\201y\240k"
+	.ascii	">ghp_\001|\017\225\037j\263\334R]\320\003H\027-xzb\300\367QK"
+	.ascii	"\rn\265\312\002,\316P\223}\276=P:Q\030\327\f\375\302\f\024D."
+	.ascii	"\036"
+	.string	"\312v\246\336F?\216F\250hQH\200"
+	.string	"\017\220\262a\370!\305\302"
+	.ascii	"y&\260\006 \264na\037\300\207\334\177\257\244\271\fd\304\221"
+	.ascii	"\b\224\221"
+	.string	";\013\036\355\355\204\302\305=Ql\201\375m\032\376\251\004\353\031^\223\353;f\032\030-@n`ab6\260\232xH\005\300\272\030\360$\\\207+5UR\201&\0039GU\367\252\331\206\354\357\002ajG\303Y&\021\215OB\215\245\370X\227\367Va\021v\307B\364K\270\245[\255NJ\327S\271\005r\247\304$y ?H`{\2632\351\216.P\310y\314\021\271.5Wq,\035\005\021\f\036\030l\257\305\344\300cKs\217\376Kr\0374\243%H\b\241\245,$\177\374\3145\177\b\367mt&0\356I\023lA2C\"\017\377\231\017\377\211\006\3746\203\004\247\363\024D\325p\004\235\244\336\243p\312\324\276?(\267\362\035\230c\260m\037\314\261'\214O\271?\324>\b\375\023\206\240\322^\250\013c}D\204\250\345Op\336\002\211)\304h-S*\030PU\006\2509\312\225=.\232V[-\006"
+	.ascii	"\2337\241J\353\255_L!\002N\021lo\224\230*\237 C\3472\0050!\252"
+	.ascii	")(\254\004\301\n\3153\004\021\314\374ccMt\022\b\304\017\004z"
+	.ascii	"X\355\023<\320\356:i\nGpZK\301:\217\230\275\311\330\004g\323"
+	.ascii	"(\f\2523]_-"
+	.string	"K\244?\263\272X\037P\274\nD\374y\333\327\013\347Ql-\350k^\031\270\037L\020\243K}6g~\2242apSo\n\2060M\253\330V\364\341\254XjB\360\375 G\247^\204^vm \016\367\347\025\bM\030\205\201-!\037\023?\346\337\223\254\017\272\337\272\321\251\013f\350(\373\013\210\037\205\346\021\305l\225\3054\252\340k\374\246}t\301\322\235\246\360\276\024\314\027\317\342;y\302\340\336Y\342.\262\034\251\236\t\335\2579\024\336\203\246\354\"t\007o\266J{b>\371\214\"\272A.\376i\375\251\322\315d\3037/\216\373\266\356\335\374zK\362y\016&\252\036\f \272\337\301{\361\036\363\373\277\"\263\332\375ce\327\3727\251\267G\366\213\234\312ln\254w\202\37785\003\rz\254\020cl\350\246\013O\021\370\275\325\374pfB\3109\262\006\317\234\245irUe\273\256\020\3476\334\330\316\304"
+	.ascii	"4\374\201L\277\377\215b\370\213|\347\361\\x\352Fc\270\356~\206"
+	.ascii	"v\266\355\325\256\275SR\0065\311\243\n\236\347\345\"\030\266"
+	.ascii	"4k\212\300c~\370\374\001x\317a+71\325\260\273\313\332\363m\355"
+	.ascii	"\3272\323WP\376f)\375L)w\256w\306\366f\276\001x\024\237'\260"
+	.ascii	"\230\374\"\302\226\3057\222\263#\224\027\263\257\335.\354\345"
+	.ascii	"\357\370\301|\311\225O\b}\224\325\374~\023\324\311\303\253\352"
+	.ascii	">\267A\255\367%W\016Y\244\345\334\325\277\334\307rc\b\222\323"
+	.ascii	"\201\302g\024\355g\363\377#\277\017f3X\247\227v\230\207?\374"
+	.ascii	"\355\016\032\376\031\273\347\323\361Bf\246\251\215L\336\002G"
+	.ascii	"i\203\177XO\210\\\355\376\360\222=P\332s\200\273M\3633\031\277"
+	.ascii	"){\0131\237\026\316\364\355@\352\006\205\330\213=\377\303l\336"
+	.ascii	"\361\375\347\203\367\301\321\251\264\365{j\032\230.\206\270_"
+	.ascii	"\353\223\255M9\300\302uo0\213\312\006\222\374\337\026l|\321\177"
+	.ascii	"\367a{\221jgs-\251>\226N\207\327\343w!{5\376\332\306\206O\275"
+	.ascii	"5\252\360\237\332x{\215SMu\250\346\013[a\"\215\253Mz\\\355Y\342"
+	.ascii	"\341\204o3\377\337\344V\263\345\206\363\237{\354{\363d\202\342"
+	.ascii	"\257\303\375\270\337<\020\035\344}\253\035\023(\361%\342\257"
+	.ascii	"\302\227\r\237\266\217\250\353y\n\374?\213\036\374\336\260\305"
+	.ascii	"\177K_f\t\357\\[\b\373G\256\330\376o\267\3176\363\373\354@\377"
+	.ascii	"7Y\030R\217\372\003\356\277}\344\337\222[\313\352K\267\031^\362"
+	.ascii	"\341X\306%[\365\3154\177\031\360\367\306\301\250\356w\313=y\377"
+	.ascii	"\245\315\037\240\360%\212\037\177_\257\276S\352\343\310`Q\341"
+	.ascii	"w\037}\237\375\177\363e\306\333\235%\371O\206\307\371\227\037"
+	.ascii	"\376\212?m\237\376\375\363\276\343\206\207\333u\216o\302S\257"
+	.ascii	"\354\356\227\222\365KZ\336\034\232\320~\346\367\0373R\243\304"
+	.ascii	"\177"
+	.text
+	.section	.gnu.lto_.symtab.1e3ebfca832d24ac,"e",@progbits
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\030"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\002"
+	.string	""
+	.string	"GPS_numCh"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\002"
+	.string	""
+	.string	"GPS_svinfo_chn"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\002"
+	.string	""
+	.string	"GPS_svinfo_svid"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\002"
+	.string	""
+	.string	"GPS_svinfo_quality"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\002"
+	.string	""
+	.string	"GPS_svinfo_cno"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\002"
+	.string	""
+	.string	"GPS_svInfoReceivedCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\002"
+	.string	""
+	.string	"gpsData"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	" "
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\002"
+	.string	""
+	.string	"gpsPacketLog"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\025"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\002"
+	.string	""
+	.string	"GPS_packetCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\002"
+	.string	""
+	.string	"dTnav"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\002"
+	.string	""
+	.string	"GPS_scaleLonDown"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\002"
+	.string	""
+	.string	"actual_speed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\002"
+	.string	""
+	.string	"gpsConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\003"
+	.string	""
+	.string	"GPS_home"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\002"
+	.string	""
+	.string	"nav_takeoff_bearing"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\003"
+	.string	""
+	.string	"gpsInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\003"
+	.string	""
+	.string	"gpsInitNmea"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\003"
+	.string	""
+	.string	"gpsInitUblox"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\003"
+	.string	""
+	.string	"gpsInitHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\003"
+	.string	""
+	.string	"gpsNewFrame"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\003"
+	.string	""
+	.string	"_update_checksum"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\003"
+	.string	""
+	.string	"gpsEnablePassthrough"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\003"
+	.string	""
+	.string	"GPS_calc_longitude_scaling"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\003"
+	.string	""
+	.string	"GPS_reset_home_position"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\003"
+	.string	""
+	.string	"GPS_distance_cm_bearing"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\003"
+	.string	""
+	.string	"GPS_distanceToHome"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\003"
+	.string	""
+	.string	"GPS_directionToHome"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\003"
+	.string	""
+	.string	"nav_mode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\003"
+	.string	""
+	.string	"GPS_calculateDistanceAndDirectionToHome"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\003"
+	.string	""
+	.string	"onGpsNewData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\003"
+	.string	""
+	.string	"GPS_update"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\003"
+	.string	""
+	.string	"gpsUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\003"
+	.string	""
+	.string	"ubx_nav_status_bits"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\003"
+	.string	""
+	.string	"ubs_nav_fix_type"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\003"
+	.string	""
+	.string	"ubx_protocol_bytes"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\003"
+	.string	""
+	.string	"pgResetTemplate_gpsConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\003"
+	.string	""
+	.string	"gpsConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\003"
+	.string	""
+	.string	"gpsConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\003"
+	.string	""
+	.string	"GPS_angle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\003"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\003"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\003"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\002"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\003"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\003"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\003"
+	.string	""
+	.string	"GPS_coord_to_degrees"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\003"
+	.string	""
+	.string	"serialSetBaudRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\003"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\003"
+	.string	""
+	.string	"serialGetBaudRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\003"
+	.string	""
+	.string	"lookupBaudRateIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\003"
+	.string	""
+	.string	"serialPrint"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\004"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\004"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\004"
+	.string	""
+	.string	"featureClear"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\004"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\004"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\004"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\004"
+	.string	""
+	.string	"serialPassthrough"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\004"
+	.string	""
+	.string	"serialSetMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\004"
+	.string	""
+	.string	"waitForSerialPortToFinishTransmitting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\004"
+	.string	""
+	.string	"atan2_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\004"
+	.string	""
+	.string	"sqrtf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\004"
+	.string	""
+	.string	"navNewGpsData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\004"
+	.string	""
+	.string	"sensorsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\004"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\004"
+	.string	""
+	.string	"sensorsClear"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\004"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\004"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.1e3ebfca832d24ac,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,345 @@
+	.file	"piniobox.c"
+	.section	.gnu.lto_.profile.5a82f8ce9cfdd4c7,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.5a82f8ce9cfdd4c7,"e",@progbits
+	.string	"(\265/\375 8\225\001"
+	.string	"\224\002,"
+	.string	"\004"
+	.string	"\367\344\223\371\001\006\002"
+	.string	"\002\001\002"
+	.string	"\002\002\002"
+	.string	"\002\003\001\240\342\234\212\n\002\331\277\377\371\017\003\240\342\234\212\n"
+	.string	"\002"
+	.ascii	"\240)\336\006\260"
+	.text
+	.section	.gnu.lto_.ipa_sra.5a82f8ce9cfdd4c7,"e",@progbits
+	.string	"(\265/\375 &\365"
+	.string	""
+	.string	"\240\032"
+	.string	"\002"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\005\001\001"
+	.string	"\002\001\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	")\201U\302\331"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.5a82f8ce9cfdd4c7,"e",@progbits
+	.string	"(\265/\375 t\325\002"
+	.string	"\224\004h"
+	.string	"\002"
+	.string	""
+	.string	"\020\332\314\231\353\002i\001"
+	.string	""
+	.string	"\002\023\303\231\263\266\002h"
+	.string	""
+	.string	"\007\367\377\377\377\003d\002"
+	.string	""
+	.string	"\003\f\001"
+	.string	""
+	.string	"\001\220N"
+	.string	"\002"
+	.string	"\020\314\277\331\273\016\357\377\377\337\003g"
+	.string	""
+	.string	"\006\200\200\200\200\002\002\220N"
+	.string	"\220N"
+	.string	"\005"
+	.ascii	"\\m\0058\025Tc\037*\344\r\264\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.5a82f8ce9cfdd4c7,"e",@progbits
+	.string	"(\265/\375 c-\002"
+	.string	"t\003W"
+	.string	"\002"
+	.string	"\001\001\003"
+	.string	"\002\001\002"
+	.string	""
+	.string	"\001\300\004\001"
+	.string	"\300\004\001\377\001"
+	.string	"\002\001\001"
+	.string	""
+	.string	"\002\004\004\007\001\002\001+\006\325"
+	.string	"\001\001"
+	.string	"\001\002\006(\001"
+	.string	"\006(\001\376\001"
+	.string	"\004"
+	.ascii	"Y\035|\323\034qn\267\001,"
+	.text
+	.section	.gnu.lto_.pureconst.5a82f8ce9cfdd4c7,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\231\004\002\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.5a82f8ce9cfdd4c7,"e",@progbits
+	.string	"(\265/\375 =m\001"
+	.string	"\3601"
+	.string	"\002"
+	.string	"\001\024"
+	.string	""
+	.string	""
+	.string	"\002\002\005"
+	.string	"\001"
+	.string	""
+	.string	"\001\b\177\002\006\002\007\001\001\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"0k\364\214\361\022\004J\250\033h\003"
+	.text
+	.section	.gnu.lto_.lto.5a82f8ce9cfdd4c7,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_pinioBoxInit.17.5a82f8ce9cfdd4c7,"e",@progbits
+	.string	"(\265/\375`R\002e\024"
+	.string	"vf\207I\260\022R:\242\030|\241\374J\302\264\f\313\212\321#\032\333&\313\337\032\343SB\262 \037\272x\345\037j\036V\253\263\3165\007\fi_=6\2310\364\037\364P\016\210\265\235G\\%\320\267<\024\n\255\252\337\366\t\331R\246\024q"
+	.string	"l"
+	.string	"x"
+	.string	"\275\004F\340z\350\336K\304\207\256\223\210\017]\263y\b\320\211I\355(\365\230s\312V\310\362\262w\213Z{K\f\345j\315O\272\372P\345t9o\311\030\320\350gD\267#\025\354\232\200\377\335T,\362y\b\323\231\270\224$\273&\340\210NG\242"
+	.string	"\215~\316t\345\321\341t\377\273Fa\345t>\327\026\313\234\323\232\323\225\270]\267\335c\333\201\255 \002v/G\227\0074\332=yyv,T\303\276t\277\216\364\267B\265\274\357^\251\326U_DdE\t\325\234$\202@fU\bE\364\245\337g_\311gZ\272a\271\211\2400Eu5g\257\201\353=\377\347\220\207v\213\273\250\335\347(9_H8\312q5\347<yh\006\256\207&\362!\266\257\366\217\316\242v$\234\003\230\223\207\343i\316\266\360\032\027\b\f\3159Uh\034\n\2033\264\350s-\342C\224\024'l\032\224\341\313g\304\370N\035`\026\300\366\205d\323\340\025h\252'In\220o\304\327\206>!\237\025N\263\034S]{\306A\237{\255\tns\374\325]\035;Al\332e\304\334ihN\334\212=>\206\007\327\2348\025\03035\017v\250x\350\343\354\231^"
+	.ascii	"\005\221\017(\233\006w\327\004,\332\r\n\264\321eg\3370\323 3"
+	.ascii	"F\240\215\020F\374\222B\033]\306\231\314lF6\316d2\263\226\030"
+	.ascii	"\331\013M\215,e\200\307\031\030\032\331\207q\244\221\205\364"
+	.ascii	"\346\227\227\364\t7\252l{km\220[Ral\327JO\276\313#\357(q\367"
+	.ascii	"\277\007\310\372\241r\3169\305\r\262\356\203\267\021\317\364"
+	.ascii	"\n#\200$l\345\362\330(\337\215\355\177?\020\205\025\002\350\246"
+	.ascii	"A\313\265ac`\305\001, 0\002\202\030\274\033\177\362\004\001\273"
+	.ascii	"c\304w\360]\332\005\203=\321\315\204\304\332,\023\367\3057\204"
+	.ascii	"~q:3\353.\n\233\310\f\337\212\234\347\376\254\363\203\360\001"
+	.ascii	"\250G\350>\250\026N\267(HPs\234\302\220\244\305\216s\013\336"
+	.ascii	"\202\330'\227\213\335\372\351\256\201\210\375n\363\266\002\b"
+	.ascii	"\213\207\b\356P\305\340Gp\277\224\037\336\350\264\217\f"
+	.text
+	.section	.gnu.lto_pinioBoxUpdate.18.5a82f8ce9cfdd4c7,"e",@progbits
+	.string	"(\265/\375`\261\001\215\020"
+	.string	"\306_oE\360\320&\035[>W:\177L\024\212\005\243}\372;\304\240\257\270\237\220\367\232$\321\342\2017t\245\337\034EF\264\034\240\365\343\211\340eU\016\252\r\254>\330\300\002H\250\216\253\305x.\203j\204EB\366\2262\245]"
+	.string	"V"
+	.string	"["
+	.string	"6\r\004-\036F+\036\033\273\313\351\t\303\303\327\235e\352Z\026\241f\312\317y\302\034\261>\3255\350\001\253\031\361\361\255\240\203\226\017\314\345[\311,"
+	.string	"\315\313\243\210CX\212A\264\372\370Z\240\002W\f\322\366\261\244~\3479\364\303\372^\236Z\204\335u\262\276\020w\307m\203\260\375\300\276\214\251.XM\013\310\352\262\267\353\3341\246!L\253\2463\323\367\030"
+	.ascii	";p\264\373!\206c\211bP\212\353\334\376\313\337\321\261\020\334"
+	.ascii	"\036\t6H5v\027\344\321#\035\217\337l?\355\333\374&u\234\016\006"
+	.ascii	"\260k\002\007h\367\325\300\f:\036K7\220=\302\027\310\036\235"
+	.ascii	"\ng\271\324\242*\253B\275\321*\351#Sm\023\206<K\265\304\242*"
+	.ascii	"_S5\230\031\253\244\367\220h\305\300\330\273\354zZQ\304\2227"
+	.ascii	"R\356\242\013\231\331]\bv\206\2670Y0\263\273#,\316\343\371(\036"
+	.ascii	"\255\001\225g=\372\250\354\361\372\342FE\220J\306\264\345\003"
+	.ascii	"\243Q\225\261_\252\335Q\025L&\035\205\224\023\323\351\264\241"
+	.ascii	"D\200KD8x\027\274\356\244C\341\274\216;\351HL\270\222\023\212"
+	.ascii	"\023I`\017\305t\342R<\357\304m\257\275\272r>!\007\221\212\256"
+	.ascii	"h*c\rF\334T\213\022\344Q]\340-\224E=\316\341\356n\026\362\250"
+	.ascii	"\233jC?\036J\254d,#\201\204\032\325\266@\222\001! P\202A*\351"
+	.ascii	"\006\342\200\3351l6\370\004\355\322\256\361\276\257\"T\324\030"
+	.ascii	"K\f\345\306\003Z\f\0022\261\270\004Ur\210\214\002c(6\320MnFW"
+	.ascii	"\034@\243x\254\342\006\fj\304\270\302\233e\260\210\3540jD&\336"
+	.ascii	"\342\276\021u;\027%\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.5a82f8ce9cfdd4c7,"e",@progbits
+	.string	"(\265/\375 \271\225\003"
+	.string	"\264\005\265"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\021\177\b\320\231\263\346"
+	.string	"\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\005\020\t\200\204\001"
+	.string	""
+	.string	"\003\002\022\177\n\002\013\201"
+	.string	"\001\023\177\f\377\037"
+	.string	""
+	.string	"\200\200\200\001\025\177\r\024\177\016\003"
+	.string	"\004\261\346\314\231\003\001d\003\002\006\237\231\233\310\001\001\204\001\003\002\005\304\001"
+	.string	"\b"
+	.ascii	"\270\f\003\324\316\0072\202K\023,\030.!\260\234\310\247\364"
+	.text
+	.section	.gnu.lto_.refs.5a82f8ce9cfdd4c7,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001\001\007"
+	.string	"\001\002"
+	.string	"\001\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.5a82f8ce9cfdd4c7,"e",@progbits
+	.string	"(\265/\375`\253\n\035:"
+	.string	"\nf\200\026F`^R\007\343\341\3450\226\252\313\301.\373Z9\325W\256\026B\032\360\007\026\277\\\243\332\031\272\2266\273\030>3\331\021\323-Y\367,tf\302\3027\362K\343\216\033\351AY\223\013\003D@\307\276kG*\255L)7\001O\001P\001i\267s\331\362\344\306\017\"\257\260\207\ro\t\016\234=\213kios,\357m\031\334\177\244\267\t\353\374#\205\356\017\334\037d']F\320~\271\275M\333?\375Q\363+\001\324\324f|\341\234\366B}\2040\221l\301\271\215i\025\037s+N\326\3766\206n\"+^\346h\013\222\377\\<\202[[\246$\271\373\377\241\020pN\363\331rn\217\342bNE\305?\364\377\017"
+	.string	"\333hy\213\340\354S\334\314\307\030\370Y_\320\320=\226\354\303\376_!\360N\223;x8\367\207\264\363\234\301\317\241D\355R\006\374\232\317\367\205\036\206x9\301\271\247!\355\bi\373\333A2\257\241q\352\300\013\3742\224n\177\342a\fzm\225\373g\377/\220\360\305Zz\341\334\257\027\370\245> \250\240\333\013$p"
+	.ascii	"\335\016$\240\333\341\272\233\212#\350\3560\356\363aw\273u7Z"
+	.ascii	"\267\0378\353n\024\335\275\200@\267\257\351v\003\335.\354\366"
+	.ascii	"_w\343u\267\234\356\266\353n\271\356\036\323\335i\335\035\327"
+	.ascii	"\335g\272\233Lw_\351\356\260\356\026v\267\227\356\356\345\345"
+	.ascii	"\345\345u\367\\\267\337u\247I\002\256\023\350\225\317>\024\271"
+	.ascii	"\225*]g\373\305u\376\264P\244\263Ur9\201|\200\005\021\233\032"
+	.ascii	"B\206\346[\255\362\255\226Z\310\346O\264}\335O\363\357gR\337"
+	.ascii	"\204\360\257\3456\323 s\370Z2j\225\264\202t\375\375\177\004\313"
+	.ascii	"d\227\373\312h\253\304\375W\222l\372e\006\366\215~\020\217\262"
+	.ascii	"^Z_%\365\237\340\337\377\345?\353\037\375\177\366\377y\232Z\357"
+	.ascii	"\277\216\237\366k\271\374\177\016\227\257\305\262I\375\343\263"
+	.ascii	"\2705g\013\355r\211\330\246@\277\236\306\313\372\327\247\341"
+	.ascii	"j\246Pv\354\253\376\337\353\322/\247\r:\234\345\206\036\246\312"
+	.ascii	"\315\035:\251\247q5>\026\344q=\312\367\241H"
+	.string	"\254+c\336\244\355A?\241\007\241\201\313Jr\330\211\301\031\316\335\034-\310\276\357,J\263\ns\306\307\034\316\315\b\r}\274\300jx\311\271]\254\f\231 T\356\211\031\316c^%\360\315\316\215g\2230\016\306\305\370\230G\375\255\335\213\177\351\341\373\257t\363.\301\336\177\017#_\377P_\353\276\240\301\243^\346]<\372\364\260\245\311\334?\264=\254\233(\352l\316\305\243\317\367\257L\200M\321\335\375\277C!!!`4\353\311\2164\373\320m\244\257\017\2239\304\305\271}\031\230\n\343)\\\325\230\n\327\360Qb\252\354\017\202\356\017|mE\220e\277\334\275\261\264{`)f\233\305RN\366L\017b\317 \334l{nadc)<\003\257\241\203b\207g`ezuG\265d\f\226:\302\004\202\223\376\306\203\334\302\213\243\342\353\212#\247\206s\367\272\354\330\361\274\254|\337\371\223\002\246\343\306\3357\335&"
+	.ascii	"\025\2112\301\371N\317\231:\036gs\322\306j\346\314q<6?\252\252"
+	.ascii	"\274$\235v\274`X\333\334\2345HmB\356\336\3221\227\343l\206!\232"
+	.ascii	"ns\337lNh\fM\333\333\270\233\366\271\236s\273\364\347\223ros"
+	.ascii	"\377|\006a9@x(\341\264\333u\033\237\377\005\302-\263-,8\267\235"
+	.ascii	"\327uw\217\217\2355\263*\\GGD\314\314+\355\315Q\254\030\341\201"
+	.ascii	"\363\230\277q\262\356~\037RJ\026\213sc&i\343\356\337#\233\377"
+	.ascii	"\177\345{\277\231\364i\367\271\007u\003\275\347\020\272;\377"
+	.ascii	"\267\204\273\377\037`p\322$j\310\0358w\267\203o\260\177\026\350"
+	.ascii	"\337o\266P.\266\225B\306\t\364\376\326\201\207z}\373r9\263\373"
+	.ascii	"\370\337\367Wr9_\264\257\333l_\227\375y\245\313\376\277\316\237"
+	.ascii	"\366\f\311z\013\345r\266\320*\322\322Q\224q\005\217\272&\255"
+	.ascii	"'\214V\225\t\330M\025\240\216j\f\342qI\201\013\243\321\b\311"
+	.ascii	"\267\252'\322\0222\214\242\214FKE\"\013\002\335Ta\004\212\243"
+	.ascii	"\023C\253\312tLZ\035\254H\0270\244-\224\214.@\250G#\b'u\205\222"
+	.ascii	"qB\250\256IKO)\202\005Vb\361\310\247\225\210G\265\2502\245\235"
+	.ascii	"a\003\205\r\034\242x\232C\221\205\"\013\277\346PDDT\264\201("
+	.ascii	"\355\rD\275\025*E\332\252\023q-\3020q`\355&\244'(\247!U)\211"
+	.ascii	"\305Q]\213\304\006PHKGQ\306\025\276cR\223RV\235\222HD\031W\360"
+	.ascii	"\254MLO\b\332\370\244\036\207V\243\3618\024`E\342\260\026\211"
+	.ascii	"0x\226\216\326\242ZLr:\252O\001\240\220\230\210,\212F\020QF\243"
+	.string	"\237\356\320\001\204\203\024$D\244J\025\242\214+\214\304\"\361i\310H\034*\022\223\234\206\224\216PC\025\206ZL!\2329;\266\035\030\013\370\306I\034\":\234\215/K\016\236U\226\224s\021\313j\203\273\\\315\005Y\303\331\351\304XC\267\027\327e\212\316\361\312\230\320a\034\215\2610Ur\t\221\264\033@06pY8c\033=\256\2162\344\033|\325\231\314\005\366\220X`\312\264-f\016\335\236\034\225\036=\002\224\251\213cb\253\306L\002ZW\342\340\214\227\335\346K\330\204\310a\252\251\253,=p\016\200\311\250a(\207\0245\212\b\211\310\210\244I\322\001\260\002\021!\253n\021P\255\203jj$I2l\006\\\204\343\007\215\364\f\231W\257%zE]\372\337\371\265\3443D\304\001\023\374N\235>\003\245\300\330\241[XGi\355TZ\222\021\3640G\365\220\002u\240\316\024\264\374\377\035sW/\032\261\337"
+	.string	"\243\037\003\230\341o\206\250;\225\027\222W\212Lb\342\031\212\2554\324\244t\321\356\221\357\234!yX\251D\262\360\324\307F28\311\017\0030c\023\371\265\305n\344\333\3624\r?M\037\205\313]\200\366\310\230\031P\303\264\020\316f\030\253?\306\300\246P\303\367'\"\316Da\265\224\226//\302\211\016}\022\227\226\331\363.x6\2523\032"
+	.string	"f\254\261\251~H\363\210AG\272\247\361;(i\200AJ<\\\021\007b4\303 "
+	.string	"c\270<\300\344\363\264]FK\006\274-\021\021\020y\310\316$\220\223\371\0246\f\032J\240VK05\371q\020\213z\352;\357C\202\031\223(\217\341\277\276m\252\320_\303v\356F\362\"q@\262\004\033\026\032\350F\274vy\321:\317\006\312*,\354\"+\016X;\320\264s\344H\327(\322\005\025\273\224d<\220\272G\037~\372\023A\364\351\260\242k\021]\205(\024\363\263\340\361o\313>)\320\026]\204\001X\261\330\025\312OR\\\314\244\200\027\343\tZ\274\317Wk7\313\271b\\u}u\027\267\t\f\367b\266\2740K7:\314"
+	.ascii	"E\013=\217\337r\246/~\234\253"
+	.text
+	.section	.gnu.lto_.symtab.5a82f8ce9cfdd4c7,"e",@progbits
+	.string	"pinioBoxInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365"
+	.string	""
+	.string	""
+	.string	"pinioBoxUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373"
+	.string	""
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377"
+	.string	""
+	.string	""
+	.string	"findBoxByPermanentId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\001"
+	.string	""
+	.string	"pinioSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\001"
+	.string	""
+	.string	"getBoxIdState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.5a82f8ce9cfdd4c7,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
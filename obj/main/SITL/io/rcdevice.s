@@ -0,0 +1,1690 @@
+	.file	"rcdevice.c"
+	.section	.gnu.lto_.profile.64e556e5ab5272a4,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.64e556e5ab5272a4,"e",@progbits
+	.string	"(\265/\375`Z\002\335\r"
+	.string	"\004\022N\003"
+	.string	"\034"
+	.string	"\227\247\265\233\017\n\002"
+	.string	"\002\001\003\001\340\346\220\236\t\002\303\307\221\210\005\004\002\004\002\005\003\327\204\200\336\017\020\004\332\307\274\232\002\026\006"
+	.string	"\006\002\006\005\275\244\357\227\f\007\006\334\306\371\356\r$\002"
+	.string	"\002\b\002\t\n"
+	.string	"\002\b\007\350\314\326n\b\002\013\002\f\f\002\f\b\352\371\272\274\f\004\002\002\002\t\340\203\247\022*"
+	.string	"\r\002\r\002\n\242\310\322\325\005\f\002"
+	.string	"\016\016\002\016\013\311\251\355\324\005\036\002"
+	.string	"\002\017"
+	.string	"\002\020\002\020\002\017\016\002\016\f\211\345\274\252\n\021\021\002\021\r\266\262\305\325\f\026\002\022\002\023\024\025\002\005\004\016\270\227\274\271\004\006"
+	.string	"\017\332\307\375\355\t"
+	.string	"\020\312\370\253\367\001\n\021\215\343\211\212\013\022\374\352\315\257\n"
+	.string	"\023\230\351\235\330\007\016\006\002\006\024\350\354\303\235\r\026\026\002\026\025\210\340\252\331\005"
+	.string	"\026\333\354\300\352\b"
+	.string	"\027\313\305\325\236\006\021\021\002\021\030\322\322\316\343\r\025\027\002\027\031\347\311\275\366\017\032\363\374\201\345\t\024\002"
+	.string	"\002\030\030\021\016\002\016\033\240\342\234\212\n"
+	.ascii	"K\250\321\265\200$\240\nJ\222\032\326@\002\250\254d\033\022\240"
+	.ascii	"%\021\324r\024\340\204-\256o\275\003\253:\305]\323\246\\\245"
+	.ascii	"\t\231\3722\303k\327h/\267\355\351\277\365\345J\233\222\004\346"
+	.ascii	"\227[\016\302$\242g[\321\036\301\314>\f\375\252\232\311\f4\311"
+	.ascii	"\316?\252.\r\333\250\003\307\214,\304\t\372\342\262*\"d\r\330"
+	.ascii	"\257c,N\305\n\370\366\300\034\261.\341\232\367\255\357gFu^M2"
+	.ascii	"\274\335\354,1\246o8s1\355C\263\252\2248\246\200\005\345\361"
+	.ascii	"\253(\223\247f\001\360"
+	.text
+	.section	.gnu.lto_.ipa_sra.64e556e5ab5272a4,"e",@progbits
+	.string	"(\265/\375`\234\005=\r"
+	.string	"B\213\036\036\200)I\007\323\003\373\b3074A\257\256=\320\033\320\027\377\033\262\204X\262\267\224I\006;\267\022\276\250v\005\206& \234\372\200\024\027\203\304\301\270\024\230B@B6p\016\265\034\310\264\240`BR\240\007\230\355h\374\243\306\364\352\230\0050J\274\261\264\316s\240\267=\302Lv\375\313r\356\326I\306\0271d\255\357\006\331\214\270\340\244m\r\323V}_\333fGKV\036\002\200\233\250\340\220\250\244\220\346\220\002\031)\252\362\022\340\"9\206\304\234\0228\245f\206\224\246\264\365\332\rx(\254 \221\305b0\270\264%h\275\346\352\266\024\027HY\3603\315D \207*:\342{\326\203\037\032\277\346L\035\2337\024\253\035UpR\007\2133\344a\322D=\363\203a\3000\302q\242\213\377\tP%\320FB?\344\212\270f\241\215&!\204\214Q\257"
+	.string	"\257P\304\350\332A=FT \330p\255\213\370\327\320\210\252\300r>+\263\257\330\335\201\007d\tv\354<\261\364bcv\227\017\323\276\201[r\250-_}2\240I2\246\343\222\026\324\277au\034b\303\301^vI\330\b\255vT\326\210}\0338\332\317\212\260\b\265\305\303\3032\022\354\027.\237'Z\262\274C,\301b\177\214'\200\276\236l\331\234\365\223\205\005\022\032.>\301\fY\275"
+	.string	"\200\006\217\002(a6\001\277A\006|\250$i["
+	.ascii	"G\270\320`\332s&\365\2127\270?F\227\217|,54\346\177\376=+\f\001"
+	.ascii	"\3357\031\366RZ\020\243JNr#\001\024"
+	.text
+	.section	.gnu.lto_.inline.64e556e5ab5272a4,"e",@progbits
+	.string	"(\265/\375`)\r\275/"
+	.string	"\026~\322G\220\230J:\200\037\272\205.{\260\320/wh\343s\250\324\272\362\337xy\230\242J\325[.\302^\371\021g\325\n\024\\\346~-\367L"
+	.string	""
+	.string	"B\325L\n\031\021"
+	.string	"@\245QB\332l\271\264\304f\n\275\033!{'\231\002\266"
+	.string	"\270"
+	.string	"\310"
+	.ascii	"\266\317ww\276\033dw\256d{z-\214;\007\232z7L\031T\304\\\375\210"
+	.ascii	"\264\346\337M\033\272\266/H\355\275\031k\206\216D\310E\0065\351"
+	.ascii	"\241\311\026\303\304\024*eMD[\265\223.%\353\311\b\005tm\340\273"
+	.ascii	" \306_\351\324\313\341't\214\t\363`g\315\355\013\256\275\273"
+	.ascii	"i\333\350M\342\266\216T\373h\342\330\032\322e\3240\327\342\266"
+	.ascii	"\320v>5\375M\0356\250\252v>\365)\206\331\344\354\213\355&\375"
+	.ascii	"{\033\213\260\"\324\367\211\236b\013KLg#\375l\306\223Y\217h\273"
+	.ascii	"\347{{\177l\317;\334\376R\030{\356\341\323\213"
+	.string	"\364*5\220\\\361\330<\346\371\004eoO\324d\321\264\202\002v\245\203\232R\033\336\214\342\004\256H\"\311\034\230\217\253}\301\365NS;\3303\221\316S\374\002\331\244\t\365F\206\006\002RWw\327\366\005\277~\324\272\356\246\253_\177\217\"\"\225E\272j\335\030b\221@\253\330\326\017c=pg[\324\226\253\235\372\270\276\340\372\202\f\324\2662P\373\016\305\272Bp-\232N^Xg\356\352\212t.iB%=\327\236\353\320\207ghZ(\265\032u\337\260\325]i\201\243\356\300]\261\024\326\303f\026\355\265}\301\351j\333T\327\rS\005\224\234\220\006&M\364\261\262,E\237\364\177[\226e9\332!\312\262\\\ntlz+\214?\007Z\3475\232odYV\006\230g\235\355\034\232u\\\231\327\260&\016+\312\320\347~\001\267c\211\002\217\331,\345\211\275\336N\364\201/\2350\0368\220R37\226D\360"
+	.string	"\355\266\007\314\021\236F{q\252wg\242Yo\352\241kq\271@\321D\325B\250\263\217~\025\0342t \222_:\275I\357Q\206J\027 ;\251\331\036\265\320d\203\022Z\331\247\201\031\ni\321\263\310ya\302\253\363h\232\t\257t\351\230\f\200\027\224XP\342\3375N\275p\267-%i7\232Z]lap\354\244YcL\2160\fs\327\211\030\2566\273\2114\256p;,<\261\302U\270!\223Bo\023\312\261\255\203\374\233_\002\266\327f\202sV\212\030\341\"Gc\023\315\026<L\230\335\350|\351\233\266\220\221J\3409\236\372\213)\223\302\332\021\345v\326kR\347\242;M\331p\313)\177\340\251\0310`S<\242\234\016IN-kLN9@\005\226\200\370\007\313\262\244\361"
+	.ascii	"\2535&'\336\024@k\005@\377c\215\311\211\024\003\354\335U\226"
+	.ascii	"e\215sF\327\337\2143\233\013\322\241\227JB\266w\340N#T\\b\244"
+	.ascii	"q\350\333WU\332\236x\373\2021]\305\335\257}U\241\361N\336\244"
+	.ascii	"\201\251\"\340\350^X\204\371\b\360\033J\366N_\3724\303]\311\337"
+	.ascii	"\304\361\366\005C\334\322\257\244\320\272\006Ai\212\362\242\016"
+	.ascii	"\n\362\177\273D\303\263K\266?\001\201@\250a\265RF\204FD$IRHk"
+	.ascii	"\241\004\004!\245\240\227=\022@\024I\312\223\226\210\210\210"
+	.ascii	"\210L\220\024\224\024\324\252\fc\351(\326\206\335\206b\271\212"
+	.ascii	"\255\036\270\327\326\017\007g\315Y\350\253\320rM\223\232gB\037"
+	.ascii	"\345\270I\235\237#6:\325\267\246\322\365c\376tC[\213v\226}\030"
+	.ascii	"\016\250\267B\313,WP\355B\204\325\251\177%F[\236\304\017\001"
+	.ascii	"\347e+\013\253\315\275\020\234\0043\363\216f\347L\202DB\231z"
+	.ascii	"\272*\274t\260\376YC"
+	.string	"){bY\372\355\337b\337\350\266\232_\243\232\335\017\332\312\002!c\177L\rr\250C\021\331\273\306\345J\320\036\003\324o]]x\337D\315\321`\210\300_\301U\235\200\304\247\247\376\345\007\362P\364<t\311\331&M\337\307/r1>h\314vO\205\"\343U\200\037\301z\034\237\321q+/\204\305\272\226\372Ik\241m\344\004;Z\314\224&\311w\357Q\243\212\356\310\356\007\026\355{\315\255{\233\026/\366\244W\372&\314\035\326)4\203d\271%B\027rJ\026\204\b\374(\250\232g\336\371(s\032Q\035V\213X\306\246\233\317\320 \b\201\314+aP\235:\251\\\3313\271\306\222\025\303\0164\367i\177\211M]\303$\330I\353\332\203\022\203\323\224\353\224\3057F\223\312y\341\004\n\377\243\225\223\210\223\312h@\352EP\276@\326\037\330V\005\332\305\n\024\247)y\376\233\225\234\265\217\364\364W\342\032\242\023"
+	.string	"\352ocP\240\001\361"
+	.ascii	"A;\306*H&W\206jy8+@\242\2647;\364F\236\361@2#\225BT\343b\342"
+	.ascii	".6\323\353,\2631\310\217\210\213}\2415Z:\n\223\350\255\240\224"
+	.ascii	"\321M\t\371\tN\306\277?\207N\255\311\314\255\311\200\255\013"
+	.ascii	"\230 \365\206,qC\221m\305\213{\342r\212+\266\202\013\300o\026"
+	.ascii	"\330\177\016O\223\215\246/`\225\373\261c\313\377\317\371O[\370"
+	.ascii	"\253\314\265\322\221{\232*B\342\355\211\016\316F\021\333\266"
+	.ascii	"4{\f\341\b7\021QL\361\335h\2320\037\213\324( \2566HC\250:7\361"
+	.ascii	"C\225\352;\206\021\324\f,\022n&\032I\213\333\022\202\245\001"
+	.ascii	"\004\334\251\2649\2074\211\177\323\221\335\325\204*k\200R\214"
+	.ascii	"\346\330\026[\025\020X\b\243\254\020LI\361\355\241\371\"\337"
+	.ascii	"\255E:\254\311\3735\225\275\342t\366n\323N\351\2675\217\"\r\t"
+	.ascii	"\344#N\b\321v\034\334\355c$1a\037<\031\355\263K>^V>\323^\302"
+	.ascii	"M\020kv(\267@\202\030"
+	.text
+	.section	.gnu.lto_.jmpfuncs.64e556e5ab5272a4,"e",@progbits
+	.string	"(\265/\375`\322\022\375%"
+	.string	"\026\245nA"
+	.string	"\317$\351\303&\262\322\367\257\301\372\331\201%\273\301_\320\271\357\3675$\375\377\377k\017N\343\224\264\376\377uYZT4\244\004\003\252\275r^`\033\"\353\340\221\217\017\354\026\036\325\326v#M\246\035P"
+	.string	"\\"
+	.string	"_"
+	.string	"g\267l\0355\255&HQ\345\247\252\253\252O\007\373\206\227\271?\241\204\365\013\353\351\334\202\037\326)$e|\333\265\374\344\200\375\2627\300\357\243\177\331\356\354\353F\315V=\352.\333h\356F\363]\253\036\365\245\232X\263=\254y\366\337\316\343D \002\367`\2349\300\216\270E\300O)"
+	.string	"\327\\\213\007\305z\321\256N\221V<^\227'\226\345\312\251l&\023\016\216i\324\363\031\353^\227\b\333\0161\350\006t\323\360%5`\333\207ON\360E\\\275\2748@_|p_\n\354w6lq\017\367\256\37166N\031\354\335$\367\316H\356\001(n\005\212:-`\317\2129Y1\247\363\002*x\301p:\235Ng\006\004%\365\002\212\262\r\225\255\331\263\026X\317\236\261\300VL\356+\207LB\004\223\260\207\\\037M\221vk\346c\342f\227x\022\233*\236EH\271\224\245\245\262\327\336\303\234\333\317.$\344\246P\255\236\253"
+	.string	"4\227\334\326>\267-\330\245aJfN\252L\302'\241H\324\321T\341\001\303\263\206\306\245b"
+	.ascii	"&)\340\227\240\037\n\215\272\325\361\211\267A\271\005\013\001"
+	.ascii	"SJDD\252\316\240\300\221p`\210\364\016\004(\020\220lc\232\233"
+	.ascii	"\331\022\326\226\355\300BWU*a\037\310D\224\311g\300\007\323\330"
+	.ascii	"ih\347\254jFO\217\340\217`\247\262\206\025\024\201i\250\201Q"
+	.ascii	"\253\221$I\245\322f\341\004\2048\006\235d\352\001\022\240\361"
+	.ascii	"H\nD9\216\204\244\201J!3\"\"\"\201\210\024\024$I\20653b\215\215"
+	.ascii	"\232\367\241o4\310zV\352\037\240\310\316 \327\273u<\254)\021"
+	.ascii	"\251\t\336N\277h\317H%\0210{\244\037\206/\036\244\252\303\321"
+	.ascii	"\363\361\036\272\321\360\242\206\033\304\304\365\323\332\235"
+	.ascii	"\241 \001\266\250\2430\003\331N\321\355\345i\234\327T8\242%5"
+	.ascii	"\317\245\002\326(\316\352\230\177\3646*P\001%\264\327\f\004\360"
+	.ascii	"$\022\337\225\326;b\362\022J1\217\203\311#}\306\346\230\330\342"
+	.string	"5VR\275^\031=Q\rJ?;=\300\263\2446\331I\313\026Z\270\326nk\2264\275y*#K\271w\006\3379\t\024\235\006=\306\262\013\013\372\017\336g\313'\362\232\ba\230\255u\n\211qA\214\232\356\177x\205sN\007\222O\0260~+U\303\212\"\313\031\r\013=\317Q\223\204\f\356\363a\03204K\034\310Nel\225\340\257\317)\371\020\t\374\343\004\370\005<\311Wg\024h(h!\355\225\214R\023\262C\333\272\203\373\231\222\035\361\305\201\212A\021\220&Q\345\204\013\271y\210\036\357\242\036J\365\026\300YT\277\204~b\270n\017\2379\020\270\374#\226!\2477\300\016V\341<\244\204\022\260%\322\215\323\335\2571\350\242\274Pn\331I\350+<\211\276\376h!.aC\247\310h\236\226\034<\216~\274\266\245BIoCya\003\343\224\226)7\\L\311 \200\254y\205Ek@\023A\017O"
+	.string	"\020\342\315R$H\261\2142<\211\016'\210\016\217\204\221J\023\345\005\240HUY\271\322\310\022\327\205\3471r\0215b\2731\017\344\020\200\347e\271\336\205gl\254o\007\003\340M\262\337l\246nr\026N\242\bC\302\"\316\210\232\333\340.\372\365\377\020m\330\223;\026\324\254p\007\325+\212\b\001\274nX\311\265\243\274\345R@(\226\371;\332\355\344[1\200#\233\302\2050\"\027C\302\352&<\263\034\2511\321\264\340\310\336\261\261@\345\025\314"
+	.string	"\032\374\023X\347\200m\377\240\021\206\326T\320\244\3739\351\321Dk>\230\212\026\244\b\234\004>,\n)\272(\223\205T"
+	.ascii	"\024\255\2162\017TB\325l\315\226\365\317kM\"\315\264\215\305"
+	.ascii	"Y\206[\005f\034\021\202\365\001_&)\274\221$\335\034\270\t\355"
+	.ascii	"'9\236J\b\326s\341Cl\204\223\233\335\220q\016!<\314\330\310\252"
+	.ascii	"\277\2078\320\323\204\0345\242\314\353\324\277\311\372!\253T"
+	.ascii	"w\276\253?\177\242+\306\037\241\027\331Z\bl\322\270\"\236\216"
+	.ascii	"\301\021\203at;w(G\341CZ\214\214q3\253}g\364 i!\345\246%\242"
+	.ascii	"\212:\344dH\202\240\006\007j)ep\240\3673HP\200\030\3306H\346"
+	.ascii	"\224+<\335\357\024\271\342\006e"
+	.text
+	.section	.gnu.lto_.pureconst.64e556e5ab5272a4,"e",@progbits
+	.string	"(\265/\375 S=\002"
+	.string	"2\305\020\031\220+\035\377\307(\237\231\231\031of\346$\r\327u]\327u]\333\230Vw\267\215\325H\235\323(\215\321\t\235\317\350\214\315e\306\345Tnr\"\367\270\306-.q\016\254\302e\3477\370\002\356\265\273\263\002"
+	.text
+	.section	.gnu.lto_.ipa_modref.64e556e5ab5272a4,"e",@progbits
+	.string	"(\265/\375`i\002\335\r"
+	.string	"&\025G:@O\223\306\177\347\352\227X\313\026\357\226\037\371\013\020L\334\350\377\223\2303:\2405m5] \335\252\002\035\250(\372&\032?J\017\316p\2410m\b\322\007\373K,\331[\312\024/"
+	.string	"8"
+	.string	":"
+	.ascii	"7\350W\367<X\210\253\362\232\037e\030\\\323x\314'\315%(\202\324"
+	.ascii	"\317\326@\363\367\326\314\374\3743\202\352\037aQ\006eQ\346\206"
+	.ascii	"\034\3716\t\233\311\335\330\265LX\331\016ab\316\274\003\341\231"
+	.ascii	"\372\003}/c\356\231\331^\2278\236\347c]\031\273$\222\363b/\016"
+	.ascii	"\212L\334\013\346\371X:\302\305&ZJl\345sBC\350\"D\333YAs\n\252"
+	.ascii	"\0036T4\366\035)\004\274$}\272\210B\001\236*\366\016\200\016"
+	.ascii	"\341\275\205\025\303\235\300@h0C\371\377\370\254\245\005\007"
+	.ascii	"\021\0354Sd\261\227\025\001W\222v\225\241\r5P\023x\241\222@O"
+	.ascii	"(\025\005\r)H\251\250\350\374\260\261\036\256\f\311Q\220'\007"
+	.ascii	"\233\250\002\363\216\201j\354\202\025\234\340\361\201\r|\252"
+	.ascii	"t\201'%\340:gD\250\0211Fj\246\264\260\244\240P\030\306P\2021"
+	.ascii	"sf\035\021`5\0238I\023\224\024\244\232\003\361'\337=R\261\255"
+	.ascii	"\235v\332\264k\3604J^\013S\tS\240HX\250xs\363f\262L\212d\t\266"
+	.ascii	"\334'\203\0134\250,\335\023\333\270\340c\246w{\373\322\020v\372"
+	.ascii	"\244\233f<*\030|\267\210\376?^\307oD;\030|3KH\2439\304\335\030"
+	.ascii	"%9O\213igZ\200\234Z\225\374\332\215\326\225fg\2142\371\203\r"
+	.ascii	"\202\271\230\371\304vq\177\200\370te'\363i\366L\205\256\f"
+	.text
+	.section	.gnu.lto_.lto.64e556e5ab5272a4,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_expectedResponsesLength.15.64e556e5ab5272a4,"e",@progbits
+	.string	"(\265/\375 \344u\004"
+	.string	"\344\005\327"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\004\023\005\001?\202\210\200\020\177}\274\001{\273\001\005\001\006\025\001\006\003\273\001{\277\005\002\277\001{\302\004\302\003"
+	.string	"\310\001{\307\002\377\035\001\021\314\001{\313\035\001\020\3168y3\317\0014\315\001\312\001\311\001\306\001\305\001\304\001\303\001\301\001\300\001\276\001\275\001"
+	.string	"\025"
+	.string	" "
+	.ascii	"\204{\263\006\004BD\r\036\342\206\272\f\214\004\205\257\216-"
+	.ascii	"\341\262\233\"\013.\027\f\002u\34020\022\024\333\363nJ\203\030"
+	.ascii	"\200\003"
+	.text
+	.section	.gnu.lto_runcamDeviceIsResponseReceiveDone.17.64e556e5ab5272a4,"e",@progbits
+	.string	"(\265/\375`\365\004\005!"
+	.string	"\326\272\321K\220\026R:\200G\24041:\216\024\322\320\026\370\360\265\215p\326\nR\374\313\253\223A\025\312\255\250\323\007Vz?\243\tv\222\325a\025Y\267\242I\027\317\322&\001\244\271F\332\004\324S\260\"B\341}Y\265\377m\237\354\275w\222\001\276"
+	.string	"\260"
+	.string	"\300"
+	.ascii	"WM\t\322\323\234\307\266\373\316\343\256\365K\264m\316I4$9\247"
+	.ascii	"8}c;V\260 \250\321\247RI\270#R\021\326Y\316)\320Fu\3557}\237"
+	.ascii	"\025=/f\247\313\341n\266\332\211\257\255h_\350\274\tL`b\222u"
+	.ascii	"7\243\352>4\343\271\016KfK/O,b\034\327\264C\211\251\336\244("
+	.ascii	"\305\2706^K\325v\r$\241\264\270\024%\031\227F\254\006\226c]\300"
+	.ascii	"\016%\030\265vm9\347\030d\321uP\217\220\307z\352"
+	.string	"pq\234\033\0033B\276\370\275\021\252\250l\304 S\\k\225\365\225C\022U{\346i\226WcE\220.^k\024r\316]\215\220,\336\275w\037\247\2735t_aV\331\235\036\253\205b\322\305%\254-T\367Y\373\347;k\317\310\234\265{\347z\363\336\365\336=\375u\027\362\343n\365\337\276\374k]\033\327\332\267\326\266\265v\245i@\343LKM\226\234\223\322\300\3440\354\225\343\\\177\327\273?\244\357\325\205\332\b\2459)\303RZ\301v\344\\}f\347\214\004=\353[\r\364!\275\001\211*\271\3149?\253o\244\257u\"@/rs\263V\276\312.Z\313\003\307\235c;\266\271\367\235@\335\271\343\332\035\324\235\353\356+\304DM:@F\272d\"\301f\205\276\227\217\315\036\013l\355\376\217\003\tzz\242\246\227\211\002?q\036\357,\212%\260#&\336\212\261\246[=z\336\354\275n\243\022DK3J"
+	.string	"$\027\017\233U\366\267n!)\314\331G\3173\217\227_\212\230w\306\376\354Q\247\035=\177\366X\227I\233beM\261\232U6\004'\330g1Z\355\243\372te\205\250\242\335\234s>\255\3627'\317\372\256\217/\246\212\3441\n\207\221\023\276\226ge\354Q\363\374\t\n\224\342p'\"p\310\232\314\330\016U^j\272\270\210]\253\354\236\255Y\343U\025\242\212\326\337\352\341\277\320\002d9g\006\036\276D\004\001\251\234\263\203$W\322\323\237:\356\"\211z#\022\347q\317\236\371\337\027\262d\325\217\241\232f\323\234\205l ~x\210B\f\301\237`\016\017q\370\363#\364\221\031^H,\346\370\fO\242\020C-\370\023\334\271;\304`OOQ\247\326:\b\204:\303\022\302\035\035#\2608\004\022\207\301\036\240\216\321\007\210"
+	.ascii	"@\027G\b\215\300\237b\321\b\314\245"
+	.string	"C\267P\215k\336\310b\352\036\366{\375B3\231\305\314\375\350\211\261m\nC\366\310;\225\3530\362\213\312l\250\246\371\266\034\2211?{;\273\342T\326\004{\220FI\355\254\262#\034=w\366aV\202\224\335\274\bi\351Z\211\023\322SNx\366\247\204\020\376>\3257q\036\327\220\\gf8iJ\022\334\323\025\224\233\275\3668\257\326\332\357l\265\306\245\261\2420o~@\373S5e\250\201 \303\210T\210\231\021\021!M\201\261p`\002\031\2623\017\021\200\305T\306Yv\003\204(\225\327\251\366T\\\024\003L\315\236\272\277a\212\344\fb\244\360n'\335'\201\2554\350\230I!\f\332\376\316.\030\243E\026l\027\270'\007\270\200E\036TQ\257Q\265\034<\001\023\313Z9_!\200\004N\204\260\001G\232f:$\313\274H\207\2410:\246l'\205x\263a\374z0\226kc\031\240S\230eW\326r"
+	.ascii	"3\376\340\350\362!dx,\030\342X\255\237\325\366\351\331\231\334"
+	.ascii	"\236cDv6\311\343\242\"|\021\003\271<\227\363g\277M\200\341\r"
+	.ascii	"\361\350\201\021,d\224G\354\345A\203\345;A`\324;M\032];\221\230"
+	.ascii	"\003\363\240*\342\235\345\323S\214dZ\360\037"
+	.text
+	.section	.gnu.lto_runcamDeviceReceivePacket.18.64e556e5ab5272a4,"e",@progbits
+	.string	"(\265/\375`\355\007\3550"
+	.string	"JY\240\023H`\034V\007\363\365"
+	.string	"\253\274\016\342\243;\310\210\210\303m!m\334\177-H3\205\336/\245\331C\235\371N\242lD\003\244 \217\242\234\372\377\361\276\017,\337;\340\001\237\354\021\356Q\373\262\334\367}\337\267\277\367\336;\311\224\002+\001\025\001(\001K\326\330\351g\312\213W\217\267M\001~$\236D\311\225\264\024\026\030G\255\312\316\3428\366i\"\330\333\"\313\206\255\b"
+	.string	"\214\243b^C\237\335\372t`\fm\253q\314\271\333\275\374K\311\301Zx0\216\257\332\234\305\261\325\247\215\260\267mu\034\327[\330\207\256\267?AJ\375tk\226\223\016\372%M\262&\216\255\307\317\321\301\006\376\323\207\302 \360\347\353\361v\272\034\374\272-K\374\374l_\362\341\016\033Y\350lO:\374\n\315\301\252(-\0076Ee\371\257*J\312}:\274W\245\312\274\274\303w:UQ6\\\307B@\233\341\344lOSl\336\341V\306\325\\\207\353\251F\3169\323\r\207\331\004\325+2\234\355\351\006\213\223\305*\214s=I\345\227\305q\3621u\266'\032l\202\267k\032ivgx\313\016i\220q\361A5\261\n\270"
+	.ascii	"\251\341h\236\251P/2\353Fi9\221%\372\032\242\325:lO<\330\017"
+	.ascii	"[\242\266\203\212\346\367\253\263B\246\336\274\330TEey~%\304"
+	.ascii	"q\334y\n\025\345\215\343\335\356\354n\246n7Lq\034\013\265Wy\016"
+	.ascii	"I\302<\274mo\341z\373\037\002\206W\365\013\214)\307}\033\230"
+	.ascii	"\260\261\357\374\376\305w4MUh\216k\003\237\237}\"\205c\312q\335"
+	.ascii	"\313\335'\226\331\247\376~\365\334Z\227\225\315\033\364\227\272"
+	.ascii	"\255K\371\261\272=g\013\016\264\376\253n\007\r\206\204\202\200"
+	.ascii	"~\030\270\325\335\247\307\303\334y\214\036\305{\307\301\334\017"
+	.ascii	"\350x\023\357\242+q7\220\323\271q\234\2117\321\311\274\207B/"
+	.ascii	"\363\016\002\337\334\2776\267O\227\273\367\271y\237{\347g\336"
+	.ascii	":6w.\227\033\376\334\357\347v\341\334\355\233\233\205s\377\233"
+	.ascii	";\277\271\235\210\270V\235\262\002"
+	.string	"\373.\326\330)\316M\274\326B\371\341i\356Q\334\231\2707q's/s?\363\267[J\273Z\357\322\nT\275x\r\211\3433\027\016\245\035\255wQ\236#\250\254,`o\275[\251}\314\235\370\0237\363k\357\316\2144\313\236\305%&[GdO8\336z\227X\215\275\225h\342,F\2551\024\321\324\332\007&I\305\306o\360\324\366\n\327\205\340\212\243\367X\276w\2564\367}{}\323%E\004\215\026O\027C\215\331%\261q\\\025\301\323\374=\242\206\315[\030\017\024\234\356\351\366\336\271\bd\237\342j\025\246\273\347y\336w_\310\220}\332\373\242\364\227\332\347y=\277\3736\213\032h\227%p\276\305\325<\367p\nR\365:\003k\221\346\310=\226\373lL\001\201\037\213\314\237\356\316+p\312!\346\026\315m\202_f\220\275\217\325I\356\320\033\235\254\334\237.\320\367|\b*5MU\250\273\363\355m(\236"
+	.string	"\274\030p\223\202\237\347s\357MA\2409\256\201\036f\253Pu\221\302\t\317| i\237\370CO\355\017\276\320S\233}\340\003=\265}\205\313\363F\030d\004d\367\337\357\336\320!\373\324\370\305\027\277\324B\377\276\357\274\373\037\250\314\244p"
+	.ascii	"r\373\335\036@d\237\356|\021\0133\307\213OV\373\216\346\b\240"
+	.ascii	"\302t\r(\2432\303>V\273\377\030\325U\032\321E\270\3547\305\276"
+	.ascii	"Ds\233\026\346\377n\022"
+	.string	"&\262O\331\177\200#\332H\267\302\204\003\312#\346\004\347\322M\272\223\311\341M6\223\177\244\324\200DBNP:\217\230)\234\312\346\357m*\213\220J\013'\216\226HK$\b\347\362\3474BJb*\215\226H9$\022\262\210-:B\032\0311\223\257\333\311\005\312\344R\205\262(\331<2\227\307\243%\322\350\230l:\217\013\00443\205\262yDb2\233\307\2355\366\277\202\337\256p\302\341\273\232o\200\222\221\232\355\334\315qp\276%0=4m\370X=&5\013\272\233;\232\347\266\212\214\3519\370a0\370\275\006/|\252\233\013\203G\252\262\230i\313\361\2021EH$~\003\203\236\030\374\0062\370\340S\233\b\374f\201\272\007>\265\370\277w!bW\242\271\315\357St\255\271\263q\034\307\301\253S\260z\"&\347\203\236\332\325\244\363\f\236\352W\257`eDj\226\335\315\233\375\375\274\356\251BlVt"
+	.string	"\321\\\027\344\313\007\354[\274\331\327=\311\3151\276\363(R}\215\257\363\324\f\367\b\337\236\377y\252\2007D\322~\301\26708\306\325\324\267Ud\f\257\347\035<\325\321\034C\033\025\251\031/\200\222\250A$\345\224c\b\221L$#2\242\244\003p\002\031*\273m\020pV\033u\275@B\177\376\267h\026\002\321\224\307\250K\020\302'\251X\332\252e\032\025E,]\324\245\b\356\361\035wp\026(\350^\231\376\235\223`\022Q\031\234\352Dv\355N\240"
+	.ascii	"\237\307\333\267\300\205\217\254\305\247\nzm(4\"Y\005\200(x\364"
+	.ascii	"\225\244n\036\272\306\355{\b\307\f>\317@\023\240\013V\2135is"
+	.ascii	"\002\002\216n\\\241@\177\2741\212\007\300\2419j\242\275B\215"
+	.ascii	"\001\332\366\t\037\203v\266\223\300\b\252CB\3019B\323K%\224\224"
+	.ascii	"\"Ro\305\310H\2770\";\205@\213\r\234j\214\307\234\005\256@\002"
+	.ascii	"\022\210b\036\2000\220\322%k\"\013\034\246l\212\243>\224l\fq"
+	.ascii	"\233|\350}\t{\225m\032\374\b\276d\206\350`h\036\221bYG\377\240"
+	.ascii	"\fg\331\256\327B$0d\313\345\307\266\255\211\367t\340D,@\376 "
+	.ascii	"=\267u\\'\213\034\246e\254~\361\034l\215\323\235D\227\322\264"
+	.ascii	"\tM\344\241<j\017;\222q\351\031\031\013\007\263\330)L\037\006"
+	.ascii	"\373\037"
+	.text
+	.section	.gnu.lto_runcamDeviceFlushRxBuffer.19.64e556e5ab5272a4,"e",@progbits
+	.string	"(\265/\375`\354"
+	.string	"=\f"
+	.string	"\346\226SB o\233\0160=:\220\017@&\005.\222\352\021\212\217\260\317\301]\003\247\363X\222!\353\352a\3140\320\353\230\311\3461S\352\201\242\316`"
+	.string	"$\001"
+	.string	"\244\203\260\206\003R \331\311\317\360\351\223\275\245L)@"
+	.string	"?"
+	.string	"A"
+	.string	"%1v\327\322\016\206\311=BM\316O\021\025\235\007z\204\226\320\307\207"
+	.string	"^\bjL+''yj\360:\022\206\b\271\236\344pD\304\244\363B\236\226\006\273\353\354<\220\233\272\355\215\355\214\375\007\001~\351\2474\255\231\316L\377\242\221bE\202\323\356\307i\306\252\304\023\020\030\333O\373#N\202{i\343\002vE/P\354~\n\214\240z\364w\002\324c\365\001\324\2439\333\305?\322ZF\0332\004z\201\201\"\002\356\356B\035\331\256\362jW\350\344;\037\360P\220\355\0137\361\001\300bw\027\370%6\f\006H\036\036\375\r\352\361\252 (2J\034yR\223\224\220\247:\262?PjH\246\025\253\310\001\330\225y\260\r\345+\203]\231\007\333\\\233\245e\326\204\f\002\307\272\266\216\225)`\215\002\266Y\0264m\2630\337^Ev\220\242\302\241\0351\002\245\252#'Zx\244\311\230L\265%p\362\235*\003\016%\237\252\312\025"
+	.ascii	"2\003\353<\222c\353\365uX\\8kv\030A\334\021E \221\313\235\250"
+	.ascii	"\022o\302\302<\n\232P\213\224K\260\315jJp/n\251R\265\f\324\313"
+	.ascii	"&a>\001"
+	.text
+	.section	.gnu.lto_runcamDeviceSendRequestAndWaitingResp.21.64e556e5ab5272a4,"e",@progbits
+	.string	"(\265/\375`\352\004%!"
+	.string	"\346\275\332L\220\024V:\024<\3008\030a\300\363\"\360\201\361\346\266\312\016\317P\264\020\3007T\240\bz\037&\270\244C\367!\266~}}\034z\237>\216\202^-\0223\263\236U\266A\216GU=\236\004\350\337L\372\342d\371\276\375\204\220\275\223\f\312"
+	.string	"\267"
+	.string	"\306"
+	.ascii	"0\031\tV\243wo\367\237\016\325\363\250\022\002`rrj\b+g\347\202"
+	.ascii	"FP\373\332\316\007`\277\326\316c\2772h\320\323>w6Q\320\202\252"
+	.ascii	"\b\r)\313\331\331\3033z\275\352|\347\256\317]r\270\233\255Fc"
+	.ascii	"W\025_\237\376\317]\276\226JZA7'\243(\351\270\351\325)\020*\245"
+	.ascii	"\337\016\300(B\272M\345\035]A\371\327\022I\255\201\322\003\351"
+	.ascii	"<\226G\267\246F\200r\242\361\257e\013\025K=\267>\375\001\036"
+	.ascii	"K\243KcqV\2551*\302DGdB\345\205\375\210q.\241\273\322n\264\236"
+	.ascii	"\300\t\353\311\fFQ\322U\025\307:\242\244J\223s~\364WI\204\274"
+	.ascii	"\227v\223s\356;DT\364\326\275\373\270\273St\253\026\002\314\356"
+	.ascii	";\370ZR\2431S\367\f\355\266\314\211\3741\274K\337\273W\3750\227"
+	.ascii	"\372_N\365\353\036\365\347\356\374o}\233}\326{\375\325[=\364"
+	.ascii	"\215\325\333W\275}\002G\254\262+6VrFq\246%{\255Y9.\375\263\376"
+	.ascii	"\253\037z\265\373}$\347\352\306u\361[\215S<\313r\316\270$\375"
+	.ascii	"i\343\244<\265\254\203f5\003i,gg\320\261\372Z\215\313z>\207\216"
+	.ascii	",v\343\276\276\273\247\177\344\321\306A[J\223\204\311I\246\230"
+	.ascii	"\216\021\267\272\221\236_\265\264\366\263\254U1\315\306r\316"
+	.ascii	"\n\276v\260\366\225F%\022\345P5\244\251\201\312l\302*u\204BP"
+	.ascii	"\357\235<\017M2\034\264\035\236\301\312#\033\203\021$\221\021"
+	.ascii	"\200*\221\3250\263\257\344;l \311\312\324\224\335U1\f\276\230"
+	.ascii	"C\207\373\241\035\376\364\267&\231\013\2631!\332\313=~\301\027"
+	.ascii	"\347p\237\353\327\322.T\271\344\211\305\314~\bV\006{\230:W\177"
+	.ascii	"\270W\210Z\316\331A\277K\007\330o\372\332/\301~\225\301\347\372"
+	.ascii	"m\256p\262\004\025\205/\276\016\037?\310\"\264\005\350\236\365"
+	.ascii	"\355\346pwpx?\324\237\376'\240G^I\374\203\301\250HY\255\230\331"
+	.ascii	"o\352\332\202#t-]Z\024\025+\357\243K\f\257o)\233\303D\354\326"
+	.ascii	"\034ce\253\230Y`\307\r)\306L\315\303\336\360\243\007 $\310\013"
+	.ascii	"20)\311\213\245\333\211\2748 \214\037"
+	.string	"\204-N[\024\016w\212-Q\007|\261\005\022\215-\261\003\t_\020W\314`<\016\333 \320h\023\2668/\304VG\347(\301x\3341\036\2079a\213\223\363\031}\024\202>\242o\307F\341B\216\320\027\f\016\1776\266\1776\355\017(\242\315\371\021{C`O\b\364\005{?b\261g3\240\207;-\261g\034\016\211=\234\023\350\230\251\037}\205\260\246g4\327\367a?=\206\260\3463z\373}X\226\305}\003\204\2216\\0\263mXp<\214\247\250\n\276b\345\2121~\324T\223\344\305r5\347\234s5_1\017_\353\353\222\323\226\211%\344=\273E\224\230\270p\267\031\334\177\262\201'&J\023\206*1\002\272g;,\034T6\314\354\033W\250Q4\305\b2\b\031##\301\f\215\264\315\001\220\002\231A\353\006\020H\351&\206t\201\205\247\363^\237&~\017\235\355\013X\230\237r\375\262n\036\231\036"
+	.string	"4\357\203 \366g\006\t\3067 hP\370\034,\211"
+	.ascii	"\021\263\264D\177\205\217\342\347\026\216\026\245\235\271\177"
+	.ascii	"\217\214Z\311$42\365\316!\f\222y_m\204\303\312\324&u@\002$B\027"
+	.ascii	"\330\303\222Gg\263\337\027\024\215<!Q\020\032\3172\217h\024\214"
+	.ascii	"\033S3\2500\3300>~_\307\343\314\034\250\020\001+\335\264\016"
+	.ascii	"&\204S\303\032\213{(\343N\234@\374\213\345\0169 P\351\270C\323"
+	.ascii	"\234\005\342\333{T"
+	.text
+	.section	.gnu.lto_sendCtrlCommand.23.64e556e5ab5272a4,"e",@progbits
+	.string	"(\265/\375`8\006\035'"
+	.string	"\332EX\017H\200\234Q:\223\316\211\226\300\235Z\244\207n\232\302\212!\003\357\bg\3060U\001\340\257\256\326\027\330N/>\342B\212\332\203\003\316\333:\006\241\356]\242\020\t\243\310d\223\257\235\263\263\346\006\366woMk\t!\204\310\235d\340"
+	.string	"\331"
+	.string	"\352"
+	.string	"w\b\341'\017\251?\037\234\326x)\276_\3150\005\334%!Ap\352\317 \363\226\371P\036\305\367\"\215\017\270w\b\030-\367\032%\360\003\365'\033\317\203\376T\257\203\376d\3661\263\271\261\310M\247\276\202T\344\334{q=\245\252j\215\315\233\306\363\332\276\333"
+	.string	"\254\267\032MM\321\323l\353\343\327\270\ry"
+	.ascii	"fjC\007\222\203\r\201\230CdJ\256{\331\260+\220\370\34373\315"
+	.ascii	"14s\260!\2249$\326\346\351^@[#B|:M\215\"\372xj6 #d\315\301\206"
+	.ascii	"=\314\037\250/<\326\246\240E\321\251(bQ\304\247\237\367\372\207"
+	.ascii	"3VbQ\304\0377\205\242\210A\336\346\205&7\262\334\232\226\314"
+	.ascii	"\325\312R\311\221\267\302\246\237\265i\207{/[\246&\3429\300\231"
+	.ascii	"\017\304\314%\230\317(\001\347\373\3107\370\205U\025\225\354"
+	.ascii	"\031\263\361g[\212\371j\026\027#\334C\230\337u^\240\340\\g\241"
+	.ascii	"\240'\317\t\020\034\250Y6P\263\f\224Z\376I-\373\324,\027\350"
+	.ascii	"!\300C\263\274\243\363\255\263\355W\177\355\305\037}\327\271"
+	.ascii	"i\226\255j\371\f\002\220\221\331\260u\257\216\263\262;\346\344"
+	.ascii	"J\362\344\337\365o\375\\?\326\371Y\336\305O\336\213W,W\252\262"
+	.ascii	"\254<\341\275\n_\313\271\264\2228+\027[\300\340\373\226\236z"
+	.ascii	"\251Rdj\267\364(\244^\220#\324\237[ZG\277\300!-8\365\245Dy\327"
+	.ascii	":B\2074\247\251$\312\237,B\345\361\263\216\205\327+U!\324\237"
+	.ascii	"l\001\003\357VzA5\004\334\337\231'T\367\032=\250?\177$\257\237"
+	.ascii	"r*\276c%\251\227\n\304T\030\345\rA-\303\252\r\020\352Gk\251?"
+	.ascii	"@{\032Ak\270\002,\373Y\034WL\224\252\201>\3206,h\306\002\005"
+	.ascii	"j\003\375\240\323O\003\265\231\f\232E\270O\377\364\201e?{\306"
+	.ascii	"=\355\3232\254\316\202fJO\260\034\301\322\226\342\263@\013\364"
+	.ascii	"\243\216_z\272@\223\260Z\006\315\224\032\231c\016\027\312\323"
+	.ascii	";M\240\037\026t\372\335L\212\036\377\b\377\b\375\271\323\226"
+	.ascii	"\212\360\251\302m\255\323\367\272\371eu\006\270\3447$\006\244"
+	.ascii	":[\312\310\2048N\306l\203\331"
+	.string	"s\222\311M\255m\233(\212\t\232]\002\034'c\311\367Pf\216pdo\247\310\275w\350<\216\311\031K\262$\034piS5TJ\177o\326\230I\346\275Q\034\216\365\336\0216Gyu,1\305f#\364\215\342\210f\311\2221\363\212w1R\357\275\031\370_\273\"\365\b\r\364\001\314\366\205\256E\357\220`t\321s\273\\\357t*T\360P\234@\332\021\361V\244\027:\027\274\025;\"\025\345\334\004]\256(\206.En\2073*\302\275(\"r\201\313\355\216p\023|\330\b\206n\207C22\332\341V\243\322\373w\333\312\323\335\302+\257\354\031\013\260g\204\"of\242\234=\023\333\2559c\200]\203_\346b\3469y,\2233\326},\253\352\001\300\274\3654\322\022\211y5\347Q\313\226\305\233\002\363=T\250\205\367:\215j\251u\323i6\315W9R\227\236\311\326B5\027\352\335\323\\\250\025\024\255\304"
+	.ascii	"\2418\214\221\001Y[\212\1773i\013\032i\251u\022\350\236\026\246"
+	.ascii	"Y\264\240>\231NU\210\013\262<\246Y\262d\346\275\367\326Z\212"
+	.ascii	"\223\234T\004\375%K\263\364@/h!\363\317\336C\023t\200\202\250"
+	.ascii	"A@\204\024SdHf&\020\021\332\244\003\200\002\231\261\272m\020"
+	.ascii	"`X4I\007\357\377a{\306`\220&T\216U\365O\214\b\344\264\337\265"
+	.ascii	"\214\2167\240B\341\004,\247I\370C\216\363\351>\023\254\231\251"
+	.ascii	"\327T>xv\347\253`k\277\313d\251\\\255RT\341E\334\340\202\310"
+	.ascii	"\212*\306\231\243<\363\324\247T\370\211\310\274\216\253\365\235"
+	.ascii	"'L\3571\272\364\271 ;>2\007\363\276 *\240G\002\306C\376B\360"
+	.ascii	"\301\325gy\013\f\025\030tC\274\353.0<g\324\003\307i6\303h\330"
+	.ascii	"\020\210\311\030\305\326\025\005`\354A\303v\3009\020\276\305"
+	.ascii	"\325\f\230+\001$\313`\353\366\350\340\n\030e9cs\320\n\217\375"
+	.ascii	"\f\311 \345\304G(\364I\250?\327\367c\206M8/\207G\362\017\276"
+	.ascii	"n\330:u\231\323\267\265T\270\271\360[\323\b\237\305$5\337[\f"
+	.ascii	"\267\003ae\316\223\334#\332\001\306\303\210\340\301)\272\263"
+	.ascii	"Xi\205\255*"
+	.text
+	.section	.gnu.lto_runcamDeviceGetDeviceInfo.24.64e556e5ab5272a4,"e",@progbits
+	.string	"(\265/\375`!\r=G"
+	.string	"z{8\033B@\236N:\351\177\257\220\004E8p\335;\201j\240O\360-\306\336~\311\r\335\203\214\227k\304\017h=\256\253\365\201\355"
+	.string	"\353\020\310\256\367\210v\223Q\345 lL\370Y"
+	.string	"^w\267&\215\020\262w\222\001\243\001\206\001\250\001\356\331\004\354\275\364\363zy\274\213\341\372]\377-\201U\337\263'\274C:\306\367}\031\234]Z_\324n\365\277\034L/\357\236KP\241\367K\216\334\024\250\255\333=\227\240\325\327\314\302\\\037\035\203\263\375\344\236\305\335\\\335\313\356\316\325\034IB/\230\235Y\023\306\335\247\373\026\256\327\355\370\320\373*\271\323\367\276U\007\235\300=\333\325;\333\263\356\213\332\263\021(pu\327\253M\314\220ccbw\214\357[m\312L\\\327\r\022Z\215\372\250\361\327\352;\251\355z"
+	.string	""
+	.string	"IHG\002\234FEDCBJA@M\346R\231t\221-\273f\334\325\207>@\227\257q{U\272F"
+	.ascii	"\253\363\t\034\225\033F\345\326\005\177d\370\236\367\205\223"
+	.ascii	"\342\216d\030}\303eg`\370H\352v\001Z\356\\\231q\252\260\3350"
+	.ascii	"*e\225\260\246\027\347\205P\260\321\022i\224\027\025~-\243\307"
+	.ascii	"\030\345DO\206V$\0173\267\033F\235\254N}\022\313\260a\2410i\223"
+	.string	"+\255\310\037\32187\214\316\255Ny\360\260}p\b\016Z\"5r \246f\233tz\346j\3000Zd\r@\004/[&[\362\264I\215\\9\370\025\313\234\232&O\256\312i \332\332J\2410I\035\227\3110\252\206\024\363;S\273:\013\223\324\371\337\361\217\263\260u\3014\020\355p\3217\314\256O[\342\234\3340J\267f/a\322,\317x\340\325\357Ss\206\344i\223\272=?\357\013\360\016\351\032\333\244q\307H\250\367}\033\223\235I\337\003\336\215\275\272\233E\3672B+\020|\357,\032\031\271\250\027~\354\254x\033\355\263\201\214\377\302\246_\370\261\223pw\211\023\370d\317\004\244U\b\2772\264\235\370\217G\321\246PA4%\344\221\241=\204\t\344\356\025,\360\311\372~w\341\234\0216&\202eh\005C\300'9S\273\253_X\t\016\032\244\263\222n\022#\016\370\026\021\342\202o\020T\037\200p{"
+	.ascii	"\302\335!\211{*\211\233\003\020\356\rR\032\242\232\2703@a\270"
+	.ascii	"\360t3o\247\253yKx\337\333@\343fz\365/\360\272\237@\343F:\341"
+	.ascii	"\373\310y1o\243%\356\242$n\242$\356\241&n\241\267y\007\375\314"
+	.ascii	"\033\250\211\273\311\304\315l\342^2q+\233\270\223L\334n\0237"
+	.ascii	"\222\211\273m\342f\231\270\327%\356\314\304\215\227\270_\342"
+	.ascii	"E\242\214y:\244y_\263\307?/![\346\355\202\177\233_\315\017\370"
+	.ascii	"\023\376f\3763\377\336\337\367\213\271\262\373\335\205\275\214"
+	.ascii	"\261\276jlz\214\017\3636}\301\017\366\022\314\227\255\243\351"
+	.ascii	"\257y R10\356}\337% \033'<\274$f\363|\3655{\240\n\367\254\232"
+	.ascii	"49\326W\255\372J\235\360\360\350\0303\336z\232\034I\325Wz8-\214"
+	.ascii	"t\214g\033E\231\376\231\377q\335\356\351\276S\220{N\342\314\\"
+	.ascii	"\375\r\213&\201\314\331K|\337\352\twL\237\357~}6\\h\324\315\023"
+	.ascii	"\263\226Hu\275\223\341\372^\226\373N\371\340\204-\361}\243Q\001"
+	.ascii	"P\271\327\344\321\234\257kn\005\225pJG&!\227\265\217\213\310"
+	.ascii	"X\"\362\210\\77\0306\365\322\306P(S\373J+\020\211\254\265\270"
+	.ascii	"\247\324\220\245r\0312\017(Df\311\224n\331\263\005\221\233\212"
+	.ascii	",6S\210\037'A\231\3329\322\232T\371V\026\035\231\0372\211\\\326"
+	.ascii	"\215\301\016\"\207\3108\346\360\204M\277\20025A+\225\251\362"
+	.ascii	"\323\230\260?_-\234\031\237\246\207\374!c;b\216Um\207\354!_,"
+	.ascii	"m*w\310\353_\203s\310S\371a\177\2442\207\214c\356Q\314q\215\263"
+	.ascii	"\243cV\265\033\002\245\362\206lbnQ\314Q\211h\006n\031\2253d\r"
+	.ascii	"\371v\304\322\360X\227\332\263\037\245\237\243=\233!\343\273"
+	.ascii	"26\b\227\220\241\362\007o\300N\360K\016\030+R\230,*3u@\333\335"
+	.ascii	"\017t\344=\222\351q^\241\223\314\324\376\223?\333f\016j\313\347"
+	.string	"\2218\347fj\377\361\3176\231\231m8\217\025\272!\377l\221\031\307y2\314\214\332\376\375\331\262\271\001\025\212\035b\023CWf\323\221\231\3273k\352\224K?\312\214T<\223|#~\377\265g\335$\037\267\021\351\240E\352i3R\221O\256\216\315\335\335\340|O\001\207\357\373:e;dz\230\360\232\273\273\270d\300'c\363\322\235\027\005\016'4Y\363\377\216@q\2571\300^\221=l\246jhs~\233\235 \030\356\323\0030\316\335S\036\360\311r>q\244\251\216\370\302}\337\267B\177NT\b7\312\216\366,\316\313/{ru^\3701\273\241\343\005o\355,\034\335\230\206\225\214\214\245U#\267\240a\225\265\266\256\254f\300\320BZe\321\270\252\221e\205\345\302x\025VU\306\262r\341b+Jk\253\206\326\326\025\263\355\252\007VU0nX\265\250\302j\272\202\321D\003\006\213\031MUXYM\017"
+	.string	"\364U\r+\254&\255\253+\254\246e\325\353YI\277\313\247\306\016\305\370"
+	.ascii	"0Q\315\001\f\303\347\374\273Z$\244\334P^\371+-\200\002\214{\274"
+	.ascii	"@fp\334\343\fN\340\255\213\n>\031S~\227\377\007\220>\263\351"
+	.ascii	"\273\226\241\2554\005\361\r@\246v\262\017\022\206\234\0211\203"
+	.ascii	"\033\345\262f\274Q~\235\035b\227\001r\267&)S\2152\206\374\274"
+	.ascii	"\263S<<\205_\356\2202\265\r\344\242\3748E\371~O\"\0012\2451\361"
+	.ascii	"+C\373}\337\367(\213)\242\344O\200\2213\003e\255\357\333\206"
+	.ascii	"\301\357\370m\311\235\351\226D/\370\261\201r\343\351jGN\315\231"
+	.ascii	"\251\r!\257\350B\306W\326\034\211\n\344\243\\\366\302'\355\f"
+	.ascii	"\371Q\364\224\274\262&H\204}\334\351\224\217r\346c\027\310\352"
+	.ascii	"\201\032A\370Q\276\220[5\275\307\003x(\023]\351\312\202O\366"
+	.ascii	"\224\227\234\231(_(\017\345\334F\314\321k\210\211"
+	.string	".\271\030\355Y\241\374\302\263qd\302d@\266\242L\r\363\002\331)\177\252\267\030f\345k-3*\246a8\215\321\222ho\256\367g\333x\f\352I\340\360\357\n\320\006\343\024\275\360\343\323\344\020\tE\345\240\240\274$2tC\262\307\315\320\252$\225\265\026\335\222\330\307\243\334?\213uJ#\326?[\021\271\354\203\247\022\243\023\343S\n\201\f\250\2014\304\020S\206HFD$I\2224\006\021\005\304(h)\254\007\021\200\265Td[P(\rc\257\310\252\213+\3620\277=\2568kq\224\375\224\346\2236\00711\017\034\234p4\030ze4\r\263mW\017\032FE\035\330\222\270\204ku\344\234#\276\333B\205\253Uvx\261\2221\352\251'\376\223\033\003o\222P\310\352\355\227\030\205@\243\332[H\237\221\202\276\240\307U\035\267+\370\013X \300\252\204D\216\326\367\201o\005!\214\257\323ac\030\332\337\310"
+	.string	"k\222\274B$\013\376\347\321\376\246\350\250\260y\321\216\023\201\214\336c\201\b\354\275@\017\371\355\024z\365\257\211\033lA\337\266\361<\3140V9mp\304\324"
+	.ascii	"R\251\033\230\372\2341\202\t\34185\003\255\025jV\377\211\273"
+	.ascii	"\317\"\273%\330Q\300\322\255m\212\030\255'%\353d#\320\205\030"
+	.ascii	"@"
+	.string	"\006l[\n)\210F\2436u\021\001\211\3474\332}O\004qm\r\365\tVq^\"\372\352\326\224\022Q\034\330n\262\277\322\325\001\340\303\234\236HbS\263\307\024\017\307\346vc\r\251;6|V\024\037\210T\033\322\216\037\276\351f{\252\037[D\372\316n\265\f\031\201\241\3446\024\"\340\004\253,\331y%\356\022\245\020]\355\022 \n\255\036\272F\005`\266%DmV1\235\013a\355\tH\304_\313"
+	.ascii	"\244\310>\351\210\356\006\301\351t-=\243\212\227\302\223\374"
+	.ascii	"T\310\230\325\307?\037T\255\220\304\037\275\315\035\223A\005"
+	.ascii	"k \200v\013\252\003\363\033/\354;#\333\2041`:\312\222\025\310"
+	.ascii	"\026\215\331\216\264-\300\371;\204\023\305\301c\257\322\207\207"
+	.ascii	"\232<\352$ \300\300\300\366\356\243\303A~J1SL\310\230\270\247"
+	.ascii	"o\310V\222\244i>\367@\321@\027\036\216\033\327\202\003\342%\306"
+	.ascii	"\236\201t1\034\242\346\255\241\352Ro\017~$\026H\230n\031\352"
+	.ascii	"\260\327c|\206\262@$\005\316>\220\351\375\323\261\277\300\203"
+	.ascii	"\n"
+	.text
+	.section	.gnu.lto_runcamDeviceSend5KeyOSDCableConnectionEvent.25.64e556e5ab5272a4,"e",@progbits
+	.string	"(\265/\375`]\003\275\030"
+	.string	"&\355\240I\300\026U:$\350\357t\361\304\024\034\250\3511P{j\bG\2142\366\267p\272\232i\363\326T@\270\250^\260^\375\306cC\f\206K\303R\211\256\252\220\024\320\305]\200o\343\304_\350\024\372Zy\357x=\b!d\313\235d\213"
+	.string	"\207"
+	.string	"\214"
+	.ascii	"\267&\245\007\360^ \016\247je\276\357@d\017R\302\346tmCv\300"
+	.ascii	"{Q\034.@>d\364(\361!\371\032\361!3\263\202\0052\236\035\275\221"
+	.ascii	"\033S`\271\371\034\335\213"
+	.string	"\246\272\367\331\311Q\fm\327\031_FG;Yw\037_\\\274=}U\241CQC\027\267\266\006F\020\225\031\335\t\213\200\312\216\030$\235\255\2665\260\343\244\005IW\263((5\262<\375\200(+v\265\216\020\356\275\\q:\026\347\2303\263\215\231e\314\255!\314\267\267m0\217\225i\336\363\237\316\363\317\374\347l:\320\271\364 \277\fW\016\307\312v\254\334\\\371\250\357\270G[2\024\335\233\013\202\271OB\242\034\377\371\201\376\240\177\350\226\371\377\235\310\205\2362i(vC;\335\232\025-:\356\005\272^\344Fd\017z\335\320\320:d\344\353q\357\212\020\344C{\217\022kD\240\230\203\264\n\207\237\331\r\r\2759\005\251\221\357\300C\336@\366\370\340(\204<\247\223\006\266\036\215\375\024\315o\342!V\252\202#\234\322\343c\367,>@.\366\2478\3236\275 _\200H\323\246~z\002-\202\265\242\037\022"
+	.string	"\027 v\3234\327\333\356D\357.\365\265\240\bS\253A\234\013\305\030t_\350u\331\001BT\217x\2012\243\233\3073\361\355a\310\025[\375\302\244z\340\323\363\300\013\211@\360\003/\344$\357\275\307\331s\022Q\246\231G\224\365\270\367\211~\200\2710\232\306\214>&~\3502z<v|]L\324 3J\273\275\315\013:,\f*\230*\007v\272`gi\002qJp\275X\346\230c\201\304\212a}('\230\245iR\200\235e)\307\302*\002\354,I:e\013\2462Y\2562F\344U\002\326\252E\202\365ae\246\312VJ\247\245\032\221Z\231\257T\202"
+	.ascii	"\\\272Xf\nV\226f\212\204\336\333\3336X\304\222\373\245\343\323"
+	.ascii	"W\260r\364K\353\225<l\025\314\0346C0\3215~\005\305\354\2754\036"
+	.ascii	"\030\361\220\315\033m\207\343\270\230\332v\207%E\2670b\363\370"
+	.ascii	"L~j\033\0349\302RC\250a0\247\020R\3048#\"\022\024\223\202\024"
+	.ascii	"\007\300\242\231\262z\020hg\332\244\003p\313\205\272\364R\372"
+	.ascii	"\030\0254\217@\346a'\013\272\026X\031b\020\022O#\223\016\032"
+	.ascii	"\fA\234|\241Ad)H y\202\305`\267&\270\3524\033\0225\351%oT\013"
+	.ascii	"\255\377#\267\024\303\"\347[\232%x:\020(\340\235\376v\371\372"
+	.ascii	"\216\246} Y\270\275\035y\375b\211<\b\276\016; c\2714\355+n\341"
+	.ascii	"h\376\200D\265W1\310\026G\005\222\213\333r\025"
+	.text
+	.section	.gnu.lto_runcamDeviceInit.26.64e556e5ab5272a4,"e",@progbits
+	.string	"(\265/\375`\226\004\215\037"
+	.string	"\206\373\316E\200\234Nc\237\302\321\375\347\226\002\327\362#\334Z\261`.)\036Ymh\342Mt\031\235\031\006$d\243e\004\343\030\231C@?\302 \216\220\244`\330\021\3672u\311\300\206\330\260\353\2532A\215\354\275\367\2262\245\265"
+	.string	"\257"
+	.string	"\275"
+	.ascii	"d\237\342\364\262&\241az\207.\330R08\367Ra@_\222\367\005\314"
+	.ascii	"\333N\376\230w\266S\034\277ST9\036[H\336\356M#\2744\017\255\325"
+	.ascii	">\330\303\234.\226\343\002\356\305\262r\345\336t\310\017\320"
+	.ascii	"\227N_\300|\211~\200\371\322\266%Pp\262\360\251V\217oY\021\313"
+	.ascii	"\340\334\233\362\354\221\013\217\236fI\332*\364\207G\307N>\371"
+	.ascii	"2\005\f\356\374\361\265h\004rs\301UU\220\227d\020\026\021\270"
+	.ascii	"\036\343\024)\304&\206\370\243T%\243\252%\023\220\001\343\345"
+	.ascii	"\312\303H$\031\f)\222\366\261W\035F\250Z\317\r\367^\327\242\261"
+	.ascii	"\352\316\335\266\020\3331l\222*j.`XhS\362\3626\303\022%VabO5"
+	.ascii	"\256\032\307\354\350bm\226q\230>\366\300\222-\2624Q5\216\003"
+	.ascii	"\324\337{#\323>\352\325\027}\354\307\256\373\362\242\202{\213"
+	.ascii	"\262C;\035V\233e\237\274\026\313\376\331\rt\264\373\347b?\201"
+	.ascii	"\247\267\217\253y\316\352\235\235\352\335\256Z\267\253\316\355"
+	.ascii	"\252Q]\365\251\2536s\325%ZM\272\332\236\325\325\254~\020Q\031"
+	.ascii	"\253![D,\232\364\366\210\233s\305\224k"
+	.string	"]?\373\321\376\262?=i\337\276\231O\345i\336\241\005\205\206\001.\224\033\030\023\024?\013\242\227\311ie+\254\b\275\024\377\350\335K?Ss\240j\234\201\254i\337\206\355\r\321\217A\nZ@pc~\fNh\253\267\026\363\345\217=\177\200\371Z+\255-\204r1\302/\005m\026Fy\030a\030\372\322@\351\246\270\206\264\245=\261\316S\215\033\3721x\201\264O\373\220\233/_kO5\316hi\270\246J\241i\355\257\310\204\352\315~\344\200\336{_$`\355\016\036\352\213\326\376\370\\\026\024*\2707);|U\223a\022\362Jf\265\037\343V\204\r\231jm\020\347\242\204nY!\002\200\237\303|i\315\024\327\374T\277\204io\302<\243\356O\230\274\373)\314W\371\255\255\202E}\261Z\362\nq\213_y\021\244u\357\255\340\007KL\276\242\246\037\211\236%&_\021\215\031\276\020=`\220\311\250\207\004"
+	.string	")X\224\264\324\003\2363|H6~\035\230\200\277$\235\351#\242\336\221\357FO\306\021\220\367\363\361l\370\214j\360\216\200K<\"\004\376%\365\200<\246\337\017\310\333\245\367\344\265X\376\330?\270q1S;\357\345O\373\b\26733\265\362\027\232<V\207m\036\353\rO\026\n\265Y]\256F\t\345\371\330\035H\241\201\323\306z\375\300\"\347\204Pw\272\204M\352\213\026J\243\324\323\326`\307&\340\262\3311\213\021\263\211\274\367J\303\313\336\305ue\025\366&\245\306y\347\344h\204^gH:\3055:\273\313Y\324\352\354\211>\240l\316\376\264\250=PF\254\203\232\366\264\017P\250q\034\303\234a\204)6\023L\232\305\315\001p\242\231\312\352\021\340\2613gR\332\031\003\234\257\371\306|#> R#tY\212\312\f\031\321\003\337K\343\021q5\314"
+	.ascii	"\311\227\355\241l\r69$\3765\3204\364\0029l\312{\361\326\354\036"
+	.ascii	"g\265\372\271\254\3748d\027\341\317\230\367'\030\244\341s\354"
+	.ascii	"\027\210\241\240=\251\330g\213\327t>\343&G\006Tz\207{\300~q\024"
+	.ascii	"\223_=\177\222w\312!\207\034\254\330\nD\351`\372(\255\202\322"
+	.ascii	"\033\203\032\307\366\250_\330i\345\337\2338U\310\032\206!\375"
+	.ascii	"y4\025(\332\2205\316\330\265UbYF\255\372\376"
+	.text
+	.section	.gnu.lto_runcamDeviceSimulateCameraButton.27.64e556e5ab5272a4,"e",@progbits
+	.string	"(\265/\375`$\002U\023"
+	.string	"\006\245\201I\340\360&\035Z\016\267\243\004x\016\314\200-\334B}\345\365\003]Nwb\247@L0^R\341\352f\217\275F\372\277\217\001\341\202\307\t--\373E\352!\2069\224\303+\001D\213\003\242\003\376\307W%\301&m\223\275eJ\001m"
+	.string	"b"
+	.string	"q"
+	.ascii	"\367,>\204\336\373\016B\357\331\266\201\0030\216]\354\241\335"
+	.ascii	"\007\206\315\t\250Z\305Pzx\354_\212zSn\314\217\371\267:O\345"
+	.ascii	"\234\316\225\216\212"
+	.string	"\030\036\265\232\t\222D\242\303s6\353]F\006\235IRk\005k4;\001\324r.g\201\246\025O\036\265\231\031B\373\231}\350{S\223\355\246Nj\255\336YM\303\255\272m\231\355\004\366\242\004\266([\311c_\216\3438Z\356\330\2525x\334\257\362\232~ko\256\347\\\313\324z\351\372\036\277!A\345@I\252\2256\352\250H\036\013 \333\367\213\236s9\221%\216S\220\213\r\336\273\rc\203\266\347^\274p\001U6\003\303\256\326]\211\303]\373B\277\301\034\367\362\217Zwn\354j\025KL\340\0139;\270\221\312gP\366\340\320\260\335p>D\272\027\336\007\374\214\353\202\206&b~\254'U\322~\220\262\237\231\204F\306xJO\336hu)\247|\215M\266\243WJy\233\035\027\277\022\034\201\303\304\206\367D5\355\244[\364\022BQ\215\231\215\262\315z\212\226\210\222-\341:\327WkE\200\202\302\204"
+	.ascii	"J \356\371/\364\336e\210\037'\333\r'\263c+/WK\n\254\305\362R"
+	.ascii	"Q\263LZ,\227\205V\004\026,|\271\302\025W\212J\310\202U\bMF\374"
+	.ascii	"bi\301\302\226\327\013\026\202\242\314g\225;\246L6tG\251?F?t"
+	.ascii	"\005LK\272\243\351\307(\2257\266\251\364\211\214\224\315Zk\375"
+	.ascii	"$\317\266\270\005}H\211\354\352'\372\320\202\021 \0166\241Z\353"
+	.ascii	"g\253\253\244\237c\320 %c\374T\342h\211\252P\360\001) `\2421"
+	.ascii	"\264z\257\363\f\205~v\274\003\307\023\264\202&q\210\304\350\026"
+	.ascii	"\226!\361\256\b\244w\231j\370]\266T\224d7\315\353\305r\245\013"
+	.ascii	"\332\260\340ei;*\217\2707\032\301\02330\236\216\304<%\341\031"
+	.ascii	"\317\234`D\221X2a\035u\340\001l\\\314\021\320\b\354\032\354\233"
+	.ascii	"K5UC\350P"
+	.text
+	.section	.gnu.lto_runcamDeviceOpen5KeyOSDCableConnection.28.64e556e5ab5272a4,"e",@progbits
+	.string	"(\265/\375`\330\001\275\020"
+	.string	"\206\037oF\360\260(\035\262\363\341\350\003\277\353;W\217\352\271\275\332\233|\236\036/N\323\231\263\f\324e\336\377\362,l\035\241\016\211{"
+	.string	"F&-\375\"\233\310\370DF~\301\302\334>\0070?Rd\217\005*\371\204l)S\nZ"
+	.string	"["
+	.string	"Z"
+	.string	"\3345\203\377\330\256q'\260]\263m\022\006,6\035\024\241:\t\036\230\330\316.\330i\210\233\276iQ\323\344\177J\"\217,L\255N\337:\\\323\2201*\220y\301\341\003\006\210\032\036+\227\324"
+	.string	"\253\227\030\332\335\307\2361\253\226\314O\311\356:S\253\r\367\347\266SlC\260\023A,w\034\274A\267\371?ZZc:c\372"
+	.ascii	"\276bwlP\220\355\252\302\236\315\321X\314\034\374]?\354j\263"
+	.ascii	"\370)\376z\314\036\260R\350$`[h\364\3204p\225\034\310d\340,8"
+	.ascii	"h\n\235\300U\221\310f5 \327\334q\231\366k~\202\3456\031>`\227"
+	.ascii	"\325\203\263\013\2128A\307\001{\252\310\bu\213\027\025M\324\226"
+	.ascii	"bx\351h\001\035\017\250\f\237\273{Rm\371\246\r\244\017f\302\327"
+	.ascii	"\f\227\3441(\177\363\327o\036\373\270T\310?j[P\311\247@z\024"
+	.ascii	"9;3\030=\3717Z\016\027\017_\332\016\373\201\231\231L\315\rT\206"
+	.ascii	"6xJm\331\217\273\273\326\022&\240|\243\025\317\204\023\235|^"
+	.ascii	"$}\2637\"\362F\027D'\036\251\373F\035\312\310\244B\347\221T\272"
+	.ascii	"\021\003\376RD\244n\345\373H\235\007\270\217\253,\247\006\362"
+	.ascii	"\214!W\215\261\335\241!\224\266\270Jq\367C\204\303\376\231+C"
+	.ascii	"\253v\350ar\2402\3446mm\032\243\004\312\204\246,\025O\r' \240"
+	.ascii	"\002!*\355\257\363V\206\316=\364\220\253(\017i\225\013\334(d"
+	.ascii	"\315n\253e\327\204\374A\317\003\024\t\036\263\340\371e\356,5"
+	.ascii	"i\003UsK\3556\241\262\024\031\034\311\242\240\202f7cz\336\323"
+	.ascii	"\362`YG\236\232\255z\336\3020\f\231X8w\2544\271\265F\017"
+	.text
+	.section	.gnu.lto_runcamDeviceClose5KeyOSDCableConnection.29.64e556e5ab5272a4,"e",@progbits
+	.string	"(\265/\375`\206\001\205\017"
+	.string	"\226\234hG\360\220*\035\030\277P\276\216\026$|\016\376\371\365\252\377\377ga\032\257\343y\320I\341\353?\022\370,\306\337\303\214\374\013h\243\222\034\351&\250\364\f\274b\r\306\347\3741\200(|4\334;\270\352=3\b\"d\357\235RQ"
+	.string	"X"
+	.string	"Q"
+	.string	".\340\235sy\001\3359\357 \3359\333&I02\351e\210\324GhH\211\335v\313\217\2028\351\225N\222\377\331\253\211\032\033JUz\355pZATP\324<T\247z\240\326\262\362\331g\006\225iN\016\203\335\365D\2518\334\334mC\260mb\337\026\347\270\351w\\\206v\223\021!\306n\352\306\306\316p,H\334\365\303~\331\251=\362_\217}f\016\031)R\372X\023\214\r%\032\300\310\022\232\033M\301]$\221R\271)\222\232\262e\340\234K<Z\212B>\366\364b\371\346\264\337\372\211\321a0<\300\356\352\006m\267D\020.R\274x\230\265\026\225\025\224\262|Q\347\321\020\027\333\353\305i\326\2607\037\363\330c>\023y\250y\267\3508jW"
+	.string	"\315\2438\3642{\263I\241%\377\346dw\330\t\270\264XZ4P\346\215]\226&e\331\257\273\273\246+\373\345\357\335us\016\363\017L>\242'\004\236xaG\004\353\370\260#:\bI\260"
+	.string	"\nG"
+	.ascii	"\235\301\221\020\364\\\b;\340\370\211\236\357\3439\231\360\201"
+	.ascii	"#\350\033\031`\221B8~!Q\034?\216r_\227\2568\324c\345e\006\205"
+	.ascii	"\232`d\335\375\260\340\262\337\306U)\213\372*>d\007\215\210\243"
+	.ascii	"fP.  \220\002\231\261\335\257\315\023B7\005v\tW\344\ne\t3\036"
+	.ascii	"x\343P#Z\r\324\266\305\214\304\203\227\371\263\334*m\tl\0235"
+	.ascii	"\n(\270 \331\2051=\354\261<Xv\305\223\312*fq)\314\260\005 \242"
+	.ascii	"\375\246)E\206\002"
+	.text
+	.section	.gnu.lto_runcamDeviceSimulate5KeyOSDCableButtonPress.30.64e556e5ab5272a4,"e",@progbits
+	.string	"(\265/\375`\003\001M\r"
+	.string	"\026\232]D\020\221\223\0168Qi\211\231B\232\325\301\321##\217\r\274 ;P\202\034uI\351F\301\2737\370M\265\366-\332jZ\024u\200\353%A5\025\001\240\002\205\"\211&)\005\036\262C\206\024{\233\337{K\231RM"
+	.string	"G"
+	.string	"I"
+	.string	"\266\0270\b\231{\2472}\204\212E\205\315n\207)\210s\207O\223\363E\207/\001\212&\203\307i\364@d|\260a!\037G\303\365\031Hu\320\341q\"\275\0031jX\276z\266\234F\231"
+	.string	"Fv\327Y:a\270\343m?\260\335\300~\026\227\371\243\323\352t\302\364;\177A\302\006G\204\231]\323k\307\326\300\0260\266C\266\307\366\313w*\377\330\321\214\020\256]W\210\261L\373(\036\023\272L\005\002\037Kb]p\355v!F\3009tw\220x\310\371\200x\350+\356kQ\301\237\342+\215\263\273/\345\355\"F\265'\240\344K\251\001`\320\230P\273AE\277\361\360b\361\324\345*\"\207\211\023j\225x-a\321 \345\215\337\375\372RB\205\212\341\260\222/\273\023\245\272\330\177\273\273\326\224\035&\032(\205d\313N\264N\364G$\373\200(d\020>\033\246\2010\023\020\211\004\354\263\241`\"\005\254\235d\033\226\242i\033\346\351\366o5e\0010\255\326\373\271\370\325\035\334xi\315\350[Wm\261\255\352\221\025\035A.\246\226\260jt\362\001\022"
+	.ascii	"o\315#\"t\271\b\3770\373B\231{\021%\b\027g\332R5&\f\003\367\306"
+	.ascii	"~s\r$Z\034G\270e\200Z\243\b\005\200\341h\fj\017"
+	.text
+	.section	.gnu.lto_runcamDeviceSimulate5KeyOSDCableButtonRelease.31.64e556e5ab5272a4,"e",@progbits
+	.string	"(\265/\375`\037"
+	.string	"\265\007"
+	.string	"\322\31776`O\322\001T\232\213\320\t\004V\261\001\332G\300\240D\311\303\272\035>S\267H\020\372 \375S\214\017\327\221\250$\t\303(\324\335\256o\223\305\tW-\222\275\267L)Vu},\317\344\212\262\252\353cy\252Lb\227\214\270\034 d\225MH\252\300\230\204\225I\n\f\313$g\356\r\237A\306\003y\322\223~\322\025\356WL\235\353\263-.\364!\370\340~<\316\236\234\276\020\373pw\327\017\304\360\335\257\361/\035\245\231\207\232]Q\r\315\302D\227\022\333\232\315\261\255j\337\344'\332;\f\202\200\325H\341h\331\235\035'l\036=?0=n.0=\332\366\002\203\346\355sDt\222nC\245\264;\345\023\371v\335\374\243\374`%\006$\3032\342\256"
+	.string	"\r\273k\r\215<\356w\333\b\266)\333]\007"
+	.ascii	"2\003\3020\032\341\352.\243X\032\016\331!\314\353\232d"
+	.text
+	.section	.gnu.lto_runcamDeviceDispFillRegion.32.64e556e5ab5272a4,"e",@progbits
+	.string	"(\265/\375`F\002\025\022"
+	.string	"V\240tI\320\322(\035PW\310AHCt!\005\307\320#ygp1RfI\213\245?\344\254\340+\265Jm\241\365\215\t\001\250\371\355@\031\037|\3305-\017\226z\343\031\235\371C\325b\365^\036\376\220\311\322\\\017\220A6\331;\245Z"
+	.string	"_"
+	.string	"`"
+	.string	"\323\376\316y\306\367\310\034\265{\203\244\333%U\214\002\276\232\274\200\357\025\374\311\367\352\321\336\235\314\355\313\222C\214!\273\033\322\024\037\357\3219\372/_r\303\315\334\023q\352\245\220\220\261\343\204\263y'>Z\234\270\356\323\003\216fN\222\225\335\365\274\341B\334\365\266[l?\260g.\007\377\363\177\367\371\275\223\377D\021(:\262 d\367\303\021#kT\213r.\364\333\367\211\256\263K\236}\310\020\202\274\330\335\322\314.\275\376\245K\376\214\323\030/D\003\227E\313\n\242\244]\020\006^\315\002\276\242\324\240\335\n\320P\203\237\234\004>5\007\350\264\021(\030O\306<\300\332xt\b\037H\324\261\357D'\300@\242\231E|\235_\327\021\003ww\201\237\343\005\203\257B\346{=\321\334\210\0366<=&8< `j\367Q\033\363\276\361\275V\234\235\216\247BdR\333)/c"
+	.string	"\344v\227A\305\371\241SS\233Gl\3226)\n\373\336\356\256\351\215\375M\237\336\363\233\036\364\233\034\350\001/3\226\230K\005S\301\224\254.kQ\020Y\255\257%s\021iu\3035\374\363*\305Z\211\031X.+X\370\022\303\013\242\312\025\256`\26105\300/\030\026,\224\275^\260\260D\326\356-\275\261\204\032F5j3\315\3335\341\240<*\311\3073\315:\364R\214\340\242\204\315\316\255\200\211\372\272\n\256\371\233I\350\314<\372)\0035 "
+	.ascii	"\203\221)u\003\357\315\223\032\372\300\300\200Pe\033\250\303"
+	.ascii	"\230q5\327\373\"\325$\332\324P\276\2526\273\343h\316YZ\321\321"
+	.ascii	"\212\335\306jI\356\260Af\356\346 \263\201i5\235\264\356\231\275"
+	.ascii	"\265\341\316\307\370g\246MF\200\371\332\331\270\240\217\301\f"
+	.ascii	"\222\337\301\016\222\337\301\016\222\337\301b\004\037\366s\003"
+	.ascii	"\"\212\344\362T\223S4\275\007"
+	.text
+	.section	.gnu.lto_runcamDeviceDispWriteChar.33.64e556e5ab5272a4,"e",@progbits
+	.string	"(\265/\375`\276\001m\020"
+	.string	"6^lH\320TQ:i\257\201\216\226\037\311S0`\312\374\b\221\355\247\254+\220\217\342,\254A\340\254\261F\274\322\331Fib\224\362\227\366\2243m\366\364\007x\301V\002\204\250U5!\006\b\255\004I\na\261\215\f\262\367\336)\005U"
+	.string	"W"
+	.string	"U"
+	.string	"\263\230\243\354\306\206\360\354\212#+\350^-\276"
+	.string	"\367\332=\205{uh\027\271(\333\357\020\t\221Chw\277\371\342\341\351\224\241\377\361'/\230\314\351\211O\252\222b\374!"
+	.string	"\346\242)Bj\264\270\355r\004lFJ\223\t\273k\371\202\231\270\353m\267\330\216`\313Q\027\177\031"
+	.string	"\301\320\017\352\310.\211\233\222\365\251=3\236\363\333\367y\334f{f]\307\025n7v\327c\331\336\353?\332\363u|G\370\234\227ni\264\3040\022\264[b\301\253Y\272W\003\263&\303\001M\005\203)\355\006,\341E\230\023X\027\020\021\337\245\375\233\343\204\017\234hb\300\0014#\223\3706\247\336c\325\355\356\003\277\007\305\301\207\021\303\275\212\246\fE\020\032\234\0317y\344\355\203{\2555C6t\204DN\333*\037a\006\310v\027B\255Yb\263\242%o\266\350\222\323\205}\272\273\353\031\2639i\321g\177\367\332\317\235\366\323\032X\024V'\222\212\344r\002\036\304?\2343\270R\002M\036J\031@\325\2272}(\023\351\364\201\252\325\267r\300)\227\222\352\353\220J\251>Ol\235\356\214\371\302\315\2475]~\241\273,$\214G\t\242Q"
+	.string	"r\364\353|4Y\260!Ds\363J\320M\337\266\341$\377\262\311\224\221?\265\035\240\351U' \240\002\022:\352\001/\315\023\205&\"0\034\nD\201N\315l^+yY,f\251Hu\030w \302Y%\212\360\242\354\007\n\tLS\323\223\326!\263W4<\231\030\377\314\334h\0046o;"
+	.ascii	".\350c\260\007\221\337\301p\004\027\226s\003\036E\276<\335\344"
+	.ascii	"\024\355\354\001"
+	.text
+	.section	.gnu.lto_runcamDeviceDispWriteString.34.64e556e5ab5272a4,"e",@progbits
+	.string	"(\265/\375`\220\003\035\032"
+	.string	"Vq\253F\260X\325p\260\373<e"
+	.string	"\230j\264AZv\362\321\211\224\217\3371\237\036z\234\372\240LL\361\227c\235\207\365\261\274\273K\275m1g\223\246\357\203\027\202M#\0341!\210\317\034.\361\311\302\214\255\267\335{K\231d\227"
+	.string	"\215"
+	.string	"\227"
+	.string	"/\265\303\371\222\24340\351\2710\201\020/J\250\\ \227d\030\260i \245!\205$#\022xU'T\330]\250\273M\367\266"
+	.ascii	"\211}U\257\344G\273#\325\370\253{\350\330\324-|\240\f\316\227"
+	.ascii	"*<\314|y~\200\371"
+	.string	"Rw\252b.\f\266\312\350\206o\211Tw\307\270\350\273\233%\311\273\323\253rV? \357f\217\227\244\203\037O\254\270\2006\310\001]\220\024\2711h\311\035g\027\260G\342t\367\213_! \320\256*\247\273u\177@\035W\325UuGUg\252\214$,j\373\337\271\300\025\037P@\314S\025\366\226\211TO6\017\251\256Va\254\325\233#\375\002\316\344\177=\351w]\370\327\234\351\312:\361\272\372\322\177\356\252\311\253%\257\222\347*\257V\367\\\275\201\004NY|\246t\343\230B\323P\245\321\350P~\246\237xV\275^\312\215\252-\205\361&\035\341\324\202\241\332zy\325\235~\370(/j\213(t\202I\207\303\263\351\336\230\037G\272\205!\316;\371\223\335\241\340\316>\342\301\bHTw\216\006\001/o\370\306o\220\007\227!GH&\227|\026\223\314:S$I&\332\355n\036k\217\371b\004GE\224\300"
+	.string	"\355\031}-\363\311o:\026\235\365\242\267\362+8\275\221\241\216+\370{\311\3270\246l\266\377)N\020\363\024\306\314\254\243\031_\032\027W\271>\231/\313\"\342\261\346AYDL\022\204U\325\301\207\272"
+	.ascii	"\301\356\276\260O?2\273|\035G,|\235\tc\026c86\t\032\222\341:"
+	.ascii	"s\3050\216 \325%\250Lo\247\364\274\342\207\361\245\371\331)\005"
+	.ascii	"\260'\253\006<4\0209\037ZN\305C\003Q\263\242\207\003\316\205"
+	.ascii	"\354&{\261j!\313\361\330h\324n\266\017\270ZM\316\207\226#g\334"
+	.ascii	"\347\246"
+	.string	"\316 \320f\265\0304\025\263[\314V\213\361\324d.b\263\033.\006\341\200\332^\320n\261\234\315v\213\265\204?'\233\207\024\305\023\324\017\367\024Gv\023\331P\374+*i\247L%\260\344P\2475\305I\252d\001\2547\212\030\261\306\347\370\230\247Y\226\242|)\231H\227\027\\g\276x\017FA_q\025\\g\232,\264c\336p\n\245/7*\211o\3319\273\333\202^K\t\0235\314C\2501H\203\020R\n\231\211(\"R\3206\007\260\002\031\232\252\016\020pvS\215\001\001\322K\371\221,\241\316\247\026\t\017\254\231a\024\251g\242\241\262\"\016\224\335\246\255`w\333]\">\n\203\371\030\227\230;\206`\350\365\024#J\202\234R\004UR\"\034v\260\272 \277m\356\2512\214^\017\320S\264(\323f\216 \242\361\n\320\273\374\216C\300 \322E\200#I\2177w\0028\331\004-h}\324\310\270{q"
+	.ascii	"\024\0256\217\001,\324\262\334\316\266(\025"
+	.text
+	.section	.gnu.lto_runcamDeviceDispWriteHorizontalString.35.64e556e5ab5272a4,"e",@progbits
+	.string	"(\265/\375`\240"
+	.string	"E\n"
+	.string	"\346\323F=0\345(\035\036\333m\b|\037zT\212\0243\314\327'-8a\006\361C\031\302\r\376\213\266\217\351 )ZnX\272\223X@\340`\221\311\201\366\254\020\235`L\022\313\326\b!D\356\224\0023"
+	.string	":"
+	.string	"1"
+	.string	"\t\232o\036_\300}\323\234\200\373f\321\016\360\361d\357\202bz\305vw\252\311\305K\321\377\353\233Sjt\331I\354\256\345)%r\353m#\330\206\260\037\021\233\303P\261\001\035\263\335\220\231le6\230\225\355slk\256\r\203\316\202\254\2648\264V\f*\355\206\007\361\243\307;[\232!\231\227\366S\256\"\236\365\361\201]\225\354ew\\p\006e\310\237\254\355\210\216\254\251\324\233T\257\0231%"
+	.string	",\005Hrf\217#\251%\366\265\335]\253\312\276\353\357\316\372\271\217\277\366\326\257*-U\372\001!\321\027\3228.:g\317\363y\037\215\257\302\013'\370\231\027\037\n\213\351\205\240\35190\210\361\2053\004\202\341\344\214{mU\345\r\206\" \200\244%wR\341\235^\245r\352\021"
+	.string	"o\231'\023\332\207\006\026.\312\230\027\b\256\021\0316\264\025\n\203\201\001.`\034\030\306g"
+	.ascii	"`D\200\212\002\356\362\242\235d"
+	.text
+	.section	.gnu.lto_runcamDeviceDispWriteVerticalString.36.64e556e5ab5272a4,"e",@progbits
+	.string	"(\265/\375`\240"
+	.string	"E\n"
+	.string	"\346\323F=0\345(\035\336c\367\t\231\357\323\013\326\007!\231\350\333\206\031kDzt\035\351\266\203\377\242\355c\f2+\033\023\226\356$\026\0208Xdr\240=\274\025B\213\205i\363-!\204\310\235R3"
+	.string	";"
+	.string	"0"
+	.string	"\n\231o\036o\300}\313\274\200\373f\321\016\360\321d\357\222br\311vwj\311\305K\321\277\353\232\023jt\331M\354\256\345\t\025r\353m'\330\216\260/\021\232\307^\262\001\"\330.\310\314\300\2766\030\024\333\337\330\326Z\034\007\234\375`\265<\254N\032T\332\016\020\342G\3219[\00202/\355\253|E\274\312\343\004\273\251\002/\273#\203\003\376h\310\237\254\255\210\216\254\251\324\233T\257\0241,\030\313\001\222\234\331\343H*\211}mw\327\232\262\337\372\273\253~\356\343\257}\365\253JK\225~\240\320\007\322:\036:g\257\363y\236\215\317\302\013'\350\231\030\236\212\213\351\205\237\331A0\230\361\205\023\004\202\341\334\214{m5\345-\366\" \200\244%wr\341\235^\245r\352\021"
+	.string	"o\231'\023\332\207\006\026.\312\230\027\b\256\021\0316\264\025\n\203\201\001.`\034\030\306g"
+	.ascii	"`D\200\212\002\356\362\242\235d"
+	.text
+	.section	.gnu.lto_runcamDeviceDispWriteChars.37.64e556e5ab5272a4,"e",@progbits
+	.string	"(\265/\375`*\002\255\023"
+	.string	"f%\204J\300\322Q:b`z\026\300\321\360\202\347\314%\025\347\352\017\351\234\177\310!\302\357xZ\231\212\376w[F\366\263\372\260G>;\260\nJ\275}\361\222m\220A\217}\373`\304\005\206\333\1775V\320\202\002]\327 \237\220\275wJ\001l"
+	.string	"h"
+	.string	"q"
+	.string	"B\265\233,.\307\216\301,C\f0Y\233\241\034\371i\037\350A\266\363h~\262\273\323\024c\267L\340\003\343C\227\027 >\034\217\">\264\315~z\271\333#\371p\212\200\354.I{n{\245\323\346\377w\221\234\356\366\212\342\264\252\344\374p\220\350p\025eG\213\025\007~\222\320\331\314\231\232\260\273\2369\335\211;\274\355\026\333\027\3549\"k\272c\213L\257\316\373G^\376\343}w8N\327\013\375\264N\317\324\364K\n"
+	.string	"1\211@\332-\021\214\332\2450\311\347F\277\317\177q\240\255\362\354G\306\360\244\232\331\252\207\177\357?\253l\373j)7\223\305\371@\372\331-+\214\017}\242\027\331nD\033\367\247\305\347\006\324\256\t\004\017\3152>\244P\021\352\264\0274\260=6`\343\356:\360kth\321\210\017Wt\227B\207N\020/\244\223\322\364"
+	.ascii	"0OG\372\243\317\200\231<\374\244\313\240\371,z0$\273\334\303"
+	.ascii	"\337N/\017\3639\247\334\320\233+=\035\021\242\2043\244R\333*"
+	.ascii	"\357\325Jv\273\373 \354qr\221S3\203\376kb\245!\205\020\025\274"
+	.ascii	"\321ayM\244\264R\005QJ7?p3h\227\270Iy\354\327\335\r1.\013+\016"
+	.ascii	"4\n3\030K\306\222\021\211q}H\261fX/Utk\305\325z\201p\275\264"
+	.ascii	"dd\354E\306\274X0\262%\233\221+\004\034\223q\311\310\231XLF\252"
+	.ascii	"\312\232\327\245;v\tZ\252\2418\323\352\256\n\t7\372\177?\201"
+	.ascii	"\022\252\224\307v\2009{0\031x?t\200\f\3344\304\021\352\0035\270"
+	.ascii	"\244\350m2\021\301h\242\224\3070qE7\f5\331\314 >\320\254\007"
+	.ascii	"( P\202A\250J=M)(\224\027\347\211\241\255\0348\013\032\205|\004"
+	.ascii	"2\363\273\223\3455\274\020\207\267\016'\300,\032b\345\260\205"
+	.ascii	"\343\363\323w\336h\004\227f\204\260Y\367\373P/N\034\2326\272"
+	.ascii	"z\263\202\262\346\367u<\306/\322H\320\374\355:\373\326x\265\f"
+	.ascii	"%bD\200D\221]\236lr\212F\367"
+	.text
+	.section	.gnu.lto_runcamDeviceDecodeSettings.38.64e556e5ab5272a4,"e",@progbits
+	.string	"(\265/\375`[\007%,"
+	.string	"jP\210\021F`\336Q:\273\260\300\\\032\236o\272\363>\361\271\271\003<{h\304}\346\3468.b^\373q\312\311\023\357\377\355\036;\267\276\330\330\205\r&)\310o\0315\360!"
+	.string	"'\034k(MOm\336\332\377\244\021B\344N2\r\001\363"
+	.string	"\006\001R`M\034r\234\330\253\367d\1772\217\231\313\216l2\213\345\202\245G\216\2101\251\264\335r\266Z,\242_\240$]\345\rlZ\345bS\267\302k)\260\255\3721%\255m[%~\300^\025\246\355\224\032\002\266Ub:\020\334\313|(\2172u)-\376\323\266^e\322\332\326\251\304G\354Uv>h\275\312>\270^e\320`\212\221w\006\301\312a\251\261\272\222\247m\235K\r\004\311\274F\336\327\343\355tlnU\323\276H~\362\276\364"
+	.string	"\327\030\032\207f\361H\203\314\374p\303cR\335\0364k\307\213\313Sj\351\370\356\211nA\220&\313\332i\312\230\323\245\225\343\271wem\355\230Vk\320\2205\"\\\324\225\205\243\327\024B\224&B~Le\332U\310\330\236$k\307U\377|\032\026u\203\242\247KK\307\323\273\340\361N\021l=\333~\314\2524\b\027\366\343\317\337+&\325\275\271\bm\333\362]2\265\316\2773s\224\231\247\230W.\001D\2612\267\205Z\355\247E\343(\301\372\255M\225\247\352\273\267\223.\324\314&\234\356\227,Tv\222\221\316b\326\367\355+\223"
+	.string	"\365{\027e\263\212sq\243,<\257\255\002\032\250sx\250\336\306\354P\335\250\003\250\030\257\264\277\236d\203jH_j\025\352?\377#\266\207J\235\2675Uw\017\2633y\373\013MH\f#\334^\314\n\224nvF\372\331\371\310\200\321\323\316E\337r\026^\312O`"
+	.ascii	"\321\320\255\374\002\356\374\205\370r0\275\f\224^\376I/\003w"
+	.ascii	"\227\177\272\313>\366r/\275\314\333]\326\351.\263\354\345\234"
+	.ascii	"\356\362\332\227\325\217\235\323\227\235\233\275|\331\313_\360"
+	.ascii	"1$\\;\216\254i8g\213\025\345\323\272\251jG\236\366o\371\315\376"
+	.ascii	"\263\177\354/\373\312\374-W\033\"'\215\310\361X\370Y\256\205"
+	.ascii	"yg*\200-\264=\363LsK\305\315\212o\225mW\330?&H'a\334^$\375'\007"
+	.ascii	"\371\344q\270~\r\364\266\204;s_\027\365\332\327*\032a\257S'\224"
+	.ascii	"M\330W[\033"
+	.string	"\303E\247Tty\215\234\"\341E\363\272a\274Y\305\025\270_\363\243\246`aD\230\233\357\006\370\2055\351\272\007>\370p'\330%3\206\247\321p\325+\004\253k\2407\030lK\033\177qe\033\251\357\033%W\256\331V\333\254\342\206\356Q3s\350p\277\314u\347\201*\t\362\360\341~y\324\327\362 5\320&\230\227A{\260\351\232\266Q_1\257\315\f\342f\212l\333\266\016\370]\220`!\n\004)r5=[\322qq\243\f\274\004\232\231\251\351~\271v\372\005z\303\255\252\223|\266\217\240\341\226\274}\276\005\026v'\327\306's\205\204\341\213\371\217\353U,$\255\217\026\351\0133\303a\3336y.\206\363\373h\233K$m\333\"]\355~\031t\206[\325\215{\362\360\362\262\366\027\253\235vP\303\f\303#\n\246\025,\321Xl\250a\206\341\023\023T.\305\320\330aX$2\245\320\021\243\214L\304\""
+	.ascii	"#\3241j\302\323\320x\201\005\323S\320Xt\312`\002\312\311h\034"
+	.ascii	"v0\036\243~%\216#\232\233\022\f\233\234V\fI4\021\227\242\234"
+	.ascii	"\226\240\234\230\236\226\232\210\305\245\004D\034\225bH\\2FE"
+	.ascii	"\021\227x\316\366\355\305(\232fdh\275\037\271\376y\013q\332\220"
+	.ascii	"\2415\037\271\006\203}\233j\211\257\277\232S\265{@_\335\371\200"
+	.ascii	"\356\344\225\250\030\233\252\273\207H\257\277\370\317\353\346"
+	.ascii	"D\245\244B\315\351n\250\323\276\372\363j\324F\372;\347tG\324"
+	.ascii	"\335WI\377\351\233D\214\314\321%\320D*\271_\376\\F\017=O\333"
+	.ascii	"\266my\254Rs\2323j.\345\r.\235\201\036\352\253ky\205\031i\330"
+	.ascii	"\267\375\317W`\216\345\036\346W\373o\214\325\210\323\361\217"
+	.ascii	"+\321\311\354\024 =\270*h\003\r\200\352\nM\tVt\201E\r"
+	.string	"\354^\3261\n\200\210\250QD\344\024R\210FdDAA\2224\007\240\002\221)\263m\021\260)TG\222\202$\313\032D\262\267t\005v:\230\231/\331\027\215\204\0225++J\343a\240?\036\255rX\304\357\353\nc{\220%,\311\330\305u\327s0\350gH\213\374\240\313\246\306Nu\330.,}\262+\371\220\230\353\344(Q=j\2710O\252[\261\253jV\237\rt&\357\200L\350\366\322\321\355\240\021j\267w\234\233<\345\304\303\204\361\231|\313\333\206I\234q\376(C\230\351\325^2\204\357i\364^\264\004\t\025\237\372\235\242F\022&\237\\\3765\032\312<\314\215t\227p\\\243\211h\351#\3603\273\024\243\004p\330\2026\032\376\301\330\204\036\006\013\202p!\033v\003\267f*~7;\214>!%`\350\362\005\0174\336%\366\233\350,pT\".O3 x\027\224/\033Ea\240\322\035E\355"
+	.string	"E\tB@\361\336\253Bx/43<\375\201\306\007\242\245C\361\211\342"
+	.ascii	"h\364iNz\225\263H(\324"
+	.text
+	.section	.gnu.lto_runcamDeviceGetResponseWithMultipleChunk.39.64e556e5ab5272a4,"e",@progbits
+	.string	"(\265/\375`z\007\315,"
+	.string	"\352P\350\021F`\034R:?\320\007\220\200T.r_\035L\271-\3064&F\027\373;\204\025d\377\343<\024\222L\267\b3\225jO\315E\224\252\360\341j\370;o\036h\262\017\006\316\344\375\205\371\276\204Z3k{\322\210\334I\006\020\001\366"
+	.string	"\n\001\307z\373\027\252\303!\231?/\037cp"
+	.string	"\357S\357\211V\241\325\255j\365\362a\247d[\"`F\357\217\237\327\017.Q\247sy\027\252\257\321P/4z\201\374\232\320\267\262;\367j5\270\217_"
+	.string	"\357\373%\256iS[\232\224\360iQ\342\351p\346fA\265\217.O\274\315\273'K\3262\277\354fT\277r\243"
+	.string	"\361^\241\365x\2737\352\200\031"
+	.ascii	"\357\343\350\211\326\373\200\027Z\357\223@\201\212\253\n\344"
+	.ascii	"`\306\2010\346\346\334r\347\336\350R/\341\341\325\3509h\253>"
+	.string	"\024\006\201\277\325\247\266\255\3423?l\"h\312\254$\331\"r\341\317h\rq\332`\002%[\\\007\252\032\314\310\230\\\212\026T\355351@\317\246\375\255w\\\321\262\275$[\\_\261\206\317\246\365\251I]tA\206\317\034*\221\031\2576>\236M\253\336\212\310[=\372:\262\007\364\274R\021L\355\234\237\336\356x6\255\375q\270\367\262\315zn\235\177\316\314t\314\274\204ye\023\3209V\240V\266\017\023hfV\372t\031\024v\357\275\340C\222\246\247\313\254\210\325\231\334E\361R\033\354\026\213\020\2558\335`\\\265v\257L\275\2735W\026\017\333~w\267\033g\220\251\225\250mOh\246\271r\035\352\367\247W\351\240m\232xjpM\333\2079\312\264\r\306|;m\342\026\306\375\305\254\224\204tt\267\263\321\257\374E\217\376\007~\366\023x\332Ot-\377\020[\016p\2663\361a\316AC\313@\252e"
+	.string	"\252\345\037\325\362PhY\250Z\016\252\226\201B\313?\237\345U\265\254\262\345\266\374\b\006\352\320\356\264\214I\033/z\177\364\321s\355|pQ\276\366\263\375n?\334/\367\207\371\347\376c\246\342{y\333\245\217;\230\213\371\224\207cN\206\352sP\352\205r\030+#v\257V\027\360>\242\275\320\032\246N\354\336(\020\271\245z\241\032\306\326\210\335\373\026|\212?{\024\344\335\315\207\375#\354\241\260\373\331&\326e\006\355.F\276\304"
+	.string	"\223\272\263\260\345y\232'u\022\017\274\"?\323\202\253\355\316\034\244\236.\211\302\202\320/\327\240F\352!\032\227\024\253\253\331wl\316\326~\003l\260Ow9E\233\3678\327C\362\235\304\025\215\362|}v\263\336w\272{I\001dV\261\302>\213\021`5\223q"
+	.ascii	";\330\307\352\3725\260\357\344s\271\377Z\310\225\266\007]\233"
+	.ascii	"\231\205m\313\322\363\345]h\035\352\265\0054\241xXT\206\232\331"
+	.ascii	"\305\275(\201*\370\236lN\272\314\212T83m\2626\030\017\277\\\217"
+	.ascii	"\336\240\325\305-\027\344\035u\177QC\323e\006\307p\260\346t\370"
+	.ascii	"^w\243n\246Z\0254\242=\335\301(\211\302N\367\270\342\361\354"
+	.ascii	"\031\314z\272O\231\316\226w\357}\226\332E\315l\204a\237e\324"
+	.ascii	"\352\345j&\037h\265Q@\3534\361\324\370|\271^\356\030\240t\310"
+	.ascii	"\346X-Wfv\200\"NJ\017SPE\251bT\320\206\261\351(\202Ix4\222\370"
+	.ascii	"qRzH*\243"
+	.string	"\222Jd09C9e\224Ze\034\2251>\3008>\031\245\200\234\224\036\212\311b\323\357h\234\021TL\026A\030\247\216\310\250)\243\324\017\b\0210\216O\311\244q*\330t,BA!\231~+3=02=\325061I-!\237\226\216OE\250%&\251\251\245\007\006\030\031e\224ZJ\"\221RK\303\350}\177\361\214)ejR\341_\265~z\240\23612j\322~\335\003\004h\346`\325M\246\261\206\204[\312A\251\367&\331\360\271\037\316\031\223!P\363\353P\204\260N\236\245\007\240\201\332\322q\362)\262\"F\330g\001\350\216\252\241cw\325L6`\207\332\304\t\006j\344\330\345hfQ\02032a\203\361\313\246@qJ\201J\235\034\333sJ\327\243&\366\216\223M\341rJ\201H\235\034\253sJ\327\233yP\357\270\231\023;\003\0175L9\352\275\367\006\033\254\317\227+\261\225zx7\304\316"
+	.string	"\373\023\200\210\250A8\210\024B\006\251\221\tF$I\232\016\240\002\021\252\252\016\021`=VS\232\324\217a;G\200bm^\213#\200\206\276\206\031s\216\230z\273F>\200\275\024EZ\303\275\314\334\006\307lz\327B\032\033t\250\006\346\2300\301\254\030\035P\206\022+Dh;M\350[\321J\020\322@j\310H\205\032\334\300;3"
+	.ascii	"\335\312U}\271\033\345\262z\002\033\215\241\004g\f\262\360\177"
+	.ascii	"\366\360\224\22645\221\356\036w\034KV8\026\363\263\001,>\354"
+	.ascii	"\343\242\231kA_\210\326\356X\376\320\331\270m\353z\242\342`3"
+	.ascii	"P\245B\334\226\275\027vG&\305S\3507\026\244\035\231\366Ml\343"
+	.ascii	"\205G\221\310\024\264z\317\257V\226\256\364\264O\3778\371\200"
+	.ascii	"\206 bv8)n\033\313\004\334.\031F\361\246\227\037Q+\213\313?\022"
+	.ascii	"\013h\363,\224\374\024\3242\203\235)\334\322\315d\312p\235\337"
+	.ascii	"\3215,\340\376\233Zy\faG-\214\020\362\337\317\246\266\227sZ\233"
+	.ascii	"\270:\367\262#\270.\222\0135"
+	.text
+	.section	.gnu.lto_runcamDeviceGetSettings.40.64e556e5ab5272a4,"e",@progbits
+	.string	"(\265/\375`Q\003]\031"
+	.string	"fp\252I\260XQ:\362\254\351\313\323\336\253]C\316\250\276\3319\220vL\355\270\374{\002$\243JN\t\260\304\307\270}Z\177\020\242\317,\202u4\212\315\236\215\032\276\341\035\b\377i\234G o\3609\204\242\256\363#\222O\310\226;\311\226"
+	.string	"\216"
+	.string	"\227"
+	.string	"\017gj\030$;\240j\034!\236\204J\177\252X\356\346\341\262\242t\367@\0272\373\220\025\037\320\355\023\305\327}:X\005\343\303=/#>\034\037#>\334\335}"
+	.ascii	"a\266\264\237<d\020\320\355t\210(u\237+\336q\332\305\2602\245"
+	.ascii	"\355k\027\353\002\036(6P\270\234*\203\324c%\205\263\321\260&"
+	.ascii	"\360\311\261\204\302\265\2503O\200:1p6Z\307\033\347\332 \207"
+	.ascii	"$J\n\207Sc\202@znt"
+	.string	"\352\002g\243\3644\241\273\227\336p4\276\247\357\256\315\356\326v\271C\207\371\220?\365\363\017\360\240\377e\351\216K\367\204\242+\276\320\r\001\320\255K\227V\2727\200\200\311&eHG\304\301\263e4150\374\371\370\356/\372\177\347\335\331\236\350\275\033-\312w%\263\377\312\367\255\337J\272&I\335\276r|\250\242I\316\233\275\350\304L\355\354\332\251g\347H\211\361!M8e\177\344Hf\337\305j\347\316\256q\262\355$\001)u\317`\360pC\214\017\337\252:t\"\263\027\331%U\3258=K\276\356v\260\031\306A&\300\034\256\255\310\273\037(\357\206%d\221\237\363\303F\233\266r\310\327\351\362\337+\337\340\320\022$\327k\311L\331\005q\"W\212GwG\320\200\343\212Ppw\343=\202@\300\220&R\016!TEE\177t#\326\321{\255\261\273\177;\253\276K\304\024\357\2225\3647\312\265s\\\333"
+	.string	"|\026\205v\230\350ty)\"\025\001y\200\264\260\240M\024i\210G\245\362\317\031\306\022\215 \363\317\312\304\027\316\275\310R\313\"\205\n\016\335\262{\326(\377\354\2766\373\354\276\310\003$\314\232\027\211\201e\262,\220\261Wy\023#a0u\204\214\002\313d\2118\231/YY\301\2064S\260lb\314\230\013\203\254LY\270P\363r\231&\271\301|\2210\326\215"
+	.ascii	"q[4d\313\205\202\024\321\202\255J\327\352\345b\331\254Z\260\330"
+	.ascii	"\212\006\301\2267$le\226%l\205:\373\265\331gM\350\256\030\351"
+	.ascii	"\205?M\274\321G&\035\317H\217\357\344#\273\330\335\221w\002\013"
+	.ascii	"\266mlw\242\250\254\335:$\374\367'\005\321&\221\177\234\374T"
+	.ascii	"\200\302\360\013\377\350D\034\306\016\036\350o'\276/6 \200\242"
+	.ascii	"\2513\333\227\260\336\204\007#\341m\210\\\361\222\262\240\031"
+	.ascii	"R>\rV>\253%\367\370\030+\220\264<\263\250E\210\001\203\263\025"
+	.ascii	"\017(\300\220\220n\210C\240\317\332\006\n\206N\226\262\335\351"
+	.ascii	"K\332K\034C\237\374!,dP\216a*\\\342\320.t\361a\022\241\323\313"
+	.ascii	"\320\r\250)o\330\321$\244\210\256D\240\2331|\245|\334}a\017\363"
+	.ascii	"G;\276\262\221\006 \030]\024Yx4\006\261\007"
+	.text
+	.section	.gnu.lto_runcamDeviceDecodeSettingDetail.41.64e556e5ab5272a4,"e",@progbits
+	.string	"(\265/\375`p\017\025F"
+	.ascii	"*x`\032<0\246N\007a|xm{\220]\306\033x#\206F\357\n\r\273\260\337"
+	.ascii	"\337\317m`\004I\324\355\025\004\346\241\003\001l\276\221\377"
+	.ascii	"\344~rO\363\251\264\371\005#\321\240\2217\332{\247\224R\224\001"
+	.ascii	"w\001\231\001P\255r\353an;\235\207\310\215\345\025\273\367R\335"
+	.ascii	"i<`<\345XQ\270(\267\247V\251\325\253\242pg\317\366\243\300]G"
+	.ascii	"j}\242\335]\275{\357\023K\201`2\351\253\007U3w\2273\344\364\034"
+	.ascii	"\260\346\363\352Kv\373J\202\352\031\336\373t\301\266\212\364"
+	.ascii	"\275\"\310+\350\3663\021\272gxo\364\004\333*\367\233\206\003"
+	.ascii	"\326y\234\247\357\331m&\216\240"
+	.string	"q\f\357\275%\330V\255R\274#\351E\213\3363\252\266/{\354 \264\312\036\330V\237\031\214\271e\346\217&\251B^1<\271,w\346\266k5`\275FIC\335\353\206\310\357\336h\004\306b[\345hO\255\255\262-\265\266Z\341\002\030+\253\306\226\207\023\350&5\337H\2727\232|.|\240\323h\263\223+\033\n\371tt2\266\305&\226iU\323w%\367\262\241\352\220a\360\236\0341\217\351\267\311\373kA\317\264\264\203\232\272\270\016\354\2531\317+\356t\265\345,K\033S\017\221\306\\jAO,\2513\341[\366\230g\232\267\201\315&B\347\034\262\235e\351\342w\241\324\244\240\013\236\323\214J\263\275$\256\231\372\256\3231V\346\340\025\212cF\245W85+U\232\355\211V4#[\233\316\334\366\232L*\323\240\032\";D\266\263\270NS\004nj\210G\263\261\324\312\217`\2635\023\363O\263\320\366"
+	.ascii	"\217f\314T\252P\231\266\276kwb&\346\316\004\342\336\313\3564"
+	.ascii	";k\216j\346\026\302\314D\230\217c\001l\177.\232[b\177f\025m\210"
+	.ascii	"\005{\357\305\300MH\351\346\"\200\241/\255>1\341\372\234\214"
+	.ascii	"\226\370%\246\212!\303\333\351\237\005\247\316E4\024\373e\177"
+	.ascii	")d'\250\336A\303\323\222\376\033C\350~\337\202\007\300\223\317"
+	.ascii	"L\243\206\267\263\277)\2128'\366\313\366@n\370\016='Y#<\332\223"
+	.ascii	"K\313F\203\207\304|\022st\351\377\306\334\351}7f\030/Z\250H\321"
+	.ascii	"\177\315$\032P\263\b(\347\017-\330\254\241\0055_\3505\335\311"
+	.ascii	"\216vG`\347\007\215\327\214\325y\315\016z\257\271A\2233\003\244"
+	.ascii	"\363\002\244\263\202'\347\004G\347\253\242\263U\2233\002\244"
+	.ascii	"\363\001\244\263\201'\347\002Gg\002N\316\003Zg\001E\347\252\326"
+	.ascii	"\231\252\350\034\240u\236j\235\001\264\316R\255sT\321\031\252"
+	.ascii	"uF\032\235\237Z\347\243\321\331\251u6\032\235\333\326\271Xtn"
+	.ascii	"j\235\331\2423S\353\274\026\235\325\3269-:\177\321\331\233\234"
+	.ascii	"[\b\201<\346\240\033:J_(z\241\\J|\n\252v\302\264\240n\301n\274"
+	.ascii	"\356\274\356\275n\276n@\335\177\3152\367\340\th\342\\ \020L&"
+	.ascii	"7\305\223\363\263\253\273\267\r\267\233"
+	.string	"\326\3538M\247\001;\220[@\\fd\240i~\260\255\362a\356>\355\007\254\377\264\036\276ZF\357\362y\357\315\301\366\236\326\223^\017}\375\347U\321\265\277\326\363L\236h\211\006}\315\304\262;\343\277q\236\325\301c\225\321iy\016\036\016\266\016U\216u\200cV6\235\214\262I\253=\007N\305S\265}\ttN\331\340-\330t\224eYN(J3og\212\377ha\024A/\226\214\313A\363u\007+\203\316<1\270\313\265\210\227\242\244\342\303\222\005?\272i\345\225\025B\223\310\242T\363vr\353\021V\022$\373%'\275\323\364\321MK\255\314\3126\345\233\267\223\304\037(\013c\2477\366K\316\362d\234\322\213\267S\304\253z\204\221\004\304U\275\200\252F\017\234Y\031F)\306\333\371\341;\260\325\3035&\244\306\"<,R\275Q}jH\b\030\200\316\331X\250o\234\214\002\274\352G\350gJm\212\017"
+	.string	",\204"
+	.ascii	"\374IUa`Fy\306\333)\225\247Qc\021\336i\212\232\002\365QPl\220"
+	.ascii	"Q\236\036\371\244\346\370$\344\364G\2474\306\262\366"
+	.string	"\215\t\224j\224l\274\235\355\231E\335w\335p\204PA\366\337\0165\203\350@\246\3423\207pg\323\027\233\304\260\317,\302\233L\3172\251\255\317L\302\305\b\251\277\252\237\032\022fI\237\331\204/Q\024H\371\376\323\357\246\245\377t\017\341\025A\261_r\027\366ZgN\222\341\322+U\375A\032\263\376[%nKFJs\223\270)\025\307^N\317\256.\022\267\244\246:G\334\217\3308\303>lF\376V\346\356\032\242N\324\212X\021{\357\262\323\270\333\300\332\352\332\205:\231#dfE\335i\212\334y\037\264\352\257\226\005\314\301\207\004\371z6\003\005\t^@\264b|!\321\372j\275\202l\001\321\332\261~\001)\342\245\325\265nu\027\327\027\216.\255\257-\026\310\026\216/\255\021=\204l}}i\305\370*\302\205\344Q$\307\263\016\tZ:\266\214h\355\320\321\225\344\332J\n\331\302\021$\251\243\313+)A"
+	.string	"s\r\321\352J~qqu%\333\350\355\264\337\215\201\230)\313\353c\352V\256}\327l\"]\245\274\276\224[\271>x\360\376L\206Z\341\f\026<\003\237\323\n~A\202W\360Uo\256\022T\212\323\027\376\n\317\235\253\217j\013\263\350\302\367 bba$A\244\025!\367\343s2\262zuO!\340\nG\360\311Ca\205Vc\277\344\003\217\340\233\257\333\306j\340\017|\027x\003\237>jZB\341\032\026\205\035z;\013\374\373\025\362\301\340\0334<\001\013z:\330\260F\236\027\366\210\300G\265\311\005j\370\016\324Sz\205y\020\213p"
+	.string	"\237\210\206O^\351\275l\037\f\333\370%\036\341\037\2369\f1\214R\372K\272\343\277q\223\201\372i\366\031[\274;\202\312i\366\025U<\326;A\002\005l\366\031a\374\0274N\263\257\b\241\035\274\223\256\203\376i\366\031_|\0012>i\305\024\337\340\2350\027Y\033|\262\214n\331h\220p\r\017\323\221SV;x\030\317\204\007f\021Y\032\323\341\322\276\334{\303*\255/\336\r\013\317\b\216\265\324\212\365-\276m\003\023HF\206i\327\r~\300\0172"
+	.ascii	"\006pXcG\243\305\206]\3623\312e\235RN\311d\217\254\255\016\370"
+	.ascii	"'&\230\201\026\250a<\344\024b\210DDDD\222$I\007\201\005\204\030"
+	.ascii	")U\226\007\022`\004z\214*\203\220\221\221`j4\005\245\373\006"
+	.ascii	"\341\261\316\232t{qDS\034\301\251\246\351T\230M\345kq\240\356"
+	.ascii	"\025\224\321\325F,\312\312o\326`\315\206\224\333I FTF/)\3353"
+	.ascii	"\256x\211\346\003\335\323\264\270\327-x\353'\220\233Z\251<\225"
+	.ascii	"\275XZ\026\315\"\017w#\230\220\317hwT\377\270\317v\320\332l\236"
+	.ascii	"\"kIea\263\266\037\272\rb*n\223\022\301S\253n\363\023\340\232"
+	.ascii	"-\315+s\301\274\306\350\022L\256K\004i\301\216x\375+\t\210\355"
+	.ascii	"\204\211\210\231\203\255.\262C`\223^\254#\214\302c\274*\325\340"
+	.ascii	"\254\271\252\263\211t\350\364\037\371f\221\217S\220=\331\320"
+	.ascii	"\211wp\220\271\342f\215\263u\260b!\241\300\332\257\354`\232i"
+	.ascii	"\361\330\215\346\245~\354#\333D\251\232\326\221\336\354\007N"
+	.ascii	")G\250'\252\250\032?YN \336\274\373\034R\202*\035\333\036\333"
+	.ascii	";\033\024\326\261\002\335\264>&\241B\222v\212<vN\274Z\211M"
+	.string	"\321\347\345\025\206\351\274S\334\342\rJ\227u\3440\311\n#&r\257\031z\202\251\374\244\334\250\341\327a\264\213\220^\236\350\023I=92\rrt<\332\344&\210\265\023\274\347Z\025\367|\021'\224\230q\224\362[\007(\007y\265\375\216`\261\250\030\272\211\237\025A;\r\257\220\321\363%\351?/b\340\235*\206\325\377\364\216\3754.\205\036\216h\235\322\205\361\374\201\366p\024O"
+	.ascii	"\232\262\320c\210f\232\367\247K\333|\332\271H\217\016\241oE\021"
+	.ascii	"b\b\203\374!\356\267?\024\365uL\367\270<0v;Q\376\"\276Km\234"
+	.ascii	"^@\351\371\246\202*q\225\346\354\rEu\3325M\317\017\031\224e\343"
+	.ascii	":A\363\306\371f\326\246\233\343Ln\346\020\220\244\266\207J\327"
+	.ascii	"\020P<\347k\t\263:\254g\267\230C2)!\2230\273\352\315\034\363"
+	.ascii	")\321\250\345\"[\270\212\005J\344\037\314\243%\315^*j"
+	.text
+	.section	.gnu.lto_runcamDeviceGetSettingDetail.42.64e556e5ab5272a4,"e",@progbits
+	.string	"(\265/\375`\b\003\355\027"
+	.string	"f-\241I\300\030Q:`a\255\257\210W\234\230!"
+	.string	"\356\213\351\266\022j\252@:\001\001\220\0079I)OE\205{+\261^\177\202\225Y\025\252t\203`+\346\331\204\004l "
+	.string	"\305y\270\236\330\027\026yyM\216\254 \204\354-w\222\001\215"
+	.string	"\205"
+	.string	"\216"
+	.string	"O*\320\371r\305SmK\302\251\346\334\275\317\211\314^\204\305\005t\353X\361u\227\021\266\201\370\272\345c\300W\361\004\300\327\335]\t\023fK{\3113\243\300\356\346v\244Kw\251b\037\247\035\254\224'm_;H\035\340D\271q\312\275\2401H9WP9\333\254T\201\216\016/\247\234\013\272"
+	.string	"\312\321MF\3166\251\210\343L!\350\222HA\345l(\201\237\220\234\367>a\344ls\206\027\272{'.W\343\033~wQ\354nk\227\031\004\315:\273/\362\243^\376\001\376\363\233v\256\270s\303\323\\\3204\267\002\230Kw\356\244so \301\024[R\320.\007\377\312\236\261\004\246\217\352\022 \027\372\207~\243\363\356l\317;\321{{R\362\242\331\215\3107\256\337]v<J\335\276\017\342kj\"y\222\331\207R,\250\225]\013sz\220p\020_e*\225}\320\217\314.\004\243\255+\333Fh\353Q\362\351\322M\343\301\353j\020_\337\251\372#;\220j\033\240\\[\220wC\314\"\\\226\312 \377E\020\333\\Z\312\225\177\013s\243S\256\271\2112DG\304\212\241\262+\342\274\026\212\247\273)p\270q\002\364\033\302\361\037?\237\243J\003'\217"
+	.string	"\262\222\232\367\275\267\362\235\210%v\367qg\001_& \212wG\232y\334d\332:\256m"
+	.string	">\203@=NnaN\202HRv\340\370li1\227&RPQ\025\312;\347\030^j\374\230wV\006\232X\027\343\307CKR\025\233\371e\267\254M\336\331=\r&b4\256q\303*\266\232\031a.\262\0066\276\006\320\0222\f\253\330\212Dx\242\265\212\2153\035b225\223\201\306\325\212\305F\030"
+	.string	"pY2#\253\245b$\301z\251\310\226\312\325Z\241P\261^0\225\f\202%k\306\227*F\222/\325\251\354\323f\235=\2613\302\353\325\237\006\276w\021\314\016\207\327\3437\271\3100vW\344\275\320\202m\013\023J1D\322\356\036\026n\364+\375\314%\220w\232<40M|\337y\036\304\017 \346q!\337\207\205\313\221\2132 `\242Q\360\354S\250\301F}\035\"k\274\234$h\206<_\007+\311*I{4F\352\004-\311,r\021b\300\340mE\001\005<$\364\rq\b\364\257m\260`\350e\251\267\023\261\244\235\3041t\307\017q\236AY\303\217\354\306Q,t\221a2\241\323\313\320\r\250+/\303h\302\274\210WN\223\273-\374a~\264\303W:\322"
+	.ascii	"\006\243\353\"\207Gc\350{"
+	.text
+	.section	.gnu.lto_runcamDeviceWriteSetting.43.64e556e5ab5272a4,"e",@progbits
+	.string	"(\265/\375`\243\004m\037"
+	.string	"6\372\314J\220\026R:\201Wx\263"
+	.string	"}sRV\224rP\345\267Y\374\227_\273\005'\\ Q\246\275\210\304i\nT\326\372?\232\226Y\271l\005]\374V\013\f\315$f"
+	.string	"/\r\022-\r\007\230\221X\025\303\f8\210\037\251\233l\271\223\f\274"
+	.string	"\253"
+	.string	"\266"
+	.string	"\307Z1\204Q\222\342\232Q\342\274Y\357q\354\225pg\210\274GVI*\f\n\301M\026qZ+_\021 \035\252\202\017p\213fY\031\314)\340\200"
+	.ascii	"w\210\312G\204J\217\fr\337\233\264\206\243\224\371P\217\022\272"
+	.ascii	"\224\213\327\334\273\324\204\353^\244\0026p\336d\344q\354\315"
+	.ascii	"\3636\366&3s\003\007B,<\262\351\350\346\tIQ\221-\367\"q\335\343"
+	.ascii	"\302[\2636\025\362\207\267\017\216_\314\316\216\030\221n\326"
+	.ascii	"\003Ib5b\214/*\216\023%*2\214EZO\244w-\260\224C\215\3068Tw\230"
+	.ascii	"\224\025]y\n\303X\244\024\346\302\275\227\251\221\221\306\031"
+	.ascii	"\346\314\214\202\231c0W\035\001\266\333\016\261\230M\031\242"
+	.ascii	"\\\230\366\273\273\263\212jPx\320\3164\355\004TP\222P\367Y\231"
+	.ascii	"~_\371\372u\214Bu\226\354*\322%3rH\233\211\371\365\366\022\363"
+	.ascii	"\257\316:\227\372s>\365\337\034\371\013\370\327\271\346U\377"
+	.ascii	"\314\255~\031\246|\273Q\266\335(\237\225\262\265\224M\033\345"
+	.ascii	"\312\224\233\362\013\020X+\232U=a\365\031\362\036-\275\334"
+	.string	"2\263\013\310\257~\254_\353\357\372\277\204\370F\236\365\255{]\3111_bN\367\"?\344z\022\241w\361\352\265Q\237\306\234Z\2347;\255\202V\260^\033\023\236\2448\335\313\205\342G\216D(\036N\206f\275z\236l\2629+mN3\203\bAo\244\323\365\336\350!\327\264\355\017G-Tg\3115\342\203\366Z\227p\314\262\305\206\326\276\351\203\335\254\207\242\335{\235\374\t\217\377\303\253\207\246\311\350\346\317U\354\b\022;3]\373JQ\313\2425\001\315\314\t\356\025\004\320t\357\205\360\341x\205\b\016\342\330g\272\246;\312\214(\351\017Z\346\334\305\202\347\275\367\001_\311\217\017\r\332\275\367?n\376\216U\206d!\322%\317\320\237\231X\0047\233\371\004\020\275\021_\371\233U\227\031jiD=d\006\227i\263\231\022\t9\227\035\313\253\332L\247K\244$\227\335L,\f;\035\317\017\020\203\317\267\323\361\310\374"
+	.ascii	"1\374\200A? \317\366K"
+	.string	"\001\364\351zV\347\333\361\202|\272\336\271\323\361\310\344~9\r*r\275\\\220M\303\206\023;\240\337O\347\263Y\366Y\240\363\001b\2413\341\323\303\361\200p;\240\234\n\234O\317\207[\240\303\274 ]\017\367\343\361z\270\030\344}\275\275\304)\236\272$\267\314_h\257\374\351\345I+\271\325\017\373\255a0\363\255\371\002\261\213\274\002+\250\305\253\367\362\260\2206em\315\314\341iu\354V\350M[\037\352\350E\255\353l*\2554\302B\244K\005\317\n\236g\333\222\220\225%Eu\021\231\220\206\020\315\207]\247{H\026\204*\207\036\354[@\034\260g\005V\250A0h\b3\210\231\222\221\t$\314\244\311\001\220\002\021\242\254\007\021\320)Utia7\200\022\034\324\303qv:\357y\266\275L<\376\217\355X:\tKX<\302\310~\341\202Q\257\350\344\230\031\001\236j$$\3115\332K3\335\022\013\022\375\267"
+	.string	"3\225\264\264\3115\244\215\216\255\203\251\325c\240t'\376\272Q<\307\037$\341\312$\236\276+\300\322Z\241\264\003\375\204\301F\252j\360\276\002\354\210\233\232\r\374\013s\033vh:D_J\2656\3072\211\334\326\365\f\230\327\016\272\347\376#d6\3722\222\342\333\327\235N\346\250\215\326"
+	.ascii	"]QKF\336\210G\243Y\177"
+	.text
+	.section	.gnu.lto_runcamDeviceSendPacket.part.0.73.64e556e5ab5272a4,"e",@progbits
+	.string	"(\265/\375`\271\003\345\030"
+	.string	"\306+\231E\260\034'\035\274X\313Bb\2347@9\031c\227\0358\370\221\351#\234\313\035\221x\036\230\371a\024F\344/-\2275\223\322\220\276Y\3269\037\265\320-\335\365\251\032\332\317yG7\253\252\350\370o\304\222M\266L)|"
+	.string	"\177"
+	.string	"\206"
+	.string	"\025\302K\251q\236%*\243\243\245\372\261\366(B\254qy\334\254j\177\351L\341\243\b\275g\327\b\032\335\356(\341\323\017\300O\217/\360}\202\037\360}\332W\262]\2739\264\325|LZ\025\222\022\034Nnv\267\365)\217<\374\364\244~\241?\364)\342~\334S\021\347\343\322[PfL\023"
+	.string	"8\233\327"
+	.string	"\310\220\334w\327\0348\"U\001\377T\033v\327\340\321\255\272m\025\266M\330\336\0039S\275\362\324\340s\277\352S\376\317S\3177\375\336TK\225Z?\376g\t\310"
+	.string	"ew\307\024\234\0252wK\316\345\366\263\324\374\235u\270\324\256\013R\326\270=n\327\362-\341uA_\243\333\212J\321\022\233\335\033\204O\217"
+	.string	"?\277<:\271\332\270\270\233\275*\267\022\376\212\237<\236\265\025\311\242\333]\016\340\247\2177\365S\234h\323\211\306\342Y[\223\222\013\236\276\311\024*\324\306\335\341\251M!W\034\031\035`\244D\262M\373>\311:r\322t\306\246o\334\243S\372xr\312\bP8\342\364\350\261\334O\337\273|\267\002t\275\364\2425\367#\252H\016YJ\033&\206F \t\314\241j8\300\360\031\006\206\202$C}\237R\226HBE<Ri\277\370\216\266\223\224Fl\343\177\221\021@J\264\177\376\004\303\200\324\356Z\360b#\346'\371\364\205\276O\225\337\335cB2%\036\335\320)\225H\226\337\275\225FlP\035.h,$\020,\304\216k\206\313C\3145s\305X\265"
+	.string	"r\305b\262\227\352\363k\002\354\365C\003\326\3425k\311~Z@?\256X\3535\013jM@`Y\f\330\2545C&\233\265tl\3537\334\220D3\310\333%\242\201\215\024\235\262\003\005\345J\346H;|\022*\031\311\241\245\257\221\201\273k!G\252\031&\037\016\035\364\342J\236\211\220\005\372\001\204^\004\245\216.\312&\207\234"
+	.string	"\024AB)\352\200\252d u\002E\223\250\"\217\200\252\344'S\250\330\311\005\2112\nU\250\2010\307\0303\301\f\005#\"\263\244I\007p\002\031\273\261\016\021\240=T\265\245\255\031A\350\332\356\344E\336\303L\247m\374\b\307\"\364"
+	.ascii	"\361\242\243\251l\003w'\024\3002p\npX\031\370E\204M\304(k\024"
+	.ascii	"\225Z\241\243k\263\007c\031\006\300|\361\311\217\202_L\2078\355"
+	.ascii	"c\3451\353\356\216\364\f\242@B\032\025\355\267hXd\206&n\304i"
+	.ascii	"t\016\334\311R\364\222\\\351\037@\237\231,\377\027\005E\177\367"
+	.ascii	"\004\036\365\305\352\\\017[6\214.=\004\235\271WD\352\352\346"
+	.ascii	"\372\344\356\356gY\311I\332\215L\335N 4\251-f\251\030K\003\374"
+	.ascii	"W\343)"
+	.text
+	.section	.gnu.lto_.symbol_nodes.64e556e5ab5272a4,"e",@progbits
+	.string	"(\265/\375`2\t\005 "
+	.string	"vr\267H\220\234M:\030\303\353\333\262\311\022E\304\357*\250\247\201\233_\211B!\241\240}k\271\017\345\356\"\233\306D\""
+	.string	"\300\336\310JBRSS\367\316,\002\274\022b`h3z\332\323\355\314\300\266\270QSkd/\261\211\354\035\255"
+	.string	"\242"
+	.string	"\234"
+	.string	"]\271\220\350\272eDC\211\350\245\020\255\004\242\023|h\005\3264\315Z}\036:\311\326\253\016\261\221C\033\330\320G\032\332(C\017ah\340\205&`\241\177\025:H\252}\024\272\027\325@\023\232\367\341p8\224\320;1hb\211\320:\b-$\202iye=\350\242\353\240\177vQ\256\2064h\037'!\230\026\203\036\020\264\240kW\3144M\023\252\013\210c\226\364h\362\324Dd\0303ZN\235\343\2659r\246\251o\"TV\330\034\246\356\021_\253=\315%\333Xk\275f0h^\251\265k\365\372a+\2322u\324(u"
+	.ascii	"\261\326:C\nF\367RV\\\223\212y\363\273\307\235\277\333I`\274"
+	.ascii	"-\327r--\263\320\370\022-\032_\002\307\317\316\241\361\230h\264"
+	.ascii	"D\246P\251c4\336\242(p\374-\2658\007\0359A\261\343r\357\257a"
+	.ascii	"Y2\357PR\177\234\372\376\233\255\316\313\b\035\240\337\242\366"
+	.ascii	"l\342lu\361~`\357\267'O\274\224=\327\227\016 @\342k\364\001\032"
+	.ascii	"\215\300\252\221\252"
+	.string	"\272\301\214^ \243\237\250\332i\252\233\2061\232\tF\327\255\027]\273\270\350\232\266\350\352\205E\327/+\272r\251\350\007):\002\212\206p\242\031\fM\264\203\022\001<\331e\364d\217\212\311.$\312~\267N\376bY\321\213\007X\026L\336\006\303\210\344-js\002\374\213Z\021\210\260G\232$\374\233*\300\277Y\t\037\237?|\214.\341\343\034\204\217\003\275\201\3368m\244VV\251\320}U:t_E\225\251N)\005\356}\351\321\275\357,\272\357e+\356\270\343\203\013\360~wt\277C\213\356w'\360^\227\r\334\353R\242\373\\\316\245\007\356q8\264'\367\240\267\214\340\336\226mg\r-S\244\373\031\212\323|O\353\363e'\212\321\265L\334dQ\023\025o\221\272\337\314\244\273M\201\272\373\363\363+\034}n\203\245\317o\356\026\315}\212\206\243\r\270\335\022\360\033\354\271\320\355S\326\206!\031\202!\003\314"
+	.ascii	"|jf\373\025\332j\247\312\0308\270\226\0256\207L\254V\271\276"
+	.ascii	"\230I\322\304s+\2646\b\224+-\031\317\355\351\304\363\304\363"
+	.ascii	"\031"
+	.string	"\026\2461\321\016\034\242\375\226\376\312\337P\313\023\242\305\212R\371.#\350WR\371RH\226\237\345\244\322.a\343$\tY>\212\234\275\n\313\356\236\300qB\312>%{/\333\030X\021\237\354%\232g'Fo*\273\315`\002\200\245\250Q\020\f[KF$I\222\3020\007\360\002\241\241m\033\021p$\252(#\221D2\025H\005=(\2034\230\023\314Y\323\331\325\376\327\300\262\233\013b\365\341o\304di\350\355\023\022\321)]{\225\353\273\324\f\265\262\226\235\321<\203:M\241.\326\032\275+\274\334\314\373\204\275\276\270m\210\237\266f.\266\325\257\255\023\n\234\247\217\254P\211\326\3477\243\305\n\n\323\240\341R\0272\242U8\210\3421\035&\n\030\331\334\317\222\246$B\241\240pp\266\367/\321\374\236\266\325Z\372\201\347\bB\217Nm\353o>\304pxe\321\307\264\032\371\016{\341\204\033\304Kf\312Q"
+	.string	"\226\326\f\265\225"
+	.string	"e\360X\347\361|\037\357\343O\222S\343\1778\374K\353\203e\222Uw\263\230\362\311\354\325\364\023\312\325+U\356Z\001}\221\237\222\360\020GD[;"
+	.string	"0\271^\\/..\257\027\275\266.s\236\373"
+	.ascii	"\217X}%\342\354\366\256\313!|\020:W\305[\303\202^\360\265\327"
+	.ascii	"\211\253\2715\3317\017\205\034U"
+	.text
+	.section	.gnu.lto_.refs.64e556e5ab5272a4,"e",@progbits
+	.string	"(\265/\375 \017y"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	"\001\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.64e556e5ab5272a4,"e",@progbits
+	.ascii	"(\265/\375`^N\365<\001\272\017*sT \016)\225t\351\355\316\334"
+	.ascii	"&B\303\343\373\375\377\373\237\313\b[Fc\362\225 ^!\367\t5\030"
+	.ascii	"S.lw\373\333D\217\222\306V<V$TXF\311\274\266\332T4))!\326~K\352"
+	.ascii	"\017\316\346z;\227\230\335\224\r\350\221{\245\252\226\350M\366"
+	.ascii	"\226;\005/\006\004\007i\007\2777\204\334\026\350o\022z+\210\376"
+	.ascii	"\375\243}Hq!\027\004G\206\"c\203\353\321K69\252\240\264\364\275"
+	.ascii	"\315C\377\336\361\256\372k\\K\325\346\214\227%\032\221\276M\305"
+	.ascii	"\363\336Q\307b<Y\351k\001;\364\276\243t\340\310\375\330\252\321"
+	.ascii	"\367o\03594\240%i\256/\216\035\013\310\025\321\353{\013\207\006"
+	.ascii	"\n*\305\311\325,!\220\2263MM\236\370\356\370Z`\3551aU-\\\252"
+	.ascii	"\036\216\021\206lD\345\002\353np\f\340R\230JX\351\232#\334\302"
+	.ascii	"\004\202\251z\225\2569\202\253\260\235\272\2506+\335\323\004"
+	.ascii	"\224\200\3411j\245\r\212\224Tx\332\343\353e\333\350\247\256\321"
+	.ascii	"P\335\324.zF\337\350\030M\243e4S\303\350\027U\254\235z\351\275"
+	.ascii	"\242Y|\207\031\327-\236\207TWC\204\277j\361R\365\354\327\022"
+	.ascii	"\035k\302\202\353\257}N\365K\375\013\201\264\234aQ\267\202/g"
+	.ascii	"\346\253\335\317\323N\265\260\211p\214\230\331i\205A\033\202"
+	.ascii	"\20293;\354t\350\320\241\203\215\335\222\266\025\035"
+	.string	"\334[!\350\231\353\006|\264\252\203o\243\320\277\225:\251\371\325\205\013\363\026\321\022eH\337\377U\254\221\372\210\231wpW\235\217\270\276\267M\350\255\022\372\036\323\312\234@&?\273\276\316yu\214\215\221\027MW}\337U\252\230_\260\250\033K4c.J\337\367\033\372>C\337_\350\333\b\212!\b\372\327\277\373\235XC\300\362\372\322\345\330\020.\251\223\352\373\236B;\250:\370-\003}+\241\257a\320\212W\273T1\0165\357uK\275\373\214\0213\207\345\314\314\231\261\373\202\243\331\367\265\017}\345\200s\n\013\013\013+\007\374\232\005\355\240n\300\267\352\340\020\252\016>]\335\200+\226+\367hm\315G\337\3272\364U\254\326]\301W\230d1+\037@\\\317&g\256\234\363\0069B\316\254\354\350[\247T\272\302\263)m}\353\\\245R\305>\250UN\"ff\346\314\314\351 c\2364\351\373\332\004}\375"
+	.string	"\333\302\302\372\001\376\337L\315\033\020**}_\267\3203\341\336d\226\270Q5\373\326\267\256nU\312\353[m\373\007\020\2671\252o7g\242Z=\300\251\325\203\263M\bQ\023|_\213\240\177ekv\335\\\213\242\265\252f\367\372\276\304\350\373W/f\375\252i)\310\331(\347\254A3\261\332j\352\213\266\323\201)% }_\231\320\213"
+	.string	"V\23386\347\034pX93\377W\263\032\245\212\325\263\372\344\025J%{e\346\314\3149\037\304\317\363\177"
+	.string	"Q\317jYmnP\224s\016\034"
+	.string	"\370\372\033\323!\2303\263\303N\007l$\005\003\020\337\217"
+	.string	"\305P7\340\256:\370#\240\265I\r\253b\034\324\261\177"
+	.string	"q\253\004\313\\93sn\b\223\020\206\351\373\006\240\032\256d\020\247A_9\300\265\260r\200\337\350\371\352\006\214Sup\355\342y\365\322\301\313'fn\346\234s\232\t\017% }q\325\301\177e\362\327%\225\213\003\253\324\"*7sff\310a\316`\332\321\367\314\272\001\243U\007\333\001\254\320\260\364[\033\213\225\352\003\376\212"
+	.string	"\002\230e\220\200\377.\340\257aN\332\253FS\031\200\377\264\177\323\330$e\212\274\277\276"
+	.string	"\006\177\035\376\235\305\"\tU\344o\217\376\252\342\257\311\277\367\376zd\215\252Z\377\331\242\006c\211\376\312\202\277\307X\345o\253\315\177\035\372k\013\376\372\302_]PS\344\003\375\026\006\366\005\277U\301?\310\300_\215\376\272\366[\027\374UY\323\201\377j\360w\333\026\204\340e_\370\277v\005t\205@\310\312\377*\032\250\370\255\315_\317X\360\327\026\177eQa\\\001/\314\276v\267\353\363w\224M\361\333!\233\374k\211\277\253,\362\267\307\277\347~[$\361W\r4\232\r\372+\013Mg\201\376\366\262.\374V\005\325\315\022C\320v\001\377\225!\256\371\214\375\035\302\236\370\253\333\321\3776\371[C\372W\250\236\277\241X\024\374\225"
+	.string	"$\250\341\006\001d\222-\022h\325\022\352\005\272\304\355\221\001\231\377\3128\013)8\375\315a\203\023f\376\313\3647\207\377k\366\004\033\214\240\371\357\322\327"
+	.string	"\253\004\236\264\216\t\032\374\367\350\267\f0\301_?T\021B\374\025\304\337\036\374\325\311\226"
+	.ascii	"\004\t\376:\304N\340\257p#\370\257\200\337\202\240\001\025\307"
+	.ascii	"\377\261\232E\001\027T'\004,\300\346\277%\376\336\300~\2406\375"
+	.ascii	"\265\204\n\370W2\313B]\332\022\365\002_3@\207\377b\340\357\033"
+	.ascii	"\226\304_K\260+\374\337\200\005\333\201\013\324\t<\303o\367\376"
+	.ascii	"\352\305\252\360\267\006\233B\345bQh\235\377k\315\301u\376+\201"
+	.ascii	"\1770\201\337\374\366\355\257V\376K\261'\374=\303b\340\357\026"
+	.ascii	"vD+Y\021\177%\241\235\254\t\327\360\017\376^\376w\353#\300o\263"
+	.ascii	"\374wK\273\232-\241^"
+	.string	"9\316o\235\224\375?\373\217\366\377\376\366\311o)\360[\022~\333\200\337r\370\355\006\277\335\371\255\316oo~+\363\333\376\233\360\357\301\277\001\377\346\373\333\356o+\177\317\375\235\3667\331\337\314\277\265\376\346\361\267\324\3378\376\246\361\367\213\277\231\376^\372\273\350o\345\337)\376\026\372\233\370\267\317\337\303\277I\360w\211\2773\360w\n\177\237\360\367\210\277M\370\233\002\177C\340o\236\277\027\360\267\001\376\346\340\357\f\376\256\371\333\3765\360\257}\177\305\373+\226\277^\371\353\330_\253\376Z\344\257\371\257 \370\253\004\376\247\375\257\362\177\314_\353\377\274\377X\376\n\367W\267\277\262\375U\355\257g\3777\370k\003\376\273\375\225\354?\013\377\307\376\352\341\257\004\370k\363\257^\177M\362W\255\277\032\371k\326_s\374\025\352\2571\376\n\343\257N\177]\376\325\305_\221\376z\364W\242\277*\377\032\202\277\226\360\327\t\374\265"
+	.ascii	"\377\245\374_\373\257\366\237\353\277\n\376\313\375\337\240\260"
+	.ascii	"\260\260\360\257A\373k\016\360\207(A^}\355\240\035ccE\257I\223"
+	.ascii	"1bD`E\005\347\226q\256\n\361\200\3300}\306\327\003\314\231\237"
+	.ascii	"\237\r\354!\005\3606P\004x<\256\372\332?{\267\202\360i\252\354"
+	.ascii	"\377\fV\363c\"\325\3675]yy\266\217\211\227\333>\031,\314#\204"
+	.ascii	"}-\237\315\227\272+H}\355\236\305\262\302\345G_\253w\303D\204"
+	.ascii	"h\254\357\377\336\366\177\346\312H[2\327\3675;\354\354,\236L"
+	.ascii	"U\016.\267x4tG\202E\372\376\317\336\375\237\221i\362\302C\307"
+	.ascii	"\235\3352Uv\245i\311\005\203\353\242\262Z\032H\316\321rj\252"
+	.ascii	"\357kV\240\257I\252\305\"f\261T5\253t*\231\343\313\313%\003N"
+	.ascii	"\323\207\336\312\331)\267s\267s\366\n\232sV2s\023MQ\213$7\301"
+	.ascii	"\374\264\344\360[+\267\265Y\023\305\313\253\257\245K\t]@\365"
+	.ascii	"\265U*\233\022\022\302\027}-\225\332\004\244\003\253\352\373"
+	.ascii	"\277\n\367\177\346\024\302\\\001\330\3674h\350\377\372\376q&"
+	.ascii	"Z\346\234_\234\314\274,\262\301\177}=k\345\360\337T[\r\360\377"
+	.ascii	"\332\337\001(03\221\02619\347\352\207fE!\262\321A>\351r"
+	.ascii	"6\232R^`\312\311h\212\206R\330\224S\006\245\260\251\2544\272"
+	.ascii	"RfX\346)\245RX\316\031r\3169\033\031)GD9)\205\021\345\fJa\331"
+	.ascii	")\037]q\252\2319\245\314FQ9C6\312D9,\312\251\003%\243)'\2450"
+	.ascii	"\"\247\fJaSN9l*c\310FD\313%\243\274\314\220\303\246\274\344\260"
+	.ascii	"('\fJaQNJaSV\265\312R\026\337\013;1Uf\225\210\222Qv\301t\203"
+	.ascii	"h\211\201N\211\031\225\267\344\\\233Hy\231\351r6@\3167\242\226"
+	.ascii	"[\210hT\264\":\027EeDQ\001`*\242\212\312Ft\312\232\351\224\214"
+	.ascii	"D\345l\244\bEf\3129\347\021\224L\272\374\243\322)w\334\310-\220"
+	.ascii	"r\026@f\346\314\224\263\262f\272\234\2632\347,\263\274\301\314"
+	.ascii	"\031\n\203\022\026\023S\316O;L\371\2062\r)\347nrAsR\n\243\212"
+	.ascii	"\342I\023\013\303\312ILeUj\021\225\261\362\226\251%\032\246\374"
+	.ascii	"\312-r\316\365\013\212\345\004\243\257\257\024\013\207\003\310"
+	.ascii	"\342\357\255\357ifHys[\022\203\207U\316\231I\013\243%c\331t\\"
+	.ascii	"Wb\226\255\3110p\304\006^_\213f\323\252\330\345\254\332\2319"
+	.ascii	"8jIO\344\372\236\246\t}\275\034\216A\275\034\376m\224\263\033"
+	.ascii	"!Y`Ef;\325\305\225\2651}O\243d\311f\244\232c\250\372~\206\317"
+	.ascii	"By\322\254V\200u]\372\216\251p\245\347\325\3673f\350E\370\362"
+	.ascii	"\001\"\3146\371[\332I\021\264N\254X\025\263a\026\254>\241\001"
+	.ascii	"\005\n\276\237I\202~f\006\372\031\026\350o\231^6D]\177X\270n"
+	.ascii	"\275~\313\304va-P\274r\364\365\300\254\033\360\271\245\352`\273"
+	.ascii	"\204\347\226\353\313\023\030x}O-UGI\022\256(zL$\267I~\273\325"
+	.ascii	"p\307!5\304\372\332\252\203+\024\236[$hnHb\216|\200\032\255\221"
+	.ascii	"qi\265\220\263I\234\022\"#6\013\252\017\307W\337\"pK>-}\217\n"
+	.ascii	"\242\377\355\020{e\255l\020\213e\205T1K\304\372\270\375Q\355"
+	.ascii	"~\357,\221.\262<\354\327\022\215RT\205/\347|\033\005\004\017"
+	.ascii	"\313JMQq\261Dl\217Jg\231hhR\023*|=\205\252\356\016\313\022\261"
+	.ascii	";\262\322\313\bL\224=\2269v\201M8\234{\264\211\332T\035|T\013"
+	.ascii	"=\352\003\265U5l\354G\230\276G\235\320\313\024\242\227\311C/"
+	.ascii	"\343\206\036\255n\300\227bu\330\034mNy^\372\332\033\026G\025"
+	.ascii	"\2639\236oj\252\320\232D}U\344\234s}\033\226y\033\376\255\r("
+	.ascii	"?+hV4n\241~\373dk\324&\013\336\330\312\372Z\276\272\001W\240"
+	.ascii	"\352`;\203\347\226\206]a\205\350\257/\005\254\f:L\343(\fY\f\030"
+	.ascii	"'\322\027\016 0j3C\334R\307\213\256\272U7\220\2608\331\345\n"
+	.ascii	"&~Q\3722m\232\232\202D5\271\230\241\005o\211e\262-\252\230ua"
+	.ascii	"W\274\006\3322\245\312\206\243\314\220\363\016%X93\255\013\273"
+	.ascii	"T\331*\335\0233\277\220\031[\206\241\"x\213\232\334M\301\267"
+	.ascii	"\312`\241\227\261B/\343\003\375mRe;\303\342\374\250 \331\243"
+	.ascii	"\261\265&X}\355\021Y\n\262\006X\352KH[\337\017<\267Fx\213M\n"
+	.ascii	"L\021\207\0330vE[}\255\222\210\253hF_\233q\217\302\243\266\276"
+	.ascii	"\227i\001\246\t{L\003\266`\207\351\301\026\323\201U\254\013\373"
+	.ascii	"\356\315\245\361~{\312_\003\013\273J_\261\301\027X\007\305w\227"
+	.ascii	"\306\204e\327\243\211G\213\013\270\277W\024v\227\376\263L,\020"
+	.ascii	"$\335\340"
+	.string	"\3139\007f\251M\034%\206\\\244\345\t+gfao\351\321\242\006\0266\226\261\032\250\337\221\215\253\f\356\337zq-\327~5^NS\204}\277\240_\254\226~\364=\276\363R\305\272\257\367D\350k\2761%\276\234\363N\207\223\n\325\021\034\367\036cA\217\277\320\316\343y\353\341$Q\342\270\352\313A\021\264\003]\335\200O\253\252\203\217g\240\307N\350\261\022\372\263\020\375\331\207\376\274C\177\312\241}\345\357\271\246B\023\366de\251o\323\361\274\255\360\035\301\b\354\013\201(\250E\253\033p\004\252\016~\263n\300\t`\326\r\370J\251:xG\312\033\237\336\020\267\276n\247\221\275*P}\177&A/\202Z\233\325\246eb\311\214U\r\362\345\314\254\201i]\206\243\304\220s\225\030,\265v\322e\226\211u\202\2230\177\263\365Z\267U\261V\353\263w\224F3\352\260c\363\344\024\346\204\336\237Yh7\353\006\274"
+	.string	"\034\350O(\364\357\261w\331\337M:\254\311p\342\252\336\\\364\355'\r\345M\326\315\334d#D\345L\324d9br&\312\251\325\203Z=\270J\250\206@\301\367\247\f\264\305x\336c5drc\206\364\325\251:\370\347\022\255Qu\003\316\240\352\340\277\301\372\213K\325\331Q\327\373\353o\257f\326\027oSC\372r\250\033\360Yup\335\302\363\356\272;"
+	.ascii	"\233\2120\341\242\311#\364A\330w\t\r\341\032\036Q\337\237J\364"
+	.ascii	"\177'\351\255FR\305ZI\003\t\322G\354\327r\306E\322\020>\236V"
+	.ascii	"\322S]e\231X(\364\270\342\3139+i\036\375#\004\322rf\205\026!"
+	.ascii	"|93w:t\350p\023\310\246\364\206^\255\235\031\031fRW}\177\365"
+	.ascii	"\320\213P\244\255z\210\375Z\242jUy<\357\"M\244\322\341\0201\363"
+	.ascii	"\362\004tvR\266\262\332H\025\353\"\215\365\313\314\035:\354\310"
+	.ascii	"H=\031\323\204\357/\031\372\273%\244\257"
+	.string	"j\262\004\331\361\3257wQI\236lP65a\030;QV\213Z\226\337\226\315\221\033M\246^\034\303\270\201\252z\"\325\027/\261\023\335\224,\037\330\251p\206\332\025\262\273\245%\314d\206\345'\267e\t\2678f\202\242\003-H_\314\342*\315\356\314\224\364\305+\276W\363G\030%\230\201\0346\302F8\311\213\257o*\311\022F:N\nB\245\352E_|t\225\367(KLT\024\234q\306D\267F9G\034V\316\224\036C\226XyLD\207\265\343\312Y\0231bNB2\254Je\267\034\033\363\223P\357&HS0\r\211\340O0\202\347\340I\2263\252\304\t\217\312\340\215\361$\353n\252\357\347\227\276\023\3604\313D2`\212\324\030r\376\375|\036\022\f\273\264\276\247\337\345\322\320\264\254\344pW\323jG\006H[~r\331r\362\355D)\275@ \t\024%\203\2029Zfxuy?\371~\356}"
+	.ascii	"a\331p\004\243\220\216\372\376\324C\327\322\262\262t\261mT\300"
+	.ascii	"\234\304\300\253:\022w\265\334\002\225\024\330\367\274\233y\221"
+	.ascii	"4\004-\b\325\021Za\335O,u\247\335Y\226sQ\b\314\242-Y\351\211"
+	.ascii	"\003M\234R\252\231\345\247\335\337VZ\230\276Z\252T9\255\004Y"
+	.ascii	"\206\241R\343$\306\006\031\335O+'\214;\246\036S\326~\266\255"
+	.ascii	"\235s\026\260m\305M\340\032\337\013)?\347~N\311\361J\342\347"
+	.ascii	"\324\367\224\213;\341\3167\313\246\203\312\250\357\351f\337l"
+	.ascii	"\023\221\236\027663\2633\215\206){\340b\221\204\3663\315:\335"
+	.ascii	"L\231\221\324\"\212\f\217.kpg\224\363\214F\311\021:\250\234\275"
+	.ascii	":\030K\306\300~\212\201\235d\266\017\315J\n\264\r*\031\024\274"
+	.ascii	"1\203J\0225\366\223\354'\224\017 \354\332\215\213\266)\300\276"
+	.ascii	"\347\223\246\223\232\2566\244\272\276gX\345\341\202\356J\223"
+	.ascii	"\177\306\306\213\325\f }\257\003\206^g\t\222\237I\220\234"
+	.string	"Lkg\367\342\224\fn\325|\261\370\262\302\365\223\371\323\353\003\210\347m\035\261#\352{v\035\347iN\215\257\357O&4YUaH\372\336\001`3\234\234\372\236K\236g$\257\205\227\276\247\222\267\331<i\021\354\261f\251P\325\025\365=\267\214\370\370i\345\343\324\262z\225\231\237\242\224^B\254\305)\031\024\314JO\034l\274t!\t\273\372\251\365\323\310\007\020\226\355\256H\307V\3373\353\365\307\0271\245\276?\211\234E\376\231\031\"]\312\b\373^G\006zb9"
+	.ascii	"\307\240\224\230\276?\207\370\270\"D\253o\327\267\341S\210e\233"
+	.ascii	"\311\271\253\357\004\3623\310?3\243\226\243j\252\357u\230\320"
+	.ascii	"\377\374\361\317\310@\261\263\201\325\367:J\350u\224TT'\217\212"
+	.ascii	"\201Y\324\345\356<r\244\b\225\263\352'\217\026\303\307\224\353"
+	.ascii	"{\356\270\312:\366BH\227?\035:N\251 ta\250T\036]WB\242~J\275"
+	.ascii	"\255&J*I\260\357\377X\310\302\245\312\225\0325N\034\265\211\236"
+	.ascii	"\rA6#\256\036\347\215\2378nx\200Q\303\321\367\264\321?\232\376"
+	.ascii	"\354\262\372\236P\326\351\246p\2600l-F\214\223F\217\"Y~\202\350"
+	.ascii	"\023/\\Lf\374\244\201N\261\221\306\245\357)\203\004,Ln}\377\307"
+	.ascii	"\001\336\031\226*}\257\341"
+	.string	"\252\251\351|Q\301r\023\036S+\342&x{\f2\341\362\277\237/N\247\03105\242\306\364=\227?Ucl}\257a\005z\rE,X\234L!\324\234$F\265\307\227\363\023\007\013\330d\204F\213\237L\315\030p`<\372\376\257\177\320\001\0026\373>\203 zt\036\235K;Q\266\256\213\r\301\255\234\2378\3140I}A)\375\\\322\253\252\263\242\352\373\2773\211\251\314zI'\322L_\027<#\234\"\033X=\372>C\035\372\237EU\354,\252z\027hf\"'\016oDW1\004\363R\n\0032\b\241CRDP\360T\222%\271m\241y`\220\274\316\374SI\244\356KI\337[h\357P\346\017(S}/am\3268\201\002\244\260\357\035S\331\220\004\222\t\351{\305\324\346\f\222_R\0163e\354\013\335\rs\007\337\200\f\2511\326d`\230\002\301X0\030`H\240\372>C\215\276\276\013\370"
+	.string	"\033\0360\301\275\370\373\005\264gcn0\351{\375\312\232\f\031\353{\277\324\3465\303\273\333\303 \006\017\357\362e\220\005\3456\265\201\231\355\375\362\325"
+	.string	"a\202\241\322\367\352\345\234\035\351+\353{\363<\370\362\343\255\357\355\202%K\226{\327\304\221\002\023\026c\313\357\335\021\"_\304\364\275Z\354\035\216\213:\260\276\276\327\256\262\2352\330\222\3600<\251\253\273V\366\226\334"
+	.ascii	"\362@*\322\367\030\252\246L\271V\366\256\204\216d\344\321\375"
+	.ascii	"Ziv\231\332\352{\253\330\273\266%ZF}/\025\234\261\270-\251\276"
+	.ascii	"w\256fI\214'H\372\376/\007I\030\026\205\267\355\266\3358\f\271"
+	.ascii	"(/\017\353\324\222\261\"\r\3567\356\001VU\272\372^)\366\356\246"
+	.ascii	"oL\231\324\367\276\271\345d)+\273kff6\313 Wcj\277k\330J\213\030"
+	.ascii	"`\337\233v\205ha\355\365\275hK^\350\242\3144!m\241\322\367\236"
+	.ascii	"\325\346\013\"PP}\257Ym\322\340\355\311\251A\201\002\3452\351"
+	.ascii	"\272+\254j\330\365}\316\215f\363\202\371\260\341\363r\322\344"
+	.ascii	"\023\023\273Sy-\252\226\036[]\315\260\260\313d\020\313h\332\201"
+	.ascii	"\325\3678R^^\027\fO.\311m\313\346GT\321\216\257_0\234(I4\232"
+	.ascii	"\372^\246\275\263{MO\256\324&\025`\227(}\217\223\357\222\273"
+	.ascii	"\3442\251Ar<q8Y\b\311\321\304\365\313$\005I\374\240\334\354\241"
+	.ascii	"YY7\t\232\207,m\375&1@\027\032J}/\222\242\334^\225\276\367Hm"
+	.ascii	"\322\020\022B\331\321\367j\341(6f8\351{\215\3307;\2050K\336\333"
+	.ascii	"\212\027k9\372\376f-H\220K\204\347\f\353\227\210\005\0063\222"
+	.ascii	"\276w\310\322FW\223\276\367\2526k\266\230\346\210\372^!\034\214"
+	.ascii	"\321a\365\275V5.\262\360IY\031\247\025A#[\372\376\006\310\216"
+	.ascii	"\035\367\007\236\217\337\0376O\262\360\224\372\336\036\366\316"
+	.ascii	"f\216\355\205[\337\313\243\212P\207\216;Us\316\371)\333\273\245"
+	.ascii	"$\267\255+\365;\365V\343dm\206\220\2767\312\230\204\226\207\345"
+	.ascii	"\316\2703.\016\231\243.\367\306/\216\267\013Fli\260\357\265Q"
+	.ascii	"\221\322\340\364\372^(\234(1\262Q\337[\003'\253\212\220\246\276"
+	.ascii	"\367\2516k\224%`\244\372^\032\225\355\302\200\0215\204\r\214"
+	.ascii	"\353\317\253\357m\272\230n"
+	.string	"\f\246\013\003\347\\\231QM\313\374\264\344p]\\\027\027\006\252\274\272/~apXj\271\353{\235\356\3626\331\364@o\263t\217\356\321e!\302`\222\333\326\212_\026\327\250J\034]\337\273\324n\\XQ}\377w\225\376\317\320\314\320\272\203\272J7)\263\221-\261\031\373X\262\264v\221\372\256q\214\341\353\273\003\003\346\0265m\271D\277E\365\255\002\346\251\034}-\341U\336.\274\033,\256\362\346\032,\250/c\314df\024\r\276\025\332\0258^X\005i\217P\232,\221\"\217\303\025\b0L\016G\004\031\217'\210 !\302\007h\350\223\363S$\236\310\240\230\n\031qJ\244H#\220O\316\013B>Ai\020>&W\2209\246?\303\224\204\221\005\024>I\"\013J\374\024S!\241a\217\006\303\344p\304M\210\017\220\300\363A\204\2324\305\020\231A\261\005\"\320\260\007E\222\310\202\236\241\217\021\bh8"
+	.string	"\027\214\311\2431\211L\217=.\370\f\223\310\236\"1\tD\0342\321\323\243A\210\017\374\fS\022'\206L i^\020\362)\036\223H\231cr\205$\262h\024qb\310\004\322&=\016\t\335b\ntL\"q2E\006\245A\370(<\200\220\376\f\001\371\024\211 \034\221C "
+	.string	""
+	.string	"\bh\250X4\026eX`<\242H\032\2132'\206)\320}A\310\347\230D\342\324\2478L\361S\302\211!\023\310\232\026\212\304\"q\030\224\22281d\002\251\341\304\220\t8G\341\301\347\350\363\001\331c\"\305OO\b\237\243O\315QxH\203\210I\001${\220\034H\203\210I\024I\004\002\"\006\341\237!\r2M\276`\202\n\022G\341a\003,\250P\002\204d\332\302q\230\354\300\005\037#\220\210\364h\024\021\224&\221/\224\310\331\331 \231\242\240\001\3628D!B"
+	.string	">\304\3441\005\301\001\200\206\311\242\261\005\304\2431\205\343\020\205\210"
+	.string	"\024\215\304\026R\022@@\304\023\204\220\304\0249L\201R\022\016@\"\323\343\n\fH\221F \021\037\024S!\017(\240hL&\207L\030\036\323\240\241\21049\004\032\n\"\226\350 I,\252\200A\bI\034\341Bq\b\205\210\024H\210\230\004\032\342"
+	.string	"\212$1\004\311\024\005\016\311b\232\002\003\305\242QD\ndb(bD\t\017\274\220j"
+	.string	"\304O1-\301"
+	.string	"\343\211\242\n\311\024\005\3420\004?\305\022\222\310th\005)\211\004"
+	.string	" \004\017\311\343P\310\303O1-\301A\001\220?F\237t\204"
+	.string	"D"
+	.string	"\035\223\"~\212)2'\231\272\3403\\\201\004\n\344\020\320\t\001@\246\032\244E\343\b\244\n\036\334\207xL\213i\013\350G \301\001$\204P!\363\020\021\b!\002!\340\207\210"
+	.ascii	"\017O\004H\340AO\002\217M{N\310 \331\223\266\200\210\304\311"
+	.ascii	"\264'YL\203\206"
+	.string	"Z8\016{\200\216I\237\236$\021H\b\351s\324 \211\fJ\223*\f\025S\016\244\311\341\217\320\007~\322\264\250\203\354I\022\217!H\177\214\"\222@C\310\364H\223\324`$j\360\3021\231\006\245@iR\003dO\013\304\023E\243\b\r. \207\034(\016\235\260I{T"
+	.string	"\200\0202\b)\324B\006\025\351OQ\20549<\376\f\rM\364\2500\232p\301g\bd\002"
+	.string	"G\341\341\304\220\211\240azL\"A(\032\203\202\214>\004@\366\234\0302\201\304\307\244\220\375)\2466\231L\252H\223\027\331\303\202\001|R\240\264DRE\232\304A\366"
+	.string	"\021\207\311t\304"
+	.string	"R\241\027\222\267H\fBU\f\203\320d\221h\\\001h\030D\364I\177\204\322$\262\204\212a\320M:\0044\004A\013E\3421\211\254I\246C@\303\024'\262\247\205\"1\231LKl\370!\366q\210\302\347\246A\303\342Mj8\ndz\034J\016\323\023(\262\307x\242\250\202\206\264'EO\317"
+	.string	"\212F\"\362\230\202"
+	.string	"\310\350cL\032\217B9\306\023E\342E\366\340\320\230\300\311\243\360"
+	.string	"\002\362\230\246 \036\1776\030&\207#p\220=6 H\036\215+`H\201L\fYH\201\217)\361\0041YL\177\2104iO\372c\344@\362h\024\242I\177\214A7\355\361@\362h\024\272A\026\215\304\244\220Q&M\016I\374\f\rM\240i\013\210%\322\026\020K\240I\364g\230\246p\264\371\031\246)${>\210"
+	.string	"D\034\262pLO\234\0302AE\322\346\230\\!MAL}R\022@C\3421E\356${H\340I\026\211C\250\013>C\023@@C\021*\2164@F\243\t=g\362\001\270Q(=\202\2204\032\217 \324\244\307\033d\017\212d\013\305t\003)\262h\024B\246$~\322\244O*\244\002\003#\202\206>\305\241#\002\222=!\222E\342\220\314!"
+	.string	"\001\021\035|\240\003(\240>\036R\037b\212\364\307\347\b\202\221\bB\2218\f\002\301\347\210\004\301\303\316Oq\030\024d\364\221\371/\303\002\337\020\362\204\316Of\005\206\021\327\267\302j\t'\325"
+	.string	"\342\030\242tY\004\300\357HF\222\335\025*;\306d\220\372of\031\245\251J\346\350\344\303m{^\256\310\030\235\200ZFk,d\212\316A%5\035Y2D'\341\265\343\213\n\"\243\304DqW1\240\372bB\033\203\302B\302\226\311\270\360\230\3602[\266\224\210\360\230\276b\303\246\205\227CL\373\211\230\323\023\fs\213Z\256K\324\322 \021T\271\266\203\t\006?\3354y\"\214\023\304LE\220\332\312\002\2452P\356\231a\300(O2\222?-0jY\202\264\337\311c\310\\\217\242\276\343/?\247|"
+	.ascii	"a\331h\302\260\325a\351\213\275P\225\321\321\365\305|'\236\330"
+	.ascii	"\324\022\332\3369w\262E\r*\351\245\325\344\020\f2\227wZ\271p"
+	.ascii	"a\276(\273\234L\034:\257\302\037x]\266\005\312\210__|W\323\304"
+	.ascii	"\344,\256\357\001p\204\267h\271IF\340g\265\314rl\3277C\312F_"
+	.ascii	"\\\207\261 \301\202r\367<\275\254.j]}\261\025|%\307\007\326\223"
+	.ascii	"\265\357\235/G\320\210 \027:\354C\306\305\2220<\252\234d\030"
+	.ascii	"\255\311K\214\312\375!\303\002\r\311\331\034\266\242\251\322"
+	.ascii	"\233\2025\345N\341\2548+\254\"\207\217|\305\230#\302q\230\311"
+	.ascii	"\230\240W\215\276\370\255\026\026\212\311\231\b\277\345(\205"
+	.ascii	"\301a)\307o\3179)hA\325\002\337\037\273]\034U\314jh\3416\033"
+	.ascii	"\210\235\244\215\311K\246\025+\251*k'\216f\231\214\300\2768m"
+	.ascii	"\204\250\234\2110\032V;N;\023\247\345\210\311\251\325\203\316"
+	.ascii	"*\203A\210/&\303d\370l&/\265\fIr\3332;>s\353\322\003\353\213"
+	.ascii	"\313\376\320\037C\261}\247\226\276,P\236\\\0306\215\205\340\214"
+	.ascii	"&\036\252\2657'c\314^\231\341\202\346\267'F\243\253\274H9r\302"
+	.ascii	"\364\301\016\213\t\207-=\215\271\232\303M\316\027rQ\264\220\364"
+	.ascii	"\305^\330\013\177\245\240\\a\0173\217\277\232b\371\357m\353["
+	.ascii	"\230\311N\224\262o\2045\251\036K\301\033 2\256\222\222\0343\301"
+	.ascii	"\\\201,\322\354\270\360\222)e,\262\024\261\251\"\204\333\303"
+	.ascii	"J\254\217\001\344)\231\3318\0333+bf`WW\370H\b5'\215e\271\342"
+	.ascii	"\353\002\\\243\202\265\216\217\364\217\031 IZh\365\305F,\017"
+	.ascii	"\231\300\035U\262\372\342,\033\267\343,\253/.R\263\374\340\242"
+	.ascii	"D\251/&\362<\243\035D\344\372b\254\252\307\225C"
+	.string	"\r\256/\036\322Da\320\354\226*\241\025\373\221\245+\013\310\017\004[U\260\334\264\363\346\245\307R\320\246\001)\034\frl\305\303\206\222k\003U\216\343\250\034\330\207\255\263\311J\260\334$C\246\004\207\305\336T\025\325\261\217\343\036\037@<\257\310CL\254/\346\201\253\360\016<\305\244\246\205\243/\226\372\336M\331\227\217\033X\307\r((|c\007\315\\F\252\360\315\314a)c\202m\034\337`\223\001\363\333\242\214!C\006~\332\211\262yXa\250l\301\321\341Ea\032\307Oz\2050\276\214\351\213g\\e\205\242\250\243\301\203b\\:JQ(\013\t2SD\"I\322\001\303\026@ 8< \223M\263\260\007\023\300\005\313j\204i\252&\231sdhDD$)((I\246\003\241D\001\243\246[U\013\203H\215fx\224\266(%\307\361\225\375\031\366\"\033\310J\317\247p\303\251\3533\352\262\023\326\363\\\277"
+	.ascii	"\370\223\021g\207& _\274\267,\332\247q\363K \336l\230d\354LF"
+	.ascii	"\323z\2214E\351\005E\262\211l\240\247x\234^[\306n\031\200\013"
+	.ascii	"\354"
+	.string	"\244\272\275RV\262\324H\243\227\007\366\223C\223\007\256r^\367\362W\304DW\344\216C\252\177\033\312\203R/\f\362?u=\235\033\303gVd\024\330\236i\363\236\\\226\244\254\177\366\006\212\210<\013*\235\b^\327\364\313\021\264ve\353\232\307\277\033\312?\332\260g\205-7@\252D\307\340\224\0338\230\267\200\347M-\236\216+\217\206\031\351\213Q\243$]\321\246:\253&\021.Yu\346/\002\003\264}\324#\307\315\266rB\021\255\3704p\b\220\357\030\246\023\203(\223\250QXVU\221|=\271\245\327\021\312\345\211\343>\260\333\345\212\232\341\303\347\214N\254\214\025,\353\216E9^B\220\241&q\t\016\322~\356I(#\006\346\326n\337\346\030\242\312\225\360\004\200\334\277\0376\323V\307*\315\201\b\335\344\347\304\372\002\233\270\224\031hbbz|\023\232I5\251\021\234\356\007\305x<\007\211iS\003ln"
+	.string	"\361\3246d\222(\002\327\312)\335\233U\237}&D\177\220]\026\3378\\t\300\244#gR=T\n\357]Jo\347\376.\332\243\252;j\222b\263U\003`\327QSN\251)u\337C"
+	.ascii	"\206/\3439u\232\246\217\033{\241S\2733\b\374\006}W\212\233\311"
+	.ascii	"\225\005\n\002\236\232\326\270!\275\266\237d\203ew(\346[\372"
+	.ascii	"\246p\354=8\rd>n\355\340\302sS2\005\334a\351\0050\3350\304\263"
+	.ascii	"p\"<q\r\211$P&r\325H\027\322l.\375l\362\354\254\222(\370\312"
+	.ascii	"\317#&\270\031\214\234\344(T\312\304\234\013\235vj\020/!\355"
+	.ascii	"-%{\220\365\362\235\335\343_\013\033\373\255\220\203\224\022"
+	.ascii	"\273\260\234i\252\362+_ROzc\021\242\330i*\261G\211\340\025W"
+	.string	"\360?\372|\322r\356\360\273D#m\201f\327\022\036\366\033\224\032\f\253\020\3170\254\211\245\262\316\217\360\335(\2351 \316\322\337s\316i\206\037\022\031\250\254[\202\223X\312\303\311\364\362#\265S\301\273/y\220\240\262\326,\355S\235e+\225}\017O]c\013\264\006\\Fu\245\035\307\216n\200\322~\215\027[\327\bA\322i \225\245\001\227\240\373o\344H\200\254s)\324t\311"
+	.string	"\254R\216\324\234\007\264g\\\034\337\314\r\250\275|\260\177\322\240e\260\001\372\324*+\020\214\300\002G\fxj\237\255s\234=\204$XM\336\300\233\336\226P\321{\277 oG\016\217\212\371R52\017\307\035\340\335\035>Z\276\002"
+	.string	"\b\324hg\266\372\034\b^\3106\n\236\205\374\227\306\325'h]\361\301\236\322\347\372\332\231\330)h\374\365T\270:l\0231|\032\211]\300\327\022&\217\232~\366\322\322uj\221\233R\217\361\261\032\3068\334\220\340\004\304ZHv\241\267\330,\035\213\251g\0301_$\373\026\246\371\005\244E\200!\002\001\371C|\373\300\016\343\266\245eZ_"
+	.ascii	"T`[\363U\n\313\216(\253Pl\262\200\364\372\270\"kl_!\270\331\026"
+	.string	"\212P\032\271\212\006R\n\023Ru\311\325\334\025\322&\022\341\242F\261/F\304c'sJ\2571\\m\273$5\201\372\304\371\007,\252H3\3139z\335\245\270\250'T\321\302|p7\206\213\220\370\216\3243\004\317\365\235\323\022\233\305\267\234\371\370yC\364\221\021\272K\003\013\2079\234\030K\264\222\266\030\277&\200lpBg\307\322\355:\315\244(\252%\305}\237\212\022L\325\3166\250\315\t\260\024)\301\245\324\326\320\204\213;\365%\372\035o\227\372\234\230\255\230\366l\344\262j\351s`\320\252\355\340\016p\021\223r\213U\265J\257\362\240\232\031\354\242{M\253\244F\276\337nL\256\221Tv\322Y\313\306\256\177\352G\260\252\005G\255T\344r\005\3018Q-\223n\213P\255OP\374\022\210:\236\016\215b\204O\254\313\201\362r\215\351\tv\036c\350\243\375\345\b\t\007z\034\337/\223\363\315~\234\317\365\302\272"
+	.ascii	"\314\375,\352Bn\212cwO]:G\003\006\2174<t\301\016\247\237U\331"
+	.ascii	"\377|\317\354\351\236\365\221\355\307\301p\300\203\376\265_!"
+	.ascii	"\031\264\333@Y\206P\254\336\204F\242_\354\242\226\363:\251\303"
+	.ascii	"W\232\017~}o"
+	.string	"\007r\235\273}[\332\204:\242G\r%\323$\362/\311\237B#\221\332\262ln\252w\345\255\236\213H\200\354\351\327\250\252SK\252\027&#\233\325`\376\257\254r\336\244\227bw\356\351\324\304\210\236\253\260\242]\276\263\345FY\255\024\b\2229&*\217\305`\032\313\272\351c\231\021V\363_a\235b<\273\r\250\270\260\361Kmy\252<\263E\246\220\341Zr\270\372\344Cy\233U\234J*d0\361T=\307 W\0300\013\217\332\203\240\300TlB\364\216Ewi\226\230\n\366\0074\202\351\324\013\320,('\033\311:\f\373\266'\237\220\246\301+#zm\224\007\262\353]\024\226\235\224d|\222\236R4\np|)\363S{b\214O\373\306\205\324W\016\331-\025\213\350nk\324y\023o}+\241\253I\002U\306#\265V\004\236,\210_v\201B\334\305\026l\244\270\002\334\"\331aP+\222\225\214\323\364"
+	.string	"\027:\316\255B\nB@\023RB\275p\330\214\3103J\326$\353-\030\247Ue\323\002\215\f\"\255\007{\342)U \234\207\346]\272\023\341\323$U\200\200`\377\202a\302\202`\244u\317\373<\347\253\310E\342\316s\231\223\020E\200\357B\007\204\bDW$\032\271E\347\221\242\340\327\324+\231S\321\362\247H\322\035d\327iB%\315\341.\025\351\232\367\272?\276\r\246\342\341\226i\0340Y\307 \027\376\270\246\232\003\020\203\241&<\317\321\tJ\263SM0a\372\361\3649\203\374p\341\251p\013\033\334\210\260\206C(O\035"
+	.ascii	"\333&\311r\335\222\031\367\322\302\322\321aW\370\257-\377}#O"
+	.ascii	"{\311\311^Y\341\213[\356\375\235\277\204n\200\274T"
+	.string	"\233\267\037%L\250\322\3172\345\345\375\366\302\020\205D:T\031T\306\2005o\220\204\3251\341#-\2268\366\313\372a\227\230\206gK1HH\263\220_\213\314\322\f\033QHb\210\206\257\267^\344\241\202j\307\035\246\2061P\024\220h:%K\267\243z%-Y\n\033\356\006\004\275\n&d\367\352\233\212\345M\305\335\021\214Ny%Y\006\030\005\3012\017\232\207\314\314\353W\312{g\025*\366k\255\275\013\340\337\n\341\310\262\373Ad'\217\200#\203\2172\363\337\2765\234\3016_\177\245\210sU\251I\260\300\353,\340\376\222\001xt\267n|\034\021`\217e4\234\007\250\252\006\016Cl\240\230\312f\376\\\tCbC(\216\261\374\241e\0357\226\260\t\250\013\264\255@7\233\241\2763\330j\314k)o\324\254$\314\203\371\346\031\311\233\244v\227\365\240\245myC\234\321\273\343k9\277X\360\177z\274Q"
+	.string	"`t\361\302\244\357Oe\274Q\231Or!L\314\374*\262J\263t\274\037\230O\333\230<\022\207\0060,\242&\242\363\212A\027\3523c\224\317\242\003\211HDy\363\27073\332\215\245\206d\270O\366\331\212F?k\033\365\354=\001\020\234\370h\210\201\205\262\272b\364y\354\371\334\277:\311F\321\006\210\303MCM\t\333p(\337\247>y\271\201($\2145\2723{\205i\013{"
+	.string	"\245+\245C\r-w,0~Q\016@\345\365\200\206\365\b\256\222/\353N\324\244\353s\356\020\244\241i\240\321\025z\325\320\b\2033\023\201I\303\376\245ZD\005\210\261\330\203NUBY/S\374\212_\243\312\216#\001c \306\244\356HN\212\357IXk2\213\377\215\037\267\214\325\027\276k+\034@\217W\017\005\273\027\216\3328\370D\252\344\201\375\304\243\206R\321\232\206x\241I\016\224\270\330*%\354\222\333h\221\225\f.Y\305\275i\0328\373\377\025\177\274\320.\202\246\033\205lJ\254\204\016\206<\240;\020\324\240YN\244o \335\205\261pZ\316\277\371\0160nU"
+	.ascii	"\241\313\216\300\\\203V\207\261\333P\241\336G\320\177\320>\257"
+	.ascii	"\227\302z\304u\314Tg \276F\321\337\253\274\202g\343B\261\212"
+	.ascii	"K\217\276\260#\r&\244\331\231\346\020]^\024\350i\177\217Y\311"
+	.ascii	"=\342<\265\302\217\021hq\300a\214\271\031i\300\212\321'\301b"
+	.ascii	"\363\005+\326;q\353\0314x\027\325K\260\242\033\320\227\023\314"
+	.ascii	"p\316\330I\346\201\200#x\275\336\275\006\361\275\251\361,\"\006"
+	.ascii	"L\256\274\027\375\300\342]x=3aW\264\377\034\374\364O\032\336"
+	.ascii	"\222\377u\036\236\316\301&\374 \365\016Q7\b\036`\341\005\032"
+	.ascii	"\232\201@\370\351\324\337H\364\270.\372\3542>,\337\273a\375\346"
+	.ascii	"\300A\237\215,\3613\255`M\201\005\035oZ_\252]\f\362\200\021\363"
+	.ascii	"\311\350r\306\374\241U\253=\222\222MK\203\177LO(\303tR>1a\203"
+	.ascii	"\205/)\374+\346\257\365\001\272\023\367\273\347<f\264\024\272"
+	.ascii	"\321?-\353\r\376\272h\227\036\331\017\334\262\030\200\343\362"
+	.ascii	"\343\246\301\327A\311\243\324l\374\"\230\305\177\241\212\025"
+	.ascii	"\363\350\f\351A\036\332\316*\257\274\230bf`8\037{j\323\277\233"
+	.ascii	"\342&\\\370\271\2461\325\255\035ds\016\363"
+	.ascii	"_g\334\261\312<\320a\340\327\257\217b\\\272SD7\003\336\024G_"
+	.ascii	"\023\264\341\275\265g+\342\324\244\223\263\375O\260b\362C\375"
+	.ascii	"E\3267\343\366\353\374\033\364\215\234\333`,\271\217N\332\243"
+	.ascii	";<8FW\334D\352F\324\257\223\257f:$\3127\210l\310s\243y\244\335"
+	.ascii	"\235\2213\021v1\372DY\367\244\215\205\322\033\363\013;\333\215"
+	.ascii	"\325\353\325'\fG\262\336\r\340\242k\222\325^\202\t\215\343\214"
+	.ascii	":\250\377#et\b\374\b7v\251g\212\261l}en\325\023\177U]\001"
+	.text
+	.section	.gnu.lto_.symtab.64e556e5ab5272a4,"e",@progbits
+	.string	"runcamDeviceInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\002"
+	.string	""
+	.string	"runcamDeviceSimulateCameraButton"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\002"
+	.string	""
+	.string	"runcamDeviceOpen5KeyOSDCableConnection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\002"
+	.string	""
+	.string	"runcamDeviceClose5KeyOSDCableConnection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\002"
+	.string	""
+	.string	"runcamDeviceSimulate5KeyOSDCableButtonPress"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\002"
+	.string	""
+	.string	"runcamDeviceSimulate5KeyOSDCableButtonRelease"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\002"
+	.string	""
+	.string	"runcamDeviceDispFillRegion"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\002"
+	.string	""
+	.string	"runcamDeviceDispWriteChar"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\002"
+	.string	""
+	.string	"runcamDeviceDispWriteHorizontalString"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\002"
+	.string	""
+	.string	"runcamDeviceDispWriteVerticalString"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\002"
+	.string	""
+	.string	"runcamDeviceDispWriteChars"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\002"
+	.string	""
+	.string	"runcamDeviceGetSettings"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\002"
+	.string	""
+	.string	"runcamDeviceGetSettingDetail"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\002"
+	.string	""
+	.string	"runcamDeviceWriteSetting"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\002"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\002"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\002"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\002"
+	.string	""
+	.string	"crc8_dvb_s2"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\002"
+	.string	""
+	.string	"serialWriteBuf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\002"
+	.string	""
+	.string	"sbufBytesRemaining"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\002"
+	.string	""
+	.string	"sbufAdvance"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\002"
+	.string	""
+	.string	"sbufConstPtr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\002"
+	.string	""
+	.string	"sbufReadU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\002"
+	.string	""
+	.string	"strtok"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\002"
+	.string	""
+	.string	"sbufReadU32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\002"
+	.string	""
+	.string	"sbufReadU16"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\003"
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\003"
+	.string	""
+	.string	"sbufWriteData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\003"
+	.string	""
+	.string	"crc8_dvb_s2_sbuf_append"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\003"
+	.string	""
+	.string	"sbufSwitchToReader"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\003"
+	.string	""
+	.string	"sbufPtr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\003"
+	.string	""
+	.string	"closeSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\003"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\003"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.64e556e5ab5272a4,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,866 @@
+	.file	"rcdevice_cam.c"
+	.section	.gnu.lto_.profile.30a2869e3f6d39f4,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.30a2869e3f6d39f4,"e",@progbits
+	.string	"(\265/\375`\215"
+	.string	"M\007"
+	.string	"\224\t\201\001"
+	.string	"\025"
+	.string	"\340\343\300\317\r\006\002"
+	.string	"\002"
+	.string	"\002\001\002\002\002\003\002\002\001\213\326\277\344\004\002\234\275\254\370\005\n\002\004\002\004\005\002\005\003\240\342\234\212\n\004\312\250\370\035\n\006"
+	.string	"\002"
+	.string	"\005\343\233\320\335\b\006\241\207\266\226\013\002\002\005\002\007\007\b\327\333\310\237\f"
+	.string	"\t\343\327\321\231\003\002\n\364\371\324\b\t\002\t\013\352\263\360\321\b\f\r\266\312\226\036\006\t\002\t\017\306\276\231\230\017\024\005\002\007\020\255\272\247\234\001>\n\002\013\003\021\023\205\217\226\276\r"
+	.string	"\024\025\026\240\342\234\212\n"
+	.string	"\" P\202b\350\310\0031\021\0139n\262\345'\301\374\306\006\300\370\340\354\241\026\226\273"
+	.ascii	"\240\205}A~\032+<=~-\263\202\231\024j\257\340\302\260\224\201"
+	.ascii	"\036\255\304\002+/`F\260M\245h\374\213\333\234\360\272\204\315"
+	.ascii	"`\240\340\355i`\b"
+	.text
+	.section	.gnu.lto_.ipa_sra.30a2869e3f6d39f4,"e",@progbits
+	.string	"(\265/\375 y\235\002"
+	.string	"\004\003m"
+	.string	"\013"
+	.string	""
+	.string	"\003\002"
+	.string	"\003"
+	.string	"\002"
+	.string	"\001\004\001\003"
+	.string	"\002\002\002"
+	.string	""
+	.string	"\006"
+	.string	"\003\b\t"
+	.string	""
+	.string	"\n\r\017"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\020\001\001"
+	.string	"\023\001\001\001"
+	.string	"\001"
+	.string	"\016"
+	.string	"6\005\277\002\376B\341\253\202\344\356\200qUfP\342\356\214\322\031\0073\302J\0209\303\337"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.30a2869e3f6d39f4,"e",@progbits
+	.string	"(\265/\375`\353\001\275\f"
+	.string	"\366\221A?0\307(\215\001\005~\267\375;\277\244x\331\247\214\022\261\340\351\253n\344\357f\023\217)g\325\311BW\024\004\024\314\254\216\366\355\317\3004\210\300\t)\006\020\001t\002n\267-\233\355\222\261\267\334)0"
+	.string	"-"
+	.string	"-"
+	.string	"(\f\n8x8\376\3731}\257q\233\bRU+$\301\324n\001I\013\347\351\372\321\335\335\353E\252\240+\221 \364\237\b\212t%\222\303c\253\201\0206\271g\317\0044Qu)=\356 \206\321\365\036\273\273=\346\237\372\002\274\251\033\24775\343\227\230\253\343O\320\370\337\023]S9\226\001\334\007\202\214\240L\330\031\013\rA\3142\265\273S?\260\273\231\257,\273\263\306E\251qo\317O\370\037e\224q\217\222\"\236\235U\350*B\377k\336\313Z\b\351\203\224\222\325C"
+	.ascii	"\300\245\201\312\333;\230j\336o\302\013\035pj\t\220\300\200$"
+	.ascii	"\026\323J\304\234\r\276\240>X\r\333\311\210\200\302\033\211\255"
+	.ascii	"Y\013A\25019Dd\346jQA!\313\001p\"2H\347\001\020@\250dHRP,\006"
+	.ascii	"\n\200I\017\f\016\004-^\353\"\222n\036\233\216.\201@J#,z\324"
+	.ascii	"\370\372E3\265\007\302\264f\364`\340\271\365\246e\361\222\305"
+	.ascii	"\230\2377\2459{\340\336Q\333\021x\217a\2220\256u\354\312\372"
+	.ascii	"\221L\231X\317\247<ha\017uMWKj\360\214u\016\310\214\236\362\347"
+	.ascii	"I\023\3156\244\026\245;\n\236i\222\221\267|\372\236\255\033;"
+	.ascii	"\235\207\363\245\035\036"
+	.text
+	.section	.gnu.lto_.jmpfuncs.30a2869e3f6d39f4,"e",@progbits
+	.string	"(\265/\375`k"
+	.string	"\255\005"
+	.string	"\362I\035$\220'I\007\377\377\377\240\277\273\273O\306\335\377\333\257\376\271\177U\212(e\377\255-\373\377\277\265mI\223)\005*\"\245\224>\315Yb\357\0134IV@^j$1}\002\203\227:^j\037\274\225z\341} \016\252\001\002(B\b\3150\321R(4\254\224+\265\221\317\006\306\034\177\\,F\250\215\271Q\337\250}B\355a\2572;\215\237f=:U\300\031\001\031"
+	.string	"8\001x\350\334\377\032\363\021\367x\361\300\025\201\032A\b\256\001\306\030\n\013\241\302\234\n\370a\206 \r\324\b2\200\034\034\333\204\3660\265\2109.\202\357\204\212\313\347]\3474\256"
+	.ascii	"C"
+	.text
+	.section	.gnu.lto_.pureconst.30a2869e3f6d39f4,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\""
+	.string	""
+	.string	""
+	.string	"\013"
+	.ascii	"\205\004\002\230\004\004\230\004\006\270\004\b\230\004\t\230"
+	.ascii	"\004\n\230\004\r\230\004\017\271\004\020\231\004\023\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.30a2869e3f6d39f4,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"\325\003"
+	.string	"\242\304\r\027\300g8\377?\364\377\377\377\3773_jB\256\020\002\"\262\264\355$S\"f\352\035;g\372\030\026\353\271^\267\274A\025\202\025\004$\317\355\220\235z\323\356\347/a\023\034"
+	.ascii	"\n#D3\006\260\272\272\207\360\355\003e\214\300\026\350P\202\341"
+	.ascii	"!P\304mC(-Dv1P\002\312J\036N\002\b\370T20\003\026\353\271\362"
+	.ascii	"3\300.PPt)\301\202\270 \264\r\264\001"
+	.text
+	.section	.gnu.lto_.lto.30a2869e3f6d39f4,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_camDevice.33.30a2869e3f6d39f4,"e",@progbits
+	.string	"(\265/\375 D!\002"
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001\202\200\200\374\342\303\254=\177}"
+	.string	""
+	.string	"\013/root/repo"
+	.string	"\035./src/main/io/rcdevice_cam.c"
+	.text
+	.section	.gnu.lto_rcdeviceIsCameraControlEnabled.37.30a2869e3f6d39f4,"e",@progbits
+	.string	"(\265/\375`\026\004m\027"
+	.string	"\326\252\223G\300\026U:$:B{|\325\246\260\351/w\323\210\351fDgzET"
+	.string	"\261\306%\345\330\027^\375j\223\b\253\307\274K\002V\371\314\b\272\256\242(J\266\343\030\262\265\204\030\ni\343\314\265|{~\220F6\2212\245\210"
+	.string	"s"
+	.string	"\201"
+	.string	"\026\275\200A\b\313>\2760\341\300Im\307\2249G\326\272\270\354'SI$\215B\021(\277U\231\377\362\323Y\304\354n\372V3@\200\356\003\263\373\022"
+	.ascii	"\325\320\335F\205\226R\\L\261\203BI\272\217"
+	.string	"t:'@\003fF\303\024\213\230\334E\367\201\311\341\324\024\274\rw\342\222\3048B\277\0016~\202|\340d\276\337\201]\021\231\023N\304\307r\244\205\320y\327\033\216\246*\2020\347\264\332p17\352\266\251\330F`o\222.\340ei\317\273j\310\212\335Mn\246C\366H\323\255\261\377\315\245\261\245z%\325*\251NI\365\212T\243\254>I\265\351S\227\254\026\255&Y=\262:\264\032\264ZZ\375Y\275V\353\252\017\240\365\002\305g\312\006\215\323\304P\225iD\n\231a\373;?Rt\232<\301\371!46Q\362\233\363@<\207\277(Hv9\346\234\342\245\r\302\026/\245\035\302\001;\237+\322H\204\003\276w\222j\257\343Q\025\212\344\205\374\343\367\336\305\324\036\347/\241{\211\362\363\245@\2714~\260\204\247g\177\031x\336\277\033B<=\352\313\300\323\336z\276\262\037\377\351\312\2675\227a\333\031Y\033"
+	.string	"Q\241O\016\023\021J\305\277\001\320\264\250\265\326r4\035\362y\276\360 \257"
+	.string	"<c8\220\026\226\027s\316\006?,\300\374\030\036\300K\323\006\200\301;\217\367\360\340\307\360\006\027\275-n)h\231\320\222\340j\275:\270*\264b,\330\213\225\3415\241\205\325\212\271\260\024\b0L\203+\306\342"
+	.string	"\203\305X\3428\3737\227\306Zz\357\267y\204\237\033O\217I.\b\256!\314\226vr\270\337\312\321\356~\244\325\335}\315\247\025W\013\340\320\221\023\304#C\323\241+P\215\231\236ik\304\035\322{\017\367\346\017\340\227B\216]'\362\241A8\347\374\336\346\252!Uv7\274YI\034\351\204\357}\264\332\007Y\250!P\345\224r\244$\230\t\212Z\230t\020\003\221\231\342\006\020H\307f\250\340n\037\302\3005}\274\307\324\243\016\232\036\224z\336\201\217\"\314\366XT\307\332K\"=\206\266\254\256\367\024E\204\024\002\024S\324"
+	.string	"9\031R\\\331$\330\276\235\315]\254\233\n\215\301e/\203-\244\203\360F\2073\244\267\261Fg4X\204B\355z7c\266\247)\275[\343\013\022\361\335\231\270\377\335\212\373\363\275\316R\260R"
+	.ascii	"\364\\$\330\033\232@8\231\006\210\226\355\t@\224!\373\345\207"
+	.ascii	"\220<o\250\001"
+	.text
+	.section	.gnu.lto_rcdeviceIsEnabled.38.30a2869e3f6d39f4,"e",@progbits
+	.string	"(\265/\375 \366\335\006"
+	.string	"\002M04Po\322\001 n\203\323\t\316[{\370\312\022\024\302\205\242\335<\355\t\310'(\317\n\003/\313\222I\254!\252\252a\212\261-\376\262\b\fl\355\335\266\224)\005\206\032\316\006.Hp\222\220\030 \365\342\364\032\246\r\347A\352\341i\002\034\035$\352A\304H\275\f\266WQS\001\013\275\354W\270kS\247\342A\2712\263\313\357>\302\331\023\024\371\3175\201\343B-\033\263R=\354\267U\221\355t\313\364/\007\031#\026\200l\027\224\265l\312\345$\304v\307\316\330"
+	.string	"\241\343\352\030\b\350\035\030\036\222\321.\366\364\343\325\263\362/\362\202\021\223k\245$d=1\n\273\353\374\2044n\275\355\001\333\004\2667\002\b"
+	.ascii	"2\001\0078#f\034\240k8\312\210\307\204 \341\316\275\332\371\004"
+	.text
+	.section	.gnu.lto_reInitializeDevice.40.30a2869e3f6d39f4,"e",@progbits
+	.string	"(\265/\375`\316\001u\021"
+	.string	"\326\241vF\340\360&\035X\0035I\004p1@\022\376R\231\t \227aI\030\241\2309\263\300zW\237x\250;W\350\367\275,D\024\327\312\221\227\316\261\2304c\034!C\363\324\220\273\321p\005\371\030+?;\t\331{K\231Rc"
+	.string	"\\"
+	.string	"f"
+	.ascii	"\360\002\344\343\355\026\273\303\006\016\264\330\365\317\003"
+	.ascii	"\215\346\355\304\224\3001\347\307m\207\273\256\311\bW]\276\206"
+	.ascii	"\232s\232b\257k\362\324\021\203\321\bGh\b"
+	.string	"\335\370w\265\020\363 \b\r\017\254\202\302M\303\027\216\334\254\310p\212\275@\220#\034\245\367\\eb\236\252\206\232sZa\261\013\367v\333\024l#\2605@\321g-\317\214\322\315O\215\213\316\354\357\245\253c\177g\263\331\314\233c\037\350\366\210j\223\325\233\246\226\232:J5\264z\243\372\247\017%Y\322\020\316\316&}\223f\226c\032\305!\020\007:\324\325\265o\337\307\377\376s\021-\007b\021y\371f\314d\303\347C\340\321\005\266G\221\203\310\307rOA\030\214\274}yk\234E\306\365X-\202\2719q\024,+*\225|\214\373\357$B1Bx\306\210\026H\221\344p\027\310X\370A7\341\"\t&2\221|\204[2\223C\205l\034q\200\253\363UaSd\263\253\343\020i\332\367|{!\223\361\242K\376C\344\327\264\326\230\032\357$.s\340\357x\305\322\303\036\335Je\262\322R\351\024\250L\350R"
+	.string	"8U\262BI\235t)U\204\216A\252\305\261T\\\212\ne\305\245Z\020\270\222\020\263\036t-N\205\305jq\035\337\374\346\330P&\200\341\023\224b}\227\334V\306\366\266F\271\254\007\347\234S\373P\373\004E\017[\224\267\257\001H\037\220\244\307\312m\311\\\274\350\222Ojw\r\364\260\037"
+	.string	"a\b\030\2521\261\272VT+D\005U-\310\031W\017\215\\R6\271\210\200\031\221\177\021\245H\221\006\0133g\330aFFi0>\023\020\2617\256\322\b#\013\301d\205\277\\\306\211U\202\2552L\\\323Y\251\324lWN\327"
+	.ascii	"\0364\006\005\005"
+	.text
+	.section	.gnu.lto_rcdeviceCameraControlProcess.41.30a2869e3f6d39f4,"e",@progbits
+	.string	"(\265/\375`0\007\245&"
+	.string	"ZC\270\016EphQ:#\235\207Dyth\032\204\027l\360U\321!\020Lm\304\214\340\n\310\300\375\022\f\323\232\351t\304\320\231%\027\246\304f\t"
+	.string	"\024\246\246xQ\332t\217^"
+	.string	"zx\016p\217\370\243F\b!d\313$\003\333"
+	.string	"\306"
+	.string	"\330"
+	.string	"Xs(\254\367\302\317:\230\207\231:\322\307\372\023\256]I9d\367\"#\034e\t\353\321\334\223\322\243\347\221\322\243\314?\230kGm\215\247\230\307\216\234rU,8VZe\367^\235\225\302G=\365\333\221\315\b@\255\210\266\252)z\332\236\342\253M]\336\3046\311f\327\360\367\333y\233rV"
+	.string	"\366Q\024\242\223\333\324&#\265\t"
+	.string	"WmYtB0\3061r\246\320x&\325\301\342s\257/\320\"d\322\264%J\322\333\2250Iz[p%4\236k\021V\331\237+\242\361\352\231\302\242U\247H\216\236\020\310\276\b\325\206A\316\244\"W\202W\276\211\f\253\372d\n\233\234\2711o!C\252\266\317:\204&b^\n]\021\235\274\325\246{/wpH<\0078\363U0s\007\346tH\326^\371\037\261J\023\006\264\277#\357\275\247=rT\332\326\227\324C\325\206\270\3264\313L\243F?\330\326\246\374\n\243\262?~\330\245\322[\233m\257 F`\2371\315\336~\314\037\f\375"
+	.ascii	"\233J3 }f\357\275?k\217\314H`\377Z(\314\337:/\255\315Jk3nmN\260"
+	.ascii	"6#P\233\017\254\315\006\324\346\002\004\326f$\265Y\300\223g\333"
+	.ascii	"\221gZ\332\274\252\315j\332\234\242\315h\332|\242\315\026m\356"
+	.ascii	"\263\371\nR\220\225\375Qj\336[\344\f\321\rC\321`\371\326\237"
+	.ascii	"\374\221\267\314\367\372Yq\251\005v\357\375\227s\3758\031\356"
+	.ascii	"2\305{oM\213\257\334Zb\035\322 \206?\306\302\205\251'\245\326"
+	.ascii	"\233E\355\nN\367c\302@\237\002\366\313\377\b\0259EL\251\322\312"
+	.ascii	"\3543\245HV\311r[\025\201^\f\342yB\340\274\330\351b\"\222\232"
+	.ascii	"-H\360\255\340H\217\"Y\034\0250|;\277\203\203o\205K\234\350\007"
+	.ascii	"O\244G\005\330{]@\232'\306/\305\27797\375:Q\316\310\027.\264"
+	.ascii	":|&\217\265\022\214\301\034>\035\036k\255\342\0028\3748<v3\260"
+	.ascii	"\334}\244G\335\260\231\342\275\277\033;x\037\034\245Y\233\262"
+	.ascii	"PXU\233\335\257A\314\3654^{u\025eF\3616Q\023\246\334{10\363\216"
+	.ascii	"\263I\261$v\357\315\240\346kV\360\255\034e\026.\372A\027\351"
+	.ascii	"Q\324\322\300\330\354i\277\305xf\225\006h\346\027O\375 \017P"
+	.ascii	"\256\331p%hD\177\346\326\376\312\326\314<\031\375`>\250\336\216"
+	.ascii	"\247\031<\030k\017^\f\033N"
+	.string	"3v:z<r\324z\347\035\205\032O\273\027\274]o\007/\306\316\247\203\352\351l\364\236j\350v\276\034:\nJ\fu\203\347\323\351\200\202\362\351jH \357\362\017k\310\n\221\001\261\300\233=\262Q\227\215\200E\253\364\341\234f\2054h-?\217\354\221}\2444K\300>\353\023\262\306\222\315-#\020\254m\366\310\214\242\203D1\331\350\252\024\270\246\272 &he\2621\262G>\261U\364K\245(\220\324\272,\214\031\215/\225.Y!Q\251Y\"DF\200\324\224\t\312ujU\313\314\301C\256\312\376\n\251\226V\\\262\251\003\242\032`S\211\247\371\005 \201=\327y\246\024\201M\300\305 N\210\213\235>h\004\202@\007\354\271\302j\366\270\3478\373\345\317\224\032\260\270%\2038\331\222\003\200\220\250a0\305\224C\312\220\210\214\214$-\f\007\260\002\031*\342<\021P-5U\026JZ\331;\002\2579Q"
+	.string	"r\255\322:9\240\033\002\200LvXly\312IR\267\376I\332\017\022\241\376\253&\344\204\233\341\340\035Q!\311\245\357\242N\316\370R\340 \263\216\242\276\020\252\357\2252\251C\256\t;%\222\246\314ndl<Z\270-\001l \312X\215&\372\255@\307S\302`\005\001\240\200\004\033\212\211\347\t\332,g\233Ux\n\001\321 \365(\r\243\276T\345\212-o\324\372\240\253=i\367\036\315\275\337~\304\271\002\221`\24550\271A\302\324?qVGZ|\324\244\224,\036)\271H\030\306\350\271\300jq\370\372\214\367\b\207U\005e\356\231\336Z\204\377Q=\373\0175\3452[\323)\b8o\36521$\206\nW\246\333ni\301/\352!\342\353\fC\325\304\357\207\373"
+	.ascii	"\266G\273\t:\344\364~\227\236\206\367\212^\240\027\220O\n\337"
+	.ascii	"\002?\345P'c4\305\215;\234\234\021I\325\020\362\027\262\376"
+	.text
+	.section	.gnu.lto_rcdeviceSend5KeyOSDCableSimualtionEvent.43.30a2869e3f6d39f4,"e",@progbits
+	.string	"(\265/\375`2\004\005\034"
+	.string	"\326\363\263H\240\230Q:\302\3475\2175wc\033\26472\0378;\216\240W[\355\002\003%^\201\022y`\340\225\224\375Q\016Lp\3627\264%F\035\236G\327\225|;@\203nD\033x\306\324R\271\002?\370\331\366\244\221M\344N)\241"
+	.string	"\231"
+	.string	"\235"
+	.string	"\3656\220\377\344\230_\356h\274\222,\202\340\303\004.x\365\203\221R\373\300\027\001\272\223\213P"
+	.string	"\351\273\301\004\205$\313\006f0\276\322\216#\276\206\237\211\257\266\r!\002\220w/u\024\271\204\302\020\035\321\"\311\262\2669\276\373kt\2115\\\272\3637\252J\324\225\022#\336_\256\035A\306?=\024\322d\002\203.\261\200\215\030H\257\241\0023\212\231"
+	.ascii	"F\275\020\247\310\307\357O\247/\214\204hH\221\276\267\001\343"
+	.ascii	"\3107D$\002\260\0322\003f\324\253\324\245C\222\244\351\317(\306"
+	.ascii	"\r\273m\036\266+\330\341\204\273\344O\361\251\214MQ|*W\t$\342"
+	.ascii	"\304\177b\254Q\0347\220?\264\200D\310\032J\276\344L\214\265L"
+	.ascii	"\216^\357B|=\022\333X9:\224\222H\222w%c\321\037\231\340\265\356"
+	.ascii	"M\0263h\016\3214v\331\243\273d\177\317\363\034\343\305\341\233"
+	.ascii	"J=\033\251m\\\32452\330x\247\277\212\324\341\313{+5\255\324\037"
+	.ascii	"\220S\245\224\264$f\257J\262\350DCVU\252\037/\177\373\376\221"
+	.ascii	"K\3311\377\034\312\r\222\262\224\200$I\306~|#\216\275\376<\252"
+	.ascii	"\005\205\036V(\214\017\347\362.\031\3023\275Z\003\007\221\203"
+	.ascii	"\370Z\263\247\2529\317\363<\002\261n\270\242R/\311\255\343\032"
+	.ascii	"@\355\017 \350\177\262\335&\247K\316*qFq\036B\264E\214\240\377"
+	.ascii	"\271g"
+	.string	"K\0314\377\235\350cy\226\335\216\315&\276\272\240\266\264\262\202\350Y\240\013\020\030u'\302\226\200\f0Q_|\364\214e\364k\227\300\321\377`K\363-\317~\225[\361\361\231l\202\207\376\367\352\363\210\257\337J\205&x\024DO\037\312\267\220Z&\217n\331j\bR\223p\227\246n\035\036\335\362\377\036\274\336o\003(r\270\236\035\335-E\356\325s\302g\305\255\203\212\233\356\325\342fbms\300\263c\033q\263\341X\334H\330t\265\034\256\206\002\267\303S\263\351V\324\034\3448\227\342\246\253\365\344r\272Z\254\fz\370\305\3413\225q\332_\271\317\3208\036\240A4\345\272Y\207\242lcKA\242'\365Z\276\373\302\366\356\237>\232e\314\240\031\264=['|\311(]\333\302\2704\037\030\272U\312\224\246#)\377\323=\2201\203\346H\200\332\354l}\251\013\030\350\1777K\023\3622\333\327\321\332\354\245n"
+	.string	"*+\352j*\r\213[\345X\202\003N\250a4\203\234A\b\031\nHhDJ\222\342p\002\0312\354\006\021`I\222h\024\306\306\003\304@D\364\324\220\240\230R\231K9\024\357\tw6\033\204\022lX0,0\b\367\2061:`\312\321 %\355@\314\215\030\226:\242dD\323\215\257\312Lt\314]3\212I\231\304;#\306\361\301\344\353@\342^\311\314\246Apc\313'3_j\f\177\237\322\016t\253k\030\005%@@0\314<"
+	.ascii	"\222HC\267;\300\017v\003\212G\370\017 ~\307G\306\2411\232\031"
+	.ascii	"}\034\255\304;<\326a0\200\237\234\006#;\277YX\270\003NtOH\003"
+	.text
+	.section	.gnu.lto_rcdevice5KeySimulationProcess.44.30a2869e3f6d39f4,"e",@progbits
+	.string	"(\265/\375`\204\017\275B"
+	.string	"jo\264\030C@\236R\007\353\237L8\307\263\363\304\201\020\266%\236\3274^\267]?FY\253\332\347~\374\242_b\032\004~hq\321\016\220\002\340\332\340J\210\324t\301\374\236\006g\301h\343\252\264F\366n\262\367\226I\246}\001N\001\202\0013\216D<\363\030\327\357\210\276j\355\256\371\252\354\251Q\335`\265\236\273\321]\350<\357P&GO\321x\356-\264\024\3378\252nT\353<\317-\334]\270\033\265\373\372\316\215\356~\365\202\277\244\260\026!^\334\314\363uJ\273\216"
+	.string	"\326\357\256\255\272.\252\355^x<\317mk\262\314\363\265\312\251`\355>5\363\325n\253\227\257v=\352n\250\257C\346\242\220'cx\207\363<C\267\020\035\325RQPONMLKJIO\244#g\323\250\210hH(\210\t\264\374\361\351Q&\221G\243\034\303\305\327m\367G]\313\323/-\025\005\365\305\313?\001\352ay'@\274+\337\004\310d\245\357\227\224\252|\322\336?\251<\322\221\335;\353\276\th}#(EO\210\350\206\234\bE9\362A\200|\3174\362@E~\031G\344\177\342\340\336\307\016\215\225\256'IY\\\320f6D'\327\356\250\217\324|>\376\330.\323\254\fR\r\316\361\320{:IN\332\343\215rk<3\034\324\202R\036\355\2005S\036ZN\252\366q\332\303ZN\212\366E-(\035\322>\347y6N\307\376\325\202\3227\031\357\006\260\242\261f\333\314"
+	.string	"u\333JQ\303\344HNc\264L2@\326\030\247b\277[$\267\265lr\032\326>\301\214\031\323w\372kL\305\376\213\013\346y\366'\233\232i\237\322\356\333\202\273'p?\262\t`\237\370E\207\251"
+	.string	"\317\363l\3005\240\006s\301u\021\355:\206\f\031^\355\276\366\277W\273\356v\261l\262~\006r0\211\363r\275\355\026\341\372Os\341\332\300\201\303\336gl\350\252;\234\200\271\017\230F/\261\205z\367\376 O\r\365\376\336\273xf\371\356\036>\274&\373\255\323\330\302\366\227\326v~$R\331\356|\013l}\247aAl\241\330\333q\255\235\257\336\005\266\377\030Z\330'\272\353>}\005\204\353\"\036\"\3535Y\326\253]\275\343\250H\250uh`\237\350~\r\323\355<\317\363\357\252\273n\347y\236}\273\271\353\253\366\b\310w,\344;\204\343\373\225\361\375\001\362\335\001\362\275\301\361]\201\361\375\200\373^"
+	.ascii	"~\207\302\357V\307\367*\343;U\374>%\277K\311\357Q\361;\224\374"
+	.ascii	"\376$\277;\305\357M\361;\223\374\276$\277+\311\357I\362\3733"
+	.ascii	"~G\212\337\217\340w'\374\336\214\337\215\344\367\"\371\235(~"
+	.ascii	"\037\222\337\205\344\367\240\370\235)\277\003\311\357\313\370"
+	.ascii	"\375\007~\367\201\337{\216\357J\343{R~G\312\357\307\370\335("
+	.ascii	"\277\313\362{\034\277\303\362{Q~\177\343w\027~o\213\357\373}"
+	.ascii	"\177\367]Kh2C\355!\004\312&\274\006\315\255\333\236\254\271\335"
+	.ascii	"3<th/\032)\r\346\256:\334DWx\215v\220\334\217\275\f\243\375m"
+	.ascii	"\336\374\220Y\330\314\200\212\266\022\216h\027\rm\242\035\025"
+	.ascii	"X\365b\0376\2645\242\021\333\325m)\264\217pA[\210\271\203\266"
+	.ascii	"\321\177\375\314\334\372\212&p7S\371\001\332]\313\r\364\263\227"
+	.ascii	"\273\235c\245\021\363\374l\2525+\265\316\217\r\330\227\324\247"
+	.ascii	"\347\016W\364\b\20557\252U\271\253\331\370\254\315\241\034'\323"
+	.ascii	"\207'\351\263\265\034\266\360\351a\355\365\272G\347\242K^\223"
+	.ascii	"\371\304J\356\214\311\272\021\333_\216U;D>\275\016\266\346\203"
+	.ascii	"\365\323\333`;h\242\343D\351\232|\036\205\242\341D\353\230C\264"
+	.ascii	"\333`k>\275\304\262Q\353\354Z;\035t\216\273\252F+\320{~\245\335"
+	.ascii	"D\313\260\\\201\341\201\255\367\364\303\225\311\331\257\222\265"
+	.ascii	"7\343\256v\321=\373\021\337\235\201\203\327d=\033\311\226E\022"
+	.ascii	"\266\277\276\007\2262yW]\223x\225[\267\371\225.$A\300u\032\021"
+	.ascii	"X\272\310\326\253]\345\216\355\300\0065\341\226\204\t\023^\355"
+	.ascii	"&wq\316\220\016\255\b\226g\030#w\262\360\270\221\306}\334P\177"
+	.ascii	"T\332L\031\343\326t>\031\303F \274\253b\264\274\267 60P\307["
+	.ascii	"\206w\274\213\2524\2311\360\326xo\272I\246FW\334U\1778]\342-"
+	.ascii	"\356.l\340\236C\247K\274\357.n-\203\352\356w\267}c\210\001.\264"
+	.ascii	"J\354\024\033\264LliPqB\253\253kE\026\322\263\254L\204\310\002"
+	.ascii	"\241\225\265\305BkDV\027\224k\013zb+\204\thVW\n\250\225\323\271"
+	.ascii	"PhuAUpquA\215W0\335\316\333\315\027\200\3550)'\021\252J\250\326"
+	.ascii	"\250]\325\\\357\222\342\226?\367\260\313\032\024t\353\266\b\033"
+	.ascii	"Z\325\301f|\023\027\345iW\347h\254\255\365\344h\b\033\253\311"
+	.ascii	"\313\351y\024\312'\201\260\265\236\222\035+Q\234\256\360\374"
+	.ascii	"\352\217\300\240s\365F\036l\215\007\340\320m\332d\265\337\320"
+	.ascii	"j\177V\2074\353&\236\202G\310\264\253\256\2472\206\366Y\020\245"
+	.ascii	"\242\366z\243\203B?x\244\247yE\356\231i\034Q\253\275^\255$\221"
+	.ascii	"\312|\265\327\033a\327\250\332]\017$\bV\325\377\240\332\256\234"
+	.ascii	"-Y\002\200zbKS;\b\016V\314\032uj\177\035%\251\255,\214\332RP"
+	.ascii	";jK\365P\203\332\237\227\364\264\217\205N\373\251i;\355f\032"
+	.ascii	"Z"
+	.string	"\323\326\\\336\374\236Tn\204HL[(\016+f\207\016\246\375\210iv\366hi\003)\355%\244\255\264\247\376\306\020\235I\033\031\344\271\223\216\366s;\373\306\020\265\2259\301&\323\222\215F8\305\bi3\031y\223`\231Qt\246\2176S\365X\206:%\332UW\316\272\302\213\264\265!V\214\330\3331\233\"\355x.1\353Dy\326\266\241\031\372hk\034\177\343h\027\261\210Y?\001e\207X!g\231s\273g\210th\203io\306\202\002\2019\250\2010E\031d3\"\005)HR\032\306\001\006\204 \245\352\314\003\021\340$3\024J\031QZ\f2\210\300\207\225^o\253\016~\373Z\320\216\366|R\254\034\321\347hY\246\003\316\032\351\346\204\026-\213\306'\316Ft\244\260\025\203w\2207\340(mh;\013\351\221\225VcB\253\350ee<\003\261\021F\020\324\270\245\252KP\363\242\034h\277\033\250\346\202"
+	.string	"^QP\233e\2474\317\254u\213J\262(/\024F\250\260C\276:\223!\212rB\352\256\252\3722\365\344k\\u\005\363\356>\270\240_=_\013\244\237\333-\203G\276\312\365\341<\314\004\315\210\240~B\204!\207\303\324Y\301^\223\317\254 \322\250\350M\370\361\016\321I`\260\240\240\321\354\017\242`DO\205\240~{6P\257\342`"
+	.ascii	"\331\344\310UQ\330\266\031\325\302\312\275\200\304bh\213\030"
+	.ascii	"\262Q`u\323\377\035j\013kd\200;\276\377&\363~\364\021lX/\351"
+	.ascii	"\365\212\306\304zQsmFgRr\301n\300\347~\202\324I\003\312f*\250"
+	.ascii	"\267\331#`A\\\342\"OF%\2477pd\273#\t\355\\\202\243\226\305\025"
+	.ascii	"H\211\002a\233\024C\205\220\221lq\276a\350Hk\310y\006~\036\034"
+	.ascii	"$~\005o\225\335<cA\365\201bq\374G\206\006\334K$?-\222\210FW@"
+	.ascii	"30d\234\300k)j\240\314O=\226\241\016q\266\231\310Y\373=\361\244"
+	.ascii	"X(\211\307\005\027%\027_\242hsz\230\344"
+	.string	"\036\213F\303\351\230%1\313\351\323q\037\312%\204\t O\006\224\"7\244\004\031Mm\005\347\335E\017\221\3645\224\r\346\032n_\016>\334\315\237\240\246\374\033\2230\023_\035\300F\232\272\222\001\271w\b\177\003\033\001$tZ[\331\327\007\3263T%'+\366Q\370\017%\377\247|\324\217#Pr\205\345d\305\371\203\3049\227\200"
+	.ascii	"J&\202\001\322\006\315\035+#^\232\344P\004\205dt\031\251^\375"
+	.ascii	"\001\370\205\276_\270\207 ,\262A$\035\243\rQ\r"
+	.text
+	.section	.gnu.lto_rcdeviceUpdate.45.30a2869e3f6d39f4,"e",@progbits
+	.string	"(\265/\375`%"
+	.string	"\335\007"
+	.string	"\262\01786Pm\323\001\203\213d\224*\304\034\205E\211m`I\032_\327\340\205w\304\217\206\360\250\377O\230\314Ed\035\255\031\222 2\260v\276U\334\265\345\246\237\267\326\344N)\232\203\205]\r\236\2165\347G\006Xn0\216|\260\344%aA\310\031\263+v.\016\026\345\324\342\206\300Y\2045\243'\313f\314x{jUd\206\323g\241 _\240\252\255}4\246\357B9S\320\236\240\200\357\fK*\037H9\333\343\240r\330\247vw\255\"\373\244_+\315\212\311\302\311n\306\311\264_U\372\310\330>\264\037\362\321vR\2051\273\033\244\222]\017\301\007"
+	.string	"\257\n>`yE]\300\362\312\233\215r\317cO\002\2021\222\262\273Q;\276\035n\376E\216\351B\334\341Eaw\r\273\220\306\255\267m`;\301\366(\t"
+	.string	"2\241\203/0\\,h\006W0\357\022"
+	.ascii	"\261\232\002\356\362\242\235d"
+	.text
+	.section	.gnu.lto_rcdeviceInit.46.30a2869e3f6d39f4,"e",@progbits
+	.string	"(\265/\375`\317"
+	.string	"\r\f"
+	.string	"\266\327TC\020q\233\016\030\243j\346I\034F\352\020\fA\260\241\373\t\215\360\240C\365\007m\257"
+	.string	"h%w`\215\210Rs\003\367;\003\225k1w\023"
+	.string	"T\303\245A\225O\232\363B\n\fv\005\340\304P\333[\312\224\002C"
+	.string	"A"
+	.string	">"
+	.string	"\323C6e\004\tB\336>I\200\\\004\345\343\244$\345\264v\304\246\333\341\352\346\003\370\270CK\310\027\022\020\275\b\241>\017x\211\001\242\306G\256\032\276N\225##\245\264z\337\206;\336\266\002\333\007\354k\002\177\212\322\007\f\336\020\266\325\361\244\033Z\275V\353\252O\r(\211<\210\260X\031S\202\254\334\2200b\013\023'\335>\211?_r\024\241\223@U7\345\247I\231$\005\036m\300\362X\3752=\302\007\b\224\332\020:zow\227\273\224R\356\216\274M\272\016Lhtj\303\026\375\332\023<zO\267\352\226\263\257\342&\027\374\022\256\360\321{\217\376gz\374v\020qBT\302\241CW\354\311\351\216\354\330}a:\233\253\001\347\302,p\036\\\232\225aV\004l\323\261.\315ca\0048\223\300\321,\nY\246Y\324\224\207\273\373\221/\230\221\262BE\177\362\350\270\316t\254\007\334\221?\317"
+	.string	"\305\305\207\212V\007Mp3\330\001\020"
+	.ascii	"m\b\b\303\376L\200\245!\026aK\264h\321<\206{\327\330\277.\003"
+	.ascii	"u\301\304*W\253\026\314`\031\270\366Z\204\2461(("
+	.text
+	.section	.gnu.lto_CSWTCH.24.68.30a2869e3f6d39f4,"e",@progbits
+	.string	"(\265/\375 cU\002"
+	.string	"T\003V"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\005\005\001\006\177\001\004\003\003\004\002\002\001\001"
+	.string	"?\202\210\200(}\304\001\303\001\302\001\301\001\300\001\277\001\276\001\275\001\274\001\273\001"
+	.string	"\t"
+	.ascii	"@\004\334\201\306\200\b\270\003\215\001\021/7\r\240\b"
+	.text
+	.section	.gnu.lto_rcdeviceSend5KeyOSDCableSimualtionEvent.part.0.69.30a2869e3f6d39f4,"e",@progbits
+	.string	"(\265/\375` \003\325\026"
+	.string	"\326g\215I\3200\2511X\252\372\342)\301k\230o\365q\263\265\317Y\324\327R\356\002\223\262(D\334\273>F\371=\312\377\264\f0\033\226\321\307\200<v\356\030\254\276\005ZU$K&\345\344l\303\336#\302\242\363F\216M\366\336R\246\024v"
+	.string	"z"
+	.string	"u"
+	.ascii	"\027Y70^\f\3771\326\374!w\\\364M\330X7"
+	.string	"\364\326\214\b\005y \027\335\200\274\370\022\036!\241\331\330\366\bI\315\266\243@5+\031\0313?\251{\321\326E\373s\333\305\320\326\321\346\333\036\323\355\342\177Ops\324\203J\322\201xXs\272\017\267\241\003\031\251\034\001:\\\350A5\363\364\364\225F\027S+\201\217+\223{\257\311\020\367\352\2663\330\256`\333\224\276\273\216\325\367X\260\033\240soM\225\215\273#.\215\270\357\007~\311\202\216\220\023owq(\b\204 $\336\223\376\236\257\342F~\nT\232\331F\351d\207\246\023\310\023\331G\361$?\005\222\354F\016\311\211\322\341\335{;d>\222\354G\263\222\240\246\022\362b\365\211h\276\357?w\f\365h/zaq\334\313\223\223\332j\037\375\211\332\213^B\364\352\306&!\247\220\213~@\006\256\327k\274\270\352\375\244\242\354\r\225\016\355X\353c\1776Z{\366b\340*\225\017\274\265\253\230\037\t\234"
+	.string	"\365+\236j s\2676L\245>W-K\306\336\3543\275\311\305\027\341\025\263>g\216\027oE\026\276)\234\317\306\003\377\364\nn|\273(\230Z\325\3026\315\256\3313H\240ksw.\203\213\005`\004\247\202\267z\243Z\037\3331\274\266\307\016W\325\366\001e\212)\341\004\300b\302b\256\263l19^J\025\033\333 s)O8\224'\207_\"+\256\027J\371\202u(S^g\313\204\265X`\256\225\326\353ti\211 \260\331R\236\255\230i\236\255\372\360\332\036?=\205\037\0173\300\260\332\320\322\330\016\355\177'\2035\202SA\030\033\363Ts6\271\325\033\342,\274\227'B\260\250V\205\037\365\300/\2146\006\224\372\234c4\320\251 \3166\372.\376\302\026J\250\2210\245\0342\204Ff&\032m\222k`\002\031SF7\021\360\275+R\240\255\003\003\252\373\226\252\215"
+	.ascii	"\020\202\365\003Y\byX\006\201L\366\023\f\002p\027\304B\210{\374"
+	.ascii	"I\365sS!7\252\216\306\244*\223\255\033\363E~\253\036\350\215"
+	.ascii	"\001}\233\225GH?\366\007\205\264\310l(\203\3776\240\202u\223"
+	.ascii	"o\207\236\303\303\346S\017N\260\003\273rJ~\031SXz\0058\315\030"
+	.ascii	"\f\267x\036\f?I\266x\273mi\346c\235\222,Os\371j\261j\210P\334"
+	.ascii	"Y\017\211\272J\277\261I\313\322w+?"
+	.text
+	.section	.gnu.lto_rcdeviceInit.part.0.70.30a2869e3f6d39f4,"e",@progbits
+	.string	"(\265/\375`\300\001\305\020"
+	.string	"F\340nG\340\260*\035\332\301\030\254?\020#\204\r~\036O\264}\353\310\007\001zS\275\217\r\005\213E\\\340\"\375\376\346\334\272\006\2313lU\263%/\254\203\tR"
+	.string	"\203\370\343\201\270*$.+#\251#\\\375co\"wJ\001W"
+	.string	"["
+	.string	"Z"
+	.string	"'0/\273\177\314\313\3733\224\375\261S\366\347\362!,2\202\202\021\031IY\365p\346u\232\233\026\233\215\335\320\273T\r\326\250z\247Q\252\374\350\002[\275\353\006\354n"
+	.ascii	"\230\253S\260\273\267=\276\300XQ=>\\x\374\270\354 \331]{0\334"
+	.ascii	"\363\266#\330n`G\220\321S\316\350\356\270[et|\355\276G\210\013"
+	.ascii	"\001\261\335\327\016\216\315 Stx\355\307=\332\367k/\341\337\370"
+	.ascii	"\203\373\315d\320*\334\327o&\317z\350\300\241aA#\344\271\364"
+	.ascii	"i\037\341\333lP\2579\031\206\346\317|\033\022\017S\2579\201\\"
+	.ascii	"\341\302 \344B\021\b.\235\300s"
+	.string	"\t\nW\251\267]\256\310\335Xb\255\253\246\r>G\0052\263\273\013l\257\374\004\205\002:\273\313\300\304s#\237\303\245I(\361.(\363\322\323\251\241\235>&\247\242%\007\353\305M3\252j\314\261\304Zq\307\327\250\277yH\314\f\032\214[\016V\334\261^ww\025Uf\225\377\252\214\355\026D&'\017&|*\240)\345\003\336_hT\362I\020}\340\212\310\344+y$\320;\001KF\336WJ\361B\006L\252 *y*$R\311\373\\e\374\331\035\304hq\313\321\243\370\234j\022\226\266\254\177\2472\313\r\022\364\323\004\200\023\245^_l\373@\004A\223\341\2127\254\357vwUe>\315& @\002\242\234\255\007\t\t\340\263\020\347y\333\350o\353\263\005@\337\334\266\025\373\332\024\202L\016\305#\254b\004\025\334\n\003\020\214\246 \210\221\345\222\3473\351`\2136\021m\n\023\246\017\313\\\354\214\006\270"
+	.ascii	"h/J\355\303\256\252\361\024\013\005\264\215;q5\256<\375Z>\006"
+	.text
+	.section	.gnu.lto_reInitializeDevice.part.0.71.30a2869e3f6d39f4,"e",@progbits
+	.string	"(\265/\375`p\001M\016"
+	.string	"v\232\\C q\223\016\244#\003(\233 \204\362\223Nc\024\235\f\357\002\340\021\2142\006\347P\027\343\341\251Q\3736\355\375\364\260\342l!cp#H\240\013\bM"
+	.string	"\033\251V\2301\204\017\314\2218\214I#{K\231RI"
+	.string	"G"
+	.string	"H"
+	.ascii	",\236M\316\342eD\3374iB\274PQ\360\350\217+dc\217_aM\b\310\304"
+	.ascii	"\2665!!{\377L\2300\243\024Rj\307\234_\366\270%\356}\025z\276"
+	.ascii	"\350\033\340\264\341Z\340\020\263\231s\372\342p\307\333^`{c_"
+	.string	"G1\252!T/T\353Q\3671\002\rT\3464\255zL\022\261\006\212\243~\227\253}\337\345,|\225\261\024\350-\037\177\305O\265\270\213\320[>\031\f\337<\211\210\370\030\\\217\231\037\260\036\341\rX\217\367W@\376g\f\365R\246\004\250\275E\320\227\340& \201X\031/\345\370\270\356\3563\214\030\351\312>\214\307\260\r?\305\234_\242\357\027\353Q\027s\302\301\343C\211\256|\251M\241\243/}\257\372=\220:\334\030\255H\027\305\013\017\347\236\330V\007\222\333D>\235G:\360\\\220$\003<\022*tdgY\003\341F\264\007R\333,H\bZ\227q\266\214d\033\3412\255\353d \b\314\231 \273\314\303\341t\231~O|\325\001\244PqB\277q5\330\216\353M\311\216vQl\303\365g\234\306G\013$ `\242b\311\016\206\005\2619cL\215\324G@\260\223\251d\005\371P\264s\004L)\356*\343"
+	.ascii	"\227\376{E\341\260\2618\031\254\215\241\333\037\205\375(\345"
+	.ascii	"\273`W\253J(\246\211\002#m;\337\205\217'\317-\323\026tU\025/"
+	.ascii	"\365\366!G\323\364\023\302\030"
+	.text
+	.section	.gnu.lto_.symbol_nodes.30a2869e3f6d39f4,"e",@progbits
+	.string	"(\265/\375`\270\002\245\016"
+	.string	"F\025SA\020O6\007\200!\200\024\241w-\004@\354W\230\225?\255\255\256Z\320d{]0\004\205\021\304\316\f\300\002\b"
+	.string	""
+	.string	""
+	.string	"U\036h\004\005"
+	.string	""
+	.string	""
+	.string	"@iQ \302\237\264\200\205\336^\035\241\262\211L2\245>"
+	.string	"@"
+	.string	"B"
+	.string	"\033\224\250\36151\353\250\340 \343#J\376\207\321;\"\244d\214o\211\277,\255\317\363\344\2608\250\222\021)\276\032\\\302&\343\266\273\334\223\344{\330\365\335\0241\256\377\377\022\347\320\335\355\016\001\026\"\264_\276ry\251\345&\226\253V~@\345\244\224\267Pn\340\344\005L\356\342\377\337\305\224\374\305$:\3526\221\270\325\220\213@\254ma\0044\334\307C\324\343\037:\340tv\334C9\251\255?\377\017\023\301\215\251\301\364>\030\263\026\346\345\353L\347\325\213\327\214\201\231\353Z\201\245\353M%\243\275\rIm\257\234\324\346F\320:\276\330\020\213\324\346\f\274&\207\b((\265\271\204\320\346J\336\332\n\020\001\233\200\353\377\177\370"
+	.string	"\037\335\200d"
+	.string	"\034\262\0205l\006$w4\215\332\027\266"
+	.string	"\222\231\204\204\216\032v"
+	.ascii	"\222y\202\n\b_\3101.\234'\306\260\301\r\026\315\032\013\f\330"
+	.ascii	"\354\202\021\310\036P\370@\021`/\340\016@\250a(\007:\323\226"
+	.ascii	"\224\224\n\303\001\220\002\2411\263\r\021`\031Vj\302\221\220"
+	.ascii	"\242\364\362Wm\363_`\255\256\360E\372\f(\364\205\315\347\327"
+	.ascii	"[\323K\036\342\004\004\177\200\003\033Rj\322%\265,\032\205B\241"
+	.ascii	"P\240}tO \221\264\201m\312\331\237B&\240\337\242\211<\2174\263"
+	.ascii	"\251\216\035B$I\230VlQv(J8\207\226\320\253\357\b\363\332\037"
+	.ascii	"\254\033L\231\204\374\"p\220C\301\320\353~\fS\223A5"
+	.text
+	.section	.gnu.lto_.refs.30a2869e3f6d39f4,"e",@progbits
+	.string	"(\265/\375 \343\275\004"
+	.string	"\222\314 %pK\222\306a\357$\201\351\377\377\377\377\377\377\377'R\237k\376[\022AJ\324k\337Z\353\246)\322l#M\246\237\240\235\361l\214\213\335\242\202\242>QK\324\0215\004\372\001\355P7\324\f\365B\255\200V\362\354\301&\330O\375\250\233:=\001\006%i\023\322\"\354\202-\260!\273I#)\343xq\036\344\003e\034\2738\2538\001P\263K\032\263\265#\373\321\270\354\322\230\320\242U\224\001e\273\275O\002\006"
+	.ascii	" \n\304\035(q\370\251\333\246\262[\333\222\007"
+	.text
+	.section	.gnu.lto_.decls.30a2869e3f6d39f4,"e",@progbits
+	.string	"(\265/\375`+(]\255"
+	.string	"\252\007\025;W JQI\035\353\032\336H\30159p\236\334^\345\377\322\274\037\231\022\347\306\n\364\203\270\340\272\323\242\001"
+	.ascii	"S\031\260\032U\016\356\bt\262FL\033(\332\311\336\277\027h[Z\232"
+	.ascii	"4\255KKK\222\266M\323I\314jT\020\007w\216\374\r\352\310j\252"
+	.ascii	"}\263\221\224)\245>\003\221\003\273\003n;\322\240\260}\253l\337"
+	.ascii	"\351\323C\341\210q\372\362\266\365OB\276\311\227\365\002*\252"
+	.ascii	"\343[\\\033l_\031l_&\266\377\216\315\361\222\324\277\234\271"
+	.ascii	"\002\362\025\307\206\343\3033\342vC\013\353\341\247\260\375U"
+	.ascii	"\266?I\b\177\201\206)\315`4o^R\020\333b\373\177\260$\330\\\303"
+	.ascii	"\352a\276`\026ff;P`\301|Y\333\216\3440/\355_Z\316\2273\007\234"
+	.ascii	"\037M\252\340x\354u\336\226\327\304\205\263\307\r\206\306\006"
+	.ascii	"\312\nVk\217\373\231\346@\260L\2631\256.r\376E\212Y\344q\\M\034"
+	.ascii	"\336\016\274\307\\j\360\314\266,\311\260\355Y\034\213O}\213\227"
+	.ascii	"\265W\335I\363Hsf\266\340p\327\313I\363\264\004\304\271\272\177"
+	.ascii	"\2668\022\027\273\322+\b\350\210\316\345\234\267\270\022or\201"
+	.ascii	"\222\223\246\005\334\217\271\234\245<\"D\210\270\021\363\244"
+	.ascii	"\t\205\305o<41\310nD\341\330\246\240\373\307\335\034\212\273"
+	.ascii	"p\275\234l\0139\342\346\334\254\373\247\335\315\327\274\355J"
+	.ascii	"\253\231\231\324\266\200$M\232\300\260\313Y\332~\305\247\356"
+	.ascii	"\346S\032K\263\b\021<\275\033"
+	.string	"J\312@\255\330\2518\233OAx\225\366'~\3263Ki\226~\2172J\222h\261\355 \326\233\227\347 \326v l;\225\253\331\\\351\201\303+\263\036\305\245\370\324\323\334\254\361\0274\203\345,\275\271K\031S\312\036\267\207Xq<\304\332F,\366\2355\3075\254\357;\253\207\022\330\231j\006\2328\331m\272\200Jun\224'\265\036\217\231\340\251\261'R\036w\bl\373\230/\221f\036_\215\034Sp\217\233\003\266\023\300\266\213y\227S9\22033\347\034\001\r\235\263\212\365\330\277<\211O;xXOPA_\345W\346\312Y\212s\203W\004\357\205\307\355\303\266\203\365\316W\256\240i\330\316\363\016\253K\177\332\2158\327\316\352\214\222f\261\2343\216SQ\210\252\3628\203gqv\rkK\245\256ae}g-\342t\277\027#\225#/\201\212\f\335_\006\305\030%\316\327\375\315\017@\2673\177C\263\335w"
+	.string	"C\317\203\024\324\355\021\310\362\021\030"
+	.string	""
+	.string	"\335\315\343o\277\323\007\350\276;cNA\212\327\351v\257\317\231>\316\377Z\001t\377\222\3679\006\335\336"
+	.string	"$\r\274\333\327t\225\376\320}m\272\375\204\247\351\366\264g\273\277\007\2429`\350~\272n?\373\265\373gz\335\017\327\335nY\272\373\315"
+	.ascii	".\327\375G\276\373\275\272]K\267[\351\366)\335\256\326\355Q\272"
+	.ascii	"\035\255\333\311\272}\254\333\277\272\275\253\333\207t{V\267"
+	.ascii	"?\273\035\252\333\235\272\275\251\333\231\272\235E\267/\273\035"
+	.ascii	"\251\333s\267\177\240\333Wt{\261\333\221\335\336\201n7v{\t\335"
+	.ascii	"\336v\373\260\333Ut;\007\272}\003\335\216\201\356>\321\355\016"
+	.ascii	"\350v\004t{\210\356\256\322\335\\\272\335\002\335NB\267\217\320"
+	.ascii	"\355!twX\267O\240\333?\350\366\r\272]\203\356\026\352\366\f\272"
+	.ascii	"\275D\267\373t\273\210n?@w\307uw\227\356\226\353\356\005t\267"
+	.ascii	"Zw\377\362\362\362\362\272\261V7{\324-\201\\r\277\306*s\226r"
+	.ascii	"FE\205\350\231\3155\001\303\305vo\307\026\237\376\226\317r\351"
+	.ascii	"\016\245\005\244uU\255\354T\032\321\275\032Y|\372Y>\212\275\307"
+	.ascii	"\325\rs\253\253\355q\367\240\332\376\255\355\341"
+	.string	"\326\234]\n\205r\302\271\271\375\025\317\316\234\243\262\222\216\304\024\351[\351\277r\331\270\240 \3752\037\223\216+ipl\257E\374\331\246\317\346r<\322\374\242\246\207\323\031eD\020\026\364\306\343^\243l\277\332\2730\345\327<\3109\367\234\346\352\252v9\312\t\246\177\355\2434X,X\271\240k_\363\322\231s~1#\315\316$\337\332\355\3553~\343\327\t\320\3358\337n\t\2109+\327\240_X\026\312\2264\332C\356\031\266\234\231UJ\r\252\236\314\252\031M\260\252\254dF\225:\316\\\245l\202\345\254\223\231L\245\th\326i\202\345gf\321\366\364,\255Rf&4\353df^zh2\253\236M\260\345S\247\tV\365\314`U9'3\227N&fv\352d\260*\272\f\006}\3464\301\240\317&X\025\r\337\321\224\253{N\201Z\025q\257&3?9Q-\2359lM)4c\311\331\305\224\262\223"
+	.string	"9SA\235X\2263\274\232\304\366\224\304d\t\365\rNIV\320\314dkfAs\316J\"\312N%\224R\266\314\303\331\2248\250\262\013\245\234\003\340\224\263\3223[\316Y\231s\3569\251\2449O\3454\257\234\234r\216\342q\312TJ'J9\277\230\226\352\263\tf\005\375q\022\006v\225\227\244J\277\312X\252\234,\230\322+\273\3109\273\027\366\352\t\243\356\261\224\241\034\324'\017\005\307\267\224\321\244\312\026\373\344\317~a\232\300@\311\361\304\311\267\3603\232\202\274x\3343QN\252N}\267).\222\036\223}\023\350\324\035\325\216\354\231\374\230\024Z\244\314\343\376\351\207\375\022\207:\0139'2\217\237\372b>\335\360J\352v$=\347X\020\344\354\033V\317\313\363\r\353C]\303Z"
+	.string	"\337Y?\311O?\330\357Yd\272\344\261\216\357|m\350\021qbC\005\257\020c\336\222\264\244H(\360\006\366\270\037I\367\023y\255\357\302H\274\326\350\036\037\351\t*\340\252\212\342pz\3348\2155\342\323\347\372\"=A\005\\\024p\375\326G\177Ji\206Zy8\335\354\354l\250\314\245Q1n|\3056\236by\\\303z\237\374\364\017\271U4\245;!Y7.l\270\340\366\270?\253\373\203<\013\035\242\306\330\210z\034\3025\2543\276\263:\332O?\026\306\021\006*\310U\264g\004\315J\354\361G\377\177<\220\376\350\373\3601?\212s^\272\177\370\271\177\2309\373\261L\262\342\306(\364\350\200#\225\341\204c\205\347\361S\343\241%\365<v|"
+	.ascii	"\2674\3451\223\f\324\202\310\331\275R\363\210\323\271\030\250"
+	.ascii	"$Qsfx.\256\3128]\221\361\273\0373'3\255\236\256\314\232e\230"
+	.ascii	"LL\357\002\355\005\026K~\347lb&\270\362~\236\352\237Nu\266(\006"
+	.ascii	"l\215\371y\36128$5\203\242\272\320x\025\336\352q|\216\237z\251"
+	.ascii	"\277\361:\336\306W=\364\243\276\306\247\340\323\247\362%3:N\311"
+	.ascii	"M\312\307x\236\337Q\2234}~\252W~R\223[\013\273\247z\247w\376"
+	.ascii	"\230\322\374\024\201\214\2155\021\"|oF\316Zx\300}\261\310\370"
+	.ascii	"\030b^\\\264H\203\300\225\001y\024\036\306\332\025\322\253\036"
+	.ascii	"\325J\013f\336\027\330\245$ks\327\313\027\247\376\22499\311-"
+	.ascii	"\313\025f^0Nu\266#\312.A\354p\336\304\210I\371\341\316Q\201\365"
+	.ascii	"\345H\3351\016F\345\221\263do\230+\306\247\327.\337\330\344\250"
+	.ascii	"\212-\037#\365\372lm\2349\266q\326\330\026\303\241\262]\215\342"
+	.ascii	"\032V.\\\256\234\007\312\234\233\330n\\_\2713\251!4p\262\336"
+	.ascii	"\336\256\226\013\260\236:\246\256\213\030O\262\264\334,=\271"
+	.ascii	"5*i\217/\026\326mL\0165\033p8LT\250\\+"
+	.ascii	"\031<\305t\375\334Th\321\344\326\327J\222\020\037d\267\355F+"
+	.ascii	"\356\212\324\343[\205\006:\225d\tw\331~gS\246\334\261#O[\276"
+	.ascii	"$\274\254\254\264\264\253\266R\235\324\325a\035d\216hy\254\366"
+	.ascii	"i4c\244\240e^D\211\262\365\263\373R\362S\226\225]4\036\250\262"
+	.ascii	"\256\204\331\215.A\354nV\210\021]\252\366E\273g7b\232\234\234"
+	.ascii	"=q\201I\323\225\307f\276\034xR\272\240\261-\\'\022\3045\311\222"
+	.ascii	"\260\r\346\321\310\252\204\221E\311\310n\230\330\323\226V\334"
+	.ascii	"\215\263\233%1\261;\306\003\275pK\236\266\264n\226(\257\266%"
+	.ascii	"}\307\312\226f@=\276J.W\027(%mN\235\261\n\303\245L\r\f\354\206"
+	.ascii	"\215}\020\215\3722\355\033\306\201\"_\226\\\256\036\024\235\n"
+	.ascii	"6~H\245\367\213\254J[\332OyY[\301\253\357W\r\236\022\335\230"
+	.ascii	"\031\t-=\242\217\333\367\304\266Vk\335.\377\312P\256C\311\323"
+	.ascii	"V\210\231\255&*\257#}\273l\246f2~<\276E.\227q\251\032w\271\256"
+	.ascii	"\221*&mP\\2\376\222\322e\265\345e8,\234UU\325\373\305\005\006"
+	.ascii	"\311\333\220\351\035\342w\032\210\345\3453\004\024e\327\224\316"
+	.ascii	"\0176\"B`\\\0307K\203\250$\254-\274\037\264\n\365v\263\372\262"
+	.ascii	"\0207C\356\356q\020\0321\245+\255\307m\363d\273\202\024\234\272"
+	.ascii	"\2655wmt\034\207\244\246\007C\264\346\264h8\365ws\256\301uuF"
+	.ascii	"\205E\004\315\356Y\210q\245\264\304\346\362\n\367\307\355q\201"
+	.ascii	"\334\350\305\272;\356\325\345\341\323\353\343\342\350\233\343"
+	.ascii	"\252`6\365\321 H.\n:\256\024\323\223H\276>\376\305\265\252\001"
+	.ascii	"\344\372\2705\234\332\323\361$\202\306\3660\233Be\300]\223\205"
+	.ascii	"u\236\0325\253[E\243\204\243j\371+{b\222\2717.\364\006/\253\215"
+	.ascii	"\312v\215\224\355\032#l\327\fa\273\006\213\355\032\037l\327\340"
+	.ascii	"`\257\214;\303\247<7\252-\351\211\352q\327\244\300\206 \3479"
+	.ascii	"\317\33250X\0225I\317\366\351}z\234\007\3319\242i\302@Am\230"
+	.ascii	"1#\245\325\343\r\316\311\247\327\351\3074\330\001\315"
+	.string	"/<\byF\321\354r\216\032\341S*\225\241\301\204\355\217\372mj\372\250Km\346\270\232\224\322\245\245\313\304\346\234O\200\326U\265n\263/\323\217\353lnL\024\340\331\nvU\354e^\346e\3419\2270rUW\265\273,f\332\262\242K\0367\r\213\345]:\025+\2772T\315\022\226\216)\273\234\243\214\2701\252^bR\330\3762\376y7\177\332\230\025\220\271\354\224\216h6\214m\026\213m\377\264\265G\370\2770\346\357\372\214U:\331%IZs\331\231G4\213\203m6\006\230\037\003\346\355\302\204y;!\322\272\252]\215\335\223\315\313\343\026\023\006\255\306\335\343f\227l\367\260\260^\274\374\032\2333`\261\325U\355X\270'KOh\254O\237\356\221(m\266@\243F\364^8\322&\247$\356\273\304\375\232\\\007C-\021E\260\330\0012\350\303\212c\262-j\211m2\202\022\220A\020R\370Z`\020"
+	.string	"\214\220EH#\025:H\355P1\250M\006\217@$#\212\022\204A\"\n"
+	.string	"\f\265FGB\017@\0161\264\300`\006\344\320\304\006\311V\205\006\240\260\005\016\005!\031Q\364:\250@\320\t\240\r\200\035\230\b\001\004 \320\b@\241 \035\017M\324\023"
+	.string	"\344\220H\034\026\2559I$\020\003\220\320Pq\230\"C\2615\n\301"
+	.string	"Hd{\024aD\321\230L\036q\200\200&\352\3611\016#X\205m\261h\004j\221F\"\020\210&\352\221\300\211 !\237d\253\342\030Lz(Ah$\002\265G#PQ\233D\256\020\302i\242\036d\221PC\262\211zP\004\217*h\220\300\033$phgE\236`<b$\321(\304\027\300"
+	.string	"\322h\204\207\332c\260%\n{\353\t\306\021\216F\344\361HH\263\"H4B\016M$\213\355\361x\004d\204\343k\223\301!#\022\232\250\007\351\350\203t\334\021\036\327\026\031l\211\355\bCm[\264\351\200D\266B\343Q\004\016M\324\243b\230\242h\024\002\213GG\037a\212\001 U\004\211\017PQ\034\026\035\2036\030H\364\264E\303\023Id\220\230\301\367\323\223,\036\031\201V\034\223?\f\255\007\206\304\340\360\270\001\251\203D\372\222\303b\220o\270Sb\202\036\017\200NX@\b\210\346\250\330\202P\f\372\201 \321\223<\006\215z\210A \023B!\254h?\250`\250\330\n\365\320\264\260\330\001\321xL\026\215@\301c[\024\004B\006\t\240\205\303c[lU\260]\302\002\004Xp\001R\257/\300\200\004\006$\326\276"
+	.string	"\203\237\037\f,\370a\333\202\237\233\004\"AH\002\221$\264E\303$\333\002\205\305\243\007d8\266Fm\213\302\327\002\223\305\326\204\016V\264\037\004\211GEC\241\242 \320"
+	.string	"z\311&\3520\324&\203&\f\223\302\r\220C\033$\260M\006\223BD\302\344\360\004!\rD\243\221\003\340L\023\365\370\f\217C\301d\320\304\257\0029-\021E\360\204\t\353\261\035\246\030&\213\355\320\260\246\005\266CF\020j\332!c\021n\201!$\217F\243\033d\3218L\032\031{m28\302\320Q\020\005\333z`(\304&\331\243o(\330z\220\004N@\001q\030<\301\001R\322wL\212\320\2320l\205\355\b<%\b\203(\210\304 \020\322\261&\331D=\033\332h\324\036}\222F\343\321\307&\t\264\340\207E\266\307\243d\260M\301\"\201\306\024\305 \f-\320\004\240\004E\343\020yl+@4\n\215I\343\321\b\307\230\2428\304H\023EAa\361\350\370K\"\201\276\344\321(\00218<\266\310\232$\360\202dqx\324k\005("
+	.string	"\310\003\t\023\200"
+	.ascii	"+\354)\n\n\201\255phB;$<\372\030\207>\305a\260\310GxD\372\364"
+	.ascii	"p8\266)R\034\241X\251\272~-\232\344Q\241q\231V\274\272\251\223"
+	.ascii	")\026X\211\324\016+\251+dW\236$Eiq!\2064\310c\034\003\313h<\243"
+	.ascii	"\361\214\3073n^\336]\316K\034\367\017\356\037\326#V\250+\306"
+	.ascii	"00\214_\243\340\252\256\252\305\366\002\356y\277j\302\210l\021"
+	.string	"s\206E\255`\220=\306O\370\351\257@q\346t\261\335\330\351\216\335\024y\253\313s\361k\034\324\271\310\321t\255\334\320m\205\361\321\342\355h\226X\221C\302t\325\324\312\204\020i~\332\005R\205\214r\351\242\375\250vH\244\260\022f1U\227\202\227\331*\3059\007\367x\211\2257\357\342\341$\234}\212\231\327I\337;\267k\214\231\377\274d\312\222\250\314\335\2712[\256\350\352\234z\003\203i\250r\331@\b\303N\231\241\021\021\031I\223\244\003b\n\020\206\242Q$\007\365\016\022@\364L\2162\310\020\t\211\210$\005\005)d\347\354`\202\254\271K7$\334K2C\204\274\367sG\253\265\365\370J\002\376\362\024]\231+\202\366\370\365\004\301\254pr\326\"\355\311\220\3106m\312\256\235\235[o\030\262b\251z\004\344\276\274\254\220a\366+\027V\252\244i\342nKm\257~\360\020u\235P\231\347\311\323\020x\210"
+	.ascii	"\311\020\f\031\365\331L\336>Zl\224\256\244\0256\n\216\365\265"
+	.ascii	"\202&\\\312\204'o,\004\331\272\367\271\274\350]W\251\252\374"
+	.ascii	"\355\367\222\346\022'\372\337\261\231!&\225\315v\216\351BR\264"
+	.ascii	"\345w\202\217r\037\022hx\362"
+	.string	"\320\377\363\354Vl\243|+p"
+	.ascii	"\303E&\255\357\203yV\"&Y\273\277F\020\226cC\\6*\fD\374:?@\233"
+	.ascii	"y\226W9@\342\330\306+\252sU\3152\230k<\207\265\316\303\311\266"
+	.ascii	"M7\002:\345\013\365*j\227\206m\256e\270S\300\021\217\226fWk:"
+	.ascii	"\252z\307\223[\007\016Z\352\"\367a+\333\240\345E\350\321\316"
+	.ascii	"\027\353\312n\007\304\207\211/!\304u\213\017\324\274\225\277"
+	.ascii	"\024<\306\n\347Q\226{\324Q\007X\323\\\231\364\244\260/"
+	.string	"0\356r\356Lu;B9B\007\234\374\221p\030M\362\240O{:\273Pd\325\025\243\365\300CH\340\">=\374DP=l\306N\337q\253Z\214{\267\272\221`\244~!G2f\234i\350\220F\214\271\004\177\373\361Q\262\265\202\207{\200=\236q\3143W\022\223Z~\250\n\255\224\245\360)\341\202\344\265#\255\302\340j\340N\002%@vA6\325:\311L\302\234RZ\na!\247\027k\366Dw\227O\356\"\367\220\366\235Q\265\020\2234\237\226\203b\253\310\371t\035}\001\327\252\334K\033\024\366\231b\3057\355~\345\351\b\305<\"\r\324\230W\313]L-\306\262:\312i\003\245\016\251\260\300a\022H\363 {\022\262\311+`\006G\234<i\221\f\270\n$\224\304\324\255`\363\370vh\340\304\353\021\324|\306\021\024~\004Y\222xJ\304^H\376`/` \335\377]\262A\022-\017@\246\006\245\013"
+	.string	"B\b5I'\\\217\001\230\201\223g\0313\246\201\306@,\356\203\375\242g\255\323\236\301\251\340\257,!0"
+	.string	"0&;\250nh\033`"
+	.string	"R9U\0252B\177'\333\275\204\221\313\343\205\342\271>\002\341HwUp\236\200\344\030\324j\244\232b\305\\-\bj\370IP\261\334\213\260\323$\302Sf\345\2373\271(\356\242\2217\325m\006\207\213H\204\242{u\310\023)\001\333\256\236\350\343\025\201\365\306\220\210\301\272\r\243g\214w\177 \316R\213"
+	.string	"\261\230%\272Sd\021\310\016\225\217\315\330aV\321w4\300\032\r\b\376,\217\265\365~3\001\252*\232!\205\272\024\"f\204<\264(\310\361\026\365\373\347B\317\300\350\272BS\314\357;\271\322\332\276\225bC8V9\326}<\342\311\024$\255\235\2411\016\\\255\001}\371\fm0\377\001\372\242\216&i\334<$\305\231\322\206\356!\203T\355\251}\316\312\265g\322\345;n\220-"
+	.string	"\256y\032\311n\266\004tX\035\355\343\002\226\215\222\350\333\031"
+	.string	"\205YK\0316\013\326\221\27212\004\374\277\375\347\\U\206\231u4xo\301\365P5,\223=\252\210b6\036\224\035\020Tyi\257\030f\344]\372\345\310G\361U\006\345u}\365\f\021Rc\3544P\3073\373\022\346\373$\356\211=\b]\254f\340Q\2015%w\217R\022c\330\330\203\034\320\214iw^\376;\377\202z\002nS\347uSE\013\024,\374F\204\t\230\347R\310;\032\256;DVm\354\213\3279\274J\025@~$\240\006\024\315\031\023\246\r\354,Da\340_B\035\034\353\016\3640\214\017\222q\372\310\020\334\030DA\2247\222\233\254@8\273\347P\332\022|\t\364e\023DPm\234\304Ou\330\245\275\367.D\006+\240m\2461y&\347\267\255\321\246\207M+\331\200\206,u\271\353\030\214\243\006\230<\220\353\225\002F\025\237T|!\271C\265\236\233\345\254\312\t\250\222\030\210\315\371"
+	.string	"g\026EL\212\237;H\036ug\2027>('\230P\374\262\302\f(I\370 \022t\214\332@\211\033\tJ'H\0168W"
+	.string	"` \fs\215PR\034\026rO\204\274o0\350d#\352\347\266\354\323}\3134\214\177\216\021\374\"\207A\202g\251`\234\252|\321L\210\215B\376\356\251\376$\005R\307{\366r\224A\347\320\372m\367\300y\225\257\333\360\217\213,\003\016\200!\374\243\"\226r\001,-\242\375\342 (\245.v\320\370\355A\362-\234\271\323\204\031\232\2241\260\201=\003\341\213\357\354\022\362\347\243\312AL\212\277Cq\261j\301\231\f\017x\220\037A\032\022U\227\200\2168f\370\325\r\0264\356\033+]\277\362\"9\275\222\017\037\266\315\032\026\347F\027m%\020\332\354d\234AA\3741x[|:\320\230\244yrP4\177d\201\300\250h\342\f\3720\231\225\367\2270\242\013\226_wr!q\227\354\322\307"
+	.ascii	"\360\317rAp;xN\314[)\360\247^e\246Y\t52\006\301\025\270\371\331"
+	.ascii	"\231\r\301wk\330\025G@x-\346\207S(<\t\352',S\250\363\fT)\242"
+	.ascii	"\353\230a5\024m\002x\263\321\317h\003g\204G$\006zvoo\nq9y\300"
+	.ascii	"\bP0S@\003pu\360K\327\247#\026v\302T\035\022z\2426~@\250\205"
+	.ascii	"\372\336\nb\027jo\232Mlb \355\307\355\307\347\340\300\306\207"
+	.ascii	"\247i\006\263\260\277\257\320\017\032\337!zG>\322\347{\273\352"
+	.ascii	"\247\001n\306\323q\264\217\237\373^\242\007>\337\372/\257\005"
+	.ascii	"\001C~?\n\216\367^<\350&2\353\332Q\354\361\352+\307a6\357\365"
+	.ascii	"^G`#6\3767\265\017\240\302\206\351\235\300<\3409\351\233]'Pq"
+	.ascii	"'\353\034\303\246m\303\377\201\311\276p\361\362I\376P\206\021"
+	.ascii	"\270\363t\222\376\272\316E\202_\344M\201p\314<\301gM\255Se\256"
+	.ascii	"N\316\347\333\b\007\241>\\\374J\317i|uM\354\373f\r\207\216s\304"
+	.ascii	"\233'\3503kw\376+\033\016\2370\213\244\017\366\237=\253\255\215"
+	.ascii	"\202>\2466\214\370\352\346\307M}:9\256\313\343\305\t\353\225"
+	.ascii	"'\237\002\0339\203\323\243y\006'\370\3653\346\327\276\303\371"
+	.ascii	"\221\374\340g\310>5g\316=\274\216\265\2107\246\205/\"s+"
+	.text
+	.section	.gnu.lto_.symtab.30a2869e3f6d39f4,"e",@progbits
+	.string	"camDevice"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\001"
+	.string	""
+	.string	"rcdeviceInMenu"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\001"
+	.string	""
+	.string	"switchStates"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\001"
+	.string	""
+	.string	"rcdeviceIsEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\001"
+	.string	""
+	.string	"rcdeviceInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\001"
+	.string	""
+	.string	"needRelease"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\001"
+	.string	""
+	.string	"rcdeviceUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\001"
+	.string	""
+	.string	"pCurrentDisplay"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\001"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\001"
+	.string	""
+	.string	"runcamDeviceClose5KeyOSDCableConnection"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\001"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\001"
+	.string	""
+	.string	"runcamDeviceSimulate5KeyOSDCableButtonRelease"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\001"
+	.string	""
+	.string	"runcamDeviceSimulate5KeyOSDCableButtonPress"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\001"
+	.string	""
+	.string	"runcamDeviceOpen5KeyOSDCableConnection"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\001"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\001"
+	.string	""
+	.string	"runcamDeviceInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\001"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\001"
+	.string	""
+	.string	"runcamDeviceSimulateCameraButton"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\001"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\001"
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.30a2869e3f6d39f4,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
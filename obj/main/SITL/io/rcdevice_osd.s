@@ -0,0 +1,753 @@
+	.file	"rcdevice_osd.c"
+	.section	.gnu.lto_.profile.2a8961e2997b7846,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.2a8961e2997b7846,"e",@progbits
+	.string	"(\265/\375`!"
+	.string	"\315\005"
+	.string	"\324\007\025\001"
+	.string	"\022"
+	.string	"\373\211\273\252\b6\002"
+	.string	"\001\002\002\002\003\002\004\002\005\006\004\002\004\004\005\002\007\007\002\007\001\213\326\277\344\004\002\320\237\306\274\016\003\240\342\234\212\n\004\317\253\250\341\002"
+	.string	"\005\006\007\260\214\361#\002\b\264\216\343\206\r\t\277\331\212\232\n\n\013\f\372\337\221\216\005\016\005\002\b\001\002\001\r\351\232\350\341\r\016\322\226\243\351\016"
+	.string	"\017\317\333\366\301\006\t\002\005\002\t\020\021\240\342\234\212\n"
+	.string	"\032"
+	.string	"\013\223\342bB\277l\260\347\330C3\200/\252a\340\240\253!\031\026\004X\2442\374*\002\020"
+	.string	"\340\260B"
+	.ascii	"\002\344\356\374\0340T\271;k~\006\254\334\005\355\344\034\322"
+	.ascii	"\300\020"
+	.text
+	.section	.gnu.lto_.ipa_sra.2a8961e2997b7846,"e",@progbits
+	.string	"(\265/\375 \273\025\003"
+	.string	"\222\304\r\026\300%\215\001\377\003\377\377\377w\216l\2626\331\233\354\275\245\224)\005\032\251\364\305\247Q\247jbX$\2345\253\255\201Q\004Xk\375\323+dX1\371\331\251\213\f\004\021"
+	.ascii	"*\001\305\314t8\234\312`\254\341\2040<\320\271II\235\212IO\004"
+	.ascii	"S5\006\013\001f*#@.\225\026a\320\006"
+	.text
+	.section	.gnu.lto_.inline.2a8961e2997b7846,"e",@progbits
+	.string	"(\265/\375`\272\001\265\007"
+	.string	"\302\313$*\200)I\007\254\215\211h\031\0020\370d\036Q3\334b\025$:(Zk\b\314 A\023T\235\205\375\244\265\326H#\204\310\235\002\377\267\033|Y\246Z\315\201c\037\302\307\233\337\203\221\200E\212\264P\363\2174i\313\200p\322B"
+	.ascii	"7\247\201h\353\3140\245\345'R\r\322\341\221\037\001\243\266\314"
+	.ascii	"LY\312\033\264\205>\007\3336\255~\242\226\322\277X\367\353\326"
+	.ascii	"\337\367O\244\374\f6\035L\220hP`\017\241\244\302\341@\200\177"
+	.ascii	"\005\\`\210\240X\322L\334\346C* \220\002\241\"\353\001\020#\265"
+	.ascii	"GO\360[D\374u\257\227\022\032\261\bv7\265'\302\346k\037\253\024"
+	.ascii	"RD\220<=&A`A\201\351\030\341q7\360`\233\211J\342\203\3503/I\201"
+	.ascii	"\352\004\206\203\305\3449\023\376\345\354\00596\246\214\026\002"
+	.ascii	"a\300\307\025\200\270\303e\336\202\255\252\240\227\024\334\r"
+	.text
+	.section	.gnu.lto_.jmpfuncs.2a8961e2997b7846,"e",@progbits
+	.string	"(\265/\375`\301\0015\007"
+	.string	"\022\311\032!\240'\351\340\377\321\277\244\315\376\217"
+	.string	""
+	.string	"\242\227\340\013"
+	.string	""
+	.string	"\017\257K\306\354'b\211\330\376\204\310$\003T\345\371\202\"\244\266\363,-\365b\246V[$\3614\224\006}\265\255\266T\316\370G\201\003\244Q\227\345\361\265;\276q\377p\333\312\275r}\304\315\325'\005L\022\305es3!\267\341\222\255\210\341\210\231dW\236'c\023\0015 \200\"!cma\344\350\341\030mp!\334\300\020\004@H\007A\004\201\352\365\200\246\234\251\341\364`*EH\231\360>&\340\251q\003\007\224\f"
+	.string	"\027\240\372\3412\256b\360\032\001z\230\205\220+@\203@qVD!\324\200\313\214\355\314\226\210"
+	.ascii	"\003\333\021\376\013,\270\343E\034\332\305D\374\323\300p\017"
+	.ascii	"$h\222\343J\217\rYv\224t+w\320U\341y\223\337\320\246\033"
+	.text
+	.section	.gnu.lto_.pureconst.2a8961e2997b7846,"e",@progbits
+	.string	"(\265/\375 )I\001"
+	.string	"%"
+	.string	""
+	.string	""
+	.string	"\f"
+	.ascii	"\231\004\004\200\004\005\200\004\006\200\004\007\230\004\b\230"
+	.ascii	"\004\t\230\004\n\200\004\013\200\004\f\232\004\016\200\004\017"
+	.ascii	"\205\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.2a8961e2997b7846,"e",@progbits
+	.string	"(\265/\375 \362}\003"
+	.string	"\022\205\017\032\260%\351\f\013\032\206\001\034\006\260$\311q\326\022\302Hkm\267\326H\223)\005\252\006\nat\024-\325\003\300f\332$:\362Q\027\243 vQ\257Z7\315\321\366\314\267\335\006U\260\306B\023"
+	.string	"NYd\241\221\247p\244\f\227\211\021I\2300\\\366"
+	.ascii	"\0312u\001\004\230\363\031\267\366\004\302@n`\213\313\276X\321"
+	.ascii	"\031%\270\r`\001"
+	.text
+	.section	.gnu.lto_.lto.2a8961e2997b7846,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_osdDevice.12.2a8961e2997b7846,"e",@progbits
+	.string	"(\265/\375 D!\002"
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001\202\200\200\374\342\203\246=\177}"
+	.string	""
+	.string	"\013/root/repo"
+	.string	"\035./src/main/io/rcdevice_osd.c"
+	.text
+	.section	.gnu.lto_rcdeviceOSDInit.15.2a8961e2997b7846,"e",@progbits
+	.string	"(\265/\375`^\b\r/"
+	.string	"JQ\024\022Hp\226R:Am\246\314\263\236\220\215\364<Xy\023 \004\355e\013\350e\200\312\013\221\004A\301\347A\300\006+\026\r_\245\266\303K\327\206\360\016{.\331\241\246d\317\237\372\301Y?\260^\210\364*@\377\223F\b\331;\311\r\001\363"
+	.ascii	"\032\001\b\256\372B\264_\023lY\303\336\204\251\315b?\265\036"
+	.ascii	"l\322\234\337\206\016=\023\247\2375\375<As\363b[td}97\205\276"
+	.ascii	"\266\204\366k\316\275\267\373d/s\272Y\214\023s\366\252\362\226"
+	.ascii	"3tA+h\2776\364=\354\327\366;\354\327\356\356\007\020\234:\031"
+	.ascii	"@\006\376\262\027\225\326\2273\264\210}<y\236\035\035b\016\316"
+	.ascii	"\360\306F\030\004\266?vU\361M\366\237\316\023\201\213\217"
+	.string	"\fM\227U\330w~\327\f\"t.\257\016\020b\016\216\016\260;|\312\201\335\033\240.+\256\333p\025in]\341]3\207\334\201\2124\271n\360\321\003uY\3758\320\306\333\027if\271\035\350\256\211u\177j\002)\334\231\3375\265\324\236*!L\2413\352\2623\206\316\345]\325\001^:\320\f\2352\324\237\272-Q5\234\313\253^\031v\254&x^\271!tB\251=v=\366\036\375\245r.\357\375Q\3109\367e:\255\336=\357\376\261\273\223\272\177I\001V\352\362.\234\031\273\035*\376:\026C\243.\013\343\257N\262\027\243@\373\002u\3234\316=\356.2\3363/\376\201\302O\335\237\373\224\027\375\260Vqt\317<b\277\036?z\242\\\222g\031\226\362N\273\241\313\213\277\272\217\247\323\351\264\261W\367\357v\261\275\035t\263\337\247o\363\004o\357\364m\235\337mb\360vN\337\306\371\335\036\006o\337"
+	.string	"o\333\364m\341\357v0x\033\030\274\335\002o\377\3726\333\336^\177\267\325\276}\177\267\357\200\311\216\314]\030\354\005\232\253\246j\362\2265n\310\337\376\270\277\355?\373\233\374kg\273\017w\271\026\3065\265Y\254\275Z\202Isn\256h\337\230\252@h\275\021\265g\353\273\375@A\363\323\265\262\326\376\344P\272\205\215<[\257T|O\262\234\263\020\331-\374\212\273\235\372hO{\264\205N\256\346\3645\030j^\313\001e\367L\034\254f\2544C\214\355\256\214a\335\340\257\276\377\355+\223)}|\312;\315!\222&\315\346BSF\032h)\331\022^\237\251 \337\273\334\0138\245\364\361Ee\\\341\005/=\273\323\2761c\203o\3605\343f\203;H\361=\313\314"
+	.ascii	"h\271B\002\204\241\346\3345\341m\027\222\022\363,\223\236\331"
+	.ascii	"p\301\225i\205\370\030\345n\367=\307\006\205\370g\206\230 \276"
+	.ascii	"\333\203\354\332\306\202\324\350\001\3711\261@\034@j\t\232\036"
+	.ascii	"\020\fSr\311\320\235c\226\251p=\013m\316P\021\372y\0310\2641"
+	.ascii	"\330\257@\374\263S\0333kq\277\313\361\2304\f\r1\313\374p\213"
+	.ascii	"o[\324\032%\207G;\264?\274AJ\354Yf\326a\224OU,\376\242;\033\340"
+	.ascii	"\236\355\321\017-S\301U\334\035B\304=\223\305+\210d4\322\031"
+	.ascii	"\370\351_8\222(W\003lP{\207\246\367s\003\354\212\203p\337(\254"
+	.ascii	"e\217x\026\022>y\335%\216\305D\233s\216pe\351DO^\330\013\354"
+	.ascii	"\243g\246\274\323F\244\013\244$\244\361\330\032\215\220:,)\261"
+	.ascii	",\216\210\224\214\027T\2708RR2\"o.\f\025\001\223\220F\020JF\344"
+	.ascii	"\221h\205\005\243\022\221Q\022\f\242\221\305Q\n\244\243\007\243"
+	.ascii	"\242\245`\02710B\"\2350\026\035-\031\215\212\216E\244\243\242"
+	.ascii	"\213"
+	.string	"#\242\026\305\242#\262\310@@#%\031\217E%$\244cQ\bU^\315\330\253Y.Y\324\242\354\374I\366\321\253fc\324\242\340\323\235\007\327\350n\036\334\024\224x\331Mgk\227\236\2519\347\314s\340\376\\\251\177*t\241\027q\037J\222H\322\310=\263\325\234\305,\342Cy\317V\030\361\214\227\227\235\035\314\203\207\266\203o\026\275\023\230\253K\242\243\203Q\240\261=mH\350D\235\013E\304\230\007\336\030\326\367\242\277\\T`O2>\tjtUD\240\320\024\336\263\354\r]\036\301\026\025\252\034\246\267\246\270\001yP*89\335\311#\227c\312\301\013\246\244\317\262!\016>\242}!p/\345r\311\261K9\334\320\245\037\342\356\244\222d\200\250\250q,\006\2214D#\022\210H\222\244\220\016\240\"\2211\273\r\020@\306\210\246I\007\311W\323\277\032p$\006%\222\317\362J \224\302\266n\313\024\005\030\305"
+	.ascii	"\322\363]\354\323\220/\321\200\204I\310\257C\377\274\206^}\026"
+	.ascii	"\377\331h\247\362@/\240\260\177}\b\021\361\031EZRM\006\324'="
+	.ascii	"k\215\305\327 \337a\225\261\004W`\330j\275U\266\301=P\363\024"
+	.ascii	"Gq\321\267\301\340\026Q\234\204JM\244\222\214\355\200\214pV!"
+	.ascii	"\370\r*\021\016\235\374)\030!Hx\311\331{i\020\212?\224\302\003"
+	.ascii	"\317p/\nt\300\313\343 \360.\210\327\217e\023\336@\2606E\325D"
+	.ascii	"\016\026\323\301\320\017\013\234\360\312\214\376\034G\243\257"
+	.ascii	"\371\r\306\201\206\372\310HKZ\347\001c\023Ake\362(\277H\217\034"
+	.ascii	";\367\243\303P?E\277\255=\253\370NB\037\r4\217\317\310\235\205"
+	.ascii	"\201BB>E\374\325Q@\262\026\243cS\005#\274\356\307'|\203\223,"
+	.ascii	"3\003}\350\036\202pi`\237\b\215\330]\246\241\211\226\275k\031"
+	.ascii	"\027\331+\013\031\346\332m\276\240}O\013\375\204o\212\272\341"
+	.ascii	"g\316\032\235nL\333\256\206Lf\363\237,\330QJ\336\261\002G\202"
+	.ascii	"S\371\223\3463\266\366\270\213\320\376\007"
+	.text
+	.section	.gnu.lto_rcdeviceOSDGrab.16.2a8961e2997b7846,"e",@progbits
+	.string	"(\265/\375`\n"
+	.string	"=\007"
+	.string	"\362\r36@o\222\016\230\265\270\376\211H\204\b\345\020\"\tI\0031f\234\371\324\024\373#n\306nj\356Td7w.\246@\370\257\341\260\314\017\003\005~\365\366\267\326\210L\001$\r.D|\032D\243\ft\215y@#\310\020\3022\210\020\b\323\036\314\336C\366qx\2306z\236\201\241(\244=\022\204\332\273b\366\r\332\231\240(>\226\034\305\361\255\222\332x\267aq!X\311\264\230\221\311\026+\345\343\337\376\372\353\276#%\331\032%\n\220\271q\202\222\031\021>\340\324:r\376\033R\221\355U\252\350q\252\306K\205ILf\276N\0054\265\252\006hjQ\035\335\352\266\333\222V \0300\246S\251n\243\220\231;\323\351\242S\375\013\376\204?#\t"
+	.ascii	"2\003\202aE\005\352\232\230b!J0A\300\211'\325\212I\230d"
+	.text
+	.section	.gnu.lto_rcdeviceOSDRelease.17.2a8961e2997b7846,"e",@progbits
+	.string	"(\265/\375`\n"
+	.string	"=\007"
+	.string	"\362\r36@o\222\016p\221\016\264\260C\031c3!D\022\222\006\302>"
+	.string	"C\353-\366G\334\214\335\324\334\251\310n\356\\L\201\360_\303a\231\304'\232)\224\331\337Z#2\005$\r.D|\032D\243\ft\215y@#\310\020\3022\210\020\b\323\036\314\336C\366qx\2306z\236\201\241(\244=\022\204\332\273b\366\r\332\231\240(>\226\034\305\361\255\222\332x\267\211i!X\311\264\230\221I\026+\345\343\337\376\372\353\276#%\331\032%\n\220\271q\202\222\031\021>\340\324:r\376\033R\221\355U\252\350q\252\006L\205\311Kf\276N\0054\265\252\006hjQ\035\335\352\266\333\222V \030.\246S\251n\243\220\231;\323\351\242S\375\013\376\204?#\t"
+	.ascii	"2\003\202aE\005\352\232\230b!J0A\300\211'\325\212I\230d"
+	.text
+	.section	.gnu.lto_rcdeviceOSDDrawScreen.18.2a8961e2997b7846,"e",@progbits
+	.string	"(\265/\375`\013"
+	.string	"E\007"
+	.string	"\002N36@o\222\016X\340\311\202\314M\361s:\230\263V\352?\214U/g\234p\230\035q3vSs\247\"\273\271\313\324\006\004*5\034b\245a@B\2016~k\215\310\024\"\r2Lt\036@\241\314\243\031\343xB\320\341\203e\022\037\017\246=\230\275\210\254\003\3610-\3648\004C\320G{\"\b\265\247\211\331?\350\246\242\262\3708rU\307\327\312\312\364\256!\003\345bp\312\304H\275d\313\245\022\362o\257\371\353\276%5\331\032)\032\220ibI\311\214\t#dz\0353\377\035)\311\366+V\374(\225#u\201\202\312\314\267\351"
+	.string	"\246\227U\001L\257\312\243[\335v{RK\004\344D*\215\352"
+	.string	"\0262sG*i\364\252\177\301\257\360o\004\t"
+	.ascii	"2\003\202aE\005\352\232H\305\002\227`\202\200\023O\252\025\223"
+	.ascii	"0\311"
+	.text
+	.section	.gnu.lto_rcdeviceOSDWriteString.19.2a8961e2997b7846,"e",@progbits
+	.string	"(\265/\375`\322"
+	.string	"\245\013"
+	.string	"\006\226O@\020Q\225\016+\004\024)\250\005Q\207\360\204\242\343\030Y#'\f*\314kL\362\025M\331\200m\310\256\274\217 \203`\202\216\316i\002P\004"
+	.string	"B8\245\001\234\310\222\302\333Z\221\206\233%[\312\224\002:"
+	.string	"C"
+	.string	"6"
+	.string	"\016'\266}\326;>;F\fE\240\256rqRqcw\263\313\007D~\305\013\210\374\322\020\377\236\237\377\025\217%F\330"
+	.string	"Q\244\247D\263\273N\020\345\341\326\3336`[c\037B\232>\005\353\230\201\251\261\333\241\205cC.\030$l\1776f;\202X `Y\r)L4\370"
+	.string	"\301@\323N\240\340\273\007\206[\326Dc\303\202\247\375\023G\361=\314\360"
+	.string	"\273)\031/vC\004\306L~\005\366\207\313\203\276\234\224d\237\305[\210\374\225)xy\320S\312\207KS\037\365ZY\265N9J\331\262CR\252\312~\\M\331\007\371%\367\370\257\177\374\361J\253\2463\036\217(B\034\375\302C\035\347`\264\221"
+	.string	"\3626\016f-\303\361\270\007\035m\253\320\341h]\306m\331\204m\363\311\264\316\3132\005\314\201:]\026\342\270.\303\302\275}\340"
+	.string	"8\260BJjr%%zMU\r\025"
+	.string	"2\003\3020\261#v\323B\\\254\030.A\2039\226k\270\bl\300\253\005n\205\302``\200\013\030\007\206\361\031"
+	.ascii	"\030!P\341\340\356\223j\305$L2"
+	.text
+	.section	.gnu.lto_rcdeviceOSDWriteChar.20.2a8961e2997b7846,"e",@progbits
+	.string	"(\265/\375`\334"
+	.string	"}\013"
+	.string	"f\226N= O]8p\001\001b@\007\"\325e\221\261\032\324\2502\270\365\363I\216xeu\275\255\261\255\273!\302b:=\355^\004h"
+	.string	"\304xEf\215mF\t\230\211bt\315\242\233\b\2212\245<"
+	.string	"@"
+	.string	"8"
+	.string	"\307<Bl\373 \036\"\264U\\c\007\321I/B$d\354\35669\200\354\330\365\216\354\230rx\370\f\375\227\370\365\301\244\022E\236\347\203\301\356:E\021\206[o[\200\355\005\3661\001VM\247\246/\321b\260\240\250v/\264f\354\nKa\262\035\332\232\235*)@u\276\261\240\026\032\022h\332\006\016\204?u\254\273\033X\b\236\366E|D\370\261\3029vG+P\354\216\005L"
+	.string	"\022\021\362\242'!\365\3307\361\023\023\374\222\301M^\334h$\303C5\323\324cz\225xp\021b}\262e\217\236T\222\375kw\327:\262\177\372\037G\375\331S?v\245/\315\3349\247p\315\3475\340T\036d\300\316\242\231\243X@\317\301\205\353$\\,\334\267y\335\006\241\253`6\356\0037J"
+	.string	"{\231\313\267i<\357\333\264qo\017\270\206\005\030\253\217\202\034\311k\252\352\245\266\027\025"
+	.string	"2\003\3020\tXl\255\205\360X1@\030.D\2039Vp\215\251\232"
+	.ascii	"A\0210\016\f\f\360\bF\360\031\026\314\025\250pp\367I\265b\022"
+	.ascii	"&\031"
+	.text
+	.section	.gnu.lto_rcdeviceOSDClearScreen.21.2a8961e2997b7846,"e",@progbits
+	.string	"(\265/\375`V"
+	.string	"-\t"
+	.string	"v\322A9@\217\322\001pG<$\001\0235X\317\001K\210\013\222x\007\322\250O\241\244)~\203\254_Yc7w4\2654v\200XK\004z\013\362#\365\r\347\361n\215\354\275wJ\0011"
+	.string	"/"
+	.string	"/"
+	.string	"\254\031z\234\236rU\254`v\267r.\200\235\316\007`\247\262\343\337\343\347\277\344S\245z\001O\245\307\f\302\356:\202'\214[\3366\201\355\003\333-\001v\214\376\334p\260T\227\335\213\227k[T\005\304\366gg\266\037\355\217\234\344{8q\200]\324J\312nh\340\002\315\251C\215m?\344\"\237\035(\377\353fa\235w~i{\017\361\240\347j\310\222}\223\237H\370\037\216 \305\203\247>\t;\275TX\305d\230\342\313\016KQ\246\354\317\225\250\243\216K }\030D\336\006\312\254y@\036\267\020\3226\210\020H\353*\267U\207\355\323P\265\316\253\236\001s\242PWG\034\327\325,\334\333\235o,6Z&I\341L\344<\n"
+	.ascii	"2\003\302\260m\210\032\260\204\350\032>\306b\224`\202\200\023"
+	.ascii	"O\252\025\2230\311"
+	.text
+	.section	.gnu.lto_rcdeviceOSDIsTransferInProgress.22.2a8961e2997b7846,"e",@progbits
+	.string	"(\265/\375 \377\025\007"
+	.string	"\"\21635Po\322\030\340\331\f\"\\\245\034\024\301\035\"\314\256\340UQ\245\325;~X\004\271p\226r;@V\204f\214\233\351\206\002\305\031\002 H\316\r\261\210H\333[\246\036M>Tp\":[vU[\233k\223\020\230\225Q`\227\245E\231\305\211\214#\021-m\213\033\202e\007\323\242GJ-Vs\265\243\n. \306\317\317\203\037\257\231\335\335\241\350\337F*\2714\254\354\202b`\226eR\t\371\365\347\276\372\337{\035Q\022NK,4`W\364B\332\235\t#htz\352"
+	.string	"\245\223F\005(\235\376\025\026\270;\235  \035ud\234\224vg\204#\355\364u\253\232\250\201H\212G\013J\350\243\017\300aw\177\032\241\r\035\352\177\3603\374\034\001\006"
+	.ascii	"2\003\202\341\243\302b\025\020w\031\363\272&\031"
+	.text
+	.section	.gnu.lto_rcdeviceOSDHeartbeat.23.2a8961e2997b7846,"e",@progbits
+	.string	"(\265/\375`\n"
+	.string	"=\007"
+	.string	"\362\r36@o\222\016\230\016\303\317\252S\260\360M\t\007F\200.\022\306\277\245\251)\366G\334\214\335\324\334\251\310n\356\\L\201\306v\001\207e\236&\344\330\351\343o\255\021\231\002#\r6Lx\036B\242\354s\215u>\"\350"
+	.string	"\3022\t\320\007\323\036\314^D\346\201x\230&z\235\202a\b\244\275\021\204\332\273b\366\017\312\251\240,>\222\034\305\361\255\222:\275\013`\201Y@\311\304\230\221\311\027K\345\343\337\376\372\353\276$-\331\032)*\220yrI\311\214\t#lj\0357\377\025\351\310\366+U\3640\265C\343\342$&3\037\247\004\232ZU\0074\265\250\216nu\333\255I+\220\220\226\222\211T\007\300\220\231\273\222)\243S\375\r~\205\177#\t"
+	.ascii	"2\003\202aE\005\352\232\230b!J0A\300\211'\325\212I\230d"
+	.text
+	.section	.gnu.lto_rcdeviceOSDResync.24.2a8961e2997b7846,"e",@progbits
+	.string	"(\265/\375`\235\001\035\017"
+	.string	"\226\333bD\360\224\223\016hJ\031>\355\372\032\\\3055\302\266\n\026o\332\345W\362\013w#\n\177Hb\316i\036\265\317\300\267\261\300\004\\Y\222\350\372%N\326f`SH\rg\231\305\201\273m\n\266O\311\337{K\231RM"
+	.string	"H"
+	.string	"V"
+	.ascii	"\207f\035%\036b/\020\017m\262\203\234u\263\237abF\307\310\356"
+	.ascii	"fZ\342\246\303\247i\362\237sP\227\2129\254\371\003\220\252\271"
+	.ascii	"\276\0046= NR2\017\3055\002\310s\236\035R\250L\223\007\273\353"
+	.ascii	"\354R4w\274m\t\266\033\330\211\005\376K<\274B\036=GB\234\362"
+	.ascii	"e\263bRI\330\177\273\273V\225\375\325\017\322t\3244\324\364\313"
+	.ascii	"\264f:3\375\023\0014.\007Ev=\274\222l\013\362\240\b\331~\332"
+	.ascii	"oq\027\246\257`N`Wucg\227\265\300\n\260\372\231%;\230*\b\325"
+	.ascii	"\203\305*\325\266p\033\006\336\375\234\362U\203%\025\n\331\001"
+	.ascii	"\003\320\320\2218\210\270D\274\001\347\242\275]\006\207\355."
+	.ascii	"\003_g\005\303\201\033\034\230xh\242\302g\305\220\237\350lZz"
+	.ascii	".^)\304\370!\223H\354\2778\f\316\307q\206\227|w\030.\245-\302"
+	.ascii	"\006\225\225\026N\033\205,J\031q\333\004\222H\323@\032\211J\331"
+	.ascii	"\246e\0274\025\226LT\342\262\024\004\336ZH\245\314e\333JY\210"
+	.ascii	"\265\177\253*C\370\320:)\312Q}\236\347 U\320\362\235\026\017"
+	.ascii	"\323\247\373\201\3724\352S\302!\005\nj\364\241\372\002% \220"
+	.ascii	"\002\231\311\352\001C\241-\022C\314F\265I<|Glb\366\272\331\217"
+	.ascii	"\031\002\024\216\225a\211\334\005k2W\202\252\2734\326\"\366f"
+	.ascii	"\264\324\016\227\261nX\306B^-\370\\\021\274\016\276\206-\210"
+	.ascii	"\375\005\033\020\254\r\315g\312\340\345\256\311\247\272\032\255"
+	.ascii	"\337\003"
+	.text
+	.section	.gnu.lto_rcdeviceOSDTxBytesFree.25.2a8961e2997b7846,"e",@progbits
+	.string	"(\265/\375`\021"
+	.string	"u\007"
+	.string	"b\21645PO\323\001 ;\005\270\215J\226\262\231\007\331\274\365\f\346M\245\317A\206L#\366\030vgo`n\223\006\342f\\\033\025\234!"
+	.string	"\261\224\363\f\302\254\033\331;\245\235)\027<\233\006N\206Y\224+\215\225I\206\253\302 .\253\232Qb\361\001\3338\304jfQ3`\311\271f\354H9#E\367\366\245\326Z\277M\031\t8a\323\317\203\031\366\243\205 \373yTXV\022\272]\213\332\262(\322\311\206m\315\246l\277g\377\343 \332i\304\001vA)&\273\364\300\006\230K\246\030\333~\307=4o\021\325\340\246\221\022\n\021\226]\0323\027\230.E\017\230.\301\320\267\277\315\177\310\t8:\214\216\204\373\374]\024v\327\257\202\273\270\341m\027\330F\260\035\n\t"
+	.ascii	"2\003\202a\226\n\3265\221\212\005.\301\004\001'\214T+/a\222\001"
+	.text
+	.section	.gnu.lto_rcdeviceScreenSize.26.2a8961e2997b7846,"e",@progbits
+	.string	"(\265/\375`\217"
+	.string	"\365\t"
+	.string	"\206\223E<@\305\270pu\321\374\232\225o]_\353B\310ZK\201;\324\310\374)\024\257\247B\362)\332\336Z\235\033c\265\333\332\327i\264\242\303#.\f\240\001\347R\f>$w\"\"D\312\224\0024"
+	.string	"1"
+	.string	"2"
+	.string	"%\242\375r\215\037\250\253\002\230V\020\354.\2279Bv\354\372AvLU\027\237\242\177\224_,\223\001'\324\350\251=\354\256\363\204\352\270\365\2665\266\033\354k\002\2762\255\232\316L\177+\030)\340"
+	.string	"`\227\243\305Z\002\230K\210m\321\306\330~\332_\375D\374(\272\301nJ@\313\356\270\361\302v\314\343f\333'y-\253^\025gQ\335\\SoJ\340\360*\026\333\256\006\203\237\002bl \307|Qv\354\232``E\312\226=\216R=\354_\253)[\323\332\307?\323\f!\360\203\310\350H\200B\317\203q\307\361\204_\304\247\363.>\236\016\344>\217\243\360:\023\\\007\206\034G\301\037\350\003r\241\357\0039\314\270\2675\315\220\264\344KS5\325\003\033\"\245\f\016"
+	.ascii	"2\003\3020#&`\260\271\247\222\253j6\245\267\016\215e\256\341"
+	.ascii	"\320\262\200%\230xp\367I\265b\022&\031"
+	.text
+	.section	.gnu.lto_.symbol_nodes.2a8961e2997b7846,"e",@progbits
+	.string	"(\265/\375`\\\001\025\b"
+	.string	"BL.3`m\322\001 \322\035\262C\322<B\030\322\334\251\367<\341\226vp\020\004\001\215R\275\004\343\245\210\0215uwwk\204\220\275\330\035\340\325Qo\"\267L\001\006e\264\273+\rhF\001MH\005h\005\323b\022I$\253\023I\t\217\020\013g\255\304\364GE\306\210\263Rb~NJ6\236\025"
+	.string	"fj`p\204\236\025\224:Y#nA\274\363p\215\3037\r\347\344\356\332\026\303=\271\300\332\207\240)<\223p\f\363\0344\353\227\316+\316\251\315'\315_\346\016s\351r\013\213vw\253#0\312\240\351N\224f;!\305+h\241\355\260o\203\\\244^\327u\271W\230m6\021\035"
+	.ascii	"\020$\023eX\003y\006\003\324\003\200\003\200\003\200\303\007"
+	.ascii	"\b\027-U\241\302x\330\254\r\004g\215\301\3250\200\036L\373\244"
+	.ascii	"m\206\001\350\001\276\001\276\001\276\001\276\001\276\001\276"
+	.ascii	"\261\363#V\365\003\206`\211\337\006s\f"
+	.text
+	.section	.gnu.lto_.refs.2a8961e2997b7846,"e",@progbits
+	.string	"(\265/\375 O\305\001"
+	.string	"bD\013\021pM2\034\374\177}\254\3307\244\026\\\026m\"S\023\n\r\220\233\306\224A\247\202\016R\025\235hD\037\246G\033\246\006)\240\353\362E\002"
+	.ascii	"Y\205\260w)("
+	.text
+	.section	.gnu.lto_.decls.2a8961e2997b7846,"e",@progbits
+	.string	"(\265/\375`\016\037\035\214"
+	.string	"\312\340\b2P0RJ\352\252\271\2672\033\261\225}\223w\261\363\267\333}\001y\245?\225\231\356\"2\237\324Q\0251\315\f\333\365\311\226x>G v\210\030\205R\337%\f\002\252R\242\212"
+	.ascii	"\253\224\250\252*\313N\211l#\252*\253KM\3377\222 D\312\224R\273"
+	.ascii	"\002\371\002\035\003<iF\2700\375\365\273\317\375F\177\223\337"
+	.ascii	"H\0013\347\343\033{\332\344|\354qW\300]\201\2735\225U\245w\373"
+	.ascii	"W\354m\200\332\335\350\214\251\271\311\372K\202\013\367Cag\272"
+	.ascii	"\211^\t'\321\363:\240v5<Z\306!X\177\r\370$\334\300Es\022=\237"
+	.ascii	"\3663?!\326\274!\237S\0248y6\326ef\316\351\202$\265\376v\373"
+	.ascii	"\234\\\216\334\033$o\376\226\311ysF\346\030\004n\027\343q\036"
+	.ascii	"u2^\326n\346X\332g\3159\231\305\341\254\327\322\307\204\224\345"
+	.ascii	"]\335@d|\212\207\331\3259\302\021\254i\316\231\214\2139\331\005"
+	.ascii	"GK\337\016\270+\237\024)R\204P\243E\311\005\3377\037\237\217"
+	.ascii	"+:`\301\341f\321\r\344n\316\305}\260^K\234\305\210\3344\347\025"
+	.ascii	"\250\335\315\277x\233]\315r\022\331\246\001\0252\262'\273\234"
+	.ascii	"\327\3660\036u7\367\322w\315)R\370\340\350 \346\246\251w\035"
+	.ascii	"\214\257y\024\205\263\265k\361-\315;\256y\375%n\304\250<q;\212"
+	.ascii	"\236\275\273s"
+	.string	"\024\275\366,\334.\345j:a\226Pye\354h\336\305\243\236\326\355=\370Y\337/f\206\346\274\206\260\307\037^\312\376\266\377\364z\374\247\327E\370:\211\236\b7\321{'\321K`\006\3143\203\201\314\257X\245\022s\035a\321\230\324\226\374\265r\243\306\264t\371\333(\340\250\217y\2255\373\354\0201\022\005\367\267A\300m\001n\017\353\366(.\305\2452\344\234\3149\013\340;\2634\333\341\257\1779\025\217\032\340`=A\005m\215_\271+\347\265'\304\033\2557l\376\366\n\334\016m\022_\271\202\366\341\276s\003z\276\002\265{u;\227w\221\350-\241\326\034\226s\356qi\017(\266\277\036<\276\331M\364z]\335D\017;\211\336\n&\220\351\366\030V\350\266\036\b\261\300v[\026\215\273-\333\230\316\351\266\ft{\232\030\271\226\321:\335\326\004\022\307\332\273n\327\212\353v\016\272\035\356\215\305W\267/\320\355"
+	.string	"t{Y\230\356v\023\323\335og?\234\350n\024\335\355"
+	.ascii	"\r\267\020\272\373\201\356\017\363\335/\246\333\333\272]\255"
+	.ascii	"\333\265t\273Y\267K\273}\253\333\261\272\335\252\333\225t{U\267"
+	.ascii	"7\273\275H\267\013\351\366 \335\376\324\355N\335\276\243\333"
+	.ascii	"\221\335n\354v\034\272]G\267\323\320\355\305n\037v\373\214n\227"
+	.ascii	"\241\333[t7[w\227\351v`\267\327\350n\260n\037\352v\241n\377u"
+	.ascii	"{\007\335nA\267\243\350v\007\272{\332\335r\335m\246\273\347\272"
+	.ascii	"\033\202\356V\353n\236\273\273\273\273\3567\353\346)\273\005"
+	.ascii	"\250\naGy\271@\316R\314e\334\021\210\233!\327\230\220V\216L\037"
+	.ascii	"`\t9\305\314\3115\245\023f\316N\2206\362\022\005\306u-'\3615"
+	.ascii	"#\225TV:\312\231\200\245\234\215\236\327r\316\306\2343\316Rj"
+	.ascii	"\3159J\204\322\271\264\2243\224\317R\2262b9\312\371\303\306\230"
+	.ascii	"9)\241SL ,`PgFZ\215\356\314q\315%\206\032\275\262R\316\331\323"
+	.ascii	"`\247\323\023\2321b\270zTY\371\260\260y\342#\016\356\330\205"
+	.ascii	"\374\361\326;rg\264\345o\367\220x\355\332ijZ\302\374\301\315"
+	.ascii	"\227\205t\202\332,oD\326\264\261\311\001\231k\363w\315\027v\344"
+	.ascii	"|\002\201\273\202*[\323.+-w\002\251$\201\207\347\024M\230Kyl"
+	.ascii	"\316D\272\234\276E\3149\367\305\316\353+\f\355\325\276\313{y"
+	.ascii	"\037\036\314\367\360_\236\213G?\355\263\364\237\275\2263*\017"
+	.ascii	"\306d\312t\335\262\234\373b\367i\177\345\261\234@*a\020\311\232"
+	.ascii	"\246\375X\266p\313\271/\317\234\327\024>K\316\242M%n\363\256"
+	.ascii	"`\367\341M\301b\346;\242j\036W\2362\246d\020_\366d!\3368i\223"
+	.ascii	"\372\333\274%\270yT\270yCp\363\240p\363\236p\363\230p\363\222"
+	.ascii	"\360\203\375G_\332\017\366\320\235\344\203\335\234\217\356\n"
+	.ascii	"\360\270+\300\333ru\244\322\273\315C\342\276lp\3373\370\307M"
+	.ascii	"\364$\370)]9ciL,\266\2208\273^\313\245G\2220\255Q^\212G\277\353"
+	.ascii	"\271V\027\003R\345\222\341\276Tp\337\254\347CIF\341\261\376\345"
+	.ascii	"a\355\211\255yq\375\355\333\304\355[v\370\253\247\030\226K}\r"
+	.ascii	"j\203\255)\323\n\230|\222\277\3421\256\271\t')\267m\331\345\234"
+	.ascii	"\237|\223w\342\321g\362Y\375NG\323\236\302\007\307-\251\321\341"
+	.ascii	"\3337\211\255\032\334v\f~%\277\304\243>o\325\206d\222r\3038\344"
+	.ascii	";\367\351\265MCb@\317\372c\211\352\217|\325\365\341\204\016\310"
+	.ascii	"_\346\033y\252\037\362E\276\371:\374\324\023\361\350W}T\277\220"
+	.ascii	"\227\352\373\312\252W\372&!\323e\024\324\322\373\350\006\372"
+	.ascii	"\361O<I\0219y\244\311\231\363\n\204\tM\225\003\361Hvu\262\200"
+	.ascii	"$5e\321\303\245<F\021\031\t\007\345d1A\005_\365A\\jW'\216\364"
+	.ascii	"\210\322'}\325;\375\223T\032$\005\2463\022\202U\342\246Xs\023"
+	.ascii	"=\236\225\225\202\333j\341\266Mp[%\270\255\016\270\327l\217\237"
+	.ascii	"\347\341K\256\031\352{K3$\354o\333\034p\333#\356\247\303\375"
+	.ascii	"M\335\277\343sxc\016\024\212-\351\357/\001\3653\335\251\321\223"
+	.ascii	"\232\277\030\304ak\346&z\031\204=R\267\247q\272?\322\231\342"
+	.ascii	"\324|\363\367\215p\032\253\244$\177\373\243\030\351\321Oz\020"
+	.ascii	"\355Ig\363G\273:E\220*\247)x_\246x\030ro\377\261\333\355|\315"
+	.ascii	"\033\003\366\313R\331\201\242f\354\212\212K\337\315\213\022\362"
+	.ascii	"\257\365:\242C\312+\216\017\3224k\253\235\302EIV\220\277V\312"
+	.ascii	"\330\232%5v8\312s\375\323\027\224(0\270\235\355\264[\376\225"
+	.ascii	"\233\\J\306\004\365\363PHk\260h\265\335\262\202\003\253\373k"
+	.ascii	"\237\330\347\275z\3424c\237\026\nO\323J[S\231\373\325E\312\224"
+	.ascii	"\345\301\313z\214\226\315\346_\353\304\245Igl\023\227\372\232"
+	.ascii	"\216\342\276\374\265Lv\200bE-\326?}\020\226\217N?\\\214K~\214"
+	.ascii	"\270Z\203\362\267}OV\355Qk\345r$\254\331\250#\306\271\204\240"
+	.ascii	"}H\213\304\"\261JH`\303\323\362\246\f\313&i\253\204gI+-i\212"
+	.ascii	"\251\250lU6\236\371Y\343\254C\263\363}9\221\0013\322\266\352"
+	.ascii	"\251\207\305\207#J\270\013n\313t\333\214\332\246\267\375\232"
+	.ascii	"\2279I\246uhvx\f\3335\367\266\336\220!\266\210Cq \275\232\356"
+	.ascii	"\230\261A\223#\322\266H\317}\026\267(]ZB\204\374\335\264\016"
+	.ascii	"\355\251\223\354\341\306\205\312\207\017\033\204\270\254C{be"
+	.ascii	"(M,T\333 \316\026D\364\310\002\341aSb\"\304\002\261?p\330\266"
+	.ascii	"\256\330\340<IBD\315\337\306\311\247\247\277\303\3066\316\036"
+	.ascii	"sj+JNI\311:\205\211s\3326dO\257e['\235\270\037a\312\376\332\246"
+	.ascii	"\236 \314'\257\277\226\t\207\307\016QQ\177\355R\016\0313jYxS"
+	.ascii	"ue\312\320\254\2215\262;^p\326\241=1\222\251\335\321&\265\335"
+	.ascii	"\321\323\244\204\362\327*\337\215\316\225*,L\177-\022\2174\355"
+	.ascii	"\251\303_{\344R\035\256\036bP"
+	.ascii	"\306\364@a\223\303\233\027\022y\327\263k\373\222\227X\2435\376"
+	.ascii	"\235\333\032'\317\031\023#lPA\004\361w%\242,\245~p\236g]ro\372"
+	.ascii	"\357z\213\007\314\036V\334x\020\260\"n\332\364T\035i\003\262"
+	.ascii	"\226y\316\336v\364`\363Yp\220z\3105\371\3338J\254&s>\020\376"
+	.ascii	"j<\372j\\\352\263\201\231\3304/W\b\272\327\006\037\340.\355\265"
+	.ascii	"k\371\323E\237\316\347|\326\314#'\311\022\r\202\373\304\003\315"
+	.ascii	"\0314\270\237\314\227\351\227k\271G\203s\316~\265\326\241\331"
+	.ascii	"e(\250\237\2367(I\304\316\364\243\001\333\311'x\220\3402"
+	.string	"\364o\003\361\276\313\305f\204dj\246g7\005\246\t\0179;\332\326\216\177\177\356\263\300\030u!A\333{\371\270\3149\363\340\255y\211\334i\347\271\377t\207p\3337\347\033\326l\204\263\242\303M\312\216B:\201\334\274\265\234\223M\343\007M\247d\023\210\022\332\314\306$\226q\30427\215Jh\316#r2i|\301\314#\224\320\354\224\215\332\234<\257McN2\363\210\234\314\307\004\224\311\246\223\022zt\032\241\2046\2352\264\231E\344\344q\231\224\314\313\021\031\332<\223\241L'\021J(\323I\tmJ\371\2302\315\323\351\315jj\314\317(\223\231iI\352\270\024\261\246\\\2319.g\017\303\237\r\027\003\020\375\212A\241\r\300\241\220\204\006D\024\325\021N\024}\202B`\rU\005\"\"\240\bED\340\013\002\332\206\212\022d\300\210\261\242\250\326\030\376\212\t\314 $$r\241\016\205.b\364\274\210\201B\017"
+	.string	"\252:\024\201\250\026k"
+	.string	"A\207\f\241`\rDU\205\021\305\237:\2438\374\251$\020\211\352\260\206p\230B\020\306P\245A\f\376\2062\2100\020p1\374\331pQ\"\200\240\252\016\205b\320\360\033\2760\241\022\177*\221\252\002"
+	.string	"3~\303\021\2027p\020\t\205t\206\210B_\003\2030^\304@\241\247\205\200C5\250\326\300MA\213\bZ\\\240\003\247/\310@\202\f$\350\365\005\031"
+	.string	"\001e\320\002\bw\013 [,\266\r\025+\200\303!\003\212A\034B\0273~\303\032>bP\bb\020\0135\374\210\212\210\300!\022*\321\214\237\214\034\275\036\221\006\341\360\022\211\204B\327\205\027\210\302\242K$\024\202\020\304\033R\207?\225H\b\207\006\241\nC!q\210C\310G\fR\211Aa\021QU\241\b\034\266\240\016\t]\024\211p\020\325a\016\361\206Z\204\201#\250\232\240\026\177CE+\f\251j\220D\261m\250\030\022\312\261\242FQ\211\034\230\030\244\022\001i\b\207)\f\t\345\330\271\241\026\2115\020\203\204\352\0200\307N\257\250\022i\320\020\006\331\300\304 \"\340\257\250\276(@-\252\241xs\360\202\300\033X\307\357\006.\006\2017\200B\352\320N1h\002\026Ej\221\210U\033\2001b\350\370\335\b\241\342 \372\261P#\b\034\026\211:\305\341\317\206\320\275\304 \0315\202\300bQ\215\261"
+	.string	"1(\004\026\205T\"5FQ\207Z\344)\266\r\025\003\264\260H\035\256(\n\205\303\025:\305\240\026@\230\250\016q\024\177*\rL\f\022\322\b\302"
+	.ascii	"@\r\312\021T@P\b$\016U\026\210\204B\302\242pX\324#\244\021\004"
+	.ascii	"^\342\213\033?\241 \216!O\221\030\264S\034\nS \372\001\207*1"
+	.ascii	"\247\030tA1\b\304\201\323\030`\340\"\201\025N\030\001\013\251"
+	.ascii	"\030\"\n\203T!`\016uHh\270B\b\\\021\004\376n\254\020\032\022"
+	.ascii	"W\25081Ti\320\3001\243W\306{@\214\330\214\221i\323Y\243\344\t"
+	.ascii	"\2101jO\276\240[\304l\355$9\255L\211\373\301\255\352\334\312"
+	.ascii	"\300I\357T\017\257\26373\235.HfTa\264`M=]\371k\245\2540\260\346"
+	.ascii	"\246\374"
+	.string	"\365\342\305\266\271\210\025\tW\346\304\331\212\362b\262\265m\263\300\n\214\224\277v\315>C\240\221\032\221\376Z0_r\314\364\320\203UC\363\025Q\342:Kk\253\206\023V\246\371\374k\273\330g\316\026\256'\311\277\026\215\213X\226,V\313\026\323\326\223\307\356K\214\352\254\255\026\031\264\350\252<\233\316T\025y\212\265\2305\363aZ\270/L[O\333\025\027\205JY[3K\346F*\312_Kf\237V\250dI\377\332+\367\n\0311f\254\374x\"&\312Z\261cY\313\030\327[\017\tW\322\331\337*\0375\304\3154GHW\227\225\036\001\243s\225\245n\r\254\2554g\0077\257\255\2776j\237xMR\005\252\023\255\242\344\356o\202\220\250b\351,\210\002\0252J)\021\231\221$I:\262\n\020\006cI\036i\252\007\022\200T9\021\"\346\024\221\210\244 EI6\016I4\232\34311\004\223i\n\237\220"
+	.string	"q\354X&\260i&\336\265B\207R\217\200w%\261Ky\226\222*\320\224\236\032\200\310B\327\356A\354\276g\354E\237\332\\\016$\316\223\002\320h"
+	.ascii	"\256\275\207b)\270\313"
+	.string	"~u\0210GQ\255\247\007~\016\375i\342Z\324dN\367\032\300\364\364c\250\005\311C\313\222\316\217\225\343\261\211\037\356\310R\020\036'\351\001\252\177$\302G\033\026\f\244\202\303r\b\320\2409\007\333\241\013\236r\204V\214\230\331\203\260\017\353\240b\244\204\364K0F\255B\027\214\363\240\305C\235\004G\302\343Q\277\030a\336`\266\3569\006\236\312*!F'\203J\266\300Y/5\030z\337\246$\347\270Y\032\034}!\361\230\274jF\205*h1i\004\233\367F\001\276\375\263oI\252\224+@\345\017\326\003\347(5\377\003Yk\301\366H\271\230@cL8\332\243\\,\270\007*\302!'\0356\244\273Te^i5JL-\233\307<@\232\320I\234t\320\207N\364\367\033F\336\321\367\200\001v?\264\205\347j\022\266l\352wA\2033\355m\277`\324\023\206X\022)2g\315\363Q\332\330m\375vd#|"
+	.ascii	"\261K\272V\213\2216l\357\242!\022\320\257%\227\352\242\032[\257"
+	.ascii	"\22782\245\202\351\3005b\206m\260\241T\264\0263\254\"\226u\233"
+	.ascii	"\215\202\262G/\2652\347 Gh\244^v\274\241\264%\222O\240\022%\300"
+	.ascii	"\304\004\033\357\250\311p\b\250\221G\345#\007D\002(\244dDUp\312"
+	.ascii	"RO%\275v\230\312C\356D\033]\312U\024\332\252\312\350\204\273"
+	.ascii	"!\342r\004\257\345\200\360\251F\347\222s :\277\001\304\b\303"
+	.ascii	"=6\3272\302\022\352\344 e\344\031\327j\210fye\310`\255\254\304"
+	.ascii	"\226\215l\365\020N\222\223\320\310r\233\2677\271\327\t\243\360"
+	.ascii	",-#\212~h\371\255w\343\206\346^\277EA\221\305\300r$\r3\216B\363"
+	.ascii	"y{\200\254pF\r\362\002\263B#\001`\230Zt\257i\374\355\263\242"
+	.ascii	"+\360\326\361\033\212f\325Pw\034]\323.!\235\241A\307\226\353"
+	.ascii	"\345\273\221\270\236m\222\356\212~)\240x,*\237\315A\032P\221"
+	.ascii	"j\222\004\306>\262\212\241S\242\311\372P#>\f1\234U\314'\270z"
+	.ascii	"`\374\037\232\037\234d\020SF\211!\n\343\224\204<Kw\314\3569\270"
+	.ascii	"\266\224\005\244\341l\251\274\224\360N\025\035\207\217:F\316"
+	.ascii	"\301\210\313OD\366\377\345F\233\227r4\374\253\270*H\226\246\216"
+	.ascii	"wY:\216\335`\221\320\232\214\326\263\270\032\312v\373\277\326"
+	.ascii	"\017\203A\223\316\2465\327\021\205\243hGb\305\352\377\256\352"
+	.ascii	"\247\200\374p\270b\312\007\020\357\312\260b\034/\266\365\342"
+	.ascii	"\002&\330E\013\034G)*&"
+	.string	"0\260\035"
+	.ascii	":\266<&6\223\357\335\013\213\365pw\033a\3520r\n\3309\035\373"
+	.ascii	"\334k\362\236\223\350\3674@\353\"\366O\022N}\027\024O\325z\256"
+	.ascii	"\257)e\271\223b>\237\300\367\355;\001\032\037\007\032\367\237"
+	.ascii	"e\200\037\360\f#< \340\n\257\256\001\326U\317\330\"4\202\364"
+	.ascii	"b\";\025\343-\226\254\243\320\321ZgD\023\f\344\220\223M\263\230"
+	.ascii	"D\2275Ea\235O;\0073\314\322-8\031\031+y\264\310\311\232\201\306"
+	.ascii	"\t2\362 \313YAib\236 |E\361\025\206\0054 \221\335H\237\025\257"
+	.ascii	"\365b\236\301\215\\w\251\030\004c\022a\2239\242\2104\264\351"
+	.ascii	"\016\035aE\035\314\213\314-\204\317\016ot\3230\347=\301\013\343"
+	.ascii	"\353|\250\341\20020\314\204/\252\373\006\\\214\351}1\201\256"
+	.ascii	"\017\030\326*\025\337?\013\027\362\347mzU\317l\\\2444\272\256"
+	.ascii	"\007\200\301\242\226\317\265\313g;@\317\327\3704d\312H\331P2"
+	.ascii	"\264\356\273\020\231\037\235\266#\376T\260\315\312M\313\350\321"
+	.ascii	"`$\025\025TB\006\013S\232\316\3563\037U\f\347\210|5\3546\341"
+	.ascii	"-s\224\234N\250x6\036\036\337V\0265N#\323\216q\017\242\003\324"
+	.ascii	"*q\216P\224\260\033*\374\235\241\0377\001\317\300@\016p\311\222"
+	.ascii	"\332r\374\271\377J\337\350\016\340^Y\007\362\303\350\210\314"
+	.ascii	"\031NH\\;x\246,\311<@h\b\177E`\250\367@b\006\275\347}C{f\257"
+	.ascii	"\221m\001(\207\260\023\272\277\354\326\314\364{\222\005\220^"
+	.ascii	"\256\326\225<\221e\"\351\225fm`D\326\345\n\352?\020^;\202\254"
+	.ascii	"\200\001\035\201\355I\2742\275\200\362#\273\347pp\374\346\365"
+	.ascii	"\315_\304\355[\330Xc\036|p\341\225\350I\377\313>\001p\356\265"
+	.ascii	"e\357\335ZMo\372\374\237|9\254\371\352\f[\001"
+	.text
+	.section	.gnu.lto_.symtab.2a8961e2997b7846,"e",@progbits
+	.string	"rcdeviceOSDInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\001"
+	.string	""
+	.string	"osdDevice"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\001"
+	.string	""
+	.string	"rcdeviceOSDGrab"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\001"
+	.string	""
+	.string	"rcdeviceOSDRelease"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\001"
+	.string	""
+	.string	"rcdeviceOSDDrawScreen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\001"
+	.string	""
+	.string	"rcdeviceOSDWriteString"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001"
+	.string	""
+	.string	"rcdeviceOSDWriteChar"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\001"
+	.string	""
+	.string	"rcdeviceOSDClearScreen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\001"
+	.string	""
+	.string	"rcdeviceOSDIsTransferInProgress"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\001"
+	.string	""
+	.string	"rcdeviceOSDHeartbeat"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\001"
+	.string	""
+	.string	"rcdeviceOSDResync"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\001"
+	.string	""
+	.string	"rcdeviceOSDTxBytesFree"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\001"
+	.string	""
+	.string	"rcdeviceScreenSize"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\001"
+	.string	""
+	.string	"runcamDeviceDispFillRegion"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\001"
+	.string	""
+	.string	"runcamDeviceWriteSetting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\001"
+	.string	""
+	.string	"runcamDeviceGetSettingDetail"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\001"
+	.string	""
+	.string	"runcamDeviceInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\001"
+	.string	""
+	.string	"runcamDeviceDispWriteHorizontalString"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\001"
+	.string	""
+	.string	"runcamDeviceDispWriteChar"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.2a8961e2997b7846,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
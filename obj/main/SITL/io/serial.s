@@ -0,0 +1,1408 @@
+	.file	"serial.c"
+	.section	.gnu.lto_.profile.2f90a5e22214f2c0,"e",@progbits
+	.string	"(\265/\375 \tI"
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\035"
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.2f90a5e22214f2c0,"e",@progbits
+	.string	"(\265/\375`\312"
+	.string	"\235\n"
+	.string	"\224\020\276\001"
+	.string	"!"
+	.string	"\354\301\314\336\005"
+	.string	"\001\363\330\276\203\007\022\002"
+	.string	"\002\001\002"
+	.string	"\002\002\002\003\004\226\230\365\242\b\003\327\214\256\274\b\002\002\005\002\006\004\333\375\377\333\001\005\373\306\354\242\001\002\006\201\225\345\331\006\002\002\007\002\007\007\240\342\234\212\n\b\265\250\262\321\001\t\365\365\232\331\003\006\002\003\002\b\002\t\002\t\n\013\f\346\224\340\266\r\r\360\371\267\351\n\002\002\004\002\n\016\361\255\215\366\f\017\363\265\2438\f\002\003\002\013\002\n\007\002\007\002\f\002\r\020\021\330\316\241\361\007"
+	.string	"\022\201\267\341\302\n\002\023\263\210\303\241\004\002\002\t\002\t\024\344\326\341\330\017\004\002\004\002\t\025\316\242\277\351\016\002\007\002\003\002\017\f\002\007\026\324\341\335\261\003\b\020\027\317\211\374\275\r\024\002\003\002\003\002"
+	.string	"\002\021\030\031\231\250\272\222\r\b\032\350\300\306\254\005\003\033\363\214\277\350\017\021\034\246\343\274\353\004"
+	.string	"\035\200\236\352\337\005"
+	.string	"\036\220\232\212\335\n\037 \240\342\234\212\n"
+	.string	"\036"
+	.string	"\250V\332\322\206\321[A\201\212f1\327\201\016`0\323\300\336\004o\226\353\204\314\247\364\3255H\310\303\305\302\243\246P\350{s\231\234K]\204%\324U\312\335Q\315\256\254\232FD\005\216\\\tkf&\332\365Q"
+	.ascii	"7"
+	.text
+	.section	.gnu.lto_.ipa_sra.2f90a5e22214f2c0,"e",@progbits
+	.string	"(\265/\375`o"
+	.string	"e\005"
+	.string	"\302\206\023\032pk\322\0010U\375\252\252\252\252\017\220*C\271\376\177l\335\255\021\"wJ\001\256:\243\315S\220/\344@\317\2578\360\306\030s\241\330r6\261\246\025E\326:YR\020\007\203\316\302\226^\233 \230\013\254"
+	.ascii	"\3152K\222\266\335_\307\037\001/ \220\002R\346\0010\304\025P"
+	.ascii	"\20020\216\033\3418\235\301\333\230[\0306n\027\212=p\262XY\251"
+	.ascii	"\\B\316\250\016\310\250`W\325\310\032Z\rW6\002\321\031B@\202"
+	.ascii	"-\212\301\310\274\023[\274\231\031x\366\366\033\303\210\003("
+	.ascii	"\340\300\230\3061\230!\324`vZ\265\001X\\\224!"
+	.text
+	.section	.gnu.lto_.inline.2f90a5e22214f2c0,"e",@progbits
+	.string	"(\265/\375`g\004\205\026"
+	.string	"\246\243\177K\320\360(\0354\225\f\277\300\261\250A!Z0\031{t\004\201\327w?;"
+	.string	"\311?\264\265\215J\310\003`%\225\006\370K\302\323\2220|;\341\t\r\027BI\312Q\352a\370\241\227\370\276\322=Fu\323\306\332\267\b\221\266\336[\312\024l"
+	.string	"d"
+	.string	"t"
+	.string	"b\237\274\236!\264KN\022\f\325Y\275\344\013\266\260\276z\256m\370\202-\260\034\255\361\005[^\007\020Z\263M"
+	.string	"\177M-\\\263"
+	.ascii	"\376\232\304\177\250\330\037G\217v\220z-\034\305\261\203\324"
+	.ascii	"\023O_\236\364?\253\336zGJ\220\214\326\237\2433*G\026f\272\306"
+	.ascii	"`\352l\0309\377m\377\t\367^\n\177\377l\353{\357\245?\371\217"
+	.ascii	"\006\001\345\371\362\354s\237\3177z\342\336\253\372\313\244&"
+	.ascii	"\324\311K@]\240N\336\354.\316\360Z\343\331W\007\257\266~\001"
+	.ascii	"\332\310\330W\332i\r\264\201i\301\037S\377a\315\334;\035\266"
+	.ascii	"\347\022\372d\003#\264z\253\"x\265\321\236\247\240O|\035\337"
+	.ascii	"u|\327\007\264&D\317\r~\370j\377\2074\363O\017\"6G\260\001(\314"
+	.ascii	"\300\306\372\204\373\347\304T\241\300\311\233\036\213P\312\350"
+	.ascii	"B\211\037\351\244\263t\272.b\037\376\2570|hk\024\227\003\017"
+	.ascii	"\361\343k4\305\f\026\325\032J=:d\261f\336\341X\233\\\244Q\370"
+	.ascii	")&\261\261\226p:\343\303\312\017\201\307\214\200\242^dL@Q/\256"
+	.ascii	"\303B^\236\374\363\212\226\264\017\317\322O\352\327u\f\027E\036"
+	.ascii	"\024\350\250\f\211\016\275\003\007\t\177y\362\337<\326\362\344"
+	.ascii	"\377\252n\032\377\275\242\257q\255ic\375Mz\304\212\021KX\311"
+	.ascii	"f\036&{G\027X\262w]\317\273N\361\0211D\362\001\277\252\037\376"
+	.ascii	"nM\223\003\204\212z\223B)I\374L\300\377Z\267\215\006\270381D"
+	.ascii	"2\r81D\256\217\274\336:g\205\f\257\365\360\267\276\346\013\032"
+	.ascii	"\365\006\r\321\3640\020]\250\261<d\b3N\321\214\024\264-\006\220"
+	.ascii	"\242\232\241*\017\022\200\005i\245 \021H%BA\002\345a\366@$5G"
+	.ascii	"\224\317\260?\276\200\030t{\253\315\254\301q\211S&\2145\345z"
+	.ascii	"\"Ji\261\f\334\241\331?\023^\356B\243G\177\021\236\375\263\245"
+	.ascii	"#K\0135\t\206y\234\310\360\3667\312\023\206\021\024\215\250\221"
+	.ascii	"r\254UMB\305B9[MM\232g\035V\026\217\246\277z,L\305\252\234-\264"
+	.ascii	"(\006m%\201\f[\373\334\003\255J\303+\320'\334\372\353\304\\\213"
+	.ascii	"\364\206\0359\375\350\221\355x\367\22328$H\237\231\025\\\266"
+	.ascii	"\013\207\276\274\240\231-.N\224\217\211\305\025\323yiw<`!\006"
+	.ascii	"\016\315,&\262\303\237L#\025\034\\A3\t"
+	.text
+	.section	.gnu.lto_.jmpfuncs.2f90a5e22214f2c0,"e",@progbits
+	.string	"(\265/\375`=\002\345\n"
+	.string	"\306P2-\200EI\007l\306B\212\020\025\340\001\243\214\242H\273\222\310\024\234\260\231\200\254CFd[k%O\320\346B]\013\362\204\375\273\311\235R\n%"
+	.string	"%"
+	.string	"&"
+	.string	"\021\345\362n8)6\260\004Tc<\211\254\260RR\324CM\3367aoR\226?e?\265U0\331\322a\202\b\275h-\352pR\\Q\324\037S\024\225\307\334\306'h}\260\230\337D\264M\006\314_\374\325\272\2001\344\033Qm\315o0\231\326\316JPd\374\322\317?\276\3741\220\313\340>\356\202\013q\231\337|\t\212\006\264\2461\322\017\004"
+	.string	"\r\204\316F\205\3563{\216\357\370\313\267|\rp\020.K_\241\354\345\272}8\310F{H\211\244\244\250\t;8\251? `\002!Fw\033\363\332\260\032G\314\313|\310\361\t9 \f\303\b\0209\032\003\363\013\270\216\017\024\006\240\023\253\303\302\255\2078\353\325\212Z\3404\316\333\350\2067\200\275\006\006]7\200!\337N*\034\210\215\305F\324K"
+	.string	"N\0160\335\215\267\235\262p\312`\206S\323J\275\215\307\234\227\200\234\303\022\272(n\300\366r\222sp\321\273\020\232F{\027.\326\376\226\001\300\002\260\351#\223\376a\21516\2455\016i\272h\345\203\005\273&#\244"
+	.ascii	"n"
+	.text
+	.section	.gnu.lto_.pureconst.2f90a5e22214f2c0,"e",@progbits
+	.string	"(\265/\375 II\002"
+	.string	"E"
+	.string	""
+	.string	""
+	.string	"\027"
+	.ascii	"\200\004\001\232\004\003\200\004\005\200\004\006\205\004\b\205"
+	.ascii	"\004\t\271\004\f\271\004\r\205\004\016\205\004\017\271\004\021"
+	.ascii	"\030\022\231\004\023\205\004\024\205\004\025\232\004\026\232"
+	.ascii	"\004\027\230\004\031\230\004\032\204\004\033\204\004\034\270"
+	.ascii	"\004\035\264\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.2f90a5e22214f2c0,"e",@progbits
+	.string	"(\265/\375`2\001\305\b"
+	.ascii	"\342\f(,\200K2\034\310\220fB\327\343\3661\203\263\256\005\255"
+	.ascii	"\t"
+	.string	"\234\215A\f\033 \321\3045\030\253\230\332FH[\\\377x\264\333\336\233H\231\002OTXD\250\033\255\350S\245\007\357\224?\030\314\002\210_\033-\301\373%W)'%\322:\264\317I\3534m3q\320\022\210\033hC'C\371B'\224\036\227F\030\201_R\016\251\327\200B$\250\320i)\267\264\027\0020&\224\377\343q)\n2I\243\303]d\334\332r\363\326n\312\330\302\230\253\307~\363\276\342x\2369w\312\214PF\344\345\224\327\367\t4 p\002!32\017!B8\353\322\370\016za\004\277\"\"W\241m\335n\323ya{X\341)\274\013\206\241\261\305;v\245C\026\220u\027\204\210e\307\025,,\235\341[:\242]\326,0V\204\002\210'\314#\034p\321\t4\375wo\266\024\006\360]\375d\005^\205.\225\351\237a\300!w\023\353\034\363\324\034[\266\215\233\211\246K\343%\352p\313o"
+	.ascii	"p"
+	.text
+	.section	.gnu.lto_.lto.2f90a5e22214f2c0,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_serialPortIdentifiers.30.2f90a5e22214f2c0,"e",@progbits
+	.string	"(\265/\375 v\345\002"
+	.string	"4\004i"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\325"
+	.string	"\001\007\005\001\006\025\325"
+	.string	"\001\006\325"
+	.string	"\001\005\325"
+	.string	"\001\004\003\002\002?\202\210\200\300\001\1773,4-\305\001\304\001\303\001.\302\001\301\001\300\001\277\001\276\001\275\001\274\001\273\001"
+	.string	"\n"
+	.string	"@\bT\343\300\004\230G\300"
+	.string	"\314&\260"
+	.ascii	"L!)\327\017\240\b"
+	.text
+	.section	.gnu.lto_baudRates.32.2f90a5e22214f2c0,"e",@progbits
+	.string	"(\265/\375` "
+	.string	"\025\006"
+	.string	"\302\210!*po\326|\375k\213A\252\277\343n\220\265_}\252\327\037\353\375\215\246eUUU\345|\330 =\317\001\276\301\352\244Q#2\311u\314\2315o\346\\\336\331\334\363g\320\347\241E\217\032\223F/m\3724\352\324\252W\263n\355\372\305\030\266\210\330\362\212\022H\035D\255f-"
+	.string	"\315\334\272\220\363\304\333\375UF\304%\220\030\257@a\222\003\007y\t\217\260,\304\316\324\253\263\3115\374qoSR\331 \367V\257\365C\034"
+	.string	"4\023\004\306\325L\0160\027\\\004\303\300m`\004\270\b\206\201s1\355R\\-\304\242\201\021\340\006\264\013d\300]\320\006\310\215y\003\332\0058\240] \204\314[\007"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_serialConfig_Registry.36.2f90a5e22214f2c0,"e",@progbits
+	.string	"(\265/\375 \222\035\004"
+	.string	"T\007a"
+	.string	""
+	.string	""
+	.string	"%"
+	.string	"\005\001\212\001\202\200\200\374\342\203\355\341\027\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\345\006us\375\005uq"
+	.string	"\005\001\006'\001\344\r?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\027./src/main/io/serial.c"
+	.string	"\004"
+	.ascii	"*\303\303,:E\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_serialConfig.37.2f90a5e22214f2c0,"e",@progbits
+	.string	"(\265/\375`$\003\255\024"
+	.string	"\326\343\200J\300\322Q:PE\335\241\325D\350)\"\212\212r(\300\fN\341\n\344\317\200\232\211d\344o\207\221\316\265\357\274\237\331\372\304t\3059Z}\250\026LF]\002\203\373\022\263\330\251\b\204\227\036\365\\_\206\270\t\036\204\221M\366N)h"
+	.string	"e"
+	.string	"q"
+	.ascii	"\367\201\371\200\335\334\021\216\335\322\201M\306W\227/ \276"
+	.ascii	"\216' \276zf\007y\251\263\337\031\231\220\021\265\273$U\341\361"
+	.ascii	"ay\207s\366\032\3229\363\177>m|\273%!\034\3555\034\241\251Q\n"
+	.ascii	"\200+\021\262\200N"
+	.string	")fp\266\031\262\2709=\320'/h[\022\302\335|\216H\330]\317\033\316\346\026o[\204m\b6m\t\275\332\234\2424\210F\212G]\247\223\356\"q\365J\355\021$\346o.q\361\223z\222\2414\273\244M\232c\237\005\224\3411\315\331\252\373\374\365\273{\316\351\013h\361D\001\0218\355\236\230*\262\277\332[\361\335\355\227>\020\214\307\230}g\337H\253\031\203vLO\273\273z\365\203\361UAx\022\333\237\366{\376b\026\237TE_p\202dpl:ng\270\017\244\037\017*\312\032~dT\204\004\245\0137\234\007\321\216\250z\024\321\346\360\034(=\236\2126D\027<\265S~C\305\204\311\206\213\201\316\356\262^\355\225\017\275\306\335\215P\303\305\203\001\246\035\030\361U\034\272\t\251\315\251\227\013\261\214\2731,\177\306i\300\302\357\274:\204L\374\355\325\227\321\003=lA\013J\005\257\257\274:\264\300&"
+	.ascii	"\260\312\311\207\224W\314%#a/\262\345\225\302B\252\304d\344\311"
+	.ascii	"\001\303@\270b\244\013\f\026#I\312=\315\231\002\321\257Fmv\222"
+	.ascii	"\205\003i\225\220\330\370t\275\013oB\031+\240\310\341\364\004"
+	.ascii	"ko\2116\206/\265\026(\271\022\374(\371\317W\300\"\272Js<\322"
+	.ascii	"\203\252(m\232\253O:c\2378\351}vM1\223\310\303\335\335\260AB"
+	.ascii	"\250qL\302\2242\025\b\211\210\310\204\005\315\003\340\002\221"
+	.ascii	"9r\003\021`Q\025\220\310\220\251G\213\001\255\240\004\306\027"
+	.ascii	"Q\351\021\024}Pw\037\211>\201\202*\326\0068\"\237X\006\361\340"
+	.ascii	"\213\321I\254\037\364\336\376\262\244V1\203h\272\326\341\326"
+	.ascii	"\210\334F\272;\316\343c\333\303Dbc\022\253\323\022AH\320\033"
+	.ascii	"\336{`@\206M\007?\374\325\251\315\304\267\216\263z\361UDn\256"
+	.ascii	"\006\324\033\2551\232S\277\203\345\350\020\244.?\215\2110\200"
+	.ascii	"W\003\251"
+	.text
+	.section	.gnu.lto_lookupBaudRateIndex.38.2f90a5e22214f2c0,"e",@progbits
+	.string	"(\265/\375`\223\001m\020"
+	.string	"\346\236nG\360\316(\035C4t\323W\354\357e\370\321\036\304\325a^\334\225i|\033\304WX1R\330=\230\377\251\261z\340'>S\352j\007{\356\341[\205\216\303]\005?\215_c%Z\371y\337\363]#B\310\336[\356\224\002Y"
+	.string	"X"
+	.string	"["
+	.string	"\001\346e<\200y\2712\346x\254\367\204\250oS\306\205(_\345[\334\332\b\230\215o\025A^dL<v\330\372Rp\326\270\\\212\274xX\337\205\307\br\323A\303\306\307\022\367\303\214\246\361\251\340>\366\216\227\016\353s9\334B(\245\206\254\317\302\315\335v\313\266\002\373 \002\035w\330\277\031Z\276\336\361\365^\t\r#\36432\200j\035.(\255\020\024\203\236\220;3\257\277}\362c\3260\202\005\247\327\024\216\322l3\327\314\nJ\253\201K{\020\0366\301\035\2450$DPZ\017\270"
+	.ascii	"wy\017\2679\031\025k\206oc\341\260\312yAi\365\b<6/\235\226\227"
+	.ascii	"\024\f\202\263\032\030\030d\334\270\273-{\267[\221\027\317\200"
+	.ascii	"\212C\213\353\362\266pK2\025*\370C\3419%\034\245\252\017_v\034"
+	.ascii	"R\374\206KC0\315\263.}\323\274\204\333\355\304\375>\366X\342"
+	.ascii	"E[\001\255\300\240\255\265\270a\261\353\262\253\n\374G\210\026"
+	.ascii	"\024\336\030\007\022D$&#)B\t5 \211\020r\300y\304\343AhT\022\231"
+	.ascii	"<\322\3103\031\205J\274\221\222\311\363\020`\322\211\250\344"
+	.ascii	"\241\220H%\257\322o\214Oh>\323G\315\307\336\321\320`\261[\271"
+	.ascii	"r\035\262\262\251\024\333\272\234\240Gr+Y\320-\216\373\310zT"
+	.ascii	"\360\347\221RJ\347\272\2362\343r\f\002  0\002\202\034euh\n\346"
+	.ascii	"\261\0337b7oI\315\2734c\200\035\227\261\321G\026~u\200\242\031"
+	.ascii	"\204\305\261<`\310\253\331C\332\202o\t\271]\360\223\300\022\b"
+	.ascii	"\270?\214Oh\002\003\377\031\266\262%8E\260\205\3004\366PV|\243"
+	.ascii	"\323b2"
+	.text
+	.section	.gnu.lto_findSerialPortIndexByIdentifier.39.2f90a5e22214f2c0,"e",@progbits
+	.string	"(\265/\375`}\001\325\017"
+	.string	"\006\336jF\340\262(\035\222w\314\016\3169R\2438\fW\262\273\375\260\n\004\215}\253\220\324\257\264F\271\001\361\357\336\312\366\277\322\343\027\222z\352\242\377\"q\234\030cl\326\244pf~O"
+	.string	"\n\025K@\244\250\204\354\275\345N)V"
+	.string	"U"
+	.string	"X"
+	.ascii	"\361\002\346\245\206\360\366\b\273',]\2332*,\371\246kQc\255\340"
+	.ascii	"\200|*q$\207N\313e\207\253\017\005\347\t\226K\007/\035\325\327"
+	.ascii	"\34116`\201b\004\310\207!\252L\306\346\363\245\240^\366\004\257"
+	.ascii	"\033\325\307r\250\221\354\256\241\352\343po\267\275\262\315\300"
+	.ascii	"\276\2110\277Th}\354\206\020\372"
+	.string	"\333\347\245\206\210\315\356\206\036\037KC\322\224x\354\366a\276,\346\232\315\264\262\311\314b\354\354n\310\245\027l\227\267K\366\007\036\346\202\001\354\272\370\220\261\273\n|`\273\274\212\257(\3315\021&\342\273\013\206\312\214\307\356r\006>`^\006\207:\345\313\353&\003\b\024\354\201JB\265\303\206\214\nU\323\225\013\244N8\242\272,\365\352\305\334HA\036\013\1771a\333M\215\370.>#\305\277.M!e^u\351\247\314\313\353eG\340\202\223\202\346\004{T\206\325cF\325e\303LP[3:4x\260\266lm>\025B'\242Nz\241\356A\207\"\n\235t\001l\002\202P\322y!\0227\3528QW\022\2013\361H\034\210\200G\022B\036\2072\032y\334\307{m\371-\276\355\314`M\320\0355UU\223\234\024\365AS\227?-r\252\346\300\220C]\271fB\375\217\230\234\024\344y\334\335\235\026\t\036"
+	.ascii	"\022\023D\246& \275\033\321J(\267\346\203(E\243\244!\220\316"
+	.ascii	"(9\301#|<\306\3203\317\n\314F]\350\200`\022\305\204c\332\323"
+	.ascii	"\231-\325@M\275\017\265\356\237\036\310\324\"8'\242D\b\f\005"
+	.ascii	"{EY\241nt\332I\006"
+	.text
+	.section	.gnu.lto_findSerialPortUsageByIdentifier.40.2f90a5e22214f2c0,"e",@progbits
+	.string	"(\265/\375`1\002\255\023"
+	.string	"\326\245\205I\320\322(\035S\355\r'\347X\222\2508Y\264\321X\321\354\372M\366\256\327\366\210\020Q\240\277q\373?\360\b\202\273\031\376\372C\212sh#\360\373\364j$\276\340\006\352\311fQ\2006\2628\215\374\374\003\271\241\222O\366\226;\245r"
+	.string	"k"
+	.string	"r"
+	.string	"\007\346W\234\305\314\264\002\343\316\215\n\246H\206\367\253u\\y\374"
+	.string	"\3604\274"
+	.string	"\360tI8\374\034oP\322\216\002\351\\I\363]\216\232(\032\033\036$8\231y\302\244\224\363]M\202)pN)\364\004\335p\036>'\204\026>%Hp0su>\033\357]\316\340lr\277\273$R\252!\001\341p.Q(\265V\313\033\356\346\016o\033g\033\305\226\023\002:C@:\200\360\352\330\251\217\177\bZ\232^w\317\363\356\245\322rJ\177\244\202\320\217\251\004\251\326\232\247\"U\007%:q\336\257\273\264o\377\205\337\263\312\347\321^clR509\036\204\247\267g\376\316*3h0\273\216%\254(P\276\034\216\245Z\307\004\247^\020Ji\377\347.f\037[f\200j\033\361A\250\326Zb\004\341i\262\347\026d\007\335\234\277T\344\264\340\356\316\330\200\355%in\316\341\312\215\355z\330$\021\333\027.\324B\215\232|j\255\016\202T"
+	.string	"\350\224~4^\203\006\236\312\245FM*~|\0314\005\277\331\346p \225\b;\265\326\023\030\217\001\363M\234Z\203L\376v\352\313\300Sp\367\350\2063\367\373\336\351\217\347I\306\351E>\255\217f\310\320n\316\036]\344\006\256\025VKl\275X)\251\r\256\326K\2441\227hA\\y\271Z\342\210SL0\260\304\230K\266\202\211\253\227\310RY\245\304d+\023\002\206ep\305V+0Xl\245r\375\352\370\273K8J\362\005\201\237\361\367\236Z*r\232\273\224\256Q^\266\026\002\2659\247n\320\324\322\233\364\314\177\354|\330$\221\317Zk\0057w\026pnj\277;\315\341\021\022#\242&\237\002& 0\002\204\034\334\r\037\202\2302C\325\335N\244\324\335y\264"
+	.string	"\020\016hp\303\022,r/\274\266\267\264\306\320\002B\270"
+	.string	"\234@\342\r\243f\214\214\f"
+	.ascii	"t\251\033\327\020\322\020\220\343\260\353\312\254\222>\024#\307"
+	.ascii	"\227i\222\026@\306\360p\336\250\005&j%\326\021\242\254\361\334"
+	.ascii	"\253}O"
+	.text
+	.section	.gnu.lto_findSerialPortUsageByPort.41.2f90a5e22214f2c0,"e",@progbits
+	.string	"(\265/\375`'\002M\023"
+	.string	"\306\344\201H\320\362&\035\306\217\347.d'1\200]\374\277\270go!\373R\"\202'z\372k\003\237'\307rH\n\360\217?\360z\226\n\237"
+	.string	"\007\214u#\360\001\262z"
+	.string	"6\355"
+	.string	"\303`4\257\340\213\3177\2671\030\221F\366\226;\245n"
+	.string	"h"
+	.string	"n"
+	.string	"'^\354*0\366\350\204\314,\325\244h\252u\374<~"
+	.string	"w\332]"
+	.ascii	"w\272!\334}\2167']Oqt\256t\3710O\315\324M\216\r\021\261f\222"
+	.ascii	"\354X\342\371LFr%vN+\310\224B\221\303\347\204\200\342G\204\210"
+	.ascii	"837\310f\364\332\245\215\370\222\373\331e"
+	.string	"\021\024MIH\334\271L\225\324Z-CQ\347\356n[\264]b\313\t\001raD=6x\360\302l\357@\177\307Y\232~\274\347i\367Ji9\245\017\342!\301\360\240\321a\344V+\316\r\252\316\240E\262\323\376\361\322\276\375 \277Fs\275\322\344x83O\017\272\323\333/\376\314!f\320\340\345cKWI\244l\261&\246ZG\004\247^ \345\201\\\036\240V\030T\214ZG\005>\320\235\336\304\003>j\320\215\371LG>\313\355\256\215\r\274br\314\215\271[\271-\332\215\227|\262\215r\030.\024)\252\251\326\352\340\005\b (\352\247\305]\270\270S\271\024)\312\t\310g\341J\320\023\332\326\360\025`\204\236Z+\211\212\3330\370#N\255\302\"\037\236\372,\334)\267\233\024\356\314\375\276v\332$3\252\371\021#ok\273q\"\332\215\331#L\253\025\325\t\353$Ee\342eX\235\244\260\350J\013\244"
+	.ascii	"b\223\021\013*Vk\245\362\201\254/\205\245B\371LZ*\337\b\001\203"
+	.ascii	"\027V\255o\005\004[_\210\353\027\346\317.!\351f\033\342.\364"
+	.ascii	"\327\3561\035\371\314]J\327%1+\363!\2651{2\250\2674\224\266\271"
+	.ascii	"\016\032\216\227|\372\254\265Vnco\341\346z\373\331)\217l\210"
+	.ascii	"\006\204\214\274\311\365\t\003'  \002\203 \324\035n\315\177\b"
+	.ascii	"w\372\f\005w;I\251y\347\335\002X\370Yp\271\013\206#\330\213\316"
+	.ascii	"\2106\006\333 \257\013\300\tD\300\276\205\312\016\207\210\005"
+	.ascii	"}\223\233\361\020\307\210\262\321\200\346\r\r\004Q\220\362\023"
+	.ascii	"\232p\340o\006\262\265\004\247\b\266\300\\\255\334:\002\312\232"
+	.ascii	"\316\275\332\376\004"
+	.text
+	.section	.gnu.lto_findSerialPortConfig.43.2f90a5e22214f2c0,"e",@progbits
+	.string	"(\265/\375`\346\002\325\026"
+	.string	"\206*\225K\300\224Q:h\243\344\306\020\355"
+	.string	"\fx\244qa\335\255\314\250-Z\013SZj\206s\007\0169\347\310"
+	.string	"\030\030\027\273\345_\367{\353\351\361P\016_\337s\225\3016\035\310\306\241\254\016\222\322L\242`{]\365Qm#do\271\223\f}"
+	.string	"x"
+	.string	"\205"
+	.ascii	"3\346\221\231)e>\322]\314nz\340\325\275@A\246{\315\006\234@u"
+	.ascii	"{\240~\305Y\314\230V\300\034\352\031\205~p\276$\367\232$\233"
+	.ascii	"\037\020\336\252. \274m!\256\224v[\303\2464~\322\353\316h\252"
+	.ascii	"\314\335\334\262r9?m\264\006@\341\363\260>h\261#\301\312\335"
+	.ascii	"j\363\316\247\377Nur9\264\177\276\2528Z*s>\247b\204{/\3232\327"
+	.ascii	"s\026\317\314\037\230\231\205\271\021\004\237\241\201_t\313/"
+	.ascii	"\031\372R&\234\211\321\227L\201)\242n}\303l\332h\0071\177\345"
+	.ascii	"\007\024\021\267\216G\221\362\211Hy\025RV]\351,Z\312a\245l+\345"
+	.ascii	"z\363o\024\326\221\017\007K\367\362\004\231\334(\333t\342J?\363"
+	.ascii	"\3710\256\304\377\361\350\233\275\367\223m\316\343\356\001w\367"
+	.ascii	"\336\367\370>\266\371\013\332\357\r\304\212G\210\210\310\275"
+	.ascii	"f\312-\223*\033\346\361\366\314\001\335}\322u\b\356G\325\253"
+	.ascii	">\256\tSx\217\nV\312\211\307\216\026\024#6vP\327\341\302/\242"
+	.ascii	"\265\225r2B\372y\0344\006@J\331oX8\220\345\366'_\370S\013\004"
+	.ascii	" 6\356\344\202\341\345%\274\025\273\207\224!j\207m\300\207kb"
+	.ascii	"\373'\267N\303\365\251\241{\357J\323\313\"5\032\344\337\025\326"
+	.ascii	"\266\375\337'0\035=\335F\330h\260\245\204\360b4\003\240?C\205"
+	.ascii	")?\357@\031\326\320\275\265\227|\031\00115-\230\027\f\254\345"
+	.ascii	"Z\301b\257\032\027\254C\006\025\273T6\264^\262\030\0322\366\""
+	.ascii	"a\257\326\f\351\222\321\220*\0048\306!FF\326\304b2rdf6ko\035"
+	.ascii	"\377\274\204\251\335\271T\237\343\377}u\004\211\211\026{l\035"
+	.ascii	"f\036\373I\377\316\216QT\255m%l\007\261\330@\275\0358t\tK\271"
+	.ascii	"T?j\377\374\002\0325\224 \325h\260\336{o\355 \376\373'Bw#l\035"
+	.ascii	"_Ax\322\262^\020\034\272\204W\0017 P\2021tW\036\315\022\245\231"
+	.ascii	"(\263\300[:^\2426~\257\223\312_\260%d'\374\266;{x\340\206\303"
+	.ascii	"\265\334E\335\300m\246ka:u\037\024E\322a\036\022\227\253(\223"
+	.ascii	"#\211\007\260\007\322\201+\230\350\031\327`\253u\267,\007\264"
+	.ascii	"\300?\rBq\264'\013\260\272/z\261\003\262\211\355\035<u\333y\327"
+	.ascii	"\312\260\230\356\027\355XZ\221\324\003|k\037\266\377\362x\006"
+	.ascii	"7\330\306\204k\\\205\303\324>2"
+	.text
+	.section	.gnu.lto_findNextSerialPortConfig.44.2f90a5e22214f2c0,"e",@progbits
+	.string	"(\265/\375`{\002\255\024"
+	.string	"6\246\207J\260\022R:r!\240\001\336W\251a;,\016\322\222\307\363ZW\221\327\333\202Q\214\202C\334\017\n\346\261\364]o}\226\345$WW\223.\352\333\277\b\377\007\335\270\240G\370G\007XD\177\334Av\246\036~\016B\310&r\247\024t"
+	.string	"j"
+	.string	"t"
+	.ascii	"\241I\2251A\243Tk\257\201\021\220\247\006\302\267\270\213\030"
+	.ascii	"\333\006\364|nZ=$rEX\265\366J\367\036@<%\017@<\335\036\323i\273"
+	.ascii	"H\307p\247\315\007q\321\265\233\271\0177\251\211\n\234\217\023"
+	.ascii	"\204|\350v9\017\303\007/x'\\\273\\\270DA\250\003?iv2s\357\373"
+	.ascii	"\201\025M?\251\243\035\316\347\250Rk\365\324\355nn\362\266C\330"
+	.ascii	"N\261gP\342\270s\017\274\004%!\250\231\021\270\231\265Q=\210"
+	.ascii	"\216vy\354\036n\242\354\300\361\343\335\261\337\373]$\236&wz"
+	.ascii	"\024\247Eq\232\322\3510\234\336\235\236\377\335/\351`\203\005"
+	.ascii	"\304A\260\326\232,\"U\007]\n\372\357\366\211|\240[\376\317\366"
+	.ascii	":c3R\323\363\363\243\326\336\202S\227\344\351\355\030\273e{N"
+	.ascii	"\373C\207\021\363\336\207\342\326~<d\346\020\273\226\256\270"
+	.ascii	"!UND\270t\237+b\nw\252@\243\236xML\257\222*'^\215/\331\304\323"
+	.ascii	"pi\324\023\213!?\311\306`Jg\333\303\221,\034)\345\302i\274 L"
+	.ascii	"\311\370\fX\214\205E<%\331\245\322\345\214\273[\240(Wd\256-\273"
+	.ascii	"\221\313\245|j\255(~\36012\370)N\335B\233\327\235\3724\361\364"
+	.ascii	"\272 \267\231\345\337%1\230\327\212le\366\202\215\314h2\030\330"
+	.ascii	"\214\003\006\322\260\023\r/Y-\366R\322d\345L\366j)a\265\227\362"
+	.ascii	"D\200i\033b\265\022\206F\253\225-\337\356{\004)^0\211^\351\007"
+	.ascii	"~\304\352\n(\374\222\344Z\345\2668\024\342\362x\334\022\277\034"
+	.ascii	"7\\H\033\343\336w\005LMB\206n3+\254\265V\272<\376\327Hg\007j"
+	.ascii	"\334\035\337\352\nhI\366Kc\002H:Ua\00211 P\202!sV\007\241\207"
+	.ascii	"LsWbkz\232\021\245'la8B\260\002\324$L\304u#\371?\212;\351\024"
+	.ascii	"e\026v\247f\374\227\251\222s\021\360\272\222d\371\035\020\350"
+	.ascii	"\237\243\270\033\030\021\367\310\250\201\003X\0021pP\023]\343"
+	.ascii	"A\222\035@\243W\204z\312\b\031\024\213\274J\201\307\251m\371"
+	.ascii	"l=\fU\211\216\3146\222\202\343a\f\217\326\354\271W\033\236"
+	.text
+	.section	.gnu.lto_determinePortSharing.45.2f90a5e22214f2c0,"e",@progbits
+	.string	"(\265/\375`U\001\035\017"
+	.string	"\326\334gF\360\260(\035\273l<\263h[<vY\272\237\333=\031\315\357\237\210\246\020l\372\215\355\214\244\003\354{)\252\375h\362\024z\275WrB\030\336\304aqX\310H\241\34498\214n!epJ\256\321I#{K\231RV"
+	.string	"P"
+	.string	"T"
+	.string	"3\344@\376\241]\306\027\320.\367\365\357\232\214\253\237\357\001\242\\\373p\031Ab\344\200"
+	.string	"\201\031\342\001\227\nN\214\013V2X@`*~\334\260p|\300\024\335\350@Fe\005\bD\305\217\212\234\230\307\256+`\212\252Gd\316i\325"
+	.string	"v\270=\267\335\331\206`\377\025-\3735\277\347\341\035\245z\245Z\243\372\233"
+	.string	"\227\233\b(\346\3440\3331gH\027#l\233\354\217\355\325\327`\210\003f\212\005k\240j\237\3460\323\303\223\023\230\263\265\323b\316\220\201\023l\227\0167\333\376\314K\230\374\3050\004\350\301\201\251lr\314\353\322o\230\271\361Bn\313e\025\243,4<\324\210\n\264\335\313xVwW\203\241jA\351\314_\335\253vN:\263\355\375\204\205m\316\324\003\337\246D\332\346\234\027q\371E \2439\351\354\313\"aB\266>\321\344\266\254^1YJu\330!\212\256\313~\234\033\"\257+\205D\027J\266\t]\211\310\223P\032y&\036\016\205P\030\351F$$\316\3538Q7R\201\013\215H\\\210\001{&$#\256\344y#\356\023\316\307\271-\377E\007F\237\342\032\377O\013`C\207\205\324\177\332c\007\360\242\003\263\376\247\305]\261\035\327\"\247Ei\001\032"
+	.ascii	"]\204\036\230\005\3102K\2001\260\001\2521B\r\200P\270(E\3030"
+	.ascii	"\020D\035\215\273E\020\220\025\222kx\303FJ\023\361\306\026N\022"
+	.ascii	"\362\201\271\002\025\016\356\n\322\006\247\020Z\022j\207\n\246"
+	.ascii	"\031"
+	.text
+	.section	.gnu.lto_isSerialPortShared.46.2f90a5e22214f2c0,"e",@progbits
+	.string	"(\265/\375`\233\0015\020"
+	.string	"f\337nF"
+	.string	"\261&\035;7\240\bP\323\364j<\247G\347X\247\301\347N\235\344u\001\311\361o\275P\017\343\352\324LW`K\207\bD\023*\032"
+	.string	"\t*\350\336\361$\256\216\t\366\033v\367\354\252m\233\266 v\357-eJ\001Z"
+	.string	"Z"
+	.string	"W"
+	.ascii	"\217\376^@>f\377\220\217\266\335\300A\312,\377D\310\234\206\347"
+	.ascii	"\005\007\307\234\237\2664g\271\214p\225\305\277\316GL\324"
+	.string	"\360\300\260Z.;<nP8\232s\206X+]\370\321\332\201\005`i\200!\260\327\207\353\\cX*\325\217\2049\247\025\206\305\341\376\334v\212m\n\366y\0027\277\307s\376\3546\277\204\352(\325\360\243\336\217Z\245\372!\001%f@\320\231S&\246c\312\2100H\330N\331!\333Q\305qR\317Q\201\242\271\002\021#B\3668\202\360;\212\324o2\250h\256T2\f\262G\221\252\332?\361\232\324mV>`NW\217\2139\277\005F\220\005 \022.\311c\277p\017\320\330\277Z;5\340\023\310\335\303Rd\253\273+o\274xPi\314_\335\277\354p\321\230\355\223\263@\311\346\\=\360Wx]6\342\361\013b\303\306EcW\330\253\365bw\306_\221rI=+\315a\177-\2723\366\341\234sz]\266\325\240\007\\\267\241L\234\312\210\tj\253`\201\304+\231\234\b\234\234J\023\270nC\2318\225\022"
+	.string	"\027\266\022\256#\241\274.\005d\223\b\206\322\346\221\234\264n\323\270\255\204\242\231\274\223&b\300]\n\211\247\241\272\316\323B\337<\234\353\262F\005W\030\362\2701\266A;rY\225\343\2022\2713rC\274Z-\342\272\002\036"
+	.string	"M\204~ea\314\221E\314\024\001\201;\225\0324\206J\030\004\344!\026D\224\026\247_\226Q\240,\306\265\252\2700F,\343\200\375`\024\\\006F"
+	.ascii	"\34135\n.k\232N\324\342\246$\024\243f\317J\203\254uB\001"
+	.text
+	.section	.gnu.lto_findSharedSerialPort.48.2f90a5e22214f2c0,"e",@progbits
+	.string	"(\265/\375`\260"
+	.string	"\225\013"
+	.string	"\246\326RC\020o\234\016c\001"
+	.string	"\220\024\036s60yt\366\321\342\251@\311H}\031\300\350e\261\373\330\222\255\375\261.\017\355\256\001\212)\004\b\024\240\253t\225\353A\242\017\024uH+\322D\rUj%\277\333\336)\005="
+	.string	"?"
+	.string	"?"
+	.string	"\230\353\324\"m\373\034\336!\364g\244\222F\026\f\027\241S\214\335\212\271>\204rz\035\204r:1\374s\371\361\177z\265\241\264b\024\211\227\226\200\335\265\034E\243{\3366\306\366"
+	.string	"\373'\001\026lK[7\375\364\365\257\246\364/\017\025/"
+	.string	"\244v'\244d,\212\242\320`;\264+\266\253\017\007\021\336\324\240\262,\204\n$\223\353\364RMi\277t\017\341\253\003\323]\n-L\354\326\022\007\362\2435/\021\246\350j~\006H\021\232\001\222)k\310\337,($\177\210\223\350t\220vA\037}\021\037\301\3613\234\272\353\310\217\247~\347\363\310\217\226%N\240$L\321\256\242\234\027\354W;\003\\\267\201\032\347!\260\0017\003\0074^\266\371>\024|Y\001\256\333@\215\363 \330\260\226Y\220m\236\346\303\272\r\343\266\214\203i\336\207eD\3341\320x\030\330u\036V\251{[\363\002\232\017\314!\351\374\264\023l\001\016"
+	.ascii	"2\003\302\260i`\027\267L[.\344q\232\025\226\261\030\330\017F"
+	.ascii	"\301e15\031\234xR\255\230\204I\006"
+	.text
+	.section	.gnu.lto_findNextSharedSerialPort.49.2f90a5e22214f2c0,"e",@progbits
+	.string	"(\265/\375`\030\006\265'"
+	.string	"\352F\300\017F`\034R:\367\217\022\325\264D\322\253\257\314\330\001?\f\265\335\304\305\222\374\225\273-\344$>z]|hw\3529\277\270\306L\243\304\371\270V=\314\\;,\357\307f:\366\276\2320\226\205\376\267=i\204\020\271\223\f\346"
+	.string	"\330"
+	.string	"\361"
+	.ascii	"\374cfT\354cL\347\222\003\005\272OL\270*\254O\021\240m\231\017"
+	.ascii	"\3660\246"
+	.string	"3ypz\357\2228\264{\231\022x\301\372\024\310>\313\277\230\030I\200\371D\311{\213\023E\366\274\227Id\346\203\324\247\353\003\250O\333\311z\224y^9\330\310\013\203\300\237\257\267\362\324\024m\213\344\367\270\220\255jy2'\033\204R&9p\370vG\227\245\\\376\227\"\f\016\353>T\002\025*pg\253B\202\016\301\200\271:\332\021\333CySUng\2532\202b\240\233;\3624(\273&h\242\274:\017\335\240\305\013\212\320*\nm\261&\231\257=\301\224*#V\345uH\373\203\2569WO\177V>,\312V\205\205\"(\273\225\262z\262}\262\243V\300\236_uY\312$\267\274\016\367^\266I+\345\371\347\314\217\300\314+\230S\251Ldd\2374R\237>I\247\311\336\361\177T\323~\277\371\020`aM\250\245\223\275\263M5-\272\356-f\246\223m-\263\"I+n-\346\3252\201\325\262\320"
+	.string	"\237\345\240\253\235\005\264\345"
+	.string	"w\236\207@\313"
+	.ascii	"~\226\201\330\362\017\320\262\360\\\376\340\231?\360g\331\307"
+	.ascii	"\226\325\236\345\324g\031m"
+	.string	"\313\266g\371\005\024p-\261\234\310\3517\346\245\272\343s\331\244N)w\376j\347\243]\215\277\306\2773\246\233\335\311O\243`\201\351Ri\350\202\373z&]\f\353P\"\267\374\362\302l\306?Kz\030\343/TU\217\312\307\2329$\326$>\030\n\026\222\376\345\210\240\007\363@\027\334\227\327\275L\bOyh}\312o\276\f\307\275p\247\331y\335{\337\205\371\207\203\371\367\32423qO\217t\345\201Z:EI\342i\343\365VP\243\2554\026w'#\265\234\016\031\226\262\331\361\232\343\341Gl\356)\347s\037\3564\252O\203:e\263\203\005\314y9c\204'\311;\231[\034\216\007\016O\356\275\030\342\376\346\003\210\020\366\311\020\352S\001\335mI\"\303\016\320_;Qln\354\255\331\247\233SubT\021\177\033\221A\210\235[\233\033\264\217v\024\213\020\273:\260&\026s\347\007V\312@\005\320\037\204\rl"
+	.ascii	"]\240-\352\352L\336(\275Pn\240\002\365\335\306\336<Y=\034l_\003"
+	.ascii	"\265z'\352J\330\276~\031\2278\233\023\275:rOf\336\3615(n\006"
+	.ascii	"w\357\023\006\025W\263\342\247\r\037\257{\237.\240y\032\026."
+	.ascii	"^\300P\237\n\373ewPG\256\016,m\333\006\354\242\3724s\214\237"
+	.ascii	"9\336\r\356\336{\201_\346f\212|\256\247\001FK\305\242\243\"\244"
+	.ascii	"\"QO\207Q\021\322Q:4c\351\210E\221\221Rq\306qH\343X,\201d<Z\""
+	.ascii	"B\302!\003\310D\023j\024\217\224\214\216D\343\021\021\351\250"
+	.ascii	"h\203H\244t$N\020b\343\r#%\342\222\321\250D\3741\233\336Z|\262"
+	.ascii	"\017\305%\233gA>R=\332}\\w}~?\255\252\315\035\232\332I)\354-"
+	.ascii	"\346u\326X\232\272\343\372L\373dw\220\226\247\356L\232%\317\340"
+	.ascii	"m\220.D\334\200hO\250\t \253\034\017\362\312\372;&\220X\326{"
+	.ascii	"\357O\367\250\334\325\201i\230\232\002\362\373\020\252'\325r"
+	.ascii	"y;\353Bn{\254|\275\305O\373P\233\\\363l}\234\177\355'|\254\211"
+	.ascii	":S\005\264PK1#\263\250B\303-w=\352\264\211{\262z\222\364z\213"
+	.ascii	"{gx\003:M\246,\265\376\250\016\373r\320{\357]{k\314\207=\240"
+	.ascii	"\237\026v\250q\034\304\224C\314\f\215\314\210$\005J\007P\002"
+	.ascii	"1\250\256l\003\021\320\271TD\345\314\001\255U\005@T\236\343\270"
+	.ascii	"d\273\017/\317\251*\215\354o\344;\030\340\236\255\006\240\316"
+	.ascii	"\334\276\377\266XNf\b\232R\364\177\323`a\252<\204M\024r\032."
+	.ascii	"\243\021\314\"\252\204\317\035\262\033=\215\303q\306\305\270"
+	.ascii	"\365\255a\030\020\017|j\256z\360\267\260\300@\222\r\222\265\226"
+	.ascii	"\026 -/\363\223\250\375\220\206\037P\356m_\300\345\374C\213\f"
+	.ascii	"\n?\003gH\213c)$\330\214\372\313\202\306_\201\306\023\261d38"
+	.ascii	"\362!Z\266q\317\247W\255\017OF\247\215\253\273aW\026m\035;`\343"
+	.ascii	"\355\326\005t\024\314\031\331\213P\367\007b\216\326+C\251\244"
+	.ascii	"\031\347Z'e\306\274\243%o\2619x\377B\341L\230\332\255mA\024="
+	.ascii	"\325\332]\306|\204\361\334X\202\224S\tEIC\"\006\240\035\366\f"
+	.ascii	"\345\007\322\300\352\360\007"
+	.text
+	.section	.gnu.lto_isSerialConfigValid.50.2f90a5e22214f2c0,"e",@progbits
+	.string	"(\265/\375`\315\005\275&"
+	.string	"\212F\210\017Gp\336M:ka=C\016C#\2554\001s?\252\3601WK\204Ib\006\353\0340\224\032\360\243-f\365D\213\374^1\233mj\203V(\345\005\321\013\235\362=\315\017\001\217\277\260F1vkjM\332&D\356$\003\344"
+	.string	"\322"
+	.string	"\351"
+	.string	"g\246\342\207q\312WN%U)oV\005,w\222M?\271\002Z+\363\223\257Bu0\031\007\272\267\213\f\227{\225\f\370"
+	.ascii	"\372\223\225\037\262?\321\007\331\237\017\"P\261\360J#Y"
+	.string	"\367\002R\034\273s\257\362\327E\030\275\251<\363\252\360\276\036/\335\351\320\234=\315\256B~\325}\246\202\2439\024V\254=3w\303\230\346m\306 \346\2047\267\037'\033V^\001\"[\\O}Z\305\035\023#\220\2523\207\262\222\\\275\315\370\303T\020\247K\235/_\200\211\321GE?\343\370\234i\001\314\216\254\267\031{\230\365\b\233\267T\253X\255yt\034\223\343mF \246\2012C\334\020\353\251\343\246O\213\206\231\264|\305\322\262\252}\262+83K\342\021\262\305\365\232\273p\357\345z\245\265u\3669\363\225\2309\004\363\271!\277b\346\016\317\002<\2305\367ZMPq4(\364^+\tg\302d\360dF\276~\362e\330\237J\375\345\317\035ga\256v\314\250q]v\003O\227n$\263\262\252v\327\362\332\341\342\356b6\260t\263\263\322\301\376\002g\345\244\2632\022W>\372\330\331\250\210(W9"
+	.string	"W\036\262\225\205l\345 [\031\200\255\fd+\377\330\312>\266\262\357\254\334\263\225y\266rj+\357\316\312:[\031\265\225s\266\262=+\237W\236M[\271\236\225\177\200\211\355\310\345\305\325j\2247+N\317e;\275(\271\331?\366+\337\314e\374\245\031\214_\242Q\267\305fJ\234{\225\036\320[\341\223q\372\223/\366+T\037\3434\264\312\210\226-\245\304\271\367j@\177&\231\001\215\200\210\222j\303\312\0237\333H\376\362:4<\326\314\245f\263\213\232\250\261\026\\\250\007\020)\"\266\026\027\324B\235b\017\321\313\360N\362\230\005\240\203zD\226b\017\240\376i"
+	.ascii	"Ma\214x4\177\032\250E\250\3714\257\177\272)\313k\\\021\242\345"
+	.ascii	"k\237\376\251\365\332\307\340\357^7\330\2236\332\274&\220\326"
+	.ascii	">\320\3224\331u\332\t\320\350zW\337\272N0F\204\353\332h\347\324"
+	.ascii	"\210KrT\324\340\3309\247Y\333\271\026\360\346l\333/\302-\370"
+	.ascii	"\373l+\007\255\214\b7<\033\371)[\324K-u\346F<\016o\246,\271\306"
+	.ascii	"l$3Y$T\216X\033\253\232\207\177&\373Fj\256\305\036\303\032\307"
+	.ascii	"\357\332&\235\"\034?\375\013\212s\316Z\024/]\240\034\\Q\213\302"
+	.ascii	"E\230\f\362\277`\3649gM\n\330\265\300\200`\344^\253(\200'\242"
+	.ascii	"X\354b<\231\210\002\236.\242^\0041\270\220\n~`\321\002\212\247"
+	.ascii	"\302\351)\005\206 \b\024\300\023QA\fA\354\324`\005\t\240\324"
+	.ascii	"S\213_\020\370\213\002\222\200\3729I\265\3705 \342 \213'\251"
+	.ascii	"\237\213`P\352\227*\357\273\213\037\366\fl\334\312\266\364~\241"
+	.ascii	"\375\362\034\330\240\225m\311\235\355GG]{x\364\231\274\2426\353"
+	.ascii	"\247l\200.1e\315\016\300\344\244\316P\r\331\2047"
+	.string	"\342\222^#9\375\221\242xx\034k\323\215\032\213\315\224\250\037v\224\216\016\270\312XF}\270\233\367\336\313k\244Q\033\350\223\275)\307\03015d\265\241\304\3250\223\n\355P\037\354\247*53\t\247\372\253\241\036\200\343\t\233UW\361\327\360\314\333.)\205#\326\346L&\035\211\327\227\233\256\221\374\264#umR\346\315L\233\031b\250x\241\215\374\022\225(8rb.\024s\250Q(\303\fsH\251\021\031\221 \243m\306`\002\031\262\243n\020hi\322\fc\032\223\266\211\252\203\266\256\fB]\261\252\203\211\345\030Ci\177\275fh\230\033/\344\310J\206\213~$\302\265%\326\2610w\006\254`\346\227h\355\004\372\317\367\"\344\371z\347\023\035\332\311\342!\252\331S\265\251\327R\214@\034D\300\267\261\323\261i\370N\312\277\177\266C\313#\276\276\343j\272\034\023,\031\212\303\034\334\001{\273\203[\274\334\206"
+	.ascii	"`\361Q.\003\232\240f\247\204\356LA\372c\3153\207\267\002=\246"
+	.ascii	"\020<\177\271C\356\301P\016\213eW0Z X\ru\255\367W\016\002\207"
+	.ascii	"h\336~\016q\016\2572\3018\217\343\253\331$\257\253m\346\231\257"
+	.ascii	"\220\017O\205'\243\262\352X\020\327lU\264\204\327Y\277\220\235"
+	.ascii	"\005\\(\231\235_2{\211N%\360\373\242\346\017"
+	.text
+	.section	.gnu.lto_serialFindPortConfiguration.51.2f90a5e22214f2c0,"e",@progbits
+	.string	"(\265/\375`I\002\005\024"
+	.string	"\366\246\210J\300\020)\035{\250\202\251\372V&\260\351\323\037\365}\030\200\377\220\031\n6(\376RZ5\252?\300Tf$So\363\323V\235:\320\273\323\223U\022\205m\033\333\330\006\371w\275\266P\b\203,\267=\365\256\242'\215l\"wJ\001u"
+	.string	"m"
+	.string	"u"
+	.string	"\b\304\323\003\340M\374\204\213k\005\310\035\233\026\017UL\320T\255\244\313\344\007\204\247\342\005\204\247\373\301\342A\362\016g\355\253\220\202;k\376\313W\340j\246f\306\207.\006$\211z\302y\3576\303\236\233S\b\276_N\227\341 \310"
+	.string	"\205\017\317\207\356\002\270@%\214\227\2372:\334\334\367>_T\335\230\210t7\237\253\222Z\253gNgs\213\267\255\263]b\317\223\267\271:GR\0306xul\226x\362_]\350\016=\275\347\335s\247\357\361\236\021SQ\017b\324J\363\323QeP$\021\027\372y\237\366\355\007\371\245[\276P\355\025\246\206E\303\263\003\252Vr\201x \277\347\026\317I\342K\215X\016\351\200\252\265\202\234Z\201xz\333\305n\331\236\323\376\317S\270\234l\001\003T\234\007\rF\265\326\004\016\033\"\207c\211\356\316\227\312Q\332pY+c\0038\233\rpw^\355\227\306\243\201\233T\266%\334E\013]\372\371\324ZG\220\216R"
+	.ascii	"\334\250\232\362\335\250\026\236~\351\322\257\304\317[\324B\232"
+	.ascii	"r\266-\234\005\312\213vj\255$\247\366\354+R\0324\325ZG\206N\244"
+	.ascii	"\342\20385\005\226\371\334\251\317\022\236\206\373\362 \225\357"
+	.ascii	")wc\233\277-gr\034\355\356l2\261\225\027l\204\311^&\254\n1\230"
+	.ascii	"l\244\264\330\030a\\\221\305`\243\207MDN^#-\246\342\232\215."
+	.ascii	"\331\370Bq\231\320T\\\"\004<\233\020\243\271Vf3\232\253e\333"
+	.ascii	"W\307Wq\0075r\245/|\321_\236%\225\243\004\262vw]b\333\033\207"
+	.ascii	"\325\356\334\302\241\342\256\323\004\371\\\031'\205s_\305s\302"
+	.ascii	"M\252\203\265\326\032\206|\256\270\357\235\222\3601\301t\270"
+	.ascii	"\315\337\f% @\002\203\230\274m\034\202\230>\003\335\335ld\tM"
+	.ascii	"4\277\034e\337\005lv\203\324[\272\206\202\220^\026\336\001\005"
+	.ascii	"=5\247\243\226\271\332\355\201[\2628\024\331\t\355\272\275\205"
+	.ascii	"\002T}\217fc-o\350\226\004\034'\333\222\311z\352n(\002\323\262"
+	.ascii	"2\301\021P\326\354\334\2535O"
+	.text
+	.section	.gnu.lto_doesConfigurationUsePort.52.2f90a5e22214f2c0,"e",@progbits
+	.string	"(\265/\375`s\003\305\031"
+	.string	"\226\257\246I\240\230Q:\301{\276\023\243\005;\006Lyu\376m\257\343\031\t$\275\232\213\374w\036j\202\255\016\032\324\255\270\335\351\3214\312\336D.\327i\003\257\303\253\274\32281\347K\311\255\210\225\255\303P_\201\2555B\310&{\247\024\225"
+	.string	"\206"
+	.string	"\224"
+	.string	"\273,\234\374\330\335\00460\276\272|@\370\n\276%|e\320`\346\232\227.v\036D\002g\007\324n\331\242-<\036,\357:k\236\032\305\260\202t\326\370F?\340\343\211x\252"
+	.string	"\213\022=\037]f\360\364L\021l\351\3415=\t\017\n\220\325D\303\347F83\004E\035\236&"
+	.string	"\267\033\020B\224'>\347\325f\225a\342 (\201\250\306\013"
+	.ascii	"7\033\220\346\320\021y\3573\347v3\351y\237B\242jN\273\233\211"
+	.ascii	"O\221\302\356z\332n%n\325m\347lS\260\351+)qz<\322-z:\374\321"
+	.ascii	"]_\364\203\341\364\254\323_\261\230~R\004\351P\247rw~Xv\251\002"
+	.ascii	"\211\361\243\037\351\276\217#\371=\257z\314\256\343G>/7;\216"
+	.ascii	"\357L\363\322\026\204\206~\206vw\245\303\357\261\343<h\256\233"
+	.ascii	"\371\336\360\244v^d\201\262[>\030_]\216o\t\217\303\317ye\232"
+	.ascii	"\347\260\317\305\246\334\233\204\244\245!\250\335}y\365\202\221"
+	.ascii	"\306^\275\336\236\331+\333s\332\037:\321\354E!\234\n`\212\322"
+	.ascii	"\247\371\362Jsn_X\351\243rO6\363\n\270\273[\315z\245)z\336\353"
+	.ascii	"\214$\247\233\237\032\f[\025&\220\342(He9&6\363\212\2773\314"
+	.ascii	"\217\204\250L\277\032\273\353\300H\0212\300\224(\250!'2C+\323"
+	.ascii	"\317F\321w\0272\303Zb\223y\020\330{.v\027\302\353w\316p \344"
+	.ascii	"\204%\273\353\340\307\2256\370B\257\356\020\233\267\305\302W"
+	.ascii	"\221\276w\001Q9%\273\023\264\371\243:\035+J\224\342\354\2626"
+	.ascii	")\220\022\225\021)L\201lpZ\0250\031\327\213|\305\270`R `\257"
+	.ascii	"\030\262\312`$\006R&\006\366\"U\206Q\300\301E\312`\037Z1\262"
+	.ascii	"\025C"
+	.string	"\272:\264`d\037Z\n\b8\346\001&k\311\304b\262\326\252\244\235\002y\216/\237\"\3533\244.4Z\363\244!=N\024m\376\302\024\305\201\rV\340~\243+<}\225\234/\034\211k\364\207h\200\215\273K\215\b-\375\020\025\321\346\357\021\202x\334\020)\256B\023\233.\251\336\367\367\216 \013\216\216\212TEs\354\273\212\336\350-OM\"\244(Q\021R\234W>\001C\250q$\242\020rN \023\210\005\"Fj\030\003P\0021\350\260:\021\020>\024Q\215i\f\314P\270\f\222\300%\276\304\027\0258\304;\373s\267\007WU\n\025/\351\210\243sh;%\031\212b\373\256\263\225\264\336\242\b\323\244\325\3572\325\326\322\246o\266\346*\031!\322\005\246\354\224*4!\2046Hpd\245jS,\344\034\257\031s\022\256p\371\251\257\352\332\234\027\274\316\225\337\206\311\222k\212\235\324\016D\341_\354\304\204\020"
+	.ascii	"\322\304\371\257\264\373\223\213\3220\257\231^\370\373\003"
+	.text
+	.section	.gnu.lto_openSerialPort.53.2f90a5e22214f2c0,"e",@progbits
+	.string	"(\265/\375`\372\005\365&"
+	.string	"\372F\310\017Gp\334Q:kQ!\204\306\025=\2003G\262"
+	.string	"\234\005\274\001OY\354D%3J\375\302\236_\307$P\214\217Z?\251\301*\370\265Y\315wI|\352\270E\\\003\344w\271\244l\023/9$\376h\377\223F\b\221;\311\346"
+	.string	"\335"
+	.string	"\347"
+	.string	"\275\314\361\343\n\366u\325v\257\022\002KX\237\262\265\314\277r,KW\352\370qmJY\265\335{!p\202\365\251\001\364U\276\265\304LB\312,\0378\265!QZ\352\334\253\364\261\362\004\324\247\353\007\250O;\t\257G\225\347\3242\335\207\267\323\345V\234\232\242m\231\370\305\373\\pSvu\236\006\265\263-;F|P}\367\347\321j\210\325\241\017\334 \253\036\345X\205\016\370\261\266\346\317\343\020\233{\323\325W\224B\333\025\226?\217B\320\335\3243\313q(\006\261\345\263\207\214B\323\244\025\2547\177 \312\221\312\252(\256\307qM\017\t\205^\200\303V\3650'\233B\001r\024\315`e\212\222\036\362\t\355%\323y\261[)$\224\355\207\335\206asB\363B\002\271\305m\270\367\2625\"}\234{g\376\312\314O\314)Q<\254\270\2210\357,\017\t\375X\016\272\2313\020"
+	.ascii	"\313\004\276\374\005\034\354\374\363.\177\357^\277\317\271\374"
+	.ascii	"\274o\371w\357\372u=\313\271;\317\270+\177\225-\267\217e\313"
+	.ascii	"\263\374\002\026\244`Y1a\322h\312;\265\007\317-K\303<\271\363"
+	.ascii	"7\363\203\275\231\317/s3|1\336\221Y\272\230;\371a<\241\302\322"
+	.ascii	"\321\277p\013\2556\254\255{\357\356b\370d\216>"
+	.string	"&\370\013u\314M\355 k\323q\304\017\303\273\247<\241\302\321\301 \031(*\357\024\006\255\264\255:6\326\247g^\3427y\307\314`L\350\245R\"\030\373\2625\345^\245\203\247,c}\332E\250\266\204\b\347U\343\307\325KJ\311\013\225\213\322\217+\363++E\272\205\337\250\307\034\224\032\021\017\250}\327\r\365\230\233\372\302\302\020j\347\232m\224\006\243\226\226\\\203b\227r\355$s\016\365\3756\\m\030\305\331\344\260\300O3b\305z\357\265cZoXV\2564\331=\347/\344\035*\270N\362\303\376A\215\033f3}\331/v\022;\310\242\232\r\324C-\305e\037\3527\037`\311V\304\315\354J\355$\347\304P\241N\215\226\245\370k\\m\236\354\035\364\336{\323N\036I\305\265P?\354i\225\026\035(,''\3069gh'\203Z\355!\027\233'{\207\357d\025?\323\221>\337\246\334{-\230\255"
+	.string	"\260d\253\223\346\317;\203\352\323\240N\237oT\256\334y\262\340\203,\343\235\314)\216f\205\206\254\261\237a\301o\362\224]\274\2607\276P\237\002u\2531\006\3015\201\276\330}K6.4\246\236&\273\247\231=\354\200\351N2+\235l#\001#'@\342\317(h\224\364+\312\341"
+	.ascii	"\032%\005S\342PXB\247DC\210\003\032\t\221P \361w\302\310\306"
+	.ascii	"\217h\375\021\177\035zGE?\242\0313~\034p\fuI\302 \261(\311F\214"
+	.ascii	"u\b\f\306\b\022\223\200FA\035\027E\230\361\013\016\201J>a\320"
+	.ascii	"\227\024\374!\371\212\206J\276\bA,\244\001\034\372\210B\341\320"
+	.ascii	"\267kz#\341\236\227\036QM\336\017\b5,\314\346\372\265w7ohj'\237"
+	.ascii	"\237f\006\3617\246\\\0205T\250\004t"
+	.string	"\034\240\254{/n\316\231\035+\333\314!\336\206\304\006C\004\2004c\034\265m\343\266\220q\2411\025\270u\235\341\001\005IK\3331\251?}.'i\334\314\330\f\331^\3734\257w\255k\265\231I\230\2607\376t\21392v\205t\221y\211ym\315\272\307{/\003`\225/v\332\2126\217\003eqK\207\373\0025\367%nE7\2633\001l\250a(\245\210#\212\031\"\031\221\t\323B\303\001p\002\2319\254\007\021\260\275S\264\262\307\001\321J\t\232D\030\024y\0309\244d\365T\206\252\025R\0304\314\003\301x\r9\002\324K\220\366\203\327\037\205g\263\203I\005\177\025n\214Dt\024\032\315\370\374g\0305K\302\324x\241ut/\235\331<kD\020\204\257\320\351\020\337@\205`\306\356\230\006\220\245\375w\034\223m`\025{\362\215\311\233#\302\032\214\204\001\304N\236]f\315\242\214\362\262y0+'\007"
+	.ascii	"\252y*\273_\\\264\3616\270\006C*\336\307\3056\307\333%v\3105"
+	.ascii	"\n\257\367\250\300b\025\310g X<B\337^\306\341\bXA:TJ\241\341"
+	.ascii	"\350\002p9\246\002\262\025A\207C4W\276\313\344\233\252\307\246"
+	.ascii	"F\316\370\021gv\247\250\260\035\2574\257\317\374\001"
+	.text
+	.section	.gnu.lto_closeSerialPort.54.2f90a5e22214f2c0,"e",@progbits
+	.string	"(\265/\375`=\003\235\030"
+	.string	"6-\240G\300\030Uc\020\250\021\314\322t\204("
+	.string	""
+	.string	"\330\332\217/PQ\0336\004\006\0234BxF\264\t!m\334\243VE\227Y\206 \313W\251;\347\332\346(\342\2508\342hbJn\346\355Q`\214ba\267\355\277\345\2262\245\213"
+	.string	"\205"
+	.string	"\217"
+	.ascii	"F\367\232\f\234`\274\265y\002\342\355\370\001\342\255iv"
+	.string	"\225\233;\367E\301\333P\322\275\027Ukx|h\336\226\322>\232D\033VJ\363O\271\023\037\021\320h\001\343\246\020\202O\212\"\231\334-,\211\272\354x\320\021\350\320\201A\305\320\304B\007\212L\316\026R\300b%\306\1775js\270x\030Z\360\361cC&w\023V\241\323\310\201\24789\033\255\377\235\"}\361E\001\346\\\234\2322\334{Mq\271\0267y\333<\333\031\354\272!f\215\326\335\321\026\0252\\wvH\035S\236\372t\242\233\264\324\343\317;<\320_\001L\340\241\223q\343H\215b\336\2340_\356\022\213\324\363\363'\362\203\234\310\007\272\034\242\335\367\323\377\371A\004\232\354\246=\3708\321\365\356\275\345}\376\220\354@j~m:d\016\n\245+\023F\231/\344\362\326\017\"\310\376\303\304\201\023\346\315\251\320c\366\222\3565\025\334\332\301x\373\322\366\251\375\336}\320\0164\273\200{wB\002\017\272"
+	.string	"\237\317\217,Mf\210\225g2IXV\213\243\306y\025\037\225\033\252\024\336{\257\255\274\233\020\303Z\326\377nc\364\004m\272\032\016\034\027'a\345\371Tk\205\371\246\334P%\377t\210\027\231Y&K\022\210\264\002\b-\375\034\035\351g\215x{\252\226\311\222\027\240\237\017\326,\330\301\375\264]\037\322\272\260s\357\245 \344E/\237\347\326$b\364\270\230xK\326\372\004\367\"\254c=\3606\251\307\310\r\214\r\rSO\026^\216j\345\331\001+\232\324\fk\306\225R\221%V3.\226\245\201\275:\234\254j \"\305\202\255b\250\027\013\345b\245Z(\025,\206j`\300\257\021+\030\212\346\365\202\241J\323f\306mSkc\345\331\376\221\333!\276dF\276\340\362\243\022\355\324\225\250\216>\264\n\354`\350\301\243\353i\361A\210\366\352I@\214\367^\t>\222\022\254"
+	.ascii	"Rxf\342\355\203N{=v\272\236\026\373V\330\330\231*\317\377]\303"
+	.ascii	"\2230g\320\336\350\007\236\003\n\245[\260\2225\246\342\330\350"
+	.ascii	"15< @\002b\220\223\354\355\314\223\004\366a}\033;\037\3536\277"
+	.ascii	"\325\344\224\235\371\263V\312\302\204\326\027\264\013\037\253"
+	.ascii	"X$=S\361\261B@\261\245\346;*j\001HL6\307\353\230]5D\006\215n"
+	.ascii	"'\\\343\243H\006\301\300C\345\205\f\003\207Dm\211\352\212\350"
+	.ascii	"(\261@o\3623(\025\037*\001\2179d\262\263e\"2\236\267\270-\227"
+	.ascii	"\234\376\233\251\303\005W\360o\226\270\333\241\252\271f\265\322"
+	.ascii	"\211K\245\200\033;+\364\266S\312\301y\211\360\353\nd"
+	.text
+	.section	.gnu.lto_serialInit.55.2f90a5e22214f2c0,"e",@progbits
+	.string	"(\265/\375`.\004M\033"
+	.string	"\006r\260G\260\230Qc\301\335\253\336\002\f\367&s\273t\254\242\nWAI\b\300\264\177.\372\005K8\211h\225\257\035z\026'\334(\315\217\rZ0\037s\320\326\237\207\031\354f\036\003\271\205ps\253\243\371\027\331&RJ)S\n\235"
+	.string	"\212"
+	.string	"\236"
+	.ascii	"\257\226\322\236@!w\240\212\002\327\262\0022\2717xc\007\343\253"
+	.ascii	"s6\226\007\225\356\235\262\354\206l\335{e\323\206\307\323\340"
+	.ascii	"\r\223\271\307\300\306\227\255t\312\234\037\344\013\276\030\341"
+	.ascii	"\371\202\036C_.zT^\325;\242\263\254"
+	.string	",GC\022V\243H\306G\005IEF\177\321\006T3\260^\3253\242\006\220\236\300\370\360\262\205o'm\214W\031\237.\346[!)\035@5\003K\306\247\243\020\220\236\300\210\371\210\344\374\360\225\211EVR\221\214\313\327\205{\257%\317Wt\307n\273\210m\0166\265\001\362<K\2510S\272\031\344\361=\326'rb\217\277d\033\ny\336\253\217\302\276\326\250\256-.B\262h\007\203\344\374\331\237e\351nx\322\260i\036\374g.\274aUz\254\322/+m\255t\245\322\264J\317*-\251\364\t \320\242\262\021\357}Q\004s\247\352\023\323\205\267/\304\037\n\r5\006\365F\242\021\026Z\356\2756\257\3260\276>f{J\373?\016$\367 \316\260{\223\212G\356\2757\236\215\257\t>\300\276\322\013\260\001\3637\247\316\323*\276\307\3129\347uHC\262h(r\302v\304\036F_r)\334\215\023\034\007M"
+	.string	"t!\262\305\305Tz;\232\352\374yf~\326"
+	.string	"u\b\255\020I/r\351FR\f:\177\307\331\231y"
+	.ascii	"\310$\274\"\222^\374i{x\024\256\201\325\275\267\002\024\016\002"
+	.ascii	"\245{\357\354UI\r\303\323\262y\376\364a\274\227h\346\0379\022"
+	.ascii	"\0204\204\b+\302\276~~x\212\243\312\220\353i\022]p!\231\016 "
+	.ascii	"\177o)k\363\013\271\323\216\214\322\275B\347\371E\336\244\343"
+	.ascii	"/\275\232\266\263\343\232\211)h$|j\365\247\206\301\326\001\350"
+	.ascii	"f\333 \200\004\215gD\216O\006\240\022\266\237\031\353H\340\311"
+	.ascii	"\251\335h?2[M\346S\313\351\221\351\334~d\022\b\330v\202v\223"
+	.ascii	"\001\331l7Y,x?i\004\371\030e\313\224\320\034\212\231?\307\216"
+	.ascii	"F\2329\257\244\315a\263\305xCY\330|\327\351\275\367\302\"\034"
+	.ascii	"6i\346sl\021e\222q\304\022\345\2579b\275\346\213\270\344\n\367"
+	.ascii	"\300\n\016\003+\036Q\367\321$\254z\3755\326\316\003\300+B(\001"
+	.ascii	"\212\305b\325kl\235\226\316:-p\025w]Sp\021\224\244\3400\260\252"
+	.ascii	"\2423\266s\352\361\303\006J\2501 d!\205\220Qf$\"\021!m\332\300"
+	.ascii	"\002\221\251*\017\021\360Di\212jj\265\031\bm1\201)\004\273|w"
+	.ascii	"\244\315\177Y\204\365#\314\177!\013eFKqt\202\232/\242t\330\222"
+	.ascii	"G\352l\324B%\t\345\024\0048b\253\340\324\030\244\200\232\247"
+	.ascii	"-\030\007\020\313\327\323jYU9+\341\245)\270\350\243l\341\006"
+	.ascii	"\200\3670\030\311r\266d\203\335K\226\262A\203\004\245\026Ti\205"
+	.ascii	"8\327\f\276_\t\2754e[\313\013\233?\r\311\252\206\241\303\001"
+	.ascii	"\315\243\222FgC\305w*\214\320\351\305[Z\232\214\225\006"
+	.text
+	.section	.gnu.lto_serialRemovePort.56.2f90a5e22214f2c0,"e",@progbits
+	.string	"(\265/\375`\t\002\025\022"
+	.string	"VbyG\340\362$\035b!\271\375\315\335J?"
+	.string	"$\327\332\216D\250\201$K\026\363\222\2105K\rt\006\311\253wo\036Q}w\233_\214^\037\017\375\244\t3\3140gt\310Wr{\\\252 \0161\333[l\204\220\275\345N)f"
+	.string	"_"
+	.string	"h"
+	.string	"\237\226\331:\036\372\354\225\202l\216\244v\327S\020\356.\303{\213\262s\333\224\032e>\321\t"
+	.string	"i\232\2011\347$\207\223C\203\004\264\221)QP;\257=\336\2003q\013!\241\363\271\341R\232\360\310\320@\002^\220%O\037r\260@\232\250\257\335\204\nj\006\352<r\016v\327q\006f\270\273\333\316\261\215b\307\006\001v\030\023S\242j\200\254=\266\310\207\376\325\213\3569\243\345\214V\031\0355\372#\002t\236b5v1T\001Y\247\2714\342E\267\037\3725\263\274\200\201\354E\261n\201\270$%\241\035\273!\202O+\350>\317\262\375h\037\305\205d\037\202\361j\327\003\223\213\335M`\003\335\347\200\227l\237\362"
+	.string	"\2663\261\312~\213+\305\374\037C\370\342g\337\366\251\312!\3150\321Av\230\215E\322\212\221\022MR=\276\303\004#H*\315+\215\3722\272A\023\247lG8\022\314\001\033\273\213b\333\302U\264\024\360\331\335\224\024?r\371?\237\246"
+	.string	"\213\237}\372\260\3553\352jh\352\365\265O\036*\0376Adb\225\"\341\374x\241J\013\025Z,.\337|\265\276\007\337\213K\213\345\013\361\312\211\004\225\357\325\202y\256\317s\371TZ\274\225\027\314;\t`\327\204\326\313{q\271^\036+\334k\217M\364\256\211\203\223\214\316pJ3+\306\024\321\031\"\372\246\213\"\214p\320\304\251;\214\271\334\335\335\224\366\3306UD\177\202\n*N\251K\237\361x\325c\233\252\324\327\360\004& p\002Bu\324\003\241\300\256\323J\330\243+\365\356\261\354M"
+	.string	"o\366\251\345|\202\t\250D\306\207Xl\301\356j\313\206\333\264\3342\213\215\023\034\327\n\251Y\374\241\260\373\266\355@["
+	.ascii	"\026\372\023\350\343~\213\270rZ\230\030\321\371^2D|\007D\032"
+	.ascii	"\262\276oD\335\316E\311"
+	.text
+	.section	.gnu.lto_serialGetAvailablePortCount.57.2f90a5e22214f2c0,"e",@progbits
+	.string	"(\265/\375 \342M\006"
+	.string	"\302\313+3Pm\222\016\300\0040\013jJ \303\222\f\002\037F\241h5\366\226\354\252\375\373vtz\347\r\234\260\337\314\314\024\031\335\267\022\036(\002O\035\326\376\3362\005c,\n\227\251\312h\03255\206\351\262\3200\225\246Y\004\246\0322Us\240\250\252U\260,\206\016\t<\030\361\355\250\207u3~\330\\\257JwC\251t\030P\341\271\354\261\316\241\305w\222\030\372\357\303\001\215\021\b\222\314O6J\021)D\364s\276\362\001\002g\253\030\306\207\"\002\221\370(\311\304\032^\324\352Y\267\034\235l\214\262\013\324\351\001$d\346w\201(:\3667\370\013\376\211\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_serialIsPortAvailable.58.2f90a5e22214f2c0,"e",@progbits
+	.string	"(\265/\375`|\001\355\017"
+	.string	"\206\337nF\360\360$\035^\373\345X\207\210z\221\266[\207!e\335\323\204\346t\247\016\016\242\323\224\351\037\312\313N\342.~\r\271\030\035Q\351'X\241\247\3003\260\235\264\232\2400\0331\205\262,X\375\252\316'\204\354-eJ\001\\"
+	.string	"T"
+	.string	"\\"
+	.ascii	"\266\275\200\301\312\254\17794\337)\202\001R\332\3758\375\340"
+	.ascii	"\355\360\273c\262\236E\250\311\362Y\236Am\006\303\214\017\327"
+	.ascii	"\013\024I\212i\220q\2652\222\2509\204\rxJ\200\370p\271@}\301"
+	.ascii	"\210N\256\227\324\277\236D5ZFA\256\232\2476\262\273\316\030W"
+	.ascii	"\206[\273m\226\355\020\373'\002\332{\376\314ix\237[c:a\372\333"
+	.ascii	"\231:(%\255`"
+	.string	"\354\3224\351\330\030\261\305\316}n\377\363_>\371>*\333\216\320\202\204\\\330\330\375\020<Z\301\366x{e\237lg\332Gq\236\325{V\354\261\353\001\211\305\356&\260\201\355\221\300\005d\217\360\001\262\307\231\252\2467\301d\364b\323\312\246\324\211\301!\003*\2163M\365~\216\\r\311v\204\303V\016\320\330\335\020\333\026\276\342\244@\316\356\212\2508P\312\027\361h\n\252|\314\243\257\312\036S=zT\257\177=\3320\305`v\264d\223\302fr\f\251\342\330\037K\352\315\320\215\013\033\2547v\025P&(]\364P\035\204.\005\005e\322\001p\t\210\004\222\316C\251\270T\307\241t$'\\\211\247\342@\00685\001\345q)\251\224\307\235\276\275\336\370)\356 v\004\023\212>+\373\353\017b/`B\372\2632\b\325#-\332\342\220)\216OEP\323\030\"-\263\245\316\017\222K.\035\356\356\306_%\031"
+	.ascii	"W\bx\254\306)\275\006\322\224\272\356\204`\f\250\216`AD\305\262"
+	.ascii	"\341vq\366\266i\003M\0030\033u\241\013\202I\3064\255\333\016"
+	.ascii	"\245\220\017.\005T\013\252\240\340)\373LE\342uM2"
+	.text
+	.section	.gnu.lto_waitForSerialPortToFinishTransmitting.59.2f90a5e22214f2c0,"e",@progbits
+	.string	"(\265/\375`\236"
+	.string	"\225\n"
+	.string	"&\023H@ \307*\035x\020&\301\023\335\023\031\036\007\230\221\013p\216\013\217\245\260\242\251C\005t\2276\320\324w\264\202\004\215\"\303D8\246\233\t\200@\200"
+	.string	"\245\362\300\357(\330\0253\344\233f\t\331[\246\0244"
+	.string	"4"
+	.string	"7"
+	.string	"R?_g-0\034]\233\027\323\tE\023\232&g\214\271\316\272\222\204$\235*\250\313\263>Wd\r\300\020u\275L\354\256\025\fK\356\355\266-lK\330\226\0050\315\225\242\261}\265\317\362\226\357+\220/\354\246\306\001\273b\204!0\327,\276a\273\2069\303v\315\237\235\340\242j\337B0\022\300\301\356r\362\304S\277k3\340\245\302\253\300\334\335\235\3364s\216\315\356\360\320\203Nx\275`%9\222\002\b\230B)Mlq\244\034\325\030\263L\331_\375S\325\277<,0\020\242`\3674{\260\001\"\257\243\310\330\263\271\350\200\274O\210\353@\\\006\250\203\301y\274\020\267qp\247\361\3618Q\327y\234F\334\313\224+\030\300D$I\373\330.="
+	.string	"\007J:\032A\247\264\273\r}\023"
+	.ascii	"m\231'3\260\316#9\266N\\g\365\302\tc\007(\b\251\0200\217\202"
+	.ascii	"&\324\"\357\022@\263\232\022\334\213[\252T-\003\365\262I\230"
+	.ascii	"O"
+	.text
+	.section	.gnu.lto_nopConsumer.60.2f90a5e22214f2c0,"e",@progbits
+	.string	"(\265/\375 \334\r\006"
+	.string	"B\013*2Pm\222\016\244\005 +**\033\013\021te\025X\223h2\247\242\237}0\207\237)\350I2}+3\323\306P\001X"
+	.string	"\007\025\325\213\333\331\032!;\005m\323\026\2421\027\2066\275\214\206\271\2119L\255\201a\236\206]\002v\017\231\3076\316=f\211\315\005Z bu>r\324\272\370\214\272@\257\024(B\340H;qRR\020\351#\364\247\345W\352\017\020`j@\274Z\213\016\2176\032LPIi\370\"\0313J\t\231Hp\220\264e\013#a*x\346F\002x>\234T\224\204\266+\317\247\"_\371\017\374\005\177'\b"
+	.ascii	"2\003\3169\003\027\216k8t\bC\245&\203\273\274h'\031"
+	.text
+	.section	.gnu.lto_serialPassthrough.61.2f90a5e22214f2c0,"e",@progbits
+	.string	"(\265/\375`x\003\345\026"
+	.string	"&*\223G\260\030U:\320S\361u\006\332\272\352WJD9\211\265\351<`\032G<\320g'K\322\217\336;B`t\247\247<\275u\233OQ\003\370\005r\232\327\235\026\232\3375a\340G\317\213\374\rP\331\264\331\021D\366\226;\245\200"
+	.string	"z"
+	.string	"\177"
+	.ascii	"\247\036/\023\236\212G\205\247\206\331S>\366\324\001\274\332"
+	.ascii	"\212\337\225Z\253jmX\364ha/\231H.\342(\244s%\314\347\355\274"
+	.ascii	"$up\271\233d\304\220$\0034p<w\231\n\206\222Ty\320\3063ej9f\377"
+	.ascii	"\335\300\016\033\f)\236\006.\367\021\351\266\363\360\305\251"
+	.ascii	"N\216\234.\276\223\301\023\036<\247\233l\242`\024y\362\337%\355"
+	.ascii	"\246B\312Q\205Z\253\345\354\206\273\001\334\266\220m\n\366^\b"
+	.ascii	"\253\263\357\273g>\344N\035x\307\334\367\277\374\347?}\374M\367"
+	.ascii	"\371I\377\271)\225\236Sz\251\264\234\322' [\370\310r;\013`\255"
+	.ascii	"\265\242,U\210*\321\361!?\220\310\017\236\021_\210\017\344\222"
+	.ascii	"!D\200\035h\342U\247\232\350\301\363\031\252u\\p\352\t\342\251"
+	.ascii	",\331\276&\022\344\317\211\001\001\252\254w\343\301H\264\340"
+	.ascii	"\322>\220\007\201\335\007\305aj\325\035\t\252ul\340\004b\034"
+	.ascii	"h\344g1{\240\243\200\202Z\\V\341\327\325\223\002\300\206%?\373"
+	.ascii	"\036J\020\313?k\255U|\017\321P\320hw\bf\324 n2\344\220\314\227"
+	.ascii	"\235Y\232C\272\272\003Dk\0207\030rG\256\324\232\3423OyZ\2724"
+	.ascii	"#\177\331\373\260\314\335y\2341\356\352\374\023\341i7\346\243"
+	.ascii	"\322\213\"\223D\026\245\251C\017Q\222\326&\201#?\363\177\177"
+	.ascii	"O\220\207\220lc\366\030\223\273\263\377%6\034\016\253[x}\260"
+	.ascii	"a\271B\013\364\365\301\206\345\242/\0175!\246W\016B\320\260\\"
+	.ascii	"58\252\026K%\202Es\243Z\271pT\016Rn\215\250q\251^\255\226KU\032"
+	.ascii	"\371\253\233\353\231\365j\306\\Rj\347\216z-\254\230R{\"G\005"
+	.ascii	"9\211Q\332\235\177\311$\247\3063\255.\311wK\230v\377;\314\220"
+	.ascii	"\223\235Ye\244\\\323\365\312&@\3125\255\255a\203\374\314\005"
+	.ascii	"r6\346\230\225;\252A+Z\261%\205,2LD\250q<\004\t2\310)\221h\322"
+	.ascii	"H\223t\320\002\0211\263\003\0200\313\204\250\2259\340\241\340"
+	.ascii	"\217bl\210\017\211\220\263\"\364\023\t\211\007\223 \270`\267"
+	.ascii	"\337\325\203\352\332 \310M\240P\027\221\317\211\273\322b<\326"
+	.ascii	"\352\2357d\365-\bq\204\257\016\220{>\353\032\265\263\231v\347"
+	.ascii	"\230\360\274\302\351\353\226f\207\320\240\251\336\253:\b1\345"
+	.ascii	"\250\227<(Jx\020\001\377\307\035\264\023V\362\254\366\032\233"
+	.ascii	"@\3673\223\267\215jlq%=\305z5"
+	.text
+	.section	.gnu.lto_.symbol_nodes.2f90a5e22214f2c0,"e",@progbits
+	.string	"(\265/\375`,\003\335\016"
+	.string	"\264\024(\004"
+	.string	""
+	.string	""
+	.string	"\002<\177.\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\270\300\202\202\200\006%\177/\260\206\3618\272\300\202\002"
+	.string	""
+	.string	""
+	.string	"\005\0360\201\204\001&\1771\346\206\316\200 2'\1773\234\211\365\321"
+	.string	"\002(\1774\005\035\"\200\003\002)\1775+\1776\252\333\3426\005*\032\005!7,\1778\002-\1779\002.\177:1\177;\221\212\227\315"
+	.string	"\005/\033\0020\177<2\177=\234\367\200\311\0023\177>\0024\177?5\177@6\177A7\177B\200\037C\200\003\0028\177D\0029\177E:\177F;\177G\360\372\250\200\002=\177H\252\220\326\001\005$I\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\"J\005\002K\001>\177L\377\037"
+	.string	""
+	.string	"\200\200\200\001?\177M\300"
+	.string	"\177N\302"
+	.string	"\177O\301"
+	.string	"\177P\305"
+	.string	"\177Q\304"
+	.string	"\177R\303"
+	.string	"\177S\003\001!$\003\t!$\003\021!$\003\021\017b\003\022\"\361\344\203\254\001\001\244\017\003\025#\274\201\300+\001\344\007\003\027D\003\034%\221\205\327\307\003\001$\003\034$D\003\035\034\"B\003\035(\344\001\003\035'\320\360\372\250\001\001\244\006\003\035&\344\006\244\007\344\007\244\n\004\035\225\007\325\n"
+	.ascii	"@\250Q\030\205\271j\210\031)\224\033\240\002\031\273\321\003"
+	.ascii	"\021p\030\317\031dH0\001\311\0043\032t\225\256\027n\026\210\324"
+	.ascii	"\003\027\017\b\331\200\035#\265&\374|\375w\362;\245\311\367\340"
+	.ascii	"\\U\207\362G\251@{\373|\353\034n\031h\307[:\203\253T!aM\223\236"
+	.ascii	"\003s\b\323\274R6}\b>\034Q;\332\225\257\274}w\225sg\272\370\344"
+	.ascii	"+]\315\346\3560\314\013\235\322v\254\251\235(\027pa\2224r\336"
+	.ascii	"\205\214\206\257g\200D\003\253\n"
+	.text
+	.section	.gnu.lto_.refs.2f90a5e22214f2c0,"e",@progbits
+	.string	"(\265/\375 \371\255\004"
+	.string	"R\314\036 \240\247\220\016\377\377\377\377\377\377\377\377?\240yy\373\267\337\376\377og\333\336\255mB\b\2212\005\263\f\265.\214\315\235\\\205^:\201\363F\340t\274\334\245\017\310\002\307\317\275\202\270\321\327\361\303=\021'\304G\347qa\006- \350\265\247u\240\3634\200/\316\003\320'\250\327\367Pa\256zb\275\305\004\271\352\215}\261>\212\263\212(\207>\350K5\235\275\360\222\007o'\377\206\b"
+	.ascii	"HJJ\314\013[\244\245\201\b\264\324\253y(9\355S\211\362\004"
+	.text
+	.section	.gnu.lto_.decls.2f90a5e22214f2c0,"e",@progbits
+	.string	"(\265/\375`]3\245\324"
+	.string	"*AUGW \214I9\351\013\245Z\315)Nq\350S\332ZW\241\320\037Z\ri\021q\266\357\357m\265x\n\353\364\372C-\275\275\234\3375\372\250_\355\274\222\323\372\313\374*\275\314\206\206\226\300\034\212\037a\025'z\361\327M\177es\263}*$\332\231P\322\030\252\325\275\267L\001\257\003w\004\221\004/|1"
+	.string	"\351,\276-\372m\323\006Y\"\032)sFJ\026[!\353\354u\204\035\202q\256\371\013\306.\313\r\261\264\364=\202h3\202\210\363\332\305\304m&\036\016\032\211Yl\323\035\210#h\006\355\204\210p\021\221:\235\224m\031f`\263:!U\025\022Z\251.\303!\213\007\333\tn\212\220+5\021\330P\332\357r-\265 \324\347\327[Z\260\327\016\354\2777\226\316r\020\002;M\320\217I`k\031\364\313y\345"
+	.string	"\207\003\016b\362\346\b\257R|\033M\211Rt\026Gz\326k\335G"
+	.ascii	"+.\201\026_\301!\262-\371\335Y|\233\224\352u^"
+	.string	"\343\365]\357\265\225^\233\257\347\336t]w\274\232h\276\226k\262\313\265\224\242\tQ\361\3139\277\243\330\351Ia+\206Q\345\201\320|]\245\237\3345--\362\202\363\203\243\322o5\315\233,4g%\232\363j\342\377@\204\346\353\270~\273k4\013\315\251\231 \024\250t\203`\316+\016\0076v\201bl5\370\335$}\\\177 \316\264\222\364\375#}c\245\357\032\322\267Pz\261\266v\3535\203\236\362\017D\370mv\345-\232\303\"\207!H\337\031\020\273Kg@\374N\3724)\375\201x\013\244\304V\353&\275\212h'o\264f\362\227\2405\2579\2576V\007\2271/\213\357B\372\026A\274]\272\264\b\342KHm\\w \336\364\007\2632\030$B\234\322,~\227\265X\223Y\251\234\2359g\nj\326\350\272\226z\254\277\302\262\n-\376\006\251\315\375\201\030\242;\020{\211\2117X\007\342\022t\3156"
+	.string	"`\262\246fq\361\353\357#\275\325^\367y$\225\305r^9\3405&\276?\213\033I'\351\265\275\376\346\352\256\343.\251\374\225s\246\221\261J\023\013\2628D\177 \342+y\315T\316\"\334\246-r\316\271\330_#~\355\017\304\264;\020\377\366\300ouF\360[\036\021\374\275\"\004\226\206\277\351\376v\301\345\367\277/\277\305\300o[\374\226\003 \350\003\324\313\202\377{\207\301i\376+7\305~"
+	.string	"\361\337\265\013\244\370\315\177\313&\360w\212\031\376\006\32102\031\374\327K\203\036X\277\205"
+	.string	"P3\321\316\341\277Q9z\226Y\200\260\253\3647\230]Z\345\330k\376\033\243k\310\310\177\230\377\272\370\341\341\277j\264\003\320\037("
+	.string	"\0062\307\371\357\007\r\270\3607\316\224\313\374W\205\247\377-\341o'\373\323\364?\346\277\006\370\017\370_\313\177\274[\371\237\367\377\356\277\335\365\036\370\277\317\310&\177\253B\327+\370o\207\337\036\340\267%~K\342\267\035\374\326"
+	.string	"\277E\300oMX\020\277\025\361\333\002X\026\377m~<\303\304\337G\377\373\277\027\374\326\347\267=\277\335\371m\316o3\360\333\030~\033\201\337\242\370\355\b\277\r\341\267\037\374}\370w\340\337\200\177g\371\333\357\357\275\277\363\376\256\373[\356\357(\177\243\375=\366w\330\337]\177o\375\375\343\357\350\337Z\177c\375M\365\367\323\337\320\277e\374\215\364\367\213\277\203\376\336\371;\003\177+\377&\301\337\034\370{\203\277\221\377\257\374m\301\377\301\277G\360w\b\376n\361\367\002\376F\341\277\317\337$\376\006\372{\371w\362\357\227\377S\376^\361_\304\377\261\377N\376\226\371[\305\337\352\337\306\2775\360w\007\376\316\371{\003\177\213\370["
+	.string	"\177k\360w\210\277/\370\273\370\237\313\177\303\377\205\377\t\377\227\375\367\372\237\342\277\333\377\013\272t\351\322\345/\032\376\251"
+	.string	"\376\001\220\b|:\324\254p\\&KD\204S2$\264\370)R\372.\322\327h\275F\027\t\346\211\r\273\370\345\245\247\016\212\2034\260\240\367\310>\340H\307\215\265\310\325\227\366$\320\351\274/\332k\nt\204\315\221\2709(\317\337\027W\007\f$G\267\b\306\306\222\036\235-\272D>_~R\006s\372\264\322\002\275C\375G\343Dd$,.\375\315\267\371\033t\203\254\2254\347\334\003*c\304\213O\322\333\237\230\203\226r\316M/k^\022\232!\366K\367\210\237\246oo\220s"
+	.ascii	"XXs\323p\207\226\024\bZ\220\215\207\310\177\211\313\3319\325"
+	.ascii	"<a\212\31195\343\3715\225\233N\255&\207\245<\325|~\345\314!;"
+	.ascii	"\235M\007He\016\317\257\314\224\207\2520u^\247\232\331)\2259"
+	.ascii	"dg\016\n\361tN1=\277\202\2308<\277\246\230\362\327T\276\311\316"
+	.ascii	"\240\245\027\316\274\304!\177M\375\345/)\246\233\347\227\024"
+	.ascii	"\323\363k\n\252\365\236\205\202L\201;\250\370\372\357\351\314"
+	.ascii	"IHOAK7q\317U*\343\345\334bDyi\203\234\237\244\226\360\202ft\232"
+	.ascii	"P\\\222\220Y\220T\005HBTR\331\031\367\f\"\225s\020\241\236\214"
+	.ascii	"\024Bs\215\313Y\035\327\254z\312GD9[\200\224s\263s\\\316\271"
+	.ascii	"\231s..=\2559\327\270yF\221\220r\206\342 \345\247\246\032Q\316"
+	.ascii	"V,/\215\351\371E%eB\r\354+\232\213\326fG3\336\324R\372\325\344"
+	.ascii	"\312GY\322(S\f,S\326\342\216\255\263#.;VaO,~\361\252\260W[h\353"
+	.ascii	"P\254\271\311\344\022\365$XlJ\355\240\265\202\226\360v\320\006"
+	.ascii	"\3168W;\210s\016\352\326\240\246[\203\2275\036A^D\374\342\321"
+	.ascii	"\026\013\b\310#\314\315&\210\312\351\343\357\317f\301\311\367"
+	.ascii	"nJ\324\023\021,/K\306\350\336\374\322\023\241\360\255\226\317"
+	.ascii	"\366\365\232\225:\024%--up\245W\234\232#\177;\220\030IO\224\332"
+	.ascii	"\323c\363K\372\263\330\346\341\261\241\263(\026\237\310\204\327"
+	.ascii	"\253\265\362r\244\311:\243\337^\250\266\354\241Y\274\2562iPc"
+	.ascii	"2\354\352f\340\206\240\001Zl\353~;g\351\254\215\031\233\273\031"
+	.ascii	"c7,N;W\341q\007\227<\001\221\203\341\325f$(\216\312\rCWI,\256"
+	.ascii	"\261\232\245j\321\265\020\356\255\306-\213\b\215\267)\020\270"
+	.ascii	"+z\263x\211\001n?\256X\374\256+\362lf\331\036J^P\277. G[?\220"
+	.ascii	"\242u>,Q\215\363&;\251\222\242]G\270\020y\261e\225@)\2642\214"
+	.ascii	"X\242\216\023s\300V\227\264\226K\200\221\301/+\206\201\320s\005"
+	.ascii	"h\237\037\232m\263Q\254\024\313f\317,\023\273f\335\254\023\013"
+	.ascii	"\305>\261f\266\211U\353\325\246\331\244\3331Kv\234\255\262\363"
+	.ascii	"\021\315\321\260\321 \226(\314\313h+\315\336`\207\030\315\301"
+	.ascii	"H\263\253\365\252q\256\231)FI\252O\n\00783vG\326`\204\300\177"
+	.ascii	"\251K_\236f\305\302\304\270\366\362\326\037wh=,\006\263K\222"
+	.ascii	"\314\345h{\222\376\205\t\227\355\262\tD\322b\327\305\205\304"
+	.ascii	"&\231\t\322\244\244\325\003\311\013V\372\027\250\364/L\351_\234"
+	.ascii	"\351q\341\220\013y\211\366\350\342\2638\316f\346\360\310\034"
+	.ascii	"\016,\351q]z,%=.K\217\223\244\036t\007\242\325\032r\342$\207"
+	.ascii	"U\312\303\356\250\202$\203\351\270\335\361+3\030\330\3608\223"
+	.ascii	"\253\262\330\332\320O\272\234MY\263\370\200\347\223\211b\003"
+	.ascii	"\025\234\305\3075r\\\3118i\323\002x\325q\320|\357\266\242\236"
+	.ascii	"\210"
+	.string	"`\365j\257\254\325V\325\241\223\303*\252\274\024\007\304\342+\353\222h\241\221\251\356#\326\300r\203\013GT\315\030\241\220\305\007\301F\331\033kV*b\031E=I\365j\243,\324?\020!s\200su"
+	.string	"\001\022\004\343_\262\364w}\262\0213\270UE\212\3055d\312"
+	.ascii	"\225l\320J\337uf\226\206\235a\235z\265P\033\343V\206\255\341"
+	.ascii	"8k\316f[\026j_\330\2433\2572\250E\262M$\020-\301\300\230#\263"
+	.ascii	"!\232\002\246%\305}s\237\232\230\256\224$7\035\026/\341\032e"
+	.ascii	"O\330\224R\253d\223\276\346\234g\240\254j\334\240\3646\320\032"
+	.ascii	"\325l1\002\214R%\2650hn\220\323\033\032[\372\333\247-\nnDl\344"
+	.ascii	"\370H\023(\253\251\252\"dv6\242\026\277&*}\rTH\257X\210%:A,\007"
+	.ascii	"1\215\210\322\354\203\023\314KR:\340\300#n\310]\020\034\244\t"
+	.ascii	"\261\363&g\252\2664\230\247\224<\2605\234\217\233z\305\031\377"
+	.ascii	"\270Oh\216\261\001U\333S\0073\204T\360\326,\366Q4\242Q&&\226"
+	.ascii	"\276\267j\3003\360d@\261\323\026\025\033\370\206\220)Q\030\253"
+	.string	"\343\2407\331y\266\347\247\003\323\300N5M\0169W\301Ey\340(\356\201w`\033\260V\257X\007\206:\216\201e0\301:p\215~\322q9N\330z\223\261\003\354\021W\203k8\037\006BO\024I\3620\026\226\302W\035\007]s\223\f\023\037z9pV\257\030\3538k\316b\034T@ShE0\t\361\n[\245\301\260Qd1\256\372r3\252\3121\325+\246*\372\301E\313b\214\343|\370E\023\206\321Z\rjG\336\254\322\323D\245\247iJ\361SZ\347w\203\346(=\3153=\215P\372\231\302\3643[\322\037\317\300N/_mZ\340\260\323\333\334\333\221\020\226\324\256\375\2018\242;\020q\022^\302LF\322\256\312\362\322c\245\026l\240Rf1\356\257\021\361\3211\222[\217(\022\fl\204\2475\306\365\226\036\277(\353\242\205\206\305\370\231\022\315\240\211\210\271q\026e\303\342\343\347\217\203\260\020.\352"
+	.ascii	"\r]\360\020&:.\302\316\214\213B\220\3129\b\027\331\030\346\034"
+	.ascii	"d\323\255A\267\006\330\bU\0172\"\376\fYz\274\376@\244\2413q\334"
+	.ascii	"\224\201\203\342\247$\310\340\340=lh\002|(E3\224\310\210\027"
+	.ascii	"\244!wb\\~\017\207\256V(\213\257\241m\262=r\240\371Y|\013m\323"
+	.ascii	"\213\326[_\224\305\227\320\356\021\235sK\330\366j\234\274M\025"
+	.ascii	"\261\3703S\201\201\267.E\333\213\261\033\362\007f\b\bx\243\240"
+	.ascii	"\350\321fW%\204\317\016\013\226\233e\002\260\036L\374\246\374"
+	.ascii	"\305\230\262\370f\3517\031+LD\220\220]\271r\375R\264#<\272\b"
+	.ascii	"\355,\276~E#Tj4\366\356^\277\305\b\225\255\035\\&\353\356\356"
+	.ascii	"\346u\316|\024\200\005\211\263\362\233\207F$I\024\213/\236\035"
+	.ascii	"$3\213\372\222\201\232\233\273ui"
+	.string	"f\262\205e\003\312\245\373\255\213\271\262\321\334\222Ibc\273riQ\317\306K\226\252\247\266\270_\271&\033\212\034\335`\361\245\322d\305\300**p\366HfI\325\031\020\213\357\233\355a\223\225g\344i\361\235r>\354\254\362\341f\361u\263D6[PM\332\254W\027\246\331\275Pr\301\262\352\222tY[\273QP\350@\212\361r\222\225\003\312o\024\230/:\036M;5\265\353\004E3\213p\246\360\354\217\255\311\257\223h\225`\021YY\331EKs\226\r+d\250\205v\366\213\366R\306\346\344\214\211\325\353\233A\307\304\214\216\312\215\2554G\020%\032B\306\306n\330\035\\\224J\\\241\016\034__7\314\346\034v\307\347G$B\333a\b\366\033\326\364D\250I\025\213\357\222\230g\222$\267\013E\263\261\320\256Z\027X\016\256\337.;x\341\336\n\331,\276\353\035B\363u\007&\305\342\253\244\237\320\335m\345"
+	.string	"\f\022\344n\241\310\305;%%\034^\351\021\371\335:\222\206\345(rW\344\032!\322e\251\345\335\025\2717\334!@\374\254\320\356\220+$\256\315i\352\312Z\201X\033S\223\037?\256V\332\214\222\361;\333\323*\022}\2577\332\204'\210\345\314$"
+	.ascii	"\2576h\007\366\217,\360\311*+\353j\311`A\243\236\004i\302\260"
+	.ascii	"\210\275\331\360\253uy\004\032\251\331\361\370\235bfTwe\306\352"
+	.ascii	"\220\255OG\317]\300\367dr4\303D\016\214\211\305\207Y\262\262"
+	.ascii	"\272X0y)gh\276u}QODB\200\345\255W\277X\t\b\342\024b\233\342\266"
+	.ascii	"l\021\333\002u\250K5A\226\3129Z,\033r\363\253Q\252r\304e\361"
+	.ascii	"\245\272S\215%\t!\225\251\213\343\213\306\341X\r\033\026G\203"
+	.ascii	"\206\224\215\021cv\006e\004J\215\032\367\251\255\306.\331\214"
+	.ascii	"$$\033\277O_\243\221\253kz6\031\207\241f\017!N\275^\247\013\215"
+	.ascii	"\021b\022\365$\210\207\260\025\301\2703`\202\002\305\264\206"
+	.ascii	"V\017\320!I;\224\224\256\214\342\020\217\247\021\251PV\221\337"
+	.ascii	"\322\257\214\033c\306\354\312\260\206\305\267I&<\310#\363h\254"
+	.ascii	"\300Re"
+	.string	"\272@\241\305\013\036v\214\352\013\314\243\262\0022\357!a\201\013\243\217\272\363\342\202\371\303\342\001\027\274\207\304\217\0163\007\251\376\270\360\243\223\342=$4\330Q[\274\260BG\3559a\301{H0\227%\324\035 \037\035\344\261\204r\tT\002\204\217\017\020\022\231D\026\2319D\020$\221E\025F\325\0073\325%\013\225\005\361=$\"\220b\005\030J0U\036\245\221\031b\205N\322\347\204\252L\236\260q\361\223<\221\363\036\022<?%x~:\350 \201d\220*\254\362e\2313\303\314A\362\374\274 y~\256J\303q\211\227KU\271\263c,\272\370I\352`%\363\347\356\250H\236\243\217\261\270\243.\201\260\272,^\231\303\363C\202\006\273P2\227G\036\365\205\017=<@Ie\017s\2714\362 \217L\346\221\305\022iT\246\350Y\036\221\307\024\222)\224\311\024\230G#\b\b\260\\\201\211\004\3629\032gh"
+	.string	"SUa\206$\213\033&\022(y\302\206yD\256\240.\223>:6H\365'Y\263\214a\251&wp\214J \t\354 \217)\\\260s\3641R\240\203\207\035uy\234@\315\341A\036U\344\221\205Re\252;\036\230-\324\026pX\250\314\245\013\030r:x\250\300\005\n\001X\302\25091(\374"
+	.string	"\255H&}:,?\360\034U\344 S`\252K\365\005\236\037\020?I\244\314u\216J\025\251\362\244\017a\004\004\214@B\213\342I0\301\003\023< \236\004\023L\2300a\004\023\351G0q\2319K\026T\026Gf\312\\\036#\320\301'\231D!\347\205Y\001\263\002\245\312\002h\371\236\245R\235\341\250\334\301\300\3104:\240\206\0027\252\217\f\306\0243\020\325\034u'\311B\214\272\223d\201\325\034\027h\226?\311\242\3124\276\220\2524\034aH\231\251rf\307\250\242\3609\032S(U\025*\200Ph\301\234Q2%\240\316pTu\324\027pV\350\030e\360\3611\236h\241\214Q\225\306\236\353,\2310\300\260\203<\252\270\200\2714\372\3000\2279*\217q\031\003\007\3462g&F\315I\301C\312\314\371"
+	.ascii	"\004\246Re\352\030\225\306\036\235\034f2)\203\252\274\251a\276"
+	.ascii	"\207\202'\177Te\tf2\251,!\343B\311TY\250>*\223\202e\316\004+"
+	.ascii	"\226F\026\220\311#"
+	.string	"S\007\t\244b\346\030\363\263d\301a\371\303\303\201\231CB\261\205\272\203\\a\007\310(CN\213\244\f+t\214>2\200X\362\034U \223'\230\312\344\217\f3g\004\023L\344\021(\245\241G\231\2432\215;?@9\037\324\034\245zTqd\"\325\235\025\230\312\244\004@\274\204\022N\204\210\241\005\025R\035\022>\306\243R]\226H\036K \217F\026%t\224\313\022$@\034\322\325"
+	.string	"B\r\271\342\202\367\201]\024\311\020\357\305@\271h\275\025Z\251\021l\253{Ax\353b\254\256L\211\016b\267tpM\306\240 \246B\263\036\026\321\013\\{\273!+h\0136\363"
+	.string	"Y\324\316bK%\363\007\265\232i\271as7\360hd\311R,\242D\356\f\213\355\243Q\342\204#\351\017z\341\364\240(\361\273H\035\330\204$\t\356\303bqJ\272d]\271/\344\fsT\2618/\017\357y\355\371\301 \341\340\252\241w\274G4c5\267\203\352F\311\316\016\343y\320\271\b\214\252\317\357nQ\n2\003\337\035\343\311`\353\272\272q\312\311a:\005D\373\244\020\301\201r>\322\346\216\351\352\004\r_X\214\253\330&\035Of"
+	.ascii	"\021|{\303T:\214\351\220\260\306\312\025\270\032p\307T\23674"
+	.ascii	"&vX\323\306\305D\027%J\024\354\246D\252O\n\336\331\022\334v\354"
+	.ascii	"\226\346d\303\031\333\332\314W\330\260\024\030,{z\316\032!\033"
+	.ascii	"Q\254#ggx\255\273\230\b\265\330\034mI:\304O\216\327\334\350\274"
+	.ascii	"\226,\306N\276\206\t\315\266\246,\306M\260\032N\303h6Jd?\031"
+	.ascii	"6\353\256\254\344\301\207\217@#\2029CG\310\b\2116\361p\331\261"
+	.ascii	"\231\r\264\215\255\310\0206-zRM\322\0239\336\302D\260"
+	.string	"\330\265\233\311\315\256\254TDc\313\262E0?\241#d\270\214\270\344\254\327\261\330q\330\007\"\234\217\210\020\273 \2131\330\361\022\350[\023\277/\274\344\207\211\001b\3655\004Hz\004\244]NLL\026\343\256\363\331 |G\177\026c\256\257\315@\357\004\261\360\nG5'd1F\202\223\364z7\254\3445M\212\306\334v\244/A?\204r\250#\363\303i`\276\305\024b\f\311\bi\222$\215\001\023\025@@@P.\032N\2271\037\023\200\223h\343\301\026(\025SLdD$IAR\247\003\020 \215\307$\273\t\331y\006\347\243\332\212\255\033D\226?\025\342\330\224?=X\252\235)P\317!\242\310D\r\312\252\\\203\307\212\334\372\316\377O\222\2159\3438I\267\210\247\206M\326~\303U]\206\004\330'KB\272\226@\363\200x\t\233EJ5\311\312\212;\b\305l\2320W\261\"\257\221\005\013\f?\006"
+	.ascii	"p\224\377\262\217\201*$\221\331\362\243d\321L\252\352w~W\360"
+	.ascii	"\377\024\357\261s\273\021\221p\321\222+\242Q$\235\3235\031\224"
+	.ascii	"\337~\007gp\001'CCkx\365\230\371\337w\227dY\354Z3\006\316?TK"
+	.ascii	"\302\016\2126P\262\b\370\257\230NlhZ\313'\343\355\200\275\367"
+	.ascii	"P\b\313\005\256\260\241}\376\r\f\002\253\272s\251\255.:G\027"
+	.ascii	"\233\005\253\351\027\252\357h\021\2738Y\246_3\305\322Z)\236V"
+	.ascii	"\213D\366u\032\246ai\325s\320\246\341[\240\255m\031#\003\377"
+	.ascii	"y>\004\223\273z\372..\245=\247\331<\247\341}\303\017R\262i\226"
+	.ascii	"p\300\017\360=gr\b\321\333p\rP\305O@\307\373x\r\233(\323\255"
+	.ascii	"4s\365w\376\n\303\020\030K\002\301\200\257\031\225\303\265.\305"
+	.ascii	";\023m\211QLhuQnJ*\017\223\032\231\253\004X\230\375W_o\245\032"
+	.ascii	"\004\002\346\370\332\225\307{\017"
+	.string	"n\316v\001\b\2627;,\r\3641\261(G@\022\364\216h+\327\234#\214R\017}\201\206!\335K\270\242J\215\341\022\316\362\305\340P\275\355\\\007/\367\353\270U&\212\315\212\0035\370\236\257\361\025=\001\225\234\024,\241\271\204\202\\\203c`\260\323\215\366\367\260\337\275t\302r\27021)\240N\234\312\022\2468\377XX\001\236\257\256\213 \3234\021\342\0023\266\245\364\025\362#3Eq\017\001YQ\337~\b\316A_\373\340\365fH.C\005\003%_\262\032,p\0202\320\241\236N$\262N\032\234&\307Hw\353\255\277\"#\323\001N\353\nE\356\343G\346?Ws4;\027'\025Fp\320\337\220=N\370V\221\344\233E}\031\213d;%\033\371\371)\033j\351\241\234M3\230\302\302\275\206\336\363\260\347\301,.\204\221\276\320\207\307\352\316\363XJ\267F\026\\\313\271\336o\3574\311\350\317J\002@"
+	.ascii	"\210\361\330\006X\267\242E\373\030\316u\361\210\275\242*\267"
+	.ascii	"d\372\\J\360\277\365\265\335\245\232s\203*\025l\266I\026\332"
+	.ascii	"\233\245\260\224(_I\345\234?\344\266\031\243`\3257O\0320\353"
+	.ascii	"\304s\212N8l\253\001\263\326\017)\214\2409\374O\2409\020s\202"
+	.ascii	"J\327| \203\024\351,\200\306\376\b\235\017\037\255\034\320\365"
+	.ascii	"\333\013\020+\f}\241\343\375\207\031\347.i\256\005\031&\376D"
+	.ascii	" \037\210F\301\030\003?\005X\342R<3\233\227\314h)+\360\372'\343"
+	.ascii	"\375\"\207\006Ou\261\374\266\252\356\033d;j\216\217\n\322\276"
+	.ascii	"\360i\221\317P\241G\356\004X}\340\026\006!\361~\312\262\201?"
+	.ascii	"A\233\330\220\274\346[\340\263Q\r\300\245\026N\272\213\246\023"
+	.ascii	"\021B\227p\226z\370\347K\267\274\230gn\277z\303\336R\351(\266"
+	.ascii	"\211\300\020\216K|\324\320\210\t_\336k\336j"
+	.string	"\376x\222\333\247\214\364X\373\270\271\372\214\352\220dn\306\307(\224\251\247\370\326\257\322\251y\215[\313\232\322\"\225\270<f)\036\207\030&N\3435\020\302\210\023\247\344j\206J\346T\243\330\3348U0$\304\037\367\361\035l/\334|c\273\327\nfKA\255k{n\211\317r\3671\266\267X\230/\223\355\251\245\340\002&z\324p\025\032\251\224A\220hA\236p\364\215\375\350\324\216\232%\333\016\330\254\001\325^\251\220%S\0346\362\326\327\232\312\270u\360\024\020\254,\312\365\340|\037\220\322\264\203XE\340\315\b\304\232\005\343\n\214t\254o\013\262s\003{\025'4S\306\0320\370\3109\021\224)O\271\020\332P\316)\355\013\001\372~\272\207ha\034\210\307\b'\271\242\323\301\206\200\227@k\025\b\272\302\n\272\275\353\006\364Bx\310Q\005^\265\017\257`x\035\271\341\223\243\225\303\326j\2137\001\024*[H"
+	.string	"\025\312\375\326\243\005\b\345x?L8\305\376\307g\241rU\255\217\003/M$b\243]wE\200z\320\007\253\243\213)"
+	.string	"N\024\306[2|\340_bf\265\033\322\361/\2612\341\240\206\373O,(Tq\032 .o\2378\016$+\254\023G\027\237\263\353\222\342\037\277\327i\226H\234\307\"\225:\277\315\265\230\301\232\202-hK\211q\225o\332\310N\361\33007'\251\027\371~%\0326x=:W\210\317\311\226U\245c\275D\r\251Hmya\306\230\033Y\022\212eB,\005I9\343!\224\253U\243\344BD&\336$\361\001$\035\006\235)\326\0072\203\b\030ar\312\374\024\260b\250lG*\020L\013O\003\253x&\037[\260\3546\233\004\250\324H\200\255<\371& eD\332\337\003\2615\341J\232\317\300g\210L\267\344\274$:u\265\365x9\303l\250\267\3766D\346P6\246\3327\324m\355l\036"
+	.ascii	"\025\376?"
+	.string	"BT/\033\231\203g\367\244\021\225yM\365\266\344\017\001\001I\236\365\271'<\353.\241\2247>\363\b~\211\267Yw\267`V\017\246\321\362\367\255\234\004\363\367\035\317\326\nH\034{\"\374F\006Y\262\267\313\022@1{q\320\330H\236\003\210XW\375\005N\224\f\225\227\374\020\351\341M\241\311\330FI\360\3601\337\314{E\242\024\363A\244}h0\227\030sY\372\333O\362\327\314\200\213\346\213\006\375X\236RH\020\307\317\246\202\300\225\234(Yl\215\212\"\021_\223As\366|\206\354\236\224\253\200\316\327Y~k\216'\333 G\214\300\037=\350 ph\306X\240H\374\251\037O&)\236\230\356\350,\234e\361=s`Q\236\226\030\215\245{`\343yF\005"
+	.string	"\"\022h\031\203\226\210\bX\b\305\250w\234\240[Z\342uL`mN&\2662\305\3630\342\331W\306\035i\247\377T\312\233\276\203\264\026\2502\223\340OZTo\351\273H\204\t\013\016hB\354\335?\334\363Z\330\357\247\371\0048\254+x\013\233\204\232\020@$\025`r\232\360\241\322\251\215F2v\200%\037h,X\334\221gn~h\252\n=}\306\351r?\317\211\264\307\212<\277\007\003^\030Bi\334\325`\357\177\243\257\347I\037\315\277\0266L\204\013\340\177\203\210\006\266\007\034\340\301\266\340(`$\267\322\207v,C>H/@\344\371\333e9\261\315\211s6\036-\277\353O\333\310\272\371X\032\343\020"
+	.string	"t\324\021\223\"]\322\177\036\345\2779\262\354\345\337G\213\035\333\236j_\322;H\326x\026\323\331\335\267\n'6\016\302fjv$\276fVaw+\020n\345\213l\316h7|\264\025s\235B\255\277u\034a\371\214S\234\276\017x\r\276\203\261:\321[\332\376.\337\263\360\206r$>\341`\274\242\001\3767^Lj\333\274\301&w\265e\244u\226x\327\224?\r\300\371\272<w\3459\327j\217\367\245\330\233\2418\n\352\211~\345\276\327\3173\312\377p\275\310\334\200\363G\227\314\031\202\016\222V4|V \267\034\337Lo\240?\3011\306t\276\2773\303n"
+	.string	"?\256\303\360\322\336\205\353\016\261l\3218"
+	.string	"\224\023\220\021\363~\354\321\017\250g\217\016h\305\265\353\331\204ms\227r\203t\373<A\231\035\375\376\337\007\007\220\310\206&m\221\r5_"
+	.string	"\336\035:\033\342E\315\316\213-\351\374\327\374'w\344\267Z{\024n\212<{4\027z\021\356.\344\350\370\253\227~a\315\033]\034\323\036itR\261\255\025{\001DK\315n\356&|K\337s\234\301\037\243\243\314\357Yj\027\300\331E=\245\030Ln=\372\357_7\327c\271\300\355\034\364`\364\004\364\245"
+	.ascii	"\237\367\252\222\276D\344\013\355\013~\226\256\0028\374\377\""
+	.ascii	"\273\273\373n\277\341\337\237\343\271t\f$\332}\303%\2719g\247"
+	.ascii	".\237\336\277\251M@]\350'K\327\212@\203d\266\037G\314_y\330A"
+	.ascii	"O\356g@\336u#V\274\202]\001"
+	.text
+	.section	.gnu.lto_.symtab.2f90a5e22214f2c0,"e",@progbits
+	.string	"pgResetFn_serialConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\001"
+	.string	""
+	.string	"serialPortIdentifiers"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\001"
+	.string	""
+	.string	"lookupBaudRateIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\001"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\001"
+	.string	""
+	.string	"findSerialPortIndexByIdentifier"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\001"
+	.string	""
+	.string	"findSerialPortUsageByIdentifier"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\001"
+	.string	""
+	.string	"findSerialPortUsageByPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\001"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\001"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"d"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\001"
+	.string	""
+	.string	"findNextSerialPortConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\001"
+	.string	""
+	.string	"determinePortSharing"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\001"
+	.string	""
+	.string	"isSerialPortShared"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\001"
+	.string	""
+	.string	"findNextSharedSerialPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\001"
+	.string	""
+	.string	"findSharedSerialPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\001"
+	.string	""
+	.string	"isSerialConfigValid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\001"
+	.string	""
+	.string	"serialFindPortConfiguration"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\001"
+	.string	""
+	.string	"doesConfigurationUsePort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\001"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\001"
+	.string	""
+	.string	"closeSerialPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\001"
+	.string	""
+	.string	"serialInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\001"
+	.string	""
+	.string	"serialRemovePort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\001"
+	.string	""
+	.string	"serialGetAvailablePortCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\001"
+	.string	""
+	.string	"serialIsPortAvailable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\001"
+	.string	""
+	.string	"waitForSerialPortToFinishTransmitting"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\001"
+	.string	""
+	.string	"serialPassthrough"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\001"
+	.string	""
+	.string	"serialConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\002"
+	.string	""
+	.string	"serialConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"d"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\002"
+	.string	""
+	.string	"telemetryCheckRxPortShared"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\002"
+	.string	""
+	.string	"serTcpOpen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\002"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\002"
+	.string	""
+	.string	"delay"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\002"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\002"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\002"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.2f90a5e22214f2c0,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,118 @@
+	.file	"serial_4way_avrootloader.c"
+	.section	.gnu.lto_.profile.389ba20e83e181e9,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.389ba20e83e181e9,"e",@progbits
+	.string	"(\265/\375 \024\205"
+	.string	""
+	.string	"P\b"
+	.string	"\001"
+	.string	"\240\342\234\212\n"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.389ba20e83e181e9,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.389ba20e83e181e9,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.389ba20e83e181e9,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.389ba20e83e181e9,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.389ba20e83e181e9,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.389ba20e83e181e9,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.389ba20e83e181e9,"e",@progbits
+	.string	"(\265/\375 \017y"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\002"
+	.string	"\301\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.389ba20e83e181e9,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.389ba20e83e181e9,"e",@progbits
+	.string	"(\265/\375`\016"
+	.string	"\245\007"
+	.string	"\342\r68PO\323\001\310B\270\022"
+	.string	"j\342!\326\221?\002IO\036\302\330\004}y\t\177\330>\201\266\371\210\350j\373+\306\237j0\270C\003\344\373,\234]x\013\343\367\356Ed\n\247\270\034 \0322\023\327\211KqukQ\357\234\027\234\035 \340\315\306\221\307`\260*\342\201Aj\327\255\022\324r\330\332{A3\217b$d\034\335n\355\246\335\346f\243\232\251\335n^V\205f9\254^\213i*\356\274\f\365\275A\375u\250;\237\354\331\320\270:($_K\376\230\030\004p\244tDR\203\035\322 \253E\336\036\375\361\311\003\346\221\234AjZa\311(\211\244/\310\267\025\251\266\342\177\220\027\250d\205\013\310\252\t\242\324\003\361\221\374\037\372\177\362\277\3030\f\377\003\374\367\376s\002\t"
+	.ascii	"\257\354\225`\326\f\r\303\205h\204S\027\265\262B\224\021\270"
+	.ascii	"fl-c"
+	.text
+	.section	.gnu.lto_.symtab.389ba20e83e181e9,"e",@progbits
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.389ba20e83e181e9,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
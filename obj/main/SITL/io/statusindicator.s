@@ -0,0 +1,410 @@
+	.file	"statusindicator.c"
+	.section	.gnu.lto_.profile.166f342be4d76dfe,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.166f342be4d76dfe,"e",@progbits
+	.string	"(\265/\375 k\235\002"
+	.string	"\344\003_"
+	.string	"\n"
+	.string	"\203\204\373(\002\002"
+	.string	"\002"
+	.string	"\001\352\263\360\321\b\002\337\301\220\244\005\003\327\213\334\342\013\002\002\001\002\001\004\005\233\304\365\321\002\006\233\242\376\312\004\007\b\343\247\262V\t\240\342\234\212\n"
+	.string	"\007"
+	.ascii	"P\020Z\3252\227\006i\n\374y4\315&`\320\006"
+	.text
+	.section	.gnu.lto_.ipa_sra.166f342be4d76dfe,"e",@progbits
+	.string	"(\265/\375 --\001"
+	.string	"\330!"
+	.string	"\007"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\002\003"
+	.string	"\001\005"
+	.string	"\001\006"
+	.string	"\001\007\b"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"1\003\241\004\263\001,"
+	.text
+	.section	.gnu.lto_.inline.166f342be4d76dfe,"e",@progbits
+	.string	"(\265/\375`("
+	.string	"\375\002"
+	.string	"\022D\016\031\300%\035.\347m\343\377\377\246\277\263\265\306\377\377\273q\304\022B\032\331r\247+#\222\301\344X\024uB\007\030H\276\2553_\300\177\316\363\213mk\370V\034\322\026=\332\204\016"
+	.string	"s\263!@\006N\200u2\006:\200d\216\222\342\n\210]a\206\020\214\246"
+	.ascii	"\244\264\003\013\036\005p\003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.166f342be4d76dfe,"e",@progbits
+	.string	"(\265/\375 (\365"
+	.string	""
+	.string	"\240\034"
+	.string	"\007\002"
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	"\006\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"5\307[\002\333@\033"
+	.text
+	.section	.gnu.lto_.pureconst.166f342be4d76dfe,"e",@progbits
+	.string	"(\265/\375 \032\321"
+	.string	""
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"\007"
+	.ascii	"\230\004\002\230\004\003\230\004\005\230\004\006\230\004\007"
+	.ascii	"\230\004\b\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.166f342be4d76dfe,"e",@progbits
+	.string	"(\265/\375 \214\255\001"
+	.string	"\310\200"
+	.string	"\007"
+	.string	"\001\002\002\001"
+	.string	""
+	.string	""
+	.string	"\002\003\003"
+	.string	"\001\002\003\005\006\007\b"
+	.string	""
+	.string	""
+	.string	"\f"
+	.string	"3\r \\\027J"
+	.string	"\342\300\314\300\b\300\024\274\254\346\274\035s"
+	.ascii	"\267\r\264\001"
+	.text
+	.section	.gnu.lto_.lto.166f342be4d76dfe,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_warningLedResetTimer.13.166f342be4d76dfe,"e",@progbits
+	.string	"(\265/\375`I"
+	.string	"\005\t"
+	.string	"\026\222A:@\345&\035\340\345\231\0070j\230x\264\024x0\033R\333"
+	.string	"M\350\303\314Y\252\025\214n\r\331h3\b\304@G\217\315\272\212\252O\001P\003+\271\243dT=\263d\357-S\n/"
+	.string	"0"
+	.string	"2"
+	.string	"\222\363\202\3532\236\340\272\264g\303\030P\f\250X\234"
+	.string	"\330\335\t=\356]=\377\252\013|%\321U\263\260\273\326\257\204q\303\333F\260\255`\333%qw\327\320d?uGU\377\222\247\226g\314\354^\264\002,K\262\200<\365\333\277\312\033\037\365\021\357\251P\334\024\006\324J\314\356*\341\3223\340\001!\377\303\021\234\376\273\364\271\353R_>\231\221\266|@\302\361\320\025\341\241F\004\245B\203\244-K\265A\023\372/\302\207l\260HPd\257D\n;\354\007 \355\003\355\351lZ\207y\262\206O\306ItX\307M-\233\237\f{\230\236\215\233\035\2165\b\207mv\232\266\315\315j\037\027\232\344\2115\202$\037\372%7\t\b"
+	.ascii	"3\241\331\037\030e\314=\3412\233\253\313\007\366\205\313\261"
+	.ascii	"h'\031"
+	.text
+	.section	.gnu.lto_warningLedEnable.14.166f342be4d76dfe,"e",@progbits
+	.string	"(\265/\375 \346=\006"
+	.string	"\262\213+1pK\323\001\220\365\1770"
+	.string	"\326]1\210\035\204\017\367\370}\216\217P<i\304\230C\367\201\337L=6\252\252\256\312-e\007/\277\004\304\266\355\336)\005~\032:\253\363\310\004HF\r\325\251Q\2342B\322Y\210\017\215bS\340\311\240@c\235\223Ff\333\277\fj\023\353=\370\227\026_\373\206\344_\330ar\277\016\375i9<\300\240\210X\256bo\225{\025\366%\3732\3731\037\003 \273\023\225\221\235\300\216\f\333gL\331!\004\020\002\036\021\034\224\335\215\317\342\324\035\345_\343\001\027V\335\001 \354\256\335\205Q\334\357\266\rl7\266%\002\b"
+	.ascii	"3\003\366:\243e\270\3055q\025\202x\031\"\\\216E;\311"
+	.text
+	.section	.gnu.lto_warningLedDisable.15.166f342be4d76dfe,"e",@progbits
+	.string	"(\265/\375 \346M\006"
+	.string	"\362\213,3`M\222\016@\235}\321\200f\303r3}\363=A\005\202s\205\2571\310\332\215Q\312\243m\030\350Uz[\005A\341b\310\373\304@\350\3508\243d\020\"SOQ\025/i\242\026,\224\365pI\227\005#\005-\224\324"
+	.string	"\247\312\202\321\301\321\201\241\202W\214\025\254t\262\216\363H<\032\027\361\275@\367\243 \227\2331\004\2465\353\273\030\250/a\243\343D\323>\337\3114w\361\005\310\314\334q\336\021p\024\210dV|R\322\363F4\376V\306\336\304@b\240d\"\004%3\241\303(\326\206\335zT \333d\332\002\0242\363\226m,\272\353\217\360G?E\007"
+	.ascii	"3\001'8\243%\276e.\203\274\f\021.\307\242\235d"
+	.text
+	.section	.gnu.lto_warningLedFlash.16.166f342be4d76dfe,"e",@progbits
+	.string	"(\265/\375 \346E\006"
+	.string	"\262\313+1`M\323\001\300Rm\036\\"
+	.string	"\021\273pV\214Sd@H\235\277"
+	.string	"\017!\304?\250\373B\35423\311`\030\230\004w\023`{\264\237\227\310\376{\247\024~\032:\253\363\310\005HF\017\325\251Q\2342B\322i\210\017\215bs\340\351\300@c\235\223FF\333\277\f\222l\326\213\260\273\264\370\036\377\220|\rCL\356\327\241?-\207\t\034\224\022\313Ul\255r\017\303>\300\276\314~\004\023\005&\273\026\225\223\335`\310\206\3553\246\354\021\003\211\001\021\n\020\312\356\306\227q\352\216\362\337q\201\013\253\356\002\024v\327\356\302.\356w\333\b\266\033\333\025\001\b"
+	.ascii	"3\003\366:\243e\270\3055q\025\202x\031\"\\\216E;\311"
+	.text
+	.section	.gnu.lto_warningLedRefresh.17.166f342be4d76dfe,"e",@progbits
+	.string	"(\265/\375`H"
+	.string	"\005\t"
+	.string	"\006\222A8@s\322\001082\335\346\231l\232#\357\2267y`4+\337\"W\270\215p\333\b\262|\265\022`L\205>\373p\031\020\030\177\272\003#5\023\242\303(\373\311&[\246\024/"
+	.string	"0"
+	.string	"2"
+	.string	"\236\023d\227\330\007\262K\177\266\314\301\205\200\r\306J\315\356\316(\362\357\372\371_= D\201W\200\206\335\265\206\250\215;\336v\202\355\005\3330\001\273\273\216)\373\252\033S\3653\206\020\203\227\335\214\327\315\272\244\013\311U\277\375\257\334\361O\216\362]E\342\200\032\034\226\026\307\314.K\341\322\223s\031\037\361D\247\017/\375.\273\324\230\220\246\244/#\244|\234\224a\361\261\242\243\345\344a\322\227\245\332#\013}\210\305\202S\211\313\024A\233\005j\004\261\217\005\243M\024\035\372p\233\007\ni\017\"\255\243\360@^77m\2124P\304\fq\335\374x\274I@p\323\3336nvX{lc\312\301\304U\212&?\372\255\253\220\034\b"
+	.string	"3\241\327\037\030]\314=w\031\335\325e"
+	.ascii	"[\302%^\264\223\f"
+	.text
+	.section	.gnu.lto_warningLedUpdate.18.166f342be4d76dfe,"e",@progbits
+	.string	"(\265/\375`\265"
+	.string	"5\013"
+	.string	"F\026O?0o\232\016\b#\341`-\240?Z\305ya\265F\3468\304j\260\222Z\032jdp\001>\"K\250\354\341\267\361\265Q7\025\313\037\006\006p\335\242f\263\037\325\243\306xj\236\304\335M\312\224\002="
+	.string	";"
+	.string	":"
+	.string	"\177\266l\025\347B\366\035\206\316\b\223\335\215\272\341\326!M\313\027\240]\207\242\nW\bA\347\244\303"
+	.string	"\r\203\016\230\\#\337\236\0214\217L"
+	.string	"\030\273\353\3144\n\367\273\355\005\266\023\330W\020\273V\r\366=7\324\264f:3\375"
+	.string	"\360D\n\003+v%|^,\311\033\361p\317o\377\233)~\210\213X\367tD\327\204\210D\227\241d\227\263\3749F\177\225\027\200\177\320\t\300\252\372\022\235\223+\324\324\177|\300\362c_\304\273\016\237\203'\215|\366\347k\300\277\353ca\002\304\005N~\f\323\336\340\310gP\277\375\026>DH0\275l\016K\005\261\017\355\006\034\223F\235\271PS\205\311H\r4\322f\243\302T\2338IQ#a2b\206\332\304K\305\023\004\007T\254\246\211\212\024\216s\f\216b\020%\355\007\031\371\314\232![\213\022U\020[\256\312\240C\341\221.\234\001\017"
+	.ascii	"2\003\3020\314\204\255\032\310a\366\002m>\016\316\341\226\023"
+	.ascii	"\251\226A\027\334]u\006XE\234\313M\211GcP{"
+	.text
+	.section	.gnu.lto_warningLedUpdate.part.0.22.166f342be4d76dfe,"e",@progbits
+	.string	"(\265/\375`\020\001m\f"
+	.string	"\206WR@0m\233\0160\230\0240TU\214\221\274}\n|\f\356f\203\331\331\323\250\021\\K\356\375\373\0028\366\361uJ\006\0276\200\357\265\244\376OJX\224 '\317c\241\340\202\271l\003 D\233\310\235R="
+	.string	"B"
+	.string	"@"
+	.string	"\037 =F\027 =~\203\355mc\316>q\257\302\376#\241\301\211\212\335\225\217J\341\334\025F\234\017;\016\346z\320agD\307yp\030\340\221\205\306\356z\202p\307\3336`\273\200\375N\376\311?\037d\262}\\\376\361\001\022\032v\227\272\370&\227{\264Js\261\232\t\037\030\356\223l~\211)o\273Gs\245\361\226\263\271g\352\321\035\356\201\273G\2330\233\t\364\001A\261\353a<ZN\217U!\023(\t\271&]\241.\350\204\360"
+	.string	"\311\300\220-\240\377a\034\360\335\365\240?\202G\206\022\031\305@\035\261F\217vw\255\"v\004\r\377\335\227"
+	.string	"`p\330u\020Z\261!Q\304\205\223\374\337\241\375\f\246E]\311\270fF\251X\b,\026\306\221Q2LNKZ,\312\206\254\\\230\314\250<\025$\270d6\347%\251G\253\"\326\350\320\214Uu\3046T\377\303Ah\276\005o\314\350O\351\021\232\350Rt\300\033"
+	.ascii	"Ec\264\256\300\3705\3440,\241\n\020\020\005\303\310\0256\027"
+	.ascii	"F\300=(\f`hB\220\233p\022R\203J\305=\352:\322\tS\bc\247\356\351"
+	.ascii	"\264e3o\247\005\340\332;\n\313\314\346\237P\306"
+	.text
+	.section	.gnu.lto_.symbol_nodes.166f342be4d76dfe,"e",@progbits
+	.string	"(\265/\375`4"
+	.string	"\215\004"
+	.string	"\242\306\030#\240)\035\317\256\352\275\3017\214j\021\211\357\306\377\377\2776f\214\335\177\333'\204\220\335\215l\262\367\2262\005\305\bf\003B\231\224i\314eJ\264&\310\004\374\337\036*\217\013\330\205\223\215\007\316\202l\016"
+	.string	"\f1\315b~\362\375\261\330\311\324b\364\345V[\304\337\213\034\255[\t\003\325\377+\033\262-*\002\022"
+	.string	"`\013@p\213\2208\f\303\247\b\352\2312\215`\270\204\300r\36096|\031\320\003\374\301U\236\235\031"
+	.ascii	"7\274\n\b\315\241\312"
+	.text
+	.section	.gnu.lto_.refs.166f342be4d76dfe,"e",@progbits
+	.string	"(\265/\375 /-\001"
+	.string	"\330+"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001\001\003"
+	.string	"\001\002\003\001\004\001"
+	.string	"\001\005\006\007\b"
+	.string	"\001\002"
+	.string	""
+	.ascii	"\004\004\002;\005\\`R\222"
+	.text
+	.section	.gnu.lto_.decls.166f342be4d76dfe,"e",@progbits
+	.string	"(\265/\375`z\007\005)"
+	.string	"\232H \020H\200\334\321pN#\264\344\261Q\023\016\371\217g\004k|\306x+&}\035\242E\352\006\246\302\362\021\244M\253Yt\231AX~\373\313\241\003\314)\325U\245\344JS}\357\226\250\257X\242-b\251!\337\230;\211M\266L\001\323"
+	.string	"\344"
+	.string	"\367"
+	.ascii	"O.P\027,Id\337x\203\214\354\247\223QM\006\255:\251\273Y\215\212"
+	.ascii	"<\372H\303J\tM&&hz\fj\216\261\004 \276=\001\234j\206(\321\364"
+	.ascii	"\023\256pR\307\n\030)B4e*\\\205\2558\371\363\025[yz\345v\262"
+	.ascii	"\373\345\251\t\177\200m\241\251\017#\260\245l\300v~_\340\252"
+	.ascii	"3\034U\3179[\017\347l?O\341\252\\\255Mr[\331\375\342x\3368\207"
+	.ascii	"Sh\372\227\021\330T6`\213 \340g\"\377\267\240\241\330\371yH\231"
+	.ascii	"3aU\300\250\230Rg\351\317L\314\376\217\225\375\217\360\263\222"
+	.ascii	"\377d\377\235\377\305\376/\377\207\375\007\373\372\357\365\277"
+	.ascii	"\353?\327\377\255\377\312\377X\376'\377W\375\277\375g\376W\323"
+	.ascii	"\322\322\322~\036\361\363\221_gF\277\255\205\306\356\356\241"
+	.ascii	"\363\266q\270s\326a\316\375<\\c\b];\201$\335\305\347\032\325"
+	.ascii	"\311\226P\b\232\376\367\351\251\356 \256\3376\266I\247`{E\314"
+	.ascii	"\021\367v\221\004\235\204\352\366u:\246n\243\37567\321\351\370"
+	.ascii	"\242}]c\373\272\301[\023\335`\367{\274\265Ja\220\333\244\323"
+	.ascii	"\261M\272G\\\023;\330Ia\021\225\350\036\3330\356\361\326&\205"
+	.ascii	"\307\226\350t\304%=\237\226\264\316\253%\026k\211\275\243\310"
+	.ascii	"$4\336\232\355\353\366\263\233\2256\332\b\241\233\3115>\205J"
+	.ascii	"\314e\330\3341\324\022\272\374v\367\202\342\360\311mb\263\215"
+	.ascii	"r\273\243\206F]\304\020|\233\255\204\233A(\246N\262\321\315\240"
+	.ascii	"\337\356bw\220\273\331\335\301\356\006`dz\273\203\334Zd\261\330"
+	.ascii	"\275\244\240\330L\301.6\272Q\345\030\227c\233\f@\3349f\212\214"
+	.ascii	"`u\241\351kM\352kJ\352\2301\354\344+\007TJn\246\272\227r\252"
+	.ascii	"\222\223(8\234\\&-\363J\223\203\246dv\204?\226bj\324\243e\352"
+	.ascii	"\317bb\214\225\022\337>\332\256L\375\200\342\246\215_&\340\230"
+	.ascii	"4\245\250\302\302x\251\006\341\fh:\337h)Q\301\300\314\220;YJ"
+	.ascii	"q\210@\230\314'\032\224\022\275\241\236\2750\177}qV\210\016k"
+	.ascii	"\264\332d\331\274\274j\335MLdO\2151SQN\265\353]\274To=,[\242"
+	.ascii	"\t\320\302\364ZvQ\317\\\230\271\316V\314\305X!:pU\241\265\361"
+	.ascii	"\235p\266R\317\214e\323\342--^\332\272\371uy\030{\311\230;ga"
+	.ascii	"-\347-V\274\205\227\277\t\273\207\335Mb\021\204dr|\271\351\245"
+	.ascii	"\245\034\017\022\215\224\0326\347\345o!\303\317v\272\253\272"
+	.ascii	"\273\201\216\230\250&Y\320\364<T\337B=\032\354\020\220\004\357"
+	.ascii	"\350H\007\374\2551x\277\"\006\354\0200\305\212\304cU\240\357"
+	.ascii	"G\304C\262\335\350g\004\n\021't\354\312\342\267c[\020\371\216"
+	.ascii	"8\254?\037\007\244\225\005\3228\321c\004\\\177+V\023F\300\335"
+	.ascii	"\321\007 \257\303z\244b\327\363pcW\340j\342\300oE\342\241\350"
+	.ascii	"\271\317}.\326\237\216\365\371~\272\001\267\n?\354o\347\342g"
+	.ascii	"ewE.R$8\021\357\267\366V\026\3521\004Q\b\3220\003\3005\bU\020"
+	.ascii	"\252`\273\006!  \241  \365A@\265uhew\354\211\242u\004\213\036"
+	.ascii	"\257\367\333\311\300\261C\026.\260=\036\f\365\0336p\360IQ\002"
+	.ascii	"\204J\364\363\363\261;\"^Q\217\007\204\301\356X\240\316\307\323"
+	.ascii	"\365x;$\035\321\017\250\373y\200f\231f\001I\362\204\346\344'"
+	.ascii	"T\024\035g\262\004P\231U)\235a\251YgM\035\250\031Y\215\271\365"
+	.ascii	"D\nM\237O&{\215\330MS\220)\0228S\306\310\306\002\274\t\200\214"
+	.ascii	"\250aDf\210DFfDDD\244i\322\001\220\002\2211d\035\021 \251\342"
+	.ascii	"J\216\224hk\317d\034\305~\303A!\244_)]O\331m\001r+\n\343\343"
+	.ascii	"\312(_\321B\307H\300\035\t}\265o\337T5\224\236\257\357p\324\210"
+	.ascii	"\f\036\227\241\006\320\034\256-\305}\364[\327\341\t\304P\t\342"
+	.ascii	"<6\317v\354\375w\344l\363\207\027g\373\233f\217\n\021\002\001"
+	.ascii	"\207\241w\370\357\251\257\224\302\2340\n\356~ \"\323a+\037\003"
+	.ascii	"\276m\033\240\373g\275\320\323~P\217\322\264w\275&H$R\304\024"
+	.ascii	"\2034x$3\374\330HW\r\314>\217BvC\205Y80|\211\356\320M\300{'E"
+	.ascii	"\224$*a\035\375\236\300\325\245\226\332\350\016\301^\235\"!\343"
+	.ascii	"g\224\310\356w\022\2243\210\242D\366\331\377\\\003y{<B\372\365"
+	.ascii	"o\274\311\376\302\303X\033j\217\220'\365\215%3\3309\300\004="
+	.ascii	"8\243\032S#\256j\246\267\342\345>\315\377\376\007c\372bZ\277"
+	.ascii	"_\235\325"
+	.text
+	.section	.gnu.lto_.symtab.166f342be4d76dfe,"e",@progbits
+	.string	"warningLedResetTimer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324"
+	.string	""
+	.string	""
+	.string	"warningLedEnable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326"
+	.string	""
+	.string	""
+	.string	"warningLedDisable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333"
+	.string	""
+	.string	""
+	.string	"warningLedFlash"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335"
+	.string	""
+	.string	""
+	.string	"warningLedRefresh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337"
+	.string	""
+	.string	""
+	.string	"warningLedUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316"
+	.string	""
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341"
+	.string	""
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346"
+	.string	""
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.166f342be4d76dfe,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,2776 @@
+	.file	"dyad.c"
+	.section	.gnu.lto_.profile.eabcc68afd87291b,"e",@progbits
+	.string	"(\265/\375 \nQ"
+	.string	""
+	.string	"\006"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\006"
+	.text
+	.section	.gnu.lto_.icf.eabcc68afd87291b,"e",@progbits
+	.string	"(\265/\375`\375\007%\036"
+	.string	"f\342\205L\260\022Vc\277\224\355 @\311\347d\322\035U?\006\030\322O\335*\204\230pJ\004\n\022\003\364\222\017\304\037{\367\333~\220\177@\177\320\177\320\177\320\177\320\263\251\252\252\252D\305M\3304\245\311\367\277\377\377\275\367\336\276\374{K\231\344\016e"
+	.string	"s"
+	.string	"z"
+	.ascii	"("
+	.string	"?\236T\365\272U\223\216*)R\365z5\223H\231#hi.\005s<\274\266\213=\373\263SEOB\247\372U\305<\262~F\246~\271\314\3100\352\214\206x9\306|\177\243:\227\337O\367\321\327\367\317o\375\222\364\206\2504\304\331\274\353\370\347\315\237\307\3277\257\237\377\343\227\227\255\277\242\246\225\022C\271\223\001\270\354#\212\341!\371\255hpn\373;\003;\364\"\312h\253\275\366\234\312\332#\241\244\312K;-\273wQ\332]\016x\306\210\224\244Z\031\313\271lfxD\320\366w\256\375Y\212a\344\252+S\321\021r\206\236X\352\306H\217\254}\253[\252\235\252\025\261\224\306gI\b\326\352\331g\263\313\036{\354&\030g\212\030\204\355\001\003\006jm\337\302\016\353\275^\002\266k0\251\202\264\266\024`\241p\252\230\240-\242S\003\364e\027\2608TD\220\257aj\315\020!\322\001\363\247yW\r\266\370"
+	.ascii	"\032\320\357\373^o8\013\"\227\024\223\262\207\2118@8\025X\257"
+	.ascii	">\034=\021\320\257+\252\035\250\001%\002\356\243\241\303\022"
+	.ascii	"@\237X\307\240\024\200\223\r\262\212r\321+q\226\211-\024\336"
+	.ascii	"\356\275~\277\2469\277+ ]i\342\030\207A\271\255\203\345D1e\276"
+	.ascii	"\376Q\241\025\212\022\027\260\361X\243\307B\224\217\326\260\202"
+	.ascii	"RO\222\205\302\365\215\026*\210\023\330\026\244\230\037\t\371"
+	.ascii	"<\221\001b\214\220]2XXU\020x\347\375Y\b\223\023\314\203\335w"
+	.ascii	"\273\273\327\351\256\373\311JD\242\t\351 _\347\236Ck'2\207\220"
+	.ascii	"H\003\334q\271\247\256t\360\261aPn\033;\200n\026\340\216\273"
+	.ascii	"\375\246I~{\253o\327\267=\200\326\250!\246\240d\306\244%I\273"
+	.ascii	"\001@\002\207f\252\330\001\022@\224%\306\224L\261\231!I\n\n\345"
+	.ascii	"\332\001\020\210\245\265\344\322.7\026[R\371\321\373T\257\273"
+	.ascii	"I\303|\326yS\347\264<,\376\326R\204i\261\330\221\346\231X\215"
+	.ascii	"F\022\350E\237/\220\025A;\211\230B\305\031*\n\201P\304\314`a"
+	.ascii	"R\2309\347;\3358\024\262\256B\344\200\227o\344\304\277\224\256"
+	.ascii	"\303}\317\251\031\377h\375M\365\257\356\204*\363I&c\325\310\316"
+	.ascii	"\305\240\225#\261k;"
+	.string	"S\221\027&\346mv\224\240\033\302e\303\276,Q\t#\363\201\217\210\247\275:\023\224\262\\\273a|T\200\314\035\007\366\240\351-\271HG\3076\235X\205\277\330#\316&\217\340\254\212$\262\026\304\235\027(4\013\303\200\334\361\366T#\005[\216\300\241\034\214\302\225~\252\202zIX\263\221E\270\354/\213\016\207R\022\312\246\227[\252,#\310p\214\326\0057\237]\346\351g\304\217K)`\\\223\235\n\304\374\350\376\367\357\264S\221\256~\006K\262\347m4{oz\301\330\316\277\330\325\226\275\201T\005=\206\244\236%8\325L\037Q\304H\267\262Eu\352s\005\252w4\021\217>u\334\375\273\230\221d\355D\354~\342E\236Z3\254\223{e?\263/\035v\352\251\324\310\244P\020&\017\345\034\365z\356\217o\304\273\210u\237\241;F*2\232\016\2148\264(\206\321'\306\314\356KU\362\331\002\354'\356\316\207"
+	.ascii	"_\257\356\354=\345\271Q\377\314\215\323\343\317##\213}\356\262"
+	.ascii	"\\w\f"
+	.text
+	.section	.gnu.lto_.ipa_sra.eabcc68afd87291b,"e",@progbits
+	.string	"(\265/\375`>\004e\r"
+	.string	"\322L%\"\020U\223\016\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\005@\213\027\t?\360-\246\362\365\32604wwkd\313\235d,3\2114R\021\241\204\224q\326\316\202lb\017\322\217=::M\216n\220\321\345\353\246\361\221w\362\206+\003\343a\276\260\270bN\301'\270\222\210(\304\203Ci\221\312\006\206\312\013\265\256\360\224l\303\305\023Z\312\217@\362`\032L\346V@\343\315\255\217g\026\233\004\275\001\001\373s\316$\333\002\216\276"
+	.string	"d'D\362.\333\254z\252\356+\371i\234\250\246\200\220\250\241Q\244RPIs`\202!f\312\352\001\021 \035D\3169\021\232\026\206=\003\361\237\355\303\017\\?\361\376:\216|)\327I\330\371\356\026$o\027\365X;\001\222\221\037\032\371\367\214,\223*L\312\006\245d\266\316\2447cz\243\227\233*5E\037\335\3519\227\006\031\241c\234\031\261"
+	.string	"\260\3560\005\nT\315\361\001\270\324\331\026\020\327\315\263\233 \371\224\004\231G1&1\033\257\324\250\034`\346?\346a:\327\001U\224\013\376\303\312%\336\274\344T0\272\214\211\233\232\312\205\355I\2551l(`\020L\305[\271D\352\251T\317\231\307\325\005\311n\276|\rTN\360\177z@\201)z1\001\332\372\377\274"
+	.ascii	"\005#\355S\240d\267\314\261A\367Ps\335Z|gR\247\025\352\034\002"
+	.ascii	"\030\330\373\235\344\375\030P\302\336N\2774i\202\222\fT\016\325"
+	.ascii	"^4\022\323\310\f\222\251\2138\361\205a\342}\301\321\006\331\004"
+	.ascii	"\374\251\206\252Fc\201\3546\363V\250\365WwJ\024"
+	.text
+	.section	.gnu.lto_.inline.eabcc68afd87291b,"e",@progbits
+	.string	"(\265/\375`\330\022\005;"
+	.string	"\272@\344\rHp\\N:_\214?[\246\202(X\rmun;{3\243\204\177\242Xx\331W\366\016\267\200,\033\2079\222\243\177W\246\253\355lBc2\241\305b\332L\350\264\220\317\251\260\370Y\253\2105i\265\265\215\024\261{K\231\002\272"
+	.string	"\312"
+	.string	"\321"
+	.string	"\177\021\255?\363y\251\225I\257,:\347\005\177\240\345\363O\254\375\"H\244\330\006\374\234<L\353\355\031h\355\255\261~\325\311\265\001\337\366m\211\375\303J\324\213\232\342\336\213\374\317\277\236\250\253\021\037{\356\215\216\213\200\357>L}\304\363?\326,\"gh\202L\2556\005n\013xk\177\3370\355\377\277:L\371\277\257\321\023[y\357\335\275\321wR\337{/\027[\353\336\353\373\217\375\304\006\227\032\"{\244za\363\217TU\260\n&'Q\243x\237\231j\2275\264$\f4\360\203\302\370\347\240\355\367R\247\321\365(\363\373\231j\027&\024\232\003\375sS3\325\302\314"
+	.string	"\375\026\276\263\026\315-\017Mm\225f\211\003\002\337\001\"\352\234Y\234\224+/=y\214E\323\253\331\303]<\314J\267\234\\\023\322\373\231\332-\353)\212\320\336\336z\"\265/2u\005\276\363a\372\263\266~\th\343\375="
+	.ascii	"\237k\377\352\217D\355\221\\\223\006D\377\325\251\277\300Q5\271"
+	.ascii	"\300\251\316\201H4\251\373\302\023\355\203\301\234\347\234\340"
+	.ascii	"\237\255\324\2757\300\201\347_\207\331\256X\006a\002\177c\003"
+	.ascii	"\t\023\222\005d\317\267\236\247\371\214\006\247\314\214\r\f\365"
+	.ascii	";OJ\027+s\216\b\224\236\222\2631q=\366\357+-SU|\356;z\233\204"
+	.ascii	"\276\330q\367\"s\214\235\336\213\314\272\367\372\354\220\367"
+	.ascii	"\"\207\336\343a\312\007Z\245V\252q\300|\201r\006l\254\312cPP"
+	.ascii	"A\261o\021"
+	.string	"\202z\200X\211\356R+\203Bb\033h;\033\263\034\"\321.\276jx\375\\\310X\225A\350\210~\243\244\213\r?\030<o\225\261\026\006\t\357@\357G1\253\021d\347\005\226j\357\004\370l\207\251\265O\252T9\252\224\361\212=6\006\005vt\313\227\357\333\"\035\251+\216\212\016\276P\030\274R\255\357\240\230\024\0377|\177\261\362p\221\004M\350\267S\326\363\234B\247\377\274\325\304\317\327c\223]a\212\235\355i?<\242\337\350\226ZV\242b\200\365\203'\332\316\221\353\277\353\371X\333\262T\221%h9\037\3733\200\363\314\233j\237\233\246\276B\343\314\230\240\337\251\3414\257\226\374\244\333D\027A\203\301\204\253^&\327\263\245\031\357\320\227C\334\006\245\006\016q\362(3\374\307\300}\036\251\336\355\302\177\266\360\237\n=2ff\352t\212\024\226Q\033\2519,^\246\265\200\301\305C\354\n\n?\312\265\352\336$"
+	.string	",SoeE]\245pL]\031\372\004\376\335<m\201\203fAzi&\350GEu-1|\215\204\364\350\257\347\253#tI\337\277T\331\304\232K>\364\317\344\270\230\027\303F\"X\024\205`O\274Ju\325\235A\377"
+	.string	"\335\271\031\325\024N\315V\017\310\223\325\003{\3134s\365$\274\203\027\033(4w\357\023\2017x\217\377\177\030c\367\357\216\304\352\244\026\2654\016S\242\265\214\324ya7\266b\300\327\331\361\211\006E\005\346$\347o\252VV\314\304\0249\365\016\031QpG\227[\020\201\316\250\24192#2\"\"\222$I\2061\221\004\004!\303\240\324\324\003\022"
+	.ascii	"D%\307\362\2342\310\314\214\004#\022DR\220\244\222\345\027\226"
+	.ascii	"\360\271\2778g-\246\272m7\256V\t\001#B)\270\362 a\204\235@x\237"
+	.ascii	"\211\331\0074\370\224n\261\310MB\242\221x\356\250O\376E\354q"
+	.ascii	"\37262\314J\243V"
+	.string	"\234\253GG\007\307\204\222Zk\001l\2335S\302\360\250\304E\201\t\364\270\2303\354W\266\227\f\002\t4Hz\004\275\005\325\032\352\206eu\323\t\306\004\3453\200N|\230\3122a\024\034q\022\221B\001\361\262\006\205>\0269\306\273a\325\335 \323\030\252X\330j/a\023\035\025n\275e\270\334\"\\\016\227\200\323\027\367\357\031\004\262\025y\341\340\243\336c\235\241hrp\245\304g\233E\231\031\013\036\030\251Y\312\26506\032\260R\322\037B\211\257\226\"h\332K\267\001\220\377H\234\360\323\275\204\243\211\327\rW\314\t\bWs\212\245\346\374\0017\020\373\016-z?\034\3442\352?\031\r\330>\300\037\027\320\t\371'\306\026\207-.\237\331\220M\024\201\205\247=\277x]A \203`D\256&\244\251\306Q\375\226\315\201\024\302wJZ\256\237h\001\340N\344o\204\0244\251\242j\241 [\350\325\200`H\271L"
+	.string	"\340\030\375) \025\355,|\"C\220,t\305\365s\265 7\237Q -\033G\341,Z\273\366)\033\2645\351\340\311d\001\261\025>\254\035E\220\232\2301\343\362E\204Qg\312 &K\371M\306\237L[\033}t#\363\232\342\332\366\274\311}\004%Z\337^\233\303\303\245+\267%A\224\223_O\247\214\375\024\216\214 \350\327\210\b\315@<\235\374\260\205\245\314\n\372\\\tZ\250\353\200\211\330\316\235L\005lec\004g\3525\034\302\267\236\330$;\303\r\360\033\227)\026\216\261\350Z\265X"
+	.string	"\221E\025\201\373\004;\212\265\2404\300.\302\007\221\361\022a\235\f\361LQ\033\254#&K\267n,\300\372L\272\303\001\213'\r\001\261?<\360N\231\277w\323;>\277A7K\260\250u\3621[*\266\272\230\002\310)\320\t\241q\340\256\311w<@\274Fu\006\b\"\314\343,\350i\256\342Cw\f\304Y\364\t\221`\253\003\220\325\353\374\2336\032\2445\332\377\370\333C\b\374\357\226l\320g T\035\252mx xNo\235\214\223\037\353\366r\312\t\333knT\370\220\025\374a\266\201\334\201la\376"
+	.string	"\353e\220\b\255"
+	.string	"\264<i,\204Y\f\364?}\216\222\036\343p\276''(\324\023\362\234OSk\241\240\265t\374\004\016h\222[M\231\345\325\036\025\326\006Q^\233\212n$\021\021^!\350\305\201z\"\222\354\242\310K\r\350I\267\206\221\233\017\275{?\320+\020pD\201\337\256V\226"
+	.ascii	"\t\310\353\274>\221\305:_&\324\002\221\263\334\214\353m\0021"
+	.ascii	"0+\201T\341\226T&\214c\346\222 5\201\"\305\326\336h_<\004\002"
+	.ascii	"\342\366kS';i\352\207\210\361\233\247\022\207jz\001\013YM%66"
+	.ascii	"\022j$\251Wc\255+\343\2363\020\377\377\344K\317\245H\217V\226"
+	.ascii	"^\021\345\253\220P<\315\261!\006\276\357\345\210\376\t:\333;"
+	.ascii	"A\030\305\023Dhd\020\212\311\210(\354\341Yj\232\355x\345p\260"
+	.ascii	"\207\247\234uk\"z\265\256\033{\354\265\nP1\nJ|\204\224\345t\360"
+	.ascii	"\264b?\222\311.\322B\025$\360\215,\342\211\254\271l\\ \204\021"
+	.ascii	"\301m\034}@lAs\301b\252\207\276~\352%Y\203\260\017\200c\034\230"
+	.ascii	"\376V~\256G\273\b\230jx\313_N\355\350\357\265\233*\301\253\302"
+	.ascii	"\n\305\003\306"
+	.text
+	.section	.gnu.lto_.jmpfuncs.eabcc68afd87291b,"e",@progbits
+	.string	"(\265/\375`\322\033\3256"
+	.string	"\206y\273G\320\030'\035"
+	.string	"\245j\232d 9\001Yd\303\020\322\013\340\024\237\215\267\330J\262V\327\231\357~\371\202\340\213d\r\n\201\226\315\325\313!\276`\006\345\r`bl\377\251\247~1\266\245\2523\246\bx\355\356\336\215l\231d\224"
+	.string	"\245"
+	.string	"\260"
+	.string	"|\303_#\177\354\247\022\3438\2164\fCy\035T\354Q\311N\365\265\351\307\374\r\240\336\316&\fDN\313\027\371\211\274\357\016*V\225\314X\347\335\250~\377\363\206|\2362\373|\303\325{\276\2242\276\277\377\3451\373\f[\3752L5\337\303|\307h\232/\344\366\230Wq}P\361\252\227\336!\252\017\344\177\354\246\371\367\307\374\303\233f\375\033lZ\347\347T\337\304Y\363\315Z\366\225\377\353e\276\235\305\370Y\354\314\277Y\277\257\354+\3637\373\360Q0+\320\02087,\033\346Ten\320\013\356\253\030\365\177i\314\206\201\311\230QW o6;\325\227}\237\343\377\263\004|kP\361,Tr\262D`2=\371\235\274?\205\233\246\032\276\277A\305\017*\212\352\003Ac\320x)G\351`*\225\222\350\315bt\336O\003g\362\002\037\362&\027\307\274\212\r\245Ks$\377\221\3133\214"
+	.string	"\337\247\372f\315\247\276\003X\200\217\017\213cX\356<\313\356S\f\303\034\206m\342<<|:1\024#\326;\233\231\371\3151;\353>C\231MY\216\343[\276\324\276\251\276/}\203\376\313"
+	.ascii	"\001\326\003\277j\207@\006|\301B\005 \n\262Y\376?&\246\224\237"
+	.ascii	"&\260|`(\t\314\031\372\242\"\314$\032\2433\325\027CPO\253\305"
+	.ascii	"\\V\255Q\216F\034f\323\237\376f\351\244\240bkQI\272\202\212\r"
+	.ascii	"\205fy\353t\022\231\311\202\212M\244k\250$s\351\026;\246N\365"
+	.ascii	"\037\204g\247uV\020\270\246&\211\312\030\2356}\201\306\007\314"
+	.ascii	"\334\274\342\225\t\026\206\341\211\337\237x\225\235!\374K~\302"
+	.ascii	"\322e\311\237\344\272\240\342\251\250$\377\264\234\235\363b6"
+	.ascii	"\214y\345\306\220A\305+y\222O\276\225\007\220\207\315\240\342"
+	.ascii	"m\250\344\345\257\342-\274\305A+\f~\335P\265GD\335g\275\rGr'"
+	.ascii	"\304\275\274m\323*hE\034\330\270W\b\003\314u5,\202{q\026\374"
+	.ascii	"^D4\354\331#\317~(\346\272\027\350\262\034\327\271\352fi\030"
+	.ascii	"4\262.\227V\271\256v`\335,\321K\023\262a\320\216pu_\265\240f"
+	.ascii	"=W\005;\256nD$:W\215\365\272\242\352uB\025i\323\254W\277\027"
+	.ascii	"\003~\360\265\200xpr\352\327\372\351\341\301\221a\r\324\266\272"
+	.ascii	"\331\243\227uY/\2067\373uD\256\030F\362\272\"[T\205\272\n\222"
+	.ascii	"\350b\370\364\341T\013\256\027\247\031\325MC\332fx\263H\235\007"
+	.ascii	"~v\253\234\265!\352\247\r\325\"-\201\304\250QQ\205FDD$)HRj\f"
+	.ascii	"\321\004\2040\346\030\204\362\006\022\300\001I\210BQ\022\343"
+	.ascii	"\034C\314\0202\"2\022\210\210HA\212\222\244\003\276U\227\n\231"
+	.ascii	"P\307\347\360\313H\324\237\241\322\222F\375y\354\332\\\257\326"
+	.ascii	"\317p\224\355\215\362x\332[?6\377eL\377\261\377?\360sS\266\031"
+	.ascii	"\2261\272e\345\324\300\322?\271&XJ\354\260R4Yc\0018\220\355\301"
+	.ascii	"'\301\243\372\003\242\332\303\315\222\245\307\376\r\252\tI\314"
+	.ascii	"\207\202^\024\202"
+	.string	"0\301[\200\326\030\026\3411\022\323R\327\340t{\224\364\263\265}\360er\213\323W\256&\376\253\201\212\"W\026\3273k,H(h\214\315\341\360\322\255\002\276A\254\321d\324\364\273\256\352RS\300\013\345\377\233>|!/\301\313\244&\331\311\376E\361\312\305\365\303\242\002\350W\232\2148\267/\343E\231D\212\346k\340F:\213jC\001d\236@\234Ks\247\315Ac\004\300\254\276\f\337n\205\274\227\237\377\375\304\2423\2356q\375l\304\fCk\350w\311\216\004\256~\310\306\310\272\026\202\341g\t\345\300\357D\340\007\333pz\\\336\020\034*u\242S\234\241\327d$\321\020ocr\330\242\252\373*A\375\3101\364pS\364\bm5\352\037\234\024^C\025\337\375\330f\226\316\312)\321\365X\261ZS\310\206f\\\272!\261\177\243\fyu\217\t\030\026Sj\203\233\313\312>\247\352\247t\356\261vV\377#\367"
+	.ascii	"\005\004\321\215\007\2544\017\363 \013R\341\301\022\360\320\300"
+	.ascii	"\013\315\212R\303Y\205\205z`\232\222\337\\\322\354\236M\233}"
+	.ascii	"#Z\224\034\231\030\304(\001\267E\207\211sZJ=V_\321`\307\205\305"
+	.ascii	"\334\243\212.\021.\f\017m\025\254r\323\255\323\333\307N\022\300"
+	.ascii	"mA\341\224\2635\225\206\033>'\247\315Dzg\234\263%\240\216\267"
+	.ascii	"\312cm\210\n_\270\326cX\026]\365C\033\300\335\262>\004\307\323"
+	.ascii	"G\177X\270\245\245:\214nZWRf\022\346\243\260\217\275xN\004\346"
+	.ascii	"\026\254d\333\334i\236\007\360\301c\330\022\205\221\313\247\177"
+	.ascii	"+\255^"
+	.string	"\312\0072\264\036)\\\226F\277\307Z\0325i\347\\\246\n\273&h-\321\212\213\r\347\271\264\370\231\245\243!\377\237\214\251k\351\200TE#\ryJ\343\210\345\277\270F`\336\021\264\030\200\034(V\306\227\005\f\005\3563\311e\032%\220\032\3629\035m\3156\215f\274_G\036_\036\2166=$U\33183\017#!\0255\035\277\001\270c\204\265Q\257\227\321\261\222Uo\321\315\347\252wc\261\016\224/\341\374\3378\313\340\203\203\225\b\314\3574\013h\037a\005\373:\332\307\271\360\233\365z'\213\233\373,cF3\230R\257m?\2163\355\202\203h\200\340%,bx\321C\2672}\302\204\235\237\275\333E\037w\225\215J\370\021\346c\247\331\341\253\237\354\253\277\003\305\372\252\250\253\301_=\363\350\347Kj\036H 8AA\263P\005g\222m\204E\361Gz~\304\"\273\207\307<\314H\001\020\025\337\226\352K"
+	.string	"\370\210\030\025M\212\337#\337\212<1\206\350\005\321\213\354\005|k\002\241\370\200\365M\274SUb\364\3249v\214\377\031\332\024\330"
+	.ascii	"\007hH\270\201u\031\f\t\205\303O\343\257\222\031\362\213\305"
+	.ascii	"\371J\221]c\034,\276\331Fw2\302\362\342*\347\234T\200l\342\261"
+	.ascii	"\373\224>\260G\204A\031j\f\355\234\373B\252\205\333\374\fA\036"
+	.ascii	"J\330!F\214Y\002\216\020\361j\260S$z\371{\b\372I\344\372V\234"
+	.ascii	"1^6\310\201E#fI\264\323\035\305\223\335\230\244\203\tx\035*\020"
+	.ascii	"\033\257\202\200\263\210\002)\304c\336x\314\307\374)\243n\253"
+	.ascii	"\227jm\315"
+	.text
+	.section	.gnu.lto_.pureconst.eabcc68afd87291b,"e",@progbits
+	.string	"(\265/\375 \241]\004"
+	.string	"\022\312!*0\351$\035\200\201\001\024#\0350T\320\350\302\300\300\300\300\300@\025\351\236u\207\037$\020\246)\221@\002\tM~\225~\212F\0027\205[\302\r\341vp3\270\025\354\b\356u\016\340\203\300\r\300\002\234+\254j\227\332\241\356\351\232n\351\222\356\350\212\316\320\t:?3x\316\316\013\034|\233Ss3\027\263\273\\\013\272\312\245\374&Wr#\027r{\374\034\273\006\226q\027Wae\002\033\020\027\177c\255\313.\306\230C"
+	.text
+	.section	.gnu.lto_.ipa_modref.eabcc68afd87291b,"e",@progbits
+	.string	"(\265/\375`\264\007-\031"
+	.string	"\226\231R; Q\223t"
+	.string	"\\\314\b\t(\300\3004\325 Ak\2618\302\2233\202\203\"@\016\202\254 \345?\"\2719\3418h\366c\346\315\215\253\337\356P|\377a\306[\017\263\255\265-w\n8"
+	.string	"E"
+	.string	"G"
+	.string	"Wn*J#`\250@\321j\034\366\306I\302-\023\225yV\272v9\206\355\234\336\231\177ws\372\211\364\273\364[\305G\232)\261\325\333\r\333\367=\265\203(\2569\037"
+	.ascii	"\213\240W\033)\202-\025<\360\337\204M\032\007\rt\260\024\337"
+	.ascii	"U\275\253\"\305\322\0027j\3012oY\b\264\323\273S\2226T\301\001"
+	.ascii	"7\022p2f\260\0279X\250\001(\"\306@z\324\215\316\314;Q\322;I\357"
+	.ascii	"\003E"
+	.string	"\f\206\377\302[\240\200n\213\nU\244\217\313\215\373V\341'\215\261J\242\220\023>0\374\262(\341\b\020\276\254\324\\\362`\217\345\340\006\307\300C\304Xf\266\242\022\307\211\276q\201\211\227\202\016\226\002\023dR\023\033)\001o2\033\317'39Kt0\323\351\331x>\231\351$\361\301L\247\207\262\016\"\016\277D,\033\226\324N\303\337\fW\224\215\206\\\f\020\r\027+@\177\310\335P\243\3461s\243+H5i\375D\364\373\350\027\"\200\364\250\341E*\221\246 )Lc`\002\031\232*\353\022\300\2641\210:i\250dF\n\013\222\322\036\007\017h1\n\310CT\230\225\225\355\250\206\340J\003Z\006+\324i\262\037\327\fN\225[\023'I\327P\3521)v\203\372\275$\030\256\023\t\205\0047N\t\021\355#\235\300,\250\356\222\375\304I\274\247Aj=\325\372g\036\005\261\250Y\007\241@\364o\b\316\265\271"
+	.ascii	"V\377\ngv\013\317\356g+\220/\2222\244\341~\204\t\312\320\240"
+	.ascii	"\324\2248\206{f\335\311\366\246==3\347\266\322\250\322!frz\027"
+	.ascii	"T\263\342\300r\260\b\360U\302p1%\032_~\250x5\337+G\324\361\025"
+	.ascii	"\277Vv\354\266\310\333\230\025\030_\204\252\373\202\361\3774"
+	.ascii	"\305p\3171c\033\203\276\360\221\315\242g\223\206\373\006\300"
+	.ascii	"\371\2466\327\274\234mS\371\310\3209\232\235@\302\224\263\f\303"
+	.ascii	"\272Q\255\206\341\221\020y\344\203\026t\322N`l\266\376o\361\254"
+	.ascii	"\215\214\365\252\355\017\306r\033\225\007\276V\226\2059'|j\246"
+	.ascii	"\214p\023\217G\276AjNv\364\020@\016\322__\0341w\245\370H\201"
+	.ascii	"\013\222G8\340\250\305C\030\207\336]\205\026\025\025LY\343\251"
+	.ascii	"\022#\203\217\322\316D6\016\332\227\305\275\271\360T\303\235"
+	.ascii	"j\013\374\262NL\033\rE\341l+\244\004\273\353N~\231v\333\307\013"
+	.ascii	"\201K\022\317i\200\246\r0kB2\217S\273\306 \305qF\344\3670G/\216"
+	.ascii	"v\3200\0374\023\267\220\004\376\217\251\320\325\312\275E\025"
+	.ascii	"\243\325\035\261\005I\031\255\332%@\361z*eE<\242C\267\376\245"
+	.ascii	"6'\212\001\365\201\201\210\375s\bz\025\274;~W\254\250\305\001"
+	.ascii	"!\277}\306\376\021T\005Dq\236\211\223\002"
+	.text
+	.section	.gnu.lto_.lto.eabcc68afd87291b,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_dyad_realloc.19.eabcc68afd87291b,"e",@progbits
+	.string	"(\265/\375`\375"
+	.string	"=\r"
+	.string	"\266\232]C\020q\224\016\003\340\220\304\345:\353U\037\004\266\035^\305dt\027\320\330\003\022r\211\365\313U\204\261\03751"
+	.string	"\260\372\034L>v"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"t@jy\204\261\241\244\023<\022\223mDJ\376\336R\246\024J"
+	.string	"D"
+	.string	"I"
+	.string	"\266\375\023_\331\354\326"
+	.string	"OD\312\225\032\301\251\310\261\353e\366\356\201y\314\\"
+	.string	"\346QC|;\324\334|\006\247\031\235Ith\205\017^d\2508&\022\324\017%\236zj0\2152/\b\273\353\354L)w\274m\007\266\033\330\307\020\277\316\362G\230\2060\2550\235\232\276\206\300\312Y\255\335\r\337\313\256\242\013\t\333\267\275\331\032\333\231\366\275\243\330\316b\030\306v=\304h\331]\020\037\310<v\240\237G\271\365"
+	.string	"\273*\252\226]\017\304\0052\217\001\037'\023\352\013\030\250\037)\033\244\324a\325T\250gq\034\022<\252j\272\340^d\3074\225sb\301\271\214\362\363\225\327Km\013&\371\016\323N\006\0259\352uA\207\217\333\201\222\237\355\211RA\330\207\253*\366Q7v\324\003>\001i\237\221Og\202\326\t\231h\034\222\203B%j\t\nDBND2\022O\310'\213\340\251\340a\255d\004\224\2054\r\224i\274\275\215\351\246\204c\205\242#\375X4T\020@>\305[x65vK\357(dJ\b\f<\332\037-\3379W\334X\221T\024\021"
+	.string	"\242\310\220\031Z\317\b\342\013\177\325\025Vmo\r\2416\3426\231`1\003\215\314"
+	.string	"]\303\337\331\304\201\023Hhc"
+	.ascii	"\345L\036A\355\001"
+	.text
+	.section	.gnu.lto_select_grow.24.eabcc68afd87291b,"e",@progbits
+	.string	"(\265/\375`S\003-\027"
+	.string	"\326\253\222E\300\032'\035\220,\276\023?\342\202P\326E"
+	.string	"\025\021\356\177gB\357\321\330\207\222\302\224D\177\202\273\337\250=\3212\250\303~\030'\256h\203"
+	.string	"\2208\215\013\3014\003\355\237,\250Y\200\266\332'\333\b!{K\231R|"
+	.string	"w"
+	.string	"\200"
+	.string	"D\"\034\301\260\262\2734\217\236\361\036e\340\323\376\217\003\201\035\310\304\001\354\356\030A\262k;\340\002\336\243m_q\217\336\003p\217\206\331Tn\363\331\256\307E\316\220\226\335ei\217\365\320vs\t{\307E\250\t\363\323G\021\255\026{\007S90\301\211\344v\264x\344~\216h\265\026\207\245\032\213\353\251\206\003ev\367CO\235\232,\263{\260\273NZm\305\355\3356\n\333\013l\235\005\313\300\037B\341\203"
+	.ascii	"\037\034\217\276\t\356Q\245!\210~\200n\362f\333b\377"
+	.string	"*\217\375\257\356\3301\231^=\350V\035\350\017\220\351\324\205nTL\2374m\3224\214\246?M\2272M\312\264\307\245\273\230\3462\035a\032\302\264j:3\375\001\244)?\212\034\f\331Mq\353\262Ob\222\034\017\372\205.\344C\376\204l$\203\223Z\234\236\027:\024x\266\007\201=\310Fp\003J\324\307\013\355\212)\243rjcp\345i\235N\230qBc\025\216d\304\214\317\3566\2605\274\210\303#\201(\234\316\330H\0025\352\367$8U\250\237\361\220\345\315\251\252ItM}\316\227\233\274\031\361\256\037\215#[Tw7\026\225\307\231\006n\242\351JS\252c\247\264H\242\244\270\270\311\033\204\006\256\322\225~\326E\226\267\333\266\273\252<\246\271J3\304\250\"d\nNr\261\375:\021\033y\273\001\256\227\020\341\252iyhA\260\331\360\372B\3345\blZ%lX\035\\-\016,\013\256\r+\277<\\"
+	.string	"\301\022\361z\201`}\266\275\356X\202\222'7*s\247<&\321b\214\352\rHs\224\352\0348J_\343\220Ci\214^\305\317\321LF*?\245\371I\355VM\236\346o\306Lc6i\247'\375\254\207\254\311a\324\004\243\211\305N\270\222~Z\372\311B\322\222J=%\251\022\315t\310\230x\252P\212\266"
+	.ascii	"u\272d\204)JB\250A4\247\230B\212HM \321\b\005\206-\006p\002\031"
+	.ascii	":\273\003\021p\305rW\322l\007\"6g\330\372\350\"\226\013S\220"
+	.ascii	"\251\337\3063\331\315\007J\250m\345\301\232\225\326\372\247\307"
+	.ascii	"\203#<\347(\257\002Cs4d]N\241d\017y\231\375\025\253\366\242U"
+	.ascii	"9\375F\347\216\200\317\037\213v\211\246\316\221v<\217\253s\005"
+	.ascii	"\377\367\345\016\362N\321.O\n\030\266>S\245F\273\024|\21401\004"
+	.ascii	"\rn\tE\344a\025\204\350\310F\262|}\t-|}Pf\334`S\302\037"
+	.text
+	.section	.gnu.lto_select_zero.25.eabcc68afd87291b,"e",@progbits
+	.string	"(\265/\375`\351\001\245\020"
+	.string	"\006`mF\320TQ:2c\017\001\272\033\375\230>\205\016\252\002D\352\364\304\3072\020o\261\034P@\313^\243\333\340Y\333[\fy\343g\202\247\222\362\001_<@\325\364m\264\255~A\245\273\0354)^^\332\332\336[\312\224\002X"
+	.string	"V"
+	.string	"X"
+	.ascii	"\3610\364\001\361\320,{\3109\332\202`bVlzv\027\2450\326?\356"
+	.ascii	"\206\311z\204O\223\345\267\036_\200\335%\311\266\327`wa\t[\264"
+	.ascii	"\374E\231\233\230\254\345\372\024\270\354 A\222\275^\311\307"
+	.ascii	"\t!\357\236,\262-\023T\262\273\316\230l\304\r\272m\227\355\004"
+	.ascii	"v:\b%6\353\213=\372\314\017\3405w|i\250\351\247i\315tf\372$\022"
+	.ascii	"\"?8\"\360\354\206\250\375l\017\230\303\3425\277\375w\026\331"
+	.ascii	"\334iX\257\261\316[\034\t<+\212\354\256\351\320\bB\207\005\336"
+	.ascii	"\323~\214\313`}F\345\002v_j\344\330\345N>\020:4\367R9\337[GT"
+	.ascii	"}z\332\\\274\262\346T\325\257\034qe\215F*\350\005\017\325\335"
+	.ascii	"m=\235\331\252\343pH\232v;=FvwUg6\375J\240\003\002K\037\333)"
+	.ascii	"\237a\235\320\356>\360m.x\b\305\034\372*\361\360\372\356\006"
+	.ascii	"^;0f\\Y\263\271V\352\314\376iz\002\251\247\334\024\030\234\230"
+	.ascii	"\2008AiH\231\240\240&\2442\224\254\332Pa\205\352\240R\255P\""
+	.ascii	"n_\342\322W\324\231Ibo\244\252BM\217\312rz\324\243\350\202\300"
+	.ascii	"\322\347\017.x\324\221^\204\314\315\3462\312\247\246C\265-\244"
+	.ascii	"\3621\213Ll\332Z\375\306\207\022mw!\330\030n\003\345\220\364"
+	.ascii	"\003j)E' \220\002!1\354\001\302\310\020B\233\221\270\0040\n\344"
+	.ascii	"\223\273\016-o\307\265\261\224Mo\336\253\366\005nK\3436\362\215"
+	.ascii	"a\266\302\236*\302~D\304^(\260[P~\214*\306\371\310\232$`\356"
+	.ascii	"\001Wc\237<x\3230M\344\361J'.8\004\270\003\212\0024\234\2242"
+	.ascii	"\232\013B\001"
+	.text
+	.section	.gnu.lto_select_add.26.eabcc68afd87291b,"e",@progbits
+	.string	"(\265/\375`\351\002-\026"
+	.string	"\006j\217F\320\026Q:T\244\274\025\177\236\216\217)=\314]L\235Ot"
+	.string	"@\236\231\036\375b~l5LN\325\365\253\311\234\023\366x\372\214+\301R\n\007\271\235"
+	.string	"T\031\2130\241\231{,\212\232\226\327\306O\b\331D\312\224\002y"
+	.string	"r"
+	.string	"~"
+	.string	"\335\323~\216\317T\247\221\270\313\256\316\217 \273a\214\017\200\217\016\377\342=\202/y\217V\331L\036\312\366\203as\371\210\262\273'\205\341.U\377\274\330i\252\374L\001\205\205\263\301p\376\251\270\307\002su\005vW\004ke\354\276\234\0232X`9\235LP\023\237\327\236&`\254\354h\304\256\257\335@\n&<p6X\354\371I\330]\347\013\206\342\006o\373e\333\201\255\b\002\262\240&V\035;\323\246\230.\235\347&}\307\357\362\036\377\350\264\277%\323\"/\275\342\245C\231\006\275\364\347\245\275.\035c\272\213i\315tf\372\001JPX8$8\233\342\302=\221\233\262?\321g\306y~\373\257Yd\233gD\267+\302E\021a\366\223#\312n\310\340\3211\266\366HIY\220\341u\250\276\3037\207v_\024\t\262\2731N"
+	.string	">\026\bF\274\222v\212\240U#\252\226\364\255*#U}@\353qUYe\256\302{0\300(\331]\031\273\346@4<\002\220\221\224\302\023\034>\253\314E\335\361HSI:\234$9R\"\203\f\356}\363\256\251\t\324\252\301\312\234m\233\377\360\r\334]\b\276\315\302\0060\006\t\357\361:\300\305\023\0273\332*s\335\356n\347P\266\250\215\002\221\1779{f?%\024GkCr`\252;v\210\223\227\t\037N\223!ojD\250\210\033\203\003\232\231\024\315\311\203\315L\207\323\005\033\016/F}\250\tq\272A\241B\234D\341^u&\020\371Y)\353\323\035\")\223\022\002KZ\2542w\230\330\354\206'R\001<\354\231\017I\211T\205"
+	.ascii	"\341\240\255h\312\376r\022ROW\264\273\271b\240\206\364\23768"
+	.ascii	"\250\035\225\326\024\223~\372\332_\200\b<\345\215\324\244N\327"
+	.ascii	"\n\326\205\334(\360Gx\217\236\336\004\213\225\2224\352[6\272"
+	.ascii	";: `\002\221r\272\003B2\304\321\3649\305\rJM\275\336\326ga\271"
+	.ascii	"A\334\347\006K\213P\t\t\333r\203\233\210a\256\2067\312@ .h\300"
+	.ascii	"\240\214p\234\314\277.\020b'\201\301\0319\304\205\013\023\027"
+	.ascii	"\211@,\214\303\326\rW\343N\243J\202 \006\3531\226&Vi\310`]\270"
+	.ascii	"Pp\322V\315\224j\373\3133\2215\300\024i,\200\242\320n\330x\023"
+	.ascii	"iby\333\315\240\352\241j\350\330l/\344\221\227\200\237"
+	.text
+	.section	.gnu.lto_panic.36.eabcc68afd87291b,"e",@progbits
+	.string	"(\265/\375`\276\001\215\020"
+	.string	"\366\035nI\300\222U:\320\0251\371$\344>0\364\276\337\001}\314\007\033{\267)\360s+"
+	.string	"\215\200|\200\216\270\204\357\371\367*\025w\213\275zY\205\302\315Me\304\247o\301!\207\354@\351\250\322n\223\267\220\204\270\266\237l\262eJ\001V"
+	.string	"R"
+	.string	"["
+	.string	">\037\036`\027\247\005o7\227b\023\322\247s7\211\237\244\013\020?\375\262\211\236\303\355H\305P\210\027?vw\224:\177}\206R_\276\347\315\303\220\332\315eX2A\204c\244&\013\033\354\250\241\270\356:\242\006Bu\004aw\255\264Z\211[\274m\025\333\017l\035\003{\232\275\201\203\236\346\353\276b\003\n\002i$\314\316\301T\346\330\017ww-q\354\373\374S\252_b)\252\271\371$\004\355\326\004\001\022\373M\032+\376\363\333\277\316%;w\027\257\377x\370\316lTr\350"
+	.string	"\356\332\240|Z\001\351\363\004\256\366y\336\363z)n\210\230!e\216[\304K\003\272!\231\026\331\227q^\213\277c\013..\342\347\345H\207\347\326s\"\246AL\242'\024"
+	.ascii	"\233P\020(\2230\213\350\tn\312\357\036C5\202\333\215\001\035"
+	.ascii	"\006\214\277\363\351\224JO\373\364U+\226\210\215\027\004\316"
+	.ascii	"$\314#E\371w\327\271\020\220\330\r\016q%(q\200J\305\234dJH\\"
+	.ascii	"0\255S8\263\312 \215b\360r\352\3602\306\244N\253\361BJ\203\311"
+	.ascii	",\031\f\255q\206\305j\215\245\221\357\003\272\340\366J\204\367"
+	.ascii	"\202?\331,`Ce\202\363}\367\240\t\263\323(\220f)',\025\264\327"
+	.ascii	"\343Gc\337\315\007\213p\200~\367\032*\223POZ{<~2\031# p\002\031"
+	.ascii	"\261\274\003\371\361E7~5\247\270IK\255\307\025\313\373\262H\355"
+	.ascii	"Z\020-\20599\213=,=W\276\342V\\\017\3104#\237\004\215f$\013*"
+	.ascii	"\322\222\262\211\264\345\243\210\355\246\332\r\210\254-\0167"
+	.ascii	"z\303\035\027\006\213<J%\350\222g\271\032\027\335\003"
+	.text
+	.section	.gnu.lto_destroyClosedStreams.38.eabcc68afd87291b,"e",@progbits
+	.string	"(\265/\375`\366\001e\021"
+	.string	"F`sG\340\3604\035\330L~\307\254\017\354d~\236\226U\017\344\302Jr\201\333\207\244\316\250\363\203\025\256\035\024\317\357m\326l[\031\321 \250\231\324\274\026\021!\304h\006A0d\323x1iR\326\230\357\215\232\bm\"eJ\001a"
+	.string	"W"
+	.string	"^"
+	.string	";S\343\321p\301H\307\234\323[\035s\272\372\306i\022[]\371\332\302\306\027\272|\3034\326\214\317_\320\334`\"O\257\244\213W0\204Q.\253\301\271fs\331\2056\3070\003/\025M"
+	.ascii	"B\026\3661\343\363\241\302\030\335\213_\300\303\341\306\207\032"
+	.ascii	"\234\253\246`\316i\375\302\232\273\273m\031\333\236\255\007\002"
+	.ascii	".\272-\373\";O/o\216\335}\350\3262y\327\255\252>"
+	.string	"\252\243!\304\242\301\322\2343=vL&\231\364\363\241\337u\265o\177\364\211\206@\260C\310v\371\213F\371B\037\261\272K\365i\201\206\373\300\r\2579\307\220K\203l\227\036\377\221]n\017\220]ze\327\370\030\235\352\332()\375\347]!2\305\254\213\355\b?\241\002\211\241\355\211^\300(E\3203\3744a\300\266\345\220\177I\212d\304\350\223\355\225\233\260\3226\347L\340\037U\220\260\365\250\262\313\357\346@\341\344\332\243%V\270\333\"q#\225\337\343\t-\372\357\322o\311.\345J\026\222\323\315\213\366\260\307,\024LR0\224\021\023\025\226\225\314\016\020\224\214\264\224x)'#(\036\311\311\203\017\247 \230\250x,\251\224\212\207\032\3477\307\f\\0\275,\314\306y\020\341R\271\306\264nu\301\022\327\035\320\203\243h\306\217\3159'\267-_\274\004\002A\364\315\tH\006\323\266[\320\276\206$`'\333\213'"
+	.ascii	"C)HC\350\310\360\220\001( \220\202\031;vB\031\221h\n\347@\273"
+	.ascii	"K*\254\234\251\b9\031\230\201\332\266&728\340{\307\340\206|Z"
+	.ascii	"\305\t\3578b7\003Y&_Q0r\242!\f\236\232\370V{O\333UX\350+\b\327"
+	.ascii	"\322\021\214\321 \375\r\"B\311\371\006[?\267\234\021\217_\356"
+	.ascii	"\347\204\251\205d"
+	.text
+	.section	.gnu.lto_updateTickTimer.39.eabcc68afd87291b,"e",@progbits
+	.string	"(\265/\375`1\006\005%"
+	.string	"\032A@\016I\200\332Q:\341\023\342\357\354\255\234=`\231\332\330\204\254\266Q\003\0018b\355\254\247\237x\342\ry\330\242}]\032<\034\226\354i\244o\363\214ql\033\215\325\210rc\034\265+]"
+	.string	"\026\250\006\257P\034\257m\237\020\"w\222\001\317"
+	.string	"\302"
+	.string	"\327"
+	.string	"\027s\362'S\017\373UE\240\342\004\301\355j#\217\256[\227|\346\002 j\276\344I\276\222sH \325\275\030\002\2205-\257{/\025\037\311\271\253\374\257\203Q]I\212\364f!\257\013\034%\2250^l\356\3052\272\312\005nW\177\277[\257\352\\\267^\355\034\003\231\315\034\271um>\222\250X\262\271\367\362\232\007\257\234k\340qr\266UMqm\201|\233eK\321Xu\234s\301\2221\264\271\035-f\334\226\332\254X\004\t`T\221\036A\237dwZ\331u\b\214\253w>5\202\345L\321\b\343\251\235q\334"
+	.ascii	"\034-b\274S\005O\347\232s\301\212\221\356X\004)\276\353\366\312"
+	.ascii	"(\264\326&\341\336\313\266hlq\316933a\346$\346U@C\322\332<\255"
+	.ascii	"\272\312\356\020:\273\217\354dfK\340-\244\0243\264"
+	.string	"P\346O9\032;\371?\370\211\233\366En\256W\337\352\231\026\256\254\240\2152#\205\266\217\314_\241Q!\334:\230W\313D\253\345\241\325\262\220\315r\320j\031\310f\371g\265\354\263Z\336\255\226{l\226u\253e\036\233\345\035\2357\233\347u\265\254\256\226\323\325r\257\226\355j\371\007p\326\254\211y@\273\227Et\355\246\251dB\236\374\313\376\345\017\345o\362\241\274\214o&\246$\266\342y\357\324\311X]\252!\271\027\177\354N\316E\271\024\340\233R\270\242\330\223\347\275\310\004\267\253|\273n\005>\354\367K\304\262p\025\366\274C,\243)\016G6\3633R\024\224\354\213J\353\325\234\356\345\027\256\254\340\311T\b\020\346^\342\213\027n\304\006\b0|,Co)\302\370=\223e}dre\345\316g\353\313X\303\315\370\314n\251\313*4|\254\203\363\225\325\350/\273\332\006\356r/\034\370?\256\376\354f\035"
+	.ascii	"l\335{\323s\231\265\314\303\007kv\334\224\027i\304\256:\332\202"
+	.ascii	">S\234O\247\275\353\006\212hQ\202\tC\223\"\275\027\007\3223i"
+	.ascii	"\243\274k\236\366\321\022:O\234q\346\206\0257C\232\227\031)\032"
+	.ascii	"\2652\2747H\240\247w}\"\021\241\215\262\256{:\035\003qfO\327"
+	.ascii	"D=\300v\232\247\255\032\361\371%\373\316dz\260\323\275\204\214"
+	.ascii	"\227\326\027X\216\345\375M\316l\272\335{\227#\234\354\213|\346"
+	.ascii	"qM\002\274\304\004%\345\363=\025\235\350\211(\032\341k\212*\352"
+	.ascii	"\351\234zLPQ'V\246\243\210\262\354c\260\324\373-\361J4\365\234"
+	.ascii	"x!\232H\354\370\311\004\023\024/\352\351\t\212\227C\006\337:"
+	.ascii	"8\034I\013\266\020\247\217L\324j'a\031Z\250\r\252\375\256[$@"
+	.ascii	"\326\264\276\262\222C\r\324D\317r\241\036\nj\241N\307@\\\031"
+	.ascii	"\364\323@I\366]\371\303\344\312\244\362G\312\001\265\221\373"
+	.ascii	"AI\241E4\335\266\323>\033v\002\271\272qkl\253E\310\264\261\365"
+	.ascii	"\221\177\\oT\235>\0273\315\351\265\257\320|m\242 G\224c\206\026"
+	.ascii	"\232\336{\357\332\307\256\253\221\272\361\323@\001\277~~H\255"
+	.ascii	"Wu\272\325\300\264\001+\262'\373X\207\333\332\314\023\222\032"
+	.ascii	"\255FZ7A\2632\252\035}\250Q\034\305 S\210\241\021\2220\232\202"
+	.ascii	"B\016p\002\231\251*\363\022\200\006\256sTQ\020\0256\366\337\""
+	.ascii	"\244\230\317\246\377\r[\016\214\344(\370\262\270PpAo\311\356"
+	.ascii	"2\376\210\n\306\370\267\311\002\310\253?\003\266\214\271\360"
+	.ascii	"C\253+HBp\343\226\214\234~\331S\333\244\352\364\263a\362v\240"
+	.ascii	"\r;\256M\006f\007\333\345\2272B#4\344,L\b8\265\245\265\340>6"
+	.ascii	"\206\2644\307\316\237\252\215\320\267hj\340\017_t\247\201\205"
+	.ascii	"\021\322\021;\004\251\334d\336~\230\362\222y\236\231\313b\221"
+	.ascii	"\325\303\315\310;\257\246js\217\216\263m_%\177_\325\2616\221"
+	.ascii	"y\204\3312\367\262\275\371\005D\326\001\303\323\242\361\374b"
+	.ascii	"\005\\N\023\253\355V\300\001\004\200N\375\340I\212\321\3206\206"
+	.ascii	"4\206\270\351\347\023\003\205\233L|[X\303\316\377\004\3105.F"
+	.ascii	"\303\215\321\376\315P\352<\275Q}\226\314\220\262_\027fX\202\327"
+	.ascii	"\304\334\221\3540\336\317<D\025"
+	.text
+	.section	.gnu.lto_updateStreamTimeouts.40.eabcc68afd87291b,"e",@progbits
+	.string	"(\265/\375`\023\005\035\""
+	.string	"\366\375\331I\200\030R:\3766\037\"\bh\204\004C\275LY\r\316Nc7\275\200\343(\235\260`w\226jj\002\306Gy?\240\324\013\033D8\032\016A\312~\214ek\331\342V\217y3L\032\253)\370\266\036\"\332>\211%D\356$\003\303"
+	.string	"\276"
+	.string	"\310"
+	.ascii	"(\263\0233\357h_\354H\346\035\177d\375\330\223\356g\345\306\274"
+	.ascii	"\367x@=\312*?\354\305\365F\250_\037\020\303\031\027\346\245\002"
+	.ascii	"\006\035e\003\352\321>\336'wT\350=\271\243\2742\203\371Q\353"
+	.ascii	"\246?\252\270(;s\357\355u\017\326\331\365;\235\232C\317\266+"
+	.ascii	"\337Z\t\363\013F}w\246UW\\\307\002\264q\n\241a.\217\274\265\n"
+	.ascii	"NY]:\201\007V\215\253\005\262\260\204\317\235\n\206Sb\340\004"
+	.ascii	"}\247\317\025\035oO\276\300\027Ph\321S\001SY\306\347\212\353"
+	.ascii	"\307\013V\331\363\374\301\002\024\236?\367^^\220\312\366\221"
+	.ascii	"\277\360\343ML\026V\215\333t\302\275\227\355/\210u\346\235\231"
+	.ascii	"\20303\005f\024@i$ \334t\037y\013\033\026\215R\266\3117\266\367"
+	.ascii	"3yZ\t\365\336\213vt\302\376"
+	.string	"\307O\273\016\211W[\034\263\252\243\230\217S\266\211\314\027\322B\303\344\336\301=\251e\236\324\362NjYG\265\234\223Z\306Q-\337\330\350>v>S\313\235Z\266\251\345\017\3305\303\236\2040s\357US\315mC\227]G\373\227\277\361\037\373\311|\276\362K\376\232\332\013\346\322\311\030%\2229\263\304Wc\336\322\215PQ\021\236\230}\311\321\370i\314;[\233N\306B\\j\206aM\3743\346\231=I\323\225\2648\257\360xa\354\220O\334\302\316\334\013\\\240\036\375\325y\331\223\314<v:\031\267\f5E\036\314\274\212\335\013+U~\027\026\024\266\236rG\337\rW&\256\2218\251\nv\023y\313\335\236\370[\\\301\202\375\317B\356\250\256\233\b\027'\224\272\026\f7n\367\372\376\313\240\372\032 8\312\254\341b\033\216\374\371U\305\311o\006\324\262\211I0\341\356\314\226\373\2229|\215\331\254\026Z\006\005G"
+	.ascii	"\373\340,%\027\364/_\245\003O9\025\017\374\255\243o\362\265\241"
+	.ascii	"\033\255\243\347\371Kn\371\001\204]\373\006\257\034qL_Gq\213"
+	.ascii	"\363\336,\t\3141\333\344\235\306i\236!+\357\273\021&G\2244^j"
+	.ascii	"\227YB\263\031\205\352^) \235\336\351\373\276\246l\223sZ\247"
+	.ascii	"O\264\020O\023\221\323\004|4N[->\346\321\230\350\001\314\324"
+	.ascii	"\224\364Sd\204t\304\364\263\303\202\311\"\021\031)1-\345\214"
+	.ascii	"\316$\030\024\0219\025\365R\034\021!\365F\034\241\360\341$\025"
+	.ascii	"FJ=\246\244$\245\036\357(\365\336\301Ci\332\244z\212\241\214"
+	.ascii	"\273&\362\n1\243j\323/\022\261\272>\333\212\313\317\026\320%"
+	.ascii	"\344\274\367"
+	.string	"^\035\220\303=\001\320\272\367\3324\216\256\267aQM`\317\346'W\257U\210\375\217O\007L\334\262rA\357i\001H.O\362:\344c\230\215{\372\311\003)\341\230\303\242\001{\262\213\r\251g3\257`\253\021\033'V\332\252:\212\317h\244\371\241M\344\356\267\t\344\024\333<\335m\327\370\202L\331f\361`l\247pf\300\236\305\313\230\331\251df\013\364\036\201\354Be\321\004b\250a C\030c\f)2B\201\2204\306\034`\002\221)4;\021\3409DCS\311\306\030\252\f\241\275d\237d\326\020\200\246#I\360\241\274\275:\031\316\354B\302\b\007\330s\024\2423\331J\002)\241\301\247\301\257\250Cw\274x!?\224\337\310\360 \326\203F\264W@\316\232T%\364,\2065;\034Xh3J\366\351\214\310A\377P\212_\345\306\340\027tI\\\300\344\217t\336E\345V\303m\235Q\273\034'&qd"
+	.string	"Ks\241\334\0240\261"
+	.ascii	"\031\340\270{\220N\321+\301l8/,dA<X\244Od1J\237\356&-\253\320"
+	.ascii	"\b?\257*\303\255\255v(\306\364}M\333p\016\246;=jt0`\017>\020"
+	.ascii	"\226\372F\301\363\350\361\203\344\341\026e\3040h\0021\025"
+	.text
+	.section	.gnu.lto_stream_destroy.41.eabcc68afd87291b,"e",@progbits
+	.string	"(\265/\375`,\005M\037"
+	.string	"&\370\302G\220\232Nc\260\266/Dc\324SU\362\220\377\b\351\231\017\022p\240\306\217\223z&\300\f\200\304\206gH\375\221\004\331:\203tC\227z$\t"
+	.string	"CL\002\214fQ"
+	.string	""
+	.string	"\034X\323\026\234\253\212\221\b\221\275\267\334R\246\024\251"
+	.string	"\246"
+	.string	"\260"
+	.string	"\267\026\366\355\326^\311O\337\226|\253w\256\243\013Od\f/\323\214\007\345m\335\271\2001\210\364\3534\303fZE\r\357\r\346\334:\307>\265\217\344Z\275\003y\017p/\225\224\260{\203\r\254\240\274u\3606\343my\001\343\255{\366\227\007\177\227\264\212\361t\226\271\367\346*\017\217\264wr\264b\245=\237r\001c\372\222N\212dS\024\020\234\357I\334Y\033\2125\3211\210\324\355\317\213B\322\314L\237\324\305\032\257\342\r\025\264'\234\217ID@\205C\355\347)\224o\211Rr\302\275\327\324\364\321\270\313\333\206a\333\203m1\004\247\211\334m\236\237\366b\035\333\024\203\333'~\232\314:,\300\324\246\304Ze\033"
+	.string	"}\265Q"
+	.ascii	"\321\233\246S\260\320\230jR\201-+e\265V=h|%\260\225\306D\327"
+	.ascii	"l\2478\224\240\362\336\253\343\213\365\354\312\037\274\361\366"
+	.ascii	"\265\226}\251\001\225h\032;\270Dk\225\375\235\337\332\320\225"
+	.ascii	"\312\2669\360\307\335H\352\032\222\332FR\227#5i\251GKmO-\236"
+	.ascii	"\272>xSK\375\004\267+$[~\300\334\033\225\346\314E\263bW\017\376"
+	.ascii	"\\aV\246\300\242|U\231\362\032\317\242\274\311\273\354\233[\234"
+	.ascii	"\211u\316\214\334{\0037\3038\270\255c\275"
+	.string	"\323\215%/\377b2\377\207)x\214\336\364\330xk\253%b\2265%V_\313\013\336\205O\3140i<\261Z\25125 Y\253\fD\006\2646\265\232\242+ \325\035ce\356U\272y\253P\270Z\353u\\\313\017\257\364\221\306\333Z#\244\231A\331\020\357\275w\254U\316\202\204\373\331\026\216\205W\212\271\330\r\370\331\324\biWj\023\263&\2375@\317\344g\006\023Wm\r\034>%\tZSM\262\217\326\001\200\360^\247\233\037J'\b\013@\374\fA\177\020\266\2201\245rn\213\030\032\355\021?\207.\3456\t\337\304h\227x\366\321\035\355\210\214\212t>7B:]\317M\021\317\317\315\215\356\307\350\200\356F.tBb\020\217\216\310\250h\364\t\007><G>9! \236\240\\\017\220\n\033\357V\350\210rF\273\035Q\356f\333A\245\213\343\255Rk\026\2466T\252K>\022\357\325!\341\\\377\371"
+	.string	"\303%\270\352\207\205\235\346\300\2415\325\007\003\343q4C5>\260\272\330\252\377\365\325\343f||\255g\205#\2649\301\022\226\325\367\362\272:\231\241 \037\323\033\202\363+\353\317S/,,7\264p(Y\375\256^\221^V\3277d]\265!SM:r1E\356i=L/\211\002\341"
+	.string	"!YmRgY\300\261\016\003d\250a(\244\224S\220\314\210\210L\030i\222\016\220\002\221)+\017\021P=Cv%\3154\006\312\200\002Ce\324\223\236\021y}\022\2360X\256H<\322\353t&P,c0\341\330G\207\007\223\230\020pB\254\225\023-\201\204\372HJ&\261\324 \215G$(0\277(\027)m\252\276\253\035\0255\314.I;\266\005@\302\212\266\352\210\024\346\326\265\272\f\345 \366p\246\245$\305Su\226\361\nI{\354"
+	.string	"y,8e\277\027\333\271\3604\240\365_\243"
+	.string	"f\305\311\234U6\017i\373\216y+\354\t\301D\312\031?\230U\345\035\275 \200fi\221\346\252\300\203"
+	.string	"\t\020G\360f\272H\223\205\\\217\220\"\222\023b'\223\325\214s\342\376E{\240Y\246["
+	.ascii	"\003P\262%\240)&U\003"
+	.text
+	.section	.gnu.lto_stream_emitEvent.42.eabcc68afd87291b,"e",@progbits
+	.string	"(\265/\375`\342\003\035\032"
+	.string	"\226\357\245H\260\226Q:\344 wy\224%\337u\206p\212\300E\331\376\365VC\213\241\224\260\235\\\361\316x\f\364\177\350:\343Ko\201U#\316\367\022\2521\2359\375\t\205\374\353}J1\204\267\217\275\307\265\205\373\243\021B\366\226;\245\222"
+	.string	"\207"
+	.string	"\223"
+	.ascii	"\322~\217\373\240=\007"
+	.string	"\364\231Z\223\236\220\324\252c`\003\343\251u\247\tO\307\277\302S\323\354,\327\341\252X\303G\304\363Rk\205\255\f\217\222v\326(\206t\256\244\371\022\030,\272\005\2355\305!\0226\036\245\304\212\371\340\212\312\351\274\232\034\227\216\220.\252x8_+\210H\311\334\210\346\002\251\034,l\222\242\370\234\n\\49!s\033\2324Q1\260\334wit\023\222{\336'p\210\026\030GH\227\"\204Z\253e\321\355\350\216\271m\032\266\035\330\313%\276\220\f=\022GCDx\272J\246\360h1B\006m]\220\\%\373\017pWY\274I\266M\315{\367\353\271\177\346\272?\200\353Lw\213J\307\2544k\245GQZ\f\245C*M\251\364\234\322;\245\345J_\300w\004wE;\275ZI\004\277T(\352t\343\275\237\311~\223\357\353\315^m%XD@\"T\265\352`\343\351\317s\313\007\362\035\355L\376\315\352\213"
+	.string	"\fBUk\27595\203\361\264\300\224:\021\301\233\007\313\252\002Z\231\24042\300Z\\\003x!\264A\266'\374\251\202\270[E\305*\\\333\302\231\030\350\302I^\321\026\f_b`\270\342\022\225\263\350\20245W\311t\347\352\354\252\b\311+\333\032\376\363\217.\201*\271\234'\361\317\211\302\206q\2664\205\224Un\367\373\332\203\261\351\020p?\205rwo\303Q\223A\273VnX\204(\214c?2\303\301\271\303\215\310\212\\\360``\n(<\375\336\367\233&)\036\271\355-\031\272\255g\326\346\371\020\240\261\326\332 >\261\017\261\237\020\262\235Q\366\330yrb>?!Bo\300\341\2203\343"
+	.string	"\373 \313\341\201\351\310vh\334\003\"\346\003\373\351\351\361\201\265t\365\233d\013?\240Fl\215\212\265JnY\021mvg\310\233\273\326\310\2651\373\245\335\023\t\217\362\357"
+	.ascii	"\324\200\230\004MS\254>k\255u\\%\337\3671\352\311HX\263\236\324"
+	.ascii	"\265\2555\262\027\274\2656{\336i\017,P$\n\021\347\256\255Y\036"
+	.ascii	")6\0275\231\373Ru%|-kuvVv\307e\255\004\332t\324\236\314\020L"
+	.ascii	"9!0\006L\250A(e\030t\210\214L4BC\201\322bp\002\0212,\017\020"
+	.ascii	"P\210\246\270\262\031\"F\316*\204\362s\351\224\321\247\212z\260"
+	.ascii	"\267\374omuw\302)\016\024\273\346k\004\253\021\347TB\032\375"
+	.ascii	"\224ZmT,I\026\346[\234J\374\247\234\224\204\316\263d\036\252"
+	.ascii	"\036\352\207A\r'z(k.\\\213\244\245\367\301\255\204^g\f\335L\247"
+	.ascii	"{p\026\232\006\274r\335;?s\036\207\335\336`\021\347\036{\201"
+	.ascii	"\\\007\3446\005\360\237\225&\374\215\320L0\216)Ff\034\020\324"
+	.ascii	"b\002\331\330x\222I\303[w\231\303\254\232L\364Q\001"
+	.text
+	.section	.gnu.lto_stream_error.43.eabcc68afd87291b,"e",@progbits
+	.string	"(\265/\375`\203\003m\031"
+	.string	"f\256\243I\240XU:@\365\203\237:\245\220\213\350\32329\2044<y\374A*d_\234'\257\364\205\2377r"
+	.string	"ul\310&\213\362\365\315\217\2009\214\007<\217^<\025;Xg\315^\334\327 +"
+	.string	"\3737T+\020I#\233\354\235d\214"
+	.string	"\206"
+	.string	"\220"
+	.string	"M\270H\3464\257\007\214\264\273{xf\376\306\310\n\\\261F\366\312|%_r\376\211\305u\272}LI\273\201=|\300\374e\340a\345\257\371"
+	.ascii	"\345/\237\314d\016\3745K\210\225\222\0234\335=\263@~\236U^\322"
+	.ascii	"\326\223\177\341oP\337\321Y6^\222<:\264\320x\371z$\254K\0171"
+	.ascii	"O\225\352e:\331\3621\335\222<\307)3/\037\217\204-\rA/|}\341K"
+	.ascii	"\252\225\025\241\273\271\242\276\031g\363\314\234\202\231-0\333"
+	.ascii	"$\001\300\244j\233\230O\266\365\361\372\323\337:\360\277o\362"
+	.ascii	"\223f\345\303\356t&\210\303\204\225\356\245+6m\274TDN\374\241"
+	.ascii	"~\251[\346\363\251\234\310/\262\213\352$\372\220\357\0173D|*"
+	.ascii	"v\021Iq\361)O\231]\274\373\220im\220t\267\353\227y\307\354\372"
+	.ascii	"\255\217\272\220]Q.\345\274T\221\331E*\304\bs\354v`\376\346t"
+	.ascii	"\355?9\224\363PF\357\236\214 \241\230c\363d\310~\231\201\371"
+	.ascii	"k\201,\223\007\317\00742Wh\215\001\365\366\332\017\357E\003\354"
+	.ascii	"\327\335;\272\301\354=@\360\373\341\205\034^_\230;x\210)\331"
+	.ascii	"#\326\251\244e\376P\253Gok\325\026#\357?5\307\324\332&\226\235"
+	.ascii	"\264\027^\200\223S\320\212W\325\260\021\331\315\003\302\221I"
+	.ascii	"\275b\333\364$\311\215\233s\261<\221\207^\344b\375u7\355:\301"
+	.ascii	"\222\003\251^1Nmp\256*e?\361Yr|\345XD\360\203\374\276\312\213"
+	.ascii	"7\234\037\312cJ\"\t\\=\312/\376\246\n\223\261g\217\230\003\254"
+	.ascii	"`\367\003\344\263\223 \266\373\241-\360\331\001\020\242H\310"
+	.ascii	"\332\256\323\331\254\210\035\316\342j6\035\212]\311C> j*@\314"
+	.ascii	"L\334j\270\231\320\255\004\214s'l\272\031\212\\N7s\001\221\316"
+	.ascii	"%MsD\262Il\004\365\027I\375\302\353\260b\265e\371\251\204\t\365"
+	.ascii	"(\223u\252L\227\035\345\313\022\b\202y\312\024\036\206\213&\337"
+	.ascii	"jD\020?\b\213\362\367e\237\336\300T\231\243\216%O\005\352\207"
+	.ascii	"\217\272\231-\313|\001C\255:clq\257\265G\330\244\251VZ,\031!"
+	.ascii	"3<j\205\rE\250Q4\246\020c\246(F\002\022\031m\033p\002\221\271"
+	.ascii	":\017\020hh\322\244\335\"\264l\370g\020#jU0\025B-eW\201\221a"
+	.ascii	"\301\252#\017\2722\220\377\346\276\266!\006W.&4\363\311L\315"
+	.ascii	"&\325\247!\330\362\365v\372\245SHP:}\032\003\213H\033Q\037\353"
+	.ascii	"i\234\222\237\254\032\273(\270\036\201\377\3540+D\336\031$\377"
+	.ascii	"\2723\256Y\177\3737\351~\250\321\321\273\f.\213\221$Nd$P\275"
+	.ascii	"\375W\263X\312\203K\210\\@\347\017\352\177\356Q\034c|zj\370U"
+	.ascii	"\005"
+	.text
+	.section	.gnu.lto_stream_initAddress.44.eabcc68afd87291b,"e",@progbits
+	.string	"(\265/\375`'\006\275#"
+	.string	"\306?\342Hp\334Q:\375\245\273\320\372\017\345l\227\271~\2163\324\377\372Rh\007\273\306\225r\217u\3670O\f\325@\323\353\341z\bh;\306E\250C\202,\233v\323}\273Qvj\341\003\200-er\242\366\326\366\t!\204\354\235d\305"
+	.string	"\277"
+	.string	"\326"
+	.ascii	"\355c\\B,\346\234sG\273\233\272sG\361\311\336v\016\312\243\260"
+	.ascii	"/{z\266\302\022Z#d\346\214%a=\272\346\347#\377\204}\022j\215"
+	.ascii	"\302Z[\260\032\314\234\247\370\034m\237\365\350\202\363\267\373"
+	.ascii	"\305\033\331\037e\\@\316\\\\\246\344\214\374i\007\353\321F\236"
+	.ascii	"\227\036]O =\332l\267\232#\277\262\n6\343*\212\234\234\263\017"
+	.ascii	"{\235\375mUS\364\304\227\355G\375\326~U\277\225\245\343\351\t"
+	.ascii	"\201\270\005\307\316\360\352\344\201\t\202\306\352\242\f\266"
+	.ascii	"\262v\374<'\234\r\323vaj\220\344\206T\027\237\024\252\344\364"
+	.ascii	"\330\031V\235\272\266\2531o\177k\f\247\356U7\344\234\373\n\207"
+	.ascii	"Yo\334\273[\253\273\211\272S\006\001_\210\306c?\230f\321-\207"
+	.ascii	"\024\213\304\342\332\200{\334WS!\244v\021c\231\215I\325\277_"
+	.ascii	"\t\2569g"
+	.string	"\240\276\025\023D+\021\031\030\025k\307\216\317\207J\237<\276*\223\263&u\233\275\273\317o-\251\317\257|\313b\367%\354\006\272\270\027\366\333\007\261A\2621\255pT7r\352\342\256\356\343f\263\331l\314\325\275\336\356Yo\363\374\370\363\324\333;\352\355\335z[w\273\235So\343\324\333\267\365\366z\273\255\256\267S\3656\252\336>\325\333X\275}\323\333\177\260\242\213\rb\032\2476g\033M:\371\013J\005\354\311\277\254\237v5\246+\033\027\2310u\243e\020B\354q\263\237u\347\272\351\312\315\256\307a\275\024|\025X\256\030\203\221\213h<\372\334\336\241R\025_\3715v\b\002\266\310\335\260`<_\354\221\267l\222\257\021\211\340\272\3310V\214\347\206\311\306\274\302Q\255\3425\301u\227F\330\246\301\355\275\255\244\276w\263MX\343\275P\3057\272\371\302\306\254\302Q\027\202\345\3110\305\235C\232:\371\031\016"
+	.ascii	"\226\335\341\255\207\3352\3058N\032>\263%\326\206B%\177c&o\263"
+	.ascii	"\237\316\234\2674\274\354MR\306\230I\036\027e\325\211\342!2A"
+	.ascii	"\272\237n\020h\230\024\272\004'\306ZhlG\251\333\3542S\216?0\356"
+	.ascii	"\352\035c\003df\250n[\037\270W\236,\304z\345\275\004\341\345"
+	.ascii	"\210\267$\"|u\2278q/\304x\201\025\212oI\201\227\b.V\213\001\335"
+	.ascii	"\242\007\343\327\0244Zz\032\362\005\227\200C>&$\026?NLH\300\243"
+	.ascii	"\237\n@B@\026\234|FELGDH@\237R\220\311\327S**\372\235F1\200\301"
+	.ascii	"\363\305\317Hi)\2306Q\257\350\367T\344C\002\376^\370\206\200"
+	.ascii	"G\274N\202a\244\344[JJR\362\345\220R?3\346\352\rRx\352g\3169"
+	.ascii	"\337~fr\316\272si\364\340\235+;\334?\353\301?\323\341\335\360"
+	.ascii	"Z\261^\t\226:|\301\250$\300\241\322\034\276\362N\2617\n,s\\)"
+	.string	"V\313\301\216\267,\2173\357\033d\256N\200\034\276\361\215\221Kf\006\347\214\212\303\335\254\217\267\265\025\336\024\231\2636<\030\207\337\236G\254\212\2302\022\356\r\367\321X l\220\364B\036|\264\1770\323\022\266\342\033\346\211!\323\326\221\272\001r\250a$\005\r\223\210dF\002\021-H\232\016\240\002\021*#\017\021P1d\214L\222\224\226=\003\302G\250\274\216\253i2F\245C\266\351m\n\235\360\365\336P\371\024\367\253\230\032\341\261\376\204<\240{9\262#\020]IZb-\235k\373+5\231\331\213\306\021f\213\0335&\372G\201S\223\274\316\346Zl\341J\02500*z\337t\3036\0024\216\026\300\350kG}\r`u\263\212|~\251+S\340@Z\250'$\264\324\3720Z\377H~'ve!!.}/\347?\266\370\024g[\210\266\204\r\331\311\316\221\355\241\370\002E\321Z\212~C:\307\273"
+	.string	"\240\237\311"
+	.string	"\321J\241\265\236X;uL\312\247\227\240MI'v\3462\253k\004\216\243`\2665\331\315\313\377q\031\177\220f\300\201\206\220\330\210\230\327\311/"
+	.ascii	"e\021K\r"
+	.text
+	.section	.gnu.lto_stream_setSocketNonBlocking.45.eabcc68afd87291b,"e",@progbits
+	.string	"(\265/\375`\204\001\r\017"
+	.string	"6\235dD"
+	.string	"\257(\035@^\241\024\213\301Z\364\375\340\216\273\373\325&\375^\022'\215\313L\204w\365\306\217\271\267!\262\2741\300\252\207I\r\220<\200\352\227\256c\200qA\266!\235\033m\036?#\332o\204\220\275\245L)N"
+	.string	"O"
+	.string	"P"
+	.string	"\273\252\027\226\335\357\343\003\333\243\277kd\217\333\007d\217&\331/\377:\254\246\002\342\344j\261\273\234r8\351\021j\222|mC\203Jy\217(\207\233\024\3125@\312\004;\273{\327\323$U\312\3246v\327\211J]\270\263\333f`;\201\375\230\333[\267v\326\0373\255\231\316L\037"
+	.string	"'F\205L\313\t\005\024\273'\261\027\233\"\236Py\353\267\177\2279\266[\206\301}-`!\002fw=\217\346\354\374>\202\364\025\303`\306\2326\240Xv\367c\317\366\330\201O\373!\276\"\235Er\001\001\372\023\206R\306\356\317{\356\256\247\232b\3177%\020\343\311\264\2540\245\013o\371\371\325\226 \312\2434\355TP\317\366\204\277D0\\vW\201Ob4R\300\305\003I\366x5\260z\241a\305*\311\230\375y\251)\366\341\356\256U\265\311\264\346+\177\"\b\240\217\007q\024\322)\b\250#4\022ev\200\200\0034\302\301E\360"
+	.string	"\201p\r<>4\334\205t\204\270Q\327\2058\316\267\207\253*'\324h\367:\231\320\215\252\232\304\231\01730%Z\362\226\2520\335\261PB\344\030\251\032\030\273\230F\177\312P\312X\302\214\275a\231\246\233\037"
+	.ascii	"\242\310\b\032o\331\002\274Xh\032\341^\f\031 \017\354\21314\020"
+	.ascii	"Nd\212\201\333\300\220\240\204C\317\025\315\f\206\326X\240\261"
+	.ascii	"\266k\224\262q\260`\232Q\364\003\023\326\005\026\006B\244\251"
+	.ascii	")\301]\002\006|\252\334P\367\266\266\350\001"
+	.text
+	.section	.gnu.lto_stream_initSocket.47.eabcc68afd87291b,"e",@progbits
+	.string	"(\265/\375`\263\001E\020"
+	.string	"\366\336lF\360\260(\035\3760\214\271\007\342PH\265BxY\370w\236\343\244;B}k\216\177\373\3069\327ie\207\327~\2336\233\354\317b\315kZ\337V\207\301\303\344W\344\346\272\035;\273z.\273\211\306\377\222\277\311\2262\245V"
+	.string	"Y"
+	.string	"U"
+	.string	"6\320\235s\330\331\366A\334\366\33171t\241\201f,PH\330\230s\222\n\034D\236\213\027 \317m\313\277sq\365\363_\347~{\204\331Q\003\244\251<v*\337H\262b\007\007"
+	.ascii	"M\026Ej.\277]Sh1UP\311\234\323\n\3226\334\362\266\031\330&\261"
+	.ascii	"u@\357>\363\203.\363KUGU\253\252\3771\312\261CcF\316\272\b\347"
+	.ascii	"\354G\307\324\341Tx\360M"
+	.string	"\274\306\365\022\336\030\230\232m\3169r\331\243s\267?{d\323\304P0\203\203@\3652\276qhN\016\266\024s\316\021\207\\\355\207x\314\367\360Dj\b\201\263\026<s\206#\001\321CEk\247\"\350A\335\250;=\341.\213\277{\362+cZF\300\220)\016\177m\325Qx\335\2343\201\177\002\302\004\217\027\035N\3449\275\001{`\372c\251\335\202V\256]\301\202\036\374\376\366\320\213\317\274\301\203a_v\030\323e\261\037\347\256\330\017\177\321i\036&\236\311ky\254U\207Z\271Z\321;IU\t\305jQ\2206\0358\225\\'\222\204TIEz\2202\001\261\267B\261H-\317c\221F!\354\273\342\337\276\300F\006\212M\f\2717\305v\\\227\3006\306\005\320\006\016\b|\320\221\355\313\037*r\321\3725&\224\036\364k\036\312y\321\271\260>\265\f\"\002\" \200\002\031Y\325\003n\361\305o`\262m\373"
+	.ascii	"ua\032\271\002\270\341\"\330\024\3340\013\301\246\322\350\206"
+	.ascii	"d\177N\366V W\3611\036\320l\327\266W\320>\214\266\322\b\371\032"
+	.ascii	"\230Rt7\2620\333*$\020hy\023\222\022\360Scr\323\210\341@\001"
+	.text
+	.section	.gnu.lto_stream_handleReceivedData.49.eabcc68afd87291b,"e",@progbits
+	.string	"(\265/\375`@\026]o"
+	.ascii	"\272\267\254(M \222\322\031\016\024f\327\351\005\006%-\036\263"
+	.ascii	"a\214\343'\177>\367\016\302\030_\251\342\266'C\340\353\357#\200"
+	.ascii	"\273\336\033\020\221\326\275\033\227p\256\301D\344\0021\203\030"
+	.ascii	"\024T]`@\034f\242Mr9\242\307\210t\275\2474\023\262\245L2x\002"
+	.ascii	"D\002\201\002D!n\267K\\\023\262\3041a\2278w\272}\035\032"
+	.string	"\025\211\003-\017\307\036\r\216\273\355\300r\001\267V\346f\366rK\214S\221)\034\314\352\\A\253Ka\037\027\304\307\244p29\3205y\266\n\341Y\302\33590|\360\253\210\013\t\327\036f/f\211j\352\321\376\266ofQW\024\312\023\216\fp]\327\027\016f\233+\215LI\266\256+\361l\277\345mg.\321\313\277\250w\333!b\235[w\220\204y\361\255=\030\030>\330g,.$\344\362.\352\331V\370j\\\207waD\370\326\025\331b\370 \272\256BB\365Z\266\371\265k}\fuaE\244\216\266W{\341i-|5\"w\216{r\370\326\365L\200\341\013\373,K|p\367\312\261\274\360\3456\321u\355\201=8|\353\272F=\270Q\303\007\231P\035\342\356\236wO\3662\365f0\034h]\231\344}Y\3273\001\326i\370\340\236\235H\370\340\360B\302\007\325]6G>V,\003\302\200\034\321"
+	.ascii	"\327uU\3219\364\350<\237\317\247\322\331z\364\354;\264\035T\337"
+	.ascii	"t\302\004\323\222R\022R\t\022#\216\214\212\210\206\204\202\200"
+	.ascii	"D\374\3708\245=D\236\247\235\241\2160\2106\253{\2547\001q\264"
+	.ascii	"JRmi\267%L\310O\230\330r&t\211\311\r\201\237CjA\231\310\2349"
+	.ascii	"^\f\271\306K@\260\201\302JfOR\322Uv\244\022d?0\t+\037\201\006"
+	.ascii	"@$\206\034\343#\224\2042n\310\347\220V\320'g\0256B\013\360\001"
+	.ascii	"hdM\314!\313\320\2367\307\272\213!\243p\021R\230\\\033%]f'Bu"
+	.ascii	"|\004\201\3629\344\016(\2137|\314\263Q\362\020\016]O.\344\344"
+	.ascii	"A@:\f(\351\322\341\"\232\210!\301\370g\016\351\004ers\003\373"
+	.ascii	"<\271\023:@\334\220\262\263\271\2119\344\026\024h\311\232\345"
+	.ascii	"\231]8\235C\036i\022\341\036\034\272\214\234\210\272(\253\322"
+	.ascii	"\344s\310\"hcQ\023s1G\230\347<\214\374\211M\f\311\205w\316\374"
+	.ascii	"\260.\f\254\215\222..\037\232P\322\225\274\316\321\356&\304\220"
+	.ascii	"I\026~\016\311%\210\006\240\214\033\342\303\345\003%B\263$\217"
+	.ascii	"\310ed\024M\340\255\206 \237Cz\241\354DM\2333\317[\\=\270y\270"
+	.ascii	"\204\234u\030X\327uY\213\253\353\213\342\273\354fwK\330\025j"
+	.ascii	"\006r\252\0243j\017\252\017\227\373\216Z\330\231@>\037\215\265"
+	.ascii	"\302\336\332\3460\275V\337\212\016\266\260\273"
+	.string	"\214Q\231\305\3171\226!\330R\311\270\261O\t\211\274m\252\347n]W\026g\376\t\013\255\212\222\314\217\205\236qogx\202\t\350\275\235Z\246\002\301\327Z\264\261\376\003K\016:\b4\211\245\232\333m\003\334c\233\303E\240o\367&7'\237\262\354az\030B\330_K\3746\205h\023\223\364\321\3411\026\013\333\034\356\367\255\033m\213\210\022\357>\020\201\360Z\335HiB\340\002\371\262\032\353\247\362\203\221`\177mO\232\020\263^\3215z\253Fw\222,\177K5=\370\r\017\261\022\004\332_\033\365\025\335XY\334,\313\364\3407\313\275\242\317v\234S\202\243\276\300\363KFx0o\243`\250\365\336\265\340\002\276\0267\323\261\261v\027\203\303\321`\bl]W\251\375\033U\311A\322\335\023\030\204\017\276\317<\372%\311\026h\306\203\237\273gYo\201ue\255\373k\317\027\266\221\t\334f\262\233\362^\021yG"
+	.string	"\342\275A\344\2651\304[U#\345\245\221\362\316Hy\251R^\021R^\031)o\214\020R^\020\036\346;5\304\013c\210\367\203\277}_4\257\007B\274\035\b\361r \304\273\201\017\257\006B\274\031\370\360bP\201\004\020\034\357\353\"\345E\340Z\276+n\366\023"
+	.string	"\205\342\351z_\247\224\267)\345=\221\3622\245\274KD^% \336\244\224\027)\210\267\004\221\227\004\020\357\b \336\243\224\327\210\310[\004\304K\024\304;D\344\025\002\342\r\n\342\005\"\362\212"
+	.string	"\342\375Iy}R\336\224\310\333#\202\227\370\303\313\363\274\357N\312;Ly\205)o0\345E\177x\333\207\227S\336\253M^pdp\370\302\200\264\335\331\032\344\031g=\023dF\371\337\377\366\207\371\315\374t\277\337\217\367\347\375z\277\226\237\355w{\317\356\377\366\200C\254\002I'\340\336\336Y%LM\337\335\334\370\336\036\351\301\335Ps>\022\276\267#\324\340\300\354\327\\\357lT\246\235uUR\344K\036`\030\234\004C<\253#\375\302\202x`H\302nZ}T\33665\004\352\316S\303\374\351\236\026\321,\320\322\376\351\026\316\343\034\237ncK\333\247[8\213v\314e\233[\212\316\026\323]\322n1M\326\254\324\212N\226\303lz\344\222\244\345)\313\314\204(\340\024\347ib\357\335\024\327\024\365\204\215\0254\243\257\325\227\342T=\243\223\326\030\343d\001\005\271\364"
+	.string	"\375x\3603\311\317\016)\202\252\217\200\254i\241\246-\311O\177-U\213\320$\226rX\336\250\232\365\266\316T\3456\367O\366\213\b}7\177\n\313[\332q!b&c\217\313\254\310\212N)(b\337\312\276\245w\3056<\266\315a\321\rW):\357\004\273\020<}6G\251$\365\226v[z\377\300\030\271\342\343S\327\247\304\251\231\354\233\377\017#\027\224\236\250_\314#\360\362<z\341Iq\0312:9\203\0244n\350\234\244\375\265D<b\b\335:<E\375Eo\305\350\027}\034\226q\177Le\233(zP\261\220b4\212&f<\320u]\327\236\024\177\321!\364\233\017\222=\355\214\312,-G\230\204!\366\327\020\204\236\021\310b\333\034rXq\255\bg\377\244\005\341\203 t\320\206\347\230\031\214\366\240\247\372r\214S\216>h\030/\372\203\026\262\035\347\310a(-\f"
+	.string	"\366\266\305'\357\240b9\335=\350A_\3149\016\b\277\246[\203e\215Gj\216\214\016O\315D\200\017{\306r\033`'\303V \231f\314L\001>\2303\325$C\002|\250G"
+	.string	"\346\236gV\310\300\")7\326F\301\017\330\252[gZ\351dm\355i\325\300\203\231\250?|\356\326\325x-5\310\320x\001\224\312u\246*\244\205t[vZ5 \241A\365\022\356\2526\234\251z\251(r\346\352\255\324N\222\213|\231\333\\\2513\337T\226\334A\247s\272U\217\274n\233\f\026D\013\302\b\001l@\324O\307I\253\275\326r\rl\303\324\246y\235\232$\005\013\242_=!\235\272D\375\342\272[\020\206$\220\317\330X\333A\016,d\335\374\222qK\273-}9\320uU\262"
+	.ascii	"\037\026~.\007\235Aw\320\234\306\355\306\"{H\306\300\t\373\262"
+	.ascii	"\356.\360|\216\351\261\256<\2326h\016\372F1\rz\203F\331\232\\"
+	.ascii	"Nu\242A#51\303\2403hNc\344\273\231Uw\270\234\032e\210A\367\225"
+	.ascii	"<2e\231\031\024\253\370\317<[u\202U\t\313T\243J\005\253*\032"
+	.ascii	"UW>:\256\250t\344\b\332\3301\243U\320\301U\247\322AU\003\255"
+	.ascii	"r\301*\007zUuB\225\216\034V%"
+	.string	"\f\255n\002U\325\225\216\034\302\2451@\r\252\026j\2508\301\212\312\004\0253\254J Z\034(T]\251\320\201\003\307\225\n\342\031\0178g\200Gg\355\254H\276\215\275\215\f\234\246\025\330\334~\346\201\370\260\030 \226\306\313\211\246\356\365y\242\233\372"
+	.ascii	"=#\017r\266\031\247\350\354\264\277\023h\233+].\340\252\036\241"
+	.ascii	"m\364\236\257HWL\243&w\346F\333\350\021\232\331\214S\262n4Z\346"
+	.ascii	"8'PUZ\255]\206\360A\033-u\203\332\026\021\032]\325B\345\3638"
+	.ascii	"g\247\257\232F\237\357PW\342,\355\322x\310\212\001\256\211\211"
+	.ascii	"\376\372\333\346p\210\242s\351\216\b\214\007\2574\341\023&G\230"
+	.ascii	"\224\240z\247\267R\244\025\231\243\304\324WW\275"
+	.string	"\323\224\244\213\224\236)q\322\226\320$\024\355\223V\304\fQ\324\241z+\265\222$A7\036Q\324\237z\353\251\231\372T\374\266\231\302\215\022SP,\271\027h\206fL\017\\\224\372k\357\374\207\244\335\320\206\004A/Z\004\325(zk%\200A\367\343\311L\347\022,\311\017\2004}_H;\374\216\200W\2261>,\034\305\031W\242\277\226\332\205\275\245\206\221|\006\232=5\004\315\263$\310\020w\036\216\356\217\204\003SDwK`~I]\324J\315e\214S\262\222\232\323\034\347 \031\335\265s\200\0335R\023\263\202x\031\276\225%G\364\327\246\237\022\226\350\343MPbD\0275\t\365B\302\243\036\321h\031\243\322\250\217\032\325\373\b\262#Q\216\214\272\321\250\321-\315\0309\267\371\324FM\\\002\3713\362P\324N+\0370nj\365\021\265\213.\202j\242&f\001\331;\316\251S\177\020\305p\252B|x\226"
+	.string	"q\252^H\356tJq:\337\324F\355\211\262,\271\343O\312\377\007\310^\217\372\377\230\314\230\300\003\376\001\362\361?`\316\243oIg\025\277(\032\356\260\214\372ky>%\034\352\253\245\032\267\027S\303\241\376\026\221\240v\321B}\343\224\247\016j\236, j\3079\315\2571\037EoVKw`\212\316!\221\213\226J\356\215\231\021\365\327\352\340\tU\320\215\347\024u\247\336Z\321N}*\313\270\036\374\346\306*@\350\206\234\272\202\376Y\376\020cT\002\365\262[\214\251\316\002f%|\320E3\201\330\250\221$\305\030S\210fDD$I\2224\006\341\004\304()%\274\033\022"
+	.string	"\2069\210\035\233\031)H\222l\354\031b\003\202\263*j\017\007ar\335l\\\266U(m"
+	.string	"g\215\316kTZn\fM\231\b\f\034\234\006I\033:sV~v\214\307\"\002\320\214\244lQ\236K\262\272r-x\344\t\2627u\377\352\017\340\031a=AD\230P6\345;\271\005\fI\206\314\211r\252\303D5\240\266?\003\232\355\231@(\366\254\353\245\317\007\340\271\231\243Qa\213\335\001qD\225\274\300%\024A\233\334I+\3313wfxU\027f\242,\314(,\025\302u{Rb\016\362gG\027;\324?\311\016x\266\277\267\004\302\225\032\230\005\235%\214\334\361\275\372\236}"
+	.string	"\213$\372\342\237:\222K\026\331`\210\222P\353d*\023\256\331{\372\035\t\252\310+\017.\207;c5]\321F$\006S\244\030\236\020e/\t4\213Q\375C\200\241"
+	.ascii	"\260\360\240y\230;\222S|\270"
+	.string	"\201\351\n\375\312\370=\016\215\3007\231\243ig\177\277\035\371\t\027\232>\236D\337\003\244\320\236\341z\177\316\267\b\223\216\241\370\362i\023\251M0S\355mY\372\255\314\347\231\365W\260\b\207\277wh6\243\372\342z\006\t\331\356z\272q\263\317\320p\003\247\307\027\252Q[593\342D\004\326\351\374\353c\363\241\274\367\374\341)\337\377\371\305\025\316f\006\362%\252\245\353(\331\031\316\237\315\227\023\3564\317V\200\217\336\035.KN\r0\276M\225\027r-h\004\013\212^o\324\316\321'Ro6\232\232\204\215\302[F8\315\214)T\215\241\351\0174U\370\035.+\362\303e\353\255\232`X\355H\267\035\2167c\206L\362,\203F@Q\271$Fc\327\217M\206\0343\260\313~\371\037\377\337\r\355x\276\"O\n\021\221]\004ARu@A\215\232\366\276a\354\275\221\307\261\222QF\324\374\360-yQ3p"
+	.ascii	"#\324JI\220\325\220\365\257\376\302CM!*)\016X0\357\300\n\013"
+	.ascii	"\335\352%\300CW\313\263\321\004|\330\357\341\267\331d$>\004\301"
+	.ascii	"\325\376\317\353\221\227(\316\203\245\372\035\323\267\325\366"
+	.ascii	"\354\302.4\341\224\264H_\021\245\364D\205\345\315$\354\213s\017"
+	.ascii	"\361\341A\017'\250\352\232\246\216\006L!\355z\030|8\250\237t"
+	.ascii	"8\013 \005:\022\231\246?\342jd\372\340d;\002@Z\313\370\347M\334"
+	.ascii	"+7\277\234o\263nH\256xg\252T\031\265T}P[\2008\256\311\004\273"
+	.ascii	"R\031S\273\247\300(%\256\260\225\366*\177\322(\264\324\201Y\003"
+	.ascii	"h\262U\f\211.6\262\013\232\336^\342Y\243\006.\320\254\364\226"
+	.ascii	"\202\206\020\2605\270\0359\212\333\214\272\263\032\302\r\207"
+	.ascii	"Oc\205~1\365\024\346M\3604\244\237\273\330p_R\307\021_\243|\250"
+	.ascii	"&@?\t\375\233IZ\215\034\b\2244A\227i\201\f\341^\223^\2553I\341"
+	.ascii	"\350R%f\n3\231;M\337\316\317>G\336C\037sJ^z\035\323\223\340k"
+	.ascii	"\272x\332\223A\242\306\340\234Yi\326\367\222{\006F\221\206\336"
+	.ascii	"mh:\315n_\255y\375 \201To\300X\0269\022\002\025\200$O/&\340D"
+	.ascii	"`\212E\256\017\345d\273\275Y\027\315\337%\314\266\221s\230VJ"
+	.ascii	"\374\027\323UW\270v\256\203::\005\035\375\334\001\216\331U\251"
+	.ascii	"\231\002\f;A\360\031\273\313\215\355\007\372\211\020\237\321"
+	.ascii	"\361\217\325\036hx\307\013\321\n\202V\223\035\246\313\\\307Z"
+	.ascii	"\037&\310\210\323\343\007Ke\366_H\221\006"
+	.text
+	.section	.gnu.lto_stream_acceptPendingConnections.50.eabcc68afd87291b,"e",@progbits
+	.string	"(\265/\375`\222\005\005%"
+	.string	"zC\274\016E\200\236Qc\021\277f`\"Ol\002\201\243\264\221\027\023\016\374\257\331d!\264\233\021E\263\342\274.\206\275\346\016Lk\341\361\022\207m^d\017\306\374a\214I\224\315\236\327\373\270N\200i\266\252=o\275\367\2262\245\324"
+	.string	"\314"
+	.string	"\332"
+	.string	"\226mYzo\n8u\2747\250!\313\265\244\357J\002\272h\256\217\021\240\222\343m\3521t\276\264A\r'`r\331\210C\rp\t\206\263\312\267\322[Q\372\365q\237#\n\310\344x\357\rz\351\240\363%\215\264a\313^V\231\355W\373W\307J\237\265\364\001\367F\331\341ro\320\202#\234/\035\274\001\363\345y\002\346K\247v\234\003NW\227\001\370{\272\"v\357\025\262Ilk\372\263\307,I[S_\367\363Z'\245\370\212[a]T?\336\243"
+	.ascii	"(F\316\021\037P7\237d\275]-\311\rXR\224\330*X\300\034J\017\250"
+	.ascii	"J\222\r\242\212\214\315zN$m\f\330\323\207\257:zM\325\002\350"
+	.ascii	"\375x\355\361p\357u\345\365|\334>\267\355\263M\303.\223\0025"
+	.ascii	"\363\274j\005\354\242\204\031;2Y]u*s\255H+u%Sf\017\354x\243\233"
+	.ascii	"\223\246MS\265\343Y\365Q\323\177a\336\332E0\352y2K\333Y\235\355"
+	.ascii	"\243\203QZ0u\357\035\362\277\030\335$\260i\262d\276\274\375\360"
+	.ascii	"$\035\237q,\353F\315c\007\231N\336{\257\265R~\245p\306L\026\333"
+	.ascii	"(\033\350[\356\331\317\255\334\262g\375>\347\271n\322\254\266"
+	.ascii	"=\325\325\254\376\003\022H\346\251\270c\n\370\263a\301\313#\317"
+	.ascii	"\235\013Vzyr\257\337\312\317\365w\375[|/\367\362\277,\353\222"
+	.ascii	"\3168\321\266G\214\232\341w\261l\306\273\222\310\013\025\274"
+	.ascii	"\272\ra\262\\\211\335{*/\3328\321%\206w~W\367^\331\203\376\225"
+	.ascii	"c\271\360\303\035$\244N.L\237X3\315\0200< ATZ\300\013S-?\255"
+	.ascii	"2\3554\312\205i\225\220\325\205\206\343!\237\307\271\2056z\350"
+	.ascii	"\303C\350\021\243~XPI\344\275G:\034\253\324<\256\267\321\274"
+	.ascii	"\227\323)\377\262\261\226W\3048\250\031\3561f\320\357\3657\251"
+	.ascii	"\226\333\334\315\007\343\277@\004\230\342\031\216\351\025B\304"
+	.ascii	"\327K*#b\307\004u\004\211\006P\300\232\254\316\007j\205\317\254"
+	.ascii	"_,a\242\236\347\233\241\002s\262:\313\354\213>\272\032\245\037"
+	.ascii	"6~\361uI\326\325\017k\210\205\333(\216\306\306\263\305-@\n_\031"
+	.ascii	"1:\005\252\255bE=of\005\354\252\202V\316\220\252Ni\245l\333h"
+	.ascii	"\376X\004;\336P\361\313\324\260\221\306\257\211\357/\363\345"
+	.ascii	"\217\r\260\265F\030d@\265Y\004\316\305@m\266\032\r\351F\313\241"
+	.ascii	"44WCq6\332-G#B\215\212j.\036\030\351V\224\263\241HH7\033\215"
+	.ascii	"\b\315\305@m\266Z\0014w;Bq&z\034\016\265D.`\330n2\314\243\032"
+	.ascii	"\212\313\3110m\273@TS\"\022B*\252\035\t\265(22\340[\f\024'\224"
+	.ascii	"\273\335pB\262\340\215{\270a\2310\370\310X\335A\246\263\313~"
+	.ascii	"\371\031\261\352\031\376<vU\304rf\201\254\016\223%i\317\f\365"
+	.string	"\264'V]\352c0%\344\334\235\220\360\022\210HZ\304rM\271c\307]\202'\275)\246\225\262\021\320\311S\221\374\261D\300%OE\033t\322\352\360\230[\333b\253MS\265\203G\351\264\226\203/l,\253\236x!\210\323\007I*5!\3147\263v\232\344\302\245\r\2765cc\251\222\031\233{w\347\245L\316]m\250a$\344\030Q\312($22\243\005M:P\0021\212Y\361\021\360\311\251\332\f{\006E\027\225P\023v\224\222\t\271\0202\232\217\026\250\315MJ\256\322\320\007\246\304\031\322\364\247q?\274\036k}\021\"'\244aC\311\\y\321x%+H0\030\217\203\270\257\251\265\316\232\202\316\371\3042\251\177\232\224<\340\013\216\204\026T\022\013\364L\230\346\210*!\264_;8pK\332q}V\337a\200\3249Iw\244k\277\311\346St\215\035\020!\207\361\304\024\2136\1770\353\326p\343\3636"
+	.string	"\335\275\275\233\b+\bg\241O\002T\325PE\354c\020\n"
+	.string	"F\301\005\n\336\312\003(\225\345\247\236N\035x\030\200B\355\264\244.\260\024\313\364\247\352\300Ln\260\224F\006\371D\351;\330\314\177g;LVC\303\3162?"
+	.ascii	"W\301\201\005zs\225\006"
+	.text
+	.section	.gnu.lto_stream_flushWriteBuffer.51.eabcc68afd87291b,"e",@progbits
+	.string	"(\265/\375`+\nu8"
+	.string	"jat\025DP^R\007}\3030\374\264\321\\\200\264\005\273.O\031\034\340\006\3355v\223\006\261\370b\ta\204h\257,\350\330\216\232Co"
+	.string	"\b\b"
+	.ascii	"\240\253p\314\034\313\013s\\p\244\373p7\215Q\332\256%;\245\224"
+	.ascii	"\002D\001,\001O\0012\302\364\033\215^\343\177\306\205\321\340"
+	.ascii	"Nk6\3566&\242\265W\275\306\254Y\\\226\350\330\275\267\273p\253"
+	.ascii	"5\030\236\036\261\244\367\tD\022\235\273M\301+n4&\236\265\227"
+	.ascii	"\253\376bc\275]\322\333cx6\2077\246\347^.\245\376\261R\260\177"
+	.ascii	"}\203\232\210\271e&:s\2275\227\266\2457Z\350\336$n\304\334+e"
+	.ascii	"b\004\301\376\2614\310\314\334[z\254e\236z\310R>\037P\241k~\321"
+	.ascii	"s\357u:\266\021\260\177k\023\001\373\367K\272\355!\241  c\361"
+	.ascii	"\2078\024\006Y\340o}o\271\207\317d\017\t\035\341!\326A@\353\323"
+	.ascii	"\3323L\333q\205\255E+s\2464\365\313\215\353\321\216Kl=\232E\275"
+	.ascii	"H\244\177\210Gx\f\351\341j \311\327^\333qy\255G3u\315\236\302"
+	.ascii	"\005ua\253\365\207\345\327\235\363\371\243\203\007\216\360\350"
+	.ascii	"j\266\271\032\301\365\201)\\]\016l%\223\376\255\016\242g|\030"
+	.ascii	"\237\314\325H\r\2228\304g\226\257k\0025H\342\264\035\227\220"
+	.ascii	"\365(z\306G\253a\371\257\t\264\354\221k;.\"\353\021Z\026\223"
+	.ascii	"6k\327z.\335Y\r\367^v\347\223G3Q37\005f\036\301,\374\021\377"
+	.ascii	"{\3403\213\030\341\355d\377\330\374$3\223\350\273\022EaH\300"
+	.ascii	"/\022+S\232\3506R\027\3300\375\376\202\330\377\372Q\272f\237"
+	.ascii	"\216\213\302\344\355\037\214\225\372\377\350,\r\226\357a\346"
+	.ascii	"\023m\307S\2440F\321jR\364\317\370o%Do\257\314\237\356\007\257"
+	.ascii	"\235vn4O\201\375\376\356\326\354Z2T\237\341i\360\336\213\344"
+	.ascii	"6\363aE\320\311\r`\377\372\333\254\223\236oE\242deJ\2572K\227"
+	.ascii	"\376`\314\375\325j\265\312\237\204\271\350\214,:O(:K\030:G(:"
+	.ascii	"?\r\235!\b\235\233~\234\231\204\316KAg%\326\331\001\353\334\240"
+	.ascii	"\3014#\265\264\373\210u6b\235\213Xg\"\326y\210u\026b\235\201"
+	.ascii	"Xg#\353\\d\235\177X\347!\353,$:\007\207\316,\353\f\024:\377\202"
+	.ascii	"\316+\353\374\254\263\263\316\235!\251\t\2301>l\250\320\375\235"
+	.ascii	"\364\356\250\362\335\272\037\034\224f\353\226\353"
+	.string	"\006\323\317\334d\346\330\b\r\243\207\032\327\323\266\345\252\202\256\335\025\026\261\002\315\273X\021\202\375{i\205&\002\216i8\031\275\306\002\372\346\002\255X\204' V\006\341\237\336\3330\363\232\215\333&\335\326>AB\3707\2133\026%+c\340N\335n\335\326Jak\251\264V\332Z\230&\245n//\353\223\f\364\312\"\236\361\201\336\373\230\321e\213\305\257\361\221P\264\2758?\305\357\323\367\363\305\267\320\307\214\302gO\212Os\276\260\237\265\216\232\270\260(YY\222+}\323/=\367[\273\245%\3534\272:\346'\231\351\227\276\351\335\215Ye\311\364+\232f\037e\347\371 \305\355\204\347\272\345\002\354\337\322#\277\322\264\240\016^\351\201\321j\263\217\322\253\016\276\337z\201\031\337\331\035Z\224%\206/\272\"\304\007\273\303\323\240^\n\003aEaQ\250\227,z,m&\331\206H?|\025gn\354\360TA\035"
+	.string	"\303\006fo|\334\247\244\016\2160h\300\217\236\033n\003\007o'\257\237L\220')\3076\370\24337\r\307\035z\0167\370\206\353\2441w\362\242de\026\306\234`\300\007\353^\212\251\322\346G\024>\320\314\316\0327\r\007\006O\203\334\034\007\354\237\360\033\215\026t\2003\203\b\001lg\360\215L2\274\275\274\345'\231\212C\215\315\212\364\237|\303r\206\206}\244o\267f\237"
+	.ascii	"\256\324k\fe\005\305\342\030E5%u\244\232jq\274b\001\025Eu\254"
+	.ascii	"rq,\020\325Q5\\T\2553\254\\\n*\212\312\252\n\310+\232X@]\261"
+	.ascii	"p\202\341\002J\312I\205\213\027F<\025#\212\312\311jj\212\312"
+	.ascii	"\211(U\366z?\t\267Y\367\026\223\252Ch\251[\255\333\007\223\213"
+	.ascii	"\216\237R\033\275\0263\033=kP\376r\275\367\336!\347\203\302\346"
+	.ascii	"%t\301{\256\251-\216#\255v\213\301\0332uYn\244\335a\304\273\227"
+	.ascii	"\331\316\366\031dNX\320\366hj\373\343\303\200k\230\3209\201("
+	.ascii	"\005\221\022\322T)\207z\265_D\232\332~95sk\244\251,\207\221B"
+	.ascii	" s\213\244\251<e\344\023t\252\245\253\350\177,5\321\027\275\243"
+	.ascii	"i\372\200\362\036D\217\204\306\365\022\275([AUr=\006}\323Bf\003"
+	.ascii	"\007'\323\032\260>\271\204\006'\t\264\324C\257\242\203\357\030"
+	.ascii	"\372\246\366Z\006\r\243\245l\213\327\226Q\350\217|\213\247H\236"
+	.ascii	"\303(\364m\326\266\367ax\256x\025\221`\356\3441E=h\332\362n\315"
+	.ascii	"\216\215\365\336#\031\232\255;\257\213Wy\302?=2:\246\231^t\212"
+	.ascii	"\224\341#E\314e\316P\255\226\301\272W\231$\341'|3\247Dx\t\277"
+	.ascii	"\272-\351\266\200\314\250\201$\246\230s\210DDF\222$\3110\006"
+	.ascii	"`\"\031\203U\017\021p=R\216FS\220Ba\330\r)0\211\231\301V\261"
+	.ascii	"D\362\202(\312UF\355\324K\250\371Y\223\334\337i\223\276\262%"
+	.ascii	"\235\377p\305\246\n%H)~\302\250h0\021e\215\305\003V\213V\255"
+	.ascii	"_J6\200\211\2222\326+\005\006.\250\300M~\337\300N\227\374/lg"
+	.ascii	"\374\362@\013\354L\f\233D8\nu\235\366o(\341\216uA\257\001\273"
+	.ascii	"\246\274\240o\340\234\250\305&\b\356\347\371.8\315\263\274\\"
+	.ascii	"i\243.\226\017\362\304up\006\007\037\036\327\345\007\364\034"
+	.ascii	"ZI\334Q\027\330\317w\2351\264\300U\275\223:\262\371K%\266\237"
+	.ascii	"\203\300K\025\234\342Nd\365\377D\025\333or|\243\276[\32039i\310"
+	.ascii	"A\2278\234\321>\204Q\277<\263\234\234\332 \031\016\020G\343\340"
+	.ascii	"\n\221>\300\264]\210\270\031!\322\037\324z\r\231#\331o\244\265"
+	.ascii	"\342\357br%\006\024\035\001\033\361\344MB\363J\263Y\242^(\361"
+	.ascii	"t# 2\224U^\325\376iIx\374\207\204c\323\307q\327w\266\205gF\310"
+	.ascii	"\205\263Hm\226\026q)\224\227\315Heiz\316Y\305\242\375\030t\226"
+	.ascii	"X=\321\033\t\241\217\363n\207i\0026\366\027\231D\304\363\321"
+	.ascii	"\313p\030%\002\016)K\206\033\311\364\335b\311\3541^\253\b(\233"
+	.ascii	"\307\370j\2273\254\310\360\234\211\345M\020\320c\237,\305H\001"
+	.ascii	"\207\214\306\200/\227k.\365\326\fF\270\262@V\021\277\371\236"
+	.ascii	"`\211\233\0068\255\310L\372\034\214\274\343~RV\251\001"
+	.text
+	.section	.gnu.lto_dyad_update.52.eabcc68afd87291b,"e",@progbits
+	.string	"(\265/\375`\221\027\215d"
+	.ascii	"\032\2354#O0\016\323\351@\247\334O\363\342\304\310\314\027\363"
+	.ascii	"\306\260/\037\252\266\316\232\333U\266j\225Mz0F\2610WYmr\307"
+	.ascii	"\032\"\317x\203\240`l\027\023\3428\347;Qg\027'\334\177\331D|"
+	.ascii	"z*\005\0061\367U'4\272!\321\356\226RJ\001 \002\361\001,\002\315"
+	.ascii	"-\246\361\270\363\356V\017\272\216?\215]\237\007\334w<\364 \205"
+	.ascii	"\227\265\206\241\355\270\235<\344\002B\327q\220\210][\341n\266"
+	.ascii	"\\\323\361p\216\343Fx\003\245\314\363\336\244\003\266S/\375e"
+	.ascii	"m0;\372^\335\006\342\004\212\231\347\275o\n\330N\211\300\030"
+	.ascii	":n\355.=\216\30343=\346\337\225Ja;}\264b\373\250 ps\341!\b^\364"
+	.ascii	"\336\362\260\334\206\366\274h\261\373\332b\262)iU\371\273\322"
+	.ascii	"k\314C\016\241\255\360\303\341\351m1;e\016\201y\330iN\227\365"
+	.ascii	"\224V\343!\225N[\273\212\217\236{w\333\212\353\211\333\363^\264"
+	.ascii	"\003\320l\233\365\331\332h?\200\027\013\355\232 L\013\373c"
+	.string	"\376\335\233$\321)\237\260\235\366m \265\323\236\366Q;\345&\353f\362\031{\357\321\232\2239@\247<\302v\312+\363\231F[^\017O\332\250\324\376\356\275I_\204\217x\370k\2178\022aD,\"\n\001bH\350\203\207\016A@?>\0346\364h\340\331\321\031\n\2036GM\201\357+w\026\271*\253c\217\320\262\202\037\3450\320\302U\226\026\301\326FlbI,Nd[\363\"\24233\017Q\266\006b\210\350\265\346dB\305\222R\\(\n\333\007\017R\272\003\260\350\213\005h\337%\307\200D9'U\323)\361 \262$\016\204D\013\231\377\234\265\317\331\021\347\340\202[\033m \212%\317\274\247\357\222F\226\256\001H\300\326\334\t}\227d\001\b\024\306\313L\277\265\221X\322\210\3630\267\302\214\234\245;/\345\311$\353\272\312\322:\300\234)!I\372.\251\005,\266yr\211\362a\013W\312\026\226\020D"
+	.string	"\210\005>\201\303$\307\250\353*\253U \361.\231\005$\336{\207VHO\201\004<\341\330\360XM\001\201\204$\251j\265v\022\254\220\016TA\252\273\222XB+*UG\206&Yl\324\225\314J\277\325\372\001\257$kLh\327\225\262=\207\201{/{\225\325U3"
+	.ascii	"\315\374:\314\374\203\371\347MZJ,\373'\262\242\320\277.\226\201"
+	.ascii	"cs\036\t\205!Wz9\177\"+\016\233.\226\361\313)r\365\221\222BJ"
+	.ascii	"X\261\243\247B}\245\2547\234\242\355LLM\177h\325\204\222FF\312"
+	.ascii	"\333\220y\025\307\215X\362*\305\201\254e\235\002\351\245\337"
+	.ascii	"\311,\277VA5\206H\372`L\242\201\257#m\214\224\267a\244\376\007"
+	.ascii	"\376\357QaEy\364\314\251\376ad\261\201\026\271?\211n+>\345R\r"
+	.ascii	"8@D2\004~\\\241\243\227b\351\177\"\213M\273i\016\2728\217\016"
+	.ascii	"\207\345\254\234D\001\037\214\343pG\201P\252\336p\001e\226\334"
+	.ascii	"\013\345n\343\315qj\247\315u\237\304Y\342\307%\216\376s\265\236"
+	.ascii	"\270y^\256;\300\032\356-\273\274\311\213v\007\030r!=\0163K\320"
+	.ascii	"j8\316\336{\225\270\371\326(\023\3300\037j\247\375.\262\326\220"
+	.ascii	"\231Ay\364\2574\245\356?\030\243\351\247\017\3560nA\001\005j"
+	.ascii	"\247&\036EV\037\031\026\224G9\310\333J\3571\331{\241\312\264"
+	.ascii	"\231\n\270\303:\345\027L\336ULj\f\031L\247\324\214\027\2328p"
+	.ascii	"\342\344qf\247\r\274\253\270\255\310%\241\317\250?2\243E\371"
+	.ascii	"\2031wq\331\306\215\377\213\331:7Y\347\f\254\363\214\2403"
+	.string	"\006Ag\031A\347\013\204\3161\202\3160\204\316L\326\331\002\353\374\302E\013\353\314\302:/Y\347\242uVBa\342\250\2534\213\260\316F\326\231h\235\213\2543\221u\036\262\316B\326\371\203u\366`\235;X\347 \353\fd\235\177\206\316>Cg\016C\347\rB\347\236\240\263\206\2403O\320yG\350\254\023t\036Zg\241u\016Zgk\235s\254\263j\235S\353\f\264\316o\235\335:\267\215\243,^\230P\347\223\266\237\001\355\n\211\276\271\316\224\213\222\266\353\306\353\356\322\r\246{\256\033\255\273J\3470\007q\300{\273\026\350\271&2\362\244\342QV\373\260\334\357j\341\225\236\231\016C/B\032\231\271\036\3724\214\035s\253\fK\205w]\313\255T7\352\232\216cx3[a\035\247\221Z\b\310J\302P\0207s\300\336\2416\230\206\241d3F\202\256\201f\3125\177}P\036\r\262@\350\221\3160\355i\261"
+	.string	"\350\305\013i!3\346\305\267\226\031\204~I\331\307\326E4p\316\237\004\204\254Vd"
+	.ascii	"T\271\273\362)~x$<3b\334\212\234\306NM\020\016,\376\203\233\323"
+	.ascii	"\216\305\267\033\235\336\207_R\356A\327\272;,,\nr\203\207\027"
+	.ascii	"A\316\303\303P\312@\246\344GC\326\024\334\013\232\024\234R\177"
+	.ascii	"\36413\267\246g\351[\255-_\032\031\003\274\203\027\246\207\253"
+	.ascii	"[n1\275\371\266*\327\025\274\253\226^\375\243\tC\232\032\224"
+	.ascii	"\276\303\013\245\325\365[\f0(}\277\265c}9\331*\203[\301\243\247"
+	.ascii	"@\207_R\346\221\231\271\226V\241\311\277'\027\317\203\261o\341"
+	.ascii	"\216N=\2265\346X\033\027\200eI\026\3566z\216\205K\360\031\036"
+	.ascii	"\345\336X\225_\tr\265\261\240w\241\264\203N]\355x\032\212G\241"
+	.ascii	"\254\203\232\230\262\022\251\332\360\034\336\347\201\274V0\340"
+	.ascii	"\305\372##\365\317\003}\b\344V\224G\213\370\331\nk\366\363"
+	.string	" \214\230!9SJ\363/\212O\t\037\2032\366\002\207\017\266q'6Tes\354\336[d^\215x\223\365H\016\345\334\237\330\206W\225M2.=Hz\312\252D\303\367|\257\201\353\276+\026@\352^\250#\236\327\360j\033Rl\347\207\317\363\215\\\022\265\363>QQ\266 \237:\317\2742\351)k\023\327\253\342\033\276\3167\262\316\303\034\t\303\255O\370\315\273\212\337\324N\207\377pt\\[eu:\017\306<\3104g\204.^\245C\272\211\027\361$t\232\026\361O\244Y$\032\215S7\204\342.\370\260AK\027_T^\351\353v8I\241\360I,\213|-\205\177B\251\006\247\213g\206\004\203\337\320.\"[*\202?TE\005\033D\036O8\2105n\364x\242\001\202u8}\240\303i\007\361\211\007\261\206\323\317\215\246\017p8\335\340\221\343Iu\352\016\232\234t\360\330\241~\300\303k8\335\260\321\364"
+	.string	"\017\032N8p<\321\330a\032\005\324h\n\241F\022\016\033M\035$i`\343\006\020?\345p\322\221\304\343\351IG\322\020\r\252\377\313\362\3719\241>\212\177\240=G<\030\347 #\243\332\"\242\305\253~]tP\374\321\321\013\005A3E\215\0302\300\243_\342#h\331\342\213Zs_\"\212|tN\251?r\226\024\334\00412\372\3401OI\032\231Gb\364KZ]\310\314ZL\031*pD\342\3771\357\b\264\213\236\370\376G\212~I+\016\352V\272\212\214W\370\240\0205\021\375\222\351\213\2545\205\310\340\211\326x-\362_\357\225\301\367\332\023Y\022\375\222V\033\231[\027\371\232\200\210\341$X0f\031\261l\263\310\246"
+	.string	":\335b\204\343S:\233\331\226O\005\24387/\f\315"
+	.ascii	"\200\t\236\227\320k1=\023\274W\262\315HB\202\235 \324l\335b^"
+	.ascii	"D\324\210\251\343+_"
+	.ascii	"\315#\037\272\347\\4\215k\2541\316\330\214:\247\336\004\343\027"
+	.ascii	" \275{\221]e\224\263H\026\001\030\351\272i\264\343\021z\235\371"
+	.ascii	"U\241\020&\215\230n\032\323"
+	.string	"|\ty\334\3061*\263q\206n\032\307$\225\351&\357\261R\020\013\212\233\034\307JM\327GeX=\236T\342t\343\261q\257\3638\316\227\251\332\027\255\b\034E\263\234J\242\033\357\247\214i\270\253\370\243^\312\250\206e\350<\343\232\235%\357\251xF?#\324\363z\002&\\\320'\362\217F7~\030<\263\021\216G\031\256\351:M*\341D\315\300\306\367C\306\303x\f\266\242\220J4\\`\3340y\273\314\013D\243`.x\031\337H\261\030\177\301\003\333\234\253\222\030\017\302\b\323\303x\317C>\355\234k\023\246\377)f\230[ef\fxRw\230v\332\255\3075\312\331\301+L\234\320\347\324\037\271D\373q\234\375\321\241|\363\327\027\374\322\007\304C\217.\035\334\001\246\203O*\001\201\363\250q0\347\024ShFDD\222$\2054\006\201\005\204 \306\230\253\365\021\360,s\214!\022!)I\2621\007@"
+	.string	"\020U\271\300A\n\201\022\210\024\307J\355\334\306\373\001\006"
+	.ascii	"\034\37457H\303.\323YCF\r\276"
+	.string	"7\250I\f\340\004\216&\267\353\301\260\333Y\333\301\037\310\212;%-\"\336\203\304\364\370u\206\311p\"\213u\340\356\032\245\031\362\215\rp\256\t\225\013\022\310\n\207\344]\024\337\247L^\327\2646\316\321\304\310\225\0241\311j\374\375d\353ui0v)F\034\360\260\372\001\276\304\224\261\232\026\2013\005Dl=\2413\244i)\210\355\235\303\212\005\343\003\2222-\333\250|\027\263 \212\272\357O\032\351$\374t\316\322\256\352\326X\357\241$\255\271\276g\023\025\260\004\314\270\374\262%3\3175\201]\005\241v\336\356<3Y\2175.\317\361Z\211<\225\224\001\212O8\0375P\274M\313Oj\364C\336\301\315\345\236\351\310j\026mI\335\270h5q\026'k&\232\004\212n\363}%\234\366w^;h/\021\002\273\267t\356\212,\032\323\325\202\013\217\366W\021:\023\331'\242\360\311\254\003\254&\330\321\031\227\005\253"
+	.string	"C\3200\fo\021Wa\244\031(\306T\276@u\245\203\004\005\247\215\204d\202\377\272B\337ae-\023\262\254b\221EJ6u\237\375\263tb\351T\314P\240\343F\333\033\346\356%JXP\223\305\221\212\224<\255\251\353\n\311\021o\342\340Z\370\f"
+	.ascii	"'b\317\313\016\261\n%6S1\305E\233\260\016\225\373\360\201\206"
+	.ascii	"\245s\324\200\340\265\303O}6\253\033\\.\204%5 \265\245\240\234"
+	.ascii	"\177\262\267\315\035\252+\332\307!!U\363\036\005\303\331\024"
+	.ascii	"\2177\t\263\0137\316Lt\3201\304J\274j\225\346\261\206\311\310"
+	.ascii	"\233\003\207:}:\242R\260<\241\216\304\344\2347?\017x\025*l\317"
+	.ascii	"Z)\372t\221*W\004\314\016w\026\004h\376u\b\244\376\247\220\357"
+	.ascii	"\206\306\r\206\213\346\032\336_\202t\207\247\353,\361\330h!n"
+	.ascii	"j\355_4\311\bd]\\\301\2228\235h\263\272Z\b$e\234\227g\213\245"
+	.ascii	"\245*\234\0072\247[Hf\226t\336\202\207ji\rmB\245b\335H8<\225"
+	.ascii	"\n\244U~\351D;\335\2446\241\264\225\031\234\202\274\201\346\233"
+	.ascii	"\237f\352\177\272\005\271 \346\376.\355\3144d\330\207\037\331"
+	.ascii	"\006\226W5\026\356\007\3670s\331\330%\306\366\361\242&\356>\267"
+	.ascii	"\234\371\340<G]I\rW3\324\254\304Y\020ju\320@\034\323*;%\356\b"
+	.ascii	"*$\351\303\245U\032\006A\356h\271-\020K\2659\016\315&\003{Z/"
+	.ascii	"\266\344\004\375\237O-o+\273\364\235ZC\313et\366\264\314\236"
+	.ascii	"\250(\325=\017\177+\355D\3012\200\005\034\360\225\007\307\345"
+	.ascii	"\204\265\277i\311\340\2741j\017z\346?\3039l\246'\271LAf&\002"
+	.ascii	"_X\205\233\n\030l\340\n\n\261\240!$\307\036a\333\301\304d\360"
+	.ascii	"\312\267\3732\025\371\255\363\300\001\030A\373\254\254\251\210"
+	.ascii	"t\3627\025\017\027W\224d\241\n\250\3437D\364\330\001\037\217"
+	.ascii	"\326o7\376\376N\013\224\330\002\031\032\020\252\217n1\3649h,"
+	.ascii	"\265o\242\323\201QC\22207\204\313S\310\220M\020\366C \311\251"
+	.ascii	"G\253 H!R\007F\232\335\r\332\222\235P\006\310BA\223*\226=G\347"
+	.ascii	"\256\347\002\256G\027\013\\a@\215\024\344\2128w\030\031\312h"
+	.ascii	"\322?\337\rt\2731\360\211\320\212\034\352^\362\340\226_\372\264"
+	.ascii	"H\b\310\263\210D\031N\202\031\336\037"
+	.text
+	.section	.gnu.lto_dyad_init.53.eabcc68afd87291b,"e",@progbits
+	.string	"(\265/\375 \335-\006"
+	.string	"\264\n\213"
+	.string	""
+	.string	""
+	.string	"#\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\212\t\001\273\001\001"
+	.string	"\177\002\001\177\001\247\003/\200\200\200\370\305\207\276\271\030\200\250\300\001\356"
+	.string	""
+	.string	"\177"
+	.string	"\013\001"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\365\362\001\274\310\315#\003"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\201\300"
+	.string	""
+	.string	"\201\003\205\360\371\360\231\307\001"
+	.string	"\212\001\002}{"
+	.string	""
+	.string	"\006\325"
+	.string	"\001\r\006y\001\001\002\004"
+	.string	"\203\003\202\360\371\220\233G\244\003\001\200\300\013/root/repo"
+	.string	"\025lib/main/dyad/dyad.c"
+	.string	"\t"
+	.ascii	"3\003\326:#d\270\3055\321-\004\3742\004\270tc\266\266\353\264"
+	.text
+	.section	.gnu.lto_dyad_shutdown.54.eabcc68afd87291b,"e",@progbits
+	.string	"(\265/\375`X\003\255\027"
+	.string	"f\252\225I\260\226Uct/R\212\"\343\033\036X\037\272\306\307\211\374\330\215@\234]\305\231\t\367\247\245\004(\225?\304\b,\231\024\344\021\004:p\200\237\364\336(\3067n\210\241nLj,\277w\242\356\016\301\200\364\267{\357\275\245L)\202"
+	.string	"{"
+	.string	"\200"
+	.string	"v\335\254.\3333\233\311\205\275[`\211\n\350)\312\275\027f]\330\227\302;\365igg\245h\3534K[g~\271\313qu\303\371\234U\252\024\031BQ> \002\325\024\211\310\350\350iFo\225\350\217P\322\213\f\245(_\222\310\251\377j\365l\315(\272y\342e\271@Ge\""
+	.ascii	"\316V\256T\355\226\334\370\032\204\373\251\366\277S\330IA\271"
+	.ascii	"\341\212^Q\t\367^\327\033\216\350v\335v\017\333\nl\213!\272 "
+	.ascii	"\023\255^\331\342\217\037\234\265<[X\253/\275$\322\366\310f\235"
+	.ascii	"\325\351\2077jV\237eu-\253\257\"\300\252\251\330\342RV\367\n"
+	.ascii	"]M\271D\314)\245\017\177\373~\324\215;\007\372F\246\350r;v\360"
+	.ascii	"P=\177\362\005\342k|\350\023\235f<\007\032\202\225O\007"
+	.string	"\274\367\362\370N>\323\233x.\364\261\274Q\267LR\212\002|\335t\202\364f\313W\316\233\345\007\2347\355\036\007\307\373\340\320!V\177\213\2357S{\342k\214\334\221.8\365^\022\271\003\265<\277e\343\325NHb\253\311\036\325F\3105Y*\357\275\367\274\265cZl\326\307\276\216\357\320\361}\236\241\251\277\321\2347o\377{\345a\305B\02742]\265Z\337\370\301\246\376\346\322\372T\337\220%/J\313\363\353\24750Db\253I\337h\331q\370\230\336{]\374\033$D\370>\235\363\346io<\002\036O\220\0015w\214\003\231\330\216\f,DM\314\006\346\241\006\304\212e738\260\0212\031\016\314%\244\375\367\264\250\002)\005I\2635\277\376\241-\274\312\307J\344@N\006\313\362\314\272\241,ka\264^GmP\203\243\366H\303W\355\224\bS\006G-\313~\210F\261\204\256V\257\354\347\234Br"
+	.ascii	"P\301\330 +r=\035\320\tKM\255\017\225A\303\241^a\351JA~h\337"
+	.ascii	"\034H\016\313\221{\357\313\207\336\360\0370\004z\367^\227H\250"
+	.ascii	"\221(\342\220R\210\024\221\tkJ\323b\220\002!\252\262\003\021"
+	.ascii	"\240\311\232\"JZ;\302\323\230\325\213A4\357\244\376D\324\215"
+	.ascii	"\022\270\036\350\323\317\274\024\f=\371\023\355\253q\020i\251"
+	.ascii	"\262\221\001\361\n<B\020\373H-T\277\220\003f\357v\037\361\227"
+	.ascii	"\340\262\224F\226\266\305c\213\033\311\030\035\220\330?\022q"
+	.ascii	"p\001\357\215\305V\303cNiJ(f\263d7\362\313\317\343\345\375\276"
+	.ascii	"o\r\331\300\250\357\3502R\313\323\r}8h\210\020\023\375\261\226"
+	.ascii	"\231\2334\b\342\375\322\354\365&f\375\001"
+	.text
+	.section	.gnu.lto_dyad_getVersion.55.eabcc68afd87291b,"e",@progbits
+	.string	"(\265/\375 \344e\006"
+	.string	"R\313+2PM\324\001\250\235\031D_\021\300De\216\251Z\004"
+	.string	"W\243\210E\245\326\312\240\033\315`\357`\302\240*\302H\003\2438\250\310Sa\334\231\277\333\356\235R>\210\020\"\203\306\r\321$]\023\215\240$\b\312@=@\256$\034,:QU\026}\352^\344rv\271{\024\016'@\360\031\260\311\n\273jQr\330gVn\330\221\001\303\253\234\354b\264\204\2332M<lc\366\343\177\034\004s&;\213M#\001d\271 Y\331\255\324\365P\363\351\034\240\371\224\035\317\0363\377!_\030)A\361>\355\361\242\260\273\216\336\227q\313\333\036\260]`\273\013\n"
+	.ascii	"\242\310\220\031\032\030\241\032`\021Bs\r\207\215\030[\210\\"
+	.ascii	"\334\025S;\311"
+	.text
+	.section	.gnu.lto_dyad_getTime.56.eabcc68afd87291b,"e",@progbits
+	.string	"(\265/\375`\306"
+	.string	"\255\013"
+	.string	"\246VP> Q\224\016pE\\3a\035\026\020S\251\323\n\200 V\023\330\213\370\240>^\353?\017\001\177;Z\213\235\374\233T1\273\\\327\001\b\026a\344*\234\026\314\305\250\177\023_\305o7\2212\245="
+	.string	";"
+	.string	"@"
+	.string	"\313\301\300\241\t\\\207_\212\217zJ\263W\212A$ZYR\304\013,t\354.\346\356\225\310\341\365"
+	.string	"\221C%q\355\251\371\367\256`\223\0219\022\350)I\260\273N\216\324\341\326\273\200}N\251#\354[\253&[\323\227\246\241\246\255L\253\2463\323\007p\r5B\344\260q\372\213\270\273!\366\330\020\030\343\304\273\337\276m\315\367<Q}\205\366\356C\331\031{\017%P\031\276\r\003,\205\372\021\212-\243U-\265\\h\3569P\025`BuMM\032\243\317\336\334\313\256\335EpU\357F\252\244B\025\312hIb\377\307\275\b\027gK\240\220\347\374\026\247\220\035\237HAv\007\n\023<i\006\0072\230\n\031\214\243\301l\260\005\232\007\025g\020\032t0O\226u\260I\267\267VM\227ZB\272\371c\355\212\270\274\373\277\217\214\206\232z\225\266\325G\037p\200"
+	.string	"\341q\202\261\366%F\020\013\273\241\023"
+	.string	"\242\310\220\211\027\372h#l\340(D{T\201"
+	.ascii	"\312C\235~1\256\035{\250\3176\327p\3203\3418\325dp\322T\003\306"
+	.ascii	"I\221\346\305\017\016\016"
+	.text
+	.section	.gnu.lto_dyad_getStreamCount.57.eabcc68afd87291b,"e",@progbits
+	.string	"(\265/\375 \363\245\006"
+	.string	"\322\214.4Pm\222\016$!\243X"
+	.string	"\030\027\313\253%{\027\271\306?\026\027j\313\374\216\2657T\365\311\036\037DG\246\252\352\242\252\212"
+	.string	"\247i.\352\200\243\265F\266L\001+\030T\224\246z\025\245\251\236\003\206jx\t\030\006\313\326\303B\346AXV\346U\266\254\363\240\273p\234\304\367\243\333\240\273q\304\037,V\351\376\231*\241\013\260\340`\350\267\r:\214o\224\316\363\305\321EZ\247%)\231\024!\224$\221D8\376\353+Wk\307\365\240h\323\310\006\264\213\211\220\223\314|\227Z\246JQ\005\246J.\243W\361\272\365(\002\310\210\t\226m\212"
+	.string	"\007\2319bYEw\375\013~\202\277\023\b"
+	.ascii	"2\003\346:\203j\b\3055\2217\"k!2qWL\355$\003"
+	.text
+	.section	.gnu.lto_dyad_setTickInterval.58.eabcc68afd87291b,"e",@progbits
+	.string	"(\265/\375`\033"
+	.string	"\215\007"
+	.string	"\002O56Po\322\001 \316\221\326t\232$\336\327\210L\307\273f"
+	.string	"\0028'PF\321\254hv\300\326L<n\222\322\364\243\310\214\253\252\"P^\003\033\347>\244\221M\266L)!\355\263q:!L9\b\332\006B\313>\236MC\266\340a\320ts\350\200\262\207m\003e\031\357\266\016K\305ZPT#(\321\2045\312#M\325\035\215\350\227\356\034\353~\227\243\302\305\311\207\305(W\255'J\210\321\332\372\377\302R\353\223\235\226e\342\360\212\312O\261z\271*\232xd\332:[\2038\204\363\251)\007\374)%\337\377\203\026`\216\365\254\271\0341\013\\\216\345Z\026{\032\0370mL\220\270\374\317`\2069'W[\304"
+	.string	"\035I\344\304$\374ov\244\n\027\272-A[\203\266\250\t"
+	.ascii	"\242\310\220\211W|\321\002\027\266\301\220K\260\326j\n\270\313"
+	.ascii	"\213v\222\001"
+	.text
+	.section	.gnu.lto_dyad_setUpdateTimeout.59.eabcc68afd87291b,"e",@progbits
+	.string	"(\265/\375`\033"
+	.string	"\215\007"
+	.string	"\002O56@\217\322\001x\221\373;\200\352\217A\227\25667\223^\221 \020"
+	.string	"W\227\373U\277-\026\321\035x\307\357\351Q\271\f\004\363\225i\325\027\360\345\002J\032\331d\313\224\002 \315\263m8\240K7\b\232\006B\313<\035MC\266\320a\310ts\340|\262\207m\373d\030\357\266\016I\305TRR\"(\321\204\365\311\"E\325\033\215\350\227\356\034\353~\227\243\302\205\t\213\205(W\255\027J\210\321\332\372\377BRk\223\235\226U\362\260J\365S\254Z\236\212%\035\230\266\316\326\037\006\341l*\312\001\377\t\311\367\377\240\005\230c=g.G\314\002\227c\271\026\305\236\306\007J\034\023#+\3773\230a\316\311\325\0161@7\n9/\t\377\233\335\250\302\205nK\320\326\240\355)\t"
+	.ascii	"\242\310\220\211W|\321\002\027\266\301\220K\260\326j\n\270\313"
+	.ascii	"\213v\222\001"
+	.text
+	.section	.gnu.lto_dyad_atPanic.60.eabcc68afd87291b,"e",@progbits
+	.string	"(\265/\375`i"
+	.string	"e\t"
+	.string	"\246\321@9 \261\322\001\214\017\004't\340\3214-\340\20587\211"
+	.string	"!\3779il\262/\312~C\366\257\360\360`\3646\232iP\220\n\002\202 \314\360\"@?)(\260\356&wJ\001/"
+	.string	"."
+	.string	"/"
+	.string	"\037\n\337\207q\"\263;;\317\2038\217\235\013p\0365\344\362P\372\237\235\201f\213i\271V\207"
+	.string	"\013\273k\330rm\334z\333\004\266\017\354{\002#\237\277\255\362g\366\330\2362`Y\366.\222/\366\262;\r\036]"
+	.string	"/\223\377\354\302Zj\273\023\301\003\235G\333\376\367\230\312R3.X\001\276\210Q)\370\326\243\237\342<Bux\335J8X0g\317\025T\020\373\233U\230}\331\257\2377\214\037\227\\\212\307m+\273\0329\232\305E\225\243\222\247\"SE\304\306\242\204Q\b5\352L\244\220D\367@*\201\354M@\234:\n\317;u\236\271\337\254\302\240\276\006S\203c\251\205UQ\032^\267\231\216\323n\"\003\016"
+	.ascii	"\242\310\220\211\367@\321Z^<\bXO~,\252\021\027\306\363\314\b"
+	.ascii	"\307X\351(r\205\3122\374Lcj'\031"
+	.text
+	.section	.gnu.lto_dyad_newStream.61.eabcc68afd87291b,"e",@progbits
+	.string	"(\265/\375`\221\002\235\024"
+	.string	"\206\246\207J\300\020)\035\360\2672L\3024\306\213\356\242,3\220\371\006\261\373\211A\321_\001g,\230\264)E'\342A\233\234ju\332\2678\354f\373\237\\\243\262\320\364\236\241\371O\276\317\214u}\354h\356h\030\237\203\240\346\t!r\247\024o"
+	.string	"k"
+	.string	"y"
+	.string	"\225\346\023\331\365Q\350C\264\377j\304\252S\326\022"
+	.ascii	"~MS\275\254ZG\250\264>\276\276n\333\370Av\335W{\325\250"
+	.string	"\372\234\035\036\214\263\326R\345\243\003\264>\372\274\367l\\\333\02086\236\003<$\020EY\265\2260\227?!?\266nB~\334\024\257\235\326\374\007=\301\017\312\314\345\334\234z \250\265\232\346rH\334{\333\002l\023\260\267@\266\f\006\372\234o\362\252\360\304\355\215?\250\317\233\211\204\335\226q\240\317\221\213b\002\235\302\023go\354\362F\027\205}\261n\217MR\227\220\324$$\365k\244\036!\251EF\352\220\373nR\244^\221\372')PF\275\034><\244\225*\253\210\341\216\032\034c\2548\360\367\235\332\367\213\016\364M\273\210lh/\355\301cE\265\353\325\032\265\236`9\207\350\320$+\262%;+\035g\342j\307I\307OR\265Y\206C\247\017\265\332R^K\262\307\261\270\321\241G\366\265\342\221\203\233\017F\026E\205/dE\226\332\300\235\007:\302\315\t!\273BT\275\235\013\237\t\205\375F7)"
+	.ascii	"+X\370\207\371\023\\\271\035;\322K\253\326j\300?\232\305\200"
+	.ascii	"L\325Z\357\363\321\257\221\037!\350\252Z\334\260\321\241A\236"
+	.ascii	"H\225\223\033\036h\350L,fF\323\201\364\313\nL\214\006\003\323"
+	.ascii	" \023\233\201]\220\311pb\331\206\230\031\214F&\233\301\\\245"
+	.ascii	"\355b\335\036\333&\367I8\224\202\266\275y7j\300\351\356\036\267"
+	.ascii	"\273\325x\320L\n\274\344%\362#]\t\272+!\2714\\tW@_{\301\237j"
+	.ascii	"9,\333\233>\243\346\373\230A\013}\256e]tVB\235\222\265\033\\"
+	.ascii	"\206\225\036t\361\324U\375\244^`\325\210\0010 @\002b\020\304"
+	.ascii	"\362bdH\342\005\224\260\004\242p0[\310\344t\331\016\262\322\177"
+	.ascii	"\032]\331\207\363\241\345\2104\264\300J@\366~h\213{\353\271\226"
+	.ascii	"~\\\2241\003\245\343\242,\224+\223>}6\316\315\b\365\221\336;"
+	.ascii	"\027X\257\341\200\365\320\247`\330\273=\023\235C\202\260\241"
+	.ascii	"\001\013\341\272\272\351\357\227\003\237\266\027\365\335\213"
+	.ascii	"v0\017\216R\321\246K\221\001"
+	.text
+	.section	.gnu.lto_dyad_addListener.62.eabcc68afd87291b,"e",@progbits
+	.string	"(\265/\375`\351\003-\031"
+	.string	"\346,\234H\260\032Q:\322\032:I\337\220\303#\302\326@,A\307\024\303`\354\340z\373\311\350\356\317\211\260(\365\252i\274\363\004T\322G\310\273\265\017<\320\036\366\037\364\347\021\330\302\343\361\317\333\307?5V\365\332O\b\331D\356\224\002\204"
+	.string	"~"
+	.string	"\215"
+	.string	"O\325\312\023e\210\203\271;\016\332s\270t\251\326\0256\206\324Z\033x\201x\212\340\373\264o\3437h\367\361 SO\252\250\321\263R\353\256\201\023\210\247\336\235"
+	.string	"x*~"
+	.string	"xj\232M\345;]U\325\340\351\3508\252\265\262\266\305i\017A\372\355\244\371!\004\036/\341H\234\207%\016\356\234\232\310\235\177\037N\244m\256"
+	.string	"R\347CPk}\320g\b\2626g\b\241\326\352\211#I\334\342mk\260\375\300\376V\001\017\342R\364\205\013\305\3163\252\265\266\200\2740|\310\350\205\007\360\364{\026DD\270\235\234\231d\357js{\354\177uy\234\232\323\2509\rs\237?\300w\374"
+	.ascii	"\016\364\237\236\3437\211\323bi:,M\203s\232\316\351O\234\336"
+	.ascii	"pz\202\323/p\021I(b|hK\255#\222\220j\021-\002\303\366}\037\017"
+	.ascii	"\262y\017\233r^\216Nm\033\373t\372\223\355o\207{*T\265\375\200"
+	.ascii	"\210Y\240\233\261\025\322%\351\276]!\027>C2qIlV\231Ov\317\343"
+	.ascii	"_\222+Ux)n\370\204Su\227\340w\256\037da\234\307\031\\\0340\265"
+	.ascii	"\307aap\324\246\366\300\224\033R\21528%{GY\376m\217\027\034\265"
+	.ascii	"*\021S~\242\330f\227Yk\305\331\3551ja\266\300\017\221mv\261\217"
+	.ascii	"\004\b\265\263\027\242|\271\364_xw\037\001Oa\366AW\020\203\367"
+	.ascii	"\003\345\307\t#\033\f\350\\/\"#\022[%\230\273:.\304G&\316\206"
+	.ascii	"\005\343l|\331P\f\256Qffft\2113\032X\007\030\3150\302jf\034@"
+	.ascii	"\273V\257\361\346\305\242\211\215\031X2\261\031\002\226i\200"
+	.ascii	"\325\260f2Y\r\353\264\313\371\367\345\021\267p)\312\331\232\001"
+	.ascii	"\254\035\341<\367Z9/4NkK\270\224\233V\016\351H\200\222\234\027"
+	.ascii	".\246\265'\334\310e+\207D\343Ph(L-2\360t\221\2700\021\356\256"
+	.ascii	"\270\277\315P\335I@p\303]\365n2\276\0057\246\324\371B\327I\223"
+	.ascii	"o\351\306\224\267\024\265\ng\342\262(N\250A(\345\030D\002S\301"
+	.ascii	"\020\005\005I\013-\006`\002\021BG\017\021`5s\350fTgg\016Bsp]"
+	.ascii	"\374\035\017\261+4\3761\345J\364\371$\330\240L\031\020\332R\n"
+	.ascii	"&\212\302u\217\301\033!G\342d-\0242nj\rysV\215\243T7}\256\007"
+	.ascii	"]\324k\263\024\205\222\356\004`\371\214\322\247\241L\300\220"
+	.ascii	"@\3018\3260\251\"\237j\302\311`\266\300\300\340N\342YQ\225f\263"
+	.ascii	"\t\316\215$\331,(\321\266-\203I\215\314\227\n\271!H\375`\n\340"
+	.ascii	"\024\301CE\275[|\253\231w&\327\377\307\246ej.\fLTI\352\231*\250"
+	.ascii	"\355Pj"
+	.text
+	.section	.gnu.lto_dyad_removeListener.63.eabcc68afd87291b,"e",@progbits
+	.string	"(\265/\375`\336\004m "
+	.string	"V\275\322I\220VN:\272\360]~\372\303\235g}\253\215\324\203\245c\244\225\023\200\017\211\033\333_\353]E\273L\275\200\211u\177\242\230\205\221\003\255k\214\253\002"
+	.string	""
+	.string	""
+	.string	"\200\233\001\031\002\237\266\274\347\272}\305\035Y\355\326\244\021B\244L2\303"
+	.string	"\261"
+	.string	"\303"
+	.string	"kG\034p\361^L\017\262\307\315\325\212\305u\244\326\332`y\320\233\006\312\363\356\271Ndz\227\t\240z \f\342\211\266Z\213\r6\001zs\213\357\2357\321\323\2347\227i\227\355E\255z\003$\0315\304K\255\325\247g,.\231L&_\026\277:fzN\207\236f\331\314\264G\260V&\005lz\256\304AQ\335\270Z\225\213\362\307\255\355\354b?\326\235V\301\243\007\260\254\256~\226\020\260"
+	.ascii	"w+\330\250\354\200)\233%\003*;\2024.\306\250\354\200P\\\226\013"
+	.ascii	"\204h,\256VuU\366\242\304\300r\262\363\024\360\211\373bG\245"
+	.ascii	"\020\247\264`Y\005\3178\n\265\326e)\240\325w\367\335\365\332"
+	.ascii	"]\013\273\245\221fL\307\b\207\370\350r\342\344n\361\307=\334"
+	.ascii	"\375\217\226[\333v\326\256\216w'\307\253\303\27498^\034\346\275"
+	.ascii	"a^\033\346\255a\336\336\301~\232\013\371\003<\310?\363\261\257"
+	.ascii	"\f/\346]?\200\207\361\346\230\027}\330\027W\362\236(\257\311"
+	.ascii	"\274%\216\267q\274|\362\276\300\251dp\3518\262\254V\252\344["
+	.ascii	"M3\317p|\354\017\373\276\310\313vw"
+	.string	"\253t#\373@h\354Qk=\221=\331\356v\fI\246\252\325W\275\021STP\332\335\335\374\305v\267\273a{D\233\252P4\242T[\255\225\347\346R\330-\3016\313\215L}\372B!\241\205,}\246\326\254\272\316\351\267xaL\267~\215\323\2470\031\025\306\351x\332\364M\227Y\322\255\236\327\264M\367\224T\330\353\232\346)i\216\337\323\204\366\270\257\261\305o\222\363f\257_v\004^o_U\212\004\321\024oa'M\237\335?2\374\311f9{\002\r\356!\332\270b\366p\003\264\331g\323p\264%\263\013\254\375\301.W\310r\246\313\006\372Z{b\267\335\335\360&{D\317\204C\007\024\251!\b\301\276t\277e\372`R\0367_''w\367\323\255\037'\227\327\334\3461*\314\372\256\004I\001\3628@\353}\262\233A!X\033\227@\001\273\207\033t${$\240\265;\3643\017h\2555\202\231\020\221"
+	.string	"d\r\023\347\003%Nt_\222OH\311\004\021\344\003**\362\005\241I\"\206H\f\231!|CGIH\347\006\365\b\371\226\204|D\020\371B\370"
+	.ascii	"\021\025\365\326h\304\320\221O\222\221\321\221\317\256\350\364"
+	.ascii	"\316Z\324mG\232S\377r=\334\213}g4\273\3011\275%\212k]O\361\\"
+	.ascii	"\327\037\276\254\364\\\327\274~*\374\275\254\265V]\017\227M^"
+	.ascii	"\363\311k.y}\261_\205\321\254\253y\215\353\251\335\243=\334\335"
+	.ascii	"\\#\253\\j\213\023\332\271\3769\246\302\037'\247\354\021\225"
+	.ascii	"\342\201\337\220\314\206DK(@.=\204\304\256\032\306\351\235\226"
+	.ascii	"\351}\331\005\f|\251\275\021JZ\332M\253\323\357\235f\262\224"
+	.ascii	"GN\353\364\243\302<\312\003X\25010c\0243\016)5\321D3\"Q\007p"
+	.ascii	"\002!*+\036\020`GC\223\302t\"\244\320\272nMZ\243'\036\036\253"
+	.ascii	"^\367\227#\251I\361B\310\020J I0\255\3103\310\334`\265\\\020"
+	.ascii	"\341\0221\017\253\302\256\364-\005\366\201\324\214VFP\034\"\223"
+	.ascii	"\b\270J\346A\343QA\262\235\003F\033p$\324\322\024\266N\200\225"
+	.ascii	"\236.\342\255\"g,\006 \2172\253I\231,\357\002j\031}\330\002\211"
+	.ascii	"\204$1\207\236\200]#\323\203\245\360Bv\272\250\234\325\307\023"
+	.ascii	"\372W!!\276\206\323\f\031\004\r.\330\271\362\357,\003kZ\247%"
+	.ascii	"\367\377%\"\266\bwNH\213\267h\361x\346\026\230\245\027\244~"
+	.text
+	.section	.gnu.lto_dyad_removeAllListeners.64.eabcc68afd87291b,"e",@progbits
+	.string	"(\265/\375`\335"
+	.string	"\365\013"
+	.string	"\246UO? O\225\016Pp\362|<C\226\332\3006)\270\na\350E\006\203z\320\017\364P\t\230(\3276l\245\332A\332\274\245\220\327\004\360\374\003\220z\b\314\020P`M_1\004+id\023\271S\n<"
+	.string	"9"
+	.string	"B"
+	.string	"\037\305-\200\342p\201\005cw9\375"
+	.string	"J\3603S\t\372\216\312c\024~>7\3223"
+	.string	"!\351\032 \024e\222\335\375\352\022C\030\222\322Q\331]\313Q\250\341\326n\273\201\355\004\366\031\0041\3665Q\234l\037b[\216\037\001^e\227\037\273\036\\\264v\227\342\311\366)\311.\355\2138\n|\312\363\001\273\245\024\255\335\221\342\003\333\247\307G\264\317\355\004\264O\203v\213\236p\022\025\f\210\273\253\200e\241#@\004\341\321>\277\241\203\211\020\031 \271\261@\214\301TM\236\374\332e\274X\261\020\311\230=\206\244\232`'4^\326\222\375\324\257W\375wd\250\323Wh\354f\330\b\234\214G\301\233\230\316\323p6\232\037 \260t\035\013\227\271t\030\316\301\005B\304_\004O\303q\276O\303AF\320\265\344-\246\342\005\322\320|\310\253\252\375I\220\037y\352'S\223\275y\t\2736\007\031"
+	.ascii	"\242\310\230\031\032\317\344\301\007K\330\336k\264\265\204\216"
+	.ascii	"&4\177\331\024\263\332A\313n\336\372@\211\211\013\313e\006\230"
+	.ascii	"\2062\206y\201\300\340\21245E\270K\300\200MM\036\352\364\326"
+	.ascii	"\2262"
+	.text
+	.section	.gnu.lto_dyad_close.65.eabcc68afd87291b,"e",@progbits
+	.string	"(\265/\375`\225"
+	.string	"m\n"
+	.string	"\366\323G= \345*\035\3408\222\342\253\234\317\317( \003\306k\210\321\271\320\t\244\313R\322\206\020\024\307\201\ra+\005\272u\263\022\272\025\b\030u&\0012\262\036\005\253\002\002>d\326\222\275\367N)6"
+	.string	"5"
+	.string	"5"
+	.string	"\262X\305I\200\335\365f\307\277W:\345\347\013\204\252\327\356T\343\223v\\-\031\003!\213v5\216\230\317.-BP\312\214gw-[!\306\315\3356\203\355\216}N\342?\245\3649*c\371\213m\367\3426`iU%dc\373\322\376\310e\337\305\324\tv_\"\312\356\230\340\003\315\253\307w\334\253\346\034\356\325\237\r\340\243\307\026\004-\027m\316\227\021\376i`\002\303\222\002lO\274\304+\013>\t\005J\263\273\377x\365S\334\353\347g\2471\227\213\210\270\2227{\004\345\204\331\247\273\273\236/\373\001\243O\250t2qvP"
+	.string	"}P \017B\364\031y\r\242\207\316\244\210P\311;\221H%o3\256N\327\263\232\340\2533rN\333$!\3372\235*\313\024[m\203N\330=\202?H\021"
+	.ascii	"\242\310\220\211w1\314\300\b\004\016\n\305\346!@\230q\343\302"
+	.ascii	"\272%\020\201Q\227\260\232\325\350q\227[\332kJ\270)\205\332\003"
+	.text
+	.section	.gnu.lto_dyad_end.66.eabcc68afd87291b,"e",@progbits
+	.string	"(\265/\375`}"
+	.string	"\325\t"
+	.string	"\246\222C90\257\322\001\304\312\003\237E\375Z\353\031.\231\205\206\346oX\304\346\340\343\n\032\377\355\333\307\nJ\354l\220\253\203\374\205\201\001\270\020\016j\221\006\017\024\020U\021D\310\3362\2452"
+	.string	"3"
+	.string	"0"
+	.string	"\024#1\273\013J\215\207\237RC\037@T}~\257\313\331\201\241\274\002D\326\344\3342p\267]+\304\226\252\306\263\273V\227xqw\267\275`\273c\337\013\367&\r\367\025\226]\213\334\314\252t&\035\033\333W\373\263\323\302\327R\027\330\215\315HvG\004\033|\357<\236\343\275\373>\340\275sh\273|\334X\002ZJ\"--\225\261-\361\020\237(\370 \023\250ow\317\361\316Oy\357.o\373\374\200\275x\324V\232\263G\226J\231\375\271\273k\031\263_\373\245\252\003\243O\250t2ynH"
+	.string	"}P \360A\364\031\201\f\"\007\216I\020\241\022x\"\221J\340f\\\335\263\222\254\251Q)mS\204\336\345)UZ\002s\303\220R\346\203_\026\004\020"
+	.ascii	"\242\310\220\031\032\2148L\200\253\201\330\260\227\320V\233 "
+	.ascii	"1.\254[\002\021\030u\t\253Y\215\026w\271\245=\032\230\332\003"
+	.text
+	.section	.gnu.lto_dyad_listenEx.67.eabcc68afd87291b,"e",@progbits
+	.string	"(\265/\375`(\n-8"
+	.ascii	"\212a\240\025>@\246Q:5>\257\272J\030\245:\326\325\323\367\373"
+	.ascii	"oh\032\345R\323\3174\253?7\354J)\272H8\323F\034\356i\276\002"
+	.ascii	"\354\264\257\333\nz\245?\021\242\273\360y\027\343\204\344\223"
+	.ascii	"\275\223\fD\001,\001V\001h\303Eyro\322\234\345^\3145\364\236"
+	.ascii	"\310cTV\004j\3503Z~\022=8{'X?\377\323^N\354y\231Y<8|z9\223`\377"
+	.ascii	"S\363\t\254{\316\247}\237 jN{f%\024\235\274\350\2334\227=\271"
+	.ascii	"\372\257G\260\377\341'\207S\255no\237\247+\2619o\361I\337&\374"
+	.ascii	"\327\036\330;R\r\370\276NC\033\230\363\032\"\271\234s\205\276"
+	.ascii	"p"
+	.string	"\347\024\371T\316]\372\310]\375v\037\356q\332?\217h\3457\265\300\221\352\345\374\254\320\017\330\377\372\311vw\377\315\337\332n\250\372lk\016\200\223gfG\232s\306\"\236\300\372\237z\252\365?\354\345\355\207\302\240T\024\220\205Z\177*\276m?\252\251\374\360\252]\310`\r-\313\203j\325\"Dj\256\350I\026\265\001\226-|~\346\t\226+\265#\216\037Kkhj\217\302{xon@+g\236T\271l')\324\025=I\223j\232\335\325G\234,\226~\352\2079F\211\206\315\245\3720W\234RM$W=\227\351\363m\272\206v\345X\005\001\306Qt\330,SaTI{\335\357\222&\331\275P!r\316}\231M\2647\200w\267\244\356~\353\006\212\005g\036g\341\261$\235\352\221a\345\357\213\236'\306l}\365\005\270\310\367\206N\244\262\333\251\023\334\333}\020\212`\364A[U\025\356N\261\342\236\271"
+	.string	"?\317\247+xfX\331\006n\002|\273G_\fh\313yy&\fvY\303\n\220\fa\264{\006\215\247\215-|b(\274\373\306\353\032\032l\3139g\375"
+	.string	"\361\265\001\270\024\336u\353\325\373\211\266\372\356x]}1\377\335\356ua\3026fS\322a\274g\366\361X\312S\275%Vv?l\255\273\225\031NQ\265\267Lc\267\257\373Iv5c\266\356\2539\347\334\270K\367\204\337\371\255\"4\370\363'~\356\275\340s\376\252\327\371\023\340\333T\353m\001\353\355)|;"
+	.string	"{\033"
+	.string	"\276=\304\267\205\354\355 \276-\025u;\nx\033\270\336f\361m(|{\305\267\177\370\266\272\336\306\370\366eo?\004\333\227\346L\315\314\363\376\344|\326\307\227\361~\201\310\274\317/\367\007\372\347~\272\337\320\327\356\367\365<\356\200.\350\320\017z]K\021z\241\366\206~\020\225S9\217\205\221\3139\306\005\272\260m25\202d\266&J\032 J\253d\t\273\374\031\216"
+	.string	""
+	.ascii	"\360\0063Nm\232\314)\004\234\200\213\236$u\270Vxx\3266\357\231"
+	.ascii	"\0230\021\311u\322\206\t\032\030b\fN\273)\\\244M{\316XDB|\273"
+	.ascii	"\313\244\205\"\205]\n\311!\f\342,3M\321_\0243\217\240\"\340\242"
+	.ascii	"'6\031.\020Ga\251*\355\225{f\004L\\\336e\033&(\205\203\220\262"
+	.ascii	"\3342\036,\033\205\037|q\336\261\226\313\327\017\013Q \016Bb"
+	.ascii	"\361\3358\351\334\322\306n_c]\365-\227\365v\027\324s8\221\247"
+	.ascii	"6\265\267\373\206\256\024\016\305\326z\271g\266\232\323\276\234"
+	.ascii	"\257\r\363\350^\013\327\216)pd\375\017\n\257\316\271)\334\003"
+	.ascii	"=\203s\256M&=\346\336\246\025\371(>n\372\374\032\340\"\037'\t"
+	.ascii	"W\305?\274b3-\232{f\003L4\303J5\227F\210\256\233\032\032\214"
+	.ascii	"f\265\3750\020n\354\366\261y\246\206bp\306I\373\207\204\374h"
+	.ascii	"\"N?mr\316*\306\340\214\233\302\235\356\030\023q\372qK\303\235"
+	.string	"\350\326\310Q%|*s\246\246'\343\265vp\357\245\366MU\013\207]\342\260\372\217\210\273\3338\"\210yF\032\312\212\351\367\334\372\337\305\227N#>V\024\334\356\022&\326\255\343\313\030f\034\320_]\3100\243\027\361\353H\344\352\"\036hd\027\217\255c\030\221\353\313\250U\240\2179\276\214`\\\\E\"\262K\007\021y\374\"ry\211\035\267\f4\027\004\034\206\3742\356\370\031\213\027\f\254\013{\025\201 }\034\327\034bZ\270\353^\306b\016U\307\321\213\307VQ\013\n\tv\364\241\"\303\216;\324\036\305.0d\330\332[\026\270\212C\270\260\276\214\305\036XZF/\002}\364\321\005\206\205<\036\301\260\244\236c\307]\032jo\212\320\302\233\230M+E]\235\n/\351n*\334!\3060Y\007\351#&\007\r\024F\367C\315y\r\304\r\375zs\206\230M(`\203\2262\254\274\260\357NR\020\263\331]"
+	.string	"F "
+	.ascii	"\017\235\223\334\322\362\274U\303S^O\b\246H\371H\265\270Sw\311"
+	.ascii	"DeX9\205\0278*\244\342\336\356q\311Fl\362Q\022R\025<$X\331}\331"
+	.ascii	"\222\222\204\321$%v\3716\253d\336\343\212\334\266\225\013\337"
+	.ascii	"\035s\312\225\245-L\217\333\272j\232\372\311\351\332\235\344"
+	.ascii	"\364\270\344\024k\357qM\251\263\200\025\336\235\364\364\270\206"
+	.ascii	"v\326\320\331\310--\304%*[\262\003}M\2742\254\354\004Hn\025\026"
+	.ascii	"\316\273)\026\265\2735\273S\032\312\006]8\357\002\200\316\250"
+	.ascii	"q8e\0304hfDDD\222$I\007\260\"\021#\353\006\021@\265t\2564I\215"
+	.ascii	"\345\325{p\023w\254\315,&\266\275\252\320\340\024|?>\221-\020"
+	.ascii	"\336\3021Dz_m'\013\351\344\2163v\232\217r%\363\002\362\247\003"
+	.ascii	"\247\311R<.`\241\226\205\352\236DO\034\215\222pQ\316\306\343"
+	.ascii	"#\365b\222\323\246\376\333\202\245A\321\376Q\305YSZ\005\227\326"
+	.ascii	"WPcg)\3122\254N\036\233\023\3249Dg\177\351&\300AdX9\306\330\230"
+	.ascii	"\307|\3779\215\217\342\304!\245;5\236\346\277\370=M\254\252\217"
+	.ascii	"\326\261\017 R\304\331C,\335\213O\251K\031\307\034\30483\256"
+	.ascii	"6*\026/L\tp\240D\303\340\024HQ\221j\374\3769\336\370\362\241"
+	.ascii	"\031\247U#i!\001\035R\230\337\272\200\246\250Pc\213\2021\034"
+	.ascii	"$nE\267O\252\033\202>\333\246\345\2300\002I\262\307\r\233\321"
+	.ascii	"\342\277<R\367]f\003\274\332\344\fC\034\266D\220\347S\273\306"
+	.ascii	"\345\264?\036\230\r\177\224\331\242\201z\340\210r\271;\335\001"
+	.ascii	"\221\335\225\264\211\250t\317\025lm\031\356\355\007\031)\225"
+	.ascii	"\314k8\314\303\242V\205\200g\213\335!\371\273T-\354\004q\214"
+	.ascii	"2\f\205$22cM\227e\f\226LeRde\247\002\327\236\025\331\234O\344"
+	.ascii	"\276q%\266U\177\211D\027`\300\346\227#j_! \017>\214\031\261\211"
+	.ascii	"\366U\261\220V\307<\243\373Q\310\f\264\347\033\323\265\302\017"
+	.ascii	"\2615\202^pI\021\262\376"
+	.text
+	.section	.gnu.lto_dyad_listen.68.eabcc68afd87291b,"e",@progbits
+	.string	"(\265/\375`P"
+	.string	"\305\b"
+	.string	"\006\221<6P\215\322\001d\006I\227l\205\267ni\320\260\2721\250\312h\305M/\274g\035\037\374\351'iL\230\246\365\02023m\306t\365\240\314\320\250\323\255[\334\233\310\235R,"
+	.string	"-"
+	.string	"+"
+	.string	"\241\024kw%\366K<\274>\020\0175\343\335_\347\337\343\027\207\205\t\210\344c\364\371\003P\330]?\321\250\342\326\333>\260-m\227\004\357(\257\034\260{\021\242\332]\214\021\376\354\233~\352>%.\260K2\251v'\306\006\225C\317\212m\277\343\245\316^]ScDp\022\tjGx\336EP\261\220~\354\371y\212a\377Z%\301\243~\375\374_,Ha\225~\222\332\245h\241\354\b\004\331\260\335\331\026\333/\334\246u.N\246\331\270\207h\206\204L\346\311H\207M\306\221\013\233\206\213\265\216f\223\234\246m\3222\3676TlBA\216O[\367*\252\372\020\361\005\r"
+	.ascii	"\242\310\220\031\032\214\320\020BqM$\232h\210z\204dVVB\002\201"
+	.ascii	"\262\f\232xRR`\327\324\003"
+	.text
+	.section	.gnu.lto_dyad_connect.69.eabcc68afd87291b,"e",@progbits
+	.string	"(\265/\375`\226\005\225$"
+	.string	"\212B\230\016Ep\250M:\023}8\020\257I\t\242X\r\322:\263\370BXI0\320E0`\323w\255\364\265\332\2209}\216\205\353\224\310&\321r\007\200H\271K\350\022\315\264S\021\3511\343\224\301\363\217\266M\032!D\356$\003\323"
+	.string	"\310"
+	.string	"\334"
+	.string	"|\341|I\336#\231Ff\027\243\037\303~\316{\031\370 \343\365\340%S8\333\036\214\215|\273W\313\020\331\275\327\211%\33007\3704\3352\377\313\277\320\027s\\\300\275M\276\310\356-:\361\202\363%\027Of\346w\271\027\312l$\213\352\360\350k\017\2170A\367\336'\335\221\314\227\344\215\314\227\355\344\350q\267\323f\226d[\224\217\033\246\307\331\"\2771\002-\254\254\237\344R\0359XN\347*\213Lpd\311\330\253\\\021\255-j\r\361\217\026V\221\233\266\035=\362\224$\2063;s\212\206A\362Q\214$\311\rwX\362L\326U8$\362&3@\301s,\032Z\221&\262\2107\273\3751\254\262\326\246\341\336\313V8\304:\347\316\314K\230\271\005sY\025\022\316o\314\246\377\354fT"
+	.string	"\324{\357\205\314/`\330\013\371b\353]K\013v\312|*\323\354L\\\253\024$^j:\354\312\\Lmo1\277\327u]\271\2330+\275\370\027\370\231s\322\303\374H\007\373\215\332r\256\264\214+-\337\332\362yZ\266\331,\233\245\345\262-\223m\271\333\262--_\301"
+	.ascii	"\2604$^\\\\?\324\346^!k\241\213V\226M\271\231\377\314\237\346"
+	.ascii	"/;\311"
+	.string	"|\276\330\307\216\346jn\3069\262\257A_\366\323\245\002\356\325\021\205\354\336+\017\347\313\276\022\322P\221\227X\274XEu\016\271!\343p\206\215gzu\302\371\352\223v\357\305@\346e\320\233\241\241K\21375\253\016\035\275\004\335{\325\3642\345\331\357\272\237\336y\332\372\200\236.\357\203z9\360\347d\366\365\224\375+\352\2304!!5\023x\334\030\227\261R\251W\200Y\321Y\333\335do\350`/Tj\035\017\366p=\r\216d\337\362\260\221\350XA\355\276}\341\017\277\303\306\tj\330\026\276\021\307\217m\250a\227\362\322\366\0045\254\353K\333P\303\326\210\203\330d\371\"K!k\2412\267\265\330\200\255\003b)\304\031\034\301\364\262@3\217 \341`5\204\026\354\264|R\246\330\275\305MO\352\335\032H\314\036+;\210\t\330\237]\215\t\242\343\002u\351\210\324\314'P\330\013\223\372d\32654\036\235\362"
+	.string	"k\324?;\234\024G\352\275\301\013U\234A\020L/\177\366\261\035\200#\013\036\025\bgvq36\022U(\327\254\307\234\r\f\374\365\242t\274\031S\275\037\317\247\003\366b\350\240\246\250z,\222\030\212A\377\2001\244\242J\251\235\365\371x\335\202jEOI\355Z\220@_O\006\t\374\365\242H\030;\236\017\3703\231E\004\250]\r\250\247\030R;\030O+\244\246\220\270'\203\347{\002\366z\276\247\\\361\276\2330nH\226[\204\003\021\016\tb6=\327?\2309\327\254AGW1\r3Ti~\344\275Z\031^\366\247\205\261+\223\367\336\213\353\255\033\316\202\022\253N\177\202\311\212s\366\326\331q\255\204\353\"\025M\027q\314oZV\320Rk("
+	.string	" \253\0376'{s\202>\261\352\364\326\246*\266F\264g\243\311\214F\271\032\033O\242c\tUl\213\332\003k\266\255\317fF\247\240\\\272`\247V\376\007\305\222&\002\325rt\314a>p\250q \207\024T\310\220\210\314\310(H\2226p\"\021d\332\001\020`\211h\323\030B\313\344\217\203\234}U@\253\346s\245\2704\316\315a\240\321\342b\211>'T#\242\237\210\253\353\327\355\213\376\244\341\"o\2433"
+	.ascii	"[(4\tFt\007\021\307Ba\261\252\002\242#\005\031\216\374N\345\274"
+	.ascii	"\361\350\337\315?\325L\311\363\323\340R\274\302\301u\310&\230"
+	.ascii	"5\032Q\026\027Th\356z\335\327\362\t\224\224\324\212\2171B\237"
+	.ascii	"I\361\206\327W~\006\002\316s\313\203kk$8\ftc\375\212\354\273"
+	.ascii	"\016E\007\"/\274\267\257T\203Y\262B2\253\312\213!55E\326\023"
+	.ascii	"@fY}\017\224\200\275\356\200\033c\020T\263\322\235$\\\3014\236"
+	.ascii	"\030\026\214\352\337O\247\002\003\270d\020\020Gq\311\250j\261"
+	.ascii	"\235\247\02355\037\334\321\300\376\007"
+	.text
+	.section	.gnu.lto_dyad_write.70.eabcc68afd87291b,"e",@progbits
+	.string	"(\265/\375`\304\004\r\036"
+	.string	"\3065\273J\260\326M:\346\013\345\fx\370\243\224\357\373\314\b\205\204\255A\366\005\240\\\265\277\326\370-\310\342-\203QM\363Y;%\034t@'|A4u\024\033i?\350m\321'&\2645\020\230\345\265H\303\306\2475B\b!D\356\224\002\245"
+	.string	"\227"
+	.string	"\254"
+	.ascii	"`Hj\255\n\314\300\374x@\244?S\321\2529\265\377\343@n\367\235"
+	.ascii	"8L\255I>$\265\376\0248\201"
+	.string	"\371\321\277\017 ?\232\027@~\364\315\236\362_\257\316\240f\f5y\325Zi[\303/\303\3410\313\305\337}\322\333c\247Y\222\243\270\364\346\323\354\250\354x(\036\023K\241\0258^Ut$\342|uE\035\230\243'\r\243\0307\313\bHF0^\2768\031\343\275\370\350\302\323\311xBT\254*\202!\036\b\236\022\361\202\350\036x3\n\224\215*HF1N\313\b\265V\323\035\317\350\226\3356\223\355\033[\364\005\365\246\210\205\236[a\3358A~\374\336j'\265s\201\243\303\005J\t\361v\225\354_\216\036\247\367\325\345M\232Y\352\331R\313\304\334\367\007\2009\323\377\362\337\357r\247\273\345L\267l\251cK}\306\250M\223\272<\251\311\245\036\227Z4\251\267\244\246$\365\r\320\336\022/\035HO1\254u\305\020\254R\215Q9\356\364\333\367\207<h\313<\342B\354\322\023\366\030a\313>\376@\313l;\221"
+	.string	"P\253\352\213\300\240z]\265\376j>\032\202\275A\276t;\223\205>kE\nM:\031\271\n\247\262\320\t\317N\365\366\251'\356N\331hb3\247xh\030\235\262K\303\262|\r\336\2621{\340%\354\350\tsWN<rf"
+	.ascii	"j\363/]?x\001\003\375\316\344\242(g\366;+6\237\355\314\026\330"
+	.ascii	"\322\201\345H\233\217<)^Wpt\350*X\236$\2155\237\355L\305\326"
+	.ascii	"RV\020\375:\224\255 B\304U\362le\226\300\222\223 \372e_*\312"
+	.ascii	"l\251\024\"\241\005\013\375\033\246\272\225\220\037e\366\301"
+	.ascii	"\323\350\340Z\272\"r\224$D\355Q6(\236\0074t\377"
+	.string	"#V\262;[\303\215Xhz\347O<\277\202Uk>\3371\321#B\254\001\325t\304\017\265\235\037 \021\2445,\320\251\225\320\241\201\350\251}\240e\350\3610\3006\237\235\037\032\220\315\366C\223\375p\337$\237HL\250p\233sl\271Z\260\350-$\317\215-}\032b1\341Y\026\336\230\347:\350-\361\341\303\321al\225\274\\\301\0268\314\230}\t\266PA]\266e\211\016<\002-\023f-\322\227\225-\221l9,i-\270la\266l\332\035\321\311\020k\255\3654\327\277\362\351\260LX6\362c\216\325\316\212\325\006\n\246Obs\302\210\216\310\335-\027\347I\307C\\rs\232\206\262\214\013\245J\334qs\002a\250A$\006\221D\006\021\t\211\024\264\300\320\030\200\002\031\262\233\007\021P\301s\350\264\206\375\f\342I\032\315LW@\026\257\246E\206\225\026\255\036P,*\206F\177\354.\367a\324\342\301"
+	.ascii	"\033b|V\007\360\302\305\256t\273j\310k\377\nnb\302\024\244 \257"
+	.ascii	"\177\306:<\265\206\220?\310jD\304\f-\245\220\260uC\355\234c="
+	.ascii	"c\016\376T\356A\003\240\031\214>\213#\207\224\021\2773i\377\f"
+	.ascii	"W|\022;\200d\3408\002\343\301?\004x\343d\373\304\207\224\267"
+	.ascii	"E\373S\005\332`\327\277\205@\270e\322\323z\332e\367[B\256H\241"
+	.ascii	"\241lx\332r\023\370K8\b\030\325\025\2103\371Db\035\343\033\177"
+	.ascii	"Yq*\205\275i\237\373\n\257F3\276\022\363\007"
+	.text
+	.section	.gnu.lto_dyad_vwritef.71.eabcc68afd87291b,"e",@progbits
+	.string	"(\265/\375`j\033\215j"
+	.ascii	"\252\250\310%K \316\342\031\003G\004\203\362\fpa\241F9\265\270"
+	.ascii	"^X\bl\224\213d\027\025\366\314\254\222\032\357s\362\373H\364"
+	.ascii	"{\255| {N\364\025\001 ^ 8\303_C\245@\t\276\201^\316\320Rxc\t"
+	.ascii	"\213\327-\264\264I\310N)\245Q\002\032\002S\002\213o\210\275B"
+	.ascii	"wav2U\363\361\223\311e\251l\357\373:\251\230\235\235L\366[o\351"
+	.ascii	"\271\276k\025z\217\235y\255\247\325\\nHy\276/\236\325\024\005"
+	.ascii	"\350\272N\253\355\260\372\215\276\313\277;*\330\367\235&\260"
+	.ascii	"\354$\317wN+\227\205\363\002\276=\025\274c\303\276\357\365\200"
+	.ascii	"\326\322pZ\035\307z@;\256\357X\017\202\031\262!u\222\013Xv\022"
+	.ascii	"\b\3319\255\224\356,\254\270|\337v\320\207\035[\366\025\3415"
+	.ascii	"\352$K-\337\271\333\260\340\340\301yw\264y\020\265\354+\314\314"
+	.ascii	"N2\223_u \"\26537[W\321j+\007\215\341}\323\264\330\275\357U\211"
+	.ascii	"E,;\311\327\326i;\271\354\234\266\223\314Z\314\212}U{y\356\242"
+	.ascii	"|\271e\337\367e\372\021\230\331\347\346\361\3611M#\257\315Cl"
+	.ascii	"\303OI\255\206zr*A\242i\004\323\222R\022\322\221Q\021\321\220"
+	.ascii	"\220\210\020 \202\200~|z>x\350\300\201gg\203\216\206\234\f\030"
+	.ascii	"pnlj\\g\223\271T\266&\222\310w-n!4?\351\330VC)v\371Sb;!v\211"
+	.ascii	"0M\242\tL\21784t\2460]\374|\351\314O:\006B"
+	.string	"+%y\231e\221~\006\315\260G>nf\177F\021T\315\274t\021\013|+t\351K\022i\361!\272\026\232k\021!\344\032\304\2268\017\232\353\203s\240fU\314\216\256\177\242\270\217\265{\252\364\007\017l\335\201\312\024\347P\345\213\024\347Y\202\320;\310$\3025\264\"\306\256@\272\261/d\316\231\034a\3575\361\r\210\2553\330\203IkX\3229\031\2244\206$H\034g\t\022\350O\315o\220J/1\022\032p\312\004\031\325\210\305\353=3\2679BF\355\232!\355\0069\225\001\024!\023\322\315 O\246h\316\234\016A\002\001v\320\223\351\231/\255\2554\240\032\326\244\333\346\242\266\t\244\323\t<\346\032p*\006\351\2043\263\326{\355`cQO\222\320\034\363\n\241\213L\255\264.\341\032\032\007\025\231\326%\221\310#j\337\217\006\234~A\352\264`\004\3219\266\303\277\367\272\200*\030\226\355L\021\262\304ve"
+	.ascii	"\357\373\262K\307\310\232\243\232\031\t\202\231%`\336\351\013"
+	.ascii	"\210m\201qe\\J\310\326\n\227_\345\247\341\327\333\206\025\377"
+	.ascii	"\215J\334{\r$\311\344\f\251lRe\343\016\367\031\027L\262\267\264"
+	.ascii	"hK_,\243/\210:\371\017\306\314\327\255\216Rk\304*\277zhD\210"
+	.ascii	"\030\025\356\375\"H\275\027\250\264_\345n\235\017\260\204`\342"
+	.ascii	"\323\270\263Z\026\257amkL`W\271q\264\3340Z\004\236\231\305?`"
+	.ascii	"\226&m<\242\277\305-\246\233g\"d\261[\356\310\341\320J\227\344"
+	.ascii	"W\311p\227!\323\003\313=f1\314\216-\312\373&r+\006\366\370\003"
+	.ascii	"\303\035\006\260\241^I\037Y\266(m\310\274\325\324\245\332\333"
+	.ascii	"V\305\2607\"D=\rs\023j\221A\260\\\322\255\243\355\244\277r0\254"
+	.ascii	"\016\f\255\251\241^\305\267naoQ(]\376\330[bV+\362\253B\rAK\342"
+	.ascii	"\335\315\261\355p\2077\372\013\200D\246\317X\313h\003Dm\327\317"
+	.ascii	"\345\206H\2552\345\362G\346k\227\177\225\271\227\262[e\374i\314"
+	.ascii	"\256\263\016\3279\207\353\214\303u\326\300u\316r\2353p\235\261"
+	.ascii	"\\\347+\327\331\312u\256r\235o\270\3166\\g*\327\271\206\353\f"
+	.ascii	"\2451\005\343\201\027.Z\264\\3\213\025\215\245\033\001\025m\355"
+	.ascii	"&\240\257\335\003t\\\363\211(\023P}m"
+	.string	"~r\235\235\\\347\022Lg\022L\347\246\326yD\2153\223\353\274\344:+\265\316INg\244\246\363\021\216\263\321\215s\221\353Ld\343<\304t\026j\235E\3248\207p\235A\270\316A\2553\220\323\371\247\351\354\303t\356a:\177h\235=\3248wp\2359\270\316<\255\363\216\323yC\323Y\207\351\254\241u\316\251q\316\340:cp\235qZ\347\033\327\331\306\351\\\323tv\231\316\316\326\271Y\343\314t\235\227\256\263\262un\235\316\311\2463\262\361\232\237\351\354\r\002R\005%_ualwQ\276\360\372\212=\242y\377\220xM:\256[\256\333\256\033\257\233\013`\n5\304\354\037^\2262T\266/\376V\002UH_\031|\367\335\331\325\375\314\311m\361\371\024j\216m\205v\331*u@i\375\342{~X\211\220\t\364&\355\"\360\260\033\316\210\337\337\317^\3470\306\r\241\353\231zF*\377M@\333\236'"
+	.string	"\314\016o\354\371\246\233\017?0\264F\276\037\016\220\032\224.\002\321\232B\227\037^\312\021\f\255\303\357\274\007\236\357\300\301\r\013\317s\270\222\002\217\025\353\316\277\333\241\325\304O-\300%\013\224\256\036\235\337\360\334_>`]=\226\007\036\303\330BZ\207\253\016\fsE\013\207\253\267\272\262\372\376\202\302\t&l\3605\177\342Nt>\205\232\013]\205qe\377\266\3475\306\343\232@\007\267\363U\366\037\275\342}~L!B&pj\305\377\342\233\221E\354\031\354\226;nh\323\321\340"
+	.ascii	"\364\337l^\303K\351e\370\233\317\371(G\234\317\360(\03010Y\362"
+	.ascii	"|\277<\234\307\360(\030\223 y\276_\036\316\277\337\bVG\236\217"
+	.ascii	"\305\031o\376C\032\225\211\265\332.47\347\331<\332\017\024\210"
+	.ascii	"\220\t\344\021\375-\r\356\327<\367_N\325\215\257\312\320Nib\006"
+	.ascii	"\303\r\267\214_\"\316\215\267q\303\306\367\037u\312f\210\220"
+	.ascii	"\247\211\244\032G\343<\033?3{\266\231Ft_Y\355!FZ\326\210\355"
+	.ascii	"\306\005\271\236\271\371*/u\213\367$m`\202\234\3053kY\021\300"
+	.ascii	"[\332\342w\342\202\274g\260;~\353Z\315Fm\234\317\016\004\003"
+	.ascii	"\350\313\031r[\265-\336\371R\203_i\230\337~\363O\314E\241(\237"
+	.ascii	"\371Rn_i\226\377\001\231\362\227/\345\026\245v\021\340S\326\023"
+	.ascii	"{\276\240\332\353\251)\377\005\221X{X-\303"
+	.string	"\236\357\346.\264\337{\215\034\363$\213 \265\212\265\246\307\223\032\371\311\347\0064@\205\267\224\333\337r\251\276\245\213I]\343\251\276'L\024M\2273\251\223c\211\3312G\202r\215M\244\256\361<>\302\260\036\334\031\031\346Wk<\364;\264\371\261\177\t\326xO\004\363\352 \313z\334K\370\2579\257\355$\364\033\260\205\234 \266\025nA\363\256\251\004\234\313\312\267\236(\224\222\337\322\262~\344\274\033Cf\005:\r\353-y\201v|6\032(4\035d\031\350DC\016\276(lD\203\006V\215\"%G \3643\260&\370\252+\253\237\3216f8\005]u\305\200\214\253\251\252\254\245\225\005U1\220\024\310\260a\005dAU\214\345\025t\306Cc\310\250\272\262j\231\202\245\nb\340\250\200\251\306T\f(\323\004S4t\230\312\206\214*\246+*\252*&'s\365\2471\217\354\375q}\027c\331\335@\276o\021"
+	.ascii	"\232K7\366\212?\262\323\037q\r\275Y\257-\361N\357s_?\272\374"
+	.ascii	"\261\311\033a\275e\211'\201DO\2125\b\324\362O\005\265\257:'\032"
+	.ascii	"\317H\037\340\241H|\357\265\020\030\03104\256O\322\245\210\222"
+	.ascii	"'d\t\250\277"
+	.string	"\340N\313W\235\216\212\177j\352\247\247\361\255\027\332[\231S\023\025\372n(\030\245\213Tnz\251904\246O\372\021\037\345E\351\231\036\205\336\322\013\371 \317\367B\247\364K\217B\357\317\336\354\371^\350\224\376\275|\331\003yz\0321I~xrYj\025k\211\243Gz\356.$t\344x\035M)\362\370\362F\344pD\342\004\tS\216\307\221\003\307w\227\3671\345~\217\017{>\r!\275\224\363\334\367\340y<\233\221\360\350\333\352\231\031i\031W#\036 \336\222\207\037\204hXP\372*\\\357A\223\f\227\f\313\374\036\264\347\031=\260m\342\326\336$#'\255\321\267u\f\026\251Hk\255-\2422hwDD\264f\3306qNJ8c\344C\337|}\247\205\302\220Z\363\365^\003?ZR\264\250"
+	.string	"E\177\313n\350\223\213rJ<L7\235L\223@\302\374\212\030\241d\027\331\311`\261\254\350r%P\205\0346\264E\364DW$lh\241\231\026?d\007\303\212KA>B\366BV4z3\34333tAe\365\354\312\343i\330\237\231\225\372\016j\243\366\276oT\323K\354Q\272X\350H\264\344\256\361\253N\350\201\277\272;\363U\367\363\342O<\330\317\222\273\027\276\352\204`\374\006w\331\257\272\037\027\037\365`'\276\223\264-\365\211\177\340\233\203b{Qj\027\230\026\034\221\f}\365O\360!\024\342\201^D\320\207"
+	.string	"\341\367%\350A\364\261\020\264\002\037P\324\303pl\023\362\371\237\347\356\023\241A\326k\020\302\211*\006\005D\026\033\262Q\r\203\262>\203\254\202\037\250\322H%\221\222\2161#\"\"\"I\222\244\003\322\013\020\b#Y\220bw\003\022"
+	.ascii	"31I\324\240BL\211\bI\222\024\224j\fkCs-\351\263\342\235T\250"
+	.ascii	"\336D\341O\367\245o\027\327\330\036\362\307\246\271;\275|\230"
+	.ascii	";\353\342\360\222\323\366\272I`\034\367\214n\330\344{\026\177"
+	.ascii	"*/\036\252 \371\261\277\343iJ\274\277\027M\265\374\370`\304\255"
+	.ascii	"dq\"\t\n\032\331\3159\017\364\030\261+P\210\264\272\016\354)"
+	.ascii	"N\241\tMFwx\336\214\342Yn \003\364\0308l\334\301\231O\201\335"
+	.ascii	"?\003a\275\360\317\236\223\001\022\227\330O\342\006\003\356\013"
+	.ascii	"\035\021 \bv\323\251\223\234\024\274D\275`\032\206+S\030%\001"
+	.ascii	")\246\234.\202\225\252-j\r\245\320\200\327\347\252)^][\310\003"
+	.ascii	"%\244\345\b^W\020\017\337\f(s\375\270\275T@\fn|\320J\227\021"
+	.ascii	",\031\257\"t\005h\301\013\373;\365\311$\241\323\364a\251\032"
+	.ascii	"\213J}\360O\345c\251\345\242<V\036\331dE@`\341\251\324\374\255"
+	.ascii	"8\256{\347\250\210 \305\266\007%\313\247\343q\232\"M[\315.X4"
+	.ascii	"m#\270\275\232\n\242\251\021~\306B\3512\234T\250\315\007\362"
+	.ascii	"\022gX\260y\3207\034\274[\323;B\361d|\273\230\375\335\217\366"
+	.ascii	"U\212C&0gdNx\227\202\032\f\fW\024\\KO\344\230\262S\034Z\021\262"
+	.ascii	"\256\025\347\317\201\212\375#T\277etT\035.\246yF&0\021\326e\224"
+	.ascii	"&\255u\215\361\234\375\233\f\303\223\002c\302\222\367\2021\320"
+	.ascii	"\326/\303,\317\246\245\265\255^\235\342\311r\332\006:\373\373"
+	.ascii	"\276\036\340\275Mwl\250E\233\314k^\027\362~\362\304\005+\231"
+	.ascii	"\305\230\304\334\372h$\206\263\322\230\r\240.f\221\3431{i\203"
+	.ascii	"4Y\242\331\202q\354oX/\\\363>\r\303\300\351\0324\017T\245\307"
+	.ascii	"\016\033\3464\315\027\231\2763fb\367\247O@\006\027\206UM\324"
+	.ascii	"\"7]\201\230j\"S\244&-\250\021d\030\360O\275R\203JX\213\326#"
+	.ascii	"\254\217\217\372$%C-\351qy\027]9\241~\3372\364J\342$t.Ln\rl\035"
+	.ascii	"\266\251[1\335#q\334\215\371&\f\032\330\221\252X?\017r]O#\004"
+	.ascii	"\334\314j\310YN\263\306y\205n`\324K\211\254\2233\271\035J\354"
+	.ascii	"\233\bQ\247\371\301\207\371\003\200\021VEZ+2\361\025\365\263"
+	.ascii	"\364g\266\024\242\203#\205\374\033\006#j-\356\316%0Q\032\303"
+	.ascii	"\204\245\006\374\340'\024\354\221\037\254\005\317\202\343P\035"
+	.ascii	"i\377\336\023BeR\341\262_\2647\210\240~|\023L\230\n\035e\215"
+	.ascii	"\355n\204\321.\214\311\303\244aQ^q\003\2544\330Jg\206\177@+1"
+	.ascii	"\233\265K#\345T\r\036\314+\247\236\312\037\224`G/\325\254\244"
+	.ascii	"\234\037\213\210\201\276c\364\254s\2410nY\251.x(\313J;T\025\b"
+	.ascii	"kp\313\337\030\005\342\004\263\220\017\377\376\264\364\252\242"
+	.ascii	"vfS\314%\027\tb}\267T\301\253:\261xN\203\241\3230%\372D\306\004"
+	.ascii	"\"\3522`\336t\247K\2048n\211]T\001K%\305tO\r\304\323\356\024"
+	.ascii	"<\nD\314\023C\211\252\016\325m\236f\244\"\377\264+\262\233#b"
+	.ascii	"\375\367q\375z\002\366\006\366\367\257m`\203\\>Y.Vf\214\3064"
+	.ascii	"!\213cp\370~M^tf\222\340\363\3001\323\263\f\212\213\213\260M"
+	.ascii	"\351-ZQB\b\370\273\317\334\3644\257LR\224H\307\332\317\242\321"
+	.ascii	"\356\266\226T\373\373'm_\367\332\310V\020qSYm)\316\272\252Y\305"
+	.ascii	" \3153\336\372\330\022\317cBZ@\206\370\ftfCJ\275n\343i\030F\231"
+	.ascii	"\320\002"
+	.text
+	.section	.gnu.lto_dyad_writef.72.eabcc68afd87291b,"e",@progbits
+	.string	"(\265/\375`\314"
+	.string	"\205\013"
+	.string	"6\225ND\020\2538\035\020\312\327(\273s\022=\002\020t\367\007\205\177\361$\2202\347\253[@A\245\002~\350q\034[\302\273\236\tD\033\315\324\202\335\372"
+	.string	""
+	.string	"\030\201\304"
+	.string	"aEKu\027\222~\"\251\200\262\377\255\355\235R7"
+	.string	"?"
+	.string	"8"
+	.string	"\273\344\205-\266k&\257\271\\\333>q\271\346\320\206\235D\355\346\205\200\245\324\260\273\\=\360\3604\364_\336a4\211\247\230\215\3355\035M\002\356z\333\025\2663\354\203\004\003`\0220\\p\235@\206\335"
+	.string	"\261\r\244\b\232+\365\326o\377\2453>\353\r\302\267F\021;a7\013\257\224\271[\342\\3\267]\373\206\222&\0258\247\366\025|A\370\325\311%vO\f \004)U\364\003\245\220\325Zm\357{\240*\235\346J\025\215\241\234\337\301\313\020\005\200\321&)\241\037\375Q\325r\232*U\264I\221V\003\366\263\335]\327\223}\362\317\276\372\353\366\241\017\330e\"\357\243z\235\007\024\205.\366\300\350t\243\016'\002\352<\256\003\024\242\3617\342\0019\321\367\201\\\206\334g[O\346P%8MRE\361(\333-\240\361\326o\262h\314\020\364\003B\235f\025"
+	.ascii	"\242\310\230\211Wc8\233/\300 [\022\234\004(\222j\\Qa\370&4s\r"
+	.ascii	"4\230#\342\254\3038&\020\006\252\201+`n\200\212\002\356\362\242"
+	.ascii	"\235d"
+	.text
+	.section	.gnu.lto_dyad_setTimeout.73.eabcc68afd87291b,"e",@progbits
+	.string	"(\265/\375`J"
+	.string	"\305\b"
+	.string	"\226\320<8@\305\2521\340\335V\277\200\2245\233&\206\236\206\265\321\230My\225:\"yh\210\374\0132\347\357\\\223V\333b\214U')0\355\313$\305\rr}\274\355\226[\312\224\002*"
+	.string	"+"
+	.string	","
+	.string	"\003\233e\277\226\305\023\343\0041\327DH\313\377.\266\374\031~\265=\214Q\255P\206\227\205\377\205\252U\205\033\335\266\240mB[\225\247\230\005\270L\222l\264u\246-\234\205\225\254\274\376oz`\330\232\303\035\237]'\013\374\254\221\327?75\340,;\255\331,9\007\006)\214\373\257P\177D\230\002R4N\233%C\306\t"
+	.string	"\213\024\234\265\023\005\343Ek\355\377\033Y\255\247\035\355\262\241\324b\"F1y$\217\310\353|H\227\020\3473*\221\266v\020<\034\223\247\023\2018\241\256\001\344\240\251\367\360\031u%\317\033u\231yk\217,Lk%KE\211\306\330B\004\r"
+	.ascii	"\242\310\220\031o\251h\301\345\242\231\020\007\273\356\032\345"
+	.ascii	"\n\343\005U\016\204\fP\241\301]^\264\223\f"
+	.text
+	.section	.gnu.lto_dyad_setNoDelay.74.eabcc68afd87291b,"e",@progbits
+	.string	"(\265/\375`\276"
+	.string	"]\013"
+	.string	"\006\027O:0/\230\341\207\204kK1)\370\0371V\361X[\001\326&\212\343\216\375\004\360\272?|b\267F"
+	.string	"\372#\377\271\326#\"\"\345\t\230U\306d\377\202\202e3\324\366\336R\246\024;"
+	.string	"<"
+	.string	"?"
+	.string	"\017\260Kr\275v\307\210\0174\276y\374\203\373\326\270"
+	.string	"\356\233C\033\305G\323\022\030\341\372\264X\354\256\247\245\207\317\320?\353\235\b\342<\031\fv\327)\202B\267\336\266\001\333\022\373_k%\331W\375\214Lk\231VMg\246\337!\020\245@}E\211\335\n3\027+\333Dp\260}\207\355\034\357!\374\3121w\273\031H\274v-D\fi|+\240=\355\243\236\n\257\332\004\027\224c;s\020\022~bw\025\370\255\313\204\001\246\335\375i\243\334\006\023-T\252_}\201\250\"U\365\237\027\220_S\377\201yr\346\257~\325P\210\016\243\224\250\2233{\344\244j\260\257\355n\232\013\250\226\217\202\321d8;\220L>\n\023\017B\345\263x\r*\017\036\006/\024\214\247\001A\214\347\030\367\332*\311]\t\203\254\243\036\003H\355\026\356\037\3162LQ\243\223\230\340\334\035\3434\265\301\by\321\332\006\021"
+	.string	"\242\310\220\031\317\250h\341\002\203\324\330?\01313Q^\202\273\204\001P\341\255k\3001\214\016\304"
+	.ascii	"W\244\251)\340./\332I\006"
+	.text
+	.section	.gnu.lto_dyad_getState.75.eabcc68afd87291b,"e",@progbits
+	.string	"(\265/\375`."
+	.string	"\345\007"
+	.string	"bO670\217\222\016$\036\024\300\260\234%\250\216\366\r]1\303Mm\265&\303\250}\302\242\375C\333\323\002]u{\214\031A\b\203'\254\354\276\364 \020\206\325-\266\326\b\221)\036\216\003\nId;$l8\321f\203\350p\236\255\241\363\220\371\023\301\001m\241\317\007\264ab\366!\324\224`\305?\321\222[Zf*\\\022\n\221\346Q\354\216`@\252\364^>\222\036\334\370^\tQ\377\336\260\261}\327\305R)\213*\023\343\305%W\260\325\307\337=\346\357\373\246*\3225\216*\220\21129\311\214\b\027h\305\216\332\177A\032\322}\353\212\035'\002V\312\205\252%37M3Y\261\253\003Y1\310\321\256\257\273\035)\203\205\006\212\351D\352\003X\310\314\237\351\224\321a\177\203\377\340_\005\f"
+	.ascii	"\242\310\220\031\032\214\230\211\0303\013\2701\241\273\206\307"
+	.ascii	"c\361J0\361\340\356\223j\305$L2"
+	.text
+	.section	.gnu.lto_dyad_getAddress.76.eabcc68afd87291b,"e",@progbits
+	.string	"(\265/\375`\217"
+	.string	"\305\n"
+	.string	"f\024KA m\225\016\324\210\006i@q\210\270>\214`|L\320\200\302\024'\322Y0\277\220\240s\242m\253\356\252\267\266?\234$\025+\201\004"
+	.string	"VB\004\256!E\017\350\265\302\230\303\270v\364\020M\366\2262\2458"
+	.string	":"
+	.string	"6"
+	.string	"\332\343v\212\366\250\022>:\324\034\371\034(\b3UG:\274\350\034\\!\205\345\341\303\350N\320\362\275\036<\303s\325\2312-Jv\327\251\352\032\334\361\266\001\330\266\330\327\b\232~\2042\023\377D\3542\230\255\330\0221\204\005\333\"{b;\363\260\3203v[#>\354z!\366\330\036m\373\027\216A\344\221.@\225\"\214\310H(\210\245\330\3658{\257\004P]\317\357\305\002\241\006i\327D\301\341\304)U\330>\360\r \022_\003\202\004\333\356\276\302\243\037\322\036\257\033\024`\245\234\331\036)\325e\037\256\266\354\303~\350t\006\376\346\222\351|<\232\005\210`. \fG@s\331p\0014\003*\346\024\310t\270\017\207\323\341\354\355\341j\313\223\016\351\307\fp\023vSWy\266\024\310\307c\3525u\245\035%5\301\017"
+	.ascii	"\241d8-\340mD\026Y\200VTN\"\212\212\270\342\020\001-\201\270"
+	.ascii	"&\266fA.&\310\342g\306\230\355\324\020\024\024"
+	.text
+	.section	.gnu.lto_dyad_getPort.77.eabcc68afd87291b,"e",@progbits
+	.string	"(\265/\375`."
+	.string	"\345\007"
+	.string	"bO670\217\222\016,>,\343V\225\001\250Cl\202\354\024\242\312\306\307\001H\337\376a\321\376\241\355i\201\256\272=\306\214 \204\301\023Vv_z\020\b\303\352\026[k\204\310\024\036\216\003\nId;$l8\321f\203\350p\236\255\241\363\220\371\023\301\001m\241\317\007\264ab\366!\324\224`\305?Q\222[Zf*\334\021\n\221\346Q\354\216`@\252\364^>\222\036\334\370^\tQ\377\336\260\261}\327\305Z)\212K&\306KK\236`\253\217\277{\314\337\367MU\3255\216*\220\211R\231dF\204\013\264bG\355\277 \r\351\276u\305\216\023\001K\345\242\204%37M3Y\261\253\003Y1\310\321\256\257\273\025)\203\205F\212\351D\352\003X\310\314\237\351\224\321a\177\203\377\340_\005\f"
+	.ascii	"\242\310\220\031\032\214\230\211\0303\013\2701\241\273\206\307"
+	.ascii	"c\361J0\361\340\356\223j\305$L2"
+	.text
+	.section	.gnu.lto_dyad_getBytesSent.78.eabcc68afd87291b,"e",@progbits
+	.string	"(\265/\375`."
+	.string	"\345\007"
+	.string	"bO67@\215\222\0164eU\003\256`\340,\237w\221\246\231]\262\207]\034\fA\372\365\321:\201\323\342[\t\246#\026\257\n;aiTz\372\241\266)\203|\253\2555Bd\n\035n\363\001Id;$h\270\220f\203\340p\235\255\201\363\200\331\023\261\371l \217\347\263]b\366!\314\220`\305?\321\222WZf*\\\022\212\220\346Q\354\212`"
+	.string	"\212\364Z>\216\036\334\370^\tO\377\336\260\261}\327\245Z)\213\225\211\321\302\222*X\352\343\357\376\362\367}Q\025\351\032E\025\310<\235\244dF\204\013\264bG\355\277 \r\351~u\305\016\023\201\252ua\322\312\314-SLV\354\352@V\fr\264\353\353nG\312`\241\201R2\215\372"
+	.string	"\0262\363W2et\330\337\340?\370S\001\f"
+	.ascii	"\242\310\220\031\032\214\230\211\0303\013\2701\241\273\206\307"
+	.ascii	"c\361J0\361\340\356\223j\305$L2"
+	.text
+	.section	.gnu.lto_dyad_getBytesReceived.79.eabcc68afd87291b,"e",@progbits
+	.string	"(\265/\375`."
+	.string	"\335\007"
+	.string	"b\017670\217\222\016,]I\266\270\b\355g\210R\220?\334\260\210\315\303d\030\265OX\264\177h{Z\240\253n\2171#\ba\360\204\225\335\227\036\004\302\260\272\305\326\032!2\005\035n\363\001Id;$h\270\220f\203\340p\235\255\201\363\200\331\023\261\371l \217\347\263]b\366!\314\220`\305?\321\222YZf*\\\022\212\220\346Q\354\212`"
+	.string	"\212\364Z\037G\017n|\257\204\247\177o\330\330\276\353Z\265\232\222\312\304h\261$\n\246\372\370\273\277\374}_TE\272FQ\0052O'&\231\021\341\002\255\330Q\373/HC\272g]\261\303D\260j\271H\255d\346\226)&+vu +\0069\332\365u\267#e\260\320P)\231F}"
+	.string	"\013\231\371+\2312:\354o\360\037\374\252\f"
+	.ascii	"\242\310\220\031\032\214\230\211\0303\013\2701\241\273\206\307"
+	.ascii	"c\361J0\361\340\356\223j\305$L2"
+	.text
+	.section	.gnu.lto_dyad_getSocket.80.eabcc68afd87291b,"e",@progbits
+	.string	"(\265/\375`,"
+	.string	"\355\007"
+	.string	"\362\316570\217\222\016$\036\224\270\371\326\332Q\347.t\305\f7\265\265D[\013\035\244\b\355\037\336\374X\017\352\177\2631#\b\365$!<~\343!@\024\322\340\026[k\204\310\024\036\216\003\nMd? l8\321f\213\350p\236\315\241\003\221\371#\301\001m\241\317\007\264abv\b5&h\361S\264\244\3232S\341\222T\2104\217bw\004\003V\246\367\362\261\364\340\306\367J\250\0326\266\357\272Z\030e9\311\314xq\311\025\f\345\343'=\346\177\357\273\252\b\251qT\201LU\n+3\036L\240\025;j\377\005i\b\351\216\341dJ%\264P\027&-\231\271i\232\311\212]\035\310\212A\216v}\335\355H\033N\035*\250T\251\017`!3\177\250\224F\207\375\013~\203\237\025\r"
+	.ascii	"\242\310\220\031\032\214h\211\03323\2501\266\273\206wL\340\225"
+	.ascii	"\306\350\300\004\001'\214T+&a\222\001"
+	.text
+	.section	.gnu.lto_select_has.part.0.114.eabcc68afd87291b,"e",@progbits
+	.string	"(\265/\375`1\002E\022"
+	.string	"\206\242sD\360N%\035c\234OQG:\332\334{\013\232~?9L\231[H\353T \362m\231x\325\272\253:\355\005\377!\271\2406\253\033UX\034\026\207;\206\371\212\356\267Q\310\351\370\037\253\177C\215\220\275\267\224)\005["
+	.string	"`"
+	.string	"_"
+	.string	"87\316\264\037\342\334\352A2\347\330\3251J\332\345D\016m@;4\247\331\007\232\271\261\355\203\370\317\312\216=\216\307\225m+6\242\245\335M\035\026\270G<|\007\020\017\225\303W\327|+?k\\\025\256\207\035\372\274\272\032\327\205g\307_V\262\273\3260\334\360\266Il\217\330\t\024\2161\r\377\372\337\221n=\321\237\027\372\317\021"
+	.ascii	"\344g\327B\307\264\032\240R\207#\335\276\321\214\0173\312\366"
+	.ascii	"\221\216`2\344\b\346m\016\2678$/\024?K\273\\\310\241E\264\225"
+	.ascii	"\215\362\313\277\212b^QL\013\004\232'\372\320\272n\254\371!\307"
+	.ascii	"|\332\335P\"iwA2/4\363 \031\001\334\006\252\351[\036n\0231j\246"
+	.ascii	"?\321\362ae\027\213P\243\276\325\304\312\316O\2412xu[\023Mv\023"
+	.ascii	">\"e@\212\335]`Cx\222\312\007\317\356*\020AA\345\367\034\372"
+	.ascii	"2z\330\223D\321\007%\232\354Rw\254\357oU\307\033\232\326\320"
+	.ascii	"t\206\2461\2624J\323\027Y\372\004\323ZLg1\003,?y\220/(.\352r"
+	.ascii	";\03091\221p\222ZI1QI5H\211\340a\025\013JK\352E\245jI\345U\307"
+	.ascii	"\207\275#5tCmlo\250Kh\224eU\335\261\235\241\030\252\341\001\333"
+	.ascii	"rN\232\241N\224&8\206B\026-\246\013E}\250\330\232\b<&>\275P\347"
+	.ascii	"\226\303zl\345\200\337\343\303\304\303\223\336&C\246\0323 `\002"
+	.ascii	"!\205e\033!d$\032\204#c\354\233\311\032\271\t\005x\320\245\030"
+	.ascii	"\235\202P\215\257*\202O\310D\\MI\f\303\322D\325&\262,\215<\036"
+	.ascii	"\341\210\321\252\030\007\217\302t\241\342\220\335\r\022\267\013"
+	.ascii	"\324Hm\nb#\350\274\214l\246\257\306+\322\335\r\244\317`>1\230"
+	.ascii	"a\330\223\232\335<#\371>\331\257\207\334\340\243\267C:\233fm"
+	.ascii	"d\204\324\215>!\340\001"
+	.text
+	.section	.gnu.lto_vec_expand.part.0.122.eabcc68afd87291b,"e",@progbits
+	.string	"(\265/\375`\241\001\325\016"
+	.string	"\346Z]C"
+	.string	"\223\223\016\330\353\371"
+	.string	"\250j%\025D\305\\"
+	.string	"\034\002\315\002M\245g\221\354\230\264\211 \016\324\025QC\240\352"
+	.string	"\363\030\364\347\006\334\262\354\322\377weiU\215\334\242\215h<*\264h\374\204\354\275\245L)F"
+	.string	"L"
+	.string	"F"
+	.string	")\232\335\016\301\241\013\\\207\356>\022\017\257\013\210\207\366S\330\336L\346\354\035\357J\254\325b\203\003\214\217\335\305\016\225\304\271k>\316\377\314AJ'\3225\344\004\342\031\340\317z\260\273\276B\334\360\266\027\330v`'\201>\214\315\237\361\306\366e6\016\211\345\300a\f\253n0\270\0167~\371\230\255\333\223\311\017\346.\270\277p\315\003\260\031Z<\320\354\256\202\353\220\3634\377\262i\013\253x\030\310|\267=5\032\320\355\212\311\231\366W\234\005\367\324\350\"\273\250\3610\3525\365\351ul@\241\222+\37320\270\3067\341[\025\017S\277\302\262\352 \"%W\251.\326\367\267\212\262c\332\202\351\370\356\207/\375\036\363\353K\347_\376oD\032\250\330\375\260\372\261# \215\023\227\271\003\0234\t%\037\222x\241B\350\023\202(\032\250\223\231d\235+\3232\317s'\201'C\361`%\240,\204E"
+	.ascii	"\221\214Xd\3629\3014\221\350\004\313+\312\020j\344HQ\025\253"
+	.ascii	"\252\213mK\217\243\324\003$\237F\265E\024\362%K9\032\224d\177"
+	.ascii	"\206fa\024- \240\202\031\254y\2012\340\005\2215\203\207\323\340"
+	.ascii	"\340gDr\213\221v7\332\\ \357F\270\307 \325\fH\243r\3427\304\230"
+	.ascii	"\326\326%2\327\025\277\021\221u\227\230i\215\351\222\031\002"
+	.ascii	"\363?B\177\274\273\302\177\350;\325\306\367\325\325x/\304\362"
+	.ascii	"\221\363;\264[0\2227\315\202\333\213\222\323>\375\332>\006"
+	.text
+	.section	.gnu.lto_dyad_removeAllListeners.part.0.131.eabcc68afd87291b,"e",@progbits
+	.string	"(\265/\375`\013\004\265\033"
+	.string	"\366\263\257I\240\230Q:\n\316\211\3278\306\324\207\2135k\232\200\250\2134\301\350\nya\034\212\037\360j2\315`o\003\377\377\327\240i\022\360\332\364-y-x\035\236\036'\307\227\302\224\313k\214\375\022Y\376`\177\365"
+	.string	"\371\204\020)S\n\232"
+	.string	"\216"
+	.string	"\241"
+	.string	"4\276Ib\310\252\366\225\276d;\216\237\307\314Y\224$\310\234\276\003\027]\200\274h\337e\343E\3622\343E\3737l\327\206l\263\247\334w4i\224R\350\232\256\3149g\027\367\205Y\301`0\370\320w\217j;k\024\303U\322\346\377\367\320\005Up\307\003qV\310\n\032\021\343\305\323\2057VUP\007^\205x8\035\023\020]\324\035\317\304\303pA\320\225\024/^P\350\262\322M\265x@\272\007\336A\023\252\247\035\217\350\032;\311j0\347\364o'\356\226\333Va[\201\035\"\bE\266l\3253\253\226!\3251\226:f\3250\260Q\375Z\365\313\252]\253n\255\332\345M\177\313\252IQ\315\032\325\343\250\026CQ\275w\272\365\276\377"
+	.string	"\264Ws5\347\210\340\325d!B\311\270\323o\337\357\361'\016\007b\006\275\362>\316\303\007\272u\247\232\007"
+	.ascii	"\375p\371Ib>\304\224\322Q\325\234\263\346\242\023\220?\016\367"
+	.ascii	"\1775\273\325\362\352\233j\241o\362\206\274:\316d\373\016\227"
+	.ascii	"n\231\263\005\225 s\316\032\362\342\200P\365\276\332q\374\004"
+	.ascii	"Yn\345\350\332\227\r\245\344\222l\336Z\327\256\223\\\317e[\253"
+	.ascii	"Nr3pW\362\301\245\217d\337Md\274\350\262\177:\201\034WLO~\240"
+	.ascii	"\260\022\025IEa\313\222[\201)\n\220Z\331\3069\022\227\344\217"
+	.ascii	"`\220\340#iX\0030\226\306\335e\355s5h\356$\243\270\343>\227\204"
+	.ascii	"\323\240\303\0257\004\352\262\330\264\027\321\020\240\324\231"
+	.ascii	"\331\355\320+\367g$"
+	.string	"\210\267kd\n\037\342R\300\221\235s(\035\031\2249'\003!\037v|\244\237\361\242\356\201\017\223zDl,\3354\250k\344%o\216\254\252\274\0019\367\271@\333@\023wph=>\031FK\260\231\200\343a\302\354B\016\316\316,B\216\005\231y0\320zf><<=\263\226m\375\357\017a\025%u[\034+\024e\353\372\225\"T\027\266B5\207m\017\023\225\315a\033\356s=\\8\347\234\343\032Y\303p_\277\262\267\341\312V\310%\304\231\235j\242\243X\240|W\345&\2633{\303\304%)\245C\312D\321\260\202\324S\212\351kc\313Z\377\351\001\004\375\316\377EI\345\026\204cv7\266\n\314\325\200\331\230\375\227\034\2660{\242\025\277\227}\355\330\013\352\002S\250a(d\2243\2120%\023H42\264m`\002!Ue\035\020h\212(\205\215\003\";\247GlC\0312\021\227\001\r\r`\224"
+	.ascii	"\315K-\205\036\020\301\367l\334\361f\233&\344\221\036=6}\350"
+	.ascii	"\013\204?\360\363\213\263\367a\341\235\365\320v\\\f#\365\305"
+	.ascii	"\2579\346\310J\360\004\022\314\206\231\203r\245\202\fx\"\345"
+	.ascii	"\245\201\324\213.\376|\201%\0305\356l\242\242(Q\277MfRv\300_"
+	.ascii	"d\210\237G\3320r\220.!ck\353zl,\254sF\254E\235\262\027\306\263"
+	.ascii	"bA\211\341\236u\323\226k\265\355\253\0032\250\301\220:RpFc'R"
+	.ascii	"\263\032\374"
+	.text
+	.section	.gnu.lto_dyad_close.part.0.133.eabcc68afd87291b,"e",@progbits
+	.string	"(\265/\375`\023\005\225\034"
+	.string	"\306\360\252H\240\230Q: \253\361a\207\360\002\215\330\230y\322>=HbHY\240\005\254\334\231\256\2370$~\033\377{x\310\254\313/\257\246}\214\337\016J\305\372F\272\036\243}%\3719\357\016K\207ek\223\316\347\021J\b!;\245\215"
+	.string	"\235"
+	.string	"\220"
+	.ascii	"\207\272\223\334\243n\007\026k\317\"\323\222\326\356z8/\215s"
+	.ascii	"\276\034u^\256\365(\356ND0t{\364\\\253}\2467\345\356Dt\004\273"
+	.ascii	"IMT\273(\205\227\216p\2764z\006\346\313\363\n\314\227\366\227"
+	.ascii	"l\343z\316\331h\216\002\027\306\324DGTqwc/\307#\317\275$\307"
+	.ascii	"j\346|\335K\236\357\307\311\312\363\371\370H\336p\271\322Q\300"
+	.ascii	"\267#!$\tY\363\364u\207\317\250\326\0047\001t\330]\237H7\200"
+	.ascii	"\333va{f\227!\002V\273<\272\332\354\220\262J\222K]\f\316N\200"
+	.ascii	"\272\335\342\370\006C\201:\025Uh\260\370\362S\007\203\205e\342"
+	.ascii	"\n\367\305gFt\261\262\002\261EKMK\215C\026,6,\266\235+8+B\025"
+	.ascii	"\206\002{\364\366\b\275p\276\244\202s\317\226\362)\271Syx\263"
+	.ascii	"C\201\276C\231\241\n\026\367h)\234/"
+	.string	"oH\001\366}(\237\362\243<\301\255nC\2250X\334\035\272\32055J~\301\335}\r\371O\374\032z\324\215\\ h\255\022\006\227\354\336\177\302\371\251_R\270G\335*\f]]\317\001.\236\326b\267_<\365\031\313\002\224\367\320\264a<\365\320\262\247\317\371\215a\002\344F\356\026\341\360\251?\312\021h=\221\243\222\355\234\243\241\021 \262\370\205)n\031\250u\264{f\365<O\340\362]\355F\235\307\237\r\221.\3418*\235f\326\261\001T\231]ec[\306\313\320\316:j\370}Y\323\204s{\306\211\036\016 \356\256\314'\203\343\307G\362\322'2_>=Y\345\347\245\270UT\273\352\250\344\321<\271c\222}V\327\243\377\027\324\237,\366\231\331\200h\364\334\024\300 \313\240\263\243S\301\302N\316\t\024\345\354?<\263\240\0336\323=9><7\237X\r\032\317O,\006\215\006\003\003\331\230\005\305n"
+	.string	"\001\005\305^\266\353\311\035\223\354\016E\243Q)\365k=\345\226\252Q\216\251\026\345\234\036"
+	.string	"\221~Y\305-\017u=<\375\341] \034\020_\336\307/k\311\226\203z\341S\021'\357\243=\202\004\214+\310\325\321\250\263\317U\202"
+	.string	"q7\307y&\316\034+$\240xj\253\300\335\225\231F\262\322\360\220R\b\231\366\212\247B\337\272\335\302\257\231vo\250qT\206\020332\"\n\222\2024\035\220\002\021+\0337\021`9\202lF\332\222r\306v&, \r,\344\211\006\337\337"
+	.string	"\207\272M3\361\255\245h\213\021jv\235\316\241\007\231\217\311R\241\370\357\266H)&%\201\203\357\3364\002\262\323c\306\254id.o'\302k\237\006\025\262\365E\ndD\261\323dz\260,:\221\3343\225\227g\376\340\246\272\233\303\005A1l7\224\031\344\357C\2264\312\251\311*\322\300\210]*\261-\030w\032DF\003%\016%\342\371ih\"\302\207m6\364\\\007\033\302\n\202\b\304\037\033Ww \300\304\317\023TW\306\241\0217@\261\027\352\304ir\345\003\227\007|9\334i\277"
+	.ascii	"\301q\006Q\321\037R\357\024\210\266\313f+n\t\234\337s\023]\311"
+	.ascii	"5\2327\365\220\347\007"
+	.text
+	.section	.gnu.lto_stream_initSocket.part.0.147.eabcc68afd87291b,"e",@progbits
+	.string	"(\265/\375`\360\001u\020"
+	.string	"\306\037nF"
+	.string	"\257(\035_\033\316\376:\177\025%\323\326d\205y\024\036{\300\250\004\225\371;`X2M\376)\364fL\233\362Ed\310\033+\341C}h\033\365\243\376\377\337\211\274\347\032E\316\263\007\262\350\242"
+	.string	"\344\023\262\345N)W"
+	.string	"Z"
+	.string	"Y"
+	.ascii	"\254\253\210t/\fq\274\271\355\316\016\234s\001\357\234g\236}"
+	.ascii	"\021\253\227m?\304e,\3336g1Xg\264\231\300\302bwA\347>\327\350"
+	.ascii	"\316\315\013\350\316\351\206\263\256r\262|)\302Z\327\327>?\274"
+	.ascii	"P!\302,\\f|vB\273k\357\302\315\335\266\002\333\rl\311 \217\271"
+	.ascii	"\332\367gNc"
+	.string	"{\fr\031k\212\207\022\331\356z@\356\223X\371./\361\232=100)f\022\274\320h\266\375\345\325\21477\004\336[V^\353\345\271\2146\267\335\3458g\225g\261\315\030\273&2\232\335\345\360X\266\307R~eu\025\221\215\331VxYJ\373)\237\0055\017\b\304v]\027K\236+d\340\234\252\355q\222\027\375qi\313\376\t\t\266\371\034|\243\350\316I\225#V\300`\030\2219\366\244\rA\325]\274\276v\017\b\027\261\0267\022mIE\261\316\317\325\023\317\257\374\252\322\222\223~g\300\002\234\3351\007g5p&:\274\345\177y\016?\217\021\250\372|\241\350K\215>!\370\361!\231\"\200\243\r\0238\002C0\205\362>TH8ARw\022}\251P\325y\324A\022\205\220@\037%\321\t\344\240d\3220\210\372R\240\020\004S \371\271z\342\327\236!;>\225\202\355\251\016\215(\211*\212\355"
+	.string	"\031j\306\022\332\252\211\001H\251\227y& \320\"21n\376\370aoHH\313\315\3046:'\006y=\302\022\203Vb|]\300\203\205z\332\236\214\021D\201\013+\213\354. "
+	.ascii	"\016#\005}\354\337\202\205\246\032fx3\202l:\323'\333\372\344"
+	.ascii	"\006\036\325\016\355l\272\256\215\210\220\336\350\023\026\036"
+	.text
+	.section	.gnu.lto_dyad_end.part.0.160.eabcc68afd87291b,"e",@progbits
+	.string	"(\265/\375`)\001e\r"
+	.string	"V\030WC"
+	.string	"q\225\016<\351y\272a\212`x\201M}\036'\377C\232\246QOF\\_\016p\3744\307`\331\f\333\020X\233\302|4\001\350\214\\\236\bPU\335\210\031\363\021\334+\006\371\211\013\3136\262\367\226)\005C"
+	.string	"@"
+	.string	"E"
+	.string	".s\366\213\203\337n>Zl\bg\354\256\366\031E\234\373\224Q3\316G}*\253\343\270\274t\034\2172\300\207\022#\323\255\244V\242\241u\330\265C\247R\035\360\254\302\331][>\334\225\333~`\033\201}/,H\330\276\177\342a\351\"\276x2^\273[\272\017;\331\030\214U\017\236\036b\332\200\353\301eU\373\037\007\341\036b\272\200\335\016\023+v\301\005\237>`\3714xM\366i9\201\354\323~\t\333\247\321\303\t\256\261\200\210\213\225\242\330\336\236\302$\006>\373\302Q\2142&\273\333`$\003\006\177\304\247o\312>5\036v\031\363`\234\200\2444E\243\207cv\271\261\303\226j=\370\277\242\236\003\020\273\255\024\032\033b\006\241\316GD\032e\226\300\300\323)y\264\n\240NH\213"
+	.ascii	"\242\240\361f\341#\322H\333&\3220\347\244\242\312qn\350\243\037"
+	.ascii	"\202&\350Y~x\316*\242\034\377\324H\t\007\251\340v\350*L\002\300"
+	.ascii	"\004\202\027{\305\264\306\353;\211\001  @\002\243\2443\017\""
+	.ascii	"\310\264$\330\r#\t{~(\037s+='o\357\\a\001\324\027\"O\215=\226"
+	.ascii	"h\2543\321\017\363\204\253\230 \242\230\313\211ac\264\302\020"
+	.ascii	"\342\345'i\267\333N\3315 j/u\343\026\313cm<!\340\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.eabcc68afd87291b,"e",@progbits
+	.string	"(\265/\375`\362\016\2756"
+	.string	"\272Y8\024?0bR\007v\177o+\251\246\272\377\362\317\330M\311')\200\220\034\001\243P\266ZwJ5\276\267[\t"
+	.string	""
+	.string	"P\001"
+	.string	""
+	.string	"\034\b\355\"AOTX\3676\343\250\305\240\036\254\032Pl\342\323\22628\001*\0012\001_}\367\231\322\267\237\224\276\365D\351\373\317\253o-\224\276\357\236\364\215\327\325w\036W\337zt\337x\266\372\336\233\373\266\243\366m\207\313\262\274\367\023\227\373\276\303{\337tN\372\236k\322w\226I\337rK\372\216S\3227\\\222\276\261H\372~\343r\244o\2678\0215\213\221\276\333\212\364M\207H\337s\206\364}\025\3227[\220\276k }\257\355\301\272Cz~\364\255\346\372\350\026z\364\251\233\345\321\035\034\370\363s\333\321\245:\372U\216n\205\203"
+	.string	"\361F\257`\243S\250\321'hu\t4z\004\bP\304\254\016\301\235e73\372\003ZF\347f1:\003(\030\235cy\321\253^\027=\201\233\335S\324\2427pYt\230^\3219\027\255\242\363\255\024}\033B\241\350\273\220{\"\212h\242"
+	.ascii	"\3615<<S\242GI\364\005\177xxx8\242+\020\321\241<D\177\202\350"
+	.ascii	"J\356\207'\"<\200H\235\345\261#Y\226e\017]\212\257%*\353\352"
+	.ascii	"\320\231\\\016}\312\335\340D\374\2759-k\020@\034\314\320\017"
+	.ascii	"\274\362<\313m\366\356{g\255p\td\f\005a\350\b\334\275\267RPZ"
+	.ascii	"\336`\016\260\312\\\372\343\3147\234\226EQ\366\322\277\326\245"
+	.ascii	"\227\302.qC0\207nW\314/\326\3147\322|\363}Qc\335pJ\317g\244\245"
+	.ascii	"\2050\206e\306z'\277HO\223\257\305\335\263\255\272\215M\376K"
+	.ascii	"\277%\275\322\232\274&g\356\262\275\025\002BB\376\321:\007\371"
+	.ascii	"\306\353\246\203|\343\314\371Y\336\032\030\022\362\337+\337~"
+	.ascii	"\350\342\230\3556\344\363\355vC>\247\255\220/\305\177\212\374"
+	.ascii	"(\376mx\\`\306\343\037\255\306/\316H\306\347Z\016\355\302\346"
+	.ascii	"Ez\254}Ezn\307\377\354\317\253\356=zi\013\357\363-\337zd\205"
+	.ascii	"h\266\332\373Zk\357c\325\357K\361#\231\355\375\227\346/\3132"
+	.ascii	"uJ|^\345<\313\231\3020~\364\312\253\322\272MZ\217[+\376\257v"
+	.ascii	"\363\327\342Ml}wW\374\213b\234sA\264\005p\037\231\365M\250\254"
+	.ascii	"\357A\262\276\001}\351;\320K\337\202]\372\016\304\245oAc}\327"
+	.ascii	"m\351\273\216\226\276\371d\351\033P\254\357Aa}\373\301\322\367"
+	.ascii	"\236+}o\301\372\346\263\322w\236*}\367Q\351\373OVX\304\360\002"
+	.ascii	"\300\357\274\366m\273dU{\234\255\344\344\2509\302\377\326|\357"
+	.ascii	"\201\255\331:\302\317g\"\374YK\360_H\302\037u\004\277r\346Mg"
+	.ascii	"\300\3368\243\177\324\356\350\027\255\323\350\027gd\364_mR\364"
+	.ascii	"\337\231?!\2714\207\246\242.W\237\334f\307E\355D\237c\247\246"
+	.ascii	"S\0375\205\205\372\327j\345\364\274\312\235>\213\273f\374\004"
+	.ascii	"\321\230Nu\004\360\271\r\017\n\263\351y\215\204~#\262\257\265"
+	.ascii	"$\250\373WH\215\t\372Ru\3208\246\317r2\375\200\232\3631\204h"
+	.ascii	"\276\366\363\2355W@'\220\312|\376\322\312w\2433=\202\033\373"
+	.ascii	"\274*\3633\333p\3177V\271\001D\324;\346s\343y\275mw\334\363_"
+	.ascii	"+\347w\320\224\231\333t\317/V\271[w\350\017\f\323\371\257\363"
+	.ascii	"\3716\353|~\345\234\214\341 \335\236sN\235\357d\313_(yh\033\256"
+	.ascii	"\371C\352\335\374\033W\236@\f\220:m\376\323\314+\374\311\202"
+	.ascii	"Y6_i\336\315O^\247\3157Z\271\204@]\2036\266\311\277\3521\314"
+	.ascii	"\346\363-\347io\274\354\270\346c\361"
+	.string	"\n\3245\267-\327\374c[\357A\325_\220VU=\257\326|7BK\203\266\224\376\022Z\211\365\310\325\310\226\023\305\246\370\355\254\364}\314|\003\302!\003\\J\377I+E\022\372\005ZJ_i\345\\ML\242\256\315'\265{\0333\264\224\362=\201\265\333\262\001\200\265\261<\333;\252?\322\204{\217\352\213U9P\252\347Z\252\347V<T\317\351,\325cQ\305\f\276i\313\223\016\375\002\267w\361Cw\374\315*\177>\177\236\244!\343W\252:\343_n9\361\253\326\333q\361\003*\304V\331x\361+kg\374J\232\023\303\322\370I^\363\342\037\214\262\250p\353\305ox\227\266\006\215\377\255\235\361\2774'\242\275\251\355\270\370\371\025O\374\334\232\215\247q\323\202\3172c*\370,\245\004\177\2449\200)\214\3346\034\002wy\340\373\327\023\376%\325(\374J\264GjN\300nQ\232\023~#Z\316\240KLX"
+	.string	"\370\207\324\033\376\037\364\024~\037Z$\374:\256\034I\217\320kc\341\267q\335w\340\247\221U\345\006\256\332+O\370\237\264|\023\3623\364\025"
+	.string	"\376\0013W\022\344;\324\204\277\251\346\001\200\353\250Q\030\006\265332\"#\232$I\007\240\002\251\231)n\003\021\200 \350\234\"\201\214\004\022\220\210Iz\250\270,H\235K\205#\344\327[\312\006\274\226\357\270\324F\b\r\021\343#\363\344|\344\323e]\337o\0017\334\216\370\361\331\021vR\025\3373\331\3505\230\312xXK\355\2377q/\b\362\016\213\326\262\337\345(\3461/\332\360\237\366\005\314[z\270\007\302\351\257\003\251\032\243\362~\351\013\335w\273g\306.zj\221\312\373\220\246\343\001F\230\002\210\241S`\354\374\356\022\257\207e^&\307h\f\242`\007p\004\006\307\346\355\300\245C\"/\362\022\305L\2402\231\300j\\\331\241k\364\224\336\022\324\277\341\373\230\334_\212\2247\270t\320\327\211\257\366\243\tBV\253\330Vt<9\305Sm"
+	.string	"\260\253?\t8\253\330]\205>/\034&V\260f\020\030\230\023\265\003\351\313\326\262\301\353\377\272\034\322Fg)\263\2534\315\370\004#\177J\016D\274\215\2058\267\276\372\277\274\277\357\307\377\365\375\274?\377\227\367\367\375\370\277\276\237\367\347\377\362\376\276\361\200{\271GL\300\262y\254\313AWp\214\007\r\335\003\005\203\202,+\034\301\3500F]%f\320p\321\342\214\031GQ -\262\024\345\200\306\244\261\315\257\211\323\0160J@vea\004o\3026P\300\216\346B\230\312Ct\222}\031\344\025]\227K\273Y\210\201D\006\322\230\204\345.\333=3"
+	.ascii	"w4\2058\300H\225E\203\247\237\t\226\fY0\205\025g\340%\350_\210"
+	.ascii	"M\036Z\036\340\243#\360Io\017XR\231i\216\265\363\363\320s\007"
+	.ascii	"\203\004\236W\231W\221\006"
+	.text
+	.section	.gnu.lto_.refs.eabcc68afd87291b,"e",@progbits
+	.string	"(\265/\375 \3665\005"
+	.string	"\"O''\220)\031\016K\354N\330\377\377\377\377\377\377\211\203\275\326?\276\020j\253X\352&b\305\377\215\354\302M\221M\332\336R\246\177F\371\027\375-*\312\247\350O\224K\364#\312!\372\017|\207~C\237\241\277\320\237T\276\240\\R\376\224\017\224C\312\035\345\r~*\025\236\003\320v\320/\356\007OH\223\331cF\340\253\214\262\347\354`\017=\331M\267\243\233\351/\374\304\r\0327<\262)\353%k?\316\023\254\207\360\001\326\336\272Q+\305\027\305\023\363T\\\322\343iG\320\026@\377 \207~\214\001"
+	.ascii	"d\004E\n"
+	.text
+	.section	.gnu.lto_.decls.eabcc68afd87291b,"e",@progbits
+	.ascii	"(\265/\375`\202y\005\347\001\372\032c\253S \020%\225t\377\343"
+	.ascii	"lN\365T\375\325]\327\207\335\355\336\256\275\277\273U\263\375"
+	.ascii	"\325\375\325\177\177wU\377]\377\367\377W\245\006\275W\323\252"
+	.ascii	"~\301\372h3\377Kj\177FUbv\227w4\373\333\276\300\275=M\3658\316"
+	.ascii	"\037\240z\317\374H6!D\222\275S:\t\250\n\t\013\277\305\273B\324"
+	.ascii	"n\020\313g\357\316r\343\270\022$\307um\034\0013\304\375\337\256"
+	.ascii	"\337\264_\264sj9\305\004\355\314\305N\211\022\265\333\327\314"
+	.ascii	"\002\177TN"
+	.string	"\267\177\326\300\377o\021\213v\215\030\271`\267\254G\205\302b.\254\231s\266\351\300\002$ZC\335\377\025\373-\373\257\327\375\272d0P\035\304\004\215U\021\272}\227w\314\242}\311%r\313\326D\270w\3737\017\327`I\372%\351\r\273\371\025K\r\003Y\234\335\236Q\202q\2665\251\315\226&\275Cn~\273hR\244\245e>\3139\317\234nH\202\bo_$\370f7\374_ \267\310J\311rZ\362\203-\246\206\021)+[\026\320\0226\t\016\361!\003,\006\330\222\326\235\302Pl\264\210\222\365\275\3333&$\tV\017\231\034L!Az\360pB\304i\305m\273d\346\256\355H\357\266\323\305a\245C\307\335q\255,\032\325\255\272W\327\350{W\367\352\3468S\006h\231\223\354\024\253 \271\346\245\022\270\325\206\333\332\244\335\0331=\004cD\335\376\375\302\267hwJJ\246-\212n,\352W\352|0\031"
+	.string	"\247\016\245\263\260\333\377\273P\377\327\027\034G\246\202@\331P\315\240\024\332\270L\315\327\342J\360\366}\272[\370\277M\267F\026\223\025\267/\323\ndo\317\347\366o\0256\372\036"
+	.string	"~\206N\360\2017t\213"
+	.string	"\3603tB\230Z\337\027\213#\377}q\225\356\322\235qa\\\0327\206E\2732\376{t\221\\\234\335\026\026\020"
+	.ascii	"?C'\270\245\365\345\274\2742nR\017"
+	.string	"6\031\326\314\262\331\273\245eV\372\260\246$\327\314y9#$\005P\017C\377\032\341sik\322\020\226&\375\035\302\277>\370v\020\337j)\"\232\361\202\221c\307\362+\347<\263\276\r\002\211q\373\266\017\377W\350\006Aa\261\351\335\376o\320]1\244\310\224\237\3336%hb-\335~\t\277\305\323KC\373\212\223\263H\304\372\360\362\214\240\201\365\205\215Y\267\020AH\253\022\242\263\262+g\242q\365Q\261|\347\030\0226\2332$\t\224\277\205\bB\342\200\215\b\254O\360\366\334\037Kh\r\257\317\005\262M\273\305\016\332\303\233m\240E\263\205\026\313m\026\353\007\224\304\026Z%\326I\210 \244\265\356%L\261l!\202\220\326 \253\256\276\234\227`\205V\213\005\f\021\204\264\026\021\241\365\345\274\354\343\"\022\345L\031 \f\031\310\352+\313\212\025Z)g\332\273\263\rL\361\352\3139w\260\351 #\3304$\006"
+	.ascii	"\300\277\364l\007\221\217?\213\345.[\230]\335\276\255\202\325"
+	.ascii	"lk\322\3675\301\267I\360m\034\266U\254\025\213v\246\335\373\n"
+	.ascii	"\264\314e9\347\231\027 ?\200"
+	.string	"Z\334\2765\303/\344\234\263=3U\017\017\017\017\355\231\351\355\022\337r\341\333-|k\205ok\340[\027\030\004K\223\336\006a'tOl\023{g\321\254\023'\326\314\332\365p\313y\351\004\216(\254\317\246C\207\0316*\\\203\270\177k\307\004\343@\213ax\333.9\367\332\262\006o\177\006\370\277E\263u\313lc]h\255\250\273\375$&\001\t\2229\313\264t\026\315\"A\202\333\210\304\372H\340/-M\372\022\376\0337kf\331dz2\344|C\207[\316\313[\"E\316\224Ys\226Rs\3139\377\267o\266\315\302Y4\353\366[1\273\274\3152g\265\234\363\315o\311l\231u\263F\316<\307\2202\020U\331\207\036f\220S3\347\334\241\203M\007\r\224\3758\302}\213f\331~\353e\277\354\3329\324\002*\237\345\274\314\260\201 5\252\334\266G\254\332\355\232M\373\007\023~\366\020\311_9g\273\326"
+	.string	"\250\234}\354\332\fa\316>3\326\022\300Z\002t\327\024VZ\332\277"
+	.string	"\276=\273"
+	.string	"|\262\t7"
+	.string	"\276"
+	.string	"\360;\300\227\301 \330\232\264k\322_l\263\255I1X\232\364n\226&\375\235\245I\277\2645)\2664\351\331P\035\250\t\272\347\006\232\202\334\377\326\\\030\340G\003p\rD5k+\334 \027{B\n/\264\237E\277W\302o\317\232\005\374\337B\023\302\177\300\f\006\370Q\231\277\217\374\027D\355\232\016\340\177\223\205\227\016\032\304\271\2464\247\232\316\\B4\246/p\336\024\375\177X\202\376\200\302\240/?\352\362\243\352oq\b,\250\335\363\377\032\232\376W\002W\300\217\016\342\377ln\266K\260+\362\034\374h\035\006\036\026\357\036~\264\355\277u\277][\353\352\217\222\375\347agmp\300\f\235b\375\335\2431\360\370\255\225\337^\371{\303o\361v\334\251\377\336\340\373-\026\035\377\215@\207\360[-V\326\320\016\332,\277\335{\bU\004?\202\037\035r\245\203\004\307?\372\301\177I4\320]~\224\306n\255"
+	.string	"}\304\274Z\200\235\223\257\240s\026\342P\252@{\025,\212&\201\300\342\277ca3\370\357\013\276T\234\205\237?\372\002\025l\332a~\264\304\337U\177S\375\327\307\373G\215\277\005A\006\354\tR\177\217\270\315\217\022\377\323\311\177\005\320PG\1774\005\377M\263\361\337\022\272\316\246s\357\344\373\373\351\2775\332\351*\271\320M\377\031\370[\265\256\361[\017<\360\3424S\363\252\360\333\024\254\b.\022\nM\343\267'\234\005\274\373B\332W\360\2434\254\335bKh\373O\267\277\227\316v\370\333\276\206\265\rG\350'\360\243\017\370\357\214\277g\374\027\001-\203\203k\3261\202N<\333,|\317\2427\341Gc\374g\325\177Z\375\r\343\277\334\177W\364\213#\271\235]\255=[\251\223\376S\310o\341\032I\205k\370m\tO\301\3559\352\023\274u\220\022\212"
+	.ascii	"\333uI4\320\177s\364\3179\367\237t\177\373\374\335s\232\037E"
+	.ascii	"\341?\217Z\006_\377\216\373\255\214\277c\360\333\031\277U\372"
+	.ascii	"-\330oi\374\007\374\033\006\377\231\374[\305o\205~K\203\377\234"
+	.ascii	"\301\337/\374\026\350\267*~\373\365\333\241v\001\307o{~\033\366"
+	.ascii	"[\252\240\377\212 \366[\037\377\311\342\357\024\266\3552\001"
+	.ascii	"k\215\342\267^\350C\374'\212\336\371[\347\277\037\234d\177\227"
+	.ascii	"\370\317\263vA\237`\356,\240'\300\217\336\374\267\373-\001~\273"
+	.ascii	"\200\337\036@\001\226\303o\031`i\n \002\372\016\376\376\371/"
+	.ascii	"\370\377\355\267\377\337\366\177\356\267\367?\363?A\370O\002"
+	.ascii	"\374}\374\337\344\377\340\377\273\007\332\0174\3746\303o9\370"
+	.ascii	"-\215\2659@\223\370oh[\204\036\361\333\r\026\275\b\177\013\375"
+	.ascii	"\017t\321\264\366\177\341o\333\370wN\237\300h\303;\374(\001\036"
+	.ascii	"h\201nA\023\377f\301o;\330\340?\033p\265\337~\200\366\333\262"
+	.ascii	"\337\036\371\255\331\1776\375V\255Q\360\024\374W\241O\360\333"
+	.ascii	"\r6\355\007\370{\356\267C\232\004\377\003\3777\177\3336E\377"
+	.ascii	"\362w\214\277Y\370\317\b\364\n\177\213\340\277\032Z\205\337\256"
+	.ascii	"\360_\020:\205\377\374@\207\340o\020\374\227\203\336\300\177"
+	.ascii	"\236\340o\r\374'\013\376\316@c\340\267,\374}\201\337\256\017"
+	.ascii	"\300\337W\366\204\333\0258\n\276w\f\177\243y\340\377\236=\341"
+	.ascii	"2\177O\375g\003"
+	.ascii	"\232\002\377MAO\340\267\037\370-\n\277\005\301u\032\002V\205"
+	.ascii	"g\370\033\354\277,`\365\003\376\323\005\035\342o\020\377Q\240"
+	.ascii	"\363_\025\374\217\371{\310\337%\374\335\341o\016\177\177\360"
+	.ascii	"w\206\277\325\277\377\237\202\377\311\367\237x\377\371\344?\351"
+	.ascii	"\376\323\355"
+	.string	"?\321\376\223\354?\271\376\023\353?\255\376\323\351?\221\376\223\305\177\n\375'\r\3763\371\237%\376\223\370\237'\370O\020\374g\007\3763\002\377i\302\177\"\340?\t\360\237\036\374g\315\177\322\374g\206\377\234\371\317\227\377\\\377S\375\317\373\337\302\377\356\3757\312\177\235\374w\311\177u\374\327\350\277D\377e\3767\356\277j\377M\373\357\331\177\213\374w\354\277a\377\375\372/\327\177\201\374\327\307\177\261\376\313\343\277W\377\275\361_\252\3776\375w\351\277J\377E\372\257\213\377\026\3757\350\277*\376\373\202\377\"\377[\342\277\307\337v\3757\347\277,\370\257\n\376k\202\377\222\340\277\"\370\257\007\376\333\201\377n\340\277\031\370\357\005~\373\367\333*\377C\370\355\t\277M\341\267\033~\313\200\337\366\177%\360\037\371\333\302\377F\340\277!~{\200\377\226\360_\022\376\353\341\277\f\370\357\002\376\333\341\277\b\370/\b\377U\370\257"
+	.ascii	"\376\213\341\277\037\374\327\346\267x\277\305\372o\007\377\325"
+	.ascii	"\360\337\f\377\215\371/\314\377\277\377:\377Y\370\277\367_\365"
+	.ascii	"\277\375[\303\337\256\277\035\374-\340o\375~\253\345\267I~K\367"
+	.ascii	"[\270\377k\277U\373\355\330\377\024~\273\374m\t~K\202\337\212"
+	.ascii	"\340\267*\374\266\001\277-\341\267\037~{\363[\022~;\302oE\370"
+	.ascii	"\277\302o\321\337z\370\355\007\277M\377G\375\257\373o\302\341"
+	.ascii	"\341\341\341\317\001\320\0373\366\227@\204\350\r\233\221\256"
+	.ascii	"0\231:z\203\211\203l<\331\273\215JY\300;@\033v\267\321\2503\361"
+	.ascii	" \232\030\336m\024\352L\265\316n\312\306 >\314\023\2142\241L"
+	.ascii	"hS\017\026\022\266\232\2405\21661c\374\322\bY\300\244"
+	.string	"\2410P\030\350\322\036\225 9.t\306\321%\035V\212\232\267Q\031\026\020\355:\363\243\272\215\306\270EyD\230\250\301\200))\235]7.`\2460\212\204\"u\032\316Wv0.Z\240.Z\234]F7:\273lF\312yI\002`]Yyi\211\303\f`aY\335\355\303\374\340\277`A\207\320\"t\250\247\244(\021J\324Sp\217\rX\323\022\007\027\035W+\374\222\340\277t\r\242>\203hP\272\342h\320M\240\237\214\333(\320\375\321$\257\320\3516\372CH\210\366\340):4\037\355\341\2139\334AGx\273\017\357\017\027#[x(\335nC\252\237\031Nnw\341\345\322f\\O\323\013\026\376\213\223_\007\372u3\0019\333%\324\021R^B\342\320ZZK7O\350\021\272\262\345\335d\212`\032Ru\273\001\377^\224\360_2~_\261\215\005\313\337l0d\026VvY|\370o\366\002\345\354c"
+	.string	"\264\247\310\r\"\267\337Vl\363\361\375\315f\231y\250S\232\004\3115]\356\3605\200\f\017\257\247\035\267\253T\351\264*].nzz=\345JW\220\034\227\224\367\024\276\373\004eD\353vG\261\200./"
+	.ascii	"\275\234\374\270\273k\274(iYP\336x\226\320E\026\334\355~\202"
+	.ascii	"N\361[qw\273\235\2349\244\260\206\034\337\377U\225kC\342w\373"
+	.ascii	".V\270\355\332\256\337\250\226\202\344\232.NI\222\364\022\262"
+	.ascii	"\036u\357%{\253a\341\021\333\355V\362=\242\236\"\026.Hss\035"
+	.ascii	"\225\"\255.\246\324\365e\244\345\002\356\342\023\027\327L\233"
+	.ascii	"\207\246P\t\222\343\312KY\034\376\226{3\235@M\241\273\375\230"
+	.ascii	"/\254(v\267\277\022\252]\255\337l\3169/\3453\312\216 9\256v{"
+	.ascii	"\277u\241\330\017\225\333\377\353\266\"\031\315\"ml8\300\240"
+	.ascii	"\206n\333\n\303\t^`\257\255}hh\235v\305\324i\350\223\037=\322"
+	.ascii	"n\177\255\303\177\233\241\265\331\231\026\t\233\021%\351\313"
+	.ascii	"Hy\001_\323\212\024\271A6\313\254\364bE\347\266\200\257`\270"
+	.ascii	"\311\232\fC\376\3313\312Z{\340\016\353\260\036\343q\326\313\367"
+	.ascii	"X\f\200\226Gn\267\330\251et(\267:\341\277\301ng\250\005$\252"
+	.ascii	"\353\375\365\367Q{\241:`\260m\271m\271lM\332Bn\336]1U;\202\264"
+	.ascii	"\005\021\322\\cM\b\207\334\266Y\266&\345\300\322\244\r\344\346"
+	.ascii	"\035d\306\251G\317\322\355\232\255\367\217\027\242'M\030\267"
+	.ascii	"\333\307\315{K\325\021\005vu\373\003K\223Z\264\316\272n\032\220"
+	.ascii	"<\200\266\244ou\201\377\356\221\247\301P\006R\217\274u\205\223"
+	.ascii	"\024@$$\200O\206\354\270\222\221\302\364CKU[\265\016\031%8\346"
+	.ascii	"\\\334\266P\266&\335\200\352\346]u\244\256\020\3536\215\245I"
+	.ascii	";\307\3377\032G\332\346\365\365\342\366E\2625i\001,M\332R7\357"
+	.ascii	")\224\n\025?(\267\t`i\322\206:+L\272q\373x\020\337\242\265\215"
+	.ascii	"~\3022\263\321\304\351\3754\b\230\006\344\366\377\316\374\277"
+	.ascii	"v\2147/&L7\254k\324%\2012x\373M[\223\236W7o\246\303\3038\253"
+	.ascii	"\246qf\345\273\0340\320\032F\3178a\231{T+%Ar\315\214\204\264"
+	.ascii	"\200\277e\274gH\031\"\224\273\3351n\3362\242x\034\301\335>\216"
+	.ascii	"\202\373\205][m\300\250\361D\251\223\370\246\340\bow"
+	.string	"\222\252vw%\351v\037\335\274\2210T\020!S\267;patB\013\030\225\242\267\321\337,\272\305\036S\230\216\333\266\317\326\244\002\2604i\023\335\274\213d\206\3648\365\270\035\200\036\022B\377\232\200`A\026\255\205n\347\302\366B\306\325\355\233\233w\220\330\340\330\\\257h  1\222\220n\377\335\323>\375\263\306<tq\033\204lk\322\316\226&\355|\363\356y)Z\202e\345\366yxx\032\n\031\273\021tO\303\377B9\013\033\307\023\025\033\267mlM\372\237\204\203\253Z\241]^\340\317\301\337\306\235\2020VJ\266\336nw\2665\351\331\274\371\031h\006c\311\311\355\nl\001\264\207qJa\200[\034\226|p\177\247\226TO\252\247P\213^\327\216\247\333/a\312\025\"z\202xM,\233\232\237d\213\204\247U(\006\345\314\013\241\224\355\220\026\255\3012\rh5\263N+g\224%Z\201}bw\347\023"
+	.string	"\374\f\235\240E\230U\345\304r\356\235}g\226\223\357\274r\372Y\264\323\312\271\3446\311I\305\312Yw\332\235K\255\234o\354HmL\311\001\327\314y)\023\305\024\365BC\237\370\f\037\207\341c\037\3708\007\336\275a4%7\341\343\244'NN\257\260@&'\247\017uJ^\024\263\333\307D\370*!\376O\273\223\211\205\321\244Tt29\227\300\bQ{#r\373\252\037\276Z\005\377\247\222\253v\232\345\025\351IB\347\342\343\356\210\026&\222sn\006\t\357\312\216\333\030\262\255I\257\334\315OfQ\221\226\226\3336\356\204[\021\366\342\307\355\023\356?\335\3167\273\326\2024\243 A\267;/\263\245IO\266\233\237m\247\201\t\213R\303\350v\005\016\317\265,2tL\335~\tF\3163"
+	.ascii	"\374\f\235\300\365\224v\252Y\264\363\310\211v\0369\311\316\""
+	.ascii	".S\315A\267f\2075\216I\022\255\264\257V\231\335\205\025\213\241"
+	.ascii	"\333Wm\340\253K\370,{X[\f\301\333W\213\360U\037\374\237D\276"
+	.ascii	"d\016\310X\317\355\377\034\373\322qn\311\2409\373x\271\235_g"
+	.ascii	"\323Y\025\"\b)\005W"
+	.string	"\210\372\276\316\242\223If\3159G\230\333\371u\225\234D\347\030R\n\256\024\201\235a\247\330\271<\275\316\257\016\035<@\321\237AN!?\271~r\235]8\347\334\263\314G*\326P\220\\3/!q\370\317!?\273\356\023\25156\300\377+\013\340\016\263\334~z\005\377\267\277\177\232}\220r\316J\3502#\375\300\244\277\275E\255\345\360\307\330\323\026\340\177\347\034\200\0219\367\3545s\316V\013\336j\363\251q\373?\b\031\275\313\031H\252\307\002RI@R3\206\312\244\2222\f\225I\345\036\240\036=\031\220\262T\317PY\316\031\200\200z4"
+	.ascii	"\2254T\346\2233\f\225\345\244\274\342I\222\315K\251\236\f\004"
+	.ascii	"\2253d\240\354\223\313\240\222@\030\002\222J\032*\363I\3120T"
+	.ascii	"&\225\224\313\2442\206\f\344\203D\004\224\2212\3442),\271\f*"
+	.ascii	"\t\303P\031T\322P\231\224\223}\032\002\264K\262\322\234Jb\243"
+	.ascii	"\206\200\262\013\243&\037$\fwCK\250,%g{\026\224\221\362]\316"
+	.ascii	"\005\310\271\t\nI\212\317\f\353\366s\347\342G\315\007\312.s\316"
+	.ascii	"\036\030\375LAe\240\273\036\233\357\206~@\345\374\343\207D6\312"
+	.ascii	"9\347\006\364,\357\262\225\275\353\271\321\224[\004\345\274!"
+	.ascii	"/s6\312\271\307\346\273\234sO\316YEjZ\346\314\204a(\313\310("
+	.ascii	"\347%\033\243\334\324\363\026\224\363=\243\342\2264T6\005u\363"
+	.ascii	"f\244,+\013-{\354P\013\250\234\225\245H!\341\262\236\261\334"
+	.ascii	"\"\347l\375pV\322\213,\267\267N-\034\201}9/\317\255\223\307\231"
+	.ascii	"%\323\263\314=\304\252+\206\\?N \026\355\334:}\334e\316@jQ\326"
+	.ascii	"P]\332O\307\360S!\370\314\372\317\253s\307mQc\351\312\355\263"
+	.ascii	"\307\315O\254\213uVWw;\006\013\277\317\326\2442\226&}\272\003"
+	.ascii	"\377Z\371o\316\252\023\352\234:\227Y\0340;:\251N\2533\207E;\253"
+	.ascii	"N\034\277^\367+\313Yu:\275\216E\224\245\252\363\306\351\363\002"
+	.ascii	")W\f_\266\354\260\222\005\367Q>|\024\017\377\247\324\317\251"
+	.ascii	"\377|:m\330\265\026\004\300\247\216y\373\214\272\371)u\032\033"
+	.ascii	"{K:n\377o\016\253Y\266&=\240\245I\217\252\341\243g\370%\304\240"
+	.ascii	"\272r\3228\227\316\031g\r\213v2\2352\372d:Y\234-\316e\326Z\024"
+	.ascii	"\205\260\217\3514:_\234cH\370\210P`\037\323\t\343\036\312\370"
+	.ascii	",3R\r\206\316\036dS|\270\364\321/|T\013\037\255R\262h\347\213"
+	.ascii	"3\251\354|q\2728\221\254\226\236|q\271\324XB%\324}\024\352<\212"
+	.ascii	"\241c\362\026w\373\250\f|\364\b\037\r:[\004\240\005\271\203\225"
+	.ascii	"\256\n\230\226\333\357B\374\016\304\377O\240s\305)t\016\235A"
+	.ascii	"\026\355$:\177~\351n\222\367\265r\013\357\341\271t\303BS\216"
+	.string	"\372r^\022\336&K'\321\231O\237s\351\206\213\254\\\234D\367\356\n\236cH\353\021+\032}'\321\255\273M\354\335Y\366Iz\300\213\252\245M\207#c\207J0\375\266r\366\250Euy;n\277\357\360[\016\033\236wI\200\270n\277\323\360{\211\337>\004\257\223\273\345\034CZ\215P\245\365\rZ\264+x\0035\320\247\003\252\373m\205\237\334\274(hY\267y\001\357\237E\273[z\231\263\232\336\345;\227n\253\221(g}[\356\225\253\305\336-e\037-\016[\232O\276<\350\320\341l!\003\310\bk\361kA\316jJjd@n\337\276\213\305\242\005\340fY\316\304\030\0161\034\274\375\016\302\267\001H\355\241\r@\372sP\312/\337\236\225\321b\342\204\344\366\235r\251X\264\020n\225\337!\327\312Q\237e^\346\274\234\271W\205hd\2671\330\232\364g\026|\033Bz\036\036\332\020\322\033\345\346W\212"
+	.string	"\326\230o\267U=\374_\274\337\274\333\344Bu\220\nan\371\270}\241\334\374\342\235F\002W7\272n\237\226&\375\251\004\377\204\303?\317\360]r\231X4\016\327n9\263\352\3719\235\335\376)\206o9\2443\034\322\237Z\370\347\016l\357lM\n"
+	.string	"K\223\376w\216CL\240\336\017\027\022f\227\022)\243\333\267h\227)W\366\344\246w\373\312a\303)6"
+	.ascii	"\213\376\2573B\006Y\350\301\2415\023/\006\22277\030\032@\216"
+	.ascii	"\226\334\276m)\025\026-|\334\376)\205_\202-\222\307\247v\271"
+	.ascii	"nZ\210 $\016\3445\373r\316k\367\310e\263hW-e\230\310Ks-J&K\233"
+	.ascii	"\244Q/\006\321\360\330\013\r\033J\366n\237\003;\374\343e\277"
+	.ascii	"e\030!s=\274\260X\n\344N\354\320\352\206-\311c\373\242\273\215"
+	.ascii	"\275\316\032\034\036\036\036\022\346\354\203\275.\006\303_\307"
+	.ascii	"^\237Q\245p\r\371\244\375\343\256fBY1\3674$\255\002\246d\330"
+	.ascii	"v\033\013\2718\b\346:\026\202\201\374\203\t\207\001\302B:g\037"
+	.ascii	"k\t c-\001P&\017\037\262\264\317\001\335\216\035x+\211i\013\206"
+	.ascii	"L]`\026 >\216\267\356\b\005\251\264\240\214\b\355\264p\326\333"
+	.ascii	"\r\026x\267\261\346\226N\205\267\317A\034\306=0\217\035wJ\270"
+	.ascii	"n\237\2034|\016\312t\374:*@%\f\t\027\213\247 V\267\317\301\027"
+	.ascii	"v\302N\270\312\022\311G)\023-\007\034\227\326Z\263\b\246:\256"
+	.ascii	"b\362\331x\002\274\215s`\034p~X\374n\343\033\030\207\030\032"
+	.ascii	"\363\266\213\024&\241-\2671\024\236\242\201\265\005P\216I\032"
+	.ascii	"\231\024\216ry\212\362\311\2339\f$2\344\366\377\260\215'sM\244"
+	.ascii	"\220P\261A/+\370\351\264\373\002Zj\222\365\3428\306\013\\\303"
+	.ascii	"\022\311G6\206\022\365\311\207\f\314t\\c-s!ut\033\323@\255\370"
+	.ascii	"hj\271\215\227F@\226\344\3566\236q\346\232dJ\251\3576\226\361"
+	.ascii	"+r|N\002a\340\300D\307,0\021N\232@\021\206\271+\036H\307I\377"
+	.ascii	"\230\020\027F\267\361\321\2312Gy}M\267q\013\354B\311\02118\027"
+	.ascii	"\330\250\323\220n\374,\007\365~\214\340\"(\354s\f\204}\260\320"
+	.ascii	"M\215\2420$HvlN\267\177\034t,\364\177e\241\345\335\306+\360\017"
+	.ascii	"\r\302\253\206\2048\377\234\263\312\001\327\234\361{\301\302"
+	.ascii	"O=<\316~h2x\234v'\017'Qt\267\325\302\026}\357S\005m\240N(lsa"
+	.ascii	"1Wya-\002\257\n\342\300:\322w[m\236\231\307\344\323\272\255n"
+	.ascii	"Q\377\346\306\222\320\335V\001\325?\230\035G\250x\334V\261\250"
+	.ascii	"\177\352\325!\025>-~)\213\274\263*Z\256\372\005\222\211\305]"
+	.ascii	"\263g\261\rR\271\255f\241\001\303\310\321\331\355s\260B\357\252"
+	.ascii	"\024=\225\317\022\311G5\020\fC\302\025\303u\210Dl\357*\337\177"
+	.ascii	"\345\223$v[\265r\346\251W\243\n\325m\265\312\231\307;2w[\245"
+	.ascii	"rf_OS\336mu\212\032\003o\353\306\214(\202*\236\212\247\n9\351"
+	.ascii	"\bC\322\024\313\352\321\362Sru\t\023\365\211\rTO\026\t\bQ\302"
+	.ascii	"\327\364\352\261\302\313\311\325'M\254\225\231\031\335m\365\216"
+	.ascii	"\206\020\031K\232\354\225\3654\335V\355\352\224\344\270\273\375"
+	.ascii	"\2325\374\032#X\255\253\021\002wU\016N\245\033B%\fI\363\312\314"
+	.ascii	"\211\214\271\253tAV\264<\271\255\"Q\231qYG\216\250nq:^\b\365"
+	.ascii	"\366z\264]uk\312\370b\272\255\262]+@A\262\334V\327~\3052U\t\355"
+	.ascii	"\335V\325\256\212\\5+\242\242\331@\365`y@\222.\254\260f\231\340"
+	.ascii	"\320\226\263\253h"
+	.ascii	"\226\355m\355-L5\"\325u\325\253K%\353#\273\314K[0`\272\262h\371"
+	.ascii	"\003\273Jv\225\b \236\241\224\333\352X:\206\356h\"\\q\373\352"
+	.ascii	"2\346\354\210\215\305mU,\005{\221Q\206gx[\rK\305|ZX\225\335\276"
+	.ascii	"\207\302*\265\027\267\325/\313\306\305\"\315\257\206I\353\327"
+	.ascii	"R\271l\240z\262\200\300d\nC\362C\024dI\005r\225K\025\242\205"
+	.ascii	"y\370s[\r\362/\032\331\355\366k\224\260\372\343\314?+)\266\333"
+	.ascii	"\352\326\367N#&%l\267U\037)\217\026_t=5FWW{\\\251X\226H>R\255"
+	.ascii	"\224D\261k\346\241&\0160z]hZ*\226\\\216\2416&\267U\036\367\255"
+	.ascii	"\311d\344\266\272CO\265q5J\265\241Z\235x\352\021A\254\260\346"
+	.ascii	"*\024\244\310\356\306U\253\253U\037L\370\0362\207\021#\267U\252"
+	.ascii	"[+?#9V-+j\206\267U\034\352\324\367\214\340\2008\335V\245~%Fm"
+	.ascii	"\254\252I\205\262S\272\nCIu\272\351\202B'\223te\330\303t\325"
+	.ascii	"\351j\323\025$#M\267\257\326Pe\2504\340"
+	.string	"\200D\321\251x;\004\273\324%u\006W\324\327\220\3333N\264\3170\217`\325\335\376\237\032\003Oo\n\350{\347\333\262\002\027v[}\261\001\225\321o\244\"Y\"\371\210\004J\236\300q\345\274\304!=\242D\212\354\350*R\2135\277)\267U\027g\306\370+[q\373gJ\031\271p\272\375\rX\020]eA\244\nY\"\371H\004:\302\220\244\207rbHn\253E\207j\276\352\243fU\310\006\252\007\013\t`iaH\370\2300\n\325\240\253B\355\247%\210\323mu\305\231\177dc+n\253?*P\021)-<n\317\224U=\211\322X0dR\232\203\267\325\036\263\277\247[\376RC\033\250\236,$h\025yu5W\024\201\271(|j\270\344\321\344\351vJx\346O \221\262\333\251`:\350seE\357\312\373f\232?\232Tn\247\3154p\231tC\352\336\273\257\036U\267\377w\346\375_e\214\222t"
+	.ascii	"\271\235\002\322L\355=\305\262\227\372\265\\\023\207\031'D\b"
+	.ascii	"\221\262<\365\373?\230\020\002\017,\302\346\355\377\205P\326"
+	.ascii	"\203\t\333\355\264O\215\222WG\344vz\005\255\361\242\312\017\276"
+	.ascii	"%vYn\237\306\t\237\206\205\223\247P\234\244Uj\312\236R\247\264"
+	.ascii	"%\016\266I\r\311_\336\323*O\251|0\341{TU\350n\247QR)\351\224"
+	.ascii	"\177M\247"
+	.string	"`)\203q\3734\031\353\375k\312\005G\364\343\3665\354\341\024\357{_?6\226\236\344\325=eR\2276A\303N\031F\354\224\330=mB%K\317\317\355\277`\205\335hr;]\002\327\366\324\255-M\3222`r\017\206\345O\225\275\254<\264\304a\206MlKJ\334\323$O\351R\265*=\374n\247s\351X\007\232\326\n\221\270\360\371e\251\335N\231)\230\213\3342\315\307\355T.\025\013:\353k\273}\006\274\2105q\312\272\235\302Y6\0321\236n\247ohhO\217\240\245k(X\316?$,\177\244\250\200Z\250\362\324\236\256\275\f\0051\"$M\343\002\373\301R\263\026\262\313\274\224\266uY\244Y\211\021\366\324\354\251\221\017&\234\351\302\244\n\311\312\355\264,-\202\337\242t\261\335~J$%\373W\013\306td\305\355k\250\201\323\261\024\354\306 ]\324\355t)\202\223`\024\341\355\247bUOx"
+	.ascii	"\271}\355\231\251\006\030B\236z\t\351'\0329\233\374\003\224\237"
+	.ascii	"\234R1%WL\315<\304\305A\275+\242kr;\035\362\264\353_a\370\324"
+	.ascii	"v`\335\276\006\0268\345Z\225\204\260\334n\377<\232Z\341v\373"
+	.ascii	"\032\202\250\236ZQ\245@N=\265M\tVX\363e\214\305\230\223\254\247"
+	.ascii	"@\236\376\370`\302\367\270\202\350\371\334N\267.\263\304\004"
+	.ascii	"\256\357\366S\255\324\307\277\272l\341(\023r\373\031\242\340"
+	.ascii	"\213@DFR\322\355\024\353{\367\307^\013,\267\323\0360KQ\232T\267"
+	.ascii	"\377\227\362\260\233\202\362s;\325\221^Y\264\327\245;\276\234"
+	.ascii	"\221\201\023B\253\273\375\fw\370\366ui\r\354\353\322\264*\311"
+	.ascii	"\324?\225\342\260\201\352\301r3\204J\017\030\315\234\2278\240"
+	.ascii	"\200zJ\362n<\305\301\234\251\201#\t(\303WZ\343\251\215\032i\024"
+	.ascii	"\332\003\223{\210\344\243\324F\321\025\023W\036Z\342p\335\212"
+	.ascii	"\364m\245PO\243\370\376\270\336\006S\247\247O\377\272\302=\341"
+	.ascii	"\220\272\375\fN\370O\233\376UM\323\253\221u\373\031\226\3603"
+	.ascii	"\274\2301#\245\301,\272RE\212,YzJ\303\3625\320\016\264\254\f"
+	.ascii	"@1b\024f\305\220q\005&\341{\361\002mZ\233YEq\177j\267\217aI\232"
+	.ascii	"\224&\241M\032\342\252H\245\375e\265\031\031\245G\027*\316\256"
+	.ascii	"\357kH\021\036\251\213\247G\350\017]\216'\fb)\213\224\005\332"
+	.ascii	"t\302\006qI\204\252H\001\335>\006-\234\022\245D=%\356H\b\032"
+	.ascii	"\201/\242R\240\024(\025\3029\207a\257(\261\032AO\205\370b\236"
+	.ascii	"T\025\201\273\235\256\260\200\\T\201w\030\222\016\017S\037\234"
+	.ascii	"\227+\364\b\222\343\222q\323\241\364\"\355y\352\303'\223\205"
+	.ascii	"\212\362\3554\217\260d\224\003\303\212+W\320\3027\256\254\032"
+	.ascii	"L\252\245-G\013\217\022~0\341|=\266lD\335>*\210\016\376+\366"
+	.ascii	"\323\232\203\272\375\031C\2146\321\300\270 &\326\355\337\231"
+	.ascii	"f\b0Uh\320)\335\376\263\006w\364\270\215\002.1\273Rw\033\375"
+	.ascii	"\273E@Oza\267\377\207j)\362V\007\210jA\375\234\2540tq\333\017"
+	.ascii	"\355C\263\274\364\035\035&a\371\327\027\267\033}[\267?\023\005"
+	.ascii	"\177&\t\376\214\332\224)\350\236\315\233\215 \271\346%:\264\242"
+	.ascii	"\262rt\217O\245\353k\342v\033\255\002\023\025\210Dx\033\245\362"
+	.ascii	"+/\177\206P\3151(P\320(T\3166\276A+zG\2430q\213"
+	.string	"1$y\267\321<\274\037vv\250\223\n0\t\222\343\262:\274dD\335\035u\302\214\261\013\323At\033mR57\207.\221\003\273\322\267F\321\3721Wwt\t\025\254\031[\267Q%5\310\272*\273\215&\271E0UD[t3L\230\311D\343\016\263\f\231A\207\267?\023\304\306\206\306E\300J\220\034W3\350I\017\024\356h\334\371\346\210`\274\270\215\276Y@$C?\262\333\250\233\365\301u\244u\033m\2738\226\034\031\021\331\233\3231ew\3732\177XM\255\323p\006\262\006\203E\313\026\220\333\227\231\222\226vv5`\353I\006\315\314\f=\003!7\275\330\354\327\317\322\327\231\005\264a\366\023w\3732]ddh\221,$xy\005\3115U;\267*qeG\213t\024\372dDH[\224\323\222\024\241\333\227\341\201\217\212Yt\f\035c\022$\327\224a\n\013C\277l\316^=\272\347oK\321\355\313"
+	.ascii	"uu\241_7\347\234\263T:/+tG[\214\037\250\327\321\257\230\277\270"
+	.ascii	"'joBZ\324\255]\021\"\004\345:a\003\257\246 \271\246\314!\035"
+	.ascii	"\025\031\\\314\006B\005L\253\356\307\017\024\b\b@wC\016\373\362"
+	.ascii	"\322\022\207\230>\301\027r@\376\006\263\207%F\325\355\307\260"
+	.ascii	"i]\013\365\001B\3169(\277\240e\210`_^j\342 \023\345D\017\356"
+	.ascii	"6\352\343\0261[\2605\303\260\260\226\274\270\245\341\320\272"
+	.ascii	"\375\230,\036<:\355\001aAr\\[L\376V\334~L\016+\364\312\352\354"
+	.ascii	"\322\241\343\354b\"\223e\265|q"
+	.string	"\3731N\3701F\350\023\212\003}B\251r\034\245\262a#'\341a\003\037@\201\003\016\370\200S\036\345\t\230\234\242\221G\206Gy\"\007i$\302\344 \215D\021(Z0&\213-\304\030\223\305\026\210'P\224\300)\266@L\001\005\342L\016\322H4\246(&\211)\240@\204I\362\030K\360\024M\0201\362X$\201CLw\220F\235\243\b\242\372AU\022\325\034\235\035\342\013\322\004\n\235\035\034\"\017\n\034\342\213Q\247\205\2422\005QF\004\212\026\224<;$\222\304UIL\001\005\242K\t\234\035\035\"\252$6"
+	.ascii	"\204\b\021;D\342\2524&E\210\330!\252)\240@|Q\246\3001\346\354"
+	.ascii	"\340\020q\n(\020c\2149G\027\210.\312\344Q'F\004\212\026\210I"
+	.ascii	"#\017\214\t9\305\023Dbj\314\3311AD\225G\344\321\230C\2141\342"
+	.ascii	"\034uN$yv8\220\334p\022\036N\024]\360@$\272\200\270!\022]\214"
+	.ascii	"F\036\021Fe\321\310\203\363\242\352\354\354`\200\210n\340\003"
+	.ascii	"(p\2407\360\001\0248@L\001\005\"\306Q\032G\210@U\245q\304K\322"
+	.ascii	"%\007yl\241S\243\221G\004L\252<\261\343\242<q\022\036\224D\236"
+	.ascii	"\021\307$\221(\223\352\024\221#\216I\"\261\203\214\322\230\203"
+	.ascii	"4&\233G\231\304I5\005\216\221\247O\302\003r\347\250,\342\354"
+	.ascii	"\350\020w\220<<F\"\021\2031\305\216\t\023F\023\352Ix0\2328*G"
+	.ascii	"H\252H*@E1G\204\3228\002\346$<\350(\2218\"P\243\211\"\222\307"
+	.ascii	"h<\2414\216x1\232(\"K\340\354$\225\306\021/'\341AiD\036G(\236"
+	.ascii	"\340)zpbG\211$*\215\310"
+	.string	"\343\252L\"wpP\0207'\212.$[\310`\204\3011ItQ\352\240H\032y\2109\306$\n$\n\"\222\247\350\202\006U\311ST&5$S\340\034\244\221XLAD\036\225:G\024-\020\211\030N\302\303\3161G\231T\026M\360\354\210HE(\221G\236\023)\222\007\205\322\310\263\203\304\312\343\013\306>\t\017#\220G\036eRG\007\005\022\271\203T\225D#\f\216\311TiL\2320\232HO\302C\2162yD\242@O\302C\013G\235\034e\222\003\027vxH(w\220\252\210\242Q\247\215F\036\021-\203\201\032\fdP\362\354\250`T\026\225+(\215#bT\024u\214\032\330\t\301L\322\210\203SLWp\223\202\017,@A8\266P$\246H\252Hb\030QT\022\213)\210\304\030\021)p^\330@\fMNN\361%\211\3349*q\214H\344N\006F \2179H\243\n\312\023F\034\234\342"
+	.ascii	"\\0\"\225E\030\022\324\030i\214&\216,(\215#\220;\307$\217\261"
+	.ascii	"\004J\343\210\031\244\013;9J\024$\222\312#\362\270b\343L\006"
+	.ascii	"\033\023\220H\242\320\021\321\001\317\016\017\017LQY\324\200"
+	.ascii	"Q'\007Y$\341A\222\205\r\214\311\035\035\234\016tt.`L\261c\302"
+	.ascii	"\310#\200\034d\361\304\013F\"\2161E\206d\221\004\t\036\224<\305"
+	.ascii	"\023\036\222E\022\031t\212)x\214J$\n%p\216\312\f%"
+	.string	"p\216,(\223E\035\036\243\211#\013%p\216,\030\225\305\234\023(fF \217%pvt0\200\334\t\201\322\230$~\220\223Stqa\207g\004\316\216\216N\321\310\003\023\203\276\254\220cL\356\350d`\003%\022\305N\0060$aT\354\360(\223\306\034\031\345\321\204\021CRF\005\r#\222 \3009\"\213'hN\302C\0139J#\262\206x,\036\213\253\361\204\ne\t\234\235$\361X|\321\331\301\331Q\356\360\234 \036\213/J\"\322\250S\002g'\271\"\215:.\307\242j4QD\"w\220E\034\342\261\b\263#\002y\344\311\311)b\345\013F$\361XTO\302\203N1\205\022\007\005\21729B\322xB\205\022\002:\305\024J\242\321\304QI$b\034c\222\230B\231*\211\311\034\344\016\2161\211\"I$\306\340\030\223(\210)\224\352\005\224G\344\221\250\3418G\036#\3228\002\277\001 D"
+	.string	"\021\342\005\365! @\002\004HH\037\002\00277\020"
+	.string	"q\203\017\342\346\304kQY\314!\026\223j1yO\302Cr\204\244\362\330\002\003\214#\212<;\312$\206dr\035\201<\346\344\024O\300 G\034u\212\304d\222HtI\026\223'\362\230tQ\362\354\234P\225\3045\231\362\344\344\024wx\2140 \"\217I|,&O\020\310#\221''\247X\002g'\t\243$\026\223/*t\216&\212\"^\224D\344qU\362\354\234\330\021\201<\272\260\243#\002\237\204\007\344q\004\245\021yT\032\221\033\224\304\020J\344\021\205\032\302EI\004q\003\342\346C\t(\210\304\027\024D\020\310#\221\250\362\344\344\024W%\361C\tJ\344\021\005\3169\022\215'vp\222D\020\310c2\006\304\261\230l\245q\205\025V\2451I\314\021\221\236\204\007%\216Q\307\230\034!\251\"9\002\n\344\b\021^@\201<\352\210\320"
+	.string	"\020D\020!^\030\301\230\203B\007\007y\034\201'\211b\204\005\224H\026M\020sD\020\211kRyl\201\230\314\021A$\272$sD\2349\"^(\232@\225Hc\n#\232\201\230\0228\305\026tt\2128X\2114\246\330\200\313I\030apL\266\361\204\ne\027\225\305\034\024h25*wL\030y\322\021I\023\247\362\005#\262M\024\215<J\243\262\250L\242\311\021E\035\021\250\322X\002gg\005bNQE\316K\216\210\0228;\3114\2314\362\344\344\024U%\317\316\211V\"\215+\2549\306\024G#\216q\004I\243RE\0131*\224\307\024G%\316\005\224\311\242\016\214\022\305\216\321\304Q\251~"
+	.ascii	"'y\214H\2432y\324Y\221G\035\227\327|\347\204\221g\004\345\316"
+	.ascii	"\016\317\b/<E\0228\375\007< \003 \220 \004\035\3008\036r\212"
+	.ascii	"*rF@\036\213&Fh\341\250\263AQY\314i\022\312\021H\243N\252By\304"
+	.ascii	")\236(\342`\036\243\b\021(0`T\036y\\x\371\357r\264\252\315(\035"
+	.ascii	"\241\322\303\305\005Z\230\016&}\265\271\030\341-\230$R|\206\270"
+	.ascii	"\264pa\361\207\307\344\205\013\321]X\3747\212KQ\036[\226\252"
+	.ascii	"\333!lM\272\346\270\271\013\321i\300r\f\351\030\022\372\351\361"
+	.ascii	"a\272\375\273\b\271\004\305\314\270#\334\272\215\345\222\364"
+	.ascii	"\244\017\311m.\2575,D\020\322\352b\352\253o\353\307\231SgYxU"
+	.ascii	"\262\342\226\372\222\024ei[\337\2400\331\r\212-W2(^}xw\2016\313"
+	.ascii	":\270\302A\241\261Jq\001Z\257\254[V-.+V\303\025\313\352\267V"
+	.ascii	"Y\263\254\201.y%t\361Y\001W>\227\236\325\312\332\\\247\254\177"
+	.ascii	"\353\341*\270\026\256{+\225\265\317\345\307\242\255\203\230\307"
+	.ascii	"\327\274U\257\211\340\365Z\007W\266\020\316\245\033.\"s\212\253"
+	.ascii	"\263lC+\020!\337\233\n\223s\321\227\363\222\t!\327\220\265\353"
+	.ascii	"\007\354z\231\255i\366n\tC\006\"\263\312\272V\326l\316e\226j"
+	.ascii	"\006\345\251/\347\274\212\225\255FB\004!\255BSC\372\240\360\255"
+	.ascii	"@\202\244<\310\304\372\300\230+\035Y\013'\315\254\234\227aJ\246"
+	.ascii	"\210\372r^\376,\374\257\327\377\301\204up=\262\252\235\313,\325"
+	.ascii	"\310\217\215\276\234\263\330\223+Yq\353\340\272\304\262\025\256"
+	.ascii	"[\353\340\032\245\257\354\335R\316I \f\271\352\372\321\354\200"
+	.ascii	"\342"
+	.ascii	"\355\020\214\223@\377\203\036\034\263\2645\251\245\2634\3517"
+	.ascii	"\b\342o\330\303\337p\207\277\001\016\177\003\031\376\006 \370"
+	.ascii	"\033\250\36070\341op\201\277!\343{\320\207\357\001\024\374\257"
+	.ascii	"t\353\034\366Y\223k\262\316\255H\304~\226\222n\337\003:|\017"
+	.ascii	"\332\360=8\303\367`\211\357\001\027^\335\230\344\250\262\342"
+	.ascii	"\366=\310\302\367\340\006\276\007K\370\036\020\341U\315\256\265"
+	.ascii	"\240\203\027\200~\016o\337\346\020\377k\332\212\006\267Egu\233"
+	.ascii	"o=\373\177\230\017b\312d\310 \273}\033-\3706|k\021\265#]@\267"
+	.ascii	"o\203\207o\263\004\377+\331Jd\006\260I\336r%\262\216\341\365"
+	.ascii	"\255\271\341\333\230a\213\024\266\202\235EF2\242\254`\353\227"
+	.ascii	"L\333\023\023\311\355\333\f\301\267\351\201\377\265\253\207\332"
+	.ascii	"\223^\321\355\333@a\013\365\002\337\246\005\266Y\226&\275M\020"
+	.ascii	"\266\313\325\007\272D\005ES\230h\341\214\n\001\222\345I\226\220"
+	.ascii	"\325a\265Bj\305\352!8n\b\365\300I\326\354\305\025%\036\270\306"
+	.ascii	"\013\024\033t\315\035\350\r\\\304E\020\253\253\376:\231\252\314"
+	.ascii	"\375\320\201\253N\034Of\203Vk\325\037\225)!\034_\253\3765\307"
+	.ascii	"J5\004$\365\3436\t\266&M-M\272\336\270\371\212CJ\322[\214\333"
+	.ascii	"\250\245IW\251U\252\337lF\3123\f\222\343jF\251O\274\306\370\240"
+	.ascii	"~\304\020ji\006\332P\371n\030\236\326\217\247&\247\246e\252\353"
+	.ascii	"\njR\005O \254 \263\032\215\227\026\332)maJk4\032US4T\267\266"
+	.ascii	"\037lk\353R\216F\022X\203\310:\003]\212\302\002Ok\225\201\236"
+	.ascii	"\331\325\005\302\2551T+\027^\2039`\240Ah?\226K2KQ\f\261\254J"
+	.ascii	"*\026\025\277#?k\222\312\265\\\207\326\241\365h\252\212\213\257"
+	.ascii	"GUD\224D\335^\215\356\217#ZyB\267\327\026\227S_L\351)\271\275"
+	.ascii	"\262\270\334VZa\340\355\265h%\352`\017\257Ak\020\352\344\204"
+	.ascii	"#\301\016\340\360\277\256\350)\353\226\r&q@(\325\005\022gd\375"
+	.ascii	"\241;\255\016\345\374\f\r\327\036\025\213m\315_{@\320\020\232"
+	.ascii	"\273\215\017-\340\251\370\242t0\206\177\\\250\"\215@\356\213"
+	.ascii	"\007\341\371\"M\311\017\267%\b*El\202\251\037\212/\0325\002\257"
+	.ascii	"\340\007@\037\252\246\241\213\214\025[nlQ\205\\\226\b\221\336"
+	.ascii	"\260`\301\177\253\002t\b\3125\363\022\f\016?\326r\374\207\375"
+	.ascii	"\320\263)\177b~UgM\276\3338\213\225\262\321B\307\355w \204\317"
+	.ascii	"\001!\376\361\225\343\276\253D>\230p\246\t\266`\030\335\306|"
+	.ascii	"i \024-/\334\366\272\tf\ni\n\016+d3PA,\254TQ\321bbL\031e*i\224"
+	.ascii	"\372\304\356\206\331\224\024\307\027\021\300'\034\005GI\243\304"
+	.ascii	"8\310\202\177\254"
+	.string	"\207\363b\236\334\200\313\303O\216\363~\f\005\343\335\005\t\242w\333\016\331\2324\203\245I\255\330\315\361\223\323\270\260\365y\0359\3511\313\245\204D\345\0167I\223x\340\341a&\307M\376\246\302v6F\226\n\272m\227lM\212\227\334\0343Y\321\004s\314\335\326\200\353T\247\026Ksh\267\361\034\236\303I\260K\225!Lw\234\344\326\030\264\363\033\343@\017\377\030\311\331\2252g\374\361\200\002@z\345\326\225\025w,\367\324\310\224\236\241,\267\037\265\003K\t\303\365\213\031\275\034av\370-5\233Q\373j\332\201\335:\312e\207!\213$\270-]{\332\302C;f;^\373`\302\231BD\334d\334N\351\260\032\372\204\224Dv\033\247\341#\370\354\303\023\256\302\333\330\f\343P\r\205\240\354\031\351\031w\t\235\235R\2214\211\013XTV3\210\344\250T$N\325\205\212\214\262X\230\2521\307\030\203\210\212(\031"
+	.string	"\003\026"
+	.string	"080 \222\013\266\335\274\001\024"
+	.string	"\020i\320\204d8\244\213Q\226T\020\232\001"
+	.string	"H\232e\260\240\b"
+	.string	"\335a\013\366S'`\241xt\376\213\305\320\342\370\235;\262\256`5\206&\t\025T\b\362\341\013ve\013\374\355\320\275S\3618|z:I\367\365\356n?\300\276V\007\300\340\376\202\214\205`\210\004\275\212=D\220D\363\007;\201\214l\025\206t\327\223\243=\314\247%\004r\330\tr5\240\031\221a\277x\006\304c\303\374&\2067\322\004\006\256\341-\234 \033A\214\234l6\341\323\276\335\341\340\rZ\005\213.\364\255\3611\037Nd\030:\325\235mL?\255Q\246\342\2153\254cT}\032eY\f\214\274Vk\223\210\344\031L\377\3400\361\034\302\210\3477EriV=\032Y\251\324 !v\030\274\240\215\311\240\366_aYDl\351d\357\355\220\330}\347\225\357\006\032\317AhN\023\230\374\002hCT\266;\220O\320\026\323H\375|"
+	.ascii	"\226\323\343\205\203\223?\247\024\201\217\004A\325\313\026\313"
+	.ascii	"\357R\260\260\303\035p\245\217%i1Z\353\342\246W$\267.2M\fi&Q"
+	.ascii	"*\037\315\376\375\312\370\362\020$r'\001\222\013\001Rf\031,7"
+	.ascii	"\230k\362)G!\020\303\234xD#\325g9\36712\003\330\213\361+\263"
+	.ascii	"\003s\034%\304d\317\3125\227\261\370B\033\334\306b\371\252cx"
+	.ascii	"\313\023\330T\322\335\251_\217\313WR\025x\2355\0355\217\237R"
+	.ascii	"\377'\220R\007<5\232\271Z\013]\334\005oN\317d.\217``\377\200"
+	.ascii	"\234T\n\256\225gZy \211\345\267[\214?z\304Y\202\243Db\236\251"
+	.ascii	"\341\260.\227\016MZ\263\227\3076\024L}\230q\2660&\260\251\242"
+	.ascii	"\201\214.\351h1\035\340;/\301\316y\332\016\262\220\345\311\n"
+	.ascii	"LzT\250V\2059\206\312\244S"
+	.string	"\177q\312\334\327\216E.W\237U\020\244R\210=\032j\203\212])a\276\035U*\321\bG6-.v\340O\261\233\240\tz\032\231\025rG\367\023\211\3126C\331\270\016\207\016\373\322c\f\353\266\177\250}\365&CXI\260\376K\265\215\234X\340\234\005[8\022\342\2303\233\263\357\306$\005$\220\036\006\334X\231\221\013|!>MD\324D\3479\314\332\275\032\250\317z\273\r\235\271\342P\334\211\201c'\025\033\2516\312F~\205\250B\212\223#\017\313U\233\ba\365\247\222^\207R\372\255tO\033\342>\213\r=Et\256[\374\t\372\274\362;g\345\344Q\321\340\217\235@[\237\n\335\230\020E\245M7J\322\252\307\317\005}\305\347w\244T\215(SB\307~\313.q\345\276\367g\223\342\322\242\t\034\233\376\233sz\231G\357\273\033\334\206y\342h\007t\352\312`\203\027\262A\310\034\227\007M8\225r"
+	.string	"Z$B\035?\313EgV\255\364\315\264\0345\371\243\216\336\364EA\236/\\\021\nW\266\320\177\262h#\272\345oP\031wY\274\323H\213w\324\357\255V\302\240\020\233\210\373\006\366\215s\r\352KX\206\347H\315\027\305"
+	.string	"\206,\036{\226\205\b\330\362\251\016\017\022\023\300Zav\276:\026\245=\3759\232\304\361+t\021[\260\254\021\005(\250$\025\231\016aWu\352\313\312\2023\201U\274\354\215\210\030XQ\344\013\315?\332gJ\313,C\036QR<G\274\324\365\250\375\271A\242\201EW\274z\200d\252\" \035|fF\210L\202"
+	.ascii	"\217\347\"N*\355P\236\327s\265\267#v:\210\325\234M>%\016\234"
+	.ascii	"\020\223\006\374{j\006\371N\021\332a\320\022\317\323\237/\236"
+	.ascii	"\264\352\371\n\206\210\205\365X\002j\3173\230\355\337'\026\313"
+	.ascii	"P=:\\"
+	.string	"d\r\307\273\224\305\b{\222\265@\261h\243\236\336\272^\232W\365]\317\346J\225\f\2346\177\275\335\333|/\341<\354W\343Ah\205\224\320\343\311\255h\332\252\2002\245\317Q_\213\205B\250h+N\247i\210-n=\033\211-\340\332j*Q\365Y\f\363{V$Y\371);#\326\3750\306\256\332\235\340*RG\025\003\246\232\t{\013I\244y`\203\030#\017\332+\217\303\342[\035H\360\274\225\240Z\"\273P@\232\336M!\034\214\007\306;\334'\022\032J\217\3018&\213\245)"
+	.string	"P\2239\345\\?_\246/\t\200\004\236\210\305b\375\265X\305\335\2134\260\247\244\031y\f^\301~\340\262N$\246\370\362v\252h\201f\2528;\177_\001Kg<\202z\211y\223 \200h\213\250\272\007\225=\023\314\030\207\007\310\302\212\345\264\320\013\332^B1<(*\271\226\376\354f\004\233\001\347\r\221D\031Q\305\313b\002?\330\234\305\362\002\261\020d\002\265\r%R|\241\241\277\357\302\356\240\003\301vi\356\251;\247\326\236\352\211\343\0368{n\ne\251\317hk'T\331b\032\270\026\360GS\216j\024]\217\256\237\301$9L?^\273mAk9\005\257\327KB/p\033\266.@2\301\002\253\237"
+	.ascii	"\264\212H-\335\277I\203\017\322\277\244Ld\032\256\n\214\200\362"
+	.ascii	"^\217r \362\250\003D-5\334my\356\2466y\f\254S\030\314\232\327"
+	.ascii	"\324\324\006\275\203DbL\224\361\317\031\301\242N=\376\311\357"
+	.ascii	"V\304rR\354ij\235<8\036\277\362<U\216l\205\341\226@a\340\320"
+	.ascii	"\310Ctj:\271\334\242Gp\177\r\006\243\243WV\305*\f0X\323eDM\337"
+	.ascii	"\036\325:\327\373\006dC#\324\007\361\353LQ\177\360\326\"G\336"
+	.ascii	"^\027\0303\256\331Q\247\205\324Gt\214\353\006\213\310\rn\017"
+	.ascii	"\241\020\370\324H\257i\336\352\215@Q\002=\215\276\002`\215\211"
+	.ascii	"\341\265'\242\230\217\274\013\r\267\267\241\\\026\025\303\021"
+	.ascii	"n\200\003;olnM\b5\334\020\230^\003A\207\363\252\007\212\004\211"
+	.ascii	"\0233lgKr6\253\3543\301bK\250\354\203H\236%\222\301\016\322\355"
+	.ascii	"BOm)\377\247g6\276\261t\252\204b 3o;\2500\317\244\314v\264e\314"
+	.ascii	"]r\271g\027\362\23296eS]4C(\034\265\352\203\213\025%0\336X\360"
+	.ascii	"\016\255(m\271)1\261&\211m\020f\271"
+	.string	"\326(\035\307\200>\314g\262\217\020<`@l\323H\250K\331\2250\372\305\317{X\326x1c\231\202#\246`\345*H\315\263{B\321\353\"\314\340D\234\337v\276t\001%\022|[\252\312\026K\254\251,\267\263\306*\037\250\006`\2713K\352\314\343::\220\303}XYM~\212\026\030\031\267\300\364\f\3178\367$\307.\272\355w}\314\243\210,*\256\025\200\333\"Y$\313\3741\003\202\327\020\261B\207H\377\214l\213\272\036\t\024\316\\@\313\341\263\373\206n@ZV\374}\224,\251E\217\"}s\230\027\341\245\2764h\272\240;I@\t9\0221E\021\215\232\334C\021\007\316\0303c\266E-\217\346\247\261\031\037TaO\021\310U\356\225\372\214-\340\303\206\024\337\036\345'Y\315k\342\fF\250\220fv\331\322\2571\022,\240K\273\271\254m(6\\\351\362L \326\321\301\025\221yb\324\313\025%"
+	.string	"\354L6J\325\b\323fK\207\275\216f2\210\222\242I\360#\252\352\366]\2508]\332\"\331\307\307\277\232\363)\251\002I\0069\302/#\274\252\032\037\240\327>\334g)\363o\216\227h]YW)\002\226&&\306\025h(R\003\343\322\362\305\241(`(\306\222\n\005m\316\216q\232\3077\356\226\313\232W\345`\366Z\372\b\301\207\240\274\237\211\036\021P\003\031Hs\022\255\365\351K^[kCb\233\221\037\031"
+	.ascii	"\214\265\314\317g\020\300Mn\373>E\330\254\272F~G\352a`;\002\254"
+	.ascii	"\022.n\313\317\t>_\204\240\245\270Y\002w\333\301)\216 .\260\242"
+	.ascii	"\247J\222\237\202\230\016=\253\t}6\312\027]3\374:4\216\221\315"
+	.ascii	"\027\301\352\241~e8\327\265ca\203\212\251\216\227\212%\316\252"
+	.ascii	"~)tC\333;\264\230s\2636\177\244\313\301R\306\226\021)~\261\332"
+	.ascii	"\335r\226\033\224\274K\205\323u"
+	.string	"c\263\274\025\030\246\214P\347\334\2068\230i!/\356\240\3017\225\340\241D#\216\3109\371\213\265p\032#\320\265\267m@d\274\177\225\207l1's\357\200\205]y\244W\204\235\"?\247\312\342\352\214S\272\234}\020\303\245\013\345\303\365\334\373\034f\241\272\0177\322\330\263\035\024\013\334\260\256\257\304\304\202\273\t\216p\202=\240\365a^\023\376\030K\253O\326\337dd\r\026\001\371vK_\324\375M\024\332\373\202\336\3417.\304E5\305K8\377\031{D\004\366\200\205B\355fu\201,\242}\325\313r\020*\262\037or0\350_\324\217\005\240$\341\261\rMvK^/9\303\016\277\256\256+M<\317\266\276\204\235]\375p\273B\2657\243\344%\006\031U\032\236\235\350_\364\204\232-\026\350\367\312\036\241\036\0209\243\374\212n\346#\346\005\224Y\362\353i\316\366\r\0325! \255Hig\034d3\364\223\260"
+	.ascii	"f\354\352\bwG\341\300\006u\025Dc\215H\374\311\t\013\225\247\r"
+	.ascii	"Ny\331\354\307\f\t"
+	.string	"\257\273\026\311{@7\217\2730\"3\2204\373\305'y\257\354XZ\2302\232\f3\333\004D\2541\004W\273\310%\022Z\323\221\f\362\356\304\223\272\273\257\0248(\363R\221~r\302\373\211\"\333\274\020\322\376\250\023\3143\021\340\344\211Y,\253Vu\345\262\363>0\354\037!O\016qv\277l}\275\001q\004Zp\335$uA\265\362W\233\277\251\234\245\342\"\273\\N\322-Q\364*\302\262\b\201\257\260\020F\234\035FQ?.\324\021\303\206(d<\320\367\321\035&\003?\265\017\225\316E\357\244\256\224w\207\225\206\305\272D\246*}:\250\\yw\230T\216\013\023{\220\300<ij\205\247LqU3]D&\215(\350\003\\\215\300\345\002\321\244\327A\001\351\240\202V\256\232\267\364\370]\312i\rN\t\256\274.\306\323\302f\262\036\316\376t\270@)\201&\224t\222W\304\325\321\200\210fj\025\177,\\\f"
+	.ascii	"!\333\0179\026C\353\333\300(\374\t\nn\256s\224\232\2473\302q"
+	.ascii	"h\334\204\377"
+	.string	"V\036\013\336\241\001`\023\321\334\263>\204:\b\207\025\t\310\360\271a\261\2468\225\206I\271P\375\005r\310\332\347\",\306\275\3218\332\250\252O \006\356\237\352W]\314\247\201:m\225\b\362j\354\261\374]\037\372\213EsA\224H3S\327B\021i\270B\223\305\020;~\002\261\344{\246\310\"\026\030\245\2258L\202D/\3462(\244Q\333\035#\347\264Pq\022\232\261l\352u&\362s\020\021\020\026B\202\344\252\372}\017\036\r\005l[\362\253\253\344\251\243\366\372\341\020\322\267\033]\024\304\211<a\221\324l\031y\227\nT\254\324\026\206\200P\302#\f\253\245\373q\037~k\244>2B\302u\270\2077g\371\263\234\215\023[\006\373\212\2363`?tn&\004\214\013;\211M#\267s\365h4\0371h\226\226\021u!\244HR\352\026\355\034\025\247\t\272\f\231\322c\031\373\201e\321}\222\037\327\257\257\245"
+	.ascii	"T\377c\346\376J(V\302"
+	.string	"+G\277\325\232J@\212\016\202\245\235$\013\030Y'\221\243$^p\341\006&l\023\221 P2\316\344#\343\2154\323\322\272\017cF\221\020_\213="
+	.ascii	"h%\242\200\275\031+\323\n\343\316a\367\254\\\021zKL| \334\340"
+	.ascii	"5I\265:\257\223\370w\374\322U\"&\213_\272\243LC\b\332\037\345"
+	.ascii	"\243t\363l\013y)K\316\274M\372Z\252\314\221\247\342@0\357r\347"
+	.ascii	"\337i\314\234Z\021"
+	.string	"l\376\356\235\277,P\032H\024;a\323\203\215\256\246q\330Q_u\271\317e\331\355Q\233\020\372!\216\207\310\247\235!\374H\354\226g\264\336\213Q\265\215\001J\206M\005\245\206Id\352\263\250\273Ys|\212\202\310q_\235\207\207\301\310\340\212\351!\274\372)\255D\263\f\357\273\031\274\277\035\b\357'>q\272ZF\235\207Z\2433\022\221\320O\210\t\\\273\347.\223\360Q\223\030\253\2047t\305\262\1770Z\276\241\231)I\245e\3403\246\270[\200R\244\025\005\361\243\007I\272i\232\3704` H\t:\203\226\021\201\356\255\337\030\032\202Kz\"\244\212I\256.\217\007<~\312-\215\350\230\b\177\023kj\343\244\270\301\221i<\326\3728X`\333`\206?\020\227t\203\031baj\235\206+\020\213\274\211t\013j\213\224\025r\025U\360\203\373\344]\020\365R\363\t\2470\246\326\326#\206\246\331\225\230L\254\306"
+	.ascii	"\234T\256\311[\220\343`\306|\206\r\206\240^\331\025b\200\210"
+	.ascii	"t\330\005\227l,V.\203\267\273$\366F,\212\35101\276\327\347\256"
+	.ascii	"PwM\374\365\257{&\016\357\307>Nm\255|\256\340\004X\371^wr\316"
+	.ascii	"\270\340t\376\277\2232/\2362\223\204\225Qb 0\023 \212a\344\b"
+	.ascii	"$%\241\027%\231\220\331\313#\213\331\305H\366}v\034\202\213\267"
+	.ascii	"\332\200\251\304\367\340\005.\207\f\356\310JY\354\205xSg\266"
+	.ascii	"da\226\204?\324T,\252\356\036N7\b\207R~<\221`\323C\025p\226\244"
+	.ascii	"\365fy\247m\354\323=\377\327\367K\371\343\n\245\003\207\005\250"
+	.ascii	"\275\253K\343\367\3728*\264&\364\365G\362\031\237I6\260$\026"
+	.ascii	"\204\321q\331N\006\224\306%\271U\203a\304a\261n\017\206\253\223"
+	.ascii	"\335\336\300\307\376=\325$\377\304\344\227\354\351\211\345\267"
+	.ascii	"\237\360:<S\313\324\332\356\314C\260\321\332\351\257\304MM\274"
+	.ascii	"6o\222\262_2\370\271\236\\\241\306{\324\363\013\2568\242U4\376"
+	.ascii	"`\345\374\255\366M\314\305\233\303\207\351$\232g-r\262<\030\316"
+	.ascii	"L\226#jt!\274\270\355\347\300\217\306|x`,s\302\006\2556\300\374"
+	.ascii	"\221\352\317\224a\276\271\253\274\036\215\271\203g\301\351\330"
+	.ascii	"\324\274\266\323K19*}8\223,W\314_\344|\017^\367\274\255\033\351"
+	.ascii	"\340\207\020\005a\202Q\026F\336j\354\345\355\263\376\362\020"
+	.ascii	"W\307\366\346&\226\017y\032\302\256\277\375Wk\276\300\222Kc\365"
+	.ascii	"\254Bw\245?\206\236\310G+\032\025\267\321\001\342\377\332\027"
+	.ascii	"\004\026o\021W\356\215$\221w\310{\366\221\f.R\276\270\300\317"
+	.ascii	"X\274f\340\377\342]\f\f\306M\202\2019S\256D\365\362\307\267\023"
+	.ascii	"|\374\324\246\257R\277\216Qyf\225\275\261\3149\323\336M\316\353"
+	.ascii	"O\216\211"
+	.string	"?\335\315\355\037/\\\362\331|\300G\004\235k34\252\250~\211\352o\263<\203\016\2476\366\b\300\321\217\036\233\263wr\243S7\225\027v1\020\234+\351\303^\177\221u\363M\364\027P8\214dY\300-\b\034\202\362\3477\361\277\274yb\315\025+\216u\255\331=M\031\236kx\247\377\234i\375#\211#\272\336W\306\236\250\n7\250qYC\016\375\3653I\373\317\216\270W,\376V\335\016B\226M\240\370\n\252\3776}\"\316\205\355\376M\230\3643\364\020\327\370G\315zg\233\243\223\225\363\335\320\265\307r5Z\370\321{o\210\234\026N\177\"\276\245}\017/x\036\277\273\216{\363\377S\270C\372c&\265\334\323\n>\312\265smg\314oG\256\026[\276\345\306m\031\377F\256G\241\307\333\213\273WS\207\207\205\275;\003\377\3561\263G\346\362;7\376\b\377\276\367\347\331\370\216u7\021\360wq\351"
+	.ascii	"+\356\214\251\017Y\345\035A8~\263_\211\301\320\241w\310\263\361"
+	.ascii	"\017<\213\033\232s\356O\334\337U@\347\207U^\374\303\303I<\002"
+	.ascii	"\374\206\f\221\273\201\237\211\177\277\r\366\327\225\257\353"
+	.ascii	"\316\263l`9\034X=\231x\033\256\\\023\367\313\236\027~x\236=\351"
+	.ascii	"\0057d+\244\001\342\3661\262\323\221a\342\327\276V>\260\302\323"
+	.ascii	"q\271\357q;\234t\204\357\022}|\301\352\251\360q\250\342J\327"
+	.ascii	"\325\240m\036\227G\320\360\016\343\313\343\234\354\260\254\324"
+	.ascii	"\222A7\314V{m\336\234Qc\264\337\203\324\361\231P\312\013\266"
+	.ascii	"\357\277\222o\241\226\355\341\345/c\312\276\"\357\032.\017\366"
+	.ascii	"\330\001\324\3151\354I\275Q\254\277tN+\302\327\020s\366_XM\346"
+	.ascii	"7\346A}[\370\204\3459\350\307\tnMg\\\246\257\245\236\246it\030"
+	.ascii	"'=i`\327\017<\326\3321\361q\306\344\327\267\"\366L\317N\217J"
+	.ascii	"\300\377\001\365\331\247\257X2b\303\231j_\345e\225|G\246\373"
+	.ascii	"\022\253\033*\277\251\271\376]\207\330Qo,\265Y\367u\253\300c"
+	.ascii	"\357\\\220\306\253\274\317\350J|q\275\016\275\263\373\016\303"
+	.ascii	"\207Fc=\020~\314\226\002r\362\363p\256\235\b\217\005\355\243"
+	.ascii	"\215\2176\267\326!\216h\231U\257\342\035\362\354X\345\243\352"
+	.ascii	"I\3708\317\377=x\230\345Ik\266vn.\365C>S\330\210\235\352\375"
+	.ascii	"\340\307\307\263^\001\374\030\214\201\305\373\310\320\302zS\245"
+	.ascii	">\217YO/:\217\355,c\216\223\253\225\227x\231\370\373\313\257"
+	.ascii	"\216\315\023W\005\257\3771\200+\237\360\274\260\275\006\257}"
+	.ascii	"\n9\032\362!\263uN\377\345\344}b\374\344z8?\375\307\370\017\254"
+	.ascii	"\032L\306\341Q\276\325\004\022(\376\003"
+	.text
+	.section	.gnu.lto_.symtab.eabcc68afd87291b,"e",@progbits
+	.string	"dyad_init"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\002"
+	.string	""
+	.string	"dyad_shutdown"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\002"
+	.string	""
+	.string	"dyad_getVersion"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\002"
+	.string	""
+	.string	"dyad_getTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\002"
+	.string	""
+	.string	"dyad_getStreamCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\002"
+	.string	""
+	.string	"dyad_setTickInterval"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\002"
+	.string	""
+	.string	"dyad_setUpdateTimeout"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\002"
+	.string	""
+	.string	"dyad_atPanic"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\002"
+	.string	""
+	.string	"dyad_newStream"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\002"
+	.string	""
+	.string	"dyad_update"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\002"
+	.string	""
+	.string	"dyad_addListener"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\002"
+	.string	""
+	.string	"dyad_removeListener"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\002"
+	.string	""
+	.string	"dyad_removeAllListeners"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\002"
+	.string	""
+	.string	"dyad_close"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\002"
+	.string	""
+	.string	"dyad_end"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\002"
+	.string	""
+	.string	"dyad_listenEx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\002"
+	.string	""
+	.string	"dyad_listen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\002"
+	.string	""
+	.string	"dyad_connect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\002"
+	.string	""
+	.string	"dyad_write"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\002"
+	.string	""
+	.string	"dyad_vwritef"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\002"
+	.string	""
+	.string	"dyad_writef"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\003"
+	.string	""
+	.string	"dyad_setTimeout"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\003"
+	.string	""
+	.string	"dyad_setNoDelay"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\003"
+	.string	""
+	.string	"dyad_getState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\003"
+	.string	""
+	.string	"dyad_getAddress"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\003"
+	.string	""
+	.string	"dyad_getPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\003"
+	.string	""
+	.string	"dyad_getBytesSent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\003"
+	.string	""
+	.string	"dyad_getBytesReceived"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\003"
+	.string	""
+	.string	"dyad_getSocket"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\003"
+	.string	""
+	.string	"close"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\003"
+	.string	""
+	.string	"inet_ntop"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\003"
+	.string	""
+	.string	"getsockname"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\003"
+	.string	""
+	.string	"getpeername"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\003"
+	.string	""
+	.string	"fcntl"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\003"
+	.string	""
+	.string	"gettimeofday"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\003"
+	.string	""
+	.string	"__errno_location"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\003"
+	.string	""
+	.string	"recv"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\003"
+	.string	""
+	.string	"strerror"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\003"
+	.string	""
+	.string	"send"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\003"
+	.string	""
+	.string	"socket"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\003"
+	.string	""
+	.string	"__sysv_signal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\003"
+	.string	""
+	.string	"accept"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\003"
+	.string	""
+	.string	"getsockopt"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\003"
+	.string	""
+	.string	"select"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\003"
+	.string	""
+	.string	"freeaddrinfo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	"listen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\004"
+	.string	""
+	.string	"bind"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\004"
+	.string	""
+	.string	"setsockopt"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\004"
+	.string	""
+	.string	"getaddrinfo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\004"
+	.string	""
+	.string	"connect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\004"
+	.string	""
+	.string	"fgetc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.eabcc68afd87291b,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
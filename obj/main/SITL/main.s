@@ -0,0 +1,269 @@
+	.file	"main.c"
+	.section	.gnu.lto_.profile.86543858f64b7e5b,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.86543858f64b7e5b,"e",@progbits
+	.string	"(\265/\375 \033\275"
+	.string	""
+	.string	"\210\017"
+	.string	"\002"
+	.string	"\356\375\237\271\017"
+	.string	"\001\240\342\234\212\n"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.86543858f64b7e5b,"e",@progbits
+	.string	"(\265/\375 \033\205"
+	.string	""
+	.string	"@\017"
+	.string	"\001"
+	.string	""
+	.string	"\003"
+	.string	"\001\002"
+	.ascii	"\271R6\200\005"
+	.text
+	.section	.gnu.lto_.inline.86543858f64b7e5b,"e",@progbits
+	.string	"(\265/\375 R\355\001"
+	.string	"\264\002F"
+	.string	"\001"
+	.string	""
+	.string	"\b\327\377\267\203\002o\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\201\200\200\200~"
+	.string	""
+	.string	"\004\002"
+	.string	""
+	.string	"\001\n\001"
+	.string	""
+	.string	""
+	.string	"\002\013\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006"
+	.ascii	")\004b\016\230\352\334\246e\260\f\274\2016"
+	.text
+	.section	.gnu.lto_.jmpfuncs.86543858f64b7e5b,"e",@progbits
+	.string	"(\265/\375 &\005\001"
+	.string	"\300\032"
+	.string	"\001\002\002\006\177\0012"
+	.string	"\001\300\004\0012\300\004\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"-Al"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.pureconst.86543858f64b7e5b,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\264\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.86543858f64b7e5b,"e",@progbits
+	.string	"(\265/\375 \030u"
+	.string	""
+	.string	"0\f"
+	.string	"\001"
+	.string	"\002"
+	.string	"\002"
+	.ascii	"\200\340\r`\001"
+	.text
+	.section	.gnu.lto_.lto.86543858f64b7e5b,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_main.9.86543858f64b7e5b,"e",@progbits
+	.string	"(\265/\375`K"
+	.string	"\375\007"
+	.string	"\"\31636P\215\322\001\244\204\373\220\240@T\257\033\302P\264\201\223Zd\b\355\326Z\003\276 \020\215\301\016\323\335ukn\021\213\324\246\305\320\262\334\246\306QG#{o\271S\n\346d>\235\215G~:\033\217\344X \231\031\360\\H\260d\303\234\226\254|\315\374\247\231\255\240\001\340\f>\243\315"
+	.string	"\312\330$\034n\261\205\024{\210Z\352Fa\177\273\273\252&\033\"\302}\344{\034j\")\251\220b6\nsj\262\017)N>\254\231mA\020\205\\Lv+VTv\203#\034\266/[\300?\275\343\262I\016&\336\306I\004\202\262\273\022s\202x\370~\211\207\252Y\335\365\247\356\362\013J\177\030\327"
+	.string	"R\351\256\322\354\256\335\210tq\303\333\326\330\306\330.\t\023"
+	.ascii	";\023\206\013\243\34020\"\251C\240\rp\227\246\024\270[T\033\220"
+	.ascii	"\312\357\207kj\365\223\303\"\003\342\341\326\333l\004\270q\205"
+	.ascii	"\342\004"
+	.text
+	.section	.gnu.lto_.symbol_nodes.86543858f64b7e5b,"e",@progbits
+	.string	"(\265/\375 \340u\003"
+	.string	"\242\005\024 \240'\351\017>\366\333\265\370\213\177\373\207\316~\373\301\377[\325\207\340\242m\255\265\334\310&{\357\024W\302\276J\367\021\3167\250\323\266\370\t\320\207\244\202r\301dN6\326\366\003\217K@\375\225\nf\370\243\241\212\317g \n\017\216Eeb\377\215\013"
+	.string	"8\207\006\203h\215J\231k\200z"
+	.string	"p"
+	.string	"p"
+	.ascii	"\030>W!%\2562P\006"
+	.text
+	.section	.gnu.lto_.refs.86543858f64b7e5b,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.86543858f64b7e5b,"e",@progbits
+	.string	"(\265/\375`*\004u\036"
+	.string	"\206\371\315L\220\230q:D\362\323\263\030}Pe\210\216t\352\030##\253\332j\263<\026&}CD\314\332\342\204n{\264\315\276\245\346\340\033\312)\360\361^\222-H\004XiD,tGTr\\Q.\217p\212\205T\002\270\277F\223\022\";\005\246"
+	.string	"\262"
+	.string	"\303"
+	.string	"I\271\270\346\3705\321Pw\202\206\273{\335k\356bw\257\335\r\300\375\301\3353b\355R\257\327}T\323\353\337J\034\352\036\205W\222\370\332\030\351\305!R\305K\315\002^sK\364\366Rk\001]3^\245\232\250\2733\027s\311\367b\313Hf!\371)C\315r\3243\234\245>\303\203;\356\206a3T\270\324\020\216\244M6P\222\271@\371\005\346\363\220\323\260]\341\243\371<+ayV\"aR\265\204\346\317\275\377X\377\257\376\023\377[\375\037\376\027\376\247\372/\365\337\374\357\344\377\330\325\325\325\365\177\304\237\031\374\257_\355B\006nw\027\240\374\363\263L\316\263_@~e\007\377\311\356\377/\022p\357\264\272\230@\254X\032#\371\337\246o\032\303\3536\217\365\311P\264\261\033\013\026}-\232ue-\334}\001v\233\007\277k\254\237"
+	.ascii	"\335\226\307\272\261\216{m\373m\2336f]4\f\364\311Z\030\350kc"
+	.ascii	"\240/\326\306\357\332\375\372\262\013\263k\313\003\306\210\265"
+	.ascii	"1\353\353\030\270\312\332\230\007\216\246 \023\214\034\245\345"
+	.ascii	"uQ\357\307\272\261b\013\277\255\325\235\205C\355:\350\376\275"
+	.ascii	"\256\026\033#'\331\025\213vF\3307\303\335\215\240\267Cz\233W"
+	.ascii	"l\231\336n\246\335O\367(\254p\261\003\331@i\346\002%\026V\024"
+	.ascii	"\251\304%|\032\311\2173"
+	.string	"\256\256\362\260\346}UI2\322\362\312rC\253\307\026\221\310@X\324\304\t\266\256\356\032<r$[\345\030\274\263\362[\"\263\224\354\310\312H\236\255\266\246DQ\321\032\311s\345\251\3773%\024\2430`\224\314\252\252<\314Sm\224\213$\365\321l&\310\260\3117\334\222\221\302\244T5\222\317\257\371g\3413T\026\346)\222\007\267\257\f:\261\030\343\245\335%\017d>\212AF\362\251\371L$\307\317A\250\034\314T\371\250W\256\001Q\240\f\021\275\364\221\323\ffc\305\226\016\256g\252_B\205c\005\350~\352n\005d\323\225!?F\362\033\314\361/\233u\273\003:\033\316F\376\347\246\201\212\336\204|\320\23737c\303\331z\316\022\264\263D\315\211\263F\"(M9\344r\350\231\252A\260[\rU{r>\270\364Ds\251z\332:\250\250\335P\237\003\267[\372AMu\265\233\020\220-'\340?7\034Bh"
+	.string	"A\323\241&\324\232\316\346\304\231\336xP5\345\001Bu9\025 `'\3604\bUi\2724Ui4\344O\233\212\342P\023\346)\344@\310\321I\001\340:;\021v\"\224\327\331\301\301\331\311\3011\237\203\363\322\365H\230\240\303\331\204\314[\260\300c#\302C\006\363\274\301\331j@\264S\315\321nd\377s\023\253\030\313\0271L\376\234\225\227\344\341K\330\r\313\310\"2t \215\344\341E\250aH\202\b3\204\020hd\242!\245I\333\200\002\221\261\326\006\020h7'i\335E\002|/C2\002XfC\364\230g\220\247\273\250Q\237"
+	.ascii	"\016\273 \313>\342\37605\215\031\234\224Pwraz\256\177J\234\272"
+	.ascii	"\232\332\227\025\275\234\273\224G\"\rS\326\235\b\242!\216\273"
+	.ascii	"\3314\203\316\303n\260q\210\361\032X\262\230\257\023\254\215"
+	.ascii	"d$\261\366\251\024\215v\310\350%v!\0042\250%\354\2666\023\023"
+	.ascii	"\255\352\021\241\206C[\310\257t\345\006\315\035\036\234/\324"
+	.text
+	.section	.gnu.lto_.symtab.86543858f64b7e5b,"e",@progbits
+	.string	"main"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306"
+	.string	""
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310"
+	.string	""
+	.string	""
+	.string	"simulatorPoll"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313"
+	.string	""
+	.string	""
+	.string	"delayMicroseconds_real"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317"
+	.string	""
+	.string	""
+	.string	"processLoopback"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321"
+	.string	""
+	.string	""
+	.string	"scheduler"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323"
+	.string	""
+	.string	""
+	.string	"init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.86543858f64b7e5b,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
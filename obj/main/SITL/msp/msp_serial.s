@@ -0,0 +1,1195 @@
+	.file	"msp_serial.c"
+	.section	.gnu.lto_.profile.bd1bf8b1bfa9e46a,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\004"
+	.string	"\007"
+	.string	"\n"
+	.string	"\017"
+	.text
+	.section	.gnu.lto_.icf.bd1bf8b1bfa9e46a,"e",@progbits
+	.string	"(\265/\375`\232\001U\n"
+	.string	"\"N68@o\323\001\216\316\005\302\270Yq\367X3\216SO\345qp-b\354\335\352\315\277\223\316\246\263\254\212\242(\212\242\b\244\004Dwf\326OO\332\356\357M\244\354\266w\332;\260z6\217\333\314k$\2228i\264\337\177\236|\234\004mZ\357c\3412\234\271\314\356\310\304\007\224\301^YP@\300P\031-\241\r\003\240\"\247\006\322u[\212 H\271\027\354\3311\277\307\342\273M\245\022\013+\376\272\264:\352\220\220j\374\355F9\020=T\325\263y\\\333[{+\371\035@\0356@L,e\265,\371\313+y\353\326\005d\210\006\303\007\215\257?\305\370:<(>\363+~\237\317\307\230c"
+	.string	"R\231\324\351\354:\023\212\317\317\277\013\272\020G\204\362\361\360\003\027\242\242s\0015\360\2374 \240\202\262\031;\036D\202\233DI\303Z\345]\005M%\020\252\036\300b\006l\306TC\301J\376\013|\206\233\377\301k\006\033\240\r\370\366\366\005&\013\313\002\212\311\274\001\017"
+	.ascii	"\224\272g!\031\204]^\274\343\023X\352p/\363\"\323\200w\333\364"
+	.ascii	"z\351,\006HL\004@\277\332\332\022\"\356A\020\2041\206\213;\213"
+	.ascii	"\375\340q\357\235T\334!"
+	.text
+	.section	.gnu.lto_.ipa_sra.bd1bf8b1bfa9e46a,"e",@progbits
+	.string	"(\265/\375`\240"
+	.string	"E\005"
+	.string	"\322\306\022\030\240'\351\177VUUU];\255\375n\263\373\254\265'\277\221\275eJ\001\276\234\311\250s%\220!\366\007eR%\006%\013\357\t#\nT\257C\367\032\230-\373\200\265\227\342\321"
+	.ascii	"d\364\3431e\317X2\277z$M\316\304\027\001) \220\202!Cni*,\303"
+	.ascii	"U\3026;\t*\301\021\207%\250\300C\026\360\0176xa\f\326g\267BC"
+	.ascii	"\2175V\210\202\204\021\326#\236u\203\037n\013:\360\340>8\001"
+	.ascii	"\033\214\347;t\004;\206(\035\b \321P\353\313\253F\217\202\206"
+	.ascii	"\370\023\314\304\265\245a2\231\024`\b"
+	.text
+	.section	.gnu.lto_.inline.bd1bf8b1bfa9e46a,"e",@progbits
+	.string	"(\265/\375`\351\b=%"
+	.string	"Vs\252F\260XQ:\300tNhY\310W\315\301\204\302\3245\211\021$\275\204R\2158f\220\254\341\375\237G\212\253\360\263\315\177m"
+	.string	"\036A\313\374\240\315\374O\211~\205s\302\234\0219dH\253,Kb0\342\357\222\277\267L)\215"
+	.string	"\214"
+	.string	"\241"
+	.string	"\253\367vm%\013\223&\320\263]\r\232\203\342\255\316\237\265M\311\007\273\033\246erm\312\343\351\367\004\f\247\334\232\346\240\234\330\250\347\f\322\230\203\264\267\273+\353\334\265\002\351\356\356\255\326[\254\252\252Z\003\332\"v7g7\260\357\357Ll\264\217>\246Wr\037\005q\373\275\020\267'H\260\235\030\275w\230\2060r\230~X\311\250\267\360[\260\025\234\002\350\243E?\35705\262\237\024\375\n L\213\314\343\013\351\025\235\215\265\317~\271\205%\306i\213\345\277\210\376PL\332\335\235\230\264\264\312Z\354Q\244I\357\326i\2355\225\"D'uO\036\n\247)\226CK\226\355\273\023D\037\027}l!C\344\306j\337t\203@\233(\312`\362M\271\324\366"
+	.string	"\275\336'\212KL\276\251\226/C[eh\223\362&=e\2362\231u\312d_\231m6s\206\370K!\243\247\236\263\357\314\346\362\234y\316f\3269\363Uw3|\345n\355\373\265IOUk\320);\246$\335\272\265h(\001\346\020\221|t\211B\300\302H\323\023\003\343\334"
+	.string	"V\377\321\271\242m\\\204\301\005\251G\213'\365\353\262@\355w\210:\224\226\320,\210\335\370\346\246\355\214\303\344\b\nG\317\206H\005I\2313\321\341s`\217\376KN\300\026}\f \001-\022\212fn09\301\334\342\231\366\2552\331\024\212\275\335\375iI\237H\253\230P\320H\020\201\345\212:+\332\016G%N\237\2004i\311\261\207\024L\0336i \270\364\267\243\003\3509D1O,\224\354k\201\246\355rn\032?\244;\257\356\3130\264\272|\363d9\216GQAb\274\226\242\202\304p\271g\002i\225\022*~hP\334\225"
+	.string	"\375\177?p-\321\277"
+	.string	"\036P\243\026-\216\f\3211\017\222\2231fbj\336\257\251\306\313\001n\337\242R\2224aT\205H)\3250`@\037\355\002\372K*5U*`\261\227}\263\273\335\235\006@\"\2228\202\205\352\245\326Q}\241\332qh\332.\224\016\274\344Hu\305\343\264\367k\263BG$\321!\345"
+	.string	"\372Q\017\361hF\224#[\361\216i;\034}\316\220N\355\346t\324K@\274\270\b\255c\337\247\355X\366_\255\237"
+	.string	"\035\201\001\250\0015\310L\r\315HR\222J:\261\004\004J)!\343\r\0210\265S\212L4IRZ\366\r=$\177%ljl.*\241\361\235\356\351/\224b\016{\2635\021N\223V\350\001\\\\'\360^\260\023\353\026\344\246W\fK<A|\250\374\211\251\353M\270\314V^T('\364\017\023\242q\\C\270\f\035\275\321\357(\035\325\374\236\325\205\b\357p\320@\023[\037\375z\3014\210\333\035#\250K\nCf\303\346\347"
+	.string	"J\346\322$\354\233\265`\335\325\276\346\371m\342\216E\265\317\370v\037\260\n\246\354\336\376\3364fl\322c\2714\351\007`\302\241]\235\321\304e>[\030\2307\326F\\\311\245h2\026\234n\203\324j\275\3006\213\257T\\\206\343\326\007?<-l\216\327\212R\352j\360\346\352\026\276\022\\\266#\026\"\fK\270\325gE\273\207\377\263F\024\r\232\265\255\236\303\242\305\323{\330L\215\227\b\362\254\360Yes{>\027\220\242\022\212\250\372?\253\2201\3133\023\364\233\210k\215\231\244(\316\270\31119d\337\001u\320\307U\013V\354\007@\274-B'\300 \\\034ChT]\236Q$W\256O\305\020\264\320\r\244:zJ\340\311\206\226\270\371\307\023&(\b\272om\274J|%R\252\027j\360\334\207^\031\267\221\307D6,\213\326K\250\370\253\352wha"
+	.ascii	"\222\372\302 2|\302\030\246\352x;\342/\327\331#\177Uw\353A\302"
+	.ascii	"W\016\313\\C\301W\222\236\244\321~\237\313\344\370\036\3744\256"
+	.ascii	"dG?\216\343\026\207:]\321\213\365\212\301\232\2323=Y\311q\331"
+	.ascii	"\262\253D\017\025\213\342H!\357M>\215\374\270\222\2342v\370\304"
+	.ascii	"_\026\316 \320@\243\t\274\226a9\363s7\225\205\335\216L\373P\351"
+	.ascii	"}=\035r\357\315\023\374\302\2775\205\350UH\202\024gU\017\302"
+	.text
+	.section	.gnu.lto_.jmpfuncs.bd1bf8b1bfa9e46a,"e",@progbits
+	.string	"(\265/\375`\211\005u\020"
+	.string	"\226\326B7@M\223t\303\260\203\0178!\"\353\316`\243F*^\031\365T\rG\264k\n\006\205\365dy\206\321\237\365\230\002\024\374\277\342U\326\322\276\203\233\370\007\255\335\215\020\231d0"
+	.string	"2"
+	.string	"6"
+	.string	"\032k\314\022Vr\314%\3571\305\036,s\232\350\373\363`\235R\027\006_\030\223\215\372=\310w\265\322[\275\247\307\340W?\275{\222/'\264\t\001\274\213\333\320+&\324\033J\017\331Wx\312\037{\n\227^F8P\265\244[\313\342\250\243q\254\231\221a\335\236\217\362~\232\342\336\3419\334\215\274"
+	.string	"4\006\323\n$\034\006+\211#\344\255\277\f\326\222\220f\022\214x\021/\266w\365"
+	.ascii	"\250~\"\3724\330D\320\347\037\276\314\245<\204\203^\001\342."
+	.ascii	" p\301M377\200\032\244\3509=\002;\016E\272\326@\257\322\203z"
+	.ascii	"\323\377\2324\026\215E\225\221\034  \272>}oYz\201\036F\322\215"
+	.ascii	"\r\247\247>b\301J\245\276\013VJ\246i\nt\250qI\262\n\206\244)"
+	.ascii	"l\254\001p\"1UU\017\022\200\323\020BQ5\311\240$42C\213JY\366"
+	.ascii	"\r\350\005\274\252\315\"\313\026g\345\024\206\231\027\2132)\364"
+	.ascii	",:\376\345\376l4\307!\261\336r\353\272\355J\224\005\355\021\261"
+	.ascii	"\267P?\226\362\304i!\006\253\311#\240\201\\\307/]@\373O<\bH:"
+	.ascii	"KR$\031\231\213\245\026\220\244r\376J\031\270\361\261y\251\223"
+	.ascii	"\205U\312\300\222\375\207%C\030\240q\017\001\2049\332\332\243"
+	.ascii	"C\016{+t\336d\375\031s\265\321m\334\364)\002\2444\b\232\034#"
+	.ascii	"(\336Q\230\373i]U\257\244U\363\2546\177\001t<\214\251b\273`$"
+	.ascii	" ^-\307KZ\337`\220\326\003\200\377FsY\344AQ\003[B\3519\334=\211"
+	.ascii	"\353My)y\357`\005qDP\275\216)\324`A\003\300\035\"}\372ls\250"
+	.ascii	"J\224*\177\222\006\3772\2449sH\025\035\352\345\234"
+	.text
+	.section	.gnu.lto_.pureconst.bd1bf8b1bfa9e46a,"e",@progbits
+	.string	"(\265/\375 ;\331\001"
+	.string	"7"
+	.string	""
+	.string	""
+	.string	"\022"
+	.ascii	"\232\004\001\205\004\002\232\004\004\232\004\005\232\004\006"
+	.ascii	"\231\004\007\231\004\t\231\004\n\231\004\013\271\004\016\231"
+	.ascii	"\004\017\232\004\020\231\004\021\230\004\022\231\004\023\231"
+	.ascii	"\004\024\231\004\025\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.bd1bf8b1bfa9e46a,"e",@progbits
+	.string	"(\265/\375`\213\001\215\t"
+	.ascii	"\222\f*/`k\222\016PM\031x\004A\216{\020p\0031\303\f2G\016\271"
+	.ascii	"\005X\247e\006\201\363\361k\345^\312\032\242\355\032\256JZ\023"
+	.ascii	"j\2665)S_\034\",\220\357\3445\007\345\r\245\324\350\313\362\370"
+	.ascii	"G2p\006G\330G\307\205\304\261\261\300\334\035E\005UNA\345'(C"
+	.ascii	"'%\320Kh\003\242f\251#\021`m\356b\214\021\336$Gh\257\264\020"
+	.ascii	"\205\236\215\315a4\332\355\250\205`\314\031c\005\2472\367Y3)"
+	.ascii	"\247\270PVP\246]\355i\353\034\376\004\353\324\246P\207\302xO"
+	.ascii	"\0233\346\234\322N\225\017]2\364\225\bB\250!Ak\256\244-\265\030"
+	.ascii	"`\202Q\312\3126\020Hi\244\264)\f\007\r%\334K\320s\310\n\220K"
+	.ascii	"\231%f\364\253\3461\354\024'\013\"\366oW\205M\226\224\330\256"
+	.ascii	"\214\265\254\327o]\236\214g\"\315`\026\341\371K\177\003\323\376"
+	.ascii	"se\\\034\202\006\263\034\342\021\366%eG\020\245\212;\001Lw\007"
+	.ascii	"i\274I\2109\024\325@\241I\r\036\241\266\013\236X\215'P.A\240"
+	.ascii	"\001l\212\376\032N\276\313\365e\252\237+\005"
+	.text
+	.section	.gnu.lto_.lto.bd1bf8b1bfa9e46a,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_resetMspPort.17.bd1bf8b1bfa9e46a,"e",@progbits
+	.string	"(\265/\375`\206"
+	.string	"%\n"
+	.string	"\366SG:@\217\322\001\230\256\360sW\030\305\304;|\222\023en\375\007\250\023\030\311\312\235\331\206\354\340!\201\321\034G\261U\276\202y\013\314rw\214\310\326\377\357\206\345X\263d\223\275S\n3"
+	.string	"5"
+	.string	"7"
+	.string	"\376l^M\336\303\275n\336\341^=\3320'C6\344\222A\223\331\335\216\202|\374\034\375\317\016\320r\245>5\013\273\353\331rq\334\364\266\021l3\330\357\004\333\356\256\351\313\3764w\362\337.\373\247F\240\303\023\263\273Q\233\331\262\256\214\330>\307\366$/\f\b\026\343D#\364i\337\344\261\3612\324\013v_)*\273dB\023\233\335U\360i\026\241\347E\004\305\275\206`$\036\252Ys\235/\357\026\356s\216\332\024\025\363-\177\366\207X\311\242)\277\344\223r\324\223\005[\315\232M\246&\375\260\037\"\370\211\002D/\364\032>\007\021\374D\247\3204`\022(bT\002\275\020\342\024\232:\211\322\310\324\221\300\260\003\035\370;y`'~\037\330q\310\375\266\364\345\312R\252\350\312\033\265\277\243\004\016"
+	.ascii	"\362\234\361.\360\314xIE\003\"\307-\004{L\200\341\032\320\nC"
+	.ascii	"\203\302`X\200\n=\356\360\242\235d"
+	.text
+	.section	.gnu.lto_mspSerialAllocatePorts.18.bd1bf8b1bfa9e46a,"e",@progbits
+	.string	"(\265/\375`M\004\375\036"
+	.string	"\346\371\312E\200\3341t\177\356\f\254\206\235\233_\003\263\370J\004h3,*\262\263\340\367\302O\201\025\344\0340\3749\025\024L\315#\212\2745\0263\330\252IX+\252e\031s2\212EY>?\026\203\206\221\255\355\275\345N2\275"
+	.string	"\252"
+	.string	"\273"
+	.ascii	"j\031\224.\310\352\030\341^\377(\367\342]\003\007\302'\243\350"
+	.ascii	"\315\222\340\204\315\003\334+\377x(\302#c\030Q\315\270\340\006"
+	.ascii	"-\355\336\344\202W^\200{\345\344\177\354+\356=\366\225\205\314"
+	.ascii	"h\001\254v\326\f\277\324\356\275\276\006\302\273)\274n\227\273"
+	.ascii	"\331J{\n\371<K\2523+E\251\353\350\315\312\006\221\227\271\241"
+	.ascii	"E\213\330\322\304\356E5w\026k\307s\267\034\267T\200\031Y\222"
+	.ascii	"^qH\013\360\360qeW\2241k\0049m\266\260t\234\322\036\035X\316"
+	.ascii	"\364\212V\224\350\f\022\255\203}^\025\253f\337\353\006\224\250"
+	.ascii	"\035\327\266\260v|\336\214\356\275<\211E\254\363\316\231Y\t3"
+	.ascii	"{`\246\020\002\366u6\321q\r\311\017\203\032\320Edf\030\307\""
+	.ascii	"\"\001\232{o\221\225_!\301\027\362\312%\222\346\211\257\374$"
+	.ascii	"\373\372\323\323\f\021\007\257\337\007\273\2028\313a\235\251"
+	.ascii	"\331\326\3131\253bso\376J\226Y\305\322<\321\247{\302\312\326"
+	.ascii	"\322\252Z\2129)5\233\213\371E]lh\334?\230\207\204\202\256<\003"
+	.ascii	"\375\353\374\343\303\323\343=y\336\321M\336\351&\353t\223s\271"
+	.ascii	"\3117\334d['\327\333dz\344\271\355\344Y'_@\327\030.\001\234\335"
+	.ascii	"k\243m\316-\253bE\256\374\277~\344\237<e>\363\245\360\247\034"
+	.ascii	"\214w_P_\002\035\324#\262\262\360\201\t\324?\315,l\"|2O\344\036"
+	.ascii	"X\261\314\252\245\230\253\3200\232Y\027\026\250{=\310\2741#0"
+	.ascii	"\371\302(\266O\301\332\366\235\177dO\345\267f\256`a\236\b\324"
+	.ascii	"\364j1\206\217\311\200\240k\302\255\247\021\343\020\344\324l"
+	.ascii	"{\272\030\r\270{\253\212\370`\036f\003\355\200d\221\354\253\355"
+	.ascii	"\243\245\021\243]\373\303:\374\341cQ\270{1\001\002'$\206}\245"
+	.ascii	"=@\251f\204\202\374\21405\202T\343\321x{\213\377(\313\353\241"
+	.ascii	"\256gc2\214T\263\355\0239\007N\032\332\\\034\264\263\201J5U\223"
+	.ascii	"\215\231C\\,HtT\273\367>\330\""
+	.string	"b\303\221I\226k\201\nO\300\037\007\247 \323\355\t\370\343\240k\241\204\242\tCN\305R\212\246\337\321\023\360\347\244\343\023\fX$-\001\225\202%\234\202L\276\246\245$&\337\t`\320\307`\210\177NJ@\337\323\357\007\364\355\222\367\375\203\351\221\262\265\264\251\246J\323y\035)\fm\3724\323\\w\257\257\356u\013C\310&?\3122\315\3614o\205\335\365\221\256s\275\353Ig\2305uM\315\f\235ty\257s\315c\211\362l\311\345\247\367\336\2733@c\270\274\t5\323^w_1\275\355\364\213\341\222\0165O_1?\327\\|\260\323#8lP3\255\274\336\351+*g\026&\021j\233UV\325R\267\346\342r^O\2501$\206\214\222\306\030D&\220\031\031)\316\030p\002\031:\263\r\020\2008M\262\214\001B\"\034\362KK\257Y\r\340\020\330$\247&\n\017\300\314\271+\224\376t\021\332\314\317$"
+	.ascii	"\303\217t\246 \005\252\001)\302\002J\2078\212QN\361\037c>R\303"
+	.ascii	"\335\205UL\f\224\013\235_\252\032\341k1\303_\237(\263\265\314"
+	.ascii	"\264\304\032\322\325\3150#\t<\234\205[\200%\006\222d}\216_A\222"
+	.ascii	"<y5j\330\365\352\333\271\035l(\224)\322\356\343P\201|\345r\305"
+	.ascii	"\003\317\211\0318V\001\264#\025\"\224a\331\324y\n\316\036Z*4"
+	.ascii	"\317\277\374\373\003"
+	.text
+	.section	.gnu.lto_mspSerialReleasePortIfAllocated.19.bd1bf8b1bfa9e46a,"e",@progbits
+	.string	"(\265/\375`G\002\275\023"
+	.string	"Ve\202I\320\322(\035R\320k\3120+\260\343@\220\nq\r\022\272\033\373&P\372\217j\237\017\275\247#\031\320\205\221^\366\006\300\b\260\021\\\356\024\336\257`\020\177\265q\200\022O`\266\005XUN1\375\234\321u\fB\310&r\247\024l"
+	.string	"g"
+	.string	"p"
+	.string	"\n\\\"~:w\002\340\247\370\001\340\247c6\322s7\373\035M\f/iwOJ\302\372/w\2032\366\020\234\237\312\230\257\363\003\267\240\232M\366\360#\331\335\021[\314\267`&\301\220\0243\237!\376}'G\266\333\210m\303g\372\200\204\343\274K\031\033M\352uOPST\263\315\\\206)\273kY\263y\270\305\333\006a[\305\226\021\002K\272\2732U\234\235\223\311\357\356Zml\323s~\361<w\370\235[\247\264\374\244\017"
+	.ascii	"$\252Q h\227\303\222\217\355M\242\023\347\371w\354\357|\036O"
+	.ascii	"\313\027\246\003\210\314LD\212\370\234\257\263\351\323\f\032"
+	.ascii	"\304\276\343\".\212\320gw\333\261\233+\3714\212\370y\223\355"
+	.ascii	"K\3738o\021{\216\206\013\330\2659\022\332\315\005\241\332\250"
+	.ascii	"\024\210\323\203Q\231E\244\250\366\204\225|\315#=,z4\225Y\327"
+	.ascii	"\203\306\306\2478\213*u\334\345\240I%\333\024\036t!\034\002R"
+	.ascii	"\261\273(@,\021\331OR\214\377\264\200\237R\303!\240\0259\276"
+	.ascii	"O\013\002\243\232\355\f\207\301:\271\331]\007.\376\242\345\233"
+	.ascii	"\370\264\205\227|\355\323\177\201\237\241\312\033\265\031\325"
+	.ascii	"\353y\237B54b~\274\310\260\261\245\342zAP\301P+\253\025\026T"
+	.ascii	"\212\004\203j\205\345\001ll\271@`cK%\304)\223\n\250\325\250z"
+	.ascii	"Ip\275X'\226\025\212uJ\215\257\223\211\001\267\\\252\361\004"
+	.ascii	"k\265\306\223)\267\377\252\215\255s\261GF\357Eg~\2508\007\270"
+	.ascii	"M\223\316\022\3222*\221v:hR\351\037\2508\273\200\252&\275\356"
+	.ascii	"\223GM\021\314\210\231\\\222\223D\336\350\236\001\226<- @\002"
+	.ascii	"\204\330\335<\315\370_\fY<\207\035\231@\002\037WT\274\365\330"
+	.ascii	" \023\300\315%\226\251\354\346\036\264\202;\025\202\367\322~"
+	.ascii	"\rX%\n\003\017\270\360\204\013\306\t0\340\266\205\312\036\016"
+	.ascii	"\031\013\372&\346Z\207*Z)\323\226Z\004\013\202\230\023v\342\314"
+	.ascii	"b4\353t\267\013c\021\355\240b\256\373\326\333\334o{U\025wZJ\006"
+	.text
+	.section	.gnu.lto_mspSerialProcessReceivedData.20.bd1bf8b1bfa9e46a,"e",@progbits
+	.string	"(\265/\375`\347\t\215*"
+	.string	"\nD\370\016G\200\234Q:_\215\t\274u\245\002\252\371bU"
+	.string	"\005\332!\n\203\b\240\231t\277\254\n\302\247\353VD\307'I\245VeOc\320\246\204\351>\207\375\237\204o\307\034\356\321\tgXX\352\342g\177\373\277\021\262\t\3312\311\341"
+	.string	"\302"
+	.string	"\341"
+	.string	"N\021\272\231\237\344JT\374\230\342<\367R\251\261r/\322\0017@o2\362:{\023}\217\275\311\314\fa\202\nF:r\307\323\t\354\261\324$y/\222Wu\034\351\001~v:\237\236\034\317\016"
+	.string	"\334\315V\243\315\320\323\232em$>M\370{\200\237]\020 \255\213\372\321>\027\023\214\"\022\364\321=;/:mr=\252\232g\007"
+	.ascii	"N\2524@$H\354[\305\032b+\257\f\271$\221S\033\326\260\272*\255"
+	.ascii	"\036\237\nFU\332\223\214\237\241\007\246\240h\374,\031\020\275"
+	.ascii	"\304\300\t\227J]W\0165\267\372\001\"A\032m\033,P@`\200\245iU"
+	.ascii	"i1\332\302\232g\320\024T\324K1AcM\250\324\025'dQ\032\270\367"
+	.ascii	"\336\352\335$\004v\237A\367^n&!\324Y\300\231o\204\231%"
+	.string	"0\243a\001?1\257O\371\233\214\201VU\026\273\305\357bj\341o)\261\360\263T+\374\254\246\302\257\362\243\2607/\205\231\301~\"3\2035\323]\300AK]f\326\342{\026\312n\307\331\265%9\366\262\026\031\301}6W\201\234\220\364\275\367W\271g_A\\})\365\034f&:\223\036z\357\245\300\277\342P\204\372\270\311Oao\276\356p*BTrL\352\224\031\371\353Zd~y+\025\363\221\177\356\307\237\347l\306q\363\3156\333ls\3156\323\312\346\231mFm\363i\233\255m6msi\233\253mn\263\371\n6 \223m\006\230\271\367)\255s\271\314+A\230\371\314\254\202\271\306\314e\037\351\373\316\005z\005\265\326/K2\200,\324J\276\256\217\263u\374\320I>a\234#C\255\2352\355u\275I\n\235\314\267[A\334\302\344\306g\231\207>\307\2275f\314U\346\020O\372\332\260\2213\004"
+	.ascii	"\007,\251\253\322\252\302!{\bC\354\n\314\225\337j\021\354bf\036"
+	.ascii	"V\246\314qO\242l\365=\273\246\207\203\214q\354#,\263\210\243"
+	.ascii	"\031\0014\313\032\223\364\372\031\344\372\341\206F753\3743\027"
+	.ascii	"\246\b\2717\306\360\3110\030j\341>{\223\233\351\002\241\b\341"
+	.ascii	"bf\260\232\245\306x\357\357\304\\\2659I\271\224\272\214\337\344"
+	.ascii	"]\267z\002\034a\214cI\235\362\261h\034\364k2\376;M\3239\263Z"
+	.ascii	"\344>\337\34474\266\337\263\270\332\304\214\253_|\b\360\240\221"
+	.ascii	"\324i\211\326b\003\305Pb\344\254TL\345V\337\205\261\tB?aT\244"
+	.ascii	"\301\304\021\321\311B\017H|\020a4t\344\301\304\021\021\257\204"
+	.ascii	"\210\017D<!\243#\336\003 .21d\304;QTd\304\253!\357+\025[2MO\260"
+	.ascii	"f?\222\275\3253x\035y\202U\371H\366\306\267\332\025X\003\364"
+	.ascii	"\224\030&\306s\006\224\215\037\333R\251q\254n-\331\332\331\252"
+	.ascii	"\221\r[5\255\312\344\320\302\262\340\350j\225"
+	.string	"\026\246F\255>\013\217(Z\275\360\365\256\034i|j\221\373\305/\365$v\365\025\005C\232\226\3650\211\236\341\3739s\357\255\300\334\241ex\270\351\340kX\326Y-\311\226\312\320\032\243\300\031\237-+ZO\224\n\323\202\b\354\224O\241\255\347\223\255\346\217\354\3101W\213f-k\005r\345%D;\231\365X_\307\244\241n*yYu\344\034\271\234\307l\027>8\352\030\307jm\341cr\3235\200\315\250aD\346\240C3\023$)(J\032\003\260\002\021)*\333\021\340@\206\240\241\021\021%m\222\215\003oR\270!,\2254`\n\212\\\2203\344\215\353\036\350\023O>\320_\207>\275\341\n\205l@#\311\241\017\33482\252\271\274\256\300z_\310\340g\275\331\224\340\223\370G<<\3257c\202\272\004\2772]k\b\353\253\225\214\321A\203\254\220Z\201\211\275@\345]#\021F\201\274\364\275\031\226\237\312"
+	.string	"\020\313\364\237k\035\350\234\350\242a\252\262\255\345\\\201\035a<\332F\316\310\357\315\362h\242\236.\332\237\375\240\026\024x<\245\265$SM\004/\234\213\254&'\315\222O\331\251\243\r\3178\006f+|\334\222\341u\205a\257\f\033\204\026\374\315\247\271\037\224\242\035Vj\264\354\316\353\305\313\203[\223\322k\342\265\273\031O\330"
+	.string	"o|\322\352\216\271O\356\350|\327~\320\217\020\0347\347\257\374\241\2662\211\2033\\\030\265\333\327%\315\025\037\251\377\313Nw\222:\360\350\022.\"\3342\270\t2\002\\\002\006\211\300n\2413\225\234\310\301\256l\271F\216\016\027\333\214\336/\204\342"
+	.ascii	"\273|N\030\326PT\266\204h\017\2714\317\356V\017\375\271}`\025"
+	.ascii	"\264\301 \240(5\354\305\335\314\320\324D\246\251\2231\242\340"
+	.ascii	"99\236@\367\016Q\t\307\275T.G\215$\217\312\374\"\214\375\232"
+	.ascii	"\211\037\221\0130\354\020\b\204_\347\323+]\350\236:\345\355\347"
+	.ascii	"\233\334\325"
+	.text
+	.section	.gnu.lto_mspSerialChecksumBuf.21.bd1bf8b1bfa9e46a,"e",@progbits
+	.string	"(\265/\375`\203\001\225\017"
+	.string	"\006\036iE"
+	.string	"\255*\035\260\237\346\004*\345F\214\311-q\226\237\007\037\217\306 \004c@(\254\220*\344\021npE\031\325\206>\335N\323_\032t\rPUU\211\342\004\226\352h\322\003\377\256\306\017R\263 \237\220-eJ\001U"
+	.string	"S"
+	.string	"T"
+	.ascii	"\306\350\276%X\200r\352`\f\266a\275Fh+vAO1X\023\206a\370\b"
+	.string	"\3361S\337\242f\312\377\310P\264>\220oQ\303\202i\260\370X\361#\023\323r\332\323\365\2512r \271\236\366\350AVk}$O\315\203\335u\266\276\n7w\333'\333\r\354\327\002\377\366\225;\036\2745?\273\017`\003\"\305\201p\027\026\316,\314\326\262\3016\312\346\330\316\021WA}\305/\361bW\027b,\273\233a\006\335\267\002Q\323~\210\213@\035\374\030p\261+\225\227\002\360\002\270o\335\003p\337\234\371Y\312\272kb\202e\027\314\b\217\372\024\225\023\253\224\261\347Q;u \253\211\230\304\335\335h\216\246v4_FJ^\243\340\321e\360?\270o\034M\025.\013!\031\032\301U7z\222\221\020\351\240\312Pk%X\237*\212\r\202\344'&\023c=\261;1\3159xo\272\257\374\232\203?\367Y\034\242\r\005\235@\021\342\310\3034!$\222\020\352\034\362l\2004J\"\023\204\016\323\310\343\320"
+	.string	"\215\274P\311\344y\b\230\324!*y'\022\251\344q\300\275\236\3301\246^]j\321\372"
+	.ascii	"\023\242\252MQ|\332\273\031\227\227v\032\215\006Rt\303\251\252"
+	.ascii	"\313\245D;\352\230\233\246\272l\033#  \220\002\241\303\351\217"
+	.ascii	"1\314G#;\372Al\\\253\2761\206GH\2461\215-AP1f\363\275\373f\031"
+	.ascii	"n4\"\372\235WC\236l\204\033F\310b\031\256\t\r\034\032a\021\265"
+	.ascii	"g7\265\027\314\"-\246\344:P\"\246K<\001"
+	.text
+	.section	.gnu.lto_mspSerialEncode.22.bd1bf8b1bfa9e46a,"e",@progbits
+	.string	"(\265/\375`\340\006\375'"
+	.string	"\nGt\017Dp\250M:\007A\350\001\030\201\203\020\305k\217\320R\347\036\341\306\341D-\027\001mK\206\037\366\257u\276\013!\342\300\373\267\203Q\211A\020\027l\304\251t\037"
+	.string	"!S\342T\032\300\001\037\333\2104B\210\224I\006\347"
+	.string	"\317"
+	.string	"\344"
+	.ascii	"'\363\265\335\251Y\365\266\216\352\226\221\212X\255\025\305\030"
+	.ascii	"+\264:a#\304\354@\253XJ4V\201\253\225\013\304\317\326\r\305\342"
+	.ascii	"B\317\214]\340j\255\032$P\020\276\354\n\255b94\243\032\\\255"
+	.ascii	"m\rnn\005\224\301\360\030\364;\357\236\354_\204?\3728R\255Q\330"
+	.ascii	"\332j=>\330\006\350\315=\242\273\273\347\362.\302]\267\362\370"
+	.ascii	"\325\225\373\361E4\023Tk\375\365\256t\336,\237t\336l)\027^\227"
+	.ascii	"\242\271\263l\026\356s\033\326^\032\252\022\247\330\205u]\222"
+	.ascii	"\247\245\2021Bj>\207+II\340\354\007\330\327\356\303\302\205\204"
+	.ascii	"Q\337\023\"^\317\315\341\362\"\362y\344eQ\327V\331\253\265\356"
+	.ascii	"\272\206\334\245\322\033\224=E]\303\222\301\0227E\276v\016\322"
+	.ascii	"\245\305\234\333P"
+	.string	"k].v\021\371\356\276\273RvW\305\356\311&\031\300\354\f\377hq\33421\367n\212\025\374\242\257{w\313\261t\247\270\313\342iZ\240\331\360\342w\207\307y\223\333\005X\234\342\021$~\357\306\200\342\027w\327d\253\261v7\352mA\264\326Za\317\346\001\210\206\3718o\276sD\334\306\310\2628n\367\210\305m\334}Yk\255\333Qvu\274N\037\363=p\265\257\357`~\003?\376\274\224w\300\317\276MD\274LD\274K'\257\322\311+ \345M\322\361\006Hy\221v\274G'\257\321\216\267(\345\005\240\343%:yw)\257N\307\233\246\274h\312\233Cy\317\224\327LyK\224\267s\274|\362\276\302n\313\033\003\266Z\207\304\031\252r\3143V^\366\237\375b\3761\277\232pov\264\247\005X\353\243\251\211\232*\314\316pI\217\233\372e\236\366d`\327\273\034:\f\003\355\332D\326\031D\206\352"
+	.string	"\235i\353\232\315\210\311,_\247\r#\214m\230D\033\371\264\253\242\257Z\253\005\363\353\346k\264O\204\241\021\223\265V\254\\\033\227;\303y'\263\357\274S\207\033\234\022\303y\347\200\016\262\311&#\205\302\300\311q9;\327\027\300\372\020\223\373\341z\316n\344\23312\023O?\251\210<\320f\237\230\034\320v8\365\312\3428\364lc\371/Bpm\345\325Y\342\tq:We\033=\371\036\261\316f"
+	.ascii	"\2759\3516\356\236\304\331\3153\242%L\236-&\264\273\"\376F\242"
+	.ascii	"\273\221n\326$$8\357\334\335\bO\343\255\005\364\217\t\326\260"
+	.ascii	"g\3636&\366a\373\264\247}\361\246\371\2473j\006\301=\356V\247"
+	.ascii	"\257\017tS\300\033=\005,A\025\224:\253d\320\350)`\211*\0314N"
+	.ascii	")\253\240\215( \215(T\007\320F\024\024\325I\025\224\352\215\202"
+	.string	"p\003\252F\0250\030\203*(\365\233\252\001%\365\213\252\n\376 \024X\034T\300\252\237\016\0348\252~\273c}Y;\212S\367\262Zk\257\312v\224\265>\321p1?\034\030\216[\246vJ?\343\\j\246\376p\211\326R\367\250\022\207\230Db\245+B\224\332D\362\031#\313r\360\227\271Y\r\001\fD@\233\310=\272$v\363\365Q\007\350$\244\016\360\262#\365\322\024\257\243\246@\206I\217}]\324FN\274e\324<<d\013\204Y\204Z\370\305\242V@F\211\2344b`mi\033\367M\326$s9\031k\312\234\367\363\246\016rD\013\200\346SD\"`\242\270\247\002_?\364\344\216\235\320_>\347\315\006\337\025r\021z\341\027\001to\330\001\200\213\250\221D\306\220B$#\"\222\202$\3110\006\220\002\021!\263z\021\2009DeR\220\024r\217\245\3704\302\363\274\361\346\210\204^U<\017\036\252@"
+	.ascii	"4\002\312nX\225\361I\373G\225&E|\233X\353k\003L\0240\350\025"
+	.ascii	"7*^\2742o\312\246c\207\362R\311EAH\001\326\377\3666P\331\264"
+	.ascii	"\036\237\021\265@\3020x\366\213\303M\024`\033J\335#\025\003\207"
+	.ascii	"\331\025\017=\t\201N\t\373a>\200;\022\363\371\257(+\nA\265#\321"
+	.ascii	"\261$)8P\200\202\373\177\002\207\310'x#\271\030\260\353\264,"
+	.ascii	"]\030\254\207\312\322\242\376\013\007\2251d\357\345\310\357n"
+	.ascii	"0\300uF\0342\312\342X\2361\242'\375F$\212\203\227%\362\0278\204"
+	.ascii	"\231\236C\223\0360\360\234g\020_\377\300\007C\033\037\315\267"
+	.ascii	"\013\220\214\023\005\272\362\365\326\3022\006i\304\034x@h\251"
+	.ascii	" <6\320O\222\251\245xH\201\330\351\3118\202b\262L\360(\030&\252"
+	.ascii	"\016G\244\341\223v\316|\264=gv\251u\017|j"
+	.text
+	.section	.gnu.lto_mspSerialProcessStream.23.bd1bf8b1bfa9e46a,"e",@progbits
+	.string	"(\265/\375`\207\004\325\035"
+	.string	"\266\266\274G\220\334Mc\004R\022Bl\037$\242\030I\345\207\225\326\221\034m\b\200\rea\2764)\376\303'\370\270\242\346\022\r\030\303\024\225D;)&"
+	.string	"\200\b\275\n'\006\255\030qu\t\277a\310\250Y?\262\367\336[\312\224\002\243"
+	.string	"\237"
+	.string	"\254"
+	.string	"/\372\013\355\001\321+\253\264\263{\357\316K\347\320\227\t\310\333l\277\332\247\372\223\364U4\216so\324\227*\367\022#x\007}i\342\007\230/\321\0130_:\265\313N\024r\317\241\031\223\025\332\2757g\203\230<I\274\317\232\276\206\236fI\332\232\372\275\327\222*J\336\304\222\370x\030\240\220\234 \344\022\273\361\n\220"
+	.ascii	"{\324\023\252Ix\363\210\323K[p\t\027\364U\222\264\360\324e\007"
+	.ascii	".\250D\036"
+	.string	"\f\2202\337z\275\021\364U{\343\037HQ\371\005\235^O\f\367^\327_\260\351\006p\333Klo\260I\244\026\272\225\030\350\275\267\307\257\262\242\005Z\344\245O\303~\353\271&6SUH\365hq\020\271l\254\035\332\304^=\023T\227\032\266Qv\216Y\215\363\256\373\346Z7\356U\377\355\305\373D\253\315Zu\211V\223g\2655\253kY}\035\034\025\230\334\325\2759\216knXyE\352]?\326\257\365\027O\332\267\317\345{\331\326%\343\267\351\336\006\021\246\032\032P+?\353[ZG^Kj\316\356%R@\247\374*=\326\214_\037\020\304\360xv/P\002\372\362\005.\300<\3217\332\366\322\216r)iCfiwE2\004\365\\\317\342\360\237I[\332\n\036>\366\201\264\245\216\253\264\252\003\246\r\342Y!,\"\275\001\323\036\361,\022\356A\321Xk\227x\330\031\034\353{\361\341\021\002f\355\267N"
+	.string	"\314\247\244\336\233\213Y-\216\275\017\315\215\255\226\207\rS\233"
+	.string	"\307\343\021\3552L\234\275\261\367z\035\"\306\367\224T\217\366\267\370\234X\214M\356E\372\317\317r-&|\302\247\376\347\223\342_0\334c\377<\013\310=/QH\035\177<\222\214\224i!\355\320\350\217L\234\325q2+\202)U5\306\325[[\307\242\376\207\263\027\376P\262=;*~\252N\267\353\300\323\031\035\251\250\031\351Z\004\001\025\231B/\342\rY\007\361\270"
+	.ascii	"\022\332\351x?E\274\241\334\013!\240\241\\\320\216\227\343\321"
+	.ascii	"1Q\221n\2273\"\"\332\345l\304{\033e\fH6\251\366\3014\355\313"
+	.ascii	"\322\230\266\001\031+\344\022;\202\332\241mde\216\265du\347\247"
+	.ascii	"\275\341/\363\254N\234\306\220\367\336{n\235\301\2256S\037\320"
+	.ascii	"\005\266d\332\241m\b?m\216\275\361%\225\024\025\337\323\f\362"
+	.ascii	"^\250\013\307\372\317\244\324\243\035\334\254\2352I\247\246\026"
+	.ascii	"T\377\314\354\\7\223>\271\2159\030K\241d\250\377\371\346\305"
+	.ascii	"$l\311\366*\032\030\220\264\322\016\375U\250q e\034R\310\031"
+	.ascii	"\231\221\tD(L\232\003`\002\221RG\347\021PQg\2504\205)t?#\237"
+	.ascii	"\324I\206\020\364$\204\203\262\312[\360d\223S\262<\"\345,\310"
+	.ascii	"\221\214\344\315G\311\350EV\232\222$\212\211\026\327@\262\013"
+	.ascii	"\211\232\273`r\364\375\261A\317\213D\352\030\022\266\254\237"
+	.ascii	"(f*\2073\026\2517\024\324\350>\226\217\n\006\310\230)\263YC\323"
+	.ascii	"J:\222\305\221K^\376\370\005n\352\307\334X\030JA\3557\232\304"
+	.ascii	"5T\275\tV\271\266&U\n=\224\352\200\3506\3055\f\356ks\316\231"
+	.ascii	"\270\247n\365P\307\261\254\036\315\246\3676S\t\305A\3501\204"
+	.ascii	"\315\003\270\375\b s\f\"s\301\251\003\3424"
+	.text
+	.section	.gnu.lto_mspSerialProcessReceivedCommand.24.bd1bf8b1bfa9e46a,"e",@progbits
+	.string	"(\265/\375`s\004\325\034"
+	.string	"6\362\262J\240\230Q:\220\340\0062\351\323\367\004fLo\300?\321\364\2452S"
+	.string	"^x\213!\002\336^\302\206\016E\3322@CT0\205\206\2416R\343\357{\210\363\300B4Z\345\3457\205\002r\320[F\377\021T\314\265\b!\233\354\235d\231"
+	.string	"\222"
+	.string	"\243"
+	.string	"]\003I\247\t\t\261\033)\205\371\373\324\365C\307^J;\t\307cr\245\223\344\276\240K\311x\025\245\255[\301\273\342\025\273\033\302/\347\230\277\257\3617\244Mg"
+	.string	"a\265\276\007\344\262\351\"\337\321Uw*\201!\230\277\314\314\207:/\210QW\272K\2521\332\031))v\2470N_\200\3745\177C\376\332\246\243\037mE\371\017~4\022e\225\323\t}\274q;> :\031C@W4\0268\n\222{\360\325\206\216\250\3262Cws\315\351\222\316\367\314\254\303\3140\230\307\"\001\027\226@\202\225;\024Y\251$,v\017=\307w\362'*\370N\277\314BV\237\373\345\313\310\331\255j\034c\246=\370\202c\277WIH\304e\n\307P=\303\234\nU\373\203\371cw7[\037\314\\\031\347Rg\327\323\337\300{\177\rM\3452@e\262\254|\001T\036\315\312\266\254\\\311\312_"
+	.string	"\264\243\370\345\202U\367\321\0312\235u\237\b\271\324\377\373\247~\252\217\314A|%_r\340\203LC\3653\366\222Mw\023\220!\335H3&o\022\364\251\237\007\007\346\230\245e\003\326e_FV\210\2317<\f\017\203\035\205ai=0\355\230\242z(\371\337K%-E1\007\356\334\312\201\244e>q \n\216]Kv\270\227k\357\223\225#\275\321v\261\366v\264d\231\032D\210\352\031\256\326\332\033\231\341\017\037\356\230\325\326\370\252h\365n\267"
+	.string	"\241\260r`\264\234\b\206\335\r\342YB\230\335\035\303\322B\204\202\235\023\020\371{\213\203\272\222\303\221\200d&\361\340\016\2330\321\037 \231O<\210\202cWIhD\314\224Z\204!\326\245\354\f\350!\254\360\033\245\366\231J\2123b\334h\270;+{8\370\2346\233\363\307G\346s\222=\034\\\364\310j5[\316y\322f6\334\210\333Y\273\271\2355\313\263\t1d<8\332\311\342v\326`=<\262\032l\206;a\023\020\260\355F\303\301|l6\034\214&\3553\216}\rY\"F\177S?c7\017\f\247\372\211I~\307\261\326\347EkitPk,3\372\204\026q\241\225\245EdP\371ed\026t81\361\310\274\352[\350\021\001\303\006;\024\n\215\252\317\261"
+	.string	"\253\034Y4\254\320w[\304+\3132H\227u1=\371\272\024\325-~\325W}\211\206\340\253\002^\250aD\247\0202\210Ff\202HZ\220\244\003\200\002\021\242\\\017\021\2209ddR\320\322\001E]1\023y\367\177\272|&\304hZ\321\374\020\023/\030\234NRB \r\312L\225M\031thL\344\305\320\246\311\234\320A\005tY\007\217F\036g\021.\334XP\371GirxO\332h\304(\276\f\031\355[\321\225\303\371O\312\345\001\352\017\206qw\375\213\006\246\203@Q\213\242\273zp\013\216FT\245\315\340\303\203#k`\203=\nl\2756f\261|an)\207\202\007\3103\206\013\2238\340\214G\231@\234~\206\372\365]D\224\036\233N\237\277\374\024&\314\205\267h\320\257\261\227\312\365\177h[\235"
+	.ascii	"\302L\374\253\226,\232\202\n5"
+	.text
+	.section	.gnu.lto_mspEvaluateNonMspData.25.bd1bf8b1bfa9e46a,"e",@progbits
+	.string	"(\265/\375`L\001%\016"
+	.string	"\346\330\\D\340\3266\035\324\223:p\341D\341;\254Dr\216I\243\0269\223#\262\310\246u\004\313D\260\270\264\377\241\303$\006\253GZ+Zc\007$L\031\306\241:\b\034s\345\232\031\226\200*v\330|k\273\233\334)\005I"
+	.string	"E"
+	.string	"J"
+	.string	"\376l\234\2074{\315\b\ta\363dw3\235\371\367)-\215\237\017\363\371@\212\004\341\001?D\353\223\342\201\002U\\\255\317\r\270#"
+	.string	"x\262"
+	.ascii	"\310\300\211\361\032\217#@S\214W\313\356:\242\300\023\367u\333"
+	.ascii	"\026lC\260\317\"\032c?\365\313\207\277Z\321\307\0040)\342@\311"
+	.ascii	"n\211\325\224%\"\177\300\260}\217m\215\366\247\301\367\320\345"
+	.ascii	"\003\326dD\004\203G\3733N\343{\352\345\004vc\206\364\330\r\027"
+	.ascii	"X\001v\351\360\007\346%\366\002\3632\".\036\305\315\313k'\247"
+	.ascii	"\t\224\224\246\360Ab\211\025\357M\233\303m<lwY\374\033\244\016"
+	.ascii	"\006hv\367.^\346e\007\205\252FU\212+#y\221cBU\306\t\3562UW\264"
+	.ascii	"X\3318r\212Q\354\320\024U\306\276\265\273\353\035\bC\204\n\232"
+	.ascii	"\207M\013i\235\n\251\343$\214<\321\345\320\212\006\320\326i\336"
+	.ascii	"\204\221'\3126l Q\026\352\274l\005\201\271\221\326e$\216\353"
+	.ascii	"2OXzKIM\363:\234\324\250\f$\tL\020\251W\n\276\360\233\r\333="
+	.ascii	"\261\3708\236#\203\003! \220\202\021\271\273\001\377bH\241\361"
+	.ascii	"\b\201\0024\007\022\267gc\2712\260\203\004vD\345$@\230@F\234"
+	.ascii	"\013\2715\320\362\276\262\217\214\nA\017]\004m\013H\233\304\016"
+	.ascii	"\210j\360\346\006H\024\360%\220\313\205\257e\205\274\342\246"
+	.ascii	"\321\b\024\n"
+	.text
+	.section	.gnu.lto_mspProcessPendingRequest.26.bd1bf8b1bfa9e46a,"e",@progbits
+	.string	"(\265/\375`w\002}\023"
+	.string	"Fc}F\320\324\315p\330\340W6\205g\243\021\250$k(}\251\230@\351"
+	.string	"Q\016.\244\017\325\222\023\232{\f\f\027\262$\024\277<\311\024\036(/\344\t\374\341\225\247\022\b\025\221\037\024B"
+	.string	"T[+B\242\355\266\367\2262\245n"
+	.string	"^"
+	.string	"l"
+	.ascii	"\007M\263\245\336K\261\253\037#\270\243\251\335u\351\317i\027"
+	.ascii	"W!\370i\322\374\332\305\222\022B\253\027=\202\212\017!\316DW"
+	.ascii	"\023\246\254\320\301\302\007zB\350(\030\376\214Dznt\376}\nvz"
+	.ascii	"\340\264t\035\276\224'\024CX\272[\352g`g\202\252\245\263}*<\234"
+	.ascii	"p/z\332\350n\231+\226\335u\346t7w\311m\217\260\335\300\316\236"
+	.ascii	"\342\356:\360c\\\330 \002\035\364g\302\203\327\027\035\201\210"
+	.ascii	"q\210G\223\243\335"
+	.string	"\253\245\372\330\327q\034G\353\316>\3577\371\322a\246AM\177\232VMg\246\337:Yz\202\020d\027\304xd\235@\246\026,\333O\3730ND;o\346\002vwB\226v{\f\274@<\350\336S\302\203\342Q\302\317\221:A\313s\303W\262\224x\320\231[\0176A\366m\330\226R\034\245\251\335\332w2\267\tX<\267LBc\006*\350\342h\310'\347\005\r\230;\242\220\222|?\376\n?U\236\221\217[V\351\247\003\200\324\004\331l\3413^\252W\2122I\033\026\313\347R_\204\307\246\265\277\352\304\210\244\236\205\327\nFQ\267\254\262\255\3412f\0012\262\230\204\230\031l\345\227\025\f./\031\314\254%f\006sex\271\300\\/\262\231k\205\200c102\227L,&s\261z\373ou\227j\363k\334,\337\356\256\210\222\241\332\023(\250\334\264f\273\345M\034ZP\005\240B\325\246$\252\3438"
+	.ascii	"&\241U\200\264_`\3629\267\230H8\331\264\346'\375$\307\251\226"
+	.ascii	"H\036\340\210\200B\365\361\227\0343 p\002\2219\274\003\2571\346"
+	.ascii	"\361\326\027M\303\225=\004%]\f\315\376P\025\354f\226T\265\305"
+	.ascii	"\335\3337\3361\307z{\005\224\274\235\305\310\311\tle\357\310"
+	.ascii	"c\351\311\305hx\304t\215\026\217x\211j Q\232\013\264E9}^\301"
+	.ascii	"\003\017t\265k\337\035^\330h\005\004\326\331\365\032\rp\235]"
+	.ascii	"\315k\264\360\222\037\312\001\236#\230\200\266j\024\007\222]"
+	.ascii	"\255.YXQ"
+	.text
+	.section	.gnu.lto_mspSerialProcessReceivedReply.27.bd1bf8b1bfa9e46a,"e",@progbits
+	.string	"(\265/\375`\332\001\255\020"
+	.string	"v\337nG"
+	.string	"\261&\035\177\3211wkhj4; \376\274\263\023\"\016\217\263\f\f"
+	.string	"\213\374{R(\340\205\346\2651\035\221{ \314\306\016\366i\357\346\237\205\276 \312\301\304\307\275NnF\356V\347\200\301\2771b\311&r\247\024U"
+	.string	"U"
+	.string	"_"
+	.ascii	"K3\362i\004\333\347KR\264P\n\331\230\235\030wi?\304E\270\236"
+	.ascii	"\343r\322.,H\305\256h\300#\333\247\305\007\320>\267\213h\237"
+	.ascii	"v\331A\027c+\262\36103\342\330]N;\334u\351\362?~\024\326\274"
+	.ascii	".E\007v\3272\254\301p\353m\027\260mb\313.)\377\306\037Y\374\360"
+	.ascii	"3\344+\355sfp\001B\350"
+	.string	"E\016\331\342K*\007\373\331\356\256\025f_\374A\236\363\2176imJO\221t\246I\353\224\226\231\364I\"42N~v/\f\355X\240\351\363\341<\277\375\217\376\360u\276\343:O\353+Csbs#\264\001\013>\252\3304Uc\360\026S'N\214L\355\006g\241z\315Ty\310\340\300\310!KU\375L\017?\370\n\b\233\324\021\317\213\0349W;\302SL\260\311^\371x\262\3513\245gFX\303GQA@,\264Q?\321m\273k2\241\2220\200\306\215\213\366yu\320s#\324\220\222%>\211\227\b-\225\327}\263\305\244\245\362\272\024\020\354P\254O\201\007\256H\036\270R\243HT\247\324\327\201+\036\270\342ZR\247\025\207\372@\216\204\200Y^\367q\024X\254\217\373\020\367\331*\314*5@/\n\343V\266\273\241DH\007E\263\023\034\006\n\200\030\354\007\207\215\222\374\210\217,\033\210Z\372\350"
+	.ascii	"\212\321\2275\265\003$ `\202!eh\007\257\030s<\251\302MN|\324"
+	.ascii	"\005\316\367\362\032\033o$\362\f|\324\301\034\227\341m\220\364"
+	.ascii	"\203\311Y\331\360\251s\013\bq\243\246\t\314\206\226A\266\321"
+	.ascii	"\260\275\031\231\370\302\374\217\260\237\2701\005\273\034\263"
+	.ascii	"\3368\206\204Q\342G\004l\024\320\345E\373\310"
+	.text
+	.section	.gnu.lto_mspSerialProcess.28.bd1bf8b1bfa9e46a,"e",@progbits
+	.string	"(\265/\375`\216\n\2556"
+	.string	"\312[\350\024A@dR\007/\206\346\203P\007\006\224`\307\r\325\324J(\b\231\201.\364\020\032\024\253B\300\022d\272\333\320\275\336\334`\300\217M\377\257\356t\372\365\2572"
+	.string	"\315+r\360F\312l\311\326\366\336I\246\024:\001'\001>\001B\330\226\270\310VG\003\273\332\220%d\214\265V\306\203\320\333\266\n=w{\325\321`O+\322\3038\026\303c\023\307V\t\035A\350-\223'\271\336\262\216\344z\333p\367\037\267f\211\375\215\356\311\366\027\307\261\323O\373\330\357\254\325[\351a\017\240\224\004"
+	.string	"\351(\211<.\031\215\212/q(\f\272-\373\031n\017\202`s\004s\002\241[N\017\300\"\257\321.,\205\253\254\204\205\213\213'\001\330\"G\315HGI\266"
+	.ascii	"\236;b\374\032-c\021|YY\343fQ\262\214\274F\263<\363\321\345\242"
+	.ascii	"\342K\30627b/d\375}\3715\n\306\026\017=\365\334,\032\226\213"
+	.ascii	"4\342d\361\367\313,:%\023\331\016hgd~\215\236\261\257\326\006"
+	.ascii	"\307+\017\017\210qu\271\220\205\340WW\310\257\321.6I\213\013"
+	.ascii	"\324\355\374\200YTJ\016\306\230\363\243\342.;\241\216\0234\277"
+	.ascii	"F\265\260\311+~\326\336-$\271\r\222\325\001$\306\265\305Y\266"
+	.ascii	"I\017\030/\343V\026\213\324\025\247\307\345<+\331\302\312\357"
+	.ascii	"n\016A\316\255\n(\306\305\305s\020D\034\307\235\241[\\\336\002"
+	.ascii	"\274\333\331t\367V\367\360@\254K\271\371\231k|\260\362\241\356"
+	.ascii	"\206\341u\244\332"
+	.string	"\273\276\ftf\274z}gr|\216\f\327\333\374\355]\037`Z;\034\031\f\366@\273\233\210\277\231\341\224%\216\343\rw\356\246F;\325\333\266\201#;\024\207\353\355\200\177;P(\311\367w9\217\240\327w\265\327\266\350H\016\314V\362\324\361\362/\355\266:\363\217\345\305\275\221\351\037\353\256\320\344j\356\020<\215\273\003Osg\340t\336\013\274\316;\201\307y\017p8\357#o\363N\036s#\211\271\217\304\334\3067\267\0211w\321\230\3735\312M,\346\036\026s\013\213\271\203\303\334.1w\373\346f\337\334O\314\235\207\271\375\202\204j\330\027Y\234\337\263\306Z\201\211\342\274\326\256\213\323\271\327\271\303\271\307\271\267\315\265\263q\273~\353\226LNk\254ed\356\257\372\027\025\322\371`rZ\r\320Y\253g\317\267\3665.\327o\\\263\t\2379p7\234\225\307H\242C-2<\245\320\325\264\273\365\353m[\300"
+	.string	"{\033\020a\354%\b\367&\307/\216\255\021\274\355\034Bo\375M\023yY\357|\271A{\306|\304\237Hr\226\361\313J\036#\377@\235&\373@\211+\2764;\341\262\016\32409\016\314\243\346o\020\205\f\301\n|%;\264\351'@\331\312\313\022\352=\247/<u\337\367\253\324\021\301S\023\323D\207"
+	.ascii	"\337\037b\005\016\230\003\023Dt\035.s\211\357f0\231\027\202\313"
+	.ascii	":L\377\b\r\"~0M \231\341\203.\360\227\354\320Vjc(/\213\212\033"
+	.ascii	"0f\302\227\266\353p\207\357f\302\017\376\360_\321S\312U\021\227"
+	.ascii	"\301\013\337\355{\332]\345\300^\360\301\247A\007\347\351\305"
+	.ascii	" \273?@\f<&;t\3013e\275\263\023\274\373C\275D\tr\373\335\260"
+	.ascii	"\031\030-;4\301{\224*X\357\354\223\232\232V\371\374\264\357v"
+	.ascii	".\341\316\020`\332\343\361\243\346\026|i\b\267\033>\343{B4M\275"
+	.ascii	"\354\351\031\336\025"
+	.string	":\033\304~\267\b\327#\3214\245\206U\361\314\270\201eOX\365\312\366A\003\021\310\335'Pd\207\262\337\240\r\234\274\253wf\270\322\321\342\246p\377\231k}\226r\376\356\026/\262C\377\255\300\242\200~X\357l\207\353\223\253\266lX\374b\336o\376\232\b\nP\236#j\312\252\251\\B\t\253\230Ae\211\252\346\022\031$*\207\362D\025sI5T\226\020\322\203*\312ERY\"\207\362ijj)\242\331\214\202Z2YP5\247\220\236\252\236FP5S(\227*\242\252\236\254z<\375\210:j\250\t=\236x0\243\2328\250\232SNJ\036OSNP\314\246\323\004\002\275\244\212b:U-\227L\247\327\032\373\217\2619\t1~\200~G\376\252L\200\227\366\321+\251\302\267Zr+\351\374g\315\217\230I\373(\275\024\210\233\374\n\357n\356\344\204omOM\330U\016\314_\222\262\3444\237\231\2757"
+	.string	"I\\\3443W\201\2234m\241R\tC~\313\346&\r\211Cf\002k\031\337\324\345a9\201\006\342:\322\220\217\337G\337LS\244\036P\375\274\272\216\337\316u\245e\310\306'p\224\027P\244\214P\371\23681\276\021*\037R\036\325.)\347+\310\360\236t\307\314\345n\347D@_\232\274M\177\364J\254\334\243\317jz\320\b\302\323\007+\037R\360\227\006\017\211\347F/\242h\3643rTj\307\364L+7)\376\236\351Y\030\032\033\307q||i\273\377\033\330\330\335\322\217-Q\222\241\027\262\203)0\030\2017O\002\200\310\250a,\007\tDhddDD\232$i\f\240\002\021\241\262\316\001\021"
+	.ascii	"14NQ\211H\355\034\324\345W\214\370>\222\\O\375\267K\323@\205"
+	.ascii	"\310Q>\376Jc\023p!6\340\3255\007\324r\210\267\333\236\032*\267"
+	.ascii	">D\371\301\334\375/Y"
+	.string	"+\362\2267\372\033\f\247\234\024\246JRd#\2372y\251\2417\217j\250\237\352\352\013%\037\306\365\030\303\374V\224\275\356\003V\366\207\207E\316\241\327`\201\324\005.\337\204&\200Z\275\270`)k\313\232\271$\265\246u\253\275\027\027l\362\241-C}\023\324\311\037ht\214A\222\230S\365u\f\r\241\005'\r\376v\003\247&\370X\377\346\255S\366\266+<\351\343\005Q\320\365b\214\324A\023\200\324\334\t\352\343\333-\217\360\223<1\252\2412z\031\"\001\243\272\036\331\254\025M\234\003\220Ff\275\316\337\275C\b&I\270a\260\231\233\243\375k#\264\337\324\276\003\266\301\300(/\006?\231\221\220\273A&\342\206{\210#\270\013p0\243H\2215\236\360\323W\357@\347Z\216\222J(\b\205\031\365\003 \345\320ub 0$\312[Gs!\365\371S6\241Y{\006<\023q\313cF\3727\371)\341\253 "
+	.string	"\034\030\246\001\354\027\214?\260\357\345yk\030\321)\240$\3102\231\013\006/\361\350U\036\247h\323\324\361\361bw\223\032\274M\255\020\":\352\036m\267C"
+	.ascii	"\034Cm=\222a\272\374t\212\2321w\372,\246\257\242S\001"
+	.text
+	.section	.gnu.lto_mspSerialWaiting.29.bd1bf8b1bfa9e46a,"e",@progbits
+	.string	"(\265/\375`\324\001\275\021"
+	.string	"\006\341vH\320\362&\035R>\016\372\0040\346P\367\315\250\nY\0068\325\226_A\233QUM\f\372\037\"\240\211\264\266\311\374\276\336g\316\002\342'\002}\016@\213\007\250\335@\232\\\2542>^p\212\306P\b"
+	.string	"\304F\310\336R\246\024c"
+	.string	"_"
+	.string	"a"
+	.string	"s\342\300-\341}\304\335\236\306\276\362:\031Wc\276\354\253(\340F\315M4\360\242\236\013\233w\261A\315\347\004\213\026\023Wh(\351/jnT2P\3621\243\201x\214\005\234zrX4\rq"
+	.ascii	"N\221\323o\327\031\032\214\356mW\244\032\271'\"\232\315\325#"
+	.ascii	"\231sZg4\017w\310m\223\260\215\300~TAJO2A\\\264j\347\234\262"
+	.ascii	"]\036\033'\323whZ\021\343\335\261?\253\345kw\224\352\215j]\365"
+	.ascii	"\001\374\207iJ*B\322\2344U@&\223<b\361\332\355\337\036\344\333"
+	.ascii	"\374]\276\306\262\232-<\242\031@;\346\304\211\\Zduy\273\305\376"
+	.ascii	"| A\213c\307\231\240y\212\037\031\031"
+	.string	"S\001\252R!\216\250\272V\267\033\346t\260T\327vQ\320\317vYI\037\230`Vf\345\340\324#BF\235\271#\356\0368EM\361+\235n\230\313\001\243T\266M\036cE\"-M\3159\025\330\316\360\\\205\017\307\222\317\234s\001\214\013\235\370*.\375\272\240\237]\372\260\356RW\"-\375\260\305\375\376v\031\030\\\023P\036\250\204\257\224\020\227\214Xh\231\204.\230\204\024\330\t\210b\322:\001KB\0308B\300\257\024W\b\252\274^!\370\341\346w\307\007\272\003(\032CF\236\037\353~;\004(\242!#\371\307:)\327$.\373\262a\265<\016\220\323}+Q\250g4\352q\3169\275\3451K\027\367\333\333.y(\331\210\321y\321\252& `\202Ae\332\001\257\030\233\2056\306duw\343H\251\361NT-\200\005\013\034\013\257\311m\314\322Bk_\022\254Q\320+X\325o wZ\321l\031\331"
+	.ascii	"\330(\243p\032\215\277E\255<\025\247\024r\3746\312\0134\246\253"
+	.ascii	"\232\323t\262C\341\032/\275\246\201\270\327E\237"
+	.text
+	.section	.gnu.lto_mspSerialInit.30.bd1bf8b1bfa9e46a,"e",@progbits
+	.string	"(\265/\375`\024"
+	.string	"e\007"
+	.string	"R\31636Pm\222\016$\203\310*\331\310\001R\341k\306\340\227\266y[5x\3413\332\267\3351\f\016\335\036nX\254yg\034Q\225Q\335d4\220"
+	.string	"U\377\213\265\326\b\221)o2\013\232\016\306\311\024>\231'2t4\236\270\301\262\230\031\370\372p\260\350p]X\304pY*a\t\241\243\023\301\321\227\367W\003G7\202\332\326\253N\035\3052h?\312\201\002L\231\242n\027\244!\0177\243\325\020\240\327\255\325\005Y\255>B\342u\373\231lt\023P{N{\360\342Kef\016KO\t\234R\022H2+ZX\262\253J4\376b\016\275J9Sv\344\204Bd%3#\304h\250/t\353\321\313F\322\372"
+	.string	"\0162\363\267\221,:\354O\360\027\374\036\001\t"
+	.ascii	"\357b\314\304\373}\264\024\273\217\ba\034\272\f\3622\004\270"
+	.ascii	"t\213v>\001"
+	.text
+	.section	.gnu.lto_mspSerialPush.31.bd1bf8b1bfa9e46a,"e",@progbits
+	.string	"(\265/\375`\334\004\325 "
+	.string	"v\374\322H\200\334M:\273i\243`\305'\032\347\025\302\257X\370B<W\026\224\321\375\267\210\375\305\251\035\034\340\220\225\300\3453\360X\3436\345\250\335x\223\320e\324f\261\023\307M(u\340w0\205\300\004Rjk\t!\204l\271\223\f\300"
+	.string	"\263"
+	.string	"\300"
+	.ascii	"i^\367\336 \226\320\225\371\307G\031\036k\306y\356\035\342Ew"
+	.ascii	"D\271V\346\b\023\206\277B\342\276w\352\211\327\275\307 \006B"
+	.ascii	"_\376\311\241\f\231\223\366h\244\370*\261&*p\356\275:\005'`\276"
+	.ascii	"\264\3571_v\021\356\333\343\031W\207\317\341R\3644K\333u\310"
+	.ascii	"?/l\33569c#\026\223\236\263\002\306@\371\260\020\224*\216H\224"
+	.ascii	"\324\323\005\2501\252\307\317\234\233\022\3236\230\002\243C\247"
+	.ascii	"\330d\t\210\021\202&Wd\252\345Y\225\206\2151\212\307\255\225"
+	.ascii	"\200\246(\245S\264as9\324\230\035\354\325\251\270T\373]/\253"
+	.ascii	"\320\330\030\243\244^\317\013\367^\256\304b\324\031\300\231Y"
+	.ascii	"\0133\257`\266?\002\346K\235>\330\355\232\330\030qG\215\372\326"
+	.ascii	"\367\336\244n*\346cR\375\355!\314?>\317\372\013\374\352\357\371"
+	.ascii	"\224\237\347X\377\316\277\316:\347:\343R\024\255|\342*\233]\271"
+	.ascii	"L+[\264r_\353\\\317\312Gp`JL\212\267{q\274\305\271d\345W\222"
+	.ascii	"{\375_?\327\257u\313|\346_\341#\017\366\025L\237\322\322\324"
+	.ascii	"\356=\232\300\362,\303{\035\3752Au\250\222\243v/\324\210\243"
+	.ascii	"\201\367\230\267\302\357\342\334K\256*\\h\034\320\227g\036\362"
+	.ascii	"\2678\307\327\342$\232\004\205fU\235\251\335{\201^r\006\233\025"
+	.ascii	"\303\n\270KB|T@?\205\223\234\336k\fI|6s\207#\221\n\364\331o\232"
+	.ascii	"\343c2{@\335\230\315\374\341\310\020,\364\2366\373e"
+	.string	"3\213x\331\211\2615\3046\266w\272\3543-Q\252o\314\323\266\1775\306\3264g\247\231I\234\314\f\026b.q\244\t\026zY&\347\264\37582H\034&g\232\031\232\2319\340Hf\2438\031\022\3721\032)\320{o\367I\025\247\355\252Z\3350\003\244l\252\251\333\3063\026\033\2172\266\251\030\206\371\006J9\263T\335\230Y\305\303\300(\223kM\356\275B`x\271\2627p\302\376eg\276|\227\3115'W\357\262cpFdf\027\347\302\323\031\271\367RH~K\217\177\344%\263\360\325\023_\362}\001B\340\017\204Q\220\350l\021<2\2622zCE\033\204\300\237Q*\354\001\273\350\347\023\362z@\337PZ\324{q\356\204\273!;D\304k\346=x\261\363\001{A\025FA\"]\221oG\244\343\001\203\272\007?\3743\352\001u\302\337\017\250\313\035\357-.\355Z\377$\005\204\254F+\335\246\342"
+	.string	"a)\332f\205\244\002\035\327NlS\264\277u\264\314\352\251\002=m\247\240\343:K\222*)hK\325\355\366\336{q\026MQ9H,\247O\243\355\304\354\340\270\376\351w\275\f\023\343\3024\245T\337j\332\311\26565\254#\021S\262\202\036\331{\215\026\324\260\352\033'\250\327r$\006T\247\2315l\250'\372\364NX\0172\033\035]\250A<\204\214d\206&\020\021\tdD\305\325`\002\021\262$7\020`h\232\244\320\030\240\360o\357\212%\217iE\3274\367\304\272\234b<Nk\226^H\02006x\022\302\375`Vd\322P\330t\214\027\261fd\241\330\226\024\001s\fB_\263\242v\323J\217\213\235\303>\231dTF\312\025#\205\022\273\347y\242L!\245\205qX\030\304\005\366\302Q\256lX\213*\234\002\210\225\rC\351\332\364A\276\007#e\300-\362\031\2319j\245\0378\240\b>\352"
+	.ascii	"\241,\017\343\360\243\321\207\224`\026\316\004\354a\202-Pk\331"
+	.ascii	"6`R\327\004\307\304H.\232L\375A\241\204\252\t\354\001tQ\367."
+	.ascii	"\f\033\"\232\n\235\203\307\330xS\177\177"
+	.text
+	.section	.gnu.lto_mspSerialTxBytesFree.32.bd1bf8b1bfa9e46a,"e",@progbits
+	.string	"(\265/\375`\370\002\245\027"
+	.string	"\006\353\232L\240\324U:\024\3744\332\210?\275\203u\210\346\301\34258\2663\326u\306\b\366~\201\"\346&\337%\026\2312\325\035\336\277\251\311\330\246\201Mv\275\303x9^\302\024O\007*\307b>\226\374+\276Vf\342\377\177B\b\331{\357$\003\206"
+	.string	"\177"
+	.string	"\210"
+	.string	"(L\345(\344\361}"
+	.string	"\362\330\256h\373\213\276Y\365\366\026\3534K\022_[o\375\362\005\351\267\250*\335\371po\335\223\250\236\317U\220SY\003\204v~?M|\036\256\212\213^O5-\024)/\002\240\017\022\217\352\361\\\224 *\254t\225<N\317\261\003*\246\235\257\304\357]`\345\373\231\370tnk\304\220\343\213\257<_\256\332\017\217\207\200D\200v~\257\345K\316\271\353\316\267\363v\275\273\201t\367\203\356z#\005\234\232\214\20485\2659g\234\265\301n\024W\237mP\367\353JI\357\222\304\267\266\275\360]m\355\233\270\240"
+	.ascii	"\376\f\371X)4\213H\227d(\274\203\350J\177\322/\274\355~\367\211"
+	.ascii	"\375\242\022\207\034 \214\032\034\355\017\273u\234\324<Tr(\201"
+	.ascii	"\251\253\243\242\2343"
+	.string	"\314<~\367M\037\251[\027\336L\\\317\\2\376\\\345\214\256\034\367\212y\334\227\361\243\233\276]\224\205\2174\376t\305#9\007\366e?<~\2322\242\003\314\251i=]\226\264)0\252\210?N*LL\375\316e\r\374\212@\345,\256\257#\305\222\030f\325\221\352X\n\270\fic7\312\230\307\321a\306\3149[[\n9!\2513>H\235 m\260\253\t\"\334\021\367\005f\013\364\036\032\341\021rm\320\206\274\245\021\247r5Iw_\270\r\033\354\324\344\322\335\263\327\240i\035\231\216\344\234\031,\235\206\254\337\342\2703\324\352w\307}\r\344\361\355\213\017\261\030\rB-f\263\241pn\210U\250\221`\243\311f\247-F\263\035\323\202\001f\206\026\253M\230\325h`5304\260\030Z\r\326\222\322\262Y\214\006\263\311d4X\013\315\177\266A\335\227E\332Z\037\342\227B\341\330\234\226\r\366\353\351|\261"
+	.ascii	"uKu\345\245\345\365=\261=\322#\030\177tL\025@\232\246\351\017"
+	.ascii	"\220\244\345\261\274\254L/\224\020\251r5\311o\3169\263l\260_"
+	.ascii	"\374\031\354!4]\266/&-\266\274\356\004/\003: `\002!t\271\003"
+	.ascii	"\177\f\262\3616\f\311\364\304\224\345\240,_\304\036V\033WC\240"
+	.ascii	"\316\202\004\205\221r\271\265Yk\025\265 \3213?\263}i\035q]0a"
+	.ascii	"*+\032\344\265}\332rE\233L\335l\321l\017\336\022x\255\306JYR"
+	.ascii	"\354 \336%doQ+\344\360\303D\027\343\036\215\2460\303G\266\215"
+	.ascii	"\240=\203o\310\216\264}\227\246\001wh\215\002XF\353\317K\307"
+	.ascii	"\005\223\b5:\234\360<\357.\233\332N\006"
+	.text
+	.section	.gnu.lto_mspSerialStreamPayloadMax.33.bd1bf8b1bfa9e46a,"e",@progbits
+	.string	"(\265/\375`\256\001m\020"
+	.string	"\346\037nD"
+	.string	"\321$\035\370_-\366\251\261\234\234\037=E\362y\b\206\377\321\255\255\327w\317\237\332\001\350\021j\215\276\r5x\300\034]+\205\212\002"
+	.string	"\375\337U\353_>\343\006V\252\355\211\022\273\376 \255\221\266\367\2262\245["
+	.string	"R"
+	.string	"]"
+	.string	"\366E|\004\214\265\307\351l\321\247\305\f\n\036\273\\&\362\220x\370> \036\352\206k\037E\37045\037\263 \364\303\332R\037Ux\004\331f\236\310\356\312$\274\371+m7\327\027R\303\201\005\262\255\236\201!\027D7\361\244\331T\231#\005\273\353dm6\367u\333.\266\023\330'\n\306\336\272KN\223\234\276\316\375\321iu:5}"
+	.ascii	"\004>\324X\351vk\272\036K\003\276\350\360\326\355\237\360{\214"
+	.ascii	"\371-\355k\263\227`\303'\306\320.7r\350\222\353\3606\214\215"
+	.ascii	"\331\316\264\317\363\022"
+	.string	"0\347^.`\027'\bh\227;\340\221\353\320\334e\007\2514>KL\205,@\340h\315Xe\321\203WF\265\035\240\362\254K\243\016\r+M\345u\212\206\200^\200\256\353:\222^&\203*\273'\214\b5\036T\213\327\017\236V\320*\213l?\270\n\355\332\335\022?\305\t\302\265s\350\277\304\303+F!G\b\236\230\354l.\225\232c\377\255\342\004'&\351r21(\031\205d\345D\345\224\2022iA\261d\rTNX2\224\023*#)`SK\312)s1\231N\031\306\355\337*\216\023~\3053b\252\252\"1\252z\346R#\315\331k\261\244\230\356\334\220\331\241\312\216\307\265\230Z\322\367|\001\006\241\237\335ME\3151\202\013\357\322\017\0222&(I\003! `\2021\222\216\036\215\361\257\030\350\307+\260\370&/\302\f\004\022<Ca\370\272\025\034\303\305B\205\\\202\3511\255\224\233\036\313a\324\302"
+	.ascii	"\265\177.\310\332f\f\217Y\340\2019\240\006\004.\225\361\304\240"
+	.ascii	"\325`,\316\333\034\253\361\361x\324\250qQ("
+	.text
+	.section	.gnu.lto_mspSerialSetStream.34.bd1bf8b1bfa9e46a,"e",@progbits
+	.string	"(\265/\375`\376\001\225\021"
+	.string	"V sH\360\262&\0350E_x\313|f\263\332\331?\2714\227a[H\204\347\375\364\347\276Z9s>\362\352\003X\265\221\242\311\262\311\212T8\207\311]\034n\f\203\273Ybe\004\352\262\306\363\210gR\240[#\204l\262eJ\001^"
+	.string	"["
+	.string	"]"
+	.ascii	"+[\350b\212\275N\017\231\030\321\356z\022\205\3455\361\336tu"
+	.ascii	"n\233\232\324\225\217s\004?d\256\220uN#\331\335\221PF[\020\243"
+	.ascii	"\033\211\005\315'\211k\332\tP\213\022#\241\007\255\244&\007\350"
+	.ascii	"\262\353L\330R\371\361\n\204z\\!\315\225s\260\273VW(\342\356"
+	.ascii	"n{\204m\b\266\016\b\333c\267J\365I\005\206v\240vvA\024\025\331"
+	.ascii	"\237\211c\305c\267/\273\f\177t\351\323\207}\306\3521\347\350"
+	.ascii	"X!:\231N\320\320\356\232|\272A\367y@{\311\266\212/\004H\266\005"
+	.ascii	"s\251\\\355\303x\214\325_\035\036`\327f\207gWD\261I\367i\361"
+	.ascii	"\002\266\317\356%\333\247\003\223\223v\205\363\274\314qF\264"
+	.ascii	"s\203\233\315\206\230p\220\232\034\036\232\274\361&/A\230\217"
+	.ascii	"\226\022\261}z\316\2069\316\\\354\256\212m\016\267\361\225\200"
+	.ascii	"\2040\240\361\032\027|\025\237Na\320\2732l\237\227\227=\3018"
+	.ascii	"{\361\202\321\"\271\273,)ol\221\245\337\335\265\264\261G\027"
+	.ascii	"\177\356\257?\032L\024P\021T\340\3472B=8\255\230@U\252S\201\237"
+	.ascii	"\004\222YR,\254\264\200\246\324\004\227\324\311C\265\254\234"
+	.ascii	"<\0260\345\245\030\360\347b\002=\325\367\201^I\334\177\245\r"
+	.ascii	"\316;\035@~`d\f'o\f\300g\216\244\fR\223\253\234A\271J}\301\202"
+	.ascii	"ZJ\344\332vr\225#\371\361\323G\250\347\303\211\030-\322* p\002"
+	.ascii	"2U\327\r\365\370W\fY\361ndht2d\205-p\334h\f\223u\355.h!f\025"
+	.ascii	"\317-\325\216\035\323\220\257\354\313\375l\t\312V\260n\035\375"
+	.ascii	"\002PAk\204}\350\"{jD\250>\322r\345&\035\263h\357:bD\300Q\316"
+	.ascii	"\275\304\020\341\016\252\314\365\334\252\271\367\366\252W\334"
+	.ascii	"i\005\031"
+	.text
+	.section	.gnu.lto_.symbol_nodes.bd1bf8b1bfa9e46a,"e",@progbits
+	.string	"(\265/\375`\274\004\205\024"
+	.string	"6\240|J\260ZQ\007lw\347,\220x,\304\244\006!i^\346\346\300\307\226r.\350\274M"
+	.string	"\357\350w\027\233\325F\334\351\017\372\017\372\307\376D\214\031cc\306\264\177\023\306Q\352\007\211\332\304\343\366\b\261&\252\202W\"\266\334;\355$\003j"
+	.string	"i"
+	.string	"f"
+	.string	"\037\353\013\017\273\275M\353\326\0361,\374\313.)\371!\375|\215\330\025\376\244@#w2i\255\025q\273 N\023~%v\216'\005H\302\267|8\034\016#\374\214\350\326vZd\006CBx\231\007\317r\360*\261\301\323\270\360)@\366\274\313gH\370d\373"
+	.string	"\027\305\341vH\326\276\265Kv=\242(\212\362|\214h\255%\201\004\251\314u\226\357\f\366\3653]\255\256\353\253^\267\023#\"\245\231\353Y\355\3539u]\357\224\246\346\372\255E\372\3252\216-~\207\305\013X\361\004T\274N\212\237\241x\234\023\237c\342m%~"
+	.string	"\211g0\342yD\274\201\020\177"
+	.string	"\304#\370\360\n<|\202\016\277\240\321\035j-\214\303\327\332\032\331 \222\255\341o\306\f/\303\020\355k\245\274{m\325-5V\234\224\343\336\215\351\245\332\366\027t\203\2114\275L\273\201\240\350v\314L\247\321L/\201\3550\214\234\236\340\021\363.v\234\266\310eJ\216./\354\267v\035\017\364\213\f{\331\263A\371\365uO\216H\021\f\345/\272\205B\303#1\224c-\345h\252\267t\263\327=$|Rz\225\336\n\266SY\214\367*;\035\363\272\231\by\371qW\376c\252\234\326R\211AT\216l\324`\374\004\346\221\245\266\265\"\244\351\2073\r\031Xf\240\362\271T\324$'{^k\3313\256=)K\323\230=\205k"
+	.string	"kNG\231\035\007\273q"
+	.string	"\217|\210\331K\325fg\252\242\"\321\311~\323\266\005\243\020\305:\311\225\244!\265\354\001P\250A\030\305:Gdf\202\322\250\232\003"
+	.ascii	"\003)\332\352\021\260\034I\220\021H \201\214L$3\017S\262\271"
+	.ascii	"\252\245\t\257\273\320\362\002O\225\267\"M\202I\371\202\036\366"
+	.ascii	"\220\2633\315Q\032<K\r\240\265`y-\353\300`A\307\336\331\241\320"
+	.ascii	"\247\b2Wa\270\326h\362:\355\265\326]v\237m\356\261\336\265q'"
+	.ascii	"\212ki\f\034s\"\230U\210\321Rb~\024\333~L\234a\225\227\375\341"
+	.ascii	"^\027\003\311\223\212\227m,\326\270\022\310\253\316~\003\255"
+	.ascii	"\006\211I\217\313\006\224y\353t\313\324"
+	.text
+	.section	.gnu.lto_.refs.bd1bf8b1bfa9e46a,"e",@progbits
+	.string	"(\265/\375 \237E\003"
+	.string	"b\310\025\032\220)\351\377\377\377\377\377\277\t\003\361]\277\370\217\366\r\311\222\337\360\266\245L\001O]s\201\300W\0166;\263\035\375F\237\321_\364\025\335\211nD\367\241o\350+\375\323\r\350\004\313\324g\271\360\023x\244O\245B3\305\2538R<tS\234\305WLh\242\271\377\021\005"
+	.ascii	")!@\340\314\013\236b\001(Q\316"
+	.text
+	.section	.gnu.lto_.decls.bd1bf8b1bfa9e46a,"e",@progbits
+	.string	"(\265/\375`m7\225\346"
+	.string	"\032W\361KX LI9\351\357\276\373\272\356\353\377\377\257\273\356\377\256rfk\021q\271\256\231\353T\371q\265\213fb\273o\357\252\243\2732`\224\017J\316#\243\277)\021\333b\027 \273\2763\365\363\333r\274]\025\340\036N\013QN\t\343\035\234\336\327\223\020\242\377\256\247imo\271S\003\004\262\004\325\004hw\241W\263\032\224\346\222\032\351\2520r\367\325x\275\n*)\301\300<\322\300fuB\252\321X\212\2126\262M:\036H\215[\211c\223\364\240\2024~\037Ao\255\374 \344,\335W\033R\335\bqJ\315*IM\373\264|\235\355\227\036j\242N\321E\266\257\221v\355\244\345r\213g\273\034g\3159i\337\340\254[\r\362&\017\265-\233I:i\363\354\336]\233\023\220\232Q\227s\006\241\305\336%i\255\310\242b\321\226\f=)\340\267I:i\235\026\n\003\210\226bV\f\311"
+	.string	"\201\305\326)\321:\272\352\244-\263S.\222%\224\211T\214\272\234\327\333\264NZ5\353v\327f\036j\013;@\215\267\246\263\274\234W\017\036<\340x\210\2611\226C\211\203o\367\254\022\353&\202\234\2239g\0164tcA\364@\334z\321"
+	.string	"\\Z\256\331F&\205V\216\030\215\355\221%\264f\255\322Dwv)\274\230m\331\331-A\032SOqz\350\355\035\332\301f\211I\256ykgJ\311\2239\364\226\212\275R\203\325\305*+k\316\002A\257f7"
+	.string	"ou\240\267R\350\355\023z\263f\331\354\252\201m\273\310,\033\232\276!}{M\350\255\006@\373\264\032"
+	.string	"oW\2408v\003P\313\236\375V\254)i\321\3706\243Ga\315ZE\221\021W\343\367\240R\016\002\364\306j"
+	.string	"Z2\024iL\213\254\361U@\237\214\315`\221\202\325\327\330\216\375!\214`\303\2029g@3\205\364\245\257\261\rk\013f\305n\303\354\327C\030\341\301d\276\312y\265a8g!k9\250\261\226\203\037\331\016!- >\005\320s\261^v\b_\034Q{5\201\0312\345NFc&#\220\232;k|\022P\273\304v\255\031\007mr\313\312\306\007\001}\007h0\333\r@\273Z\r\300\r\354\226\275\262ZWy\304\314\316\234\327\f?-3\"B\215\255\021\213eW\253e\263\216\263\230y+\347\225\346\n9\235}5\336\300n"
+	.string	"\342#\267\311\312#\330\016@\033\333\001\370\325n"
+	.ascii	"\242V\003\3603?\326@\222\005LH\201\363\001\374\270\004|\231\037"
+	.ascii	"\177@\201\215\271\371\261\007}\215\343\004V\372\306o\275\264"
+	.ascii	"\r\266\337R\3756JO\375\215\254\201\202\230\227I\335\001?6\200"
+	.ascii	"\305\261\327Q\001\370\257\223}\321\027\352?_\207\200y\013\376"
+	.ascii	"\313\200~\341\267@\232\377*\261V\277m*U\3204zF\227\337ri\031"
+	.ascii	"\177s \306\177\261\367Y\340\267H*\320;Oc\036\270\0278\353\345"
+	.ascii	"\337'\274\370\255\211\337\226\370\255\006\332\251G\220\370\255"
+	.ascii	"\n%,\322q\376>\352\025\277ez\207\377\322\3756H\003\374\257\221"
+	.ascii	"\337\332\377^\376\357\375\266\177\213\177\373\373\377\345\317"
+	.ascii	"\230W\360_\037=c\364\f?\306\300\326\265\362\357\240\242\337\202"
+	.ascii	"\360\333\003\374\r\374\033\346o\242\337z`\231t\212\277YH\376"
+	.ascii	"\007\373m\001\236\301\017\360\343\230\337\276\204\241\307\374"
+	.ascii	"\267\355o\241\277Q\360\367\t\3766\301\337(\376n\341o\237\277"
+	.ascii	"\323\277s\376\376\300\337\036\370\273\003\177\227\370;\003\177"
+	.ascii	"\213\370\033\205\277!\360\267\003\376F\300\337\036\3766\300\337"
+	.ascii	"\034\374-\200\2779\374\275\341\357\n\376\016\376\215\376\215"
+	.ascii	"\377\266\277}\376v\357\267x\277\325\362[\271\337\276\375\266"
+	.ascii	"\355\267h\277-\373-\363\267C\277U\300\377,\277e\361['\377\315"
+	.ascii	"~\213\376'\373m\223\337\036\177[\202\337\n\177\313\365\333\036"
+	.ascii	"\277\325\372m\210\337\026\371\355\216\337\352\370\337\301om\374"
+	.ascii	"v\002\277\255\361_\356\277\211\377m\377\317\376g\3756\375\177"
+	.ascii	"\345\267P\277U\372-\215\337\316\370m\214\337>\375\026\306o\227"
+	.ascii	"\277m\361\333\246\337.\375\266\003\277\345\300o7\360[\022~[\363"
+	.ascii	"[\232\337\316\374V\346\2671\377\265\376\177\340\377\224\377\032"
+	.ascii	"\236\317\347\363Go\374h\004\376\016\324C\326\0329\347\234\221"
+	.ascii	"\316*R\314\230u(\253)\2030{\210r\256\222\221D@ZdQ\036B\332\234"
+	.ascii	"\211\326\245\234\207\230\"X2\255[\321R\246\311I\241\243!)f\220"
+	.ascii	"h\210Y\224\203@Y&\345\226\024\023D\030\327V3\017\255H\333\314"
+	.ascii	"U\242\226\320-\344\232\235v4[0,\217\032_'NhQ^\032?F\351\264\353"
+	.ascii	"u\336&1J\374\344\253\3566\371o\327]\322FAf\360YC"
+	.string	"\317\331\270\233@\3742\271`P\210\2764\366\340g\365\274\\x+\270D\221K\262u\263\252\324\232p5^\257\221\233E\2015#eV@Q\021\311\313KK\036\374f\375\027\353\036\301tBx\0305\276+\210_$A\025*|\3345\266O\253\001x\323\031\345\272E\206d`\250\t\243\007\221!?&K\214\230\204\374\016\271V\227J\n\013\254\306\267\252\306+E\026=\251\033\303\rb\357`n\364\021\211k|\201\310\364\360\341\225\324\370\376\260^1`|h9\256\017\030(W\240h5nRu9o\217\027I|DQ\032\037UB\327\232,9\265\262\306W\007\025\016\034@\274\\\030n\216\230\034\027$\357\342\370\315\361\305\213\233Pc\252k\003\b\267\364$\232\243\2725\206PUncW*\n\312\002qEg\215/\363\001S~`\341B\377\373\302\024&c\242\323B\343\316p2\304\252H\343\3178\\3\2278"
+	.ascii	"\337\300\222g2:\310\323\226\031Hb<\211i+\242e\313S\007\032=\270"
+	.ascii	"!+\030K\233 KK\244\365._\210\240\001fw\235~_`+)\214X\330;\031"
+	.ascii	"8\271=5\027\267\305\034\020\025]\215\2314\221\034J\310X\334\246"
+	.ascii	"\253\252<\327"
+	.string	"\37069a\200<\223\2660-\331$\330\223\254\273\204\226\251\2059Y\301\2424\243\322lJZ\313\272\254*G\3158\244\246[\303\325$orR*\251\231U\307Gg\244\245\357\240\354ei8\253\346\224\300\325\263\356&;J\257N\257\3712\030R\246\260\314Rw\207n\322]q\217.\322\025\272\310kt\225n\321Uq\2257_\242\233\302\2567i\267\274\373\372\331fSNG\324\006\243\333\2544\334\212\233l\271\276\322\246\302\312M6\227\316\253I\256\231IF\211\271\367#\bW\204L\305\006\370\007\306\367\305\211\344\212\034\376\021\367\325\243\367\332\013\020\253\355\206\331\022=\fSw\261\351\202t\007G\204\007\203l\273`\220&%\036v\275\0058\207\036\310\206\036H\206\036\350D\017<r\245\347\232=\262\350\032\253\331\004\373\212\264A\305\200\036\210\003=P\006z\240R\277\305\300\331\315p6>\220\b\375O\017\005\301j"
+	.string	"\366Z\032N16vC\255\325:\r\310f$s5\332;\355Xlv8Y\253\321\270\317\372\305\323\t\025.\247\233\211\222C\n\215\f\375\217\013\375*\005\003\230\252\260\027\250\312\332\271ev\207\026\245\305h\316\2320}\275\035q\322\024\353\255\326\252\371\345\314\364j\2125\026\tD\276\352Z\254\271\372\213\005\214\321:\027$/\347\374\244\2414Y\217\331\265\305l\327\033\254\303<\004\355\252\350`\310`\213c5"
+	.ascii	"\2354a\033\343k\374\237\024\332\244\231\330\265\275\272\3536"
+	.ascii	"J"
+	.ascii	"'ir\265\244\2355\310\f9\327 \322\364j%\355\264j\31357\301(Y\222"
+	.ascii	"[\342!-+T\200\370\277\214\036\3539\255["
+	.string	"\267\235\035\rqA\217\265\2406c:\264\327FbW\f:\313n\2711\304\364\206\242 g\213\001\320>\237\026\003\3401\032z\374\304H\021\247->\037\215\2134\214\026r\221,\2510\224eH\023\351+\273v\221\216\341]\325V\n(\322,\362\352\354[\221f\322\363\200\343\301\203\214\\\233\027*\024\003\231n8\t\372\026\322\313\016\322L\003L\361ui\f\004(e\251.\256\361\361\017\264\331=zG\353h\037\315\303\256\375\243q\274sX+\307Y?:\252m\f\245\325\265\f\030\346\2323h\300(\221\222\253\353\037}\243_\334\025\f-\322B\253\353\027\230V\232?\032\312\272Y\265eFj\021\301Hf\273\303\361`\003\327\305)\245\006\037\013\241\301\233\005\375ek*\273\245\004\307^\343_&hKu\r\273\366\3243\315\314\024\230S\2501\n\230\223\001\177W\364\227\007\372+\003\275\363\246@\017V\366\004\342\035C"
+	.string	"^da\215a\364P`\267h\027v\355\240\235\336M\366\355?\2415\257\r\003_\227V\035z\333\001\360>\237\266\003\340\333,P_|sU\216\257\340\271.+\302\340\360\034\226\243\322d\305\033\220\340T\237\224,V\032G"
+	.ascii	"\350\224^W\211\327\032\227\027\325\332\032~\003\333\373au&e\304"
+	.ascii	"\304\355"
+	.string	"\370m\252M\207\024n\013\256\310\214\005\267a\266\230-W\346\2225C1\2326\032\337\246\005\032\032NS\022\326eK\036\266\341\305\210\\\232\255\323\203\301\344\333B\205\nN\3420\357\234\026<3\224\212\236\362\207\0213\263\373\002\207y\343\326\354\232~ZdG.\226dd\270\f\207y\351\232rK)js\314(\307eO\026v|\2151\024\314\204\306\nsHW;\257\270\324\244\030\033\313{?\362j\356\224Z,\335}\375\013\207\331\233uH\016\255\316Ra\361\330\001v\0346\303\204*\312[s:\261\027\220I\235\3342/\346\314\255\211\021\334\344\330\313\t\223uW\005\311\304\304\233\\\032\023\274\244\371d\307\347\004\306i\310K\024\334\325]vF\223\216#R\262\2620W\tj{?\254\320'\311+\033I\216\271h\250\364\304f4\306[\027\213\214\022\0278 \215\261\326\222\365_\361\221\315\312J8aK{?:"
+	.string	"\323\256\360\260Q\004\345q\374\203\007\306\272p\301\214\314\312J0_R\346\226yY\271\3540\203d\005\222\265!\307X\307FB\030\341t\250U\fpB\215\361\325k\226gbuDp\021 S[U2\320' \313\211\211\2511\266:]\007\241;\322\322\030W\005\227qy6p\fhRmC\2151\020\034\304\256\237\202\205\274F\254\250k\212\013\364)\260\237\002\304\315c\037b4\246\242\220z,\201\213\321l|\032%z\032\244\216\333\025\353h8\b8\263\020S\207(\310\270\245\274\274T\346A\206\035jU`6l\340\034^U\""
+	.string	"\204N\n\3438\366\332r\036i\214o\\,1v\364\215Y(\326\312J(\312\210\224\024\236\222\262FE\304\n\275\222e\n\025\256q<\025c\003\016\351((\205\231\230\211\241\272\t\303\345\365T7\243\324\365\245\013\252\341\344\252\324z$a\030\030\006\246Q\002\fhu4dFd0\3148\246a\205\322\262\0305\3062\254\033\226\212*\261\3068F;\357\225\f'Vc\374t\262\233\345e\206uC\006\351\007\025\214\306\017\346\027/p\022\203\"4\253\026\023\322\226\026-\260\213\rUL@&\227\"\307.|"
+	.ascii	"\221:ZKJ\302M0.\263\f\213\016\246\343\246\336\353\221\027\326"
+	.ascii	"\030/\335)\032$\224Z\f\215\261\322\275B\373:\022\003L\205\n|"
+	.ascii	"\204\003\004Y5D\217J\343\037\2578>\242\212\201\274\232i\242?"
+	.ascii	"&\"\302J\037j2<\300\316\247\242.\270\310r\255ZO\032\257\026,"
+	.ascii	"\253\222\250\206\206p\322z-;\374\356\224\340^\340bW\234d\013"
+	.ascii	"\302cI\343\317(a$F\336'\272f%\020h\241\"b%\223\307\307w\237\""
+	.ascii	"<}\364\375>\303\216\226.\240\314 \021\365!I\313\313\273{v p\361"
+	.ascii	"\362\273w\233\277\271\031y\\\215\257\036\232'\267E\310\275\262"
+	.ascii	"Q\241\324\205\305\021;\273\213G\206\244\"\222\307\345\027\217"
+	.ascii	",\346hI[\217\306\367.H\305\316\211l,\323\343\312\225\253\305"
+	.ascii	"\3369$TD\254\352~\265`>\270\253\274\3067K\3278\"\344\r\213\032"
+	.ascii	"\036\236\023\313\245\273eIS`\270L\374\304\344\211\224\250\270"
+	.ascii	"\270+7\202\013(+\277r\315D\325\\k|\253\\(\034\2404\355\270;\210"
+	.ascii	"v\364\220I\276\335\256\367\355~A\300\311\314M$\034Y\227\036\310"
+	.ascii	"\b\301\221\367B\235\232\332m\023a\017\t\333o\333\257\212E\024"
+	.ascii	"\224\306w\315\314\314\354\242\305l\331 l\355\354\027\315-H\345"
+	.ascii	"4\206\325\370R\261n\027NG\330\227\306wJ'\321<\275<\267N\206]"
+	.ascii	"\204\0259K\202\376\202\335\260_\261\213\3352\013\202\020\037"
+	.ascii	"\313\245(\277e2NxVV\215\357\330"
+	.string	"\205\022\202#\272\266\013\345\222m\321\260\302\242\2259\346\211\b[\333}b\271\334\026f=\264X\267\237\024\336\225\257\033\350\373\007\346\334\364[\363\322P\020h\177\326v\370i\354\265\004\370\217s\376\357!g\315BdWw(\220/\241\030\033\344\347\214\\RnE!3(\267\204\2622\211\032S\006\345\232\2418\344\255\032Y\2712\221\230\211\354\274\346d\024SN2\221@\3125/\345\225\211\274\311I\246\033\345*\204TnE1Y\345\026\223)CNfdN\nA\241I&\223\222\n\223\351F\271%\304\244LF1\331\2742\263]\033[\243\220DyK\210&\347|\2646\221\301\234\205\2262\222\255\221rT\035R\246\221\255ZFa\217\016V\211\303\273#\224!\241\016\177\216D\241\321D\317qH\034\242P4a,\242\240\016\205%0@z,\372\350\330X@L\201\2125%T\024\251\n;\304!\017N\206\367|"
+	.string	"\200\343\320\307ghL\325b1D\321\204\232\036\217\034\336\363\301\320G\347\204\241\217\016jLw\204)\211\242\211\036\035uX\202\022\304\341\ni\210\025\210\303\224D\005Fu\004\fOP\210T\035\0329\260C<a\005\3420\335\t\362\321!\016?\030\217A\037.\360\361\t\"\022\213D\0305'5\301\360\b,A\321\330\243\026\2110<\302\324\007\253\351\361'\375\001\276\347\203\013\230H\241\304\0075]\301(T7`A\247\350cBj,\232`\243\246\025\240\020\212\330\021\026}\\\020\216\300 M\215(\034S\325\205\020(LX\320s\f\032\241\016\211)\320\254@\034\252C!\007nvxR8\nS\237\224\3041&U\205:E\037\237\b\\0\002g"
+	.string	"\351NQ\207x\202\215j\024\241\246\307\324\030\324@\303\006\236\240\020&X\260\223\301u\206\306\224\230\256\200^\204\005$`\001\f@\001\243\036Uc\021MsP\260\340<A!\324\240\"p\207(\374\371)\232pA\232CB=\0265\270\340\003\224\2228\036S\235\242\321\2024G\002i\016\320Q\004\261\250B\252\n\203|\204-\234"
+	.string	"t\374\341\240~8\032\323\026\206\306\235\r\334\244>'\204&Z\330)\212\220Iw\212?8\315\301"
+	.ascii	"\315\021\250\b\223\252B\022(\252\242\306\340\2160\245\200\232"
+	.ascii	"\023\202\002|\206B"
+	.string	"\023\306\224\207'(\004\n5hTG\244-\fS\235\224\004\216\214P\025J\200\005\035\341\t\037\037\241\t(\2145\357\371 \325\021\362\030S\2258T\337\363\001O\320\211\017\304\342\317OQG"
+	.string	";\304\364\036sx\202N\034\201F\025\350\362\004\235\270;?:\027F\365\t:\246F`j\034\356\304\324\250\357\371\340Cq\310\301\005\243\232\376\244>\251\312\341\230S\001\013G\241\bbq\250\352\020\203x\202iN\n\027\030\323!\317P%\246;C\031\240\343\317\021h\205\f(\322\035b\n;A\302\0239(\212'X\320\021\372\234\270\340\270\302\220\207X4aF\315Y"
+	.ascii	"\b\324\004=\306\035\240\240\234\r\306T\325\021\032\205=:9j\261"
+	.ascii	"x\"5\336\250\357\311\340E\240\324\370A-\026\215\037fx\202B\020"
+	.ascii	"\207\277\230c\216j,\216\b\252\306\"\020Vs\216\"\322\237\241\212"
+	.ascii	"\036E\270\240\016[\030\252:\021P\217B\237\2324\347'U\217.\224"
+	.ascii	"\300@=\246A$HI\254@\034\356\020S\240\0325=\362\360\024\201\251"
+	.ascii	"\t\206%\204\252p\007\375\t:\262\240\223\366\350\240j\016\003"
+	.ascii	"T\3420\bfD\t\021;?:\3004'U\2052\251*T\2179:0i\216M\n\344\202"
+	.ascii	"\t \031\243:\242\004\320\361\247\306\247X\f\221\363S\2179j\312"
+	.ascii	"\202\216p\004\320\361g\206\210\302\21705\252G\364\rh\200\t\033"
+	.ascii	"h@\205\t\240:\037\370\b\207\306\364\230\003t\374\371@\034\n\177"
+	.ascii	">\350\030\217\037>\b@\216\373\204\202$\205\343\312\335%%{[7\276"
+	.ascii	"\247\266$Z\263q\333~OX,\327\250n\031\356\341\204\315k\352'\024"
+	.ascii	"\002\\\023\251q\r0\006\035Ea?\251\237S\r\337\216\025iQI\334\005"
+	.ascii	"\343\206\024\024N\273S\276\204T\375\230_\314\254/)~/\330=$i{"
+	.ascii	"<VTl\312)6\343\342\225\240\026\347$\243\214Fk\331g\026\003\277"
+	.ascii	"\311,\371x\234=y\341\035]jw0.\332\275\253*c\262\304\\\316&.\272"
+	.ascii	"4\376\275\370\177M6\355\3474EC\356\205\306\277\026?\027\3779"
+	.ascii	"\375X\344\237\223\bL'\033\033LD\252\307\022 \376\215\021\364"
+	.ascii	"\376\230p\230\005\310,^\215\177I7\005\317\347\363\371%g\241_"
+	.ascii	"R\377\226~J\377%\335Z\016\254\345\300\006\246\212\225R\b\210"
+	.ascii	"\324_;\200d\r\235\354\267\"\333\324\240\305\301U\031\202\376"
+	.ascii	"?\025\370Hf\n\013"
+	.string	"\225\246\321\325\002c5\245i\244\304\373!iq&T\204\225A\0328R\300\021\335&8\313\023\214\255\024W\224\344\035\201\361Kb\325\250\035y\342h\374\313\277\374\023\002\301\346\".\251,u\027O)\310\213\037\362?!\231\026R\262\250nx\364\365\341\267\016F\326\030$($O\215\177\003\343\313\027|\364\326\325|J\222\306e\347\305K\224\272\260\034O/myyL\266;\232\034.x\0249\301\202\005\343\3410\221ZH Sc\273\273Xxch\230\3131\336\305\222c\310\221\220\306\370\256m\300t\251\221fw\225\314$\251\341dK\263\331\340\220#\242l\214\265\234.Y\303\307\224\306\270\256\341l\256h\210Ii\214\263t\336\036\030\234Q\337].\034oXG\342\342\360\025\034&r\213\bcM\266\273\274`\205\t\250cc3\202T\233r\b9\206F\204h\232\2441#\025@0H\\&\031N\210\261\033\023"
+	.string	"\025h\304\221\234'\22126\"\222$\005)\264\033Q\021\375\230[0*{\225\250\230b\025Z\224\b\307\307\244p\2457\"\303\2058\217\276n\bG.\211T\237\271\347\037=\200\203\366u\002\027j/\007\235\242\263\233\350\221P\247Qs\250#c\370\232x\356\231'\311\315n\f\334\177\256Z\004;\303\307\277\324\306\203\004\364\2073\0133\254\236"
+	.string	"F\\o<9v\306:/\023\204\035nZ\207\342\317\360P\324y\270\223\316}\004~B8[\331\350DL\234fs\331n\206(d\276<\3260'\334\245qo\364\274OuA\224\2060Z\217\253\nZn\340"
+	.ascii	"(~\327\253\247\273q5.v\005\342\323\310\342\251\275\3220O\374"
+	.ascii	"\350\204\317\351\251\317\206u\301_\313\275\372'\256Hqi\354hm"
+	.ascii	"\377\367n\357\\\203.\227\027\267\003\315\023\220\242\210\206"
+	.ascii	"\264\352i\361\023\362a\026\347'\354wQ\321;\273\031\260,\254@"
+	.ascii	"\345\315\310\355\244\355P\260\347f\203K\221/\023\376L\200\036"
+	.ascii	"\265u\351\\,\003Y\365l-Rr\324l\264\315\305}=[\334j?p\2220\302"
+	.ascii	"\344\022\261\027\255\361f\372el\2079q\263\251\312z\0236\265\342"
+	.ascii	"\333+\"\267pC0/Nk\222\231\3441\204\216\374\362\332\357\220lq"
+	.ascii	"\026\242\313UUx\335\251z%\b\331x\213\364\250\365i\350o#\335\233"
+	.ascii	"\367Z\363\243\367\214\225\322\3604\263\345\365h\205l\035\365"
+	.string	"\213\nX\273\3449\t\\\265-]'\272\220\320+\265#\260\"\250\027\004\324Jy\245\206\021\231\021e\315\226S\n\300=\3718\002\\\233\030\244\270\235\334\352\224cyd\362\343\035\262T]\304\236\367\034\215E&\262\311\005\225P\322H4\310R2\221o\221d8w\222\214O\224;y\333\375+-\245n\b\225\320\226\311\312s\020.\357\215'\254\226#\266\007\341\271\203Z\221\325oz\260y\227]\001\310\004\252\346\364\246-\371\323\214F\200c\254\b]\222[\262V\225\373z4U0\360\t\302\022\246\272+\345\033\177\200\226k\004\206\236\216\212\201G\267\321\001y\211\352\335\373(\345G\177\256\005\025\214\tWZ\217\301\244\231s\361\324\n*73\206t\332\250\307@!\265\210\311\327K\013\207\214\205Rw\n\232\214\302\004\240\321zY-^\0242&^\333D\034\2562]ME\204S\332\346\224\211\357jB\244fw\037\206"
+	.string	"\246\322\224\224D\260|#%\261\b\304\302C@\300\341\314I/\212&\210`\364/\345'\211\327\255\377\325\263-\177\036\306\351\037\245e[\035}\274Ec\331\203X\002\241\211Xsr\333\235\310\321-\230\333\314\246\016P\232\317\217\335\025\237C:i\315\002)\004\245R~dw\300*\030\203\370&\205\210\303\331<K\260\2364\377\334\210\345i\333L\022?+e\360\210\0321=\201\020\363\t\302\335:\234\004`\312f\031\002\2400a\254\025`\271\237\016hgH\200\272s\031\252T\002\213=\241j\341\027`\232\327\331\340V\333\235\272\035\326\363\031z\275\306i\320\274r\006\231&\325\021\300\2102\367\227\236\3106\351\006~\264ov\233\321\032\020\335\212\337b\305'\211\304\372\017\267]\204\035\372\212+\256s\203\201\037\026\374\"\310;Sx\235P\2717\342\005\203\b\367\205\206O&\274\344\227\224\0331\210\275\352\370\225"
+	.string	"\312d\020N\351S\210V34n<)j\234G\364\315\225V7\2065o\216\2172\030g\226\306\215DUc\b\217]\335|\032\375\332\220Py\333\257\277\343B\370a\006\027\342uC\325E\220\313f&"
+	.string	"\3427\206)}\307\343\360&E@W\367\264{\352\2140\303\311\231 \357\237E!\350"
+	.string	"\236\275\036)\357I\2577\260)\031s<\340\021\377QHW\342h?\272\255\352\301Q;\256?\2718\312!\244P\235\352?\355\312y\213\206:\3065\310.\213\226\005\227\232\341\356\261\006Uahv\022h\361\232\016\324\264\232\006\017T\331(3u[\233\006j\356KPt\267C\276\301\257"
+	.ascii	"\232='\023\241\03231\323\324\376={"
+	.ascii	"}Y&\313^\325^f\322\346<\327\255\272\250\343:\\Se\376\300\352"
+	.ascii	"\332\373\333\""
+	.string	"\330q,\372\212\230_VX\360\240\253L\227\243\b\\C(\316u\037]\006\250\326:\316\323\272\031\353\365=\264\212\307\367u\203\f\240\304T\330$\267CE,=\243He(\241\343k3\017\361\316yB`\313\2500J<\266\030\237/B\024#\334\251\373,t~f\035*\246\240\005\245\342\\7\204\267\300Jd\332$\217\251\207t\345<\322C3\230\310y\306{\232\240HT\371\212p\363\301X\007\221l\226G\347\332y4\357\361\326]\204]\303oy\\\307xd\332\367a!\244\303t\021e\300\213Q\313@\364\277|\221\255!\2567\233\347\017\256\007\350}}1Q\236\346yU*\323\026\2774\310\312\221\233a\341\376\242\t\237isy\211c \336\002\342lK\005\235\227\244\371\262\002\0130\311\004B\367\253\364\003\332\024\355F-0\035\343n[\034\205\343\337\222G\354\003\336\003\203\023\302\314\357\235\215\022\335\300\366+"
+	.string	"&"
+	.string	"\333m \304f@\360\332\027#7gFIY\253\233e\373\002\022\024\3650l\221\245P|%\275q!\356\013\220\261g\263"
+	.ascii	"\262\252\377\201\211\226\212\002_\372\016^\363D\331RA\255\221"
+	.ascii	"\315\023\341\250\252r\363\314\2023\340\372\216\364=\213\303\317"
+	.ascii	"\353\262\307\303\352H\356\001R\021\310\305\241\216\224\nKR\251"
+	.ascii	"\364H\373\217\244\346\307\r\336-\353\247\300\331\314\036\002"
+	.ascii	"\351\r\023\264\210\\\003\372n\224\342\245\332\203\207\221\251"
+	.ascii	"\367\362\025r\235\337a\2468=`\224\004\240\227\"\240\225\226\335"
+	.ascii	"\302\206\210|\271\256P\261\027\3464\004q\226<\037T\313\260\354"
+	.ascii	"Z\003V"
+	.string	"Qf\341\224BL\353\242\332\030\264c)%\2204H\022\215P\237\344\263\fM\367r\272\267\317V\r\002\241]\330\037!\250+\022\341\031\214z\366\335V4\336\356E\301u\2065\026\305\305\037\245\\9\344 q\n\234\327\330\343|N\377\177\020\300\b2\360\234\016k\202C\250\225\346Apc\267\325XT\344/|UR\264\235\322\211\327?\270\215\207\212\004s\370\361\241\370\n!\365\273\270\003\213s\323a\247|\361\247\342m\230`w\256\234\355\321c\036(\310\335x5\304\241\250\321\fa\271!#\354;\n\325\252'\365z\023\320\273q\230\373\313\303\020\325\326\177\323\001\257D\0210H\356\251tF\325\376\214\326\223\300\305p+\252\301\003V\005ma\nq\314<\367\251\315\005\271;O\006B\215+\257\271\031\022\210&\213\264\024\256\306j\323\362\357\230\2313\233\242\204b9V\274\217\366\255M\305\363&-\222\225\322#mW"
+	.string	"'^r\217B\016\306\310\355\323\324\343\373tN\315\230\025\212c\017\227\221\003\236\316\237(v\303\254\241\357\036\310?\365\315!\271\374{\215j\231"
+	.string	"\256\001L\324\302$#s\226\326\310\013#k.CF8\245'\005\375\033\326\335O\365\206\034h\255\315\2621\033\277\262\306B\001CI\n )\001\031`ZY\035\274\026\314M\227WoET\357\022\b\312\300\237b\235\346HU\347&@\341f\345\032\312\344\251Pe&\017\\\312\022\315W\373\226ph\305\251\033"
+	.string	"\267U\243\337\303\316"
+	.ascii	"\301E\242\254=\261\300\325\274\354`\277\n\316Q\330\231n\203\032"
+	.ascii	"\213\003\231\222\326\345\334En\220A\345>\376'g <T\247\016\\?"
+	.ascii	"\337S\006G\016\005\f8]\371\3401\030H\326+b\317\231\331\3415G"
+	.ascii	"\366\365\336\234%4\343^\206\254\316\346\275f\355\340\262\232"
+	.ascii	"{\223j\236s\346(w]\006\373\214\364\322\264\351\212=\336\373-"
+	.ascii	"\026^\344^\330\227\214\304\177\3739\267\331\377\226\351\221\031"
+	.ascii	"\303\3336\322\324k\027N\371%\256\317\317\351~\0322\037\221\227"
+	.ascii	"\203G'\2326z\226\375:\026|\f\357\357\236\327\320\230\317Bv\215"
+	.ascii	"+\305\304nL/:\351\355\235^\334N-g\332\2438\337\351\276\341"
+	.string	"\027\2636\363\2765_\016\271\350\362\261\3611\303\017\354\223\327\337\307\\8\017m\247\364\237\002\035\021\267!\037\257;\016\377\336\023\017\247o\355c\266\301\233\363\241\020.\036\033a?\323m\206Tf\344>\300\366\222\256\003R\300\017,\025w\215\226)\306c\357\3407C\260\002\352\013\272\335\220{K\347\253\\\372\002h\002\300`U\356$\037\016\336\017\356\273\375\036o9\027\025\233\327\031\317B\226\270P\360\3625u:=D\351\365\177>=\021\276Fgk\260\304\342\035\350\304\365u\301.\350g_F\357\001\303G0\341\324\\e\355\372\257\363l6\037}\375\371\377c\271\221>\021\217\025^i\326`\365;\213\340@\3039\365c\332[\233\236\325\333?\351\337V\367f\271#\032/\033\213\032\244\236\341(z\203\335E:\370\344\036\344\253\351\254l\013z\227p\241:6\343=\b\361\346\217\312\001\372\b\355\311w\375_2\260\203"
+	.ascii	"\r\353\363\330\343\366\362^\300\211\277\213\372\030#\325\315"
+	.ascii	"\023\207\254\235\205}\307\306\277gm\370\313\374y\321n:<\332i"
+	.ascii	"\375\314\361\035\374\022x\356e\312\337\002\363\260$\273v\340"
+	.ascii	"\225\336\322\300\t\261q=s\355\315\253\323\023\336U\232M~]\001"
+	.text
+	.section	.gnu.lto_.symtab.bd1bf8b1bfa9e46a,"e",@progbits
+	.string	"mspSerialAllocatePorts"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\002"
+	.string	""
+	.string	"mspSerialReleasePortIfAllocated"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\002"
+	.string	""
+	.string	"mspSerialProcess"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\002"
+	.string	""
+	.string	"mspSerialWaiting"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\002"
+	.string	""
+	.string	"mspSerialInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\002"
+	.string	""
+	.string	"mspSerialPush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\002"
+	.string	""
+	.string	"mspSerialTxBytesFree"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\002"
+	.string	""
+	.string	"mspSerialStreamPayloadMax"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\002"
+	.string	""
+	.string	"mspSerialSetStream"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\002"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\001"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\002"
+	.string	""
+	.string	"serialEndWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\002"
+	.string	""
+	.string	"serialWriteBuf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\002"
+	.string	""
+	.string	"sbufPtr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\002"
+	.string	""
+	.string	"sbufBytesRemaining"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\002"
+	.string	""
+	.string	"serialBeginWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\002"
+	.string	""
+	.string	"sbufSwitchToReader"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\002"
+	.string	""
+	.string	"cliEnter"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\002"
+	.string	""
+	.string	"systemResetToBootloader"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\002"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\002"
+	.string	""
+	.string	"serialTxBytesFree"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\002"
+	.string	""
+	.string	"findNextSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\002"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\002"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\002"
+	.string	""
+	.string	"closeSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\002"
+	.string	""
+	.string	"waitForSerialPortToFinishTransmitting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\002"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\002"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.bd1bf8b1bfa9e46a,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,558 @@
+	.file	"pg.c"
+	.section	.gnu.lto_.profile.295df517fd181cb9,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\004"
+	.text
+	.section	.gnu.lto_.icf.295df517fd181cb9,"e",@progbits
+	.string	"(\265/\375 {\r\003"
+	.string	"\204\004o"
+	.string	"\t"
+	.string	"\255\242\332\204\002\004\002"
+	.string	"\002\001\002\002\002\001\001\227\267\273\373\r\002\004\203\244\355\233\004\003\002\001\007\262\211\373\251\013\002\b\276\362\342\333\004\t\326\207\316f\004\n\301\256\303\221\001\013\333\205\320\333\016\f\240\342\234\212\n"
+	.string	"\t"
+	.string	"VE\201BU\314"
+	.string	"8\243\200+HY\324sJ\231\241m"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.ipa_sra.295df517fd181cb9,"e",@progbits
+	.string	"(\265/\375`\022"
+	.string	"\035\004"
+	.string	"\022\006\017\022\260%\351\035\206a\0300\026\3156\262Ik{\313\224\002\356\002\034\205a\322\315D\312\216+B\224\367\250\307#\304<,$}4R\231R\340y5P\307P\\\265\005{s\264\215\345B\035"
+	.ascii	"\020D\313l\204\214Y\215o0\302\t1\340\002\242\203\\\204\320XB"
+	.ascii	"\033,\220\212\260U1Z\001\347!\017\253\303\254\241\020\004\013"
+	.ascii	"\3526\260\"\323\240(\003\234\001\244\332\271\312u\346\006\232"
+	.ascii	"\313oj9\r\f\001"
+	.text
+	.section	.gnu.lto_.inline.295df517fd181cb9,"e",@progbits
+	.string	"(\265/\375`\212\001\245\b"
+	.string	"\202\315,2Pm\222\016P\264\201\232+\232\022\035\003\355\352\212\006q%\021\230\271-O\3347s\031\036\303\236\231_5733k\213S\017l\326~k\244\221-w\n\037\205Y\210O\307#)\324\341\323\361LS\246\273\316\340\005\362\360QQy\322\320~\200\342\"\202\243\262D\341_z\354\276\003\f\311\314\350\350\376\002\320Y87Jo\200\026\"\036$U\3774\225\2606:\bf?C{\r\216,d\224\004\364/\241\226\306\3045}\267\205\203?"
+	.string	"\253\256\2501\355l\f\342e\367r\367f\232\231\331~\223\231\326G\027\340P\257\365z\205\263\336\370!\024#3)/\335M' p\002\241\240\220\017@\025s\276X\261u\374y\351\201\342a\344\200n\005\002!@pc:\353\324IiE "
+	.string	"\310\205\2659\007\204pj2\256\220a\",a4\304bb\241\334\373t\302S\027\241\351"
+	.ascii	"\271\257\345k\3042\305\332\022\303j\217Z\fZ\322X\371\315d\264"
+	.ascii	"\213t\r\255\270\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.295df517fd181cb9,"e",@progbits
+	.string	"(\265/\375`\025\001e\006"
+	.string	"\262\n\035\"\220\245I\007\177\371\244\347\035(Gh\376\377\277\304K\275\270\273\2738'\021\002\203\253\335\3356\337D&\031$\357n\354\033\353d\212D>\274a\364q\360\356\325\225\365>\360_\006\231\036]\360-fGO('`K\035\360"
+	.string	"\277\\K\022\347c=I\363+3\212.\221o\025=\364\023RJI)\314\307\320\177E^\313\341\345L\232\365\210~9\370\021\013\326\b# P\2421\312\354y'\224-\305\212\240\271"
+	.string	"\017!8\234(\033s,\334\200\346\036\243E\207`\372\342\242\332\020b{\334\235P\300\370\n\321\007\353\035\004\037\317\031\357\332A\035@\313\332\336\005\004\346r\211\241;\016p\200\240r\267\306#[\001\236[\232pR"
+	.ascii	"7"
+	.text
+	.section	.gnu.lto_.pureconst.295df517fd181cb9,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\b"
+	.ascii	"\231\004\001\205\004\004\231\004\007\231\004\b\231\004\t\231"
+	.ascii	"\004\n\231\004\013\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.295df517fd181cb9,"e",@progbits
+	.string	"(\265/\375`\035"
+	.string	"\275\004"
+	.string	"RF\026!\260%\351\200\303\260\b0n)\fd\t\006 S\224\024\311>\020#\305\332\326\254m\244mB\244L\001\267\205awcma\230\372J$\035\024M\302\271\002\n\254u\3223\020\177\002,\356\261Be8\206\246\215\240i&\245zH\302\377\\\327Zs\236\332\221r\005}<x\242\031"
+	.string	"H3FSbES"
+	.string	"\327)l\006!d$,\306\307.J\314\004\334\033Fa\274\230\265\213\036\200P\fH\004-{\305\006,|\325\343\346\"J9\316\t\333r"
+	.string	"\3307"
+	.ascii	"8"
+	.text
+	.section	.gnu.lto_.lto.295df517fd181cb9,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_pgFind.8.295df517fd181cb9,"e",@progbits
+	.string	"(\265/\375`\371\001\005\022"
+	.string	"\246byH\340\322&\035\222\016\\\035\351l\032 \025\250\370t\177T\365H\274#)/\330\271!\023\250|p\013/\336j\310\312\270\333\020\221\334\322\036e\2529\346\2141\032B\260"
+	.string	"F\275\370\035^\332\223\251\241\361\273\006!{o\271S\nf"
+	.string	"_"
+	.string	"h"
+	.string	"'\340\317\215\204 \330\314\251V\2603x\023\372\311\275\204~\356\bS \235\243\036@:GL\227\340M\243\353\033\235r\243\313\317\360\215\344\203}\366X\363y\221\246\300\371\234\2620\366y\270\224\016\204Z\220 \3714\310%\nk\240\276W\334\317n\302\3431\321>\234\307M\245\326\352\030\373nn\356\266A\330~`\307\001\001\333\301\237\316\350\351\350x\331}"
+	.string	"\021`a\t\220ZmjD\252\216I\003\305e\277}\277\350\241\215r\314c\270"
+	.ascii	"\217S\255\365D\376\314\227\271T\274\r\020\212\f\005\251\025\\"
+	.ascii	"\360i\004\\\214\215\372\274-c\243lo\264?\364\0272\007/x\326\032"
+	.ascii	"\202\246T+\310\300\007\270O\001\361.\036$cW\273I\026\035\206"
+	.ascii	"\320\250\360b-\256\321N\217\215)\367;\2625&\200\264\323$\327"
+	.ascii	"\307\334\322\375\354\347`\263\243i\311\307+>\331@\355.t.\267"
+	.ascii	"'B`9^\254\371\241W\247U\340j}\245\370F\030`\374\023\237\276\213"
+	.ascii	"~\316}\370\230S\024tChh&\326v\351\007\021m\327\307\006\275\230"
+	.ascii	"\302\003G\to\217=2\243\271\246\220bi\355K\212\265^AI\261\272"
+	.ascii	"\024\253{i\231\340\322\255\264`:\224\022\257X,\255\316\302j\325"
+	.ascii	"\352P\236\371\366\3700.W\314\b\223\350e\334rdc\\\253\314\254"
+	.ascii	"gb[\0377\3700\267\335\236\242YT\t~\2765\276\222\212\253\225\346"
+	.ascii	"1\037\351I)\331\242\242\217\251\350\3477\200\210\242\034\257"
+	.ascii	"\370tYk\255\324\n\002% @\002\204\034\245\007yy\321ab\333\330"
+	.ascii	"\2630\370\243@>\227\031\370\250\337\213\254\262\345\350\305\202"
+	.ascii	"-\336/\322\267d/.B\354\201a\300G\335DQ\016\013\335\265\200\346"
+	.ascii	"T\225e7\312\266?\264'\210\006[\\\017\335;\370\214\320r\272s\212"
+	.ascii	"&?/+ \303t\t2"
+	.text
+	.section	.gnu.lto_pgResetInstance.10.295df517fd181cb9,"e",@progbits
+	.string	"(\265/\375`L\002\225\023"
+	.string	"\346c~H\300\322Q:RHP\366e\245H@\270\311QF\242\235i\232Eq\201U\3132"
+	.string	"^N\370\241*z\255}\373\337p\027\205J\220\212\177)\356vV*\225\206 \0010\301\352\214\320?\311eO\250L\303\007\373\311&R\246\024l"
+	.string	"_"
+	.string	"j"
+	.ascii	"\333k`\004\251G\367\316\n\037S'\t\037-\263{\f\270\001@\312\261"
+	.ascii	"p\332\335\226\226\270\354\2500\202\2322\037\225b\363\323\355"
+	.ascii	"fG\205 I\b\242\245\325.\0072X:!B\265\303eT\233\032\272\035\210"
+	.ascii	"\203\340\202\0372\232X5<:\325\316\226\272\332\335\300\222\335"
+	.ascii	"=\320\323\303\256\226\211J\331]\247n\367\341N\3356\215m\024;"
+	.ascii	"o\001!z\241\347\rR\016\244\037\036-\177v\257\226\232c\037\334"
+	.ascii	"\335\265\342\330\251\364\352\275_$\225\0169\357O\241\3221L\203"
+	.ascii	"aZc:\301\364G\0024\261\230vk~@V)\032\365\330\276\357\273\320"
+	.ascii	"\314\203\214\302\243z\264gl\325\343U\266\263\307\301I\301\323"
+	.ascii	"\376\212\377\310\316\243\271\200]\234\033E\033\266|z\356\356"
+	.ascii	"L]\344J\240\263\213\273\316\207\361\030\023@Sp\205\327\271\302"
+	.ascii	"\025_\222-"
+	.string	"\237lW8\221\005\326\016\373\302]`x\\\351\354n\252\211\217\n\336H^M.\2426\313+\257s\tNg^\351\365@g\365\370\230\206\202\034\370\035\026\206\350J\t\034\345nj\371\363\205\334\362!\r\251]\233\003\277\305\213\213o\202&|\f\316\360\222QY\001a\257\230\232\345\004\026\323\202\305\264^ZT\\Z,1\231\326\t\211ab^\261\326\006\030\230XK\325\243\035\\\305\211IJ4\255\241\fd\004\325%\267\250\177\221\njD\341#wF\350\360\t\037\204\252\035|<RUQ$\222rAh\371\263\356\004\r\331\210\005\362\232\n!\302\353H\t\2473\323\370I\241\003j\216?\303\365##\t\312\363\341\b3 p\002\231\261\345\001\001\342el\257Fk\022\032\274\034\212\022\031'B\257\354%\3601\347\001[\241\256\206+\373X\031\323\005\213\207]\345ar\272\272\315H\341\031\020`\034V\325\332E\261\255"
+	.string	"\254@0l\266Uc\020\2445\017y\332\001\225\nR"
+	.ascii	"\202|Q\020\216\233\b\212\"\023\311\342\352\027r\231G\004\210"
+	.ascii	"(\300K\260y-e(h!\336\376e\353lB(\003"
+	.text
+	.section	.gnu.lto_pgReset.11.295df517fd181cb9,"e",@progbits
+	.string	"(\265/\375`M"
+	.string	"\325\b"
+	.string	"\006\322>7P\215\322\001$+"
+	.string	"Y\2165\341`\332\354h\316TR\262\362D\315H\335\246m\037\315\231\003\235\314p\003m\211 fZe\305\353\273E\3155\024\2430A\334V\312\224\002."
+	.string	"/"
+	.string	","
+	.string	"\337\t\260\303\354\030\354\320\236\215b0\npa\260Tv7j\307\275\247\347_\365\013\251\004z\0020\354\256\223T\322\270\365\266\021l'\330v\005\t\005F\nNv3^+\333\202&\036~\310W\236\177\206(\355\320\366\330\332\3415\333O\373 GyO}>\260k\")\331\375\024|\220\035:\n\362W\356\234E\221\355^,\370\"\026\025\376\351\320\377`\207\252_=7N\037\251P\276\354O\224\312a\337\262\273k5\331\232\326\247\376\333\246Sk2\033'n\234\030\361\340"
+	.string	"\0215]'f0\3468\233.Np\\\027\265/t\313\252\311\320\325\n\251\310\227TM\2659\211<\311W\275!\2455\n\n"
+	.ascii	"2\241\373/\260\301\205\003\227\321L\305\003\032\260\nA\233\325"
+	.ascii	"\351p\r/\204I\006"
+	.text
+	.section	.gnu.lto_pgResetCopy.12.295df517fd181cb9,"e",@progbits
+	.string	"(\265/\375`\324\002\375\026"
+	.string	"\266\352\226J\260\226Q:d\022N\372 )\224\371\247\236\026\232\315f\211!P\351{\221\332,&1a:\335\2730\375@]\266\337\276b\340\342\207\256\313\337/\224\377\224\376\2247\033\272\325r\357z\346\236p(tq&8,!\204\020\271S\n\206"
+	.string	"z"
+	.string	"\202"
+	.ascii	"\006\\\240\274\350\363-\343\305\362\251\361\342\001\0042\317"
+	.ascii	"\\*,\222(>5\234\324z\252\366\204\307\242 \237\221\242 \037\323"
+	.ascii	"\303\363\026\351\354%9\212\341\322\231O\341\245\202[\220\334"
+	.ascii	"\023\022\033n'C\230 \027\275/i\270\205\002\214\344\200q\235\017"
+	.ascii	"\035Wl=\367\235\002\331hTl\321\341a\230\300HF\212\025[-\\\244"
+	.ascii	"\235\017\323\326C\367\276\267\210\2401\361l\035N\311\232Z\253"
+	.ascii	"\351\217m\303\215\272\355\030\266\027\330T)?\372\305#\375k\352"
+	.ascii	"\253\254f,Y\n.\323Y3\004\241\324!\342\016\242\367~\373~\215'"
+	.ascii	"\355<\207\007\210p\202\343=\337\367\0332Z\242)'\3436\316s\354"
+	.ascii	"4\254\"\024\342C\255\3656\374\0336\035\373N\247\206f\241\206"
+	.ascii	";\247\246\\\314E\307\2241\333\334\261\315\213\267e\266i;<?Cv"
+	.ascii	"\244\t\026k\025\352\275\224\027\001PJ\355\347n$\373\221\225\234"
+	.ascii	"\245V\034\221R\255g\254\262\326\236\377\370<\336\303&\\\261\306"
+	.ascii	"\377\260\306\213\344\252\230\320\005\251\321\247\260\326ZE\230"
+	.ascii	"\247FrS\226\206C\223\236\0274\034 p?\302\0352jw\357\3731d \342"
+	.ascii	"\004<R\243O&\020|k,\027\265.L|n4\032\364\223|s\035\021\312Zk"
+	.ascii	"3\276\322\013\307g\241\263O:\275\351rB\214\216xhp\201I\220x\273"
+	.ascii	"C\366I\243\237Y\002\242\302\213\263Ij3\245\244F\225\324\345{"
+	.ascii	"7\031\206\320b\3016\247\365\332\t/\327*\364J\246\365R\265^\252"
+	.ascii	"\234\033\033\034\325\n\026S\311\244\354z\261`*\t.\027L\345\223"
+	.ascii	"\347\213\363\b\274\260\373\215\326\235\001\020h\367#\377\331"
+	.ascii	"\370\005Z\327\360,\215E\231\242\342\232k7p@u/\213\264\020z\322"
+	.ascii	"Ta)\004 \302\025\221;\024\306\350\355~\342\177w\270\344\232\277"
+	.ascii	"\233{\335Y\316\245\021N@$5\372\264b\334!\323x\bS\226|\242\347"
+	.ascii	"=`\275\240 \027\310\274\373\b6 0\002b\234\313n$\302\313\231\314"
+	.ascii	"\321\364\fn\305^p\374k8d\346\027\323\301\333\250\330\232+\203"
+	.ascii	"d\310\326_~#[\005[\353k\375K1\274j\034d\020\007@:\330/\205\202"
+	.ascii	"\270\204\276\332*\205/\264\264F\260`\265\312\340\016\027Lh<\242"
+	.ascii	"\371:\332t\262\205\300\236\235\317\260(#H\324\261\260\303o9\372"
+	.ascii	"\313\344\034}U\260\230\t\200\343tk\330\351Fj\256\261\271NH\022"
+	.ascii	"$LW \003"
+	.text
+	.section	.gnu.lto_pgLoad.13.295df517fd181cb9,"e",@progbits
+	.string	"(\265/\375`\304\001}\020"
+	.string	"\206\337nG\340\262(\035bN"
+	.string	"Z\031$\365\021\357\245\257\316\025J\024\031\347  1L\302\223\021=\224$\310\n\207}\253g\367{G\002\263T\375\367\363d\f\001(\354r\214;/\3644\033\034\251\007\322\022\225\315\022B\310\226;\245Y"
+	.string	"Y"
+	.string	"W"
+	.ascii	"\217I\035\266\362\221\335\227\233\331\356X\342\003\3367\217\037"
+	.ascii	"\300}\363N\302}s\312\346\361\221\305~\246D\313\f\236\335\005"
+	.ascii	"u\305S\237*S\376c\007\271^\252O\217\304u6`\3419\001\340\325\232"
+	.ascii	"!=-9\036\273\004\361bI\331=\330]K\327k\304\275\3356\004\333\022"
+	.ascii	"l\251 \234\364<\354W\225\276\b7\303Q@gW\304\217\317\3266\033"
+	.ascii	".l\337\247qY\312m\274\311\344\244\330\337\315qTn\343\t2\030\273"
+	.ascii	"\373}\263U\354\357\233\374\354\032\323f\200m\251\b\301@e|&u\032"
+	.ascii	"\323\f\332M\3413\333\335\022/\360\276\031\230rt\217\035\t.\355"
+	.ascii	"\307\b\037\202\260\344\217/\363\311o\210Bz\331\245\t 5\036\021"
+	.ascii	"9U\325&\225\344]~\354\024^\270\374\360\301\242*\037\307\032>"
+	.ascii	"3y\273-\007\276N\207\320o\261\242\307\371HO\rE\fl%\177\354\221"
+	.ascii	"%\025\306\376\334\335\265\276\330\037\377\257\223\016u\322\240"
+	.ascii	"\323\374\336k\376.\316\200\022\226P\342\210C7\362PBMS(b\230\244"
+	.ascii	"\221\250\026\231\220N \351\004\242\224NL\240HD\201&$\016O#\021"
+	.ascii	"\334\020\206\"\370\215\253\317\325\027G\250Q[)k\n\220\236~\025"
+	.ascii	",p\252\362\316\f\346\242\n\343N\257\027ft\264d\217Az}\354\bd"
+	.ascii	"rX;\261 !7\215\013)H\t\320\002\" \200\202\021Yu1\326\204\303"
+	.ascii	"1\246]d\243k\013\352^s\323\026\254\023\243\265\307\005\033hX"
+	.ascii	"xH\357F2\005A\210k\033\266\361c\304\260\203\213@\212\001\034"
+	.ascii	"\355\343\035\230\013\3141X\004\356\225\345\270!5\334;,\240C\013"
+	.ascii	"\227#M\322\300\326\036"
+	.text
+	.section	.gnu.lto_pgStore.14.295df517fd181cb9,"e",@progbits
+	.string	"(\265/\375`o\001\315\016"
+	.string	"\346\034dE"
+	.string	"\221(\035;n\346)z=\232<\022\210\340\266\005\373@\205f\2110e\322\026N\346=\352a\271c\307\325~\364\022DM\365\017\260_=\020\021\374\377\275\b\254g\3763\230\006F\005\026!\257%d\023\"eJ\001M"
+	.string	"N"
+	.string	"R"
+	.string	"O\373\253\217"
+	.string	"\037\232|\263\233B\342\265\033~\370@\367\315ag\333\017q\021\240\r\323B\016\252g\350\200b\325\330\335\317\300\005\304o\332;\3427\335p\360\t\372g]SA\241\221R\221\236\034\203\335u\246T\026n\275m\017\333\r\354\343\b\034\227\216\017\377\355-\277\306tj\372"
+	.string	"\342\f\013\002+v+\314p\254l\223\371`\373>\314]$/\341\00511\225\273\330$\266\367\362V\311]\274\221b^\211\355}K\033\264=\333\232o1\314\232]\f/^\273\373a\004\311b\030)<\002\tPb\240T\257\234\3764\303\323\353a\256\305\220b&\027/9\n\314\356\211Q=\035"
+	.string	"C\235\230r\346\273\374\371\211\b\335.\005\005\276\211\221\210\357\301$~\213z\327\363\004E\213\231\225U)gvhJ\325`_[M\261\271\264w\226_\323\245;M\007\206\320\231\360\031\321@\243\364tDj\016\210'\364yB\237\204O\210\310\307\021\215| \035\006\205:\242o\004\002\211>/,\335\3464\300I\205\254\244&o2\265S\215\332\017B\362)\237u\007 ^6d\234\224\344\267\314\271L\247\323\267\276\271!\273\260\262\3424\365\254\007\034"
+	.string	"\034\312\213L\333`\304\255\026\2244\364\234is\250\226\217n-\020KV\314\022.\214\204\317\262\b,_\212\210\320#g\260\021\324\314bv\351aC4$"
+	.ascii	"V\004U\003\356\201a\002\025\031\234xR\255\230\204I\006"
+	.text
+	.section	.gnu.lto_pgResetAll.15.295df517fd181cb9,"e",@progbits
+	.string	"(\265/\375`o\001M\017"
+	.string	"\246\\fF\360\260(\0358\030\001\330\361\327\275\2107\336V\367\316\342\277\305.\356x\332a\230\336\277%\271\253\020\242s\362\331j\341#b~\335\337\272\331\224\227\003\313\201g\310\313S\303\221\322\332s\240\277\357\276\020\261do\271S\nS"
+	.string	"P"
+	.string	"Q"
+	.string	"\007W\373\027\211\n35v\267S\016\336^Thd\274\250\320\314.\301[\306\322\247\324X\362Y\357X\271I}%\237\222\203Ry\030\360\241\244'\244\325\334\365\210\362\235\242\004\221r\275\353\tVlR_\312#\207\301\356:\246\276\013\367v\333\024l\033\260\017\0066\0304\224\320\031\270\252\232\215\225\315\232\017o\375\366\375\230\307H>c\217\031,0\273{\231\303<\362\227\365\2031bw\017\343\273n\342`\351-\221\357\211\005"
+	.string	"\252\030,\332.\350\361\351\016\356\323\340\013l\237\3349\266\021\233\304\356|\276\343\222M#R\357\272\024\361\275x\315b!N\261\346"
+	.string	"q\352\325\207\201\210\342S>\354\rnd(-\361c\206\360\024!\334\256\211\002\037\305\004\t~\007\221\355s\352c'\020\312XbdL\261\246'Z\240>U\027\033<\305{V!\315\332b\313\350)\337\272\317y!\020I\375\371\b\215\272\320\250{\3409"
+	.string	"\351>\244\220\356\203\303\242\021\210\324E\020\211H]\0074][X\347b7d&=yV!m\252\213\027dP\251\2340\372\343\035X]QXx\334\356\211\212\257"
+	.ascii	"\311\220\267=\345m\237W\001\033^.Lbx\271\273+\215@\003  P\002"
+	.ascii	"a\020\261\003a`\367\035\264\316\371\3331\2226H\302\242a\032\336"
+	.ascii	"\032\372Uoi{\3613\264\220\316\n0\241\235P\230\"\266\267\303|"
+	.ascii	"3\3356OL4\027\341I\357\263;\264\373\305]2\303\354\006:\003\265"
+	.ascii	"A\276\224;\227x\002"
+	.text
+	.section	.gnu.lto_pgLoad.part.0.28.295df517fd181cb9,"e",@progbits
+	.string	"(\265/\375`%\004\205\032"
+	.string	"\346n\241G\260\230M:\360o%\004\020\317\021\354\306\002\231\373(\305\023\340\325\353@\370\260&6~E${t\361#\024\332\364\t\025{\022u\224QF\303\250\2768\345;\371y\270Na\001\347\n\375\324\002\315\253f\266\331\275\367N)\201"
+	.string	"\213"
+	.string	"\223"
+	.string	"0\317x!\340\fw\351\346\tu \266\007\361\3163\2732\306P\355.N=\275\2312>\007\312\037\346\202EA\214\017\301\367\020*\020n\212\233c\264\357\364'\333{\b\275f\227\306\020\252\335\220\301\251\021\324S\207'\340:\255\267q\235\332\347a\033\274\331foy\210\333\347\230\222\240\264v\327;\2256n\273\214\323\346\177\3523JKC\227"
+	.string	"\226T<\016\370|\351\354\256\353\212\233\336v\216\355\n\366<\021\336\351\245^\355\373L\216\365\275\212\257\305J\223/\361\243\234\212aS@)\336\335\220\321\251\247P\300_\315|C\024\356\355\266\033:\371\023\333\257f_\245\375z\t%\324S\001\3616\256\235\375Y-1\035*\362\335u~\225\222$\037|c\224\344C\035\272\325()/\262\"\324\250#GR\273\316\324\207\256f\277\310\251l\230\203\2563\205\251\035\273\013\013\232~\024\350O\031f\373R`\234\260D,pN\211x7\005\254\321\214\023\016\352i;\357\302Sw\215 \370Y#z\374\033B\362XOP\242)W\302\351\211(nEY\303r\316\2254\354\347\376\031"
+	.ascii	"\3215@\364kF\273.\344\2473z\322DK\232\350\370\360?M\315\002\027"
+	.ascii	"\273(\266\306l\fz\004\307\225"
+	.string	"\374S~(\337\342\0079\240es\231\216\244\226\00795\313\036\342Ph\320\212\005B\\\212[\026\377\350\024\2218\232RA\376\221$\216&\324\212\254\246+\236\315\305\035M\023-\302&\2555\nq>\317b\210\273\001\205Ab\241\265\033\006\356\300\263\0237\354\304\330\017\017\210\351\341\223\325h\261\020\257\230\bYm\316>\032\207\351\023\243I\3674\360\001\362|\200<\0172\236\231\327C\253y\rl\374\001\305h\036\210\357\243y\361S\257@\214\\\021\311\")k\330&\020_rFVi[\270\020\257\344W\275N\321q\025&\013I\016\371V\306\360/\031\252\274\325k\304\\\301pzr\311\227|\325g\216\026`\222\250\234\322%\217\364E\312)O\345\323\210\017]\016+H\231\003[\237\271\242\224\322\300.\211\251(n\371X\016_\250\241H\203\224##$#2\222\222$\035\200\002\021\243\273\r\020P\210\204&I\2411"
+	.string	"\026\345\265,\303_\346\262<\002\302\276\252w\37212\375x_\200\005I\236\347\241\330\205g\234'$\357j\221\342\315=B\320\252\263I\304 <\312t\350\336\216\311\306\231\370\341\323QA'\365h\3563\362\265\331\313\271C\316\203(he\013p\007\210\364+\001F\377=ra\254\253\374F\030K\370A\235\020\352\001:\b\3228\007\335\226\005P4\234\253\256\326\t}\001\356A\276\311\t\003\332d\264\032\f?M\213\227\034\237\b\310\252\002\027\217\377\353s\376\375\235\\\345\353O\247\311\0323\2709%\255\\k\334\247"
+	.ascii	"\202\202V\213m\236\301~"
+	.text
+	.section	.gnu.lto_.symbol_nodes.295df517fd181cb9,"e",@progbits
+	.string	"(\265/\375`\211"
+	.string	"\r\007"
+	.string	"T\n\205\001"
+	.string	""
+	.string	""
+	.string	"\002\034\177\016\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 \b\177\017\252\333\3426\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\005\021\020\005\020\021\002\n\177\022\023\023\024\024\013\177\025\002\f\177\026\002\r\177\027\002\016\177\030\017\177\031\360\372\2508\002\032\201\204\001\025\177\033\377\037"
+	.string	""
+	.string	"\200\200\200\001\022\177\034\003"
+	.string	"\r\344\001\003\004\204\001\003\004\r\250\270\275\324"
+	.string	"\001\204\006\004\004\264\345\241\253\002\001\265\007\003\007\004B\003\b\004\263\244\257\024\001\242\006\003\t\t"
+	.string	"\240\276\320\347"
+	.string	"\001\342\001\003\n\013\004\221\205\327\307\003\001B"
+	.string	"\027"
+	.ascii	"W\330\311\315\362u:\306\311\346\f\207a\370\024\211>\246H\t\206"
+	.ascii	"\347;\233\225[\0061;\037\301\220&&N\b\240\003\b\006\027\223\022"
+	.ascii	"A\bGTb\004\025\020O2t0\235"
+	.text
+	.section	.gnu.lto_.refs.295df517fd181cb9,"e",@progbits
+	.string	"(\265/\375 -i\001"
+	.string	")"
+	.string	""
+	.string	""
+	.string	"\002\001\002\002\007"
+	.string	"\002\003\006"
+	.string	"\002\004\002\005\006"
+	.string	"\002\006\007"
+	.string	"\002\b\002\002\006"
+	.string	"\002\003\005"
+	.string	"\002\013\002\002\005"
+	.string	"\002\003\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.295df517fd181cb9,"e",@progbits
+	.string	"(\265/\375`t\023\005]"
+	.ascii	"Z\231\334!P0\222J\032\016\233\026\205\234\026\342Wr\204\343\225"
+	.ascii	"\312\312\206"
+	.string	"\267\253\276X\026i\\\022|>\254`\360\211\256\352\234\035\"\2322w?\357[t\225\377\202W\337\315.\240u\314\035rEXD\255\212~\375\n\214\231y\007\372\215\030\016r\321fs[)S\306\001\003\002\034\002\315M\263e_1\353\003\262\273\277a\233f{\330\261u^e\240\205\026\327\275\2560\261\202g\215\256\211\323\007]\377V@R\362\003,mq\020\374-\234Kf\315\360V'\335VL\b8c\347E\366\354^\317,\232m\256\363&\326\356\025+\006\020Q\307\346\211%5\223\326#\306#J\211\321E\333\346\331\222\025\243\367\235ms\313\334MOw\001?JO\3520at\315\376\266\303\310c\211\321\323\275\f\3651f\005\215\321\277\240~\005\225U\220@\246\252\211\233\222\241\236\003u\275\354\227m\246X\261o\227\r\373\316q\355\225\225\324\001\343b\364\026\250\337\024)\357\356nS\244\237@\345%\221\002m"
+	.ascii	"\351\205\324\257P\377\375\362\332i\232\315\2451\372\257\327v"
+	.ascii	"\261\032Z\217$FW\313nm\363\304n\371\003\022\234g\334j\255\356"
+	.ascii	"\365G\204]\025\273:F\177\200\372\345\272\017UK\360T\375\236H"
+	.ascii	"\367nO\244g\025hI\244(\226\304\225\177\255\254V\n^\262\007\263"
+	.ascii	"\277\272\327 \025I\026\246\305\350\327\r U\227DJc\313\312 \300"
+	.ascii	"\317;'\376\363\363\020\322\210\237S\370ww\030\303I\374[\267\b"
+	.ascii	"\374\007\340g\021\376\r\272\361?\315\"\205\370\271\202\377h\377"
+	.ascii	"\332\370\367G$\200\013\377\317\374;\364_\315\236\320\002\232"
+	.ascii	"4\032\377\262\300\t\374\033B\205\377b\377\327h\370\374\214\302"
+	.ascii	"\277 \374;\301\277B\3772\360\277\316\277\n\374{\342\337\001\376"
+	.ascii	"-\361\357\210\177E\374\313\363o\372/\377\217\373\017\367\277"
+	.ascii	"\355?\322\377\256\377d\377\201\377M\370\357\346\377\333\177\267"
+	.ascii	"\377^\377\333\374\327\372\177\342\377\331\177\020wwww?\257\347"
+	.ascii	"g\002\376\037\f\002u(\021\251\251\253\r\223\322\311\342\303\212"
+	.ascii	"\233:\267vs|L\273we:)\033J\251\342g\343\371\350#\247\224$\305"
+	.ascii	"(\367\326\361\226\300\320d1\272w\207\343\241\263c>\341\254\334"
+	.ascii	"\227\356t[G5v\033\327vZ.\250\246\270gCA\251\340\371\370\262\003"
+	.ascii	"\313\017\337:\007z\343a\213\321}n]\317\2229\254+ut"
+	.string	"xv \201\023\327\266r\2341Yd\2146w\316\226\371\320y\265!\302\350\3129\334\252\231Y\tat\343\274\254w\226VEd\307\324/\227z\376\323>*\273\373igmeR\317wgW\305/by{\300\177\264y%\330\272\201\\\315\251P\276\034\243\216\242\237\325m\f\352\265\225\311&\2251\271\005\3152h\355\"%\272i\325\311\225j\2112\233{\355m$\3252\206\344\312T&W\246\021\250\221Lc\367\272\004J~\035\215\233lR-\223M\3462\250\221m\354\346\261\210\212d.\223e\230K\240d\363\270L\"\251\226A?\256\214\234\355x\262\245d\317$\221\335\304$uT\0029\223+\263\331\272\367KG+\017\350\226b*\331\216@V,\311\331\224\324\345\310\334\225)\251\212\331Hg2\n\263;J\222\215f\212\300\270:\033\311:\215VR\335CG7\001L\335\306mgw\033\273\273\247\224Z\273\205"
+	.string	"%\261\230\230\272\241L0\265\224qLG7\177\265\211-\223\315*f\213\261\256&V+\255\306\305j6*\245\3324j\351\036\335\275r*\326\022\0078\214\366"
+	.ascii	"*\021\037Y[\310v\226T\335\311\361\352Z\323\264$e\320\030\025"
+	.ascii	"[y\304\206\200\345\300o\316%T\254\244\330\255\r\257\314\233\346"
+	.ascii	"\034\243m\253\211\336R\220\260/F\277K\365\253\265\356\027[\026"
+	.ascii	"\260\365\3222\003f\303L)\263X\306\254s\235P@\215\364\342\026"
+	.ascii	"\247\225f\271\254\227\2171\250\333*\rkm\331,\333\252Y\265]\263"
+	.ascii	"\001F\232T\030}\003\352\326\217\345\222Q\036\213\362\326\343"
+	.ascii	"\r\243,\366\262\036\2505O\035\274\300Q\253\234\257T\3410\236"
+	.ascii	"ZO\033\267\332\311\202\263\2648\317N\302Q\031i\236\303\316\\"
+	.ascii	"\036\220\340o\300#]]\2142\330\371\013\211\\W\322\213\277\234"
+	.ascii	"\270u\261#S\271\253\201):E~\330\022\342\n\315\022)\214\362\276"
+	.ascii	",e.f\002#e\212Q\336:\234\210.Z\256\244XKZ\225Z\022\243\214\205"
+	.ascii	"\263l\363g\274\246J\250\265\277|\300(\201\235uQo\303\376,e+g"
+	.ascii	"\255\037\004\b0C\214P5y\340\262\026\205\225E=/\313\311\267\311"
+	.ascii	"N\230\n\212\\{\231n\311\022\222\366l\345\230\005\202\2268\243"
+	.ascii	"\260\224m\252\340)\347'\f\345 \220k7A\254\311M\361\232\324\257"
+	.ascii	"\212\364gU\244("
+	.string	"6\200\024e;&L\270\311\005\\U\342\230\231\246\303Nwn\342f\007M\024&\\\344\256\256x\007\265$MqY\275\347\233$\255\344\274\303\313R\036O\260\2160\312I\266\356\314s*\016\243\214\244\r\021\"|\244\315.5Sb\002\245\310\371\b[\361p\031\251C\205Q\266b\256b#g+\246\352A\262\025\332}\3345\300g\327\200\235\262%G\256\024=\253Q\231\371\267\0353\347\334\0252QQ<\265\255\234\343\263\244\306\tM\352<\265_\330\232r\352\3100\231~\214\005\t\022\265On\244\354\260\344\220\003\003A\215[m\344\341\022\242D\347\331\343\364\026\306\214\177<y\271\225Y\265z\234\234\2240}t\271\240v\371xbC\342\344\304O\013\325<\267\263^\203\031\271,\317O\2754c\2221\214\262r\353\244(y\250\363\332\322\242\313\022\204\211\th\355\252&,\226\262F\206\r\243\347\033\324\237\223I^\312"
+	.string	"j\253\215>jNJt\236\335R\013\244sgr\244\266\315N\227\335\223:Fy\360\216\036\246\262K\354\2205&-\214\266\231H\340\251\211LNe$#Y\307\0074\264x\216M\330\276\370\206\263\216\rE\340\021\017\030<\"\016}(\374\204 \212>b\215\032$\374\2043~\302t\004\037\361\007<\032\026\211B>#\034HE\300#\241!\021\207\220"
+	.string	"HH8\200\300 \260W\034Jg\b\016m\024\203\300^\r\"\037\022\232CXt\303w#\275\r\026!\230 c\206P\321\367\033\022\025Q\024\207\036\200"
+	.string	"\206\242 R\f\3370\030\343\206\257H\3141\343\007\tI\203\020\276a\2608\343'\354!\005\203\033\f\355\344\020\006c\364\214\200\276\021DE\"\243\242\217\b\200\257\bHT$\002e\374\024\207DE\"\t#\240o8\364\023\016\r\005\031\001\217:\370\t\323\027\245\016\260(\016\211\204,\214\210\202!\374\204\"^t4\364\001}?\365\021\270h\300\305\013\032z\177\001\303\001\030\016\244\177\001\243E\013\030.Z\250w\321\202W\274\r\022\017\n}C\241b08\024\342)\002\342\350\240\350#\362"
+	.ascii	"kp\321G\364\rw\210C9\206E\342\321\317W\302O\330S\034\002\376"
+	.ascii	"\204;\300\237\220W\034r\321B\365\325pDD\211D\337\320\310\210"
+	.ascii	"\250\227C\030,B\213C/\212\300#\034\275S@A\f\024'\214\340\201"
+	.ascii	"Z\304\342'\024\372\t\205\200GD7\204\212\206D!\026#\206E!\357"
+	.ascii	"<\307t\333|\031\307Y\233\335\375\343\223\266f\215\r\210JC\357"
+	.ascii	"g\271#\317\235V\022.pp\374FF\013O%:q\3477]\"\234\034\257\340"
+	.ascii	"\230\334<"
+	.ascii	"\355\23063L\332\332\330\355\203\022\2744\305\2659\273y\245S\254"
+	.ascii	"\216N(R\375})y\2559\263\301\371Q$\212QV\303kT\260\270\260q\003"
+	.ascii	"\305\r\f\026FY\215\323\374\\a\201\2211\3728\3453\312\263\r\r"
+	.ascii	"\207u\257\311J\335\2213@6\212\310\016\264\346\337\356\206\367"
+	.ascii	",\362\244\315\210\361qf\271C\202\206\306\353\0362\007\213W\247"
+	.ascii	"\f/\375\370P\025\207\215\3211c\330L\206\020N\211\316\223\314"
+	.ascii	"\331l\307xd\204(=\231\323\303\371K\017,\346\007\252\273G\363"
+	.ascii	"\220=\244\016\026\217\226%-g\300\234\305\234\313\324\254)kGF"
+	.ascii	"9\214\017\024\032\23082\376\202\022\201\227\250\261(f\2344#\""
+	.ascii	"#\"\"I\222\244\003A\005\204 \006-\274\016\0210%\263lFF\222$\311"
+	.ascii	"2\006\313\260[\253l\017>\230\245\347\271@X7\253\252\322\022u"
+	.ascii	"\307`\273h\2246\310\355\034x7\214O-\t\3259\367\324\205\212\372"
+	.ascii	"/\022u\364z\337<\251\321\355\324+\267\020\306"
+	.string	";\231\302d\251\362/\364\223\214\303Y\312`=i\322\231l\004d\003\342F\005\352]\233\316b\345\036L\212\363\367\005\373\235\023\002]\252\364\232\246\205\020\215\366F}\n\017\257\333y\026\220\377\364\203%8\272_\310\366;X\377\341\325%\013\241\264\235\302\2322\327\356-$\220\230\360\370\236\020\274>b<\362>Oy)\324\221^\316\344\334\215\261\202\244\332\277\031w2\027\316G\026d$\354\223R\036\250\301\263\367\207\3203\f\213h{\024Q\032;\241\337b\330fD\177\224\022\232\t&[d!/:\030'\0327\034\202\326\247\225]\2318Z\221\360\355\005\3363p*\251\374P\341\351)\2641\227ah*T\312\211\240A\377\223xU\021T$\245\261\b\302\r\231;\r\340%\315\b\023s^8\372\be@\035\007a\272\243f1I\264l\342\312UI\204\034\365\007\345(\346\331\300\331\234s\017E\260\241\374\361\371\234"
+	.string	"k\201\237\244k\2664\200\364\355M\262\020`\001f\334\256F\331X*\373\244h!\375&\226\260\247\212A\0344J`8\231!\272\3240\362E\361 C#\347\202\275\254UV2\020%\276X~D\200\305\371wr8\001\325\216M@P\250\200\023\201S\334\377F\344U4\277\323\264F\001g\303k\346\253"
+	.string	"\241^Aw\226Z7p\317\334Dj\316\346h$\371\225\372a\270&\345\336c\202`.\3453\271\2616 k\204\\\f\3736>\274y\351\302lO\021=\031\357\210-e\b/yd\334\024]\0237i<\tN\032R^f\310\242\004H%\345\016ry#\372\362\373L\215\335\237\367\b\004\3501\363v\376;\306@oN\270\314\004\245|\240.\213Q%\305\317\226Y\fr\312\202\203\177\361\357\327\255\017\305\350\211\240Xye\035zKLB\272\020m\370t\331\314\304Ph\220\345P/?\245\223\b\353~\225\214\312(\324\343l\023$E\0205P\0074\234\326$\243<\370\223\371\350\314\2766\345\322e\210\201\240\326?T\037\232\352F1\005?$+`"
+	.ascii	"R\245\343\350H\004p\210\223\330\r\316\t\352U\366SP\037\332\013"
+	.ascii	"\034\016\320\367\033\266\312[\257\376}\224R\237\225\337\314\215"
+	.ascii	"\001J\273qx\226\303\026\2429\002i,\022\321k_o\273?/iu\364\006"
+	.ascii	"\211Kq\001N\366\216\226_\001\003>\234\255\332f\344\036\305\030"
+	.ascii	"\260\027\305\362\r\250a>ni\276\337\345\2115;\330\017\023G\366"
+	.ascii	"\377b\375\323~\263Y&\306q\265\245\344!\343c\270b\374H\206\350"
+	.ascii	"\253\241\221\013p\317\374\360}#h\277\316nZ\263v^\034I\366\302"
+	.ascii	"k\314\300\253\002"
+	.text
+	.section	.gnu.lto_.symtab.295df517fd181cb9,"e",@progbits
+	.string	"pgFind"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\001"
+	.string	""
+	.string	"pgResetInstance"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\001"
+	.string	""
+	.string	"pgReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\001"
+	.string	""
+	.string	"pgResetCopy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\001"
+	.string	""
+	.string	"pgLoad"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375"
+	.string	""
+	.string	""
+	.string	"pgStore"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\001"
+	.string	""
+	.string	"pgResetAll"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\001"
+	.string	""
+	.string	"__pg_registry_end"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\001"
+	.string	""
+	.string	"__pg_registry_start"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\001"
+	.string	""
+	.string	"__pg_resetdata_start"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\001"
+	.string	""
+	.string	"__pg_resetdata_end"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.295df517fd181cb9,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
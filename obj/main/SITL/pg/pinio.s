@@ -0,0 +1,262 @@
+	.file	"pinio.c"
+	.section	.gnu.lto_.profile.2a9b3b0cae2256e7,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.2a9b3b0cae2256e7,"e",@progbits
+	.string	"(\265/\375 +%\001"
+	.string	"\340\037"
+	.string	"\005"
+	.string	"\210\325\324[\001\327\262\311\352\004\002\240\342\234\212\n\003\004\240\342\234\212\n"
+	.string	"\002"
+	.ascii	"SD\330@\033"
+	.text
+	.section	.gnu.lto_.ipa_sra.2a9b3b0cae2256e7,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.2a9b3b0cae2256e7,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.2a9b3b0cae2256e7,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.2a9b3b0cae2256e7,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.2a9b3b0cae2256e7,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.2a9b3b0cae2256e7,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_pinioConfig_Registry.11.2a9b3b0cae2256e7,"e",@progbits
+	.string	"(\265/\375 \2205\004"
+	.string	"\204\007`"
+	.string	""
+	.string	""
+	.string	"$"
+	.string	"\005\001\212\001\206\200\200\374\342\303\247\252\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\336\006us\250\367\005uq"
+	.string	"\005\001\006'\001\b\221\004?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\026./src/main/pg/pinio.c"
+	.string	"\004"
+	.ascii	")\"\301$\016\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_pinioConfig.13.2a9b3b0cae2256e7,"e",@progbits
+	.string	"(\265/\375 /y\001"
+	.string	"\030"
+	.string	""
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001'\002\002\177\005\001'\007\002}?\202\210\200\020{y\274\001w\273\001"
+	.string	"\004\001\001\001\001\004"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.symbol_nodes.2a9b3b0cae2256e7,"e",@progbits
+	.string	"(\265/\375 L\035\002"
+	.string	"t\003H"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\r"
+	.string	"\205\204\001"
+	.string	".pg_resetdata"
+	.string	""
+	.string	"\005\013\001gistry"
+	.string	""
+	.string	"\005\b\002\201\204\001\t\003\002\004\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	",\211]e\225\271M'"
+	.text
+	.section	.gnu.lto_.refs.2a9b3b0cae2256e7,"e",@progbits
+	.string	"(\265/\375 \ri"
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	"\003\001\002\002\002\003\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.2a9b3b0cae2256e7,"e",@progbits
+	.string	"(\265/\375`2\b\325/"
+	.string	"\032V\350\022F`\232R\007\277\366\1776\277\266\303\037\251\021?\265gd\322\215\365\033\025\2249f\367\307\322<\305C\031Q\300\335\232m\213k\233(\033\330\300\363\300K\020\320`\303\341u\333\213c\n\244E\215DO\032e\233\322\246\224\002\376"
+	.string	" \001\037\001\035\260Sq+~\245[(t\253\242\313\361\2675\340\366*"
+	.ascii	"\200\200\001K\362\367\275\265\254>\245\235\255[\210C\026\205"
+	.ascii	"\256\375m\f\270]\315\327\272\205A@8\267\251\277\r\001\267K\351"
+	.ascii	"n\241\0132<\304\376z\024\f\305@H8"
+	.string	"\346,o\310\337\366(\335\336\272\231\247\241\310\031\232s&\360U[Ye\376:\024GkO\363\263\2060\241\203Mg\231,\347\354i\022\272rv\362\264\341_\316NC\367\005\356\013n\223\036aS\326\333\np\357\371\317\312\343\304\325\311\216\332\237t\273\023/#\256\321\2546\253\345\234\207\037\2466\235\376\355\326\177V\354\304u\307\211k?\356\356\271\356\006\323\335uT\257\322\355?\335\016\324\355\004\272]@\267\007\350\366\001\335n`\250\273\373\272\335\247\333\207.\324\335\303\356\257\320\355\r\272=\250\333\025t\373\201\356\266\353\356\233\356\236vw\260Z\255V\273;w{Z\367\032\0271\360;q\355\371\027\270?\267\351\273A\363\222F\256\257\233\032\224\252\352j}\236.\256\352\351\017\367\020\327\037\332\3633\303&m?\330\314\204\020\362\205\355\357-\363\323\260\"1\364x\356\210\254\231\345\335\260U\323h\375u<\f\345zB"
+	.ascii	"\270\254\354\330\372\333\216\327\355dN\246E\025\220\315\337\276"
+	.ascii	"\363\237\325\305\034\265\217\311\221\333\262\367\344\257\216"
+	.ascii	"\277\341v1\367\261\3666\227\372\230\333\275Y{e\342M\006\026_"
+	.ascii	"\216\346x\260\232eA5\375\255k\325rf@\375\246H0\030\247s\251\207"
+	.ascii	"\361\270\3666g\265\bZ\034\216'\230\263\227X\221\234s\273[\367"
+	.ascii	"Q\030\227\3639\004O9{q\361\234\311Mq\343\3139\003\021\021\255"
+	.ascii	"xh\346\236\326;G\335\321\313\322\202}\331\t\024\013\364\373\333"
+	.ascii	">\205\333\235p\263\270\035\256\333\263\270\233OQ\344\214\006"
+	.ascii	"\200N\314\232\333_\357\342o.M\340^\332\341\265\021\347\203\310"
+	.ascii	"\337^\302]\365\004\253o9j\347\222a\310W\223\277\301\024\370:"
+	.ascii	"q\r\362\237\265\035K3\275\362\204\016\\\257\3436\365d(\024\253"
+	.ascii	"\266\034\315z \214\362bb\365\267.H\225\202\313ww\355h\\\352w"
+	.ascii	"\277\005d\3266\345\374]\351\340t\344\353/\216\026\212C\245\305"
+	.ascii	"\2466\305\355e|\336\346\216\215\237\367\221}y\350C"
+	.string	")\201\3635/\365Q\247f\365d\250\025\274\2752,\377\363>\236&\237\234\277\344\212\330x\255\317\372\032O\343o\270\364\261>\252=\215\253\201\002>\226W\377\311\251@6\220\305\355\345\334\022\001\021\345\330\251\t\243\362\\\347\353<\004OR\036\312\306\354E\350>\212\376\324[95\253\315W'\310\330\320\301\227s\333\335?\343\257\\\372\321\006js&\"*\260\343'\206\257l\275\335o\3652t\332`lE\375\375\030\2166\245\372\032\303\335O\345\322\257j=\235\214`\030e\004\220\310\337\207\321ySM0\250\376\266\232\326rk`\031\213c\202\373\215\340~\037/p\335\036\227\334\016\334\277\205?\177\223K\205\336\251=\320\001\373\306\251\315\355\017\001\\\203\362\267\377\n\267\013\255\301j\325\205\326\376\255T\004\202\304\207\021F,2\3514\262Al\021B\004\025G\346\022\022\322\311D\03225\231H=+\220\354\223iD"
+	.ascii	"\266\225\212\222\304\343\222\005\007\026\371\314Y\246\370\233"
+	.ascii	"gQ\207-.\223\315\233e\262\031d\213\024\2160\262\205\362y\237"
+	.ascii	"O\2443)\311\210\303\324d\036\257\223m\006{\207\311\311>\225I"
+	.ascii	"\244\b\001}d[i@3\233H\247\021\313d:\215r\330\242\005v\251d\201"
+	.ascii	"s\\\237\305\035\266\210\2234\222`*o\372\302\005\244\240\022!"
+	.ascii	":\340c\221Q\262i\264T\032W\030\035\235O\243\242\237$\3442\251"
+	.ascii	"\\2\342$!\237,\356\222\251d\217\310'N\033Yc\222\263\230l\026"
+	.ascii	"\3618\215J\307\233T\246X2\221\230\312\245\262YD\262\306\245\346"
+	.ascii	"\n$\t\026\371D\212H6\017\004y\035\\\264\300\322\036\210\3339"
+	.ascii	"\340\321e\311{I\337\353\177\\h\233g\254iL\266p\360\345h\227\007"
+	.ascii	">`\324%\177\277\307\177\271t\350}\264\020\332f4\241\035\032."
+	.ascii	"\265\277\035\314\201\333\207\326a\265Z\255\372\320\332\301\252"
+	.ascii	"\256\2567L\305\313]\240\037\356~\256\356\017\200\216\250A0\306"
+	.ascii	"\2204\306\314\210\214\210\210\264I:`\002\021\252+z\021\200-T"
+	.ascii	"CD\\(,\007\327\037\346\252\241\362\246\225\035\311\215cy\275"
+	.ascii	"GP'\336\035\320\303\3232y\003C\337!\001\316\255?\t\261r0\335"
+	.ascii	"f\320qm\224\220\262x>FR7=\353\220a7\230O\305<<\365\\\232\004"
+	.ascii	";%\231\214IArU\364\353\227SJM\331\f.a\307\245\007P\331\201\321"
+	.ascii	"eT\037\303\271\214PuP\314v\013\037\210\036QW\215\256N\354\036"
+	.ascii	"\\\327\177\027\320\303\201)D\007\222Au,\254\244\b\f\344\206\247"
+	.ascii	"sh\026\035;2\233\364\364\302\361\027\365\\\321Cp\326k\342\213"
+	.ascii	"R\374L,\021\372\205L\232i9!\223u\323\241\353\222\212#\005\210"
+	.ascii	"7#\263\216\020\031\300\371\3108w$\332$\201\030\203\256Ps\234"
+	.ascii	"t\022\262b\323\237 \212\235d\\\301\030\033\302\275\313C\330d"
+	.ascii	"!Q,\303\r\331i\255a9\247j\315\317h \210i\254\3038\202\360Cn\r"
+	.ascii	"t;\335\375\304\020\023\3103\332\035\306w\004!\227\f\374\267\001"
+	.ascii	"\316\2000\243_4\251\020P\355\305\236\243\364\323\006\226\r\351"
+	.ascii	"h\314\037"
+	.text
+	.section	.gnu.lto_.symtab.2a9b3b0cae2256e7,"e",@progbits
+	.string	"pgResetTemplate_pinioConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346"
+	.string	""
+	.string	""
+	.string	"pinioConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\001"
+	.string	""
+	.string	"pinioConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\001"
+	.string	""
+	.string	"pinioConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.2a9b3b0cae2256e7,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,244 @@
+	.file	"piniobox.c"
+	.section	.gnu.lto_.profile.2746f50d230f1ed9,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.2746f50d230f1ed9,"e",@progbits
+	.string	"(\265/\375 ,-\001"
+	.string	"\350 "
+	.string	"\005"
+	.string	"\252\353\260\366\b\001\362\247\273\211\001\002\240\342\234\212\n\003\004\240\342\234\212\n"
+	.string	"\002"
+	.string	"R\004\333"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.ipa_sra.2746f50d230f1ed9,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.2746f50d230f1ed9,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.2746f50d230f1ed9,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.2746f50d230f1ed9,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.2746f50d230f1ed9,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.2746f50d230f1ed9,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_pinioBoxConfig_Registry.14.2746f50d230f1ed9,"e",@progbits
+	.string	"(\265/\375 \223E\004"
+	.string	"\244\007`"
+	.string	""
+	.string	""
+	.string	"'"
+	.string	"\005\001\212\001\206\200\200\374\342\303\235\353\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\375\006us\324\006uq"
+	.string	"\005\001\006'\001\004\222$?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/pg/piniobox.c"
+	.string	"\004"
+	.ascii	")\302\303,\016\242\356\033@\021"
+	.text
+	.section	.gnu.lto_.symbol_nodes.2746f50d230f1ed9,"e",@progbits
+	.string	"(\265/\375 L\035\002"
+	.string	"t\003H"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\020"
+	.string	"\205\204\001"
+	.string	".pg_resetdata"
+	.string	""
+	.string	"\005\016\001gistry"
+	.string	""
+	.string	"\005\013\002\201\204\001\f\003\002\004\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	",\211]e\225\271M'"
+	.text
+	.section	.gnu.lto_.refs.2746f50d230f1ed9,"e",@progbits
+	.string	"(\265/\375 \ri"
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	"\003\001\002\002\002\003\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.2746f50d230f1ed9,"e",@progbits
+	.string	"(\265/\375`\354\007\325."
+	.string	"\212U\300\022E`^N:\373\310\262\230E(.\346\036\205#;Y\307\00248\212C\363\212\363-\257\256._\032`\324\206\356u\306N\366\266\340_\300\023\343\310\347L\222\232\035\304\025'U\236\324\263(\325?\"\022\371m\245L\001\373"
+	.ascii	"\027\001\"\001\247\343\244\323\327&u\026\323L\320\336\336\332"
+	.ascii	"\032q\026\312h\254\306k\350\215\201e\241\263r\314 k\013fe\026"
+	.ascii	"\035\261\341\304L\333\253\250\0323\371\013\247\235\327?\370\245"
+	.ascii	"\276\260\027\356b\300\305\275B\302|bq/\314\354\356\275JOF\177"
+	.ascii	"\270n\233\265\307\200^\n\345.\335\240\311\202M)R\247\355\271"
+	.ascii	"\313\317Xxe.$\356e\336{\007\030\335!\263*i\313g\234\205\231K"
+	.ascii	"\274\345\016\"\234w\225\345\226\335\273\376\214\006Q\031\024"
+	.ascii	"\250\355\025\240g-\367\261\271\021\336\350y\351\344&/\235L\234"
+	.ascii	"tZ\006\236lE\352|\345\34726\003\236\\^\353E\273\367\376* !\253"
+	.ascii	"\322\366+'\235(\003O\036\003\317\237\003\374\234\364\263\200"
+	.ascii	"\237\221~\376\375\f\374y\300\202\377u?\373~.b\005\377\177\177"
+	.ascii	"K\375\234\340\347\245\237\013\374\254\364\277\315\177\241\377"
+	.ascii	"o\377\273\331l6\377S\375\f\367\237`\001\274f\223\233\316\367"
+	.ascii	"\017\264\031x\036q\322\371\336\201\276\273\320\237\375\324\t"
+	.ascii	"1\323\360\221\253c.\274\030ZAV\244n\023\247\345\242\355{\013"
+	.ascii	"=b\340\311\304\300\263\235\3540\236_\0256\"jw<\034Q\243\326\326"
+	.ascii	"\326\3517&M\266\350\370\342,I;\233#\244\326\344\323\243-\313"
+	.ascii	"A_p\263\t@\330\032\220\257\266g9?\267q\034\026\315;?m\037\207"
+	.ascii	"\223N~#u\206C$g\206\016K\333\"8\350y\215\231\355\334\206\311"
+	.ascii	"l\274\326gk\027\322\254F\025\273\313\005\306\300wdM\317Y[V\303"
+	.ascii	"k\230\315\337\353\215\321j\003\266\005=\317\001(\302F\t\224\266"
+	.ascii	"\315/sr\334Y\356\357\r\225q-\323V\364\374\306p\177\217w\0077"
+	.ascii	"FF\333\363\024\364\234\346\177\257\005\0351*m\031\r\372\202\215"
+	.ascii	"4\365\346d\261\203\244\355\031\315\317c\230\f\273\221\270w\331"
+	.ascii	"Z_^x\332\262\031>sv\3432\227\335 \004\271\027\213\335~\202\356"
+	.ascii	"\305\3721#`F`\253\2141\361r\3323\031\0326\320\277}\374\355\243"
+	.ascii	"\277\354\325\321]\216\025a\273\\^\f~t\344\264\211\265\005\323"
+	.ascii	"\203\203\226\245\306\037\364L\205\331\315\231\216\231\354\246"
+	.ascii	"\275\224\316\326+\237\031+\366\213\330\023\037my\254JC4z\250"
+	.ascii	"\241\325A\317f}\330O\034>v\\W\246\246\257\332E\0248\336\323Y"
+	.ascii	"\275\305s^Gw\271V\207\316\254\213\377p\235\357\n\351^2\271&8"
+	.ascii	"zG\353\350\033\315\3259\230\331]\275<\347a=K\006\324],\250/\317"
+	.ascii	"\025\271P\026\367\244\364D\364\246\017\2239\237\345>\267c\300"
+	.ascii	"E\214\rW\346\320\335\273n\365\213\326\3429\257\365\336\030Ag"
+	.ascii	"\007\235\335\275k\215\266\301\314\336\272\322z\357\323\023\001"
+	.ascii	"\243@r\354\256\234\366o\255\246Q\3046\343\013F\333\236\301\314"
+	.ascii	"7\032d_\320\277c0\263e\374N\3215\360\203\341\344nI\333\206q;"
+	.ascii	"2\256f\320h\373>/cu\264Y\211KC\337Z\320w\224\306B\335\320\205"
+	.ascii	"\3115A\337IP\276\343A\314l\342\3469\020\003\272\020\326z\327"
+	.ascii	"Fr\227\246e\f=7\235\001\257\202\352\020\202\003\210(5%&\205*"
+	.ascii	"\223\032t\360\340\304\360\210b*M\036\247~+\220\307)\240U\252"
+	.ascii	"*W\200\b&\251\257\202\"\002\207\306\024\031\324TId4\321B\312"
+	.ascii	"`\221\0324\022\221BF\"\222\247\006%H\251\306b\n4eQTZ\2452MRQ"
+	.ascii	"\t\207V \217C\233T\221\274\033\255H\252\312\"1\3750"
+	.string	"\340C\252\324H,\242\020\016Q\245\312\024\326x,\252\303T9t\241*\244J\006\211H(_RX5\264\301T\025\242@Z\245!\324T\231~ \"\017\250\257\"\360#2MF\251\307c2\212\210\212\203jL\215B\253d\212$R\006\211E\023\306\343\224\212#\206#\253\006'\250\306b\212\241S\2400\305$\302\203\006t\b\245\342X\342X4\026\221QDd\224\261(\264\212\032&\225QPJD\372\353\274\203\003\313\352!\274F\024&LV\223\006\002\244\307\354r\275]\347\226)_vv\227\313\215\001\222\2229)m;H\2131\323\251\205\274\267\\/\263\367fO\030\332\023\364\354t\376\330\351<o,,\314\256(\310\215K\327\366\274\200\204\250Q$\207\214D\310\230\031\031\221\021ma\332`\002\2219v\363\021p-DC5\232&\225\345W\343y\374$PG\220\022\276\234AI\3469\216Qd\227\031`\270"
+	.string	"\243\241\bb\310\002\332>\327\376L\303$R\224\215\246\205\033\024b\354t\234\353\305\221\007\346\330\216\025\017u\213\\\213\340}\226m\034S\277\003\2371p\327*\242\372c\340\0239s\341\204\020i\211\330a\232\356F\372\027\374\362\234\002_\027\377\224.X]\302\260vp\252\336\r\347=\256L;\030\246\206\313\261\336\232\202\032\320\2349\211\007\350\3703\001`\202\343(8\f\006\013?\217$\305\034r\210r\275\212\177G1\223<$\234p\f)\344'5\031\222k\250\335\330U{\356V\361\253&$x\217\374Q\033Y\025W\231m\316\024\330\031\221\231_H\246L%q\305\022\017\023\261<\004Q;d\216\227\302\310\0173.\215\377(,\177\030 \007\361\017\035p\377E\023\177\024\316\316Yx\334\300$nHy;"
+	.ascii	"]e\n\177\321\3021k\032a\275\242\303\246\177"
+	.text
+	.section	.gnu.lto_.symtab.2746f50d230f1ed9,"e",@progbits
+	.string	"pgResetTemplate_pinioBoxConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343"
+	.string	""
+	.string	""
+	.string	"pinioBoxConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\001"
+	.string	""
+	.string	"pinioBoxConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\001"
+	.string	""
+	.string	"pinioBoxConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.2746f50d230f1ed9,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,202 @@
+	.file	"vcd.c"
+	.section	.gnu.lto_.profile.5f9d5e58de9b79a4,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.5f9d5e58de9b79a4,"e",@progbits
+	.string	"(\265/\375 &\375"
+	.string	""
+	.string	"\270\032"
+	.string	"\004"
+	.string	"\374\336\245\336\r\001\240\342\234\212\n\002\003\240\342\234\212\n"
+	.string	"\002"
+	.string	")Bm"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.ipa_sra.5f9d5e58de9b79a4,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.5f9d5e58de9b79a4,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.5f9d5e58de9b79a4,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.5f9d5e58de9b79a4,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.5f9d5e58de9b79a4,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.5f9d5e58de9b79a4,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_vcdProfile_Registry.11.5f9d5e58de9b79a4,"e",@progbits
+	.string	"(\265/\375 \200\275\003"
+	.string	"\224\006R"
+	.string	""
+	.string	""
+	.string	"\""
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\203\235\275\013yw\350\367\004yu"
+	.string	"\005\001\006'\001\003\202\0040sq\300\001o\277\001m\276\001k\275\001i\274\001g\273\001"
+	.string	"\013/root/repo"
+	.string	"\024./src/main/pg/vcd.c"
+	.string	"\004"
+	.ascii	"[\005N\271\351\231\304\r\240\b"
+	.text
+	.section	.gnu.lto_.symbol_nodes.5f9d5e58de9b79a4,"e",@progbits
+	.string	"(\265/\375 6\261\001"
+	.string	"2"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\013"
+	.string	"\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\b\001\201\204\001"
+	.string	""
+	.string	""
+	.string	"\005\t\002\201\204\001"
+	.string	""
+	.string	""
+	.string	"\005\002\003\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.5f9d5e58de9b79a4,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\002\001\002\002"
+	.text
+	.section	.gnu.lto_.decls.5f9d5e58de9b79a4,"e",@progbits
+	.string	"(\265/\375`\254\006])"
+	.string	"\312L\274\020Dp\234Nc\177Sg\235\022\330\277\311\250!\251b\002\267\215:]L\374\333\357\016\232T\351v-9rPn\315\004\002I\222\210\363X\331\262t\340\341w\020\251\240x\356\006D\376\320\203\020!\"\264\333\266\233L)\331"
+	.string	"\374"
+	.string	"\374"
+	.ascii	"\366t\204\324\277\302!\210\0306{\2367\027\364U|6\333\307\276"
+	.ascii	"\0251\002\303\236fJ}\265\257\331>Bt"
+	.string	"dkP\354\351\005\251O\305\266\017\017[\323.\314\236\237\222\2628p\004@G\333\216\034\366\364\247\330_\017\345i$\356\315\272\367\022H\321\334\303\263\347\245\034\315O{\0247\200`\237U\224kv\357}\332\003\036\367^=\355g\347\336\253\337\257\340Wp\226\371(R\005== 5\335\213\320\240\003\321\2331\371O\354;\371\031\020\365\002[\257\332\275\367\367#\327\205\371\304\236^_\204\246\007\242@\007\242\266\251\355<\333z\266\353\330\306\263}g\233\216\355\241\003\266\341l\333\331\226c;\310\376\236}\003\366\003\330\037\262}\307\366i\373\315\266m6\233M\333\"\354\363\260y\306\002\237;\336\311\034\315\347\200X0\213c\336\273&\005\223~\320\334\025\231\023:\275\330\r\002\254\026\031\316\3260\035\330Luos9\276\365\310\275cd\006\310\354m9\311\273w\265\373\335\227\257sp\275II\005\202\364\324\344\235\241r\342"
+	.string	"\271\275\310\241e\3173\217\366\2665\326\343\315\227\207\3437@\027\301O\013\311\036\231=\357\306n\\X\275\330\262\247\357\314\345\254\221\245I\334\216\324\017K}.\272\364\fS\307Y\244\376U\37227\363\345\321\317\370c>g\236\253\365\256V\310\336\232\024{\272*\365\217P_\263\371#\324jj\017D\207^\204Z*u1\265\037\007\307\203\026\306N\016\356o\276\026\\<V\"[&\216\013\313\236\377r0_&x\230\365\027t\207\311\035={Z\230\372\t\3207\237"
+	.string	"\365\210t\350@\324\350@\324\337\342\022Q.\004WH-\222\225\267\035\213\355\363+s\373\301\026H\350\257\331l6\217\204\032\275\b=\323|}Y\257\323w\357\225\234\233\217\221\262-t^R\333^\177i\257\365:\255\326kE\001\214\001"
+	.string	"\261\025T\300\3303F\360\267d\253\213\254J\352\317\275\260ZK\326\230\016Z\374\355s`\024\312\236@\260\231\354\226\305\262ZBV\353\215!AmF\230\274{o\227\345\2620\276\264[\326\205\255\225\275\362\327{S:\030ov\351i;$\265\335\221\332~\2456\313\256\3702hY\234\fV\227\230=m\267R\025\267\371 j{\225\006_\204\372\316L}&\177\023\337\355\3137\371\235 \224\325\n\300WY\327\234\274\353%\306\340rZ\350\230\366\334[\203=[aljm\251\177\346\345qt]\344\016g&&\315\325$\201;\0276\257\373\034\330\320\315jk\303<\303\273\230\303\tY\021\335;&g\204\316\355\\\357y\237\363:_\036\357k\374,\327\342\340\352\216R\332"
+	.ascii	"B\303\207%\225XL:\251F\252\260\201\003\023\303\243T\0231yl\372"
+	.ascii	"U!\217M?\025\310QT\251\022H)<\022\237\214T@\250JTBA\035\205Q"
+	.ascii	"\351"
+	.string	"\t\242\252\254\372@d\001\252\243\224\212H\037\221\304\344\222z<&\227~\206S(.\250D\345\317\024\224U\211Jb\222G),\"\201T\341T\021\3113UD\372Ta\004\246\224\230\302\250<\225Jb\362\351\311\251\247\ny\034\236\252P\202:eD\321\223T\221>O\230\320d\024\202\003\206t\250\3644\244Z*\"\227\246\214N'\226\206I\345\222\022\360\2118U4J9\365<\021\225(\316\251\243Q\035\022\225=N\n\213H\245\240\244S\324\360\254J\252Jc\221\350AH\2242B\035\223\035\236\206T@1\353e\337\350\336\254\260\247mi\370KK\303\3428\263\326+\003M[\202\303+\357z}a@DdN\211=\355\r\013\366%\222\r\263\255am\330'k\275h>h\352t\250\341\245~k\250Q(\306\214S\206\220\221\232hfa\222b\003`\002\021*\273n\021\240)S\246\252\244\231\016W\247#i"
+	.string	"\222\327\227\335\006\367\334I\323<\221F\006\374\313\025\266\370R\020U\310\250/\234\322?\277\314\224\004b\244F\370\2574\021\312\314Zt!\317\032\023\357\034\300r\245$"
+	.string	"'k\346\037\331\254\202^\242W\244\333\023\234\020A\341#\336\023c\202\373\357\307\354\347.iP\255\360Y{\275\3352 \331\320+O\365\366Y\274\020\n\306\374\354\375\317v9\206\242V\007\243\357\331\366\356\357o\ni`9\354\227\265\301\0308\323G\355x"
+	.ascii	"\036\"2\321yr\304\201:\261\024\2442`\304+*\005\343\363\321Nd"
+	.ascii	"!\t\204J\230\270r\245\354\362Z~@:\335Z(\257rtiSp\034\353\003"
+	.ascii	"\306\326\210d\374\022c:a]yU\254\321\313\203L.yT\317\247\036G"
+	.ascii	"0\034\252\006"
+	.text
+	.section	.gnu.lto_.symtab.5f9d5e58de9b79a4,"e",@progbits
+	.string	"vcdProfile_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376"
+	.string	""
+	.string	""
+	.string	"vcdProfile_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\001"
+	.string	""
+	.string	"vcdProfile_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.5f9d5e58de9b79a4,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
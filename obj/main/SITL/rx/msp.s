@@ -0,0 +1,297 @@
+	.file	"msp.c"
+	.section	.gnu.lto_.profile.59eb4210aef36824,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.59eb4210aef36824,"e",@progbits
+	.string	"(\265/\375 h\355\002"
+	.string	"$\005\\"
+	.string	"\007"
+	.string	"\332\205\333\362\001\002\002"
+	.string	"\002\001\001\240\342\234\212\n\002\237\275\226\271\002\004\002\003\352\263\360\321\b\004\376\314\317\334\f\b\002\003\002\003\002"
+	.string	"\002\001\002\002\002\005\203\262\371\241\017\b\002\004\002\005\002"
+	.string	"\002\005\002\006\002\005\002\007\002\005\006\240\342\234\212\n"
+	.string	"\003"
+	.ascii	"w\202\t\362\330@\033"
+	.text
+	.section	.gnu.lto_.ipa_sra.59eb4210aef36824,"e",@progbits
+	.string	"(\265/\375 6\025\001"
+	.string	"\230*"
+	.string	"\004"
+	.string	"\002"
+	.string	"\020"
+	.string	"\007\003\002\001\003\004\002\001\005\001"
+	.string	"\005"
+	.string	"@\025\034\024\r\227\0303\203\331"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.59eb4210aef36824,"e",@progbits
+	.string	"(\265/\375 \306\305\003"
+	.string	"\202\306\024\036\240'\351\317\371\244\300\263\370\027w-\276\273Q<\033\002\377\377\367A\341\377\023\261do\271S\377\367\256\n^\025\373\266\356l>\215\307%\013\242\020\372\007\216S,\2102\030\177u\213Dr@\275a`\024\316\305{\025\340S\357G5\263m53\323<\216\b\016"
+	.ascii	"7C\2030.AW\304\322p5\220\224\013\030\215\352$V\261^\005v\223"
+	.ascii	"\036\313e5[\203\001\026"
+	.text
+	.section	.gnu.lto_.jmpfuncs.59eb4210aef36824,"e",@progbits
+	.string	"(\265/\375 6}\001"
+	.string	"d\002*"
+	.string	"\004"
+	.string	"\002\001\001\f"
+	.string	"\002\n\177\002\b\002\001\001"
+	.string	""
+	.string	"\002\005\004\002\001\001\017\177\002\003\177\002\t\005\013\177\002\005"
+	.string	"\002"
+	.ascii	"\0035\334\006\260"
+	.text
+	.section	.gnu.lto_.pureconst.59eb4210aef36824,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\204\004\002\230\004\004\231\004\005\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.59eb4210aef36824,"e",@progbits
+	.string	"(\265/\375 \270U\003"
+	.string	"R\004\016\030\260%\351@\340\202\303"
+	.string	"\227$I\022 \207\266[\303\227\264\326H\223)\005:\032\t\243d\251VU\2761\372k\021\021l\203\207\030"
+	.string	"V\374\330\363\2635\266Z\244\315b \024"
+	.ascii	"F\tPj\200SsA`\230\207\271\306Z$V\025\364U,\245\302SU\354+\n\251"
+	.ascii	"\002\354\346\002uU\013\337\316\230\315v\300\2620h\003"
+	.text
+	.section	.gnu.lto_.lto.59eb4210aef36824,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_rxMspReadRawRC.19.59eb4210aef36824,"e",@progbits
+	.string	"(\265/\375`f"
+	.string	"\245\t"
+	.string	"\366RD<0\305*\035\b\276\374\301Z\344~1\371\210&~\221Pg\200(\021C8\200\026\345\217\221E\206\272^[\016D\004d\240c\0045\020Z\272\216\031|\203J\223\240\326\312z\330\275\267L)3"
+	.string	"3"
+	.string	"."
+	.string	"\037\371\fj\350\241\361Qi\311\006\354\206\333\346\007\227O\275\301\3453v\034\274\202\376M\3369\021\340z\251\256\003\020\273ku\2756\356x\333\035\333\016\266i\001\034\226\335\214Z\201m\231\263\020\333\237\255\261-\325^h\370\036\263\370fY"
+	.string	">\030T\355\223\274\344{x\361\202]\030\201\225\335P\301\t\230O\207\030\333\276H\230\335}\360eG\251\360A>mB\351]\237>\352\362)cf\246\361\361-\332Jkv\250\322\310a_n\204\331V\313\307~\225\352\317L\200\034\210\"$'F\022\\\027!\"\215N\034\352\223\362\b\034\362\224L\244-\345m\334\bD\332B\236i\363p\334\225D\336v\352:o\323\204{\271\021\346\210\260\212,\333\306x\n\030\f"
+	.ascii	"<\241\005(\306\013/J\020\224k\370p\026/\307\204\006s\005*\034"
+	.ascii	"\334\355Q\255t\204I\006"
+	.text
+	.section	.gnu.lto_rxMspFrameReceive.20.59eb4210aef36824,"e",@progbits
+	.string	"(\265/\375`\250\002}\024"
+	.string	"\246\246\204H\320\016)\035\332p \013\tm\027\237d\353\n{p0n\350\rW4\337\212\035>%\341\335\270\320b\311\314\246l\231\204h\353\275\254\312\202F1\310\325\f\262\222C\256@h\224\1778~\365\245\007\233\332\234\264\275\211\334)\005q"
+	.string	"l"
+	.string	"l"
+	.string	"\2739\241\241\335\335\210\005\204\227\336\035d^\206\0070/-\263U\004\250e\034\271\3740\355\256J'L{\034\334\335\240\312~\2322\0045\312|\336;vZ~\332\300\271\004\325\342D\345\310\\\2062\017\301S\r\346\346' H"
+	.ascii	"K\232|D\007z|\301\321\"\230\023s=\320AnxIB\270\230\307\323\201"
+	.ascii	"\335u\274\341\"\334\030\267\255c\333\200\0351\004jc\357Zb\t\205"
+	.ascii	"&\2375gs\274\347\337\320\270\317\217z\357\236\377\271%\030\r"
+	.ascii	">Z5:j\364;\\.=\220\244]\230\237\2135!\211p\336\373\177\202B0"
+	.ascii	"vk\224.\334\203\017\364\343\"p\203\022\360 \371vW\344\322\005"
+	.ascii	"\302\313\230\262\035w\357 \273\217\213\214\261[\2034\264\273"
+	.ascii	"#\036\020^\206\200\217\366y\316A\366\036\226w\004\0175\347\324"
+	.ascii	"M9T\225\242\310\245\276\3306J\245\276\207W\342Al:\270\273\013"
+	.ascii	"\232\300\245rh\252\266\302F\003\252m\225\213\210}\240\330\335"
+	.ascii	"\022\037\304C\270|\335\245\035\300\342o\260y\031S\334X\314\342"
+	.ascii	"\317\376\207\225X\250\363Y\364/33\335P\325\3332\304\373h^\243"
+	.ascii	"\336\246C"
+	.string	"\213?K\275\362\340\320\222z/f\361\247\3323\252\3414\253\253\264b.\004\rPZ-\223\005'\031(,\223\227\002\351\023\222\024\030K\265\362R\265V&,\325\311\013\246\"\371\260+\005\345\245Rq\271^\252\324n\2579\217\370Z\370fJ\363\277\232>\211\033\255|\235\031\260X\363\362\274G\335\316\206\245Y\374\235\324\306\251\031\251\241\252\024\242tz\334Esj\254\300S\232S54%cd\243\241\305\246\355\327\211FX\320\300\264$\325\306\0015 \220\002\23122\017\242\300\002\217\360\250\035\007\230U\245\255n\025\0016;\242\360D\265\032;\346\001\022\253%,q\342t\240\334\313\212\346-A\233=F\322\002\202X\016\231i\250q\323\306xi\b\264\204vk9,Q\252\006t\203\341\202v\022 \221P\205\0330\2406~:l\320\204\300\262\245\005\327\223\200y\341\306\204$\224\215V\233\341u\260\241\321\364\004x"
+	.ascii	"P6]\364\t"
+	.text
+	.section	.gnu.lto_rxMspFrameStatus.21.59eb4210aef36824,"e",@progbits
+	.string	"(\265/\375`\247"
+	.string	"\035\013"
+	.string	"\366\024NA0M\225\016\bu\253\211\037\261 \026_\311\363\256\210\214#X\317\"\3456\034\344\372\016\310*\207@\307o\030\007\250\212\322\200\021\262p\207\007\232\220\372\315`\302\341/\024n\256\355\025\376\210l\"eJ\001<"
+	.string	"8"
+	.string	";"
+	.string	"\336\303\013\254\005)T\033 \273\341\246\026\356=\323\364|\323\263\003.\216\017l]\263\001/\022\255\t\210\312*\035\025<\036{J"
+	.string	"S\231\021\314\356:?p\302\035o;\201\355\002\366-\001\nsj\372\232\256T\036\004p\354\262BVl\2118\"\203\355\333.\331\023\333\231\3665\034\243\364\r\021N\331\205y\204\330\r\t\330\"yt\370\212\366(9"
+	.string	"\355\321\006J\016\212\312\364B\343\0331\243\003\310G\212@\321AAM\322\256\0164L\244R\205\375\214s \371\030\034\022\345\277G_\244=^\037;\345\303\307\013\303u\312\020;4\245^\330\317vw\035\0206\017:\034\002\rg\003\352\204\030\214:\013g.\236\017g\033u[g\323\200\263e\272\317v\t`\316\243\3516\020\307u\333$\334+\314\021\324\247\002\241\277\247=v\005\254\023\351{Z\352J\2159\005\017"
+	.string	"n\b\230\251\343*\026\312\034vHe\b,\266\025\177@\360\210\020\244\206"
+	.ascii	"\271\214>I\303@\206\220\245*\207\346R{"
+	.text
+	.section	.gnu.lto_rxMspInit.22.59eb4210aef36824,"e",@progbits
+	.string	"(\265/\375`\316"
+	.string	"\005\013"
+	.string	"\306\323JB \247j:\220\220\032"
+	.string	"\003\210\300J\300\245|\324\303/)o\211u\031@\343\216\334\247}b\333@\277i.l\333\242\345\2404( \214\006\020\244\024\266\275\312D\314 \032\0204\315\216\330\220\261\021\331)\0052"
+	.string	"5"
+	.string	"="
+	.string	"\337;\247o\360\336}_\360\336\371\264\027<u\355e\037\036\004l\273\013r%?_O\377\261[\320\324\351\265B\261\273\256h*\344\346n\033c{\302\376Evz\252\034\211}\312\356\256\271\226\375\364\257\025\357\225\340\301\301.\310\355\301\326:\004'\266\177\261]S\323-\363j\377u\330y\001\034O\330m\315\016\354\246\021\306\0044\020k\305"
+	.string	"U\205\030\020\256]\324Q[\374\214\274\310J\001\252:k\344\246gg\274\200i\211\321\002(\234\344\331\243\017 }\273+\341\31364\034\\&&\357\235\005\200\001[\003T\275\005\240\3603\222\033\217\030\212\306\221E\251D"
+	.string	"\205\237\221\334\224\312\317\035M\310\024\301R\t\216!G\004;\245\tj\030L\206<%(\"\311\022\274\244{\312r-W\300j(\256\303\346t2\236\007\024"
+	.ascii	"2\241[/0.$@\020\250T#\030\2412\225p\251\200&\225\331\323k\237"
+	.ascii	"\331\245\006\273\342\032\305\n\343\201j\340\n\230\033\240\242"
+	.ascii	"\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_.symbol_nodes.59eb4210aef36824,"e",@progbits
+	.string	"(\265/\375 \204\315\002"
+	.string	"d\004\200"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\023\177\022\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\270\300\202\202\200\006"
+	.string	""
+	.string	""
+	.string	"\005\021\023\200\204\001"
+	.string	""
+	.string	"\003\002\025\177\024\022\025\024\177\026\360\372\2508\272\200\202\002\026\177\027\005\002\030\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006"
+	.string	";3"
+	.ascii	"7\300\b\004\t\304\200\f\323\324\252\f"
+	.text
+	.section	.gnu.lto_.refs.59eb4210aef36824,"e",@progbits
+	.string	"(\265/\375 -i\001"
+	.string	")"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\002"
+	.string	"\002\002"
+	.string	"\003\001"
+	.string	"\001\003\003"
+	.string	"\003\004\001\001\005"
+	.string	"\001\001\t"
+	.string	"\001\003\r"
+	.string	"\002\005\002"
+	.string	"\003"
+	.string	"\002\002\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.59eb4210aef36824,"e",@progbits
+	.string	"(\265/\375`\212\022\325Y"
+	.string	":\226T!S@PJ\352\252\266\2523\2329T\351\351=\375vL\256\0212\312\204\345]\351\362_\304\2245T\335ZU\025 \210\314\t\343;\340Ts;;\3007\315F6\232\207\215\345\301\017&[\214\220\3307Ts\233\311\242\354\033\262\235\316\207\324\336\212\027\222n\233R\n\327\001"
+	.ascii	"\002\372"
+	.string	"\001MU\246\260\340ici2\236\f;\256\260\326tS]\260<\211j+lTQ\313,1\332\330f\222^TX\252\302\315\266\226\263z\333\002\306\323Nk\035\3329\242\325r\305%\217\005b\214\325\0300\236r\027/\367\210]G{\304\216\2714Zz,{\341\n\032G\251\221\022\323.=\345\023zJ\331\214\333\032r\212\247,\3025+\343\025\327\242\214R\270\313\230Q\244h/\232\177\003t5n\334\340\362\224\2714\0313\313\324\224\2659\361A\226C\223mqY\265\273e\230\266.\236:;JCa\376\2344\314Yf\345)gpy\305\2751qun\030a\323\332`r\001lkw\003\006\230\256//\336\325\330\324\323\323\366\362v\322O\270\275\272\t\243H\3014\307\307\372o\333+\3757v'P\323\235\200N,\006c\326.\345\235\313\334]\315\345ojcdx\312\315\305\334m+\351\255^\376\037\377_"
+	.ascii	"\035\231\331\330\025O{Ig\265\223Dkq3\351'\353\214\355\267\377"
+	.ascii	"\255\215\303 f+\313\323\233\026\261s\004.w\223g\226|\n\366\313"
+	.ascii	"Mb\227\213F\233\304\316\227-b\267@\207\3305\222\036\356$!v\311"
+	.ascii	"\247\366mj\224VN.Oq\2160\367Uc\221\310!g,\377\371\337\342\334"
+	.ascii	"cX\027\226\247\334\266\210\335\355\020;$f\016\323G\314\034\367"
+	.ascii	"E\f\3370\273\032\357\230\235\t\003\314\f\002\3230\273Xz\231\235"
+	.ascii	"\212\271Y\346^\231\273\004\346V\231\373\307\334\"0w\b\314l\205"
+	.ascii	"\231\241\314\034ef'\314\374d\346-\346\006b\356\224\231]0\263"
+	.ascii	"\032s;s7s33\2031\363\0273?af.f\306b\346\001\230Y\n3\353\242\321"
+	.ascii	"h\224\271}\230s6\230k\204\004F\234\211;\335\313\233\336\304\265"
+	.ascii	"<\211\037\361-\377r.\247r+\177\272\022_\342W\356\304\237x\353"
+	.ascii	"Y\216\345U\216\244\235\336\345E\330i\360\0328u\0337\232\240,"
+	.ascii	"<!s\310PZ\002\002ej\312\001E\306\370\001\r\223\241c\005\030\300"
+	.ascii	"\364s\207/\325bD\351P\201\t$H\030\246S\022\212\371\337v\271\f"
+	.ascii	"N$\3272e\226\246\342\240\256\364.\247\201\003*\204\271'\206\264"
+	.ascii	"/)x\370\022\311\f\263A-\b\016(\265\031\314!\275VS\274\371\244"
+	.ascii	"\264\036\230\256\344]\376\324k}\366\36495&\247\252\252\377\266"
+	.ascii	"DN\t^\017V;jD\220\262\356\310u\007\210\\v\"k#\374?yE\242Mp\236"
+	.ascii	":\263\207}\206\003\234\210\201y\312\323\t\271\254\203\272\254"
+	.ascii	"C^~\246b.\247Y.G\351\341>\332\271\343/\260O9\222e\216\3557e\326"
+	.ascii	"\264\350x\352p\271wv6\275\263\343\224\354\246\035b\307\351\222"
+	.ascii	"\313)\217\353-\2446\314z\2448.\247\1779\347vsn\270\234s\336\035"
+	.ascii	"#\227sC\256\317\217\313\271\026.\177\331\270|\226S\272\fu\273"
+	.ascii	"\0347v\331\263.{\220\313\276\343\3528\215{\242E\300\360cN\214"
+	.ascii	"\207\031\013\236F\333#\016\245\026\022OjS&\251\0015\366[\001"
+	.ascii	"2d\f\361\242\377\020-B\240\236FstMr|\251\342)\373\337\2360\255"
+	.ascii	"\245\327r-\223\307\244\307\021\261\263\276\362\214k/\375\245"
+	.ascii	"\305t"
+	.string	"\017\r\246\307\264\263\3034\024\356-\315\205sZ\356g\207i\270\336\312\265_w\311\211\244\305\306\232J\217\255\236\035\232\207&\030I\032\253\013g\361QJ\312(\251uA\377[\206\200\271\303\3024\016\r\346\243\224\374c\026\034\212,7'e\334\177[\242DN\211\335\032\033\021-7)\367\330\315}\213\330\235\350\255\313}\365\326P7^\020+Kd?\336\330mH\f\371\314\302\355\266e\023m[\332vell~\345v\027\363i\347\303\227*9\226\334\n\373\025vs\267.6+O\275\255evH#b\264X\254\006\330\225\031\327u5\247\253\265W\267\357\304\213\361\311\266\001\336]Q\241\342i\327)Y\205=m\255f,,\013\017G\003\021\026\245\242\202\346ghm\311$\321\231\266\254%\247\247\274\013r\231\335\314\351f\315%\203|\022P\270\252\252O&\033\340\035\217\313\216\203\213\261\217\261\217\271\224\013\332w\372"
+	.ascii	"d\tW\025\367O\311\035f'c\227\262%\343\203\206\rHO\035\212\347"
+	.ascii	"\300{\323\322\322\3419x\224t\006\227\022*Z\363\002\024\027\247"
+	.ascii	"N\314ev\346\335\033\223\377OC\327~2\211f\327\272\356\035f\020"
+	.ascii	"\235k\005\2309\375\0343\027\200\364_\234\002\335r\213<1\346p"
+	.ascii	"\235g>\373?J\025'\220R\036\245n \233R_<\016)\342$_\252\210l\376"
+	.ascii	"\343\374\361Xd\261|\034d\363\225\017\243\212\262\277\225*\376"
+	.ascii	"q\3718\177|\243\016\362(\245D6\215J\034dSJ\371M\251\277\371\243"
+	.ascii	"1\031\343\370I\234oJ\361\360\315\245"
+	.string	"\362\006\331\\*\221M\251\034\215\205|\203R\232A\247\256\272\210<~\023S\2241ys\206l\227\337\366\337O\245O*\360\037\265L\266\031o\364W\322YSR\023\343\262\007`J\232Z\376\361\fI\303\362\237\206\244\241g\212\240\330\236=\220>+\272\020\3653\224\376\t`\372/\366\237\375\177\361\377y\311\250\366\037\352\006\311db\372\177\312a\372\250\"\230\322\277?\257|)\221\315\251e\017\230V\223\371Km\261\231\337&\225\274\315\242\222\237\361\377\255\3452\225+\300\205\261\337Pd\n\233\021O\301tO\314\343\030OY\347\344rc\325\350\255\032\343\315\037a81\225\336\345.\370\217\234\222\344e\2225\006\252\302\016\246T\2249#\212\311\354\001<dB\003\027\030x\300\303\252B\253\217\3251\341'$\372QW\341O\221\312\016S\360\300\206\005\0061\220Q\221\200\352O\005\302Q\203B\02657F\303\242\313\001\374"
+	.string	"\031\r7 \2565\374\003\256jP\025\272\034\201\212\007T\370\020y\354\263\342\304\212\023;\366Y\321\323\263BE\317e\025=9\226x\344\263!\256\037\214|E\277U\267\252A@$\341j\024\244\022W\"\037pU\2078D\225\310\350\210\305\013\"\337\320\007\"\341O\310\nW#\033\266\207\002\202 \340\257\367b\355\001\215\206=\342*\200\032\004\\W\025I\330\013\002u\330\036O\310\347B\b\354\t\035\021\031\345\340\260\352P]\205\354\221\257\027\024\004\222\320c}\303^\321\321\312\232\240\032\r\013\240Q\211|\277\341\007vU\221\202\300\036p8\\g~k\020\260H\027\004\026]\023~\352\320\217\350+\2726\303\037\"\037RP\bd}DB\243Ue\203\030\374V\001\206\252\272\n\251,T\"\241 \005E\276\037$\243\027"
+	.string	"\004\021\t\207\\\250\254\017\t\310\376(P\203\204\033\254@_N\020\370S\207G=\242\257\250G\\gX\0362A\\\205F\352\312\303\n\205+\317\314\013\0316x$\374\241QY\037\320\320P]_\250@\304\025\004"
+	.string	"\301\026(\370\200\202|*\320o\235Y\331\016"
+	.ascii	"`{>\274`\213\341\021\353c=\370\2556+\333A\210aO\b\370\"(\374"
+	.ascii	"Q\213\200l\360\b\210\270\342\004[\250E\276\265\305p\250\376"
+	.string	"\204k\007\277\365\306\307\372X\020\251\301\240o\3507C$\024V\320\323\261=\025=l\020xtY\002\t~t>\340\300\202\3733a4,\342!\256<A\240\257\210\347\267\016yL\204\360\222\226\244\211\215.]\244\350\252|\2209\267\264\323\267\370\217\t\236oT\356@y/eq\237\214\322"
+	.string	"N\fgTkX\2608\\\317\027\\U\225L\220&Nh<\260\303\325|\201\371\342\364\324\2638\364\342\300\305\206\026\034\352oTThi`9K\212\354p7/B\263\f\201w\250\2210\212\2243#\"\"\"\"I\222\244\003a\005\304(\350\244\262\035\022"
+	.ascii	"\2055\3172\311\204$I\226\375\357\357C[t_\203\227Q\321(\236\372"
+	.ascii	"\300Z8]h8\3436BP\341\026yz(\274\360\325\205\341\230\303\227\311"
+	.ascii	"\021\236\2729\213D\364\3158\f\313\005\274d\300\002\251\243#\242"
+	.ascii	"\251\265P\222\365\030&\2107\367\217\337\223\330Do\216R\321\236"
+	.ascii	"M?\003N\371\2521\344"
+	.string	"\r\031na\246Mh]X\022\322\243\241P\375\205\255.\306\333\271.\213\236\257\216\234\2414\231[\276\232%\003\220\3123 @\204\265\216?\250\316*\374LCj\343\013\200P\3776\220\272\244\374\023\357\374\007x\245Ba\303\322@\023\350\324\216\td=\206T\312\227\313\360\023w\353 S\231\302'a\305\331X\177\200\316\004\007\333\3076\314\253\002\006C\376j\373h\250\222\200\030\2257x\225\033\253nh\373\002\306\300\267c<\305E#Q%\260Q\341\335)\220\236Tz\345\fT\337e'#\335\250\332\227T\323\024\214\222>V\030\356\364\034\243\226\032I\"\364i@\231\"\372L\370\350\377\020)\267'M\266\376\347F\276u\331\351*K\202\b\311\234%\353\r\306\025\2604\2026\t\311\353\004\237TU<#\246\262\\e\320b\022\240\267\332\305\335\3447 \230\340\3229\324\221\372\216\375\022\311\035t\303R\003\245\337\251\340"
+	.string	"\301\005b\253\373\373\020\375\225\034Fc\225\321\357\255\311\326T\203\230\350X\031\335\036\252\360\260\312\260\037\3508\315trc\333b)bF\206\300O\023\336\004\315\277\343*\312\342\212\320\272\320N\367\312}\"\366\023"
+	.string	"5\210\271\202\241\2438\205p-\220\222q~(\302\030\023uK"
+	.string	"\303\240\227c\325\344\005\275g\242x\001L\236d\253$\bU/r\335\260|a\236\3672\240\260W_\212\257\037l\031\345\331D\3104\334.1\327\302\211j\213 \340\234\237\211\235\023BFV\353\256\301\332\203ERn\307 B@\260G\007\356u\030\277\233\036d\021\2178\220\234\\1@f\036eX\362\200W\217\247\331\204'\027\260\347\303\223\004<\330\364"
+	.string	"\354\213\325m\233\300A\020GI\356\0300\f\256\2459\330{\277\275\210\307[n\300\r\207\270\031\342\351\034\312\307hu\360T*m\006K\213\370s3\204\343\262\334\275\rxQ\221\340p0\260\211\007\217S\303,x\\\202\336p\367\357l"
+	.ascii	"A\323\306\n\201\034\322\201\177&\216e\352q\273\035\3628`\224"
+	.ascii	"\367\335\f{)\304\262\271\355\206)\347\223\352\217u\036\374\026"
+	.ascii	"\243\343\030\203\211\266\217\232E\f?\0067\270\224\027TV\212\331"
+	.ascii	"\007x'>\221\275\377\370\213\177\336\360l\211_\030\033\317\372"
+	.ascii	"\254\302\356\320U"
+	.text
+	.section	.gnu.lto_.symtab.59eb4210aef36824,"e",@progbits
+	.string	"rxMspFrameReceive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\001"
+	.string	""
+	.string	"rxMspInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.59eb4210aef36824,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
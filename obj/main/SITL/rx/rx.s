@@ -0,0 +1,1725 @@
+	.file	"rx.c"
+	.section	.gnu.lto_.profile.c1bbe239337982d4,"e",@progbits
+	.string	"(\265/\375 \fa"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\020"
+	.string	"1"
+	.string	"4"
+	.text
+	.section	.gnu.lto_.icf.c1bbe239337982d4,"e",@progbits
+	.string	"(\265/\375`\337\002-\022"
+	.string	"T\030\323\003"
+	.string	"D"
+	.string	"\354\256\342\024\004\002"
+	.string	"\002\001\001\321\332\305\303\017\004\002\002\002\003\267\335\335\337\n"
+	.string	"\003\317\253\250\341\002"
+	.string	"\004\330\370\241\354\t"
+	.string	"\005\351\320\257\242\017\022\002\004\002\005\002\006\004\002\007\005\007\006\352\263\360\321\b\007\240\342\234\212\n\b\t\n\243\250\207\351\013\n\002\002\002\b\002\004\002\t\n\002\n\002"
+	.string	"\002"
+	.string	"\013\f\r\016\017\350\373\222\243\013\004\002"
+	.string	"\002\013\020\253\214\322\203\007\b\f\002\r\002\021\022\023\024\025\374\331\202\332\b\b\002"
+	.string	"\002\b\026\330\367\256\304\004\b\002\016\002\016\016\002\016\027\030\210\334\357\256\b \002\017\002\020\031\032\242\302\263\302\013\033\034\035\370\210\311\223\006\016\017\002\017\036\037 !\"\270\276\216\264\016\016"
+	.string	"\002\021"
+	.string	"\002"
+	.string	"#$%&\323\331\354\253"
+	.string	"'(\256\334\323\366\007\004)\264\370\341\227\005*\360\364\377\262\013,\022\002\r\002\023\002\r\024\002\002+-\350\300\306\254\005./\376\340\327\201\004\0040\214\276\367\272\0161\363\372\306\335\007\034\017\002\017\006\002\006234\252\252\341\245\004\b\0235\365\273\261\345\005\025\002\026\002\0266\202\245\236\333\0067\343\314\215\234\002\030\002\025\002\025"
+	.string	"\002"
+	.string	"\002\002\0258\274\201\267\213\007\004"
+	.string	"\002"
+	.string	"9\223\335\346z\002:\323\343\357\213\016\006;\312\267\354h<\347\273\234\355\f=\317\356\361\267\004\r>\361\246\255\314\006?@\312\274\242\261\005AB\213\241\232\352\bCD\240\342\234\212\n"
+	.ascii	"g\250\021E\242\220\251\224\264$Y\306`\002b\310\246<\020HK\210"
+	.ascii	"(\303\030\300A\331\263\305\364\241\305\001\342\r\370\231\221"
+	.ascii	"\275\300\b\017\330\336\236Y\274V\202Y0\346\276\214\377?\234\320"
+	.ascii	"\247\244\025\360\243\222pG\235\374\264 \371\233\2172\251\216"
+	.ascii	"rc\267H\001v\001\357y\304W\363Z\267U0\022hd\250P!p5W\202\b\347"
+	.ascii	"!\225\324!w\177\360\254\265\306gt\363}\037\t\357\251\220$\037"
+	.ascii	"\253\367\252\357\240E9:Ogv\244\263\362\240\351\260\003\236\374"
+	.ascii	"\004Tt\354vk\241g[\"|\260\016\377C\336\205\220h:pny/\247\310"
+	.ascii	"\020K;h;\240\321\340\320\246p\330\265\317\225\261\200\t"
+	.text
+	.section	.gnu.lto_.ipa_sra.c1bbe239337982d4,"e",@progbits
+	.string	"(\265/\375`U"
+	.string	"M\005"
+	.string	"R\307\024\032`o\241\0030\f\3030\024\026\177^i\275A\np\376\343<\033\ri[\246\024\226\227\322R\231\362\023\311\332d\376\210\203\350\254\037Z\216\006\243\\\224\212\304#\016j\270\260\017\\0\013\240\345\244\264w\312\321\267\247\013l\321B5\247\251\253\036%\267\227\340\230( p\202Qw\016\364\0024n\311`X\003k\2260\033\204h\315\334\267E\226\305"
+	.ascii	"\241%k\267dd\001\252\235\304\214:vf\361\f/\354\220\301\356\245"
+	.ascii	"?_\026\303\370\210\333J\234\230\202\300\315\375\305\321\301C"
+	.ascii	"WW\b\226\203-F\013E\030\f_\\\314!"
+	.text
+	.section	.gnu.lto_.inline.c1bbe239337982d4,"e",@progbits
+	.string	"(\265/\375`\245\005\255\027"
+	.string	"F`sH\300\324M\032\003@\3242\032\377(\235u\357Fmf\310G\275\206\013\303\266G\3433\004\225\003\376\3638u;0\3577\005\251fX\3332P\277\253x\201\020 L\022\242\355\234\275\236\365\3344\217\036?B\233\t\222\266\245\334)W"
+	.string	"Z"
+	.string	"_"
+	.ascii	"7\\\007\210\321\337\232\006\3159[n\375\313i\252c\347\310\350"
+	.ascii	"\243\321\023<OS2\373\017\320\030\377\227\306\365H\243S6(\026"
+	.ascii	"\007f\311-1\3474\361\273\332\350\221\237\036[\213\215\342~zl"
+	.ascii	"(G]e:\347\234\335\3276*\fq)\372\261\266a\030\342Z\017s\307\023"
+	.ascii	"/\025\361/\211\020qC\367\322\021\263\2164e\322\361A\202\355\362"
+	.ascii	"\337\312\326Sp\316\331Z\300+\035\212\254Yp\306\022\022\330\215"
+	.ascii	"\366\030]\305\200\355:\006\262\226\3572\221\036\344\022\006f"
+	.ascii	"\225\256U\272V\331a\225\344\b\301\270\267Lz\357\332_4\302t&\302"
+	.ascii	"\024gy\244\355\255*)V\337&\205\241\025\200\025\314 \027\t\326"
+	.ascii	"\033\301O[\2459g\001U9\346\203*MA\031\270\034\330\376\0044\036"
+	.ascii	"\2175\355\361\324\"\212e\003\337\212\307\300\370\361[\025+\224"
+	.ascii	"D\310&\333%\036@\202\334\364\353\023\365\226\036\207e\322\361"
+	.ascii	"q\3223,\323["
+	.string	"\216\210\323\n\212\356g\352s\313\025q\2218bc\270\220\263\204\310G\321\267\205\224\327\017 \"\252\357\n\307\300\035\024\224fj\362\204c\340l\245\224$l\r[\220\020\223\257\321\027+l\f\275T\r\211jb9B\f\234\255\324\234s\305\006\265s\3242\004\025\326\317m\350J\203N\005\265\2034\363\203U\202\016b\267E\r\030\354\202\023\325\233\245\221c$\207\003B\237R\344`\314\264\fP\030\006\200\210\250!E\207D\246FFJ\222\024:`\002\031\261\261\363\022\240\204Q$\235\200H\025\310M\005\005e\325\035\216\217\b\360\016\211\300\343\f\t\324\277Eo\351\337:<\210\362\350\271\254\371\264L\304P\306\376\fX\330Z\351i\270\013\033\201\260(M\230\203\303\rB\355\024\371\216\270\253\332\243\352\013\036\212B\013\373\027\314Q\200O\325\267z-Fp\204\334\326M\255\021R\353u\351\250\031Z\351\206\020\270\275\2008;"
+	.string	"\265\225\313\213m\023\342}\240\225WjE\212\203\206\250M\"\276\262\245\315\200\022\005\331\252\232W/*\370\276A\334\237\017e\307\037\270\347\207\345\241:!\202\216\334\233\n\021\372P\362Z\300L\335D\331\330\026~\270\346\032Y@\206H]\263\221-\276+//o\024\223\211H\220\005\013\3158\220h\304\003\205l\314\004\016+(\311\217\034\353\321\313\017F\306\373[\024\246\235\343f\344\002\330\033a\\\355f`j\261U7\3546\345\tE\245~\363\222m#\377U\034\207mn\306\036\274K\244\375\020>l\250\002"
+	.ascii	"\017"
+	.text
+	.section	.gnu.lto_.jmpfuncs.c1bbe239337982d4,"e",@progbits
+	.string	"(\265/\375`T\002\325\f"
+	.string	"6\223>7@M\223t\303\260\203\007\353\233\362\350\265\237\3569\212\242(\206\035{\204\240\260*\242\204\317\rU\314\374\326L\317\257\263\316\370\257\255\266\261M\332\353\t5\306o\210\020)S*"
+	.string	"-"
+	.string	"1"
+	.string	",\301S8\fX\256\326\310\252\311*\376\307\036\001\275"
+	.string	"\364\317\243\027\365 \262\026\021&\255\250G\372d\273\310\336\"\237~~m\b\224\234)9\245\244\037\0359\236\250\211\342i\234\366\033\323\315F\023d\206\345!$]\354xq\310\213S.\242\354\007@\033h3\343\202q\321\226\351j\240CZ\371\207\240\002\305\212\007\357\340\033\374\244aIQ\244\250I\027\373\005T\360'8\242<&\017\221*L\205Y\355\004Y\221=\017/C [$D\250x\370\320\201C\200_\303gx\022Ct\341\263@\351=*\374\365z$"
+	.string	"\214 \202\305\032\024nG\035\210\003]\254\321sL\030j\255\265B\312\222\001E\250\321\244fJ\321LMA\345\001@B\246\f\353\001\021\200P\213\220\225\020\223T\212\325\241\004\237\024c\226\312\005\330:\234\225aW\007O*w\345@\224\367\221"
+	.string	"k\355\270\021#\345J@\273\242\312\207:\322\231(\334\225y\3466Cn\307&f\313e\302\362t\300J\277%\332d"
+	.ascii	"\027J\036\0374\205\035\005X\266\242\345\335\026\231\245\220;"
+	.ascii	"\273\374Y\313\303PI\210\032\353\353:a\270\3025E\220p2\314U\347"
+	.ascii	"`\334;6L\343\031\274\371\016Z\223M6\271T\342\257T\272S\225\323"
+	.ascii	"\356\t"
+	.text
+	.section	.gnu.lto_.pureconst.c1bbe239337982d4,"e",@progbits
+	.string	"(\265/\375 e\215\002"
+	.string	"RF\023\031\200/4\006\017\230\242\201yd\002=n0\304\205`\013\365KvZ\267H\006\232G\3538\3077\256\361\214\207\361.n\361\212S|\242I\264\210\t\342=\334\341\rg\270\302\023&\204\037\334`*8\301\007\"E\002Q\300\003x\265\250\252O"
+	.text
+	.section	.gnu.lto_.ipa_modref.c1bbe239337982d4,"e",@progbits
+	.string	"(\265/\375`'\002\255\n"
+	.ascii	"r\317++\2209\313\001\217W\352\237y\355{\276R\343\273\210(\366"
+	.ascii	"\003\214\260\307\242&B\233\354b\023\021`W\2425L\240A\276\330"
+	.ascii	"\204\354$SR\016\020\226\303M\203z\324\307\240\013\252\302,<\201"
+	.ascii	"\222\276\244}\234;\035E\177$\216\300\240pF\321&\234\017\375\342"
+	.ascii	"\013+\004\215~\242j\236;\353pt\316sC\335\360\314\205\261V\271"
+	.ascii	"\315N\363\324X&\225Q\"\317\310\253\204zf\n\334\365\274\206\006"
+	.ascii	"\264z\020K\242$\335&\301\023\343\203\013L;\311S\262\265\253\206"
+	.ascii	"\002\364`wy^v\226geH\200\214\035\215A\352?eN\317\311\253\230"
+	.ascii	"\006>\024\202\004P\250\321X\005\225\2154\225\302\030P\002A\320"
+	.ascii	"U7\021\200!$inZ\220V\003\200e@Z)\221%w\345} O\203\372\203!\355"
+	.ascii	"\304\177\201\210\323om(%\211.\273\306\002\024\233\377[Q\n\332"
+	.ascii	"B\244\337x\215Y]\344\243\002\312-K\360\363\365C\354\3445cE\274"
+	.ascii	"@Q\001O\311zk\346\337\232\323\2334\354\b\232S6\315J\034\207_"
+	.ascii	"\020\325\200\317\301\210|E\016\206Ym-\016\351G\032\337\\M\355"
+	.ascii	"u\204\217T\n\361\302\f\bz\327;n\307UD\231\223\247&\212\244\n"
+	.ascii	"S;\360\370%\315\2243"
+	.text
+	.section	.gnu.lto_.lto.c1bbe239337982d4,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_rxConfig_Registry.74.c1bbe239337982d4,"e",@progbits
+	.string	"(\265/\375 \217\r\004"
+	.string	"4\007b"
+	.string	""
+	.string	""
+	.string	"!"
+	.string	"\005\001\212\001\202\200\200\374\342\303\377\241\035\006\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\375\005us\327\005uq"
+	.string	"\005\001\006'\001,\230\300"
+	.string	"?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\023./src/main/rx/rx.c"
+	.string	"\004"
+	.ascii	")\302\303,:E\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_rxConfig.75.c1bbe239337982d4,"e",@progbits
+	.string	"(\265/\375`\264\001\335\f"
+	.string	"&\226TE\360pL:x\354\244\244:\232\342\n<\277\257\026\262\221\2776\260\2707\037\024F\225\246\021\207\213\0328\271\313\037`\304\311,@\"\330\232b\220a\322I0\3168\235\243m\312\261lz\335n\233\257 \032\362\367N):"
+	.string	"@"
+	.string	"E"
+	.string	"\373\242\325vO\024\223\200\367|\036\344\273\007>\363\335si\327\370\t\333\3176h\230\351v7\254\"^\236\226\376M\334b\272V\247\035\004v\327\324tu\270\353m\227\330\366\3304A7R k\200\177\342B\212\342F\370\252\357\036\307\003\fD,\307\242;\373\\\321\032\302~ew\327\365e_\366S\314gu6LX\354r\330\345\330\233\327\202\304\305\366\251\375\022\217\225\227\251\376\261\001\367l\007\017\350M3\270\351r\031\352\312\037\35020(B\217\361\341\020\335F\216\214\016\003\225!\375\005\215p\027(\017\032\245\327\300\017\342i\344\305\366\315gO\370\n\222S\341*~\221\317\266\360\024(\013\270\247\301\005\366\004"
+	.string	"\220\242`\301\201\002\226\021\t\202I4p\032A\207:\2471<\215\241\211\004*\205\241\221\f;\031\213\022DcHA\024\307\360r\356+[_F\340\272\261*\006k(\255??\343\023\202\333m\335l"
+	.string	"\266N6\001\036"
+	.string	"2\241oi`\300\005\004\327"
+	.string	""
+	.string	"\003a"
+	.string	"\300*#\020\324[\004\201@\275@\030"
+	.string	"we\004\002*\006\302"
+	.string	""
+	.ascii	"\027\025\210\021j\007\225\001\301\021\005R\236\374\206\332\024"
+	.ascii	"2\366\032\f\271\004\333\254\246\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_rxChannelRangeConfigs_Registry.79.c1bbe239337982d4,"e",@progbits
+	.string	"(\265/\375 \215\375\003"
+	.string	"\024\007`"
+	.string	""
+	.string	""
+	.string	"!"
+	.string	"\005\001\212\001\202\200\200\374\342\203\345\322\027\031\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\325\030us\336\007uq"
+	.string	"\005\001\006'\001\020,?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\023./src/main/rx/rx.c"
+	.string	"\004"
+	.ascii	")\302\303,:E\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_rxChannelRangeConfigs.80.c1bbe239337982d4,"e",@progbits
+	.string	"(\265/\375`}\001\205\017"
+	.string	"\206]iG\340\260*\035\263\037+\207\224:\261\0164\030\017\340\254;\b\226\221d\225\224\030CCk\030\330\356\004\241lo\374jz\256\345\261\231\025\314\205:\214A\020CV@\017\370\031\016M\017\b\b\237\217\362F!\226\354-wJ\001S"
+	.string	"Q"
+	.string	"W"
+	.string	"\336=\272O\237\354\032\017a\373\232-\245\206cw?\005ay\031\3362\236>\245\306\223\017s\220\020.X-\324\247\004\200s\361\020\240\245A*p\311\340N{Ti\251\242lY\271\236v\004\261\033Vk\345\261\343`w\035Y\255\016ww\333\240\355\006\366U\004\236\313\376\316g\267|\264\306\350\030\243\377\371\274\304\020\231\261\273!\207\2634\263\205\210\317n?\364i(\236\342\364\231g<\024\007/\246\306\302\306\356\206|\232\201\367Y@\376c\373\321\276\211\2378]\206\362\001\273\257\234\333n\230\300 \336\247\303\177t\237\001\261\233\325\007\001\267\322m\0352h\224\350\324\374\244\263-|\305\211\201\232\335]\340\307\230.\020\200\305>}\224\356\363"
+	.string	"\354F*\346\034\265\243\252_\275\3340\272k\324\257F\250b\316R\257\247]\342\304r)9\251\230Su\311\340ZTY\354\020\025\365\205sq\335\254/;\242\227LD\020F$\222\220\311\b\364@Bh4\002E 1\201\037.\0311\201\237\t\374F\"\320\204\257\004,}#\036&Q\b\201_\005\022\t\374>\341^_>\314=\033\t\232\224\252\246\262\270\363B=\25261\344RUl\317tR/\233\331d\2109.ww\245E.\325\243\030\002\035"
+	.ascii	"3\003\3769\204i@\272\266,b,\201\225\221Y\242\203a\320\216\245"
+	.ascii	"\236\360\264GDka\314\024\0023P\227q_\205TKh]\354U\021\250*\034"
+	.ascii	"\334Y\325X\263\022\035\334\213\033\"\312^\250j\274\237D:\327"
+	.ascii	"|\002"
+	.text
+	.section	.gnu.lto_rxFailsafeChannelConfigs_Registry.84.c1bbe239337982d4,"e",@progbits
+	.string	"(\265/\375 \215\005\004"
+	.string	"$\007`"
+	.string	""
+	.string	""
+	.string	"!"
+	.string	"\005\001\212\001\202\200\200\374\342\203\356\222\021\032\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\366\030us\350\375\007uq"
+	.string	"\005\001\006'\001$+?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\023./src/main/rx/rx.c"
+	.string	"\004"
+	.ascii	")\"\301$:E\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_rxFailsafeChannelConfigs.85.c1bbe239337982d4,"e",@progbits
+	.string	"(\265/\375`\366\001M\022"
+	.string	"&\243|H\300\322Q:r\020\331o\377(BA\315\021P.\234\206\267C\201\221\375\257\272\226D\247M\302;!:\035\340kz\332?C\tY\030=\261\f\005GQ\024\245\\[o\236\302\f\310mh\013\266 \251V\300F\366\336R\246\024h"
+	.string	"b"
+	.string	"j"
+	.string	"\027\221\217\236\3318\276\353\231'B\272\021A\3159Y\313c\001\207\273[\352\354\237\214pu\346\013\275\344\307\t\227\233\371\007\367g\207\315*w\203)2lx|\350Z\223\253\251\004!\201\363\330\341\020.\200\361\301\307*g\203\253\021I5U\016\203\356\207\236\300\247\207\313\341\\?\007sN+.\307\341N\335\366\215\355\024[I\002Z\340)G\311\273c\207<\350\007\211\352\357\274[Bu\274\032\256zW\255\252\376JE\243\306\311\323\234\033z=\246R\234!\342\274\333\337\371C*\276bv\236\215R37\251\"\242\244\034sN\223G7H=\032\200W\331\276\332\007z\212\331\203dF\002L\033\317&\306\234\273\023\227\244\036\275\373"
+	.string	"\371\230\n\027|z4:\337\332\260\267"
+	.string	"\220C\323\036\214\253S(\r(\234\340\356<\360\300\303\273a\323(\307\265)\234\005\f\202\2369'\003\277\310\202\354"
+	.ascii	"S\210G_F>F#\234\216o\\\002K\273 \013\3674&\364>\222\272\273\247"
+	.ascii	")!W\027\276\270\375\240i\317'\227\373\375\320WN\374\024\335\200"
+	.ascii	"j\332\333\245\f6@\354\352\354]-\256\313 \270\\^0\225\227\226"
+	.ascii	"\327\253\025A\245\305\245%{q\265Vbb#fA\211\211\261bb\254\227"
+	.ascii	"\253%\201\305\022\223\261PD\f\233\320\022cU\200\301b,\325\216"
+	.ascii	"\366\335\021z\312\305\221\022mk\337\352\3745\305\220\335&5\271"
+	.ascii	"\334\032\033I\271,\234\036\257\311\246Q\n\347\234S\256\316\n"
+	.ascii	"I\016#\225\tIg\343a\344\2675\266\202\313\r\331\" @\002\204\030"
+	.ascii	"\026\017a`\357\035\232\033'\313\312\342\276Q\0205\312\244\301"
+	.ascii	"\206\360\013\350kLz\f-\370\252\235\265\335\377Va\343\231ZRh\016"
+	.ascii	"\250%\344Vw,l\320\315n\fPen;\233\260f?\035\3552XDv@\364\220\365"
+	.ascii	"}#\353v.C\006"
+	.text
+	.section	.gnu.lto_resetAllRxChannelRangeConfigurations.86.c1bbe239337982d4,"e",@progbits
+	.string	"(\265/\375`r\001U\017"
+	.string	"\306\334gF\340\262(\035$\202f)\270\372\360\301"
+	.string	"O\357\253\025jR\317\255\224\360\035\021F\371\234Q\350C\005dn\024\213\3654\325HD\256\005l(\260\2049N\214\347:r\013\025|\007\034\036\3022NLW\022K\366\226;\245Q"
+	.string	"P"
+	.string	"U"
+	.string	"\333\247M\366\215\203'\3661\034 b;v\327S\023\226\227\340-\243\351Sj4\3713\027q\351H\255N\2372\300,\246\204\200\325\007\351\200e3;\354Q\265BE\371\302r=\354\013\\2R+\226G\217\204\335uL\255F\334\333m\177\266#\330\227\t\177\375\362\341\035\377\272\017\340$|\204+>\265\335\020\265\037\2333g\270\036\336>\350\303Z\334\205\351\241o\270\223\b\216&\306#\307\356\216|\032\002\367\231@\036\304\366\243}\231\2630\375\205r\200\300\252\204*\331.\330\300\"\334\247\301\033\330>\271\207\004\261\307\345\356\2564\203G\355\324\253Yi9\370+\247^\215\225\024\250X\363"
+	.string	"\331\206\303\350`h;\354\321\371\311fs8\315\t\267\273\017\374\027\036: \320A\361\351\243l\237\207]\001\fM\305NJ\254\251\262lf/\252.6x\212\332\232\305\260d\326\226\335q\001\242\233\210(\214H$!\223\021h\202\205\320h\004\252@R\372\n\270\344S\372\274\322\347\215D\240\013^\311\227\301\373\204\230\204!\364y\032H\244\317\003\001\367\332\2329WC\313IQ\324T\027{hh\247%\234\2268\362\250\252\303\336\355\340\304PN-\243\324\253\3127[\324\277B\033*\001\035"
+	.ascii	"2\003\376\031\343\206\306\341\364\367s\267\346C\024\203\t_f,"
+	.ascii	"p\r\245\2100\225\307\215\265\027\346\242.\350\2762\tLT\246=\235"
+	.ascii	"\331U\006\250\312\034\264\263JX\263:\035\264\213\303\"\312^\250"
+	.ascii	"j\274\237D:\327|\002"
+	.text
+	.section	.gnu.lto_nullReadRawRC.87.c1bbe239337982d4,"e",@progbits
+	.string	"(\265/\375`("
+	.string	"\375\007"
+	.string	"2\01788@o\323\001X\240\341$ \007\376%\260\006j\021\302 \027\202\361\365\214\017\340\321k$\263\260\267H\350\223h\024\216'\253\224\004\343\244%S\242\3267|\t\335\254\233\020\231R\022[\327\205\"4\r\004\367\320y\r\233\210\033u\025\016\237\024\260\366\371d\374d\354\270\220(j\222\"~<\366&6\031G\236'#g\356\303\254"
+	.string	"\303*\331\223\244\326\207\375kw\327\026\312\326"
+	.string	"\217\027\205\225\335\215\031\231u\301ZDl\2036\307\366\2456(\001<\212\305;[\202\t\001\251\3327\371\t\370y\361\201]\324\212ew\"\330`s\314sc\333\0379\t\350P'\b\007@J#Ce\265;c\347\004\3311\275';f\245\036^C\377)\277T\252\030\323\211t\3250\354\256\325t\352\270\255\333>\260\275`\273$\013"
+	.ascii	"2\003\202\341\243\302^\025\320\\\363zLh0W\240\302\301]#\325\212"
+	.ascii	"I\230d"
+	.text
+	.section	.gnu.lto_nullFrameStatus.88.c1bbe239337982d4,"e",@progbits
+	.string	"(\265/\375 \367\355\006"
+	.string	"\242M26@o\222\016\230\016\230r\344\2276\345&\231\300.\356\314\374\002f\232@\224\375\315\201\371\026%vN\324\3678\217\361Ad\263\030(\222$?m\250\204_w\263\215\310\024\023\230D\246=\200B\230(\263\200\030\301\201?\236\021|#\3702,\"\364>\260\342y:k\024 \370D\232\006\037'f\267\313"
+	.string	"\243\312\370Xr\225\307W\223\231y\325\361N\200\304\245A%\0235#\223-\026K\310\337\237\364\234\337\271oIMH=\271(Af\007\314JfL\370`S\353\330\202\253\326\246\235\253\326\377\002\003\351\255\021\004\025`\3420\245\304d\306W}t\253\333nQ\252\021\031y9\245Ju"
+	.string	"\016\231\271;\2454z\325\037\341W\3707\002\006"
+	.ascii	"2\003\202\341\243\302^\025\360v\031c\272&\031"
+	.text
+	.section	.gnu.lto_nullProcessFrame.89.c1bbe239337982d4,"e",@progbits
+	.string	"(\265/\375 \371\375\006"
+	.string	"\002\01636@o\222\016\230\276\244\246/"
+	.string	"\360\311\235\020\354\031_,\324\3743s\311(\372\233\003\343\267\b\321\361v\330\321\n\244\257\303!\006\263\261\253\004n\323~\326\3264!2\005\023 \t\021\366\360\t\201F\"\022D\t\n\354\351\224\340+\301'\002E\204\236\007V\274\016g\214\342\003\337\b\303\340;f\335\352fW\301\205\303\370xj\256\343\013\220\231\271[}#\305\030\230\206\223\314\324\214L\262X* \177\177\323\007\374\255}E:b*\211E\0072W/)\2311a\203M\255c\t\256Z\233r\256Z\377\013\f\246\263\306\217\224\006\305\2012\211\311\214\317y4k\313nKz\020\262\322\342\202\242:\265i\0342\363\226\241\322\350\256?\302\257\360o\004\005"
+	.ascii	"T\b\203\347\220\254\202\343.s^\327$\003"
+	.text
+	.section	.gnu.lto_rxInit.91.c1bbe239337982d4,"e",@progbits
+	.string	"(\265/\375`y\013\3559"
+	.string	"\032d\360\025@P\244N\007\013\262\222\263\246\342|\217m\302\241\327\351\bN\023\271\254\370\022\231\375\245\331"
+	.string	"C\242\233ej\330_<\336\020"
+	.ascii	"E\220\002\240\262'\025\262\354\3330$\252\021Uf{\251\t\331{\247"
+	.ascii	"\224RO\001:\001L\001v\335e\272\235iZ\217\331<*nj\356\275\016"
+	.ascii	"\210\020$\264\215\247\025\305\345\274b\354Y\0355L\301{\235\f"
+	.ascii	"\210u\334wg\032M\333v>\210W\r1\314\256\017\340\275N\004\304V"
+	.ascii	"\221\374G\327\361\003\272\3008\346\246cf\237\314\266\212t\275"
+	.ascii	"\332\356l\341fr\223a\226\273\331sm;\371M\224\227\363\222Y\300"
+	.ascii	"\003dJ\265\312\007\210\255F5\323\332j\332Kk\253\034\244\231,"
+	.ascii	"\345\346\007\215y\357eU\266e\376\323N\266\333vMe\235\340\275"
+	.ascii	"\227\352\327\220H$\022+u\352lN\277m&\344\222R\022\322\221Q\321"
+	.ascii	"\2215\026\211\303UM\337[\356a\206$\177O\350\035\031W3ai$\026"
+	.ascii	"7_\272\322J)\003\3005\205\232o\354J\312$\226e\331c\254xR\372"
+	.ascii	"_\202g\3157\326\226Z\030T\346\351g\023G\252R\306\326GP\332\250"
+	.ascii	"\b\255\217O\356\316\234\3452\346\304\215|cP\322(\2726\300e\314"
+	.ascii	"\314\213\317^p\347mJ\031[\023\r\f\207\031\246\2241\351\325\210"
+	.ascii	"L\231F\215\001s5\375,\203\210\030\221}\245\026\326\020\t\f#\353"
+	.ascii	"\362"
+	.string	"\364\rI\177\223iw\003\355\202\336\221!i\037f\270\367\262/\311\312\232\233\232\271\327\230\231\005\263\221Fw\002\267_\367i\265\274\265ppu\226\202\372\375[Y\230\364\250\227\356k\301\020\357\365\252\342\336\323\3206L;\246\225k\345\326V\373\233L+\b\204\036j\376\227A?\276\347\265H\224n\347Vn\276\306\323\316i\340\300amuH\267'.\260\265Vn;}G\213\333\215=|\370\260\266\252v\321#\030\b\"D\003\266\021=\207\204\2343\2748%L(@\321qR\300i3<\275\245\212\025\t\372\356M\366\222\231E\267i\321\304v\357\255\342^\323l\\p\273\265\312VW\336\313V\271\257\326V\213H\362tA\357\224$=\312\354\354\362Wcn'-d\366\370\323\2301T\2400\201u\256j\274f\t\235\327\034\341\350<utvpt\216j\273\346\002]\246\031\252\235\315\004\214\316\003Xg\001\254s"
+	.ascii	"\243\363\223\321\331\211\350\f`unb\235\231Xg\244\321yIuVR\235"
+	.ascii	"\223Xg$\326\371Hu6R\235\213X\347#\353\314\032\235\215F\347b\321"
+	.ascii	"\231\250:\017U\347\225\350\254\016\235\323\241\363\257\316\256"
+	.ascii	":w\206)?hgms\017u^\261h\242\273\247\262\321\322x\335y\335\001"
+	.ascii	"G\321\"\257\366\261\032=\205wB0\264\247\366\261\026\275\3217"
+	.ascii	"\030\227\343\027\375\023R\026N5\373\307\177\",>\373+\223<@\312"
+	.ascii	"B\013\203\312<\307\257\265\370}\327\316\266\006\367\364\343C"
+	.ascii	"\201bhX\343\027\377\233O:^>\310\345bF\332!\252\223\"D\214\357"
+	.ascii	"i\3704\273|\331~q\253\364!\355\220g\252B\224\337v\272\007\365"
+	.ascii	"A\0313\266EV\342g=\371x\371`\230{\265ED\254\245\2411\333\f\363"
+	.ascii	"\006\357j\305\212Z\304\322\372\230\255\262sy\262%;\322&Y\262"
+	.ascii	"\266J\374\246\353\005t\201P5M)\305Wc\037:x\325o\235\372\250\017"
+	.ascii	"c\216\232\352\250\214\242\302\"\223\244GS\342\360\035"
+	.string	"4\351D\210\206\337z\303\237z'tHp\375\013m\307%{\200\353\2531\326\252~\213a\b\036u\271}\322B\361^\252\337c\272\317\332\200\331\363z.\365\325x\350\367\030\376\375\\\252\t|\030\277Y\t|7\237~^>\330zV\334\312\244\r\232\300cx x\206RA\355\034\024\033`\007j\245Pi\325\324\352\334\255\333\265\365?}\265\016\030Z\227GY\312\231\333+-\026\357\345\177\202#o{]\317\305\376\314\334\241\375\3108\352\2737<c\306T\216+\030X6ZXeQY\305xr\321\302_\264\360\253\0355\\\360Pi4[M\365\310\242\352\221Eu\203\206\013\033TVY9\250\246\226\030\013\307U\026\225\016,\254,*\326\231\354O\343\024`\366\222\337\305\003\236\333\216\177\321\352\363\241\352\007(\351\211\360\002\276\352\033,P\302\013\370\nu\177\336E\313\t\373\340$\274C\333\232\311%\035\340#|"
+	.ascii	"=\037\340\033\220\277my\372\326\3534L\335_\030\246W\353\255@"
+	.ascii	"+\273\233c\331\n\2645h\213\320\026\241:\250` r\254\235\376\205"
+	.ascii	"!\267\322~\021\333\234^*K\034\232\\s\351h\346\364*\305\257\274"
+	.ascii	"\270\300\244G\231\2037\323\323\2560\270\371A[\343T\344\\J+\327"
+	.ascii	"\005\330\300y\2321{\217G\331B\264E\350\275\344#\0340{_\317E\374"
+	.ascii	"\212\223\242\364j\205\032\300\277\350\013\200\250\007.\312!\300"
+	.ascii	"\244\243\n\377~D\251\206BB\245\367\336\213\004\365\025\276"
+	.string	"\237\235&J\023\365\243W\343~R\250h\302\267\334\023;G\n_\240\351\204\233\311`\362&\275\024T\340\233\336\351\215\2620\211|\246\037\376-=\362{+\352J\332\257\025k}I\220,=\333\2050L3\351Q#/k\245\237\340d\235\364JH\237\324\240\217\036\351\237\376\214\037\200\334\250a0\004\025TdhF$\214&\2254\006\220\002\231\241\"v\021 %u\016\315\214&\315\001_\225\177\331\276\320\214:\223B@\2363\200\210\236w\336\260h\"3\034\2211\314;C\354\345\faK\"\334\351\304\371\325\341\002\261\037\005\326yj\263\212~\004\031`\025\306Zt\2352\020V\353G4_\020\341\2175^\f\317%Gh\214\030\367f\301\264\243|\2166\305\221\240f'o\002\340\305\222<\272p\275JB\304\"G(+M M\200\320B\204t[\335E\354\036_\353a`\035W\244\34334oE\2568\026O"
+	.string	"H%\200\022E}<\217J\036&\020|\200\221\ff>\214\037\215BM\367\274p\312\310v\005\003\251\343:\0033H0ye\357\274TP\222\375M\331\027\223\352=\017PB\377\365\360t\031}\265\"d\222\224R\244\235\372q\202\243\213\302\270<\236RO|\r\340\233\247Hp\b.\312\177\311!\322~\214+b\324\223\357\202\234qW\007\302lB\364oh\364/$\356\225N\251\240\373\3026}\364\260\177-\326^\244u@\351+\003\371Ae\226&8Q\300{\376q\373pT;\031\322\030O\210\277\221\2652\205\007=H\330\262C\310=\257\372\277\263\243"
+	.string	"\274\260\023S\025\035^Ot3\005\231\r\305\353\313\342\244\376u"
+	.ascii	"\003\177N\376Lm,\224\211\225x\214\233V\034\270}\007\210y8\210"
+	.ascii	"\245\013\270\204\341F\020\317j\254\341\fp\230Ttrf\355\035\216"
+	.ascii	"\372!\212e\324\377Yp>\025\227A\\[\374Y\320\334\367\030\276\375"
+	.ascii	"\307\350\332c\246\255l\272\033\032d\311\213\243T"
+	.text
+	.section	.gnu.lto_rxIsReceivingSignal.92.c1bbe239337982d4,"e",@progbits
+	.string	"(\265/\375 \336-\006"
+	.string	"\202\313*2Pm\222\016\244\004\252\212\224\312H\366\005\030"
+	.string	" \226\361\346*{Kv\325\376\335\316\356\b@\205\032\217\233\231ic\250\200\025\222\2008xj\214\326\366\226)c.\231\3062\215A80<0L\223`\227\201\247\210\206\306&\246\2511\213\225E\320aA\007+\276\"\035\241\256\307\024\232kU\351j"
+	.string	"*\035\ndt\356z\213s\250\361\215\022A\377}HP\202\262\220\222\351\271V\362D2\371\3707o\031!a3U\213\303\323\216\220\005\211J\246\305p\243T\217\272\ri\004\022\272\252\017\247\027\240\220\231_\365\301\350\330\377\3407\370/\002\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_rxAreFlightChannelsValid.93.c1bbe239337982d4,"e",@progbits
+	.string	"(\265/\375 \3365\006"
+	.string	"\202\013+3@o\222\016\230\016$|\212\361X\340\212\346Z\354\237C6\276?o\022\361\267\233= 4B\002\021\273n\031\006\204\0173\024\334\3501|\333\230mmo\231\002k2\233\3066\215=4,80M\213`\031\201)\b\206\306$(\2521\314\225E\321!\301\007)\276!\025\251n\307\023\234\253\325\351r.\235\016\0030>7\372\313s\230\361\225\022E\377}8P\222\242p\222\t\032\265$\312D\342\361w\036\363\001B\347\252\327\006\250\034+\025#,\231\027C\215V\275\352\026\244\322\207\211\212\025\362\364"
+	.string	"\0222\363\263B\027\035\373\033\374\005\277E\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_suspendRxSignal.94.c1bbe239337982d4,"e",@progbits
+	.string	"(\265/\375`F"
+	.string	"\245\b"
+	.string	"V\220;6@S\323\001`Xo\n\033O\303\013K!\036f\375AZ%jR\317|\353@d\211\236I,\342(8\254\255'OQ\f\346k\242\225Pb\256\352q\210\020)S\n)"
+	.string	","
+	.string	"-"
+	.string	"\276\307\234-s\360c\2772\203\201b\332\335\250\036\347\236\234\177\222\013|\244\356\t\220\260\273\316\217\244q\353m#\330>\260}\023\027\034^\236L\245MQ\221\377\256\006\0335\241\247\235\rv\251\035\366\251\325\222\375t>\375\200\002\023\314\202\312n\306Ig\303\212%\304\016\3329\177Y\276\311O.\007\f\263^U\";#6\251~\311\301\314\007q\304V\371\233\365J[>\232Q\236\354\227\224\360\023\3265\225\212\t\006}DZ\024i\361\341b\300\"H\333\342\207\300\031DH\213\022Y\246E\017\270\247VK\n9\341H=\017df\331\241\206\374\347t\301\t-\002\r"
+	.ascii	"3\241\365\037\370iw\370B;\260pQ~\020\265\n\237Z\320\205\034a"
+	.ascii	"\260\3772.\270t\213v>\001"
+	.text
+	.section	.gnu.lto_resumeRxSignal.95.c1bbe239337982d4,"e",@progbits
+	.string	"(\265/\375`("
+	.string	"\255\007"
+	.string	"r\01645Po\322\001#\032\027Q#\017\b\004\r\006\370A\247\300\342\227\n\001^\021\226mD0\374\255\333gY\263qO!3\313\250j/G\020}a_Y\262\211\224)\005\346lD\361\211\342k\350(|\036'\202\336F\300\320a!>\b\b\343\323h{j\265\204\200\261\215\224\344\200\264\031:y\314\271b\221\367T\376\310I<\037\b\253;\367Qbz\271\372!\027y\360;\f\n9?T\335i\n\3462\312\223\251\264#$\362\330\225 #\333Hz\331\332\225\252a\237Z-\331O?3p\301\222p\332\2458\301\354\346P<l_c\313n\271\306\261?\211\23101\355\356\323\215[O\313?\310\001\260\354zf\016v\327\211e\025\267\336\266\201\355\002\333*\001\r"
+	.ascii	"3\241\271\037X\314\216m\241\021X\270(?\210ZU\236\353\271\220"
+	.ascii	"\323\005\353/\343\202K\267h\347\023"
+	.text
+	.section	.gnu.lto_rxUpdateCheck.96.c1bbe239337982d4,"e",@progbits
+	.string	"(\265/\375`h\005\315\037"
+	.string	"\346\366\301J\220\330Q:\200\243QJ@\373`$7\341\364\3438K\241C\240x\300%\206\1777\007\271\256\177,\270\235\330\327\333\253CF\031\244@\331O\022\022K\326N"
+	.string	"@\r"
+	.string	"Q\001\2555\243\200\324\252U;\022\355Y\373\215\020\"e\222\001\254"
+	.string	"\237"
+	.string	"\263"
+	.ascii	"\273\333H\025bY\265V\006\333`\366s\231w/\365)\242S\255XZ\255"
+	.ascii	"8\244\262jE2X\004\263\237\271\023@\177\232\307\241?ww\035< \332"
+	.ascii	"\340\221<\222\356\303\005\022\023e\255H]\357x\36057[Z\243\315"
+	.ascii	"d\350i6\007\367\262\tg\r1[\304\245\242\327\\X\374\255h{\262\301"
+	.ascii	"\251\323k\246\201\342\225\030\347\242\344d&\340\312\021\366\252"
+	.ascii	"\032L\333\301\001\243\3513.JM;C\224\230XF\343(\322\325\021\237"
+	.ascii	"2n\246KF\3345K,\314\\\255\365U\347\026KCf\331\204Z\3532q\t\306"
+	.ascii	"\027\300wo\356.\211]\223L==\350On\331\021+\t"
+	.string	"\327Z\213\372A\364=\302\n\314\210\317\354\336\311\237\004\367Q\353\363\303'\376\240?\3377E\274\024\247\230\204\274\334E\016\271\215\265\241vg\2749\032\257\316\362\346\240\2748O~mN\365\343h\274\267\345\265-o\212\362\326P^\032\312;\233\361\312\226\027\235\361\236\313k\312x\033\345\375N\204\250\342\223\217\027\375\205\254IK4u\313\251\005\344\311\177W\311\376j\323}r(W\204\254I!\302\232H)\370\271\024n\365%(\256do\216\312\242\024\212\335\364'\357\022\355\246\001\265n:*\213SL\264+_\202\031~\322\031a\220\214\315\332\230\3732s\246\214\326]\270\2365\255\177T\034\362\262\013OC\317\254oG_IP.\2376\203\266\20401$-\263\265l0\231\020\311\b\253\\\326\246)$\3515\374\272\232\302\262?\210Z\351\360C\363\352R\216\241\007\320\363\351\330\343\037Bm\372\354e$\246!/w"
+	.string	"\277\311\267vO~\251Ux\"\225n\233\276\323\r\243.\332]\017\237\362aVk\205\260\327\272\024\020\373\250\237+b\267C\177v\377\352\034v\204*NQ\235m\204\362,\231\027\226r\354f\033\027\327\334?+,X\217\302\353\005[\202\247\347\363\001\352\200\202|\276 \336\215\320\020p\007\334\320\363\355~$\322\035\320D\317B"
+	.string	"\241\016=\237\017\007 P\357\367\033\342\335\226\307\223\342\247K\361\323\001\371\354|:\336OH\307\203\333\240\023\275\237\016\030\024\364\323\245H\341\315\332P\3136\005\347\333\202\337\272\305\356\346tN\330\303\275uN\037\255i\343\376}k([W ck\032\223\220\227lK\233\217V`c\322\3069\302#\025\243CL9\366\203X\344\252\265q\257\002\325\351W]\200\325\221\2522]\262\340\264N\0270\203\224F\310\313\2555\256q\372Kn\032\351B\022\331J\006\001;\230\025\0270\034\003\3723y\250qD\007\221C3\"A\n\222\222\2461\240\002\221!+;\020Pf3\f\322\302\001\302)#\307\037E\317\272\226@\201-\242\223N\240"
+	.string	"\316K#:!\340:\320\247\236\263S\3721.\276\274\231\024g\310\215\325.c%L\331[%\t\270\250y~u\017\255\004\006\330\253\035\316\007\3249\301\245\237\240\347\350(\212\316\230&z\355\322\332b\345w\207\217\347\f\2533\207\322\036\210\234\004]'\332\006\320$\007r>"
+	.ascii	"\337U\017\357\316V\206\326\b\003\215\350\357\337\017\346\007"
+	.ascii	"\233\362\223[pe\203\271\024s\333\227 \250\337'\300\033 \327'"
+	.ascii	"\376\372\351\372\177\272\331H\013\255-J\315J\217\342\022\240"
+	.ascii	"\3108\310uRB!\211\332k\r\241\216\210 \257\2602\034$\327\0056"
+	.ascii	"R\252\t\327:\355`lF\001\276^$\277\252e4\301\206w\005_\224|\353"
+	.ascii	"F\r"
+	.text
+	.section	.gnu.lto_calculateChannelMovingAverage.97.c1bbe239337982d4,"e",@progbits
+	.string	"(\265/\375`X\004\305\034"
+	.string	"\2463\265I\260\230M:\260\352\006\350O\236\357\347\034\344| \207\377\267\260\307/\017\363\b>\r\265S\334\303 R\327E/\023"
+	.string	"\302\362\023\203w\035\332\317\221\257\024>\330\267\3621f\205\302\352o\304q\332\215\213\2064B\b!D\356\224\002\240"
+	.string	"\222"
+	.string	"\244"
+	.ascii	"\246\221\017\351O\"ZSw:\026\006\226\332\f\032\f}\210\220\267"
+	.ascii	"V\337\026%\265\236\nL\200|\370 \217\0322\021=o,\301vdA*\"\246"
+	.ascii	"\326\263V\363\231\370\220>\200\370pmx\017\236\367H\211^\222\243"
+	.ascii	"\030\202K\211\374\242\227\343N\205'\247.3Z\3008\t\326LYj\002"
+	.ascii	"\027\320\244\336\021\035y0]\034w\252~\300\353\212\327cz\370\342"
+	.ascii	" x\300\027\305E\254\267\003gZ4\260\274\307\022\f\272fO\005\250"
+	.ascii	"Sk\375\324)\213\236\216\322q\247\326j\312\353\265\270a\267\r"
+	.ascii	"e\233\202\rF\b\377\2609~`\361\ti2\242_\366YD\367g\3771dh\275"
+	.ascii	"\360\326\260sL\215\363\363\277\371\220\177v\251\333\306\324\262"
+	.ascii	"S\335\261\222\232\246\244\236)\251M\223\032fR\227%5iR\217%\265"
+	.ascii	"\b\243\016Kjp\251"
+	.string	"w\251)I\375\001\017\276\370\234vh\331\255\263*}\221\251Y!\326\323\251~\251\217T\244!\r\355\333'\342W\331t\221\033\031:\225\235\350\354\316\332{\340UU!\220\017u\300\333C\376\224M\333R(t\212\316\252ta\313\223(\004\017\003\373\252\027\370a\005\205eD\277v\305\375\331D)6\031\327\241<\n\006 \r\032\304\207\264\250,_\324\227Zk\r\367\347\036\361\311HeD\314\027#\372\305\300\213\222\017\220^H\374\346D\345\230\222\262\243cl\265\202\313\221\335\237{\304p;Lu\355\350\030\373L\336\244\247\304\006z\336\006\361a\270\313D\304\253\t\\\333A_b\273\261\235\342J8\310n\324Z\035$\371\025\217\257\343\241O\334n</7\013nhe\263\273\237-\335\f[\302 \225\331\017\020\2776\373#,\335\217\034\211\220\257\303\270\017\364\274\207\016@f\020\316\203\217\004\013&|p\271\334\211\033"
+	.string	"\234\b\022#x\200D\037\036\0207\3207ZP\256\026\224\253\371\204\340\031Q\273\345\200j\264"
+	.ascii	"\376!\201\313\325L\374\374\344j\346Y\2775,{rB\272\"q&(%!]\355"
+	.ascii	"\315\312d\353\035\243\325\2254\213\263\027 \316,\315n\226# \272"
+	.ascii	"+6\262kf?\365\002[I\240\260\310\375Y\006D\314\331\355\n\021<"
+	.ascii	"\266I\n\036[\252\345\340\230\340\261\315\331\203\361\2722\227"
+	.ascii	"\3136\343\332\202\255Y\356\270\260]'G>\035\3752\271e\207[\261"
+	.ascii	"\321\252p0@\205\\\032\016,qG-\033\231%\006X\250A(\245\fD\304"
+	.ascii	" \245f&\224$\205tp\002\031*4\017\020P\250\206&\351O`\305hWk\204"
+	.ascii	"?m\370\217\207c\351\004D~'\370\204\251!\347\231&\323\344U\214"
+	.ascii	":\252\301/\226\002\353H\233\332Ab@\n\233\367'tc2\2660%\021\235"
+	.ascii	"5\362E\252\001\303W\355\210f\2361\226r\2133>\330%\024@\016p;"
+	.ascii	"Y\327\004\2718M3\021A#\3076|\321\270-\2072x\260\033\034<;\205"
+	.ascii	"\243\256z\340\316%|\226\247\254\006\270hl \005\034N\377o\241"
+	.ascii	"\360\33711\216\205+\301\220n\215>R\273\373L\257t*\203\250\027"
+	.ascii	"\242\336\264\335\345\316\270\373P\277\250N4p\352o\035\377\001"
+	.text
+	.section	.gnu.lto_getRxfailValue.98.c1bbe239337982d4,"e",@progbits
+	.string	"(\265/\375`\216\003\225\027"
+	.string	"\206j\223G\300\026U:\0258\203!1[\351o\201\262\006\037\030\300\t7+\224o\3321:"
+	.string	">\373\r\r\223%l\017l/9\302\355\251\360\265\2753\005\246b\360\276\215\334m\"\255\216\202{\371V\245\256\335\3647B\366&r\247\024{"
+	.string	"z"
+	.string	"\202"
+	.ascii	"\276I\204\363\210\353\234:*B\272\255c\237l\257\264\025,\320y"
+	.ascii	"\016\346\255\365\326kR\253\016\201\r\214\237\266}\037\027\322"
+	.ascii	"qL\352l\2500\341`\324\212 \325\252S\315\274\206~\312\323\320"
+	.ascii	"\317\255\361\330G\221\316pe\314\227}<\341zb\204\035\023\372\231"
+	.ascii	"\317\347\201|\302.\250\213\f\026>\017O\354l\215Fk~x7L"
+	.string	"+xV\2127\265VK\333\n\026w\351\266[\330v`/.\322Vk\325U\233S\214\035\231d\233\365\"-\b?\200nB\265\3560x\020\333\304\211l(\341z\220\244\b\325Z\033\b\371\020\034\037\350\323\035>\310\333>}\327\226j\360\200\271\323~\017\344S\f\230]-i&\203\266\216&\227\206\375\r\006\203^\2743lK\247,-ci\324s\377\311\322&*]\242\322\343\224\026EiJ\245wJ\313\225\376L\001\035VJ\f\325\232\"(\246\006t\347\221\026 \221\221\037\313P\317\013\032@\332\025,\310\333vwe\376\223\0030\362\342\233\027\036\005\303\350Cy/\203\206\225\274mE?e\016\034M\371\356\276\221\3111\r\272`9\022\026\371\274=\254G\223;9\221\177\353\002\n\017\030\214~\376\267\323\2062\311?r\002=\237L\216\371\017\357\247h\227\370L\344\016G\215\201\304O\342\337\370\001\364\323\322VS"
+	.string	"\341\250\265\332|\310\366O\314\342S\253\354\267_\346\340\241\225\223\263\342\300\022\315J@\342\245\"\361R\345\340\254>\250X\257\020\252\0044v\201h\275T\"\\\256\227\352\244\233=\254;\303\017\002\032\321\324\2160=\"j\035\316-\001\277\334B\2315-\n\333\246\365\315lia\255\265\216\363\367\030--j\317s\023\360\030\035\267\264\347\311A\223A\213;\256\344\362\340WZ89\237\025\237\270(\027[\202rJ.\253\300\020\351\246\366\265$\033E\030\375)\247\"a\002\005\n\3643E\250A0\342\224d\212\220\320\004I*\245\031\003\200\002\021\"\263\033\021P=\203l&,\2644\006x=X\253\357\323#M=E\357\220"
+	.string	"VJL\323c/xl\021\013\033\341\344\205B\215\330\327\273\334\331\236)\214v\006\273\017\022\213n\342L\363.rq&/\220\237\217s\003\333\311J8\320R\301\320\213"
+	.ascii	"\022}\274\024\307R\230Kv\253\351\264\\\362\265\237Fp\001(\016"
+	.ascii	"Y\220\234\200o\"?\200d\302\246\316\310XFF+K\306\332\b\365\253"
+	.ascii	"65\0322\355\235L6!I\254\361\356\203\271\320\341\230\n"
+	.text
+	.section	.gnu.lto_applyRxChannelRangeConfiguraton.99.c1bbe239337982d4,"e",@progbits
+	.string	"(\265/\375`\273\001\265\020"
+	.string	"\206`qE\360,'\035\217\223\276\312<\346\020\264q]\177\313u=K6\244\2548\006\231\"\315E\002\235\306V\240j1h\263\353\250\220\330-\206<\f\213\023R\203\211$\205@\n\336.FJnbC\246\353\326\310&R\246\024^"
+	.string	"U"
+	.string	"]"
+	.string	"\255\207\0162j\327B\211\237\335\345p\201\323\243\206f\333\267\371\206\226]\031^\220"
+	.ascii	"\240\006"
+	.string	"DK\016\212\335\260\273\270\200\3551\217\261=*\315]\3274]\376\3125\005KG.1\nW-C\246\002\222*\366\3224>\b\265<\347\371\022\203e\232<v\327\351\022\233p\307\333^`\233\201\235\032\0012V9]\221\351\324\303\233;\316\217z\370\233\234\216\231\326bZ3\2351}\213\214\020\"Z&v#\314R\254P\004\252\261}\177\347<(\327\261\016\031i\330]\016\305\346\336\2629\333\332\3417\255\343\250\f\270X\330\215\315\317n\310\341\003\247G\207\247L\373\262s\bG:'^9s*-~L#\356\240-US\223\332\"\016\362.\234j\013\243+V\325\274\373\250\032\300 \273\246\276\250e\311\337=\230\234va\t\374\236\021\326iw\237\341\321W\331\036\257\0254EH2\226\234=)f\306\243:c\0047)\214lvC\002\226Iv\370J\235\261\257\255\006\016\351`\205\234\254\274\216\344\363\274\357\203"
+	.string	"H\003\222\025\030AFJ\274\025k\363GG\n\330\245\200\035\211\310\312\353>@V\327\201\341\257\004\004\354N\276\017\354\270\220\345*c\023%\"T\214\022\204\364][\324\027\333Q\355\301\242/-\245\025\372\234o\354\034\275\206v\226\"\221JS\352|`\024\240\207S\225\236\347\033@>/\001\037"
+	.ascii	"&j\345a\205\006\306\006ut\335\366\232Z\253>,\256\271|\347b=\267"
+	.ascii	"\231\262\034\210\007T\251_\202\237\251{E5\307W\373\254\225\\"
+	.ascii	"\310W\326\246\310\0303A\215\242a\217i,\006\f\203&l\n\035\264"
+	.ascii	"\013H\t(U\r4\227\202\002"
+	.text
+	.section	.gnu.lto_readRxChannelsApplyRanges.100.c1bbe239337982d4,"e",@progbits
+	.string	"(\265/\375`\323\003\275\033"
+	.string	"&\264\263I\260XQ:\300I-\006\013^\2133n1\035\327\303[[\264\013\270\020x\033\277Q\260^]:\363\250J\016#\332\360\322\023\344\326<\222J\247\201\277\027\224\025\006\204_\271s\304\361\227\206\025\350\227\335\370\243F\b\331[\312$\003\237"
+	.string	"\225"
+	.string	"\243"
+	.ascii	"\347\355\022\351SD\006\233\210\221\252\265&8]\003\344\251\315"
+	.ascii	"_\342\351\274K<\335e\261\273:\375jg\273[\316\313\325Q\007&\350"
+	.ascii	"\367\245\326\nk\035K\006\370\344}U<\373\214\212\034E:\233g{\244"
+	.ascii	"\317\033.\232\2246\237\317\314\021\210\210\307\243\212f\314\233"
+	.ascii	"0RJ\357\325X5B\310a$\343d\001\033F\267\217\023\201\324\223\251"
+	.ascii	"G\025\335\346\213\210G\031\304\342\321\351\214\355\350\223e\003"
+	.ascii	"\2326\300\363\220\355\207\373"
+	.string	"\275S\235\030.6\214d\234G\b\265\326\345\322f\364]}w}\273;a\267w\001\373\035\247[B\207_\236\356u\304SV\253\224h<\274\025-F\204\263q;~\227\304\261u;/G\232~8L\007\231\200l\335\270]^\215ora\244\266q\354\276\\$oMk\344e\215\2744#\257\352\277/y\336w\234\274\242\310K)\357\234\274=y\271y/ \204\017\250\031S\255D\3031\265\nU\322\375\367\363\316\273\337']\310\342\301\365p\003\n\251\265\256\214\354\201?r\337\354\277\025\257e\275O\256\207\220T\255<\004\344i\213Od\337{\221\357f\001k\341\002\277t\265\272\373\300O*7`\355J\360\302O\301\320O//\224\222a\372r\265\326\033\246G\321\260\201\003\007\361\264\246/\374\364\0025\265$\006\222\243#\335\024\214\261q\313\224\246\2374t\232\254V\365\320\202\217\335=\237\316\305\334\017~)\346"
+	.ascii	"K\255\264\227P\272\3256@\355\263\252\346\356\246\2402\333\341"
+	.ascii	"J\037\310Zk\203\275\223?\001\201\023\343\2271\361\364} 7\337"
+	.ascii	"\220\"4\036N\261qM\323L&\250\f"
+	.string	"\215\207L\033\267=gr\342?,\265\376\334\354\346|\211\210\007\271Z\177\032$\271\022\022\001;\"\307D\217\016\016\n\321D\316\316\016\316\210\330\2701\006*d0\0252\330\016\t\034\035XL\206\002\306\300\265<=92X\n\036\036\031l\305\243\275q \375BQ?\252\320\2726\323\270\005\200\204|ug\341\004\037{h\305\226\340D[\354\037\352Q3\244\375\216\235%\315v\374r\266\023O\351\201 d\300\334h<\374\362j\237\265\326\252j\334\016hac2\272\372\300\237\006\320\366Bl5\251\340c\277\372\275\323/\303\247\0265j<\334\331\373\024\001\300\276\351N\022(T\250Pv!{6\253&4$\tpMwoH\250A\034\245\0244F!\"\023L`B%I\007P\0021\212\331y\020hY\fm\215\0017\372\221\375C_\222)\032\177\202a7\255:\2360\017\374\277d~\356\265 \300\301BP\207"
+	.string	"\3419\234\225\331|\261\230\337\220q\224c\242\006c\037\330\fCW-\024\200\356\3225\370,\273\270\2524a]&\266Q\017\177Y2>\023\035\3575\234\020a\274UY\272 \033\306\352\035AT\304!W\211sk\\Z`|\350;\032\3635"
+	.ascii	"N\257\212\005\007\2370O\257\365\250?-\032\251{\352\003\345c\237"
+	.ascii	"\351\205_L4P\001"
+	.text
+	.section	.gnu.lto_detectAndApplySignalLossBehaviour.101.c1bbe239337982d4,"e",@progbits
+	.string	"(\265/\375`\332\t\3456"
+	.string	"\312^\034\025CP\346Q\007K\346\320\337n3i\244c\276g/\021U\241FT\306\334`)zr\377\240\001u\233^\215\232\261\\f\003"
+	.string	"\240\002"
+	.string	""
+	.string	""
+	.string	"8\207\r\017\033\263T\017\245I\204\231\203tg\215\354\275\367N2\245@\001(\001G\001\256\257E\331\205\254;\333\237l\r\307\244\345\204\225\355\223\313\231\366\300\365\265\373F\267\317\327\367\265\366y\2327_W\303\341\260\027\354<\246\230\205Ma\330\351\344k\023p}er\"\353\253\352B\326\327\267{\217\322\026l\214`\006\206\354B\007\303p\361\227"
+	.string	"\350#W\235\336\302\177}\t\200R\022\022q(<2*\n\002\177D\276\036\317m\331U\375\374\266\267\025\324\261\037\203b\245\321\227\262D\261d"
+	.string	"J\274\320\\)\352\005\272\246ihb^h\236\304\216u\221I\253\023\363\312\342HgI)q\222Q2Q\312\032\224<T\333\255\037Q<N\362\211\032Eh\372\346O\035Y\250\304\313\211\0375\031\025\251\f\246e\004y\234$\023\225\370#J\\\226\203a\016\364\254#\376\013[f\242\336X\017\267&\356k+\210y\035\361\236z"
+	.string	"\316X\036\217\2234\242.-\343\202\270\033X\346\235%\213dW\2147\235%\277r\2532\305I\022qCf\266\255\360\364u\214\313\231V'\346\345\304W!\256\372\224Z[\371\201J-\225\t\206a_\363\314\245<\346\334V\200a\270s\254\364\362\016\340\335\331\327\335%\272]\027\001\313\346\333\267\245\331R\262\317\354\254:y\004(\020\273\177\362\244\347\352v\307b\325\234\230\361\225\206\016PV\276c\327g\252\f\226q@\324';\343\031\r\212\374PL\\@\220\346\225\177fc\261\376\257\344yG+\023\352\36677\203\325\376\244SHe\217\245X_\375yF.\206\226\315\257\254|\327\277\334\275\242E\366\230\351\021\350"
+	.ascii	"B\246nz|c\267\363\230\237\331\355Qe\204\366\364\223u\273\271"
+	.ascii	"'\264\271\243x\271%@\025y\271\033<9\271\271\r\270\271\t\270\271"
+	.ascii	"\233\\\315\233\311\315\235\344c\274\221\274\315\233\350l\336"
+	.ascii	"C7\267\260\227\373\210\315m\304\313]\264\346\016\256\271\201"
+	.ascii	"n\356_/7\021\233\333\307\346\356\361r\363\334\334\356\232\273"
+	.ascii	"ms\263m\356\225\315\255\256\271\363\232\333)(\335\035\245\\\314"
+	.ascii	"\214<\035'\374\343\316\020<\267\276I\3611\356m\356l\356j\256"
+	.ascii	"v{\264}\275g\3274\214\213\241\341^\332\317|\311\321\321h\337"
+	.ascii	"\342_\272}}\303\275\364\252\204\"Y\246qiw\353\342\320\327\333"
+	.ascii	"l8\034\303n,3C\213\n9\276\364<\351\264\331\315Y\221\353R\364"
+	.ascii	"\314\366:f`\220\321_\361\275\314\f\r\031\355==\361\271\272\375"
+	.ascii	"\253\347\035\004\271\235F\267\300v\277U\336+\331\343\366\201"
+	.ascii	"P\260d\335T\353\215\231\254\b\230Z\360\231S\267\3625\207\016"
+	.ascii	"P\240(\\\025\3403\177>\374u\013\224\312S\256@&\360\335\257\226"
+	.ascii	"\267\231=.\n\311H\207\314i\275\261\207O\340;\3439\322\004\017"
+	.ascii	"\221\202\036gF\226\360\213\271\217\245\3319\343[_\217\005\003"
+	.ascii	"eyV\270\330O~\342\026X\246_\177\300\223k\220\216\3451\337u\357"
+	.ascii	"]c'|Y\2173\343\037i\\\324O\3706\020\373L\037\365\376\305U*J9"
+	.ascii	"\321A\320)"
+	.string	"\307:\026\3468\235\013\0302d`}e\017(\241H\324\256\270 N\3363[\302?=U\230\364)\247\301\345H%\274\357\030W\247\326}\002\301!s\237\331\r\376\351\337\312\363\215\213\351\r\016\207\203\013\303ZP\355o|\256\203\007\020 X_\033\274\213\361\034\r\233[6\325\\\212\207\315\255}f;y\322\243\350\021\005\316\037\251\372O\237\341\220vY\371n\204\313\211pa\030\216jo\343q$\332\237\370\332%L\230xw\363\005\306.r\002\315\302A\214\027-d`\025\253\254\250\250\254\244\226\246^\300\240J\021\203}1UU\225\202\205T\033\203\303\024U\213\0202\252\246\256\256\260\244~-\345\240\306U\261\306U\261\252E\n\252\242\324U\214\242\003a[\301\230\272*\312\260\262\272*\372\234Y\376dk\356;\244\207\346\262\376\270\364\314\206\020+9\375\332$\311\311\221\220^x\364\302\034\037}\202w\302\326\306\006"
+	.ascii	"\322;\275\212c\227\321\207\274##\213\336\250@n*z\217\272\220"
+	.ascii	"N\372f\016\351\233\336\320Z\214T\022B\004\r#S7\3655\371X\343"
+	.ascii	"K\020\026@\305c\363-)B\356~\211\274`\331\343v7)\334\034\217\331"
+	.ascii	"\\\"\005\337\355 \344\236\277G\222\274c\331\343\340\373\020$"
+	.ascii	"Zo\304B|&\360U<\357\330\001\337\327\274\200\262\215l\331\234"
+	.ascii	"\016\237\331\301/GP\377wV'\037>\327\360\177\177\301\r\321\377"
+	.ascii	"\332\013\271\241\227\371.y\231\274LX_\211\376\200\035\025\206"
+	.ascii	"aX\370\344\303\207z\272\257\270#\035\350\362\230\3572\220#_\035"
+	.ascii	"\235\373>8\346\203\017\322\356)m\326\031\365\004\211 \326\tD"
+	.ascii	"\342ub\342\365\304~x\337{G\332-\310\356\033\220\362\232e\217"
+	.ascii	"yH\266\f\020\337\375\200\310\250q\034%\031DhHFD\244IRh\f\240"
+	.ascii	"\002\021)\243n\021p\255U8\223$\323\034NE\215~}\313=\315\312u"
+	.ascii	"\2679\214\251\246|K\213V\314\232\246\260\214h\021\254\246yc\224"
+	.ascii	"\333\032g\337\003k\227Y\3310\004\221\341\350\023\312\312O"
+	.string	"|Z\305\227\242\t\246X\202e\301\261\270\217Q<J\306l\304X\016H\250\320\2546\253\007\275(\322\265L\262\336uN\024\351\271\222H\020\0042q\2131\3763\340\226\024\340\366MR\370\230?w>\205'2\273\0017\234\354\207\336\300\355\230\264z\303\304)\331\273\260\344\356\017q3H\316\321\201\326\246\366a[\233y\366\373\207\367H:\214\363\372\233\361\350\316Q\004\305\335 \237'<\002\352\261\036Ao\327\241H\243\003C\321\300o\201\272\356$L`\035\236s\244\255\t\037\3768\307]\215:\345l[$\024g\330i\370E\226E<\235/\340\271g\204\271q\214Z\f\303\\S\220\321H\214\nuvj\036K\217\273\3323\305\f\3159\317\3374>\377\377\372\324\202\350w\204,\322\215v2\313\302'\247\035\211\222\3509y\217\272\314\341\030\320\024 \266\310\360\227\200\305\231\021\257\226\343#$\316o\256r\327\265y\024"
+	.string	"\375\266\367#3\233\345\302\250\370\314TwD\316*\233\272\240\332\022Y\374R\307"
+	.ascii	"\005\377q\355\033\273*\266J\030<5:(una\273\376\360^\355}+\334"
+	.ascii	"\346#\271K\233A\326\310m\265\371\003"
+	.text
+	.section	.gnu.lto_calculateRxChannelsAndUpdateFailsafe.102.c1bbe239337982d4,"e",@progbits
+	.string	"(\265/\375`\233\001M\017"
+	.string	"v]fE"
+	.string	"\261&\035\200\201e\350,0\306\227<P\313goc%u\006#\007\324O,<\362-\001-wg\315\032[k\215/<\022\247\265\375\261i\0012TUW\004\023O\264\351>\350\031\036\311\240GI\334{K\231RS"
+	.string	"M"
+	.string	"P"
+	.ascii	"\361\360\335#\036\332\266\310\201\223Q\357hZ\002l*\254\300xv"
+	.ascii	";M9\034\365\b\237&\312\007\300\245\036\263\013\207\257@\314\n"
+	.ascii	"\027\0207\341}\354h\200\321\302Q\310\347r\rq\253\007\262\273"
+	.ascii	"\307y\262p*\231\034#\273\353dq\026n\216\333\036\331\326\354\333"
+	.ascii	"\b\\\016M\314\315\213*o\330]*u\306\376\333\335\265n\260\357\372"
+	.ascii	"CN\177\234\216NC\247\237\323\252\351w4\340i\265p\177\321\331"
+	.ascii	"m\335\350\331\026PE\007\333'\033d;\323>\210\337\234\356\222\340"
+	.ascii	"\317n\206\027(v;\003\036\220\035\202\374#2T\237\336\304\n\006"
+	.ascii	"P\276{\tS\266\253:\213D\252\352=\310\2544e\373\301c\244lw\021"
+	.ascii	"\370\260\217(\3715\207\216`2\305\303\324\263\200\201\321p\345"
+	.ascii	"\356\246\324\250xe\360r\261\312\032\366C\\\004\312\257\361\t"
+	.ascii	"J\236u\350\243\304\303\353qN &\005#\022I\002\223\222\321\266"
+	.ascii	"\235\210\002X\024\222\262i)\233VB\262\200\244\2116\223\026\342"
+	.ascii	"\341\022\204\321\246\231\224J\233\006\352\366\017\302\254\307"
+	.ascii	"\246\025\323y\177\375\243,\266?\352\021\225\252\304\216\f\251"
+	.ascii	"-\032\345YP\237\246R\314\330\221\201:\363z<\341 \252\bL\354\303"
+	.ascii	"{\232\363b\260\002  \260\002\241\200\254\007\340\2007lM\302\005"
+	.ascii	"2\210V\340l\31396\217yF0\016/\203\016P\213\024\025\004\t\230"
+	.ascii	"\210\234\217q$\355m1\266tB\220i\004\221B\224A\003\224\327\224"
+	.ascii	"2\3604C\304\347\253\027\315R\320%kl\327*\003"
+	.text
+	.section	.gnu.lto_parseRcChannels.103.c1bbe239337982d4,"e",@progbits
+	.string	"(\265/\375`\303\002\375\025"
+	.string	"\346\250\217J\260\022R:\343$\224SH\312\316gPF\024\303/N\371)\263\007n\340\201\371\367\353 D\262_\023:\323\350\253VF\305+\301\277\221}e\335\245w\007\007\357\2169\365K\266Q\3340\273\207\257\207\036\224\213\324H\333\233\310\235d{"
+	.string	"t"
+	.string	"~"
+	.string	"\rd\260\b\306\323\005\236@=\035?RO\327\266;u\240\257\013\374\374n\206\204t\367\213I,k\332>\262*\025y\332\366A\027yxAve\315G\221\225\3131q'\r\036\304\224*\252\245\013\341&\013"
+	.ascii	"\n\235\327\016\247%\335M\226\271)\212#\037\216\236\\\245N4y\372"
+	.ascii	"\331\271\360\023\247\264\231|\241S\036\236pW\352|\262 t\367\316"
+	.ascii	"]\271\341\333\372\356\212\330]\007\273sGL\271\222\271\267\013"
+	.ascii	"\254\231)\276\252\251\345\236]\327\201\277\310\211\276\344\177"
+	.ascii	"\177\353\301o\255s)\235+\212sY\234;y\356\003\210\3748*\017b\330"
+	.ascii	"\2353\264\352&\272t\342D\177p\367C{\341\222D@?/\032\214w\261"
+	.ascii	"\027Z\362tw\2034\002\332\251_\252\370)\242\352\006.8]\224\361"
+	.ascii	"\364\344\356N\340\214\224\202\317\335\263x\013\333\1774\037\320"
+	.ascii	"\335c\244\324\001P>3\365\364;\037\223E\2568n\256n\247!\033g0"
+	.ascii	"\363\220\026W\236l@\007/\207.\005n\016\367#~+\200(\367\212.C"
+	.ascii	"f\222t%\022\250\225\252\247$c\b\336\260\231U\237?+ =D\356\355"
+	.ascii	"i*\311\034\204T\"\030e3\253Vd\236_\364#Y\002_\267\356\273\275"
+	.ascii	"\321a\304\304\373\234n\005Y\375NVg\026\346w$\227\344\270f)\237"
+	.ascii	"/|\004\036^\322\315\325m\016Y\0301\207\235B\314\345e\246R\243"
+	.ascii	"\2152\027`^bta'5\332\253F{\275\304Xd/\030-\346u2\2623\230\026"
+	.ascii	"\332Kf6\243\275H`\237{\202\376\f<B4\335\030G5ro[Q\325\3054j\342"
+	.ascii	"\254T\312*{$\332\312HY\214\201\263s\233\303\213\335\335,\224"
+	.ascii	"Wv\361\205.!\310\023\352\200ps89T\221w\267v\033\023\016\370\272"
+	.ascii	";e\227\345L\260\261\273\037\234\356k\270\264\220\0046 p\002\231"
+	.ascii	"\"4\017\341\300\357;\332\006\202:ze\002\013w\236\312\016\232"
+	.ascii	"w\367*K\212\260\003\265I\377\221)1\321\205\231:\354\360X\252"
+	.ascii	"\270\3239h\263\3048\353 p\244CC\306v\241\301\013\026g\212\035"
+	.ascii	"\306\0035\234\330btY\016(\tw\233>\340\\\346p!3b\362\200B\330"
+	.ascii	"\205\3042\r\213\373X\255+37\300(\335\275q\327S\f&\\\360}\b\227"
+	.ascii	"/g/\2333\265\346\t"
+	.text
+	.section	.gnu.lto_setRssiFiltered.104.c1bbe239337982d4,"e",@progbits
+	.string	"(\265/\375`\275"
+	.string	"\025\013"
+	.string	"&\025LA \307*\035p\016\023@{O\350\202\021\361\036\200V\270m\026*\304\231p\301\371\030\240\356\301\2474\200\326\2605,\244\t\022=\306s"
+	.string	"L\004\270a@\b\016\352\337H\005.\211\210\r!\262\367\336)\0058"
+	.string	";"
+	.string	"5"
+	.string	"\033\356\325\241\215\340\343\3116\250\020\340\240-\330\335n\232<<\2352\364\021D\324)\310\247\202\250\242\234\335\375\354\262C\\I\211\361\354\256%K\374\270\353mS\330\216\260?\021\322\307$(8 ~D\300\256\307\255\301\026\250\003Rl_c{\216w\t/3\371`\267\304\366\220y\345P)\355\257\234%|\354\344\272K\322R\333\035!\354\220y]8\003\367*\037\213\232\363e:?/f\006V\222\201}\332_L>\212A\222<\353\325'q\257\237\237\235\326Z6XHJ\336\354\021%\347\313>\335\335\365t\331\217\375\365\262\237\322\240\317G\362@.\004\202\025\033 \021\306\237N\351\353J_'\nY`t\237\017\354:\033{\031\240\257\323\360\274\257\323\214{\272\323e{RSE\353\364\001<\300\311\033\215\270W\211V\002\230\210\334\r\023"
+	.ascii	"2\241\305(H\202\201l\274\227\252\346`\341\257\356\024\341y\341"
+	.ascii	"\026$\027\206a\030\r\204\017F\301e`j\264\270\313O\265W\224\272"
+	.ascii	"\255-z"
+	.text
+	.section	.gnu.lto_setRssiUnfiltered.105.c1bbe239337982d4,"e",@progbits
+	.string	"(\265/\375`\277"
+	.string	"-\013"
+	.string	"\366\025M? O\234\016C?\f\357\003\003('\241b\031b\274\240\340\034\017\373 9@%\220\312\030\320\253ij4Pm\022e@\001\007"
+	.string	"Sb \230!\023b\240.\025\2311\f\207\370\035\311\336R\246\0249"
+	.string	">"
+	.string	"7"
+	.string	"y\t\365h\3166q\357\302vh(\361)\245\330]K-\234;\324\344|\214nsX=\270jt\0358\331\335\177O\006\235'\363\342\332]'\250sp\307\333\026`;\200\375+\244\037\302\364\253\214\n!\272K8\261\333\340\304bGD\021\031l?b[\275{\340N\322\030\262KA\305G\3658\201\231\3669\274\003\367\321\002\307\335\t L\273\036"
+	.string	"{T\217\033\347\240\036\003\352\374\264HU\221\241^\t|$<\271\302~\351\0374>\006k[\036\364\350o\324\343\365\337\241)\002\212\r\0208y\262\275M\252\310>\334\335\265\206\354LS\037\375\361\001\027K\266a\032u\331\nT\006`4-\203\330B\311dV&\263\016`*\006,K\246Y\024\2111\004\227\314R\200a\231\025\361\366\360\032\262/\216v \204$\2456\226 \017\362\277_\036\3358*\025\023"
+	.ascii	"2A\022\f}\340 p\007\214!U\313\360\242\b;\n\267 \2720\f\303h "
+	.ascii	"|0\n.\003S\243\305]n\252\275\2410om)\003"
+	.text
+	.section	.gnu.lto_setRssiMsp.106.c1bbe239337982d4,"e",@progbits
+	.string	"(\265/\375`\016\001M\f"
+	.string	"6\226QB o\224\0163(\022\b\332"
+	.string	"\013\300\030\314\254/\021U;\023\301\3313\260\036\023#\343\b+d\214o\215\340l\337\031\260\0323\322\263\004\032E\003P\002\200Yx\204\006U#\255\007\373\326\310&[\312\224\002="
+	.string	">"
+	.string	"?"
+	.string	"{i\207o\217\025\324\334|kc\351<\356\261\202\341\025L\260\221\322\220\361&@\r\024\024\213\215\204\027\256\031\357\004\t\354\356E\236\024<S\246\265\331]g\347Y\270\255\333\376\3306`\037\024\273k\365\260\036\362GM\247\246\177\001"
+	.string	"\"\205\367\017%\273\025Rd\354I\245B\204\355clg\332\b\024l\017\221`\335\335"
+	.string	"b\262\373\035p\201\312+o6\214\177\036V\300\b\016\324\211\324n&$8T\372a\342\211\"u@I\006\b\257\305\021N\007I*F\356.\247\326\342\325\301\210\213S\242\330/\361O\363C8\302(\337\275\362G\361\325\225\323A\002\302Q\312\024\373\343R?\354\303\r\037Mc \322\026\214<\241\213;\032Rv\221\262+\364i"
+	.string	"\272:\231vi\002\030\023y\262\013\002\206e\027\346\333\303U\217\312\213\025'%5EKZjc\017\362\235/\362\315I9G\265\324\211\232\341\026\001\032"
+	.string	"3\241o)\360\202\257\301^\324h\016\r\217\003\2364\020\200\340F\345\024\016\222A%\t\002\266\025\177@p\210\020"
+	.string	"\207"
+	.ascii	"\271\214\"U\367\251\3248\341\356\203Q\026a,0FQ5\266\253\224\001"
+	.text
+	.section	.gnu.lto_updateRSSIPWM.107.c1bbe239337982d4,"e",@progbits
+	.string	"(\265/\375`\264\002E\025"
+	.string	"\226h\213H\260\324Q:}x\312\"\021GI\303/\2249\260\210\022\254rr\341A\323\361<^t\360\252s\306~c\267\370\2621\333\224\344\242\237\034\224sB\025\376\017\272\231\255\035\272\371;j\354k^\261\271V\375\266O\366&R\246\024s"
+	.string	"j"
+	.string	"~"
+	.string	"-\356d\267\214\363&\263\202|\264\036m\034\273\365\3703\271\345\2578\213\333{9\3404\301\242t\2044\347T\360\350\003\252G"
+	.string	"\017 \037\3651\371\350\233MD\205g\352,P2\332=!\231s\312\266\304o\227\021\\\275\371!\313\252\207\247s\031\342\221\307I\247 \210\357\213\267\003\032\230s\236\351\352\303\313\251\206,sNk\017\357\303\035\3366\215\355\004\366\246\004\337\371\034s(\031\325\234;\f\374\027\177\232\361\215\036MC\323\367<\3724\371\370=RP\216$=\234\376\354\246\234.\221}p\3169\275CvL\245F\201\275w\237\204\352\027\250v\201j\223P\335\222j\226T\257@\265\nT\207Q-\243:\256\032\004\325\013\252u\325\027\340J\342\300\373\211\"sz\370-\231R\361\306\321{\277}?\272\036\256\361\334\006\021R\323\2723'\016\301jY{]\222jW\2532\2453b\373\271\243d\270\252\275N\350d\303%\220+\372\355|\240\334\330*\215\235/\356"
+	.string	"\025\307 \345^\207\004\333\2701\022E>v>\235s\352\354\022YF\202[\301E\220\035Ub{\302i\314"
+	.string	"7B\020\217%\333e\344\024\3701\347l\340\303x\f\n0\263\231|\204\355\013\310\215\225\353\356\312)\235PN\177\376\352\006377\017h\031lB\317Vl5\231\255&\2630\003C\223\315j7\262\225\230klbj\262\013555Y\253\twp\356\220\006!<)\334\346\344k}\035\337\341"
+	.string	"BK\213|L\001TdiD\\\"\247@\345\350m\254\003T\224Oa{\262>z\027\211r\034\217r\361\215,\341\345E>\242\354\235\016\332"
+	.ascii	"\032\262\364\343\332\327\236\351G\261\363\205?\223u\255Uw\244"
+	.ascii	"\265&\253Cv>\326\266v\247\0024 p\002!9\234\007cBsL\240\032\027"
+	.ascii	"0\254q/\205\232\263\260\266\023\216\253\306\340\020\303!Z=\240"
+	.ascii	"\342\355\224\025\326f\3260,\352\266\370,:X\334T+\320\345\372"
+	.ascii	"\373y\256\270\377]\376q4,U\336\"\341\311\241\245\261l\227^j'"
+	.ascii	"\003\"\2545\306\211\362d6&\023\032\344\340\342MO\300\316\266"
+	.ascii	"Q\016\313\007\366\t\363;2\ne\314\307a\005W\250\334v\005="
+	.text
+	.section	.gnu.lto_updateRSSI.109.c1bbe239337982d4,"e",@progbits
+	.string	"(\265/\375`M\001\235\r"
+	.string	"fXYD\020\257&\035eg\300\201K\001\205\252\013ja\375\343\001\212\355\350&LoAw\307\330l_`\r\371'\210%\350\027\223\376\3410.5c\261\b\f@A\004"
+	.string	"\205=:Q\305\370\212\236\376C\032\331{\313\224\002E"
+	.string	"D"
+	.string	"F"
+	.ascii	"\034\325\2451\333{\307a\003\274\314\2100#cw'\334p\3542B\305\374"
+	.ascii	"\270\002\203"
+	.string	"\332\270\354\322Jy\274\314\017\254\204\240\331\270\224C\355\244\3520\331t\320\340 @\355\200\354\256u\343(\334\325m+\260=\355\177\b\362P\343B\352\246BI?\273\323\024j\260\017\277\357\2731d\261\037\363KU\277\263\201B\341\336\202\332\235\360\341\354I\272h\361\330\276\332\037q\022\330c\036\030\300n\006\021-v;\003\036`]z\274\243\272\214\017~M\214\357\244\301\314\237\271\b\316)\323\234\233lL/\240\n\177E\004\201\342\262*)|\032{\226\236t\225}I\271\330Ga\333\023\300\002\306nv\f\272m\001\217\023M\331/q\023$\337\203\035\230\350\267K\337\244z\243\004\240P\b\002\222\021\320u\221>\033\376|\224\\\263\344\232#!\013B\363s\215\346\007\207E\f@\327$\021\211\256\351\351J\217\013Yd~\t\036\314\251\0045\377\304\r\222iN\224\036\265EB\260\346\004<\013\321R\273\301H\277\005\037"
+	.ascii	"2\241w)\340=NX\240\223\352\263\013\272\226\332\013\325\252@2"
+	.ascii	"\236\222\f\0077\263\32556\001\301@zO\345\206\332\216\250\221"
+	.ascii	"\305Q\274Tf1\316\260\202\262e`\324%,b5z\334\315>\211\304j\262"
+	.ascii	"S7A\276]V\236"
+	.text
+	.section	.gnu.lto_getRssi.110.c1bbe239337982d4,"e",@progbits
+	.string	"(\265/\375 \356\205\006"
+	.string	"\202\214-2pM\322\001\240\3535\027]D\370(HF\316\203\260\375B\300\226\001\325F\210\335v\314\372\230\231\302\"TE\004=\330\202"
+	.string	"C\310\372\361c\331_\312\224\002\236$\313s\226\347\036\032\026\034\334\364\"\234\004\231\202`xN\202\242\236{\342^5\251\006\226f\354\223<B\177\343\211K\376z\363/\316[\252"
+	.string	"\206\225\231\035\253\324\r\373"
+	.string	"\253\032\333\351\324\201\224\r\366\217l\327\"[Y\224v\322a\033c?~\310E0\206\021\205UE\036\032\025%*\273\321\021\274\300y\313C\316\233r\034>\241\377\221+d@L.\254z\006$\354\256\363\302.n\275m\004\333\007\2663\002\b"
+	.ascii	"2\003\316:#h\b\3055\2617\"g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_rxGetRefreshRate.111.c1bbe239337982d4,"e",@progbits
+	.string	"(\265/\375 \373\345\006"
+	.string	"R\21505PO\222\016 \233b\324\n\327(T\322A\374\254\200"
+	.string	"m\226\347\226\345\213\265\266\265\346\343k\200\324"
+	.string	"\342\210q\025\021\305(\013\206>\213\3300\356\310\"\237\020\231\002{:\237\b?\021F<4@@O\234\200\235\315\224\204C\204\024\024\025\241&\313\272\321\356\340r\030\177ES*\201\314T\270(\315,nH\337\027\240V\254\357\202\246\276\346\006N\256V\372\314j\256\343\013\220n\364\267\233#\200Y\021\225\364\222\271Q\232\311\226\307\"\362\207^sIZ\022\272\342d\\\026g\004DCE&3\203\0055\230\372Z7S\237\363h\325V\335\232\224\301\205\024\203\211\254\266\200\205\314\274a\"\216\356\372'\374\b\377G\b"
+	.string	"\004\013\330\210!\005\205"
+	.ascii	"]\303{#\\\026\202\fw\305\324N2"
+	.text
+	.section	.gnu.lto_getRxfailValue.part.0.137.c1bbe239337982d4,"e",@progbits
+	.string	"(\265/\375`\310\002\025\024"
+	.string	"\006\244\177I\300\322Q:\250R2u\027\202\005r\360A\271ZdJ\321\243\313d\2200\f\312(qPG\t\215M\004\340Cv\315\020cJ\315R\353\254\037M\305\206\"\202\200\007@P\263L0\341\026\374)*\273\357\222\351F\310&r\247\024d"
+	.string	"p"
+	.string	"k"
+	.string	"\326]\0173\\\354\216\t>]@\365i\333l\326\347\211Z\316\266o\342H6\337\310\261(\267:\372\260\263\324\333\035\305\317"
+	.ascii	"'\001?\345G\300O%\372\315\347\247\022\274\361%\217\356\366Y\323"
+	.ascii	"\361\205,\032|H\361\3506\\Et\270\317dw\277\273\354\321\345H)"
+	.ascii	"\340`\310\262\273Vq\270\303\333n\261\355\300V\221\216}\3733\026"
+	.ascii	"\3714\340\321C\352-n<\2319\246\026*\340\200P04B'\367\244\203"
+	.ascii	"\366}\026oa\263L\363&\003\220\212\321\243\231\273\247\036\357"
+	.ascii	"\307\26379\334\201\"\261\273\254\317OQ\363U|g\026S\355K4Y2\256"
+	.ascii	"ON\351+l_\242}ur!\031\234\214r \030U\037\001\237\344\024\225"
+	.ascii	"\332G\033\023\243\223O\177\322NQ\261}\264\t\274\022(pd\020\353"
+	.ascii	"\345\356\336T\207l\317\200\327\007)\335\300\311\036\026\221&"
+	.ascii	"{\027h\303\274\344y\256\003xSQ8\275\311\260]\303\241*\332\334"
+	.ascii	"\002\355\201\317\357\376\013\274\035Q7\tD\352\220\025\374\267"
+	.ascii	"*d\257\244\277\225\264\256\244e\210\364C\002+O\273\030\202\374"
+	.ascii	"X\240\371\342\350L\207A\2431-\204\201\034\236,\031\213|rN\001"
+	.ascii	"\216\201y\275\300b\013\\/\255\231\314\253\305\200D\306\005\203"
+	.ascii	"\265b\\B\273\240\324\310\304\032\231\b{\265fD\027\331LD\031q"
+	.ascii	"l\202K&R\210\305d\"\313\266\374\267*\344O\331\370T\277\373\234"
+	.ascii	"bR\251\237\366\250Yp4g>8\024O5\204\352\360}M\253A\266!\374\251"
+	.ascii	"E\265\213[\361i\274F\004_\304\247%\264\246\337\002?\245\206\020"
+	.ascii	"\005: \240\002\031$\333\006u\274\202\231\204a\306\330\204\266"
+	.ascii	"\320\020\327\031\334\256/+\231]\270\363Al\236\232%p\256\257\034"
+	.ascii	"\306\263\300Z\321$\032\303l\341Zo\020\203\314.5\306(M\0035To"
+	.ascii	"\201\327=i\274H\210|&$\3074c\343]\3152\t\362.\016\264\361\233"
+	.ascii	"\3405*X8\261\300\253\265n?C\213\375\226\034t\250],V\264&\213"
+	.ascii	"\273\f#6\354C\007\316\257\305\346r\213\243\201'\030<"
+	.text
+	.section	.gnu.lto_calculateRxChannelsAndUpdateFailsafe.part.0.147.c1bbe239337982d4,"e",@progbits
+	.string	"(\265/\375`\201\002\355\023"
+	.string	"\206\344\177H\3200'\035\300\222>\364G\206\354'\304lt\355{J\331\264\273t6\306\310s\325\343\250|\256\243\251\271\357`\255\366O\317\205\005m7\020Ly\345y\237\340\n_\"\367\332\245\021s\036\007a\303\277\366j\204\354\275\345N)l"
+	.string	"c"
+	.string	"l"
+	.ascii	"\364\323\376\b\213\214\274\334\330\266\310\b\214c\317q\260\031"
+	.ascii	"\320C\201f\b\252\326\034\370\271\033\036\373\347\321)7\252b~"
+	.ascii	"\314?\0216\027\036\316\351u\227@6\0250\236\216j\027>#\255f\341"
+	.ascii	"\262\2436#Aj\255\253\232L\\Y\200'CTG\215F\20209\321\\\367XS\233"
+	.ascii	"\305\350q\225GRk\365e\266\033\300mW\260\r\332\021D\272\037x\201"
+	.ascii	"$\343\366\203C\026wqq^\325e]\036\333\321\337\214\366f4\235\321"
+	.ascii	"SF\313\031\2752:>\367\337C\366\374\b\270\325j\263\233\252:\023"
+	.ascii	"\305\007\333\267\257{\261W6\214\275\362\306\347^\036\004\223"
+	.ascii	"\271Z\273\361F\373$\016\004\363 \230U\265\356\320X\2525\207\340"
+	.ascii	"\323\006\276O\220\023\240\237\362\037\001\035B\030\212&\334f"
+	.ascii	"\227\325\2509rq\226\373\r\205\232\226~\342\204\325j\255\004\233"
+	.ascii	"R\324>\3164U\237]\234m\024\272\333@h\206L\224\262\217\364$\224"
+	.ascii	"\024\025\025\372\271+bS\362\301\211\353\233\370\021l\305\345"
+	.ascii	"\242\2371\007\355\306st\016\243\337\270\317\261%\t=\021\335f"
+	.ascii	"qg?F\375\022\037\212\371\036\f\341\025O\373\364_\364\363\001"
+	.ascii	"\257\004\255\225\224\222\026\226V\030F`\0050+\304%\004]B\220"
+	.ascii	"%\345d\005d\205/0\344\303\256\007\255\020lq\271BpuY\227\307\327"
+	.ascii	"\375\233\352\351P\244D\377\030\375\266\306\366\267&\221\355\354"
+	.ascii	"\363\230L\216B\351z{\026&tKl-\0248hr\362\210\366\002\006\361"
+	.ascii	"4G\242\020NQ6f\033#\245ag\344\321\305A\305Xas3\252\2733\347\246"
+	.ascii	"\370nn8 \260\"\251:;\3752\206\351\022\374\200\216c6I\270\237"
+	.ascii	"I\036\211\241\035\215\341\304\037j\006a\324s\257fE\330\303\262"
+	.ascii	"\366E4(\205\313E\267{x\213\031\340\022{^\020\355|\204\017\234"
+	.ascii	"!\006\ft\262(\331\033\334\377\371]^\370\300=i\271\027\346p\356"
+	.ascii	"\302\005\177\252\220YsG\374\026\017\230\316\365\231\335\202\032"
+	.ascii	"\262\350V\003\025\247\342\002\206\350\246A\341U\237)+\367Xk\234"
+	.text
+	.section	.gnu.lto_setRssiUnfiltered.part.0.150.c1bbe239337982d4,"e",@progbits
+	.string	"(\265/\375`\231\002\375\023"
+	.string	"\266\244}H\320\322(\035\301\214\020\376\316\265\256\255e\0244\302\301\3134Nt\"2\3031\020\313/\201U[\366\3033\327\340\376K\344}\370z\352\252\376"
+	.string	"\314)8\247q\026\345\364-\321\262\370\214o\273\327T\210\377I\354\336D\312\224\002d"
+	.string	"d"
+	.string	"j"
+	.string	".\376\346\034\201\204\342=\236t'\257\036\007;\316Kq\023\006\306\253\366Y\274E\3548/\3079k|\204\346\304)x\264\001\357\021\300\005\310G}\211|\264\277\3026\f\3061[\307q\267I"
+	.ascii	"E\216\332\316\2179'\370\270%\036\373j\027\3635|M\035<\\\003\274"
+	.ascii	"+\251\3149\355\305\334\361\266\027\330v`o\201\335\273\271$lO"
+	.ascii	"=\"\325\"%u\310\252O\2536I\365'\325\236\247.\255Z\226\324Q\252"
+	.ascii	";\251^\251\326\343\376\233\350\314\001\24299$\001\2315q\310\304"
+	.ascii	"}~\236\253}\373.`\376\213\377\370\344\323\343\362\211\254\307"
+	.ascii	"\365i\233\237=Rl\340"
+	.string	"1\347d\340\235\007\366\035\027\2050e\037\022<\272\313\271N\354;\001&\267\032\217\231\321Q\021\342[\032\007\262\035y\333\355\267\017B;QZ\317\016/\343\345\3159\033\370C\217A\301\277y4*\225\222\217\245\375\206\342\312}-'\013\272\220\252\302j%\037\343\276\200HB\332\325\355\3664\232\231&\331\207q \004\376\215-\260\350m\217>\213|\334\375d\276\272\377\371\003\034\"|\324r2M\322\265\361\006-(U\204U\253\025z\252T\350b\265\244\312u\001%a\325j\205\237S)/!\370\022\202-+\024\013\230\n[`J\211Y\030T!\230\201\305\n\301\223m\275\212lg\2736\266G\326/\372\215\327\204\225\025)\262#+sn;\272oE\226dv+\242\345B\226\350\266\243\323\206\254\032\325r$\367\fi\332\323F\243\232\f\312\345\232v\300\354\026D\243\231\331x\005< p\002\231\272\353\001\030y\225"
+	.string	""
+	.string	"\t\304\343\222\202J\300\3672\366.\3340\216\350\332@\007\f\334\354\236\305\020\355\233\333\247k!\224\240\210\013F\212\223\021+\343\3009\211\241z;\332\227\321\222\021nq\235YX\356\020^\244\240\006\020y3\302\030#:\026\006h\020\017\2476l\0014(k\300\242\257\302\253A\220\306\237Leo\366\217\224\343\207f\247\204\035\210\227?9{\273\355)\373\f"
+	.ascii	"\333;7\212\242\337\205\307"
+	.text
+	.section	.gnu.lto_setRssiMsp.part.0.151.c1bbe239337982d4,"e",@progbits
+	.string	"(\265/\375`\300"
+	.string	"\025\013"
+	.string	"\226UK=0M\225\016C\210\263\273^jG({\321\212\301\300\030\025\232\323\373\267\244\265\277\241\203\006\3330\206x5\364`\030Vup0w\r\036@\347\324ug\214Eef\020\250\261\355-eJ\0018"
+	.string	"8"
+	.string	":"
+	.string	"\316p<\332\337`\333C2g\243\270Wa12@\020y`\355.\366\250\024\316]\023r\376\275?\272\322\347\n)9x^\034Z\020\330];\036\334\361\266)\266\005\330?\020\216i\b\323\n\323\371\324\377GF\bPbw\364\265vB\034\201\301\366\355{\036\373\272\254\371\224'\024\317Q\235{;\"Y\323\236P\270\243:\326]\t\032B\354z\003\036\003v\202L\276\203\252\254\225\bUH?V\3659\274C\346_\260\202-\337=\372[\343\361*\272\024y"
+	.string	"\215T\3257h\205\362\36355b\302\302'Z\001\312/\365d\205\207\253&\007\230m3\260\331\n0\260h \256H8\032\306\3210\r\006A\006\253h\033&\2118\333X4lA\226i\330e;\017WMv\254H\250@\032R=\331\206\352\1778\210\212\345ri<\352\211+\003\024"
+	.string	"[+0\036\270\201!\005\002\006\271\004V\003\001*8@\024\fs\205\003\247\305\276\302\211W\331jN\3736\363vZ"
+	.ascii	"\256\275\230rZN\277\266\214\001"
+	.text
+	.section	.gnu.lto_updateRSSI.part.0.152.c1bbe239337982d4,"e",@progbits
+	.string	"(\265/\375`\353\0015\021"
+	.string	"V\037nF\360\320&\035\372tCx\361\374o\037\333\036\372\177)\360\016\247k\344m\344(l\3368\321\230b\3650\330\2201p\272\242\003b\222\214\032-\t\315[\267\315\2726\344\366)y\214\017\230w6\271\030\252\266A6\2212\245V"
+	.string	"Z"
+	.string	"\\"
+	.string	"#|ve\n\036]@\364H\372\200\355Q\373\307\366\310=\236\204m\226\013^\331A\227\325,\b\016\016\027\036\241\335\355\036\225\346\253k\232q\345{\230F/\030\353Z\276`\030\256\001`.\215\264\273\327yV\200\2652\005<z\230v\327\242\f\367v\333\fl/\260\363\024i\215\351\214\351\2172v"
+	.string	"f\327\302P\216\215\211.nz\214Br\311j`\337\271\201QBh]\033b[\305(\247\t\032\rN\216\217\320\343s\356\2478\217\315Y\345;\026\211\3158\225\373&X|\035s\266\237\303r\331J\236\266EC\310\2433\355\2378\212\325e+\036\355z\b?G\3314\205y\001\3520\003H\206+oXUS\220\032.;\256\251\252\347\271\201\0176/.3\020\255\0342\2276\204/\377J%\265\224e\177\305Y\254\3706\006K\362\257G\277d{\274\212\304f66\264\344\220\nQ\314&xD\020\304\341\207\225:Rg\254\361\332\252\214\275\245\265\030~PB}\251\223N\005~\037\350\0210i\200\372R#'*T\030J\360"
+	.ascii	"\330+\245\204]J\330\251R\016\276\316\013M\272\322\207\301\b\250"
+	.ascii	"\260;\001\301\260\343l\347\265U\031\353\374\024\202D\374\264"
+	.ascii	"h\353E\276l\322t\306\336\346\373\274\205\207\"!\331\036Gb=!h"
+	.ascii	"\350swY\2523v\214Y. \200\002\021#3\017V\204\301(\211\241|\230"
+	.ascii	"\235\366\026u\303V\240\215\214dA+\213\2716rg\360\007\254?\217"
+	.ascii	"\205%~\214O\227\205\"\331B\306'\265V6\201\302\275\026\330$Q7"
+	.ascii	"\314\b7\224\005!\bh\2079\237\307\3344\206\266\022\354l\254v\253"
+	.ascii	"L\221\356\205.9\247\267\320L\331n`\244\275\002\2704\247,\267"
+	.ascii	"^\213\307"
+	.text
+	.section	.gnu.lto_.symbol_nodes.c1bbe239337982d4,"e",@progbits
+	.string	"(\265/\375`q\006}\032"
+	.string	"fj\234Gp\326N:\0038[\233\224>\206aKKfB\274\221\027"
+	.string	"\b;\321\271\350p`\350\362\004\206}\020\364\215\31527\330D\312\013\210\030\370A\007\035t\360U\001\363\017\225\313F\272xj\241\202\317\226\223\330&m\023\231\002\210"
+	.string	"\211"
+	.string	"\206"
+	.string	"i\030\212.(W\013D\201\025\372WT\n\257\273\323\351T:\241\017\305\221\320\374C\215`\264B8\332\203\303\335\\-\231\344P\320A?\252*\365\371\324\3336"
+	.ascii	"b \264~\271\340N\326/s\316\246\240\017\250&]\f\322\303\034\035"
+	.ascii	"\314z\177n\266F_[\333%\274\305\265\207\245\354\357\025\365\245"
+	.ascii	"\020\365\243\024[&\323l\214\330\266m\233\354\347!\013\265\236"
+	.ascii	"C\375;\225i\306\344\357_.\b\277OI\021:\241>\235\372\337\b\025"
+	.ascii	"K\251\333\255\177\225\024\325\324\223S\223\324\222S\324\201s"
+	.ascii	"\323j\306\241\254Q\375-"
+	.string	"2\372\201\2061\372Z\240\372\1770\372Y^\364\261\270\350\277\351$X\237\372~-\372}\252S\222\005\322\332\324\1772\365\255\254\350WQ\321\327SS\364\251\250\377qP\274\313\272\224\264\266l\330\331\363D\177Jk\242\217\247\226h\326RI\004\215h&\242\212\340e\bnW\020\237~h\316R=\334l\275m\207\237q8\3320\264654\017Q3<Q6pE6\366'\354\225\201\362\237bzj+{\013DY\375\332\342*\373\032{\007@\231\001\217\200\001\036\331\253s7\366\026\235\234\034\344k\2439^%&\266k4\227\245|\331\362\254\204\314\020\213P\346\2540\302+\231\231\313i\314\207^\323\266\253\311\\f\177\f/\373\204\334\366\245\335\347\302\243\357eG_PG\377K\216\276!\216\376aU\177\220\333\266\375o\2467\372\205l\203@\215\267\321\270\033\325\343\246>\267>g4\036\345e&3\330\035\030\236"
+	.string	"\345e(\337\217\256\254k\247\3502\223\325\034\242kt\006\r]\245\317\005]\306\342%\020\261\350d\265N\272\327e\003tY\212\200\310M\271\237\237\313_q>W\307\347\"\323\030\200\325\230\327\341z.\262i\2142\033v\366\374Z\317-~\361\025;\374\203\336\255\3472\361\\n\276\355\334\"t\306\346\032\231\254\315E:Y\r\323\004\210\217#{k\242\354\323\203\314\356l\354\255\371\342"
+	.string	"H\310\214\274\215\275\307n\250a\020\006\323\030\211L\224$\245i\r\320\002\251\241\242\003\021\200\f\006\026\231@F\002\021\0211\355a\267\222cBFv\246)\352\342\200G\177-P6E\204\327\371\310\340o\360#A\250TP%\370T\372T*@d\331d\261XF1\001\201\200\304;\037A\354\037\225\034\3642\216H\327>\032\263d\016\201\334r\024\250\260G\275k\330\007\353\005\250\r\004\351x\177\025I*\237\235\277d\346\b\357vb\013\371]#\267\300PL\022c\302\242\337v\222\3073`d\001o\002\252\212hNd\013"
+	.ascii	"\023\326yQ\026t\235}\303\224\331\204\207 \233\314\200pn\371\211"
+	.ascii	"1\320\332\252\251\366t\200\234\342!\200\023B\nU\200\221A\336"
+	.ascii	"8\\\255o\036\017\177\217\337\201e\200|\314\271\247q\006\016\025"
+	.text
+	.section	.gnu.lto_.refs.c1bbe239337982d4,"e",@progbits
+	.string	"(\265/\375`C\001\025\f"
+	.string	"vaX20i8\351`DDDDDDDDDDD$\016\254c\2712\367\245\006\272+\361\316::\r\342\017\346\033\365G\364?1\332\226\276!\"\215\220-SF"
+	.string	"K"
+	.string	"J"
+	.string	"\360\027\220\177Vo\224\317j"
+	.ascii	"\216\247\311\303\350\037\374\234,i;x$\217\324O\220\016=\362\027"
+	.ascii	"\363'~\302\035\356\310\324!\322"
+	.string	"?\360[\364\2053\236%\320?\240>\275\217\240\207Pg,\372[\274{\275\356\007\372\254\b\2317v\200\365\233z:\374\220?\016\235Mm\310\343\324\247\205\316`\350P\246;\206o\013\237\231\003\274\033\256K\356\241Kw\230o\227g\n\275\226&\274;\324_Q\207\240t\001\3267P\237\211:&\352\225\325\251JoT^\202\017\003O\325\031\347\003\215\331\245'\246\006\362v\351\f\323\002y\255!z\253\tt\n\252O\304\227\200\337\221z\004\374K\32391\347\300|\023\365\207\315S6_m~\262yI\324!\360c\245/\242>\232\336\\g-g\261'\3133\366\006K\344\021\022\346\003v\016!\037\351\2005+r\222\024\354\306\033\364N3X\320\233\364L\352\004Sp\245\023\344\256\223\267N\236\235D\300~\226wWo\361{\035\361\234p\275ey\212\245K\024>r\365\007\247;4\337\250\272D\351\fK]\374\n"
+	.ascii	"1\005\245\004\266\202\275\260\227?4\323a\253'8tc\313V96\215\210"
+	.ascii	"\367\002u\006"
+	.text
+	.section	.gnu.lto_.decls.c1bbe239337982d4,"e",@progbits
+	.string	"(\265/\375`\345MUF\001\372%\002wV LA:\351\252\277\347\224V\227\263\273\353\375\020E\257\372_\367\336S]\215g\256\350\353WM\244\212X\216\330Q\024\362\274b\324[4\343S\243U#\351~F\221\233-\305]\237\353\322\224\337_\327\371\025\321\025\277\356Oap4z\264\327{F\225DB\366\226;\005I\006g\007\235\007,~\033\330B\257\205\332/\024\003\240\305\362\333\300N\353\025z.\312r^z"
+	.ascii	"\344A\r \032W\f\021p\343\331\037\364\003\353\203\376T\246\177"
+	.ascii	"{\275\277\350B\220\363\233Y`T\230\306MC\350\355E\200$sL\032\327"
+	.ascii	"X\037\364\330Lz\254%=\206\222\376\315\376\240\307H\322c\265\364"
+	.ascii	"3\330\037\264\255Z\206e\006\365U\320i\231\2319/w\202X\372\266"
+	.ascii	"\336\032\037\233\245\267A\350N```\240\rB\217\307\322c\252\364"
+	.ascii	"\267\331T\330\352.\214\254\361\357^\372\273$\375\025\222\002"
+	.ascii	"\321H\177a\244A\366\007\375U\221\276\321\244$\220I\337_\322\313"
+	.ascii	"\351\245\307\233K\337\024\222\362X\037\364\177\366\007}\207\245"
+	.ascii	"\357\252\364\0260\275\365\222\336VIo\231\244\034\306\370Y4Ne"
+	.ascii	"\200}V\214\335r\357\246\270\240hl\227\366\007\005\n\323L\243"
+	.ascii	"\373zkl\233m\301X\276\333\246\375"
+	.string	"\362\020B\034\307\3116q\316L\326f\240cm\006\347\234\fLEP|{$\375\255\227.\033\320\265(S%\317Z\261\\p\366\306l\305hl\271\374V\317b\261[lW\316N9\347\013j\252\236\2605il\263\330=\313\334`\265\344\035\033F\254\211\252\361m\221T\0059\333\r\250\r\f\264\033P\020\354\017\212\256\t\335^\271rtOg\032\343\245\375A\377f}P\213't[\305\007\235\272Z\346\267\234\363\316\211%\205\006\216\3067\326\007\375-\225\r5gLb\2501\345\356\372\210\n\263\245\261\035\2120f^\343\333\261\364\277\255\263Q,\323J\261P\3542\347e\316\371!f\260t:J\236\334dE\n\210\020BX)\266\211\245\273\313\262\032#_u\315\234\227@\036x\260C\203\207^\f\024\337\202\245\267+R\353\304>\261\314\001\330\271\207\020\342WI$\253\345\274\334\311I\203\226\306L\343[\246\364v"
+	.string	"\250\r\264\003@\237\202\364\267L\006\260\263\264r\001\326\370\267rv\tN\324X\035\230\306J\200n\206\304\240\345\251\361M\244\007\261\264n:L<\331\251IKY\316\313\377\366\210Mb\231\026\2115r\373f\341\336\313\234\2319g\241[$6\316\272\335\245\\vj\252\302"
+	.string	"\266\271\247\255\277\234\227\036"
+	.string	"y\200c\025\307e\006\305\217@\312\301\376\240\330\372\240\357\220Z6K\3042;\260m\267kv\310O\246e^\346\274\334i\034h\340\2124\276\006\251\216W\016q4\275\355"
+	.string	"\275\201\201\266\003\364\235\266\365Ay\354\017\372[!\277M\263j\035\\\250\026]\371-\347eO\352\344\344\210Z\343/\355\017\232Z\037\364-\3304\033.\350\370\255\215\013\242\215\003\022[\026\0056\005)t\004\316\301\265@\300\347\307+\370m\027K\346&\340|\035|\260\001\bX\240\020\374\267\004\253t\001\006\361\333\343\333\316\237\267\235=\177\277\360w\006\376\013\002\373g\213\3308\316\217q\374o[\300\r\222\200\005\376;B\243\260\177\227\357\357\n\334\017\374\266\b\211\254\277\037p=p\233\037\303\360\202\004~[\244Q\2347\277\375\372?g5\2706\277\345av;\360[\257\016\374o\001\354\032~\034\370\267\007\227\003\033h\023X\016t\340\371q\006\376\306\313k\275\337\272\270\033\330\273\032h"
+	.ascii	"\334\f\374\227\205"
+	.string	"\337\002q\320\301}a\350\277\024\370\b?v\300\377\271\255\3469\357\004\376/\351\234\313\363[\f$\340\277#&p\f\354\320\n7\300\217{\376\216rQ\210\033qE\374v\002\215\346\3748GK\231\006\272\016\270A-\200\253\341\267J\267\204\267\341\017\377\305l\351rG\370\017\006\003\277\033\364\266\353\344\202\370\333\004\032\330\020X\240\253\201\360\177\0077\204\337\246!\005\360\343,\277%s\023p\235\037\337\375\375\3677\340\177?h\020@W\203\366r;t\021G\371{\203\021\314\375\315\241\217\360\217\231\330\265\310\365\340\267A\177\213\271\b\370\255\325oQ\374\326\351\277A\277\205\361\337\016~{\365_\016\376\036\376]t\017\360\333\254\276\273\0334\007\255\345\357-\177s\371\257\001~\233\202\n6\354\f\350j\320[7\203\337\032\177\353\201\313\341\267%\370\355\360\026\340\267H\2775\361[\0349Z\260,:\370\017\364\237\203\377s\227"
+	.ascii	"\377\275\340\357\016\374\247\300\217\317~{\343`\340\360\356\177"
+	.ascii	"\331\346\352"
+	.string	"\316\377\372Xr\364\307f\377\243\374\237\341\277\3351\370\317\201\273\007\377k\003\203\253\341\366(\375\217\373\217\344\177\3339\360\177\311k\376\213\325:\227\347\356\250\370[\005\377\325\2719\277E\300oG\370\255\b\277u\300o\033\360[\017\277\375\340\267$\374\026\002\226\203\337*\340\377\234\345\372\317\177\326\374\335\343\357\263\277\177\374m\366\367\216\277}\374\215\326r\315\365\267\216\277\311\376n\372/\316\377\235\377\334\372\357\315\337f\376\006\374\333\357\357/\177s\371\033\313\337y\177\343\375=\345\357\272\277\233\374-\367\267\222\277\335\376f\376\255\366w\220\277W\374\r\365\267\013\177\223\370\273\204\277Q\374\335\364\367\n\376\356\360\267\t\376V\372\033\371\267\361\357\342\337#\370\373\350o\365\357\017\374\335\201\2777\360w\006\376f\341o\013\374\275\302\337)\374\035\201\277!\360\367\b\177\203\370[\350o\017\177\177\3607\007\177o\360\267\006\177s\370\233"
+	.ascii	"\177c\360\367\005\177o\370[\303\337<\177\353\374\235\376\215"
+	.ascii	"\3766\360\267g~[\346\267\177\277\365\373m\230\337\202\371m\227"
+	.ascii	"\337j\371\355\225\337\342\375\266\356\267N~\213\344\267\036\370"
+	.ascii	"\355\360\2678~;\343\267&\370m\362\267#~\233\302o\267\376\213"
+	.ascii	"\371\017\346\277\226\377\\\376\333\375W\362\333\"\277e\373\355"
+	.ascii	"\220\337\246\375\366\354\267.~\013\364[\037\2775\373m\216\337"
+	.ascii	"\336\370\255\215\377-\374o\373?\367\333\260\337\202\375\226\353"
+	.ascii	"\267Y\277]\301oU\360\333\024\374v\351\267'~\253\364[\344oK\374"
+	.ascii	"v\002\277]\341\267*\374\326\204\377~\377\371\376w\371?\345\377"
+	.ascii	"\335\177\271\377K\376\253\375o\372/\345\377\006\201\201\201\201"
+	.ascii	"?N\321\237c\377\020I\001h\032\377\306\007\0312\367\357<9\347"
+	.ascii	"\246\234\271\266\3209\266\373\375\376\345\365 \213k\374\033\033"
+	.ascii	"\351\177\305\334-\327\317\372\231\200\202\212\362F+\375\215T"
+	.ascii	"z\333\264\227\357\017!\304\335r\303\330&\316\200\n\325\231\364"
+	.ascii	"6Y\322\377~\271[.\030\333\305\004\025P9W\t\335\361Mu\270\315"
+	.ascii	"]z\033&\351\357\026{\2730o\027K\007\224\225a8\244\321Xv\270M"
+	.ascii	"\221\364\326\322\241X\260\\-a\016p\307d*\350\277{\277Z\320*L"
+	.ascii	"\230\2744\276Y,\235\224\234\231\036\326m\315\354\252FX^\336\275"
+	.ascii	"bs\316\371*+\371@\350\343\373\352\361g\345\367J\023\353\251`"
+	.ascii	"S\336\031\002\2574\341\200agw\361R\\Q\371\305\243s\342\205\306"
+	.ascii	"\224\034'\201gT\246\334\335T\331\233Z\273\331+\222\242\255\361"
+	.ascii	"m\234\346\346n]\347\234sYM\234\r\250f\276\202\021\364\337(\277"
+	.ascii	"u\301\032U?\240\032_\272;\003\0307\267\255;\303\205\202[\304"
+	.ascii	"Q\315\270c:6f\370\2655\036\243D\311u\222\346\234\357\312"
+	.ascii	"\202Ok*\2144\371ub\002\312\023(&\377\203\0378\222b\215\211\234"
+	.ascii	"\024\225%pv/\352\2660\227X(8d\222\340\0056~\320I\372\333v\335"
+	.ascii	"~\215\334\310E\222\346\234\225\313,\005\024e\307W\217\277|u\025"
+	.ascii	"t\032i\302\302\274G~\221\374\213N\223>\032\314\306\367\273q\377"
+	.ascii	"\203W\217\212\356F\034\334\324\025\264:%\350\323\225\254\373"
+	.ascii	"f\215"
+	.string	"\330\364\335\b\003\243\361\203f\351\177\373\376\321\3144\225s\256:\227y\252\t\007\375\355\355im\320\237c\257\325\340?\316\331\003\244\234\231\350\304r\316VLj\266\204)\213C>\361rv\362R\232\340E\345\344%\003\212\351E\325\003\305\364\312J'2e\317T\366RB1s\356qrR\242\320E\005\305d\312=P\314L\225Q\344Q\331\274\364Rf\247\256\334\223\2352SfvQq\200r\362\242\202b2Q\365@1\275\2502\323+\363d'\246)\025Ny\252'3\275\3702\263\213\212\007\212\331E\005\305\364\272ao\250\2701\246jN,l\314V\201r\312Q.\264\230\246x\360\240\226]y/g\373\366\224\2472^\316\032\344\254\3255\265\307$\303\3125\341E5!a\352\262\313\234\363\006\027M_]\331\tOi3\036T\217\256\234{4\035e\0279\347,\202r\211\227\307,\236\022L+\267x\3129"
+	.ascii	"y\231\263\213\234\2256\343\345\234\2259\347\232)\255e\3163x\240"
+	.ascii	"\312\\\270\310\371\n\310E\326R2y\312\271\337\266\310QA1\277\272"
+	.ascii	"\204\230\2701\313r\212\245\322B\265\350\312ey\317k*e*\331r\213"
+	.ascii	"\234\263\355K\313\250^\204\271Ejl\264U-\033?\250L\377\273\374"
+	.ascii	"%\362_\266\336\272_!\270\021\343\005\225\306A\353\203\3324\241"
+	.ascii	"\337\345\216\225%~j\366\016\261\314;\344\232\235P9S\201\260\203"
+	.ascii	"\211V\007\033\253\033J4\215\2376\323k\226>\245u\035\004\245\324"
+	.ascii	"pP5\276h7\210e~\356\246\345\235\035(~1\3105~\252$]\3129g\373"
+	.ascii	"9\264\346s\350\177\317n\231\367\354r\231\360\226\263\214\240"
+	.ascii	"5\276\033\260 _\326\032?\035\222Z\346\365qs\244MP9W}\220F\365"
+	.ascii	"\325\343/O]uh\"MD\2604~:#\375o\217k\026#\352\n\f\030\035\\\f"
+	.ascii	"ct\374\362\370o\331\335q\277B\220\343\326\306t\245\261\025\263"
+	.ascii	"?\350\217\365A/\231\320\257\2164\r]\324Xc\013\256\f9,Y_\216\346"
+	.ascii	"\211$\253L\036\216\033s4\356`4\276c\030\213\312mH\343\247P\351"
+	.ascii	"\265\201\303d\245\244J\343\327\004.o\344\270\340`4\376o\030X"
+	.ascii	"\032\214\0329\226j9\347\235 \0233>b4\2764\256\327\357\327\355"
+	.ascii	"\312\367K\204\256\234\231\356\327\316\231\234\231v\254\315\300"
+	.ascii	"\332\fp\220/\035q(~M"
+	.string	"\231\364\2771\\\256\032h\2001\032\337-\240\035+\2007p4~\r\230\364\277Z7+\bE\312\231\214\3063\226N9g\240SJL\224\227\306\257\231K\017\202\305\215\322q\342\311N_R\256\325\215qe\\,\313\274WW\352w\252\233,\334\275\272+\354\356\325\245\2720.\333T\032\3675\245y\257\256\362\252\270\313\262\224E\323]3\347\\\003\203\013\036\022\033\\u_\364\031*Yv\300U\255\2458\326\007}M\330u\021\354\232Q\204\251\361k\266\322\333\242\306*}\315\023\024\216\025\021>\253\306G\311\334\247\213\3022o\212\333\344\264\244,\347\345Mq\231,\235\216r\231\245\026\2007\246\f\220\263\b\220\027\201(>:\227\036uK\217\252\245G\177\244\377\315R\272\251%\305)0O\207j-F3\r\032$N\274\344h\334h~K\246\317X7\2661\246\227\306\235\355\017\332e\204\336f\3204\200,\336\032\357"
+	.string	"\376a\276\037`b\376\032\253\321\276-dY\310\004\345"
+	.string	"bi\002\322c\332\317\006\b\036S\337r\231s\006\312\321\321\224\022\023\303W\326,\322\230\257\265\biN\351+oM/\335\245\301t\230\376\322\315\356\263\314\346\353$\357-\315\345@\313\234\235\370zoH3p\206\276\013\203k\352u\026\022\236\246\202Q(\326\232s\367B\302\323T\360I\357H\223\f_\3235\024\213w\265\314U5zqOO<"
+	.ascii	"B\261d\341\321\307\203o\266?(\b\326\007=:\226\036\315J\033K\223"
+	.ascii	"\033ZR\3245>\n\225\376<\223\327V\252\364\231V\227\027-y\2572"
+	.ascii	"EfE\212\306]\205\356\242\201\021c\206\312\377 v\262\263\261\205"
+	.ascii	"\312\225\350x\241YvEi\273\272/X\240\2464\376\331\226\3362[J\235"
+	.ascii	"\022\213\026S\343\256k\2361d\310\210k|?\035\273\275$5\032\377"
+	.ascii	"\354\001\305\272\2412P\2309\322\370\247X\372\223+\375\373"
+	.string	"\211\023\001\260`A\326\370\226\331N\232\034\315A\2751y7q\303\311Y-\347\214\301NT\336\024\030\215\033I\313\375\017\326\350\340JS\223[R\007\027\207\266D\273\316\354\215i\374\3372[I'Yf \354\244\315\016\255\361\317\026\351\375,\335\377\340\3715\246\313\222>\322q7E\306\254i-\203d \363\002\367v\026\251\013\302\324\270\337\216\211t\345\\&\253\273%F\332m\331\205\206\246\361\337E\272\315\242\370\342\242L\343\356\262?\350\006\326\007m\"B\357\":Thmq\215{\232\355\n\227\034r\215o\325R\240\220*\313y)\364N\353\030\215u\331\246R#E\322\f\261f\364\270\002a\004\226\201@\243\3257\372\254}\364\220\356\321j\375\243u\264\f\215\326\313\016\3226z\254\201\364\216\346\3218ZH\257uY\233u\216\026k2\313\354\264\006{\207u\215\343\345\033JET\323\006\366\323\025\234\013\026X"
+	.string	"\307\232irXV\023\356\267dl\031\261&\031{Fo\253Q\374BZ\226\316\212\231\300\236\352*\025QR+zF\326\231V2\351\315\350\264\356\352\257\273,\013\246\370\372k\346\234m`\247\265S\232\242\r\253\231\363R\250\271\254\224\t\361\242\253\240,\031\373\247w\243\003\370@d\351\023@\304\212\212\2521\352t\303P=\"wHP\345Q\246?x3d\356\311J\343\003\325H\317\300\243\371\017\332\032Qxy\215\017D#\375\3174\177\020\207/\207\325\215\306\007\322J\017\024\303\214\031 \301+qL\276\306\007b\"C\346\004\264D\262T\2100c\232"
+	.string	"\271\343\021E\346\357' \266\262\206e\357\202/\315\346\351g\333\362\322\204q\003l\343\023\363\323\357\306\214\325\223\\\343\223\357\354\373\037l>6\030h\372\302\270\240\341D\252\210\b\230\217%^\274\234_~\2352WZY*\303\fM\305\227+\326\205.\360L\343_\360\266\267wrA\21541\023\004\333(#d\013\227s\013 V\027\232\306\247\226\2420#O\032\377\002\260\364\027l]\271rbY\233\032S\346O\307J\215\025,\364~bi\3564\371\310\221$\n\210\027=\254\306\277\200E^\336\375\263<\313&+A\312r\276\n\272\241\022\327F\006\006\017\357\376\001\235\361\030\323\204D\037\013\2743;\273s\212%\222\245\204\230\302\210\001\222\363UP\016\225\252%T\347\335\317)\315\034\2776\274!X\377\203\350\024\2513e\032\037"
+	.ascii	"U\351\223'g\235%\222\245,@\253\0023\345/\347\253 \033',>\256"
+	.ascii	"(?\353>W\303C\213R\206\306\347\f\237\353r[\202\325\370\2042\303"
+	.ascii	"\306\213#\215O\272\324\f\334\332\225\306\347\334\347j\244L\371"
+	.ascii	"\212\341\247K"
+	.ascii	"\372\237M\316&\215\025\004\205\351\313\217\036\031\360\316\032"
+	.ascii	"\377'-\375O\271S\356ra'\236\234\277\310n\234\240\235\221\322"
+	.ascii	"\370?2\274\375T\362\226C\2045\276\264\212\025\213\306'\2223\311"
+	.ascii	"\2218\270\237\254\364?\335N7\034\345\244\247F%l\017\320\314\220"
+	.ascii	"\237\314!g\020\021<\331\330\b\213k\346)\255\016(\017\256>\272"
+	.ascii	"\306'\221\263\310\311v.\3175\013\354\322\377T;\325\260\226\t"
+	.ascii	"b<9\207\331\311\345\251\253\016\301<\265\"K\032\337\002\264\364"
+	.ascii	"\026\315\236-~\3168\263N-\313<[\234A\204\2322\023\022\020\244"
+	.ascii	"\260\265\023\232\326_c\264\032\026XG\336\032\337\202\034\351"
+	.ascii	"\255\332\326\031\303^`\327\311\205A\023\324\njT\232_g\230\305"
+	.ascii	"\0233\341\207\235\215S\207\305\273\342\311NJ\2724\325\314N\032"
+	.ascii	"'\227\216\262'g\260)e>N \347\331\331\343\344q\376\260\314\323"
+	.ascii	"\354\254\3613\353\324:\320\220\323\354\364\262n\026O\314\004"
+	.ascii	"\265\273\346\r\026?\035x:x\353^0h\202Za\310\226\346\251\343\024"
+	.ascii	";\311n\222\360\310k\376\235e\347\016\313<u\034h\231=\360`C\216"
+	.ascii	"\031-\177CP\374\237d\247\fr+\262R4>"
+	.string	"sX\246\024\026`\215oA\213\364?oX\346\211c'\005\0174d\215\317\261{\301*\224+X|.\006\223\264\273\306\267@Ez\013\232\322\373\2149\301R\275\346\326\224\306\367i\246\367\351\222\336'Kz\037*\351}\352\322\377\214\341\344b\326\211\231\302e\345\256ES\343\373\320\245\275\264?h\220\365AO\253\363\352\304\372\203;A\344j\034i|\037%\351O\031\377\203\026\270A\345Hcl?\207\2360~\306\370\203-EG\231\213\306\367\201K\177V\235/\376\240\316\036\031\034[\343\373\260\245?\251\216\004\212\301j|N\245O>f\035\330l)\211!\353t\361s\352?\243N\251\373u\202@4d\032\177\317\376\2409\326\007\275SB?]L\241k\372P\235+\316\025'T\260\2043\034e7=\360\232|i|\237\234\"\305\tu;5\003\355\253b\363\354\232\340\032\237P\177(P`\265T\211\246)\277z"
+	.ascii	"\211\312\361\342\252\3615\354\235\312Sy6a@\371\325\003H\372\002"
+	.ascii	"p\017\356d\372\331\364\203\252\fJ\303\\\n\b\210\003m\316gU\256"
+	.ascii	"\2175!:\322\034\007\006\377\262\220\3645\306hnX\360\357\217J"
+	.ascii	"\2223B\214\004\361\302g\260\231\253+r<\356V\331\334\331\035."
+	.ascii	"\323`]{b\366\032_C[J\206\314\230\237\237\017>\rV\315&\356K\231"
+	.ascii	"\324PA\341\332\303a\216\3736\340f\026\2461\346\273b-\274\232"
+	.ascii	"p]5\033\037`8z4\276\006(\374\005\177\271\177\\\322\250Uq\262"
+	.ascii	"\326\370=\200)\356\202\273\334?\007\034\001\223\245\006\332\225"
+	.ascii	"\306\357\321\262e\013\336[A\b\215&\247(+\215\337#\227%\013\336"
+	.ascii	"[\341'\215\311\211-c}\215\367v\230}\265h\374\036\265\364\307"
+	.ascii	"T,\023S\301z&\274ue\030AB\246\306\224\371\313\371\252\003\216"
+	.ascii	"\325\025'<l\345X\357\307x\270\n\276\322\251\036\231\027a6j+\r"
+	.ascii	"Jc\234'tl\345\346\210\0244:\032\373X\037t'\333\037\3246\255\017"
+	.ascii	"\372\036\031\351\217\357\356\032\353\254'K\221r\377dT\361\362"
+	.ascii	"\246\027\330\370<\200Q\242\\$\037\340\373\352\001$_]\005\325"
+	.ascii	"\354\200\322\234\241\361y\2364\301tM0\024\f\305\211\023<Ge\307"
+	.ascii	"W\217?\234\260\266\034\312'\307s:jsM@\036\270\364<grrfJ\236\257"
+	.ascii	"8\254$\016'9r\004'\351\334\225sY\315\f>\256\232\371\352*(\r\263"
+	.ascii	"\333\361\002\211e\342$gZ\023\236\253\364<O\351\217\215`!\370"
+	.ascii	"\255\321\3600y\345`\017\2632\315\2352\351w\272\244\314?\204\020"
+	.ascii	"X\bn\263t6?e\030\312\314\314\330\245\337\211K\337V\026\263a!"
+	.ascii	"\230H\220\315U\331\252\350av\306-\375\316\022\b\026\002\004\257"
+	.ascii	"\r9^\273\273a\306DC\303jcP!l\037\370\365E\245\035\253a\035{7"
+	.ascii	"\2564\306A\254\033\233r\207\036\363\1770\330\347g&\255\361w\310"
+	.ascii	"\322\357\304H\217{X\374\343Gc\331\2514\356\013\255\271\223\323"
+	.ascii	"\333\306B\177\267Xlff\351@\250\211k\n\322\f\223\036\353\260x"
+	.ascii	"\007\336q\305V\310LU\033\370\250\222\336^1\224\214\314\254\212"
+	.ascii	"\316\233\030\316!\206q\214\215a\034~\350\016\345\316\023 Mm7"
+	.ascii	"\216q"
+	.string	"\004\323\330\235\315\020\373\037$\232\273\361\327\370:_\351s\310\244?\256\301\3045\372/\350\254\n\0134-'\215\237c\005\f\214F\222\364\366\213\305^^\266i\227Y*\304\216\257\036@\202\340\256.\333\004\312J>\020|\344\214a.\314\365bGN\212\254,\254\305\264\305A\n[\026\031S\316`\255\273\020\200IQ\206\245\361q\362`\340+\030\030\013\315\331.\273\244\2460\226\r\016\266'\032\215q\f\034\003\313\260y\312\352XF\315\212\274\245\f\034'\351q\204\244?\256\302U\226\316\362\344&+9\312p\310\322\037O\341\251v\013r8c\303\021K\177\274\202\211W\340(\233\231\344\\#\253\204(4v\274\264\211Y\342\3428\352\267\201\230\205]b\273rF\222s\276\300\204#`:\032\343\026B\307.J\300\001\026\244\361\265>\250\315\366\007=\316\023\206\302P\367\317\210\016\300\346M\027\254\304J\374d\315\260}\365"
+	.string	"\202Q\034?\345\220\255\255h\321\030;\005o\354r\214M\341\246\363\206\227\234\036n\302L7UMc\362\027-/\032\377\006I\372\213\306\336@\346\r\264n,\244+\276\244\2327F\322[\353\206\376\367\214e\3363\227i\302[f\242\"\301\214m\206\0167flg\330\032\377F-\375o\031\346-\323n)\n\250\234\25168c\222f\201\271\022E\304\242\360\005\025YTb\001I\304\371\221\007d\221\230T\252\t\001D\022\322\360\3741\022\205k\022i<\016\203@-$!\r\203@\351\217<\030\031\211k\022\371A-R*\016\215\304\017+R\351\003"
+	.string	"\212E%\243\361h\2541\301q=J\036\2155&\204j\021\253\253R\022^\217\206k\022\211\016i(\2614\344\363#\017IH\244\017K\253\005I\242qD\022\222\304\322\032D\036\327!\021\t\375\221\007\025\211\230\374\200\\\325\023\304\265(I\204$\201$\026\213D$4\205\027F\264 \342\004\242\024P\270"
+	.string	"\t\"\021CD%F\364\b\340G\036>\230\030@\221Z$\n\215\0270\261\341G\036>\030\021M\0301PW\245\244P5Q\363#\017\310\243\244\020\351\203\361\210\204t\034\006\300\346G\036*\320\302\210\022\037\222\252\321*Lr \301\360X\024\241\256G\021;0$\035E\344\364\024\200"
+	.ascii	"0$\035Eh\220\374\221\007\243\244\017FIC\243\322\215\321D\237"
+	.ascii	"H\"\243$\234$\221\321(\3514\032%]\365\004D$F\"\325\265\250HX"
+	.ascii	"\003C\322q\210\327d\322-R\215F\304\242\260\246HE*a\343\221\230"
+	.ascii	"\034\252\310\232\257DFI\036r`X\223H\242\221:\224AR\225\300\322"
+	.ascii	"\312cT\243\302\216\006\344\220\212\\\205I;0\254Bb\221\270\244"
+	.ascii	"$\024\200\272\036M\250\021\320@\202\241z$bi\315Q\221\224\220"
+	.ascii	"\352\252\263\243\256',\255@FF\"r\304\322\352\263\001\322\005"
+	.ascii	"\030\204E\025\205%!\tU5\002 I4\216XZQ\344\252T,\236\260A\017"
+	.ascii	"\322\205$$\211$RX\364"
+	.string	"IB\222\260IB\222\270\001\301\0032gG\310\003\021\211\\{\220\224\2207\004\017HJ\310\263\247H]\325d\221h\302\350\002\021\211\034J\252H\240\"1ita\250\310\250&!\225\220\026\f%\021I\200\314A\272\220<!\271\244Z`i\345)RW\242R\t\324!##Q\230\024\242\260\264\002m\340B\221\261C\321\221\270\252, \213J,\024\021\213\302\023\306\021\303\325\247\210X\024\276\220<2\"\026UXZ\177\324\242#\t\343\b\344\210\245UC\221z\202\250\016\325\241\245\225gU:\022O\b\217\324\b \221\307\n\024\205F#b\211\"\343\t\311\241\232T\2132\330@\007\004\017\311U\230\344AU*\n_(\022\205&\226\206\222\252\321O\322\250t\024\241c\002\341\320p=a\020\256\353\t\031 U#\243\360\004d\221P]7\030\217I\341\2524\004C1)IX"
+	.string	"\"\022\271b\033\224D\006X\030Q\242\304\220\232\024\026%)\345\330\200\360`\024\252$\204I!\n\303\025G\203\b\036\212\324\344P-\026\217\"\226V\013\202!< o\324b\022\222\260\304p\315Q\215\204\253z\342\004##\361\304\221DRXT\032\026\205\303\001\024\213JF\236bQ\311\270#b\250XT2\346 5@\022\031UH\252Hu\310(\251"
+	.string	"\037\022W\325\250\032\245\027a\204\004\214@\302R\315I`"
+	.string	"\b\f"
+	.ascii	"\001=\t\f\020\022b\300\bB\351G\020\272*\221:\\\225\216%\220\253"
+	.ascii	"\232L\252\025\030\256<?22\241\026\rE $A\001#\204\020\001D\bB"
+	.ascii	"-\f\245p\302O\222H\230,\252(\334 \251I$\f%v>\334I&\211\220.\244"
+	.ascii	"\253\360h\210\223\311\233!\321\350X\001\265\350\210\024D\022"
+	.ascii	"\031\217\304$\261\310x\024a<\022\2216\250DE#\226\216\"\250)\032"
+	.ascii	"\241\026\035\221\320%\265\3108BI\270\223\374\221\007\244ZtD\""
+	.ascii	"\032\256\037\206&6$\251\311\022EF\265\006I4\324IR\223%\222\253"
+	.ascii	"0\211\f\252FF\341z&\215JC\0345"
+	.string	")\034:B\252\253\tuhi\315Y\223,\030U\020&\205(\230@8T$T\207\206\353\315\232dA\203Q\005\244RR\230,1\\w\326$\013>F\025T$\341\252\002\022\251\016\217+\013\303\225G\230\024\242p#L\nQP\221\204\253\211 \0221iT\032ZZ{\226V\233$!\322p=W\265\210x\342\270&\025\251KkQH\\Ud\317\222ZLRB\301DQxdS<\016\217\311\343\232\264\223$\n\001D\0211\2304*\035\207D&V\"b\022\222hi\275@-\"\256\253z\342Hd$rH\022\325\030\t[8\022\211\214\224\212I@=I\025\251\256\307\244\222\220\250\310H\024\001QR\210$BRZ\223$P\223\220\002\300Q\213\302!\322&\271\252'\214D\"\"\022\271\336\f\327\"\"\322i$\"\245$\030\252G\303%!R\272\203,\nO\030\217\304\244\260xLZ\325\244q\304p\275"
+	.ascii	"\251\252\253\221\212\202Z42\236\200$\024q\"\311\204\206\242\342"
+	.ascii	"\361\b\251\256G-\250I\341\tbrx\202Zt$\261\022\205@F\342PE*\021"
+	.ascii	"-\t\221\210\226\326\233!\321\222\222\220hI\210\264S<\036#@t\326"
+	.ascii	"$\223\324$\022\253&\204\310\"Q\250\302\322\272!IDB\322HT\252"
+	.ascii	"Q\213\216H8\371#\237\037\223\324\365C\362x\\?\334,\t\221.\222"
+	.ascii	"\310\210h\302x\024\241\032\031\205CE\325h\024\036\211X"
+	.string	"Z\001\220$\032A(i$*\245_\300\002Dpp\301\002\022H\207\036\226\326\017K\353\007#Q\210\364a\270\"?x\320`$\"\335\377h\025\024\257\315\246d\trU\346\224\206\n\2062%\211\316_\235\236\212;\274v\316\035Q\212\331\241,j\300\220<Q\221\202q\2444j\224q\252;\261\360\005\031\223#\312\3252W\345\210\325\f2\302\364i\031\362\344\tJ\027\314\034\374\252\034\235;J\207\202YQ\225e\203_\232$\t\332\244\004\264\027db\226\034m\2022q\202\273\202C\345\354\030\024\345X\343oh\222\242J\032\313\312\214-Y6 I\227\026\\\235E\035\301O2\232WY\032\243c*d\275p\342\346\206\276\205a\200\025/F\216\276\341\2464i\346\312~\244?\332V\227\005\243\nlm\r-\022\346\003&y`\246\0209Zd\356\251\213\230\274\306(\033\272\314\221\376\350\020\214\305A\212\026r\215\201"
+	.string	"A\325\372\f\3204\345\351\t\332Q\265\264fz\251\210\202\246\241A\202DZ\320\b\262\034\263\353;\262\341E\212\372@\177\034=;z\326\350\331\r\fD\205\\1\202\342\037\355q\305\354\210\234\241k\214\352@u\240<\202:\\\232l\204\331q\224\307U\333\331bc\256\2561Zv\305\362\322\310@\006\bL\372\243d\367\017\303a\211}\311"
+	.string	"\210\231]"
+	.ascii	"\321\3448\277\330=04\034\314\261<(\2017N\2770n(\3164\226\222"
+	.ascii	"\302\321\325\270\325\2247\310\032/\2319/std\210\032\333\252\201"
+	.ascii	"\365b\370\002\342\0256eg\257+\254\005\330\311\345JY\342\343\354"
+	.ascii	"\013+\205\373\202\307\002\365\272W\202\2745q\243\201w\327\220"
+	.ascii	"X\215\351\252\003R\243\256\r\305:\026\312u\rL@@\02025\246\f:"
+	.ascii	"\343(\027\272E\265\026\346\311\026\2525\303\310\217\270\0316"
+	.ascii	"\fJ\212*4\353J\331)2/\364\200\350P\030(\fT\206\235\232\002\021"
+	.ascii	"&\303\323\223\277|\005\003\225\361\207\020\002\265J\325rde\241"
+	.ascii	"Vh\f\364\354\254\212\025 \"f\\\215\017\224$\375\321\027X\213"
+	.ascii	"G\323\020\273*'x\005\032\231\024\025\216bA-\316i\352\"\301\271"
+	.ascii	"B\361\306&u\211\260A\215\211C\243p\340S]\fz\250\213&.' {\215"
+	.ascii	"\321\034mB\203\262\270]\322\254\\\346\253.%\037\th\270|\331\375"
+	.ascii	"e\250\253\240\032\246\0311X\215\177\024\305Q\026GU\204\020\002"
+	.ascii	"]a\343\312\221!\350\212\373\225\302\217,.\215Q\250\353\\\335"
+	.ascii	"5i6>\372\204\246\370\2036fa\314\263\016\205e\250\263\221\343"
+	.ascii	"j\\,\346 &\235A\312\020\t\325\246\031\016\243\025@@@<\034\024"
+	.ascii	"\214\307\315=\023\200C\312\313\325q\036\347\230b\206fDDFR\222"
+	.ascii	"Tv\016\344\022`\0040T\033\f\266\320%\242\363na_\374\021\037;"
+	.ascii	"\\\025\341\371^\216\316`\234T\247z\037\004@p\342\223\247\214"
+	.ascii	"9\253\032\352\003\251AI\2732\334\3353\205\244-\326\312q`\355"
+	.ascii	"\f\255\\U\233\006\242\302@\360\252\177L2,\255\352T\305\266\261"
+	.ascii	"\0032\327\230Z\005~\304+pB\204\022Kk\031\220A\fko\200\230\257"
+	.ascii	"\266\344\371e\215\2574\235\004eqF\031\345\321\360\204d\276\374"
+	.ascii	"\232o\306*\251\325\367\266\222$\211B\260\254\033\256\246\316"
+	.ascii	"W\301\031\016_O\303\327\027\233\344\234`\211\020\n\221pp\034"
+	.ascii	"p6\365 ;\001\316\033-w\032\320\353+RP\245\257`A\341m\022E\222"
+	.ascii	"\327T\264Mj\337\331\n\271\221\246\001\300\324\313\313\350f\262"
+	.ascii	"\331\324A\264\260\207\364S|\335Or\250\034~\232S\023XB\245i\324"
+	.ascii	"D\355k\265\3022\217A\337E\226\023\230\201\246E^\211H\305\016"
+	.ascii	"i\246\270\030a\233\2250\251\304\315\t!\310\352BZ\237\267\203"
+	.ascii	"\001\226\341F\022x\353\226\322\273;a\266\371\336Z'\233D\305\245"
+	.ascii	"\201\240\306\374\215m\205\330\r#\342P\213\216\302S\306H\331P"
+	.ascii	"\222R\032"
+	.ascii	"\n\333\223\262:\233?\203\035(NR8\347\333T\213\034VWI\256\037"
+	.ascii	"\323\235\307!|%G\257\022\246\326|D \302\001\316\025\341\360\304"
+	.ascii	"\250\321$\234\310\2270\270\036\221K3\023\016"
+	.string	"\250\rP\310m6\033E\002\317\b\266D\021\026\202m\363W\202\356=\322\241wfg\350\307\035\242\343\257\205v\244!{\227f\030yM\334\327\274*\217\f\224\t-J\325\221\372\f\370\226\223\267\236L\370\"\302\017,W;\271\274\367\312A \026%\220UJ\344\220\364}\207y4zKp^\257=\220\303f\310\007D\017\232\252\251\032\334\353\210\253uN\212\255I\215%$\374\327\343\310\227x#\357t>\241\323c\2505\273\216\034~;P\366\232\301\252Tm6\007\214\350\310\241\213\206\002\233\216\330\002lu\211Z\353\021L\235q\037\211_m\326ms\036\250\355\336\023T\325\226\025\364\\\326&\375Lw\350\326\336\247\270\327\\\303\034,\323_L0\226\202p\342f\360MX\rD\354K#\250%ml\021|\214\036\020wj\023\335\030\017\243\235O\037\351\202Eqs\304\231i\364F\033%\326i\316\366\213\240\337\213\216"
+	.string	"\bZ\313\244\243\253K\206\016\366\242\263\024\223;\277\003\257\274\306up=(\270d\201\361C\255~\360|/\350\3756\351\215)\313\205\316\\\2736m\232\350\301T_\355\205\013\206Q\3279(\264\240o\372\345\274\347\317\310[}\2705\005\251\362\337P?\206\270\006\3530\0300\332\261zK[q\376\221C(\352\372\247a:\035R\232Y\017\225\371L\331\rL\223\337\305\370\273s\252<\214\270\315\215{\005\021-Zj\367X\277\201\334\217\245\302\314\236\311Kq\205]\272\236\326c\021\246g\006\244_:\255\034\212\275p:;\314;P3f\345`\331\306\207Kk\b\246\351|\001\332\315\021\311\303RlM\272\366&\202\334\357`i\f"
+	.string	"\234\331\212\273:\013\263\250\341o\244\233\324\274D;\204iTout\341\341DK\217o\326?\220-T\367\270\264<t/\fS\205C^\250x03\327\202 \215,\226\371tW\374;\016$\265+'\232J\373P\t\2445\232YK(\245B\037\250\345\003\024V\r&\266+\356j\252\205\232\252kb\204@\216\246\f\331\301%G\001R.\032\254}\252\350\224\306\fc\260s\023c\031x\257\334\215{"
+	.string	"5\366\371\335\311\332#\374\314\362\232\206\372\201R7\233\r,\030(9$\036]\027\341\300\b\372b\256\241!\200\221Y\211T74\324l\331K}\354\021\bFGN\224W\304f\016AM\206$@\035.\256\206\361\341\026%S\303R\341\300\225 2"
+	.string	"t\244\305\251\343^\322UC\307\241\363XRE\347\220R\251\375\324\027`A"
+	.ascii	"l>ff\313\322\005{\022Z:2UJ\t`\270\274\f\216\241x4\001x\237\310"
+	.ascii	"mGB\007\335\330\205yw\231^X\322\250\221\344\001>zd\270\005\200"
+	.ascii	"\020\200\362&\306\272f\205M/\255\322\234\2306b\200\223|\315\306"
+	.ascii	"\370A\343\313\343M\370`J\214\345\201j=\210Zs\312\0224\224\371"
+	.ascii	"\273Ozk\230\016\363h\247u\312\307\225\244\353+\211\207\220\310"
+	.ascii	"D\271\341\325\006\3618 \002GLO9LGB\305p\356\0307\262pc\275\217"
+	.ascii	"S\341\2271\202H\306\334cmLN\356\r\3753\326\256l\242\203x\b\211"
+	.ascii	"\254'\326\016\236\f\\\007\316U\377\353\335\217\326\"O;\220i|"
+	.ascii	"\202\301\324\374\256\f\024M\2627\306Y\360D\025k%J~\377:\026\231"
+	.ascii	"\364\263B\340\263\250\020\231*\025$\314UAH\217\f>\332\342\343"
+	.ascii	"\226\255\262&P\205 \340\307%\213\311I\315\026\034j\327\017\302"
+	.ascii	"\253J"
+	.string	"\243\374}(\366\265B\203p\260\315>/dz\365\f\240)\006GR\364&\275\224\325\270{3\026|I&\360\236`/\327\205m\221\312\305\303\271\264\344\310z\252\226X\277\b\210\324\375\262\027\271\364\327\361\361)^\325(\201uE\020%\372\t^@\312+}9>d\273\027\351\333Xt\307\225\273\356pf\232\357\3050\214H\\\250\240\222\023\347@4\2627)`\332\324\275\030\245v\021\362\304\371\337\255\033\310\316r0X\353>\203\362\016>`G\377\004r3\214\025\007]\274'\246Y(\227\350\310\233\034d\322\2552W\265\344\262g\377\2719\006\231_\022\340\324\030\305L\277\377\027\222\221\234\305Z\275\222\3768-\263[,\312\250\350M\313\021\205\251\301<o\361(\251\356\253\265H\200\302\334\233\250,\312\365@\262\234U(\367ZC(\020\033\315\035\234E\335\351\2755)\r\302aE~\3478\024v#\267\312\352\017\347"
+	.string	"\315\321\034O4\035\312\277\312G\254A\326\236\312\302\360LP\"\314\205\025M\r\f\b\340P\312\005\242\230\260\362G\346\026\270\322\355\201?\322\307%\217J"
+	.string	"\023\234\350\226i#\231\234\253_\3408bDF|\212\3002\344\202h\327\203\244$\006\337\023\222E\373\030C8%\313\347\0251\017\315\215\241\321S\361-y\257\032\217\376q!\353T\377m\270.\365\243:(\230\302AY\274\357\261u\272\022\371\016\030\201&<\034\006\023\344;\005P\221\304;\311\350\026\260\375\207\350\311\201)\001\302\310S\212\334\340\201\250 \333\305y\005\370\327\367\342\205U\237\362\206y\217$m7M\006\216\367\250\030\0274\332\326\3661\340\263Z.+Dz!R\303\230\035\2461[\320\340\200\251x\340\232/A\\*\345Q\261\332\006\004\365'\233?5\236\227Hc\036\310\226\276\257\304@,E\357\337@\367Ao\212*+\360\332QS\333Q\307\365\363\027\242m\3310'K9\\\204\274\034\n\270@\372\367\002\017{\003>2\257\251Bs\370\216=\020U\322\233MPb\322"
+	.ascii	"\f\026\320"
+	.string	"(+\b\241\033\233\254\242\037SL\316I2\200\0163\273XCX\204J}P9\266D\310\242\302T?\034\037g\321\346G*\313\246\035n\202.\244\210\026\256\266\033\213)\263\017\351X\002\357\001\2365\200ML\246\013\022\211\373<>W\361)H\343P\235\0369\230\027T\201\257\374\0023\220\272~\242O\016\275\206\177\004\006\226\306cF\r\025\220]i\370\233\036\277[\357\337\236|\2679\004\006\0247\022'\024\341\322M\210\203\303l\231\270=$+1\227\300\334Q]\222\212\257Tl\375\215g]N\f\022Rw$\304R\353\230CE\004\f\230\272\336\032\005\263\272ga\322\"H\263\021\333\364\2543\2709+\237H\0067q\354b\002}\363R\277\314=KC\225P<\255;\025<?At\342\374\20468u\032\233co\003\254\b\245\333\021\240\206\350\231\312\025\274=cU\264\325S\266_\370<\207s7 \361\352\211"
+	.string	"\211\b\013Q\363\177\365\032\264\301b\241\033i\257&V\275\f(\336\221H\277@K\332\006\341/7"
+	.ascii	"\322\303\307-T\354\244\253\212\200\321_B\212\314\205\371\323"
+	.ascii	"9\375^qH\312S\212\360\245f4*\013\205H\"\306\177\301\263\021\f"
+	.ascii	"\367;\376x\007S\275\263ru\201\307\351\354\322\004{\312\025nj"
+	.ascii	"\315\245\277\021\005\\\f\330\277\200`.'E\364C\331%\347(\262B"
+	.ascii	"\277?\264\214+\027\237\305\343\033\202se\231\036\343!\203f\305"
+	.ascii	"\305\003yT\273\366%j\213\204I\300\202\262;\251\037z\336\013\023"
+	.ascii	"_2\314\357\335\344\364m*\236\314xO\261\363\340\017\307'\300\313"
+	.ascii	"\331 d;.<\264\330\b\313\004\316\353\356"
+	.string	"-t>\206I\244\213\303\030<\271~\217-\020\357r\316;m\005\270\263!\334A\320\310\363\177\036\306\216\254\315\205\373\033{2\027\003\3617\255\357y8E\217c]YSae\361JFl\222\360\203\352."
+	.string	"1\025\222\277\364\342\017\023u\363n\243\202\246\324\027\214\371/\252\347\353\375\241\266=`k!T/\210\363\370\222w\245g\301\356\231\301\\\230\214\352\372\247\277\307O\257\231u\312=\275\372~\016k\260\017~\373=\217_\r\320P\367\001\333\020\221:=\006\317k\372=\305\347T\312\263\331\346\345\261/eW\030\345\342\276U\314\256pa\272u\253\r\234\307asG-\001z\244\273\345\371q\3663\367\345\203z\360p\305\343\352_\307\320\332\240\227\304\360\326\325\016r\343\n,u'\277[{y}\345\036\343.\267C$\347p:\273\271\343\322\233\375\377\325\332\366\364\325=l\310\233\036\377y\2373\377yZ\375\340ZSv.\243\2674|\362w\326\341\376L\334#\337\005\3379"
+	.ascii	"\215\233r^\350\035\373\\\177l\334\265\005\205\235\356\336\316"
+	.ascii	"\217\207\311\206\374\3738\030\026h<Puc\374\201\355\177\024\327"
+	.ascii	":=!:\312(b\266\360\242n.\252\373\013\376\331f\200\375\204\376"
+	.ascii	"]_\212q\206}\332\344\365\213\355\214\251\305\316\023*?\254F\330"
+	.ascii	"c\336\363.\304\375\316\256U\354\257\332_\337\354\225\241\312"
+	.ascii	"\n\032L,\354\203yp_!\274\374\257\252\217\352a\351CN\274\321\006"
+	.ascii	"\340\\4\376\352\317\301u\260.\274\271\364\345\bFY\301Y\263\210"
+	.ascii	"\201\206=z\371\2072k\234\351\214\204\306\257\367\321z\260\374"
+	.ascii	"\265\013i\346n\225\372\020r\r\002\336\025"
+	.text
+	.section	.gnu.lto_.symtab.c1bbe239337982d4,"e",@progbits
+	.string	"pgResetFn_rxChannelRangeConfigs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\001"
+	.string	""
+	.string	"pgResetFn_rxFailsafeChannelConfigs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\001"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	","
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\001"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"$"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\001"
+	.string	""
+	.string	"rssiSource"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\001"
+	.string	""
+	.string	"rxRuntimeConfig"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"0"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\001"
+	.string	""
+	.string	"rxChannelRangeConfigs_SystemArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\002"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_SystemArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"$"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\002"
+	.string	""
+	.string	"rcInvalidPulsPeriod"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"H"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\002"
+	.string	""
+	.string	"resetAllRxChannelRangeConfigurations"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\002"
+	.string	""
+	.string	"rxInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\002"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\002"
+	.string	""
+	.string	"rxAreFlightChannelsValid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\002"
+	.string	""
+	.string	"suspendRxSignal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\002"
+	.string	""
+	.string	"resumeRxSignal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\002"
+	.string	""
+	.string	"rxUpdateCheck"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\002"
+	.string	""
+	.string	"calculateRxChannelsAndUpdateFailsafe"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\002"
+	.string	""
+	.string	"parseRcChannels"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\002"
+	.string	""
+	.string	"rcChannelLetters"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\001"
+	.string	""
+	.string	"pgResetFn_rxConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\002"
+	.string	""
+	.string	"setRssiFiltered"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\002"
+	.string	""
+	.string	"setRssiUnfiltered"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\002"
+	.string	""
+	.string	"setRssiMsp"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\002"
+	.string	""
+	.string	"updateRSSI"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\002"
+	.string	""
+	.string	"getRssi"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\002"
+	.string	""
+	.string	"rxGetRefreshRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\002"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\002"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_CopyArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"$"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\002"
+	.string	""
+	.string	"rxChannelRangeConfigs_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\002"
+	.string	""
+	.string	"rxChannelRangeConfigs_CopyArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\002"
+	.string	""
+	.string	"rxConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\002"
+	.string	""
+	.string	"rxConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	","
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\002"
+	.string	""
+	.string	"modeActivationConditions_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\002"
+	.string	""
+	.string	"scaleRange"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\002"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\002"
+	.string	""
+	.string	"failsafeOnValidDataFailed"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\002"
+	.string	""
+	.string	"failsafeOnValidDataReceived"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\002"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\002"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\002"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\002"
+	.string	""
+	.string	"rxMspInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\002"
+	.string	""
+	.string	"failsafeOnRxSuspend"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\002"
+	.string	""
+	.string	"failsafeOnRxResume"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.c1bbe239337982d4,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
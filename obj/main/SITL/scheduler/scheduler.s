@@ -0,0 +1,1558 @@
+	.file	"scheduler.c"
+	.section	.gnu.lto_.profile.a3940a5ca6de62c7,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\022"
+	.string	"3"
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.a3940a5ca6de62c7,"e",@progbits
+	.string	"(\265/\375`5\004\205\024"
+	.string	"\226\332eI\360\262&\035\250\007\323\344\252k\027\205\024iu)\250\211J\343\360I\322\206wAT!\304\315\256Ha\326\327\354\2515L\2046p\263\310&\262\211lB\022\356\252\022\215\023\021\021\242\265h\211Z#\233\020\262\367&{K\222\210\fL"
+	.string	"T"
+	.string	"R"
+	.string	"5b`x\235\265\267\227\227o\320\246u\n\252\232\213\304\n\027\312\315yY\317\235\236\373\274\274\031hN\204\220\375\226\267\267\346E\325j\312\363c\365\332\264\177\3537I\366\b\215\254\333\025\224OJ\333\264\377\332\371\3672\204\b\301\030\205\345I\267\353\300Z\251\030\2703\"-^\005\b\364\2737\032*)\256\001\002\002\334K[GY\f\024"
+	.string	"\022\2568\306\"-\246R}\255\377\376\375j9d2*H]r\0268;t\304z~\275\367\276\033l\244p\bG\"\360\326w\225_\322`\323\203\307W\337\335\322\232\244we\001\341"
+	.string	"q\300\017\317\027\317=<w\361\375\360}\361V\374\350\341G7\371\313L\211\230\023\221'=\234~r\03200Y\320\275\243\337ll\r)\231\264'\310\315\250\240\351\020\314\217K\202\357_=H5\035;<1\004s[\3350\341\343@\277\003lWP>)\024\317t&a\006-\327}z\346\251\241\350f\310tR\\\360&\215\352&\307\302\304\360b\207\245B\310w\006\215\2009Q\3706\023cq1a^\330\254EF\002_\227j\350\025A~\037R \\\020L7\275\364\322\373\203\211"
+	.ascii	"\212=\b?r\322\003v\250\201\2751$c\")H\222BcP\002BTT=\021\340"
+	.ascii	"D\343$\013\204\024$I\241\322\032m9@\346\246\036Q\"\202e\302\301"
+	.ascii	"\216\335\023\207\254Yqi\236\237/7\257Y\006/\262\370\347\257\347"
+	.ascii	"[b\337\377G\353y2\336\225OpIK\tft\352b\001\n\255\245:\210\350"
+	.ascii	"\260 \253F\331u#2\314\302\320\226\342\213\037g\267\031\020\262"
+	.ascii	"\225r\326\3172\347\020\222=\355=\3528\027\330oK<\355\006\224"
+	.ascii	"\3361jO\305\013\344\231\214\241\274\204H\tAO\nw1\221\2559j\346"
+	.ascii	"\331\227\n[5\302\251\226\ri\267\006S\"E\261\b\003\027G9\242\374"
+	.ascii	"\315\330QKf\\na\223e!\023\0216n\375\227'\260\t2\207\270\247\261"
+	.ascii	"\222\004\0354\020\216\025iP\"\346\331l\2509\260\333(\363\307"
+	.ascii	"\032\255\206#U@\025\364\230\217\346A\303\264\034\361\225b\350"
+	.ascii	"\364\\<"
+	.text
+	.section	.gnu.lto_.ipa_sra.a3940a5ca6de62c7,"e",@progbits
+	.string	"(\265/\375`\231"
+	.string	"\r\006"
+	.ascii	"B\207\026\034`o\206\0030H\024EQ\024\305\020H \001\350AJ\t\351"
+	.ascii	"\241\356\002\232n[\246\024\256\033Mf1_\326\226+\217\362\023\311"
+	.ascii	"\213,\344\307\322\261l\354?\212\261\213\245HL\207\325p\241\332"
+	.ascii	"\364\365\251\336\nD\322\017\307!6$E\233\266\021tm\020\t \300"
+	.ascii	"\356z\266\224w\0023 \260\202\301\234\007\376\020\361F \357\025"
+	.ascii	"\"\f\235\310q\005\313`=\214\305\r\303\242\266\204!\260\272m\333"
+	.ascii	"\354\333dv#\302\360m\274\260Nr\003\307\202\210\300\200)\031z"
+	.ascii	"P9\226\t\266\373\030IY Q\b\214\3106\200Bu\272`C\3673\263&\003"
+	.ascii	"[4-O\255\315\203MD5\345\275b0xq\341\206"
+	.text
+	.section	.gnu.lto_.inline.a3940a5ca6de62c7,"e",@progbits
+	.string	"(\265/\375`*\b\315!"
+	.string	"\226\255\241I\240\230Q\032\003\300\267\252+\024k\345\006\372j/\373\311\355\025\272\013\212\003\213\"\316\216Z\367\235ru\324\031\236q\244\311!\322S\262\377m\030O\341mx9\212\276\202\034j}\3404\265\217\320q\033\323\263\177\022\202\366\226;\005\213"
+	.string	"\214"
+	.string	"\225"
+	.string	"\313\376\225eY\363:\232\345\003\200onh)\276n\243(\001\261n\202\366\013\227\360\013g\233\371\017OV{T\2119\261\323\244\213V\r\002\217\365\325m\227\223 K3\305\376\220a\306\212A}\177\364\235U\322\323\312\312\231\346\2077\377\330\376\353\213\"\222U\333\237B\233\244*\252)\347\n\202\2620\"\362\332"
+	.string	"\202\3060\"\362\362y\353e}\337\334\226eY$\276\020\305REj\212\001\375\017\354|>\205\350V\025\251\251\002\217`\233\236F\2324\b\321\262\f\f\336\202iKC_\220\3441\364\005c\367\360\312\262\264y\347\003\335\342B\210d\2667\351\030B\341\254\363\224D\226\034\334R):r\252\217[GS\204\324\352\337\263\223g\347\373\334Q\246\255\244\"\236\007\314\003\374\376\341\311\352\234JB\222lx\bA\177OE-4,`&n\201q\373\370\370\326o\267iB\274\346\347\264G7\260\363gI\327\3319}!\374\272\232=[\007\373\335\032\271\202$\345\2434\204\211\214Nc\355\021\267\302\257\253\034\365\232\211\036\001\"\246Y\002\304z\222\035\001B\020I\247\323\017v(H\035\355\225\345\n"
+	.ascii	"R\206>!\004j4\364EY\260\003\372\213\355\266\327\340\306\347\377"
+	.ascii	"\321_Y\226\343\nt4' \311\311\034\315\241E\207\025\371,\037\201"
+	.ascii	"\366\n\322\324o\267\235\253\271\305\361\253\352\202\211?\255"
+	.ascii	"\310\244\355\320\344 \322vD\324\344\331\241\237\300\354 \362"
+	.ascii	"\354\210\305g\020=\202\022\036\321F\300\024\234\001\305\300\022"
+	.ascii	"/\025\\\006\\\303\321,3^\302L\"+\\\001\3273@\375\303s!~\b\332"
+	.ascii	"s\262\001\206.Y\241\220\2425\275\214\341a\273\335\207\022\220"
+	.ascii	"\313\354\013_GZ+qD\254\355\320\013\304z\272a\263\205\372\262"
+	.ascii	":\222\303\346\215.Q\215)\307G\322\366H\3426\b\346\214\026\354"
+	.ascii	"F\221v`\321\020\037mIMTWu\333\034\242ZX\004\233\354\\\341\317"
+	.ascii	"Q\n?\020\005R\004\370\253\217dm$\201\270\226\"\t_t\325H\315\032"
+	.ascii	"\204I\214'\261'\320\330\022F\322v\005\332\353\365FU\017\200\310"
+	.ascii	"\2501\265S\204\244fF\222\202d\031\003`\002!2U\327\001\022\200"
+	.ascii	"DA\305\322\320\020M\211((,e\330\rL\205\334ld\222\330a;iS~\375"
+	.ascii	"\023\231\201\223\356\354\026\213\3334J3\265\276\275G\332\243"
+	.ascii	"e\254\245\360\026#m\255\371t^\207\251\350\026\317\243\220\235"
+	.ascii	"o\200\261\260U\342\273N.\365f\224\357-\211\333\254\237\234\001"
+	.ascii	"\315\240\207\006#R\335\003z\243\375v(s\020\0306\301\360sMp2\016"
+	.ascii	"\222G\2756\263\022?\256@r3\265\271\363\230E\324\270\242r\203"
+	.ascii	"\001\213Z\320>\017\357\023.C\250\312d#\356$1S\302\234W\351L\017"
+	.ascii	"8\006\367-\231\234>\007\006\\C\n\375j\225\351\372\363\315\252"
+	.ascii	"T\333\341\202\036%\3065\357\331\301\003\t.\177\031\320\302\005"
+	.ascii	"?\020\217+P^\206,\245\337\275\324%\206\300\361[s:\254\270\330"
+	.ascii	"\332\301\251\307\205\330\21055\023\375\273\206\352 \237\251e"
+	.ascii	"a\220E\226\260z@z\031,\314k \311\037\242\266\003\215\314\267"
+	.ascii	"\365V\033\342\"\t\354\006?(K\026\310\305Y\3374=\2305\201c$\364"
+	.ascii	"\374\274\365m\230%\006Z\rAyGN\361\t\372\245\b\203\"y\360\344"
+	.ascii	"Q!K\351\331\203\230A\261\213\203\362bO\301&\241?%p\232I\200\273"
+	.ascii	"\3173\016\202\337\377\305\030\365:c\362\203\305uU'!s\374\216"
+	.ascii	"\350\373\261*e\020>\230z>A\222\325\336\362\277H\261\016\314v"
+	.ascii	".~\245\224\t\251U\2735<\227\360[h;\274T\354\271\327\n1\254<]"
+	.ascii	"\275I\315}s}\002\032b3\335\327\263\270\020\240\t"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a3940a5ca6de62c7,"e",@progbits
+	.string	"(\265/\375`I\004m\r"
+	.ascii	"rO23`M\222\016\324\224 \310\002\250\310\225a"
+	.string	"\374\020$\244\303\005\004\027\204&\013a\272\233HJ\200\206\215\316z\330\326Z;\256\352R+f\257m\203X\322v\222\001\2752s\2379\034\200\242s3\311\221\035\255x\260\355D/\211\221s\263)\025aAP\017\315-\207*S\200\221\032,\f\003\331\204\355/\264\n\355\305\302D\306\2577\016\031\337\212\252\226\303\311\270$\034\024\2020|\\k\320\274\302\2440\245v\314\210m\262\274\261h\263\265\362\336{\331\332\004\2350#\314\312\243@\233\001\267\211\315\206\221Io\211\3031\336{'\017\362\037\347\032\367\032\207W\003\035\024Q\366X\272$\0163n\335:\275un1j\210\200\371|\261R.\002g\250\241\3054\025\246 \225\fk\200\242!+\352\001\022\240\341a\faB\250\234RF\241$\005\245z\fk\346R\347CW\341\217l\002\2152\240Z+R\256\346\266Xt\203\236\220n\336yj'\313\034e\247\370\177"
+	.ascii	"m\271\033f\321\367p\036\230\334-\\ }\327\325\302Q\227\312t\376"
+	.ascii	"\363\362\245\016\035\214\333Dd/\346\247\321\004H\345@\332\327"
+	.ascii	"Au\277\226U\351\035&\233?#\374\364+\327h\335\2038\373]<B\206"
+	.ascii	"\034-\"\021\222e\262USk\231L,\224[+\345\032.\211\257\255b\211"
+	.ascii	"\262\355;0/\034\006sf\373\202\276\312\314\013\340=\302W\245|"
+	.ascii	"8`\337m~`tg\331\"\202(\342c\034\261\263\323u\321\307M\301\366"
+	.ascii	"3_7\002\275K\366\201\346|&\223\241\234PRzj>W\366"
+	.text
+	.section	.gnu.lto_.pureconst.a3940a5ca6de62c7,"e",@progbits
+	.string	"(\265/\375 h\335\002"
+	.string	"\202\306\025 pM\322\001\374\177\t\262\325o@u\001"
+	.string	"\200\377\355$I\026\212&#B\025p\007`"
+	.string	"\246\346v\3672-\263r)s\262F2#\027r\037\327q\033\2271\027S1\023\237\232\210\357p\3060\013/\302\034\\\301\233\300\007\270\323\225f4\241\357\231\277\234\227)3\303\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.a3940a5ca6de62c7,"e",@progbits
+	.string	"(\265/\375`\325\004\025\022"
+	.string	"\026VA4p7\315p\034\253\001\254B/I?\207\b0\b\375B\274\372\343\352q\250\222GB\"\204\314\372\243\2056\335\332nf\3246\256Q\033\350\330\210\210\020\273\245L\001/"
+	.string	"3"
+	.string	"3"
+	.string	"\221\362\347\231\246\363\216Sk\276\353d\340\013\213\345y\324>m3\201\213G\371\243mg\234tB\235\t:\021tqT\376L\005\227\f\340\027\007\001\005Zi\035\f\005\201wm\345m@\237\017\245\323Q\266cGe\002Zc\023sk\213\317\321\356\312"
+	.string	"\337Zc\034*SP\205\237\036\265\321(\004\251l2\002\013&\255\306\tJ\035\207o\222o\353I\376\320e\252\234\312\230\212.\374\365u\265\035\312\033p\"\025R\036p\323\300l`WRi\023\035\213\374\215E\bC\021W\021\022\324rEU\021\022Ts\227\032\367T\325{\235\017\337)\206\204\b\327c\360"
+	.string	"\352\344\360S\303\225\347\2162D9\204\264\363\234\252U\371T2\314\307\307\013\n\200\233\250\201\261\223l8\331\332\f@\002\202LY\225\007\021"
+	.string	")3\034\321H\220$I\262\034\202\311\353\266"
+	.string	"\006\365O\337=W\fh\017d#\313#\253\022\235\315\030\321H\321\t\353\347\252\\-*\334ml\030\376y\030~F\254\266\231UM\2371\315\335\211]\313\363\261\207Uk\231K\201\366\035\224O\323\214+\236F\211\352*\354j\033d\247\fi86\307\020\335\037\301\326\366\352\234\217\253\022o2\032e\215<\376\202\232A\261#\220\035\330\373\t\276\247\307\250\370\001\372\241\3415Zsm\253_\261q\035y\361b\217\023\302\316f\301%\177c\2122\001\030&\223"
+	.ascii	"7\277\355H\031\340Z&\023\356\2571\205i\\\223\232J\314\3426\202"
+	.ascii	"\260\342D)H\245.\360\r\3478f\356\255\321O#\006\3577\334L\032"
+	.ascii	"m\216\247\365\303O\273\365\022\202\222\347-\311\321\362\006i"
+	.ascii	"\365K:|\242\005T\316-,\026\215\3561>\240\306A1\201\264\325jp"
+	.ascii	"x\376/\342\013]\306\275\023l\005d\366\367\342\343\037\276%3^"
+	.ascii	"n\333\202\210\3747\222\3256O\030\225l\205\357\377?9\251\032\273"
+	.ascii	"\252\037\031\024\355\372"
+	.text
+	.section	.gnu.lto_.lto.a3940a5ca6de62c7,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_queueClear.19.a3940a5ca6de62c7,"e",@progbits
+	.string	"(\265/\375`E"
+	.string	"\025\b"
+	.string	"\"\31767@s\322\001\020\027\035\241W\202\324\374V\366\311]\017s\021\325\220t\314\3050`$\004\250\3116\213\n\031\026H\250\035C\231qU\030@xw6'\037\333\335v\357\224\002\246>W\365\020b\250\032(\020\215pX\200\240\324\005\242\037\003[\022\325E),\353\242\035n\277\3318R\360\360\266\210\301bI\222\356\344\271\257\362\316.~\311\0236\3314/\345GW\"\263\301\317\023\236t\277L\317\177r\016\023 \355n\257>\312SB~\351\322\025\030|\275\364\261yi[\\\300W\017|\236F\324lN\203\021\304\376f\343\310\226\b!\0043\273\034\037\315z\262e\304\366;\316\354\230\202\214\200\232\215\225\323\356\322(\362\3540\363or\200*\322\0169\t\273kXE\035w\274\355\003\333\3246L\016"
+	.ascii	"i\3317cz\375\206\207\246\025p\0070\013*3\244\332>\\9\343\302"
+	.ascii	"\270\nV\274\f\021.\307\242\235d"
+	.text
+	.section	.gnu.lto_queueContains.20.a3940a5ca6de62c7,"e",@progbits
+	.string	"(\265/\375`\211\001\315\017"
+	.string	"\246\336jF\360\222(\0350]\335\362\255\207$X\3441U\317L|\224?\025}\370N\250X\363\2512\257\201iOz:\332\366'K\327A\317\t\360e[l\006\236\021\332\365\003]\352\022\3157S\1779\227\231i\210%{K\231RW"
+	.string	"R"
+	.string	"X"
+	.string	"'\321.\267\007\320.\025\234\234\334\3753\021s\022\0358\274\350\231\363\343\266\204I\036\277[jwM\306\325\316G]\033\361V0\236Je\215\314c|\360Zqb\304s\211\013\013m\200\274\225\356c\327\032\241\212\207\314\223\271~P\346\234\326\027\017\304\375\271\355\316v\003\373a\007m~\315\352x\360\336U\253\252\277-\370z\202\b\3701g\314\254\310\324!qR\034\274\375\317\217\031\344\2738\354t\320:\033\352\303\026\202\036\200\3149K.}\262]\022\210\267O6\310\266\252}\026\177\235n\323r"
+	.string	"s\266^4\346\374\0208\301v\351/\316\321.u\007\360\260R:{\234sNy\340\273\237\275\n\226\220\325\b\225\316T\206\210\326\215\270.k\373-\201<.J\304\2667<F\3136\347t\340\303xh\362i.\275\302\242\177\271\364Y\366\261\033\250\t\207\340\244t\266;>`\262]\227\375\241\224\301\016\0343\336\226\035\243\221V0\245\250D\207LJ\"\013+\023D\024B&\016\303(\345\002\027*\2318\223\002&e\020\2258\025\022\251\304\371\233\337\226\337\342\021vB\2047\322\357\264\307.a\207\025\336\354\337i1\256QR\253B\241\255\313\240\231\370\331\355\241%\337\205\261\275\020r\\\366\031\326\361i\254\3019\001\036"
+	.ascii	"h\3553\\6\276\252\271\243\302D\0321\252\305\020\306\375\332\220"
+	.ascii	"\nX!\264-)\boL\024\317\013\n\363(h\242%>1+\212.\244\270\310\340"
+	.ascii	"\304X\325p\317\3058w\241D\250B\271\246\316{\266}jiS\275\366\022"
+	.ascii	"\346\023"
+	.text
+	.section	.gnu.lto_queueAdd.21.a3940a5ca6de62c7,"e",@progbits
+	.string	"(\265/\375`\232\005\265\""
+	.string	"\326}\330I\200\030R:{\240\316\352e6j\360\340\263\n\020K}r\255(u\013\362t\253\305\337\320\323G\371\226o\357\360\006\317\214m\341\243R\353\335>$T\344\327LwF_C\316\373\t\002/'\375\240J\355\263\031i\204\020\271\223\f\304"
+	.string	"\270"
+	.string	"\310"
+	.ascii	"\347\021\363z\3242#1\257\314l-\363\225\337B:W\360\277{\221ZM"
+	.ascii	"\356]2\340\006\352Q^^@zT=Nz\324\301\003$N\372\362\312\351VG&"
+	.ascii	"0\270{\227\300\346\201\203\203r\200\237\313\363\332I\347\255"
+	.ascii	";\235\232\353\245\350\331>\233\304W:o\355\211\252\214\311\256"
+	.ascii	"<;\242\246\276\3430\245DyFG\024\325uR\352i\001\255\206\323\327"
+	.ascii	"\236\214\247\375\3216\346e7l\356KS\357\341H}PD\241E\263h\374"
+	.ascii	"<+li\365\360A\r\317\366b\246}\354\366\005\024\321\266J\343\276"
+	.ascii	"S\301q\312\214\257=\035O\001X\254\276\274\353<C\236\250\254\315"
+	.ascii	"]\270\367\262-BE\235\001\234\371\f\2309\0023\252 ?\20455\037"
+	.ascii	"\276Fr3}\207\370\2522\264h\230\277\344L\270\311\007\302D\214"
+	.ascii	"f_d\264\364\350\373]\267ZMU\307-\343"
+	.string	"\222\215c^\nm'\317\326$\301\270\221<`G\307Z\316\271\271\330\371w\256\337\206-\367Nv\346\235\226\327\234\345\335iY\227\263\254\246\226s\251\345\364\264\214\242\226O\324r[\313\366\264|\002\275\267#\225U\216\346\262\274Nqi\356\025\364L\310\305~\262[\346%\277\214W\244\003RQ\224Za\027\343\217\361\n\206\364$g\362\321\227\334\241\251\352\250\274\367>\t\037\214\357\365\257\243+\341\246\201\341\362BU0\276)\341\356\275=G\371\201z\324@\271>\030\342\020\241\215c\264\323>\323\232\235~\243\235\256\221\022C\304\3229\013cCwv\267\345\372\2322\264h\250|8\373\3156.\006\272Z\220z\357\020\002_J\013\022\335\375v\f\302\265d\343n\267\204U\230\324\007S\313\314#\036%\3156\222&,;\346\002+\231C \303E\261\327H>\363\030\330\246\230f\350\321\376\261k`32\315\372I\351\200"
+	.ascii	"pnJe\330\334~\244\235\344\325\307\251\323\355\346\353\371\257"
+	.ascii	"_\374\372\375-\347\275\367\242\013\376k\235>\021\243\031\342"
+	.ascii	"Q8\206\003\t\345\354dN\333t\321W\233\207?\t\252\367^\t|'?\023"
+	.ascii	"\342\0039\312&\206\206\322\2439\215\004\206\362\270u\326l^\274"
+	.ascii	"\310\272\223\034BB\326\204\321\317\212\223\201|\212\202N\260"
+	.ascii	"\020\021T\002\310\b\210B\350g\b\bTd\004\364\341a\242\024AE\300"
+	.ascii	"\025DDE@^.\275\221l\355\321\322\262k`\323b\232\351\336\374\273"
+	.ascii	"\236\201\255\007\323l=\332{\275\346\013K-\f\343\035\331\335t"
+	.ascii	"\273\365z\316\343Y\031Z4\267\315\2612\343\312\353\233~\331{\262"
+	.ascii	"\232_\\\302lV\021\257\030;\225\327|\346x\275\263\366\227\027"
+	.ascii	"\311\274\327\236 \025G<\332\264[\260@\233N)\315\b\325\317\346"
+	.ascii	"Z\355]3\203\370\261/2\205*b+1\177\213\212\234.'\256%\230\340"
+	.ascii	"*\313\256-"
+	.string	"\230\005\337i]\237j\210G\341\327T\370\\\025\231y\303\261\004-t9zEmTK\261\206zVK\323\016s\250a8\344\b\203HdF$\020\221\304\031\016p\002\021*\263n\021\3001TFR\220\333\001h\370\351d\310q\222}\204\035\r!J/;<yM\310\277\271\243>\001\0348iD\337\204\366h\242\254@\022\375\366-\031,}F\201<\351\374f\340\023\222@\"\365\232\307%\006\276\302\345\361\224\377,\321\027\224U<\334W&\263ZC\243\200H@\201xA\235\260\242\232\024\353\001r\004r\023\255\223\023\250l0\017\256\033\326\001\024\377\317\3269\233\241\030M5\375\363\021[0\315\320\025\\\256e\303j\234\212-\261D\232#\001\301S\034\364\370\2173T\023\263\352o\255\037\353$\r0gd\212\233\257\003\2557\033\247)\244W\365\237\262U\357\245\250KT\361\034\335s\001\300\003\330\223\313\272\265\237\207"
+	.ascii	"\325\271\310\330\272\346\347\2366\335}BY[\343\354\027i\204\032"
+	.text
+	.section	.gnu.lto_queueRemove.22.a3940a5ca6de62c7,"e",@progbits
+	.string	"(\265/\375`\311\002\r\026"
+	.string	"\246*\222J\260\022R:rc\354\314\277\253\360\027\334`.MG\027\254\253\332\340\360\315\344\250v\321\343\222\030y3tu\272\350\257\277\037\272\034g\271Y\206\375A\377A?q\332\306t\035$\327\367i\303\034gy\345(VK\b\331D\356\224\002~"
+	.string	"v"
+	.string	"~"
+	.string	"4\273\264=\247}\023O\242]ivW\255;$\250Zy*F@\236\232w\023\361\224<"
+	.ascii	"\3614\001\013\315\265\363\210|.\244\264\223\002H\255\274\327"
+	.ascii	"z\260\311C\336-\316\332G\221\206;k\276\355#\211n\207Gw\233\342"
+	.ascii	"\321\317)=\242!T\243I\247\341a\350\222D\342\003\211\356B\270"
+	.ascii	"K?\252R\2473\367\276\317\250\253[\215&\335\317\347\370Rk\365"
+	.ascii	"\314\3512\334\344m\373\330^`\317\037\001*\376\203\371F\247\266"
+	.ascii	" \233\317\235\372\262E\352\331\005%I\345\314\340Z\345Xj\332\035"
+	.ascii	"\262y\266\251@FU\221wg\273\256\364\227xz\244\265\323\345N\213"
+	.ascii	"\274w\263\3504I\247\307\235\026\303i\032N\207;\275;=\347\364"
+	.ascii	"\003\264T <\b\004k\365\t\n\2511\250T\210\367n\237\347\373\\\372"
+	.ascii	"(\276D{\317@\322\206\201\374\365\230v\324ZQN\315B\236\026\bo"
+	.ascii	"\007\007\032\350\033Y\202\247<\225\353\261\362\271\"{RUN\272"
+	.ascii	"\343\222k\323\330\314\347\334\322\001\2676\373Q8\002l\324\034"
+	.ascii	"jv\200\350\211\334\251\303o\201\243BTk}\316v\354N3\027\033\247"
+	.ascii	",\306\245\300\334O\312Y+\3568\003\027D\336Ub\270t\257\0037\342"
+	.ascii	"6\203\336\r\367;CX;wW\034\302\201\n'\3426\300\005\220\217p\207"
+	.ascii	"\\\262\337X\357\206\316\fb\333\021\3164#k\255\f\37433\223F\006"
+	.ascii	"s\023:f%&S\203\003AfB\214\354Ea\006\306\346\025\023\223\275V"
+	.ascii	"\f\030VA&\366\272\201\301b\257\222W\277;\377\304\035X=\375\236"
+	.ascii	"D\277&\336\367\007VN\277\247\360\257\211##\353\227\234\275\201"
+	.ascii	"\030w\310e\021u\355\342\230(o\331\255-\267\001\f\235\031\304"
+	.ascii	"T\345\236\334\330\2203\203\017k\255ULyk]{\337M\200s\005\320\356"
+	.ascii	"\005\r\267\265\254\345\371U\211\236-w.\217-\262\376T2 `\202!"
+	.ascii	"\346\214\007i\373\246\032\376\332\334\2310\246\241\305*\322\301"
+	.ascii	"\025\2273#Vd\"^}lL\375&\221E.\360f\261m^\221\312q6\201l\342\222"
+	.ascii	"\320B6\260a-\026\260\300&w\b;\216Y\177\242\363\206\267\024\275"
+	.ascii	"\002)\353\200\222\374n\353\023X\024\200\3268+e+'b,\016\356\267"
+	.ascii	"\214\312\033\265@V\035\2679[\254O\320B\210@<\367j\361\023"
+	.text
+	.section	.gnu.lto_queueFirst.23.a3940a5ca6de62c7,"e",@progbits
+	.string	"(\265/\375`1"
+	.string	"\375\007"
+	.string	"\002O67Po\322\001 &&0\365s\263h\252@\377SQ\214O/|\005B\257\016T\267\206\362=n\024\021N3\022\274\252\252F\033\264\375\267\002b\245\n\226%d\023\271S\n\3064[\346\300Y\310\030\260\215\204hPx\220\330\266\221\032\002k\021\331&%4m\223\230\271\257VK\252\003 \r\035|\204\273\354.\202\037r\021\216oz\364D\247\243\027\351\343\360\f\356\203|\372\3047\231\302'\370\356\321\367\311z\214\244\025\324\007\202){~\240b\330\257VK\266\241\265\272<\025\001\226]\213T\313\246Do\303\266\307\306\370\035\367\360\230\013\230\032\243+\204RA\202\332\235\322\363"
+	.string	"\326\343\345\031\353Q3\316\035r\376?^}\027%\235\350sx%\354\256a'\032\335z\333\005\266\245m\223\r"
+	.ascii	"i\331'c\232\372\f\267\254\224\030\333I\363N\214\025 e\213k\342"
+	.ascii	"n\004\326Bd\342\256\230\332I\006"
+	.text
+	.section	.gnu.lto_queueNext.24.a3940a5ca6de62c7,"e",@progbits
+	.string	"(\265/\375`^"
+	.string	"\355\b"
+	.string	"\226\220<80\345(\035\200\277\330\rL"
+	.string	"~v\243\325ce\022z\260D\376\371\271\274\001\242]\373\261\256\332\3078^U\332\330PP\220\005\214a\375\340T\342a\016t#\334V\312\224\002*"
+	.string	","
+	.string	","
+	.string	"\031\251\227\335\b\035?p\375e.p\375\351\307\267\347\346\237\344\030\227\216\024\256$zb\f\273\353\344J\246[o;\3016\264\035 \235\035E\251\036\3661\253'\333\351\227\351\314\364/\254\265b\320\355jt"
+	.string	"V\345\251Bl\207l\215/\362\221\2207\202\bb\302H-\001\250?\177@\240\353\357i\200*\325DY\\k\224\235\025~M=\006\007\351%\217f\371([x\225\347\376|\257\256\277k\001\313\306(\003\3166\032'\342\343\300y\310<p\002\242A\002f\232\007n\020\334\241\340h\260\242\323\321\240&\356\365\364\364`\244\244\213\243l\231\335]\360O\236\362\370\001\017"
+	.ascii	"i\331'c1\345\315hE\371\263\320\234\220\034(C`1K\211\255Q\214"
+	.ascii	"\2700\316\016#Z\260L\\+&a\222\001"
+	.text
+	.section	.gnu.lto_heapSiftUp.31.a3940a5ca6de62c7,"e",@progbits
+	.string	"(\265/\375`\314\003e\031"
+	.string	"v.\242G\300\030Q:`\315\\'\222\332<JFbK\021P\001\264%m\006\270\376\217\f\245 \274\313B\237\0337\265\246\365.\013;&\352\357s\004\311oS\024\007S\304\363U\333[\366\231\306E\034\3415Z\373\244\221M\344N)\211"
+	.string	"\205"
+	.string	"\226"
+	.ascii	"!\302\021<\241Q\023P\230Z\253\315\251]\341\251\352\364*\333\237"
+	.ascii	"\366\201<H\355BV2"
+	.string	"\252V\031@\224\324Z\035\370Ax\212\340\005\300\323\357\003\300S\327\354//\201\352\351\247E\t\2422\265\326\326\3160\235\265\203\364\333Y\363g\215\242\235\334\210\203\253\034n\350\323D\3566i\016\025\377\276\bA|\320\370\356\363DN\347[]Q\023U\0167\367C\377x\320\350\355\344T|\236&\324Z=wr=\367\351\266E\330\236\331\313\013wY\211\022\344\365\261\217\364\007\370\321\017\340G\367\352\3235\251\351\324u7\352B\177H\217t\177\027\27275=?}\001\2510L\f\300\324\212\242\207\246V\241\274\033H\354'\271\222\332\221\3109Y\2240z.\224\341\007\200\260\033\221v\235\0369\362`\004)J\0309\236J\242\264q\205pv\243\234\317u\352\027\275H\355F>\274\342xPH\232^H\bO_\001\\\367\265\357\0139\221\210\017\361\362\222^\372;\333\272\004 0\235z\230\374\340\331\214\270\360q\362a"
+	.ascii	"k\0020\005\305\030s\205\212\316<\343\324\326\254\0012%\322\330"
+	.ascii	"f\317sW\233\332\023\375\333\321T\366\230A\004\307m\351f\245\245"
+	.ascii	"\326\312\341SD\026\220\224\271\313K2\323\340_\324\316)\2704\267"
+	.ascii	"\3313\353t\277\337\235\256\b*\302\275\270\355\025.:\2435\024"
+	.ascii	"\322O\234|LrN\272\2442\265\352\270l\307\256$:\320Rk\205\260\344"
+	.ascii	"I\243o\343\324\031^\363;\247\376\013<]\355IG\222\037B\266\331"
+	.ascii	"\263\313\333\334\037;\326\300\032a/Z+F\302`\244x`\303\354\206"
+	.ascii	"\226\242Q\030sp\024\250B"
+	.string	"\310h\261\221\322b\243\354\246\003\bb\304\211\275\250E\226l\344\220\2033j\020g\255\330\353\006\326\022e\263\026+\201\311\016\243\254E#IYKU\332\276>6\245\353o\351\256\0051Ul{\363\2676\354^Hw\341BW\273\005\304\265\210\253,\037\372\002^\0233,j\200\373\343\357\036\242QZ\372P\353o\206K\327\204\315\320gP\212\336nIg\236\371j\255\2256\211\013\260\330\264[\021\003K\250q@\243\fb\bI \"\022P0$q\003\220\002\241\261\352\001\020X\211\2640I\033\317L\177\304\364Jjx\0379\223\212\317\305\214\221\376*8\353\2039\030M\256\275\227\361l|6J\024\313\003Un{\036\330!\340>\240T\f\035\226\333\240\032Y\347*{\376\202\n\275\234|pPTy\020\374\320\027A\"_\204\217\220\320\026O\367\332QP\265\276\257H\262\327h\236\275\235\303\002\270g\226\200\354\206\342"
+	.ascii	"\236\241\f\f\260\375\262\367\224\"u\244fP\035\360`\215(\217\320"
+	.ascii	"\330\344Q{!\023\\T"
+	.text
+	.section	.gnu.lto_heapSiftDown.32.a3940a5ca6de62c7,"e",@progbits
+	.string	"(\265/\375`u\005\005!"
+	.string	"V:\315H\220\230Nc\300z\343m\264?UO\275\331\207\254f\307i&&\352\347\340\253G\347\223\314t\032\nQ\024\261\024\026J\221\331r\\2$ \022\001 \232%h\340\324;\004\350=\2666d\215\272\210\225\220\335m\357-eJ\001\260"
+	.string	"\256"
+	.string	"\270"
+	.ascii	"\367\376\350w\231g.\223\321 \035o1A\225\023\254\233\227\3269"
+	.ascii	"_\332\033l\336\313\312\263\375j\037\353Y\303\033Mf\364^\024\306"
+	.ascii	"\037\367^\003>p\276\244\371\214\371\222|\214\371\322C\233\311"
+	.ascii	"\217TW7\205C\311\253\312\275\327gU\330\326\341\321Sg\226\244"
+	.ascii	"\255C\277\266p[*r8z\255\223bUM\226`<\375\254Yk\202\322\2216j"
+	.ascii	")\340\006D\235\201`**U\363\034\361\262W\354@\322\334{y\305\244"
+	.ascii	"J\222\013\262l\254x\327\253\207\"\022i\271\276\312\256\365\232"
+	.ascii	"\253&\022\325\356\212O\257\272\006\367^\327\245\242\323\275\273"
+	.ascii	"m\032\266\203v\351 >?\365K?VA\b'QY\306\243:g\037\211\325N\331"
+	.ascii	"\327Y3ca+e\177\354\027\360\260?\300\253g^-\203V\307|\354\206"
+	.ascii	"A\253_^\355\322\273\361o9\327\275C\037v\237h\265\016\2556\321"
+	.ascii	"\352\362\306\233|\265}u}\365\007H8Vyr\203v\357\2079,7\255\024"
+	.ascii	"s\361\303>\220\213\r?6T+\324\321\204S\204\343\371\030\023x\260"
+	.ascii	"!\353\274\364\021Fd\032\020G\023\305\246\333\341x\343\007g\321"
+	.ascii	"\301\214H\235\035\3471|\017\r\344\205:\336'\fUi\013\316\227\277"
+	.ascii	"/\347\272\265\377\305sJb\343[\367\332\360\034\256mCns.\255i_"
+	.ascii	"\354\277N\316Hr\2541B\307\013\342[\206\273\245\f\336\332L\213"
+	.ascii	"\"\331\301\241p\266\364eTk\245\305Q\362?\221\2426e\336\336\261"
+	.ascii	"\257\255\322J\331\036\271\221\317XK\n\261*K\272\"\242v\306\272"
+	.ascii	"&EY\266%\\<H;\345w\375\304"
+	.string	"b\026u\356\254\311\332bQ\313\324\263\325\006\273\214 U+\366\321\236f2\337\312?\007\251_r\020\363e\265\345\025\232\034\024\316o{\366qIQ\304:\347z\223\231\250\275}\327m\240\240\021\335t\\\021\311{\357\265>\033\262Y\021\230!F?\"dDa\335\213\244c\233\347e\251\201\267{/\002\262\013\251\340[\275t\356\311I\203|\204>!`P\020\360'\340\207hG\270\023:H\213x\n\3604\004\205Bi\311\003\344\323\363+3\244<B>\245\1779\301\024\250\210'\355\371\021\371\204|v\202|\277 \221/\247\306\300\013i\320'\004\002\203>\336\361\350:\324\232\264\250%-\023\204\033iG\226h\030{e\310V\322\336\233\034\025\243\226\253\266*\030>%\355I\271\326m\304\342\344\240\252\320(\251\r\024\033\350NR\231&Np7\304\354\216\022RDN*\"F\323Za\031\223\262gw\226I\311e"
+	.string	"\250\3058\021\205\r-\306\312\234Vgc\354\275\342vz\026\016\227\022X\242\263V\254M\316x\004\246\233`\272\310<\271\332\212\302v\366b]l"
+	.string	")JY\216jo\250q4\303\230a\f\211\310\004\"\024$m\016\220\002\231!\263\016\020`73\232\202f\f\316\231n\306\305\026\245\346;\221\f&|\204\2221\336-,>\377\037\264m\002\206\261\273\240\034\213\322\267\272\345\372\022W.vz\255\245\370\220\360\274TJ\006\205\036>n\204=\273\024E\310{9&&\311\031b*\320\316"
+	.ascii	"s\340\255\240\322\355\204fn\017xyLQz\244\203\332\243\332\210"
+	.ascii	"\362\204kP1\265\352\302\254\"\310\251\207\200\230\274\235w;A"
+	.ascii	"!u\360V{\375\342@\021J\321\373\300\r0\211aY8\366d\275\241mmi"
+	.ascii	"\212W\325\224\224PG\231]U\317\201\225\375l\016\"\243\027\363"
+	.ascii	"\314\343\344C.H\272X\355I\026\332\001\324g&C\\\303\256\346\233"
+	.ascii	"\255\032l\007\"\320d\235]\217\177\336\306\320\026\257\001\376"
+	.ascii	"\337\223^a\322"
+	.text
+	.section	.gnu.lto_heapRemove.35.a3940a5ca6de62c7,"e",@progbits
+	.string	"(\265/\375`\305\002\335\025"
+	.string	"\206\350\215I\260\324Q:x\203\033\371'\375\360\332\273X\r-xf\3511|\365]\204\262\301)Z~:\002\233\317\373\207?\353o\335%\342\341\303\272\301-\377\240\377\240\367\003+\037B:e\"y\301\304\tLh\246\376\334\b!\204H\231R{"
+	.string	"p"
+	.string	"|"
+	.string	"\017\311\007\020\037\332\366\202\026\232k/\225~\306\235$=)\212\314Y\2726\311\002\016\2267\251\265\257\310Q\f\301\325\232o\373\3528\200\206\336\273\372\344nJ\246x\b\022\372\b\312\330!\031\272\310\341!\250\002\004\006\221\222\034\017x\362#\002\307\312\355(\b:p\332}(\311\365\200\013\345\233\301\312\351\350\276w\225]\331d\244C\220\320u|\231sZq\271\240\033\300m\227\260\315\300V\251NO9\372\333\034?\240X\354\"\331\245M]p\324"
+	.string	"\341\325\331\255?\375,\253Gq\325\341y7\270\352]\265\252\372&\263\021E\202\270~s\376\374\220\314\033!\025\323y\267_\372=\263|\024\207\242\235\347*\322\006D\372|\031\200\3149W\036\272\205|X"
+	.string	"\274M\263Y\266U\3557\335\211\366'\234\233\314\251\213z1g\231\300\n\310\207.\177\"\006\033\244\206n\350\254\215\324\321\223\024.\222\270\340\372\\G\020\r\033\256\256\017\270\273\007\212\230x6t\364\b\206S\321\030P\202a_\370\224\324\212j\327oq\027\256\362\227<\343\030z\234c\210\017\267\n'\204\345\272\273'\332\315\3409\272\021\2202\032\002.\222Y\373\225\361z\350\350\021\333\261G\341\240\270\330\226}\005\315"
+	.ascii	"\036s\316\006*\356\233\371K\017ms\243\307=\364o\326D\221\356"
+	.ascii	"(0\230\312\314`j@\307\260\310^\024l$\274&\304\314\\\025`03\256"
+	.ascii	"\030\331\314\305\222\342\230\205\227\314U\023\213\311\\\254r"
+	.ascii	"~u\376\211C\330A\344\233\"\375\232\370\336#\354\370\361M\211"
+	.ascii	"\177M\034\307\365K\316\336B\254\026\311,\242\261\265\353CW.\212"
+	.ascii	"\033\356\003\031\341\242\364\020\312\321\337\3019\347$\021\\"
+	.ascii	"\334\326\236\304\316\307st\323\237F\031\351h\214\342\253\204"
+	.ascii	"\250\245\340\3320\031=\316\357\375\0018 `\2021Vw\003i\373\246"
+	.ascii	"\030\376\242\271\003\302\020\026Y2Fk\276\310\272}\313)+\204\310"
+	.ascii	"\232\312ih\243\354:\216\020\345\2656|\227\306\372\031x\253\243"
+	.ascii	"\321\204\r\006le\t\223\273\022\310\240u\r\020\374\314\001\353"
+	.ascii	"\312\362\353\213\341&\333\020\266\212\271\334\262\2753Z\007&"
+	.ascii	"\tw[\237\240E\"nqV\312V\256\bc\345\0324E\324X\021\035\337\215"
+	.ascii	"8\021\207|\024#D\n\343E\353\275\256\365\004"
+	.text
+	.section	.gnu.lto_readyQueueAdd.36.a3940a5ca6de62c7,"e",@progbits
+	.string	"(\265/\375`\376\002=\026"
+	.string	"\246i\221J\300\020)\035Z\240}=\267\220\302\237r\032Z\355h\001\361&x\356\003\n\034a\354_\365\213,@/U\325\351_\257\333t\355\265\212\252\361\213\332\026A\020\004Y\026Ao\327\326\334\006\023\2419\210R%\177\302\225\020\262\211\334)\005}"
+	.string	"w"
+	.string	"{"
+	.string	"\006|\200<u\357!\342)y\001\342\251iv\214\367\202\352\310\333\261\340\273Qkm-\317\003\036\366\356q\322N\216\"\rw\322\374\tB\t\247\2439\331\"\247S~\332\350js\374\220s\361V~\204\206$<)2\200\350na\b\213\237\027,]\205\031\206)@\r8\377}\336\350l\341\364@5\343E9\235\271/Or\244\204\323\345|\216\fj\255\2368\335\205\333\343\266\213l\247\330\273\001c\351\204C\247f\356\260{4sw\366I\246\206\226\274@\366\221\376\217\373n\326\370\244[\f\247i8\035\356\364\356\364\334\351\003"
+	.ascii	"\251b\261\300F\2558;r\324\025\024j\350\276?\311>\t\377\347\233"
+	.ascii	"y\275\345<nx\035\252j\355\241\220\247\177i\226\335\373\b\332"
+	.ascii	"\223\034$ir\344\217\327SUk-9u\002\362\264@\370i?\304E\320\216"
+	.ascii	"4{\200Z\201\232\236j\355\005L\265 ]\027%\225m^\035\305\206\337"
+	.ascii	"\215pw\246\033n\254Ta\233WA\240\203\0073\361\224\256\t\325\353"
+	.ascii	"P.d\2556\005\376\211\226\027Rhf\351O\320\b\311\366\204;\315\020"
+	.ascii	"\004\325ZQ\374\246\233\200\371B\247"
+	.string	"\226 \223\211\247\254\025\241\202:\371\270\273\377\235J\0359\335xj\013\303\207\350j=\267\304qV&\377\316\375\215\247\366\24539\350\013Y\306\300y\334\251o\240x\372\r1WK\f\214\276^\323E\246\022\023z\345$\346\202 \303\342jY\221\265\"\274T^Z+1Y\353d\3040\030W\254\025\003\203\305Z\254^\375\002\331\343\270\246\343:\334q\305\0063V\324l\315\037\261\243\230\021\230\0321D\341\340\300D\356\316'\252q#\356\262\320\3201\277\343\332\330v\311\307\355\331\371)U\204\265\326:\262\3266\314\245f\"Q\024\216d\340\2546\270{2\022?\226\265 Ve\n\333\274\232\367\t9 \220\002\031\311\235\003\251\373\304\206\325B5F\354\243\020\356\220\272Y\031NYL\367\312\215\300*\256\224D\001ph\025<\261\n\220\310c\b\017\t\354\336\310Pn\216\211\254O2\241\313.\230V\326\016\270\224\202,"
+	.ascii	"K\370eNK\250e\324\031\035\355z\325d\034\206^\271\255\005\034"
+	.ascii	"\257\332\253Q\266\340X\256\270yP\351\356\005S\300\215\331\t."
+	.ascii	"\031#ip1B\232\373\230!F\243t\256N\006"
+	.text
+	.section	.gnu.lto_readyQueueRemove.37.a3940a5ca6de62c7,"e",@progbits
+	.string	"(\265/\375`\333\002\235\026"
+	.string	"\026\253\224J\260\226Q:\024\206\360\234\263T\234\247-%\037\201D\250y\004S\326\3729\230\211\263W\366\226&\017\206L\036\330\361\327\337\022\344'j\003K\302\254\375\240\377\200\367\243\233K]\261\211_y\343\323\267\"\n\263\345\267\204\220\275\245\224)\177"
+	.string	"w"
+	.string	"\204"
+	.string	"\177\355'\3773\377{\264H\265M\242-J\255=*\250ZK\227\037\030\227\276\\\225p\351\270"
+	.string	"\302\245\b`j\267m\031\"\210\004\032\375\270PRk\tk\020\017\260\263\334\207l[1\244\263\331\366\275\255\370\332\375"
+	.ascii	"\355p\034\236\340-\245)||\b2\3558\354\234\f\220T\210x\3550\314"
+	.ascii	"V\002\326 w>\334\373[\246\221\003\027d\332\361\226E\231Z\353"
+	.ascii	"Y\267\323\260\037\367\177\320\177\005\177\257\002\337\242\245"
+	.ascii	"\2670\343\325-\375\316\372H\350\310\020RT\017Wu\217 JL\335D\177"
+	.ascii	"y\343\004<n\214x\367\376\365\355S6i\027\345\374\227\253\371\255"
+	.ascii	"\346\223\353\333\263(\177E\371c\363\305\311\017'\2376\1776\277"
+	.ascii	"\233\317\314_\225\013\245\022\"1:j\r\252jRw\320\250\022\353\333"
+	.ascii	"\177\313\357\357\344\267\305*\325\326\367\251\361\226a\004\002"
+	.ascii	"\217\206\324ZY\226\036f\\J`nS\237\372\026=\302\245.\245+\302"
+	.ascii	"Mv\f\023\222\303\036{\325?N\016\257\3561\036r}\373w\006\217\200"
+	.ascii	"\t\013E3\360"
+	.string	"\264j\026\242\343}e\360\270\374\320\375\327\331\030\264\006?\2266\215Mq\350x-\313j\261E$7B\332a\257\220\034\212\331\264\367\347\311\313v\317^q\222\033\302q\325Y\315\335-nX\221$g\0027\300I\310\310l\242\243\364\266\314G\345\303K\376\277f\227hc\255u\301\367\305\002c\00177\2143\233\331\231\247y\221\331P\340\251\261\221@3\203U\270\231\311\201\321\310f\260\227\002\217\351\330\310`;\261\230\fF\226u\273\367e\261\017\202M\300\247\360k\013\367\267\020\202K\300\247\271k\013_\257\276LO\343H\210Mt\322\210\246t\003a\226u\375\256n\265\203\034>\274\3445Z\275B\325\241\207\253v\326Zk\330\262\256N\351\375\255\n\016\206!\324\263Ag\273\232\325@\353#\211S\267\232\033\350'\373+\265\0014 P\202!\345\254<\251\366M\033\376\242\271\2430\302M\213}$\301\025+'\250\254"
+	.string	"Q\374\214cq\364\033\310\026)\2217\222\256\366\013\206W4\360\313\323\020\272RH\306\345G\026E\262\350\225=\"P\026\255\313\342\220\350l\230c\20711c\303\246\2230\301D;\220\226@\356\352\332"
+	.ascii	"3\343\230\024Z~\023c%pG`f\336P\013\344\3528\2323\305z\004-L\004"
+	.ascii	"\302s\257\366=\001"
+	.text
+	.section	.gnu.lto_heapAddTask.38.a3940a5ca6de62c7,"e",@progbits
+	.string	"(\265/\375`K\001=\016"
+	.string	"\246\232_E\340\264&\035\224\354\b7\025\315nZ\002\277'<\314\\\023AK\226\234p\205\nq\017\300\312<\260C\272\265\256\313\036E\020\265&i\033\315\3418N\214{\036+\214!\tP\b\034\034K"
+	.string	"\342#K\366&R\246\024F"
+	.string	"I"
+	.string	"O"
+	.string	"\266\237\366e\274\246t\033\322\005\354\246p\360\330\375\024x\001\350\320\337O\342!\350\003\342\241K\366\220\177(\026\233Y\211\300\361\331]Mg^z\226\374\337\234\304{1=1\b\273\353\364^`n\275\355\003\266\031\330g\005\333\300\247\361\241\305\204Es\350\223\342!\326\"\210O\317)[\366\207J=a\377\332\335\265\246\354+\215]\351x\233_5}\223"
+	.string	"/\200<\250\261;\242udy`\316\n\177\306U.\377,A\b\214\335\315\016m\027;;|\0269=H`z~b\256W\331\302W\027\b\260\270\357\b\001`\355\256\203\034\327\261Y\224\222\022\017\021\244\210\271\215\337\360\216Oc\025\353\344=\353\304\303\250W=c\2200!SS\242$\355\225Q\336\273\346\312\005\017JM\366\273h{8N\007\332\r\032\272\020\313\345\r\205\023mh\301 \312\260u\032\007\225\320\212\266q\235\206b\300\243\016\"Nc\031\2158-\373N\277VS\376\315#\030a\361C\344\244(\237dT_5\201B\336s\001\020j2\246;\367\212$xTLKT\374\b!\203\312\226\265\302}\220\002\034"
+	.ascii	"i\331'c\232\204\032\016\316\036\354\231\254\302\02274\301\026"
+	.ascii	"\260\bp\007\016\346U\036\033<\177\354\352\232\3556K\313X\340"
+	.ascii	"\241i\260\321\253\022\273\"\304\226K\263n\270\340f\312\036\240"
+	.ascii	"L4\253\246\301I^\\\223\f"
+	.text
+	.section	.gnu.lto_heapRemoveTask.39.a3940a5ca6de62c7,"e",@progbits
+	.string	"(\265/\375`\027\0015\r"
+	.string	"\026\030YD\020\221\223\016\374G\2525 \313\357\222\004\344\246T\204\035<\263\310B\2643\375\346\377\331\216H\272c\373,\254\261\326\376\034*\037\252\226\247\255\ff"
+	.string	""
+	.string	""
+	.string	"\262\250"
+	.string	"\016H\020\001\366"
+	.string	"\367c\375d\357-eJ\001F"
+	.string	"D"
+	.string	"D"
+	.ascii	"\037=\302\2479\362/\220\335}\313\001\2346\322\243\206\303w`\025"
+	.ascii	"\202\303\200\215\302"
+	.string	"\353H\201YY\330&\344\313p}\006\272\230\031\233\315\364<P<\234\336\362\274\260\235d^ \273\353<m\030\356\353\266=\266\025\330'\t>\313\037\237\316L?\200H\305\212\261\200\306.J\313\306\312@\025\0376\266\237\366G\234\304\350,\242\023\330E\241P\355r\b\234\200\343\320\334=\342!\307;\342\241G6\214s+{\251\260\250\360\302\332]LU\002\"..\374\022\177\021\371\035\234\225@\277$\036\246j\213\031\021\033J\331z \013H\021#\363\225\232N\245\016\305\253\210\313\013S\326\030fT;\202\204\374\351:R\243\243\351LJ\2629Rj\312\376\333\335\265\242\034\036P\210\3113\347C\353\220@`\320\031\341\2000\007\rB>\030G\003a\037\005\234=\350h\230I\226i\330\206\333\277U\324\273\241\242\351Jz\0225\365P\364M\374D\310\363\371\304\303k\305\fKF)[)0+\020PS\216\232\032\032"
+	.ascii	"i\3317c\232\216\fC\3308\21504\217\017X\370\253Kd@\003\306\315"
+	.ascii	"\260T\f\273Z\3303\312\006\310[\225\325\200\352j\\~!<\203)\227"
+	.ascii	"`\233\325\024\343\256\006\n\200\360\246\024j\017"
+	.text
+	.section	.gnu.lto_taskSystem.40.a3940a5ca6de62c7,"e",@progbits
+	.string	"(\265/\375`\324"
+	.string	"]\013"
+	.string	"&\224KC \2138\035\277cp\221\004B\254\004\036\340\202'\234%QTK\016\221\345g\301\016\203F\200\212\354\021\342\305\f\310X\323\0069\007\035\234"
+	.string	"\256\006\2549\264\r\314Z\276\fY `\360\261\265\222\336d\357\224\0026"
+	.string	"7"
+	.string	":"
+	.string	"\356pR\301\036\345!\300i\265\273\032Mp\361\026\235\242\217]\262\320\330\271U\340tb\004Y\225\335\375\204O\001\343gN\354\262\273\236\241\221\300]o\273\303\266\206}\216\b\354[\273\273\246${N\037\243\020i\330@\355\016(Al\252f`@\261\375i\037\302#\210\227"
+	.string	"\300\331\356\201\007\030vI\fgD\274Vnq\275Z\257\270^-:\257\330\206SIe\241@\254A\271R\335\364S6*K\252\271\273\035\352\360:\0251q"
+	.string	"\315\017\366)\274B\350/\360\tg>\364\352s\256\327\323l\024\302\201\3103K\233\354L\032 \b\327a>6\031\356\373\302M\302\233\345\343J\302\021\216d\003\265\f&\244\323\266\017\324,\027\366L\270O\333x\336\247Q\310\275\265\224d\017\003)\017\375\330\357.\337\302/t\236Fs\005\030"
+	.string	"i\3317c\232\215\032\006,\200m\n\313$\303N\230\020"
+	.ascii	"\320\201\313\200\316\003C8\020\210\255\270\006\252!\342B\030"
+	.ascii	"\002$\230w\t\200XM\001\356\0220`Q\345\266\253\350\001"
+	.text
+	.section	.gnu.lto_getCheckFuncInfo.44.a3940a5ca6de62c7,"e",@progbits
+	.string	"(\265/\375`\354"
+	.string	"M\013"
+	.string	"\026\325K> O\225\016\243\371@C"
+	.string	"*\200\207\344\332!<u\226\320\033\202\321K\217\207l9(\t\255a\013\0322\320\245\261\210\022\211\020\214\352\025\342\020L1\314T\005`\214\271p\307\332H6\2212\2457"
+	.string	"7"
+	.string	"<"
+	.string	"\273!\001\027x<:\274\004{|<"
+	.string	"\366\350\317n\361P\264?e\250`\202\261\273\231n\370\367\374\374\2038\004\004u\236\032\tv\327\t\202.\334z\333\003l#\260\277\001$\f\236l\331a'U\203\375kw\327\032\262_\372\261L_\231\326Lg\246\277\001 \305\202\342b\327BK\306\256b\212C\304\366\323\276\207\177\370^\342\274c7\264\002Ez\351)\314\370\224\270\250\032\350\240\"\245\332\230\237Hp\251\220\027\250\030W;\302M\336cw\017\370#:\215D\264\273\037q@\326C\\\204\347\217<a\223\007\037\375\r\366x\205\250P\001\234\203\fE\313x\n.\332V\3218\254M\272\355\201\327`\253h\232,ca\200\311\264N\223M\004\230\203\260u\231\004\216\353\262H\270\277VC^\220b\345\321\217/\265-?\021M\200\254x\253\3004\027"
+	.ascii	"i\331'\323tR\206\341V\225\202\2626\260\007\216\001!\300\024\270"
+	.ascii	",\b\036\200;\270\354\210\2015\34100\021\224a\026\325^\001\004"
+	.ascii	"\027\033\232\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_getTaskInfo.45.a3940a5ca6de62c7,"e",@progbits
+	.string	"(\265/\375`\237\005\r\037"
+	.string	"\026\267\302I\200\332Q:\277`w\306\302\230\013\004\253\205\316\216\2522\360\266\207\3232\244BQ\004\204\273j"
+	.string	"\342\240\033\371[/\265\261\\\2022*\002\361\263\242\257\227u\f\345\035\035\217\3103H4\353\340\241\231%hW?id\023\271\223\f\245"
+	.string	"\243"
+	.string	"\263"
+	.ascii	"\306{\357\263\370I\276\361\323\231\360\227\201\037\362\006#\b"
+	.ascii	"\311\030\025\334\262\004~b\276\335\376\306\314\025y%\274_\271"
+	.ascii	"x\200{\251\3008@o\031\211\2762\337x+\336\217/\330v/\017\253("
+	.ascii	"\367\"\0270\003\364\326\300\007\234\267\346\005\234\267\314c"
+	.ascii	"\026s$\361^\013\210\214\2544\367\336\\\367\340\0017\221g[y?\255"
+	.ascii	"\331\225\307\307z\225\032\203\3613'\b\025\025\364U+\004\307M"
+	.ascii	"3\202\325\021\0379\301\237\331WI\260[\020\252\366\267^\245$}"
+	.ascii	"f\312 \216\327\232\204{/W`\360\306\271vf\216\301\314\023\230"
+	.ascii	"\255\223D*i\002\342W\355\333\022\260\342\233\271\304\2478\241"
+	.ascii	"\357:*\312YV\2718o;\013\210\306F\217\342\004\244cf\023\347J\021"
+	.ascii	",\357\275\017\236\034\312\t~\325-#%\325\003\223\316\333\367M"
+	.ascii	"\212"
+	.string	"J\332\261W\3370#}\265\207\314\327i\271\362\203\233\212\331V\331\347\254\334\303c+\357\\y\326\371\325\217\373\361\007pV\306A+\333\320\312(Z\271\206V>k\225\355Y\331\264\225\333\254\\\315\312'`\216\t}T\265\031\362\332x\303\346\222\331\256 W\376\314\3477\271\222\277\365$\357Y\327\342\247/a\bC\343T\367\376tc\322\0371\266oe\302\322\216f3k8\030\2420\033\356\205(G\274\367\352\316\322\037\342\322\354\333\226\260\342\321\247\2319\274\213\322\261\376#\005\206e\246D\003r\366\220o?L\236n/U\301u:\252\247u\232B\030\277\354[\370\213_\305\036\330\213\275\316\333\236&p&\354\231\367\336k\201\256\323<}\"B4PS>\255\035TU\314\036\362Nw\357\260\316~U\r\223x\226&\224?v\262\017 B\324\003C\234\267;\375\255\277\206qjGW\227}\271Rv\017Y\254\251"
+	.ascii	"0,\025Z^\351n\241|\003\314Q\233Y\304\255\264\330\210\2039\005"
+	.ascii	"\005HHu\311\204\n\364\bC\022S\021\213\223\215\202vi\212\246\243"
+	.ascii	"\024\205\021SN\005R\221R\316h\307\224\013:\300K+\322]"
+	.string	"\216\305\322\322.\307\310\336\233\212\257u\013e:\222\\\226\257t~\353\031\312\204I\256\376\225N\237\016m\310z\355c\034!5\252\r\020\2557\244\322 \022\"\316H\201\2102p\032\367\303\222f+Rcp\001\242\331\363\327\211\266\255y\302@\271\361\031\251\275!]\205\221\006\325\2136\316\013K\261V\274\233/$g3\324`\271&]\260TSk\034\021\261\264\343\331\314<\253\247\0312\263xI~fH\310L\nT\346l\234\224X\32163\205\243U0s\341d0\344\226\001i\250!4\343\024\223J\315\210\310(L\ni\f\300\002\231!\0337\021P=3E5\3112\332\3323\321\305\257\223\030\207\222P\244\375.\304|^\001\2575\273\243x\204<\031\226\b6\375\031T\\\216]\r\353\372\0050\237\304F\030(\312\203C=\312\242].J\032\236|\005\021\276y\033\230h\224\327\r\013\027E`\220\226\246\r\331"
+	.string	"\2445\\\234n\315-\024`\246\370\034\203\260sb\210\032H\030\317\372\320\035\230\016v\226|"
+	.string	"\f_\002\343\223n\324\257`\245Tk\324u\244\204\b6\026\264\005\211d\251\253\375\350\022iGRs\026\320F\351y2Le\356\020jbx\031\307\242\321F6xx"
+	.string	"\003u\340\246#"
+	.ascii	"O\222(\330\356\270\005\017~6\217\3645\213?"
+	.text
+	.section	.gnu.lto_getTaskHistogram.48.a3940a5ca6de62c7,"e",@progbits
+	.string	"(\265/\375`\205"
+	.string	"\025\n"
+	.string	"\366\022E< \345*\035`\235!\n\315\252\302\252\210\037e#\024\006"
+	.string	"\304\034\204*Aaw%\264\r\273e\226mP\313)?\325\025"
+	.string	"\240B"
+	.string	"\364*\270:*\031\214\030\226>\226\321\340F{\247\0240"
+	.string	"4"
+	.string	"2"
+	.string	"\324\340\003\336)\346\034\357\324\242\255\3738\262\267\255t\324\\v\267N\221\213\227\242\177\223kZ\256\325e\200gw-[\256\217{\3366\202m\217}\202\264_RN\214\005\242e\327c\007`qT\205\304\3667\266\345\370\022\3614\325\005v_\001\0322\247\0363\227\366c\227\211\237iX\263\013rK\331\035\025\274\220y\f\2661n\273(\310\355\256\303\311QB\037v\352\023J\276\205\252e\244d\016\346\253\274S\312\241{\231\261\344\316\036Wr\206\330\307\354\356z\276\354\317\376\371\245\017(\361\231B\322H\023z\230\b?&\317\240\016(\2428\205D#PX+H\237R\005\201a\355\034\370\263\020\201\325\364}`\335\214{\314\316\227#d8\326\334\260\375\375\226J\b\021"
+	.ascii	"i\331'c\032\302\206\341\254\206i\212M\253)\023\bk\275iV\260\013"
+	.ascii	"k1\314\013\302oj\n\334\013\246\246\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_getGyroPidDeadlineInfo.49.a3940a5ca6de62c7,"e",@progbits
+	.string	"(\265/\375`0"
+	.string	"\025\b"
+	.string	"\302\01798@o\323\001\230\276\341\204\020\350')\032<\347\336r\2574\201\225I;\363\375Z\3665\322hDx\320\235\344p\2738^\231\271]\274\261\264\303Hd>g|\333\233\354\235R[\203\246P5\317'\353\324,\300\030\207\253\037\211\254:` \252y:\017\024\343@\224C\340\r\242r4b\3338\252\t\367\326J\320\f)\251\221\254\260\177\372H\310/y\242\213\377>\375\023E(\252J~w}N\217\226\217\214Q\\\331\241(J\r\373\326\356\256%h\337\364Gk\203\262\262P\262{\261z\331\324<\351\320\330~\264\017\362\020\357\246\356\002\273\240\212\311nh\340\203\314\247\303\017\\\237\231o\256O{6\313C\216=\211\312\002\345\262\273Tn\334{\364\374\213\034\340#\211\0361\t\273\353\370\2210ny\333\005\266\021l\243\002\n"
+	.ascii	"i\331'\323tS6\006s?\306\206\202!\227`\233\325\024p\227\027\355"
+	.ascii	"$\003"
+	.text
+	.section	.gnu.lto_rescheduleTask.50.a3940a5ca6de62c7,"e",@progbits
+	.string	"(\265/\375`\324\001\245\021"
+	.string	"\326`uH\340\322&\035*\002:h\373\032\210V\302a+E\245{]H\323\201\\\277\3745\261\243\007\316\214\246\370|S4\332%)j8\363\215\f\357[0\034\207\253\227\251\200\364!\204\314A\272"
+	.string	"\364T\204\021m\030\261d\357\275S\n]"
+	.string	"\\"
+	.string	"b"
+	.string	"\273b\002+\330^K\236\322^\351I\264W\273\354\036\027}\366D=l`Av\227\233=w]\253tJ\227\377\240\233\300P\346\332\206\363\212\nkh\311\356\236\302\r\222\216\2048\237\364\200\216\r\020\250\220\206\246\220L\354x\320e\207\360%e\251\301\356Z\202\341\315]\272\355\225\355\024[\016\b\217\301n\355\342O\017\364\177D@\b\244\224q\327\3038d\217\352\f\024\217\3750\373/|\242\230i|o\366\034f2!I\273\373`{\013\177\310\247W_\350.\\\207\301|k>\230@\331,iWD\360j\024q\373\311\266\0245\310\030l\257\276\264\277\342,\\\007\212\261i\267D\314(7\352\266\335]\340\027y\030P:~`\206~\035Y\216\311Ks\233&<j\200\274\344h:K\363DG\251Q\204\303\246\310a<\006\214\377\343\357E\036|\365_\264Wm~\350\006R\020Q\2213#\307\237"
+	.string	"u\216\346\344q\3521\332'\201\236\034B2\0329\263\305\227\234<\366\3478\216\243\347\216M\245\267\024&\310\225O\345B\277\316[\265 \250t-\217\025!\003\253%\200\212\203\225O\345\242yu\342\261,\274\250\260*\254>\256\245\245b\341V\336\307\235\024pw\201\345q.]\347q'q\346t\347\216%\2108\232\231/\272\273\253\001\220t~\332\255\025y\320u\312\370\314\222\214*\311\210\036\037B7h\344L\312\370\201D\202n\323f\t' p\002B\202F\017\251\33174\335cc\303\n\255D\"\026C\235l\372m)\264\370I!\350q\351\354\b\032\023\231\301\205\206\207ndLb0X\366\210qI\020Jo\315\265\240\340\257\347\213\355=\342\016\213%\310I9V\321\336\265\321D\301\261"
+	.ascii	"\033i\b\371s\262y\277F\273\240"
+	.text
+	.section	.gnu.lto_setTaskEnabled.51.a3940a5ca6de62c7,"e",@progbits
+	.string	"(\265/\375`\337"
+	.string	"\335\013"
+	.string	"&WQ? O\225\016\307B\300\005\020e\223\3508\004apbb\224AJ^h\001x\006c\n&\205\233\305\230\204\243\244\367\272\001\b\fD\001\302~\203\342\253n\230!P\213o\200\236Ed\223-eJ\001="
+	.string	"A"
+	.string	";"
+	.string	"\237\304_\346\354\026\3776\354G\250:\020/v7S\r\347\01659\037\273DR^\351\020\262\272v<-x(X\331\335s<+x\247L\354\262\273\316\224w\341\276n\033c;\201}\005\001\231\351\003\b\200BE\203\020\273\252\217\030\333\272<8\330\276\375\016[r\211mM\333\300\001\356\337H\300]\2644L \200\374\362\323\276\306=p\337 9\262\213AD\211\335\217\200\013@~UN\211\277`\316n\206)\325\243\250\252\371\260\002\2250\234zUU\026\335j\222\net\035('E\250\327\005'Ht\036\247\374\260\277Rj\006\373pw\327\312\262\377\375\230\246\3437~\230i\315t\034\255\243\311x4\214\203\201"
+	.string	"\312\204\2427\226M\353\2108\232\203\r(\363<\310D\3106\033(\263\f\360G\202\266e\241\317g\313$\337^Yf\220\242e\322\023\2041\243B\265E\023\362)\237\343\027\nZ2\246Q\003\025"
+	.ascii	"i\3317\323\342\235!\013\216\002w\300\330T\265\f\\`\017\212e\t"
+	.ascii	"f/Xb\246\0244\003\033\2561\244p\267@5\r\234 `\300\243F\366\207"
+	.ascii	"R\006"
+	.text
+	.section	.gnu.lto_getTaskDeltaTime.52.a3940a5ca6de62c7,"e",@progbits
+	.string	"(\265/\375`X\001\315\016"
+	.string	"\266ZbE\360\320&\035\330[]\016\321\252\244\277\001=\276\347G\343\232Q\033\356\273l\326\207\256x\"\302E\354\364\322\016B\222\213\340*\232g\303\216\327*\334Z\034\006\317\274\020)\230\216\346\021\245\200\323\201\315\016\262\367\2262\245L"
+	.string	"J"
+	.string	"R"
+	.ascii	"@7vw\0339H<|\377\210\207\332\341\334#|\232\234\037\363(a\250"
+	.ascii	"\bzt\024\336\310\356\232\272\t\371\036\f\255hu\032\256\217\300"
+	.ascii	"\254\023\362\350X\017@\317\321\207\377<i\272\231L\315d"
+	.string	"w\235\255\016\303\255\3356\002\333%\366]\0016;E2\030\254D\262c1\2518\366\337\352\215\243\323\360\260_\235NM_\013\251yq\200\304\356\205$\034\353\002\252p\331\206\261M\2663\017{qi\227\003\013\024\2731\001\036\320qh\333\017q\0210\346^,\247\323<\270*\004)VI\245\342!T\315F\013\037\330g9A \340\207\310\316\f\031\021+\2214C\n\0134\236\203\007q%>P\204U\307\356^\307%\036F-\301>\3422\027_\307,-\371\326\241\337\022\017\257Z\017\221\217\215L&9\006O\215\032U\034\203\374%\252\006(\006RV'+\321'\022\025j\001\013\n*\301i\2651Pp\242\262\235T\253\215$\200S\rP\252m%\225Rm\246\330\376\255\336\370\033^G\317\347\342s\274\204 \324\377\274$\343\305\243QSi\324&2:\023Op\"F6\204\233X\205\030\355n\201\022\237\005\037"
+	.ascii	"i\355C\3024\200f\317am\261m\3378\212\300q\311\r\323ch\0308\017"
+	.ascii	"^\201\273z\020\016\267h!I\213%\241\214\243\250\366\216\312\021"
+	.ascii	"X\224\267\t\3115\234k\002\273j\274\233\tW\374d\023\341r\340\234"
+	.ascii	"P&\254\264\217FPP"
+	.text
+	.section	.gnu.lto_schedulerSetCalulateTaskStatistics.53.a3940a5ca6de62c7,"e",@progbits
+	.string	"(\265/\375`&"
+	.string	"\365\007"
+	.string	"RO870q\323\001 Fc\f7\013\323\342h>c\352@\225\336\007SG\322c\3627\335\227\303\357\fU\335Lb;\007\036_\300\301 x\355u\244\f\245(\316Gk{\247\024V}\310>\225^[\275\266\2719P\324\371\261\266\211\201(6i\201\251G\2630\220\2045A\253\264\270f\205\244Z\225\036\003g\027\226&\267,\323d\347\333S\033M\020\036'R\3140\214>\312?\221Ob\214\020|\367\312\017\001\274\342\264\304\230|\220\340\215\375\215`\004\261Om4\331\367~H\rt\300D\274\354n\334\330\354\251b)\261\375\216m\bm\205\005\356\236\210\34042\236\313\356\207\340\204\200W\346\354\231\177\"\373\025\025\215\224\232\335\2251\344\334!\347\377\344\002]it\310a\330]\303\256\304q\307\333>\260\335`{$\t"
+	.ascii	"i\3317c\372\365\206i0\255\2700\206\007\233Kj2\270\313\213v\222"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_schedulerResetTaskStatistics.54.a3940a5ca6de62c7,"e",@progbits
+	.string	"(\265/\375`\331\002\275\023"
+	.string	"v\341zI\300RN:R\b\265%\363Z\337\203\254Tw\177\342\315\350 >W\246\300\262J\002'\301\354\3702\231\374\251\037\231v/\030h\217\274\345\336'n$"
+	.string	"\357\rG\301Q(\214q\316)\204\205\330\232\331w\224e\355\336{\357\224\002a"
+	.string	"_"
+	.string	"i"
+	.string	"\261z:_RO\215\263\253\336\333\355\233\234t\276\254\335\225\311\022\307\335U\351\224\021\347_\351#`\230\273\313\257\240W\035,\374\211t:\370\361\002\213$\324\315\030\320\021\b\013}\342\004\020\006]N\025\237,\021$a\317\f\240\245\353q\245G\017!O\214.\t\273\353\b\206\037\356\327mo\260\275b\313\223\276\301\211\007O}\234zzI}UC\204v\342\226\247\236\222\206\244,r\354:\265J\004G@\226\250z\242\226\335\313EYd\177\356\356Z\022\331O\372\253\214\2462z\306\350\0238P\344\347\302\264\013\264Ed\245(\f\036\314\366\243}\023?\201{\222\216GvGD=\355\366\036\030\302\353\224\301\003\340K=\025\340\203\205t\365\237\037\013(Z\262\200\307[\202\352\211ZR\210\207\3427\007\304\357\215\243\242|J{F\213\007\2552\364#s\366]p("
+	.ascii	"\332\026\336B\346T\301\224,QN`\210\2317\215\004\261\312:\323"
+	.ascii	"m\232\257\200\201\260B\252\251v\355*j^\273\273\342\373:\334\f"
+	.ascii	"\354\214r\352i\212\217\253\247\370R\216o\0241\023fn06\325\263"
+	.ascii	"\024\033\r\303M\f\355\302\354&\313 \003C#\233\331n\262\224\023"
+	.ascii	"\3274\320l2\233Z\315&\203\365\366s%\221[\266\244v$\317\334\335"
+	.ascii	"u\305\242\335BA\312\\\002\022;\252z\023\336\324\323QNy\354\220"
+	.ascii	"i\260\373\335L\244\250d\321\301\024\005\225\243H\b\322\r\033"
+	.ascii	"5`>,\0325&;\333\366\031\267\b1.\243\202\355\362\022\037= \260"
+	.ascii	"\002\021\301\241\033i\33774\035\213\r\273\025Z\201\223\024=\022"
+	.ascii	"cHW%\233\315\211$v\350@\235\231\321y\0265\341\235\215\373#kL"
+	.ascii	"\007\313\311\307\355\351\206#\356r\354C\364\224#F\001\302\214"
+	.ascii	"\034t+}\3105\n\235@\224\271\341H\252\274\0236^)\317\343\234\003"
+	.ascii	"\233\271\013\336e\017d/\306\224\240\b<I\211v\347x{C\226AQ\336"
+	.ascii	"8\307\303\206\340\263nX\304bt\360\310\277I\342\235bLk5\004\001"
+	.ascii	"\005"
+	.text
+	.section	.gnu.lto_schedulerSetMode.55.a3940a5ca6de62c7,"e",@progbits
+	.string	"(\265/\375`\317"
+	.string	"\305\013"
+	.string	"fUOA"
+	.string	"O6\035@\361\274\017\352^\234\001\372\214\020W%GM&\f\251\"\302\340\321\353O\204\335\327\363\267\266\001\223\001(](q\013\201\377\377:\006\311L\027si\006\340\357C\002I,\r\332d\313\224\002="
+	.string	":"
+	.string	";"
+	.string	"$(LX\305j\255\335\354\020nxmn\350?u\2078n\256q\237OM"
+	.string	"(\305\347\344\327\302\350\321 +6\260x\352[a\354\354f\034\250\265z\305\021\303Mo;\201\355\002\366\021\004>\352_\356\255R\314E\005E\255\027f1\252\n\312\362`\237\264\037\177\330\376\332\017\361Sx\224\306\216Z5\2240Q+9\300\004\270S"
+	.string	"\207l\247\3325\266S\207v\213\223\243\372\236\225\215\300\330E\3132\026\271\277z\351\023\021\354\262k;\245\034\312\017/v\372\"\256\322\370$K\310\354\305S?\263\235FL$\320)\003gg6\331\331)\262\177\021\353U\362\f9\036\345\263h\236H@\217\001\206\342U&\227\256\301\002\005\226n\002^:I"
+	.string	"\177\016<\260\203\360}`\367 9\237!\323V\t\006\2143;\032\267\366\203\313^\364\234\033\003#\031l^\263\355\3340\201P\275\002\026"
+	.ascii	"i\3317\323\342\236C\260\006.\231e\177\332G\274h\302\"X\231\360"
+	.ascii	" \263\240\343\210p\031\251>G\255\001\034\331\250\365\356\202"
+	.ascii	"\257\246qb\325\3128\3111\257\3043\250="
+	.text
+	.section	.gnu.lto_schedulerInit.56.a3940a5ca6de62c7,"e",@progbits
+	.string	"(\265/\375`\343\001\r\021"
+	.string	"\346\234iH\340\224(\035\220\247j0\376\005\341\250p\025\003\361U2\340\037\261\247z\333\325N\331\341/IU\b\233\027\326\317\332\376V\016\250Y\337\344\213\355\007#\216\306a\003\343y\013\311l\020\256\023\022\0018(\377\013\240\275\311\226)\005Q"
+	.string	"P"
+	.string	"X"
+	.string	"\2360N\200a\255\025\364i\313\330\240\317\0059e\037\271\370\252\307a\302CNO\255\325\223+\236z'7\345_v"
+	.string	"\237K\365n\346\262C"
+	.ascii	"\376\230y\355\013\302\325\352\004\bIa\344\264\357\007\027k\267"
+	.ascii	"\244A\255\325\373\271F\334\363\266Sl{\366\212\002\263O\033\\"
+	.ascii	"\016\327A\252\374\243\250\237s\033\312\207\371\005f\377\301\320"
+	.ascii	"O\0061\0370D\262\332\037[d\255Ta\277\253\262\306\226\353\207"
+	.ascii	"\024\300\300\022-@9D\254!~|*\317\324\261\261}\237\306k\027O\213"
+	.ascii	"yh:\322\\\264c\354\313\370L\346a\003\366\341{\260,\021;\301y"
+	.ascii	"D \360\252\265.\030\277"
+	.string	"C\302\004\221\210RhY\331YF\0219\\K\252tF\276\315\0278=&\367s\\\207G\222o\276\321\317\211\002'Fh\377\272w\250\311?\3437J\001^\265\256j\334\206\213\017\373\364\205\322\376+\321\231i\303\376\363\003\036\235\234H\030^*\220,\214P^\006\227\226\2227:\241\274\223\0036i \235<\016&\323\311\003\211\253wU\326\240\21479\334J\262:\003\353\323P\034H\251\272\213\017\344\221W\241\227\005b\262Z\221\326&\t\362\300f\003\3421\3057\026\261\233\373\370\216\n\204\225\375\267B?/\351H\202&3 P\0021\206\025=\251\356\223`zL2\204-\264a9\263eA\275\235\270\006\244\366\030@'\303#3\f\001\002\277\3441\332\210\334\200@\326\320\350\353\230\325P\213\326\255\2031L\006Kn\340\004\022_\324FJ\213\363\r\235\241u\004\271O\2735\340\016\2660\204\242\346hn\016\022\237"
+	.ascii	"\254\211\314\036\204\036\2620\f\203\310\270\033\333\b\002l|6"
+	.ascii	"!8w\027\347R!\240"
+	.text
+	.section	.gnu.lto_taskCheck.57.a3940a5ca6de62c7,"e",@progbits
+	.string	"(\265/\375`A\001E\016"
+	.string	"V\\cD\360\224\223\016X\242\272\212j\377\255Z\232^\275\214\030\321\245\"T\340{\250'm\2313\024\357!a\337\030\006\227\217-N]\3349R=\317\300\365\274\234\025\030k/\320\007\016\201\273\206\001!i\020A\366\2262\245P"
+	.string	"J"
+	.string	"S"
+	.string	"3v\275\003F\200=\332\273\311\365\210}\300\365h\333\tRJ6\335+A\243\345\234\220\301\331\331\3656%q\323\241\246\311\367\244N\207X\315\025\032P\345\250\321R(h\242#\302\307[O\017\251\230L"
+	.string	"*\273\353\234I}\270\343m/\260\315\300\276\212\372}\337g]\331g\375$\277\3713\2471\247/\247\343\225\2061\2551\2350\375"
+	.string	"\307\001d'H\205o\227\3463\262;b\r\024\266K\266f[\275\267(\375\306\305\331n\b\")\330\343\t\314\264\317\3426\245\263^.`wu#3\227F=%\215!: \324\246+*\204V\217\230,bOB\315\324\327\250'\033\364dU\250\267!s$5SU\0029\034R\240B\207\341\222z\035<,\272\013\r\n|\034\t\031\260\335\275\211G\377\345z\274\252V\bQ\331\260`\362\263\275S\352\b\373\001\243\007\\\b\344\200\304\302u]\313\247\304\302h\205\004\375A\351\270\013-\0218\n\237\321\306\002Z\tm\237n\264\241\024\260\b\003\327m$\221\250\3334o\017WW6\324K\337z\203\037\254\0272\3621\216i\007\333\230Z\005FQpw\027\226d\246$jO"
+	.string	"\345\003\026"
+	.ascii	"i\355\003\303t\214\306\036hEQ\022\340\340\306L\254k\366\302`"
+	.ascii	"\036\264\244(\257\243\032\255\025M\301\n\277\270\346\344L\304"
+	.ascii	" |\246F\301eKS\023[\256\2461(("
+	.text
+	.section	.gnu.lto_heapCollectReadyTasks.58.a3940a5ca6de62c7,"e",@progbits
+	.string	"(\265/\375`l\007}("
+	.string	"\312F|\017Cp\236J:3\340\006\212[\360\210c]O\261\030\017\335\004\243\017\265d\217*\270\247f\313`\360\317\312\245\254\356H\350Y\305}\032\371ks\312[\230\302\242\261XSh\305\225\342\363\007m\244\265\326\b\221;\245\337"
+	.string	"\330"
+	.string	"\350"
+	.string	"\311\340\205~pf\017?f\265\326\266\277\325\270\233\267\256\355I\273\206}+_\263\361\244\205\306;f7m\033\366\360\2469\264}j\377\354hWO\263\262\260\32602s\265&!8B\360\346\321\007\374n\226\027\372\335\364\225\r\347\311$\025\330\204\r\227[\236Z\253\322\"\361\220^\035\b\300\360\024\006\201?\263\\z\345\003\335\330\364\262\034\261\0164<jQ"
+	.string	"\345\256]\251\373\031\257!e\0054\263\261\253\201\321\241\361K\310O\340\205\267\377(\f\236\361\002R\036\265]A\024\257\037\024\b\367\005da\316\364\374\302\276\202\334$\036\215\345Q\255ux\274A\313\362\200\336\335\024\342\221\253\\"
+	.ascii	"fD\313\333Ns\034\267\350^\355\033\336\270\231\023\366%\344\024"
+	.ascii	"x\241\326j\332u\374\272\211\267\215\307\266\n\033x\006K`i8\271"
+	.ascii	"bDj\321>_\316K\017S\305`\257\326*\341r6\322\353\212\t\222\324"
+	.ascii	"Z'|9\030&\237\311M\273h\242\357j\372\335\f\332\317\235\022\361"
+	.ascii	"q\206DK\313\242}\213e\310\2210\273bvR\213^\302\031;"
+	.string	"%\336#\366Im@HmtR\0278\251\213Nj\242\223z\350\244&pR\013\235\356\016p\271;\350i?QH=<\251O!\265PH\035<\251\201B\352\237\220\332\024R\227B\352\rRS \365\035 \350a\346\t\257V\036}}j\236I\347\344r?\235}7\277\013\235\324\321V\262\036\201t\342\314\325\fA.\227\363\347<\214\273\242\272\233)\224IA\236Q\371q\316r-T\337RU\326\037\311\372e\201,\317Y\236Z\223\017n\332B\360\246\003x{f@!:\264>\\\206#\242\305\363.:CK\264'Y\235\021\031\264t;U|u\276\370\364\224{8k\370\034\253\003p6\210\313)\022\367\3424\030\003{3\264\207;\255\342\243\b\022\355\007qw\313\245qF\244\326\356\276\355C~\270\376 =\300\n-\222\233\361\216\315\341m\244\250\333^\200}\227\227j=\374PI\313\242}?#\332\341\203"
+	.string	"\2739\336\203\274\3632W\314\207\372\321}\030\021%n\320\332!F\320w\321\025`\207\227wc\261\316\207vF\244\364\214\3377\212\215\315\026\335c\273\304\323\314\b\372hV\230\b2\251\372\335\374\216\225\231!\321\322\204\350\203\373r'P\320w\231j\251\223\267\265X\026q3\305\003ywE\342^\031!\035\201\365\307\334\316_|&Va/\364]\366\362\273I\343\272\350$\375\f~\221\304\344\3244\245\364\004\345\344\004U,b\241\202\302\220Z\232*\245J095\221\230zb\212\212\242*\002\271\230\024\305\024\203\252\005\323\213\242\224\322S\323\222\223R1JJ)I\201\241d0E)MAAE)\r\223Y\337#)|\344e\255\326\022 \251\237\001\2416U\260\352\350\341\031\255\201%\2623\\\342\032\355\327^NI\223\204\242\346M\003\365\262b\220\3046\022\345Q|\033\3351\\\006c_\2756kY"
+	.ascii	"<\370\271\277\303v\267E\367P\035\347^\355\224J\331\223\227\265"
+	.ascii	"\326:\\11g\321\372o\005(\216\242-\260D\271\252\214\364\206p\377"
+	.ascii	"f\rT\353\315\366@\263(V_\321\376-\270\346\n\227\006\233\220h"
+	.ascii	"\307\207\215\023>\260\340\2129\270\277=\031\033\036p\203{\265"
+	.ascii	"\367\221\002\356\333\326\244\231K\334\337\226e\214O0|\217\225"
+	.ascii	")\246L\016\022\355^\002\200\223\250a(\306\030b\b\325\214\004"
+	.ascii	"\2214I\032\003\260\002\221\261);\021\240133%\023JA*\303\030n"
+	.ascii	"\021i\332\275\200*\256K\305G\211x\267\214\234\330\274f\273.\223"
+	.ascii	"y\226\275+P#\334Zv\202\330\326\325\220\f\311\361@\372\002\245"
+	.ascii	"\254D\300\214?s\213zo<\276#\371\255\360\fy\251wf\037\314i\006"
+	.ascii	"\310K\366\336;\r\316\342\372Y\233\304\231\330o\345\264I6\310"
+	.ascii	"\367\366\257\325\341\203\376\343Q\352\007\001\331\210,\3428\214"
+	.ascii	"\313w,\020\327>\374\003I\346\222\312\271\300\306\374]?\210\300"
+	.ascii	"\215[\213\306\n+s\004#\20704\342\346\310\330}\327\304\335\n9"
+	.ascii	"5ppG\t\\\312\277\207\032x\312-b\303,l0H,^$Y\027\025\fG\226\024"
+	.ascii	"\217\333g]XU\215\234\275a\017 \312\240\267\251\007w\376L\013"
+	.ascii	"P\356\305\250\232\230\307\007\316\366\377k\345\303\006\266\004"
+	.ascii	"4\311QLt\n\274|\353]8W\232a\356\3424\211Y-\203\340p\373\347F"
+	.ascii	"\021hgK\270\246\345\\a\217]\203t\024UW\305B\276\255\371\233<"
+	.ascii	"\372\007"
+	.text
+	.section	.gnu.lto_scheduler.59.a3940a5ca6de62c7,"e",@progbits
+	.string	"(\265/\375`\f&\205\252"
+	.ascii	"\272\013\265;M\020\030\206i\215\001\003\001\025@\210f\221\274"
+	.ascii	"\277\037\237u3\225J}\"\212\204\025m\224\246\327\354\261\2637"
+	.ascii	"e\231\231\t\030`\232\207,\360+\265\337\337\375\364h\211\2319"
+	.ascii	"\361\212\211\311\376\277\337eh\020\024\370\337\331\265\210@~"
+	.ascii	"#2\245\224\002\247\003e\003\277\003K\347\242\2453\321\322yh\351"
+	.ascii	"\214\001\310Yh\351\274t\235]\3279H\351\f\344:+]\347\237\245\263"
+	.ascii	"\317\3229\351:_p\235{\224\316H\327\231\307u>\0069\033\201\234"
+	.ascii	"\333w~\245\263\3778wwi\275@\252\021'^\237f\356\375Z\274\363\006"
+	.ascii	"\032\2718\351\305\356;\335q\272\013\273\377\272\311t{\351\336"
+	.ascii	"\322\255\327\r\327=\327}\245\333\256;K+\231\333\337E\251\023"
+	.ascii	"\356@a\002\247\017y\310\235\310\311;\314 \255#\257\353\325\346"
+	.ascii	"\311\"\234.H\304\354Q\335\364}_8M\247\337\364\034\346\017\372"
+	.ascii	"\220c\214a\251\223\206[N\033\026\212\320\276x\013<A\\sC\2661"
+	.ascii	"\016\320\363+P\t\362\r\363\007\314\204\307\351\324\315\232f3"
+	.ascii	"\025\307\256\016\025n\2129\211\246\261U\235\206\237O/\215\n\307"
+	.ascii	"\311\252@\346\344` \367\2352\201\354c\006\370\003\204El\367q"
+	.ascii	"\373q\222\214\b#(b\341\352\214!\305\364\230\004t\037{[\002\230"
+	.ascii	"\223^\032\214\217\356c 3\324\264\367}\223_8\271\245\007\226b"
+	.ascii	" \373`NraN2\367\225\233\217\223[~\364\013\005\353\341z\363f\002"
+	.ascii	"\267\026\356=N\266Q\217\277 m\315\275a\031\330\301\203\013C\266"
+	.ascii	"Q\331qm\245\351\372\256\3638\211\327,8;\213\b\310,0d\336\327"
+	.ascii	"\024N?\221mDj[\350\210\245\353\234m\367\243}\247s\257X\215l\230"
+	.ascii	"\020\346\220-t\274\002\004I+\350\335\3722\262\326\001\262\255"
+	.ascii	"-\347\3549 HZs/\330\214,V\002d\033\203z\350\330Fo\241c\033U\264"
+	.ascii	"p6\\\020\244\254\271\367KE\026\016\\\235\367\235Sj#\243@\266"
+	.ascii	"\321\311\354\246\347\316\336~\323\025\255\253\363\276o\323+\301"
+	.ascii	"\320\355\\s\020\227`\242\326\3315h\314\220\021\003\306\013\027"
+	.ascii	"N-X\254P\221\002E\023\323\211%%\023\006\224 1BD\b\020\037\222"
+	.ascii	"\220<t\340\260AC\206#\243\"\242!\fBK7\bH\371\343\223\274\320"
+	.ascii	"\203\3449\032\333w'\367\030\231\347`\226\260\254\256\301c\003"
+	.ascii	"\333\037\324\302("
+	.string	"6\215\031\211-\343\216\035\217\241\210\3500Z\023Ch\262\376\202\307\206\213:\355T\307\320\215\267 l\026\204m|\205 X\035C6\256bM\247X\223U\343(\260\335\204\235\003\350L\202`o\320\374\371\211%\277V\"\323\202\233@\2438\306\r\020\003\350\346%\3024\211\326\304\320\210=\021zf\256\036\342\332 \314\344i\361\017IY\032\t\257Eb\301=\340u\007\016\326\026\211\r,\3167di\r\355\320\227\232\264\005\301\340Z\023p\370\3464\033X\025\317 \307\006\366\346G\200\355\213\3300m\304\006\226\346E\202`T\2768q\"\265\036jixA\341\253\005\301\232\264\316DM\234\366\243\342\030xl|iW\f\204s+\023Sk!1\275l9\f\376EiA01\355\007#H\362:o\211\273-\017\t_j-\b\206\326\276@\204\303\245\367\242\036\224D\354\254\201Z\023d\355\220\262\005\301\250\375#\b\266"
+	.ascii	".*\270Ok\251\320I.\235$\bFf\304/$\365\224\211\025id+4\246\005"
+	.ascii	"M\013\202\215\265Kh\240\024i\276Nb\003\233:\017\217\215\275n"
+	.ascii	"\331\354\340\301e\313\304\316\372\210\364\276/\324\215H\024\272"
+	.ascii	"m3P\311\230\240\f\333jE\224Y\241M2\214\004\377v\005\tu\214\264"
+	.ascii	" \030\223\326\0071j\246\363\332\271\302\236\356<6\336\367e\227"
+	.ascii	"\206\2115\037\320\314m\0333\313aN\352 \211o\027\226\240\257\262"
+	.ascii	"+\213\336}\212\222U;^?E:>\307s\271\262\245\357>-\275\340*&z\375"
+	.ascii	"i\351s\233|z\003,5\217o\257\357\275.\"C7hG}\372\242\003\035\205"
+	.ascii	"\376\311:\345\223P\366\266\224_\035z\036V(\256\001\373\314\372"
+	.ascii	"\371\252\023i\004|s\351!;\205H\n\007\327\270\330\002}\372\034"
+	.ascii	"@\344I\233\344\233\351\370\242/aeR\204\346i\030\374\244r\234"
+	.ascii	"\332D_\364m\"\224:\364\030\236\350y\016\241lK\200\f}\333\241"
+	.ascii	"Y\205\036\303\367\231\320'\301\230q\263^X&\221\343\376\362[\302"
+	.ascii	"\240W\276\373G\211@\037d\006\364\335\367\363X\257\374c\"\023"
+	.ascii	"/c\376<\020\030@\267\244\265\347^\217\3173;\233\370\021 D\330"
+	.ascii	"\226P*\247\033\3101\371>\337P\352\205O\276Q/\252\330\363<\177"
+	.ascii	"\3413\370A\337\220\337\363\035U\324r\342\013\220B~\223Qs|\254"
+	.ascii	"\347y\036?\350\332\323\027\2378\031\363\370)R\370s\263\352\301"
+	.ascii	"\021B\005\371U~:\032\277\313\350\326@\361\351S\2205\3067\202"
+	.ascii	"\361\3136\2238\n?\230\260'\264\364\233\257\335I\034\226\032\307"
+	.ascii	"\374\346\310\020(\317W\231\350\332$z5r\0079\036\235P\243\327"
+	.ascii	"\266;\310\021\001\317\305\307\257\032\3339\345\330\276\227\321"
+	.ascii	"\375m9b\024\007sNA\276\357\226\023\373\327\bN7d\332\217wRc\325"
+	.ascii	"\362\305%\357\372\201"
+	.string	"|\337\367\005;\227\017qV\341Nk#;\343\234rN\271c\033\377[\240q\321\362\305Fz\265I\215_\345\356\2360i\334\3327c\245\366\267\242\373\023\342%\360\027\004\330\013{y\236\273>\267\016\216\365\314\f\b\300[\312>\177]\002\267~\002\263\254\377\325\276q\354\307A\247f\313\021\231\375\351[7\270\323\370\201\b\274\245\021\034\333\330\337\024w\204\0327\325\362E>rf\n,\360\226b\275?)|\263p\236\237\305<\367\364\257\322\321\031\203\3457c\306\273\263\253\303Bw\305\312\234\2345\016\216\310\271\253\274\r9\267\033\225)R\242\264Aa{\342:\367\232\023\265&\235\306d\t\332Y/6\267\222$I\347.\353;\315\215\244\34347\265\013\233\233L\351\334&\37087\221wn\261\366\352-\315-\025\002}\366\333d\232\203t\226f\254\2443\b>\316U\375\327L\325^\232\247Z\257\231\307\007\r\327\214"
+	.string	"\346\216\236k\226\362 JG_i\316\201\003\352"
+	.string	"m\327\374\324v\315\006p\235\013\240t&\200\353<\200 \347\016\3329"
+	.string	"?\316\034\b9o\340:k\340:g\340:c\340:_\240t\266"
+	.string	"\203s\005\030\234)P:O\340:K\340:\003\300u\216\300u\206\300u~\300uv\300u\276!\344\334@;3\240t^\300uV\300uN@\351\214\200\353l\303u> \310\271\206\353L\303u\236\341:\313p\235c\270\3160\200\234_,\235],\235\235\226\316-\226\316,\226\316+\200\234U,\235S\270\316(\\\347&\2453\223\353|\302u^jg\245\245\263\211\245\263\001K\347\022@\316$\226\316#\226\316\"\\\347\020\2563\b\245\363\007\3279\311uFZ:{\br\356"
+	.ascii	"\344\314A\351\274\301u\326\340:gP:\037\271\316F\001\257\300\026"
+	.ascii	"3\201?\262M\r\335N \320D\276\t\241N^K\n\211D\240\215b\005\212"
+	.ascii	"\r\266o6\3772\201\260Ng6@\304Y\225eC\372\226\236\274\321\341"
+	.ascii	"\001\217\365\275\366M\330m\2243stR\260Sd\266\335Y\2679\340\263"
+	.ascii	"Ifr\016\225j\374\363\331\331\271\363\364V\343\033M\237(cgH\215"
+	.ascii	"k"
+	.ascii	"\262[\3143\361\325\245\333B\236\333\022;\"\270\372E\257\313\026"
+	.ascii	"\362\314\347b\327\275\232K@=\267\313N{\0348\376\263\354\330\320"
+	.ascii	"\255\301\361\354YG\374\021u\226P\302\261\215\027L\321\270Mi\320"
+	.ascii	"\341\232\3612\236\306!\327\214\357\2312_\306'\007\207\200\211"
+	.ascii	"*\306\370\302vv\035a|\2147\016\307\331\365\205\201\267\024\203"
+	.ascii	"c\033a\220\340\2633cc@\t\321<\022\355\204\2027\211\321\253Q\213"
+	.ascii	"=\225\224\261\260o\007\211(\265\366\200\304\001\214\334\253\241"
+	.ascii	"\250\210\272,\266\311CS\245D\b\247w\021N\335f\227\202\332\b'"
+	.ascii	"\017>\352\271<\004\325\273\b\252\013gO\252D\257#\250\236[\020"
+	.ascii	"P\177\200.\303\034\244\314\t\3338Q[\243\206m\362]\206D\223~\361"
+	.ascii	"\3118urh^\374\325\224\214\333\022\235B$#\\\374\217\225\272*f"
+	.ascii	"\\<\0074gB\275\247\231\210\257r\233i\007\034\302\244L\013E\240"
+	.ascii	"x!\272\216\033%^ \336\214\217av\032\032\332\300\t\320\244~\237"
+	.ascii	"[\244\035\037\302.\314\r\207~\276\324sy\360N\177\202N\337\301"
+	.ascii	"\264\317\r\354\303\373\313\025\244w-\002Y|\213\025\237\342Y\250"
+	.ascii	"\370\025\177*\256Y+e\242\230\220\364U6dSsEJ\361F+X\354\244 \203"
+	.ascii	"\342S|\333\364'\036\305\0371}\323\030\246\357\276\245\307\372"
+	.ascii	"\023\177\f\263\364\2158\335\313>\257\2549\363\360\325>\266\251"
+	.ascii	"\026*\206Z\035\236tT\360\265U\341\240\364\355\306\205c=\025\021"
+	.ascii	"\347\t\336R\245\377@A\262@\022>\213\317\224a\0177\354\370\206"
+	.ascii	"\376r\005!iL|\027?\003\336\304\033\023\241\324\022?\342\rx\243"
+	.ascii	"C(\033\211/\301G\342{\314\264.k\035\361W \033\214z\"~D\210\027"
+	.ascii	"\361F\302\250\"\210O\372\020\237!\021\372\366\341A\350I}\370"
+	.ascii	"\376Cz\254Oz\236\304<&\322\037\213L\353\334Zo\317M\216\006\265"
+	.ascii	"\366\360\315\306\002\020\017o5\305\222\265:[\234\2624\031\276"
+	.ascii	"\352c\335\341\256Y\346t\353\360\r\330\336D\356\0165\316\372R"
+	.ascii	"\332\272\276\216\210\362\272\201\"\027\353\366k\016\256o\242"
+	.ascii	"W\fN\244?x.\256\0334\nk\016\377\212t\316)\034\276\357\320\236"
+	.ascii	"\020\311\032b\321W\371\263\321\274\241f\362\022D\363\204Z\354"
+	.ascii	"\247\244\364\324\367\227.\262c'\253ppM\373\276\357K\024d\211"
+	.ascii	"[\231c\362=\\\226\274\365\277H\345,\365\0228\023\276\301\264"
+	.ascii	"W\371\n\244\306MY\300&\0013\364\325\r\200\032~\303\273^T1\310"
+	.ascii	"c\275\206\3577E:\320\265\fo\364A\376\317@\251G\237\341\315\231"
+	.ascii	"\302\321\367\235\032\253\026\025\021\2464\315\234c=\216m4\372"
+	.ascii	"\366k\307\312\265Q\343\276\205\"vt0|uL\024(\336\346$[\200S\005"
+	.ascii	"\025\304\236\007\211\241\033\027\245~\342D\302^\306\264/\361"
+	.ascii	"\272C\2053tJA\314\022!&\357\264\252SI\347u{\001\362\3614\221"
+	.ascii	"f-\333\240\247\357\264\347\362\352N\373\r\326E:\377\026\"\"\215"
+	.ascii	"\033\2724w\356W9\211\b\324^\020\\\335\242\327\243R\363\310q5"
+	.ascii	"\022\275\036\271\201\034u<\027\267@\006\370\316\353\033o\310"
+	.ascii	"\242\327\243{\365\323s\361x\027b\343\006I\341`\007\274\203)j"
+	.ascii	"\212y\325DU55U\225\343\b\307\223C=9\017\036P\nDYUy\020\225\300"
+	.ascii	"\021U\025\323\275"
+	.string	"B \352\312G\216\250\021\030\270\032!\212\352\347\203\036PW-\223\351=4\210\232bfpE\025ee\345#\307\217\317\217+\246U\025\323\252\202\034\314)(\252\037\013\350\210\272\312\021\305#\252\207\206\036\037\364\200\312@\212\212y\305\204\022\301\207\007T\bVQWT\017\350\260\202\362q#j\212y\305\003*\352\202(\035\314\036W>\2526p\016&\253(\036>tD\355\310\321\243\211\212\t5\325\224\303\252G\023S\022W\201\020e\325tUUe\325\224\234\323\3527\023\202&N\240\326?k\314\350$HC(L\242W\031\215\366 <y\337=7\266I\327\254\363\226r\343}\031\274\277\240\006\006\307\335\003\376\370\363\353\0213\314\032\001\341\033\313M\026\276\005&\007,3\026\234\037\323\314S\206y1M\275k\223\217\357\330F\021hF\264\276\257\331\345\356\033\333^%\205#\324\270\226F\001\276\223\020\340\013\340E\212"
+	.string	"\377s\324X]\312\224\303\031Xh\337\204P\352\331\017\300\311\b\243\212J\276\317\036\306\341\227\347\"\345\206J\336\337^\002\252i\243\227&a2:\370\020~\313S\007\337[\306\276 \245g\2421\002\360\277\204n\315^"
+	.string	"\336I\3154\350\204,]0Hh\016\336\352\265p\360!\214y\311N_l\220E"
+	.ascii	"\033\310\031\333\313zpc\326\306\205\006\217w\227\301k\360\307"
+	.ascii	":0_\347\354Bb\311@\213\233\223\005?\301\033\255h\221\243k\201"
+	.ascii	"\301_qv-\235Y\271\3401x#\241\230\227sv\305\275\265\331\202_\023"
+	.ascii	"\260\t\370\2756f\347M\224\220\261\370*W\275\005\337lt~[\216X"
+	.ascii	"E\352\335\376\255\361,8\021\246e\215\032gm\307\354IY\221\242"
+	.ascii	"\245l\300\3025zE\241\304\305S~\204\300\276\257\026\237x)N\267"
+	.ascii	"%l\033\371\333>J\263Ls\260y\246y\346\330F\034~6D\260L"
+	.string	"\341\240\232-G\344\216{\270\357\270 B\340\336\276\202\357*\217\326on\337\331?\353\236\362M\345\033Q\305W\243\374+\351\226\322\366\334\331(\217\264\365Y\\\365\335F\244\227\242\251\345\226LJ\335s\317\365\325\256\372\316:I\363jM*0r\031\253{\246\311\202\202\335K\345\304i\273\367p\006k\216\263\253\356\233\253\210\026\335S\360\215\345\033\332\3266\267p\244\373>\204\262]\021\232\373\266\362M\247o\364\351\335A\r\237\276\210\342\253\217\324ro\374\002]{zS\237{N\223M\223\360\330\322\266~w9\322\203$LL\223\324q\202\3579=\304\005J\231\302\301?3\016\244\314\3157\277B3\016\013l\263\360\313\232\207m$qF\301\037\365\244(L\360<+L\257Q\305\262?\242\2066E\322e/\243\016:\347\351\213t\236\312D*\"\371N\354\033R\246\213Y\t\336\b\365\001\360\022\274\361\020J\315~\021"
+	.string	"\274\321\342\2305\202\2372\337 x\007>\202?~\201R\037\200\340\215\022\241k\306\346/G\007\376\201\347p\bU|\372\242\235?\201\351\300[M\025\263d\177\343\233\272\366\274\361\307\271\301l`\007o\262\347\006\236e\034\331\342f\342\213\t\240\201\267\232&f\255d\337\206\335pP\025\216"
+	.ascii	"\205\031\003\310\364UV\332\221\271Yj\"\357\263\366\304/zU\352"
+	.ascii	"'_\305\300[}5\027\235O\006\376\371\356\314P\343\370\207|W\220"
+	.ascii	",\347\363yl\243\002\246\207u\f\265|\361\245@\250\323C*\206X/"
+	.ascii	"\204idj\230\235.@\302C\211\024\370\005\022x\254\2036\250\002"
+	.ascii	"\351,\017\262\250c\206fDd$I\222\306b\n\020\b\244y\032\227\332"
+	.ascii	"\035\022\300\0259\207%CD\"#i\222\302\260\033\316\327U\b\331\253"
+	.ascii	"\t\020\036\263\326)\364\373\333B\335CZ\204P\n\004\227\277\244"
+	.ascii	"\241.\207\"K\r\326\244\203\027\032.\017\022\264<\033\347\001"
+	.ascii	"\212\337*\315\254\264:*6N\354\002\332\"\354\335u\"'U3\311\025"
+	.ascii	"uH\301\206\203|E\021F\022~\360\214\n\235\213\020\236_\203i\264"
+	.ascii	".Ta\b\021\344\270!\320\357\257V\240<\220\027\201#}`\033P\237"
+	.ascii	"\236#\251\224I\306*t\215"
+	.ascii	"\022\r?\023\030H\303\026\021\357 \271\346u&\253\236\202\244="
+	.ascii	"'\363\305\f\356N\203\351L\334\275e{\251\302,o\2143\360W:\013"
+	.ascii	"\256\013]M\252,\206.\023\337\301\320C\333y\333\031\f\316\356"
+	.ascii	"S\254\343\276\371W+\004\351\021\034L\365\275a4\257\321\007*\211"
+	.ascii	"M\366R\224C\321\254\262\023\301\252\271\274\300TUo\3573F\033"
+	.ascii	"\004|\031\202}\306xC4\317:\352\374\226@\207\262\177b# \345k\340"
+	.ascii	"/\206bjdG\221\217\bT\217A\302\\J~\016\231\340\264\230\026\235"
+	.ascii	"q\330\223|f\300\226\007\312\334\027\303\2218\373/\027\226\013"
+	.ascii	"\305\275k\021w\310\005\326\277\312A\244p\376+8\214l\322a\240"
+	.ascii	"\\\332\210\272\340K\022=\223\361>\030O\"\323\317K?c\252}\331"
+	.ascii	"\354\352\216\037m\233\221M\204J\177!\020\352}\314B\n \335~\371"
+	.ascii	"\347"
+	.string	"T{\2649\344\241'\35628cR\204\311Y\323%r\377\214\00508,5U8\241;\007\357\371w?\204D\243:\274$\241\374\264\340\221'\245?\203)\224\357i9\333\272\343\205;~`\216M|\034Z<zS%j\3434\216\331\272\244w\321h\346\330\357\003\363#\305i\023\345ni)\211D\224\310F\273\211\036\021\202c4\344|A\204B\370R\243\327\3504\351\357~\n\251P\363^#%A\027`NM\222\230\373I\020\203\314\"#\017l\200U\223^\2248|\245\227\372\204?\252y\001\215xS\212\261\241\361\306\252\"U\206\364\303\344\376\321\"\241\264\314zfH\360\277/\355\024\3260\357\310\270!jEk\216k\003\352m+1F\275\224\201\376\034\234\302Q\027:\220ZT\360^\352W\027\031\246\020w\263\252\316\255-\354\223\021\373\2570\330pu\277H\224\370|<\021$\027\224i\323\b\214\3762\\"
+	.string	"\330\f\225iu\234\030\2737\346b9\302{\0230\233\203\364;\240-\305+\032\032\345\340\302P\033E\335\203\337\2419r\362lH\031en\022F\211\204\020\nFI\260\r\013!\275KN\276\007Z\021gy\025\244\260A\220\033J\205n\370K\307\225\3126?\007\303W\366\260\225\026\264\327.\371Y\200\223'XT\337\222\036\361\023N\300\312!U\362\350\251\311\251\325p=\357>\337o\241\376\211\333JPW\253\300A\211\341\210n\251\331\274\245<A\364\024\235*[\252V\214Am\355\215\373\005\357(\022\311\330a\213y\034z\363\3006\023\022\334\016\324\302Hi\3761\275k\261\375\210g \201\264\204\3622\207Gu\021\262|pd\233\373a\001f\017\245\r\023\362\252\311.\022\376\200\234\304^\212\342/\341\031\203EV\340\021i\017\003\027&\210"
+	.string	"%G/8\00591\016\272\311c\334\257U\002\350\231\030\037\231"
+	.string	"\325\251O&w`<\256\3458\347\274\226E\002fb>\203\244\354\362[\355\314\317Q\221<\261\022\262u\236w\202}$\312\217\270(\240@\234\003\207&@\302"
+	.ascii	"w\326\300\355\361\226\211\236\264dH\033\302\005Y\313\003\365"
+	.ascii	"\217\030G\255;E\304K\202\b>\201@\033\201\274\317sJ>\331)3\340"
+	.ascii	"$\215d$\225]\240\235\013\377\202\301\316\213\272\020l\037\304"
+	.ascii	"\b\007]\202\350Vfs!\312\205\225\347g\\\220#D\300\n\200\253\217"
+	.ascii	"\356\f\370\364\376\374\355\n\332\036\340\223\232\00221\b\027"
+	.ascii	"\347\203\003-\204\206X`f\306\217\251as\270\243rtC\352\036\\,"
+	.ascii	"\366\254\372GU\227\256\n\356\n\2439 \216<\366\317B+\344bj\303"
+	.ascii	"\323\\\264\346\241\362\341GV/\236\026#\233\033\300\341\227\242"
+	.ascii	"\320\305\013\023q\270\274\003\t;\312M&\001\247\275\240\351\312"
+	.ascii	"\035\252%q\f\264\024\260V\260\360\0356\005\341\352^\376zfdtk"
+	.ascii	"\216Gz\202\321\310\351\352*\234\030,q\225\022RJp+\001\"\266S"
+	.ascii	"\317\177\204-\335=a5\215\356\226i\027ba\035\220\021c\354xi\032"
+	.ascii	"\006\340W\217\207\225\247}\fv\360\213EcG$\001\001L\340\361\220"
+	.ascii	"\203n\320\233\267\201]{\311]\2242\225R\276\226/\024T\005\nC\260"
+	.ascii	"\362\033\364Vv\202UA\320\201\303\300\353\2363E\231\317\030\223"
+	.ascii	"\307\006\027B!\247\370\266nN6\330y\262\232h=X/\240\345\020o\023"
+	.ascii	"\343kxN\372\005*\241y\243\201\322\024\021\301=\020\211\022\300"
+	.ascii	"\227\200\006\246\035\034\234\003\354\2253\353Z%\350\266\202\305"
+	.ascii	"\350\301"
+	.string	"\272\231\004\274OOe7P+u\023Ba\306#;\243\303r\230\nj\336\310\263X\264\020\037\013Z~\207B\334\250:iUr\224\321H_\205!aK\242\377\304\223\300\026\001{\252\251\220\307\372P%\310'\\6\375\344\376\364\021Xl\250\263\2008\221\357\365\242\367\344w\347\251\212*\020e7\312\245\340\257\036\270\262p\007\264k\336\270P.\275\211\225\201-\216\361\330\023D\230\377\024\327\307\313\221\251\277\233\271pU\302Jd\302\256\344{I\253\316\363\371\n+\204qN\313oV\265\224N L\377\237\266\3055\324\004\364\345\232\230\240\"\354/\236\024\205U\013\224\357,U\b\277\253\032\017\321k\n\234;\321V\225\005\020+w\271\336Z1\320+\356\t\370\324f\341\200\312\246\\\245{\225\200\255\364Sj\304R_\230^\254Ml\364\232\362\024\354\344\340\036\272E\205\025Y\375~3\313#p}\323<\317\350\225\312\302"
+	.ascii	"b\215D\353\245\227\307\231Z\331\226\032,\331\341\276\233`#\264"
+	.ascii	"\350<l\001\242\r"
+	.text
+	.section	.gnu.lto_taskCheck.part.0.69.a3940a5ca6de62c7,"e",@progbits
+	.string	"(\265/\375`\233\004\325\034"
+	.string	"F\264\265I\240\230Q:\300T\206\227\272\242\361\330h\313\224A\242\t&\374qu\035H1F\276\340\022\313K\311\366\037\304v\370q\371\250jFA,\345\001\334\0042\275\016\340i\360\213\2402\n\274\204\2758\203xb\307'\204\220-wJ\001\234"
+	.string	"\232"
+	.string	"\240"
+	.string	"1\323\371)\243'\331Q`e\242G\216\344\350Iv\206\325Z\343k\247\274\250Cw\036ht#E\005\200\325\305\222w\332\227z\221\243\033)zN\255OU\204\265\002\033\\\364\203\362\242\201\0370^,/`\274h\177\210!\354\030-\3316\204\235#\363\016\314\241\024\253\332\241b\212L\255\300\331\305\305q\336E\272s\344\371H\027\037|\202\037ald\005\231`\234\316\037\323\213/]\320\365d\214\214\251G\007(\355\370=\370\311\202)i\316"
+	.ascii	"\037\311\t\265V\2271n\362\266}l\243\260i\217\266\247s`\3238\260"
+	.ascii	"\351\233rZv\340\017\200\234\266\371\360\216\221\3235\3444\214"
+	.ascii	"\234.\311i\222\234\036\311i\361V7\375\324\277\344\364\r4\310"
+	.ascii	"r\343T\253R\0323\225\206x\305\343K~\253\177\370C9\265\357W\375"
+	.ascii	"\211\037\345R\034\033b\355\260v:=\234\332\263!%<QB\271\272\312"
+	.ascii	"\275\272\250_\321"
+	.string	"\203kJW\321\233\234\211/\264r\222s\222+\261\245E\204\314O\331\304\216Q\335\2472\362\203\216\331\376\022%:\353\364\224\350J\244\245\222I\213!]\265\002\031\\4Oyd\007\\_\324f\277\\\370Cyi\212-]\233\225p\3067F\313Cl/\345\024\310pKHM\227\017\260\245[\263\347\362\001\266\260a\326WS\271[\376\363\"W\334r\305*\237\323\270t\311-p\305\027%\336X\243\270\343\336\207\306\307\362,;\037\032m\274(\256\204a\226\220\235Kw\247|QI3\215e\323\266\211\230\377\315\275\360\367ae\206\226\244E\362\3769\312t\tw\241\314\033\277?H\276\364f\031\373T^\205\347\3530P\320\374/h\274\370\225\361#\312I\252)\305L3\027\312;\236\326}\n4\237\371\3433\207n@D\272\232\315D\205\032\001!!\032OmHg!\250f\033\301c\303\335B\330(\034\310\365\330H"
+	.string	"m \032\262\341p\272\032\200\240\034\215\210\272\346"
+	.ascii	"g\023\322\201\260\215\250\345fC@4\022\263\032.7s\200\300\267"
+	.ascii	"\0226\334\214\350v\303\315b\247u\237\374\340-pa\241\262\242?"
+	.ascii	"o\314Y\026\266s\326\023Rl\222\210\263\366\205\213\351\331+?\257"
+	.ascii	"\256\337,\316\356\031\331\336\354U\240\2611\334+CYkO\266\260"
+	.ascii	"!\230\257\"\177\317hkx\230\0362\006\230 bl\016\347\332\331h\325"
+	.ascii	"Z#\370[ :\370:\212\202Wp#\\\250QP\206\22025bA\024\024$I\322\001"
+	.ascii	"\220\002\231\262\333\034\021\2009e%m*{\034{\320'\242C\246)5\021"
+	.ascii	"\033\211\016\231\240\"\276\265\017\250\007\375\240;hoq \024B"
+	.ascii	"4p\213\300m1\317\301k\253{\333\210e~[C^\236\t`\005\265\227\274"
+	.ascii	"7 \036\237AT(7\277\241\307Q\304\025\023\315\342\363R\306\344"
+	.ascii	"\373\327\371\313\274\311^\354\345\250Y\257\315t\341G\256\034"
+	.ascii	">x\312\034L7!\272\334a\2132\023P\332$\362\200C3\034\367k\315"
+	.ascii	"7pn\320I\020\nC\314K\254\016\220\030\372\314*\n\226\347\b\355"
+	.ascii	"\025\254^C\324Yu\332j5\314\332\203B\245\2138i`\372\352\347\007"
+	.text
+	.section	.gnu.lto_rescheduleTask.part.0.76.a3940a5ca6de62c7,"e",@progbits
+	.string	"(\265/\375`\354\005\205!"
+	.string	"\3269\311G\220\334Mc\341"
+	.string	"\304\037\273g\201\347\033\246\204)vEp\362\336 f_M+J\307r\361k\251\236\215\376Q\242ghV\241\354\030\215\355\004@8s\004"
+	.string	"/\200\367iH\016&\232\360\200c\312P#{\357\275\245L)\257"
+	.string	"\257"
+	.string	"\267"
+	.string	"\035\210\250\365\241\200\266\315f[_\\B\303.\241a\274\200\276t\255'\002\377T\203$\336\241\220k\265\357t%\301?\3250\355\336 N\254\356%Nxi\n\350K\233\337\314\227\344\t\230/\3557\331\006\n9h\1779Q\351\376\311\227 \250\262{/\356\245\035\362\340O\263$mE\203>\324oQ=?k:\364q\363]\037@\246\b&5\354\361\222\2040&\245\314M\007Sj\033\336\250$i\263\345\025\244"
+	.ascii	"\t\210\031\333PX-\t\301\210\213G\315\020\210\274}\t\361r\256"
+	.ascii	"\327\034\303\237Z\007\034=3\334{}\037\242\233v\333\251\355\034"
+	.ascii	"\273$\013\256\325\252i\264j\364\254>\321j\363\254.\377u\223/"
+	.ascii	"\376\366[w=\361\377\355\306 \311\275:\216h\356Q9\305\310\251"
+	.ascii	"~*\277\325\277\365[\371\301\376\257\237\366}\257c\361\263\\\013"
+	.ascii	"\230P\300\025\n)\262\372\212r4\236\215ie\275k\347Xl\261\230\330"
+	.ascii	"\264\256\234k\253\032 \336!\2414V\252\374\252\374\320\036!\224"
+	.ascii	"\312xF\302\266\035\333Fu+_\312\257l\243\002\264\215p\212\261"
+	.ascii	"l\216V!\320)\340\241<\312\257\222"
+	.string	"\002B\361\247\242\030\353w\350\036\207\231\361\314\330\275\367\003\n\345K\275\311\235\004\377\204\347\027H\210\226\032\315\306\356%Fx\351)\315\326d\355\360\372A\220\026!)m\222a\230\250\005 V\024+P\253\265K\230\250OQk\2369\022\332\036\333\033+G\223(\322&\371\264\245\265E\212b>q1(* \035-\204\311\321\220\316\312\300|\214\307|y\332O\021Q\342\3633\245F^\326&\371Oa\232\326W4\n\253\231\375.\367\222\302_r\216\216\216\371\322|p\344h\206H\302I[\332\233)\2402?\365hkI{-\357pVE\026t\346\033y\022(\331xX\316\201\322\275\027\303\226s\331\371K/\275\202W\237\362\314\227\325\236\353dV\025\230\264\207O=V\233d\213\236\274\026\311>\253mg\r\272\036\317\267\023\241\333\371x\277\235\016\200NNU\221S\311_\317\227\343\201\320\365x\276\235\b\236]\214"
+	.ascii	":\034\027?\235\031\246s7\276\335\213\035\335\216E\356\207\213"
+	.ascii	"\301\323\201\201\313\371~\270\233\005\356\311\330\371p3z=\037"
+	.ascii	"\256\336G\263\212\274|\354\317YZ\373D\305\201\302bA\325\240\n"
+	.ascii	"t\256W\247\245%#'\"\263A\255Y\277+\210$\330T\237\332\306f}\262"
+	.ascii	"\372\363TL\315\332l\215I\013\310\250:\325\036\236z\217\264\241"
+	.ascii	"1fh\366]\016>=\215\206\004a-\216fCM\230\331\317p\360\227pp\314"
+	.ascii	"\227\016\210\374 {\231"
+	.string	"\261<\370\312W\346\313\232}\327k\223\217##\247\003\325\0161\242>|\250\2014\246\024B\b\321\210\004\"\244\264\031\016\200\002\221!\273n\022\340\206-L\321L@\025\226\321\302\376\006\253\001&\024\035\345V\330*\351\341S\353o\222b\213-q&\033\345\206\320\340\270\\\370!j23yL\264\n\357xl\376\375\033\344$[\242\244|f\t\202\354\214\236h\371E\023\244\252\016\362\226IgvB\230\234\016Ew\270\242\342.\315\240m)\227\270\r=vL`\261\276\0208\\\026 $\310\234\207\001!mW\215\2222\354:\360\334\030\272\327z\240\376<8f+m5\"\020U\225\241FB\366@=\337\226\342\347\275\022\"\320\364\301\267\267\314Y\305[\3121\251\252Y\377\354\320=3$Jh\330/\030\272\034\272\334\303\307\252LYlc\216\005{'=\266\216\017\373\3256\302\007~{\362\230hS#]g\323\207"
+	.ascii	"\204\024\370<0\367\237\217\2345\222Y\256i@\352\327\002\364\024"
+	.ascii	"\027w\374\004\3612\243,\204\251"
+	.text
+	.section	.gnu.lto_setTaskEnabled.part.0.77.a3940a5ca6de62c7,"e",@progbits
+	.string	"(\265/\375`\357\003\345\032"
+	.string	"\006q\254G\240\\M:\344\006:\372\2619\252\017\252\275\372\036\206\267\221.\331\327\302\267~s\020\376\001\351\026"
+	.string	"}\030sk\365^\r\366\352:\326\nTp\233\357s,\316\0056V\023\361\272\371\021S-C\204\231\265\204\020\"eJ\001\236"
+	.string	"\216"
+	.string	"\217"
+	.string	"\266u=\357l3\0176\315[\361\216\244\334\3149i\027\027\310w\327\311\221\305`/r\024\303\325\235\235Oj\220:\254\364\265\270NN\222\312\256\316\003\325\313\2411\236\245\031:\016\013%\274p\223\224\003\347\b\314\241z8\364\345\245\247#T0\347<T\357\206\222a\202/[\210,H\352a%\363\035\351\030\316xO\345\275\364\220B\006h\262\330\300PQK_\215\2071_\215o8\353\342\243\314\216\317(d\240\224\205\306\257\2561|.T\005|\207\3240\347\364\213\224n"
+	.ascii	"\267\335\306\366\006{\235\002\026\037\365\207\242zE\265>\370"
+	.ascii	"?\300\254A\2229y]q&\017QJ\220[\375\366\375\251;\361\257,\263"
+	.ascii	"\322\275*\247\007\202sF\357"
+	.string	"T\177\262{U\356\023F\017V\222AB3g\260\301Eg\b\276\244\356K\351l\231\314\241>\312\021(\350\336d\350\301\311\013\325\216@a\367&C\007\276\206+\311\025\013\257\213V}Pw&Dap\372zV\265\257\344KvgBd\330\234KTXs\006\035\\4\204\327E\005\237\215\027\303\017\030/\332G\022\307\202{\3159+\370W\204~|`n\2748.)\005\345\315\022+/xB\306\375Y\303\335M3\344iu\305\215\341\2411\\\004\3003\"\225W\311\371@\333L\230\030/\356bp\272\361\247R\211+\334\237\245\34424\225\266Y<\353\347SMs\316\013Q\216\005\344\003/:\305M_^\364o\343E\335\2276\212\264\313{\315Z\323\245\307\356ov\242\361\033\007H&j\214\221\302\321\375yw\036\316e\262Iul\3250R\375Z59\252GQ\003@\270\232P\350cCQ\242\246\302F\372p"
+	.ascii	"\302\325\204F\367<\b\262\241\310\371\330N\364\340h*~j)h=A8\332"
+	.ascii	"\003\036\337V\330\202hB\267[\020Mf[\357\277\264\266\270\212\326"
+	.ascii	"\205N\207)<<v\214\311\341\362\330\352\323\227\330Vp:\023\223"
+	.ascii	"\23202\230\007\330\026\300\242z\022\246*f\340\003\b}i\002ZH\004"
+	.ascii	"Lu\375\200\375!\306\327\352R\224\230k\371\226\020\"F\350\313"
+	.ascii	"\021;A\214\267\266d$\275\366\247ur\277\024@\305\265I\324\364"
+	.ascii	"%\271\004\264\216p\031m\013#E\220\214\220\3733n\034\367E\354"
+	.ascii	"\236L\250A8\001B\214\021\247\320\2042\243M\232\003p\002\021S"
+	.ascii	"\265\033\020@\310lA\222a\fm\216\037\221\224\337\3223\004y\215"
+	.ascii	"iI\302\177lS\300\257\211U\t\342\231\300\245*\001\314~\275\201"
+	.ascii	"}\267\214\257C\0135w\362\b\240M\246V\303}\366Q_\2733\257\210"
+	.ascii	"nz\375\323\341|\016&_v\263\375\354\270\f\021\312\224@M\\\304"
+	.ascii	"\362\007h\216\215\206\026\366E\231\346\337\240\251\233k\261\214"
+	.ascii	"\200\214\207)\016Nnv\330<0\005\237-e,\366m\211\345\201i\3424"
+	.ascii	"=\335\220\3533{\231\261Ay1\334\360\037\031\023\013\301\017"
+	.text
+	.section	.gnu.lto_schedulerResetTaskStatistics.part.0.78.a3940a5ca6de62c7,"e",@progbits
+	.string	"(\265/\375`\232"
+	.string	"-\n"
+	.string	"\306\222C:0\221\322\001`\265\021\2262*\224\245\217v\033\261\341@\323]\036\016N\3634(\332\217m\361@\032\2207N\367\353U\300A\350\234\fu\322\033\305\001\235\313\246#\225\354\275wJ\0010"
+	.string	"1"
+	.string	"4"
+	.string	")\020\207\366\315\307\327\036&\306C\226\263\273\335\3534y\370)i\350?\366\216\310R}\006\260B.\007N\001\034v\327\234\310]o{\3016\203}\204\267\257\222\362c\366\300R\037Q\362aW#\240WKi\177\345,\341G\224;\273%62\273c\302\253\025\270W\203\177\266Wz\202\355\325\363\372\024\333\001-\177\001\013^\273\253\213\276\354.\031\376\311\253?P^|\365A\215\ry\321\00248\263\216\251\222\323\345IOw\266\354\371i\240\355~\324hKRgP\016\013$\b\212Ot\332<\ny\245\n\220T\222\030}\335\305\204\310\242\033y_\027:\260\t\243\344u'\223\311\353<\266\345\351\316\226#j\263\325\344\230\323e\233\223\334]\263\201\376\025"
+	.string	"hmYY\326p\273\303\t\2022\346~@\024\fs\205K5q\365\350(\004\343y\322=M\027\325N\347\2026]v."
+	.ascii	"\234\274\230wZ\232~B\031\003"
+	.text
+	.section	.gnu.lto_schedulerSetMode.part.0.81.a3940a5ca6de62c7,"e",@progbits
+	.string	"(\265/\375`\340\002U\025"
+	.string	"F\347\210J\300\020)\035\200g\017=\221\323[v\311\375)\265=sGSh\236ZYl0Q\003\250m\230L\366\037\320\r\374\207\352\372\307\237\226\336\254\277k\336Q\024EQt\235\262\305\236\3649\001+yT\206b\234\343j\215\354-wJ\001p"
+	.string	"t"
+	.string	"s"
+	.ascii	"&l\037a\354Q+\207\240\212Z\307\221S/`\235\036x\001\361t\376C"
+	.ascii	"<m\235\376\307v-\3076\333\306G_\275\222MM\321T\255\325u\272\036"
+	.ascii	"<\245\355t\256\024m\376\320%O)\346t\256p:\020\002v\270\371\032"
+	.ascii	"\n\227\376\273\274\331\335\344\2249\021;\337\377\236\200gDD\343"
+	.ascii	"\267\333\271$pqURk5\213w\257n\233\305v\003{\025\004R+L+\271U"
+	.ascii	"\300M\240\324\021\320T\235\031C^L\003\031}:\257\236\020h\252"
+	.ascii	"\326\321uz\241O\373~\212\007gO\362\251<\263O\034h\267\374\362"
+	.ascii	"$\003\340\351\371\324Z_t\"\377\207T\373\021M\202\214U'\007\305"
+	.ascii	"\215l?\242\275\322\344x\340X\320\t\031\260N=\262\376!>\310n\275"
+	.ascii	"H?\250\346\017\271%T\373\b#\035T\031^\310\251\245\264_\342\001"
+	.ascii	"A\027\002H\271\366\203\024\371\234\377;K\007S\335!\234\331\030"
+	.ascii	"\357\327\250\005n\267\333\023\264E\376Dc\325Z_\276\213\277P\361"
+	.ascii	"}N\275\022\213\355jC\016\022K!\367\235\316\302N\276\217Y\334"
+	.ascii	"$\237s\223x\372\340\345\007\034\252\036P\016\031Y%\267\307+\376"
+	.ascii	"\345\033\n\275<\246\242\364\024\245WN\351\267F0\f\350\325\252"
+	.ascii	"\253\242\252\032\350R\210#\235i\226!*-&.\023\206\022[\231>!\221"
+	.ascii	"\301\"\314P`\020NZ\\\022RLV\\'\262\026\027\t\002\307&\300d.\227"
+	.ascii	"XL\346j\331\226_\236\241\263\236F@\311\354\315\373\227o(\244"
+	.ascii	"\333\343\265\251IZ\272\253\241\374\312\275\261i\242\334\377n"
+	.ascii	"\200\251C\024\216\0315f\344\320\373Yk\255\023hS\270\214(\272"
+	.ascii	"\036Ksc8\345n\210|w\356iz7Ye\030\273\007^\376\350\240z\001> "
+	.ascii	"\220\002\031\303\333\255\373\270m\224\r>}\332\341\200\272\305"
+	.ascii	"c\001\217\200\f\267\330R\273s{,\377\225\315~i\032\262\247Vv$"
+	.ascii	"R(Y\331\306\002\267\326\232O[\324,W\316\242\3536\353!\030\256"
+	.ascii	"\361\330\032\f\f`@\312\006(Z\231\356\205k\313\305\302\304.\267"
+	.ascii	"\321d!\262\200k)weD\310j\350\202i\\G1\306k\351v\351\262\270l"
+	.ascii	"\200\306\224\335\300\322\032\200\177\324]\333\221\036\270\362"
+	.ascii	"\376k\337\030"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a3940a5ca6de62c7,"e",@progbits
+	.string	"(\265/\375`K\005\035\031"
+	.string	"\246f\224J\220VR\007\002\003\036\274\201\207%\035\2579\301\317\224\fk\326x\313#\213\336\016\005\220\221 \340\001\006\307:\273\335\235H\004"
+	.string	"\300\223\217\306\202\013.x \336n\347\245\3551\036\250\206\243\3720\253\223J\007B\215\244\355\235dJ\001\200"
+	.string	"\202"
+	.string	"\200"
+	.string	"\327\331\016\001n\313\"\341\360\276[\323S7"
+	.ascii	"HF\265\251ix\376\272D\007\031\236\273.\206`1\350\350\3023\327"
+	.ascii	"\265\360=\327\243\321h\224\350yn\005\006\024lTV\0165P'\300\250"
+	.ascii	"\314<\224\360\214u#|\002\b\006\204^R\226e\331\240Wp\201\036\301"
+	.ascii	"\017\215\352S\300F\254\251\325\363\305\313\363\007\2223\310\037"
+	.ascii	"^g\356#\366(\243\262m\313V1?sWR\037\237S\210\030_x\231\371F\024"
+	.ascii	";\037:\356\274\250;\252M\315+\247\363\232T\347\270\243\226\351"
+	.ascii	"ZZ3\346\374\346\274\251\337\230\235\203\"\r\341\324m</\251\361"
+	.ascii	"?4^\250Y\226e\026\316x\240\226qUf\242E\314,\306\373\030}\262"
+	.ascii	"\241\300\316\214\300xd\321\037_\274\321\305?h\361+\213\337Y\361"
+	.ascii	":*>'\305\343\240\370\233\313\312\0231&vj\t\236J\342\027\214x"
+	.ascii	"\002\"\036xC<?\001\361\003\030l\013\024\326\207\027p=\374/\275"
+	.ascii	"\254\250\220\035\321q\314\276Z[eN\206Dwa6\321\251\tMG\364\033"
+	.ascii	"t\350/W\r\004K\343a\024\322xQ{V\024\034J\273\240\027\221@\206"
+	.ascii	"\242#\253I\372\363\333\325\361\347.m\323,}T\361\317{L\3669\214"
+	.ascii	"\263\031\255\311\366C\365\371K\313>\2779\233\333\230\252$\251"
+	.ascii	"\276fS\222\244\251\347\363f\266o-=\205]\237\367T{/\355g\337\257"
+	.ascii	",dM\274\236\033\035y~k;e\003\334h;Z\230\366\204eM\2739\265\246"
+	.ascii	"\275\326vnY\206\304\253\267\025\224\352\252u@\224\244$W\357\346"
+	.ascii	"UKA;&L\314\312q\365\033\317\346"
+	.string	"2\246Y\226\336\3522\314\306\025Y*s\253w\333\2741\245\225o\365\342qm\251%\323XP\270\203\334\361f\006u\034\367\354\231 Qg\300\034\307=u\347 \343\242\002m\276\342e\345\204\314\361v\366%\342x?\1777TGzP\t\211\216k;_\250q\210$BF\204H$\320\244\220\326`\002!Ews\021\260\224\307\030\022\t\211\210L0\254\003\262\224N\2449\320\t\022\366G\211'\320\243!;\006 Pc\243~\375>\002*\250\274B~U\230\2009nQ\313w%\307R|\377.\220\260o\022:>\031\201\276 T]\343\267+\361\327M\020\300\2717b3\023o\205\243)\307\375\311n\200\274\216si`\353I\327X\236\204\211v\366|1\251%\321\260\022\033,\233\344.t\326\"H1\326\270\023\270\303:\270\354\354\326X\3222\345Mp\321\302\nn h\357\242\025\362\376AF\265\177!\233,\242"
+	.ascii	"\013j)e1`\222\177\367\345a \177\020Z\320\224\023\237 -\270\373"
+	.ascii	"\\\321%\3712j"
+	.text
+	.section	.gnu.lto_.refs.a3940a5ca6de62c7,"e",@progbits
+	.string	"(\265/\375`\006\002\355\016"
+	.string	"\226\247b7Pm\222\306P\001L)\250\200\202\003X\231\231\231\005@U\036PUUUUU\302-\037\034!\236h\375?\217\236|\"\326>\255?j\255\265\326\bi\215\220M\266L)J"
+	.string	"S"
+	.string	"W"
+	.ascii	"B\026\215T\226Ut\212\223\307g-{\327R\322\350D\333@F\316\213\243"
+	.ascii	"\024\347\204\236\363G\b\263\362l\364,svG\306\234,}^g\33501\257"
+	.ascii	"\305\333\326\366^V\311\032\255\316:H\312;y#k\344e\353\255\257"
+	.ascii	"\217\256\013\247\301\274"
+	.string	"\250\326\202\332F\235\024\324\tQ\272*\003<\262J\247\3148W\2657\355\324a,\037J\235i\233I\217\322\247/\230c\316b/M\362FK\235\246\215\244\267\253\200\310\261n,\325X\233\361V/\306R\212\265\226\267\262\264Y\n\212\225\313N.*\261\034KI;\243\266P\333H\233\001s\312\013\2265\025\234\007\231`\307\210\340\003{\321TjZ\321\024@SKSJS\250R\207R\326\316\3254\020-\213~\261\300\222\021\330\246cWf\317\310\321\330L\373\344\200\265qV$\205$]\220^;\001\215\226J'\325B\324\031\241\002\372\210\265\213\b\361\016b\351\037\"\335\203\244w\340\260\001\263k\300\350\031\232\216\241\235[\240\350\025\242\235\002\264O\350\330%t\350\0212\353\211\214j\202RKL+\211I\2750-\004J\037L\353`\322\017J=&}\036e\216\236\344\207\206\020gGj\252\217:\017\310I7\b\036"
+	.ascii	"Q\202A\034\327\212s\177\303\006\357m\177\214K\231sM\255\205o"
+	.ascii	"\013wk\331\314MRV%\352\226\253-W\311J\236\"D\336\201\bK\005\336"
+	.ascii	"\250\261E\204\005\001;{\313\204\277:\202\377\230\227\025b\254"
+	.ascii	"\211\233\305P\027\216\222\246\302c(\324\023"
+	.text
+	.section	.gnu.lto_.decls.a3940a5ca6de62c7,"e",@progbits
+	.string	"(\265/\375`@5\025\330"
+	.string	"z9\355DV \212A:\351\257?\003Dw"
+	.ascii	"\024\221\277v\377\b\261\272F\026\322.C1;*\231\fA\264\267k\331"
+	.ascii	"\314?_\265\261\335\206\013x\242\332)%\022W\204\317s\2003L3\275"
+	.ascii	"\252\240\354\263\321/\341\371I#nt\033X1\302\273\206\177\030\313"
+	.ascii	"b-\026\321\320&R\246\206\003G\004p\004cO%9MM\\WG\324\263\005"
+	.ascii	"B\036d\013\204o-\365-\245^m\217\277p\024\004\363\235\363\330"
+	.ascii	"\313i\230\317\373l\256\300\263&m\337L\352\031\2040\035\034d\020"
+	.ascii	"\302\367Uy\230\203\320\003s\020\262\035s\341\350\333\370n\207"
+	.ascii	"\312\237\fjm\317a\324\027j\336&<\323\251\3475\365<\246\236\271"
+	.ascii	"T\023t\334Ax\316\241\236\217T\225\357\363\215M\247K\236_\231"
+	.ascii	"\225\265\235)\243-X]\205\n\364N\310Y\3333\025\026c\267\234\253"
+	.ascii	"{\233\367\336\t"
+	.string	"\204Qf>\240\332r[\217\372'7\026\246\355]P\277\001\2631\224\321R1'\325\214\254\006\337\275\317\363\024\2162\033;y\317\363^'\367\336\263\222\377\004\033?\341\265\024FN\267\331\304\357\203\230[Y\021\300{\237\"zD\2400b\343\022\332\237\327Xm\310\205\212\227\276\266\034\205\246\013\230\032um\037\202\372\333\303LCh\300\265\375\002T\346!\3432\216\206\340\263\363\0307\271M\363y\241\367>wr\2301@\301\322\366(T\t\260.\007W\325s\b\341\016\207\020\276U\017\334Ah\231\2030\202\313\035\204\375d\016B^r\342\314\204\203\320\311\371\274;8ip\201B\332r`\0165\374\034\306JB\244HJW7z\357s\203\016\031\273\"\260\266\177r\007\241\312\034\204'\240\306\246\256L\200\020\027v\201\t\020\300^\200?eA\b\227\007\264(\370S\n\b\375\274B\005\177\027c\374\334\303\036:H\251"
+	.string	"!L\234\371y\b\013\r\343\006"
+	.string	"\241\327w\340\267#\030\203\237\235\272\003=L\034\245\355s\f\376\364\347g\036}\200\2373"
+	.string	"\321\203\204\026\224\246\244\f\302/\370-\210\237\243\275\201\326@\323\317b\235\002\214\345\317[\247\371m\006\006\260\002\370\031\2563\220\344\347#\215\001\023\307\333\337~\030\200\245\371\271\003?\033\340g\025~\026\361\263\006~\036\361\363\006~.\341\3633\n\031\370\371\202\377)p\340g\002\374LD\200\316C\374\351\337\317#D\240E_\3409\177\272\245-\360\233?\265B\241\324(\034\347O7h\r^\374\f\242]\\\202?U!U\202\243\2402`v\tK\303?\025\300\321\016\210\377k\315\326\022\370;\002\177\267\370\206?\255\251\371S\262\013\377T\314M\347O\203\374-b\305\317$R\370_\301\024"
+	.ascii	"\374\351\326\325?\345\361\263Z\247`\341\200\333\374\251\216\277"
+	.ascii	"U\374\355\301\337$\376\036\361\367\004\177w\370\233\303\317f"
+	.ascii	"??\377\336\360\367\225\237\221\374m\363w\377\\\346g\277\237\363"
+	.ascii	"~\276\373\331\356g-?\327\375L\367s\334\317S~\226\3623\224\237"
+	.ascii	"\323~\036\3739\354g\260\237\207\374\334\343g!?\007\371\231\353"
+	.ascii	"\347\255\237\265~\276\372\331\352\347\252\237\247~\226\3729\352"
+	.ascii	"g\250\237\237~^\372\271\306\317G?\323\370\271\350g\343\317\003"
+	.ascii	"\370Y\347g\240\237O\370\231\204\377\201?\257\370\177\367\237"
+	.ascii	"\357\347\024?s\360\277\355\277\332\317 \370\357\366\363\007~"
+	.ascii	"6\3613\f?\277\360s\013?\247?O\360\263\362\377\230\377/\376\237"
+	.ascii	"\375,\374\231"
+	.string	"\205\237e\374|\3749\350g\030?\257?\273\370\231\002?\227\360\263\b?\263\370\271\001?3\340\347\005\374\374\301\317'~\366\340g\005\374\334\301\317(\376\273\370o\345\177\225\377T\376+\371\277\302\177\270\377\037\006\007\007\007\377\034\236\277\206\347\317\200'Y\\\334\207\324\274LKUL'\036:\244\347\325\275\273\227\243F\327\351\303\275UWNwL)V+\242c*r\302\274\n\300RQ\326\325m\322!}]\335\373U\024\343.%`\371\244\273[L\267\334Qu\225\214\356\245`\351\336%_\272{\357\362\336[\343T\365\2747\007\017\222\327\322\322\275\316\236\245[\265\\3\272\267\243]\324\236\220\240YW'\326\312\240^\367\350\271d\257{\207\345\244B\227bW\t\214\352\365\004\345\327\366\tU\322\306t\206\243}\246\331Bp\216\335\345\215\226\r\347\210\233\277'\347m{\032\2512\034\3552\rm\361\274\313\027fh\220"
+	.string	"\243\r\330_z\236\367\306p\013\315\350\r\360:9\215\270\r\263\244\305\f\277\260\210\021\243\245\303\270\340\367\343\315\212\n\306\317y\266G\227\324\227\227\263\325\326%\215\357K\2174\255\254\266\275G\363dO\355+\332\245\235g\362\032\257\235f\250\374\300\364\332\013G;/\032(Ge\213\320\336>\325\333\260\273\246\022re\rfi.-\003\363\213F\264\355z\213W\337\332Q\333\326\362\303\212\024f\227zn2W\323\304\331\204D\345\007\2306\327mYK|\034\314q\230v\253\311J\312\322W:\256\261\364[\3235\\\313u\035G{\356\357*m\345=J\346\032\251I\r*?\300\271,&/\271&M|(8\350\271\246\322\315\341\222\347\026e\261\341\2256\227\245t{t\342\260\300\200D`;\204\335\241#\230D\320\f\216)l7a\264\304"
+	.ascii	"a\373{\255\245\364\020\025\310\217&T[.s\301\225Z3\361\235\227"
+	.ascii	"\216+Q\240\344|\211\002G\326\266\237\350\350\235\3059i{\313l"
+	.ascii	"\264N\3533\216\266\223\277\315\230\356\226\345\360\274:\312h"
+	.ascii	"X]\234\360\334\363\303\335\263G\204\b\021j^W\036\026\325>\325"
+	.ascii	"Ss\312XP\350W\007\206E\006\035\002\235aL\3337\364\357\261n\222"
+	.ascii	"\343%M\013]\333\033\037\314A\330\317\023o1U\320\215i\253m\004"
+	.ascii	"L\226\3204y\243\201\331\266\227\334\216]\351\244\314\030\342"
+	.ascii	"\242\324p\244\003\270D\367T\002B"
+	.string	"m\262\245)\tk\326\204\271eEiH\322\202_\306\344x\352\324\365\315)\201Y\360\214aiG#\351#\254\345\307\347\245\217\374\375\325F\232H\216\r\216(:\230\264\275\271W\357\"D\204\210\0219CdH\215\226\224\031p\264\345(\\Dn\211X\333o0W\206\257K\027\207a\300\341\362y\233n\266\310A\263\032H{5Wo\365\217\326\352\036\355\243\2054V_\365\f\275\243yt\020\216v\327\337N\375\364\236\246*T~\200M\344\314\320\325\221i\242\305\213\027\226,\2146l\362\334&\017=/?0\334\227>\325\324#2<,[\362\350\272\213\365\270o\310|^\247\032\262.T~\200'\032\251\231\230\316\371\2747n\310\254P\371\001\016\366\221\321\2267V\322]}\243eH\305\234$\260E\220\257\t\031\306C\343\021\307\327\305fX0\205\221\223\315\021\r\270.\335\305e\030o\330|\336\247\033\036W\250\374"
+	.string	"E\330\320\300\244\306\366\301\266UO\272f\325C\017N\375\0069zjhs/\363\213\327\275\227\252q\364\324\260\371\354=*?\260\277ut\025G\233\212\343n\237\"D\364\350,\001\247v\b\355S \352{\252\241\332\331:U\262$5\265m)\033;0:\242m\237f\251\035u\342\035\203P\220LR\264\355N\224jo\232\244\346<\243)\223\251\227\302p\364"
+	.ascii	"b\263f\306HT\333\266\321Io\245\256\321J\t\270\272\227\331J;g"
+	.ascii	"\356e\3560c\300\214\201\245!K\bZ\240\372\356S\377>j#\306\342"
+	.ascii	"ff\324\313\267Q"
+	.string	"73PV\304\257m7\273\213\232\306\273\331\314\234\346\355\246\275\227\311\214\301\220\031\003\232\266 \314&B\373\316S\3732\332P\tK\212\025\336\215\221\035\\_X\324\237\005\003\205\202~dkg\316\201\337\313\271W\311\275\267\202\241\2226>2m\377\307h>m?"
+	.ascii	"\253\250o4\365\275D\345?\026\303Q\013x\314Qp\360t\031\202u\252"
+	.ascii	"\355\241\201\21623\234\341q\343\243.\210\221\266m\263\256\267"
+	.ascii	"$\305\210\216\266\026\353_t\234\210\371\250\2623\310ee)jk\255"
+	.ascii	"\254\f\034=\234\275\372P\312\321\031\034\234\372\020\360\341"
+	.ascii	"\204\226\352\266\352\267\261\221b\305\003\213-\007\232\035\225"
+	.ascii	"\027\024\3659e\352o\245\254T;C\210^\346S\b*\313,96\004\241C\022"
+	.ascii	"e\243lT\n\345\313\222\321\033`\226\026\324^\333\347$Y(\013\225"
+	.ascii	"B\321\323a\364\006\206\263\245t5\026h\233l\223}\002!\r\215\317"
+	.ascii	"\372\351P\"\305\351v\313KT\036\316\233j\223l\222]jqk\270\204"
+	.ascii	"\330\304\321\020\204\263J\267K\214\207c\225\245K\311\231m\332"
+	.ascii	"\246\255q\347\305\207Ge\305\"\335\326\330\211b\305\366\304\036"
+	.ascii	"\325 y)\345\331#k\304\204\027\244\251\367lbpBUY\032D\316\234"
+	.ascii	"\261L8\225H\230\221?\273\274e\246kb\270\234\265\265w'G\026,I"
+	.ascii	"\2038VEb\210\f\n\302PR&\027\330V\302\034O\035R\2013\250a\302"
+	.ascii	"\244e"
+	.string	"\324\213\307\225\252}Y\221yZfH\245\216H]\333\024\260\377\240\240\314\274\214I\245\324\310\304\306\210\261\\a\324\362\376Z\3130\032X\004\346/JO/\365;\253\332)\303\002\205\325\367\324\357\357\312N\206\224\217\002\247\026\225\224/\375BD\354\307T?I\373tX\241k\233\356\3414\325\247x\234\346q4\315\343\276~^\247\016\362p\214,\355\330\313S\317\334ww\327\316\317yY\261\263k\347\tw7O-Z\330\354\213\321\033 \be\364\314\214\250uu)]\226=\257\341\231\234\023\224K\235\233K\351j\212\342t\244\326\214\220\332\322\361\032\002\234Vx\\UI\343\252\244W\254XI\2574\031\275\001\202\221\361\341\204{z\205\313\226\256h\333\364\255\377\006\203\324\240j\346\330\270\301f\325\3667O\352m\314\270\271-a-UxR_\246L\311be\364\006\226B\361\244\310\331\251R\244\244K-\262\224\214\336"
+	.ascii	"i\230\310\346\334\252\250\251\275\255\005\013\260/|h\352\223"
+	.ascii	"')\024/\201|\352\034\016\033Ym\2410IK{[\212=\033\"\3204\nM\317"
+	.ascii	"\316\310\310R3\275\032^GO\315\244\262\247f7H\316\2408zL\230\323"
+	.ascii	"\312\222\266\267\231A\275M\215\032R\261\032\322\261\377"
+	.string	"=\035\243\251\373\352Bk\273dI\372L\213b\275\360q=a\362\364\031\346F\327\223\t\006\271\216\274\250W\243\352\323$\234\206\205\365\030\373\274OC\032K*\rc\204ER\260\")\222\257\257\024\211\272\344\263=g\b\036Bv\306$=\362\024\211\220lH\216)mS#\375\307I\364\360\270\332)\224k:S\246\355U.\365j\324\220!\034\030\244K\315\240\020!\316\024M/\311\337\226 A\030\315nMyu\225+S\234\234qq1\232\025\236\345\2502b(\030\245\244\264\265\265\225B\227\232'\254T\013+\355!\274\227\237WMNYYi\017uy\357\362I\227\321\033`\332#\335\301|\333k\233\356\240\371z\002)Ss\244^(F\275\272\212\322E}79\265\342hj\325M\346\221\303M}\232\203\323\252\264\252\211\274\210{\216\270\020M=7\021\341\324T\\\230\224T\272\204c&\374\021\305\3214\252\217"
+	.ascii	"\300)\002dN>a\016(\250)aRSS\372\244\245\303\351\351\223u\332"
+	.ascii	"@\262\013LJJ\227\330y\323-\202Fo`JO\227n\242hO\304\360Z\363\231"
+	.ascii	"\351\231\371\251\037\301i\215hZ\343m\226F\323\035q\232-GG4\320"
+	.ascii	"TQ\243)\r\2462\244\301\024E}\017\2467]\246E\352\275\227G\225"
+	.ascii	"\323\211\371\264\250\315\210A3\3626\033\265\026\026\007U\377"
+	.ascii	"\376\205\227\351t\357\275A\363\274NE9g\032\326\341\224?\334\024"
+	.ascii	"\004\317\273\244\002$\214Z$\n\223\352\036\356Owo\023k\031\002"
+	.ascii	"\326S\023K\n\t\212u\227\315\256\345\006\247\213\265D\202\336"
+	.ascii	"\273\3416\233K\026Ww\003\022\364>]\032uO|\237X\313\333\274\272"
+	.ascii	"\033n\3632= 5\261\236\220\240\314\247\rHP\254\247\013\305\272"
+	.ascii	"<\267\311t\252\321\274N\033.\024\253\357B\257\236x\220\240WO"
+	.ascii	"HP\254\034\234\206\224\007\366\344\006$@@*rd\034kb$\211LP\225"
+	.ascii	"\306\242\007\240\325\030TL\032\211r\224\306bj<\016\r\035\177"
+	.ascii	"\002\220DA\306\320\217\2152i<\376\320\300 \364\343c,*\205\212"
+	.ascii	"D*\370\370\350(\327\344\320Z\"\211\\[(\"\201(H\036\221?\305!"
+	.ascii	"\341c\220\b2\026\221\312d\211\025\210H\350\307X,\201L\022\225"
+	.ascii	"\220@H\210\310h<\032k\224>+\f\305\244\320\205#2\206\362h\254"
+	.ascii	"\201A\\\205\354\320:T\363\030$&\360b\004\027%\224k\020\222\250"
+	.ascii	"\\\341\347(\264bE\036W\354\330(\213\306\021\204\210+>@@\271\006"
+	.ascii	"I\020\204\243\\\203x\224\306\365\207x\234@\317\206\344*$c\210"
+	.ascii	"\350\"\031d,*\213\304\013\364\f\255\312\344\f\345\215\362\205"
+	.ascii	"\265\004\033e\022Y|@\007\034  \025j\322X$*\215G\035\035$q\025"
+	.ascii	"Z\301\302M\362hB\016\217ru1A\005\3125\271\236\220\201\316pE"
+	.string	"vH\236\240\374Y\205\204\216+:\220\020\200\027\002 \341\202\344OQ\231tA\364#D\374\231\300\306\004\t%\222(\203\004\017\020\220\n\234d\221\005\007\245qE\"\211~p\206<;C \240\031@\304\025\251\263\266p\034ZOXa(\272\3101\272pd\221\243\312@A\t\243\350B\006q\215q\363\237\"r5\256A\352\023\320\201\006\035\244x\241\346)>0\361\201\t\341S|p\342\304\007\035\234P\337\301\2114Y3\203\210D\252X\211V\242\n\f\201\212&\034\2213\2028\254>+\320\221\204\235\325\007\350f5\026\205\200\210+\013\030?<F\"$rm\341Xcs\200V!\025\210F\021\222E\033\241\035\245\317\021\206q\204\0250~6\254AD\344\332\0021\002\245O\213\r\2171\343\307\250D\022\225\311\034\245\017\212\rV\235!\"2\350\250L\026c\330 \2111~\354:D,A\005\242$\216\320\361\350"
+	.string	"\037\032\233\037#\321\003T\240\025YL\256@:@\307\"r5a\205\2375\306\017\216\322'E\215\222\250L\016g(\213\310c\021i\302Oq\210h\234\001\264\243\364\351\340\204\322X$R\223\253\320\317\214\025k\220\n\035\245\017\016Q)\264\262P&W%q\002\034\224*\200V!\2421\250\350B\231$\n\r\207\210\\\004\031\213-\034\207$x\2018\304\263\016\025_\030\217E%\321\317\372\202\bBD\345Q\t"
+	.ascii	"\245\317\f\244\322(\202\f\342\332b\347\030\374(cE\226P\036\217"
+	.ascii	"\310\0228J\237\025\222\304\0270~\324\025\222D\245U\372$QX\207"
+	.ascii	"\212J\365\036x\260\302\003\n%@@\375!\201\\\205\210\200\326\030"
+	.ascii	"?\311\022\306\"q\250\304\0172Y\202\204\007\245\212\225\b\210"
+	.ascii	"\346\0218\2210=mx\005\372\341Y1\345\237\335\223\2665XG\260np"
+	.ascii	"\351)\032=\250?-uuv"
+	.ascii	"\313\226\023-\267[\214h8\231kk\263\264\037\023\213\n\r\303&\226"
+	.ascii	"\364ih\305EJjn.\245\353{u\257W\r\032\231\036\237\316\031\271"
+	.ascii	"\264G\247\225)\365\305\235]\3511\303\2754\2744\2701{6\345#\353"
+	.ascii	"\355\312\315\027\030!d\254\244Hr\234Nv\300UA\303\2712v\306\215"
+	.ascii	"\n\367I\3210\223f\335\226\344\262\360\232\332l\327\216$Im\255"
+	.ascii	"\232U\263l\352R\316J\271e\3331\342\006\004\332\326\256\201\211"
+	.ascii	"\222\026\t1\223a\316>Q\303\322\214D\355T'\r%C\322\326\242\r\345"
+	.ascii	"\270\330\335\325Y2Kf\2436\313a\336r\317\013\360:q\204\370\255"
+	.ascii	"\331mt\247\213V\333[[[\306hi\235`\2201:K\240\226\213)\314L\217"
+	.ascii	"&I\350\230\fn\265\r\273e\022f\305\354\225{\213L<\213\356.RU\b"
+	.ascii	"\0353@\300\300\347\255\330\333\354\215+\350\r\261c\243L\314\222"
+	.ascii	"\333*.[\340\306\332\332\032nsPA\345})\361qE\316\017L\275\316"
+	.ascii	"\017\257[\"^6Ij\027\305\n\216X\222\030\026#\267In\301T\260#v"
+	.ascii	"\314\266\026\311\320\031'\205\357\210\365Q\204\007\024I\333k"
+	.ascii	"\240\216\305\360\364\324\326~}\351)\365\265\265E\336\226\343"
+	.ascii	"\344\002\2505$+\310\037\304v\361\330m\022\232\r\351\342\025B"
+	.ascii	"\225*\222\244\206\355b4/n\203:K\365S\267:\246,W\252%\347.\307"
+	.ascii	"nSM\032\031._\200\027\311\031\302\346\350\210\r\271\035\267\\"
+	.ascii	"\267?Ppp=c\217\262\262\266v\353\326\307\026\2302$-\353c\210\027"
+	.ascii	"'\001\204\345\2503\344\353<\221\206\212!\205fDh$I\322\030c\024"
+	.ascii	"@0HP*\031O\310\266\033\023\300\225\306\003\242\234E\241B%\"\""
+	.ascii	"\222$\005\245\032\303\030|Mt6\254{\237\020\206\362\241\230T]"
+	.ascii	"\322b\267j4\267k\306\313\3124\352\245!\020\031L?T2^s_i\216*\375"
+	.ascii	"t\032^\2150\242\264T^\001GS\273\212\2647\303}.\\\340n\002\333"
+	.ascii	"d\203{\002CG^\300\212\211\371\277\227|RY'\335\375\246\357J1\\"
+	.ascii	"-g\205\030\236\360+\270d\\[6\016\264@u\205Hb\371\025\212\002"
+	.ascii	"-\321y&\004\254\237\\\242E6\023@\224%\327\251\353\204n{\214\327"
+	.ascii	"\b\201\211\021\342U@\177=uj\323\300x\n\361\263%\241\236(\213"
+	.ascii	"\264\360-\204\016\363\032\224\b\303S^\373\223\377\306y\377\205"
+	.ascii	"\r&3\230\332 g\331\210\230\226\276\020!p~\271hY\3227w8\311\026"
+	.ascii	"\344\025T3pZ);(a\344j\363A\036\241t\200e4\234\001W\023gk\310"
+	.ascii	"h6v\317_\312\231\301\241\3611s<r\352 N\233ek\250ke\006\2771\227"
+	.ascii	"\r\r\313\250\301\205\212\303\356\360\025a\322\341\330\367\031"
+	.ascii	"\341\313\023\362\314Jd9\021\031\337\006\r\207\344\224\216Jj\242"
+	.ascii	"\337XmR\274\274\314\300 \032\352\004\313k<+\320c\222!\227#I\002"
+	.ascii	"\374y\265\030\222\031\032\261h)\234\303"
+	.string	"\273\262@\254 P\366\241\324\203&\3130\261K\254\202\036\373\375\332\366E\272\244Q\002+<\342%P\237Z\230\003\303\002A\n\241\337\003\245z\327\361\232\230\347c\013\345\031'\004\350\206e\233\264\316Bpj\331\021\037W/\353Bg\307c\355\003\f\275\t\fst]?\373*\210\331\0365Av\324\326\t\307\245\266O\322\225-d\033\255\273\200.\335\314\306\276\262\323+\273\f\3165\350\355+\3720\275\321js\221\240\013.\346.3c\330H\357\2365\321\031W\330\357\f\222\345M0\203\031\362\037\363U:@(\r\275\020\330\007\334\234h}y,\024v~\320\312Iu\251\332\007\b\246I\3463\353\244Z\224\315\322\233\016\363\245\021\302V\342\356\314\013J\3556\031s\241t&\241M\004l\215\225\241\246\227\252B\250\355\252\307\352_\204y\034Z1\345\206\345\313\352\203\"p\213\207\372\313#\377N\026\004Q\025:\270\260"
+	.string	"\221$\023g\200(H\rq\220\247h\251\\y\345\331\373e\300\245j\307\273\0133\350\222\240\2052\330H\202\347\300\330t\337UV\224\007\t\234\327PX1\250\212\013\357\207\315\371\251\330,\002\240\267\321\220\253.:\225K\0049\341\251\321\360=\264\241\333\326\310\222~G\370\337\355Xix\001\210'\"\266 8\317`\371\2670<\313x\334\226U\222\2128gHf\264B\016\023D\231y\233L\\\363\272\235\202,e\340\317\322\224\355\363G\225\330\223\360\034r\201}\326\337\241\307\377\003N\331\210\244\200\371\\\325\210A\350|\375gA\n\204\270\367\247\304\254\313\024\022\245KS\207\\\005\204\263y\355\220\311\315\022\026\302;\212'\016$\236\035\250\304\"D\224\270\033=\302\304\333.\262P\177Vt\022\227g_!k\216|cXgy\f\343\244\271?\245\310IW\240\226h("
+	.ascii	"\322D]4\002Iq\223\233\307*N\252ZX\360;x:\225E\231\037\253I\""
+	.ascii	"\360"
+	.string	"\233d5^N\303\355\b\273\177\3646u\365A\300\315\321w\205X\270\347\244 \240@\250\266\030{\346&\031\312#\340\366g\201\365\223DnqY\326\251X\027\003G!\247\001q\336\020\274;\331+\233\031pZ\372\323\355\226\321\0032(q\375LU\267\217 \270$\232Q\362\374l\263jj\f\"\007\264k'hNQ_r\322\203C\373\\\202\220oOa2\355Jo\036\341\354-\021c\374.$y\230\264\026\332\300\335\316=\031}\376$\f\324\022\2061\362SP_\326ys\tE\323\f\205i+\376|\007yRT4\3572\trPK\271U\\\211\263T\323t\b\203u(\235\341\372\327\236\320\337<\035\"i\355Q\202\251\302\305\331o\272M\332MP\200\362{\\V\311\226=\343\313\301w_\326*XU<\255\355.\342Um\337i\216\245\212u\324\372\234;\356\031c\252\255\307\315\003f\t\035;M\366\363\316"
+	.string	"\342\254\323\344.w0V:\230\224\026$\231,\231\200/>\307\327\221\322?\243G\260]\\u\346,\262\220\355\n\2668Td\273 \026\217,6A|RY\207m\360"
+	.string	"tl\230$t\200\354\257\260m\250\007Q\002T\234\217rl\363\027\372\251A\202\316\376mj\313\362\205\334--\256\031\363\036\211%J\030>\2744\257\331:\234>\022\021\225<qB\266\302;\022F\350\026T|\262\036l\024@\206%\250K?\253\266I\213\206\325\030\177\253\177\006c\257\275\221\301t\266\376\b\034\326\254\365\002=\243\211t\275\205?\227,\002\301h\254_\202\036\270\2431\325\310!t:\202\312\215\031=\241\332\034\024VH\0250\360\f\335\372\300\361\356N;\237\374\267\230y\347\006a\325\252M\247"
+	.string	"\007\305\365\370$m\345:6\037E\034~=\330&\037_t\246`\033\327\254=]\352\330\366e\032\330Z9\271"
+	.ascii	"UF\346\301\300$>\f\b\f\3175\360\311*\326\357\332\346\326\257"
+	.ascii	"\342\223\206\270u'\002\260\214\335\337\352\313\245\355\353J\260"
+	.ascii	"\244\225\341\354pN\001\007\367o\226\224\272\256\303iN>\351\377"
+	.ascii	"M\203\035\006\003_\351\376L{/A\304\333\222M-=\302R\0306K\323"
+	.ascii	"z\nf3\024\366\b\234\riu\204\n6mU\263\005\205\257\337\223\221"
+	.ascii	"-#\026\302\360p\004<R:%\307\016\312\n\316\266,?X% \351\003\360"
+	.ascii	"\247V\205\031\304\003\364\242/4I\006\371vj\017\353[gx\353\241"
+	.ascii	"\300\372\205\355 \363\307\353\034w"
+	.string	"\300\363\006\020\020\301\222\017&G#9A\027\f\334\327\341\261\004}2\020OZ\264\221h\222\\\200\b\374\212}\276\200\024\224\005 \341\361\304G\254P[)\214b\034\271\307\305\377=\331\266\264hfT7D\357\310\037\244\214$\260\323\325\336\275\211\270\021\316F\347O\320$\223\024\210m \331\223\344\t\200b\215\021Xm0\nI\206\355\342\036L\255\243k\272\030\353\267\323\204\222\324\022\204\365\310\350\224\032^X\215K\241m\261$\373\201\301\276a\216\305\234$*\202\272h\242\241r\034\204`\334\302J)G6\272\250\321\265{C\342\033\317\226\022\035\266"
+	.string	"\222m\240\032y\320\354U\332C\213\377\254\211\234\036l0\225\330@\206?P\235\205X,\304\272M\330\302\321\323.n\211\261\235\230"
+	.string	"\362,I\374\232\242\317\2660\013\033\271\315\363Y;\022S\303\300\317\205\274a\335\222\330J\244\320\225\324\262b\2432\367\340\374\2579\202\317m\252\273\350<\214\343 \f\0222\254\337\233"
+	.string	"X\023\257d:\340\363\211\345\255\223\240dp7\246\371\251\202\353<\347\234?\004\231U\213\376\002r?J\2362~\013\234+\321\034\016\335\"t\013\335\320\370\236\314E\354\301\217\324C\353V\r\303k\342\217\330\347\261\373\212Y\213\216\007i}\026\317\250\203\344\036\034<N\271\305\371\325\354\326#\373\331\271\034\355\344\\\374\374\374}:~\030\207\254\376\007\252\253\241\356\261\310\272\304\353\214\007\363,\214u\226%\264\2603\f"
+	.ascii	"\364k{,\362\261\363\240\371)\252\227\303\364bg]\325\365u\353"
+	.ascii	"\333\021\263\250\232v\2033\020\340?\333F\332\2545Z]\215\310\210"
+	.ascii	"\253\177\250\375\270\303\221\013\365q\307\234\213\205\265\013"
+	.ascii	"\003\233\377\235\004o\200z\031\332\260o\275V\373\213\315\235"
+	.ascii	"_\270\351\366\004\276o\016\354\367\373\235\f\233\361\347U\331"
+	.ascii	"75\351\343\r\357\024\374\376n\006n\214\216Q\210\036R\036\370"
+	.ascii	"'\267\271\033\0330\367\2009\333X\323L{\363\342k\351\242\237M"
+	.ascii	"\353o\334?HlT\277i{ \365T~\031\273o18\217\336\267\344L\342~\232"
+	.ascii	"\037,\027\362Q\264\203\367r~\273tZ\365\261v\022d\323s\300\373"
+	.ascii	"+\356#\t\340\355\024_4N\257\341\236\310\367`\326=\276H<\"xX}"
+	.ascii	"k\032\2566g\332h\346\327\237A\3347\364\217V\331\244\350\304v"
+	.ascii	"\2602S\375\264\202\016i\307\350\351'\312\303\344\325\373\213"
+	.ascii	"\230@\033@b\264\254\256\242\2360\334\313\016\274\n\373d\375\230"
+	.ascii	"^\222\035F<H\275;L\377\311z\247:\037\235\343@\267$\376\356\227"
+	.ascii	"\003\240\366\177\227\200\017J\237\007gb\026\367\034\236\2142"
+	.ascii	"\272\367\275{n\221\317\005\254!Nn\267\377g\333\016\033\207 \264"
+	.ascii	"^;\273}\233u\033\225drX_e\354\377\327,x\3756\240\207\233_%\227"
+	.ascii	"%_\377?y\303\260\347\360$bc\375e\247\277\276\367q\346.\037VK"
+	.ascii	">\035\372\022gv\262\323e\363iD~\335\232]V\327q\333c\0271\377"
+	.ascii	"\352\257\234\0246z=\274?SC\013\272\300G\276F\275Z\317Y\366,g"
+	.ascii	"\3146p\362\313~\307.^\331\215\31580\013\035\302\251|\366q\f\376"
+	.ascii	"\254\237EK\377\274\023\343\221\267G\207\244K\366Z\276\213y\305"
+	.ascii	"\317\251\327h|\262\264\t\337'\032\327\3445\325\263\034\f\034"
+	.ascii	"\347'e{\326\375\307\2718\365\363\320\376\026\3427\027\264\343"
+	.ascii	"\367\026\367\310\327JZ\036\355t\005"
+	.text
+	.section	.gnu.lto_.symtab.a3940a5ca6de62c7,"e",@progbits
+	.string	"checkFuncMovingSumExecutionTime"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\001"
+	.string	""
+	.string	"checkFuncTotalExecutionTime"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\001"
+	.string	""
+	.string	"checkFuncMaxExecutionTime"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\001"
+	.string	""
+	.string	"queueClear"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\001"
+	.string	""
+	.string	"queueContains"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\001"
+	.string	""
+	.string	"queueAdd"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\001"
+	.string	""
+	.string	"queueRemove"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\001"
+	.string	""
+	.string	"queueFirst"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\001"
+	.string	""
+	.string	"queueNext"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\001"
+	.string	""
+	.string	"taskSystem"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\001"
+	.string	""
+	.string	"averageSystemLoadPercent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\001"
+	.string	""
+	.string	"getCheckFuncInfo"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\001"
+	.string	""
+	.string	"getTaskInfo"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\001"
+	.string	""
+	.string	"getTaskHistogram"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\002"
+	.string	""
+	.string	"getGyroPidDeadlineInfo"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\002"
+	.string	""
+	.string	"rescheduleTask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\001"
+	.string	""
+	.string	"setTaskEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\001"
+	.string	""
+	.string	"getTaskDeltaTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\002"
+	.string	""
+	.string	"schedulerSetCalulateTaskStatistics"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\002"
+	.string	""
+	.string	"schedulerResetTaskStatistics"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\001"
+	.string	""
+	.string	"schedulerSetMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\001"
+	.string	""
+	.string	"schedulerInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\002"
+	.string	""
+	.string	"scheduler"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\002"
+	.string	""
+	.string	"cfTasks"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\001"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a3940a5ca6de62c7,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
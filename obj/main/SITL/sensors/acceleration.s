@@ -0,0 +1,1379 @@
+	.file	"acceleration.c"
+	.section	.gnu.lto_.profile.a97c749412de6111,"e",@progbits
+	.string	"(\265/\375 \nQ"
+	.string	""
+	.string	"\006"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\020"
+	.string	"\""
+	.text
+	.section	.gnu.lto_.icf.a97c749412de6111,"e",@progbits
+	.string	"(\265/\375`\020\002\315\r"
+	.string	"\306RIC \253\2525\307\025\023:ET\271\025\231P-:\004c`\350\306I\025-\210\0039;TV\310\3214=/\017\020\020\020XA"
+	.string	"A\200\221\026I\323\264O\323\304\363\024?\331\376\376\333\177O\376-i\223\334\0014"
+	.string	"4"
+	.string	":"
+	.string	"\2313\341\240G\006B\252\265\372l\rU/\032\354re\267\026\033\275v\212\031\363\367g\257\227\237N\337 c*\025j\324\233\356\355]\217\320\312\340\300#y\227\032w\354%gp;\370\370\270]\274#\264\260\213\271:\034\263\264\227\233\227\233\355\244yW6\310\020l4\217\177g\024P\"\232\360\0339O\032HM\270Z\351\212\001\241A\203\266\177\326\210\267\234\001\235\204\303\345c@\n\020\320E\214\247\202\006\003 @\f;\326\205\207\373\255\225u\222\220`T?\255Rr\242z}j\303\241\034\b\201>\036\317\265\023^\250z\321`\032\031\344\204\020\006)\f:\375{v\302:]\314q\006(\261\250\207/p\t\370\250\260\217\2364\251\261\304H\223\354\036\224(\276&\224\006"
+	.ascii	"\023\246\271\270h\321\366J\250\341%A\201\020\215\024\244\310"
+	.ascii	"0\034`\202bDt\007\021p\275q\362R{l\007a\344\0270~\331o\027\242"
+	.ascii	"\037\003R&\222)\374\362\323\350\310\247\345M\250K\"\221u\323"
+	.ascii	"Y\3141@\353\255'\355O\372\027\003o\246\2706\017`\372\241\357"
+	.ascii	"\236|\252*\301\304\233Q\254<\217\225\212\351\252\255\256\275"
+	.ascii	"\321\276]\206\212\357~\313\017}yC\216\333A\256\313\362\374\f"
+	.ascii	"\200'x\367\002-Q\251\234\035\030\005t\302q\236\265\353\017F\257"
+	.ascii	"Q\364&\376\272z\220\007"
+	.text
+	.section	.gnu.lto_.ipa_sra.a97c749412de6111,"e",@progbits
+	.string	"(\265/\375 \350\355\003"
+	.string	"\362\204\017\032\240E\303\001\377\377\377?\347"
+	.string	""
+	.string	""
+	.string	"\340\375\311\326\214l\331\020\333\252\302\312\235R\356\002\236\324$\025|4\241\347\355\250\\\263\314.+\273\311F\204\300\257\232p\371\261\265\263\330a\177\r\007\001\032"
+	.ascii	" \306\017s\203\336p\303\016\302\f\270\031HV\003\205R(\302a`1"
+	.ascii	"TclU\374\345\f\260\b3\003\032<a\351Le\237f\001\254\f\214\315"
+	.ascii	"l\221\3459\025l/\326m\240\r"
+	.text
+	.section	.gnu.lto_.inline.a97c749412de6111,"e",@progbits
+	.string	"(\265/\375`T\003m\020"
+	.string	"vVQA"
+	.string	"\223\223\306\247\375\205\240v\243\313\016M\223B\177\363\217Mw@\366\346mX\302\300\347\\\234t\030\275\264C\275 k\206IH\200@\251(+\"\351\345\377\216cp\375\221\252\003m\020\220'vK)S>"
+	.string	"@"
+	.string	"8"
+	.string	";~X?R\020\244\022\036\320\205\332\363\372I\342\271\216\364\206\213\021&\236\231\262:\2342\310T\277\245\b\027\030\037\"\344\353\226'0\304\230\032\214y\206<\210\223\217Z\266\330]\352\005\374 \004)\023\264\353\272 y\265k$\242$\355\356\207\363c\211\245\025*b\020K\013\247\364\2016@\360\001\205e\205Ex\354\356\202=K!ww3\244"
+	.string	"~$\253\352|\277SB\342x)\261@\024\034\002\212\201\336\211V;\201\225\353\001\177G\224:vWd\2233\0163\356;z\306\341cGsS\031\222M\315\005\225\254\241a\341\2561\311{\336\031\247\217\327\373w\200\233\3736\345\377[\250Y!]\005\tFI\343E\214\034(yK\217\231\233\222\021\004\340\254\210\324\306K)\305\365\001\003I\201t\224\307\353\205J\266\334@\303\302a\027\330\004FS\022\032`ZBL2Bt\fT\322ts\232\361\371\023\\\250\361L\250\310\004%\244@I\2411\200\002\241)2\017\022"
+	.string	"\005A\b\304HPET\352Q\357\001xI\223\013Ih]\241\321\013\200\004\271R\273\237\311$\322$\377\343\272\234-\206\223\025\211\224\342\320\345K\357&6B}4w\002\353\"@=hA\310\304@\022~E>\233\235b\252\304\347\277\"\234\263\270E\332,&\237+y\016\216\303\221\246h\030J2\026A\344"
+	.string	"iq\204{\350\233\231\250\346\357\002\353 \321l\361pM\320}\246!4\344\210\341\013H}\304C\304B\306\2037\330\330S\303\003\364\306uNW\323\337\202"
+	.ascii	"5\347\353S\026\244\354b\r\313\177\311\337\377\203\266$\356\223"
+	.ascii	"\212\245\035\372\271_\312L'"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a97c749412de6111,"e",@progbits
+	.string	"(\265/\375`g\001\275\b"
+	.string	"\242\315(+pK\222\016\374\377\271\252\001\267#\017\252\252\242\327s\013U\017\242\032\202\034<\267\217\374\325\336\237*1U,\030\335\004;\356&\223\f$\031\tx\270\034\232\273j\352\020e\372:d\203\323\360\342\213\331a%\217\270M\027\243\304\270\304z1\275\317\020\351\031\364 \337\005\222!\025R\002\211P\007UU\036\375\363\034\027\306=\227\301\311R\225\332~As7\305\236b\235\026\255|\0326@\305\351\223\267q\217\004'K\t\211\242(\272 ^\013\"\215\031h\247\240"
+	.string	"yA\217\013\232\217'\2545\246\331[\236\004lE2 `\"!\351\356\233\3106\300\351\246\004Kz\035\3356U\t\3325\210K"
+	.ascii	"x\266\341Fkp\"\n\027%\223\231n\300\322]\002\226Z\305|\201\333"
+	.ascii	"\367\221,,\016c\337\303\263\025\3328]\271\2568\203r\036\033\337"
+	.ascii	"\f\204\013\350W\360\272\b\363H,\274\333\355\322@\373\001\t\272"
+	.ascii	"IO\217\016`\223\364\352\006\266\235\205\341\334S\326n\246\323"
+	.ascii	"\232\324\212\033"
+	.text
+	.section	.gnu.lto_.pureconst.a97c749412de6111,"e",@progbits
+	.string	"(\265/\375 >\361\001"
+	.string	":"
+	.string	""
+	.string	""
+	.string	"\023"
+	.ascii	"\232\004\001\232\004\006\232\004\016\230\004\020\230\004\024"
+	.ascii	"\231\004\031\232\004\032\230\004\033\232\004\034\232\004\035"
+	.ascii	"\232\004\036\232\004\037\231\004 \230\004!\204\004\"\230\004"
+	.ascii	"#\232\004$\230\004%\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.a97c749412de6111,"e",@progbits
+	.string	"(\265/\375`\376\001\345\n"
+	.string	"b\217,.pk2\034\344\003\241\252\302\017Y\025\373\377\315\247\377\253\352\272p\341\303\032Ym\250h\313\310\340/\211\331\333\322\210\342\002\270mB\310\2262\005c*,,\317\023U8\341W'/\321F\217\340\006^D'\204\324\251)\327tf\3123]\222\356\034\364.\345\222\203\217@v\316\200Om\301\2242\016\0228\033\217\"\243\343=\214\367\236tV\345\025fRNE\201\237\227\365T>-\215t>\254\007x\262'UNuB\312\035\036\177#\364\256\361\206\316Jy\205\317\223\225\263Ii\237:\031\312\027:\243:\274\265\250\334p\363\234K\355Ry\301\003\206\276\032\001M\250\201-d\246DDRf\033@\002B\024\263\273\001\0210\275C\024\3214\313n\221-F\376I\251\206\305\214\302\233h_\363a\276\220\177`\211\rJ\302\212\210\342\371x5Y\005\246;\306G\037\262p\035`\336\343\257\233/\351\255"
+	.ascii	"+\301Zx~ M\017\021\221\213\264\312\244_Rb\227\020-\210\007\344"
+	.ascii	"\340\230\337G\n\270\244\372\035H^k\001\035F\320\227,\200\247"
+	.ascii	"n0[R\375\f\022:\371dme\240\340f\002\276\337\025\017O\265\376"
+	.ascii	"1JR\351'm\341\334\305\376\037|\357R\277\"\022\324&-0u\246\036"
+	.ascii	"\202("
+	.text
+	.section	.gnu.lto_.lto.a97c749412de6111,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_accelerometerConfig_Registry.36.a97c749412de6111,"e",@progbits
+	.string	"(\265/\375 \234}\004"
+	.string	"\024\b`"
+	.string	""
+	.string	""
+	.string	"0"
+	.string	"\005\001\212\001\202\200\200\374\342\203\334\261\033\030\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\354\007us\350\374\006uq"
+	.string	"\005\001\006'\001\024#?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\"./src/main/sensors/acceleration.c"
+	.string	"\004"
+	.ascii	")\"\301$:E\2217\200\""
+	.text
+	.section	.gnu.lto_resetRollAndPitchTrims.37.a97c749412de6111,"e",@progbits
+	.string	"(\265/\375`g"
+	.string	"M\t"
+	.string	"\226\021A90\221\322\001 T\313Q\233\374b\002\325\3540\227\007\305\030\376>3\240y\325\300~l6\022-c\203\344-\220$/Q0($\271\214\\e\245\204\351\350\254\267\204\333\222\235R-"
+	.string	"/"
+	.string	"4"
+	.string	"\237\236\007h\237\026\355\232\217\255\375\213Dc\005gwi\006r\361R\364\177r"
+	.string	"\325\nu\271)\354\256\245j\325qg\267}`\233\301\366M\366;\273\273\316X\366]\277\234\033\207\fA\314\356F,ga\363E\344c\373\322~\311M\304\273N\007\355\262h\\vG\004'x>=^@\013\235\315XnX\301RY\206\257r{\342-,\005\255\017hv\370\027\205Ev\305S,,B\271\300\2203!\237\376I\373\334<`FlR2f\217(\231}\004a\311\253\017\021\234\311s\200\370\026H$\260\202\314\205>\3203\215jG\3528nD\303\n\206_\027\322\317\033\225(WC\03220(\321Uj\002\301J?\343>\r"
+	.ascii	"2\2419\034\030.,\310\256S\t\267jBL\274\241\027n\301\220K\260"
+	.ascii	"\315j\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_accResetRollAndPitchTrims.38.a97c749412de6111,"e",@progbits
+	.string	"(\265/\375`X"
+	.string	"\245\b"
+	.string	"&P;8Po\322\001\240\210\223Fo*H\251\315<\224\214\331~\013\022\300\fg\216i\253\221\217\362\310\221e\021->\013\204TTQ\021\261\025\370\031\245\227\277\n\204Y\333v\357\224\002)"
+	.string	"+"
+	.string	","
+	.string	"\267\314\331-\3778\366\250\223\t\222\227\335\235q\343\334!\347\377t"
+	.string	"RI\342p\203\260\273\206\244R\305\035o\273\300\366\201m\230\035\\\331\337\bF\r\373\231\215\031vfc\2612\240\262K\261\212Y\225D\361\260}\037\344\236\350\037N`1\355\256ui\213l\3532\367\254p\223T\t\347\002\232{\006\035E\355\271\347\206\213l\366\\\372\337C\034\374\216K?@\300\223.\003\036\241\271\274w\003\214\024\223K\306:\032\375\204\256\232-d\030v\315\255\322M\313\266\251}.\320\304\3526;\004\246\fY\235!J\353\264\276\356\247sR\027\252.\216\374\221\007\016"
+	.string	"2\003\302\360\305\302>\231\020"
+	.ascii	"\021P\034U\311\036\bx\273&v\207\310\200\n\361r\005\270t\213v"
+	.ascii	">\001"
+	.text
+	.section	.gnu.lto_accResetFlightDynamicsTrims.40.a97c749412de6111,"e",@progbits
+	.string	"(\265/\375`\246"
+	.string	"u\t"
+	.string	"\326\220>;0\3456\035\200\323\335\003\267\344X\270\300\023\013\326\340\352\202i\017\303.\267\322\n\317\200w\234 \352C\200OQ\267\303B\"\020A\300\212\301\023\214\277M\026\217\b$1\315;\332N)+"
+	.string	"."
+	.string	"."
+	.string	"\330\3471\2036\200\217\241=\351%\003E\265\273\324\3728x\t\372\037}\340\003\302\270\274\032v\327\362\003\332\270\255\333N\260\275`\337!W\340\210Q\245B\271\262G\217\264<\354\007\254\325a\317\313\004s\260\332\325X\005\330\3234\205\330\276Or\261\363\021?\244D\273\213}\332\035;\250\237\374\242!\256RJ\271DP\242\327\314EoN\252\006\242'n\362\025\204v\227\341\323\037_B\341\203|\272\302B\376\363I\360\213\314\347\305\3264]\3458\231\267El\232\226\321\317\253_\267}\264\343\262\r\325\274\217j\020\\%6\217rj\365(6\206\037]\240\344r\n-\017\367\026\226\025P\024"
+	.ascii	"2\003\302p\331\302\326M8 \033\300\0358\230\327\336\006f\220\200"
+	.ascii	"\023p\334\257\222 \001{\2039\240kxw\b\007\250\350\227{\301\245"
+	.ascii	"[\264\363\t"
+	.text
+	.section	.gnu.lto_pgResetFn_accelerometerConfig.41.a97c749412de6111,"e",@progbits
+	.string	"(\265/\375`E"
+	.string	"\335\b"
+	.string	"\266\320>;0\3456\035"
+	.string	"\360y\354Gn[\271Tz\310\020\245\367\253\261i9-\007j\353}\r\223A\255\307r\002\004\245\205D \"\"\002l72\030\215\303\"\021}\342\fU\332d\357\224\002+"
+	.string	"-"
+	.string	"0"
+	.string	"\005\326\251C\233\345\243\307\236d%\303\004\265\273uv<\274\f\375\223.\340\001a\\\006D\354\256\245\007\244q\317\333V\260\ra\033%3d\177\364K\252)\241Z\020Tv?\251"
+	.string	"\233BO@0\266/\355\213\\\024~\3049\301n\b@iwl\260\303u\352\361\007\326\351\365\245\227\2238;\036\370\202eW\274\304\302\017\247\006&\227\315%j\374\221\213\2154}\370\034\353\224\341\023\262!:\2112e\217\03599\354W\273\273\016Z\306a\340\307m\227\263\f\327m \346i\022Z\226a\365\363\272\217\323\276\312m\330D\315\274\257f\022\334Qh^\005\273\316\253\230Q|\2653\344\212\024\013"
+	.ascii	"2\241\007\034\030.h<Y\0175/d,3\230w\t\240YM\001wy\321N2"
+	.text
+	.section	.gnu.lto_accDetect.42.a97c749412de6111,"e",@progbits
+	.string	"(\265/\375`\323\003\225\033"
+	.string	"\3462\262H\240\230Q:\300+\271{L\274\320\311\031\2163\023\340\370\261\227\277)\277\220g\024ED\202\304\277,\246\264z\024\365O\227\247K\255O\350\246\375\245I\001\337\203\215\215\203\207\366{\221=\364\016\361>'k{\322\b\331r\247\024\242"
+	.string	"\223"
+	.string	"\230"
+	.ascii	"g\262\363&/N\240\326!%S\265\002+\370B\371\321\300\037 ?\226/"
+	.ascii	"@~\304\220a\307<\007\032\005=\310\026\257\311L\255\300\331\026"
+	.ascii	"y'\317c\260W\351\"G\272\223\307\337=\366\036\241\303\250\204"
+	.ascii	"(j\232\236\345\323A\021 \351Y\362$\237\320|\255\2155L^\206Gj"
+	.ascii	"\274L\362\341\230.\272Aa\325\263|9\350\006&JBx\223,o|\f\360\203"
+	.ascii	"A\027\324Z/\374\004\372\305\230\224\036\b\"\322\203\375~\350"
+	.ascii	"\204"
+	.string	"\342\2242\260\037\214\271\260_\215O\227M\255\325\263\367\243q\313n\373\3116\t{\213\002:e\255U\203\377T\302\205\314\b\351\005\371qL\202R\"\3233\267|(\277\360\034\246\024\317\024wS\r\255\265\326]\"\033\270\233\032\262\260\206x\207\3547\371\005<\370\003\220y\272\274\323\355z\360&==z\232zz\247o\340G\212f\306D\020\326\032\264\225\246j\031\251\212\334\351\267\3577]\350\230m']\271\363\225QM2\212\265\002)|4\210+\371\316\241\230x\007A\305Z\253\204\217\356P~\004\376\311\316\203:\277j\005\242\225\241\374\270\200\316i\177)s\213\334]R\f\257\312\257#];\367\302S,RU<*\237\271er\211\240n\233\177\217\202\302\253\361<\344\027\307\004\346g\242\361k\nX\373\306b\276\367\325\021\002\236)\376\354\316\217\272\001*Fn\204\2468E\227\310\027\376\365\305GTy\251\233N"
+	.string	"K.\220]e\342\2030\003^\345VL\334.V0\031\225\211\n\214\224\327\221R\376\224\211\345u\344\3072D\025b\265\244t)\266\211\020\220z\354\250u\367\036\266M\234\275Z\311\235\303$Zb\3145\366uH;\367a1\035.\307\206\033m\271\0217\0216\034\315\305\t\034\355C\255F\033\320\302vb]\263\200s\273\311\241\341l)l\265\032m\226\303\335r8\266\334\f\347\206\246bV\303\345f\026\030\370\266\302\206\233\345\334n\270Y\fX\217Na\036\264d\b\245^\277zY\256mz\326'&\233\366\r\212\371\336h\343\263\273\006P?\246`\256c\335\224t\255l\201d\233"
+	.ascii	")\b\323\227\237\211\346\350\265DC'KOu\201\354\023\217!\253\022"
+	.ascii	"kF\221\326w\213Vp\350J\302#\313x\254\237\213P\026\372+w-\320"
+	.ascii	"\325\351\232\330\235K\227J\341\341\360\tH\250Q \244\024C\312"
+	.ascii	"\020%\230\t\215\002q\213\001P\0021(\225y\021\220\311T3\3122\007"
+	.ascii	"\213\246@\352\335\304\251\323\036\371\243\3023\372\274\023J\274"
+	.ascii	"w\224g\032{CX\003\275\277\211db\240\332W\034{Q\370r\376\317O"
+	.ascii	"mc\342\340`\025_\274\370\315QGR\267\020c\224\t\315T\310\356+"
+	.ascii	"8\342\255h\334\023\032ho(Nf\271\220Y\"\204\343A\201\267\361\026"
+	.ascii	"\267.\222\220\f\336\352\237\312C\234Y.\002\007\037\024\274\234"
+	.ascii	"\357\302\311\224\001K\223\037\210\b0\037\343U\\\275\267\352{"
+	.ascii	"\251\206\335/\234M\241\373)?"
+	.text
+	.section	.gnu.lto_accInit.43.a97c749412de6111,"e",@progbits
+	.string	"(\265/\375`w\002\275\023"
+	.string	"\326\344\203I\240\326Q:\204\361\270#M\003\326\276\261\3519\2764\f\353\273\205\274^\332\270\337\032I@\030\371\007\330h\332os\267?\350\207\177\270\331f\035f\202\260>\016\017\376F\216\033\304\3322\243x\032\360\333g\241Z\337\020B\244L)k"
+	.string	"g"
+	.string	"v"
+	.ascii	"R\346\325\030D\311\366\220\255b[\325\376\215;\r=\350\301\260"
+	.ascii	"9W\310\220\232s\310\300\r^\037c\016C~\024?\200\374h\333\016\036"
+	.ascii	"\f\271\374\020x\364\030(\212\240\266\346\034\306\366E\251\345"
+	.ascii	"\305\325\322\017"
+	.string	"\360\333]|!}E\005*\214 \251\374z\"\f\026\013'\027^I\374\210T\001\324\3149\255\276_\211{\274\355\b\266ml\315\n?\214R\360\264\313\002\324\236\321\226\300\211\246\253\336\356\274\242\027q[\221\013\376\341s\330Z\200s\362p\374\251\346'}\264\006\233\336\367\321\267\3416\350}\276\360:5fpi\205\330\235=\354\351\272\260\277=\255\340\bo\013\373\301\337\305j\230\325/\253IR=\216j\321\352\025\325\272\352\277\274\351j\353\311N\325\234G]\001X.m\224Lz\037\2711 vgq\307\375T\321\224\262\351HJ\247#\342\262,\ra\332\265K\341\255\312\"Dv\312\007\305\020^%\3415'\021\215?u*\233\033\034\034\362\343.\213\211(\256\240/\244\303\004\031 \007\n\007RA*J\204*\240v\216\216\336\247+C\345t\325\273\217\017\026`\226\3149\237\344\013\355\274\307\205\026\033\303y\360\254"
+	.ascii	"\347\2344\037wh>\262\240\034-\350\206\323s\253\371\374\330d9"
+	.ascii	"\270\234P\317\213g37\\\rH\226\243\371\320f3YL\227\303\351n4]"
+	.ascii	"\354V\223\331b\263\234.6s\300\270\037Z.\006\204\303\345b*C\336"
+	.ascii	"\305\205\355\205\277i\002CG\224>\353\2575\262\375Z\327\360\266"
+	.ascii	"'&P\027\245\222\206\336\007[Q\347\234\273uI\222\233\341\211\t"
+	.ascii	"\221F1\002\035\367\303+)\227X\222\360\030\b+ \300\242\t\312\254"
+	.ascii	"\003\340\200?\254(\031\262\206\254(\353\261\262\016z\341\323"
+	.ascii	"^9\262\232s\004\266\243T\002\254\333\261\275\231G\275\270\344"
+	.ascii	"\262\250\211\273\335\0166\215\314$b5p\\\351\025\254\311k#\360"
+	.ascii	"y0d\323\025APL\351\327\264#Zp\035\026\025\r;#\213\355\230`\305"
+	.ascii	"\035#A,b{5\215!C\001"
+	.text
+	.section	.gnu.lto_accSetCalibrationCycles.44.a97c749412de6111,"e",@progbits
+	.string	"(\265/\375`3"
+	.string	"}\b"
+	.string	"\266P=7@s\322\001\030\222\364D%wP}!\004\225\210\277LX\207*\303~\002aZC\326f\27716\264Eg\177sJ\244\213l\307\314\227TX\364\244\212\376'\233\354\235R+"
+	.string	"-"
+	.string	"-"
+	.string	"\004\327\2439[\346\035\310~%FC\205fw%\3748\367\307\371?\271"
+	.string	"\251$\372\003`\330]?R\211\343\206\267\235`\333\3016I\366Q\377\263\f\\`\"R\273\033\253\232U\305\026\021\333\337\330~\317~\311M\270\243B\216\273\036)\226\335N\301\013\001\217\003/\270\036\337\003\233no-4\031\342E5\202\031~\320GyJ\310\0171\006\350\235\364\350\203\256\307x\232\031\351\030\275\225\335\211\036<\331\267vw\rM\001\023\264f\027\026\364a\243\235\tj\220\310:\330<\360\344x\264\354\203U\332\241sbr\253\332\346\241\233\364d\030\205\234u\223\034\004k\025\264\312\217\246U\031\b"
+	.ascii	"\005\006\312\204\366\275\300\305\205\022\227\241\211\325hp\227"
+	.ascii	"\027\355$\003"
+	.text
+	.section	.gnu.lto_accIsCalibrationComplete.45.a97c749412de6111,"e",@progbits
+	.string	"(\265/\375`"
+	.string	""
+	.string	"\355\006"
+	.string	"bM03pk\322\001\220\024\360\002\nI\356\377P\030\344\031\016\333\001\375\255\023B\265mh\350\030\333F\377\230\007\310v\253\352\257\034=\332\344\352\253t\004K\b\2212\245~\024\013V,T\254\024\252\367(wExY\325\345\254\n\265\340^\274\034e\300\220\241\212\316\002at\023m\257 U\201\215r\354_\246\253\352;!\3161\236q\361+\334\200\311g\227|\314t\351\n\360\260\311\315\3264\251\021\366\243U\220\355\264f\372Q\300GGB\310\256g\033Y\016)da;cOlp\2201vm\302s\n\217\216\206\310\256\346T\342\330\023\363\177\361\bdc\313>\232\247\004aw\235\331\307\341\326\333&\260]`\033\"\t"
+	.ascii	"2\001#8c\216#D\250@\\\023\037#\362\022\"\207;gj\347\023"
+	.text
+	.section	.gnu.lto_performAcclerationCalibration.48.a97c749412de6111,"e",@progbits
+	.string	"(\265/\375`\002\007\r'"
+	.string	"\272D\350\016E\200\334M:\273\334\304E\347c\004\235NAh\256PP)\205\325\304\252\032\325\"6\245Rxd5\373\223\245\320zP\364\205\305\261\246]\272\214F|\213\355\230\202\374\353\330\321\264\323\001\rzC\226\220\275\211\224I\006\325"
+	.string	"\312"
+	.string	"\347"
+	.ascii	"]\356\345\367/kVVe\225bcZl\265\326\006\237{\241\374<0\376\210"
+	.ascii	"\302\340\3620\031/.=;#c\367Z\276e\306\213\333\3045\272\317\335"
+	.ascii	"\031\273\272\317\326\355\356y\367W\216\345\367,4\224\212\252"
+	.ascii	"\025\230\2151\265\026\2336B\371\271\305#\321\317\362G"
+	.string	"\364s\177\273v^\344\252\344\022\034Xan\265\326]#\331\376X\374R\376=W\222t\216\315\277\375\327\023\324a#\034V=\207`\b\217 /G\t5\334\204\374MV\2201\b\016+\316\277\216\340I\226\026\223cQ\255uh\2105B\340\033\303 S '\304\317\037\037G\246-5>\206\2065F$7D\352\350\206V\334\007s&51\341\220x&+\324Z\227\205C\036_\240\357\256\224\335u\332\245p\001}\244\214W\031\220\343xn\203\r7{\"\342\252\265R\330\223y\031\023\373\256\317}\001\005E?\247\0311T\332\016\024;\2631\266\221\254\363h\201\026\022\345\016\230\232\025\303\355\236\354cx\373\256\215B\301\027\242\240\237\005\372c_@\344\362\246\005\344\270\256\265Vu\033\331-\006\371\257]dW\307\313\304\340Y\376\004:\336\002\377\362]\322\361*\351x\223r\274\002\200x\221t\274\001\200x\217(/"
+	.ascii	"\312kDy\213r\274D\224w\210\362\nQ\336\240\034\257\256\344\005"
+	.ascii	"\242\2749\312[R^\262\344\245\224w\222\274#\311\333$/S\3367\r"
+	.ascii	" \272Iq\247\326\035q}j\233Y\306\344_>y/\3661\030\017\263mf\314"
+	.ascii	"\355\305=\230\r\017j!?}\202:\267\007\315\253L\327po*r\255\353"
+	.ascii	"\021\r\353\017\037\240&\220D+\253\354\\\223aWU\202\034\267f\224"
+	.ascii	"\354\262'Z\236\247\022\017"
+	.string	"\331\271=j\336\312\226\332vt)y\224\251\377u#0%n\362\300\271\303\324\017;{1a\333\302B\266\221\315\255M\006\335k\334\340K}\243\351K\375=`kV\f\367\261\326Z\251\203/5\203\276\0205\261\253\255\240\023\255\343d -\303\351h(\327|\034\bpu\365\350\347\002\256\266\317yZ\257\303\007\276\360\003\375\244M\0361\343\245E\266\273\254 \316\222!\245\301\0211\304\365\206<b\346\3466\273\315\223\020\027\033!\236\261g\377jM7\367\270\025D[2\003\013\342jD$\245\325Z'\240y\232\021$J\224\240\237\335\006\222\224\275\271y\354\212\355\314Sy\366\016TR1\240F*\026R\276\020)x.\244<\234\230\262\260bE\317g\264\274\007S=)\027P\276\250\025Q<\036\324\216\312\327\243\232\212\242\332MIA\261\330\361|T\273\007\t\266\327\"\312\267s\321\353\371v\272\"\360\257]dK"
+	.string	"i\003\354\340*u\220\216\213;\217&\265R\237\211I=\211r\274r\013x\367\007\345'\205/\334\177\275\224s\306\366\306\026\354\252\345\254O\341\036<\3126\340\022\365\342\035N;\341[\366g\205u\374\260\354\204\317\345\034\277*\277\257}\027\r\372\371-\347*9\330\266\256\264\t\350\033,\034\321\204x\220Z@\037\353O\200>j\244&\365\\5\261\3006x\027\333\275\300X\030\036\226\306W\001\372bjY"
+	.ascii	"\364Q\223z\214\032@Q\0331\220\2558\310\237EoDM\\\343\206\232"
+	.ascii	"H\317\205z\250-\200\212\250a4\347\224ShFHRPP\220\264\006\200"
+	.ascii	"\002\221\251\262\036\021\200\261#\247H\013T\231\266\003cK\315"
+	.ascii	"\376\003\240j\266\013+\361\2517\333\333MHqZ\203\223p\033!\302"
+	.ascii	"\276\327vr\005\352w\264\005a5~\n\232\265\032\237\225\303L\177"
+	.ascii	"\344\334.\340dak\265x\235 tm\377`\310\227\201C\200K|\033\301"
+	.ascii	"B\264(\351\006S\006\261\343P3\251\234\277F\351\326p\232\013\271"
+	.ascii	"\325^e\214\264\032\251s\b\007\273;F\225\221\020\326G!\226!\326"
+	.ascii	"\016P\301\022\021\356\264\t\316\340S\003\304p\344J\363\3416G"
+	.ascii	"\334\212ti\331!\303\310\262\371W\"\366\341\254\346\004\202\206"
+	.ascii	"\372\033L\332p\251'\214A\032\3771A\254Y\365\240\317^\030c\362"
+	.ascii	"\f<\326-\212\007\221\300\337\211\272Q\006\310\204%$\270\033_"
+	.ascii	"\265/\216\214M\013\375\023\\\316m\214h\177I\210\253iY\355\325"
+	.ascii	"\354C\347-\364\217\366\355\006&\303NbGu\rJb\207\324\354\352\002"
+	.ascii	"&p\0218\0374O_>\013\\\032f\224\371\235\316\374\001"
+	.text
+	.section	.gnu.lto_performInflightAccelerationCalibration.49.a97c749412de6111,"e",@progbits
+	.string	"(\265/\375`\203\fM:"
+	.ascii	"\252]\344\024EP^R\007\363\235h\230\241J\235\314\314!\003k\033"
+	.ascii	"\031\223\231\226c$r\004\236A\357\003erd\343~\244\264432 \255"
+	.ascii	"\276w8\272\035G\220+\206\304\021\231\303\026\375\345\367?J3\222"
+	.ascii	"\266\367\336[\312\224\002+\0011\001@\001C\241v\341\253=\216\265"
+	.ascii	"\303\261\3667\326\356\306\332\333X\373\206\265\353W\373W\275"
+	.ascii	"\234@A8[t\346Yl\360\316\274\347Z\333\276\356]\335\352\255[w\252"
+	.ascii	"\177\225\356\253\310_\347yI`\324\231\354\003\340\3364\301\273"
+	.ascii	"N\025\277\233\324\376\224\237\223\361T/\202c\203N\347y&\276\353"
+	.ascii	".\303\235\370\256&\272\373k\367\237>\234\374q3\210|f0*=\356\346"
+	.ascii	"\231\272\300\241\342w\235\372B\357\273\361\003\275\357\272\354"
+	.ascii	"\016\370\324\350\f#\331\022VEp\236\347\247]\304\367\267\324\367"
+	.ascii	"X\313\337c,\022\207\302\030~\335c\273\265\354\017K\t\235d_\337"
+	.ascii	"\003}c\213 \260\313\234\347\033\203\266BbI\234@t\021\226:+3{"
+	.ascii	"\242\322Y\331\217\037\266\017h\b\232=\337\330\217\266X',\215"
+	.ascii	"\017-l}z\264\r\2524t\fK\251\225=\037\346\361oX\265\251\335_>"
+	.ascii	"\377\3107f\326&\315\363\374r\257\304d,\210ns\374n\021@\307\344"
+	.ascii	"\350!\003k\205\316\020i\363r\257m\2201\265\206\245\346yv\355"
+	.ascii	"$+{\367y\367Wr\367\013\356\305cnmT\326\200\351:-\274\343\300"
+	.ascii	"\t\224S\365\200\310\247\273\272\2017\324\016l\366\335l\220H\327"
+	.ascii	"5VF\321W\323\301[\314h\335d\370?\344\323E\271kx?\253>\331\254"
+	.ascii	"\303\204\350\214\367\335wC5\261\3228w\243\341\3732"
+	.string	"\277gF\277\347\275\357\272\331v\217\021\263\340\301|i\267Q\355\215\324\272\267\027\344\320\343}^\bw\341A\277\323C\2363\316R\017*x+\022Bt\236g\t\356 \276K\210x\236\347\250\273\030W\f\256l+\336w\367\206\260f\375-\317e\205\b\022$\336w\365&z\001\314\272\036\r1%{\247\271\203O\276\277KPQ\003\246\353\270\377\225\307\222\364gs\254,\375\316\254\367\335\337\024\240\004B\341\236K=\350Ne\352\2356\317\363\227o4\367\251\217\373\207\372\272w\247X{SQ{\201W;SQ\373\222P\273\222P{R\254\035I\250\235\200P\373Q\254\335\b\326>@\250]\200P{\021Q;\321\253}\350\325\036 \326.\024k\017\212\265\003\305\332\001\304\332\177`\355>\257\366#\254\275G\250\3358\324^\034j'\016\265\007\325j6\016h\267%\321lG\200\266\361\257*\005\260\327\242Z\r\031\3534"
+	.ascii	"\333\370W\227\265\376l\"\310\246\253>\033q\205\024\305\243\205"
+	.ascii	" c\035\344gGX\263\002\361\331\360_\235\364\211@\023_F\362\272"
+	.ascii	"\313m\362\022\375No\001GH6\020l\177\371?\233\240\230\242A\247"
+	.ascii	"\330\245\326\353:\207\326\241%?\221\335\364;e\267\"to\330\"\254"
+	.ascii	"\230\225\341'\337\343Vj\262\343~\271?\2406\230}\276p\2479\321"
+	.ascii	"\b<\265]#\307\004\357\264m\270\323\326j\337\306;\315iO\355w\002"
+	.ascii	"\370\327\2042\221/\016d\323U\337\b\021\337\225\270BZ\020\305"
+	.ascii	"j\033=\033\366\313#}\332\271\273f\252\341vC\3270YJPT7a?<\202"
+	.ascii	"\202\306\rFu\214j\346;\343\024\267q\177\263\fq\017w\021\312\324"
+	.ascii	"_n\327$K\365,K9\272\346\371A\031N\226\233\232z\337%\356\2465"
+	.ascii	"\253p\017\267v\323\f\274C\025\333\021\356\355w'\2537\234\340"
+	.ascii	"\231|\226J\210\316\013Z\200qA\277\363\302\373.\274\203\216 \366"
+	.ascii	"\227U\275\032\357g\371x\377\231\234x\177\365\017\370\321\221"
+	.ascii	"nw\247\371\377\317\363<\0377\232\023\005^Z/\222\255W\n-\345\207"
+	.ascii	"\023X,\2648\230\340\232\332\332\352R\3768\026\003\256.-\026I"
+	.ascii	"e\326V\026\026V\362\311K\331\345\305\225\345\365\304\245\225"
+	.ascii	"L\361\204\245\364zb\260\344]*\262\224O,\272\272\224OD\352\362"
+	.ascii	"7\232\2170\263\267\334\314\036(\355.\007\221\207\350w\372\313"
+	.ascii	"}\334'\347.\033\310\334_\256\321\374\317y\225\366\353\213\261"
+	.ascii	"\313\242\367\347<\203\346Cz\324\317\271\006}\306\312\375\347"
+	.ascii	"^G\271\021\b\235b\233\266\2312d\234q\n\354\246\375ay\230\366"
+	.ascii	"\322.\260]<M%L=HD\217IN\220\323\264\030\271HT\030\246=a-Ni/m"
+	.ascii	"\027O\322V\372\242\227\224E\332yx\0046\022\226?\332\004\254]"
+	.ascii	"\216\266\360\017Oj5\332vH$.\030\256\216\004l\243\335\222\t\313"
+	.ascii	"\243e\300>Z{:(\332\002\266\233\327\214r\205*\266R\2647L\357@"
+	.ascii	"\341\352\210U\2737,\036\334[\324\270\343\211v\t\2725\331\215"
+	.ascii	"ho\036\\\262\305\241=78\370\3117\300\036\332\257\345\002lXo\213"
+	.ascii	"\364\371D\241\r7uS\245\243 \277\356*\265\252\020}\023\332PzZ"
+	.ascii	"\244A\033\n\322@T?q\373t\023\344\327E5\023+\nW\275$hC\005\201"
+	.ascii	"\f\250q(\311\230SjF$HAR\220\2441a\005\304\020iU\345\001\021\020"
+	.ascii	"\255c\214\021\215(u\206\315\203\240\213\322)\016\264\276Vyh\246"
+	.ascii	"\031;\275\236`\334\3542h1\326\367\021y2)\302\260\333cZ~$\312"
+	.ascii	"\371T,\256\303\031I\262\210:\272e\030V\377W\017X\303\231o5\357"
+	.ascii	"\232i\221\233\177\032\006U\016\354\202\254\\R\317\351\213\273"
+	.ascii	"\212p3\360\206\241\325b@ \376\2374\311%\204l\377\020\311\020"
+	.ascii	"9\376\003T>m\202\360x<\203\347\247~\260\2660\334\227aF}\177\312"
+	.ascii	"[f\355\236eP?X\324z\263\361\203\200\332%\340\375>\017\203\003"
+	.ascii	"\2303\031A"
+	.string	"_\311\002\002f\273\313\223\3436\210\t\346\365\313\037\265A<\221Y\234\022\362\242\250\032\021\264\362=\306\367s\373(\247H\243\377\254\360\217\300.jJQ\317}O\314C 0M6\032D\t\354\013\302\224@\035L\356M[\367I~\362\"K\037\"\016\265\210\232B.taE\214\rx\3005\230i\017\375\"\347\3200E\375\374-q\317\360\026\245\242\005\017\003\257M\244\252,Xx\017i\026#'\226\350\034\2347\033\304\216[\226\020\320\362T\352R\332]\201\f\3259\031\257\314\275\271\337\025\213\213O<&`7\030X\016\302:\343C|J\2320\262\257\242\317\350\264\021l\242\340\232\212\222\353\246\264\241E\207=\357t\220p\362\315\3501\277Db\273\2340]\245\201qE\231\007\230<'\006\270,{\340\303\200\233\227\312\264.&UC\324O[\356z$N\343\037\350\265\334k\002:\371\036#1\375'\367\347\321u"
+	.ascii	"y\314\313\251\206-\200U\f=\214\231\230\331\030d$P\223\2155\215"
+	.ascii	"\262\027-%\231\255\331\253P\311C\231\270^M\017d\207\266\354\207"
+	.ascii	"\220~3\374[\216S\207\320H\0354F\315\030/\221\212\227\242L\022"
+	.ascii	"m \351\023\033\354\034\2201\371\030\276S\325O!i5"
+	.text
+	.section	.gnu.lto_accUpdate.51.a97c749412de6111,"e",@progbits
+	.string	"(\265/\375`*\001\305\r"
+	.string	"\306\331]D\020q\233\016<\243|\373\bv\0030\224\343\001B#\366\213\t\264\266b\233\244\016\034\212M\352\340\376\377\353X\203\366[M\223\374T{j\327@\003\021\262\326\214\207\003L\bRP\b\345\033}\374\177k{\313\224\002H"
+	.string	"H"
+	.string	"L"
+	.string	"U\201\207X\257\344\005X\257\354\3319\036\246\354a^N.\251\335\275\"\t\317\363\244w\031\325\363?\300\321\245\306\344Q\0368\231a\302\001K2\244\206\b\034o\271r"
+	.string	"M\252\231\221\335\265~\240\207\273\272m\007\266I\354\177\001\377J\352\303\006G\024\373,\177\346\250?J\265F\3657\026\030\246td\200\331\355\020\303ciT2N\330>\307\266\206_\361\316\202\341 \273(=\030h^9\324\\\355\253\270\212w\224\006ovC\244\210\261\033\"p\002\315\003\243\335\335\350\013\226F\b-7L\272\303\035\375\212\303\220\320I\331%\375{\301\021p\0215*"
+	.string	"a\212#\333\332_(\f\260Ao\301\001\260\261\273\013\\\316\302\202o\342\225;\221\376\023Y\257\036K\240P\234\250\240H\032c\207%\215#\354\035H\233%\023\260\220F\022ak\360\371p\023\244{\220\201\264\222\320\226\315)\302:\306D6N\013yf\366\3110\314su\223\353\266\254\2736\315\003\272\260\331]\"\006\314U\310\346\025\342\270yqB\322\351#\244X:\311"
+	.string	"\232\211\266\007\323\177\2261\031"
+	.ascii	"2\003\303\341\327X\270jI\317\024&\324\2550\317c!b\232\030 8`"
+	.ascii	"\b[\341z\271\304\306j\343\r\256\033\373\3215\240\030F\003\341"
+	.ascii	"75\005\356\005SS\202;\322\322\036\rL\355\001"
+	.text
+	.section	.gnu.lto_accGetAccumulationAverage.52.a97c749412de6111,"e",@progbits
+	.string	"(\265/\375`\375\002m\027"
+	.string	"\026.\233F\260\032Q:\270\307\360\037\232\2018\035AU\035M\341\321T<n\344f\353l\304\004\356~\303\240[\206\265\332\277\332\233\332k\003K\353~\232\235\235\235\235\361\345\234\320\336\253i\266@\371PZ\331\352Q\311'{K\231R\211"
+	.string	"}"
+	.string	"\210"
+	.ascii	"j?\307u\334\034\310D7\315\311CDd\3160\202)\200\227\016\177\372"
+	.ascii	".\301\017\370.+X\2701\354!.\207@.\005\216\220\2269\303\324\312"
+	.ascii	"\360>\206w\204-\354\243O\306\005\025\346\333b\037\261\3707\222"
+	.ascii	"\tz\004\272\361\244L\001bcq\031\005\3149cl&\342\2049\347wW\024"
+	.ascii	"\266\231F\230\234\316\027\3249\030\017\3548\321\211\261\321b"
+	.ascii	"\203(0\252<\350\tl\250\270\251\216d\346\234\326\232m\305M\272"
+	.ascii	"m\027\2667\330\033 \367\221\357\362\373\240?(\262\203\262\243"
+	.ascii	"\343&\323\236\035\306t{\354\177\311\026 ,^\036\373t\240\337d"
+	.ascii	"u\351B7\314u7)\252AU\217\244\372\223j\031\325\321\352\215j]\365"
+	.ascii	"\013\030P2\223\262\313\345\354\224p\346\364\272L(\262\250\306"
+	.ascii	"\205~\335\325~\2178\207f\204Q\033\312\361\363\320\337\271\344"
+	.ascii	"\3578\217"
+	.string	"\233\353\214\344s\305\374\t\\\256\205\2259'\352\322\031\300K\004Q\355\033\273d[\003\247-\240;\241\204\2663\343-0b\236\003\\\321q\334\210~\264\200\353\023\371`\036\003\234\217o\"/\265+\262\325\005\231|k\332\321\236v#\336M>\271\337\236fc\246=\223Vn\024\302\371\362\215k\300\013\315\212L{4\037b\0368\347\274\340\007\271\220\032\337\347\322-\020 \276K\335\357\256A\305m\310\226\"\231\366v\347\234\261\335\036\377\237sNpy\214\372\227\203\356I\t\345b\177\350?\214\304\367\361\313G\364\265K\007\257\031\022\252\310\352\240r\261F`\240\021Q#b\265R\r\360J\202Mk&\204\312\305\242a\255V\252\324\313\325z\331\260^)\233\031UMj\345z\245$(p\353\003\313\225\n\321j\271R%\333\016\347\343\267`\227\334\013\037<\371\303\276\222Kk\031\331\316F=N\302\345f\340\360\024u\030"
+	.ascii	"jZ{\306\203\276\266\0337v\177\333\223\344A\227-n\274\237,\227"
+	.ascii	"\333\343\022\215=\255\244\001\242NZ\024\021NZ\215\241\243RB\271"
+	.ascii	"\334a\3541\032\302I\0335 `\2021eF\017=\n\210\031\326\252p\323"
+	.ascii	"\r\252\f\261\330+\350ji\270\355\355Z\326F\212\006\256wKr>\031"
+	.ascii	"\330\273\301\256D\354\326\277\327\216\254Z\260\367\316\305\036"
+	.ascii	"\021\257\204pD\n\306\030\335\310jN.q\227p\366B\3670\275\343\330"
+	.ascii	"\t\324\205Kt\233\232\265\211\256\315A \231680c+#\274\032\006"
+	.ascii	",\276\273t\3230\367b\006\337\300f\036\004X\352\271\366Z\232\246"
+	.ascii	"\201-("
+	.text
+	.section	.gnu.lto_setAccelerationTrims.53.a97c749412de6111,"e",@progbits
+	.string	"(\265/\375`4"
+	.string	"U\b"
+	.string	"&\220;7Po\322\001\240\\x\224j\321\313\241\320\220\222\321\"\330\032\322 5\255B\226[C\255\373\261\367ps\315H\342"
+	.string	"\221\251\313\250\242\255\252\224\221BT\370\004\221M\366N)*"
+	.string	"-"
+	.string	"+"
+	.string	"\217\346l\230w\034{"
+	.string	"\022B\201\"\263\273\022n\234\373\343\374\227<\200T\022\375\0010\354\256\037\251tq\303\333N\260\335`\373\024\247\377U\002\036/\245W\244\354Z\244f\026\025W>4\266\377\354\217\234\204\373)\364\201]\223\213\312n\247\340\205\353\321\335\013\254\307\353\004V\320\344\253%\0065\202\023~\3207\371I\310\357\260\004\350\235\364\350\203\254\307\007\f\026\221\214\321K\331\235\350A\r\373\325\356\256\241\311~Zu\230\234\332\331(\307\300\331\3063\267\017F5\b-\3130Y\351\254\036\255J\317\206udF\253\334 xFhT~\346\244R\323\355\253\r\t"
+	.ascii	"0\223\241\214i\3413l\234-\007C.\3016\253)\340./\332I\006"
+	.text
+	.section	.gnu.lto_accInitFilters.54.a97c749412de6111,"e",@progbits
+	.string	"(\265/\375`\r\001\365\f"
+	.string	"\206\331YB\020\221\232\016\030N\330\n)\377"
+	.string	"pi\276\304\352\257v\374\302\251\222\203a\3573\225Y\251+\304\254\301Zk^\337y\b\314htJ\223\022\001"
+	.string	"P\004\205\n\364H-\250@\352tr\324'K\366\2262\245D"
+	.string	"F"
+	.string	"G"
+	.ascii	"\037 =\302\013\220\036\377a\316\246\361oe\t\260\270X@\201cw)"
+	.ascii	"\005\301%w\250\311\371\032"
+	.string	"\022\217\316\343\034N\033\256\3373\203\367\201 \273\373\226'\310\363djHv\327\331y(w\274\355\004\266\017\330\357\004z\021)0r\274tr\306\376<\251!\373\271\273\034\253\212\375\321\r3\255O\247\007\200\021\"\357\240\033\273\032fv\254Lt\021\342\243\333/\341\177w\371\013\367\221_|Q\366\030VXbj\354n\310\243\rL\217 \001\273\273\252![\222*\003\230\031\237\324a\273:\013k\332\335\021?\346+\256\006\030&=\252\"H\221A\"\325Oq\025\016|\221K\262\254Eg\303\021~b\233v?#\276\211\303H\360E\217\236p\222\357\036\375\023\3511\003\033F\241\202\266D6\031fRi\327\203\313\262*j\323\262msm\324\006\253J(K\333(\221\002\316 \\\032e\222e\032\365\361u\256*-\377\205\030\036d:\352\201\032\362\277\237C\205\016\0372\344PAv\200\264\025,\310wV\345\374\001\024"
+	.string	"2\003\006:\006\023\003\211i\373Bf\017\\3\034\f<E\"Th\n\374>\265\206L%\240\270\f\324\005\263\254\262\2744\021\234{"
+	.ascii	"\227\243\006\361\207R\006"
+	.text
+	.section	.gnu.lto_accZero_saved.2.71.a97c749412de6111,"e",@progbits
+	.string	"(\265/\375 )I\001"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\031\001"
+	.string	"\005\001\006\025\001\002?\202\210\200\030\1773\273\0014\273\001\274\001\273\001"
+	.text
+	.section	.gnu.lto_angleTrim_saved.1.72.a97c749412de6111,"e",@progbits
+	.string	"(\265/\375 *=\001"
+	.string	"\370\035"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\031\001"
+	.string	"\005\001?\202\210\200\020\1773\273\0014\273\b}{\274\001"
+	.string	"\002"
+	.string	"_D\030"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_accDetect.part.0.84.a97c749412de6111,"e",@progbits
+	.string	"(\265/\375`\253\001\035\020"
+	.string	"\346]jH\360\2208\035x\276\370T\340\3728\361\234(0pn"
+	.string	"L\350\323\214\303r\177\266!\321E\336\300BW\363Y\203\0206\001\212Q\354E\354\267D\206\330\017Li\325M\367\257\f\216\353[\340<\362\375\275\264\230\016m\262wJ\001S"
+	.string	"X"
+	.string	"T"
+	.ascii	"5{\210"
+	.string	"\366\352\2538y\026\306q\005\247\034\273;\362\352\005\333\353W\370\004eD\331\366\t\n\351\321K\231\323S\261\r+\036\273%\367JM|t:\263\221?M0\244\323\277\236 E+\205\343\202\371\360I\340\031\200\224\335\365\006\342\256\267\355\3006\005{\n\b6\177\271C3~\306\366\350\032_#\232*[\nAg\215\310\037\273%r`\021\266\327\326xVH\204r\330\222\n\226M\3730\276\"\317\ni\250\217\227T\254\344\325\017\312\355!\032\351\317\234\306\235W\267xI\336\205h#\241\266\031\253\0169vK\222W3\330^E^@{,\363&O\033\"nh\240$\203\374\200f\273\3444@\0032\273\333\300\2779\f\203\177\342\325b\313\274\251E{\375\353#;X.8.\035\245\031\233Te\232=[\032c{\372\225\3444`\304\356)\326cI\324\032(n\363\267~\327\251}\373/F?\306e<\2378\001\224"
+	.string	"\222\341[\241_\330\205V\302N\305\363\272\216(\004}a\265g\362\001=\240.\374,|\236\327qb\b\212\237O\344>\236\216\205\363B\2213A`\360\302\027r \020\f\271\316\263\2451\376\353\020r^Z7\363\037i\247\036\250SJ\324\205R\225\355"
+	.string	"s\336\243\331\025\002# @B\004\235\331\006\306d\361dc\f\221\b;\002tOi\257\332"
+	.ascii	"@\236G\230c\220\337\002\356\203\371\022!\035L?\2244\016\334s"
+	.ascii	"\271{\372\b\256'\247/\t\333n\333<K\036\370\373H-\261/\344\013"
+	.ascii	"/\205+\026\273X\013\253\021T\303KLQx\377\265e\f"
+	.text
+	.section	.gnu.lto_accInit.part.0.89.a97c749412de6111,"e",@progbits
+	.string	"(\265/\375`w\006\275#"
+	.string	"\226>\330D\200\236M:C\tV\224\271=\2379\\D\007\330\337\303\2270\224*\217\250\260}@R\035g\264\255\326\343\210Rn\243\340J\204fX\005\305\332\214\361-!F\301\r\025\205\004+\320>\f\262\215\020\262\311\336)\005\276"
+	.string	"\301"
+	.string	"\306"
+	.string	"\032\230\320\261\312\332]\262\372\\N6i\337\260\311\327\371\237\323\263\350\300\337NI\231N\373Z\337\272\361,:\323v\2130\t\263\373\223\360\352\n\343\253\355\006\302W\360\004\302W\373Xl\341\202\223\224\205\0137\\\376\207\305\343J~\344\320b\266\373\273\275R$\246\007\177\3678\313\013\2215\332(\206\025\244\023@\351\213EO\027\232BN.(\322#\310k\240-\310\002(R@&\r\024@\341+\307\034\305\242#=\252.V=\374\372\0026R?@\333\214\232\352\315:}ST\007\317\365\006Ti\240\336xMQ\235B\201\266\335\255M\361\346\034p"
+	.string	"b\321\356\372\273!\367\320m\323\261\r\303\016\007\004&\211\360\350\223m\024\027K\201\346\314i\r\373\2615\367F\241\255\342d\214\206\354\025\017\303\ta\355.\2061\007;\362\227\274\032)i\336\367\352'\205\257\347\272\003-`f{v\363l\322+S"
+	.string	"\237\273\373dj\304\3664IN\327h\265\351Q\244M\207\342t\035\247Aq\232\376\367\317p\372\b\210\322\004\260\332\345q\026h\211T1M\356\365\231\340\207\325C\n\214\223g\024A\351\300\001z\231\341\222e\266\274\037\221\275\374K\r\317\240:p\354\212\334\240\202\364\250\3707\372\\\336\345\177\371^N\266\361\272\030\314\306\373\355\224\t\261;Yf\273K\364j\017#\227H6fI \253,JU\307\212k\274\313\001O\035$\300\331\335\fgs?\200\b\021\202\336\347\243\322\220\276wg7\317\004UJ\253\002\244\033\377\200\364_o"
+	.ascii	"\366\306\317\026\025\351Uh\024R\312\242K\016o\376\261\317\347"
+	.ascii	"}\214\374%\0261bD\370J)\245r\343\247\252\322+<\337\243\207\314"
+	.ascii	"\n\233\3170@k@\021\316u\241M\342wtvhTc'\273\355i\n2\375ww)\275"
+	.ascii	"\262]\307e\225L\031\272gN\325\354\023\307eU\254\314\377\270\361"
+	.ascii	"\337\270\254\216\t\272.$\333&Nv\027\302\333\330.\253j\252v\237"
+	.ascii	"ne\237\215m'\273l\304Z\2512O\337Fi9Y\"\013\341u\322\0316\266"
+	.ascii	"\2467\007\371\300|\327\327\2348\200\265\273\273O\rNA\032\032"
+	.ascii	"n\321\244d\003\007\276\300\321\310!\321X\002\221\264\244\364"
+	.ascii	"\"\006\f\\\t\246\234.\251\200\217&,1)\311\300\345\220^ \035\035"
+	.ascii	"\341nM9\246\246%\244\246\333\222\022\016\306\355(\327t\233\300"
+	.ascii	"\300L1\220r7"
+	.string	"\031LL\271\033\371\271\324\210\317u\017s\306\266\200!\3772$I\352\242\035\205\022\"k\324.\237\314\035e\224\0023\n74}2\306\324\370\362\354\346Y\215^\371e\225\260\346r\312\314QV\031wy\030<q\314^y\245\304Rj\225Z\341k\215\236\353\017\310\352\\\331\242\321+\223ID\032\255IB\242\2134J\302E:\217\320\203c\204\213\224F/E\254O\317\nj\236\3316A\032\322\221\332\0338\314\373l\353\315\235\213!8>\3331f\200\201\250\201$\345\030R\204\210\214\210\310\214\246M\007p\002\031\243*z\022\340\245Eg\r\345\250\302\312\376\261o\tp,\017\021o\332\366\247r8\276X\374\300vD\246\326\315?\222\321r\254\222\324\234\265\032\251\340\020\306\367A\3002gU\240\377v\250\351S\035R\215S\353\354\261\b\255\231\215\226fC\367\345{S_h\016ZgN\340C\246Fc\2307\354\366"
+	.ascii	"\362\264N\033\326\345\242\316\206:f!\360\030R\270x\330\261n\221"
+	.ascii	"\366\350y_\306z\024K\232\225\235j\327\304`~ASN\366\341E\275v"
+	.ascii	"5\003\031LeYe\275k7,\013Y\344\317\314\341<\207'\333\211o\355"
+	.ascii	":pF\205\020\203\207\256\271\342\353\300/\312y\306Q\2433\226{"
+	.ascii	"<&\024B\357\204\250\007\301\365\303rLY\026\222\365M\370\306\007"
+	.ascii	"IF-\367q\376qV\253\272\372X7(\332\337\221\320\264]0LdWkR\274"
+	.ascii	"t\343\2556\201\346\016 \353\236\245\311\261\345\360 40\263D\360"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_accUpdate.part.0.91.a97c749412de6111,"e",@progbits
+	.string	"(\265/\375`\261\f\275<"
+	.ascii	"\232fP\026BP\346Q\007\027b\"\361\311\237N\250\004Nh\334\006\305"
+	.ascii	"\370\337V\352(>\267\fG\211\223\246\265\341/\356\333?\020\217"
+	.ascii	"\363F4MD\0231\002\003K'(\346+r\257\300\033\331\232%\273\311\336"
+	.ascii	"[\246\224\002K\001@\001R\001Jh\026\013k\323s-WX\353\026\215s"
+	.ascii	"\227s6\321\232Y\343q6\374\255\361\024Dar\3166\272=\215\303u\377"
+	.ascii	"\032\207\277\365\272\206\307T\3139\377p\254\355f\264\332\335"
+	.ascii	"\372\327\335\216F\313\333t<\210\234$\203\362\2651\233\237y\275"
+	.ascii	"MG\2739Cqvh}mR\177\375\357P-_\343\261\004\315ca\375\337\355O"
+	.ascii	"'\363\372\032\017/\346l\226\327&gh\224\257-\241\365\265\241\256"
+	.ascii	"\304\372\332:\022\353k\267\217\351n\255\260\356\267\033\220C"
+	.ascii	"\233\331\243o`mx9\347)_\361\024\326\327\330U\250wQ}\375\250H"
+	.ascii	"\034\n\203\300\237\317m{\354\252\342Gz\333\271\374\210\212\032"
+	.ascii	"\241\371E)chN\354q\220\343j\232\2174(ch>l\342\302&\314\017:A"
+	.ascii	"\031c\342@\365\301\235\334!\317\023\306DU\032\202e\351nK\376"
+	.ascii	"\247\022#\320!y_\217\203\224\261$\356&"
+	.string	"\361\226\316\235\362\204)Q\233\334\334iKX\331\367Tb\316Y(\006\246F\370\037b]\317\372\322\310|\375\245\230\021W\325\007\3149E\204b^\252\022\236(~~b\312\307.\365\007y\321\245\030\231\377\221#\3658\344\234\333\223U\274\223\274\333\303\272;E\367\017\032\376\247\203\207\017\037X_\227\342\226\203\222?\335\341v!|\016C\267\b\3573\302\343Hx\235\tw\253\363\225\017\306>\207&\365\244\333\233\036*>k\325O\260\216o\260\365Q\276\242n\327\343{N\264[\351\024*T\260\276:\016C\246\216\371,\3039g.\214\317\032\311v\257\360;H`3\347l\241\275\216\333a\321n\305\327n\341\342}\351\202\365\325\335\374\325\220Qc\252\025J\376\364\361Yc$\317\330\254\273\201\373\315\300\375^\340~+x\022~'\020~#p\277\235\334\357\246\366\233\311\375>\340~\033p\277\013\264\337\004\334\357\001\356\267"
+	.ascii	"\367{\251\375\016\340~\003\030~+\261\337I\016uG\362}"
+	.string	"\037\t\277\213\301ob\360{(t\277\203\300o\240\373\375\373}\373\334o\327\347\274[\337w\217u\277\327\366[m\277\261\313y\177\357\3337\250i@\206\314\234\207L\031e'\2534\213\313\271\317\271\307\3619=\241\202V#\325\\\346\205\3750\202\252\341e%\024jB\005\033\215\\\362\302vu\352\324\360r\206N\371\352h\332\341\310\211\343y,{\017\2744\037n\350\346\340\242v\356\242\376\326.\225\323\352\246J\314\025\274\360HD^#@;v\356`\007\342\263\366E~Td[T\206\220\236';\362>\217\260\307\371;\263\2501\237e\024\276\210\375\355\213\274J\332\234\223\276$b\0040\3662y\233\274/\233\210\213~\005\254\221O\335\212\035b\"\356\007+\353\372\351\223\027\362FY\320M\342\203\230xz C\007o\0169\311\374\360Y\377\250\270B\274Ri\241\274m\361Ky_\213\205\330\273\344M\203x\331\321"
+	.ascii	"\357\303\230\364=\2008\210\261\241\257\273\250\377My\321X_\002"
+	.ascii	"q\223\022s\365\203w\261\017w\277W\336,\357\313\037n\362\302\\"
+	.ascii	"\335\257\274zj.\277\353M\3636_\373\271>\371ry\275\274`\300\260"
+	.ascii	"\276"
+	.string	"\372\260/\311\222?\305\362iG\237\232\215\214NW\227\347b\247s\007`\205\234R\267\2419\347\026\233\265\277N\266\207_\260\331%rE\257\363\035\363>\337'\353k\017\273\233'8\022\310Y\326\303g\355\332\255,\306v\017\345\217\177D\371c?\304f\207]\3159g\026\202?f\261/\311\213~1\273~\332+F\324Q\245\272w\315\017\031\205MC\256\342\025\343\271\257;B!\242\006\215P \310\004\323\235\212\177S\376$\222\256\370\f\003\n\241\001C\273\237\310\253\034T*2\205\325\214+\0245\260\254\216G\033UA\344\214\253#\212\030U5\256J\300\3002\312\220\221u,v\225\024V\326U\r\252\243\225\f\253\252*\252)\3441\013\211e\205\234\302\272\242\2321UuDNI!\350,\032V\307\251\032YY\307\251w\317\330\2549$q\327\021\261\001\306vC(\177z*>\341\006\030\211\255G\224\001\226k\263"
+	.string	"+\300\f\260\232\367\305\354b\323Q\013\3158\243T\335\232\005\330\002\232\364\313\303u\264\355\177\3734\306-C\257\022%\254\257\n\260\313\3615\254\254\315IL\200\321@p\0048\001\366/f\027\333\237\351\271-D\355\246\335\260\276\"\300rg\2340\237eN\270\ft\255\t\037\300NL\270\351\251\306\364`^\2143\314{\317\261\276\036\300\275:q\f`/]\270\024\300\003\260\001\002\270@\232\026\002Q\217\345\212\225\001\270W\007\211T"
+	.string	"\246\202f\0046\2270"
+	.string	","
+	.string	"\373\227\226"
+	.string	"x\t?\235\257;)[\211\244\2329+\267\026\375\331V\036\203\272\234\225\026\314PlM\333\255p\261\276\006\300RhR\b\017\245\243C\270'F`\323\t"
+	.ascii	"\354p\376M\236~\230Oi\362\231<\223\252\353\365\362b}U\302*\246"
+	.ascii	"\316\262\344O\207`\210\204\370\254\221lR\206W\375\375\301v\277"
+	.ascii	"A\336!\357\313$\314T\350N\200\371\250a,\005\031S\210HDD\222$"
+	.ascii	")t\200\002\221\0313r\003\022`U5\207\225s\2100((1\354\327\030"
+	.ascii	"\333I9P\300\025,\021WC\021\n+Hy\032\023]\b\336P\275\031\230\326"
+	.ascii	"\370\200\213\257u\"\360\022\340\265\221\3452o#B\364\f\016-\225"
+	.ascii	"t<\033\016\352BC)\255^\304\006\b\310F\252\230RH\364,-%\312\230"
+	.ascii	"e\234-\325\214\232\017\345\034\006\317\304gQM$6\333\033\253k"
+	.ascii	"\316\213\243\302j\255\343\367\332\305\035|\227>_\21791B\202t"
+	.ascii	"\234.\3732\262!:(-\035\246\002\350\347\f\037OG,\206\321\200t"
+	.ascii	"\203\246%\024\34275sQ>\037\201\031\316\344+\201\017\231\223U"
+	.ascii	"[%\3238\376t\363\310|\351j\b\203\261N\030\265+\362\243O\352\027"
+	.ascii	"\373+\302B\212G\246\240\315\235\271:\\\241\311$\005\022\353\367"
+	.ascii	"<\213\306t{\303\341\256\016\3477\007V\"\227\370X\006z\362L\274"
+	.ascii	"\260O]\235\003*\021\361\025\344\244\375\211r\352\276!@Uz)\216"
+	.ascii	"\032\331\f\265\276\300\210\254jA6Jd`\221\303\347\237'\030\215"
+	.ascii	"\361-\r\307\235\326w\212\222dp4\f(\020?/\335\2338\347\241\347"
+	.ascii	"\b\036\022{\266\2430\217Y\313\210\r\261F\346M\231\342P\206\215"
+	.ascii	"\360xA\016\234\271\021\340\026\003\340\330\020ez\261Ln\331D\026"
+	.ascii	"\307AG9\025\031\265\223\031\031\253n\372\221\360\326\313\253"
+	.ascii	"\344G\235\374\317\365\323o]\231z?Vm\320\352s\247L9[$\007O\203"
+	.ascii	"$\006\270\271\341w\036\332\003H\037}v\366\017F\004m\001\227\257"
+	.ascii	"O\0204AX5\315!\346\007\346\023:C\303!\313\246Q\322\232\313\314"
+	.ascii	"[34\301\030\016Y\363\t\253\r0\302\253\355\257\321\262z\017\306"
+	.ascii	"5\244Wq\301\264b\310\335\t\225,\177\223V\336\343\013\313\343"
+	.ascii	"\217\374`\246\313\352\203\344~:\357&K`*"
+	.text
+	.section	.gnu.lto_accGetAccumulationAverage.part.0.92.a97c749412de6111,"e",@progbits
+	.string	"(\265/\375`,\002%\022"
+	.string	"\206cwE\360\320&\035:M>:\0341\r\265\331W\"!\274j\370(>*C\243\371\276\376\314\263\374\265v\245\226\2212\214b\253\262\355`;z\213\201g`;\323\317\311\275\316\257;\372E\017\266\245v\230\226\354\275\245L)c"
+	.string	"d"
+	.string	"\\"
+	.string	"\245Cw7\020\017K\367\210\207\366Mx\204\204\365\032!i\331\365N\207\246\200\354B\205\037\244\335n;\324\017\326\277\356\326t\035>\315\350\362S\006\326r\250\225\364\374\361\330\274\300\231\321\002\226\341\357\r\330\335"
+	.ascii	"0\230\327`w?\364\234\201\271\244\002\220axz<j%\273\353\222\206"
+	.ascii	"[\273m\026\333\021\354\344\002I8\226\003t!\342\263_\350i\337"
+	.ascii	"\027\032\n\nz;\333\207#3;Q\342\263\373\370,l\002b\371\003\246"
+	.ascii	"[\330\253\307\007\362U\374\247\365\025>\372\326\354-\350\310"
+	.ascii	"6\330\330]\220CC(\035~\274\364{X\266\311n\331\246\303|\307B\320"
+	.ascii	"m\315\313\232\366Q\234\247\365\024&z\307n\016\221\321n\027rh"
+	.ascii	"\007\001\273\253\032\263\315\340\327\250\007|d\212bn\\\244\300"
+	.ascii	"7Rq\221\017\3027Q<\\@\003I\237B}\f\211w\307\210\251\252\217\031"
+	.ascii	"\361\222I\276\246~\350\360es\3642\003(\207K&Y\257\273\333\222"
+	.ascii	"\032\263\306\1775\307vZ\213\232\206\357\376\367\322\372\322y"
+	.ascii	"\241\373\246'\013!\340f\227&+\023\n\334CI\340T(\226\007'+(+\247"
+	.ascii	"\023\347\341\223HJ\312D\205S\241NP\247\023\267\255T\251U\nj\265"
+	.ascii	"\245\230p(\333I\265\332D\02285\001\245\332TR)\325f\372Ws\b<\337"
+	.ascii	"\0255M]\342\242/Pc~\007\222\f\03047\263\325\016\326\377i\314"
+	.ascii	"p'\202\334\264\223Q\2573\266\035\362kz\360\251\001\2237\254\177"
+	.ascii	"\033+ `\202Aw\266\r7\"PAb<*\360i\230 \327\270\020a\247\250\272"
+	.ascii	"\216\355\030\315K\334\331\213\037\255\276\021\216\030\235\nN"
+	.ascii	"i\300\003k\020\336W\262G\351<F;\232%v\231\257@\251\220\200\001"
+	.ascii	"\200\342\271KS/\336k\222\253\f]l\200zX\023\266[h4.`\007\305\023"
+	.ascii	"\347\n\322\337{-\306\003"
+	.text
+	.section	.gnu.lto_accInitFilters.part.0.93.a97c749412de6111,"e",@progbits
+	.string	"(\265/\375`\036\002\375\021"
+	.string	"f\243vF\340\322&\035\220\314\361<\216\210P\bz\2475\007n\270\002^\300\221\353\013L\203\202(KD\305\035od1F\327+iS\214<\327\205e\214s\273C\2141\336`:\262\371\216\bk\374\372\275q\374[K\366\2262\245^"
+	.string	"f"
+	.string	"b"
+	.ascii	"\001\266G\370\221\355\3211\367\361\n\354\006\227\276les\334\343"
+	.ascii	"U\330^\335\230e\363\370\027\333\022\036\031\006Zmw\273G5a=\374"
+	.ascii	"nM\326\241fd\371#\025\331A\\/\231C\b`wE^-H`wO{\332\274fRCx:<"
+	.ascii	"G\036G*\273k\222\207{\273\355\007\266\027\330\271\022\336F\351"
+	.ascii	"\b\267\264\306t\302\364C\022f\240g\227C\321\217\035\021\205N"
+	.ascii	"\374\347@+\303\300\205}1\234\317l\210zj\333\372N\334\342.b\f"
+	.ascii	"S\362\305pBj j\330\250\355"
+	.string	"~\335\243?R\332\367\177\356\343\323\314\315V6i}\373\272\271\314\237}_\301:\013\017}q\366\032b<@=v\367\344\321\005H\217&\017\032\325N\240 \357\262I\215\312\330\037\252 B\344\262m\3414\030\240\020\355.\002\241\317h\340\200\205e{\214z\327\207T\325\327\364x\320e\224\374\035\233N'\005\201\331\020\036\003E\332\335\003\376\213\303\220\340\357<\272\305\313\273\036}o{\274\236v\230\002\246\003\205\317L\026Y\257\273+\223\232c\215_%\341\216\240B](A\233R\\<\324K)u\232p2\231J\235*\345\251\\N\252\316\005Uj\351L)U\227\"\300\036\205S\252{\361\274T\307\331\316\373\317\220#\004\216\031\245\261\376Ps\034u\342\3119\235\334\024\252\215m\243\034j\226\230\355h\245\017\353\341\356\256j\216\355\001\207\272)\311lCP\215\b\232,2I^5* P\002aL\253\r\2706"
+	.ascii	"\220\235\210\t\301\333g\253\332\t \246L\226h\f\354\316\323\232"
+	.ascii	"\0216\177\331Y\224uo\2676(<\215\023\267\204\257~\260\036\270"
+	.ascii	".'\f\354\030?\341\264\225e\235\302\022\261\214\021\234\320\007"
+	.ascii	"\027\302i\303\240u\ne\244\241\214yk\013Ak\210o|\203\251\345\256"
+	.ascii	"\275'(<"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a97c749412de6111,"e",@progbits
+	.string	"(\265/\375`\362\003\305\022"
+	.string	"\366ZiH\260\230M:<\341|\346\237\374\036\315Z\377\350\2241\350\276\367#\377\224n\261\003\362\377AM\367\212\344\266\353|0\341b\264LvlL\270V\200\360$\201\301\307\314U\002mQd\306\330\335\237\341\035]\rB#\233\310-SP"
+	.string	"a"
+	.string	"S"
+	.string	"\026\372Rd\005\005\264\326p\211B_JN\370\023\tw\022\341Mjg\002\341O\363\301\227\304\034\\\211\244\224\336\032\264\216\024\202\315\337b\257\240\213\223\377\r)\220\200\371\337\243\265\322\245\375\351\034YqL\177\377P~lG)\245>=\223\377;*\0019\220n\3308\262\031!\021\331j\340|\303\035*f&Q\367\244h\004Q\2604UA\321<\353tE\b\217\023\275c\242oJ\264\r\353\270j\352A\242kz\252\246\212\214h\232\210.\320\205h\002\224i\250i$\210\376\024\371\241O%\231z"
+	.string	"\320!"
+	.string	"\007\241\271!HC\177J\376\226a"
+	.string	"\206\330\0050\336\3078V\272t,\253e\033\027\256\325\270\270H\334K\0351\2424\363\370E\244y\fc\2651V|<\315\226i4\203\031\3553\312\350\2371F'\200\321Gr\324\317\275\350;\331\372\270\321E\003\215F\275\240E\037j\377\377\340X\324O\262,\344\\!\233\177\337\334\213\206[u\037#\303C\262n\353'cV\005\331\313\301@\336\360"
+	.string	"\310\265\035\220gx@nU\255\f\324\220(\027\214W\334U\312r\025\245\003\343Mzq+\274\371\270\225\264\213\243\224\342|\3542\360q\013\221\375\270E\334\315\371\370\245.-\b\025\220W\250\221\f\003=\243\231\242\202V\016\260\002\251*n\003\021\300\030\345\312H4\023\324DN\007b<T\342\257\022r\264\272\324C\240zEN\\\251\353\025]\376\"\210p\253\244\322\321\256\003\341q\332\210\247\363\365\224\325=x\271_\377\270\374r\364\214Km9\260\207D\2148y\333\006[\n \231\024\3721\367[\200\346r\374.N:}\300\222\203b\r\036\203U\330#\352=\212,\253\233\355\365.\256\337 \345[\200s\2715\227\324\345\342\372\357\242n}"
+	.ascii	"Z\323p\251Y\023~j\251\236\226\352U\272\302$\200\002\355\243<"
+	.ascii	"\230)4\376G\330]\341T\001"
+	.text
+	.section	.gnu.lto_.refs.a97c749412de6111,"e",@progbits
+	.string	"(\265/\375`\350"
+	.string	"\315\t"
+	.string	"v\033F/p7I:\374\377qUUUUUUUU$\001\252\3729\n\370/\037-\376\1773\325W\375\277\033ZD\272!\333\254m\2445b\211$[\2466"
+	.string	";"
+	.string	"9"
+	.string	"\375\207\275\303\370c\275c\341\314\302\027\205/\205+\205'\365\\3\"K\034\217\270\227\364\031\322G\351!\352\237\364\007\367\214zV\276$\316\3507}J\2347\037\317\006\001Jy\352}}\226\007\314|\260\3413\350/`\257\200=\002\365\027\354-\034\274\302\361\024\213\033X?\261\274\304\362\021\312O\224\177P\336A\275\244\301#\f\027\260^A}T\0161\216\020\t\"~\240\177\021\275\005\304+\240\247(\237\350\027(\207\350O\312\033\372\022\365"
+	.string	"\356\027zC\375V\376x\356\246\337P\t\274\375\203 (\f)o\355\233\347n8\317\364\027\347\003\177\020\327n\222N\316\004\322T|\340\r\304Y\304S\364\204v\350\327k\270yK8\217\021\316z+\355W9\243\275\342\354\rX\247F\206\3645\316\306"
+	.string	"w\237\373\234\027\322\001\n"
+	.ascii	"[\013\361\031\3410E\274\234\271~\213Bs1\021Uo\340\233AE=\247"
+	.ascii	"UZF\n"
+	.text
+	.section	.gnu.lto_.decls.a97c749412de6111,"e",@progbits
+	.ascii	"(\265/\375`xF\3651\001\212\016\376qV \fQ9\351\324\017\n\224\r"
+	.ascii	"\352\237\232]pz!>:\265!1\\"
+	.string	"\036\377\n~\2141O\361\274\335?\241\273\320ve\300t7m\347\221\221_q\252\3275\262;\323\021\312h\3644\035\261\305\307\035\037\0354\333\347<\267\333\205\246\264s\204\365\377\273mK\310\336r\247\013\006)\0079\007,\206\244\b\322\367\347\325\326I\205\1772\365\221\236\202\002\344\256i\255\333\304\277m\370g\325\007\375\275\202\177\231\030\250j@\373G\003y\007i\254\334A>\250\3129\331Ax\332\344\234\344\251u\203Z7\270K\256\2120\321\373\013\005\377r\341\277U\037T\204\252\001\375E\202{\271j@\201z\307\222\307'&\r\216\261\276\277A\360\357\f\254\343f\315e.\207]\337\337(\374f\365Ao\325\340\232k\320h(+\2223\3726\215\277_4\214\246\352\234\2636N2\372v\214\226Q\231O\353\031\276\246e\016\373\221\005\371\243\357\255\034V!\347\234\353\323\320\336\323\320\277U\rhN\365A\377\236\342"
+	.ascii	"7Y!c\322\367o\251\216\262\312\026Uy,\347%\206+&e\305E\337\206"
+	.ascii	"\352'+b\360\372\336\252\341{\360\327\257\273N\261\223\\f\251"
+	.ascii	"\235+\252\032ZvL\304\324\270\336\325\323\262\225\225\205\312"
+	.ascii	"e'\271\314\310\235/P5\264\354ZY\347j\235]\236\341\024,\260h6"
+	.ascii	"Q\3262\265\271\323\264\314R8L-\352\033\b\020ZY\273T0;\310e\206"
+	.ascii	"B\257\\,\377\267\213n\321*\372\251W4\213\312leU\363\272\246\332"
+	.ascii	"\375\006\375\240qe\320\350\330\271\355\304!gM\f3\367\275\r\303"
+	.ascii	"M\315T\231\215\242\2669\353d}\303\032\201\367\246\331(jXe\263"
+	.ascii	"s\346l\345&+\347\314!(\350\002\032 5\320\333\310\037\235\025"
+	.ascii	"\252\222\350\350{+\004\277NA\273\353\\\337Tf\315\253n\302\362"
+	.ascii	"j\225Je'\271\314Q\r\260\253\241\365\023d\357\302\332\232\350"
+	.ascii	"}\327\341w\027\374W\274W6a9\347\r8/\336\340h\364\0051\364\212"
+	.ascii	"\207r]\331q\327\367]\206kU\325\200f\250>\350\233\013W45MerP\351"
+	.ascii	"\226<\035\304\215\024\026\372\276\213\340W\016P\233\227W9@\337"
+	.ascii	"<j\013\365\213\032<\025}\3371p5S\317T&Xm\362\373\244*\207\345"
+	.ascii	"\274\324\261I\031mf}_\201P\236\274\274\274\274\n\204\276Y\340"
+	.ascii	":\246\222\251\314\f*\334A\200p\213|\302\243\363\246\353\r\233"
+	.ascii	"\276o&\374\232\001Z\363j\006\350\253\032\\\301t\375R\303\274"
+	.ascii	"\202\251^\016\002\204\3474e&9/+\230\233s\262\326\rvj\335\340"
+	.ascii	"L\033\222d\001\275\257M\374\372\005\177\254j@\3358\240D\302\340"
+	.ascii	"\245\365}\245\202"
+	.string	"\317\352\226\372\206u\337\2505\333\352ZeV\266j\306V\303j\331\316\231s\322,+\347\034\304!\bG\007\017)\025\350\325\362c\355\264\234\221\365}=\202_\247\2401k\223+\225\312\316\231s\025YV\316\371\177\315R\325jZeV,\325\312{y\017\376\241W,\265J\245\322\001E\316U8,\260\302\302<b\227s\016\n\372\t:\3254\357\346\360}E\201/\304'\302\027\001~\007\360C\340\277\2129\251O*\225Z\225sS\316yCo\352\212\223*}k\224:V\231\034*\331+\224:\345gr\231\2279g\236\212\006\213I\252oO\325\200\236\001\370?\006\311\f\302w\260\nr\256\034\320\232\227W9\240\025\312\220We\342\203FQ-\363X\316\231\307\236aqj\323\267\253\017\372\013\370\215?T\r(Z}\320\237U\r\250\006U\003z\253\017\332S}\320/\253\006\024W\037\364\0344q\303\177\271\374\377"
+	.string	"\t\322,\002l\320_\333\376\372\241\355Z\240-\177\345b9\260\007\260\006\370\233\314\026\340tk\225\255\353?\225\303\301\370+\013)\034\004\007\370\371\027K\200\277\246\351\020\220\360\337.\337_\351Z\314f\360w\006\376>\301v\310^\177e:\335\231\337\002\340?\006*\362\267\030\374\366\007D\372\367\327_7\260>\377\341\376j\245^\231\003\332\300_\033\357\327C\375/\002\210b\177\335\200\316\366j\3359\370\177\200\373\374\267\255J\371\375\317\336\337F\326\202\277\006\240r\371\007Zh\345o\020X\f\177]2\362\327\024T\024\2449\206\377\036\351\372k\234\355\251fTNg{_\016\200\301A\374W"
+	.ascii	"\177#Y\036\255-w\253L\016v\347\377\317_\245<\005\213\363[_%;"
+	.ascii	"\320\177q\376\323\035\340\357\024\240\377\275\263\275\377)\364"
+	.ascii	"\322M\363\367\007\213\376\315\201=\377\232\363\333\373\327\255"
+	.ascii	"\277\342\337\332\277\362|5\030\333uI\224\206\263\365\357\273"
+	.ascii	"\277\236\261\317\373k\013\377;|\351\241\240\377\006\377F\300"
+	.ascii	"\233\277.U\024\374U\311\377\026\346\032H\347\277"
+	.string	"\032\370\353\205\377t=?\177\353\346?\226\377Y\376_9\333\177-\377\335\332\315s\376[\246\366\034\347\277c\376\347\375wc\377Z+\331\361\177\277\374\r\344\357!\177\013\371\373\307\337+\374\035\344\357\"Z\035\343\357\036\177\363h6\377y\376\023\3707\336\337q\177\207\371\233\313\337m\177\257\375\215\345\357)\177G\371\033\354\357%\177+\371\033\311\337Z\177g\375=\374\233\351o\341\337\036\370;\005\177/\375=\3647\320\337J\177\033\3776\301\337\304\277I\3607\321\337%\376\036\301\337\"\370;\004\177\223\370[\003\177\177\3607\210\277\023\360w\320\337\032\374\035\200\277;\374\215\301\337\033\376\316\3607\206\277y\376\326\371\033\347o\374\367\371\3277\177\255\373k\n\376\372\200\277\032\377\032\346\257^\376\247\360\327\265\377-\374\225\356\257L\377\277\374\247\362W\364\277\333\177\f\374\365\314_7\374\365\347\257<\177M\363\327\271\277\206\3755"
+	.string	"\377\351\376\032\345\257r\177m\362\327\270\277n\360\177\312_\307\374U\314_\301\374\365\313_\273\374\365\355\257\\\376\352\366W\266\277\252\3755\313_\261\3745\355\257W\376z\366W\263\277\226\375\225\312_\247\374\225\354\257R\376\312\374\353\330\377\013\374\225\303\177\022\177\305\360\327\236\377\304\377k\3777\344\345\345\345\375\230\356\317A\363\017%\0032~\324\3316\377}9k\326p\274h\303\206\305\226\231\031\r\245S\327B\253\005^U\203\345d\350\350\373\234\034\370\257\357\037\315\311\250\234\363\324\271\314QL9\350__\317Z\201~\235j\353"
+	.ascii	"\376\337\234/\002\007\226\231)\214.\347\\\351\360\021\263\244"
+	.ascii	"\r\r\362\377\377|\313\271\311\n9\202\225T\223\325\fe\230\225"
+	.ascii	"\024\006e\230UF6\021Ab\210\312VHeX\316\030\232\232\220#\252\244"
+	.ascii	"\224a\311\214A\031\226\2452\n/R5/\255\220\271\251*c\310M9\231"
+	.ascii	"\303\252\2444P6YI)\303\222R\030\224aVR9\314*\367\344\246d\224"
+	.ascii	"\212\246\034\205!\207Y\315\345\260*\251\036eX\225\2242\314\252"
+	.ascii	"Hu\243\302\313\215\251<\272\036yUJ\331\224]<\335HF\365\274)\227"
+	.ascii	"U\231L\316u\314)G\345\267\234\007\220\363\215\252(2\311\031\365"
+	.ascii	"\214\351\315\005\323\224dU]\346\2349<1]U\345\2467d\315oJ$U9#"
+	.ascii	"a2\312O9\347\374\001r\371\226\177\3247$\217\033\271\205S\316"
+	.ascii	"\030\344e\316O9#k~\3139#s\316\275\250\033\313\234k\364(\263\236"
+	.ascii	"\236r\246\372y\3127\220hN9\367X\334\231\2242\354\252j\bM,,+\247"
+	.ascii	"X\"\253\262EU\316\312d\254"
+	.ascii	"\242p\030\322In\221s\256ip\226\324\0134}\2278g9\244\300\350\273"
+	.ascii	"d!M\327\214\2766MNRFY\227\276\307i6\355\334\205\314bI\330Z\323"
+	.ascii	"\314+\323\232\261r\230I\231\263\224\006F\346\274\232v9\212\252"
+	.ascii	"\003\035\261&sx}\317\240RD\226f\372\036G\013\037\207\210\215"
+	.ascii	"\353\031,\264\246\372\036g\207\205#\323l\316\312xy2\306\212\271"
+	.ascii	"`\346\254\356\253\357r\f\312\030Z\2120^qn_\336"
+	.string	"\200\261_l$\315\212\364]6q\341\200\223\342\005M3AE\261\322eY\243\3440\242\343M\007\330\023\r%\027\353\226\244K\017\254\276K\f\234\351a\244\315\262\235\240\242\002[\273e\333\260\363\002\nW\215\276v\313\320\355\232\003\202\360X\322\327Z-J\024-\210\234\027\265*w\262\260eI2\013\220\316\235\030&.,6Y\344\n\226\264\264+\035\327\243\fE\225\333+\277\265\322Bj\\\235\312bU\244\357Y}\320\n6t[\345\362P\003\245\205\226\001\317R\306\023\217\263\n\306\013\313\325\230Y\243\300in\324\252\224\225\025q\250\331Q\341\260\205\246\303\307\224N\321\253\003#e\013\231e\372\300\260\341]aV.\367\313\314\r\234\024\261\234f\214(O}\255X\363\260\313$\227\254\2343\016\261\256j\253\37266\202\t\231\246\r\263Pl\024;V\231V\314:\271}bYh\034V\254s\264\216\235\246eF\206"
+	.string	"WC\313\206\025\353\033\025\f\210\270\032Z?AA\fp\032\023v\341\342e\325\200Ve\365A\217c\003\333&9I\272\350X\323\3678S\270HV\203\325\2671'[\\OV\350 @]\310-.\273~\223g\233Dp\212\362\271`\241\210\355\352\260\246\023\301)\212\002W]\315\234s\027\261]\335\244\226\3257\254\234\245>\3302\262\305\205\304~Y.\253\304nY0\273\304\036\261^V\3132\261I*\323v\265\2327\216\276\372O\013\251]\346\332GW\023\251\315\3726\226\223S\037\266@\200`\273zH\005S\337\2502r\256"
+	.string	"[]\272l\n[\244\003\2232\347\251\017\222\240\371\260Y\326H}\243\312I\344\007]R\271\210\355\352\345\022\017\376v\322\325u\355\346\nh\013\271\305e\227\363\322\222\265\331\241\004\203k\215\304\215 o\300\260%JG\337_\b\203-\021\036\036+$\303\364\375\2054\254\264,\3542\213\004&\027M v\210\rR\231VH\223\025b[\330*\021\234\2422\300\364\324\024b\177\234\255\003\2232'w|0rw\004\206\335\025\303\322\242\003\337_\250\201_\237Pq\250oX#h\2215qt5m\225}\2623:0)-\2406\245\306\323v|9[\215e\335X\3220l"
+	.ascii	"\325\267\261\021gL\2329"
+	.string	"/m\225\315\361\264\235\246\236\334D\204\253Y\277l\225\245\301\001\375\361\243H\016;\353\303b\331\035\266\207\275\262<\354\n\326\2522m\225\325\361\237S\f\212\035\033\013\356}i\370\2762|\237\030\276\017\f\337\227\004\337G\004\337\347\003\337wC\306\024d\013^\240\372\336\307\002\377\267/,\214\312\2641,\224\013+\305\343L\226\215a\247\254T}\243Z\346)\013\316\300\371\250bg\313\312\320AA\3571\023\377V\312F\341\274\371\302\361\306FY\250\035\260\"-x\364=\326\302\307A\3601\017|\214\003\377v\305-\213\337\242\260N\035d\004\247\024\025k)\372Z\025C\267+P`\265\230\352\313A\365A\217e\340c)\334\313\252\001\005\252>\250e\302C\302\334\270\322\306&-\362\313X&c\363-\362rh\034\022\013^\257\016kP}\320n\203\327F\006Z\221\276\357\275\341Wf\263\301\243\202D\305\224\276\215\367\203"
+	.ascii	"\241\202\311\311\035r\360\330\334`\364}]\333\375\367\355\210"
+	.ascii	"\0013\263b\267f\347\311K\266Z\323j|j\310\270\361\352\373^\026"
+	.ascii	"\374\336Y\2322_3\304\372\276\027\326\354\271\312l4\315|?i\026"
+	.ascii	"\376\203\246\305ZJ}\033\033\001&\005M\223\265\\}\243\352\311"
+	.ascii	"Mrq\315\234\363OPP\025\303\362\006\rz\271t\031-g\332L\267P\231"
+	.ascii	"-\367\226\353)\235\266\203\304\220\263\017\270,\271\306\322m"
+	.ascii	"\365m\254\004%m\315 \234\026=p \361\205\353\270\312\3542M\346"
+	.ascii	"K\217\351\300\244,\201nJ\223I\231~k/\035\230\224%\\Qkb+@\256"
+	.ascii	"\374@\357{\\\370\3571o1:*\314\216\214\001\323a.\304\240z\273"
+	.ascii	"\322\367=!\030\314\253\013#(\326\372\276w\205_\231?\323].\027"
+	.ascii	"\204M\306W\337\367r\340\367f\340\367^\264u\226\336R\337\306F"
+	.ascii	"\270\2555s\316l\355V\231\335\326kmM\245\306\3257*\007lak\356"
+	.ascii	"\0249\342\365\205\336\367R\340\273\325\024\245\255\265\264Z\326"
+	.ascii	"\321\221\303\221\206\244\357Q7\370\250\032|\024\r\376\337V\372"
+	.ascii	"JevZWy\375j(\377Y\346<%\255\313\032\255\003\223\322\204\034\\"
+	.ascii	"\2329/\323\232\n\316\220\254\246i\227\363\362'(\250\307\243J"
+	.ascii	"\023 \350=\032\005\377\215vfi(\251\264Y\236Y\250\300\f\351\373"
+	.ascii	"\2772\333\254\231\313\374\203\023\267\"\313\365=\272\304G\271"
+	.ascii	"\360\321\"\370\250\017|\264\006\216\322cQ\254\300\270\372\036"
+	.ascii	"\215\212\202*q\315U\003z\264\t\327e\325\200\376T\037\364C\365"
+	.ascii	"A\177\272\301?\325\340\257\037\236\0278\242(\373\376\354\202"
+	.ascii	"\357\201\221Fb\235Da\346\nX\315%\315\2442\333\253\223\374.\263"
+	.ascii	"W+\351.\245\2502n\\9/\203~\202t\230vld\240w\253\271x\002]\316"
+	.ascii	"0?UH\272\017^LVK*\n\024]Pg\230\023\314\216\217*P\270\300|\361"
+	.ascii	"qEd\210\316\226\271\273&/\235\244\245\344\020B\247\206\013\227"
+	.ascii	"\306\373\251\262a\274\274Qr\242%A\033\322\367\033\276\332\332"
+	.ascii	"\256\221\fF\222l\242t\270L\231I\365\375\006*\265_\355\\\253O"
+	.ascii	"2T\215\342e\r\026\273~*k#e\313\317\265z\304\f\216\026\372\236"
+	.ascii	"Z\332\250h;\213\273Rc\306\254\357/\020S\366\363J\331\211\245"
+	.ascii	"\326\325e\246\252B\2421\200\216-i\330\354\262\362\006P\221\017"
+	.ascii	"\035lg\332O,lyP\316\254\316*?\255\374\276\336\2300kO\372\376"
+	.ascii	"\002\"\370<\373\211\366\373N\033/\312 \351\373\013~\340\3774"
+	.ascii	"\373}9Xlnh\372\376\202+\374\013nH\271\224s\312\017\316_a~4s\246"
+	.ascii	"\002\312\031\323<3\206\354\347\0243e\262\356\253\357\311<\241"
+	.ascii	"\360\\I\201\223q\263\232\244\254\213\331\367\027\254X.\317($"
+	.ascii	"\320\362\264p\024\346\r\033b?\243<i\261\345\256\357\371\344\204"
+	.ascii	"\362\337\307\223EE\0237'\2243\f\215\007V\322,\247\215\r4cN\026"
+	.ascii	"\256\023\213\304j\311[\337\323\311\315\324\236Pi\252a\302\344"
+	.ascii	"\004\253O2\024\004\246\344\330p\324\254H\243<\277~\202\335/M"
+	.ascii	"\304\220!\343\342:\227\374T\3313^\312`\341\312\231\n\250k\244"
+	.ascii	"q\003\322\365s\311/\274q\232#+\363\337\367!.\b\221\276\327 \004"
+	.ascii	"+9\225\\\271\372$C\375\030\231\212S\263\313\231\n\350z\215y2"
+	.ascii	"\353{\r\031\377'\222\023I[\2150\226\223R@Y\222b\336\330\345("
+	.ascii	"\265\0160\fy\333\352\373\ff\370?\265N\255\216\272M=9\367\300"
+	.ascii	"q\226\243\250:\260L\\\354\200\321\367\031\224\234(~\276\260("
+	.ascii	"\254Se\236(\316\254!\246\234\004\003\332B\336\350@\307GU\223"
+	.ascii	"M\337\"=\0264\310\306\372>\303\017\374"
+	.string	"\312\004\306)\203\314\2143\006\023.4N\033\365\rk\004%l\3157'\216\263G\231\231\346\371\243\251\2341\334\262\202\234D\316!'\220\023\353\024R\231\347\217\363\306\224\363\307IU\353\352\033\326\bL\332\2329/\305\324\025y\333\2710~\246\003\223\262\004\260\270\263\307\231\343\344\201CE\313\313\026\273\323\307\271Be\236=\376\263\f\n\342\240\303\006\316\016\f\275\377\311\343\274:[a#E\337\323*l\215\005\217\276\317\240\002\377gUe\236;\264\334\020\351{\352\370\031\025\310\025,\236\026\003\315\253\255\35738\341g\310\370>i\316\0328L\023\207[\337\373\234\301\367\201\303\367\001\203\357\303\005\377\247\2143F\330\026:\267\0305\256\255\005S\337\373\254\341\023\352\224:\247~\037\317\2223\037d}\357c\005\377\214\372\357\303"
+	.ascii	"\020.d}o}\032z>\375t\361\373z\255H\326S\337\373\224\341\237,"
+	.ascii	"\316\026\277o\207\f\021)N\372\336G\f\377\\\361\337w\222\345\321"
+	.ascii	"\321\350{\252\300N>\\\034\\\300Q\246\303\306\351\364S\305\177"
+	.ascii	"\2468\225\035\004\005yn\326\364=\231\252\001\325\251>h"
+	.string	"\277\030\372\351\204\343\206\245\331\244\357}l\3407oN\246\2323\262\322\250\202!\346L\376d\312)\363\245L\315\211\364y]\265\235\3103Wa\202\305\271]\001\313`y\325\2547\365\226%E\337\3738a6ln\233\0224|\241\375\350\341\002M\3376\026\234\271k\356\232{W\277\220^M\256V\223D\313\313\265\373\275\263m@\216\204\365}]\255\373\357\273M\216P\371H\253\253sC\227d\271\315\350J\223\346\312\341\2343\262'3}af\265\240\006C\255\357-\320q\347\356\334E\201\221\013\330\341\325\344\312TT@W\f\254\311U\337[\2404s[0s\345\316\234\271rj\320\031h<f+\342\256\364\225\363\202\204\b\263\3571\334\341c\370\"\346\306\211\271pc\306\\\270\232\243\352P\251.=\244\327\225:2\277p:e\236~\024\351\373\272\227\031\301\242BI\337c\220\202\217\001\013Le^0\255\003\215\232"
+	.string	"\0134\232\030\242\360\177\275T\346\365\362\264\022rR\352\303\221\035=too\226\355\236M\231\307\220\254\234\251:\270"
+	.ascii	"\326$\013\225\276\357\221ss\253q\027Px\361\241\226s\347\344\016"
+	.ascii	"\256\357{\230iwK\332e[\373e\273X.\226\253\005#9\334!qj0Yq]\265"
+	.ascii	"_-=\024>\330\300\350{\263X\272\377>\254\244\016\357\254g\211"
+	.ascii	"\337S\004W\346\265\322Q=S\031\313}\341j\246Q\312U\365}\017\f"
+	.ascii	"\374_%\225y\225\\4\237\003\222\\\264\377n]\256{\206\343\203\r"
+	.ascii	"\217\252\257\031\246\002\344j\253\357{P\f\201\2615\275n\246f"
+	.ascii	"\343l\tX\333\320\027[\326\2330\267\266\346R\t[\327\315\352\333"
+	.ascii	"X\315\302\322\306\344f;\276\234\325\274\316.\363\216\335)\227"
+	.ascii	"\312\215r\311n\331\205r\245T\346\025\273N~\237\\\026\232\256"
+	.ascii	"\330mr\263\235\246e\026\322+\343$O\313.\b\207\352LI&\303=\217"
+	.ascii	"\030\334UU\003Z\200,\370<W\360y\320\360y\312\360y\310\360y\306"
+	.ascii	"\360y\240\340\363<\301\347i\202\321\267\252\001\275\231\352\203"
+	.ascii	"\236'\t\022$I\320x~\020\271ZD\256\221\"E\256\021\rG\244\252\225"
+	.ascii	"%-H\271Y\277Ft\352\240\274\201Y\375\367\241nPm\360\372\236g\007"
+	.ascii	">\317\024\376\257\020\346\025b\257\\\344\223\214<\001l\305\026"
+	.ascii	"\273\234\251:h\031oA\302\372\236'\211\255\356\017\253\013\004"
+	.ascii	"\315\271.\253\240\242^\367\013\304g\344\310U\213\276\367\352"
+	.ascii	"^],\214\314\320d\256\2314\221}\335\025~\261\316\033pI\250\364"
+	.ascii	"\275<\256\217\036\215\272\262-\037\267G%\323\274\303Zc\233\230"
+	.ascii	"Y\013\343\205\346\277\317\322\351\020\313\322\367;v\370;c\252"
+	.ascii	"\252@@\336\031h\314\247\260\0349*\230\213|\222\241<\230\363j"
+	.ascii	"r\345\254\326\001\316\026\215)\253\276\337\311\201\377{\203y"
+	.ascii	"oT0#PU!\347>$\221\362\251\371\260a\327\367;H\032Q\267F\323\250"
+	.ascii	"\331)\252\002OfM\235<|\03562n\324\235\321)p>\303U\236\2644\313"
+	.ascii	"\340\353h\301\257]\365\276\270Q\027F-\273\031k\r\231;\270\016"
+	.ascii	"\031\276\216\027\376\257\224T\255\033\001\253*\231,\300\221."
+	.ascii	"^M\273\234"
+	.string	"\325:\320I\262t!\326\367:>0\024\224\026\264\234<\374\337'\346}\262L\253\314\311+\007$1r\006\377w\305u\272,\232\306\bCh]\242:xN\031\374\2341\370\327\251^%\363*k\035PN&\013p\304\311\262\203\347l\301\257\265\016\275\371\371\242\2509\347L\225\221s \2409\211\002\372o\323/\n\236\024j\242\312.SMBq\321\274L7i\201(Z\322\264SN\2132^\360.\262\266\341`\223\274`s\352\373\034&\370v\215\265\273\275\373\235}\203s\316\310e\206\372\3712\342\325\264\313TT@h\022)b\252\372\33275F$a1\205\245\243\244$\340\005>Gc1=\n.\035\001\207B\022\206\0310\n\r\360s#\241\242\241\260x4^pt\2444\034\022\207\275\343/E\201\320\210\036S#R\212\204\032\225\"@,.\025\351\334H\210X\\*\302\340\002\304\342R\321\0057\022JK"
+	.string	"4\021\024\"-\001\320\204\316\215\204<tH\213JG`j\242w#\241\3430E\"*\002\211%<\024 \347FB\306\243#`\320\350\bD\362p\002b\321\350H\034\366L"
+	.string	"\323\243{4\016\211\301\323\304q(,\036\241KGII!0\220p\202\005\216\302\241\t>\277\024Ix\034*\025=\004M\b\340\230\2220^\270\221\220\007\242\020\275\221P\320C\320\304\206%\023\302#\021\003D\303\020\351\t\240\321\347FB\026H\301\004\022\036\216iQ\021x\324\240\004A\342\221\210\264H\024\301\263\224D\024\361s\274\221PQ\222\207\242$\237\340P\tgh\242O\343\257()\347\370\033\026%\235\303\242$\233\242@h\274KI\304\340-\036\223,Q\332#J\215J\327\330{\361W\224$\244\263T<\032\205E)\n\035\214\031\322cz\224\204D4\232\020\f\002\177\214\351QpIDJ\"\030\004n \001"
+	.string	"(\004\203@\016(\034ScZ\274\300\250\201C\021\260\230\236\b1$\nC\034\323\t\004\203@\r\214\033\216C%\242\b\242\364\b<RBR\n\006\201"
+	.string	"8o$T\244T\"%\362@t$T*\221\022\021/P\244T\"%\362\245G\343\022\211\037\006\307\033\t\231\3600$\"!\021\203"
+	.string	""
+	.string	"\261\324\306\037\021P\311\004\302\022;\037J\364P\211\006Q\242\207\200\r\002\330C*4\b\025zh\251\213\351\361HHB0\b\364\241\240\204\243\222\b\023I\026\b\006\2018=\340\216\221(%\342\361}\020:\026\201IB\307`z\354A\"\026O\220\200\004\210\307\364\004\220\304"
+	.string	"\322!q\304q\230\"\245E%#0\275\200\001\322\023\302c0\304\220(\"\030\f\321\241D\375 T\302\362\f\t!\t\213)\244GEC \006\035\020BD\351\t\240\361\307\223!\304\320\204\003`"
+	.ascii	"V\017\204\2006D\3210\230SBx\004\024\021\f\206@*\022M\024\323"
+	.ascii	"\244\f~C\022\216\2511E\241()\203\007\205\305t\230\026\341\177"
+	.ascii	"\020\202\002B\020A\205\336Eh\300\207\006|@/B\003\206\206\032"
+	.ascii	"\020\302\020~\bC\366\3703n E\022\036q\206\007\217\301"
+	.ascii	" \320\246\277\224\210x\201b\232\224\246%r\214\277`\020x\036o"
+	.ascii	"$d\200bzt$4\201\036y~\275\033\t\035\203J\305\243\021\204\361"
+	.ascii	"\247BzTB\302P\202 \361\350\367C\217C%b\360\367\353\025\323\341"
+	.ascii	"\t\210\277_\317"
+	.string	"XL\215J\303\337\017\023\r\205%\370\375P\343P\230d\374\375zG\351\357\347;\376\216F\341Q\317\215\204\214i\322\322Q\001Di\021hdT\200\007\343QX\302\203\322\260H\001*(\r\205G\n\370 \204_\b\"\250\340!%R:\n\016\205\036\212F%\017\f8\252\220\016\217\200\303bz\034\n\177D\300\264htL\372\3756\234H\213I\277\037z4\n\217~?\024x\004\022\375~h\212\002\241\361\367CK\020$\036\335\243ph\302\220\204\243p(D\213\307\023\202C%\022\210\200)\n\301`\210\f\306\337\211tD0\b\304C\022\210\200i\021=\032\177\302$\022&\322\021i\322R\n?\023N \201\223\006\207\300\243q(\304\307_\006L\270C\341\tCc\020\025&\031\255\361'\002\204\t8\"@\230\340C\203 \204\366FBF\245\022\034\214\277\013\020\365\024\323\243\021\210\204\032\215i\221\210\b\330KO"
+	.string	"\217H(%!a\245\337\211\224\310\250T\002\033\177iPx\"\035aT*\201\223\376\322\244\245\024\214J%|i\322\322\321\250T\242gT*a'0\364\013\006\201\350\t\200(\210\030\021\002=\336HH)\t\351G,.\025\245'\204E\"\004\244?\024>\200\360!\004\245$$\237!QxT:\"\032\323\342\005\343/C\372#\241\224\204\204\203\036\217\224\214)\nC\242\360\030L\217\351\b\245$$\013\206E\302\243\020\301 \020/\021\001S\024\200G \221\257\b4\n\336\224\210(bH\024\032\205'\322b\316\211\224\310\036\177 <8\002\236(\246\307\241\tEC\341Q\022\022\220D0\b\364\0211\"D0\bD\323\3400\003G#0\265\3001\004Qz\004\022%m\340(\r\006C\030\205\034\216?\020\036\034\207\302\336\321DJ\364;n\270\321"
+	.string	"\214J?\243\340Qx\002\3210\304\321\021\261\350c\201\361W$41$\212(\246\307\024\211\250\204Q`\3643\221t\364\013\006\201\027\322\337\316\260Hx\004\374\005\203@\337\361'\302q(T\352\245E\340\t\210\212\300#\"1\002\277\263h4\3613*\022\032\375\202A`\316\321DJ\304\341FB\031\234\230\224\026=\034\211\304\242\007\234\023"
+	.string	"\227\254\021"
+	.string	"GG\304\3425\n\036\205I\2471U:\002\236@\225~F$a1\005cP\210\004\034.\2158\032\025\t\217Lh8\376B\030:\016\205\2753\200\001\"4\330"
+	.string	"\006&\200\203BC\242\360\b,\246Gi0\b\364`,\022\215\303\324\350a(\004\"y\b\026\215\036\20468\001\260h\211\305\364\003\301 \260w\024\210es\225\245\226yv\360\276@\255\371\201\002k\255\315\025<\272%\222(\\bP\037'\0261\273\262)\264\3079e\005-\267\034}Q\035\250\016\364\252\346\2505R\250\325\321\253\004\264\300r\201\356\340i\342Za\n\335\201V]'N\230\374\340\3206j\334(c\313\021E\314\213S\027\016\264\254'<\246n\334\263;7Y\224\330@k,q5\235\234,\236\200\271\365\215\021\003\245\252Qh<0\331\250\241e\227\251`"
+	.ascii	"\241T\350\214+I\2648t\006*\343\302\300b\305H\227\032\270\263"
+	.ascii	"\276\3470\206\177\024\306\t\026f\346\316\r\372\342\302A\301j"
+	.ascii	"\242\003\235\272l<[rP\266P\251s\211\330V\231\261\276\257L4\352"
+	.ascii	"\312I\241\201u\325\027}B]\034\205:\n\325(\224\315\313C\277\300"
+	.ascii	"DA/\312\002eq\333\224\200l2\347\325\344\342`\205Q\025\250\212"
+	.ascii	"\333\3067\324dG\033\374\243\312Z7\003\005\033\262\024\327\b\017"
+	.ascii	"\231\252\036-\234.VS\256+L\337%\023(\250 U}\227Lr^\356\240J\204"
+	.ascii	"\244@c\n\303\325T\261\004M\236q\367\315\016\005\016\024)\347"
+	.ascii	"kb\007\207"
+	.string	"\346\237oM\362~\344] \021@\323\242G\337\323\315\351\346d\232\373\240k\316\253i\367\363\005\377g\033\373\346.\017\007\233\276f~\312\2319\361\254\230\234\214|\222\241zfk>\270\354\262\222\n\b\307\t\013']\352~\342\375\274\003\001\302\317`.%b\222}O\273\357P\265Ui\366\375\251\346\\\363\373.\034\351\021\266\325\367?a\370\nx\"CJ\252\357I\327H\316\264\230\353{\246y\032\325\030\273\025N\267\253/L}\317\026\316fe~\355\234\373\222g\247J\n)k}\377\363\205_\277\206\256\240~\r=\317\370\252\344\350a\325\367=\246\030\033Y}\377\243d\314\2303\356C\315)\310\230\2464\255\r\256\273\271\270\023\356\253\007\230\031\334I&\307\313\031.\3144G\230\264\360\350\373\037\254.\001\204\236\250\023B\223zD.\2141 \312)\305\220C#\265i\306\023\025@ HP\"\232\212\307I>\023"
+	.ascii	"\004KN\t\3034PB\246\310\f\211H\222\202\202\2441\237V*\231c2$"
+	.ascii	"2\211\324\272\377T\200J\001\231\311\n\314\200D\342\324\035\264"
+	.ascii	"\026\026<8\222D\274\310\224\016\267L\034\3344\204o<H\027\272"
+	.ascii	"i{\024\324\233<N-\201\375\006\027\256\276\270\347\322\363\034"
+	.ascii	"M\346\230\210\356\016-\032\231\b\351\320\210\300\322,XV\t\305"
+	.ascii	"<\340\003\266q\247B\343\3650gsx\023\213\322\375\226{\352n\211"
+	.ascii	"\204\216\341\366\3318\fl\237\342\245\037\005\263\226*\365& i"
+	.ascii	"\321J\251\317\"\261\312\037\322\340\n\231\036q\372\257v\302\243"
+	.ascii	"\005\201U\244\335&\307\311\370\276`\300\353\327\377\235J\\9'"
+	.ascii	"\377)\203Jx\306\361\216\345J{O\213\321\2171\240\235\206"
+	.string	"\215*\344\262\030\312\262MF0\005}\263\304$\225\223S\351\226\370\277\002\277\034\t\027\216\305\227|8[y\355\341\213\304`\364\323db\201]Y\303\351\241n\276\302\363\371d\360L\220X\311IN1\037.\206\b\201Oe \332\321\204\370*!\256\371\325\013b\r\354\331D;6\221\364\357\003\270\262\236\370'\363\r\204\246\273hBsn\300\205@\021%\301hq\340;\250\271\313\266x\262\242\311!\264ME$5O\"\032\"\036Tc\030=l\315\333\215vc\356\031Qy\262\304BF\271\017\2748\235\377[\214#\375\227\224\226\327i\362\013\215\373\200\362\276}\341z\210\033\311\3355\272\236\036JXh\302-.[\232y\264\350\037\n$\263\224(\300\242\261\323H'Y\220\355\354j\250m\320P\312\326Q\356<\3218\336\007\364\223Ov\356\221\241(A\033\361_\343^c\007\230~/;\263\017\024<]8G\022\235"
+	.string	"\277\025\237T\350#\201<\225"
+	.ascii	"\177\023d\3007 j\275\200\003J\362r\3255u\221\307\2214V\2075\267"
+	.ascii	"\032/\003\340\306\327Z\232\177V\301\030\300\365\320\203\302\201"
+	.ascii	"\300\232| R\024`\373\3634\027c\273\277\003s5\304\214\337@\366"
+	.ascii	"\251\326;!8Z\353\334\327\371E\224\351g\034\375\321\235\027\326"
+	.ascii	"\326\356J\230 \345\302*\324\352\271Ls\343\205l\225\317\340\003"
+	.ascii	"\357/Zg\276\331\321G\377\224k\330ip\360\350+\"\262\025\314\250"
+	.ascii	"\020kE\255\221\213E\003\001|aI\353<_\310Z7\341\0019\350\034\246"
+	.ascii	"\213\370p\200\005\341\016\370_\316\324\031@p\2130@\311&\2018"
+	.ascii	"\356$\022\340\273\0328\200\350\352\206\221\333\306"
+	.string	"\020\026Ze\0343\212\262"
+	.string	"\265\301\257\346\344\260E\371\036\210K\f\211KCHc\002\350\230\323T\250)\243\216\331a\247\250Y\223\316R\201\300\036\220\372\026r\200\230-\217\336PQ|\207\023\363\305\276`\323\205 w\223\360\231\206\313P\321u\214\230\357l.\333j\024\265\267T\325\375F\276\354\326Ii\276\301v\204`\025\350i\303\311b\"\374\243\200\305\340\n\345c-GZ^\262\342\252E\007\205\316C\377s\231\020\004\027\201n\201\017mbW\342\234]\337Fqu\036\261l\323\233\302\340E\017+8\235w\351n(\206\003\016\2515h\203&IO\177\315\222r0~\216-(5\031R1\361s/\370y\262OC?"
+	.string	"\302&(\357\373\263\344\216\326e\245\342+1\350A9\203<\355\212"
+	.string	";P\233+\260\204S\250h\211/\315[\304f^\nE\360\217\312\233z~\020\327\216\237\003\032\206\377\016\234\027\001C=&\036\b\3224\323\036\311J\333\377\242\263\275\303\361\345\022|\226\214*"
+	.string	"\352r`&\315\226d\371\026{\215\350<\335\340\301\261\223o\254l\"Ci2'\003\3138\274\316\251\326\374w\337\030\274\343S\257A\t\221\324L\016\261\236 \273\202\034\375\355\004G5\031i\032\341\007 \001U}\214\3658\321\245\2349?\236\343\3319/?ps*\351@\227\261\215h\243\346+,\330\210h\3213\214\262\247vu\230\236}\250\330\033\313\022TX\013\354\002\247b\244\303\027R\bf\351\020\312\300\270\305\237\006L\214<`\221\377k \020\254$Q&.\r\037\301\005\347\365\347\370\330E;\335\234\020\f\250\007\036\234^$\213\255d\313\376@I\245\371\351!\261\\\315?\301\327\371\333%\020\032\344\315-d\322\214"
+	.string	"\204\3604r\023\227\371z^Z\210\370\005-\217\016\330\224\233\305\327]\242\f\254\224\3053\370OE\235S\215!\210\2118gL\276\310{G\207\317\351\272\222f\246\207/\005o\nB\027\363\r\306\037\330\260\212\377\202P\2641\204\274\232\274\224U\277s\231\272\222"
+	.string	"UpQ\037($\257\252\333\006\212\363Ly\240\3237\033\263\\\220\246rCw\023\215"
+	.string	"\177.r\001\222\365\f_\356c\377/$t\207F\303\302\303D\361\216q$\255\034`\032\031\213|\215A\213j\004\232mR\307\240\202\364\367\245\205\322\352\361\373\371\363\031\260\266*\275\257\003^f\321%V\377\001T,\254\253w(\037\341\212\363\216d)@\310\031\3707.\207\\\t\240\225OJ\357\350\363'\2228\036\r"
+	.string	"\025\032\027rw\355\333>\302\341\374VY7\220l\205\304\203\005z\217g\0358}Z\007V8|o\314\t\376AWL\262\277pg\366\266.\205|!\254\234n\016\300ly\320g\261\271\245cU\251\357\241\337\342\332\313\320\310\323\025\322sC\353\205\307\265\307TH\330\326\221x/N\003\263\326\017\337u\277{b\035\016nW\006\263(5\006\363+\317\021K\210\3556F\177\333\302\340lv\357L\266\0032S\353\234\304f\317\2141\353\206\343oe\2331\266k\310!7\377\005\244\007_\351\b/@:\024\313\262\224\337\236Y\314\365^k\373\032\204-\241\317\024\317\242\201\345Z`\333S\352T\003\200\b\252\253\342{\374/\364\\\004\3449#\035\t1\374\305/\b\355\244\033\215l\230\205\261\233\253\367\\\204N\034\021i\215\355\373\223\203\245'\016q\370\373 \027\362\007\230\003\203\201\310\036FR\236\210;\333%\302\007\204"
+	.string	"r\031\275\325\327\341\306\343\364;\274\340>o\033&\333\267\350\323bc\326\021\303\346\027\256\353Z\326\254\320T\363\351\233}d\224\210"
+	.string	"\276\277\256\272\210\323\346\221H1\257\246\264NY\244~I\031\252v\262\346\244\344\225aSR\334:\356\317\230\\\273\224\"-\210\363\0373\2110\260\325\346\224\233 \233\202\316\222g\347\220Z\001\035\270|g6\211d\f\002lEV\303d\373sL8\177,\320\272\322\233\336ou\267]#\365(M4\365\3125\341\016\256*zQ\336\372\236\273#\232\004\323\327&y,b\035\024\007\275?\326\2058\243$\\\227\327\244\353Z\252\020\217J\345qC\233b\217k*\243mk\274H\307\347\033\n\017?+\370(\301\255\375\233\301\204\270\235.9\272\211\226cS\336j\177f\302$\254\036\\\302\334\204\304\030S-\342\306`DY\027QY\272\340p\360\f\0310,\307\037\b~\367\f\b\0038\330"
+	.ascii	"\252\333\327\314.\372\bEV\252NgOz:V/I\031ya\300\222\370\013\004"
+	.ascii	"\372\343\222\t\f\336\204\223\267\305\310p\343\330\330\227e\351"
+	.ascii	"\207\300}\241\215SU\246\351y\214\334_#N\024\247\350x@q\374\311"
+	.ascii	"\026)\327I\201\2176\247\030\243\360\211WE'\375\233\346\372\324"
+	.ascii	"\327\r\332m\252\325\"j\324\264At\202x\233\021HS\222\266\205A"
+	.ascii	"\255\300\335\037\204\375[\366\250\305\323g\373\245\314P/\257"
+	.ascii	"m\217\007\255<\243\t\201\300\305\021\213\301U\216\004\021\270"
+	.ascii	"+f@\302\\6\0075\346w\234\260\303\306\305\2101\027\243\236\331"
+	.ascii	"\346_4\200%8bj\316O\306\335\303\346\334\204\326x\244I\f\260\020"
+	.ascii	"W%\211<\002\255\206\333\222\271\364\027\321\364\255\002\3538"
+	.ascii	"\200\271r\243H\217\336$|\231\311d2A\302\244\310\1776C6\032]\351"
+	.ascii	"`\271\331\215\031\335\321B\026\006\257\0200t\260B@\277\"\264"
+	.ascii	"\367\274E\337\373\300\337\266\315\334\337\346\277\2044\r\343"
+	.ascii	"\263\302g\354\345\343\001\037\300\373/\365\320\376\036\022\215"
+	.ascii	"bg\211\365/\303\315\t\355e\225c\356n\t\346Sk\236\\m\276\037\372"
+	.ascii	"\360h[\272d\264\3461\276u\257;\235Ay\255\357\275;\343\221\321"
+	.ascii	"c\246\366\275t\307`\256\230\374\330\360yh\317M\247t\f\340\227"
+	.ascii	"\366\363\306j\272\365\312Ro\177\354m\367-\373o\240\203\261\226"
+	.ascii	"\3379'_d\ty\265\035u\334\007\374\321\356\227g\307\234gsm\311"
+	.ascii	"~\312\300\037\016\034\341\334\032v\034\262\364\007\362\036\300"
+	.ascii	":\250}\366\232w\013}\301\344L\030\016\201\177t\342\225\335P\260"
+	.ascii	"\256'\257\351\026\317\220l\340\273Y\333\005B\313o^\360@Q\036"
+	.ascii	"{\277/f}\276\251vB0y\237\025a\026\377\274;\361\344IS\314=\322"
+	.ascii	"\375\214`\262\364h\250\253\241p\302\262\301\370\276Cq\352\361"
+	.ascii	"\377.\306\237\233\207\336\375\365S\217\303\334#\207\2710\332"
+	.ascii	"\033S\310e\205s\216C_w\276>\233\346\374\2149\330\365\240{\025"
+	.ascii	"\237\316\360\205\374\223\306\242\360|\251\216\325\376\205\371"
+	.ascii	"\344\345\032\353\373oYp\033W~\270\275\240S\036\263\200\006\270"
+	.ascii	"\234c\253\237m\266\327|\345\374jY\335\300_u\333\326\232\305\277"
+	.ascii	"\224\f]\001"
+	.text
+	.section	.gnu.lto_.symtab.a97c749412de6111,"e",@progbits
+	.string	"pgResetFn_accelerometerConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\001"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\210"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\001"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\024"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\002"
+	.string	""
+	.string	"resetRollAndPitchTrims"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\002"
+	.string	""
+	.string	"accResetRollAndPitchTrims"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\002"
+	.string	""
+	.string	"accResetFlightDynamicsTrims"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\002"
+	.string	""
+	.string	"accDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\002"
+	.string	""
+	.string	"accInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\002"
+	.string	""
+	.string	"accSetCalibrationCycles"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\002"
+	.string	""
+	.string	"accIsCalibrationComplete"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\002"
+	.string	""
+	.string	"accUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\002"
+	.string	""
+	.string	"accGetAccumulationAverage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\002"
+	.string	""
+	.string	"setAccelerationTrims"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\002"
+	.string	""
+	.string	"accInitFilters"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\002"
+	.string	""
+	.string	"accelerometerConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\002"
+	.string	""
+	.string	"accelerometerConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\024"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\002"
+	.string	""
+	.string	"InflightcalibratingA"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\002"
+	.string	""
+	.string	"AccInflightCalibrationActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\002"
+	.string	""
+	.string	"AccInflightCalibrationMeasurementDone"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\002"
+	.string	""
+	.string	"AccInflightCalibrationSavetoEEProm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \002"
+	.string	""
+	.string	"detectedSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\002"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\002"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\002"
+	.string	""
+	.string	"saveConfigAndNotify"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\002"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\002"
+	.string	""
+	.string	"sensorsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\002"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\002"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\002"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\002"
+	.string	""
+	.string	"alignSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\002"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\002"
+	.string	""
+	.string	"fakeAccDetect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\002"
+	.string	""
+	.string	"gyroMpuDetectionResult"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\002"
+	.string	""
+	.string	"gyroSensorBus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a97c749412de6111,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,177 @@
+	.file	"adcinternal.c"
+	.section	.gnu.lto_.profile.94feeba4bde5642,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.94feeba4bde5642,"e",@progbits
+	.string	"(\265/\375 \033\275"
+	.string	""
+	.string	"\210\017"
+	.string	"\002"
+	.string	"\356\346\366\357\t"
+	.string	"\001\240\342\234\212\n"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.94feeba4bde5642,"e",@progbits
+	.string	"(\265/\375 \021m"
+	.string	""
+	.string	"8\005"
+	.string	"\001"
+	.string	""
+	.string	"\003"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.94feeba4bde5642,"e",@progbits
+	.string	"(\265/\375 2]\001"
+	.string	"$\002&"
+	.string	"\001"
+	.string	""
+	.string	"\003\200\200\200\200\002d\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\201\200\200\200~"
+	.string	""
+	.string	"\006\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\334\034c\003m"
+	.text
+	.section	.gnu.lto_.jmpfuncs.94feeba4bde5642,"e",@progbits
+	.string	"(\265/\375 \021m"
+	.string	""
+	.string	"8\005"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.94feeba4bde5642,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.94feeba4bde5642,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.94feeba4bde5642,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_getVrefMv.3.94feeba4bde5642,"e",@progbits
+	.string	"(\265/\375 \332%\006"
+	.string	"B\313*1pM\322\001\240\253pQhE\277\367\312\220\355\202\r\376\006\375\004\366u\263\307\321\333)\273a\006\222\004\377\377W\345\260\017\213\304\212H=\331\204\354\235R\246$\205\311\301\212\342&T\302\244\021\276\350\252\250n2-(\005\243J\006~\f\025T\312{P\243\271g\231\201\221\313V\340\300\036\354iY\254\302\276\263,c/H#B"
+	.string	"\262\033\261)\331\220G\203a\273bG\276\3067*\226k^H\264\216\017\b\017\222\335\251"
+	.string	"\027h\177\326\003\332\037fq\371%\375s\334\311\240\330\\0\226/\baw\275.\230\211\233\335\366\201m\265\335\020\b"
+	.ascii	"2\003\356\231\301\300\341\273\206O#Z\026\202\fw\305\324N2"
+	.text
+	.section	.gnu.lto_.symbol_nodes.94feeba4bde5642,"e",@progbits
+	.string	"(\265/\375 '9\001"
+	.string	"#"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\003\177"
+	.string	"\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\005\002\001\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.94feeba4bde5642,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.94feeba4bde5642,"e",@progbits
+	.string	"(\265/\375`~\002\205\026"
+	.string	"Fm\237H\260\032m:|11\256/6\250<_H\241>\302\305\230\250m\3522&2\004\330B7\013\302\0048\370\277-\377\2205k\373D#\312\266\r\365p\217\327[\036\003=\205\f[B\312\372\234`\2262\251Y\020H\t\021\231\002\201"
+	.string	"\200"
+	.string	"\213"
+	.ascii	"\013~\231I\036\21126\312\253\366\342\325D4\267\376?\020{\345"
+	.ascii	"0\017\253\215@\314\037\310K\304\037!\254\265\363\330Z\250C\366"
+	.ascii	" \240\037\301\353\037\373\303}\355\177\370\177\206\224\325\277"
+	.ascii	"\006i\234\305b\377\f\003\261\313B)@\377F\313\022\245"
+	.string	"\034\321\034&J\212\021:{\213\032\356\030d~\366\243\223\364\320\220\350A\377\267\2137+cp\3318tc\266\237\3306\262M\305\366\226\246ij\233\201m&\366\306\"\344K@g\257Wf\327d\017\330\230]`\233{LM}(\344\305\373\001E\264\261q\266mn\333{\342\027\313\327\223\245\222\013\364,\377\"\031Gu\274t\364\374a\3467\361\365%\351\260\263\364\252\270e\254&Yz\025\311\303\314p\177\222#M\fK#z\206\245\261\236\345a\017w\204\025}\204\231eI\250\236\344\210\212%iD\317r\226\304J\025\005#\354/b2\221$\325\306j\376\350_\032\320\311N\274Jv\211i`\365(\r\226.7h\033\347==\257\251\253I\3234]Sg\263\005:nax\336!K\304[dh\213\254\321\346\374u\005G\212\310K\013\032`>Cf\2221m\004i\371\3425\262\037HX$\002~\"\377\023"
+	.string	"\350A\004\204c\343\266.\321\016\335l\221\367\310\242\226\021k\255\331z\204Qrd\343H[\240\333\226@g\017\236\367\246\213I\323\275\351l#\036Q\364K0\312\363\215g\333\333]$\377\303\220\251\017\026\201sa\203\005\r'\327\347\003\366\270\\\037\036@ \241b\225\340\371@\026\217\211\317\325Z\241\241\306\n\314:\361\201'\027\213\005\236\002\270>\244P\256\325\017\n\317\023&\360\330p\310P\301S\341\224\350Y\201\237k\365\243\002\321sj\201\254\326\352k\235V?=&N*\260u\302\261I\201!\304\007vp}>4V\375\200\337\352\363\361\034!\345 \245\243b\306:;9;9\235uvP\250\235\024\312s\n\025C\363\016-m\237P\240\235\333!\344\"\210\320\311)\rJ>jB6n\231l\223\0352m\036"
+	.string	"\257\314\367\301\244\022\355\276B\240Y\003kU*\232\201E\236#\246v\034\236\316Z\243n\027iC`\314\212\256\007&\345\212/*\016\027\241'4D\024>\341"
+	.ascii	"ICc\204\033*\312\310\016\265\275\024,7eq\355i\343ff3\247\263"
+	.ascii	"\240\214\001"
+	.text
+	.section	.gnu.lto_.symtab.94feeba4bde5642,"e",@progbits
+	.string	"getVrefMv"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306"
+	.string	""
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.94feeba4bde5642,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,831 @@
+	.file	"barometer.c"
+	.section	.gnu.lto_.profile.a7980be5f79c71ee,"e",@progbits
+	.string	"(\265/\375 \ri"
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\013"
+	.string	""
+	.string	""
+	.string	"\027"
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.a7980be5f79c71ee,"e",@progbits
+	.string	"(\265/\375`\320"
+	.string	"\275\b"
+	.string	"\244\013\304\001"
+	.string	"\037"
+	.string	"\321\372\207\244\007\024\002"
+	.string	"\002\001\002\002"
+	.string	"\001\367\255\350\337\016\n\002\003\002\003\002\004\002\004\002\003\002\005\352\263\360\321\b\003\004\240\342\234\212\n\005\205\320\323\240\004\016\003\002\006\006\007\b\t\262\373\300\277\016\002\002"
+	.string	"\002\007\013\200\336\366\230\t\030\002\b\002\t\n\002\t\003\013\002\013\002"
+	.string	"\002\f\r\002\r\002\002\002\t\f\r\016\017\020\021\022\245\256\360\274\t\002\023\200\333\377\224\002\024\025\265\372\210\203\b\026\350\300\306\254\005\002\027\317\316\276\351\002\n\030\346\263\306\373\b\022\002\002\f\031\032\217\217\254\356\013\024\003\002\003\002\003\033\364\201\355\242\016\034\035\371\326\366\371\017\036\037\240\342\234\212\n"
+	.ascii	"* `\202b\223v\316\304x^\b\0311VP$@\021+qoe@\233\225<\230\364"
+	.ascii	"@\2450\232\031(\"\200\342\214{\315P\255\242\344\302\025/3o\267"
+	.ascii	"\n\373I\326\356B\330\362\213n;#\013.\316\234\300j\222\345$\216"
+	.ascii	"k\266b\370m \320\237\265\362j\201J\030F\025n\b"
+	.text
+	.section	.gnu.lto_.ipa_sra.a7980be5f79c71ee,"e",@progbits
+	.string	"(\265/\375 |E\002"
+	.string	"\022\304\n\022\240\2510\034\377\377\377\237\342\277\271\357\372I\"\366\226)\257\342\211\0261\017}\206Y\220;\016\n\241\201"
+	.string	"\227\232\036CNUp\021\n"
+	.ascii	"UE{B\bH%\314\231\020\312\216\240\262\377YZ\345\360\213\035\033"
+	.ascii	"\300\002"
+	.text
+	.section	.gnu.lto_.inline.a7980be5f79c71ee,"e",@progbits
+	.string	"(\265/\375`~\001]\n"
+	.string	"\266P970\217\222\016 \034\016Pz\022s\323\363F\247\313\310]\353\244\203U\305\fr3\253a\203R\001\177P\017K\030\021\311\243T\234\270@\034\324\201\276\350\203\277\2505\"w\n+"
+	.string	"("
+	.string	"'"
+	.string	"\317\203\265r\001\235\275y\244ffb\336T\220\227\310J\350T\325\211E\305g\274\245\347\371R[\231\251\351\243\351efr~s!\002\034/]\367\214Edf\352\261\277S\304\300N\035\376\fG\230N\037~\243\251\031%\032#\231\001\346\272g\320\177+\216\343)Hz\240\277\217\331\002s]\246&\254\025\213\346\200\377d{\260\271\356\375[&\352cC/2\023a\355Q\353c\013O%?\027\311\004E\202+e\343\343\340\202\237\3538\330\251\255\314\224B\377\241\332\221)1Z\364ZQZ^!\033\252\252\314\034\230 \304\320\366\003* `\002!\201\252\036R\003|\026\2420Y\210EV\302J\001t\021\203!"
+	.string	"\313F8u\315:'\362\206\026\261\013\206\310@?8XEH\271Q\f\031"
+	.ascii	"\2013@\265.\214\202\243m\320R\367\036\001\373p\f\035\214\333"
+	.ascii	"\242\033YZGp`\225\335\207v\360\327eg\215-0r\035\354\2707\201"
+	.ascii	"XCsn"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a7980be5f79c71ee,"e",@progbits
+	.string	"(\265/\375`\300"
+	.string	"-\006"
+	.string	"\002\212 &\220+\035xV\177\356\242\002%W\353\316\266\013\314\231,\241\215\3214\355\237@\311'Qi\021\001\323\337Fr\247\224\002\255:\346x0\027\254u\274\367\261`Xeq\354[\252\235\332D\205h%'\036\272\025o\300\376\301J\352\2152\275\241\225\336\330\032? \2216\332\233\320{\357\271vPDK\334\017\t\232\356\023\037\335\322\263\360d\330n\200\364\345\354\313\335\235\034\263\0323\327\360\366\310~6\273\204:\023\032"
+	.ascii	"F\271\030*\n\\<\bF\205=\"\320\362\230\230\2525\312\230\003\353"
+	.ascii	"\240\255\234i@\271Z\025$\250\340\202\021\341\346>3\r\301\024"
+	.ascii	"\3608\334\245V\177\032\333i[\300\202\230)**W\026\300\r"
+	.text
+	.section	.gnu.lto_.pureconst.a7980be5f79c71ee,"e",@progbits
+	.string	"(\265/\375 )I\001"
+	.string	"%"
+	.string	""
+	.string	""
+	.string	"\f"
+	.ascii	"\232\004\001\230\004\005\230\004\t\230\004\013\230\004\022\230"
+	.ascii	"\004\023\204\004\025\230\004\026\204\004\027\230\004\030\230"
+	.ascii	"\004\032\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.a7980be5f79c71ee,"e",@progbits
+	.string	"(\265/\375`\320"
+	.string	"\205\006"
+	.string	"\362H\032#\220\265\031\016\377\377\277\326u\355\377\377\377\377\377\277\272\235\321o\335Fm\341\377\253a\372\372\326O\215$\231\002z\262\234\312B\267\322+\226@\254\327\250\373\303\364\234$g\327<\233\231\335\3329v\215\021\245\223\002!\212\026\200e"
+	.ascii	"Q\3241O\306\210\016zB\273\347\371\274RTUM1\006\254\253\201\316"
+	.ascii	"\351:O\301c\032\234@. `\002)\350\352%\201\300r)\210 \207r\335"
+	.ascii	"\334\200\373\202+r\344V@\251\034\276\320M\207I\323\025\210p\341"
+	.ascii	"\245\ftP\301,\2307bD \227\003\303\025\235\360b\340\240\345\273"
+	.ascii	"\266Q\307\322\\\263)\255?\214\2417\221\323P_\357\2103\206:0\275"
+	.ascii	"\214\205/\256\177\201\325\"\322J\361\264\003\267\260(n"
+	.text
+	.section	.gnu.lto_.lto.a7980be5f79c71ee,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_barometerConfig_Registry.14.a7980be5f79c71ee,"e",@progbits
+	.string	"(\265/\375 \230]\004"
+	.string	"\324\007_"
+	.string	""
+	.string	""
+	.string	"-"
+	.string	"\005\001\212\001\202\200\200\374\342\303\265\377\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\304\007us\350\326\006uq"
+	.string	"\005\001\006'\001\016&?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/sensors/barometer.c"
+	.string	"\004"
+	.ascii	")\"\301$\032D\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_barometerConfig.15.a7980be5f79c71ee,"e",@progbits
+	.string	"(\265/\375`\204\0015\f"
+	.string	"\326\224OE\020kl:\0205\2779\226\023\220\374\357\2502+%W\330j\213\025\320"
+	.string	"\226\243\351\n0e\215!\254\016\215a\224\021-\240\021\342\261\203\007"
+	.string	"0\230u!\f\013("
+	.string	"9"
+	.string	"\205\002\246fc\374\312\032mDvJ\0019"
+	.string	":"
+	.string	"A"
+	.string	"\033*\354\242\031\326P\336\031\375\305{G\271\205\367\316\245\335!s@\202\203\t\226\356\356\307)x\371Z\372o\360\312)Ez\235p\354\256\353)\205\340\346n\033\303\366\206]3\001\0050\254\005\357\374\221\367\256\203p\252N\020\245z\263QR\345\022\330\227\354\356\232[\331\177\375u\202\023a\212\200\261\355\242n#v\326\305\030Xl\277\332?\357*\377\032\275bw\0252\232\315\344\034\203\207Z\354v\347\027h5\323"
+	.string	"n\241\322\n\221\336s\n\"\020\024Ku\302\304Op\231\223\f\002.\341\343L%\262\207<\233<,\024r\232\227\213<{\300\037\210(\273\253\341; \020\234\316\310G\354\2400\250\031CP\350\021\307\215\310G\216\"\371\t\311\357\323\331x>p$?\315\205\305"
+	.string	"\341\370\201Dq\374,\350^\262\334\312\036\037f%\316\200}\320\2637\327"
+	.ascii	"\266li\370  \020\203\221Ym\005\256\",\336_F\303\300\246\016\354"
+	.ascii	"\372\016\331\234\371\315\221m?\333E\030\t%\223\313\361\"K\322"
+	.ascii	"\303\\\3167\255\021\034\250K\013\023\221\016\214\023@\255p\036"
+	.ascii	"\262\203m\236)q\207\027-#\003"
+	.text
+	.section	.gnu.lto_baroDetect.22.a7980be5f79c71ee,"e",@progbits
+	.string	"(\265/\375`)\001\005\016"
+	.string	"\346\232_C\020\221\223\016[\305\234\216(\022\177"
+	.string	"]\243\021\321\307\224J"
+	.string	"$\345\243\024ou"
+	.string	"}\373]\277\273\265\336\312\240\b\001#m\001d\022\254z\f \237\260\251\372E\303\347!\215\322\337\254\227m\020F\366\2262\245L"
+	.string	"G"
+	.string	"N"
+	.string	"\273^\003w\256G{7`=^'`=\332\366\207\203\220E\367N\240\\\005\304\211\213\314\256\227\251\211\213\0165E\276\0065:,p\205\007R3R6\250\022T\020S\302\206"
+	.string	"\224)\023\200gw\235'T\210;\3366\004\333\021\354\213\b\251*\366\341\356\256Ue\307\264&\2461\247\257\263\334\360\253?a\372\033\023O\006\307\002\035\273(\337\314\322\2102R\330\016\331\033\333\352\235E\350,&\306vI\300|\\\217\t`\246\375\025_\t}\345\341\234]\225\n\030\001\243\033yZ\006\366\214\222\307c\344\210\031\241/\2614\026Z`L\271\303\003\276\357\373^ba\252Q+U\312\317WL\235'=\234\341/\240k\327\364\300wy\213\315G\361\350\r]\376\364\350w\326\343\365-\317U\312LjeE\312\317\366J\001ZWa\243\240q\237\016!\334g\002\207\203\026\242\006\351p\032\211\006\332\270\317\205\254\343\266nD\353\262\021\221\017(\003\341\272\254\203\300\233\006\215\313H\266\215\3136\036\351\252\222P\303\305\313\213\364E\026\324\017\266\241\332C\322\022\f\220Qm\f\"\371\323\3451i\031"
+	.ascii	"A\023\320\302\001C5\2433@\255\267ef\357W\235\264Z\302\027\270"
+	.ascii	"\032\022\203\261\002]v,\200\331\222Da=\273J\300]\343\276\"\334"
+	.ascii	"\314\004\007\302gj\024\\\26645\261\345\364\273\235e"
+	.text
+	.section	.gnu.lto_isBaroCalibrationComplete.23.a7980be5f79c71ee,"e",@progbits
+	.string	"(\265/\375 \375\325\006"
+	.string	"2\215/3`\213\322\001\320\002. \267\3100\371X-\\\226\267\002\317S\317i\201\331\206\352\025Z;\246{\326\273\036"
+	.string	"\200P\314]\0078F\315Z\003\337\022\"eJ\001\256L^\3034\213{\024\005\006\237\203\227\006\331e\201ba\225\007\331D\300\216\241=\206q\3561I\334\253Hu\240\243\036\373\031\310U\365\237\222\347\244_d\374\t7h\362\326)_\0039u\005x\350\344eGNj\204\375iUd;\255\231\376\024P\301\201p\355\202\256\217\335\240J\024\2667\266\304\006\007\033W\217\022\240\2174>\030\036\273\221\351\350\325\263\362o\361\251\203\224a\2058\317H\302\356:\255\220\303\255\267M`\273\3006D\t"
+	.ascii	"2\001#8c\216#D\250@\\\023\037#\362\022\"\207;gj\347\023"
+	.text
+	.section	.gnu.lto_baroSetCalibrationCycles.24.a7980be5f79c71ee,"e",@progbits
+	.string	"(\265/\375`0"
+	.string	"\215\b"
+	.string	"\346\220>:@\345&\035\340\275~\310\331\264\354L8!\202\264%\353\376\177\234\177\275\226,\240\261\rY{C\215E\334\326\351\334C\226_(\243\203\254\013\013\373K\222\223\230\327\210l\262wJ\001,"
+	.string	"."
+	.string	"-"
+	.string	"7\270\036\315\331\252w {\024\026\214\223\227\335\225\360\343\334\037\347\237\344\003#R\350/\240aw\375F$\215\033\336\266\202\355\007\333#\001\260d\037\365?\213\300\324\302\340\262\233\261\n\260\251\250\"b\373\030\333\357\3317\375\304\035\005r\334\345XI\331\355\026\234\021x,\370\301\365\370\002\264JL\267\267\026\226\fqJ\211\340\205\037\364Kn\002\362Cl\361y\037=\372\237\3531v\250"
+	.string	"l\210\336\312\356B\017z\330\267vw\035\022\263j\025\0243b\233\233\354\343\320\241\232\007\253\032m\203e\b\3162uz&\207VL#\267J\267\316\334dG\30382\253\233\314$\230N\314*=4\007"
+	.ascii	"2\241}/pq\241\304ehb5\032\334\345E;\311"
+	.text
+	.section	.gnu.lto_applyBarometerMedianFilter.26.a7980be5f79c71ee,"e",@progbits
+	.string	"(\265/\375`#\002\315\022"
+	.string	"f\243~H\3200'\035\360\204\247\310"
+	.string	"\244(\355\342\254\335\262r\034N\23616g\375\354af\f\335\314{Q\366\274\262\177\274j\030a\005\306T\340\211\021\217\3410\262W\341\227\tO9\360\037\352\320\332*\325\220\364\355l#{\313\235Ri"
+	.string	"d"
+	.string	"l"
+	.ascii	"\265v\240\201\253\265\226\330duj\333\037\361 \031\313\346\315"
+	.ascii	"gd\335<\335\030\341\250\265\272B\016\322\235\316\017\350N\267"
+	.ascii	"\347\262wt\256\224\3713\357P\220j\210\243\206\3239\022\325B\252"
+	.ascii	"5\332L\220\034 \021\203\234:\3379B{\241\323\032g\023$\206\207"
+	.ascii	"\247\023]\342\2145R\252Nj\255\226\342\230\341V\335v\004\333("
+	.ascii	"\266|\020\022\312\206V\363\242\233\260\222\377\343\nN\222\027"
+	.ascii	"O}'u\247_'\236'\232\320\006\032\231\263o3rm\366g\335Z\353C?k"
+	.ascii	"e\351\371\333\275\235\264\244\322\3778\260D\333\351\201Z\031"
+	.ascii	"\267\232\223\333Q\227\250\213\017\277}\312\225RN[\306"
+	.string	"'\262\207\355\233\225Bf\267:& \201\024Dr\352\005\362C2\003\b>SQ8\2726\237)\007cI\356\321\243\343\206\205\\\355.\216\035vrS\212f\314\344\224qrW\347hw\205\212\311H\004km_\270\nY\201\246Z\253\002\037\305S\300\374\237S[\370\276\3564V\253\321\204v\346\332\036v\376\321O\2040..\335\251\nD.\304\215\003\211\264\245]\233K\276Z\002<6\212\234fr\312\b\376]m1\336J\214\2017\241\005\366r\360\022\343\305> \304XV^^\003\017\244\020\206\036\210\002\343\305\004X\305\004\364^<\330\007\276R\\!\370\2051/t\305X^0\227\n\030\272L\f\370k\361@\327\313\367\201.\217[\375\326\374Qj\262\366D\027\021ik\347\\\237\320lM\027@\276\304\225>\221\246Zi.&\231E\202\274\330\332s\030q9\242f;\023% P\242!\350\366\221\003\316\234"
+	.ascii	"wW\354e+\324\352z\213\352\013i\343\024\r/`\002\370\013\237V "
+	.ascii	"`H\222\017\341.\031b\370\006\211\342@\006\034!\237L:\264\216"
+	.ascii	"qs\340.\024\2767\\C\201c\271\022\334\3407{\020(\t\007\025+\263"
+	.ascii	"\342\315Q^#\342\313\036cJ\321\241"
+	.text
+	.section	.gnu.lto_recalculateBarometerTotal.27.a7980be5f79c71ee,"e",@progbits
+	.string	"(\265/\375`\251\002=\025"
+	.string	"\266\347\214K\260\324Q:\270dF`\362\222-\032\301\222=\212\025{\005\035\002\036\027\202\366\335\237\301\035#\310\026\247\356\236c\364Kd\262\332\b\301\354R\217\033=C\277\303\026\230{/\354\364C\263\370\306\036?\306j\371\321\232m\237\020\"wJ\001w"
+	.string	"l"
+	.string	"x"
+	.string	"\242Q.i\251\326\272\342\006\364A\235\030\240\362~>$Xj\0338p\363\242\n\336Z\177?\226j\r\256\230\205\365\321\266\217\342)n\254\023\203A>"
+	.ascii	"B\036t\204S\265\006e\003\216B~\024\037#?n\210\353..\325\371\027"
+	.ascii	"^$JR\352\371v\027{\276\"\201\337\215\236\022\037OD\321\361\003"
+	.ascii	"\344\302\323\035_\016\245+\005\265V\323\236O\303=\3366\003\333"
+	.ascii	"6\233B\005C\276\271\211\276\367\321w\023\371\361+\0018\364S\341"
+	.ascii	"\203C\253\354\340\216.\320\276X\027\310>y\360\216=\370\233\334"
+	.ascii	"\350\207\275\350\177\271~t\267V\324\254\245^\255\250\311\245"
+	.ascii	"\036\227Z\\\352]j\272\324Oy\007\020SR-Bj\305Pe\244>\215L$~t\222"
+	.ascii	"\216t\355\033_h\022\333G\036\262v\031X,\204\202\242j\255*\037"
+	.ascii	"=!\033[\212c\\rO\3412r\254\341\270-&\234\030\342\266v8\235\360"
+	.ascii	"\331\265m\3410r)=j\255\b|\245/\315\374\241\217\256\241\321\310"
+	.ascii	"\217\343\2607\344Eak\303\304\320\367v\251\024\207J\025\305\333"
+	.ascii	"\235\270\300\313\220>\322_\310\324L\223\3748\232\230AD\344#z"
+	.ascii	"\277\247]\240]K\327e\205\017\036-\342\327\322=\221x\350\034)"
+	.ascii	"\360\257ki\220\013\277\234\267\270\013\017\3756\345\213\255\005"
+	.ascii	"gS\332`0\266\230\227Y\371\300A\256\264\231\314\314pf\204\362"
+	.ascii	"\254\271\335\312\223\346\205\263\325\230\013\312\031\232\332"
+	.ascii	"\f\002\3144\226\263\304\2255\363\234\271\310n\247y\263\2257\231"
+	.ascii	"-fV\223\321\316\233\214E\200M\232\362\224\341L\363\224\221\004"
+	.ascii	"\353\027\310\207\332\340\264*'\021\022\241\243D]\333\332\035"
+	.ascii	"\333'[\302\303\363\204\2639n\255\215\025/\007\225\017kc{Rb\265"
+	.ascii	"\254\231\327\310\261h\254\250\230L\226\f1 \240\"\031C;TF\222"
+	.ascii	",]A+(mk\315C\026\b\021\242\263\262\354\345\f\343\333\023\007"
+	.ascii	"\n\365\r_\214\305\t\204\272F\007(Ky\331\262|\270Bj1\315\231c"
+	.ascii	"r\316\326j\223\302\020\034\237\355\205\271\335\001\371G\225e"
+	.ascii	"7\353\221\340*>\306\250-\237\306\002n\246\216\225\007\210\325"
+	.ascii	"\032\302\205\201\307\233\215\351\235\f\024\3055c\323\350\024"
+	.ascii	"\r\356\001"
+	.text
+	.section	.gnu.lto_isBaroReady.28.a7980be5f79c71ee,"e",@progbits
+	.string	"(\265/\375 \352}\006"
+	.string	"BL-3Pm\222\016$\241\212"
+	.string	"\020\306\202b4\341*@pk\315\005\377\226\354\252\375\273\035vm\204R\007\357\31513C\344t\221\3368\321\231:4\246Y\262e\ng.o\342L\032\3670\013\215z\216\332LT\3330`4-\363\250v\031\3305L\257q\234{\315re\331\b\031\001\210=|9\332Q]\214\035:X\253\322\355"
+	.string	"TB&0\001\302\224\277>\310(\276\225d\243\037Gf \322\022\224\314P\312I\222H \031\277\347-#$x\256zY\204z\021\002\341a\222y5V\321\252X\335n\264\242\3611b\211>\305"
+	.string	"\205\314\034-\221Dg\375\013\376\203?\"\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_baroUpdate.29.a7980be5f79c71ee,"e",@progbits
+	.string	"(\265/\375`\033\002\305\020"
+	.string	"v\235kG\340\322&\035\322\254Q\310\344\002"
+	.string	"\033\310\276}\0313O\237\252?\013\004\324\314\222)\247\b}??\345\340\230Y\333\361\020\3502\246KCo{\307\373<F1\314;\034\004\203\033\037\320\235\230\027\304\233\272\242%{K\231RT"
+	.string	"O"
+	.string	"`"
+	.string	"\267c\354\222\337\342.b\334\2123Y\310\371\354\220\3411\232s\326\035\270\tw\031O\200\273\334\024o]\306\325\226\037 t]\216\314<>\347\321\350\247\007\fg\276\321\304v\242G)\214\305\0054:D\220\2040U\322\312\234\323\n\206 n\356\266#\330f`k\210D\024\210\310fb\327\346\032\270\357\003\0361\035b\377\305g\236\177\343\r/z\360\322\177\341.\277\317\271\322\210pF\274\364f\317`\2726\366\343\\\024\266\325&\253I\234ZJu\214\352\215j]\365INH\330 \334\346\364p;\2325\031\264B5\036WC\262(2\002\"\304\222\022\244J"
+	.string	"\264\026\376CCU24cW\322\212p\006\350u.\203\005eh\316\327\301\030*\0042\037];\250\211\255\313\366\351=\250\023;u\030\252\222\2419g\203\235\363\264\3707\227\306\260Zq\227\272\222\026D\210\316Ko>Fd\363\303\234S\201"
+	.string	"!\0335\227\006F\251|)\230\324\312\373N\027:\326\347\261\\R\254\316\245\345\264\352P\037\253SI\261\227!\365u0\236\367u\245\331\3531J"
+	.ascii	"?JtX\323\222\226\203m\322z\345\2650Y@m\t\023\364\240\334]WM\321"
+	.ascii	"U\2004\265\350\270\246\275L\021\n\317Q\001E\206Ce@v\203\264s"
+	.ascii	"\364\007. \320\002\021)*\017\277\002\276a$\022\316>\341\276o"
+	.ascii	"\205m\253\360\026\\7,\257\334\312\362\240\243@\310v\343\360^"
+	.ascii	";$\r\021\\\036\271^\206=\030\267\263o\247K\333\222\266\333A\026"
+	.ascii	"zQ\002u\273\264\357\365\325\311\264\022\216\271\302\005\234\024"
+	.ascii	"W\261\306\207\2010\364\206\327 \001\005:\210\241WN\355\301cF"
+	.ascii	"\323\036("
+	.text
+	.section	.gnu.lto_baroCalculateAltitude.30.a7980be5f79c71ee,"e",@progbits
+	.string	"(\265/\375`Q\004\335\033"
+	.string	"\2264\263J\260\226Q:4G\260\023K0<\354F\r\202>\006D)\030\215\273_)\003\2027\240!N}\311\251Lk\033\263l\030\031\330q\005}\345mFo\017\315W`\314\261=fW\"\205O\221\221\203\237@\307D%mo\"\245L\001\227"
+	.string	"\220"
+	.string	"\242"
+	.ascii	"\237\223\037N~\207|n\376\016x1ib\341Wk\211`\227Z5\211\300X\337"
+	.ascii	"\356\277_\035+\365\217\007\261Qo\244\037\215Z\353\270\363\007"
+	.ascii	"\361\217;\367\017\361\205\372\270>R42!\362x\221\"\253\326Z`\347"
+	.ascii	"e\342\316\357\215\305\021\342d\030\325\242G_$\035Mi\251\265\316"
+	.ascii	"b\253Cw\206\213Cw6\213%w\206\315\344\267\245 \034\242$\013\257"
+	.ascii	"g\264\023i\303\230\036\322\266\253\267\013c\265\326\205Z&\321"
+	.ascii	"\3231\267\024\324Z\317\274\336\211=\335\377\024\376#\370\303"
+	.ascii	"\031\001\334{\344\312\267=\326\207Pm\303\006\272s\333\200\214"
+	.ascii	"\337"
+	.string	"\026\256\265\032u3\rQ\240^\250\265\221\212\242\303\212\223\253\035s\371w\307N\r}\233\316\301\306\313\333\371\265\321\235@\275R\3135\224\252\224r$\3458\370G\351\270\231\376\rk\255\365\275\364\237\037$\362\201b\353\333\303&\377\247\305\367\241\374\036\312\347\241\374\035\312\177Q\276\016\345\347P>\016\345\337L\276\215\310\257\241|\232\311wM\376L\213/C\371#\345\307P>\f\345\213\224\337j>m\016H6I\003\007\017\036\320\235\256\036\231\250\266\370f\032\326\261\336\322IWd\215\220\020\"D\240;gzR\241H\222iX3\225\036\036\373\2270\201.O\246c\273\243\245\030\262\261\331K\371\004\323\377m\255\225c:\264*\235^\374\337Ja5\255\350\"\366O\241\002]\036L\307D\264\321\377[\246\037\271Z\237 \030\254\332\325\232\013j\265\330!\226\362\211v\253'\260\314\232\275M\233\007X\332\b{\312\266;\354"
+	.ascii	"\300RI\307\301sw\357\321\227[X!\027\304Zw\007\276@6\b\206o\323"
+	.ascii	"\316g\240\321\350\316\037lE\031\212:,\270\341h\f\306\013\311"
+	.ascii	"p\265\242\232\355\206\243i\230\021\341nD\036jD3\017C4\333L\b"
+	.ascii	"G4\223\301~\373P\303\315\212n7\334l\214\312mX{)\250c\271\326"
+	.ascii	"}\n)"
+	.string	"^\005\365\024q\244\206o\026\330(P\246\225\021\032W\302\377\364\023\322%\305\311\362\252\370\364O3\226\036\037\236\316\351\236\356\251Ri\247u\232\247\005\274v\032\346\245t\322a\335\364\253\t\b\211\265N\003\260\322\215PQ\205\205\32397M\3238\275\345\223M\3374\005\226Y5mC\346X \t\265\244\246\227\312\205\253i\272\275\224Y\013V\t)\326Z\017|\003M\250A,\005\021rH!\2238A\022K\213\001\200\002\031A\232\333\021 5t\020\231\302\334\016b\244/y9\025e\323\374\347S=\353|\244\002\235\344\360Im=\310\311.h\226\267\034B\367\213\224\031Z\240\303\355\322*\226\210i\bH\225,\273m\214\374}\004\203\231\214\201\036\354w\004b\370\232]\"\337b\302H\025,)b\005\035\236@\0272H\373_\031\207\263U\350\027\257\361C\2110\255}\300\323\241\322\004\201\304\242g9\214\354\235\270\207"
+	.ascii	" &\232\200Ba\21738\007\357\343w\212\341T\b%\002\312\227\377\337"
+	.ascii	"\333\001\321[\207\251"
+	.text
+	.section	.gnu.lto_performBaroCalibrationCycle.31.a7980be5f79c71ee,"e",@progbits
+	.string	"(\265/\375`\373\002\235\025"
+	.string	"\346f\207I\320\360(\035Br\376H\006$z\347#E\323\371\347\\\214Q\323\005\305\357\237\f+\232Dj\334\217\2363F\355kR\301\252\233\354)\302\035`\310\244$[<D.b\3567\016v\241N\362s\013\350\b|k\215l\222\244L\001m"
+	.string	"h"
+	.string	"s"
+	.string	"_\257v\255\332u\b\256\345\327\340\256\277\353\335\265\016"
+	.string	"\320kZ\2011\247\205qj2I#\020\272j\253h\033\033J\207<L]\361\203\363\3331\347\224\275\203\332\250\004\2776V\rR\326\216w\2432GA\025\312\234\263\305\313\321\203\007zI\030\\\274\034\bk\342PC\203t+\360p\273*\2249\247w\307\273\240\016\325\366\002\333\b\354\317\004v\231\315B\225\362'OB\267\022J\024\341\005\006&\024}d\374\354\365\377\177\272\036nGKP\037\205\372\275\352\200pJB\205b\254<\246\321\254\356TZiB\225z\321iIJ\347\266\243=\204\333\373l\005\347w\354\257M\3025,\\\277v]\262k\022\271\036\221k\021\271\016\221k\227\\\203\354\372c\327\342\327\255\257Y\001=!w\221\3169W\344\340O\027\342\265.R\"(\036\rS\256\333\016VB\335\205\274"
+	.string	"\205\337\330E\352Sq\233\323'\343\310\224\233\363f"
+	.ascii	"\344\256\253\256\347\343 \007\217t7\304\177\\u \215: \361)t\027"
+	.ascii	"\325\272hr\326[\327\237\365\377V\007or\251\244\003R}\025\323"
+	.ascii	"\360\252\007P\222\017\2578=\374@Q@X\315\231K`=\241?\026+\217"
+	.ascii	"\312v\211\325f5\263\030Z\215\245Ef\253\321l23\233L\346\205%F"
+	.ascii	"\346R\263\311b\004L\233\231\325d54ZM&\016\335\364;n\220\201\351"
+	.ascii	"v\234\024\257T\223dc\027\005;\3228jJ\370:,\306\353\322\207\306"
+	.ascii	"\217\316\272\310\321\264\001\274OSB\353\013=JQ\240\242\362s\032"
+	.ascii	"\201C?\354zL\277\257\344\342[L<\345\226\207\321\204\222\253~"
+	.ascii	"3\244tHZ0\0309\311\322mG\234\035\021\261\221\013`\241\013E\250"
+	.ascii	"a<\306\030Q\312Q\345\024)\303\001\240\002\221\271\252\016\020"
+	.ascii	"hHD\031\016C\370\0260\236\373Jk\224\260\333f\321jJ-s\215B\332"
+	.ascii	"\316\376\214\317\fR\231{\332\276\334$\020\350UQ\027\240@|FZ%"
+	.ascii	"W\346f\303\265\036\235\"\364v\261\306\331\026\305\330\255\320"
+	.ascii	"\031\023ZC\033\242\244\177\251\330O-\036\223k[_\257\0256\310"
+	.ascii	"\331\320\276\253\021\347\340Ck\037@?\343nCeP\315?\372\240)\313"
+	.ascii	"\231\267C\262\030\271\233\312\346\241&\334\373\021\241\006"
+	.text
+	.section	.gnu.lto_baroDetect.part.0.45.a7980be5f79c71ee,"e",@progbits
+	.string	"(\265/\375`m\002\005\024"
+	.string	"6\245\202J\320\322(\035\322\300\252\f\207\021\317<\270\332e\306\305\356FI\315\273\221\230\031f\227-\316\034\266\211\365\206\315\213\227\375\375\333\345S\033&EB\200\022pxX\352\201H\017\216]\371F\210\006;\241c\370\201\254E\032\331D\356\224\002m"
+	.string	"n"
+	.string	"i"
+	.ascii	"\347q\031@\2559B2j-\031\234\272D<E\275@x\n^$<\265\277c\223\223"
+	.ascii	"\227\215m\233\234\300\034{\231\2539n\303\214.\251\3262u\272$"
+	.ascii	"\036;\005w\2061\177\326l\262\323E\032\032\001\276w\004:FE"
+	.string	"G=\333\315\027D\325 \2329\331h\340\310\r\004\217\001\266\331\234\004\036\232T\265V\213\036n\323mO\260\335b\317\016\001n\251f42`/\207CER\245\225$\266_\334:P\3468\004@1\224\341w\237\257}\277\034\310\373\363%\325ZO\367[\274\374\335{>\375\360\\F\321x.Qf#\366t\037t8\020\357\363\272\016\006\26545\006Grj\260\347.`\327\301<\244\326\333\216J<u)^$\204\331'\357|\371:\217\013,\253\315\306;\355\2578\013X\017R1\220\253\2656\360g\234\306\005\337\304\251W\310\371\332\251O\206\247\363\016\nO_\333\361\235{\232\335\3509\332\375\210\231K\336_I\304\022o\027gz\005\341\367\275\277\204\216\f\251H\2106\225|\266_9f\255.8\375\3641\027\347\r\017\326\275\331\236^\323\364|\371_L\360\002\004\247\326\232\245\0365\004\375\235\370\317a\004\266 "
+	.string	"\303\230\262cK\002\031ad\255`RX+\b!F)a\215.\343\n\311ZQH\265Xd\213el\245XTV+)\024V+U2b\262ed\245\\H\222\225:}o6\031\375\354|\240\037\013\337\373\203#\240\235o\377X\270\253a\255\212\331\231\367 \215\341\243\006\207W7\307\373)c\243\246"
+	.string	"A&x\224\320\036+\314\327<}7D\264\225y\356/1 P\0021R]\017\306\"\220q(\304\224Dv9sr\177\242a\005V\037"
+	.ascii	"\333\303M7\255\304pw\263F\354\227\314\020\001F\336\200\326\234"
+	.ascii	"\250\017\263\302-qA\036D\212'\354\273\024\035J\342c\305\343\251"
+	.ascii	"\215[x\033\274\201\205\037\032qXBp{H\215i\332\017\211\312\203"
+	.ascii	"G\246\221#\323I\237Y\026\024\310\254\264Dy\240tYi\354s\222\337"
+	.ascii	"\245\360"
+	.text
+	.section	.gnu.lto_baroUpdate.part.0.47.a7980be5f79c71ee,"e",@progbits
+	.string	"(\265/\375`\362\003\345\027"
+	.string	"vi\222I\300\224Nc\373\n\224\n$\002\376\260\223\b\370\273\2236N\2561\214z3a\240\235\206\216\322vh\272D\235PsG\240\024b\214$vB\020\214F\b\030`38k\273\331\345\231\004\330`\347\353\246\314M\310\336[n)S\nx"
+	.string	"w"
+	.string	"\207"
+	.string	"VLR<\353\210\227\350\374\r)\250\n\362$\274>g\002\022/\261c\235"
+	.ascii	"\347oH\346g\370\344\263\274w~\032\300\007)\341\275wv?\310\263"
+	.ascii	"g6\217=\273\205\342\005\331\366\235\376\304c"
+	.string	"S<\177B#U\026\320\224\360\336\223v\313r\224\361V\274\311x[\221n\276R\321\364\251O\250\367\372\340E!\f-\237P\207\323\222\213\344\313\275\327\245\207\333\336\366\002\3335[\244\t*n\005~U\325\f\212|j\317\366\204\247\240I\261k\216\342v\262u\357u9q*\234\277t\353\n6\364\276[\337\246Z,0`T\017\r3a\233g\363\330\\\345\357\006\335\242\213\340\366\301\177\303\225\021\033=\372E\353\221\253x\361V#\273\244&)\251g2jYI\035#\251\313\0305YR\217$\265%\251\305\221\272Zjj\251\237\202B\200\306\275\034\302\216\334\"\033\365\013\b\314\246\210\0171\201\345\275>.\276\220w\231N&\224\0314\203\343-Y_\225\024\305u f\003\030\230\361v\254$\021\251\241\255\266\203\373\350\301\303\326\330\221\024\220H\254\366\203\357\250\235\350\270\257+G\315_r\214M\254\244W\330\220H"
+	.ascii	"\216\033\020~^\313V\276\306\263j16\333x\353\372#\363\031\021"
+	.ascii	"d\304\250\325b\205\001_\314\254\270\270\031hA%\374\312\352v\262"
+	.ascii	"\305\202\016M\350\317\257\230Q\331\272\267"
+	.string	"\347\276\266pk\321\341rp79]\r\005\332N\227\333\341\340v4\034\233\232\033\332M\267\243\265\2548w\001\247\243\345\344r:\332\3146\275x\253\221\037|\t\235U\222\252\3016I\365KO\305\340Z\353\221mY\235\325#\035\314LR\371}\335\006\374\216\310*955\2142\225F_\370\241\251d\2020\231\230\306[\33345\302+V\213\324\037\276\256\003T\254c-\253m\2060\233\350}\261\312\222\241\366L\326\262\006T\250a@\245\234A\212\314\314\204Q\230\302d8\320\"!*\233\003\021P\255dH\214$\312>\273\0012N\2529R\274T)[\252\221\177\261\f\274\217\241\215\026h\346p\325\372]\373\"\315>\004\241\377zt\007\331*\201MMQj\247P\220\234;j+\027c]D\300~\263EaAY\245i\264\372\326du\202'\272\315\230\\\013c\230\335(\317\005\003\236\007\201`h\r\340Rg"
+	.ascii	"\324\317v\233\205>\227'#\346I\366\357R\213\312=~\225PU\230f\001"
+	.ascii	"_\002n\2545Z&<\226\016\"\265\354\300hSu3\023N(t0Z\3057\3234"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a7980be5f79c71ee,"e",@progbits
+	.string	"(\265/\375`\367\001\335\013"
+	.string	"\264\020\363\002"
+	.string	""
+	.string	""
+	.string	"\002\017\177$\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\032\177%\271\200\202\202\200\006"
+	.string	""
+	.string	""
+	.string	"\005%&\200\204\001"
+	.string	""
+	.string	"\003\005&''\021\002\033\177(#)\031*$+-\177,\204\202\202\200  -\002/\177.\n\025\201"
+	.string	"\005\021\027\022\030\005\025/\0130\201"
+	.string	"\005\"1\002\026\1772\272\200\027\1773\005\0204\002\030\1775\034\1776\002\035\1777\036\1778\005\0239\037\177:\005\024;\005+<\016=\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\f>\002?\201"
+	.string	"\001(\177@\377\037"
+	.string	""
+	.string	"\200\200\200\001!\177A*\177B)\177C\003\001 \320\360\372\250\001\001\304\006\003\005\001\342\001\003\t!\310\377\241\372\001\001\244\001\003\013\005\007\004\013\365\001\265u\003\022\t\240\341\365\321\001\001\302\001\003\027\013\340\236\212\256\001\001\202\007\004\027\241\341\365\321\002\365\001\003\030#\201\001\344\006\003\030\"\304\007\017\003\032#\244\n"
+	.string	"4 \340\002\241\242z\254Afck\212T\250N k]\271Dp5\206|^\224\006U=\n\016?@\330\323\322\366$\030\023\222u\355\314\202\220\03598Q\307v\335i\267}\031\364\340\371\304\361\230-\0038\303\256\001O\036b\210\303\250y|`\307\222\034o\207\254"
+	.ascii	"\031\204(\306WM\216\016\343p\034\342\300\001\362\020\f\2342\306"
+	.ascii	"\033\355\345\307"
+	.text
+	.section	.gnu.lto_.refs.a7980be5f79c71ee,"e",@progbits
+	.string	"(\265/\375`\023"
+	.string	"\335\004"
+	.string	"\002\217!\017 \334\355\034!-\013v{_L\365o\231\002\217\n|\23087Mg\224\276(\177Pz\241y\302\322\035\323\217\367\210\031\321n\3443\262/\262+\357\267<z\177\220\017l\226\277\222\256\262\311\006u\325\205\022z\225\007\275oA\027\344'I\177Hw\357\023y@\366\026x\226}\271W\001\\9<\345\037\211\243\374\2238\346\2007je\375\245\356\326\267\365,\375Z\375P=\324\r\341\353\274\302\236PG\247\027o\372\"\001\006"
+	.ascii	"\222\006{\302yS\255\237\005\3017\205\r\300\252\310"
+	.text
+	.section	.gnu.lto_.decls.a7980be5f79c71ee,"e",@progbits
+	.string	"(\265/\375`\263*\275\301"
+	.ascii	"z1\021CW \fQ9\351\026oZa\227\335}'\267\200\321\374\337\240\333"
+	.ascii	"\372\272\343\317\207\243^\262v\236\034s\203\306\271\027u\264"
+	.ascii	"]\223\343ry\250\215m\312\350Z\332\355\325E\316\211\363I\304\246"
+	.ascii	"Xd\330\302M\203\357\304\345m\3100\307\205\365&\245\274k\364\377"
+	.ascii	"?\233\215{o\231\002\211\0032\0048\004\257T\360\231`\370h5\006"
+	.ascii	"\f&bxw\365\302x1\304*+\313\305\353\213\227\341\311y\303\006\031"
+	.ascii	"YM\352\275\232\252\374\237\243\263&*\310\235\322\251\347\274"
+	.ascii	"\274\331\325\353\254N\265\351\314\234sKI&\227\270ZT&\271\037"
+	.ascii	"f-\352}e\372\353R\243\365\331\007:j\005+#\365\342\330\025\275"
+	.ascii	"&/\326\232\031*Td\315>\262\264xQ\357k\376\373M\347\341xy\273"
+	.ascii	"R/Of\272)z\343\231\200U%\244^\2426lj\224\027I\034\365\276"
+	.string	"\331\374\235\246\303\372\256V\005\200\007\315M\323\215z[M\257i\347\325\272\205\267][y\016\02337[\310\nH!\365\336\232\205Q\360\365\325z<\215\241\327bE\357:\f\275\245\0243\377X\264\265&7h\350|M\326\256\306\352m\272\332f\372\314\233\256\313\034D\007\347aj\272\233s\262\373\002\237\356\013p\324\212$\241\364\356\353\017\3747\231\016\230\351\n\331W\035\323s9mi\264\330\352\225\013\322\251\201F\r\263\336W\032\370\355\344I\033\035\02653+W\316\302\270l\201k1\375l/\375\326a:\256Y\350.\375\245\235\r\246\333\336[\332\355\225\2313S\316\371\215\226\226\205\271\326Y\312\2666`\3533\037\2333\017\262-*d}\326O\251\0050\321\322_\r\246\247\364X?\203\210\370b\243\313\231\371\016\376\242\037D\007\r\246\265\364\331\206\245\234yPaXRs\326\303.gf\220\207\0370b\346b"
+	.string	"\340\276\333\360\351:C\317\247\247\340\367\027~\023\301+\334\033n?\264\352}c\3417\016\374v\302A+0\007\025X\2503\364\272J\227\265\323\2026;\210\016n\221O\362W\317\233%o\332\324\373\017\340\267\005\275\316k\013z\037\001k\340"
+	.string	"\334P\272\331\316\016-\345-\326\314\343$\231\231\2313\363\247f\341M\201R\357C\340\377Q\036"
+	.string	"\253\334\301}\360\273C\317\346\345u\207\036Zg\350\001u\206^}v\206^\177Y`\2251\252\362X\316\314\013?\314\033OX\365\236\331\031z\2701\364\376\376"
+	.string	"\214\246\252%t\322\337\303\2771\020\354\300/\003J2\370\255\t\177\325`\001[I\370\353\bG\202\327\360\333\254Z\342\357\020T\021\"\360\327\020 PI|\003\377G@+\300o\223\324\021\177\243\360\300\3379\177s\240\202P\037\240\363\367\361A\277%\336\337\356\350\021T\021\035\030\360\327\f\016\310\357\371+\336\211\343\374\026Gm\300\377\003\364~\273U\031P\027P\025\360\177\303o;\360\377\313\377\025\376s\371\017\367?\314\177/\377Y\370\017\346\177\334\377.\177\036\350\267\006\370+\376\353\316_u\376\352\373+\316_s\376\332\323u\177\265\177\255\325\203\377?\377\265\340\257\t\370+\006\177\255\340\257"
+	.ascii	"\370\353\004\177\005\372\253\317\337m\177g\371[\355o+\177\243"
+	.ascii	"\375\355\365w\331\337d\1777\377\326\372\333\311\337`\1777\371"
+	.ascii	"[\311\337\\\177\037\371\033\310\337W\177\373\370\233\307\337"
+	.ascii	"R\177\333\370\233\004\177G\375\r\343\357\r\374\035\200\277[\374"
+	.ascii	"\317\373\177\367\337\314\377\023\377\345\376K\371\333\305\337"
+	.ascii	"\312\277\235\376\006\301\337M\177\247\370;\371\367\005\376\316"
+	.ascii	"\377\355\376>\341\277\331\337\351\337\306\277M\370\273\3707\361"
+	.ascii	"\357\235\277\357\337\377\317\346\377\231\377&\376\217\371?\367"
+	.ascii	"\377\353?\211\377m\377}\362\362\362\362~\034\241\337G\365\017"
+	.ascii	"\200K\265\213\223\233\017\211\177\373\"\314\027\033\034\225z"
+	.ascii	"\227\027(3]\345m}\350*\243\235UF\337\211\220\223Q\034\304\236"
+	.ascii	"ulv\267Lo\247e\262M\"zO"
+	.string	"\313\245\324\007\036)\3157M\365\332\026RQ\272l\260\301\357\251\021\262\311\034\270:\252\2611w5\317\346f\323\271i)\001\2472ty\271\374\360\236\032~eS\333\274\272\271\233\372\246\2452\022\r\007<f\035\233]\226Z\n\3257}\367\323\004\212J]\337\365\304t\371p\252\367=\035\370\257\177/'\2279\347(\034f^.\361\364\032\247[\350\357i\333\005\310\366\377\206\023\314\214|{K\203\271\316\222;\316!\377\317\234\231\254\220\"\254\240\230\254p(\233V\031\311\244\205\274\260\314VHe3\347\013\231\211\tI\242*_P63Tn\361\005\2523\323\n\231\231\252\362\205\314\224\223\034\224LVP\312f\022\352\202\262i\005\225\233V\031(3%\227.\230\362\362BnZ\235\311\315*( e\263\nJ\331\264\332\321wJ45\240\272\274]\205u\232\222)\313x\232J.\201\236JfU\216\313\271\307\232\362\262"
+	.ascii	"9OU-\343\2228\032m\351)c\251J\262\2525<-]Ue\246\247\262\253*"
+	.ascii	"\347\256%\025\371\211\003$\363\231\205\364\023\2115\225c4\345"
+	.ascii	"\\\301S\316\310\316\317\23432\347\354[N1s\326\001\244\334zz\312"
+	.ascii	"Y*\350)O!\323\232r\256crhP\312\346UUQ\232\263\271\225\235\230"
+	.ascii	"\310\336\312qVK\334D:\3111\352\360\026\024\r4[\326\324\026.\233"
+	.ascii	"#K\2603\274FM\032\034(lL\222\365\246\251\003\303c&\2057\036h"
+	.ascii	"\204z\356\340\226\224\2349\233\035\334U\013:2D\2660\273\352\255"
+	.ascii	"O2\310l\205-\373\316''g\2531fj\231:\246\316\265\263\222\251q"
+	.ascii	"\257b\252\334\f2\025\252\357\230\314\321U2\265F\r\203l\200\334"
+	.ascii	"\2145\273\234\363\317\331\226\234\230\316\305af\301\031\303p"
+	.ascii	"wJ\017,\246z\217\023\206\353\227jU\261lXR^+_3\324\352\0262'<"
+	.ascii	"z\314\007'\347\252\260\267\372\254]\252[\345RY\250^*\230v\326"
+	.ascii	"/\265\3515\252\322x\320W\375R{\200\321\335\240b#\307\224\251"
+	.ascii	"*\205%\266Uu|\251;\252T?\245\2309JGL\226\313\362\223G$\310\327"
+	.ascii	"\004\227\255\266iy[FY\223\207\331\264\364Hi\323\221\314\362\252"
+	.ascii	"\205gM\223\033*\365\326\025l\027< \311\265\236\260\2550kk\357"
+	.ascii	"\273jD\206\0215j\256\32490\034N1\030\255\246\265\263Z\251C^\253"
+	.ascii	"\252\217\0071\255T\254*$l\212\225\232U\315\372)\005\224\231\312"
+	.ascii	"\310\321y\360\320\316\2657hzW\254\222i\331*\253U\352Y;\253\331"
+	.ascii	"\253Y%R\221\370 /\344\fD\314\226YMR\301\3729&B\0227\017\032<"
+	.ascii	"x\330\211\361\203\n\211\357\224J\245\235\225\254\216A\251R\322"
+	.ascii	"T!\253\314\372d\303\222R\004,Y\350\360\225!X\204\270Iq\366\270"
+	.ascii	"8\343\n\323\254QtlH=\261\244\341\277y\031GZ\264\215\235Lu\362"
+	.ascii	"27k\313\r0(\370\367\013\377*\301\025\254zU&\375\034#\301\245"
+	.ascii	"\215.\347\374U\303\332Y\301j\223_f\256`\265\b\333\026\272 \017"
+	.ascii	">F\270\232\200\365\356/\021|\275\230\244\270\325%UI\356\351)"
+	.ascii	"C\245\326U\357\257\025\376\335\201\177qT\256\332\325\316\212"
+	.ascii	"\244\252\360JU\257\036\304\314\271\312\006\177\021\222\252U\217"
+	.ascii	"lXR\226\340\321\245\"\251E\372\314\007\311\31434\020\327\203"
+	.ascii	"M\220\007\017>,+bCz\367v\314\221o\331\034\31227L\234\025\244"
+	.ascii	"\336\212\030\251Cv\344^\3442"
+	.ascii	"`\360\255\033\276\305\202o\311\360\255X\r\362#\305*LI\275\267"
+	.ascii	"Hp\375Q\201\264\263\246\360\373\244*7sf\366\330\344\r\2673\241"
+	.ascii	"\336\217P\357\266\b\356l\201\340\016\242\302\26750\220\205\201"
+	.ascii	"o\2310\2076\270\342x\241\002X\225\r2\370\025\016k\360\005_\346"
+	.ascii	"\030\033\016hpS\277VS\027\253\32543KU!\321\030\240\207\226\272"
+	.ascii	"-vY9%t\004\244\307\226{\365\213\365-yQ\320\254\316\032\211\331"
+	.ascii	"\022*\365\336\252_\037\177\216/\f\230\266'Z\370\362\370\355\261"
+	.ascii	"\203\306\\\227\020\252?\207'\310\026.h\352\275\317\025\276\317"
+	.ascii	"\224\224\324\325\321O\362\214 1(3v;k^\324)s\374\352\270,\210"
+	.ascii	"\301\305\331%.3\334\2609\203_\343\326\2707\202\252\220g0h\202"
+	.ascii	",\263E\2507GW\203\315\265\361{\343N\002\316\"H(Q7\312.\211\030"
+	.ascii	"\313I(\241\025\220s5\354\3622\313\207\013E\236^\365\276'\n\377"
+	.ascii	"wy\227=w\223@9_\335\241\365\216 \327\360\360{I[\267[3\355\264"
+	.ascii	"nW\206UJe\032\037\312\246>\364\270\024Yv\325{\237\230L>\0309"
+	.ascii	"\310\306\350\360\373\013\215M\023G\245\306\326}ui\301\336\365"
+	.ascii	"3\210\210$[l\233\273d6\206\256\350:\325\"\266\216\313\226\213"
+	.ascii	"\033\343\302\270\312\333t_\264\363:Y6\267t\366\314u\262k\334"
+	.ascii	"\350v\340\324\030y\372\\4'\023&w\227\254\233\233\334);\002g\307"
+	.ascii	"t[\264\363.\215i\350i#\306.\254w\377\233\274H\264\027;\234\352"
+	.ascii	"\275\271\233m0\260\320\336\264\323\3469\251\200\247U\257\305"
+	.ascii	";\031\027\310\0270\256f#\255\211[\031>\217\024|\036&\326\016"
+	.ascii	"\203\241\243\342\322\205\317\263\205\317\223\205\317\003$\215"
+	.ascii	"\255k\262\245\341b\353\316Xp\213\261d\205\253Pc\350\3319K\306"
+	.ascii	"\226\371s~\230\240\001!\323\201o\307\2140\244\013Y\275\327\212"
+	.ascii	"\271\225k3\262\365d\003\337\206\261q\177\216O\234\326\024'\365"
+	.ascii	"\236\347\t\337\302\221\345\245\311Q\257\005\203\233v\362:\350"
+	.ascii	"P\231\365\330Q\357-\230\337v\261O\373&\202<\274\026\352\265_"
+	.ascii	",\013\267o\326K\266o\034T\345\234\264o?nrN\376t_\320}\301ere"
+	.ascii	"\204J\357~\207\r~\\g\350\365\244)\272\345\262\303e\215N\314\013"
+	.ascii	"\333\232m\353\273\250\"\257\2552\374\035/|\273\3266K\226\252"
+	.ascii	"\035,\\\364\025\207\005\213U\323\340\265\254c\263\363}a\031\303"
+	.ascii	"R\303\371\322\245\265\243\264b\245\357DH[\352\2509\373\231E\253"
+	.ascii	"[>g\226\024\335\345\n\302\004\005\355\256\327\",\310\222.\270"
+	.ascii	"\254\3146E\310\031vT\031\325\225\211\2712e\212%\013j\263\305"
+	.ascii	"\263$-\207\025*\267d\326m\bWs\354\212qI\001a\202o\243\264\225"
+	.ascii	"\342\264RzL('\223\030\210\241\025\301\357\036\353A\201b\233\""
+	.ascii	"\334)i5\361\322<\302u\025\243\336\353\320\300\267am\231V\211"
+	.ascii	"ubc\320\350\200*\353<\341\353\264\210\001\366vZ\260\236\023\021"
+	.ascii	"$g\250\016d\266r\334\200m}\225\301\267K\3326\261M\354\022\006"
+	.ascii	"i[9\\\360\333.\365\220X%H\254W\222$\326\253\363\362\f\002v<{"
+	.ascii	"\t^\036\f5\267^V\316\353i\344\n~\216\023.\247\345\252L\027\371"
+	.ascii	"$#u\234\274d\335\260\313Y\352C\275\361\314j\322\bb\215\004\261"
+	.ascii	"Gz97\263j\306r\353\366H\316\222\214&jB\204X-\214\244 \315g\254"
+	.ascii	"\306\017\033En\265\232\316\247K+\355\253^;\304\022\301q\312\270"
+	.ascii	"rZ\"6K'\255\n\2223p`\346\236\224vSaK\314\324\373\034%>^\363\303"
+	.ascii	"\366\260@j\026\341B\231sT\021\r\f\006\037[\271j\247\275j\272"
+	.ascii	"\240\214<\243\001^\256c\263\303cU\266\207\365q5\214\\b*.z\320"
+	.ascii	"a$\370\270\312\352\260:,\017\003\320\260T\267<\354\322M\"C\315"
+	.ascii	"\253^;\325g:iM/6\352\265;\354R]k\306-\341&lq\344Y\251\246\343"
+	.ascii	"P\202\\\307\246$/\231\037\356K\203\357{\342\177h[\243\346Y\033"
+	.ascii	"W\273y\f\217.\177\270O\n\276\217\210}\372\223\215\3029\347.C"
+	.ascii	"\223\022\302W\306j\310Y\250\333\250\212l\363z\332\245\220(cZ"
+	.ascii	"\324\345\355\214:3rY\356\307\213\326\f\033VF\267\365\344\345"
+	.ascii	"\030\323\021\225\306\302"
+	.string	"\b?\367*\202C\240\021\305P\230\022\207<FI\302#\007\324\bD\n\242F\034\212ID\240\024'\020\213\027\t\t\030<\246B\024DJ\303\243\fPP\032\n\2212\340 \304/\204\007(\020\241FJH\301\241\220\310xT\"\":\201hT\221\022\207\276\024@\024\351\246\307!1\210\223\"\035\n\215H\275\253\030J\022\246C%#Q0E\212\232\320Q\221\002\223\210\206\304\244$b\260\202\rB\020\024*\2310\301U\fM\340D\t\023D)zd\004\246\034B\020$\"\215@\215\304\021?,\212\304\021\024\244W1tT$:*b\b\016\225v\206)\252\021\347\370\343I\177\303\243\"\316\360\250hQ\021\b\217\227E\221\030\274\306\264h\215\320\341\221\020\t\3503B\217J7\210\036}7\376\216\212C=F\240\212\340eaL\217\302#\264\004\f\032\f\031\241+\200\307\fIFb\n#Z\024\200\321P\211h\214"
+	.string	"j\244\224\nS\244\007d\3309\242HA\026)j\002\204\243a\220\007M\211#\206Da\n4\242\020\"\001G\034\205\032pB\f\035}Ihzda\342\227\244d\342\007M\201F\305\013Xp4B\215~t4\030J\215\300\342P\032DS\224\004\007\023L\320\001\005H\300\224x\0025j\270"
+	.string	"b\210\205\021\020-!\tC\320\006C(\240F\303\022\351\0205\032\225\202\025\374\206!\244\350\021-\341\250\250\001\375\241)05\001\224^"
+	.string	"<8\004\n\215P\n\200\300\002\251X\004V\360\240\320\210\016\321#|\016Bd\020\302\003\024|\367\340\003\r>\320\240w\017>(*\372 D\021~\210\"[4t4aDS$a\bA\350\317D/\275\212!\004\214\240"
+	.string	"M\201HJA$`0'\025\026M\244@I\374J\220`b\007\r\016\201\351q(\304\351\257\002%\356PH\302\360\030\354\t\213G{\374\215"
+	.string	"Qbg\004\210\0229\275 \b\241\275\212\241\243\022\272Bh4\322p\374Q"
+	.string	"\310\210\246G`R\317\207\256"
+	.ascii	"\"\231P*&a\245\037>\376H\034\225P\354\240?\264\310\342\304Q\t"
+	.ascii	"E\216o\005jtTB\321K\2250\013 \022j\364+*\34145\002\323#6\246"
+	.ascii	"$\004\207J!\024+PT\372\245\350Qo\005jdS\244\007\020\215@\020"
+	.ascii	"|\250Q)\005\032\321b\022z\0025*\221p\374\255@I\344\244?\020\033"
+	.ascii	"\244C\241\017\211H\004\341\207\223^\005\001N,\242F\242\224H4"
+	.ascii	"\022\355\244H\300\343\357H\230bH\034q\001-\262H\217J(~\322\337"
+	.ascii	"\021\360\004Q\350\033\036\203?a\361\310\203\006\205+P\243\237"
+	.ascii	"\343\0215\032\031\001\177A\020B \324\b<\301\310\bT\321\223\376"
+	.ascii	"<\360\245C%b\360\207\"\025\223\200\307\013)\212H?\364($\016\177"
+	.ascii	">\351/DQ:\024*\341+@\001#8\\`\204\b\340\340\220\021M\321$\242"
+	.ascii	"\243\221x\034\242G\242\241\020\230D\0244\036\211\206\006\200"
+	.ascii	"\204\256\370\245\b\376\210F \212\235+<z>\236H/+WGs\314\035^\032"
+	.ascii	"Z\262\f*L\275r\030-\213]\225z"
+	.ascii	"/\331%\273f9H\235\255.R5\204\256\331-#K\256y\272e\267JN\224\027"
+	.ascii	"2\030bU?Z\220\301d\356\240\361\230Rc\213\355\222\242\004n\f\313"
+	.ascii	"ig\026\305\\sz\333\341\274^>\256\244\222\274(v\tO)\363\204\321"
+	.ascii	"\264^?.x\224i\003\3056-\340\205\335\330\023\033\003g\341`\363"
+	.ascii	"\304I}so\020IA\005\346\275\201\363\206g\203\005\261\036\353\341"
+	.ascii	"h\321\206,\314\036yK\313_\352e~\361\314\230\221UU\357ebKp\231"
+	.ascii	"\324\373u\233\3742\371\217/N\2112\271\304F\371\\\241\001#R/\220"
+	.ascii	"\337. \327\353\256\345\334\264\364iA\313\232\033I~\275\316|\304"
+	.ascii	"\345H\241\336\213\344g7s\022\227\305\365K\325\003\311\345U\357"
+	.ascii	"%r\217\\\025\256\330$\237\352\375\217\013\374\273eFL+\256\336"
+	.ascii	"k\0047\371\270\351paP\261\273Fz\246T\300\372Q\357-R\364\253\205"
+	.ascii	"\223\243\315GV\275;\215\241w\203\334!7\253\307T\224s\016\377"
+	.ascii	"\nY\222\244k\207o\002!owe\276\372J/\211L\323\243\336\233BN\224"
+	.ascii	"\223\021\264zo"
+	.string	"g\\\265\b\203\223\250\202\261<\b\323\234R\310\320\214\310H\222$\035\"\n\020\204cY\234)\252=\022\300$M\2162\307fDD\222\224\244\222\366\r\024\221\201%\004\216\\\001\264\264\222\341]a\241r\266}\020?\203:\327\0271\032\327\362&qRv\3116?\317\325le\274%\203\341\260u\332QL\257\232\230\257w\026V\366\251\021\246\0042\227\257RC6\034V)\311U\220m/lL\005\023\342\306\335\204 \350d\320\204k\2120\255\356\212a\3429p\341&\255\037b\325\2069\367\227\264\221\252&p\244\307\036\bJy\217S\277\254,\027\256\026b\263\272\206\"<s\317\271Kn\300H\333\270\317\230\343&\236\374\021S\356}\375\232XzS\037\276\354&\366<\235\217A\267\226\001\030B\032k\263SK\002\213l\347\024\036\017d\033[\204%\314\003\365\206N7\315\333M\355\325P\245\240\r\216\256\211\232_B"
+	.ascii	"\232a\034\321\r\335\236\330m\335\0259Qj\200\003\245B\2371\235"
+	.ascii	"B\372"
+	.string	"`\271\001s\030\275\216\222\205U\024=\307\2328\27551h\216\221\027\fY/\273\b\"\017\361\206\013\246\036\351c\"6\177\277\320?\316\265\231WlB\243O\220\373\006\023\235\330}\340\252Y\254\301 \311\t\006\263\203\270\242\002\036\330B\317\t\344\273\031\340}R\314\207\252\262\346\315\2536\215\b\333\201\212z\221\037rZ-\201\220P\356\024\276\317\373\326'Y\343\247\340\325Ly\205V2\256H\357(\036\276E\266zA\r\036\036\250Z\331\301\321\302\222\213h\235\226\335\357C\325\253\273\236/O\375\017Vi\001_\026\354C\305\362\216\367\263{\254R\326\035R\217=f\261\235\242s\211\024\026\224-\207TM\356\314\215-\201\324d|\3402K\210fM\230g\001#W-h\307/0\026\333\036\004\351\021E\324\b\330\343\253\232\305#\2017>F\203\271\266\2060vd\255\212\321\332\327sv\0076\276\315\021\372J\314\237\325"
+	.ascii	"\374\265.2\003\034J\233\2222\257\364S\306\246\272\317\255\373"
+	.ascii	"\237\271\270\216\337H\020b\215\274\211\223*\003\2342\003\225"
+	.ascii	"q\006\232%~&\214\2167u\246\334\374+\273\020j\264\205\022T\013"
+	.ascii	"\375M\364\210\355S7\374\316.\036\327\241o]\n\007]4\330C5\335"
+	.ascii	"\021\215l\2419\262\017\tx\372\352\374\342~\317B\f \t\022\322"
+	.ascii	"|\017V\333w\366M[\315|7\355(\373\225\212\351+\2701J\232Wx\216"
+	.ascii	"\301L\316`I\\\3776\346\216J\256\355\275\3345\321!\274\330\204"
+	.ascii	"~\004\270\342\031\302.\265\013\370@\337a\265-B\355\245M`\026"
+	.ascii	"\305\212\366z6\335^\267\005\227\243\232xA\343Qi\260(E\262\271"
+	.ascii	"\302P\273N\234\025\210p\201\037\355$\217S\tC\256\210\264LE\260"
+	.ascii	"|&xe\256[3\364\034\347\324\021V4R\033<\034\356\3124\021g\336"
+	.ascii	"\273<7\313\316\207\322\207}\361\365\203\3270C\305\210\345\230"
+	.ascii	"\311y\364\336\310O/\236\272\224v\002\255\241[ fv\336\260\341"
+	.ascii	"3\200\002i9\343\242\243\262\335\215p\241\324\361\252\216$d\005"
+	.ascii	"\360\246\f\276\232\241\313p\344\212y\257-,w\222\215b_\034M\353"
+	.ascii	"\201\223b\363\267\346\203\0027\371\347\230r\262\210\334\335\314"
+	.ascii	"Qw:\2430\002!\254\357\005\363\235\036,\224\020\035\fNi\314\002"
+	.ascii	"\304t\246\351=Y\354\027\361\332W\274X\273\007Wm\211\211\"\227"
+	.ascii	"\231\341H\301\212\237\337\207w\321\227\241\344#\220\340\225;"
+	.ascii	"d\201\f\224\271\236\207\234-\201\275%"
+	.string	"Z\200W\221Yql\023-\227h\352\341\246\326\220^\357\363\310\215E\270(\352\261\204c\242+\263 \347Z\241\301\203\366\223\3143A\304+\034\335Xk\232\212\323\034j\261\307I\004\275\304A\210\206\005\223\363h\037\256\320cS\237\034\343\224\005x\236\341\3541\210\337\224?\376%X\305_\337\377mh\230\235M&\037[~\256\n\312\361\351\233\013m\302\2467\317\340\004\370\255\341\2751\020M\226\230e,\310\037d\314\242\233;(\207\263:\"1\3023\350:\013$\232\313>\202\323\246J\207E\211\026\220n\223\324\317\252\016p\367\234][\n\342gn\264\310+\331\365\316]\276\307\231^x\246\356xL\217\223\027]\026\256X\377gF\023\302\311L\031[\333\365\350\231\\\344\367\227*\020`G+\304\216'\245\330?b\002\317?8(\356\262\374\202\204\302\273t@vU\021r\325\235\345\261TX\262\204\221\307l\r\0357"
+	.string	"\367\212\306S*\034w\277?5\375-\321\035\355_R\035\261a}d\005\303\204\322\234\305X(0\256z\013B\333\226\3438\212\031\373@\035\2410\243a\013U\371]\032\016j?e\b\001\rm]\315\352\307t\004\330{w"
+	.string	".\362\230q\tM\256[\216l\244\272N\343\276\">V\311\301\274\310\336cH\214\311\240S\021\266;\326\242\330\255\346\313\214\275\342\312j\361|\201\371\306L07 \\\022B\312\"\016\324\274\242%\007\257G\365\345\241\036\2774\350\272\2517\r\272w\314_\325\275\027K\231\336\022/z\275a]\013\035i\370\336W\\\302\342ziay\211\032\210\013\327\243bc!m[\257\354\373J&A\253\211c\203UB\032\335xb\023\237\b\341H\033\212S\276\024\340\376>1\234\305\327\372'\346\002\206\251H\261\266e\350/u\300w\2728e\327\206\f\263\244\363\255\033c-3\351?\2426\032\314\t\301K\017\232\220\202"
+	.string	"\343\214\303\250\345A\264\351b\3666\351\\\037\233\027\362\2727tP\325j\322\3512\257a\217\fri\317(5\347 !F\226\376\341+Q\300h\315\304\244\313\033e2P\236}\243s\350\367F\312\304Vuq\272\317\342\304=\2361\264\342]\310V\244Ww\345Q\317\201v\f\b\370/"
+	.ascii	"\020\214\256\307Oj\367\001\247\323\220&\354\254\035@\036\263"
+	.ascii	"\3535\242>\241)Z\225s\fN\325\370\323\247\200\275N\310\234f\315"
+	.ascii	"3\344\376\3130\271\276\304qkc'3\006\032\030\202\023c\\)o\273"
+	.ascii	"d@\364\272\213\r\372\334\bpz\254\230\023\003\206\03246\200\320"
+	.ascii	"y0^\"\345\214$\243\300xq\364\034x\236\343r/{\303\322\037w\277"
+	.ascii	"!\262\022\335Z\355\200\375\250\b\226\250\331a\035B\373\365\343"
+	.ascii	"\27735r\027,'\037\237\300\307\276"
+	.ascii	"\2751*\346\217\375\361\260}\260\334\223u\013\304\233a]\310\221"
+	.ascii	"Z\314=.NL\017\234e\302|\026\305\rh\337 _9?j\375\217\2277F\007"
+	.ascii	"\254\343\3240\272\371\311\355\334\262O/\007\375\237\304cf\017"
+	.ascii	"\236\367l\363e\332\023\323#\3439f\233\254O\216klMr>\305\360E"
+	.ascii	"\366\f\032\340>\267bN\344\374\232\271\323;\032\366>,\376#u?:"
+	.ascii	"Vl#y#0\235\036\347~\036\027\363W\031nM@v\340\365\344\373\254"
+	.ascii	"\361E\235\307\302/{'{\033\207r\f\033\232\3148\026\322O\312>\030"
+	.ascii	"\314\335\357\r\236\214\273\304\035U\017\205M\242;\302\322\313"
+	.ascii	"x6\343k\276&.$\316\304\357;w\317k\bs\253\367b\255t\336\344\201"
+	.ascii	"\264\351\025\214j\005"
+	.text
+	.section	.gnu.lto_.symtab.a7980be5f79c71ee,"e",@progbits
+	.string	"pgResetFn_barometerConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\001"
+	.string	""
+	.string	"baro"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"X"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\001"
+	.string	""
+	.string	"barometerConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\016"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\001"
+	.string	""
+	.string	"baroDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\001"
+	.string	""
+	.string	"isBaroCalibrationComplete"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\001"
+	.string	""
+	.string	"baroSetCalibrationCycles"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\001"
+	.string	""
+	.string	"isBaroReady"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\001"
+	.string	""
+	.string	"baroUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\001"
+	.string	""
+	.string	"baroCalculateAltitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\001"
+	.string	""
+	.string	"performBaroCalibrationCycle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\001"
+	.string	""
+	.string	"barometerConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\002"
+	.string	""
+	.string	"barometerConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\016"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\002"
+	.string	""
+	.string	"detectedSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\001"
+	.string	""
+	.string	"quickMedianFilter3"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\002"
+	.string	""
+	.string	"sensorsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\002"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\002"
+	.string	""
+	.string	"powf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a7980be5f79c71ee,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
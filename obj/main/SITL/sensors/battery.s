@@ -0,0 +1,1459 @@
+	.file	"battery.c"
+	.section	.gnu.lto_.profile.3846b59827e8a97a,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.3846b59827e8a97a,"e",@progbits
+	.string	"(\265/\375`\314\001\035\016"
+	.string	"\204\023\300\002"
+	.string	"*"
+	.string	"\312\243\215\320\016\034\002"
+	.string	"\002"
+	.string	"\002\001\002\002\002\001\002\001\002\003\002\004\001"
+	.string	"\002"
+	.string	"\001\240\342\234\212\n\002\003\004\005\006\301\233\246\206\004\024\005\002\006\007\002\006\002\003\003\002\006\007\b\246\300\251\343\t\002\t\n\361\312\235\227\007\b\b\002\t\f\253\353\330\347\r\004\r\016\273\373\273\233\t\004\002\n\002\004\020\311\247\242\326\b0"
+	.string	"\002"
+	.string	"\006\002\007\002\006\003\b\002\t\021\022\313\322\375\213\007"
+	.string	"\023\354\206\342\366\006\024\234\236\237\233\f\004\013\002\f\025\361\220\342\261\005\026\373\222\262\354\016\026\003\r\002\004\027\030\376\211\224\300\t\f\002\007\r\002\004\002\016\002\017\031\352\263\360\321\b\034\226\213\357\351\r\002\035\306\371\276\205\b\001\002\004\002\020\002\021\036\236\276\234\317\004\016\002\005\003\037\314\344\207\235\n"
+	.string	"\002"
+	.string	" \212\201\226\371\t\002!\307\200\351\335\"\300\253\277\314\017#\317\356\361\267\004$\350\300\306\254\005\002%\307\266\257\307\n\004\003&\250\267\374\351\002\002\002\r\002\004'\207\312\266\244\016\002(\320\374\270\356\001)\325\241\220\227*\341\235\303\354\007+\262\315\243\256\n,\240\342\234\212\n-\240\342\234\212\n"
+	.ascii	"B\250Q)Q\b9\0324\205\225\326\220\202\031\242\353\001\021\220"
+	.ascii	"Q\243\251\005)\264\035pm\344\020T\203nP+[\237\021\304-Z~\230"
+	.ascii	"\001\023\242\033t\r\221.\002S'x\301\362\326\242\376\267\221\321"
+	.ascii	"\365\025#h\037\0057\377e\004\327^H}\364\351_\264\340\031w\247"
+	.ascii	"?o\007r\203\224\002\025\313\2163\016\224\037t\244\361\273\217"
+	.ascii	"\t-\2256c\234\314\032D/gHQ\274\266\357{\214(\200\"\0164\276\261"
+	.ascii	"\243:\206\252s.\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.3846b59827e8a97a,"e",@progbits
+	.string	"(\265/\375 \266u\003"
+	.string	"2E\020\031\220\327r\377\377\377\377\377\377W!\"\"\"\320\266ZU\253\355vAS\223).b\017k\330\302\022v\260\202\r,\340\232V\265T\341Ns\333\f#h\237u\266\231\314\226Uf2\221\355\230J&\002\022"
+	.string	"F\205\371Y\200\363.OK+\026g\216\300\007\310B!8\266\224\tO\013"
+	.ascii	"z\234\0214\357\3364\2233\"\323\226\r`\001"
+	.text
+	.section	.gnu.lto_.inline.3846b59827e8a97a,"e",@progbits
+	.string	"(\265/\375`v\003\255\f"
+	.string	"\222\01787@\217\013\007\230XX8\023@\347|(\032\b\356'\027\333\377\215\332\006\n\244P\276J\305\213\353\254\252Aq\221\300\233d2v\263\262\251\372\254;\215\215\272\211\020\221;\005fXP0}\232\200P\"e\246\371 u\342\"\242\261A\310\377\216\013`\376%\201\374\373\361\350\352\372\027\"\303\177G\0269_\016\235D\237\304\314v\247m\262`\274\304\001\324\224\230\221\217\006\203\302\226\377\246\031\223\016\225\310\237-[\003\023\231\232Y\340\302\366\324\001\240\276\254\270aA\221\251\2732\"\354I\333\234r0\016T\017\216\025\r\217;\375\277\240\264\365\323\326\277"
+	.ascii	"\346P\271Ai\314\301lw2\334lO;U\241\214*\2357\"k5>\274X\2531\344"
+	.ascii	"-\235^\376\377f\177I\362_\"m\354K\231\377%\233\300YES\250!Q\247"
+	.ascii	"\202)S{l\006p\002\231)B\017\022\200\203I\001G2F\032$\220\214"
+	.ascii	"b,\177\0178\006\270\273]\224\354\025/\242\007\326\021\327\277"
+	.ascii	"-\334\327\006\003\325O\006\315\r\346\306\3157\330\300\220$p!"
+	.ascii	"\210\300:\017R\265\243\206\261\204\246\nci\375\262:)n$9O\357"
+	.ascii	"\337Er\235\227\326\257*WY11s\303O\327\205\240-\253W\303b\236"
+	.ascii	"\353$\t\\\313\276'O\265\305|z\rwv4\245\f\016\311i\315t\333\273"
+	.ascii	"Qz\327\037\235\005\037\315\001\013\036\2640\315\244\377\215C"
+	.ascii	"\347\022\223&\027\333\005XXp\343\304\352\3103\314+\245{\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.3846b59827e8a97a,"e",@progbits
+	.string	"(\265/\375`\331"
+	.string	"\205\006"
+	.string	"\322\213#+\200EI\007}F\342\016\030\203\3663\003}F\200RZ\f\360U7(\312m\017\374\003\377\300\007?\302F\260\017\277\022\342I\3332\005\177\3461\177y\313W\236\362\223\227|\344\207\374\206\030c\\\351\262\331>~\3077~\306\313(\252\206eB1\026"
+	.string	"P\020B\330\tX\366\365\327\024T\342G\274\364\207w\037]\2016\240\337\273a\271^'\326N,{'W\265\224O\356Zx\302\017Z\353\252\240\256\252C\345\260\314o.\337\323\262\177q\007\002\032"
+	.ascii	":\206\343\243\340\260\200\271g\200\2010\262\271\311bQP\305\013"
+	.ascii	"\"\307\300\254\263\266\2545|\006\337\316\020-\236\300\024<P\266"
+	.ascii	"\n\226`\n9>IDu\360\247E\320\004\210\033\315\354\n0\004"
+	.text
+	.section	.gnu.lto_.pureconst.3846b59827e8a97a,"e",@progbits
+	.string	"(\265/\375 S\025\002"
+	.string	"2\205\017\026\200/t3\212\310\300\314\220\201%6$\220\220$\004A\0202\323\0353\233\330\274\2465\253I\315iJ3\272\320}\2563\233\311\\\345&\023\231\307\233q\213K\314\341\n7\270\300\275\345\356\264"
+	.text
+	.section	.gnu.lto_.ipa_modref.3846b59827e8a97a,"e",@progbits
+	.string	"(\265/\375`\263"
+	.string	"}\005"
+	.string	"\202F\024\034\2209\303\001\377\377\377\377\377\377\313\007\376Q/5\021ZB\013A\306\f>PK2\005:\032\212g\202\261\026\221\272\240\350q\232\251Tz\246\264\265\203^uH\f\252\217\360<\235\347\006*`\n\273\346eF\002N-\273\345\211\330)Oe\200\211{\004. \340\002\221\272\033\246\210\020_\206\036\314\221\305"
+	.ascii	"\030n\235\231\254\3117=Y(\001\013\035\3276bN^t\035\007\335\""
+	.ascii	"\254\303<\346\026\332\b<\356\177\221\343\230&>\\=fP\326\217\305"
+	.ascii	"\341\237\251-\317\206\305,\261D\223\3003A\032Wp\216a/B\3030N"
+	.ascii	"\006\266\025\324\r"
+	.text
+	.section	.gnu.lto_.lto.3846b59827e8a97a,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_batteryConfig_Registry.44.3846b59827e8a97a,"e",@progbits
+	.string	"(\265/\375 \231}\004"
+	.string	"\024\bb"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\206\200\200\374\342\203\335\361\031\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\364\006us\350\307\006uq"
+	.string	"\005\001\006'\001\030\213\300"
+	.string	"?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/battery.c"
+	.string	"\004"
+	.ascii	")\"\301$\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_batteryConfig.46.3846b59827e8a97a,"e",@progbits
+	.string	"(\265/\375 \212m\003"
+	.string	"$\005}"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001)\001\n\005\001\006\177\001"
+	.string	"'}\001\002\005\001\006{\035\001\344\036#!+?\202\210\200\350\001yw\307\001u\306\001s\305\001q\304\001o\303\001m\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001_\273\001"
+	.string	"\013"
+	.ascii	"/\"\340N\253\306T\320\201\266/\3025\303\2023\320n\212(\003(\002"
+	.text
+	.section	.gnu.lto_batteryUpdateVoltage.47.3846b59827e8a97a,"e",@progbits
+	.string	"(\265/\375`\324\001u\020"
+	.string	"\226]lF\340\026'\035\324\370\304@;\300KG\242\232\357\320\266\351-\340:\206\225S\003\225U\031\240\240\240\331\007\332\232\261\223 ~C\325x\035J\353q\322\211\235\330\202\341LD\370\226,+\325\003\214\021\254\362\220\2667\3312\245W"
+	.string	"R"
+	.string	"]"
+	.ascii	"/\315\313\354\005\346\245Y6\223\307r\366>Jh\200\024\355\356\026"
+	.ascii	"k\234\365\321\224YT\226\317\300\306\223\017l}\244\261\370\244"
+	.ascii	"A\241\262\201\224\354=\317x\344\030\371\300\025\217Yih\306\022"
+	.ascii	"\022\370\312\034\334\034Q\261\002\302TG\024v\327\372\2016\267"
+	.ascii	"v\3332\266%\330z \276\217\377\360|\235K\313\314\350\277K\177"
+	.ascii	"f^j\234P\243\343f\207\307\245U\354\330K#\r\373\331\356\256#\216"
+	.ascii	"}\236\177FuT\265\222LaQ\023\005Hvk\252L\331P\016\301A\262}\265"
+	.ascii	"\337\343;\254\363\2300\200]\031@A\2731\b~\240].\b\034^\2040\030"
+	.ascii	"\313\"\340\307E\250BN\206bd\004\364\261\003\235\264]\327?\377"
+	.ascii	"\347A:x8\351\277\323DM\233\003\021\300&<\021[&\251\035\"\245"
+	.ascii	"\377\274\362\003\206\257\330\262\226\263)v\227\345C\017\021\024"
+	.ascii	"\242\226R\371\215\357&\214/15\032\360I\002\323(\266U\367\031"
+	.ascii	"\241\355\302\"\004\236\006.\005\223a\025\303u\235\fj\200Q-$:"
+	.ascii	"n\265:\275l^\247\362b8o\213\2019\2456T\347m-\t\254\022\301u\333"
+	.ascii	"J\245\3526R\314\365l#\216+\354\204\256\370\032!P\333\302\205"
+	.ascii	"\030[S\3572c|9\221\027q\361u\214\301d\232\2271\312\034Bv\264"
+	.ascii	"\220%\241 o\b& \200\002\2411\354\006CC\217H\214k(\020{s\355\022"
+	.ascii	"n\315\360\2363\021s\236\363\256\177\354\030'\331\323`\\\335="
+	.ascii	"\270\333~C%\216\033\n\235\027D\373'`\304\200e]\300\206\350]\257"
+	.ascii	"\263\266\215j\330E\274F\207.\331\220\350h\244^fJ\351\376\335"
+	.ascii	"\210K\240\021\016\024"
+	.text
+	.section	.gnu.lto_updateBatteryBeeperAlert.48.3846b59827e8a97a,"e",@progbits
+	.string	"(\265/\375`@\001%\r"
+	.string	"\026\330VC\020\2176\035\227\263 H"
+	.string	"\261\017\264\210g\230\037\340^&1FAr\230\346W\013Wu\311\303\202\236\303\3767\253\365M|\271\327\252\030\377E(@E\250"
+	.string	""
+	.string	"\200\334\036@E0U\007\203\377\275\311\226)\005C"
+	.string	"A"
+	.string	"D"
+	.ascii	"\326\347"
+	.string	"-\213\354\224\203\247\265x'\t%*v\367\222\027.\372\244\244\212|\3750\341\272\355SC\202\272\310\251\f_\n\256\253pI*U\004\276\320\003\323eH\265\034\330]+\327Q\270\253\333V`[c\037C\037\206\020\322s\237~\250\372\224\362$W\013^\210idc\244\243\r\222Tz\366\3458\216+\226\035\266\252eei\2340 bw\302\270b\3059\002\304\366\375\221\223`\\\2035\334\330]\353\323\306\260\003r\363=\034\203\"n\312\342_\370\241H\020~\b\265r\233\001\022\262\034%\376\007\247\\v\267\233\376\213\352S\007l\004\317Cew3\237\366;\370\246\313i5\026\334\214\310\023\204\034+*%ma\037\374\206\013?\356lB\231\007\004\342,\270\264\f\323>\036\355\3720\3404\270:\231vm\n\030s\340\311.\020\206e\227\005\216N\255\3540\202N\034I\222\317\341\247vw\247\005\205\311\003\234\230\240"
+	.string	"\350\345Xe?\320\364\234\005\234\224\020K\001\035"
+	.ascii	"3\241\233)\006\340\005\017r\201\354\300aS\r\017H\261T\342\340"
+	.ascii	"\312g\006\272\306\022 .\350\307S9(\2726f\266\221\314\306B\252"
+	.ascii	"\355\272\240\006\224\211\227&\3069\007S\370\313!McN5\n\234\350"
+	.ascii	"\334\362\004"
+	.text
+	.section	.gnu.lto_batteryUpdatePresence.49.3846b59827e8a97a,"e",@progbits
+	.string	"(\265/\375`\232\b=/"
+	.string	"zR\374\021B`\236\316p\212\2013P\367\334\264\316\3621\252y\023\370U\036\007\361#\026\200Qn\\\367\231\230\255\3072\236\027\317%7\017;b\336\362\005/|\005\267\021\032\247\201\346\266EWD\320A\215\354\275\245L2\f\001\355"
+	.ascii	"\025\001\2132o7/3\357) \241-\203\244]i@\346\032\366\304\263\372"
+	.ascii	"\245yl\247\3627\377\270\177\356\350\356\355\2508)}1\327\261\021"
+	.ascii	"J\374\342\004C\234\271\237\262\305G\271\024\344\233\253\247\364"
+	.ascii	"u\\\277\316\300hY\327\325\303\360\251\322\207\324\247\350\205"
+	.ascii	"\324\247|\271\323mq.i\315/\356\255\302\360\351BI@>n\206\022\027"
+	.ascii	"s\r\203Z{\023'\270\256\314\005O\227\301\360\351\"w\333\234\251"
+	.ascii	"\266\276\316\212\262Np]\327\2476r\344\217F\240\037\237b\017q"
+	.ascii	"(TS\264\031\2717\360$\013\330\030\327\217j7\376\211\251\241C"
+	.ascii	"tC\030\350g)\204}\320\241%\252\300M,\b\027\205\026R3}p\212\220"
+	.ascii	"-\337\263T\204\354\307\211?\354"
+	.string	"\276\344&\346\203\207nbf,D\231\306\234\255\371\237\030\020\264h)f\207\222\325a\331\323$Z\034\243\301\r4\366\205*\255\353z\272\263\2151/f\241\205u]\227\301\306\310\276A\337}\203\335%\261;\364\t{\302\036\236\270\027=aC\350\002\264\303\353\272ru\247\251\375\256PF\246\331\367\305\203\233\266\212\342\\R\f\327\365k\302~\313\363TLQQ\251O\323n\034eoK\2719\376\352\251\b\272\251O\367\240;\345\023\246F\320\r\330$\005\321\346fj\244\273\344\022/~n7Zu\274\273n\326C\363\346\276\322\271,~\305j\270\256\353\204}\225[i\261_{\272.\260\370`O\367X\352\323\367\247\374\300\235\262%K\271\271.~\3562\275\270\323v\217\256\215\266\233\340q_\247\317}\233\232\027\301\233_\246\346]:\225\257\222\220\267\200\2207\t\345EBy\217\316kt\336\"\346%\300\274D(\357"
+	.string	"\346\025\300\274C(o"
+	.string	"\346\025By\0014oP\363\036\233\327\210\362\002\235\367G\345\365Iy\213\315\333\323\274D\346\035\242\274B\346UQ\336\2649V\0278\240uD-\324\004Z\335\033\320D\031\016\347\315\200~ \305igN@\357\331\274\215\225\006\016\034\324\247\235\007,\316P\013\265\200V\365\222n\001z\250\303\325\244\t\320\257C3'\324\357\302\006\250t\002\350=\340\317Dy"
+	.string	"\001B}z\245\006\320Oa\224N27#\302\204\036X\234.)\365\257H\226\347-\260\247\323\"\310\275\251\021\033-\250\217z8i\362\005u\202f=\245\223\301\217\035\324Fu\311\245\261\271\217\255\336%\237"
+	.ascii	"\265\261\217\017\250ow\264\255\b\035\270=3\370F\313p\206\372"
+	.ascii	"\323\031\3228uS\3774T\222:J3\257o\2313\206\210\260\323\226\321"
+	.ascii	"\005\177`\230\034)\203/\265\215;\251>MT\346\246\271g|>\237y\356"
+	.ascii	"\244\026\333\247\237\\z\375\313\301H\355\327\226\204\t\023\352"
+	.ascii	"\323b\027\377\332\300\231-\265SC\255\325Q:\325N\333\237\231\353"
+	.ascii	"\312\2256ZO3\337\263\234\330=}\244\227tK\233\330\3522\211\335"
+	.ascii	"\033\355\264\035\366\373t\232\001ZWWUTi\f\025\\u\265bjK\312\270"
+	.ascii	"5\205\301\005V\326\206*\026S[WX%\264\254\216K\345@FV\325\326"
+	.ascii	"\326\324\212'\255,,\255\027UZO/\254\246\\<Qei=9@Z,\030UYO[XX"
+	.ascii	"YOEf\327\321\265\321\366\003\027\277\256\366:\026\350\335u\300"
+	.ascii	"e<\232\272@\217\200{&\265\026\326\201DbT[\327\225\302\362\030"
+	.ascii	"\223!\223\260!\333\332\220:)\f\251\323\263,pfJ\300\226~\306G"
+	.ascii	"\251G\275\242\211\346F\024\222"
+	.string	"\t\210\243N\231\340\3311\343\032\007\273@\364\272\023\264R\367lX)\224s\367\026\030\245\356\001\371\253\261|\ttr\227\223W\035v\202\201O\036a3\362#\346F\235\241\251\213\332\250\177\347\324EM\341\255O\371\343F\036\037\236O\247m_J-\366\220 g\3154_<\330=h\204\265\025\327\366\234\304\341\235\324\253\355\341\r\023\264R\333@:i\362;H'\203D)O\301\3002\217Rw\221p\257\023utf\316\351 \241 \345\220tH:\365)1\357\371\026H@N\200\256\250a \006\021S\312\231\021\021i\222B\2411p\002\221)\253\252\003\020XV\243-H\322\001L\237\316+\017\204\375\3211&\032\2050\355\371^\330\2108X\230\321\177eT\3072\333\242\360g\246\303u\324&V^\312|\315\345\354jS\201\243\212K\273$l\277\310\250\034M\r\317CYs\337U\205\371.\310\240+'\2074\346"
+	.string	"\310\253C\315\031t\017\f\221p=V\275*\275<\376_\317\002\341\320\272\032\037\233\265EE\242\206~]\314\236\377\365\2759\200e\002\301\367\253\n\353ws\023K\224&\024\310\336Y\006\221\333x\177\374\371\017\027Oc\374\2070\363\213\220\267\2401il\224\211\360\r\360|\027\266\004i\355U\261\314\371\337\b\240;s\205\201\341\360\302,\3739\307\004\b^\264\340k\001\364\321\0040\331\233\255\305\375\247j\372\213\001p\320'\335Ct/<\246A\2075\340\027\324\372.\025\242\211\246\002\255\337\020\376\266\036\210\201"
+	.ascii	"1n\254\335\367\022\016|\341\227-$\240\267]:up\020\335\343\375"
+	.ascii	"(=\346\332\211(\332F\006|L;\032l)\260\350 \b (!\366\252\346\306"
+	.ascii	"\354\340\322\220_\021\214\034p\3036\306\310\355\023\031fW\224"
+	.ascii	">\212\353\300\233\021\337\037\334\304\034>\364\261\304z\205K"
+	.ascii	"o\"\374\001"
+	.text
+	.section	.gnu.lto_batteryUpdateVoltageState.50.3846b59827e8a97a,"e",@progbits
+	.string	"(\265/\375`\227\004\245\027"
+	.string	"\306\350\215J\320\356*\035zqWNo{\226\005d\023\217h2\3171\232\274\241`\006\027\"\246r\0078H8\307\231M\374Lxc\273p\336!kW\032\364\034m\234\340\213\207\230\006\016\200\tx\b\211\260\247R}YI#\204\020\262\245\224)x"
+	.string	"k"
+	.string	"|"
+	.ascii	"\247\315o\346\363\362\027@\252\207\242@\260\326\tK-*P\364\201"
+	.ascii	"\371\277\347O~\244\365e\250d\213\206\232\316\260\326\272\352"
+	.ascii	"\226=\331\323d\226\344(\322\346\223/\3112m8\224=M\03527\013l"
+	.ascii	"\2262\267\034\223$kD\341j*,v\354VtK\213n:\312A\263,\001G\343"
+	.ascii	"\256\220b\302\315FU\255"
+	.string	"uw7\035e\222Uk=\333p+\373\323\376\007\372O\340\247\021\002\036\230G\347\313akb*\206\233/\316\221\312%\031W<\333j\r&\346_\337\177\244\246\260bX+\312^`[\035\300\221\302/\376\255\331\036\311\367\3451\023^\333\212_\223q\305m\003@39\031/\375\276\0317\357_Z\233\345g\276\006\3633\230\257j~\252\371(\312\307h\376\211\371g\363M\3147\233_6\237\244\374\261\371\"s%\314&\177D9{\n\301Bl\336\227\004i\0244L\272\257\326J\233\367r\207#Dc\245\223-v\331\033<*13^\372\330$\202\035\221\240\254\225\366\361\365\331\237\202\005\255\326\270\342\330\373\343\322\243-n\317\212\b\001q\271\306\025io\2160\307\335\275\265\027o\260<!e\255\365\343\373aA8\370\276\254x\221\327k\\\221\233\374\005\315\364d\274\364\335\260\250! \n\273\330\336\371\006\007\361\200"
+	.string	"s\225\224\264\030\254b\260Wl\304\025[\215\204\264DV \260\330\312#\300_\017\\\260U\311\353\005[\235>\331\322m\026\232-{l\200\262\236}m\366,z\252\b\016\223L\032\235\321\273\023j\264"
+	.string	"a.\230\"\243\311_\260\303\236zt\346\315\321Q\331\274\253\332\354\355\341\f\321X\251H\325\247\321\321L\216\334\001\022\215\2516\241\372\324\251\336\370\301h\324\220\020F\357\217\360\354\323\211\003\256\263W\307\305l\223\211c\250Qd\343\020D4\222\242\024\027\032\003\320\002\021\261!;\021\340\250t\f\331\230l3\002\272\205\022E\210\202\323n\251Rx\247\312\310\343J/\212\356$\302\352\313\271\306\314\260@.\236\203O\251\360z\214d\306\204\n\265\307\177\301/\362l\t\245\0279^\277m\3640$\361\203%\240~\3401F4\300\216\311[\223\025m\bDZ\235\350\177\334\215\275\376N\332\037\337\336\355\b\207\231\342\006kV\343"
+	.ascii	"F'7\205\177\370\251\342\335D\317Xe\024\301{\017\277\317%\370"
+	.ascii	"(O\036t \374%\356a\177\242\206\3176\330\336\221\240\f\306\376"
+	.ascii	"\002(\003\013\n#\2706B\004v\3356\254Xj"
+	.text
+	.section	.gnu.lto_batteryUpdateLVC.51.3846b59827e8a97a,"e",@progbits
+	.string	"(\265/\375`\366\003\355\031"
+	.string	"\206\256\244H\300VQ:\3620\270?K\b\017Q\026\215\001\341\206X\030\3441\236\277\021\367\013\216\352\206\n\351\331L@g\212\177\366\355\230\025n\353\224\236B\027\257S\336U\024l\321\024\254\001\365\331\200\335\270\312c&\226\020\2627\221;\245\213"
+	.string	"\202"
+	.string	"\230"
+	.ascii	"\306\261\307\317\217\266/\355\373x\220\316\205r,"
+	.string	"\326*\003\311H\255\275\007v\020~\"\370\212~~\227\241\237\326\261\261\274W\243\202?O=GQ\265V\326\376\\\347*1\004\351\374V\352\370 \215\210\313\215\270*\201\b\322\310@\361\342\241\013\034'ZH\260G\322\025\237c\356\026 GB~\037\003\035\024\025\001r\267o5e\206\2251\307#w\351\304\213\017A\255\365C\227%r6)A\232Z\253%.\207\342\036o[\207\355\n\366.\005S.8\243\013\217\026\262\326:bwg\246\277\350\227\203Q\022\217\374b\273\303\201\274\302Zy \370?~\364\301\347}\032\026\223\307}\3721\372\371\215\340\303\323\005\t\355\310)\273g\223\273\263\377\325\245a\203\322+*-s\241?f\245\307\225V\201\322\"(\035\202\322 (M\251\364\234\322\337\224\336OZ\256\364\007(\340\351`\374@m\225^51%U\225\346\221\033>\321\213p\336\363\002\037'\235\217O\007\037\272"
+	.ascii	"\2420DZ\230dv\265 \227\2360scVf_\364/G\256\t\351\007\b\220MN"
+	.ascii	"yJ\216\322\334\231\002\f\217\203\2733\362oeQja\322\267+\325D"
+	.ascii	"\210\356\256\3515\324\246p'5M\306\024^\242\266\304\254m\341K"
+	.ascii	"r\224\\\360\331\241\013\202\361\327(\222\332\001\247#\"S\227"
+	.ascii	"\250-\r\212\2020\231\257\321]\371\305\b\n\303\221ja\255\025\202"
+	.ascii	"O\344E2h\330\260\201~\356\376\310\306\275\204\204\t\240ow\362"
+	.ascii	"6T\256\314\350\351B>\304\306\347\271\345r\321\007\36603\003\361"
+	.ascii	"\242\325X71\030,\326\"0\253q\301^\025h7.\231\254\326\002\340"
+	.ascii	"\326\214\b\231\213"
+	.string	"F\263\341\300\232\311b\263\033\327\214u\363\262\201\261Z\262\031k\306\200c!\\2\026-\026\223\261\306\336\316\277\2724&\260P\332Y\233\352PO\3571\344\005\227E\034\267J\215\002'*WpYv\236\\\265\343\376\246\023W\2654\t'\006\222\032\256\270\013\300\334z\254\026\334p\013p\271\341\240\353\246;\t\005\327\300\225\033\220m\351\202RCRz\302\270Wk\rw\347o\2117u\tt\265\001K\250\021\300\220S\320\t\n\032\212\023$%\315\001p\002\031)\274:\021p-4\210Ha\266\031\371\214\2377\"PI\353i{\312\260\264)\352\235\bq\2612\212p\0178\367\321}\250\310i\227E\304m\266\374\205\310\246r\320uC#^h\350\365\342\"i2\3146k\373{.\3114\300)\210@\261\230\300\265\0319!\026\206\264\024X\022*~\210\237G,6\264\003\371\242\340%\301C\272\346\004\336D5\222\217"
+	.string	""
+	.ascii	"$u\\\310\034r\214\004\271r0\304\246\324H\376\301\030vu\311\273"
+	.ascii	"\253\260\211eE\246\345qd\231#\030\250"
+	.text
+	.section	.gnu.lto_batteryUpdateStates.52.3846b59827e8a97a,"e",@progbits
+	.string	"(\265/\375`\b\001\305\f"
+	.string	"\266\327UB\020Q\234\016\030\264\235\021@%\001@\224j\257\021\021\364\267\"\307s\236\037:H,8\206\274\004V7\204\310\377\217u\024\373\226\322LF&\236A\204\034\022P<\306\032\317\005f2\b\366\335h\223\275S\n@"
+	.string	"A"
+	.string	"D"
+	.string	"\340A(x\262\353\301\005\311\256h\300\005\260\323\313\005X\247\325\003X\247\006\355\031\027C\354Q\031.\214\344\330\335:A\034\274\004\375\207|\022\222B\227\227\202\335\265\fI\245{\3366\001\333\t\354{\004\037\366\224\306n\272\257\237n\353 \177E\261\234\220\261"
+	.string	"\307\256\206\324\216\035i\t\211\233\376\223}\321gq\221\023\350\222\"A\200\231@\337\322\036\203\016\224\007\215]\021s\352\003\330\351+\266/\355\253\370\212\026n\214^h\327\274\r\021>\352-@\376\b?\330\344\303S\177\263N\255y\221\327\0320Rp\020\311\224)\262\232v\20731V\210`)aI\373#A>\264,\3510\216f\310\026Cr~\260_\355\356z\006\033\215\344h\244\347@\353l\r>\217\326u\237\f\200\263\314\204N\373\276\r\247z\035\347y4\257z\266M\247f\235W3\003\314A\320\272\372q\\W+\342\276\332\371a\006(F\321\034\031\2331\262\207\374\033\256iMlbF\002\032"
+	.string	"2\241=i`\\ \210\003\22755\036Sc\202\024\320\256O\324E\252\025 \034HA\263\3415\005C\327@/\356\226\320"
+	.ascii	"\374h\302\302E\035^A\004\234\242A\254N\203ky!L2"
+	.text
+	.section	.gnu.lto_getLowVoltageCutoff.53.3846b59827e8a97a,"e",@progbits
+	.string	"(\265/\375 \365\315\006"
+	.string	"\362\314/4pM\322\001\240\f\340`]\002\214\002!$\221\323gs\321\337\032B\327o\riI\217LN\331\245,\2511}7\0040\224\r\036\031\325\030\240\244\221M\366N)\266P\030i]W\265"
+	.string	"\247\214\363bMxa\250\032\240ENH\0258:X\022^1J8\325\275\363\330\037\230\264\2739\365=^\037|\214?c\260v\372\347c\321\237\301\306A\330U\323\\\205}h\235\307n\001\"%\n'\273\022\237\224%y#\031\2663\366\344o\234#\343\214\240^t"
+	.string	"L(\"@Pv+t\375@\364'] \372s\026\317\3362\377\035\2074B>\224\243y\253$\354\256\033\345tnw\333\007\266\021lO\004\b"
+	.ascii	"2\003\336::V\b\3055\261\032!\264\020\231\270+\246v\222\001"
+	.text
+	.section	.gnu.lto_getBatteryState.54.3846b59827e8a97a,"e",@progbits
+	.string	"(\265/\375 \366\305\006"
+	.string	"\002\215/3`m\322\001@\203@\3246\326D\016Ct\310\236\241\005!\314t\251\005\337,\352=\234d7\320UB\357\222\225\227\300\024\205<\327\"\326\370n\311\336R\246\024\316\\6p\262,\214\302\253 Ui\246\352i\0260\f/\003\253w)0\3250\301gQ\024|R\334+(\325\362Q\007\373\037\217\227\237\341\r'\217\335\371\234\350.\025`\342\223!;zR+\354\267U\220\355t\252\300\210I\002\311nD(eK\234\210\206\355\216-\371\034\357\350\370j\361\"\013\200\300x"
+	.string	"A\331\215\317r\202\350\256} \272S\213_\317\313\277\307\333F\310\t\226y\236\025\204\335ub\231\304\255\267m`\373\3006E\b"
+	.ascii	"2\003\316:#f\b\3055\3616\002g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_batteryStateStrings.55.3846b59827e8a97a,"e",@progbits
+	.string	"(\265/\375 \357u\006"
+	.string	"\204\013\216"
+	.string	""
+	.string	""
+	.string	"U"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\370\312\002}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'2\206\b{\by\276\003\005\001'?\206\bwu\301\002\005\001'I\206\bsq\304'R\206\bom\306\001"
+	.string	"?\202\210\200(k3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\005INIT"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/battery.c"
+	.string	"\fNOT PRESENT"
+	.string	"\tCRITICAL"
+	.string	"\bWARNING"
+	.string	"\003OK"
+	.string	"\b"
+	.ascii	"H \r\002\006\204\203\214\001\341<\363hP\371\r\240\b"
+	.text
+	.section	.gnu.lto_getBatteryStateString.56.3846b59827e8a97a,"e",@progbits
+	.string	"(\265/\375`S"
+	.string	"5\t"
+	.string	"\306\221@9@\217\322\001{\355hGb\340\3374\237:j#\217]\\]\0075\034\f\244\236\275\301\253\207{D\210\r\366(\251\t?\217\361=\272\n\020bf\246\355\305\361\033\331d\357\224\002/"
+	.string	"/"
+	.string	"0"
+	.string	"\252\214I\313\342%\333\255\324\365\003\333\247\346\002\333\247\3248\351\221\344\337u-\346D\005\225\252x\3140\354\256#*\245\272\345m#\330V\260\355\022\266\243\245\214\216Z\200\214\245!e\367b\006\263+\023\306\341\203\274\212\376a\200SL\266\273\334\247-\262\271\317\333#\233\363;\35612\211\240n\004'\361hg}\332\003m y\327\023Zb/\260\207\\\004\364Y\226\b\305\243>\375\320\366\031\345\353\017FPZ\030\2458\263\253)\312\f\373\332\312U\356l&\276.\f9\016\024\374<\360\323\201\364\363\300\361\320\316\007\322M\201\275\210\356\243\241\347}\224\253\245k+WR\032\224\244\311\266)^\002\241\331=-\370\257\f"
+	.ascii	"2\241\365/\260Z\302#\235\2333q\216\324}\256\341DL8\250B\027T"
+	.ascii	"8\342\256\230\332I\006"
+	.text
+	.section	.gnu.lto_batteryInit.57.3846b59827e8a97a,"e",@progbits
+	.string	"(\265/\375`\301\003\335\027"
+	.string	"6'\220L\240RR:\226iT.];\244\272\210] \313x\276\301\373\332\324\213C>\206\377g\316b\222\253\371\376\212\300\232Yk\177\316\370\037\365\307$~}\207\247\245\263\322Z\351\214K\023\016\372\026*\277\005'=\244\205E\257\221M\310\336I\006w"
+	.string	"y"
+	.string	"}"
+	.string	"_m}\272k\355\372\332\027\360$\256d\027K\2323\207\224H.\232SE\335}Y\343\356\343\235\204\362\243\2029\302d\316yf\203\216\177^\263\264\025\367\253U\212\376v?_\274n\275\361\204\376B\334\314\020\340\207s\007\fQ\235\310\261\345\201/YHU\241\277\017\267\345\bX\216Q\366\353\225\tp\222:$?_\255\247J\316\271+\372\363\360\216\275\273y\335\215\240\273\214\005\257r!\002\360m)\031\373\345C\333T\003 \344an\267\204K\301\224\364\3109\247\364g\234\306\204>\321\315\216\241\321\214\307\250\313\220\251\321\234PZ2\267\017\3431dfhh\356\315S\205\326\233.\314\325\350L\237\254d\337v\373-\356\302f\001\207\2737M#\017\245\362\271\333gz0\327'\352\013\272z\364f_wo\236"
+	.ascii	"\021\355,!y5\355v\352U\373\323}\233\246iE\370\b\037\341\024\030"
+	.ascii	"\211(\"w\261p\222\356\300\037\330!LV4\233\264\312\256\206\225"
+	.ascii	"\006j7\006b&\222\241W\261gw1\241\334!\367d\223\221aWqW\303\032"
+	.ascii	"\253F\220\307\036\303\275-y\362\341\253`M\327\241 \226\263/\245"
+	.ascii	"\237\343\305\005\fV"
+	.string	"V\356\315\333\023\n\371\025$P\277\364\253\226X\316\274\243}\253\343`q\320\322rov?\200P\217v\035\332(\372\354\256\373.\267;BMC\321\335j771\024f\270\233\rgS\303\315lfbjf\264\033n\206R\240m\025j\267\331\215\315v\233\311\234x\267>\007>FL\213<\333\353w\275<I\254\020\362\021\"\322-A\344\271\327Kt>D5D4\207\364\223u\204Q\356A\366\203\3641\366\343\237{\263+\2325l0:\220\356>Z\020W\311\234w\337\221\365\370j\221\240sa\023[\325\236\302\027'Z\370\350\307\2630\n\034[\250a<\314\024#VAJZPJ\007\260\002\021A1\017\021@=\224\214\2522\255\001\002\216\244~hI\222\342\344\333;3\215\204\200\375\232\364hb\243#<!P[\201\r\322\362h.\312\326\220aR\210\005\021 \271\263\377\276~\005\200\b\346\034\220\017E\030"
+	.string	"\001\361GR\312\263B\241\020\"\362\025G\371~\177"
+	.string	"\265\320  \205\230\230t-\370n\235\332\215t\324\372\0239\\&b\3708\t)\004"
+	.ascii	"\357\200A\315\301\025\224Q\307\225h\202&\340!\353+\335z\260\213"
+	.ascii	"`] \315!C\272\347\004\036\310C\265{}\357\033\314\017\304\355"
+	.ascii	"k\300}\302\267\257\236\224\005\rx\252"
+	.text
+	.section	.gnu.lto_batteryUpdateConsumptionState.58.3846b59827e8a97a,"e",@progbits
+	.string	"(\265/\375`\230\002%\022"
+	.string	"&\340rG\340\320(\035\332\215`1\035"
+	.string	"N(\302F\2329\2270\253q{\t/DK\242\210x7H:\013\022>u\203\307HQ\253\252\376P?a~\210\300<a\020\222i^\360\334.\fwe\216\020$,6\262\t!R\246\024^"
+	.string	"Z"
+	.string	"\\"
+	.string	"\337\273\227\374\262_\374\346a\243\314\316\212\216\321\356\202\332\341\257o\220\276\350u\234\346\313\217 $\331\f\345\033\036\244/\210\345\205\353"
+	.string	"\301\342\2221\202ph\201\271\027`\266R\232]\310N%\271\224T\333=\202X`\270\216\335\275\315\023\303,\226\031Av\327)\233\265\334\245\333\306\261\315\300N\225%\027\261\372vS\026\370\267\343P\360g\336\271e\222\227\275\363M\274w\327\250\"$\303\006\313#\373\026K\245\331\347Vc\354\327\356\310\2459.\255\232\316L\277$\340\206\205\004\237\335\fG4\026\250\353\251y\355\366o|[\002\005\257\327N\276\375\020ydL\300\330\275\031x\347\003\001\"\"\336\273(\324\302(\206\2474\277\304\243\022\240\261\311\031\342H\333t\312\313\242\336\366\327lx\001\212)\212}\333\335\356\304S\005`\373\316yN\374\031\207(\224\367N\365EC.\260<\312sJ\363I\274\324\254\221:\t\022\235\324\217\030\312\335EQ\245\371\026\274\353H\216\213\224\234a;(UJ\2252\225\204\016B\224\311\245\nO\254\260\301"
+	.ascii	"\237>*\260B\227\3134\002\266X\253\226*l\201\252\224\251\004<"
+	.ascii	"\261Z\340G\001\257&\204,\320\265Z\261\300\322\rv\215\261\315"
+	.ascii	"?\237\032\020Lc\033\376\351\212~HWA\304\261\273\237\322\034\225"
+	.ascii	"\323\323\344\254x\360\024\020z8E\240\201(\204-\346C<\377\304"
+	.ascii	"Q\204D\b8 \320\002\251!\363\263d\221\263\355o\262\237{\333\367"
+	.ascii	"n,\256p\344\346u\3672e\241-\334^\2755\3541\b\305\225/[\371V\215"
+	.ascii	"\270\360\255\273\360`\375\222/\372s\233U\244\313\200\354Y\246"
+	.ascii	"\322\356e#\233\371\250\332M,5\024=\036Q\203\006r\202\244\025"
+	.ascii	"\311n\321r\\4ap/\2702\234\263\002\023\334\202\033\355\205\241"
+	.ascii	"\020z\273\321h\365\325\243]\207\217\3452"
+	.text
+	.section	.gnu.lto_batteryUpdateCurrentMeter.59.3846b59827e8a97a,"e",@progbits
+	.string	"(\265/\375`\273\005E$"
+	.string	"\272@@\016Dp\250M:\307\316X\2358\210sF\027\325Z\024mfN\270\020x\001FL\270.\355\3167Y\0174\257\036\246\313w\374\206u\202A\b@Q\267P\254\013c\305G&2\330;\035\004=@\243\021\262\t\3312\311\317"
+	.string	"\302"
+	.string	"\331"
+	.string	"b5r\024\211C\017\246\227\033I\300\341\245BQD\363\202p\2223\230'\371[\316\005\307\207l\323R;O2\343`>O\366\311\314o\346{\375\013=\230\016\266\335\233UFv\357P\002G0O&\035\311\236\034?\300\236d\224\331\317\207L\356\307\024\203_\322\356\275\270\272\344\350O\"\233YZr\254\215\362\241~J"
+	.ascii	"#\205(O\033\257.[\271\364(\"7\223\246L\021\351r|\200vf\320\347"
+	.ascii	"LU\215H@\240\b?\026l[.\205\275\303\023\036\177\310gM\031\221"
+	.ascii	"\"\242\332a\217\026dM\025\031G\ngE/BYA\214\274\216\025v\244Y"
+	.ascii	"\335\250\200cQ\241`\235\207\275{P\375\272\313\245{/\267\220*"
+	.ascii	"\310\271\350\314\f\207\231y\314d\213\267Z\n\n\256u5\252G\365"
+	.ascii	"\\\316a\212\025\230+A\261(\277\243y\032\022O&LX\233\226\032\241"
+	.ascii	"Z\305\265%\316H\240?<\231\n\363\336\250\013\371en\346\004\177"
+	.ascii	"\353$\247P\241\302\262`\352\013\271\210M\031\021X\241\030\017"
+	.ascii	"\031\030V\255Z\234\263\257.\272\344\001v!\346\207\271\230\034"
+	.ascii	"\177\213u0\372B\030\366\344k\026\256\255\253\257\252\250N\231"
+	.ascii	"\207\277\256Z\314\257i\232\246\\\2250\333f\004\367rF\272\330"
+	.ascii	"Y@\331|t6\337\016\366\033\235\315\266\263\331\264\315\345\331"
+	.ascii	"l\211\232I[\363h6\327\262\271m\363\023\274\f+\355\317\n3\367"
+	.ascii	"\002I\325.\221D\303u/\277\330\311\256\314g\376\220\377\345c|"
+	.ascii	"\006\374\255\223\214r\241RP)\366$Y\001H\215u\241\211\352\324"
+	.ascii	"\332\252\326Y\315\2215|\314&;\326\"?]\3644\350\243\223\260\314"
+	.ascii	"h\025\364J_8V\373\205\005\254P_\320\206\312\220\262\206\025P"
+	.ascii	"\r\270I\202$\020\035\006Z\320\257\276P@\375\330\317eF\204\370"
+	.ascii	"\213\363\"3!D\253'\017\032V`MA\337*\263\206\r76\207\376\346\017"
+	.ascii	"#KC\203\352C|\247\007\032\026\222\316\353\334\016\373\261\220"
+	.ascii	"veU\337\241\205D\276\234\346\026\336\037\302(\027\013\016\377"
+	.ascii	"\354\357`O\212\270q\212^X\356\275\016\356\206\357\205\372\225"
+	.ascii	"\311\344R\330S\364J\273X\327\301\211\265\243\327\230\331\303"
+	.ascii	"\313>\230\367\002/\360\331\274\r\210\020#F\330\223\265\226_\326"
+	.ascii	"\272\300\214\252\032(\\\305\253/\253\243\032\034C\2517C\206\357"
+	.ascii	"\t\347\264kj\332\345\016\364\236|L>\022>]\357\305\213\020\272"
+	.ascii	"\031>\337\216\027\303w\353\231\3205\311(\341s\322\361xO9#\316"
+	.ascii	")\335\340\351|>&\027\270\036o\327s\322\365pN2\230\232p9^\017"
+	.ascii	"\247\224\200w4t<\234o\267\343\341\316a\324\253\022\356\372\343"
+	.ascii	"\3179/\215\367\336{\366Mof)\021h\366\207\375>\314\f\021\211\252"
+	.ascii	"\026\267\t\341E}\316\234\225\021n\253=\300\\\315P\222\003S$4"
+	.ascii	"R\265U\263\242"
+	.string	"K\320&}!'\005+\024#\250f\200>\301\265?\201-+\202\312\035\254\372u:(\207:\201Q\326\tV\310tU\331\250:\253\261\266\"\325\356#u\365\353\224\311j\353(H\352,\252S\245\007b3\346\275\027\003\377\317\001\241O\002q\250q\030\311)\305\314\314\214L #i\222\016\200\002\0212\243\036\020p(\243I2\214\001\315\2729\344:\235\026 \205x\3158\377\333\366Lb\217\345/\264\203\233]\360 a\334\360D\310\334\033\332\236\001\216\206p2&S\032\374\341\246\340\364T\364\306M\231\201\321\264Z\206\001_?\262]\221\344Dd\215N\343\302)\305\266\323\016\255{\201\332R\370#\247\243\316k\327\320\313\270\305Ry{h\242\306\016S[\332\215\302\342O\035\307x\321R^\2771P\254H\350\033\300I\274O.\221F58\203\"\353`\244\241\274\340\b}\006\316\204rC0f'C\334\320\\\203"
+	.string	"\263\303\2758\034\330`\307\rVr\261\250(\355.\333|\371\263\203\305\253B\304\253\277\304)\314\217\355Q\247\007\004:D\231\036='\316\347a\t\355QQ\305\205\207\254(\371"
+	.ascii	"(d\024\301\245\006"
+	.text
+	.section	.gnu.lto_calculateVbatPidCompensation.60.3846b59827e8a97a,"e",@progbits
+	.string	"(\265/\375`\307"
+	.string	"U\013"
+	.string	"\266\325M? O\234\016 \006\230\361'\033\021Zd\356\340cj`l\\\240@Ng\" \303\fz\006\221\r\362\326\007\005\032\225\027g\202\266&\201"
+	.string	"\024\244\240\024\377fC\361\200\213\345\t%D\366\2262\2459"
+	.string	"="
+	.string	":"
+	.string	"$\\\354nE\371\200\351\021^\300\364\250\031\256\035jj~\304\002=\224Pt^\350\220\262p\235x\034\244\354\3569\236\031\236(3b\331]g\347U\270\343m3\260\255\300\376\202>\\\305`\353\277;\237~\224t"
+	.string	"Q\241\371\330\235\020\002\262\036\361\304\206\177\277\255\371\034\226\3743\211\nQ \200Q2\321bw\017<\032\001\365\350\203x\b\315&\301\221\206\215\227JH\b\"h"
+	.string	"i_\020\362]\252j\350\251\252\341\231\256\230\016\026\\\276\260\235\275\303C\355r\t|\021\037\021\301\337x\364\007\224\357\036}\320\364x\215`||\370\266\f\261G\242T\r\007\230\245\271d\032\004p\246\362\301\254N\347\202\2512\354\3128VVq\034\\6U\006\313\252J\001_\017,\254\352\\\027VIF\333\241\246nR\254H\223\276vr\273\233\001\325\f\333\252\223\013\034<6\r\023"
+	.ascii	"seY\203m0bf\202\007G\006\254\340\006[\260\013\205\035\3352\031"
+	.ascii	"\272\206\207L\220\240\342}L(\213\332\006\270\006\215\302g\250"
+	.ascii	"!\333U\312"
+	.text
+	.section	.gnu.lto_calculateBatteryPercentageRemaining.61.3846b59827e8a97a,"e",@progbits
+	.string	"(\265/\375`q\004\315\035"
+	.string	"\2068\302H\240VN:\305(\227\342\007\307\276\276\034\025\254\3548\256\232=\340\013\214\272q\306K\013\363\354)\351b\252G\342\323\260)lR\3006}!\\\303\035qt\330i\364\372\267\250x\367\244\305\241\026\207\246\336\361\304\356M\344N)\251"
+	.string	"\234"
+	.string	"\265"
+	.string	"Sxh$\231\"\314\0272\214\032\251\361\255?\353\323\276W=[\361\035\357\262m&\361\036\216\251B\303\272\320\347\262\355\303\363x\372\226\323H\026\031\251\276\310\034\214\2476\337\251\247\3639\365\324&a\333N\247\375\344k\331\366,\340HZ\325\274hH)#\311\341\201S#\030O\255`\301\223\201\037\306HQi\200Muq!\311!na\034\370J\305\235@\277\366@\304\322\262\204*X\342\265\352T&Xu\361\0264a\013J\315\345\372D\021,E"
+	.ascii	"$I^\353\363D0j\316\332\003\222$=\251\202*\356\332m\207\260\255"
+	.ascii	"d\213\301_\037\262\363g\234\372\303\322R=5\332s]\300\013\263"
+	.ascii	".\302I\222d\211]\027\006\326\257\007\256+R\323\213} \017\002"
+	.ascii	"\364g\030\004o\236\212WO\277\265\027f9V@\3150\3660j\256\013\373"
+	.ascii	"\"\271-l\244\243o\335Fu\272\350Y7Q\235\036\032\247\205\306\351"
+	.ascii	"\240:\rT\247\177\352\264O\235\356\251\323<\342\364\3168\2553"
+	.ascii	"N\347\214\3238u\372\246N\333\324\351\232:}\023\247i\306\351\231"
+	.ascii	"\332\264\255N\313\320\351\030:=\326\351\032\235\256t\232\322"
+	.ascii	"i\261N/\235\236\342\364\003\004\235\005_\233%\022\243\331\333"
+	.ascii	"~*M\302\301&\214Ph\366R\310\204\266\235Y\212e*\215\302\23581"
+	.ascii	"y\023\013\0270`\250\247\266Mp\003-\207\220\372,\322\200\263\263"
+	.ascii	"\2501\257\264\003\357Y\237\365,\317L\345N"
+	.string	"Re\266g\357uQ\207\214\"6\306|\230\305\254\314\212_e\224q\353\306\354K'\265\035\367eYm\205\222L\245\021\371\017\337\244H\022\n\211n\335 \261\362J\334\271t_ZE\3150\336\025\327\007\254,s\206#\3210\222$\311\3007\362#\0338t\350POw\217\204Lh\264s\217\225e\254,\273x\247j\264B8j8w\"\272\005VHR\212\201\037VJjR\372\345x8\246\036\217\327\323\0019\375\226t9\0219\b5\273\017\271\037\323N\347\333U\270\261.\311\311\267\373\375r\036pM\276^\023\323\256\t\307\264\224\343\341t\276&\\\322\220{\"v>\334\257\327\363\341lC\250\213\337\026>X\025z\024\003\006l\210\210\264#\236\244\315\0139\321\236\260M\264\327\372Q\260\330\022\006\265Qb\255\331#\264\242\255Q\362\241-\332w\t\355\320\212_A\253\263Bk\240\253\324\001\264A?k\263@\333"
+	.ascii	"Lyu[\236\375Y\\Wi\265\263<\021>%lg\247\030\231\020\212@\315Y"
+	.ascii	"\235-\360U^\341\354\314\346\354\017\226\322\352fql\366\2667\373"
+	.ascii	"\362*Q\250A #\221AJ)g\"\231\321\264\260\325\200\002\031#+\017"
+	.ascii	"\020XfE\311p\303cE*3\366\213\312s\226\322\306}\2363G\205\332"
+	.ascii	"X#b\001\270*,\254\343m\306\3741h\204\"\222/\032#\205x\351u>\027"
+	.ascii	"\361\356\377/r\f\r\235\362\017\300\271\305\331<~,D8<I!\233_\n"
+	.ascii	"sX\027\rP\233\r\317\212\320N\260\t\245\223\236\0348\250Lz\ti"
+	.ascii	"\201\315\032\264\025\345LF\003\006\242\331\322\223t\360\214\302"
+	.ascii	"\357z\200\320\211\257\373\324\206\2620\332\325\203z\256;\376"
+	.ascii	"H\tx4Z\":*\252;\237\330YRD\276\177j"
+	.text
+	.section	.gnu.lto_batteryUpdateAlarms.62.3846b59827e8a97a,"e",@progbits
+	.string	"(\265/\375`Z"
+	.string	"5\t"
+	.string	"&\021@:0\345(\035\200o1\21718\017FF\024\331\276\302\205\202NckQ\235!g&\232\362\233\352\036P\033\304`n\257\376gF\212\265\006\024=\247\020\301\203\317lA\032\331[\246\024-"
+	.string	"."
+	.string	"2"
+	.string	"Z\3627\316\356\276\365\f\030\232.-\036\345A\314\244e DI\002\025\007\370\326u\"\374T7\316\356Z\301\220\342\326n[\3016\202m\224:\263_\237\306\f\373r\343\312\276\372\232\301\205\n\347\262\253\232\001X\230v\322a\373\032\227l\226\277X{\222"
+	.string	"\251\221\227\335\235Q\343\245\313\030\002)\025\260/\232\316\222\305J\242%0\217\236\220\025\224\312l{\007\201\b\330E%\370\037wE\370\033\327<\"\351\301k>\ts\355qK\211x\270N\001\376lF\035H$\352x\246\327q^\b\344\315\020C\247a~:on\n\3149\200\272)\342\270nj^\247\313\215+/`\300N\361\223\031\265\271\007=\350\r"
+	.string	"3\241\305/\306\326Pq\330\233\250\266@\n\212\270\355\206"
+	.ascii	"]\303\t\230\340/\343\022\227\313\224B\355\001"
+	.text
+	.section	.gnu.lto_isBatteryVoltageConfigured.63.3846b59827e8a97a,"e",@progbits
+	.string	"(\265/\375`\n"
+	.string	"E\007"
+	.string	"\"\01635Pm\323\001d\222(c\336\342\233H\213\002E\301\321\303SL\326\036\274\037,\031\304\016\002F6f\370\250\263gf\306\n\206\327z\005\301(&\232\374i\023\271S\n\276T.IY\226%!NYM\f5#F\301\262\020/r\306\n\305\025\003%\243UU2N\\\366h\265\243*\220\251f\177JWU\t\244\001\321\334\360\216\t\260+q\340s\374\343\340c\034\372\341z\337\016\375K:\274RF>\331\353lN{Za?Z\355\330~\326\367\374(@C\004\202dw\323\225l\b\374\360\330\316\330\223\013\f2\306\316]l\356\231\320\200B\273\\T\213c\177\230\377\215C\217P\267q\"\376&\b\273\353\267q(n\275\355\001\333\004\2663\002\t"
+	.ascii	"2\241c\037\030\302\004;T\241\270&>F\344%D\016w\316\324\316'"
+	.text
+	.section	.gnu.lto_getBatteryVoltage.64.3846b59827e8a97a,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"\035\007"
+	.string	"\262\31514`O\322\001D\002\241\374\204\321=\241\006\3220*X\357HA\372a\005\2435\244m1\034d\027\221\261\344\246\037\206\303\002\303\271@<:]\320\242F6\2212\245\336d2Xa\230\206\341]\320\2728\325\3658\r\032\207\267\201\327\313\024\330z\250\340\303,\013>*\356\245U\221\365"
+	.string	"\244\022\266!N\242\001\354\256\202?\362\030\341s\3349\353\344\267;\277\243\001\"\240\034\331\361\223\212a_Z\025\331N\247\032x\250d(\273\024\243\227Mq'\035\266=6\345\177\034\304c-\343F\305dr1Q\322\262\033\237\300\t\246\273\374\300t\247\032\327\236\232\377\220K,.+[\350\363\304,\354\256s\013Y\334z\333\b\266\023lg\004\t"
+	.ascii	"\002\013\255\262\030\207\"\036\031\002r\r\277\215\030Y\210<\334"
+	.ascii	"\025S;\311"
+	.text
+	.section	.gnu.lto_getBatteryVoltageLatest.65.3846b59827e8a97a,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"\035\007"
+	.string	"\262\31514Po\322\001\340D\223\005"
+	.string	"\007\336ce\007\006G\200\225\217\310\350\217Cqk\250\335:Ed\031\027\025\324\316TU\025c\265\377\271\030$L\207\017D6\2212\245\336d:\260\272.M\203\263\340\2638\225\3458\016\232\007\267\201\226\313\030\370AT\320]\357A\207\211\373iudE\b)\205\355\210\227`\001\273\273\340\223<J\370\036o\356x\362\331\233\357Q\201\221P\226\354\bJ\325\260?\255\216l\247S\017RV&Nv-J/\253\322P>l\177l\214\017\362\220\217\261\214\035\027\024)\243\302\244e7\272\201\027Poy\002\352M9\216=1\377\"\237X\\H\231\b\364\004`\330]g&\302\270\365\266\023l+\330\336\b\t"
+	.ascii	"\002\013\255\262\030\207\"\036\031\002r\r\277\215\030Y\210<\334"
+	.ascii	"\025S;\311"
+	.text
+	.section	.gnu.lto_getBatteryCellCount.66.3846b59827e8a97a,"e",@progbits
+	.string	"(\265/\375 \350\205\006"
+	.string	"\"\214-4Pm\222\016\004\004a,\240\002\321\254\0130"
+	.string	"\341\031\201\242\325\330[\262\253\366\357\326{9-B;\020{s\314\314\0209]\234\334\207"
+	.string	"\006O\030\337>\3312\005c,\2327Y\326E\301U\217\2522S\3452\013\027\006\207y\225\263\bL5L\317Y\024\365\\%\313\266\0206\002O{\370fT\343\272\2425\033,V\351n(\225\260\005Lx\260\344\263\0166\212\357$[\350\307\261\rt|8\200d~JH\322C\342\030\375\234\257|\200\300\371jf\361\241\214D\020\033\"\231\231k\025\275\212\327-F'\027#!\030\250S\004H\310\314\021\003I\364\326\277\3407\370#\002\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_getBatteryAverageCellVoltage.67.3846b59827e8a97a,"e",@progbits
+	.string	"(\265/\375`f"
+	.string	"=\t"
+	.string	"\326\221?90\345(\035\036N\245 \"O\034\032<N\220>\f\032\035\215H\227\304s\350<\326\032\3661\330\0061\330\346Cm\016\003\003'\tH\317P\302\272d\341'j\204l\"eJ\0010"
+	.string	","
+	.string	"/"
+	.string	"\037\207\005\226\342aBa\355~Q\340\004\330a~"
+	.string	";\324\215{O\317\277\310!\306\013\313\t5zf\r\273\353<\241.n\275m\005\333\013\366\003\002\3667J\325\260\177\255\246l\2473MCM_WZ5\235\231>\346\200\3452\261\262[\321\002\260-P\245\303\266\310\316\370 \017\021\331\313\331\262\352u\223\237t\374\225\037<\036MPe\\So\n\340\355%\036fw\031|\222\177\021\376\352\320](\177:\364C\330\341\265@5B\312V\346h$8\r\004\3328\304\216\333\272\217\326\305Og\343\211\034\256\213\032\003o\020\032\027A\333\306\305\314\267\277VS\231\"\220\264d\250\331\245\251PO\361Q\n\016"
+	.ascii	"2\241\033(\260\365\005d'YN\025\337\232\354f,oe\346P\265\342\302"
+	.ascii	"\370\200\231\316\202\345\341Z1\t\223\f"
+	.text
+	.section	.gnu.lto_isAmperageConfigured.68.3846b59827e8a97a,"e",@progbits
+	.string	"(\265/\375`\n"
+	.string	"5\007"
+	.string	"\"\21624`k\323\001\200\f&\242\024\022\370)"
+	.string	"m\005i,\252\240\006\325N\351>\330\006y,"
+	.string	"\265M\265\027&\232V\020L\320\333\325\234\302\rZ\340\202\2036\221;\245\256L,9U\025E!NIM\3134\243e\201\302\020+r\306\211\304T\303$cEQ2J\034vh\225\243:\200if\177FW\325\310\203\371\310\354\360\215\031\260;\201\340k|{\360/\016\ra\275k\207\276\025\035^%\"\033\366:\233\313\236R\330\207V9\266\237\365=\037\022\330\204Dt\273\231\356\263 \320\243c\373bK68\270\370:g\221yg\303xFv\271\250\025\277\376.\377\031\207\035\037\016M#\361\007\220\260\273~\232fs\353m\023\330.\260\215\021\t"
+	.ascii	"2\241c\037\030\302\004;T\241\270&>F\344%D\016w\316\324\316'"
+	.text
+	.section	.gnu.lto_getAmperage.69.3846b59827e8a97a,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"\r\007"
+	.string	"\362\31514`m\322\001P8\t\344\037\244\024\22489\026\022\347\037\021\005`\005+D\263\250\367\0165\331\rt\225\320\273$Yy1E!\317\265b\227\321m\357-eJ\001\316\\6Q\252*L\002\244\342Di$\nj\0240\0130\023)x!\360\304 EXMS\204\225l\337VAV\313G\037l7\274\303\002\330\335\003\237\343\231\203\177q\347\r'\177\335\371\234w\227\032\260\361\311\221\235yR'\354\267U\220\355t*\0049\211\310n\304H\264#.$d\273cW|\214gtl\265\314\002{\241\017\b\217\223\335\205\226\017\274\273v\201w\247\025\267\236\226\177\2157\023Q\311\205y\236\024\204\335u^\230\304\255\267]`\333\3006E\b"
+	.string	"\002\013\255\262\030\005\205"
+	.ascii	"]\303o#F\026\"\017w\305\324N2"
+	.text
+	.section	.gnu.lto_getAmperageLatest.70.3846b59827e8a97a,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"\r\007"
+	.string	"\362\31513`m\322\001HQ\204\230\311]\335\350\311\261Q\362\374#\242"
+	.string	"\254`\205h\026\241\275CMv\003]%\364.IV^LQ\310\255\335a\206\353H\366\2262\245\306X4q\262\254\313\002\254\"Ue\246\nf\030.\r\020\023+h)0\3450EhQT\204\322\266w\253\036k\245\243\021\266\037\016\202\005\354n\202\377\361\r\302\317\370\263f\223\317\376\374M\364\227*\340\321\311\220\275qR+\354\273U\217\355t\252\201F\311%\262;\021BY\2227\362\261}\331\222\277q\216\313\230\3330\264\350\003\222\b9\331]X9A\364\347>\020\375\351\305\261'\346\277\343\316$\005\224i\234'\200\302\356:3\215\342\326\333>\260\215`\333\"\b"
+	.string	"\002\013\255\262\030\005\205"
+	.ascii	"]\303o#F\026\"\017w\305\324N2"
+	.text
+	.section	.gnu.lto_getMAhDrawn.71.3846b59827e8a97a,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"\r\007"
+	.string	"\362\31513`m\322\001\310ON\210sv\230R\320\325\004\3541T 8V\260B4\213\320\336\241&\273\201\256\022z\227$+/\246(\344\326\3560\303u${K\231R\306X4q\262\254\313\002\254\"Ue\246\nf\030.\r\020\023+h)0\3450EhQT\204\322\266w\253\036k\245\243\021\266\037\356\201\005\354n\202\337\361\r\302\317\370\263f\223\317\376\374M\364\227*"
+	.string	"\352d\310\3368\251\025\366\335\252\307v:\325"
+	.string	"4r\221\354N\204PV\344\201|l_\266\344k|\3432\3466\f-\372\204H|\234\354.\254\234 \372s\037\210\376\364\342\330\023\363\317qW\222b\222i\234'\200\302\356:3\215\342\326\333>\260\215`\333\"\b"
+	.string	"\002\013\255\262\030\005\205"
+	.ascii	"]\303o#F\026\"\017w\305\324N2"
+	.text
+	.section	.gnu.lto_batteryUpdateVoltage.part.0.99.3846b59827e8a97a,"e",@progbits
+	.string	"(\265/\375`\245\001\335\016"
+	.string	"\026[`E\020\221\223\016K\335A\224f(b\276\003\300\003\364\006!\212*\002\003\344\202\337\337)\204\252i\221\237\371\210\262\026\367gX\022\231\2664(\331\023\3004\240\025\341q8\301D\224\220\232\350\264\303gG\342\311\336R\246\024I"
+	.string	"R"
+	.string	"J"
+	.ascii	"#flv\277\221G\213`\217\007N\340z\204\037p=z\036\237\302\266\251"
+	.ascii	"\203O\266\215\177\252}L\215\025\231\326\356f\217J\342\247k\302"
+	.ascii	"\223\177\230wP,\030\256\001X><\005\034\002(\331]c \356x\333\t"
+	.ascii	"lG\260\363#\273\034z\354X\021\021\307D\013\223QJT6h\2003)\033"
+	.ascii	"\025\255\315\360\205X\346,JF)\360\251<0\240\301\302\321\332\375"
+	.ascii	"\262G\177\330Yw\3511\326\233\034'v\327s\377"
+	.string	"\305\344\303\330\3032\375K\311\006\353\205\byt\246\375\325W\234\376\245\270\263\033\"\217\361\001Q\355\356\002\237\3465 \315\304\344z\314\034\324\215k\352Wx\330\241\303\250\200\355\256\002\337\305_\210\374\022\217\336N\362\250G\377D;\036\215\216\225\227=R]\254\360p\265\305\276\3220\246\365JgL\037C\220\002I\005\246\320A\320D\241\007\244\221\306q\027@\037\006\221\2248\215D\372L\310:n\353FZ\227\215B\037Q\006\342\272\214\304\2007\013\032\227\221\266\215\313<\266\363p\265\305\016^fx\252bUu\261\rG\236#C\025J8\316\215j\307\253A\261J\265\035& \220\202!\254\316\001\377\006\303\n\031\230\017\307\315\230\302\300\270\020\036\332\243=\330\356\t1'\214\tc\315\344\256\231H\265\027\331\236\211\3160\233p\2431\310'\004\326\205\007&\332\204\t\0315\243\243\342rw\334\266R\324N]\320v\331]"
+	.ascii	",/\352N\335\364\023\350\030"
+	.text
+	.section	.gnu.lto_calculateVbatPidCompensation.part.0.113.3846b59827e8a97a,"e",@progbits
+	.string	"(\265/\375`\361\002\375\025"
+	.string	"6)\215H\340\360&\035\332\210\236K\307z\250Is\033\305\017E\223?\240\270\362\272d\300k\005R\031f\217\315J\354\3551\272>3\264w\265\355Y\233\226\214\220z\2300\203Y\fM \331\023\by\003p\203F\021?\210%\233\310\235Rt"
+	.string	"{"
+	.string	"v"
+	.ascii	"\037r8\336\314\322\215\333s\203\363G\207\237~\t#\20107\";\250"
+	.ascii	"\243\250\335-\3714\002\360\223\304\355\306\266?\342@8\033\311"
+	.ascii	"\033yz"
+	.string	"\016\245b\246Hjw\305O\326\t|\237\336\007|\237\332\341\270{*'\316W\265<\037(\030480\367T-\243K\032\234\013\327\020\034\235\307\332\335\017]\326\340\344\244\024\360\251j\355\256A\f\367w\333(\266g\266\262\002\2374\310'\375\361I\203\240\264\352\223\376>\351\251\222\366>i\235\322rJ?D\344d\307n\205\251\035\2333]\200\270\320\345\315\352\306\222\2435!\023\332\254-\334\341\331EI}\246\270\331\245\225\243 \343\255x\232\001$\265\272\261\304'\216\342\305.\005F\036\013\n\234\204pH\355\216\342\247G\320\263\257\031\234|\374\242\033\331\241m'\262\201\0326\277\234\310!\215'\237\335\r\325\027\2729{\342\307\370R\003\007))\337\247J\337\303F\320T\325O\277\013\221\223S\366t\352wQWOG\222fzHU\365x\354\242\354\007Wr\201\273\272\023\377\305\223^~\317\247a**\337\247\324"
+	.string	"JO?ArwaTwl\263|\327\325\007\242\033:\251\303>\213\267`\361{\034!&O\363\351\307\276\317k\202\034N?\032b\344\224\324\035\353\364Vu\354\325'\035\006^1\241\255\324\\1\261E\026\213\311^#^\231\301$\270^("
+	.string	"\3742\261\315`\265\232\013\202H\233\311h-0\232\330\302\342\212\211\257\031M4!\261l\002l&\326d\262\231\030\332\226\367Vu,5\324\330\222\f\371\246\257\264\306\366J?\364\333l\0201#Fs\326{\036\210\206\372\345\310!\335\003\207\246\234\265\324\355\306\034\370P\020\265\334\341"
+	.string	"\365\323\017\325\243\035\223JA%9Zp&\006\340n= p\002!;\343\006ac\274bE\034\0226e\354Av\365,\270\001Z \344L\34704t5\264\256\334\026\221\032\376h \262;5\006\343\337x\322v\224\247\3603\213&\350\221\207\021\376\303\3652\342\002,\220>\246*^\005\241\240\255\fk\204\3412x\023\256m\3555\201\333\241\233% \342\331\221\346&l[\352.\217\325"
+	.ascii	"\020\261\034\342]d\263D\003\205=7\253\327;7\206\272\260\346\202"
+	.ascii	"j\364Y\343\333\326\023\336\030"
+	.text
+	.section	.gnu.lto_.symbol_nodes.3846b59827e8a97a,"e",@progbits
+	.string	"(\265/\375`\352\004\255\022"
+	.string	"V\234lI\260XQ:<0\217\006\035v\f_\314\303ge\306\025D\037\024\357\025\354\377\t\356\f\352#\037p{N_\360\205~^"
+	.string	"E\033\254\025\200k\005I&\021\355\177\373\337\376W \202hT\033\375P\237\037\254q\374n$\367N\001U"
+	.string	"["
+	.string	"X"
+	.ascii	"\267\333k\323v\332\254\325\320\016\233\271\310\354\325\035\262"
+	.ascii	"\273f\214\005\273\251\314\227\215\260j\2577\272n)\263"
+	.string	"5\263\301`\320\212\202\277&\216\201\004\227\315\033\031\033\033j\02651\002\020\320\265\345Xih\250mT\355\365\252\016\3736\022\f\311Rk\2553\217M\333\324)7\324^1\304#J!\224\001\207\332?\274\037 ^\020Q\320\220\217\220\212\226\345\330\002C\213^\270\203X\270\201T\270\177P\270\177\023n\037\022\356\243\bw\017\b\267\321\203\3638\370\316l\360\331\354yn2\270\316\202\347L\0363\241;^\242:N\n\346\\7\340\200\356\270\234\215\342\036\213\362\271T\213:r\tW6\311\231T\005J\rW\270\322\367\no\270\220\361\004\026\256\374\311Q\312\"\245\242\245V\313\372\334IP\334JN\334KL\334J%n&\022w\223\021\367\021\0217R\210\033\t\210\033\370\341\026\342\341\036\322\341&\"k\255\366\212\303\355Dn\230TC\336Ii\343\312\023\260\205\265;\324j{`V+#Y\274Z\031E\332\250\326Z"
+	.ascii	"fwr\002 \260\001\306\231\270aM\334\320g\023c\230p\304\270\211"
+	.ascii	"\233\372\341\304M\2159qQM\322N/\236r\350\304\005\2421\023\367"
+	.ascii	"%\246\332\027\231j]\306\231jS>\351)@\0363h\252T\250A\bG\302\251"
+	.ascii	"\322\302\242\226\326\300\002\241*\322\001\021\240\020\347\210"
+	.ascii	"!BDB\tJ\205y\300\350 #@\242\242\214\2605\006\341\004r\323\243"
+	.ascii	"<\002t3\036\231\336\266\256e\362\026\216|F\276D0\024C\030\216"
+	.ascii	"!\f\027\177 \007I\350\356d\202\256\233\227\240 \223\017\231J"
+	.ascii	"\215\204\022$\245\260\225\252Y\357\325@U\r\303`\0370\345\331"
+	.ascii	"\037\375\021\200\344\312h2\273\356\273\324\375KW|w\356\t\031"
+	.ascii	"\314\256\030\344:~U\262\314\270\250\373\206\302(e\243$\022\263"
+	.ascii	"\266:\273\222L\222\3006\322\253\n"
+	.text
+	.section	.gnu.lto_.refs.3846b59827e8a97a,"e",@progbits
+	.string	"(\265/\375`\r\001\215\t"
+	.string	"f\031<\023PlM\007@\230P"
+	.string	"`\340!h R\213\326\266L\0011"
+	.string	"5"
+	.string	"6"
+	.string	"\260#`\007\300\307\340_\260[\260C\330)\370\256\337w\205\375hoP\317\310W\264o\356\021\355\204\367\003\352\003\371\200v\353}\345\376\345\267\037\370\274\002\177\332=\260w`\347P=\363\036\343z\345\375$\366\210\326!\355\211\367\205~\366v\371 \261%x\2309\225\031x[\357\033\007\270\253\254.\353\315\261w\257\255\276\005\375)\336my\343\tl\355\375`\313\005Z\307\336_\231\025\325\237\353\256=c\357UD<\017\033\362^\205I\350\247\254\233\262^\212O\022\374\210\352\"\327C\261\203\264\006o\262\223/9N\223\351\335\306\\\272\213[*\224N$\215txuJ\373\327!\356\250u\200\326\251\370\200/\336\027\336k\371\325\346\250\032\275\261\345\213-G0\276\260x\300\226P\021\030"
+	.ascii	" D\312\231\242\272^\353\"FX\352\332\3142\221\322\330\323\325"
+	.ascii	"\336x\272\261$\034\032V\300\026\326\266h\315\331\375\264\325"
+	.ascii	"\245lb\244\342eXD\334\230\033\252\232\232\202\221\032\313;n\261"
+	.ascii	"\031"
+	.text
+	.section	.gnu.lto_.decls.3846b59827e8a97a,"e",@progbits
+	.string	"(\265/\375`\3616m\341"
+	.string	"\352PuJV LI9\351\252\372\252b/&\343_s\037\327\347\377\372\257\356\030\025\237W\355\334WUG;\261TD\332\331[\367\371]\0310\212\243\232U\263\362#B\310\236\314&\261\230\325ihu\235_\320\262\233\362<\206f\013\352fW)E\035)}\356\256\323\355\357-e\n\323\003\233\004\324\004\f\307L\036%\224\2655\323(Y\236\225Q\343\232\343\263\363\302j\035\314\025\235a.$0a\273c\265\016\256p\315\361\311e\321\002\006\217\305"
+	.string	"\245\322\253e\224\3025\307w6\003s\001\326{\271\350\226]~\306R\207\205k\256\354/\352)\036\303d\230\231\206\302\231\265\246]O\261\031\346\002<\2467\213\2044\2569\020C t\252\270\336,;X\036\252N\316\327!\347k\327\371Ju\276\307\234o\246\0367}\2302\300\254\261\351\215q\036c\235\311q\344\353\f\363F\236g\366=\317e\316s\226s\2107\374\316\351y\016;\211\264\360\026N=0\263\036\317n\231\317\033\2627l\332\236{\234g\017?\356c\017\2773\214\023\210\205~\036~\322\030X8\346\256"
+	.string	"m8\3013kK\205\255p\025N\371\nO9\313\300r\357\364^\251{\357\231M\n\303\001q\356U\272-=\340+\034\307p@\250\364\"I\264\251\320r>\373\213\376\016@\340+\374\204\325:D\335\3135\303\202\343\036\0241\276{\323!\020 @T\031P\344\226\247\345\2007\374~\0368_\342\3446v\343\364\003\277\235\2430\333q\240\322\233\336\233\3764\230\033\265&m?\201\363\374\341W\373\372\370\303\357\0168\233\205~@\274\341\307j\315i\274vVc(\357"
+	.string	"\204\367H\335\262{SV\263\367B1o"
+	.string	"d\336"
+	.string	"G\016\bT\223\237\375\b\347\211\234|8\245\246\260\225\265\375\031\355\347$\\\306M*\325\225\362\246\335\233\006\3414\231C\002\325\226\225\360\022N\271\311\317f|v{\246\274h\367\246>\025*F\026\267\266\032\360\206\237e\362\237.\027\204\367y&\372\3750\321\357)o\370\235,\364\253L\030\232\214\001\332\251\016\311\323\317#\214-\200\tO\211J\317_\221\204\034\001\351"
+	.string	"\330\177\177\325"
+	.string	"\217\363\257\030\bAZ\245"
+	.string	"\t\035:\004\025\206N\032#"
+	.string	"\244\004\264\001L\374\215\200`\007/\360Q\005:\304G\374\365"
+	.string	"\\\r\202\376\300-\370\253\321\363\372\202\366"
+	.string	"\006@\037\300;\007\177e\321\035 "
+	.string	"\207\237\263\376\346\300\337\033\370[\003\177\273\360w\211\277Y\370\273\002\177\257\360\367\004\376\226\300\177\236\277np\373W\241\216\300\177\234\277\372\234\350\007D"
+	.ascii	"\350C\243p\267\263o\370[,\350\247\035\360\353\006\230\340\003"
+	.ascii	"g@\225\377T"
+	.string	">\364\377\303[\370o\200\207\370\333\315\317o\232D/\340\377\331w\376\226\373\331\251I\370\317\234\373\033\247G\370{\247EP\300\317\034\b\341[\376\277\371\317\346\177\233\237\355\1777\377\327\374\334\377\377s\375\231\355\377\230\377x\017\372\353\214\237\311\374|\346g3?7\177\036\363s\231\237\3234\b?\323\375,\346\3470\375\301\377\237\277\352\375\355\301\337#\376N\300\337\037\376\036\300\337\035\376\306\340\357\241\277\203\376\376\371\333\347o\236\277\177?\367\375\314\346g5?\357\375\034\345g$?\217\375|\344g\"?\207\375,\344g ?\203\375\314\343\347\034?\177\375|\343\347\256\237I\360s\215\237\267~N\376\374\342\347\026?#\177\276\372\271\352\347\251\237\357\317(\370\371\004?7\375l\202\237K\360s\361\347\021\374\274\364s\b~F\361\263\322\317H?\007\177>\372\371\003?w\340g\017~~\300\317.\374\234\201\237[\370\031"
+	.ascii	"?w\370\237\3663\006\376\277\375|\302\317\026\370\231\002?K\340"
+	.ascii	"g\b\374l\364\263\003~\346\371\231\304\377\022?\213\370\277\302"
+	.ascii	"\317!~\006\361s\001~\316\340g\017?o\370\271\202\237\205~>\177"
+	.ascii	"\316\371?\367\377\312\177\264\377M\376\277\360\237\356\177\006"
+	.ascii	"}}}}\277N\224_\247\307O\200\245S5\005\20710\267\246\250R<.\252"
+	.ascii	"\2200\231\002\205\271\267\325\266FuV\017\231*]*\256\334z\211"
+	.ascii	"\\\235\264\363\315\233\246;\357\025\037.-R3\206\264isv\263vR"
+	.ascii	"p\261\022\242G\215\231\0320<\326\244\275\206\271\330\237\020"
+	.ascii	"f\230&\037\317\212\276;\261\266\327\221\201\246\371\320\364\236"
+	.ascii	"\001\322\244\351\275\024<\\Ik\327\230\033%m\367\334t\222`\310"
+	.ascii	"5\347O*f\332L\333\260Pg\267\305N\n\270/>\276{\223!v\2260\251"
+	.ascii	"\"\345\310\230n\216i2\277{9Uf!\311\350\351\365\335y\274wH\211"
+	.ascii	"2I\244C56\344\274q\376L\221\227\307\314\341;\361\360\232N\356"
+	.ascii	"\346ly\222\362\223\226\241R]\250/\004\204!\355\354\372\316\r"
+	.ascii	"\262\275\274\357\200erM5m\217\246\257\376\353\034\311\371\340"
+	.ascii	"k\253\253\273PG\242\260\033\246\311\347#\306\nZ\224\030\227s"
+	.ascii	"\332\\:\356\254\272\027j\306\007b\312d\210\037\215(1\232x\235"
+	.ascii	"ioa\270\022x\224P\244\257y\221VB\364\254\270\241\364\322\366"
+	.ascii	"9WY8\355,\375\226\302\205jA\"\254\231\206\370\257\357|[\351+"
+	.ascii	"\357\271\264\347\232\216\223\367H\346\0034\313$\222\350?\232"
+	.ascii	"7\335\307\364\334\0168]\212\004Y\263;\377\376\177\027\ny\357"
+	.ascii	"m\201\223^dT\317\217q\230\211~\037\256,\200\353\001\004\367\036"
+	.ascii	"\305,\317\234D\334\240hhp\177\346\275R^\307\022\274\264\244\274"
+	.ascii	"dP\241y\335\243T\220c\020\362z\035\251\320\356\r\272RRG\024\224"
+	.ascii	"7\210\n\355j\335\024]\264\370\246^\307+\245\274AW\352Bi@%\345"
+	.ascii	"\245E\205\006\245\025D\205\346\245u\321\274.\320\225\202BVI]"
+	.ascii	"d\320E\363\"s\321\224Z@ThJ-*4/\033|E\225\006\211V\336\362\313"
+	.ascii	"\n\037\251\244.\013\254\032PH &U\252\274_\356\345\264\251\213"
+	.ascii	"\024\300\2755\224\310/P2\370-\212\311\"*\n\224\222\323{/\007"
+	.ascii	"\254\250/\345\225bR\025Q\336[$\n\305\305\372\340\2302"
+	.string	"o\017f\036q\324\270WS\367b\200u\357\221/\363\336{\274\367\346 k\244\367n\001Q-\261\260\356M\016a\335\032G\270\251{;\r\357M\213\n\355KY\004\367\004myU\244G^\336/^\310\023\355hv\257\314\234K-\027e\332\246\300\337\221\037*\340\332\236ba;\330\264M\327\266\260\354\230\222\266\023\346\303\013\r\310\331p?\313\2534:l\234\355\346\303C\027W\244\217\205\024\035/fl\374R\260\235\323f\353'C@\367~Y-q\370\322ZMO\212\fG\354\322\240<\331a\253\222\246\265ur.\267\222]T\314\316i\233u\023\242{[\220\bK\3034\371.\022\031\242\317\206\352\324\212/$=\316\343\324h&-\303jH\213\266\307\311\352%J\310tR&2\253\355=8\302V\266\354\"@\235{\275\244,\311\332H\027\311\351\221\336\305\361\335{\2234\222.\343\264\311Z\354=\306`@\200"
+	.ascii	"1d\271\232B\252N\333c\273\234\267W\316\333\265\263\303z\b\247"
+	.ascii	"\227k\"=\252\034{\234\235%\310\271\334\357\226LH\220\237\212"
+	.ascii	".\264-A\032\310\335Zyo\224\263\n\215\2335m\371\362\206\037a\300"
+	.ascii	"|\234-\273\374h\373\366\3617\217\356\3219z\224\367J\341\234\251"
+	.ascii	"\302\342k\333D,\364c\263\242\367\016\213#M\326\020\0359\370\313"
+	.ascii	"\322\006\226\034"
+	.ascii	"8\222\274\320\361#-\323\201cc\004F\333\276\321^\357\257V\336"
+	.ascii	"\376\372@y/T\177\375\264\271\027\352\207y\003\346\r,\222/!k?"
+	.ascii	"{[\244K\217\313\006\f\311\344\222\266o\033]\203\225\367\002\240"
+	.ascii	"\013'c[m{Foq\312\241ip\031\036QZmo\177\234(\270\2279\374\270"
+	.ascii	"\257\2179\374ZF\321;)\364C&\323\037\022`8\220\264\255,\024\203"
+	.ascii	"C\216\030\\\227\016\030D>j\274D\215\275p\321\243d\207\030\216"
+	.ascii	"\356\026\215l-N\333Eg\335\246\367\246\235\271\350\025}U&\306"
+	.ascii	"\003\026\2546$\f\b.\032+\203<\256\271\261\237\017'8\330\234\366"
+	.ascii	"v\306y\253u\336N\235Dm\245#\225^\264\036\250\030m\\\332\276\272"
+	.ascii	"9_\315\234\177W\251\345$\241\362\225\326T=\325\001\013\025e\332"
+	.ascii	"\036\0044\314\205\231I\022H\2264\271\r\273i\250\276\235\202\337"
+	.ascii	"0\233\216\3425}l\025-\305iO\361\336\231\217\325\334z\320S\374"
+	.ascii	"%D\366\334\250\f\271%\362\265\233\374\241\241\210\020!69\304"
+	.ascii	"\344\336\305\375l\311Z\221T\366x\017\013dHy,C\244D\207\212\226"
+	.ascii	"\253\036\026\210\375Ac\031%I[\013\326\323wW\247\301\372\b\332"
+	.ascii	"\313\221\303\356\250 \f*\310\031\276--\334\264\254\216\333\035"
+	.ascii	"h\2340\227\264i\311j\263&\216\213\313~-\357\342\306\346\260\\"
+	.ascii	"\200\261^\267_,\256\330\335\266\366F\0279\343\360\304\202\264"
+	.ascii	"\265J\033\206EoL[\333\305j'\232\013 h]\344\007\246\310\r\025"
+	.ascii	"b5j\330dz\027\347\243C\312]\225\256\255\255\246C\242B\313\330"
+	.ascii	"\331\274w]m\037d\345\302\205M\346-\033J\3371\206\214\333d\333"
+	.ascii	"1\355b\360|\245QL\033\303\302\020r\327%\211\023\235>4G\344^\264"
+	.ascii	"\330\025%]]\324hi\215Y\326\361XBeg\263lV\3239@y\0277f\363\216"
+	.ascii	"L\236H\301\302j\272$\313\337\222\035\315\345\021**k\305@iT]\331"
+	.ascii	"\262\032\231\221E\205]qku\372\250\353\222\243\255\255\3525\266"
+	.ascii	"\302\204G\024 \257\363\307\037\355\324\220\262\326\215\251\320"
+	.ascii	"2\306\003f\025\205\303\246\270\235\362Y\023s\004\215\225\372"
+	.ascii	"\21208\034V\312F\255qi\325\365\331\265Ed\360\212b\241x\312O\315"
+	.ascii	"\f\033 \344y7nj\037\237\335,\226\302\245\257I\324[f\264\370\350"
+	.ascii	"7\257}o\246\310\260u\312\001\036X\0202l\330t[\ti\027J\213\250"
+	.ascii	"\312\361\315[\020\020\246X\252"
+	.string	"\246\252\3518+\025\346mK\324\0270@\332^\255\264\325\275\242\250\013E\306\201\230\022\270f\206\024[m\323\344X\315`KS\236\347\262\271\212\345K\226JW\266\205Y\273\034\301R\257\314P\363\230\231\004\272Rmy\315f\325R\351\200\307\240{qhY\226\251h\352\231J\246\352U3\234\326f\255\373Pm\326-Y\232 @\360xA#\204\t\264s\027\323!\212*\205%xy\325\256\206af2\275-x\244\204\255\031\343\2737\025S\307pZ\363>\304\301\207\r\030\276%\2770x=o+h\250h[\3010\032\235\325\317\275\343\264~Q1\304M\220\266\325\313\305T\035WX]\316\302\200K\222\305\315y\340\336y ^\345r\3325mh\231\341<\220y\036Hw\0368\345<\260\rK\245C\233;\243\205\216\271t]\226\253\250\265S\003\271Z\345\007\311\233\0166*\025\360\261\205\255\255\225\241\351\204,\261\246"
+	.string	"\277\004Q3\213\303a\353;3\243m\205;\247\200e\037vl\264u\321h\373\n\367W%\365\315\004}n\366\332\376\013o\370\365X\321\253\033\217\026*M&9\312^\331jY\215\222B\362\266 !6\002K\006\221\266\351\020\020\206Z\212/m+\224\252V\327~\035\235)Wu5l\234\257i;<\272"
+	.string	"1\322\266\253\223\327'\277NN\031RJ-y\2766\251h\277Nu\203eJU\333\003\221\347\353Y\n\302\334 k[\315\316)\340\361\203\016\336\231\030\260\266\257f\177eR\323\376z\241\257h$\365\332\276\311\033~@\026\372U%E\257KZH\032\035][\037\237:$H\260,\253\362\246p\25126V\217\270-}z\310\2606\306\211\021#\365\b[\023'\025\243\203r\244\213\374R,\341AFF\204\310\206=21\027Q8\302\302\310\232:e\210\3541i{\037\025B\204\324.!?\232'\025\031vI\314"
+	.string	"\001R\301R"
+	.ascii	"\272Qz]\313_\221-+\\t>|T0\r\367>q\333j\206\0303#\007\006\267"
+	.ascii	"\003f6uC\355\254;\352\216\312#\205\273\201\314[\353\240\242\025"
+	.ascii	"\243\362`\2650\"_WAr\344h:\336\362\026\2469\266Cv\343\305\232"
+	.ascii	"\255\363\353\213\203V\211\262\276\272\266\357\231\2527\352\r"
+	.ascii	"\020\310\220<_*W\345\252]:\005\240{\013\323\344\373AC\354v1\027"
+	.ascii	"\0360ZcJ\320j\324\032*\302\222$+\21473\236\344\026\247u\253\203"
+	.ascii	"\224\220\246\204\n\023\301\310Q,\r\317\230\252; d\316W\030\\"
+	.ascii	"eT\0305\331m\347\021y"
+	.string	"\262\201\3615w\230\347w\244\234\347n\373\325\027\365E\337\261\222\033\2469\206\006K\313\215HmQ[0@mI\363\3478\005\365\266\343<\223qe\301ieQ\221\032\220\024\250\022\322\274\310\032!\272\217\005\335\262f\365\350\005anI\223TRv\\XY\325+\r\367BQ#\353\301q5\345x\225\243\312]\265\361\271\241\242\252U\032\256\362\336e\316Z\225\217f\02142S\252\372\355g\n\233,1\304T\250\nU\247\314$\300\305[\r\"\213\305\006\027\262\032'v|P\030\203LCa\220h\324\021\032\237F\f\233\230\2300\350\300\003'&$\034\013\320##P\361i\311hl\"\242h\341\202\243\0201\002\t%>\031\203\350\211\034\f.\b2B\301\004\241\245\340\223\221(t\341\002\024E\224x\302\202\244 \312\202\021\n&\b\005\035\205\210\021M\302\013~G!B\205\026$Pb\204\021U\"\006\215\032\210"
+	.string	"\251i\311\b%6\031\375\304\340\324d\244\301\3504B\311I\bi\370\004\001#Z\344\031\236h\234\342Q\217\361h\250\344\2043Tr\252\250\t\204E[,\242\304\244\244`N\fNMH\226ht\252\367\211\201h,\n\225P\026\216\222\320\241\222p)\230\223\204\026\237,\022Z\314y\320\030L2\036)9\211"
+	.string	"\03691\241-\030\321\"\312\202\222\223\207\025\202\214\250\022\217\tE!\f&t\020\272 (\t%>\025\205\030\024\231\210\301%\023\212\036\204A&\224\005\341\211\341S"
+	.string	"\212J\301%\b(\r\205L\304 \317Q\210(.5\021\215\303&\244#$\342\b\244\023I\303 \023S\223\021\022Q\007\210\003\021I(\222\020\006\"Z\302X\f\252`\f\232\020j02\n\207\022\340)\n)\r\205Dc\211\r'\030Q\245\037\025\214\250\222\020\020\212t\001\035\343\360\251\311hi\t5\352\020,\016Q'\246&\243$\341\005\214A\023KOHKA\244\001\034\205\210\021IK\302'\023\034\224\236L\240I8\034\2100\022\203N\""
+	.string	"\320s\302\tOCF.\250"
+	.ascii	"\264\024D\022\032\205D\013\230JT\260\0015\006\223\2342\300\341"
+	.ascii	"HB\":D\225\316\177\020B\002B\020\241\0049\027\201\004\016H\340"
+	.ascii	"\340w\021H(*\"!\204\242\363!\024U\243\361\b5\006\215%z\320##"
+	.ascii	"\024L(a<\222\261\007=B\223\232V \242N(j\242"
+	.string	"\347(D"
+	.string	"Oc\0215\006U@\225\202D\324\211)\b4\036u\340\301\220\004A\"\n(L`:\211A\024H6\247x\244!\t]2\021\034\2429N;\306\243b\006P&\241\361D\231\204-\030\211AcQ\347(\212GJ\302\023\303\246\022\004\207B&\r$\260\3008D\213(\321\311\3304\344\200\004\303\222\017z\244\001=\252"
+	.ascii	"E\">5\2250\016Q\"\361\tIC\fF!R\320)h\364c\f\236"
+	.string	"\340\002Z|\362)\032\211\350\222\tFh\361\251\202!\212DD/\2404\024\016\211A\r\f\233\204F'\246\247\342\260\t\251CQX,\306\200\002h<\022!gi\tEZZz:a\f\232\200A\350(Dxx\223\023J\034alj\"\216\340)\036\021Q#\272\002\f\300\323x\024B\221q(|:\223P\"j\\\022\236\030>\355,55\235p\204s\342D\223\361\311\bU\n\032\227\232\\ A\323\022\320G\030\301H\203\fT \002'\222\210\030\210\250\321\03041\242Hl*\016\321\342\210\2410\3104\002\211X\034!\242\303\313\224\261i>\220\203Bs\233\306\355H\0231pm\355\231\273\231\345\2003s\267\2376\263/`nF\332\310\326\272l\236\315\263M\235cN\033>\256\271\246\325\263J\216M\216zcr\274\314\314\b#\246\341\322\2376ghvbx\217\257\264\2759i{!\255\323\213\027\213\207"
+	.string	"\270.bX\300\334\342\311\341L\345\235\351\322\326~\271\034\0335&3\264\265w\227\313\241\323\362\325\225g\327{>K\322\222Xf\260_<[p{juv\307\317\027e\216\253.@\256\336\222\026\\\210\354U\211\233bv\333\2516\206i\265\245+H\032\227\242m\312\363\306\245\366\"\213M\326c\224,:$\317\325\030\026\246\265sbf8\246\332\336\316\375-\203\355l\016.\274\256\266|\245\276Q\231jc\245\312\221V\230]\333\333*_/\270\001b\265\245\255\225+\272\245\222\201\0249\270\26692\330)fTi\326\332\336N\371-\234\215\353\257\027z|\300p\261\245\355\323x\303O'I\321\355\333O\235\033\232 n\266-F\n3\333\346Sc\b\216(E\267Rpf\320\335"
+	.string	"k\313\303f\327x\356\236`Q\263k\277U\343.\375\365B[\026':\332\342\3304\013\205\206\331\033f\232\346\3236\203\331\332\223\276{S\306\t\\[kf\315,\032#\221eH\220\2658\022\307w\223/\210~\333\344\026MJ-\251\326\326\236u\333\353\266\360\3564\260\235\277M[\206\037\0268\254\300\2300\334OF\n6lm\263\262\300\224Jj\337\316\023\2610ie\375vJA\003\263\"\t\031$v\252\347N\315\0323\262n\342\363\304\nL9f\255\2000\242\320\330!Fg\325f\360\370\262G\342X\264(\003\306H\024\2601W\257mX\230%\242\267\254\001\204\340\250cS\364i\"MA\205\034\232\021!M\222\2441\363\024@ `L(\233\017\247\271\033\023\300\324\347\023\252\020F\241QnF$I\n\222\215\3356\222\347\370M\007\3429\245\245\257\307\212\352\273|G\205r\013"
+	.string	"\272\341\033h\313\376\360\355&\200\244jx\274\377\241X\b\2048\357MU\013\201\257\232\3657\331\322l\005\340\217\233\027\274\2320\b\253"
+	.string	"\202\317\262%}g\211\325B\"\370o\211\246\254,\341\337t\037\033N\260\035\213\257d{\337\243v}\246i\267Z\306\333\t\244\240\005\026\330{\254\357\273\270WA\305\213D\364\267\370K\213X\242N\312X\310~\316/\357\372L\316l\262/\370\024\f\3634\222\020\337e\"\236\323\255\357\340q)O\037iO\231\017\373\267\n<S\177\315C\241\302P#\n`\025\246\363\270\374W\220\246#\037\374\241qb\343\340n\251:\262h\216\257L$\030@\227\344\373\350WOPs\220<\230\371\200t\257u\331FP\025\272@\377\246\351\224])\265\0338\330{d\242\370\247.\227\351\252\013\004\267g\3327\017\271\362\347\304\002\216?\222\260m\035?%\260{\272\231}\016\033\306\374\323+\264\375="
+	.string	"\341hQ.\333\240H\004S\315h\317\024*mM|\311`\027\345\266\255\332\006\270c\212/\242\250\214)N\b\3664\356\221\315\373\243\"Q(\220u*{\312c\375"
+	.string	"E\210\317\207\274\242\\!\2716&=@\240M\025\254\255\274\303*D\306\200\037l%\263)\006QjP\260x\002Lp\212\237\2409_\251\360U\240\240\201\253\233\216;\213)\036`\210\037\370\326\357\343< \226\234\324\223\030M\001|\276\224pj*\351\330\242\217\021\004\261O\246\r;\2757y@\271N\240'\3122\274GUp[ \005o\305?wM\215\360\360(?N\312\274\241\205\230\r\370\263$1\241j4\253\250\241\257V\237\326\217\2166\017\313\350\273\365Z\370\203\322\034\322\244|4\320\206s\030@\325\325,\220\2703\347\231\220<\3232\343F\211\316\002\b\350\236\rY;e\345:\006\212\311@\223\267\226_z\020\274#\243\372\337\326\027\317^|\242\234\205Z[5\226\332\230\215\377T\325y\314r8A\350\250\246"
+	.string	"\024:\007\365\260\3552 \357"
+	.string	"\205\321\355I\262p\273~"
+	.ascii	"\251\"\235C\311'\n\314\373\016\207C[\271d\275\225\230B\317\305"
+	.ascii	" \201\276xg4={\323\350\275\344M\364\007Me-,\376\0320\326\264"
+	.ascii	".\3152\275\310\335\341\315.)'z\264e\346D\233:\222{\372\213\214"
+	.ascii	"5HS{U?\270S8\020\322\360c\325\355\025\250\206\t\252\300\006\300"
+	.ascii	"(\260\276\021\342\f@\267\005D\311\253I\032]l\203\272\3453\325"
+	.ascii	"#`dn\263\367\020\024y\372\325t\344\234\344\200gH\236r\237\001"
+	.ascii	"\212\035u\257\365\322s\333\252T\025\235{\017\ne\231\222<\035"
+	.ascii	"\032\\s\303\305\367?\370\005\345o\376\223\035\241\021j5\026\030"
+	.ascii	"\006\bx\243\340\327\206\232rc\031S\371\221\032Y\t5@\222\217\316"
+	.ascii	"\262E\"0.\202\344\374}\256\003\362\\"
+	.string	"}~$\373`\214)7\251\305I\341\351\357\244\354\032|E\244\321\305\234\002\322\037X#\252\244$VU\302\\\203\306]8\034\262\305\206P\255\245;5\314=\372\032\b\\\352pj`\020\001\362\031\306Ta\035\226ll\220\202\005*9\306\307\310\322\230\313\204\252\006\346\246\2550:|\3766\327AMwG\347\020R\267Ab\242\347\364y\200\351}\321\202\265\353\031\337\367\203\372\302\272o\241\254\"B'\004Uvx\322\027EEv\230\226w\003\366\365W\256a\221\366\"\313o\251\231P\203\362&\355Y\202Q7\006\177\306\373\016\357c\307\307\373\357\005\334\200w\234\236d\217'\265\024\317\223\307r\2011\2214\246\007\305^\215\256$ j=Jj\360\006RD\025\\\355\314G`W\033\361\306b,nW\031\331\263\227\245\016\236$\222\244<0\3753\357\217\021\274\204K\206\215\027\343E\\G\364|\364?pb\212\262c"
+	.string	"S\370\266\030#\220yI(\263Ax\223\206%\304\004\340N\273\332c\013\326\027\301\177\"V\266\\\006\235\257\250\321\211\r\345\377P\225\036\340^j\020\324\376\257\221z1\005S\237s\370\025\322\007J\303.f\177.\305G\262\342I\2038=\340stw\332\r\302\033\037\016\260\341\361C\262GU\002\024\333I\247"
+	.ascii	"\363\241\247\3349\321\267\221Zi\020\023\334\020&.\021G;\006$"
+	.ascii	"6\221\323@\037\331\255ou"
+	.string	"4\213\356\201\225=8e\031D\200w8\253Yb\256\twp\002[\346\005\315\021\017\326\232\340\256\272\335\216\255\205\217\016\355 \357\267\357)0a9*\373\310\204\221\230\256\004fD\033C\301\3069\372@\2518\272~\357K\017\353_\302g\256\270\255s\345N\367\005\2021\265=\356\036\277\022\265)\323I\017\377\311\275O\026\272\r\030\252\356\f\200\264\366\260<\270\310=\307W\302\334\230 -\235\207\310\006\027UZM\r\274\354\344R\341\305q\303\372\247\020s\0250\350"
+	.ascii	"\3015\004\237\377\201X\316\020\r\355\f\304\016\375Dm x,\324o"
+	.ascii	"\212\0327A\241J\314\355v\216\312\037p\177\317\341\320\027X?\362"
+	.ascii	"O)\254Cb\204\207X\t\370\262:\350\301&_n\321\272T\213S\b\256P"
+	.ascii	"\026\324\350"
+	.string	"\254\232\330O9\237C\264\024\366A\326\323\202\211\0170\243y\264E'\271\003z\334\330\241\035\255\311\326b\333\r\203duYnLk!\376\214\215\300&\256I\200D\376\331B?,\202\031\366\343r\302\337\350$\315^W\226T,\312\260\337\224\f\263\314\r[|\216\252\273d]k\211\200w\213\274\211]\204Z!H\345P%!h\327B\223a\204\234\177\022\210\206K\302\"\f\204l\350\023\300\232\240\323\243(\347\342\311\3646\265\3306\212\025f\227\030xHb\320\264r\030\267\311\272fv\325_e\271\342\376\275\222\205\351BQ\253\264\336\345\033D\357Y\260So\251\365\307'\223\301\302\207\031\271\222=;w\372N\033W\321=\001~\0335W5\266\331/\034\313s'\366Q\241\204\237\254\303#p>D\326\027\372\007\n\274\223\241V\266V`\355\2400\177\333\256\362!o\2367\351\f\261\365\331A\352'\246B\232\3034"
+	.string	"\300`\205\3365a\fa\024X\367\345]\274\306,\020\nL\265t\265z\272\346;2\3565\365aX\310]\034j\201b\310\236\310"
+	.string	"\314\020\272x\177\270\347!\274\3064wfU#\325\3101^\265\347\305\247\321va,xnU4\226\303\330\231|\370\232\036\"\235\325yOd+^r\252\332\0035Fj\n\324m\177)\213Z\024"
+	.string	"K\331fk\224U\377w\276\274\245\241\246p\017T\300\306\007\301\274p\374\303\324\215\225lA\020\310\371\037n\205\346\352\216g\330\276\"\324\3438\231\352\203\272\240\333Zi\360\027\004\365\322$D\212\3637\247\374Wf0\036\025'\2233\267\320\264\273\351(\374\223\3419\370j\330\233\301p\213\377I\2273\347b\241\271\231r;w\261\321\261Q\312\034\315\370\020>\004\254\325\030R"
+	.string	"\213>\224\362\357\270<\233\245Q\341\001\275\355K\335"
+	.ascii	"\304;|<\301\213\266\004u\306\340b\302\343b\236\0173\021\032m"
+	.ascii	"\271\365\364\330\270\316Q\211\036\234\377\356\377\330\364y\316"
+	.ascii	"\"\f\331\rPr\312{9\364'\302\246\362"
+	.string	"\001\200\336\277s\367\266\033\037r\254\330i\037\206?3\370y\214m\236\227\246\211\275\327<\217Bk`\fb\207}:\212\341\257\361\023\":\007\003\313%\206\003\265\352}\272\367#\327\2270gD\326\342N\231\341\246\330M\240\207!93`\333\300ZwoY\204\217\361\342k\313>\334\237\334C\310\343n\0303\367\303\330\0330\017\334\273#\340\257\346c\342a\001\336k\256\027uT\203\237\265yU\354R\235?e\365|\367\325d\334\032\231\306\027'F\267\321s\3775$tCb\345`,i\204\3359\3346\025\353\f\301\235\322\345\325`a\270\315F\270\217+\270`;\300\377.\312z\356\341dw\030x\267Y\376\021\373\035\235\353\311\177\n~\251\362U\362X\366s\377\037\375\332c\247\333<m\204\341|\320\207|\337\240\337{\357\356K\245\371&d\270(\377\237\257\027\332\317\311\315\333\037\234\376-\244\016\230\021\327\215~"
+	.string	"\276\300\227\267\020\335\nt\0326\275\236bhL\361\221=e\021\333\227\007\233\217\372\231\261\026/\327\314\312nv\375\272\257\"\236\205O\265\357O.\200\273\203"
+	.ascii	"?\202ZY\264\335\245'io\360\037\315\273\225\235\007\213\035\265"
+	.ascii	"\325\004\373zn\242\375Vy\035u\024j\247\337\331\314B\365Zk\213"
+	.ascii	"\306%\355\245feV=\002\322n\257\031\351\332}N7\007\341\246\307"
+	.ascii	"\215\337\347\312l\337\375w\2073\250\316dChs\335|k\231o\013\037"
+	.ascii	"W?m\365G\353=\305\005\244}{\177\211w\346\022=[\016W\026\276\007"
+	.ascii	"\305\354}\356k\206'n{\331\360\032\271\201\266j\310Em\321U\311"
+	.ascii	"@\rc\204CW\\r\347\246\334|\001l\353\006"
+	.text
+	.section	.gnu.lto_.symtab.3846b59827e8a97a,"e",@progbits
+	.string	"batteryWarningVoltage"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\001"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\030"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\001"
+	.string	""
+	.string	"batteryCriticalVoltage"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\001"
+	.string	""
+	.string	"batteryCellCount"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\001"
+	.string	""
+	.string	"batteryUpdateVoltage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\001"
+	.string	""
+	.string	"batteryUpdatePresence"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\001"
+	.string	""
+	.string	"getLowVoltageCutoff"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\001"
+	.string	""
+	.string	"getBatteryState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\001"
+	.string	""
+	.string	"getBatteryStateString"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\001"
+	.string	""
+	.string	"batteryStateStrings"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\001"
+	.string	""
+	.string	"batteryInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\001"
+	.string	""
+	.string	"batteryUpdateCurrentMeter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\001"
+	.string	""
+	.string	"calculateVbatPidCompensation"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\001"
+	.string	""
+	.string	"calculateBatteryPercentageRemaining"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\001"
+	.string	""
+	.string	"batteryUpdateStates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\001"
+	.string	""
+	.string	"batteryUpdateAlarms"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\001"
+	.string	""
+	.string	"isBatteryVoltageConfigured"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\001"
+	.string	""
+	.string	"getBatteryVoltage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\001"
+	.string	""
+	.string	"getBatteryVoltageLatest"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\001"
+	.string	""
+	.string	"getBatteryCellCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\001"
+	.string	""
+	.string	"getBatteryAverageCellVoltage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\001"
+	.string	""
+	.string	"isAmperageConfigured"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\001"
+	.string	""
+	.string	"getAmperage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\001"
+	.string	""
+	.string	"getAmperageLatest"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\001"
+	.string	""
+	.string	"getMAhDrawn"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\001"
+	.string	""
+	.string	"pgResetTemplate_batteryConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\001"
+	.string	""
+	.string	"batteryConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\001"
+	.string	""
+	.string	"batteryConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\030"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\001"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\001"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\001"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\001"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\001"
+	.string	""
+	.string	"voltageMeterReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"voltageMeterADCRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\002"
+	.string	""
+	.string	"voltageMeterADCRefresh"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\002"
+	.string	""
+	.string	"currentMeterVirtualInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\002"
+	.string	""
+	.string	"currentMeterADCInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\002"
+	.string	""
+	.string	"currentMeterReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\002"
+	.string	""
+	.string	"voltageMeterADCInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\002"
+	.string	""
+	.string	"currentMeterVirtualRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\002"
+	.string	""
+	.string	"currentMeterVirtualRefresh"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\002"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002"
+	.string	""
+	.string	"calculateThrottleStatus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\002"
+	.string	""
+	.string	"currentMeterADCRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\002"
+	.string	""
+	.string	"currentMeterADCRefresh"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.3846b59827e8a97a,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,483 @@
+	.file	"boardalignment.c"
+	.section	.gnu.lto_.profile.ce5948ed4e9bc4aa,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.ce5948ed4e9bc4aa,"e",@progbits
+	.string	"(\265/\375 \377\215\003"
+	.string	"\224\004\363"
+	.string	"\t"
+	.string	"\214\242\351\201\002\036\002"
+	.string	"\001"
+	.string	""
+	.string	"\001\240\342\234\212\n\002\214\230\327\245\016\026\002\002\002\003\004\002\004\002\005\002\005\004\002\004\003\242\302\263\302\013\004\212\373\211\303\f(\005\002\005\005\201\243\307\330\003\006\007\b\240\342\234\212\n"
+	.string	"\021"
+	.ascii	")\021\037s\341A\002\001c,`\330i`\245\031;\r`\006l\200\274\025"
+	.ascii	"\033/\004 \300\316\270\271\2036\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.ce5948ed4e9bc4aa,"e",@progbits
+	.string	"(\265/\375 F\225\001"
+	.string	"\004\002:"
+	.string	"\003"
+	.string	"\001\001\002\001\003\002\006\002\002"
+	.string	"\004\001\004\b\004\001"
+	.string	""
+	.string	"\004\001"
+	.string	""
+	.string	"\004\002\001"
+	.string	"\001"
+	.string	"\006"
+	.ascii	"Z\021b\32400W%\374K\030\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.ce5948ed4e9bc4aa,"e",@progbits
+	.string	"(\265/\375`\361\0015\013"
+	.string	"\006\2236-p\247I:\374\005Wq\260;v1\354\336\236oD\342\216u&\\\313\315\320\237\377\376\275\027]\305\201\354\350\bh\3777\261\3667\221;\005+"
+	.string	"*"
+	.string	","
+	.string	"'K`\212"
+	.string	"\266"
+	.ascii	"\212b\344\345\004I\b\332\001\b\013\3367\0336'\304\003m\025\377"
+	.ascii	"HQ[\205C"
+	.string	"\320\266\023\204m\233\360i6\b\334\242-\202X\240\225$>\246\241\030\347\030$\207y\327y\017mv\007\025\264=L\326\241\274\200\266\222O\334,\205\366M\263\326\001\211}\022b\325\241\264\276\246\207\324\301\277\320\354\025B9\\zZ\203\2620b\313\351\301\005\004\f0X\370\030\023\263_\244\177Z\324H\001\317\230\330\257\340\177\237\303[\251\251\256+f2\314\314z=7\327\\\327Ws\3634\263\231f\335\372$\366\034\322\tB\250\201H'\245\251\tR\220\202f\f`\202Q\3206\017\021`\261Q\314\016\205a\317\356\214\335\201\325(\267\200\201\004\220jp\211i\357\003i\303%egi\230\275\306\257>\363r\033o\310\341\372Q\265\2741B^4\037\203L-%\243\n-;jQ\250$\343\275\334\257\353\355\332\361\375|\304:\352\343\331\337vA\001\312b<\205z=\304\371\232\344\317\035\336;\236D\2678\371}i"
+	.ascii	"x\373\b\372\n\346\326Q\256.\321\277L"
+	.text
+	.section	.gnu.lto_.jmpfuncs.ce5948ed4e9bc4aa,"e",@progbits
+	.string	"(\265/\375 \214E\002"
+	.string	"\322\204\r\025\260%\351\347\3600,\224\301:aa\030\006\214\033E\304\3362\245j\315\242\t+W\304\217\254\367\340\005o\213aS\223\361dl\001\243\342TV\2329?W\363\216\201\005"
+	.ascii	"K\025\025\246uP\351\231\235Eo\240\r"
+	.text
+	.section	.gnu.lto_.pureconst.ce5948ed4e9bc4aa,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\232\004\002\231\004\004\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.ce5948ed4e9bc4aa,"e",@progbits
+	.string	"(\265/\375 \233\255\002"
+	.string	"D\003\217"
+	.string	"\003"
+	.string	"\001\020"
+	.string	""
+	.string	""
+	.string	"\002\002\007"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	" \340"
+	.string	"\002\f\001"
+	.string	"\340"
+	.string	"\340"
+	.string	""
+	.string	"\002\001\024"
+	.string	"\r"
+	.string	"\001\002\006"
+	.string	"\001\002\016\001"
+	.string	""
+	.string	""
+	.string	"\004\002"
+	.string	""
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	"\001Q\002\276p\340\005+;K@\351\241\342\210\272\200\347\201\224\3002\343\354B\332"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.lto.ce5948ed4e9bc4aa,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_boardAlignment_Registry.15.ce5948ed4e9bc4aa,"e",@progbits
+	.string	"(\265/\375 \2175\004"
+	.string	"\204\007Q"
+	.string	""
+	.string	""
+	.string	"2"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\303\247\373\013yw\350\324\005yu"
+	.string	"\005\001\006'\001\f\0020sq\300\001o\277\001m\276\001k\275\001i\274\001g\273\001"
+	.string	"\013/root/repo"
+	.string	"$./src/main/sensors/boardalignment.c"
+	.string	"\004"
+	.ascii	"Z\205H\271\351\231\304\r\240\b"
+	.text
+	.section	.gnu.lto_initBoardAlignment.17.ce5948ed4e9bc4aa,"e",@progbits
+	.string	"(\265/\375`\223\003\275\026"
+	.string	"\206\253\222E\260\032Q:\270\341)r\224P\0338\366Q\303\026\201_\257\246\207\371=C\255;\r\307\360\371\302\325\320\336#Vx\217\346\322\266\277\3623\270\033\216\200\177$\377\217[\206\336s6U\360\215\251y\003\376'\233H\231Rz"
+	.string	"v"
+	.string	"\201"
+	.string	"6\t\333\364\370\367l\262w\007R;\317\304\267B\326\300\013#\235\227\335\026\007\036\r\201\350\364\264\257\373O\355@(N\263\353S\244dw\207\300\nJ\217\336]\005>\226\016"
+	.string	"|t\315\326\022`\347$\205G\310\313\356\256\324\306k'\201\361\323\254\371\266\223H7\275\2030\036w\3623\365\340RQ=)>\002\273\373\241\347\212\036\235L\322\315\356:s=.\356\322m\227\260m\301\326\237!\230\322\023\226^\021.\301\370C\316\371\220\260\264\213[\340\013\3610\302\317\361\350\243"
+	.string	"\037S\372\241\003x\222E\306\017\320-\217\354\235Nj\r\373\337\252\217\035\32361]\023\323\251\003\375(0m\212\351\231/-\023\323%0M\212i\360K\307\230\376\300\264\306t~\351\0138\301\023Du\264\313\342(\314\022E&:\316\373\355\373B\037\262M&\361 \277\310\f\031\272\307\237F\375\242\360\030\304\235\224v\367S\315\351~"
+	.ascii	"\251\332\032\336\304I\006\334\2607\274\307Auew\027<~B\271-4\231"
+	.ascii	"jw`\345s\252\004pj\3635\365<cRz\235\320\243g%\310\230\267@\177"
+	.ascii	"\311\231\264\374\034v\275\362\271\027\370\310\200\207\017.\272"
+	.ascii	"\333\265\201&\276]\032\016\316{\214\035_\214x\336\355n\264\321"
+	.ascii	"\023\026\330\221\330\350\245\340\370\2475\210\274F\263\n\210"
+	.ascii	"\033\251\321\006E\271\2736u3W\210W\354A,\204\321X\264P\206z\200"
+	.ascii	"r+\001-\346\312\211\275`!X\037d\254\320\303j&\013g1\327l\025"
+	.ascii	"\203\261rV-\331l\225\240\200C\021.\331\212\026\206\262\225iw"
+	.ascii	"\373\267\352\343\233\233\352\234d\304\313#\017\310\007\275\n"
+	.ascii	"\016\202\033\273\267\347\374)\247\022A\002\016\016\370\370\240"
+	.ascii	"\367(\344\354\n\027\3629\253\272\020\355\250\315&\2651\234H\305"
+	.ascii	"\314\230dt\246\2442\372\035\201=JIU\205\356\013I\355\f\207r\004"
+	.ascii	"$E\005\003? \300\002\231\031c\007@BJ\016\212\246?\265\361B\232"
+	.ascii	"\202\222\306\272\265\216\251h45K\371\254\025\250\206\310\344"
+	.ascii	"\036cR\022\303,.\263\236\307|\002<h\021cw\020,3\222\3050\350"
+	.ascii	"\302\373F\b<p\007\243{\340\205r6\206\240('\361\265o\206\357\\"
+	.ascii	"1\002\221\272\230\242\340\016\350\302\005Q~U\263\270*@\001z\303"
+	.ascii	"\352Y\343\034\0373- \003\037\022\367\346\035*\3227w\352%\025"
+	.ascii	"\355\274\"\241\030\320\215\222\323\333\265\312"
+	.text
+	.section	.gnu.lto_alignBoard.18.ce5948ed4e9bc4aa,"e",@progbits
+	.string	"(\265/\375`~\004\005\027"
+	.string	"\006*\220I\260TN:\372\034:\333i\001\253\034\026\222xA\fT\357\024A\241\037\241\361\016\374\343\376\205\371Z<\f\213\325D\"\236\210\316\206\365\300?\245?\305\037J\266ls\336\242p\332\313\177\220\306\272\376\354_\373\226H#D\312\224\002x"
+	.string	"j"
+	.string	"~"
+	.string	"\177\323\377\364\265\377\025w:\224eO\032\0264\271\214\301@\233DB\033J$\030\177W\321;\223\313\021\250\003n(\313\3075\347$\360\3205\343\303\030\360j\377\304Q\364\276\344\251\327\346<JA5\347O\306\007\306\207\376\375\006{8\336\006{\350\236\375\343?\244\251 I\006'#sN\335\216x\357\332\363\017\365\230\257\b\350*2\230sZ}E\036\356\275m\001\266m\354\320\026O\362=\005{\330\2624FPD\037\202\364\313\376\001\351\212\260\017\316=\262\317t\277\274\351v\371\323\335\362\245\237E\3259U\257\250\032\247\352\233\252UTmSu\212\252k\252\246\251\032E\325'\2526Q\365L\3252U\227\250:\246\352Q\325\242\252a\252\016U\r\252zU\255\252~"
+	.string	"\003EV\276\346\344\360\205db\205U$\316\024G\306\235=\207/\210\270\341\216\233\223zY\330\212\313\3425\303\345\257\016\3432\310[\305\320\373\n\366\020\266\277\002W7\\\320k\b\204\313\356\202+n\275pi#\363+\262\306j\327\206GU\313~uA\032C&\204\364\313U.\001h\331.\360\026$\f\202\362T\023\374\244\207\256\360\243\367=\364\177`\017\277b\327\223R\225\324\370\2629\027Q7.\375$\320ei\214\312\263\270qyC\232s\006\026\376\363\013\317\321\241\260\316\231\361\351\321\341\351\201\260\023\001\347\001\017g\347@G\362vd\217\016\251\353\331\301\341\321\345\360H\335\314"
+	.ascii	"\357$\350\360t>\273\035O'\373\315\203s\217\334 \004V\320\n9\267"
+	.ascii	"\276\324\312\3366\207\333\225e\361\"2D\bNeS\366f[\225\025\267"
+	.ascii	"\272\270\200\330j\233\262\345\243Gm\305.(%\332\372Q(k\262\264"
+	.ascii	"\223EY\026/\255\035\344\255t\234\314\266dMd;[q\013G\326\rYlK"
+	.ascii	"\260l\22005b\001Q\2501d\203\220TbAFA9m\326\360\002\221\231\242"
+	.ascii	"\007\020(\244\310\214\230Xks\300\214\203/*\350\202\024\032u\365"
+	.ascii	"\232imx\202\314R\203\377F\002\225\220\034\200\241?\313j\315D"
+	.ascii	"p\270U\211 \364\240\31110X\224'\306\033\201\317\351\013\031\306"
+	.ascii	"3\242\323\036R\3704\376\214\352\r;FU\241\306\3244?`J\016c)j\371"
+	.ascii	"\247B\212,\003q3\270S\247B\2136\373r\274\242\334zfD\370\276\203"
+	.ascii	"\222B\267W/b\260\030\216&\311&>\300\351\202\007\301J\352\210"
+	.ascii	"\346\202\037*"
+	.text
+	.section	.gnu.lto_alignSensors.19.ce5948ed4e9bc4aa,"e",@progbits
+	.string	"(\265/\375`\266\006\245\036"
+	.string	"f\365\271I\260\324Q:\330P\230qx\356$p-@\343\032\237\217'!s\264}N\024\357\023d\315O\366\025\305\302\305\247j\337\237\364\372\360c\365\005\376\346C \335)C\t\377bD1|yx\270\364\035\022\247\337\366\244\221M\266L)\246"
+	.string	"\232"
+	.string	"\244"
+	.string	"\247\256@\236\026\020\347\332\021&\344\036<\341Y+p\212\302\327\276\216\357\310\235\207\207\\\246\326\244\034Q\265\006\037X\002y\352\340m\306S\3624\343\251s\366\325\2030\352\245\020\245"
+	.string	"\302Uk\255\315\027\317\2356\223\305H\330H\305\2719\377"
+	.string	"\013,^Ow\232\001\244!\243\317\304\006YD\272\274\206\220\221h\263\"\006\357Q\204~+\343\212a!\237\300\246F!4\350\354AC\204\335<\035\203\013\034[\220\206\212>\211|)v(\202d=\240\221\254\265\036I\250\210\\\330M\255\325\313\353\r\3351\267\315\3056\006{\354\t\037\2225s"
+	.ascii	"\026\250\r\036\372K\"\315\324@d\365 \033<$`e\311\367\220\361"
+	.ascii	"tfj \242RQ\364\263_vP\267S\311\276Xk\255\236I\366\203\277\315"
+	.ascii	"\231\356\2327\3354w\272g\316\343\227\031\3271tM\243\353\031]"
+	.ascii	"\313\350:F\327$]\303\350z\244kJ\327\"]O\272^\272\276\002\230"
+	.ascii	"\027\224\001R\265\256\370\372R\253h\021\031g\372\233~\247O\373"
+	.ascii	"\007r\341\237<s\372]h\032Q (@U\001d4\303\002y\037\377\221;\323"
+	.ascii	"\bR'$\200\347\342(\253\326\352 >-]\276'_\241\r\3308\375a\315"
+	.ascii	"\034gy$\244t\226F[L\276\302\3378C\345\206O\024gi4T\362\025\366"
+	.ascii	"\350\234\263\374a\355v\372Av\226?\253\235\026\222o\323\2268\225"
+	.ascii	"\246\017\265P<\255\237\375\362\314\374,\177\302\235\026\315\004"
+	.ascii	"@{R]\276\237\375\362\213|lR\245[0\016N%*~\0252K\024_"
+	.string	"\n\214\212\312\257\032\2274\361\235P\250)\177\211\350\224\304\227\2329\214\370G|E\356O\214\247^^\005\2121\243\266\260O\304\366\325\217\370j\325\035\270\274\312\340\324f.\260\372R\2116\214\035$^\342&\316c\323\361\301\361\261\335H\037\\\216\007\321\035 \370\360\344\354\360|\320\t\201\343\341\206c\343P\303\335l8\236\034\\\215G\007g\247\326\341\206\253AH`\233\210\234[\315\307f\273\325f\301z\261\316$g\360R\3653\201h\263\225\2316\210\235=\3174aWU\320\324\035\206WV\324\f7\306L\016?\256\004\255\227}\256w\341\374%\333z\366\274\236\3614f\376\351\bz`\272|Q\367\215n\301\310h\264Y\002\277f\263Y\002\267vZ2\331,\201XS\276\302\251X,6K\240\024I\316\0228\334iA\371\n{\2200\330,\217\260vW7\002\200\202\250a\\\204\02444\"J\nS\220\2441"
+	.ascii	"\003\221\241\332\034\021\2608\351\0341\231@I\n\316\001s\350{"
+	.ascii	"\002\320\033d\255hj\252?(\254\274d\351p\t\211#\337F\002\256\265"
+	.ascii	"~\242qD\300\210~\341,\251i\376\025\277D\216\024\264\243\224\213"
+	.ascii	"\030=\031\340\227\241X\217`ns\\\b\022\004\356\206\037\266\253"
+	.ascii	"\025\344]\007\370\016\340q\301\345\232\236{\251^\362C\365\342"
+	.ascii	"\340#;\017\354T\355o=3\332m\367$S\203L@/K'#jJ\347\231\320\375"
+	.ascii	"S\272\177J\367O\351\376)t\217\027XK\252\035\035n\224K\220\222"
+	.ascii	"\240\035\306'\313\3176\026l\310\"\261\257\033\254G\2326\304\030"
+	.ascii	"\">X\twl\322\00253\205\241j\322\177\300\272{\224\004\245\361"
+	.ascii	"\331#\264\360\022\330\231\2573\205\374&H\272\210\266 \3360\r"
+	.ascii	"\252\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.ce5948ed4e9bc4aa,"e",@progbits
+	.string	"(\265/\375 \3775\005"
+	.string	"$\b\373"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\022\177\017\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\200\202\202\200\006"
+	.string	""
+	.string	""
+	.string	"\005\013\013\200\204\001"
+	.string	""
+	.string	"\003\002\021\177\020\272\200\202\002\n\021\023\177\022\017\023\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\f\024\201"
+	.string	"\005\r\025\002\026\001\025\177\027\377\037"
+	.string	""
+	.string	"\200\200\200\001\024\177\030\003\002\n\201\200\200\300\003\001\344\006\204\n\244\013\003\002\t\344\013\003\004"
+	.string	"\320\360\372\250\001\001\342\026"
+	.string	"\016"
+	.string	"`hP\260K\341}\212\274\310t\362\004\303\345\007Fc\311LV\326"
+	.ascii	"\337\201lDY\231\346Pe"
+	.text
+	.section	.gnu.lto_.refs.ce5948ed4e9bc4aa,"e",@progbits
+	.string	"(\265/\375 A\t\002"
+	.string	"="
+	.string	""
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	"\001\004"
+	.string	""
+	.string	"\001\006"
+	.string	""
+	.string	"\001\t"
+	.string	""
+	.string	"\001\r"
+	.string	""
+	.string	"\001\017"
+	.string	""
+	.string	"\001\022"
+	.string	""
+	.string	"\001\026"
+	.string	""
+	.string	"\001\030"
+	.string	""
+	.string	"\001\033"
+	.string	"\002\002\001\003\b"
+	.string	"\002\001\027"
+	.string	"\001\004"
+	.string	"\003)"
+	.string	"\002\005\002\006\002\007"
+	.text
+	.section	.gnu.lto_.decls.ce5948ed4e9bc4aa,"e",@progbits
+	.string	"(\265/\375`\266\021\035["
+	.ascii	":\237\234\"R@\220J\032\016B\203\301\201\305q\247\210M0\212\225"
+	.ascii	"\005\376\246\244s\036x\337\301YH\204G\302)\240u\223C\207Jg\353"
+	.ascii	"!\260\345\2315\005\262w\205\231\376]a?\314\220N\230\372\257\377"
+	.ascii	"y\324\333\326\333\371\206R\352\354\224,+V?ol\333D\312\024\311"
+	.ascii	"\001\022\002\037\002Z=\225d\314\242ms\317\036B\235\002\247\\"
+	.ascii	"\246\350W\215Z\3268aj\234\024\325\324\237\370\022u\025\306\247"
+	.ascii	"s4\r\261B\266^\376\305s\\[Ij\366\302\216+\347\212Y\035\266\271"
+	.ascii	"d\013fhh(h\237e\330\256T\364\313\245~W\365\033E\375>Q\277L\324"
+	.ascii	"\177\271lI\325\2428\025\031\035[\217\274*ln\316\030\375F\251"
+	.ascii	"a\253es\330\346\212-\030\272v\037O|5\271\312\262^<9\335RVU\335"
+	.ascii	"\375\265\362\027}\305vk\275\006\270\321-\025\305S\234\263a%\327"
+	.ascii	"\335ACCC\252U\\\230,\025}O}\007\352+P\367\312rm\363b\213\345"
+	.ascii	"\213\303Zy\316qm\346\"\331RD\302\350!P\277]\027\240\254\273\201"
+	.ascii	"\367\250)tw\343\354\305\322\263*b\201Rt\253,S\207\324\261\\?"
+	.ascii	"\354\034y\256T\230\377N\331u\265r\300\324z<a\364\253\365o\326"
+	.ascii	"R\371\027/\273\217\335\r\202\305\230yA\216\321;\027(\345\355"
+	.ascii	"O\312\313\005J\021\330\237t\245\024}\261\376\215\262W?i\022j"
+	.ascii	"\355\255\356\356\321\201\215\325\230c\224\327\005J\325\375I\377"
+	.ascii	"\267Y\246\265\r\236\3673\320\177*.\326\374+\0023\306\1771\377"
+	.ascii	"\311\376;\377\243\375/\373\327\267\244\345\177\226\377aA\377"
+	.ascii	"\232\360\037\256\200\237q\376\225\340\337\025\377R\360o\004\377"
+	.ascii	"B\360\357\004\377V\220\364/\002\377>\360\257\003\377w~\316\361"
+	.ascii	"/\214\177G\370\267\203\1775\370\267\305\277\026\374\353\341\337"
+	.ascii	"\335\277\272\377s\377\327\376\217\375\327\372\237\346\177\334"
+	.ascii	"\1773\377?\370\357\342\277\333\377\266\377c\376o\371\377\342"
+	.ascii	"?\363?\007\377C\374\377\362\177\367|>\237\377\"\177\035\210\237"
+	.ascii	"\007'\367\232\273\021\006l\317\354\246\322\264}1z\235\224\372"
+	.ascii	"U[\246\261M\246\261l\2736\217\024]k\211\353r\274\371\033nZ\250"
+	.ascii	"\326\265\221A\t\361\244HY\0011\236\233z~\214yz\302\305#\305\247"
+	.ascii	",\\\344n\366\270\201\311\330\272\203\325%f\205\321\347\202\351"
+	.ascii	"|0\341b\203\234\372\225\3335_6\315e\263s\352\332<T\274\201J\n"
+	.ascii	"\375\333\346;\367/\320\300\311\360\272\257\272{\200\025\203\364"
+	.ascii	"\272\302\350\321\334\353\177\216*\303\330\215\032\334\324\363"
+	.ascii	"\237\2661\331\335=vk'\233x\337\335\256\320\277\263\2725\340?"
+	.ascii	"\332\272\233\250\352^\362\026\247:\3712\006\271\210\376\r\335"
+	.ascii	"\305\017\275v\022\311\224*\"\253\224)?\254M\004D3\251\032\271"
+	.ascii	"J)\321es\257\275}\224R\236\200\\\227I\344\272,\372\364qY\354"
+	.ascii	"^\225>\310-cq\221L)%\222\271T~\350c\027\233i$\242\036\227J$\230"
+	.ascii	"\245\322\007\3114*\221G)\345\007%oI\226\340\030c\354\262E\344"
+	.ascii	"\261w8\t1&}\234\310u\331i\335\273U\243\223\006t\013Y&\323\214"
+	.ascii	"-,X\223sGS\323\270\334\325\251ij\331G'\222\206e7\rMJ\355\304"
+	.ascii	"@qu6\222u\026\251\204\264\216\032\335\002\364\332\355\324]\334"
+	.ascii	"vvw\261\273q\222B\326n\027|\220UNN\335PAN-\244\230\245F7o\255"
+	.ascii	"\201)\221\314\251eQ\026\034\230Umc-nU\247I%Uf1\253u\300\251U"
+	.ascii	"J\037g\32247\3152[\254]\204\240\351\343\207\\'\223%\316Oh\342"
+	.ascii	"t\316\334\240x0"
+	.string	"\272p!v\216cxd\335P\267\314\276m\223\2005\243+R\351\331yc\365\246\r\243\347\242\372\347\022\220\256\2745.1h\334\330p\242\214Mm1\272l\274k\333\366e[\265/\320\300y\307\276\352^\227\r\3556\356\216\340\331\035\261\023[b\324j\223v\326\223\305\315\fa\214vY3]VR\0033%o{\266;lhf\252\260\205\361\234\265\200\005,l\265\260\234\200 \2474\233\334d\260\t\266\332\250\024\332\322ksr\235\344R\342\303\022\247\r\2142\026\366\332\246\020\177\345\240\301Em1\372\335\223\372\025J{\204\322\357hpq\261\321\271q\006\b\227\031\365g+M\266\302[hN\2671\006\260NB\225\320\261\221\303\201\253\007\016\331\225\366E\375Z-\3538\277\260M\326\301U\202\262\326\242\007/_BJ\344\270!\362\364\305(s\315\001\244k\313K\375^Mq\2214)#Lu%\206\tW\325"
+	.ascii	"\206\211\314\300P\326\t\345\323G\257\2667,\206\201\251x\212\037"
+	.ascii	"\272\251\310\252V\326b*<\205\245p\3266\031\213e8\017\341\345"
+	.ascii	"\203\370\bc1\022^\262\316#\023\\\205\031\n\032\322AC\323\304"
+	.ascii	"\311\203N\335m\200&d\013\254\265\267\356\025\n;a\253uB\255\335"
+	.ascii	"C\007K\225Y\234\\\367\372\237\243\360\3256\031\312\203\326\356"
+	.ascii	"\255\2356jrX\251\325\r<0\034Al0\31260\277\344\240b\362d\233\\"
+	.ascii	"\203\215\031\3340a\224i\270\333\215\"\216\034b\350S\226(a\222"
+	.ascii	"\250G\213\250G\241\232\250goQd=\324\243;T\216\201\223l\223\004"
+	.ascii	"+\371J\341#\337\031\327^9\211\233+Z\214\036\245\241~I\244\272"
+	.ascii	"\347sI\244G[\365Y\240\364:9\365:8\365\347\"L\265cz\211#\243\332"
+	.ascii	"3l\026FGS\031\325g\177R\021B\373\223\262\013,\204\243\376\234"
+	.ascii	"\036(`F\272\306\250\347 .b\020\323\305(\312Pg \177\016\177iR"
+	.ascii	"\345T\246\236\177p\013\177\016O\032\223+Y^\324\363S\3273\016"
+	.ascii	"\b\243\314\202ZC\327$\341!\312kH\020F\317,\374\274\203y\260\017"
+	.ascii	"\022Tx\272Q\303(+\271\307\331\007'\233}0"
+	.string	"\260\3546\262\217\236\271nc\317\356\210\335\021(\224\251&\\)z\235\025\365i\013\224\356d\025\235\235t\310\306\336\2464a\033l\203q\254\031\020\316\301M\031\222\033g\034\353\244-\252\f\243\214\f\304^p\t\306\356\305\360\0274\004\366~H=\017\202\037 \371\f\207\276\243\243^*\302\211\020\212F\330\245\360\023\022{\034,\375d\224\360s%\023\033|\220\301\013\"\242/I\330#\2120\341(\270\304\302'\f\262\350\231\301\024d\361\023\303G\034\316x\001D\274\222\211$&\242$\246\237#\240\214\013\210\276\241\016\020\006\023}C\237p74Jb\342\021\215\200IL;`\022\223\216h\204\242H\365\251\360\033\242\303\241O\210\204\324\303\231\301\024<B\205D&\035\222\017\007\3117\224\201\036\371\2068\027\032%1\231\330\021\366\224\216\320\031B\342\360\227\344\363\300\210\002\020/xH\302\036\022\260G\034\006\260\202\370\003\376"
+	.string	"X\341\341G?\241\017\350KR\317"
+	.string	"\212\004P\244H\001\347)T(\240B\201\364)T\024\025\251@Q\244\036E\221\356G\300\340\217\330#\006=\330!\352\020\215R\020\201?\0318K\301\340\n\243\035\n=\241\016\206\017\311h\347J&\206J\304^\f\"`0F\214\340\221"
+	.string	"(\364f\350\214\230`\344\240\273\241o)\t\330K\211WB\340A&\237\220\210\030\f\n\211tP\350\315\36004\242\300gi)(\324!\032-p\202\b\374\341\334\001\007X\210"
+	.ascii	"\301\005\006\352\221\t\"\320\027\003\230\364[\352!\t{\301\022"
+	.ascii	"\210\206\302\340\020\350\033\022\001"
+	.ascii	"\177\275\030DG\302!\221\211\003\206>\2370\311W\201\322\021\361"
+	.ascii	"\307\3043\263s=?\300\354\020\306\350\277\270\314Q*\313,\037\336"
+	.ascii	"Z\034\226\264\007\031\2625W5Xpc\264*\\\310\3101\312j\254\306"
+	.ascii	"l-\212)\272\360\332\231m\331xjp\350\030\262&\215\267\232Hy*c"
+	.ascii	"\324\351d\264 \265\245\230My\333\275\021i+rvF\373\327\223[T\215"
+	.ascii	"\035\252\342\224\024\031e\035\270l\233!\330\354\314\221&\245"
+	.ascii	"\031u\205\356\r\221\356\363\271!\322\357\234\352\265\\\013\223"
+	.ascii	"-\225\346\261Z^PB=k\031\"^\314\345Lv\016\303{3b$\307\027\006"
+	.ascii	"\363\347\344\264y\371b\326E\345.\354%E\373\241\246\310.\214D"
+	.ascii	"\316\263HFMU\033%9\360\026\017.\270\211\332\262\205\307~\344"
+	.ascii	"\234\274\026\216'H\221\"8\030e\261\007\201K\250q,g\024D\310\314"
+	.ascii	"\314H\020I\222$\035\001\005\204(\3474\264\036\022 V5\314\034"
+	.ascii	"c$5)d\3778\201"
+	.string	"Gb\255u\033\f\027:\317\355\333[u\036\007\327S\330\245\263\023\007\335\224\232F\033\f\224g\031N\343\271\3644\177\177v`\034\244'\034U\024\330\030`H\273\360\275\241r\210X\201\235/\222\252R.\327\310&w\330\243\330\3443\355B\233~\261-_\004\311a\260\240\361\330#\304\271\341 TmE\255\275x_\017\227\223jV_\310c\361\230\305\361\223&\030\214g\177\034\333v\356\317k\250a\350\024\333l\361\016\256\177\340\301\374\272\001$ {.\3005\001\345'\250\221\276\037\211\252\204\0250\350\327\215R\206\322\003E{\374r\370\211+|\253/\263\237yeu\247V\313\205\2578i\007\340\357\336\"\026\234\020\361\210\021\203\007\272:!b\3605[8\002\275aqR\"\001U\001\346\304\317\324\027\214p\242\324\324\251\310\334A\325Z*?\344\016\301\0174V\332\373\210\301Nz\004\357\033\004\325}\225\242O\324M"
+	.string	"l\3504\230\026\036\013N\373:LCO\270\230\362\213"
+	.string	"KE,z\317\f\006\"\354,cH\200*\217\033\341u\273\016S\365\340\216q\235\220\326\314Z\233\245\305\033\267\220\tdWY[\251\247\022\357%\004\231\251\363\245,H\253\246)\373\330\004\006\220f\216v\276\265\350(\204\001\375;!\004+A\2632\215l\230\203\225s\323Ah\271q&\376\354\237u\333\303\231l\360\305\322\250\007\255\245\341\274b\234?n\262\017\336\255\257\016\315lNp\034\357g\003\272\315\270\232Y\035M\304qO5\207o\200H4$-J\236n4\034\250D\355 \217\363\343y\244"
+	.string	"\304^\204\235\361\t\033'\203\264Pb\t08\024\242$\331\020d\022\345\3448J\242\f#J"
+	.ascii	"VI\352\337\331\332{\234\321\\\021\306J\323\217l\375\346\333z"
+	.ascii	"\201\r\335D\270B\221k\023e W\332Sf\353\001t9\215\347p\272\r\353"
+	.ascii	"\006x\362?#\217\252=\266\260\263\024\3154\316\\h,\031\314\360"
+	.ascii	"\322\245\203\355\\\270\320\205y\361\214\201rKq\240\036v\273\300"
+	.ascii	"z\013\fh\005\033\355:Qj\213l7A\241l\200E\f\277\200\225\206w\353"
+	.ascii	"\267\336\367\374a\003M\206@\b\263\r\3006\204\311`\210\2636JD"
+	.ascii	"\217\213\235Q\004\355\316\362\t\261\347{\007{\246\273\007\007"
+	.ascii	"[|\360_J\274\335\207$\326\314\363n\365\232\267\030\255\306\233"
+	.ascii	"s\035'g\237\311\370\364\255\317\344h\032d\0059\257@e!\272*"
+	.text
+	.section	.gnu.lto_.symtab.ce5948ed4e9bc4aa,"e",@progbits
+	.string	"initBoardAlignment"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\001"
+	.string	""
+	.string	"alignSensors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\001"
+	.string	""
+	.string	"boardAlignment_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\001"
+	.string	""
+	.string	"boardAlignment_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\001"
+	.string	""
+	.string	"boardAlignment_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\001"
+	.string	""
+	.string	"buildRotationMatrix"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\001"
+	.string	""
+	.string	"degreesToRadians"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.ce5948ed4e9bc4aa,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,586 @@
+	.file	"compass.c"
+	.section	.gnu.lto_.profile.3aab441710d58fc0,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\005"
+	.text
+	.section	.gnu.lto_.icf.3aab441710d58fc0,"e",@progbits
+	.string	"(\265/\375`#"
+	.string	"E\005"
+	.string	"\024\007\027\001"
+	.string	"\020"
+	.string	"\337\375\307\265\007\022\002"
+	.string	"\002\001\002\002\002\001\002\003\001\317\253\250\341\002"
+	.string	"\002\315\344\253\361\017\002\002\004\002\005\003\240\342\234\212\n\004\240\224\254\300\003\006\005\314\361\201\203\017>\002\006\002\007\002\002\002\b"
+	.string	"\002\007\002\003\002\003\002\t\002\t\002\n\002\n\013\003\n\002\n\006\007\t\352\263\360\321\b\n\013\f\r\016\377\315\206\374\016\017\020\240\342\234\212\n"
+	.string	"\030"
+	.string	"@l\347\035h,E\304\313Y\252\335\217\021\364B\2603`\027"
+	.string	"\002\370\3120\004\013^"
+	.string	"\374|"
+	.ascii	"\013\200\273\234coJ\255\363\026\2405\315 \333Y\253\0017"
+	.text
+	.section	.gnu.lto_.ipa_sra.3aab441710d58fc0,"e",@progbits
+	.string	"(\265/\375 /-\001"
+	.string	"\330#"
+	.string	"\005"
+	.string	"\001\001\001\001"
+	.string	"\020"
+	.string	"\007\003\002"
+	.string	"\003\004"
+	.string	"\003\005"
+	.string	"\001"
+	.string	"\001"
+	.string	"\001"
+	.string	"\003"
+	.ascii	"7\247\276\004\267\2016"
+	.text
+	.section	.gnu.lto_.inline.3aab441710d58fc0,"e",@progbits
+	.string	"(\265/\375 \337\355\003"
+	.string	"\262\306\024\036\240\031\322\0018\3648\\\025/\327{!D\352\346l\007\024"
+	.string	"\200\241^\f\312\226\220-w\n?\301lX|\354_P\210\2226U\003\331$\2629\026\370v\346h\323\271\034he\002^\3216]\b\266\255]\377\234g\203?2\332\006\370\225 \244\355y\363#\020"
+	.ascii	"\256\321\024s\235\244\220#\215A\206`\034\205\230K\240G\341\371"
+	.ascii	"<\006Z\2005G9p\0239\232\306`\261c\003m"
+	.text
+	.section	.gnu.lto_.jmpfuncs.3aab441710d58fc0,"e",@progbits
+	.string	"(\265/\375 \204\305\002"
+	.string	"\"\005\021\034\240'\351\377\377\017r\006"
+	.string	" \372wRO\377\001\300P\t]|a\274\204\354-S\n\022\216b0\232\361\213\267\310\004\243\362\306\347\303\374a\266\211U\342\225\254\032\016\b\013T\006\212\226\0160\375\337\241\267\210\004\006"
+	.ascii	"\240\b9\213\232I8r\326s\363\266\r`\001"
+	.text
+	.section	.gnu.lto_.pureconst.3aab441710d58fc0,"e",@progbits
+	.string	"(\265/\375 \024\241"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"\232\004\001\200\004\002\230\004\004\204\004\005\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.3aab441710d58fc0,"e",@progbits
+	.string	"(\265/\375 y\245\002"
+	.string	"t\003m"
+	.string	"\004"
+	.string	"\001\270\006"
+	.string	"\001\002\023"
+	.string	"\003\002\024"
+	.string	"\001"
+	.string	"\001"
+	.string	"   \002\025"
+	.string	"\020\020"
+	.string	"\300"
+	.string	"\b8\002\330"
+	.string	"\330\001\001\002\001\002\026"
+	.string	"\001\002\027\001"
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\013"
+	.ascii	"3\r\320\f\311\312\200\t4<\003\324\214\34134\313\221-\275\300"
+	.ascii	"*0\300\002"
+	.text
+	.section	.gnu.lto_.lto.3aab441710d58fc0,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_compassConfig_Registry.26.3aab441710d58fc0,"e",@progbits
+	.string	"(\265/\375 \226M\004"
+	.string	"\264\007_"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\202\200\200\374\342\303\276\331\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\356\006us\350\305\006uq"
+	.string	"\005\001\006'\001\030(?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/compass.c"
+	.string	"\004"
+	.ascii	")\"\301$\032D\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_compassConfig.27.3aab441710d58fc0,"e",@progbits
+	.string	"(\265/\375`Y\001\275\013"
+	.string	"v\224LA0\247\272p\220\003\006'\225\277\204\250S\247\335zx\256\375\253\327\357u\306\353\343T\360\223\302D\244*\212\326\276z\361c\373\357\353\377{\372R\300$\204B\322C\t\361\314 Dj\f\336f\022\022\222R6"
+	.string	"8"
+	.string	">"
+	.string	"\273\352\203\035.\377\254~\003\376\273|\001\374\347\323n\300\371\320\344@d\353\356\206\236\311\317w\247\177"
+	.string	"\307\244T\350;\004\212\335u\227R\221\334\336m7\330\216\260\217\013\377\374\023\370o\"$]\275\034\240\272\234\255\242\235Wb\337\262\273k/\265\017\373;\215D\312\212\343\b\330\035\311=\330\332GC\311\330~g\377\365\225\363\260\323\025vS\005\263\007Ft\201\353sZ\353\266\202>\213\335\n\334\316\270\201\226m\r\235"
+	.string	"\t\265\271~\022h\223\037@\272\020a\255^%\3206/+ab2\327M\240\275\361"
+	.string	"\246\313\356B\3701\216\216\315\t+\037\020\206\210\254H\260\3301M\317(D\212\241Y\222\246h4C\021\310\023\n\305\322\f;\f&Gc\031j\220d\031f\324\275e\275\324\026*5\224\347\341#\270\355y\202Q\305`\004m\361\001\033"
+	.string	"s\311\"c\017\213Z\213\263"
+	.string	"\320\266\260\336\b\250\003\260\003\337!\2659\370\315\t\331N\352\017\030\220\364\"P\240\003\bH\251\244A\306\223J$\324a@&4\203y\227"
+	.ascii	"\232\325\224p\207\027\355$\003"
+	.text
+	.section	.gnu.lto_compassDetect.30.3aab441710d58fc0,"e",@progbits
+	.string	"(\265/\375 \367\315\006"
+	.string	"\242M15Pm\222\016d\254\256 \251\242\275\306\016\241j'.8r\204\375\354d]\214\277[\001?:[wp_\323\314\314R\"Q\344\254/\206\n\343j\177\264\rBd\n\022\233\007\267\225\201P\343\341\\\326\203\330\005;\033\370:\020\032\316\2630\3702\005_\236\r\366\"\256\013{\230\230\315*\203\tG\3611\324\234\306\027 3sG\372\366Q9\2554\230d\212ZX\362\204\"\341\370\373\203\036\363\267\366\365\250\t\324\217O\0052I\246\221\314\250p\302\245\324\261\004U\251K\007\252R\377\013\f\240\263\306\rQK%\025!\247\314\370\\\251Y[v\013\322\203\216\224\f\024\221Q\250-\300!3o\026\243\213\356\372#\374\357\307\b\006"
+	.ascii	"2\003\202\341\243\302b\025\020w\031\363\272&\031"
+	.text
+	.section	.gnu.lto_compassInit.31.3aab441710d58fc0,"e",@progbits
+	.string	"(\265/\375 \376\355\006"
+	.string	"B\21505Pm\222\016d\254\202`(\006A\213\352\316NR\344i+\213\256\322T\r\252\033\332\355h\243\356l\335\301\277\331\314\314q]\001\025i\013\214X\3603\344\206\b\221)S\226\0301\034ME\301hUq\223\211p\303\200\321@\312\212\320Bp\305\311X\260\241\252,X\331\260^\224/\330\373<\351w\006\357P\217I\003Zf*\334Q;\036.F\247!:\256\240N\267C\351\324\215\272Q\205\006\005G\ts'\277}\334\273\370\002\344\263\370\327\214\244T\262\020\222\031:1I\221\t$\343\367|e\204\004\317W7-T\321\210\304G)s\203O\324\253\356\272\002YD]\300%3w\240l\242\277\376\005\377\301\257\005\t"
+	.ascii	"2\003\302\360\030aF\035\302qM\314\212\300D\210\034\356\334m\213"
+	.ascii	"\023"
+	.text
+	.section	.gnu.lto_compassIsHealthy.32.3aab441710d58fc0,"e",@progbits
+	.string	"(\265/\375`e\001\215\f"
+	.string	"\366\226P? o\224\016\303\002\202\300\" 0\250ar1\002R\242\272"
+	.string	"L\021p\235"
+	.string	"\220\002\241D\215Q\264Ov\314\fFZc&\230*$"
+	.string	"\032\200\236L\214\366O\215\237pZ\310\251\016\331{K\231R?"
+	.string	";"
+	.string	"A"
+	.string	"\32784na\002\006\210\212]-j\205\213\016\237\323\024\371\024\346\245\020\021Q\312\260C\t\177\020\322I\262\213\324"
+	.string	"\331\003G\331\335kxfd\244L\n\263\273\316R\026\341\246n\333c\273b\277#\376\205?;"
+	.ascii	"\345K\177>\b\376]''FFy\2625,u\303\276[5\331NCM\273Lk\2463\323"
+	.ascii	"\247\004d \261 \304\256\306\211\305\216x#\030l\207l\211\017 "
+	.ascii	"\bY\024OM\372\016\377\340\355!\036>\377\020\271A\300?\325\207"
+	.ascii	"\350]jR0p\020o\361\343c\361H\215\317\335\305t+p\325\022\036("
+	.ascii	".r\205\345\232\267\211\211\335U`W\347\360\031\300\261\273\t6"
+	.ascii	"\274\343\n\326\\\256+\343\341T\232xY\325\325\331\\\261\303 \303"
+	.ascii	"\211\032\353\212\027\002\256<\033+6\250*+J\264\275[59_\345\351"
+	.ascii	",w\232a\033*e\244$;\205z\214\026\243<\001\200\272\001U\333\305"
+	.ascii	"\002! \320\002\031\n\356\006\013\031z\306\031\336\313\"\007\034"
+	.ascii	"\307\204\361\b\274\244\006+\353\336\314\225\336\353-I]*\243q"
+	.ascii	"\273\344\224k\324\250\001v\334\263\201.\030m\006\341\371\341"
+	.ascii	"\313-J\005E\036\274\217y\234\244b\240\033\005\247\267k\225\001"
+	.text
+	.section	.gnu.lto_compassUpdate.33.3aab441710d58fc0,"e",@progbits
+	.string	"(\265/\375`<\016\245<"
+	.string	"Jb\204\025CP\244N\007\003?\343\376\361\355\204\365\246\252\302/:\326\374\024\013*\376,\356\303\206\0256\255\266\021\312\2415B\240 B\030"
+	.string	"\005\254"
+	.ascii	"(\200\373z7s\242++>?5 \004\201M\204\354\275wJ)\005@\001(\001"
+	.ascii	"L\001j\3209e\235\177uv\325\2719\034\373\250\251\n\2747G\340\237"
+	.ascii	"\233F\215\302\365]\267\225n\272n*\235\372\273;\313\334xL_\306"
+	.ascii	"\373\305F'\316\016\313\025\276\272\274+s\334P\356*T\370K\260"
+	.ascii	"K,xw\345\r\360\336+\325*C\b\266\232\022\231\271\235\271\243\364"
+	.ascii	"\\\333Rb\260\360\336\264\271-\367B\0230\202`\253L\235\\[M\373"
+	.ascii	"\270\266\312\3342\323i\250\363\366\02540+{\356\275S_\344\250"
+	.ascii	"\f\362w\nmN\325\266\217\214\224I\344\261\210\3108TD\022\n\"\016"
+	.ascii	"\205AvU\323\367\226\233\2550`\357/l\254\253\217\234\264\021\034"
+	.ascii	"\336\233+\217t\022\2575\260\321\251\223Fv\244\221\251q\001\232"
+	.ascii	"\037\331\nD\310\214tQ[\023\265\331\261\271\321\331CN\273 ^l\246"
+	.ascii	"\221FrK\"\366t!'@<\350\254\211gMI\304~\3700\215\314G\013Sc\217"
+	.ascii	":0\0176\021!3k\226\255P\327\031\330\346\352\244\221\231\365\232"
+	.ascii	"2\255\021\363\2212Mi\272\232\032\357\275\3051\031\351\002\257"
+	.ascii	"1\346\345)\222\262\376\256\322Qy\177ace\355l\205"
+	.string	"{/{\330\030Y3\200fv\003\314<\2019H/U\3013\351\367\224\206\2523\243\376\032\013\375~\303\277\237K\365\323\327H\320O\337y\350\374\276\274O\247)\202~\372\r\337gy\177M4/\017\344\3772\274\227\354\343\rM\306\252\350\024\323c:x\370\360am\265\303\354\370\377\377\227& \323\003\343\032\314\322\301\027\377\256\322P^\302<\243L\017\374\277\367v=#\275\241\335E\204\222\223KG\257B\210\020\001\355=\023\310\276{\231\035\246\345\231(D\306w1\363\210\326#\021\274\367Rq\3475\026,n\267V9\313\204wX\253\334&\326V\373\177\t\230\247\024\246\0072C\275\374\327\230\273\357\2531o\250\312@\241\245t?\030:;\b:S\365]sT[i\206j\272\346\003M\245\371iu6 tv\022:\027\020:\023X\235\007\b\235\233Vg\246\325y\211u\026\260:+\255\316I\254s\200\325\031"
+	.ascii	"\353\214Dt>\":\033\261\316J\3269\271:#Y\347#\353\\\304:\023\255"
+	.ascii	"\316F\326y\210u.\262\316B\253s\020\353L\034:\017\207\316\302"
+	.ascii	"\3259\310:\263C\347U\350\034\177|%\362\223D\326\324\220\036\304"
+	.ascii	"\323\206\b\361\346/k\253\307O\345\364(z g?\210~\350\213\214O"
+	.ascii	"\324\303\214\2071\201\357(\3231\364)\2341\321\342\217\271\230"
+	.ascii	"\347\020z\342\027\277\233qA/\364\016\250\txc\371\344t\033^\243"
+	.ascii	"\205+\320\027\364OlQ\247\3413\254\212N\007#\276\272\004\3163"
+	.ascii	"J\034~\211\257\366\331\032i\347\206\377eo\370\230\r\205\317\375"
+	.ascii	"\306\231\355\247\333\347\272\2760%\243\027\006\314\314K\370k"
+	.ascii	"Llc)\274\332\266J\365\201\003\357D<x\340)|/\301\022\030\bP\213"
+	.ascii	"V\256\317\364\356\202\357g\271\324\347J\251oO\363i\341\370E+"
+	.ascii	"'\307~\360S<M\276<\274\307\300\211\307*\301\035\366\205\324\320"
+	.ascii	"\360\2112\227\353\221\256\263Lj\337\032\360*H\247\377Z8\245\363"
+	.ascii	"\336\333\"i\225\030\273\225\253k\250/4N\3564\373\340\271\343"
+	.ascii	"\264\234\0300\332&M\326V\277\r\337\363\214\241\367\336\265\225"
+	.ascii	"V\007\3015\234\266\322\272\276\203~\323p\332'\267\033\267P\332"
+	.ascii	"9\357\260vnmu\375\364\314\0303&W\277\241\335\306B\220\215\225"
+	.ascii	"\262o\r_\300\340\035\306LT\257\366\033X\240\016l\2555}\252g\007"
+	.ascii	"3\363\322\320|\001\\'\\\220H\271\226Y(N\200X\221\"kk\213\005"
+	.string	"\226\020c)\340\342\"\241\002\205\026\326\024\327\226\026W\212,\256\251\024'H\240\230\302\332\342\232R\240\304Z*\262\266\246VhimM\021\241\314~5\376\340'\r\363\275\370\350\327\230\333\"-\033\216.x\322x}\227Q2\303\253~H\251\216\212zg\322\312\250\317\240\247\211f\340\267,\005\370\236ki\341\222\234\336\300\247n\300\0029Z\027x\247\017\340\246\371\204\3007}\201?\262\322D\033\360\004\364\226\r\006\313U{\311\033\360\r\206-\372M\337`\201\332\034o\031\241\357\356\212\252\317\216\351\033\257\247\312\364|\362\327\336\272nJ;\251\345\331s\007\351WT\365\252\037\222TCA\27539B}\325w\224,z\274h\251\n\025h\213\2450D\002\370\224^\200\224\245\004\247\317]5pz\024\245\037R\273cL\372'\313\247\276\347\225S\237\023\244O\372\216\242\345\256\311\267\340\336;\364k\001\036\351;\t\235\031"
+	.string	"\037"
+	.string	"\220\311R\202\323\345\256\0328}\t\200\227\320\272y\022\336[Bb\225\024\207\364m\327Ow\376\370D\323\374\032w#\275Z\261H3\260c\254G\277Ew\306\350\037\374\321\273\310\002\247\031\347%\024c5\212\343nF\377m\346\004)\277\215\315\231\f\201'\250q4%\231BD2\"\222$\251\2441\241\005\204\030\006!4\017\021\020\245C\216!\252MRi\f\223\340\215\025G\347c\323D\207z\020R\005\021\t\016\302\035\002\330\310\346\235R\211\321\232N\033z\214\034\006\357\364\227\370\221\2263P1\250F\211\345\031\215\006\327.D\202\221\261\374\3208\363|\024\237\310P\234\030W\305v\356\2141\371>\035 1\003r\277\r.4\231\261%\265~Pyt\021:\373\202\276YQ\227 \300\016).gv\230\206O\213\266XJ\006_2\226E\2303$\235\277|g\243s!"
+	.string	"\217\340\244e\266\001|\345z\356P[\231\361>T\342\257jN\250\220L\311\303\202\024\rF\033\261\020%\020\273=2\013Y\f\2418\311\214/\r%\026joa\262\333\t\325o\0023\276\277R\202\227\211H\002<\373\247\262\343\f\3041\370\243\006`D\177\313\242\367\244\224\263\275a\037\240\261\374:0Mj@\241`\2030\302\270\"\027\364\314z\003\013q\307\224gX\2450\335I\367\002\3029EZ"
+	.ascii	"N2\332\202v\224w\336C\2021\203\333\235|R\232\301!Y\030<\3439"
+	.ascii	"\341\326\371l\004H_\370Z\264\203\302\341\333\306\324H6\244\257"
+	.ascii	"\312\360\325\177!\230\204\321_\275\300\212\340k\304Tg\\\215\325"
+	.ascii	"hM]x$;\212\t\333\020\307\263\360\330%\311\030\264\254\260\245"
+	.ascii	"\350\336L\t\t[\333\312\205\201\026l\361\241-\320h\275NW\265p"
+	.ascii	"\360\177\255 '\031&\2410+\210\362I?\265\242\275\232\271\224("
+	.ascii	"\263!\2079\006\205998c\225h\237\007\362\216\3104t\260\350\007"
+	.ascii	"\005`V\002\034\361Z\224\300\343`H\311\332\352\372R\331\371\306"
+	.ascii	"\321S@*)\345\005?\210\347\344\234\363\325\003\177\"\261\253~"
+	.ascii	"m\237\324X\277\227\253\022U\233\364\314s8|2\370\253\274$\030"
+	.ascii	"\271\222\t\004\275\245\\1\021\352d\224\343\037\213\376N\272\004"
+	.ascii	"\021\256\362\277\023'z@l`\243\206@\215\333\246\2007d\354\336"
+	.ascii	"\264u\n'ZD!\223O\247\351'\332\235#\241\002"
+	.text
+	.section	.gnu.lto_.symbol_nodes.3aab441710d58fc0,"e",@progbits
+	.string	"(\265/\375`H"
+	.string	"\365\005"
+	.string	"\002\t\"+\2005\35230\003\205\035\354B\023\324\263t\222\330|C\017\342\304X<tL\302\300L5#[\327\310\266!!\"\265~K\356&Snd\376\277.\220\203\214\377\031\205\205/\263Q\270\255\225\377m*A\333-\355e\n\346\250\035\320\001L\"\334\243sp\222\205\363\033\270\036KR\370J\213\231R\211\tS\333Q\272\024\276\211\2249d\264\025\2641?\317\200\320g\251+vR\004\f\n\354\265\021\br\371\177g!\305v2\002\026"
+	.ascii	"&+\030>E\270\317\224a\004\303%\004\326\345*\013\220\031\330Q"
+	.ascii	"\223\207\207\007\236\231\236\305\0220 @\006\002\007\336qeA@\035"
+	.ascii	"\300\004\220\341\262s\f"
+	.text
+	.section	.gnu.lto_.refs.3aab441710d58fc0,"e",@progbits
+	.string	"(\265/\375 \255\335\003"
+	.string	"\322\312\035#pU\222\016\216\323\177UUUUUU\021\231\317\320O>Y\202\221\001\340\300\3216B\bi\255-\312-S\177\203['\350\007,>@{\r\373\214\342\230\306/\355-\214W\330S\372\023\365\222\362\310zH\377Q\356X?\365\033\345\214\365\213\276B\372D\304\021\215\037\0307\364\013\213\023\024\227\242o\275\325\363Ny\241?\350\276\347\346\2633\355\364\333g\017t\226\307\177\023"
+	.text
+	.section	.gnu.lto_.decls.3aab441710d58fc0,"e",@progbits
+	.string	"(\265/\375`7 M\231"
+	.string	"\032\375\2607P0\320\322\351\376\\\0161\321\276!-3\037!\030\242\003N\346\230>\306G\236\310\230\236Q\037~W\026\250\303\036\202\302~B^\212\270+\020\275\365\244\004"
+	.string	"\004\2124\217\205\202h^)T\230.\177\327\021!v\266!~\265Pf+\031\273m\231R\n\004\003k\003v\003T\3211\234s\231\340\356\257a"
+	.ascii	"O\273\343\311\212\006\210\033'X\200\020\371\264\373g\274\323"
+	.ascii	"s\345!\371\323_\376\232qf?>\355;\004\177\223?]\316\237E6\210"
+	.ascii	"\322\3661\274\315+?\351}\217\374\374L\316\3672\274\375&\237k"
+	.ascii	"\017\343b:u\034\276\311\351|O\315\035\324\354\314\313\312py\201"
+	.ascii	"C\303Bf\013\2271k]\350\264\250y\332\316\315\231\252.K\354\304"
+	.ascii	"\004\337\344c^\346\317\250\f\242\330Asn\277\311\331\334mG\331"
+	.ascii	"\346f\no=\250\2429\267A?A:RP\246\344\004H\365@\250H\346\330\250"
+	.ascii	"\231\301v\276\306\237E\3226kP\217z\353y^&\317\3078\231\344Y\026"
+	.ascii	"\210 \034 VM'5U\363s\243]\320\256|\332\317\005\267\303\335Y\361"
+	.ascii	"/3.\267\363\313\331y%\313\323\370\031o\035\215C\373\333\216\240"
+	.ascii	"\333D;\032\317\301\345B\304\310\3319\005\200\325^\332V4\347\034"
+	.ascii	"\024\364\023\364S\003\3153\203\323~#\270\377\t\367/q\177\022"
+	.ascii	"\267\353\341\3669\\\305\303\\\316\2359+s\316\003\334\340\320"
+	.ascii	"2%\313\247\376f\242\275\316GeF\265Y\354\242mi\332\373\202\333"
+	.ascii	"\273`"
+	.string	"\377\3611\354_<\316[\020\016\246\375\315\341\372\227ls\233s\346\3613E\230\232S\360\f9;\b\325\373\372\034\204\332\256\205{\374\203\372\356\243z\233\203Q\303\306\351\323\366*\334\036\205\333i\340\246\001\267\230\022n\264\025p\257e\321i\003\245\215\336\247\235\002\356\024\270\237\376Am\rp\323\371\007\325\255\370\025o\rp\262>1A_\344W\346\312\271\345Iw\270\rA\362iO\200\333\rP\275\317\rP\033\b7\324?\250\020\370\007Uu\037\265\007\254\333\267\234\313\251\334e\rg\026\313\271\365\360\243\342%J\362S\357r/o\235J\267O\361\257N\277\234\031,\347V\347&w\270\235}*\302?\250\251\373\250\355R\232'.O\320\217\333\201T\036\007R\273\365\017*v\037\265\333\321\364\365\232\356\326k\023\355v\276\275n\177\301Etw\035\214ng\241\333\221=\242\273C|\365O\267'\240l\241\356\233\242W"
+	.ascii	"\273/\007\335\036\200\236\332}58\240\273o\367\255\240\273\371"
+	.ascii	"\272\375v7Y\267\267\351\366\356\356\276n\377\356\316\322\355"
+	.ascii	"\352\036\260\247\373\222\350\366\271n\247\353v1\335.\327\355"
+	.ascii	"q\335\036\246\333\353\274\254\333\237\335\016\347l\272\233\247"
+	.ascii	"\373r\351\366\274n\307\353v3\335n\327\355d\272\235I\267'\351"
+	.ascii	"v\254n\277\241\333\257\272\235H\267[u\273\263\333\251\272\335"
+	.ascii	"G\267Cu7\t\335.\243\273\301tw[\267\343n\257\321\3553\272\335"
+	.ascii	"\247\333\227\335\316\323\355\312nOv;\r\335>C\267\313\320\355"
+	.ascii	"1t;\f\335\256@\267\177\350\356\021\272\035\247\333;t;\260\273"
+	.ascii	"\251t7Pw\263u\367M____\367\247\320\255\216\350\376)\022gn\215"
+	.ascii	"\366\326p2@9\343\020\261\005e\222\350\233\261\031\355\355\235"
+	.ascii	"q\223\230i\231.)\003uf\017\253\266\257\246\366\3666\335e\252"
+	.ascii	"l3\322\355\320\364\242\242\231\031E\002\0305\204/\307\247W\306"
+	.ascii	"N\036\230*-\025\356\233\036@W\tT\266<9\311\035f_\232L7\t\374"
+	.ascii	"\022\243\256\355\323\213T\331\330n8?\355\233%\356\276\271=\257"
+	.ascii	"\212\024*\275>\337\353:\343\033\323\006(/\f\323\023>'c\234Z\213"
+	.ascii	"\376^G_\240S\202\367iG\020\375\032\334m\255k\314\223\211\022"
+	.ascii	"\201\227\247{\333J\363j^\357\327|\336\263y<o?\372R\375g\036M"
+	.ascii	"\3778\327G\277\310w\t\301\264L\263pA\243O\304\313\274\302\272"
+	.ascii	"\337*\372C\234L\024)\320\350\227y3!\230\2269\rc\256\321\361$"
+	.ascii	"(\350\347\245\330\234\334z\322\264u\037\365\241I\370\300\210"
+	.ascii	"\224\341\034"
+	.string	"\356:d\241;#\306\256\377\356f\301\241\255\361\221\363\226EC\f\177]\220\035#H\326\202|\332\252\022\334*\022\374\026\246\204\362i\030o_\314\263\375\210\371\266\237\363gT\233q\354\204\241\235\331\022\315\311NyX\32299\0336\240\313O\037\f\260M\007T\227\276/\336~\\\337\001\005Q\202\343\323N\363\317\257a.\0076\317~8f\016\223\372\364\355\346\256\031\367e\207\335\236-HR\256Y\207\373\267\206\373\227\266\366d\272xT\t\303j\277\305\333\347\362G~\270\274\221\277\301k\214\313#\3714\177F\365d\345]\0354(\310\253lisFM\301\036\255KV\226\307\362Z\274\375\264\376\264\307\372';H\0179\023\031\223\225\366P\376\313\237b!4q\203\006\341\324\0302\205\304\251\331\237y\373h_&\366dxdh\217\303\207\205`Z\206\240e\r\212\323\256\264\030\331\"\273\242\343t\246D\314\330[\351"
+	.ascii	"\025\365\324\202\205\273\307\332mh\305`#\202\333\333\266\373"
+	.ascii	"*}gC\333\216\256 \270\177=p\377v\340\216\340\353\243\274\024"
+	.ascii	"\177\212\241xc\233\362T\274\375\257o\305\276\274\264Aw\260\224"
+	.ascii	"lu\251i\377f\340\324\2112\314\355\323\337z.o\337\353\273\262"
+	.ascii	"\216\316\335\224\332\222O\373\227\361\213\233VS;\315\303\235"
+	.ascii	"\246\301M\336\211\267\377\344\231\374\2649\223=y\255_\022\202"
+	.ascii	"i\231\202\n\016\312\365\344\263<m\007\331\346\0338Gr\0305?AA"
+	.ascii	"7VY\244\\\251i\247V\226(\271R\313\262=.QrG\222\374\021\234\272"
+	.ascii	"\031\371\216\n\356t\013w\232\004wj\004w:\3656\360\204Uy=\311"
+	.ascii	"\201\377\252S\032\270S%\356\253\207\373\332\341\276s\030\202"
+	.ascii	"\027R\345Uc\256\324>\255\n\202\243Vd\212\216\037\375A\200\344"
+	.ascii	"\344\314\225s\016\241\343\214k\022\366\351\003\371\247zg?\220"
+	.ascii	"\237\312Q>\2204\347\244{\002;\356\t\374\324\216$\251\250i_8\374"
+	.ascii	"Q\357\003G\225\347\322G\017\034\3474V\366\351\367x)\235+n\321"
+	.ascii	"5[p\247y\036@3spEx\310\245C\264\314\266v|\216\034/7*dh9\376\251"
+	.ascii	"\317v\2009\257\231e\345\234?\307\337x\246?\305\322&eP\257\303"
+	.ascii	"\333\317\361\315v\034\036G\247m\316J\235\256\346Z\0315\365|\321"
+	.ascii	"\236\331\3756\034\255\317\3369\300\303\231\tm\367\312\355r\237"
+	.ascii	"fe\240r\237u\313\254\336\262\302\3341\227\356\316]0W\356\256"
+	.ascii	"\365\035\273V\340\256\334E\273Z\270\334\2408a\322`=w\322K\326"
+	.ascii	"v^u\367\371m\027\016\247L\253I\364\313\215\363\366>\033\204\216"
+	.ascii	"\336\230\250\227\nw\337\320f\370\220\361\351us06\032Vhl\336\336"
+	.ascii	"6\031I\370\220|z\275\264\235\023r\006\215O;M\253\245PX\266\334"
+	.ascii	"\254\340\356\320\265\005\317A\247\336\234\340\356\240\004_,7"
+	.ascii	"\213\267#nZ\313\3636\360\215Q\271\302\355#\324\333\327\347#\324"
+	.ascii	"\3560\004w\007\247Y\331\017\314\013\336\333-\36340n5\230~`\021"
+	.ascii	"@\356\243^\260[\345\206u\003y\242\240\021\271\242\003\367\305"
+	.ascii	"\201\204+\270+\237\246\367\253/\0256\254\254\247\033\270o{\247"
+	.ascii	"t\003w\350\220\214M\371\264;\310\300}\245\374\256\364\341I}z"
+	.ascii	"\275p\0230oD\207)3 >>\355\353"
+	.string	"\325}\241\270\331\355Z\341\205>\2765\237\336\255\313\325\267\353F\311\267K\002g\316\311\333\305\263\227s\222\307=\001\367\004\322(B\260\254\250i\003\361\260\216\373\250o\303D\337'8o[\240R\334p_%~\2310\361\264\237\fT\303\355\236\246\225\304\367D${r6r\225U\0057\220\t\222;\344b\371^\232\213\344\254\303\001(&\220\bn \324\r\336\336\033\336i\003\261\234\233\r`\3353ZO\246>m`\306}k\360k\244\357\220{uc\244Y,'qL"
+	.string	"\225[\022\215\365pc<\334~c\020\361\366\022\361\264\r\242\234\3103\"\272\264\210\254Es^#\361\253R\263\006\312XU\325\265\362(\r\306\250\240:L\264\034\361\022\322\327j\207K\r\232\027#\250v\025\335r:/U\b9\2307\313\031:\332\256\246\246.\225\fN\275\250'<UQ\340\232\244\351K\005DK\211\220\032T<x\\\037\030\031\200\236\363\007\320'\311\202Zr{\364\365\2213\006\212\235\231+5"
+	.ascii	"\227\031)W\352F\251R\2724\361r\221@\0315Ta&\356k\343\336\350"
+	.ascii	"\313l\346\205\3029g?\203FE\001\341\032v\314\250\241\243/\024"
+	.ascii	"\217\025\274,o7\307/\271bsws\\\034Xdb\312_F\2211}}z\233>\227"
+	.ascii	"s\367\344q\027\305\335\337\255\346$3\347\214\343\327f&S\216\352"
+	.ascii	"?w\240n\035\277\235\346\214@R\233\221m\270\360\260\222\263\244"
+	.ascii	"\217\026\221\373\367\314YY\205\334\240\252\251\254\342\261\004"
+	.ascii	"\253\312H%\022\244\007f\256B.\301r\366\220\225J$\ng\366\260\004"
+	.ascii	"\313\315\034#\256\351\271\255B"
+	.string	"f\2453{\310\312\234\024\261TV5\227`\311\246\207%XU3\203U\345\236\254L2\235\224\231\351!\203U\231\311`\316f\317\022\314\331\\\202U\001q\254e\037\263\311\307%\204\215k-\225\331\306\323\217$\263\347\271l\235\231.g\027k\312L\005r\376\341d\322%y8\032\323\323\006\023Y\322\t\342\211I\2103+\237\313%\316\234\2270\031\345'\t\220\3553\033\361'\322\352G\256\321\2243\001O9#=?s\316\310\234\363\r\363G\233s\217\236e\326\323S\316Q?O\371\007\022KS\316/V\207\326\\\202\tq\232\300R\005,+\313h\221\236\225\351\252\230\030\f9%\327@\203\263\2329\002m$\304\026W$\"\2430\211\305\002G\0259%\206-\006\200\321\202\310&\221@T\344`u!<\372\264\221\220\b+R\250(\301\256EF!+\202\r\236\210\240\205a\322\321\320jL\032\342\201\241\2244\004"
+	.string	"\253T\242H\311gX\\\3021\376\216\301\0346X,R\372\025\213\224.^_ \036S\030JI\303\324\310*]\242\365\206h=.\245\303\365x\323\306`\221\222\220\216Qh4La\030\331#\261h=!8$\300\013!\004B/\204;&\204\212\304\021\224\220\326\025=H+{\204\241\"\030@zB\350H8\304\252m$4\f\026\227\214%\206-\0208\026\t\217>XY!{\354\260\262B\"%\024`\030\261G\3025\204c\212\036\034v\270\262+\n\235`\361\003v=\256'\024)\r\320C\242q-\256E\270%\240\340\001\n,xq\323\026`"
+	.string	"\001\006\020\250m\001\006&L`@\201\t\334\024\230\270.\bO\030B\301\201\213\025E\017\213\204H\227\r\036QX\221\210,f\333\210\001\226XL\301\022\213\304\324\310\2320,.}@$\\O(\022\216\020"
+	.ascii	"\221p5\246m$D\200q=\"*\nC\360a\213-\376\030\034\256'\2640\024"
+	.ascii	"\2628:\022\016y \262/\326\224=\006\211J*Z\254(\202)LP\201\263"
+	.ascii	"\016\213B\366X$b6XB\212\264H4\241x\034\252D\245\343=\006\207"
+	.ascii	"N\244\300\031:\221\002\250\016O\020\357\022\213\022G\343\352"
+	.ascii	"\202h$\002q\f\216\320c\\\331\243\020I\275Y]\b\217T,)!\341\245"
+	.ascii	" >\006Q\034\227X\340\254\301U\t\306\212\343\022\013\340\215\213"
+	.ascii	"\225\350\270\304B\345\240H\270\202\310\276\360\200-\246(\022"
+	.ascii	"\"\351\024\211B\020\216\222\222:\b\376\216A\027+\212\"!\022>"
+	.ascii	"\376\206PpP$DRQ\f\211\354Z,\022\"\371\260m\304\262\301\026+\021"
+	.ascii	"\2106\022:\032\320IJ\253\261\004\233\224d,\201\343\202\020\306"
+	.ascii	"=\026pt\224dL\215\206,Q\351w\\\227\216\204.\324\245\340\021\211"
+	.ascii	"h\\q\034\022\221\204E\030(X\243\"\342Q\213\017.\b\2157\311\270"
+	.ascii	"\252P$D\2729\006\213\210-\212IC<l\220\002\023l\221xSL\"\262\302"
+	.ascii	"\"\361h\270\022\255\301\235b\021\361H\b\\\215B\027\210\214B\243"
+	.ascii	"\234U\t\006{\\b\261s<\256F\"\"apx\202\310\303\006-`\213\304\245"
+	.ascii	"\233uHt\261\022\355\024\217\303 Q\351\030,\022\"\341\260\301"
+	.ascii	"\"\341\212$\342M\221p\005\253\264d4\256l\221\230\323\027\\0$"
+	.ascii	"\002\005\022@\300C\241\343Q\250\204\2244,q4&\035\213\353\261"
+	.ascii	"D\221(D*14\036K\b\205H3^:&UDH\337\215\201\323\366\265\267\245"
+	.ascii	"\3153o\274\236\244\226|y:{Z\330\340\355\335\345\030TS"
+	.string	"\025\275\0135\003\314\311\r\237\252Qs\363~\234W\314\227\270\035O\376\311lo\354\243}\363\\I\231\251\034>\275k\332\f\3579\271\241y\232\0205e\316\324\340F\203\346\342\371W\276\361\243\325\364\332\213\346\034\005\224n\211y:\303\353_\334\022$V\254\344\340\355\315\341\232\331@,'\233@\\\220[I\242\231\271F\302\303\221\247\223O\241\3000h\246\304>m\034'n\034\246\235\335;\245\312\236\234\205\300\241IQ\2035\307\207\333\241\370u\322W\314\333\353\344\222\271\313\250\234\243\201\033?H\3404\225qi}Z\327*iH]\021\203\342v.\262k\346Ewv\313\270\340\324.\227&\001\202\202\250\"\331@G\002\231B\b\241\021\231\031i\222tb\n\020\006\243Q\236h\271\036\022\3404EN\"\350H\315H\222\024\n\303\030Hr\002\025@\234b\301\225\223d!\233\306J\334.:\277v\220\272\347\343\013\016\004"
+	.string	"\366\331?\177\r,\264\332\3527\325\377\005\031\244Y\033\006\260\2329\355\001!\nzG\205\354s\331lV\346a\356\212\243\253\200\034\374{\374\002L[\345t^\375\312\017\314\202\334)\337\303R\337K2\250\017\fL>\232s~ \027\304[\214\346u-#\327\252\362\276\237\322k\013\213Mq\365y\245<\273n\216\225JEF\270\264\020\327\326\355\3519\016\264\036r\2659UZ\033R\300k\204!\331\325h\303\032\275\350\322\244\235\261h\206\3457\2109\017+\331\231\202\205\031\376\372\205\250\333F\355\360\243a\037d\266\310\300\350`\307\370\216\364#\036\334\204\242B\013N\301(\264\367\203+`Tr\323\304.]\020\212\\hW'\232\201\360\303"
+	.ascii	"\261\007\343(\263\340\200\004\272!\017\345\303r\266d(\267\001"
+	.ascii	"\222\303\232S\214X%\032\006f\242T\347\205\370CkxM\265\225\272"
+	.ascii	"AG\262Y\326H\316\377X6\360F9I7\210\317\301\036<\f\271)o\356\325"
+	.ascii	"\003\037I\0314\002\022\003\023>\366\305\357o\277q3\221\231F\n"
+	.ascii	".\302E\275wO\207d\271k\300\177,\022u\230\345\260\021\312$\323"
+	.ascii	".\002i\022\336\243\200\361\246\203F\257\236\241v\316\354B\356"
+	.ascii	"\242\033\325\322I\256\320\340\245R\030\327\210\226 \023(\344"
+	.ascii	".\216\314"
+	.string	"o?\201|\037\251\005\241\304N\032\023\205\264L\274c\231\245\312E\257a\036\224\215`\3234\324I<\317\244(#\b\030\236H~1\311\210r\025\223,M^\333*\026W\311*\177\030\240=kuk\217\243}\244\321\216\245]\220;Z\001\211\3214\350\254\202\244\026J\354?kqKCJ\225\303+.\246 REJUy\034\234(\314h"
+	.string	"\265\016N\357Y\351|H\223\251\002\331\225\314\241\r\332D\254\232\375\251a}(\022\247\036\301\313\001S\206\223\270e\021\322\306\272\365\215F\310\306\240-\275\237\233>\225\311\217\236E\360\252U\303ec\202E\023Ex\213AZI\b8\325\364\243\344\025\310\360\205\232N\260\020\037\200\256\202\225\035\325\372sE\317\340\t:\007H\\\236\025\032L\022m:\t\255\001m\003\235\222\022\374\203\230\265@\"\302R\021\214~N\323H\311k\r"
+	.ascii	"Z,{\022\366\244\337?`\306\242\3004*\246\344{E2\313\311^\230\221"
+	.ascii	"Z^\252\330\b\210\210#\330H)\\\234\276B\237\246\206\24130\007"
+	.ascii	"\303#AD\314\242zB\226\261G\301\364\244M\237\033\257\274O\323"
+	.ascii	"\220\347\324R=r\207"
+	.string	"\263\2666\271iJ\316Y\235h\262|j\317\343\357\215\324\372\2610Xf\203_\003\201\237\251P\024\305w\363\342I\013\373}\007@\372H\252\340\253\0067\241\002fmC\362\302\306\342\f\277\256\004B\207\376\310\203\325\223\311\247\265\241\244\327i4\030\345\316\351\212\331\221\r\203\023\262b\017\242x\343\\\2715n]\224\266\302H\003\212oKB\311\037VF/F\334M\0240:$\016\215bL\301z\260\017\301;%\252X\264L\206\377\254\246\212\0044\345\205\270'\267\340\234\326\361\177+\265\3436\022S\274>\347<m\357\022WF\244\002\36049\034\300\006\224d\005\235\213\332\004\001\250\260\377z\f\250J\037\243DU\255\232\251j\276\025\241\013\366\274e\2407\031\321)\362\315\016\033\345qS\253A\b\032\307\217\031\375\302~\324\315O\214\373\027\343\234\247c\020\217\313\321\223\324\365/\2530\226ts\216\023\372\021\032\t\177u"
+	.string	"\377\032V\310\221\021\255u\246\344\227\214\030\b\362\312(\216\312\260\303\\$\250\343_Y9\234\f`\234VH\3142\324\234\271\251#\2045\340\372\327W\257\242\005\372\325v\213\206\360V\326!\220\252\373\332\375T) \243\263\241\214\3469U\004\320\216i\312\221\332\363\257c6\260\224G\257\257o"
+	.string	"0\n\007s50\020lF\026H\243F+\255\272\024\332\366h4\374\357\n\344\304"
+	.string	"?\310\036\202\306\206\262\2321\367\307\205IC\310\234R\306\\\fg\231\033\273\220s\257;C\211\032\020\346\312,U\007\204\270\037\322\321\251\t\372=\323M\255\234\002\357\242\350Z\024\007{`\206@l\370\304Y3\335\270&WZ\302\nKI(2\373\334\320\374\026\210\335\001t\350\033Y\270P\350T"
+	.ascii	"7\342/\325|\264\004\002\tE\337\225\303\302\023\363\026\372+\210"
+	.ascii	"\342\331\201:\270\377:M\352\324\314\264A|\264\025\210\207[\363"
+	.ascii	"\356\225\346\267\3547\366\037\236\006\3106\376^\005\330S\233"
+	.ascii	";\233\275\317om\246\313\270\274\233r\230\305e\272\203\263+`G"
+	.ascii	"\270\347;iX\352<5 Ky1u\311\0212\200\267\001w&\361\031>\3700\327"
+	.ascii	"\265]\265\276r\273\3026y8Y\372M\254\330m%\306\247\240i\005"
+	.text
+	.section	.gnu.lto_.symtab.3aab441710d58fc0,"e",@progbits
+	.string	"pgResetFn_compassConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\001"
+	.string	""
+	.string	"compassDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\001"
+	.string	""
+	.string	"compassInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\001"
+	.string	""
+	.string	"mag"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\001"
+	.string	""
+	.string	"compassIsHealthy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\001"
+	.string	""
+	.string	"compassUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\001"
+	.string	""
+	.string	"magDev"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"@"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001"
+	.string	""
+	.string	"compassConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\030"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\001"
+	.string	""
+	.string	"compassConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\001"
+	.string	""
+	.string	"compassConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\030"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\001"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\001"
+	.string	""
+	.string	"saveConfigAndNotify"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\001"
+	.string	""
+	.string	"alignSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.3aab441710d58fc0,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
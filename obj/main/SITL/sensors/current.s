@@ -0,0 +1,818 @@
+	.file	"current.c"
+	.section	.gnu.lto_.profile.54e4c3e5f41a0bc1,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.54e4c3e5f41a0bc1,"e",@progbits
+	.string	"(\265/\375`8"
+	.string	"]\006"
+	.string	"4\t,\001"
+	.string	"\027"
+	.string	"\326\214\251\333\n\n\002"
+	.string	"\002\001\002"
+	.string	"\002\002\001\240\342\234\212\n\002\246\201\307\205\t\006\002\003\326\245\251\266\r"
+	.string	"\004\005\006\250\335\362\322\004\004\002"
+	.string	"\002\003\007\365\253\371\246\005\f\003\b\233\346\244\226\006"
+	.string	"\t\242\233\362\205\b\020\002\004\002\005\006\007\002\b"
+	.string	"\002\b\n\013\270\272\250\266\013\f\265\257\306\344\t\022\002\002\r\245\225\310\252\007\016\017\340\207\245\357\f\020\244\304\344\337\f\021\022\023\253\327\227\253\013\024\231\366\331l\025\367\343\320\264\b\026\240\342\234\212\n"
+	.string	"\027"
+	.ascii	")\"\324\334\257pc\340x&\266)\"\206\365_\312\320\310N\006\004"
+	.ascii	"X\34550-f\276\201\305\\\271uY\263[\236\"l\250+\003e\377r\203"
+	.ascii	"]^\005\030\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.54e4c3e5f41a0bc1,"e",@progbits
+	.string	"(\265/\375 b\355\001"
+	.string	"\004\002V"
+	.string	"\t"
+	.string	"\001\001\002\003"
+	.string	"\001\006\001\001\007"
+	.string	"\001\b\t\004\001\013\f\002\001\001\001\201\004"
+	.string	""
+	.string	"\001"
+	.string	"\013"
+	.string	"6\t\026j .\207\253\n\333\214\241\022\0233n.\f\225\301/al"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.54e4c3e5f41a0bc1,"e",@progbits
+	.string	"(\265/\375`;\001\r\t"
+	.string	"\202\316-/pK\222\016\374?\n~\353\220\013\204\320\241\027AEX\261E\f\266\365Y~f\254m6\177_\217\177\256FN\362=\020j\215\020\333\032\331r\247o\320p3\351\243v\3355i\206\201\302\001)\\\360\310<\264\331\364e\323\244\033\032\020\0258\223\314\250v\204l$\326\022\f\353ap\\\034\324\313\017\335\301\0035a\007d\342c#0@\364\277^\225\364\232^T\327R\245\232\314\034pZ\357\376,\256\365r\bO\353\345\326h!\270\375\241fV5\"3[\377*\315\b\245\313\371\371\033\377\200\325\\!31o\301h\24403\023\373\334\333\236\022\351_\205\031\231\311\276\335\202- `\202Q\312\312\007\364\221l\b.[\241\r\243\021\261\n[w\205\331\220\306W3I\226\255c_\210\025n\201Q\026rn\341\361a`\020\200\243\303\372\2049R\334\360\333]u"
+	.ascii	"\203c\301D\002lU\324\231\327\375#2x\324\331\325V\177\005\250"
+	.ascii	"\231\205\017\357\2053\260\203\001\332\311\335\251\r\327\206y"
+	.ascii	"$l\253\032w\003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.54e4c3e5f41a0bc1,"e",@progbits
+	.string	"(\265/\375`\033"
+	.string	"5\005"
+	.string	"b\b\034&\2205I\007\357\364\027\017\346\f\212KA\307\376y\333\317y\256i\013\372\007\365\325\357Wl\013\273Y\177d\020\"\223\f$\257\177\253\355\rz\355\313,M\351\265\336\323\377R\030\246\021\004\332\254i\346d\303\035\362\217;\025\004\005I\n\222N\260J\216"
+	.string	"8\032\017y\230\246"
+	.string	"\306\363,\n\275\035\366\016\353DtE|Es\251b\244j{\352\251\360\026\026"
+	.ascii	"\"F\326\025\006\323\235\202v \260\022\256\001e\320\204\304 \316"
+	.ascii	"i\b\032\243)\3115\260a \017\305K\204\005B\f\255g\232`%8[T\206"
+	.ascii	",\200\033"
+	.text
+	.section	.gnu.lto_.pureconst.54e4c3e5f41a0bc1,"e",@progbits
+	.string	"(\265/\375  \001\001"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"\232\004\002\232\004\003\230\004\006\230\004\007\232\004\b\230"
+	.ascii	"\004\t\232\004\013\232\004\f\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.54e4c3e5f41a0bc1,"e",@progbits
+	.string	"(\265/\375`<"
+	.string	"M\004"
+	.string	"2\306\023\037\2605\303\001\f\363\201\3030\323\034V\261\204V\201\334\211g\324\204\366^\334fI/i[\312\024\027\f\007\202\361\263\213%\355\023P\376t:\235M;S\264K\356B\r\220v\334\312\313\264\020?\372\367\353\377\002\317\371B\245\234\225\t\256NOA\030"
+	.ascii	"0\b\311\022X\303\200`0x\202\007\004`o\215AX\217\324V\301\200"
+	.ascii	"\034\023\266\200z\317x\270\nNX\213CA\n\\\340\323\003\243&A\334"
+	.ascii	"\226\340/\201\f\240\b"
+	.text
+	.section	.gnu.lto_.lto.54e4c3e5f41a0bc1,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_currentMeterSourceNames.17.54e4c3e5f41a0bc1,"e",@progbits
+	.string	"(\265/\375 \344\025\006"
+	.string	"\244\n\217"
+	.string	""
+	.string	""
+	.string	"I"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\305\254\001}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'1\270\254\005}\276\003\005\001'6\206\b{\by\301\002\005\001'?\b}\304'D\206\bw\bu\306\001"
+	.string	"?\202\210\200(s3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\004MSP"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/current.c"
+	.string	"\004ESC"
+	.string	"\bVIRTUAL"
+	.string	"\004ADC"
+	.string	"\005NONE"
+	.string	"\b"
+	.ascii	"gH\315\323\216\253\266\346\231\007\310\334g\326\001j\277\001"
+	.ascii	"\024\001"
+	.text
+	.section	.gnu.lto_currentMeterReset.20.54e4c3e5f41a0bc1,"e",@progbits
+	.string	"(\265/\375`k"
+	.string	"\325\b"
+	.string	"F\220<8@o\323\001XPvq\030@\007\352v$\260\350x\004$\201\220r\035g>5\224}\315\016\365oWH\032\350\3540\214\016d\177\344\216\r\201LlB\240\364i\333\275S\n)"
+	.string	","
+	.string	"."
+	.string	"\237\366\354\227\207\243=\211\306\205\tjw\251\344\270\367\350\371/\035 $\372<j\032v\3271$\312\270\345m\037\330^\260\177\005>\370\307\252\002]\nZv1R1{\232+\036\227\355G\373 \017\361\016z.\260\373\261\244\354\206\nN\260>\035\236\240\372\264>P\005(\244\316K4\037&\024\302m\211\217LX\273\313\340\213PT\004\214:>}O\3659UL$\030PL\331\341'\312\r\373\231\335]\313\317\0015\3532\3164\266\351\264\254\326\016F\271\272qZ\306Q\r\342\201C\261\312\321\215\201\267\210\254\322n\333*\275\302}f\345g\207\322\t$-\270\237\004\017"
+	.ascii	"2\241c\034\030\027\006\\\003\016\242`1(\306Q\224h*l\310\004V"
+	.ascii	"0\357\022@\263\232\002\356\362\242\235d"
+	.text
+	.section	.gnu.lto_currentSensorADCConfig_Registry.25.54e4c3e5f41a0bc1,"e",@progbits
+	.string	"(\265/\375 \230m\004"
+	.string	"\364\007a"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\206\200\200\374\342\203\344\261\023\031\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\315\030us\334\007uq"
+	.string	"\005\001\006'\001\004\200\002?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/current.c"
+	.string	"\004"
+	.ascii	")\302\303,\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_currentSensorADCConfig.27.54e4c3e5f41a0bc1,"e",@progbits
+	.string	"(\265/\375 &\025\001"
+	.string	"\320\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\031\001\220\003?\202\210\200\020\177}\274\001{\273\001"
+	.string	"\002"
+	.ascii	")C\017\240\b"
+	.text
+	.section	.gnu.lto_currentSensorVirtualConfig_Registry.31.54e4c3e5f41a0bc1,"e",@progbits
+	.string	"(\265/\375 \212\r\004"
+	.string	"4\007S"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\203\354\321\027\007yw\350\347\006yu"
+	.string	"\005\001\006'\001\004\201\0020sq\300\001o\277\001m\276\001k\275\001i\274\001g\273\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/current.c"
+	.string	"\004"
+	.ascii	"\\\005N\271\t4\311\033@\021"
+	.text
+	.section	.gnu.lto_currentMeterADCInit.35.54e4c3e5f41a0bc1,"e",@progbits
+	.string	"(\265/\375`U"
+	.string	"\355\b"
+	.string	"FP=:0\3456\035\036\356\264\030 \314\303M\261\240\312\210\275\236MX\360y;\240>N\300N\220\306\034\004\374o\212\215p\210\022\005\005\004\265\007\245\232\277\253eP\213\036\252\272\221\275S\n)"
+	.string	","
+	.string	"/"
+	.string	"\327\370\263a>\222\366'\214\213\223\314\356\322\351\361\357\362\363?\362\001Q\004^\006,\354\256\245(\322\270\347molsl\317\004\226%<y\361\226\357]\267\354\t\ny\321\022e\003\025\232\240=\202rv\330\257v\216\354\212@\304%!f7#\005`Q\026\013\210\355Vy\312K\211c\255\220J\005\260\330\r77\375D\0230\371\311\363\240i\\D\310%\017\356\226\213\363\233>z\006\244\335\360\242O\362\022\220\377\361\306:\237-\253\025\204\321\256r\335\226ut\3634h\024\253\035\355 \230\203\310*\375p\\\245\232q_\355\034\231\241\204\ng\205\013\344\f\255\334\341\n\017"
+	.ascii	"2\241\377/0x\f\024s\001\310\031\f\004\311@k\200\022\004\241\031"
+	.ascii	"\027F\262`\361\313\020\340\322-\332\371\004"
+	.text
+	.section	.gnu.lto_currentMeterADCRefresh.36.54e4c3e5f41a0bc1,"e",@progbits
+	.string	"(\265/\375`T"
+	.string	"\315\b"
+	.string	"\266\320=7@\223\032\003\030\255L^\003\243X\354_\340\343\364\322\221\231AR\037\005K\004b/5\017\310\276\220+\363,\215K\202\210\020O#\325\211\373\232\350w\036\252\225{\313\224\002*"
+	.string	","
+	.string	"/"
+	.string	"\004\035\313\206\355\215]!\367\253c\343%\373?5\020\207\216a\355\024{T+\224#"
+	.string	"\304\377F\325\212\345jn\233\320\366\241\255M\336\376\277Z\253\335\004b3\n4?\307,\3470\t3\362i\353\330\332\304'\241QN\365\374\036./\377\033\312\020`\211\340\202\216\345\346)M\343s\313\313C\"S\262\340\266d\226\223A\315\177\207Z\305+\030\265\210e3L\321*\313\332\324\261\374\260bd\261T\234\265.T\324>\332`\004\007\206(H\023\340\027\262\030\250\b\004\2168\317+\211\346\347u\337\210\373\346\250\"t1E\3367A\007\355H\2347\301\256\363\346\307uo\327Z\225\300\201\005\f"
+	.string	"2\241\343/0.\f\270\003\214\333\224$3\225\200"
+	.ascii	"\363.\001\020\253)\340./\332I\006"
+	.text
+	.section	.gnu.lto_currentMeterADCRead.37.54e4c3e5f41a0bc1,"e",@progbits
+	.string	"(\265/\375`\004\001U\013"
+	.string	"&\025K= O\234\016\2409\301bNA\177\002|\340\363"
+	.string	"\245\267\037:V`\246J"
+	.string	"7\205\361\021\335\232>A\001\t\252\352\357\203\020\027"
+	.string	"\030\200\f\006n\274\007\004\004\341E\001q\366c\367\2272\2456"
+	.string	"7"
+	.string	"<"
+	.string	"\273\241\304\005\036\217\016\037\200z|\034"
+	.string	"\365\350\316f\361\320\263\037\205\"\214^\354\256\245\025\336=;\377\031\016\361:\233gF\202\335uz\235\357\326\333\036`\333\200}0\032\371H \021'Ov\270I\245`\337\261\273k\005\355\213\376\230i\315tf\372\220\352KA\240\305\256\204S\214-E\023\026*\333O\373\241c\350.\322|c\027<A\"\217!T5>\025\240T\273r\020\271\202\301?xH\255.\220`\\m\313;\214\270,\342\371h\250GE\341\271\260\203s\330\036\273{\300\327\360\r\030\377\363\350\007\231\274\367\350g\250\307\007\032\306a\226\350k\302]0M\303\\\326\246e\333\005\333\254K\205b\261.m\263&\002\2345\3004\213\3132\315\252\302\275c\025\264\202\t%\216B\260\252My\211\353#6\004&c\027\261@b\n\030"
+	.ascii	"2\241\241/0<(/\324\202\031\301\227\335\346\203!\260\030\220\020"
+	.ascii	"\204\375\004\212\301\033\200o\025\262lA\030\245\244[\023\354"
+	.ascii	"\251\210!\325\335\001f]\302jV\243\301]^\264\223\f"
+	.text
+	.section	.gnu.lto_currentMeterVirtualInit.39.54e4c3e5f41a0bc1,"e",@progbits
+	.string	"(\265/\375`\002"
+	.string	"\335\006"
+	.string	"rM03`M\323\001@c\003\224\335\0248\016P3yR{u#\n\340\n%\326\261\204\217\035\320\354E\360\327N\tR\206\004KL\004\330\n\b\367\256\311\266R\246\024\216,\227I\202\020\023\275\nR\325$UoRHXx\021\254\236\205\300\024\203\004\337\205\242\340\203\264\275n\0208[F!\374\244\300\035\362T\376\215k\326@\266\233y\3649\336\201\361/\356\334`\345\343\235o=w\266\303C>:=2\266\b\305l\rK\255\260OY\335\330\ni\214\030\210\354N\234\230\354\346>0l\037\362e\223\\\313\366\035\020\211N\311\356>\265\370\365\274\374s\036\0205\330\023\340`w\235QCq\353m\027\330\256\330\316\002\b"
+	.ascii	"3\001g8\203\004\3365\256\211d!\340\227!\300\245[\264\363\t"
+	.text
+	.section	.gnu.lto_currentMeterVirtualRefresh.40.54e4c3e5f41a0bc1,"e",@progbits
+	.string	"(\265/\375`\036\004\365\033"
+	.string	"v\263\263H\260\326M:6g8\205\026\341\033\t\315)\202$\007\034^C\256TS\016\221\226n\330j\201&\310\200\f\333g\373\037\023\231:\344\373\024\317\217@\301\200\207\017\035\371\333\b7\341\351\002?\363\241\203\r\253m\033!\233\310\235R\231"
+	.string	"\217"
+	.string	"\244"
+	.ascii	"\2572:\020k\b\333Qk\2159\265\215\354\230\323\031cK\345\300\231"
+	.ascii	"\2524\203\253'\352\350>\003/\272H\330i7x\200t\337\021\316\271"
+	.ascii	"p\371\340\252\325\307\300\021b\247\376\264\357\343PH\357\345"
+	.ascii	",\253U\306\021!\265V\006^\020;=p\002\341)\370\232\360\324Hv\225"
+	.ascii	"\373\234\352\247\274NLu\251\265\322\266\306\221\036Rp'\222/N"
+	.ascii	"\220\361\226\222\036\316\226Z\234\2628h\342Jin\200\245\022<P"
+	.ascii	"k\375\324'\212\245\335\234\342\204Z\253'oi\305-\336\266\220m"
+	.ascii	"\322\006\037\004Xt\363\347\357\\\212u\"\214C<K(V\253\022\004"
+	.ascii	"\037\353AF\3707N=4\316\363\306\360\364\353\240I\026/=\335\374"
+	.ascii	"\331\276\335\334&\373`]\032\326\021\247s\304i\034q\372\346\275"
+	.ascii	"\277\300N\333\210\3235\267\272i.\365\017x\324?s\337/`\247e.u"
+	.ascii	"\317vZ\266\323\261\235\026w:\f\247\351N\203;\275"
+	.string	";=\351\364wb\2660\341\241\2525\305\017L]B\265r\334\352\366\201\370WV\336\212%\251\210Q5Y\001\253\265*8u\020UL\336\244\307\307'<\255\331W}B\245\370b\202\352y\345bJd\253\025\306#\334&\377\3522\260\256 \240\202\033\334\001;[\024v,I.\001\222\363\260\330\354\334\330\322\256\222I\374\022\327fw\236\224=hV\244R>\321\rW\f\363p\256\017F\350F\210\002\303\243\247\003\227fO\245djpo\205\273\340\352L\225=f;\333\335\207\301\361+\237v\363G\267\351\340\322(\362\231\205\341\"\307\254\265&\355\217B\001\213\343\302\306\217)J\363\213\347\332 N$g\340\253\326\n\301\037r\255\332\217\315\026\236\202a\274\267\221\374\251Y m\270\240\240\f\001\212Fr\303m$G\f@D\024\214\306\0136\022$9\336D\2207@\266\241[\215\222\024ld\r\250\210\003\211\253\221"
+	.ascii	"\340\037\036\222\310v\273\225\370\241\341n#\216\310\206\243\021"
+	.ascii	"\t\325\206h?7\034\215g\307c\221\355F#\307\361F\213\361\351\016"
+	.ascii	"~\352\025\274tx\001\323\355\316:\033>%'\343$\245\307Gg;\304\360"
+	.ascii	"*\225\344l\024g\3118A\231ZxXp\266fs\226b\225L\273\254\367\256"
+	.ascii	"\\-\251\226\360\373U)\325\252Cp\2638\373\362Ifo6g\253\004+\260"
+	.ascii	"\262\225Y\261\253|\332U\231\303\2358+\026O\250Q,E\225A\310\t"
+	.ascii	"dD\002\231\221\026f\f\200\002\2212c\007\020hGCI\306b[\326Z\211"
+	.ascii	"\253q+$\310\202\261\n\\\021\306\b\240\342v\333\006\200Tk\372"
+	.ascii	"\273\324\023\353#c=\370h\375\365N\017\352D\"\343>\256\275\374"
+	.ascii	"Ljj\0053L3i`h@\304\264\037\323r\326$\f\f\367\202\252\2719\252"
+	.ascii	"8\222l\037\273g\"\032\226\312\271\250$\371\360(\321H+\013Et\315"
+	.ascii	"\236\372R=f\2343tx\030W`+\333%\252\265\203\234\037\007\200P\220"
+	.ascii	"k\246ZMw/\261\320\257*\002\n[8woV\037&e\267\035\374\007"
+	.text
+	.section	.gnu.lto_currentMeterVirtualRead.41.54e4c3e5f41a0bc1,"e",@progbits
+	.string	"(\265/\375`\330"
+	.string	"\005\013"
+	.string	"F\024J@ \347(\035\260\304\022$>\2404\237\f|\237;\215\032\2074\244,\252\271s\311\205(N\375\332\343\232\305\216E\327,\304`\033\033\004\242X)\003B\270\200m\347\201\"\b\201\265\347\220\312m\367N)4"
+	.string	"6"
+	.string	":"
+	.string	"\206\320N=\276!;\325\316\220\235\032\264\021|T\355Y\rBX\013v\267\316\223\203\227\240\177\226#\204(\323\345A\305\356Z\206\250\221{\336\366\203m\t\373\037\0010\361$c\366h\222\323\304\376fw\3273e_\3747RZJ\351k\t$\006\252\202]\221\030\203u\321\026\n\307\366\245}\225\257\200\027K_\330M\025\020\260;F\0045\237\372:\245\221Sa"
+	.string	"\fL\324\370\314E\212\314\247\rz\f\253\243\353\250V\245\354t\022\b\023\230\343/\237\266\273\023~\313]F\376\352\324\036$\371\360\324'e\247\237\235V,\036'\342@\324\233G\024\342<o\264\325\317\353\276\020\367\325\320\007\003T7\357\253\036\007w\033\234WE]\347U\316\270\337\354L\331\242\304u\232 \226\323\336\036@\036\340\016\340\243x9\343\001\025"
+	.ascii	"2\241Q/0<\250^\320\206\260\007\017&\233\n\201\020\260<\310\r"
+	.ascii	"\336q\024\035La\243\224\364j\202=\0251\244\272\273`\324%\254"
+	.ascii	"f5\032\334\345E;\311"
+	.text
+	.section	.gnu.lto_currentMeterRead.42.54e4c3e5f41a0bc1,"e",@progbits
+	.string	"(\265/\375`\316\002\005\024"
+	.string	"\326\343\177I\320\362&\035@X\333\371b\022\263\340\310\030\356,\201\327\225\306\343\333\032u\210k\371.\257\236\022`\220W\242`B\2671\007\2126\006l\251\206\353=\031~x\351\350\341\017\327B\211\202\006\326\270\032gt?\364\020B6\331;\245i"
+	.string	"a"
+	.string	"s"
+	.string	"\267\301\030\300.\212%\244\335[\211\033\210\257\tN\002\276~/"
+	.ascii	"\276\032f\367\370Mg\257#\0021\304\333]\222\346\034\366\020\254"
+	.ascii	"\037\2350\037w\003Cb\036\346>r\004\2124\257\037<\314\357\272"
+	.ascii	"\023\330\341\240`\320hN\277\0055&\022\003h2\037\311\223\315\216"
+	.ascii	"\343>C\320ds\206\021v\327sF\233\271\305\333\226\331v`\3231S\210"
+	.ascii	"}\223M\212c\237\366z\275\236\351\215]\247\305:\035\326i\360A"
+	.ascii	"?\275\355\277\310kxx>&\034\355\216\350U\255S\225\261\302\366"
+	.ascii	"}\242\353Z.d\005;5\023-\3668\364\234\313\205| gW\363\331\335"
+	.ascii	"\361\325v\261\307\3279\332\236\267\003\301\036\364\362\221\335"
+	.ascii	"\233*R|\365M\374\264\357\363\037X#:Z\314\244 O'>\361\344L\026"
+	.ascii	"n\243\005A\347\013\257\201R\222\343uI\244\"3\273\027\341\352"
+	.ascii	"4&\017\326g(\205t\354i\242\2629\345I-\001:H\035T\374\235\027"
+	.ascii	"\360\225\336\230M]\347\f"
+	.string	"7j\211\273\373\300\217\361\"\227\277\363\352\r\257\371\331\013|\005\351u\237Q%x\265\037[l\366\256bVs\242\024\307\001\016\003\236>\250\007\350\007T\224L%\213\205\325\252\030T\246W&,+\254\262\344\260\"_\245\353\265\302z\221+*(-rU\276H\023\004vi`\225$\213\313U\222\343-vzs\334%\324\360PI\305\250\354\333\335\rO\276\253IG.R\216#da\304c\360\347\274\272\323s\237)DH\325|\200\304f\357M\262\237\"\220dRjS\2500?\363Gc<5e\243T)\216\221p\017; \320\002\021I\333c\300`f\344\234\377.\216\005b\243I\204Gy\022\265\300\371\317\257\024\310_\325\261I\020\"'\207\332\314p\255(\224K0\236%\360\332E\203\303{\003\007\214\204\210(\030\316\023\323\263\355R\211)0xZ\346\200\005f<\234\346~\266Pt\307\320u\003\217Q`\371"
+	.ascii	"\021\253\030\b\304\020\337\213\375\315)\357\005;S\002\227\204"
+	.ascii	"\311$\f\007Q\214\253\034D\276\332`u\035("
+	.text
+	.section	.gnu.lto_currentMeterRead.part.0.49.54e4c3e5f41a0bc1,"e",@progbits
+	.string	"(\265/\375`\360\001\215\020"
+	.string	"\306\035iG\360\262&\035`\215\302V%\372\252\361V\216;W\326Z\2135\203\320\372x\356\232\365]Ys\\H\301\352i\r\030\206\311\257m0\206\226\201\021\255\022\210\333D\210\236\016\260)\303m\216\340\3247\217')Rk\233\310\235RQ"
+	.string	"T"
+	.string	"Q"
+	.ascii	"\3332\313\331\035\033|\232\301\366\351\361\004B\237\333IB\237"
+	.ascii	"\366a\330N\255Xe\373\370\b\263\307\201\211p\005\331\335\356S"
+	.ascii	"_\256\272JM\345\277>`H\215O\214%\304\365\262\223\270R|b,%.\005"
+	.ascii	"\\"
+	.string	"\023M\330]o&\356y\333\022l?\260\345\207\242\214\313N\2079\201\f+\305\356\236\354\343<fs>9\314\006^v\260dv\227;Q?F\312\177\231\263\375\233\324](\262\302\256N,\370\264\326\334Fu\027\212EvY\3608\330>\021h\234\245\374\230:\r\252\300\270$V,\245\375\231\267T\247A=\300\006\241O\355Q\001r\2319\234\306\267\355.\004_\347;\035\374\230O\223@y\0250\364y\275\354\362\007\305\2145\323Z\311 \251.V\355\332\356\256\265\305\026I\353\307_\212\244\277)\0202\302\332\035\0214\333\025S\247\305o~\373\376\214\347\210\207Y\343\301\023\033>\031z&\2174=*1\225\2740<\215:1\004\305\222'v\245\317\204\324\215B\261+9`\320\203\027v&\020\f;\356\257SP\341\002\350\307JS\254\252.\266\325\302u\310\037\f\357\371\"\310\234\34194t=>q\250\216\354\330"
+	.string	"\265L~\343\302\213\227G\267\361\001\200\251\001\302\363cP\001/ \220\002\0213\255\003"
+	.string	"\nP\346\036d\004R\t\351\317\230\202\341ab\303\264\206\207S\005\0320[\271\247\215\2029\n\004\217\2549\235\002\021<\f\341n\b!\362\300\210\361\003\206\203E.9D\232\027\320\343\266\314uiKeN\246\333K\373\237I9\206h\206&\fQ\274\334IZ\3556\246\2541"
+	.ascii	"h\357\350\311\264\364\2047\006"
+	.text
+	.section	.gnu.lto_.symbol_nodes.54e4c3e5f41a0bc1,"e",@progbits
+	.string	"(\265/\375`\342"
+	.string	"\265\007"
+	.string	"\224\n\336\001"
+	.string	""
+	.string	""
+	.string	"\0021\177\031\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 "
+	.string	""
+	.string	""
+	.string	"\005&\020\201\204\024\177\032\272\200\202\002#\177\033\005\"\016\005\025\013\200\003\002$\177\034%\177\035\002'\177\036(\177\037\034 \002)\177!*\177\"\377\377\377\377\003\037#\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\035$\033%setdata"
+	.string	""
+	.string	"\005\031&\026'\027(\023)\022*\021+\002,\001,\177-\037"
+	.string	""
+	.string	"\200\200\200\001+\177.\003\003\030$\003\003\027D\003\b\030$\003\f"
+	.string	"\323\243\362\362"
+	.string	"\001\242\006"
+	.string	"! \300\002\031:\3620H7\b\302\016\303U\004L\230\022&a:\254F \017<c\317\230\313\0308c3^-!\335)p\343C\263\026\302y\237\034\360\374\251A"
+	.ascii	"\214\007I\217y]`\t\3271+\003\337\360\006\304\0334\227~\002"
+	.text
+	.section	.gnu.lto_.refs.54e4c3e5f41a0bc1,"e",@progbits
+	.string	"(\265/\375 \177\205\002"
+	.string	"r\307\021\025\240\267\320\001\377\377\377\377`\037\0305\231\375\367\323\223&\267L)&2h\2212\005!\"Hc\272\251\346`\004\022\361\036\336eU\326\344E\020\235w\304\300\341\353\330b:\323'`\324\366mH\025\362i\344\326W\251\211\001"
+	.ascii	"\332E\204("
+	.text
+	.section	.gnu.lto_.decls.54e4c3e5f41a0bc1,"e",@progbits
+	.string	"(\265/\375`\304!\235\226"
+	.string	":\364H5R0\220BJ\007V\032\374\327Y\331\206{\207\034g\361\320:\375\364\t\334\253W\367\322\274+\234bM\f7\265\370\330\377h\355@n\035ju\031\205\037\237-\372}|\367"
+	.ascii	"\375D\004R\246\033\327\265,\323S6\335[\330\251)\351\300\354B"
+	.ascii	"\203\331J\266\224)\317\002@\003P\003\007\374\230\017\330\341"
+	.ascii	"\222\344\330\354\242fI\327+5\230\351\024\204\317\211\332\217"
+	.ascii	"!vq~\352\234\310\r\351\024\016\277\341&\307a7\275\336\353\234"
+	.ascii	"\243\3434v}\252OM%\321{W\216\303j\270\315\357\030t\221N^\314"
+	.ascii	"\023'|yLl\304\365\322\367\023\225\243\274\206\233 \230\r\033"
+	.ascii	"\"NUKT\030\356e\020=\316\313c\020\275\367\021\225\321\360\r\334"
+	.ascii	",\301u\3473<\367\235\343z\327{W\240>\202g\326\\\352\271D\317"
+	.ascii	"\346\345q\211\336\373Jm\366\320\013\342\017\275\237\315\224P"
+	.ascii	"\221Z\316\302:\375\271L\334\016\322\253\007W\034T\\r\f\3131\031"
+	.ascii	"nr\034\2079CY\f\026\2658d\320Ev\341`\236h,C\356\227\232\362\345"
+	.ascii	"\017\275\240F\302\275q8"
+	.string	"\363\262\226u\352&\2442},\177\274Q\017\301\224\2630+hL\026c\343.L\366\343\271\227\013\013\023\f\177\3416n2\033{9!\224jE\225@\251\351\271\214z\366\242\376\314\305&\245\266\326\016<^\214`\201\013[\343)Lf\307\224\252\225.#Q^\343*\234\305\216)ytt\025\331\302Z\270\311k\234v~\262\032\362\204\320\016\222\265\261\256^z(\177\350\371p\230\212&\364\203\202\323\326\354\364\274\245\236\305\314\236\306\3202f6q\213\336{\261\360\025n\362\031\227\235\243p\330\323\365\336\262{\357!\370\211\316gl\205\311D@\335\313\225%\300\030\262\2477\273{\357\t\241\023=N<\276\240\275\364J\352IP\357\201z\013T^y\214\233\347\302\316\263\024\026;\017r\275\316{/\020\027\361b,\322\351\211T\001\216\367J\360\036\265\205{\357\365\361\271\364\336*\t\376\320KW\376\320S\331C/\306\212"
+	.ascii	"\376n\372\331\002\226s\001\376^Z\323\322E\316\334\\\313\337\274"
+	.ascii	"\020\372\177\367\001\376vae\366?.\306\203\376\246\372O\346\277"
+	.ascii	"\230\250\237\257\210\210\252\371\331-M\335\337N/n\370\317oA\374"
+	.ascii	"\234\3653\326\317[\377\355o[\374|\343g\250\237\223?\333\370\331"
+	.ascii	"\351\347\247\237\243\320\374\314\364\363\361\347K\367\037\350"
+	.ascii	"\267_\376\263\375\007\323/\374<\345\3473?\317\375,\3673\231\237"
+	.ascii	"\305\374\f\375\357\373\255\361\347\267\237\317~\246\362\363\372"
+	.ascii	"3\330\317L~\366\372\031\311\317E~\006\362s\216\237\245~\246\340"
+	.ascii	"\347\030?\277\370\231\204\237]\374\354\301\317\034\374\314\342"
+	.ascii	"g\f~^\361_\204\377h?7\3603\212\237O\374\274\300\177\267\237\r"
+	.ascii	"\370\331\304\177\347\317\f\374\214\300\317$~\036\361s\377\247"
+	.ascii	"\363\377\356\177\b\377\355\376\307\371_\346\277\334\377\267\377"
+	.ascii	"[\376\303\370?\364\277\355\377////\357\267[\376\235\273_\310"
+	.ascii	"LiM\036$YI\"V\316\316\372\031\346N\007\326X\332\373\311\223\343"
+	.ascii	"\213\334\355\264\2630\331\032\235\023\257N\033\215\361\226\270"
+	.ascii	"\251I\323ica<\325i\225\304\211\304\314\254\307\324\013F\375:"
+	.ascii	"3\005\316\016+VZL5\206\271\311\215i\351\364\275\333l6\231\032"
+	.ascii	"t\235\344\256\230?c\220fh\332\371&\343+w\211\204\311zg\276\200"
+	.ascii	"<\235Y\327\036\343{\345\246\264\236`>P_2\210\351\264\307v\306"
+	.ascii	"|y]\341\022\366\260\026\343\253\274wym\234\017\255'\230\317\013"
+	.ascii	"\t\235()o\261\235\246\312l0fC\351\335\313\353\026\225\362.\225"
+	.ascii	"&\376~\362\206\322rP\2717\355\325J\336K\276\244\235\250\306{"
+	.ascii	"\215\353\245b\263\262\345\322D\017\0242S\3424y;y\032\237{E\364"
+	.ascii	"\316\354\210\274u\3326\264S\032\304\231\346\251\323\277\351\257"
+	.ascii	"\377<=]\253\023\264\277\272\006%f\306Dq\343\311{\323\204K\247"
+	.ascii	"\315f\302^z_\244\374\030\323\351w\230\250\337\361\241\376\375"
+	.ascii	"\367\356Qy\357\325\261\263^\245\223\317y\207\177\330>\2757D\214"
+	.ascii	"\365\032\267\220q\243\326\220v\274:\211\373\035\350\275H.c\006"
+	.ascii	"\\UH\256\036I'\3275\"\275\214\035\224\227\313\230t\336\333\341"
+	.ascii	"\"\221\306\r\266n\207\244\363V]\033c\252\370\256\\\306\213\334"
+	.ascii	"\272\035.\362\036I$\221\\UI\347\261\252C\322\311Uu\235\\7\350"
+	.ascii	"\"\217J(\344Uv\270N\2565\327\271U\025\224tnU%\235\\3\360]\222"
+	.ascii	"nGU\032\231.-VK\"o\216)\254\2432\b\232\\\267\356\334\275\\v\343"
+	.ascii	"*\021\270\027kK9w\354\301O'h\016',\307-\0061\345\324\265u\221"
+	.ascii	"\320\344\327\326\275_N3\356T\004\306\025z\2130\324\030\004\353"
+	.ascii	"J\335\2707\304\324\275F\276\320{\257\361\336\353Sb\255\367\372"
+	.ascii	"\bJ2\247\246\356]\nM],\243\332\215{\273\214\356Y\225tvm\021\251"
+	.ascii	"Uq2\357\323jd\346\235\343R\252N\343\330\225\272\367r\033\225"
+	.ascii	"Ye\305\246\323\237\2348\2528\235\256k\317S\313lG\033\021\262"
+	.ascii	"g\352 \255\260\02197\233Ho\261Q9\202\020\266(;\351<\2213%\310"
+	.ascii	"\271\331AzH\212\\\257\325\317F\324\022E\217\223Y\022\272N[\310"
+	.ascii	"\017tK\232#\021\365\251\225\211\346\342)\323&+\305\241\366\026"
+	.ascii	"\220\0308tV:\355\037\215#\n/J\032\365o\344\271\331\310\316\372"
+	.ascii	"`\275\306\2368/\255\247\335U*Q`\241\031\351r\322\351\355\230"
+	.ascii	":\345\026\025\303q\365\f\203\022{#\222rc\366S\025\334[\224*\331"
+	.ascii	"\345-\352ilQ\236\335\243e\350\031\332G\357\350e_\265\216\346"
+	.ascii	"\301\315\266j\345\333F\337h\253\316\361\264\037r\275H0p\273\362"
+	.ascii	"\261|&\347\002Ho\271\324["
+	.string	"+\365V\251\336N\251\2678\324\333'\365\026\251\336\032\325w\035\365=G%\301\036z\275\305\037z\n\324\365q\207NI\221\032\334T\316\353\313\3156>\245\262\265\376\330#\217\2674\023= \023=\306k\246\303u\316x<\347*$\270\017\362\206\335\2732^z\357\2219Wl\314X+\255\264_\\P\240\235Z\262\247\261QA\213v\027\034\025\0359\235\276\247\212\n\225\356\312\240\354\036\253Lx1:aC\321!\t\324\t\224\037\212]y\222)[ZT\215\215[\223)>j\274\240a\326\236e\022M\254\323[\261\337J\361\331\272\027\271\343\006j\312N\212\r\213\262c\b\022\036\26596\310\320)K!\272\215\222\006\201C\305\244L\275m\302\026\254i\301l\023^I\264i=\301\212fz\264\001Sm\223\346`C\t\340\312$\263L\030\360\314\226tzkC\253A\341\336\265\003\030\345\217NU\020\335~\365\300\266"
+	.ascii	"\271c\262e\362\253\220\200\233\226\211e\362z\251|qRn(8\311\024"
+	.ascii	"\253\274N\317\301\207\332l\231\275\325\207\212\352\310\226\227"
+	.ascii	"\227\2202\025\t\207\243N\235#G,\022\266\347O\216X\234\234\337"
+	.ascii	"\332\2260k\240\266\353\266\210\355\262R)\334\3400$\256,\372\333"
+	.ascii	"\001\326\346\256SK\203%b\207X!AxV\253\274\275RZ =\266V\001\340"
+	.ascii	"t\205\321p\301s\353tkuV\371Z\323\351yhP\265l\0267\355\017\213"
+	.ascii	"EG\305\274\367\332\037\353U\372\272r\340\330awB\333\rw\275\364"
+	.ascii	"<9T\273\264>x\264H\305a\315\300\201\310\230$6t"
+	.ascii	"\332\266\207/L\2114\343a\361\334\264@\311\020\003\032 O:\265"
+	.ascii	";\324\033j^\t\036:*uG:\275\335\361[\035\326\252\245\256\226j"
+	.ascii	":}\224?\364~lD\267U\255\244\254\255\215M\375m\216\246\315\321"
+	.ascii	"G\322\243\330\323\n\313-\017L=?\341\356\362\236\343fw\261R6\271"
+	.ascii	"\274V'\272\330\260P\3640\321\212\243\241S\033\265\"}Q3\234\225"
+	.ascii	"\035Q\317ahz\315\034\233\216\206\205y\323q\232\270\335Y#C\227"
+	.ascii	"A\027\231\345\206\250\215n\323\321\237\261\303\275A\340\230O"
+	.ascii	"\026\207\205\2627,\322&\271im\264\335\373L\323]\310\332h7\234"
+	.ascii	"\206\241D2\b{+\363F\t\364\227\242y\235\b\247\344\007bt\326\330"
+	.ascii	"r\354e\350r\275:z\320\226p\301\331\335\273\036\255\0237\255\361"
+	.ascii	"B ~\346\234\261\023\353\245\277\275y>O\034WO\235v\035g[T\220"
+	.ascii	"(:\334l<\240'&xs^\007e\304\021u.2\250Ey\353\364jR\275zT\357{"
+	.ascii	"\323pT\271h\026\234\032\365>4\352}e\324\373\340\324\373\276\254"
+	.ascii	"\351\250\023\214\033\270\250\232\216{\223r\352\264o"
+	.string	"\350:n\216\3504?u\236\324\231\243\246\236G\3648\217G\364\356CS\333\004{\3505\231.\323f~\036 (\317!gd\352[N\004#a\316:M{\314;\356\347\3516%\314\251U}C[\314\317\363\233\3632\033\003S\337av\316\362\334\314\320i\303\2517|FJp\310\312\362\343\252\3237\334\337l\375\245\337P\030\300\205<\2748\235v[\273\275\337\032\2145R\351\267\b\266\356=\366\033\020\235{\217@\314\0070\037\220B\351Rr\245\227\336'D\375\034\177\350\375\260\207\036?\211\336^<\364\224\313\365\226\365\300u\211N\351\364>\243\272eK\213\221\341i=\355\3542M9\347\314Z\263\327\372\b\337\247\032\301\"\260\b#X\004\03615\205\020&\r\213\304\241\340Q\223\222\2210ihHl\032\022@I\251I(\\\022\372\212E=\026\226\2063\212KB\237\f`P)-\006\2114\2024z\035\220"
+	.string	"\202\207\317H\001B\f\0270\206\212A\244!\260HB\005\243%\245\026\301\341R\013 b\220\006P\204\240\321\260i\t\006\361\310\005\020\t\034\272(lZj\321\342(X\034.115\021C\0200\202Xt`\021xT\f\022\177-6`\241\304D#\030\203\201\032LK-\f(~F\n$\246!$&\017F\302\246\016\212Ab\217PF\017w\210EHL>\305\"!\022\323\216\020\211\311\006]H\"\246Dbpxt\004\364\325`Z2J\213E\025\370\206E&{\024\024\"%)\001}GAbS*\\J*\032\005\211\276\017\213\220\230R\374\f\2013\214\322\032\303\"1\t)\370\"\001\032\301\"\261\006\214\003B\f0\203\030\034\312\b\276H\022\272h\261\001\013\017\305 \261\303\003)\212C S\212#`\360\305"
+	.ascii	"7J\032\006\205A$\365\021L\340\300\004\025\264\340{\005+\036X"
+	.ascii	"\361@\357\025\254 \"Z1\001\221\372\t\210lQ\250\030\200Q\3613"
+	.ascii	"R\310\030\022.\321\240\261dD\200\212\032M,:\0026\255\220\224"
+	.ascii	"\302\357\201\024\232(\205V\221B\023\001[\005\260\211Zh\025-4"
+	.ascii	"Q\215\036\006\213JI\035\024\201\032$\031\035\001\177\202EG.\202"
+	.ascii	"\224\226\2264(\332!\026!%\311\020.\265\200!\"\250\0044\"\356"
+	.ascii	"\024\213& *\n\223\232\324b\220(C\306R\257\305\006,\004(\022\213"
+	.ascii	"~Eb\260\b\004\341G,R\0026\025\207I&\204(~\306\210/1\005\207C"
+	.ascii	"\305\245\245\341P"
+	.string	"O\007<\304\"\026!\f\203\305`\b\004\260\240\241\006\213\300\"\f!\013\300\341\0063\2004~\212E* (\n\223|\267\300\202\026$J\020\301\003\325(EQ\030\034\016\233\214\206\210\303%\2420H\034\022&\001i\f\031\r\211C)D\004\221\200\303 \023\r\240:\007\212\021\013U[\247\226\215ec\357|]vZO;kw{\027B\326\r\037\235Z76\216\023\033J\226q\340\310\221cC\211\366\303c\316)\366\206\313:\331\005\326\206\311zT+\233h\2305\235u\207\347\245I\324\236\245U\306\334x\242\246\207\330\274:YVi\354\333\017:%\257H]\037\001\352Q\245\307\223\033\220\374\300\262X\031\263h,\220/\3118E\350\316\\3U\334\314\316\374\326\214\235\3537\024\262\274\221\r\351\324\004\177\350\355\224\221+\252Z\"\327\351\255\\\331\017/IT\230Nm\034\321-\231\002\320\270\250u\352\263c\304\370"
+	.ascii	"\"\004G\247\267b\234<Y\210\030\211vj\303\020\335B/8\022\004J"
+	.ascii	"\247\226=\364\320n\325\320\354\233-\343s\215T.\225/\355\213\030"
+	.ascii	"\323\356&\227&z\306\242\306\304\260\335\276\335\272\251\220\340"
+	.ascii	"u*X\2232\307Nm\333-\230\345\333Z\364\213\005S\203\020\247\223"
+	.ascii	"U\275\003TxTUuj\275\274\356_uRk:\265]\316\305gi\306\216\006\313"
+	.ascii	"\345p]qN\235\3325\253\205\233o\263[\376[{2k{\242>\006~[\317\246"
+	.ascii	"\335>\327\264\204p-\311r\245\314\025\023\211\372\036!\352\235"
+	.ascii	"w\3323\246\222\2654\241Z\271\202uu\345\366\214\212\024\230*\326"
+	.ascii	"\354^\240\246\340\231\225\371\324\202\0209b\371\320\t\202\235"
+	.ascii	"\250\222\3414G\342\020C\310\320\314\310H\222$\0352\n\020\004"
+	.ascii	"\243i\236\3471\037\022\300\3648\3171\307\030\242\021\021Q\220"
+	.ascii	"\024$\225\032\323\001\203\321P\334\363n\333\201\265;\217mN/\303"
+	.ascii	"\1770\301\005XX8*\3165\245YdoZ\261)\315O%\230m3\264\036W\317"
+	.ascii	"\340\005C\303\210\230\334 \314\013)v\330_A\240\352\364K\205\017"
+	.ascii	"\332\002\214\303Cna\225x3\031\3310V\362\326\360\262\204\273\365"
+	.ascii	"@u\037\036>\362\203\351\213\220\022\227\241\222R\317\205\251"
+	.ascii	"6Zb\377\037S\371<\307\321A\207\226J~\020\333\355\205Y\365\336"
+	.ascii	"{\204\213\b\002\206\366__\342\tD\0226\352F\335\244k\202d\342"
+	.ascii	"\2145\302\250\f=\236\200q\317&;\256@\320\203zN\340\275\005\274"
+	.ascii	"\205"
+	.string	"4J\336@\207\016f\207=\021\222\2062\261\353DT\327\247$S;*=n\021\2171\200*\311\005\t&WR\031\037\202\r\261+\326\303R\310\374M\327\241\223\245\tS\302o\026\252\220\036u\340r\207~\253?\336Ic\202\242u\321*\271F\332\364\3461\034\331\367\230\224\376#Rz\207\020\3407\245\326@\274lj\006pbR\231%\324\212\267\373\032`\257\366\240U\021\321\320\311\372\353b\2552\244#\026\211\021\347R\376GO\365\311n\350\307e\366\335;O\351\341\311\363\205a\177\210\3711KD\025\362\230\230\017\264^y\257V8\372\207\244Cv[\205\340\302\204l\345\030V\355@f\013\222%4`\374\240\f\034^\240Sj\240\203\027\216WXf\371\322G\276\300\270\362H~o\007\330\213\024\222\241\203K\327\207\266\313\345<\223\220\352q\261\373\351\b\275LB,T\227\376pP\037\327\340s\321\364>!f\300"
+	.string	"\276\204\373S\216J\222,g\365*\n\272\201HE\312f\374\276\237R\307\036\316g\230\200\235"
+	.string	"\004\377F!\202\202\223l'\004\254B\b\274\330Y\024>"
+	.ascii	"\005\335\211\024\250\331\274\003X\211\346\0352\202T y\25398\376"
+	.ascii	"\177\002`4\340X\223\225\361\304\326\215\022\352)<\204\353p\025"
+	.ascii	"L\2029\035V\272\203\237\251f\264m\365"
+	.string	"X\300\221\032\322\367c\317\362\361\277Z!\331\373c\211$\306Vc|N\227.v?\366/\\N6\030\211\215\177m+\313\031\230a'\274\325\314]\256\030\325//\256\366\017l\203\304\375?\004\262\264\300\n\2066s]_5\3665\335\376 \222\350<M\030\374\332qK\206\337\273\321\016C\032\024\nF\220d\265>\213q\f=\003\267\020\223q\202,Bz\b\245\301\305H[\302O\303ZE;b\3020\375\363h\262\027\361x/L\253\251\202"
+	.string	"\334w\321P\206\276"
+	.ascii	"2\251\357\370LB\361\343\266V\031U\261\352\272\020\304Y\336\333"
+	.ascii	"/\354\364\227\355\202w\374j*\314\021\222\340\300kh\200\03345"
+	.ascii	"\275\372\206\206C\357\252\f\005\317\tx\222\271\300\017<\320C"
+	.ascii	"x\260\017t3\201\344q\276\rd\034\322-\237r\260!\024\310\016\344"
+	.ascii	"b\206d\221\337\321\013c\374\302Z\220b\262(\203\340\251XI\306"
+	.ascii	"4\315\326\037_e\223\270\030\035\337:\201\353\315\312I\351:\262"
+	.ascii	"\314\236Fw\\\242\004\354\237\315<q\316\253\351\314\312\234\270"
+	.ascii	"\214\"87Z\016\363\207Y_\037\232\030\231l\207v\247\203\261\331"
+	.ascii	"\311h6\206\222\336\316\356\203\364\200,\224\203qm\326'\351\302"
+	.ascii	"\206\007|\002\033L\263|\215\366\203E\341\222m\372\\\t\002\016"
+	.ascii	"\234\026\3513a\310p\0303\233\222\310\263\354\201\335=\207\327"
+	.ascii	"\226\264@\316\317\332Y\362\177q\362\234y\270\2465\224\b_h3l\r"
+	.ascii	"\356EWB\030\346=\325!|bC\342\013\r \235\366\236\325)\263\315"
+	.ascii	"K\022\354\357`p\033\252\206a\203%\203*\377lE\023\246\031\230"
+	.ascii	"3u\221<W\272\027\255\262Z2\310\025_\346\007\217\032\005\232!"
+	.ascii	"\242q=\006\314\013\004\203\355b\375\031\036%a`\347\331\004ix"
+	.ascii	"\337\3307\036\020\255\260B\312\360\003\2043\210!+\3014\240\316"
+	.ascii	"B@E\"\271\376\266\323\200\221\201\300\247\\\371G6\203@k,\205"
+	.ascii	"|DN\303\347s\321\206\3358'\261\314\002\0014\030\363\222\240\334"
+	.ascii	"\r>2E\020xn\025\335\304r\n\\\266\306\2146o\206\\\341=\270\257"
+	.ascii	"k\374\302`\336\342\270F\366\310\200_c$\331\016ZU\030}U\206<~"
+	.ascii	",\025=O\333D\267\315R\237\221\303!\347t\355<Wa\243\262J\333\303"
+	.ascii	"|K$\376a\234\216fk\207%\365\3737\032\034K\274\376\274\023\036"
+	.ascii	"8\345\211\034\"\306A\245+\354U:\016\277_\235;J\306L\361J\226"
+	.ascii	"\254\003\224\350\311\236\236:\234\316U\030\341\264H\34424\363"
+	.ascii	"\365(f\300v\256_Ag\343\232\213\022\243\247\203\374zG\022'\247"
+	.ascii	"\037\300\245qo\374L\262%\363\023\373\223\347'zz\234\242\3772"
+	.ascii	"K\3401\341\323\031_\216\362\354m\211\370He/`\304L~E\267\035t"
+	.ascii	"?\336\002\357\007\341\212/_1\357^\207\340\333\316\235\312\273"
+	.ascii	"}\021\275\311=\327\255)\353\374\321=\223\346\376\203\363\356"
+	.ascii	"\271[{\326\226O\303\017\2745\372\275\004\346\365\233\307\253"
+	.ascii	"\3265\2358\177t\261I~\210\340C\024\3725\037\230w\212+\323s\357"
+	.ascii	"`\216\370O\210\330\n"
+	.text
+	.section	.gnu.lto_.symtab.54e4c3e5f41a0bc1,"e",@progbits
+	.string	"currentMeterVirtualState"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\001"
+	.string	""
+	.string	"currentMeterReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\001"
+	.string	""
+	.string	"currentMeterADCInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\001"
+	.string	""
+	.string	"currentMeterADCState"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\001"
+	.string	""
+	.string	"currentMeterADCRefresh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\001"
+	.string	""
+	.string	"currentMeterADCRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\001"
+	.string	""
+	.string	"currentMeterVirtualInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\001"
+	.string	""
+	.string	"currentMeterVirtualRefresh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\001"
+	.string	""
+	.string	"currentSensorVirtualConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\001"
+	.string	""
+	.string	"currentMeterVirtualRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\001"
+	.string	""
+	.string	"currentMeterRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\001"
+	.string	""
+	.string	"currentSensorVirtualConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\001"
+	.string	""
+	.string	"currentSensorVirtualConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\001"
+	.string	""
+	.string	"pgResetTemplate_currentSensorADCConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\001"
+	.string	""
+	.string	"currentSensorADCConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\001"
+	.string	""
+	.string	"currentSensorADCConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\001"
+	.string	""
+	.string	"currentSensorADCConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\001"
+	.string	""
+	.string	"supportedCurrentMeterCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\001"
+	.string	""
+	.string	"currentMeterIds"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\001"
+	.string	""
+	.string	"currentMeterSourceNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\001"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.54e4c3e5f41a0bc1,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1788 @@
+	.file	"gyro.c"
+	.section	.gnu.lto_.profile.ad036f5f17281be5,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\r"
+	.string	""
+	.string	""
+	.string	"\033"
+	.string	"%"
+	.text
+	.section	.gnu.lto_.icf.ad036f5f17281be5,"e",@progbits
+	.string	"(\265/\375`\321\002\275\020"
+	.string	"VVWF"
+	.string	"\261&\215\001K\264jaBsG\214G\222\347e\372f\203\t%\343\336U\315{\221\031\220t\306\007\204h\301\362\242\253\252\252\365\377\377/\375\377\377\307\3039\237\333\334\236\313\365\371\021\331\204\020\332\215v#\233\244-\003@"
+	.string	"B"
+	.string	"H"
+	.string	"\034\334\264\347&\247\2301\361dG\f\245\202\003\r\331\205L%\032\026(\004\227_\3077P\006\024\f\251\230-\007\215\035;\226\032\243\223'ie\347\005\302#<^\017\337\275M\307\251U\332\222\275Z\004{\345\230\\X\030\331O\255\031.\"!\233\255v\230X\001\362=?\036j\276\017\017\217v\237\210\f\351@\276\377[N\377\300 \267\307\323\233\302\304QI\311\301e1X\247\236M\203\317}\351\334\234[.\003\n\3523N\220\261\251I\260\317L\216l~b\020\324y\002&ur`*c\244\2021\260\032K\316\252B\001\002\373z\034\nj\003\216\001tl\370\b}\257\332\005\226\317I"
+	.string	"]\322g\027ynh\320\t@B;\210nR5;I+;/\021 \334\242\022\231\036h4.2$L.\254\204BDLI}\177+\241\262\261rP\377K\352\300 \3354\250s\277\265\200\3700\303\240\016\340%\370\214HY\020\217\317qTP\"\222\355^\264X\204\bW\250aAQ\206\246&HiR\310p`\202RST\035\021\020Q\247\246&\214\224\024\244\220\01638\t\252\337\205b\343B\312\372\"e\n\023\202\300\315\305\314\335\351\r\212\316\212\0174\253\033h\2077.\306\355\327f4\030\306\254\305\302\241\013QY\220\024\001\222\200\337\3469\252E\371\026;v\206\352\340\333p_\233v-4\007\217~\242\340"
+	.ascii	"\375x\035\250\375_\247|\265\271\343_\t\302\254\025\363\315)S"
+	.ascii	"\373\031\274\303\232\315c\342\207r\374e\007Z\3178x\242\236\341"
+	.ascii	"^v\253\022\317w\037N\277\033z\207\333H\212P\252\277\203\021\343"
+	.ascii	"S\030\026\350>R;\027\205[,\357\035"
+	.text
+	.section	.gnu.lto_.ipa_sra.ad036f5f17281be5,"e",@progbits
+	.string	"(\265/\375`\333"
+	.string	"e\006"
+	.string	"\202\b\030!\2605\313\001\fS\034\206aE\3030\314\201\326Z\263n\"\"F\35641\337i!d\357-eJ\001Nu\2029\240-0\003"
+	.string	"4+O\231\223%3\262F\210\365\201A\216\036\362X9\035\357g\031\355\2501\031s1\025;\241k\227\016\273\005M\320cf\232\365\255jQ\227\202\337i\345\343\006\0013 \320\002\241\"z\225\021\234\020d@\001[f0\005+\310v\347V\241C^\300a%\360\024\331\331\276\341\300\303\201'\241\036\320\222"
+	.string	"\366\274l(\310 \362\213\303\214\t\355\001%\241Dh\020d\200\005\241\2037\254\002\271\032l\360 "
+	.ascii	"\305>\203b?\231no\371\202\261\321\256\026\221\207\233\324\301"
+	.ascii	"\322\2756\272E;\347\002\f\001"
+	.text
+	.section	.gnu.lto_.inline.ad036f5f17281be5,"e",@progbits
+	.string	"(\265/\375`\330\006\005\034"
+	.string	"\206'\204I\300\222U\032\003p\341\201\021\n\016\360\250y\220\347\355\302\226'D\253\204\275\205_\352`\022a\002tyY%U\204\b\376\033\367\313\235\341\272\036\214\256\242%\024\207H\266MQ\030%d\326:|\033\022\322\266\350\030\201\332\336r\247a"
+	.string	"n"
+	.string	"~"
+	.ascii	"(\375\210\323 \036\036P\265\316\227\347\213\234\261c\353|0\327"
+	.ascii	"\371\"\223vW\237O\233\322\330\335\265<[\317\231\334\335\235\\"
+	.ascii	"gk\2350\032\017\257)\321\356\232\326p\235\305u\255\351\356\356"
+	.ascii	"\351#\354\256\356S\037\217\275$\371\200\323\312S\\\032?\352\254"
+	.ascii	"<68\271\224f\323\362\246Cvu\261w\215\002\0060\031\255\261[::"
+	.ascii	"x\030q\322hw\001\350\313\030\335\260\253k\215\322e<\323\317:"
+	.ascii	"MS\034@%_\352q\n\\r\341\203EN]\3464\007\310\322\213\225O\313"
+	.ascii	"x\362\371\253\371\303\310\017\277\336\nSM)x\320QD2o\262gwC\223"
+	.ascii	"\306\227\306\270\340\364R\232(\2278E\272\331\221q\362\\\306S"
+	.ascii	"\311\217\177J\177\324\327\024)\007\316\204\032\2179\371cwSF\211"
+	.ascii	"\2539\253a=\303'\004\r\372\004\177\206|\202>\006\272y\302\311"
+	.ascii	"\016>\301\021\t>\021`\362\327T\036@%r\3112^<\222\230\242\252"
+	.ascii	"\344,\205\221/\306\013\b\305Q\020\3250\345\312c*e\244\t#\016"
+	.ascii	"BbQk\225\322\350@+\340\344\360\304\247\316\216\235\036)\030\275"
+	.ascii	"5M\177l\360\0201oR\202M\215N\311\307H\020@9,\320`\032OD\230\316"
+	.ascii	"(8\005\327lr\017\270\334\344\257BbwG6 [\244\236\363\353\265H"
+	.ascii	"\315\222\323X\316\344\002J\264\362\333Te\323\211L <\244\355\302"
+	.ascii	"[\327$\221\006\355\352\302\371\2734\322\bE\227\316,/\354\352"
+	.ascii	"X\253\3501\232\224,\"9\212M\027v\223=\257\227/ovfd@\220S!\025"
+	.ascii	"0lb\247\334\232O\031\002\250\364\033\271\201a\250\204\213\357"
+	.ascii	"\327c\341\262k\333*\200\241\250\3618\347L\r\211\2104\005\005"
+	.ascii	"IcP\002Af"
+	.string	"\310\314\003\022\240TAGZc\020CC$-*Ha7\b[\216\370\361\227r\352\344\017\250\242 \023En\350x\346t\301\256SL\327r\223\361\342\033\267\334\027\345+p\232V\233R!\266\3053\302\327\223@+F\274\n\021\005c\370\222\310Z\336\342\b\235\230\244D\343\303Mr\262\207\252m$Q\306\307P*\272\240\260\364ze\204\247!\030\316\216\301\375\300a\245[\343\337\305\347\311\346;\030`\214\221\204\361\006\035\310\220\017\365\202\204\236\345-\200\211;\366\233\022\256\001\273\330\001\177OpW\274\256e\335\367o\004\312\370\260#\277\3101\366\236\200\214*\016\240\035z\300_\367\3727\346\027p\265\013\2705j\226\313s\331\035\357\342\317\017h\335Q\313\351\343\323\251\231/\231\270\217\250\230\376\202f4\207\215\323\203\376\313Al@<(,@\213v|\322\313\306d@\2668'-\005T\350[\314\016\201\243V\201\311"
+	.ascii	"$\306X\364^T`\300\210\236\027\307\344\326\211\223\271.\336\017"
+	.ascii	"m\213\376\003\341\247cPs\344\341\311\250\002gT\361)\331\214B"
+	.ascii	"W\322\317e$\251\037\360\320\254h~\210\370Z|\221\226\250\037\335"
+	.ascii	"\242\002t\373F\227\331\303\242I\334\310-d\225\365|\034\376*\263"
+	.ascii	"\023i\347\032pK"
+	.text
+	.section	.gnu.lto_.jmpfuncs.ad036f5f17281be5,"e",@progbits
+	.string	"(\265/\375`\274\004\265\017"
+	.string	"\306\224?2P\215\322\00103\313%f\311i9^\265\302\310\207R]U\325\246\257\333\263l\0213\203`5\360\243\277\332(\371P\270\027\003f\003K\273I\262wJ),"
+	.string	"1"
+	.string	"3"
+	.ascii	"\317\024z\320\366\340\315\336sZ\204\266"
+	.string	"\bo\327\023\024\016\255\326\346\233\251m\266\267n&\327\316\022\376\370d\366\253\247\237\025\373\305\224\332\bu\277rt\345hBr\255\316V\001\370\303.\371~/\027\247\006\376\345\300?\343\376\354L\352\020\033\3047k\035\370V\336\353\263Q\254\247\365\344<7\223o\023n\002\365\265s\307\264\210\326\330\22389\212rz\340)F\360C\033\261E|\273rrX\366\\\241]\341\355g\314\034\264\006mAK\360\001Frh\003\325<\231\375i\031\256\361\264\235+\003*L\222\026\r\231b\027\231\221\030\r\261\326.\370\234V}\323*`4\355%\3602;cY,n\t6\370\2403\204\370\347,n\250a=cfHH\232\f\273\001P\002!\344\234\361\022\240\2011\f\345Y\022z\023X\205\245\2456\366\0166\300l\247M\267>\017\013\351\237\310~\200O\262|O\263\211#:h\001\303#\226\302\016\364tA\026\311\f\317"
+	.ascii	"\032x\321\021\357k\206\027!\224\300\251\335\201\371H\260$\317"
+	.ascii	"\240kSK\337\\\212\323\t\207>R\267\353t3@#\023\027\026\246\350"
+	.ascii	"\n\215\024!f^\303\372\314\262\216\201\022\232\325\250G\300.U"
+	.ascii	".\220\307\371M\372\377\013J\305c\374x*\023\307\f\013O\255\251"
+	.ascii	"\360\255\364\016\342f\030Eg\332\336<5`\023\007g?\303\320\013"
+	.ascii	"\314\241Mw$8a\025\355\243\361\016\241\366q\303\006\365\306\007"
+	.ascii	"7\261\210\f\021\264\270i^H\353\275\317\215i\322\202\252\032\225"
+	.ascii	"4\232\\`\006&\205T\300\177\241\024\210\307>R\327\236pvLJ\023"
+	.ascii	"\306?\245&\327\t"
+	.text
+	.section	.gnu.lto_.pureconst.ad036f5f17281be5,"e",@progbits
+	.string	"(\265/\375 VU\002"
+	.string	"b\205\021\032\200e\032\0036\343&\034\221\021\0203\260\322\t"
+	.string	"\177\313\374\316O\021K\204T\031c`\004\214\327h\235\325\245\316i\224\316h\204\036<\247s6\227]\346.7\345\226\334\220{\\\343\026\227\270\303\375\n\367\330\335\t\002"
+	.text
+	.section	.gnu.lto_.ipa_modref.ad036f5f17281be5,"e",@progbits
+	.string	"(\265/\375`\270\002\355\013"
+	.ascii	"\222\317./pK\222\016\374\347\212\365\211L\027%<\207\033\250"
+	.string	"@UUUU\370\370\321\326\262-6\022\351\337~\377\326\332b\024\034a\244)\322\332b\2232\005\377\363\201r\250\240\306\006\n\203\305\302\337|\251\302\tO~^%\021\236\312\233\312+\3524\036|M\250rL\357\"\212\220\311X\004\322nm\023-\305\t\323\030<4B\202\277tZ\345\026\0245g\311OJ\271D%i\240]O\306|\221\013\210h\363|\\6y!\311y^\240\0357$\355F\2156\357\226rK\031c\307\225\316\311wQf\366\255^)\237U9D\357x!b\365\356\251\312\03012sN\265\271\322\002x\364\202\033\216\\\2501U\305\252&I\235\003P\002A\310\254<\022\240FAE\241DF\373\377\327\001\b|\254\230\007\263`PL0\252\275\276\272\236Y=\t\3170>\344\267,_-\342osB^M\004\375\353\n\333\0346\222\351\331\371\200\330'\307\020&\303\0251\347sK\002\303\225"
+	.string	"!\\\3523\236\312\017\335\210\256#\271\263\033!\243\360\253VF6\337\274bH\350eV\245\n\317=$p\263\231P\0374"
+	.ascii	"\262z\365\267da\033cl\033\237o\270<\251\331j\257Z\001\272\bW"
+	.ascii	"\231\3335(\344\217\211\347\2606<\252\352\0216\002\005\2608(\302"
+	.ascii	"\024K\315\200\nc%u\016\226\246\345T\276,\300J\346:\001"
+	.text
+	.section	.gnu.lto_.lto.ad036f5f17281be5,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_gyroConfig_Registry.51.ad036f5f17281be5,"e",@progbits
+	.string	"(\265/\375 \226]\004"
+	.string	"\324\007b"
+	.string	""
+	.string	""
+	.string	"("
+	.string	"\005\001\212\001\206\200\200\374\342\303\366\342\021\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\325\006us\356\005uq"
+	.string	"\005\001\006'\001,\212\300"
+	.string	"?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/sensors/gyro.c"
+	.string	"\004"
+	.ascii	")\302\303,\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_gyroConfig.53.ad036f5f17281be5,"e",@progbits
+	.string	"(\265/\375 \277\365\004"
+	.string	"\362\307\036*`W\032\0030 h\035\351\210\274-k\250\251\241\202"
+	.string	"#\330;\321\230\214jDGr\"CC\b\0273\002Q\200\336\306\330I\006;\3520E\234J\254R\274Z\\\031\327\306\3251\353q\013\262+\362K2lr\245L+s\226\271\3131\31443\325\334m\226q\236u<\357&\"\215\f\373'\016\013\201%m\t\212C@\311\364\354\236\265wh\020\207\004\201\355\3712\016\367\335=\005\r"
+	.ascii	"0e\024\025c\251[p\316\260*\006f\334\227\033\236\026\330L\255"
+	.ascii	"\322\364\262@\212(\003(\002"
+	.text
+	.section	.gnu.lto_gyroSensorBus.54.ad036f5f17281be5,"e",@progbits
+	.string	"(\265/\375`\017"
+	.string	"E\007"
+	.string	"\322\21525`O\322\001\024\302\b\003\355\321\f\307\234\234F\006z}"
+	.string	"\247\273Im\306\326\220\266\355@cCh\337\214- I\302\306(\263\026\245\217\220\r\357\365 \233\354\235R\276\254(9\017p\31287\231\t7\020\016\032x\311\t\255\002\307\210\214\204\0231JH\325\375\211\246\312vA\247v\274\211\004\202\347K(\f\262\335]\370\363I^+|\216?s:\355\364\317\357L\177\007 ga\327Os\031\366\245u\030v\253TZ\030Vv/b`\226\345\245t\330\366\330\224\037r\021\2171\202\232\215\250\320F\b\345e\267B\327\017L\177\001\027\230\376\234\306\2617\314\377\310\245\017\020\027*\372\274\0014\354\256\033\025\215nw\333\t\266\025l{\004\n"
+	.ascii	"2\003\302\360\030a\315!,\307$\3055\261\032!\264\020\231\270+"
+	.ascii	"\246v\222\001"
+	.text
+	.section	.gnu.lto_gyroMpuConfiguration.55.ad036f5f17281be5,"e",@progbits
+	.string	"(\265/\375`\017"
+	.string	"E\007"
+	.string	"\322\21525Po\322\001 \346\226\332\244\2358:\243\306w\270\210W\200Y\252\327\016f\333P\353\335\bm\b\267+\266833\211\205p]\207\273c\303\311\233\217\310&{\247\024\276\254(7\017p\31285\230\t5\020\016\031x\311\t\255\002\307\b\214\204\0231JH\325=I\246\312v?\247v\374\210\004\202\347E(\f\262\335]\370\363C^+|\216?o8\355\364\317\347L\177\007\037gaWOs\032\366\245u\031v\253XT\030Lv1^\\6\345\241\210lwl\312\037\375\243c\214\240f\241jEtQ\322\262[\241\353\007\246\277\200\013L\177n\343\330\033\346\037\344\222\307\350\204\202<o"
+	.string	"\r\273\353FA\241\333\335v\202m\005\333\035\001\n"
+	.ascii	"2\003\302\360\030a\315!,\307$\3055\261\032!\264\020\231\270+"
+	.ascii	"\246v\222\001"
+	.text
+	.section	.gnu.lto_gyroMpuDetectionResult.56.ad036f5f17281be5,"e",@progbits
+	.string	"(\265/\375`\017"
+	.string	"E\007"
+	.string	"\322\21525`m\322\001\303\216\002rB\223\r\305\004\317\231\235\013\373\003\b\365F\341\214m\250\367\016\215\266\030\013M\215\207 \b(\237iu\275>\215\034\370\352\206%\233\354\235R\306\\Qr\036\340\224qn2\023n \0344\020#'\274\n\034#2\022N\304(aU\367#\032+\333\005\235\332\361\"\022\b\236\017\2410\310vw\341\317\007y\255\3607\376\314\351\264\323?\277C\375\035\200\234\205]?\315i\330\237\326e\330\315b9a@\331\305hYY\223W\302a\333cW>\351%\2171\202\232\211\002F\245\013\022\225\335\n]?@\375\001\\\200\372s\243co\230\377\217O\036\244\024\032\372\274]\032v\327\215\206D\267\273\355\004\333\n\266;\002\n"
+	.ascii	"2\003\302\360\030a\315!,\307$\3055\261\032!\264\020\231\270+"
+	.ascii	"\246v\222\001"
+	.text
+	.section	.gnu.lto_gyroDetect.57.ad036f5f17281be5,"e",@progbits
+	.string	"(\265/\375`6\001\225\016"
+	.string	"V\034fG"
+	.string	"\261&\035x\330\342\340\213\006!\276\221M\340a\310\317\032\022\342\254;\263\2402\277\n\275>\350\307\364\365blH\207\370\267\003\030\311\241\037t\353K\377\367\372\277q\2509\305\230\356\214\nJ9N]K\342\336{\357\224\002P"
+	.string	"P"
+	.string	"T"
+	.string	"\0163\333~\211\263J\376f\270B\201T)0\330\360\354\206\332\201\017\250\247\363\002\352\251T\375\373\224\361\363\377\372\234\321\231\001\242L\237\034.\247\202\233\036\326\007\3524\003\220\270`\342\257G\030\324K\214\036\017v\327\021Dm\270\351mG\260\335\300\276*\254\034.1f\207\246(?\330\237+S\366]\367\347\341?e\364\001\374E\016\317\r\0070v3\304v,\214\272"
+	.string	"q\327o\227\374\227A\276\353\313L\032\262\033\0248;\273a\202S\217d1\332\257y\253\364\260\345!\273)\0319\273\341\210\021d\247\0010\220\033\250\266E\276b+\260\332]\006>\316U\230\370\004%\036D\251\247\237\241\021\003q\330\306J\306\203d\251\227\335\253\306)\366\370\023\247\264\271\n\361\340%\251\025B\307\316I\232\354\223\252\355\375\004)\333\335\005\276\215\312Jh%s\352\267\324S\221\230\0211\001['Z)\351D\020B*[\211\364\210\204\353XL4\257\343\274\224\315\323RND\023\264Q\347i$\004\314Q\330:\315\002\307u\032(\334\317\225)_\247\305B\202\374\253\247iQ\023\375\257~$\214\355\217\374\350@\003s\221/3$\376\022\252-\032\305\203\016\305\020\021\025"
+	.ascii	"|E\331X<>-\220\236\255\300E\007\326X\230\r\362@\350@EF\200[\333"
+	.ascii	"Aac\233k\270\330\026%iasB1\237:\007\355\002R\002\255\272iJ\241"
+	.ascii	"\240"
+	.text
+	.section	.gnu.lto_gyroInitSensor.58.ad036f5f17281be5,"e",@progbits
+	.string	"(\265/\375`\342\004\205\035"
+	.string	"\226\264\266F\220\236Mc\020@\266F\314\t;\2512\360\340SH?\261\301\001#\217P\345M\t\323\247\302\345_\335*jN:\211\246\031\346~\246d\005#\200\300\202l\230\200\002\246\304\254\302\231u\2500\243&do)\267\224)\005\240"
+	.string	"\230"
+	.string	"\245"
+	.ascii	"~\3204\037\370(B\177\n\272\361\200\267\347\002\313\253\t\302"
+	.ascii	"\253'\214\257\267pN\373Mw\022\372/\306\005\334\213\004&\313\275"
+	.ascii	"\300\bv0\276\032x\233}\035O\300\276\332\266\004\nB&\017T2\022"
+	.ascii	"k\374(\222\342u/\020G\211\234\374(\332\032\322I\372\273\217!"
+	.ascii	"\223WX\323\227\020\034G\027y\334\002\350\025\321z3f}\360\013"
+	.ascii	"v\204\021UU\351\351x\030\336\356\275\263\236\214\360\306\233"
+	.ascii	"4|\340\033\223\003@\217(\264Q\r\301z\360\n\222\3348\232S\334"
+	.ascii	"\271\367z\226=\034\267\354\266s\330\336\261\353\fv\b\021\363"
+	.ascii	"\245\215\336xtg\037\013\214\006\345\225\013\223\336\2075V\356"
+	.ascii	"8\265I\334\ny@\311.\361*&\306{o\005*#z\002X\035\211\021\247\344"
+	.ascii	"\262\317\241~\306{y\025|)\237\222\302?\362j\025+\346\313W\177"
+	.ascii	"\205}=}\3603\213i\211\317\35174\307l \321\244I\366\303K\221\354"
+	.ascii	"?\335\266\377\376\001\236\316\221M\327\306i\232\235\236\211\323"
+	.ascii	"\262:=\332i\261N[;]\353t\350i\032N\037\201\205)\237\017$J\264"
+	.ascii	"\nx\215\306\302\356T\335\262\364\247\337\026\nW$\024\033C\206"
+	.ascii	"\3712\203}\245WJ.\0043\244\226\216T\003\207\371RFoEtg\221\216"
+	.ascii	"\035\256&\215H\037U\251\365\3603\037\250*}\325\325\217\322\220"
+	.ascii	"R2Ebf\312P\0066\232"
+	.string	"l\371\234~\\*M\"\255\r\342b\310\004J\367\3360\017\036\202\024\034/7Z\356\235\335\214s%\260\255,\241\377\305Z\266\353(\347<\266\313\275\\\312ZVK\244\235\307\276\332\337b[\313\276\371r\357\356>\333\326\232\345u\360j\24361\300\257-\336\024\233Z\272\250\202P\232\344 k\243\005\230\320\004\257x\023\314\2669i?\272\036\030(t=\033j<3\373\350\344tA)p@\272\034P\213\037 \\\013\025=,p>: \234\216\001\347\\\374\350p/r9\035\216\006\034zx)\222-\033#\250(\361'\355\203\327\220\005\006*j~\314s(\r\3339\324;C\224h\324\231\003\250M&\221D\346K\3172<\246xt'\326\212\034\2144\222\340\313v\237\027\224%\227l\215\236\b\256\341M0$\177C.u\325h\225\032k@\243\246\0011\251\344mH&\\4j\307z\314\232|\213tr\200M"
+	.ascii	"\232Urea\315(\215I\354\353'\2436\371\344kH\247\232\325\255\036"
+	.ascii	"b\250QD\001CL)62\"A\222\024$m\200\002\23112\036\021PIE\252La"
+	.ascii	"\355\214\001~\236%`\207\\\2438/\267\362\310F\021\200\021\320"
+	.ascii	"Ca\024Ct\210A:\337\304\202\265Z\313)\006e\n\342\034\024\350P"
+	.ascii	"\304<`\243\365\253y,\230\370\221'z\00583\332^\2544P\210\b\020"
+	.ascii	"\021B\177\200\271\353\267\243\311Hw\361\273\375\346\335\371\315"
+	.ascii	"q\363y\324e\336y\227\252\362\251r\023\025\335\024\030\t\254>"
+	.ascii	"\367\2714\205\266\332\374v_q\315m\363\204yd\177y0\215\\:\323"
+	.ascii	"\371c\024=\336<\215\365q+h\334\242O\325{\302p>v\367\325\367\355"
+	.ascii	"\331\247R\360\t\023\317\275\314:\362\366<x\211\301\241z\353\n"
+	.ascii	"\f\225/\340\017dN\031\227\032"
+	.text
+	.section	.gnu.lto_gyroInit.59.ad036f5f17281be5,"e",@progbits
+	.string	"(\265/\375`\032\003\255\025"
+	.string	"\346\345\211J\300\020)\035:W\302\215z\343\241\242\335\013V\206%\371\235I\002\203\"\330\276\262\023\205\361\313\310\035H.\260\346\376[\375.\215\256\336v-\302\250\026\200d \32245\311\306\\\267\346y'\240\352{\375l\315Z#\204\220\275S\nu"
+	.string	"o"
+	.string	"w"
+	.string	"\266\214\035\263\202\0052\306\335\310\207\346@7\034Nd\355\032\315j\317q\207\275\\fI\216\225\342\374\212$cg\225\344\313\035\366\201B\304\313,\031\3728bk\030\324\312\251\271\271\3537\216\354\356s<\200\240\246\315Kr&\346\333@G\263dwa>\233\327\361"
+	.string	"P\352\203\314\307\033A\250tj|\350\264\203oG\251Y\262\273\246=_\315\035\273m\037\333\005\354\332 $\025\t\236\264\t\007\025\3168\236\245\364M\374\210\305\377\361\205\226\226\362\244\331\263$T|\210\036pX\377R\276Z8\272\342Q\035\266k/\361\342\332\3451\360\211^t\363\177NZ\003\f}\357\244\017S\236|M\020,\002\211\212t\364\264\215v\264\362\330\257\347y\236\256;\266\251e\225\232R\352\177\\\213)\353F\214p\227\346\334\261C\322\t\310\001<).E\346\020f\025U\234Nm\275*Om\241BaK\330\303\322\321\323g:\201\251a\216\362\330\335\234+\312D\363\305/"
+	.string	"\013\023M\250\250\217\247_\371\220\262\311w2\321\224\212\252\017)O\002\005\355\332_\262Mt\355\346\016\264M4\355-\rQ\320\342\254\201\221\031\332\303J+\264\236@\221\370\215\273\273\246\223V\374\212:z^\270#R*M\244'ca\3518\005\246\221\324l1+\263\233\255vsQ\271\315\\XRZf4\333mF\"\3005\f*\266Y\206Z\3156\213\031\351>n\335\221\325\021]\335y"
+	.ascii	"}\3604L\\W\237\341\340\201\211\t\204\b\364=Y\025\371\ry5g\020"
+	.ascii	"\n\340vQ\"\370\203\257B\221\371\354\352\336\363a<\306\211\004"
+	.ascii	"\024\224\t\025\350{\006\321\n\322\2621Ss\366q\245?u!.\205F+O"
+	.ascii	"\276\254\252\204\212\260\032G\250QD\306\224\242\"\222`\0244%"
+	.ascii	"\005\351\360\002\221\251\232\007\020@\252J\222\244\003r\240\331"
+	.ascii	"$\177,\301\205\312M\020G[\202\0377\204\277\217\231\234lqd\237"
+	.ascii	"\203\2259\234\031\210)\\?*\264\252=c\024\201i\234\3040\353\326"
+	.ascii	"\017\342\300\355\356T4#7\201\327\347FU\374\302\262\003\357G\337"
+	.ascii	"\331@%7\227\300\302O\325\313l\321\0355\200G\020^\217S\341\254"
+	.ascii	"\232\226\245\b\251\034\373\354~b\347\036\006\361\362\377+\361"
+	.ascii	"\237\236?"
+	.text
+	.section	.gnu.lto_gyroDenoiseFilterApply.61.ad036f5f17281be5,"e",@progbits
+	.string	"(\265/\375`\300\001m\020"
+	.string	"\006`lD"
+	.string	"\317&\035q:\314\304\246\302k\007t\274\355(\206\027\037\364\360\177.\331\357\263\370\307\304-\302z\202\017K\252\320\241\032\252\266fNP\376\377\377\333Z\337\324\004<\221f\237\002\260uAx\234M\310\336R\246\024W"
+	.string	"U"
+	.string	"U"
+	.ascii	"\035\210\017\304Cw\037p\035\306\013\270\016]\262[\274\373\260"
+	.ascii	"XL\317\212*\306\356f\352\301\372\327\335/K\207O\263\344c\"57"
+	.ascii	"\300r\201Jq\207\257cw9R*OA\262\244R\362\205p\271\376\346\bX;"
+	.ascii	"\250\224\313\023\023\331]'*\245\341\276n[\263\315\300\316P4\277"
+	.ascii	"\306Uw|i\f\246/M\303\227~\231VM\247\246\337Q@\305\212\0138\273"
+	.ascii	"\031Z3\326\007\242\210\271\352\366I\3707\016\3716/Q\272\312)"
+	.ascii	"\"\327\022qtV@\273\373q\350\005\361\320\343=d;;\347\264B\236"
+	.ascii	"\366E|D\3514\026\036`\367eub7O/\265)ly\024\246\036*\312\031\252"
+	.ascii	"\206^\232A\247\031\005\202z\375\234d|\023(\326\211 |\347\\A,"
+	.ascii	"\033L\331r\352\206\252\3764\363n\236\353\232\372\223LJ\266\034"
+	.ascii	"\365\372\2337ha\365\254\260L\331R\335]N\025\306\356\270\374\356"
+	.ascii	"\256\365\305\026\275\3737\036[\t\312\350\215NF\017^\004\223\221"
+	.ascii	"\203\347\221\020\222V\001B\266i\244\315\204d\313LJF\022\262\021"
+	.ascii	"m\313B\b\2304\201D\313NH$-\013u\373\257\276\324<\366\360\370"
+	.ascii	"\2304\005*\214\001\254T\244\272\312\217Ge\001y\324\303\260Ya"
+	.ascii	"H\031w\307\375='xT\221\236\003k\347\324\001S\016\026\371\203"
+	.ascii	"za\312% P\0022\250\252\007\242\3204\004\214\226q\276\273\253"
+	.ascii	"Ol\241\265\013W\373\034\0263\031\274\344tq\346*\026{Oi\016\223"
+	.ascii	"\267(\312v+\243=\260M\230\353\016\275\330\240cGd\336v\324\204"
+	.ascii	"]\273/\274\034\256`n\300\243\304\275\314\020\201\rV{\333\001"
+	.ascii	"\177\312\235\353=\001"
+	.text
+	.section	.gnu.lto_gyroInitFilterLpf.62.ad036f5f17281be5,"e",@progbits
+	.string	"(\265/\375`\032\n\0250"
+	.string	"\312P\204\021AP\246N\007K\330\033C\327\377v@| \006\004\304\321\317s9\356\366U\232\326\221Q\316,\371\2222AS\373\004:\336\210h\232\350)"
+	.string	"k\313\016\250\27701\003\016\016\337h7\262\367\336;\245\224\002\376"
+	.string	"\361"
+	.ascii	"\r\001\022b\214\301\323\302\335k\344\251\350\336\245m\264\264"
+	.ascii	"\\\267\033s\277q\317\3111]_\261\333`a\326\212\360\335{K\260\315"
+	.ascii	"\365\031g`i\007\327Lf!k\365\033K%\233}Z\314\302N\321^\262\220"
+	.ascii	"\033M\267\265\355\266\203\345\nc\323\030\361\343\273W\351\240"
+	.ascii	"S\226b;}B\235y\202\205\266\225[\374\367>AT\241\235\271\313\264"
+	.ascii	"\231\266\331~\264\200{\247\310\255\271W\t\201\031\260\235\262"
+	.ascii	"\262\227\324N\331NR;\345\226Y\257\225i\267\347\366\214\313\276"
+	.ascii	"{\357\360\321\370\033U6\263\336v\020\310\256j*D\337[\356u*\n"
+	.ascii	"\f\320\021\311\325A&\020\r0\206J\2303:\013EE,\331k\\7R]\247\232"
+	.ascii	"=\254\263&E\214I\247\236la\220 \262\250"
+	.string	".\251\321Ya()ad\217\n\221^\376y\302\230\240O\367\336^\266\013Av\271\257S\367^\366#R\254\331\250\231\271\0173\243`\006\322\005tjp\204\177v\307\215\247\331\217\327\310\242-\367\326\341\266\303zl7u\331]\003\333r\313.\203\236\303\314z\006\336\354\356\345\352'~\274\f(\224y\371_\307I\301\336\353u\201\273\256\355T\254`\301B\355\364\177\255\373\023s\357\275h\322\373\003i\253\243\364\376\2774\376\021\375\331\375\177\306[\252\322\0338\263\327\226\347\345\210\270\337\tMY\273P\223\336\371\024\307tq\213v\343\202\275\367^\340f\323m`p_\351\224\251\252\274\217Uj\247\375Hu\212\374\330\210\376dVv\371\2371\367?\237\317'\377\024f\3259\352\235\025\254\316P\253\363\323;'X\235\235V\347\246wF\260:\037`j\266n\002\253\363R+\273\225\332\2559\251\345\232\221\214\234\217\204\316"
+	.string	"\336\331\350\235\205\252s0\350\f|g\226u^Yg\025\350\234\262\316\350\352\374\252\263\253\316\035]M\337q\022|}\366\201\317\334Fi\315\374\322h\317\372\331\242i\370\203"
+	.ascii	"d\277\215\177s]$\333+\273\2277<\237r\274\356%F\251\277~;\213"
+	.ascii	"\\\272^}\032f_uE>:\335\313\026\300\314s\344NU\273\265\242ViD"
+	.ascii	"\255\225G\323\013\343\327\367\207\364\322\307\322\206Z-\217\346"
+	.ascii	"\354+D(]\342\364k\362\326\256\265]0\370y\366\335K\354\243\227"
+	.ascii	"\026\324\202y4g\230&\263\207\346k\305hH\273\367f\350\264\233"
+	.ascii	"\334\222\351\275\326\214\020L\240>\275\366\f\234SL\223\245G\360"
+	.ascii	"LN\343\337\201\017\264\325K\274>\016\"\366\226\272\364\007\236"
+	.ascii	"\311Y|\322\325d\016\375g\213\345\245\357f\243k`\002\371\2619"
+	.ascii	"y?\372\3513w\370\340}\344\247\342s1w\037\033G}d\016\321|Dl\300"
+	.string	"\033\321{J\3509a\242B\332\225\037j\247\351\367Q\211\322\243/\365<T\344#\372\223\373N\367\262\275\214\313\027\245\177&\247y\212\313\027qw\203YV<`\240:\262\254\264r\364 \321\203\352F\225V\216*,\017J>@\310\300Q#E\021d\252\bWX=f\f\263\260\256\262nTe\roX\301\2601\244\302\312\032F`\342+\034UXC\035WWXC\241\222\330\350]v\177\345!sG\374.4\310\344\262\306\334r\364\315\314\202\205yEHKD*\331dVa2\267c<\215\211\366\364\n\240\376\354\351\241\230\314\301\315\236\276\231\354Qf\260e\355X+r(\355<\372^6\373g\0066\007\3743\026\346\255L\237\346\t\0354\322\013\201\320H\301/myjtjv\354\203Fz\246/\320\366u(\203\013\337\350\001 \333#dVJ\374\302\231\264I\372\r^\273\304\307\332\261vK\363d\005<"
+	.ascii	"FQ/\034\240"
+	.string	"\306\370\367\317g/P\203\037\365\354\306\244'q$\301\357\271\376\220L\302\371=qM\324U\\\f\031\006|,^\204\310\020\262\326\211\252(\271\364\342`q\314S\376\025\307-\03176}\002\247\017\222\327M\357\024\307\034<\200\307\250\2014\347\024#$D\"a$)H\241\003\200\002\021\242\242\331\006\021@)D\310T\211H\013\n\nJ\205e\rd\274\347\206!/6bJ\206\202\314\320\221\204*\226[\030,\274\331\227\216\001*\343e\231\221\273\214\240-\006>\203X\366\002\313\3142\225Y\005\315\210\024-\343\210s\362i\035\357Z\206\245XY\353\336\"K\216\270\f\207\2058:\326\222(\n$\2227/8\261\244\325.\316,R\333.\300u\200\277s\022\341C\024-K\201\036\265\3639d\360}`\035\310\200s\273\330\325a\232|gne\242\365&\205\210$4\315\375\013x_\264\203\225\275\241'\001tf\013K"
+	.string	"FP\361\201\020L\016\266\021\330\024\345\212@\022\222\246W\002W\324\363@\343\346\347/\200\346\002.\276\373d\304\326\t_\337\030!;iXh\277\347\337\243\311\320j\261\254d\367\250A\230cI\031z\317\232\350V\347eXy\275\361r\240\314y\251N\340\256\247\361\3064\362{\r\323\221\033\247\0030\026\344\303.lxt\377\315S:`D,\316hI\375\321\235-\233\202\224\2673\244\322\235\360\026\200\235\235\237\341\3649\373\252E\020A0\330f\362\022\343\033\275\221\340\205A\205Z\312\024F\354DFUs\235\2222\311\351"
+	.string	"\357lhj\t\232\215\325^\364m\260"
+	.ascii	"@>\202i\250'\252\025d\321\274\320\b8\177\027\023\336\b\310\264"
+	.ascii	"t\261\272zl\274~^\237C\3616\247\013jR\272\340\305\320k3\017\307"
+	.ascii	"\032\377\001"
+	.text
+	.section	.gnu.lto_gyroInitFilterNotch.64.ad036f5f17281be5,"e",@progbits
+	.string	"(\265/\375`\225\005-#"
+	.string	"j@(\016L\220\326U:\3048V\276\207,&gp\263\300\023\005RW\274rMQ\212#pW\377\231\235_\336\""
+	.string	"\2505\343\215\355~\007\214w\017.^\206_\224"
+	.string	"(\030\007\253\020\317\340U\303M\"\">c\363\246\r\375\243m\226\020\262w\222\001\307"
+	.string	"\277"
+	.string	"\317"
+	.ascii	"X\315^\355\356\337\217\004s\212\313\214d\211\307\252'\262\234"
+	.ascii	"\227\006\256v\007\332\325\313v["
+	.string	"\t\031]P\247N\325\276\352\347\306\344\"\321\213\016\355j\314\305E\200t1\271\310\314bp\227'\322>\252E\032\223\213GF\nhWs\322\337\356?\035\252\275\322\305erF\002\323\312yy\240\t\320\256\366\362\271\365*\355\270\365j\267\335P\235P\016R\260\204e\224\"\3139\357\260\322\333\317V5\305\267\355_\375&\251\004}6\203\340\274\r\224\031f\205\254\3615-\020\335\312rC\032\323\\\f\036\307_\r]\265\206\244\361\224E\026/\276!\205\322\234\234\363\271~\211\220\304{g\020r\316}\217\310\031o\332\273[\250\273\205\335\252\214!\372;\256\266\b\336\375\221\267^\235\301\347\372nK\n\251\bJ\t\203\217ga0\250\214_\206\267\254{I\2748\251\373i\306H\335\352m\034\333\355\033\333m\235\315\265\3365\354\355\034{\233\346\3157\216\275=\363\250_\346\312?\346E\376\333\273\336\266W\375\265[\3750"
+	.string	"n\317\330\333\253z[\255\335Nk\267q\355\366Uo_"
+	.string	""
+	.ascii	"\2461\344_\224\345\034\243\254Kv\2426{\274\371k\375]\307\335"
+	.ascii	"\357'\271\323\367\257N\220\204\222yu\251\330\301\036\301\370"
+	.ascii	"\312=\232\257\233\315z\263\317"
+	.string	"\325,V\373\273\221\376\326\203\344XS\316\371Z9\303e\2261;z\021\375\275\352\247\226O\214\262d\024\375\365\003\370\316\017 R>)\202\272\271\177\206\325\206W<\3037\334\255a\303\375\261\323\234\234\341\017E\207\355\341O\302V\234 \tuR\346\356\261\212\2739t\270?\332p\216\020\016j\033\254\342{=\355\222|2\305\250tp\211j\2558\251W\032Si\r\314\217%\036\306,|\260wzk\330\006\023\365Q\254)\036\301\234\202\361\305)\276X\214I\260\303`\214S/F$\304\377\2546\370\342_=m&\237D1*$D\025\207k0{t\024{\232\3038\fd6\201\3019|\013;\202\335\234s\020\306IM\203qx\004sI\361r\351\032\246\301\265\243\243\227\361\313\f\016\020\205\343\037V\034\276P\206\202\020oY\277\331\036\316\344\003-\347\274\240\257\344K\002\032N\360\204\276\336*\f\366\370\374\2000"
+	.ascii	"\361z<>?\036\340\004\032\026\025J\224\360\t}tl,*\314\200<\302"
+	.ascii	"\024=\023N\360\204\276\036K\242\347n\2505\017\201\017\bdb\027"
+	.ascii	"\004\372\202=\236\340\256\327#B\305\216\007\f\356\020\340\264"
+	.ascii	"o\005\017p'\364\371\200;v9|\2321\322\325iS6\242[\242CL\234\311"
+	.ascii	"\340\245si\201\225\240M[\310\260\026\350\r\373x\226\026\bVz\222"
+	.ascii	"a\271B@9V\004u\343\253ej\235.\223c\352J\321S\316\303\037\357"
+	.ascii	"\354V\310\253\264PX\351\331\344\354\266\360h;\304\201\216\234"
+	.ascii	"s\203\253wv\204S\321a\231\306\310\240\022\326\253*\325\323\351"
+	.ascii	"\206\016\343`\234\247\361\013\036\333\271T\224\037\255\f\277"
+	.ascii	"\263\352\360\r\306y\016\0259\233\302\245\354D\001q\341.\326\253"
+	.ascii	"\272g\250Q8\205\f3\204!!\241\210\244@\3111\200\002\241\241\263"
+	.ascii	":\021\300\27142%Iv\003S\364N;\302k\t3*\224f\226`\032|\256\320"
+	.ascii	"Dc\224;z~YV\253\3162H\302\177\271\n\324\021\371\207\347d\025"
+	.ascii	"\240\312\017\013\003\307\227S\024\f\354\013\341Z-\271s\231L\223"
+	.ascii	"\237\313A\352=\240\003Q-B\030\247\206\205\036\3209\204\233\263"
+	.ascii	"\222\f\016v2\006\3455g}\013\2606\275\002l\302,\271\362_C\217"
+	.ascii	"Ag\033\3022\031\325P\301\337\362<D\250\234\bT \326\3569\363\377"
+	.ascii	"\221\323\237yZ\331\264\016\017~\230h\254\2571u\362\253\356\227"
+	.ascii	"\034\250\3502\177\300\334\212\230Z\007,\r\313'\224s1\265\300"
+	.ascii	"\264\325\037\342Y\224\250\251\316FH\315\317\253\223[b\324"
+	.text
+	.section	.gnu.lto_gyroInitFilterBiquadRCFIR2.65.ad036f5f17281be5,"e",@progbits
+	.string	"(\265/\375`\247\003\245\032"
+	.string	"\026\260\253H\240ZQ:\304eE\317wM\262\361E7\303\271)j\272\346\327\311\244\310\360A\f\327\311\021\0265T\253\037\326\232\200\376\200~\335\217\336_>\007\3604V\306B\221.\301h7\3434k\214\322m\265iG,\331D\356$\003\221"
+	.string	"\212"
+	.string	"\232"
+	.string	"M\277$5\r!vw\203\327\245P\276\366\214\f<\224\363P5\250\200.\312\001\211P\276\n\240\247\273wr\337\371\237\215\017\350N\032V\351\006:\330\005\345\353\002\277C\276\226'@\276\356\271;<\200\243o\021\232zFR[\335\035\343\245\237\257#\323s\357\3629\332\222\323\262\342\335^]>\301\033\030FiY\361z|\034\031\020\255\260\331\331adg\362\212(\303x8\306\236\356~\325\251\016^\216R\227Ow/\335\361x|\311\357\256lwI\354\262V:&\271]\361*\262\262\273%\354\251\034k\266/\362\272-\200\350w@\344\353\371o\216\260<\375p\264\270\013\314QV\332\375\330\234\024\340E\027\366\242\253\363\337o\036\352\177}\352\233s\252o\231C\2672\335\321E\227K\272\324E\367\005"
+	.string	"\240\t\362~T\354\336Q\204\323Y\365\312\221O\375T\373)\017\356\232k\273\325B8\322\342\324\335\346\353\256m\327|\375\245\274jM\252\241\347@\322\304D\354\006^(\037\345R\347\247f\274y\004\334\345\347Re\276[\203\373\017\251\3030\346\021\352z\271\340\2168\227\237\325\341\007\257@\307/L\317\367\333\2419<r\345\335\022&\350w\333\243\343\333\356\267\300"
+	.string	"\260\333=q-(\262\270H\021+S\304\006\371Z\371;\037/\036\231\024\362\303\313.\026\237\023\323X2\363\215\250./ff)\24388Z<\355\356\033\263\322\326 _\314\267+\"Qg\212\350\233]\254\353\200\250\t\322k\241X\344R\324\215S@9\207\351\225.I\2162,\352\007\226\216xN"
+	.ascii	"\025\3442\262d*&B6\240!\031D!\210dA\263!\031\263\332\206\002"
+	.ascii	"B\031H\032\035X\304xQ\177^+{@\253\021\265\210\331j4[\320\314"
+	.ascii	"\026\013\002Z\001#&\253\331b\017x\226\026cV\213\t\321h\265\230"
+	.ascii	"\t\304\275\352\345\224\222,7D\034\347*+\375lB>\035\315\331\204"
+	.ascii	"\227\206Ng\314p\233\341\023R=}'s>\341%\341\326\0301\013~iz>$"
+	.ascii	"\253\013\030\216\340v\205\244\347\244\033\367\335\203\253\341"
+	.ascii	"`8\360\222\320I\305\277x\250\300\324\335\023^\037\334\017\317"
+	.ascii	"\002a.I\263\345\305E\212\025!E\370\204\244\303\001\230Gh\024"
+	.ascii	"\007\026I\250Q(E\224RH)2$\201\310\204!\3151p\002\231*\273\r\021"
+	.ascii	"\360=\253\tTr;\212%\3333\211\305\213\306\314N\032\236\234CG\356"
+	.ascii	"\370^\331\265\374\255\264\220\301\242\243\357\237\353\007F\230"
+	.ascii	"&\210\006m\203P9\026\302'\030\266g\265V\022\215\020l\210\366"
+	.ascii	"\360\221O\251\346\354m<\304U\217\005\3611%\242\324\216\262\312"
+	.ascii	"0\027\002\b\177\301l~\370\364\215E\205\005\301s\367#$\346\020"
+	.ascii	"\233\374\"P\243\302\305\264\351\370\324\225\002y5\320\036\306"
+	.ascii	"\336\216\213\001!2M\360\203\302\003;\347d\313\304\033\023\250"
+	.text
+	.section	.gnu.lto_gyroInitSensorFilters.66.ad036f5f17281be5,"e",@progbits
+	.string	"(\265/\375`d\002\275\020"
+	.string	"\026_lF\340\262(\035\322\216\204v(tq\031\225f\207\203\344\036}5\017)\021"
+	.string	"A5!&\2009\n\030\3135\323\034\210\0132NU\261\374\362\030 P\036M\243\002\302W\217\034\007d\001\035\242f\331\376\267\222O6\2212\245W"
+	.string	"O"
+	.string	"Z"
+	.string	"6\\>\274|\004\220]\227\037\237\315\2115P\214l?\355\313|\306u\231\312\003\354\306vnvg$>\300=z\366\001\333#w\001\333\243]\366\017\021\226}%P!\323B#dw;5q\327\323\345\277\305C\341\313\353\tR\260\273\316\360\005\304\255\267m\3006\002[3=\262\247l\266\367\027)\334\356\232\370.0\200"
+	.ascii	"|\234x\364U\266\307\020\t\233X\214\f\017,\177\354\331Jj\t\373"
+	.ascii	"\332\356\2565f_\366\2374m\212\351\222\226&iz\224i\221\246C\231"
+	.ascii	"\346\2644H\323[\246\243\246\265L\253\2463\323'\260\n \325.aC"
+	.ascii	"M\310\207\326V\204\276\354\323\340\220\241M\3417\025\036_\003"
+	.ascii	"\322\207!"
+	.string	"\242n\026nS\023\365:;\252\332\205\317\220\241\212Ja\343\0233#;e\352I\355\223T>\364\b\213\276|M%i\031b\325c\254\270]\017&>\315a\2408\003+\037\262\266\307\353\203\300\364\b\237\007\266T(\221S%\336\327a\325\201\237\007\266T`\327B9au\251\017\354J\n\330\323\240\372\272\r\236\367u\243\031\354\332j\314\234\016N\016LW<\222\246\005\fJjjp\036\016rJz\031\fOOHGJ\322\270\343\301u\220D:\202\360\0348D\234\206\"\374\006\016\247\242\0250<,DR\323M\003/ \020\003\0211\335\330\211\">\036M\212\206\240\3576\332\305\331\271`\344\356\232\177m\243^o\200\003>$\337\210\035\306=\333.\001i\004\226\024F,\275\317\214i8l\201\301H\013\343\036\266k+u&\306=j\273\f\222\343\0176\316\005\350\336\2234:\336\267\327\022\340\304\36064\353)"
+	.ascii	"//ZO\006"
+	.text
+	.section	.gnu.lto_gyroInitFilters.67.ad036f5f17281be5,"e",@progbits
+	.string	"(\265/\375 \372\275\006"
+	.string	"\362L/4`M\222\016"
+	.string	"->\2262\342\002\312\241{\2512\221\251 P\370\272\362B\337\266\265\336\243c\302G\237\266<\004A@\245P"
+	.string	"*\033\024\327\005v\270!Bd\ns60N\tO\212P\362t\244\347Q@Xx\234(\275M\301\220\241\023_\003\204\361e\260\254\003aB&\331\307I|i\005)6a2?\265nHE\034.G\243\037\246V\253\321\235.\215\036\"\242\325Z\023*\311&\\\365X\325\\\306\027 \035\350\335\300\312\311\325\213\224\314\212\026\226\314\"\222\216\277\231\251G)\266\221\004\036'\024#*\231\371\234F\2516\352\366\243\002\326U\265\005\034d\346\315\272,\272\353o\360k~\214\b"
+	.ascii	"3\001K8\023\360\370\032\327D\267\020\360\313\020\340\322-\332"
+	.ascii	"\371\004"
+	.text
+	.section	.gnu.lto_isGyroSensorCalibrationComplete.68.ad036f5f17281be5,"e",@progbits
+	.string	"(\265/\375`L"
+	.string	"5\t"
+	.string	"f\321@; \005)\035 79\300\323] K0PB\321\026`\224`\231\027\210\031\361A\273\265\275\376\031;\342\256m&C=@\224\004"
+	.string	"3Dv\230\351\346gA\204\355\254\264A6\331;\2450"
+	.string	"0"
+	.string	"/"
+	.string	"\266\335\360\200r\n\364\241\322\211X\001\340\212\331\331\355$<y\352/\345\337\345\024$\261\232\027L\365\027 \261\273~/\330\310\ro[\301\266\203\355\233\217\003\265\020\330c4\273\"\265"
+	.string	"k\023i*\266Q\366\307\366{\366Y\336\202\272\354\004\"\330\326\fdf\267c\360\202\347\321\335\r\270G\317\013\270\3074\226\347g\246\020\216]\017\263\341\331mA\274tp\034\240\244<\372'\356\3610\224#[\275\232\335\251\0364\261\277\355\356\032\226x\273\354\207\3609t\326\022iB\300#\321\244\036\026\262\322YK\244*K\027\025\030rD\253\024!xf\220\250\324\230\223\312O\267\367\006\023V\220e\337\304\035n\220\223q\005\f"
+	.ascii	"X\211\"34\030q\r\307\2622\343b>\306t\325\263\214\313(<\215\207"
+	.ascii	"\352\020\306tM2"
+	.text
+	.section	.gnu.lto_isGyroCalibrationComplete.69.ad036f5f17281be5,"e",@progbits
+	.string	"(\265/\375`I"
+	.string	"\375\b"
+	.string	"\226Q@80\221\322\001\203\"q\357&a\301z\251\326\2100E\216\362\021c\312\251R\252o\336\331L\377JT\r\214l?~\26200p\332\340\350\334\305\031\310)F\020\372\335\344N)1"
+	.string	"-"
+	.string	"2"
+	.string	"([s\202\002\312\251\001\rUN\003J\017\353Eg\027\234Z\362\324c\312\177\354\017\336\013\246\345R=\0028\354\256c\313\345q\353m\033\330>\260}\023Jb\377\263:b;Z5:~\002D`\256\207\204\273\035!\317\322\310\231\211\355\373\262\177\247\253\230\341\303%ew\265K\373dk\227\267\0031\254\231\027C\377\363\304[H\0055\237\267\263T\b\274v3\026\300\257t>\354\322\027\246\370\326\245o\002]F\375w\204\023\031\033\020\331\267\212\241\rz1\026\2056\016#bv\334\326\225F\335,I@\220\246\210\353f\210\300\033\305\210\233\026\333\306M\r\\\335\252\217\375\034\0333\273\203\263R\317>\t\024U\025\024\n"
+	.ascii	"2\003\3020\r\314i\230Mesi\027\306\023\214\221\202\262\034\256"
+	.ascii	"e\2230\311"
+	.text
+	.section	.gnu.lto_gyroStartCalibration.74.ad036f5f17281be5,"e",@progbits
+	.string	"(\265/\375`\372\001\305\021"
+	.string	"F sG\340\262(\035R]\356\033ZH\275\035RhI\304\352\234\256\351\351z\364\356W\373\226erQ\357\235,_\301?\264\327\030\215\243O\255\242\036\327K\026'\314\240\276\007\340}`\314\221\007C\341\021\353\236\332\376\222&eJ\001["
+	.string	"Y"
+	.string	"a"
+	.string	"\246s7\331\316\264E\020\274Ns\235\256c\210\006c7<`\003\244s~\3317\036\322\354\351\306\246\305\304\320\356v\352\341\257GN\244\371\362G#%\227\331\312\243\206s\262\n)\222\001\230\261\244\232f1\321\200\335}\316\323\302\214%s4\262\273N\227Y\206{t\333+\333$v\216\004\267\347\356\256\250]Q\365\364\002\242\203\216 \033,\331\303\016c\2513\366E\2532vL\227b\232\304\245G\\:\236\366\353\3237\201\320\210\005\355\334\340h\215p/\334|\354\f\256\307\306\366}\022\267\251\274\204M\265\237\0201\264\335}\370\232\235r\035\213\300"
+	.string	"\341\354n\212\255b\007\016\036\240P\265'\314\213X\020O\216T$iI/\0231R\222r?-?\242z\005\206\253\342H\023H6\"\2267\337f\223\253P\221v7\201\237\342<\236_s\316\022V\253x.\352m/0\363\021\212\311\321\201\345\315*\322\231\235_#\330~\342(\\~\215\277\223\274\313I<w%\360a\003,\003\254\317CA\201\020\274\t(\005*\226\267\002IPZ\240W\322\362NN\205|\240\212\252k\201_\213e\322\352X\036j\325\245\300V\027\002\342\217\202\t\330\241|\037\330\231B\330U\306%1\226\007\016\230\306\242\316\334\025}N\203\2211\264\343\341\356r\252\317yrx\261Y)\351k^\360\236\224"
+	.string	"\232\232\031\334E\203"
+	.ascii	"B,\336\"- `\002)U\271\003\343\200\333C0\030\270\027wLmn\335\004"
+	.ascii	"\361R\244D\273\321B\322\303\315'\033\360\026)\213\261\222\245"
+	.ascii	"j\002nK\310d\320\"\225\255v\234w\023\200v\004\216\242\370Q.\216"
+	.ascii	"\337\250b\\\334Bp&*\007\261\023\210_E\221\205\343\330\322dIH"
+	.ascii	"\026\273\244\001\023\024\327\313\242\312S\313[5\275\t\252\f"
+	.text
+	.section	.gnu.lto_isFirstArmingGyroCalibrationRunning.75.ad036f5f17281be5,"e",@progbits
+	.string	"(\265/\375`\006\001\305\f"
+	.string	"V\230VB\020\221\232\016\033\202\205\375\362\002\t4\271\\\346\267\0136\036\351\310j\352|\367\016!R8\312\361N\267%\246?\376C\211\213\242\3417\"*E"
+	.string	""
+	.string	"\nd\222N]O\200\306\251"
+	.string	"\364-\264do)S\nE"
+	.string	"B"
+	.string	"G"
+	.string	"\366d\004\tH\234\375S9\001\260b\242$\206\306\356G\351\206g\217P3\3635\035\0134t3!\356\363\310a\341p\342&\244n\270\rrv\367,O\023\016\224\251\351\330]g\210\253pK\267\315\3006\001\373\022\002\361\272\341pA\313\221\375\201RS\354\303U\221\355t\214i\b\323\227\264\203\261\255\234\320\231oOF6vE\224\351`\373\276\313\275\221\277XaRd@i\021y\213/\203\241\005\210G{\304\236\036o\223\004O\025\024>|d\260\270g\317KT\003\\x\3668\211\217"
+	.string	"*\273\233\202\230\217p\340w\217\006\261,\351\021\352\275\027\360\200\"\006\212\313K\356\356G\235I\327\234!\342\305\2265\354\303<D\346w\206\200\345C\217>&=\366t\254K\304\203\302.\013\013\2510*\344\243\001\b\345\2710\252#\300\326\203\352\242\"X\326EM\237v\270*rB\003O=\360T\023\333Q9\232\202\234\032\365%7\264\034IQS\374+TQ%A=K\027"
+	.ascii	"K\204\236\337\206\2073e \fn\244:C;0%\331\204$\301y\001\225\020"
+	.ascii	"q\377\206P\\\023\213L\374s\341\246\nh&O\021\333\022\256=\254"
+	.ascii	"\360\251j 5OoW)\003"
+	.text
+	.section	.gnu.lto_performGyroCalibration.76.ad036f5f17281be5,"e",@progbits
+	.string	"(\265/\375`\235\f\325A"
+	.string	"\372o\274\03090\350M\0070~x{\363<#\345\220\016\025\b\351\\\324\205zr\236\231\006\254]\233`\224\243:^"
+	.ascii	",g\334\264MA\367\r|h+\307:\321A\266FBv\267\224R\nz\001b\001\177"
+	.ascii	"\001\034\303m0\220\214\231%\324\307\353\337\333\235=n\276AD\020"
+	.ascii	",\241m\235\021\316L\240\234@\033D?\035\310H\003b"
+	.string	"6\020\037\251\247\234?\035e\263\336\343\001\230\f\2311\033af\371\354\261\007\267Pn\272\016\367\036n<\235\347\266\036\356\353\226\255m'\201w~\232\332\266\235\320*\213\021[E l\254U\257\355 \351:\214\341\255\017\333*3\022f\266U\225uf\f^\267\241K\372\330*\037M\321\320\316\334r\032\357v^\223F\266m\\%@m\013\255\300\021\210\2552\264\265\326V\211\215\265\266\312\227\031P@Z{\246\341.\252v'\260m\333\256\027\303\337Bh\263\321oga]!\217V\306**\2668E\034\256\252\360\375r\027\235g\235\205E\327Wtd\034i\2676\206\214\037\035\255\321\321\231s+\341\261\213\320B\333\266J7\206a{v\025\227\246\022^\210z)\325F4\213\224m\267\266\305\331\341W\334\335\340&0lu]\024\202\300s3\346\353\344)\324vkn>\345h\355M\210\240m[\2735-NL"
+	.ascii	"\206\255\255\207B\t\317?+\355h\255M\250\325\b\356\022\353T\363"
+	.ascii	"\265\371:\201\2435.\275\247\035\212\223\351\352\225\026\n3\244"
+	.ascii	"\005n1:\323\204T\242\324 \261\316\245\177\357\351\031w~\233\300"
+	.ascii	"\260=\333\207_m\333\2627\235l\315Z\315\334\227\231q0\263v\001"
+	.ascii	"\r\030\304\330\304t\333xq\270o\372\322\215\323e\211A\377\020"
+	.ascii	"\256L\246&\226\t\315\314,\232\322\305\243\300\201\371\316i)\230"
+	.ascii	"\203\271\022=)L\322\205\203\"\200\264\256\311\332j\347\271\001"
+	.ascii	"\272\361\304~\376\314\030\022\276\034C\370\005\277E\n\233F\235"
+	.ascii	"\036QZ\272(N\261r=\204o\246]\206\347z\265Om\320\353\371\317Z"
+	.ascii	"\267X3\274'b\302Q\006\342\025\355\250\005\261m\333\r\334\214"
+	.ascii	"\272\321\013\206!\303\273)cm\325\353;P?p\362I;\312b\255\210\006"
+	.ascii	"\261m\227\033\270\023]85\270\353Zm4}cmu\301w\264\037\244\341"
+	.ascii	"#\365\304\313C\363\351\267m{\366/\307\fUz7\232s\357\311\037\307"
+	.ascii	"\214t&\201t\006C:\177\035\235G\034\235E \235C "
+	.string	"\235A\034\235?\034\235= \235;p`\2357\034\235\275\216\316\031\032\332\215\241\0075[@:s!\235! \235\027t^\267\202\326\323\274\205t\026\200t\016pt\006`\345\254et\316b\235\261X\347\253\2423\222u>\276\263\325;\033\337\271\212u\246zg\266\350\\\254r\236\242r&N9\017Y\347\365\235\325w\026\026\235\377\235}\312\271M<\034>\313;C?\t\332R\231\222j\031\251\202\316\364\240n=\210\0161K\247\017\215\241\366#\353\276\312Iy\006\277\036l\304\177\211\030A\210W\370\027/\"\276\t\371\363\342\365\037\251s\001\353>[DT\t\325\004\372\233{\342\t\342\263\007\351\r\033\342\333\217\305\334-\205\001?.\341Z\302\254\244\354\327\356FH\371h\217\023\244\006\361!><\b\017\337\217\372\003\"^\341Y\034\213\207oD\356\334\353R\264\360T\377d\364\376\330\247\372fj\302\360\354\017#9"
+	.string	"\314R7\365r\274d\305\360\352Y\241Nz\225\226.\212X\344\362*\027\316K\312\356t\266\253\306\367\311\205\002e\235\372\342\017\375\250\rvp\013T\256s\355\346\324\267\240\227\345\2375C\225=\200\215\033K\303^\262\022\277\303\350y\024\227\262\204\273\216o\225{\305\273y\257\254\255\022?\211\033)\3016\r>\324r\337\274\233\026\276\371:\013\220\245E\214\226\177\266\322X;\304\241\323|X\314\235t\370\346\263\346\211\227w\301\327\037v\271_\322<-\b\225/o\033.\251+o\034\nRG307\374nbA[\177\20533\211\251I}o\247\203aZMN\302\367W_M\304|\376\013\277\325\006I]\270\376#\327\243\256\230\266#\025\005b\356\277\377\214\021\024x\361\034\204\002c"
+	.string	"*L\313\277\333\334>\t\nR_.\312\314\276\240\023G)H\3074\247K\307\340\226\351M\367L"
+	.string	"@n\231\002\003\037x?\363Us\357\274\233\214`\371g\314\001G\306x\360(b\266\232\375H\222C\310\003\b\231\017\263\2612\0373\204\220\375(\222\243L\307\017 9J\024\0212\026d\354\bY\013\0042\212\274\203\213\254LI\217.\263223!cf]B~\344\b\322\265\243\314\254\213k"
+	.string	"\223\r\031+\353*BFV\326\305B\321\372\343\370\013\355\225^\262\004\274^\235\260\254\237N;\305\032\340\005|\005\346S)\346sR\034\310\013\313\n\360L\336\242\202y\215\345\302\273\223\221&%)I\001\337`\265\201B\350\n\302\n\340}P\317j:\3154m\b\253\326\003\370\255Djm*\2349\211)\231\311\273\251\365]\310\213\362\317\220;\326\254/\323\253t\347lv$7%;%;\255\255f\275\2077?\202ma\256\325\311P+sR09\252\365"
+	.ascii	"\336my\242\242\347\370\244I|\323io\223\"\351\213\035\026\363"
+	.ascii	"4$\276\355\264\325\313\361T\245*\016\377\225|Bo=\224\n\275\365"
+	.ascii	"\rJh\244\320[\317\341{O\313\320+\023\365R\200w\215\252\260^\214"
+	.ascii	"\237\341h\0053\227\256A\231\002\033\376\370X\277\3661\321(\243"
+	.ascii	"\rg\251\016\264e\0361\235zZ\266-\332\202\253\337\360\004\022"
+	.ascii	"1\355\220\177\365\353'\246&N\226r2\311\251\317\371\230{\246\274"
+	.ascii	"iik\253\310_\355\336\360\274\311;\226\002\025G\325\334\267n\275"
+	.ascii	"z\366wF\217\322\361]\316\343.\035\2039\207\273g\254\376\370\353"
+	.ascii	"\035\246&\343W\275\325\017\210\004\366\306\023\177ow\002\201"
+	.ascii	"\001\250a(\346\030c\250dd$I\n\ni\f1\005\304\030G%K\017\021\220"
+	.ascii	"\261CV$M\2065\346x\247\213q_\016U\237\024\233$\2124=\\\025?\210"
+	.ascii	"\\\377\365\307"
+	.string	"E\305\255\324\214\231S\213|\227\3004\346\2609\244r\007\270dXk2;V\216\206\\\263B{Ug|\363h\374\231p\021Zn\026\355Mt\240\252\030\312Hp\325\237(\300\335(\"\370Vd\263^B\361\021\305\2711\334\201\372Rn8N\341\351\023\376_.m\022\331\300\275\330\353\3542\230\210\233\321\034\031\351\200\265@\266\232\320\230f\345n\">D\037=\321\3042\004'\241T\362#<\t?\r\224\021\3744R\266\205\002T\316<\266\232X\244\2411\021\247\277\256u\262\021\003\020\331\023\005\002o\365\\\313\2256\324n\002\316bn*\024I\305\2122\330Z\362\272C*{F\340\344$\252\277\267\377Y\347\316\3065\302\330\314\310R-\024\372\003nS\301\034\363q\017\216\017\031\003\023RDnt\270\272\305[]cm\311\241\306K!\351\321j\027\276\223=p\2212\301\244v\206\303{\201\220\250\211$\374\316)"
+	.ascii	"6\271\320\275\304\245\f\246\2042\332\277MH4\343\354\004\203\b"
+	.ascii	"\363\f\201\220q\371\210\226\203\305\356\0073\246\274\323+\244"
+	.ascii	"1\204\001\233'\242\ro\364\320(\377<hV\013\302&\004\031<,W\317"
+	.ascii	"B\024N(\347j\321z\324\217)`\005\317\025\366c\304\255\341\306"
+	.ascii	"\236\2153\03745"
+	.ascii	"\355\230\324\322\243\224\227X\036\327\352\001\035\r\310\220\211"
+	.ascii	"B\226<\376K\304\311+\r&\006^\230\203`e\265\300\031E\205\272\213"
+	.ascii	"B,0\004_\214\320\001\340Y\220\022m*\212\332\200\370\027oLZ\200"
+	.ascii	"M6@\222\237\002`\205\200\177\314U\310B!mm\025n\346\177\be\\\310"
+	.ascii	"\204\263\330\035/\263\360\306G\336\001\220\022$\226\326HJ\310"
+	.ascii	")\236\262\244\364M\236L\005"
+	.text
+	.section	.gnu.lto_checkForOverflow.77.ad036f5f17281be5,"e",@progbits
+	.string	"(\265/\375`\177\004\205\034"
+	.string	"\326\362\261G\240\332I:\204\266\317"
+	.string	"^\245\371\r\257\221<*l\275\3610\030\370\203\353\021o\037\3415\271\344\373\277!\217o\177TG\373FE\350\247\003\243\222\002\236\034\237\234\235\023U;\254A\314\216\336f\250\241F\310\336D\312$\003\230"
+	.string	"\221"
+	.string	"\235"
+	.ascii	")\336O\275T\200P\201\221uw\203K\245\240E\252\265\313\327Tu{'"
+	.ascii	"\202\364\"F\037\200^\302\301\002Bx\311\363}U_u+\244_\251x\200"
+	.ascii	"\356\034_]\335\275\007\312 \274\324\336u\346ex\234y\251H\252"
+	.ascii	"\\vVt\022\004\252-\246#b\272\333\306:\216tZ\bN\371\361\"\351"
+	.ascii	"A\037Z\223S\322i\240O\230\340\306\023\324A(\246\235\274\2255"
+	.ascii	"\247\025\373\315\320ZZ\256\022\003\352\343\351\356c}[8)\355\202"
+	.ascii	">\335\255\333\344\364t\235\271\252N\251\352\t\325\217C\257\320"
+	.ascii	"#\212\213\331vw\022\237h\236A`iY\3321\252J\342K\210\302\356\216"
+	.ascii	"\240W\302\001\027\356P1/\317\322G\030Y\r\253\253\335\236\251"
+	.ascii	"\366\224\226\245T\3775\347P\005Ww\302U\235\027\371s\236u\305"
+	.ascii	"\371\325/ \\\275\231\2536\340j\r\270J3Wksu\006\\\245\201\253"
+	.ascii	"\341\\\005\347\352\004W%\270\372\315U\236\253+WO`l\002\343\205"
+	.ascii	"\323\253\302t\3038#\323b\322\213\307\263~\325\353\217<I\321\221"
+	.ascii	"\350OT\331\215\350\265\264\246Y\001\323\206\217j\330\206\345"
+	.ascii	"\026\r\327\324\230\206\027\354_\237\022\006\266W"
+	.string	"'\363\262\366e\210\366\272[\316\360\021\215gXn\205L\0039\344\005{p)\312\265`*\212\007\003cP@\376\214\250.f^\377XJqx\362\210\365%y\362\207\205G\366\261\344\363\3040\177\3742^\330n\317\034\374\211r!\030\353n\t\252\035\356\304\303\200)&o\362A\025\350\266o\272\315K\346\243\250.C\274v\\\337\262\324\335z`\251{\247`\031\207w\013\357\207\222\212\357R\256/\231R\021\347\n\272\2340\266|\255:\242G\304\005\r\331\204r8\\\356F@\034\002\372\031\022u\342O\212\\\211\020\243\210\302\202\216.\203\210\013\3020$$\216#\321\255\346\302\214\336zrc\221\b\233n\314\351\204D\235M(\b\bg\273\215:[O\001\315\231\020G\333P.7\332j\275\335\261\036j\311\260aF\266c%Z\016g1\032PK\232\"V\303\212\206Xw\207,\265\365+D\006^\025\005F\310\027"
+	.string	"\335\r2\257\353\032\346\016O\271\030C\305\213\2250\035\336\341\2352\2462\273=\323\033\316a\035~\222\177A\260\364\250\230\262z(m8\025\243\234\261\b7\374\023Ufv\305\323\335\001^\250Q4\306\b\203\216\211\210\024$)I\213\001\220\002\231\2313n\020XUR\224\2441\232kbJ\257\025\354Q\341O\3678,\212\037\353\311e\007H+\330\237W\0055tE;Hf;&\307\367X\003f\025\233uk\310\216`N\314\363/H\224\313x+\306\277\n\f\037\032\266\374\215N\276=\002je!"
+	.ascii	"\034\020\030\220\206*\366{\020#\304\202\005-7.\377\346\302G\335"
+	.ascii	"#BJ\007E\361\215\265\301\032J\020\315\242Z\334H\350\034\242\207"
+	.ascii	"\004CV\346\235\272\036h\030\334\257\264\307l\235\243\353\267"
+	.ascii	"~*\"\215\025\327\220\022\247\004\205\231\2409MD-(\005\322\253"
+	.ascii	"'7\267S\036\322\213\2466\324\315q\245\242Q<5"
+	.text
+	.section	.gnu.lto_gyroUpdateSensor.78.ad036f5f17281be5,"e",@progbits
+	.string	"(\265/\375`\336\034\005z"
+	.string	"\332\301"
+	.string	"+J P[\031\0166\n\254%\216\035\253#u\351\030\243 y\224\251.\035\244\204q\003\252fE\034d\215/\221\216{Ts\231\321\266\017UL>\030\036\220\375qE\363@\340\261\346\210\205\260\224\220ElzF\177\"\321do)\223\f\224\002o\002\247\002\274i\312k4\362\006\245\274\305\224\027(\345%\032y\321\307\371\236D\336\016\342\345\"\357\017\366\324\007\356\317\0065.M\347m\205r\310\303\n\007\265\363\3628?\234\237\357\327\373\335\374m\376\273\277\356W\363\233\371\317<\335\375_\t\315\265\276B\277\024n\357\f[\223o\337\027\270\346V\370f\277\247\367A\321\032g\275X\332\232Z\341\272\276mP\314;\3273\353\211\345\315\033[Z\233=\236\021.\357\0066/b\250\277\273\202\302z[\241"
+	.ascii	"a\311k\276U\200\303njW\267wfk\312\t\212G\263g\252\331\2730 8"
+	.ascii	"\274B\266&\004\3054\237\333M\227\311\321l\207\001\332)c[\327"
+	.ascii	"5e\262\233\036\005z\334\3456\335\3353 |\025[o\002\233Z\017\205"
+	.ascii	"\353\272\366(\336\206\227QoF\004('ok\024\342\037^ [s]\301\220"
+	.ascii	"GwG\361\350\327\"~{\r\352\31149\213V'XL\260*\036\205:\317\273"
+	.ascii	"g{\233z7\022n\264\256Y\364nX\3277\026+U<\272oO\"\036-\376\210"
+	.ascii	"xtW\335\275\303\264\265bY\251m\351*\323\\\327\265\252_\230\022"
+	.ascii	"\332\335~R\021\024D\342\303\366\317\267oPQ}\025\025\213)\344"
+	.ascii	"\n)\025)P\2340\341\242\004\211(\250\021\"\236\234B\200\200\321"
+	.ascii	"\304\264\244\224\204t\364\342\203Q\321\221hH(mae\f*\002\021\321"
+	.ascii	"\263Y\335\033\303\260^E\005\224\343\212X\337Y\354\375\271\341"
+	.ascii	")\275#\337|\305\233\277<\226jA\307*\360\236\202y\024L?5|B\357"
+	.ascii	"&\360\356\302o\356\204b#\310%\322\344\301\300$\320<J\356Prgx"
+	.ascii	"\204\034\r,\302\255o\006~j\273\023\333C\260\365\2551\210\266"
+	.ascii	"\3038c\370a\261c,\323\223R\207\233\334\316\224\366\24540`^X)"
+	.ascii	"\351\204\342rB\201\001\353\302Hj{[\370\b\315_\f\342)\371\303"
+	.ascii	"\331\215\264\274H\213\031\037\243\256\210\265p\242\307\001k\001"
+	.ascii	"\257\214\207N\240-(]\036\007l\356\244\341\247\320\356v,\260\020"
+	.ascii	"\331S\262\267x\326\331\255N(;'\224\\ \033\317\2428`+\234-\230"
+	.ascii	"\217\002\0036\306AwA\214\312\213L\345@*\234H\304\242\346\215"
+	.ascii	"\315\360\212\030\337\321sEa\235\016Da]g\022\224.^i\030\027\237"
+	.ascii	"Da[N\270\317\025ezR\3220\2553\311\017\213\235\313=*\016\030\037"
+	.ascii	"3P\216u]\227\275\302\304\2761\276{N\355n\222\335&\031\001\253"
+	.ascii	"\266\240Z\341{\251V\210G\227z\250\216\316\236\262\2661*>j\244"
+	.ascii	"\336U\227\352\013|\257\205Qe\213\253\020)\266\240\242"
+	.string	"M\225\231@j\224\316k\212\006}dD\327\365\347\360F\210F\255A/w\215i\361\241\026fA\205\341q\274\302\r\243&\222\221\331Qs+\3521\025\246\034\233\250\213\244p\024\026;\0165\021\243\300`\f\345\211\214\357\035\361\350\220\241P\177\261\027\233\220\266\261\205\272\230\213\267\322\2406\262`-\316b\254\2409jv\305>\\&\n.\377\243\242\2110\353!)\260\214W\036\240&v\361\213\326\016\313<\241\227\373Q\321.\307\360z@}B-vh\023\273\t\220\2530\213\017\247\336G\r\3639\263u]i\354\2522\\\007u\314\215@>2\320&~!\0034\264\333\302:>pNu\215\270\001\217=\351\342\247\347OP\355y\324\265\023\201s\253\266\035\217J\303\222\331\272:)L~\321\261<\210G7\350\317]\n\215i\347u\276K\300\357\\9\231\021\036\003?\205L\257\271\347gwgw\335\313\275\"v["
+	.string	"7\350\204\375\254\023s\357\273;F\025'\215\265\373\301\016P\004z\tZq\237\204^S\026\201\323\351!\"p\327\307\347\374(\256\353*\0030\371\005\210\222\331\026\022\210G\337\227{\212:\300\264\2626\267,>\334}\323\342^\356\236\263\320\374\341\333\316\262\373'?\341u\337w}\353Y\352\365\276#4\371\231/\223\223\371\227(\361n \304\253\301\335~#B\016\347\033\344|\337\006\356\346\013\204\201\337}\177\274\315w\201\327}}\\\315W\201\224\267G\312\233@\312\213@\312{@\312k@\312[@\312K"
+	.ascii	"\221\227G\312\273\303\310\253\003\2117G\312\213\343\310{\343"
+	.ascii	"j\276\002\f\361\3328\362\3260\362\006\200\304\013@\312K\343\310"
+	.ascii	";#\211W\306\021o\214\017\274VF^\030H\274/R^\027G\336\026\277"
+	.ascii	"\373V\031y\251\220xY\244\274SG^d\022\357\212$^)#\257\n$\336\024"
+	.ascii	")/\n#\357\211#\257\211!\336\022G^\022"
+	.string	"G\274Q\037x\241\216\274#R^\021)\357S\312\353d\304\033\242\210\027D\021oS\021/S\021\357\322\020\257\322\2217\211\210\027i\210\367H\210\327(\345-Jy\217)/\221\221w(\345\025J\003\\I\271\253\311`\005\323\255\315\305\220\324\313E\036H\367 \234\340\n}\306\002\221z\231\244#J\365\257\244\341>I:\t\224{i:\360\321kJ\265\004\312=5\267,=If\225\231\036\347\301\223\304cc\204\376\336Q2\245\036\034\0354S\216^t\226M\317\214\276\325\350\231\025\362\013,\320\354\202\037\226:o\037\026\350o\265\022\\^\0336R\221\203\032\306\306\235\024\255\242\231\356\272\376<\300(pH\336\021\357\225\242\241\2344\326\343\226YD\3217SDD\303\b\307\034O\264\240\032f\006\323\341\300d\233\244\233\344\2337\304\243Le\274\362$\3430\240\032\346r\002\345\250c\336\306\354O\315\211\276\034A;"
+	.string	"\324\302\004\211zyd\242\357\002\234=\023}\274\237M\345\235\341\230\231\237\302\033\206z\271G4\351\273\032=k\201\274\217\376\362q\007\216\217D\227\350'\373\230/\251\247H\242S|\337\264~\256\353\272\n\371\350w\365\355N\201\226\233\034~\360\327<.\3717\025\030\325\013\325[\003\220\337$\351\\,\317MT\233H\nr\233d\035!JfS\016\263I\022>\316,\231\003\337%\361<\217\222\231\266&\371\005\310~\313\007\304\243P}\034~\256Q2\r\335:\256\315\226X\332\313\026\235e\177\032f~\n\255:KR\017qD["
+	.ascii	"'\3107p]RO\222O\262O\262\017\361\350\210\236@Ig8FEt\271\237y"
+	.ascii	"\312\271f\323\330\313=\363R\203\305?\351=\201\004h\005\372K\207"
+	.ascii	"\377M&\256\rVP/\025\350?\351#8\274>\\eZ|\270\"\372q\313D\352"
+	.ascii	"2^y\236\332\251E4\020 \027\230\244!\247Y\346\327\004\242\231"
+	.ascii	"{\352\257\021t\313\342\303\344\034>\263L\031\201q*\032\225\031"
+	.ascii	"\024N\375<e\234as\035\037?+\305^.\237\310\237\371C\351B\273C"
+	.ascii	"D^\200\376\332\003\355\340%\311\036\222\207BqhU\f\013\267\032"
+	.ascii	"\353D\n{\232\304^\356\222\251\341-\207\2646\266\265fs\231%8m"
+	.ascii	"\231KX<FE#b\031X\214\252\265\245vu\021\217.!\273\223\326\254"
+	.ascii	"\301Jm\344KE\001j\253\2616\251\225\372P\030\214\032\206\226\324"
+	.ascii	"G\2549\201emn\001h\305\300\007M\201\030\"\nwQS(.oa.\252\n*\025"
+	.ascii	"\225\005\026"
+	.ascii	"\210GCt\004J\033\f\335@\234)\275\36245S\203\350s\225\231)\233"
+	.ascii	"\372R\310\016\r\307\226\264\013\207jdL\315\244\271\207\256?K"
+	.ascii	"\275\244\231\372\\_\030\013gi\262\337\022E\214\fYr\205^P\344"
+	.ascii	"\b\007I\222\350\300 \t\007\306#\277:\022\302\220\363\312\201"
+	.ascii	"!K8(2@\021\016\222t0\344j\b\003\036\003\350(^9P\244\203#B\226"
+	.ascii	"xPD\211\022&D\206\202\030\227\b\025\022%\"\030\251\272R\202\344"
+	.ascii	"\312\203\"WU\036\034\031\322A\025\021%WUT \026I\222\"J\252\226"
+	.ascii	" A\242\244*}\313z\216\254\326z_U\207\001\262\225\265\025\222"
+	.ascii	"\341\3030\303\022\376P\211p\256\353\025\0347\363B2,\376.5\210"
+	.ascii	"\374\t\275\247\211\263\205\b\231\022\322?\241\217\340"
+	.string	"\366\016\2214,\323)\320\355\203\026\037\235\036\315\266\226@\023\320=\032\335\343*\323\372\272{\256kV\t\004:\201\003\332\200F\240\317\005\206I\037\320!\366\270\n\013\350\035m@7\321q\225i\245\215\201+\240_F\213]\313\260\314b\207\351\030T\2642D\370^D\210G\t\350\217)\371\254\350\345\362h%q\215v\305\243\223(\367\030\272\355\350\366\322]\232K\023\262\331\321\377;Z\246\334\243f'\325\313M\007S4it\320\005\362A\2024\213Q\021\244\233\364\022\334\0363\205\016\274>S\303\314\320\222\243u4S\031\0349\360p\364\3138\351\235\341\203\242\273~cy\243\357w\024LI\2506\266\246-\315\354D/\227\205\220g\025\310\377o\355O\t\344O\023NR\332\322\\\234$\030\350\252\376\332:\257b\262':`\351\371+\021\025d\266\226\326\305|\361\265g\324\217>\233\027\367\254y\351b\276x\2353"
+	.string	"\244m\324h\033\215\245\006\211^\002\351g\365\363\2166\225zZt\314\204E\005\300\242\255T\001\240\003\240\001"
+	.ascii	"\215\306a\305\206\356\f\324\237\317\350\213!\233\321AXwb(k\033"
+	.ascii	"\261\367\240\3025\271.\346\323\177E\334\223\211\201\376\321_"
+	.ascii	"2\3224\225$\035\352w\347\313\230\n2Z\002\345\0345\267,\276\030"
+	.ascii	"\275V\200-%I'(,\212X\214\006K\326A\331\032J?I\3429\206\021\312"
+	.ascii	")c\263:a\345\316\226\262\266\025\321\313\035:sR\033\350\f\006"
+	.ascii	"\362\r4\320<\007n\260\356\214\007\300\247^6\320j\203\200{\323"
+	.ascii	"\307\tF^\237\240\206\021\240\277^4\214f\002t"
+	.string	"\361\"\317E?.\306\2277\207!\272E\177Ns\265\350\367\035\035S\366\031\216]\271*\347@\334\352\254\217\n\214\316BD\361\020\352\211\373\212\362\244\251\227\357([\226M\246^vk\251af\230u\026\213\246j \300)\026SS\215\003\251\327em\351\210\354\213\351\001\331\007S\356\031\216}M\223\307\211R\363+ZH\f\334\340\016I\272\257\t\364\223\f\202X\250\022\t)O\202\2201eHDF\222$Ic\022\013\020\b\342\200\034\346\264\003\022`4=\210\264\312\020\325LRPh\355,\340\236\"l\214D\034}\275-:jc\352-\030\002\345\bZ\310o1 3g\242\2019\343\205\307\326\273\340\026a(\222\321u%\257E\260/A#\327}\243C\311\272\255Z\212;d\271\036l\001\255\340\215\203\344r^g\030\205\030\334\0279\375R\b\f\332\342\223\023\022@\033\220\007\263Zw\225\315\335$b\261 \354"
+	.string	"\324\231\230\272\220\304\023\027\216L\004\3210\316\001&\246UF*\317W\344\215\005\256tr\003\352\323K\314\361cc\315\241\207\230\254\376\253.U\200\240\242\236\222B\227\2238"
+	.ascii	"\276\360UQ\215\37528X\230\030&\216\206\023\356Q[\037_N"
+	.string	"l\371\355\032x/\036f\315\303\201K\301\341\345wE\231N\214GV.\213r\022\0351G\300\261\321\",\013{\274\\\242\274/\177d\233\350\032`\343\377\342T\262zD_\221B\354:\300\344F\306\321?=x\364\377\253\006\3517\354d\375\222?\304\317\303\360m\002D2\240Q\347\242\001\304@\213\351vZrJ*\304\246\300\221\274\361\216|\0228\036|p\354k\3605\363\321\311\013\223b\002\211>5\214\340(\333\241\222\3429\336s-\334\343B0\345$\206\374S7\242lB9\372f:\225\300a\327\257\300\225W$\016\254\035\301d2\210\210\301-j\276P\337P\377\023\207\251\340DD\226\270;\030\277R\024\321~\346\251\257\005\346\212\310g\256r\226\210\320\243\037\034\255O\"\262gl\326\327\304+\311\234\f\242\311\315T4-\233\217@ \201\377O`\330\307\250y\224Jz2KS\335\020r\204\211\026\302\325"
+	.ascii	"\375O\324\267\341 \037QPHIp\026\237\017\177\244\256L(\t2P\205"
+	.ascii	"&\207 \003\177\344\nl\306[\026\366}\002\340ig\346b\230\0048\257"
+	.ascii	"\207'D8\211\260 \320$~\003\320\005\204gP\023\037\342V\b\"\240"
+	.ascii	"MC\221\323\254(5\360k\262\333yv\347\001\304\332\375\335J\261"
+	.ascii	"\n"
+	.string	"\262l [et\350\246\320v2\324X\271`\364\327\303\361)\357\275\342\220d\275\355\213\245\267SD\334\352[K6\313\231\224\306\026.R5Y\251\033rQi\352?\3636\211\221!e\007\366\261kg\344\275z\337\006\345\300\313Q\\\031y{\216\301(\301\274\016\251\210+\315\r\372\344\324\244d\200+}\321\300\237\312V4\311y0SE}U\024\035D\366&\231\013\325\371\357\366\227\326f\201v4\360\305\260\353s\220-x\362\206\274\353\005\220{g\307\366\331)2\3542\303\032\313q\3402y\204E\323\314\323S\004&s!^\205\013u\263-V\346I)\350\372\354\2235\036\327\025\\]m(\370\341\361^A\212\377'\221\304\234o\252\3727\210i\347^R\r}\256%\357>\333R=\307\333\252\350?\360f~\374h\"\013\"Y\\N-0`\005\242\255\240\252i\203\t\275\242\242\304\007\025l\305\017\035K\213"
+	.string	"\3734\201nlarQ4\320\313=P\315\363\017j\353\004a8Ya.>\2312\232\b=<+\202\253Q\004\322\331c*\272\323\036]\303\253hv\377\002\033$\231\276\362\201'U\f\001;F\352\333.a\244\3026H\277\255\254_\224\030\223\006\270\226\036\thc\215\250@`\330\265\206\314\026\030\335\331\203\315\025\240\247\2302\030\262Y\032\210y\254S\2520\366H\220\256\323O@5\177Z\"\277i\031:\256\243GeA\325\363\032\327\226\027(M\n\005\304\017\034\203\3327lc\016\256!\315`\245\355a$D;\026\221\031|!\n\364j3\302\320\n\b\320\301"
+	.string	"\270\352\315\007\030\252\304eF\355N\356\001\304(b&%c6\037/\261\021\\&\351\331B\256\314\236\354\217\327f\344\343\203h[\204\306\346\233\355\311\217\232S<\311U9\215Pj\202\345\006\273\343"
+	.string	"\034$\240m\215\224\177\220\326\244\0068r\311\224,\247\244N\257\324\225\201>\361\356\276\217\37227-\t\311\225^\2058\234\203Y4\236\2110\201\004\212\302\260\225\266\023\302\004\023"
+	.ascii	"\344\223\212\022\355\037\\\314\351\2137\262t_s\330-<4\225\331"
+	.ascii	"\016\001"
+	.text
+	.section	.gnu.lto_gyroUpdate.79.ad036f5f17281be5,"e",@progbits
+	.string	"(\265/\375`8"
+	.string	"\255\b"
+	.string	"\326P>:P\305&\035"
+	.string	"\t\343c\324qj#2\002\003R\203\"]\3160\250\251\316\327K\241Fp\321\2227{/\322\242\003\301\331>3o\272\367\331\372\\\337C\031\2737\265\266\311\336)\005,"
+	.string	"/"
+	.string	","
+	.string	"\037\270\\\232\263[\376y\254\001\tuq\002`wg\3548w\310\371\037y\306\023u\207\230\206\3355\364D\032w\274m\004\333\f\266U\002\3538\262_\372a%\220\302\020\235ee7#\025`M2\005Dc\373\320~\310E\270\227(\234\331\335 \241\354~\013V\260.\017Np\271\254\002\241Xa\f\204\361\337M6k7t\317'yI\365?.\375\331\340\275K\177\003M\300{N8\235L\026\261\263\277\016F\016\373\325\356\006\365\001\353p\034<\031F\351\347\n\360\265\321((bV\252\325\f\2533\343@t\346E\353\334\024X\223\300\350\364h\032\235\232o_m\034\331:\241L\001\t"
+	.ascii	"2\241\257/\260\361(\363p\301\301\220K\260\304j\n\270\313\213"
+	.ascii	"v\222\001"
+	.text
+	.section	.gnu.lto_gyroGetAccumulationAverage.80.ad036f5f17281be5,"e",@progbits
+	.string	"(\265/\375`\363\002\275\026"
+	.string	"\246,\225G\300\026U:4Of\327b\267|\"1\303)\364\026X>\223a\r\216\"P\021\331\226\r[\306\267\001\022\035\375\367o\310\372Q\017\210{\017\202 \b\202\262\325\273\375,M\331\\KAAY\364\222\277>\371do)S\n\200"
+	.string	"x"
+	.string	"\204"
+	.string	"6\215=\262\255j_\306s4\337q\320Is\342\360r\314\031\302\330\005\274t\370\322w\t~\345\273d\320\200\306\257\207\270\233"
+	.string	"1\242\324\354\230\314\031\232V\205\3671\274\343k_\017}2.\250/\277\006{H\304\277PL\334\261\375\020)b\243&\3422\002\350\020\027\364\\mj2\215)-B|\301\020\007Uj\263\3302\347<\317\013\270\3700B5\0243\347\264\322j n\321m\227\260\r\301\336Q\247]\372\256\357\362{\236\273\fYr\302\226\033\021\323\236\035\302to\366u\316\t\363\342\330\245\357\374$\253G\337\335)\327\335\242\250\006U\035\222\352O\252eTG\2537\252u\325g!\300\223\021\351\211\321\333\"\341\274\351=\231B\344\016\026\337\375\272\253}\2378\201fDq\004H\206\316C\277\307#\177\306i\320\\g\037\237 \346=\340r\264$s\316\227K?"
+	.string	"/[\242\006{\263\235\340\242--\213\316\310\217\231M\3063\320\303<\0048\036\207a\363\321a\002\256\257\243\202y\007p9\276\203\240\320\224\304V\027\004\362-iC\373\331\213x\007\371\344~\373\231\013\231\366,Z\271qW\023\345\033W"
+	.string	"\224Y\222\230\366(<\310<p\316\351\300\277q\034*?\347\322\023V\253}\317#|\260\355\232\354\210io\035\302\276\2737\377\007\027\307\254\357+A\207\204\203:\261\017\364\032,?\307\026\\\032.\225\206SL\311\234Z\251\f\020fX\252\013'\n\030V\030P\250\323\212Q\nX\255\r2&W\213\345\232I\271L3\252\323\312\204j\271L\n\006\230U!\3252]`\261Z&\207\363\372\370-\370$w\363\303\223\377\353\033\215\3261\261\225YC>\027\341r$jx\372\362\224\265\261U\224\264vJFO\333\215\013\373\2677\033\377q\236K\023\266\037\235%\227{\363h\305\226V\256"
+	.ascii	"_.Z\033\230\213VS\334!\354q\3169c8 \220\002!\252\332\r\311\n"
+	.ascii	"-\030\253\303ES\320\003\0273\311n\346d\337L\r\251\002\r\330\326"
+	.ascii	"X|m\335\304\226\255[i\202\366\r\357\271\323b\017\304+B8 \005"
+	.ascii	"c\214l\264zs\227\270\226\360\367\302\3660\264\343\356$\013K\273"
+	.ascii	"\b#\033\354\335\310,RZ`\310=+\231\3010\b \252\007xG\030@\374"
+	.ascii	"\357\322\315\206Y,\006\361\r7\313 \300\262\206<\237\0330\336"
+	.ascii	"\336\3648\222\255}e"
+	.text
+	.section	.gnu.lto_gyroReadTemperature.81.ad036f5f17281be5,"e",@progbits
+	.string	"(\265/\375`\320"
+	.string	"\035\013"
+	.string	"v\323IA \345*\035\340\220 \226\240\302l\026\370,\304\343\230\304\206\201\024\376\300$\341\220\325\b\320]\t8\322\035\277\326Z\343\017\202J\324\277\373\b\004\020"
+	.string	""
+	.string	"\310\304\206\334@!v\336\233\346DK\310\336)\0056"
+	.string	"5"
+	.string	"8"
+	.string	"!6\004\273\033\326\224\237\376Uz\362\037\373Ai\242\376\225\274~\f,\231\234\202\271\372$r0\223\307NEL\025\245\005\026\273kZ\232$7x\333\027\266#\354c\004\345A\337\2449\370\372q2\200\205\226\242=\373D\321\212b\377\333\335um\331\247>\270\240\3622\277\003\260;\322K\2608P\300\212\355o|\262\017\374t\255\303\314\025\227\335\026\232\320\355\246^\272\220*t\265\352\337x\005p \025Es0V\200\352\221\346U\243\266[Q\236m\361\347\b\302&\337Bjp\355.\305\3544\017\377u\320%\023}\356p\304\261\364\t\311Q$E\0362\024\2012Bag$C\316\203E\016\317\030v\210\342\030n\316\375\267\265e\003\236\001\\\252\252\276\004z\331c>\b\240\303l\234\200\356\340\215\364\231\227\027"
+	.string	"3\241\267(\306\350\203\235m\357\302\032\007\342\315\302\026'\314\"\020_\250$\001F"
+	.ascii	"\337- \202\253/\354\372\203\205\227\246\265\271\210\\\260~\031"
+	.ascii	"B\\\272\251\332\231\242)("
+	.text
+	.section	.gnu.lto_gyroGetTemperature.82.ad036f5f17281be5,"e",@progbits
+	.string	"(\265/\375`\021"
+	.string	"u\007"
+	.string	"B\31636@o\222\016\230\016\340 \353\005\030:\213|\3604\017\200"
+	.string	"4\274[\232j\300Z\333\354?V]Z\013\316\355I\206\247\270\026^P\343\233\217\017\306\374|5\362\t\221){:\326\025\202\210\330ea\240\017\026A\021\017\022\321sa\261s\2605\361\271b\205e]q\223\312f\362\231~\t\333\303\370)z\222!<V\023\013\203\227\314d(\274%M]\334\217\302C\"WR\341\025\275"
+	.string	"\222\315\255>\245\271\327\361\315\3443\375n\367\004@TJU\245dn\254b\262\005\262\234\376\321o\256HGFg\234\214MS@\2354P`23\016\264@S\350J\240)|\036\315\352\262[T\035\\T+\244\222V\007\320\220\231;R\211\243\277\376\013?\347\017\t\n"
+	.ascii	"\023\013\275\263\030\276\020\237\257{f\260\3105\2747\302e!\310"
+	.ascii	"pWL\355$\003"
+	.text
+	.section	.gnu.lto_gyroRateDps.83.ad036f5f17281be5,"e",@progbits
+	.string	"(\265/\375`\300"
+	.string	"\205\013"
+	.string	"FVO? O]8#l\256\302\001\002PAg\037\330\027h\274\002\302\217\270\025\200\033\375\275\260\377\317\037\027p\240:\377\177\367\263`"
+	.string	"\240Tt+\306\234{a\350\271\304\321\214n\336\034\270\264\211\224)\005<"
+	.string	":"
+	.string	"?"
+	.string	"\220g\022\314\266\177\341)\220C"
+	.string	"\032\210\302\t\206\024i\265bw\271\214sh\317\362\033\3323\245\360\3203\344_\303\t\214\\*\304R\370\334\006\354\256S,A\270\365\266?lS\354w\001c\230:\301>\266*\301\333\307_\303\322\230\246U\323\251\351C0P(Jw\245\330}\360b\261%\262\026\3126\310\216\330\316\264\257z\006\320G\217\360\305n\004\013\"v\227\342"
+	.string	"\001$F\335C\230u\261\330\230\203\310XL\036\376A\263\341\344E\216^N*\373{\007\263&\246\335\025`w\276\362:N\354\256e\3039 \360+<3\370\311\213\317\374\217\366\354:9\265D\371\262\003\340FA\207\031S\361\276\005\032\016\374<\320\223\0019\317\246\353p\230\017\344*\036\366\016d>.\201\347}\\d\334{S\211HG\306t\323\223Zh\244\252]\300\200v\021S\t\003\r\235zU\275\t\007\001\023"
+	.ascii	"2\003\302\260K\273\232\307,\003\241!X\022^\016\002\252Scd\263"
+	.ascii	"\\\020z\314\346\".\214.c\215[Mw`\214\200&\214\224\024\3235\311"
+	.text
+	.section	.gnu.lto_gyroOverflowDetected.84.ad036f5f17281be5,"e",@progbits
+	.string	"(\265/\375 \364\305\006"
+	.string	"\342\214/5@o\222\016\230\016\023\310\364\343>\220[\017c\365g\020\3453\315NL\210\342\377\315\376c\325)\301\236iO2<\306\267\002\207w\3558,\356\024\201\332\006!2\005c.0n\"^\025a\245\311TO#\0011\3610\261z\227\203!E&\276\n\b\343\243\262\254\013\355\020>\016\343\267(\2115\220\231\rW\324\321\305\005\351\364\206\323zu\272\234\200N\315\021\214>\255\364\231\247\271\216/@\272\320\337n\256@D\003+\t%\023TjI\225\351$\344\357<\365\002Cg\253\331\007\310@d\222Q\302\222\231=\347Q\253\315\272\035\351\303\n)\345\302<m\002\016\231y\273\260\215\356\372'\374\n?G\b"
+	.string	"\004\013\330\210!\005\205"
+	.ascii	"]\303\013#\334\022\202\204;gj\347\023"
+	.text
+	.section	.gnu.lto_gyroAbsRateDps.85.ad036f5f17281be5,"e",@progbits
+	.string	"(\265/\375`g"
+	.string	"\245\t"
+	.string	"\326RC;0\345(\035\200\223\201\212{\257D\301\233\213Q*\007\225\314\003gz\304\025\3028\365\334Y\253\277\004I#\210\301\364\360z5\024\312\210$\252\220\237\237\220\025\024\324\354?#\233H\231R3"
+	.string	"1"
+	.string	"1"
+	.string	"'\243<\031\252\224'\306\242!\243\355\206]\301\017\270\307\274\001\367\250\037G=Q\376O\376\260\022\260\322r\245\236\002\016\273\353l\2718n\275m\005\333\037\373\232\233\246S\323\347\bD`\256\007\250\355n\324\006lL\234\205\330>\331\033\333\231\366Knrz\350\027\017\354v\304\\v\367\343\005\315cg\263\355\217\234$\266\305U\334\302\231\331\335\006\333\273l\002\001dw\031P\236\002\372\260GW\230\362\255G\337\304=^9"
+	.string	"f\252\254\331a*\325\303\376\266\372r|\370\007 \351\"\264Y\004\362>\f\210\016\374<\2604\002\273\022)\024\321\211>\260\003%\330\223\030}\035\205\347}\335&\334o\253\257\250\035\225\256\234\032\365,\230k\352eX\264\r"
+	.ascii	"2\241\031h`DC5\021\274 \334\230MK\\\023M&\032\247\006\351\300"
+	.ascii	"\004\001'\214T+&a\222\001"
+	.text
+	.section	.gnu.lto_gyroGetAccumulationAverage.part.0.139.ad036f5f17281be5,"e",@progbits
+	.string	"(\265/\375`$\002\345\021"
+	.string	"V#vE"
+	.string	"\317&\035k\\\355l=$\353\r\002}5#x\032\205\237$\342F\215w\030\301\3677\260VR\231`\351`\254\221\376\312\270\217\\[\253\364\377\377\357\026t%A\276\334\227\212V\257z:\253\260%{o)S\nb"
+	.string	"c"
+	.string	"["
+	.string	"\243Cw7\020\017G/\305C\3736\366\370`\275<>Zv\275\243\201)`\023\203\302\316\320n\307\035*\007\353_wk\272\016\237ft\371\351\002K9\334@r\376pb?2A)`\027\376\336\200\335\r"
+	.ascii	"cy\016v\367\264\347\013L%\025\300\007\013\317\322\343\006\262"
+	.ascii	"\273\036a\270\267\333F\261\035b\247)E06\003T\341\341\263\337"
+	.ascii	"\347i\337\367\241\365\364\274\235\355\223\021\232\221\020\361"
+	.ascii	"\331u|\024&\361\260\254\301\322-\354\225\343\363\370&\276\323"
+	.ascii	"\372\t\257\370\306\354+\320\334\270\274\330\335\215C?\030\035"
+	.ascii	"j\274\364sX6\311n\331\244\303|\307B\320m\314\313\232\366o\216"
+	.ascii	"\323z\t\377<cw\246\006\264\333q\034\232A\273\253*\263\335\340"
+	.string	"\327\250\007t\204j-1\327\024\370@&\256\371\035|\377\304\303\005-\206\364)\324\267\204x7\213\230\252\372\026\020+Y\344k\352i\207\257\030m%\210'\206J\026Y\257\273\233\222*\263\306\177u\306vz\213\232\206\357\376\367\322\372\322y\237\373\244w\023\023\020\333\205\t\253\021\t\246\207\0221\251P(!%\251\021\023\023\204\023\222\223\323\311T\362\251#\245\232 \302\255T\251U\tj\305\225\214\230H\270\223j\305u$p*\002J\305\231\244R*\216\364\257\316\020x\276+n\233\032DEW\240\312\374\214!\242\0210\261\331\252\006\353\377TfX\0237N\252\311\250\327\027\333\346\37057\350\270`I\"\353\337\006* `\202A\350L\033\n\022\343Q\201\217\302\004]\343I\204\335\242\352:\266k4oq\247/~\264\372F8bt\032\2342\001\016\214A~_)\217\222\363\330vl\226\336eu\005\nB\302\007"
+	.string	"\213\357.\355\275\370\254I\256\036\272\230"
+	.ascii	"\225a5l\267\320h\\\300\016J\023\347\031\244\271\367\332\207\007"
+	.text
+	.section	.gnu.lto_.symbol_nodes.ad036f5f17281be5,"e",@progbits
+	.string	"(\265/\375`h\006\355\030"
+	.string	"\006\251\231H\200ZR\0071\314\301q\260$nO\275\333\025\023\320\013D\030\337]\270\326\177Y\2279\226XW\355\227\333\330\303\262\315\213\304\177\352pE\353\300:\260\236\232\203\034\337\003-\301\376\233C\200\255\240\307q\257'\335F\366N;\245\205"
+	.string	"\204"
+	.string	"\210"
+	.string	"I\346\271\341\203\032\236\3152<+\3331<\323\205?2-\374j\362"
+	.string	"\241\354-R\341\215p.\313\266e\024\276\275\314\t>\022z\"\024\200`"
+	.string	"\365\373\340\200\311\242\241\271\342\340Y\315l\360\203:\0051\340.\350\002F\262_h:\024<71\213d\235\340\227\314\246\347\242y\213\227\371&\r\323\263\225^zF\202\243\304T\222\036\251[\256\236\035\224\231q\227eo\031\3633\253\335\350\363\336{\203\317i&3\347\244\002Z\317Z\206\317[\204\317\\\262\236\277\274x\006\203\365\034\306\305\263\227\253g\267\026\317bX<\217\261z^\256x\276R\365\214E\305s\222\352yJ\337\024\317UzJE\245\204Pf\031YCa\025U\324\020\312\f5\204\222\032N\t\247\262\236\250\260~\270\333.\024E(\324s\333\211g\266\247g(&\236\237\224x>\232\367^.\022\317k#\236\235\210xf\022\342\031\r\304\263\222\017\317F\017\317I:\360\240\034>\252G\021\033\251\354\013\314\252z"
+	.ascii	"e\353\200\2251\303\252\363\224\035\244!\344-U}"
+	.string	"\267l&s|\313\222\244\372\215\261yD\274\220D\251\003\227\r\340L\215eQ\352\300\266\005\224\261qf\224\372\256m\337\0202\2675\365\232\243\324uF\244\324q\304\346\264\244\230\224`\352\275l\037\312\271\316(\204\363\334\262;\354\f\2315\0048\307\031\233\331\216\220\205\005\235\336\304f\267\260\037;~Lw\0022=\306s\024\030\317R\266\236\263\004\334m\237\353\216k\265\331%H\216\243\316\251c\273y\004<G\035\3409>\240\347\224?\033\317\031\271h\3435c\277s\327\303\367s]\333\346\361M\013\217\246\2377k\376\\\247\354\371\\\307\342\314p>o\366\3649\317\330}\357e\225z\276#.\365<\327vO\233\017$S\317\205`\300\261\366%Q\272p\250\247\226z\316 \266M\362\354mU}\313\330D\310\264\263U\365\253e\027\001\251\222fU\335\252m\237\244\230\2215`\2501\020E\322!%IQR\031\326"
+	.string	"\003\241\231q\016\021\220\220\307\220!\"\021\211H0H\346\001\216X\307\3017\340\002\341\320\037\347\373\374\227\035\210FL\033\375\236N\274eY])\031\351Q(\353\243\2369T\022Z\226\335\263\306\3365K\364\327\301\007z\323\021\016\207\022y*\207c\006\2022r\332\205\203\034\211iL\017\357u\312\342XB,\224\207\025\273\210#\205\007\333\327A\313[\032QP\213\006\336@\0340\033\360\b/\205\b\b\341\223\267E"
+	.ascii	"\b\364\274X6\267$]u\355\003\340\255\177\303\246\262f\253\265"
+	.ascii	"q4.\310\271\321U\264\335\250\007\237K\253\001"
+	.text
+	.section	.gnu.lto_.refs.ad036f5f17281be5,"e",@progbits
+	.string	"(\265/\375`\314"
+	.string	"\275\t"
+	.string	"\306\326?5`E\223tP9\261p\272If1\032\202 \b\202#\253v\024EQ\024\330\220\020a\215\307+^\377\377\377\377\361\212\337\360\332\326\272\331\266Ik\255\265F\266L\001."
+	.string	"5"
+	.string	"."
+	.string	"g\256~\271\336b\365\211\265C2D\365\r\371\233\276\245/q\035BM\322\021\b\307\372\330\243\366\005\341\355\017\376\264b\277\372\256\017\365\3337#x\006\341QN\020E \275\017\007z-\036\275\025Y/\305\343;\221}%\332/@`\200\200"
+	.string	""
+	.string	"64\250\037\343\302\365\b\352\037\260\357\264+\264s\3327\371\232<\016\353\022\365\021\245C\224\336(\0237$\377\221\237\265[\371U\276\313\237\26277\230\316\362\035\371\231/\345C\371\230K\242\035$\034\323\257\024\004w\220\001\023\027\332\234\216/\001\241\355\341}o\332\326\325]\326\333\365\301\243\351\355}\2533\270\253\372\364\372S\215y\356\373R\351\327\303\255\342\216\252WX\017\026"
+	.ascii	"SK\300L\350\365\035\213\331\332]l\327D\2664\232\321\306\351\303"
+	.ascii	"\334KE\333\020\3156\260\004S\344A\034\b\006B@\034\b\006B\264"
+	.ascii	"\242\220<\204\221\270\346\036"
+	.text
+	.section	.gnu.lto_.decls.ad036f5f17281be5,"e",@progbits
+	.ascii	"(\265/\375`\340j\315\274\001\312\333\362\237R\0200d\3514\006"
+	.ascii	"\360\260\3636B\303rE>\360\330d\351\003\223\366\2209\022%\267"
+	.ascii	"\034]\260\322\272e\354\316j\025\331\344\025\333\200\341x\261"
+	.ascii	"\316\326pf\342K\211\205Q\216\222\273\257H\033\350\020\025\352"
+	.ascii	"\335g\177E@\332\036\356aV\324&\367\336RJ\231\002\227\b\f\nK\n"
+	.ascii	"\227\3172/\232[\346\227y\331\320\33407/\3552\253R\376y\300\351"
+	.ascii	"\013\303VD\347k\346\236\261L\016n\363\227\306u\373\351\264\334"
+	.ascii	"\313\275\227=\367\313\315\232\223\233\177\252\321\267\034\240"
+	.ascii	"80\320r\200\376\304\323?\341t\336\177\357n\362\342\271\265\221"
+	.ascii	"\222q\363\025s\307X\346\261\\2\273\307\002\321\322\004\344\346"
+	.ascii	"\237nZ\305\336{\333cA\323cA\177R\321:\366\007\255r\255\\\273"
+	.ascii	"3\356L\313\355\346:\2346Oh\300n\376\231\246\377\201\026\033n"
+	.ascii	"Y\262\260i\306\0016\261\274\215'\2707\034\0237/W\356\316]\272"
+	.ascii	"\373\3052o\227\013\367\273\345r\351r\337\336\306\003\265\334"
+	.ascii	"B0\234\331\312"
+	.string	"3\222\346\250\203s\323\311?\275\264\335\262\032\320\f\366\007\375\211C\377\224\241\177^\351\237T\372g\223~v\2431\235\325\200>@\003\372\274\2473\025\373\203Z\245\375A\245l\340\001\234\233K\336\374\334E\253]\345}\262\273\340\326.\224\033\3052\257\332-r\325.\221\353\002\243%Sxbk^\265\353u\2074\345t\265U)7x\360`\241\222bd:\377\267\306\216\313u\323\256\016\233\2507\0377;\311J\274\304\200\271\371\371\232\335\036\227\314\322\251\345$zM)H\216\205'\2707\027\2362\354X,\235\332\b#y7y\344m\226N\315*\223\224ir\317\356\362\242\3352\313\274fW\311\257\330\035\273f7\311\261\360@-7V\b2:V\220H\221\322\311\377e\002v\215\274\215G\254\006\225\333\315w\211\320/\023\235+W\234\272n\276\032\373\203\006\240i\177\320g%\372\371K?\353\320\3174\364\363\225\006"
+	.ascii	"\335\033}\254\247\217\271h!TWrhn>\226\242\1770\225@n\017\333"
+	.ascii	"\307\003\345\263\241\354\250(\277n\020\313\274@\256\217[7\227"
+	.ascii	"\007P\006{\0236\005\315\307j\372XL\037\033\321\307:\364\335V"
+	.ascii	"\003z\214\245\337e[\rh\216\233\375Am\023C\351\235\345U\243y\334"
+	.ascii	"n\215_\033\377\225qg\\\027P\231\216\007\332\332\315\227\206\320"
+	.ascii	"o\r\354\226E\252\315\315\327\376\240\277ct\006\333j@\261\322"
+	.ascii	"\376\240=t\366\007\355p_\004\241\226=:N2\330\276\334\374\353"
+	.ascii	"E\377\272\351\037:\253\001\375=\323-x\300\330t\350\270\371"
+	.string	"W\210V\363\007\305\216\013`\03357\366\315\330\0326W\354\2664\367\336\377\357\323\205\272S\327\352\256\270U\227\305\215\272R\226y\251n\323m\236-\363\274\334\033\312/\r\027\241\273m\270\251\005\332>\214\226\fJq\262\245\331\264{\266\217'\270w\2171\267\275\267\231Ku\235l\037\017\324r\277\300\360\304%\313\355o\357\355\301\203\007\017@\036<x\360\340\001\247\211\217'i\031\362o\013}\313F\337\252\321\267}\372vOs0\243=\310\323_\216\321w\273\323\247Cs\333\367[5{\346mwko*{\357\013\364\n?7ln\266|B\267h\036\360\305c\311\315\270N\277i\177P\273\355\017z\213E\007\267\325\200\332\244\375A\177\266\242\334\222\371m\232}b\307\350l]\200\211$\245\b\271Y\f\220\265R\033\323q\363\255\023\375\017~\253f\301\330.\266\016\243%5[\227\233\017\256\330-\"H%\203.\234"
+	.string	"6\367^\376\267a\254\235\275\263L\013\306r\271\215\263r\007Z\356\r\265\367\276%\373\205\300\330)\326\212\bR\311\r\365\004L\002NeX\254\371\333{\351\301\003\220\007-d\354IRg\373E\233\275\221\262\342\346[*m\347\254\027\313\264t\277]\263R\236\233l\355\264\275\227;\330IF\227\266\233o;\240=\201\201\201\201\266\003z\033\245\355\322j@\201\354\017z\244\205\333\ts\213\023s\363G\240o\231VK\026>2h\350n\376-\226\333,\177\210\020nFgo\262\275w\320\316\217\2611dn\266o\326\312\377 6\363$n\314\315\367;\333\377\240\006\313\262\"\311\315\337\200\376\255\225*x\007\326\01757\273\3415NO\1777\237\204\376o\231\266\315\262-7PN\230Z\213\254\233\377"
+	.string	"}K\345\030\324\355\020\276A?\203\346`5\240\331\376\240>\366\007\265L\204n\243\374\240I\255\345V\333{\367\364\330\265\371\021\271\371Z\357,\255\006\324\302\331\0374\203\322\376\240\026$\355\017\372[\264\3372\261d\366\fSYmm\265\275\227\027R&Y\272\324n\266g\327\232\331\345\355\231-{\210\020\256\003\265\311\366^\332\263\274\267\223\265\033\360X\273\301\211e\210\223\0234\377\352/\255\006T\333\037\264"
+	.ascii	"\347\217\242`\302*\331\375\327(\t\375\3218\023)\240\370\317\217"
+	.ascii	"j\371\357\t\026\254\355\277\366\267\200\030\370o\276\367<?\272"
+	.ascii	"\366c\002\344\375[\261'\030\374\003\034\340\002\\\340\277`\354"
+	.ascii	"\317\365\217>i\222W\360\337\215y\216\345\277hY\0059\005\026\312"
+	.ascii	"\005\230\214\202\377.\341\234\354\201\fB>\301\217\331\344\026"
+	.ascii	"H\250p/\360_\234{\251r\223\367\311\225\276Yf\372\217\346&]\370"
+	.ascii	"\243\t\370s\212\377\252\377]\372\255\3305a\364_$\023Y\305o\177"
+	.ascii	"\356\316)?\256\362_\267l\202\037k\311Jq\377\275\222\215\271\210"
+	.ascii	"}rRF\3721\017.\223Q\374x/\227 \205\337\"\371\257\006~+\206\375"
+	.ascii	"2\361\267'~\273\376v\310\232\340\267%X{\302o \370\037\004\364"
+	.ascii	"\347\243?\217 \033e\365\030\370\321\r\270\003#\350\371\321\262"
+	.ascii	"\337\"m\n\253t\003\214\340\317!0\273\206\037\035\273\001:\220"
+	.ascii	"\363\243`\277E\226\340\277N\3775;\273\331\220\037\217x\372\243"
+	.ascii	";~\234\223=\360_%C\377\035\303\371\377\227\334\201\377\016}\364"
+	.ascii	"e\016\254I\271\001\376\233\364\r~\264\n\213\345\r\374\227\b)"
+	.ascii	"\205\\\"\351\004\370\317\274\377w\026\n/\377\313\314\032\370"
+	.ascii	"\361\223l\342A\034\344\022\031PJz\207\037\315\311\362\347\347"
+	.ascii	"\023~+\342\267&\374vD\276\300\237Q\013\374\266\002\277E\300\377"
+	.ascii	"\273\327\375\257\222I\374\007\363\037\356\350\377\030\341\237"
+	.ascii	"uL\370-\t\277\335\371\357\211\337Z\340\277H\031\204\0222\t\377"
+	.ascii	"\225\022"
+	.string	"\224+\360\347\b\3747\221t\007\374(\362\307\314\f\201??\340\003\257\362\340\217\366\374\330\004,\331\001\177\036@\003p\220\205r\221\031p\2237Ci\374xD\026!/\340\277;\377E\301\004\344\205\313\n\370\363O\b\031\204\377~]\275\374\301\177;\220C\3747.\033\340\362\374\347\340\177\320\177\023Y\210\304A\374\350\213\037+\263\007W\005\377m\246W\377w\205\0170\225\371\217\341?\273\374\031\304\177G\374v+\1770\376\031\001\377\315\300o\277r\007C\177>\300\177)\360[<\244\244\334\341?\316\217r\340\277G\376\213\344\277=\376K\344\277@\376;\344\277a\377e\362\337\"\377\035\373/\217\377\372\370\257\327\177\223\374\367\353\277B\376\253\344\277K\376\253\374\357\217\377\212\375\327\310\217\233~{\225\374\237\301\237\236?\356\372q\217\037{\375\230\353\307[?\346\361\343\037?\306\220\r\360\343\253\037\353\3701\216\037;\375\271"
+	.ascii	"\377{\376\264\304\237\t\360\347\f\177\336\371s\372g\373c"
+	.string	"\300\037\247\3711\337\217\365~\034\346\307r?\206\373\261\225\037\263\375\030\312\217\321~<\366\343#?\006\373\361\220\037\177\375\030\310\217\235~l\202\037'\375\030\305\217\215~L\364\343\002\374\370\304\217G\360\343\020\374\270\003?\336\300\217U\370q\n?>\341\307$~\\\201\037\217\360c\006\374x\001?\026\372q\007?6\300\2179\374\030"
+	.ascii	"?\016\3721\006?\006\372\261\005?\316\360c\f?\366\3711\317\217"
+	.ascii	"u~\234\376\370\374\257\233\377\372\375\267\371_3\377\275\373"
+	.ascii	"o\376\257\331o\261\376\353\363\337\270\337\212\3757\352\267\304"
+	.ascii	"\377b\376\013\367_\244\377\236\360[\260\377\026\375\367\003\377"
+	.ascii	"\335\362_,\377\275\362_\267\377U\376\313\374\257\224\377_\376"
+	.ascii	"k\202\377&\376\213\363[\250\337*\375\366\347\177\n\377\315\376"
+	.ascii	"\273\366_\265\377F\371/\224\377>\371o\332\177\235\374\027\355"
+	.ascii	"\277\313\377\236\375\267\354\277d\377\225\372/\324\377\022\377"
+	.ascii	"}\372o\323\177\367\177W\360\337\026\376\313\364_\025\377e\341"
+	.ascii	"\277)\376\243\360\337\244\377\313\377L\377\343\376\003 000\360"
+	.ascii	"\337\241\3721\200\360\237\220!jxnXTi][BU\240\244)\367\324\262"
+	.ascii	"\311RYmm\345\036\303\225\324iMh\333j\357m\321h%\326\013\276\233"
+	.ascii	"\343V\300\246\313\227\233\237aL\377\247\226[\346\251\345\334"
+	.ascii	"\222\241\226\273\t\355\n\242\325A\360\213\311\324\224\233O8\036"
+	.ascii	"\036Vf\332n~\006#\372\031\206\350\377\304r\313<\261d=\023\226"
+	.ascii	"\273)\307kI\225\362o'\223\035<\303\216\363\n\013|A\270\310\260"
+	.ascii	"\322v\272\335\031UF\262n~\206\025m'\023\357\345\321\350\272\371"
+	.ascii	"?iN*S\256\013\024r\330\210q\2279n9\326`\254=\361\324\225YrE\r"
+	.ascii	"\017gl\306\234V\224|u\343\352K\013(x,5kA\203\352\211\245K\373"
+	.ascii	"\351d\255\213\024\213\235\246\217\271\264\263\211\355C\247t\244"
+	.ascii	"y9\321N\254sy\236e5{L\262go\016\354\3524"
+	.string	"[\321F\315\316\311Yv~\321\245\225m\2719y\276@\302\325\365\367w\336\300\341\344\026\303\251\353\357o\253\305i\003Ge9\321\300Q7\224\226l\005\216\302Ke\032\245kL\315\205\220\246uC\245\204\253\353\357\357\374:w\340\254,\017\300\232t\375\251]\031\351\372\373\313\301\327\365\247\006\003\210\225RU\304M\013$V\272\376\376\250\360\n{\366\001W\327\237\230T\r{\306\323\344\263\237\354l(\317\2603\311\351\343,r\0069\211\234HN#'\331\251<\227\234^\347\217\263\307\251\344\024r\0169\305N&'\330\t\344\034;\217X\346\371ur\375\354:y\270\375\326\215\0256\022B]\327\237\330\336\373\371\315/t~\235:\300\352\272\376\376\204f\344P\206\375\326\r\0131\245\220\326\335\343q\362\331PO8\224\347\327)\343\356Y\272\037\333\251I\204#|]\177\177{/=\350T\231U\271\341A\276tV\003\212"
+	.ascii	"\373\203\376\207\214\376\317\234\376O\231\376\317\020\375\037"
+	.ascii	"\036\372?XZ\004\253\001\375\317\326\307\260\247\217\341N\037"
+	.ascii	"\203\025}\fe\372\030x\350c\270\322\277\220\346\314\272`\314l"
+	.ascii	"\0357\377B\335\211u\341M\377\002\024\375\013b\372\027\202\350"
+	.ascii	"_\250\241\177\241J\337g\215\276\217\030}\037-\372?\247\244Rh"
+	.ascii	"i\231\335|J\331\255\275\325^<\021\253\021\265AI\025\035=\240"
+	.ascii	"\316\247\273,`\336nN\263\204B\253\001Dy:q\240\241\256L!k\032"
+	.ascii	"\203C\227Dn\314\271\003/\236\027[T\233\347\300?\273\311ol\226"
+	.ascii	"\026\256\"7w\260\032\320\323\376\240vM\350\271M\346\221\346\312"
+	.ascii	"\b\240\006=K\031-x\260\211\313wI\035m\326$O'\\\2268\375u\330"
+	.ascii	"Y\023\346IL\215_\\^\036\330\315\267R\262_>\203\307\274\244\311"
+	.ascii	"}\226\231\3752\232\354\227\233"
+	.string	"\231oJ]\327\037\246\372\342\004\f\315\367A\242\363^0\f\032\034j7\337G\210\276\017\016}\037\030\372\317f\364\252\270}\341\335\\\346\276X\343\302\311\315\367\231\272T\236\361n\333U\303\242J)F\227\311\344\273<&\207\311_2\230\\\227\355r^\026c\231\031/\313=w\311sN2\236\205b\311\210 \225\274\300\035\221&\336\275\262g\250W\215\214w\327\3448\021\244\222%\334\255\300\312x7\353\302H\237\320\250R\342Y\275\353\302\322\251\355\002\374\250R\212\335\300q]D]m=\343\335\256;\005\243%S\360\262j\346\310xW\307u\261\275\\(o\214\214w\265\256\r\236(\255*\345_\223\214\227\275\244^E\252\224\025\230b\004\016(\277'\215\266`K\253\001\265@\313\376\240\357!\2433\027\266\036b5n~\217\027}L\265\002\3156\225\b\241\001\362\2119\341'\034\365\305o\t\036c\241d\262\243\320\020"
+	.string	"\206\005\310\367\307\346\277\2009-\243\345&\226Nko,\020\2204\001\362\375]\341,\214\226\324S\236h4\363\270\260\220.\016`{\200|\177,\354\031\001\216\200\001\362\375\001\002\346\250\240'*\023\336\2741\223\3230\022\234\004/\335J\350j\321tc\225\261\202\236\250LH\323\006\017\371\255\231\234\206\211`#]."
+	.string	"\263T\256:S\345&\257\033\334\264\227\323\260\030\036\263tj{c!"
+	.string	"\f\f\220\017K\375\0270\247\341\251\335\264\007\302\221*\313\264\f#/\203\236\2502\0276\3152\230M\320\023\225\ts\201\0270\247\341*\354\302\256F^\032~\201w`\264d\320\205\023\255\267<%k\311kyK\256\222\241\344+\371I\266\222\231\271-\303e)9K\306\222\235\344(\331-S\311lY\3152s\032~\363K\345\376\3454L\206\363\202\236\250\366\316\""
+	.ascii	"X\023 \337\337\336\333\003\217\322\213\224\252\01797\371-\337"
+	.ascii	"m\203\243\216Eh@\271\371=Ft>\353\341\341\303\351\356\346\367"
+	.ascii	"p\351\030\371\006^*Ixr\321d\222\3152\231e\346\262\227e\034\031"
+	.ascii	"L\004\251$\006\236Z4\313\362\222\313\005=Qm\247\035\036\200\255"
+	.ascii	"Qc\226\241\374\330\242C\347\363\210\321\307a@6X\272\037\0230"
+	.ascii	"2\205\310X\323\252e\260\234#\377\bz\242:\001\216\312\227\232"
+	.ascii	"r\310\222\246\220\016\226Nm\204\033Ys\357e\006\313E\216\205\210"
+	.ascii	"X\323\252e\260\034d\003\217\323r'Q @\320\300\375e%y,\033\311"
+	.ascii	"IrXF\222\305\362\021\313\314`YyBy\362\007\210!\237\207K\237\307"
+	.ascii	"\206>\317\013}\236*}\036'\375\035@\375\0354\372;d|4\235\251\273"
+	.ascii	"\272\371;p\372\177\346\221\275,3\367\310[:2\027\017=e\356\221"
+	.ascii	"\2732\027\006=2xm\3760[^\337\0234\177g\206\3763W\336\221\363"
+	.ascii	"\246\f\307\233\274#o\361\230\025\261\342q\363u\002\365u\376\364"
+	.ascii	"u\366\364u\360\364\237g<\337\370sV~\221m\220`mE\334\324\315\231"
+	.ascii	"F\256\361l#k\355l\003\204\255\275\235\262\215\2366{;\365X\273"
+	.ascii	"\201\265\033\344%]E\244\240\371:w:\313\020z\236\021\365\303*"
+	.ascii	"\353f\016\354\017z\2359}\235-\372.\255\006\264\203\375As\362"
+	.ascii	"\210\304\314\216\233\257\343$_e\027A\232d\224\271\305\263\213"
+	.ascii	"\246\274)b\310Vd\026TA$1\326\312\364XA\025\fC\306\226f\352\231"
+	.ascii	"\n\373\345\3501\344\346\373\3313\255\030m:2T\030 \032\267\233"
+	.ascii	"\257\023\245o\231\371);A\255i2\327\364\354\364\207\b\301\236"
+	.ascii	"Y&f\354\324\334\214\335\344\255\225WMQy\007\366\300\305\275"
+	.ascii	"\251\021\210\337\240K\316<%o~\016\240\276\037n\023\334\273\363"
+	.ascii	"\362\243\215\021/06&7?GO7q\024\250\261\233\377,\023\257\301z"
+	.ascii	"k\260\031\254\306\322i-w\026O\224*fo:{\305\232*YM\032\353\302"
+	.ascii	"E\223\352f\354\027\224\203\021c\313\315\3171\323?Fc\231\270\257"
+	.ascii	"\303\216#Y7\337\017"
+	.string	"\363\375\017^\037wg\330\334\214\367\222;\n\215\233\233\251\031\254\272&7?G\210>\203\365\356\016'0X7?\007\210~\316\f\375\234,\274\233W6\003\312\315\317\221\022\203\307X&&\203\321\310\3402\274\264tj#\314\326\310\340&\370\316\322i\371l(3x\315\2757\220\007\017\026J\2267|h\316\202\353\266(\301`;\034\3062\361\335\361\035v\202\251\3604]\330\273\007\031\345\035f\3427K\247fB\222.\315\034+/\034M:\323\341/\226\211\353\260\027.x.\350\211\312\204>*uX\013\336\022\364De\302\033\\S_\t\362\006\004\315\307a\243\177<w\334eE\333\0211qX\016'\206\026\335\333\315\3071\243\343n]\200E\305\335|\234;}\313\274\036\206\273\231/9\031e7\037\207N\037g\213>\016\2267\314\206\253X:\265\021sq\315\275\367\025\214\3052\361\033\266\362\206\323p\224\245\323z"
+	.string	"\027\271&O\221#L\312\320|\2345\235\225@E\351\202\335p\333\336\3311\203\003K\330\315\3079\323\307\021\323\307\t\223\202\247X&\246\202\327\250P\301O\260Z\320\023\025\211\034^\232{/C\204\200\251\3404\034\305\323\264\334W9C\232\214\364\375yHyX9\013\202\346\343\254\320?V\303QhP1\333,O-Z`\206\334\214\241`4<\026\333\314\315\307q\322\017\262\321\017\356\351\007\307\350\007\345\264\031>\213\302e&v\363\203V\314\202R\364\203P\364\203K\375\240\022<\366\266{\275\354\345\370\273\371\301\"\372\301\0338\311\217\217\3400l\304\246YohVn~\020K{`5\240\250\375Aq\021\254\264\314\r\030\214\357\307\023\326\315\017\256\320*\330\333n@m`\240\335\200^\273\321oZ\r\350\027\020\216\0246\267\345\315\327x\372?\006b\2318\b\356\002\372"
+	.string	"\007\301<\360\017\021\244\222A\026wB\232{/\201<\344.SS\354r\306>P\2601@\002o\276\226\303=\260W^\243\361\243\353~\307^g]\030\021)7_\277\351k4}\255\324[@=/pD\241\272\371\332\206\376\0070\360\f\214\226\324R|\374\3008\260\016\313\3049\260\226\032\316\201i\340\033\226Nm;\275 \200_2\320\n\220\207\035)\177\2002\320\\\003\333\350\251\0322\365\325\245\206\025\375\264,\006\226q\263\236\004\001\213\221\006\321Og`,k\227\206M\212\223op\013\274d\333Rw\363\321&\266B\301\350\243\\\364Q*\372jj\372nP;o\306\336"
+	.string	"\336|t\251\217*\365\341\254\006\364\276\271\201\226\251\001\336\017\021\302qS\223\236,\243\213\027\221\233\217\376\320\267\032\2406\320j\200\036\255\241\201\254\006\324\216\261\032\320\243Y:g[\rh\032\035-dTTn>\272\265\020\232{\345\202\301h\311\022\272\316.\232\253w\367\360\322MO9Q\273}\327/RC\222\200\271Y\263x\033\\\023fs\213~\322Oz\352\216\f\330\022+TZ\352zJ\317JN\352f\035\205\2365\261\313\261\343f\r\205\243h,W4\243\270q\243\233\200\266\360\335\\\226\233X\317\r&6\370\364\276nj\301#\231\2749\rL\251\344\261\265\220\2739}\203\243\256\334"
+	.ascii	"\303\214\374\375\245\200\266\311\276B\201U\220%b-\330\332\254"
+	.ascii	"\261y\nh\217\224\301q\346\346t\315\331\332\254\350\342\266\301"
+	.ascii	"\356{_\232\306\372,\237\354\230(\317+\177t^\374\236\2461\303"
+	.ascii	"\223\366\306\346\204\203\2323gR>'d@"
+	.string	"M\356\304\354=\345k\336\375\335\2346\231\210\301\305\340pf\314\230T/H\t]\236\021-\365\027EI\231\247zmg\220(\211\244yk\236\264\221\221\227\3425\341\212Q\245N\207N)\206F\346\302\371\205q\351\273\371\034\270\314=\0053\227\206I\337\200\366\023\324\316\001\344\007\320\252+\354oS\335\350`\324C\207\334\335\3230r\201O\334\270\322\272\247v\1770\025s\027\327\344\346s\340\322)\335\323/\177\360\264\361\"/\354\346s\300\241\377\324\313\037\324\371!7\307w\3639\314\320\347\220\344\302%\225\003Bs%P\217\013\013H\334S9\334\227E\204\371\366?xA\340\327\324\315\017@\225\267\267\024\016h\253\211O\0040l\025\343-,\205K\265\230\231\363\302\345\3464\213\266[\343\025w\363\003@\226b\t@\0177\267\324\n\323\216\r\331\255\201f.H\225\247V\314\274\221\332\233R\345\177\320\003\274/\"7?"
+	.string	"Sjj)\233\027\345\336Z\035"
+	.string	""
+	.string	"\304K\026\346S\266\266\037@\264\214\335\234\256\245T\300\334\250\326R*\351\224\0323\320\2049\321TA\254\274R)W\311\217\031_tM'NR(@z\227\335\005i\356\255\325!\365;\342\302)}\362\024\312\333l\3100\223us\232F\307\204I\212f}\226Owe\224\232\315\0266>\226O\321\372Z\350\340qszv\002\226\225\221Kssj\366\266\035\272\245\214\0267\247e\231\217G\210\227\231\214\233S\262T\207\2246~'\333M\253cBw\363\0010%E\222\"I\307\314d\271\341=\326\344O\354\351\330\222\2463ZnN\225\3504\341\352\336\334\234&\311\241Z\362\246\315\333\220\260\215I\271\371"
+	.string	"P\0369\222\251\254\217#|5l\2262x\311\233\257A\232\264HZ$\005\003:{aF.'\r\0134T\312\247`\267;\0133&\243sWm\330\334|\r\246\350?\035\222\016\311|\023P\333NX\035\264<\345\205]\030B\247\344\346kPC\377\351W\372u\312e*n;\251\325\201\016\262\003\320\351\346k\300\"\205z\332\"g\345\027\226\231B\245@0\225\326\316r\300\235\036\252\206I`\225\233\177\244U4\246\250\335\374 7\372\226\314E\232\034\243\206\225^\221yy\221\306\260t?&\220D\256\231\316HsX:-\237\r\305V\246\231r\341\264\364jN\311#\365\221\366H\273\322\035\251\227e\246\\\251\f\241\224+\315\232"
+	.ascii	"Y\227\346\336\313\2340~E\350xr\352\342zAOT&\230\3415\323\034"
+	.ascii	"\330L\212#\207yD\214\221\277TG\272e\231i\016\265\r;\200d\376"
+	.ascii	"\314\320\374\2478\322\033n,lL\335\234\332H\213\253\342q\363\203"
+	.ascii	"\272\350?\245a\231i\215)#n\210\334\234j]oE\023\213\252 -\372"
+	.ascii	"ARt\nC\3375q\314\335\374\2404\375\240\245~\020\023\375\240$\372"
+	.ascii	"O\223\351\325\231\306\245o.\275\302Qv]\254\236n~\220\021\235"
+	.ascii	"\262H\255z\226\270\365\230r\363\323\252\377\301\024\202x\231"
+	.ascii	"rsNW\334\270\"\312\026<c\210\254\241\335\374tjJ`\037\215\233"
+	.ascii	"S)-\025\304\203\003\034\034l:l\244QO\245~\264\357\262i!\320\215"
+	.ascii	"\232\233\357\235\320\323\250\234\271,\315\263\233\037\224\324"
+	.ascii	"\267c\026E\363\264\tM\352\224\321\226M9Qgnt\200\237\310|\264"
+	.ascii	"\311\341\363b\225v3\352\006\rL\367\037\f^\261\262\273q\363\203"
+	.ascii	"\250\364\3217\377\2038?\352\206 \271\371\332cAQ\300\243m\376"
+	.ascii	"`J\226\204Z\273\371AO\372\350\032\224\315\037\304n\344\256\254"
+	.string	"\270\371\031"
+	.ascii	"\352\243\177\377\203+\310\3331v3\252FKeP\206\203 ^\023\275/\277"
+	.ascii	"\243j~4\r\036\222m\220\300\312\206\326\231\233y\354\017\212\366"
+	.ascii	"\t\035\365\273E\324\342\342n\336\261?\3503\250r\346\f\2727\246"
+	.ascii	"\214\255\251\277\bQ\233\321<\272w\367\314\372\264D5\321\323+"
+	.ascii	"[\303R\232E\334n~\006C\310\220A\363\202\017(#Sj\2478\030KP\274"
+	.ascii	"\243y\"\250z\021\343Xr\214*L\272\334\374\fv\204\t\203\212\271"
+	.ascii	"[{o\251\255\002LY\221\346^\0304sb\260\221#ej\240\334\374\f\\"
+	.ascii	"\200\001\203\275\312~\f\341\213\352\272\371\030\260\241\243C"
+	.ascii	"\353\202\230\254\331;\003\024\202~9ZG\206\245\271\346\314\334"
+	.ascii	"\034J\305\204\fH\244\240>\306\\Y\335|\f\246p\341\202\312!)\302"
+	.ascii	"\263\004\360\t\334\315\250\\\006R&F\236=\323a\221u%\307\315\307"
+	.ascii	" \t\034\034J\305\204\246\275\337T)\305\266\226V\207\340\025&"
+	.ascii	"ez\334|\fnX\261\202f\t\356\344\003\216\254\321d\336v\240\301"
+	.ascii	"r4\313\351\245\331&\360\346\373\241o\347\232\026\026$\350\033"
+	.ascii	"z\205\207\312\225\254\031<luP\242n\376\2066nn\330\013\350H\231"
+	.ascii	"\036+uO\311\233\277\201\215\rG\331\345\276\302y\"\262!n\312\024"
+	.ascii	"\224J\221\0329^1\336\264P\001;\322eu\3637X\211\022\005]K[\350"
+	.ascii	"P;\272\026L\242\221\323r\202:A\235\240O\216\220\245\035}\222"
+	.ascii	"b\t3\202\305\316\007\222\27077\177"
+	.string	"\303\020\224\311\231\240h@[\370\016/\313Mlo\255\016;B\304\322\314\226G\321\240\204\345\375\335\214\222\241g=\314h\331C\317P3\245\033\253>!~<jT\241e\327\007\327\324Z\224\r5\364\330\030j\245\267m;\243#\004jJ\306\315\337@u\344\b\252\244\315\007\031\016\024\252>\037J\222\364l#u^h\022\024\311\231\253&\332\026 \02358\3200\254\265\357Z\016!}{C>\004\005\273{\357\255L\331\304\024in\255\033\035\3161j_w(\030\252\\B\206\213\030T\211\026)\023\026\b\346\253'\212\216\270)\224\b\356\362zK\343\346\346\003\311\351\037?\320/\275s\246\202\334\350\240\363CI\332\032\364\013\rR\346e\326\026\004\005\242S\247\347E\n\336\221\247-<n>\020\033\027\332\203\013\365B\367\266\313\255\253\344\326Jv\350\352B\275tS\006&o\264:\234+n\314\275\241<\216z\345\265"
+	.string	"\002tD\037\bkk\013\217\001\371\354\3355\246\004\202\322?\232\3032\321\034x\fM\226\340D\254yA\031\375\2437n\340(\017R)O_\315\271\0325.\214\354\263\241\272\226(\321\364\217j1Q\255\013#/7\026N\027\223e\007\277\240\013\225\201\3128\357\306\204\\\220\245o\317,\n\003\206=\263\313}e\273\246\300u\200\276-\333\254\270\371\026\354\351\037\315\272e\242Y\247\334\004\324\366\306\032@\224\336N\363n\r\337\315\267\300\213\376\321$\023M\236R\371\204\332<\206(\367\326\352"
+	.string	"\307\354L\013\363\346[\260E\377\250\013&\352\002G]\341D\325\241y\363\2677\\\007:k\320\326\220\271\371\026 AW\240+P\253\020\332P\253\373\243o\314\225\233Q\026\247\235\026\034V\304D\375\017\236]i\312\264\335|\013r\240S\350\224\315\202\317x\251R\212Y0\025\030\210F\201\261\241PG\243p\336``\275\271\031}\202\022\366#\310\315\250\223\255\373\037\344I\363\003\342\343f\264\351\004D\227H\225\021s3\272I"
+	.ascii	"g\307\205F\253\271\232\323\215m\262\257\354\2235Yn\177{ku\b\336"
+	.ascii	"\221\t\"w\266\371\351\206\247\315\352\352\305\315\347\337\t\370"
+	.ascii	"?\250#EV\265\002\360d\243c\314\306X\013\236\036\\{k\3165\267"
+	.ascii	"\251\207,J\223\"\032\272\360\361\235~Gr\364\375\364C\215p\271"
+	.ascii	"\321\345\346\023\315\016\013>'7\366\316\216h\365\270\371\032"
+	.ascii	"\232\350\377lZ\346\331\314\201\271\251\311n\302\231\252\313\323"
+	.ascii	"\372\333[\253\203+\203\356+\355\346k\200!F\314iF\357\275}\254"
+	.ascii	"\341\3754s\352\341\304Pf\221\2729\357,c\321\234L\025\271\371"
+	.ascii	"\032\246\362\374N2/\2265`\234d\3161XmY\205*s\371\022fC\313\315"
+	.ascii	"\317\320F\377\354r\316\375\364r/\347\235\335{of\225\362ok%;\374"
+	.ascii	"'\230\237wz\355L\025\0347\237t\247\335\377`\026sd\b\027\273\263"
+	.ascii	"\256\352J\324\2262U\232\214\245\235_\262\234\216\023W\21547\337"
+	.ascii	"\357\302\370\037\024b\t\362w\3633\344\351\377\366\367G\267Sr"
+	.ascii	"\357\235u.w\362I\007\375\355\355im\207\177\307b+\200\377\371"
+	.ascii	"\367\200\272w\024s\314\336\333\366\351#mN68\354\223no(\256\246"
+	.ascii	"\tpaAq\315\240J\343\302\272@\225\306\265\233\240\2104]Hn\256"
+	.ascii	"&\252\264\275/@A5\215\330\302\242Js\332\027\250\3226\326\216"
+	.ascii	"\252\303\262{\311\325\264\241\266\366"
+	.string	"\205\r\265\235v\332\026\026\007*(.,\2524'\254\013Ti\\X;\215k\373l(\247\344\n\250\235\274\260\323\270\366v\332\026\226\017U\332\026\026U\032\327\026[\203E\230,1\250\214\371\322\262_\250\240\266\213\0267\234\222>tT\313\255=fo\253&\265\223\233no\001\354}c+9\306i\206u{\242s\361D\305i\313.\367\336\033Z<umm(\272&\273\351\250\302\266\366\016{:\332-\366\336\033\204\246%\335\006b\351\232x\334\330VR{c\260\227{\267\330\273\311n\272\275w\323\336;M\336X\356]\303\207J\331\242\305\336Z@-\366\215\246*R{\337?\372\240&\021\327U8\\\221\324\021j\022q\315QJ\032\n\256\310#\322\260H$\241\210\001$Q\003\265\004RE\032b\022aT\004\300:4\"\025\235-\230@\244\256\310\245\022\020\215\260\"\211K&`JA]\207HKCH\303\241"
+	.string	"\020\021\215\360\243\017FE\342qEZ\200\204\264T,\032\213\351*T[ \"\321UE&\251I\350\217>p\240\256\303\025V\265\004\t*\234p\301J,\222\270\260\022\213$2\374\350\303ZT\223\210\216C\343\t\020H\002 u\216C\025ID\n\225H\037!\227TH\241\022\245\304\024\352\b\242\343\220\2508\\K\244P\2112\374\350\003\022\ti8t\264\016\223@\260`<\036\255\306bZ4T\221\362\212,\032\207\316\242\265H<\"\241?\372\260\001r\210\270\"\211\353p-\201\00294qT\221\226\210\324\243!d\220*\034f@\032\r\221HP\221N\f\221\304\021\252\221\206\037}"
+	.string	"a$^\200Z\220\201U-\241g%\026IdX\211E\022\030\374\350\203\212bX$\364P\202\212bX\304\363\243\017CB5\211\270\026\227\216 \206\212\002\260\252%p~\364\341\004\023$J\200\340\200b\310\210$B=\032E\3640)\031E\364\254?\372`\244\004\302H\351g\250\270DB\316\211\024\032)\351\254\302\242\221\322Y4R\302j\013DdfR2\016\345\343\252\204\277\303t\\\221D#u\005\241\232\022\251\310\245\\4\022\327!\025\231~\270\016\211\204FJ\037x\204\352:DRJRM\030)a\200<\2414B]\207+\344\254j\t&\210\206\352\n8FEb\261\270\264\002\tH\342"
+	.ascii	"6\250\253\212\244\224d\024Q\002\222\030\200\036\024\310!\nH\242"
+	.ascii	"\212\0214\017R\003\206\"\245\023.\240\200\002r\211\002;\036|"
+	.ascii	"X"
+	.string	"\217C\245\017\252\321\360\250\246\030\241h$\216\260\252%l\200\274`\304q\t9TQ R\203\220\032 *\241&\021M\254\310\341\tHKIKCCC\r\324uH\244\244\001\"u=\016\327\022\310!\007\214\212\304\244\343\b+\362H,\342\220\244\256H\246\022\027\316\037}0Z:\241\022\201 B\".\235P\211\214(\030-\235P\211\202%$\035\215EGU\311\002\013\216\206Vc\n?\032(`\204\301\217>h\200$\3529\032I\360\371\020\361\250\026U#}\020\024\220"
+	.ascii	"\005\210\240\"\275\b\r\360\240\001\036\240\027\241\001BB\rP\200"
+	.ascii	"\220\276\002\204\360\272\032\217LFY\b\005rh\242h\bG\025\252D"
+	.ascii	"F\024\216\252\222\252\236\320A"
+	.string	"\n\211\220\214GH\365xdb-\252Ij\n#\n\034\222\214E\225H8TdB\026)!iU\211i\365i\341\bE\210\017\204*r\211GE.\t\215kN\221\022\022\006!\241\020\302\026\2162\204\020\026\025\031\327\245\265\310\210\004R\205(\206\324#\021\030@1\244\036\r\355\230\340\250$\024\2620d\022\256*\262\250\310\330\303\202\221\250Hd\201\247\205#\241\212\244\2244D\252D\306$!\212\241\252$\\\213\212\204E&\242\013\302\"\023Q\317\217\220Bt\025\206\370@M\"\256JF\343\t<E\"F\214\260\372 \205:\353\217>\024\340\210\256=\302\364G\037\326\241\245\343\212\f\201\024\252P\327\245\244\013(\206\214HB!\272\026\227\214CBazT\213,\030\205\302\024yT\221KE\241P\023\025\211(\204B\024Y$*!\205\302\264h$\"\211H\252P\030\\\205+\222\210\344\363\243\017HU\211iM"
+	.string	"\221z\034\036!\023"
+	.string	"\002\271\022O\200X*\032%@\305R\221\210\224"
+	.ascii	"\020\024 T\200\b*@\250DKHCE\"\210#r\t\004\003V\025j\021iX<\252"
+	.ascii	"k\221($\032\252\307\243UI(\274 \205zT\022\n\321\025ID\022\n\321"
+	.ascii	"\341:$\022\n\321\343\360h(\253-\020\221B!\212b\310\210\224Wb"
+	.ascii	"\221\304J,\0225\024I \032\252G\364\270\2520T\\\"a\270\016G\020"
+	.ascii	"\r\325\025\214G\246\0226 \205)\324\021E\022v~\364\201\270\252"
+	.ascii	"P\217*\022Qqh\002qU\241\376\254\305\242\213\024\016\251+\240"
+	.ascii	"\030\032\236@B\032\212 \256*\324\013\304U\205\232W\244\220\250"
+	.ascii	"T\242H\035\241*1\231\020\222P\241D\216:T\034\256\310\"Q\257B"
+	.ascii	"\f\220\310E\242\nE\344\020JTBb\244PD\b\0229\"B\220\b\242C!\210"
+	.ascii	"\370G\037\220K'\220B\024\210|\216\352\212\034&\241H\244z$\"\032"
+	.ascii	"\246j\212!R\211%\245$\275$L\241\022!\227Nh\244P\035\"\246PG "
+	.ascii	"\227N\344\250BU\211\311\004r\351DPUbZ\221K'R\344\322\t\254\""
+	.ascii	"\r\207\220\247\361\250~\300xd2\322\"F\214\200\\2\022S\250G\025"
+	.ascii	"X\030\256 b\304\b8\251z\\Z\207GU)I]s\326\343\252\302\nKJI;E\022"
+	.ascii	"V\025\251\036S\244\020\303\222\021\261\250h\024\261\244\224\344"
+	.ascii	"\263\376\350\303\222R\222\320xd2\032\032\032\202@\036\325\024"
+	.ascii	"\304#\321\001T\341\n\036\204\340\201\002\226\224\222~\212F\342"
+	.ascii	"\272\204dD\252G\034\2440\203*,\261\244\224\224\203\256HKHu\205"
+	.ascii	"\242\221\270\244\224\204A\025\026\215\210HC!O\321\210\2104\202"
+	.ascii	"\361\310d\024T\205;-\230p\001u\035\256`<2\031\3450\021\r\325"
+	.ascii	"\025\206\353\220(xD\026\t\217\214\210GB\343\221\311h\247H\t\t"
+	.ascii	"\257B\021\326\"q)E*\031\217#\216*\0211\005q\304\222RR\317*4\032"
+	.ascii	"\2320\022S\243\241\t\342\252\242\002k\221\304\222R\322N\212t"
+	.ascii	"U\200\320Z$.\351\022\214\212:H\241\210U\030\342\203\265HL\223"
+	.ascii	"\226\220x\375\321\007\344\321:L*\n\2230R\230B%Z\221)\n(\224 "
+	.ascii	"B"
+	.string	"2\n\223\320\022,\250Ea\022z\034\246\300E#q\035\036O\020\221\206C9\253\360gE\n\217\304\"\fD*\022\022\261(g-.\031E\254\252\321q\270\346\250P\211\212\3043i\251\204Q\221\230\302\230\024T\221DcQ\035\261$\\\213\214%\214G&#\237\"\245\023V\024VhU\352Q\327\341\212<\325u\270\226\020ZU\300P\244t\302ZdD\356\b\205\320)2\2158\032Z\215E\236U\270j\244\006\324$\242\t\036\"u\035RWu\004\013F\244\242\243\232\302\350\263\376\350\003\210\2421)\3118\224A\b\246\213\024\222\200\301\203\023W\350\304\rq\342\n\ro\210\341\025RqC\250\270BL7\304\n$H\020\261\002\321p\311\004\304\023:\3531\270QI=\202X\215\306#\210\034UHD\342\207\210x\221B\022\214G&\243\013\307U\205\0212\024I`BRR\032\246+R\210\2428\244\200\316\031\300"
+	.string	"\021\0344\220B\tz\350\203\361\310d\004\002y4\"\213*\022D\2218L\0021tD\202\370\260\001Eqx\"\253F\303\265\304Q]\221\210E9HF#\005\204\347\377`\023\352\365\344\307\231\216\273s\304\016M\233\225*J\220(\301q\363\362\226\341\201I\343\346.\215\021&\314Z\233\013C\256I\233,\200)`\23376}\273'\345J\302\225u3\0324\372\317&\321$@iU\227\346ok\301\350\360k\277\353?\255\006\317\007\026.:M\217\026?\035n7\237"
+	.string	"WZ\367]\030uo\206\250!@\024_j\005\007\212\222<\265\275\024.\225\213\2614\322L\345r\260\261\353r\363\356\341acw\245f\031\026E,\214^\032&\205\362\307\226U&\325\353\301j\323a%/\345\313\361\266%\r^\032\2348-S\200\220\261\243\233\273\342w\263\0301\372\016\307"
+	.string	"\304\320\321\351\273\240\007H\252\300\\\337\345\020a\352x\263cs\005\t\022;]w\346\027\b#\215\276\022\266l\323_n\031\257#l\312\334\374\001\254\3519=\207>\261  \t2"
+	.string	"\245\216\323qZ.\004\255*\245\230\226\373B\223\332q\363\007\200\305\005\265\n\266P\013K\333\022e\025XF\004\356\364\343\351\202\023\242E\313X\007\300\366Z\226\024M\303\330\0333\303\222B)b\006\357\351\346\3372\337\246\257\240)\367\336>:x}L\265\233?\200*\315\306\246\253\334-\250\275\2456\023\0170\035M\267\353*A*\2477\270\233u\233"
+	.string	"\362\364\257\231\272)\223\355\225a\241\202\242Y.QzXS\364\024\032\306\206\252J\312\351\006Gmj\013sM\267\310i:\315X\241\366\304j\271\030\323Q\356\020\262*gbn\326K\275\324OtS\2216\235v\375D\211\226\250\277\233\265\223\323.\217\352\r\213\233u\023[\327\263\303jI\325\315\032\315nI\357\270\326\354\320\323\022\244k\356\346\013"
+	.string	"n\231AK\211\013\263\224MoL\231\252\262\233\226\327\003*\214\f]k\002r\205\245\231h\036tg\201@n\316\351\252k\n\323cOl\224\351\350\273\031\307\t\232\261\031J\316-\032P+\313\222D\303"
+	.ascii	"d\242}\335\f\265$\273\272\372\332\n;\315\374\261)2\345\346%\331"
+	.ascii	"\336K\0364\211\220\251*K\2545S\2624X\n\226Vf\215\033\255\304"
+	.ascii	";p\354\256\314(u\021M\244\214\233_\331\315\031\347\211Z\225)"
+	.ascii	"=\004\013\361\001e\003O\210\376\002\254\301c\315\315K5\261\025"
+	.ascii	"g\232\202\340<7\201g\232\032\210\376a\303"
+	.string	"\251\255\310\315W\f\007\2315\037\247\034\025\223\031\272\207\323\030\035=v\334,\343ZK\206\346\201\303\330\345\326\332j\332c"
+	.ascii	"\240U\222\254\277M\245\325!\007\255\n\355\213\216k\036\327]!"
+	.ascii	"B\270\236X\2220N7k\256\363hu\261\322\274\371zK\357\370\2038G"
+	.ascii	"\274\322\224\334|\001\214\351'@7\221\201\205u\263\316q\2750="
+	.ascii	"\253\275\2335\216c\321\022\363\347\343\346\373\351\033s]vO7k"
+	.ascii	"\032\272\206e>N\333\370\262\207\307\312\324Z\334\315\027\200"
+	.ascii	"\021}\3738t\005\366q\250\236\021\264\222\303\213\353\346\247"
+	.ascii	"R\302\330P\336|\001|]]i\030@[M{\035\226X\031\221\361wu\200Y\371"
+	.ascii	"zq\r#\363\225\300*\r\227\233u\326I&K\231\213\0357k,\034\345$"
+	.string	"\317\206\225\233u\022G\275qA\003j\203=\275B\257\320-\364N\246\02667\332\352\272\305\365\362\361\202\310\315\272*\207\204\2503b\203bX,\247(\022VH!D43M2\034s\025@08P\036\020\316\245U\347\001\023@\004Lk\204\201\244\007\231cffFD\222\2422\n\n\351u\247\002\276}@\343q\2069\304\t\371o\037\202\2612\342\007\256\217\340V\214w[\016\b\017\207:|\211uX\352\346G\202j\224J\267\235\024\34079N\210\232\206\215\344?r\3260\354\r,\262\031$\317\025\320)2~\2725\354\311C#\214\314\240\313\027\024G\201]\303\035\343\336\374:\273o\233\262a\306!5\214\257\300\006\264\347gS\312o\215\247\321*\247\305\361;a\007\226\227\355\333\323\301\331\204\220\244\r\003\321{^\231\354\225\355\002\t\342\3007\315\023\302\304\231\270\367Ar\026\302-\007>\216S\335\217@\007"
+	.string	"\276\276\205h;\027\3533\371\004\206\317\bX!\355\334\005\376\261v\244\255\325\321\356\240\025P\325\253\261\266\002\200\275a\376\265\"L"
+	.string	"\237\\\035\202\357r\001\370\263U\272\n\217\216\302 \353\021\223\315\270\370P\277]\3619\332\204\272\221\027\254L8\242\241\233\222\240`Z\243\301\334D]`\3326M\376\013\206\352P\030Hi!\202t.}O\270\312.\bX\231\335\0200GS\036\t\252\242\"0q@4g\016\263\t\376\201\303\252\340\310\330\306#\245a\216\310\001\305\314\002\n5f\205d!\215\f\001)\2654\242v\253^\201\177\374Z\t,|,\316\341\372\327 \200\326BE\231\266\234\013\351\026\034\272(\244\203\271f\363'\354\002@\240\003o"
+	.string	"1\3040\275F3\230\365vXnA\037k\240\032\300\340\355\257U-Z\236O\250\036{\302p;\3277;\261\340\022\236\223\250D;\223\013\365\302\323l!(\242\032\330\371\357p9\326\363\254\324\223,D5`GYQ}\202\206s\303\217\t\270n\003.\350\343\004\024 s\260.\032R\2473u\361\257[\267\376g\267\316\363i\271q\251+\252\230L\002\004j\256\031#\003\372\350\356\303P\317\346\227\001\227"
+	.string	"\232\202WnQ\204\220\033\235\242\t\306\334\301\362\321D\210\024\240\3260g\211;R\262\254\277\343+%F%i\025|DYCw\232\310X\306a\351\002Af\303\335\346j\351\002\255B\206P,x\236P\322\256\030H\030#\317\304M\307 >\204\242\001\206\366K]\323j}\234L5\031\214B\\\2558\360l\276\237\261\267_\300\215\254\353\344\317\353r2\206;\253\020q6\002\004:\0262\"\246\247<\317\2317[5\3501\262\330\276#\013\230m\332s\027\261\250o\337\352\252\226O\262\257B\\\300\206UL\016*\214\346\025\312\233\310\016+\\:\352\300z^\351\345>\262\333\323\021]K\336\202\360\252\313(+\026\207\316"
+	.ascii	"h\305\201\353N\243]GM\241\024\303\261\234\222"
+	.string	"\360W8\234\035\305RZ\003@\276\247\221\0268sP\016\241\244\034\025R\210\025\314-\346\260\374tT\271\367$\f\n\356I\320l'\nR\275\0356.\226\177\034\005\366Q\223\371\212+\036\371\341\233\2203\r2c\036K\3275K\246w/\225'\004@\275g\326a\347Q\202\250\352\322\370g\272\3242g\352\3452\243D#i\226k\325\323xe!v\214\214\351\211k Q\247\031\356p\235\3213\023\250\343\266\316\237I\213\327\022\254\316E\353\262a\212\345g\273\324$G\3016f\223\302%\177{'\227\215\221\307 \212\331\236,\036\006\242\344\323Ez\354\265\320\361\"\347\207\220,\242\325\2550h\374;\361_u\277]V6\036\347\223\027@\370\t\316\356\335\330\237\004Y\001:=-\2202\270\025\b\361\260\021\361d\355\324\377\032\331\244\031\266\335\020\220\260JV\r+\210U\340\324\006\200lJ\016\261K+\\=\235\\\007"
+	.string	"k\242;i+pM\244@\311\204&\353\320#\370'!\254\350:\246\356\314nO\375\tj7\234J\352B\206h\226)\r\261\001\217\013\013\236Z\3755\035\260K\203O\r\330m\023\223k0\320[\224\035\307\337:\310M\007\372\361]\303W\232h\265\345"
+	.string	"\224=\3014\365\271\022\206\02249\022\177\006\033$\224:\200>\216\bXR\343\370s7\303\266k\321-V\204J\213C\204E\357\345%\305s\243Lt\310>\262\033'\022\360k\002S\210\037@I?\037Foa\336\324\037~\231E\271"
+	.string	"\023\243\002\361\332/\234\n\243xP\206\nc\336\375\277O\204\234G\346 :\363\367\336\004\264P\205\233/\221\372\356a\263\273\275x\3740\tI\024\274y\177\027\224,,\024\271tBKK\276\367\237O\241f6\375^[\313\310\204\360-\225\251m\3056\353\007\005\337\325\3649\267/^\207\251\221G.\231\271)\360\3261\372"
+	.ascii	"\205\347\335\320h@}=\021\020\363p\362\224\246qdQI \264\264\243"
+	.ascii	"\236\235\340\275\037\016\n\024\021u\026\206\005{\035Z#\334\250"
+	.ascii	"\275\244\215\215u\276\370\216Z\3173d#\263\250\212J\275\232\362"
+	.ascii	"\333\025I\270\223z\264c\307\270\322\221\250\362\016F\335l\273"
+	.ascii	"\006\256\317\241\006)\310\246\356\373\255\030\024\266\266{\330"
+	.ascii	"\242\353\036\276\036\233\264\267\037\003W\b\245\341\213\0207"
+	.ascii	"\230.\270\"U(\271\250\206\245\326 !\232\273W\306\311`_\323`\346"
+	.ascii	"\211\207\245qy\322\273\265\230\373\231\021"
+	.string	"\273m\305yfX\363{\247\330\343\307)\243\341\350v\226@\212\224\347\362?\021S\341r#\271\254\230\254}R\004\031\374\0379\017\354\240\024\004\315\005\371>\335>.\324\311\304\005\245\356\336P\354\366\253\005\026\003\235\216\264W\013\377r\261%F\020\031,7\344\341\207\317*%\001zN\375L\326Z\200wnB\007\r`\275\345\026\215\203-\rz\346\211\025\302\0135\351E-\205\274\315\3437\273\017\370\261\355%#\352I\343\3335\251\211v\264{\251\202\031\356DLw\030_\330Y,p\210\b0\304VE}\240\033\204\304\314ry\004\177\204#zt\256F;\031\212+\217\201\005v<\251\2205#^b\177\025MD\020X8@<\334\202.\352\307\302o\001'\212$\370\367\214\246M.\tx\355\312\275\025\007\213Q\261\310\245\001 \353tZ\265\003\226\207J\216\030+\204\260\004\006\306\334\215\353M\022\357TZ\020\356\317"
+	.ascii	"\204\356\264\313BU4\022\343t1[\244xB\315\237\214\302{\274\260"
+	.ascii	"\272\361Ut7\"\311\250\376\323\213\031&\255$\356\206\354\253$"
+	.ascii	"GN\036\220mA\273\"kX+J<&\264C.\246\316\3244%\227H\357\273"
+	.string	"j\352\272\336\235\232]-0X\371\020|\360y\375Z\207\305\313\031\245C\346\210\r\034\023n\347\215\364\303\316 \025@h9\201\036\334G\343\220\334\244\216L\341B!\243\2163\221\264.\004\242\331\207\260\247\304\007\374.Q\346\276\376\222\361\311\317\177;\035\030\265]\342K\364\356\nP\002\235:3\341W\201\310\030xm\234\fl7"
+	.string	"\274\373\247\262_8\371\370c\252\263? \032b\232Q\316\353U1\223\3501`fM\027\311\321\231\037\312\223\306\320\211\f\207a \214j\377\366e,\370\332\rX\034S\202\334\216\025\337N\207\363\317\377\252\373\243\253\253&\317/\n\270&\377[7\200\300\177\364\333SC/\303\204L\n\250Z\306\345\270\265\247\261\210l\270\263\303\303nh\352\031\272\214\262\201=\250\250b\"KE\027\312\003\t8\345_f"
+	.string	"\3546\256\025kI?r"
+	.string	"\223W\200\270\300\335\327\275\225\225}S:\355\262\203D\027\005\206\311\255\335\242Z\271\341&p\377\246\321\n\226\r#\222\234zy\364\324\037\344\255Y\244!\330\215\353\301\376\006\365DT\350t3E\035\263\025JGl\254\003\252\002\3255\267\275=\3420iN\027\211\375\220A\271\203\037T\267\252?\024\366\320[Id\221\204\251 \240E\242\205\220~\254-\302\361$\365*&<^&\013Y\262I\322\220\003\335\373g\317S-F\026\2606\362\177\252G\235\n\355\317#\276\020\036m\211l\355A\276\307N\241\r\241\330\027\212\366YP\b\374\225\377\\\265\345\205s\"\bA\234\202\314zl]\363\0343k\237y4\374\340tW+D\312\241/\351\210S\371\265BI\216U\0361\020\311\2450\360}2Gf\250\216B\236\366\222\324"
+	.string	"\263\253uv\025U\232\332(o\035'B\274\340\263\025\033j\021F>\004\231\241\332\204\377,LN\252\251n\373\333\306\242\3470\016\t\222\033\325\331\300\252.=\004?\335R\022\247pq\360\206\300\332\277\233d\340\323J\202\352\245cTb|\375\232UR;\350\b\0065\367}\202\36437\002\002=\3756\017\001A\211^\213\365\220\271\353\004\0010D\335\370|\b\317\270\202~\033,5\013\352\320\331r\256\375\270[)\333\255\303\327\325\020\272\340&jG\250\3400\215\362\022o\370\026\235V\251\240\361tf!\3319@\030\253\306^\366\254\220wo\344\260\031\364\267"
+	.string	"\356\004\275\233\370j\306)\004\366\377\034)A\323\256 H\3545\364\311\343\334\234\021\324\347R\017X\305Q\213\251\370\247\240\3358se\\\204\234\333<l'\215|\335\n\330Q\031\245\312\306`\007-F\303\221\274_\030m\244\017!\367(\352\353\3668qR\n\300=\336\343\013\027\215\215'\034hI/\030\031\030K\f\202,\370\227\212Vd\240Q\263y\255%\254\333\023\346\252\304\245gY\2177\";_xe\333\001.\314\317\034\201X0-7H\322\036Ts\217=\004\302\343\372\340xw6\253K\315\310MzF\317\364FS\313\243%\301\271j\211\351"
+	.string	"\231\216\336\367\026\253cV\333\322\316\023\2527\004\024\034\005\336d\314\274\277[\354:\244\217\216!3\340g'\210\032\244\373Y\343\307\215\374\254\204S\342e\251y\206!d\243\353-\214\200m\212{(\345\326\251\254\375\264\251\032\363\373P\200\351n\373X\201\332\232g\206bDx\274^\372\331:\t@\335\2245\337>\270_?\2201N\222\375I\270Z\223\246\262X\302\270\330\305\021&\366\340\265\177\276\377\367\352\350\326*G\021\332f\031\332\262\240\324Z\314\223\023\362"
+	.string	"\232\226\364Uh\035\250\311O\333\265\177B\252\355\016a\035\356gK\210\233\210\250\207 \251\204Q\201\367\232\006\3340\265U:\272\223\031w\300\222\273\003\350\346\230\244% \230x\236\254\367h&\343g\307\364\036\332]\366\255C\027\221\275\027\263?\245\362\204\030\310d\202\232\363\027`\303\331\323\222a\037\007\263\343\346\230\307\341\232aF\033w\013r\324\343\247\007\310\031\217\303g\035\272\202\307\235.y\037{\3660\307!\001.\330"
+	.string	"`\344\262\242E\244\202\032X\313u\370N\276\to\037(\b'I\326<]\t+Yb\\)\252\200+\244\325M\035\352\321\024\237\315\327\331\317\\qc\316\210\3361\245\316\277Uh,^\210\257\275\300\262\023\314W\202u\363\t\216\020\007\270\034 \006\352\216\357\3072\240\351YA0\305\314\\\\\225k\227\217\003\206R\rQ\245T'\17705\241\224\365\300l\251r\332r\fR\257I\007\372\352\f\311x\355\312\322\323ff\\\017\207>\267 =@\315\206]\031\355\264"
+	.string	"\222\005\372\2739k-\200U\331\365G\200{5\222\320\251\201aT\253x(\030\"\215\361q\3578\004\003\321\274\246(\346\373{\026\356\333|\031V\212\001T/x+\321\202\357m\352\035\210\2173x\310\355\237*\301\211\206\033\212\r\275*G\341\373dP\205C\245.u\215+A\304\3379U;*=g\200\213L\246\356\221B\3728\353\314\204\200\247!Q^\221`\303\266\270\030-\031\365"
+	.ascii	"\327\254M\242@\314FxI\313\305K\232'A\246Xjf\273\200\027\347\206"
+	.ascii	"\306\244\036\026m?\r\t\322\315\201\225\353\304\311x\334\375Z"
+	.ascii	"\220\b\216\244\344\337\236\312 2\230zN\211\030(\372\341\202+"
+	.ascii	"\311\200\272\250W\177\360\371\256\335\365V\3004\261}|5\301k\243"
+	.ascii	"\0226\267\004_\320\300\357\001^\t\025#Iw\023u\236\001a}\206\310"
+	.ascii	"\201^\304D\003\372S\226T\374\202%\263'H\356\r0f%\201\310\233"
+	.ascii	"\275@\013M\303D\027+\0162\032\220'\017\037y\301\023\224\206$"
+	.ascii	"\002\t\\\255\204?l@/jWX\023\346y\277#V\304'9\224g\001\352Qx="
+	.ascii	"\005\324\307P\247%\256E9\025\376d=\227Z\363$\335P\031\3002fT"
+	.ascii	"<hg\222\231N4\307 J\024\246N\244\360qd\013\251fi\212\373\213"
+	.ascii	"\225s\265L\"k\346\2035\346\256i \217F\204i\357\270\316\001\273"
+	.ascii	":\360\0161=\255\003hIa!\245\341\314I|L\346\253\024?\213\034\210"
+	.ascii	"a\024k\342\344\300(*\0243ME\251B,\031\277*\217\350>\035\300\b"
+	.ascii	"\236v\362\205A\\\202#\2229\222\351\321\215s\227\234\2000\177"
+	.ascii	"\230\301\235\0030@D\304E\275m\377\025\fC4\346#\026\315\031;\233"
+	.ascii	"\370\335no1\243\177\332\013\"y\264\025-lO\372\320\237\266\r("
+	.ascii	"7\334\274\336\240\310\377%_\026\366\257\300\257\267\377\374\320"
+	.ascii	"\007\257\357\f\324w\265\035\031\246\221\326\207\314\302\353\357"
+	.ascii	"\353\264N\216\342\327\341'\347>\220\262(Z\374\212\373t\3221&"
+	.ascii	"p\303\205\007\254o,\215\027.\306\377\020\355\302Tn\312\032+\343"
+	.ascii	"\205\032\213\260\037b\356\270Y\274\033\203\013M\267\025B\323"
+	.ascii	"\037\272\fp\203\025\376a\231SMX\374\273\036\2267\232\367\327"
+	.ascii	"\324:JL\374t\026AFG\377\324\376GX\237\257=\320\021j+K<\331\304"
+	.ascii	"\237\342.}\3577M\253\037\337\373\\\236)L=\004\276\326\372v\202"
+	.ascii	"\301O\337\313\240\337{<\033LR\367\223\333)\351\357\037=\257Q"
+	.ascii	"\327@\372ka?\372\215\0371A\236)\304\025\304\023\302\216\305>"
+	.ascii	"\371\372K\313\276r\301J\355\347\001\365\374{>\202\235\241\374"
+	.ascii	"\266\225s'AL\222%pt\355\177\330~\276\221\241\366\007e}Ve\\\262"
+	.ascii	"\277\346\255\232\222=\270\352pu\267\235{z\230\b\032\257\234\370"
+	.ascii	"\367pWZ;"
+	.ascii	"\353\253\327\303\233(\324\346.#\360}vq\245\231'B\0234\362\234"
+	.ascii	"m\\\213;\211X\347\375\237N\365\345/;m\354\315\337>\222\037N\360"
+	.ascii	"\321\032GC\274\314\021~\375\214\217\215\337\344\345\"#\001{\362"
+	.ascii	"\203\356\241\025\007\274\375\217\360\225\017\347\254p\341'\367"
+	.ascii	"O5G\352^\247\347B1Or\302-{/%\314.\016s\257\205\177!\344I\372"
+	.ascii	"\037s\3760g~\237\347}=\374\314Oc8\037F\314\341<\356\203\376\307"
+	.ascii	"\322\\\200\274\332L1\310\354\\\036\037A\315/\353\013\270\347"
+	.ascii	"\364O\323Vn\363.vVc=\346\320/+Y\203s\334\352\335\006\374\216"
+	.ascii	"\216\275\322\345\003\336\207\364\237y\2566\346\234\200\277\267"
+	.ascii	"\007c\3328K\272\235)\357p~R\263[\355M\373C\232\371\211\277A\236"
+	.ascii	"m\355\377\311Q^4\177\326?\3609r\347G\007\352\"\313\344h\017\367"
+	.ascii	"\223eW"
+	.text
+	.section	.gnu.lto_.symtab.ad036f5f17281be5,"e",@progbits
+	.string	"gyro"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\002"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	","
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\003"
+	.string	""
+	.string	"firstArmingCalibrationWasStarted"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\003"
+	.string	""
+	.string	"gyroSensorBus"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\003"
+	.string	""
+	.string	"gyroMpuConfiguration"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\003"
+	.string	""
+	.string	"gyroMpuDetectionResult"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\003"
+	.string	""
+	.string	"gyroInitFilterLpf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\003"
+	.string	""
+	.string	"gyroInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\003"
+	.string	""
+	.string	"gyroInitFilters"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\003"
+	.string	""
+	.string	"isGyroSensorCalibrationComplete"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\003"
+	.string	""
+	.string	"isGyroCalibrationComplete"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\003"
+	.string	""
+	.string	"gyroStartCalibration"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\003"
+	.string	""
+	.string	"isFirstArmingGyroCalibrationRunning"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\003"
+	.string	""
+	.string	"gyroUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\003"
+	.string	""
+	.string	"gyroGetAccumulationAverage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\003"
+	.string	""
+	.string	"gyroReadTemperature"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\003"
+	.string	""
+	.string	"gyroGetTemperature"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\003"
+	.string	""
+	.string	"gyroRateDps"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\003"
+	.string	""
+	.string	"gyroOverflowDetected"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\003"
+	.string	""
+	.string	"gyroAbsRateDps"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\003"
+	.string	""
+	.string	"pgResetTemplate_gyroConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\003"
+	.string	""
+	.string	"gyroConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\003"
+	.string	""
+	.string	"gyroConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	","
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\003"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\003"
+	.string	""
+	.string	"detectedSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\002"
+	.string	""
+	.string	"biquadFilterBankApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\002"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\003"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\003"
+	.string	""
+	.string	"pt1FilterBankApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\003"
+	.string	""
+	.string	"sensorsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\003"
+	.string	""
+	.string	"fakeGyroDetect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\003"
+	.string	""
+	.string	"biquadRCFIR2FilterBankInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\003"
+	.string	""
+	.string	"biquadFilterBankInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\003"
+	.string	""
+	.string	"filterGetNotchQ"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\003"
+	.string	""
+	.string	"firFilterDenoiseUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\003"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\003"
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\003"
+	.string	""
+	.string	"schedulerResetTaskStatistics"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\003"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\003"
+	.string	""
+	.string	"devStandardDeviation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\003"
+	.string	""
+	.string	"devPush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\003"
+	.string	""
+	.string	"devClear"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\003"
+	.string	""
+	.string	"alignSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\003"
+	.string	""
+	.string	"firFilterDenoiseInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\004"
+	.string	""
+	.string	"pt1FilterBankInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\004"
+	.string	""
+	.string	"biquadFilterBankInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\004"
+	.string	""
+	.string	"gyroSetSampleRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.ad036f5f17281be5,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,444 @@
+	.file	"initialisation.c"
+	.section	.gnu.lto_.profile.e324208ce1fadf5c,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.e324208ce1fadf5c,"e",@progbits
+	.string	"(\265/\375 /e\001"
+	.string	"T\002#"
+	.string	"\004"
+	.string	"\243\331\277\247\b\004\002"
+	.string	"\002\001\002\002\002\003\004\247\243\326\333\005\005\247\243\326\333\005\006\240\342\234\212\n"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.e324208ce1fadf5c,"e",@progbits
+	.string	"(\265/\375 \033\225"
+	.string	""
+	.string	"P\017"
+	.string	"\001"
+	.string	""
+	.string	"\003"
+	.string	"\001"
+	.string	""
+	.string	"\002"
+	.ascii	"\271\\6\200\005"
+	.text
+	.section	.gnu.lto_.inline.e324208ce1fadf5c,"e",@progbits
+	.string	"(\265/\375 X]\002"
+	.string	"\264\003L"
+	.string	"\001"
+	.string	""
+	.string	"\020\217\205\327\237\003h\001"
+	.string	""
+	.string	"\002\b\224\334\236\252\003d"
+	.string	""
+	.string	"\006\200\200\200\200\002d\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\n\003\f"
+	.string	""
+	.string	"\220N\002\013\220N"
+	.string	"\002\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"?\003\246\231x\246\221\247\330\267\001,"
+	.text
+	.section	.gnu.lto_.jmpfuncs.e324208ce1fadf5c,"e",@progbits
+	.string	"(\265/\375 Z5\002"
+	.string	"\204\003N"
+	.string	"\001\004\0036"
+	.string	"wus"
+	.string	""
+	.string	""
+	.string	"\001\300\004\001"
+	.string	"\300\004\002x"
+	.string	"\001\002\006q\001\001\006q\001\177\001\377\001\001\002\006(\001"
+	.string	"\006(\001\377\001"
+	.string	"\002\377\377\377\017"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"x\232e\316\362\226p7\200\005"
+	.text
+	.section	.gnu.lto_.pureconst.e324208ce1fadf5c,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.e324208ce1fadf5c,"e",@progbits
+	.string	"(\265/\375 $\365"
+	.string	""
+	.string	"\260\030"
+	.string	"\001"
+	.string	"\002\002\b"
+	.string	"\001\002\t\001"
+	.string	"\002\n\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	" \340\r`\001"
+	.text
+	.section	.gnu.lto_.lto.e324208ce1fadf5c,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_sensorsAutodetect.32.e324208ce1fadf5c,"e",@progbits
+	.string	"(\265/\375`V\001\005\017"
+	.string	"\226\333dF\340\2246\0358Fq\312\003R\305\013KD\247\204\t\306[\341F\215\"\306\356\244F\342\370\f\367H\234\332\377\277u$\202rR\005\227\326\214\227\\\212\213n\n\036\017\257Z\205\260\210Z\266#(\0063\363\335\310\2262\245R"
+	.string	"M"
+	.string	"P"
+	.string	"*QN\024s\211\234\370\241:p\314\n@\307\234`\201\214\305"
+	.ascii	"3\313\003\204\206F\2229Y\333\252\270x\271*\372_]\302H\2413\242"
+	.ascii	"H\2276_i\240\207\007\022\024\324I\252\324\264\030\277\272\226"
+	.ascii	"@\231"
+	.string	"T\265\006sN\353\2102qc\267=\3016\003\373\25581rJ\372\363\025>=;vS\276\230i{\027\216\213\347\244>\326\324\006c\364\243\266\027\342\343eZ\222\3152\351\246\354\313\2717\366U\267&\325\273jU\365O>\264\214\f\t\262EX\263\346G\311|a=\\\\\365\3332\376\312&\017\024*\264\264d\307l\013\027f\226d\335]\0044Kl\f\277\221\0014\347\211\305\257q\033\0326\270\270d\307t9\310\350\020\243rDn\312v\212~m\021\247\037M\340\344\227\273:\320\234\223\305o}\006\b\237\3051\303x\372\361\230\357e\307\276\002\002\036\270P\304\205\334\003\357\033\361rb\321\312\310\353\302\020\330\205\bua7\3526\360\363\300\021\007n\243.\004\263\211>p[)`O\004\367m\241\347}\233\t\253t9\367F[\024\022/^\24559\310l\006\350\356s\256\003Aw\346,}\264#\\\207\004"
+	.string	";8\236#\035"
+	.ascii	"2\241\217)\260\002\215\203\273\021k\030\211\225\001\231\2606"
+	.ascii	"\003\001\003\177M\336\206\366\243Z\013`\f\311b\264 0\202\213"
+	.ascii	"\006\030\301\204\221\f\254X\025\311\212\271\3045\2615\013\375"
+	.ascii	"0\001\022E4\250\210\341.[\325\350\024M\355\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.e324208ce1fadf5c,"e",@progbits
+	.string	"(\265/\375`\013"
+	.string	"u\004"
+	.string	"D\006\007\001"
+	.string	""
+	.string	""
+	.string	"\002 \177\013\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\005\"\f (\r&\005\037\016\201\204\005\036\017\002\020\001'\177\021\377\037"
+	.string	""
+	.string	"\200\200\200\001%\177\022$\177\023#\177\024!\177\025\003"
+	.string	"$\003"
+	.string	"\n\320\360\372\250\001\001\204\001\003"
+	.string	"\t\244\001\003"
+	.string	"\b\204\006\003"
+	.string	"\007\244\006"
+	.string	"\021"
+	.ascii	"`h\327\320\3146j\324d\r\324\016\200\016\200\316\007\262\203K"
+	.ascii	"\037,\030.?0\032K\272\254,\203\206\201\340((O"
+	.text
+	.section	.gnu.lto_.refs.e324208ce1fadf5c,"e",@progbits
+	.string	"(\265/\375 \023\231"
+	.string	""
+	.string	"\017"
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	"\001\003"
+	.string	""
+	.string	"\002\006"
+	.string	"\002\003\b"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.e324208ce1fadf5c,"e",@progbits
+	.string	"(\265/\375`\027\026=l"
+	.ascii	"\n\265\370'S@\220J\352u\213Q:\261N\006C\352\256\3017\320\311"
+	.ascii	"z\200=\2077\351\006\0374\266\321\032\370\231 \345\\ \310\255"
+	.ascii	"\265p?\211\235\354\b\263g@\270\360\312\016\270\233\347FK]FP&"
+	.ascii	"wb\325\325<f\b\202R\367\352\001\"q\274!\271\335\366N)\0058\002"
+	.ascii	"p\002^\002(\323\203\376\334~PK\021\n\2078\\\366\260\373@\333"
+	.ascii	"\036\330\254\3311\343\002\231\2170\261\260\2641e5d\211\361j\265"
+	.ascii	"\210\261\365\016\215\246\323\364Z\353\320m\255\246\317\264Z3"
+	.ascii	"{M\243q\233\3514\366&\013\303%K\016}V\205\n\2022\r\246\347\374"
+	.ascii	"\367A\205\312\206\261\006\323M$\0054t\351+\346\"\3565\375\245"
+	.ascii	"\275t\223\210\005W^\322\376[6Q\302D\257i2\r\246'\330\376\023"
+	.ascii	"\212.\250\265\240!\23709\2341\t"
+	.string	"\200rZ\177H{\212\\v\251\313\316t\315\320\250/C\2208\312N\274\334k.\367\230\033\244\345rs]\241f\337\320\314\020\215\003\2270\301gP\353\257x\334fp\333\241\275\334!\322~\353\020)7\222\373@\377\270\334P\227\255\364\207\264\2674\227f\216\350.\334Z\235\205q\302\366[\237j3\005\212\215\313=\"=\337\336zD\312*\334\237\376\200%\204O\033\325$\304Q\346\006\353/\235\260\2633%\216rg1\027\365W?\351e7\271P\031\306\322\376\377J[if\177u\025\356\032\332\213\321\226!`.\342\376\352\255\356\002Q\343_\351c\200'a\266\306\330\376\333\241\240\241\263x\003\024%)\332\337\037\322\237\366\2202\213\333R\232\253\231BM\205;Jg1\016\261\375\345\177\353\203#&M\017.GY\203\313=\205\017\320z\023\\\300\345\026J}Z(e\235\213\366\222\271\235t\313^\236\374'\376\377"
+	.ascii	">v\306\007\233\243\255U\304\r\305CjD\266\357sZ\321B\203\215\243"
+	.ascii	"\356\227\233\375!\335i\017\251\210\376\22027\026s7\351+\241\263"
+	.ascii	"\310\224|\256\377\026\210G\0071C+G\271\355\017\351m\017\251\261"
+	.ascii	"a$\1770\263\032\346\366\321#J\212\231\275x07p\007s\327`f\020"
+	.ascii	"\314<bef\021\314^\206\271u0w\016\346\206b\356#s/1\367\f\346\036"
+	.ascii	"2\3673w\n\314\215\002s\307`\356$f\246\302\334%07\217\271u\314"
+	.ascii	"}\304\334\"0\363\016\314\f\306\314W\230\371\212\231\005`\346"
+	.ascii	"0f\366\267\267\2677f&\303\214\002a\006J![=8\377J2b<\214\203q"
+	.ascii	"\034\232\351d\336d\367\342am\310\334\006\337\242\341,\315\311"
+	.ascii	"|\314\271\004+0{\037/*3'9(\343\326\\\306\245]\306\221\271\214"
+	.ascii	"#\273\214\303\342!\305q\301y\335-A\350\224\037B\210Q\256\203"
+	.ascii	"\271\321\237\200\030\026\321+W\335f\351U\250\2041\265\227\036"
+	.ascii	"\334\1772+\213\177\271\025\257\301\275\034\213_q-\315t0\177v"
+	.ascii	"-\207\302AW\016\346MXi\375\306l\267\342\224\025|I\210\023*\257"
+	.ascii	"\001\3466|\251\233\310\366o\344\344\360fk>oG\210\\\001\200R\361"
+	.ascii	".&\2311\312\232\243\214\243A\205\311#%l\207p\n;sg\215\006\033"
+	.ascii	"\246\243\316u\216\265iA(\205'\213j\214\026)\354[\236\304)\211"
+	.ascii	"\032\316\342Q\272\310\226`\021\267\313\250\332E[\256\366\220"
+	.ascii	"\266~\206\225c\253\354byV3\335\211\343`w\362'\016r\342Gg!k\212"
+	.ascii	"\023\217\362&\335D\376<\021\315,mh\250\267\264\270\241I\321#"
+	.ascii	"n\325\205\212\006\237\301\257\232\351M\330\233x\016O\366\004"
+	.ascii	"\201\376[\310\201\252\211\003q#\335\344\332@\206/C\004\f\r\351"
+	.ascii	"0\r\351\021\274\250\f\316\244\231n\3451Py\225Z\227\225\277\340"
+	.ascii	"I@\f\213\033`\341\222v\301\214`)\"V\265\204\247\206\327\2221"
+	.ascii	"J\034\206\034\034\310&\026+\227Y\t;)\231\021&\205\3138\022FC"
+	.ascii	"\247\304\242\260\264.\243M.\243L\256\033q\245\273\320M.\0256"
+	.ascii	"\204\245\375\177\021\237j\246\033q\"n\304\221^\304\322z\222,"
+	.ascii	"i\202\225\242\214N]\224\tQ\312\027G=\210\013i\246\267\340C\236"
+	.ascii	"\207\007\255G\226*"
+	.string	"G\031\005rQ\270\341,)\243;.\243Q\327\207\377h\246'\275GP\373\337\225t\035.\005bX\\\341c\314\223\216\034\241\354\007[\320\320\320\215\220+N\214\244(\237g\227\331\245\230\307\251\243X\205M\213\333\202${a\207\343\3201\263\361hd\227O\261\313'\330\345\223y\371\314r(\037)\312,\253*\277\301\250V\222\347\024F}\361r\224\317#\227\317!\267\203N\251\313'\324\345\323\306\345sxE\2649\r\"\fXI\034d\356\f\3425\242\234\232\032\262\023\031m\347\037\004\b\247\251&\216\262\032\02723N\316\332\r\":\270\320\203}v\003\031\233\007[\347\323\351\224\363\325\025\303\231-<a\316\232\212'S\216T\326\ff\034=W@\333\224\030\261\230\2346\356\221\313K|.\371Zk\375S'y\242\254\022\332\001\202\204h\325v\231\317\031\314sFwY\300\365\302\243\320\226wC\303\366F.\r"
+	.string	"\275\320d2\345\362\031\354s8t7>\377\205aT7I\204fJ\254\334\255\317g\236\357n\335~0\235j\215\310\006r~\211\323\030\"\327\335\374F9\"'\tV\346n\314\336\246\311\032\f\t}c\2132\211\243\270\366\220v\224\"v6\250\220\265'\030\332\270\231\336\346h\250P\353\203\354\030\324\232\247\205a2\306\326Lgs2(Qk)\212\355\037\331"
+	.string	"\216\230\037f\320\034\345\033\032\227\335\214\247\261\237\3413\276v\377\277\247\232kn\260=\022)\204\303d\311\220\031\034\3655W\303Q\262$\b\223\243\256\346\236\306\325\260\2539\032.a\202w\210\256\206\376\013\273\021\350\351F"
+	.ascii	"\227\345\005!\224\024\3454\354r:\3452;s\372B\343\377\337\300"
+	.ascii	"\265o\034\356p\343\272\205\230y\372\354\004\230\031\375\2239"
+	.ascii	"\204\212\377\340\230\246\332]\342%\344\341\3503\256\371OT\006"
+	.ascii	"-P\036\211\312\034\305\245\362\203D$A \343+\203\305\345?\320"
+	.ascii	"\023\211A\025\311\007*.\377\3703p8\366\267\312\340\023\223\017"
+	.ascii	"\364\304\027\212(\022\225\307\342Rx\004*.\225\307_*\377\347\211"
+	.ascii	"Bc\r\342\033\201~\251<\363\313\344\361\247\270L\036"
+	.string	"\213K\245Ts)\246\271r\024\323\f\322\325O\212\304wj\222\022\032\177\232\3056\371e\377\315E\343\215\t\374K%\215e\302\034me\330t\032v\t\223M@\3230H\362\211\315bU\362\277jx\364\037A\260m~\221n\006\205H=\023\215\377\002\232\376\203\375\315\377\017\376\377\215Q\252\375\337\361S\244jj\372G\0065\275T\360\213\306\277s\231Y9\026\227A\222E_[K\252_j\203M\365eJ\343]\006\237<S\232Ku\204B\343\250\227\311a\001\215\232\366\306\365\263\036!Lh^+\2301\027\334\225\0271\314.\334L\357\342ewX\274O\314bK\373G6\200\343q\204\214\224\243cr\220Q\252p8\312)\361\272\330\re\250\332/\036,\257\267\342\bI\335\355t\t\354v\272\033>\"\n\261\256:\245$\337NG\315\251\310\341#\"\004X^o\305O5\352\361^\2500z\272\237\017\037\021q"
+	.string	"\302\212\026$D\224\260\363!\245P\177\276\024>\253\n4A\375\375\2640R}\270\273\031\227\244\262\253\214\026\002\240\274"
+	.ascii	"\222\317\207A\016\307\356TV"
+	.ascii	"5\362\261\300\013\200x\307\373\251=\025\306\345\bN8pB\002\024"
+	.ascii	"nX\002\024\017\240x e\tP\024\025\2418Qt\371D\321\311\262\352"
+	.ascii	"\017\310b\315\2451T\243\223E\272\300\367\323ap\243\376\200\254"
+	.ascii	"\356\247*%\251 \240,\037\0211\220\"\200\033\225\325"
+	.string	"!\001wH\272\035\016\273\346xJ-^\250*r+X\264\320Qw=\035\273\366x\227\315}\260\002\355\361X\364\326]\312SZ\3175\227\242\304\n\235\024%V\340\244\273\022\274\223\217\210V\240\032\203\3673\"`\315u\360\363S\331U\227\224\336\2501tH-\200JI\027\230\273kN\305\nt\241\243\346T%\031 \254@\027871T\243\025\350\"e\201W\206\016I5\312)\001/\313\376t\354z\177,\213]\017\230\201\322\007k.\206\252\002G\t\230cU\030)\037\021\035\260\346`\360^\364|)~*\253&\251J2\330\025\350\302\207\315\301\320\201\340\343\335\364\326]\216\247\264\356\250;^\f\325\310g]\325\237\221\221.\267+\301\373Q\177\272\023\214~\272#\0366'\301\r\333\003\372v9\025I)I\267\002\275PB\312\251+\317\327\353ARc\260\271\023E,\222.\367b\227\363\375t.t\370\210\250"
+	.ascii	"\366)\251?\022\254\317\367#\241\263\346R6W\002\002\266\307\003"
+	.ascii	"^\236`\202\024\"B\360@\203\273#\352\371x\254n\345!\351x,\257"
+	.ascii	"\307#\261\376|kO]I\364x\272$\022\273\337J\202H\0015\211\307*"
+	.ascii	"\371|\034\260*\214\237\216\355y\221B\305\005\276"
+	.string	"\237\f\030\027\210\227Q`\203\215+y$\253\202\374\341h{\365\337\372\354<=M%}8\032N\230\032\022/=r\224%\2070I\221\t\201\013K\213\243<|\r\0034LC\034\325\241\003\214\223\245(\324\212\tE\314Q\306\321\201\003\307\231\003\202/\027\304.\2214,\304\020\305g\016\0365Q\232Y\335\225\332\360\304\246\r\r\n\312\327\202\222\247\231\257\026\2544\225\340\016\305e\215\032\347\261\265\fh\203Z\263\372\300l\251\3554\362y\354\251B\362u\345\350\331t>\341\266\234\202\004\201\263\250\2010\250\0204#3#\"\")H\206\003\021\005\204 \352 <;\021\020-\224hjD\222$)5\006\232L\353b\2466\200\344R4q\270T\022\250\216\303\206\016\277\266Hf77g\325Y\350\021\377:\356\355\305\2764\336\023b\335qSr-\211\017\356K\023\245\3770yF\177R\342\331k\361\025\275\013\335A\337"
+	.string	"\366\240XY\006\206\211YN\324i\214\245\223\210\024\t\351\323\343\004\300rpp\2136z\351\201\032'\"MS\225\247\027KT\nm\233\235s"
+	.string	"\305\220p\246\222\247\303I\316\245M\374uY\222\363\311]\307"
+	.string	"\224\307\332:\334\3176\324|\301H9\206\034\342M\304\2216\n\017\036E\013\241Q\321\374\f\360Tae\254\363\211fK6\344\333\327\203\307t\347\216\332\332\003\355\201\2005[\243\035j\364\365\375b\260\006\241\221\364T2"
+	.string	"\340\344\351\241\277b\007\325\314\002^\265\350X\272B\304\260\036EE\215\246\367D;\276\275\210M[\201\016\335\230A\212"
+	.ascii	"\300O\225DI\315\210'$\360\314\207\034\006\363\311\354\203V\377"
+	.ascii	"\177y\347"
+	.string	"\210\036\005jc\335\206\f\377\3518\221\361k\017\320\275\336\374\230\3211\317u\273T\256\343\336\007\374\033\375\267K96\026d\016\306\350|\022\353W\347\263`V\342\0329.\256\324x\207\317\272(\"S\211\3673]\204M\273G\0349\306\366 :N\244\344la\360\370\243pb\211)\026\204|\372\234\261*\315\211m\2277Y\276\215)C\245P\323+\366%\007\222jg\330\321TaH\220([\232\3270-Xz4\352*\235\210\235\310\021zbC\377\002~\246\037\2309\357\357\363\210\332\316 \367\343\242\231\243\230!x\213\326\323J\007\305V\036\374\223\026\265\202&d\235\177(f\221$\\\241C42\330\227\354\220l'\300\240\363\306Q_\300\004\204\311\242+\207\031\f^\027\221\354\226\3678\36796\031\200g\251\275\b\362\304>\206\213C\255\023\324\005\263a\177\330R\230\214\315\0260\214\237J\322\305#3\223\214o"
+	.string	"\224\021\301\n\330\024N\222O\322\1770\030\345?\005<\257R\276\313+M\257\"]\027\236K\335{K\013\304\230\377\312%4\233n\312\036Z\340\314\334$\331\370\202\t\t"
+	.string	"3\224P\350\372QQ\362q\240\336\004F\256S5\253)R\301\255\f\262\216|\376\016\3671m\3652Y\003P\304U\300I9k\321\025C\271\222\304\274\357\325\220\027\341\200\320\276\262\216\237\b\036\034V{\230\234\217Lp\255\023\032a\231\347T\260\221-\305\325ZS\200>\326\343\211\003\347\256\037\006\250E\371\240\340}\221q~\2446\277\261\331\350\346\241]\214\207)sEv\003$\212,\254\304\245\272\247\236\002\260%\274\371|q\020|=N\215\353(lB\032C[-q\354R\264ZDQ\024,\367\273\036\033"
+	.ascii	"\214\261GW\212n\002'\021\034(V/\324s}\271\256\330\272\325\365"
+	.ascii	"j\016\265\3138\264c\004?\336\207\r.3\305H\233\351\223-\r\bg\237"
+	.ascii	"u\236\341s\037\214QHA`$\020\305w\311\"\n\317/\376j\001\004\240"
+	.ascii	"\374\271\0236\354\216>_\245\306m\032>kp\003*sgD^A\322\2375AI"
+	.ascii	"\370\326\246\335\235\227\237\371\314\337w\376\341\352=\353\212"
+	.ascii	"o\321\345\032\326%2gF\375f\350*"
+	.text
+	.section	.gnu.lto_.symtab.e324208ce1fadf5c,"e",@progbits
+	.string	"sensorsAutodetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\001"
+	.string	""
+	.string	"detectedSensors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\001"
+	.string	""
+	.string	"requestedSensors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\001"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\001"
+	.string	""
+	.string	"barometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\001"
+	.string	""
+	.string	"baro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\001"
+	.string	""
+	.string	"rangefinderInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\001"
+	.string	""
+	.string	"baroDetect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\001"
+	.string	""
+	.string	"compassInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\001"
+	.string	""
+	.string	"accInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\001"
+	.string	""
+	.string	"gyroInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.e324208ce1fadf5c,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
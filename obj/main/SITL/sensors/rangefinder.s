@@ -0,0 +1,1028 @@
+	.file	"rangefinder.c"
+	.section	.gnu.lto_.profile.c5e3bc5cbf5a02f,"e",@progbits
+	.string	"(\265/\375 \fa"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\f"
+	.string	"\024"
+	.string	"\026"
+	.text
+	.section	.gnu.lto_.icf.c5e3bc5cbf5a02f,"e",@progbits
+	.string	"(\265/\375`\372"
+	.string	"\205\t"
+	.string	"\024\f\356\001"
+	.string	"\034"
+	.string	"\221\263\200\221\n\004\002"
+	.string	"\002\001\003\252\245\264\225\f\f\002\003\002\004\004\352\263\360\321\b\005\240\342\234\212\n\006\007\241\215\260\245\013\022"
+	.string	"\002"
+	.string	"\002\005\002\006\005\002\006\b\353\252\315\223\t\t\n\013\f\323\367\216\316\b\034\002\007\002\b\002\002\005\002\b\002\t\002\b\002\n\004\005\002\005\005\002\005\r\016\017\020\021\261\271\315\302\004\022\355\310\243\346\b\002\002"
+	.string	"\002\013\023\024\331\251\374\200\f\002\025\323\277\377\256\001\n\026\352\333\230\303\005F\002\f\002\005\002\r\002\002\t\005\002\r\031\343\333\242\326\006\b\032\334\357\225\372\003\033\224\364\364\260\t\002\002\n\002\b\034\241\311\237\334\003\035\214\304\227\326\005\036\037\240\342\234\212\n"
+	.ascii	"3 p\002\202\310\272\001\274\221\341\275\315\225ugXl0\330\002"
+	.ascii	"B\314\275I\374\230\303\3300FL\001\016n\006d\340iAh\002@0|\013"
+	.ascii	"{s!\344\323\232\201\300\316\350\017\363r\251\271\301\357U\310"
+	.ascii	"y,l\302Qh\035\340\177g1\367\231\217\313wcFE\350\017g\003d\200"
+	.ascii	"7\270\006\266f\324b\334\367s\260#\215L\334@\213\353\006"
+	.text
+	.section	.gnu.lto_.ipa_sra.c5e3bc5cbf5a02f,"e",@progbits
+	.string	"(\265/\375 \203\275\002"
+	.string	"t\003w"
+	.string	"\f"
+	.string	"\002"
+	.string	"\020"
+	.string	"\007\003\001\001\002\001\200\004\003"
+	.string	"\002\007\003"
+	.string	""
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001\021"
+	.string	"\001\022"
+	.string	""
+	.string	"\024\001\001"
+	.string	"\001\025"
+	.string	"\003\026\031"
+	.string	"\003\032"
+	.string	"\003\033"
+	.string	"\003"
+	.string	"\002"
+	.string	"\r"
+	.string	"9\002\226\"\3763F\317\340(A\224\272$\2502`"
+	.ascii	"\204\003\303R\242\315\f{\003X"
+	.text
+	.section	.gnu.lto_.inline.c5e3bc5cbf5a02f,"e",@progbits
+	.string	"(\265/\375`\252\001\305\n"
+	.string	"&\221;80\217\222\016@\227\342\230V\203|\fR\247\r\330\353!\273.=\032\3759O&\324#\204a\f\215\1778\230Qd0\320d\242c\265\320*\366\206h\032o\213\206\032\221;\005)"
+	.string	"/"
+	.string	"*"
+	.string	"\240\206|\"\256l\316\330\275\241\354A\2151\306b?\327\314\317\217\344\n\221\257%(\343\032\221\360$A\f\026\327\313\300o\327\"\220\343\305R)\f\200\215\211z\021Cr\342Y\223\310>\004c\214\023\331\246\247C\266\351\303=G\260%\005&\3433\274\363r\203Z\376\232jk\001\235\367\375\005\260\207\375t\002\361\330\366\364S\224\271\363\034\354\316#u$\306\310\320\2121.\274\375\235\327\022D\275X\252\206>,\005\377k\252\215p\360\3673\004\r:\031\023ti\241l\244\206IEGj\225\013\376Q)\276\025*a\324\357[\241:\023\324\224*Y\t\370s, \200\242\"V\347\001\347\017\304\016'\223dBh\321\207\357\006\304\337Eq\323^\006=\314\317p\306p\b\021 \006s\211\0028\317\213\220`\256\005\346\321\201\202H\377\307i\251\035W\f\364\030\302\220!7\2172B\031"
+	.ascii	"\264\216\037p\025\200A\302\370y\306\354\2541\320rw\300\"\263"
+	.ascii	"\330\202\360v\373\235)\302.,\312\020"
+	.text
+	.section	.gnu.lto_.jmpfuncs.c5e3bc5cbf5a02f,"e",@progbits
+	.string	"(\265/\375`~"
+	.string	"\335\005"
+	.string	"BJ *\200EI\00730\2431\335\356!3\006/\006\024#\223\357\306\224\320\017\341\031\305\203\032(\303\036\370\007\3767\324\330J\326&R\246\377\221\207\374\243\325\301\370E\243O*f\002\357G\374A\322x@\032\260\\\240b\271LY\275\337 P\372#\220\244\201I\377\257\320\03012b\345"
+	.string	"\211\256\032\332\026\271\276\365\252\277]\177\242&\312q\210a=\026\260}^\005\361*\0161\303\332\247\r*\037\26273 \026"
+	.ascii	"G\270!\206\201\362\355\002\001\261\311\004\202\005\341\\i\001"
+	.ascii	"\322\300\312\020|\205\311\316\205\341^=\024\376tV8\352v\212\305"
+	.ascii	"F\rR\025\001\356\322lE3\343\323\300\020"
+	.text
+	.section	.gnu.lto_.pureconst.c5e3bc5cbf5a02f,"e",@progbits
+	.string	"(\265/\375 )I\001"
+	.string	"%"
+	.string	""
+	.string	""
+	.string	"\f"
+	.ascii	"\230\004\003\230\004\007\230\004\f\230\004\021\230\004\022\230"
+	.ascii	"\004\024\230\004\025\204\004\026\230\004\031\204\004\032\204"
+	.ascii	"\004\033\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.c5e3bc5cbf5a02f,"e",@progbits
+	.string	"(\265/\375`1"
+	.string	"]\004"
+	.string	"\202\306\017\020\260Xm\016"
+	.string	"\245\177*\311t{>\t\"[\006\252\272EY\031\306\307\201\f\213\347y\005U<\002\262\016t\326\262K"
+	.ascii	"\236\327%\273\304\0161y\026\350\220\2472\351\352Y;\3634O\006"
+	.ascii	"\\#\" p\202!D\017\345\212\006\264W\0311\032F\315\013Z\006\267"
+	.ascii	"W\217\340\250\205\335{>\023\216\343(\2046\002z8\fa\306<\311{"
+	.ascii	"\327\334&\031\273\266\261\217\177\307ms\211\336i5i^\027\276\235"
+	.ascii	"!Kq\001\004.\334\020"
+	.text
+	.section	.gnu.lto_.lto.c5e3bc5cbf5a02f,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_rangefinderConfig_Registry.37.c5e3bc5cbf5a02f,"e",@progbits
+	.string	"(\265/\375 \234\225\004"
+	.string	"D\ba"
+	.string	""
+	.string	""
+	.string	"/"
+	.string	"\005\001\212\001\206\200\200\374\342\203\316\301\025\030\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\334\007us\250\356\006uq"
+	.string	"\005\001\006'\001\001\217\004?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"!./src/main/sensors/rangefinder.c"
+	.string	"\004"
+	.ascii	")\"\301$\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_rangefinderConfig.39.c5e3bc5cbf5a02f,"e",@progbits
+	.string	"(\265/\375 \034\341"
+	.string	""
+	.string	"\017"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001\b?\202\210\200\b\177}\273\001"
+	.text
+	.section	.gnu.lto_rangefinderDetect.40.c5e3bc5cbf5a02f,"e",@progbits
+	.string	"(\265/\375`\340\001\325\021"
+	.string	"F\341wH\320\362&\035G\\:X\3454\322\2359\021c8\324\351\314\215\205@?\0209F\301\321=4\205F\202\225\376\2336\241\3608\020\217A\317\210\354\001\266T\207\207\315\255]eT\202\037\221;\372\351\223<3%Z\333\233\354\235Rb"
+	.string	"Y"
+	.string	"j"
+	.string	"\013\314 u\352\361\005\352i\352 \365\324\266\033<`q\354\243\016\r\312\345\005\314\317\322\356\330M\024\217\275Rn\312\230/{Uz:A'\013\037\033FA\342\210s\034I\221\rf%\276p\bh%\230\336s)#\316\344T\211.\034\311\356\256\304\027)Q&\273k\031#\212\270Q\267\275\301\366\004[\216\004~\212S\207+\3621\247\376J=\345n\032\365\364=\227G3\266\233\035\233\026y\263G\231\2349\366\271\335]O\232}\236\037\365\361\247\322_\251\340,\3658\340c\227\346\326\2646*C\205m\026[e\233\223\037a\236\2737O\016\244\264\337\342;,\347\001q\002\2734$\242\3351\251\217T\"\230\210\316P\006\225\322\255f\024\244$@\336\006\347\255\032\340^\265OP\344c\034\"\024\303\3662ev\252\271\335\340b\365\363&j9"
+	.string	"H\324\264S\276\031\"\264c\233M\331\216\224\316\326,\316*p\025\215LI2\351$wW6g\216S\207U:\351\214\216\032\322L\3760\235\265\273\200\211\034\355.\004\337\347?*\001^X\341\243\340\201\254\017.\220%\301\200\007\3175\335*\001=\327\013E\203w\362b\201]\b~\341\313\013\273\027\n+\245k\201aW\222\300\037\007\017\354:|\037\330\251\306\375\244\271\032\205"
+	.ascii	"\032\342\336\363\b8\232\200\206\350\203.\247\214m9m\3222]\352"
+	.ascii	"g\334\266\340\252\261\202)i6[x,\t\n\"\007\274U\355\013\030$\f"
+	.ascii	"1% p\0022Rz\003c5\230m\300\364\361 w\030F\331\002-K\272\225]"
+	.ascii	"\241\021\364\020c\360K\0324rd\306\323\354\231\304\370@\242W\311"
+	.ascii	"\306\351\215\3516p\255\271\021\204\321\021\327\356\256k\353#"
+	.ascii	"\036ZT[\362@\310\2174\200`*\024\007\306IO@g{\237\360\236"
+	.text
+	.section	.gnu.lto_rangefinderResetDynamicThreshold.41.c5e3bc5cbf5a02f,"e",@progbits
+	.string	"(\265/\375`'"
+	.string	"m\007"
+	.string	"\342\r34`o\032\003T\236Y`\005\020B\320gG\3342/r\3329(\232\r\235id\365\210\255\225\306X\335\376\273\215\030\030(\004\334\250\3421\030\350i\333{K\231R\345h$\266\220u\030\260\206l#\343\224\332\314\260\031\263\316\306!r\344\214\032\201j\017\230\214\021\232&c\246\273\253CR\302\307)\004+J\340\026\302&\263Dad\262\347j%L\342\t(\375/\250E<2Qw\330*\305\347\231\263U\177.[\b#\020\r\223K\350\245\332\016\364\340F\353\352\220\324V\363\250\026\003\226\037#\365\362\223\245\342\321\326\231n\355\212\273\322\215raq\202\372\037!\2077\277\255v\210\0018\021\310\017s\360\277\217\023e\270\320m\007\332\306\266)\001\013"
+	.ascii	"3\241\233\037\230\310\334\n6\001\225\034e\325\203.\344i\301\216"
+	.ascii	"\227!\300\245[\264\363\t"
+	.text
+	.section	.gnu.lto_rangefinderInit.42.c5e3bc5cbf5a02f,"e",@progbits
+	.string	"(\265/\375`\317"
+	.string	"\025\f"
+	.string	"\026\327SB\020q\233\016\033\203\323A\221\003]\024z\0037\242l\006I\204\216\"\226z\022\204\"\035\r\224B\355\333\353\2323hUu\202\326h\331/#\021\240"
+	.string	"X~\335E\264\025\230g\340r\200\326\337\237l)S\nA"
+	.string	"?"
+	.string	"C"
+	.string	"\016\2617N\240 \304\333\277\322\310O@\210\260\270\354~QO\276\035jn\276\306\023\035fH\256\360@\211\f\222\2157\202\003ZH\3348\312\323\203G\312\244<\273\353\354\274\017\367t\333\flG\373\016\002)W\321|\023\237\234\001$\337}\362A0\237\256G\271\001\016!p\224\244\250p\371b\177\243T\023\373p\265\204\3554\3454tZ5\235\231\276F\303\272\344X0cw\344\205\307\322\230`\234\260\003/t\264\214P5\261\275aT%\254\330 \345\016\007\310\324\2438K\004"
+	.string	"\245]\356\235\375\371\n\020\202\322\356vT|\245\nY\026\346\223]\341#\337\251\022\330\240\"_S\037C\244\207\261\247\270\220\331%u\374\006q\262j\302eQ\250B\327'\213Z\206iW\245\305\313\372|DP\246EN\001c\026\252,b\300\260,n>\356Pa\203\032\"Z\270\310\2638\245\035lSj\017\247#( \355\007\020\362\035TUQ\006\022"
+	.ascii	"\\\b\b\303\366\026\016\324\202 \232\025\2026e2\361\257\232x6"
+	.ascii	"\003\201\201\rB\016\273\252m\027F\256a\332\f\226\3075\327\"4"
+	.ascii	"\215AA\001"
+	.text
+	.section	.gnu.lto_applyMedianFilter.43.c5e3bc5cbf5a02f,"e",@progbits
+	.string	"(\265/\375`\022\0025\022"
+	.string	"\306ayF\320R%\035\020\3243\235\3216\250a\257\223X\374\025\243\300^9\203\005\373\027\255_\001\362\2350A\256\375\267q)\362\206\226\205\225\252-\255g\220k\362"
+	.string	"?p\022\263\317%\235\207\315\312'0\245\376\017\262\367\2262\245f"
+	.string	"^"
+	.string	"f"
+	.string	"1\256A# O\304\246\205M\022\326\234\323U\340%\362\021>\200|\\\021\257\235\223\021\256\326|\231S\244\324y2\347D\274\016\227\320\244\n\306U\313\263\201%8C]\215F\235ChR\"\325C5\342\321\350\302\001\267\0319-o\003< \325Cu\024\327\033oF\225\2230\347\264v\036\207\033\344\266al?\260uB\276\233\344\3437N\345(\261c\323O\207\272[\324\326$\267Oq\005\302j\n\212F\263l#\031\335\037\373\373}\337\347\365i\275\350\347\254\206R\275Q\255Q}"
+	.string	"1<X< @\315\211\363\375\230Q\221\211\004\324U\325\265c\354\021}Q\315!s\206xZ\232s\236X\001\310\243m\337\304O\004\033\341\203\317\215h\007\3169g\334\237\323\244\377\342J\264\227\226\226\035;\b\356\202\263\322\201\345\303\246\237k<\035\321\200\373\023o'\251K\340f\205tC\227\305\273\036\t\376\325e@\004Us\233\321\317\334\332\206\371\212\232"
+	.ascii	"\2409\247\003?\351*d\276\320\2435\270\270\310\307\223\021\036"
+	.ascii	"~t$;\371B\316\340&}\367\030,1\330J\312\213\302\313+&b\025\224"
+	.ascii	"\331k%\006\253\360b\211\245\314\\\264\231\214\026{\321\\1XJ\213"
+	.ascii	"KeFs\241\030\260\354\302k\346\302 \223\315\\#F\363\353\343\005"
+	.ascii	"A\221\333\220N\266\026\356\215m\270R\207\307\2663\220#\321\033"
+	.ascii	"]\206K\003\033s\332\336\3050\314\202\276k\355=\036\232\225\371"
+	.ascii	"\201\262\252\226$M\356\222\004!\341`\332( \220\"\231\273\036"
+	.ascii	"\371\001Wbxu\375\235\216u5\330\325-|\251\"R,\0031\313\3714q{"
+	.ascii	"qx\006\354|\262AY\013vc\025\002\222\027\025\376%\322\206\267"
+	.ascii	"\330\2668\0060=\352\366\320\362\272*\030\240\370-4PApCfK\242"
+	.ascii	"\327\031\377\356\204\"]]\273\341\256\224\227\225\231="
+	.text
+	.section	.gnu.lto_computePseudoSnr.44.c5e3bc5cbf5a02f,"e",@progbits
+	.string	"(\265/\375`\002\005\375!"
+	.string	"\366\377\333F\220\234M:\321\250m\362\n\244\"\202\300nP\201\220\030@\263\006\2556U,\315\275\177\220k[xC\034@d;\242\345\334\t\023\260\002\360\035}\002}\346+\237\024\266V\rU-21\340\301\326\324\332&D\312\224\002\306"
+	.string	"\267"
+	.string	"\322"
+	.ascii	"R\216e\327\314\342QL\366\020C"
+	.string	"R\226e\215\205]\373\2506\223?t\315\207\3423\372\tK\250\bO\270\230(\370h\t3U\373N\376\204\351\302\026&\313\222\307\027\256\262,\027\270\301\354\243\221\370%g\302d\237\n\177@\321\202^A)`eY\336\200N4?\352\205\346\307\365\341\361\242\360\236\352\373L6GR\\\365\371.>\373\360\030b\340\220\303c\306\324e\"\255\353\312\226-*(>\bR\204\310\265`\350\244\021\251\361qV\343\244\370\036o\206G\0035%N\020#\325\344\303\037\025\201\262\241\242\324WL@%F\312\026\365B$:\323\303\353\303\353S\024PUV\241,K\253S\324\214\233v\333Gl\343l\361L6\210\020\363N\342\032\301X\027\326\335\235]Mq\276\005V\367MC\200\257r+-\374+\247\300\351\235p\363\343\367\303#\305\320\021\207\252\311\324O\307l!P\327\252\313\323\232 \336*\033\351\200\325G\027\376\005H\365"
+	.string	"\253\003<\353.\"\"\325C\244Z\310\246\016\262\251\001\330\324@=\352\037Rm\363Q\373\220\352\236\232\272v(7\255GM\222\352YM-#\325\223\246\036ij\221\246^R\255\244\372\b\206\266\206k\302\370\360\3325\302R\306\030\236\322\314\250E\310\263~(\237\251L\247\216:\355\333\217\342k\271f\007\017\230\236\265d\344BX\312\370\220\005&\2640\373\350\007{\255\217SZSv\203l\241\021c\\+\377\356\272\362\002#\235\233>+b\350F\215\317\256\024\226\235\251\002\233fA\325\025U\223\034\342Z=7}3?\223\333m\3300?\216UQ\220|\375\226\346\030\031p\f\354\313"
+	.ascii	"\226\035Tv\255<~i\326V\200\216;\3036/4\314\265\005\363/M\331"
+	.ascii	"\326\226\366\004N\023\025\271\266u\357\342\373aS\226%\004\277"
+	.ascii	"\353\\8\370W\037\275\242C\007\2479\003\226\\QJPL\266\263}P\354"
+	.ascii	"\247\345[\226z\036<\314\217"
+	.string	"2\325\341\240\274\273\346\334\001{\254\213J\200p\021\251\203\3655\356\\\261\253\211\314/\313\255\2501b\303\212\032#;J\233\302\330X\230\270\343\022\310\323T\004\250c\016Rg\271\305\027e\371C\332\r>\301\240wB\005N\351\246\333))\355F\020H:O\267aGbE\256\207\2024\241K\"\201\313iX\312\351h\036\301\200\227#\241K*\2213\241\303\361n=\336\256\247\313\365n\272$\234\322m\004\257wcp\344\035\212\034\357\246b\267\343\335j\302\337\267\312\247\301E\364\3357?|\220\354h\003\004X]\340L\234DK\333'[h\217H\005\357Y\241\235t\200aC\333\263\326\246/\332\016\211\\Ze\202b\262\2652\tfD\332'\211\022#O\346E\373t\255gh3\025\334\032\017\\\360\021\026\334\"}\337$\332\247\207y\321^\354\342\\+//Z\244\375\215\254\261&\252=\260\007\260@\033\264'Z"
+	.ascii	"\253y~\026h/\342n|\2636?Kj)Z[]\250a0\246\214B\310 \221\021\t"
+	.ascii	"HF\243B\007`\002\0319f=\020\210F\322\244\003\006W\325 \267\365"
+	.ascii	"/\263zE\210\220\fM;i\343\377\006&\257r\211'\266n`zi\252\265\332"
+	.ascii	"`6\355a\342!\007\003?\016\373\316\b\373\364[\233l\342\t\353}"
+	.ascii	"\355\340e\331\234u\331\361\333\333 w\241\261@\300{\202S\247\263"
+	.ascii	"Z)!\227;\240`\013\367G\370\213a)o\231hd\210-\356\262)\030Z\227"
+	.ascii	"\300\032n\016\373\026\225\336\016)\233\2608\226\\\272\227\221"
+	.ascii	"Y\314\201\t\367hz\311Q*\337\303b\301\324w\r\035$\001Tu\221\332"
+	.ascii	"\250\031b\217\360\331;>\310\311\271#\005S\257a\306\013\021\207"
+	.ascii	"W\256\276\241K\232\323\215L?\245\231?"
+	.text
+	.section	.gnu.lto_rangefinderUpdate.45.c5e3bc5cbf5a02f,"e",@progbits
+	.string	"(\265/\375`\315"
+	.string	"\245\013"
+	.string	"\246\225PA\020Q\225\016H\214\001J\005J\021\210\035P\222>\033\201\301\032\232\360\233!\212\013d\305\006\322\310\242\333\316Z\306\006\001\305O\260"
+	.string	"\341\005:!s\276\367\300Pa\025n\361\2731\375\034-\331{\357\224\002<"
+	.string	";"
+	.string	"@"
+	.string	"\236\361p\264G\215\310\240\302\306\356b2\304\273O\031;\377\246K>\320\363\331\341rRB-V \2407\r\254H\036nz\324"
+	.string	"\202b\214(\330]\307\017\344p\323\333^`\333b\337\022v\350\211\022\204\375\271\273k)\262c\364i\b+\006\203\032\273\033Z\254U\321\024\211\211\355G\373%n\242{\t\203%\273\037P.v\303\003F\320q:\340"
+	.string	"\256\323y\312u\352\316\001\373\371\307\202\253\254\220\366H\321Py\322\023W\244\320\013\351\355\272\204p\222\341E\034\2665O\261\t\260-\374\304\005\030\355n\202\023G\301\361E\234\372B'\376;\365;\327\351e\304\203q\243\364\211\255\334\203L\223q\260\321\262Z9\230\017c*5\213\240e$d\023\264K\305\270\272qZ\306aZ\346\242\3010\225\303*\004\274U\310*\266\331\266\212M\302\375\\)r\203\034\252\217\004\315I|x\024\205\002\243\r\023"
+	.ascii	"3\241\207(\006\211\241R\277W\023Z\2015\020_-\340\201\253/\354"
+	.ascii	"\352\203\205\227\246\265\271\b\001\222\213\265\304j\212\270\313"
+	.ascii	"S59ES{"
+	.text
+	.section	.gnu.lto_isSurfaceAltitudeValid.46.c5e3bc5cbf5a02f,"e",@progbits
+	.string	"(\265/\375`\333\001\275\017"
+	.string	"F]jF\340\264&\035\224\030\2562\315B\220,\365\335\310=\325\307\002\006\214\243T\244\371\356\304~68\001fF\215\345\271u\233\271\274\262Qq\375\254\262\272"
+	.string	"\023f\b1x\342{sAII&\217\270js\032\331{K\231RY"
+	.string	"L"
+	.string	"_"
+	.string	"/\0210\037\261\202\245Cd\316\327\266!\336]\223\021\256v~\352\2326\232\021\004\353\341\361b.\023\3149E\036\006\215\320\300\016\020?\f:\334\330 \362.(\024y+]H"
+	.ascii	"\250\004\f"
+	.string	"\001\036\013n\031b4w]_<\225\2526\232sZ]<\rw\350\266S\2667[\021\004Oq\033\224O\342\321\026V\364.\217\376\212|\374\336\365\0059=3\233\026\375\354WJW\306\376~\337\367y[\266\325!\253\245\252\243\325p\325\253jU\365\001\250\354\005\212\007\0212'\314wd\352\2101hl\263\330\"7p\300\342\356\001*\223\356\242E\334\001\255\240\231m\310\206|\220\235\204\313\301z\234\234\247c\001W[\005\325\334\204\007 8\021\3228\212\334\2050\303\003\206\243t\025(:;\343 #\306\b\\\231\327u#\314\334\244\034\206\243\033s~jt\266\252Ad\255\"\277\007f\\\260\034+-b\373\364\033\225\320\234\363\201\0036!\341H\022L\245\t\244\023S\t\267\241\270\023\312DBm\246RI\312f\302\2416\022\005>Q q[\205\323\211\333D\257\371mY\341cW}\354\232\017\320\216l\037{"
+	.ascii	"\037\037;\262\370w\362\256\027\220\241\225\373b[\256G-\253\202"
+	.ascii	"s\316\251\305\325\rm\374\301:\021#  \003\231\t\346\001\030\002"
+	.ascii	".\341\300\\\201\354\366W\027\205\257,\325\205\273\230\203\026"
+	.ascii	"\267,\323\245\221\323A\305\025\006&\026\320\304&\231m\227!KZ"
+	.ascii	"\325\355\204\306\332\023\330\023M;\210\370>\365K+\307\355\001"
+	.ascii	"L\271u\252\216\001\005"
+	.text
+	.section	.gnu.lto_rangefinderProcess.47.c5e3bc5cbf5a02f,"e",@progbits
+	.string	"(\265/\375`\320\016%B"
+	.string	"\252k0\030EP\332R\007\177\363\027\0010\004\220\202DF\001mS\255\236@\355oP\230:$\312R<\225\t\003\275\r(\217l\024p\341\200\246\021O#HW\017\212\b\373\032\271Z\215\327\240T\027nb\352\355\336{o)S\ns\001P\001x\001\022\342\027\356\307w\337\035\206\373\321\335\265v\377\270\227\203\361T\307\272q\236\273P\257\314\363\274\344\n\342w\215>\371\276\333\376\317\373\256\273\373\002\0070\\\37693\034\177\266\350uE\234\3479\246]\344\345WJ*@"
+	.string	"i\200\200"
+	.string	"GF"
+	.ascii	"\212\210\206\204\232\314e\2202\t\364\343\323\303\263\243\223"
+	.ascii	"\203<\342\030c\370u\333\255e\177\234/\254W\322^>\251\313\027"
+	.ascii	"\350R\305j\002v\217dW\247\007\bH\2227g\345\003\264HU\332\346"
+	.ascii	"\321\224\326\250JE\033\001\220\362E"
+	.string	"pS\023;)ql\206\344\240>\021UN\017\251A\343\264\220\032\024N7[\036\302%X\236\017Jm\231\240U\322\376\332D3\245\274\351\245\333\007\271\245i%\332'\321\220h\240\351\377L\217h\037#\337\323\0320\322&\367\210\b\236i\036\263\337\341\003\242u\242\237\363C#\371\240\3211}l\233\3210;\236\017j\326\"\355\021\021|5\250\017\215\243\0065k\215\346y\346\203\212i\343Q\f\267\f\270\020\307\236\017\n\326\"\023\275\310\034\277\274\364\373Cr\204\275\333\"\275%\342\351|u\265\315(\\F\216_\\\272m\027P\371\262\323\371\332js\330\316\250\275\365\217\324\240^\364n\177\302\254\374=\037\264\332\"\370[\023\373\352k\032_ZZ\303M\363<\273~~\345x7\360\356\232\320\335\235\334\221\320\356O\357\305\331\245\035l\352\245\355\256a\203\376\347\336\005\360\332\364v\347\360w\035\266\274u\317\302\244v\377"
+	.ascii	"B\377So\007xlzZ\033\313\017\251Y\240\270\256\377\204\244\351"
+	.ascii	"\313\333\322\211>\200\360\310\266[\3520\336\305\273\264\207\246"
+	.ascii	"m\326\254\217~(\217\025\001\001p\236\263\376i'\365W\300\272\275"
+	.ascii	"\264\337\372/\355\301Cokc\351\277\265\260\272\375P\357o\022V"
+	.ascii	"3[:\321\335G<\025\250!\367\250\237\"\2454\233\347\371\001\335"
+	.ascii	"K9\341?}\327\247P\350\177\276\353\217\342}\367\267\333\224,*"
+	.ascii	"G\315\322\213\356sZzK\335\177/..\266\361M\346N\327\216\001\326"
+	.ascii	"\376\344\332/\300\332\235\236\372\337\004k\237\360O\336\227\\"
+	.ascii	"{Q\254\235\b\326>\024k\027\202\2657\215\332\231\260\366\245\326"
+	.ascii	"\036\244\265+a\355I\255\035(\326\376\023k\367\201\265\367\304"
+	.ascii	"\332y\\\373N\254]\007\326\236c\324\216\204\265\037a\3558\260"
+	.ascii	"v#\254=v\355o\254\335}\265\267\260\366\375j\327\256\366\317\320"
+	.ascii	"\200,:vD\306.37\343Xt3\353\271Y\322\376\311\277\373\373;\371"
+	.ascii	"\353\213\207\342\033\007\032\231h\334<\317\307\237\363\267\372"
+	.ascii	"\361\211\213\030\013\032W\t|\242\231\347\371\300\273\036\333"
+	.ascii	"\205\"\370\026\345\220\tZ\363\323\374\204\275,\203\373\253\313"
+	.ascii	"G\364\217\261\t\373\257\257\247eqQ9g\226Y\372l0-\026\246{\266"
+	.ascii	"\317^\372\275\351\036N\036=A}J\236%\255#\307\322\357Y"
+	.string	"\270\263y\366k\250\214c'\351\365U \035\004\332\206\\\245P\343\237\2059[g/\375\274\024\375I?\235\261\236\261\377\356\214\372\303$B\203\363q\267\356\222\253\020\"\270\336\322\\2\0229MV\242\344}\027\366{\026\272^\331\036W\317\226\372\362\345\265\027\271[X\263z\326X\362\232\377\324e6\271Mn{\337E\356\bhI\242r`Yz1\220gK_~\337\310nrx\344!\032\356li\341\267\261\216\t\242s\334\211\316\"36\207\317\302,28\373\270\233\203]M\252\304\033g\277W\300\344u\251i\351E\007J\003\b\230\263\245n\334\361\326T\371\355\017\235\261\341~\220U\352\303r\005\331ry\271\372\272;\tI\240U\314\226Nt-tD\200\034\235o\2747\023\353\0304N\302x#\247Q$\3776\260T\016q\344\367\335V2\334\013\312q\340\206\271\302\274Q\335\355.\313}V\256*\001w\035"
+	.ascii	"\013N\372\237\356&\302\023c\306\030\343\375\356%\323w\267%V\346"
+	.ascii	"$N\360{N=\343\035\026\321\260\035#\246\335\016\360\344\216\242"
+	.ascii	"\214\365\301\262\322t\2155\373R=+\331\273wRQTP,\256\246J\304"
+	.ascii	"R)NPU`\221b\312\303UU\024\322\243\022XI\225\240\2322!u\202\n"
+	.ascii	"\312\212\351\312\252\352\212J\352\212\211j\nJ\005S\224\325\025"
+	.ascii	"S\202#\257Z!e\305\304\242\252\312\212\3518\227\365\355\274\311"
+	.ascii	"\374\253\177aP\006\0356\351\025\377\255\237!\360\006\035v\377"
+	.ascii	"\340\027m\032\356^\264\275)kk\265\363<"
+	.string	"\317J[\232D\264\301t\224\353\320&\262>\031*\300Lk\343\203\200\320\234\\uPmn\241\r_\345\234q\\s?\335\331\377\016k\233\027R\3263\267\211&\314\355*z\001\033\260\334nmA{\271\335k\327\230\246\255\334A\373\273\324\264\266r\277;\362\270t\241\231\t}x\t`s*\315\226\034\271\334\270\031\35257{:\002$\267V\264\206Qs*I\356\t\331\377\302\246h\343hK\275i\003m\022g:\315\2611\032\3206\262\255aC\335K\002\335\210\031\351\251Sivd\n\032b4\316\360\303\254\374\241\001\330R\327B?\3700\363\007\037'\033H\207\035z\305\017:\313za\2110\354\277\376S\226\220\016\333\374\301wn\032\356?gf\316\375\323*9\024\264\226\241S,\332\322\355\2641lw\320\313\355\257e\322\247\275Cf\310\246\347\207\232\035D\203\177a[Y\315\020\221\207\\\330\360\226\341\0335"
+	.ascii	"\234\340\331\220\206\262>\253\230"
+	.string	"\006cv~BN;DY\365I\007\321@\234\002\201+\250\2010%\215c\206DDD\222$\205\f\007\241\205\306 Ia=\021\340\2503\020\242\031\251I\352\264\033S\021\013\210\332\377\352\361sF\nV;\370\017H`\366\227\t\017\027&\263P\376%I'\311H\342\362\026\267\"\216\233\276o\215|\341\316{\272\347\261\331\304c`\232\206R\210\216c\231(\033SS\331\330\277\267a\260\316\252&A\"l\240\221\274T\004\202(H\274\002@\370@V\222P%utY\032\301\331\027A\340G=cN\364&\n\305\230\374\244\203o\336\202\020&\234\214\274\356\243x\034\336\270H2?\024\301\306|\315o\rL[1\212m\303\231\2351\303\304jV\221\203Lu{\030z\361\323i\240v\337{\221~\246\237\001\257\003\337\255\374\270\340\325\220\341>\001\202f5\232\222rd\244\007u\204~$\347 \317\002{\233\300\224\r'"
+	.string	"\251\203\274\336J\364v\307I(\007\227;\330]\205\351L\211i\205R\214\273\304\215\374\2616!\372/\252\301\f\333\230\364\210_V\002\264A{n\274Z\\J\243\024\032\274\375\357\360\344|\324\343_\201|\350\260\230\260\215\247Q zx\246\307\360\210Y\330\233\326Th\033\243\005\254\264.\310\264\3349\236\263\\\235\310\b\243\201\355\021*\331@\341\312\177\027\236\004\234\364]\300\216\205\237/\303LY\346\214\333\371\207\035i\231\r\244[\357\020\372nO\007\t\241\241\307\177"
+	.string	"\034_\242\243U\305[\020\341J\261\267b"
+	.ascii	"\235\025WpK\275\272\233\0234=\350\276+\307\372\001*\362\305P"
+	.ascii	"G\227\210@r\372\310L\221\037h\026\331~|"
+	.string	"\271IC8\024G\357\021eY\252\204\032\357\351\234!\204\225\323\034\367\323\003"
+	.ascii	"\244*\n\360\337\255\265\236h]\202C4;\253:A\251\334\205\314d\001"
+	.ascii	"W\374hR\033J\223^\334\021\327\263@\323\274#9\364\346\037\020"
+	.ascii	"\224\325Wx\354\242F\366\343K\206\n[\304P\005\331TTCSC\300t\""
+	.ascii	"\026&\307\274H\375\374e$\336fGs\234\230\013EO{\020\234;\200\247"
+	.ascii	"m\2024}\315\313\250\001"
+	.text
+	.section	.gnu.lto_rangefinderGetLatestAltitude.48.c5e3bc5cbf5a02f,"e",@progbits
+	.string	"(\265/\375`\007"
+	.string	"-\007"
+	.string	"2\31624`O\322\001\024\302ak0\212\262p\342\307a\017f\350\247\202\b\033\201n\ri{\240\307.B\005lH[\005\301\301\200\341V\003\355"
+	.string	"&4\032do)S\n\326`\342\244PQ\013\023C\225\211\360\212\326UM\027\254\250L\003\324\304\013b\fl9L\021>XV\204\322\266w\253 \353\305\243\023\266!>\202\005\354.\202/\362-\302\327\370\263\304&\237\375\371\233\350/U \304\223!{\353\244Z\330w\253 \333\351\324\202\016\025\252d\367\023j\331\224w\302a\233cK\276\307?8\306\334\226\241E\033\037\n\022\226\335\205\227\023D\177\356\003\321\237b\034{b\376A\356PVL2\255\363\004H\330]g\246U\334z\333\007\266\241\355\213\b"
+	.string	"\002\013\255\262\030\005\205"
+	.ascii	"]\303o#F\026\"\017w\305\324N2"
+	.text
+	.section	.gnu.lto_rangefinderGetLatestRawAltitude.49.c5e3bc5cbf5a02f,"e",@progbits
+	.string	"(\265/\375`\007"
+	.string	"-\007"
+	.string	"2\31624`O\322\001\034\240G\254\313\b,\004\031)\030\246\240g\t\027,T0ZC\332\036\350\261\213P\211\037\322VAp0`\270\023\003\025\2019\036\321\336[\312\224\002\346h\242\2440u\026$\206i\023a\025\251j\222*8u6\r\220\023+\250)0\345 E\370@Q\021b\262}[\025Y3!\235\260\r\361\022+`w\021|\222g\021~\307\235%<\371\353\316\367\274\273T\201\221P\216\354\f\224\232a\277\255\212l\247S\0170\256\362\262[1r\331\024w\362a\373cc|\220\207|l\265\214\003{\036\027\024&-\273\0133'xw\355\003\357N7n=-\377\"o(+,\027\006z\002$\354\256\363\302,n\275m\003\333\320\266F\b"
+	.string	"\002\013\255\262\030\005\205"
+	.ascii	"]\303o#F\026\"\017w\305\324N2"
+	.text
+	.section	.gnu.lto_rangefinderIsHealthy.50.c5e3bc5cbf5a02f,"e",@progbits
+	.string	"(\265/\375`6"
+	.string	"m\b"
+	.string	"\306\020<6Po\322\001\340\204\276:"
+	.string	"H\240^\255%\221\257\026\371E{\253znO\276[\353LO\264!D\345\231\001\355\335\314\354M\333\335\336\020\251\304\304\212A\330Q\312\224\002,"
+	.string	"*"
+	.string	","
+	.string	">@\370\030\364-e:G\212$\362\262\273=\3258\350\t\362\017r\007\263rR:\205\236\327\302\356:K\247\213[o\333\300\366\263]\022\245\253\002\306HC\366\026J\315\260\017\260\273kE\331N[\231\326Lg\246\177\t\230\244<\214\354\232V1\213\342H:l\177\354L\027\013\351#\365\252\232.\026\036\243\\\331\206\370\346\t\330\335\004_\365\020\315\337\270\263Dt~\264\356R\013TT\242\\\331\245MQ\221\017\346h \306\220u\0320\207l\003_\204Z\314\260\370\262\316\306\36380>\r\201\265\b\f\276\tM\203/\263\355\025e\351\200HG\326\226{,UK\003\t"
+	.ascii	"2\001\3378\003\354\005{\314x\354\031\336\270\006.!H\270s\246"
+	.ascii	"v>\001"
+	.text
+	.section	.gnu.lto_rangefinderInit.part.0.72.c5e3bc5cbf5a02f,"e",@progbits
+	.string	"(\265/\375`\035\004]\031"
+	.string	"f\354\234G\260ZQc\034U?\261\030+\212\206\323`I\261\023\302\263\240\025\205y\222!n\030,\362\004r\365\274\031$\310\033\366\224\325\n\2458\356\016\307\024(\237\200\217\301\037$\270\375w#\242\321\003\275\360\347o{\357\275\245L)\204"
+	.string	"\203"
+	.string	"\221"
+	.ascii	")~f/Z\204LC\232r\300[\224\366\024\271\021\025N1 \275\321\320"
+	.ascii	"p4\245\311\351\003\214\027\313\003\030/\336\276U|\347\0175(["
+	.ascii	"\316Wz\272\342;\353\344l\265{\357\212\352\353\206l\225\315\302"
+	.ascii	"V]<\316>\f\206d\330\266\017\003\026>\237\336b|\307\r\027G\200"
+	.ascii	"\367\246\254\213v\307\317\333\032\236~Eg\020\335^\367\035 W\266"
+	.ascii	"\370\230f\324x\305yH\376\334{]\332\270\305\333~`;\203\035\266"
+	.ascii	"\bBV\2677\234\t\207\234&\322\311\t0\n\247~\367%\036tn\367\312"
+	.ascii	"\216\362L\036%\326*\243\"Kd\033\304\231\200\004\330AOb\346\334"
+	.ascii	"\356\275\r\226\216d\204\217t\321B%\352\321\213~\t{\335+\022\016"
+	.ascii	"#\233n'\253\301j\217l\303\207\327\352\260]mCV\327\220\325\252"
+	.ascii	"\262\232\246\254N\225\325%YM\246\252\307\262Z,\253\303\262\332"
+	.ascii	"\222\325u\254\276\001\036$7\266{c\004\317\\#\261I\217#C\016\253"
+	.ascii	"0\246\0020Tp<\331t\273\236\017\371\023\207/\035j\271s|\352\023"
+	.ascii	"w/\247\357\351+\257&\304\226\213zk\264O\335\271\264\2668A\001"
+	.ascii	"F\215\326>\225\236E\002\026\221w\240\332\023*\324\243\243]\260"
+	.ascii	"d\n\226\231%\262hm\013\257\342^\016\025\333\005\375\025\250\241"
+	.ascii	"\265/`\250GE\213\240w.Y\264\\;B0\370Tt\257l\307\332\320\236\366"
+	.string	"cV\203\256\326Z;\206\006%\253\301KiA\210b:\200R\355M\216'ev\032\356\304)U\344I&\021\264\202\231!\\B\"\314\021. \030+\006{\305\\f\214\345\022\0022\301\n\202\305X\253\004~\2350a,\024\257\027\214\245zx\255\016_w\n>\245\245^\375\317\321\306\302\260mc\375#\2633[k\217l\327\230\351QO`$m\215=\201\013C#\242\002\3728\223\216\376h\254\312\206<\232\225\224--\215%yd\334+\307\330/\361\330\225\366?\234\217\006EZ\377w1-\037\311'\2203\351L\032/\332*\350\317g\220C\265\002S\250a4\003\2312\306\314\210\f\311\004\205m\306\240\002\231\262\3326\021p9D34\351f\3773-W\221%\363L\322\336\253\335\323`Xd\336b\360\004\260\305\337M\303J\3343\032Bx\251@\004A\2612\344\330YFh{WN\227U\2332}\375\220"
+	.ascii	"y\243\260\310\312h\201\264\245\372\344:\310c\035\3756T4\332\004"
+	.ascii	"\210\264\275\345\360\220C`\366_\025\317\217\361X!\220\246\355"
+	.ascii	"2\372\325\303\270S#&\211}v\331?V\253\223\320%\376\245\263\244"
+	.ascii	"\353\016\361\341\311\0069\030X/\\\326g\235\307\3775(P4/\323\206"
+	.ascii	"Jd(\326T\222&\202\325\n\237g\246"
+	.text
+	.section	.gnu.lto_.symbol_nodes.c5e3bc5cbf5a02f,"e",@progbits
+	.string	"(\265/\375`\217\002\265\016"
+	.string	"\024\025\213\003"
+	.string	""
+	.string	""
+	.string	"\002(\177#\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\200\202\202\200\006"
+	.string	""
+	.string	""
+	.string	"\0055$ 9%\002+\177&\377\377\377\377\003='\200\204\001"
+	.string	""
+	.string	"\003\005>\023?(\002,\177)\252\347\213\327"
+	.string	"\301"
+	.string	"*\303"
+	.string	"+\304"
+	.string	",\305"
+	.string	"-\002\310"
+	.string	"\177.\204\202\202\200 !\025\201"
+	.string	"\005\036/\0370 1\002)\1772\272\200\202\002*\1773\005\"4\002-\1775\002.\1776/\1777\373\005;8<9\0020\177:1\177;2\177<\005'=\205\204\001"
+	.string	".pg_resetdata"
+	.string	""
+	.string	"\005%>gistry"
+	.string	""
+	.string	"\005#?\005\002@\0018\177A\037"
+	.string	""
+	.string	"\200\200\200\001:\177B7\177C6\177D\300"
+	.string	"\177E\302"
+	.string	"\177F3\177G\3774\177H\003"
+	.string	"#\201\001\204\001\003"
+	.string	"\"\344\377\220\375"
+	.string	"\001\304\001\003"
+	.string	"!\204\006\003"
+	.string	" \235\200\357\202\003\001\244\006\003\003$\320\360\372\250\001\001\344\006\003\007%\204\001\003\f'\304\006\003\f&\204\006\004\fU\003\022"
+	.string	"b\003\022\f\240\341\365\321\002\001\242\001\004\024\321\231\263\346\002\001u\003\026'\304\322\276\365\026\003\202\006\003\026'\343\234\306!\026\007\352\225\237\233\002\001\342\007\004\026\315\033$"
+	.string	": \240\002\261\242\342\0064\262p\233\177\225=\336`\356\256\323 u\020\323\320s{\350Qe\214\326\200fAn=>\002\310\350\237"
+	.ascii	".\301L\320%\200c\340\360\004\242\261K9\2670\017kt \364\030\325"
+	.ascii	"\016_\262\r\321n\361\271L\2375\303/\267c\223\210z\002(\354A\310"
+	.ascii	"(q\200\215\005\032Q\262$\340\220\003#c.\311\311\206-=Rj\361("
+	.ascii	"\217v\036p\331\300\370\323\300\354\314\257~hx\262\326\023"
+	.text
+	.section	.gnu.lto_.refs.c5e3bc5cbf5a02f,"e",@progbits
+	.string	"(\265/\375`w"
+	.string	"u\007"
+	.string	"\346\3233*`k\222\016\263A*\b\202 \bb\203 \b\002D\222\004\007"
+	.string	"@"
+	.string	"\004\307\226\037\364\376\370\277u3\371\355\223&\2665\262e\n("
+	.string	"%"
+	.string	"("
+	.string	"\217\227@?=\\\202x\304x\031\207\036\374a\317\347\305\206\234\2339\376q\360\325p\247\341\312\341\327\254\326\3538\311\357Y\021\253\311\222\373\312YN\267E\342\224\210K\372R\204G\375Hy\313!\345P9+w\372M\271*\277\336\354\220hJ\375\205\306\025\372\t\215#\364\r\032/\350\0234\236\261<\246\374R^\351O\372S_*WY9\230\365WW\235\342\254"
+	.string	".cn\340&\227Q_\027\270\034\300\337\320\350\237\321\370\030\375/,\277E9E\371D_\242\037Q\016\321\370C\337\241\337\320g\b\n"
+	.ascii	")\021O\0235\267\202\245\261m\033\362\030J\350\n7Z\226T1\304\263"
+	.ascii	"\004A\n"
+	.text
+	.section	.gnu.lto_.decls.c5e3bc5cbf5a02f,"e",@progbits
+	.string	"(\265/\375`Y(\275\271"
+	.ascii	"\272%\375@W JQ9\351Z\317?\f\026\332*\252a\320\236\3324\n\340"
+	.ascii	"o\017\\\267\371\310\275\353\247\350~5\356L\t\030\027\332;?\356"
+	.ascii	"2\270\233G\026\317\252\201\334\353\006\034/\307\333+P\206eP\242"
+	.ascii	"\036&\3204%\022\204\231\023\250\304{\207\372\313\310I\375\377"
+	.ascii	"O6\275\267\224)c\003\n\004#\004M\325V\033\242\250D\300\203\233"
+	.ascii	"\273\267\371\226\372\223\336W\255\202\237\033T\334\313\274!\301"
+	.ascii	"\023+Zl\330\335{\225\r\243]tVc\365\213\216\301e}\305`\316w\354"
+	.ascii	"\346D\315\017D\026\207\326\f1A\266\253,`\343f\254L\253\320-\254"
+	.ascii	"\223\256\025Xh\026\357\026\254\266\343\265D\016\310\030\364\355"
+	.ascii	"\005}[A\337IP\f\272F'A\250\020GJ\333w\022=\343\241\034g\f3\371"
+	.ascii	"B\007\343\r=\273"
+	.string	"\241Amh\033MA\317M\264\210\201\240\234\206\325p\231\021\257\t\3520\263\342\205\236\215z@F\275s\025z\024\350\225P\f\236\030@\337$\003g\213\374\310\202\327\026n\214\316\335rK\214\266<\346gz\356\335\320\373AF\210\263\355\331\360\013\377ut\320\264\321Zk\033f\305\nd\242\264-\3430\f\346\277\227\350\247\206\013i\250\332\336\001o_Z\312\214\0171YX\013?\331b\211{r\325\226\335x\013\227i`.\347.\354\3459P\315\333T\323#*\253m\020\017\365Z\001(\b\356e\r=\316\313c\r\275\253\361Po\007\213\206\"k8v\264e\363%\271\322u\326\226\331\232\255\360\2253\033W\351\221b6{/\024s\207\037\346\0169l@\240\234\364\354?@\327|\240\270\265\320\266\306RX\255\231h\222\n\313\212\266<\205\251p\331\331\030\355\274\204\323\256#\325\274N\366\321\226\364\321\266\210\207z\337"
+	.string	"E\341\343\263\365\230\311C\275\b\240\360Y\307\351@S\321\366|\366s\223\231\260\231\006\356\225\272\367\002\200]\264q\ti\313M\330\t\227q\340'\317\200\203\327d\223;vo\023\310'\316\2218o\332\336\002\364\354<\206\267\313\001s\350q\036s\350\031\361P/\2073\364xI\322\231,CO\271l^ \353U\207\025\326\326*\3719\t\217q\250TU\314{voS\b\250)\303\312\253\355\233<\324C9C\2571\2645\3729H\310C{0\300\337Yx\376\312\241JC\357\257C?w\260@w\360\240\213~\256\240}\177W\360\263\016\320\317=\033\276\363w"
+	.string	",\370\253\217'`\001\374\274\201\350\347\357\274\377b2|\314{\376n\363\344\260\2779\364\206\237\341\376\246\200\350%d\240\211\016\200\277\211\374\034\327\030\022\340\363\367\006Z\350\347\007H\320A\r\264!"
+	.ascii	"\377)\350\237\313ii\237/\335\363\363\013\315\363\337l\350o\032"
+	.ascii	"?{\370\271\353\177\377u\204\237\251\374\254\366s\332\317S~\216"
+	.ascii	"\3623\332\317.\364\316\317b?C\371\331\254u\376\312\343o\364\357"
+	.ascii	"\234\277\345~\026\363\363\333\317\\~v\373\271\355g\266\237\253"
+	.ascii	"\374\354\365\363\325\317U?\267\370y\352g\025?G\375\034\202\237"
+	.ascii	"=\360s\n?\237\360\363\323\317\306\237\235~&\376<\374y\351\347"
+	.ascii	"\340\317\277\2373\360\363\005~\246\300\317%~F\300\317%\374\f"
+	.ascii	"\201\237/\370\037\347\347\005\374_\363\337\313\317\3743\b\377"
+	.ascii	"\325\376[\371o\342\177\004~\026\3613\207\237C\370Y\202\237\023"
+	.ascii	"\360\363\006?'\375\214\364?\355\377\223\237\217~\376\360\263"
+	.ascii	"\001~&\300\177\022~\036\300\177\270\377_\376\267\375\277\362"
+	.ascii	"\177\355\177\211\377g\377\307\376\217\360\337\355?P^^^\336\237"
+	.ascii	"c\342G+\370)\270\022M\373\302j\313\255\355u`\240tt\315\206(M"
+	.ascii	"\263\347\214\223:(69oC\202DY\243F\r\034\264\312\022\262\344s"
+	.ascii	"n\216\2376\347^&\036\330\016\223'N\2568\317pY\237\341\247\355"
+	.ascii	"\t\001\3139\363\"k\205 d\272\f\231\226\353\335\313M&\2262.\256"
+	.ascii	"\345\320d\004k\226F>q\274\252V\260y\313\261\261 \326U\325\366"
+	.ascii	"\350\026ztJ\314\030f\263y\312\270\245]\034\364\2765`\332\255"
+	.ascii	"\303\360\027{\227A\367\3628\003\346\203C\357sC\337]\270\237n"
+	.ascii	"\375\205\315\212\222A7j\f\0320\337\024\364\276$\350\231\315z"
+	.ascii	"?\342\336\342\326\\X\rM*Q)Svs\276/\364>\032X\260\264\026\364"
+	.ascii	"\336\373\201f\334\322Hky\352X\271\223\253\362Q\241\3156\326W"
+	.ascii	"\230\255(\331\274X)\346\232 \336\253C\337{C\017\202\333\205\261"
+	.ascii	"\256r\266\242\024\317\270\245\221\253\274 \336SC\337\033SS\343"
+	.ascii	"3[\245.\324\022\260\226\361\374\352\255\200V\326h|f\223MnrgJ"
+	.ascii	"M\315\230\335\275K\020\354\344\253\211\023\216\231YOI\203\301"
+	.ascii	"\0215)\357)\314\326Y\242\342\276\332\366YG\001jc\367\002TGi("
+	.ascii	"<D\216\350h\3232xz0\251\256\314r\272\352\312\244\311\241e>=\254"
+	.ascii	"\330\304\332P'=P2\320\276\240\221\235\313\232\254\231\200\260"
+	.ascii	"l\336\244\017\315\234r\t\242\007F\314\254\255m\223\321\300\270"
+	.ascii	"\003\323\3669M\3649CZ\350\261V\302k|[(\0370Ee\356*\225 \236\263"
+	.ascii	"\003}\027i#\357#\377\217t\022^\336\244\232\242;f\334\322\356"
+	.ascii	".\225F\177#y'\001J\222\025e\215Z\217\314\220\034Sj\320\336\205"
+	.ascii	"R\336{]\3444\2572\252\347\234\303l\364\373p\265\267\376\032\206"
+	.ascii	"\315\233D\363\242C\305\322\240l\274\350>\347y\257\024W\022\004"
+	.ascii	"\256,)\256\031TN\256\233\224\n\222\024R^\256$\225\363^\241+%"
+	.ascii	"\225\034\301\274BT\316\233uU\274e\361mr%\257\024\363\n]\251\013"
+	.ascii	"UD%\305\225E\345\204\312\022\242rre]'\327\r\272RPJ\026RW)t\235"
+	.ascii	"\\i\256\223\231\025D\345dfQ9\271h\260\017*1tYT\274\272h\360\032"
+	.ascii	"\225\324\275\262\322\202R\006=\251\232\314\013w/\237\255\270"
+	.ascii	"J\001\334\253\305T\302A\315`\265\250\347U\324\024(\246\006\253"
+	.ascii	"\250.\346\225zR\ra\336;$\212\351Zm\220l>\257\017~&\275\264n\325"
+	.ascii	"\212{'\270\315{\255\356M\362}\336{\223\367^\237R\253yo\215 *"
+	.ascii	"0+\253{\227DVW+\271\266\342\336>\213S\313\242rv1\223\326\236"
+	.ascii	"8\301\356T3\311`\027\216K\211:\223Ln\325\032\024,\353\205\032"
+	.ascii	"%=$\0055?\264\204\241-v\333\204\351S\241dpIk\333,\350\210Ys\343"
+	.ascii	"\254\355\255\017\260\0319l\224\324\271"
+	.string	"\021\022\004\205\345rI\333w\220\263\237\027eFj\264\355\025\222\336@>\370\362B\322\266\366\227\n\255\343EW\213\037o\037tk5\\\264\355\301e\355\243y<\003\016\306\222|\364\0166\373\251\367na\001\273\267I\364Ag\b\2208W\326\336\306@o\257\216\033\371\334\211\2112\342\365\316\301\023\306&\266\243L\033VC\0027Wg\3674~\2361X\013^\346l4\216\326jf\337\350\256\346\352-.\353\034\275|\323\350\032isL\367A\334\026\236]\2313f\266\360\354:\007\277\351\031\033\242\250\354\226.fr0\033V\373\221j\336,\017\310l\341\231\351\034\214\206\331\370\271\374 \254\214\0069X\216\237?P\315\253\364\340\314\026\236\035\321\207\017>j\326\20281X\333<\253jh\313p\256qAI\333W2\364\032\364UO1\035?\317F\214\2411\034\316\213\343%mE\032\336m\250.<\026\305O~\366"
+	.ascii	"\001\211\333\234\006?\327]\005I&0\206X\251[\025Oc\263\270/U\200"
+	.ascii	"\332\314\274\3061c\223\026\355\336\025\312K\245e\304[\334\260"
+	.ascii	"\244\264\275M~\255\247L\233X\233\2665\357k?\323\222\345\353k"
+	.ascii	"<E\252\334\250\264\255x\257pp$\305\212\254\241\225MuS\337t\271"
+	.ascii	"\201\262\232\202\276\336\241!\013\002\327\266\332\241+\200\310"
+	.ascii	"<X\025\242\3309\333\276\332q\031\037\2550/\035mk]\322k\233\034"
+	.ascii	"\032n9\276\332\362\244\251k*\035\016-\027O\332\036(\b\372\252"
+	.ascii	"\246w\244\205!6|\021\370\b\363&\316\030W\351A%\351p\264\255h"
+	.ascii	"^\347\\L\t\271;\203\325\245B-\r\372\0373ppU\216\210\231LC\200"
+	.ascii	"$YuV\354*\0258\033\\5\356U\356\001O\200$+\031\237%`c\256\220"
+	.ascii	"Q\023r%\204M\333\377\220\205\tS\305\260\2164j\214\330\375p\241"
+	.ascii	"k\253\276\360*\206M\007/\006\332V\235\027/\365\355\230u\006\213"
+	.ascii	"\021_\2249&]_^\337ze,\324\260\322\266>\233\310\0213d\276\312"
+	.ascii	"\270p\251n\034\324\214\002s\007\306S\327b\r\025\022\364Y\262"
+	.ascii	"T7nr\261\210\310r\304\321\031\371@\021\223\312j-\257n\026\f\231"
+	.ascii	"\030\270\016\353\202\205\347\246\355}\254\332\332:\f\204\263"
+	.ascii	"\013\225e\324\226\034c\304\356*\261\200\020\002\362,\262\205"
+	.ascii	"\355g\353'\366\005,5\035\2608k\200\224\355xe\201\313\352\216"
+	.ascii	"Z%)\352B))\022k\366(y\013\003\323\326\205\246\224O\005\032R\316"
+	.ascii	"\214\240\347\261\260:\004\216H\025\033\3632V\227\264\260\245"
+	.ascii	"\256Y\317\370\271\f\272Rhe\346\306\246\324\026\252\330OR\350"
+	.ascii	"^\257.`hu\255\252U*UJM\343\262:\245\222y\251Sj\221\232d\214\313"
+	.ascii	"\207\017\037x\304\260\021\362\374\261a7\263$\356\2542\251f\374"
+	.ascii	"\\6\257\013\036*,\200YB\251Q\270\254\236\235i\360yC\306nI\317"
+	.ascii	"\354I\217Z\013\033Smk\031;\335T\360Z:\341\262\352\234\n\203\023"
+	.ascii	"\244mmr3,\222-T`\2631\326\222pi\373\236\030\350{\260\320\367"
+	.ascii	"@)A_\230\273\321\005\017=\217\035Z\215\324#\\\346\241\"\351/"
+	.ascii	"8P\234\240A\317\036z5/\217=\364\316\023\207\236\347\r=\017\227"
+	.ascii	"!U\314\251\205\256\213\030\233\201\341R\025\225\005\255A*X\345"
+	.ascii	"B\242\266C\212\220\b\374\360\"\245\255\005\322nB\300\254V\370"
+	.ascii	"\201\013\002\205\311\227\224<:\032m\353\017t\005\217\024\017"
+	.ascii	";7\320p\330h\373\372\343\257Y\325G]v \017N\233\266\207\343\241"
+	.ascii	"^\345\221\364\332\203\247\313\2259\262\266=<`\350\371\bW\345"
+	.ascii	"k\227\262z\031-\223k,\020{j\201\350$p.\210\264m\022y`\321\202"
+	.ascii	"\263m\305QsT\256*U`\264z\240\257\314\235\036o@\210\264\355z\343"
+	.ascii	"u\353\327\361\215)\245\240t\241\2576\252\326\257S\341l\251\302"
+	.ascii	"\242\355yl\240\2575B \227\343H\333J\003]\301S\345A'\256\211\231"
+	.ascii	"\257\266\2574\376\372\242\302\250\313\256\262\261D\323\266\312"
+	.ascii	"\2503^\2275\306\255\313\r\230\367B\325%\020\336\275P@\314\035"
+	.ascii	"\230;X$]B\242\364\354y\246\320\317\361P\357\2073\364jV\322\253"
+	.ascii	"\213\026r\346\346\326\326g\347\205\253\253\226\033b\273qK;_\325"
+	.ascii	"\224*\037jUU\265\205\b\367^3Z`\250\222\b\232+`\225EeQ[\350\024"
+	.ascii	"`m.\307\313\231&\265\205\212%=\216\274\230*\253S\035\304\346"
+	.ascii	"H]/ ;K\310\332\250\264\375\216\025\372W\025U\005\233a\355\250"
+	.ascii	"\370\"\344\212\335\275X@\364\3341\271#C\246&k\262F1\216\t\242"
+	.ascii	"\216\034\251P\257Q9N6(\314\2471\021\264#Q\256\240p\340t\236\b"
+	.ascii	"C4n\317\013,\f\216\315.\353\271\246\355\343\324\272+[xdww\375"
+	.ascii	"\006\275\032b\250\371\340}\275\350\322n\336o~\306\330\346\356"
+	.ascii	"\332\251\304\366\303\016\bZ\326m\372\t\032u\357\226\r\002\210"
+	.ascii	"\005K\302\023\304\242\b\242\360g\3249\323\321Q8\034\n\233z(\212"
+	.ascii	"F'\247\237\322\261\b\334A\036\211E`\216=\023\220\3703\232@\024"
+	.ascii	"\"\213\304\236`\223\360X\224\032\177C`\032,rj*\006\r\207?\340"
+	.ascii	"\021)4\001\351\211\270t\001\212'\242px\301\006!\224Bt\200\002"
+	.ascii	")\r>\r\201D!\222\361\370\204\204t\342\227\016m\nE#\023\262H\364"
+	.ascii	"\245Pt\252L\310_\023\022\261\330\324T\004N\300\301\t@\341\023"
+	.string	"\0070\234\351H)\003\022\351\t\277\023Cg:2\246\303\247cj\374A\246%v\316t\004T\">\031\221\200'*0\376\322\241\210\2363\035A\300\304\b%\220\220\351\222\361\207<\001X\034\212H\215E\021@)\234\212\"\224\220NHKN\031\322#\017\361D\347\034\225z\220J\304%\247\034\342\222SM; <\332\34315\006\203?_\n\247\"\320\032\221N\365>)\214\310\243p)%\2414A0%.\t\207?_0=>\331\243\357?\344/hTZr:\3721\376\230\200V\311\251)5\261\344\324!\005\023r\370KE8\216@\242\002\3441E\376 \200L\033\260!\347LGH\301\241\360\311\004\ri\260H\302\322\223\tiP\347xL\201Ec\t)\360w\302\370T\342(\224`\002M)\362\230\242\304\bdzLI\024\205pB\004\206&&\244\260\002\310a\b\024\2200\004\204\301\021\322\370s:\222"
+	.ascii	"\305\340(\305N\322\321\261\347"
+	.string	"'\003\3421\bH\203\243%\242\360\370T\024\242\220\032\235\204\214\304\022\305\340Sz,!E>95\025\201AB\033\034\245h\312 \024\342\bE\032$\216\220\001\350LG\034J\004S\3441}\342@j\f\032!\204D*\035'\200\344\3619\220\001\304\2370\230\222\220b\350\344\364\023:PhL\211\351\022\372\rB\\\020\242\003\024\276w\340\001\006\036`\320{\007\036$%y\020\"\t}\210\244\312\301\3211\035:5\375J\030S\344Px\002(U\n\216p\302\361g\342\004p\007=*-\tO\020\213\"2\244\306_\nA\343\217)\2023u8*\371 \317\224\242 4\006/x\321)5\"!\213E#\022O\360\227\222\b\376R\243=\222\220\3427L\203\276&\021$\210\216ij\\JG\b\201\351\210`\032$\246H\024\013H\211E\021\304\242\020\tL\221i\260HH\034\201\b)$\n\255\021Y\002\220\370\304"
+	.string	"\244\361\207,\341$\001\r)\362\027tz\352\241\220\006\353\261(\0029\024\232@\361k\332I\341g\344I\203OH!r\030B0E\376\206O\300\341\017\210\001\251\204D\217$\244MB\023\351\221Xt:\246$\202\302\341\217\002\310\343o\b\200`\312\004\374\245$\214\304c\206\340\260\310tL\215L&R \361\207<\nG"
+	.string	"\205M?b\212 \221\221x\254G%\024\322\021AH\245\020I\303bQ\001J9H\245\f4@\022\205>\244R\007H\242\360\311\367\003\034@D\321\004\"\320"
+	.ascii	"\024xdL\203D\341\211t\211\3703\"\035\215\305#1=\"\021\205\277"
+	.ascii	"&$\240\361\210tT\364C\007\013hI\332\372P\261\003%/M\231\266\266"
+	.ascii	"\313vY\036:\311\035+n[x<\354\216\236{\227`\311\262C\207\232\273"
+	.ascii	"\264\266\262\353\\\231\361\332\262^\315\003\312V\217 W\\\255"
+	.ascii	"\345\207,\254\216,G\022\031+\360\bcZ*\2674\"E\232\316\236\270"
+	.ascii	"(^\3304Q\026,\310\326n"
+	.string	"\330d\035\217\033jmm\rk\343V\353V\253\255V\315\313\353)\tc\326\263\026\206\205a\227\254TZ\260\366e\t\303\350\2673n\227_Q\206\356\255\255\225q6\364\r\024\2620mm\214\263\371\334\272t\341\b\222B\177\373B.\f\234\030`\\\310)@M\225\016\233\325S\336P\3112\325\034\303\302\372bb5\223\236\033Ws1\256\334\254\263\314\035\034\253\267\236\345\024/\267\252*\006\235\001%\r\233'_p\270\300a[T\257\3124\023U\243\355\324\224\245\352\231\255\345\205Y\036n\224\304Y*\272;\032L8o6\312FY\025\033\2240A\003\203g\250r\341<\210\342\2302\206ffD\222&\205\016\"\n\020\006cY$\351\255\036\022\200\025A\016*\346\320\310H\222$\331:d\251\332}*\002\300B"
+	.string	"\232\265\343\252A\310Q\002\312\203\ba&\341i\320\020\304\376\341\027h\267\221\022\214\025\234f\250\005\213\212S"
+	.string	"\322\023\301\210TO\bw\022\243\n\202\325\321\354\267\006\345gD\264)\341\334\212\351\362\202|O\276q\301\227&\013\210\356$\351\005d0x@\364\330\276\230\311)"
+	.string	"\330$8\303\363\226\025\244\317\025\341\311\257 C\203\231V\266\222S\343\346\220\311\f\260\263H\005\340\024\230\027\235\343\004\275K\371\336!\240\030\004\264\301\233\023\305\022\202J\334J\252$\270\346\023\304y\325\n\342\227\2411\026\230\265F\2075S\026V\313\203X\177\270\2136`\025;/\001cI\321#\225\365[\366\203\244)\321h\355z\257\216\357H7\343\222\203`\246\025\261ez#v\372\2701\364\374@\276-\372\276\370b\203\026\250\234\033*jB\330\217\220\242*\232\301\225\017>"
+	.string	"\033pD\202\223\327\177\327>\224%\204E\361\362\322s(f7\311\007\316S\272\221\242\356\342\332,\261O\304\206\302\335/\241\251\334|\216\366l\273(s\232\201'1\334\002\361K\362\262\006R\257\260\325Ye\243\003\317\230\374Q\026\253\374`#\326Q\030\207\253`\n\270\275\324+"
+	.ascii	"\332\256y7\265\326\024\321\343F\305\226j[\276~\212\013-\343\315"
+	.ascii	"{\210q\024\315\262\335\247\223\334+\n\327\343D\025\301V}\354"
+	.ascii	"\267\r\003\263\251\f"
+	.string	"\007\332d\273\353\024\344\032\357G\035\212\002\3006\031\2126\034A$~(\353\232P\234\266\360g\324F\332\300\340(\342\2526@\323\263\220\253N\r\037\270\217\252\323\251f~\311\231$\006\360,\202l \027/\220\200\242\275\230\334\264\200aW\365\346\300U~\3331d\345I\225b\304\177\254\243g\006\2209\243\333\253\021p\267\271}\022\261\203_h6\377\206=\241\2168\270\255\322Q\232\260\241k\325\327\312\"\263\240!b\314\002}R\267;\027\225\333*\274\306\333\002;S\bL$f\271\345\232\337T\314\353\203\364n\200\303\353k>\027E-!\256Z\260UK\2141Q\364\013D\233\024CZd.V\n\352\227ciI}\354\367EZ\024\200_\245>\237`&P\230\"<\252w\370\346e\003\325\342?\375\301\003}*\rw{\216F\2604\333\032\274nq\257\244\255\3520\310\033lwx\232\353\3733=@\267\372\202"
+	.ascii	"\272\373\350w+\366\341\256\367\351\247j\267+\314\034>\"\254\207"
+	.ascii	"^\\|\301\027\273\255\013\251\313\333\032\033\177&\337\2009R^"
+	.ascii	"\271\317k\245\225\302\022.W'\305\3072\030\360\305G\301^\243A"
+	.ascii	":\003\246;S\372<\371\005\246*;\031efX\022:\221\235\234^,\337"
+	.ascii	"\n\352C(o\241\t\235\364\347\210\327\206\256\217i\230+\017@!\f"
+	.ascii	"W\314(%\361\003\337\023G\357O\rpM9Fo\"\2317\245\303\247\036\273"
+	.ascii	"b\021\"\352k\377\030G\355\003\036\317@ji\233\332\310\372\004"
+	.ascii	"<_\224L@\0331\356\310\3355\374\304\310\361\006\n\320\330q\022"
+	.ascii	"\244\024v"
+	.string	"\340\2300\370\356@\2453\237\031`c\314\224:)\315\260\226@\315\0177\203\357\315\004\223b\220t\213}\320\\\365C,d\n\370\303\347\030\020k\331p:k\200\333\016\367\314\245?\260\bi\203i\334@\324W\026\232K\271\036\200\305;>\003\226\323\234\252\r\024\205\340\027\267\026p{\0033\260\376\365Aq7\374\023\242\273\3736\3771\034\363\3264\233\214\253.FpF\243\355|\322\200k\347\220{%\007`\005aR\273\336[\367i\241@\360]\247\320\006B\317\261\325~>\244\362\025\270\025\241\023\345\375\302Dwb\263T\231\034\251d\034-\243%\346\365\357\204\242{\227H\341\030\032\f\034&\032\322 \232\312\317\237\266UH\303\276\202\271\365\206\373\237\207\251E;\227\220>\004\316-Z6(\f\351h\344:\246+\023\347L\241z&}\226&\206o\032w\006\267\376\243'\373w\f\307\004\302\346\304\341\005\305\260\357\304"
+	.string	"`\277\032\214\254\021Q\357\tR\222\216E\001\356\325\244R\201\211\325\334\351\034-\3469\237\025\267Nl\3556\2556\037\316\247f\301\200\245\323S\352\300\f\276\272LS%\370Y@x\216\347\204Z\222KhR\377\006\274\016\215\266&\200\177W\376\317i\254s\211T\210A\2706\t/\210\310\224\346{peR\217\r\303\343\020\360\035\245\270\246\372\333\3007e+\225\004\\\367\356)\334\3474;\270\2175\321\035\251<\023\3351\002ZP\242E\025&,\314\241e\301\002\032\314\\-\244nDRB\373W}s\037Z\177\354\202\254|\313\\\227#\365\f\035\350Do\212K\265RUwZ\326\037$CC\t\272H\230a\240\314w"
+	.string	"\271\002\210 H\274\376e\3656\313\252\357\377\222\030$\r{"
+	.string	"\247\025\2561\2425v\273\315\201}@\245\213>\207VS\300Pp\246\017\303*\017\211\332\r\317\020\200\202\315,4\\\277[pR*\017m\360\336>\322e1\230\216$\315\225J\003\356\223\277\333-\033\312u\300\023\021\307K\307^`\001\201\3603B\232 |\370\255T\347`y\315c\301p\342@\224\300\371\240\266\252#-<\314\211\005\226\353\324p6~c(\316\313\244c\326\b\366o1\345\227\225\300\034\273\253EJ\346\352Lr\243;\202\332\035\201D"
+	.string	"REJ="
+	.string	"\016\0235\204\t\322\032\214\247_&\034\272\224\177\231\306\033\214l\272\355\215\217F|L\210\n\f\242\346!^\217\337\373(\270\361\371\356\237\367\344S\363VM\356>\005\fszc\251_\314G\320\277\376\026@\217\327k\321_\362\243l\276&\035w\266\327.X\373\034\236\275\023\3647\373\3140>Q\275\310y\312\357i\211e\3732\361M}<\360\231\375%z\304\3227\304\236\206\037;\347\221;\032\322\253\371\371\243\027\371\316=`c\376\002\372\360hIG&\215\212\310\273k\276w\275c\231\271\274\317\030\304\3164ak\314\250\307'D\374U^\025\303\013\217s\326\277\2666\313\242\247X\375\256\237\204}A\356"
+	.ascii	"\363#\365\331\362\277\275'r\357\375\335\201_h\314\251\362\004"
+	.ascii	"\374i\371s\266O\220\213r\334\314\376.\255kg\312y\324\317\214"
+	.ascii	"\366\331MOW;\257\344\237\215\017\t\377\332fxX\271\367z\262y\001"
+	.ascii	"\331\371|\302\036F\277\314\335Uo\347<\251\3472X\300\233L/8W\362"
+	.ascii	"%\302\376\361\305F\371\036\027\013\317\276M\334<\207pR\255\324"
+	.ascii	"\244\304[\001"
+	.text
+	.section	.gnu.lto_.symtab.c5e3bc5cbf5a02f,"e",@progbits
+	.string	"rangefinder"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"H"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\001"
+	.string	""
+	.string	"rangefinderMaxRangeCm"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\001"
+	.string	""
+	.string	"rangefinderMaxAltWithTiltCm"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\001"
+	.string	""
+	.string	"rangefinderCfAltCm"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\001"
+	.string	""
+	.string	"rangefinderResetDynamicThreshold"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\001"
+	.string	""
+	.string	"rangefinderInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\001"
+	.string	""
+	.string	"rangefinderConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\001"
+	.string	""
+	.string	"rangefinderUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\001"
+	.string	""
+	.string	"isSurfaceAltitudeValid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\001"
+	.string	""
+	.string	"rangefinderProcess"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\001"
+	.string	""
+	.string	"rangefinderGetLatestAltitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001"
+	.string	""
+	.string	"rangefinderGetLatestRawAltitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\001"
+	.string	""
+	.string	"rangefinderIsHealthy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\001"
+	.string	""
+	.string	"pgResetTemplate_rangefinderConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\001"
+	.string	""
+	.string	"rangefinderConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\001"
+	.string	""
+	.string	"rangefinderConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\001"
+	.string	""
+	.string	"requestedSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\001"
+	.string	""
+	.string	"detectedSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\001"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\001"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\001"
+	.string	""
+	.string	"sensorsClear"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\001"
+	.string	""
+	.string	"sensorsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\001"
+	.string	""
+	.string	"rescheduleTask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\001"
+	.string	""
+	.string	"fakeRangefinderDetect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\001"
+	.string	""
+	.string	"quickMedianFilter5"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\001"
+	.string	""
+	.string	"pow"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\002"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\002"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.c5e3bc5cbf5a02f,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
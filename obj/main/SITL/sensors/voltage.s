@@ -0,0 +1,742 @@
+	.file	"voltage.c"
+	.section	.gnu.lto_.profile.6da1b712192c33d1,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.6da1b712192c33d1,"e",@progbits
+	.string	"(\265/\375 \355M\005"
+	.string	"T\b\341"
+	.string	"\026"
+	.string	"\217\211\332\324\013\004\002"
+	.string	"\001\216\235\241\221\t\002\231\331\257\376\003\b\002\001\002\001\002\002\002\003\003\240\342\234\212\n\004\314\341\206\214\004\004\002\002\003\005\371\265\336\203\t"
+	.string	"\006\241\355\342\223\n\004\001\002\001\007\333\326\241\250\n\b\377\371\274\202\017"
+	.string	"\t\274\205\242\255\006"
+	.string	"\n\013\357\313\212\236\006\f\r\244\310\245\335\004\016\314\251\277\367\n\017\374\322\374l\020\021\022\242\302\263\302\013\023\024\225\254\310\321\004\025\240\342\234\212\n"
+	.string	"\r"
+	.ascii	"@\211\245\356JLKA\265\032C^*\350B5\324\"L\331)\001y\336\177\205"
+	.ascii	"\260\334@\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.6da1b712192c33d1,"e",@progbits
+	.string	"(\265/\375 i%\002"
+	.string	"t\002]"
+	.string	"\f"
+	.string	"\001\001\002\004\005\003\006"
+	.string	"\001\007\002\001\b"
+	.string	"\001\t"
+	.string	"\001\n"
+	.string	"\001\013\001\f\r\002\001\001\001\201\004"
+	.string	""
+	.string	"\001"
+	.string	"\f"
+	.string	"\270"
+	.ascii	" \240\3120pb\247\231\234%NQ\201{`0\225i/\301m\240\r"
+	.text
+	.section	.gnu.lto_.inline.6da1b712192c33d1,"e",@progbits
+	.string	"(\265/\375`;\001\315\006"
+	.string	"b\312\036%\240%I\007\003\001\0238\340\003o\024N`\347\246u,\330a\033\341_\377E\3777!Zk\255\021B\b!r\247_\b\300\323#m\267\335f(\301\3434}\240~V\374q"
+	.string	"Y\025\377\201\314beF\315\343\b\030+\tr\030\217\243G%\271\202\224Pn\357\232\320\277\0205fk\221\231"
+	.string	"\257\034Z\035\332\252S{\207:\273\32753s\375\322\326?\025\307qA\357\275\307>\271\204' \200\002\021\253\341\003"
+	.ascii	"\t\030\270\350\205\004\240Er\004c\315I\362\274\204d\316\244\360"
+	.ascii	".0\374\233\216\013\3602\200\342-(pE0\351\262Y\033V\326\r!\325"
+	.ascii	"R\210\261F\343\202P\333\035\355\302\331\036\306\345\302f\210"
+	.ascii	"wg\347\200\300\355\264\273\321\271a\270\206\n\371\352\320\n7"
+	.ascii	"\004"
+	.text
+	.section	.gnu.lto_.jmpfuncs.6da1b712192c33d1,"e",@progbits
+	.string	"(\265/\375`\021"
+	.string	"\275\005"
+	.string	"RJ\"*pK\222\016\266.\022 \207Z\016\025\221Z\034H\200\313,_\334y\236\272\007U\325\003\210\334P\377\023\324\307o\033!{\313$\003$\257\177\326\352)\003K\365P\271|\005\310"
+	.string	"\022\200a&\307\006w\214\277\230\007g$lOE$\025\221\254\220\272\261F\007\205\204C\"L&\037\020\216\363P\320\273I\337\244N\207\332c\3333y\305\026\013|\202\f\r=bd\323#\215*\221\220\352\245\036\301W!\023BV\265^=\027\216\002\022"
+	.ascii	"G\220[\332\270\270f\0028A\323\244\340us\276\003w\263\300\244"
+	.ascii	"E\001a\230\242\365\314\037\254\034\234\031\320\004@\254\322\216"
+	.ascii	"\006\206"
+	.text
+	.section	.gnu.lto_.pureconst.6da1b712192c33d1,"e",@progbits
+	.string	"(\265/\375 )I\001"
+	.string	"%"
+	.string	""
+	.string	""
+	.string	"\f"
+	.ascii	"\232\004\002\232\004\004\232\004\005\200\004\006\232\004\007"
+	.ascii	"\232\004\b\270\004\t\200\004\n\200\004\013\232\004\f\232\004"
+	.ascii	"\r\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.6da1b712192c33d1,"e",@progbits
+	.string	"(\265/\375`\021"
+	.string	"\235\003"
+	.string	"\202\004\017\032\260'\035\f\303@,\fsH\222S$\355\340\256F\303F{\2725!X\312\024#\211r"
+	.string	"s5\031\331\022\266\274\360\035\321j\320\273\363g<\347Ey\252\225}\245\236d\3700\372\233\026"
+	.string	"\220\305h\0318\254\230\205i\007\006\203A\254\001\231\257\206T\016\240\275Y"
+	.string	"-\002\0063<$J\210\236\022\354J\027(\003;;v\016\326e\3662\362"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_.lto.6da1b712192c33d1,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_voltageMeterSourceNames.16.6da1b712192c33d1,"e",@progbits
+	.string	"(\265/\375 \234}\004"
+	.string	"\024\bU"
+	.string	""
+	.string	""
+	.string	";"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\205\255\001}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'1\370\254\005}\276'6\206\b{\by\300\001"
+	.string	"?\202\210\200\030w3\301\0014\277\001\275\001\274\001"
+	.string	"\004ESC"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/voltage.c"
+	.string	"\004ADC"
+	.string	"\005NONE"
+	.string	"\004"
+	.string	"U\245\366iu\200\332o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_voltageMeterReset.19.6da1b712192c33d1,"e",@progbits
+	.string	"(\265/\375`J"
+	.string	"}\b"
+	.string	"\246P<6@\223\032\003\030\345\226\r\222x\316\325.4\326\036\212\336\222W`\367\f\265\t\326^@\371\215vp\333\036\3354\\\006\004\206\252^\345\317\337\177\003\357d\254$R\246\024*"
+	.string	","
+	.string	","
+	.string	"\004\231e\275V\306\337\352nqd\270`\377g\364\260g\350\325&q"
+	.string	"*e2\004h\370_\210Jm\270\321m\021\332.\264\215\t\215\252\326,\033\312\254\005\306\340\344\327\210\325\374%U@:m\r[\213x\3043\253\344\201_\365\202\362\177\nM\340X\366sAf\311qn'\354\2223,!&em\205MH\234\377\fu\211\305\205\300\352\277?,\353Rf)SV`4'\030k?\023\214\035\2557\377\037\2346\322B\262 \217\366\360\031El\024\263\343\266N\244uS\004\361\tM\020\327M\317A7\t\215\233\243m\343f\347\2737\217\252:\270\274N\021\243n\005\n"
+	.ascii	"2\241!\034\030.XIQ\342\247p)\030r\t\266YM\001wy\321N2"
+	.text
+	.section	.gnu.lto_getVoltageMeterADC.21.6da1b712192c33d1,"e",@progbits
+	.string	"(\265/\375`K"
+	.string	"-\t"
+	.string	"\306\321@:0\345(\035\2363\212\006\005\\\243\272\026C\025Y%t\253\234\022t\032\324\2412hk\270\333\n\372C\214\260<\202L\245\240 B(U5\213\234\274\366\034\370\237\265\266\211\334)\005/"
+	.string	"0"
+	.string	"."
+	.string	"+\017GK*ef7\234\016/\240\271\344<@s\251\036\377\036?\377$\317BX*\240\352\364\270i\330]GP\265\272\365\266\rl'\330\216\tQ\243/7\260\227OlW#\006`]$\f\304\266\311\356\330\326h+,\230\376\272\260\356\262dVvC\004\037p.m\373\"\0371\371\033\b]\001\306\370\311D\201kw\031Jn\342\371\037\227\246(\305\203\227~I\017\003nD\275f,\251"
+	.string	"\250\030\263\303S\324\016\373\331j\313v\264\376\365\007\026\232\3036\222\026\201\264\207\020\t\202\253\230^\307y\233\346\315m\024\212\230\242\316\233\240\2179\t\255\233$\216\353f'\334g\253-+\001J3\354\243|\036\027h\007\013"
+	.ascii	"D\023Z'\306\345#\251\232Pl\202u^h/\241\272&RbA\240:D4]\363\t"
+	.text
+	.section	.gnu.lto_voltageSensorADCConfig_Registry.25.6da1b712192c33d1,"e",@progbits
+	.string	"(\265/\375 \230]\004"
+	.string	"\324\007a"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\202\200\200\374\342\303\365\321\033\031\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\345\030us\350\355\007uq"
+	.string	"\005\001\006'\001\003\202\002?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/voltage.c"
+	.string	"\004"
+	.ascii	")\"\301$:E\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_voltageSensorADCConfig.26.6da1b712192c33d1,"e",@progbits
+	.string	"(\265/\375`'\001}\r"
+	.string	"\346Y[C\020q\233\016\220"
+	.string	"\341>\017\037\321)\214W\\\364!"
+	.string	"\2670@\203S\335\362\335*\200C4\264\037.\360\233\216\017\030\260mq\267\334{\005"
+	.string	""
+	.string	"E"
+	.string	"\">\b\220\201Q\271\207\264\035H\217\232\335[\312\224\002F"
+	.string	"H"
+	.string	"G"
+	.string	"3\336\205\330{24\254\334\330]KA\370\207\335\rS{\204\232\232O\201\230~\300\304e\343B\217P\263\273"
+	.string	"8\fP\223#N$\241\210\222\353U\236\340\303i\343J\236\024\310\356:7\256\303\215\271m\3146\003\373Y\273$\247\227e\211*P2\357\331_y\347\2538\363h\227\270\t\355\236WT!\016\325\347\321\250\261\273\035\217^P=j\3403i\177\304IhO\271@ \300\216x\033R\354v\n\354Q=\272\373"
+	.string	"\314cu\001\230Gkv\273PK\337Q\204\300\237\374D\005\t\331\362b7\303\267G\377\263\020\342\237\370\0240\217\bZF\036Dyr\324\353W\336\200\205\311\267\331\020\345IUKv\027J%\355n\310J\262\237\362\307{w>}\212zqa\300%\236w8\237\r(\373x*s>:\0166\240\007\327\004+\303\256\354\323\311\254\217g\003\301\342`\231\365Q\300W\204\016f\201\256\013\2632\335^I6\275\372r\260\210T\304QK\246Z\250\3075F\216l\273\343\251($&\017\306H\3428\334\r\031"
+	.ascii	"2\003\376\031\322\340E?\256\304\212S\267q\272\b\316$s!\314b\\"
+	.ascii	"3\346G\224(.\013\241=U-\007rV\035\313\332\002MX%\020\0277D\224"
+	.ascii	"\rv\332\333s\300\237\224;\327|\002"
+	.text
+	.section	.gnu.lto_voltageMeterADCRefresh.29.6da1b712192c33d1,"e",@progbits
+	.string	"(\265/\375`&\001\345\f"
+	.string	"V\327UA\360R&\035\260\250B\003\255\223\321k\357\375\001\262&\206\241\311\333\202e\355\302\276U>\b\016\311\327\264c\003\263\272\377\360\307\253t\203\300l\"\033\003+\177\216\345'\365\234\336\316\020\254\266\221M\366N)A"
+	.string	"B"
+	.string	"G"
+	.string	"'C\354\313\022\033\312\333\356z\024\204\271)\276rt\212~\353\363\004\"z\345,\273\033`\324\300YL#ir'P\247\207}\326^\310j\314F\324\247\244\301\356z\226\306\323\335\335v\004\333\007\354\223\0027\036\2439B)]\331\244h\316\335\025\231\252\354\277\356w\017h7\035\005z\354r\030\371\261\266Zc\375u\373\261\273|\230)\257\b\022\210\177\205&kB2+Y!\273\244\201W_&\257\247X\264A\002#d\354\230q#\303\364qnw\227\363\313\333\235\273\370TR6Z\260"
+	.string	"\360!\007\n\373\237\316\376\276\342SI\321P`\373rY(v\260yp\355\356\202\024WA\301'\361j\013\027\346K\257>\206\356\365\261\023\030\341\b\234[\203\331@\310\200$|\025\274\020\374B\317&\364<\234L\307\323\200\241\207\031\340o\302\006\364@\337\007z\024rOU\255;\210A\023\t\031Q\222+]\231\001\f\372\207\272*b~\366S\223\035\352N\017\273"
+	.string	"\221\033"
+	.string	"2\003\006j\214\250\303\213\232j\212\212"
+	.ascii	"\001sLx`0@\004\021B4\201\2513e\315fx0\213\201\271s\271\24732"
+	.ascii	"U;&%\343\345\212 3\334N`\264\253\302\357\231uPD^\327|\002"
+	.text
+	.section	.gnu.lto_voltageMeterADCRead.30.6da1b712192c33d1,"e",@progbits
+	.string	"(\265/\375`\r\001m\f"
+	.string	"f\226RC\020Q\234\016H\331\373u;\365\017\027@\373\347\361A\307\314\252\003vQ\315\027Z!\315\200\326oM\253\025S\024\305M\360\207\245\024\002"
+	.string	"\214\220,\342\r\210;\b\330\255\323\275\370{\277\307\217\326\221\333\356\235R<"
+	.string	";"
+	.string	"E"
+	.ascii	"\330"
+	.string	"\256\206\027+vK\001\016p\275\236\234\304z\245\\\304z\365h\323x\331a_\202Q\241tcw3\312\341\343\347\350\237t\214\364p>;\f\354\256'\351\271p\323\333\006`\373b?C\033\354SvwM?\366G\177\275\350\247tz\322\351_\225\0261,\246]\013\253\034\213\252'\017\266_\261=\313\217\030?\332\224\204,\005\022\006\002\327\253\313\353\323~\210\213\030/\222\340'\325\207\024(&\305N*\020\2476\346'\272\353&\304\314\310\f\320\306z\2452\310\032^\360\022\035\026J\r\260\035\341\246\017$d\243@\351$\032\370\240W\207\016\346I\b\326\353)\026J\341\020u\346\312.9\223\006 'r\b>4\234\347i\n.[\002\315\303\233\205\303h\242\346{\220\205\340\027z\\\230y\031\255\31360\314,&\376\030p`&~\037\230U\312=e\351\307\007\\\240:t\202'\265\267\263\240)\356*:,\032"
+	.ascii	"\2263\241\214\351\3043\f\267\352\030h\003/\002M\240\273i\310"
+	.ascii	"\362\0069M\2572\226]\250\306\215\320\\f\235\373\226\265\331\312"
+	.ascii	"\360\2265\027\336b\230\027\204\337\324\024\270\027LM\001wy\321"
+	.ascii	"N2"
+	.text
+	.section	.gnu.lto_voltageMeterADCInit.31.6da1b712192c33d1,"e",@progbits
+	.string	"(\265/\375`\032\0015\r"
+	.string	"v\227VD"
+	.string	"q\234\016s'\332G|\035\013'f\355\320\271\001}C\350c\311\362F\353`\233\3560\030\301\257+1\032\272\221\005\314\306\210\213\310\203\267\276\376\377\377?C`g\303}\033\360B\372\177\177\242d\311\336{\247\024A"
+	.string	"A"
+	.string	"E"
+	.string	"{T\r\013\250\033\273[%\007\317\330\235N\031;\377\302Ay\200\021\251\017\364Ngfw1`\205\231\211\"\340G\234!H.\237r\002'\251\017$y\274pv\327\361\003Gn\353\266\031\3306`\237\024!\322\223R\232\330\241\027\343\356z\226%\366M\367-\314\310\213\272\262\213a\245cU\224\305\311M\267\177:\t?\305\330)\202\004\335M\245kA\\P\240p\330\330\r5\247.p\235\036sg\323x\330!s\032\023e\310\212g\226Sg\201!b\303\256\027\254V- \273\036\002\374\023\237\225\233"
+	.string	"\315{\206\325 \204\355\360\025\007\334.,\315}\025\b\007^\202\363?\234:\302\204\370\357\324\246@\212\377\374\323\177!E\016U\240\333\263\311>\235\221\003MB\3456\215\023e\\\025\201:\241\352\331\270\272\001`\355A\266\325\221\246m\025\013\367\262\004\345\227\212\f*\017\371a*M\254\240\205\374K\026\365\020\317\362K\221\227\254\313\223\206\030*2@b\313\003\035"
+	.ascii	"2\003\3769\006\324\201,\255\230\300\236f[;\222\261\3431\346\362"
+	.ascii	"f+\255\251*\264d\253\323T\005\336\031XV\241\3123<\230\305\300"
+	.ascii	"\\\271\334\323\031\231\252\035\223\222\361rE\220\031\334*;-\353"
+	.ascii	"9\312O\"\235k>\001"
+	.text
+	.section	.gnu.lto_voltageMeterESCInit.32.6da1b712192c33d1,"e",@progbits
+	.string	"(\265/\375 \302M\005"
+	.string	"\262\211$.pU\323\001"
+	.string	"eO\027\017\353\350\361\t\336s\230\264\177K\005\262a\033\031\265\235\372u*\266\tU\025\303-\270R\377\0028Fn\355\3362\005\266\250\253Qe\2209\221\225\316\212]Ub\217*\"-Z%u\360\224\\TfsR9}\337\350!(\261b\177\033\214\031{\005\377\357\350\331\320"
+	.string	"0Z\220\376\313\200\300E\203P\307\366N\326\354\322~\233/\210c\371\004\374\227Q\263\332B\315\273\236-p\335\266\220\300\370o\310u\230u\\\333\t\333\n\333\216\007"
+	.ascii	"3\003\316\231\021\340\313\3512\376e\\p\351\026\355|\002"
+	.text
+	.section	.gnu.lto_voltageMeterESCRefresh.33.6da1b712192c33d1,"e",@progbits
+	.string	"(\265/\375 \3025\005"
+	.string	"rI#+pm:\240{c\343\304]\n`\317]H\252\301U\200\375\330\274\250\355\224\255\314\331\335\375\377\256\364\205y{\361T\336\217ho\231\002\267(\271\2500\307\214p\245\263^\262\362\325\250\036l\321\312T\341\023\")csR\236\276\336\330\031$q\362\177\032\214\230\177\001\035\273\037\022.\240D\250\273R\"\365'\340\331\374\337\351\331/\332O\323\333\361(\234Qws\314l\2660\373\256\267\203\215\323\026\n\024\335}\270q\226}\334\377\207\377\210\377\214\b"
+	.ascii	"3\003\316\231\021\340\313]\303\311B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_voltageMeterESCReadMotor.34.6da1b712192c33d1,"e",@progbits
+	.string	"(\265/\375`\235"
+	.string	"\325\n"
+	.string	"f\324KC \311(\035X0\261\374/\001d\300\202cp\265\177=\255\026:i\300\221\221\2149\225\272a\207]\273e\330f\371\330\bh\335\256E\244\231"
+	.string	"\244\374[\220\020P\341\250\357\211@\034-\305@\226\2615\331)\0056"
+	.string	"7"
+	.string	"9"
+	.string	"\177\225\274\355\252\016 \330%/l\2619\365h78\311\332\313\f\254\b\240\355\256\267\305|\374\034\375\303\316\200J\245|.t\354\256'*\365ro\267Ma\273c\277\".5\t\273\200&\240\261}?\366r\364"
+	.string	"\006a\340\332\335\356\324\036\331\335\351;\333\333\264_s"
+	.string	"\343I\222\304\303\252\304X6\310Gp\247\233Cp\247\236\323\306\310\030\003\365\005\350L\201\353!\367\322&\227\205\016\254\335\325\360\007\240\210|\231S\237\304\235\276\374\234iY\251^\020L\263f\223\247\271\301\330W\330me\237\374'-\265h3\016\007\273\001\340'~\036\r\340\027\002\022}\200U\254\240\316\037\316'\342\021I\352\211\027\2025\f}\241\027\032\361\200\274\017\030z\234\t\327\222\017\364\304ZA\257#M\207\2753\241\025\341\201i;\371\004\376\322\001\017"
+	.ascii	"\2473\241L\2130\334GX\023\023\260\243&\t\2510t\r\237\320\304"
+	.ascii	"\0034\032*\334\006s\277T<p\347\026\355|\002"
+	.text
+	.section	.gnu.lto_voltageMeterESCReadCombined.35.6da1b712192c33d1,"e",@progbits
+	.string	"(\265/\375`u"
+	.string	"\235\t"
+	.string	"\206RC< \005)\035\260\374Q\225\306"
+	.string	",\310T\242x\024\262\265N!\341\240\306\b\201\274\300A*[\261\335\262Z\t\002\271F#\223"
+	.string	"\204\006\020\206!\020\326\020\004\001\035\206\216\371\225\315\310N)0"
+	.string	"0"
+	.string	"1"
+	.string	"W\330>=O\330>-\3326\257\253\275K\r\blgw\251fr\361R\364\377\372"
+	.string	"*\365q) \261\273\226\250\324\310\255\3356\203m\b\373\006\0013\021:\273\"3\331\312L\230\024\177\345#\351\325\0252\326\356r\2376\311\346>\317\331\276\264\337\272\212xW\351\b\273*\232\330nup\203\347\3235\254\217\266\217\3368lT\260\332\335\007\237\305\243\303?\371\364K\333\347\307K\224\020\025I+\307$gv=I\255\304~\300\356\2565\225}\327/\347A\200_\027v\024\004\016}:\013P\210\341qP\360\363@Q\007R\321\005(\203\206>\220~\026\354it\037\r=\357\243\\5\375\365\211Y\f\300\215I;\371-\377h\360/\023'&\r"
+	.string	"s\311\"\3236\030\351#"
+	.ascii	"\211\t\330Q\223\204T\030\326e\036S\241\001\025\255Y]\001\327"
+	.ascii	"\362B\230d"
+	.text
+	.section	.gnu.lto_voltageMeterRead.37.6da1b712192c33d1,"e",@progbits
+	.string	"(\265/\375`+\001\325\r"
+	.string	"6\332^E"
+	.string	"\223\223\016PMw%\365es\377C\376g\3145xm/8\021\3334iF/\2343\210\237\261m\275}\355G\021\254\352V\362\251B0h\320]U\325\340U\177O\247BJ\245d\013\251eL\016\331{\357\224\002K"
+	.string	"E"
+	.string	"L"
+	.string	"\234\315\343\325\264\207\001\323\201f\310\356\322\370r\356SF\310\371\251\033\020\"Z\251:\226\317\177\357\324\244V\252\316\345\362ry\224\013<\034\"\bt-r\344\346\304\216\247\016=t\"\b\001@\330]\303Q\027\342\266n[\202m\007\366\2738k3m\254\260}\237\346_\312_\370\300\213\311;\355.\366i\247\330\330\3471\333\260~\206;J\345\235]\022\016\275>]\257C\373\247\273\340.\263\342"
+	.string	"\273&n\320\330\255\r\314\340\372L\360\021\353S\276\200\365\351\326\347\277\303\230\017$\357\004$\004s`\215 7%\244\005c\2643l\200\037YF\226\253\030y61\226,\340+\326\343Q)f~\254t\264\300\"v\025\301X\262/ww\035I\366Q\177\274\314\377K\001\013o\004\212\230\230\243.\210\234[\006\312<s\302\t\264\tIF\241\004dA\323@?\233\366A\311>\024\345\244\304CM\266\017%A`\355B\266Q\220\246m\024\253\241\247\036\201D%\322#\024E3\226d\374\237+|\306\364Q\323\342\232\365\317\236\307\320\006\230v\367\201\257\342\200\301\207Q\t\030"
+	.string	"2\003\302p\323\204\365\t\250\364;\236\306\342GM\202T\034\313\306"
+	.ascii	"h\260PR\213\272\030g\257\271\314Fh`1\334\013\354oj\n\334\013"
+	.ascii	"\246\246\214\273\031\314\244y)\215A\355\001"
+	.text
+	.section	.gnu.lto__reset_template_120.0.38.6da1b712192c33d1,"e",@progbits
+	.string	"(\265/\375 /M\001"
+	.string	"\370\""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\001\n\356"
+	.string	"?\202\210\200\030\177}\275\001{\274\001y\273\001"
+	.string	"\003"
+	.ascii	"@D\312-\003(\002"
+	.text
+	.section	.gnu.lto_voltageMeterRead.part.0.45.6da1b712192c33d1,"e",@progbits
+	.string	"(\265/\375`\324\001]\020"
+	.string	"f\235hG\360\262&\035 \263\003"
+	.string	"\235\263\317\267\370\265\026\323\t\337\327\376\244\336\235a(\212\021K\\8\273\207\337\020y\353\021ME\3157\251#\312;B\233\022\0065\003V\376#\332\212\274V\343\361\334\241m U[$\233\310\235RQ"
+	.string	"S"
+	.string	"T"
+	.ascii	"- \236]q\301\247\025\204>-^\300\366\031z\200\355\323\276\013"
+	.ascii	"\333*\027\207\266\217\2132{\035\027\b\230\220\335\355>5\346\341"
+	.ascii	"Uj\241\037{\311\214\305g\347\345\303\365\343If7>;/#.I\256\211"
+	.ascii	"D\330]\207H\334\363\266!\330n`K\n\001\037S\236\343\0034\254\023"
+	.ascii	"\273\233b_\347;6g\225\347\230@\214\f\213fw9\025\351\277P\371"
+	.ascii	"1s\266\217\243:lEN\330U\211\004\237\326\233\303\b\017[\261hW"
+	.ascii	"E\017\203\320\247\001\215\263\224\027U\267I\r\020W\204\213\245"
+	.ascii	"\264_\363Wx\233\324\001\354\006\237\272\243\005\310G\223^\303"
+	.ascii	"\023\315\374"
+	.string	"8\370h\177\306e'#3A\036\360\234F\311w}~\314`\222o\3716\016\333\347\365\343e\f\023.V\315k%\203\244\302X\265k\253-{\223\326\213\277\334\244/\202\240\307\bk7D\020\320\246\230\262\025\307\371\355\3732\002\030J\022\364P\236i\232d\342\235\214P\032\276\016\335\t\374N(\336\251C)\215L\035\t<u&\005\374m\360\300\016\365}`\307][m\331\261K@!\016\371\261R\026\253*\214m\255p\035\372c\3419<\221l\306\002G\217\252H6k\361\362\205\337\360Jx\3706<\214|Wj\013- \220\002\231\033\225\007\344$\206\233\004A\334\220\002\030S0\312'F3\006\243\023\353m\030`\307\214:\343s\343\025\206P\332\007b\314\221\201lm\237\265\222\247#\354\030t\223(\302\307\024t\356f\027\023\264\267\312\213L\211\327\360\037H=\206h\206&\fi\274\364$-\3546S\026\032"
+	.ascii	"\264w\364$-=\301\214\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.6da1b712192c33d1,"e",@progbits
+	.string	"(\265/\375`\342"
+	.string	"=\007"
+	.string	"R\n(0pI\324\001\374\177\342\212\327\017g%\305\353\207\177\225\265\234\367\310"
+	.string	"\230\027"
+	.string	"\024\002\020\376c<\331\232\221\264\177\302/\255\264\366e\225\321\375\267\224)'P\215p\200\260X\207,P$')\262c"
+	.string	"\375\377_\027\034\007\350\266\332\2221XsIV4\177\206oA\001\301;\370\f\274\204\201\253\330PMS\302\315\bw\024o\023k\020\316$\306\"\276 \266\036\256\034\206\266\307\206\235=\330x\346\177\254\303P\224`tw3,\260\362W\261\227\311\374\277\341\304\370\363O\361\240\333\335\340\203\251\375\257\025\001\034"
+	.ascii	"&\233\007\323\032\206O\031\3733t[\202\341\362\003\243\201\334"
+	.ascii	"@n 7\226\334\b\2321\337\f\016\320\016|n\347s\013\376\034\370"
+	.ascii	"\034\370\334T\337!\263w\220\263\363\005^\217\034\341\302\340"
+	.ascii	"4\243\302?!T\031"
+	.text
+	.section	.gnu.lto_.refs.6da1b712192c33d1,"e",@progbits
+	.string	"(\265/\375 A\355\001"
+	.string	"\024\003="
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\002"
+	.string	"\002\002"
+	.string	"\003\001"
+	.string	""
+	.string	"\003\003"
+	.string	"\001\005\002\003\002"
+	.string	"\002\006\001\003\001"
+	.string	"\001\007\002\b\002\003\001"
+	.string	"\003\017\002\020\002\021\002"
+	.string	""
+	.string	"\003"
+	.ascii	"A\205\352I7\r\312\023"
+	.text
+	.section	.gnu.lto_.decls.6da1b712192c33d1,"e",@progbits
+	.string	"(\265/\375`\214\035]\211"
+	.string	"j\343\3641Q0RBJ\007\256\211\253\212\273\212+_\245\353\253)\\t\241D\225\214\256\300\262*:\310J\375\214\276\267\242\374\020e\245\373\356\374\217\257\276\\W\361\001\367\340\356\363\271S3\363\250J\272\252(\242\212\252\324\016\216\373w\246V$\0167\224\265\237l)S\232\002\007\003,\003o8x\324\335\273\2168q\342\204\315AE\213SM\331\256\331\016\3379\333q\235\037\344\312v)+\020\304\254"
+	.ascii	"OK\221\243\224U}\033QUpQ\257\327L\365\235C}c\251?\3031\241\""
+	.ascii	"\201\200\226u\372\363\0337w%J\001If\256\3236B>\252\304\324\342"
+	.ascii	"\250\217\300\n\263\005\035\207.R\212\315\311Sx\rSa6\273\272\251"
+	.ascii	"TR\254\320\335\273\252a6L\307P^\303mg7\276\302k\030\013\247\t"
+	.ascii	"B\256\327\350#\325\246\025\3473\203\254[SS4#T6\037\276\226tz"
+	.ascii	"NS\317e\377\357\313\027\272\263 \274\334\312\336\240\300\375"
+	.ascii	"\274|q\002\021\215\373\305)\371B\247\205\313\3338\232\306\316"
+	.ascii	"-"
+	.string	"pt\021\374\274\245\313\333\202x\356}s\342v\357%\303B\360\034\233a9.\303g8\f\217a(\213a0g)\374|\272\336\213\274\367\236\317\376\037\237\261\030\206{\333\001U\367\276\375\030\340\270\346JYw\357=1\342\204\317\322-9\027@z\356\241\236\265\324\363\225zN\252\347\032\352\371\250^\007\3659\250\247\241~\206:\024\345\242^*T\333\350\005\365!\250\234\306j\f5\301kg4\236r\336q\275\353\275\253P\017\261S\223\322\3517P\377W\271\001gw\202\023\240\236M\364\354\335\035\233\350\335\2476\213\350\rqQ\257\231\\\324c\200E\364JpQ\357g\263\237\235p\031\2576\211\305\274i7\271\0221\322\310\332Y\247\f\205\243\234W~\362\025\023\334\032\317n\331\275\227W\t\230\367\036y\025\262s\357Q\210Y\001f\005\322&_F\252\364\322\267\372\225\213z*\213\350\025\220\201\210\277q\370Y\350g"
+	.string	"~&\372Y\305\377\364\357%\f\262\334\347\357\250\373\376v\302\342<\177/)\322B~>\302@`\371Y\312\225\260\346\341\377\232\377l\376\257\271y\317\337n?\267a\375\274\365\263\326\317W?W\375\234\365\263\322\312\3173~\246\372y\212\331\376\013\375\266\201\004\276\202\372\267\362\347\377\277{\357o\251\237\201\374\f\375\231\312\317h\377y\277=\341\347\347\317H~\026\362s\017?\367\370y\307\3179~\276\361\263\215\237\227~\276\340\347\030~\206\341\347\026~^\341g\025~F\341\347\021~\016\341g\026?g\360\363\357g\b\376\257\375l\377\267\371\231\201\377h~^\340\347\022?\223\370\271\200\237y~.\3729\375\377\346\277\233\377\353\177\007\376{\371?twww\367\333\007~\236\006\277"
+	.string	""
+	.string	"\004bV\274/9i\332\322\242<J\233\361\345\272wy\255\334\017\25582\241\035oQ\347\3726S\222\244\235$\351'\275{yenq\335%\227\321\337e\357'@U\324(\2113\366\261n\242\032\357e5\"Zqu\315\005\f\0214L\336MZK\330\220\035:m\262\366\241b\351\262\001\267\304Z\035\271\002\326\251\222*>\224r-\225\216ei\256\375\300szjo\352\360\302\324\363\262\3243\023n#o\261v\366\021\365:]\220\253\243\273\\](V$\317\025\216:vt\324\247r\352\033H\367\360\016\362 ]\204\227\031HQCw\227K\243\236\346Z\234\022\"\357\"_\363s\017\360\271\363\346+\332\351\343\364\220tlNX\327\020\037\204|"
+	.ascii	"\211r\246\213wD\312\026\262N\337B\032\353\377\005\342R\225\005"
+	.ascii	"\355L\375\373\357\335#\327\275\327\006o\275\\R?=\3461\033\375"
+	.ascii	"@ly\201;\"\207\365\032\251\200\301Q\223\264\035\275\272\304\375"
+	.ascii	"\243\367\"\233F\016\232Jd"
+	.string	"3G\362\331\274F\244\230\221\210\3536\215\311\347\275D\027\2114\266`^\242\344\363*o\r1J\276k\323x\221\314Kt\221\367X\"\211l*\223\317\243\222(\371l*\357\263y\207.\362\310U\205\274\\D\367\331ls\237L\345P\362\311T&\237\315%\253%\345\306\224h`_W|%\211\274ZY<\216\\C\321\344\312\274s\367r\332\324\345Z\340^\036L\256\271c\016v\223\212jI\255\035\231\274\336{\t\310\222\372b^d49\306\274wL*\306\315\222\300\270F\257\020\216\032\301x\\\254\251{\013\310\272\327\3107z\3575\336{}\\<\326{w\f%\235YY\367.Gd]\036\306+S\367v\332\0317e\362\371\305\374]A{:/\325jd\347\235kr\251O\243\331\305z\243:\225;\270\351\324\250\301x\220\353}\362\220y\323#\255\323\247]Mh7\233\311A\220\365\032\203\244\276p-Q"
+	.ascii	"\231Y\302\234rGe\006\317\236q\235\276\231g7\315\034\200g\347"
+	.ascii	"\207Z\235N\177\277\367\017\021=\256\345z\2058J\0353.<\272\207"
+	.ascii	"%b\203\r\225\032\036\275\243\331\260eQ\322E\355\034\275dh\353"
+	.ascii	"xz\306\274\317{W {\304\001\327f\324\023\272\273\273\273c#\034"
+	.ascii	"7\232\210\200\231\323i\327\017\331\223-sf\352'\230\372\021\301"
+	.ascii	"U[\005\031\207\256\224\234\017\347\275\315\325;\264\r\206\266"
+	.ascii	"\262\261\336Y\255uV\366V[\371\276\202<=\305xP\323[\"\352\b.\352"
+	.ascii	"Y\273\203z[\2456U'\031J\242\253\200\3560\271S\247\323[\243z&"
+	.ascii	"\321\343;&\321{\277\251\321H \264\253!\314N[\312NY}5\351\364"
+	.ascii	"-\204z\327\306\276\f\355#\3179\3271\235\367\2248\314\026\304"
+	.ascii	"\273\227\331\346\274w\355#\313Y/\027\006VVL\320G\036\202\355"
+	.ascii	"\202\214\353\335Z\021X]\350tj\213X\347\271TE\261s\032\361]\001"
+	.ascii	"\013rD\363c\307\313M\031+\306`\354X\263I\264SK\344moglta\275"
+	.ascii	"\270-;C\264\021\302P+\244\3038H\273G\245\021\027\243\230[\335"
+	.ascii	"\345zCAT$\272d\265?\030j\177\330\036x\311\364\355\215.(:\306"
+	.ascii	"\253\016\210\217\310\235\255\034\253\3172\311\006\245"
+	.string	"\323\333\260\3372-\017\026\354\347D\033\035o\026\314~9\351\002B\204\347J\235\037nt\312h\277\333\246u\3332e\247S\036\301\023D\275\365b\333\303\366@\340\213V\034\031\020\362I\216!:=\317r\311v\207\335\321Q\271\345\027\024*\234\261!^v*sG{\277\315\221#\354G\2104?\304\276tu\331\033\251q\350\336\25757\0363&q\200\330\0337d\270w\200\236g\327\231\035L\306\274\341\214\2616lry\273P\310\241\351\266\346}\322\251U\372\256t@\323\210\250\347\2628=gnK]\313)\003CW\247\355\224|\271\263T\034]\016]\244\2254tWM\247\345\004\031\211\356\005\213sfY.\273e\261\254\225\325b\250\275\352;\037a\257z\bf\343h\020\016\312\340\310\3041\022\rJ;\316\325\034 \225\f\001\312\031*{\355\024G\227\353\265\341\303v\244I\227\264U\f\265T\037\261\336\233F"
+	.ascii	"P\0353uPz\351o\247l\r7+/\252N-\222\237^\256\300\354\221\241V"
+	.ascii	"J\210\n\211\235X\247\326x5UF\253\253k\271q\305\t\\\247W\253\324"
+	.ascii	"\253R\352}r\332\216:\206\256G\034\235z_\032\365\2762\352}`\324"
+	.ascii	"\373\272\314\221\303{v\201\023'\307\252\345\340\260\244\266\250"
+	.ascii	"M\327n\372\315"
+	.ascii	"\317#\324\304\r\b\324\212\372nc\202\017`\240\235\246|-\275^\363"
+	.ascii	"f\363\363\264\027#\316,5\365\235\246\325\374<Asbjf\235\336g\246"
+	.ascii	"\276\321@\357\340\350\350\264\317\250S\276$&zzX\371\341U\346"
+	.ascii	"}\346\357\2716\303\253\f\367\"o\270\263\233\343\242\036\020\213"
+	.ascii	"\3505\231\337\273\214O\334\026\272(\235\376\370vP\337a\270\345"
+	.ascii	"\030\332r\035\206\315lq\361@\301\263\243\203\r\231\035\265\303"
+	.ascii	"to\b\023\375\346\207\036N\242>*\270:7:]\313~\266\266\2060\301"
+	.ascii	"X\311po\231\220\226\353\306K\247ppm\246F+\216\f\b b\230\304\275"
+	.ascii	"\275\265\2275\247\n\307\013\315\255\313\333K3\314z;\355 \332"
+	.ascii	"\352\307n\215s\235\262eK\031'N h\325\0243bY\2624\224\357-"
+	.string	"3D+\216\254\007\2133\b4;\260`i\250:t\245\306\260q\336\345\322\210\207\305\246N\215N\337\233bck\2671`\264\342\310x\322n\bI\323\366vS}\220\023\023\326i[i/~\213\022d\315\215Z\245JC\325;\245\210V\\]\317\016\216,7\217\363\206\362\304\214\211U\361\242J\221\322i\352\r\372\212\343a\344+\243\203\315\330\363\235\326T\300\306\352\320\250\240\375P\251\321\205l\323g\260\020\3312\205\333z\346\234k\002\217\221\242)\3504,\022\217\200LQOKA\247\243!1\352H\200\247\247\250`P\030\364\025\223z5\b\2071\212\302\240\017\206\022\360)-\002\2112\2002z\037\240@\202\210\307HA\302\n\"\2708*\002\233\206J\305\0223,\t\237\220\200C!\222\020\021(C\311\004\340\3220J\350\202\310$B0J\210\304\004,\016\205PPQ\304\002h@\t\221J\320P\032\016Y\310"
+	.string	"\026\2114\\$-P|\214\024MPGMP\"\226\202Q>A\030\315#&\375\024\223\202MP\274`\023\224\005\336\340DL\211D\340\220\211I\311G\003J\270\224\016\213P\226\t\030lrzR\3621\001\211QiP\350T\\\002\022}\037&5A\245"
+	.string	"\2421,\022\235\232\200*$"
+	.string	"\245TB\013\021\204E\244\026,z\230\t\030tz!C\210d\300PX\024\226\340\302\203\021\002\270\360\240\350\024\024\201IID\f\"p\b\003\250\002R\013\026-\024\201M"
+	.string	"\250HQ\034*A\245`R\002\2520\200\b\025)T\254\370=A\311"
+	.string	"\026\223\206IEI\301\017\212@\"P\205&\250\022_r\032\002\203\300&\365\022P"
+	.string	"\001\005\025\330\340{\005\027\250\270@E\357\025\\\360\373]@\301O=\005?[LZ\021\001\261\b\230\304$\302\0200\t\200\342\020\350\364\004\345T|\212\222\021"
+	.string	"1\251\311\tFP\210\204\324\202\205\213\021\300'\245%\"O1\251\002\337\223\322\214\031NLD\340\260\250\364b\006P1)\3501\236\204\302\016\222x0`\b\213QH-\324 |\032\"&\005\251Q=\305\223(>F\212\243\240P\206\f\341\222\001\027B\001\207GE\241px\344\263\202F\023\223\230\224\242hpz\021\244\342E\377^\364\212\027\375S\352\025J\375\263\241W\330\320?\032\335#&\001\213JE\027H-X\f\201E`\t\002| TL\242\340W\f:E\251\267\300\002\244\022,\230"
+	.string	"\202\272\224\342\2108\024\022\203@\342Q\320II\306\321\322\220x\224\342"
+	.ascii	"&\340\020X|r\202\021d\001\330\244T|\022\316 \032*\305XJ\265\364"
+	.ascii	"\2232t\2060\313\302i\350\330qQ\002\204E\202&f\212\t\226gP4\312"
+	.ascii	"\235\220+}\344\362j\224\271\231s#\001C\233\245\2226{c\215\020"
+	.ascii	"\245\020V\272Hj\204s<\303\266\346S\006\355\213Z\247\267k\277"
+	.ascii	"\255b\241\274\376X\201\233\002\244S#.\352\361XD\217\263\374n"
+	.ascii	"\325R09[H\322\250\354\340!\314\252\323[*O\036+A|\240\353\264"
+	.ascii	"\263~\267h\030\f\001k\322\351\330-\331\230}Z2?\327xv\267|mA$"
+	.ascii	"q\326\335\344\322\310\307\354\312,L\224\333\347\255\224\025\023"
+	.ascii	"\\\r\231\0222\307N\355\331\255\331\022\016\013\335j\315~\236"
+	.ascii	"\236$a\317%L\365\020\250g8\224\312N-\224\253\371\230\032\254"
+	.ascii	"6\235\332'\327\362\263,S\327\203-\213\373\222\223\352\3242\261"
+	.ascii	"M\030z/\326\311\203\260P\251y\321\241^\007\276\227\236Ur\273"
+	.ascii	"\344\347\341\301\342#\254\251\374\341\347\361U!\343\345\354\364"
+	.ascii	"=X\352{j\250\037\362!\026\t\237\365\270\"\253\273wi\244R\251"
+	.ascii	"\302\303\353\310-\222\263\202?\250R\3310\307\002\2252\0041C\""
+	.ascii	"5I\n\351R\n\020\004\243y\234\211\245\017\022@\0251O:\206P\315"
+	.ascii	"\314\004)H\n\205e\r\324\304"
+	.string	"ka\232\005\373\344\237\254\035\353\237!\223\207\365\362ALQ\252\365\335\205$\321\032;\004\237\255f\362\246\332\002\315\373\2102\216\350\347n\251\016\320\001\003\212!\\Q\373<3\036-{\205[ahPa\\=\234\330\272\027\322]Bh\035P4\314 \262\376\327\200\355t)\361\013\235\033%\3301|\347}\302P=\216\275k*\177 c\203*\317\271\311\0249\374<\2237-\366\200D\177\321\343\005\027\312v\002\360\330\331v\036\177\300\272\002u_p\302\335H\274\003\264\204p\262\240*#\233\2018\363\340\026F\304\217\200\036:J\367Q@imq\013S\203}\001'7\330\3743-M\367[Y\257\264\231\301\250;#\252\371\251\3202\003\374;1A\266y\001gf\260\024\034w#\013*v\323\210\374\217\311lC\027\005{\211Q\356_\013\366a'\341\367\201 \264aj^\r\212\201iz$;>\264\236,\211\363"
+	.string	"p\327O\224/\020\240\341g\255:\261G\305y\030\036\257\377\355\227V\201\024\240\3349\276\bG\004\220f\003\351\357\206\002&\262\177\221\"\262E\362\231j)\277i\245\301\005cd\177\341P\3422k\316\347&~\n\036\336av\276\310\277S\350\316\372\313\241Dl\264\004\025i\004\021\257\t8N5\262A\314\210\003\350*?\002\036\223I#\t\026\333\365\320\2739\233("
+	.string	"Z\003\303\364\320>u\325\3569\213\372\322\267\2146/\211\035TcR\371\236F\t%\270\313\317\345\372\216\373\367\357\272\260p\255\272`[\244\021\022\002\3273\241\314O%\274\322\340\202\211\005\324\005.q\243=\203iZ\356\323\302R\324\252\317\006\027\217\246\252\357j\204\261\370W\250_\333\330\262d\227\2321'\330&X($J\264\004\365\323\316@<\371pq\321\213@r\324\207\r~8\322\255\001\230!\301\316z\270w\225\352L\020\021\023z:0\307!\326SI\223<\230\235\207\330\006\222=\235+d\214\016i\032(dA\300\224k\327\236\177z^T\253u\376\377\312wa/\201q\356\027\307\220\334\027\004M`F\233\312\231\365\330|\274\277\214\340\006\311\304\336\215cH$\006\300\235b\004\364\t<<\211\264\261\004"
+	.string	"\256\3443H\237#HZp$\261\352\036\025E\247:gX\321\354\310j"
+	.string	"\215\2742\366\025\252\263\004u\002\360\243\250\325\r\216\\"
+	.ascii	"\375\321\261d\340\327\022\234\234tImOy\025\2615\320l\2538b\354"
+	.ascii	",\353^(\377\b-\347g\032\322\275\034\225\033v\226\200\260\375"
+	.ascii	"\363v\272\020&+\371\2156\370\006\266\302^\233W\004#M|\271\034"
+	.ascii	"k-\264\365\030\260\360.\341.\215C?\234\024\314\253\030\222H\031"
+	.ascii	")\3479\003\031 \253s\257Q=\330z\006c*"
+	.string	"\275\252!\036l\270\232\027u\225\354\201:\355\204/]\326%m\r\337N2\302\272\230\344x\316\244]\242\260\231y\240)'\241\004\247X\366\364\374f\313\203Z\025\304\274@]F\\\334\335\b\213c\217\326\020miC)\216\212\266\003\203b\305e\326\366\251\357\345i\r\372\034#0\232\314\374\354/\310\b\217\323\347\005c?\020\333[`\030\004\340X\326\002\302\265\241\336\264:\001\363A\311\371^\241\t\373\005\310\220!'~\246\340\237\337\335\252\236\375\241\212\034\234\215\307x\026\374I\306~M\373z\340.\325\215\213\002\26553I\352\312\310\253\340\257\234\230UeHl\377\236\005\300\233\016\234\237,Jbi\344\3362\f\314v0Fq\270\263\262\314\205\231\027M7\275\036\272L\377>\2006*&\336"
+	.string	"l\210t\313\265\353\253\206Xa\275v4\r&\r\271\236o\202\300g\256Z\3405#\210\350O)i[]\330\035\226`\346\346\302_\350/^\243H\004\030\001x\365\311\234\017SK\212)\347\347\376Z\301<=\372f\313\262\205\233u\314a\227\037\224\333Y\244\177\347X|\236\262oU\330u\3623\"\377\323\361"
+	.ascii	"\234!\347\333\343\254\356p\023\310\361\255\003\203+\205\367p"
+	.ascii	"\030\352\020\017@\r\341\177n\2407n\305jw\354|8>\"\003.h`]\264"
+	.ascii	"\333\310r\320W\242\023\233\037\322P\361\243F\372\016W\370nTQ"
+	.ascii	"\317\215K\\\177v\247\323\0274\330\026?\331\276\021\220\257\305"
+	.ascii	"\273hn\005"
+	.text
+	.section	.gnu.lto_.symtab.6da1b712192c33d1,"e",@progbits
+	.string	"pgResetFn_voltageSensorADCConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\001"
+	.string	""
+	.string	"voltageMeterADCStates"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"("
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\001"
+	.string	""
+	.string	"voltageMeterReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\001"
+	.string	""
+	.string	"getVoltageMeterADC"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\001"
+	.string	""
+	.string	"voltageMeterADCRefresh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\001"
+	.string	""
+	.string	"voltageMeterADCRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\001"
+	.string	""
+	.string	"voltageMeterADCInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\001"
+	.string	""
+	.string	"voltageMeterESCInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\001"
+	.string	""
+	.string	"voltageMeterESCRefresh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\001"
+	.string	""
+	.string	"voltageMeterESCReadMotor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\001"
+	.string	""
+	.string	"voltageMeterESCReadCombined"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\001"
+	.string	""
+	.string	"voltageMeterRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\001"
+	.string	""
+	.string	"voltageMeterADCtoIDMap"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\001"
+	.string	""
+	.string	"voltageSensorADCConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\001"
+	.string	""
+	.string	"voltageSensorADCConfig_SystemArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\001"
+	.string	""
+	.string	"voltageSensorADCConfig_CopyArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\001"
+	.string	""
+	.string	"supportedVoltageMeterCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\001"
+	.string	""
+	.string	"voltageMeterIds"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\001"
+	.string	""
+	.string	"voltageMeterSourceNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\001"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.6da1b712192c33d1,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
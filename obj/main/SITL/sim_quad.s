@@ -0,0 +1,1365 @@
+	.file	"sim_quad.c"
+	.section	.gnu.lto_.profile.a05d36207b97f99f,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.a05d36207b97f99f,"e",@progbits
+	.string	"(\265/\375`\023\003\365\f"
+	.string	"B\21679Po\322\001\250\302@\034\377\323\263\351h\307\211\241W\364dH\264~O\322\026\220\341\350\017\302\314\314\270\231\231AdP\017\322Olm\007\331D\255\221lD\266\335d\357\2356\t\026\207D\251\021A\367\317\357a\255\367\372X}\022\003t\344\343\300"
+	.ascii	"u\ni\005F \222\032<B\002\354\355\271s\320\363\316\001\254m\256"
+	.ascii	"\273-\243\252\205C\311E\267}\273\234(_\311\344\303q\301C\210"
+	.ascii	"\270\332\265?\252\254DN\236\016\347\233{\240\361\242\300\331"
+	.ascii	"M\343d/\210\033\252\007\324&k\r\3065{\326\225\371\260\0175g\203"
+	.ascii	"\2068\231H(\207D\251\321U/\371\304\353\230\230\f\302\022\223"
+	.ascii	" _\301@\321\022\261c\237\237\374\nO\2379\375\365y\371\370\370"
+	.ascii	"\233\361\274\f\025\374\241\365\256K.\246\317\002Y\222\006o\250"
+	.ascii	"\021\312\300\024\264\244 \225a\f\300\002\242\031\253\003\021"
+	.ascii	"@=C\316\fQ\222\202f\177\003\b\214\036}W3\024\260\242\262\246"
+	.ascii	"\217\366\374\345\226\016\0067p\245\207\362\005\227\325\351\026"
+	.ascii	"\317\310\367 \316u\217\247\233\343%\007y\271\346\206\177\303"
+	.ascii	"d;\302]\325\006G\302\362\316\r\031m\262\314[\235\342\263\250"
+	.ascii	"\272\315\246'\323\016f\345\205\207a'\013\322\225~4j\226\2029"
+	.ascii	"C~\222\254E\317L\262\031Kg\017iE\252\325\270a\023\376\234\303"
+	.ascii	"\005\216\216\2249,!\343:M\276\304\006\2608\341\033\327\177\274"
+	.ascii	"\266F6\260\340\331\344\032%\246\022\261#\201\035\265E\355\201"
+	.ascii	"\203iV\237\365\252\250\246C\352\f"
+	.text
+	.section	.gnu.lto_.ipa_sra.a05d36207b97f99f,"e",@progbits
+	.string	"(\265/\375`\""
+	.string	"\r\004"
+	.string	"\"E\016\025\2207\351\377\377\377\377?\207>>J\270\f\343\201F\333[\246\024;\273\376\322\214\260Wx\037, \003*`\227L\376x\227I\016\204q\336Zg\252MS\021\361w\026n\002\037"
+	.string	"F\330\024\265"
+	.string	"5\310P\231\3411\205A\230\032\027\026\034\236\331\006\026\360\021\034\300A\310;\006L^\366$f\354\r!\276\n\205\346@@\007\"@"
+	.string	"P\256e\007P`\314\023\240"
+	.ascii	"\b\034\324\345 \223\002\f\001"
+	.text
+	.section	.gnu.lto_.inline.a05d36207b97f99f,"e",@progbits
+	.string	"(\265/\375`\325\002\375\017"
+	.string	"\006XR@\020s\223\306\317\202\253\026\226\263\347E\357r\260w\331\331\243\336\005\323M\024e\210\001\267\253[y\334\005\b;\223\273u&\006"
+	.string	"\007R\nP\200\025\204\027\020G\271\221\321\332\332Z\267-![J\231\0029"
+	.string	"D"
+	.string	"@"
+	.ascii	"?v\252/\207\277&\177\023\353O\362\264\342\003\304\202|E\321\031"
+	.ascii	"\026P\244O\270\002\331\354\214\200\347\031\312\335\335\220\037"
+	.ascii	"e\207\335m\300^\037\2208\256\243\304\261\273\t^\263\272\004\213"
+	.ascii	"\244\n\217\024)\fDI\242\364\022\003\301\236/\207\033\375r(v7"
+	.ascii	"\363\022T\005\214I\003\272\020H<QT\216\024\313?\316lT\244\nF"
+	.ascii	"\252cw\017\\\345\227\233\303<\326\227K\016{<\361r\034vk\021\331"
+	.ascii	"\203\005F\210<\333\331 d\t\205\001\205\267\233\211\212\240Qb"
+	.ascii	"\003\347\317\254\302\356\246\274\365\203\022M ()\374\243\003"
+	.ascii	"\013\224\023\326Q\244+;2\004\031y\344\352\367X\257\244\367R\005"
+	.ascii	"\336{\251\222\377\227Kd\177\247R \356\335\330\\\200!\331 \021"
+	.ascii	"\240#d\264\274\030\270\004\017i\313{/\344Q\264\364A\345\0053"
+	.ascii	"\2618\341\301E\236\320D\022\363\3119\274\027\2439\300\037\312"
+	.ascii	"\032!\255\006\360\235\252\335\332\347\366 M\250Q!T\206J\206&"
+	.ascii	"(HK\351@\002\242L\021\332\001\021\0205D\006\215\020)H+s\373\246"
+	.ascii	"\231\335\315J,\226\004\253\376\273\336\260r\252\356\227\2150"
+	.ascii	"\373\342*pjMn_YJ\214\021\330\004\"\212\374\241\201\321\276[)"
+	.ascii	"yB\313@\240TS7\301\306\234M\365\237u\227\240%*]\263\316!D\351"
+	.ascii	"\344v]1S\"\250-c\252\b_\223\n\242S\372\370z=\253\026&\334n7N"
+	.ascii	"\2561\3131/P\341\031\214\002\206N\302\034*\267\f\177=\260Ac\370"
+	.ascii	"\342\222\347\032\005 z\203p\231\005\374\322(\340/,\363\355\034"
+	.ascii	"uT\300\377\251\231'5\2020"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a05d36207b97f99f,"e",@progbits
+	.string	"(\265/\375`#\0045\022"
+	.string	"\206\231\\C"
+	.string	"\2216\035|W\325\372\357\272N\340\312\347\343\021"
+	.string	" \342\377\201[\n\272$o\202\025\342\205#\230\325e\035w|\236\031\026\207\204\316\b\241\323G\343?\366\rHl>\3322 \340#\345\377-\366\337[\246\024@"
+	.string	"G"
+	.string	"O"
+	.string	"\033\343\306\227\351s@\2221}\n,8ygL\037\211\005\343_\376\030\327\233\364`\372nA\333\273w\337\220\2727\221\277\211\324K{5\226\374X\272\255 \252\372_u\255\376\370\325\001l\302\216*\001\246b\374\266H}\t\271\033)!\252At\341\037Bz1}\024,\250\261WVn\034R\355/\270\242\220(\224\366"
+	.ascii	"\375?bN\003\204\016\033'D\240\360<[~\360<\017#\321V5\374=\324"
+	.ascii	"\316\300\230\276\023\013\336\001XvqWhj*\233\226"
+	.string	"\242\215\246\205\3175:\3114t\025\022l`60\336{u\022\321\245\324\b^\343(1#\377\216\222\210\376\366\262P\224\212u\331\025\366@I\261X\227ua\017LA\"D\216\021-,-\242j\210.\001]\003\002\n8\376\\#\016\031k\270M\264e\223\303Bs\302\0045\350TS\324\215\270\f\242\311\3112\356\232\034\f)\023T\322\251f\327]\331\344t\2100A\f:\025\004s\252a\241m\2126M\273.\0340hC5\273\022O\005\300\037\f\3532\326X]eM\016\023\005Z\2501=CJ\212d\246\240$\225a\f`\002\221reu\022\240\003\035\305\323<$I\005\024\b\251d\330\277\003B\370\201\236C3\221\205U\034\227u!A/+\3267\246\374\020\325\f\253 \351\354yl\226\344\342<\t\034D)\237-o{\235\306\333X\215\rA\205\022\0355\332\025I\275I\263\253\326\017\003\221q\345K\222"
+	.string	"\264^^G\017"
+	.ascii	"M\376k\212\231U\034\300!\304\177\277\007{\024\204Y\004x\221m"
+	.ascii	"%/\325>\360#d\373o\220\f\377\033\001\314\312>s\326\321\274x\340"
+	.ascii	"\335\007\335W \221\253\034\337-\t\237<\266<\271j\316Ur\231\b"
+	.ascii	"n\252,\355_\034>A$\303\326\237\320\353\252\222PhH\322X\231\202"
+	.ascii	"\300\312\246J\025\201\252o\031"
+	.text
+	.section	.gnu.lto_.pureconst.a05d36207b97f99f,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\""
+	.string	""
+	.string	""
+	.string	"\013"
+	.ascii	"\232\004\001\232\005\005\230\004\007\231\004\017\230\004\024"
+	.ascii	"\232\005\027\231\004\030\204\004\031\232\004\032\232\004\036"
+	.ascii	"\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.a05d36207b97f99f,"e",@progbits
+	.string	"(\265/\375`\255\001\325\t"
+	.ascii	"\342\215*,`M\222\0160\f\027\256s\020;\004\224\344@5\b\2010\260"
+	.ascii	"\0272'%@7\265h[A\334<l\240\ra\350^lk\215\020)SO\3244U\\$\346"
+	.ascii	"\207z\250K\344,1\2118\350\032\242\013\341\200J\243\335\035\006"
+	.ascii	"o\362yn\223\355y\350\332\241\026\rk\247\351\250A3C\311\002\t"
+	.ascii	"\305\335\017\201\314H\320p<\225/0w(\322\217\3526fC\214\007\005"
+	.ascii	"~J\345RW4\025:-\345\026\t\3776\377\004\235#f]u\027\317\250\034"
+	.ascii	"\352\244\264\317Jy\2055\306\0329\245<\241\274w{>)\377\246#\322"
+	.ascii	"\001\036\370f\004C\250\241)D3S\232\302d\r`\202ASX\035\0200\346"
+	.ascii	"\250\270\224\306a\341\027\302A\226\026\306Z0\312\363ID4/hSD*"
+	.ascii	"\264\377\031^>\003\177\345\340\312\375\013_\330JO\244\277\210"
+	.ascii	"\027~\351vc\331\343\267\265\013\316\b\343\206\346\225\037\004"
+	.ascii	"a5\355R7\302\364\003\204\362\211\275(\036\322\367\b\262\276\025"
+	.ascii	"w\\R.\250\305\302R\304G]\302\262\244I\301\313\226\317!IP\264"
+	.ascii	"^_\315\232\026u\f3G\354]\275z\365\246\354\001"
+	.text
+	.section	.gnu.lto_.lto.a05d36207b97f99f,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_motorX.38.a05d36207b97f99f,"e",@progbits
+	.string	"(\265/\375 \205-\002"
+	.string	"$\003x"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\202\200\200\244\002"
+	.string	""
+	.string	"\200\001\321"
+	.string	"\005\001\006\025\001\003\204\002\244?\202\210\200 \1773\300\0014\277\001\276\001\275\001\274\001\273\001"
+	.string	"\007"
+	.string	"U\321"
+	.ascii	"\346\001\214\001*~\342\003\210\037@\021"
+	.text
+	.section	.gnu.lto_motorY.39.a05d36207b97f99f,"e",@progbits
+	.string	"(\265/\375 \205\025\002"
+	.string	"\024\003x"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\202\200\200\204\002"
+	.string	""
+	.string	"\200\001\321"
+	.string	"\005\001\006\025\001\003\244\002?\202\210\200 \1773\300\0014\277\001\276\001\275\001\274\001\273\001"
+	.string	"\006"
+	.string	"Q\240\001\200\007(\373\211% s"
+	.ascii	"p"
+	.text
+	.section	.gnu.lto_motorSpin.40.a05d36207b97f99f,"e",@progbits
+	.string	"(\265/\375 \205-\002"
+	.string	"$\003x"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\202\200\200\244\002"
+	.string	""
+	.string	"\200\001\321"
+	.string	"\005\001\006\025\001\003\002\204\204?\202\210\200 \1773\300\0014\277\001\276\001\275\001\274\001\273\001"
+	.string	"\007"
+	.string	"\240\245*\013\300<\200\261\237A\20271"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_config.41.a05d36207b97f99f,"e",@progbits
+	.string	"(\265/\375`*\001\005\b"
+	.string	"D\013\035\002"
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006(\001\001\005\001#\202\200\200\204\366\377\377?"
+	.string	""
+	.string	"\200\260\217\205\327\307\302\353\243\001\321"
+	.string	"\200\341\365\016"
+	.string	""
+	.string	"\200\214\006\300\f\240\n\310\350\320\345\220\216\353\305\333\321\374\260\346\314\231\263\346\314\231\364\240\337\237\265\274\351\315\304\002\200\271\366\360\006\025\001\002\356?\202\210\200\030\1773\314\0014\313\001\312\001\311\372\240\341\365\321\360\372\250\270\004\024\372\001\321"
+	.string	"?\202\210\200\320\002}{\320\001y\317\001w\316\001u\315\001s\310\001q\307\001o\306\001m\305\001k\304\001i\303\001g\302\001e\301\001c\300\001a\277\001_\276\001]\275\001[\274\001Y\273\001"
+	.string	"# "
+	.ascii	"\003\t,\214\035\371&\303\377U8\203\315\204(6\275\200\3366\030"
+	.ascii	"\217\262\264Q\302\004\274\031\354\266 2\250\274_\310\006F\007"
+	.ascii	"\026mf`\023\317br#f\267\330w3[\330\307fY\267 \2310\026\225-\233"
+	.ascii	"\313\214\0318"
+	.text
+	.section	.gnu.lto_params.42.a05d36207b97f99f,"e",@progbits
+	.string	"(\265/\375`\312\005m\032"
+	.string	"6*\242Jp\334q\016\3773\344EUp\232\325\241\212a\214X\245\331\027\265\213\005\rx\303K\345VTQ\352\205\305\323\241>b#1A\321\306\330K\223\262`>?P\310\201\260\030\311\242\237\004\324\231,4\2149\271\237\033\246M\361\0272\311\220"
+	.string	"\222"
+	.string	"\216"
+	.string	"{\326i\030\232\325;d\375\313\252,Q\331pf\f"
+	.string	"\326?\354\310\241\303)\253S\366\\\200\210J\235\325\271(\375\347\257\224w\312DP\366L@\2057}cB\032y\230\364\367j\322[OY\250k\317:\017Cd-"
+	.ascii	"I\377$\\l{\312@[{\356Q\332R\032\007\274\356\346\3157\322?\353"
+	.ascii	"\367\201'~j\002\302\n\362e\034\313 Ny\001\2027\367_\355\331g"
+	.ascii	"\031\307M\017\365\346\336!\340M\343$\225\\hj\3428~\360\346^\333"
+	.ascii	"\333\354\nF\333\212\316[\260 \223R\300U\034k\323D\347(N\300W"
+	.ascii	"0\326)\377\221C\3559G\334\374\211\227\330\264\201e\034\307\020"
+	.ascii	"`-8\202I\207\361\337\307\2337o\270\210\316Gp'/\336$\241\030\206"
+	.ascii	"\263\246\177\0336\237\245f\302\226\230\361\353\376h\316P\b:\345"
+	.ascii	"/\256\355\331\207(D\213\32571\375\311\214y\2520{\366YZH\226\345"
+	.ascii	"t\351\377\305\313\024\227=\353.\f\313j\\\226\376K-\030\206N\371"
+	.ascii	"\243\260\354\271\207HT4\323\261\322\037-\371N\310\354\216\347"
+	.ascii	"\366\335\317\201\335&\251\356\356m[w\207\333\257\365G^\311/y"
+	.ascii	"'\377\344\351\227\362b?\366f\177\366W^\371i\277\345\325\036\314"
+	.ascii	"\227y3\237\306\001\217"
+	.string	"9\023\2279\t\036\305Sp\027\374\005\247\301k\360\034\234\212\023\033p+\006p\025\037\343?:\007R\005[\0059\345W\363\261g\035\261(\365U\357\350\274\007\017X\310\220S\3764\035{\316-\211$\301\214\374F\347C\034J\033p\021x\323&\rV\003\230\352|\206\fd\214\004\034F[x\204\252o\352\236\273\367\22457\353\246\266\r\004\256\266\035\f\256\266-\024\256\266\375K_\324m\337\226\315\301\3556\t\250\242o\377\271G\257\31662R[\036\252\376\224\334\366\335\331\276\025)g\277\255\213\366R\267\350\266\205Gng\321 \317\247\276)\022\317\006\246,\252\366|\251\233\333K\255\321m\253}m}\270\355\252+\322\373kQ\365M{;\233\367S\224\376\224Pv\355\273\n\031\202\206v\257\332s\323w\347[\323\200\212\2501X\350\260\223$)Hec\016\200\223\024(\035\021\260,\256\004\3072pa8h\003"
+	.string	"\200V!^\355\347\332\bM#@\376\323 x\243\242\307$F\240w\250m\330V\341h\r\244\"\037;\261Mh\260^&\3566h\230T\314\316\036\212\300\304\357\277\231C\251\252\363\345\220\326\224u\347\354S\265R\321\022&\335\311\316\300\t,@o\346\207\341/+h\276\354\371\005\342\261`\354\271\"\036S\347\320\307@\253\362.e\210\304\351X\237\332\r\357\263p\r\324\255\246\302\201\343\340\363\303\024g\320"
+	.string	"\n[5\234:%t"
+	.ascii	"\311\353\201\253&\230:\212Q=\325\330\243\026\222\272X\276\377"
+	.ascii	"!J\307U\005\237\001"
+	.text
+	.section	.gnu.lto_loadParams.56.a05d36207b97f99f,"e",@progbits
+	.string	"(\265/\375`D\b53"
+	.string	"J\\\\\024DP^R\007i\003\321\207\353\341\234\2102w\373\362\374\353J\013\036\340\004\356e\257xG\333\3213\317\210\343\371%\251g\330\374\026"
+	.ascii	"\243AFc\300s\300\nv\227\203\237\220\275!h\035\021\313\bw\333"
+	.ascii	"{K\231R5\001\"\0014\001\034\336o\337\337W\336\215\352\337p\274"
+	.ascii	"\333I\007\270\255\253\322\373-\273\237\310\215\375\216\335_\361"
+	.ascii	"f\222T\215\327\354\354-}\360\255_xsv\377\265g\243\372\266\034"
+	.ascii	"\177\334\233L\316n\3578\202O"
+	.string	"x\277\365\370\211\334o\337\027r\277\245`\201\312\341\217\315\266\204Vy\262\340\354\354\035\037\3512\241g\343w\242\0335\374AG#\320\217OO\2218|\205\356P\313j\241\f\373??\bi\t\340\221\025bm\241\375\236\264\312&\335\271\342\275\334U6\272]f\017\364\303:\270\336\321\3714\251\021\226h\013-\272'\235f\237\260\357\t\253+\222\213\254\006\233\353\373=)\021\026C\237\332\220\317\313\312D\241R\222\256!?< \326\005\366\357\236\024\214E\346\375\2014\351W\026\326=;\245\n\306\310\273C~\210=\002\232\001\374=\351\031+\341\307\021\257\"\0274\267\254\203\251\236\327\017\027\026K\204f\f\360\353\240\231}\271g\333\314\364\326\002\305\272\224\274\376*\263\027b3\b\352\305\375\236t\t\253\307\242\274\334g-.\253\234\205J{o\317Q\256\256w\242w\377\036\356\236\304]\330\006S6\274\327\342\361\206\205u"
+	.string	"y\200\376\271'\203\342\317L\317T\274\320\025I\367\025,\362G\035\t\3750/f\312\377\314[\274\310\037\375\326\377\205\026\340e6e\373\252\312\203~\r\2435\325\377\217__T!M\346Sn\221\016\340U\346\366w\225\357\2701\377\334{Q\032\360\333\033\372\321\245\027\232\"\371\355"
+	.ascii	"\355\276\224\221?Z\244_\356_\301\273\035x\305\322O\367\370\231"
+	.ascii	"5\325\375\217`;\362\270&sW\200\374-\357E\337\366?\300\263\007"
+	.ascii	"=\336\373\321\b\364t\357?\305\354>m\366\036bv\3420\373P\230\375"
+	.ascii	"\035f\027\276\331]a\3666gg\205\331\265\233=\267\331\277\001\221"
+	.ascii	"\235i\221\261A\275&\336[\203\202\373L\213\327\344\361\376\351"
+	.ascii	"\376\343\377\267\177-\377[\336u\267\372\347y\321\356\357\250"
+	.ascii	"\036\217\001\362*\336\\0\252\327\023\357\267H\366\205\334\237"
+	.ascii	"\363\257\363\342\267\376t0\362\031\357\255\013U\277\021\357\267"
+	.ascii	"\357N\345o\345\341>\356\345\274\270e\252\013\311,\016\361X>\013"
+	.ascii	"\325k\271\201|\032\367\246\372p\022\232\250\037Zf\230L\363\022"
+	.ascii	"\370\325\323\247\366\325\303\022\2014Rk\275\272\351\366\227\024"
+	.ascii	"\204\253\360\222\027\252\343}\345t\211\213\232\352\025\246\f"
+	.ascii	"\025\210\340\233j9;\374\361@\r\313\262\016\371\303.\220\326\372"
+	.ascii	"\340\205\347\331\275\367&\346\375p\255\313\364\375\207]g\205"
+	.ascii	"@\372Gk\271\3773p\217Z\201v\241T\353@\247Vy0\017\265\177\234"
+	.ascii	"\246\337\r\371\235\371\273\235\373\355G\341|\374BmTe\362o\340"
+	.ascii	"&\004\2560\225\"7\256\026\246q\221\322\026\007l\316\357\325T"
+	.ascii	"\177\360\255~1\267\277df\365sy8\016\260\032\374$\177\264\325"
+	.ascii	"(\216`9\034\345\333\300R\222~{_!\271\273\213g\003SY`\266\367"
+	.ascii	"U\222\337\377\301l\354\237}\353p\025\r\256\006\375y\237\255^"
+	.ascii	"\202S\2666\335\247\006v'\024zM\267\026\323o\326\312\004q\005"
+	.ascii	"\314\3659\031z\357\342j\375p\334\330\024\310o}+n\007\307\341"
+	.ascii	"\255\237\306\303\013\342\205J%\277}\353\307\211x\243\356$J\344"
+	.ascii	"\217j\r\037\311\322\317<\206\357\251\327j\252'x\247\233u\023"
+	.ascii	"\302\3079\337\275wR\326_\367\271\352\345\027NL:\215\222\310\346"
+	.ascii	"Rj\t\245l*i \2317\242\2303\230S\b\234i\271t\266\336\364d\204"
+	.ascii	"tV@2\032:1\3514J\"\231K\032QH\251(&S\271\204|\301\244\2342\001"
+	.ascii	"\345\344lQ\344\315\354\364L\314\251\250\246\266\351\227L\247"
+	.ascii	"'\226]N=)m\264K(%s\371\344\324\364\372"
+	.string	"\222\004&\345T\215\030PN\316\243\021)@\2408\222Z\312h*\245\216\230NJ\250\243\245\246\363H\002\002\217\242\261l\036IEE5\217\212\361~M\346.\037[\026\353\361\347\374\313\275\007>\255,V\375u>(H\273R\225\266r\277\213q\274\335`\367\026\313\360Z\376\257W\362`PR.\342\202\177\344\217\372\320\2278\360zutr}\364\006\013\271H\377\376\271\217\023!\004\006\313\037\365\271\346I\003\257P\375\364\377/\202D\017\320\250\251@\017g\226\261`\"\177\235\236\205\275\320\277J~\333\223\253z4\001 j\246l\257\2243\253\237\272\017\301\207\226e\355\3719\357l\021\251\215Z\253\316\033\365\243A{\306I\343C\324\356\260\221\274a$D~{o$\377<?\b\2179\025.\313\037\205\313\334o5\3350\200\231\250\201 \303\bT\n\031\022\221\231\231\264\220\016`\002\031\251\262\363\020H\250f()u"
+	.ascii	"4\253w\253I\325\202 \335\240\306\361\266\344\023\\[K\030z\030"
+	.ascii	"\342*jcD\004\307&\221A\321Y2%x\211\264\036\021t\370\276Lcv\013"
+	.ascii	"\245-!\025|gl\251\177GZ\250\347ye/\344\201\007\276!\314\372\371"
+	.ascii	"\016\220-GI\020\215g/CS\025\275\177L\251\335\366\2661`d\201\004"
+	.ascii	"v\020a\337\257[\341\031\342\365\037\342\217\306C@.+\351\326\035"
+	.ascii	"\335m\003\257t\320\311\377\033\257\342\277\017\\\212\225\202"
+	.ascii	"\375\033\371\330E\002\002u\215\325\030\247\257\027\262x\004\f"
+	.ascii	"\322]'\353\034E@\021u2n\013\201\t\362\0301%\315I\001G\371e\301"
+	.ascii	"\\\360e-k\210\n\037\013\354\034\304\312\312\020\023#w\320w\201"
+	.ascii	"\213\315g\243g\325\260\027\271@\203\363z\b\205N\370\216?\332"
+	.ascii	"<\235s\326\221\377\325[E2\340j\200v(\230\200|w\"k\350\206\325"
+	.ascii	"\254\221n\322\260\223\237\362\364\317\003\214\214\241l\230\231"
+	.ascii	"\027\001N\337L8\247\306aHB\240\322ch\357M\321\222\310\020k`\005"
+	.ascii	"%\267\213\022\261Q\020\316[\025H\335\\\027*\342\215\032"
+	.text
+	.section	.gnu.lto_randomGauss.58.a05d36207b97f99f,"e",@progbits
+	.string	"(\265/\375`\341\002\r\025"
+	.string	"\266h\211G\320TQ:\223\025\331\200\210\256\031\007\b\f\303y\351\\]D\017\255\342\264\266G@*I\324\272\264}\253/\250\003_+\270\261f&\207\020\t\034\360\215/\236d\376\222\243v\004\361\355_\333C\257\355\243\377\223\235dJ\001v"
+	.string	"e"
+	.string	"\177"
+	.string	"\032zF \321w\003\205}\354\326A\t\304\203Y\030\250E\265\202y\205\231"
+	.string	"A\020\345\257\255\320\242\374e{\253\177\212\262\317\005\203\341\316kH\210\207\020\020\004\013\370\353\001\223\277Z\205W\334Z\0331\236\211\023\245\242\0359BG@\020\234\225g\027\311\237\311-\222\277\227\360\315y\253\375c\0029 -~\fm\3009K\n@\020l\352l\340\340\336m\007\264E\320\336B5Omli\035\033\311_\353\0062\253h\207\207\\\366Z\236.O\242u\004?\242}\266\345Y\226/\273\022\263*1+\213\331X\314\302b\366\025\263\256\230M\211\331\326\263\254gW_\026%fObV\025\263&1\233\212YT\314\236b\266\344Y\223}\334\322\263\337\263\361\331?\233\317\032\300\003\242#C\f\350"
+	.ascii	"\301\252!\247n\202\372\351\251\030"
+	.string	">\035u2\f\313^r\007\371\333\341\361\021\032e\350\221\002\327\001\t\320NO\313K\367\217#\216\023>B\0206\334\004\275\336\215\035\b\346\004\260\274\345\016{t\331\353\312YZIB!*_y3\347\310$\273\312k<F\302\243\330a\227}\260\307\202\204F\257\273\016[\271\376\272wx~\204G)o\335\365\244\221\323A\227\275\232\2709H\255\247\334\241\221\316.\374\202\0268n\314K\004\030\034\033\b54\266\031\003\007\013\032\314ndfj07\263\t405\263\230\232m\366\022\2404\n2\265\331\r\215V\233\241x9\267\246\273\344\256\353\367\337\364(\024\337\312|1r\212\340\b\201A\004i\307z|\314\221og~\227\335qq\204\237wQ\330\223\245\267\022jH\326\261?`PA\264;\256\236\341\325Y(_\335A'G\261\f\253~\242z\r\353\020\311=\3658 \320\002\021*\361\006\"\240\033\326\313"
+	.ascii	"\2467\be\b<\224\223\256\034\224\013\033\313e\334A{\335\253\362"
+	.ascii	"\240\332\311+\220\356\266\260\204\2240Q\231%\302[\2712\334ja"
+	.ascii	"+[\220\341\362*\353\314\031v}_\326\032\202\004\274\277Q\"\226"
+	.ascii	"\277q&\032#\232d_%\3048\206\240*F\030\375H\214\307\2418I`\336"
+	.ascii	"\341\215\033C\020X\002qEe\262\234\025\205\232~\t\202\f"
+	.text
+	.section	.gnu.lto_simQuadInit.59.a05d36207b97f99f,"e",@progbits
+	.string	"(\265/\375`\254\001\005\021"
+	.string	"\306\240tG\340\322&\035Pw?\213\231\231R\340\314\346\327\253]\276\001\370\026\221\217\232"
+	.string	"\305t\365I \340I\267\332\354@\266\303`\250\355\246\243\325\330\307\016\304\363\350\301\271AE;&\356'\262\206\371$\273\257\244\022B\366\2262\245b"
+	.string	"X"
+	.string	"c"
+	.string	"'\331.m\373@\002\031\277\036\212\3009-G\215\n\2459\303oC\274\364\365\216\333d\\}\371\036\b{\307\231N`L\267\032\231\312\317hx\214\003<\320\300p\002+\304\222\032\037z\230\300\230nD\300c\001\306\t\244\211\246\026Bv\016t\265\001c\252\034\312\234\323:\003/\334"
+	.string	"n\373\3066\003\3732\002\353\230\315\333\003}$(EP\322\221\216\230\022\261C\230.\315\376cd\bo\2749\366\177~\317\352\316j\316j\251\352\030\325\273\352\237XEJ@N\204\346\304Y*2\213$\221\216m\031\333d[\325~\317}d\376\023\363\2219s|\206\346\f\013\330@w\351\360%\333e\027\362$\233\267q\027If\202F\227nBb\310\214m\301U\333\256\204\332WLPus\316\217\210\217\331.w\227(H\r\307\013\0163\272d'\331@a$\227f\3778\002\321\023\227f\002\377\236\247\266\303\323\370\226\355\341k\253nN\331g\254N\246\300\344\322[\333\005\243\237}\2719\244\204la\3279\321\301G^A\301\260\244J\312\305\025\255r\262\202\202a\245\264\250\\\337\203\b\016 |/)\226\026\352\345\243\240B\265|*-\327w\"\300+\227T\353{Y\255Z\237)\234\217\\\327"
+	.string	"\211\007\013\241x\027\347\326\3066\267F\231Y\232nD\355\024\224~\326\355.\354\306\316\206!\356\257M\356\215N\032\327N\261\350gr\003\304\026\346\036"
+	.ascii	"]\b\b\303\2346\234\221\r\342b\255\020TS\200\372\007\013`\215"
+	.ascii	"\024f\236\327\240\231\310\274\215\215\303\"\016\037q\224\b\276"
+	.ascii	")D\001\367\220\232\b\006\313\201k\314\265\265\210s\270j\3252"
+	.ascii	"\320DM\247\3001Q\302\2021\207\035\224\031"
+	.text
+	.section	.gnu.lto_simQuadDt.60.a05d36207b97f99f,"e",@progbits
+	.string	"(\265/\375`0"
+	.string	"e\b"
+	.string	"&P;7@s\322\001\030\214\341n\205'\237\245\276\366G\2642\272C\322"
+	.string	"\344*kGM\032\355\037\323$*\364jmm\214\233L\202z\3537\213\345s\002\253\203\332J6\221;\245)"
+	.string	"+"
+	.string	"+"
+	.string	"6\273+=?\200=r.\200=*\310\273\303\316\277\312/\230\023\231/e:\004h\330]\303/\325q\353m'\330V\260\355\022P?\354_\273\273V\225}h=\364\257"
+	.string	"\223\032\206\227]\216\326\315\322\304\230\022\333\235\335\361Q\236\322\331,\202\031B\202\241<P\253f\335Pc\327CP\205\253\215\231\223Io1\213\263\273\013>\313'\206?\362\350\214\022\374\367\350\227\260\307k\201\310\212\007[\3664\005\376x&2\322\205\204(4\222\017\021\016\020\222\003Ql\031'+B\231H~\266\221\364\034X\263"
+	.string	"m\222\323\264Mv\346\376ZU\251\032xz\3625\n"
+	.ascii	"2\241\245\0378c\"\361\003\256\320\n\242Zp.,[\260\\\\+&a\222\001"
+	.text
+	.section	.gnu.lto_simQuadSetMotors.61.a05d36207b97f99f,"e",@progbits
+	.string	"(\265/\375`{\001\265\017"
+	.string	"\366\336kE"
+	.string	"\261&\035;\035lX\022\244\271gG\253\r\252\344V\233'D\330!\257}F0K\260m\332\305\372-\370\301\234y\322\255\214\220]\013^\331\376\022\332\334\313+#T\0039\f\320\216\016\025\004\026\344\223\275\245L)W"
+	.string	"T"
+	.string	"W"
+	.string	"\336\007d\217\332\005d\217V\3316\356\211\330\303:\274\244\320\261\273\233\2060<\364n\230\252G\250\251\362w.\222\023c\305Zy\204"
+	.ascii	"b73 \254\f0\201LO\354\257'\f\253%\241M\314\365\257\027\300\371"
+	.ascii	"V\254\230\347\207\203\335u\256X\034\356\354\266;\333\r\354{\001"
+	.ascii	"72>\326\226\035\272\316\257\335uGM"
+	.string	"\303\2475\323\231\351\213@`\320X\220cW\303\307c\201\342\213\021w\335\276\347\277P\234Gu\227\177\264\225\r\032\f\366\341\306\356\216<\232\201\366\030\002/\262\375\264o\342'T\327Qy\200\335V\217\317\256w\300\b\264G\007\036\3246\352,8\0025vA(\360U|EJ\310k\036}J\345W\217~*{\324\026+\034<\371\331\207Y\250\240\325\370*\331afX\362s\252\246\252w)\001\357\031\3315\365.$Z\362s\324\353_\21739\260\227\036,\371\251\312\364\304lTilo%\265\025\013\245\237\220H(%\035\207\342L!\233\220\234\214R)\022L\245\323\006!\302\203\222\rE\232\320\215P\033\205\322\310\264\231t\247\215D\304\034\n\251\333P\034\327m\"o\257\255\235k.~\200X\264%*\215?dhH5(G\036\025\306\366O\026\365:\256 \f\271\343pw\027\332\300\243\206\364\002\316\347\022\033"
+	.ascii	"2\003\376\031c\207\3061\375e\007c\t\254d\314Ri\321\020iW\253"
+	.ascii	"Y\2732s\037\314\225\\8\206`\307-Vt\266WY\240*s\320\316*a\315"
+	.ascii	"\352t\320.\016\213({\241\252\361~\022\351\\\363\t"
+	.text
+	.section	.gnu.lto_rotationMatrix.62.a05d36207b97f99f,"e",@progbits
+	.string	"(\265/\375`\324\005\345\032"
+	.string	"\266\257\243I\260\230M:\360U"
+	.string	"V;v\306\301\227\253|\220\021\2322v\346\216\340x\217\342\261\207R \205\273(\321\234R\234c\351\303\331/\330\377\r\006\216\027\210\334\t\024\n\016\177\314\332\241\245\004<t\310\001\346\326\266\215\220-eJ\001\214"
+	.string	"{"
+	.string	"\221"
+	.ascii	"\363\b\b\244\306\235~\250_\352\237\272\264\377\247G}\307y\030"
+	.ascii	"6%\303\201TS\003\250\234\317Ql\316\253\036?\0308\345>G\0256W"
+	.ascii	"'hH\231s\0068\350\005.U?\207\016\243'\n|\237\375:h\003W\373M"
+	.ascii	"\307\241{\217\304cs*]\375\230\323\367\343\002\256\203\366\275"
+	.ascii	"&<\350\372Lx\320:\033\312}1f\013\306\214\023OV\346\234\342\302"
+	.ascii	"\270\356\252\363\317\343\257\244\025G\327\026\2039\2475i\005"
+	.ascii	"\213{o\273f\373\201\035^\b$\302\203\263\255p\243\n\n\027H\232"
+	.ascii	"e\373\216t_\330\227s\225\354\353\370\001\334\351\266\035\352"
+	.ascii	"\256]\352\246}\352\236\275\367\373Hu\217T\363H\365\216T\353H"
+	.ascii	"u\216T\343H\265L\252o\244\332F\252k\244\232F\252g\244ZF\252c"
+	.ascii	"R\035#\3250R\375\"\325.R\335\"\3250\251f\221\352\227T\273\244"
+	.ascii	"\272%\325\241T\203R-\245z\245Z\245\372\"\f\013$\t\242\314\231"
+	.ascii	"\"\353J/r#z[\205-\353\002[\226m\331\315\026F[\226\005\342\ty"
+	.ascii	"\375\234\210k_\253T\255\r\327\265k5.\315\266\265\213E\333p\201"
+	.ascii	"x>F&pm\013\370\020W\2654\231s\"\360\205\350l|\330\030F\341\301"
+	.ascii	"\377\222\250\310Up\225j"
+	.string	"\\\252\272\245\2119\221j\273r\36572\351~w\027k\334\331\326\266\272\322\252\266\265\375\342xQ#S\211 \272^\356\200\314\266\341S\225\256\227\373\211\251\255\304\362\241\353\345l.\332\356\222S\351z\271\233&3\374 \036\342\271\213\370\204\013\ru(\362\311p\013ry\270\205\006`\b\372\340\301\302\006\rEb\204\n\020(\210\270\241\f\267 \234\310AC\320\006Q\350V$\016\240\231\250\303\320M\304\021\021\335D\230o^\316U\262\204\026G\220\266\204{\260~<=;\313\363\335\331\021MQ\343Ng\312/gur\026\307\313\032w8P~\004n$[\034\331\342xU\306\245\033'Il\366\246fi\326f\2665\265\245Y ^\224\031&23\261\225\211Y\335\330\216\266\264\215Y\034\217\t\214\222$\262\033\205/\013\363\2628\236\221q\347\022i\250aX\003\02135CAIIA\322\032\360\002\021\031\252:\022"
+	.ascii	"Te\t\032\250LU\234XXn\263\033\003i\007\351\037\\F\226\2461\006"
+	.ascii	"\234\353\254'\021\242\364g\206&\333\031\263\262\013\2444\216"
+	.ascii	"~\224\026\253Ym3\2646\031\237\233+3\254Z\327\252\017\277\301"
+	.ascii	"\271\311U\237\017\243P\\\362\2453\270<\006\235\356\034\337p\311"
+	.ascii	"G\221P\221\232g\220t\332_Y\nU\223y\337\005\"/+d\203y\374\222"
+	.ascii	"b]\360\243\230\261@\020\t\2178l\216\f,1\216\036\360]\024#\307"
+	.ascii	"\306\003y\034d\025p\210\340\312\363[\357\260\353\264\307ro\233"
+	.ascii	"\356*\201\210\023\r\373\270\311c%\221\276]pC\356\324\001\365"
+	.ascii	"\001\376*\bS\013\b\374\003"
+	.text
+	.section	.gnu.lto_captureGate.63.a05d36207b97f99f,"e",@progbits
+	.string	"(\265/\375`\215\017\335L"
+	.ascii	"*\210t\035L0\f\323\351\365I`\335vv\351\306\020\252\313\362\210"
+	.ascii	"m\021\253@\264s\232&\207\351\0251\002\354\b"
+	.string	"\353\007\210\034@\373\274\034\367i9;+\362\253\212\002\316\366\275\032\316S'pq_\324\310\036\036\016\260\345\261\354Dj[\223{\247\224R\270\001\234\001\322\001\316\026\256s\317u\346\271\316;\327\371x\235u\2563kt6^\347\342u\276\327y5:\253E\347\277\316~\235\233\213\304\b\320)l^~0\3326IDl\005\327?,\r\330\035\330-\246{L\367_\267]7^\267^\033\231\233\217t\031f\231\204\206\314\335\001\267\007\035\246?h2|\034\023B\224\230$jkv\241\025cK\003\327#0\t\007R59\214\275\002\362\324\271\246\320\311\270\307\r\206\217~=]\366\037\003\"\303\242-\331\022\235\337\fc\257H\265\177\356\227w\222'\327E\325\013\323\\\232\217\371\310Hz\217\213\324\340\240sH\230\217\275\252}\327y-\345\243^\222n\233c\033\370\244_\n\233\360x\252\266f\321\366\n\322\234a\013#"
+	.ascii	"\026\313\266S\202\374\212\266M\002\240\213\316\031\266mTE\257"
+	.ascii	"\274d\344vn\272\256k\r\226\035e\240}\332Vm\317\257m\243+X)\332"
+	.ascii	"\032n\257\306\376\271\2752\367\0343\333+\003`\354\225\227\314"
+	.ascii	"'t\264\255-\262uq\346\031\266m\233|6\326i5\332l\364e\363\354"
+	.ascii	"\034uXc\361\256\352\373\222[\207\354\253y\212LheTzG\b\255lJ\037"
+	.ascii	"\315\214MQ\221qc\021\270\216\032\244v&\247\343\306\244\250\310"
+	.ascii	"1\202\316\226\266\220\2311*\316\252k\0320\32263\026EU\202\362"
+	.ascii	"\266\245\301\264\213\2211\335(A\231Y\027\241\364m\372\332C\346"
+	.ascii	"T\221m\333\036\311\226\270\252.\321\311\2715\231v&da\352\333"
+	.ascii	"I\003;n,\212\177\203\351\024t~sr\320\312\314\332\213Lm\333\262"
+	.ascii	"?\311\312\232{\232\231U`f0f\013jM\340Z\346\027\211\211n\302\332"
+	.ascii	"\026lh\375\373\335\214cz\"\253\277\276Z\246Y(\243\331\314x\001"
+	.ascii	"EL\241P\375b\033\024\344h!4\234\243\376\032?\335\377\256;5a~"
+	.ascii	"\310\314NM\370D\004-\f;j\020\230\227U\332\004\033\353\336\223"
+	.ascii	"\273\275\2715]\002\024\367\333\016\357'\217\333\353\177\223i"
+	.ascii	"w\203\026B\351\352~\212\301\031\276\3775\366\321ix\n\224\246"
+	.ascii	"m\333#n\022z0\212\245\246\274\237S\267\327\026\377w\203r\352"
+	.ascii	"z\274\337\237\371*\353\366\363\350\221K\376\353\214\231\245\023"
+	.ascii	"eP\232\016\376lQ\013\362\024\250\255m[$\356\020\226N\224Emo\f"
+	.ascii	"\334^\373[\332.\007\225\203\322\375\201y\"s\224\351\277\266"
+	.string	"W\346\f\343Wc\276\316[\327y\210\216\263\020\326Y\311:k\261\316Y\2543\026\353|\305:[\261\316UT\327y\352:\007\321q\226b\235\201\260\316Q\254\363\017\326\331\007\353\334\203u\346\301:#p\235w\\g\035:\3169Xg\034\2543\024\353|\203u\266\301:\327`\235\237Xg\032\254\263\323u\226q\235\233\256s\214\353\f\203i\251\001\233]t`\263R\213iN\3521\315H-Z\257\371\250\243\335,\372\2579i\324v\315+\212T\\\347\024\327\231\350:\243\270\316'\256\263\211\353\\\342:\223\270\316C\327yD\3435\013]g\344u\016\272\316\"\256s\210\353\ft\235A\\\347\017\327\331\303u\356p\2359\030\2357\\g\r\3279\303u\376qg\f\356\354\343\316\027n\\t\214F\317o\364T/\306\306\242g\365\213^\350\305\234M\345\263A\342\027\373k\\\\Sdj\222~\340\354s\025\235\\Q"
+	.ascii	"[\030g\237\273\263\215\212*\232\234}\316>o\361E/\226\304 \007"
+	.ascii	"\316\006m\316\254\t\363\303V\333\266m\215\277\306\254\252F\354"
+	.ascii	"[\"\364v+\271\274\032\375\212\027c"
+	.string	"U-2@J\350\354\273J\317\352Z\364*^,\371L\337`\372\304\031B\346\240\236\027?L\271\342h\236l<|\207\377\360\352\034\207\342Rx\312\242-\2122\331\346f\336\fx{\365\360,\3348|\207\r\317\341\325<,\356d\206\322\231\240?\340e\033\276\230\206\270\245.i,\313\307\021c\006\306\356\2003\341)\367\033/+`?\357'\373\335^\213\316\344\240tf\204*\324\235\335_\323\360?\377#\002\2333d\302\374\220\311\034\007\320\334\330\330\3062\274\206\357\276;4zq\314\013\374\311S\2437\220\341\033\317m\351\177~\005l\032\202yb\367\0308\210u\253\222\213\341\273\356\326\370\374\205\307\360\357\305i\306\224k;,\234\276\021\241\312a\317\373\274\352\305\251\364E\177\341\32748\314A\351\034\223\247\315\305\t\247\0034\261\264\266e\276.\264,\275\206\276\300\243\267\360.\336\363\232pL\244O\262\360!\232"
+	.ascii	"\n\016y\3173/3X\322\335~*=2\354\277\230\347w\276\347\237\260"
+	.ascii	"\tM\372\244\347\371u\016\322#\375\316\267\224\272\276f\334\361"
+	.ascii	"u>i\205\177y\233xd_\307\370\354R\203F\234\361\342\254\212\n\207"
+	.ascii	"\306/\266q\263\245\370\367\221\336\3374\341\230\236h\310\323"
+	.ascii	"\2434<@\307Q\n\360\246\341\020\020\243\311\373\331t{-\376\221"
+	.ascii	"\232\277i\247\225`'\r\\\022\254eDdj\253\210\324\026W\322K+K\271"
+	.ascii	"\205\265\200\225'\261r/#J+5\213\210\262k\352\212\252\250l$SI"
+	.ascii	"\336\313\310\025\225jE\344\b\027\326z\243\253\256\212\030Afu"
+	.ascii	"M\031\271\312\310j\352\210\002R\t(\215$\017\300!\003*\351u\225"
+	.ascii	"\3255\345\225$\242\234J Y\325e$i4\202\271\212\\u%\275\270\270"
+	.ascii	"\272\222\307(X\277\0323\201=\223\347\327\2504;\027\347S\002\301"
+	.ascii	"\022\n\224\333\353\352\244\213\234\233\024\322(\204O6`\021x\036"
+	.ascii	"O\215x)\276\210'\335!\262\313\"\343I<\021\212\2271\365(\356\202"
+	.ascii	"\374\224\324\007\371\356\002\344\245\242\036HT\335\217\367\361"
+	.ascii	"Q>\376G\217\347\361>x|\017\036Z\217\300w\227\023sM\037\364'\240"
+	.ascii	"\314\250\211o\372\265L3\216\251n\275\t\"<=\346\240\036\034\363"
+	.ascii	"\202\036\362[B~\3107\237\362\205\270\005\255\365\312\254\307"
+	.ascii	"z\255,\215\365YWo\365Xpm\365WU\017\365V\216\245\241\276\352\233"
+	.ascii	"\257\211\300\320\334\r\352\371\370\221\200\346\370k\274\343K"
+	.ascii	"<\325\035\ba~H\305\345\264\224\340\242\326\006\245\253\373\323"
+	.ascii	"\361;r\274\216\2379\315B\034\237\343\331\235+\200A=\216\357z"
+	.ascii	"\213\003\365\025\334x\033\017\265\332\370\033(4\021k\374\323"
+	.ascii	"\333\360y\372\032\337co\203\315\025h\274\323?\275{q>\341qz\032"
+	.ascii	"\337M\304+N\301\362\314\3122\315\373\271L\273\275:}\177i\337"
+	.ascii	"{\362\006\2453#1A\226\030?\364$\334\262\f\215x\241\217\201|\240"
+	.ascii	"\037\201|\013\177\017\004\275\004\375d\003\343E|\320w\023\252"
+	.ascii	"&\342{\334\314\204>\304\303\370\233\327\214\003z\020\037\342"
+	.ascii	"\237\260\271\346hV\200\336\204\232\272\"g^\272-'\360~\202\350"
+	.ascii	"&\177d\202\314\377\342!+^\002\201\036\250a(\004\021T\206FFDd"
+	.ascii	"$I\222\016\201\005\204(\307\240;\017\021P\251S\n\321\220(\251"
+	.ascii	"\037\215\001\205>^u+\241\226\322\275\332\344d\225\331M\266Q4"
+	.ascii	"~\204\231\236\030&\363\250\336rJ\220\244\236\231@uU\244B\207"
+	.ascii	"\222\\\b\332\004fT\251\373}\031\\g\310T\210\022 \277\304 \001"
+	.ascii	"\270\3041"
+	.string	"(FiZ\263\303\006\242\241\217\225%\247\220\302\231P\013t\322v\351\230P\032\200\206\225\245?m\226\254\246\310\362\361\341G\230$T\353P\212J\\\202\275|\364m3!f\216}{k\260)0\355[\020\355e\243\002>\026P\303\214\232\367;!GC\310\265\2702\322\027\275\021\321\212Z[\350\213|O\370\203\261"
+	.ascii	"\317\n%/Q\311\362\351\307\330\351\005\237\306y\274\207\253\317"
+	.ascii	".@R\256\242\210\335/)\3453]\346\272;\252\330\267\267p\213LL\371"
+	.ascii	"\240M\300]\263c4\317\f\007H\332\032\306x\366\235\352\206\341"
+	.ascii	"\276n|*\324\230\251UUzV\332Y]o\206\336\255\353*\311y\210\324"
+	.ascii	"\274\266>\300\203\346Iw(O\260\341!\230\035po8\037\272\031Uo0"
+	.ascii	"\353\373\251I\360\214\013g\3569\3745AVv\331\224\375M\261\017"
+	.ascii	"\310`(w\312Ios+\nJ\355\301\tB\224\261\332w\362Z\330uC\211\t\013"
+	.ascii	"\217%\330\207mEO\341\206\3470\326\221|\370\235q@\202\317\333"
+	.ascii	"\016\221\350\364\244Nw\300\346\220N\232\337\313\250)\253%\\M"
+	.ascii	"\017\200\231\001\016v\021\r2\021B_\200M\222\344\243t\353\026"
+	.ascii	"\216\304X\277]\360\216\330\255\367Ex\353S\3739\372\020\036|\270"
+	.ascii	"\224\205%?\224r\271y\013\327\255d-\220\206\353\244\206A\016^"
+	.ascii	"\377\227\243Tp\211\005\356\0028\370\200L\314P\345\317J\231\333"
+	.ascii	"\306\261\021G\034\030\255\2749\207V\234\265#\020RpW\213\315\256"
+	.ascii	"d\276\321l\244c\0270\323\317\215\2434B\327{6a\020&J\037\233@"
+	.ascii	"\t\362\343\365\201\203\272{\032\256I\277\351\326\245K\033\300"
+	.ascii	"\211\233\325\361\2559\"\3012\034\370U?\334\345+\332\035\207J"
+	.ascii	"_^\222\006"
+	.text
+	.section	.gnu.lto_updateGateDetection.64.a05d36207b97f99f,"e",@progbits
+	.string	"(\265/\375`\271\004\275\033"
+	.string	"fp\250G\240\232M:\220\227rw\026\346\314\347\344\177\243\351\212\346\313\325@\201S\246]\2656\275j\203\333N\304&\265\305\257\007\316\303\2114\t8\264\212\303\2768\241\265\320\201\034\370\372\024\"\377\266\300\035\031\325\321,!\204H\231R\223"
+	.string	"\201"
+	.string	"\234"
+	.string	"\263\306p\315\324\032\257\202\314l_}#\257\372\021\246\377\226\3163'\317Jp\316\237\003W\370="
+	.string	"\3711v"
+	.string	"\344G\373El\331GC\210}4\223\315\365\337\324,{:`(\001\233s\322\326\307\231.\213\225\344(\2562\371e\006YN\327t\031\202\0366\242\036\023\027P\205Q\031\260\344\305\217\373\240vZ~\201\212\202\241\244\017*\212\206\356IG\034\027g:'\335\034\335\013\361\300\234\363H\2562t8\3252\303\234\323\232\323\331\270mn{\312\266\005[\264\n\343.\206^\225U\334\211\205\2619\247\004\237\311\233\024\371@>\332\350\350\210\374\250[`L\325M\207\3279g\323\332\005\371E\001\334r\3220\373\300'q\341\0031\222\222>\367\321W\"?~{xhv\030\331\335th\377\232t\245\354\213sy\366\177\277\317\252yV\275\263j\235U\347\254\032G\3257\242z&\252mV-[ul\325\345\252\311U\217\253\026W\275\253VU\277\300s\360"
+	.string	"\353\372\0213\003hf\273\365{ mv\026\346b<|"
+	.ascii	"\002\"?\332ly#\213j\247\013F\204\203-\254\244\344\274d\253\365"
+	.ascii	"/^\364\316\"\271\214\220m\311\303\242\2129\270\226,WH\304\324"
+	.ascii	"\354\312\265\335\340U,\02405\347\244\340g\235J\t\023KK\344\307"
+	.ascii	"\347\274nSN\224[\362\244P}\3169\305\225\332\013\001v\031W\\r"
+	.ascii	"\377\264\003\367\340\205\026\326\034t\220\3748\356\204\336\356"
+	.ascii	"&<.\206\216+\260\255#\277ic\030\016\271\234\346\274)\330\025"
+	.ascii	"\267\247\314\223\017\027\364(O\016Eh\210\210\210| \036$\304\002"
+	.ascii	"\351\300\220\255\026s\320\203\0245\245\243\023EDH4\016!~\200"
+	.ascii	"hIBC\266Z\022m\005Q\255\210\026dC\242=H`#\026B6Z\222\221\221"
+	.ascii	"\2156\373\315/\317 \276\264n\213\223\021P\237\2655\374\350s\276"
+	.ascii	"\271\352\322r\332&\363l\230~\345\274v\026gyV\334\242\263\026"
+	.ascii	"~\332\272\263\367Y\r\237\260\340\"\314\310a\305\204\266U\201"
+	.ascii	"\316\256\017\310\305\033\236\346Kg/h\231\2638{\"\300.g:8\230"
+	.ascii	"\263\fz\273.38k\240G\336p\335l\217\324\220q\245\224\234\314\210"
+	.ascii	"\225\005\026f\250aD\006\225SB\"#\345$I\007\240\002\221\251*\036"
+	.ascii	"\020Pe\245I\323\030C\334\226M\250\372\252/t\334\277F\013w\250"
+	.ascii	"2WI4\327\"-\215\230\370\373e\324\b\335\332\307b\302E\313\221"
+	.ascii	"\310@\006\031\271!\351\027-}\264\267\350G\022B\262\035zCp!E#"
+	.ascii	"\271\246E\211\034,\030+\0246e\220j\017h|\254\251\216\036M`\022"
+	.ascii	"8\267\227Fp\315\006Cx\367$R\022Gs\214\341J\304\005r\303\002\030"
+	.ascii	"\271\303[\314Z\270\325z\367q\341\020\210\201\013\246\"B1\233"
+	.ascii	"\251B$U,mfv\021\333\273\210E\311\265\037\024M\004\207#\205\254"
+	.ascii	"l\320G\036\224}@\344Nu\n\277,5$0;\217\316V\005g\003\002<z!\272"
+	.ascii	"\372\360\255\233?"
+	.text
+	.section	.gnu.lto_simQuadStep.65.a05d36207b97f99f,"e",@progbits
+	.string	"(\265/\375`X+]\252"
+	.ascii	"\032\016\t:N\020\020i\345\244\003.,\367a\365\333\366\376\203"
+	.ascii	":\006\247\237c<:\200\201W3\310\036gs\0039\232r\224\r\311+\f\327"
+	.ascii	"\n\331=-\344xH\311\343fU5\374\377\377_\201\304\325\005\300\277"
+	.ascii	"{\003\342\310X\330d\343c\370Z\263\226$)e~\003L\003\247\003\021"
+	.ascii	"\324^\bj\357\003\265\327\201\332+\200\332\033\200\332\013\200"
+	.ascii	"\332\313\243\366\356\020\352m@\250\227\201\332\253\203\313x\027"
+	.ascii	"\250\275\n\324\336\004jo\216\332\353T{q\324\336\246\332\213@"
+	.ascii	"\355e\252\275\007\324^\003jo\001\f\307{\243\366\332\250\275K"
+	.ascii	"\265\227\200\332[\243\366\322\250\2753j\257R\355\225Q{c\324^"
+	.ascii	"\030\2657\251\366\276\250\275.j/R\355=\252\275-j/\213\332\273"
+	.ascii	"\242\366\252\250\275F\2657E\355EQ{O\324\336\242\332KT{M\324\336"
+	.ascii	"\022\265w\250\366\222\250\275B\265\267\326^a\355\r\326^`\355"
+	.ascii	"=k\357\205z\273\366r\337\240c\016\251\345\353\354y\310P)\177"
+	.ascii	"G\240s@\346\231F\231\0071\037\301\334\307\274\307\f\210\371\017"
+	.ascii	"\263\037\346>\314E0\33717\231}`.c~\303\f\207Y\016\363\0323\223"
+	.ascii	"y\0163\035\346:\314n\314p\314s\214\264\313MU\006\312\037\037"
+	.ascii	"?9A;\244\306\267Cp\002\241q\031\261\254\267C\177\320\242p1\357"
+	.ascii	"\004Z5\006\n\030\336\016U\252\254\352\346l\017O\317\362\036\346"
+	.ascii	"\263CwL\336\300\232\024\201v&\304\f\225\357,\333\355\020\036"
+	.ascii	"\316C\344\346\262)U\221\241S\034H\213\2412P\351d\243\340\020"
+	.ascii	"L\304\356\320*\341;\013\374S\307\003\212\242CJv\207\030H\202"
+	.ascii	"\177`3>c4V\343%\007\301l\334\306v\370\215\343\230n\207\204`9"
+	.ascii	"\"\317-A\277\320\300P4K\2522\360$\343\025o\330(\b\267\313/50"
+	.ascii	"#n"
+	.string	"u\210\324I{\303fo\005:W}\360\202\314\021\203\002\223\211\022\025\n\024uK[3\241\2561\021\342\352\b<\022\342p\032\221\345\f}`\035\201T\0062\331\021\033\005\341\234@\261\306`\201qP\031\270\f\004\273!\362\033\0310@[\203\227Ae`\243Jl\024,\333%\243i\026\0137Xgx\025\370\300\344D\261\220\241e\200\310\255\261ab\340>P\233\214\206;\006\270w\231\r\267!\362\230\r\214\002E\277\214\255\241(Y\323&P\031\270d\274\"\310\300\312FA\006\356\022w\3710Y\022\345\2637N\314\366P\024uz\230\3773\316\363|\361\037\211\305y\236F&H\374\027\356\311'\031\357I\202\3104f(\311\210\001#\351\205\213\032HG-X\254Pa\224\002\305\211\"\"\023%\206H\bUa\020x\276\211\313\302\0364\354\334\034\247P1\r8g\2167=\343\214\225\232\212\233\316XF\f\356\3222"
+	.string	"\3038\225\306N%\2726\235\304\346\257\207~!\354\001Fk\r\273\340\342\032\256\201v\346\340\241\221\304\370\310\217\231\344\302\272\264\304\270\305\031Ae\232\205\031^!\210\231\324\302\272\264\314\260\n\276\223E\206OL\033\215\341\024\302\036|\314\004'\254Kk\f\243\350\322\372\342\023\347\222X\037\035\027@X\211aeV\262\213N\027H8*|'\353\353\\\242\363\262\207\351\2704\021\362\314\241\245Ml\341\022\201\230\211+\254Kk\013\017e9s\314Pfm5\211\031`\264\270XH\330#\217\231\240\204uiqq=O\334\311\302r\346\300K[H\"\354\n\007\2570\360,\201\007\r\027\321\024\253s\201\2558x\330\216\033k\212\261\3170*|\266\343\003\322\332\216S\250p\013{\240(\272}\234\242\305K"
+	.ascii	"\357^\202\335Mw\013\260\nf\251\022\306\223\036\343g\334\231."
+	.ascii	"\373\001\306\233\354\306\212\007 \013K\272\214\036k^\266 \003"
+	.ascii	"_\374\324\263\343\242\t\351,\356\342\350H\007\232\265\370\321"
+	.ascii	"O\263Ti\\\323\003\232\026\217\361\325\304\342\247\336\026s\305"
+	.ascii	"\213\232|\314S\361\023_\361\216"
+	.string	"K\221F\243\25380-U\236=\305\215~\246\245J\024O\221W\334\201IE\321*\036\333:t\032\031Nb\032\242\232 QM\220\201(\036\303\216YD\240\236\370\377\374\341c\366\223s\231\367\325=H\373K\221E'\361~\362\326K\225D\027z\3219U\032M\234\350\\\342C7\241\024k\2603%\316l_c\305\245\320\207\216\304\226\202\255i2cH\\\250\252\217\330\230\320\277\222a\370\230W\377\013\375f\302\003_/\214K\335\214\301\013\217\244\227\"\215\375\327\246\275\276\004\317@|\215\025\313~\036\370\240^\252\374\371\263.\005\353\332%\213$\212\242<v\211\006\350\034~\024%\273\374\3002>b\314\006\336i\n='\203\324\030x\003\017\002R\3533\360\355\364\217\261\377l\350j-\022T\024\315\201\3076Wg\231@\211\002\037>\316|\270\373\200\331\203l\303\364\241\377\376\2558x\300~\257%\247)\262\301c"
+	.ascii	"9|k\350\356y>{\263\245J\343^\320W\254\360\205\252\366\360\215"
+	.ascii	"5\016\255@\335[\326\330\335\004\370m\227\313\343e{x\330s\321"
+	.ascii	"|\207\3516\210\321<\362\235\206\322AE\321\"\037w?h\254\037IM"
+	.ascii	"\006n_\3651\204\021J(!xB\n\315\307\020\266\310\370\360\254N\265"
+	.ascii	"m\365]\362v\025\212\026kp\331\333,u3\366\3372\021\253B[\355\262"
+	.ascii	"\242(\332\300\266\261\253\236\226\3110p\205@5\037\241\202\fl"
+	.ascii	"\2533\021\334<hi\"\333\214\025\373o\227\314\330\367\302\203f"
+	.ascii	"km\377e\267\243\364\025\027\301\333O\370\216\267\323\332\333"
+	.ascii	"V]\325T\374\207\227\377\006\t\352\333\003\344\247\017\2231\363"
+	.ascii	"\035\366\201\227\351x\214\231\345\340\030\016/\257\361\0323y"
+	.ascii	"\031\215\347\3602\034\256\303\313ge\215\362\262\032\036\304\313"
+	.ascii	";\360\021\274\234\206\373xY\007\336\343e4\\\306\313J\006\304"
+	.ascii	"\313a\354\207\227\301\270\017/\237\341&/\233\3412d\306\224\350"
+	.ascii	"e1_\3110`\274\206z\371\013\211^\366\322\225C\027.\310-Z\262p"
+	.ascii	"ma\271b\245\n\025\034\264\246dI\271!\n\024\254\343\325\023'\251"
+	.ascii	"U\355\345\252\332\313\306\332\313\305\332\313T\265\227\321\332"
+	.ascii	"K\254\275S\265\327\206\332[C\355\245\241\3666\251\275Lj\357\f"
+	.ascii	"\265W\206\332\033C\355\035\326^\251\332\273\244\366F\325^%\265"
+	.ascii	"7I\355ER{\217\324^#\265\027\206\332\373B\355-@\355-R{]\250\275"
+	.ascii	"-\324^\"\265\027\252\366\016\251\275Bj/\013\265\367\251\366\256"
+	.ascii	"P{U\250\275Ajo\n\265\027\205\332{B\3555\241\366\226P{I\250\275"
+	.ascii	"#\324^\021jo\b\265\027H\355\375Q{A\250\275\037\324^\017jo\007"
+	.ascii	"\265\227\203\332\273A\355\325\240\366fP{1\250\275\027\324^\013"
+	.ascii	"j\257\217\332[A\355\245\240\366\022\240\366NP{\007P{%\250\275"
+	.ascii	"=jo\207\343\241\344\"\274\365\301\342J\3623 or\307<$Or\276K\225"
+	.ascii	"G\376\302\221\\h\3440\374\310\217\374R\245\261m\227\314Fg\310"
+	.ascii	"jlF\316l\314\007\261\006\303\217\342\260\270\n\360\026\376\302"
+	.ascii	"O\277\024\254\310]x\001\016l\372\332.\037P\033\356\220S\344\017"
+	.ascii	"\3301\321\036\347\215\013\007\306aq\0219\324[x\373\375l\227K"
+	.ascii	"\1773\224\221t\023\302\022\371\222\035s\310\241\362^v3&\225\f"
+	.ascii	"\031\023\245\004\0318\344\"\274\345\301\342B\241\242\356\230"
+	.ascii	"W$\343\244\346\357\216yKI\241::{{;\372b<\366"
+	.ascii	"\3656l\354\354\350#\336\267 \023\363\235\363@\304A\315\360;,"
+	.ascii	"\261\n\361\n\021\235\266\271\364THN\346\254\234\020\362\250\037"
+	.ascii	"\204P\356\262E\330p\005\230\220\003\353\330\312\220\031\003\254"
+	.ascii	"\233\263\267\347@\032.w\212\356\305\302Y\370A\256\252\373\222"
+	.ascii	"a\300\260\260\3445\207\250\004\017\372\365\f11\207\205\231\b"
+	.ascii	";\017z\023;mO\377\342\245k\205\253\360\247 _\341g\227\255s\031"
+	.ascii	"\026%\221*\034(g\213\031\344Z\262\f\213\316\225\302Ox\220\267"
+	.ascii	"\036\nO\341'\n\217\361\305,j\371\225]\256HZ\031\026\275\312\t"
+	.ascii	"\347@\274\344"
+	.string	"\225\306\307,a\302K$\265\374)\366p\226\234\253%\334\204s]\2124\326\022jX\305\031\022j\252_Oeb\006\003#\001\366\246:\347\361\331W'O\212$\341j\273$J\232\035\363F\270\b'\341\300\273\324-\313\245\3340\302\033\260\033\373{\b\027\001\f\310o<\204\277.U\3768\220\274\342\241\3542)\311tC\026M\340\217\013\255\334\210\201\360\017\316\177\310\037w\271\243\371\253!\003\315?\001\341;\354<8\007\377\340\302\270\265wp\017\216\264\345\251U\007g3\2731.7\276\310\301Y\217\rH\003\004\337\230\220So\360]\242\027\242W\220\217\274v\245\252S\255\006\307\340\033\374l)2\203gp\r\016\343o\227\214g\320\220\211\360\313\340\214\347\202\3738\006\027\306Yp\013~\201\240\276!\233\361Ypv\363U\301+\270\217\003\353R\2451\320.\021\b\323\200\2066\222z\025|\310\312\214\202\033\221\347\207"
+	.string	"\247`\202\023\340G\003\370\004\022\034\202\017\240\307%\210\340=\036tz\004\020\360=p>w{\034\370\003\002\270\003\006<"
+	.string	"\027"
+	.string	""
+	.string	"\256\343\001\340q"
+	.ascii	"\3548\217\007\017\370\216&\035\027\316\371\023S\240\355\232C"
+	.ascii	"\023y\030\316\023\270\0029\236\300\217\234\216\3439.dK\335\214"
+	.ascii	"N\207\300\216\331\364\002\216\343g\032\3079\002oz\360\016\355"
+	.ascii	"LG\340\301\264Ty\300\r8\023\230\361\200\333\260\3436\003\216"
+	.ascii	"\343\253\200\013\347\f\342k\272]\262\233\271!\2275\345\342\334"
+	.ascii	"\201\257\246\216\333%\003M\270\241S\362\r\3556\332\316.\tH\326"
+	.ascii	"\031\302h\266\301Y\3722H\214Y\203]\365\353\0012a-\237!\023\236"
+	.ascii	"yW\275"
+	.string	"\211\232\233\024i\343K\247q\033`\004\274\306\227~\336\245J\343\234]\352h~u\020C\034I&\001\327A\034\323k\273\254j5\036\343k\214\306\377\307Ol\306\271m\227&\222z\307\274b\227F\333\245\2142\rg\330\"y6\343\214\3077\2108\202\217Yl4[q\360\202\347\311e~\343X\273\f\274\327\n\335*_\0263\315\204\305|\030\203+9'jL\307>\256\324\234\250\365.\271\314\261\314\234\307~\320S\325}|\236\367b3\357(g;>\373\322\332R\244\322e\374\305\225b\\\306\205\001-<E\r9\207\034y2b\004\211\020\241\024\027a\020Xj\3110\312\005\251 \324PI\024\022\251`\t$\030\211z\002^\300IX\tG\261\020!O\037\002\005\225d\tP\311\2206\022\205\344\310\t5d(UD\n\206\247\272$\n\311\222#PK\204R/$\371\n\3011\344i\250D\005#E\2268i"
+	.ascii	"\344\202\037NRP-D=I9\035)\362d\304IH\324\022'\0344\026I\022\250"
+	.ascii	"(')$H\242\234\206\310\212\0346W\274qex#\207\316\320\355D\321"
+	.ascii	"\256\bx\216\031\317\0072lg\235]\262\235tv\331\266k\273Ff\t\220"
+	.ascii	"\033>,4\224\270\317\257G\006\023\263\03253\324\234\373\274I3"
+	.ascii	"O\212\034\363 v\331b\312\316\311d;\346e\235\247\234Sm8\365F\304"
+	.ascii	"\201\210\303\2307\0253Y\001\202OIL\334\031gJ\216\350<;\341L\311"
+	.ascii	"-\223\331)\272\251!\232\217SC\004\031\310b\016\304c\306\207e"
+	.ascii	"\203\244\251<SvnUd\340`3a\335\337\336\237b\214\257\"\316\037"
+	.ascii	"T$\317_\277^\230\344\033\024%\n\363\323\353`\316cr}R7\343\002"
+	.ascii	"[q\2320\356\345u\026\316\261]\022\231\360\372\331\006\2111\277"
+	.ascii	"\334\235l\246\372\254\251\241\207)?D4\004\275\234\277\274\375"
+	.ascii	"\234\fj\356\322\233\n\344\305\314\210.4r8w\375i\023\364.9\211"
+	.ascii	"\345\330\224\202\346\013\f\335\r\356N\t\232\362\313\341J\\\272"
+	.ascii	"\034\330f\213V\333\224*k\360\320\335\b\376\376\356\320\235\271"
+	.ascii	"\234\007\311\311\245\312\274\342\211f\2277\224\303\2450\244\001"
+	.ascii	"z~b\314$\027\354\347\327S\203\211y\207\035^\354p\366\363&B\004"
+	.ascii	"J\221\306-?3\365w\232\371q\352\035\363\212Z'\231]:5\3171?p4O"
+	.ascii	"1[\316\177\314\244\027\210\317\305\275\226k\374\313\n\335\216"
+	.ascii	"\030\320\257\247\005\023s\2324> \2459\003z\2238-I\2523\214\327"
+	.ascii	"\326\371\305\213\226\017U\001\224%\207]\3020\236]\256\207\fs"
+	.ascii	"n\031\332\320\222\345@=;\\\\\273D\240iunm1\327]`\371\326_`y\222"
+	.ascii	"_\nv\345\\We\227\f\327l\263r\206\263c\026\251p\225\037\231i\235"
+	.ascii	"\251\034\211\255\t\207\263\232\235\026\335\220\315\232Z\234u"
+	.ascii	"\226r\236\362`\326!\370bJ\241\033\352H\262\224\233H\243'\306"
+	.ascii	",\336\360(\273\274\341\344\2042\254D@\266c^\221\312\231<\257"
+	.ascii	"\206:\236\334p\366\343\246\272?byGWgzZ\325@F\304*\221\264!\310"
+	.ascii	"@\022\342\002\035\363\316\342I\365#\251y\242\335\246f\216\243"
+	.ascii	"\334\357\b(\347(Hc\224\367\361A\361\272\023k\261\202\367~=*\230"
+	.ascii	"\230u\320\201\205\016\347\2757\201\303z @zp\307z[\271\021y~\216"
+	.ascii	"gA\274d\265Gl\205\021+\277\300\261v\371\n\356\314\226\272\365"
+	.ascii	"\002W\\\345\312\226\271\252S\251H\301\202\316b`P0a1\037W>19)"
+	.ascii	"\270\257\372\021C\242P\036\013\bf4Fh\316\202\336\004\256-E*\271"
+	.ascii	"\357\354\204\237|\006\270<\251\322\350\344{\212\370Qt=\351\235"
+	.ascii	"\274\353\330\352\234\376X\370\214\255\236d\307,by\236]\252\370"
+	.ascii	"\340x~\024\275\256\352\314\307KVu|W\246\270\227\361C\360\331"
+	.ascii	"\213g\343\231\212\213.\234\310\231\212\370\2513\212\034r\242"
+	.ascii	"\221O=\310\333\237\r\257\3416\320\360&\257\001I\34440\371\fo"
+	.ascii	"\0026\344L\212|\206\007y\013$\203\0021\\\206\341\245\036\003"
+	.ascii	"\f/\362\341\222G]\n\351\302\227\034\350\227*\225\234\310\243"
+	.ascii	"\336o\001\203\216\250\002\0311\016\302\216)D$\"I\n\2224\007\""
+	.ascii	"\013\020\204\002q\236\205Tz\022`\0049\312\242N\031\306Fd\202"
+	.ascii	"$IJ\323\030\002R \003h\303\233$,\222n\322X\"\027\255d\207:a\262"
+	.ascii	";D@Q\320Q\025Xx\260\177\375\027N\n\231\375F\315\201A\275\373"
+	.ascii	"\203\311\205\250\031\226\005G*\302\243\270\212G\217\357\3127"
+	.ascii	"\216\361XR\233A\307\277\375\376s\025\341\341V\346\220\206\013"
+	.ascii	"[\207\357p\370X\226IKv\r\314)t_9\336\275\322\330D\006\337\005"
+	.ascii	"\203\320\266\2046\253,\022=\323\036\356\211\004\022\235\f\343"
+	.ascii	"Qs\202\234H\272B\310\030$A\252\016\245\233\373\377z\377_\303"
+	.ascii	"j\200\214,\347i\364\270\3478)\344\350!\013j\n\327x-'>\007\007"
+	.ascii	"1\266\321\313-U\325\007FP\3229!\264J\357\210M\252\204j\314\334"
+	.ascii	"|\013-o+m\212\2757&\016H\340L\360k`\236\004\003v\334\315\273"
+	.ascii	"\217=\303\n\020P\336u!\265y\251"
+	.string	"s\220\377\020/\250h\007\303\215c>\336\336AUSo\346\232\004~a\374\3440j8\361}\215\002<\222\002\367\336\340C\240\032\355Y\346\005:b\375\270\032^oi\205\233\242\r\342O<\377!\3376\275!\301t\301\260\b\321\336\223CJ\262W\035\200'\021\376QwIk\345\264\273\341\312\331\323\273\243\312\272\367\362\020\304\344\363\214\3451\234\2424\317\026\350\202$\320\356^\013\354\316\273\302G\361\3215\304\326\257\356\316]\370V\303\232 \212\315\336.`\354\250\224\331H|\266\204`J\324\304\360\373d\006\024\002\267a\020e\222bjn7\325M7\337u \350\356\212\035La=\213\231Ir\330\331\031\242\020>(\315\371\311j\2222\t\021\0341*\234\f\003\224\363\027sV\007\264\220\364\361\205\317\001\004\020\240\303/\031\276\313\237\303f\220\307"
+	.string	"\r\231\307r\020L\371\247\245\357\310\377\321\346%\262\322r\374P\357\227\277\3034\004\3772vS]\343\310=[\352\n$\210\035\371\221s\206\362\224^\225\221J7\222\312\b1\220\322wp\323\005/\256\331\r\212'#+,\311\313\342\016L_\353\310z\330\320e\241@\210\275\\\021$n\344\210s\036\261\327\330\356\257"
+	.string	"\277\347\341\271\260%\251\250"
+	.string	"6\254\320\314\274|3\023p\266\264\231o\030%\033\030\372 \302'G\254K\325\034#p7\324\240\340\370\320\2657|B\035\023IB"
+	.string	"VP7\342\254\240a"
+	.ascii	"\262R\233\256\363\277\005\206\235Xd\317_\2418\334\221\305oZ\030"
+	.ascii	")\254\0270\227\263\215\363\002\214\372\326{;\206r\207\033\356"
+	.ascii	"\313\026#oy\335\007]\326\347\301!P\227te/\204\303\343V\370\201"
+	.ascii	"\005*\033\020\0342\373\337\366'\375\007Lr\b\030\242r\270e\276"
+	.ascii	"\227\232\316/7\316\030\245v?bS\223\313\\\367\373\373>\360\342"
+	.ascii	"\020\004\215\0278"
+	.string	"%\215\032\025\244\265\016\265< \264\264\203\030A@w\006\313\251\353\330\367\203\264\242Y\313\3044\266G\260\313\217\243}a\007F\274\f\253\\14`\261\024j\303\361(\242\373\031\302^\253uq\251\242\220\374\003W\037\321 \202rc=j\264tX\314\257\353\032\030\036\237k/\245\004\025\0232\301\n\r\231\216\224[51xk\230\036\200\301\371\350\213r$*\240\201<\033\365\264\230\\N)6\003\342\272#\310A\316r\346\263\025W\277\242\321\352\271\206\340d\nM\006{\226h\376\363\002\342\3164\336\372P\216\371\035!\006\2506!\346Tz\322\320\226\201\227\007\b\205#\307\032\216\361R\374jL\177\326&\253\264\335\007\177\211;\357y1\236\016\276\210\033\363\230\217\354\224\252\361E\255\372\025/d\r\210\353\036\366B@\311\344\374W\270\025\2307p\355\356\232\254B\003U\217\210\313tpRr\352\375?\214\005Idt"
+	.string	"7\306:\013c"
+	.string	",A\t\017\222\002H\022J\362w\377\367^)\ri\373\020\2251\036\243\177E\335I\216\351\204\036@\300\224\222\224\265H\372uY\213\243"
+	.string	"+RJRRW\017\247\304%6\260\235x4\347\204\247\022\200Y4\211\355T\3679\342\213\202\210\031\335f\224\237\246\006\264\372\354n:LA\t\202\226u\337|\205\245\277\344\231\212\301_\324bG\347L\2260\030\364m(\017\202\341\341\355K\364\333\032564\203]B.Ur$\204\212\017\021b7L\002\362\003*\304\301\022\023\254\316?\270~\030\325c\221\230\361\t\321x\236\270\221+\300B\tr\274v%0\f\206'\225\354\236\340@Fn\340\235\352\313y\r\242V\224\217\355\241Atz\202\342\2038RR\020A1_\253\215\005*\214\300 @\260\0023n#\351h\2676u\3516\345\335of\342z\256\254 \310*wM\345\207x\275\"\307C\2755\254\234\317\331Y\003jx\363\203\365+"
+	.string	"\214MH\356\036G\262\026\272P\226\265%8C\234>a]\323\354,W\226\217?\374r\024\001"
+	.string	"\033\213~F\3779qb\261\210\2470<\336X\037\332\200\202\325\313\253,\260(\334\312\370K\007H\254\t\360\271\240\301q\003W\351\rQ\231\225Ay\221RG\2550\"\306Ej\207I\373\372\362\f)\323\344!\304\200\tj\252\2658E\240m\312\022\344ph\023\240\252!O'CH\3676\323Q0\256;\304e\023\013\252`\252\326\002\225FK]\202\272\\\021~k\224\246\254Q\005\231]\334\314aA$3\276\375\242q\006wP:\257a\217X\227\266z9\310p\013\002\022\227\005>$'$AW\352\332l\356\\\270\332\001b9h\021nj\354rW\323$GH\177n\215\277\373\344H\224<\034"
+	.string	"\254\224\371\273($\222/\324\220\336X\221\022a\244H\t\030St\276\225\225|\340P\\X!m(2j|\214'\272\307\376\232\2202\020\325\351\263\341\220\354\272\237\367AQ>\340\306h!R\324a6\210Q\"z\\\364\325\004\021\"\312\242d\214\3013\013\234\326f\206k\035\313<\003r \006N\211/%4\351\210\237\225\275T\364\227\354\264+\002\251}\035c\373\007\254\332| r\353\006\251I\346AY\3576\215\366\021\3341\210\316\321\306m\013\242t\347)\017\n\347S(59\233\262x\373\002\373\312l\361"
+	.ascii	"\034\376\027\217\003\235M\031\024a\270\357\0357\270\262\353\332"
+	.ascii	"\231*\217\333\326M\277\232\210\341\346U\322\237\274~\033\332"
+	.ascii	"Iq\001`\377WR\247\224\240\005"
+	.text
+	.section	.gnu.lto_simQuadApplySensors.66.a05d36207b97f99f,"e",@progbits
+	.string	"(\265/\375`\320\003\215\032"
+	.string	"vq\253G\240ZQ:\244>ah]\211U\240r\306\256\215\263}\263V \211\346+9g\214\212v\344\270\375\241\377F\343\313\354\326\274\214\215\n\360QC\016b4\030P\003\257\267\3218\247\\\034C\025\024\005\036\225\337\022\"eJ\001\220"
+	.string	"\210"
+	.string	"\235"
+	.ascii	"c\025\324\207\267\257\304o\342\230\277\344L\312\017Y\220>\031"
+	.ascii	"\244\024\030Ph\346\024\"\370h\t\344G\232\370\230m\025z\212P\317"
+	.ascii	"|\261#H5\347,\262\203\253\375#GR>\252\305}\346l\312\242\232S"
+	.ascii	"Xd\005\344G\013\037\344\372H~\346\372\350\3226s\241\323\374\024"
+	.ascii	"\216\245a\2339gm{\274\274"
+	.string	"\270Z\372\227:,\310\344\273H\343+\322\260`-\311\230~b\200&\034Z\227\272\276`RR}E\230sZ\203L3\356\361\266)\330\256`\213\n\002\266\207\017\277\333\247t_k\256\212\310t\306\344\276r}m\334\b}\320\261\034.\326g;w(%\3109\177\f\374'\027t\344\234\363>Z\354\013h\245\025\225\244[\266PI\227\207}qn\223\375\341Mt\341?\364\250_\210T\007\251\032\210T\317T\375C\252}T\3353\252yF\265LT\357\210j\235\227:6\252s\\j\230\252IU\277T\355\032\325\343\250\026G\365\212j\025\325\247\001X\323\205\204\2239cl\275\231X\001;+4\005\f\022[\235=\221o)\213d\271\226\322\210]\")\223\224I\\\037c\033\253\222E+g\307%\332\035\002o\3006g\3072Kq\002(\271\266\204\t\256\007aK\233r53\346\2346\360\2333i\300k\311\035\341"
+	.string	"\203\f\255k_+4\004\376P\322\255[\261\271\366Q\306"
+	.string	"P\333\002\006}p\\\0026\270`)\255\317\273Wor\021M\326\231`\232\273\321\261\365d\227\207\305\335\005\261$\353\247n\354W\235J\006\337\2075\034\351\203G;\364T\303\034N\325aw\004V\371Q\335\274#\023\267\025\271\335\356\006C\241\273\365x8]\256\007\343\355\220x'p\274\227C\030\211\270\251H\361A\227\343\325*l\260i\250\365p#v\267^\355D\356\246\253\205\330\361jF\002\214\204\002\267\253\365\220\220v\265\2300\351\342\334&K\235\274\302\006+i\225\304\003\312\263>;\333\240\265K\250\022\bmi}\006\332\240\004\037c3\022S"
+	.string	"h\215~vV\36406\b`\036\374,\204\247\252\236\365\331Ou\371\027\333\255\234\346\3745\260K!\367R\016\371\370)\247\261go\365T%[\242\345\331\005d\234"
+	.string	"\177\354\254\354%Fg\003D\250A,\343\bE\306)\231`DF\nZ\314\001p\202\021\251\263\036\021`Q56\024\030\226\033r\b7yH}\334\3568\310\2134\307\206\365\222\264F\034\341\371\272\204\231\002\246\007\200\037\3403\321S\361\365|\341RkL\n\375\342\026P\322<\210VJ\225la3\262,2A\361\f\375\326"
+	.ascii	"7\214\367\020\216Yx\374\242\3326I\351\225\203\205\372\320\330"
+	.ascii	"i\234L\023\2023\233\303\344\377\230\t\202\303\350o\231H\016\234"
+	.ascii	"`ef\006F\007\373K\365\242cP\316\353\327\013F\006XT\"\247/9\205"
+	.ascii	"7j"
+	.text
+	.section	.gnu.lto_simQuadInit.part.0.94.a05d36207b97f99f,"e",@progbits
+	.string	"(\265/\375`k\004\255\035"
+	.string	"F5\274I\220\232Q:\200\210\352|\241B\302\232&\307G\016D\302\375P\211\\\003\350\344s\330)\226#V\027m\231\221\214\251X\004\355\356\323b\306*\223\200\030\237M\202dV0\"\332\203\273\203\b\326\234H\236}\216\017\310'\233\310\235d\241"
+	.string	"\237"
+	.string	"\247"
+	.ascii	"\367^\t\346\355I\376\352\374\253#\376\220gF\216.\\qv\214\233"
+	.ascii	"\006wn\271+\363\261^\004\351\302\025'po\324\225\327\275\302\006"
+	.ascii	"\267\374\300\274e\341\017\224\267\346\r\224H\314\263\333\017"
+	.ascii	"\341\236\bGM=\021\220\030\275P\252\306\203\\`d\031\357\025\326"
+	.ascii	"n\333\007\223'\205g\262\242/-\331U\206\362\201I/\207W@\245\225"
+	.ascii	"E,\t\360\306-\031 \214J\007\016\360\005\t\341\251+L\006P\251"
+	.ascii	"\222\365\007\304\351}\256\327/6D\261$@\247\327\002\227\311(\334"
+	.ascii	"{\331\304q6\317\314?fv\301L\212\b\375\324\025\006\244;X<\327"
+	.ascii	"\245{S\005\314\314\363&\\\304\361a\316\375kH\200\324\275W\302"
+	.ascii	"m\321\246l\252\214i=\362\254\276\351,\245\334\371\211_\262\303"
+	.ascii	"\221\2727\355\272\022\024\374\037\267\254\333\325\377n\371\273"
+	.ascii	"RE\257\376\307\037>\204\225&4b\230:\251v\220[\326QaTO^\334Q\314"
+	.ascii	"\\\371\306V6me\231\255\\\332\312\226\254L\222\225\273~\353\374"
+	.ascii	"\003:4\006@\335[\343\270\346\362\260_S\337\372\215\234\177\344"
+	.ascii	"D>\027\317\266\216\270)\353ZHG\302N\316"
+	.string	"%\341\005N\230\002#b\fa.\020\263\252\306l\345\027[\206\237,G\214ci\361\\\336\205\213\033\330\213\275\312[\006;x@\0211\246GK\276\226oA9x\360P\336\326#\330\030\331\374+\307b\343\377`\020??\303\337\251K\216\337Vv\223\315\225\311\f\003\275\212\315\344O9\025\021<\"(\250\274\355\376\360:6\216VXi=\332\016\262,J\327n/u\347o\031\344\331I\371>\026\321\313RM\303}\222\354\340\2736\213)+LPJ\365\310\314\244\305\301H \340ro\017\037\376\223C)q\336p\270\362\366\\\327\261\321\246\3128\254G\356\007\f\200\267\363\355t'/Wt~8\205zh9\247\257g\304;\341;yt:\336\355\344\031Bq\nA\240\345\234\275\336Mw\362\260\320p\n9\240\345\234$L\334\214~tD\275 \fD\307\345\212z$\343h&nF*J\350\210z\265\016!6"
+	.ascii	"\325|\271!\336\315WKAt\323\325p\274^\215\226\200wE9^\315\267"
+	.ascii	"\333\361j\263w\024\006\261\031H\230\330\037-on\232)\244\255T"
+	.ascii	".\250\266\313\226\265\331'\276\r\032\204\351?T\210\311\344\243"
+	.ascii	"\203Z\241C\352\177L\336\034\235tu5iL\264\310\215gd\025^f\254"
+	.ascii	"\354\033\254\324\302\311pq\214m -+,0\017\\\250Q@\247\214bDdD"
+	.ascii	"D\244$Q\032\003\220\002\031\262\353\006\020\200V\223d\r\033\354"
+	.ascii	"*\222\"\235I\276\364\211\227\f\347\265\310\337\242L\251\243*"
+	.ascii	"jygG:\211\266k2k\262\252\"H\017c\003\372\t\330G\350$\340b\326"
+	.ascii	"\226I\021 \244\267\352oQ\312\234B\327\300\304\355F\032\217\n"
+	.ascii	"\034\021L\221)\277a\0311\216\013\364\243\212\230\352I\t\275W"
+	.ascii	"\327\376\333\002\327:/trH\0348X\221\242k\211PM\352\200\356q\361"
+	.ascii	"\330|\272\214\376\343&\243\t\002\324\351\366x\260\311\b\016l"
+	.ascii	"!\270\202\356#\216L\236\235\274\275uV\244_\013\332\327\276\b"
+	.ascii	"\030\333\230HY\273\232\315Uz\302\"\224\007\337\024"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a05d36207b97f99f,"e",@progbits
+	.string	"(\265/\375`\247\004\r\024"
+	.string	"\346\237yH\240\230J:\221\223\302(\3750\304\244\271\221\037\312\316\316"
+	.string	"\265\204\245P_\351.\226w\3146\317\313\365\276ml\327\341\035\236Z_s\261\235\\lg&\017V\376P\213C\227\366\022\212\201J\327# \260\312!m!\211L\001j"
+	.string	"b"
+	.string	"e"
+	.string	"bQXP\035\332\350\343\240\240n\340\251\241\273]\375Y\025\357KC\377J\206!\fD\027\022L\013E\025\372X\037\005\237\t?\022\204f\204\240\271\004\224\333\201p)\327\362\361T\037\264\222\203\236\331\240\031|J9\223\377\2554Ig\376\257A\272\223\031\303\333\241v\324\013lt\267\243W\177\377^=\026"
+	.ascii	"\245\224\032u\322\367\177\006\t\214\243O\345F_\314F\277J\215"
+	.ascii	"\276\025\032}\257\031\375(2\372Kb\364\231\300\350\223/\372_M"
+	.ascii	"}0\027\375)L\375\256\026\3750\026\375&+\372[*\372OR\364\265P"
+	.ascii	"\364\241\354\377\217R\372\027X;\321\347\332;\231 P\342c\223D"
+	.ascii	"?k\204N\304M\b\234\t\242\257\344C#y\350\243oG\223l<R\211Yk3\325"
+	.ascii	"\2655A\276\225: \337z; \337\352\262\025\332\2270:\220\233v@\016"
+	.ascii	"+\316d\034\251\233\214\2539\223\007\3646FJJ\210\201\345\260\334"
+	.ascii	"\0052U\326\345\300rHn\200\253\":l\226o\344\322p\235!\311-\333"
+	.ascii	"\312\345\263*\036Xny\313=\231\026\2472\004\313[\367^\306l\226"
+	.ascii	"s7\033\307\225A#\203?#\333z\273iSkZB#o\035\032y\211h\344]\243"
+	.ascii	"\nE^\265\336\016\361\270\270\220?\"oZ\005\022y\267\230m\226\272"
+	.ascii	"D\352\016)\227\346\tK\024\217\3109H\235\310L\027\331F%3\303k"
+	.ascii	"\2668F\300\220\355\f/\355\036\261\372\201\3463\3039\036\031\026"
+	.ascii	"@\366\310p\230\265EP<\302\3000P\2501\f\3112\317\214L\220\244"
+	.ascii	")\024\232\003\360\002\261\031\247\003\021@\024\224*\023N(\022"
+	.ascii	"L \363\214p\252\225\217\260K\025g\330\203\205\253\221\3266\242"
+	.ascii	".\\*\216\341\207 \337\325S\252\230j\035l\330\035\330=\371p\030"
+	.ascii	"V2*\037\303\244Ok\206R\216R\f\245\034\245\320\310s#\027\241\305"
+	.ascii	"\303\226\214W\324U\022\001\213R\376\326l\237\371Yf\030\210S\263"
+	.ascii	"\255y\\xI`,\305\034\n\336R\377o\323@\037\300\033i\251\t\016\247"
+	.ascii	"Mx t\343a\224'C40\324"
+	.text
+	.section	.gnu.lto_.refs.a05d36207b97f99f,"e",@progbits
+	.string	"(\265/\375`{\001u\f"
+	.string	"\206\232M;@o\222\326\243\203\225=\314\230a\007\360*\302\020\370\3270\240\006AI$\022\004\332p\030\206a\030\270\261\307"
+	.string	"\037\034\024)z\250\376\361\273YjF>!\215\220\335\032i\233\020\231\0028"
+	.string	"6"
+	.string	"9"
+	.string	"wdz\201tE\244\025\260\017dnH\333"
+	.ascii	"\346\002\323% \335\016[\243\235\301,\265/\230-\230\031{\371x"
+	.ascii	"E\367\242\026\366@\327\316\363\007\273\024\264\004\r=\317\362"
+	.ascii	"\003!m\216\352\253\272\032\315\2654kl\334\312\272T\346\214u\247"
+	.ascii	"i\311\272M:\242B\355\253j\\\253Tw\nu\307h\2071\335&\321\335B"
+	.ascii	"\272Q\260\223D\367A\264\203)\207\b\030$\300\035\354\r\233\243"
+	.ascii	"]\253\3356_\236\217\221\226\315y\334c\001\334\r\266\305\256\330"
+	.ascii	"\024\347f4w\272\256T\335\026\335\313\346>\355^{8\250\235\353"
+	.ascii	"z\260;\2569\001[\003\306pn\304\t\002}(l\374D\260\276\025\315"
+	.ascii	"\247\202r\342bE\211\212\024'HF\210\b\001\342\203\207\016\034"
+	.ascii	"6h\310\200\341\202\205\n\023$\254\314\220\241\222\302\216\362"
+	.ascii	"\342\304\204EI\273M\224h'\321n\320f\300\026a'`#\350\004, \340"
+	.ascii	"\002\261\032=B\304\rFH\342\022\007\273B\304\t\366\220\344\270"
+	.ascii	"\301\204\0207\230\220\307A\301\370\020d\334H0!\210+\004\213\222"
+	.ascii	"\020\215\214\323\bV\205\310\342n0\001\031\202\307\335`B0\212"
+	.ascii	"\340\002V\004Ov\314\301.WZ^*\263X\350[+\325\263\234"
+	.text
+	.section	.gnu.lto_.decls.a05d36207b97f99f,"e",@progbits
+	.ascii	"(\265/\375`yK\205H\001\3129\346zV NA\225t\377\374\376\017$\372"
+	.ascii	"\313\035p\322\356\377\314\021\225\025+B$\232\335\335gn)2\267"
+	.ascii	"\207\342\231\325\206\221y\313;\2703\322\f+b\0306\032hH\336\276"
+	.ascii	"\272\226\004\364\177^\216\312\3739\b\241^\347a\260\334\250\321"
+	.ascii	"\372\017\322\326\366U4\3226\331[\356\024\260\006\220\007\327"
+	.ascii	"\007\035tp\217l\335x\302\367\267\352\254\271\352\340\337\247"
+	.ascii	"\363W\351\314\341\2529\270\331v\336D\204E\316\340h\322\367\202"
+	.ascii	"\265V\313\343\232\001E\255\323\306\244p\360X\222\345\234q\204"
+	.ascii	"r}AZ\240\365\031\024'QV\264\331\373\354\257y\275\304\311S\372"
+	.ascii	"-\351{\346\252\203\273l\347mV\243\307S\222\276\017\034BfDT\024"
+	.ascii	"\243\357\337d=f\363\342\316\017H\337\026\363\260!\212\212\036"
+	.ascii	"\223\276\277H\347\034]\265\033!\tJ\350\204E\246W\304\310\347"
+	.ascii	"n\2168\344#\254\266\235n\361\271\033a\316W[\270\376\246\220\224"
+	.ascii	"\370\314\324>\274\030 4\365E\221R\251\340\215\3519A\231\341\373"
+	.ascii	"+\\m\353\255\352\367\271z\327\206\002\036\214\277e4Xc\365\216"
+	.ascii	"\316\352\260\356\352\033\235\243i4\216\356\321^\315\325BZG_u"
+	.ascii	"\220\266j\036=\243\265\032H\373\350\037]\243\253\332F\177\325"
+	.ascii	"\262\336\252M\336.\372\305=,\235\236\316\350U\264\272\327[\265"
+	.ascii	"\f\007v\031w*\245\315he\253\350$e=R\227\274K\031`\240S/1\371"
+	.ascii	"\315U&\365\211\321\220\274,\225K\275\233\342\220\217\322\264"
+	.ascii	"\270\366\310x \202WU\243\340U,#$A\tS`\205\351\345\234w\244\274"
+	.ascii	"\324#\025IU\222f\246W\001s\033-\2451\221\255\340\343\312yy\224"
+	.ascii	"\242\223FH\202\022&a\251\3502\202DoU/u\214]r\005\331\214h\350"
+	.ascii	"\345\234\243Xt\322\rQ\207\234m|\341\312yy\020\376Vn\265R'i`\244"
+	.ascii	"\274@\327\237^\316"
+	.string	"\313\327\266\277\026\351\255\236j\252\033\242e&\302FnQ\304\370r\316\035x\350\300\254\302\343\214\222\022\356\3371\336T\177u\253oU\314\0137t7\2328\365m\030;\357\030\317\241y\253\373\333\352\233\243v\332,\253\016\256N\206\234\267\\\347-\326y\333\342\344`\223\3167\337\271\201\226\363mw\212\220;\337i\347\227@\316\327\262N\022\203\202\020\252-}\3378\316\307\265Q\027\235EF\226H\351\242&\24213\232\212\352\373\246:\337+\316\367\322\371\273\232\203\337F\347k\337y\3468v8\266 \365}\025s\276b9\257Ws\360k\335\371\nwr\250:\270\216\371G\220\250b^\310\0018qd\024\330\267\202\251a^\305T\275\217 qK\204\226\311r\316UL\bV9\027U18~9\027\341\324z\200Z\017p\305\260\266\334\360}%r\356\354\274~yN5\353;k\322\367u\310\351\241\352p\331R\223"
+	.string	"q\242\345\245j\371\377\232\001\330\250\271p\221\326\367\265\353|\345q\326\\sp\255R\255\324\262C\251W\216\341\336\304\216\372\276^\2355\344\300z(\3705\306\371W*Sp\310H\261\262\234R\357\202U\364\214(\365}u:_\221\316\ne\007\305*5\271\300\002\245\326\335 \251\232c\322\3673\234\007:\377\372\304\t\r\\\325\025\245\276\377kYuR\233,\263\007\034\036wt`}\317s\376\003g\265\2529\370\0278k\\\225\253e\257\253I\276\304\271I\222\242H]\337S\340|}\035\256\241\276\016\337\001g\345\2529\370!\234\267\346\340jUu0\0065\007\327e\315\301\033T\035\"l8j,n\224IS\253k\227\253\261\312\371(\347\034"
+	.ascii	"\2535\003\356H\337\272\254:\330C\315\301\025m\3475-\007CM-s["
+	.ascii	"\316\031\307\3061I\362\353\3335\007\327\245U2Y\345\266\234\227"
+	.ascii	"\035:\315\216HJ_\271j\366:V\311n\225LVg^9g\016\265\212\311\213"
+	.ascii	"\254\276\377\340|\035\362\234\242L\342}~Yu\360Ys\360o\315~;\344"
+	.ascii	"\357\f\310\376\212\242\213/\220\300v\300\001z\337~;\2021+\366"
+	.ascii	"W3\277\r\373{\003\013\366[\024*\026k\202\257b\255b_\020b\321"
+	.ascii	" \177\315\353\242\301\377\022X\257\352\345\035\374f\207\277b"
+	.ascii	"\251Yj\025\021X\371k\236\005\322\325\201\252\344\257s\177E\362"
+	.ascii	"W\271\277\306\3755\211\020\333\301\177\266\037B\265\0055X\256"
+	.ascii	" \355\201\335\372+\212sP\202\377+\324\265\377kf\325\311A\360"
+	.ascii	"\337\275\277O\260>\372\005\024\264\t\276\266\202\211*\344\005"
+	.ascii	"\370\357\217JV\205\374u\206v\200\355\361\267\007\376\032C\247"
+	.ascii	"\253\376\312\325\030T\253\337\362\370+\215\337\356\370\033\003"
+	.ascii	"\177g\300\3520je\331\027\036\376/ \007\333E\370\357\322\377\265"
+	.ascii	"\2635\003F`\255\276\302\177\022\374\365\354\302\377J\371+\212"
+	.ascii	"\343\3776\371\273\307\322\370;\204\255\372k\005~\033\201\377"
+	.ascii	"If\334\005\236\013\376K\344\357?+\203\352\257$\2601~\373\302"
+	.ascii	"\272\370o\366\233\377\316\360w\226\225\372\033\210e\361\333\025"
+	.ascii	"4\330(\013\365\267\022\373d\235\232\204m\372-\323_\223(`U\374"
+	.ascii	"\255\366[\345\337\034l\212\277Gt\226\337&\375}\201E:\007\377"
+	.ascii	"9\340\302\3770\023\370+R\2138\t\377%\376M\342\267G\2775\262\271"
+	.ascii	"\n\331\032~\333\202\277&\263e\301\337cj\260+\370\255\nZ`"
+	.string	"i\370-\n;\303oMX\031\376\246\261B\277=\256\360\327\r\374\035\302oc\370m\n\376:\303=\370o\320_i\370\353\f\177U\301_e\370\253\361\257&\376\232\376\265\005\177=\376u\350\2575\374u\005\177E\3765\3775\371\327\023\177\025\372+\212\277\007p\f\376+\203i\373\376^\301\377\372\337\300\337\372\374\226\370\333\023\374\226\004\277\355\300o-\360[\t\374v\304o=\370\355\006\277\325\371\255\315o\373\357\277\277\265\374}\367\367\222\277\327\376\366\372[\353o\246\277\225\376V\376M\364w\r\177\263\340o\032\376>\376\035\303\337<\177\027\377\376\371\033\375\373\205\277Q\360\267\t\376&\301\337\"\370\033\004\177\273\360\267\007\376\346\300\337+\374\255\201\277Q\370\033\002\177?\340\357\021\376\026\341\357\021\177\213\370\233\001\177o\360w\001\376\332\345\257R\376\272\345\257M\376\272\374[\203\277\t\360W\261\277\376\375\365\352\257$\370{"
+	.string	"\177}\300_\177\374\265\353\377\332_\275\376\232\365?\311\337\031\374\215\301\337\027\374\315\341o\232\277\203\177\333\277\002\376\347\300\177\263\277\366\375\365\314_\277\374\325\313_\271\374o\341\257N\376\312\366W\264\277\236\375\325\204\277\226\375\337\300_\311\376\372\365W\254\277&\375\225\350\257\037\370\253\013\177m\341\257'\374\225\002\1775\377Z\302\177\266\377,\374_\376?\376\257\373\337!000\360?\307\374B\030?\tP\002!"
+	.ascii	"\271\223\362\340\006\251nC\262\274\372\312-\341\242\3024I\365"
+	.ascii	"=M\221\363\277]e\267\253\311N#\245UQ\215\021\346`\2141\341\313"
+	.ascii	"\331\211\007\033\246L\351i\361\360\341\343r\2110\273\333\372"
+	.ascii	"\345\032\253\342\266eF\337\357\265\332\177!\316W\337\322\225"
+	.ascii	"\276\247\251q\376^]\254_\033\2776.\217\232s\316S\231\bL\b{K\274"
+	.ascii	"8\276<\005\365\341\2778~y\374\356\030A\342^j4\bn-\265\320\321"
+	.ascii	"\367W\353\352\370\205B.tux}O\023\343\2749n\326\177!\276\342\242"
+	.ascii	"\314\215\276o\032)\016\204\201D^\312\364\025n\340\352\343\341"
+	.ascii	"\243\357\275Q\317\376\013kl"
+	.ascii	"\370@\033\353\373\275J\344\277\320\f\263E\255"
+	.string	"K\337\323 \235\177}\3778\027A\345\234W\230\313\feT\203\377\372j\326\372\341\267\251\266\"\340\377\375?hA\316E_\270r\316u\314\t\004I\021\325\006\371\377o\336\345|tE4\201\253\250\243\253\027J\265\253\250\016J\265\253Lt\344\203\250\003T\276\"R\252\345\334\341\350\210\350\004\253(\245ZQ\356\240T\313Q\031\211JT\315\313+\242|d\225;\344\243\\\224\325\254\2426P\036]E)\325\212\242:(\325\256\242\262\332U\346\220\217\212\240T\034e\250\016Y\355\nLV\263\212\342\240T\263\212R\252]\365\250p*\276\304Vx\341\272\001\245\022)\217\262S\223\214\"(\016w\312\245U\316\313\271\266%e\250|\2273\002r\226a\005\225W\364\242\306\031\3359\031\301\025Y\325e\3169\203&#,\253|tGT\363\235\322\313*g/\243\022\271)\347\234C Z\336e\255zGdCFfJ\312Y"
+	.string	"y\231sS\316D5\337\345\234\211r\316A(\031\313\234cpPr55\345<\345\241)\313 \222K\312\271\333\264\304E)\325\260\254v\344\330\324\270r\212%QU2Ye\256\234w\005u\252\021\235e\246\223+\212E\230\276\327\312\303\r\324R\343E\337ox[b0\365\345tg\324t1\275\325\021q\345l\305\301\026\375\301m\365\275T56\332\272\234\365\375\206\261\363\277/~c\374w\352\302\230\242T%\243\357\345\252:\370l.v~_8mq)\352\3735\251\327\262+e\001\205\312\234W\2240\026\207\027\307\227\241\240<\370\206 \347\177W\374\262X\3268\3531\327w\304\316\357\n\f\266\244\206\031\247\337\250\377>](\032\025T\370\244\372\326\273\252\2035\2509\3706\355\374:\005u\324\030\262\243\357"
+	.string	"\256\212_\246\377*\335%\035-XH\351\373\266\252\203\2055\007\327\261\235_\025\317\301C\262\347\343\"\375*\377\233tS\034\261[\303\321\367C\325\301f\315\301\025n\347\027\351\332 \363\324u\211~\217\376[t\2150\22212\026}\033\252\352`\004\324\034|\363\316/\221\251E\213\030\274\276\007\b\004\274P\226\332^\364\375CQG\343\255\3577\340X\252\345\234qj\264\270I\331\353\263f\374\232Z0\351\373\2727\202\2045c\301\330\275z7U\202X\331o\317X\276Zf\315\3302jf,\031\333\024$\"\327\345\302C\007\325\351\356\255\n\276\027z9/\244r\3320VL-#\200\035\263\304\261\001\f\003\354\353{!\335\371J"
+	.string	"\\\003+\001\360\205m\347o\365\b\260t\321d\343\213\227\346\321\347\204L?\211\335\230\322\205\313\331\327\030\227\276[n\310\200(\341\372^\370u\036\004\213\305\322U\266\021\222\240R0R\352M\371\323\303b\253\\n\204$("
+	.ascii	"\0201R\241\227g\265X+\366\212"
+	.string	"\315R\313,\026K\345\275d\361\332\240\330\273z\327v\202\030\240\305b\353\272\356\346h\231\243\202H\364\226g\230\256\031Qj\356\205>N+\234q^(uZ;\033\245\226}\316J\321jB\244\325\367B\246\363\304\034\016\316\341\013\363\371\223\357\374)\346\374\355\023'}rny}m\023\033\270b+H\337\237y'\222\312\226\003\220\211\215\263Kl\022+g\225\3242;\367[#\366\310\234-\222\303\217+\347<g\341.\267\224\303\214[\216\276\267\034g\270\346l[e#\252A\016G\025X\316\0317y\2551\335\334\237b\347\251\2549\370'\327\371\363\305\371`\337\371\340\225\363\301'D\330\204\234\222\214X\266\337\252\331\265\312f\276\215y#\352{\227U\007\277-M\253\315\222\234\001\242\331\263\r0Z \031Ab\227\027\315\352\214+\347\314\241F\313\030#m}\037Tr\376\326\254\f\247\240\241&\245o\331\221\264U"
+	.string	"N\025{\177g\206\214\2151\301j\353k\307\332\212Y\262\3331\033\366\021$^s\224\311r^\332\261\233sQ\255\007\270\251\365"
+	.ascii	"\346\\\217\2424|\0374r\376\026,\f\331\226\253\276\326\313\372"
+	.ascii	"\270\334\022\226\021\034t\326\313\356\260ZN\204X 6\210\355\262"
+	.ascii	"?\354W-\263^v\3535\212\345\322\361\304\211Ge\313XH\254\227\355"
+	.ascii	"Q\33140R\346\034%\"\354\016/\3564B\004\320\353\346\n\203e\347"
+	.ascii	"\203a\347\203A\316\007\177\234\017n\235\017\3528\177\233\325"
+	.ascii	"N\366\306\345l\262\300\025\365\365\2659v"
+	.string	"n\263J\330aC\254\257\2559\370A\033gg\033XA%0?\254\276WK3\t\224\033\216\276\017R\235\007\301\305\f\025Z{-,\213\0333g\253*.+\303Z\331\031\226\312\322\2605j\231\255\262/n\247,\214\3672\347#\247'\313\242\336eM@H\226U\306\260M\365.k\002`:vn\253\254\224eqS\264\314P\030O\257\214\236\315\221\271*\243\233{\354\345\374]\325\30155\007\037[9\217\361\316\343)\347\261\335i\241lT-\313\300\256\b\223e\024\325\367x\356lA\3165\003\\\003\003k\006\370X\356\024Qu\260U\262K\265\214\003\313t\263h\231\2279/qz\307_\221\264\276\307m\347+\007\330\006\006V\016\3601\332\371\270\252\223\302&\t\341\376\242X\351\373\333#\245E\252\321\242\003\"\327\367\346\252\203\255\321\316\355Q%\"55\245\257\004l\021\240X\323\035U\337\245\274#J+O"
+	.string	"\251D\341\352k\276\366\3530\375\245\313\364^\007\266^\223\261\271\377Z\214%\3521m\246\301\364\231Z\326\200\335\345u\256\275\034)\2578\311\263\273\234\006F\312\352\005\326E\257\001\273I\327\325\273\266\023\310\370\270\224qiq\343\202\342\205\357NK\025(\200S.G\227%\252\001;Ke+z[\302\202\204+/\n\027\256-E\372\b\357rtv\\9g\300\226r\271z7\265\314=\202M\\a"
+	.string	"=\320PQY\206-\340n\300O\347\261\362<6:o\006\2367\313\2347\275\2347\253\2347\237\2347\215\2347\327\316\233d\347M\257\363\246\326y\223\352\274\351t\336L:\177\375\316_\275\263\235\364\223Z\366\241\351.<Zf\265\234\2278\302+bf\264\365\375\305r\276~\3008\037\360/\225\363o&\037l\314\\1\002\233{\034\315\0232zD\226(\001\243\265uD\244\255\213t\222 \215#\\j\364\225C\3631\227\327\367W\311\371\277\221\364\221Z\326q\375\366\216j\270{X\346\fg\344qT;q\355\326jBLVY\205\022V\f\353\264\304\203\301\227\363\322CY\274.0\202\002\005\333U\264\374\204\211tmq\275"
+	.string	"\022\246\242/\266\303s\227\013\223@\277)J~%\230\256\242\345\247`\0174\037R\246\026+]6\236\034\323yQr\302E\245/vr$1\342r\264\365\305M\216\304\"\241\322\205\250/fr$\033\260\320\245%\351\373=<\234\323\301\327\027/\251)rqdJ\337w\b;\337\001\253\355X\256\r\267\270G*\224\272\247\267\2768\316\bFr\304\r\303\275iY)\322\201\006>;V\303g\230\255\216\t\243"
+	.ascii	"\032t\247\020'\257#k\307l\207\222&\267\002-\r\255\003\f\354u"
+	.ascii	"\374\205\275\260\231\3353c\203\266%\210\032\026;6;.;gd)\215\365"
+	.ascii	"\305C0\031\036\303a\255V\204H\027\214\276\030\254\325^\344\005"
+	.ascii	"\214\020\034\244C\324\220\177\b\356\272)\352r'\254H/\271qi\321"
+	.ascii	"\343\270\353\370\307\b\022\237\263\313"
+	.ascii	"\202\342\322\027oa\256S\016\213\330\221\276\330G\035\022\343"
+	.ascii	"\r\251\257\211f\016\261\261\321\347\244\006\276:\266\201\257"
+	.ascii	"\360\016{%\210\344\t\340\324\007\232\263\245\263)9\216w\034\353"
+	.ascii	"\030A\342]N0!W\212\372b\255\337L\331%\321\353{\234e\246\001\271"
+	.ascii	"\241\366\205q\274K{ua\002\323\027\337\370\334\024\026\276\034"
+	.ascii	"J\376\013m\024,<\243\276\030K\230\244\352\306U\337\007\335\256"
+	.ascii	"Pq)\2758\266z\201[\024\240\233\324\360\226\364\3054d\340\252"
+	.ascii	"\03100U\f\273\251\016G\370\351x\005~\302-\232\013\002-\304\256"
+	.ascii	"\364\370j\n-g)\260\324q\213\032.M\200\224\351\213Y\\\256\215"
+	.ascii	"\356\311\016\034\005u\006\037\0357\375\265\f\037\231\177\326"
+	.ascii	"\r'\306Q\230\213\276\230\t\253\300KX\t'a%N\021\304`\306\032F"
+	.ascii	"\"\023x\\\024h\376\365\227\022\224\234\271\322\343\313J\031\037"
+	.ascii	"j\246\224(e\364\305DA,V\352\320\372\342lR\261\330\342\325\367"
+	.ascii	"5YP\242\204\001\303\345f\037\027\363\317\0049'U\264\374\004\225"
+	.ascii	"\2252>4\336\335\234\221\337\315?\034-%F\256L37\317\374B\033\032"
+	.ascii	"D@\276\372\236\303\226\323\fc\2261\371\316\0245\365=\207+\347"
+	.ascii	"M2_\314|\344\3655\367\316$\016O8\270Kn|jcn\356\275\212yAF\227"
+	.ascii	"\215\033}M1;7\307\300\250\253\261\243/M\315\301\246\027S\317"
+	.ascii	"\004\363\013-\r\031+\330\372\236C\333y\363K\230\020/\252\276"
+	.ascii	"?N\216\275(0\262\234s\bU\t.\"\032C\243\257\331E\352\305M,/L-"
+	.ascii	"UIB\324\211\205o\317)\313M-f\216+V\214n\3645\363\314/7)ta\276"
+	.ascii	"n\b\241\363\321\327\254b^\301\001\343\003\207\224\276\246\025"
+	.ascii	"S\307\020\265\246\300\276x4ioE/\250\374B\033!a\371\257\35794"
+	.ascii	"1\271\351\344\211yw\241j\252\235\2311&z/\302\344\250\273ywS\n"
+	.ascii	"M\231\273+\273\276f\024\363\f\307\006\01760v]\025\343\fT_\223"
+	.ascii	"\314\204\302&E\231\245\3579\2448M\272V\303*b\004\252\357m\310"
+	.ascii	"\266\260D\351{\016\3714\233\bW\244\330\212\353{\373\204\205\024"
+	.ascii	"\367\205\310M#D\314%\266\313\0042S&B\313O!(\002\250\007\226\225"
+	.ascii	"S\037\202Q\216T\201!\271\271\344\246\222\"Y\224\270\3645\223"
+	.ascii	"\274j\211aS\366\275)g\246q\201\003\354k\306\231GZMkM\311\224"
+	.ascii	"\371v\023\356\027\322\224\315%\341\365=N\334i\026\271\351\366"
+	.ascii	"\013+\016\247;*}\217\363v\376f\333/\254\001\303\303\205\216\276"
+	.ascii	"\307a;\217c&D\210\271f\375\352r\347+\313\215\023\251\244\266"
+	.ascii	"\260\233k7\325F\220\370\034\326r\210__si\242\231i\277\320\344"
+	.ascii	"!\303\017\251\357q\276N\363\354\203\031gj\370\365\2759\226E\245"
+	.ascii	"G\220\2767\313L\263_h\323\366td\251\357q\270N\223\314\034\342"
+	.ascii	"B\255\n`\337\343h\235\246\2309V\304\244\245\326\267A\324\374"
+	.ascii	"e\301\261\350k\202\365]\r>\244\2767\277\376\013\2035xl\255\330"
+	.ascii	"\220\027#E\231\032;\376\035\246\327\355Q\256\252\302AT\214\370"
+	.ascii	"\021\366\204\353\246\327M #HtRE\222\222\321\327\367f\227\225"
+	.ascii	"\222{\002\353{\363\007\026\031\023\214\276o\034\031\034\234T"
+	.ascii	"\306p\364\3655}\230[\201I\304\302\372\366\035\231\217\254\276"
+	.ascii	"f\217\317\245\321\205\301\340!e\312\212>(\271-$[\372\036\307"
+	.ascii	"\305\351t\363\206\223"
+	.string	"\251u\346<eE\004F\204\235\326\324\207\232\262\"aTf\326M\255\271;\27739\314\034VM~Qr\2308L9\033KU\234\264X\223\345\214\277\276f\r\323\306\335r\312\021\245\257yeb\235\tk\241\326\3678)f\230V8\201Oy<\372\232U&\215\233*\253\036n\2000L\031\302\037`|H}\315\030&\225\320\254HO\254L\013s*H%$\tF_\323\205\371\342n\241aD\t\306dqS\352\027\342\350P\342Y\365\375M\336y3\312\\\361\013\261]\025\244\334\3677RN\363\311\204\312\361FF\256\357o\232\234\377\340\277\360Ds\021\025\025\307\304\324u\023h\313EQ\037\232\020\341\250\342\313PN<\350\320\343\356\253\357o\226\347o*\231J\267F\024\216VT\227\013\334B\211\307Y\337\337\3400\215L#S\231\201\022=\2748\276\240\324\362\254\317LqS\271\301/\003\276\350k\036\231II"
+	.string	"k\2440\223L$\234\275-yR\313\034\243\354\tK\337\357]\356\277\220\346\213\251\316H\337\337\2540\211L\";e`\340\375\273\035r.\252\343\272!\362+\273~\367\357\002\313LD\263cY\2275'\2250&H\372\336\346\314\t\006\314=s\346\n#\343\305\201\345\251\251\017\033~h%Y2\363{\306F\271B\213\212\276w\357\362\325"
+	.string	".\351B\342+c\363C\212\21322\266\t\215]\017%&2\257N?\220\352\372~\357\216\371/\254T\216\354H\033s\305(\221\304\250\262\245\206\214\226\030\224\033\306R\261JSZF}o\343\245K\227\373\005\002Df\350\345\251\251\017\027\340\355\330\342\345\367\313\275`\033\177<\370\372~\317\242\215\221\003\213\322\3676v[\266\3341a\206\332@\214u\353\233\001\326\3676J\262d1[\332\250\235\377\305\362Zv\261\334*S\231\213\272J\030\273\373\341\301m\276\250\334*T\256\025\234s]Z=AY\021\376"
+	.string	"\202\305\324\027\017\357r\235D9\023-\363\023\006vy\352\303m\361\225\231\364\275\315\216\3636Sww]l\226\242D\351\272\nu\272a\361\235\201\002\345r\0368\344%\2543\\y\347\177\351j\331\245\253l\2462\347\250\022\314\240j\350\2348\271k$Xp\325\260\235\377eRv\231\3301\021A\"FZ\364j\304\226,\271\034\206\002"
+	.string	"\021\274-z:\222$1\303\212\213\273\\\355\2203\335V\234\214#G.g\225\031I\256\204!\313\354\301kZ\234\377%R\313.\221\013w\213\3202\321\206\033qe\364\370r\236\362\300\244\n\314d\334~\341\376\333v\213\334\267z3\206\2065\006gj\310\224\255\276Wi\347\327\355H\312\315G\337 _\315\301\257!23\273kf\226\277k\277j]e\355\257,\255\306\357\205\232W\337{v\321\204a|P%\351\343 \250\024\306\245\306\227\363\277C^\313\356\220\256\273@.Z\221\2001\275\245\007\247\301\023\023\273c%\324A}\357w\354r5]\300\264\310\352{\232&`\257e\027\354\312\020*\257\236\024=\232\270\3635\254^\257Zv\275\256\020\026\001I4%\246"
+	.string	"t\f\006!\217>E\343\007l\220h\212\006\035\221D\030@\244h\013G$\261\002h\fD\037\232\227"
+	.string	"\201\306@\364\031\216H\321\026b \372\\\360\022 \320\240b\032\"\211DM\024\221=\002H\036\221<\305 \374\022 \n\220\016\223\037@\203\212\3519,\221\034\022\032\"\321\024\250\3503\004:\352\314p\024\262\251\261\210\0042\205\202x\214\3104\031L\321d\020\032\204G\030\211)\321$\006\241H\341\317\021\310\246H\031\2227M\032\217<fOP1y_\202\307HD\302`,\246GcMOP1\271\001\212$\002\361\240=\033\b\005\0359\274\004\210$\020\020\221\247DJ\f\n\221<\362\330 \023\373\030\211<\311\344\220\004\022x\216\311\342p\330\001\207\227"
+	.ascii	"\361c,\"\0010\303\021Y\"=\032\203>D\024\350\242\310!\241+\024"
+	.ascii	"\304\203"
+	.ascii	"L\223\030\bh\310h<\032\203)1\by\364\301>\251\261\210\024\362"
+	.ascii	"\t\3560@\304\f7\231\242?>f\020\021E\246\311 4hhD\205\2167FT\350"
+	.ascii	"\030\204\006\371\234=>\330\210\n\035}L\324X\0042\026\217\306"
+	.ascii	"\223\347\b\004DD{:8Q\240\242\217PP\032D\223G \036\037\034\003"
+	.ascii	"\317\021\310\004\024y4\001'\003\024@BB\024\3101\026\205Z\020"
+	.ascii	"\212`\004X\bM[H\"\217\351q\003iz\20205\232\320\203\026\201\204"
+	.ascii	"\204(\200\246\304\237\233\036#1(\350hB\r\215\b\020)\222(\004"
+	.ascii	"\"-\032U\270 \205\364\004j\254I\215&t\350A\221\250\211\"\020"
+	.ascii	"z\202\361XLy\320\024=!%\366\b\r\345\374\030\213=F\224\003hP\321"
+	.ascii	"\005\023ph@q\342\0044%\376`\024D$\222\002Ah\232D\321\3020\231"
+	.ascii	"s\002\020J \002\005&\232\022S@\221C\251\020\221\207&\231\034"
+	.ascii	"\"\246\020t\3541\022\2214<8\031DD\022\205\360K\2008\026{\322"
+	.ascii	"\244\016\022\211\366\244I\234<\002mH&Q\036\036\">\001\b%\330"
+	.ascii	"A\201y\242\210L\211\0338\"o\316SD\242F\364\347|\b\"| \302\b'"
+	.ascii	"\202\037\301\001\"\034 \002\177\004\007"
+	.string	"\354\3548@\204\235\363\"\354\3304ESb\2324\323\022 \214?E\023\304\025\200\216\030\320Pb\210\246D\344\320\004\321H\223\016GH\215\305\241`2h\b44\036\213\311\242\211\016iP\321\0054%\376\234\311a\022yL\032\321\0268\240\310\241d\022E\n\235A$\332c,\372\240?F\"\222&5\232\220\022\177n\212\306\300C\024\032\006\365\370lx\t\020\033\024\223G\241\032\241 b\232D\203\212\251\020\205\020r\210$\002\r\375\030\211\303\241\240\242\007\032P\234@\242@(\017\017q\210$\242\306\"\320p(\2508\200\2248$\303\320x,\246\304\324\210\026\221\307\341PP\021\003\032P\234\030\242H\213<G \324DMJ<\002\371\230@\307c\005\206f\332B1\275\311\243\220\005BMX\031*\232\022\221\327L_\002\204\221\b$4\004:\206HK\374\024\201|\322d\261g\230L\022\205\204\311!\232\022S"
+	.string	":\236'*\212\232\002\021\203\305\244\220M\207\"\354\b%\315\227H\016\177\212>\306\243\t8H\234L\022\203n\020\222h\211\305\024\211\032\213\301!\242\013\310cz\f:O\0207 <\n\235@!M\016!K\244\033||\320\243\t\350\220\f\310cJc,j\240\2078\324\201\037\"\262\347L\217\036\370!\"{\2024\\"
+	.string	"M7$7\200\202\307\210\246D\r\240)\361\307\346\004q\003\350\217\221\350\0014%\376\324\2308Z"
+	.string	"M\211?A4Y<\256\200\246\304\037!\022-\002\245C,\240)\361\207&\035\216"
+	.ascii	"!5\026\207\316\036\024M\336\364\b\370Q\bE\206H\217Gd\b\032t\b"
+	.ascii	"\210h\302L\016\203\210H\"\007z\210C\035\b*&o\320 \242\361\242"
+	.ascii	"\240\001\025,p_\002D\3123\204L\223!\222\250\020\2124D2-\302\020"
+	.ascii	"b\310\370\363\301\211!c\021\350\203\020D\030\2120\302\211\020"
+	.ascii	"h\317\020\020\217\261\030\002\231\034\n\321\200\021=hr\31084"
+	.ascii	"<12\025\252\351!\242\310\033d*d\223\026\2213\324\364\030\321"
+	.ascii	"\241\317\020\fh\222\b\203\r\232$\3020\024\032\212\201\207\b\303"
+	.ascii	"\220\005\025\2068=Ft\210\232 &\207,\2500\254I\"\321\030\220\304"
+	.ascii	"\240\341i,\022K\360\f\361\321\210\002\025}\206\301\021\311\037"
+	.ascii	"\"\220\3170\230\016\203=@\307!\2151h\b\350\3103D\016\361\fiP"
+	.ascii	" \030\210\251\211\341\r\222X\202\347\372\f\301\220\"\217%\222"
+	.ascii	"Ca:dA\205\341\206\030x\216@C3\035\206 \202\217\317q8\024\246"
+	.ascii	"h\322\307\3478\f\262\240\302\220&5\301\203\366\034y\206'\013"
+	.ascii	"*\fm\210)\261g\210\366\024g\030n@A\003*X`\310\202\n\3033M\026"
+	.ascii	"\201l|\206`\030&Q$\212\"}\2065\351\020\245\241\230\304$z\210"
+	.ascii	"B\303!F{\216AC\023\005\202a\350\330\203O\002\t&l\360\201\025"
+	.ascii	"R8y@\364\020\207d\030\006\025\223!4\340\202\n-\204H\321\037$"
+	.ascii	"1\ra,\022\203B\360 \223!@\034\340\177\320\354\301e\026\"e\230"
+	.ascii	"\262\033\343\204c{B2\244\013\216L\006\0172L'\264\223\022B\243"
+	.ascii	".k\254\336\270\270\360\321\367i\207UX\r,#.Y`\330.\317F\330R\360"
+	.ascii	"\013O\311\266L\223$IB\360\225\267\255?\261\232'\2629'(\365\013"
+	.ascii	"N\215\017\bf\273\301\nc\265\245\013\357\270\2713\013\324\n\376"
+	.ascii	"\270\177\031\277\035\375\210\342\272<,_\020(\245\340\326]\313"
+	.ascii	"\346\021\220/:\037ckiHv\364\31587g\360\236\312\364].s^\342\320"
+	.ascii	"\304U\025\221\332q\341\220\224(\253\234*T\230\311i\341\026dr"
+	.ascii	"\314\210\353\033\274\n^\005sT\250\006X\231\222\372\360\007\261"
+	.ascii	"\036\314\361\217 \021\304Q5\225F\205#x#J\331\226\247+\003,iR"
+	.ascii	"#h\303\276\3500Q\304\034\351\373\275\317\265\220\033\263\353"
+	.ascii	"\373\234\025\347\037\254Q\005\246\266\203\210\225\225\n\204a"
+	.ascii	"\272A\203KJ\bTV\260\n\233Y\371\255\370Z:\255!\215\005e\230\177"
+	.ascii	"[\202@1\tRu]\021/wK}\203S\265\206\300\300\300@\277\234\213\202"
+	.ascii	"S"
+	.string	"\370\204\253(\245\232U\316E\301\030A\030\017N\035\347\206\031\t\002\206o\320E\320\305\035\253\031\252\204'P9G\347\037laj\325<\311+\n\2232\275l\222\276\310\320\005Y\334\243|\231\230\241B[qe\230dn\024\261=\356rB<\260.-P\346\022\037Z0\2264SJ#eNWH\217)\254 A\246\007\233nJ\031\023\265#G\337\340\222\371e\313\300ntQ2\357\314\261\245*&\0257\312\306o\f\237\031\245\271v\343\005\327\007\226\342\262\300D\224\244q%\231Zp\260\275-\221\202G\303\250\037V\214\036<j\273\371\353\261$\245o\260h\347A\243\002\030\231\223\353\033\f\022]%\0266(E2\016\304\211Q\343\206\022\016\274\332\221,\035z\030\320\334s\201t\006\343\317\017\t\n\n\022\366\373q\027\253\f\334\032\303\324\207\317\340\\\301Q\026\305\314\361\0311/\biHQQ\351\213\367v\216\315"
+	.ascii	"\232Yj\343+\203\005\225\345\306\230\3432?\336\303dj\352\236\340"
+	.ascii	"\365\365=_\325\30185\007c1;\307c\316\300@%Z}o\302\\&\363LI\306"
+	.ascii	"\r\214^\315\331\023\013//\307z\277)\006\177\031\301\244\225\243"
+	.ascii	"\357\235T\035\214\273\354\034{Q\366\211\365\335Ps\360\217\271"
+	.ascii	"\340-8\326\334Z\340\274\343-?\316\202\265\320\020\370W\246\357"
+	.ascii	"\363\252\016\266\2519\330N\355\034\347\321Da\242g\326\027\017"
+	.ascii	"\017_\361`e\255P\021B\007F3\344m)\313\312\361\025\234\026K\245"
+	.ascii	"\277\276\270\312\3232\214^\021)R\360\224\212\226\237*\221\242"
+	.ascii	".(b\224\322\214\360\335\361\224\352\226\247x\334\341\205\036"
+	.ascii	"\250\2231DZL\254\345(\f%\225RD!\"\032N\213\001\003\026@P88\036"
+	.ascii	"\025\r\327\261=\023\300\204M\fD\231(\346\234CB3\nJR\220Tv\326"
+	.ascii	"\260\343\363\220\034\005\203T\210~=\026\254\244\355\242_E\\;"
+	.ascii	"\236\023|\202\230\232,\234\016\361\243z\336\336G\207\375\375"
+	.ascii	"U'_\3010\367\202\027\360#)r\013P\244\213\210\313h\243l3M\350"
+	.ascii	"-\374>\021\022"
+	.string	"`\tE\314\277\214u)BY\327\317\"C\235\355nN\016\264\r\fc9\037\214pO\2706\315(\233\307\023f\314\372\t%\304O\241\377\232\033O\361^A\345\364\246D\262<\317f[\nB\324_\024_\003\317\232Q\313\232\216\006\322\363\022\366\232\0263p\356\355\035\216|<'"
+	.string	"\234\372\331\335\204\221x\207T\3620\255B\215\001\027\200Pb\256BV^N3\347vW\3330\271k\371\rCnl\"\367;p\257\367\242\377\033\300J\254\212\304q{\300\037\365\030utfB*\036\235\277\326*h=\236\334\315\017hDZ\213\214U\235l\037\265\321G@\020\372O\032bG\2508\353\356=\343!\026\230\240\370\2647\242\202?\007\210\"\023>~\263`\201uK"
+	.string	"sT\025\320=N\267\241~m\213\257\373\363\341\322\362\036\227\243\b\376c9\242\227\361k7\357b\217\201\236btRm67"
+	.string	"\312Tb\313\233\377N\234P\354@\024*\2328\325\322\211\3073!oL\337\240\240=\335\324\344W/\323\277\324E\026\026\333e\242\001\300R\315q\263$\031\\\261\"\262\276r\323\313"
+	.string	"G"
+	.string	"\312\353\226\003\300\024\370\027!\022\246E\273\274\324\233\337\207\200\023\244\263\333\2650\023^\365\264\203\030\340\371\376n\272_\343L\331x\272k!m('\f\23039*V\264\327IXG\277\377^\227~\030\037\256\340vy\220x\207jH\234\314\334\3001\232\026\310H\354.]\033\205\361\335\355\215\f\007\350E\206=\327v"
+	.string	"x0\245\214P3\203\221\265\331}\332\356>\021\376\324\316Huy\373\320\254\017\b\340\367\023y\357\353,\343M\377E@S\320A)}`\227Sp\016\\\005EA\030\341z\r=\224\217%\247\303\231\036:\272\037wu/H\240\251\277c\252\277\003\016xd\302\227\364%\222\334\021\024\320c!\226s\204\352\300@\247\035n\003\247\001\026\006v\267\232\004\265\n?=\230S\302Y\310R9\017\354%4\b`\016\211,\250\334\0076=\366\242\365\313\307\327e6\346Y\007\251\033\304cn\252!\350\202\017\324\371\364\233\033\002\323\t\327\353\272\272\033\253\372\303(\026\242~8T\021P K@\310y\234\214\361f\225[\256\223\233\026\2532\304-b\210\016\013w\3139\022t#\006t\234\314W\305\366\326\n\016\364\257\247"
+	.ascii	"\244\365\214+5\262\237S[\377\237\312(6\033\212?\001\306c\315"
+	.ascii	"\261\002\245Z\346Z\356Ol =\031\377kb\207dG$\002'_\230\3138\217"
+	.ascii	"\251x$X>\357\256\016\217\n"
+	.string	"/\326a\002\203\306\230\321m\310z\271\031\301\340\004\364\023\323\223\213n\177s\233\253\344\202\226\232\\ImHZD$\017\230N\270\317#\035eA\271\350\017)%P\267\236HR<\263\211j\366\0213B\030j\243\2413\324\201\212\314YE%\202\216\253\003\013\312B\317\333-K\322$\204\251g\036a]N\212\303\352\324\311f\\\231\021\036p_X1\277\366\206\325\361:bzM\362\301\232<a\026uw\202\177\203&\235\244\211\022\344A{ [\027\\\324\326\371\001paG\317\375\377\201\251K7\306\373\346CO\246) ?\264\244\367\267\322'+\210nx\002\220\006\364N\347\332\373\352\217M&\3066\362'\277\244\275\037\251\334k)s8U\3463UIVi\2057\376\350em%\337y{\201\223p\325\210g\224\nc\256(\351\203{K\3661\027\3060\335\366l\230sD\231\266\017\303\035n\2274\2578\326\346"
+	.string	"\320\344\177wgK\204#tB\357%"
+	.string	"\3137\331pE(\005\321\242\316\350l\336[\332\013\346\342\206)\370V\236\343Z\354\237`{Qo\207\370\303\3579e\366B\250C\037\247u'\345\t\244\002\205f\343\215\222\350\326\027\233\313#\301\b\b\017\236\256\2403\017S\254%\fIg\305R\272\302\240>\220\216\270\005\177\213'\266&\006\003S\233|p\350\320\232\305\004_b\310e\220!\352\357\2427\016\334\303\230g\243\250\233\245\251\324\212\215X\024q\034sKP\200\214V\001\276\020\260\001\324G\237M\3754\251\242\025\200\334\266\260\021\t(\215j\255\035#\2412\344G\260\326\031\t;\350\006l\325}\211\241wL\006\373\352\237\177\006\313;\204\240\232\210\240\2508\321C\226\004$\nM\005\337\274cC\366E\204\004p\266\352\312\233\206!\001\210\326\226T\363\224\352\r\034>Xd\334-\244\2307\245\362"
+	.string	"\242i\032\310\270\334C\336\265\256\036\356\327\264\237$zw(\261qg\352\236*\031\221\2573\020\376l\336\342\006"
+	.string	"\017\377\003A\207+]\343C\351gtt\rA\377\324P\313\372\274\264\220\263B\026R\rP~8\026\\\355$\204D=T\201\266\360\035H\2355r\0202`\241\327\004\260\354M\030\330\302J).\262\b\214\323)\303\2730\030\216-\024\226\340_]\307\345\2254q\031\314\332\272\333\230\235\020T\346\347\342O\341\261&\2163\t\270\266\376K\222n\215|\231\340\312\371-\252\030gU\241\202E\244\342K\201\204\006\341\301\335\210\220\003\003Z\246\003\324\016\312\fbD{\362\031\360\330\307H\264L\244\276"
+	.string	"\276o@\255\375\225q\207\235\356\335\336\266\251\r^\376\201g\202\022M\2017\023\340\t\226\311\271j*\205\367\332\035\263\350U\374\351\025\374\035\030\352\330b\247\270\373L\001\204\310\356\007;\237\330\036\231P\214_\344\233l\276P\002aU\2242\274\224C\352\266y\274\017\257\322\034\342nT,W\224\263F\337\205\032\267\214\023w\232\341@g)H\353N\261\"\036\317%:\230\301{\351\f\236\234\322=!P0\017(\223\264\2367\316\374\237\262\360\216"
+	.string	"}\344B\023s>v\361{\346\235\016\n\030\306\202\227\303\224\230\3226N\273\320X\r\331\034\3353JK\316e\036\3226A\232\370_\301\254gx\316X\250\235\375\344Xd4\325\273N\300\312\274\365\003#KZ9\324\266\253\024\377>\326\271\213\223A*u \226\003\335\265A\311S\206\022\027\201\376\223oN\222E\232\270\024@\346\324+\022\222\0304\270\217j\341\307\tr\336.:8\206x\025\t\001\017T\315o\341ky\023G#fy\332YmoP. \321\327\251k\353_l\"\266\247'_!\023@\320j\261"
+	.ascii	"<;\373\364$v\351\371S\332O\263\003\367\331\264\365C\263\357_"
+	.ascii	"j\361\335\261D\rP:\212\267\t0\376\241\01775\2242\342\3346f\200"
+	.ascii	"\242\177\350"
+	.string	"\212S\366\256\177Y]\313B\352 \242w\303u!q\242\250&JL\302\354\222U\353X\b<s\373{;:\354\317\002\213\256\\\272\362\372:+,j7\250\215\251\213\304I\340\007\3072Sn\251\030\201\362\036j\031\352\237\367\360\255\333\b\341\202\304\256f\303\335\211\251\263J\226%\246x\370zv\240C\240s\237i\220\360\237\313%\224\355>@^\314\342\340dn\317\361v\021\2526J-\225.t\227\214\217\374\357\024\007\332\367jd\3454\b4\306\323\353\305\331\247l+\375\332\206\233?i6\262\017\262k,\be\r\230QF\366=Qt\250<j\301\226E1SDv\237\001\277\267g\346\372*r\324\252u\331\357\377\277\3555\311\224C\341\373\031\247\3104\357&\214\330e\004\323\370\366m\215j>\320o\237\027R\362\224\222w\361\223\260\350\262\0262\236*Nh0j\273\212\212\252\345\024<Q\203\316^\312\306`"
+	.ascii	"@\354"
+	.string	"\003\273g\342\305n\232?\226\343\234\222\273E\376\316"
+	.string	"8e\345\375\333\347\266@\022@G\177\016\300\331c4\234Pl?Z\207\001\024`|F\341h%.\355\345\tM\316\227\243B\354\272c\274\337na\353\300\2234\324#\256\001p;\356\342\306[\314\300P\361h\340.*\001\221\350\n\331\224\006\205\307\304F\234\2267\203\261\204\363\370\002\317\263\250T\221\016\017\371\300\310\2503iA\257\020\005\231\035\3768\243\037D\003C"
+	.ascii	"\215CI\207\207\352\2451\212\343\376\274P]\327\334\tU\030\027"
+	.ascii	"`\271{\017%\3249\344\017\314\221\332?\377\367?^\023\352?.\306"
+	.ascii	"8c.\246\232S\330N\230B\266U\277\356\273\363\236\267\224\274?"
+	.ascii	"\364\225P^P\361g\367\244\253\371\272\301\257\253\036\217\017"
+	.ascii	"\025\237RO\362\375r0\323\213\332\335\370o\b\272ug#\2179\022\334"
+	.ascii	"\235C?j\374\215\034\336\2341\3636C\217\007e|\315\230\202n@M\251"
+	.ascii	"\366\027\337\275\236\315:\362\235\024M.>$\307s$\365\227\236\r"
+	.ascii	"\023\242-\030\375{\240)\205\336/\205\234\021X\326\223\205\\\267"
+	.ascii	"\366\326\272\371\"\264\326\323\340\235TS\330\233\263\213\017"
+	.ascii	"\272\276G}\033}\023\024\235r\377a\257\217\030\337\355\217{\262"
+	.ascii	"I\352$\311{\244\005>\335\317\002yu\2553\370,\\\257\364\365\276"
+	.ascii	"\204\311]#\365\204\374}\232\177\347\370\027\370HG\237[.4t \355"
+	.ascii	"(\365\365\032\266`2\214\262'\255\363]\337\346p\372\tGK\310\325"
+	.ascii	"\222H&+\037\356K\004#\235M\265O\020j}Id\221\276?F\357\353\262"
+	.ascii	"W\001\343\272}&\347WN\177\366\262O\352Z\307K\223\032\362\274"
+	.ascii	"P:s\312\213\305\177\252{\347\334\267:\246-x\231\267z\365S\023"
+	.ascii	"\321oq\332%Q\314\210\366\376s\005\r\327\217\033\020\317\276\216"
+	.ascii	"\304>\341\032X\206\231\373q\222\247\220\017P\353\344g\311\351"
+	.ascii	"#\250\002<\225\277<\241+"
+	.text
+	.section	.gnu.lto_.symtab.a05d36207b97f99f,"e",@progbits
+	.string	"simQuadInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\002"
+	.string	""
+	.string	"simQuadDt"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\002"
+	.string	""
+	.string	"simQuadSetMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\002"
+	.string	""
+	.string	"simQuadStep"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\002"
+	.string	""
+	.string	"simQuadApplySensors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\002"
+	.string	""
+	.string	"stderr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\002"
+	.string	""
+	.string	"olGates_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\002"
+	.string	""
+	.string	"olNavigationConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\002"
+	.string	""
+	.string	"fclose"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\002"
+	.string	""
+	.string	"fgets"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\002"
+	.string	""
+	.string	"fopen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\002"
+	.string	""
+	.string	"cos"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\002"
+	.string	""
+	.string	"sqrt"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\003"
+	.string	""
+	.string	"log"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\003"
+	.string	""
+	.string	"remainder"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\003"
+	.string	""
+	.string	"atan2"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \003"
+	.string	""
+	.string	"lrint"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\003"
+	.string	""
+	.string	"pow"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\003"
+	.string	""
+	.string	"ol_filter_push_vision"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\003"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\003"
+	.string	""
+	.string	"fakeRangefinderSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\003"
+	.string	""
+	.string	"fakeBaroSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a05d36207b97f99f,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
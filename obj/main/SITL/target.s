@@ -0,0 +1,2853 @@
+	.file	"target.c"
+	.section	.gnu.lto_.profile.baf1a76f36c6904e,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.baf1a76f36c6904e,"e",@progbits
+	.string	"(\265/\375`\211\003u\025"
+	.string	"\264\036}\004"
+	.string	"X"
+	.string	"\352\260\332\323\r\032\002"
+	.string	"\002\001\003\002\003"
+	.string	"\002\001\003\305\201\237\277\001\004\002\004\242\302\263\302\013\005\253\327\227\253\013\006\240\342\234\212\n\007\372\260\202\353\f\b\352\263\360\321\b\t\376\204\367\300\f\030\002\005\002\006\002\007\b\002\b\002\t\002\n\002\013\002\013\006\002\006\n\013\f\r\016\017\226\234\261\244\006\002\020\304\222\223\230\005"
+	.string	"\021\022\342\246\207\300\013\022\002\f\005\002\005\023\024\026\310\373\201\350\r\002\027\223\273\300\245\013\002\002\r\002\r\030\255\271=\004\031\032\337\337\377\b\033\034\035\272\363\200\330\f\036\037\324\240\313\347\002\006\002\016 !\"\372\255\302\243\003#\301\325\215\205\016"
+	.string	"$\274\205\242\255\006"
+	.string	"%\225\221\315\200\006"
+	.string	"&\210\377\206\247\006"
+	.string	"'\271\303\275\241\r\n\002\017\002\020\020\002\020()\230\336\335\312\001*\210\202\217\225\002,\002"
+	.string	"\002"
+	.string	"\020+,-.\315\343\301\244\013/\234\227\371\264\t0\263\330\307\3131\261\213\233\205\b\n\016\002\016234\264\251\257\307\f567\367\267\311\301\004"
+	.string	"89\222\321\201\352\t\b\020\002\020:\376\333\260\305\001\b\013\002\013<\211\307\340\277\f\002=\314\345\244\232\005"
+	.string	">\362\357\204\233\017"
+	.string	"?\202\220\306\317\004@\201\226\204\312\r\006\002\021\002\021\002\013\002\022ABCD\333\217\352\217\004\022EF\313\322\375\213\007"
+	.string	"G\236\376\250\313H\350\300\306\254\005\013I\222\252\354\340\007"
+	.string	"J\202\321\322\374\007\004\021\002\023KL\360\251\206\306\017M\361\246\251\344\002\022\002\024\002\025\013\002\013N\310\342\324\f\002OP\317\253\250\341\002"
+	.string	"Q\351\361\317\236\016\004R\232\242\245\210\013\004\002\007\002\007ST\227\227\247\303\t\bU\341\274\276\362\017"
+	.string	"V\265\300\331\214\001"
+	.string	"W\324\226\242\363\f"
+	.string	"X\202\275\352\302\f"
+	.string	"YZ[\240\342\234\212\n"
+	.string	"\\\250\321Pb\0241&\"\263 I\n\035P\202B\223\306\r\021\020i$D\221\224\244\244\220e\f"
+	.ascii	"\021\206\264R\347<w\n/<gF\222\327\212\004\333k\017R\341\274\230"
+	.ascii	"\216\307\254kY2I\351\302X/y\236%$gA\370\230\256N\026\252@+\270"
+	.ascii	"@\031\034\215\362w\253\307\206d\243\334PR\236s\313 N\303\374"
+	.ascii	"\200zQ!z\320\260\004\351\236\204m\266\322w\021\007D\226n\307"
+	.ascii	"b\274\243\300Zd>=\230O\227\360\212\264\203\270\254m\224\224\222"
+	.ascii	"L\341\210.\335cM\214\t<\350\027j\350\023\003\273\331h1 \007\001"
+	.ascii	"\230\260\b\253\177\366}f\027\030\223B\274\377H\374xL\343d\237"
+	.ascii	"\310\335-\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.baf1a76f36c6904e,"e",@progbits
+	.string	"(\265/\375`\254\001\345\b"
+	.string	"b\313!$0S\222\016\300\300@\001\013\003\003\005\310\250\367\377/\332i1s\220\273S\361X\2766\330\020\354f\032\221;\245\246,J\355>\231\311^2\311#\023\t\001\371(\217\33119vcj|\306\303X\202\242\332\324\220Qi\252vaQ\261O\261\023.\021QN\210\207\006\206\005\213\323\037/&\205\204\235\b\007\265\301\026\020\354\300\n\004,\300\334\254oMF\314e\217t\347X\236\271\244r\231\324\323\353\350\220V\246\236\016\326JO\250p\222\325$\3114\006p\002!U\363\020x52\223$\303\030l\366\354\220\245\273\315_\020@f\024\343\340-\223o\265\031z\226E@\223\227\005\275\2302\347u|\205Fp\230*{"
+	.string	"K\342\342\b\214W&\223K"
+	.string	"\3076z"
+	.ascii	"\202\023)\310\222K\310D\304 \310<\351\032\363\323J\305~\334\222"
+	.ascii	"\233\302\270\214E\221\317\f\341\002\030\035\002]\274&$\004\204"
+	.ascii	"\276GY\275C\346s:~\204U.)`\301\021\034\245b\004\243\376\035\261"
+	.ascii	"Z^j\257D\300\002"
+	.text
+	.section	.gnu.lto_.inline.baf1a76f36c6904e,"e",@progbits
+	.string	"(\265/\375`\300\013\335#"
+	.string	"\246)\222I\240TN:{\336;/\327\206|Pr\021\374\220o\365\251w\312\245/8\b\026\274\350E\241f\204\274\327~Z\2764yz&JSu\222\230q\213N\354\301'\271\005\272\030\257\357 [t\346\021\3354j\022\211D4\331R\246s"
+	.string	"|"
+	.string	"\204"
+	.string	"\345\242L\177=B\033\177\242\252\243)G\020\224\250\n\247\230\225\361\034\310\302#\331\374\312\217\023\377\327\361\337\3252%L\276J\376\267W\251\252\254~\272W\276\370\233\365h*\376oQ\021\317\263x\236E\022\334Bl\311kO~\307\335\335\342\371\314\253\300\356>\177\037\377\272\333G\345\257\177\341\225\341\335\377\3733\3120\212\255\257B,e\250\006u\037?\203\233S\0016\\\335-\340L\260\247\341\277\366\002\234\b\200\007\332\300\256>\247"
+	.ascii	"\316~\305\321W\223\272;w\0025|\246.\244\364\366\031\266\"Z\\"
+	.ascii	"$\217\333j\f\307V\0363\303\333;\f\020\247\335\315\362\227\243"
+	.ascii	")?7\036M\321t+\232\326\242\361\017\342\264\2234\216\020\037a"
+	.ascii	"{r\365\254\273\244\350\356\242?\250\252\374,\3677\356\325\251"
+	.ascii	"\250\240\3318\304VQ\301\262\334sg\035\271\337\217\177\325\221"
+	.ascii	"\001=;77\347\363<\233-'\311\263x\361\\\202\227W\226&\303\360"
+	.ascii	".\277\247>\206w\305\227\363\354\016Uap\f\211y\n\023\216\246?"
+	.ascii	"\t\377\331\254\345\215\233\306\177\210\311v@E\3019Qy\250\t\201"
+	.ascii	"\344<\002N\274\261\2104\246\t\237\272Z\006\230\340%(QJ\272\023"
+	.ascii	"\302\203;h\200\243\273\001|\301\316WH9\ty\321m\204\273\202\005"
+	.ascii	"\273\032\242\261\374=^\302bH\332\b_%\373\315\250\3429u\302\272"
+	.ascii	";\027\361\207\330U\033?\256\274\310\242\352\202\212\306\032\356"
+	.ascii	" >\354\227\255\244\234\266\314\261\241T\214\230{\370\356\002"
+	.ascii	"\325\266,a\217\332\326d\313\354\204\2216d;\326;\004\235\030\311"
+	.string	" \371OFT$\341\316a\203H\332\360n\3451\020\375\267\334\212\325\335:\374\033VD\326h\376\243\241&\210;\003\006\237]\275`\341\177s\035i\201\225\374\260#-0\362\025N\256\221\360LL\311\245\206\227\206w\371\353\343\25731%\363\001\200\375\250q9cf\2044IA\2412\254\001P\0021\206\210\254:\022\300\363<\205\243\240R\006\031\221\211$\220\tDd\202b\005\315\034<k\002\247tP\327\022\325\350\316fI\362\233\272$G\325\2504\362@we\214I\232\260F\3133\0348B\301\236\351\2407Kr\005\356\241\215\231\230L\207sh!&\223dX\f\0033\020\212\"iC\332r\247D<\207<\3231')\003\207\261\343\236\035\331\276\024\301\005\022'C\330'+\226\020\361[\316-!\005\237\270T\230\373\222\031\326\244+6\275\350\210\r\277\242\203W\025\3510\204\030\217xR\003\b\312\033\"Q7"
+	.string	"K\300\354\245\232c\207\273\331F9\222>M\346\317\3779\336\277Pj\351\371\025\230\240\341\310g0\013e`2\220j5\2329\374\032\204f\006\250\272\355\212\323\t\273\355\037\210U\306`\323\227\226\3403\t+\203\321\305\250=!\\\246\221L\240p@\237o\204\263\362\347R/\313\001I\035x\352\210\362L\022^i\335\242\2261\230D\333\243>\344"
+	.string	"N\303oSc48\341\250\212\376\207Xc\332wj\006\265c\3778K\264c4\013r\233\320\232\017\245\200\260Z\371\004K\360\315\332\242M~u\327\235aa|\326\251g\f\331\316\f\274\225\027\013\027}\203,\254%\244:R\342\307\332W\177\266\005\371s}\341\362\234dB\251W9C\302xb\326S6\302\353\006{L\034\374|kVo\304\321\023\2336V\211\320\254!\201W\217\002DQ\265'>\242\362\356e\003\347L\023\236@0O\001.\215\005\202\364"
+	.string	"o\357\270_=Gb\366\267\317Q(\b\377\215\336\364\022\356\001\247\213~)\032\216i\234\375\261&\001j"
+	.ascii	"\bu\003\035s\310\030\255\020\bNi`\337H\353&\035\356\242\233\340"
+	.ascii	"\007T\"\332\2509\350\003\246\352\002\337\262\r\315\201<7\002"
+	.ascii	"G\237`T=\342\322kS\033\3445\312\017\310\207\027\3017\251\236"
+	.ascii	"\376R-\227Tt\245\223:9\262\331\301\371\357\307+\240\223kC\226"
+	.ascii	"\234H\025\347\253\3212\006"
+	.text
+	.section	.gnu.lto_.jmpfuncs.baf1a76f36c6904e,"e",@progbits
+	.string	"(\265/\375`\230\021\3754"
+	.string	"\252Gd\017C\200.\247\0039V\372\332|\274\235\300:\214\342\334\3247\271\256\370\223\2023E\316\252^\017V\246\355\213{\251|\217\255D\022\rY@\335\016\204\025\227+\333!\016\250\315\326 \366\016\214\356\260\225\261\311\226)\245\324"
+	.string	"\336"
+	.string	"\355"
+	.string	"!\023\233\272\017\261\272\032\177-'6\245\022\253\355\316\357\363\371|\336q\236\204O\341\253}\017\343\337rr\030\305\246*\304\232\245\330\224\204h\200\227\251\344*\331Jg\250\337-\3533x\2624i\372\375\n\371X\343\276n\320\347\353\001\341\277;'\271\231\214\2457\344,6\305 \372\253~\254\233\213\213\214\217q\250\360w\274L\326@\200x\307\t\277\366U\306\037}\035\020\373\375~Z\237\267\330\324\305\032>\370n\367"
+	.string	"\016\306\337\177n\024\272\317\215\302w"
+	.string	"\377\376\305\335\213\203\r\202\336n\302o\377e\367\374%|\277_\303\356\332\355\236A\260\213;\027\367\337\317\211\302-\037\017'\n\337\263\347\007\305\264\203b\274\333\266u\360M\364\331\277c\356^\373B\327\013\3351\030\001\"\276\332@[\206l\n\036\371\327\313\267~\341\212{kW\253\220Bq}\327\027etk\360\331\350D7T\267\211\356\022\335OMNF\237\031|\376\360\335\001D\313>75\265\363\361\377\376\3603\017\035\032@\036"
+	.ascii	"y\034*\334S\271\230\264f\237\253;\207\356\336\320\335\032\272"
+	.ascii	"\033Cw/)U\b\233\310\005\270\377\004\tI\376`\267\250\365\303\246"
+	.ascii	"U\213X\301\016\337\037\001\fb\323\352D\254 \323\373\273\327\272"
+	.ascii	"\217\360T\"\020\270\204\330\364\273\036\330\031b\323\277#\372"
+	.ascii	"\213G\307yO$|$w\320\335Fq$|\225\221\241\250{A\006\333\363\367"
+	.ascii	"\354\335;\033\261\351\227\021k8\373\\\3649\346\376\n\216\374"
+	.ascii	"@\370K\376Gl\372M\022 \261\251\037\312\236\306?\211M\375\215"
+	.ascii	"X\235\215\022\233\272\024\261\006\265\206\235\265\313\204Q\322"
+	.ascii	"\304AkX\204F\302Q\033\206\342\260y%\241a%zG\234#qXG\r\253p\307"
+	.ascii	"\\\355z\270X\007y\336$\361\254\211w\304#\256\314]\253\254\253"
+	.ascii	"2\267\243\212a\202E\210\333S\225\255\221\314\332;r\206MW\232"
+	.ascii	"<\214\005\364\025*k\330\210y\274\322\034/\316\341\3203\351Dq"
+	.ascii	"\326\025\216\027C7b\335^\355\322h\343\016\337\021\207\315\032"
+	.ascii	"S\274\261g\241\341\3304\204\"\326_\361b\216M\303\"b})\027\340"
+	.ascii	"\313\217X\301\331{\321\347\026ETh\374;M\035\233\276\332\210u"
+	.ascii	"\n\305\327\357\361\032\023u{\337k\312k\211X_\313\220\036\233"
+	.ascii	"\202\177\274\313}\220\237\370*\310\033i\312\224>6\005\271\304"
+	.ascii	"\232\341\217MA3b\005\313P)C\005\220\214\243\274%\310\246\340"
+	.ascii	"\025\261V\360\317\356[][N_\267\b\205\037=\356H\021\272\236\211"
+	.ascii	"fa"
+	.string	"\336I\240\261\331\243Ab\355\312\021;R\n5q\275\002\r\243a\032;\234y\261\312\213\366\312\033\270\223Hv\205\336H8\245\210\212q\233\202b!\240\313\335M\312\341\261\324]\263DKs\304\365l\334\035I\001\315\221\275\031\266^\262)\331\224l\032,,\301\262vd\256\227b\207C\352\242\344\216\234\331l6\023\3370\361y\245\234\250.j\342\320SA\323\314\3224\3615q\226Y\272\340\215\275;bA\303n7*\024\327\003\355\216O:\362\224]&\263\304\2725N\\\016\353:\221\270\335\247\244\206\2154+<\226Q\330\354U!h\233\315\206\222;(+\023\353H\264*\3264\023-K\021\345\324\254i(>\361\n+\035F\317\034gU\254aZ\033\224x5\253\321,]\350p&\215\322\224j\320\260\021\367.Z\356\356I\336[\201;\250\341<\250\220\232\221\021)H\222\024\032\003\321\004\2048(\245d7\022"
+	.ascii	"\"i\214d9\216r\210\031C\306H0$\"IAAZ9\253\007\242\001\217\212"
+	.ascii	"\034\267\344m\374_@\002H,\234\304 \372\373\035\362+\036\374\247"
+	.ascii	")A\025sU+V\275\314\314\032!\202r\203\366 \375\315\277>\235\200"
+	.ascii	"t\003R\351+\235\376,f]w2\033f\341\025\264\"\345Z;\332\266\255"
+	.ascii	"\313\021\r\002v\031dY\333\201\273\207\364\036jn\025;\3623J\365"
+	.ascii	"h\232\"GQ\004\036~\326'\246\233\331\341x[\b\261\217\352:\372"
+	.ascii	"\t\004e)B\224\216\020\bq\270\207\342\203\326\325F\261#\021\322"
+	.ascii	"\025\244I8$pU\304\2436\315\026\\\250mr\032\233\261\241\t\267"
+	.ascii	"\212\330\234\265d\234\260I\360\216\034\3167H\334\340SM\201_/"
+	.ascii	"\376\001\330\220U7\347\002\255\023\355\234\030\204, \032\005"
+	.ascii	"\215\r\030\f\004\260Y \036$\261\373\341\342!b\213NW\360\264\352"
+	.ascii	"\354oA\267\255\004\212)\264\204:\231\300\322\204"
+	.string	"AH\027\026x\022\252\024+5C&\030\035\224\236\030-0c\2348\352\271%\324\231M\231\001\220\361\030V\345\027\371+\354\374#\241I\335X\017\b\241\031-\272FF\217\2069g\n\266w{\313\366\2200kT\234\236yK\271\375\273\274r\007\250i[Hk\004\263[\303*\254\357.\270yJ\354\250\212\b|\277y\264\210B\273\353\201YRN\306\302\2437\001\345\312\002\264oF\200\313v\264\237\002Td(\3451G\231%\322\317\336\367\231\003UN\002\202\353\3505'=\013\"g\361 \313e\300\256\222\274\006/r9C\2676\331\273\227\221/\360\353/i\034\235\321xn\200A\\\351\327\236n\344\315vA\217\217)\016~\273\220\024#\354\270N>\320BY\324\205\230\003\023\340V)xE\337\222\340\227\200\227\021K\310\301]=\0317Vr\373Ey\206RvV$\030\035\335\b\334\200\006\252\243\235\272\212\r\314"
+	.string	"\347k\367d\264\324\r\217\n\250>\362\250Y\004\373\220\221\371\r\350d\305\263M)\b%p,7SD\320x\370Uo)\264\247\251\200w\213 \313\250\3457\013K\034\204\301h\301q]\261_u\343\377\016\370@\336pg\206\265\200O\3720\212\307,\314\254\250\376\366\360\267\r\367\022\301Y\"\261M"
+	.ascii	"H\211\223/L\371Yq\203\3666\234t\253\223/c\261\340?\212\315}\024"
+	.ascii	"\340\310~.\271e\264P\237s\216F7\327\222\217\034\037P\033i\350"
+	.ascii	"\250\313\311\253\375\301\032\370ur\350o,\302\301N\203\212u\212"
+	.ascii	"\304\373\215U\006"
+	.text
+	.section	.gnu.lto_.pureconst.baf1a76f36c6904e,"e",@progbits
+	.string	"(\265/\375 \236E\004"
+	.string	"\342\t!)@\255\322\030]\303\260s\373\320u\001\247a\030\006h\351\212X\243\336\272\030\362\264\304\304\034-\332\013i;^\005\376\013\025\334\0167\307\275qk\3102n\214\373\302-d\025N\341\023.\341\0212\b;\036\334A\326\340\f\276`S\260Jp\004?\270\312\300\217\002'\360\001\027p"
+	.string	"/9Ij\344\"\017\335\240\363\370\310<w\347&\316M\033\327x\3061\327.n9\252\342\224\253&\327$\036q\210\324\nXk\265"
+	.text
+	.section	.gnu.lto_.ipa_modref.baf1a76f36c6904e,"e",@progbits
+	.string	"(\265/\375`4\003\245\f"
+	.string	"\206P0-`o\226\0030\f\3030\250)\212\242(\212\242(\230\240\350\251\211\310\216\21228>&\273\257\277\355\237\224y\376\260\033\336\263\377\270w\222)\037"
+	.string	"\""
+	.string	"'"
+	.ascii	"\316\363\364\3542\317\314\373\006\\\347\331\331q\236\234\001"
+	.ascii	"J\226tN\314\363zR\3672)!\365\020\256zS\236\303\r\313\260\240"
+	.ascii	"\260\3203\244AP\017\264\264\022\243n\363\334\354@O\320\033X\360"
+	.ascii	"\347I\260\001%\267\265\256K\240e\3528\200e\034\033\252\306\272"
+	.ascii	"\f1.,\256\240\230\240t\226\323<5\353DO\321\324\345\b\b\255\003"
+	.ascii	"~<\035\316\245\243\234\250&\227$<W\336$\237\021U\236[DC@H\037"
+	.ascii	"\244\335\3509z\362\311C\255\255\252\rh\250qMS()(\324\0306\003"
+	.ascii	"p\202\241*c\007\021 \245bP\"\222\244\320\036{\006v\2002$^U\023"
+	.ascii	"\315\206g\210\311\200\024j\366e\364U\2077\306\216\333\220\016"
+	.ascii	"\334O\2765\210\270\364Y\253N,/\021\347W\206$\321\206\002\357"
+	.ascii	"\032\026G\033\307\017N\251\322\326\363\267\367+v\242\021\240"
+	.ascii	"(u\342\0339\212P\335\333\355\206\237\303\312\016\234\374\240"
+	.ascii	"bL\020\315\315\335\017\326\210[\225\314 \342h\342W3x\n\220\207"
+	.ascii	"G\331\374\003\004\231x61\273W\321\023\321H\351f\002\273\262\254"
+	.ascii	"\304\371&\021\307K\203k0\342VMU\214\301;\347\\ \246\356\f\207"
+	.ascii	"\267I\364\356O[z!e\334\257=\210\360\347\t\025\216\256\326\022"
+	.ascii	"_\032\250\027(\307A\001"
+	.text
+	.section	.gnu.lto_.lto.baf1a76f36c6904e,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_fdmSlotPublish.75.baf1a76f36c6904e,"e",@progbits
+	.string	"(\265/\375`y"
+	.string	"]\t"
+	.string	"\346\021?6@\217\322\001\233N\255-\032\336@\211^Z\321\300 \t`\205I\225\n/\250\016%/_u\355A\241\307lgEc)\022c\316\321\326l\373\202VjK6\2212\245."
+	.string	"+"
+	.string	"/"
+	.string	",\230\262a\373\031\223l\225\2532\026c!\322\225\264\354nT\214\223\236$\377\036\317\274S\351\211!\330]\247w\232\270\365\2667\2669\366\005\002\206\030\345\275C\177\204\035^!G\253\003\305\345g\253J\251\027\366\257\325\224\3754|\372\312\264>\235O?\333\234\274\265\332\225\370\\6\035\312\224\237\263\274\356\025\246\372\217\223\214"
+	.string	"v\271{#\207\326\374"
+	.string	"\312{\227j\"\264\344T\325w/\337\017`\327\324w\025\246\203<D\344k\004\366p\016\022\f\020b\350\243\260uB\261a\241\303\020=\033(r4\326\034>[\fi\332\0263\252\375\265\232*\240`qj2T\223D\361V\270\357\"\354R\250\001,\001\021"
+	.ascii	"{\3117c\032\204\f\327_\037\254\267\017\326$\203=\260\373\225"
+	.ascii	"%\272J\246*\373,\312>\327p\266!\224\227!\300\245[\264\363\t"
+	.text
+	.section	.gnu.lto_fdmSlotTake.76.baf1a76f36c6904e,"e",@progbits
+	.string	"(\265/\375`\203\001\025\017"
+	.string	"\326\234dD"
+	.string	"\221(\035 y\345\351\"\244\016V\243\004\350\330~\3225E\020\037\200\303>\240\231\223\315\245\2558=H\375\326\037\366\244\241\257\036\004x\3616\2548\250V\372{\373\027\266\352|_\346ys\030\222\266\367\2262\245R"
+	.string	"I"
+	.string	"T"
+	.string	"1\242\f\b\333&v\307\037\361\226\211M\036\036K%\253a\261\235\3101\247\247\331\373"
+	.ascii	"\371\210]\200|\\\227\233\016WM\376\351\020\301\312\305\2516|"
+	.ascii	"\241\201\030\227\224L\225\202\036\037hl\274\273\242\250NT9 s"
+	.ascii	"N+\247"
+	.string	"R\271\343m'\260\355\261u\003%F\330\234\250s\276w\022!\337\303\243E\243\350\217\344\243]bA\317}\337\035\233!\302\263\251\201aO\266w\322m\261\017\347\262\330VgVcP\315Q\265Tu\204j\250\352]\265\252\372\001t\225\242u\0344\346L\371v\314\227\301q\340\354\203\225Kn\013\235\341n|\017\311\270r\013\274\266\225\224~\316\024\302\375\313W\2500HD\317\305\375\310\260'\357\302\375v\203\302#\273\0074\264:t+(\375\264\343B\330\254/H]\n&`\234\250\016\177u\377\332nP\372\031\200\352=#\377\362\016\3610p\260\240\201V\002\211\220>%\255\302\310'\244\205\220J4\317\207E$ \222V\022\211HZ\307\233\207sY\314I\321l0\233\355\273+\250y\271`\3247IlQlck\020\324\246\340\266\274\200\220\261\346\234\347l\223\\&\002\001\226\213\307H\230\360\371\310\307l\003\037"
+	.string	"{\311\007\246+\204}P\273\303\331:\220\327Z\233\213"
+	.string	"\306x\223\021\314\320/\036\204\200\265\3019\025\035\024fA\210\005\204i\006\312"
+	.ascii	"\354ra\261\027\306\303\225\033v\317e\fB\246}\256\341\r\263\200"
+	.ascii	"z\bb\334-R\225Cs\251="
+	.text
+	.section	.gnu.lto_lockMainPID.77.baf1a76f36c6904e,"e",@progbits
+	.string	"(\265/\375`\207"
+	.string	"\025\n"
+	.string	"6\322D? \307*\035\b\235\240\304\342\\\342DPLF\026HCsL$\251\232\226\276<\262uO\2204l\242\255e\033\033\024\310\321\225q:\244\301$"
+	.string	"\344w"
+	.string	"\224\206X"
+	.string	"(\340\215\266\204l)S\n1"
+	.string	"1"
+	.string	"4"
+	.string	"\b\335\271%yx\271\032\372\242\313\205\326\354$\202|%CI\001\003\030\221$%T\251\277\256\036bI\365\242\231sZO\342\307\315\335v\203m\317\276A\366\345\334\225\255j\275\372\235\266Z\\O\260`N\324\3156\007p"
+	.string	"Nl\2076\306W\271+\264\003\310\261%~\304fbQ0\347\3742O\350\316\311\007\243%\311e\305.\343\b\254\244\320\266&"
+	.string	"%\266\016u\337\t\331\201\222\326\354\303>\206|\023k\200\364\247s>\250;\367U\241h!\257\324Ho\366(\322e\005\346x\017\021\016\020\337\247C\001n>\337E\305\306\342\343\200\031\237\227\261\007\243\003~\037\217\007\3740\343\374\256|\331\3400\315V\341\177\375@\004\206@\275\353v\330\326\265&\021"
+	.ascii	"{\345[\203\305\203:\036\035vHe\b,\266\025\177@\020\211\020d#"
+	.ascii	"\236\223\t\3375\334\211\t\0273\214q\267DU\356\312\245\366"
+	.text
+	.section	.gnu.lto_sendMotorUpdate.78.baf1a76f36c6904e,"e",@progbits
+	.string	"(\265/\375`\302"
+	.string	"\035\013"
+	.string	"\206SIA\020\347*\035\340\340\256\r\236s\n\036X=\303\313b\254d\312m\325\231\033\3113\027E\321dT\345\334\265\335\025\003\376\340K\262,\002}"
+	.string	"e(\022\250\"\200\222ND$ *\352\327_\223M\266L)6"
+	.string	"4"
+	.string	"6"
+	.string	"%\202Z\2537Mn:\345\346\232\374\323\351\001\311:\247a}r\020\256"
+	.string	"\"\b\244\212[\260\221\024x\354\013B\246v\r:\265V\357H\256\356\356\266=\2669\366#\002\373\361\324'u\247\237\217\335a\025\223\240\205\332\233=;\355,\261\317\325\371\262\277~\367\340\272\200\262\326\220\333\202Z\2433)\266\277\261\3116\360\331I}\331\372\b\037}\332YD>\354\324\026 \330\235\332a\306\302\304j\036+s\3006\302ukop\354G\317y:\312\350\252M\227\272\317\n\032\001\325*\260\257\362\225\222\017s\007)\006q<\024\022\023\336(\364\211\237\221w!\372\200\036H\324\3608\r\0161B\2427\nC\321\333\314\352\347\313\035\324L\321\204U\270\001t\227\375\345c\030\320r\027P\350\373d/AM\255\250\030"
+	.ascii	"{\3117\323b\2353\360\253R[V\016M\001G\216\302\b\311H\230\305"
+	.ascii	"e\310H\224} a\240\332\007)#\342\016\031\002t\r\307\f\301_\306"
+	.ascii	"\035\227\035\310\321\3224\rLA\001"
+	.text
+	.section	.gnu.lto_updateSensors.79.baf1a76f36c6904e,"e",@progbits
+	.string	"(\265/\375`\257\007\005%"
+	.string	":CP\016Bp\250\321p\243\213c\323\002I\017\021Q\026\003\bNT\f\221\020\252I\264\204 ,\346%\026\373-,{\314\227\215I\310\002D\362\001-D\373\355\363\322\256[\222\346\n\301\320\2432\017\366%\266I\2222\005\315"
+	.string	"\272"
+	.string	"\332"
+	.ascii	"F\346Zg\256\213\276&\372:\3675\316\\\337\314\265\371\265\355"
+	.ascii	"\353\177\275_\353\205\255\322\347\312\232\237\034b\267\203<{"
+	.ascii	",\013\235pLe\024\333\232,Tf\267\026Vd\214Y\2305`\366\215\220"
+	.ascii	".\352\245\206r\361}\220\351\324\264k\330:5o:\333\327\3423NI\347"
+	.ascii	"\216$V\222\347y\366\214\265H\033NI\247q\313\220*][\257\350X\227"
+	.ascii	"b\271\241J\347\251\244,y\236\310\236}95\215\324\335M\315\234"
+	.ascii	".\335\324t\227\215\246\310&'n\211\230\216.k\347y\372\316D\273"
+	.ascii	"\324\366\355\262\352\026%\372\002\363R\333\017\275-j\216\031"
+	.ascii	"\025$0\243M\252\b\0221\272Ew\007Xq\027\207\341<O\357\027\230"
+	.ascii	"\017\265\251\2669\330Va\343\016\005\202\224\304]\332\220V\337"
+	.ascii	"\273\275\345b\365\313UGr\334\3136\fM\363\313\235\247\361\312"
+	.ascii	"\212\246\353\b0\007\345\306MM\275\316\207\032AX\210\273\\09<"
+	.ascii	"\330\3346n\275k\226'Y\374\31493\356 \033Y\334/\261\325v^\211"
+	.ascii	"m\256\263\3145\226\271\266`\256)\230\353+s=\301\\W\231k\t\346"
+	.ascii	":\202bQ\365)R\265\227[?\370\332An\335\340k\006\271\365\202\257"
+	.ascii	"\025\344\326\t\276F\200[O\231k)s}\300\\\363\314\265\201\257\013"
+	.ascii	"|\035\3655\001s\r\365\365\323\327\003\276v2\327M_\013\370zw["
+	.ascii	"3\231\353%s\035\300\\+\231\353$s\r\340k\244\257\217\276\016\277"
+	.ascii	"\272\216\021\360\246\263?x\312\210\251!\221\247\315\264\273\200"
+	.ascii	"\343\366\034\247\024\363\374\254H\350Y\223\335\217\210f\202\224"
+	.ascii	"\273Uz\200/\235\351\266\211\023<\035ZG\355\b\255P\214\"\305\352"
+	.ascii	"W\212\233\232L'\022\222\364%\335\003\\\277\322nWR\226\025\355"
+	.ascii	"\204I\263\360\033\200[\270\206A:\200\243#\031\375H\343\350\034"
+	.ascii	"9j\032\321q\243X\327\265\321\242c]\301\020\275(w\"\334s=5+\303"
+	.ascii	"]\017\0208acJ\034\247W\326\223\356=\252\351r\251Vs3\237u\365"
+	.ascii	"\2426+N\222R\276x\371c\273y%s4;\243\311<bgc\216\304#\247]d<O"
+	.string	"\342\324o;\256\313qJq\227\336\377[vL#\356\022\202\256\371]59Oc\005{\205\222i\251\331tg\177\244\205,~A%|1\324\002\372d\004\201\300 \213' \f\022Z\303\030[-rB\256\240P\306\226\0207\374\315\270YP}(\321\201\204o\270\345\202Kk\350\223\001C\013\350c\301%\364Q\361\034\234\261\305\345\033\006\203\\>\035\222\250W\342\020F\340\020_4o\023|\301\033\374\301\355\f\032\034\374\301\032\177V\305(\007\267b\360\006\353\365S3{f1\270\232Q\360\005\207~\212f\210L\301\025\r\017\202'xO\307!*%\364[2w6\350 \016\252\206\340&\221 kacP\313\373\201K}\352\266\007\020j\032\210\206\210\021#njNQ\270\324\204\037\220p\036\235\b\227`\340\021\256\311\0027\020\365\002\307\001\"\360(?i\004\nU}\002\324\253\256e\236\0165\340O\307\001r\372"
+	.string	">?\253;hNx\200\254\205\215)\257N\241)\200\207\250Q8\245\225a\206D\002\t\023$I\222\306\360\002\021\231\342<\021@\035s\216\321\024\245\036m\006\345\023\177\317\321\300\334\266\222\311\376\207J\216\300"
+	.string	"\374S\366C\300\254`\022^XB\003(h\030L\307\224#&\341\346\236\004l\203\336\265B \215\203\306\303\0029/\256\336\231Lb8u\306\302\f\255\365>\201f\265\2573\023\320\023\351\273\253\311G\323e(\0344\253\006\346\215`\350\363\035L\2009\367\200}\221\b~.\210(\003\035d#\004\343\034;\352 \\\210\301\222N\231\244\217\210)\264\347dux\375\224\236h|Ld\234\363\314\317\n\214\350(\230\244\302/\333hB\261\331r\240\243\032(%\037\226\256\347\374\"\2404\344]\230MaP&`C\2145\013\2235n.\356\345a\273;\205\356PH\363KU\352\036\310ux\247p\302G\321\314\212\202\363L\360Hs\210|l\235\242\211"
+	.ascii	"\317_\204\351<\331\247\220G\r"
+	.text
+	.section	.gnu.lto_updateState.80.baf1a76f36c6904e,"e",@progbits
+	.string	"(\265/\375`\031\tE4"
+	.string	"\312\\H\024AP\350M\007\001;%C\020`U\346\227\213!j`\211\025\346\301\233[\373U\211\027 \211\236\354Wk\004>\364\2103C\201\352\352\266\316B4\212\244\365P\266~"
+	.ascii	"3\037\266\227\364&{\357\275\223L)0\001\024\001:\001\036\247]"
+	.ascii	"\216\333\365/\356u7/\321\353\332\200\231\036\031[\316yM\367\317"
+	.ascii	"\345\332\341\314u\235\347\260\354D\362\320\2708s\316:\210\355"
+	.ascii	"n<\256\177o \240\371-\004Z\2263*\326S6\336\206\350p\020\024\030"
+	.ascii	"\227\031\254e\216\331-a\260\236*@\335\231\216\306\233\375K"
+	.string	"\343j^\177\373!&\243\271\374Z\301z\3529\311\227\3243@<\037\277|^E\2348s^\206p\013\202f\3452oq\261\306\216-\202\247=\305\342\245\220\002I\331\310,\022\345\270\333\331\234\314\353mC\034@\316T\332\304\345\274|j!\353i/]\200\352)\353K\252\247\375v\027\362\345\225\354M/$\032\275\234\263\360\255\370\353\277\326\307\256j\212>~\333[\260-\377\265M_P\026\346\304}\353\207\262\260&\316.(\013S\372\252\264Cb\325\365|5A\025\344\234\177`G\234\242\r\220\217\270\004\301\272P&\275\2559\377\3625\206Q\nk\226l{eac\376hT\227\336\223 \230\021\0052B\362\361\246c/\260\"\306\353\207\234s\343$X\2307\320\273{Lw_u\263}\002ya9\347v`\314\231\213\301?\372~$+\342g\343\377\367\243\263\375\216\343I\321\256\245\263T`O\252P=\305\377"
+	.string	"\213\222\351\375i4\361\216N.\374l\002\270\273\305\013\354I\246\307[\304\316\366\234\305\337\352"
+	.ascii	"\330\327x3\006\233t\362\356\0315\260'\333\233\376B\354k\317\331"
+	.ascii	"\365[\335\313\"~\263nG\363S\351vqwpqs\3608\336\033\\\334S.n\r"
+	.ascii	".\356\f.\307\033\203\213"
+	.string	"\373\202\213[\312\305m!\tw\005$\334Q>\307\233B\020\367\204 n\t.n\241\213\033\312\305\375\344\342v\362\245;\002w\363n\3626\367\003~\306\233\311\305\275\344\342V\372\341\006\320\342Njq#\265\270\203-n\267\305\rlq\377\200\270[ n\037\0207\333\342^[\334j\213;mq\243-\356\377\341\306-n\367\200\341\354\330\364\3744\275\036o\231\221<\033e<\351\\\027\227\343\036\307}\216\273\233\373\031\3677\367a\026\257\330\327\355\355t>\247\375\256\177p^\271\177\341Q4\307\263\342\363U{$\365\r\322\274\371\252Y@\3554\261\263\306F}\205\367\256S)|\324+\025\307\236\307/\023\236\302;!\344#\257R%\374\004\341K\370\265\016\362\321\323\021\224$\373;F\205z\341\247\211\216b\234\376\351\241\336\357\234Eql\321\024\0228\347\372\364N\177C\257]\221/\372\321}\025#\206\352\351\323\023"
+	.ascii	"\344q\372]\363\346;F\312\351\335\316\031H\201\003CF\246\025A"
+	.ascii	"qrG\365\034j\3737\230\201|\317~\373\017\207T\026\361\323\367"
+	.ascii	"(!$[\020\237\"\310M\215\234.$g\271\333\303\363\251\250\351\331"
+	.ascii	"w\301\346\0162\314\002\334\364\b\376\300w\277e@\340\271Cx\216"
+	.ascii	"\277\345\203\332\324\332\3227k9\006M_\300\f\215Ig}\365\233\036"
+	.ascii	"\327\035\317\n\255\017\205E9H}\237\261\356\225]\314\344A\023"
+	.ascii	"\340n\021$"
+	.string	"\200se\3600=\2404\357\315\2322\375v?\216\327r>:\016{\262\343TO\037M\022Q\233p>A\330\234\215R\355{J\234`s\316\256e\210\352i\372+\235\233\2756.\374l\274\270\266(\377f\350\373\337`\3321bF\335r\036UVD,t\r2\034RU\331 b\261D-\033@\262\260T YX6\254\256th\361\240\262\032\002\257t\264\240\322\342a\205\203%\016\263\210XV\304UkG\217\357*(\024.L\264\020jY\345\030Ri\t\261tP]\t\253\206D!\224\202\316\352a5\024jee\r\205\277%\227\243\371\251\364\007\256/\342\237\001\263(dd\034\213\231yc\266?\320\234\313<\370\233\273\323m\211+\267@U\371C\306\226\227Cm\234\004+\311\321\345\365\362zQ=]\215\203\364\362\226\326p\330;\006\214\320\322\257tx{Ji\370\310\253\026\274\202\215(\375z\006o\255\r"
+	.string	"N\342:ID"
+	.string	"~"
+	.string	"\234&I\030\331'\211\bw%\375Z\025-\356{\263\366;\037\221\246h\255\340J\216im*.\372\206\367\362;\367$i\324\216\254\023|W\320\262 \337\250\355\020T\f\357\325\215\204\271^4\f\227D\024\374\246G\372\357s\274s\377\367\301O\t\025\t\303\344\217X\332\\\\\032\340\273\357\307/\035\036\370j\235\243\206\377\275\323y\004\272;L\2744N\016?\365\0356<\207O\035M\275\022\323\211\241\343Y\206\277\360\032\336\217g\030>\303\247}\244\336B\200\261\250q4e\220c\306\314\310\210$I\ni\fp\002\221\2512\326\001\021\200\301c3\023\246\2514\006\266pu\017)/uI\n[\373\005OQ\20550\201\255E6\230\004\016#\311\310h5RvJ\216\263\325\364H\220\310;\336\264\005C\267W\270\367l\312\321&\330\0058`\374\272\326\002\336o\322\033\020\335\310\216"
+	.string	"\267\246X\206\267K\036L\242\t@\026\220\n\270\2531\365\3715N\267Q\222\022M\021j$\210c\350\216*t\331\001\254)pS\3701\304\344^\031\263\027\221\235\b\247\356J\363n\344\202\223\262|\273\233k\226\331\007\002Q%\310\330!E\352\t\305\346m\320\033\302\0308\347\301[\251\267\272\036O\3330\342\335\206\\\330\217\356\007\217\366\237>\314\007\024<^\330\330>\225\364\0068\205\212\376\213\257i\b\212\355\\\007\207\n\002Nm\347\301\352{\r\377N \322\257c`\253B\322\211\b\252\351\345\230\326p\2562\366\343\3204,\035+\363\376#"
+	.ascii	"\2775w\323qt\367\343\240{\336\032\3342\276q\240\241=\314\262"
+	.ascii	"rC\210\337p\302j\030\020}\200\244\272\353Xc\301\321\206Gp\275"
+	.ascii	"\377\277h\022B\017V\301h\245|!\362<\322\257\313\270\331B\306"
+	.ascii	"*gLj$[@\377/\222\373G\310\233\300\201\241X\212\263E\321\f\304"
+	.ascii	"N\276\013\003\245\3506j"
+	.text
+	.section	.gnu.lto_simulatorPoll.81.baf1a76f36c6904e,"e",@progbits
+	.string	"(\265/\375`k\001\325\016"
+	.string	"f\234dE"
+	.string	"\221(\0358\330\031m~\334\253()|\362\376\214\265\325\n!\241Q\r\365\300\371\b+\346\215\003\315@\377\327C\031!M\365\017\n\352z)\300h6\003\022 D\003&\376\024\367\025\360(\2134!do)S\nO"
+	.string	"M"
+	.string	"T"
+	.ascii	"!\332\243M\266\215\303@\354W\310\240\220\"\307\356v\032s\323"
+	.ascii	"\265\b5M\376_\367\360\276\323\265\227\307\217/\303!\310\267\002"
+	.ascii	";\273\313\371T\2510dU\023\003\371X\240\201X"
+	.string	"k\303_\317\226/\225\271)\330]\247\367a\270\267\333\016\331>`\237&\262\231,\245'\033vJe\331\207\273\273V\030\033\246\271\273\356\r\246U\323\231\351\177\210\304p\361@\242\001\216]\227\233\035K#\302\bq\327o\377/s\374\0227a\272K\345\313r\301\303B\205\031\262]X\201Gw\334\243a\027\240=r\0176\273\252{\366\310U\220p\273\252\004'F%\bld\0369\275\367\202\312\233\277\265\252\261\201)\332\025\202?s\024)\276\214MDy\357\321\027i\217W\316\210\0333\r\250\274\311Xk\365B\225e\025m\323\0011\037fj\250R\207\267\264O$\344\275M?\343\020\245\222\221\032\344a\340`\201HW\n\215\220>\245.\002\311\307\244\003\221N:O\307\242Q\210\324\225D\"R\307\201\355\341*L\354 b&CiJS\226S}\024-!\247\252-v\200TM\265\037|\362\236;+o1\001"
+	.string	"\350,B\004R\357\002Fe\321\240x\002\033"
+	.ascii	"{\3117c\232\364\206u\326\370*\026\236\3310\002^\002~\205 \n\342"
+	.ascii	"\336\200\3250\304\261$L\277,K`\313\020E\247\b\363\260\336\323"
+	.ascii	"=\214\347.\003\277:\"`\013pIz\232\f\260\272\252\332\353\te\017"
+	.text
+	.section	.gnu.lto_udpThread.82.baf1a76f36c6904e,"e",@progbits
+	.string	"(\265/\375`X\b\3052"
+	.ascii	":Y\254\023E`\034R:\235\241\334\034\334$\024t\311\271U\342\026"
+	.ascii	"9\221\272\036\nd!\314\2478y\244\234\003\267\3200\315\016aH\212"
+	.ascii	"\372=\344`\262\217\004\330B\t\236b\352&\272n5{:G_\375\315l\311"
+	.ascii	"'\204\310\235d&\001\030\001'\001\255\217\nq\3213\n\354\rf\340"
+	.ascii	"\325\313\214\344\2531\220\331\371-\310\247\341`\257\226\033\306"
+	.ascii	"\356\242m\273d\272\312\017\330\253i{#\347}\026\256s\242\266\r"
+	.ascii	"\313\302\326\266N\005ld\257\036\313\317\220\314u\216\234\315"
+	.ascii	"\257^\030;]]\356\332\326id\347\215\326\253\354\211\353\325f\302"
+	.ascii	"\314D\302\247\316s\217\211,T\221\037\022\t\207\214\202ED!\340"
+	.ascii	"\317\307\366V5\355\213\344\367\0249\272:1^W\037\316-\233\250"
+	.ascii	"e]\242\261\013\227|5?4v\243\324\002\232\225\261\317-\313\322"
+	.ascii	"N\373\002\367'\222\033d\205\274\210\371$\273D\256/'\027J\362"
+	.ascii	"u\344\300\324\301\326\235\221\317-\217\244Ax]o\212\334\037R\222"
+	.ascii	"/\"\367\245\001\230j\200|nI$5@\346HR\226C.\233\366\266|<\371"
+	.ascii	"\334\022,\235\200\027m\323\272\275_\024!_\203\\M\227\230j\200"
+	.ascii	"\004\275\270R#7J\350\334\355W\351\265u\323\347\323,qwN\336W{"
+	.ascii	"J\005\312v\346'\311W\363\267w\241m[\276I\257\2573\2003\177\b"
+	.ascii	"3\347`\356I\bjq\264.\236\212\253\361\033\333\266\355\204\367"
+	.ascii	"\0252"
+	.string	";&Z\033\326\315\353/p[^)\017/\2779\013\265\026_\263K\n\317o\353u\234\323\254\037s5G\005M4O\343\364t<\256W?\346q2\330\266\305z\222o\346p/\370dW9\206\214\373\244\214\225\206\324}\222@\377\371\003q\343\343\203\331\016\351\253\025/\017J\267\030\2633\353:\250c\206;\214yI\275\214\340\200\222z9\251w\031\211\300\321\333\316\304\341\327\316D\302{9\017\005\327\313B\353\345\240\3642p\275\374[/\373\326\313\354\305\234{\351\3455\275\254\256\227{\275|\325\313g2b\223U\347\266\303N\3279[\037y\200\3326j\033\224\267\375k\277\227_\314\237\006\345\2731\260\215\337\330\253%\373|\016\211vx\227\2631\003\371\306\241\254\226\211k\333\0268\206Of\255\365*q\306yv\207\201=\027\376\227?\371`\036\006y1\374V\324r\026\200\306\235Yi\333\266\211\275ZLOl"
+	.ascii	"\001y/6\212W\316\300\244\356\265\222\205\240p\227\373\327\374"
+	.ascii	"\320\347\035%4\003\035z@\177\222z\200\231\270\003\315\224\200"
+	.ascii	"\200d\016bN\223.\250\357\267\261r\312\n{\250\225r\017\266\200"
+	.ascii	"\2649Wz\350\342\374\220M\336'C\204&\037\306\360=\031D\224\205"
+	.ascii	"E8\0333\222\354z4$\340\021e\236\341y\036\016\036@\210X\257\246"
+	.ascii	")\013c\242\265!5\002;\2773\202\204\t\023\353U\244>\333/\031\217"
+	.ascii	"(\023\r\351HX\031_\332\033\366\022\323\227n\263L\211\032\233"
+	.ascii	"\tM\274(\333b\354C\263\036\350+f\314\"\246\023[\311\351J\324"
+	.ascii	"'s\237\230Y\217\242\005\037\266\222\330\301n\"\253S\223\323\272"
+	.ascii	"xO\333\266m{-\306w\273\017\217\231\234JlN\323a\023\265\2229\301"
+	.ascii	"\211}\240O\344\f\364\376X\177tP\370\232\355\237\034\024\276N"
+	.ascii	"\032\003[\233\355w\005\022\266\332k\253o]@\230>l\265\037w\246"
+	.ascii	"\256+K\326\315\343n\273'\363\374,\326\333\335\347bf\375\315\341"
+	.ascii	"\260\340\223q\212\025+\326\253\267}[k~\300N\244\017\230\235\332"
+	.ascii	"b:\372R\002\374\203:NMIQA\025\2173\234\254\252\022TY\035e<9M"
+	.ascii	"\265\240\001\345\242X\303@\021\t\t*\352X\204r:R\30181\005U\243"
+	.ascii	"A\214[U\035m\034\243\326\250\303\250:R\271P\253\242\2163R'+'"
+	.ascii	"\250\224\237\026\2048\341\301\204\321\352\370\202\312\311\312"
+	.ascii	"\030\025\303\211\206\361\211\252\312\270\240\310RSG*\243\225"
+	.ascii	"\224\024\225\021\210\365\0163\236F\2258?Q\254\316b\034i\333&"
+	.ascii	"iz\332\037M\273y\214\340\006\265P\237\313\345\201\204\022l\266"
+	.ascii	"-\327\223\310(,\327\007\245\253\314H3\344\224\"W_%\205\332\007"
+	.ascii	"\206uu\004\265Z\026\205\033\266\030\003;\203\234\273u\271l "
+	.string	"\253 \257\334'\221W\326\253\3006\302\304\216\211\006\326{Rg\213\210\337\330\t\023r\0014\244\226\373\344{\230a\323&\253\257\030\264kCk\230@n\214R\242\260\225.\326\225\372ss\266\350\241\223\243u\361\202E\035\306\177\236\203\223\036]\320f\241\243\026\266\362\317\177\030\373\323\005m\002\315\251P\257\203\301\376\363\3036:7z\350\344\376&%xH\210\277\241\346\0248\324G\255\244\220\3741\275\207&\200\253\250q \305\024T\310\210\214\210\214\3144I\007`\002\23113z\020hV3I\322\001>\017\352\336\334\006\\\240\261\024\247(\206\360\241\214\217\352S\264\243\216z\217%\363\213\335D\002\350\314Mo\t\272A\310\256\0240i)k,\351rY\357\204\026\244\232\321!\360(\357\355\237{.\001\271\201\246\001h\352\247Q\253e]\355\025\017|D\262\345\346[\226H\200n0\224@#A!V\310\337\241\314\030"
+	.string	"\247_w\301\342U\332\305P;\271\204\316\221F2\n\355z\013{\361\312\274\346\304\357\343\007H\r\300\213r\326a\261\237B\353 \217\331\233V\005\304\312\200\343Wty\374g)\202\205\nlb\270\322v\341E\210\221C*\265\212[ds\230\"E\234\214zD\223\017\224\004\017\352\273B\202\243yC7 y\347\026\022\265\230\276G35v\030G\222\201kS\274|~&\224IA\377\tu62\335-X\304B\001.\rw\035=\324n\036\335\376a\216\212yd*\022\373\003(\326\210\350u\217bkcg\233\200aZ1\210(\267G\341J"
+	.ascii	"Y\f\300\022\030\371SQ\3700$\356Z8\263?\300\262\230\233\225q\262"
+	.ascii	"\323C\317\025<:\347\225|5\262.c\331u\245z\3403\372\370\210\021"
+	.ascii	"\003\306\376kV-\375$\331\030\226\361\037"
+	.text
+	.section	.gnu.lto_simThread.83.baf1a76f36c6904e,"e",@progbits
+	.string	"(\265/\375`X\005\315\""
+	.string	"&\377\337Cp\252Mc)\325\262\313\n\206@\"\315]\371\f\267\025\f\205\031\225\306*\001\nb\005`f\027\240\277u\211\013n\031\201\354f\323\001\364\316\331\325\256:\350u@9\332w\356{|\256\264\244\355\275\367\2262\245\311"
+	.string	"\274"
+	.string	"\326"
+	.ascii	"a:|\f\007i\300a\247/o\253~\230\037\235~\351\030\016\337X0\356"
+	.ascii	"\370\n\254\262\005\311\300Q[W\243\203\227\226\200\276\264\357"
+	.ascii	"r\332\007"
+	.string	"\254+VW\232u5>\260\016}\371/\007\243\332iG\306'V'\231\261 X\240u5\352l|\001\363%z\002\346\313\353\3047\333L\222\352\323\233\r\305\235fI^\253\372f\030\032\032\031Q\352\351Y\325\221\240\275--\2612r[\023\253\"G\201VF\216;\253Br\261/]\251\"b\317\264\314\312\022\253\"7S\342\317\226\344\375\022k\023\200\b$/pq\201\362\343\355\220\310\303\222V\200\374\376x\246-;\307;dD \267'\206u]m\205D\253\033\300m\007\262\235\302&\t\005\366\336\373`\241\253\371\232\022'P\2400_\332\213 \317\037\210\316\025@\345\r\363\367z\216z\250\354 \373f~\346\206?\305*X\330\013_\372,\314\227\277\027\314\216 \"Sv\315\006\213e\376\220\036`O<wa\332\273\027\366B\363\272\230\tR\243\272R\337#\374\321uo\226m\374\331$ \\Z|\261\354\034"
+	.string	"\353\004JHG\246\265\321\303\356\"\242\177\335C7\336\270\322:\305Y\337Rk[j\215\336\254O\233\265\211Z\227\2505yZ_\323\332\226\326W\260\002\311\217b\231\026h\326\365\307\032\241\325\254\\\243\365\260\337\370\177\375\332\367\301>f\247\306\3611>\301"
+	.string	"q\271\030_\314ik\007\316$\361\203\336,\377w,\t\026\033\334\305R\272H7I\253\317\261\214\312\016R\272\013\206\374\031\272\270\213tG\314A\003,\376\354\232\233\254\255BQ\245\030\305i`\315{^[\325R\255\344x\\)\373h4\260\374L\335\252@\307\354\274\027\n)s\302\341\021\332\352\226\313Q\273\200\320\3122\341%\206\307Q\2774\365P+\202Y\327\225\302\233\303Q\271\374)/\255ze\330`\2764\357\305\316\024\004\320\361\016\231\020\243\233\300\r\007\243\373\261\333)=\324\212\\\276h{\276\306\316$k{\370`/$\272Fm\266\224w\350\332:\30025\347\263E\266\332\027\250\326u\212\211\274\345-\315"
+	.ascii	"\257\374\354\232\rX[\004\t{!y\021\264\3312\373]\251-\246\r\363"
+	.ascii	"\316\t^Z\202\361\304\313\301\330\361\242d\230p\232\321\023\320"
+	.ascii	"\013\201\003\352\251\354\205\250\301\363\365\314^\b_\016\336"
+	.ascii	"\223\271\363\355`\220~\001\001\204\t\017%t>^\214\250\235O\367"
+	.ascii	"4c\347\244{\021\325\323A\310\031\252\006/J\347\203\202\212\322"
+	.ascii	"\245\236\272\356Nj\334\bR\233\272?G\260>\0375\211u\323\323T%"
+	.ascii	"\246\360R\275B\201\035\030\250L\324\254\037\177{S\304\214\212"
+	.ascii	"Kz\273\362\242\202S\272&m\271\213\273C4O\357\006=)\023X\237."
+	.ascii	"D~\362&v\333\225W\021=\272?\336\306\365\245\313$\272\271;\364"
+	.ascii	"\20438Ql7\313\366\312\213\312\251t\213\356\360W^\305\023\351"
+	.ascii	"\036\335\341\355\332\356\355>-X\350\304\363\035&zm\2674\003\364"
+	.ascii	"Rt\217.z_5\347\016\260\312\317\006e\250Q$\347\214C\004!\021\222"
+	.ascii	"\221\031M\2321\220\002\021*#\036\020X\2114M\262\034\374\023\250"
+	.ascii	"\017\221\356\225G\312\353\270?#\315K\376\314\b\207\030\256V\212"
+	.ascii	"\246\213D\304f\025\001\331\"0\3128\322\020S\"\002\242\004\215"
+	.ascii	"D\321\214\345t\003\314rJ\013\257\371\177\311\246\376M\330\257"
+	.ascii	"\036\f\355\222+i*\361\026\005\001'\2722\"v\210V\0208\363\270"
+	.ascii	"\221\312\254\313\262nX-\b\302\336WU\007\205A\342\207#4=\310I"
+	.ascii	"e\205\376\233]b\201N\212Z\013\n\366\340\017O7\"\326\037^\210"
+	.ascii	"\276s\366\213\355\004/\027\317\223\026\307\316\241gM\b\0300j"
+	.ascii	"D\345\002\2647z\317\027\274\016\026\232\306\004v\225\353i\301"
+	.ascii	"\326\340%\177\017\234\204\241\tR\361\352\372\220\316W6\177"
+	.text
+	.section	.gnu.lto_tcpThread.84.baf1a76f36c6904e,"e",@progbits
+	.string	"(\265/\375`\\\001\355\016"
+	.string	"\206\031aG"
+	.string	"\261&\035\200\321n\320oh\213(\177o4@b\001\b\0019h\2540\214\021\003pU5\017\303p\263\314\314Z\301\377 \002\001\326\216\255\2076d\355wL\251w\362\337\017\330G\031T\216\344\336\241\270\332F\366\3362\245I"
+	.string	"K"
+	.string	"O"
+	.string	"\324\340?\264\317\320=\264\317\b\302rQ\2372.\312\327h\360\360\320|\251O\tj\255\210\020\360\265\244H\026\342\\\346\313\341[\255,\321\362x\231\213\234\260Yq\203\346k\371\202\030\324Z\275\256\217\345\326n\273\202m\007\366?\004{\227?d\220\210\205\253\230\262\301\324F\017\366E/\262\320\361e\357\372"
+	.string	"\266'\2049\216\032\265\256\314~*l\342\214\260\215\262;\3661\3669\201Z_11j\005\023\230\206>\257\3420(\333\247"
+	.string	"\370\302\002\252q\331\300\"G\255`;9\260\251\242=6\350a\255\314\376\314]\250\370!\\R\332\273>\375\222\366\371\030[\330\304\\T;\223\362BJ\200\235\033X\234\311i}Q\232R\204\3267\177a\303D\207Z\275`6\373a\325\252\022\2611\240\030@\001c\305\224\347\332\031R\002\016\t!\231p \244\215\353,\220\234\214\274\001\233\267\221\244G#\020H\036D\240\036W\322m\0365)m&:\352P\350\b\210O'\\G\275\323\251\243\035`}|\321\233f\350\304BU\\\331c}\030\022l\004\257\231`\321'\205\220\006\005\007\266\221\016\267\001% p\002\221Z\346\001{\362\205\206\327c\226]\030oMj\265\213<\025\300]Q-A\307'\270\303\336\256B\212L\343\b\"\300\035\276[\022\237\nv"
+	.string	"\006\fp\316\347`\214X8\017.S\0216\207\246K\316&i1"
+	.ascii	"\277\205c\021\204\364I\344P\312\257\013?\001"
+	.text
+	.section	.gnu.lto_systemInit.85.baf1a76f36c6904e,"e",@progbits
+	.string	"(\265/\375`y\005\255!"
+	.string	"\326\272\324I\200ZN:?}\n\344\274o\255^l!&\316\202\033\t\306\326\200\305\276\024O\3501\006#::g\377a\267\325\230oR\203\376\303\272\304]\236r\364\025\034c\310\243\320bgk\231\217P\177|\366B\255\350d\020i{'\031\262"
+	.string	"\300"
+	.string	"\302"
+	.string	"pnS\227\330\235$\332\353\325\375\\\3169\367\355\352\376\361\351\341\321\235\354}\255m{\333O`\002\253\252F\030\323\223\234\253\342\326\344\245\031%\354d\177\367_\326\272~\221\033\301'k5\224h\205\236\365\030\342\226s\016\272\331=\364\346\356\003\316\233\271\367\2347\033w\267=\231#\337\311\2301\311[\316\271w\277\216\217\203\336\234f\356Z\334\377\021I<N\243\317b\225\005\364\303\n\313\336\\\375\314A^\335\324A\026s\273\234\263\0169es}s\030\326Ta\242\203\224\312].\261\227\335R!\243\254\275\311\220sn{D\312x\347\274\273\237\272[L\267\331\001G,\206\026\223\360\030&r\023hA\271q\\\2660\311\001Y\\\246\341\300\220\245\324%RY\033B\213D"
+	.ascii	"\224cK)\003ZB\356\365\n\272\356\336,\b\2262Z\276H\3314\215\300"
+	.ascii	"\366\376$\207\242\016\347\223\217r\224v(\037\214\216\216\316"
+	.ascii	"\020H\366G\335uR\336\200s3^b\013\260\335$JX%r\031u\211\3756 "
+	.ascii	"h\371Ig\037\355M\222\372<\372\204\317w\3364\247\260\275\231\201"
+	.ascii	"\262q\255c\373K\322n\241+I\321\026n\376\320\342\204\0067\273"
+	.ascii	"\231\234\354Z\332\233\233\324%6j\237<\222!\2323\324\217\375#"
+	.ascii	"7[\321\347q\263\205C\373\343\315\376\360\274)\364\356\026.\354"
+	.ascii	"\217=`-\031>\367&\f\030\343\023\363\347\336Ku\357\315\312p\334"
+	.ascii	"\020-\224%\372\334\035%\232\23668j\n-\276\214\315J\350}\006\326"
+	.ascii	"O\341\336\214x\313\376\330sw\224c.X\236\373\344\317`*\0019b\240"
+	.ascii	"\305sUadjeI\301\006\275\317v\274\325\306\340\031\n\272\\\241"
+	.ascii	"\305c5\270\371\344\305\340\2550o\303YZxk\353\264\201q\330\037"
+	.ascii	"y\356\255\244\275\271\031O\314u)\177\362^\272`\257#\373\343\317"
+	.ascii	"\335Q\256-"
+	.string	"\215\227\310e\013\376B\213?\265\307\221!\323e^\257~q\332[@\354\313\314\336>\333\227/\260\016\f\206\301\316\2336\311\221\214\003\373\333\215\303\260\017\373\243\275H7\030T\301@\320\234\213\017KC5e\241\246B\325\267\n\tt\316\322\002\036\217\267\016\215\200-@\354\326\037\360w\240#\360 \360 \360*H\210\220\323L\300_\323\016\004\021\322.\b\334\t5\245KA\247\235\032\\\203\352\222o\270b\007\374=X\233~C\024\274\366\260\201\310\350\303\t]\003\251AUMwj\312\244\006G\250PZw\351\352K\325\241\002\315\343\361\326\037\260(\311)]\205.\204%x\326T\275\255\304\363 \242(DoMS\250\276\265\007\374\371\234zJ\252\260\307\333uPE\252\366\326`P\355\351\222\371\267\313D\326\022\352F\365\220\375\223N\363Oj\316\356'6OqW\256\226SM\320\214\340\264\261F[\374\332\022\316\315"
+	.string	"\r\030\350\365\352"
+	.string	"j\214J\316g\250A0\310\230c\204F\002\t&\210\302\244i\003\240\002\021\241\252;\021\020-\224\220i\224Lk\370\262\f\333v6\331\276\233\b?\217'"
+	.string	"\214\332M>\215bAF\220\200\225\0235\211\270Z\366\263\235e\216,\006\035\365o<\213]\001y\362\301\023}w\032\252\242d\302\303)a4*\2345GCM\033m\370\255\356\025\004\213i\273Y\n\323\264\266\244\254\225\336w\016\364\225\201\260\342"
+	.ascii	"\013_\305\360Z\370\366\027(\310\262\304\361?\333=e\262\002\243"
+	.ascii	"Y\354\037\325\024CT\227_\222q\215B|@\212\302\024%{,\310\240n"
+	.ascii	"\220\320<\240;\227!\324\370\365\351a\332\033\205\312\032\331"
+	.ascii	"P=\211\256M\275{T\247\236\320\276\212\215\232\277+\361\341\322"
+	.ascii	"\237\222@:\356$\311\017\235\266\021\222\260\242\301w\230?"
+	.text
+	.section	.gnu.lto_systemReset.86.baf1a76f36c6904e,"e",@progbits
+	.string	"(\265/\375`\226"
+	.string	"E\n"
+	.string	"&\223F> \005)\035`\211\363\332\007"
+	.string	"@\t@\360\220=~Ty\006hK3\232\216\310\300\247\272\332\347\332f\020\004\330\324o\310\022\227\370\343\303K\210Q\n\264\023\243\252\260 RVml\266eJ\0014"
+	.string	"4"
+	.string	"4"
+	.string	"\270\233\354"
+	.string	"\006\324Z\222\023Pk\263\347\305\366Cn\331>\237\265\324\363\220\214\320n\265V*Y\336\372\266|/\b\242\326\352\205\231\234\334\362\266\017l?\330g\b\023f'\306\006\2629\203\326\257\t\355\205\323t\270\341\323c@\204&|\332\254\217=\314\227\271\305\317\210\033_\322e\317\\+W\354\013T\251b\177\275_\237`\003\322e\321>\347\253SZ\351`\213\245\210\326\327\350.m\323i\024r\332q<T*\325}^N\331\030\233A\361U\235o\363\033\225\357\342\325\267\207}\372_\367\031F\020\275\320\233\310Xyb\310\nK\005>\221$*\"(\250\350\241@\223H7R\246\025=\201!%\215\374qx \025\277\017\244!\333\006\3716X\205\333\027\030\001j\267\361\025\021"
+	.string	"zei\233\311;\323*\360\003\215Q\205pk\323,\266\345a\037XM)\247:j5x.\355\302\250+X\3622\004f"
+	.ascii	"\n"
+	.text
+	.section	.gnu.lto_systemResetToBootloader.87.baf1a76f36c6904e,"e",@progbits
+	.string	"(\265/\375`\242"
+	.string	"\315\n"
+	.string	"\246\023JC\020\311*\035"
+	.string	"\370\303>M"
+	.string	"\262\"\006\361\232?\252\001\366\003\267&!w_cGe\316%\274\324\215~\006\306\225@h\271\277/F!a4\n\207\312\221E\b\223\322\346W \230]DgX\033[o\231R6"
+	.string	"6"
+	.string	"7"
+	.string	"\016ka\366z-B\2550\267\013\025\202t@\300\3669F\331\022\036k\3257h\275\310l\265\326\031\005\034\365E\371\336MF\255\325\273\222\231\271\343mC\330\346\260o\021\224\273\224\005\036\270j,{\363f}\004\240]\361\003)\276\270Tip\231\023\227\366ie\277\362\r\034dBL\005\232*\246\354Xjc"
+	.string	"\373\f5\002\260\277\336\257\037\"\024\252\215\246\212)w\366\263/\203\320F\214\027\253\246\263>\t\367hw\"O\313e_\340\215H$\356\362Q\302\\,\030\215_\342\374\004WP\362\007\330D\367\253K?\226\370\274\222\216\232\204\224jPP\350\201\236\307\210\311\013\301\023\030\212\260\350\323\001\332\370\230\2417\372\272p\236\220:\323\024}\340\374xLQ\274o\206\224~\223\263\361\375\260\024\267C\002\022"
+	.ascii	"{\345\373X\033m\263cgZ\005~\2401\252\020nm\232\305\266<\354\003"
+	.ascii	"\253)\345TG\255\006\317\245]\030u\005K^\206\300\f@\001"
+	.text
+	.section	.gnu.lto_timerInit.88.baf1a76f36c6904e,"e",@progbits
+	.string	"(\265/\375`\002"
+	.string	"\005\007"
+	.string	"\342\21405`O\322\0010\251\002"
+	.string	"\002"
+	.string	"\026R\214\r\365\300\356\273P\227!\1773\006\201?\303\354UD\016\261\311\026e\362H\227\263\021,\366\340\001\215\322\327\250\021\"wJ\001~\357\305\n\304y\200\324\247\212\016\003\366\274\205\006\016\203F*\002v\242\202\252\316G=pB\037\201-\t\nj\264,\250\033m/m\212 b\266\214\324\260\306\371'\024\366\301M*\214\360\311\"\200C\r>\331\027\030\356\231\335\n\314\266\221\230\255a.C\354K\233\";\265\344,.\273\03632\273M*$\266\277\361e\267\\\033\331\247\214:P^vWS\344\327\335\345\177t\201,\204\335\001(\354\256]\026\372\270\363\266\013l'\330\006\t\n"
+	.ascii	"{\3117c:\363\206\271\241?y\256\347BN\026\354x\031\002\\\272E"
+	.ascii	";\237"
+	.text
+	.section	.gnu.lto_timerStart.89.baf1a76f36c6904e,"e",@progbits
+	.string	"(\265/\375 \305E\005"
+	.string	"2\t#-`e\323\001H\301\b\"\221\337~2^n(<a"
+	.string	"\236<\377\267\005\265{\363\001\210H\022\212\326\020\201X:^\203)\274\211z\357\224\002\266$BqHhv-f\225\351\243Q9\324\232\021\225\2241\31055\303\260\251\323\267\217\036%\211\023\373\333`\274\330\017l\364l\250\236\213"
+	.string	"v+\001\245\r\t@\032\333\237\254\331\243\177\231\375\207C\351\220vW#\346\332\241\346\177s\002\327m\207\003\303\356\032r\235\345\216\267]\260-m3\002\t"
+	.ascii	"{\3117\323\342\234\031\001\276\3345\234,\204\3612\004\270t\213"
+	.ascii	"v>\001"
+	.text
+	.section	.gnu.lto_failureMode.90.baf1a76f36c6904e,"e",@progbits
+	.string	"(\265/\375`^"
+	.string	"-\t"
+	.string	"\346QA90\221\322\001 F\312b\023a\344,\252<\271T\207"
+	.string	"?\302\242\246\357P/\027\0322\033\330pa\374\037\305\246\221\tD\337)C\303:\307\265\366\364\f\233s\326\222\275\367N)-"
+	.string	"1"
+	.string	"/"
+	.string	"\247\376l\231\207\261}\313J\006J\315\356V\031b\031\277O\031?\337"
+	.string	"\366\331q\271\275`\217\234\321\356:\272^\0347\275\355\221m\222m\225Tc\346\304\022\264/\373\343\254,\217\241\331\335\270\261\331\031}\021\361\330~\264?r\222\357\262\013\003\354~\244\270\354\206\005\256\235S\320?\332\351\274\200\026\276\004\375)\301\317\335])A\333Z\214\362\341MV\001\261\335\326]\024\235\326\001\301\251]a\021\357\362K\276\301x\3140$\313\016YQ\202\330\017\336N\003\240P(\324\300\235\272\004\316[A\240J\016\f\037\356\324\245\246M\"\204\005\222BUq\017^IU#P\245T5y\023U\004r'\301yU\325u^\365\3306'\013"
+	.ascii	"~\311\005\346d\344* [\356], VS\202{q;m\266\f\334\270Bq\002"
+	.text
+	.section	.gnu.lto_indicateFailure.91.baf1a76f36c6904e,"e",@progbits
+	.string	"(\265/\375`x"
+	.string	"m\n"
+	.string	"\266\323JB \307*\035\220\b\"\002\301\216\236"
+	.string	"\324,{\035t\361)8\320`\212\273\241"
+	.string	"\306\006\306\024\233F\330H\200\tN\260V\330"
+	.string	"#\220"
+	.string	"*\2548\224*D\013\341\341D+4\002J\242\203mk\204\354\235R3"
+	.string	"5"
+	.string	"9"
+	.string	"Us\256;\003\346\334\366\005\3149\217\266\203\227\261\375lfR\340\301\356V\272\362\361s\364/\340\033\362\325\372\314\200v\327\223|\241\334\364\266\035l\233l+\b\333\356\256)\314\276\354\237[\203K\003\226\201\335\223\b\020\266\306!`\261}\216\355Y:\301\002\332\356z,\2419\347O\373"
+	.string	"\036`\274\214\345\315n\312\001\332n\351q\252\372\351\f\246\276\260\212 \030VN\271\337\226\302\354\361R\033\241$\316\314I?\340\004T\n\261]\327\311\225\306\005\2028g\207\210\314\223\236\fZj%\264e\227\255IU\354\007N\030=t\235N\247\343\033\201\031$\216n\"\004I\035\210\3123\221\272\n\213P\367\205+S\311\273\210\020Q+\220B\364\276\324\027r\276\021x\332,\372\204604\252\370}\204\236XQ%\357TEa\013"
+	.ascii	"\3369\312^\222\310\330\013?k\202\263;\256\241\2550^P\345\b\250"
+	.ascii	"\333\340Z^\b\223\f"
+	.text
+	.section	.gnu.lto_nanos64_real.92.baf1a76f36c6904e,"e",@progbits
+	.string	"(\265/\375`\227\001%\017"
+	.string	"\006\035eD"
+	.string	"\221(\035\257I\377\267\246\306eVy\003FS)\032\021c\217<'\221\t\314\375\037\215\370\007\220\304\177\365\303(k_\275\265\370QW\345 \322\377\027vtN\205\257\257\274F\253\312\366m\237\020\262\267\224)\005Q"
+	.string	"J"
+	.string	"Q"
+	.ascii	"\217\231\003\373K\352\037\352\353\2714%Z`\310v]\003\036\335q"
+	.ascii	"\217\337\217\377\341 RV}|+)\332\214\213\013\"j\354~\235\277{"
+	.ascii	"h\217\334\001h\217\252\341\252\247\312\177\354\321%\307\212\026"
+	.ascii	"\312\352\271-\330]g\013%\345\326\333"
+	.string	"\026`\273\200\235\006\002\004n\233(\344[\366\300\341\262!\263\240+\373[\245f\260\017WUl\247?0\355\201\351\016Ls4\275\201i\rLs\232\336`Z\203\351\250i\b\323\n\323\251\351w@Pq\362\362\220\232\355\236\314n\354\213\210\242\345\337o\247\034'\201\3627<\032D\312\267\036}\222\366\270)\002\026XTUM\357\275\240FU\026%\217\205\240\202\304\200\235\370\214\0161\273NPa\227\025 U\365\236\213I\316|MM\032\236\314\216\360\230\210\333\335\003W\220\227\225W\b\030+g\346\3620\217\221\270V\246S\232D\244\301\003\006\016\272\023\250\2444r\352$\204FD\035I\311\324\211\204x4\001T\352N\243Q\251\343|{\270\252\362\321\020\226\232\030\005w1(\220\301\344\314\036\375\350\275\026\035\325\324\243Q\306\343\300Q\215v6\312\321\217\024&B2\033\375\f\013\247\232M9\335d\304\210\374\021\001\037"
+	.ascii	"{\311'c\232\211\f\213&\373\260dI\365\206\320\306j \205c6B\301"
+	.ascii	"\254 ?\260\034\020\210\260m&\321y\013+\301\202\360\262\020D;"
+	.ascii	"=c\033z\254\263\371\373-\341\302H]\315\242\302\330\222T\343\340"
+	.ascii	"n\251\026\210\223b\272&\031"
+	.text
+	.section	.gnu.lto_micros64_real.93.baf1a76f36c6904e,"e",@progbits
+	.string	"(\265/\375`\304\0015\020"
+	.string	"\306\336kF\340\262(\035\244C)\273K"
+	.string	"\034\211\356\345\203\356\026\314(y\013\240(X\377\031\216\021E\333\020\273\321\307\306\b#|\3674KG\027\216\023\246\002)\341v`\216l\032\026B\2012\r\360\327\254\375O\032\331[\312\224\002U"
+	.string	"P"
+	.string	"["
+	.string	"\336o\253\3702\217l~\243r/\345\333\275\204\\\320\340\230\355\276\034x4\267=~\001\370&~B\305+\001\274\0171\032\f\037\f9=v=\316\336C\264\307\355 \332\243z\370\312s\305\277\354p\347S\021\203ay\202\026\354\2563\006\023s\353m\027\260\235\300\316T\336\3628\227\235l1\004\267Q(\344c\016\371\231\371\230]P\026\333cI\355`\037\256\316\330N\237`\332\004\323%\230&\301\364\b\246E\232\016\301\364\246i\020Lk0\035a\032jZa:5}\020\b:\\dJT\310\261\353\362\375\330\236\270C\363 \335T\204\247\005\313_q\026)~\210G\253N\362\261G\377D{\004\351s@DM\325dZd<\003\211\r64\214\330\211\2616\311\367\245\260\260\013\033"
+	.string	"5\352\273\232\226\374\254\n5\3220\271l\245J\340\206\3155Uyt3;\302e\254mw\025\\Q7=2(l`\371\005(\257t\t\252\301\003\006\016\270\227\312\304\225zq\022V)\026W\342B\341P#nMP\271\270W\253\345\342F\336\036\256\316\234t\004\246-N\201\273\034Hf8\371\331\244'}W\003\266#fwm\240\244&M\235\256\206\244\232\226T\363\351D\214tS\222\212\360\210t\024R\221\n\370\321Y\275\b\351g\004\" p\002\2312\332\003{\362\211M\327\3210\177\332\327\215\375\335\216V\35308\315\203E\321\257\274;~%$\210i\354F\346pit\261\25577Qt\344\300\217\207w\"\343N?\306W\315\235\267mn\030\333\022G\221"
+	.ascii	"\223O\336\311:\r\020I1]\217\f"
+	.text
+	.section	.gnu.lto_millis64_real.94.baf1a76f36c6904e,"e",@progbits
+	.string	"(\265/\375`\304\0015\020"
+	.string	"\206^kF\340\222*\035\252\262\310dtB\013\006\362\250\335w\253\224\001J\367\022C!\265\247$\316\215\234\216\242\031\275\221w3\314\201J5\225>\213A\216\2163\346\350\300\034\3310\006B\002D\354\006\013\303\265%\215\354-eJ\001U"
+	.string	"P"
+	.string	"Y"
+	.ascii	"\277\355\362m\366\324\356\342:\330\372\374P8,Xz\334\346D9pi\257"
+	.ascii	"\273\374\004\340\227\270\t\227_\002@\017*\234\013\036\027`j\346"
+	.ascii	"\004=\203\017\341.\273\203p\227\333\341\257\353\313\277\355q"
+	.ascii	"&\3141K\201]7\013\346\234\326Y\212\312\275\267m\300v\002[I\001"
+	.ascii	"\372\227\333R\335\f\301\355\025\005\375\314!\241\214\216\233"
+	.ascii	"\205\205\331 L\227\203\3758w\305\266Z\024\325\241\250\006E\365"
+	.ascii	"'\252=Q\335Y5'\252\273Uo\242\232\213j\031\325q\325\033\325\272"
+	.ascii	"\352\203@\370qB#\361\2321\347I\330c\322\2203,\007\003+B\263\342"
+	.ascii	"\344\247\270\212\226\017\342\322\245\224~v\351\247\270\313\315"
+	.ascii	"\036\346\203\\]\216&{q\f#4\324\310 bFf\332$a\210\242\302\234"
+	.ascii	"1\002q\345\376k\221i\350\335\2702\206\311m\246\335\0026j_\335"
+	.ascii	"\305\361\335\354\b\267\235\2729\247\202\357\310\245\206v\242"
+	.ascii	"\026\323\320]+\226\272d\324\340\001\003\007\036\253d\242\"\261"
+	.ascii	"<\t&\322\311+Q\255\274\321\210Q\023J*\217\205B\251<\0178\037"
+	.ascii	"\347\256\210v$\2662\267\342\234\033Hn/\032:\264\242\375'#\266"
+	.ascii	"\303\001@\033Z\215\371Z>\313-h\271\033_\b\317v\373Y\021\232\316"
+	.ascii	"z8\333\331\001>bL-8{\030\233\355\002# `\2021e\264\007{\362\211"
+	.ascii	"M\327\3210\177\332\327\215\375n\017\243\260j\035\006\247y\260"
+	.ascii	"(\372\225\373\016^\t\001\"\032\273\2209\\\032]l\353\315M\024"
+	.ascii	"\0359\360\343\302\203\310\200\323\207\361\265\346\316\30767\214"
+	.ascii	"m\211\243H\200\311'\363dm\003DRL\327#\003"
+	.text
+	.section	.gnu.lto_micros64.95.baf1a76f36c6904e,"e",@progbits
+	.string	"(\265/\375`l\001\305\016"
+	.string	"\346\233aC"
+	.string	"\221(\035\230\003\215\204\341\026\345\0058GJ\310A>\307ZY\373)\315\214>?\243D\007\203X\030\355\367\007\346\310*\253\356g\215\326\177\306\024_\034@D41\236XX|\3760\266_\362\311&I\246\024N"
+	.string	"G"
+	.string	"L"
+	.string	"5\252\034\237F\036\021&\272\203k%D+\306\357\200a7\315\260f1\213\223\216\276!Ci\204\201\225\017\032R\256\030\277\255\237\007d\206\232\003d\206/\341\221sT\033\345\0051\335\252K!93\nb\214\315.\305\203{\267-\3206\244M-\351\256\363d\301\260\260L'\265\037)O\2425\026\257\3226\353\361\311\355\300,\007f7XV\003\263\032\314f`6\203Y\210e1,{\230M,k"
+	.ascii	"\236\224\212\224\312(\253\0309\274vD\026|9\341\223\237\231oO"
+	.ascii	"\002\346jd\236\327\356\026NDv\370\314\315\2450\2750\214\252$"
+	.ascii	"\324\245.\231av\215\207\035\376-\\\353\357\034\2739\024\246\324"
+	.ascii	"\205_\200\r\317\317\233k\325-\354bT\233\250\205O\2723\254?\231"
+	.ascii	"\241\037\342\315\320\341\225\362U-[\n&\001\025@%\357\bH\203\007"
+	.ascii	"\f\034l\"\022\b!\021\321V\022A\344\263\215\204L6\220\217\202"
+	.ascii	"&\220\2046\021\b\024\3328_4\026\257\342\371G\351\246r\356\251"
+	.ascii	"\312&\024\020/\256\033\250/\266\t^/\034\030b,\021\330\234\263"
+	.ascii	"y&\246[q\255\316e \360h\254\3604\217\341.\3075\017  P\002A\352"
+	.ascii	"\262\016{\362\2111\315 \031\236\326\"\351hZ\235mo\376^\304\312"
+	.ascii	"0\360C\260fK\204\312cU\027 \213\200\205FE\213\207\021~\236g\\"
+	.ascii	"\315b\363h\f\r\237g;\213,\264\206-gq\376\004\210\021\213\013"
+	.ascii	"\2336\t\235\f"
+	.text
+	.section	.gnu.lto_millis64.96.baf1a76f36c6904e,"e",@progbits
+	.string	"(\265/\375`l\001\305\016"
+	.string	"\346\233aC"
+	.string	"\221(\035p\263\245;\255?\255\330\240\r\242\342\207\231\3672\004\331g\304\207mL\2012\2351d\220\354\377M~\261\251\225I}#Z\377\031S|q"
+	.string	"\021\321\304xba\361\371t`\266\021B6I2\245O"
+	.string	"G"
+	.string	"K"
+	.string	"5K9F\215"
+	.ascii	"D\230h\0173\247\025W\214)\004\206\3456\303\232\205[\234tt\016"
+	.ascii	"\032J#\016\234PlP\315\304\230\342\2322\201\314p\263\200\314\360"
+	.ascii	"&<r\216j\263\230A\f\212\214\227Brj\013b\214M/\345\203{\2675\320"
+	.ascii	"6\244\315-i\257\363l\301\350h\231NjS\244|\211\326X\274J\333\254"
+	.ascii	"\307(\267\003\263\034\230\335`Y\r\314n0\253\301l\006\263\020"
+	.ascii	"\313bX\3660\233X\326\001<0H\250X\366db\354\360\352\021[\260F"
+	.ascii	"\n\243\374\314|{\022\356^\264\347\267\273\245\013\221\035^\273"
+	.ascii	"\273\025\246\030\226Q\326\204\256\272\312\f\263k>\354\360o\351"
+	.ascii	"\\\177\347\330\335\2510\2510\374\003n|~\336\235\253v\341\027"
+	.ascii	"\243\372D/|\322\236a\375\311\f\375\220\317\306\216\257\224\257"
+	.ascii	"n\331V0\t\026@%\357\b\210\003\b\r\036p\"\222\b!\021\021W\"A\344"
+	.ascii	"\303\215\204L8\220\217\202(\220\2048\021\b\024\3428\251h,^\305"
+	.ascii	"\363\217\322M\345\334S\226;\0208D\270\3608\255b\253\340\365r"
+	.ascii	"\311\020c\251\300\346\234\315\265\030\024\231\316\3259\215\004"
+	.ascii	"\337\313\312\247\371\f{9\256y  P\002A\352\262\016{\362\2111\315"
+	.ascii	" \031\236\326\"\351hZ\235mo\376^\304\3120\360C\260fK\204\312"
+	.ascii	"cU\027 \213\200\205FE\213\207\021~\236g\\\315b\363h\f\r\237g"
+	.ascii	";\213,\264\206-gq\376\004\210\021\213\013\2336\t\235\f"
+	.text
+	.section	.gnu.lto_micros.97.baf1a76f36c6904e,"e",@progbits
+	.string	"(\265/\375 \374\325\006"
+	.string	"2\r03`M\323\001\203\022P\326Dfd)\013\245=\322JV\022\330\2076\004F\032Q\007l\253ta\260\026\300\233\234\216b\341\244\272\206\204\314\372\"\262\267\224)\005\276L\n\f\b\013\260\3024DK\005!\034,\017\360\022%\340$\231\212\300DXQT\204\321\266W\216S\tS\215\257N\323\263Y\301\362\343\227\366\004E>\273\026hh\364\262\267+u\303\276\333\335\265rl\247]\246\377\\g\344&\236\335\213\217\312\226<\222\016\333\031;\362=\376\221\261uP\201i\004\035\221MH\312\356\006\245\013@\177\356\001\320\237r\334zZ\376A\236pb\201\222i\327\023\300`w\235\231\206q\353m\017\330\236lg\004\b"
+	.ascii	"{\311'\323\342\2533\236\206\360\350\232\222\205\310\303]1\265"
+	.ascii	"\223\f"
+	.text
+	.section	.gnu.lto_millis.98.baf1a76f36c6904e,"e",@progbits
+	.string	"(\265/\375 \374\325\006"
+	.string	"\362\214/3`M\323\001\203\022\204d^~\004)\013\245=\322JV\022x\0057\004F\032Q\007l\253ta\260\026\300\233\234\216b\341\244\272\206\204\314\372\"\262\267\224)\005\276L\n\f\b\013\260\3024DK\005!\034,\017\360\022%\340$\231\212\300DXQT\204\321\266W\216S\tS\215\257N\323\263Y\301\362\343\227\366\004E>\273\026hh\364\262\267+u\303\276[\345\330N\273L\377\271N\311O<\273\027\037\2255y$\035\2663v\344{\374#c\353\240\002\323\b:#\233\220\224\335\rJ\027\200\376\334\003\240?\345\270\365\264\374\203<\001\305B$\323\256'\200\301\356:3\r\343\326\333\036\260=\331\316\b\t"
+	.ascii	"{\311'\323\342\2533\236\206\360\\\303!G\274,\004\031\356\212"
+	.ascii	"\251\235d"
+	.text
+	.section	.gnu.lto_microsleep.99.baf1a76f36c6904e,"e",@progbits
+	.string	"(\265/\375`\276\001\365\020"
+	.string	"\306 sF\320\362&\035R\225}v\347\017\347E\222\0367k\336\307\243\213\017KGD\354&0\346^\022S\265~\312\203j\210\f\214>\372\230\270\201\366\003\003\354\f\031\273\201L\311S\315\373"
+	.string	"\351\345\301\314\3217\330\330{K\231R_"
+	.string	"Y"
+	.string	"_"
+	.string	"\2734\003\336B\016M. \036\276\227\304C\273\354\033\247\355\354"
+	.ascii	"\036\243\032!\036\273\273\351\007k\272\016\343\323t\371\004p"
+	.ascii	"\236^JC1\356\220\204\347\346\221&\337\323Z\013\031#\261\231\207"
+	.ascii	"\340'\005\210TL&\365\335\037\n\034\034\235\322P\354\346\t\242"
+	.ascii	"`w\235\260\330\206\033\344\266+\330F\261S\003\246q\2513\373("
+	.ascii	"HF!\2542\373@\277\bL\307\230\2060\375^Z5\235\232\376\3101\364"
+	.ascii	"p:\230"
+	.string	"\270\333\324\330\315\020\345c\217 \f\022\257\375\366\3379e\323\036\344z\r\206d\221\366\034N\360\320h\332\325P\340\320\007B\016\277$O\373>\377q\035\310\202\001\354\352\364\274\b/\345\256I6jCOg>\371\323\354\351\230d\262\207G\362+\336\251B`\366\nK\036\366\364GI*\216f\224\313\267\273\253:S;\302\273\226\024\2029\245\252\276\346\007\310\322m\024\257\251\2471\361\312(\213\3505\325\331\354\250\371q\227h\257\336\271\350\322\356\242h\016\026O\036|\236b2\312\001/\255TQ\275PxV9i\360\200\201\203\255\245Za\245\2646\t,)-\233\n\353e;1\361j\202\212\265\265V+\326\226\242\355U\346\0059\013\325\024\243/\303\274]\235\004M5\021Pg\376\325E\216lFT\231\337]\024\243\226\0049%\371D-\027\215\360\035#\036F\205D\027:\004H\033BJ<\fjj\007\252D\037"
+	.ascii	"{\311\027\323\360R=\340\273\302va\017\013k\n\346\241\220\202"
+	.ascii	"\213S\005fA\t\026\343lu\031\254\266a\333\210h\263a\027a\210K"
+	.ascii	"\230\273\212\221\317\313H\253\3054H\021\252pp/\234\242\022\334"
+	.ascii	"\033\337\237\b\202\2120\3505\233\301\332Y\006"
+	.text
+	.section	.gnu.lto_delayMicroseconds.100.baf1a76f36c6904e,"e",@progbits
+	.string	"(\265/\375`c"
+	.string	"E\t"
+	.string	"\346\322A90\305*\035\300\263\372\344\006O\2456(\235\2126\310\321\f\007\214\214Q\210\320\034\n\341\0255\364\f\260\261P\207\252&\024_\334\030\003\035\230U\207\022yJP\337\376\336R\246\0240"
+	.string	"/"
+	.string	"0"
+	.string	"\220\363\201\313\341\273\300\345\320\233\275\362Nc\tZ2\n\021\331\356F\315\370\366\334\374\177\\\303\255LO\314\301\356:\271U\305\255\267]`\333\300\276\006\273V\226}\327\0175\3752\255\231\316L?\363Z"
+	.string	"\236\242\262\253\232\005X\0304\341\330\330~\332\357\270\307v\227\2045\273\027#\257\335\256\343\230y\252O;)\224\324\253\352S'\250\234\331\007y\210K\374\rG\370\225\347\016}\277.\207\251\032\013\250\327\200\230\212$\305r\312\231\335\231R1\354\277\335\243R\032\344IX@P\210\244\020\203\366!\305\207\206\217C\004i\243\350\341X\004\021\322\"I$\322\342\246\333\277U\2263\261\026\330IQ\306\344S{T\312s\346L\250\311\001\013"
+	.ascii	"{\311'c\372\200\032\016\316\336\244\2622\246\005\006f]\302\""
+	.ascii	"V\243\301]^\264\223\f"
+	.text
+	.section	.gnu.lto_delayMicroseconds_real.101.baf1a76f36c6904e,"e",@progbits
+	.string	"(\265/\375`\016"
+	.string	"5\007"
+	.string	"\022\21624Po\322\001d/\335Y]\342\214#%=c\331`A\003TS\225\2233D\022ce\022\021RF\353]m"
+	.string	""
+	.string	"D\0340\206\332?\013tC\366\023\262\267L)\037\211lg\243\300\220\260\020/O\203\305\271\"\204\003\347!v\254O\334hZEx\254xU\225\0253\333\r\377B\275\220:\316\342]\024f\276v\202\"\255\265\200T\3420^\326nY\276\216\326\360\377\373B\255GvB(\352\254\222\362kt-\347&\224\220L[gk\021\217`\036U\024\363s\230\234\374\233A\343\305\223\306\002\224'\350"
+	.string	"\312S\261v\305\333\307\007D\245\214\022\226\377\361y\030sb\265I\214\321@\231\023"
+	.string	"\341\177S\003m\270\317m\t\332\036\264\005\t\t"
+	.string	"{\311'cZ\366\f\003g\237\301\274K"
+	.ascii	"\304j\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_delay.102.baf1a76f36c6904e,"e",@progbits
+	.string	"(\265/\375`\027\001E\r"
+	.string	"VY[D\020\221\223\016;U06\216r\030\256\f\2518\216/6l\215*\300\264p\377\035\214\337\301\\\211\335\270\rB\r\327|\036\211\225Q(\340\247*7\311\235\335\204\327@\300\b\260\020\336\252TWk\204\354-eJ\001I"
+	.string	"G"
+	.string	"D"
+	.string	"\266q\257e\t\274h8\211\251\331\335KG\030\246\366\b55\277\300\207\031\\'z\204\326\b\245DG7\202\037\250\323\314K\317\r\335\226\320%\345\372\322\031\324PIq]\312\323R\260\273N\256\363pW\267\035\301v\002\373#\0012\335U^\354\242\244p\354\027gL\234\364\333\177\311\035\333\373\n\355$\f"
+	.string	"\226\306\276C\315\013\207\323\256g\340\321\b6\217\3666O\373)\256B;\f\2119\273\"H\300\330\365\016\370\332<z>\240z\204\027P=Zs\246\020\337\006ww!'-\232\223T6\250B\236\363Y\230\\>\023\225\2111\352\324U\332\026.\3449K\363d\002\361m*\262=Q*\213\375\217\026\324\311\272b\037\346\347\234t[\232VM\247\246\337\t\320\342F\031\366\311B1$\222\006\361p"
+	.string	"\241\301\203+\013\221\200}\262\213\302\204\217\310\005\202\205.\017\217A#!\330\225\201@\330\325\361\366\272\342\215\t\305W\242[T\026] \303$Q\346\250*tq\222\243$S\266\364\232\2521\031Nl\231\272\236&\026"
+	.string	"{\311'\323\360\316&:\313T\236\016n"
+	.ascii	")\263\257\t\233\203,\225j\314(/\024\265\306\267d\247\341\240"
+	.ascii	"PY\006M\300\251W\002qqK\225\252e\240^6\t\363\t"
+	.text
+	.section	.gnu.lto_timeval_sub.103.baf1a76f36c6904e,"e",@progbits
+	.string	"(\265/\375`\273\003\345\030"
+	.string	"\206\356\237G\260\326M:\025\254|\275\224\302\2540\003.\036\301\303t-\301\205\367Dx\204\355-\271~\t\t\"\025\017\275\236\333\034\r\264\013?\037\314\177\322\005\343\275\363\376\2027{\374\3563A\361\3519~P\241'\226\220-eJ\001\213"
+	.string	"v"
+	.string	"\220"
+	.string	"D\256eY\026P\334\254\007T4\246\034\034\013\350\233boB\006U\r,\273=\003\377\314 \024\222\024"
+	.ascii	"g\231\256\\,\b\022F\301\323\276\325\201\340\336Kz\316\256T\021"
+	.ascii	"$\273\275\003\256\205\377\334\013m\373>\376\003gw\305\236\f\336"
+	.ascii	"\016\325\214\335\020/\273[\3739\r\374\027\257\003\376\323\030"
+	.ascii	"\307=j\342\374X\203\tW,\2104\361\224\036\237\2566<\246\370\263"
+	.ascii	"\273\327z:\361r\231\261\006\273\353l\342\245\270\277\333\226"
+	.ascii	"`\333\202\035\001\004\356)\245\302\260\037ww\255RvL\373\274\367"
+	.ascii	"\013\370\326\335s!\177\200\007\371y\216u\323\236u\357\200i\235"
+	.ascii	"L\3172\235\223i\234L\337d\332&\3235\231\246\311\264,\3233\231"
+	.ascii	"\226\371\322aL\3074\rj\372\313t\314\264f:3}\002\t\025\305K\325"
+	.ascii	"\213G\035\331E\021&f\237|Jp|\353\307\372\263\256\366\355\027"
+	.ascii	"\361\271\266\334UB\013\325\r,\273;!<\316\017*\323\032\275njG"
+	.ascii	"i\364"
+	.string	"\223\262\003\233Q\031\225i\034\242\233\3121!\232\321\002\036\276\204\350\202\214^\353\361\013\352\213G\214i\250w\027\330\2431\235\345\242\302t9@\355\321[\331\201-\035\t\374\024\324\353ZD\3754\346d\007\246^U\236\3666P5\352\267E\327#\227a\276\246\252\236\353\030rQ]tS\271\334]%U\030N\275r\270\362bJ0I*\244\362P1\210\037\261)\360\215\\\020\021\356\356m$\201\377\256\t\240\226|\261Z\3120\007BCFE1\206t\273\005\tm0*\n\221N\342G\037F\030\r\335@\013!\240\240!B\206\332\321P\207[\320Q\255\310C\020\210\232\320\315\250\206\340\307\266\020C\267\332\221\315v\253\311z{\225\362\271\016\241\212\213\206W\241\253\262\312C9M\235\316\365?a\3518\241\240\322tU7\322\007\002w\324\311\266\217\376,i\316:\352\243\237i\216\352hn\331\355x2\323\001_9\312"
+	.ascii	"*\n\017+\034\365\262Yi\312r\2436\212C\323\033\375\306\330\350"
+	.ascii	"\354j\305\225\032mB$AD\315\024)MYh\002B\250Q,\007\0212\204\261"
+	.ascii	"\222QT\2204-\006\200\242\231D\346\001\021\200\245T\3144i\251"
+	.ascii	"\r,\032\355\241O\310\fa\213\022\226\365i\035\376\346\f]\017S"
+	.ascii	"\335\\X\317t\366\352\337\"&VW\315\265\331yY\364\211I-\324YdY"
+	.ascii	"#\r#\306\013\241Y?:E\031\240m\021\004\r\006\303\271_\016\306"
+	.ascii	"1B\2762\335\027g\360\025\030\001\311\bP\344\301\355%\223\001"
+	.ascii	"\033{\375\214M\260\t\200bI\271\f\311\001\005vZ[6\356\363\275"
+	.ascii	"\312\n\360\206\230T\024\305\027'\267\321\230\n"
+	.text
+	.section	.gnu.lto_motorDevInit.110.baf1a76f36c6904e,"e",@progbits
+	.string	"(\265/\375`B\002=\024"
+	.string	"\366\244\205J\260\324Q:x,\207\3304\231\335\253\231\337\370\207\355\323SP\372)\306\033\340\035Y=V\227:\r9\026\213'\327\360\201\252\343\353\2346\330z\212\241>\255]\331\334\330\274\365'?\t\212\357t\342\2233\200Y\331\020K6\221;\311p"
+	.string	"l"
+	.string	"p"
+	.ascii	"\375[\260%\371\272\277\023\030_\311\017\030_\367\266;\344\277"
+	.ascii	"\024]`\350I\347\350\252\273KF\261\344\305\337W\244\267\217Ud"
+	.ascii	"z\333\037\375\300\016I\315G\221\213\200N\017\210^\250x\351p\264"
+	.ascii	"\212\255\036\022@\002\350r\304\225\"DL<x\312\243\303\241\242"
+	.ascii	"\213\237\363\203O\260\023\342\244\202\272\237\323V\204\356^\232"
+	.ascii	"\323\371|[\337]\234\335\315\260K1\004\353\272\321O\276\350\257"
+	.ascii	"G\3722\323\245\225\356\001\230$A\361|0t\007:\322=b\210\244\241"
+	.ascii	"*S\213#}\3676\366\301}\355\201\277q;\3226\275}\372\"\256\206"
+	.ascii	"\204Pu7\312\353V _O\304\277v\031\250\334n\364\341%\215\213Z\301"
+	.ascii	"\302\277\323\270\275\b\004-\351\033\334\216\003\362\265\204\236"
+	.ascii	"\356\336w\242\333e\204\270Iw\020\017\245\016<\273\273\344\267"
+	.ascii	"id\246\302\032S74\353bw\267\250\340\314.\336\020\305\223\312"
+	.ascii	"\341\341\350p\177s\334}9\223i\240\301\356\322|)F@\220\356^I\272"
+	.ascii	"Rl/\364\272\034d\262\340k\211\235\360\252\312\206\016Ef\221\023"
+	.ascii	"\376`\356\361\036\307s\234{\241\365P\243\317\325rF*\237!\354"
+	.ascii	"\254pR\300$6t\270\373\253\241\334[\262\3329\261\034\264\0014"
+	.ascii	"&\314\254\3056\233q\2315\231\031\n\246\fL\314\305\025\023\323"
+	.ascii	"0;%\320N\333){\355K\312\204\013-\026J\233\031C\203\331\312Y\f"
+	.ascii	"&+_h\2652\345d\317\016&\255\264\235'\255|\375\372\034\264,3\032"
+	.ascii	"\213\312\206q{\035\337\357\270\223\351\002\203\215\257?:\002"
+	.ascii	"\037I>\236\257\nh\344\336\323\r\315Z\222)\267z\3500\260\007k"
+	.ascii	"\251roUb\260\213y\212\242\23490 `\0022F\351\001\376\030\253\344"
+	.ascii	"\261?\311h[\361d\304\021\346\016\255\257\231\332\223\te`\021"
+	.ascii	"\003<\226R\331\005\245]X\360s\301\201P\213B:/\316R`\343\"\262"
+	.ascii	"\255\327\256\b\303\244m0\343\n\207\004Yl'$(\310'\272\355\366"
+	.ascii	"\226\341\273\311\\r\260\027>{\224/K{t\276\227H\001o\001|\311"
+	.ascii	"\026/\2629L\371u\365'"
+	.text
+	.section	.gnu.lto_servoDevInit.111.baf1a76f36c6904e,"e",@progbits
+	.string	"(\265/\375`I\001\315\016"
+	.string	"\326\033eF\360\222(\035\240\345\027?$G\354\252\357e9\245m\340o\313\253=\311b\351M\302i_\002B\370z\304\310o\301\n\020\361&u\264\213\364R\n<\367\341\0209\211\264\367\016\213\273(\336\372\305G?\244\221M\266L)Q"
+	.string	"N"
+	.string	"O"
+	.string	">.\256\266\200L\316\210\231 \273\333I\025\346\256\211\267\246\340\247&\025\364YO\220\032_\262\030\252\364\251y\\L\354\b\200\022\241\201ljP\334umA\205\252\275x\271\274\353\013R;\241,\206z\271z$\354\256\225\005u\342\336n;\3056\005\373\246\276\347$F\035?jJ\207\271\261[b\324\331\034\323F\213\267n_\364]\376\330\301\003\360\255\225\357i=\254dtf\273\"\203OG\340>\377\261}\265\017\3431\300\313"
+	.string	"q\001\27318h\354\212\r\334q\237\026O`\373\344>`\3734h\0070\262S\212PG\377\336f\243\034\346\031\200`\373\303i6\204\360\330]\320\214\317\214|\026\237\346\240\242g\371\364U\266O\005+ &\035\255\362\362\256k7\251\235\227\f\266c\322QJ\230\013N\r)U\266XR\220\315\311\205e\214\275\275u\253\324\035B\030D#"
+	.string	"LN2\210\274\t^\312\027\032}\\\"R\341\302\210\205\216\0242\371HH\235\350\204\004\245+\371F\235\b\002{\032B_G\362\274\257\373\210{\3269\032\326\fgf\222\341\224*\207\304\344&\347\nu\213\336\274z\204\320\234k\273\273\232T}eS\271\311\003a\033"
+	.ascii	"\200X{\311\027\323\020\232\257\266\226\211\345\301\214\276\253"
+	.ascii	"\261\323\022\013\364\270\035\3069\033s`\232\n\233\006aZ\202v"
+	.ascii	"[\344\b%\236.\016\270p\315\352J\320.\016\213({\351\252\361\202"
+	.ascii	"\"\362\272\346\023"
+	.text
+	.section	.gnu.lto_pwmGetMotors.112.baf1a76f36c6904e,"e",@progbits
+	.string	"(\265/\375 \372\335\006"
+	.string	"\322\314/5@o\222\016\230\216\256\372\004 \367\233<\352\205#\035\214}\001\306G5>\326\376f\247\\ME\001g\366\343\352\277\024\2111gn\274 \002\f"
+	.string	"\255nb\t\221)w&\004\205\203\204hy\026*\216\025\035\0308\r\261SA\304i3\365\340\251\242EQU\324l\3317z\223+\223\231U\273%\335\"\356G\341\022\227\253Vx/\251p\223\275\320o \3678\276\230|\243w\230\220\213\256\260db\274\270\244\nD\001\371?\257\271\"\035\371\214\275\212\211l\203 \304\202\342\244%s\213o\025\220\n3\r\220\n_G\261:\354\226\244\006!\217\024M\004\252\003(\310\314\235&\312\350\257\377\300?\375\032\001\t"
+	.ascii	"{\311'\323\342\255\243s\205P\\\023a#\360\026\"\027w\305\324N"
+	.ascii	"2"
+	.text
+	.section	.gnu.lto_pwmEnableMotors.113.baf1a76f36c6904e,"e",@progbits
+	.string	"(\265/\375 \361}\006"
+	.string	"\362\313,1P/P\007\240R\265\3460\265\216_\nE\202\365F\234\366\331\3057\217\0021\314\357\222\033\2601\265\212\252\342\255\242\302:X\037\021\305\300`\307\275S\n\216\036\004\205\203\004JI\013\025\242\250\003\003\324@\243\nA\037\002O\017R\245\3244U\332|{\311\031\214\200,`&%\374W\214\017\362\220\312\337p\204\025\257}\372\026\3639OJ<0\274\225,^\354\017\2132\303>\300J\316\226N\027zWA\331\255\270\264\254\311$\341\260\375\306\227\235\362\257\333\201\016\212\t\221pw\251\324\370\365x\371\377\270\200\266a\217\001\005\273\353\250m\026\267\274m\307\366c\373\"\t"
+	.string	"{\3117c\361\2003\244\305\027\272\206\273\2050^\206"
+	.ascii	"\227n\321\316'"
+	.text
+	.section	.gnu.lto_pwmAreMotorsEnabled.114.baf1a76f36c6904e,"e",@progbits
+	.string	"(\265/\375 \354\205\006"
+	.string	"\362\013-4Pm\222\016$\241*\026\262\270\262\226\204cC\341\255\225r\227}\324\312\232\375\273\035\346\r@\205<\366\235e\254\006dTQ\261\203\347\264\301\023\306\267O\266L\001k\250\204\005\004\005gm\030^\306r\017\r\031\007\247y\021\216\302\\Al\236\263\252\352\271K\226m#l\230O\003}A\032r\335\216%8X\254\323\345X:a\013\260\370`\3513\017\266\214o%\333\350\307\261UH\0305I\311\f\225P\262d\032\361\370;\177\231\240\240\363\325l#$@\272\230\0209\311\314\\\323\350U\274n?z"
+	.string	"\342 \301D\236\"\200Af\216\230\250\242\267\376\003?\365S\004\t"
+	.ascii	"{\311'\323\342\2543r\206P\\\023\001#\362\022\"\207;gj\347\023"
+	.text
+	.section	.gnu.lto_isMotorProtocolDshot.115.baf1a76f36c6904e,"e",@progbits
+	.string	"(\265/\375 \317\325\005"
+	.string	"\344\tm"
+	.string	""
+	.string	""
+	.string	"."
+	.string	""
+	.string	""
+	.string	"("
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\312\347\343\317\232\266\004\001\273\001\001"
+	.string	"\177\002\001\177\001\247\003/\300\200\200\370\305\207\235\265\024\217\250\300\001\177"
+	.string	"}52"
+	.string	"\013"
+	.string	""
+	.string	"}"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\367\251\001\221\216\217\320j\002"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\201\300"
+	.string	""
+	.string	"\203\003\202 \006\177\001\200\300\013/root/repo"
+	.string	" ./src/main/target/SITL.c"
+	.string	"\n"
+	.ascii	"{\311'\323\"\030>*\254V\001\271\206\013F\214&D\016w\016\326\316"
+	.ascii	"2"
+	.text
+	.section	.gnu.lto_pwmWriteMotor.116.baf1a76f36c6904e,"e",@progbits
+	.string	"(\265/\375`\271"
+	.string	"E\013"
+	.string	"\346\226O>\020Q\225\016K\225\r)\205\224\320\370x%\331\374tp\221*\237\252\263Q+\371\033\200\260\201\032fLh+\215\214 \017a\001h-\034\020)\030\277\231F\212\220r\216\203\306\262\241M\244L);"
+	.string	";"
+	.string	">"
+	.string	"\207\316\264\013X\272\257*Xw5\254Z\273\037\3051;tg\277\370\207\332\001\252\016%\226\214\335\215\312\341\335\263\363/\342\021\317\024zB\020\354\256\3233]\270\365\266\t\330>`\177A\177\366\357\207`i\230iL\323\252\351\304\322\337\300T\251\267`\355Zx\321X\016\230\302\203\355Klk\332\007\361\020\335?\243pdw\205\253\265\273\024[\262\303\311\005<\016\261\007x\004\326l\233\027C\025jv\220Xd\212\351;J5R!\252z\322\207Q\276|M=\t\306G\234\004\307O\271\363\311{\207\376\347qx\245\220A\305\f\f\242|\331_(u\203}l\365d\177\025\332'\302\005\004'h\0166\031hLEA\203\004\f\242G{\300]<q\223\271h\"\206\353\304\312\304\233\004\215\213\236m\343\242\344\333\353\311\231\013\027\207HG\206j\033\364\023\034"
+	.string	"\250\3355\340\227\270\t\b~\3520\017"
+	.ascii	"{\311'cq\347\3150.<\344\215\202a`\374\305\270\256\214\261\250"
+	.ascii	"\366\\\310\257g\026\020*\314\001wy\321N2"
+	.text
+	.section	.gnu.lto_pwmShutdownPulsesForAllMotors.117.baf1a76f36c6904e,"e",@progbits
+	.string	"(\265/\375`\027"
+	.string	"\245\007"
+	.string	"\222\31657@\217\322\001xwK\347\037c\020\031"
+	.string	"\324\201\256k\222\340\202\311\t\031\334\257\372\315H\037\206}\007\273fm5\337v\223\273\fn\362\302\0268,\320\331\254\355\266wJ\001stE\005\031g\024\t\030\344ix`p\2003\004!?\023\216\">\"\b\222\023\320C\340(\021\222p\306(!\247\3563\353R\013(\0310,&ga\377\322\370#\257\227\377a\nR;\366\347\2234\177O\345\204\205\312ZL\255e\327Rs\033\3663\353R\266\353x\220dwY\355b\264b\226\365LT\266\317\261\335\232mp@\237U\330\355\242RJvk\201!\300\237\251\275\362\332\261\003! \027\253\227\335\205\216\343\364\215\372\027y"
+	.string	"v*\275m\022v\327\r;i\334\356\266;\266\021l\253\002\t"
+	.ascii	"{\3117cz\366\206Ea\032t!\327\016v\250\324dp\227\027\355$\003"
+	.text
+	.section	.gnu.lto_pwmCompleteMotorUpdate.118.baf1a76f36c6904e,"e",@progbits
+	.string	"(\265/\375`\322\003M\027"
+	.string	"\346\251\220F\300\030Q:\220\035"
+	.string	"-LP\230\304\253\270\360$\020\b\254<\020@p\374\304-\022`*\366\223\357\342\277\3458\030\035\244\271\333\226#X\216\2070(\334\202\301\271\252_\327\017\264S<\252\217\276\266)i{o)e\n|"
+	.string	"o"
+	.string	"\177"
+	.ascii	"\352C\177\3104\367%\251\326\322k\264\323A\264\353\356\002*\317"
+	.ascii	" \247"
+	.string	"9S\345\2478s\367G\220@\246=F\234\273c Q\322\235;p\360Sy\331/Fs5:\200\016\036?B\312t7\3104T\246SF^\331\265\204\233\351\374Z\250\214\003\200d\360L8\022\2215\005\313\017\n\234m#\013e\024\256\026Y\335\255C\272%p>\273\244\006\335\375\275\341V\350I\372\377\365\337\301\037\007\004\312\032\200|\251\355\321K\313j\355\231\177\370a\365\246\254C\252&\206\024\251\340\355j<\373s\263\345\240_c3\320\2579\375J{\250\342\360^5\3677r\237\222{\233\270G\315\375I\356k\344\336\024\367\245\271\247\221\373O\356Iq?\347^\312}\224{\216\373\345\275\n\320\023;f\220\t\203S\033W\272S\364\3144\026\251\313\2419\325_u\350\246Rj\370d\342\232\022\233\236h\024(\253w2U\226x4\334\204\211\356c\032\022\177\223I\007TI\222\351EH'\371\277\216\"y\022"
+	.ascii	"F\267\240G.\234\214\272[A\0215\202!C\2535Ur\225\333\230\310\222"
+	.ascii	"\365\347\314\212\231#\253M\212\317\366\276\314,\235\330v\264"
+	.ascii	"\355\031P\"\327\327\335\013\256C\224\310\353zC\3457\360\310+"
+	.ascii	"\317T\271\2540^t\341\351h\333\213\034\264\335=c\006\272\210\031"
+	.ascii	"/\016-\327N,D\370\305:\204\b\037\300\302X\330S\272K'\302\004"
+	.ascii	"\b;`\354\265\001\326\212\201\035xZ=\240\013\006\002\324a=\364"
+	.ascii	"\360\202\201\2610\204\201\246\\k\354\0064\366\231\017\260\277"
+	.ascii	"\204\235\325\333\231gz4\243G$9\3509\266\"\034\254B\331\212P\354"
+	.ascii	"\227\350\321W\265n\032\201\025\227\b\242\252+\027\355\"\342z"
+	.ascii	"\343\024*T\230*U\214\340\205\030!\0277\274EK\226\024\337\330"
+	.ascii	"p\n\3056W\254\240\300\b\351NLeJK\250a8\304\021\022\b\315\314"
+	.ascii	"\204\tR\020C\213\001\260\002\221\031\263y\021\360He\230\311`"
+	.ascii	"t\317{CB\2752\202\326\356\332\214d\373\311%\211\022\246\035\317"
+	.ascii	"\244\231\252\251\220\264x\003 \264\345\034\374\304\264ep\r\013"
+	.ascii	"\224H\335>\206|\022\001\310u\367\227\345=\211\266V \023\322\352"
+	.ascii	"\326\210<\211\350r\261a\333\3455\267P\030Gw\0136\221\320\013"
+	.ascii	"8\302E\321\005\203\254\226Q\207\321-\206a\252P\320)\343\244\037"
+	.ascii	"~\024FP\356:2\200\025\307\355\320=\233\\\004\242\t(=\326{\301"
+	.ascii	"R\344E\210\266\243\253\001"
+	.text
+	.section	.gnu.lto_pwmWriteServo.119.baf1a76f36c6904e,"e",@progbits
+	.string	"(\265/\375`u"
+	.string	"\375\t"
+	.string	"\006TG>0\305*\035\236\213\352\365\036\376=\374\233\314\311D\f\262;\321\372\022i\331\343\351\200& |\2635\314N\211V\206\270\343\f\206\r\305\0277F\025\326\333\374S6\312\033\352>~\333d\313\224\0023"
+	.string	"4"
+	.string	"4"
+	.string	"\034\216\273!/\331n\350\361\324\\\372\263\t<lm\202\213\246\212\035\330\335\031G\376]?\377)\337\200+\3245\343\260\273Vp\005r\307\333V\260\335`\277 \252~fs\rx\200\330\356G\r\301\316$\213\211\355slG\265\177r\224\357\241W\274\331mq\221\355\256\307 \315e\347\b\230\313\355\007\230K\253\332\013\240\357\257\f>\354*\030>\311\245K'=x\351\2370\227\007\013lQ\243\032\360"
+	.string	"\020\343c\006V\"@\225 \2455;Di\024\261\277md\331\017\377\355\257?nj\r\334\251\"\224!5\270\t\322HZ\364\201\220x\210\230&\216\302\013\231&i\024\262\230\"\2574?\035w\027\2347M]\347MN\270\3376\262\254\241\275\314R\261\303\032mo<\326\031\264v7\013"
+	.ascii	"{\311'c\032\202\032&\234\301\027\343c\332\345\032\276\230\205"
+	.ascii	"\202Pa\"\270s\213v>\001"
+	.text
+	.section	.gnu.lto_adcGetChannel.120.baf1a76f36c6904e,"e",@progbits
+	.string	"(\265/\375 \374\005\007"
+	.string	"\002\r16@o\222\016@\265\352<[\227s:0\312 , \302O\313\231O5`\366ong\333\322\0050\3236\313\207\334i}\002<\263\353\230\351\017\220\244\361\273YBd\n\022\027\206U\020Vf\253\303\340\260\320\020\267\353A\253\266\210ET\023\321\322*bgsFqiq\3132-j\272,Gm@0\364\335\347A\217/&a\307?L\251\245+&\231\031/.\2512\241\220~\317k~\370\336\340\300S\021\213a&G\311IfWp\004\350\364_\220\206x\3468\027\240\017\247\304\202A\302\222\331\305\200\016P\235^\005\250N\360\243\\\037w;R\205\020)E4\372\364e\0222\363'\032it\330\237\340G\3707\002\t"
+	.ascii	"{\311'\323\"\030>*,V\001\271\206/\230`\211\2510\246k\222\001"
+	.text
+	.section	.gnu.lto_FLASH_Unlock.125.baf1a76f36c6904e,"e",@progbits
+	.string	"(\265/\375`\333"
+	.string	"u\f"
+	.string	"\206\026VD\360\2624\035\262\bF\207\353(\326\213\337cI\326D\003\375,\332\033f\330X\305>\207mI\272\3547F.\237\355zj\222\273mW\0334H\227\244\323\344\254EO\230\366^\214\fQg\352\350\233u#R\246\024B"
+	.string	"="
+	.string	"C"
+	.string	";`\005\215IF\317\356F=q\322+J\223\344\207x\334+P\315)\005$h\224l\314\360j\256\024\001\323\217\024\001<\031\252@\017\267\363\234\247\007\257\224\371!\331]g\347\205\270\255\333\216`\033\202\375P\307q\207\227|\367\312\177\261^]\237\363\003%xX\330\350\214\210\311\320\006\271T\023\3665\f\303\320zc?\235O\377c\340;}\347Qc\367C\350cO\325\216\n\333\0271\311\316q\020Ei\247\250\250r\277\341b\207\016\n$S\257\013\260\022\374\337ch?\331\340\354\316\274\323"
+	.string	"\232\211\b^\331.\033\362\235/\223r/8\244\252\307\363\245\b\220\006\204\032\306\272Z\200\201C&{\330\327y\013\030\007\016\301\260\223\007\327\202\221\353B\311\212\266\265d\331EAE\244e`9\251\320\300\204\001V2a\304\242\020&\301\201I\034e\0306\224QdIAY\211\242\315%\206.k-\331\026G\232\266E\021p\2577&\211\321\322\251\335\335\n@\025"
+	.ascii	"{\3117\323b\2353pW\200\025\240\272t\265\006H\031\027\256\200"
+	.ascii	"&@\334\257F\001+$\342\026\033\002\264\313(/C\214Kw\263i\251\220"
+	.ascii	"(j\025\024"
+	.text
+	.section	.gnu.lto_FLASH_Lock.126.baf1a76f36c6904e,"e",@progbits
+	.string	"(\265/\375`\227\001-\020"
+	.string	"\326\\kI\340\262(\035\254\024}<E,\341\343"
+	.string	" \337*h\226d\007\254K,\004\243\244\2335\376\204U\246\201\177u|\356Q \241\235\211\310\343\021\306,!|\317\311\372\363\023\013c\334\334\352\t\362\302\247\327\262\217Q\253d\023\271S\nV"
+	.string	"R"
+	.string	"V"
+	.string	"\266\357\030\252UD\020 \025\210\372\250\260\375\221a\266\320o5\025\001\213\030//z\324Z\301Mq\330\251\267\023\346\037\347\001J\032y*\212\271\027B\213\371z\005j\270\334"
+	.ascii	"\232\314s\220\273)q\234\317\0204\2279\001@\250\265z\226\264\021"
+	.ascii	"\367w\333\025l\247\354\343\bA3&\276\331\340\276o|_\233\203\207"
+	.ascii	"\371\322\"<?`v\272\331\2223wS\243\261n\371\276';9d\323\207\375"
+	.ascii	"\234\353\264\3706\376\3002_\236\372,\337\351\227\236\370\001"
+	.ascii	"\232\311!\021\233A\354\0339\027\205}\257.\215\375i\357\323\373"
+	.ascii	"\351\213,\320\351\t\026D3\222\322\351m\367\2710{\211A4\003K\247"
+	.ascii	"v\211\311\214\235\016\304\222\276\213\313H\311\b\265\340A`zk"
+	.ascii	"\253V\262%q\017dt\354\004\314\335Y\353m\343\373Q\276\333\336"
+	.ascii	"#\032\250\2515\366\322\3479\f\226os\352\024Q\374N\355q\003\351"
+	.ascii	"e\311\235\335\377\004Va\235\230\304\261\265\022\206#\207\224"
+	.ascii	"\\\fJ$\ra\007\225\213d\222\262\032O\031$\240\"\234FJ\022xe:\245"
+	.ascii	"HP\340+Di\251^\240\nK%\202\253\226\0134\221<\256\204-\3605\216"
+	.ascii	"-pt\253_\032\217\f\301\354t\261u\241\n\246=\201\302\276\206\313"
+	.ascii	"\255\360\016\314\333^\003e\n\n# `\2021e\311\003{\362\211-n\233"
+	.ascii	"\201\302\301m/\270+\347\272p%Br\214.\t\320*d\023\261\256\003"
+	.ascii	"k\270q\020m \016\327\r-\033Ih+\377=\342\255D`\333\274\021on\251"
+	.ascii	"\302\270\322z\200f\270U\017\177\034w\226n\331N\033I\2156C\001"
+	.text
+	.section	.gnu.lto_FLASH_ErasePage.127.baf1a76f36c6904e,"e",@progbits
+	.string	"(\265/\375`\020"
+	.string	"]\007"
+	.string	"\342M36Po\322\001\240d\006\205\333\244us\3702\210\332\030\020e\252x\307y\2735\004\367\220,\203\r\026H\313j\271\t\330\266\bj\250\2462\301\254\267Ik\204\354\275S\nYv\311N'!\342\362X\016"
+	.string	"\346l\032 \030\036T\273<\322\322\224B\302\232P\216\314tS\031\253\270\244j\030&U3\367v<GU \030\262\347\347A\016\373q\341\310~\221\244r\224\225\335\214\027\227=\231J<lo\266\306\366{\366K\017\331>-\036\260;2!\331\235\005\326\314'\317\214m\377\343 \233\271\205\013Pg@J\301\030i\331\235Z}\200\372\024/@}\202\035\347\3768\377\"W\b\225XD\335\347\017\203\260\273~\242N\343\206\267M`\373\300\366F\n"
+	.ascii	"{\311'\323\"\030\366\250\240\\\303\241X\214\016L\020p\302H\265"
+	.ascii	"b\022&\031"
+	.text
+	.section	.gnu.lto_FLASH_ProgramWord.128.baf1a76f36c6904e,"e",@progbits
+	.string	"(\265/\375`\270\001\035\021"
+	.string	"\366`uG\320\224M:\250\"\034\300P\b\177\245\2326\276\275#\340\b%\0362A\336\250x\002\237*\214\001\177\256\216m+\251D\233\300\323\n\332o\003\\\203\bo\255n\357\334\024\247:i\2647\002\374\325a!e\333\366&[\246\024_"
+	.string	"Z"
+	.string	"a"
+	.ascii	"\227\016Q\266\375\025g\221c\027K\f\006\252\250h\3521\"\262\033"
+	.ascii	"n\251\237\314K\355\004\346e,q\327\247\324\242\272\374\313\276"
+	.ascii	"\242\363\342\350\003_\237$\340\317%\352\347\232\t\030+\001w4"
+	.ascii	"j'>'>\0230\246)\370QC\310e\327\016\240\216\352\311\301\356Z?"
+	.ascii	"\360\303}\272\355\031\3330\366}\004\322\031X\372\357\322g\315"
+	.ascii	"\313\307\323\322PR\317\021\230\316\354\360\2451\310~\234\315"
+	.ascii	"f3G \373D?\352\341?\245Zjj\325\324'Y\001E\0300\332\365\231\031"
+	.ascii	"Y%i\003\205\355\034\273\304v\324\023m0\200\335\021M\fT\355\267"
+	.ascii	"\370P\316C\016\027\260\013\204\003i7\\\340\r\025\r\022\\\332"
+	.ascii	"\\L*\026_\236Q\306\023\211\241!\216\036x\034Y\222\001\024\025"
+	.ascii	"g\264W4\372\3172\276l  ^!4\215\332C\266c\306\205\027\t\301\270"
+	.ascii	"\214\232\323`\332]\225\313\030\272{\347\230\227\032\347\215k"
+	.ascii	"R\314'E\214A\236\361\321\202L\307\216\026\261\177\304:\300\264"
+	.ascii	"\013\373\347\033\335E\347\233x&A\240Z\331p^j\246K\265p\272\324"
+	.ascii	"\r\312\213\214\327Q\250\341\274U\347I\200aqy\320\002\241\002"
+	.ascii	"\212\n\007\003\247Az22\234\346\230\224\226\t\021\\\266\226j\345"
+	.ascii	"q\255\315\206\206\253\331b<\326\226\222rw\243\362\266V\327y["
+	.ascii	"I\270\3276\002iw\315+\005\001\225`QG\333\335\235\003T\306\027"
+	.ascii	"\035\351\245\200\320.\317?\030\024O  \240\002\0312\365\273\363"
+	.ascii	"\3112\375\036\303\203,\325\312\004e\234\307;\006\203\b\267}\301"
+	.ascii	"Q\032\212\317\2078\253\230}\026\013!?a\017\213\370|\330i\317"
+	.ascii	"\006\023dB\226\215\020\030\376\273\202\240AR\322\317\325\265"
+	.ascii	"\206\264\334\250\266\006\n"
+	.text
+	.section	.gnu.lto_uartPinConfigure.129.baf1a76f36c6904e,"e",@progbits
+	.string	"(\265/\375`<"
+	.string	"\255\b"
+	.string	"f\320=9Po\322\001 \217\013J\233k\021\265\"7\252\037\353%\364\027-\203\202dg\326\020\347\275\311b\013\033jC\215\242\026\n\233\2052&\326\t\224(\301\206\3530aD\332\336)\005*"
+	.string	"-"
+	.string	"."
+	.string	"\330/\203\266\314\253j\013L:8VfvwJ\222\203\217\240\377\224\007\204(\323#"
+	.string	"hw\035C\324\307-o\373\300\366\203\355Uk\231\262eG$\006u\226\227]\217\032\232e].%\034\333\217\366W?\001\217\202q\317n\n\246e\267*xf\277\\O\200\375\312>\020u\277Y\231r\326\naeH\rc\361\365*\245\216j\367\364\260\";\201\020~\331\026\027\361\241\023Z \254\ri\262\253)\312\021\373\233\335\r\336h\351\243Z\3113\342\":o\241\343\034$4\216n!\222\200E\237\006\b\206\320\374\266\021\325\276\331q\332\304\024Q\212\3711\260G\332\350\374<\217NN\n"
+	.ascii	"\305,c/Id\354\001\237\265\300\331-0\344\022l\263\232\002\356"
+	.ascii	"\362\242\235d"
+	.text
+	.section	.gnu.lto_spektrumBind.130.baf1a76f36c6904e,"e",@progbits
+	.string	"(\265/\375`0"
+	.string	"\215\b"
+	.string	"6P=9@\217\322\001\230\"bj\320pR\377\0323N{\200\336-K\234\"\225V\n\324 \007\032J.m\364\221\332\322\214\233z\275\bIq\267\214&p\301\036\343\036RI\354\336)\005)"
+	.string	"-"
+	.string	"-"
+	.string	"\307\f\3320\257\2525X\215\200\254\304\354\356\224\251\203\217\240\377\326\003\302S\351\021\240aw\035\303\223\310-o\033\3016\204mV\022eKN\252\344t\226\227\335\220\031\231ua.&\033\333\217\366YG\001\237\302\361\201]T\253e\267.xj\307\\_\220\035\323N\220\005\232\225(k\257\023W\207\364p\026_\257B\342\250vM\01714\023C\3021[c#>\264\302k\345\372\220%\273\226\242$\261\257\331\335u\256\3508\207\020\211~\027\233h$"
+	.string	"\342,:\357!\203j\376t$(\"&\346\267\201\250\347\233\035\347\t\315\017\035\315\316\201=\321F\347\347ytn\352>\t"
+	.string	"{\311'c\032\370\f\007\316B\201y\227"
+	.ascii	"\232\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_sendMotorUpdate.part.0.187.baf1a76f36c6904e,"e",@progbits
+	.string	"(\265/\375`]"
+	.string	"\335\b"
+	.string	"&\320:7@\217\322\001P\330y\266"
+	.string	"\263\370y\212\036\320\016]\230T'ta0\340\341\"ZC>\337\200\034\024b\301\357\254h\274\320\306\2577w\220\374@"
+	.string	"`\037\265\275\345N))"
+	.string	","
+	.string	"+"
+	.string	"\026,\231\335\225\217\372q\356\372 \347\277y*]\337\035\216\200\270\314S\306\037\347\020\240\263\273\336h\334\361\266\rlc\266a\002\335\021H^*\264\3644e\205\207\253([9\004-\273\0273\255\345\210,\"\366;\222}]\217/\261M\3020g\307|\245\332\2636\002+\036-\225\325\016\007\274\233<%\264\3315}\332\331Q \006T\273[\260\372\211\310\017yt\304\350}>\372#\315\243-1\361>\375\376`\t\013\007\nr\0031h\236M:4xB\362\243\211$&\340\354\001\244\311-\3134y\331~\207\253(wLJa=\334\335UM\005\022"
+	.string	"ze\351\033k\360\006)\230%\260\2714x\017\240p\331\240\006\0138-\026\325N\347\2026]v."
+	.ascii	"\234xHM\241y\351\265e\f"
+	.text
+	.section	.gnu.lto_pwmCompleteMotorUpdate.part.0.189.baf1a76f36c6904e,"e",@progbits
+	.string	"(\265/\375`\350"
+	.string	"\275\013"
+	.string	"V\226O= 1T:\244\247\024`\243\020-$\326\255\265\265f\236\302\352\"\3166\251\\j\023\202\020\"Hna\225D\345:n\241\002\210e5\372X\005\226e\237R\200xy\304G\223C6\331;\245:"
+	.string	"@"
+	.string	"?"
+	.string	"\331\247\301\033\300>\263\027\300>o\262\315epg\3178\370a!\237\351\202\252\306\356\322O\351\341\335e\274:\337\273th\330\360H\340\027"
+	.string	"\312\356:\343p\317\333^`\273\201\375L?\301\371\251\253\374"
+	.string	"9\224%\023\356\247O\204\254GC\305.(\243-\231t?}\260\265 \3423\205\273\240\202O3\310>\017\372\361i\022/\321\335\204W\fX\030\033c\204\337*\334\335\004\237\246\001(\\\274\260\021\206\244g\237\203\371)\276\342\370 \334\361\304\213>}\017\366y\325\021x-X\243\021,PlEY\262\274~\255$\331\327\365\311\0200\332\305\320\272\261\035&\213\020O\375\250G\373v\333\246S\035hu\253\032\007f\202\345R\331:5\363%\002!\302\203\n\3350\0224\313F7\031\213\206^4\016\215\034p\245\200\321\350V\253F\037\266\343%\311\024\220\fIY\262\035 \332\265B\274\3101\026"
+	.string	"\177\311\017\347\f\374\252\320\004r"
+	.string	"y`\204+\2060V\024\241B\340:0($\202\027H\254\273\3022\222J\212\316"
+	.string	"m\246\3544"
+	.ascii	"\\{\300\215\026\321\357*c"
+	.text
+	.section	.gnu.lto_FLASH_Unlock.part.0.190.baf1a76f36c6904e,"e",@progbits
+	.string	"(\265/\375`\235\006%&"
+	.string	"zC\260\016F\200\236\321pS)\276|\202\331\230\204:\210\242\320\301\027\340\\\242\"I\315\224\360/\024\316\224\334\340\213mS\317\n\253\007-?<B\205\022\253\262\204\331\267\002@\333\335<\247\006\027>\261\324\257%\266\311\336[\312$\003\325"
+	.string	"\303"
+	.string	"\340"
+	.ascii	"\017\373\213\347\335\357\243|\270\247r\261\275\205\201\201=\021"
+	.ascii	"E\315\350\340\305\225\004\002z\263(\343S\236\030\001q\315AE\274"
+	.ascii	"\024\365S\236\312\325\212\270\346\260E=\001\003\245\316\272\022"
+	.ascii	"\205nn\016\275\271\304\0278o\242\037p^\370\275P\306\356\355v"
+	.ascii	"\363_\273+\203j\325\335\263\023\271V\004^6\200`u\326u\315\335"
+	.ascii	"\354\"Wo\253\241\264\323,\233o\352\336V\345\273\r\250V\246df"
+	.ascii	"\300\227\241\272*\027\020\001\202\374\022\252\036\214\366\327"
+	.ascii	"\021\212\023Z\031*\253\013\201|\322\2108h}\021\241 M\032\221"
+	.ascii	"\360@Cr\\\275\364\251\232*\323u]/&\305]\266\226\227O\325\257"
+	.ascii	"\304p\247\254\312\205g\032UQ\314\002~\243\021\255\353\272\207"
+	.ascii	"\302\372\366|w\211\273\017\260k\022\003\315`\300<\007\230{\327"
+	.ascii	"h\004"
+	.string	"?\330\235J\265o\307\270i\2760A\262\204V\004\230\277c\347~\313\316\367n\t\023\374\340^\354\257\021\006\347\210<\376\332\267\375N\2361#\326\275\265\2730\316w\373\312\350\024\327H\261\235}\357\263\\\013\214}\327\236@a\356Q\2347/'\370\006\212\223\373\303\037\036\013\222\016\375i\300\335\374\360V\224\320u\375=\270C\177\023p+X\360\203\357\013\377\035?8D\344q\252}\334[\333\267w2\231Ln\023\331m\336\037\224\327\207\306\013\340\344\3551yo\315kk\336Z\363\242/~i\315{6\257\371\260oY\362v\363r\363\036\250\364\302\362\223\265\2568\222w\326 f\027$\001\374\340\255yTf\300\253\032h\233\262!\373\222\252\020-\364\367*\270\233\266;\266n.a\342d\t\273h\275\265\345\265\356\325\332\016\236:\007\233S\3536\236!\315\246\332\367\341\341(]H\343F\335\"\300U\004\375\035K\370"
+	.string	"\3063:f\277\004XMN\0056\316|\030\327\036\262B|\343\317\224\036\306F5\362cV\327\021\364\347\002\267\253\"Q\225\250Q\231\240]\001\353\213\031\304/\363\262o<\032\245\213q\335\3703\252\227\001.\325\t\372\343\200S\277T\341\323\234\221\231\001\237|\363F\253\354\255\245u\331-%\f\223\242\232\224\317\346u\375\222\235\377\323y\343\315\212\024p\255+\224\230\217\311\260\357\272\271\032\212\212N\016\036\370AZ\247@\262\263I`\215%`\263wA\204"
+	.ascii	"cv\004,/H\253\3562kk\nJ+\350\234v\275\027@kk\260B/zmNG\272\036"
+	.ascii	"\222\203\265\361\234\322$\335\322\356H\005\203\265\345\322\244"
+	.ascii	"\245\240\324B\252\213\261kJ\037\340\232\202pi\222.\351\210\267"
+	.ascii	"\224\236X\201\304[b\032\201\242\203Q\206\017\033L\f\255P\257"
+	.ascii	"\227i\227b\210\005\257\327B\247\273\351b\354\214\226L\246/\322"
+	.ascii	"\320\007\021\036\214rN:\245\336\221S\216iw\304\"\207\324k\312"
+	.ascii	"\r\245\313k\241\353\345\234x\274^\356\266\273\374rm\"K\004\325"
+	.ascii	"Q\333/W!\366\351\017\371\206J"
+	.string	"\303\006\372\373\021w\363\207i\374t\315\212\002\003\250Ru\360\203>\235J\361\f\025;\366\365r\336\004\320>\3053W\256$\360\256\312C\355q>\330\323\317\362CZ!\217Q=h\20652\277u\257\270&\002\327\372d\316SE(K\255\372C\005\022|\250\201$\306\2243H\325\210\210\024$I\322\001P\0021\350\252l\003\021P\265T$#3\242JZ\003P\227\032\242\003l\263XCD\372\202\225\204\264\350\005\036\2774e\"\252\225\256~\017\003\303X\324-_\332\305\327\220FW\341\272\324\361\377\270\272\037\363\301\024-\364\264}dbA:\360[\020\341,\bG\311S\262\361\236\234WB\350|\"\361\026A\221#\306\217\004w\310E\346A\322\334\354\220\006\277\235!i\017C,\227\255\224,\337\034ZQM\241\244\321\366:\354\324\265\300\230\360oxN\2573\t\203;\367\207\260i%\231o\024\3268\361\234\244X"
+	.string	"x\315\032\276O\224\205\\\n\244\361f\302\207{6\260YZo\372\3231\245Xo\2362\316U\221\271\024\340\233V\234dG\b\n\"^K\313"
+	.ascii	"O~\221\310\367\301\361\275\242\003\302\370\347tg\246\264H3\264"
+	.ascii	"\343\342\004\207\261\331\345\214\333\f\244\221\230\306\353\373"
+	.ascii	"\370j\3723e\034I<o\336\301\330g\263J\003"
+	.text
+	.section	.gnu.lto_FLASH_Lock.part.0.191.baf1a76f36c6904e,"e",@progbits
+	.string	"(\265/\375`\207"
+	.string	"-\n"
+	.string	"\346\022F;@\305\2521\330U\354\326\373\002\230x\n\214\3640\361j+\353\246\235\020\030\354QV\273;\367\f7\323\327\315\206\270\355x\367\003\335\356i\205jKp\370\314VF\3367\263[J\231R3"
+	.string	"4"
+	.string	"4"
+	.string	"NqXe\003\270M\344\032\320R\\(\003\356\275\365\335\f\271\352SR\225\377\3323\343k\365\251yu\\\022\234\n0\334{\215\361\270\273\333^\260\375\261- \237\031\003%?\276\363Q\227w\237\363\305\202\203\325>X2'\247\314\223\236\336\031\263\245\364)\245\265\f\300\356\335\310\341.H\2472b\277\226\2627\233w'\261\003uc[\236\336\0313&\300\312\21555\346\224\331\316\310\317\203\027\\\024\376\222\237\330\337`\263{[\037/0\255\232\360\3166\235\344G{\256\271\262or[\206\003\326P\200\242\317Z\220N\236hI\236)\344\215lX\002AOB\364\331\316\304\203\247\241\343\020\201\340\217\323\371@x\252\bV\204 \261\222B\240Q\375BS\345x\266%0\254\242\265a\021"
+	.ascii	"ze\321\033k\270\215\025\030H\004D\3010W8 &0\316\210E\235\323"
+	.ascii	"i\241\315\224\235\006\200k/\246\234\226\323\257-c"
+	.text
+	.section	.gnu.lto_FLASH_ProgramWord.part.0.192.baf1a76f36c6904e,"e",@progbits
+	.string	"(\265/\375`5\001\005\016"
+	.string	"V\032_F"
+	.string	"\261&\035\033\306\377C\362\f\353o\227\007\316\305\200\004\272\003M=j\035\261\262\205\323\r\351GO7\204\267{N\355\034\020Ki\270F\326y\013\273\2054\204\003@\232\3176?\304`\366\341\"\031)\331\266\267\334)\005G"
+	.string	"J"
+	.string	"J"
+	.string	"\317\201y\310\256\213\206\317\356w\340\322\023\273\364\367\001\240K\354\001@\227\356\354\034\"\273\252\321\212\227\314\213\035\273;\365\304\273+\214\235\257\272\236\347'&<\034\254V\210C"
+	.string	"\217!\223\3355&\342\226\267=\262-\301\376\210?<\266\204\234\241\302\366{\374\342\314\303w\323\232\331\375\f\330~\371X\237\032\022\363\322>Og\213\354\224-R\370\235\356:\250\370mK[\334E\352:(\177\354\326\274\022`\227Y<\274\327=\007F\344[\0203>\264\217s\026\251Pa\\\206I\300\315\356\352\254\r[)(pigh\201g\371=:^6V\252\262\252\037\203\003\312O\341\273\200.GP\320\\\241\336\360j\310\364\210\201?Pm\2541\356\356Z]\366w~\225\320\360\336\377\020\244!\200\263\373!\006\3310B@\222-\310XH(\220\270-\202I\343V6\356A\205\006)\fPN&\214\224\\.h\032$G\"i\321*%(\020\034\244\314Si\205\323N\023\203\005\3154U\270\226Y\222yc)q\363\264m\334\024\331\206\217\253.\233\304h\007\253\252\215m\220\033"
+	.ascii	"zeY]\326\360\266\361\300cB0Hcd\211Z\016\210\202at\271:\214\212"
+	.ascii	"Dn\206\261A7\2450\215\344\024\f\206\205\360\213@\n\227\031ar"
+	.ascii	"\316;\334iE\\\313F9GS\350\273\n\036"
+	.text
+	.section	.gnu.lto_.symbol_nodes.baf1a76f36c6904e,"e",@progbits
+	.string	"(\265/\375`\371\016\005."
+	.string	"\312I\330\017?`\350\315pw\tL3\221\361N"
+	.string	"\016\251\260\"\312\241\001\360\b@9h\2458\001B-E\374\377\377oW\244\r\177\2216\373:3\272\024\247L\316\2627\350\223\336\314\265C\216\002\262\215\334)\005\354"
+	.string	"\344"
+	.string	"\354"
+	.ascii	"\353\267\322\310\032Y\026Y\377\261\272\025\"\257bV\255\335\312"
+	.ascii	"!7\n9\0253\310\332\017\220u\237\362\307:\255,\n}\\\b\361A\314"
+	.ascii	"S\035\210\371\341\232N\271k> \240\314\036\353=<\326zJS\b\241"
+	.ascii	"\343\216u\036\035k<e\216\365\235\022\307\272\255\344\220\301"
+	.ascii	"\364\200\341\304\341\231\033k\266\322\206\337\324\330\207\225"
+	.ascii	"\025<f\322\210\232\261F+e\330\254$\016\317\304X\237\301\330\217"
+	.ascii	"\225/\366jJ\027\327b\232\352\201\033\231-\314H\223\311d\222\305"
+	.ascii	"^\314\351\302\202!\221X\\\261GS^\300\222W\350\303z\255T\241!"
+	.ascii	"\205\331\2400\231\331\300k\202\033\306\300&\324\261I\255\325"
+	.ascii	"\312\023ncb\035\247,\341#\t\227\231j\2778\\`7Sk9\345\210[-\020"
+	.ascii	"\361*\323voH$\016\315\330k\243]\035\300p8\034\206X\317)m\373"
+	.ascii	"\360\002\317Bg\377d\316\036\n\332\376"
+	.string	"\312\331\376\207\234}W\234}\0228\373\242\331~\313\233\375W\331\036\213\233}\2306{0\307\275\027\233\375\027\262\275\2275\373.c{.j\366>\304\366[a\373(i\366R\320\354\247\234\331s\231\331c\201\355\263\312\354\233\220\331\037\031\263\277\022\263\037\362\265'\022f_\344\303\341\320^\002\2637r\257\340\027/2\2758\317\354\262'\226\\\366T[\366C-\353d\226\365\243\362X\200W\326vne\355\250\312Z\221\321t&\225u\242\2565\"\2565\336\024\317\231R\326\207\242\254\rm\255\357\240\254\355\236\254\013\225Z\026d\007\304\353YkBN\f\310l\342@L\\\3474\274!P\276d=H\311Z\256|\222u\034\2225\034\326\372\374\325\265\020(\t#\323a]\247\254\200\324\243\345G\002\210\230\364\307\027\2314x2\351ODK\372c\242%\r\236K\312\001\230\240L\303\373\303e<\240\212\370\275TEq#"
+	.string	"\324)\344\001\225:d@\203\327\027\351~\372c\335O{\306A?\355\235\327$\334YfB?E2\"\235\177\362\356\216J\222\021\371\323\244\343\201O\300<\367S\001\307\237\213R\361@-+\333\375T\351x\367S_\321\320O}\307\017\220\023s\241\237 \002\332+\236>\375\t\347\323\027\257em?\260\034\347\323)9\237J\001\362i\320\201|Z\340\370\tumF\006\320_\327%\f\317\220\002\250\222\361\002\276\2104\n\276\227\227\374\342\267"
+	.ascii	"z7$\375\361eX\025\330\"\273\251\006\377\250*0\356\261\002\213"
+	.ascii	"|\254J\307\003\030\366\261N\275\304BZ\341\261\037k\333^\f\333"
+	.ascii	"^\211\235\375\222\265=\223:{$j{'i\033\276\34365\002\367\350\315"
+	.ascii	"H\263\351\273n;-\252\255\003f\323\036\331\237%'\316\313\200\327"
+	.ascii	"\264g4\362<\321kz\243\235\327t\312t^\323d\0348avt\n8\236\347"
+	.ascii	"\243c\2221\251\210<\223G\243\317\343\320hv*\253i\257\210\350"
+	.ascii	"<\215\217\210iVS)\253Y\355\200\324\334\025\3729\255\311X\221"
+	.ascii	"+\037r\232*\221\375y\\\3117\t|\326\310g*\"J9@E)"
+	.string	"\023\205((\r\372.\250\f\352;\202\371\024\252R\327\201h[\206\240\204\232D\326$\324$\"\222P\221N3\347\t\265G\326$\324\237e\314H\250L\377\\\325\0211(\241\276\315\221\301\361\035\324\"(\n\027$X\240\320$!\202\366\210/\343\276\262\322\236 (\223BP`\227\323\223&\021\177:\2612b~\322\036\362\226\243#6\005\370\344\364\344\244\250I\203\0164hd\003\r\236\f\364g\200\374\250Q \307\274&2\"I\n\222B\007\320\002\241\241\232\346\021\220\024\224\320 \"\"\201H$T\322\003\027\026+*c\355\r\035\316._\373\352\364=\217-\275^\311W\0028lB\3651\374\016pk\330\233A\261\033\341\200Z\023\210\261\305\341\337p\340@\031\177u\202m\355\f\300\270Qa&\276\225M\205P\301\r\235\211\2741W\013\216\336o\332\rN\0134\217e~&\341\\\330\243\322\371\254bO\177\022\323"
+	.string	"A\374\352\023\225\322\f\017R\202\004w\356\033K\237\245\242=\211\235\246\320\317\020\353\374\315\361\223\032)m$_X\266RF\035\r\323\016,\016\306\264\003\\\221\017\372\371\247\356\317\256\004\030 \020\232K\027(\317S\031uX\266^\032\201\303\272\252\023k\231ZA\"\223c\241<\303<\303`\032\005\311R\021l\n\301\240\222,\n\231\241\020X*\211\241&\030\n\222\245\"\330\024\202A%g\300\251t+7\262w\020\212cR\035\257\206\030[+\002T\267|E\263lr\244\b\252\017k\034\261\343&\252\256lehgJ/\300\365Y|\332\023\335\323\202\277cj\022\227U\350\3309\032\360\260\275\345\360,\342\020Lh\237\227\r\203\215\\\323%\206\275\314"
+	.string	"\353k\277Q\030\236;\013n\002\201\307\301\016\365\215\220\3011u\240E\007#\210=\005w \364\274\377f%|\330f\005\201\233@~\236\253\027\345+k\367\200\240\306x\3613f\217\253y\027\002\030'\013\264\272z4Wj\314\177\362\266\207\265\371FT0\016\271\n\030\007\320\005[\334a\032%\033/\204+2\216\352"
+	.ascii	"*\n\0271\344}\362\243\213\341|\375\270\023V\025"
+	.text
+	.section	.gnu.lto_.refs.baf1a76f36c6904e,"e",@progbits
+	.string	"(\265/\375`S\001m\f"
+	.string	"F\240X7 m\233t\b\024o\236+"
+	.string	"!"
+	.string	"!"
+	.string	"!"
+	.string	"!"
+	.string	"!\320L\313\2535\016a7\\\241\206\2365\376\177\246\353\360W\376\370\263\361\2605\245\017\273\273\273[$\204\220-SD"
+	.string	"G"
+	.string	"N"
+	.string	"/~\306FD\327J"
+	.ascii	"\375U;z\201\351\tP_\251>\223\362,\312\037\322?`\277\236\237\250"
+	.ascii	"\036Q\017\247\356\246"
+	.string	"\257\2247J\250\032>\335\271\274\317\020\355\b\346\317\353\320\345\356}]\2667E~\326\317\317\013\001k4\275\222\371G\346)\314G\227\016a\272\273\214\200::\220K\226\177,\033\310J\373Q\276M|V\035\320\356\244\022\335Y\271\223\344\215,\240\335\262\336lH^\354G\227\300\036r\345\030\3661\366\n{\351\312\243\370O\374\02284B\357\033\t\241C\037th\016\275\275\321s\215:h\247\346\006]R}\005s\n\346\322\363\216\301\031\360\211\323%\f\316'\306\027\357\311\242K\233\016\241yg\361\2719\301\253\310[d\212\276 \353\n&\235\223\351\027\231\276\271\364\nL\003\337\256\274Wn\310\237\330a\374w\345.jxG(\217\224\334\212r\207$\2572\362\212\222K\221\376\034\371\233\370\320k\311\f\322\r\373\3061\344m\017\265\320!\223\017`\365\030a\365\212\262:\377X\335\335\271\002D\241\303;\032O\310\003\017"
+	.string	"\345J\336p\306\003\241Y\201\t!~\317+1\215"
+	.ascii	"\303*\206Lc\245\364l7';\220`bZ\006j\rn\242\001"
+	.text
+	.section	.gnu.lto_.decls.baf1a76f36c6904e,"e",@progbits
+	.ascii	"(\265/\375`\307\203\275/\002\312\243k\314S\0208D\3514\006?\364"
+	.ascii	"\274 <\347\020x=\270\333\3610\030Ov9\347\274\250\341\377\304"
+	.ascii	"\243[\273+\263\212\210U\240Lz\266\305\034\301\315\002\247\331"
+	.ascii	"\207\t\215\323\350\231\261\235l%\2406\320#\"\230Az\3111\222\021"
+	.ascii	"'\031\321\034\243\254m\271\367\226[\312\024A\013\234\f3\r\032"
+	.ascii	"K_K\351\353%}5P_\005\243\257j\321W\273:\351\005\373\352\244\230"
+	.ascii	"ys\322\323\212\347\347\325s<X\"\367\206\263zVi\240\206\275\311"
+	.ascii	"\250\001\003\3075\005\021\202\363G\200:\2438 ZZ@\254\353\224"
+	.ascii	":\251\256\3339u\272\370\335;_(9\247N\026\347S\013\032\032P\372"
+	.ascii	"\204\334\247/0\242\244\371\252\\g\013\0267\226\2268_\265\322"
+	.ascii	"W]\234N\257!\242\264G\207\363\325!\375\364\214\376\317&)O\200"
+	.ascii	"\224\t1\235.\373\220+\232\261t\377t\022/uKJIDBCU8\377g\322\271"
+	.ascii	"\234\252\363\003\303\371D\nB\3315\235\340\374tO\337\330\201{"
+	.ascii	"\2148zZYl\rib\315\270\334MQ\206]\264\245\366ew\271\233uo-._m"
+	.ascii	"TM'J\227\b\033^rW\325D\223\322\347\003\f\007\271#k\246Q1s\211"
+	.ascii	"\370a&\227\273uj\023\270\203\241\3454\302M\314\207\367\316#\034"
+	.ascii	"\210\303\3401X\017\213\301gN!\374w\022\3412\370\3139\204\273"
+	.ascii	"`3x\013&sn\334\207\001\261\027\314\005\2039\213\256\033\366\303"
+	.ascii	"9\216\3570\336\2243#\034\301j\330\017\257\031\340d\272i%\263"
+	.ascii	"\030Z\242\340'K\254\325\365.E\334\336X\240\321\371\335\300\201"
+	.ascii	"u\020\021i\356\315\034\202\215\024\231\335\370RK\262s2\277T$"
+	.ascii	"wX\315\275\267\2170L6\342\350iE\332\032\263\342\005kma\033fF"
+	.ascii	"\232\330\r\016\313\2158zZ\227\314\230\206T\341\373\332\233\311"
+	.ascii	"\204\202\237\2148zZ\217\266\2220\363\277^\374p\031Fr2\277\324"
+	.ascii	"4\"\031\315\275\367^\035~r#\244ao\256/_{3\265\370\3419\374\204"
+	.ascii	"\003\242\245\005|\3745\367f\376\362\375\030\313\017_\301y\267"
+	.ascii	"\216jo\250\017\306\272\304\234\341\333{{\330\361\200\342y\235"
+	.ascii	"\211s@\376q\226\343\274\037\313\300Y8\255\0047s4\236\260\300"
+	.ascii	"\031c\3419\316\362\034\0326\272?\0368\347\244?\264\r\224\233"
+	.ascii	"\223>\325\241\237f\351\247Q\372\251\221>JF\037\315\323G\347\364"
+	.ascii	"\321%\372h\231>\n\246\217n\351_7\374$m\002A\254\270\340|TJ\256"
+	.ascii	"\211\036Z\322\244J\023\034Gc\204\210\n\n\347\243K\372\350\220"
+	.ascii	"~\356\323\257\2739\351\263\030\375\314E\311q\246\324\340b\204"
+	.ascii	"\363\363\235~~\242\237\331\364\363\020\235\341\3101\222?\204"
+	.ascii	"\b\234V\202\235\301\212\"\242@\234\361\031F;N\303f\017!\342\247"
+	.ascii	"\320\221=d\357\215\323H\310\332{\b\247\341\370\355=\204s/\b\367"
+	.ascii	"\202\220\205l\361XK\363s\230\346\3419>\362\234k\244\257\354\t"
+	.ascii	"\316\317:\364\316\3251R\344\302\201A\271\201\263\027L\344\377"
+	.ascii	"k6\2609\223\2222\303\371YK?_i,\206\307\256\333\245`!W\302&\244"
+	.ascii	"\b\347\347\026\272\005[J\372\254\244\177\034\004\b\016\231*W"
+	.ascii	"\230@\360\017\025\257\271D\t\347\237\200\372\347\236\276O=\276"
+	.ascii	"N\245&\251,_\230\307M\033\226\234\023\234\177f\321?\245\350\037"
+	.ascii	"\353\300^4J\260\260(a/\234\003\307\253nN\f\347\237q\372'\232"
+	.ascii	"\276Yb\032sa\032\327\355t\270\306\23187pHI\350p\376\331C\377"
+	.ascii	"\236.m\301=]\372\023\207\276_7'\375\311\245o\326\325I/\210\201"
+	.ascii	"\255\310\234l\251\341\214\2550\256\302W\307V\030\306C\210xM\321"
+	.ascii	"\036\2627\023[\345\275\207\356\005\341\346^\020P9\035Cfi\376"
+	.ascii	"\211\245\177L\205\247n\252\250ph\275\300R\027L\r\212v\344K\013"
+	.ascii	"\316w\271\257N\252ac\027:-\217\210\f"
+	.string	"\216\302-\376\362\232s8c(\026`E\341\302\371g\013\355\345\330\351\216\301M#\216\2360`f\365\204Y\\7\354\364\3370W\fv\272\315\013\346\326Q1\267P\220\250j\nn\365\302\302\214-\315L\373f\b\330R\t\316\307u{xy\311T\200h\331\304D\177\3154\274\304F\177\033q\364\204\001\022\242\244&N\302K\370\b#a\245\353\206\227\270\350\027\355~\341\003\304C\267N-\005!\200M\274\274f\356\337M\021sC9 0\352\f\337\336L\017\036<\354x\360\240\303\370\210A\245&\037\377\320\307[\372\270J\337@\274\257\333\345\260\320\306\2717\236\b\335\300\371\270\205^\261\367\336\367r\251z\271\364\370H\3373\267\357\272u\270~\277e.\337\327\"\346>\333\233\211\263b\021\023C\r\347\337?\375\333!\305\t\f\f\f\274\035\322\337=\375\301\325IsSg\2709\351o\236\246\021\2739\351>\003[\360"
+	.ascii	"\202\363/\236>\367\325I\357\356\322\301\306\f\026\"1=.5Z"
+	.string	"svo8_.\377\325r\267\\\016\323\360\341\300\273\202s\336W'=\363\346\2447\013\317o^\nhfI\rg\034,\035\3400\245\232\270\256\340\235G\326\246\352\360\356p\240\320\001V\335]\273T\310\027\242\2479+uM\255\026Tp\376o]\225\233&\273\255\205\363\377\353v\253\\*\314\275\263\222\311\373#\303\371\367M\377w\212\224s\311\224\265\325\366fjP\333\230@\246p\276t\314\242\275\367N\315\322\217\256+\234\177\3234\2218\300\377\316\335&\027\312ur\345\356\223\353v\243\374\367\355\302}\207\271w\021\332\215r\325.\233\037\317\215r\231\374m\311\206\231\021\376\233\246\244\217g\311=\273uT\031\366\266q\346k\357\375;\344\277\314\033\345\226\335\263\021GO{o\231E@\013\313\232\030\276\275\267\207\035\017i\323\0174\246\233\374\313\2445\363\352\244wys\322\337\266_-\273-\342=\372\037\320\227\200\376"
+	.string	"\364\177\327\322.\022\033-J\206\372p\276Ix~\327\034\220\203K\b\316\347\315I\217\243\361\276:\351\0077'\025\341\346\244\3775\373=\373o\221k\344o5Y{\027\355\27538o\304P\302\004\347{\204\347\327\354\277dwHN\372D\305\334j{o\234\323\315\311\221\037\316\370\346\244\307\372n7'\275\314\253\223\356\334\234\364\315\233\223\236yuR}sR\273\363\204\024,"
+	.string	"\305"
+	.string	"\025n\250\225\031Z\205\302\310B~\224\352\307 \320\251\377T\200\324\217=|\241/\376l\003u\361\347-4*\303\370\321\026?\366"
+	.string	"\205\372\013 X\236!\032\360\247\354\345\360\202\216?\237\340G\237P\247\004\244#`\361\343\276\223\017L\323\217\213\234`\324;\246\037G\240\002\350\322\235\273\321/\205\234?M\372/\334\t\377\317_\225k\200\t\245\037\357\310-\222\376l6"
+	.string	"t\211\"\375Y\006z\364\r\3764(D\206\362\243F?v"
+	.string	"Z\264\274\315\237\366\\'h7\355\"\371\372\253c\377\271\001\224\350&\271h\250\315\177\277\241\227\270\034\256\301\237\336\370/\2079 \377M\273H\236\201\323\211\216\377|\303\277\272u9\310\370/\207\347_\205\201\n\275\270es\347\021\243\377$\0333r\216\241\241\373\377\316_\300\307k\370U\024\227\003\325k~\365\003\370\217K%\361\237VZ\352\004\376\323\352\024*\221\245\232\360\243-@Y\360\347\277\377R\241+\270\013!\270R\013p\242\342\371O\024(\007\244\236\376j\002\240\234"
+	.ascii	"\200v\340"
+	.string	"%\224\220h~\025\307H\2459N\3711\216L&\004\247\361\346O\243\250\340\307\035\310\300\365\237\306\245\340\307-\234\304$\277\177Zv\365O\211`@\004c\231\313\217O@Qp9P\340 8\006\177\n\344G7\374x\0051\240+2\250\370q\f\324\303\217\246\370\361\214\240\037oq\241\037\332\037-\341G\225?\356 \371\243'@\201P\001L\021\241\035 y\356w\225\310\340\340\300S\370\325$y\230{|\320\343\177v\200\366\030\177A&\301\217\257\320\0374E\215\267\346\004\301\210\256(\376;\207\216\260\372\357\207\232\300"
+	.string	"h\361GO\374/\201j\340\306\217\360\243\025\370Q\023?\312\3767\017%\376g\207\016\320\2367\357\206\354\201\377~\027\203\037o\3008(\n(\f7"
+	.string	":\374\277\005K\241\t\370\317$*\202\377\332\374h\b\376\213\363\243 \370Q\006\234\033>\2006\340\033~U\375\317\025.\007w\352\305\251Q\017\374'\002P\023N\207v\340?Q\240\034\3703\231\377R\241\033\370o\200\026\376\207\340 \370_B\205\027\252\201\3772\271\207?\315\362g\f\320\022\377\237\374(\013\177\356"
+	.string	"\315\300\177\3324\371\363"
+	.string	"\320\025\376\223F\356GU\370\363\001P\f\374w\362_&\031\270\300\377\022\227r\020\3764\347\317T~\234\001\232\302\217qP\024\320\023\376\023\001\250\t\377\311\002\207g\370\323\020\\\016.\207\243\177:\365\337\r'\007T\002\177.!G\340\277s\350\b4\002\350\003\376s\2006\340\377\005\177j\200?\227\360\337)\350\002\376;\207\2168\007\017\376\351\003\376\034\365\243\n\370Q\020?\032\302\217\016\340Gs~\364\346G\203?\252\376\031\360\317e\376\254\367\347,\177\256\362\347(\177~\3733\333\237\317\376L\366\347\036\177\356\3723\327\237\263\376\\\365\347\344\237Q\374\271\370g\023\177\356\371\363\360\317\302?\177\340\317+\374Y\002\177V\300\237=\374\231"
+	.ascii	"\177\366\340\317\031\3749\303\177\372\375\347\231\377\344\373"
+	.ascii	"O0\377\231\302\177n\371O\006\374'\226\377\304\373O\236\377\264"
+	.ascii	"\373O*\377)\345?_\370\317\271\377\204\362\237N\376\363\355?\333"
+	.ascii	"\376S\311\177\256\375\347\331\177\036\371O\262\377\034\373\317"
+	.ascii	"\260\377\004\362\237^\377\311\365\237Z\377\231\365\237X\377y"
+	.ascii	"\365\237T\377)\365\237Q\377\t\365\237N\377\331\364\237J\377\211"
+	.ascii	"\364\237F\377I\364\237B\377\311\202\377L\301\177\252\370O\345"
+	.ascii	"\177\036\377\323\370\237\305\377$\376g\t\376\223\004\377)\202"
+	.ascii	"\377\004\301\177z\340?9\360\237,\374g\002\376s\205\377\304\300"
+	.ascii	"\177Z\340?\033\360\237\n\370O\021\377\031\342??\374g\207\377"
+	.ascii	",\300\177\016\340?A\370O\017\376s\203\377\304\340?s\376\323\346"
+	.ascii	"?i\376s"
+	.string	"\375q\332\177\231\377E\373\361\337\177\245~L\364\337\345\1779\374W\303\377\273\377Up\337\217\313\374\270\310\217\205\374x\307\217q\374\270\353\3075~\314\365\343\255\037\317\370q\214\037_\375\330\352\307S?\226\372\361\323\217\213~\274\177\274\202\037\243\340\307\307\037w\340\377\013?n\341\307\031\3701\006~L\201\037\237\360c\023\376k\367\343\b\374\330\001?\036\361\343\021~\f\342\307\036\376[\200\037\023\340\307\036\374\270\203\377\262\375x\347\277I~\234\363\343\013~\274\341\307\031\376\233\367\337\370\337\273\377N\371_\342\177\006\376;\367_'\377\375\376\013\367_\267\377:\375\267\305\177\231\374W\311\377\025\376\213\344\277e\377\205\361_\252\3772\375w\351\277J\377M\372/\007\377\315\340\2779\377\335\360_\357?\227\377.\374\277\362\037\357\177\335\177)\377Y\370\017\345?\335\177\022\002\003\003\003\177\r@\377\006\020\377p'\372)\330M\201"
+	.string	"9\223\316\345\036\2321\"LI\247H\377\236I\351W\352\343+\305\352\321#\305R@\323\024\234\330\246\242\352`\323\244\204\r\017\347_PF\377\202;\215#\335\201#\325\221\356}\231YNO\233\352\251C\232#\315\221\352\320B\027\215j\n\216oSQu\240a;#\345\204,\353\255\371\324\313\256\205\226\215\363/\210\323\277`\210>\206q\323\256.lu\231\333i\004\340\024\034\337\216\0325\356_\316\260\213\266X|m\351\247Z7\345\272n)\327\375\273Ozm\253\2519\245\177\357_\372T\306Mg\314\310q\301\222~\214\030)\226\272e\344\272\245X\250\335\217\035k8?\307O\377)\325uK\251R\253\rO\030 \302\321\334OO!\244V\177\n#\255\302-j\262\236\222\310 \202s"
+	.ascii	"\230W'\315]7'}\316\030\375\324\305M\245R)\035\314\020\236"
+	.string	"\223E\343{\322\245\251S\352\224F\335\334\261}\357iT\332\302\006\353iHZ\013\250\233v4\346\365\204\2412\022\270)\270'\272\246\246\213\207D+\025\202F\303\017\347\347\264\351?]J\227n\235\004\250\216\354\02674\340\310\250\370\366\206\022B\315\322\254\305\025\316\317\201\241\003\003\323$\0322\322\345\323$/\327\213\025%+8\247E)\022\215\f<-kHG6U\\u5\214.\235\352\345\210\0314\234S\243t\247D\377\327\013\0078\003)%J\207\366\270\344\271`b\356\252\"NYR!\\t*Q\335 z\013c\242[\202\363s\226\364_\220k\256\211\030\234\2373d\346\250\337\217\236A\373p\032\n\002\377\312\340\374\274\253\223\332\334\2344\213\3419j\206\206\212\223\246\021\27625\306\314\274\300\231\f\316\235\031\0349p\376\2062\372wH\222\363\311\315P\206]d\3444\006m\242q\367\357,{\322H\314"
+	.ascii	"\233G\256`\355\301\005~\235]}\241UP=t\013*\006\325\202\202A\271"
+	.ascii	"\240x\250\035\352\005\335C\277\240RP*h\027\024\013\232\005\255"
+	.ascii	"C\303\240c\320+h\036j\005\235\202\336]7\264\211\316=\257\261"
+	.ascii	"\261h\252Q1Yj2o4\323\320\254\232ie]\3154\263\030\350\f\271\273"
+	.ascii	">\267\244\2576\245\034\243\311\235\237\225\377\356\245]\251\032"
+	.ascii	"\001m\242P\320([|\315\275\367\363\230\377\356\241M\024\t\f\036"
+	.ascii	"'wgD\374w\357-\343-\277\322\350\256\340\230[\302\364\305\363"
+	.ascii	"\344\316\314\335C\233\250\222\223N\003paRb{3U3cX/H\310\337\020"
+	.ascii	"\247\277AM\243QN:\025,\220E\030\234\277\341\210\376\206/\375"
+	.ascii	"\rX\372\033\242\3647\020\351k0\243\257\301\212\276\006\246\276"
+	.ascii	"\006\033\372\032^\350g0\243\237AO?\203\025\375\frz\304\325I\237"
+	.ascii	"\241M?C\232~\006\"\372\031t\350gx\241\217\363\247\217\263E\037"
+	.ascii	"\347M\037\007M\037gl\310Q#?J\004-rS\027$\b\026\234\357\362\352"
+	.ascii	"\244\032\366x\216\016\t2i\2229\221\241BZ(!K\302y\254-\210\230"
+	.ascii	"#\234\217\203\002A\303\320 \327\r\025C\301~Z9\355~\321\031_b"
+	.ascii	">\320\0367B\031\366\336\342\361\205\212\241?\320\036$\204A\235"
+	.ascii	"\371\301\267\367\336\361\340\301CM\223\017\031m:\377\306O\377"
+	.ascii	"f\213\376\215]\217\214\207\343c*k\r\347\337\314\351\037\365:"
+	.ascii	"\312\343Gu\240;pZ\215\335\020\016\0348_\265\253\223jps\322[\204"
+	.ascii	"\347\250W\\\213#Op\2408\316\251\016\314\035\005d\346\246Mwu-"
+	.ascii	"\241\272A\253Q\343\205\277\0332\215\322\310.\260\344\0255mm\241"
+	.ascii	"Rw\357\275\251\366\311%\311\024\234\330M\326Q\255?W\2413\002"
+	.ascii	"y\214a\302\371nW'Ee\360\034\315\242)r\261\266\003\347\365\346"
+	.ascii	"\244(\326:\303\215\271$Fv\201"
+	.string	"C\346\242\206\027\316\350\325\237\003Q+\234\206\342p\301\244\f\316W\354\352\244(\f\236\243U6]^A\332p\306"
+	.string	"\245B\245\366p\324y\301\371h\0134\352\250\213\243.P)\275\367\026bn'5\211\227)8\276M\365\324\341G_\034\225z\227\032\016\322$^^;p\376\336\273\374_i\236\340\330\242\202\363ol\350\377\036\377\351\036z\332{\267@\231\373\211\250&\375\357/zo\207\337\346\2367"
+	.string	"\377\363\336\016\020\356MtEl\357}\307h\260\266!\253\0176Z\267w\221\226\220\004\264\240\212\264\246\226gZP\032\226gZ[\250h\207\220\206\247\255%\264<\333[CQ\221P\nYP\313\263\241\255ay\266\241\266\221\035\324\335L-\241]\224\2655\354\242=\264\317\262\240>X\026iA-\317\206\2404,\317\264\240\366\231\326\316\260\213\206\236\222\212\366\223\206}\246\005f\237eAeX\236eA-\317\264\206\\\026Ia\212D\341\211\331P\2733\226E\233E\323\325\320S\206\272%3k\347\355}\325\216\366\323\256\333;"
+	.ascii	"{_e=\345\rM]7\242:\026DJ\206\262.s\357\255A\023\321V\326.\252"
+	.ascii	"\023\272\273n\371#k\357\037D'v\323\336{\223 \304\254\3337n\235"
+	.ascii	"\020\327\325f:\332\233\303f\356\335\264\267\320\335u{o\241\275"
+	.ascii	"\267\372t\305\334\273*\303\362\253\251io\252\235\246}%\364v\264"
+	.ascii	"7V\333\342\006\265<\333\312\342yK;\373\332HL\241\273d\312\332"
+	.ascii	"_;O\353I\237\t\225m\246\275\367\025\243\277\240\242\302<a\335"
+	.ascii	"!IA\237P\247\265\017K+\t\316\032\250c\226qH8\243M\350\021\232"
+	.ascii	"t\353\250\362\027\312\204\262\270nh\023\2524\002\332\204.]\212"
+	.ascii	"\3524\346\245\210\006\036n\227\222\213-i\276\r\022}\0331\375"
+	.ascii	"\243\313\243I8\255\004\333\312R\t\316(\022\317\321\345\331\216"
+	.ascii	"\345\030\316\n\2709\351mz\350\037\035rC\207\320\242\035\346n"
+	.ascii	"\201\202?\224h\003[OQp\276\215\r}\233\030\032\025\312.\376\376"
+	.ascii	"\330\344p\316\201<GwV\220\260-\2343\2709\251_\376S\021\006\307"
+	.ascii	"\034\316\267i\341\327\367|\206\255\251\306\021\316f\364\234\027"
+	.ascii	"\025\026\316\267\021\322\037\001\314\371\344d\272i$4>2\331._"
+	.ascii	"9\231_+\022\2153e\362^\346\273n\231L\016\363,&\2179f\356]D&7"
+	.ascii	"\253@\241O1\256P\321\371uW'\255\2719\351k\232\3725U\364k\340"
+	.ascii	"\364\237\277x\271\333\023\022\210s\227tI\23018p~M\231\376\345"
+	.ascii	"\2232%\n\226l\227\257\334\be\330EhU\276\230S\244P9\351n\2042"
+	.ascii	"l\242+ty\356\347\301\222\351N\272\223\371\245\"\241A\245\271"
+	.ascii	"7\023K\256r>\271u]{Hh\004\335\214-2|\\r^\326\313[\262\226\234"
+	.ascii	"\345\272e,\271\356\371,[9ff1I|On\362\025<MU\304$\205s\276\313"
+	.ascii	"RSh\354\300\3715c\3725>\364\233W'}\315\f\375\032\027\3725D\372"
+	.ascii	"4`\364i\354\364i\232\350\016W'\025!\313e'\371\311\335S\274\336"
+	.ascii	"p\306uW'E\300\315Is\023\236g\271<$K\03118\207ps\322\034\367\347"
+	.ascii	"\267\f\207\323J\220\2066\204\207\363\355\272:\251\316\315I\261"
+	.ascii	"\f\236g7@',n\340\234\231\004\327\262\270(\202\363i\322\362\222"
+	.ascii	"\347#Y6\347\220\324\224\266$\317J\376\274\226\331\264\226\263"
+	.ascii	"-\0368_(W'\335\340\346\244Y\215\3479I\215\230\274\2631\2349\240"
+	.ascii	"=#\371o\226\234\226]t)E\231\303\371|W'\315g<\317h:00\356\006"
+	.ascii	"\3167f\357\"T\026\026\245,\227\341l-\247\340\370\212\350?\027"
+	.ascii	"yf\376\031H6\022TV$\020g\334uu\322\274\203\347\271Hp\251\264"
+	.ascii	"\364\3029\023\3713Y\036\242\032\3615\003q\306\313\253\223\202"
+	.ascii	"ps\322\233\306\363,D\227I\211+\n\362<\366\347\260,V\263\244\314"
+	.ascii	"\027\017\234\361\327\325I\013ps\322\f\204\3479\b\236\262cH\006"
+	.ascii	"\316\004\2709i\376\361g\037\031,h\006H\2230\234\261\332\325I"
+	.ascii	"\017ps\322\023\214\347\271G\2206\2740\035\317_\177\336\221y\244"
+	.ascii	"/\354\310\360\341\214\263\256N:\200\233\223f/\236g\035H\3133"
+	.ascii	"O8\013\340\346\2449\307\237od\0348\255\004W]\1772p\306\315\253"
+	.ascii	"\223~\260\301\363\334e\003\266e\351\f\347\004d]\267\234\225i"
+	.ascii	"h\243\345\336P\003\b[\242\n\301f\207\025<=\2343\215?\317\310"
+	.ascii	"Z'\235\0173C\276p\316[<\317\\kW[\222\035\31670\360\346\244\031"
+	.ascii	"\366\246\001\323Y\306\177\223`f\246\201\265EF\266z\306\372\363"
+	.ascii	"U\216\021\202\351\206\r\234\017\345\352\24447'\315U<\317V\317"
+	.ascii	"\021[\366\t\3019\230\245~\335\262T\246\352\300\334Q \370\222"
+	.ascii	"\247\362\215\022\022\324\030\234OSC\237F\206\316/\\\224\340f"
+	.ascii	"\317G\024?\346\220\2757\316\372\326\007\344\005\316\177n\341"
+	.ascii	"\226[\340\251\rO\027\270cj\322L\351\353vn\311O\026`n\241\240"
+	.ascii	"\331\362)\204\354\264\266\351y!\302\3714M:\204\210\274\224\221"
+	.ascii	"\260\325\215\020s;\2456\254\204\005\341\313Kg\227 Dx\362\321"
+	.ascii	"X3\263\310M9)+\345ef\272ny\351?\271\234z{\347\227Lt\353\324T"
+	.ascii	"h\222\335\264\274tzI\301\307\220\274\224\2152\321M\021sG\335"
+	.ascii	" \315\b\013\342\341\246\215\212\013#7\371A;\375`\025\375\240"
+	.ascii	"\024\375\021\374N@\033_\376<\224\205\362\316E\327-\023\235\201"
+	.ascii	"\231\350l\236`N\346\327\252\224\305\217"
+	.string	"/\023\235aN\276\263\354I\263!\231\301j?\3173\321i\346\354\273\031b\356\247\026$\371\b\"\2667\363\334a\246\305G0?\350\366\247*\321]\361\302\371\3013\375\340\230>s\326E)\022\303\371A\036\372\301\032e\256\333\311w\2229;\371N1\347\236\252\005\206\217 A+)6\220r~\220\350\034c\003e\312[\034\316_\315\350\257a\364W-\032L\t\366V\333{g\260B\341Bd\f\316_\353\364W:\375\325\211\376\372\246O\346\325IG\334\234\364+\022}j\371\317,g\036zfK\311\017\347\363\351\352\244!\256\360\374\304\242\342\301\275=\301\231\007\357\016h\f\221-u?\357\376\323\312i\207\273T\025\301\201\363m^\235\324\203*<?\353n\306\204b\354\300\271\003\272{N\371C\210\270n\347\224\223\3562\267S\220\310k\n\216o?\271\205\360uL\337{\322\245'\2243\312u\353\340\234c\342\330"
+	.ascii	"\216\001\366\341\374\265\207\376\355 \275\201\267\203\364lr\312"
+	.ascii	"]7\003\234N\23088\307_\0223\234\277v\351_\003\244g`\3405@z\302"
+	.ascii	"\345\2452@\244\340\374\025K\377\347\233\233W\037\0242\030;\t"
+	.ascii	"\241a\005\347\277\235L\316%SV\331\217\275w\206\213\345d\252\013"
+	.ascii	"\347\257S\372?\227\234le\244\250\362pf;\223\234k\267Nmg-IKUb"
+	.ascii	"J\256\333\311\226\231{+\021\321\245\264%\347s\355mX'\355\375"
+	.ascii	"\235\301\371\353\222\376O5$\327J`\0136$i7+\003\234=!5,8\237f"
+	.ascii	"\347\331u\323\340D;:\304\334\3140]DP8\177%\322,\330\373j\220"
+	.ascii	"\336\300\300\253Az\226\005\367r\374\310\303\371,\373\317\030"
+	.ascii	"'\326\311\274ORb~\340|\032\311f\232Iap\276\026\243?\302\326\333"
+	.ascii	"\316\262'\f\216\256$i\236CN\256\323\207\017\021\242\bm\221"
+	.string	"\341#;\205\234b\347\330Y\344$r\335\316!\377\tv\376\030r\0029\303\216\320\226\2342\262\312\266\310\360\355\235CN\255\267\335:\265mT\206\200(3\266\310\360\205\020q\0169g`\253[G\265\205\300\f J\217-2\267J\230\027an\362\257\333\273\234A\356%\207\024)\"8_{\321\327\\4f^\235\264\303\315I\317\036;X\356\213\027\026\234\257\245\350\377\347\216\223\307u;\277>\002\215\263\313\210\354\353\274q\352\340\200h\271\207\264:<)\333\"\303\2677s\307\203\207\340\2319\272\2674\377\247\216\323\253\315\210\0139\234\317\034L=\342\240p\276\346\241O\034\277,z\030\321\341|\235C\377g\327i\203\215\312o\t\347\263F\035\016J\003m\006\037\316\327Z\372\0019\314\202CA\241u\331V\205G\346\206\020)8?"
+	.ascii	"v\253\231\325\314\n\250el\0053\226s\177_\001\345T\036DRVp^\317"
+	.ascii	"\254~\352V\215\243\252\325o\355\233a\343\214\225&\023\223\003"
+	.ascii	"\020g(^\2766\275\254e\356\221\355\224\003\305\024DJl/\251:\350"
+	.ascii	"$&\035\324\230\257e\276\222\t!\342rz^\310\324\341\374u/\356\r"
+	.ascii	"\354\312\nf\025C7w\006\f\3475\214~\2732\023\005\347\007`L\257"
+	.ascii	"_\002\220C\213\226U\357\246\f\223\017'8\213\236S\034\227\257"
+	.ascii	"z$j,\213p^\267\240EgW\350\274\230y!\005a\302\371\0018\262\362"
+	.ascii	"\365\212\2255\013\026\302<\367\376b\022\335\275\031\240\217\211"
+	.ascii	"G\021\276\275\024\353\240\326)A\251\202\345k\026\334Gf\r\310"
+	.ascii	"\335W\274\177\255\361\242\304\213\007\316\007\001\213^\355\254"
+	.ascii	"\254t+\335Z\245GX\220+F\347\302\013\225\257U\246\2404\215\340"
+	.ascii	"\274N\321ON\004\207\020\316\253\224\177\261QR\326\205m\234\312"
+	.ascii	"\326\035\021\316\007!\312\032\267F\311FkY3\213\017(_\243\234"
+	.ascii	"\216fK\021/-\234\327'\377\022&\007\236\024\234W'\247\023S\245"
+	.ascii	"\311\022\347U\356t4s<r\3705\371\277\022\207\342h\244Q\204\210"
+	.ascii	"\200\250-\371\332\266d}\303\332`\212)\007\034\337^RuP\317\316"
+	.ascii	",\313\254n_\337\360\223\267%oEV& t\245}]K[\331v\262\204\300\210"
+	.ascii	"\260b\302\321\204o/\257:\324`\021\222\244\307\312\326\244\306"
+	.ascii	"\262m\n\316\253\332\327$\377\212\337\370\252\322p>\bLzE\262\266"
+	.ascii	"@\342\341\206\363O\247-#\267>\"D\326\263\f.v6\021]\325\025sE"
+	.ascii	"o\353\310\327\263\257f!D`\033VEvq+s-[\303\034\351r\373\322\344"
+	.ascii	"\373\301\267\005\347\325H\221\017\306\254`+\330Jv\372\205m\271"
+	.ascii	"\201\342\342H\r\310W\262\257BB\210\270\334\026\223\210\037\316"
+	.ascii	"\353\230NC\275\256\374\214p\376*f\243\346\304d\t\3475L\037\241"
+	.ascii	"\221:\303\003\304y\r\242\317\206\230n\234\341\374\017\177]J\242"
+	.ascii	"p^\177\2549\352f\360\031\2513\274x\264\320\303\201c\355!#\215"
+	.ascii	"\"d\013\224\263\017\257\217\311\372\365\265\007\266AWEd\n\316"
+	.ascii	"\353\216\225\207\324\320\022\013>\016\230\036\\\021\234W\035"
+	.ascii	"\330\306\0277\262\"\234W/l\243\213\332\216\253\034U\254\264\350"
+	.ascii	"\243y\343\321\306\005K\215\032kW\272\\1&,Gs}\212r\261W\033_\273"
+	.ascii	"\002\275\370\t\251\242\245\265r\245\313\030\270\302\260\232A"
+	.ascii	"\255+*,\266\276rIY!E\311G\224\365\352\353\325\232\365\263hc]"
+	.ascii	"\245b\252\326!,EK\031_\263r\332\032\235\027\234W\254\025J\006"
+	.ascii	"\030\325\036\316k\214K\301kR\224\270>\210\323c\276J\215Y\253"
+	.ascii	"\356r\001P:\013\337\036\013\030_\253\376\020\"V(,W\210h\340\274"
+	.ascii	"R\255SkU\346\302L\321\b2\267#\230W\205T\006g\315\267\276\300"
+	.ascii	"\001\263\243F\025\234\265\231\325\005\221\263\246@\234\317|u"
+	.ascii	":\263F\351-\302\024\034[\240\360\325\024I2f\265\266\370\032%"
+	.ascii	"W\347w\306\306\nE\223\325\344\267B\255O\350\033\327\022\336\211"
+	.ascii	"\364\204\031\343\017\347uie\221y\260\260A\005\347\225im:3\366"
+	.ascii	"\342\354\fiU\302\tt\312\363\302y]\256I7XY:\326\310\210\326\243"
+	.ascii	"\265\207\030\237\021\316k\321jdd\250"
+	.string	")\004\347\177\360C\257{\035\322\200VA\216`\340\274\n\3511\\d,Y\342\034\210\203cy\227\205\363\365\237\006\374\327t\n\236\321\306\371\037\344\320\272O\373\331`#\363\206\363?\330\372\340J\223\271.\363\2574flCS8\377\203(\375\353\275\177\265\t2\266\377p\376\007L\372\037\034u\351\242\303\354d\235wMQg\304\322(u0\242\200\271\016\223r\375y\361\341\374=\335L\307\274\211Qi~\t\302xa\264\244M{)\373\332{g\250\3312f\211\032\316\377`\353\003\340\013\027.)\026\023\225\031\031\030W\264h\321Y\252\276\370\200\030\201\271]\271\242\263X\241\201c\3148i,\327Y\274\354\305\331)\001\200\220\273\273\024\353f`\022\3355}\355M\325\241f\007\226%\r\234\017\200\035V\254\244X=\356\316H\261\301\032\203g\006\347\003`I\367K\321U\362\322\246\352\200\001\034\337\221)\327U\256\251H"
+	.string	"\360\bN2e\217\b\316\337Cc\204\365-a\301\371\036\230\321\367`L\333\333t\224{d;\335\033oaA\370\270\334\031A\201r\035\345\307E\322\252\314p\326M\364\0231P3h\350'\332\t\024#'\255\354\244Vq\343J\242\345t\334\273\\\301\262\307\005g\r\207m\344+-G7p\326o\227\353\033\223%\013g\355\366&W\317\253\307U\226#\377\021\275$#]\346\246\312\022\002\3033\266\266\005\n^Z\323{av\275\344ZI\b\021\227\233\322\365\244\207\263N\242\3274\333\277\352\267,B\230\340|\017\252\350'\340\210\024\024\022\255\366\257\227H\025\233\021\316\367"
+	.ascii	"\212\326i\372\bW\037\224\0318k\264\004\30483"
+	.string	"\303\017\347\353\263.;\035@p\306h\214!<\262Py\033\273&\033\323\3144\013M\334\333^\235\221kf\r\217\245\273\0268\353!\272\b\006\004\344z+B\004{\361K\332c\242_ZH\321!\244\314\353\372\313K\207\245u{\023\211\300$\312\333K\252\0168YgHlA\256\303\376\020\":\220r\222\245\003g\355C\003\371\277\332\030\361\003\203\001D\3778\177`\331;\322`Y\033\004\261\246\226P\301\371\036\f\321\272G\007(U\324\223\030z\3075\217\177]\341\260hh\341|\017~\350_\353\370Wu\r\213\325\027\316\367\200\207\276\007V6lh\034;Y\347\235S\324\231\250\242@>}\343\032\207\337\006\234\302Ywy\200\224\225\245i\354d\235W\302\320$\005\346\270\343\272\246\221n\331\031\021\303Yo\335:\224K\314\223\0358k\255\031~0`h\254\235\2543\313\0212*\261\240\323QV\215\030\327XX\372"
+	.ascii	"\311\340\254\257.^\0310e\206\340\254\255\316\263\027Sb\340\254"
+	.ascii	"\253\326\262*0\310\322\376\2577_c\274\204p~\007M\375\377\272"
+	.ascii	"\205n\241\247\356\221\355\2643\026\347\205\n\337\336T\035\322"
+	.ascii	"/Ln]\264\324\365\324I\307do\017g\375\342ZL\213\326\037\316\332"
+	.ascii	"\305\333\312h\274\331\341\254\243\336\206\303\244,/G\007g\372"
+	.ascii	"W\001\335T@\375$\201.\346\026\"A\333U\bg\f\25521\234r\236\213"
+	.ascii	"1\031h\227\276\25428k\026\327M5YX@\214\346pf\242R\362\302\207"
+	.ascii	"\363;\370\241\177\3128\271\356\210\030m\031i"
+	.string	"\352#5P\017\231\025i\352\243\363\306\251c\304\321\323\252dF\326\344\321G\232(\343\221\020f\266\245\311\247\225t\222^\322Hzy\335\364\221.\332\331Y\351\266\254\354\325\344w"
+	.string	"\245\337\201\220>\007\177Z\b\217\r\331A\207\3639\320\323\233\003+\372\034\304\371\371\3414\tP9"
+	.ascii	"\b\340\327~\242\n!\035\003\265\304\n\347s\300\246\177\365\314"
+	.ascii	"\031\234\226\251B\270\321\312"
+	.string	"R\004\n\347s@&F\214\3127\006\343\013\215r\322\304\253\314U\2765\b\324\327\222\314\377U%\202D\210\226JF\335\243\302s\363Af\347/\271\260)c\320\271\254\2741y8\237\203\035zz*\230\261\245f\226BC\310\214\346U0sfX^\276\224\355\001\201\373\242zi\"2\0047V#\243K\234V\027\024\254\246\t\323\22718\237\203\030Z\315S\363\324-wo.6kLOM\252\226\253[4U\036\037\2153NO\255E\024\234\317A\223\376U,*\226\373\227\213\230\033*E\023[\252\342\333OPB\320\240\243.\f\347o\360\207\207\267dl\n\216\217\346\206\322\021!\234\277A\230\272:\325\016L\007 |\252\023\300,#+W\355\316'\252\222\035\036\025*tsR\244\250N\270L\301\2115\311\"\344\204\3637P27\2276\331\021\027\344\311\b\316\337`\207\376U(*\224\023\t\272\334C>>"
+	.string	"\233\333\200+.Nu\002\004\307\024\034\037\217\24341r\327Mu\262w4\244\rg\265\311I\007\203\231\324\304\371{o\003\302dl\r\347o \365\366\246\266\211\210q\325\341\006\f\t\f\0338\177\003!&L\3246\013\\"
+	.string	"\004\006\0230\033Zm\330j\355\001\266\305\204\3639tQ\242$\305\002\322\324\264\353\222F\004\347s\230\242\32545M]\273{\207\351"
+	.ascii	"$\351\252\003\272v\005u\265\246&\311Qb\341BM\242\252\355e\321"
+	.ascii	"Aw\032\3316N\244\242\312T$\034\334\316\316\316\262u\271w\324"
+	.ascii	"\007`m\034\222\020!\242\0369\223\2229R\246\244\226]=2\325\267"
+	.ascii	"\025\203I#\206(\254\213\251\032\371\021F\213\227\031\0333'3H"
+	.ascii	"Er\230\273\271+j8\237\303\020\225L%\303V;[\b\214\b`K8\344\320"
+	.ascii	"\277:v\335\324\261\263\fk\355\265\016\214\t\007.\375\253a\327"
+	.ascii	"M\r;\323\202\373\ne\201I\341P\265c\207\n\004\214\312\024\034"
+	.ascii	"\237\336b'$\357\307U ^\202J\352\316\002qV\277T\260\377k\260\255"
+	.ascii	"\212\331\003L\365\321\004N\214\250\313M\f0`F\324\036\271\316"
+	.ascii	"\351\313\212\017g\225\307\371$F\022\261\027\034\232j\274\206"
+	.ascii	"\352\205w\326\336_j\023\260\033M\325\305\232Q\235\232\343\252"
+	.ascii	"WX\323\306\026\316*\216\363\212\2237$\234\325\0335CXh\301\303"
+	.ascii	"\371{j\027J\246\250L\016\265K\265\241\301\013.@T\033\247\013"
+	.ascii	"tM\206\222)\234\317A\210\213\013,I\235\301b\216E\237\226\226"
+	.ascii	"z\365\367\025\\\032\242\206\003\347k"
+	.string	"\200\227\225\245^\355\364\340S\232\343\013\304\371\032\300\351_\305R\261N\272,td;\005\221\342r\204\301^`\230\311\341|\rt\250Uj\225z\005\245\007]\023uB4\205\246Z]\275\2723\202%O\003-\225J\245R\245\034\320\243\355\313K\224\024\031\234\257\201\325\213\027\252\024\333j\206\013\031\223*u\377\266\204\325\361\300\371\032\270\210z\342\361\325\004\365$\246\001\222\223S\252\367\301\336\373h\257\310\353\261\243\271\251\250:\324\034]%a\303\371;\200LM(\240\004\210\226\026\350a\365eF\177'\214~:\346\252I\352RUB\0013l\273}\241~\364\270\332\361\242\277\223\207\204\224\352\361T\245c\236\326\210p\376N\025\325H5J\365\322\266\276\033%GZ\350p\376\316\233V\211T\242\024\213\312\024\034\037\021\2660G8\177\307L?\r\274\252\220*\364\267\035\346\326\001\201\276)8>2\375\267\213\213\366\036\022"
+	.string	"*\204\306u$\375K\307\244\200\347\324\335JOk[\022\213\0350\375\235\033\372)\337M\317\364\375\355\356\243'\f\326\26405\367\323\016\341;U\372;I\032\013\340F\007\031\226\027\316O\307\334\224\314\230\264\f\nx\367\321\323\272t\243\251\231A\237~\006\\\364/\n\2306\233\251\230$KSp|:\b\225(!a\236\212I\253"
+	.ascii	"\265\324\3009\005\223\"\3454-V\300\244DA\370t\304\250\342\305"
+	.ascii	"K\252\327\005/\261\322\025\365\306\205K\252\207\367\336\373K"
+	.ascii	"Mk\253\322\324l.\210\314\364P@<\266+\\\316\260`I\265\264}m*\252"
+	.ascii	"\0169\006Q\223-\357\251\226\034\347d\211\013\234\323,7d\366\232"
+	.ascii	"7.\227_\274\221M\371ag\227\342\255}m*\261\0166O.|\310\270{\212"
+	.ascii	"G\363\004\315\351\b\316\337\313m\377\3273\013\224\027\031\316"
+	.ascii	"\317\240K\247ui]\212\225a\023}1\362\265\251\256:\340*WzP1\250"
+	.ascii	"P!\233\202\023\203\002h\005\016\347g\020\245S)\251\224\024\353"
+	.ascii	"K\227X\207T\315Mn\017\347c\32077\227b\265\261\020\353\020d\373"
+	.ascii	"rb\201\3631\370\002\005\212\230\224\267T\356-u\342\004\016.m"
+	.ascii	"\002\204\fE\022\006\325$\356\272\245M\340\230S8\177\357\244\373"
+	.ascii	"\277\242[d\364\332p>\006h\372\030\330\320\307V7mk\303V\227\351"
+	.ascii	"A\340\024\234\330\325\222%*\321\030\006K\351Z\272\226\262\335"
+	.ascii	"-\277\265-\211k\013g6\271\fd\013\221\0368_'\220H\212"
+	.string	"F$UC\362T\355\024\273\372\272\202s\232\226\026y\221\364\354\356\247\275\251\266\020\230\021af\202zhz}\314\247g\251\331\213\2652*\234\323#)UUW\031\234\257\023&-K\215\234q\377W\274\003\314\212\016\347\357\335\277\377kJ\305\311\357\f\316\327\251\323\327A2\226\222\215\245XB\204\244X;aLp\344h\230I\341|\235!\372:8\302\302\316\244\rTm\201\"\2667\224\020\202V\250\2327p\276NSI\326\307'\350\204\r?\361Ay\242\035\376\2008\"\177~\220=\034\216\305arMqd[\326D[<\222\030\262\311\236\237\370\220D\241\034\276\300\032\203\210\354\211\036%\233\274\371\211\017 z\330dP;d}\3246\205\025\210m\327\237\270\240\025\022\213+\373Sl[\326\204\020E\017\322\330c\363\023\03728\026\221&\250\371\211\0170\024\215\304c2\250e\223\310\243n\213+\330L<\262."
+	.string	"\021\203\324\f?\361\301\304\261\230l\225\030$\221\311$\233l[\345\021\331\203\366 \215B\3441\231d\205\302\f>*q\310&}P\342\261\250\202M\246F#\333\372\240(XV\351\203\376\f\331d\253\374a\177\204G\026\bysd\201\220?\354\217\217>\262@H\242O\312\022=h\326X\364\001\372iUV\2114\366\370\244\354\261h<\026\221G\335\2034\032\207?\351\221\005B\372\240\355\020i\364A\333\342\261\270\242\350)\276pA\033\204d\177\212/\264\254R\207\346'>\020\2071\020a(\032A|\310@)$\016c \332(\333  \341\261\330\032\213A0\b\2057\3126\b(\237\350i\207'\244\350a["
+	.string	"\"\006\325\030\215A\307#\362\250\266\303\237$\322'\365i\217\305$P\312#$\016\221F\034b\021\231\"\253@&O\264\310\243\3523d\215\231G\310\2328\016O\364\254`\205=\305\037d;\024\nsb0\002\001\231\220\323\262.\264\254\013A?E\020\355\t\023Ec;\f\322"
+	.ascii	"K"
+	.string	"\fj\213mkB\313\272\020\364S\334\320\376\304\207\rR\245\020\307\304\260=Y\341\0062(M\f\215\024`M\f\225AA69TAL\016-`\203\242g\330*Y\241\312\242\240\350\202\020E\317\260uAx,\256 \304!\036\213'\324\260\311\24069\f\312\300\232\030\226`\225\303\344\004pP\364 \215(\260I$\n.\340\264\305#\211`\313V\240\2078\264\371QQbE\246H\262.(\215F\023\222H\n(\217*\220\3046\350\204\013?*\200:\370QQb-&;\360\243\002\310FY\274\200M\232\360\243\002(\347G\005\020N\313V\340G\005P\2152m\213G\0225\023P\376\250"
+	.string	"\312\240LY#\261\270\266\305#\211\032\030\202\224B\3430\005\373SliP\f\224\304#\262\207]!\206\241\221%j\370\211\017m\361X\024\366\370\200\350\361\331\001bYc0ME\340\3219\304\207V94\246m\020\362\034\341C\033\204Du\321h,\376\330\030\215\310\022Id;4\006\375\024\2256l;l\341\247\250TU\022>(\327\033\021\0372\330\224\360\201\375)\266\255rh\304a\333aK\223\354)\376\330\030\207lRHB\tJ\344qx\254\241"
+	.ascii	"\333\016{\212\304c\021\207\246M\016[\027\202m\361H\"\231d\211"
+	.ascii	"C\244\261E\"O@\276\220A\313*\331\026~\330V\031\203\222\306\304"
+	.ascii	"\261H<\262%~6`\300\266\254\021\350\007\211\302\217\n\240\016"
+	.ascii	"\\`\225AA\"\253\034\262F\266\005 $R\205cq\370\223!\005\022%\216"
+	.ascii	"\305\341\n(z\220F\032eP;l]\320@L\";\3603L\232@&K\354\240\350"
+	.ascii	"A\252\020TA\303O|@\026\211\255R'\231d\211\2552%R@\327\240\350"
+	.ascii	"A\032\217\033\020Z\300\005\023T\240@\016\216\b\037\332\344\020"
+	.ascii	"\350\303\006\222\310\026\271\002\361\310*10q,\036\217A-\250\260"
+	.ascii	"!\262@@\310d\n?D\237 \221MQd{\330\026~\210>4(z\206'\234P\026"
+	.ascii	"\2150\004\225\270i\221F\027\216\310$\005jX\024\303\027h*@\363"
+	.ascii	"\023\037X\024C\037!2\031\203\211\236\236\241\007\023X\024C\237"
+	.ascii	" \333\016\211@A6\255\220\204\022~\342\303\212$\210\025\311\234"
+	.ascii	"\025AC\341\212\341\017\316\212d\020h\370\323\223D\223,\261\230"
+	.ascii	"\002\231\004\"\262+\222\254\021((\005\037\343\360D\020\b\207"
+	.ascii	"X\\\333c\020\262G\350\223\024\026"
+	.string	"\201\224\302\025\311\fXb1\231dS \205\307\342\007B\023AF\240\035\r-\253d\223\3106h($\036\2130\b\333\241R\370\023\224lQ\260@\312\rjX\343\260G\031l\223l\212cQXT*\2234=Ib\361\007=\026\1774\212\036\366D\317\212\341\217\306Q\032\207)\214H\240$\333\036I\364$3P\262l\322\004\233\002k4q4\341g\210B\n \237\rD#\362\204\222M\236x\201m\207)\212m\217\t,\021\271B\2628\3349\026{Xe\220p\305\360G\270\"I\323\376\304\007\016\222lks,\2260\016\213IV\251a\305\013+ZH\016[e\260\247\355i\177\212\312\365\205\236b\222=\262&\364I(!\001%\214X\241~\004\003D`\200\b\351G0\200\207\207\001%\360\350\227\300s\376\304\207\020G\023E\343P(T[a\262m\2077,\n\212J\2410mO\264@k\222E\221Dv"
+	.string	"\210\030\264\262B\"\t\024\312\341\013>=\301Vi\f*\221d\333#\213B+T\225&\206/ \213\251Rh\242\350sD\242\220\202M\201m\207-\324\030\221=\310\026\231,\221\341\210,*\223l\212#\211\037\025%4\374\250(Ad{\2161(\217\033`\225A7-\362\2042\205V\231\f:\201U\006\331\260B\226\210\\\201M\006\031\213C\037\033\024\307\242\n?*\200\324a;L\341\007\231\004b\331 2E\222U\326\264(J\374\250"
+	.string	"JM\034\213-\374\020}\324V\210\342XT\001\210\030\264\376\304\007\024\307\242\021\210\030\004B\222M\221d]P\0265\321\007\027\225\370X\024&\211\304!\212\036\244\222\246\025\016\22541\030\213?C\037\341\261\250\f\266\302\265M\"\201~\342\303\261\b\242e\217\305\226=rX\225i\222H\034\"\223,\n\204\307\242R\247\350a\223\271M\"\201r\222H\034f\024\307\242\nl;l\225+k$\022\213+\264H\243\013?D\037\233V8\242=\026\203\324VX\002\2170\331\002\265\307b\320\312\032a\bB\022S\"\313\002)\205Id\213\374\241i\205%\360\264\307\242\332\n\333$\262\004\013?*\200pZ!\013$2\262\210[!\nI\366\247\330\336\374\304\2076\b\250\rB\n\177T"
+	.ascii	"\201P&\331\024\305$\321\207M\201\005\212\341\005\341\n$^\240"
+	.ascii	"\371)\266g+l\001\005\024~\212\255N\366\364\234F\366x\034\236"
+	.ascii	"\350QY\343\260\307\205 \013\254\322\030\004D\243\002i\364I\262"
+	.ascii	")X`{\222H\037\033\"k\204axd\325\237\370\320\200\036\026H\267"
+	.ascii	"B\366\247\330\n\205\272\207U\nS\264i+4qD\032\225B\243q\330\243"
+	.ascii	"\214A)\024j\350a\225Ga\212V\235\200\n$(\220\177\342C\333\023"
+	.ascii	"\224l\225 \224,P\f-\be[\204\001D\320\321D\002V\004\035\213\306"
+	.ascii	"\004\220P\202\260\204\021+@\260\304 c\317\261\b\"\251\f\002\241"
+	.string	"\200\020DV\031t\f\022\3524\331\002\325\020\207l\362&\331\002\331\264\305\244\212\032\342\221\025\372\004\301\300*\2070\330\260\312!\fB\240 \024=C\030\204,\220\020\342\020\217\254\220M1T\nY !\254Q&Y\024\311\341\217P\037\213\303\023=\302\024yd\215E\037\241\032Bibh\364\021\252\255P%\032\221B\232\343O\220\021\331#L\006\365\biX#\f\3036\205\360&9<\321\223}\202`h\223\310\023J\341\332\nY !\f\242\350A\032\205h+$\241\004\037\037\244P\270\266\254\322\307\007)TY !\244iS\364\260Dd\217P\263@Bh3l\207D!K,\252\020\006'\240\002\t\n\bY !\324\255\262h\264\361\t\202A\250d\223,\233\364\021\326\264B\026\005Ee*\2028\004\022\nS\226\210\374\021\242F$\362\004!\332\nK\374\024\2254\357i\177\342\003q\030t\002\341OQ\031"
+	.string	"\366\247\370\002\333\016Mh\245\320\005\3420H\003?Ee\0066\031\244T\262I \255&Y\342\261\350\303\2328\016\2234\2550\304\b\355\261\030\244\333#\nl;4\241\262\355\320DV&\221\312#\253T\177\210>'2\031\203\211U)L\301\246\320\3233\324-\213\242g\b$\374!\372\004\177\342\203#\201\330$\210\026\211L\202\240)*\221@5_\300\002P\370`\003\031\250\200\356\371\240\302\013$\\"
+	.string	"\321\262&\222\303\026\304\2618\374\001\321\223T\202\370"
+	.string	""
+	.ascii	"\240\237a\253d\177\212\355\032\003PR\230\034\032\203L\034\207"
+	.ascii	"\302\240\237\342\016\nbX\221d\215lO\317P\230\034\262\307\242"
+	.ascii	"Q\030\364S\334\240\035\006\235@xD\026\333a{d\213I\2440\350\247"
+	.ascii	"x\001\nbX!\214\241-\366 \215l\212\232\3774Wo6/\266\232\266\325"
+	.ascii	"\330\225\332q'\243*\377\310Jv\250}\201\221\277p\304h\224\005"
+	.ascii	"\241Z\311n~(\351\023\233\3129h\262\210td\221Z{\320h\361;\262"
+	.ascii	"|\261v\r9\203\327\205\306\005\327m\372\"C\210&*\313\b+\343:\242"
+	.ascii	"i\261V"
+	.ascii	"\245\2611\241\3165$\031gU\236t\230s\312\3062sB\375hj\240\255"
+	.ascii	"\275`\201\032\261\261\343\202\273\322\224\2315CI\250\3741\245"
+	.ascii	"j:4\306\300\226P\0369+KF\026\2455\252&J\336\320XR\246AS\024W"
+	.ascii	"4\265\\\317\326&ja~Hk\326\215'O]h\2162\221\224IO\211\021\215"
+	.ascii	"\321\032%(vE\343\tM\221\023\032\242 \013\234\274,\032L4C'\023"
+	.ascii	"\007KT\340\032\215\320\231F\243\007\0232\346\rU\026@0\201lz\213"
+	.ascii	"\0306\"\300\025\020\343\310\252a\345/C\251I\002\326C\212_\216"
+	.ascii	"\273\021\233\222S\353[\365P\272\027\177Pg\242j\250\224p\321\231"
+	.ascii	"A\257\316*.O~\360\241X\330\350K\240\2202\250\026\215\321\223"
+	.ascii	"\024#2\301\034\231K\223\266\276\275 \217\324E\220\247\2561\031"
+	.ascii	"\253\246\314)\352\207\230`\230\023#g~Y\034\2449\334\204|\341"
+	.ascii	"\374\353\026\004\263f\261\341\201DF\225&\327\032\345\225\004"
+	.ascii	"\356\213\3162FI\2167/U\230WN\340\202]\202HDg\242\350\005\225"
+	.ascii	"\320\314\332rpQ\257\362\231\236\231\277-\027L\260\357m-O\013"
+	.ascii	"nR\313\302\310\364\202Y\036\314\323\"\264\f\203\345\324\202\223"
+	.ascii	"\234 \325\270\242\227\340(\031r\345\205\227b%\201\321\265u\247"
+	.ascii	"\243\240\215i\021\3029H%H%h\305\002B4[dA+\301\272\f\266\231x"
+	.ascii	"\301\272`\025\232+e\340\2208\345\260\263\201\363\007\020C\377"
+	.ascii	"\301)\251\230&)Rpv"
+	.string	"\002C\247\206s\206\342u$\312\\\024\323X\223)J\232D\004\006e\007\005\0054\262\372\002&\370$\325\223\301\204d\347d-s\345\3255\003\347`\334\331\202\300\300\300@\277\275\207\202q8(\027l\362`\334\2318j\236\330r(\315L\234\024\313V\236\2267=%d\t\027\r\234\317\266\232,\2731'm\3016\215\005\327C\206\217 \023M\003\216\352\013\017\234\317\266\232,6=\251\035J4\016!4\251\251`\332\237\026\\\373\206\241\275\211\366\306\312\021\274b\262s\301\267\251\\t\370\203I\036\\C\217\364\306\330\341\034T\273\234\356Kb\004\017\347 \222\313\251tT\266d\b\200O\377A\264L\025\f3S\205\352,?\265@\311\221;\263\265\312Z\306N\356\352\210\216\034\326\025F&X\226Z\251\265\345hc2\005`$$\204s\260\b\tY{\017\005\211\004\215<X\344\314`\021\034?\234{A\300`J\242"
+	.ascii	"\323\374\007\207\004\311\360\\\325\0209\232%4+]A!aZ|fg\306\356"
+	.ascii	"\2460\021\341\034\354\361 X\260G0\354\"0\211\356\254x \302\304"
+	.ascii	"\243\310\352d\217\206\216\037\017\206=\030$\204\b\374\244\002"
+	.ascii	"3bX\001\t"
+	.string	"\202\3218\013\3039\350\003\214\016\035A\036;Y\347\035S\324\031\261\032\037]\220\244v<\310\003o\215K\f\001\\\t\326\b\326\b\346\200\n\013\242\237\214\342\224\004q<\230C\205\227\035t8\007o\350''\\\021!E8\007\273\320\030JWy-p\016\332\270\034\2207\034z\330\252F\251E\034\326\224\027\017J\005_\004\271\2000\371p\302g\304\b\215*Y\017r=\270\025B\304\345\244d\354(\303\371A-\034\255!\027s8\007g$\340\354\032\272\341\025\214\021\224\321\327l\301\366#\210\216)A,\264\b\211\031/4\234\203T\301\253?1Ix5H\266\364a\261\nV!\221\361'F\203\024\206\327\f&A\030\250\222\006\253\032\232\022;\234\203S(\325\3775\003/@$<\360\260l\0251yz\nF\355d\t\221\271\361\301D&\306\247\2565\313\266\202-\036\214B\353Q\325\004\347 T\006\034\353\242%\207"
+	.string	"b\004\231\202LA\026;YB{\351\023\223\220\247*-\332\240\202M\017\262@\253+\302\227\224\024T\022\341n\2444\"\252\246\235U`\227\240\322[\0270/\272p~"
+	.string	"\274\004wp\007\221\314XD\235\341\213\312\243\003s\364 \222\315\262\305\226$\234\203DA\243\032\300&>\214\202F\301\242\036U\244\212\320L\321\241\304\204\363\367\202CvL\002\211q\250\004#\317\325F\312\354\222H\022\3531\020s\216)\246l\254\0013\026"
+	.string	"@8<\034\022\212\3320\366\024"
+	.string	"\022f\316\222j<\244+Q\022\"\346\f\200"
+	.string	""
+	.string	""
+	.string	"\320\007"
+	.string	"\216h"
+	.ascii	"\t\3220\353\2277\271W\341\302\360\376\201\272dlmk`+\302\005\021"
+	.ascii	"#l\321\262\005C\371\241^7\250\235\021.\337]\306\334W\271a\302"
+	.ascii	"\352b\223\373G\037T\216\222/\362\004\003\206\231B\312F&\360/"
+	.ascii	"\234\021%\210\005x\351\005\341\212\261Am\375hn'\3475\005\200"
+	.ascii	"\244o@\fN\177`M\370\200\035\346\243]W^R\\\030`\363\006 \342;"
+	.ascii	"\270\367i\336\302\3029\357{\315\312\361\220\004\263S\b/\260="
+	.ascii	"\330lu\317\246\342\321\013i@)\242`d\206\370\221\225+p\\\200G"
+	.ascii	"Z\253\234\324\231)\023=BM\016\236\024~\345\343Rf\325#=\b\337"
+	.ascii	"o\336o\277\004p\242\007\241a$\335G\226\027d\013\251v\317\237"
+	.ascii	"\345tJ\224\376;\227]{\353I{\366CuF\336\250P\225\004\3030*\211"
+	.ascii	"\302%\210}\310\003\301b\370\276\217\320\026B&\304\021\275\204"
+	.ascii	"\301T\227\345\202\375\241\222\341n\221\250\2303x\362\234\272"
+	.ascii	"\202\326*\312\310o\311\224\027\n\321m\322\263\025?\334\366\315"
+	.ascii	"\246\034\252\007\325!L\bg\262\376e`\025@,\265\203p5b$\255\226"
+	.ascii	"@\256\220\232D\177\245\376\024\352\246?L\217o6\017*\316\334="
+	.ascii	"w0l\210G\224\364\347\207\313\320\216f\213\016\030\023\251<\303"
+	.ascii	"\371\324\220|7M\201T\213\033\211\234\251pm\344\251\257P\016}"
+	.ascii	"\353\022\25044\301[\037\351\215\002Q\327\354\026!\317\355\020"
+	.ascii	"%o\205\375i/<\020'N\336\034D6aqd\034\216n=\002\242\374Q\237G"
+	.ascii	"d\236\243\0074\263w\226\212\"\021\031.\026\351\254\t\334\227"
+	.ascii	"N\202\313^\202\201\234!\330\330\264Z\350\274\363.\347\261\364"
+	.ascii	"\021\371\312\323\363\216Y\013\222\264&\336\256\331#E?"
+	.string	"m2x!8\367K\\\r\342\234\312q\020q\251\352R\270\315\2479z)\347\205\027\372\036:S\301RV\264\024\016hF\230\003j\247\301\024\331\236\225\264\3124nr\215Z\035\250\300\361&S\315Z=_\023\253\313r+&\315\304\3658\235\3652\223{q\006|\347\026\306[b\333\234T\267\304OP\004\376\024\321\347\243\030\355\370\005\341\2749\\\354\023\324\302v\275\224x\213\tLf\335\254\232\220\361#xW'\027\367\271\365\020\200F\345MT\252\350b\372=\254.\213\246\024k^\234\356.\336\272\324|Q\n\360\230\376T\352\237\326\373\262y/\257\367e\363^^\357\3136g\320f)\237\rjYL\002x\013\200\260\375\220\303\202 Fq\221\353\364\357\2125\321\355\272\256\235\2601\205\317U\357Q\372\277\253\336\243P\217\271\267u\r\372\234\002o27\271#VH6f?\204\f\nz\357u@\020z\353`\261"
+	.ascii	"\321\205\260\264\266\342#{sd\256\305r\333\332\265\207\013\233"
+	.ascii	"z\360m;\370\332\352\257o\355q\265\337\357\243\343\344\312_\300"
+	.ascii	"#\312\016\354\243\303\232\345\367\360T\317\257\027Nx\203\254"
+	.ascii	"9\257\217z\224F\340\\\374>\212~\301\231\001p\006\357\213'\031"
+	.ascii	"\341,\321\340[\240R\013\031\200\017\2254\207\rW\001\036\206\357"
+	.ascii	"\b3)\005\315\343L+'Xh\327wYw\326^a]\206\222}"
+	.string	"\021\243i\252\346\244\354\344U\003v6MK\237\354\315\030l\250\363/1\275a\321\361P\346\226\252a%\202)\324\035\226\356\202\335R>!\027\365\347\327s\227\376\325\215\346\371)\034\364\225\313\353\0352\363-\262\343\257\316<\354[\031I/$\255\300\t\325.[\n\356\353pN\315\225~!\334\200g\320\320z\302\r\210\201\364\215\234\307\247\200\354\375~4(\237\323TV\t\367K\250\340\337!g\376\241~\224\030\326\364\351\270Cg$\215Q\340M\023\224I\345H\220\177\347\213\305\322\230:+\263\335\354uC\224c\261\202\337\363\343$\021Ju\242B\rRx8"
+	.string	"\030\374.j\007U\260\372\372h\367\276\004G\306\022\035\177\246\241\363\374\316\244RhQ6\373Bg\356\"\007\n\0233\026\320\303\307D\n0\322\013\t\350\324\370\3362\374\r\251 \305!\337\270\272W\257\f\206"
+	.string	"\335e\n~\225\016\333ZHwDB\2315T\r\306\313\304n\2560\255\235\036\300\215\371%j\037\020\225\344\313\376\200\305p\341\363j]\267y\222\206p\240\370\004OJ\r\030\222\351\232<[\236,cWkqUV\005"
+	.ascii	"\240\2448\2508u4}+\317\265\2741\207V\021\351\360\372V\323aA\325"
+	.ascii	"A\204T\310\267'\225\220\361}\356\024\006\016~\025%ey\021S*\362"
+	.ascii	"\204\006\332A\240pVM\343\005\232UF\323\301\036\323\307\356\210"
+	.ascii	">6\027\311\233\207\315\020m:\305Q\027,?nL\360=x\017\236\220#"
+	.ascii	"\256\001\224\201\233\325i\336\215\207\274G\313\366B\"\017\262"
+	.ascii	"\204I\320;\255'\br\t\f\336\"\210\303\3466E\365\026)\215c\342"
+	.ascii	"\271| \203\260M\305\335\024s\0207\374"
+	.string	")\337\366\335\001\024T\037\013V_Ns\313\254\334\201+[\r\177\037\264\264\372\361\217\344\232b\235(U\037\371\326Z9\262\356\004\250\325\217%\220X\305N\236\331\215`G\246\326\301\212\363\326\215xc\207 c\032\007\310Z\2303Wo\277\263ly\317-\013P\340\227\033\033\223\334\255{\022\233r\214\264\333=6\225\264\322\330\362\352\273\364j\355\263\031\235\b\007\305\030\3001m\201ogefkJ\007V\323\177]\013\004)e\360Nj\346Q\203Xp\376\026M\312m?\201\341{\3232|\274\256\221\333c\321\340\331\033\3176\232\310\032S$M@\261\\\2346\tX\2164}\237&\032\215!\221\013\272\215E\0351\372\001\262{\240d%1{\032\rw\036Fps\004d\2046\240\351\342\234\331\210\216j\260\337\231\223\232\002\214\374\241<\213\255\214\211&\345\322\212\211\034\331\274\367\376\035j\365\261\217!5G\367\245_"
+	.string	"\255\356\220\343\204\2166\215\013o\3336\364\3442%!t-T\020@q\267&%\rnk\1773|\024\336\317\306\226\207\331\233\222\023\024K9EP%Z\350\366\177l\364bwR\230\031\342\222(\016\236\241\030\0267\270~G\342\363Co\bh\227S_B\016"
+	.ascii	"T\327\002\\4zBK82\247\177C\303+uK\321\235\232\211WR\364Yr\207"
+	.ascii	"e\340\202\374\330\345?\221\036\270\314w7\3520%\227U@\007\033"
+	.ascii	"\252\242\371\347\231b\337\031\304\244\215\304\3249\315\312br"
+	.ascii	"q\350\27630\352\331t\335\344\332\251\031\324\026V)\224!c\253"
+	.ascii	"\267\310\033Wpv\237\211\034o\3101\037IpzV\311\377fd\353\253\235"
+	.ascii	"\b\334\206\244u\227\236\002Jd\b\225l\027O|\301$q\003P\f\375\234"
+	.ascii	"\270\215\324\314p.\177{Bel\217\t\366\234\376\233a\242s\201L\025"
+	.ascii	"\264\\\204S\266\251\3257*M\257\031Y\177}\001h\f\034M?Q\324e\236"
+	.ascii	"\013\272\r-\327PDE\204\022\215\023\200oMt\274C\353\"\233\240"
+	.ascii	"\3032\356TrC\316\325\0035\221}|\347$\262\211\310\036\005_\016"
+	.ascii	"\340\336\243\352\006\220Y\2550\311y\273\240\327\213\264X\255"
+	.ascii	"\350\032\271\243(\307\312BL\013q\231\001\251\007@\33614\305\307"
+	.ascii	"\350\363\n)J pT\001\034d]\nH\001\252\305m\213F\2200\034\264'"
+	.ascii	"\016\032\312\245\221\355\310vPid\221M\013f\210\203\tv\020?\241"
+	.ascii	"k\244\004\355;S\253x\002!\006\240\313\202\205Rs\030\326h\240"
+	.ascii	"\256\001W\002\304\332[\205C\337\024\272\212c\225>\303#\017R}"
+	.ascii	"\023@k\261k{t1\224\337\200`F\310\275\215\340\267$%\0161\nIw\273"
+	.ascii	"E\251\276z\317\236\316\343\006\f\2729\377\r\334n\264\224\230"
+	.ascii	"[\273\202|,l\364\256\302\312\013\213\345@\352T\260\002;\246\303"
+	.ascii	"\275|\275\274\225\t\036\247\0050M\234\3070\004 \313\013\213\374"
+	.ascii	"a\342\026\235 \316[<\264q\026\177\274\003\r0\255\273@u\333\234"
+	.ascii	"\r\030\f\253T\\\216\021v\331a-\306.\013^<\357H\\nq\026\225\004"
+	.ascii	"3^\252\177\f\214\006\226\321\275\272T\350\360^\270\3500\230\334"
+	.ascii	"\032\305\365\323\027D\300\246e\244\312("
+	.string	"\242\231Q\211\360:\031\357\312\234mhl\316\022\267p\273\204u>\346\316\020B;V0\027l\314z\217\334L\236\213T7\37119\315\212W\217T\307\017\263\217\025Rj9\324bx\243%|\232\327a\214\304\352q\246\243E\345\025\020t4\227-\335\204\337I\247\3024\030\004\274C\317v\223\355\200\267]\326\276\203y9No\227\231\256\t\337\220^M\271\204\001H\330\357j/x\206z&\302\327\204\330\273~#l\214*?r\200\2010@\360\3250\332\336\020\223\025A\357TD#\f\373\016\214TI\377\350\320j\006O\241w\303\245<\201e!\037\264\243i-g_\347\034kn\334\367\016a.\035\033\263\335\210\326\002\3030\351\276{\030\031is\030.v\246\373fBk\216J\222\242a#X\027\016_\240\350\203$\237'Z\350-\027q\n\230!\301\247\013\374\346\332 \203\214\017*\024\001\222\f\004\0061&\034"
+	.ascii	"\0300h\221\\\3714Y\036k\032\0314\365\325\235\244\"\324!E\215"
+	.ascii	"\342^\036\321p\025\344\353F\316\256\204\363\355\375\232\310\347"
+	.ascii	"\271E\311\244\013)\247B\267+ \234<\270\205\237?T\217\022\212"
+	.ascii	"\"x\032\235\201\023\227:\332l\037\235;wn\341\001\032\031\265"
+	.ascii	"\207\027V+\342\344\376\b\330\230z\016P\261\341\241\301\024\233"
+	.ascii	"\335\321X\247\226(\200\242F}\b\246g9QT\204YsfN\261A\272\035\303"
+	.ascii	"q\003VxD\325*\212\003\300\0355<\255\314\332\311[\272N\347\332"
+	.ascii	"\354\300\261\206\361\"\327\355\331\364\317Q\277\253A\323\025"
+	.ascii	"\277v@\3105\006\302yCq*X!tcj\300\214\277+Ij\256\fQ'\"\366\030"
+	.ascii	"\2730\274o0\256\323^\306\350\f\220\316]'\276\276\031>\231i\202"
+	.ascii	"K7\204*\3721\312\2227\345\261\007\353SR\212|R=\303W\024{\240"
+	.ascii	"\275\207\206\221\222\325\335\255v&\301\335\001\r7\312\242\227"
+	.ascii	"\250\270\301@\255\345\232\215\2766\361\242~C.\225\266\376'(\t"
+	.ascii	"\233F\343\361V\215\212r\313\027\313\013\374\306^\340\303\312"
+	.ascii	"\337J\302\3606:\004\r\2605#\263\321bT\371\207\351'\276p\205\244"
+	.ascii	"\225g\022\222\323\331}\305\302\3400\2203(.\215.\347d\372k\017"
+	.ascii	"\371\036M'\250X\201\373\"\306|\344\341\007>\272d\234\212w\f\002"
+	.ascii	"#\335\270\274\3356s\247\304\216/\341\210ob\207\316\032/\357\034"
+	.ascii	"\034\276\256\210\362\031\246\243T\335\340\342\323xT1\260\337"
+	.ascii	"\353T'\005\357\354\225\271\267P\200\020v\317}U\277Im\343\274"
+	.ascii	"1"
+	.string	"\204aXk0\223\273L\363o\366\321'Gj4\037\370T>\020\365\206\312\250S:\372(\230\256\226^\034\365f>D\021\031@\006\240\034bRP\227\226$\3320\230\333\375\263kO\270\334IC#\b\3450\350\301<lg#GSf\273M\004_\213C9\253\344\362\267{\324\306\256\0254\271\263}')P&kYs\203\343^\350/*\265u\253\221\fNz\273\242\303\245=\034-\021\327i.\224\262\252\336\023\272\363+\3543?\276\362\223\2060"
+	.ascii	"\347\216Py+7\313BZ\317@\204\375,\313\036\246\376\031\204&x\306"
+	.ascii	"(va\246n`i"
+	.string	"\353kB\212\343\266>\265\323@\027\322\002]_S\363\r\037\201\243&LrDG`$\331\264\3626wmE\232d-\353#\033Z\2464X\347.\233&\343\021_\306\003\027\323\373\003\347\271\347#\340u\030v\264\262\002\252\344\366\004C\251?0\213\031\f\357\220\240Vq\205L\230\220\201\314C@Rr9_\364 \340K/^\277\214\272\004irMn\375FA\3245\362!\323\336\\-8\037\221\216d\361\f\220\250\257-\030$Qo\233V\3405\310\030\375\303l\221\3604\003(f\207\331\352\277\270\342j\321\342K)\205\312\370\335\316Of\317f\305\037j5\337\272\241m\302>Y\024\022\336o\363:o<\204\0206XG\003~jom\303e\243\020`-\201G\261\016\036\362\321\235;l-\331\227h\002\216\323\206Gv\210\034\007]\236\031i=\253\001\364&\220\355,P\350Q7\377L\301!`\t\002\217\341\335"
+	.string	"4\352\026\007\301J\266\351\265y\370\177\343K\334\312\373A\225\3125T7\343z$\254\207\300B\324!\n\026\213$\350\025\340\323\266*\254\362\360\371\323p\356\017\356Tt\2052\374{\363\332\210\204m\035\031\036~x\0265\222\002[\036\311:\306\362\310\033dO\203.J\365\\\177A\273\274\230\306n\271Q%\271c\024:\260\255\356\253\313-\023O\311E\350\2401\201\233\241A0\346\264\306d4h>+#\321\337C\3472\256\020\314\nq\230\005\177\314\370E\270six\230\242\350\376\362\212\003r\267n\351\353\366\243\375\361\346\355\t\\\262\312\201\235\327\204\357\323/\037WG\302q\312\t\2128d\235\205en\027\314\237\223\022\213``\351\001\322\225\031"
+	.string	"\244\334\275\230{\315\271PN\213>\350h\275\254\r3\"\347"
+	.string	"dP\372\302&\n\\\020\351A\177\366a\300\025E\340R\203Q\020\323\033CQ\260\231"
+	.string	"\325\225\017P\230\227\336\302eLw\316\257\236?\202\345\334\301>\225\267\361B\334\237\213\201\362G\020B\270\204k\032\322\316d\272\236E\2407\263\260U\374\3443B\262\343S\333\370\326\f\314\245\330j>B\343\336~A}\303\0231W\001\340\2740\274\242\204\244K\001\3342\373\331\005R1D\355\353\020\342C/\377]8cS\302\022Y\262Y\334\263\202\b'K\245B5AKpY\261\310\332\372\306\200`\016\314\341\367\241x\315\307x\204\274\260\273\226o\322\3430'&4~\201\346mix\230\223\244\252E\236|Z\236\236"
+	.ascii	"T\206\002\025K\261\272l\013r\216\2176v\224\264\t\314D\2152\177"
+	.ascii	"\336'u\"\343\313w\372\366\254X\317:9\310CY^`\234\2371B\"\214"
+	.ascii	"\274\002AL\244kE\341?@\201w/\275\341=A\375g~\326\362\206]\306"
+	.ascii	"54'\b{\322\37211\325\205\217\333\216m\033\002\277\201\003V\020"
+	.ascii	"\036\305\261Y>\316H0]`\374h\303\004\362%C\215D\312\237\307\223"
+	.ascii	"\346I\246g\177\200\2456T"
+	.string	"\250Z\223\003\361\227\253\026\324<\206\"\344_\034\347\367\254\037\355\016\215&\270\205\274\264d\003_3\"Gh\231\272*\356\351\260\213\002\241 ;\306\026\201\2240\026[h\217\002\324\310\316\365j\252\344f\016d\323\277`\333\240V\204\\\007\024\302\240\2733\357\201`\217h7\304\333\336\261xZ\315U\203\347'\302\202\233 \350]\270\323\263\331\r\257>'\373\376*\245\263\257\232a\257\003^{\016\273?\331\030\300`\351bYY\330'*mZ\007\036\337C\b\277\332\360\356\031\204]b\240jL\343<\251\206\027{\354\202S`\325\310X\241\361\"T\240\324\375\347\255?\007\323\305v\020\336i\224\375\215\343\t$R\271\257s\376\262\021\260C\204\361@\314\033\316a\203\2127\221P2C\272I\237\276\236\267\001\262~\225G\266\357&\230#\274\027A\2364]8\273\344y\020\357\323\327O0\366hv\272\373\362R\307/l\036"
+	.ascii	"\022\f\300lFKc%\343\345)\353\213\307\273\032\365\255\233\263"
+	.ascii	"\236\350=\274\315X\265\237\332\270\303\266\r@>\236\355\354+\037"
+	.ascii	"#\305\254\242s\300\231W\213\t#\204?v\232\237\347\031&\323\201"
+	.ascii	"\237\214\263)\331[\362\252\363\250\177\020<j\370b\364u\232>o"
+	.ascii	"\343\357`\251\277\360\256\177N\033b\201\315\347-_\204\225o\267"
+	.ascii	"\324KW~\003\346m\207\016<>\340\333]n\367s\207\362\217{}\rc\356"
+	.ascii	"\224<\332\367\247d\263\342O\226L\253\tX\235\335\213]\273\034"
+	.ascii	"]\3568\206\031\277$\033\\\350\ty{\207\334\243\226\345hr\204c"
+	.ascii	"\317?i\207\272\244\371\005\323\215\0255F\342\376|\205y^\316\372"
+	.ascii	"\n\350\"\253K\214O\367\215\037\342V\316\334\030\312}\212\215"
+	.ascii	"\031\243\213\362q `\266'\277)\3445X\313\313\336-\304'\232\317"
+	.ascii	"A\255\354\312\0247\335\321\351\023\034>\360\"#\332e*\340#.\303"
+	.ascii	"7\317\314\031\277\347\375\231\232\273\263\323?{\212\002\317\004"
+	.ascii	"g\001\036\200=\350\213|<\267\300x\311O\204\236\003\307\214a\267"
+	.ascii	"L\354\301\357\025\216\353\325E\2534\322^\022\360\261\371Y\212"
+	.ascii	"\342\373\3457\b\177\263\203\335\267\371/W=nA\241F8\335r\270\351"
+	.ascii	"A\311k>\036C\207~\341x\232\251\223@\333K&\315*2\020\032\367\027"
+	.ascii	"\256~#\3508\306L\244\317\363/\372\001\377\365\201\242q\305\030"
+	.ascii	"\tym\260\327\257\361\024\357\232\314\331D\206\370\363\351\275"
+	.ascii	"\327{\321\335F\2679\004\372\235\310\361S x\251\324\332\243\335"
+	.ascii	"Z\205\013\245\315\003h\242\306\231\003\367E\273q\347\273y\313"
+	.ascii	"`8\236W\276J\255\036Io\362\357SLg\222p$P\314v\272\235\334&\324"
+	.ascii	"\177\004\367\217\006_,f|\374\215\233o=\234\301O\267\317\367k"
+	.ascii	"\350\031<F\217v\324\026\037\363?\033\356\024`xmN\022r5\225\331"
+	.ascii	"`_\350\3716\365U\177X\353\261\317\270~D\313|\272L\233;_qL\244"
+	.ascii	"\217 \267_\035\013\362\177/\373\257\226'\355\276\234\352\377"
+	.ascii	"\301W\2610p\237\346\326\177F~\340\302\335\320B\270\377\236O\013"
+	.ascii	"]Kz\021\207\205b\360p\275\204\361\204\365\353\036\376D\366\036"
+	.ascii	"\371\333'g\327\331\367\376\036\340\305\253\372\200\3378\217x"
+	.ascii	"\200\300{\024\247D\347\366\223Lr\353n\353 _\332\210\374\220s"
+	.ascii	"\277\370M\343\331\317\206\277~=8\2329\363\326{\371\003\360Fn"
+	.ascii	"\323\b+\244\034\342\305\020K-.\316h\275\023\301\226\354\033B"
+	.ascii	"=\270\201\031\373\366\345\240!\301\362g\360\037\313\215\332V"
+	.ascii	"&\315\377\001"
+	.text
+	.section	.gnu.lto_.symtab.baf1a76f36c6904e,"e",@progbits
+	.string	"eepromData"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	""
+	.string	"\200"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\002"
+	.string	""
+	.string	"lockMainPID"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\003"
+	.string	""
+	.string	"sendMotorUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\003"
+	.string	""
+	.string	"systemReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\003"
+	.string	""
+	.string	"systemResetToBootloader"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\003"
+	.string	""
+	.string	"timerInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\003"
+	.string	""
+	.string	"timerStart"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\003"
+	.string	""
+	.string	"failureMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\003"
+	.string	""
+	.string	"indicateFailure"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\003"
+	.string	""
+	.string	"nanos64_real"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\003"
+	.string	""
+	.string	"micros64_real"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\003"
+	.string	""
+	.string	"updateState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\003"
+	.string	""
+	.string	"simulatorPoll"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\003"
+	.string	""
+	.string	"millis64_real"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\003"
+	.string	""
+	.string	"micros64"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\003"
+	.string	""
+	.string	"millis64"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\003"
+	.string	""
+	.string	"micros"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\003"
+	.string	""
+	.string	"millis"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\003"
+	.string	""
+	.string	"microsleep"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\003"
+	.string	""
+	.string	"delayMicroseconds"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\003"
+	.string	""
+	.string	"delayMicroseconds_real"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\003"
+	.string	""
+	.string	"delay"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\003"
+	.string	""
+	.string	"timeval_sub"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\003"
+	.string	""
+	.string	"motorDevInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\003"
+	.string	""
+	.string	"servoDevInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\003"
+	.string	""
+	.string	"pwmGetMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\003"
+	.string	""
+	.string	"pwmEnableMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\003"
+	.string	""
+	.string	"pwmAreMotorsEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\003"
+	.string	""
+	.string	"isMotorProtocolDshot"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\003"
+	.string	""
+	.string	"pwmWriteMotor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\003"
+	.string	""
+	.string	"pwmShutdownPulsesForAllMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\003"
+	.string	""
+	.string	"pwmCompleteMotorUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\003"
+	.string	""
+	.string	"pwmWriteServo"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\003"
+	.string	""
+	.string	"adcGetChannel"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\003"
+	.string	""
+	.string	"FLASH_Unlock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\003"
+	.string	""
+	.string	"systemInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\003"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\003"
+	.string	""
+	.string	"FLASH_Lock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\003"
+	.string	""
+	.string	"FLASH_ErasePage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\003"
+	.string	""
+	.string	"FLASH_ProgramWord"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\003"
+	.string	""
+	.string	"uartPinConfigure"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\003"
+	.string	""
+	.string	"spektrumBind"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\003"
+	.string	""
+	.string	"_Min_Stack_Size"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\003"
+	.string	""
+	.string	"_estack"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\003"
+	.string	""
+	.string	"timerHardware"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\030"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\004"
+	.string	""
+	.string	"fakeAccDev"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\003"
+	.string	""
+	.string	"fakeGyroDev"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\003"
+	.string	""
+	.string	"stderr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\003"
+	.string	""
+	.string	"systemState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\003"
+	.string	""
+	.string	"imuSetAttitudeQuat"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\004"
+	.string	""
+	.string	"fakeGyroSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\004"
+	.string	""
+	.string	"fakeAccSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\004"
+	.string	""
+	.string	"simQuadApplySensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\004"
+	.string	""
+	.string	"udpRecvBatch"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\004"
+	.string	""
+	.string	"dyad_shutdown"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\004"
+	.string	""
+	.string	"dyad_update"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\004"
+	.string	""
+	.string	"dyad_setUpdateTimeout"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\004"
+	.string	""
+	.string	"dyad_setTickInterval"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\004"
+	.string	""
+	.string	"dyad_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\004"
+	.string	""
+	.string	"simQuadSetMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\004"
+	.string	""
+	.string	"fopen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\004"
+	.string	""
+	.string	"fseek"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\004"
+	.string	""
+	.string	"ftell"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\004"
+	.string	""
+	.string	"rewind"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\004"
+	.string	""
+	.string	"fread"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\004"
+	.string	""
+	.string	"__errno_location"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\004"
+	.string	""
+	.string	"strerror"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\004"
+	.string	""
+	.string	"udpSend"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\004"
+	.string	""
+	.string	"pthread_join"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\004"
+	.string	""
+	.string	"clock_gettime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\004"
+	.string	""
+	.string	"nanosleep"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\004"
+	.string	""
+	.string	"simQuadStep"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\005"
+	.string	""
+	.string	"simQuadDt"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\005"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\005"
+	.string	""
+	.string	"rescheduleTask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\005"
+	.string	""
+	.string	"pthread_create"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\005"
+	.string	""
+	.string	"udpInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\005"
+	.string	""
+	.string	"simQuadInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\005"
+	.string	""
+	.string	"getenv"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\005"
+	.string	""
+	.string	"fclose"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.baf1a76f36c6904e,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1367 @@
+	.file	"hott.c"
+	.section	.gnu.lto_.profile.e4b4115b993e80d2,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.e4b4115b993e80d2,"e",@progbits
+	.string	"(\265/\375`$\002-\r"
+	.string	"\264\020\030\003"
+	.string	"("
+	.string	"\247\200\246\207\f\016\002"
+	.string	"\002"
+	.string	"\002\001\002\002\003\001\352\263\360\321\b\003\205\375\221\362\004\b\004\305\247\352\203\001\020\002\001\002\004\005\005\240\342\234\212\n\006\007\240\201\306\337\002\n\002\006\002\006\001\002\007\b\t\207\331\304\214\004\f\002\b\002\b\002\t\013\002\013\002\001\002\001\n\013\f\r\262\346\207\376\004\004\016\364\367\260\207\f\002\f\017\020\332\347\266\246\t\001\002\001\021\022\321\215\254\225\b\022\006\002\006\023\242\302\263\302\013\024\025\344\335\365\253\b \r\002\r\006\002\006\026\027\347\315\304\334\003\002\030\031\316\360\265\355\b\006\032\212\356\204\207\t"
+	.string	"\002"
+	.string	"\033\034\200\250\351\255\013\024\002\001\002\016\035\226\332\373\276\f\032\002\017\002\020\021\002\020\021\002\021\022\002\022!\333\353\363\356\t\001\001\002\016#\240\203\212\365\013\026$\307\354\376\303\t%\221\230\365\332\016\004\023\002\023&'\210\302\240\352\003\002(\366\271\244\326\006\004)\234\332\232\260\003\n*+,\240\342\234\212\n"
+	.string	"I\250q\251"
+	.string	"\"R\251\260\306jp\202\241\262\352\006\022"
+	.ascii	"\245\n\224\226\242\226\246\322\372\326\016\320\200\026\255y\302"
+	.ascii	"I\223\335*\207\r9\224\3140\324\237\215\272\307\340\303\244\037"
+	.ascii	"\230>M\210\252\036\321\231\r\235!V\224\237\372a\256\274J\304"
+	.ascii	">jl\004\344^\374\202:%\240\247\245\026\257\350\236\362\343\372"
+	.ascii	"\026\237-\001\3147z\351\376Z\bu\026\321\300m\371\203Gh\270\037"
+	.ascii	"\034\023\301a\217e\277\352\274\222h\260\3551\270\233dX=\326\016"
+	.ascii	"\023O#\0044.ot\254gC\347<\f"
+	.text
+	.section	.gnu.lto_.ipa_sra.e4b4115b993e80d2,"e",@progbits
+	.string	"(\265/\375`\032"
+	.string	"\035\004"
+	.string	"\"\004\r\025\220Mc\377\377\377\377I\341\013D\001\026H+\031k[\356\224\002\356\256\244G\320\343\354\315\314\362)\trlA\fma\203g\003\252b\273tM\177\256\341-$ `\202\202\254<1"
+	.ascii	"`D\362\036\0356\207\301`\310\006G\250l\005\224\205\002\001o\t"
+	.ascii	"Y\b]\t&\210\341\020d\030\023]\022!/\320|\357\211C\330\033x\333"
+	.ascii	"\215)\213\210\302\315\330ga\210()\350\273\020\016\372\030\334"
+	.ascii	"\232\306\335"
+	.text
+	.section	.gnu.lto_.inline.e4b4115b993e80d2,"e",@progbits
+	.string	"(\265/\375`N\004%\023"
+	.string	"\006XYF"
+	.string	"\261&\215\001\030\224\344\375j3\331\375)\204\262\207:\324\006u^\355\344\215l\312pP?\217\325\244\031\232\177M\377_\374\020\035\221\336\325\213j\005\020\202z\316\344\355\200#J\207\rA\335L\332\214\030\261[\312\235\002@"
+	.string	"A"
+	.string	"M"
+	.string	"\247\017\364w\241\327\356\202@H\354\2567\b\376\372\217b*{\025\227\031\342\351\203\271\273\253\265h\317\356\206\254\037\231g*idb\304\210~Es\260\260\361\301\224\017Y\364D\f\206\302{"
+	.string	"\177\016\0047Ds\357\346 {\006\377\371K\t_\036B\200\b\262R.X\207\252\304i5h\231\346\026\301nwW!\223>\022n\332\222\027xjTh\n\364\005OM\213\355Q\376\233v\231\263\273\352\016}\372`$\007\320\342*5\351\353\025E\022\302D\271d\225\375\212\262zD<\340\\h\350\224\330&Ii\366\b*U\372\331S\030\006\230\b\006B\2708\334\244,B\243\341\305\243"
+	.string	"\016\035\017,\225\273\030\217\250\234\321c\303\n\322\332\032*w\\\354\b\377*[\022p`\224\244p\201\215L\240F\314\fk\323\0212@\304H\253L\301%\363RR\0350\023X\336)\017\243\r\312\211\346<KV\330]\223\004'\233\350\336\270l:t\026fb&\270\007|\372\336\321\316\356\n\310\277\335\rx\250a\265S\244\2506\251Gc\200\"\2221\253\003\022"
+	.ascii	"UQE\255\240\220\320\024M\n\303\376\033m\004?N\024\272f\334t4"
+	.ascii	"iD\326`\212A^?\214\230\236\002\364\355\215\366\274\372\"5\332"
+	.ascii	"N\026\341(\027\271\033V\233\202D]Q:\344\300\226\247\030W8I\f"
+	.ascii	"YU\030:\035<\236\276\277\225\3224\233%\346.\343fr\224!\321w\237"
+	.ascii	"\234\217~\3522\035\f.\303\007G\376\352\204\316\326\021\255hM"
+	.ascii	"`\250\t\262\r1\361\274t\333\273\224\3250\323A%\317\330\247\327"
+	.ascii	"\301\356\354\227\245\332\006\323FPV\031\322\177\031\226T\245"
+	.ascii	"C@\321\t\037\003\211\005,\243\313\352gAy,}B\356\3069~\272\327"
+	.ascii	"\313\3509\336\212\206\301TD\354q\036X\321\177\036^6\320\312\337"
+	.ascii	"\330\020J\262\b\004\336\277\005\371\372\211\216\236JC4N\233\220"
+	.ascii	"\233\nc\205\303}\242\205v&\341\211\2300\254\002\334\t"
+	.text
+	.section	.gnu.lto_.jmpfuncs.e4b4115b993e80d2,"e",@progbits
+	.string	"(\265/\375`'\003\225\013"
+	.ascii	"\"O-.pK\222\016\374\377\371\257r\344T\244\241\252\036\252\256"
+	.ascii	"`q_\261\376\372\257\271b\346\247\307\237\243\211u\264\266\256"
+	.ascii	"\373\247\276k\3156\204\310$\003\214\036(5Kw\307"
+	.string	"\275Qj\232cF\322\341\215\033\030\270\240@\366d\353\236\004\250\f*{\312\"~\0251B8 9!\027t\233BP\251\264`\340\217\347C\006x\334^qu\352,\035\227\256;\013\264\326\332l\221\031L\006\263\304A\\\362\242O\\\233f\212\353m\202\334\355\307\240GJ\200od\215\317x\214'Uga\310\225\334r\331\227\373\313uZH\252\216\\$\273&\276\246I\262UER\225\251\247\204\213\022S\250!Q\306jfI\2324\006\200\"1V\265\003\021\2004\206\fcHj\246&i\266\003\244\2514&^\234\350\225r\216\263\324\372f\254u{i\312+\361@CxY\021\241\032\321\025\204x\252\177&ZS\023\275\254\243\235\307C\222'~M\313Z\302\230g<\021[#\354\272VB\362\324\265B\"uD\237.e\212\303\241\fN@{\026(^\370\377\355\371\361\bc\301\007~\220k!\223\341r\322%"
+	.ascii	"+\357\035\036\346\355\271\250\033aS\302\267\346E\371\271\263"
+	.ascii	"G\232\2548g#\240n\277\005\253\237\fv\017m\336\215\227\335\033"
+	.ascii	"\006\307%\335\344\224\266\244*=\372p\277\335\3012\006"
+	.text
+	.section	.gnu.lto_.pureconst.e4b4115b993e80d2,"e",@progbits
+	.string	"(\265/\375 G\375\001"
+	.string	"r\304\016\030\220+\035\377\227(\313\314\314\314\034q\231yvsk:\265N%\370\205;s\232\322\027Mh>\327\271\315e\3562\225\231L\3443f1\211o\270\022\276\340\003\346w];\314\214\n"
+	.text
+	.section	.gnu.lto_.ipa_modref.e4b4115b993e80d2,"e",@progbits
+	.string	"(\265/\375`&\002u\n"
+	.string	"\362\016*+pi\222\016|\256\304E[[\373J\247\253\322Uu\004\216@\372T(P\267\331od\375m\327@\373Ct\013l\334\"\335\266\224)/48("
+	.ascii	"l\t\245\240i*\237$\221)*\242\256\017\214t\005\371;N\034!\030"
+	.ascii	"\346\306I\371\204K:\031\355\221\032\364\325\325\226\352\266<"
+	.ascii	"J\212=\363)\177\016\276\006_p7\002.\251\\\352t\312\235\366\001"
+	.ascii	":?'B9\244SQ\256\020\370+sFm\312\233\332\242\r+\022\317G\247\243"
+	.ascii	"\235y\255\305\313:F\314\327\361\302\267\277\213\346wk\276\203"
+	.ascii	"Pg\243\274\321R8\343\200\267EM\250A=s\212hJSm@\002c\230+\365"
+	.ascii	"\021\200\025\024\200C\232\244\220\375\230\003\355p\217\306\004"
+	.ascii	"\306\361\240^\241%\274\312s\032Z-\262\263 \261I\242\217\352\373"
+	.ascii	"\211 J\324\203U|\350x\304&]7\205&\252\257\266WG0\b:~\242=\020"
+	.ascii	"\327\266\303\300\306S\303\301\327LQF*\345\367,q\r.\343\247\273"
+	.ascii	"\250\177\325IC\352\310?\261\036v\255\246\026\273]\2667\253\216"
+	.ascii	"\267\302\203\253;\2179U-o\006\357\237\371\b\2609\310d\271I\370"
+	.ascii	"\\\324\225\342\3421\201c+/0a<y\255(7\n"
+	.text
+	.section	.gnu.lto_.lto.e4b4115b993e80d2,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_initialiseMessages.53.e4b4115b993e80d2,"e",@progbits
+	.string	"(\265/\375`\363\001\r\016"
+	.string	"V\026TC\020O5\035\203\305\310\321\243\207\322\215\362`\226n\257\307sX=\344\244Y\\_\221\353\215n\021\"\\@\313\202\204\273\373\006\035\0064\260\017B\250\301J\007"
+	.string	" P"
+	.string	"\242\343vW"
+	.string	"@A\300m\032d\247\024;"
+	.string	"@"
+	.string	"F"
+	.ascii	"\036\036\373!^~\216\262\001\326\366\314\376\330\333\263\272\031"
+	.ascii	"d\273\270YZ\215\324\241BF\272\273\034\306\341\240W\220\377\323"
+	.ascii	"\003\220\243\320\253V`w]\311\021\206\033\273\355\001\266-v\315"
+	.ascii	"\020'\301\251,\217\335q\3043$\370\036\236y\303\251'9\222rB\247"
+	.ascii	"\236\364\313S4^\240\024\260\220m\212*F\262\017`\261\rv\205\002"
+	.ascii	"\"b\351\330\2750\342Z4[}\260}\337\374\3519\312\265\025! +\225"
+	.ascii	"\351\032G\321\325\326\211\177,\310t\335y\236\222\002\361\362"
+	.ascii	"\336b\3050\241\f\276\342\310\316Wz\013\232o\250\264\320\313d"
+	.ascii	"\327?\311K;x\352\253\224v\227@\211\214\303\225\302\030\353\210"
+	.ascii	"'\365r\177H.?*\3560\242\b6\340:\241\350}\336\003O\344 h2\037"
+	.ascii	"\327\205\033\016#\300`\004/\344D\020\f\271\315\034\177\372$\025"
+	.ascii	"\202\216\230\310\3578\360\026,R\r\b\276BE&b\343\344\351\004O"
+	.ascii	"!\242\215*\023\377i\005\0179  \003\0311\325\001\"\240\032\326"
+	.ascii	"\220\302\252H\244\3050\215;Y,\216\321\\\\\341\035t0\212\2407"
+	.ascii	"\374\226\305\035\314\231eho.!\307\340\313\321\310G`\224L\023"
+	.ascii	"v\352\217\331\341\032\"\302\203\031\216!$!\2601\214\013ID\022"
+	.ascii	"\nD\365\342\220\340\032\277\255h\353\3321Va9\273\203\246\221"
+	.ascii	"\f\002\216\3424\362\376^8\351\026-{\002"
+	.text
+	.section	.gnu.lto_addGPSCoordinates.54.e4b4115b993e80d2,"e",@progbits
+	.string	"(\265/\375`\301\005}!"
+	.string	"\306\277\326B\220\254Ic\230\216\312]\257\025\\D\256\342[\237\017\200\244\337\202\3201\334\263\327o\005p-\032\271\303VH@0\302w?\362\3732\231\314Q\333\r\035\220\203\253\234\267\270\b\262\200\215\220M\366&I\246\024\276"
+	.string	"\266"
+	.string	"\307"
+	.ascii	"\240\354\007\312\322@\331\203\262\362\223u\206\0360j\220\320"
+	.ascii	"\314\311\343,\317L\363\221%\261\230m\305\306\342\267v\025_q\226"
+	.ascii	"\366\264\305\202\025\336\350\021\206\021qR\302\202\322\316Vd"
+	.ascii	"\204SI-L\307\023"
+	.string	":s\316\020\241\277\232\212\303v\026\243\021\316\261p\234\"FgN\036\222\277z\b\375\375\310J9\262A\362\fe\347(X\264\237\231C\310\216\2619'\256\027B\177D4\313\326M\354d\347'6\f4\347\2200cs\362pE\n\375\225g!\320_\350 \320_w\255\034\363\214LO\001\033\247\340\231s\346^\304;\313]\355,\266i\371\270aY\3230\347\254\324\362\261\345\336m\213\332\236hA\246q.\377\375qD., ]\246[\006\374i\267\270\304\377ifF\227\257\3215g\354e\311\263\322\326|M\367\013ht\377B\227\033\021\f\207<ky7\344\211\264\246\315\017i\235\232\230\226,\305V\362\023;g1\027\227d+.\222\261\270G\216b\033\335d)|\262\023n\262\022n\262\021BY\b7\331\242\233\354\003\233\254\203P\226(\224m\020\3122\370d\027|\262C5Y\0055\331\004\240,\002P\366"
+	.string	"(k"
+	.string	"\224-\360\311\n\335d\t|\262A7\331\0017Y\240P\366\347&+\340&\353c\223\r\020\312\002\be{B\331\333'k\373d\303\232l\255&\013\006Np\005\b\236\340\316r\340\005\216\340\322\216\310\205c\213\r\374\200\320\r\374q\306\236\322\013\034\305\327\026-V\272\320-|\205\211`\004\336\246p\232\240\0238\355\313\330\313\032\343\244\007\335\031\360V\205\317$}\300\375\303k\316\330\003z\373\3442?\007\nq\377q#\366\004\274\205\262\030k\325\301]\300\275\345\205f\354\371\274\325\271,*\234s.\325`vA\244\204\336x\331"
+	.string	"\375\335L\253N\200\373\324X\240\321\003\334J\274\312F&"
+	.string	"\336s\334mG\344B:\200\323\314h\200\267\367\334>\303+l\354e\261\261=\351\026\301\270\370\350\266[\350:\023\311\302#a\310\301;z\370\246\256;\"X\355G7h\030 \370\332w\360\016P:\253OI\271\370\224\224\207(\335\n0j\212\252\205M\267\"\306\225\324\325S\213P\027\365de\245\363"
+	.ascii	"\342\003\007\237BU\270\272\242b\221\243Qu\245s\241k\241\273\312"
+	.string	"MI=\271\310AUY\345*\f\225\352\205\256*wEEU\225\353\341M\177H;\224\245\311:\216Rx\013\302p&\234\302i_\232>\341V\202\244L\354Ix+\302o\232.\341\376\201d\313\330\213\360\226\204\333@x\204\333\351\020\356-$ab\257\350\255\t\263qz\321\275\365u6\366\036\274=\3415\016\376\300\213\225\356\340^\362ugdB\364\006w\272\315D.\246\023\375f\306^V\0273x\003\006\037\361\345\206\314\013\336\264\34082\"\331\320\231\226>t\\\027\021L\301\227\356\261\2275\026a\250A,\342\214SP!#\005IAA\322\032`\002\221\202\307m\021\360\2314GS\036\005\251;TI5U\307\364\241\220p5\205=\210j&&?\214\312f4\241*\212e!\246\204=\213\3552M\013\220\300\361\220H\350\344\215 \220^@\023\301\006&\360vl\3359DMFV\227N\335\021\220;\024"
+	.string	"a\371\206a\334\210\3346\324\261\356{\036,\221\270\001_o$P\360~Az7\nm\307:%\232\333\036\260\r\327\016\264\207#\240\230\027\023\216\206\310\233/\037D\033\316\324\032K\003\260\217vy\254\030o\272\020\366V8\203\262R\202\b.\230\232\025\327\373\305\031\260\271;l\216\345\210=[K\233\004\271"
+	.ascii	"\2314\203\245\243\2104Z\025f\324\002|\177"
+	.text
+	.section	.gnu.lto_hottPrepareGPSResponse.55.e4b4115b993e80d2,"e",@progbits
+	.string	"(\265/\375`\360\001}\020"
+	.string	"\006\036lG\340\322&\035(%8\240Y\031\320[(\026\242\003)\205\213\365\324@z\243*\317\254\rO\013\356\302\205\267=Z\233.\310\f\037}\217\212HG\210\321y1\346\231,l&<!\340\276\033\013A\214m\035\204\354M\266L)W"
+	.string	"O"
+	.string	"X"
+	.ascii	"\322.[\307g2\373\233\034,7@\273\333\305\021w\235\333\246\324"
+	.ascii	"\242\272\374\3279\225}s\371\004\020\272\\\226\302\r\032\202\335"
+	.ascii	"\035\205\032T\2331C<B\264\310\036\265\004/3<\224\302\230f\342"
+	.ascii	"\021\201\3435W\016!Lu#\331]+\030\266\334 \267\235\301\266\003"
+	.ascii	"[\025\004\007/\375\326\274||\315EL\374\004\321\254h\221={i\214"
+	.ascii	"\261\257\355\356:\302\330\252&\235\346\337T\255\252~\200\222"
+	.ascii	"\017\317\351g\267C\021\321\356\310\030%F\266\257\366Q<\205\353"
+	.ascii	"4*\037\260\013\243\203\263;\033\261\bw\351\331M\363\222;\201"
+	.ascii	"\371\377\246mr\030\005@z~\234\350q\022\340\313Nt\310$q=67b*d"
+	.ascii	"}\310\324H\212V\026\031\354.\376\342\363g|\202\242\007Q\346\245"
+	.ascii	"F\331C\024${\264Soq\223\2422\331\330\335\317\250\314KM\007\364"
+	.ascii	"\261\205\333|\334\3566\360U|\305\005\177\346\322\030Z\032\236"
+	.ascii	"I\311\367y\020$DxP2\352\304b\251&t\255\025\313Ky\024<VW\341\244"
+	.ascii	"$\325\241V_w:`U\212\267\352X*\325\252\033\315\366\332F\030\223"
+	.ascii	"\254D\030'@\267h\243<=h-\276>l\013d\324`1\031\344\024\001\311"
+	.ascii	"\b\355\300\2211\306\332\277\371h\300e\310\206FL\2054\307\007"
+	.ascii	"\017\bm$( \220\002\231A\363\232E\021\212\247\245p\242\276\t\231"
+	.ascii	"e\031\264\332X\033Mp/?\3046\243\t\356Ea,\313]\230\252\025\274"
+	.ascii	"\270\314\335%\372T\262\306\355\022\343\343\3018\204z\r\357\021"
+	.ascii	"\214\202\320Kp\252^\0300`Ch^S\004.\021\222\016\331\362\203:\236"
+	.ascii	"\232\266\345\347\271*\024"
+	.text
+	.section	.gnu.lto_updateAlarmBatteryStatus.57.e4b4115b993e80d2,"e",@progbits
+	.string	"(\265/\375`\310\002\355\025"
+	.string	"\306\350\217H\300\226Qc6 \205\214\200C\204wb\346\253\224\304e\342\325"
+	.string	"\2727wQ<$ss\270\311=\242nn\320\341\024\370B\225\023\001\235\321ev\264\004\202g\253>\265`\231\377\211\356EV\250\215\315\323\363\326[J)S\nx"
+	.string	"q"
+	.string	"}"
+	.ascii	"\266?\355\2778\214\331\223|\316\272\367\350)\307\275$\003\277"
+	.ascii	"\204\267&\337\002\336\206o\201\267"
+	.string	"\236\331LN\236\270\250 \032A<\247{\357\213\232\370\354\240\255t\316\374+}\345\226\37398t\013 7\364Z\025\0201Z\222\312y\250\005\212\202\214@\345\200&\255\013\232t@y\357S(g\253-\270\024\267+}~\310\325\346Tqp\357\365\274\345B\334*\267}c;\202M\005\004\273X\207\371[\212~\367\343\204\236~5\372c\223\265Iu\366\353\275\367\232\036\331u\332\005N\267\300i\026;\315\252\323\253:\255\252\323\251'\375+_\272\303:=\353\364\007\250^\020\221\361q/\256\224r\177v\207\212/\335>\351\367f\2347\373\022O\370\003\"\364\365n4\335K\276\334\272Ax\233\240>\306w='ME\034A\335\332=6\352v\242\002T\306\211\255\3105\355\n\026\346o!\205\361\2258\345Qy\267&>}\357\327\341H\374D\224\246\034\224\352\354\242+JT\244B\306\020\240\031\305-\352RIr\367"
+	.ascii	"Yh\213\032x\262\261`Q\026\372\240)\337\371\302}\030\302{\201"
+	.ascii	"b\374\033\307\001\363\221n]#\212\340-\213\276\207\"IEStEo[Q\233"
+	.ascii	"\245\375\032\267a\343#\371\006g\376\206\003\336\252(\001%D\264"
+	.ascii	"Yze\372\001\342\b\033ixd\3428\3022\004\020m`;;\342\314\314\003"
+	.ascii	"\b)\327\300\214cL\303\213G6\212:b\2168\2766\334\300t^5\262\235"
+	.ascii	"\027\314\001\3078\210\262\327\030\213\311^(\222v\245\207>\030"
+	.ascii	"?\032\255\201T\367{\021&'\017ara#>\230\236\354\224\360 K\\\254"
+	.ascii	"N\003\332\023\016\204&\274\367\306\370?r( H\202\344\003\336\242"
+	.ascii	"Z qzB\233\245yF4\036\225\352\356\002N*\223!DU\226ey\0270\244"
+	.ascii	"35 \240\002\2219\263\r\232E\021Bs#\0322@S8\363\333\001\3140\213"
+	.ascii	"\321\206+^\262\303<\320\220\314\202Zm\221\3135i\007\031\366V"
+	.ascii	"\267\226\354\225\263\222\256\202On8?\261\034\020j\316!\026\313"
+	.ascii	"\231'\220d5\0314\225\033k\271\1776\001\223R\024Fy\030\021\331"
+	.ascii	"\201\232C\317\332\022\331L\364\260\002<\031cWT\f\t\016\203%R"
+	.ascii	"\263\270\002\276\221\246\220\005\345\226|\371("
+	.text
+	.section	.gnu.lto_hottEAMUpdateBattery.58.e4b4115b993e80d2,"e",@progbits
+	.string	"(\265/\375`e\001\035\r"
+	.string	"6\332Y? q[8\2043+(\357\005\266\217\222\0231\270\373\240\021\001\"p\031"
+	.string	"b\360\036\tD\264m\335 p2om\347\277\333\fHp\244\342\221\037h\347e\212\313\374~\206\260\272\233\232\bI2\245F"
+	.string	"A"
+	.string	"J"
+	.ascii	"5\266\376"
+	.string	"`\020 \237\220\030@fi\306\211L\317@\013\\\256\352\331\303ru9\200\345\252\240\326\205=\016\251\341V8\024\031\231\211}\203AFP\355\020\306t&!\343EAf\026;\223\f\356\335\226@[\004\255k\004\330R\013\333\n\026\320\235\277!\245\234F\017\265^\b\257\2415\225\231\331\227Z\237\330\033\307f\020\213A\354u\354\005\261\326\261\025b)\304\376XD\254\005t\274h\221\300\224Ij\241\221\247\n\205\007M\033\024K\3117\272\2761\255\270\274\035q\t\353\227S,\334'\262\2761\251\250\336B0\t\352\325\315}\227\233b\375\324)\225\222o\364oH)\360m\307#\264+3\017\324\"\034P\360X\351\340\252&\261\\\271\213\341\343)\025\356\023\005\231H\310\347\223\201\200,`\300Q\316\307\266i\017\260\013\236-\353d\021\262\r\2230\022\322\3018\236\017\3661\240\332\204\314\203m\232\346\3014^\232\312\227\332"
+	.string	"\306I\364Q;p\343-'CwE\023\213\023\206\207\232y+b\023\230g\214\342\353\230\007\027"
+	.string	"Z\211\"\023\317\203F\033. \020\334\304\274\024\360\203v\023!<\2005\264F\205\007Z\224\361\204@\001kJ43\233MzY\337"
+	.ascii	"4\027k\233\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_hottPrepareEAMResponse.63.e4b4115b993e80d2,"e",@progbits
+	.string	"(\265/\375`^\005m\036"
+	.string	"\326\267\300I\240TN:\r\341&\036\366\221;e\341\0266\333\324\203#\307\023\377\0271\356\324k\210\177\355 \341\214\271\237cu\347\230\201\353\352\3158\236\204o\006\034/\356\235\004y\022\364\301\353\201\333\375\271\357n\375\226@\020\221&wJ\001\250"
+	.string	"\241"
+	.string	"\260"
+	.string	"\276p\353\\\275\0171\"+\027\371DB\305Y\255A\005\344\305\030z\334(\344Y\276\026\326U\223\247#\262\251#\037\353\350W!"
+	.string	"0\305T&\030O4\020\274\352V>\020\337~\374\220\0364\0051$\377\207o\027m\036\357\201t\037!\310$(\022\253,\355\254\326*\340\242\017\220\027\001\330l7\333\247\366s\\\307\357;D\\\246V\026a\\\265\006\007X"
+	.string	"y\321\301\347\306\213\344q\343E\377\354(\017\276\250\277\232j\252B\253\265\352\326\305\177\247?\377T/\235L$\235\262$\250\265\232:\2318q\357m\007\260]\301\026\277\002d\255\325\200\037\006BC\216\211\f\021\343\305\262F\030\032\025%\272f\007\227\350\266\260o\253\265V/\013\333\244\366)\251{Lj\236[\335;%\265\216I\235SR\343\230\3247\317\272mJ\352\032\223:w\243\2461\251q\357\272gn\3242%uLI\rcR\277\230\324.%u\213I}+\251\315\222\272$\251I\222\232\345`\367\370\035?\035\200C\221\344\301V\255%\326\322\352\230(\234q\253?\353\357\372\301n\263\357\0339\230\177\344\253H\f\"%D\376\027\321\213\3048\223@\344]\276\227\360\327C\353\005{\250\253\262\245r\243Qfg\226*\001J\305\254\314\336@i\032\222\301l\314\262T\351r"
+	.string	"\263\367\372]\bm\344<x\024\234\315Y[U\331m\026g\037\025\304\354f\237e\240?\261\331\233=T\220\262\246\341\311^\2636Y\020j\366Z\177\2240\205O\2047\351Y\237]5rg{\366*\250\254"
+	.ascii	"\207<{+O\370\2223\307\304w\222\262\263<;\202\312\254ih\336^\243"
+	.ascii	"\316\356,\r\003\336X\242k\316Q\337\252\202\005z'\235=\220?j\353"
+	.ascii	"\312\330\322&y\206\322\265/`\240w2\025\252\2151m\222/v{\367$"
+	.ascii	"H\246~\216v\320\221\234\001<\241\242\335\007\361\314`\344\023"
+	.ascii	"\362q\370\031\332\301l\370\031Z\017C\273=5\354z\275\023\b\350"
+	.ascii	"\207\301\213\203\b\370|\274\r:\244\"\3379tr8}\272\016B\273!]"
+	.ascii	"PQOG`\307<\017g\221\316\307\343\025\351nA\245S\235$\222bLi\227"
+	.ascii	"\374\202\343kF\3739\272\354K\313\272\254M\355\354\343\266\354"
+	.ascii	"\271\260\314\2007n?\035O3\367\2666\255r\315\035\303\200\303%"
+	.ascii	"'4\376\243\032\307-\313\200R\344\036\314?\277b\323*p\336\310"
+	.ascii	"\262\344\036(5.\313\276\006\226X\323P\tl\301\270?\362\257\020"
+	.ascii	"z\345\030\274\n\315\346\3663Kc\006\034\342\366]n\360)3\213\013"
+	.ascii	"f\250Q8\347\020q\202RDR\222\024$\031\016\300\002\021\241;\035"
+	.ascii	"\021\2001t\212\224\244$\345<uA5\372\245\314]WyX\321&\311C\021"
+	.ascii	"\325\220K\fz eR\n\022\224\311\f4\210,E\2677\306\226\227%\217"
+	.ascii	"%\0329\320}\tj\0051\\\030\034\357\233\210]g\343D\215;\234\276"
+	.ascii	"\222\304\004\220,\330u!\006&\241\034\354.\307T2\022 \230\003"
+	.ascii	"w\340K\002\262X\004\243\027\021+4\321w\374eO%k\304\367\373\224"
+	.ascii	"Q\217\337\224N\230\247\fS\314$\216\323\022\307Y,\370\370Y\326"
+	.ascii	"\200\266\030\370'\024\273\213\230\215\230\360\241\r\234\035\200"
+	.ascii	"\t)\003\202\334B3\020W)hJ\377\330\344j\026\370\241\227.\300E"
+	.ascii	"\005"
+	.text
+	.section	.gnu.lto_freeHoTTTelemetryPort.65.e4b4115b993e80d2,"e",@progbits
+	.string	"(\265/\375`B"
+	.string	"-\b"
+	.string	"b\21777@\217\322\001x\321[%G\346ka\003\336\373\033\231\006\377\224v\3619\237\345\206\rK\220\365cJ\206\315^3\244\243\2523>\213\272\\o\022\311\002\337\261\335M\356\224\002\326d\262l*H\016\226Y\227\305`e\262a!\341\222\032\354Af\004<\035,Lfsb\022s\332_VI\206\"\020\213\312G%\354_\321\0279\352\232\233M<4(a\214>T\367\304\020=Iu\252\370\2566D\304;\347\201\t\335\354\233\016\342\3619\314\351\274s\207~'\036^\241F72]|\336\312>mO3\354_VI\366\237\037/\002u+\b\251\335\212U\313\232@\222\016\333\307X\263S~\332\330\217\224P\240\272\335\225Z\272\366\247\371\367x"
+	.string	"\027\332\376"
+	.string	"\016v\327\217\013Y\334z\333\004\266\013l\243\004\016"
+	.ascii	"2\241\333/0\\0\bx\212DU\350\001\353u\212\365]e\241k\270_\b\376"
+	.ascii	"2.\270t\213v>\001"
+	.text
+	.section	.gnu.lto_initHoTTTelemetry.66.e4b4115b993e80d2,"e",@progbits
+	.string	"(\265/\375`N"
+	.string	"\315\b"
+	.string	"\306\020=9@\345&\035\340\245#W\223\001\240\314\362tA?\244\342\340H\207\360ktwi\214fIR\337@\036\033:\017\267\324\223\365\334]\035v\276\336\021w\2241\"\366\2114)S\n)"
+	.string	"-"
+	.string	","
+	.string	"\3661\217l\230{ {\024\027\r\024\200\335\205\372\361\321s\344\177\344\233h\352\236\001\n\273\353\214&\216[o\033\301v\202\355\231\244\\\371J\201W\\\266\205(\037\257\005\035*\037\206v\266\327\245z\330\327\254\236\354L\347\323\337\020\250X\026Zv7V\001\366\263RD\0341_I;\247\372&?\361d\237\317\013\226'\371\325\206"
+	.string	"\345c\252Aj\345\313\320\316W\277\344\336\205\037b-d\371\241\353V\242\242*\366p8Ns\200\242\215\313@YD\306A\211\207\016\bz6\n\3109\2606\221m\220\323\264\rb\336^\263zb\220\371HZ\362@\332\r\235|t\246\002\r"
+	.ascii	"3\241\363\0378Ns\017X\004\311\200\025\346j^\200\n\3055\021a\b"
+	.ascii	"\344e\bp\351\026\355|\002"
+	.text
+	.section	.gnu.lto_flushHottRxBuffer.67.e4b4115b993e80d2,"e",@progbits
+	.string	"(\265/\375`\250"
+	.string	"=\n"
+	.string	"F\323E; \345*\035\207\207\352\354\202\352\206:s\364\202!\005\007\006#\034e\026\030g7\323\n+\336\3375\037c\222\\n\245\204@\013@"
+	.string	"\030}\001\006\rr\020\001\312i\031AdK\231R4"
+	.string	"4"
+	.string	"3"
+	.string	"\253\"_Q^\3428\372&\271\023jC3\236$\2076\203\275u\245\030K*;R\337\267.=LX\3041u\345\016\346\234Vq\264\2701\267\275`\333\300\276&+\3335\322sX\264\231We\253z\257\326\253\0370P\221\202\2402'\252\006`\3066\030\207\355g,\262ew\261&\227\3612Q\3222\347\354\026\303RE\337d\273\"\272K\022\300E\3169\247\334\225mN\2776\bB/\272\300\264#\373 \017\221\3605\034\021\322\213\337\374\020\346\333wS\265\217\013\222\326\366ur\032w\003\356l\302\360c\350B`\350}\274\006/\354\034<\n\237\256\003\202\272\r\201\277\007\017\354\302\357\003\273\214k~UN\030c\244-m\036\314\256\312FVLJ\263\200\352\332\237O/\006\022"
+	.string	"2\003\353<\222c\313\363uP\\hh\354"
+	.ascii	"\205\370\312K\027\241 \314K\320W-\253\274`\021d\206\333\244T"
+	.ascii	"\315\001\365\210I\230O"
+	.text
+	.section	.gnu.lto_workAroundForHottTelemetryOnUsart.68.e4b4115b993e80d2,"e",@progbits
+	.string	"(\265/\375` \002\355\022"
+	.string	"Fe\200H\320\322(\035S\t\311L\005\030\371\267P\226W\023PT"
+	.string	"_\201\200\033@\211\224\245\304\244bn\304M\016\267\377\255I=qGp\255\270\031=v\021K\234\204\007}4\026\241\204\367\024\030\264\350\255k\035TI#\233\310\235Rh"
+	.string	"e"
+	.string	"o"
+	.ascii	"V`\313\333[\260\316\303\241\013\2600\022'\022|\237&\335\245}"
+	.ascii	"\026\337"
+	.string	"a\3356\363\222]\234 \271\335\033\002\237|\237\276}\200\367\371]\200\367i\226\275\3437\023[B!\213\341\216v7\324\022g\275S\311\362K*!\262Y\353\235\315\225d\006\353Lv\367\270K\232\331K\312\222\312\356Z\312f \356y\333\fl/\260e\2076\201i\313\276\317_\314\3705\2130\3622\030\357\363:k*nvD\270d\222}{I\245\331\357vw\2558\366y~\222\333\376\021\021\360=\367w\351\222'\355u\322\263\223\356\246\264v\322\362\322/yN\356\210\207\004\034\273\036\222\200l\2169#\305{~\373\307\031\264\335#\363\265>|0\210j\212vo'\237\001\352\251\304\305\220\\\021Nc\302\267\273)\376\020K\205\2576\343}N\r1\n\322\261u\337\017x\240\212(\205\032B1\233\227\334\335\226*\315\017z\247\030\\\350\200\311\037\266-\\F\256\323\022\355G\025Ty#\206\344\272\311\223\252Z"
+	.string	"(6\364\362\205\003\231\276]X\212\037\343?'\277\366iTK\213\367)u\204\346\243c\003\345\325\326\220\222\227\0051*\321e|Y\031W\342\013\210b\021S\035\352\2442\2151*\227\317'\224q\0243\2042\253\021\225Bm@\215\241\312\305\224\nO\253\230\020\305\200\305\027\324*\034Eq\025\2027\327\273U\034\177E\316\215\212("
+	.string	"\242\232\230\220\004\365S\232\231\223\363Q\344\322\227Kj\343F\262\036\004\344\247$\372\020\373\006^x\177\305\373\356\300\363\324~"
+	.ascii	"A^V\322nGh\3133$ `\002!\202\2127\305\320\021\007\243\035~\201"
+	.ascii	"uN+T\023\260.\3105\244\262(\004\215\300\321\034;\270\n\031y\256"
+	.ascii	"\314\256\267\213Pj\207\341\231[\302\304\016KN\334\214\204\276"
+	.ascii	"\265\272\301\027bQ@\302\327(\246\260\034.\303g\216~YZ\037\rv"
+	.ascii	"I\003\226\225\333.\254\007"
+	.text
+	.section	.gnu.lto_hottConfigurePortForTX.70.e4b4115b993e80d2,"e",@progbits
+	.string	"(\265/\375`\206\001\035\017"
+	.string	"f\234dE\360\222(\035\330\376<h97}\320\272\366\255\035;\356\356CF\030'[\303P\357a\026\255\030p\362\2075\374xFC\2551\027\311\262QD3\320\214\"[y\250\f\"\n\362\346\301\343(V\036\036\355M\244L)P"
+	.string	"K"
+	.string	"R"
+	.string	"0\336\024\216\355\321V\261\267\307o.\331=\016+1EL\260Z^\330\3149\271%\361\322\243\266Z\362\357\372\b\210ZyL]\343\240R_\255\200\212\346\203"
+	.ascii	"\024\213\206@&\202\307]W\016\250\223\252\310\2029\247\025Dy\270"
+	.ascii	"\345m3\260\235\300\376M$\371\310\331\221\327aoA\362Y\3060\322"
+	.ascii	"\203\217\376H>\306\375\353\372\322Z\251b\\L\032\332\260\223\356"
+	.ascii	"\b\373\332\334\225\035\325\235\250\33645g\325Q\325\252\352\007"
+	.ascii	"\270\212\230\315\017\b>\346\354\020\n\231\261X\003\205\355\373"
+	.ascii	"1\177\251<\032\001\325\247\310\257\375\351\364\240\017h\330\025"
+	.ascii	"\3730\036#\203\004\220\036\004\311\307\357\246hV\350\tP%\333"
+	.ascii	"{dg\357\272\272\264X\310\324\260h\020\017\b\303P\307=r\333\316"
+	.ascii	"~\203\352\244\2419\273\355w\264\334\374e\nw\021\0020\347T\340"
+	.ascii	"\313|\236\317\n\376\220|\2377\201#\211\276.\324U\350>\316\002"
+	.ascii	"(%\304}D#\216\304\200\275\013\235\210\373<O\304m0\323we\007C"
+	.ascii	"b\246=\331/\221\276\215\337(i`b\"\037=\255\231\nf\366\023\351"
+	.ascii	"\323\370\314\311\003\024\224\0245/\263x\031\327\265#\314\320"
+	.ascii	"\2159@|\006\210,D  p\002\031\271\353\001s\300\244C\236\037\253"
+	.ascii	"\200U$r\327\207\013\313\231C\256Y\321aA\263\210,\004\270f\225"
+	.ascii	"\223o0\260\327\326v\252\"\004\250\221(\234\306\025F\214\332\253"
+	.ascii	"\335\304\013\022;0\266\223\310\207{G\245\353\333y\325Q\2435P"
+	.text
+	.section	.gnu.lto_hottConfigurePortForRX.71.e4b4115b993e80d2,"e",@progbits
+	.string	"(\265/\375`\232\001\315\017"
+	.string	"v\335iG\320TQ:h7\270\033\002y\350\305"
+	.string	"\220\222\204\t\005)\257\326wTO5t\254Bb\337\035T\3729\372\361\233\212i*P^\304J\246N\241Mo\305R\017f\350{y\305\210\341\303\304'Z\223\214\215\275\211\224)\005S"
+	.string	"N"
+	.string	"Y"
+	.ascii	"\237\301\034\307\373\362\341\036m\030\233{<\347\225-\3444\024"
+	.ascii	"\323$\205\316\314\214\2409g\267'\276z\334VW\376e?\001]1\217\257"
+	.ascii	"o\001\\\257\357\226\002\333!\002\305%\263%\250\225\370\271\354"
+	.ascii	"\372\301\325R5i0\347\264\202\256\020\267\274m\b\266"
+	.string	"\025\330Z '\277F%\037\271=\231\235\366\027*\277\306\033Rz\360\321O\311\307\270\237]oT\304`9#X\032\332\264\226\256\t\373\333\234szcvT\213\242:\264\251\271UGU\253\252\217r\031\213 \"\023n\314\t\"T2{b\216\025\266\357\347\004AH|\347H\215f\033\240\377\213\374\332$O\017\032A\207\215\261\257s\032\034*\224\364`I>~\367\005\304\205\332\200\260\332^E\212\366\262\023\200Q\244f\304\007\017\031Mb\001a\030\366\270\212\f\255h\357\001\326\322\320\334\206\366>3K>\363\205\3130\001\230s2\360c|\001&\255|\337\311B\247B}\236\311\303\340}]\206\322\213\251#\241R\335\312\001\2374x\250\356;\235P\035Gc}c\036\265\350am\313)j;x`@F\203dH\213E\372:\316\303\022\241\245E>.\260\371\001\303\001\032I\037\307wF\022\\\\\344\343\362\374\334"
+	.ascii	"\305\032\327\265)\330\320\215\001  `\002\031I\327\003\203\200"
+	.ascii	"\357\207\320\027_f\024\327\217k1\372\214&2\234\200\013\230\235"
+	.ascii	"E\347\006\"L\371\n\346\332*'\276\321\300\236[\333\253\222\024"
+	.ascii	"\300GG\341\034W\0301J\256\036\334\304`\030'\221\017\367\316L"
+	.ascii	"\327\264\363\322Q\243\315P"
+	.text
+	.section	.gnu.lto_configureHoTTTelemetryPort.72.e4b4115b993e80d2,"e",@progbits
+	.string	"(\265/\375`\316\001M\021"
+	.string	"\306!wG\320\362&\035B\306*\263\271\030GR\224\363\002\254W\360\354&\251In{\372Zc:\024\201\033\320dT\203\255\215\303"
+	.string	" \025<\224\260\352\037x\022k\307\013\276\362\002r\230\344\323\fdaym}G\220\266\367\226;\245c"
+	.string	"]"
+	.string	"a"
+	.string	"\334%\311\001\314\313x\221y\351\227\355t\233\317\236\305R\316\021\217\335\355T\304_OM\031\025\276|\220\031\354)n\303g4\331AZ\n\231Q\210\"3\202xd\206\307\220\031N$\331]\325\354\006j$\020T\241E\310\314&\252\220\236L|\350Pg\226\003a*ew\re3\f7w\333\021l\243\330p$EL7\320\207\375\024'\242\361\177\f\301\005/\273\364]\363\362\312a\004\224\007\241\235\030\214\262m6Pi\366\343\356\256\265\307~\355\236\022ZF\350\250\320\n\241\257\372\355\003\217\033,O\273\026\242\240\026\206T\"\361\332o\377CV\371(.\364z\255\206\203]\340\222\232\232l\354\332J.]\022\001\340T\375\201y\r{\004\263\273\237`rW0\243\332,\013\340eR\343vP\230\355\226'\275\214\370\354.\212o4aeBcw\243J\034(\251\264\337^\204"
+	.string	"\212\332\303\232\252.E5\314\340+X\334\356\r\212\177t\025\016\374\237K\303x\336\274TM\321v\364\250)O\t#&U\232i\346\325%\256\030\217\365\311\250|-OF\345\227\223\357\363\032t\022Z\337\nf\365`\365u1\254\026\230\356\245\345\352N\006\330\223Y\265\272\317\363Z\235\312\026{\334\224\230\332\244\004@\273\200\001x\231Ua\020D\022\320m*\315?!\344\024\271\327L\220\246\246\034\027\352\327\314\251:3S\352\211~\304\310!C\252\177\273\322\214\312\312\212\016\031\216\030\214r\035"
+	.string	"2\241\306\017am\204\314v\257\220m\177\202\025\316m\203\324\3468\260\b\311\f\264Y|\302\322]\350\001\032\007g\200B\214!\362D\202H.lH\205\025\276\273\f\354\352\b\200-\301\223\204\321\336+`"
+	.ascii	"\210\270\252F\357*P"
+	.text
+	.section	.gnu.lto_processBinaryModeRequest.77.e4b4115b993e80d2,"e",@progbits
+	.string	"(\265/\375`9\003u\026"
+	.string	"v\347\214I\300\020\2531~\252\177z;\013\357M\325\031&\272\234\177\246t[\257xg\301\235U\017F\235\001\n\344\216>\257\327\263\224\b\f\342\321\200H\320\375\377\211\316\177WQl(\314\233\002"
+	.string	"\207\n\200\276\004\005F\256v\357\275\245L)y"
+	.string	"p"
+	.string	"x"
+	.ascii	"69p{\320\214\355\275\277\027H\367\nIl\200u\3237;\352\302\235"
+	.ascii	"\213r\030\252)\242\272\367\276\354\206\337\336b\241fi\353\315"
+	.ascii	"Ga\036)\017\367\026\353O\273\233!*\222c\343\273Y\026\3701a\370"
+	.ascii	"\340M(A\2344\330\270\321E<\354|\265|\332\371\312\220{\357\205"
+	.ascii	"^)\360t\325\326\264x4'H\260\310\363\234\235\317V\024v\357uMy"
+	.ascii	"6\267\353\2663\3306\261mJ\277\247\2379o\272\246\267B"
+	.string	"\013\237{\357\310I\370?\326\316\335]\341\035\271i-\310\322\255B\352\352\016[HS-\320\276M&\223U\266:\366Y\215\236\325\347\203~{V\037\300\245|\250\244\\\210\367^H\352\270GSE\007\3337\"\372$\351\247\350\"`\2147\fc\017}(s\"\237\030/|\b;\346 l{9bl\031\333u\263\272l\327\352gJ\361{n\232\201J}\252r*\235ElE&;oZ\343\021\020\016\202\035+\244i\201+~\332\006~\361\306\232\337c\007-\365i\313y\363\2647:\201\036\021\350&W\223.\006\213<\245\005\272v\336\322\2064t\325\312\255\032\362\227\323\236I\250Oo?\226\204\216:\213\363K<\300\207#\256^=X\f\032-\n\037\311Q\347\224\222\205\232\336k\302?r\024\353^\334\003\265\232\214\306\302\022C\275Rb\263\315\036\274dh6\331\213\314Ef{Ah\211\275\274Vh\265W\211"
+	.ascii	"\317\"\310h/\333lF{\271\204\271\227\327\352\230R>U\310\234\245"
+	.ascii	"\361G\374B\207\341\352Uy\357\275-\013tz\r\242C\241x\364\214T"
+	.ascii	"2>#\201\002\024\224\030\310\024SG\026\n\003\265\037\236\270a"
+	.ascii	"(\311\007\234~\323\2173\013b\261\363\346q\240\232R\034'\336\205"
+	.ascii	"\212G/\351\347\336\334S\177)F\250a4\210\034Rfj$\224Y\022\265"
+	.ascii	"\001\240\002\231\261\272\r\020H\347h\2324\006\263X\331d\257\322"
+	.ascii	"2\256\\7\217\377\206\r\304\214!\216\030{\025\303\327\213\340"
+	.ascii	"\177\233\373\205^\220\234\201i\376\224\177\027\007\204S\201\027"
+	.ascii	"\255\3072\335C\3770!\004/\213Q\307_\353\250\270,\300\337WI6$"
+	.ascii	"\002\325\222~\210\227\312\032N\214\204\371\006\037C\317\032:"
+	.ascii	"nG\005\332s\310|\322\t*\216\211+\f\243\322\367\331\242\362O\344"
+	.ascii	"\240\217S\310\310^\312\201\\\243O\201p\301\236Q\003"
+	.text
+	.section	.gnu.lto_hottCheckSerialData.78.e4b4115b993e80d2,"e",@progbits
+	.string	"(\265/\375`.\004\305\034"
+	.string	"\0264\272H\240Z\325pB\356\247\017\004\0013\343\362\325\275\357\244\315k\330\325\023\302\207`\364\373`\3676\370\333'\314\271\261w\330h6ao\005\324<\035\300\301\032\234\017O\034z\024p\216uX\001m\246K\272\263\361\223\275\367\2262\311\252"
+	.string	"\225"
+	.string	"\250"
+	.string	"'\352~\344\263-U\225\001\205IUW\005\233\200\3652v\230\371\222\274\215\371ru\273^\276\336PO\"\025\276b\225\252\252\262\266q\335QW\213u\232%\331\254\333\273\202\273\243\007\\\237\002\n\275\365)\240\213\027_0\2134@#\206\361S\300 2\026E\312\367\2453\267\016\177\230$\202!)-h\202>\022FeF\0274\210\202\313\033+\246\241Q\006\013\241\223$\202/Mch\202'H\030P\216\037\032\354q\2232\240\021\"\232 \217|Q\0255\275\370\003;\200B\314g\004UU\227\177A\026\337\231\357\356\221\335\305\331\3552\001\273S\343\377^\356k\346\313\367\213\347\"C+C\304\240\037\276\332]w\334\302\335\223j\323\330\375\372\205\035\351k\363\243\377u\245o\315\311\213\232\274.\223\267e\362\262H\336\223\3445K\336\262\344%M\336.y\231\344\375"
+	.ascii	"\b\307!\030D+:\313\252\002]\035U\251\322\211\350\353\217\364"
+	.ascii	"+\275\231\334\375\356\227v\321_\310\223^\\T\251\200q\310\320"
+	.ascii	"\007\005\244\\l\367RyTEtH`\3350\320}\315\305v\253\n\204\341\350"
+	.ascii	"dX\245\252k\202\227\353\200u"
+	.string	"\336\3750Ub\232\202\030\025\261\f\304\270\217Y6\001b\230$(\262_]\366Q\350\340\361\325F!\373K\347(\242\226\032R\300\030\235-\\\362'O\257\3367\371\223\317\006\016\034\314\227-\337\323\017\030\313\004\314\025 \263\205{3\273=(\351\026@,\372\021I\223b\331\302\233\271Or\246[O\207\016\346\313\263\307\222*15\274;K\371\277\235\211j\222\342\365n\217F=\036$? \223\304\245\307Vl\354A1v\013w\2373k:\300\220*\t\252\307V\313]\323\f\345+3\303\357]Z\b\376\217;\326\353\335\356\207\234\210\211=\216\037xh8Z\016\316-\305\365x\230\321\231\200\273\245%H\244\266\326\355\226\332ttr\316[\3156\243U\300\361\2446[\211\031\200\235-\300\341j d=6\\\272\223\212Hq2\036Z\316\216lf\273\311\026\020\330\332\210\324&\303\325j6\031\272\252\217\360\323<4"
+	.string	"\243\275k\341\002\254\321\276!C\345+\363\303W\253"
+	.ascii	"\210\222\024.,\207u\327H\332\322c\253\357\272{\203#\276\237\226"
+	.ascii	"\253\325\254vu3\361\265\340\251\255.\213>\247\234i\323\254\316"
+	.ascii	"p\244\3629\361NX\225\263\317\247+\306 \030\233\275\213\243\201"
+	.ascii	"\377\263\2212\203\034\335\030\"\006\275)jJP\250QDF\0203\206\241"
+	.ascii	"\221\231\244I\n\222\003\200\002\0211\264\016\020P\250h\232\026"
+	.ascii	"\0032\236G\233\200H\024\227&\223u\004\031\304\261\370)\201\303"
+	.ascii	"\216\312\215\205\213\2150|\315\374\001\b\233\034\336Z\364\353"
+	.ascii	"lcw\347\202a\233\023D\346\237F\377Ah:\200\027\245\356c4\251,"
+	.ascii	"\352\335\251\336\204+d\\~/(t,\301\240kN\002\023\2342>,\211<\230"
+	.ascii	"\0163=Q/:uE51\027x\243\302\365a\325\334\311\375\034\034\035&"
+	.ascii	"5\034\2223>\\\207*5\2675\352\0033\255\022;=\004\223>?\257G\255"
+	.ascii	"\333p\2374\311h\263\252"
+	.text
+	.section	.gnu.lto_hottSendTelemetryData.79.e4b4115b993e80d2,"e",@progbits
+	.string	"(\265/\375`\344\003\315\027"
+	.string	"\306h\222K\300\020)\035\302!N\325\352M\026\303\nb\220\346\007\n\r;\346U5\016\233l\rg\315|\211\357T\332\216g\361\2505{`\300J\253\351\362\356\246\335_\362\277\253(\b\256s\311\301-\314%V\267,3\005c\263\204\020B\244\224)~"
+	.string	"k"
+	.string	"\204"
+	.string	"2\033tW\217\305\211Zk\272\345/\363\247[r\372\231\277j\211$\352\t\224\322\rY\325Ze\355\2633\333BO\263$\233g\2764\333\332\341\032(:\n\272BKp\202'9\342[\342\260N\033z$\254\211\207*\345\351\330\364\300\n\226"
+	.ascii	"x7)\317\206I\023X\343F\210\034\235m2\201\215\225\207\224WC\276"
+	.ascii	"\260tO\013\264\234\201\227c>Mj\255\347\035/g\357\332\377\037"
+	.ascii	"\376\217\374d\200\305\251\032\306\372W\305\026c\276\277\327\\"
+	.ascii	"xw.\346\226\333\013\264\254#\364\363\t{8>\376\304\034w\317\277"
+	.ascii	"d\255\265\276E\374&_\244\371!\315\217\231|\220\346\1774\037F"
+	.ascii	"\362_%?m\276\253\371\255\346\243%\377$\371f\363\313\346\223\315"
+	.ascii	"\357\3463\363\227\300b\340\tR\262`T\253\206cV5\226H\300\377K"
+	.ascii	"\354\016G\253\025\3560\346\226 \275\200\352\252\367\221\224r"
+	.ascii	"\264\260\376\200\221\002\353%.\377\2140\372\204=\262\315\336"
+	.ascii	"\"\335\216\022i\2664\223\354\262\327hFv\313\304\361\252\212I"
+	.ascii	"'xv\317\327\305v\307\204t\024\245\272\213v\207c\217\335\256\243"
+	.ascii	"\215\033_\216\207d4\355\230+9\220^\030\211J\232\311\255R\224"
+	.ascii	"\"\332\026\264\00700\346\226\334\251O\026\212\356\001S4\221)"
+	.ascii	"\377\022Xxw\1771)\031sMs\250\243!\210~\214\271\255\022_!\271"
+	.ascii	"\335j\020d\025l7\032\013m\002\355&\243\020a\306\"[\261\275\310"
+	.ascii	"H\006\274\326B\263\311n\265\232M\226\022qk\202\353\\\353\325"
+	.ascii	"\"\375\035N\211\204D\305:\204F\254w\210\366\253\021\350v\244"
+	.ascii	"\375T\262g\247\355\301\203\003uS\302\3454k5\332.c\253\005\374"
+	.ascii	"\364p-4\364\207\366^\330\301-\355\f\030\005''\346\226\347\201"
+	.ascii	"\340\212\237O\270IYDQ(\214\315\006\351/\221A\203\0026M\363o\214"
+	.ascii	"Uzq\200\202\022[\250QT\305\224bTa\244\250 )\f\007\360\002\021"
+	.ascii	"!\243\007\021`\301sR\n'm\007\002\256\33745\027i\263\362E\016"
+	.ascii	"\244v\b\244L\205\326\214\203d\325\362R\200\022\320\034AZo\363"
+	.ascii	"p\236V\r\231U\355J1\003{\271\260t\036%66\262\036\221\306M$\216"
+	.ascii	"\227 b^c\335\f\201\017#:\240\364\311_\365\371h\300\322\313n/"
+	.ascii	"\306\336s\266e\203l4\306b\377\230\273\273,\3149\"ERg \223\316"
+	.ascii	"\204lY\226\241\236\232R\327\021l\nV\241e8\364\374kH\237`\t\005"
+	.ascii	"\017\360\216W\f\252\213R\037\032.\236G9j"
+	.text
+	.section	.gnu.lto_checkHoTTTelemetryState.82.e4b4115b993e80d2,"e",@progbits
+	.string	"(\265/\375`$\001\215\r"
+	.string	"f\230ZD \255&\035\320\322\f\257\342\304|\202\002C\n\253\350\225\211\245\315\"\214\324\026\013\253R\0061Ob\215\265m\275\205\256\242\227\r\033#e\254\037]r"
+	.string	"\300x$q\032\223\314$\203"
+	.string	"\360\251\tm\311&R\246\024G"
+	.string	"D"
+	.string	"F"
+	.string	"*\373aY\201\360R\263\273\231Vx\351\030\2744K\276\351\230\005\312!\206\207\362\313\3439\270@\273\333\361R\251\327\006\214\367\301\343\241."
+	.string	"\032f0\234\365\214\340=\310\344p\354\256\263\363&\334\234\333>`{\200\375\006\001yc\177\250\324\024\373\327*\005\373\253\033j:3\375\213O\211\226\214\013\213\0055\361\255\311\315\212\215\201!.|\365\333?\313\035o\b(}U\0022}k\302\221\351R\254jv\277\214CgX\034\272d\317\374\013\030\324\277\320\264P\244\322FO@H\240QM\321\216\326\211T\332\330o\335\205\344\003\004\004;L\375\211j\304E^\355\215A\276\203\nJ\251\311>\207\177\"\376\212GH\371\356\320'a\207\327\263\0163\250D\264\250N\001q$\244\031@\020C\035\232\210@\001R\024}\354\241\301q\233\202\214d\304\305\220\030\212\\&\372\320B2\217\221H\246\021\300\333\2028\312\270m\033e\235\357t\216\223\2420M[\240'\355\230 \337\371\036H\250\210A\251\3510*\0356\\/\t\034"
+	.string	"\306IEfh0\262\267"
+	.string	"W\004\312\232}\240\030PW"
+	.string	"\303\212\272"
+	.ascii	"\032\206\3325\350\372z\020\306#0\230P `\2542\332\255\006t\r'"
+	.ascii	"\304D\221\352r\300:\340\362\273\231\307WC\252:\335k\013\024"
+	.text
+	.section	.gnu.lto_handleHoTTTelemetry.83.e4b4115b993e80d2,"e",@progbits
+	.string	"(\265/\375`\361\002\235\026"
+	.string	"\346\347\222M\220\326U:\300h\bg\305l\374\266)\300\002X\333\321\311&\213B&\031\307\021@\013\270\b`\204g\250\273\235N\264\336^75l:\377\264\261\036\b\200\003\343\236\340\004N\263\304\214\200\210#!\203\b\220sKl\177K\b\331d\357$\003|"
+	.string	"u"
+	.string	"\202"
+	.ascii	"\347\261\371\001\347q\373\272\257\216d\221e0\230v\222[9\347\331"
+	.ascii	"]q\337])zb\363Z_\377\245\376\356:\260\370\324d@\364\301\351T"
+	.ascii	"C\242\t\253\301$\306\327\263\f\r\213\026%\3613E\3259\272\005"
+	.ascii	"\241\356X<\342\246\331\202\365\244\225\242z0UzZ\baj\216\275f"
+	.ascii	"\2131\312\007\246\006M\025\245\212#_\317B5,Z\213\276\344\234"
+	.ascii	"\333\n\325\020\357\327\273\333\330\335\r\272/\200\367\353\315"
+	.ascii	"!\242U\023\"\320.\273\221A{\203\272\177\227\313\345\262/P7\266"
+	.ascii	"\035Cm\277P\333\351\213~\364\264}\261\355\007@Y\233\324\363X"
+	.ascii	"\345\334\263|\222\247\260\016\027}\032_\262A\002e\223\364\344"
+	.ascii	"\315\221-\273\"\336t\337\350G8G\366\002b\226\214\2343\354\270"
+	.ascii	"\033\247\033v|a\335}\333\375\031?\372^\324\241]9\247`\312\221"
+	.ascii	"3RA'H\217\013\\%G\360S\3122\036M\310\200\320\240\376c\002\005"
+	.ascii	"\032\315\302\005\002ZS\002\354\225\336\243\226\346\f\334q\036"
+	.ascii	"\030\372B\307\235\241V;\223\266\233\275\260\237<\315\307\260"
+	.ascii	"\tV\316\375u\022#\251*\363\0065J\211\3652gj\211<DJ%B\244^\027"
+	.ascii	"\275\351\275\316\213\340o\034\207\314\f\r\315y\374\272_\372\201"
+	.ascii	"\237\244!\306\243}Z\242Dq\273w\376\306 \031\311\261N\272o\343"
+	.ascii	"L\275\276P\343r\366\302\334y\374;\332\r7S\201Ws\323\351z\266"
+	.ascii	"X\333\\x\274\234\206\331\215\216w\303\3356\334x\263\232\231\032"
+	.ascii	"nf\323\355f.+\235\343p\323\315x\271\234n\006C\002\177\201^\200"
+	.ascii	"7h\346\234\263\213\305\267:\260\027\266y\177>DDT\245\273\363"
+	.ascii	"\336\030\244\"\312S\355\036\300\330\013a\316\343{eZEt\305\242"
+	.ascii	"\267\033B\004\273\376<J'\036$xt:oP\323cR=\t\271\330\375\321\r"
+	.ascii	"\250I[?\030\275Q_\003? \300\002\021\271\353\262\002\326\307\320"
+	.ascii	"\rq\365v\305\002=\264b|\210iBC\013\016yU\312\0316\024q\206\303"
+	.ascii	"0~2\206\341z\355\001HcR\215X\031\222\270)\032\3036$?pf\233\226"
+	.ascii	"\r\347\021\223\030(I60;\242\245\227\335\375\313+\026\271\257"
+	.ascii	"va\210\256\252\360\210\t\371\331\300!V\2549;\035\357\020\002"
+	.ascii	"J\030\351\002\354\026\202\206\036dH4\342se\364F\212x4r\251\334"
+	.ascii	"\3536bq\013\021\005"
+	.text
+	.section	.gnu.lto_hottPrepareGPSResponse.part.0.116.e4b4115b993e80d2,"e",@progbits
+	.string	"(\265/\375`\202\004\325\031"
+	.string	"v\357\240H\260\230M:1\366p{ \026\026\351\003\377_\371\261\024\266\230\310\245\006u\246`\247u(\027X^\245^\343g\024\213CE\345\304\360\301>\340\007\313\305\302\370\375\340R\222.\025\337I\334d1\242\247\2735Bh7)S\n\210"
+	.string	"}"
+	.string	"\220"
+	.ascii	"8M<n<n9&\026\021\302\313\245\241\367\202\\C\304\233:\235\257"
+	.ascii	"\343;\306\367\202\302\031\025\222\310\311\2602'\257\300\245\023"
+	.ascii	"\204\2271\352\262\352yCW\022\002\300\233'tV\265\217\343I\343"
+	.ascii	"\225\204\036\233\323\005\222\2509y\006.] \2744\357\263\3572\274"
+	.ascii	"\354\273\264o\303\366\220\316\243M\345\274\030\363\275\251\\"
+	.ascii	"o\313\234\223v\2710>~u5\372#\276-\023(\2562_\201\013\346\234"
+	.ascii	"\016S\334\362\266\017\330\306`\257\246\002sN\004P\217\342\361"
+	.ascii	"\217.\355\241Got\351\367|\227\337?]\203,\355\222\210\264J\367"
+	.ascii	"\205w\365\325\\\0276\250\246\t\3253P=\363\251e\240Z\346Kw\354"
+	.ascii	"Mw\f\250\206\371\3240P\375\362"
+	.string	"\251_\240\332\365\251[\240\232u\247;\224jP\252?\251\226\237zu\336\277R\255R\375\032\231\315\2159KTu\231-$\220\031w\372\233\376\245\257}\3739\206|\246\367\370\223]N>|\224\bK\376Z\330~\305\016\312\313\332\020\016\345\265/w\362'7\377\310\022n\364F7\337\345kYA\236\270\250p\255=\341LZ\353\n\303mA\341\250XkW\270\022\234\231T\022\021\026\374#\241\357\362FWX\373\023;\246\rW\237\200R\337\202\373e\301!\r\270\207|r\277\375z8\032EZ\345\325\312}\216\352\302\215\334\302\"\253e\325`\342\"\323\257\356\256\235A\203\336\3105\270\035a{\303\211\f\331\261\021\242\313\262s\016DGm\361?v\024H\005\034D\361\247&sB\221C\b\033\217\355\003\203\332\017\214\270\223S\253\21178\024\036\300\254cc\263\371t\240\005\001\331\304\036\361\203h\243\201\340\311\351\241\351"
+	.ascii	"\325h6\001\354\363#\002\321l>>@4\327\027\020m\221w\367\205m\232"
+	.ascii	"\265\307\335\265\314\226\006\313\263\2146F\034\243\322\250\364"
+	.ascii	"]\316\226\245\343\310N\305\314\332\f~E\2663\261\225i\221Y\273"
+	.ascii	"\301\255\304Vf\257C\252\222\243Z,\017\372b6\266\030\220\224\340"
+	.ascii	"X\0249\370\324\215\300\224\035\001Rbv\233@\355\222`\326~\360"
+	.ascii	"(\260\205yV\250q,c\rC\216\310\320\204Qf\232\306\260\002\231\242"
+	.ascii	"\333\034\021\220)\204j\2644\345\363\244C\300\256u\317G\020(\214"
+	.ascii	"2\313!\001s\350\252(\003\321\365\207B{dZO\2535B\277gQ\213\336"
+	.ascii	"\334\376#\202o\034\203\272\266\264\034\353\364g02<\377\373\323"
+	.ascii	"H\272+\232\031\330\337`v\320=_\366\222\312u;\263\334\216X\362"
+	.ascii	"4\033\0133\201\002\264q\267\256\025\350\0136$\220\2154~!\"\343"
+	.ascii	"\305ii\332C\233&\211\370\325[\327z\236\26475\337[\373\370\362"
+	.ascii	"\340M\213\314E \314T @T\212@u\316C\273\311Fwi\201\"\333m\324"
+	.ascii	"\207t4"
+	.text
+	.section	.gnu.lto_configureHoTTTelemetryPort.part.0.117.e4b4115b993e80d2,"e",@progbits
+	.string	"(\265/\375`\007\001m\f"
+	.string	"\246\026RA0O\224\016\204\202nQ\232\272\020'D5\320\030\206F\330\201\177\220\031\230\2522\231\372\342\367\335\253\375\206d\253C\222\274\266\325\337\006]\342d\301P\325\201\321\341_\332\027\270\345D\004\261d\223\275S\n:"
+	.string	"@"
+	.string	"E"
+	.string	"\236`\227\222\023\270.\255\017\270.\357\301vw\262g\257x\315\330{|\2248\276\335\235\227q\303\275Ghy~\350\021"
+	.string	"\252\302\241\200[\221\312\356\032\263p\313\333N`\273\201\375-\244:1\307I|\354)P3(,(\241H\361\355\326y\351\212A\373\376\\\204\343\205\026\331}\215\316\337pV\273\253@\226\220\352\242N\257\316.\r\342!\274\253@X\350\204u\200\200\254v\353\3442\360\246K\237^\227\021\r#>\026\"\030\342\b\264;\020\340M\376\306\031\250V.V\243\030\202\021\303\321\272\265\273\353\230\262-\004\246"
+	.string	"\030v'\204\274\330\f\362D\207k\274DgOe$!\202e\342C\305\207o\003\276P\016t6\024\303q\024p\033\345d\266P8\216^\346g\3434\215\366@\343\346\006\343@3-[gR\f\230r\264mr\224n3\263\r\037S\256\210\342\3101F\214g.\277\343\036\031\237\20354\033"
+	.ascii	"V\025@\231\372\020\347\f\374\0320f \035\002\004D\301\260\\\""
+	.ascii	"\377\f\201\347B\002\233\200&\336\220\3040\341J\005;\352\016\322"
+	.ascii	"YS\210m\247\356\351\264e3o\247\005\340\332\003n\264\210~W\031"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_checkHoTTTelemetryState.part.0.119.e4b4115b993e80d2,"e",@progbits
+	.string	"(\265/\375`\003\001\205\f"
+	.string	"V\026Q@ M5\035\004R\370.0\354\002\022\307c Ug \277"
+	.string	"\253\340|m\347\037\031S\341h\013\033Mgn\263\333\234yL\314\324\223\216\032@rF!\366\244e\202\005\322~\240\365\020\321&{\247\024<"
+	.string	"="
+	.string	">"
+	.string	"\325\222\307\3531\330&\241\034\332$>VX\310\005\213\b\030\345\356n\257\264\342\341\351\304B\177\212\251\322\351\311\013\320 3<\244$|\0068\346\260\354\256\037\023\356z\333\025\333\005\354;\b\256\335\323\306\211e\325\020\026~\361\333\3677\234\2645\213\256\301\234JD\271\273\232\310\367/H\376h\315\346(\244\277FF=\203\265Ws\224\360\257Q\2444\356\311\221!\232p\225\273\243\344\001\025\254\225\313\017e\035\350\210\022\245\006\200y\352\223^\203y\321\021\b\264d\037\343\034B\276\205?\240y\361\325\007e\257\247'?\200B\271z\251LscR\nS\354\330\322\226\215M?\233*.\035\210sA\240\240\343$\270x\f\034\bu\036\2101\023\020\364\026l\242\017\354:\035\247\0037\217\346\322\3310\337g\233\020\260\307\240\3736\320\363\276m\036[\332\262\305D\037PJ\341L\346\1778\210\214f\263\311^+\001\036"
+	.ascii	"\305\241\202@\221\035i`\374\352\205\021)\233\340\0200\025\362"
+	.ascii	"\004\325\004\326\373\024\353\333\312B@\024\fs\205\233\247\211"
+	.ascii	"\355T4\250\202\366\214%\352r\322\261H\b\303P\341t\206\262\231"
+	.ascii	"\267\323\002p\355!\205\205fKO(c"
+	.text
+	.section	.gnu.lto_handleHoTTTelemetry.part.0.120.e4b4115b993e80d2,"e",@progbits
+	.string	"(\265/\375`1\002\255\022"
+	.string	"6bzH\340\360&\035\302\312\2357\200\210C\332\217l\363"
+	.string	"\257h\036\317\371\"\346\013H\365\203\021*`\210\3061\3644\323\272\357\255\207\027k\002\267\362\t\306F\f\365!\2069\026\200\222E<\031\361m\310E\316\313\370\232\020B\244L)e"
+	.string	"f"
+	.string	"b"
+	.ascii	"\367F\036\362\335\353.\340\273g\277\204m\230\215c\366\322K\235"
+	.ascii	")\002b\210B\020n\316\031\336\333\016\217\375\363\272U0\346\177"
+	.ascii	"\330d\377\324\003qjD4\333\205w\035\211\006$\013"
+	.string	"!1pf\240l1\272]Hm\207\006b\223\351Hj\0245\035\350Jc\233\251\0068\b\246\3149\335\201\341\356\270\355\026\333\bl\225\005W\341\023\024\230W#\262R\247\366[\315Q\017n\306\224%\266}\202\342\362\352\245N\355Ci&\251\0077g\031\336\363S|\250E\343\250\205\342B/\277Yd\211|\361O<\310\365\233OH\246\021sN\327\372@0\033\205\262\352K\330\177^]9m6V\265o\342>\261\377\274\3541\347\315\320\2129\313\003\367\\\322\021\333\355'\360\3144g\237\305[\274VXX\276{\272\022\310'\022\352B\246\306\263\233c{\365}\035\334d\304(\016\373E7Z\371\036\234R\351i\252\357\336\367@\357B\2207\234H\030\315\351\346x\301o.\227\313y9\330\240\272{\371/\250\326O}\017%\023 \315Y\313=\315\r\236\321\007\242V\005\234\003+\006bje\001\313E\034\307\226\n"
+	.ascii	"\253\230\260X*\b\241kd\211)\261Ed\205.+\rR\241\312\270\nM\bX"
+	.ascii	"\025A\034C\226J5\206\250\247\300\354\314\373n\3169\277\335\027"
+	.ascii	"\n\310\034N\031@\324\026\037\350i6\240\344\2244[\231\367K\263"
+	.ascii	"cc\306+P\343\323#4\367\306{3\025\3254u\233\343\001\"\376\372"
+	.ascii	"\272\035o0t70 \320\002\221\243\323\001\021\n\200yN@\021\234\214"
+	.ascii	"\357\035\322b/\374\274mX\251\357\333;op\265 \256\027\304\275"
+	.ascii	"\255\275\003\200\313zO\241\230[\301\222\341\376\241\025C\024"
+	.ascii	"\203\215M\033k[D8G`\r\272>-0_76K<s\342\300t\266\317\254\013\f"
+	.ascii	"\316+\226\035\224\227^m\032\026\036B\376\324\005\315\275v\215"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.e4b4115b993e80d2,"e",@progbits
+	.string	"(\265/\375`1\006\035\030"
+	.string	"v\344\211J\240\024R:\200\370\365\r\336Pm\377\240\264\247-\244\247\217\373\375\007\034\302\017\215\225\370N\2333\357\210\313\225\277\220\034/\307\313\361\204\243y\207\346\035\232\327\272\017e\275<\226\345Uy\373\303\205t|\tV)\253\325\344d\310-Sq"
+	.string	"r"
+	.string	"w"
+	.ascii	"g\332\201>\225Z\324\237B\224#\223\036\217\310\241\276Y\025z\223"
+	.ascii	"\240\276\220\nd\340\374\371\022\237>\025\361\346\344\264\264"
+	.ascii	"\264*=\375\251:\264\341\351/\253O\322Y\331N\037H\025\342\234"
+	.ascii	"A\337\251\003\314\351GU\340\357\327WV\001A\027!N\017\353M\003"
+	.ascii	"\311\330\034\311\311\377\"S_\357\374_K\217\307\324\351\357\237"
+	.ascii	"\n\306\256\244i\232\366\372\247\376G\177\001(\372_\306>\363D"
+	.ascii	"?\211\211>W\211\376\026\211~\327\210\276\023\021}&!\372a \372"
+	.ascii	"b\037\372`\036\372^\035\372M\016}%\033\372E4\364\215l\232\246"
+	.ascii	"?\201\f\375#\213\241\236Oq!\300i\201W\241\217U)\364\257&\364"
+	.ascii	"\203H\3209#\364\223\020\372"
+	.string	"P\365A\027U\007\317:\0334\26128\221\005\327*~\210\202\276\224zL\237\022t\017\202\223\005WX^K\234\216\215{\261*\037G,:\306%\367\367\204\305\242%\307\266\246\rio\365\243\211i\230\343M\356\321\232\220;n9\236\034\033\355*e)i\365\2640z\274\341p8\236\033\027\227\227[+b\foVf_G;,\274\314\255K.j|\241,\214\"\203(\027\205(\257Rg\205Q\346\221\213\314a\2565\177\347\032\322n\322YY\025\360L\003<\033\365\307\002G\223[g\200\311\b\203\361q\215\271\333\245\242\307Tn\306\007\005\212+l\347\343e:\275\364V*)\212\007\257\307E\242\236\r)&+\027\036os\031G\016%Y\220\307{c\245\206\215\204j\206j\270(\244a\\\323g\3076\345\317\216kM\240]\320\216\215\274\343Zrk\314\f\033\007\304\360\213\245(-t0\302\027.\200sa"
+	.ascii	"\315]-\264\345\030Q\3076\345\376I\027\r\035D]p\250a\020I\242"
+	.ascii	"J\024\246\240\244\264\320\030\260\002)9\253\003\021\200\030\022"
+	.ascii	"93\021I$\321\210\324\003\031p\317h3em_\253\246\300\025w\342u"
+	.ascii	"%\275\021\335\330N\272\326\022\317\252\205\017\321\004\267\307"
+	.ascii	"\001\367\376\341\r\3256u\225\037\367s\210+\276\362\220\211@\250"
+	.ascii	"\222\325W`\346R\345\bk\370!\214\254\335\306+-\366\227Ra\226\340"
+	.ascii	"\262l\312a\2624\317`R\340?\323+\322\210\2014av1\322QPp\3050E"
+	.ascii	"x\030\222*\365\260\021\244b\310\234\355\270.,8Qj\376\313\021"
+	.ascii	"\362\300`\340\017\234=\265\004fHC\024=\003\233\303|\b\355\305"
+	.ascii	"|\276\206<\233\2423{\321\304\362`\351\372\020\022\205\246\347"
+	.ascii	"\243\223\2126\312\251\343h\276\240[\344]/\2024|\324\255\254\n"
+	.text
+	.section	.gnu.lto_.refs.e4b4115b993e80d2,"e",@progbits
+	.string	"(\265/\375`\237"
+	.string	"\375\007"
+	.string	"V\0244#`g\233\0160\f\3030\f\3030\f\003\340\314\340\324\350\250\320\237\260\370\210\217\327\016l\"\266\337M\310\226)&"
+	.string	"*"
+	.string	"+"
+	.string	"\354Dm\310\276\360\021~s$\315VOV\317\325\221\325\327\302\225\352Iu\244:\252^\205\211\315\332\023>\366\321w!Kw\211oKg\211\236\313#K\021\311\006\245;\205\273\367\251\340\310\353\252\r\220\267\326\331;\250Q\032\360\346:k=\363W~\003\317\215u:\0359\001\350\324t\224\f46]\364'\277\301t\207y\306\353\013\327\025\356\227\367\n\323\017\314;\227\224o[\361F\344\277\357\336'\217\245p\364\3706+ \243\346\3538\001\317\354\b\021\320\311\321\221\365"
+	.string	"\r\320\250\200"
+	.string	"w\006>\361\374A\340\323\363\370|\003\020"
+	.ascii	"\020\204\003;\256oW\032\002\353\365\264W\241\034\267\370^Q\343"
+	.ascii	"\200Y\366\210\371\020\021c\021\342w\r\242\fA\030\352\236\271"
+	.ascii	".\025\005"
+	.text
+	.section	.gnu.lto_.decls.e4b4115b993e80d2,"e",@progbits
+	.ascii	"(\265/\375`uO\305@\001:\026jtR JQ+\215\001T4\310Bs\305\177XO"
+	.ascii	"S\001G\265\251\021\022\330\321\330\301y-\3366\036\227\342\243"
+	.ascii	"*\242\372\276\313\227\335T<\"i\372.\236\024\242M\333s\030\376"
+	.ascii	"\263\302vA\337\347\2371\3445\212\f&X\006EH0h\026\f\344\330[J"
+	.ascii	")S(\006G\007{\007O'rN;\227\343\312>\255\002\317n\f#6\356\247"
+	.ascii	"\031\264\247\376\3128\367~\3329\260\036OD\247\331]\273tW\312"
+	.ascii	"\235r\337\356\223[\345~\271u7\314\345r\315\256\334\005s\373\356"
+	.ascii	"\335\315\273[\356\336\205r\371.\226\033\345\352\335\264\333v"
+	.ascii	"\361.\225kw\347.\334\265r\2377\313u\273Z\256\332e\273^n\334="
+	.ascii	"\273Wn\227+\306\302]\264[\366\313\3446\271}\356Me\344\354\322"
+	.ascii	"Bt\232]\264\273e\343~\232\317\235e\231lD\247\331\336\317\034"
+	.ascii	"7{V\326L ?\215\243o\237%J\r`\207\322\247h\364S1\372)\026\375"
+	.ascii	"TN?\205\242\237:\365\3230\375\024\207~JC?\225\241\237J\351\243"
+	.ascii	"\210\372h\032}\024P\037\005\243\217r\321G\357\364\321)\372h\233"
+	.ascii	">\212\246\217*\321G\303\364Q\032\372\250\224~N\243\237\315\350"
+	.ascii	"g?\375\254\247\237\353\364s\024\375\254\246_\346\210\376\240"
+	.ascii	"%J\237y\350g.\375\\\245\217\337\350\343A},F\037w\321\307Z\364"
+	.ascii	"1\025-\002\212>n\242/g\211\322c$\372u\226(\275\226+e\343d\"e"
+	.ascii	"\310\324\335l\347\362\002\235\031d\3713\"\263\367\333C[h\341"
+	.ascii	"X5\266\315mZ\303\273\255\033\313\306\276\261kl\242Mc\021-\234"
+	.ascii	"\215c\321\334\016Z\302\347\347\336TT\3168\305\374Fc\272h\341"
+	.ascii	"b\275\330>\271\022we\006\367~>\2033V\360\007\335\033\214\313"
+	.ascii	"\024<3kl6\316\366yy\200v8\250\366\033\3318\266\317\206\261}r"
+	.ascii	"%\f\275\f\206\370\355\034\026\300\247\0244k B\3308\326\317\306"
+	.ascii	"\375\340\275y\3609\367~\336\312\375v.\216\245\263w?xo)A\347\336"
+	.ascii	"\373\366\312ot\033\307\376YA\b\\\354\r\266\003\203\237\025\034"
+	.ascii	"[\207{o\013,\260\240\310\002\314E7C\311\004\371>-Q\312\341\214"
+	.ascii	"\376\345\323\026\320\006Z8\r\326\314m\031{\345\250\324s?\367"
+	.ascii	"\336@6\315\220\251\255\233\177\3634\007\366\266\032R\233\230"
+	.ascii	"h5\244\277n\372\332\241\364W\211\376\355\241\177k\350\017\226"
+	.ascii	"(\375b\301dB(H\254\342|\361\263]v\340L\335y\335|\313E[=\273g"
+	.ascii	"\341,\337o\267X\271\3476\260\375\266\367\323\007K\335\340\243"
+	.ascii	"\273\371\226C\n\224"
+	.string	"\230\230\230h9\244\267t:\333\241\364}\226(\275E\323\267b\372v\206\016\262D\351W\320\277\265\273\275\373m\025k\305\306Y`o\252\275w\006\f\304`u\335l\353\214n\355\206R-\257\347\226\333{\003\351\304D\274\261\233\177\354Pz\026\372\207\226(\005\262Ci\220\035Jo\202.\262D\351I\350\t,Qj\333\254\233\205\213\300F9\210\020\307\315\266\255\266\367\023\310'\316Y\03477\037\001\372\366\355\033\332v\210c\320\267\021\2446\321F\220\376\352\t\354P\312\301\022\245\277\205\022\001\320\363\006\326\217\233\177\373\344\267iV\215\003\256\272\002\333r{?\205|\332\370M\231\335\374\247%J\265\035J\377{\002V\2017\360\337\247\035@?\212\200.\237\037\365\360_\013L\254\201\037\257\260u\236\037\025\300o\257\376\233\301\353ok\374V\310\177\013\360\333\034\277\225\201\231\277\355\372-\216\373\341\277C\360\362\277\025\374\227"
+	.string	"\036\376{A\321\223\360Q\222\001\374h\361\27790\006n\0070\324\221KB\034N\300+\300\312\037?\375\230\305\177I<"
+	.string	"?z\200\023\260\n\034\200#v\372\357\r\fpN\223\362QN\300*\254\341\223\256\325\177a\240@\377U\0013\271\270p-\340\005l\324j"
+	.string	"\337\337\306a\025/\375x\305\217-\360?i\205\\\370\337\023\260\212-w\303\302\347j\241\024\374\367\004\254\202\b\003\223\214\322\302\005\245\337n\301'\\\235W\340\203'\360\242?\343\375\367\f\216\300o\001\377G\271\233\377j\340\374\327\202\315\263\206\177\340\317R.\"6\341\277q0\004,\033k\370\236?\207\371\357\tX\305\177E\300I?.B\372/\013,\301\177G\224\360\337\003\374\327\347\026~4\003\227+\r&\341\277M\206\337\371Q\024~k\201\337>\300\256\260I\277\215\200\225\300o9\260\305\337\222\360\343\235\024\377%\001\177p\bF\370\361\211\0377\340\307G?6\361c\020~L\342\267L\027\300\2172\377K\002\376\340\267 \374v\002\2775\361[\343\035\036A"
+	.ascii	"\t\344%\277\r\341\267H\377\243L\301\f\370_\370\343\005\374\027"
+	.ascii	"\004\254\200\337\306\341\004\374\227\016{\360?\351\025\374\030"
+	.ascii	"\001?\356\340\267L\327\360g \377=\2029\370\255\330\177\235X+"
+	.ascii	"\020&\360\006\032\036\364\243\025\370\255\217\337\216\3756\354"
+	.ascii	"\267X\277E\362\333!\277\335\361[%\277-\362["
+	.string	"\257\377Q\016\301\t\360\343\f\376\237\360?\351\307 ~\013\345jx\206\037E\372\355\326og\374\226\307o\313\256\007V\001\277\025\361\333\n\374VI\314oU\313\204;\374\030\203\037s8\321\237\317~,\200\037\003\340\307\032~,\364c\240\037\373\374\230\347\307\372\307\370\277\211\377u\363\337\302\377\252\371/\232\377\216\371/\336\177\353\376K\345\277p\377u\373/\333\177u\374\367\306\177\265\376\273\366\337'\377M\373\357\331\177\235\374\027\311\177\231\374w\311\177\311\376\233\344\277c\377\005\373\357\216\377v\375\227\353\277[\377\305\372/\214\377\272\370\357\324\177\367\1775\360\337\025\376\333\342\277\314\377b\340\277\312\377>\375\227\305\177\217\377m\372\357\322\177)\360_\t\374\327\204\377\252\370o\t\377\025\341\277\231\337B\371\257\211\377Z\370m\342\177{~[\370\337\242\337\252\377\005\341\277$~\033\367[\267\377\216\370\355\226\377*\340\277\036\3747"
+	.ascii	"\377\243\374\267\203\377\212\370/\007\377\335"
+	.string	"\340?\322\1775\374\227\350\277\030\376{\341\277>\377\005\372\357\317o\r\177\313\346\267N~\333\364[\246\337\332\377O\376\253\375W\377\353\375\317\220\230\230\230\370\353\314\375@d\377\006e\002\027\232\241\377\333\337?\335RZ{o\032\350skM\365\244\277\275E\255\345\360\373Xl\003\360?\357\375\037\377\r\b\341\271\251\350\326\354\275\355\032\275\204N*\307\004\033\355\333\233*\254\311\200\260-\252\260\256\252\267\260-\241\252\267\260\335\244B\322\024\322\332a\315\252\267\275\205\250\250\232%\300\266\252\336\244\266P\325\333\336\332.\300l\331\375\fkn*\260-\264\251\266\324~\003\333\232\240\212*l\253\352MjK\250\352-lk\277\205\355\240M%\245\025\203jk\t\355\2670\302\375\006\266\025T\365\006\266U\365\026&\305\362\311\020\262W\303\312\232\261\035v\253\212j\317\300\322!\245\025\324W\365\004\333e\366\266r/\266\326\356\333;"
+	.string	"{\353"
+	.ascii	"\323*#\325e\353\246\372fL\315I\201\331\347\336[\003\326\224\030"
+	.ascii	"\330\246\352k\332\335WU\006\266w\331\224\323\306\332{o\r\232"
+	.ascii	"\317\276=f\373\232?t\354\253\027{o\330\317\275\261\366n\332\335"
+	.ascii	"\267\367n\356\275s\264t<\367\306\021T\345\304\302\332\333\253"
+	.ascii	"\bk\353h\332\275\330\373\312\001\326mU\275\211\201\031\331Ey"
+	.ascii	"sn\030\317\246\255\272\002\333\316]&LK\2775\331\366"
+	.ascii	"\325\336\333\252\321\316-\25647\243e)\251\2301;\300\233\037\244"
+	.ascii	"\247\343r\350\376\302<\271\371ARt\206\263Rm\216\304\335\374 "
+	.ascii	"'\331\r\250G\352\206\225/H2\333\217\241Ua\226\233\037\364\245"
+	.ascii	"\237P\240\\\277\243\240\275\305\3148\203d\350?\253\335\302e\265"
+	.ascii	"\374\245S\2657\r\017\236\220%\242\035n-\255\013\016\324%\r\315"
+	.ascii	"\215\013\232\324\315\031\355LC\216\023\273\036A\314*\320TxT\324"
+	.ascii	"\234\344\262)\\\372\306n~\006;\324z\240\r\356\375\\\222\225\344"
+	.ascii	"&\231,3\311N\013\227\313\362\221g$9IY\316\001eP\007^\373\221"
+	.ascii	"\n\332TSO\3122\217\264\\\226\301\262\021\314\246\325\2000g\203"
+	.ascii	"Y\013\342N\373\311\366i\211\322\";\224\036hN\027QR\302\306\355"
+	.ascii	"\346\003A\321\267jc9\310\221\301L$\013\311C,\\\036\313@2\370"
+	.ascii	"\221\305\2128\307\262\217,f\373\344\266\324\226\006L\330\334"
+	.ascii	"()\262\300\202\235#=z\220\321\371@@\364\201\272\364\201\270\236"
+	.ascii	"\227\303\306\2624\307n>\220\225>\020\f}\240)\375\037C\375\037"
+	.ascii	"@\375\037>\375\037-\372?v\372\3178\276\360\226>\267\255\233\263"
+	.ascii	"\327\r\343f'\346\346\377\264\351?w\335@\337\270\254\351r\303"
+	.ascii	"\306\3350|WS6\270r\322\260\210\311\335\234\271n\246\221k<s\345"
+	.ascii	"\255\203\b\361\036\252\314\225\367\226\262\226\202\037k)@\363"
+	.ascii	"\216H\271\245\371?j\372\317Z8N\316\333\022$\314\232\321\023\205"
+	.ascii	"O\b\337\315\177\236\221\261p\244\331\301v\363U\272Ek\220\314"
+	.ascii	"\315\377\031\323\377s\214\\\225_d\027YF\206a\341\262U\226z\236"
+	.ascii	"\262Z\236\345\262\025\326\313\033\263ii\272)/\203S\231*\320I"
+	.ascii	"\325\306\306\341\2473'N\f0[\345&^\303\317:\r\303\255\313 b\230"
+	.ascii	"\277l\2055x\322Lsw\270\367\263\b\310\217\215\334\226\237|\237"
+	.ascii	"6\272\307\016\245\367\361\323\367\331\202\023\355[\334\230\233"
+	.ascii	"\233\357\323\246\361\033\f\307\302\3418\337><@\352\344\244nN"
+	.ascii	"a\357\275\355\363\322\234\347\245\367q\352"
+	.string	"\373\360\320\367\201\241\177|\310\346Go\314\354\213\215\241\003\310\300\340\273\271p\001zJ\316\334\374\036D]Wu\206\206\337D\274\320\322\311r\363\032\224\233r\345\224\202\345\304pQ\260\334\017U\320\246\022\233\341\224\273\203C\027\003\017c\261}r%\260\270\231\263\303r\266O\256\204Z\342\240\032\376\303zm\214\366p\037\004SU\"x\241\031,\203\325\340AL\210\323`2\330\017\237\301k\260\031\214\006\013\34218\020\003Z8\374\207\277\034\203\301a^\204\317\304\\P\304\013-\235\027a\2760\034\025,\207\331\264t\234\233\325\340\037\236\303VD\274\320\322\261\n#C\013\376\303Y0\227\037\252\347\336\332\311\362\341\207x\270\367\263\307/-O\306\004\371=V4\272-Q\372:;\224\276\207M\377\270\317\213\034\233\031\300gVB\206.\311\315\377-\034\356\202\371\236\273(\205\022f\b\227\233\337\343\324\357\031\323\357\341\201\267"
+	.string	"\261\301Z\343w\363{\270\260\226\0318\257\247\214F\026\222\233\337\263\361\025\236C}\0364\372<`\364y\362\364y\346\364\217\255\274\n\352L\322&xs\037PO\234\2640>n>\217\233>O\023}\2361}\036\035\232\003\216\323\241z\002\351\370\251\331!w\363y\270\364y^\350\017v(\305n.\360\360\206\334\374\035A}\013\207\333\330\300<\331Qn\376\361\363\230\355\007\021\342gz\366V\333{C"
+	.string	"t\304\312\227\0377\3434\274\226he/\357f\254\206\237X\270\n0\224'\320-\002G\212\333\315\337\021\243o+Hqb\242\255 }\341\005\377\353\360d!\"\326\345\346\357l\321\177b3\\#\325\001\203\016\311\315\277/"
+	.ascii	"\2658\t\263\364-9\253S\243\206\247\022\327\316Lq\"\t<#FPp\016"
+	.ascii	"o+\\\025\330\346i\306\n\025\325Z\037\331\331 \034\301\031\270"
+	.ascii	"\031c\355K\307\363o\2133K\260\307\032\264\303#\3168X\316\271"
+	.ascii	"\373F0k\312\240\340\032V\036X\2143-R\202U7\211\2319D\034N#\f"
+	.ascii	"#\020Q\016\215\240\024\354\"\020\216\032~\341\306\231\346\311"
+	.ascii	"\f\301!^;\234\230\006\026\202\235\340-|\004;\261\022\214\003"
+	.ascii	"\373\300Mp\027.\303@\260\026\346\302X\370\007\276\302`\370\006"
+	.ascii	"\016\202m\340!X\007\266\302a\230\b\026\3033p\022<\206y\340%\330"
+	.ascii	"\b\376\302^8\007F\202\311\360\016\234\205\213\340\036\230\211"
+	.ascii	"\205\3035\260\214k\303P\320\314\t\237S-P\220\256P\360l\21230"
+	.ascii	"Q\360\212\215`\2226\202F\346p\215\353f7\t1\300\323Bt\036\356"
+	.ascii	"\375,\372\241\332\"\303j\002\371;S\364w\324\364w\212\350\357"
+	.ascii	"\364\320\337\341\322\337\271\322\337\331\372:k\364u\310\350\353"
+	.ascii	"p\321\327\301\323\327\211\323\327I\323\327A\242\257\343C_gK_"
+	.ascii	"\247\251\257\325\350k?}\235E_\317\351k6}\275D_\017\321\327;\364"
+	.ascii	"5\r}\355B?\307P?\207\214~\016\237~\316\235~N\234~\216"
+	.string	"\232~N\231\376o\031\264\030H\376\366n\376/\231\353\247\317\302\260\310\335<\246\210\247\260+\215\306\315\317\001\242\237\301o\264d\013\314>\263\212p\325\330\201\205\304\306\r'\242\323\f\311W\b%ND\247\331\234\016\031s8\260z\304q>\265\002\307\276\262\234E\376\376\214\306\376\002\347v\004\306\360\332\210N3#\262\255'\242\323,\354\017\321\316u\341\370q\370\234\021h\344R\271Xs\n\021t>\257\002\315\214\200\240q\316\211\375\265yV\005\252\275\200\001\305\312o\347h,\351Ct\232%\001Ct\232\315\361\370K\264\361\033\005\371;##\355\305oD\344\017\360\212\217?7G\274\030\r\3713c\003`Ad\334\374T\313\312*\002\266\226\243\374\360\275\341\325A\221\223r\246\317*}\202\326\351\3211q\362\264};\270\354\335\234\236\245g)\232\335Z\037\330\260\245h\\dK\304\256n~\004S\372O\315\220\360\330"
+	.string	"\334z\222\312\025f\r\236\2719-\303\035HLLL|\263\267TZv\323&)\223\247e\267\226\002k)"
+	.ascii	"\312)cV%\225\346\324\231\222Y\270\242T\t\230\251\031:n>\004o"
+	.ascii	"t\007\266-J\237h\213\322?M\202\216\351[K\034\2739%\222\022I\217"
+	.ascii	"d9\215<=r\001\301*\267\233\323\"\250\220\236<\2732d\310\244@"
+	.ascii	"\200\244C\354\326\332\373K*\344\351\0207\034G"
+	.string	"\222\334\234\006\311u\370\352\320\256\357\020\334\371\360\221\212Y1/\034f\366\313\320\254-\354\251\330\231\r0dS.\030\"oqKr\344H{|\260\033\006\025 8\006}\210\330@\002C\307\323\036)\0176Vv~<v\344\2759\2531@\342lA\303#\345J\271\322/<\2734w\013p\"\006\316\353\351W\236\242\343\206\234\221\2719\255\221v-\031\004B\327\225\336\350\343r#\354J\203\034\227\255\324F\226z@\260\252Jn\253\362%J\225\233\017A\214\255\255\324\312\006=\247\302$\331\200\223\256/p\262\2628\340*\262g\246\263\006\246\026\204\020\013+\265:\246\332<\376\234{{q\320`\322\262\324\335\374\007\366R\031\251\214\324\352\210X\332\233C\236\276\037i\236\244VY,u\001e\310\331\315\177\300H\352\"u\221V\025=!\363Cd\363\205\254.\205\361\264j\314\341\233\0307\247/2\230\"W\272\226<"
+	.ascii	"\2266\323f:e\333v\326\2055)7"
+	.string	"X\320b\370\365\270\371O\245\236Ne.\237B\270>(^p\340\240\211bh\f\263\312\272\342\034M\264q5\266\264\005y"
+	.ascii	"\213\r\033\324\315\007\273aDq33\250\203\345\203\r\007\342Q7X"
+	.ascii	"\256\007H\030#bmz\236\315}\006m\203\036\352\2441\023H\3653\225"
+	.ascii	"\303)\344\260\2600\213\261m;k\001[~\210f{{q@\307\246\234\325"
+	.ascii	"\335\374\r\200\204\204\250\232\"\275\237\300\255\r\332\021ID"
+	.ascii	"LsT\315N\220\034M\265\233_\250\323gh(w\3637p!C\006ES\004\326"
+	.ascii	"$\364 \357K\232;\f\305\020\257\013z\346(\232\f\206\310\331\025"
+	.ascii	"\223\233Q\301\274s\330\374\360\262\344f\324Ln\343\201\373ae\311"
+	.ascii	"\315h ~\033\003D\253\272\031\005\274`\246\372A\246w3\372\207"
+	.ascii	"\345\200\324x\334m\271\031-\203\271X7u~10\226(cc\240\334\374"
+	.ascii	"\rT\362\216n\311C\307`\277\236\335l\333Y9tzK\264\034\356*/\016"
+	.ascii	"<lVl_\372\216\2169*\006D\210\013j\263&~R7\243a\376\343\305w7"
+	.ascii	"x\363\321/(\230_gg\t\2207'7\177\203\021}\f\332nlm\335\214z\271"
+	.ascii	"e\202W\2047\243]\236\367_\247\307\213\314\241\020\276\377:\270"
+	.ascii	"\213X\230\251\233Q.\250\236\205\273\036\272\367'\320\317\035"
+	.ascii	"\f)"
+	.string	"z7\177\003\020}{\275\264\003\366z)\232\345\250\226_G\347\216\007\220\260\233\277a\207\376Q,\277N\316\024\277\034\316\233\277\301K\177\303\326\335\035\212g\333vV\b\256\"{f:;\246|\331\341\341\265\235\"l/|\334|\r\211U\252\240u\266mg\245qxI\274\262\020\304'\200ut:m\276\300\340\334\214ZY\002\022w\345\346k\320\323\327pE\307\305\241T\212\300\232i& \013Sd\357po/\0167\211\222+)7\243T\320)xn\370n\334\214J\341\321\273+K\274\371\032\204\240r\032\272\364\217\302\301a9\006\310m\251-\016Y\246\204\354\t\035\351sr\363\213\374\334\3342Wn>w\326\005\273\251 h\207[K\313\005FuZU7\277\350\214\215\2150L\377\350\332Z\236\"\342\311V\021\r\375\344I\336\323\333\356\340Y\023W\346\342\346\027m\235\226\226\367\376\366\234nj\3364\271\371\031"
+	.string	"\317\316\362\235\206\256&\017\227\257\355u\3633\340\351\037u\342\304\306\345f\333\316J\200\0227X\314\366\326r\001\032f\310\346l\b\023&Vp\nqpo\257\013r\234\0046qr\3633\324\320?\272\004\016]\202\327\354\256\263\273J\206X\233\301\275\265\\\240\317\274\305\225\271\371\031\232\372G\311n\341P\262,\307"
+	.ascii	"9\260\315\305\001o\313\215\022\255\003\261\n\233\233\217\001"
+	.ascii	"\261\b\232\244\b\212\304\310\215\240Hts\357f\320\236\032#\350"
+	.ascii	"\374YcfH\341\221\243H\250\004\211\300A\205`\021\362l\336|\fa"
+	.ascii	"\3641\300\351\2600tL\357\242,>\200\274H\221\301\030rt\f-\r\\"
+	.ascii	"\337\315\350\017T\210\336fM\216\240B\320 ;Sr\206m\262\027O\331"
+	.ascii	"T\223\035(\020,\203G\252M\335\337\315\250X\3263\315`\026\373"
+	.ascii	"+\363\001\343\346cX\242\177\264\007\272\003\005\313ov\323\330"
+	.ascii	"6F\031Y\225A\fB\3641|}\241;\276P\0358p\240:\322/\262D4\263\355"
+	.ascii	"\345\305AK\021\363\005\314\315?\232\343\250\216\037\265\274\301"
+	.ascii	"6o\377u\212yD\016o>\006\027\372D\2006\320.\033\350\r\364F\336"
+	.ascii	"\263[\3130\265\301F\302\031\034\316\233Ot\247O\264\004\345B\271"
+	.ascii	"\2364\023\321\016\211xd\241[Yy/\335\333>\301\262\264\266\227"
+	.ascii	"\026\007-\255\274\247!\315\316\213\203N\024\260.\263\233O4\245"
+	.ascii	"\177\341\213>ZeQ\031W(\226\215\323\333\231C%\006\335\340\025"
+	.ascii	"\215Z\241V\031Q7\277\354.\274\351_`"
+	.string	"\242om\\\212\302@a\344=8[\027z\240.P\027N\276\\\250\322\317[\026\225\372A\204@\233\350T\346\312\024\020\022\032\352\017\201\211\023\007\335\204v\211h\207\211Gw\2305\2772r\377u\322.Yo\020o\376\220\2257o\354\206\216\034\036f\304,\204m,\\FL\273{v\335\374B\033\367_\007\02534Cw\363\207j\350\34756\033\032\346\033\0038c\033\272\322\267\371\206\0325y\357\254\231\210fVHH\330\203,\214\3763\03246\256h7\323Lp\366E\213~\346\262Y\020.\013f\256\242\335$\374p\346c\212\376s``\236!\366!\355\313\332\337_\336\263\2330\004\0236\013C\364\363\030\233\311\300e2\230\r\256\332Ra\"\322\354,\364`\323\345]\262\030\275\367&\363\221\210f\226\305\344\246\013>87g/\031\fP \226\363\013\314\027-3\364\212\024f\034T\256l\351\303_zx"
+	.ascii	"\301A\346\346\027b.\377urhd\251\333\272\371Bp\264\236^\336\263"
+	.ascii	"{\357\235\227\367P0eH\246\334|!@\275e\013\234\246P\236\376s\226"
+	.ascii	"[\270\234%G\311Tm\273\271\272\301av\270\267\327\005(\331\324"
+	.ascii	"]\340\315\027\202\242\237\361l\316\263p9\017\313\035m)\032\003"
+	.ascii	"8k>/\270\220\020}\213\345\322g*y\356\271\312\253\344;\253\265"
+	.ascii	"\367\366\332\3154\037\332l%\242\035n/-\016\177\266{\276\363\251"
+	.ascii	"2d\352\306\315/\314u\377ur\240\224-3\352\350\254\226WY\2271\033"
+	.ascii	"(\257)\330\226\255\334\262\237.4\26117\007MG\246\244\222\004"
+	.ascii	"PR\222\362hH\303PPR\t#T\250K#\nKK\343QS\362\310T\221\201\004"
+	.ascii	"\006\"\025\326\243\222\021\312H\202\202\245\272\252(Hh@A9\302"
+	.ascii	"Rmj:.\223\226"
+	.string	"\220QJ'&\004\351\205\022\022,%\217L\027\222\307\247\245\272\252K\027\324&\343R\205z\032\261\252M<I\024\214\313\022N#P\254j\023\317\210\013w\352\240<.\215\020XRW\343\323qe\202\260\252MB<9K\306\235\246\344q=\032MH\241\004\025Ie*\221J@HI\025J\371s\247\016M\311\343rezP\227\242\220J\311\243\207%3\312\003\006$2*\231T&s\326\242\272\302\221\231\242\240\\:\255\312d\016\223QE\346Ue>\251O)\004\204\356\324A}:\256\033\326\"\023\005\363\210D\036\237\322;u\360\300\214@-\256\370QW\265\t\350N\035N$\211\200\344aU\233\226\306u\002\026JJ$\tu\251$\001t\247\016KG(\017EK\352jlq\\\225F0\215&\250K\312\247\345\3218\264\216X\002Z\217\311\243\320\272T\246P\227LD(F\200p\247\016\311\250\245\007%&"
+	.string	"0\233\214\310\020\324\325\2702w\206\324'\345\2212\t)\205\t\013)\006fR\t\305TK@JaB]\032\241\324e\004L\022H)L,-\031\205x@tX\252O\307$\237!\025\271\2244:m\310\240\256\306\025\211\205\222\352\244$\301\222\212\\aL\202\260\341C\207ui\204\352\260.\225)\222\222\224GJ\024\364"
+	.ascii	"}\350\300T\327\343\322\204\037\343j,\261\224T\221\326U\351D\264"
+	.ascii	"\216HJ\0222\352\260T\206\320\224<\262P*\221C\306\325X\002\211"
+	.ascii	"\205\222\352Db]\225NCkRER&1\325U\205\017\232\222\307\344\321"
+	.ascii	"\370\244\2260\301\312T\2430\240\226\240.)Q\250\2604&\217\037"
+	.ascii	"0\231\252\222r\tU\224\023\201\022JXW\345\221\0233\n\311$\244"
+	.ascii	"\264$\321\304D\261\256J\247\235\246\344"
+	.ascii	"q)\251\"1EXW\245\223O\004\222\226\312\020\326\245"
+	.string	"2\205\272\214Z\227\312\024\353\252t\322\353\322\310T\221|\300\272*\217\226\312\020F\260X*Q\240\200\2512\217H\343q=&\217\026T\\xRW\246\nH\030\324\247c\322\321\3124\"10\243V\343\212\244\302R]W\343\007\352j\\\202\212*\272\322q\251&\325&}\r6\300`\003\021)\344\\D\007\037:\370\220^D\007FF\035l`\244\277\201\021V\213M\311\343\322\350\204\264\256E\246\n\365\351\270j\265\030\302\005\024#@\270\222\332dd2U\024H)L\254\253\322\351\207Y4\256\306\022I\345q\215B*\221\230PMB\353\235:0\241\232.\254H#f\026\225\224'\230PM>\253\021\211s\222J$vB\"1R\n\023=K\252\n\205\304\2432\227QJ\022K\311(\345\262\251\007J\271\344\224W#\322ST2]\221J\345\007Et\265\240<f\310`\201\005\323\210\"\031\305\324\243\026E\300"
+	.string	"\305|bB5\t\245\240.%EPW\343r)\312\270\242\230\202r\005\013%#r\005\206\365N\035<0\227j\213\343r\311\270\032K\3740\213=\020X\227\312\024A*r\2051\251E\272T\217L\3075\251.\035w\324\242\272\244D\261.\225P;\352\222\362)\253\305\007\254K%\224\0173\251<\256P\312\034u5\226\260\024e\\\241\325\025\216H\352\nG$\275\352%\243z\264\354Y2\252Gk\021D\006\310\2431i\25121E}\220\302\332\263\\S\250-\216\252\222Z\002\322x\\\252\314\242(\315B\311\270\002\2114\222Ha\271\303DJa\302guj:\"\231\202N\034\361 \215\2004\302\021\322\b\351\211\243\342\323\022\317\211\243\242\222\312,\232"
+	.string	"B\221\251\204\3529qTT\225\222\306\225\t\304T\327#R]\215\314\"\023\252\311'\205#SRy\\\225\324\345q\251\250>)\235~\220H\345\222\205\3221\271\303d\032\241\236\224JE\025\331\2244\3728=\3550\231\314\242\372t\\\213L\250\246\236\023GE$\363\351'\251<\256\306\345\212c\013\035#\020\031,\215NJEU]\252-r\326;A"
+	.string	"\245\\\231:\314\242\t$\024E\024#@(&%=\340\350G]UXQ\\\227\306\225\271S|2\252>L(U]QlJ\036\223K#\n>K\307\242\216\021\b\346\323\322\2104\372\234(\032\201\310@\203\020\033p`\004\"\003\rBlpT\344"
+	.string	"\211T\225rN\034\031\235"
+	.ascii	"\261\256\306\025@F \240\236\324\025=qTD\032wN\034\025\327\244"
+	.ascii	"\272\\F)\351\2348*&\217\306\247\237\023GE(\243Rq]\215+vN\034"
+	.ascii	"\025\231\031\250\253q\271\342\351\210T\3429qT|\202Z\242\311\343"
+	.ascii	"\223\222\312,*\035\227\253\222\212T{N\034\025\227T\025\212\231"
+	.ascii	"s\247\016\024\\\t\245.=\254J\345\322\003\017\263\330tdJ*I\b\031"
+	.ascii	"\203\326\342\006Fk\362\230\323\224T\236H\341\030\202r\004&T\223"
+	.ascii	"\220\223\322zD\201\031\264\244\256K\265E"
+	.string	"\362X\264\220\202\212\204\212*\301\2044:\355\250\305\020\226\226J%\t&\224\t\242\325\370\264T2\025\325\325\230<.-\225J\245b\006\265\270\036\223*x\326c2j'\251<2\217J\352\022\252\31042\265(\252\300\202\271d\272\2004\266X\252kR\204\245d\224\022\351iiD\216\300\220\304\034\301T\243\220F\b,\035\241.\250M\306\025\251lQD\"U\245\342\272TB\251\313!\346R\311L\252\314\242\n,\230* \231~Vp*\252KQ\353q]\215+8\025\223\312\343zd*\241\326\242\2105y\214\312\371\001\016@b\002\025#\230\320J\035\326U\351\344AE\252\253\207\344\321\370\344Ai\311\364\320\341\201\025\234\212*,W\365I\271\244,\262H\036\221-\214OC\377\3238\371m\257\355\r\0268o\\\270\235\315\335\374\244z\342G\250wsj\230\032\246\210:\315\035\247W\r\304\264M\216\020*W"
+	.string	"\333\244\207c\336\b\3232\034\032\216\300/l,\232\234\274\267 \2047\037"
+	.string	"a\372O\013\255`\006Bf%m\r^K\273\\\270\241\242f,\257\0213\323K\203\352\210\223\006\316\216\020\335of\332\300\271\031\r\232tj\213\020"
+	.string	"U\251`*\230\367\354\326j\256\321\201\201)\332-\r\251\275\247\366\346Q$\345b\343\002\230\212\271U\r\371\272\371'mb\004\206]\231\252\237B\036N\202\220\311\210?\207\\\306\304\360K\247\312\200\001\271\022#&\357\t\362\220 \n\0300y\017\253\310\240\022>\276\264/\204\035\233\227\247}<_\376\202"
+	.string	"\336\234v\3117|\260\310\244\342n~\341\363l\330\245\361\335|\t|\350?\335\023c\205\207\022!7s\341\222\242\351\030-!\224 \206\376\323-(\032\266\032|RZP7;^p\220\360eA\023A\3709\261\260\354e)_C\304\362\362\024\263+ZwW\276\364\230\033\332\033^\332\343'\356p\355+\275C\325\354"
+	.string	"9\263\347L\355R\253+\274'NnN\351nj%\255{J\367gJ\007\2007@\326R"
+	.string	"\204\203\212\026%i\236\233\033\222FO\231\342\265\247\237<u<\244\324\2709\215K\343\362\235N\f'\232\206\203\313w\027\flog\016\025\030\210\203\021\200=\337\366\336@=\200S\274\024\272\345;\037*D\246~\264\341\021"
+	.string	"\306U]\312F\005-\205\304\250\363!\005[\034()\244 3F\231\231\031\232$\035\203\026@PXH\034\222j\323V\017\023\200\003I\213\346\231\252WL\225\210\210$)H}\262sr\217\351\306c\203\307U\271\376!M\302\257v\207\231\301\224S\355w\002\020\210\323\375\353}R\222\375\270V\020\216p\313$z`i4\301OS\221X[\215f,\272\235\032\311(\347<\030\310f\371\202CVLR\017D\323EIu\255<\305\314v\036lW\3415\310\216\253\030\003\374\3331\001\007\021\347nx\322\236\345\n:DF\013\223\237\212\257\326\305\216 m\343\262b\345|m\227\212\032\037\216Z 'qJY\262Va\212\326d,'X\270\025j\204\357\306"
+	.string	"O\303{O\300\263\372v\317\376\324\346\0240G\306\240\263\027\315\242&\301\035\324\372\206\260W\r\235\367H@\347\364\364|CR\r|/\223$W\362\270\374,h\230\366\004\336\320\254\324\303\225\206\242)\305\300\006J\352\340"
+	.string	"=7\274>\324\332+lg!"
+	.ascii	"&U\254\217\366\177\325d\216/@)\316\nA\234\340\2112\267\177G\312"
+	.ascii	"\177 \2429,!\300\316qd\037\0307\325(s(\326\377\204f\206J\352"
+	.ascii	"r\035\361\241\n\203\232\257V-\366\362$? \006\021\360\024<\214"
+	.ascii	"\233S@J\210\301l\217\320\217S@N\301\346\316\0054\350\202?\305"
+	.ascii	"\013\365\032\220\271\217YZ\223\0306\253,\336\0334\212\027\030"
+	.ascii	"\256N\223\006:\245l\2601\217\337\277\246\377\313$\277\263!\302"
+	.ascii	"\277\237MF\341\215l\333\215J\220\340l5\202\257\f;\270\371\263"
+	.ascii	"o,\302\222l\311\037P:\021\247\036\f\023\007\333e\303\003_\242"
+	.ascii	"\343x\215\324\334\257b\025\\vJG,hIC\311\322t\"\223\212\210\361"
+	.ascii	"\t\b\276Eey\372\216\311\313\262\310\361\222=\377H\371\221\347"
+	.ascii	"\230\340\017\032B\276\336\f\343\376\330&\007$\361\317c\322d\004"
+	.ascii	"\326?\222\030\333~\202\210\357(\343\0320\231\304<i2\311\374l"
+	.string	"\007\360\272w\366\261nd\374O\365\346sh\037\363\354\274\005\364\n\340\r\022-\266\331\340\002j\003\247\256\267\352y\251\006s"
+	.string	"c\207\325l\257wt#\220w\267\220\337"
+	.string	"E'\350@\210\231\343x\022\343\201\253\277\025\330\207\330\315+\371\313\023\262\3776}\302EA\006H\005"
+	.ascii	"\252#\b\357\337\366\270\325\361\037 \227\277lw5\364%\016\020"
+	.ascii	"\230\377,f\206K\364\333\016\237\f{\335\312\272T\327+\231-\244"
+	.ascii	"\311[+\366\024q\244]\300\207\036\336&\302\2701"
+	.string	"\016\355c\300e\t\274p\344\206\336\003\202[0\323\257K\236MV\245\231\\\031\031\301c?b\270\313\007\373\225\276#m\234\345<\230*\365\3320\025o\n\\\306mo.\312\360\234\255\225\326\355\016\276:\276\021#\371\255\256?\363\246=*\304\302E\233~u<\306F\237\225\231k\r><'\376#&Q\352\300+\307QM^\355f\316\273\237\005?\337\315\027\b\365m\271nm\003\234\023]PV\024\302{\375^/i\033;&N\21378\255A\017\020Q\204H\356\350\212\024T\r\350n\315\200\230!(\021\203\314g\351f\3051\024\373%\226L\325\f\020\201\375\377\002\216\006v\230+o\f\352E\2132\222O\371@BD\226\353\354Z\222\230\240\\@\345\3200\212\031\003A6\202#\227\314\2410h6\224\337$4 \246S\0271W\373\332/\362\356<\201\0359E\325j\273\313j\216\260\224\366\035\313S\244,\270"
+	.string	"lbR\003\372\202\343\323\210\276\235\315c%\247\322PiS[\353A\007\272T\210Z\331Y}\017\373Mc>\346\320\233;\327\230\216x\005\325\217\320b\311\264\245\016o\326\025\340\370\250K\220s\210\024j\030\230\005\t0\365|D\210\277Lz\004\030\350P\364\364v\013i\362\002\207\032#c@\204_\203]=)\016b\314\020\217H\367v\331\215^\336\341\337j@;5\322\025\213\035=\030s\243\346\355\230\344\256\307\323\242\023\342\324\233"
+	.string	"\210\225\036e\341\004\347\006\2029\005\017\320)\230\034U\241\275\340\311?~\374\3646\226\313D{\312\253\\\\\260"
+	.ascii	"\373\303\021\356\032&\220\217&\356\310\300\332\337\030\021\036"
+	.ascii	"U\016\020\257\003Bx\215\217\261\302\251\226<u}\t\361\215\217"
+	.ascii	"\276\307\"\220\013\355\304s\002\375\"\026\303\2132\022~\004\205"
+	.ascii	"\274\307\025\231\276\370\234\b\222Y\262\347\360{\325\357IF\207"
+	.ascii	"\274wdV\274\301O\017\240\256\364\216\225;\205\be#\221\375\270"
+	.ascii	"\207y\374\2172`\220\365\250\0367\224\367ZL \376\320\177\\\274"
+	.ascii	"-\374}\225\222\216\001\002\365~\337\345\036Z\357\t\021\225\303"
+	.ascii	"\b\376z\364\260\221\\\203\027\235.\2231\224\261\345\"\213\201"
+	.ascii	"\356\302U\026Q\210\b^Go\026s\333\336r]\240L\271(\327\306S\"\033"
+	.ascii	" \245\036\322A\b \002\370\365\320E\020\302b!V\300\325y\373\325"
+	.ascii	"jH\206\233\314\201\202^\332\312@\301x\336\037\262b\203\243Ov"
+	.ascii	"V\214&TWQke\020\276I\221\267\026M9\260\271\220\342\001\215^\372"
+	.ascii	"(q\022I\023\017\354\306\340`\263{\347\344\246r\271\354\350dF"
+	.ascii	"\273\367\223Y\3777O&\345\311\346`\003\321F8\035\023$F\377\020"
+	.ascii	"\207ll\257\210\275c\006,\006\302\342=3\322{*U\326\341c~bf\006"
+	.ascii	"\364\003F*\020\351\004\242\"\0272A\\\362\314W_\314j\r=\340\257"
+	.ascii	">V&E\013\333}<\264\202\254\024`\216\260\266\244}(\035\206\210"
+	.ascii	"\b\344+\374%F\317l(\252P/\216\357\202+\304\324uZ*\247"
+	.string	"\230h\351\334|\201\240\277\347q\377k\222\0041\377%=\t\"#%J\302\254\364`\253Xe\267\246\026\261J\237\250D\243\266\327\370t[\364\313\334\246!0Ta#\361\271>\301b<ft\223\233)pz\376\216iwo\004\354U\020Nc\234\200\270\213\266\204\241q\016\256\205\225\373\235\366\3579t\222\325\342\300M\036\013r\355\223\226\206\322\220\376\247\211 M\315R-FX\223v\273\300\240\274\320\326\020\301\347$7\274!T\036\371\260i\202\325\031IJg\364Bk\231\243\272\344ex\314\347\005\224\001\002x\300\231(!r\212\016\367&\032.\022v\005\220\307\305\026e\325\370YE\274\371\230\207\301\317\211\311\252ye\206>6\357\017\322\035l\251H\360\203'\253\237\300\026<%\310\356\310.\026\217\330\333\201 \302P\263\232\231\267\3267\200:\356#\241F\200sg\221\004\257\3468{\222\262W\"\005\311y\327\313"
+	.string	"e\236\227\026[\265)\375\273\252\220'\350\034\373\033\001x\032\024v\332BEE\2225\327\031\265A\230\025u0\361\025\bm\276\242\023\255\245\004\231\271\007F\023\377\301'&\371\002\257\342\260|R\277\320]\304\255XmU\007\242\340e\323\230)@\351\231Q\f'\315\357\354\344\rp\224\214_m\303g\347\035\377\343Lg\212?7\340Z\234\262\320\350){\035g.#\277\035E\261\343SA~vS\002\020\316h\242\317\346C\237Q^\276`\377\245\001\006\333\r\332J\324\300u\211\327\200!\\\327\027\236\210\201?\fH"
+	.string	"W\270a-\245H\316h\205\355 \300qR\373\n\016\007\037\270\317Jg\315\260P\253\021\316\264\001\3668L}n\341\241\026\215D\3702}\321\360$\261\341\325Z]\036\244\374k\006\335\034\037~\2254\233\215\347\3540\271\250\003\357\177\b\215\256\202\254\305c\036K\n\354z\313\270FM\234\377\021\362"
+	.string	"`}\310\021-\213d\317\2504\371r\365yd1\371g\232\252\306\375bH\243\037\330\b\317\304\367\247\230\"\207u\037\f\013\205*1@\342\233\261\242b#U\373\006\266\303j\035 \350\251\003~\331Z\370\226z\315\376\343(}(\325\253\256\252\272\342\n\024:N\207\033\240\306\243\310\314]\347\343\034u\215\374\304\314\362\211\212!\024i\021K\365#{bk\352\371"
+	.ascii	"\321\326\314\333P\273\263\356\350g9\270\325n\320\002\"\346\365"
+	.ascii	"\337z?\275eK\207\330\327)7D?YP\035z\003Kb\002\0051M\013\305`"
+	.ascii	"\230l\2651)\231Mz\031\362j\f$\351Zl\2319\033\300Ls,\212\335\330"
+	.ascii	"\337P\3547\311F\255\274:\277\315\224\035$\212}b\302\316d\314"
+	.ascii	"\230[\031\255/\f\314\245\356Y\t\215\3344d\200\276\341pn\250\332"
+	.ascii	"\226j\003U'&\007N\003\264C\005\244z\377\277\360\326K\006<\206"
+	.ascii	"N+\310E0\340m\216\b\305\373\342_\024\013\035\344\275\246Y4\036"
+	.ascii	"I\256\373\307\307\235\272\376@gM\350\223+4\353\344\310\303w\020"
+	.ascii	"\213\222\242\270j\3418\034\272?\243|E\373PY=CbM\217.\271\023"
+	.ascii	"\005\177t\367\315\234\274\2711\215\365\335\007\304!aQ1\232\017"
+	.ascii	"H\374x\276\222\355\240\272\305(\362P\211T\300\223\020\335FAC"
+	.ascii	"}\2275\020\225h#.\261\353Y\314[\304\206\200i\361g\226\227\313"
+	.ascii	"\331\271\202\342V#\2703\212v\267\203W\210\016\234S\240r\223\277"
+	.ascii	"\240LtK/\211\377d\006\336\361G\373\276BW\331~\026b\3238\274\026"
+	.ascii	"\354jY\236\202Y\3715?\215\342d\245\376\0308\353#y\372Ay5\330"
+	.ascii	"\237\365\351\326<wt\355_\204\375cN\364\233\021\223\336v\367\031"
+	.ascii	"f\357\315;`o\232<\336\302\325\202\335\263\3043\321o,l;\313\020"
+	.ascii	"!\233\226~\326\370\271\276\237w;\276~#ek\341_\316q\361~)\376"
+	.ascii	"\334\353\033\242<\241\036\255\352\324i\322"
+	.string	""
+	.string	"V\2553t\377\314\330\255\344\312\023\203W\306\373\023g\t\3729\221\204o\024:\352\031\007\306\034\342\373\315\177\364~\201\331\207rz\0333\267M\233\3078?\032\373\035\370\177\\w\024\273\326\264\017\317\220\250\345\307\376\315\353\357P\322\357\035\235|\316Z\032\270\037\303="
+	.string	"\276u\373\224\233h]\3655\006>w\252:\312\242\375\035^b\034h\335R\311>\321\313s\020>\276p\214\237\304yti\275\261 6\207O\302\377\030\237Hp>\213\027H_\211q#\363\361\355\303\003\031\255\305\327\340\215\254\377\227V6\210\336(\306\237\267}?\373.\212Q\200\357E\362\230~{\320\267H\266\004av\224tBh\036~`\322\365-\0375\267\327\215\215\323\351\235\373h\272\372\004:\263\202\267~\320}=\265\370\306W_\214\365\256V_%>"
+	.ascii	"+\027/SnF\3157\227\257\020\307r\227\241\f\226q7\231\310\353\236"
+	.ascii	"3\0270f\275\317\214\237[\332\372\374\013\271\265}\003\013v\005"
+	.text
+	.section	.gnu.lto_.symtab.e4b4115b993e80d2,"e",@progbits
+	.string	"addGPSCoordinates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\002"
+	.string	""
+	.string	"hottPrepareGPSResponse"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\002"
+	.string	""
+	.string	"hottPrepareEAMResponse"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\002"
+	.string	""
+	.string	"freeHoTTTelemetryPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\002"
+	.string	""
+	.string	"initHoTTTelemetry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\002"
+	.string	""
+	.string	"configureHoTTTelemetryPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\002"
+	.string	""
+	.string	"checkHoTTTelemetryState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\002"
+	.string	""
+	.string	"handleHoTTTelemetry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\002"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\002"
+	.string	""
+	.string	"telemetryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\002"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\002"
+	.string	""
+	.string	"GPS_distanceToHome"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\002"
+	.string	""
+	.string	"GPS_directionToHome"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\002"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\002"
+	.string	""
+	.string	"getBatteryState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\002"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\002"
+	.string	""
+	.string	"getBatteryVoltage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\002"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\002"
+	.string	""
+	.string	"closeSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\002"
+	.string	""
+	.string	"serialSetMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\002"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\002"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\002"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\003"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\003"
+	.string	""
+	.string	"getEstimatedVario"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\003"
+	.string	""
+	.string	"getEstimatedAltitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\003"
+	.string	""
+	.string	"getMAhDrawn"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\003"
+	.string	""
+	.string	"getAmperage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\003"
+	.string	""
+	.string	"determinePortSharing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\003"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\003"
+	.string	""
+	.string	"telemetryDetermineEnabledState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.e4b4115b993e80d2,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,201 @@
+	.file	"ibus_shared.c"
+	.section	.gnu.lto_.profile.59bf08f8211e1474,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.59bf08f8211e1474,"e",@progbits
+	.string	"(\265/\375 +\335"
+	.string	""
+	.string	"\230\037"
+	.string	"\002"
+	.string	"\303\370\326\315\t\b\002"
+	.string	"\001\240\342\234\212\n"
+	.string	"\002"
+	.ascii	"9\211`\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.59bf08f8211e1474,"e",@progbits
+	.string	"(\265/\375 \031\205"
+	.string	""
+	.string	"@\r"
+	.string	"\001"
+	.string	"\002"
+	.string	"\003"
+	.string	"\002"
+	.ascii	" \223\r`\001"
+	.text
+	.section	.gnu.lto_.inline.59bf08f8211e1474,"e",@progbits
+	.string	"(\265/\375 z\345\002"
+	.string	"\"\305\021\035\240'\351\237c(\340\223\306\272<\227\343\370\350\352\302BUU\227\200%\032\361{K\231\002\277a\333^;\200l\230\030\016\212\2726D\263\346`s\022\330\266\345\017-\022\b\207\240p\34367\275C\217\204\321"
+	.string	"\374.\004\007"
+	.string	"-\245^\302p\271\226b\270(\323R\354\332"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.jmpfuncs.59bf08f8211e1474,"e",@progbits
+	.string	"(\265/\375 \031\255"
+	.string	""
+	.string	"x\r"
+	.string	"\001"
+	.string	"\002\001\001\017\177\002"
+	.string	"\177\002\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.59bf08f8211e1474,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\205\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.59bf08f8211e1474,"e",@progbits
+	.string	"(\265/\375 $\325"
+	.string	""
+	.string	"\220\030"
+	.string	"\001"
+	.string	"\002\300\005\300\007"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	":\3427\200\005"
+	.text
+	.section	.gnu.lto_.lto.59bf08f8211e1474,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_isChecksumOkIa6b.24.59bf08f8211e1474,"e",@progbits
+	.string	"(\265/\375`Z\004e\035"
+	.string	"vw\276I\260\326M:\261\207?\343\251=\214`\345D(/\254B%:\225\020\207\204\347\f\364\332\00119\273\317\374\255\037\316~\233Zr#\313}\2207\302\032\345\215\231^\372\332BX\244\266{\217\206\272\371\360\201Z\333\204\020\"wJ\001\251"
+	.string	"\240"
+	.string	"\254"
+	.ascii	"\024\350\303\333G6i\033\234\347\031yk\335\225\275Z\255\0248\302"
+	.ascii	"\234\366\247\376\343\350@H\\\246V\250\255^\255<\005n@\037\232"
+	.ascii	"\367\032\361!\275L|\330\300\301\221\221\316\223\321t\034e\356"
+	.ascii	"\352\253V\336lc\030\246,\313\362 \357\006'\322\351(\206\340N"
+	.ascii	"$\237\352\240\217'\254*\237\226.\351t\300\213\025O\037u\250x"
+	.ascii	"\232\"x`\247\304\351E\227\003k\232\300\200r*\334\f\301q\251\351"
+	.ascii	"\306\213n\t|"
+	.string	"\220\205J\027\223\3566A)\247\357\275>\223h\271\371\264tN\237\243\204Z\253'\n\335\212\033v\333;lk\260A\n\001\2469\327-\363\364\f\235\226\241\3231\347\3750\261\351\227\003\371]\300i26\035\233\3230\3304}\357\036\351\264\030\233\016\3474\b\233^\330\364\244\323\027\260'\254\230\220:\261>^m*\265T&a\027\216\367~\256\277\353k\3377\362.\337\313\344\326\321\207\234\313\357\375\210I!GV\265\0071L\312\nj7Uk%?\304\337\322:\221\332\213\024\240I*\250\326\224\257\f\364\341\016X\363\255.\304\344\257\216U{V\bZ{4\307%\205J\005\3720f\326^U\264\223\304\253M\020~_S\b\036:\241\213'\254\233\017\353w\0137\312d\013\033e\212i\246{\0356\243\334m\016\305\262E\312\334\262|\b\021g\231t\226f'(11\263X\266:\273N\300Zk\005_@\244\331"
+	.string	"{\035e\026nw\2638\233\263\023\t.\207\315\336\354s?\245\0136{\246\232uY"
+	.string	"{\034\217\333,M\2635{\257\203\277\222+\367\333\254$K\272\335\250\337\213\304\227\225\355\243\340v\267#\3611\362k\370$\304\207/\373#7\020\343J\225\217H\013\245Y\332\274\333\334(\373\017dd\241\342\205\262\311i\235"
+	.string	"98t\372&6m3\247\001\300\246k\336\365@\027*\252y\350\241\375\364P\332\b \f<6\036\037\372c\353\360\201\026$\332h\036zx,\304\334\263\300\207F\304\363S\333P+\342"
+	.string	"43\"\262\321\204hA4\333\354\003\020\217\320\254\207\2506[@\300C hD3\333\320\020\321\214\344)}\241<G\004\237b\202\2233\273\243\2647\223;#\322\215\002\031\370\266h\214\013e\231\215\241Ub+\263\236A1\272.\013+Am\256p\273\217\033\263\343\323m\226\227\261X\372\022A\020gGq\277Ke\325\243\352I\270\242\b#Zk}\215p\327eA\244\313\304\271\273\207\331\271\342\222\334\217\336H\304q\277\247zP\250Q4c\020D\002e\024\tj\002\022\205\205i\fp\002\021\252\354\001\020XVT\222Bk!R\312\007O\325\204\r\307\\\t\004\307`9\233\241.\236\323\214\r`\363\0333\031H\375G\272\241\236mE\3266\024\334\214\243\210\t&\247)\033\247\023\376j\023\350\370v$"
+	.string	"\277\311\257\262\311\2077\023kJ\\\372%\017\202\251I#\210\245\033\027\002\321\027\203\331\232\253f"
+	.ascii	"\026\300}\362\246\027:\256Z\356\310\fO\013\030\272\327W,\302"
+	.ascii	"\277e\340\312{\347\307\305`%^/\016\341\003\372\277\215DU\006"
+	.ascii	"\263\267G;\363\312.\2228mx\320\345k\2754"
+	.text
+	.section	.gnu.lto_.symbol_nodes.59bf08f8211e1474,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\030\177\002\360\372\2508\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\005\r\003\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.59bf08f8211e1474,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.59bf08f8211e1474,"e",@progbits
+	.string	"(\265/\375`\361\003m\036"
+	.string	"V\275\323F\240\\\321p\374\371c\025q>\016\006&Z\200\366\263\343\263\207\177\275\347\251%\275\307\330\371\255\240\365#z\337\345\305\201U\226\255\200\334\235\342k\0076\277\300<\223\n\236\t\206\026BAx\363\tL\230\366o\356\266e\n\255"
+	.string	"\265"
+	.string	"\304"
+	.string	"/\377\357\240O\352_\303\347\214\352\365~\247\003\275?\225V\230\376\260*\315Uz\256P\276\231\025\2525\352,\324r\243\216\365C\311\265l\362\246\377\353\206\214Je\264\tE{\245\354E\262I\326I\353l\362\275\352Wa\255\026J\262\252\204\342*\331%\253.\330&\236`\301\255\322\211\232\344W\007\274`\300\360\341\013E\007\221^&.\360\273\005\207\244w\301\270\301]0Z]\003#\271\005F\333@\266\025\330&`\373\201\3551\266\201\266\251l\207\220b\373e\357\r\333[lS\261\335\304\266\023\333\242m0\266\303`0\030\264\035\3026\034\273E#.\365\350\322k\264\327\353\332\215\331\001\266\265\r~\333\255"
+	.ascii	";\376&\254,RH\025\323F\370s\027\360\344j\376\352/\345\375h\300"
+	.ascii	"\316\365\341\031\306L\321\377J\330\371\247\344i\376\253\357\351"
+	.ascii	"\271>\355Y\177\345\325_I\252O\317\273\351\203\235\274_z\256\277"
+	.ascii	"t\317\365\350y&J\340\274/\375\372c\263\247\372C\317\325\227\302"
+	.ascii	"\316\251\254tj*k\306\2269y\177\321{2Q\037\340\251\372\216\365"
+	.ascii	"o\025\323\321\006\377\223\017\3052i\354\325\022\360\305\222\225"
+	.ascii	"\351[\365?\202\336\022\224\357<\3409\304\367\017Y2z\257B\251"
+	.ascii	"\002\317c\201\245\216\24771\375\t\256\376\275\277\334\003\377"
+	.ascii	"c\270\206\364\002\215\255`p\201F\277\351\201\022cFL\030\322\336"
+	.ascii	"+\257\272W\273E\344\251O\307)#.\340\3049\332\005\002\354\007"
+	.ascii	"\260H(.\226\315\262jl\265x\255\354\025\363\360\324\257<g\334"
+	.ascii	"\334\250\nEo\020\322\033\033\007\004\203\301\340\306\306\237"
+	.ascii	"50\212\373#\275\353Ny\251V]\252\245\342]\372qp\301P&\310BK\234"
+	.ascii	";9\305^9R2"
+	.string	"QP\274T\354\t\026\326\352\365+\340\371A\244\fS(\256U\270Rv\212\327j\243\274x_+\3617w\031\b\330e\340\322\362\303\224\032E\343\310\255Z)\236\247\036m\350\204\242\337\354\023\333<.(8j\036\240\316\221:rB\321#\310\320\036o\242\377c\004\273\"\332\354\266\253\341\224l\270\232\rf\243\240\016!8\200\220\355n&t\265\237]\321\004\n\344\t[\016Gt\323\345\210\220n\273\244\025 \006\330\201s)n:\331.\227\323\311zp\271\\\206\"\027\tZ\215\303\211\017HJI'l7#\242\244#\037\333\216t7\0247\023\244+\320\"\320\204T\354XhH\302\220\204\321BC\263\331\020mF\2326k\355\212\204v(\216\224v|\341\002\321\217\b\017\032H[P\211\233\256f\224T\224\244D\342H\266B\267\273!\335p\267\235\f\305Q\rIf\323%\311\202\032\270K\227\005n(\377R=\f"
+	.ascii	"@\324\260\230\023\347Nh\314^/^ \231\305\332\262\004M(\356\227"
+	.ascii	"\005\263*\320\206\361\212\3311v\231\352\325\320\007\035(R\241"
+	.ascii	"\350\263\006\0020 @\002b\220\262\344\001_\001,\220\374/C\300"
+	.ascii	"\254\035`\005\377\227\0133c\035\231i\342\372?`\026\rH(\267F/"
+	.ascii	"\013s\366\025\244a\331V6cXT\013\273 \3224\253\275\036d\335\037"
+	.ascii	"\262\270\340j\221\242\272\027\255m\2002\3610\310(\032\300\025"
+	.ascii	"\005\311\302\34030`\007\317M\201|\365\004\333\312\255\317\333"
+	.ascii	"\025\230\235\245[nZ;9\330\241\326-\336V\216\n\030&\241.SP"
+	.text
+	.section	.gnu.lto_.symtab.59bf08f8211e1474,"e",@progbits
+	.string	"isChecksumOkIa6b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316"
+	.string	""
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.59bf08f8211e1474,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
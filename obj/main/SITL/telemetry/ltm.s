@@ -0,0 +1,1154 @@
+	.file	"ltm.c"
+	.section	.gnu.lto_.profile.f474b87192100e73,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.f474b87192100e73,"e",@progbits
+	.string	"(\265/\375`)\001e\t"
+	.string	"d\f\035\002"
+	.string	"\033"
+	.string	"\253\273\370M\b\002"
+	.string	"\002"
+	.string	"\002\001\001\240\342\234\212\n\002\003\265\373\223\204\004\f"
+	.string	"\002"
+	.string	"\004\254\333\233\324\017\030\005\277\205\366\315\002\n\002\001\002\001\007\270\266\363\371\t\024\002\003\002\004\001\002\001\n\351\342\270\326\005\034"
+	.string	"\002\005\002\003\006\002\005"
+	.string	"\001\002\001\f\201\207\345\256\007\024\002\006\002\006\001\002\001\017\352\322\320\315\005\020\021\212\346\242)\004\002\007\022\023\254\241\214\350\n\006\002\b\002\b\025\026\316\300\362\216\016\004\027\307\354\376\303\t\030\270\221\253\372\n\004\002\t\002\t\002\n\002\n\031\032\033\240\352\353\212\t\016"
+	.string	"\002\013\002"
+	.string	"\002\f\002\007\002\r\002\016\002\013\036\316\352\207\265\016\b\002\b\037 !\"#\240\342\234\212\n"
+	.string	"- @\002\245\244:\007\020\361]l\354\211\020\222\006\353@Q;\fS\330\003\200\210\352\273\215\033\243'\200\265\003c\021\261\231\256\356\222\354xo3\354\242\313\215\2614\032\316\340"
+	.ascii	"\302h=\372&[\001\2603&\265\333\3428\003\026\024e`['\257\2009"
+	.ascii	"^\202A\024p_\340\370\240X\300!&\277F\332\277\270C"
+	.text
+	.section	.gnu.lto_.ipa_sra.f474b87192100e73,"e",@progbits
+	.string	"(\265/\375 \333-\003"
+	.string	"t\002\317"
+	.string	"\017"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\001\002"
+	.string	"\001"
+	.string	"\001\003"
+	.string	"\004\005\007\n\f\001"
+	.string	"\001\021\023"
+	.string	"\001\026\027\030"
+	.string	"\033\036\001"
+	.string	""
+	.string	""
+	.string	"\032"
+	.ascii	"\\(\241\022x\363\030\212\t\231\226\364\034\032\032\2201\007)"
+	.ascii	"\013\177 \340\252\223#\004\032\004T\b\300B\016\220`!\227\243"
+	.ascii	"\320*8\242\270\260\351\035\316c-\361.gk\332\263\001,"
+	.text
+	.section	.gnu.lto_.inline.f474b87192100e73,"e",@progbits
+	.string	"(\265/\375`u\003E\r"
+	.string	"\202\317780\217\222\016\007\231F6\371\354\247\317o\005\246\241\300\231\254\331\002?\343\037\327\021G\355(2\002["
+	.ascii	"\257\013\303\2310\320\301\300X\026\315rO\201v\275Q=L7\262I\n"
+	.ascii	"\243@&>\026\005\326\210\306G\350\320\320\3732\277G@\265\362\242"
+	.ascii	"\b\241\310 0@\203\036>\240\245\026a\006\243x\001*$V\361\342J"
+	.ascii	"\331\262Ry\331\376\220\"\313D\326\241\231@%\261\221\332LY\222"
+	.ascii	"j\3056w"
+	.string	"\266\224\374\202\203u\342\271{x\364p\265\f\017\331ri'\231\203\246\314\230\315bD\321Bd\026#z\203\037\017`\332&\234y\370o2\217h\373\031`\357#E\316\204\3209\245\253\355\302\332\336\247\335\220\245,g\325\326s|\357\333\373\270\230\347(\340I\331\266\232\374\273\204\303\241C\302\332r\276[;\005X\250aA4R3\353\302\276\001\200\"\022\262\353\001\022\200\2031\305\201\224QH9\301(\301\320L\230-\255\335bbYc\377\352\336\020\306&\322\220\353~x\013\203z\031lI\202[\357\255\207\312\354?\nN\333\r\363>\032\300\0319\b@\342v9\201\252h\334\263\327dl\314\335\205\214\200\331\366\211\353\017(\370!\212r\226\245\377\221'\327Qu>\002\351\351L\207\026 \032Tl\024 \336\375\253\353\026\272W\035\372\003\222\314`\357\243\276Y+mt\017n\226\262\001\2241S\353\334\344(I \270"
+	.ascii	"C\375\374x(\221\3023\271\274A\b-(\315d\003x\240A\364b\226\204"
+	.ascii	"<Sm\343oA\313\314\361\231\360\272\002d"
+	.text
+	.section	.gnu.lto_.jmpfuncs.f474b87192100e73,"e",@progbits
+	.string	"(\265/\375`\242\003M\n"
+	.string	"\022\213#+\200)I\007\230\ty\nQ #\024\260\246\214\230\024\231\332\021\374\341\023\226I$v\240P\354V/\3167\266\037\277~\243Md\222\001$S\025\036b\034\322\016a\221\206KFz\204\225\211\004d\302\027\267\022V\204\003\222\006dA\203D\264X\316e\334r\341:T\334\037j\300\341\240P\030\246\352\273\261-\356\237@\245\202\356\370\204\265d\270\337\030o\254_\001\223\311\271\273\004h0\347\361\340\34521\254\374N-\t/\311d\241\246\363D,\212[\250q]U5I\245\335\240\"\251#\323\006\022`2\232\b\322\b\"\b\023*\021\345\021\223r\252\003\345`\241D\266\0019d\226x\276\203\2633\205@QTm\203\260&\221fq\321\267X\3219\313\215\025\365:\361\304\372\360\231\204?\f\200\304\215u5\261q\347"
+	.string	"\203\035sU\302\331&\235\362\254\366\017\177\004\024Q\022#%\025\003JK\023\245\2451\005\032\200\306M\022 \t\032\343\t\266\252\207\242\026\246\023\022A\243\021e;d\333\t?2\002_d\301\023\2015\300\030\352L4x\307!TF\221\0138"
+	.ascii	"\273E\tw\271\004\336\n\342\333\316\2224\335\271\002\352\362\240"
+	.ascii	"\224.\n"
+	.text
+	.section	.gnu.lto_.pureconst.f474b87192100e73,"e",@progbits
+	.string	"(\265/\375 2\221\001"
+	.string	"."
+	.string	""
+	.string	""
+	.string	"\017"
+	.ascii	"\230\004\003\230\004\004\230\004\005\230\004\007\230\004\n\230"
+	.ascii	"\004\f\230\004\017\230\004\021\230\004\023\230\004\026\230\004"
+	.ascii	"\027\230\004\030\230\004\033\231\004\036\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.f474b87192100e73,"e",@progbits
+	.string	"(\265/\375` "
+	.string	"\325\003"
+	.string	"T\003\024\001"
+	.string	"\t"
+	.string	"\001\002\025\001"
+	.string	"\005\021\001\002\021\001"
+	.string	"\023"
+	.string	"\002\002\026"
+	.string	"\001\002\026\026\002\027\030\013"
+	.string	"\001\002\013\001"
+	.string	"\002\027"
+	.string	"\001\002\027\033\003\030\001"
+	.string	"\002\031\036\004"
+	.string	"\035"
+	.ascii	"=K0\261\002MdX\030\002M\325A\300\006F\275\235%<\343\202\370 "
+	.ascii	"D\200\340\276\032\306-\033\352\305\314\277\242\313\202Xp\bo\313"
+	.ascii	"\352h-,v6)v:;h\356\355\271x\267\003,\254\201!"
+	.text
+	.section	.gnu.lto_.lto.f474b87192100e73,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_ltm_initialise_packet.102.f474b87192100e73,"e",@progbits
+	.string	"(\265/\375`\276"
+	.string	"}\n"
+	.string	"\326\223G?0\251\270p\204\247Ob).}\206\\\242=\336\211\347\230\r\332\007zc\263\206i\242\247W\013Dk\354_\001\373\251V\037-\344q\302\nc\264\020\002c\375\026M\177\231\360\273\330D\210\224)\0054"
+	.string	"2"
+	.string	"7"
+	.string	"!\353n\b\003\003\273#\204\037\026\2169\264!|,\331\212\b\212$\200\265\273\233\222<|\206\376Q\256\211%\321\263B\261\273N\261\004r\353m7\330\216\260\257\t\rX\021F\331\262GQ\352\210\375kw\327z\262\237\3725M_\231VM\247\246\177\311$8\300\f\330\375hQ\330\025\206"
+	.string	"e\373\027\333\231\266\304D\370T\244\nN\220\004R\257Z`\262\244\303\255 \273\332\235\227\027\315\340\241\"\373"
+	.string	"\036"
+	.string	"\264\341\361d\307\256\026\252\023\323C\231\237\3621\344\233\230\343\223\027\217\371\237\354\230\036\b\030\034M\007v2o2\035\330\331@\037\310u\\\207\003\267\f\316E\267m>\317\226\301\330\323\340\276\r\364\274o\273\214\373k\365T1a5\322\016[R\365*p\251f\322T\025\363 \022"
+	.ascii	"3\241\307(\260\016\275\022x\367+&/\226W5\b\002\006<A\225\013"
+	.ascii	"^0\007,F*\221\217j/]0T\251q\340\316-\332\371\004"
+	.text
+	.section	.gnu.lto_ltm_serialise_16.104.f474b87192100e73,"e",@progbits
+	.string	"(\265/\375`\217\001\365\r"
+	.string	"\226\332ZA q\223\016\005<f-80r\316z\016y\232MS\022ctDyOU\002\345\327\002\263\213\265g\023\3377\2065'\313G\032\030(\bR"
+	.string	"L\215P\331 \034\f&(\333\273\021i{o)S\nG"
+	.string	"B"
+	.string	"K"
+	.string	"\321v\246}\023?\001z\312\004\277\335\r-Vv7\020\177T\177\036\037"
+	.ascii	"\377\362\002\340\237A\366\215o \366\302Ae\224B\307\356^\372\341"
+	.ascii	"\240'\310?\351\226vb\362\274(\330]\247vr\341\326\333>`\033\201"
+	.ascii	"\235\t\002\276\333\335\265v\260]Z\343\322\031\230\216.\215qi"
+	.ascii	"\013\246\253\247\3740\323\317\245\335Kk\246\323\245\037\3402"
+	.ascii	"BF\201\034\273\026R;\266\345\275\020a\373\246\333@9\212\227>"
+	.ascii	"\337\274\240F\374\263?v\374\313\326\250\3125\034\031\275j\364"
+	.ascii	"#\f\242\2578\213\r&\"\002\3772\252.h\224\210\231\032\325/=\310"
+	.ascii	"\362\232\rPP\023\373*~*\361C\230C\222\327H\340_\324\227\016`"
+	.ascii	"F\f\224k*\b\324+\203\f\251\021*\224){\023\245zp\022\356MH\346"
+	.ascii	"\031\271>\035\017\226a#\230\347\202\340\240Avm:%W\b\001s\"`\235"
+	.ascii	"\313\303\341t\256\270\205Nzu\"\321\022R\2211,\226:\305\300\260"
+	.ascii	"\236V\352\233V*\275\351\251:\375\bU\335,\020\252\352I\377\320"
+	.ascii	"p\252\200\022e*$ \240\002!2\353\" \017\217IXR\303\275X\362G\204"
+	.ascii	"\361G<8\037\216\345\026\035K\215\363u\213\301\327\222\031\036"
+	.ascii	"\375\340\"xd\250\336\364-\316L\264\375~D\334oZ\032\boe\306\030"
+	.ascii	"D\311\310%\001[\271n\211\030\266\002\227\274\2702\031"
+	.text
+	.section	.gnu.lto_ltm_serialise_32.105.f474b87192100e73,"e",@progbits
+	.string	"(\265/\375`u\003\205\023"
+	.string	"\306cxF\340\320(\035\to\361]\030mWA\240\225#\235J\232?Z\226!\224\223k\270Q\267\207\211\266\337\213\334\340\310{x\266\314i\243\207\342!\247\030f \2041Z\357\003\265H1\360\321n\274v.\376\267\275I\222)\005f"
+	.string	"X"
+	.string	"e"
+	.string	"\037\020\354\361\240c\003\207\263\342\306C8\213\260\315\213s= T2l_\332\222\241Wj\353l\r\302!f\246\201)\351\373,\354\360|_\016\245\004F\206'VEC\317\251h\330Y+\344\334\206Ot\341\3076\002\307\367}\255k\360\3149\253]c\322M&\306)2\360}_\363&3\301\275\333\006h[\240\365X\0013C6\035-wm\256\226\317\320\332\373\216\241}\326\344YV\314\226\300,\311\263\253gGbV\344Y\325\263!1\233\202Y\220gQ\317\236b\366\003f=Lc\233\274l\351\331\016\230%y\331\321\263\"\230\215^\026>\353\301\354\275l>k\001\242\236 "
+	.ascii	"1\276O\302.G7 \207\037\020\177\220\337;\212M7rSD\323\357\321"
+	.ascii	"\230\271\021Ag\362\036\337j\260\356\233\3346\n5\357\230G\305"
+	.ascii	"\265\262\022\rY\277\211\027\037J\231/ym\263\340\225\276\365\004"
+	.ascii	"\302cZ\223p\t\227\232Ca-\351[K4,\271m\214r\341\203\243\345\356"
+	.ascii	"\256\261;xg\230h:\311"
+	.string	"\2336\\-w5\335G\020\016\\\225\224\227\214\245\365 &s\275\\,.Y\213\201\202\004\257\226J\314\245\225\302*\254\201+\326\222\301`\261V)Gs\215G9'\200h\257\0255\343\364\216\243d\234J\377x\255\003\343\343\326)\3356\035\351\035+R\205\034U\213\220\213\256\n\n\031=\365\032\207E\352\306\361\370\b\205\343=\342E\247\270[\375\214\334\373\312g\004^\344\365\215\n\221;I\250aX\245\224C5a\244\250\214j\r\020\003\021)u\003\021\020\245T\212\241`\023\363\002\033\017'\006^\241\246\352\212\t\306r\265?\f\262\366\211L.eF\212\016\264\205\006\2619\306d\303f<\320F\355\201\016;\2768\343\232\230\003k\363\341\230\330\363Gd\273\213\bN\032\225\256\2442#\"K\022)\206\003\232\271\263\315S>H\203\005:\241\202\372\212\002O\304r#\026\326S\362\344X\3233\320\222W\200\022W\253"
+	.ascii	"\355\027\206\247\002"
+	.text
+	.section	.gnu.lto_ltm_gframe.107.f474b87192100e73,"e",@progbits
+	.string	"(\265/\375`f\006\375#"
+	.string	"\232A\364\rH\220VN:\200\302\013\017\314$P\273D\311M\220lH\257b\n9q\"\0361\222F|\360{"
+	.string	"\336\246\252U,\031x\350Z'\303l"
+	.string	"\030\004\236\270\002A\003"
+	.string	"\340\033\352n\177\017?\204t\273\377\217\2655\2737\221R\246\314"
+	.string	"\267"
+	.string	"\320"
+	.string	"\225_w|Z\371&\3457\345\263\311\337\002\276+n"
+	.ascii	"\246\234\247\211e\227\263\215\032\271\261c\273\377\2321Z\222"
+	.ascii	"\363<\313V9\265dg6\256\251\177\177l\362\377]\304\222\035\302"
+	.ascii	"\332\226\245\277\210\377\267\264\027\371\337\t\024\020\356X\360"
+	.ascii	"\207\212\346$6Y\3428\317d\321\322\023\361\226^\370K\331\344\327"
+	.ascii	"\271\353\352R4\333r\236'\260e\254p\177\276\036oW\251\331,\374"
+	.ascii	"R\355o\227\244\\\263KJ\025\030Z+\326\027\240\367dF\243\n\f-\025"
+	.ascii	"\313{\303J\261+\352\300\342\342\212b\251\225)\223Ue\376\234\347"
+	.ascii	"\371\313\272\3426\211X\260m\375\262\210f\216[W\224En\2007\254"
+	.ascii	"\025\314\273\244\363<\317\306,\255=\314\3767\373o\340\257J\001"
+	.ascii	"E*|\301\226\336\202\222R]\332M\313\202\320\221\355W\035\225\""
+	.ascii	"fO\345\341\275)\241Tq\335y{*7O\237\213\\D^\376{\266C\202_\260"
+	.ascii	"_X\3425.\325\245\334\364\r\b\035\327\220\227\234\206\305\355"
+	.ascii	"E\367\361\013\242ncP\312Uq\335c\370g5\324\277i\003\257q{\221"
+	.ascii	"\273%\214'\332\252\232\352O\022\271\217\377\232g{\375\224\017"
+	.ascii	"\244|\244\036\377\250\3077\252\374\"\312'\242\374\241\036_\250"
+	.ascii	"\362\203*\037\210\362}(\237\247\362wvl\257S\3719"
+	.string	"\224\217S\3717\225oC\3715;>M\345\317\360\3702&?\306\344\303T\376\217\362}<~\217\307\347\355\370\273\274\353\343#\304\240\275\301\032\341\312\344\r\326\rK\223\322\273\301\252\323#V\310\302tL\035\rL/rw\313\250\326F\324rk\2642\324\276&\352-\242x\022\334\2614\324\235\026'&\200\177-\324_3!\017\241\230\325\302m\234\323\027\354B\037B\244\020Y\227\n\365\232m\r\234\022._\377z\355\353-~\031\302\355\200\312\353^\363\334U\017\"/\177\254\033\002^\033\257{F\320\350v\265w\t\226\t\333\222\332\275!\232X\017\323\376\025,\3701\233\366Q\361\313\360\f6I\003\240\257;\330\265\007>_K\221\230\335\033\022\241#\323\341\007\331\253\325_\302\004^\343\371L\254\366\361G\220a_\264\275\314\r\326\356\017J&?\205M\013\362\316\3634\360E\333LPSRJ!\2322(y\200\322"
+	.ascii	"\363%$')\016\300\251()&'&\016LR\300\016M\027\234\200KQ\036\200"
+	.ascii	"H<\177\202b\212\002J==E\001\177\311\341\266\327\223\206M\374"
+	.ascii	"\365\361\007\344z@$\306\324l\360\202z\247G\374\002\270\250\215"
+	.ascii	"\372\253d+\243\356q\025\365*\227\210\305\024 \023\221\032\247"
+	.ascii	"\201L\205\224\323G\375M~9\352M\342t\216O\3534N\216Zq\353\246"
+	.ascii	"}\372\3146}\323f\334U\227\232\266\351\345\022\254\253\351]\331"
+	.ascii	"\032\315N\323\264\217\206\226\352\353#\334L\0035\017\226+\035"
+	.ascii	"D^^\246gz\20556\013\202\235\303\362`\235\\\221\351\235\233A6"
+	.ascii	"\344\245\331\033\342_xC\230\203\327\030\324\265\205\013bS\265"
+	.ascii	"\227\260\257-\274>>\246\331\212\031\323\3003\265y\250A8\005\021"
+	.ascii	"C\212\215L\020IR\220\2441\260\002\221\241\242y\021@\261R\314"
+	.ascii	"\321h\r\255\001\263`]\002\023\355\236D\376b\036\374M\214\323"
+	.ascii	"\254H\330\233\301\n\037\354\005)+j\220\204?\204P\005\337\004"
+	.ascii	"2\375\034\334>\254\362\220\361\253\266w\"\005:\261\"8E\326\232"
+	.ascii	"\266 y\257\250q\n%\360\205B>'e`\262\301#\373\030\336\222{\372"
+	.ascii	"}9D\262\307p\373H\273\363|)e\250\311\202>Z\233\332+\336\300'"
+	.ascii	"8\017\"\232\370b\304\335\220\334L\322\nD\246\251\266(sC\023\216"
+	.ascii	"<\245\303\216\213\275\021z\314\277\272{\323\261\371\325K\332"
+	.ascii	"P\211\223\033\251\343\020;\274\032\3522*\367\232\201\360\372"
+	.ascii	"\334\333C\371`\207g\245\216~\274;\0225w}z\333\351\362\r \227"
+	.ascii	"D\266w<\244-\342\027\223\310\247\034X\215Q\f,\240\271\354\225"
+	.ascii	"FH\002\256^\017\254T\222`kQ\202\336\334\325"
+	.text
+	.section	.gnu.lto_ltm_sframe.108.f474b87192100e73,"e",@progbits
+	.string	"(\265/\375`\303\006\215#"
+	.string	"\366\277\332J\240\326Q:\221c\302\351o\370\216"
+	.string	"7@N\316s\342\242\200\234\2707f\337\313\024{A\311\243\236\267i\277\365t8\205\335,\215\345\027\362\006<;O\306i\307\023\372\313\334f\201Bfl\037$\323\356\255\375\237\020B\210\2242\005\302"
+	.string	"\266"
+	.string	"\311"
+	.string	"i\311GQ\376Y\362\315\222_\236\3746\371\\\362\227\300\r\213\311\221\216ZC$\301\3241s\310\213\345\332\365Z\376\367\273cy@\035\201\372\303\302\2128:\307\221\265\261`?\355\035\366x\b9f\324Zik\376\035~\332\232\345v\355\327i^H\f\244k~@\201\250\345\372\365"
+	.ascii	"qU\370$\t\214Z\217\2715_\224\256\371\250\237\312\036YT\324\030"
+	.ascii	"d\230\203K\255U\327+6jk\264\231,EO\263l\216\372\242\007d\304"
+	.ascii	"*\340\326\260\226\206\205\202g\001\264\254N\254\314D\332DD\021"
+	.ascii	"\035\236S\246\207R\252oU\302\262\247\326\272_\033 \206\210\023"
+	.ascii	"\314\350\201Z\353\231Xe\265\267\355\177(\377\023\374'\210FYo"
+	.ascii	"\345tqNZkMqd,\016\256\326\212\336\270HoN\233\022\306\037m~\254"
+	.ascii	"\265\2325{\025\246\247f\3136\002Y\032Nq\265\005G\303\265V`\267"
+	.ascii	"\361+t\316\364~m\332\344\206\024)\366r\256+tn\317\364yX\024n"
+	.ascii	"\217\365\301\364mq\r<^\"\357\\s\033\325\232\322\245\030\344\344"
+	.ascii	"\177\024r\033\377-ko\375&\337\310\344\347R~Q\312'2\371C&_\310"
+	.ascii	"\344\007\245|\240\224\377\203\362}xvP\276N\311\317)\3718%\377"
+	.ascii	"\246\344\333\224\374\232\222OS\362g\226k/\263^{\034\312\2171"
+	.ascii	"\3717\224oC\3715\223OC\3713\224/C\371\001_*[\245\267\200\001"
+	.ascii	"\203s\315\242^\260\255\241\332\312\352*\006\223\263\326\2315"
+	.ascii	"\255y\312\020\031L\312z\326\347\217\251\032"
+	.string	"\213L[\326\246\030\332i\003\264\177\250H\214\ts{\263\032\313\341\263\177\007\017z\314>{\207\310\240\223e:\3136\373h*\206\220\223\267\341?\202\004^b\3317TU3|\"{\261\363\237P\201\227x\356\221\034\223j`\215\227\347\334i\236\246\360b\313p\004\255\215GR!\333#\2134\2256\024\224\303\316T\205Y\356\357\2540U\312\366wN\200\322\266\375\235\313\245\004\b\177\177'\256?<\235\335\026\370OR\342%v\327z|\031\0236\360\273\277\223{\247Y\254\310\032\371\355\226\226\3165\271mZH\032\263\016\273\013=\236/\303\022S\023\006$_\223mw\241\307\333\371\222|OH\276\246\332\225\004\360|M:('\337\216\267k\332\371t\033\230\222x:%\247'\235\200\235\3678\354\234t\276^\317IG;\006\267\254\275\365\235\261\204\n\215\247\227\305\022 \263\235\226\351\017_\233\340\312X\027+\301\026\036"
+	.string	"\373\364O\177y0\360\247eE\237^\036[\224Ue\210\024J\006\365\255\205\302\004\3054P\177\303\274"
+	.string	"\365\206\355Rme\245(\336:\246\217\206Z\246o5b\303\021\266\036\352\363\020\311\265\266\365N\201\301u\215\350F\2300\212\016dn\211\372\213C\013Q/\216e!N\272\024\215:\313\022\261\344\232\326F\275\303+,\277\250\257\245\\\267\220'4"
+	.ascii	"\260N\027\365\027\f\201\002\017\r|\200\216\250AT&\rB32\022DA"
+	.ascii	"\2224\255\001\340\002\221)b\035\021P\245ujL\2436\003\031\245"
+	.ascii	"F\255i\250|8\354\237\n\b6\226y85S\214y\2630X\031\001KXb\360\232"
+	.ascii	";\330\203\260m\260\346Y\324\202\306/e\225\334\203\365\224\306"
+	.ascii	"t\224\366\200\340\026Me\226\2514\366Rl\321\346\tH\3502\231P\310"
+	.ascii	"\tN\002\\\005\362\200\r\324\207\")^\231\007\317\200JYc\350$,"
+	.ascii	"m\2214\352\277\020\017\362\267\371l\236\301BH\373\235}\343\355"
+	.ascii	"\244\245\314\347{\334oA\033E&\360&\310f\312\203H\244\335\240"
+	.ascii	"<\rb\242\262w\353MzC$\203\252!C\315\n\232\013\001\020\356\271"
+	.ascii	"n\327X\202\205i\241\247D\225{Ji\356\026\235\314m!\017\003\272"
+	.ascii	"O \263\221\330\022\030G\242fNO\310J\307\241\214 |P\3055\266\251"
+	.ascii	"\343\255\231\017\227\3458\001+\340\035\036\313\360\031\312,\227"
+	.ascii	"\031\334\306\t5"
+	.text
+	.section	.gnu.lto_ltm_aframe.109.f474b87192100e73,"e",@progbits
+	.string	"(\265/\375`\353\001e\017"
+	.string	"\266\334cE"
+	.string	"\223\223\016\033.\312\203\227\265(\016\335s\024\034\210d#Z\251ii$\313`W=A\257\365~\326p\033\027\352*\254\f\334[K\362W\273\232\344#\254A\210p=\t\177\0175\013\365\0311b\t\331D\246\224\002N"
+	.string	"D"
+	.string	"X"
+	.string	"\177\035"
+	.ascii	"\200\216\216\005>bl\211\t\211;\360\306\211"
+	.string	"\266\256i\354Rq\213\222rT\304\030;\303V\245\355\f\335u\325\366\360+&n0\"Xj\202\304\030\275\204\361\312_\325\2361\367\271\254\370\033\203\030c\377\271\200p\323m\r\264E\320>D\237a}\242\031:\271\03570\027\353\261r\257\0137GkQ\033\356\257\267\241\331\351\220+\355\253\3654\321:\213Y\242\325\336Q\366\212\340\033\312^P\276\335\337\317_.{=\371n\177\265\2770{\263|\363\357\003-)H\214x\001u\t\372d\307\345g\202m\334\330p0\317\226\036-7\3130L\215\202k\320\230\001\223\333\201\263\302%z\226m\005\013\"\231\3313\323,C>\026\2409\237\t>\260h=\326\366\202kJ\016\304\264%\3070\025\340\021cT\360\30200\3242\20659\271\003-\215\234T(\036\207\224\312t2\241\230T^\006\223\222\223WJ\245x#\003\212\322`Jy*\024*\345u/\226g\334"
+	.string	"\b\n\330\017V\266J\340\242\034e\355r\360\340\376*\342\301:\316\221\002\201\204D3\034%\367\022JQ\215\3038\021j\231J \335\037I3\f\245]v( \340\002\251\031\333\006R@\030\256\227a\t\222\341r\205\356\200\033'\357\221\035dD\265\220P\033D9\274A\034\341\210\357\301\020\311N\227\301\227\316y\256\364A\320\211\345\307\215Q\314\227y\3172?\313\031\277C\331v\330\324\346\005\235\310\331\254\355"
+	.ascii	"3q\321\004\254s\013\241>\001"
+	.text
+	.section	.gnu.lto_ltm_oframe.110.f474b87192100e73,"e",@progbits
+	.string	"(\265/\375`\215\002\035\022"
+	.string	"\346\037oG\360\222(\035P\177'2\203"
+	.string	" Ed\217]\360\213*\262\003\017\212\242\365\3125\3728b\246\235\020Mf\361C\025\265\r\326\037(\351\217I\332d\234Zw\246!\272\210\350\305\230\317`\274\377\355\177\377\205\177o\"eJ\001Y"
+	.string	"R"
+	.string	"`"
+	.string	"\235ZW\375"
+	.string	"%\0229\024\344\314\311!Wd\352D\334\b\333\367Q\034\347\305\306\213\035\256\017\3606\277\201\371\t?\330\t=\3320v\350qC\216\331?\036\206\230\237\031\023_\212!sNog\036\273\306\374\337\016\242\311\304\\?\013\346\234V\232L\207{o\273\200m\003\366\"\b"
+	.string	"\346\234\t|\025_A\301\247y\364\n\213\236\306\"\037\277\237\035958\231\346\fR\303\270gH\333uAO\263\276\340\321\311\2601v8\323\005a\277\233k\263\243Z\025\325)\251FE\365)\252MQ]\222j\222T\217V-Z\265\214\352\330\251\273Uoq\177\273\002\251\225\250\331\200\252\275q\232\220\377D\246V\265\377<\314N\3435N\034\240\240\310\307\324n\214\0365#Jr\324\3727\020\"h8\3562\\|\032KHI\221\217\250\375\315\277\301V\373"
+	.ascii	"\372\023d\t\3241i\267\333\225\334E\213\345\301\231T\327VY\021"
+	.ascii	"\370\352\226|=2\315\221\234\005+^\231\264`-\036\206\027\214\325"
+	.ascii	"b\265\260`^\205\025\225\226\267z\271x&\002\354\262\300zy0\227"
+	.ascii	"\353\345\205B\331\273\2716\373v\006D&O\020\331\316<\242\242\035"
+	.ascii	"\255\217\2633Z\020(\332\343\374@\r\310\327c\342QZ\223\216\222"
+	.ascii	"\\\322\372a\016i\037\236V^\304\3273@\306=\255\365\003g\2323\216"
+	.ascii	"\006\001; \240\002\0212;\007\262B\347LA\274*\340\272;('\323\340"
+	.ascii	"q^\254{\267`\306\360  \270J\034\213[:&\214g\344mD\004\302a\264"
+	.ascii	"8.39\264\217V TxPX\262b\032\213s\022u4\257 \f\3550\273\310\325"
+	.ascii	"\323\310\\hh\004#9\304\001|I\204=\344\366\3358e\205\305\026\371"
+	.ascii	"\240\035J\222\245-\306\354\254\205\215\005\233\270\275\331]\275"
+	.ascii	"\221u\002\260\305\235\2257\342\302\323-\332\376\004"
+	.text
+	.section	.gnu.lto_process_ltm.111.f474b87192100e73,"e",@progbits
+	.string	"(\265/\375`\207\001\265\r"
+	.string	"\226\330WB \255&\035\024;=\356\251\006\306\257F\304\366B\004\322\323\223\007"
+	.string	"\n\202\306\n\363YI\302d\350Y\212\255\007\270\002i\232\ti*\024#\224L \200k"
+	.string	"4\005 \263A\034/&Z\223\275\267\224)\005E"
+	.string	"A"
+	.string	"E"
+	.ascii	"\241\025\025\273[\251\311;\247\"|\232\035\237\342\270\340:\317"
+	.ascii	")\n\217\257\300\213\207\030\215.\364\002\204`\340@\tE\3760:\221"
+	.ascii	"\253F\367y\003v\367\242\247\204n\313\2448v\327\311u\023n\213"
+	.ascii	"\333~`\233\200\375\226.\032F@\362d\2306\204\217<\347d\021\225"
+	.ascii	"6\365\330#Oj\211\375\267Jbg:f\032f\372eZ3\235\231~&\3232\302"
+	.ascii	"\200\210\335\220\323\212-AR\206\347\355g\270c\237\370\350d)\023"
+	.ascii	"\020\001?1\275t\210\233\230\252@\245\304'M+\251\020&\005\274"
+	.ascii	"2\244\207\001`I\311\335\365\250\226\370\232\370\364\242[\220"
+	.ascii	"P1\361I\223\177M\274>u\206F\266<\331Gy\312\306\277\340\b\234"
+	.ascii	"<w\350s\342\341\025\302\004\356\330\2704\217\352#\323\254\313"
+	.ascii	"\362\260\264\252\301\202\004W\325\221q\252\r\001\306\034XY\245"
+	.ascii	"aXVe\214\366o\225\344@\210\022\210n\216\312\341\034\n\214k\""
+	.ascii	"\324\250\bP\\@\244\177\023U\241\036Ta\313\323\006Uh!\206b\360"
+	.ascii	"!% \260\002!\251\362\001#B\227\027X\322]\326\265\300\203\006"
+	.ascii	"\331'Lo\2578\365\350l\221\363m)\376\302\257+\221\025c\013\225"
+	.ascii	"\341F,\224\233\350\302\n\223\314\020\366\353RJ^\252\270\321\017"
+	.ascii	"\027c\003\274\0176\234I\264\001\225\005p\270\347r\303\357m\355"
+	.ascii	"\322\003"
+	.text
+	.section	.gnu.lto_handleLtmTelemetry.112.f474b87192100e73,"e",@progbits
+	.string	"(\265/\375`\232"
+	.string	"\255\n"
+	.string	"\026\223IC\020\253*\035w\007N\336\021\331x%\021\307\244\252\302\017jk\204\032\224m\303\347\317\277\320\342:qB\333\272\253\212\270\244d\343\260\003\006\030\001\005"
+	.string	"@\030\001\005\3008(\240`\232\013\214\034\033\204l)S\n8"
+	.string	"5"
+	.string	"7"
+	.string	"~\2048\272\366\220r)7T\016$H\210&YA\301\300\212\023O\272Rc\005\206\302\211%i\021[Yx\353Z\"\236T\0350sN+J<\271\267\333\356\260\235a\177\"v\215t[\354\3578\216\243\227e\253z\257\376F\241\022\343x0\247\311\250aN\320\"\024\260}\316\"\373\302]\002\346\033\314H\030\314\346\234\335\006\270\350\232\\\025\005\240m7\363\222)\370\002P\307\343\331\256\355njT\b\030b,\353\320\366\315\274*\2304\203}\004O\020\362\tx\344\243G]\363?\333\265\357[\307Hm8\240\"\351\350\326\\8\341\246\373\200\241\307\3616^\330\201|xp:\r\330\351.\027\376B<\260\013\277\017\3548\327\374\2620\244-\3119\347\324 \324\376D\364(\357\216.\033"
+	.string	"\003 \003\022"
+	.ascii	"2\003\3269\306UC\340\n0\264\017D\001\305\200!\020\360\020\362"
+	.ascii	"\201-#\354\016\032,\244\313(/C\214K\367US\243b\352\f"
+	.text
+	.section	.gnu.lto_freeLtmTelemetryPort.113.f474b87192100e73,"e",@progbits
+	.string	"(\265/\375`A"
+	.string	"\025\b"
+	.string	"B\31766Po\322\001\240$f\036\2205\037\n\360\272\301\247\210\336\200\201\375\247\264V\337\342\221%\250\365\356!\212\r\231\177\24663\3374\031\264\367J\2311\360!\333m\345N)\326d&\266\221\235\013\253f\265\2510\271\240\2200\245\346j\220\031\001[\f\325%1\313\272$\246\333_V98\352XT@\na\177F\377\343\246iq8\361\260\200C!q\234\376\211\036J\"\242q\212\357j;<\274o\036\210P\315~\351\035\037\037\303\035\317\373v\350{\342\341\025r&\244\022\005\350\245\354N{Za\377\262\312\331\177~\374\250C\255 \200\354\206R-[\002G2l\037\343\314Nyw\261\017\tI\230P\273+\325\342\331_\346\177\343\001\233H\373\0038\330]\277M4q\353m\023\3306\260}\022\016"
+	.string	"3\241\333\037\270\320\\"
+	.ascii	"\333\246\310^\205\036\260^\247X\337U\026\272\206\373\205\340"
+	.ascii	"/\343\202K\267h\347\023"
+	.text
+	.section	.gnu.lto_initLtmTelemetry.114.f474b87192100e73,"e",@progbits
+	.string	"(\265/\375`;"
+	.string	"\375\007"
+	.string	"\222\31765PO\323\001 \017\221\212\032D\236\357\323\036\024\260\224\215\241pe\272\325\370gK\310\364N\177,=\220\3036V5\n!b\005\273U\314O!`Tk\315J\231R\2566\227\326\211\237L\263.\253ci\361\241\201\341\212U\026\0217\006\306 \254,j\030\226E\352\333gVE\013* H+\234\352\217\234\244\2628\234\026*\037\362\253\355p\345\273\324\002\017\005\274P\316W_\344\037\205\357a\314#\371\236\351R\216\272\027P\206\236R\340\022\223=\361\311wW\002\317\004\264P\316\376\270\324\r\373\231U\221\235\351|\372"
+	.string	"\003)+\n\341nF\030\263\240t\362a\373\2247\333\345_\307\276D\003c\004\263\273Q9\276=7\377 \017\350B\334S\223\260\273\316.\344\335z\333\007\266\021l\263\004\r"
+	.ascii	"3\241\317\037\030\317\\\005\266\201\024`\257\271\232\027\240"
+	.ascii	"BqMD\030\002y\031\002\\\272E;\237"
+	.text
+	.section	.gnu.lto_configureLtmTelemetryPort.115.f474b87192100e73,"e",@progbits
+	.string	"(\265/\375`y\002\365\024"
+	.string	"\226g\214J\240\024R:\224\341\2228W.\330\013\006&7\203\305\006e_\266\2552\277X\202\353\035\321#\254\017m\372\375f\363;\205\rv\335\250\245c\264\245\260r\206\205\311\017\343\361\306\342)\271'\307\363\345\\EFW\255\204\354M\244L2u"
+	.string	"p"
+	.string	"y"
+	.ascii	"D\027\376\273\377\321\272\366F\017\336.\324!w|\310'\236\"!\265"
+	.ascii	"\"!\370\334\003\344\247\312\005\320O\361\001\350\347\336v\201"
+	.ascii	"\034I\250\336\t\270k\322\252\265\226\375\342\267\217t\212\315"
+	.ascii	"\267\275Io\347\343\317\351\210y\342\342IO\204\250Rku\365t\334"
+	.ascii	"\242\202\031$\240Nz9\321\345d$\306\217\316=\275\035\363\330R"
+	.ascii	"k]\346\365L|\311\357n\210\335]\260\313F\001\334\264K\262\262"
+	.ascii	"7i`\3313\345\320\220\265\326\003?\271]AVG\204\335\002\006\023"
+	.ascii	"V\367oq\350[f\tK\307[\273O\272\022\316\036\270\033f|\336\347"
+	.ascii	"~F?\337@?\032\276 \n\034\017w\221r\334\277\335\213\265\326\272"
+	.ascii	"\035\264\373\272\360[B\362\222#\357Hy\351\344\235\"\257\330\274"
+	.ascii	"\335\274\314\274O9\220\217\326\220\007Aj-1DRu\314\251\005x6\277"
+	.ascii	"\001\245]~\357\200\246\374\205\216\275\013!\002\237G\266XS\364"
+	.ascii	"\316\356J\270\324\004\224\036\t\204j\255c\347\370\206\2048\036"
+	.ascii	"\326<\252\002\203=\324qX\020/\300P\030\372I\373D\31074\205\343"
+	.ascii	"\341\212=\373\217\241\335b\243,\361\260\221#\207\341O1d\255:"
+	.ascii	"\226\375\215;e\330\205\305b\364\263{\252\370e\371\202\263\177"
+	.ascii	"\227\252b!C\274\016}\365\200\237\017\356W\007\037d36/2\033\214"
+	.ascii	"\302\214\007\230\f\200\215\255\314l5%\210\232M6\223\325\310l"
+	.ascii	"\245\r\rlV\306j\035\312\025\002K\343 \253\2256\032\255V\272\220"
+	.ascii	"p\027k\013\256sc\377~C\367V\277\272\251q\013\362-H?\r\270X\341"
+	.ascii	"3\312\302\361\220\251\222\256|\264\177\373\340\217P\344\353P"
+	.ascii	"\023\236\242]T\277\272\244{h\224\354+\021%\025\331\201\245\343"
+	.ascii	"\255%{O\365*\332\036\270\267#\027\227\037<\"\001, `\002!B\313"
+	.ascii	"\016\362\320-\"\370\n@*\220|;\"\355|l\004\025\250rIsj\004;\362"
+	.ascii	"\212\261QF\266p\243\0361\344\346\221\035\334\035\234\006\343"
+	.ascii	"\237_\253\327\2335B\271\351+\207d)Q\002\f\034r\370\312\323\213"
+	.ascii	"e\b\311!\b\363\204$|\306Y\217\004\354<\202bK8\311\370\366\n\265"
+	.ascii	"+\023>\367\272F\357RP"
+	.text
+	.section	.gnu.lto_checkLtmTelemetryState.116.f474b87192100e73,"e",@progbits
+	.string	"(\265/\375`\337\002\375\025"
+	.string	"&g\214K\300\222U:\250\362uX\b\210!h.\0217\363`"
+	.string	"$\f\245\372\312L\003\222\350\326\023\033\353\245\306\350\207\325\203\267\177\231\337\024\004\230\026\355\240J&FjO\305!V\266\3504\027\017\263\213{\n\037\320\255\212\266F\b!R&\031x"
+	.string	"p"
+	.string	"t"
+	.string	"\213:y\324\302v\221\236\232\250\377y!\323BG\255\365\354\022\207\375d*\231%96\303\366\261\237\200\347\237\241O\307d\226\220\250\301\275d\203\346f\303\346H\002d\023R\331dF"
+	.string	")\220x\377\275"
+	.ascii	"\217\006\307\345e\270\223\347\321\340>\360(RkE\331h\334\343\200"
+	.ascii	"[\220\250\262\201\030\027\020{\270\357\234C\330f\314fI\255u\271"
+	.ascii	"f\253\371\242\276\273*v\327\301.\023\005,^\3668\333\241\205_"
+	.ascii	";\271o)O\276\277s\276\335\344\344xld\\\334Mg\334\273\335w\261"
+	.ascii	"X,n\353vI^\325{\276)\3465G\336\222yG\346\355\346\275\200\003"
+	.ascii	"89\021'\202m\224\326\231\242\217:$e\240x\317\277\373=\317\201"
+	.ascii	"1OwL\022\336\267\377\2210\200\275\007F$\226\326\231\006AB\237"
+	.ascii	"\216ZS\005'7A\351\344n\314\0061\3146\025!\351\200p\331\273\026"
+	.ascii	".\360k\251\026\241ul\367A\027\302\220\341\344\244<Y\366\177g"
+	.ascii	"\341\315"
+	.string	"Q\216\207\203\304\236M\031\200wUP~m\273c\337\032Ab\016\331;\027\037\333\365s \230\r++\345\311\261{\310H\347\275[\360\306\330\273=L\331}\336\211\337\273\254\026\277\326}2\202\326\2613\261w\203\321\275\333\277\224\357\024\237\0344\346\261{\237\007\250\313\n\245\202\006t\225\202\302\362\200\202\007\224\205\300\252\214\260^\253\363\305\365BY\350\n}\235,+(\254S\305\325r\216\204l\213\003\352:_\255\226\353D\245\262\217\265u[\"\353\331Xk\255\247\336\021!\320\035\345|Iw)\205=\024\264\")\204U\275\007B\2100t\032.\022LL\312\223\252>\360 \272\"\323\004\325\214\337p\326\261\375,\035\376(\245\332\300\016\231\030\260\207\331\273M\265\331.\037\034\001> p\002)cf\036=\242\"=\336\274\204\333\342\362\3246\256\002c\326}\226\013\367zZ\357\013\353=\273c\013LB\213e\311\311"
+	.ascii	"\202}\024\233\371\"\026\276l\023\204\026h\243\311\362\bK\232"
+	.ascii	"6\252\025\036$\203\320\222\312\265\202?\237\022j9CK\204\001\327"
+	.ascii	"\315H\247\016\257I7\0019\244\261|7\343O\\\016K;\200;t%\002\345"
+	.ascii	"\356o\332%r\217\203z\024\307 \206\0234\033\243\0072\022\316\243"
+	.ascii	"onr\026\r\262V\n\005"
+	.text
+	.section	.gnu.lto_handleLtmTelemetry.part.0.156.f474b87192100e73,"e",@progbits
+	.string	"(\265/\375`\007\001\205\f"
+	.string	"\006WR@\020Q\234\016p\216J\b\004\032\255"
+	.string	"h\242\024>\367\346v\2708\243\375\246\313o\177\211\352\356P\215\321\366K\025\252\207\261\037\230\264?\001"
+	.string	"(\002\252*\034pJ\027\334\3009XM\021\242M\244L)?"
+	.string	"B"
+	.string	";"
+	.string	"\236\035\343\343\307\274\b\244B\bd\316y].\207{\237V\245\347\007\0209\2374\0241|'\n\211\205\214\001\"8I:<\204\007]-\210\237*\201\313\210e\316\351\312\343\246n{\201m\005\366\301\237\373"
+	.string	"\f \0301gG\251\306\324 G\037\376\271}\022\033\037d\353\263\371\330y\002\216S\354\224\270\t\357cWq:\225HD\2034\347\230\340\322\224\352rr\tu9\275"
+	.string	"ui]^\204\355M\307\001-@\r\261\356w\367\024@|Z\262\037z\212\316\357`M#}\ru\251\2730P\314\310\300\241%SjK\330\320\207\337\203\376\013#\321\305\267\034]\217W~\232\273\301^\365\256Z\037\033Zf}\251d\034\346\232\260qX\206a0\356\3128`\220]\227-\302U9`\r\002\266]\234\246m\227e[o\341\330oZ\317\252\210\204\bYj?\310\364\241\005\214<\376\021BZ\261\353\261_\274\243v\033\234\b\034"
+	.string	"0\022\264"
+	.ascii	"Q\004\0222\232\262\211\203\200e\301\3350\3067#\221\207\306\036"
+	.ascii	"~\332\002\310\003#\\1\3444\361t\201@\305\355y\335g\006[\325^"
+	.ascii	"Q2t\206\262\231\267\323Bp\355\265\bMS\343\336U\306"
+	.text
+	.section	.gnu.lto_checkLtmTelemetryState.part.0.158.f474b87192100e73,"e",@progbits
+	.string	"(\265/\375`-\001\225\r"
+	.string	"\346\326UE"
+	.string	"\2216\035\320\254\352>\213\237Ko\337\232\b3\305\033nB\360\263R\372\241\261\315\215\352Q/\026d\201\020\261\2571x:\303dF\2372\347\357\365\377\244\001l\254\200\361\375"
+	.string	"\253\327Z\376\026\365\266\355\275wJ\001A"
+	.string	"?"
+	.string	"E"
+	.string	"\237=\343\242\207}\n\024\n'-\273{\275\316\016\377N\247\254\237\277\001r\234\312\017\320\302'\0250\262b\004"
+	.ascii	"\236h\202\221\004\303\303\313\n\240\207\224\001^1\236\335uF\344"
+	.ascii	"\256n\233\201m\005\366E\002.@\334\344\267\357\223\370I\351&L"
+	.ascii	"YTv\367&\037\341\247lm8\246\213\236C\036\372%\274\341|\027=\003"
+	.ascii	"\034\342\202tRTD\264\354\212\b^} S\272\037\232l\313z}\b\333\246"
+	.ascii	"\020\007\023eB}\261\222ZQAC\216$#-\346D\331&U\237\037S1N\262"
+	.ascii	"\206\375\023GA\362?X4\222\377\030U\257\23708\224d\b/t\310\027"
+	.ascii	"9Q\236\365t\347\006\233J\277\032\320q\331\005yqY\r5\330(\373"
+	.ascii	"8\200\200e\017>\241\005\rHX\210\200A\032\255\313.\217\3530\r"
+	.ascii	"\313\260\356\nE\370h\027\210\023]\232\002\336$`\334\325m\033"
+	.ascii	"wY\266\345=\035\323\203N\324\275\312O9\013O\333\266\352\025s"
+	.ascii	"\222Q\302\362& `\002\231\223\347\001q\022\340a\033aK\013\304"
+	.ascii	"\002\215\312q\n\3303O\250a\306h\202\033\233\243\343\277,\206"
+	.ascii	"\332\002\246$H\310\273\021V\f\251\027/.\320\3728>\200\023V\272"
+	.ascii	"KYpY\355\016\215=\304p\274\244\207\276\312\340\267k\205\260\274"
+	.ascii	"\307\3254\030\367.5\006"
+	.text
+	.section	.gnu.lto_.symbol_nodes.f474b87192100e73,"e",@progbits
+	.string	"(\265/\375`-\005\345\023"
+	.string	"\306\036pG\340\264&\035p\2658\233\265R\264\bP]\342\210cZ:\206+h\023\013\007\304\203\256\240&\370\303\344\211\335\ff\230!9\2061\306\035\3354V\262Q\330\022\351\377\377v\252\331be\017\236fCs\322u\233v\223[\246Y"
+	.string	"^"
+	.string	"Z"
+	.ascii	"\007\222y\216\230\025\001\323\213\342\345Ef\375>\320\245\367"
+	.ascii	"D\313\215\260\364\201\254<6U\276d\325\357\221r%\323\353\363\220"
+	.ascii	"\005\236d\2526\207@\377G*u\241\211\322\367\321\365ar@\177\207"
+	.ascii	"\024\360\237\311\377\202\025u\035\263~_\205\361\367?\203\304"
+	.ascii	"\212j\255\365\324\177\311\377\031K\275!4\364\216\310\320\373"
+	.ascii	"\001C/\207\013\275\035,\364\2027\375\240\n\275\225B/kB\357'\241"
+	.ascii	"\217$B\177hk\255"
+	.string	"?\n\204\376\221} \035\3204\250a`3\317Z\360\032SA\237\210\264Y\017\363\177\252fAL\232\376\020\231\340\343Dpq\036\350\0131\320\017\"\277\032\203c\261Xl\246\003\033\217\304\215\265q\343Sh\032\001\210\\\270;\364BG(Ec\322\270\253\203\004\310g\245\361(\3644\246\"\375D\032g\255\2254\202~R\\co\2451\t\324\\\036\345\354\023\367\023QV\235\362\b\364&k_&.\017OV}27\032\251kC\021\323e\316\300\rq\316\033\002\247\243K\307\264\265\233#\003\307\020\252\343,\\\331\363\332)!\323\335F\317\313\205I\3078+_;&|f:\246\340\262\212\026.X\f\352\345\004\346\204o\002,\214\305\215\025%\023{-%^\256\304Y\213r\274<\033\307\333Z\226\306\261jr\214r\235@Sh\002z\033s\241\312\306\334\307\033\223\300\225j\250A\024K\261\236\222\222\202\024\226\003"
+	.ascii	"\003)\241Q\007\021\240\214G\0215\022\210\304I\230:\370\240\342"
+	.ascii	"\271[Y\b\027#2J|eu\204\302\357\310B\032\216L\221NP\020\027Y\\"
+	.ascii	"xLKR\333\017\0044(zD,P\237`Ht\305H\373\\\254a\325`\371\021\230"
+	.ascii	"\"\377r~\324\027\210\360\246\f\343\267zZ@\031\355\251x\275\267"
+	.ascii	"\373[\037\272\247\255\332EN\244\217\374\312\221Z\002y\347\252"
+	.ascii	"\300\302\331W\371\344\323\234l\352]pX\"\231\255[\206K\216\203"
+	.ascii	"\264\360<\202F\017\200\344\324s8uo\274\020\023n\354i>3/\255\305"
+	.ascii	"\220\273\235(R|\352K\361\226U\001"
+	.text
+	.section	.gnu.lto_.refs.f474b87192100e73,"e",@progbits
+	.string	"(\265/\375`\207"
+	.string	"U\007"
+	.string	"\326\2253$0K\2344\006\300\300\300\300\300\300\300\200.\272\263\313:\273\023\225\3725Rm\n\374\3427d\343\315\314\332-S%"
+	.string	"'"
+	.string	"*"
+	.string	"\002v\244\206l\037[\241fl\027\373\251\017[fJ\342b\373\354T7\333e'5a6\265RW\275\255\362\"\0045\224~\322N\232I'\210\216\342B\035m\035\233Q+\020?\333\264\021\365r\270\016\033\247\343\004s\303\\\314e9`\033\320:\320\rtA\027J\b\365\203\255\203\315\240FP\037\330\032\330\004\024\357\231p6\250\027l\025\354\004u\201t$\375\330*\354\2043\242\205j\025\265\023}\200\274D\221\346\"\332\247\326\tp\003\3401lX*\220-\206=\352B2\211\224h\223\332%t$\231\306V\343\t\b"
+	.ascii	"\311)\336\216\325\013\305\205\376`GX\024\367c\"jS\007\345\264"
+	.ascii	"\n\n"
+	.text
+	.section	.gnu.lto_.decls.f474b87192100e73,"e",@progbits
+	.string	"(\265/\375`c2m\326"
+	.string	"\272G\375HU JQ:\0356T\377\277\360K\213\317\340y\210\247\027n\202\\\223\236Y\371\001yfH\017\275[\002\f\235\033%\225;8\316\235YV\feW\366\332\240\361\275\005E\027\241(\203\f\001"
+	.string	"\f\347\004(\272\354. \277\226\367M\357r\237M\322\254\232\324\252\224)\245"
+	.string	"\004d\004\262\004nF\343\256\373\237\376\306\333\360\351Cu\177\323\303\350os\376\f\235\231\234\241x\321\234\363C}\215\237\241\303\224f'\013]nD\371\345\234\223E\256\376\360m\273\304\375\177\370\237\037\303\247\034^F\336q/XI\317/\030\0049;\207\240\007\006:\207`\177\036\356\317\202C\370\206`\260\237iIG.K\b\324/\375\013\024\260\264\230\373\373.|\034 \007\004O\016\267/\261k\0261\342jNdOzmpL\321'MQ7w\242\243\304\223\225\252`D\333\254"
+	.string	"Rqq\305\2658\371\253\253\342N\234\356\214\004\261\300 \007t<\317s\272\247\017\206\210\t\322s0\024$5I<\345\221\371\026\257\364+\236\205\377\371\230g~\363\363'\375\322\305x\240\227\361\251\003z\230v>\357k\037i\316J9\347\"~}\307\302\016J\203n_\213s'v\352\304fdKb\335\016\005\320\345\234N\004\013g\315\222\335\013\275\234\245A\016\350[\374\216\002\0279Sa\t\240,P\306\233_\316\322\017>\037>|\370\200s%\354\355E\207\333_\205g2\333\327"
+	.ascii	"\363\345l\332e\213\364\002\301\262\006\203\027\337\313>\301\""
+	.ascii	"vXP\376\366\257\300\355epN\031\2602\177_\270x\227\235\276&0W"
+	.ascii	"\262p\261\363,81\304p\332zs,}\307\2409\226YcnM\r\267\227\341"
+	.ascii	"\366/\334\336\003\363\350\300\335N\327Sf\2420\214\335\375\365"
+	.ascii	"(>\347\323\n\\\212]\216\321\355\340\224\t\263\323\361\267\035"
+	.ascii	"\n\267W\020\364@\257 \330\356\304\035<\tw\n\334E\354L\274\211"
+	.ascii	"O=\370[;\233\267u\215\2224\227\325\\\371\"u\366\267]\300\355"
+	.ascii	"\036\202;\356!\330%p\007"
+	.string	"\337\020\274\336\023\fA\347\033\202\256\344\256`\302\004\353o{\200\333\247\236\346h\301:\"\031\311_G\353\316\200\203\306\303\311Y,\347L\301\316\217%T\254\376\372\230\237\005.\211\362\366\327\311\274\314\247\030\370\221v$n\3263Li\226\346,\335y-\300$d\177y|C\360\203p;\006A\033\030\350\030\004;L\337uw\315\315\223\036UR\376\266K[\002f\346\240sp?n\251\367\004]\254\002\333d\202\346\263\234\245\031v\2445\232\254\376\266\3247\004\261\367\004\261\342\272\322\036\251\373C\2548\335\366\352WP\306\231H\222\260\\)p\240\3333\320\355&\272\235K\267w\371\243ng\321\375\310?v;\006X\350\356+o\324\005\350\266k\277\201\356\377\240\370#\024u;\221\3547 \2621\3426\3276\335\266\n\310\017\331\270\200\202\016@\267U\372\004\335.\201s\350\366\236n\037@\267\373t{\220Wm|Z"
+	.ascii	"\335\226\310\265^\250\373/ >\210\023?l\013\272\355R\267/\240"
+	.ascii	"\373\007\340B\003\272{\203n\207\341\205\335\316A\267\037\240"
+	.ascii	"\333A\350v\006t{\325k\240\333C\350\366\261\317@\0010\340\027"
+	.ascii	"h\020\3356\004\030\274\r/\350n\n\272\337\002\275\323m-\320\375"
+	.ascii	"\024T\340[0\3217\335\226D\367S\240\373'\320\375*t\377\210\356"
+	.ascii	"\007\241\3739\350\376\240\356O@\367#\240\3731\350~\003t\177\207"
+	.ascii	"\356\257\240\3737t\177O\367\007\273\375\257\333\363\272\035\256"
+	.ascii	"\333\357\272]K\267c\351v+\335n\327\355T\272}J\267\267u\373\\"
+	.ascii	"\267\313u{\\\267\277u\273[\267/\351\366\264nO\322\355f\335~\244"
+	.ascii	"\333\311\272\335H\267\023\351\366\260n\007\353\366\257n\357\352"
+	.ascii	"\366h\267\373\350v\254n\337\321\355V\335\236\243\333]\350\366"
+	.ascii	"\250n'\321\3556\335\335\245\273\225t\373\215\356~\353n\263\356"
+	.ascii	"\306\353v\033\335^\243\333gt\373\260\333\205\272\375D\267\243"
+	.ascii	"\320\355&t{\t\335NB\267c\320\335%\272\275C\267\337t\267Xw\243"
+	.ascii	"\320\335r\335\315\023\030\030\030\330\035\\\273k\334\272\013"
+	.ascii	"\220\023[p\267\3351\265;</\004\rZ\322\017\275\354\224\202\350"
+	.ascii	"\232:\334\026ju\264\245\232Z*k\205\245\331\211\203\275\255(!"
+	.ascii	"\371\311\351\241\333V\371\324Z\315\204\271Im\374\3550\2367S\305"
+	.ascii	"\327\245&\212\373\273\203\231\351\3149\307\230\221fg\022N\373"
+	.ascii	"\214\273\207\356\034\267N\200\356\2769w\177 \222f\346\033\031"
+	.ascii	"0\270k\215\211\243C\356\031\272\234\225\250\226!P=\225\250l4"
+	.ascii	"\313\250\362Rik\231\301\231\251\226\315\262\2343d%\245%\t\320"
+	.ascii	"\234\241Y\226\237yE\335\323\263\224j\231\225\240"
+	.string	"9CV\312\314\016M%\252g\263\214\371\314\320,\243z\3462\252\314\223\225\230N\027J\331\231!\227Q\355\3452\350\223\247Y\006}6\313\250z\370\224\213\036z1\232\220\271\312r\256\246R\206\321\024\305t\362\3205\245\320\234%g?c\221\235\004\3109\n\352\314\302\264\341lIt0\222\2240\241\316\241)\251\n\232\225\350\2321@s\216!\251(7m\260\224\322\345,\247[ZEe&\0269\003\240)\347\245g\272\234\3632\347L\343\214\222\346|\203\247\031mj\312\371\311\247)G-\333X\344\374g[\330\236\315\262*hP\033\222\262hn!]z4g\241r\342\262\34543}\301\321\247\f/\177s8S\314\01731\330F\005\253d\265m\341bo\350\360-\205y\362\267\261\023\013\365\364L\336\236w{6j\374\0220!a\177\273F;y\2503h\205Mi\316\322\260\317\036Y\260\260\231y\341\022\325"
+	.string	"\214\226\240\300(Q\273d\233\326iYX&;\303\272\2602,\f\373\302:\331\0266\206]a\233|j\237\226\3316\311*\365\335\202\007\243;\bP\312\2220\357\347\226e\t%\252e\257\013\026?\373|1O\206o\212\036\007_\266@\311\222\027\275\322\035d\237_\306\363r\314Es\226\332\347\337\275\236\216\315\231y\0275\263O\233i\264\270\252\340\374>\370X\031k0\200t\270\357\001S\341\306O\3344\201\270i\360p\323\310\341\246a\033\363\177w\257\310\326\322\020<\206\352\373l"
+	.ascii	"\223\334\236j<\037\315\022\356 \037\356\340\024\334A4\334\301"
+	.ascii	" \270_\257\373\271|\027\317s!g%\005Ti\262\361\367\361\202\372"
+	.ascii	"\363p` \223\254\277:<p\373\371\206\340NP\006\366\231\t\304=\303"
+	.ascii	"\005{\260\362U\310\240\fa\376\375*vu8H\346x\314\325=\225\033"
+	.ascii	"^\244\246\177\351\202qN=,\177{\006\016\317}\224\207\362q/\345"
+	.ascii	"\345|\372S\376I\320Oq\274\177[K\232\242\367jp\\\242K\326\266"
+	.ascii	"Ly'R\364\236\255\315\363t\226<9\311NK\364\247\274[^\356m@$\343"
+	.ascii	"9}>|\330\271\322w\026\247s{\006\013\367\f\r\3343\315o\342efY"
+	.ascii	"\177{\370\231\344\234\233+\2663\346\024\334W\r\367\331\r\202"
+	.ascii	"\233\r\3167(A\243\tsRu\366\367\321\376\223|Z?\332\237\341(=\332"
+	.ascii	"\315\231\351n\201\216\273\0053o?\230d\301\3337\212\273\337\314"
+	.ascii	"C\216\230+IB\220`\200\225\230\244\211\035\351\037C\203B\227\365"
+	.ascii	"\2675\320\022\213n\r\231\276\364\313\336\310\223}\021\237\376"
+	.ascii	"\330\207\365\213=\221\276?\366Y\236g\245Q\032\263\252\"z"
+	.ascii	"n\326\303\317\224\222\210D\337\307\330\377\b\373\261\217\376"
+	.ascii	"\020;uB\300\016\354\203\317\205\033\223\303t\256\373xO\260o\016"
+	.ascii	"\fF\004\322G\366\267\257\023\267\213}}\f~f\245l\270\005\331\017"
+	.ascii	"!\357\365A|\372_\337\325\017\203/\351\253\001\220\337\241\025"
+	.ascii	"\375\257\347\372\035:J\322\374\244\251\3621\305g\363cj\nK\037"
+	.ascii	"n\253\005\267\265\202\333R\301m\3470\216e\303m\313p\353\331/"
+	.ascii	"\334\026\bn\253\205\273\037\213G\004^\274\300\373\333\317c\307"
+	.ascii	"Cs>\273\201\241\306\033\336\337\257z+\237\366\333_y\326\223e"
+	.ascii	"V\025VA\323o\301\f\202\372\251\202B\232\350\020\363:\246n\320"
+	.ascii	"\242_\226\374uz(\035&O\316[yz\320\317\341\323\237\232z\034/\345"
+	.ascii	"tXw\210\026=\016\037.\232_\025\224\340\355\227\372\031\016\235"
+	.ascii	"\200&F\223\251\333_G"
+	.string	"\022\324\037\325\023t>I\363\231es\302\202\314\337\266S\270\003W\355\215\016\317i\213\3601\221r\225\364U\303\321\003\214\311\353\357M\3737\232>\253)h\026\307\315\021\253%]\177o\022W\333\311\3322\244\371\367\236\365\335U\262\342\222\373{\315\334\311\216X\016\267\270\277\027\211\337\371\037\333\025\027\256\305\"\311\262R\244\316H\033\271d!<\267H\273\272\241\227\323\203\306V\013i_\262;\326\267\324velz\243(Y\262rU&.O\355\353\353\022\371\200\t\233\003\276\252\034\021\353K\304Ja3,0,\177\257\220\0336\323\245w\265\026v\207\320A\251AE\307\341\f\312\023\354\237\004\340\256\251fq\324\250 Q\023\322\325u\275|\236\350\3419\333z\004\216\211\241\257\227\315\016\034K\261\032:>\2763\254\255\255\313\0254s\0032\344\362\030Cd\013\327\215\212\201\202\002\376\2750\b]\2315\371\333\021(\341\316"
+	.ascii	"\250\245u}h\360r\333*\363r0\326\332|\324puU1-\311\312\272<"
+	.string	"8\210\241\305&\244F\n\r\252-\307\216\035\227\207\017t\271\347aJ]\217\030\\\f\211\030@\036~f\2435e\221\201IEu\2554\030Y\006\031c\207\270\2702U\325\327\352\321r\302\034\241+2fj\352B\203?b\354\360\303uaO\330\376^\350\357\b\256(\202\005f\206\333F\333\270R>\226\235\234\214\213\f2\036n\037\025.\266\250\276R\330\212\037\031\027\177\357\323\305\361ZMlt\341\270a\341`\310i\275\213|#\255I\334\205\362089\256n`\t\243qi\270\223\020\3162\363\351\341\t\223\n\214_\206\037t_\177\233\347\005\356\276\315\333\2742Bx\222\346\030\025x\366\005\021\222\304\253)\313\210a\323\242iF\220\277Ok\346\004\310_ \356\327\302t\233\256\013<\275\333t_\370\231Z[\340\223\363:]\030>\275Mw\251\354\352\3010\002\006\337\336\251\303\275\363\004\367\316\033\356\035&\270w\224"
+	.ascii	"\002^\026<,\23450\254\f\321\253\3612\243\206\337eqW\3248\361"
+	.ascii	"\354\352\376^%\351\363 3\206\005\206/\323\202\271K+\215\236P"
+	.ascii	"\005\250\227sN\362\351e\3322\216\023Fj\211\343\336\276\313<\027"
+	.ascii	"j\244\244\352\222\376\332\300\240\2769\313\263\215\306\337\231"
+	.ascii	"\235\035\270wp\354M\355\236\375\363\034E\301J\230^v>\201\320"
+	.ascii	"\021\263\244\031\375;F\307+\312\223\235\025\330\317\247V\214"
+	.ascii	"\375\322n\305X0\266/?7h{\366\005\361\373\200\303\305\005\030"
+	.ascii	"\332\275m\373\272\255\227W[A\f\020\261\2776LP[\276\346\337\220"
+	.ascii	"\2776Vp\353\254\341\033\235i^\336\243]\rm\313/Q\277\354\204\003"
+	.ascii	"\021\304\346l\316\340\322\\\354]\bg\320\034\343\003.\272(\020"
+	.ascii	"\367\354F\213>\333\305\221H\311\232\374\225\226ix\372\202\361"
+	.ascii	"\267u^hi\237Z-vj\215\253\nn\206+\311\215\313\027,X8\320\230n"
+	.ascii	"E\371a)xW@\342\254L\255\025+\365\200\314\214!\302k\212fg\367"
+	.ascii	"uU!\274t\030\241B\305v\341\3542\250lE\t\261s\314\277\272-<e\312"
+	.ascii	"so+\312/g\fJ\221\034\250\271\271G\363\311\313\275\020^\\90\344"
+	.ascii	"\344~\t'5\241L*\021\\\313*\270\240_Y3\313\230'6\356\t\034\234"
+	.ascii	"\355\302K\016P\\[Q~5Uw\200_\354p\343\034i\342f\337\334\t^:q\032"
+	.ascii	"\21718]\270q\246\330\254\033\233\355\n\346\354R\250\223\263\255"
+	.ascii	"\315vyv\346\374\004\202\231\237^~z\362\360R\330\362p\230p\337"
+	.ascii	"xQSb\227x\036\316Q\232\264\026Qn\252\340\276i\222\226"
+	.string	"\366\247\343\346,I\022\233\026\\\226\006\333\364L\314\314\247\326\314\317B\300\2022\231\006\360z\006\031\343\367^C\312|\3708r$n\357F\307\264}j\247\226l\251s\004\nG\215Q\353\373k\307h\326\264\330\021\371\3337N\270o\232F\214\030\231\002\022!\342yw9\226\235@\340\n2FH\316p f\250\370\372\300\334\302\302\236\307U\032\3131l\222\374\246\370,\0312ib\222\200\201\331\256>\0356E\274|j\275\354\327e\216\345\345\007\376\236@x\024>\033N\177m\020\0166kiOO,\3346S@\200\330.\345\264\303\264\355\252\213a\013m\306\326\226\215\342\234\263\\\024\206\266\321kg\344J\026'A)Nd\306\374m\233\244\036=\254\017\007k\333\212\362\323j\353\303\316\365\350*;\273F\272\236vx\301\362\251\305\372%\333\314L*\021^\317\255(\277\252\320\346X\034\302\021\261#\244\252`a\004"
+	.ascii	"H\020\300Q=B\352\b\035\213C\032TuU\2054\224P\225H#q\247\213~"
+	.ascii	"V\241R\005\254,\032\215E\243`\027\375\220P\207\206Jcq8\304\323"
+	.ascii	"E?'\200Zx!\251\256\353p\204U%\312\320E?*\222@*\222=E\245\222"
+	.ascii	"\205U%\242\241\351\242\037\240\nD0*\256\312\022V\225H\203\272"
+	.string	"\026\223\025\270\351\242\237\024L\220(\001\264\252D\311\341\332\001\005\021i\034\241&\221#vV\240#\322\310\bIL\341Ja\ne\221M\221+]\031\\#\260Y\273\350\347\250\230\\\225B\252\021\bY\344@\234Q\n\225\352\006e\022iD\2160\016\213D\365H)T<\022R\327a\212\342J\024A9\254@\2628\354Q\326\030\251\253\362\205\022B\t\222H\034\210\216E\035\03659\244A\350X\202\220\332#A\t\024D\265\210XA\206\240\037\325\250hB5\022_\030\261*\207\306\236\bB\374\254\311\341\321\217\321\232\202j\024:\016\2138\344\204\370\021R\213\210;F\253Q\250T\252Dd\362\210\350X4J\016ov\224A\242.\372!\nU\243\342zDJ\002\021\207\006\240$\032\032MP\327\341\252\264Q\215\220E\310U\250T\215DG\021\222\252\021\251\204\rX5\032&\207\2066\031h\320A\020\0171I\244\351"
+	.ascii	"\254*\n\342\360H\250*\213\306aq-\036\213B\243\325\270\241\211"
+	.ascii	"\305\244zT\211po\320\201\002:\020\241\202\246Ex\020\302\203\020"
+	.ascii	"\301\026\341AP\220\007\035\004\341\356 \310\256B\242c19,*\241"
+	.ascii	"\nM\320\320E?\026d\030\362\020\035\221)\250(\232\200\214@\007"
+	.ascii	"\224<B\352\232TS\034\213\021\250P\215GH$\f\031\207E6\252\320"
+	.ascii	"\204\021\312\243\0236\254C\243$rH\250\256\303cQ(\211D\022\205"
+	.ascii	"\023\250\302\265x\244\300\315Z<\"\331\034\221Ee\221\250&\217"
+	.ascii	"\204\312\341P\212\344\220\006\3430ER]\217$J\030%\207F\021\326"
+	.ascii	"\025Y$"
+	.ascii	"\201\t\245\b-\b\025\2174\250D\303\325\210L!4\032U\242pM\366("
+	.ascii	"\223H\345QU\n_@\241|\3018\244\343\201\"\341:,*\221G\036(\022"
+	.ascii	"\"\205\220B\024\307\2421\305\320\250g\215`\202\t\224B\242\342"
+	.ascii	"\320\0219\"\002\024\312\241\n\304#\322\020\216*$!\301\221\322"
+	.ascii	"H\205*t$\241\256\303\244P\005\362\004\n\342\320xB\002#\0229\202"
+	.ascii	"pF)D2\"K(\217\2102\254]\364\243<\"\002B\0265\254\306\241U\n\207"
+	.ascii	"Dd\n\312#\242\234uh\264G\244\321"
+	.string	"\026\031\215V\025BZ\213\253q(,\261\302\t8B\252zT\342FU&\221\220#\204\216H\310$\021\316\021R\250\350\256\303\022FH\307`\322v\321\017\222Q\021h-\"*\032\207|\214Fd\362\026\021\327\342\321\fM\007\206/X\245\212d\034\246\b\256]\364\003\244L\252)\212I!\n\032y\244&\201V$2\tt3\\\207$\350(\2058-\254I\344\n<\252\361\304\320D\212`R-\016\025\327\243*T\264Q\205\252\020R\005\033U\bitU\241\004\326$\362(GyD\026\327#$\215\272\016Y\020B\032\236\300\252\007\212%\360*\024A\263\342$\216\320P}\300*\314@\003cqh\"\251\016\r!\215\240b\305I\256+\250)\212*Qe\3018,&U\245\317*\354 h=\026\221p3\200\001#:P \002'`\342\217\321j\004z!\271\252F\252Q]\201\216\305\241\021\0201\251\004\372\001"
+	.string	"\n\342\360\204\3218\034\241\"i\303\347N\222\340\321-\205\341\262rk^_`n\333\rY\023\013\352\313}\333"
+	.ascii	"Z\364\212\227\2536\2351\307\274{\366.G\326\212+\177\245b8NNZ"
+	.ascii	"\320<;5W\306\204\355\357\275\273\271\323j\273:\273]\270X),\244"
+	.ascii	"\211\323m\313%\202\263\310\206\224i\271df~F\240\262x]\341E\211"
+	.ascii	"b\351\272I\240\260\252\256\330\257\017~;\306\254\370\230yK[b"
+	.ascii	"U\341qA\013&\266\277v\327\307\b^\230\256\352\374\314\306\212"
+	.ascii	"\2774*\027\032dbB\344\213.z\313\272\210\001\234b\245\343\007"
+	.ascii	"\305\212\013)\226l'\214\223\036\336\234U\026\350\025\323\337"
+	.ascii	"+w\345\302n\334\215\263V\236\235_{=ZpWJ'L\216\257\035\367\211"
+	.ascii	"\347\331\3151%\375e\302\344\276\005qU\301\t\271\t\022]fi\322"
+	.ascii	"\367m\347\tJ\034\330\r\213\003\303\005\372\267{\234kk\267\255"
+	.ascii	"\313\241\370\204\214\261\365m{40\032u\\R_\327\243\314l\357\310"
+	.ascii	"\221\204Y\250\323\"$jD\030sL!\206\020\232\242\321$i\f\003\025"
+	.ascii	"@@HT4\034O\263\354\006\023@\323g\024\222\234g\035\262\022I\232"
+	.ascii	"d\177\016\301\004b\350hq\260[\345\365\342\374\252\001\342\376"
+	.ascii	"M\324"
+	.string	"z\254\027\240\003Y}\270B\314\242\316d\356\310\005\237,h\303\362\347J\017%Y\320\313,n\023i`\222R\366\365\006(3\023\353\\\237\235\264\346\377\270\253\247\302\356t\261\257\353\005AA\203\362Br\244i\360\017\005e\220\n\254/\374B&\321nA{\313\340-\253s\270\226\302+\227=\2306|`F\317\342\031 \005R\027\005\252\024{i\2424\262\264\2167f\273$\251\370\226\371\244\b\371/-K4?\336\274\311@\355t%\372\375\356\006v\240\310YFK\341\361I\\\030\013\201H)$\321\264\007t\262\242\025\206\313\365\335\264\357\n!U\223\356\b\365rM\313Zr\177\321`2S\036\244\302\231\3231\335\\[j\245\t\215\351\032\376\241\321\340\373\200\340\r/9V\016\230\354a\264 \270\214\370\317\263<\274\016d%\306\313T\275]\321\342\325H\316,\265]\204\304<\241a$\220\376\035f\217\206\\\275"
+	.string	"$\325\313\335@\327v\r$\3612\234\323\006\365\373t\243Q\027Q\376\311f+\002\2363\212\240)Qa"
+	.ascii	"$t\360\037\340Z\to8\301p\343\210\246[]\206\361.@\354 \253L\036"
+	.ascii	"U\223\324u\006\253\016Z\3546\003\365\345Y\035Rr'\277\334\277"
+	.ascii	"5XO\216\352.\361\241b\222\250\250\200Q\204|\347Fb\t\237D|\205"
+	.ascii	"\260\326'GH\303\035\022Rd'\323\232s\270\030\257\254\207\006\311"
+	.ascii	"\340@Ly Z\223\347{ea\261\230G\234\216\204\214A\033\206\250/4"
+	.ascii	".\266\200\221\021\360\316\3003\213NTBF\376\213fm\226\311\224"
+	.ascii	"\323\215c"
+	.string	"\005h*=\0347B\035\365\036\234\271\315@\343\025}e\303-\031\021\223\242\376hMt,\221<]\231\314\370\270\235\304)q\252\n\217\034\252F\303\276\357\017\\\331\361\230\364I\360\303\331P^\355\300R\271S?.\300j4\261\210\357\2124\\\001!2\037oU\264\300R\316\034T\274\207\272\025\275\312\306n)\202\341\037nh\210v\260\231\016\202\351\332\271Y\267&u\223H\031\330\2142`tkF\016\254V|\313g\252\236u\363\330\354!\341\370\200&\363\240O\223\271\370\364\305\177\214e:\023z\032\336\326\007\265\230\036Z\n\373(=\275\nEW\021UP<W:\265\372\023\243w\333\220\310\2106=\326\366<\253g\315\333\313,\305?\271_d\263\214+\215pSh\334(\245\txM\306(\203\365f\n\303\252\b\363\307\246\325\242\352=\242&\214\251\301\031\026.\235\371\254\t\317Ed$<\234\314\325\036-\316"
+	.ascii	"Z\032\327V\253p\032'E\261h@\002\231\256\004\225G\342\347\244"
+	.ascii	"Y\004\320f\262\321\n2\340\017\377\021\275k*\276C\350\366\326"
+	.ascii	"\277[\030\330\034A\263\203F\240o<H\007\305\200\216r\223X\177"
+	.ascii	"\177\177\3576\211\252\275dW\372\333\244\367\2217/\031\322\202"
+	.ascii	"\026A\304[\327\211\006\261\274K\203\224\n\226\336\324\237\n\210"
+	.ascii	"#\312\354\342\007y\310\f\325\253-3\226H\313^\002\001\331\020"
+	.ascii	"<"
+	.string	"|a\232\347\212\031\232\004\020\344\321JK\344B\361<\027\241fXb\327B\274\003\036%w\276U\001r\362\003\3123R\361\020\341R\370\276\230;~\177\370`\020\307E\243\264I\346?!bc\266<~\370\230AW|\273\312B& \366d\276NZ\232\373\204N\257\320\220\200\f*\330q\353\242\200\377\333\030\\\"\343\032cu\256J\250\301\312Im\b*\362\236\r\325\314E\242\223\261\214>\306\210\224@\363Z\201\235\314r\221\253\300\231\3440\252\023\357@i\301\322\001\315\245\b\023\005\2311\004\177\256ky\324A=\360\357\035U[\260\336o<\327\326\304z\t\253y\347\177>\024\020\215\242ek\266\324\336\324\221\366\277P2\025\205\004p\205luk\261\215\217\204\252K\200E\037\006+\352oH\346be\326\231\213\0162\370\373\211\316\206U\231zy$v\275\211p\331\334(#\225\274K\262\n\375!U'\262\210R"
+	.string	"\207ku\333\021\2552\321\rM\240\304\206\366\244 C*\321m='\337\246g\367J0\224\223\351\370C-\235\255z\340\247\206\022(\244\266\\\331\031\370\\\317\\=w\352\003{\353\301)\221\334->\303\255\022A\226AS\205\316\352\344@\303Z\364\023\360\002\t:a\002\343\270B\272\375\345<\220\214a\001\004\\|N\255+\355\266Z\312\326NjO -\251y\346\336\3763\273\361\356\253\265]\313\220\333Eq\377\316!W?\215]A}\377\305.\227\225\314\342\354(<J\301\350\321"
+	.ascii	"\025Gn\005cd\363\324D\232\217\224\334\224\310AC\205\363\261R"
+	.ascii	"\253\037_\224\262\177|oCC"
+	.string	"\266\035\205)\360\t\330\324\246z\351\252\006"
+	.string	"\276\374\236\317\025\364ZH\r\244N\316\352&\276\264\003#\226\352'\300B\016>\023\263Q<\226n<(\301\260]\354\261EQ\223\355\302\260\240\303\222d\345\25677\021d\243\340,P\020+\255}\321?=\236:\2646k\303\306"
+	.string	"\242*\022ys&\366\036\202\310\177`y\270Fu[\366o\213\264 \331Q\024.\030C`W\320\3761\375\004\211ZQ\006=\373\202Y\004\017\215D!b\242\342\006M\n\204\245P\245\013\321\325\3273]s\325\307\n\341\207IN\035\003\245(\225\247;\230\365\240\317\335$\033\364\335\314)K\320M\263\345\023\356\301)\207\371C;\257\376\302\r\323\025\240\317)\260x`"
+	.string	"9"
+	.ascii	"\224\003\310:.v\340\312\020\275\261\361\333\016\f \322\300/\226"
+	.ascii	"n\333'\007=\321B(\272u\002g\356\277\033*<H\374`;\0252\322\323"
+	.ascii	"#-\2167A\310"
+	.string	"\350\0203\r\247B\246q\337|\035\276\222\351\273X@\332\235R\357\246\243V\n\212o\321{\302\231\030\021\236\230;Yd*{\316\202]o7\245\335g\227\365\215\220M\b\314\251\213\252\340\374\367\306\301\372\003\257\362\250\3778\r\221^\264\335\003\230\224\261\300;\344A\323\316\226\203o\246\252\212\334B\214\330\325\347\221#\334\301\032d\032W\342\026\207}P\360)\3151\r\t\260^\036\bse*yt\310\212\351\002<4\307\352\236\204 \031 \236W\027g\336w\006\007\027\277\t~\256\266\rM\365\035\377h\2375\002u\307\362\337c1j2\220\272H+\236 \240\200\336a\366\270 @\216Z\350\025\025t\017\247\344\271\001\037\271@\361!Q\273\351\007\325\021\027Q\232\311\006\263d\206L\343\207,\031\324\032\3530\025\331\"\032\275\370\315\306\240B\230LC\037\217\241\255\370|;;\2646\327q\251?\261\260\025L\254\035E"
+	.ascii	":\230\274\201k1\205q\301\bQpG\032\217\205\265\241\344\347j]\253"
+	.ascii	"p\207\177\030\320e\324\364\371Y\032I\351\313\005\240\203\377"
+	.ascii	"\231\321>;\026\373\255\230Q\357rDV\273\3565\373P\273\201\344"
+	.ascii	"\207\367%\237Y\301\375\322\342>\360\273\342\227s[WBS\0076\320"
+	.ascii	"\037y\334\205\2311\345\003\353,\335\256]\374\205pM\356G\372\362"
+	.ascii	"\217\330\025s0\2669\2661T\357\254\313,?\225M\256\016\312g\n\033"
+	.ascii	"\013\210V\340\275\344\214\017d\2263z`\357Y\250\207\034\373up"
+	.ascii	"\222\357\371\202\017_\023\311\006\374\305\266;\036\307\233\316"
+	.ascii	"\233t\344\273\317\372\210e\243u\224)\233\245?\205S\366\225\271"
+	.ascii	"M\334[\353\003\236\225\325`\250y\317\357\372ppEO\3415\243>\256"
+	.ascii	"&\245\256f,\277\345\214S\370V\312\257\254\276\314\245\007\241"
+	.ascii	"l~\224\324-\362\233\363\036\306\217\023c8d\007\355\267.\322\007"
+	.ascii	"\256\005\321|\232\314\363\356\n\372Zc\207\346Oy\3626\003\350"
+	.ascii	"\303\302\017\347\236\222\356\006\225\037D]\026\207\370\253s\340"
+	.ascii	"\323\220\233u\253\370\206\263\216\236LB3\351\217(/5\237\337\307"
+	.ascii	"\367\312t`_O\035\013\035\035\352\347\330a\373\006s\300\254\364"
+	.ascii	"\270 \202-\324\203\210+z\301\035w\201\221aL_j\375\342\274!\377"
+	.ascii	"\253/\247g\024UW"
+	.text
+	.section	.gnu.lto_.symtab.f474b87192100e73,"e",@progbits
+	.string	"handleLtmTelemetry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\001"
+	.string	""
+	.string	"freeLtmTelemetryPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\001"
+	.string	""
+	.string	"initLtmTelemetry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\001"
+	.string	""
+	.string	"configureLtmTelemetryPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\001"
+	.string	""
+	.string	"checkLtmTelemetryState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\001"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\001"
+	.string	""
+	.string	"specialColors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\001"
+	.string	""
+	.string	"modeColors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"colors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\002"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\001"
+	.string	""
+	.string	"GPS_home"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\001"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\001"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\001"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\001"
+	.string	""
+	.string	"telemetrySharedPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\001"
+	.string	""
+	.string	"telemetryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\001"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\001"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\002"
+	.string	""
+	.string	"getEstimatedAltitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \002"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\002"
+	.string	""
+	.string	"getRssi"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002"
+	.string	""
+	.string	"getBatteryVoltage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\002"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\002"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\002"
+	.string	""
+	.string	"closeSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\002"
+	.string	""
+	.string	"determinePortSharing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\002"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\002"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\002"
+	.string	""
+	.string	"telemetryDetermineEnabledState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\002"
+	.string	""
+	.string	"telemetryCheckRxPortShared"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.f474b87192100e73,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,729 @@
+	.file	"telemetry.c"
+	.section	.gnu.lto_.profile.885abb3f385318d7,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.885abb3f385318d7,"e",@progbits
+	.string	"(\265/\375 z\205\003"
+	.string	"\024\006n"
+	.string	"\016"
+	.string	"\261\277\223\264\007"
+	.string	"\001\342\270\360\367\001\002\002"
+	.string	"\002\001\003\274\205\242\255\006"
+	.string	"\004\346\362\371\355\t\004\002"
+	.string	"\002"
+	.string	"\005\240\342\234\212\n\007\275\267\374\234\005\002\002\003\002\004\b\t\354\301\314\336\005"
+	.string	"\n\371\342\306\273\f"
+	.string	"\013\352\263\360\321\b\f\206\233\257\310\r\r\314\341\302\355\007\016\017\240\342\234\212\n"
+	.string	"\004"
+	.ascii	"\331J\274JM`\316@6\320\006"
+	.text
+	.section	.gnu.lto_.ipa_sra.885abb3f385318d7,"e",@progbits
+	.string	"(\265/\375 E\355\001"
+	.string	"\364\0029"
+	.string	"\b"
+	.string	""
+	.string	"\003"
+	.string	"\002\001"
+	.string	"\003\003"
+	.string	"\001\004\001\003"
+	.string	"\002\007\001\001\002\005\002\020\002\006\003"
+	.string	"\002\b"
+	.string	"\001\t\001\001\n"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"?\003\355\214CgP\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.885abb3f385318d7,"e",@progbits
+	.string	"(\265/\375`\331"
+	.string	"e\007"
+	.string	"R\f)/`k\222\016\220\r\301\323\f\020\276\316\235\002T\214\026\251)h\306n\013\231\310F\315\016\taC\020D\201p\323\027E\233\375\337\232\330\275\345N\001\377C\370\300\303\244\017\241A#<&&<8\213\r\007\r\200%\221\347\361\211F\313E/\347F\227\240\006\371\033R\033!\fcg\254\242v\272\254\242\234&|\027\231\022eg\322GK?80\r\222\237\327\341\257ZSP\252\bw+\270\016\212\f\th\\\315\314\274%\365\227J\233\tC\240\025\233I\023`?\345\276\253\271\220\231\f\337\267\313e2S\375\263i\002\034"
+	.string	"1\241))\020U:`\200\006\004\347(y\325\215\350?\264f\333\f\221u\f\026\223\003\2356\301\335\344\316Z\3031\313P%\304\322\370\211]\001aT\224\301\262)\204\034\234\177\352\212\316\270MK\336\034\254"
+	.ascii	"C"
+	.text
+	.section	.gnu.lto_.jmpfuncs.885abb3f385318d7,"e",@progbits
+	.string	"(\265/\375 \227\345\002"
+	.string	"2\005\017\027\300%\303\001o\212\333\252\006\027\337\242\252\252'\346\332n\333\312-S\n\232\r\027\332Q\351\017\210ff\366@4\025\024\351\227\311\361"
+	.string	"\211\212\361\323\241\353;\304;KL \222\032\260\020\013"
+	.ascii	"Qq\224\212\204\240\006W\025\032\346\310\301\006h6\255\225`Y]"
+	.ascii	"\220SVo\240\r"
+	.text
+	.section	.gnu.lto_.pureconst.885abb3f385318d7,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\b"
+	.ascii	"\230\004\001\204\004\003\200\004\004\230\004\007\205\004\b\200"
+	.ascii	"\004\t\200\004\n\270\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.885abb3f385318d7,"e",@progbits
+	.string	"(\265/\375 a\365\001"
+	.string	"$\002U"
+	.string	"\006"
+	.string	"\001\001\002\013"
+	.string	"\004\001\374\007"
+	.string	"\007\001\300\005\f"
+	.string	"\001\002\005"
+	.string	"\001\020\020\t\001\002\n"
+	.string	"\002"
+	.string	"\013"
+	.ascii	" \021gA\305\206O\303:\315\374l\372\246\323+2,\341\202\2027\200"
+	.ascii	"\005"
+	.text
+	.section	.gnu.lto_.lto.885abb3f385318d7,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_telemetryConfig_Registry.33.885abb3f385318d7,"e",@progbits
+	.string	"(\265/\375 \234]\004"
+	.string	"\244\007a"
+	.string	""
+	.string	""
+	.string	"/"
+	.string	"\005\001\212\001\206\200\200\374\342\303\274\375\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\306\007us\350\334\006uq"
+	.string	"\005\001\006'\001(\237\300"
+	.string	"?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"!./src/main/telemetry.c"
+	.string	"\005"
+	.ascii	"\335\2620\245%\230\217\203(\361\006P\004"
+	.text
+	.section	.gnu.lto_pgResetTemplate_telemetryConfig.35.885abb3f385318d7,"e",@progbits
+	.string	"(\265/\375 |u\003"
+	.string	"\304\005j"
+	.string	""
+	.string	""
+	.string	"\006"
+	.string	"\005\001\006\035\001\0312\005\001'\002\002\177\005\005\001\006}{\035\001\001\005\001\006\031\001"
+	.string	"?\202\210\200\370\001yw\303\001u\303\001s\273\001q\273\001o\302\001m\301\001k\300\001i\273\001g\277\001e\273\001c\273\001a\276\001_\275\001]\274\001[\273\001"
+	.string	"\004\001\002\003"
+	.string	"\006"
+	.ascii	")\"\202:\275\263\031\0207e\350\001\024\001"
+	.text
+	.section	.gnu.lto_telemetryInit.36.885abb3f385318d7,"e",@progbits
+	.string	"(\265/\375 \307E\005"
+	.string	"\"\t#.pU\323\001"
+	.string	"\355U\f\200\007`\020x\322\200\341\030\341_\343\030q\220 \373\234,\337O\002\333\253\252+\341\200=|\240B\307\267v\357\224\002\226\"\211\264\"\025\035\321\322\307\324\240T\222\021\215\022\256 Q\252UUR\241\211\035r\b\ff\366\314\036\274\330\037,\344\354\267\230\335\300\001`\267R@\260\001\204\317\306\366!_\266\300gf\337\321P<\335\356*\304\374\372\273\374sn\320\266\311_\201\261\273~\332f\271\341m+l\253\355)\t"
+	.ascii	"i\3317\323\342\234\031\002\276\3345<-\204\3612\004\270t\213v"
+	.ascii	">\001"
+	.text
+	.section	.gnu.lto_telemetryDetermineEnabledState.37.885abb3f385318d7,"e",@progbits
+	.string	"(\265/\375`\231\001\305\020"
+	.string	"6\240rF\360\360$\035Z\250\321\340\351\324*\n\036\377-\327\305X\240\235\275*\036qa\375wE`\204\217e\fu\324\376y\340\364f\206\373=\036\222\313\006z\003/\037\213\327]\006\r\305\274m\027\302^&\255\021\262\367\226;\245_"
+	.string	"Y"
+	.string	"a"
+	.ascii	"\362\002\350\247m\217(\210\261\352\340\216\3539K\255!\033\265"
+	.ascii	"\202\333\206\270\352t\312\215*\377\341%\211\235\024\336'sz\372"
+	.ascii	"j>\263\232K\031\"\243\210\206\307wA~\270z<\355\233\211+CnVt\360"
+	.ascii	"\3700\310\017\244\234\027\017\037i>V\214\230\203Z\253\243\367"
+	.ascii	"m\270\261\333\226`\373\201}\026\0016\310\212\013\302\276\254"
+	.ascii	"\265V\257\216\255m\364)"
+	.string	";\320\217\321\203\267\334\350\335\350\b`\300\316\215\207\234\030\333\002\254\256W\216z4\215D\034\374\355\030?\264\346\203*\020\031\260\272Fp\300\237\003\237n\220\305h\377\347%b\016\004cS\255\037\224T\324\n\"p\202\354\023\344\037\3643%>\217\271\223\023\372\271k\n_>6\253\370\362\214\242\f5\246\026m\n*\361\236\334]\031\006>_\222|\013\215\333\t)\331\250\023\265d\265\316,\360\207n\302\305\347\371t\205\227x\357\323\177\241\237q1$\0357\200V\357\361n\216\226\200\313\205P\322L\304\341\037\206b\233\355\b\016Q\313\210\025_\001&\\J\004\222\025\016;YA\351H&@Hu(\026\315%\"\026\272\024\247\302\245p\251m\005\205De+\351\\6\021\003F\261p\335\226B\241\272M\003W\227uu\374\360\246\021AKS[K)\327$HC\314\226.\215m\272\036\036\207\243\325\262\350i\265}\370"
+	.string	"0Z;\376\002t\367\264\216-\233\2378\212\035"
+	.ascii	"i\355\213\231\351\263\257}\267\355\235B\373\252+\001MxmH\025"
+	.ascii	"T+\200\212\002\330)\024\026\2340N)\330\002\022\250\332\236\214"
+	.ascii	"\331d6\307\005\027\213\351\026+G\331\263\2325Mdb\202\025\343"
+	.ascii	"T34\205~u\237Q\007\025\005"
+	.text
+	.section	.gnu.lto_telemetryCheckRxPortShared.38.885abb3f385318d7,"e",@progbits
+	.string	"(\265/\375`\021\001\245\f"
+	.string	"\206\330TA q\232\016\034D\016A_\f$H?l\361 #C\"k\\\001\177\230\360\220\260\206J\b\333\254i\355\r \3504HX86F\024\00221\350\200\233G\266K?\206C\360L\206\215\354\275\245L)A"
+	.string	">"
+	.string	"C"
+	.ascii	"\322\005\304C\333N\240`\343\354\335\207"
+	.string	"\223\2032\220\254X\331\355(\365\360\354\360if\376e\343\034J\033\376\246\315\223\n`\303\360\b\354\356CO\223M\313\2144\273\353,\3314\334\361\266\037\330f`_$\177\273\273\326\217\255\351\350\334\037\235~N\253\246S\323\227 \214X\241a`\306\356IK\215}\001]\210\260\275\261'\333\231\366M<esn\344\001v?,-v\273\003F \035\272\373\200x\030\252\034\377)H\305s\342\036J>w\227\243\306\304H\037\272\004#\205\fO\262\330\3351\361\032\251\223\204\203\346\220\243\260 \355z\026\370'.\021)\304\241?\022\017\257 PHtH\341:\331bwZ*\310\016\023:$|X\r\260\313\002\271\230#s\341\302*\217\212B\205Q\037\035\021<(\216+\204\312\024\260\005R]\024fY\0275u\235\277\325\217S\257\362\207\356 F\t\025\026\351g\321\317\304\266\2525\035\325\340F\332V\205|\311\323\031"
+	.string	"i\355\023\303t\241\261\266\324:\315\226\235BW\260\242\2525"
+	.ascii	"\016`1\030\004\227YE\002\242\310\210\033\306\204\0235V\333\302"
+	.ascii	"\013\233\360\33350\215L\234\257\356\253j\3105OoW)\003"
+	.text
+	.section	.gnu.lto_telemetryCheckState.40.885abb3f385318d7,"e",@progbits
+	.string	"(\265/\375 \307=\005"
+	.string	"\"\311\"-pU\323\001"
+	.string	"\355U\fp\375\006r:\203\357\nIU\341\0301\201\232}N\226\357'\201\355\370\377\277j@w\240\001\240b\330\277wJ\001\226\242\210\264\"\025\033\321R\307\304\240T\222\020\215\016\256\036Q\252UUR\241\271\207\233A\002'\366\304\036\274\330\027,\334\354\267\230]@\242\263[\031\020\330\317\300\243\261}\310\227\r\360\231\331s\034\n\327\355\256B\314\257\277\313\377\346\205L\303\376\b\212\335\365\3134\313\ro\033a[mO\001\t"
+	.ascii	"i\3317\323\342\234\031\002\276\3345<-\204\3612\004\270t\213v"
+	.ascii	">\001"
+	.text
+	.section	.gnu.lto_telemetryProcess.41.885abb3f385318d7,"e",@progbits
+	.string	"(\265/\375 \374\225\006"
+	.string	"\242\314-1pm\032\003\220{J=\200\204\360e!\303\242A\031z\254\025\330\353&%\006\221%b\267\246\344P\364\357\236.P\211\251d\271\331v\220\226D\312\224\002\217\322$\304\315\203\320a\222:e `|\324[x\321m4\n\224\233`\203\313\f\264bx\320\305\252\202N\2327\003\025#\301&\332\311Y\354\2425\345\377\313@\355z \021\225\270\321_12\271H\013\321\220\332z\265\3360\207tGD/\277\305\007\310?\013j"
+	.string	"\340\206\261@\305\215\342\200\212[e;\342\231q\207N(B\242\377\216aXz\311\332\036\276t<\034/\013\302\377\256\216\347\3432\267%h{\320\366\023\t"
+	.ascii	"i\331'\323b\242f\340\302\t\230w\t\200XM\001wy\321N2"
+	.text
+	.section	.gnu.lto_releaseSharedTelemetryPorts.42.885abb3f385318d7,"e",@progbits
+	.string	"(\265/\375`\354"
+	.string	"M\f"
+	.string	"\306\026TC\020q\233\016"
+	.string	"A\f~\245\031H\022\336\003\262\034\244\033\322<\220\006\265\353\f\206\003\241\205\250\002(\037\201\320t\302\232\3543P\\;\232}UM\007\240\025\224\2020\370\035K\307\020L\374\370\364\311\336r\247\024>"
+	.string	"@"
+	.string	">"
+	.string	"7v\267\322\021\226Q\373\224\0325?~-\234\027\372\224\227\2553\t\340mrS\"\251|\364\030\342}DIB\344\372\321e\211O\006\347\211<^\030\354\256#\347q\270\247\333\366\330V`\277A\324\274\350>\006c\203\005\306\202\224\335\256\205e\303\251rr\321o\377#g\374\357'\264\213<\276\0316`\270\031-H\273 \202O'\240>\r~\300\364I]\300\364i\315\256q\260d\217\302B\303\212%\271\273+S\374(n\177(%\320}\240\342\325\256"
+	.string	"\212\347\f \305C\b\242(/6O=\343oa\222\337\355b\262;.\304sS\017t\035\302MC6\030\212Jb\177SR\"YG\354\031v=\360X\030\007\002\210\303\035M\007\226Y\037K\202\225U\023\"p>U\007\003U\032\003\276(XX\225]\027Ve\300\275\216\330A\210\020\203~L%\361M\254\304PJ\243\210\025\2238\365\032\3421]\013\2008QA\003$\006\026"
+	.ascii	"i\331'\323\260\316&KW\2711\315\212f\022\270\345+\342\020\372"
+	.ascii	"\020\356z*K\234\262\247\245+X!\312r_\t\021\b%\310\027\267T\251"
+	.ascii	"Z\006\352e\2230\237"
+	.text
+	.section	.gnu.lto_telemetryDetermineEnabledState.part.0.49.885abb3f385318d7,"e",@progbits
+	.string	"(\265/\375`P\001\225\r"
+	.string	"\326\227XE\020\257&\035\214uH\024"
+	.string	"@\004\350\347\215?6\321\033_\257N\003\232\351sv\315\274\255\027\t\314\370h\321\226v\246\310y\220\325g\235\306'\240"
+	.string	" \244p\231\016\233HPt\320\355\271\366\200@\266\355-wJ\001?"
+	.string	"C"
+	.string	"K"
+	.string	")\216K7\260.?\302\036\217.\203m{<F\366>Q\245\203\200aA\265\332\235\330\245\276\334\273\302\350\371\037\324\212\317D\272^u\370\231X\016\t<v>v\327\326\206[\336\366\307vf\377%7\312MX[\320X\355\356u?\246\363i\256\362\0053\323]F\004\035l\n\007\026\n\355\317\227\030]F\024\347\232\376\342t\303\340\322\037\353r\343\0068\227\361\0058#\037\306\327\245O\302\333 \315-y<\314\360\3005\216=\301\004\376\273\"8\021\303fEIP]\2541\256\266\330\360r\3017\340\264[\2521c?H\027!N\363\232\316'\037*\027(\304\232\323Mj\265+\223\303(\236\002\305'\t&JC"
+	.ascii	"\0212*t\360\264>s\265\003\016\221\020\022\331@!\017\270M+\271"
+	.ascii	"\"d#\020@\241\254c\220\016\321\306e$\331H\306a!\021\020\t\006"
+	.ascii	"\262\231`\035\n\254\225d\033\306i\332\206]\217\253-~*F\005\274"
+	.ascii	"B\305`\033\252\200\217\305&EUT]l\003\b! P\"\263\252:\363\270"
+	.ascii	"\245\300\333\347\021o\326\340\360\345\276\007\ncc;-\301\275\317"
+	.ascii	"\206o\t|\t\315\b\225\315lh\002\207\3127N\322 \340$\330\306\345"
+	.ascii	"]\304J2\271\035\252%/\235Z6\242\005K\024T\354\301\306\303r\336"
+	.ascii	"5\307"
+	.text
+	.section	.gnu.lto_telemetryCheckRxPortShared.part.0.57.885abb3f385318d7,"e",@progbits
+	.string	"(\265/\375`\252\003\025\025"
+	.string	"Fd\206I\3000\2511|@\370\327\303\257\037\302\330B\267\333\3770\024q\375\327\207\026\334\207\0374\247g\327\037\007\206\352h\320\326\022\241]&#\242\264h\206\353*\212\256K\\\273(\025cu\0206V\230\357\236XF\322\366\226[\312\224\002r"
+	.string	"o"
+	.string	"m"
+	.ascii	"FI\261\361\3316J\312\215s?\207=\027\362\364Nt\335{\322n\253\207"
+	.ascii	"\347>\223\305`%i\307J?r>\325\371Q\370L\001\221\t$\036B>A\227"
+	.ascii	"\005\3052\300.\303\007,{d\005\2133\216(O\277\250\220\037o\004"
+	.ascii	"\t\201\303\350u4\020|a\206\374v#\t\026\007\033'\276\304\310\007"
+	.ascii	"Di\200\177\224*\367^_\247\341\006\271m\030\266\033\3305&w\203"
+	.ascii	"\245\372@}P\226Q\331\345\340\214O\303\030H]\227w\232\3303\226"
+	.ascii	"\031p\016}J \242\255\035gz\314\276\220S\027\020\252\n\230\242"
+	.ascii	"\nH\243\252<\363&W\037\251\021\367\336\031\314O\262\361\211\236"
+	.ascii	"1\331\374\254!Ps\256Nhr\353J\355+}\351\346g\315\001\334;\344"
+	.ascii	"\245\342\336\363\300\255\021\300n}\236\204\274\205}\204\274\261"
+	.ascii	"g\267?"
+	.string	"\n\243\200\255\0164x.\220\225\306\254\361\025\275\037+Ks\314\031;=\022\030\306W\013\346R=\235\322\201\025\254Uh\273\205|\265V\346Q\323\026\217z\331f\271\213\026\330\275\274\004>\213\267p\361\213nm\213\241\327\271\365c\310\333\327\023O\213L\244`\222\222\216\026i\025\272~\274\026\213\305/\327!\333\324\224\244\376X\340H$xoO\261G\216pBs\243\321\334F \260<x\261-\300\335l02\257\234\324\334p5\227\232\204\032\216\366\302\342\300\205\266r\233@;)\261\r\246v\243\341l\266\033m\366:\3442k\350$%\373s\344\211g\220U\302I*\346\347HZw\252Utu\347\372\361\336{g\"OS=A\024\267\n\271\276*q%]\311J\036\223\213\212H\004S\214\314\2319\254\365s%\005\2637vZ_ \312E\2501d\304\fc\022M \022L\230\260\260-\006\020\2431\312\003\022"
+	.string	"\024U\225R\330\375\377\377\f\020\037\323CW\b\234`\032\373\250]\306\276\235\025\345a@\266\"&/\200uPsxZr\b\352\334\b\305\337\f\230s\261\212\313G(\352)1\361J-\026\225Z\344>'S\214\236\031M\035\271\373"
+	.ascii	"\004V\023\242\037\266\031\335\037}U\017\225Sb\361`Y\240\271\022"
+	.ascii	"\n!w\325\340\226\023\032\347s\322\331\345\370\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.885abb3f385318d7,"e",@progbits
+	.string	"(\265/\375`\316"
+	.string	"\345\007"
+	.string	"\344\013\312\001"
+	.string	""
+	.string	""
+	.string	"\0021\177\r\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 9\177\016\375\377\377\377\003\005-\017$\177\020\272\200\202\002%\177\021\005\036\022\201\204\005,\023&\177\024(\177\025\002)\177\026\002*\177\027\360\372\2508\005'\030#\031\205\204\001"
+	.string	".pg_resetdata"
+	.string	""
+	.string	"\005!\032gistry"
+	.string	""
+	.string	"\005\037\033\002\034\001+\177\035\377\037"
+	.string	""
+	.string	"\200\200\200\0010\177\036/\177\037.\177 \003"
+	.string	"$\003\004"
+	.string	"\351\221\2719\001\242\001\003\007\001\201\200\200\200\001\001\302\001\003\n\023\360\372\2508\001$\003\n\022\221\205\327\307\003\001D\003\n\021\221\205\327\307\003\001d"
+	.string	"\030"
+	.string	"S+\303\240\036"
+	.ascii	"\034>@\326\277\264a\t\206\313\217e\264\253\362$gc\031\263+>\333"
+	.ascii	"\242\021|\0134\001\364\200\037C\364\270\303\252w\322\340\212"
+	.ascii	"%^\335 \352\032`8\315N'"
+	.text
+	.section	.gnu.lto_.refs.885abb3f385318d7,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	"\002\001"
+	.string	"\002\004"
+	.string	"\005\003"
+	.string	""
+	.string	"\006\006"
+	.string	"\003\r\002\005\002\016\002\f"
+	.text
+	.section	.gnu.lto_.decls.885abb3f385318d7,"e",@progbits
+	.string	"(\265/\375`0(\225\261"
+	.ascii	"\032\032\351>X \nYI\035\302\032\013w\177\224\333NO\347\200\021"
+	.ascii	"z\221!\002J\031\024\036\243\007_\017\003\204\241\217\210>\300"
+	.ascii	"\006b\335\013@r\324M\026\254\371g\364E\262$\013\007(z9\207\223"
+	.ascii	"\022)\233\026\2429L\342D\r\305\236J\277\334\334\336\376jD>#b"
+	.ascii	"\b\004I\231d\n~\003\343\003\360\003\332wX\372\253\336\352B3\374"
+	.ascii	"\220\013\306\307Q\363\263\357\212h\021\354}3\354n]\335\315\260"
+	.ascii	"\363]\016\355;\246\366\032\272\251\247\312rK\204\270`\233\372"
+	.ascii	"\372\0367tGS\234\240\372yx\336r\346\340\344\214\263\257\317^"
+	.ascii	"\223D{\215\016\3555J\3323\031\355Y\252\375q\270\377\215+\246"
+	.ascii	"L\300\226%\032\237\037\312\307?J\327\325\211M}\326\031\323\276"
+	.ascii	"\374\324\236\201h\317N4x[\336\200\200}\366\233\205\345v\351$"
+	.ascii	"w\266rES\3317\357\333\215\303ZL\375\004\232f\272\004\214KT\027"
+	.ascii	"i\335\224\247\375K\357\342c|\322\277x\245_\361G\337\3643\236"
+	.ascii	"y\351n\3353=\213_>\362a\274\214G\372\026\237\274i^y\241\337\274"
+	.ascii	"f\374\236\271h<?\367V\236\2411M\315\2568y\251\271p\002ej*Fv\233"
+	.ascii	"\340\247\025\357\t\217\033^_>\246aPf`\316pq\271l-\244[\222|\344"
+	.ascii	"\244h\250T\341bC\001\356>\337\274+\3349\374\264\262a\241\243"
+	.ascii	"\314t\357\355\267\354\233\327\312\355\302O0\315\242I\215i\030"
+	.ascii	"w\0371R3\034\264]\266\345]\302\204\013U\232\026.JY\356>cn\023"
+	.ascii	"\035\344\316>\222\316Y\355\375\364\353\304\375\216\271k\300"
+	.string	"\3017o\226\333$\004\322\336YW>6pr\202C\256\314\336\317\013z.\340\315)\211\222\261A~\004\300i\277s\267\311\0076\005\274\"uL`>_2>~\313X\3301\235\236\333\027\200.\262\260\317<\314\246\035\223i\307P\355\\\027\303\316q\022\355\330\207\3662/\027\356B=\334/~\335\256\227\333(\237;j\263\026\006\212\353\263c\034\332\257\207\235\357z\3309\226\241\363\323i\177,z-\3178\343!\344\263\377\230\366\307\322\376S\272\347\227\264\377\326\036\306h\277]t\b\251\366k\246\035,L{\232\226\366\351\224\336)s1\354\3746\265\213@\373\252}\003z\203\n7\312\205v\270R\374>\271\\^\223|\356\347\377\240\203\002\375\354%h\277\035v\270\256\356v\330\371\b\275s1\354\376Z\330ep1\354\356\363j]\250\206\033u\r8p\214\334\332Y{?}9i\224\2449\363\331?\320\356\276\345"
+	.string	"P\333\034\270\004\332\257\206\335\255\273\032v\376z\303M\301\375b\335,\rx\251\344\334\\{?y|\317\031K;>\373\363b\330\351ka\347\356t\337\200\367\300\375C\364\334\361\005\r\336'\216\003\006\356o\301\005\356W\n>\200\277;.\200\006\367\273\377"
+	.string	"\356W\003u\356\036\235\272\337\242\367\360\035\334o\013\267\200u\3677\277\356\370\003\367\313"
+	.ascii	"\367+\302\375.\300\375:\300\375\206\340~=p\277#\334/\004\334"
+	.ascii	"o\003\334/\b\3567\204\373\375q\277\035\270\337\007\270_5\367"
+	.ascii	"\353\301\375\022\300\375\006\300\335-\270\343'\356\317s\377\033"
+	.ascii	"\367\267q\377\235\373g\367\327\356\337\223s\177\354\376\367\013"
+	.ascii	"\340\356>\367\\\201\373\023\300\375\007\340\376\032\334\037\203"
+	.ascii	"\373\363\270\277\317\375s\334\257\324\375~\271\337\030\356\367"
+	.ascii	"\205\373er\277#p\277J\3567\311\375\022\271_$\367{\344~\221\356"
+	.ascii	"7\004\356\267\003\356\027\004\356W\310\335\277\270\337\325\335"
+	.ascii	"\r\340~Q\270\337\237\373\365\200\373\225\200\373\025\301\375"
+	.ascii	"N\340\356Y\356\316\301\335\257\270;N]]]\235\373s\300]\257\271"
+	.ascii	"k"
+	.string	"@\0136\202xi\331\361\031;\335\256:/,d\016\207S\205J\007\332\234\366\347\265\260\213\021CE\023\213\301\201\021s\306d\342\027z\377\264T=%\251\331\032\323\022\305M\307/\262\224\311Z\333\215CkBcF\n\023\023F\322\310*r_\245F\335\221$J\027\212\225n\223\214\334\332M7,\206\\M\313\354]\206\001\226\001\246\205\243\264\364\013\305K\234\004\002\327\336\315\013\342\232L'\fp\326v\314]\371\214[\334\344\\\220'f\264\337H5^\201W`$\275{\2164\237<\344T\255\230s\362\031\311\277\324\250\031\021\242\002\231v\307G~\241\370\350\337@\340r\356\027\b \003Ss*\263\267\023\0068]^eoM\346\360\236\303H\003`\244\0313_7\201\013hU=%\341\300\224.\2524\376u>'3+J>\373\230\247\333Y\021\363\346\244CS\223f6C\352\354\231\201\313\254\371\371\314\213U"
+	.ascii	"\267\354\372\3547T\332o\226\372\313\257\360\345\311\354\366\276"
+	.ascii	"Og\023s;1=\270\373\030\17726C\212\350P\362\362p\376q\320\217"
+	.ascii	"\3731\032\271\367\205\024\264T=\225\331NN\036t\232' 1\233\372"
+	.ascii	"\217\t\323\333\333\202\034%2\324\206|\3760\377`^\214\177\230"
+	.ascii	"\227\353)?L\336;y/\007\235{9\324\220\005IBw\331m\322\264\217"
+	.ascii	"y\251\273\333\274\032U\364\311g\267\321\322nsC\273\337\335N2"
+	.ascii	"\367\336/j\236\233y\324\333\335\232\233s\361\035\200\273\347"
+	.ascii	"\215\335/\300\300\336\311\26161\272\310W\362\206o\330^\223\266"
+	.ascii	"\267R\n\t\202TS)Ec\031\225\332H\245\020$\017sK!\227\321\275y"
+	.ascii	"\266R\211\034\341\334<\313\350n\356\025j\315\273\237R\310\255"
+	.ascii	"tn\236\255\334\311\rK\245Ts\031M6y\226Q\251\346\216J\355\235"
+	.ascii	"\255L2[(7\223gG\245\344v\324\331\334YF\235\315eTj\352\232iA5"
+	.ascii	"\343\305W\033\217\250\253e\251\334LKOI\346N\332\362\351\334m"
+	.ascii	"{_.\244\315\034\300\336ONf[\222\306\005;Jc:\222\222t\336\347"
+	.ascii	"\336;\303\322\221\016\347V\246-\2158\3676r$\264\2276@>\323\366"
+	.ascii	"\324MC\356x\332JH{\003`io"
+	.string	"\344\335i{o\344\336\233\307|z\356mcgi\265\264\264\267S\317\322~B\206!\355\375\\n`\315eT\207\323'\314I\324j\263x\"\257\325n\223b\352(Rk+\205\321VM\030`>\277[\217O:G\365\343M\263}\233\316\n.\306T\241\302\266\345\271\3308m@\223^[^m\267e*\314\355\251\345\371\304\001\213\202\022#\013\232\316f\246\025\371|\366\354\271M\254\316\\}v\035D\233\275\225\257\362T\376\312\227]\350cy1\377\261[\346\205\345\245|\330\327Q\226\351\224\354\315\312\f\212\016\267)\226\237\002E\233\206QA\332\005\313Gy\356&\007 \245\314\222\354\375\354\271\300\267F\206\313\212Nv\036\235\356\361\334\264\363\316\036\354F\237L\361\234\350\357z\257\013\375\257\235\203\303\003\214+\371\331\210\347d;\347ai\347Mi\347\321\320\316\333\\\035\264R,J\326\023h\246jc\343\312\361f\245"
+	.ascii	"\035]|\202`I\341\257~\353\223\374\222w\362X\337\344\237\237\365"
+	.ascii	"Z\257\344\243\217\344\231\\\350C\337\210\377\221GAj\343\213\225"
+	.ascii	"\317\005\203V\266\343O\230\3226-\362Dtj\366v\232YI\235^\322\234"
+	.ascii	"n\223\233\346\364\301U\231i\026\364}\374\217\233\3065b\205,c"
+	.ascii	"RnV5\342\322\240\017\3446\211:\263\032{\350?=\016\035\274w\022"
+	.ascii	"\316j\357\355\003}!OD'\371\334L\336\017\253\025\320\224\331{"
+	.ascii	"c\030_LD6\344\367\260\223\022\032\210"
+	.string	"\324\bQ`a~d()T[\r*\214\234z2\021"
+	.ascii	"\243\304\343\3633\253\327\324\364\303\231O\300IgQ1\260\036X\n"
+	.ascii	"U\"\345\363\216\035J\344\362\2313,\351\263\363(\301\3418\262"
+	.ascii	"\324\335\332\242*\203\364\342bG\316\341Y\252\313\212\0260\262"
+	.ascii	"s\315\355L\232\323\006o\205\031\263(\032\03242T\217\023)\367"
+	.ascii	"\001\026R\312\354^\255\375\200\3125<C\345\247\261\243)j\377t"
+	.ascii	"\003\2271]\371\021e\333\2102f%\333\300HzQ<l\260}\316[\330\262"
+	.ascii	"|t\351uiq\322%\325\016#\303\3102\356\326n\272\300\344E\017\""
+	.ascii	"\036t\244=\222\\\344\030\236e\034\035\001\322\365k9I\340\270"
+	.ascii	"\324@\322\274\320\334\274q p\355d\323C\225\244\024\026\236 i"
+	.ascii	"H>\373\016\222v\317M\271\t'e\345\316\336:\350\300jz eq\312qq"
+	.ascii	"\034\307%/\341\245\323\206\361\341\253\231\237\310\201E}\316"
+	.ascii	"J=.jD\341\332\242\375fM1\230\266\2610X.+\313t\005\\\006\005,"
+	.ascii	"S39y\323\234v\266\322\313\3134\013\t\213\301r:H\236\275w\240"
+	.ascii	"Y-\263\213\234\224Y\344\025\271\305\205f$<\307\225\221\360\230"
+	.ascii	"\333u\323|\200\220u6\305Y\033S\225\246\223\247\016g\301\321r"
+	.ascii	"\002K\334\2469\211\317d\344Msz\356\0278]C\322\200\035e\345\205"
+	.ascii	"\346\244\367<\367\346\312\220s\246K\231%\273\354\236\221y\367"
+	.ascii	"\300\222n\260\370\214\353n\364\212\213\035t\027\212\323\260 "
+	.ascii	"B'\3443F\343p\271\0052\311\005Y\226\021\206u\246\245\335\207"
+	.ascii	"\245\335'Dc2\232\313\024\n\315\207v\337\016\355>\034\332}4\264"
+	.ascii	"\373^\200\221\213\232\211A\223{\351\231\322\321g\3671i\354\005"
+	.ascii	"\177\361]\201\365\210\002G\002U\226(\237\363\333_\251\262Zr\323"
+	.ascii	"i\023\002E\253KM\224:15>\3436\215\344\333\035n\240\274p\334\370"
+	.ascii	"\354\270\315\035O\301l&\324\321\221\371\354mc>\216\327p\320\250"
+	.ascii	"L\231\260i\277J.\016s\254\026\206\245Y\353\211\324\251\032\362"
+	.ascii	"\204A\216\022\311\212$^\nkrW>c4\234\206\265\270\333\330\210)"
+	.ascii	"I\237\262h\307Yn|\250\0059\362\3711\026\307g\3566\274,\246\022"
+	.ascii	"\212\231vl\206\257\270\333`:,b-\246h\307VF\360\226C\311g\\\246"
+	.ascii	"\221t\240\035l\334\266\340~|v\\\346\376P\227\n\256\362J7\234"
+	.ascii	"\342>c2L\305q\025<\266q\225\r\234{'q\025\037\232\275\223\276"
+	.ascii	"{9\334\313!_\351\250Ra\227]g\211\306S|\034\213}\025\327\225+"
+	.ascii	"\237st\242\264\343\256\213\277\240\370\013w\341\345N\346\370"
+	.ascii	"\240JX\031\006zJ\2226(\237]'I\373\305];w\334%\205\002l,\316>"
+	.ascii	"G\201\300\025\"_\350\264\337\262\023\2263h`\250&\250\323\324"
+	.ascii	"+\207R\226s\251\f\307\215\323Q\356l"
+	.string	"\245\016&+\257)\272\036-\250p\020*g\306|\334\270\254\272)f\362R\346\210`\024,8Z\222p\212[\202\241`'\370\t\346\302)\340,\034\305*\340-\334\004C1\026\326\302\317\013\305L0\022\307I\260\022\357\3013\256\034\016IZc\212\243\244\\L\231`\035\230G\b$\246\215\013i\022f\202\205\340!:\312\347n\3364\345\210c\366\326\260\310\2226d\317\t\3235\033,'\212\302\021.-/n\231\b\333W\0256\202\213\354\226H}\230\025\321\236\003\244\n[\371\310,\211Y\313\201\253\2360\220\236\221\027MB\230\360\217\034$\355=:\355\275\251\366\236T{\317\214\007\336aU\265\005\3679\232\346\353\245\301\222\346\b\323\336\213j\357!\321\336\243\322\336\203\322\031\\\013;\374\264BL\314\307g\357)\365\rlc\247\226\302vR\303qAB b\361\307\210\325\276\013?\343q(\270\266*\2608\034\212"
+	.string	"\"Q\302x\034\022\200\t\243\225\204 Q\b\324\343B\037\216?`\206\0202@\342\304\217\210_\b#,0\302\357\247\304\317\004\t\036\027\372P\201\023$L\200h\327 VM\001,\016\177V\266\370\343Sa,\376\\h\215 \202\214\353\021\207\b\3645\307_\257\375\021\203\2145\304 #^M\020\036\363\361\270\262\301\240\312Sa,\0023\333\032\261\347\250`\333\2430h-\361\353\t\256\304 \341P\345\005\327#Q^\217<W[5\370\0132~\320aU!`\036\032\207\326\023%\202\214\002\260\320\376zGv-\022\262A\013\324V\035\241s\374\3652\260s\242h\267\376n\326`q(\257?\013\034\215E\336\332\252%\364j\202\320\204n5\333\013\252\353\004\206B\365\004\273\002\001\021E\300\250\355\261m\tk\221p\005\256%zR"
+	.string	"U\024\303\241z\\\217\352:\\\331\n\216\307\025XdK"
+	.string	"\376\326!aK$bA"
+	.string	"\201\004p\fR\207\"\004\2518-\317\004\255\220H\"ghm\217*L\370"
+	.string	"\020\\\215J\374pp\340\260X\214\300\257&"
+	.string	"\031|hY\325\370am\325\326Dp\035\242P\211!\254D\341\020\273\266\353\210\0028P\310\256\3045H\373\006\035$\240\203\020F<\017\341A\006\036d\260\363\020\036\370\370x\320\201\217\366\016|p\273\376D\270\260\376\202$\214\212(x\353/\210(dU!\0239\255\013}"
+	.ascii	"Q\024R@\201\004)\216\352\b@\"\021Po\375\221h\331b\t\023\260\253"
+	.ascii	"\020H\330\022\327\240\360\306x\0342Z\203D\022k\253\262A\"\025"
+	.ascii	"\305\317\250\210\"\005P\035\242\230\300\2058\360\250;\274 b\261"
+	.ascii	"\002FB\021\212$\034\215A<B\300V\030\202\343\216\004\353O\204"
+	.ascii	"\237\243Q\002\030Zu\210-\002\375\326V%\n\203l\261\b\374Q\260"
+	.ascii	"\376Z!\021\0038\255\220HtC,\n\217B\340\312\032\177G\025\250\210"
+	.ascii	"\005\272\020$\022\025M\f\261\352PD\333\026\205&8q\024q\\\211"
+	.ascii	"\206j\006\202B\343\2055Hm\207\305\242\337p\270\002\177-k\341"
+	.ascii	"\310\026\217\304\365\370S\221\342\250b\b\244c\202\320o\r\022"
+	.ascii	"\265\302\266U\205\307\242\321\004\241_1X\374\245 \n\207E\352"
+	.ascii	"\220\005\027\372`\304\2020b-x\321\270\262 \332b\221\005\201s"
+	.ascii	"\374\005\t\201\210\305\037#\366\306\250\016\001\331\032v\r\n"
+	.ascii	"\213\212\2541\270\032\261CU\310\256G\036\243uh$\032\0014T\205"
+	.ascii	"n\206E`\261-\262F_\373\323@\001A\241MK$*\002\177@\354Oh<\376"
+	.ascii	"\214X\n\326\240\220e\327\242\342\217(\334\320\376xA\352\211\242"
+	.ascii	"\360\027D44\366\360\264\353qe\213-\221\372\013\022\205(~\255"
+	.ascii	"z\374\r\021\261m\212\325x\254\240\267\016U\340\361\246e\327\""
+	.ascii	"\242\360'<\036Y\034 \033\024\016\325\020\205C:\005p\025\002\032"
+	.ascii	"\251C\332w\374\031\252E\304\242\260U\207E#\273\266D\022@\226"
+	.ascii	"\202\343\272\262A\353\210u\030D\0241\244\376\024\031\201$\b\016"
+	.ascii	"\213B\307\225\025:\261\266j\221\260\005\212X\203\305\021X\241"
+	.ascii	"\332C\024v\340\243\201\353\221\350g\304\342\264\277\020-QH\304"
+	.ascii	"s\0060\340g\003\006H\220\200\006~P\301\266\353\320:\\[\020D\241"
+	.ascii	":\004\002\310\036A|\3300\\\211DU\b\3703\"R\177F\352\220/\353"
+	.ascii	"\337p\017%s22V\276*\202\306vU\343d\245Lc\304HN\342\022$\367>"
+	.ascii	"\332;\352i\203$Ht\026\220\0337\220\240\260C\202D\213\364\310"
+	.ascii	"\273\365l\025\211:r\315\364\234mb\332\320\212\310\310\221\273"
+	.ascii	"Z\001H\016\342\356A\362\220\313"
+	.ascii	"d\356\355\264\221`\f\320\344\024#\017\261\342\235\020e\314\315"
+	.ascii	"\252\212KT\016\013\267\270\262\361\246E\310\033\341\221E{\310"
+	.ascii	"y\005\2033\250B\0319I\342\b\031R3\"2#I\222\016\222\n\020\006"
+	.ascii	"\204I\036\310\222\017\022\340#=QR\310\b\311\210\210HA\212\n\n"
+	.ascii	"J\225a\f\340\202Z\361eL\177\037\340H\311\177#v\360V\275$\006"
+	.ascii	"\334MN\251\251\2039\321\342\002X\273\350\376y\017P\326.C\320"
+	.ascii	"\370\021r\324\027\345\356sf\270\r#\207s[\3620\214&\272\200\302"
+	.ascii	"\003\206\30680\322\343\311\023\215\337\206yLG\221\n\200\340)"
+	.ascii	"*ef-(\375ZL[\362\322\013n\311c\350\032\030\343\004,\001\222\223"
+	.ascii	"d<\375\215Q&S\3652\215\030\f\227\023\1774\261\217\367\\\332["
+	.ascii	": \030\301\0236b\301\221\336^\255\326\356\362%\315\277JV\f\236"
+	.ascii	"\231\034[\036m\202\205\317U\2151zz\265\327J$\2478?\320@w\342"
+	.ascii	"\225M\244Y\324\355\301S6 \f\253t\233\0275</\335\216\207TD\240"
+	.ascii	"e\003\265\301Hy\307\224\f\306\270\307:\300\351m\245Q\214\250"
+	.ascii	"\246C\017k\032F\0301`O_]5\212\362${J\004\360\353\3427\255\207"
+	.ascii	"\237\343'\253\351\226\033\331e2\215 \037\002f\023q]\366Xw!\b"
+	.ascii	"\367\022\273j\330\264(`\356o\263\343es\2142\r\342\347t:t\245"
+	.ascii	"\200Y\305\365\264Q\201\ta\243\255\274T\373Xi\006\324.\354/\221"
+	.ascii	"\035Ev\264\244\352N\322\276\326\217u\365\002\360\227\b\271\022"
+	.ascii	"\254\266X%pof\206||\260\377\315\351\210)\350v\353\332f[\344:"
+	.ascii	"X\207\327^$\266\344\032m\340\371O\2361E\307\026\323\205\240\377"
+	.ascii	"\372\177\327\016\265\226i\336gK\177\017\241\215{\214\247R\nS"
+	.ascii	"\260\306\243\233\320ts\205_\200\275\203|(\214(\221\257|\246\272"
+	.ascii	"\347\277X\363\237\275\006\215\344\201\335\020|m\037\366xbO\311"
+	.ascii	"\266\324^\320\311X\250\350\025z\006S\2338\264\263\270\013I\313"
+	.ascii	"\313\nx\262\213\024_'\211\007\215\251}\334L\263\212QJEyY\335"
+	.ascii	"=\362\\t<e\213\266\234\365\031pB\345\r\346\307\300\271a<\314"
+	.ascii	"\302\340}\365\005\2506"
+	.string	"\"R\215q!\220\t\344\264#\nG\302\324OF\232aA\231=\321$\2139\037\331\023\351=(\233\330s\324\222\277X\002\230 \204\257>\211\3724\325G\354\316\030\242-\006\023T\337(=s!P+\n{\255\375&b\r\320E\031@\350\242\225\345A\267PP\212\035;\373U-9\252I\360\322\201\305\242F\266\020D\212$Q\207\307L\241\016\362E\320T\250\365\004\177\216\026\225\347~\356L\371\020\264.5r)d-\016\027pO.\352\363\331\201\031B\336\244\311\026\333@)\301\214\b}\251R\307U\321\223\374)^2\256v]TS\242\300\305\364p\376y\246z\305\352\203&\227\327\222}\206\240\206m\270<*\255\255\230\302b\373e\234g0\345\260\364\344\037)\202\262\303tPSy\354\3019dH\016\020\004\\\322\225\303\327\275\233')\256\356[\254\313\n\365\004n\324\003y\200\331(1wZ\266\263\314*"
+	.string	"\304\301\277\203('\305\200\343\"X\237\354\232^\205\034\242[\201\002]O\035\307\007\241\3539\332\247(3\214\335)\036X/\337\211\375xw\235\256\300\307\300)\223\241K/\377\t6\234s\006]f\037u@\225\r\305\240a\025\006\260\242\215\335\342\203X\034\301\250I\027\201\177q\007\274.\212\r\n\343X\257\307yn\262\211\201/\252o\306\307)\312\326\344\247\306v\377k\24414\373\313\217$\004\023\227\022\244`\t\203\351\211\037h\004+Y\241N\037\224$\300\004$\026\177w8=#\227B\230\377\020\007\026\277\331Y3\226\341\325U\0347\213\323H\322{;\016;W\234,l<\030\023\310\252=\f\020\264MR\264\007\001e\365\351\2165\247+\346m\253\033\225-^?#E\201\032m\356\334\373z\270\321\256DRu\022\344\235\324\026"
+	.string	"{\323z?\240\343MG\205z\026\340\213\031o[\351\202B\205Em\364\233\t\242\314\205l=y>>17a\331a\026_A\314b\n\027\377\301\226\266\327\242\351qwS\302@\314N^\333\230\216J\334\205\351\236%#\254\325cv\317\261\264K\251k\342\262$\316I\271\322#j\002Q\354Gn\335\333\2132\023\333\352=7!\021\376:\026$\006\277\241\232\303\235\24496&\n\036\032PcL\244\352sZF7. \237\365f3\275\277\313\226H\005\273\023u\004P\034f+G\373\r\252>U\272\342~\235\262\347\335\324\033\245\260\333\233\002\0245\331\345\276\001]\252\341`;\263\215\342\360\203\2331\005\027\252\241\2272\365ta\201\217\261\257\226\363\343?\224Nh\004\021\020\367\005x\326\230T\216\321'(\n"
+	.string	"\317\240\374\270\245\262\006\252\365<\254"
+	.string	"\035\032P`\263\210\005\034\273\342Q\222\326\256A\2072\301$\035\201\t\213\201\361a2\r*i\354\314\234\330\013\376\\\344\037A\352\236\303`%\376A\370V 2.\245\264\255\024gi\001 <\030)\277\233\320\"\005\333\367p6"
+	.string	"\203P\255a\225\017\312\021C\274q\275\217\372\372\267\3142\323\236}\275Q\211X\307g\006F\022;\271\346)\376\362\026\224+\271w\300\365?\272\331\370\223\232\006m\377\b\024\335\312\351O\361\016P-\317P\246\t>g\334&t}\272\224\342\001\270\200O\224\305\260\364\355\031@\367\252\341\334f\313\342))\322\340\237b\370\374#Q\360\350*\2439\177\214\032\272x6Sy\f\217\211\313 G\0329\264\241\354"
+	.ascii	"q\332\320\244\346\277\361.\351\177\234!\253 \t\204\331\2408l"
+	.ascii	"\361\\wB\034\342\005\"e1\266'\222\002@L:\373\377^\271\035\003"
+	.ascii	"Z\325D\336ed{\214Jo@\305\370\320\267\017o\203Sj\0278\f\344\373"
+	.ascii	"\350\346\257x\303\214\003'\340\2170s\276\370\355\265\030l?O\270"
+	.ascii	"\331zo\364\350cd\233\205\344\257\375v\362\230i\265\260'\332Y"
+	.ascii	"\313\036\350$km\tL\2157\260\331/\330;\353\253\362\031\367[\305"
+	.ascii	"\312\242\343\312\354\371F\360\023\345\261\366\360\3516*\031\371"
+	.ascii	"f>[\\?\273\256\366fi\334\276[\344pTV=\301\253\025"
+	.text
+	.section	.gnu.lto_.symtab.885abb3f385318d7,"e",@progbits
+	.string	"telemetryInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\001"
+	.string	""
+	.string	"telemetryDetermineEnabledState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\001"
+	.string	""
+	.string	"telemetryConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"("
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001"
+	.string	""
+	.string	"telemetryCheckRxPortShared"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\001"
+	.string	""
+	.string	"telemetryCheckState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\001"
+	.string	""
+	.string	"telemetryProcess"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\001"
+	.string	""
+	.string	"releaseSharedTelemetryPorts"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\001"
+	.string	""
+	.string	"telemetrySharedPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\001"
+	.string	""
+	.string	"pgResetTemplate_telemetryConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\001"
+	.string	""
+	.string	"telemetryConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\002"
+	.string	""
+	.string	"telemetryConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"("
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\002"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\001"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\002"
+	.string	""
+	.string	"findNextSharedSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\002"
+	.string	""
+	.string	"mspSerialReleasePortIfAllocated"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\002"
+	.string	""
+	.string	"findSharedSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.885abb3f385318d7,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,668 @@
+	.file	"udplink.c"
+	.section	.gnu.lto_.profile.1303f838f44cf0b,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.1303f838f44cf0b,"e",@progbits
+	.string	"(\265/\375 \335\335\003"
+	.string	"\342E\024\036\260\031\032\003L\312\224@h\300\374\030l\223$A0,\202\244\222m%\331{\357-e\2222\246\353\373n\271\253\367\300\272Z\007\020\n\017\310\004\363\034\215>\237tBg\263\300(\026\b\207A\206$a8+\227\357\3746\374\376\354\001\256\310:XZ#\021"
+	.ascii	"Q\240[\335U\204\266\316ja%\354\316\033\320n\207\261b\240\251"
+	.ascii	"\026\351<\2742\341\345z\220uW,w\373\006\260"
+	.text
+	.section	.gnu.lto_.ipa_sra.1303f838f44cf0b,"e",@progbits
+	.string	"(\265/\375 \360U\003"
+	.string	"\024\003\344"
+	.string	"\004"
+	.string	"\004"
+	.string	"\003"
+	.string	""
+	.string	"\001\001\201\001\001\002\001"
+	.string	"\001"
+	.string	"\001\003\005\003\006\002\002"
+	.string	""
+	.string	"\003\006\001\002\017\002"
+	.string	""
+	.string	"\004\001"
+	.string	"\003\005\001\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030"
+	.string	"\200\300Qu9C\274\024\340\001\020\246"
+	.ascii	"\220\003\026@1\336G\025\002\b4\275 \013\004s;\226\032h*\200\316"
+	.ascii	"\303\231\2265\225.\245\035X\247s\205\240\347\r`\001"
+	.text
+	.section	.gnu.lto_.inline.1303f838f44cf0b,"e",@progbits
+	.string	"(\265/\375`\272\001\245\f"
+	.string	"\366RB>0\211(\351(H\225\275\214\027\342\026<I\335\342\343\334\177?{\225\261\341sg\005\231\326c\367\f\201\0028\005\337j\255P\273\2012Rk\025\003\235`Ht\211\210\276Z\344\244\265F\210\334)1"
+	.string	"1"
+	.string	"0"
+	.string	"\275\230\216,h\r$\217q\243NI\2334\374\224\246\373\257\346\244\331&\202\244\324\003\243\242t\343\376\314\250\256n\322:3\016$\303\b\205\212\367\273\005\002c[\376\336\001\333\30667\374\007\n^\250Q\007"
+	.string	"\006\200r8\314*\300\363\271`\335N\337}\033\345\220>0\344\031\317\336\026\225-\356d $\322\003\007N\"\3533\215Pa\202i\202\032\242\351\334\331Q\016\003m\001E\206\364+\b\267\344\245\372\2541\306\330\367\356\236\034\005\305\030%T\225\177J^\006c[\376\225\2648\t\017D\004~\371\0053g\202P\022=M\343\247\023\272\250\376\210f\251\246{\247\246\036RI[\201\304\346\362\262\362\342\336\030\027\240/A; P\002Q\212h\017\260\216\234\333\200\273\231\213\003Dj..\277\205/\020\363\323\002`\002\243\247\032\322\020\201\021;l\214\0137b\320\007\274\210\232\364-\246\276\3279\226\227\203\252\324\330\327`2\017S\221\020\314\003~FJ\355\214\260{C\340Nm/A2\312\t\204\034x\272"
+	.string	"\316\225.\220{"
+	.string	"\200\200\251"
+	.ascii	"\300\206a\021\366\2014\002\212@\013\"\021\304\035\246\224I-\b"
+	.ascii	"\254\345;VU\201G\236\007n\350\232\353\n0\004"
+	.text
+	.section	.gnu.lto_.jmpfuncs.1303f838f44cf0b,"e",@progbits
+	.string	"(\265/\375`\260\002\305\n"
+	.string	"\242M(*\200)I\0073BmF\334\217\261m\030H\230\331\210\366"
+	.string	"\003\305\004D\202\300\002\272\021\f\200(Z\226\265\315k\270l\274\211L2\214x\210{\204\223\"R\032\030\237\347a\003?\f\3150z\3541\347\240@zC\224\211\304\344\300J)@J)Q*\225\312\302\367\342\347\037^\030\275Fw\364\212\033n\257\376ji\364\200~\017\362\243\035g\207kU\267\304^b\235\nm'X\240\202YU\336\3132)\f2\213R\232\023\226p\375\252l\232\021\254\274\353\341\365L\232\323czM\357\336\351\277XD\f\001W\250q\311Cdaa*\313np\002\021ce\035\021\020\265\022 \207\346\246\302B\241\375\016\327o\320A`\213\026\361\367\007i\027\221\235H\326\303\272\025~\211!KR%\354l\221\322X9\3412Y1\351;\036@5\b\260*\202\222\322MA\017\331\022\302\352\203p\237\327\253X\200v\347S\316\036\236\ts\023\354,\253\272J\002\003"
+	.ascii	"\270\201-\356\241\314\231\261\304ndm\2043Qb1s\306[Lr\210`\305"
+	.ascii	"\263_|hO6D\3341\315\363Q\200\343XS\002\210\335R\317\311!|\357"
+	.ascii	"\321\031\341M\364)\250\361\003\361\350M\262{B\313\353\376\024"
+	.ascii	"]w\321\003"
+	.text
+	.section	.gnu.lto_.pureconst.1303f838f44cf0b,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\232\004\001\231\004\002\231\004\003\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.1303f838f44cf0b,"e",@progbits
+	.string	"(\265/\375 \315\205\003"
+	.string	"b\305\022\036\240'\351\377\377\347\004\360"
+	.string	"|T\2477^"
+	.string	"g1\034\016os\307\256\004\023K\b!r\247'\024\r\3049po"
+	.string	"\221\177\201\n\377b\334\265\267C\f4;\024hV\002S*'`K\307<\341i\277\256\023\326\003\326f\364?\002\016"
+	.string	")\013(\231\013\bE\363\235\232\210\230\314\n#@t\313i\227V\210\022\006\2206\363*\260m"
+	.ascii	"p"
+	.text
+	.section	.gnu.lto_.lto.1303f838f44cf0b,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_udpInit.7.1303f838f44cf0b,"e",@progbits
+	.string	"(\265/\375`w\005\365#"
+	.string	"\332Ah\016Ap\252Mc\bSlC\304Q\004\331\253[,`;\246pBRbd#X\341\370\007\343\310\212D\253\252#\373\366\370\026\342U\024\325"
+	.string	"\225\236\016\251\270\026\373\030K\037DR\340\333\322&{o)S\n\316"
+	.string	"\302"
+	.string	"\331"
+	.ascii	"\326"
+	.string	"\275\274\235\372E\353l\253\331H^\265\rZ\244\034\357\r\322\364\322\036N\t\024\322\237\321BpE\307\2639Q\266\276\214\215\316\335\333D\220\233{\257\223/\324\264\034u(\274\332\027\3631\351\207:>\340\336'^\334\334;tr\204\363\245\207\247m?\314\317R\333\350\201\007)%\n\230\231E\367^T\301\017\230/\311\0270_\332\262\247?qfI\332\232\372G\301\255\237\347\032;\216\214\212\263g\016\004\241\331M\362\301\361M\242]\020\214< f\005\370\342kX\360\253\226DN\222\013\2220Q\263\013z\221\t\372\344\341\242\013\362\250\226\214\202R\207\270\013v\221)\310\320^<\223\226 c\265\3420\334{]\201A!w\356\266\303l\343\260K\027\001g!U\017\264\201\243\230\360\216\331-\353\306E\216\021k\311\374\364\333\026D@^\325\315\267\366\324\343\330x\336{\241|8*x\001\314\356\275\247\242\303|Y\361"
+	.string	"\r!\325\001_{\275\215\246\335\213Q\017\274\375\026:z\276\354\226!\374j\177\361\003\212f\302\263C\\\365\315\036vUKf\237\274\366\211\235\253f`\253\231\236\366/\275\314\257\3643\177\322\207?\001\\5"
+	.string	"[\255\263\325G\266:wV\237\270j\323V\227\266\232\264\325\326VW[\375\006\267Bd;\203%\212e\033^\261\267FWO\t\347\312\325\214\205\241\253\007\017\222h\034\236-\272[\267\311W\3635\266\316\277\247\261%\343&<\273\367\352~\016]\352\201\247-\340c\310\350\350U\201\370\t6\"s\230K\366ieJ_~\264\221L#!Z\022\006\326N\303\234P\2126\350\212\222.\2664\206\024T&\353\257\311\240\301<\220\201\375\232\237\200\220\374(t\364\262[\266ooJ\226\311\272\202\215\325w0m\016o\353\260kcC\262 \\tH\251\"\335v\314\246\003\2606\b\021/\276i\311\301\334\264"
+	.ascii	"\254\353\327\026\277\017\215\235\231=\342|H\2744`ZKd\003\026"
+	.ascii	"I\262v\211\353\321:\221\366\b\022\242%\341\"-Y\372\216\2155@"
+	.ascii	"is\002\256\265\244\255\304?h\206t\3257\037\250Mwz\265\366\211"
+	.ascii	"\024\365@k\025|\331-\317\261q\251\315A[\265\026\220\037!\232"
+	.ascii	"\030\002\225\374\n\363i^\264\034KEH\005\370\265C\b"
+	.string	"\206\361t%\245\205\305\313\272\321\002\305\312\352\265@\177U/\234l\374\252z2\234&@\261\200\252`\003\345Q\375dLU\365P\037\326\017}\342UYY\037\257\206\217W\002\253wf\371\254\256H\037\025\225\024Iz\352)FUO\306\025\325\017\ra\342C\t4\213\367\302'\225\205V\365\244f\240S>,\364\211\311VW<\037\232ee\345CuC\256\223\327>1.\254\r\256\351(\350\200\255\231O\244\233*`ku\207\316\206\331\326Yc\340\262]\276M\242\216i\247%\273e\224&\344\r\356\310\372\210\200\320*\200\315sNR\262z\340\221\233\215\273\266\244\234\315\2111\313\336&\215b(kD\36321!m\246\226\231d\2376\206\030\310\253\272\035)\317)O\224VI`f\247W\216(\315b\240\355\320\2164\002\r5\250K\\\322g\250a4\305\020S\n\t\311\204\321\024\024$\035p\"\031\303\232\007\021"
+	.ascii	".\"\273\205l\215\001\237\336\304o\213\212n)\222\177\266#\233"
+	.ascii	"r\203\335\\'\200k1\312\256n\246\207\027\272\250,\205\370-\021"
+	.ascii	"\341aPoX\260F\024\207\344m<\"G\204\002\024\237\253r\241\007\236"
+	.ascii	"D\352\331xk\035\204\235\327U\006\221Z\004<l\371\254\373R}\325"
+	.ascii	"\217-P\023S]\3508\317\256y\307=\031!\244\302\314=\005\347\016"
+	.ascii	"\256\344HB\251\033t&*C\212\310l\234c{\311\316|\222\233\324\330"
+	.ascii	"qTO\375\030\235\204\255\216~e\347w}j\236\224\347Y\227\316S\356"
+	.ascii	"[9b\244)\316\027@\022TJ|\364;\3756\204\tt\317\333\313\374\t\220"
+	.ascii	"\246\271\205\257\200\r\fs\200\316\026\233\212RI2\327'\354\331"
+	.ascii	"\253"
+	.text
+	.section	.gnu.lto_udpSend.8.1303f838f44cf0b,"e",@progbits
+	.string	"(\265/\375`\031\001U\r"
+	.string	"\206\030XC"
+	.string	"\2614\035O\260$\016C\200\021L7f\236(\246\236\316\350\376{\340g \210\3662\217"
+	.string	"\256\243\251o\330\201r\320R\251Hc\372\322\031S\244\236.\344d>\243g\266\250As\200\263i7![\312\224\002B"
+	.string	"D"
+	.string	"E"
+	.string	"\033\222Q\261\373!p\002\353\223?\313\266O\342%:{\344 \003\214q\341bCcw\243\307\007P\237\340\005P\2374\304\273g\347\337\346\006D7\336\013\350Y\211\354\256\323{\341p\353m\037\260\315\300~L\257\371\255\323\374\325\277\037Vi\245\3229\245\357\231X\304\370\250\264\273\241Tc_L+F\330\266\005\221\026\r\377\200#C\222\261\240\375\270\335\331\036\333Zs!gA\3228\247\205\202\247\375\231\233\350\376\255\274c\003\237\274\247\n\327\203\202lcO\341\021"
+	.string	"\030\002\244T\216\231\253M\362\233\314!\207\341\3158\n\225\006$\317.\371\t\023kwCp*h\027\301\210X\241>]+\033^\007\226,\331\037(\025\204}\270\032\262\251t'\030\206,\005^\3345\002\241? %'\031\005\224\021\225\bA\302\203\b\221\303H\266\213\213'\331e\022?[J\004)`\r\005\333\"\247i[\364|{\270\032\352\250\007\213\266X\265\243w\271\321\221\001>\201\272\350\037\267\264\322T\373\n\035"
+	.ascii	"_\211\"\023O\307h\335\037*FD\005\021v\210\213\211H\202\t\246"
+	.ascii	"\264j\335s\223\314V\007\355\335{k\271\220_\301Z\210\214\f<c#"
+	.ascii	"P\325\300\0250\007\002\013\252\034\270\002\346\nT8\270\333\243"
+	.ascii	"Z\351\b\223\f"
+	.text
+	.section	.gnu.lto_udpRecv.9.1303f838f44cf0b,"e",@progbits
+	.string	"(\265/\375`|\005=$"
+	.string	"\332At\016JpXR:\333<\034\333\366;\265C2M@\314)e\223\254e\340\360|h<\3147\233\332c\210\037}\235S\366g\353\027\275#6\35117\276\373\246iR\363\372"
+	.string	"\312{/\266\023X:\232\013\305\032\351\337J>!d\357$\003\322"
+	.string	"\307"
+	.string	"\323"
+	.ascii	"k\353\344e\305\233\r\211\216RY\205{N\247@\264_\237}\307a\241"
+	.ascii	"N\255q\252e\362f#.g4\016c\035\345\201r\346e\003+4.\240\257\215"
+	.ascii	"\241U\357\2371T_\206\302\222\032\302a2\262@\270_\335\305\211"
+	.ascii	"\203\337\356{]I\361N\032\377\345\234\265\205\226\263SA/h\277"
+	.ascii	"\266\263}\222s\025\273\243\026\242T [\222bcr\316@\236\013`\277"
+	.ascii	"\252\307a\277\342\037\355\273\352|\253\267x\035\273\252\370\026"
+	.ascii	"\373K\343ux\311\363(\205.w\234U%\034!\303f\263D\252\367\031\005"
+	.ascii	"\344j\311\273\252\330J\333\225\3152J\215\300\374A\345l\2777\226"
+	.ascii	"\307\253\022\251:>\333\t\030y\223B\227U\277:\242\234s_\345\222"
+	.ascii	"\352\335\276\273ut7\212\356\265F9?\350.\272\232\321\327\2329"
+	.ascii	"g\241\257>\310\274\230\\a\236\356\034\306V\344\272\300`\254\325"
+	.ascii	"\3554\336\0028\276\246\032gu\373|\354\335\363\260\237\347_\277"
+	.ascii	"\201?\177\235\335\355\234;\177\002\273\3338\217\276\001\360n"
+	.ascii	"\377v\267}5\267ov\267mv\267kx\267iz\267{\275\333<\232\333;\336"
+	.ascii	"\355\226\346\266\216w\233\345\335^{\267\325\335m\314\273}w\267"
+	.ascii	"\377\363{\202I\237[[\260\324\231s\314\225\311nk\332\220"
+	.string	"G\377\261\037\372\233\375i\275\244f+g\223J\310\252\215kL6f \266\373\335_\353\263u/\372\243\346\261\254ja)\343,\321]\35479\331\317\256\326=\264?)>\355\005\321QJ\335\342\0227\242}\331\n\033;\301\217k0\336\361\005\311\244\301\335!~6\342\212\3650\r\017\367\260*\006Yd\207y\237^\007\357\260NZ\005\231\326\342n\022?+\201\247f\224r\270\305O\236\321M\037\203\325\301:\034\241\353(}\"a\2614\030\2409\200\031D)\267\342\213Y\274\226%\253T\274\342\265K\362\f\306\177KaU|d\231!\214\207\260\340\230X\035\357\034\207\277\005\0034\357\364\342_1\205\244=9\337Q\3668\007c,\270'\222>q\267\216\2669g\241~\025\017)\332 4\330\257\307W\373\017\314\215\331\345\365t\347V\254\325\fz`\037\274*o\3378\0260-P\227\314\325\234sV\261\326\177X"
+	.string	"\330\007\347\224!\231\307;\327\375 \333\335&\036%\370)\323\034H\301 \036\036\255\3000\210WI\350\002\023\205Mx\230\024$:-\t\223\220\210<\341\f\244\241ZD,:R\3256\nj\241\204\344\202\351\310\t\250A\304\205\020@\242\220ES\021\021\250\204T\224\0044j\032\002\203\016\364\022\223\260\tH\\Zj\002\366\234\3718\253\231\210\230\261=\030rxY\203\216\203\203\233\350\t\037\333\t:4{\241\346|5\364\264?\356K\367\303=\370e\3113\b\310\212G\240\034\350<\330"
+	.string	"\366%)v\335+\177X\315<\260QLGk\246;M\037\336y\335\340\356\242\222\267Mh\241OQ\312=\311\t\037\326\354\246p0\025\332?\2477\230\201Q\fL\n\325\261\023\206\352\n\213\265:\301m\260\212\336\271_\373\331\205{y?\003\373\265\253mP\326\340\356\016\037\356\2256X\rn\250q8\246\2201\204!\nhFR\322\2441p\002\021\272\252\036\020hY\2244\006_\374\005\355\354\363FBHU\274\006j\212\340\317J\004\031\020\342\237A.\343\234\243!\377\251\361\263\r\227f\256\243\2205U\305\235\207P\013?\355\370\rj\2733\246r-\242,\314\212r-\023\217\211xHx\2167\351\341\006-\274\323io\020\253O\234\3766\032F\266\377?f"
+	.ascii	"\005(\237\232\263\305vX\363 3t\356}\327f\302\246\001\264\320"
+	.ascii	"\350\f\276t\200^\364E\260\"\265L<H3\330r\032\tvG\276\254\352"
+	.ascii	"\367\020\374\202\026\016\016\251\0345q\230\342\374^\361\323\364"
+	.ascii	"\304\326\215\377#\3532\214\f)4\215\035\346\2220T\344\r\206\337"
+	.ascii	"TW\241\320\331&P\013O\261\224V@\215-\332\310))d*\001\006,\332"
+	.ascii	"\0041\025"
+	.text
+	.section	.gnu.lto_udpRecvBatch.10.1303f838f44cf0b,"e",@progbits
+	.string	"(\265/\375`\211\t\3355"
+	.ascii	"\332_\330\024@@\350M\007\241\330\367\317\244\224\367\"p\324\b"
+	.ascii	"E\f\327\370\037\315\301\267\201]\f\3708\210\210VT\311Tg`\020"
+	.ascii	"\323\2469\243e\027YG\333Jc\270\322>)\220\323J\215\226\364&{\313"
+	.ascii	"$S\n>\001$\001;\001>\327\354\036\347\323z\037\035%\220c9\326"
+	.ascii	"\"\036\317\323\272\\\026\t6)4VO\215\030\316\357\264\036\267\345"
+	.ascii	"9\t\026\002I\266\027c\365t\315\336\244\322\361:\255\277\365\300"
+	.ascii	"y\354\231\235\270\220\"\007\366b\365\324sqNC\215E\2369L\002\263"
+	.ascii	".\255\201\247\315bU\345\034\323\220H\341t\234S1\027ac\202\300"
+	.ascii	"\327\333\032\212\213\271\310\331\221\267\234\363\203\336\360"
+	.ascii	"m\200\020\302p\327ZOO\005\277\335\256\346kZ\177\016q\245\234"
+	.ascii	"\251\250y\313\371\371\240\251VO\373\271z\032Ok\273\241\370\351"
+	.ascii	"\f\363\263&J7\214r\316SFoR=\305\276\244z\372VX\243q\355\242\343"
+	.ascii	"\2477\306\255\013\331 p\375\251)\376\333\266{\271\220\211Gv\331"
+	.ascii	"2\017\342\371eF\323\316\230\211\2259\020\377\2144\341\342v`R"
+	.ascii	"\360\005G{p~\247\274\353\201*bc\376\273s\006eui\215\314\304\306"
+	.ascii	"\\\305\032\3168\302C\fK\342\333f\004\213\317\371\0010`\314\233"
+	.ascii	"\342\377#gF\f3\20234\255\320%\tC^\374\345\211\277\327\3715\024"
+	.ascii	"w\227''\354\211\337_U\316\271\3572L\314{\350\335\036\325\335"
+	.ascii	"=\272W\2758\347\234\361\243\271\224j\340\253\336\311-\331t\031"
+	.ascii	"jw\177\360\250\f\237\213\346\234/t\317ph\r\217s\346\234-x\352"
+	.ascii	"u\236 \316\222*\3154D_\267\357\377\017\237\032C\377h\rU\025\374"
+	.ascii	"\277\317y\002/:lym\210\220\267\257\373\351u\037\255\333\241\226"
+	.ascii	"\254\201\365S"
+	.string	"\351\256\302\340k\356\025\274\215;\205\t\016\307=\202\317\361\246r9\356\f\360m)\177\272/\3606w\005\370\266\321\001yG\271\2357\224\373\3616\200o?\245\267\013\bo\023\020\336\0360\274\355\204o\013\030\336\016@\274\335to3\to/\to\003\020\336V\022\336.\342\333I\3706\221\275=\024\336\026\no\263\303\333A\3666px{eo\377\330\333\252\360v\212oc|\373\331\333\027\337v\016w\n\2344F\207\356\232|\33637\351{\224\353R\270.\016\310\335\316\335\217\373\034\3677\3678w9\367>\276v;^\263v\b\230\32143w\315\332e(\343\341t\355u\315\372\221\212A6'\215Q\316\317\035\253\247\337\335\266\273\271\035\207\272\236\321\007\316\246\367(e}\313(\024\312\\#@~_\374\234a2}w{\346\"[\257\311\331\335\301\365\264i\222<}\274%\337\322Wx\246O\023%\305Px"
+	.string	"\277\004\365"
+	.ascii	"\336\357<\215++\244\214\344\202\f\265\221\371\035\270J\337\300"
+	.ascii	"\235\316\347\3325Dg7\007\017\327\227mL\276W\367\263\370J\357"
+	.ascii	"\377\305O1\307\226\367\346\t\221\230\235\372h\355\300\223\336"
+	.ascii	"F\033\270N\347vB8$o\037\241:\235CK,\211\337}\002\305\365e\322"
+	.ascii	"\343<\366^\355\300\375\211/\201\254/\331\034~w\n\267\243\342"
+	.ascii	"\272\021\376\220}\341\343DI0\301g}\2213\370\340\013!+\224\204"
+	.ascii	"\003~7\013\267\323\342\243\220\326\007\276+#}E\375\2502\370\365"
+	.ascii	"\177l\360 \363\332\320\374^\221\f&g\200\246\226%\237\372\367"
+	.ascii	"\177\237\272)\237\244\257~\252\247\214\204\337\275\371\250\351"
+	.ascii	"{\362\321\006\374\033\316\360\336\214!o_\313\305\371d09o\364"
+	.ascii	"\276\2335\267\300}\371K\375\237\341\265\241\351\027^\250\241"
+	.ascii	"k;\241\326\013\214U\313\020\325S\277cK\234M5j_\351\243u\004\262"
+	.ascii	"\257\372ty;\211\007b\033T\344:\362X\2165c\306\037s\034\263\360"
+	.ascii	"\321\352\352\307\026\226z\274\201\343\177t\335\256+\256?f\315"
+	.ascii	"\350\362\261u\225\205\325\025<j]\355\300]Z>\266\254\322\253 "
+	.ascii	"XG\234C\013\213\013\343\266\202\240C\013k\007\217\033>\246L\254"
+	.ascii	"\030\241b\252\353*\007W\215\256)-\254\032YSV\\\307)\b\007z\213"
+	.ascii	"\307\025\327T\327\326\026\327\024\373\314\376T\372\207\224S\326"
+	.ascii	"a\251H \315(\353\244\020\334\370I\276\253\276\036\331=\336\266"
+	.ascii	"\342\262\366\326n_\353\3009\233m\360>\356s"
+	.string	"\256\264\267&|\264\3769\nN\370\037\004l\340QT\037\325\207\215\372\tO\204Y(\331|\372\276c\"\032J\214\266w\234\352\351us\372\247\177(\201\217\360\005\336\223b\220\003\236@\324\017x\327;\273P\244\fT\tpz\307\363\213\206\211\231\246\032\265\340\203\333\336ZQ}\317\003\274\002\247\200+m\226\353K\252\013\326\320\244(\224S\300\003\325\276\002`5f\236\022\370h\r$\373a\370\037\2446p\250O\002\245\306Fw\223xz\310\326G\203z\f\357bey\311&\322\201\250\335\355\226\273\004\210\022 \033@f\0205u\271K\253\247\366\313E\322\206ar\316\265c\210Q\354\266\344\273J+\005\001\200\277\250a8\306\bC\306\231\231\221\246\240 i\rp\002\221\261\252\252\003\021p\271E6\233\324Y\346_\25008/6\205\326\226\243\371\216V\227\253`W@\312\343\033\321\032\311\232$t\356S,L\252\276"
+	.string	"\n\254\325`\026$\255\337\307l\"\231\312\256\253\t\\\343\357\3413 \034*\222\243\017\3566ki\301ckOh]\364\254\034X\374\366\027,[o\320G\221\323\320\332\221\302\330\375^\341\303\346\201\207\267)V:\223\341A\263\210\316\277\007\201\0167_\266,\210\325\277F4l\330\021a\375\005\370*\024\300\251C\030\350\310\353ag/\317~\3779\033\264&\225\257\355\n\210\322:6\\\030\016\321a\323\250_'\025\307tG"
+	.string	"\304q\007x\227c\204 \364\356\300\246?\374c\006d\001\322\007\364\264!=\341>5g\025\236\372\375NH\364_\"\2147`\270!\325w"
+	.string	"\020P\r\034\243\343\2604\323\030j\362\032\0247Rc\217\223^Li\032\205$\330(\024\"\362\3623\266A\264\356\355\210\222x\277\274\214\251\372qX\203\337\347\336\030A\"\303\265q\304&DW\233\315\242\263\316\343g\346\362B\226\2237\303Wz\352\027\317\264\346E\344\334\342\005\275\246\240\233\237#:\320"
+	.ascii	"\326\n,f\223\002\374\024\374\360DoN\266\305\035\3256\020\224"
+	.ascii	"\303/\007,\315\316\262\317`\321\212H\370\346h\277\227 \321/\360"
+	.ascii	"\375\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.1303f838f44cf0b,"e",@progbits
+	.string	"(\265/\375`!\001\025\007"
+	.string	"\202\312(1`M\323\001H8\210\312&8w\016G\0039g\344\201M\316\020\006\347 \b\202 \240\301x\204\f\035\241pOEs\214Y\322K\2156Y\"\267L\001\236`R\027\313\362\232\252\213\252/&u\261,\021SwIL\323\302\245\276+\223#\303\022a\254\016&\303\210\032$\023+\004\033kk\326\346\212\2165a\352HG\310\306c\245\200\254\023\237$N\020\361\002\210\017<\3349<j\270\304\360\267p\001\205\003\344\356\332\224\222\204\007$\302\241\352\342\243r\360\207r\247b=\354\333 \225dvw\2537f\233\031\004\032"
+	.ascii	"\240h7\243H\351\3525<\006\030\031d\005\233u\215\232\270\006\007"
+	.ascii	"j\007@\007@\007@\007@\007@\007@\007@\007@\347\003\231\304K\255"
+	.ascii	"\022\f\227=\235\211\223\n\331\340G\333\3161"
+	.text
+	.section	.gnu.lto_.refs.1303f838f44cf0b,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.1303f838f44cf0b,"e",@progbits
+	.string	"(\265/\375`\3413U\315"
+	.ascii	"\232B\255GT0\fY\233\306\242\033S\327u\275\272fa\032\3234=\274"
+	.ascii	"V\264\205\tM\323\364;\3145q:L\333J\372\n\365\304\b\375\372\226"
+	.ascii	"[w\361~\021\361Ja\026{\230]\005\306\327\276\022\215\025\362\234"
+	.ascii	"\307#Q\231\244\303-G\035z\353'\271\341LK\332\226R\312\024\367"
+	.ascii	"\003z\004X\004Y$VVpSH\227\207\310M\213\036]Z\322\027lecC\322"
+	.ascii	"\027\"N\245\2434\243\212$ib\024\027\035ix\300\270\232j\237\213"
+	.ascii	"\206\204>\260\003\004\307\220\220\227\226\236\023\246\016\265"
+	.ascii	"\341\265\300A:P\2730\254\237\241\3551\220\326x\235\352s\256\370"
+	.ascii	"!\201\321\007f\306\206a\271\340R\201S\224<_\244\305\b\266\307"
+	.ascii	"t-T\3570\325\b\304P\314\363\223\324\205X\226\250\242m\007\353"
+	.ascii	"h\260\200b\0211\212\255=\246\266\306\0323\277\256\033\024\372"
+	.ascii	"\032C\305\232~\022\213\013{b\033\020h \346\260j\217\221Z(\t\027"
+	.ascii	"\237\325\031\236\3012<\022\323\346\246\031'\006\231\030\326T"
+	.ascii	"\034\203\235{\357\222 \036~\204X\037\007\265\307(\026M, \342"
+	.ascii	"\311\\\005\301\240\235i+\313\0022x\304\272a$\206\265\342\nf]"
+	.ascii	";\260\276\211\032\220i~\2002\213\355\325\3729\370\340\036^\300"
+	.ascii	";H\342\234n\036\016\266v\022\2577\353\360r]\260\r2O\013\310\320"
+	.ascii	"\352\243!\270\367F\274\327kx{\334\302\353\343R\357\341\375\273"
+	.ascii	"\206\351\3363dfW\357\326\211a@\020\353n\035\336\261[o\235\330"
+	.ascii	"\bUY\202a\367\360\362]\275\r(\366N\272\"\361\232Ck\273\356\275"
+	.ascii	";t I\233S\301E\242\357 \276\202\227\360w"
+	.string	"\360\006\216\314L\357\240\276\027\220\334{\001k\205\212\3612\352\337\262\366\267\253\315 .W\373\233\325\276\003\035wG\236\252\2657J\201\202{O\363.\336\275\273{\227z\365.\217_\262[f\226\365\243\350\335\263\253\226\247S\310\233\274\037azw\355\302e*\264-\263A\024\2748\256\336\315q\353n\335\322\3266\3270\031W{O;h\350\320\241C\216\362\332\253\n\321\277Sv\307\233\270\273\247\243\3667\250\275rw\356R1\270t\277q\027\307\331\230\351\236\346:\270\231+\254\177y\332_\f\214yq\361b`\374\255i\361\315`\274p+0\276]\352\205\273nz\272\367;\370Q~\341.\333\275A23\335=\020\030\013\223q\335{\252\241C\210P\016%\033\255\257\322\336\266k\343RM\256\365W\354\206\03593\335\325\275\247%\026\336\344\326\332\260~\007\332_\023c\31151\276\204\366$\264\277j\005\020\301\036"
+	.ascii	"\362\255O\313\020\353\213\206\362\233\226\301\b\005\232\356\022"
+	.ascii	"\003\234Y\327\260>F\240}\003\332\273o\005\306\013\037Z}3\030"
+	.ascii	"9\334\n\214\277\324\213u\263\356W~\346D\267\330\336S\f\024\220"
+	.ascii	"!\324\207\365\365\272\325\337\257\333u\016>xvv\355\254\275\367"
+	.ascii	"\375\362 \272w\314\375*\371\261wL\311\275\027\334{\201\256a$"
+	.ascii	"Ef\324Gi\177\247\027@\314\376\340\307\366\270\345p3\0307\230"
+	.ascii	"\336\n\214\355\315`\374/\337\217w\250\376\273\343\277r\377\335"
+	.ascii	"\373\357\334\177\365\376\033\366\337\257\377\202\335\262\333"
+	.ascii	"\367_1\301\237\374\372\001?f\376\230\304\324\177\235~,\365\337"
+	.ascii	"\020\307\244\340\277*\374w\377\027\005\367\345\277\315\3772\357"
+	.ascii	"\201\013\365_\302\377\256\320\362\004\374:\203\037+\237\376\201"
+	.ascii	"\003\340\327\005\370\361\002\234\376\013\202\0377\375w\273\373"
+	.ascii	"\377\366\343\023\027\377\013\377\363\300CB\377\365\260\b-\376"
+	.ascii	"\023\376\317\373\177\375\261\005\202~\\\002\320\377C\354\001"
+	.ascii	"\026\377\025\360\037\203\037\257\370\357\312\217\177\376\233"
+	.ascii	"\260\301\2571\374\230\347\3072?n\376X\304\217?\360\343\020?&"
+	.ascii	"\341\307#\374\030\304\2177\370q\207\037\033\340\307\025\374\230"
+	.ascii	"\344\307\355\177\353\177\272\377v\377\023\377\373\343\277\206"
+	.ascii	"\377[\376/\377[\370_\034\377\355\372\257\340\177\301\377\002"
+	.ascii	"\3767\341\277~\3775\373/\331\177\307\376K\343\277W\377u\376\367"
+	.ascii	"\304\177Y\376K\342\177\220\377@\376\377\370\257\370?\304\177"
+	.ascii	"\r\376\307\375g\027\027\027\027\377\f\3427\256\374\031|\020i"
+	.ascii	"y\217er\326\364\354e5\0232\257\274\227\3272\235\017\003f\210"
+	.ascii	"\345\315\365e\276K\315{\031\3579/\353ih\177zz\336\214Z\177\332"
+	.ascii	"j\261\335\n\306\364$h\315^CSm\331\313\006EQ\0076\210\0043]\206"
+	.ascii	"\313qa{A\2029\376\007\242\006\212\254\331\003\272\313;\262]\346"
+	.ascii	"\221\347\262\216\\w\251\231.\313\321\345\033\371-F\252A\n\032"
+	.ascii	"R\265k\310\rTQ\325\005\375\026E\373vg\034\370Hgo\037\266?\362"
+	.ascii	"\265\177~\313nW\0248\321\354\226\2770\224\337\320\321\256\375"
+	.ascii	"\321\255\375\261\254\3751\253\375\261\252\375\261\251\375Q\332"
+	.ascii	"\336\275\317\262Y\310\340\335\r\033f\310\r\365\227X\3668]e\235"
+	.ascii	"yA\226\307\266\021\257\307V\036\373\263V\336\312aS7\251\215\365"
+	.ascii	"o\026W\366\272\322\022\024\313`\227\232\303\362W\007a\271\372"
+	.ascii	"?c\236\230\217\252\353\225\202\223\271\356ho\304\321\346i\246"
+	.ascii	"^\352\343r\327I\330l\306\342\260\276\261\255\375\n\367q\306\033"
+	.ascii	"\313Z\016z\337\f\306\214\205\362\234\365\f\026\336\224\004\261"
+	.ascii	">@\256\361\277\215\235\324\031p4n\266\327\203\n\353\246(\246"
+	.ascii	"%\245\244(\244\250\243(#\351\213\250,\225a\344\253<#Oe\252\f"
+	.ascii	"\225cd\253,#We\247\374t\2519*G\243\212\242\262\213(\257\032\035"
+	.ascii	":X\310\341\263\203\332\240krMVN~\306Ie\025A\230\262O\030\335"
+	.ascii	"Q\206\216\211\355<c\225W|\r\001\345\034\035\237|\203\030\226"
+	.ascii	"\207\200\020\345\035&jn!\227_d\244\334\224\231\2624\033\345h"
+	.ascii	"N\312Jy)\037e\027\271\350R3Q&\302X\031H\310\004\306\265\255\373"
+	.ascii	"\241\003\272Ah\314\030\305\"z\n\215e\276#\304\242 \257\222\352"
+	.ascii	"\222]^\220W\306\332Bl\301B\013\211\263\bF\305B+\003)\r\302\230"
+	.ascii	"\301\201\257-\237\237\031[\333\265!\236AG\320\254|$\245\240\332"
+	.ascii	"G9%j\033\264M\262\341\203\254\307i_\351\237 \022t\244\307\214"
+	.ascii	"\306\016\017\322\306:)\212\216\240$_\320\033A\235\350nux\264"
+	.ascii	"\320\240\307\030k\024\f\247\305f\351\234\364\254n\336\037\322"
+	.ascii	"\022\n\025lW\021\024\bW\273\364\342lvF\260et\205\216\330\311"
+	.ascii	"!\322\321<w\b\322\026M\016\350\355yz{\31221O\247\0250\307\020"
+	.ascii	"\256h2\302\372\035(b WD\213\331y\251y\343 \032\362\306W\234x"
+	.ascii	"\353\200\246\333'\304\350J\250\246\241\003\262M\016\216\312\250"
+	.ascii	"o|\3760\3560\341<\027\333\263\327\026\021o\245\375$\362\265g"
+	.ascii	"\355\332\037\3738$A\r\243\024X\367\270T|x\210\377\260\341\006"
+	.ascii	"\231\347\336=\016\240z\366\345\270v0\026\016-\361i}l\370\343"
+	.ascii	">\354\207\013G\242{\317X\250\241\366\331`\215\005\361\340\245"
+	.ascii	">\007&\374E\033\372\361\207\365\331\247v\205\375\3470b@\224\343"
+	.ascii	"@c\020D\0341\254KX\243\266\275\373\230\3579\266v\263\242:\367"
+	.ascii	"\356\220\204H1\\X\343\270\203{\273\323\303x\330\016\353\300<"
+	.ascii	"0\035\236\303u8\007\316\303;p\034\226\273T|\027\343v\343\316"
+	.ascii	"zg\343\256\215m\355N\355.\355\016\237\335y\241\265a<t\201\033"
+	.ascii	"t\0306\233!$\205c\204EmLc\365\344\203Y\244\321Y\341\032_5\030"
+	.ascii	"\007\306V\016\356\241J"
+	.ascii	";\302Ke9@\330\305\331\037\0216*S\244b0\022'\206\275\217\372\230"
+	.ascii	"p\324\255\003\272\260g\306\\\250a\034\370\r[\261\r\354\206\331"
+	.ascii	"\360\032n\303i\030\016\337\300gX\355R1\232\030F\303Xx\232\247"
+	.ascii	"T{\037\r\201\260\272\312\233\353`A\007d\020\024v\323\r- \333"
+	.ascii	"\241R\031\331\265\251\222JB\306\250\331\350\033\303b$?vIW\276"
+	.ascii	"\366\032\256\205c\213\341\364U%\203\036\311\034\025\361d\300"
+	.ascii	"\274p\327q\357./L\255\275\366jCf\352\252>\270\266P\254\322\200"
+	.ascii	"\340@k4I\013g\261gm\207x3\332k\245\266$\252Gt\213\306\025\323"
+	.ascii	"\023\254\006)G\344w\235\201e\300\271\3003\304\372:\250\275\266"
+	.ascii	"i\257b\220\fD\030U!\330\202\013\3132Po4\250\360\224H\325\215"
+	.ascii	"\237\035\305\366\271\257-\371\343)\354\203z\032\231\013z\316"
+	.ascii	"\b\351\031\372\222q\302M\331\n\2530k\256}>SJ\3127\246TBJIgOt"
+	.ascii	"\001x,t`\255y\224d\005\355\271V\333\341\034LoQXk\035\017\\\204"
+	.ascii	"\222Ja\255\353\262W\224\350L\bkM7\347f\275v\263\3528\020\364"
+	.ascii	"J\234\302t\254\300q\035W\343gh\207\265\206k\025\307\270x`\255"
+	.ascii	"\337n=\306\315\031\025\335\252\177\326\260\344\260\3267\324\312"
+	.ascii	"\256\317\312t\333\375y\313\233\273:\022U\255\340b\273nCVw\244"
+	.ascii	"<X\353\265[\357Wu5\304Z\253\225\340\005W\207\265N\273\025\tg"
+	.ascii	"\344#\210\265F{\240\r@\035\210X\233\211|\201\375`z\314\n\207"
+	.ascii	"\265u\335\033\310\304X\206C\352%v=\306\346\234\025\356a\255\303"
+	.ascii	"n\375O\217*\215UD\252\263\343\202\251\306uV\r]\315x#\333\331"
+	.ascii	"\265y\216ip5l\210Pq\250:\270\256\253\327^\034|\360\277\366J\006"
+	.ascii	"^\f\326\272\353\232\n$\307&8\325\324\037\031\002\003\251:\343"
+	.ascii	"\246\275\006m\327\212\255\377\341\030\1779\203Xk\255[G\200\362"
+	.ascii	"\256J\032\353\372\005\033\021\222\324\210\fOh\n\353\213\310T"
+	.ascii	"]\313\250\322W\332\306\3362\033Le\364\366s\310\244DG\327\017"
+	.ascii	"\350\214\353+\f\216PR?\256\030T\243\344\320\260\326V\327/\362"
+	.ascii	"\356\342\272\260\3261X\241\024}1`,\345\230#\004\322>\244\357"
+	.ascii	"\351:\352IO\335\256\315\0232\306$\203M\203\\Z\222\324\365\324"
+	.ascii	"\275\221\265\202p\270\005\226\314P\304\301\303ZC\205\265\217"
+	.ascii	"^\037Eu\223\206\250sp\003\255\347\023\310\244\245\223\322\302"
+	.ascii	"b\272n\n\311Q\242#\302Z/\335\032"
+	.string	"CV%\303Z#i\245\222;2&+\326:\311\202\034\366W-\252j\337#\307\221\350\3644Ya\255\245\327F?\022\351c#\005\325\376\372\005\217\021\215\032R\373\220(\013\026\232\b\005\027]\241\230rqM\264\005\326\302\013k=\244kra\317\013$\254\265\320\377\216wx=\372\260\326-\262\227\036\332\253a\302Z\007\335\232\025\r\363\242Xk\240\333\270~OTC)\240P\375\223\367&\352\233:\376)\366\021\252\270\376\301:;\\)\260\326)t\315\366\261\321\301Z\373\374\357:\225\365\364`\255{\262\327\2127\271\352\240q\216\347G\"\316\315\215\336\271@;\367\rJ\371\\\225\004\251\320\351\323\271\336\321,\336\004\271\260\3269\272\246]\323jrb\255q\036h\301\214\2724\224\275\346\214v\310`\375\020\231\3669H^\274\336\337\372\331\356\275/R\217\224\317u\003\001\231\030\023\261h(\332\\?o\035\331\033J"
+	.string	"\030%\243k2\333V\215\031]\243i\336hx\2447\221N\355h\fk\252\236\371\335\241\242\211\303Z\307\344@\343\315\220\236\017\326\332y\353\265Zk\362\303\372=\356\340\177\344\310\215O\033\021\326G\302\265?\376\215;\006\272\367\366a\247\033*3\362\313\336k\362[\270\371\"\340\277\376\237\201\t{\307\344\2503la\244\305\b\235\303\376\353\366\236\221:# \355\231\221\262xV\245\3339\023\345\304"
+	.ascii	"\335R\347\263\2727\206=3\343\034!\2721<\253\273g\323\330\365"
+	.ascii	"\334=\225:\367Ltc\3303;\206\303sF\332\363\254\306\364`xV\245"
+	.ascii	"=\273*\335\027\366L\f\024\305\314\206b\330U\351\340\256F{.<\253"
+	.ascii	"\321\236gU\332t\257(\242||\334\352\220\242.\3659\263wt\206b\240"
+	.ascii	"\027\352\236\323\350\326\333\373\212\325l(\002\366\036\212B\365"
+	.ascii	"bX\\5\231\272\035\031\263\230\350\265@G\306("
+	.string	"\272g\352\2361\242{\307\220!\261u<pN\3536\323\255s\036\r\355\234\232\275\t\240\263\267\363\356\272\275\267s\357}\204\016M\367nq\3419\245\243\2637\220\006\235=\344\\\253\331\033\213\361\251\365<\253FQ\2245\260\352\324\266\231:\357\324\326\223B\333\252\223\272s\n\333\251\236\024\204@\024q\233\216\214\032\212K91\377\270\324\254\230\021\025\363a\276\212 \301)\t^h`\020\234Q\277\r\314>>\242u\323#N\256}km\013\241\370\311\005\220\232a\341R\225SM&\274W*\344b\320\004\221x\205.\332\257@\300\022,\025IO\323,\344\232\242\325\317\237\337\345\312\222\"\363\3733Z\016)\315\224\225d\n\363\250l\252p\202\207f\362\003J2\031\362\001%\231\f1&IJ\270\274\210`\036]\232+K%\323\330T\032\233&\\\232Jf\310Ix\250\240\245\271T\021\301\236\204\207\021K\226\227&S"
+	.string	"--0\313\245\313\262\204\262\204\261\311\\\272\250\260\037PL\244\224\200yBr\311\322la\2019!\231\304p\022\036NRL\274\244X\200\254@\t\022H\2260\302\b\022\270\200\b\032\b\2214!D\0064 B2\031"
+	.ascii	"\021)\312\026]\002\227\027\022M\227\345qe\311r\202&\241\322L"
+	.ascii	"\231\300\310\t\025e\t+Ke\210&\313\222\004\023+0\307\253\260\274"
+	.ascii	"(\227\312\021\355=\370\240\301\007\020)\034\017\"\204\rB\330"
+	.ascii	"\300x\020!\240\240\204\360\001\245\375\007\224|\022\036\032\240"
+	.ascii	"\2424\301l\233\311\021K\227\026f\262\245%E\205\251\202\212\222"
+	.ascii	"\271l*\231\311\025\021\306f\222\203\016\232K\026\230\266\304"
+	.ascii	"\221\001/+$F0K\030\333fr\251lA.\225-\312\022)K\221\023.,'\\X"
+	.ascii	"BD\226\312\226\026\227\227\346\322E\205\2049\"\245E\004\362e"
+	.ascii	"\205\304\bf\t\020*\312\023.,\254\222\231rB\333L*M\300\3024.\225"
+	.ascii	"-\311\023.,-)'\232*0/M\346\tSiB\205\346I\b-)'\216\315\244\262"
+	.ascii	"\004K3\231lU\224\314\344\211\246\261\231d\256,]\230\311\244\005"
+	.ascii	"\025%\023&y\242yTQ\266(Q`\246\224H\256\210H&\221\314&\313\tI"
+	.ascii	"\346\212\210\246\362\204\251\002\363\004f9B\203\024`\226,-\032"
+	.ascii	"x\360!\371\001D\n\031|\300A\nmr\244\231\322L\261\220L~\300A\n"
+	.ascii	")\030ZVZV\226.\312\245\2132\231,\371\260\374\260$I&M\274\244"
+	.ascii	",\001\220\202\211\024L\2700YF\222I\027&\313\005\346\222\271\\"
+	.ascii	"\302$\223K\230d\262\244\231Da\311\202\001\023+0\310\223\270\340"
+	.ascii	".&\224/'M\027\227\227\023\221\026\027\227\t$\331\027\345\211"
+	.ascii	"\027e\b&K\273\"\002\2630\361\222%\211\202\212\013S\244\231La"
+	.ascii	"\212\250\320\302R\"EDH3y\022\036\226,'M\345\222\245\251\\\236"
+	.ascii	"(W`ZT\226,'/L\230\023\002\034\233I$\323\350\362\2424Ar\311\302"
+	.ascii	"lO\250(_t\363\305\305\204~I!\241"
+	.ascii	"\242\017\002\b\"p\330@\006*\320\252x@a\311\322bb\005\346\004"
+	.ascii	"\003&\220\020\342\244\251\034\361\222\322<Y\262\244\2248Qya\236"
+	.ascii	"x\340\360\262\262\222\242\253X\036c\234\336\f\r\225!v\032L\023"
+	.ascii	"#\271qhGC*\311d\n\310\026\305\312\344\031\251\2320(<v\261)\021"
+	.ascii	"\356I7m\222\263\245\037Y%hu\207<l\023\313\004\035\234\242\302"
+	.ascii	"z:\322C\307b\r\254\331$\366\005\322\224Mb\245,\322\255\003\332"
+	.ascii	"\273\307\204\216i+\261K\227\312&\341.|\274\231z\306\031\365Y"
+	.ascii	"\244\237-b\243\367K\0048G\b(\020k\326\b\345\354\3213H\211\305"
+	.ascii	"\305amaD\256\375H[{\301[\201\221\204%\322SFaw\212\323\017|7h"
+	.ascii	"CW0YABBU\222:\256E\246\026c%\330\310\202\n\322m[dG\321\333\225"
+	.ascii	"\005\322qL\2136\nY\300\324 \f\302\232\355a{\330\037\244s\001"
+	.ascii	"L;\200\256\033H\205\311\317\2528\373\303\246\020\333\353\301"
+	.ascii	"\225bI\354\n\2105\353s\245E9MA\355GvX\032\226\206\3459A\210@"
+	.ascii	"'\246\235\263<$.\306\240s"
+	.string	"X\263:\267\362\355+\254\331\0336g\344\016\210\324^\016\016I\013\0340\2448\031\017\211\327\203\t\005\326,\n\223\220\252\326\220\025\326\354\363VB\234\2472\326\346p\306\207\023k\303\326X\360\323g\305\326dD\262\"3\026X\177\204\346\360\220\225\241\241\327\227\303\202\323\335V\016\033sV\006I\252L\020k\366\316\nH\2055\273u\0207*\334\033\326zQ\007\031y*S\202\302Z'\352 N\213|\2008wb}@~xq\265)fB\221)4E>E\215\250\002\214G\214\307Sb\215\253\017\343\325\213,\032>p\220\022k\231T\\\020\275_O\033v\340*o\356\352Z\021n=\025^\033\316Um Xk\302\f\004\265\211a\255\005\365\340\213\300\020\245\324\377\035\020\206\037\333\026\326:0{\005\r]o`\255\001\221CS\264>\375w$\347\320\017\254\265\237\005#hBhh\201\355{h>/\275\253\""
+	.ascii	"\202\254\200\352\2758\032\027z\207xrr\032OC\324I\310\301\355"
+	.ascii	"\2317g\001o\215\305\337\216k<}'\242\026\204A\250\303\302\203"
+	.ascii	"\231\\\302\245\024c\020\315\f\215\244I:c\027@@8H0U\366R\363\001"
+	.ascii	"\023\200\020\213\243a\020kI\352\214\310\211\004\211\222$Iac\f"
+	.ascii	"\262U\270\252^g{Q\312\n\033\203\360w\331\037\362\240\236\233"
+	.ascii	"\023`R:\322:\267\256\211\366\243\0336\271b\036\202\315\007\240"
+	.ascii	"\372\334\361\263\3430\372\305\234Ng\350\333g\202\337\264z\355"
+	.ascii	"\375\231\302\001\330\034\177\277\246PY\347\223Z\320,\021c\327"
+	.ascii	"m\374\342\235k\303\250\224M\205\262y\301\226\273\267\003y\201"
+	.ascii	"Z\271\254~u5\r\013\355:\327\001\217[\232\205\006v\301\bW\024"
+	.ascii	"\233\201\256\034\271\320\212\315Y\214\255@"
+	.string	"\023\304#\237)\220\007\034|\224e\217\341\251\261\350\240\217\231m\351\271T1\222.|e9dZ\356(\303%'\016\256)\\\005\277\206.u\004.\3465\027\3043}\362\330\217\roNZ\232\275\221\252aS\215\234\346L4\227_\362\300\300\023X\324\205\236\221\316\321 }P\211\266\330`\221\264\2011\363\013\032\305d\\c5`Dy\316\214\374\006\277^\310\0046\215\307jl>\241o\020\\\022\237\230':P\343S\2009\013\t\216\236\b\247\247\007\352\003\327\037\274\247\305\372;\026t\272\234 @9\325%\nd\320\033T\232@\355aw\323N5*\261\215qy.\220N\\\206\261\036]\230\340\253\211$\242\351\211\370\270G\227,\036\261V?\231\307\266\233O(\025\031@\241)?\370c\312;\273\244y\034\201\241\024(\207_x\035?\303tTo\215\266\377\3525\347O{\274\032\032\370\244\205\201`\2078%P"
+	.string	"\005\206\344\210d\273\215r\366d\\\332V\250A\232'\004`\326\363$@W\343\034yK,\227\335\260\301_\215\246\tb\n\001\332\007\312,G\361\n\234g\2334\005\bh\232)\260\362\375\274\223\032\277\220\247\363\271y\305\263\354\n_k\0049\313F\265U\317\377H\224\350wW\374\215\036\376\207A\255\025\260\371\t\377e\261\n\274\0334\354\204Kd\026\017HJ\326\351c\334\217-GY'\374&(\3072\212\"\254\261\227_\022\002B\326\032\266d\007\023\372%\366O\344\331\263\177\256\207\301\027\333\213\005\217E"
+	.ascii	"\341\373\212\266\370H\346\002\005d\"\230\211\351\370\027\213"
+	.ascii	"\034~\263\243\016\242\357UBdB\351W-\367\337g\374`Z\343h\273\210"
+	.ascii	"\214\213\2115\261v\352\343\027\315\313_\350Q\252Qb3\274z\270"
+	.ascii	"a\240Y\362\224Zk\027yy\333n\303\322\247VX\"\r\277\250=\224\324"
+	.ascii	"\037I\305\351\227\fF\337\235\f\254g\231t\004h\250\367#\025e_"
+	.ascii	"%\f\340\247\275\332Ass\255\352}\3673\003,Q\216\"\242\204\273"
+	.ascii	"X\207\020\207_t\260\245\207y[\207\316TdQ\016M$S\213\3150,\021"
+	.ascii	"\307\314\340\245@\234\355kRKY\002%\203\321+a\355Ae\352\031\250"
+	.ascii	"6K\367\260\235I\357\371\013r\271\031.\361\303\365\364k\213\024"
+	.ascii	"3\255\265A9\267\374\021\3601\226Z@\241\347\037D\022\345\b\325"
+	.ascii	"\314O\005q\013\020\016o\356V|\326\017iZ\372AVNI\212\177\364\026"
+	.ascii	"\312\203D5"
+	.string	"\253\021\224\350\317\311\272\322\345\357=\231o\001hy\207E\206\351\352\252\220\260M\225Z\244\273G`\250\021\305\304\354\347\272%\242_$\325\374\202\244\"M\007\370\206\351qE%w\313q\007\211\376\266n\f\3724\031\334\323\2601\221\310\016\364/\235Qo\026z\033\"\3320mS\271L\346\364\355\254MA\313@u\325\234\317^J\365\255\334\231A\337\325\304\367m\036hN[\353\313,\001\364B\321Q\254;\007\\\306\206B\332K{\261\002cs\353&\203\362@7\253c\240\350\233\323\323R\365\n \224\227\301\220\242.\200T\3001@\2429\271ob\357\345\\\030\255\307\246N\207\205\334\003 \203H8S|\300\236\022\0327\035\206\256\022\026\375\236\354~I0d\253\003p\025%\242]<\242\024G\207\261\300\363\316\243:@\260\037\217Gv\310\261\347R\024=\310\315x:\254P\212\252\353\r(\345\210\207\036\003\001\277\333"
+	.ascii	"Q\322-\224\263z\301`,V\230\377E1^N*(\366;4O\374\363(wx\377\320"
+	.ascii	"SJ\030#/\325)\030\262\323\274\013x\355\313\367w\323\270\302$"
+	.ascii	"\255o\362Vr\250wHz\265\316\007\022\211\335\345\030;\003sA-\002"
+	.ascii	"\025|\227K\335\004\334\250\247\r\314\360\356\312\023\211`\231"
+	.ascii	"FFA#k\201W\016;,\202E\r\244; \005g7\020}\006\350\036\327|?o\013"
+	.ascii	"\022\222\316\236\3302!\016\216\365O;\262\322`\272\233\231\026"
+	.ascii	"\347\344\0266:\372\027\225&\3128\351\364~\22377\310\227\334\n"
+	.ascii	".\017*\254\314uc\236g\331\310\3173Tb\203Y\340\236\n\341\246\211"
+	.ascii	"\320c\377\376\202&7`\344\201B\264G\2174\273\324\263\f\330\306"
+	.ascii	"\303T\327\177\201\371f\001\200\225w\346Ys\023\377\323\343)\355"
+	.ascii	"\026\363Hk\003\361w\230\363.\335i!\002\303\026\304m\210\302<"
+	.ascii	"AC\372#\220,@\232\264\352\371:\207\0164\307\305\256\312Q;\271"
+	.ascii	"\030\f\tbq\276\006}\307\213\315\352\207\035\304\3568\034LlC\270"
+	.ascii	"#K\330)\264\335"
+	.string	"q\347\320\013\213\210\255(\257I\263\207\355i\275g\302\204T\373\020\204q\261l\"\227\tU\025A\342\363\303u?\342\331\214.\034/\036\305\033\267:\214e4;pm[\214\007xNR\264\030d=\224\030\264\206\\\321p5\201\006;\305\212\301\373[gK\001Ivk\354\013\023Nw\336\3302;s\265\234\310\325\373.p wD\210\b\032n\024\037\237\373\033"
+	.string	"*\030z\342l\004\277\024T\312\315{e\207\236>@\276\025\242\261Y\037\203\263k\377\370p\357\226\232\334?\030-\324\3169\324\250!u\227\227p~\242\233\272\026\332\377r\307=\236\001\376\244N\252\032x\312\305QEK\233Z\257\312\244S\215\364=\354\277\327k\370?\331Y\331\007\363\357\017\330x\213\327\360\037\203\235\355\313\311=v\256\002\320F\202\354\332\273\210Z\355\024(9\337\276\240\035\367z\006\t\346\241/\216\331\226W\005\306\271\202\214=\246R\371T\361_\212\311\"\351\264\376\341\221\204\210OT\244\353"
+	.string	"2XG\244\207\374\336?jdJ+}\033\203\274\251\004\207\237\327_\206\240sX\373\374<\336\017><\300\327q\234\004r\357\351\275\320J\023S\352#\261\255q\0079\216\313\001\323(\177\374\2406\f\226\334IQ\210\354\005\245\272\374\020E%\300W0\235\3177q\3347DT\005\301N\304'tP\344\352\342@\214\362\3129\213\317Y\322X\244\206\306\306\306\013K\025\022\347\256rLa\355}\031\007(\f4\277\003I\363\361r\025\253*\037i[:\003\221\257\332\350\371\265\310\004;^\204\322\326\200"
+	.ascii	"]\203TBM\236`\f\215ws\364/H\326\363\027B\025\3264T\261\374\022"
+	.ascii	"X\310/\252Q\336\344<\267\333\305\311\262dL\237\374\036\331?\364"
+	.ascii	"p\256\332\317\205\252\357\224\363m\0223\235#\352~g\316\013\273"
+	.ascii	"\230\032\177E\254\\f\b\277\022Z\037\376\363\370\231\205Lj\357"
+	.ascii	"\212\204\3778r\274\266\310\356\244\355\033\354U\356a\321\243"
+	.ascii	"\320\r\220\245\027\\ \n\222xS\254\343Y\323TV\033\036\226\270"
+	.ascii	"'\247o\255Y\313\343{\027\244\020\226\341zX\361s1\252\307\367"
+	.ascii	"}W"
+	.text
+	.section	.gnu.lto_.symtab.1303f838f44cf0b,"e",@progbits
+	.string	"udpInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\002"
+	.string	""
+	.string	"udpSend"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\002"
+	.string	""
+	.string	"udpRecv"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\002"
+	.string	""
+	.string	"udpRecvBatch"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\002"
+	.string	""
+	.string	"bind"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\002"
+	.string	""
+	.string	"inet_addr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\002"
+	.string	""
+	.string	"fcntl"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\002"
+	.string	""
+	.string	"setsockopt"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\002"
+	.string	""
+	.string	"socket"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\002"
+	.string	""
+	.string	"sendto"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\002"
+	.string	""
+	.string	"recvfrom"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\002"
+	.string	""
+	.string	"select"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\002"
+	.string	""
+	.string	"recvmmsg"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.1303f838f44cf0b,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
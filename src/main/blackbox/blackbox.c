@@ -55,6 +55,10 @@
 
 #include "flight/failsafe.h"
 #include "flight/mixer.h"
+#include "flight/ol_control.h"
+#include "flight/ol_filter.h"
+#include "flight/ol_flightplan.h"
+#include "flight/ol_ransac.h"
 #include "flight/pid.h"
 #include "flight/servos.h"
 
@@ -71,6 +75,8 @@
 #include "sensors/gyro.h"
 #include "sensors/rangefinder.h"
 
+#include "telemetry/mavlink_rx.h"
+
 enum {
     BLACKBOX_MODE_NORMAL = 0,
     BLACKBOX_MODE_MOTOR_TEST,
@@ -85,13 +91,14 @@ enum {
 #define DEFAULT_BLACKBOX_DEVICE     BLACKBOX_DEVICE_SERIAL
 #endif
 
-PG_REGISTER_WITH_RESET_TEMPLATE(blackboxConfig_t, blackboxConfig, PG_BLACKBOX_CONFIG, 1);
+PG_REGISTER_WITH_RESET_TEMPLATE(blackboxConfig_t, blackboxConfig, PG_BLACKBOX_CONFIG, 2);
 
 PG_RESET_TEMPLATE(blackboxConfig_t, blackboxConfig,
     .p_denom = 32,
     .device = DEFAULT_BLACKBOX_DEVICE,
     .record_acc = 1,
-    .mode = BLACKBOX_MODE_NORMAL
+    .mode = BLACKBOX_MODE_NORMAL,
+    .ol_denom = 0
 );
 
 #define BLACKBOX_SHUTDOWN_TIMEOUT_MILLIS 200
@@ -261,6 +268,59 @@ static const blackboxSimpleFieldDefinition_t blackboxSlowFields[] = {
     {"rxFlightChannelsValid", -1, UNSIGNED, PREDICT(0),      ENCODING(TAG2_3S32)}
 };
 
+/*
+ * Autonomous navigation frames: 'O' frames are intra coded, 'o' frames are deltas against the previous O/o frame.
+ * Positions are in cm, velocities in cm/s and angles in mrad, except where noted.
+ */
+static const blackboxDeltaFieldDefinition_t blackboxOlFields[] = {
+    {"time",        -1, UNSIGNED, .Ipredict = PREDICT(0), .Iencode = ENCODING(UNSIGNED_VB), .Ppredict = PREDICT(PREVIOUS), .Pencode = ENCODING(UNSIGNED_VB), CONDITION(ALWAYS)},
+    /* dr_state, moving smoothly so the deltas pack into the tagged encodings */
+    {"drPos",        0, SIGNED,   .Ipredict = PREDICT(0), .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS), .Pencode = ENCODING(TAG8_4S16), CONDITION(ALWAYS)},
+    {"drPos",        1, SIGNED,   .Ipredict = PREDICT(0), .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS), .Pencode = ENCODING(TAG8_4S16), CONDITION(ALWAYS)},
+    {"drPos",        2, SIGNED,   .Ipredict = PREDICT(0), .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS), .Pencode = ENCODING(TAG8_4S16), CONDITION(ALWAYS)},
+    {"drPsi",       -1, SIGNED,   .Ipredict = PREDICT(0), .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS), .Pencode = ENCODING(TAG8_4S16), CONDITION(ALWAYS)},
+    {"drVel",        0, SIGNED,   .Ipredict = PREDICT(0), .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS), .Pencode = ENCODING(TAG2_3S32), CONDITION(ALWAYS)},
+    {"drVel",        1, SIGNED,   .Ipredict = PREDICT(0), .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS), .Pencode = ENCODING(TAG2_3S32), CONDITION(ALWAYS)},
+    {"drVel",        2, SIGNED,   .Ipredict = PREDICT(0), .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS), .Pencode = ENCODING(TAG2_3S32), CONDITION(ALWAYS)},
+    /* dr_control: roll, pitch, yaw and altitude (cm) commands */
+    {"drCmd",        0, SIGNED,   .Ipredict = PREDICT(0), .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS), .Pencode = ENCODING(TAG8_4S16), CONDITION(ALWAYS)},
+    {"drCmd",        1, SIGNED,   .Ipredict = PREDICT(0), .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS), .Pencode = ENCODING(TAG8_4S16), CONDITION(ALWAYS)},
+    {"drCmd",        2, SIGNED,   .Ipredict = PREDICT(0), .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS), .Pencode = ENCODING(TAG8_4S16), CONDITION(ALWAYS)},
+    {"drCmd",        3, SIGNED,   .Ipredict = PREDICT(0), .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS), .Pencode = ENCODING(TAG8_4S16), CONDITION(ALWAYS)},
+    /* dr_fp navigation setpoint: x, y, altitude (cm) and heading */
+    {"drSet",        0, SIGNED,   .Ipredict = PREDICT(0), .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS), .Pencode = ENCODING(TAG8_4S16), CONDITION(ALWAYS)},
+    {"drSet",        1, SIGNED,   .Ipredict = PREDICT(0), .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS), .Pencode = ENCODING(TAG8_4S16), CONDITION(ALWAYS)},
+    {"drSet",        2, SIGNED,   .Ipredict = PREDICT(0), .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS), .Pencode = ENCODING(TAG8_4S16), CONDITION(ALWAYS)},
+    {"drSet",        3, SIGNED,   .Ipredict = PREDICT(0), .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS), .Pencode = ENCODING(TAG8_4S16), CONDITION(ALWAYS)},
+    /* Rarely changing flightplan and vision fields, usually all eight deltas are zero and cost a single byte */
+    {"drGateNr",    -1, UNSIGNED, .Ipredict = PREDICT(0), .Iencode = ENCODING(UNSIGNED_VB), .Ppredict = PREDICT(PREVIOUS), .Pencode = ENCODING(TAG8_8SVB), CONDITION(ALWAYS)},
+    {"drGate",       0, SIGNED,   .Ipredict = PREDICT(0), .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS), .Pencode = ENCODING(TAG8_8SVB), CONDITION(ALWAYS)},
+    {"drGate",       1, SIGNED,   .Ipredict = PREDICT(0), .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS), .Pencode = ENCODING(TAG8_8SVB), CONDITION(ALWAYS)},
+    {"drGate",       2, SIGNED,   .Ipredict = PREDICT(0), .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS), .Pencode = ENCODING(TAG8_8SVB), CONDITION(ALWAYS)},
+    {"drGate",       3, SIGNED,   .Ipredict = PREDICT(0), .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS), .Pencode = ENCODING(TAG8_8SVB), CONDITION(ALWAYS)},
+    {"drSpeedSet",  -1, SIGNED,   .Ipredict = PREDICT(0), .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS), .Pencode = ENCODING(TAG8_8SVB), CONDITION(ALWAYS)},
+    {"drPsiRef",    -1, SIGNED,   .Ipredict = PREDICT(0), .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS), .Pencode = ENCODING(TAG8_8SVB), CONDITION(ALWAYS)},
+    {"drVisionCnt", -1, UNSIGNED, .Ipredict = PREDICT(0), .Iencode = ENCODING(UNSIGNED_VB), .Ppredict = PREDICT(PREVIOUS), .Pencode = ENCODING(TAG8_8SVB), CONDITION(ALWAYS)},
+    /* dr_vision: gate relative to the drone and the time since it was captured (us) */
+    {"drVision",     0, SIGNED,   .Ipredict = PREDICT(0), .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS), .Pencode = ENCODING(TAG2_3S32), CONDITION(ALWAYS)},
+    {"drVision",     1, SIGNED,   .Ipredict = PREDICT(0), .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS), .Pencode = ENCODING(TAG2_3S32), CONDITION(ALWAYS)},
+    {"drVision",     2, SIGNED,   .Ipredict = PREDICT(0), .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS), .Pencode = ENCODING(TAG2_3S32), CONDITION(ALWAYS)},
+    {"drVisionAge", -1, SIGNED,   .Ipredict = PREDICT(0), .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS), .Pencode = ENCODING(SIGNED_VB), CONDITION(ALWAYS)},
+    /* dr_ransac drift fit: correction (mm), drift rate (mm/s), fit count, buffer size and dt_max (ms) */
+    {"drRansac",     0, SIGNED,   .Ipredict = PREDICT(0), .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS), .Pencode = ENCODING(TAG8_8SVB), CONDITION(ALWAYS)},
+    {"drRansac",     1, SIGNED,   .Ipredict = PREDICT(0), .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS), .Pencode = ENCODING(TAG8_8SVB), CONDITION(ALWAYS)},
+    {"drRansac",     2, SIGNED,   .Ipredict = PREDICT(0), .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS), .Pencode = ENCODING(TAG8_8SVB), CONDITION(ALWAYS)},
+    {"drRansac",     3, SIGNED,   .Ipredict = PREDICT(0), .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS), .Pencode = ENCODING(TAG8_8SVB), CONDITION(ALWAYS)},
+    {"drRansac",     4, SIGNED,   .Ipredict = PREDICT(0), .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS), .Pencode = ENCODING(TAG8_8SVB), CONDITION(ALWAYS)},
+    {"drRansac",     5, SIGNED,   .Ipredict = PREDICT(0), .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS), .Pencode = ENCODING(TAG8_8SVB), CONDITION(ALWAYS)},
+    {"drRansac",     6, SIGNED,   .Ipredict = PREDICT(0), .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS), .Pencode = ENCODING(TAG8_8SVB), CONDITION(ALWAYS)},
+    /* Setpoints from the companion computer: roll, pitch, yaw and altitude */
+    {"mavSet",       0, SIGNED,   .Ipredict = PREDICT(0), .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS), .Pencode = ENCODING(TAG8_4S16), CONDITION(MAVLINK)},
+    {"mavSet",       1, SIGNED,   .Ipredict = PREDICT(0), .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS), .Pencode = ENCODING(TAG8_4S16), CONDITION(MAVLINK)},
+    {"mavSet",       2, SIGNED,   .Ipredict = PREDICT(0), .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS), .Pencode = ENCODING(TAG8_4S16), CONDITION(MAVLINK)},
+    {"mavSet",       3, SIGNED,   .Ipredict = PREDICT(0), .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS), .Pencode = ENCODING(TAG8_4S16), CONDITION(MAVLINK)}
+};
+
 typedef enum BlackboxState {
     BLACKBOX_STATE_DISABLED = 0,
     BLACKBOX_STATE_STOPPED,
@@ -270,6 +330,7 @@ typedef enum BlackboxState {
     BLACKBOX_STATE_SEND_GPS_H_HEADER,
     BLACKBOX_STATE_SEND_GPS_G_HEADER,
     BLACKBOX_STATE_SEND_SLOW_HEADER,
+    BLACKBOX_STATE_SEND_OL_HEADER,
     BLACKBOX_STATE_SEND_SYSINFO,
     BLACKBOX_STATE_PAUSED,
     BLACKBOX_STATE_RUNNING,
@@ -309,12 +370,47 @@ typedef struct blackboxMainState_s {
     uint16_t rssi;
 } blackboxMainState_t;
 
+typedef struct blackboxOlState_s {
+    uint32_t time;
+
+    int32_t pos[4];         // x, y, z, psi
+    int32_t vel[XYZ_AXIS_COUNT];
+    int32_t cmd[4];
+    int32_t set[4];
+    int32_t plan[8];        // gate number, gate x, y, alt, psi, speed setpoint, psi_ref, vision count
+    int32_t vision[XYZ_AXIS_COUNT];
+    int32_t visionAge;
+    int32_t ransac[7];
+    int32_t mavSet[4];
+} blackboxOlState_t;
+
 typedef struct blackboxGpsState_s {
     int32_t GPS_home[2];
     int32_t GPS_coord[2];
     uint8_t GPS_numSat;
+    uint16_t homeIFrameIndex;   // I-frame at which the home frame was last written
 } blackboxGpsState_t;
 
+/*
+ * The PID loop only snapshots the main state of the iterations that get logged, the encoding and the device I/O happen
+ * in the blackbox task. When the task falls behind and the queue fills up, frames are dropped up to the next I-frame,
+ * which is preceded by a LOGGING_RESUME event so the decoder sees the gap instead of corrupt predictions.
+ */
+#ifndef BLACKBOX_FRAME_QUEUE_SIZE
+#define BLACKBOX_FRAME_QUEUE_SIZE 16
+#endif
+STATIC_ASSERT((BLACKBOX_FRAME_QUEUE_SIZE & (BLACKBOX_FRAME_QUEUE_SIZE - 1)) == 0 && BLACKBOX_FRAME_QUEUE_SIZE <= 128, blackbox_frame_queue_size_not_a_power_of_two);
+
+typedef struct blackboxFrame_s {
+    uint32_t iteration;
+    char type;          // 'I', 'P', 'O' or 'o'
+    bool resume;        // first frame after a pause or a drop
+    union {
+        blackboxMainState_t main;
+        blackboxOlState_t ol;
+    } state;
+} blackboxFrame_t;
+
 // This data is updated really infrequently:
 typedef struct blackboxSlowState_s {
     uint32_t flightModeFlags; // extend this data size (from uint16_t)
@@ -360,6 +456,8 @@ STATIC_UNIT_TESTED int16_t blackboxIInterval = 0;
 STATIC_UNIT_TESTED int16_t blackboxPInterval = 0;
 STATIC_UNIT_TESTED int32_t blackboxSInterval = 0;
 STATIC_UNIT_TESTED int32_t blackboxSlowFrameIterationTimer;
+static uint16_t blackboxOlFrameIndex;
+static bool blackboxOlIntraDue;     // the next O frame is intra coded, set by every main I-frame
 static bool blackboxLoggedAnyFrames;
 
 /*
@@ -371,6 +469,7 @@ static uint16_t vbatReference;
 
 static blackboxGpsState_t gpsHistory;
 static blackboxSlowState_t slowHistory;
+static blackboxOlState_t olHistory;
 
 // Keep a history of length 2, plus a buffer for MW to store the new values into
 static blackboxMainState_t blackboxHistoryRing[3];
@@ -380,6 +479,15 @@ static blackboxMainState_t* blackboxHistory[3];
 
 static bool blackboxModeActivationConditionPresent = false;
 
+// Single producer (PID loop), single consumer (blackbox task)
+static blackboxFrame_t blackboxFrameQueue[BLACKBOX_FRAME_QUEUE_SIZE];
+static uint8_t blackboxFrameQueueHead;
+static uint8_t blackboxFrameQueueTail;
+static bool blackboxFrameGap;       // frames were dropped, skip P-frames until the next I-frame
+static uint32_t blackboxDroppedFrames;
+
+static void writeQueuedFrames(void);
+
 /**
  * Return true if it is safe to edit the Blackbox configuration.
  */
@@ -456,6 +564,16 @@ static bool testBlackboxConditionUncached(FlightLogFieldCondition condition)
     case FLIGHT_LOG_FIELD_CONDITION_DEBUG:
         return debugMode != DEBUG_NONE;
 
+    case FLIGHT_LOG_FIELD_CONDITION_OL:
+        return blackboxConfig()->ol_denom != 0;
+
+    case FLIGHT_LOG_FIELD_CONDITION_MAVLINK:
+#if defined(USE_TELEMETRY) && defined(USE_TELEMETRY_MAVLINK)
+        return findSerialPortConfig(FUNCTION_TELEMETRY_MAVLINK) != NULL;
+#else
+        return false;
+#endif
+
     case FLIGHT_LOG_FIELD_CONDITION_NEVER:
         return false;
 
@@ -495,6 +613,7 @@ static void blackboxSetState(BlackboxState newState)
     case BLACKBOX_STATE_SEND_GPS_G_HEADER:
     case BLACKBOX_STATE_SEND_GPS_H_HEADER:
     case BLACKBOX_STATE_SEND_SLOW_HEADER:
+    case BLACKBOX_STATE_SEND_OL_HEADER:
         xmitState.headerIndex = 0;
         xmitState.u.fieldIndex = -1;
         break;
@@ -513,33 +632,36 @@ static void blackboxSetState(BlackboxState newState)
     blackboxState = newState;
 }
 
-static void writeIntraframe(void)
+static void writeIntraframe(uint32_t iteration)
 {
+    uint8_t frame[BLACKBOX_MAX_FRAME_SIZE];
+    uint8_t *pos = frame;
+
     blackboxMainState_t *blackboxCurrent = blackboxHistory[0];
 
-    blackboxWrite('I');
+    *pos++ = 'I';
 
-    blackboxWriteUnsignedVB(blackboxIteration);
-    blackboxWriteUnsignedVB(blackboxCurrent->time);
+    pos = blackboxEncodeUnsignedVB(pos, iteration);
+    pos = blackboxEncodeUnsignedVB(pos, blackboxCurrent->time);
 
-    blackboxWriteSignedVBArray(blackboxCurrent->axisPID_P, XYZ_AXIS_COUNT);
-    blackboxWriteSignedVBArray(blackboxCurrent->axisPID_I, XYZ_AXIS_COUNT);
+    pos = blackboxEncodeSignedVBArray(pos, blackboxCurrent->axisPID_P, XYZ_AXIS_COUNT);
+    pos = blackboxEncodeSignedVBArray(pos, blackboxCurrent->axisPID_I, XYZ_AXIS_COUNT);
 
     // Don't bother writing the current D term if the corresponding PID setting is zero
     for (int x = 0; x < XYZ_AXIS_COUNT; x++) {
         if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_NONZERO_PID_D_0 + x)) {
-            blackboxWriteSignedVB(blackboxCurrent->axisPID_D[x]);
+            pos = blackboxEncodeSignedVB(pos, blackboxCurrent->axisPID_D[x]);
         }
     }
 
     // Write roll, pitch and yaw first:
-    blackboxWriteSigned16VBArray(blackboxCurrent->rcCommand, 3);
+    pos = blackboxEncodeSigned16VBArray(pos, blackboxCurrent->rcCommand, 3);
 
     /*
      * Write the throttle separately from the rest of the RC data so we can apply a predictor to it.
      * Throttle lies in range [minthrottle..maxthrottle]:
      */
-    blackboxWriteUnsignedVB(blackboxCurrent->rcCommand[THROTTLE] - motorConfig()->minthrottle);
+    pos = blackboxEncodeUnsignedVB(pos, blackboxCurrent->rcCommand[THROTTLE] - motorConfig()->minthrottle);
 
     if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_VBAT)) {
         /*
@@ -548,59 +670,61 @@ static void writeIntraframe(void)
          *
          * Write 14 bits even if the number is negative (which would otherwise result in 32 bits)
          */
-        blackboxWriteUnsignedVB((vbatReference - blackboxCurrent->vbatLatest) & 0x3FFF);
+        pos = blackboxEncodeUnsignedVB(pos, (vbatReference - blackboxCurrent->vbatLatest) & 0x3FFF);
     }
 
     if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_AMPERAGE_ADC)) {
         // 12bit value directly from ADC
-        blackboxWriteUnsignedVB(blackboxCurrent->amperageLatest);
+        pos = blackboxEncodeUnsignedVB(pos, blackboxCurrent->amperageLatest);
     }
 
 #ifdef USE_MAG
     if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_MAG)) {
-        blackboxWriteSigned16VBArray(blackboxCurrent->magADC, XYZ_AXIS_COUNT);
+        pos = blackboxEncodeSigned16VBArray(pos, blackboxCurrent->magADC, XYZ_AXIS_COUNT);
     }
 #endif
 
 #ifdef USE_BARO
     if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_BARO)) {
-        blackboxWriteSignedVB(blackboxCurrent->BaroAlt);
+        pos = blackboxEncodeSignedVB(pos, blackboxCurrent->BaroAlt);
     }
 #endif
 
 #ifdef USE_RANGEFINDER
     if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_RANGEFINDER)) {
-        blackboxWriteSignedVB(blackboxCurrent->surfaceRaw);
+        pos = blackboxEncodeSignedVB(pos, blackboxCurrent->surfaceRaw);
     }
 #endif
 
     if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_RSSI)) {
-        blackboxWriteUnsignedVB(blackboxCurrent->rssi);
+        pos = blackboxEncodeUnsignedVB(pos, blackboxCurrent->rssi);
     }
 
-    blackboxWriteSigned16VBArray(blackboxCurrent->gyroADC, XYZ_AXIS_COUNT);
+    pos = blackboxEncodeSigned16VBArray(pos, blackboxCurrent->gyroADC, XYZ_AXIS_COUNT);
     if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_ACC)) {
-        blackboxWriteSigned16VBArray(blackboxCurrent->accADC, XYZ_AXIS_COUNT);
+        pos = blackboxEncodeSigned16VBArray(pos, blackboxCurrent->accADC, XYZ_AXIS_COUNT);
     }
 
     if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_DEBUG)) {
-        blackboxWriteSigned16VBArray(blackboxCurrent->debug, DEBUG16_VALUE_COUNT);
+        pos = blackboxEncodeSigned16VBArray(pos, blackboxCurrent->debug, DEBUG16_VALUE_COUNT);
     }
 
     //Motors can be below minimum output when disarmed, but that doesn't happen much
-    blackboxWriteUnsignedVB(blackboxCurrent->motor[0] - motorOutputLow);
+    pos = blackboxEncodeUnsignedVB(pos, blackboxCurrent->motor[0] - motorOutputLow);
 
     //Motors tend to be similar to each other so use the first motor's value as a predictor of the others
     const int motorCount = getMotorCount();
     for (int x = 1; x < motorCount; x++) {
-        blackboxWriteSignedVB(blackboxCurrent->motor[x] - blackboxCurrent->motor[0]);
+        pos = blackboxEncodeSignedVB(pos, blackboxCurrent->motor[x] - blackboxCurrent->motor[0]);
     }
 
     if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_TRICOPTER)) {
         //Assume the tail spends most of its time around the center
-        blackboxWriteSignedVB(blackboxCurrent->servo[5] - 1500);
+        pos = blackboxEncodeSignedVB(pos, blackboxCurrent->servo[5] - 1500);
     }
 
+    blackboxWriteBuf(frame, pos - frame);
+
     //Rotate our history buffers:
 
     //The current state becomes the new "before" state
@@ -613,7 +737,7 @@ static void writeIntraframe(void)
     blackboxLoggedAnyFrames = true;
 }
 
-static void blackboxWriteMainStateArrayUsingAveragePredictor(int arrOffsetInHistory, int count)
+static uint8_t *blackboxEncodeMainStateArrayUsingAveragePredictor(uint8_t *pos, int arrOffsetInHistory, int count)
 {
     int16_t *curr  = (int16_t*) ((char*) (blackboxHistory[0]) + arrOffsetInHistory);
     int16_t *prev1 = (int16_t*) ((char*) (blackboxHistory[1]) + arrOffsetInHistory);
@@ -623,16 +747,20 @@ static void blackboxWriteMainStateArrayUsingAveragePredictor(int arrOffsetInHist
         // Predictor is the average of the previous two history states
         int32_t predictor = (prev1[i] + prev2[i]) / 2;
 
-        blackboxWriteSignedVB(curr[i] - predictor);
+        pos = blackboxEncodeSignedVB(pos, curr[i] - predictor);
     }
+    return pos;
 }
 
 static void writeInterframe(void)
 {
+    uint8_t frame[BLACKBOX_MAX_FRAME_SIZE];
+    uint8_t *pos = frame;
+
     blackboxMainState_t *blackboxCurrent = blackboxHistory[0];
     blackboxMainState_t *blackboxLast = blackboxHistory[1];
 
-    blackboxWrite('P');
+    *pos++ = 'P';
 
     //No need to store iteration count since its delta is always 1
 
@@ -640,18 +768,18 @@ static void writeInterframe(void)
      * Since the difference between the difference between successive times will be nearly zero (due to consistent
      * looptime spacing), use second-order differences.
      */
-    blackboxWriteSignedVB((int32_t) (blackboxHistory[0]->time - 2 * blackboxHistory[1]->time + blackboxHistory[2]->time));
+    pos = blackboxEncodeSignedVB(pos, (int32_t) (blackboxHistory[0]->time - 2 * blackboxHistory[1]->time + blackboxHistory[2]->time));
 
     int32_t deltas[8];
     arraySubInt32(deltas, blackboxCurrent->axisPID_P, blackboxLast->axisPID_P, XYZ_AXIS_COUNT);
-    blackboxWriteSignedVBArray(deltas, XYZ_AXIS_COUNT);
+    pos = blackboxEncodeSignedVBArray(pos, deltas, XYZ_AXIS_COUNT);
 
     /*
      * The PID I field changes very slowly, most of the time +-2, so use an encoding
      * that can pack all three fields into one byte in that situation.
      */
     arraySubInt32(deltas, blackboxCurrent->axisPID_I, blackboxLast->axisPID_I, XYZ_AXIS_COUNT);
-    blackboxWriteTag2_3S32(deltas);
+    pos = blackboxEncodeTag2_3S32(pos, deltas);
 
     /*
      * The PID D term is frequently set to zero for yaw, which makes the result from the calculation
@@ -659,7 +787,7 @@ static void writeInterframe(void)
      */
     for (int x = 0; x < XYZ_AXIS_COUNT; x++) {
         if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_NONZERO_PID_D_0 + x)) {
-            blackboxWriteSignedVB(blackboxCurrent->axisPID_D[x] - blackboxLast->axisPID_D[x]);
+            pos = blackboxEncodeSignedVB(pos, blackboxCurrent->axisPID_D[x] - blackboxLast->axisPID_D[x]);
         }
     }
 
@@ -671,7 +799,7 @@ static void writeInterframe(void)
         deltas[x] = blackboxCurrent->rcCommand[x] - blackboxLast->rcCommand[x];
     }
 
-    blackboxWriteTag8_4S16(deltas);
+    pos = blackboxEncodeTag8_4S16(pos, deltas);
 
     //Check for sensors that are updated periodically (so deltas are normally zero)
     int optionalFieldCount = 0;
@@ -708,22 +836,24 @@ static void writeInterframe(void)
         deltas[optionalFieldCount++] = (int32_t) blackboxCurrent->rssi - blackboxLast->rssi;
     }
 
-    blackboxWriteTag8_8SVB(deltas, optionalFieldCount);
+    pos = blackboxEncodeTag8_8SVB(pos, deltas, optionalFieldCount);
 
     //Since gyros, accs and motors are noisy, base their predictions on the average of the history:
-    blackboxWriteMainStateArrayUsingAveragePredictor(offsetof(blackboxMainState_t, gyroADC),   XYZ_AXIS_COUNT);
+    pos = blackboxEncodeMainStateArrayUsingAveragePredictor(pos, offsetof(blackboxMainState_t, gyroADC),   XYZ_AXIS_COUNT);
     if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_ACC)) {
-        blackboxWriteMainStateArrayUsingAveragePredictor(offsetof(blackboxMainState_t, accADC), XYZ_AXIS_COUNT);
+        pos = blackboxEncodeMainStateArrayUsingAveragePredictor(pos, offsetof(blackboxMainState_t, accADC), XYZ_AXIS_COUNT);
     }
     if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_DEBUG)) {
-        blackboxWriteMainStateArrayUsingAveragePredictor(offsetof(blackboxMainState_t, debug), DEBUG16_VALUE_COUNT);
+        pos = blackboxEncodeMainStateArrayUsingAveragePredictor(pos, offsetof(blackboxMainState_t, debug), DEBUG16_VALUE_COUNT);
     }
-    blackboxWriteMainStateArrayUsingAveragePredictor(offsetof(blackboxMainState_t, motor),     getMotorCount());
+    pos = blackboxEncodeMainStateArrayUsingAveragePredictor(pos, offsetof(blackboxMainState_t, motor),     getMotorCount());
 
     if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_TRICOPTER)) {
-        blackboxWriteSignedVB(blackboxCurrent->servo[5] - blackboxLast->servo[5]);
+        pos = blackboxEncodeSignedVB(pos, blackboxCurrent->servo[5] - blackboxLast->servo[5]);
     }
 
+    blackboxWriteBuf(frame, pos - frame);
+
     //Rotate our history buffers
     blackboxHistory[2] = blackboxHistory[1];
     blackboxHistory[1] = blackboxHistory[0];
@@ -736,12 +866,15 @@ static void writeInterframe(void)
  * infrequently, delta updates are not reasonable, so we log independent frames. */
 static void writeSlowFrame(void)
 {
+    uint8_t frame[BLACKBOX_MAX_FRAME_SIZE];
+    uint8_t *pos = frame;
+
     int32_t values[3];
 
-    blackboxWrite('S');
+    *pos++ = 'S';
 
-    blackboxWriteUnsignedVB(slowHistory.flightModeFlags);
-    blackboxWriteUnsignedVB(slowHistory.stateFlags);
+    pos = blackboxEncodeUnsignedVB(pos, slowHistory.flightModeFlags);
+    pos = blackboxEncodeUnsignedVB(pos, slowHistory.stateFlags);
 
     /*
      * Most of the time these three values will be able to pack into one byte for us:
@@ -749,11 +882,79 @@ static void writeSlowFrame(void)
     values[0] = slowHistory.failsafePhase;
     values[1] = slowHistory.rxSignalReceived ? 1 : 0;
     values[2] = slowHistory.rxFlightChannelsValid ? 1 : 0;
-    blackboxWriteTag2_3S32(values);
+    pos = blackboxEncodeTag2_3S32(pos, values);
+
+    blackboxWriteBuf(frame, pos - frame);
 
     blackboxSlowFrameIterationTimer = 0;
 }
 
+static void writeOlIntraframe(blackboxOlState_t *ol)
+{
+    uint8_t frame[BLACKBOX_MAX_FRAME_SIZE];
+    uint8_t *pos = frame;
+
+    *pos++ = 'O';
+
+    pos = blackboxEncodeUnsignedVB(pos, ol->time);
+    pos = blackboxEncodeSignedVBArray(pos, ol->pos, ARRAYLEN(ol->pos));
+    pos = blackboxEncodeSignedVBArray(pos, ol->vel, ARRAYLEN(ol->vel));
+    pos = blackboxEncodeSignedVBArray(pos, ol->cmd, ARRAYLEN(ol->cmd));
+    pos = blackboxEncodeSignedVBArray(pos, ol->set, ARRAYLEN(ol->set));
+    pos = blackboxEncodeUnsignedVB(pos, ol->plan[0]);
+    pos = blackboxEncodeSignedVBArray(pos, ol->plan + 1, ARRAYLEN(ol->plan) - 2);
+    pos = blackboxEncodeUnsignedVB(pos, ol->plan[ARRAYLEN(ol->plan) - 1]);
+    pos = blackboxEncodeSignedVBArray(pos, ol->vision, ARRAYLEN(ol->vision));
+    pos = blackboxEncodeSignedVB(pos, ol->visionAge);
+    pos = blackboxEncodeSignedVBArray(pos, ol->ransac, ARRAYLEN(ol->ransac));
+    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_MAVLINK)) {
+        pos = blackboxEncodeSignedVBArray(pos, ol->mavSet, ARRAYLEN(ol->mavSet));
+    }
+
+    blackboxWriteBuf(frame, pos - frame);
+
+    memcpy(&olHistory, ol, sizeof(olHistory));
+}
+
+static void writeOlInterframe(blackboxOlState_t *ol)
+{
+    uint8_t frame[BLACKBOX_MAX_FRAME_SIZE];
+    uint8_t *pos = frame;
+
+    int32_t deltas[8];
+
+    *pos++ = 'o';
+
+    pos = blackboxEncodeUnsignedVB(pos, ol->time - olHistory.time);
+
+    /*
+     * Between two frames the navigation state moves by a few cm, so most groups fit in one or two bytes plus the tag.
+     */
+    arraySubInt32(deltas, ol->pos, olHistory.pos, ARRAYLEN(ol->pos));
+    pos = blackboxEncodeTag8_4S16(pos, deltas);
+    arraySubInt32(deltas, ol->vel, olHistory.vel, ARRAYLEN(ol->vel));
+    pos = blackboxEncodeTag2_3S32(pos, deltas);
+    arraySubInt32(deltas, ol->cmd, olHistory.cmd, ARRAYLEN(ol->cmd));
+    pos = blackboxEncodeTag8_4S16(pos, deltas);
+    arraySubInt32(deltas, ol->set, olHistory.set, ARRAYLEN(ol->set));
+    pos = blackboxEncodeTag8_4S16(pos, deltas);
+    arraySubInt32(deltas, ol->plan, olHistory.plan, ARRAYLEN(ol->plan));
+    pos = blackboxEncodeTag8_8SVB(pos, deltas, ARRAYLEN(ol->plan));
+    arraySubInt32(deltas, ol->vision, olHistory.vision, ARRAYLEN(ol->vision));
+    pos = blackboxEncodeTag2_3S32(pos, deltas);
+    pos = blackboxEncodeSignedVB(pos, ol->visionAge - olHistory.visionAge);
+    arraySubInt32(deltas, ol->ransac, olHistory.ransac, ARRAYLEN(ol->ransac));
+    pos = blackboxEncodeTag8_8SVB(pos, deltas, ARRAYLEN(ol->ransac));
+    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_MAVLINK)) {
+        arraySubInt32(deltas, ol->mavSet, olHistory.mavSet, ARRAYLEN(ol->mavSet));
+        pos = blackboxEncodeTag8_4S16(pos, deltas);
+    }
+
+    blackboxWriteBuf(frame, pos - frame);
+
+    memcpy(&olHistory, ol, sizeof(olHistory));
+}
+
 /**
  * Load rarely-changing values from the FC into the given structure
  */
@@ -824,6 +1025,8 @@ static void blackboxResetIterationTimers(void)
     blackboxIFrameIndex = 0;
     blackboxPFrameIndex = 0;
     blackboxSlowFrameIterationTimer = 0;
+    blackboxOlFrameIndex = 0;
+    blackboxOlIntraDue = true;
 }
 
 /**
@@ -839,11 +1042,16 @@ static void blackboxStart(void)
     }
 
     memset(&gpsHistory, 0, sizeof(gpsHistory));
+    gpsHistory.homeIFrameIndex = UINT16_MAX;
 
     blackboxHistory[0] = &blackboxHistoryRing[0];
     blackboxHistory[1] = &blackboxHistoryRing[1];
     blackboxHistory[2] = &blackboxHistoryRing[2];
 
+    blackboxFrameQueueHead = 0;
+    blackboxFrameQueueTail = 0;
+    blackboxFrameGap = false;
+
     vbatReference = getBatteryVoltageLatest();
 
     //No need to clear the content of blackboxHistoryRing since our first frame will be an intra which overwrites it
@@ -882,6 +1090,7 @@ void blackboxFinish(void)
         break;
     case BLACKBOX_STATE_RUNNING:
     case BLACKBOX_STATE_PAUSED:
+        writeQueuedFrames();
         blackboxLogEvent(FLIGHT_LOG_EVENT_LOG_END, NULL);
         FALLTHROUGH;
     default:
@@ -941,19 +1150,28 @@ static bool inMotorTestMode(void) {
 #ifdef USE_GPS
 static void writeGPSHomeFrame(void)
 {
-    blackboxWrite('H');
+    uint8_t frame[BLACKBOX_MAX_FRAME_SIZE];
+    uint8_t *pos = frame;
+
+    *pos++ = 'H';
 
-    blackboxWriteSignedVB(GPS_home[0]);
-    blackboxWriteSignedVB(GPS_home[1]);
+    pos = blackboxEncodeSignedVB(pos, GPS_home[0]);
+    pos = blackboxEncodeSignedVB(pos, GPS_home[1]);
     //TODO it'd be great if we could grab the GPS current time and write that too
 
+    blackboxWriteBuf(frame, pos - frame);
+
     gpsHistory.GPS_home[0] = GPS_home[0];
     gpsHistory.GPS_home[1] = GPS_home[1];
+    gpsHistory.homeIFrameIndex = blackboxIFrameIndex;
 }
 
 static void writeGPSFrame(timeUs_t currentTimeUs)
 {
-    blackboxWrite('G');
+    uint8_t frame[BLACKBOX_MAX_FRAME_SIZE];
+    uint8_t *pos = frame;
+
+    *pos++ = 'G';
 
     /*
      * If we're logging every frame, then a GPS frame always appears just after a frame with the
@@ -963,15 +1181,17 @@ static void writeGPSFrame(timeUs_t currentTimeUs)
      */
     if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_NOT_LOGGING_EVERY_FRAME)) {
         // Predict the time of the last frame in the main log
-        blackboxWriteUnsignedVB(currentTimeUs - blackboxHistory[1]->time);
+        pos = blackboxEncodeUnsignedVB(pos, currentTimeUs - blackboxHistory[1]->time);
     }
 
-    blackboxWriteUnsignedVB(gpsSol.numSat);
-    blackboxWriteSignedVB(gpsSol.llh.lat - gpsHistory.GPS_home[LAT]);
-    blackboxWriteSignedVB(gpsSol.llh.lon - gpsHistory.GPS_home[LON]);
-    blackboxWriteUnsignedVB(gpsSol.llh.alt);
-    blackboxWriteUnsignedVB(gpsSol.groundSpeed);
-    blackboxWriteUnsignedVB(gpsSol.groundCourse);
+    pos = blackboxEncodeUnsignedVB(pos, gpsSol.numSat);
+    pos = blackboxEncodeSignedVB(pos, gpsSol.llh.lat - gpsHistory.GPS_home[LAT]);
+    pos = blackboxEncodeSignedVB(pos, gpsSol.llh.lon - gpsHistory.GPS_home[LON]);
+    pos = blackboxEncodeUnsignedVB(pos, gpsSol.llh.alt);
+    pos = blackboxEncodeUnsignedVB(pos, gpsSol.groundSpeed);
+    pos = blackboxEncodeUnsignedVB(pos, gpsSol.groundCourse);
+
+    blackboxWriteBuf(frame, pos - frame);
 
     gpsHistory.GPS_numSat = gpsSol.numSat;
     gpsHistory.GPS_coord[LAT] = gpsSol.llh.lat;
@@ -980,13 +1200,11 @@ static void writeGPSFrame(timeUs_t currentTimeUs)
 #endif
 
 /**
- * Fill the current state of the blackbox using values read from the flight controller
+ * Fill the given state using values read from the flight controller
  */
-static void loadMainState(timeUs_t currentTimeUs)
+static void loadMainState(blackboxMainState_t *blackboxCurrent, timeUs_t currentTimeUs)
 {
 #ifndef UNIT_TEST
-    blackboxMainState_t *blackboxCurrent = blackboxHistory[0];
-
     blackboxCurrent->time = currentTimeUs;
 
     for (int i = 0; i < XYZ_AXIS_COUNT; i++) {
@@ -1032,10 +1250,166 @@ static void loadMainState(timeUs_t currentTimeUs)
     blackboxCurrent->servo[5] = servo[5];
 #endif
 #else
+    UNUSED(blackboxCurrent);
     UNUSED(currentTimeUs);
 #endif // UNIT_TEST
 }
 
+/**
+ * Fill the given state from the autonomous navigation, scaled to integers
+ */
+static void loadOlState(blackboxOlState_t *ol, timeUs_t currentTimeUs)
+{
+#ifndef UNIT_TEST
+    ol->time = currentTimeUs;
+
+    ol->pos[0] = lrintf(dr_state.x * 100);
+    ol->pos[1] = lrintf(dr_state.y * 100);
+    ol->pos[2] = lrintf(dr_state.z * 100);
+    ol->pos[3] = lrintf(dr_state.psi * 1000);
+    ol->vel[0] = lrintf(dr_state.vx * 100);
+    ol->vel[1] = lrintf(dr_state.vy * 100);
+    ol->vel[2] = lrintf(dr_state.vz * 100);
+
+    ol->cmd[0] = lrintf(dr_control.phi_cmd * 1000);
+    ol->cmd[1] = lrintf(dr_control.theta_cmd * 1000);
+    ol->cmd[2] = lrintf(dr_control.psi_cmd * 1000);
+    ol->cmd[3] = lrintf(dr_control.alt_cmd);
+
+    ol->set[0] = lrintf(dr_fp.x_set * 100);
+    ol->set[1] = lrintf(dr_fp.y_set * 100);
+    ol->set[2] = lrintf(dr_fp.alt_set);
+    ol->set[3] = lrintf(dr_fp.psi_set * 1000);
+
+    ol->plan[0] = dr_fp.gate_nr;
+    ol->plan[1] = lrintf(dr_fp.gate_x * 100);
+    ol->plan[2] = lrintf(dr_fp.gate_y * 100);
+    ol->plan[3] = lrintf(dr_fp.gate_alt);
+    ol->plan[4] = lrintf(dr_fp.gate_psi * 1000);
+    ol->plan[5] = lrintf(dr_fp.speed_set * 100);
+    ol->plan[6] = lrintf(dr_control.psi_ref * 1000);
+    ol->plan[7] = dr_vision.cnt;
+
+    ol->vision[0] = lrintf(dr_vision.dx * 100);
+    ol->vision[1] = lrintf(dr_vision.dy * 100);
+    ol->vision[2] = lrintf(dr_vision.dz * 100);
+    ol->visionAge = cmpTimeUs(currentTimeUs, dr_vision.time);
+
+    ol->ransac[0] = lrintf(dr_ransac.corr_x * 1000);
+    ol->ransac[1] = lrintf(dr_ransac.corr_y * 1000);
+    ol->ransac[2] = lrintf(dr_ransac.rate_x * 1000);
+    ol->ransac[3] = lrintf(dr_ransac.rate_y * 1000);
+    ol->ransac[4] = dr_ransac.fit_cnt;
+    ol->ransac[5] = dr_ransac.buf_size;
+    ol->ransac[6] = lrintf(dr_ransac.dt_max * 1000);
+
+#if defined(USE_TELEMETRY) && defined(USE_TELEMETRY_MAVLINK)
+    ol->mavSet[0] = lrintf(uart_roll * 1000);
+    ol->mavSet[1] = lrintf(uart_pitch * 1000);
+    ol->mavSet[2] = lrintf(uart_yaw * 1000);
+    ol->mavSet[3] = lrintf(uart_altitude);
+#else
+    memset(ol->mavSet, 0, sizeof(ol->mavSet));
+#endif
+#else
+    UNUSED(ol);
+    UNUSED(currentTimeUs);
+#endif // UNIT_TEST
+}
+
+/**
+ * Snapshot the main ('I', 'P') or navigation ('O', 'o') state into the frame queue, from the PID loop.
+ */
+static void blackboxQueueFrame(timeUs_t currentTimeUs, char type, bool resume)
+{
+    const uint8_t head = blackboxFrameQueueHead;
+    const uint8_t tail = __atomic_load_n(&blackboxFrameQueueTail, __ATOMIC_ACQUIRE);
+
+    if ((uint8_t)(head - tail) >= BLACKBOX_FRAME_QUEUE_SIZE) {
+        blackboxDroppedFrames++;
+        blackboxFrameGap = true;
+        return;
+    }
+
+    blackboxFrame_t *frame = &blackboxFrameQueue[head & (BLACKBOX_FRAME_QUEUE_SIZE - 1)];
+    frame->iteration = blackboxIteration;
+    frame->type = type;
+    frame->resume = resume;
+    if (type == 'O' || type == 'o') {
+        loadOlState(&frame->state.ol, currentTimeUs);
+    } else {
+        loadMainState(&frame->state.main, currentTimeUs);
+    }
+
+    __atomic_store_n(&blackboxFrameQueueHead, (uint8_t)(head + 1), __ATOMIC_RELEASE);
+}
+
+static void writeQueuedFrame(blackboxFrame_t *frame)
+{
+    if (frame->type == 'O') {
+        writeOlIntraframe(&frame->state.ol);
+        blackboxDeviceFlush();
+        return;
+    } else if (frame->type == 'o') {
+        writeOlInterframe(&frame->state.ol);
+        blackboxDeviceFlush();
+        return;
+    }
+
+    if (frame->resume) {
+        // Write a log entry so the decoder is aware that our large time/iteration skip is intended
+        flightLogEvent_loggingResume_t resume;
+
+        resume.logIteration = frame->iteration;
+        resume.currentTime = frame->state.main.time;
+
+        blackboxLogEvent(FLIGHT_LOG_EVENT_LOGGING_RESUME, (flightLogEventData_t *) &resume);
+    }
+
+    memcpy(blackboxHistory[0], &frame->state.main, sizeof(blackboxMainState_t));
+
+    if (frame->type == 'I') {
+        /*
+         * Don't log a slow frame if the slow data didn't change ("I" frames are already large enough without adding
+         * an additional item to write at the same time). Unless we're *only* logging "I" frames, then we have no choice.
+         */
+        if (blackboxIsOnlyLoggingIntraframes()) {
+            writeSlowFrameIfNeeded();
+        }
+        writeIntraframe(frame->iteration);
+    } else {
+        /*
+         * We assume that slow frames are only interesting in that they aid the interpretation of the main data stream.
+         * So only log slow frames during loop iterations where we log a main frame.
+         */
+        writeSlowFrameIfNeeded();
+        writeInterframe();
+    }
+
+    //Flush every frame so that our runtime variance is minimized
+    blackboxDeviceFlush();
+}
+
+/**
+ * Encode and write the frames the PID loop has queued, from the blackbox task.
+ */
+static void writeQueuedFrames(void)
+{
+    uint8_t tail = blackboxFrameQueueTail;
+    const uint8_t head = __atomic_load_n(&blackboxFrameQueueHead, __ATOMIC_ACQUIRE);
+
+    while (tail != head) {
+        writeQueuedFrame(&blackboxFrameQueue[tail & (BLACKBOX_FRAME_QUEUE_SIZE - 1)]);
+        tail++;
+        __atomic_store_n(&blackboxFrameQueueTail, tail, __ATOMIC_RELEASE);
+    }
+}
+
+uint32_t blackboxGetDroppedFrames(void)
+{
+    return blackboxDroppedFrames;
+}
+
 /**
  * Transmit the header information for the given field definitions. Transmitted header lines look like:
  *
@@ -1204,6 +1578,7 @@ static bool blackboxWriteSysinfo(void)
         BLACKBOX_PRINT_HEADER_LINE("I interval", "%d",                      blackboxIInterval);
         BLACKBOX_PRINT_HEADER_LINE("P interval", "%d/%d",                   blackboxGetRateNum(), blackboxGetRateDenom());
         BLACKBOX_PRINT_HEADER_LINE("P denom", "%d",                         blackboxConfig()->p_denom);
+        BLACKBOX_PRINT_HEADER_LINE("O denom", "%d",                         blackboxConfig()->ol_denom);
         BLACKBOX_PRINT_HEADER_LINE("minthrottle", "%d",                     motorConfig()->minthrottle);
         BLACKBOX_PRINT_HEADER_LINE("maxthrottle", "%d",                     motorConfig()->maxthrottle);
         BLACKBOX_PRINT_HEADER_LINE("gyro_scale","0x%x",                     castFloatBytesToInt(1.0f));
@@ -1405,6 +1780,11 @@ STATIC_UNIT_TESTED bool blackboxShouldLogIFrame(void)
     return blackboxLoopIndex == 0;
 }
 
+STATIC_UNIT_TESTED bool blackboxShouldLogOlFrame(void)
+{
+    return blackboxOlFrameIndex == 0 && blackboxConfig()->ol_denom != 0;
+}
+
 /*
  * If the GPS home point has been updated, or every 128 I-frames (~10 seconds), write the
  * GPS home position.
@@ -1416,7 +1796,7 @@ STATIC_UNIT_TESTED bool blackboxShouldLogIFrame(void)
 STATIC_UNIT_TESTED bool blackboxShouldLogGpsHomeFrame(void)
 {
     if (GPS_home[0] != gpsHistory.GPS_home[0] || GPS_home[1] != gpsHistory.GPS_home[1]
-        || (blackboxPFrameIndex == blackboxIInterval / 2 && blackboxIFrameIndex % 128 == 0)) {
+        || (blackboxIFrameIndex % 128 == 0 && blackboxIFrameIndex != gpsHistory.homeIFrameIndex)) {
         return true;
     }
     return false;
@@ -1429,6 +1809,10 @@ STATIC_UNIT_TESTED void blackboxAdvanceIterationTimers(void)
     ++blackboxSlowFrameIterationTimer;
     ++blackboxIteration;
 
+    if (++blackboxOlFrameIndex >= blackboxConfig()->ol_denom) {
+        blackboxOlFrameIndex = 0;
+    }
+
     if (++blackboxLoopIndex >= blackboxIInterval) {
         blackboxLoopIndex = 0;
         blackboxIFrameIndex++;
@@ -1438,56 +1822,78 @@ STATIC_UNIT_TESTED void blackboxAdvanceIterationTimers(void)
     }
 }
 
-// Called once every FC loop in order to log the current state
+// Called from the blackbox task in order to log the state queued by the FC loop
 STATIC_UNIT_TESTED void blackboxLogIteration(timeUs_t currentTimeUs)
 {
-    // Write a keyframe every blackboxIInterval frames so we can resynchronise upon missing frames
-    if (blackboxShouldLogIFrame()) {
-        /*
-         * Don't log a slow frame if the slow data didn't change ("I" frames are already large enough without adding
-         * an additional item to write at the same time). Unless we're *only* logging "I" frames, then we have no choice.
-         */
-        if (blackboxIsOnlyLoggingIntraframes()) {
-            writeSlowFrameIfNeeded();
-        }
+    blackboxCheckAndLogArmingBeep();
+    blackboxCheckAndLogFlightMode(); // Check for FlightMode status change event
 
-        loadMainState(currentTimeUs);
-        writeIntraframe();
-    } else {
-        blackboxCheckAndLogArmingBeep();
-        blackboxCheckAndLogFlightMode(); // Check for FlightMode status change event
+    writeQueuedFrames();
 
-        if (blackboxShouldLogPFrame()) {
-            /*
-             * We assume that slow frames are only interesting in that they aid the interpretation of the main data stream.
-             * So only log slow frames during loop iterations where we log a main frame.
-             */
-            writeSlowFrameIfNeeded();
-
-            loadMainState(currentTimeUs);
-            writeInterframe();
-        }
 #ifdef USE_GPS
-        if (feature(FEATURE_GPS)) {
-            if (blackboxShouldLogGpsHomeFrame()) {
-                writeGPSHomeFrame();
-                writeGPSFrame(currentTimeUs);
-            } else if (gpsSol.numSat != gpsHistory.GPS_numSat
-                    || gpsSol.llh.lat != gpsHistory.GPS_coord[LAT]
-                    || gpsSol.llh.lon != gpsHistory.GPS_coord[LON]) {
-                //We could check for velocity changes as well but I doubt it changes independent of position
-                writeGPSFrame(currentTimeUs);
-            }
+    if (feature(FEATURE_GPS) && blackboxLoggedAnyFrames) {
+        if (blackboxShouldLogGpsHomeFrame()) {
+            writeGPSHomeFrame();
+            writeGPSFrame(currentTimeUs);
+        } else if (gpsSol.numSat != gpsHistory.GPS_numSat
+                || gpsSol.llh.lat != gpsHistory.GPS_coord[LAT]
+                || gpsSol.llh.lon != gpsHistory.GPS_coord[LON]) {
+            //We could check for velocity changes as well but I doubt it changes independent of position
+            writeGPSFrame(currentTimeUs);
         }
-#endif
+        blackboxDeviceFlush();
     }
+#else
+    UNUSED(currentTimeUs);
+#endif
+}
 
-    //Flush every iteration so that our runtime variance is minimized
-    blackboxDeviceFlush();
+/**
+ * Call each flight loop iteration. Snapshots the state of the iterations that are logged into the frame queue,
+ * blackboxUpdate() writes them out.
+ */
+void blackboxSnapshot(timeUs_t currentTimeUs)
+{
+    switch (blackboxState) {
+    case BLACKBOX_STATE_PAUSED:
+        // Only allow resume to occur during an I-frame iteration, so that we have an "I" base to work from
+        if (IS_RC_MODE_ACTIVE(BOXBLACKBOX) && blackboxShouldLogIFrame()) {
+            blackboxSetState(BLACKBOX_STATE_RUNNING);
+            blackboxFrameGap = false;
+            blackboxQueueFrame(currentTimeUs, 'I', true);
+            blackboxOlIntraDue = true;
+        }
+        // Keep the logging timers ticking so our log iteration continues to advance
+        blackboxAdvanceIterationTimers();
+        break;
+    case BLACKBOX_STATE_RUNNING:
+        // On entry to this state, blackboxIteration, blackboxPFrameIndex and blackboxIFrameIndex are reset to 0
+        // Prevent the Pausing of the log on the mode switch if in Motor Test Mode
+        if (blackboxModeActivationConditionPresent && !IS_RC_MODE_ACTIVE(BOXBLACKBOX) && !startedLoggingInTestMode) {
+            blackboxSetState(BLACKBOX_STATE_PAUSED);
+        } else if (blackboxShouldLogIFrame()) {
+            // Write a keyframe every blackboxIInterval frames so we can resynchronise upon missing frames
+            const bool resume = blackboxFrameGap;
+            blackboxFrameGap = false;
+            blackboxQueueFrame(currentTimeUs, 'I', resume);
+            blackboxOlIntraDue = true;
+        } else if (blackboxShouldLogPFrame() && !blackboxFrameGap) {
+            blackboxQueueFrame(currentTimeUs, 'P', false);
+        }
+        // Navigation frames are only coded against each other, so they resynchronise at the first O after an I-frame
+        if (blackboxShouldLogOlFrame() && (blackboxOlIntraDue || !blackboxFrameGap)) {
+            blackboxQueueFrame(currentTimeUs, blackboxOlIntraDue ? 'O' : 'o', false);
+            blackboxOlIntraDue = false;
+        }
+        blackboxAdvanceIterationTimers();
+        break;
+    default:
+        break;
+    }
 }
 
 /**
- * Call each flight loop iteration to perform blackbox logging.
+ * Call from the blackbox task to run the logging state machine and write out the queued frames.
  */
 void blackboxUpdate(timeUs_t currentTimeUs)
 {
@@ -1564,6 +1970,18 @@ void blackboxUpdate(timeUs_t currentTimeUs)
         //On entry of this state, xmitState.headerIndex is 0 and xmitState.u.fieldIndex is -1
         if (!sendFieldDefinition('S', 0, blackboxSlowFields, blackboxSlowFields + 1, ARRAYLEN(blackboxSlowFields),
                 NULL, NULL)) {
+            if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_OL)) {
+                blackboxSetState(BLACKBOX_STATE_SEND_OL_HEADER);
+            } else {
+                blackboxSetState(BLACKBOX_STATE_SEND_SYSINFO);
+            }
+        }
+        break;
+    case BLACKBOX_STATE_SEND_OL_HEADER:
+        blackboxReplenishHeaderBudget();
+        //On entry of this state, xmitState.headerIndex is 0 and xmitState.u.fieldIndex is -1
+        if (!sendFieldDefinition('O', 'o', blackboxOlFields, blackboxOlFields + 1, ARRAYLEN(blackboxOlFields),
+                &blackboxOlFields[0].condition, &blackboxOlFields[1].condition)) {
             blackboxSetState(BLACKBOX_STATE_SEND_SYSINFO);
         }
         break;
@@ -1584,31 +2002,11 @@ void blackboxUpdate(timeUs_t currentTimeUs)
         }
         break;
     case BLACKBOX_STATE_PAUSED:
-        // Only allow resume to occur during an I-frame iteration, so that we have an "I" base to work from
-        if (IS_RC_MODE_ACTIVE(BOXBLACKBOX) && blackboxShouldLogIFrame()) {
-            // Write a log entry so the decoder is aware that our large time/iteration skip is intended
-            flightLogEvent_loggingResume_t resume;
-
-            resume.logIteration = blackboxIteration;
-            resume.currentTime = currentTimeUs;
-
-            blackboxLogEvent(FLIGHT_LOG_EVENT_LOGGING_RESUME, (flightLogEventData_t *) &resume);
-            blackboxSetState(BLACKBOX_STATE_RUNNING);
-
-            blackboxLogIteration(currentTimeUs);
-        }
-        // Keep the logging timers ticking so our log iteration continues to advance
-        blackboxAdvanceIterationTimers();
+        // Frames queued before the pause still go out
+        writeQueuedFrames();
         break;
     case BLACKBOX_STATE_RUNNING:
-        // On entry to this state, blackboxIteration, blackboxPFrameIndex and blackboxIFrameIndex are reset to 0
-        // Prevent the Pausing of the log on the mode switch if in Motor Test Mode
-        if (blackboxModeActivationConditionPresent && !IS_RC_MODE_ACTIVE(BOXBLACKBOX) && !startedLoggingInTestMode) {
-            blackboxSetState(BLACKBOX_STATE_PAUSED);
-        } else {
-            blackboxLogIteration(currentTimeUs);
-        }
-        blackboxAdvanceIterationTimers();
+        blackboxLogIteration(currentTimeUs);
         break;
     case BLACKBOX_STATE_SHUTTING_DOWN:
         //On entry of this state, startTime is set
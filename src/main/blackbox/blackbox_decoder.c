@@ -0,0 +1,709 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "blackbox/blackbox_decoder.h"
+
+#include "common/encoding.h"
+#include "common/maths.h"
+
+#define BLACKBOX_LOG_START_MARKER   "H Product:Blackbox flight data recorder by Nicholas Sherlock"
+#define BLACKBOX_LOG_END_MESSAGE    "End of log"
+#define BLACKBOX_FRAME_MARKERS      "IPSGHEOo"
+
+// Sets decoder->overrun rather than reading past the end, the frame being decoded is then dropped
+static uint8_t readByte(blackboxDecoder_t *decoder)
+{
+    if (decoder->pos >= decoder->end) {
+        decoder->overrun = true;
+        return 0;
+    }
+    return *decoder->pos++;
+}
+
+static uint32_t readUnsignedVB(blackboxDecoder_t *decoder)
+{
+    uint32_t result = 0;
+
+    for (int shift = 0; shift < 32; shift += 7) {
+        const uint8_t c = readByte(decoder);
+        result |= (uint32_t)(c & 0x7F) << shift;
+        if (c < 0x80) {
+            return result;
+        }
+    }
+    // More than 5 bytes, not something the encoder writes
+    decoder->overrun = true;
+    return 0;
+}
+
+static int32_t readSignedVB(blackboxDecoder_t *decoder)
+{
+    return zigzagDecode(readUnsignedVB(decoder));
+}
+
+static int32_t signExtend(uint32_t value, int bits)
+{
+    const int shift = 32 - bits;
+    return (int32_t)(value << shift) >> shift;
+}
+
+// The 32 bit scheme of the tag2 encodings: a selector per field for 1 to 4 bytes, least significant byte first
+static void readTag2Bytes(blackboxDecoder_t *decoder, uint8_t selector2, int32_t *values)
+{
+    for (int x = 0; x < 3; x++, selector2 >>= 2) {
+        const int byteCount = (selector2 & 0x03) + 1;
+        uint32_t value = 0;
+        for (int i = 0; i < byteCount; i++) {
+            value |= (uint32_t)readByte(decoder) << (8 * i);
+        }
+        values[x] = signExtend(value, 8 * byteCount);
+    }
+}
+
+static void readTag2_3S32(blackboxDecoder_t *decoder, int32_t *values)
+{
+    const uint8_t lead = readByte(decoder);
+    uint8_t byte;
+
+    switch (lead >> 6) {
+    case 0:
+        values[0] = signExtend((lead >> 4) & 0x03, 2);
+        values[1] = signExtend((lead >> 2) & 0x03, 2);
+        values[2] = signExtend(lead & 0x03, 2);
+        break;
+    case 1:
+        values[0] = signExtend(lead & 0x0F, 4);
+        byte = readByte(decoder);
+        values[1] = signExtend(byte >> 4, 4);
+        values[2] = signExtend(byte & 0x0F, 4);
+        break;
+    case 2:
+        values[0] = signExtend(lead & 0x3F, 6);
+        values[1] = signExtend(readByte(decoder) & 0x3F, 6);
+        values[2] = signExtend(readByte(decoder) & 0x3F, 6);
+        break;
+    case 3:
+        readTag2Bytes(decoder, lead & 0x3F, values);
+        break;
+    }
+}
+
+static void readTag2_3SVariable(blackboxDecoder_t *decoder, int32_t *values)
+{
+    const uint8_t lead = readByte(decoder);
+    uint8_t byte1, byte2;
+
+    switch (lead >> 6) {
+    case 0:
+        values[0] = signExtend((lead >> 4) & 0x03, 2);
+        values[1] = signExtend((lead >> 2) & 0x03, 2);
+        values[2] = signExtend(lead & 0x03, 2);
+        break;
+    case 1:
+        // ss11 1112 2222 3333
+        byte1 = readByte(decoder);
+        values[0] = signExtend((lead >> 1) & 0x1F, 5);
+        values[1] = signExtend(((lead & 0x01) << 4) | (byte1 >> 4), 5);
+        values[2] = signExtend(byte1 & 0x0F, 4);
+        break;
+    case 2:
+        // ss11 1111 1122 2222 2333 3333
+        byte1 = readByte(decoder);
+        byte2 = readByte(decoder);
+        values[0] = signExtend(((lead & 0x3F) << 2) | (byte1 >> 6), 8);
+        values[1] = signExtend(((byte1 & 0x3F) << 1) | (byte2 >> 7), 7);
+        values[2] = signExtend(byte2 & 0x7F, 7);
+        break;
+    case 3:
+        readTag2Bytes(decoder, lead & 0x3F, values);
+        break;
+    }
+}
+
+static void readTag8_4S16(blackboxDecoder_t *decoder, int32_t *values)
+{
+    uint8_t selector = readByte(decoder);
+    uint8_t buffer = 0;
+    bool nibble = false;    // the low nibble of buffer is still to be consumed
+
+    for (int x = 0; x < 4; x++, selector >>= 2) {
+        uint8_t byte1, byte2;
+
+        switch (selector & 0x03) {
+        case 0:
+            values[x] = 0;
+            break;
+        case 1:
+            if (!nibble) {
+                buffer = readByte(decoder);
+                values[x] = signExtend(buffer >> 4, 4);
+            } else {
+                values[x] = signExtend(buffer & 0x0F, 4);
+            }
+            nibble = !nibble;
+            break;
+        case 2:
+            if (!nibble) {
+                values[x] = signExtend(readByte(decoder), 8);
+            } else {
+                byte1 = (buffer & 0x0F) << 4;
+                buffer = readByte(decoder);
+                values[x] = signExtend(byte1 | (buffer >> 4), 8);
+            }
+            break;
+        case 3:
+            if (!nibble) {
+                byte1 = readByte(decoder);
+                byte2 = readByte(decoder);
+                values[x] = signExtend((byte1 << 8) | byte2, 16);
+            } else {
+                byte1 = readByte(decoder);
+                byte2 = readByte(decoder);
+                values[x] = signExtend(((buffer & 0x0F) << 12) | (byte1 << 4) | (byte2 >> 4), 16);
+                buffer = byte2;
+            }
+            break;
+        }
+    }
+}
+
+static void readTag8_8SVB(blackboxDecoder_t *decoder, int32_t *values, int valueCount)
+{
+    if (valueCount == 1) {
+        values[0] = readSignedVB(decoder);
+        return;
+    }
+
+    const uint8_t header = readByte(decoder);
+    for (int i = 0; i < valueCount; i++) {
+        values[i] = (header & (1 << i)) ? readSignedVB(decoder) : 0;
+    }
+}
+
+/*
+ * The firmware logs a P frame on the iterations where (index in the I interval) * num / denom crosses an integer,
+ * the iterations in between are not in the log and the INC predictor has to step over them.
+ */
+static bool shouldHaveMainFrame(const blackboxDecoder_t *decoder, uint32_t iteration)
+{
+    return (iteration % decoder->iInterval + decoder->pNum - 1) % decoder->pDenom < (uint32_t)decoder->pNum;
+}
+
+static uint32_t countSkippedIterations(const blackboxDecoder_t *decoder, uint32_t lastIteration)
+{
+    if (decoder->pNum <= 0 || decoder->pDenom <= 0) {
+        return 0;
+    }
+
+    uint32_t skipped = 0;
+    for (uint32_t iteration = lastIteration + 1; !shouldHaveMainFrame(decoder, iteration) && skipped < (uint32_t)decoder->iInterval; iteration++) {
+        skipped++;
+    }
+    return skipped;
+}
+
+static int32_t applyPrediction(blackboxDecoder_t *decoder, const blackboxDecoderFrameDef_t *def, int mode, int fieldIndex,
+                               int32_t raw, const int32_t *current, const int32_t *previous, const int32_t *previous2)
+{
+    // Unsigned arithmetic so that wrapping fields like the time decode the same way they were encoded
+    uint32_t value = raw;
+
+    switch (def->predictor[mode][fieldIndex]) {
+    case FLIGHT_LOG_FIELD_PREDICTOR_0:
+        break;
+    case FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS:
+        if (previous) {
+            value += previous[fieldIndex];
+        }
+        break;
+    case FLIGHT_LOG_FIELD_PREDICTOR_STRAIGHT_LINE:
+        if (previous) {
+            value += 2 * (uint32_t)previous[fieldIndex] - previous2[fieldIndex];
+        }
+        break;
+    case FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2:
+        if (previous) {
+            value += (int32_t)(((int64_t)previous[fieldIndex] + previous2[fieldIndex]) / 2);
+        }
+        break;
+    case FLIGHT_LOG_FIELD_PREDICTOR_MINTHROTTLE:
+        value += decoder->minthrottle;
+        break;
+    case FLIGHT_LOG_FIELD_PREDICTOR_MOTOR_0:
+        if (decoder->mainMotor0Index >= 0 && decoder->mainMotor0Index < fieldIndex) {
+            value += current[decoder->mainMotor0Index];
+        }
+        break;
+    case FLIGHT_LOG_FIELD_PREDICTOR_INC:
+        if (previous) {
+            value += previous[fieldIndex] + 1 + countSkippedIterations(decoder, previous[fieldIndex]);
+        }
+        break;
+    case FLIGHT_LOG_FIELD_PREDICTOR_HOME_COORD:
+        {
+            // The first field with this predictor is relative to GPS_home[0], the second to GPS_home[1]
+            int homeIndex = 0;
+            for (int i = 0; i < fieldIndex; i++) {
+                homeIndex += def->predictor[mode][i] == FLIGHT_LOG_FIELD_PREDICTOR_HOME_COORD;
+            }
+            if (homeIndex < decoder->def[BLACKBOX_DECODER_DEF_GPS_HOME].fieldCount) {
+                value += decoder->gpsHome[homeIndex];
+            }
+        }
+        break;
+    case FLIGHT_LOG_FIELD_PREDICTOR_1500:
+        value += 1500;
+        break;
+    case FLIGHT_LOG_FIELD_PREDICTOR_VBATREF:
+        value += decoder->vbatref;
+        break;
+    case FLIGHT_LOG_FIELD_PREDICTOR_LAST_MAIN_FRAME_TIME:
+        value += decoder->lastMainTime;
+        break;
+    case FLIGHT_LOG_FIELD_PREDICTOR_MINMOTOR:
+        value += decoder->motorOutputLow;
+        break;
+    default:
+        decoder->overrun = true;
+        break;
+    }
+
+    return value;
+}
+
+// Number of fields from fieldIndex on that share its encoding, at most maxCount
+static int encodingGroupSize(const blackboxDecoderFrameDef_t *def, int mode, int fieldIndex, int maxCount)
+{
+    int count = 1;
+    while (count < maxCount && fieldIndex + count < def->fieldCount
+           && def->encoding[mode][fieldIndex + count] == def->encoding[mode][fieldIndex]) {
+        count++;
+    }
+    return count;
+}
+
+static void decodeFrameFields(blackboxDecoder_t *decoder, const blackboxDecoderFrameDef_t *def, int mode,
+                              int32_t *current, const int32_t *previous, const int32_t *previous2)
+{
+    int32_t raw[8];
+
+    for (int i = 0; i < def->fieldCount && !decoder->overrun; ) {
+        int count = 1;
+
+        switch (def->encoding[mode][i]) {
+        case FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB:
+            raw[0] = readSignedVB(decoder);
+            break;
+        case FLIGHT_LOG_FIELD_ENCODING_UNSIGNED_VB:
+            raw[0] = readUnsignedVB(decoder);
+            break;
+        case FLIGHT_LOG_FIELD_ENCODING_NEG_14BIT:
+            raw[0] = -signExtend(readUnsignedVB(decoder), 14);
+            break;
+        case FLIGHT_LOG_FIELD_ENCODING_TAG8_8SVB:
+            count = encodingGroupSize(def, mode, i, 8);
+            readTag8_8SVB(decoder, raw, count);
+            break;
+        case FLIGHT_LOG_FIELD_ENCODING_TAG2_3S32:
+            count = 3;
+            readTag2_3S32(decoder, raw);
+            break;
+        case FLIGHT_LOG_FIELD_ENCODING_TAG2_3SVARIABLE:
+            count = 3;
+            readTag2_3SVariable(decoder, raw);
+            break;
+        case FLIGHT_LOG_FIELD_ENCODING_TAG8_4S16:
+            count = 4;
+            readTag8_4S16(decoder, raw);
+            break;
+        case FLIGHT_LOG_FIELD_ENCODING_NULL:
+            raw[0] = 0;
+            break;
+        default:
+            decoder->overrun = true;
+            return;
+        }
+
+        for (int j = 0; j < count && i < def->fieldCount; j++, i++) {
+            current[i] = applyPrediction(decoder, def, mode, i, raw[j], current, previous, previous2);
+        }
+    }
+}
+
+static bool decodeEvent(blackboxDecoder_t *decoder, flightLogEvent_t *event)
+{
+    event->event = readByte(decoder);
+
+    switch (event->event) {
+    case FLIGHT_LOG_EVENT_SYNC_BEEP:
+        event->data.syncBeep.time = readUnsignedVB(decoder);
+        break;
+    case FLIGHT_LOG_EVENT_FLIGHTMODE:
+        event->data.flightMode.flags = readUnsignedVB(decoder);
+        event->data.flightMode.lastFlags = readUnsignedVB(decoder);
+        break;
+    case FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT:
+        {
+            const uint8_t function = readByte(decoder);
+            event->data.inflightAdjustment.adjustmentFunction = function & ~FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT_FUNCTION_FLOAT_VALUE_FLAG;
+            event->data.inflightAdjustment.floatFlag = function & FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT_FUNCTION_FLOAT_VALUE_FLAG;
+            if (event->data.inflightAdjustment.floatFlag) {
+                union {
+                    uint32_t u;
+                    float f;
+                } floatBytes = { .u = 0 };
+                for (int i = 0; i < 4; i++) {
+                    floatBytes.u |= (uint32_t)readByte(decoder) << (8 * i);
+                }
+                event->data.inflightAdjustment.newFloatValue = floatBytes.f;
+            } else {
+                event->data.inflightAdjustment.newValue = readSignedVB(decoder);
+            }
+        }
+        break;
+    case FLIGHT_LOG_EVENT_LOGGING_RESUME:
+        event->data.loggingResume.logIteration = readUnsignedVB(decoder);
+        event->data.loggingResume.currentTime = readUnsignedVB(decoder);
+        break;
+    case FLIGHT_LOG_EVENT_LOG_END:
+        {
+            const size_t length = sizeof(BLACKBOX_LOG_END_MESSAGE);     // including the terminating zero
+            if ((size_t)(decoder->end - decoder->pos) < length || memcmp(decoder->pos, BLACKBOX_LOG_END_MESSAGE, length) != 0) {
+                return false;
+            }
+            decoder->pos += length;
+        }
+        break;
+    default:
+        return false;
+    }
+
+    return !decoder->overrun;
+}
+
+static bool startsWith(const uint8_t *pos, const uint8_t *end, const char *prefix)
+{
+    const size_t length = strlen(prefix);
+    return (size_t)(end - pos) >= length && memcmp(pos, prefix, length) == 0;
+}
+
+/*
+ * Returns the start of the logIndex-th log (from 0) of a dump with several logs back to back, or NULL if there are
+ * not that many.
+ */
+const uint8_t *blackboxDecoderFindLog(const uint8_t *data, size_t length, int logIndex)
+{
+    const uint8_t *end = data + length;
+    const uint8_t *pos = data;
+
+    while ((pos = memchr(pos, 'H', end - pos)) != NULL) {
+        if (startsWith(pos, end, BLACKBOX_LOG_START_MARKER) && logIndex-- == 0) {
+            return pos;
+        }
+        pos++;
+    }
+    return NULL;
+}
+
+int blackboxDecoderFindField(const blackboxDecoderFrameDef_t *def, const char *name)
+{
+    for (int i = 0; i < def->fieldCount; i++) {
+        if (strcmp(def->name[i], name) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static int frameDefIndex(char frameType)
+{
+    switch (frameType) {
+    case 'I':
+    case 'P':
+        return BLACKBOX_DECODER_DEF_MAIN;
+    case 'S':
+        return BLACKBOX_DECODER_DEF_SLOW;
+    case 'G':
+        return BLACKBOX_DECODER_DEF_GPS;
+    case 'H':
+        return BLACKBOX_DECODER_DEF_GPS_HOME;
+    case 'O':
+    case 'o':
+        return BLACKBOX_DECODER_DEF_OL;
+    default:
+        return -1;
+    }
+}
+
+// "H Field X name:a,b,c" or "H Field X predictor:0,1,2", value is not zero terminated
+static void parseFieldHeader(blackboxDecoder_t *decoder, char frameType, const char *property, const char *value, const char *valueEnd)
+{
+    const int defIndex = frameDefIndex(frameType);
+    if (defIndex < 0) {
+        return;
+    }
+    blackboxDecoderFrameDef_t *def = &decoder->def[defIndex];
+    // P and o only announce their own predictors and encodings, the names are those of I and O
+    const int mode = (frameType == 'P' || frameType == 'o') ? 1 : 0;
+
+    int count = 0;
+    for (const char *item = value; item < valueEnd && count < BLACKBOX_DECODER_MAX_FIELDS; count++) {
+        const char *itemEnd = memchr(item, ',', valueEnd - item);
+        if (!itemEnd) {
+            itemEnd = valueEnd;
+        }
+
+        if (strcmp(property, "name") == 0) {
+            const size_t length = MIN((size_t)(itemEnd - item), (size_t)BLACKBOX_DECODER_NAME_LENGTH - 1);
+            memcpy(def->name[count], item, length);
+            def->name[count][length] = '\0';
+        } else {
+            const uint8_t number = atoi(item);
+            if (strcmp(property, "signed") == 0) {
+                def->isSigned[count] = number;
+            } else if (strcmp(property, "predictor") == 0) {
+                def->predictor[mode][count] = number;
+            } else if (strcmp(property, "encoding") == 0) {
+                def->encoding[mode][count] = number;
+            }
+        }
+
+        item = itemEnd + 1;
+    }
+
+    if (strcmp(property, "name") == 0) {
+        def->fieldCount = count;
+    }
+}
+
+static void parseHeaderLine(blackboxDecoder_t *decoder, const uint8_t *line, const uint8_t *lineEnd)
+{
+    // Header lines are short, a copy makes them zero terminated for the string functions
+    char buf[1024];
+    const size_t length = MIN((size_t)(lineEnd - line), sizeof(buf) - 1);
+    memcpy(buf, line, length);
+    buf[length] = '\0';
+
+    char *value = strchr(buf, ':');
+    if (!value) {
+        return;
+    }
+    *value++ = '\0';
+    const char *valueEnd = buf + length;
+    const char *name = buf + 2;     // after "H "
+
+    char frameType;
+    char property[16];
+    if (sscanf(name, "Field %c %15s", &frameType, property) == 2) {
+        parseFieldHeader(decoder, frameType, property, value, valueEnd);
+    } else if (strcmp(name, "I interval") == 0) {
+        decoder->iInterval = MAX(atoi(value), 1);
+    } else if (strcmp(name, "P interval") == 0) {
+        const char *slash = strchr(value, '/');
+        decoder->pNum = atoi(value);
+        decoder->pDenom = slash ? atoi(slash + 1) : 1;
+    } else if (strcmp(name, "minthrottle") == 0) {
+        decoder->minthrottle = atoi(value);
+    } else if (strcmp(name, "motorOutput") == 0) {
+        decoder->motorOutputLow = atoi(value);
+    } else if (strcmp(name, "vbatref") == 0) {
+        decoder->vbatref = atoi(value);
+    } else if (strcmp(name, "debug_mode") == 0) {
+        decoder->debugMode = atoi(value);
+    } else if (strcmp(name, "looptime") == 0) {
+        decoder->looptime = atoi(value);
+    }
+}
+
+/*
+ * Start decoding the log at data, normally the value of blackboxDecoderFindLog(). Reads the header, returns false if
+ * it has no main frame definitions.
+ */
+bool blackboxDecoderInit(blackboxDecoder_t *decoder, const uint8_t *data, size_t length)
+{
+    memset(decoder, 0, sizeof(*decoder));
+    decoder->start = data;
+    decoder->pos = data;
+    decoder->end = data + length;
+    decoder->iInterval = 32;
+    decoder->pNum = 1;
+    decoder->pDenom = 1;
+
+    while (startsWith(decoder->pos, decoder->end, "H ")) {
+        const uint8_t *lineEnd = memchr(decoder->pos, '\n', decoder->end - decoder->pos);
+        if (!lineEnd) {
+            decoder->pos = decoder->end;
+            break;
+        }
+        parseHeaderLine(decoder, decoder->pos, lineEnd);
+        decoder->pos = lineEnd + 1;
+    }
+
+    for (int i = 0; i < 3; i++) {
+        decoder->mainHistory[i] = decoder->mainHistoryRing[i];
+    }
+    const blackboxDecoderFrameDef_t *mainDef = &decoder->def[BLACKBOX_DECODER_DEF_MAIN];
+    decoder->mainIterationIndex = blackboxDecoderFindField(mainDef, "loopIteration");
+    decoder->mainTimeIndex = blackboxDecoderFindField(mainDef, "time");
+    decoder->mainMotor0Index = blackboxDecoderFindField(mainDef, "motor[0]");
+
+    return mainDef->fieldCount > 0;
+}
+
+static int32_t *nextMainHistorySlot(blackboxDecoder_t *decoder)
+{
+    const int index = (decoder->mainHistory[0] - decoder->mainHistoryRing[0]) / BLACKBOX_DECODER_MAX_FIELDS;
+    return decoder->mainHistoryRing[(index + 1) % 3];
+}
+
+/*
+ * Decode the next frame of the log. Returns false at the end of the log, the values of the frame stay valid until the
+ * next call.
+ *
+ * Frames that fail to decode are dropped, the decoder then resynchronises on the next byte and waits for the next
+ * intra frame before it returns delta frames again.
+ */
+bool blackboxDecoderNext(blackboxDecoder_t *decoder, blackboxDecoderFrame_t *frame)
+{
+    while (!decoder->ended && decoder->pos < decoder->end) {
+        const uint8_t *frameStart = decoder->pos;
+        const char frameType = readByte(decoder);
+        const int defIndex = frameDefIndex(frameType);
+        const blackboxDecoderFrameDef_t *def = defIndex >= 0 ? &decoder->def[defIndex] : NULL;
+        int32_t *values = decoder->scratch;
+        bool valid = true;
+
+        // The header of a log that follows one which did not end cleanly
+        if (frameType == 'H' && startsWith(frameStart, decoder->end, BLACKBOX_LOG_START_MARKER)) {
+            decoder->pos = frameStart;
+            decoder->ended = true;
+            break;
+        }
+
+        decoder->overrun = false;
+        memset(frame, 0, sizeof(*frame));
+
+        switch (frameType) {
+        case 'I':
+            values = decoder->mainHistory[0];
+            decodeFrameFields(decoder, def, 0, values, NULL, NULL);
+            break;
+        case 'P':
+            values = decoder->mainHistory[0];
+            decodeFrameFields(decoder, def, 1, values, decoder->mainHistory[1], decoder->mainHistory[2]);
+            valid = decoder->mainValid;
+            break;
+        case 'S':
+            values = decoder->slow;
+            decodeFrameFields(decoder, def, 0, values, NULL, NULL);
+            break;
+        case 'G':
+            values = decoder->gps;
+            decodeFrameFields(decoder, def, 0, values, decoder->gps, decoder->gps);
+            break;
+        case 'H':
+            values = decoder->gpsHome;
+            decodeFrameFields(decoder, def, 0, values, NULL, NULL);
+            break;
+        case 'O':
+            values = decoder->olHistory[decoder->olCurrent ^ 1];
+            decodeFrameFields(decoder, def, 0, values, NULL, NULL);
+            break;
+        case 'o':
+            values = decoder->olHistory[decoder->olCurrent ^ 1];
+            decodeFrameFields(decoder, def, 1, values, decoder->olHistory[decoder->olCurrent], NULL);
+            valid = decoder->olValid;
+            break;
+        case 'E':
+            def = NULL;
+            values = NULL;
+            if (!decodeEvent(decoder, &frame->event)) {
+                decoder->overrun = true;
+            }
+            break;
+        default:
+            decoder->overrun = true;
+            break;
+        }
+
+        // A frame is only trusted if it is followed by the start of another one
+        if ((def && def->fieldCount == 0) || decoder->overrun
+            || (decoder->pos < decoder->end && !strchr(BLACKBOX_FRAME_MARKERS, *decoder->pos))) {
+            decoder->pos = frameStart + 1;
+            decoder->mainValid = false;
+            decoder->olValid = false;
+            decoder->stats.corruptFrames++;
+            continue;
+        }
+
+        if (!valid) {
+            decoder->stats.skippedFrames++;
+            continue;
+        }
+
+        switch (frameType) {
+        case 'I':
+            decoder->mainHistory[1] = decoder->mainHistory[2] = decoder->mainHistory[0];
+            decoder->mainHistory[0] = nextMainHistorySlot(decoder);
+            decoder->mainValid = true;
+            break;
+        case 'P':
+            decoder->mainHistory[2] = decoder->mainHistory[1];
+            decoder->mainHistory[1] = decoder->mainHistory[0];
+            decoder->mainHistory[0] = nextMainHistorySlot(decoder);
+            break;
+        case 'O':
+        case 'o':
+            decoder->olCurrent ^= 1;
+            decoder->olValid = true;
+            break;
+        case 'E':
+            if (frame->event.event == FLIGHT_LOG_EVENT_LOGGING_RESUME) {
+                // Logging restarts with an intra frame
+                decoder->mainValid = false;
+                decoder->olValid = false;
+            } else if (frame->event.event == FLIGHT_LOG_EVENT_LOG_END) {
+                decoder->ended = true;
+            }
+            break;
+        }
+
+        if ((frameType == 'I' || frameType == 'P') && decoder->mainTimeIndex >= 0) {
+            decoder->lastMainTime = values[decoder->mainTimeIndex];
+        }
+
+        if (def) {
+            decoder->stats.frames[defIndex]++;
+        } else {
+            decoder->stats.events++;
+        }
+
+        frame->type = frameType;
+        frame->def = def;
+        frame->values = values;
+        frame->offset = frameStart - decoder->start;
+        return true;
+    }
+
+    return false;
+}
@@ -0,0 +1,111 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Streaming decoder for the logs written by blackbox.c, for host tools only (it is not part of the firmware build).
+ *
+ * The decoder works in place on a read only buffer, normally a mmap()ed log file, and keeps no more than the
+ * prediction history of each frame type: decoding a log of any size needs a few tens of kilobytes.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "blackbox/blackbox.h"
+#include "blackbox/blackbox_fielddefs.h"
+
+#define BLACKBOX_DECODER_MAX_FIELDS     128
+#define BLACKBOX_DECODER_NAME_LENGTH    32
+
+typedef enum {
+    BLACKBOX_DECODER_DEF_MAIN = 0,  // I and P frames
+    BLACKBOX_DECODER_DEF_SLOW,      // S frames
+    BLACKBOX_DECODER_DEF_GPS,       // G frames
+    BLACKBOX_DECODER_DEF_GPS_HOME,  // H frames
+    BLACKBOX_DECODER_DEF_OL,        // O and o frames
+    BLACKBOX_DECODER_DEF_COUNT
+} blackboxDecoderDef_e;
+
+// Field definitions of one frame type as announced by the "H Field" header lines
+typedef struct blackboxDecoderFrameDef_s {
+    int fieldCount;
+    char name[BLACKBOX_DECODER_MAX_FIELDS][BLACKBOX_DECODER_NAME_LENGTH];
+    uint8_t isSigned[BLACKBOX_DECODER_MAX_FIELDS];
+    uint8_t predictor[2][BLACKBOX_DECODER_MAX_FIELDS];  // [0] intra or simple frames, [1] delta frames
+    uint8_t encoding[2][BLACKBOX_DECODER_MAX_FIELDS];
+} blackboxDecoderFrameDef_t;
+
+typedef struct blackboxDecoderFrame_s {
+    char type;                              // 'I', 'P', 'S', 'G', 'H', 'O', 'o' or 'E'
+    const blackboxDecoderFrameDef_t *def;   // NULL for events
+    const int32_t *values;                  // def->fieldCount values, unsigned fields are stored as their bit pattern
+    flightLogEvent_t event;                 // for 'E' frames
+    size_t offset;                          // of the frame from the start of the log
+} blackboxDecoderFrame_t;
+
+typedef struct blackboxDecoderStats_s {
+    uint32_t frames[BLACKBOX_DECODER_DEF_COUNT];
+    uint32_t events;
+    uint32_t corruptFrames;     // frames dropped because they did not decode or were not followed by a frame marker
+    uint32_t skippedFrames;     // delta frames dropped while waiting for an intra frame to resynchronise on
+} blackboxDecoderStats_t;
+
+typedef struct blackboxDecoder_s {
+    const uint8_t *start;
+    const uint8_t *pos;
+    const uint8_t *end;
+    bool overrun;
+    bool ended;
+
+    blackboxDecoderFrameDef_t def[BLACKBOX_DECODER_DEF_COUNT];
+
+    // Header values used by the predictors
+    int iInterval;
+    int pNum;
+    int pDenom;
+    int32_t minthrottle;
+    int32_t motorOutputLow;
+    int32_t vbatref;
+    int debugMode;
+    uint32_t looptime;
+
+    // Prediction history
+    int32_t mainHistoryRing[3][BLACKBOX_DECODER_MAX_FIELDS];
+    int32_t *mainHistory[3];    // current, previous, the one before
+    bool mainValid;
+    int32_t olHistory[2][BLACKBOX_DECODER_MAX_FIELDS];
+    int olCurrent;
+    bool olValid;
+    int32_t slow[BLACKBOX_DECODER_MAX_FIELDS];
+    int32_t gps[BLACKBOX_DECODER_MAX_FIELDS];
+    int32_t gpsHome[BLACKBOX_DECODER_MAX_FIELDS];
+    int32_t scratch[BLACKBOX_DECODER_MAX_FIELDS];
+    uint32_t lastMainTime;
+    int mainIterationIndex;
+    int mainTimeIndex;
+    int mainMotor0Index;
+
+    blackboxDecoderStats_t stats;
+} blackboxDecoder_t;
+
+const uint8_t *blackboxDecoderFindLog(const uint8_t *data, size_t length, int logIndex);
+bool blackboxDecoderInit(blackboxDecoder_t *decoder, const uint8_t *data, size_t length);
+bool blackboxDecoderNext(blackboxDecoder_t *decoder, blackboxDecoderFrame_t *frame);
+int blackboxDecoderFindField(const blackboxDecoderFrameDef_t *def, const char *name);
@@ -12,6 +12,7 @@
 #include "blackbox_io.h"
 
 #include "common/encoding.h"
+#include "common/maths.h"
 #include "common/printf.h"
 
 
@@ -65,17 +66,65 @@ void blackboxPrintfHeaderLine(const char *name, const char *fmt, ...)
     blackboxHeaderBudget -= written + 3;
 }
 
+/*
+ * Range tests for the tag encodings. The Cortex-M4/M7 DSP extension does them in a single saturating instruction,
+ * elsewhere they are two compares.
+ */
+#if defined(STM32F4) || defined(STM32F7)
+#define FITS_SIGNED_BITS(value, bits) (__SSAT((value), (bits)) == (value))
+#else
+#define FITS_SIGNED_BITS(value, bits) ((value) >= -(1 << ((bits) - 1)) && (value) < (1 << ((bits) - 1)))
+#endif
+
 /**
- * Write an unsigned integer to the blackbox serial port using variable byte encoding.
+ * Encode an unsigned integer into buf using variable byte encoding, returns the position after the last byte.
  */
-void blackboxWriteUnsignedVB(uint32_t value)
+uint8_t *blackboxEncodeUnsignedVB(uint8_t *buf, uint32_t value)
 {
-    //While this isn't the final byte (we can only write 7 bits at a time)
-    while (value > 127) {
-        blackboxWrite((uint8_t) (value | 0x80)); // Set the high bit to mean "more bytes follow"
+    // 7 bits per byte, the byte count comes from the position of the highest set bit instead of a compare per byte
+    const int bytes = (32 - __builtin_clz(value | 1) + 6) / 7;
+
+    for (int i = 1; i < bytes; i++) {
+        *buf++ = (uint8_t) (value | 0x80); // Set the high bit to mean "more bytes follow"
         value >>= 7;
     }
-    blackboxWrite(value);
+    *buf++ = value;
+    return buf;
+}
+
+/**
+ * Encode a signed integer into buf using ZigZag and variable byte encoding.
+ */
+uint8_t *blackboxEncodeSignedVB(uint8_t *buf, int32_t value)
+{
+    //ZigZag encode to make the value always positive
+    return blackboxEncodeUnsignedVB(buf, zigzagEncode(value));
+}
+
+uint8_t *blackboxEncodeSignedVBArray(uint8_t *buf, const int32_t *array, int count)
+{
+    for (int i = 0; i < count; i++) {
+        buf = blackboxEncodeUnsignedVB(buf, zigzagEncode(array[i]));
+    }
+    return buf;
+}
+
+uint8_t *blackboxEncodeSigned16VBArray(uint8_t *buf, const int16_t *array, int count)
+{
+    for (int i = 0; i < count; i++) {
+        buf = blackboxEncodeUnsignedVB(buf, zigzagEncode(array[i]));
+    }
+    return buf;
+}
+
+/**
+ * Write an unsigned integer to the blackbox serial port using variable byte encoding.
+ */
+void blackboxWriteUnsignedVB(uint32_t value)
+{
+    uint8_t buf[BLACKBOX_VB_MAX_BYTES];
+
+    blackboxWriteBuf(buf, blackboxEncodeUnsignedVB(buf, value) - buf);
 }
 
 /**
@@ -108,9 +157,9 @@ void blackboxWriteS16(int16_t value)
 }
 
 /**
- * Write a 2 bit tag followed by 3 signed fields of 2, 4, 6 or 32 bits
+ * Encode a 2 bit tag followed by 3 signed fields of 2, 4, 6 or 32 bits
  */
-void blackboxWriteTag2_3S32(int32_t *values)
+uint8_t *blackboxEncodeTag2_3S32(uint8_t *buf, const int32_t *values)
 {
     static const int NUM_FIELDS = 3;
 
@@ -122,15 +171,6 @@ void blackboxWriteTag2_3S32(int32_t *values)
         BITS_32 = 3
     };
 
-    enum {
-        BYTES_1  = 0,
-        BYTES_2  = 1,
-        BYTES_3  = 2,
-        BYTES_4  = 3
-    };
-
-    int selector = BITS_2, selector2;
-
     /*
      * Find out how many bits the largest value requires to encode, and use it to choose one of the packing schemes
      * below:
@@ -141,94 +181,74 @@ void blackboxWriteTag2_3S32(int32_t *values)
      * 4 bits per field  ss00 1111 2222 3333
      * 6 bits per field  ss11 1111 0022 2222 0033 3333
      * 32 bits per field sstt tttt followed by fields of various byte counts
+     *
+     * Each range test that fails moves a field up one scheme, so the selector is the largest sum.
      */
+    int selector = BITS_2;
     for (int x = 0; x < NUM_FIELDS; x++) {
-        //Require more than 6 bits?
-        if (values[x] >= 32 || values[x] < -32) {
-            selector = BITS_32;
-            break;
-        }
-
-        //Require more than 4 bits?
-        if (values[x] >= 8 || values[x] < -8) {
-             if (selector < BITS_6) {
-                 selector = BITS_6;
-             }
-        } else if (values[x] >= 2 || values[x] < -2) { //Require more than 2 bits?
-            if (selector < BITS_4) {
-                selector = BITS_4;
-            }
-        }
+        const int fieldSelector = !FITS_SIGNED_BITS(values[x], 2) + !FITS_SIGNED_BITS(values[x], 4) + !FITS_SIGNED_BITS(values[x], 6);
+        selector = MAX(selector, fieldSelector);
     }
 
     switch (selector) {
     case BITS_2:
-        blackboxWrite((selector << 6) | ((values[0] & 0x03) << 4) | ((values[1] & 0x03) << 2) | (values[2] & 0x03));
+        *buf++ = (selector << 6) | ((values[0] & 0x03) << 4) | ((values[1] & 0x03) << 2) | (values[2] & 0x03);
         break;
     case BITS_4:
-        blackboxWrite((selector << 6) | (values[0] & 0x0F));
-        blackboxWrite((values[1] << 4) | (values[2] & 0x0F));
+        *buf++ = (selector << 6) | (values[0] & 0x0F);
+        *buf++ = (values[1] << 4) | (values[2] & 0x0F);
         break;
     case BITS_6:
-        blackboxWrite((selector << 6) | (values[0] & 0x3F));
-        blackboxWrite((uint8_t)values[1]);
-        blackboxWrite((uint8_t)values[2]);
+        *buf++ = (selector << 6) | (values[0] & 0x3F);
+        *buf++ = (uint8_t)values[1];
+        *buf++ = (uint8_t)values[2];
         break;
     case BITS_32:
-        /*
-         * Do another round to compute a selector for each field, assuming that they are at least 8 bits each
-         *
-         * Selector2 field possibilities
-         * 0 - 8 bits
-         * 1 - 16 bits
-         * 2 - 24 bits
-         * 3 - 32 bits
-         */
-        selector2 = 0;
-
-        //Encode in reverse order so the first field is in the low bits:
-        for (int x = NUM_FIELDS - 1; x >= 0; x--) {
-            selector2 <<= 2;
-
-            if (values[x] < 128 && values[x] >= -128) {
-                selector2 |= BYTES_1;
-            } else if (values[x] < 32768 && values[x] >= -32768) {
-                selector2 |= BYTES_2;
-            } else if (values[x] < 8388608 && values[x] >= -8388608) {
-                selector2 |= BYTES_3;
-            } else {
-                selector2 |= BYTES_4;
+        {
+            /*
+             * Do another round to compute a selector for each field, assuming that they are at least 8 bits each
+             *
+             * Selector2 field possibilities
+             * 0 - 8 bits
+             * 1 - 16 bits
+             * 2 - 24 bits
+             * 3 - 32 bits
+             */
+            int byteCount[3];
+            int selector2 = 0;
+
+            //Encode in reverse order so the first field is in the low bits:
+            for (int x = NUM_FIELDS - 1; x >= 0; x--) {
+                byteCount[x] = !FITS_SIGNED_BITS(values[x], 8) + !FITS_SIGNED_BITS(values[x], 16) + !FITS_SIGNED_BITS(values[x], 24);
+                selector2 = (selector2 << 2) | byteCount[x];
             }
-        }
 
-        //Write the selectors
-        blackboxWrite((selector << 6) | selector2);
+            //Write the selectors
+            *buf++ = (selector << 6) | selector2;
 
-        //And now the values according to the selectors we picked for them
-        for (int x = 0; x < NUM_FIELDS; x++, selector2 >>= 2) {
-            switch (selector2 & 0x03) {
-            case BYTES_1:
-                blackboxWrite(values[x]);
-                break;
-            case BYTES_2:
-                blackboxWrite(values[x]);
-                blackboxWrite(values[x] >> 8);
-                break;
-            case BYTES_3:
-                blackboxWrite(values[x]);
-                blackboxWrite(values[x] >> 8);
-                blackboxWrite(values[x] >> 16);
-                break;
-            case BYTES_4:
-                blackboxWrite(values[x]);
-                blackboxWrite(values[x] >> 8);
-                blackboxWrite(values[x] >> 16);
-                blackboxWrite(values[x] >> 24);
-                break;
+            //And now the values according to the selectors we picked for them, least significant byte first
+            for (int x = 0; x < NUM_FIELDS; x++) {
+                uint32_t value = values[x];
+                for (int i = 0; i <= byteCount[x]; i++) {
+                    *buf++ = value;
+                    value >>= 8;
+                }
             }
         }
         break;
     }
+
+    return buf;
+}
+
+/**
+ * Write a 2 bit tag followed by 3 signed fields of 2, 4, 6 or 32 bits
+ */
+void blackboxWriteTag2_3S32(int32_t *values)
+{
+    uint8_t buf[BLACKBOX_TAG2_3S32_MAX_BYTES];
+
+    blackboxWriteBuf(buf, blackboxEncodeTag2_3S32(buf, values) - buf);
 }
 
 /**
@@ -355,11 +375,10 @@ int blackboxWriteTag2_3SVariable(int32_t *values)
 }
 
 /**
- * Write an 8-bit selector followed by four signed fields of size 0, 4, 8 or 16 bits.
+ * Encode an 8-bit selector followed by four signed fields of size 0, 4, 8 or 16 bits.
  */
-void blackboxWriteTag8_4S16(int32_t *values)
+uint8_t *blackboxEncodeTag8_4S16(uint8_t *buf, const int32_t *values)
 {
-
     //Need to be enums rather than const ints if we want to switch on them (due to being C)
     enum {
         FIELD_ZERO  = 0,
@@ -368,23 +387,18 @@ void blackboxWriteTag8_4S16(int32_t *values)
         FIELD_16BIT = 3
     };
 
+    /*
+     * A non-zero field is at least FIELD_4BIT and every range test it fails moves it up one size, so the selector
+     * needs no branches.
+     */
     uint8_t selector = 0;
     //Encode in reverse order so the first field is in the low bits:
     for (int x = 3; x >= 0; x--) {
-        selector <<= 2;
-
-        if (values[x] == 0) {
-            selector |= FIELD_ZERO;
-        } else if (values[x] < 8 && values[x] >= -8) {
-            selector |= FIELD_4BIT;
-        } else if (values[x] < 128 && values[x] >= -128) {
-            selector |= FIELD_8BIT;
-        } else {
-            selector |= FIELD_16BIT;
-        }
+        const int field = (values[x] != 0) + !FITS_SIGNED_BITS(values[x], 4) + !FITS_SIGNED_BITS(values[x], 8);
+        selector = (selector << 2) | field;
     }
 
-    blackboxWrite(selector);
+    *buf++ = selector;
 
     int nibbleIndex = 0;
     uint8_t buffer = 0;
@@ -399,16 +413,16 @@ void blackboxWriteTag8_4S16(int32_t *values)
                 buffer = values[x] << 4;
                 nibbleIndex = 1;
             } else {
-                blackboxWrite(buffer | (values[x] & 0x0F));
+                *buf++ = buffer | (values[x] & 0x0F);
                 nibbleIndex = 0;
             }
             break;
         case FIELD_8BIT:
             if (nibbleIndex == 0) {
-                blackboxWrite(values[x]);
+                *buf++ = values[x];
             } else {
                 //Write the high bits of the value first (mask to avoid sign extension)
-                blackboxWrite(buffer | ((values[x] >> 4) & 0x0F));
+                *buf++ = buffer | ((values[x] >> 4) & 0x0F);
                 //Now put the leftover low bits into the top of the next buffer entry
                 buffer = values[x] << 4;
             }
@@ -416,13 +430,13 @@ void blackboxWriteTag8_4S16(int32_t *values)
         case FIELD_16BIT:
             if (nibbleIndex == 0) {
                 //Write high byte first
-                blackboxWrite(values[x] >> 8);
-                blackboxWrite(values[x]);
+                *buf++ = values[x] >> 8;
+                *buf++ = values[x];
             } else {
                 //First write the highest 4 bits
-                blackboxWrite(buffer | ((values[x] >> 12) & 0x0F));
+                *buf++ = buffer | ((values[x] >> 12) & 0x0F);
                 // Then the middle 8
-                blackboxWrite(values[x] >> 4);
+                *buf++ = values[x] >> 4;
                 //Only the smallest 4 bits are still left to write
                 buffer = values[x] << 4;
             }
@@ -431,8 +445,46 @@ void blackboxWriteTag8_4S16(int32_t *values)
     }
     //Anything left over to write?
     if (nibbleIndex == 1) {
-        blackboxWrite(buffer);
+        *buf++ = buffer;
+    }
+
+    return buf;
+}
+
+/**
+ * Write an 8-bit selector followed by four signed fields of size 0, 4, 8 or 16 bits.
+ */
+void blackboxWriteTag8_4S16(int32_t *values)
+{
+    uint8_t buf[BLACKBOX_TAG8_4S16_MAX_BYTES];
+
+    blackboxWriteBuf(buf, blackboxEncodeTag8_4S16(buf, values) - buf);
+}
+
+/**
+ * Encode `valueCount` fields from `values` using signed variable byte encoding. A 1-byte header is written first which
+ * specifies which fields are non-zero (so this encoding is compact when most fields are zero).
+ *
+ * valueCount must be 8 or less.
+ */
+uint8_t *blackboxEncodeTag8_8SVB(uint8_t *buf, const int32_t *values, int valueCount)
+{
+    //If we're only writing one field then we can skip the header
+    if (valueCount == 1) {
+        return blackboxEncodeSignedVB(buf, values[0]);
+    } else if (valueCount > 1) {
+        //First write a one-byte header that marks which fields are non-zero, first field in the low bit
+        uint8_t *header = buf++;
+        *header = 0;
+
+        for (int i = 0; i < valueCount; i++) {
+            if (values[i] != 0) {
+                *header |= 1 << i;
+                buf = blackboxEncodeSignedVB(buf, values[i]);
+            }
+        }
     }
+    return buf;
 }
 
 /**
@@ -443,34 +495,9 @@ void blackboxWriteTag8_4S16(int32_t *values)
  */
 void blackboxWriteTag8_8SVB(int32_t *values, int valueCount)
 {
-    uint8_t header;
-
-    if (valueCount > 0) {
-        //If we're only writing one field then we can skip the header
-        if (valueCount == 1) {
-            blackboxWriteSignedVB(values[0]);
-        } else {
-            //First write a one-byte header that marks which fields are non-zero
-            header = 0;
-
-            // First field should be in low bits of header
-            for (int i = valueCount - 1; i >= 0; i--) {
-                header <<= 1;
-
-                if (values[i] != 0) {
-                    header |= 0x01;
-                }
-            }
-
-            blackboxWrite(header);
+    uint8_t buf[BLACKBOX_TAG8_8SVB_MAX_BYTES];
 
-            for (int i = 0; i < valueCount; i++) {
-                if (values[i] != 0) {
-                    blackboxWriteSignedVB(values[i]);
-                }
-            }
-        }
-    }
+    blackboxWriteBuf(buf, blackboxEncodeTag8_8SVB(buf, values, valueCount) - buf);
 }
 
 /** Write unsigned integer **/
@@ -17,6 +17,17 @@
 
 #pragma once
 
+#include <stdint.h>
+
+// Worst case sizes of the block encoders' output
+#define BLACKBOX_VB_MAX_BYTES           5
+#define BLACKBOX_TAG2_3S32_MAX_BYTES    (1 + 3 * 4)
+#define BLACKBOX_TAG8_4S16_MAX_BYTES    (1 + 4 * 2)
+#define BLACKBOX_TAG8_8SVB_MAX_BYTES    (1 + 8 * BLACKBOX_VB_MAX_BYTES)
+
+// Largest frame assembled by the frame writers, a worst case I-frame with 8 motors is about 230 bytes
+#define BLACKBOX_MAX_FRAME_SIZE         256
+
 int blackboxPrintf(const char *fmt, ...);
 void blackboxPrintfHeaderLine(const char *name, const char *fmt, ...);
 
@@ -31,3 +42,15 @@ void blackboxWriteTag8_4S16(int32_t *values);
 void blackboxWriteTag8_8SVB(int32_t *values, int valueCount);
 void blackboxWriteU32(int32_t value);
 void blackboxWriteFloat(float value);
+
+/*
+ * Block encoders: encode into buf and return the position after the last byte written, so that a frame can be
+ * assembled in a local buffer and handed to the device with a single blackboxWriteBuf().
+ */
+uint8_t *blackboxEncodeUnsignedVB(uint8_t *buf, uint32_t value);
+uint8_t *blackboxEncodeSignedVB(uint8_t *buf, int32_t value);
+uint8_t *blackboxEncodeSignedVBArray(uint8_t *buf, const int32_t *array, int count);
+uint8_t *blackboxEncodeSigned16VBArray(uint8_t *buf, const int16_t *array, int count);
+uint8_t *blackboxEncodeTag2_3S32(uint8_t *buf, const int32_t *values);
+uint8_t *blackboxEncodeTag8_4S16(uint8_t *buf, const int32_t *values);
+uint8_t *blackboxEncodeTag8_8SVB(uint8_t *buf, const int32_t *values, int valueCount);
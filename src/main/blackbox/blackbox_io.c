@@ -83,6 +83,27 @@ void blackboxWrite(uint8_t value)
     }
 }
 
+// Write a block of bytes to the blackbox device with a single call, used by the frame writers
+void blackboxWriteBuf(const uint8_t *buf, int length)
+{
+    switch (blackboxConfig()->device) {
+#ifdef USE_FLASHFS
+    case BLACKBOX_DEVICE_FLASH:
+        flashfsWrite(buf, length, false); // Write asynchronously, full pages are programmed straight from buf
+        break;
+#endif
+#ifdef USE_SDCARD
+    case BLACKBOX_DEVICE_SDCARD:
+        afatfs_fwrite(blackboxSDCard.logFile, buf, length); // Ignore failures due to buffers filling up
+        break;
+#endif
+    case BLACKBOX_DEVICE_SERIAL:
+    default:
+        serialWriteBuf(blackboxPort, buf, length);
+        break;
+    }
+}
+
 // Print the null-terminated string 's' to the blackbox device and return the number of bytes written
 int blackboxWriteString(const char *s)
 {
@@ -134,7 +155,8 @@ void blackboxDeviceFlush(void)
          * devices will progressively write in the background without Blackbox calling anything.
          */
     case BLACKBOX_DEVICE_FLASH:
-        flashfsFlushAsync();
+        // Only completed pages, a partial one would keep the flash busy for no more than a few frames
+        flashfsFlushAsync(false);
         break;
 #endif // USE_FLASHFS
 
@@ -157,7 +179,7 @@ bool blackboxDeviceFlushForce(void)
 
 #ifdef USE_FLASHFS
     case BLACKBOX_DEVICE_FLASH:
-        return flashfsFlushAsync();
+        return flashfsFlushAsync(true);
 #endif // USE_FLASHFS
 
 #ifdef USE_SDCARD
@@ -595,7 +617,7 @@ blackboxBufferReserveStatus_e blackboxDeviceReserveBufferSpace(int32_t bytes)
              * that the Blackbox header writing code doesn't have to guess about the best time to ask flashfs to
              * flush, and doesn't stall waiting for a flush that would otherwise not automatically be called.
              */
-            flashfsFlushAsync();
+            flashfsFlushAsync(true);
         }
         return BLACKBOX_RESERVE_TEMPORARY_FAILURE;
 #endif // USE_FLASHFS
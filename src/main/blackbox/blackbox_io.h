@@ -39,6 +39,7 @@ extern int32_t blackboxHeaderBudget;
 
 void blackboxOpen(void);
 void blackboxWrite(uint8_t value);
+void blackboxWriteBuf(const uint8_t *buf, int length);
 int blackboxWriteString(const char *s);
 
 void blackboxDeviceFlush(void);
@@ -76,4 +76,5 @@ const char * const debugModeNames[DEBUG_COUNT] = {
     "PSI",
     "CA",
     "PHIL",
+    "RPM_FILTER",
 };
@@ -96,6 +96,7 @@ typedef enum {
     DEBUG_PSI,
     DEBUG_CA,
     DEBUG_PHIL,
+    DEBUG_RPM_FILTER,
     DEBUG_COUNT
 } debugType_e;
 
@@ -21,3 +21,4 @@
 
 uint32_t castFloatBytesToInt(float f);
 uint32_t zigzagEncode(int32_t value);
+int32_t zigzagDecode(uint32_t value);
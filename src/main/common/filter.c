@@ -157,6 +157,23 @@ FAST_CODE void biquadFilterUpdate(biquadFilter_t *filter, float filterFreq, uint
     filter->y2 = y2;
 }
 
+void biquadNotchTableInit(biquadNotchTable_t *table, float minHz, float maxHz, uint32_t refreshRate, biquadNotchQFnPtr notchQFn)
+{
+    const float stepHz = (maxHz - minHz) / (BIQUAD_NOTCH_TABLE_SIZE - 1);
+    table->minHz = minHz;
+    table->maxHz = maxHz;
+    table->hzToIndex = stepHz > 0 ? 1.0f / stepHz : 0;
+
+    for (int i = 0; i < BIQUAD_NOTCH_TABLE_SIZE; i++) {
+        const float centerFreq = minHz + i * stepHz;
+        biquadFilter_t filter;
+        biquadFilterInit(&filter, centerFreq, refreshRate, notchQFn(centerFreq), FILTER_NOTCH);
+        table->b0[i] = filter.b0;
+        table->a1[i] = filter.a1;
+        table->a2[i] = filter.a2;
+    }
+}
+
 /* Computes a biquadFilter_t filter on a sample (slightly less precise than df2 but works in dynamic mode) */
 FAST_CODE float biquadFilterApplyDF1(biquadFilter_t *filter, float input)
 {
@@ -344,3 +361,140 @@ FAST_CODE float fastKalmanUpdate(fastKalman_t *filter, float input)
 
     return filter->x;
 }
+
+/*
+ * Filter banks, one lane per axis. The loops have a constant trip count and no dependency between lanes so the
+ * compiler unrolls them on the F4/F7, where the FPU is scalar and the gain is one call per stage instead of one per
+ * axis, and turns them into 4-wide SSE/NEON operations on SITL and host builds.
+ */
+
+void pt1FilterBankInit(pt1FilterBank_t *bank, uint8_t f_cut, float dT)
+{
+    pt1Filter_t filter;
+    pt1FilterInit(&filter, f_cut, dT);
+    for (int lane = 0; lane < FILTER_BANK_LANES; lane++) {
+        bank->k[lane] = filter.k;
+        bank->state[lane] = 0.0f;
+    }
+}
+
+FAST_CODE void pt1FilterBankApply(pt1FilterBank_t *bank, float *data)
+{
+    for (int lane = 0; lane < FILTER_BANK_LANES; lane++) {
+        bank->state[lane] = bank->state[lane] + bank->k[lane] * (data[lane] - bank->state[lane]);
+        data[lane] = bank->state[lane];
+    }
+}
+
+static void biquadFilterBankSetCoefficients(biquadFilterBank_t *bank, int lane, const biquadFilter_t *filter)
+{
+    bank->b0[lane] = filter->b0;
+    bank->b1[lane] = filter->b1;
+    bank->b2[lane] = filter->b2;
+    bank->a1[lane] = filter->a1;
+    bank->a2[lane] = filter->a2;
+}
+
+static void biquadFilterBankSetAll(biquadFilterBank_t *bank, const biquadFilter_t *filter)
+{
+    memset(bank, 0, sizeof(biquadFilterBank_t));
+    for (int lane = 0; lane < FILTER_BANK_LANES; lane++) {
+        biquadFilterBankSetCoefficients(bank, lane, filter);
+    }
+}
+
+void biquadFilterBankInit(biquadFilterBank_t *bank, float filterFreq, uint32_t refreshRate, float Q, biquadFilterType_e filterType)
+{
+    biquadFilter_t filter;
+    biquadFilterInit(&filter, filterFreq, refreshRate, Q, filterType);
+    biquadFilterBankSetAll(bank, &filter);
+}
+
+void biquadFilterBankInitLPF(biquadFilterBank_t *bank, float filterFreq, uint32_t refreshRate)
+{
+    biquadFilterBankInit(bank, filterFreq, refreshRate, BIQUAD_Q, FILTER_LPF);
+}
+
+void biquadRCFIR2FilterBankInit(biquadFilterBank_t *bank, uint16_t f_cut, float dT)
+{
+    biquadFilter_t filter;
+    biquadRCFIR2FilterInit(&filter, f_cut, dT);
+    biquadFilterBankSetAll(bank, &filter);
+}
+
+/* Moves the coefficients of one lane, its state is kept so this must be used with biquadFilterBankApplyDF1 */
+FAST_CODE void biquadFilterBankUpdate(biquadFilterBank_t *bank, int lane, float filterFreq, uint32_t refreshRate, float Q, biquadFilterType_e filterType)
+{
+    biquadFilter_t filter;
+    biquadFilterInit(&filter, filterFreq, refreshRate, Q, filterType);
+    biquadFilterBankSetCoefficients(bank, lane, &filter);
+}
+
+/* Same as biquadFilterBankUpdate for a notch, with the coefficients interpolated from the table, frequencies outside of it are clamped */
+FAST_CODE void biquadFilterBankUpdateNotch(biquadFilterBank_t *bank, int lane, const biquadNotchTable_t *table, float filterFreq)
+{
+    const float index = (constrainf(filterFreq, table->minHz, table->maxHz) - table->minHz) * table->hzToIndex;
+    const int i = MIN((int)index, BIQUAD_NOTCH_TABLE_SIZE - 2);
+    const float fraction = index - i;
+
+    const float b0 = table->b0[i] + fraction * (table->b0[i + 1] - table->b0[i]);
+    const float a1 = table->a1[i] + fraction * (table->a1[i + 1] - table->a1[i]);
+    bank->b0[lane] = b0;
+    bank->b1[lane] = a1;
+    bank->b2[lane] = b0;
+    bank->a1[lane] = a1;
+    bank->a2[lane] = table->a2[i] + fraction * (table->a2[i + 1] - table->a2[i]);
+}
+
+FAST_CODE void biquadFilterBankApplyDF1(biquadFilterBank_t *bank, float *data)
+{
+    for (int lane = 0; lane < FILTER_BANK_LANES; lane++) {
+        const float input = data[lane];
+        const float result = bank->b0[lane] * input + bank->b1[lane] * bank->x1[lane] + bank->b2[lane] * bank->x2[lane] - bank->a1[lane] * bank->y1[lane] - bank->a2[lane] * bank->y2[lane];
+        bank->x2[lane] = bank->x1[lane];
+        bank->x1[lane] = input;
+        bank->y2[lane] = bank->y1[lane];
+        bank->y1[lane] = result;
+        data[lane] = result;
+    }
+}
+
+/* Direct form 2, the x1 and x2 fields hold the two delay elements as in biquadFilterApply */
+FAST_CODE void biquadFilterBankApply(biquadFilterBank_t *bank, float *data)
+{
+    for (int lane = 0; lane < FILTER_BANK_LANES; lane++) {
+        const float input = data[lane];
+        const float result = bank->b0[lane] * input + bank->x1[lane];
+        bank->x1[lane] = bank->b1[lane] * input - bank->a1[lane] * result + bank->x2[lane];
+        bank->x2[lane] = bank->b2[lane] * input - bank->a2[lane] * result;
+        data[lane] = result;
+    }
+}
+
+void fastKalmanBankInit(fastKalmanBank_t *bank, float q, float r, float p)
+{
+    fastKalman_t filter;
+    fastKalmanInit(&filter, q, r, p);
+    for (int lane = 0; lane < FILTER_BANK_LANES; lane++) {
+        bank->q[lane] = filter.q;
+        bank->r[lane] = filter.r;
+        bank->p[lane] = filter.p;
+        bank->k[lane] = filter.k;
+        bank->x[lane] = filter.x;
+        bank->lastX[lane] = filter.lastX;
+    }
+}
+
+FAST_CODE void fastKalmanBankApply(fastKalmanBank_t *bank, float *data)
+{
+    for (int lane = 0; lane < FILTER_BANK_LANES; lane++) {
+        const float x = bank->x[lane] + (bank->x[lane] - bank->lastX[lane]);
+        bank->lastX[lane] = x;
+        const float p = bank->p[lane] + bank->q[lane];
+        const float k = p / (p + bank->r[lane]);
+        bank->x[lane] = x + k * (data[lane] - x);
+        bank->p[lane] = (1.0f - k) * p;
+        bank->k[lane] = k;
+        data[lane] = bank->x[lane];
+    }
+}
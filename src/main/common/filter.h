@@ -85,7 +85,56 @@ typedef struct firFilter_s {
     uint8_t coeffsLength;
 } firFilter_t;
 
+/*
+ * Filter banks run the same filter on the X, Y and Z axes in one call. The state and the coefficients are laid out as
+ * one array per field so that every statement of the apply functions is a 4-wide operation: the fourth lane is padding,
+ * it filters zeros and is never read back. Each lane has its own coefficients so that the dynamic notch can move them
+ * independently.
+ */
+#define FILTER_BANK_LANES 4
+
+struct filterBank_s;
+typedef struct filterBank_s filterBank_t;
+
+typedef struct pt1FilterBank_s {
+    float state[FILTER_BANK_LANES];
+    float k[FILTER_BANK_LANES];
+} pt1FilterBank_t;
+
+typedef struct biquadFilterBank_s {
+    float b0[FILTER_BANK_LANES], b1[FILTER_BANK_LANES], b2[FILTER_BANK_LANES], a1[FILTER_BANK_LANES], a2[FILTER_BANK_LANES];
+    float x1[FILTER_BANK_LANES], x2[FILTER_BANK_LANES], y1[FILTER_BANK_LANES], y2[FILTER_BANK_LANES];
+} biquadFilterBank_t;
+
+typedef struct fastKalmanBank_s {
+    float q[FILTER_BANK_LANES];
+    float r[FILTER_BANK_LANES];
+    float p[FILTER_BANK_LANES];
+    float k[FILTER_BANK_LANES];
+    float x[FILTER_BANK_LANES];
+    float lastX[FILTER_BANK_LANES];
+} fastKalmanBank_t;
+
+/*
+ * Notch coefficients computed at init for a range of centre frequencies at one refresh rate, so that moving a notch is
+ * a lookup with linear interpolation instead of trig and divisions. The Q of each entry is given by a function of the
+ * centre frequency. A normalised notch has b2 == b0 and b1 == a1, only three coefficients are kept.
+ */
+#define BIQUAD_NOTCH_TABLE_SIZE 128
+
+typedef float (*biquadNotchQFnPtr)(float centerFreq);
+
+typedef struct biquadNotchTable_s {
+    float minHz;
+    float maxHz;
+    float hzToIndex;
+    float b0[BIQUAD_NOTCH_TABLE_SIZE];
+    float a1[BIQUAD_NOTCH_TABLE_SIZE];
+    float a2[BIQUAD_NOTCH_TABLE_SIZE];
+} biquadNotchTable_t;
+
 typedef float (*filterApplyFnPtr)(filter_t *filter, float input);
+typedef void (*filterBankApplyFnPtr)(filterBank_t *bank, float *data);
 
 float nullFilterApply(filter_t *filter, float input);
 
@@ -96,6 +145,8 @@ float biquadFilterApplyDF1(biquadFilter_t *filter, float input);
 float biquadFilterApply(biquadFilter_t *filter, float input);
 float filterGetNotchQ(uint16_t centerFreq, uint16_t cutoff);
 
+void biquadNotchTableInit(biquadNotchTable_t *table, float minHz, float maxHz, uint32_t refreshRate, biquadNotchQFnPtr notchQFn);
+
 void biquadRCFIR2FilterInit(biquadFilter_t *filter, uint16_t f_cut, float dT);
 
 void fastKalmanInit(fastKalman_t *filter, float q, float r, float p);
@@ -122,3 +173,17 @@ float firFilterLastInput(const firFilter_t *filter);
 
 void firFilterDenoiseInit(firFilterDenoise_t *filter, uint8_t gyroSoftLpfHz, uint16_t targetLooptime);
 float firFilterDenoiseUpdate(firFilterDenoise_t *filter, float input);
+
+void pt1FilterBankInit(pt1FilterBank_t *bank, uint8_t f_cut, float dT);
+void pt1FilterBankApply(pt1FilterBank_t *bank, float *data);
+
+void biquadFilterBankInit(biquadFilterBank_t *bank, float filterFreq, uint32_t refreshRate, float Q, biquadFilterType_e filterType);
+void biquadFilterBankInitLPF(biquadFilterBank_t *bank, float filterFreq, uint32_t refreshRate);
+void biquadRCFIR2FilterBankInit(biquadFilterBank_t *bank, uint16_t f_cut, float dT);
+void biquadFilterBankUpdate(biquadFilterBank_t *bank, int lane, float filterFreq, uint32_t refreshRate, float Q, biquadFilterType_e filterType);
+void biquadFilterBankUpdateNotch(biquadFilterBank_t *bank, int lane, const biquadNotchTable_t *table, float filterFreq);
+void biquadFilterBankApply(biquadFilterBank_t *bank, float *data);
+void biquadFilterBankApplyDF1(biquadFilterBank_t *bank, float *data);
+
+void fastKalmanBankInit(fastKalmanBank_t *bank, float q, float r, float p);
+void fastKalmanBankApply(fastKalmanBank_t *bank, float *data);
@@ -65,39 +65,58 @@ int huffmanEncodeBuf(uint8_t *outBuf, int outBufLen, const uint8_t *inBuf, int i
     return ret;
 }
 
+/*
+ * Encode with one table lookup per input byte, the codes are shifted into a bit accumulator and written out a whole
+ * byte at a time instead of bit by bit.
+ *
+ * If the output buffer overflows the state is left as it was before the call and -1 is returned, so the caller can
+ * stop at the end of the previous input buffer.
+ */
 int huffmanEncodeBufStreaming(huffmanState_t *state, const uint8_t *inBuf, int inLen, const huffmanTable_t *huffmanTable)
 {
-    uint8_t *savedOutBytePtr = state->outByte;
-    uint8_t savedOutByte = *savedOutBytePtr;
+    uint8_t *outByte = state->outByte;
+    uint16_t bytesWritten = state->bytesWritten;
+    const uint8_t savedOutByte = *outByte;
+
+    // The bits already in the current output byte, right aligned
+    int bitCount = 0;
+    for (uint8_t outBit = state->outBit; outBit != 0x80; outBit <<= 1) {
+        ++bitCount;
+    }
+    uint32_t bits = savedOutByte >> (8 - bitCount);
 
     for (const uint8_t *pos = inBuf, *end = inBuf + inLen; pos < end; ++pos) {
         const int huffCodeLen = huffmanTable[*pos].codeLen;
-        const uint16_t huffCode = huffmanTable[*pos].code;
-        uint16_t testBit = 0x8000;
 
-        for (int jj = 0; jj < huffCodeLen; ++jj) {
-            if (huffCode & testBit) {
-                *state->outByte |= state->outBit;
-            }
+        bits = (bits << huffCodeLen) | (huffmanTable[*pos].code >> (16 - huffCodeLen));
+        bitCount += huffCodeLen;
 
-            testBit >>= 1;
-            state->outBit >>= 1;
-            if (state->outBit == 0) {
-                state->outBit = 0x80;
-                ++state->outByte;
-                *state->outByte = 0;
-                ++state->bytesWritten;
-            }
-
-            // if buffer is filled and we haven't finished compressing
-            if (state->bytesWritten >= state->outBufLen && (pos < end - 1 || jj < huffCodeLen - 1)) {
-                // restore savedOutByte
-                *savedOutBytePtr = savedOutByte;
+        while (bitCount >= 8) {
+            if (bytesWritten >= state->outBufLen) {
+                // buffer is filled and we haven't finished compressing, restore savedOutByte
+                *state->outByte = savedOutByte;
                 return -1;
             }
+            bitCount -= 8;
+            *outByte++ = bits >> bitCount;
+            ++bytesWritten;
         }
     }
 
+    if (bitCount > 0) {
+        if (bytesWritten >= state->outBufLen) {
+            *state->outByte = savedOutByte;
+            return -1;
+        }
+        *outByte = bits << (8 - bitCount);
+    } else if (bytesWritten < state->outBufLen) {
+        *outByte = 0;
+    }
+
+    state->outByte = outByte;
+    state->bytesWritten = bytesWritten;
+    state->outBit = 0x80 >> bitCount;
+
     return 0;
 }
 
@@ -301,18 +301,15 @@ void m25p16_eraseCompletely(void)
     m25p16_performOneByteCommand(bus, M25P16_INSTRUCTION_BULK_ERASE);
 }
 
-static uint32_t currentWriteAddress;
-
+/**
+ * Start a page program operation at the given address: the data of the following m25p16_pageProgramContinue() calls
+ * is clocked into the same PAGE_PROGRAM command, which is committed to the array by m25p16_pageProgramFinish().
+ */
 void m25p16_pageProgramBegin(uint32_t address)
-{
-    currentWriteAddress = address;
-}
-
-void m25p16_pageProgramContinue(const uint8_t *data, int length)
 {
     uint8_t command[5] = { M25P16_INSTRUCTION_PAGE_PROGRAM };
 
-    m25p16_setCommandAddress(&command[1], currentWriteAddress, isLargeFlash);
+    m25p16_setCommandAddress(&command[1], address, isLargeFlash);
 
     m25p16_waitForReady(DEFAULT_TIMEOUT_MILLIS);
 
@@ -321,16 +318,17 @@ void m25p16_pageProgramContinue(const uint8_t *data, int length)
     m25p16_enable(bus);
 
     spiTransfer(bus->busdev_u.spi.instance, command, NULL, isLargeFlash ? 5 : 4);
+}
 
+void m25p16_pageProgramContinue(const uint8_t *data, int length)
+{
     spiTransfer(bus->busdev_u.spi.instance, data, NULL, length);
-
-    m25p16_disable(bus);
-
-    currentWriteAddress += length;
 }
 
 void m25p16_pageProgramFinish(void)
 {
+    // Raising CS starts the internal program cycle
+    m25p16_disable(bus);
 }
 
 /**
@@ -346,7 +344,8 @@ void m25p16_pageProgramFinish(void)
  * (Although the maximum possible write time is noted as 5ms).
  *
  * If you want to write multiple buffers (whose sum of sizes is still not more than the page size) then you can
- * break this operation up into one beginProgram call, one or more continueProgram calls, and one finishProgram call.
+ * break this operation up into one beginProgram call, one or more continueProgram calls, and one finishProgram call,
+ * the buffers are then programmed with a single program cycle.
  */
 void m25p16_pageProgram(uint32_t address, const uint8_t *data, int length)
 {
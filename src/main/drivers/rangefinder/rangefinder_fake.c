@@ -0,0 +1,71 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <platform.h>
+
+#ifdef USE_FAKE_RANGEFINDER
+
+#include "common/utils.h"
+
+#include "drivers/rangefinder/rangefinder.h"
+#include "drivers/rangefinder/rangefinder_fake.h"
+
+#define FAKE_RANGEFINDER_RANGE_MAX                  400     // cm
+#define FAKE_RANGEFINDER_DETECTION_CONE_DECIDEGREES 900
+
+static volatile int32_t fakeDistance = RANGEFINDER_OUT_OF_RANGE;
+
+static void fakeRangefinderInit(rangefinderDev_t *dev)
+{
+    UNUSED(dev);
+}
+
+static void fakeRangefinderUpdate(rangefinderDev_t *dev)
+{
+    UNUSED(dev);
+}
+
+static int32_t fakeRangefinderGetDistance(rangefinderDev_t *dev)
+{
+    UNUSED(dev);
+
+    return fakeDistance;
+}
+
+// distance along the sensor axis in cm, RANGEFINDER_OUT_OF_RANGE when nothing is in range
+void fakeRangefinderSet(int32_t distance)
+{
+    fakeDistance = (distance > FAKE_RANGEFINDER_RANGE_MAX) ? RANGEFINDER_OUT_OF_RANGE : distance;
+}
+
+bool fakeRangefinderDetect(rangefinderDev_t *dev)
+{
+    dev->delayMs = RANGEFINDER_FAKE_TASK_PERIOD_MS;
+    dev->maxRangeCm = FAKE_RANGEFINDER_RANGE_MAX;
+    dev->detectionConeDeciDegrees = FAKE_RANGEFINDER_DETECTION_CONE_DECIDEGREES;
+    dev->detectionConeExtendedDeciDegrees = FAKE_RANGEFINDER_DETECTION_CONE_DECIDEGREES;
+
+    dev->init = &fakeRangefinderInit;
+    dev->update = &fakeRangefinderUpdate;
+    dev->read = &fakeRangefinderGetDistance;
+
+    return true;
+}
+#endif // USE_FAKE_RANGEFINDER
@@ -46,6 +46,13 @@ bool tcpIsStart(void) {
 }
 static void onData(dyad_Event *e) {
     tcpPort_t* s = (tcpPort_t*)(e->udata);
+    if (s->port.rxCallback) {
+        // like the UART RX interrupt, bytes go straight to the callback instead of the RX buffer
+        for (int i = 0; i < e->size; i++) {
+            s->port.rxCallback((uint8_t)e->data[i], s->port.rxCallbackData);
+        }
+        return;
+    }
     tcpDataIn(s, (uint8_t*)e->data, e->size);
 }
 static void onClose(dyad_Event *e) {
@@ -69,6 +76,10 @@ static void onAccept(dyad_Event *e) {
     s->clientCount++;
     fprintf(stderr, "[NEW]UART%u: %d,%d\n", s->id + 1, s->connected, s->clientCount);
     s->conn = e->remote;
+    // drop what was written while nobody listened, a full buffer would otherwise stall writers that check free space
+    pthread_mutex_lock(&s->txLock);
+    s->port.txBufferTail = s->port.txBufferHead;
+    pthread_mutex_unlock(&s->txLock);
     dyad_setNoDelay(e->remote, 1);
     dyad_setTimeout(e->remote, 120);
     dyad_addListener(e->remote, DYAD_EVENT_DATA, onData, e->udata);
@@ -36,6 +36,7 @@
 #include "fc/rc_adjustments.h"
 #include "fc/rc_controls.h"
 
+#include "flight/altitude.h"
 #include "flight/failsafe.h"
 #include "flight/imu.h"
 #include "flight/mixer.h"
@@ -53,9 +54,12 @@
 
 #include "rx/rx.h"
 
+#include "scheduler/scheduler.h"
+
 #include "sensors/acceleration.h"
 #include "sensors/battery.h"
 #include "sensors/gyro.h"
+#include "sensors/gyroanalyse.h"
 
 #ifndef USE_OSD_SLAVE
 pidProfile_t *currentPidProfile;
@@ -71,7 +75,7 @@ PG_RESET_TEMPLATE(pilotConfig_t, pilotConfig,
     .name = { 0 }
 );
 
-PG_REGISTER_WITH_RESET_TEMPLATE(systemConfig_t, systemConfig, PG_SYSTEM_CONFIG, 2);
+PG_REGISTER_WITH_RESET_TEMPLATE(systemConfig_t, systemConfig, PG_SYSTEM_CONFIG, 3);
 
 PG_RESET_TEMPLATE(systemConfig_t, systemConfig,
     .pidProfileIndex = 0,
@@ -80,6 +84,7 @@ PG_RESET_TEMPLATE(systemConfig_t, systemConfig,
     .task_statistics = true,
     .cpu_overclock = 0,
     .powerOnArmingGraceTime = 5,
+    .scheduler_mode = SCHEDULER_MODE_QUEUE,
     .boardIdentifier = TARGET_BOARD_IDENTIFIER
 );
 
@@ -202,6 +207,15 @@ static void validateAndFixConfig(void)
 
     validateAndFixGyroConfig();
 
+#ifdef USE_ALT_HOLD
+    if (altHoldConfig()->throttle_min >= altHoldConfig()->throttle_max) {
+        altHoldConfig_t altHoldDefaults;
+        pgResetCopy(&altHoldDefaults, PG_ALT_HOLD_CONFIG);
+        altHoldConfigMutable()->throttle_min = altHoldDefaults.throttle_min;
+        altHoldConfigMutable()->throttle_max = altHoldDefaults.throttle_max;
+    }
+#endif
+
     if (!(featureConfigured(FEATURE_RX_PARALLEL_PWM) || featureConfigured(FEATURE_RX_PPM) || featureConfigured(FEATURE_RX_SERIAL) || featureConfigured(FEATURE_RX_MSP) || featureConfigured(FEATURE_RX_SPI))) {
         featureSet(DEFAULT_RX_FEATURE);
     }
@@ -392,6 +406,16 @@ void validateAndFixGyroConfig(void)
         samplingTime = 0.00003125;
     }
 
+#ifdef USE_GYRO_DATA_ANALYSE
+    // The FFT needs a power of 2 window, round down, and a small enough one to run within the gyro cycle
+    const uint16_t fftWindowMax = gyroDataAnalyseWindowMax(lrintf(samplingTime * gyroConfig()->gyro_sync_denom * 1000000.0f));
+    uint16_t fftWindow = 32;
+    while (fftWindow * 2 <= MIN(gyroConfig()->dyn_fft_window, fftWindowMax)) {
+        fftWindow *= 2;
+    }
+    gyroConfigMutable()->dyn_fft_window = fftWindow;
+#endif
+
     // check for looptime restrictions based on motor protocol. Motor times have safety margin
     float motorUpdateRestriction;
     switch (motorConfig()->dev.motorPwmProtocol) {
@@ -38,6 +38,7 @@ typedef struct systemConfig_s {
     uint8_t rateProfile6PosSwitch;
     uint8_t cpu_overclock;
     uint8_t powerOnArmingGraceTime; // in seconds
+    uint8_t scheduler_mode;         // schedulerMode_e
     char boardIdentifier[sizeof(TARGET_BOARD_IDENTIFIER) + 1];
 } systemConfig_t;
 
@@ -785,6 +785,8 @@ static void subTaskPidController(timeUs_t currentTimeUs)
 {
     uint32_t startTime = 0;
     if (debugMode == DEBUG_PIDLOOP) {startTime = micros();}
+    // attitude at the PID rate, ahead of the level modes that use it
+    imuIntegrateGyro(gyro.gyroADCf, targetPidLooptime * 0.000001f);
     // PID - note this is function pointer set by setPIDController()
     pidController(currentPidProfile, &accelerometerConfig()->accelerometerTrims, currentTimeUs);
     DEBUG_SET(DEBUG_PIDLOOP, 1, micros() - startTime);
@@ -883,13 +885,14 @@ static void subTaskMainSubprocesses(timeUs_t currentTimeUs)
     }
 #endif
 
-#ifdef USE_SDCARD
+#if defined(USE_SDCARD) && !defined(USE_BLACKBOX)
     afatfs_poll();
 #endif
 
 #ifdef USE_BLACKBOX
+    // Encoding and device I/O run in TASK_BLACKBOX
     if (!cliMode && blackboxConfig()->device) {
-        blackboxUpdate(currentTimeUs);
+        blackboxSnapshot(currentTimeUs);
     }
 #else
     UNUSED(currentTimeUs);
@@ -21,6 +21,8 @@
 
 #include <platform.h>
 
+#include "blackbox/blackbox.h"
+
 #include "build/debug.h"
 
 #include "cms/cms.h"
@@ -49,11 +51,13 @@
 #include "flight/altitude.h"
 #include "flight/imu.h"
 #include "flight/mixer.h"
+#include "flight/ol_navigation.h"
 #include "flight/pid.h"
 
 #include "interface/cli.h"
 #include "interface/msp.h"
 
+#include "io/asyncfatfs/asyncfatfs.h"
 #include "io/beeper.h"
 #include "io/dashboard.h"
 #include "io/gps.h"
@@ -190,6 +194,19 @@ static void taskCalculateAltitude(timeUs_t currentTimeUs)
     }}
 #endif // USE_BARO || USE_RANGEFINDER
 
+#ifdef USE_BLACKBOX
+static void taskBlackbox(timeUs_t currentTimeUs)
+{
+#ifdef USE_SDCARD
+    afatfs_poll();
+#endif
+
+    if (!cliMode && blackboxConfig()->device) {
+        blackboxUpdate(currentTimeUs);
+    }
+}
+#endif
+
 #ifdef USE_TELEMETRY
 static void taskTelemetry(timeUs_t currentTimeUs)
 {
@@ -215,6 +232,7 @@ void taskCameraControl(uint32_t currentTime)
 void fcTasksInit(void)
 {
     schedulerInit();
+    schedulerSetMode(systemConfig()->scheduler_mode);
     setTaskEnabled(TASK_SERIAL, true);
     rescheduleTask(TASK_SERIAL, TASK_PERIOD_HZ(serialConfig()->serial_update_rate_hz));
 
@@ -249,6 +267,13 @@ void fcTasksInit(void)
         setTaskEnabled(TASK_ACCEL, true);
         rescheduleTask(TASK_ACCEL, acc.accSamplingInterval);
         setTaskEnabled(TASK_ATTITUDE, true);
+
+        ol_navigation_init();
+#ifdef USE_ALT_HOLD
+        altHoldInit();
+#endif
+        rescheduleTask(TASK_OL_NAVIGATION, TASK_PERIOD_HZ(olNavigationConfig()->nav_rate_hz));
+        setTaskEnabled(TASK_OL_NAVIGATION, true);
     }
 
     setTaskEnabled(TASK_RX, true);
@@ -276,6 +301,9 @@ void fcTasksInit(void)
 #ifdef USE_DASHBOARD
     setTaskEnabled(TASK_DASHBOARD, feature(FEATURE_DASHBOARD));
 #endif
+#ifdef USE_BLACKBOX
+    setTaskEnabled(TASK_BLACKBOX, true);
+#endif
 #ifdef USE_TELEMETRY
     if (feature(FEATURE_TELEMETRY)) {
         setTaskEnabled(TASK_TELEMETRY, true);
@@ -427,6 +455,7 @@ cfTask_t cfTasks[TASK_COUNT] = {
         .checkFunc = rxUpdateCheck,
         .taskFunc = taskUpdateRxMain,
         .desiredPeriod = TASK_PERIOD_HZ(50),        // If event-based scheduling doesn't work, fallback to periodic scheduling
+        .checkPeriod = TASK_PERIOD_HZ(2000),        // Frames arrive every few ms, 500us more latency at most
         .staticPriority = TASK_PRIORITY_HIGH,
     },
 
@@ -491,6 +520,13 @@ cfTask_t cfTasks[TASK_COUNT] = {
     },
 #endif
 
+    [TASK_OL_NAVIGATION] = {
+        .taskName = "OL_NAVIGATION",
+        .taskFunc = ol_navigation_update,
+        .desiredPeriod = TASK_PERIOD_HZ(200),       // overridden by ol_nav_rate_hz
+        .staticPriority = TASK_PRIORITY_MEDIUM_HIGH,
+    },
+
 #ifdef USE_DASHBOARD
     [TASK_DASHBOARD] = {
         .taskName = "DASHBOARD",
@@ -500,6 +536,15 @@ cfTask_t cfTasks[TASK_COUNT] = {
     },
 #endif
 
+#ifdef USE_BLACKBOX
+    [TASK_BLACKBOX] = {
+        .taskName = "BLACKBOX",
+        .taskFunc = taskBlackbox,
+        .desiredPeriod = TASK_PERIOD_HZ(1000),      // drains up to BLACKBOX_FRAME_QUEUE_SIZE frames per run
+        .staticPriority = TASK_PRIORITY_MEDIUM,
+    },
+#endif
+
 #ifdef USE_OSD
     [TASK_OSD] = {
         .taskName = "OSD",
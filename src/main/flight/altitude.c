@@ -42,7 +42,8 @@
 #include "flight/altitude.h"
 #include "flight/imu.h"
 #include "flight/pid.h"
-#include "flight/ol_control.h"
+#include "flight/ol_filter.h"
+#include "flight/ol_navigation.h"
 
 #include "rx/rx.h"
 
@@ -68,26 +69,10 @@ enum {
 // 40hz update rate (20hz LPF on acc)
 #define BARO_UPDATE_FREQUENCY_40HZ (1000 * 25)
 
-// initialization of PID
-static float alt_error = 0;
-static float alt_error_last = 0;
-static float alt_error_i = 0;
-static float alt_error_d = 0;
-static int16_t my_throttle = 1463;
-
 // my_accleration
 float accX_tmp = 0;
 float accY_tmp = 0;
 float accZ_tmp = 0;
-static float xv[2] = {0,0};
-static float yv[2] = {0,0};
-static float xv_d[2] = {0,0};
-static float yv_d[2] = {0,0};
-static int32_t cf_Alt;
-static timeUs_t currentTimeUs;
-static timeUs_t previousTimeUs;
-float gain = 23.26673006;
-static float alt_dt = 0.0005; //s
 #if defined(USE_ALT_HOLD)
 
 PG_REGISTER_WITH_RESET_TEMPLATE(airplaneConfig_t, airplaneConfig, PG_AIRPLANE_CONFIG, 0);
@@ -96,6 +81,22 @@ PG_RESET_TEMPLATE(airplaneConfig_t, airplaneConfig,
     .fixedwing_althold_reversed = false
 );
 
+PG_REGISTER_WITH_RESET_TEMPLATE(altHoldConfig_t, altHoldConfig, PG_ALT_HOLD_CONFIG, 0);
+
+PG_RESET_TEMPLATE(altHoldConfig_t, altHoldConfig,
+    .hover_throttle = 1460,
+    .hover_learn = true,
+    .throttle_min = 1150,
+    .throttle_max = 1900,
+    .max_climb_rate = 300,
+    .max_descent_rate = 150,
+);
+
+// Cascade state: altitude error -> vertical velocity setpoint -> vertical acceleration -> throttle
+static float altHoldVelocityI;      // m/s^2
+static float altHoldHoverThrottle;  // us, learned while flying
+static timeUs_t altHoldPreviousTimeUs;
+
 static int32_t setVelocity = 0;
 static uint8_t velocityControl = 0;
 static int32_t errorVelocityI = 0;
@@ -104,40 +105,70 @@ static int16_t initialThrottleHold;
 
 #define DEGREES_80_IN_DECIDEGREES 800
 
+#define ALT_HOLD_GRAVITY            9.80665f
+#define ALT_HOLD_MIN_COS_TILT       0.5f    // tilt compensation is capped at 60 deg
+#define ALT_HOLD_MAX_ACC            5.0f    // m/s^2, vertical acceleration the velocity loop may ask for
+#define ALT_HOLD_HOVER_LEARN_TAU    2.0f    // s, time constant of the hover throttle estimate
+#define ALT_HOLD_HOVER_LEARN_VEL    0.3f    // m/s, only learn while the vertical speed is below this
+
+/*
+ * Position -> velocity -> thrust cascade on the ol_ filter state.
+ *
+ * The altitude error gives a rate limited climb rate setpoint (PID_ALT P), the velocity error a vertical
+ * acceleration (PID_VEL P and I). The acceleration is turned into throttle around the hover throttle, assuming
+ * thrust linear in throttle above PWM_RANGE_MIN, and divided by the cosine of the tilt so gate climbs at large
+ * bank angles do not sag.
+ */
 static void applyMultirotorAltHold(void)
 {
-    currentTimeUs = micros();
-    const timeDelta_t deltaT = currentTimeUs - previousTimeUs;
-    alt_dt = deltaT * 1e-6f;
-    // compute the P I D terms
-    my_altitude = rangefinderAlt;
-    alt_error = 150 - rangefinderAlt;
-    previousTimeUs = currentTimeUs;
-    // I term 
-    if(alt_error_i + alt_error * alt_dt < -1000000000)
-    {
-        alt_error_i = -1000000000;
+    const timeUs_t currentTimeUs = micros();
+    const float dt = constrainf(cmpTimeUs(currentTimeUs, altHoldPreviousTimeUs) * 1e-6f, 0.0f, 0.1f);
+    altHoldPreviousTimeUs = currentTimeUs;
+
+    const float kpAlt = currentPidProfile->pid[PID_ALT].P * 0.04f;    // 1/s
+    const float kpVel = currentPidProfile->pid[PID_VEL].P * 0.05f;    // 1/s
+    const float kiVel = currentPidProfile->pid[PID_VEL].I * 0.02f;    // 1/s^2
+
+    // Position loop
+    const float altitudeSetpoint = ol_navigation_get_setpoint()->alt_cmd * 0.01f;
+    const float velocitySetpoint = constrainf(kpAlt * (altitudeSetpoint - dr_state.z),
+        -altHoldConfig()->max_descent_rate * 0.01f, altHoldConfig()->max_climb_rate * 0.01f);
+
+    // Velocity loop
+    const float velocityError = velocitySetpoint - dr_state.vz;
+    const float accelerationP = kpVel * velocityError;
+    const float accelerationCmd = constrainf(accelerationP + altHoldVelocityI, -ALT_HOLD_MAX_ACC, ALT_HOLD_MAX_ACC);
+
+    // Thrust, tilt compensated
+    const float cosTilt = MAX(getCosTiltAngle(), ALT_HOLD_MIN_COS_TILT);
+    const float hoverThrust = altHoldHoverThrottle - PWM_RANGE_MIN;
+    const float throttleRaw = PWM_RANGE_MIN + hoverThrust * (1.0f + accelerationCmd / ALT_HOLD_GRAVITY) / cosTilt;
+    const float throttle = constrainf(throttleRaw, altHoldConfig()->throttle_min, altHoldConfig()->throttle_max);
+    const bool saturated = (throttle != throttleRaw) || (ABS(accelerationP + altHoldVelocityI) > ALT_HOLD_MAX_ACC);
+
+    // Integrate only while the output can still follow, so a saturated climb does not wind up
+    if (!saturated || (altHoldVelocityI * velocityError < 0)) {
+        altHoldVelocityI = constrainf(altHoldVelocityI + kiVel * velocityError * dt, -ALT_HOLD_MAX_ACC, ALT_HOLD_MAX_ACC);
     }
-    else if (alt_error_i + alt_error * alt_dt > 1000000000)
-    {
-        alt_error_i = 1000000000;
-    }
-    else
-    {
-        alt_error_i = alt_error_i + alt_error * alt_dt;
+
+    // Hover throttle: the level equivalent of the output while (nearly) not climbing
+    if (altHoldConfig()->hover_learn && ARMING_FLAG(ARMED) && !saturated
+        && ABS(dr_state.vz) < ALT_HOLD_HOVER_LEARN_VEL && ABS(velocitySetpoint) < ALT_HOLD_HOVER_LEARN_VEL) {
+        const float levelThrottle = PWM_RANGE_MIN + (throttle - PWM_RANGE_MIN) * cosTilt;
+        const float k = dt / (ALT_HOLD_HOVER_LEARN_TAU + dt);
+        altHoldHoverThrottle += k * (levelThrottle - altHoldHoverThrottle);
+        // the hover throttle now carries what the integrator had learned
+        altHoldVelocityI -= k * altHoldVelocityI;
+        // RAM copy only, it goes to the EEPROM with the next save
+        altHoldConfigMutable()->hover_throttle = lrintf(altHoldHoverThrottle);
     }
-    alt_error_last = alt_error;
-    // feedforward 1459
-    // p term 
-    my_throttle = 1459 + 0.4 * alt_error + 1.25 * alt_error_d + 0.002 * alt_error_i; // + 0.00025 * alt_error_i + 2 * alt_error_d;
-    my_throttle = constrain(my_throttle, PWM_RANGE_MIN, PWM_RANGE_MAX);
-    my_throttle = constrain(my_throttle, 1350, 1550);
-    // debug message
-    DEBUG_SET(DEBUG_ALTCTRL,0,cf_Alt);
-    DEBUG_SET(DEBUG_ALTCTRL,1,alt_error_i);
-    DEBUG_SET(DEBUG_ALTCTRL,2,alt_error_d);
-    DEBUG_SET(DEBUG_ALTCTRL,3,my_throttle);
-    rcCommand[THROTTLE] = my_throttle;
+
+    rcCommand[THROTTLE] = lrintf(throttle);
+
+    DEBUG_SET(DEBUG_ALTCTRL, 0, lrintf(dr_state.z * 100));
+    DEBUG_SET(DEBUG_ALTCTRL, 1, lrintf(velocitySetpoint * 100));
+    DEBUG_SET(DEBUG_ALTCTRL, 2, lrintf(altHoldHoverThrottle));
+    DEBUG_SET(DEBUG_ALTCTRL, 3, rcCommand[THROTTLE]);
     DEBUG_SET(DEBUG_RCDATA,0,rcData[THROTTLE])
     DEBUG_SET(DEBUG_RCDATA,1,rcData[ROLL])
     DEBUG_SET(DEBUG_RCDATA,2,rcData[PITCH])
@@ -146,9 +177,6 @@ static void applyMultirotorAltHold(void)
     DEBUG_SET(DEBUG_RCCOMMAND, 1, rcCommand[1]);
     DEBUG_SET(DEBUG_RCCOMMAND, 2, rcCommand[2]);
     DEBUG_SET(DEBUG_RCCOMMAND, 3, rcCommand[3]);
-    // error = uart_altitude - rangefinderAlt;
-    // error = dr_control.alt_cmd - rangefinderAlt;
-    // error = 150 - rangefinderAlt;
 }
 
 static void applyFixedWingAltHold(void)
@@ -183,6 +211,8 @@ void updateAltHoldState(void)
         initialThrottleHold = rcData[THROTTLE];
         errorVelocityI = 0;
         altHoldThrottleAdjustment = 0;
+        altHoldPreviousTimeUs = micros();
+        altHoldVelocityI = 0;
     }
 }
 
@@ -200,11 +230,16 @@ void updateRangefinderAltHoldState(void)
         initialThrottleHold = rcData[THROTTLE];
         errorVelocityI = 0;
         altHoldThrottleAdjustment = 0;
-        previousTimeUs = micros();
-        alt_error_i = 0;
+        altHoldPreviousTimeUs = micros();
+        altHoldVelocityI = 0;
     }
 }
 
+void altHoldInit(void)
+{
+    altHoldHoverThrottle = altHoldConfig()->hover_throttle;
+}
+
 bool isThrustFacingDownwards(attitudeEulerAngles_t *attitude)
 {
     return ABS(attitude->values.roll) < DEGREES_80_IN_DECIDEGREES && ABS(attitude->values.pitch) < DEGREES_80_IN_DECIDEGREES;
@@ -223,7 +258,7 @@ int32_t calculateAltHoldThrottleAdjustment(int32_t vel_tmp, float accZ_tmp, floa
     // Altitude P-Controller
 
     if (!velocityControl) {
-        error = constrain(AltHold - rangefinderAlt, -500, 500);
+        error = constrain(AltHold - estimatedAltitude, -500, 500);
         error = applyDeadband(error, 10); // remove small P parameter to reduce noise near zero position
         setVel = constrain((currentPidProfile->pid[PID_ALT].P * error / 128), -300, +300); // limit velocity to +/- 3 m/s
     } else {
@@ -259,81 +294,40 @@ void calculateEstimatedAltitude(timeUs_t currentTimeUs)
     }
     previousTimeUs = currentTimeUs;
 
-    static float vel = 0.0f;
-    static float accAlt = 0.0f;
-
-    int32_t baroAlt = 0;
     if (sensors(SENSOR_BARO)) {
         if (!isBaroCalibrationComplete()) {
             performBaroCalibrationCycle();
-            vel = 0;
-            accAlt = 0;
         } else {
-            baroAlt = baroCalculateAltitude();
-            my_baro = (float)baroAlt;
+            my_baro = (float)baroCalculateAltitude();
             DEBUG_SET(DEBUG_ALTITUDE, 1, my_baro);
         }
     }
-    int32_t rangefinderVel = 0;
-// #ifdef USE_RANGEFINDER
+
+    // The rangefinder corrects the ol_ filter, which integrates the IMU acceleration at the outer loop rate
     if (sensors(SENSOR_RANGEFINDER) && rangefinderProcess(getCosTiltAngle())) {
-        static int32_t lastrangefinderAlt = 0;
         rangefinderAlt = rangefinderGetLatestAltitude();
-        rangefinderVel = (rangefinderAlt - lastrangefinderAlt) * 1000000.0f / dTime;
-        lastrangefinderAlt = rangefinderAlt;
-        // if (rangefinderAlt > 0 && rangefinderAlt >= rangefinderCfAltCm && rangefinderAlt <= rangefinderMaxAltWithTiltCm) {
-        //     // RANGEFINDER in range, so use complementary filter
-        //     float rangefinderTransition = (float)(rangefinderMaxAltWithTiltCm - rangefinderAlt) / (rangefinderMaxAltWithTiltCm - rangefinderCfAltCm);
-        //     rangefinderAlt = (float)rangefinderAlt * rangefinderTransition + baroAlt * (1.0f - rangefinderTransition);
+        if (rangefinderAlt != RANGEFINDER_OUT_OF_RANGE) {
             my_rangefinder = rangefinderAlt;
-        // }
+            ol_filter_correct_altitude(rangefinderAlt * 0.01f);
+        }
     }
 
-    if (sensors(SENSOR_ACC)) {
-        const float dt = accTimeSum * 1e-6f; // delta acc reading time in seconds
-        // Integrator - velocity, cm/sec
-        if (accSumCount) {
-            accX_tmp = (float)accSum[X] / accSumCount;
-            accY_tmp = (float)accSum[Y] / accSumCount;
-            accZ_tmp = (float)accSum[Z] / accSumCount;
-        }
-        const float vel_acc = accZ_tmp * accVelScale * (float)accTimeSum;
-        my_acc = accSum[2]/accSumCount;
-        DEBUG_SET(DEBUG_ALTITUDE, 2, my_acc);
-        // Integrator - Altitude in cm
-        accAlt += (vel_acc * 0.5f) * dt + vel * dt;  // integrate velocity to get distance (x= a/2 * t^2)
-        my_accalt = accAlt;
-        accAlt = accAlt * CONVERT_PARAMETER_TO_FLOAT(250) + (float)rangefinderAlt * (1.0f - CONVERT_PARAMETER_TO_FLOAT(250));    // complementary filter for altitude estimation (baro & acc)
-        cf_Alt = accAlt;
-        vel += vel_acc;
+    if (sensors(SENSOR_ACC) && accSumCount) {
+        accX_tmp = (float)accSum[X] / accSumCount;
+        accY_tmp = (float)accSum[Y] / accSumCount;
+        accZ_tmp = (float)accSum[Z] / accSumCount;
+        my_acc = accZ_tmp;
     }
 
-    DEBUG_SET(DEBUG_ALTITUDE, 0, accSum[2]/accSumCount);
+    DEBUG_SET(DEBUG_ALTITUDE, 0, 100 * dr_state.z);
+    DEBUG_SET(DEBUG_ALTITUDE, 2, my_acc);
     DEBUG_SET(DEBUG_ALTITUDE, 3, (int32_t)my_rangefinder);
-    
-    imuResetAccelerationSum();
 
-    int32_t baroVel = 0;
-#ifdef USE_BARO
-    if (sensors(SENSOR_BARO)) {
-        if (!isBaroCalibrationComplete()) {
-            return;
-        }
-
-        static int32_t lastBaroAlt = 0;
-        baroVel = (baroAlt - lastBaroAlt) * 1000000.0f / dTime;
-        lastBaroAlt = baroAlt;
-
-        baroVel = constrain(baroVel, -1500, 1500);  // constrain baro velocity +/- 1500cm/s
-        baroVel = applyDeadband(baroVel, 10);       // to reduce noise near zero
-    }
-#endif // USE_BARO
+    imuResetAccelerationSum();
 
-    // apply Complimentary Filter to keep the calculated velocity based on baro velocity (i.e. near real velocity).
-    // By using CF it's possible to correct the drift of integrated accZ (velocity) without loosing the phase, i.e without delay
-    vel = vel * CONVERT_PARAMETER_TO_FLOAT(barometerConfig()->baro_cf_vel) + rangefinderVel * (1.0f - CONVERT_PARAMETER_TO_FLOAT(barometerConfig()->baro_cf_vel));
-    int32_t vel_tmp = lrintf(vel);
-    alt_error_d = -vel_tmp;
+    estimatedAltitude = lrintf(100 * dr_state.z);
+    my_accalt = estimatedAltitude;
+    const int32_t vel_tmp = lrintf(100 * dr_state.vz);
     // set vario
     estimatedVario = applyDeadband(vel_tmp, 5);
 
@@ -341,8 +335,6 @@ void calculateEstimatedAltitude(timeUs_t currentTimeUs)
     static float accZ_old = 0.0f;
     altHoldThrottleAdjustment = calculateAltHoldThrottleAdjustment(vel_tmp, accZ_tmp, accZ_old);
     accZ_old = accZ_tmp;
-#else
-    UNUSED(accZ_tmp);
 #endif
 }
 #endif // USE_BARO || USE_RANGEFINDER
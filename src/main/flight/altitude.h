@@ -34,6 +34,17 @@ typedef struct airplaneConfig_s {
 
 PG_DECLARE(airplaneConfig_t, airplaneConfig);
 
+typedef struct altHoldConfig_s {
+    uint16_t hover_throttle;                   // throttle that holds altitude level, learned in flight, kept until the next save
+    uint8_t hover_learn;                       // learn the hover throttle while holding altitude
+    uint16_t throttle_min;                     // throttle range of the altitude controller
+    uint16_t throttle_max;
+    uint16_t max_climb_rate;                   // cm/s
+    uint16_t max_descent_rate;                 // cm/s
+} altHoldConfig_t;
+
+PG_DECLARE(altHoldConfig_t, altHoldConfig);
+
 void calculateEstimatedAltitude(timeUs_t currentTimeUs);
 int32_t getEstimatedAltitude(void);
 int32_t getEstimatedVario(void);
@@ -41,3 +52,4 @@ int32_t getEstimatedVario(void);
 void applyAltHold(void);
 void updateAltHoldState(void);
 void updateRangefinderAltHoldState(void);
+void altHoldInit(void);
@@ -20,6 +20,7 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include <math.h>
+#include <string.h>
 
 #include "platform.h"
 
@@ -27,6 +28,7 @@
 #include "build/debug.h"
 
 #include "common/axis.h"
+#include "common/utils.h"
 
 #include "pg/pg.h"
 #include "pg/pg_ids.h"
@@ -81,6 +83,8 @@ uint32_t accTimeSum = 0;        // keep track for integration of acc
 int accSumCount = 0;
 float accVelScale;
 
+static float accEarthScale;
+
 static float throttleAngleScale;
 static float fc_acc;
 static float smallAngleCosZ = 0;
@@ -99,6 +103,9 @@ static imuRuntimeConfig_t imuRuntimeConfig;
 
 STATIC_UNIT_TESTED float rMat[3][3];
 
+// acc/mag feedback of the last attitude task run in rad/s, applied by imuIntegrateGyro with every gyro step
+STATIC_UNIT_TESTED float correctionRate[XYZ_AXIS_COUNT];
+
 // quaternion of sensor frame relative to earth frame
 STATIC_UNIT_TESTED quaternion q = QUATERNION_INITIALIZE;
 STATIC_UNIT_TESTED quaternionProducts qP = QUATERNION_PRODUCTS_INITIALIZE;
@@ -109,14 +116,15 @@ quaternion offset = QUATERNION_INITIALIZE;
 // absolute angle inclination in multiple of 0.1 degree    180 deg = 1800
 attitudeEulerAngles_t attitude = EULER_INITIALIZE;
 
-PG_REGISTER_WITH_RESET_TEMPLATE(imuConfig_t, imuConfig, PG_IMU_CONFIG, 0);
+PG_REGISTER_WITH_RESET_TEMPLATE(imuConfig_t, imuConfig, PG_IMU_CONFIG, 1);
 
 PG_RESET_TEMPLATE(imuConfig_t, imuConfig,
     .dcm_kp = 2500,                // 1.0 * 10000
     .dcm_ki = 0,                   // 0.003 * 10000
     .small_angle = 25,
     .accDeadband = {.xy = 40, .z= 40},
-    .acc_unarmedcal = 1
+    .acc_unarmedcal = 1,
+    .gyro_rate_integration = 0
 );
 
 STATIC_UNIT_TESTED void imuComputeRotationMatrix(void){
@@ -159,6 +167,7 @@ void imuConfigure(uint16_t throttle_correction_angle)
     imuRuntimeConfig.dcm_ki = imuConfig()->dcm_ki / 10000.0f;
     imuRuntimeConfig.acc_unarmedcal = imuConfig()->acc_unarmedcal;
     imuRuntimeConfig.small_angle = imuConfig()->small_angle;
+    imuRuntimeConfig.gyro_rate_integration = imuConfig()->gyro_rate_integration;
 
     fc_acc = calculateAccZLowPassFilterRCTimeConstant(5.0f); // Set to fix value
     throttleAngleScale = calculateThrottleAngleScale(throttle_correction_angle);
@@ -168,6 +177,7 @@ void imuInit(void)
 {
     smallAngleCosZ = cos_approx(degreesToRadians(imuRuntimeConfig.small_angle));
     accVelScale = 9.80665f / acc.dev.acc_1G / 10000.0f;
+    accEarthScale = 9.80665f / acc.dev.acc_1G;
 
     imuComputeRotationMatrix();
 
@@ -188,6 +198,10 @@ void imuResetAccelerationSum(void)
 }
 
 #if defined(USE_ALT_HOLD)
+// Earth frame acceleration in m/s^2 without deadband or smoothing, for the ol_ estimator
+static float accEarthSum[XYZ_AXIS_COUNT];
+static int accEarthSumCount;
+
 static void imuTransformVectorBodyToEarth(t_fp_vector * v)
 {
     // From body frame to earth frame
@@ -217,6 +231,11 @@ static void imuCalculateAcceleration(timeDelta_t deltaT)
 
     imuTransformVectorBodyToEarth(&accel_ned);
 
+    accEarthSum[X] += accel_ned.V.X * accEarthScale;
+    accEarthSum[Y] += accel_ned.V.Y * accEarthScale;
+    accEarthSum[Z] += (accel_ned.V.Z - acc.dev.acc_1G) * accEarthScale;
+    accEarthSumCount++;
+
     if (imuRuntimeConfig.acc_unarmedcal == 1) {
         if (!ARMING_FLAG(ARMED)) {
             accZoffset -= accZoffset / 64;
@@ -238,13 +257,81 @@ static void imuCalculateAcceleration(timeDelta_t deltaT)
     accTimeSum += deltaT;
     accSumCount++;
 }
+
+// Mean earth frame acceleration (x north, y east, z up, gravity removed) since the last call.
+// Leaves accEarth unchanged and returns false when there was no new sample.
+bool imuGetEarthAcceleration(float *accEarth)
+{
+    IMU_LOCK;
+    const int count = accEarthSumCount;
+    if (count) {
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            accEarth[axis] = accEarthSum[axis] / count;
+            accEarthSum[axis] = 0;
+        }
+        accEarthSumCount = 0;
+    }
+    IMU_UNLOCK;
+    return count > 0;
+}
+#else
+bool imuGetEarthAcceleration(float *accEarth)
+{
+    UNUSED(accEarth);
+    return false;
+}
 #endif // USE_ALT_HOLD
 
+// Attitude quaternion as maintained by the Mahony filter, copied under the lock so the four components match
+void imuGetQuaternion(quaternion *quat)
+{
+    IMU_LOCK;
+    *quat = q;
+    IMU_UNLOCK;
+}
+
+// Rotation matrix (body to earth) matching the quaternion, copied under the lock like imuGetQuaternion
+void imuGetRotationMatrix(float rotation[3][3])
+{
+    IMU_LOCK;
+    memcpy(rotation, rMat, sizeof(rMat));
+    IMU_UNLOCK;
+}
+
 static float invSqrt(float x)
 {
     return 1.0f / sqrtf(x);
 }
 
+// First order step of the quaternion for body rates in rad/s, then renormalise and refresh the rotation matrix
+static void imuIntegrateQuaternion(float dt, float gx, float gy, float gz)
+{
+    gx *= (0.5f * dt);
+    gy *= (0.5f * dt);
+    gz *= (0.5f * dt);
+
+    quaternion buffer;
+    buffer.w = q.w;
+    buffer.x = q.x;
+    buffer.y = q.y;
+    buffer.z = q.z;
+
+    q.w += (-buffer.x * gx - buffer.y * gy - buffer.z * gz);
+    q.x += (+buffer.w * gx + buffer.y * gz - buffer.z * gy);
+    q.y += (+buffer.w * gy - buffer.x * gz + buffer.z * gx);
+    q.z += (+buffer.w * gz + buffer.x * gy - buffer.y * gx);
+
+    // Normalise quaternion
+    float recipNorm = invSqrt(sq(q.w) + sq(q.x) + sq(q.y) + sq(q.z));
+    q.w *= recipNorm;
+    q.x *= recipNorm;
+    q.y *= recipNorm;
+    q.z *= recipNorm;
+
+    // Pre-compute rotation matrix from quaternion
+    imuComputeRotationMatrix();
+}
+
 static bool imuUseFastGains(void)
 {
     return !ARMING_FLAG(ARMED) && millis() < 20000;
@@ -346,35 +433,19 @@ static void imuMahonyAHRSupdate(float dt, float gx, float gy, float gz,
     const float dcmKpGain = imuRuntimeConfig.dcm_kp * imuGetPGainScaleFactor();
 
     // Apply proportional and integral feedback
-    gx += dcmKpGain * ex + integralFBx;
-    gy += dcmKpGain * ey + integralFBy;
-    gz += dcmKpGain * ez + integralFBz;
-
-    // Integrate rate of change of quaternion
-    gx *= (0.5f * dt);
-    gy *= (0.5f * dt);
-    gz *= (0.5f * dt);
-
-    quaternion buffer;
-    buffer.w = q.w;
-    buffer.x = q.x;
-    buffer.y = q.y;
-    buffer.z = q.z;
-
-    q.w += (-buffer.x * gx - buffer.y * gy - buffer.z * gz);
-    q.x += (+buffer.w * gx + buffer.y * gz - buffer.z * gy);
-    q.y += (+buffer.w * gy - buffer.x * gz + buffer.z * gx);
-    q.z += (+buffer.w * gz + buffer.x * gy - buffer.y * gx);
-
-    // Normalise quaternion
-    float recipNorm = invSqrt(sq(q.w) + sq(q.x) + sq(q.y) + sq(q.z));
-    q.w *= recipNorm;
-    q.x *= recipNorm;
-    q.y *= recipNorm;
-    q.z *= recipNorm;
+    const float cx = dcmKpGain * ex + integralFBx;
+    const float cy = dcmKpGain * ey + integralFBy;
+    const float cz = dcmKpGain * ez + integralFBz;
+
+    if (imuRuntimeConfig.gyro_rate_integration) {
+        // the gyro is integrated by imuIntegrateGyro in the PID loop, which adds this feedback to every step
+        correctionRate[X] = cx;
+        correctionRate[Y] = cy;
+        correctionRate[Z] = cz;
+        return;
+    }
 
-    // Pre-compute rotation matrix from quaternion
-    imuComputeRotationMatrix();
+    imuIntegrateQuaternion(dt, gx + cx, gy + cy, gz + cz);
 }
 
 STATIC_UNIT_TESTED void imuUpdateEulerAngles(void)
@@ -503,6 +574,30 @@ void imuUpdateAttitude(timeUs_t currentTimeUs)
     }
 }
 
+/*
+ * Called from the PID loop with the filtered gyro in deg/s. With gyro_rate_integration the attitude follows the gyro at
+ * the PID rate instead of lagging by up to one attitude task period, consumers of the quaternion and rotation matrix
+ * see it straight away. The Euler angles are still derived in the attitude task.
+ */
+void imuIntegrateGyro(const float *gyroRate, float dt)
+{
+#if defined(SIMULATOR_BUILD) && defined(SKIP_IMU_CALC)
+    UNUSED(gyroRate);
+    UNUSED(dt);
+#else
+    if (!imuRuntimeConfig.gyro_rate_integration || !sensors(SENSOR_ACC) || !acc.isAccelUpdatedAtLeastOnce) {
+        return;
+    }
+
+    IMU_LOCK;
+    imuIntegrateQuaternion(dt,
+                           DEGREES_TO_RADIANS(gyroRate[X]) + correctionRate[X],
+                           DEGREES_TO_RADIANS(gyroRate[Y]) + correctionRate[Y],
+                           DEGREES_TO_RADIANS(gyroRate[Z]) + correctionRate[Z]);
+    IMU_UNLOCK;
+#endif
+}
+
 float getCosTiltAngle(void)
 {
     return rMat[2][2];
@@ -69,6 +69,7 @@ typedef struct imuConfig_s {
     uint8_t small_angle;
     uint8_t acc_unarmedcal;                 // turn automatic acc compensation on/off
     accDeadband_t accDeadband;
+    uint8_t gyro_rate_integration;          // integrate the gyro in the PID loop, the attitude task only applies the acc/mag correction
 } imuConfig_t;
 
 PG_DECLARE(imuConfig_t, imuConfig);
@@ -79,6 +80,7 @@ typedef struct imuRuntimeConfig_s {
     uint8_t acc_unarmedcal;
     uint8_t small_angle;
     accDeadband_t accDeadband;
+    uint8_t gyro_rate_integration;
 } imuRuntimeConfig_t;
 
 void imuConfigure(uint16_t throttle_correction_angle);
@@ -88,6 +90,10 @@ void imuUpdateAttitude(timeUs_t currentTimeUs);
 int16_t calculateThrottleAngleCorrection(uint8_t throttle_correction_value);
 
 void imuResetAccelerationSum(void);
+bool imuGetEarthAcceleration(float *accEarth);
+void imuGetQuaternion(quaternion *quat);
+void imuGetRotationMatrix(float rotation[3][3]);
+void imuIntegrateGyro(const float *gyroRate, float dt);
 void imuInit(void);
 
 #ifdef SIMULATOR_BUILD
@@ -3,6 +3,7 @@
 #include "flight/ol_control.h"
 #include "flight/ol_filter.h"
 #include "flight/ol_flightplan.h"
+#include "flight/ol_trajectory.h"
 #include "flight/imu.h"
 #include "build/debug.h"
 
@@ -12,12 +13,16 @@ struct dronerace_control_struct dr_control;
 // Settings
 
 
+#define DR_FILTER_GRAVITY  9.81f
+#define CTRL_MAX_LAG    1.0f            // m, the trajectory waits for the drone when it falls further behind
+
+/*
 // Slow speed
-#define DR_FILTER_GRAVITY  9.81
 #define CTRL_MAX_SPEED  2.5             // m/s
 #define CTRL_MAX_PITCH  15.0 / 180.0 * 3.1415926f   // deg
 #define CTRL_MAX_ROLL   10.0 / 180.0 * 3.1415926f  // deg
 #define CTRL_MAX_R      45.0 / 180.0 * 3.1415926f // deg/sec
+*/
 
 /*
 // Max speed for bebop
@@ -27,13 +32,11 @@ struct dronerace_control_struct dr_control;
 #define CTRL_MAX_R      RadOfDeg(45)    // rad/sec
 */
 
-/*
-// Race drone
-#define CTRL_MAX_SPEED  10              // m/s
-#define CTRL_MAX_PITCH  RadOfDeg(45)    // rad
-#define CTRL_MAX_ROLL   RadOfDeg(45)    // rad
-#define CTRL_MAX_R      RadOfDeg(180)   // rad/sec
-*/
+// Race drone, the gate approach speeds of the flightplan set the actual speed
+#define CTRL_MAX_SPEED  10.0f                       // m/s
+#define CTRL_MAX_PITCH  45.0f / 180.0f * 3.1415926f // rad
+#define CTRL_MAX_ROLL   45.0f / 180.0f * 3.1415926f // rad
+#define CTRL_MAX_R      180.0f / 180.0f * 3.1415926f // rad/sec
 
 static inline float ol_DEGREES_TO_RADIANS(float angle)
 {
@@ -55,8 +58,17 @@ void ol_control_reset(void)
   // Reset flight plan logic
   ol_flightplan_reset();
 
+  // Restart the trajectory from the first gate
+  ol_trajectory_reset();
+
   // Reset own variables
   dr_control.psi_ref = 0;
+
+  // Reset outputs, hold the flightplan altitude
+  dr_control.phi_cmd = 0;
+  dr_control.theta_cmd = 0;
+  dr_control.psi_cmd = 0;
+  dr_control.alt_cmd = dr_fp.alt_set;
 }
 
 void ol_control_run(void)
@@ -89,16 +101,26 @@ void ol_control_run(void)
   DEBUG_SET(DEBUG_PSI,1,dr_control.psi_ref/3.14*180);
   DEBUG_SET(DEBUG_PSI,2,dr_fp.psi_set/3.14*180);
   DEBUG_SET(DEBUG_PSI,3,attitude.values.yaw/10);
-  // Position error to Speed
-  vxcmd = (dr_fp.x_set - dr_state.x) * 1.1f - dr_state.vx * 0.0f;
-  vycmd = (dr_fp.y_set - dr_state.y) * 1.1f - dr_state.vy * 0.0f;
+  // Advance along the trajectory, unless the drone lags too far behind its reference
+  float ex = dr_traj.x - dr_state.x;
+  float ey = dr_traj.y - dr_state.y;
+  if (ex * ex + ey * ey < CTRL_MAX_LAG * CTRL_MAX_LAG)
+  {
+    ol_trajectory_sample(dr_traj.time + dt);
+    ex = dr_traj.x - dr_state.x;
+    ey = dr_traj.y - dr_state.y;
+  }
+
+  // Position error to Speed, on top of the trajectory speed
+  vxcmd = dr_traj.vx + ex * 1.1f;
+  vycmd = dr_traj.vy + ey * 1.1f;
 
   vxcmd = ol_constrainf(vxcmd, -CTRL_MAX_SPEED, CTRL_MAX_SPEED);
   vycmd = ol_constrainf(vycmd, -CTRL_MAX_SPEED, CTRL_MAX_SPEED);
 
-  // Speed to Attitude
-  ax = (vxcmd - dr_state.vx) * 1.0f + vxcmd * ol_DEGREES_TO_RADIANS(10.0f) / 3.0f;
-  ay = (vycmd - dr_state.vy) * 1.0f + vycmd * ol_DEGREES_TO_RADIANS(10.0f) / 3.0f;
+  // Speed to Attitude, with drag compensation and the trajectory acceleration as feed-forward
+  ax = (vxcmd - dr_state.vx) * 1.0f + vxcmd * ol_DEGREES_TO_RADIANS(10.0f) / 3.0f + dr_traj.ax / DR_FILTER_GRAVITY;
+  ay = (vycmd - dr_state.vy) * 1.0f + vycmd * ol_DEGREES_TO_RADIANS(10.0f) / 3.0f + dr_traj.ay / DR_FILTER_GRAVITY;
 
   ax = ol_constrainf(ax, -CTRL_MAX_PITCH, CTRL_MAX_PITCH);
   ay = ol_constrainf(ay, -CTRL_MAX_PITCH, CTRL_MAX_PITCH);
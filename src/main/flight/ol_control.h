@@ -1,3 +1,5 @@
+#pragma once
+
 struct dronerace_control_struct
 {
   // States
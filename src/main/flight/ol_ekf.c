@@ -0,0 +1,152 @@
+#include <string.h>
+
+#include "flight/ol_ekf.h"
+
+struct dronerace_ekf_struct dr_ekf = {
+  .acc_noise = 1.0f,
+  .bias_noise = 0.05f,
+};
+
+void ol_ekf_reset(float pos_var, float vel_var, float bias_var)
+{
+  memset(dr_ekf.x, 0, sizeof(dr_ekf.x));
+  memset(dr_ekf.P, 0, sizeof(dr_ekf.P));
+
+  for (int i=0; i<3; i++)
+  {
+    dr_ekf.P[OL_EKF_X + i][OL_EKF_X + i] = pos_var;
+    dr_ekf.P[OL_EKF_VX + i][OL_EKF_VX + i] = vel_var;
+  }
+  dr_ekf.P[OL_EKF_BZ][OL_EKF_BZ] = bias_var;
+
+  dr_ekf.updates = 0;
+  dr_ekf.rejected = 0;
+}
+
+// Restart one axis at the origin and at rest, without touching what was learned about the others
+void ol_ekf_reset_axis(int pos, float pos_var, float vel_var)
+{
+  const int vel = pos + OL_EKF_VX;
+
+  dr_ekf.x[pos] = 0;
+  dr_ekf.x[vel] = 0;
+  for (int i=0; i<OL_EKF_NX; i++)
+  {
+    dr_ekf.P[pos][i] = dr_ekf.P[i][pos] = 0;
+    dr_ekf.P[vel][i] = dr_ekf.P[i][vel] = 0;
+  }
+  dr_ekf.P[pos][pos] = pos_var;
+  dr_ekf.P[vel][vel] = vel_var;
+}
+
+/**
+ * Propagate with the earth frame acceleration acc (m/s^2, gravity removed, z up).
+ *
+ * The transition only couples position to velocity and vertical velocity to the bias, so F P F' is done as
+ * row and column additions instead of matrix products: about 60 multiplications for the 7 states.
+ */
+void ol_ekf_predict(const float *acc, float dt)
+{
+  float (*P)[OL_EKF_NX] = dr_ekf.P;
+  float *x = dr_ekf.x;
+  const float a[3] = { acc[0], acc[1], acc[2] - x[OL_EKF_BZ] };
+  int i, j;
+
+  for (i=0; i<3; i++)
+  {
+    x[OL_EKF_X + i] += (x[OL_EKF_VX + i] + 0.5f * a[i] * dt) * dt;
+    x[OL_EKF_VX + i] += a[i] * dt;
+  }
+
+  // F P: position rows gain dt times the (old) velocity rows, the vertical velocity row loses dt times the bias row
+  for (i=0; i<3; i++)
+  {
+    for (j=0; j<OL_EKF_NX; j++)
+    {
+      P[OL_EKF_X + i][j] += dt * P[OL_EKF_VX + i][j];
+    }
+  }
+  for (j=0; j<OL_EKF_NX; j++)
+  {
+    P[OL_EKF_VZ][j] -= dt * P[OL_EKF_BZ][j];
+  }
+
+  // (F P) F': the same on the columns
+  for (i=0; i<3; i++)
+  {
+    for (j=0; j<OL_EKF_NX; j++)
+    {
+      P[j][OL_EKF_X + i] += dt * P[j][OL_EKF_VX + i];
+    }
+  }
+  for (j=0; j<OL_EKF_NX; j++)
+  {
+    P[j][OL_EKF_VZ] -= dt * P[j][OL_EKF_BZ];
+  }
+
+  // Discrete white noise acceleration, the bias random walk
+  const float q = dr_ekf.acc_noise * dr_ekf.acc_noise * dt * dt;
+  for (i=0; i<3; i++)
+  {
+    P[OL_EKF_X + i][OL_EKF_X + i] += 0.25f * q * dt * dt;
+    P[OL_EKF_X + i][OL_EKF_VX + i] += 0.5f * q * dt;
+    P[OL_EKF_VX + i][OL_EKF_X + i] += 0.5f * q * dt;
+    P[OL_EKF_VX + i][OL_EKF_VX + i] += q;
+  }
+  P[OL_EKF_BZ][OL_EKF_BZ] += dr_ekf.bias_noise * dr_ekf.bias_noise * dt;
+}
+
+/**
+ * Innovation gate of ol_ekf_update() without the update, so that measurements of several states can be accepted or
+ * rejected together.
+ */
+bool ol_ekf_gate(int state, float innovation, float var, float gate)
+{
+  const float S = dr_ekf.P[state][state] + var;
+  return S > 0 && (gate <= 0 || innovation * innovation <= gate * gate * S);
+}
+
+/**
+ * Scalar update of a directly measured state, innovation = measurement - prediction.
+ *
+ * With H a unit vector P H' is a column of P, so the update needs no matrix products or inverse, only one division.
+ * Measurements further than gate standard deviations from the prediction are rejected, gate <= 0 accepts all.
+ */
+bool ol_ekf_update(int state, float innovation, float var, float gate)
+{
+  float (*P)[OL_EKF_NX] = dr_ekf.P;
+  float K[OL_EKF_NX];
+  float PHt[OL_EKF_NX];
+  int i, j;
+
+  const float S = P[state][state] + var;
+  if (S <= 0)
+  {
+    return false;
+  }
+  if (!ol_ekf_gate(state, innovation, var, gate))
+  {
+    dr_ekf.rejected++;
+    return false;
+  }
+
+  for (i=0; i<OL_EKF_NX; i++)
+  {
+    PHt[i] = P[i][state];
+    K[i] = PHt[i] / S;
+    dr_ekf.x[i] += K[i] * innovation;
+  }
+
+  // P -= K H P, symmetric by construction so only the upper triangle is computed
+  for (i=0; i<OL_EKF_NX; i++)
+  {
+    for (j=i; j<OL_EKF_NX; j++)
+    {
+      P[i][j] -= K[i] * PHt[j];
+      P[j][i] = P[i][j];
+    }
+  }
+
+  dr_ekf.updates++;
+  return true;
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Position, velocity and vertical accelerometer bias in the navigation frame (x north, y east, z up)
+#define OL_EKF_X    0   // m
+#define OL_EKF_Y    1
+#define OL_EKF_Z    2
+#define OL_EKF_VX   3   // m/s
+#define OL_EKF_VY   4
+#define OL_EKF_VZ   5
+#define OL_EKF_BZ   6   // m/s^2
+#define OL_EKF_NX   7
+
+struct dronerace_ekf_struct
+{
+  // Settings
+  float acc_noise;    ///< m/s^2, standard deviation of the IMU acceleration
+  float bias_noise;   ///< m/s^2/sqrt(s), random walk of the accelerometer bias
+
+  // States
+  float x[OL_EKF_NX];
+  float P[OL_EKF_NX][OL_EKF_NX];
+
+  // Statistics
+  uint32_t updates;
+  uint32_t rejected;
+};
+
+extern struct dronerace_ekf_struct dr_ekf;
+
+extern void ol_ekf_reset(float pos_var, float vel_var, float bias_var);
+extern void ol_ekf_reset_axis(int pos, float pos_var, float vel_var);
+extern void ol_ekf_predict(const float *acc, float dt);
+extern bool ol_ekf_gate(int state, float innovation, float var, float gate);
+extern bool ol_ekf_update(int state, float innovation, float var, float gate);
@@ -1,107 +1,336 @@
 #include <math.h>
 
-#include "drivers/time.h"
-
 #include "flight/ol_control.h"
+#include "flight/ol_ekf.h"
 #include "flight/ol_flightplan.h"
 #include "flight/ol_filter.h"
+#include "flight/ol_ransac.h"
 #include "flight/imu.h"
 
 #include "build/debug.h"
 
 struct dronerace_state_struct dr_state;
 struct dronerace_vision_struct dr_vision;
-float ol_dt = 0.0005;
+float ol_dt = 0.005;   // fixed outer loop step, set from ol_nav_rate_hz
+
+// Estimated positions of the last OL_FILTER_HISTORY_SIZE steps, newest at ol_history_last
+struct dronerace_history_struct
+{
+  timeUs_t time;
+  float x;
+  float y;
+  float z;
+  float vx;
+  float vy;
+};
+
+static struct dronerace_history_struct ol_history[OL_FILTER_HISTORY_SIZE];
+static int ol_history_last;
+static int ol_history_count;
+
+// From newest (0) to oldest (ol_history_count - 1)
+static int history_index(int element)
+{
+  int ind = ol_history_last - element;
+  if (ind < 0) { ind += OL_FILTER_HISTORY_SIZE; }
+  return ind;
+}
+
+// MEASUREMENT MODEL
+#define DR_FILTER_POS_VAR       0.0001f   // m^2, start of the flightplan is the origin
+#define DR_FILTER_VEL_VAR       0.01f     // (m/s)^2, at rest
+#define DR_FILTER_ALT_VAR       1.0f      // m^2, altitude before the first rangefinder reading
+#define DR_FILTER_BIAS_VAR      0.25f     // (m/s^2)^2
+#define DR_FILTER_RANGE_VAR     0.0025f   // m^2, rangefinder
+#define DR_FILTER_VISION_VAR    0.04f     // m^2, gate detection, horizontal
+#define DR_FILTER_VISION_Z_VAR  0.09f     // m^2, gate detection, vertical
+#define DR_FILTER_GATE          4.0f      // standard deviations, misdetections beyond this are rejected
+#define DR_FILTER_MAX_REJECT    10        // consecutive rejected detections after which the next one is trusted
+
+static float ol_acc[3];       // m/s^2, earth frame IMU acceleration, held while the IMU has no new samples
+static int ol_vision_rejected;
+
+// Newest detection as published, the SITL simulator publishes from its own thread
+static struct dronerace_vision_struct ol_vision_published;
+static uint32_t ol_vision_seq;  // odd while ol_vision_published is being written
+
+static void history_reset(void)
+{
+  ol_history_last = 0;
+  ol_history_count = 0;
+}
 
 void ol_filter_reset()
 {
   // Time
   dr_state.time = 0;
 
-  // Position
-  dr_state.x = 0;
-  dr_state.y = 0;
-
-  // Speed
-  dr_state.vx = 0;
-  dr_state.vy = 0;
+  ol_ekf_reset(DR_FILTER_POS_VAR, DR_FILTER_VEL_VAR, DR_FILTER_BIAS_VAR);
+  dr_ekf.P[OL_EKF_Z][OL_EKF_Z] = DR_FILTER_ALT_VAR;
+  ol_acc[0] = ol_acc[1] = ol_acc[2] = 0;
 
   // Heading
   dr_state.psi = 0;
 
   // Vision latency
-//   fifo_reset();
-//   ransac_reset();
+  history_reset();
+  ol_vision_rejected = 0;
+  ransac_reset();
 }
 
-// PREDICTION MODEL
-#define DR_FILTER_GRAVITY  9.81
-#define DR_FILTER_DRAG  0.5
-#define DR_FILTER_THRUSTCORR  0.8
+// Back to the start of the flightplan, altitude and accelerometer bias keep being estimated
+void ol_filter_reset_position(void)
+{
+  dr_state.time = 0;
+
+  ol_ekf_reset_axis(OL_EKF_X, DR_FILTER_POS_VAR, DR_FILTER_VEL_VAR);
+  ol_ekf_reset_axis(OL_EKF_Y, DR_FILTER_POS_VAR, DR_FILTER_VEL_VAR);
+
+  history_reset();
+  ol_vision_rejected = 0;
+  ransac_reset();
+}
+
+static void state_from_ekf(void)
+{
+  dr_state.x = dr_ekf.x[OL_EKF_X];
+  dr_state.y = dr_ekf.x[OL_EKF_Y];
+  dr_state.z = dr_ekf.x[OL_EKF_Z];
+  dr_state.vx = dr_ekf.x[OL_EKF_VX];
+  dr_state.vy = dr_ekf.x[OL_EKF_VY];
+  dr_state.vz = dr_ekf.x[OL_EKF_VZ];
+}
 
-void ol_filter_predict(void)
+void ol_filter_predict(timeUs_t currentTimeUs)
 {
-  ////////////////////////////////////////////////////////////////////////
-  // Read attitude
-  float theta = -DECIDEGREES_TO_RADIANS(attitude.values.pitch);
-  float phi = DECIDEGREES_TO_RADIANS(attitude.values.roll);
-  float psi = DECIDEGREES_TO_RADIANS(attitude.values.yaw);
-
-  timeUs_t currentTimeUs = micros();
-  static timeUs_t previousTimeUs;
-  const timeDelta_t deltaT = currentTimeUs - previousTimeUs;
-  ol_dt = deltaT * 1e-6f;
-  previousTimeUs = currentTimeUs;
-
-  // Body accelerations
-  float abx =  sinf(-theta) * DR_FILTER_GRAVITY / cosf(theta * DR_FILTER_THRUSTCORR) / cosf(phi * DR_FILTER_THRUSTCORR);
-  float aby =  sinf( phi)   * DR_FILTER_GRAVITY / cosf(theta * DR_FILTER_THRUSTCORR) / cosf(phi * DR_FILTER_THRUSTCORR);
-  
-  // Earth accelerations
-  float ax =  cosf(psi) * abx - sinf(psi) * aby - dr_state.vx * DR_FILTER_DRAG ;
-  float ay =  sinf(psi) * abx + cosf(psi) * aby - dr_state.vy * DR_FILTER_DRAG;
-
-
-  // Velocity and Position
-  dr_state.vx += ax * ol_dt;
-  dr_state.vy += ay * ol_dt;
-  dr_state.x += dr_state.vx * ol_dt;
-  dr_state.y += dr_state.vy * ol_dt;
+  // Measured acceleration replaces the attitude and drag model, the IMU runs slower than the outer loop
+  imuGetEarthAcceleration(ol_acc);
+  ol_ekf_predict(ol_acc, ol_dt);
+  state_from_ekf();
+
   DEBUG_SET(DEBUG_OL,0, 100 * dr_state.x);
   DEBUG_SET(DEBUG_OL,1, 100 * dr_state.y);
   DEBUG_SET(DEBUG_OL,2, 100 * dr_state.vx);
   DEBUG_SET(DEBUG_OL,3, 100 * dr_state.vy);
   DEBUG_SET(DEBUG_FP,0, 100 * dr_state.x);
   DEBUG_SET(DEBUG_FP,1, 100 * dr_state.y);
-  DEBUG_SET(DEBUG_FP,2, dr_control.theta_cmd/3.14*180);
-  DEBUG_SET(DEBUG_FP,3, dr_control.phi_cmd/3.14*180);
+  DEBUG_SET(DEBUG_FP,2, dr_control.theta_cmd/3.14f*180);
+  DEBUG_SET(DEBUG_FP,3, dr_control.phi_cmd/3.14f*180);
 
   // Time
   dr_state.time += ol_dt;
 
-  // Store psi for local corrections
-  dr_state.psi = psi;
+  // Store psi for local corrections, from the rotation matrix so it is as recent as the attitude and not rounded to decidegrees
+  float rotation[3][3];
+  imuGetRotationMatrix(rotation);
+  dr_state.psi = -atan2_approx(rotation[1][0], rotation[0][0]);
+  if (dr_state.psi < 0)
+  {
+    dr_state.psi += 2 * M_PIf;
+  }
 
   // Store old states for latency compensation
-//   fifo_push(dr_state.x, dr_state.y, 0);
+  ol_history_last++;
+  if (ol_history_last >= OL_FILTER_HISTORY_SIZE)
+  {
+    ol_history_last = 0;
+  }
+  if (ol_history_count < OL_FILTER_HISTORY_SIZE)
+  {
+    ol_history_count++;
+  }
+  struct dronerace_history_struct *h = &ol_history[ol_history_last];
+  h->time = currentTimeUs;
+  h->x = dr_state.x;
+  h->y = dr_state.y;
+  h->z = dr_state.z;
+  h->vx = dr_state.vx;
+  h->vy = dr_state.vy;
 
-  // Check if Ransac buffer is empty
+  // Spend this step's budget on the drift fit over the recent detections
   ransac_update_buffer_size();
+  ransac_step();
 }
 
-void ol_filter_correct(void)
+// Find the history entries around time. Returns the element of the first entry at or after time,
+// and the interpolation fraction towards the entry before it. -1 if time is older than the history.
+static int history_find(timeUs_t time, float *frac)
 {
-  // Retrieve oldest element of state buffer (that corresponds to current vision measurement)
-  float sx, sy, sz;
-  float mx, my;
+  *frac = 0;
+  if (ol_history_count == 0)
+  {
+    return -1;
+  }
+
+  // Newer than the newest prediction, use the current state
+  if (cmpTimeUs(time, ol_history[history_index(0)].time) >= 0)
+  {
+    return 0;
+  }
 
-//   fifo_pop(&sx, &sy, &sz);
+  for (int i = 1; i < ol_history_count; i++)
+  {
+    const struct dronerace_history_struct *older = &ol_history[history_index(i)];
+    if (cmpTimeUs(time, older->time) >= 0)
+    {
+      const struct dronerace_history_struct *newer = &ol_history[history_index(i - 1)];
+      const timeDelta_t span = cmpTimeUs(newer->time, older->time);
+      if (span > 0)
+      {
+        *frac = (float)cmpTimeUs(newer->time, time) / span;
+      }
+      return i - 1;
+    }
+  }
 
-  // Compute current absolute position
-  // TODO: check: this is probably wrong!
-  mx = dr_fp.gate_x - dr_vision.dx;
-  my = dr_fp.gate_y - dr_vision.dy;
+  return -1;
+}
 
-  // Push to RANSAC
-//   ransac_push(dr_state.time, dr_state.x, dr_state.y, mx, my);
-}
\ No newline at end of file
+bool ol_filter_get_past_state(timeUs_t time, struct dronerace_state_struct *past)
+{
+  float frac;
+  const int element = history_find(time, &frac);
+  if (element < 0)
+  {
+    return false;
+  }
+
+  const struct dronerace_history_struct *n = &ol_history[history_index(element)];
+  const struct dronerace_history_struct *o = (frac > 0) ? &ol_history[history_index(element + 1)] : n;
+
+  past->x = n->x + (o->x - n->x) * frac;
+  past->y = n->y + (o->y - n->y) * frac;
+  past->z = n->z + (o->z - n->z) * frac;
+  past->vx = n->vx + (o->vx - n->vx) * frac;
+  past->vy = n->vy + (o->vy - n->vy) * frac;
+  past->vz = dr_state.vz;
+  past->psi = dr_state.psi;
+  past->time = dr_state.time - cmpTimeUs(ol_history[history_index(0)].time, time) * 1e-6f;
+  return true;
+}
+
+// Apply the innovation of a delayed measurement to the current estimate and shift the history by the correction
+static void history_shift(float dx, float dy, float dz)
+{
+  for (int i = 0; i < ol_history_count; i++)
+  {
+    struct dronerace_history_struct *h = &ol_history[history_index(i)];
+    h->x += dx;
+    h->y += dy;
+    h->z += dz;
+  }
+}
+
+// Publish a gate detection, there is a single writer at a time
+void ol_filter_push_vision(float dx, float dy, float dz, timeUs_t time)
+{
+  const uint32_t seq = __atomic_load_n(&ol_vision_seq, __ATOMIC_RELAXED);
+  __atomic_store_n(&ol_vision_seq, seq + 1, __ATOMIC_RELAXED);
+  __atomic_thread_fence(__ATOMIC_RELEASE);
+
+  ol_vision_published.dx = dx;
+  ol_vision_published.dy = dy;
+  ol_vision_published.dz = dz;
+  ol_vision_published.time = time;
+  ol_vision_published.cnt++;
+
+  __atomic_store_n(&ol_vision_seq, seq + 2, __ATOMIC_RELEASE);
+}
+
+// Copy the newest published detection to dr_vision, again if it was being written meanwhile
+void ol_filter_fetch_vision(void)
+{
+  struct dronerace_vision_struct vision;
+  uint32_t seq;
+  do
+  {
+    seq = __atomic_load_n(&ol_vision_seq, __ATOMIC_ACQUIRE);
+    vision = ol_vision_published;
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+  } while ((seq & 1) || seq != __atomic_load_n(&ol_vision_seq, __ATOMIC_RELAXED));
+
+  dr_vision = vision;
+}
+
+bool ol_filter_correct(void)
+{
+  // Retrieve the estimated state at the capture time of the vision measurement
+  struct dronerace_state_struct past;
+
+  if (!ol_filter_get_past_state(dr_vision.time, &past))
+  {
+    // Measurement older than the state history, drop it
+    return false;
+  }
+
+  // Compute absolute position at capture time
+  const float mx = dr_fp.gate_x - dr_vision.dx;
+  const float my = dr_fp.gate_y - dr_vision.dy;
+  const float mz = dr_fp.gate_alt * 0.01f - dr_vision.dz;
+
+  float ex = mx - past.x;
+  float ey = my - past.y;
+
+  // RANSAC fits the drift (predicted - measured) over the recent detections in budgeted steps from ol_filter_predict()
+  ransac_push(past.time, past.x, past.y, mx, my, dr_vision.time);
+
+  float drift_x, drift_y;
+  const bool fitted = ransac_drift(past.time, &drift_x, &drift_y);
+
+  // After a run of rejections the estimate is more likely wrong than the detections, take the fitted drift
+  // or, without a fit, the next detection as it is
+  float gate = DR_FILTER_GATE;
+  if (ol_vision_rejected >= DR_FILTER_MAX_REJECT)
+  {
+    gate = 0;
+    if (fitted)
+    {
+      ex = -drift_x;
+      ey = -drift_y;
+    }
+  }
+
+  // Both horizontal axes or neither, a detection that is off on one axis is a misdetection. So is one
+  // off the drift line of the recent detections, even if the estimate has drifted as far.
+  const float x0 = dr_ekf.x[OL_EKF_X], y0 = dr_ekf.x[OL_EKF_Y], z0 = dr_ekf.x[OL_EKF_Z];
+  const bool inlier = !fitted || gate == 0 || (fabsf(mx - past.x + drift_x) < RANSAC_ERROR_THRESHOLD
+      && fabsf(my - past.y + drift_y) < RANSAC_ERROR_THRESHOLD);
+  const bool accepted = inlier && ol_ekf_gate(OL_EKF_X, ex, DR_FILTER_VISION_VAR, gate)
+      && ol_ekf_gate(OL_EKF_Y, ey, DR_FILTER_VISION_VAR, gate);
+  if (accepted)
+  {
+    ol_ekf_update(OL_EKF_X, ex, DR_FILTER_VISION_VAR, 0);
+    ol_ekf_update(OL_EKF_Y, ey, DR_FILTER_VISION_VAR, 0);
+    ol_ekf_update(OL_EKF_Z, mz - past.z, DR_FILTER_VISION_Z_VAR, gate);
+    ol_vision_rejected = 0;
+  }
+  else
+  {
+    dr_ekf.rejected++;
+    ol_vision_rejected++;
+  }
+
+  const float dx = dr_ekf.x[OL_EKF_X] - x0;
+  const float dy = dr_ekf.x[OL_EKF_Y] - y0;
+  history_shift(dx, dy, dr_ekf.x[OL_EKF_Z] - z0);
+  // The stored predictions are corrected as well, the drift fit keeps estimating what the EKF has not removed
+  ransac_shift(-dx, -dy, 0, 0, 0);
+  state_from_ekf();
+
+  return accepted;
+}
+
+// Tilt compensated rangefinder altitude in m, negligible latency so it is applied at the current time.
+// Not gated: the rangefinder is the only absolute altitude reference while no gate is in view.
+bool ol_filter_correct_altitude(float altitude)
+{
+  const float z0 = dr_ekf.x[OL_EKF_Z];
+  if (!ol_ekf_update(OL_EKF_Z, altitude - z0, DR_FILTER_RANGE_VAR, 0))
+  {
+    return false;
+  }
+
+  history_shift(0, 0, dr_ekf.x[OL_EKF_Z] - z0);
+  state_from_ekf();
+  return true;
+}
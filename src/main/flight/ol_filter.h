@@ -1,12 +1,21 @@
+#pragma once
+
+#include <stdbool.h>
+
+#include "common/time.h"
+
+#include "flight/ol_navigation.h"
+
 struct dronerace_vision_struct
 {
   int cnt;
   float dx;
   float dy;
   float dz;
+  timeUs_t time;    ///< capture time of the detection
 };
 
-// store for logging purposes
+// newest detection, copied from the one published with ol_filter_push_vision() by the navigation task
 extern struct dronerace_vision_struct dr_vision;
 
 struct dronerace_state_struct
@@ -17,10 +26,12 @@ struct dronerace_state_struct
   // Positon
   float x;
   float y;
+  float z;          ///< m above the takeoff point
 
   // Speed
   float vx;
   float vy;
+  float vz;
 
   // Heading
   float psi;
@@ -30,6 +41,15 @@ extern struct dronerace_state_struct dr_state;
 extern float ol_dt;
 
 extern void ol_filter_reset(void);
-
-extern void ol_filter_predict(void);
-extern void ol_filter_correct(void);
+extern void ol_filter_reset_position(void);
+
+// Number of predicted states kept for latency compensation, covers the maximum camera latency at the maximum outer
+// loop rate plus a few steps for the time a detection waits to be applied
+#define OL_FILTER_HISTORY_SIZE  (OL_VISION_LATENCY_MAX_MS * OL_NAVIGATION_RATE_MAX_HZ / 1000 + 4)
+
+extern void ol_filter_predict(timeUs_t currentTimeUs);
+extern bool ol_filter_correct(void);
+extern void ol_filter_push_vision(float dx, float dy, float dz, timeUs_t time);
+extern void ol_filter_fetch_vision(void);
+extern bool ol_filter_correct_altitude(float altitude);
+extern bool ol_filter_get_past_state(timeUs_t time, struct dronerace_state_struct *past);
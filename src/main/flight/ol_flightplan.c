@@ -1,40 +1,155 @@
 #include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "platform.h"
+
+#include "common/maths.h"
+#include "common/utils.h"
+
+#include "config/config_reset.h"
+#include "pg/pg.h"
+#include "pg/pg_ids.h"
 
 #include "flight/ol_flightplan.h"
 #include "flight/ol_filter.h"
+#include "flight/ol_trajectory.h"
 
 struct dronerace_fp_struct dr_fp;
 
+PG_REGISTER_ARRAY_WITH_RESET_FN(olGate_t, OL_FLIGHTPLAN_MAX_GATES, olGates, PG_OL_FLIGHTPLAN, 0);
+
+// X, Y, ALT, PSI, SPEED, PASS
+void pgResetFn_olGates(olGate_t *instance)
+{
+  const olGate_t defaultGates[] = {
+    { 400,    0, 150,  0, 250, 50 }, //cm, cm, cm, deg, cm/s, cm
+    { 400, -200, 150, 90, 250, 50 },
+    {   0, -200, 150,  0, 250, 50 },
+    {   0,    0, 150,  0, 250, 50 },
+  };
+
+  for (unsigned i = 0; i < ARRAYLEN(defaultGates); i++) {
+    instance[i] = defaultGates[i];
+  }
+}
+
+// Gate and the segment leading to it, precomputed at load so ol_flightplan_run() needs no sqrt/trig
 struct dronerace_flightplan_item_struct
 {
-	float x;
-	float y;
-	float alt;
-	float psi;
+  float x;          // m
+  float y;          // m
+  float alt;        // cm
+  float psi;        // rad
+  float speed;      // m/s
+  float pass_dist;  // m
+
+  // Segment from the previous gate (or the start) to this gate
+  float dir_x;      // unit direction
+  float dir_y;
+  float length;     // m
+  float dpsi;       // rad, shortest heading change to the next gate
 };
 
-// X, Y, ALT, PSI
-/*
-#define MAX_GATES 1
-const struct dronerace_flightplan_item_struct gates[MAX_GATES] = {
-    {0.0, 0.0, 1.5, RadOfDeg(0)},
-};
-*/
-
-#define MAX_GATES 4
-const struct dronerace_flightplan_item_struct gates[MAX_GATES] = {
-    {4.0, 0.0, 150, 0}, //m, m, cm, rad
-    {4.0, -2.0, 150, 90 * 0.0174532925f},
-    {0.0, -2.0, 150, 0},
-    {0.0, 0.0, 150, 0},
-};
+static struct dronerace_flightplan_item_struct gates[OL_FLIGHTPLAN_MAX_GATES];
+static int gate_count;
+
+static float wrap_pi(float angle)
+{
+  while (angle > M_PIf) {
+    angle -= 2 * M_PIf;
+  }
+  while (angle < -M_PIf) {
+    angle += 2 * M_PIf;
+  }
+  return angle;
+}
+
+void ol_flightplan_load(void)
+{
+  float prev_x = 0;
+  float prev_y = 0;
+
+  gate_count = 0;
+  for (int i = 0; i < OL_FLIGHTPLAN_MAX_GATES; i++)
+  {
+    const olGate_t *g = olGates(i);
+    if (g->speed == 0)
+    {
+      break;
+    }
+
+    struct dronerace_flightplan_item_struct *gate = &gates[gate_count];
+    gate->x = g->x * 0.01f;
+    gate->y = g->y * 0.01f;
+    gate->alt = g->alt;
+    gate->psi = g->psi * 0.0174532925f;
+    gate->speed = g->speed * 0.01f;
+    gate->pass_dist = g->pass_dist * 0.01f;
+
+    const float dx = gate->x - prev_x;
+    const float dy = gate->y - prev_y;
+    gate->length = sqrtf(dx * dx + dy * dy);
+    if (gate->length > 0.01f)
+    {
+      gate->dir_x = dx / gate->length;
+      gate->dir_y = dy / gate->length;
+    }
+    else
+    {
+      gate->dir_x = 0;
+      gate->dir_y = 0;
+    }
+    gate->dpsi = 0;
+    if (gate_count > 0)
+    {
+      gates[gate_count - 1].dpsi = wrap_pi(gate->psi - gates[gate_count - 1].psi);
+    }
+
+    prev_x = gate->x;
+    prev_y = gate->y;
+    gate_count++;
+  }
+
+  if (dr_fp.gate_nr >= gate_count)
+  {
+    dr_fp.gate_nr = (gate_count > 0) ? (gate_count - 1) : 0;
+  }
+
+  // Smooth path through all gates, sampled by ol_control
+  float x[OL_FLIGHTPLAN_MAX_GATES], y[OL_FLIGHTPLAN_MAX_GATES], speed[OL_FLIGHTPLAN_MAX_GATES];
+  for (int i = 0; i < gate_count; i++)
+  {
+    x[i] = gates[i].x;
+    y[i] = gates[i].y;
+    speed[i] = gates[i].speed;
+  }
+  ol_trajectory_build(x, y, speed, gate_count);
+}
+
+int ol_flightplan_gate_count(void)
+{
+  return gate_count;
+}
 
 static void update_gate_setpoints(void)
 {
+  if (gate_count == 0)
+  {
+    // No flightplan, hold the start position
+    dr_fp.gate_x   = 0;
+    dr_fp.gate_y   = 0;
+    dr_fp.gate_alt = 150;
+    dr_fp.gate_psi = 0;
+    dr_fp.speed_set = 0;
+    return;
+  }
+
   dr_fp.gate_x   = gates[dr_fp.gate_nr].x;
   dr_fp.gate_y   = gates[dr_fp.gate_nr].y;
   dr_fp.gate_alt = gates[dr_fp.gate_nr].alt;
   dr_fp.gate_psi = gates[dr_fp.gate_nr].psi;
+  dr_fp.speed_set = gates[dr_fp.gate_nr].speed;
 }
 
 void ol_flightplan_reset()
@@ -51,7 +166,6 @@ void ol_flightplan_reset()
 }
 
 #define DISTANCE_GATE_NOT_IN_SIGHT	1.4f
-#define DISTANCE_ARRIVED_AT_WP		0.5f
 
 void ol_flightplan_run(void)
 {
@@ -64,29 +178,39 @@ void ol_flightplan_run(void)
   dr_fp.y_set = dr_fp.gate_y;
   dr_fp.alt_set = dr_fp.gate_alt;
 
+  // Align with current gate
+  dr_fp.psi_set = dr_fp.gate_psi;
+
+  if (gate_count == 0)
+  {
+    return;
+  }
+
+  const struct dronerace_flightplan_item_struct *gate = &gates[dr_fp.gate_nr];
+
   // Estimate distance to the gate
   dist = (dr_fp.gate_x - dr_state.x)*(dr_fp.gate_x - dr_state.x) + (dr_fp.gate_y - dr_state.y)*(dr_fp.gate_y - dr_state.y);
 
-  // Align with current gate
-  dr_fp.psi_set = dr_fp.gate_psi;
+  // Distance left along the segment, negative once the gate plane has been crossed
+  const float remaining = (dr_fp.gate_x - dr_state.x) * gate->dir_x + (dr_fp.gate_y - dr_state.y) * gate->dir_y;
 
   // If too close to the gate to see the gate, heading to next gate
   if (dist < DISTANCE_GATE_NOT_IN_SIGHT * DISTANCE_GATE_NOT_IN_SIGHT)
   {
-    if ((dr_fp.gate_nr+1) < MAX_GATES)
+    if ((dr_fp.gate_nr+1) < gate_count)
     {
-      dr_fp.psi_set = gates[dr_fp.gate_nr+1].psi;
+      dr_fp.psi_set = gate->psi + gate->dpsi;
     }
   }
 
-  // If close to desired position, switch to next
-  if (dist < DISTANCE_ARRIVED_AT_WP * DISTANCE_ARRIVED_AT_WP)
+  // If close to desired position or flown through the gate, switch to next
+  if ((dist < gate->pass_dist * gate->pass_dist) || (gate->length > 0.01f && remaining < 0 && dist < DISTANCE_GATE_NOT_IN_SIGHT * DISTANCE_GATE_NOT_IN_SIGHT))
   {
     dr_fp.gate_nr ++;
-    if (dr_fp.gate_nr >= MAX_GATES)
+    if (dr_fp.gate_nr >= gate_count)
     {
-      dr_fp.gate_nr = (MAX_GATES -1);
+      dr_fp.gate_nr = (gate_count -1);
     }
   }
 
-}
\ No newline at end of file
+}
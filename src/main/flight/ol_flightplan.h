@@ -1,3 +1,25 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "pg/pg.h"
+
+#define OL_FLIGHTPLAN_MAX_GATES 10
+#define OL_FLIGHTPLAN_MAX_SPEED 1000      // cm/s
+#define OL_FLIGHTPLAN_MAX_PASS_DIST 500   // cm
+
+// Gate as stored in the flightplan parameter group, a gate with speed 0 ends the flightplan
+typedef struct olGate_s {
+  int16_t x;            // cm
+  int16_t y;            // cm
+  int16_t alt;          // cm
+  int16_t psi;          // deg
+  uint16_t speed;       // approach speed, cm/s
+  uint16_t pass_dist;   // cm, gate counts as passed within this distance
+} olGate_t;
+
+PG_DECLARE_ARRAY(olGate_t, OL_FLIGHTPLAN_MAX_GATES, olGates);
+
 struct dronerace_fp_struct
 {
   // Current Gate Position
@@ -12,11 +34,14 @@ struct dronerace_fp_struct
   float y_set;
   float psi_set;
   float alt_set;
+  float speed_set;
 };
 
 // Variables
 extern struct dronerace_fp_struct dr_fp;
 
 // Functions
+extern void ol_flightplan_load(void);
+extern int ol_flightplan_gate_count(void);
 extern void ol_flightplan_reset(void);
-extern void ol_flightplan_run(void);
\ No newline at end of file
+extern void ol_flightplan_run(void);
@@ -0,0 +1,107 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "platform.h"
+
+#include "common/maths.h"
+
+#include "pg/pg.h"
+#include "pg/pg_ids.h"
+
+#include "fc/runtime_config.h"
+
+#include "flight/ol_control.h"
+#include "flight/ol_filter.h"
+#include "flight/ol_flightplan.h"
+#include "flight/ol_navigation.h"
+
+#include "telemetry/mavlink_rx.h"
+
+PG_REGISTER_WITH_RESET_TEMPLATE(olNavigationConfig_t, olNavigationConfig, PG_OL_NAVIGATION_CONFIG, 1);
+
+PG_RESET_TEMPLATE(olNavigationConfig_t, olNavigationConfig,
+    .nav_rate_hz = 200,
+    .vision_latency_ms = 40,
+);
+
+// Double buffered setpoints: the task fills the back buffer and flips the index once it is complete,
+// so readers in the PID loop never observe a half written setpoint.
+static olSetpoint_t olSetpoint[2];
+static volatile uint8_t olSetpointIndex = 0;
+
+static int lastVisionCnt;
+
+static void publishSetpoint(timeUs_t currentTimeUs)
+{
+    const uint8_t backIndex = olSetpointIndex ^ 1;
+    olSetpoint_t *sp = &olSetpoint[backIndex];
+
+    sp->phi_cmd = dr_control.phi_cmd;
+    sp->theta_cmd = dr_control.theta_cmd;
+    sp->psi_cmd = dr_control.psi_cmd;
+    sp->alt_cmd = dr_control.alt_cmd;
+    sp->updatedAt = currentTimeUs;
+
+    olSetpointIndex = backIndex;
+}
+
+void ol_navigation_init(void)
+{
+    const uint16_t rateHz = constrain(olNavigationConfig()->nav_rate_hz, OL_NAVIGATION_RATE_MIN_HZ, OL_NAVIGATION_RATE_MAX_HZ);
+
+    // The outer loop integrates with a fixed step, scheduler jitter is not fed into the estimator
+    ol_dt = 1.0f / rateHz;
+
+    ol_flightplan_load();
+    ol_filter_reset();
+    ol_control_reset();
+    publishSetpoint(0);
+}
+
+void ol_navigation_update(timeUs_t currentTimeUs)
+{
+#if defined(USE_TELEMETRY) && defined(USE_TELEMETRY_MAVLINK)
+    // Setpoints and gate detections queued by the MAVLink RX callback
+    mavlinkRxProcess(currentTimeUs);
+#endif
+    ol_filter_fetch_vision();
+
+    // Altitude is estimated in every mode, the altitude hold and the gate controller share the state
+    ol_filter_predict(currentTimeUs);
+
+    if (FLIGHT_MODE(RANGEFINDER_MODE)) {
+        if (dr_vision.cnt != lastVisionCnt) {
+            lastVisionCnt = dr_vision.cnt;
+            ol_filter_correct();
+        }
+        ol_control_run();
+    } else {
+        ol_filter_reset_position();
+        ol_control_reset();
+        lastVisionCnt = dr_vision.cnt;
+    }
+
+    publishSetpoint(currentTimeUs);
+}
+
+const olSetpoint_t *ol_navigation_get_setpoint(void)
+{
+    return &olSetpoint[olSetpointIndex];
+}
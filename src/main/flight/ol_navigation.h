@@ -0,0 +1,46 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "common/time.h"
+
+#include "pg/pg.h"
+
+#define OL_NAVIGATION_RATE_MIN_HZ   100
+#define OL_NAVIGATION_RATE_MAX_HZ   500
+#define OL_VISION_LATENCY_MAX_MS    200
+
+typedef struct olNavigationConfig_s {
+    uint16_t nav_rate_hz;       // outer loop (filter, flightplan, control) rate in Hz
+    uint8_t vision_latency_ms;  // age of a gate detection when it arrives over MAVLink
+} olNavigationConfig_t;
+
+PG_DECLARE(olNavigationConfig_t, olNavigationConfig);
+
+// Setpoints produced by the outer loop, consumed read-only by pidLevel() and the altitude controller
+typedef struct olSetpoint_s {
+    float phi_cmd;              // rad
+    float theta_cmd;            // rad
+    float psi_cmd;              // rad
+    float alt_cmd;              // cm
+    timeUs_t updatedAt;
+} olSetpoint_t;
+
+void ol_navigation_init(void);
+void ol_navigation_update(timeUs_t currentTimeUs);
+const olSetpoint_t *ol_navigation_get_setpoint(void);
@@ -1,13 +1,15 @@
+#include <stdint.h>
+#include <float.h>
+
 #include "flight/ol_ransac.h"
 #include "flight/ol_filter.h"
 
-#define  RANSAC_BUF_SIZE   20
-
 // Time, x_predict, y, x_measured, y
 struct dronerace_ransac_buf_struct
 {
   // Settings
   float time;
+  timeUs_t time_us;
 
   // Predicted States
   float x;
@@ -22,18 +24,61 @@ struct dronerace_ransac_buf_struct ransac_buf[RANSAC_BUF_SIZE];
 
 struct dronerace_ransac_struct dr_ransac;
 
+// Snapshot of the buffer the running fit works on, so new detections do not change the data mid-fit
+static float fit_t[RANSAC_BUF_SIZE];
+static float fit_x[RANSAC_BUF_SIZE];
+static float fit_y[RANSAC_BUF_SIZE];
+static uint8_t fit_idx[RANSAC_BUF_SIZE];
+static int fit_count;
+static int fit_n_samples;
+static float fit_start_time;
+static timeUs_t fit_start_time_us;
+
+// Best hypothesis so far
+static float best_err_x, best_err_y;
+static float best_x[2], best_y[2];
+
+static uint32_t ransac_seed;
+
+// xorshift32, cheap and deterministic
+static uint32_t ransac_rand(void)
+{
+  ransac_seed ^= ransac_seed << 13;
+  ransac_seed ^= ransac_seed >> 17;
+  ransac_seed ^= ransac_seed << 5;
+  return ransac_seed;
+}
 
 void ransac_reset(void)
 {
   int i;
   for (i=0; i<RANSAC_BUF_SIZE; i++) {
     ransac_buf[i].time = 0;
+    ransac_buf[i].time_us = 0;
     ransac_buf[i].x = 0;
     ransac_buf[i].y = 0;
     ransac_buf[i].mx = 0;
     ransac_buf[i].my = 0;
   }
   dr_ransac.dt_max = 1.0;
+  dr_ransac.buf_index_of_last = 0;
+  dr_ransac.buf_size = 0;
+
+  dr_ransac.iteration = 0;
+  dr_ransac.busy = false;
+  dr_ransac.pending = false;
+
+  dr_ransac.corr_x = 0;
+  dr_ransac.corr_y = 0;
+  dr_ransac.rate_x = 0;
+  dr_ransac.rate_y = 0;
+  dr_ransac.fit_time = 0;
+  dr_ransac.fit_time_us = 0;
+  dr_ransac.fit_cnt = 0;
+  fit_start_time = 0;
+  fit_start_time_us = 0;
+
+  ransac_seed = 2463534242u;
 }
 
 // From newest (0) to oldest (RANSAC_BUF_SIZE)
@@ -61,11 +106,113 @@ void ransac_update_buffer_size(void)
   }
 }
 
-void ransac_push(float time, float x, float y, float mx, float my)
+// Least squares fit of v = p[0] + p[1] * t over the samples listed in idx
+static void fit_line(const float *v, const uint8_t *idx, int n, float *p)
+{
+  float st = 0, sv = 0, stt = 0, stv = 0;
+  int i;
+
+  for (i=0; i<n; i++)
+  {
+    const float t = fit_t[idx[i]];
+    st += t;
+    sv += v[idx[i]];
+    stt += t * t;
+    stv += t * v[idx[i]];
+  }
+
+  const float det = n * stt - st * st;
+  if (det > FLT_EPSILON || det < -FLT_EPSILON)
+  {
+    p[1] = (n * stv - st * sv) / det;
+  }
+  else
+  {
+    // All samples at the same time, only the bias is observable
+    p[1] = 0;
+  }
+  p[0] = (sv - p[1] * st) / n;
+}
+
+// Sum of squared residuals, each capped at the error threshold
+static float fit_error(const float *v, const float *p)
 {
-  int i = 0;
-  static int ransac_cnt = 0;
+  const float cap = RANSAC_ERROR_THRESHOLD * RANSAC_ERROR_THRESHOLD;
+  float err = 0;
+  int i;
+
+  for (i=0; i<fit_count; i++)
+  {
+    const float e = v[i] - (p[0] + p[1] * fit_t[i]);
+    const float e2 = e * e;
+    err += (e2 < cap) ? e2 : cap;
+  }
+  return err;
+}
+
+// Refit on the inliers of the best hypothesis
+static void fit_inliers(const float *v, float *p)
+{
+  int n = 0;
+  int i;
+
+  for (i=0; i<fit_count; i++)
+  {
+    const float e = v[i] - (p[0] + p[1] * fit_t[i]);
+    if (e < RANSAC_ERROR_THRESHOLD && e > -RANSAC_ERROR_THRESHOLD)
+    {
+      fit_idx[n++] = i;
+    }
+  }
+
+  if (n >= 2)
+  {
+    fit_line(v, fit_idx, n, p);
+  }
+}
+
+static void start_fit(void)
+{
+  int i;
+
+  ransac_update_buffer_size();
+
+  // If sufficient items in buffer
+  if (dr_ransac.buf_size <= 4)
+  {
+    return;
+  }
+
+  const struct dronerace_ransac_buf_struct *newest = &ransac_buf[get_index(0)];
+
+  fit_count = dr_ransac.buf_size;
+  fit_n_samples = (int)(fit_count * 0.4f);
+  if (fit_n_samples < 2)
+  {
+    fit_n_samples = 2;
+  }
+
+  for (i=0; i<fit_count; i++)
+  {
+    const struct dronerace_ransac_buf_struct* r = &ransac_buf[get_index(i)];
+    fit_x[i] = r->x - r->mx;
+    fit_y[i] = r->y - r->my;
+    fit_t[i] = r->time - newest->time;
+    fit_idx[i] = i;
+  }
+
+  // dr_ransac keeps the previous fit until this one completes
+  fit_start_time = newest->time;
+  fit_start_time_us = newest->time_us;
+
+  best_err_x = FLT_MAX;
+  best_err_y = FLT_MAX;
+  dr_ransac.iteration = 0;
+  dr_ransac.busy = true;
+}
 
+void ransac_push(float time, float x, float y, float mx, float my, timeUs_t time_us)
+{
   // Insert in the buffer
   dr_ransac.buf_index_of_last++;
   if (dr_ransac.buf_index_of_last >= RANSAC_BUF_SIZE)
@@ -73,99 +220,152 @@ void ransac_push(float time, float x, float y, float mx, float my)
     dr_ransac.buf_index_of_last = 0;
   }
   ransac_buf[dr_ransac.buf_index_of_last].time = time;
+  ransac_buf[dr_ransac.buf_index_of_last].time_us = time_us;
   ransac_buf[dr_ransac.buf_index_of_last].x = x;
   ransac_buf[dr_ransac.buf_index_of_last].y = y;
   ransac_buf[dr_ransac.buf_index_of_last].mx = mx;
   ransac_buf[dr_ransac.buf_index_of_last].my = my;
 
-//   ransac_update_buffer_size();
+  // Let a running fit finish, the new sample is picked up by the next one
+  dr_ransac.pending = true;
+}
 
+/**
+ * Advance the RANSAC fit of a linear drift model by at most RANSAC_ITERATIONS_PER_STEP hypotheses.
+ *
+ * Every hypothesis is a least squares fit over a random subset of 40% of the buffer, scored by the
+ * sum of capped squared residuals. The best hypothesis is refitted on its inliers.
+ *
+ * @return true when a fit completed in this call and dr_ransac holds new drift parameters
+ */
+bool ransac_step(void)
+{
+  int step;
 
-  // If sufficient items in buffer
-  if (dr_ransac.buf_size > 4)
-  {
-    /** Perform RANSAC to fit a linear model.
-     *
-     * @param[in] n_samples The number of samples to use for a single fit
-     * @param[in] n_iterations The number of times a linear fit is performed
-     * @param[in] error_threshold The threshold used to cap errors in the RANSAC process
-     * @param[in] targets The target values
-     * @param[in] samples The samples / feature vectors
-     * @param[in] D The dimensionality of the samples
-     * @param[in] count The number of samples
-     * @param[out] parameters* Parameters of the linear fit
-     * @param[out] fit_error* Total error of the fit
-     */
-
-    int n_samples = ((int)dr_ransac.buf_size * 0.4);
-    int n_iterations = 200;
-    float error_threshold = 1.0;
-    int D = 1;
-    int count = dr_ransac.buf_size;
-    float targets_x[count];
-    float targets_y[count];
-    float samples[count][1];
-    float params_x[2];
-    float params_y[2];
-    float fit_error;
-
-    for (i=0;i<count;i++)
+  if (!dr_ransac.busy)
+  {
+    if (!dr_ransac.pending)
+    {
+      return false;
+    }
+    dr_ransac.pending = false;
+    start_fit();
+    if (!dr_ransac.busy)
+    {
+      return false;
+    }
+  }
+
+  for (step=0; (step < RANSAC_ITERATIONS_PER_STEP) && (dr_ransac.iteration < RANSAC_ITERATIONS); step++)
+  {
+    float px[2], py[2];
+    int k;
+
+    // Partial Fisher-Yates shuffle, the first fit_n_samples indices are a uniform random subset
+    for (k=0; k<fit_n_samples; k++)
     {
-      struct dronerace_ransac_buf_struct* r = &ransac_buf[get_index(i)];
-      targets_x[i] = r->x - r->mx;
-      targets_y[i] = r->y - r->my;
-      samples[i][0] = r->time - dr_state.time;
-    //   printf("Fit %f to %f\n", targets_x[i], samples[i][0]);
+      const int j = k + ransac_rand() % (fit_count - k);
+      const uint8_t tmp = fit_idx[k];
+      fit_idx[k] = fit_idx[j];
+      fit_idx[j] = tmp;
     }
 
-    // printf("Running RANSAC with %d points and %d samples, err_max %f\n",count, n_samples, error_threshold);
+    fit_line(fit_x, fit_idx, fit_n_samples, px);
+    fit_line(fit_y, fit_idx, fit_n_samples, py);
 
+    const float err_x = fit_error(fit_x, px);
+    if (err_x < best_err_x)
+    {
+      best_err_x = err_x;
+      best_x[0] = px[0];
+      best_x[1] = px[1];
+    }
+    const float err_y = fit_error(fit_y, py);
+    if (err_y < best_err_y)
+    {
+      best_err_y = err_y;
+      best_y[0] = py[0];
+      best_y[1] = py[1];
+    }
 
-    // RANSAC_linear_model( n_samples, n_iterations,  error_threshold,
-    //     targets_x, D, samples, count, params_x, &fit_error);
+    dr_ransac.iteration++;
+  }
 
-    //RANSAC_linear_model( n_samples, n_iterations,  error_threshold, targets_y, D, samples, count, params_y, &fit_error);
+  if (dr_ransac.iteration < RANSAC_ITERATIONS)
+  {
+    return false;
+  }
 
-    ransac_cnt ++;
+  fit_inliers(fit_x, best_x);
+  fit_inliers(fit_y, best_y);
 
+  dr_ransac.corr_x = best_x[0];
+  dr_ransac.rate_x = best_x[1];
+  dr_ransac.corr_y = best_y[0];
+  dr_ransac.rate_y = best_y[1];
+  dr_ransac.fit_time = fit_start_time;
+  dr_ransac.fit_time_us = fit_start_time_us;
+  dr_ransac.fit_cnt++;
+  dr_ransac.busy = false;
 
+  return true;
+}
 
-// #define DEBUG_RANSAC
-// #ifdef DEBUG_RANSAC
-//     {
-//       char filename[128];
-//       sprintf(filename,"debug/ransac%06d.txt",ransac_cnt);
-//       FILE* fp = fopen(filename,"w");
-//       fprintf(fp,"time,x,y,mx,my\n");
-//       //printf("t=%f %f\n\n",dr_state.time,dr_ransac.dt_max);
-//       for (i=0;i<RANSAC_BUF_SIZE;i++)
-//       {
-//         fprintf(fp,"%d,%f,%f,%f,%f,%f\n",i,ransac_buf[get_index(i)].time,
-//             ransac_buf[get_index(i)].x,
-//             ransac_buf[get_index(i)].y,
-//             ransac_buf[get_index(i)].mx,
-//             ransac_buf[get_index(i)].my
-//             );
-//       }
+// The predicted states got corrected by the drift model, remove it from the stored predictions as well.
+// The fit in progress and the last result move with them, so neither has to be redone.
+void ransac_shift(float corr_x, float corr_y, float rate_x, float rate_y, float fit_time)
+{
+  int i;
 
-//       fprintf(fp,"\n\n X = %f %f Y = %f  %f \n",params_x[0], params_x[1], params_y[0], params_y[1] );
+  for (i=0; i<RANSAC_BUF_SIZE; i++)
+  {
+    struct dronerace_ransac_buf_struct* r = &ransac_buf[i];
+    if (r->time == 0)
+    {
+      continue;
+    }
+    r->x -= corr_x + rate_x * (r->time - fit_time);
+    r->y -= corr_y + rate_y * (r->time - fit_time);
+  }
 
-//       fclose(fp);
-//     }
-//     exit(-1);
-// #endif
+  if (dr_ransac.busy)
+  {
+    // Shifting the samples and the hypotheses by the same line leaves the residuals and so the scores unchanged
+    const float dt = fit_start_time - fit_time;
+    for (i=0; i<fit_count; i++)
+    {
+      fit_x[i] -= corr_x + rate_x * (fit_t[i] + dt);
+      fit_y[i] -= corr_y + rate_y * (fit_t[i] + dt);
+    }
+    best_x[0] -= corr_x + rate_x * dt;
+    best_x[1] -= rate_x;
+    best_y[0] -= corr_y + rate_y * dt;
+    best_y[1] -= rate_y;
+  }
 
+  if (dr_ransac.fit_cnt > 0)
+  {
+    const float dt = dr_ransac.fit_time - fit_time;
+    dr_ransac.corr_x -= corr_x + rate_x * dt;
+    dr_ransac.rate_x -= rate_x;
+    dr_ransac.corr_y -= corr_y + rate_y * dt;
+    dr_ransac.rate_y -= rate_y;
   }
 }
 
-#include <stdio.h>
-
-static void ransac_get_vector(void)
+/**
+ * Drift (predicted - measured) of the last fit at time.
+ *
+ * @return false while there is no fit, or the detections it was made from have left the dt_max window
+ */
+bool ransac_drift(float time, float *drift_x, float *drift_y)
 {
-  int i = 0;
-  for ( i=0; i<dr_ransac.buf_size; i++ )
+  if (dr_ransac.fit_cnt == 0 || dr_ransac.buf_size <= 4 || (dr_state.time - dr_ransac.fit_time) > dr_ransac.dt_max)
   {
-    // Get index
-    ransac_buf[get_index(i)];
+    return false;
   }
+
+  *drift_x = dr_ransac.corr_x + dr_ransac.rate_x * (time - dr_ransac.fit_time);
+  *drift_y = dr_ransac.corr_y + dr_ransac.rate_y * (time - dr_ransac.fit_time);
+  return true;
 }
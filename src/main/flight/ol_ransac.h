@@ -1,3 +1,14 @@
+#pragma once
+
+#include <stdbool.h>
+
+#include "common/time.h"
+
+#define RANSAC_BUF_SIZE             20
+#define RANSAC_ITERATIONS           100   // hypotheses per fit
+#define RANSAC_ITERATIONS_PER_STEP  20    // compute budget of a single ransac_step() call
+#define RANSAC_ERROR_THRESHOLD      1.0f  // m, residuals are capped here and larger ones are outliers
+
 struct dronerace_ransac_struct
 {
   // Settings
@@ -6,6 +17,20 @@ struct dronerace_ransac_struct
   // States
   int buf_index_of_last;
   int buf_size;
+
+  // Fit in progress
+  int iteration;
+  bool busy;
+  bool pending;
+
+  // Result: drift (predicted - measured) = corr + rate * (t - fit_time)
+  float corr_x;
+  float corr_y;
+  float rate_x;
+  float rate_y;
+  float fit_time;
+  timeUs_t fit_time_us;
+  int fit_cnt;
 };
 
 extern struct dronerace_ransac_struct dr_ransac;
@@ -14,5 +39,7 @@ extern struct dronerace_ransac_struct dr_ransac;
 
 extern void ransac_reset(void);
 extern void ransac_update_buffer_size(void);
-extern void ransac_push(float time, float x, float y, float mx, float my);
-
+extern void ransac_push(float time, float x, float y, float mx, float my, timeUs_t time_us);
+extern bool ransac_step(void);
+extern void ransac_shift(float corr_x, float corr_y, float rate_x, float rate_y, float fit_time);
+extern bool ransac_drift(float time, float *drift_x, float *drift_y);
@@ -0,0 +1,186 @@
+#include <math.h>
+
+#include "flight/ol_trajectory.h"
+
+struct dronerace_trajectory_struct dr_traj;
+
+// Minimum jerk (quintic) segment from one gate to the next, p(t) = c[0] + c[1] t + ... + c[5] t^5
+struct dronerace_trajectory_segment_struct
+{
+  float t_start;
+  float duration;
+  float cx[6];
+  float cy[6];
+};
+
+static struct dronerace_trajectory_segment_struct segments[OL_FLIGHTPLAN_MAX_GATES];
+static int segment_count;
+
+// Rest to rest with zero boundary acceleration, peak speed is 1.875 and peak acceleration 5.77 times the mean
+#define MIN_JERK_PEAK_VEL 1.875f
+#define MIN_JERK_PEAK_ACC 5.77f
+
+static void quintic(float *c, float p0, float v0, float p1, float v1, float T)
+{
+  const float d = p1 - p0;
+  const float T2 = T * T;
+  const float T3 = T2 * T;
+
+  c[0] = p0;
+  c[1] = v0;
+  c[2] = 0;
+  c[3] = (20 * d - (8 * v1 + 12 * v0) * T) / (2 * T3);
+  c[4] = (-30 * d + (14 * v1 + 16 * v0) * T) / (2 * T3 * T);
+  c[5] = (12 * d - 6 * (v1 + v0) * T) / (2 * T3 * T2);
+}
+
+// Peak acceleration of a segment, sampled, only used while building
+static float peak_acc(const struct dronerace_trajectory_segment_struct *s, float T)
+{
+  float peak = 0;
+  int i;
+
+  for (i=0; i<=16; i++)
+  {
+    const float t = T * i / 16;
+    const float ax = 2 * s->cx[2] + t * (6 * s->cx[3] + t * (12 * s->cx[4] + t * 20 * s->cx[5]));
+    const float ay = 2 * s->cy[2] + t * (6 * s->cy[3] + t * (12 * s->cy[4] + t * 20 * s->cy[5]));
+    const float a2 = ax * ax + ay * ay;
+    if (a2 > peak)
+    {
+      peak = a2;
+    }
+  }
+  return sqrtf(peak);
+}
+
+/**
+ * Precompute a smooth path from the start (origin, at rest) through all gates, ending at rest in the last gate.
+ *
+ * Every gate is passed along the bisector of its incoming and outgoing segment, at the lower of the two approach
+ * speeds scaled by the cosine of half the turn. Segment durations keep the peak speed near the approach speed and
+ * the peak acceleration below OL_TRAJECTORY_MAX_ACC. Only called when the flightplan is loaded.
+ */
+void ol_trajectory_build(const float *x, const float *y, const float *speed, int count)
+{
+  float px = 0, py = 0, pvx = 0, pvy = 0;
+  float t = 0;
+  int i;
+
+  segment_count = 0;
+  for (i=0; i<count && i<OL_FLIGHTPLAN_MAX_GATES; i++)
+  {
+    const float dx = x[i] - px;
+    const float dy = y[i] - py;
+    const float len = sqrtf(dx * dx + dy * dy);
+    float vx = 0, vy = 0;
+
+    if ((i + 1) < count)
+    {
+      const float nx = x[i + 1] - x[i];
+      const float ny = y[i + 1] - y[i];
+      const float nlen = sqrtf(nx * nx + ny * ny);
+      if (len > 0.01f && nlen > 0.01f)
+      {
+        const float v = 0.5f * ((speed[i] < speed[i + 1]) ? speed[i] : speed[i + 1]);
+        vx = v * (dx / len + nx / nlen);
+        vy = v * (dy / len + ny / nlen);
+      }
+    }
+
+    // Mean speed of the segment, between rest to rest and cruising through at the approach speed
+    const float vmax = (speed[i] > 0.1f) ? speed[i] : 0.1f;
+    const float v_bound = 0.5f * (sqrtf(pvx * pvx + pvy * pvy) + sqrtf(vx * vx + vy * vy));
+    const float k = MIN_JERK_PEAK_VEL - (MIN_JERK_PEAK_VEL - 1.0f) * ((v_bound < vmax) ? v_bound / vmax : 1.0f);
+    float T = k * len / vmax;
+    const float T_acc = sqrtf(MIN_JERK_PEAK_ACC * len / OL_TRAJECTORY_MAX_ACC);
+    if (T < T_acc)
+    {
+      T = T_acc;
+    }
+    if (T < OL_TRAJECTORY_MIN_TIME)
+    {
+      T = OL_TRAJECTORY_MIN_TIME;
+    }
+
+    // Turning through a gate needs acceleration the rest to rest bound does not cover, stretch until it fits
+    struct dronerace_trajectory_segment_struct *s = &segments[segment_count++];
+    int iter;
+    for (iter=0; iter<OL_TRAJECTORY_MAX_STRETCH; iter++)
+    {
+      quintic(s->cx, px, pvx, x[i], vx, T);
+      quintic(s->cy, py, pvy, y[i], vy, T);
+      if (peak_acc(s, T) <= OL_TRAJECTORY_MAX_ACC)
+      {
+        break;
+      }
+      T *= 1.1f;
+    }
+    s->t_start = t;
+    s->duration = T;
+
+    t += T;
+    px = x[i];
+    py = y[i];
+    pvx = vx;
+    pvy = vy;
+  }
+
+  ol_trajectory_reset();
+}
+
+void ol_trajectory_reset(void)
+{
+  dr_traj.segment = 0;
+  ol_trajectory_sample(0);
+}
+
+float ol_trajectory_duration(void)
+{
+  if (segment_count == 0)
+  {
+    return 0;
+  }
+  return segments[segment_count - 1].t_start + segments[segment_count - 1].duration;
+}
+
+static void eval(const float *c, float t, float *p, float *v, float *a)
+{
+  *p = c[0] + t * (c[1] + t * (c[2] + t * (c[3] + t * (c[4] + t * c[5]))));
+  *v = c[1] + t * (2 * c[2] + t * (3 * c[3] + t * (4 * c[4] + t * 5 * c[5])));
+  *a = 2 * c[2] + t * (6 * c[3] + t * (12 * c[4] + t * 20 * c[5]));
+}
+
+// Sample the setpoints, time only moves forward between resets so finding the segment is O(1)
+void ol_trajectory_sample(float time)
+{
+  dr_traj.time = time;
+
+  if (segment_count == 0)
+  {
+    dr_traj.x = dr_traj.y = 0;
+    dr_traj.vx = dr_traj.vy = 0;
+    dr_traj.ax = dr_traj.ay = 0;
+    return;
+  }
+
+  while ((dr_traj.segment + 1) < segment_count && time >= segments[dr_traj.segment + 1].t_start)
+  {
+    dr_traj.segment++;
+  }
+
+  const struct dronerace_trajectory_segment_struct *s = &segments[dr_traj.segment];
+  float t = time - s->t_start;
+  if (t < 0)
+  {
+    t = 0;
+  }
+  else if (t > s->duration)
+  {
+    // Past the last gate, hold it
+    t = s->duration;
+  }
+
+  eval(s->cx, t, &dr_traj.x, &dr_traj.vx, &dr_traj.ax);
+  eval(s->cy, t, &dr_traj.y, &dr_traj.vy, &dr_traj.ay);
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "flight/ol_flightplan.h"
+
+#define OL_TRAJECTORY_MAX_ACC   4.0f    // m/s^2, horizontal acceleration the segment timing is planned for
+#define OL_TRAJECTORY_MIN_TIME  0.2f    // s, shortest segment
+#define OL_TRAJECTORY_MAX_STRETCH 20    // times a segment is made 10% slower to respect OL_TRAJECTORY_MAX_ACC
+
+struct dronerace_trajectory_struct
+{
+  // Progress
+  float time;       // s since the start of the flightplan
+  int segment;
+
+  // Setpoints
+  float x;          // m
+  float y;
+  float vx;         // m/s
+  float vy;
+  float ax;         // m/s^2
+  float ay;
+};
+
+extern struct dronerace_trajectory_struct dr_traj;
+
+extern void ol_trajectory_build(const float *x, const float *y, const float *speed, int count);
+extern void ol_trajectory_reset(void);
+extern void ol_trajectory_sample(float time);
+extern float ol_trajectory_duration(void);
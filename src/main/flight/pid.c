@@ -45,9 +45,7 @@
 #include "flight/pid.h"
 #include "flight/imu.h"
 #include "flight/mixer.h"
-#include "flight/ol_filter.h"
-#include "flight/ol_flightplan.h"
-#include "flight/ol_control.h"
+#include "flight/ol_navigation.h"
 
 #include "io/gps.h"
 
@@ -334,13 +332,13 @@ void pidCopyProfile(uint8_t dstPidProfileIndex, uint8_t srcPidProfileIndex)
 }
 
 // calculates strength of horizon leveling; 0 = none, 1.0 = most leveling
-static float calcHorizonLevelStrength(void)
+static float calcHorizonLevelStrength(const float *levelAttitude)
 {
     // start with 1.0 at center stick, 0.0 at max stick deflection:
     float horizonLevelStrength = 1.0f - MAX(getRcDeflectionAbs(FD_ROLL), getRcDeflectionAbs(FD_PITCH));
 
     // 0 at level, 90 at vertical, 180 at inverted (degrees):
-    const float currentInclination = MAX(ABS(attitude.values.roll), ABS(attitude.values.pitch)) / 10.0f;
+    const float currentInclination = MAX(ABS(levelAttitude[FD_ROLL]), ABS(levelAttitude[FD_PITCH]));
 
     // horizonTiltExpertMode:  0 = leveling always active when sticks centered,
     //                         1 = leveling can be totally off when inverted
@@ -389,7 +387,16 @@ static float calcHorizonLevelStrength(void)
     return constrainf(horizonLevelStrength, 0, 1);
 }
 
-static float pidLevel(int axis, const pidProfile_t *pidProfile, const rollAndPitchTrims_t *angleTrim, float currentPidSetpoint) {
+// roll and pitch in degrees from the rotation matrix, same convention as the attitude Euler angles
+static void pidGetLevelAttitude(float *levelAttitude)
+{
+    float rotation[3][3];
+    imuGetRotationMatrix(rotation);
+    levelAttitude[FD_ROLL] = atan2_approx(rotation[2][1], rotation[2][2]) * (180.0f / M_PIf);
+    levelAttitude[FD_PITCH] = ((0.5f * M_PIf) - acos_approx(-rotation[2][0])) * (180.0f / M_PIf);
+}
+
+static float pidLevel(int axis, const pidProfile_t *pidProfile, const rollAndPitchTrims_t *angleTrim, const float *levelAttitude, float currentPidSetpoint) {
     // calculate error angle and limit the angle to the max inclination
     // rcDeflection is in range [-1.0, 1.0]
     float angle = pidProfile->levelAngleLimit * getRcDeflection(axis);
@@ -398,35 +405,30 @@ static float pidLevel(int axis, const pidProfile_t *pidProfile, const rollAndPit
 #endif
     angle = constrainf(angle, -pidProfile->levelAngleLimit, pidProfile->levelAngleLimit);
     DEBUG_SET(DEBUG_DESIREDANGLE,axis,angle);
-    if(!FLIGHT_MODE(RANGEFINDER_MODE))
-    {
-        ol_filter_reset();
-        ol_control_reset();   
-    }
     if(FLIGHT_MODE(RANGEFINDER_MODE))
-    {   
-        ol_filter_predict();
-        ol_control_run();  
+    {
+        // outer loop runs in TASK_OL_NAVIGATION, only read its latest published setpoint here
+        const olSetpoint_t *olSetpoint = ol_navigation_get_setpoint();
         // if(axis == 0){angle = uart_roll / 3.14 * 180;}//roll
         // if(axis == 1){angle = uart_pitch / 3.14 * 180;}//pitch
-        // if(axis == 0){angle = dr_control.phi_cmd / 3.14 * 180;}//roll
-        // if(axis == 1){angle = dr_control.theta_cmd / 3.14 * 180;}//pitch
+        // if(axis == 0){angle = olSetpoint->phi_cmd / 3.14 * 180;}//roll
+        // if(axis == 1){angle = olSetpoint->theta_cmd / 3.14 * 180;}//pitch
         if(axis == 0){angle = constrainf((rcData[ROLL]-1500)/5,-180,180);}//roll
         if(axis == 1){angle = constrainf((rcData[PITCH]-1500)/5,-180,180);}//pitch
-        DEBUG_SET(DEBUG_OLCTRL,0,100 * dr_control.alt_cmd);
-        DEBUG_SET(DEBUG_OLCTRL,1,dr_control.theta_cmd/3.14*180);
-        DEBUG_SET(DEBUG_OLCTRL,2,dr_control.phi_cmd/3.14*180);
-        DEBUG_SET(DEBUG_OLCTRL,3,dr_control.psi_cmd/3.14*180);
+        DEBUG_SET(DEBUG_OLCTRL,0,100 * olSetpoint->alt_cmd);
+        DEBUG_SET(DEBUG_OLCTRL,1,olSetpoint->theta_cmd/3.14f*180);
+        DEBUG_SET(DEBUG_OLCTRL,2,olSetpoint->phi_cmd/3.14f*180);
+        DEBUG_SET(DEBUG_OLCTRL,3,olSetpoint->psi_cmd/3.14f*180);
     }
     DEBUG_SET(DEBUG_DESIREDANGLE,axis,angle);
-    const float errorAngle = angle - ((attitude.raw[axis] - angleTrim->raw[axis]) / 10.0f);
+    const float errorAngle = angle - (levelAttitude[axis] - angleTrim->raw[axis] / 10.0f);
     if (FLIGHT_MODE(ANGLE_MODE)) {
         // ANGLE mode - control is angle based
         currentPidSetpoint = errorAngle * levelGain;
     } else {
         // HORIZON mode - mix of ANGLE and ACRO modes
         // mix in errorAngle to currentPidSetpoint to add a little auto-level feel
-        const float horizonLevelStrength = calcHorizonLevelStrength();
+        const float horizonLevelStrength = calcHorizonLevelStrength(levelAttitude);
         currentPidSetpoint = currentPidSetpoint + (errorAngle * horizonGain * horizonLevelStrength);
     }
     return currentPidSetpoint;
@@ -472,6 +474,11 @@ void pidController(const pidProfile_t *pidProfile, const rollAndPitchTrims_t *an
     // Dynamic d component, enable 2-DOF PID controller only for rate mode
     const float dynCd = flightModeFlags ? 0.0f : dtermSetpointWeight;
 
+    float levelAttitude[2];
+    if (FLIGHT_MODE(ANGLE_MODE) || FLIGHT_MODE(HORIZON_MODE)) {
+        pidGetLevelAttitude(levelAttitude);
+    }
+
     // ----------PID controller----------
     for (int axis = FD_ROLL; axis <= FD_YAW; axis++) {
         float currentPidSetpoint = getSetpointRate(axis);
@@ -480,7 +487,7 @@ void pidController(const pidProfile_t *pidProfile, const rollAndPitchTrims_t *an
         }
         // Yaw control is GYRO based, direct sticks control is applied to rate PID
         if ((FLIGHT_MODE(ANGLE_MODE) || FLIGHT_MODE(HORIZON_MODE)) && axis != YAW) {
-            currentPidSetpoint = pidLevel(axis, pidProfile, angleTrim, currentPidSetpoint);
+            currentPidSetpoint = pidLevel(axis, pidProfile, angleTrim, levelAttitude, currentPidSetpoint);
         }
         DEBUG_SET(DEBUG_ANGLE,axis,currentPidSetpoint)
         // -----calculate error rate
@@ -0,0 +1,174 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * RPM filter: notches on the rotation frequency of each motor and its harmonics, the frequencies come from the ESC
+ * telemetry. The notch coefficients of one motor are refreshed per gyro cycle with one sin and one cos, the harmonics
+ * follow from the fundamental with the Chebyshev recurrence.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+#include "platform.h"
+
+#ifdef USE_RPM_FILTER
+
+#include "build/debug.h"
+
+#include "common/filter.h"
+#include "common/maths.h"
+
+#include "config/feature.h"
+#include "pg/pg.h"
+#include "pg/pg_ids.h"
+
+#include "flight/mixer.h"
+#include "flight/rpm_filter.h"
+
+#include "sensors/esc_sensor.h"
+
+#define RPM_FILTER_MAX_HZ_RATIO 0.9f    // of nyquist
+
+PG_REGISTER_WITH_RESET_TEMPLATE(rpmFilterConfig_t, rpmFilterConfig, PG_RPM_FILTER_CONFIG, 0);
+
+PG_RESET_TEMPLATE(rpmFilterConfig_t, rpmFilterConfig,
+    .gyro_rpm_notch_harmonics = 3,
+    .gyro_rpm_notch_min = 100,
+    .gyro_rpm_notch_q = 500,
+    .rpm_notch_lpf = 150,
+    .motor_poles = 14,
+);
+
+bool rpmFilterInit(rpmNotchFilter_t *filter, uint32_t targetLooptimeUs)
+{
+    memset(filter, 0, sizeof(rpmNotchFilter_t));
+
+    if (!rpmFilterConfig()->gyro_rpm_notch_harmonics || !feature(FEATURE_ESC_SENSOR)) {
+        return false;
+    }
+
+    filter->harmonics = MIN(rpmFilterConfig()->gyro_rpm_notch_harmonics, RPM_FILTER_HARMONICS_MAX);
+    filter->motorCount = MIN(getMotorCount(), MAX_SUPPORTED_MOTORS);
+    filter->notchCount = filter->motorCount * filter->harmonics;
+    if (!filter->notchCount) {
+        return false;
+    }
+
+    // the telemetry reports the electrical rpm / 100
+    filter->erpmToHz = 100.0f / 60.0f / (MAX(rpmFilterConfig()->motor_poles, 2) / 2);
+    filter->minHz = rpmFilterConfig()->gyro_rpm_notch_min;
+    filter->maxHz = RPM_FILTER_MAX_HZ_RATIO * 0.5f * 1000000.0f / targetLooptimeUs;
+    filter->q = rpmFilterConfig()->gyro_rpm_notch_q / 100.0f;
+    filter->omegaPerHz = 2.0f * M_PIf * targetLooptimeUs * 0.000001f;
+
+    // each motor is updated once every motorCount gyro cycles
+    const float motorDt = filter->motorCount * targetLooptimeUs * 0.000001f;
+    for (int motor = 0; motor < filter->motorCount; motor++) {
+        pt1FilterInit(&filter->motorFreqFilter[motor], rpmFilterConfig()->rpm_notch_lpf, motorDt);
+        filter->motorFreqFilter[motor].state = filter->minHz;
+        filter->motorFreq[motor] = filter->minHz;
+    }
+    for (int i = 0; i < filter->notchCount; i++) {
+        biquadFilterBankInit(&filter->notch[i], filter->minHz * (i % filter->harmonics + 1), targetLooptimeUs, filter->q, FILTER_NOTCH);
+    }
+
+    return true;
+}
+
+static void rpmNotchSetPassThrough(biquadFilterBank_t *notch)
+{
+    for (int lane = 0; lane < FILTER_BANK_LANES; lane++) {
+        notch->b0[lane] = 1.0f;
+        notch->b1[lane] = notch->b2[lane] = notch->a1[lane] = notch->a2[lane] = 0.0f;
+    }
+}
+
+/* Same coefficients as biquadFilterInit for FILTER_NOTCH, from the sine and cosine of the notch frequency */
+static void rpmNotchSetCoefficients(biquadFilterBank_t *notch, float cosOmega, float sinOmega, float q)
+{
+    const float alpha = sinOmega / (2.0f * q);
+    const float a0Inv = 1.0f / (1.0f + alpha);
+    const float b0 = a0Inv;
+    const float b1 = -2.0f * cosOmega * a0Inv;
+    const float a2 = (1.0f - alpha) * a0Inv;
+    for (int lane = 0; lane < FILTER_BANK_LANES; lane++) {
+        notch->b0[lane] = b0;
+        notch->b1[lane] = b1;
+        notch->b2[lane] = b0;
+        notch->a1[lane] = b1;
+        notch->a2[lane] = a2;
+    }
+}
+
+FAST_CODE void rpmFilterUpdate(rpmNotchFilter_t *filter)
+{
+    if (!filter->notchCount) {
+        return;
+    }
+
+    const int motor = filter->currentMotor;
+    const escSensorData_t *escData = getEscSensorData(motor);
+    float motorHz = 0.0f;
+    if (escData && escData->dataAge < ESC_DATA_INVALID) {
+        motorHz = escData->rpm * filter->erpmToHz;
+    }
+    motorHz = MAX(pt1FilterApply(&filter->motorFreqFilter[motor], motorHz), filter->minHz);
+    filter->motorFreq[motor] = motorHz;
+    if (motor < 4) {
+        DEBUG_SET(DEBUG_RPM_FILTER, motor, lrintf(motorHz));
+    }
+
+    // cos(n * w) = 2 * cos(w) * cos((n - 1) * w) - cos((n - 2) * w), and the same for the sine
+    const float omega = motorHz * filter->omegaPerHz;
+    const float cos1 = cos_approx(omega);
+    float cosN = cos1, sinN = sin_approx(omega);
+    float cosPrev = 1.0f, sinPrev = 0.0f;
+    biquadFilterBank_t *notch = &filter->notch[motor * filter->harmonics];
+    for (int harmonic = 1; harmonic <= filter->harmonics; harmonic++, notch++) {
+        if (motorHz * harmonic < filter->maxHz) {
+            rpmNotchSetCoefficients(notch, cosN, sinN, filter->q);
+        } else {
+            rpmNotchSetPassThrough(notch);
+        }
+        const float cosNext = 2.0f * cos1 * cosN - cosPrev;
+        const float sinNext = 2.0f * cos1 * sinN - sinPrev;
+        cosPrev = cosN;
+        sinPrev = sinN;
+        cosN = cosNext;
+        sinN = sinNext;
+    }
+
+    filter->currentMotor = (motor + 1) % filter->motorCount;
+}
+
+FAST_CODE void rpmFilterApply(rpmNotchFilter_t *filter, float *data)
+{
+    for (int i = 0; i < filter->notchCount; i++) {
+        // DF1, the coefficients move while the filter runs
+        biquadFilterBankApplyDF1(&filter->notch[i], data);
+    }
+}
+
+float rpmFilterMotorFrequency(const rpmNotchFilter_t *filter, int motor)
+{
+    return motor < filter->motorCount ? filter->motorFreq[motor] : 0.0f;
+}
+
+#endif // USE_RPM_FILTER
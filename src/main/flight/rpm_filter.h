@@ -0,0 +1,57 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "common/filter.h"
+#include "drivers/pwm_output_counts.h"
+#include "pg/pg.h"
+
+#define RPM_FILTER_HARMONICS_MAX 3
+
+typedef struct rpmFilterConfig_s {
+    uint8_t  gyro_rpm_notch_harmonics;  // notches per motor, on the rotation frequency and its harmonics, 0 disables the filter
+    uint8_t  gyro_rpm_notch_min;        // lowest notch frequency in Hz, the notches of idling and stopped motors stay here
+    uint16_t gyro_rpm_notch_q;          // notch Q * 100
+    uint8_t  rpm_notch_lpf;             // cutoff in Hz of the smoothing of the telemetry motor frequencies
+    uint8_t  motor_poles;               // magnets of the motor, converts the electrical rpm of the telemetry
+} rpmFilterConfig_t;
+
+PG_DECLARE(rpmFilterConfig_t, rpmFilterConfig);
+
+typedef struct rpmNotchFilter_s {
+    uint8_t harmonics;
+    uint8_t motorCount;
+    uint8_t notchCount;
+    uint8_t currentMotor;               // the next motor to update, one per gyro cycle
+    float erpmToHz;
+    float minHz;
+    float maxHz;                        // harmonics above this are not filtered, notches close to nyquist are unstable
+    float q;
+    float omegaPerHz;
+    pt1Filter_t motorFreqFilter[MAX_SUPPORTED_MOTORS];
+    float motorFreq[MAX_SUPPORTED_MOTORS];
+    biquadFilterBank_t notch[MAX_SUPPORTED_MOTORS * RPM_FILTER_HARMONICS_MAX];  // harmonics of a motor are consecutive
+} rpmNotchFilter_t;
+
+bool rpmFilterInit(rpmNotchFilter_t *filter, uint32_t targetLooptimeUs);
+void rpmFilterUpdate(rpmNotchFilter_t *filter);
+void rpmFilterApply(rpmNotchFilter_t *filter, float *data);
+float rpmFilterMotorFrequency(const rpmNotchFilter_t *filter, int motor);
@@ -92,6 +92,7 @@ extern uint8_t __config_end;
 #include "flight/imu.h"
 #include "flight/mixer.h"
 #include "flight/navigation.h"
+#include "flight/ol_flightplan.h"
 #include "flight/pid.h"
 #include "flight/servos.h"
 
@@ -141,6 +142,8 @@ extern uint8_t __config_end;
 #include "sensors/sensors.h"
 
 #include "telemetry/frsky_hub.h"
+#include "telemetry/mavlink.h"
+#include "telemetry/mavlink_rx.h"
 #include "telemetry/telemetry.h"
 
 
@@ -1089,6 +1092,87 @@ static void cliAdjustmentRange(char *cmdline)
     }
 }
 
+static void printGate(uint8_t dumpMask, const olGate_t *gates, const olGate_t *defaultGates)
+{
+    const char *format = "gate %u %d %d %d %d %u %u";
+    for (uint32_t i = 0; i < OL_FLIGHTPLAN_MAX_GATES; i++) {
+        const olGate_t *gate = &gates[i];
+        bool equalsDefault = false;
+        if (defaultGates) {
+            const olGate_t *gateDefault = &defaultGates[i];
+            equalsDefault = !memcmp(gate, gateDefault, sizeof(*gate));
+            cliDefaultPrintLinef(dumpMask, equalsDefault, format,
+                i,
+                gateDefault->x,
+                gateDefault->y,
+                gateDefault->alt,
+                gateDefault->psi,
+                gateDefault->speed,
+                gateDefault->pass_dist
+            );
+        }
+        cliDumpPrintLinef(dumpMask, equalsDefault, format,
+            i,
+            gate->x,
+            gate->y,
+            gate->alt,
+            gate->psi,
+            gate->speed,
+            gate->pass_dist
+        );
+    }
+}
+
+static void cliGate(char *cmdline)
+{
+    const char *ptr;
+
+    if (isEmpty(cmdline)) {
+        printGate(DUMP_MASTER, olGates(0), NULL);
+    } else if (strncasecmp(cmdline, "reset", 5) == 0) {
+        // erase flightplan
+        for (uint32_t i = 0; i < OL_FLIGHTPLAN_MAX_GATES; i++) {
+            memset(olGatesMutable(i), 0, sizeof(olGate_t));
+        }
+        ol_flightplan_load();
+    } else {
+        ptr = cmdline;
+        const int i = atoi(ptr);
+        if (i >= 0 && i < OL_FLIGHTPLAN_MAX_GATES) {
+            int val[6];
+            uint8_t validArgumentCount = 0;
+
+            for (uint32_t j = 0; j < ARRAYLEN(val); j++) {
+                ptr = nextArg(ptr);
+                if (!ptr) {
+                    break;
+                }
+                val[j] = atoi(ptr);
+                validArgumentCount++;
+            }
+
+            if (validArgumentCount != ARRAYLEN(val)) {
+                cliShowParseError();
+            } else if (val[4] < 0 || val[4] > OL_FLIGHTPLAN_MAX_SPEED) {
+                cliShowArgumentRangeError("speed", 0, OL_FLIGHTPLAN_MAX_SPEED);
+            } else if (val[5] < 0 || val[5] > OL_FLIGHTPLAN_MAX_PASS_DIST) {
+                cliShowArgumentRangeError("pass_dist", 0, OL_FLIGHTPLAN_MAX_PASS_DIST);
+            } else {
+                olGate_t *gate = olGatesMutable(i);
+                gate->x = constrain(val[0], INT16_MIN, INT16_MAX);
+                gate->y = constrain(val[1], INT16_MIN, INT16_MAX);
+                gate->alt = constrain(val[2], INT16_MIN, INT16_MAX);
+                gate->psi = constrain(val[3], -360, 360);
+                gate->speed = val[4];
+                gate->pass_dist = val[5];
+                ol_flightplan_load();
+            }
+        } else {
+            cliShowArgumentRangeError("index", 0, OL_FLIGHTPLAN_MAX_GATES - 1);
+        }
+    }
+}
+
 #ifndef USE_QUAD_MIXER_ONLY
 static void printMotorMix(uint8_t dumpMask, const motorMixer_t *customMotorMixer, const motorMixer_t *defaultCustomMotorMixer)
 {
@@ -1780,6 +1864,11 @@ static void cliFlashInfo(char *cmdline)
 
     cliPrintLinef("Flash sectors=%u, sectorSize=%u, pagesPerSector=%u, pageSize=%u, totalSize=%u, usedSize=%u",
             layout->sectors, layout->sectorSize, layout->pagesPerSector, layout->pageSize, layout->totalSize, flashfsGetOffset());
+
+    const flashfsStats_t *stats = flashfsGetStats();
+    cliPrintLinef("Written=%u, pages=%u, throughput=%u B/s, busy stalls=%u, dropped=%u, buffer=%u/%u",
+            stats->bytesWritten, stats->pagesProgrammed, stats->throughput, stats->busyStalls, stats->bytesDropped,
+            stats->bufferHighWater, flashfsGetWriteBufferSize());
 }
 
 
@@ -3071,6 +3160,9 @@ static void cliStatus(char *cmdline)
 #define CONFIG_SIZE (&__config_end - &__config_start)
 #endif
     cliPrintLinef("I2C Errors: %d, config size: %d, max available config: %d", i2cErrorCounter, getEEPROMConfigSize(), CONFIG_SIZE);
+#ifdef USE_BLACKBOX
+    cliPrintLinef("Blackbox dropped frames: %u", blackboxGetDroppedFrames());
+#endif
 
     const int gyroRate = getTaskDeltaTime(TASK_GYROPID) == 0 ? 0 : (int)(1000000.0f / ((float)getTaskDeltaTime(TASK_GYROPID)));
     const int rxRate = getTaskDeltaTime(TASK_RX) == 0 ? 0 : (int)(1000000.0f / ((float)getTaskDeltaTime(TASK_RX)));
@@ -3087,10 +3179,80 @@ static void cliStatus(char *cmdline)
     cliPrintLinefeed();
 }
 
+#if defined(USE_TELEMETRY) && defined(USE_TELEMETRY_MAVLINK)
+static void cliMavlink(char *cmdline)
+{
+    UNUSED(cmdline);
+
+    static const char * const typeNames[MAVLINK_RX_TYPE_COUNT] = { "SETPOINT", "VISION", "HIGHRES_IMU", "OTHER" };
+    static const char * const healthNames[] = { "NONE", "OK", "STALE", "LOST" };
+
+    cliPrintLinef("Link: %s, lost frames: %u, crc errors: %u",
+        healthNames[mavlinkRxLinkHealth(micros())], mavlinkRxGetLostFrames(), mavlinkRxGetCrcErrors());
+    cliPrintLine("Message       received  dropped  rate(Hz)  latency avg/max(us)");
+    for (int i = 0; i < MAVLINK_RX_TYPE_COUNT; i++) {
+        const mavlinkRxStats_t *stats = mavlinkRxGetStats(i);
+        cliPrintLinef("%12s %9u %8u %9d %10u/%u", typeNames[i], stats->received, stats->dropped, stats->rateHz,
+            stats->latencyAvgUs, stats->latencyMaxUs);
+    }
+
+    static const char * const streamNames[MAVLINK_STREAM_COUNT] = { "HEARTBEAT", "STATUS", "ATT_QUAT", "LOCAL_POS", "ODOMETRY", "STATES" };
+
+    cliPrintLinef("TX budget: %u bytes/s, sent: %u bytes", mavlinkTxGetBytesPerSecond(), mavlinkTxGetBytesSent());
+    cliPrintLine("Stream      rate(Hz)     sent  deferred  burst");
+    for (int i = 0; i < MAVLINK_STREAM_COUNT; i++) {
+        const mavlinkTxStats_t *stats = mavlinkTxGetStats(i);
+        cliPrintLinef("%10s %9d %8u %9u %6d", streamNames[i], stats->rateHz, stats->sent, stats->deferred, stats->burstBytes);
+    }
+}
+#endif
+
 #ifndef SKIP_TASK_STATISTICS
+#ifdef USE_TASK_HISTOGRAM
+static void cliTasksHistogram(void)
+{
+    cliPrintf("Task histograms, us        ");
+    for (int bucket = 0; bucket < TASK_HISTOGRAM_BUCKETS; bucket++) {
+        cliPrintf(" %7d", bucket ? 1 << (bucket - 1) : 0);
+    }
+    cliPrintLinefeed();
+
+    for (cfTaskId_e taskId = 0; taskId < TASK_COUNT; taskId++) {
+        cfTaskInfo_t taskInfo;
+        getTaskInfo(taskId, &taskInfo);
+        if (!taskInfo.isEnabled) {
+            continue;
+        }
+        cfTaskHistogram_t histogram;
+        getTaskHistogram(taskId, &histogram);
+        cliPrintf("%02d - (%15s) exec", taskId, taskInfo.taskName);
+        for (int bucket = 0; bucket < TASK_HISTOGRAM_BUCKETS; bucket++) {
+            cliPrintf(" %7u", histogram.executionTime[bucket]);
+        }
+        cliPrintLinefeed();
+        cliPrintf("%22s late", "");
+        for (int bucket = 0; bucket < TASK_HISTOGRAM_BUCKETS; bucket++) {
+            cliPrintf(" %7u", histogram.startLatency[bucket]);
+        }
+        cliPrintLinefeed();
+    }
+
+    cfDeadlineInfo_t deadlineInfo;
+    getGyroPidDeadlineInfo(&deadlineInfo);
+    cliPrintLinef("PID deadline misses: %u late, %u overrun", deadlineInfo.late, deadlineInfo.overrun);
+}
+#endif
+
 static void cliTasks(char *cmdline)
 {
+#ifdef USE_TASK_HISTOGRAM
+    if (strncasecmp(cmdline, "histogram", 9) == 0) {
+        cliTasksHistogram();
+        return;
+    }
+#else
     UNUSED(cmdline);
+#endif
     int maxLoadSum = 0;
     int averageLoadSum = 0;
 
@@ -3598,6 +3760,9 @@ static void printConfig(char *cmdline, bool doDiff)
         cliPrintHashLine("adjrange");
         printAdjustmentRange(dumpMask, adjustmentRanges_CopyArray, adjustmentRanges(0));
 
+        cliPrintHashLine("gate");
+        printGate(dumpMask, olGates_CopyArray, olGates(0));
+
         cliPrintHashLine("rxrange");
         printRxRange(dumpMask, rxChannelRangeConfigs_CopyArray, rxChannelRangeConfigs(0));
 
@@ -3723,6 +3888,9 @@ const clicmd_t cmdTable[] = {
 #ifdef USE_RX_FRSKY_SPI
     CLI_COMMAND_DEF("frsky_bind", "initiate binding for FrSky SPI RX", NULL, cliFrSkyBind),
 #endif
+    CLI_COMMAND_DEF("gate", "configure flightplan gates",
+        "<index> <x> <y> <alt> <psi> <speed> <pass_dist>\r\n"
+        "\treset", cliGate),
     CLI_COMMAND_DEF("get", "get variable value", "[name]", cliGet),
 #ifdef USE_GPS
     CLI_COMMAND_DEF("gpspassthrough", "passthrough gps to serial", NULL, cliGpsPassthrough),
@@ -3732,6 +3900,9 @@ const clicmd_t cmdTable[] = {
     CLI_COMMAND_DEF("led", "configure leds", NULL, cliLed),
 #endif
     CLI_COMMAND_DEF("map", "configure rc channel order", "[<map>]", cliMap),
+#if defined(USE_TELEMETRY) && defined(USE_TELEMETRY_MAVLINK)
+    CLI_COMMAND_DEF("mavlink", "show MAVLink link statistics", NULL, cliMavlink),
+#endif
 #ifndef USE_QUAD_MIXER_ONLY
     CLI_COMMAND_DEF("mixer", "configure mixer", "list\r\n\t<name>", cliMixer),
 #endif
@@ -3772,7 +3943,11 @@ const clicmd_t cmdTable[] = {
 #endif
     CLI_COMMAND_DEF("status", "show status", NULL, cliStatus),
 #ifndef SKIP_TASK_STATISTICS
+#ifdef USE_TASK_HISTOGRAM
+    CLI_COMMAND_DEF("tasks", "show task stats", "[histogram]", cliTasks),
+#else
     CLI_COMMAND_DEF("tasks", "show task stats", NULL, cliTasks),
+#endif
 #endif
     CLI_COMMAND_DEF("version", "show version", NULL, cliVersion),
 #ifdef USE_VTX_CONTROL
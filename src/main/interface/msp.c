@@ -71,6 +71,7 @@
 #include "flight/imu.h"
 #include "flight/mixer.h"
 #include "flight/navigation.h"
+#include "flight/ol_flightplan.h"
 #include "flight/pid.h"
 #include "flight/servos.h"
 
@@ -295,13 +296,34 @@ static void serializeDataflashSummaryReply(sbuf_t *dst)
 #endif
 }
 
+static void serializeDataflashStatsReply(sbuf_t *dst)
+{
+#ifdef USE_FLASHFS
+    const flashfsStats_t *stats = flashfsGetStats();
+
+    sbufWriteU8(dst, 1); // FlashFS is supported
+    sbufWriteU32(dst, stats->bytesWritten);
+    sbufWriteU32(dst, stats->pagesProgrammed);
+    sbufWriteU32(dst, stats->busyStalls);
+    sbufWriteU32(dst, stats->bytesDropped);
+    sbufWriteU32(dst, stats->throughput);
+    sbufWriteU16(dst, flashfsGetWriteBufferSize());
+    sbufWriteU16(dst, stats->bufferHighWater);
+#else
+    sbufWriteU8(dst, 0);
+#endif
+}
+
 #ifdef USE_FLASHFS
 enum compressionType_e {
     NO_COMPRESSION,
     HUFFMAN
 };
 
-static void serializeDataflashReadReply(sbuf_t *dst, uint32_t address, const uint16_t size, bool useLegacyFormat, bool allowCompression)
+/*
+ * Reads from address up to endAddress, returns the number of bytes read from the flash (before compression).
+ */
+static uint32_t serializeDataflashReadReply(sbuf_t *dst, uint32_t address, const uint16_t size, uint32_t endAddress, bool useLegacyFormat, bool allowCompression)
 {
     BUILD_BUG_ON(MSP_PORT_DATAFLASH_INFO_SIZE < 16);
 
@@ -310,12 +332,6 @@ static void serializeDataflashReadReply(sbuf_t *dst, uint32_t address, const uin
     if (readLen > bytesRemainingInBuf) {
         readLen = bytesRemainingInBuf;
     }
-    // size will be lower than that requested if we reach end of volume
-    const uint32_t flashfsSize = flashfsGetSize();
-    if (readLen > flashfsSize - address) {
-        // truncate the request
-        readLen = flashfsSize - address;
-    }
     sbufWriteU32(dst, address);
 
     // legacy format does not support compression
@@ -327,6 +343,14 @@ static void serializeDataflashReadReply(sbuf_t *dst, uint32_t address, const uin
 #endif
 
     if (compressionMethod == NO_COMPRESSION) {
+        // size will be lower than that requested if we reach end of volume
+        if (address >= endAddress) {
+            readLen = 0;
+        } else if (readLen > endAddress - address) {
+            // truncate the request
+            readLen = endAddress - address;
+        }
+
         if (!useLegacyFormat) {
             // new format supports variable read lengths
             sbufWriteU16(dst, readLen);
@@ -343,6 +367,8 @@ static void serializeDataflashReadReply(sbuf_t *dst, uint32_t address, const uin
                 sbufWriteU8(dst, 0);
             }
         }
+
+        return bytesRead;
     } else {
 #ifdef USE_HUFFMAN
         // compress in 256-byte chunks
@@ -359,9 +385,9 @@ static void serializeDataflashReadReply(sbuf_t *dst, uint32_t address, const uin
 
         uint16_t bytesReadTotal = 0;
         // read until output buffer overflows or flash is exhausted
-        while (state.bytesWritten < state.outBufLen && address + bytesReadTotal < flashfsSize) {
+        while (state.bytesWritten < state.outBufLen && address + bytesReadTotal < endAddress) {
             const int bytesRead = flashfsReadAbs(address + bytesReadTotal, readBuffer,
-                MIN(sizeof(readBuffer), flashfsSize - address - bytesReadTotal));
+                MIN(sizeof(readBuffer), endAddress - address - bytesReadTotal));
 
             const int status = huffmanEncodeBufStreaming(&state, readBuffer, bytesRead, huffmanTable);
             if (status == -1) {
@@ -382,6 +408,10 @@ static void serializeDataflashReadReply(sbuf_t *dst, uint32_t address, const uin
         // payload
         sbufWriteU16(dst, bytesReadTotal);
         sbufAdvance(dst, state.bytesWritten);
+
+        return bytesReadTotal;
+#else
+        return 0;
 #endif
     }
 }
@@ -938,6 +968,19 @@ static bool mspProcessOutCommand(uint8_t cmdMSP, sbuf_t *dst)
         }
         break;
 
+    case MSP_OL_FLIGHTPLAN:
+        sbufWriteU8(dst, OL_FLIGHTPLAN_MAX_GATES);
+        for (int i = 0; i < OL_FLIGHTPLAN_MAX_GATES; i++) {
+            const olGate_t *gate = olGates(i);
+            sbufWriteU16(dst, gate->x);
+            sbufWriteU16(dst, gate->y);
+            sbufWriteU16(dst, gate->alt);
+            sbufWriteU16(dst, gate->psi);
+            sbufWriteU16(dst, gate->speed);
+            sbufWriteU16(dst, gate->pass_dist);
+        }
+        break;
+
     case MSP_MOTOR_CONFIG:
         sbufWriteU16(dst, motorConfig()->minthrottle);
         sbufWriteU16(dst, motorConfig()->maxthrottle);
@@ -1117,6 +1160,10 @@ static bool mspProcessOutCommand(uint8_t cmdMSP, sbuf_t *dst)
         serializeDataflashSummaryReply(dst);
         break;
 
+    case MSP_DATAFLASH_STATS:
+        serializeDataflashStatsReply(dst);
+        break;
+
     case MSP_BLACKBOX_CONFIG:
 #ifdef USE_BLACKBOX
         sbufWriteU8(dst, 1); //Blackbox supported
@@ -1279,6 +1326,31 @@ static mspResult_e mspFcProcessOutCommandWithArg(uint8_t cmdMSP, sbuf_t *arg, sb
             serializeBoxReply(dst, page, &serializeBoxPermanentIdFn);
         }
         break;
+#ifdef USE_TASK_HISTOGRAM
+    case MSP_TASK_HISTOGRAM:
+        {
+            const uint8_t taskId = sbufBytesRemaining(arg) ? sbufReadU8(arg) : TASK_GYROPID;
+            if (taskId >= TASK_COUNT) {
+                return MSP_RESULT_ERROR;
+            }
+            cfTaskHistogram_t histogram;
+            getTaskHistogram(taskId, &histogram);
+            cfDeadlineInfo_t deadlineInfo;
+            getGyroPidDeadlineInfo(&deadlineInfo);
+
+            sbufWriteU8(dst, taskId);
+            sbufWriteU8(dst, TASK_HISTOGRAM_BUCKETS);
+            for (int i = 0; i < TASK_HISTOGRAM_BUCKETS; i++) {
+                sbufWriteU32(dst, histogram.executionTime[i]);
+            }
+            for (int i = 0; i < TASK_HISTOGRAM_BUCKETS; i++) {
+                sbufWriteU32(dst, histogram.startLatency[i]);
+            }
+            sbufWriteU32(dst, deadlineInfo.late);
+            sbufWriteU32(dst, deadlineInfo.overrun);
+        }
+        break;
+#endif
     default:
         return MSP_RESULT_CMD_UNKNOWN;
     }
@@ -1328,7 +1400,212 @@ static void mspFcDataFlashReadCommand(sbuf_t *dst, sbuf_t *src)
         useLegacyFormat = true;
     }
 
-    serializeDataflashReadReply(dst, readAddress, readLength, useLegacyFormat, allowCompression);
+    serializeDataflashReadReply(dst, readAddress, readLength, flashfsGetSize(), useLegacyFormat, allowCompression);
+}
+
+/*
+ * Streaming dataflash download: after a start request the FC pushes consecutive MSP_DATAFLASH_STREAM frames on the
+ * port the request came from, each one a MSP_DATAFLASH_READ reply prefixed with a sequence number. Up to `window`
+ * frames are sent ahead of the host's acknowledgement, and the next chunk is read from the flash (and compressed)
+ * while the previous one is being transmitted. A chunk with no data marks the end of the stream.
+ */
+#if MSP_PORT_DATAFLASH_BUFFER_SIZE >= 2048
+#define DATAFLASH_STREAM_CHUNK_MAX          1024
+#else
+#define DATAFLASH_STREAM_CHUNK_MAX          (MSP_PORT_DATAFLASH_BUFFER_SIZE / 2)
+#endif
+#define DATAFLASH_STREAM_CHUNK_MIN          64
+#define DATAFLASH_STREAM_COMPRESSED_MIN     512  // A compressed 256 byte block always fits, smaller chunks go uncompressed
+// U16 sequence number and the MSP_DATAFLASH_READ reply header
+#define DATAFLASH_STREAM_FRAME_OVERHEAD     (2 + MSP_PORT_DATAFLASH_INFO_SIZE)
+#define DATAFLASH_STREAM_WINDOW_MAX         8
+#define DATAFLASH_STREAM_CHUNK_SLOTS        16   // Power of two above the window, the chunk read ahead needs a slot too
+#define DATAFLASH_STREAM_RESEND_TIMEOUT_MS  500  // Resend the frames that are not acknowledged after this long
+#define DATAFLASH_STREAM_ABORT_TIMEOUT_MS   5000 // Give up on a host that stopped acknowledging
+
+enum {
+    DATAFLASH_STREAM_START = 0,
+    DATAFLASH_STREAM_ACK = 1,       // All the frames before the sequence number have been received
+    DATAFLASH_STREAM_RESEND = 2,    // Go back to the frame with the sequence number
+    DATAFLASH_STREAM_STOP = 3,
+};
+
+typedef struct dataflashStream_s {
+    struct serialPort_s *port;
+    uint32_t address;               // Start of the next chunk to be read
+    uint32_t endAddress;
+    uint16_t chunkSize;
+    uint8_t window;
+    bool allowCompression;
+    bool chunkReady;                // The chunk with sequence nextSeq has been read ahead
+    bool endQueued;                 // The empty chunk that ends the stream has been read ahead or sent
+    uint16_t nextSeq;
+    uint16_t ackSeq;
+    uint16_t endSeq;
+    timeMs_t lastAckMs;
+    timeMs_t lastRewindMs;
+    uint32_t chunkAddress[DATAFLASH_STREAM_CHUNK_SLOTS]; // Of the frames that have not been acknowledged
+    uint16_t chunkLen;
+    uint8_t chunk[DATAFLASH_STREAM_FRAME_OVERHEAD + DATAFLASH_STREAM_CHUNK_MAX];
+} dataflashStream_t;
+
+static dataflashStream_t dataflashStream;
+
+static void dataflashStreamEnd(void)
+{
+    if (dataflashStream.port) {
+        mspSerialSetStream(dataflashStream.port, NULL);
+    }
+    dataflashStream.port = NULL;
+}
+
+static void dataflashStreamReadChunk(void)
+{
+    dataflashStream_t *stream = &dataflashStream;
+    sbuf_t buf = { .ptr = stream->chunk, .end = ARRAYEND(stream->chunk) };
+
+    stream->chunkAddress[stream->nextSeq % DATAFLASH_STREAM_CHUNK_SLOTS] = stream->address;
+
+    const bool end = stream->address >= stream->endAddress;
+    if (end) {
+        stream->endQueued = true;
+        stream->endSeq = stream->nextSeq;
+    }
+
+    sbufWriteU16(&buf, stream->nextSeq);
+    stream->address += serializeDataflashReadReply(&buf, stream->address, stream->chunkSize, stream->endAddress, false, stream->allowCompression && !end);
+    stream->chunkLen = buf.ptr - stream->chunk;
+    stream->chunkReady = true;
+}
+
+static void dataflashStreamRewind(uint16_t seq)
+{
+    dataflashStream_t *stream = &dataflashStream;
+
+    if (seq == stream->nextSeq) {
+        return; // Nothing has been sent from there yet
+    }
+    stream->address = stream->chunkAddress[seq % DATAFLASH_STREAM_CHUNK_SLOTS];
+    stream->nextSeq = seq;
+    stream->chunkReady = false;
+    stream->endQueued = false;
+}
+
+static bool mspDataflashStreamFn(mspPacket_t *packet)
+{
+    dataflashStream_t *stream = &dataflashStream;
+    const timeMs_t now = millis();
+
+    if (ARMING_FLAG(ARMED) || now - stream->lastAckMs > DATAFLASH_STREAM_ABORT_TIMEOUT_MS) {
+        dataflashStreamEnd();
+        return false;
+    }
+
+    if (stream->nextSeq != stream->ackSeq && now - stream->lastRewindMs > DATAFLASH_STREAM_RESEND_TIMEOUT_MS) {
+        // Lost frames or a lost acknowledgement, go back to the oldest frame the host hasn't acknowledged
+        dataflashStreamRewind(stream->ackSeq);
+        stream->lastRewindMs = now;
+    }
+
+    if (!stream->chunkReady) {
+        if (stream->endQueued) {
+            return false; // Waiting for the end of the stream to be acknowledged
+        }
+        dataflashStreamReadChunk();
+    }
+
+    if ((uint16_t)(stream->nextSeq - stream->ackSeq) >= stream->window || sbufBytesRemaining(&packet->buf) < stream->chunkLen) {
+        return false;
+    }
+
+    packet->cmd = MSP_DATAFLASH_STREAM;
+    sbufWriteData(&packet->buf, stream->chunk, stream->chunkLen);
+    stream->nextSeq++;
+    stream->chunkReady = false;
+
+    // The next chunk is read on the next call, after this one has been handed to the port
+    return true;
+}
+
+static void mspDataflashStreamBindPort(struct serialPort_s *port)
+{
+    dataflashStream.port = port;
+    mspSerialSetStream(port, mspDataflashStreamFn);
+}
+
+static mspResult_e mspFcDataflashStreamCommand(struct serialPort_s *srcPort, sbuf_t *dst, sbuf_t *src, mspPostProcessFnPtr *mspPostProcessFn)
+{
+    dataflashStream_t *stream = &dataflashStream;
+    const uint8_t op = sbufBytesRemaining(src) ? sbufReadU8(src) : DATAFLASH_STREAM_STOP;
+
+    switch (op) {
+    case DATAFLASH_STREAM_START:
+        {
+            // Frames are only sent whole, so the chunks have to fit in the transmit buffer of the port
+            const int payloadMax = srcPort ? mspSerialStreamPayloadMax(srcPort) : 0;
+            if (ARMING_FLAG(ARMED) || sbufBytesRemaining(src) < 12 || payloadMax < DATAFLASH_STREAM_FRAME_OVERHEAD + DATAFLASH_STREAM_CHUNK_MIN) {
+                return MSP_RESULT_ERROR;
+            }
+            dataflashStreamEnd();
+
+            const uint32_t address = sbufReadU32(src);
+            const uint32_t length = sbufReadU32(src);
+            const uint16_t chunkSize = sbufReadU16(src);
+            const uint8_t window = sbufReadU8(src);
+            const bool allowCompression = sbufReadU8(src);
+
+            // Everything logged so far by default
+            const uint32_t usedSize = flashfsGetOffset();
+            stream->address = MIN(address, usedSize);
+            stream->endAddress = (length == 0 || length > usedSize - stream->address) ? usedSize : stream->address + length;
+            stream->chunkSize = constrain(chunkSize, DATAFLASH_STREAM_CHUNK_MIN, MIN(DATAFLASH_STREAM_CHUNK_MAX, payloadMax - DATAFLASH_STREAM_FRAME_OVERHEAD));
+            stream->window = constrain(window, 1, DATAFLASH_STREAM_WINDOW_MAX);
+            stream->allowCompression = allowCompression && stream->chunkSize >= DATAFLASH_STREAM_COMPRESSED_MIN;
+            stream->nextSeq = 0;
+            stream->ackSeq = 0;
+            stream->chunkReady = false;
+            stream->endQueued = false;
+            stream->lastAckMs = millis();
+            stream->lastRewindMs = stream->lastAckMs;
+
+            sbufWriteU32(dst, stream->address);
+            sbufWriteU32(dst, stream->endAddress);
+            sbufWriteU16(dst, stream->chunkSize);
+            sbufWriteU8(dst, stream->window);
+
+            // The stream starts once the reply has been sent
+            *mspPostProcessFn = mspDataflashStreamBindPort;
+        }
+        return MSP_RESULT_ACK;
+
+    case DATAFLASH_STREAM_ACK:
+    case DATAFLASH_STREAM_RESEND:
+        {
+            if (!stream->port || sbufBytesRemaining(src) < 2) {
+                return MSP_RESULT_ERROR;
+            }
+            const uint16_t seq = sbufReadU16(src);
+            if ((uint16_t)(seq - stream->ackSeq) > (uint16_t)(stream->nextSeq - stream->ackSeq)) {
+                return MSP_RESULT_NO_REPLY; // Stale or from the future
+            }
+            stream->ackSeq = seq;
+            stream->lastAckMs = millis();
+            stream->lastRewindMs = stream->lastAckMs;
+
+            if (stream->endQueued && seq == (uint16_t)(stream->endSeq + 1)) {
+                dataflashStreamEnd(); // The host has everything
+            } else if (op == DATAFLASH_STREAM_RESEND) {
+                dataflashStreamRewind(seq);
+            }
+        }
+        // Acknowledgements aren't answered so as not to take bandwidth from the stream
+        return MSP_RESULT_NO_REPLY;
+
+    case DATAFLASH_STREAM_STOP:
+    default:
+        dataflashStreamEnd();
+        return MSP_RESULT_ACK;
+    }
 }
 #endif
 
@@ -1484,6 +1761,25 @@ static mspResult_e mspProcessInCommand(uint8_t cmdMSP, sbuf_t *src)
         }
         break;
 
+    case MSP_SET_OL_FLIGHTPLAN_GATE:
+        if (sbufBytesRemaining(src) < 13) {
+            return MSP_RESULT_ERROR;
+        }
+        i = sbufReadU8(src);
+        if (i >= OL_FLIGHTPLAN_MAX_GATES || ARMING_FLAG(ARMED)) {
+            return MSP_RESULT_ERROR;
+        } else {
+            olGate_t *gate = olGatesMutable(i);
+            gate->x = sbufReadU16(src);
+            gate->y = sbufReadU16(src);
+            gate->alt = sbufReadU16(src);
+            gate->psi = constrain((int16_t)sbufReadU16(src), -360, 360);
+            gate->speed = MIN(sbufReadU16(src), OL_FLIGHTPLAN_MAX_SPEED);
+            gate->pass_dist = MIN(sbufReadU16(src), OL_FLIGHTPLAN_MAX_PASS_DIST);
+            ol_flightplan_load();
+        }
+        break;
+
     case MSP_SET_RC_TUNING:
         if (sbufBytesRemaining(src) >= 10) {
             value = sbufReadU8(src);
@@ -2247,8 +2543,9 @@ static mspResult_e mspCommonProcessInCommand(uint8_t cmdMSP, sbuf_t *src)
 /*
  * Returns MSP_RESULT_ACK, MSP_RESULT_ERROR or MSP_RESULT_NO_REPLY
  */
-mspResult_e mspFcProcessCommand(mspPacket_t *cmd, mspPacket_t *reply, mspPostProcessFnPtr *mspPostProcessFn)
+mspResult_e mspFcProcessCommand(struct serialPort_s *srcPort, mspPacket_t *cmd, mspPacket_t *reply, mspPostProcessFnPtr *mspPostProcessFn)
 {
+    UNUSED(srcPort); // potentially unused depending on compile options.
     int ret = MSP_RESULT_ACK;
     sbuf_t *dst = &reply->buf;
     sbuf_t *src = &cmd->buf;
@@ -2278,6 +2575,8 @@ mspResult_e mspFcProcessCommand(mspPacket_t *cmd, mspPacket_t *reply, mspPostPro
     } else if (cmdMSP == MSP_DATAFLASH_READ) {
         mspFcDataFlashReadCommand(dst, src);
         ret = MSP_RESULT_ACK;
+    } else if (cmdMSP == MSP_DATAFLASH_STREAM) {
+        ret = mspFcDataflashStreamCommand(srcPort, dst, src, mspPostProcessFn);
 #endif
     } else {
         ret = mspCommonProcessInCommand(cmdMSP, src);
@@ -233,6 +233,12 @@
 #define MSP_SET_TX_INFO                 186 // in message           Used to send runtime information from TX lua scripts to the firmware
 #define MSP_TX_INFO                     187 // out message          Used by TX lua scripts to read information from the firmware
 
+#define MSP_OL_FLIGHTPLAN               188 // out message          Gates of the autonomous flightplan
+#define MSP_SET_OL_FLIGHTPLAN_GATE      189 // in message           Sets a single flightplan gate, rejected while armed
+#define MSP_TASK_HISTOGRAM              190 // out message          Execution time and start latency histograms of a task, PID deadline misses
+#define MSP_DATAFLASH_STATS             191 // out message          Dataflash write throughput, program stalls and dropped bytes
+#define MSP_DATAFLASH_STREAM            192 // in/out message       Starts, acknowledges and stops a streaming dataflash download, the chunks are pushed with this command
+
 //
 // Multwii original MSP commands
 //
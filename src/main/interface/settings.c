@@ -47,7 +47,9 @@
 #include "flight/imu.h"
 #include "flight/mixer.h"
 #include "flight/navigation.h"
+#include "flight/ol_navigation.h"
 #include "flight/pid.h"
+#include "flight/rpm_filter.h"
 #include "flight/servos.h"
 
 #include "interface/settings.h"
@@ -86,6 +88,7 @@
 #include "sensors/compass.h"
 #include "sensors/esc_sensor.h"
 #include "sensors/gyro.h"
+#include "sensors/gyroanalyse.h"
 #include "sensors/rangefinder.h"
 
 #include "telemetry/frsky_hub.h"
@@ -121,7 +124,7 @@ const char * const lookupTableMagHardware[] = {
 #endif
 #if defined(USE_SENSOR_NAMES) || defined(USE_RANGEFINDER)
 const char * const lookupTableRangefinderHardware[] = {
-    "NONE", "HCSR04", "TFMINI", "TF02"
+    "NONE", "HCSR04", "TFMINI", "TF02", "SRF10", "HCSR04I2C", "VL53L0X", "UIB", "FAKE"
 };
 #endif
 
@@ -270,6 +273,12 @@ static const char * const lookupTableGyroOverflowCheck[] = {
 };
 #endif
 
+#ifdef USE_GYRO_DATA_ANALYSE
+static const char * const lookupTableDynFftPeakMode[] = {
+    "MEAN", "PARABOLIC", "GAUSSIAN"
+};
+#endif
+
 static const char * const lookupTableRatesType[] = {
     "BETAFLIGHT", "RACEFLIGHT"
 };
@@ -285,6 +294,10 @@ static const char * const lookupOverclock[] = {
 };
 #endif
 
+static const char * const lookupTableSchedulerMode[] = {
+    "QUEUE", "HEAP"
+};
+
 const lookupTableEntry_t lookupTables[] = {
     { lookupTableOffOn, sizeof(lookupTableOffOn) / sizeof(char *) },
     { lookupTableUnit, sizeof(lookupTableUnit) / sizeof(char *) },
@@ -335,11 +348,15 @@ const lookupTableEntry_t lookupTables[] = {
 #endif
 #ifdef USE_GYRO_OVERFLOW_CHECK
     { lookupTableGyroOverflowCheck, sizeof(lookupTableGyroOverflowCheck) / sizeof(char *) },
+#endif
+#ifdef USE_GYRO_DATA_ANALYSE
+    { lookupTableDynFftPeakMode, sizeof(lookupTableDynFftPeakMode) / sizeof(char *) },
 #endif
     { lookupTableRatesType, sizeof(lookupTableRatesType) / sizeof(char *) },
 #ifdef USE_OVERCLOCK
     { lookupOverclock, sizeof(lookupOverclock) / sizeof(char *) },
 #endif
+    { lookupTableSchedulerMode, sizeof(lookupTableSchedulerMode) / sizeof(char *) },
 };
 
 const clivalue_t valueTable[] = {
@@ -368,6 +385,12 @@ const clivalue_t valueTable[] = {
 #ifdef USE_GYRO_OVERFLOW_CHECK
     { "gyro_overflow_detect",       VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_GYRO_OVERFLOW_CHECK }, PG_GYRO_CONFIG, offsetof(gyroConfig_t, checkOverflow) },
 #endif
+#ifdef USE_GYRO_DATA_ANALYSE
+    { "dyn_fft_window",             VAR_UINT16 | MASTER_VALUE, .config.minmax = { 32, GYRO_FFT_WINDOW_SIZE_MAX }, PG_GYRO_CONFIG, offsetof(gyroConfig_t, dyn_fft_window) },
+    { "dyn_fft_sample_hz",          VAR_UINT16 | MASTER_VALUE, .config.minmax = { 250, 4000 }, PG_GYRO_CONFIG, offsetof(gyroConfig_t, dyn_fft_sample_hz) },
+    { "dyn_fft_peak_mode",          VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_DYN_FFT_PEAK_MODE }, PG_GYRO_CONFIG, offsetof(gyroConfig_t, dyn_fft_peak_mode) },
+    { "dyn_notch_count",            VAR_UINT8  | MASTER_VALUE, .config.minmax = { 1, DYN_NOTCH_COUNT_MAX }, PG_GYRO_CONFIG, offsetof(gyroConfig_t, dyn_notch_count) },
+#endif
 #if defined(GYRO_USES_SPI)
 #if defined(USE_GYRO_SPI_MPU6500) || defined(USE_GYRO_SPI_MPU9250) || defined(USE_GYRO_SPI_ICM20689)
     { "gyro_use_32khz",             VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, PG_GYRO_CONFIG, offsetof(gyroConfig_t, gyro_use_32khz) },
@@ -377,6 +400,15 @@ const clivalue_t valueTable[] = {
     { "gyro_to_use",                VAR_UINT8  | MASTER_VALUE, .config.minmax = { 0, 1 }, PG_GYRO_CONFIG, offsetof(gyroConfig_t, gyro_to_use) },
 #endif
 
+// PG_RPM_FILTER_CONFIG
+#ifdef USE_RPM_FILTER
+    { "gyro_rpm_notch_harmonics",   VAR_UINT8  | MASTER_VALUE, .config.minmax = { 0, RPM_FILTER_HARMONICS_MAX }, PG_RPM_FILTER_CONFIG, offsetof(rpmFilterConfig_t, gyro_rpm_notch_harmonics) },
+    { "gyro_rpm_notch_q",           VAR_UINT16 | MASTER_VALUE, .config.minmax = { 250, 3000 }, PG_RPM_FILTER_CONFIG, offsetof(rpmFilterConfig_t, gyro_rpm_notch_q) },
+    { "gyro_rpm_notch_min",         VAR_UINT8  | MASTER_VALUE, .config.minmax = { 50, 200 }, PG_RPM_FILTER_CONFIG, offsetof(rpmFilterConfig_t, gyro_rpm_notch_min) },
+    { "rpm_notch_lpf",              VAR_UINT8  | MASTER_VALUE, .config.minmax = { 100, 250 }, PG_RPM_FILTER_CONFIG, offsetof(rpmFilterConfig_t, rpm_notch_lpf) },
+    { "motor_poles",                VAR_UINT8  | MASTER_VALUE, .config.minmax = { 4, 255 }, PG_RPM_FILTER_CONFIG, offsetof(rpmFilterConfig_t, motor_poles) },
+#endif
+
 // PG_ACCELEROMETER_CONFIG
     { "align_acc",                  VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_ALIGNMENT }, PG_ACCELEROMETER_CONFIG, offsetof(accelerometerConfig_t, acc_align) },
     { "acc_hardware",               VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_ACC_HARDWARE }, PG_ACCELEROMETER_CONFIG, offsetof(accelerometerConfig_t, acc_hardware) },
@@ -458,6 +490,7 @@ const clivalue_t valueTable[] = {
     { "blackbox_device",            VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_BLACKBOX_DEVICE }, PG_BLACKBOX_CONFIG, offsetof(blackboxConfig_t, device) },
     { "blackbox_record_acc",        VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, PG_BLACKBOX_CONFIG, offsetof(blackboxConfig_t, record_acc) },
     { "blackbox_mode",              VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_BLACKBOX_MODE }, PG_BLACKBOX_CONFIG, offsetof(blackboxConfig_t, mode) },
+    { "blackbox_ol_denom",          VAR_UINT16 | MASTER_VALUE, .config.minmax = { 0, INT16_MAX }, PG_BLACKBOX_CONFIG, offsetof(blackboxConfig_t, ol_denom) },
 #endif
 
 // PG_MOTOR_CONFIG
@@ -581,6 +614,7 @@ const clivalue_t valueTable[] = {
     { "acc_unarmedcal",             VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, PG_IMU_CONFIG, offsetof(imuConfig_t, acc_unarmedcal) },
     { "imu_dcm_kp",                 VAR_UINT16 | MASTER_VALUE, .config.minmax = { 0, 32000 }, PG_IMU_CONFIG, offsetof(imuConfig_t, dcm_kp) },
     { "imu_dcm_ki",                 VAR_UINT16 | MASTER_VALUE, .config.minmax = { 0, 32000 }, PG_IMU_CONFIG, offsetof(imuConfig_t, dcm_ki) },
+    { "imu_gyro_rate_integration",  VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, PG_IMU_CONFIG, offsetof(imuConfig_t, gyro_rate_integration) },
     { "small_angle",                VAR_UINT8  | MASTER_VALUE, .config.minmax = { 0, 180 }, PG_IMU_CONFIG, offsetof(imuConfig_t, small_angle) },
 
 // PG_ARMING_CONFIG
@@ -610,6 +644,16 @@ const clivalue_t valueTable[] = {
     { "fixedwing_althold_reversed", VAR_INT8   | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, PG_AIRPLANE_CONFIG, offsetof(airplaneConfig_t, fixedwing_althold_reversed) },
 #endif
 
+// PG_ALT_HOLD_CONFIG
+#if defined(USE_ALT_HOLD)
+    { "alt_hold_hover_throttle",    VAR_UINT16 | MASTER_VALUE, .config.minmax = { PWM_RANGE_MIN, PWM_RANGE_MAX }, PG_ALT_HOLD_CONFIG, offsetof(altHoldConfig_t, hover_throttle) },
+    { "alt_hold_hover_learn",       VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, PG_ALT_HOLD_CONFIG, offsetof(altHoldConfig_t, hover_learn) },
+    { "alt_hold_throttle_min",      VAR_UINT16 | MASTER_VALUE, .config.minmax = { PWM_RANGE_MIN, PWM_RANGE_MAX }, PG_ALT_HOLD_CONFIG, offsetof(altHoldConfig_t, throttle_min) },
+    { "alt_hold_throttle_max",      VAR_UINT16 | MASTER_VALUE, .config.minmax = { PWM_RANGE_MIN, PWM_RANGE_MAX }, PG_ALT_HOLD_CONFIG, offsetof(altHoldConfig_t, throttle_max) },
+    { "alt_hold_max_climb_rate",    VAR_UINT16 | MASTER_VALUE, .config.minmax = { 10, 1000 }, PG_ALT_HOLD_CONFIG, offsetof(altHoldConfig_t, max_climb_rate) },
+    { "alt_hold_max_descent_rate",  VAR_UINT16 | MASTER_VALUE, .config.minmax = { 10, 1000 }, PG_ALT_HOLD_CONFIG, offsetof(altHoldConfig_t, max_descent_rate) },
+#endif
+
 // PG_RC_CONTROLS_CONFIG
 #if defined(USE_ALT_HOLD)
     { "alt_hold_deadband",          VAR_UINT8  | MASTER_VALUE, .config.minmax = { 1, 250 }, PG_RC_CONTROLS_CONFIG, offsetof(rcControlsConfig_t, alt_hold_deadband) },
@@ -715,6 +759,11 @@ const clivalue_t valueTable[] = {
     { "report_cell_voltage",        VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, PG_TELEMETRY_CONFIG, offsetof(telemetryConfig_t, report_cell_voltage) },
     { "ibus_sensor",                VAR_UINT8  | MASTER_VALUE | MODE_ARRAY, .config.array.length = IBUS_SENSOR_COUNT, PG_TELEMETRY_CONFIG, offsetof(telemetryConfig_t, flysky_sensors)},
 #endif
+#if defined(USE_TELEMETRY_MAVLINK)
+    { "mavlink_attitude_hz",        VAR_UINT8  | MASTER_VALUE, .config.minmax = { 0, 200 }, PG_TELEMETRY_CONFIG, offsetof(telemetryConfig_t, mavlink_attitude_hz) },
+    { "mavlink_position_hz",        VAR_UINT8  | MASTER_VALUE, .config.minmax = { 0, 200 }, PG_TELEMETRY_CONFIG, offsetof(telemetryConfig_t, mavlink_position_hz) },
+    { "mavlink_odometry_hz",        VAR_UINT8  | MASTER_VALUE, .config.minmax = { 0, 200 }, PG_TELEMETRY_CONFIG, offsetof(telemetryConfig_t, mavlink_odometry_hz) },
+#endif
 #endif // USE_TELEMETRY
 
 // PG_LED_STRIP_CONFIG
@@ -809,6 +858,7 @@ const clivalue_t valueTable[] = {
     { "cpu_overclock",              VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OVERCLOCK }, PG_SYSTEM_CONFIG, offsetof(systemConfig_t, cpu_overclock) },
 #endif
     { "pwr_on_arm_grace",           VAR_UINT8  | MASTER_VALUE, .config.minmax = { 0, 30 }, PG_SYSTEM_CONFIG, offsetof(systemConfig_t, powerOnArmingGraceTime) },
+    { "scheduler_mode",             VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_SCHEDULER_MODE }, PG_SYSTEM_CONFIG, offsetof(systemConfig_t, scheduler_mode) },
 
 // PG_VTX_CONFIG
 #ifdef USE_VTX_COMMON
@@ -884,6 +934,10 @@ const clivalue_t valueTable[] = {
     { "rangefinder_hardware", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_RANGEFINDER_HARDWARE }, PG_RANGEFINDER_CONFIG, offsetof(rangefinderConfig_t, rangefinder_hardware) },
 #endif
 
+// PG_OL_NAVIGATION_CONFIG
+    { "ol_nav_rate_hz", VAR_UINT16 | MASTER_VALUE, .config.minmax = { OL_NAVIGATION_RATE_MIN_HZ, OL_NAVIGATION_RATE_MAX_HZ }, PG_OL_NAVIGATION_CONFIG, offsetof(olNavigationConfig_t, nav_rate_hz) },
+    { "ol_vision_latency_ms", VAR_UINT8 | MASTER_VALUE, .config.minmax = { 0, OL_VISION_LATENCY_MAX_MS }, PG_OL_NAVIGATION_CONFIG, offsetof(olNavigationConfig_t, vision_latency_ms) },
+
 // PG_PINIO_CONFIG
 #ifdef USE_PINIO
     { "pinio_config", VAR_UINT8 | MASTER_VALUE | MODE_ARRAY, .config.array.length = PINIO_COUNT, PG_PINIO_CONFIG, offsetof(pinioConfig_t, config) },
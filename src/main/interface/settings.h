@@ -72,11 +72,15 @@ typedef enum {
 #endif
 #ifdef USE_GYRO_OVERFLOW_CHECK
     TABLE_GYRO_OVERFLOW_CHECK,
+#endif
+#ifdef USE_GYRO_DATA_ANALYSE
+    TABLE_DYN_FFT_PEAK_MODE,
 #endif
     TABLE_RATES_TYPE,
 #ifdef USE_OVERCLOCK
     TABLE_OVERCLOCK,
 #endif
+    TABLE_SCHEDULER_MODE,
     LOOKUP_TABLE_COUNT
 } lookupTableIndex_e;
 
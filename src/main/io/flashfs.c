@@ -33,11 +33,22 @@
 #include <stdbool.h>
 #include <string.h>
 
+#include "platform.h"
+
 #include "drivers/flash.h"
 #include "drivers/flash_m25p16.h"
+#include "drivers/time.h"
 
 #include "io/flashfs.h"
 
+// The window over which the programming throughput is measured
+#define FLASHFS_THROUGHPUT_WINDOW_MS 1000
+
+typedef struct flashfsIovec_s {
+    const uint8_t *base;
+    uint32_t len;
+} flashfsIovec_t;
+
 static uint8_t flashWriteBuffer[FLASHFS_WRITE_BUFFER_SIZE];
 
 /* The position of our head and tail in the circular flash write buffer.
@@ -47,11 +58,15 @@ static uint8_t flashWriteBuffer[FLASHFS_WRITE_BUFFER_SIZE];
  *
  * When the circular buffer is empty, head == tail
  */
-static uint8_t bufferHead = 0, bufferTail = 0;
+static uint16_t bufferHead = 0, bufferTail = 0;
 
 // The position of the buffer's tail in the overall flash address space:
 static uint32_t tailAddress = 0;
 
+static flashfsStats_t flashfsStats;
+static timeMs_t throughputWindowStartMs;
+static uint32_t throughputWindowStartBytes;
+
 static void flashfsClearBuffer(void)
 {
     bufferTail = bufferHead = 0;
@@ -74,6 +89,8 @@ void flashfsEraseCompletely(void)
     flashfsClearBuffer();
 
     flashfsSetTailAddress(0);
+
+    flashfsResetStats();
 }
 
 /**
@@ -145,36 +162,57 @@ const flashGeometry_t* flashfsGetGeometry(void)
     return m25p16_getGeometry();
 }
 
+static void flashfsCountProgram(uint32_t bytes)
+{
+    flashfsStats.bytesWritten += bytes;
+    flashfsStats.pagesProgrammed++;
+
+    const timeMs_t now = millis();
+    const timeMs_t elapsedMs = now - throughputWindowStartMs;
+    if (elapsedMs >= FLASHFS_THROUGHPUT_WINDOW_MS) {
+        flashfsStats.throughput = (uint64_t)(flashfsStats.bytesWritten - throughputWindowStartBytes) * 1000 / elapsedMs;
+        throughputWindowStartMs = now;
+        throughputWindowStartBytes = flashfsStats.bytesWritten;
+    }
+}
+
 /**
  * Write the given buffers to flash sequentially at the current tail address, advancing the tail address after
- * each write.
+ * each write. Each page is programmed with a single program operation gathered from as many buffers as it spans.
  *
  * In synchronous mode, waits for the flash to become ready before writing so that every byte requested can be written.
  *
  * In asynchronous mode, if the flash is busy, then the write is aborted and the routine returns immediately.
+ * Otherwise at most one page is programmed, the flash will be busy with it until the next call.
  * In this case the returned number of bytes written will be less than the total amount requested.
  *
- * Modifies the supplied buffer pointers and sizes to reflect how many bytes remain in each of them.
+ * Modifies the supplied buffers to reflect how many bytes remain in each of them.
  *
- * bufferCount: the number of buffers provided
- * buffers: an array of pointers to the beginning of buffers
- * bufferSizes: an array of the sizes of those buffers
+ * iov: the buffers to write
+ * iovCount: the number of buffers provided
  * sync: true if we should wait for the device to be idle before writes, otherwise if the device is busy the
  *       write will be aborted and this routine will return immediately.
+ * partialPage: false to only program pages up to their end, leaving the start of the next page buffered until the
+ *       page fills up. Programming a page takes the flash about as long whether it is full or not.
  *
  * Returns the number of bytes written
  */
-static uint32_t flashfsWriteBuffers(uint8_t const **buffers, uint32_t *bufferSizes, int bufferCount, bool sync)
+static uint32_t flashfsWriteBuffers(flashfsIovec_t *iov, int iovCount, bool sync, bool partialPage)
 {
     uint32_t bytesTotal = 0;
 
-    int i;
+    for (int i = 0; i < iovCount; i++) {
+        bytesTotal += iov[i].len;
+    }
 
-    for (i = 0; i < bufferCount; i++) {
-        bytesTotal += bufferSizes[i];
+    if (!partialPage && tailAddress % M25P16_PAGESIZE + bytesTotal < M25P16_PAGESIZE) {
+        return 0; // The page isn't full yet
     }
 
     if (!sync && !m25p16_isReady()) {
+        if (tailAddress % M25P16_PAGESIZE + bytesTotal >= M25P16_PAGESIZE) {
+            flashfsStats.busyStalls++;
+        }
         return 0;
     }
 
@@ -188,10 +226,12 @@ static uint32_t flashfsWriteBuffers(uint8_t const **buffers, uint32_t *bufferSiz
          * Each page needs to be saved in a separate program operation, so
          * if we would cross a page boundary, only write up to the boundary in this iteration:
          */
-        if (tailAddress % M25P16_PAGESIZE + bytesTotalRemaining > M25P16_PAGESIZE) {
+        if (tailAddress % M25P16_PAGESIZE + bytesTotalRemaining >= M25P16_PAGESIZE) {
             bytesTotalThisIteration = M25P16_PAGESIZE - tailAddress % M25P16_PAGESIZE;
-        } else {
+        } else if (partialPage) {
             bytesTotalThisIteration = bytesTotalRemaining;
+        } else {
+            break;
         }
 
         // Are we at EOF already? Abort.
@@ -206,31 +246,33 @@ static uint32_t flashfsWriteBuffers(uint8_t const **buffers, uint32_t *bufferSiz
 
         bytesRemainThisIteration = bytesTotalThisIteration;
 
-        for (i = 0; i < bufferCount; i++) {
-            if (bufferSizes[i] > 0) {
+        for (int i = 0; i < iovCount; i++) {
+            if (iov[i].len > 0) {
                 // Is buffer larger than our write limit? Write our limit out of it
-                if (bufferSizes[i] >= bytesRemainThisIteration) {
-                    m25p16_pageProgramContinue(buffers[i], bytesRemainThisIteration);
+                if (iov[i].len >= bytesRemainThisIteration) {
+                    m25p16_pageProgramContinue(iov[i].base, bytesRemainThisIteration);
 
-                    buffers[i] += bytesRemainThisIteration;
-                    bufferSizes[i] -= bytesRemainThisIteration;
+                    iov[i].base += bytesRemainThisIteration;
+                    iov[i].len -= bytesRemainThisIteration;
 
                     bytesRemainThisIteration = 0;
                     break;
                 } else {
                     // We'll still have more to write after finishing this buffer off
-                    m25p16_pageProgramContinue(buffers[i], bufferSizes[i]);
+                    m25p16_pageProgramContinue(iov[i].base, iov[i].len);
 
-                    bytesRemainThisIteration -= bufferSizes[i];
+                    bytesRemainThisIteration -= iov[i].len;
 
-                    buffers[i] += bufferSizes[i];
-                    bufferSizes[i] = 0;
+                    iov[i].base += iov[i].len;
+                    iov[i].len = 0;
                 }
             }
         }
 
         m25p16_pageProgramFinish();
 
+        flashfsCountProgram(bytesTotalThisIteration);
+
         bytesTotalRemaining -= bytesTotalThisIteration;
 
         // Advance the cursor in the file system to match the bytes we wrote
@@ -253,17 +295,17 @@ static uint32_t flashfsWriteBuffers(uint8_t const **buffers, uint32_t *bufferSiz
  *
  * This routine will fill the details of those buffers into the provided arrays, which must be at least 2 elements long.
  */
-static void flashfsGetDirtyDataBuffers(uint8_t const *buffers[], uint32_t bufferSizes[])
+static void flashfsGetDirtyDataBuffers(flashfsIovec_t iov[])
 {
-    buffers[0] = flashWriteBuffer + bufferTail;
-    buffers[1] = flashWriteBuffer + 0;
+    iov[0].base = flashWriteBuffer + bufferTail;
+    iov[1].base = flashWriteBuffer + 0;
 
     if (bufferHead >= bufferTail) {
-        bufferSizes[0] = bufferHead - bufferTail;
-        bufferSizes[1] = 0;
+        iov[0].len = bufferHead - bufferTail;
+        iov[1].len = 0;
     } else {
-        bufferSizes[0] = FLASHFS_WRITE_BUFFER_SIZE - bufferTail;
-        bufferSizes[1] = bufferHead;
+        iov[0].len = FLASHFS_WRITE_BUFFER_SIZE - bufferTail;
+        iov[1].len = bufferHead;
     }
 }
 
@@ -272,14 +314,8 @@ static void flashfsGetDirtyDataBuffers(uint8_t const *buffers[], uint32_t buffer
  */
 uint32_t flashfsGetOffset(void)
 {
-    uint8_t const * buffers[2];
-    uint32_t bufferSizes[2];
-
     // Dirty data in the buffers contributes to the offset
-
-    flashfsGetDirtyDataBuffers(buffers, bufferSizes);
-
-    return tailAddress + bufferSizes[0] + bufferSizes[1];
+    return tailAddress + flashfsTransmitBufferUsed();
 }
 
 /**
@@ -302,21 +338,23 @@ static void flashfsAdvanceTailInBuffer(uint32_t delta)
 /**
  * If the flash is ready to accept writes, flush the buffer to it.
  *
+ * Unless forced only a completely filled page is programmed, the start of the next page stays buffered so that the
+ * flash isn't kept busy programming a few bytes at a time.
+ *
  * Returns true if all data in the buffer has been flushed to the device, or false if
  * there is still data to be written (call flush again later).
  */
-bool flashfsFlushAsync(void)
+bool flashfsFlushAsync(bool force)
 {
     if (flashfsBufferIsEmpty()) {
         return true; // Nothing to flush
     }
 
-    uint8_t const * buffers[2];
-    uint32_t bufferSizes[2];
+    flashfsIovec_t buffers[2];
     uint32_t bytesWritten;
 
-    flashfsGetDirtyDataBuffers(buffers, bufferSizes);
-    bytesWritten = flashfsWriteBuffers(buffers, bufferSizes, 2, false);
+    flashfsGetDirtyDataBuffers(buffers);
+    bytesWritten = flashfsWriteBuffers(buffers, 2, false, force);
     flashfsAdvanceTailInBuffer(bytesWritten);
 
     return flashfsBufferIsEmpty();
@@ -334,11 +372,10 @@ void flashfsFlushSync(void)
         return; // Nothing to flush
     }
 
-    uint8_t const * buffers[2];
-    uint32_t bufferSizes[2];
+    flashfsIovec_t buffers[2];
 
-    flashfsGetDirtyDataBuffers(buffers, bufferSizes);
-    flashfsWriteBuffers(buffers, bufferSizes, 2, true);
+    flashfsGetDirtyDataBuffers(buffers);
+    flashfsWriteBuffers(buffers, 2, true, true);
 
     // We've written our entire buffer now:
     flashfsClearBuffer();
@@ -358,104 +395,124 @@ void flashfsSeekRel(int32_t offset)
     flashfsSetTailAddress(tailAddress + offset);
 }
 
+static void flashfsUpdateHighWater(void)
+{
+    const uint32_t used = flashfsTransmitBufferUsed();
+
+    if (used > flashfsStats.bufferHighWater) {
+        flashfsStats.bufferHighWater = used;
+    }
+}
+
+/**
+ * Copy data into the write buffer, the caller has checked that it fits.
+ */
+static void flashfsBufferAppend(const uint8_t *data, uint32_t len)
+{
+    // First write the portion before we wrap around the end of the circular buffer
+    const uint32_t bufferBytesBeforeWrap = FLASHFS_WRITE_BUFFER_SIZE - bufferHead;
+
+    const uint32_t firstPortion = len < bufferBytesBeforeWrap ? len : bufferBytesBeforeWrap;
+
+    memcpy(flashWriteBuffer + bufferHead, data, firstPortion);
+
+    bufferHead += firstPortion;
+
+    data += firstPortion;
+    len -= firstPortion;
+
+    // If we wrap the head around, write the remainder to the start of the buffer (if any)
+    if (bufferHead == FLASHFS_WRITE_BUFFER_SIZE) {
+        memcpy(flashWriteBuffer + 0, data, len);
+
+        bufferHead = len;
+    }
+}
+
 /**
  * Write the given byte asynchronously to the flash. If the buffer overflows, data is silently discarded.
  */
 void flashfsWriteByte(uint8_t byte)
 {
+    if (flashfsTransmitBufferUsed() >= FLASHFS_WRITE_BUFFER_USABLE) {
+        // Try to make room before giving up on the byte
+        flashfsFlushAsync(false);
+
+        if (flashfsTransmitBufferUsed() >= FLASHFS_WRITE_BUFFER_USABLE) {
+            flashfsStats.bytesDropped++;
+            return;
+        }
+    }
+
     flashWriteBuffer[bufferHead++] = byte;
 
     if (bufferHead >= FLASHFS_WRITE_BUFFER_SIZE) {
         bufferHead = 0;
     }
 
-    if (flashfsTransmitBufferUsed() >= FLASHFS_WRITE_BUFFER_AUTO_FLUSH_LEN) {
-        flashfsFlushAsync();
-    }
+    flashfsUpdateHighWater();
+
+    // Program the page as soon as the byte completes it
+    flashfsFlushAsync(false);
 }
 
 /**
  * Write the given buffer to the flash either synchronously or asynchronously depending on the 'sync' parameter.
  *
- * If writing asynchronously, data will be silently discarded if the buffer overflows.
+ * Whole pages are programmed straight from the supplied buffer, so callers such as the blackbox frame encoder can
+ * hand over a frame without it being copied into the write buffer first.
+ *
+ * If writing asynchronously, data will be discarded (and counted in the stats) if the buffer overflows.
  * If writing synchronously, the routine will block waiting for the flash to become ready so will never drop data.
  */
 void flashfsWrite(const uint8_t *data, unsigned int len, bool sync)
 {
-    uint8_t const * buffers[3];
-    uint32_t bufferSizes[3];
+    flashfsIovec_t buffers[3];
 
     // There could be two dirty buffers to write out already:
-    flashfsGetDirtyDataBuffers(buffers, bufferSizes);
+    flashfsGetDirtyDataBuffers(buffers);
 
     // Plus the buffer the user supplied:
-    buffers[2] = data;
-    bufferSizes[2] = len;
+    buffers[2].base = data;
+    buffers[2].len = len;
+
+    const uint32_t bytesBuffered = buffers[0].len + buffers[1].len;
 
     /*
-     * Would writing this data to our buffer cause our buffer to reach the flush threshold? If so try to write through
-     * to the flash now
+     * If this data completes a page, program it straight from the write buffer and the user's buffer so that only
+     * the start of the next page is copied.
      */
-    if (bufferSizes[0] + bufferSizes[1] + bufferSizes[2] >= FLASHFS_WRITE_BUFFER_AUTO_FLUSH_LEN) {
-        uint32_t bytesWritten;
+    const uint32_t bytesWritten = flashfsWriteBuffers(buffers, 3, false, false);
 
-        // Attempt to write all three buffers through to the flash asynchronously
-        bytesWritten = flashfsWriteBuffers(buffers, bufferSizes, 3, false);
+    if (bytesWritten >= bytesBuffered) {
+        // We wrote all the data that was previously buffered
+        flashfsClearBuffer();
+    } else {
+        // We only wrote a portion of the old data, so advance the tail to remove the bytes we did write from the buffer
+        flashfsAdvanceTailInBuffer(bytesWritten);
+    }
 
-        if (bufferSizes[0] == 0 && bufferSizes[1] == 0) {
-            // We wrote all the data that was previously buffered
+    // Is the remainder of the data to be written too big to fit in the buffers?
+    if (buffers[2].len > flashfsGetWriteBufferFreeSpace()) {
+        if (sync) {
+            // Write it through synchronously
+            flashfsWriteBuffers(buffers, 3, true, true);
             flashfsClearBuffer();
-
-            if (bufferSizes[2] == 0) {
-                // And we wrote all the data the user supplied! Job done!
-                return;
-            }
         } else {
-            // We only wrote a portion of the old data, so advance the tail to remove the bytes we did write from the buffer
-            flashfsAdvanceTailInBuffer(bytesWritten);
-        }
-
-        // Is the remainder of the data to be written too big to fit in the buffers?
-        if (bufferSizes[0] + bufferSizes[1] + bufferSizes[2] > FLASHFS_WRITE_BUFFER_USABLE) {
-            if (sync) {
-                // Write it through synchronously
-                flashfsWriteBuffers(buffers, bufferSizes, 3, true);
-                flashfsClearBuffer();
-            } else {
-                /*
-                 * Silently drop the data the user asked to write (i.e. no-op) since we can't buffer it and they
-                 * requested async.
-                 */
-            }
-
-            return;
+            /*
+             * Drop the data the user asked to write (i.e. no-op) since we can't buffer it and they
+             * requested async.
+             */
+            flashfsStats.bytesDropped += buffers[2].len;
         }
 
-        // Fall through and add the remainder of the incoming data to our buffer
-        data = buffers[2];
-        len = bufferSizes[2];
+        return;
     }
 
-    // Buffer up the data the user supplied instead of writing it right away
-
-    // First write the portion before we wrap around the end of the circular buffer
-    unsigned int bufferBytesBeforeWrap = FLASHFS_WRITE_BUFFER_SIZE - bufferHead;
-
-    unsigned int firstPortion = len < bufferBytesBeforeWrap ? len : bufferBytesBeforeWrap;
-
-    memcpy(flashWriteBuffer + bufferHead, data, firstPortion);
-
-    bufferHead += firstPortion;
-
-    data += firstPortion;
-    len -= firstPortion;
-
-    // If we wrap the head around, write the remainder to the start of the buffer (if any)
-    if (bufferHead == FLASHFS_WRITE_BUFFER_SIZE) {
-        memcpy(flashWriteBuffer + 0, data, len);
+    // Buffer up the rest of the data the user supplied
+    flashfsBufferAppend(buffers[2].base, buffers[2].len);
 
-        bufferHead = len;
-    }
+    flashfsUpdateHighWater();
 }
 
 /**
@@ -558,11 +615,25 @@ bool flashfsIsEOF(void)
     return tailAddress >= flashfsGetSize();
 }
 
+const flashfsStats_t *flashfsGetStats(void)
+{
+    return &flashfsStats;
+}
+
+void flashfsResetStats(void)
+{
+    memset(&flashfsStats, 0, sizeof(flashfsStats));
+    throughputWindowStartMs = millis();
+    throughputWindowStartBytes = 0;
+}
+
 /**
  * Call after initializing the flash chip in order to set up the filesystem.
  */
 void flashfsInit(void)
 {
+    flashfsResetStats();
+
     // If we have a flash chip present at all
     if (flashfsGetSize() > 0) {
         // Start the file pointer off at the beginning of free space so caller can start writing immediately
@@ -17,11 +17,23 @@
 
 #pragma once
 
-#define FLASHFS_WRITE_BUFFER_SIZE 128
+/*
+ * Two pages by default, so that one page can fill up while the previous one is being programmed. Targets with the RAM
+ * to spare can define a larger (power of two) buffer to absorb longer program stalls.
+ */
+#ifndef FLASHFS_WRITE_BUFFER_SIZE
+#define FLASHFS_WRITE_BUFFER_SIZE 512
+#endif
 #define FLASHFS_WRITE_BUFFER_USABLE (FLASHFS_WRITE_BUFFER_SIZE - 1)
 
-// Automatically trigger a flush when this much data is in the buffer
-#define FLASHFS_WRITE_BUFFER_AUTO_FLUSH_LEN 64
+typedef struct flashfsStats_s {
+    uint32_t bytesWritten;      // Bytes programmed to the device
+    uint32_t pagesProgrammed;   // Program operations issued
+    uint32_t busyStalls;        // Times a full page was waiting but the device was still busy with the previous one
+    uint32_t bytesDropped;      // Asynchronous writes discarded because the write buffer was full
+    uint32_t throughput;        // Bytes per second programmed over the last second of writes
+    uint16_t bufferHighWater;   // Most bytes ever waiting in the write buffer
+} flashfsStats_t;
 
 void flashfsEraseCompletely(void);
 void flashfsEraseRange(uint32_t start, uint32_t end);
@@ -42,10 +54,13 @@ void flashfsWrite(const uint8_t *data, unsigned int len, bool sync);
 
 int flashfsReadAbs(uint32_t offset, uint8_t *data, unsigned int len);
 
-bool flashfsFlushAsync(void);
+bool flashfsFlushAsync(bool force);
 void flashfsFlushSync(void);
 
 void flashfsInit(void);
 
 bool flashfsIsReady(void);
 bool flashfsIsEOF(void);
+
+const flashfsStats_t *flashfsGetStats(void);
+void flashfsResetStats(void);
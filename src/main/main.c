@@ -30,8 +30,11 @@ int main(void)
     while (true) {
         scheduler();
         processLoopback();
-#ifdef SIMULATOR_BUILD
+#if defined(SIMULATOR_BUILD) && defined(SIMULATOR_LOCKSTEP)
+        lockstepAdvance(); // advances the virtual clock, blocks at the end of a simulator step
+#elif defined(SIMULATOR_BUILD)
         delayMicroseconds_real(50); // max rate 20kHz
+        simulatorPoll(); // newest simulator state for the next scheduler() pass
 #endif
     }
     return 0;
@@ -23,6 +23,7 @@
 
 #include "build/debug.h"
 
+#include "common/maths.h"
 #include "common/streambuf.h"
 #include "common/utils.h"
 
@@ -37,6 +38,9 @@
 
 static mspPort_t mspPorts[MAX_MSP_PORT_COUNT];
 
+// Replies and stream frames are built here one at a time
+static uint8_t outBuf[MSP_PORT_OUTBUF_SIZE];
+
 static void resetMspPort(mspPort_t *mspPortToReset, serialPort_t *serialPort)
 {
     memset(mspPortToReset, 0, sizeof(mspPort_t));
@@ -167,10 +171,42 @@ static int mspSerialEncode(mspPort_t *msp, mspPacket_t *packet)
     return sizeof(hdr) + len + 1; // header, data, and checksum
 }
 
-static mspPostProcessFnPtr mspSerialProcessReceivedCommand(mspPort_t *msp, mspProcessCommandFnPtr mspProcessCommandFn)
+// Header (with the jumbo frame length) and checksum
+#define MSP_FRAME_OVERHEAD 8
+// Limits the time spent streaming in one call, the stream continues on the next
+#define MSP_STREAM_FRAMES_PER_PROCESS 4
+
+/*
+ * Send the frames of the stream bound to the port for as long as they fit in the transmit buffer, so that the
+ * stream function can prepare the next frame while the previous one is being transmitted.
+ */
+static void mspSerialProcessStream(mspPort_t *msp)
 {
-    static uint8_t outBuf[MSP_PORT_OUTBUF_SIZE];
+    for (int i = 0; i < MSP_STREAM_FRAMES_PER_PROCESS && msp->streamFn; i++) {
+        const uint32_t bytesFree = serialTxBytesFree(msp->port);
+        if (bytesFree <= MSP_FRAME_OVERHEAD) {
+            return;
+        }
+
+        mspPacket_t packet = {
+            .buf = { .ptr = outBuf, .end = outBuf + MIN(sizeof(outBuf), bytesFree - MSP_FRAME_OVERHEAD), },
+            .cmd = -1,
+            .result = 0,
+            .direction = MSP_DIRECTION_REPLY,
+        };
+        uint8_t *outBufHead = packet.buf.ptr;
+
+        if (!msp->streamFn(&packet)) {
+            return;
+        }
+
+        sbufSwitchToReader(&packet.buf, outBufHead);
+        mspSerialEncode(msp, &packet);
+    }
+}
 
+static mspPostProcessFnPtr mspSerialProcessReceivedCommand(mspPort_t *msp, mspProcessCommandFnPtr mspProcessCommandFn)
+{
     mspPacket_t reply = {
         .buf = { .ptr = outBuf, .end = ARRAYEND(outBuf), },
         .cmd = -1,
@@ -187,7 +223,7 @@ static mspPostProcessFnPtr mspSerialProcessReceivedCommand(mspPort_t *msp, mspPr
     };
 
     mspPostProcessFnPtr mspPostProcessFn = NULL;
-    const mspResult_e status = mspProcessCommandFn(&command, &reply, &mspPostProcessFn);
+    const mspResult_e status = mspProcessCommandFn(msp->port, &command, &reply, &mspPostProcessFn);
 
     if (status != MSP_RESULT_NO_REPLY) {
         sbufSwitchToReader(&reply.buf, outBufHead); // change streambuf direction
@@ -299,6 +335,10 @@ void mspSerialProcess(mspEvaluateNonMspData_e evaluateNonMspData, mspProcessComm
         else {
             mspProcessPendingRequest(mspPort);
         }
+
+        if (mspPort->streamFn) {
+            mspSerialProcessStream(mspPort);
+        }
     }
 }
 
@@ -374,3 +414,27 @@ uint32_t mspSerialTxBytesFree(void)
 
     return ret;
 }
+
+/*
+ * Largest stream frame payload the port can take, mspSerialProcessStream() only sends whole frames so a larger one
+ * would never go out. Ports without a transmit buffer of their own (USB VCP) report what is free right now.
+ */
+uint32_t mspSerialStreamPayloadMax(serialPort_t *serialPort)
+{
+    const uint32_t capacity = serialPort->txBufferSize ? serialPort->txBufferSize - 1 : serialTxBytesFree(serialPort);
+    return capacity > MSP_FRAME_OVERHEAD ? MIN(capacity - MSP_FRAME_OVERHEAD, sizeof(outBuf)) : 0;
+}
+
+/*
+ * Bind a stream to the MSP port using the given serial port, the stream function is then called from
+ * mspSerialProcess() whenever the port can take another frame. A null function ends the stream.
+ */
+void mspSerialSetStream(serialPort_t *serialPort, mspStreamFnPtr streamFn)
+{
+    for (int portIndex = 0; portIndex < MAX_MSP_PORT_COUNT; portIndex++) {
+        mspPort_t * const mspPort = &mspPorts[portIndex];
+        if (mspPort->port == serialPort) {
+            mspPort->streamFn = streamFn;
+        }
+    }
+}
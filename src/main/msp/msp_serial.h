@@ -73,6 +73,7 @@ typedef struct mspPort_s {
     uint8_t cmdMSP;
     mspState_e c_state;
     mspPacketType_e packetType;
+    mspStreamFnPtr streamFn; // null when no stream is bound to the port
     uint8_t inBuf[MSP_PORT_INBUF_SIZE];
 } mspPort_t;
 
@@ -83,3 +84,5 @@ void mspSerialAllocatePorts(void);
 void mspSerialReleasePortIfAllocated(struct serialPort_s *serialPort);
 int mspSerialPush(uint8_t cmd, uint8_t *data, int datalen, mspDirection_e direction);
 uint32_t mspSerialTxBytesFree(void);
+uint32_t mspSerialStreamPayloadMax(struct serialPort_s *serialPort);
+void mspSerialSetStream(struct serialPort_s *serialPort, mspStreamFnPtr streamFn);
@@ -121,7 +121,11 @@
 #define PG_TRICOPTER_CONFIG 528
 #define PG_PINIO_CONFIG 529
 #define PG_PINIOBOX_CONFIG 530
-#define PG_BETAFLIGHT_END 530
+#define PG_OL_NAVIGATION_CONFIG 531
+#define PG_OL_FLIGHTPLAN 532
+#define PG_ALT_HOLD_CONFIG 533
+#define PG_RPM_FILTER_CONFIG 534
+#define PG_BETAFLIGHT_END 534
 
 
 // OSD configuration (subject to change)
@@ -120,6 +120,130 @@ FAST_CODE cfTask_t *queueNext(void)
     return taskQueueArray[++taskQueuePos]; // guaranteed to be NULL at end of queue
 }
 
+/*
+ * SCHEDULER_MODE_HEAP: tasks that are not ready wait in a min-heap keyed by the time they become due (time driven)
+ * or their checkFunc is polled next (event driven). Due and signalled tasks move to the ready queue, where dynamic
+ * priorities are aged exactly as in SCHEDULER_MODE_QUEUE. A pass costs O(ready + moved * log(tasks)).
+ */
+typedef struct {
+    timeUs_t dueAt;
+    cfTask_t *task;
+} taskHeapEntry_t;
+
+static FAST_RAM schedulerMode_e schedulerMode = SCHEDULER_MODE_QUEUE;
+STATIC_UNIT_TESTED FAST_RAM taskHeapEntry_t taskHeap[TASK_COUNT];
+STATIC_UNIT_TESTED FAST_RAM int taskHeapSize = 0;
+static FAST_RAM cfTask_t *readyQueueArray[TASK_COUNT];  // in taskQueueArray order: staticPriority, then task id
+static FAST_RAM int readyQueueSize = 0;
+static FAST_RAM bool currentTaskDisabled = false;       // disabled itself, do not put it back into the heap
+
+static FAST_CODE void heapSiftUp(int index)
+{
+    const taskHeapEntry_t entry = taskHeap[index];
+    while (index > 0) {
+        const int parent = (index - 1) / 2;
+        if (cmpTimeUs(entry.dueAt, taskHeap[parent].dueAt) >= 0) {
+            break;
+        }
+        taskHeap[index] = taskHeap[parent];
+        index = parent;
+    }
+    taskHeap[index] = entry;
+}
+
+static FAST_CODE void heapSiftDown(int index)
+{
+    const taskHeapEntry_t entry = taskHeap[index];
+    while (true) {
+        int child = 2 * index + 1;
+        if (child >= taskHeapSize) {
+            break;
+        }
+        if (child + 1 < taskHeapSize && cmpTimeUs(taskHeap[child + 1].dueAt, taskHeap[child].dueAt) < 0) {
+            child++;
+        }
+        if (cmpTimeUs(taskHeap[child].dueAt, entry.dueAt) >= 0) {
+            break;
+        }
+        taskHeap[index] = taskHeap[child];
+        index = child;
+    }
+    taskHeap[index] = entry;
+}
+
+static FAST_CODE void heapPush(cfTask_t *task, timeUs_t dueAt)
+{
+    taskHeap[taskHeapSize].dueAt = dueAt;
+    taskHeap[taskHeapSize].task = task;
+    heapSiftUp(taskHeapSize++);
+}
+
+static FAST_CODE cfTask_t *heapPop(void)
+{
+    cfTask_t *task = taskHeap[0].task;
+    taskHeap[0] = taskHeap[--taskHeapSize];
+    heapSiftDown(0);
+    return task;
+}
+
+// Only on enable/disable/reschedule, never on the regular path
+static bool heapRemove(cfTask_t *task)
+{
+    for (int ii = 0; ii < taskHeapSize; ++ii) {
+        if (taskHeap[ii].task == task) {
+            taskHeap[ii] = taskHeap[--taskHeapSize];
+            if (ii < taskHeapSize) {
+                heapSiftUp(ii);
+                heapSiftDown(ii);
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+static FAST_CODE void readyQueueAdd(cfTask_t *task)
+{
+    int ii = readyQueueSize++;
+    for (; ii > 0; --ii) {
+        const cfTask_t *other = readyQueueArray[ii - 1];
+        if (other->staticPriority > task->staticPriority || (other->staticPriority == task->staticPriority && other < task)) {
+            break;
+        }
+        readyQueueArray[ii] = readyQueueArray[ii - 1];
+    }
+    readyQueueArray[ii] = task;
+}
+
+static FAST_CODE bool readyQueueRemove(cfTask_t *task)
+{
+    for (int ii = 0; ii < readyQueueSize; ++ii) {
+        if (readyQueueArray[ii] == task) {
+            memmove(&readyQueueArray[ii], &readyQueueArray[ii+1], sizeof(task) * (readyQueueSize - ii - 1));
+            --readyQueueSize;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Puts a task into the heap mode structures, it is looked at on the next pass
+static void heapAddTask(cfTask_t *task)
+{
+    task->dynamicPriority = 0;
+    heapPush(task, micros());
+}
+
+static void heapRemoveTask(cfTask_t *task)
+{
+    if (!heapRemove(task)) {
+        readyQueueRemove(task);
+    }
+    if (task == currentTask) {
+        currentTaskDisabled = true;
+    }
+}
+
 void taskSystem(timeUs_t currentTimeUs)
 {
     UNUSED(currentTimeUs);
@@ -162,14 +286,41 @@ void getTaskInfo(cfTaskId_e taskId, cfTaskInfo_t * taskInfo)
 }
 #endif
 
+#ifdef USE_TASK_HISTOGRAM
+static FAST_RAM cfDeadlineInfo_t gyroPidDeadlineInfo;
+
+static FAST_CODE void histogramAdd(uint32_t *histogram, timeDelta_t timeUs)
+{
+    // log2 bucket, a single clz
+    const int bucket = (timeUs <= 0) ? 0 : 32 - __builtin_clz((uint32_t)timeUs);
+    histogram[MIN(bucket, TASK_HISTOGRAM_BUCKETS - 1)]++;
+}
+
+void getTaskHistogram(cfTaskId_e taskId, cfTaskHistogram_t *histogram)
+{
+    *histogram = cfTasks[taskId].histogram;
+}
+
+void getGyroPidDeadlineInfo(cfDeadlineInfo_t *deadlineInfo)
+{
+    *deadlineInfo = gyroPidDeadlineInfo;
+}
+#endif
+
 void rescheduleTask(cfTaskId_e taskId, uint32_t newPeriodMicros)
 {
     if (taskId == TASK_SELF) {
+        // heap mode puts the running task back with the new period once it returns
         cfTask_t *task = currentTask;
         task->desiredPeriod = MAX(SCHEDULER_DELAY_LIMIT, (timeDelta_t)newPeriodMicros);  // Limit delay to 100us (10 kHz) to prevent scheduler clogging
     } else if (taskId < TASK_COUNT) {
         cfTask_t *task = &cfTasks[taskId];
-        task->desiredPeriod = MAX(SCHEDULER_DELAY_LIMIT, (timeDelta_t)newPeriodMicros);  // Limit delay to 100us (10 kHz) to prevent scheduler clogging
+        const timeDelta_t desiredPeriod = MAX(SCHEDULER_DELAY_LIMIT, (timeDelta_t)newPeriodMicros);  // Limit delay to 100us (10 kHz) to prevent scheduler clogging
+        if (schedulerMode == SCHEDULER_MODE_HEAP && desiredPeriod != task->desiredPeriod && heapRemove(task)) {
+            // due time changed, look at it again on the next pass
+            heapPush(task, micros());
+        }
+        task->desiredPeriod = desiredPeriod;
     }
 }
 
@@ -178,9 +329,13 @@ void setTaskEnabled(cfTaskId_e taskId, bool enabled)
     if (taskId == TASK_SELF || taskId < TASK_COUNT) {
         cfTask_t *task = taskId == TASK_SELF ? currentTask : &cfTasks[taskId];
         if (enabled && task->taskFunc) {
-            queueAdd(task);
+            if (queueAdd(task) && schedulerMode == SCHEDULER_MODE_HEAP) {
+                heapAddTask(task);
+            }
         } else {
-            queueRemove(task);
+            if (queueRemove(task) && schedulerMode == SCHEDULER_MODE_HEAP) {
+                heapRemoveTask(task);
+            }
         }
     }
 }
@@ -210,92 +365,179 @@ void schedulerResetTaskStatistics(cfTaskId_e taskId)
         currentTask->movingSumExecutionTime = 0;
         currentTask->totalExecutionTime = 0;
         currentTask->maxExecutionTime = 0;
+#ifdef USE_TASK_HISTOGRAM
+        memset(&currentTask->histogram, 0, sizeof(currentTask->histogram));
+#endif
     } else if (taskId < TASK_COUNT) {
         cfTasks[taskId].movingSumExecutionTime = 0;
         cfTasks[taskId].totalExecutionTime = 0;
         cfTasks[taskId].maxExecutionTime = 0;
+#ifdef USE_TASK_HISTOGRAM
+        memset(&cfTasks[taskId].histogram, 0, sizeof(cfTasks[taskId].histogram));
+        if (taskId == TASK_GYROPID) {
+            memset(&gyroPidDeadlineInfo, 0, sizeof(gyroPidDeadlineInfo));
+        }
+#endif
     }
 #endif
 }
 
+void schedulerSetMode(schedulerMode_e mode)
+{
+    schedulerMode = mode;
+    taskHeapSize = 0;
+    readyQueueSize = 0;
+    if (mode == SCHEDULER_MODE_HEAP) {
+        for (cfTask_t *task = queueFirst(); task != NULL; task = queueNext()) {
+            heapAddTask(task);
+        }
+    }
+}
+
 void schedulerInit(void)
 {
     calculateTaskStatistics = true;
     queueClear();
     queueAdd(&cfTasks[TASK_SYSTEM]);
+    schedulerSetMode(schedulerMode);
 }
 
-FAST_CODE void scheduler(void)
+// Polls the checkFunc of an event driven task, true if it was signalled
+static FAST_CODE bool taskCheck(cfTask_t *task, timeUs_t currentTimeUs)
 {
-    // Cache currentTime
-    const timeUs_t currentTimeUs = micros();
+#if defined(SCHEDULER_DEBUG)
+    const timeUs_t currentTimeBeforeCheckFuncCall = micros();
+#else
+    const timeUs_t currentTimeBeforeCheckFuncCall = currentTimeUs;
+#endif
+    if (!task->checkFunc(currentTimeBeforeCheckFuncCall, currentTimeBeforeCheckFuncCall - task->lastExecutedAt)) {
+        return false;
+    }
+#if defined(SCHEDULER_DEBUG)
+    DEBUG_SET(DEBUG_SCHEDULER, 3, micros() - currentTimeBeforeCheckFuncCall);
+#endif
+#ifndef SKIP_TASK_STATISTICS
+    if (calculateTaskStatistics) {
+        const uint32_t checkFuncExecutionTime = micros() - currentTimeBeforeCheckFuncCall;
+        checkFuncMovingSumExecutionTime += checkFuncExecutionTime - checkFuncMovingSumExecutionTime / MOVING_SUM_COUNT;
+        checkFuncTotalExecutionTime += checkFuncExecutionTime;   // time consumed by scheduler + task
+        checkFuncMaxExecutionTime = MAX(checkFuncMaxExecutionTime, checkFuncExecutionTime);
+    }
+#endif
+    task->lastSignaledAt = currentTimeBeforeCheckFuncCall;
+    task->taskAgeCycles = 1;
+    task->dynamicPriority = 1 + task->staticPriority;
+    return true;
+}
 
-    // Check for realtime tasks
-    bool outsideRealtimeGuardInterval = true;
-    for (const cfTask_t *task = queueFirst(); task != NULL && task->staticPriority >= TASK_PRIORITY_REALTIME; task = queueNext()) {
-        const timeUs_t nextExecuteAt = task->lastExecutedAt + task->desiredPeriod;
-        if ((timeDelta_t)(currentTimeUs - nextExecuteAt) >= 0) {
-            outsideRealtimeGuardInterval = false;
-            break;
+// Moves the tasks that became due or were signalled from the heap to the ready queue
+static FAST_CODE void heapCollectReadyTasks(timeUs_t currentTimeUs)
+{
+    while (taskHeapSize > 0 && cmpTimeUs(currentTimeUs, taskHeap[0].dueAt) >= 0) {
+        cfTask_t *task = heapPop();
+        if (task->checkFunc) {
+            if (taskCheck(task, currentTimeUs)) {
+                readyQueueAdd(task);
+            } else {
+                heapPush(task, currentTimeUs + MAX(1, task->checkPeriod));
+            }
+        } else if ((currentTimeUs - task->lastExecutedAt) / task->desiredPeriod > 0) {
+            readyQueueAdd(task);
+        } else {
+            // desiredPeriod was changed since it was queued
+            heapPush(task, task->lastExecutedAt + task->desiredPeriod);
         }
     }
+}
+
+FAST_CODE void scheduler(void)
+{
+    // Cache currentTime
+    const timeUs_t currentTimeUs = micros();
 
     // The task to be invoked
     cfTask_t *selectedTask = NULL;
     uint16_t selectedTaskDynamicPriority = 0;
-
-    // Update task dynamic priorities
     uint16_t waitingTasks = 0;
-    for (cfTask_t *task = queueFirst(); task != NULL; task = queueNext()) {
-        // Task has checkFunc - event driven
-        if (task->checkFunc) {
-#if defined(SCHEDULER_DEBUG)
-            const timeUs_t currentTimeBeforeCheckFuncCall = micros();
-#else
-            const timeUs_t currentTimeBeforeCheckFuncCall = currentTimeUs;
-#endif
-            // Increase priority for event driven tasks
-            if (task->dynamicPriority > 0) {
+    bool outsideRealtimeGuardInterval = true;
+
+    if (schedulerMode == SCHEDULER_MODE_HEAP) {
+        heapCollectReadyTasks(currentTimeUs);
+
+        // Every ready realtime task is due
+        if (readyQueueSize > 0 && readyQueueArray[0]->staticPriority >= TASK_PRIORITY_REALTIME) {
+            outsideRealtimeGuardInterval = false;
+        }
+
+        // Update task dynamic priorities, same ageing as below, only for the ready tasks
+        for (int ii = 0; ii < readyQueueSize; ++ii) {
+            cfTask_t *task = readyQueueArray[ii];
+            if (task->checkFunc) {
                 task->taskAgeCycles = 1 + ((currentTimeUs - task->lastSignaledAt) / task->desiredPeriod);
-                task->dynamicPriority = 1 + task->staticPriority * task->taskAgeCycles;
-                waitingTasks++;
-            } else if (task->checkFunc(currentTimeBeforeCheckFuncCall, currentTimeBeforeCheckFuncCall - task->lastExecutedAt)) {
-#if defined(SCHEDULER_DEBUG)
-                DEBUG_SET(DEBUG_SCHEDULER, 3, micros() - currentTimeBeforeCheckFuncCall);
-#endif
-#ifndef SKIP_TASK_STATISTICS
-                if (calculateTaskStatistics) {
-                    const uint32_t checkFuncExecutionTime = micros() - currentTimeBeforeCheckFuncCall;
-                    checkFuncMovingSumExecutionTime += checkFuncExecutionTime - checkFuncMovingSumExecutionTime / MOVING_SUM_COUNT;
-                    checkFuncTotalExecutionTime += checkFuncExecutionTime;   // time consumed by scheduler + task
-                    checkFuncMaxExecutionTime = MAX(checkFuncMaxExecutionTime, checkFuncExecutionTime);
-                }
-#endif
-                task->lastSignaledAt = currentTimeBeforeCheckFuncCall;
-                task->taskAgeCycles = 1;
-                task->dynamicPriority = 1 + task->staticPriority;
-                waitingTasks++;
             } else {
-                task->taskAgeCycles = 0;
+                task->taskAgeCycles = ((currentTimeUs - task->lastExecutedAt) / task->desiredPeriod);
             }
-        } else {
-            // Task is time-driven, dynamicPriority is last execution age (measured in desiredPeriods)
-            // Task age is calculated from last execution
-            task->taskAgeCycles = ((currentTimeUs - task->lastExecutedAt) / task->desiredPeriod);
-            if (task->taskAgeCycles > 0) {
-                task->dynamicPriority = 1 + task->staticPriority * task->taskAgeCycles;
-                waitingTasks++;
+            task->dynamicPriority = 1 + task->staticPriority * task->taskAgeCycles;
+
+            if (task->dynamicPriority > selectedTaskDynamicPriority) {
+                const bool taskCanBeChosenForScheduling =
+                    (outsideRealtimeGuardInterval) ||
+                    (task->taskAgeCycles > 1) ||
+                    (task->staticPriority == TASK_PRIORITY_REALTIME);
+                if (taskCanBeChosenForScheduling) {
+                    selectedTaskDynamicPriority = task->dynamicPriority;
+                    selectedTask = task;
+                }
+            }
+        }
+        waitingTasks = readyQueueSize;
+
+        if (selectedTask) {
+            readyQueueRemove(selectedTask);
+        }
+    } else {
+        // Check for realtime tasks
+        for (const cfTask_t *task = queueFirst(); task != NULL && task->staticPriority >= TASK_PRIORITY_REALTIME; task = queueNext()) {
+            const timeUs_t nextExecuteAt = task->lastExecutedAt + task->desiredPeriod;
+            if ((timeDelta_t)(currentTimeUs - nextExecuteAt) >= 0) {
+                outsideRealtimeGuardInterval = false;
+                break;
             }
         }
 
-        if (task->dynamicPriority > selectedTaskDynamicPriority) {
-            const bool taskCanBeChosenForScheduling =
-                (outsideRealtimeGuardInterval) ||
-                (task->taskAgeCycles > 1) ||
-                (task->staticPriority == TASK_PRIORITY_REALTIME);
-            if (taskCanBeChosenForScheduling) {
-                selectedTaskDynamicPriority = task->dynamicPriority;
-                selectedTask = task;
+        // Update task dynamic priorities
+        for (cfTask_t *task = queueFirst(); task != NULL; task = queueNext()) {
+            // Task has checkFunc - event driven
+            if (task->checkFunc) {
+                // Increase priority for event driven tasks
+                if (task->dynamicPriority > 0) {
+                    task->taskAgeCycles = 1 + ((currentTimeUs - task->lastSignaledAt) / task->desiredPeriod);
+                    task->dynamicPriority = 1 + task->staticPriority * task->taskAgeCycles;
+                    waitingTasks++;
+                } else if (taskCheck(task, currentTimeUs)) {
+                    waitingTasks++;
+                } else {
+                    task->taskAgeCycles = 0;
+                }
+            } else {
+                // Task is time-driven, dynamicPriority is last execution age (measured in desiredPeriods)
+                // Task age is calculated from last execution
+                task->taskAgeCycles = ((currentTimeUs - task->lastExecutedAt) / task->desiredPeriod);
+                if (task->taskAgeCycles > 0) {
+                    task->dynamicPriority = 1 + task->staticPriority * task->taskAgeCycles;
+                    waitingTasks++;
+                }
+            }
+
+            if (task->dynamicPriority > selectedTaskDynamicPriority) {
+                const bool taskCanBeChosenForScheduling =
+                    (outsideRealtimeGuardInterval) ||
+                    (task->taskAgeCycles > 1) ||
+                    (task->staticPriority == TASK_PRIORITY_REALTIME);
+                if (taskCanBeChosenForScheduling) {
+                    selectedTaskDynamicPriority = task->dynamicPriority;
+                    selectedTask = task;
+                }
             }
         }
     }
@@ -305,11 +547,20 @@ FAST_CODE void scheduler(void)
 
     currentTask = selectedTask;
 
+#if defined(SCHEDULER_DEBUG)
+    DEBUG_SET(DEBUG_SCHEDULER, 2, micros() - currentTimeUs); // time spent in scheduler
+#endif
+
     if (selectedTask) {
         // Found a task that should be run
+#ifdef USE_TASK_HISTOGRAM
+        const timeDelta_t startLatency = selectedTask->checkFunc ? cmpTimeUs(currentTimeUs, selectedTask->lastSignaledAt)
+            : cmpTimeUs(currentTimeUs, selectedTask->lastExecutedAt) - selectedTask->desiredPeriod;
+#endif
         selectedTask->taskLatestDeltaTime = currentTimeUs - selectedTask->lastExecutedAt;
         selectedTask->lastExecutedAt = currentTimeUs;
         selectedTask->dynamicPriority = 0;
+        currentTaskDisabled = false;
 
         // Execute task
 #ifdef SKIP_TASK_STATISTICS
@@ -322,16 +573,27 @@ FAST_CODE void scheduler(void)
             selectedTask->movingSumExecutionTime += taskExecutionTime - selectedTask->movingSumExecutionTime / MOVING_SUM_COUNT;
             selectedTask->totalExecutionTime += taskExecutionTime;   // time consumed by scheduler + task
             selectedTask->maxExecutionTime = MAX(selectedTask->maxExecutionTime, taskExecutionTime);
+#ifdef USE_TASK_HISTOGRAM
+            histogramAdd(selectedTask->histogram.executionTime, taskExecutionTime);
+            histogramAdd(selectedTask->histogram.startLatency, startLatency);
+            if (selectedTask == &cfTasks[TASK_GYROPID]) {
+                if (startLatency >= selectedTask->desiredPeriod) {
+                    gyroPidDeadlineInfo.late++;
+                }
+                if ((timeDelta_t)taskExecutionTime > selectedTask->desiredPeriod) {
+                    gyroPidDeadlineInfo.overrun++;
+                }
+            }
+#endif
         } else {
             selectedTask->taskFunc(currentTimeUs);
         }
 
 #endif
-#if defined(SCHEDULER_DEBUG)
-        DEBUG_SET(DEBUG_SCHEDULER, 2, micros() - currentTimeUs - taskExecutionTime); // time spent in scheduler
-    } else {
-        DEBUG_SET(DEBUG_SCHEDULER, 2, micros() - currentTimeUs);
-#endif
+        if (schedulerMode == SCHEDULER_MODE_HEAP && !currentTaskDisabled) {
+            // back into the heap, with the period the task may just have changed
+            heapPush(selectedTask, selectedTask->checkFunc ? currentTimeUs + MAX(1, selectedTask->checkPeriod) : currentTimeUs + selectedTask->desiredPeriod);
+        }
     }
 
     GET_SCHEDULER_LOCALS();
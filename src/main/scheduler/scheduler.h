@@ -23,6 +23,11 @@
 #define TASK_PERIOD_MS(ms) ((ms) * 1000)
 #define TASK_PERIOD_US(us) (us)
 
+#if defined(SKIP_TASK_STATISTICS)
+#undef USE_TASK_HISTOGRAM
+#endif
+
+#define TASK_HISTOGRAM_BUCKETS 16   // log2 scale: 0us, 1us, 2-3us, 4-7us, ..., 16384us and above
 
 typedef enum {
     TASK_PRIORITY_IDLE = 0,     // Disables dynamic scheduling, task is executed only if no other task is active this cycle
@@ -34,12 +39,27 @@ typedef enum {
     TASK_PRIORITY_MAX = 255
 } cfTaskPriority_e;
 
+typedef enum {
+    SCHEDULER_MODE_QUEUE = 0,   // every pass ages every enabled task and polls every checkFunc
+    SCHEDULER_MODE_HEAP,        // tasks wait in a min-heap by due time, only due and signalled tasks are aged
+} schedulerMode_e;
+
 typedef struct {
     timeUs_t     maxExecutionTime;
     timeUs_t     totalExecutionTime;
     timeUs_t     averageExecutionTime;
 } cfCheckFuncInfo_t;
 
+typedef struct {
+    uint32_t executionTime[TASK_HISTOGRAM_BUCKETS];
+    uint32_t startLatency[TASK_HISTOGRAM_BUCKETS];  // time driven: started after desiredPeriod, event driven: after being signalled
+} cfTaskHistogram_t;
+
+typedef struct {
+    uint32_t late;      // started a desiredPeriod or more late, so at least one cycle was lost
+    uint32_t overrun;   // execution took longer than desiredPeriod
+} cfDeadlineInfo_t;
+
 typedef struct {
     const char * taskName;
     const char * subTaskName;
@@ -82,9 +102,13 @@ typedef enum {
 #if defined(USE_BARO) || defined(USE_RANGEFINDER)
     TASK_ALTITUDE,
 #endif
+    TASK_OL_NAVIGATION,
 #ifdef USE_DASHBOARD
     TASK_DASHBOARD,
 #endif
+#ifdef USE_BLACKBOX
+    TASK_BLACKBOX,
+#endif
 #ifdef USE_TELEMETRY
     TASK_TELEMETRY,
 #endif
@@ -146,6 +170,7 @@ typedef struct {
     bool (*checkFunc)(timeUs_t currentTimeUs, timeDelta_t currentDeltaTimeUs);
     void (*taskFunc)(timeUs_t currentTimeUs);
     timeDelta_t desiredPeriod;      // target period of execution
+    timeDelta_t checkPeriod;        // event driven, SCHEDULER_MODE_HEAP polls checkFunc at most this often, 0 every pass
     const uint8_t staticPriority;   // dynamicPriority grows in steps of this size, shouldn't be zero
 
     // Scheduling
@@ -161,6 +186,9 @@ typedef struct {
     timeUs_t maxExecutionTime;
     timeUs_t totalExecutionTime;    // total time consumed by task since boot
 #endif
+#ifdef USE_TASK_HISTOGRAM
+    cfTaskHistogram_t histogram;
+#endif
 } cfTask_t;
 
 extern cfTask_t cfTasks[TASK_COUNT];
@@ -168,12 +196,15 @@ extern uint16_t averageSystemLoadPercent;
 
 void getCheckFuncInfo(cfCheckFuncInfo_t *checkFuncInfo);
 void getTaskInfo(cfTaskId_e taskId, cfTaskInfo_t *taskInfo);
+void getTaskHistogram(cfTaskId_e taskId, cfTaskHistogram_t *histogram);
+void getGyroPidDeadlineInfo(cfDeadlineInfo_t *deadlineInfo);
 void rescheduleTask(cfTaskId_e taskId, uint32_t newPeriodMicros);
 void setTaskEnabled(cfTaskId_e taskId, bool newEnabledState);
 timeDelta_t getTaskDeltaTime(cfTaskId_e taskId);
 void schedulerSetCalulateTaskStatistics(bool calculateTaskStatistics);
 void schedulerResetTaskStatistics(cfTaskId_e taskId);
 
+void schedulerSetMode(schedulerMode_e mode);
 void schedulerInit(void);
 void scheduler(void);
 void taskSystem(timeUs_t currentTime);
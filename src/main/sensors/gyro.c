@@ -59,6 +59,8 @@
 #include "fc/config.h"
 #include "fc/runtime_config.h"
 
+#include "flight/rpm_filter.h"
+
 #include "io/beeper.h"
 #include "io/statusindicator.h"
 
@@ -97,36 +99,56 @@ typedef struct gyroCalibration_s {
 bool firstArmingCalibrationWasStarted = false;
 
 typedef union gyroSoftFilter_u {
-    biquadFilter_t gyroFilterLpfState[XYZ_AXIS_COUNT];
-    pt1Filter_t gyroFilterPt1State[XYZ_AXIS_COUNT];
+    biquadFilterBank_t gyroFilterLpfState;
+    pt1FilterBank_t gyroFilterPt1State;
     firFilterDenoise_t gyroDenoiseState[XYZ_AXIS_COUNT];
 } gyroSoftLpfFilter_t;
 
+typedef enum {
+    GYRO_FILTER_STAGE_KALMAN,
+    GYRO_FILTER_STAGE_BIQUAD_RC_FIR2,
+    GYRO_FILTER_STAGE_RPM,
+    GYRO_FILTER_STAGE_DYN_NOTCH,
+    GYRO_FILTER_STAGE_NOTCH_1,
+    GYRO_FILTER_STAGE_NOTCH_2,
+    GYRO_FILTER_STAGE_SOFT_LPF,
+    GYRO_FILTER_STAGE_COUNT
+} gyroFilterStageId_e;
+
+// the dynamic notch takes one stage per tracked peak
+#define GYRO_FILTER_STAGE_MAX (GYRO_FILTER_STAGE_COUNT - 1 + DYN_NOTCH_COUNT_MAX)
+
+// one stage of the filter chain, filters the three axes in one call
+typedef struct gyroFilterStage_s {
+    filterBankApplyFnPtr applyFn;
+    filterBank_t *bank;
+    gyroFilterStageId_e id;
+} gyroFilterStage_t;
+
 typedef struct gyroSensor_s {
     gyroDev_t gyroDev;
     gyroCalibration_t calibration;
     // gyro soft filter
-    filterApplyFnPtr softLpfFilterApplyFn;
     gyroSoftLpfFilter_t softLpfFilter;
-    filter_t *softLpfFilterPtr[XYZ_AXIS_COUNT];
     // notch filters
-    filterApplyFnPtr notchFilter1ApplyFn;
-    biquadFilter_t notchFilter1[XYZ_AXIS_COUNT];
-    filterApplyFnPtr notchFilter2ApplyFn;
-    biquadFilter_t notchFilter2[XYZ_AXIS_COUNT];
-    filterApplyFnPtr notchFilterDynApplyFn;
-    biquadFilter_t notchFilterDyn[XYZ_AXIS_COUNT];
+    biquadFilterBank_t notchFilter1;
+    biquadFilterBank_t notchFilter2;
+    biquadFilterBank_t notchFilterDyn[DYN_NOTCH_COUNT_MAX];
     timeUs_t overflowTimeUs;
     bool overflowDetected;
 #if defined(USE_GYRO_FAST_KALMAN)
     // gyro kalman filter
-    filterApplyFnPtr fastKalmanApplyFn;
-    fastKalman_t fastKalman[XYZ_AXIS_COUNT];
+    fastKalmanBank_t fastKalman;
 #elif defined(USE_GYRO_BIQUAD_RC_FIR2)
     // gyro biquad RC FIR2 filter
-    filterApplyFnPtr biquadRCFIR2ApplyFn;
-    biquadFilter_t biquadRCFIR2[XYZ_AXIS_COUNT];
+    biquadFilterBank_t biquadRCFIR2;
+#endif
+#ifdef USE_RPM_FILTER
+    rpmNotchFilter_t rpmFilter;
 #endif
+    // enabled filters in the order they are applied, set up by gyroInitSensorFilters
+    gyroFilterStage_t filterStage[GYRO_FILTER_STAGE_MAX];
+    uint8_t filterStageCount;
 } gyroSensor_t;
 
 STATIC_UNIT_TESTED FAST_RAM gyroSensor_t gyroSensor1;
@@ -156,7 +178,7 @@ static void gyroInitSensorFilters(gyroSensor_t *gyroSensor);
 #define GYRO_OVERFLOW_TRIGGER_THRESHOLD 31980  // 97.5% full scale (1950dps for 2000dps gyro)
 #define GYRO_OVERFLOW_RESET_THRESHOLD 30340    // 92.5% full scale (1850dps for 2000dps gyro)
 
-PG_REGISTER_WITH_RESET_TEMPLATE(gyroConfig_t, gyroConfig, PG_GYRO_CONFIG, 1);
+PG_REGISTER_WITH_RESET_TEMPLATE(gyroConfig_t, gyroConfig, PG_GYRO_CONFIG, 2);
 
 PG_RESET_TEMPLATE(gyroConfig_t, gyroConfig,
     .gyro_align = ALIGN_DEFAULT,
@@ -178,6 +200,10 @@ PG_RESET_TEMPLATE(gyroConfig_t, gyroConfig,
     .gyro_filter_r = 0,
     .gyro_filter_p = 0,
     .gyro_offset_yaw = 0,
+    .dyn_fft_window = 32,
+    .dyn_fft_sample_hz = 1000,
+    .dyn_fft_peak_mode = DYN_FFT_PEAK_MEAN,
+    .dyn_notch_count = 1,
 );
 
 
@@ -458,34 +484,41 @@ bool gyroInit(void)
     return gyroInitSensor(&gyroSensor1);
 }
 
+static void gyroAddFilterStage(gyroSensor_t *gyroSensor, gyroFilterStageId_e id, filterBankApplyFnPtr applyFn, void *bank)
+{
+    gyroFilterStage_t *stage = &gyroSensor->filterStage[gyroSensor->filterStageCount++];
+    stage->applyFn = applyFn;
+    stage->bank = (filterBank_t *)bank;
+    stage->id = id;
+}
+
+static FAST_CODE void gyroDenoiseFilterApply(filterBank_t *bank, float *data)
+{
+    firFilterDenoise_t *filter = (firFilterDenoise_t *)bank;
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        data[axis] = firFilterDenoiseUpdate(&filter[axis], data[axis]);
+    }
+}
+
 void gyroInitFilterLpf(gyroSensor_t *gyroSensor, uint8_t lpfHz)
 {
-    gyroSensor->softLpfFilterApplyFn = nullFilterApply;
     const uint32_t gyroFrequencyNyquist = 1000000 / 2 / gyro.targetLooptime;
 
     if (lpfHz && lpfHz <= gyroFrequencyNyquist) {  // Initialisation needs to happen once samplingrate is known
         switch (gyroConfig()->gyro_soft_lpf_type) {
         case FILTER_BIQUAD:
-            gyroSensor->softLpfFilterApplyFn = (filterApplyFnPtr)biquadFilterApply;
-            for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
-                gyroSensor->softLpfFilterPtr[axis] = (filter_t *)&gyroSensor->softLpfFilter.gyroFilterLpfState[axis];
-                biquadFilterInitLPF(&gyroSensor->softLpfFilter.gyroFilterLpfState[axis], lpfHz, gyro.targetLooptime);
-            }
+            biquadFilterBankInitLPF(&gyroSensor->softLpfFilter.gyroFilterLpfState, lpfHz, gyro.targetLooptime);
+            gyroAddFilterStage(gyroSensor, GYRO_FILTER_STAGE_SOFT_LPF, (filterBankApplyFnPtr)biquadFilterBankApply, &gyroSensor->softLpfFilter.gyroFilterLpfState);
             break;
         case FILTER_PT1:
-            gyroSensor->softLpfFilterApplyFn = (filterApplyFnPtr)pt1FilterApply;
-            const float gyroDt = (float) gyro.targetLooptime * 0.000001f;
-            for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
-                gyroSensor->softLpfFilterPtr[axis] = (filter_t *)&gyroSensor->softLpfFilter.gyroFilterPt1State[axis];
-                pt1FilterInit(&gyroSensor->softLpfFilter.gyroFilterPt1State[axis], lpfHz, gyroDt);
-            }
+            pt1FilterBankInit(&gyroSensor->softLpfFilter.gyroFilterPt1State, lpfHz, (float) gyro.targetLooptime * 0.000001f);
+            gyroAddFilterStage(gyroSensor, GYRO_FILTER_STAGE_SOFT_LPF, (filterBankApplyFnPtr)pt1FilterBankApply, &gyroSensor->softLpfFilter.gyroFilterPt1State);
             break;
         default:
-            gyroSensor->softLpfFilterApplyFn = (filterApplyFnPtr)firFilterDenoiseUpdate;
             for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
-                gyroSensor->softLpfFilterPtr[axis] = (filter_t *)&gyroSensor->softLpfFilter.gyroDenoiseState[axis];
                 firFilterDenoiseInit(&gyroSensor->softLpfFilter.gyroDenoiseState[axis], lpfHz, gyro.targetLooptime);
             }
+            gyroAddFilterStage(gyroSensor, GYRO_FILTER_STAGE_SOFT_LPF, gyroDenoiseFilterApply, gyroSensor->softLpfFilter.gyroDenoiseState);
             break;
         }
     }
@@ -514,33 +547,14 @@ void gyroInitSlewLimiter(gyroSensor_t *gyroSensor) {
 }
 #endif
 
-static void gyroInitFilterNotch1(gyroSensor_t *gyroSensor, uint16_t notchHz, uint16_t notchCutoffHz)
-{
-    gyroSensor->notchFilter1ApplyFn = nullFilterApply;
-
-    notchHz = calculateNyquistAdjustedNotchHz(notchHz, notchCutoffHz);
-
-    if (notchHz != 0 && notchCutoffHz != 0) {
-        gyroSensor->notchFilter1ApplyFn = (filterApplyFnPtr)biquadFilterApply;
-        const float notchQ = filterGetNotchQ(notchHz, notchCutoffHz);
-        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
-            biquadFilterInit(&gyroSensor->notchFilter1[axis], notchHz, gyro.targetLooptime, notchQ, FILTER_NOTCH);
-        }
-    }
-}
-
-static void gyroInitFilterNotch2(gyroSensor_t *gyroSensor, uint16_t notchHz, uint16_t notchCutoffHz)
+static void gyroInitFilterNotch(gyroSensor_t *gyroSensor, gyroFilterStageId_e id, biquadFilterBank_t *notchFilter, uint16_t notchHz, uint16_t notchCutoffHz)
 {
-    gyroSensor->notchFilter2ApplyFn = nullFilterApply;
-
     notchHz = calculateNyquistAdjustedNotchHz(notchHz, notchCutoffHz);
 
     if (notchHz != 0 && notchCutoffHz != 0) {
-        gyroSensor->notchFilter2ApplyFn = (filterApplyFnPtr)biquadFilterApply;
         const float notchQ = filterGetNotchQ(notchHz, notchCutoffHz);
-        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
-            biquadFilterInit(&gyroSensor->notchFilter2[axis], notchHz, gyro.targetLooptime, notchQ, FILTER_NOTCH);
-        }
+        biquadFilterBankInit(notchFilter, notchHz, gyro.targetLooptime, notchQ, FILTER_NOTCH);
+        gyroAddFilterStage(gyroSensor, id, (filterBankApplyFnPtr)biquadFilterBankApply, notchFilter);
     }
 }
 
@@ -552,13 +566,12 @@ static bool isDynamicFilterActive(void)
 
 static void gyroInitFilterDynamicNotch(gyroSensor_t *gyroSensor)
 {
-    gyroSensor->notchFilterDynApplyFn = nullFilterApply;
-
     if (isDynamicFilterActive()) {
-        gyroSensor->notchFilterDynApplyFn = (filterApplyFnPtr)biquadFilterApplyDF1; // must be this function, not DF2
         const float notchQ = filterGetNotchQ(400, 390); //just any init value
-        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
-            biquadFilterInit(&gyroSensor->notchFilterDyn[axis], 400, gyro.targetLooptime, notchQ, FILTER_NOTCH);
+        for (int i = 0; i < gyroDataAnalyseNotchCount(); i++) {
+            biquadFilterBankInit(&gyroSensor->notchFilterDyn[i], 400, gyro.targetLooptime, notchQ, FILTER_NOTCH);
+            // must be DF1, not DF2, the coefficients are moved while the filter runs
+            gyroAddFilterStage(gyroSensor, GYRO_FILTER_STAGE_DYN_NOTCH, (filterBankApplyFnPtr)biquadFilterBankApplyDF1, &gyroSensor->notchFilterDyn[i]);
         }
     }
 }
@@ -567,47 +580,49 @@ static void gyroInitFilterDynamicNotch(gyroSensor_t *gyroSensor)
 #if defined(USE_GYRO_FAST_KALMAN)
 static void gyroInitFilterKalman(gyroSensor_t *gyroSensor, uint16_t gyro_filter_q, uint16_t gyro_filter_r, uint16_t gyro_filter_p)
 {
-    gyroSensor->fastKalmanApplyFn = nullFilterApply;
-
     // If Kalman Filter noise covariances for Process and Measurement are non-zero, we treat as enabled
     if (gyro_filter_q != 0 && gyro_filter_r != 0) {
-        gyroSensor->fastKalmanApplyFn = (filterApplyFnPtr)fastKalmanUpdate;
-        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
-            fastKalmanInit(&gyroSensor->fastKalman[axis], gyro_filter_q, gyro_filter_r, gyro_filter_p);
-        }
+        fastKalmanBankInit(&gyroSensor->fastKalman, gyro_filter_q, gyro_filter_r, gyro_filter_p);
+        gyroAddFilterStage(gyroSensor, GYRO_FILTER_STAGE_KALMAN, (filterBankApplyFnPtr)fastKalmanBankApply, &gyroSensor->fastKalman);
     }
 }
 #elif defined(USE_GYRO_BIQUAD_RC_FIR2)
 static void gyroInitFilterBiquadRCFIR2(gyroSensor_t *gyroSensor, uint16_t lpfHz)
 {
-    gyroSensor->biquadRCFIR2ApplyFn = nullFilterApply;
     const uint32_t gyroFrequencyNyquist = 1000000 / 2 / gyro.targetLooptime;
     const float gyroDt = (float) gyro.targetLooptime * 0.000001f;
     if (lpfHz && lpfHz <= gyroFrequencyNyquist) {  // Initialisation needs to happen once samplingrate is known
-        gyroSensor->biquadRCFIR2ApplyFn = (filterApplyFnPtr)biquadFilterApply;
-        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
-            biquadRCFIR2FilterInit(&gyroSensor->biquadRCFIR2[axis], lpfHz, gyroDt);
-        }
+        biquadRCFIR2FilterBankInit(&gyroSensor->biquadRCFIR2, lpfHz, gyroDt);
+        gyroAddFilterStage(gyroSensor, GYRO_FILTER_STAGE_BIQUAD_RC_FIR2, (filterBankApplyFnPtr)biquadFilterBankApply, &gyroSensor->biquadRCFIR2);
     }
 }
 #endif
 
+/*
+ * Composes the filter chain: only the enabled filters get a stage, in the order they are applied
+ */
 static void gyroInitSensorFilters(gyroSensor_t *gyroSensor)
 {
 #if defined(USE_GYRO_SLEW_LIMITER)
     gyroInitSlewLimiter(gyroSensor);
 #endif
+    gyroSensor->filterStageCount = 0;
 #if defined(USE_GYRO_FAST_KALMAN)
     gyroInitFilterKalman(gyroSensor, gyroConfig()->gyro_filter_q, gyroConfig()->gyro_filter_r, gyroConfig()->gyro_filter_p);
 #elif defined(USE_GYRO_BIQUAD_RC_FIR2)
     gyroInitFilterBiquadRCFIR2(gyroSensor, gyroConfig()->gyro_soft_lpf_hz_2);
 #endif
-    gyroInitFilterLpf(gyroSensor, gyroConfig()->gyro_soft_lpf_hz);
-    gyroInitFilterNotch1(gyroSensor, gyroConfig()->gyro_soft_notch_hz_1, gyroConfig()->gyro_soft_notch_cutoff_1);
-    gyroInitFilterNotch2(gyroSensor, gyroConfig()->gyro_soft_notch_hz_2, gyroConfig()->gyro_soft_notch_cutoff_2);
+#ifdef USE_RPM_FILTER
+    if (rpmFilterInit(&gyroSensor->rpmFilter, gyro.targetLooptime)) {
+        gyroAddFilterStage(gyroSensor, GYRO_FILTER_STAGE_RPM, (filterBankApplyFnPtr)rpmFilterApply, &gyroSensor->rpmFilter);
+    }
+#endif
 #ifdef USE_GYRO_DATA_ANALYSE
     gyroInitFilterDynamicNotch(gyroSensor);
 #endif
+    gyroInitFilterNotch(gyroSensor, GYRO_FILTER_STAGE_NOTCH_1, &gyroSensor->notchFilter1, gyroConfig()->gyro_soft_notch_hz_1, gyroConfig()->gyro_soft_notch_cutoff_1);
+    gyroInitFilterNotch(gyroSensor, GYRO_FILTER_STAGE_NOTCH_2, &gyroSensor->notchFilter2, gyroConfig()->gyro_soft_notch_hz_2, gyroConfig()->gyro_soft_notch_cutoff_2);
+    gyroInitFilterLpf(gyroSensor, gyroConfig()->gyro_soft_lpf_hz);
 }
 
 void gyroInitFilters(void)
@@ -807,6 +822,10 @@ static FAST_CODE void gyroUpdateSensor(gyroSensor_t *gyroSensor, timeUs_t curren
     }
 #endif
 
+#ifdef USE_RPM_FILTER
+    rpmFilterUpdate(&gyroSensor->rpmFilter);
+#endif
+
     const timeDelta_t sampleDeltaUs = currentTimeUs - accumulationLastTimeSampledUs;
     accumulationLastTimeSampledUs = currentTimeUs;
     accumulatedMeasurementTimeUs += sampleDeltaUs;
@@ -814,73 +833,57 @@ static FAST_CODE void gyroUpdateSensor(gyroSensor_t *gyroSensor, timeUs_t curren
     if (gyroConfig()->checkOverflow) {
         checkForOverflow(gyroSensor, currentTimeUs);
     }
+    // scale gyro output to degrees per second, the fourth lane is the padding of the filter banks
+    float gyroADCf[FILTER_BANK_LANES];
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        gyroADCf[axis] = gyroSensor->gyroDev.gyroADC[axis] * gyroSensor->gyroDev.scale;
+    }
+    gyroADCf[FILTER_BANK_LANES - 1] = 0.0f;
+
     if (gyroDebugMode == DEBUG_NONE) {
-        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
-            // NOTE: this branch optimized for when there is no gyro debugging, ensure it is kept in step with non-optimized branch
-            float gyroADCf = gyroSensor->gyroDev.gyroADC[axis] * gyroSensor->gyroDev.scale;
-#if defined(USE_GYRO_FAST_KALMAN)
-            gyroADCf = gyroSensor->fastKalmanApplyFn((filter_t *)&gyroSensor->fastKalman[axis], gyroADCf);
-#elif defined(USE_GYRO_BIQUAD_RC_FIR2)
-            gyroADCf = gyroSensor->biquadRCFIR2ApplyFn((filter_t *)&gyroSensor->biquadRCFIR2[axis], gyroADCf);
-#endif
-#ifdef USE_GYRO_DATA_ANALYSE
-            gyroADCf = gyroSensor->notchFilterDynApplyFn((filter_t *)&gyroSensor->notchFilterDyn[axis], gyroADCf);
-#endif
-            gyroADCf = gyroSensor->notchFilter1ApplyFn((filter_t *)&gyroSensor->notchFilter1[axis], gyroADCf);
-            gyroADCf = gyroSensor->notchFilter2ApplyFn((filter_t *)&gyroSensor->notchFilter2[axis], gyroADCf);
-            gyroADCf = gyroSensor->softLpfFilterApplyFn(gyroSensor->softLpfFilterPtr[axis], gyroADCf);
-            gyro.gyroADCf[axis] = gyroADCf;
-            if (!gyroSensor->overflowDetected) {
-                // integrate using trapezium rule to avoid bias
-                accumulatedMeasurements[axis] += 0.5f * (gyroPrevious[axis] + gyroADCf) * sampleDeltaUs;
-                gyroPrevious[axis] = gyroADCf;
-            }
+        // NOTE: this branch optimized for when there is no gyro debugging, ensure it is kept in step with non-optimized branch
+        for (int i = 0; i < gyroSensor->filterStageCount; i++) {
+            const gyroFilterStage_t *stage = &gyroSensor->filterStage[i];
+            stage->applyFn(stage->bank, gyroADCf);
         }
     } else {
         for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
             DEBUG_SET(DEBUG_GYRO_RAW, axis, gyroSensor->gyroDev.gyroADCRaw[axis]);
-            // scale gyro output to degrees per second
-            float gyroADCf = gyroSensor->gyroDev.gyroADC[axis] * gyroSensor->gyroDev.scale;
             // DEBUG_GYRO_NOTCH records the unfiltered gyro output
-            DEBUG_SET(DEBUG_GYRO_NOTCH, axis, lrintf(gyroADCf));
-
-#if defined(USE_GYRO_FAST_KALMAN)
-            // apply fast kalman
-            gyroADCf = gyroSensor->fastKalmanApplyFn((filter_t *)&gyroSensor->fastKalman[axis], gyroADCf);
-#elif defined(USE_GYRO_BIQUAD_RC_FIR2)
-            // apply biquad RC+FIR2
-            gyroADCf = gyroSensor->biquadRCFIR2ApplyFn((filter_t *)&gyroSensor->biquadRCFIR2[axis], gyroADCf);
-#endif
-
-#ifdef USE_GYRO_DATA_ANALYSE
-            // apply dynamic notch filter
-            if (isDynamicFilterActive()) {
-                if (axis == 0) {
-                    DEBUG_SET(DEBUG_FFT, 0, lrintf(gyroADCf)); // store raw data
-                }
-                gyroADCf = gyroSensor->notchFilterDynApplyFn((filter_t *)&gyroSensor->notchFilterDyn[axis], gyroADCf);
-                if (axis == 0) {
-                    DEBUG_SET(DEBUG_FFT, 1, lrintf(gyroADCf)); // store data after dynamic notch
+            DEBUG_SET(DEBUG_GYRO_NOTCH, axis, lrintf(gyroADCf[axis]));
+        }
+        bool lpfApplied = false;
+        for (int i = 0; i < gyroSensor->filterStageCount; i++) {
+            const gyroFilterStage_t *stage = &gyroSensor->filterStage[i];
+            if (stage->id == GYRO_FILTER_STAGE_DYN_NOTCH && (i == 0 || stage[-1].id != GYRO_FILTER_STAGE_DYN_NOTCH)) {
+                DEBUG_SET(DEBUG_FFT, 0, lrintf(gyroADCf[X])); // store raw data
+            } else if (stage->id == GYRO_FILTER_STAGE_SOFT_LPF) {
+                // DEBUG_GYRO records the gyro output before the LPF
+                for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+                    DEBUG_SET(DEBUG_GYRO, axis, lrintf(gyroADCf[axis]));
                 }
+                lpfApplied = true;
             }
-#endif
-
-            // apply static notch filters
-            gyroADCf = gyroSensor->notchFilter1ApplyFn((filter_t *)&gyroSensor->notchFilter1[axis], gyroADCf);
-            gyroADCf = gyroSensor->notchFilter2ApplyFn((filter_t *)&gyroSensor->notchFilter2[axis], gyroADCf);
-
-            // apply LPF
-            DEBUG_SET(DEBUG_GYRO, axis, lrintf(gyroADCf));
-            gyroADCf = gyroSensor->softLpfFilterApplyFn(gyroSensor->softLpfFilterPtr[axis], gyroADCf);
-
-            gyro.gyroADCf[axis] = gyroADCf;
-            if (!gyroSensor->overflowDetected) {
-                // integrate using trapezium rule to avoid bias
-                accumulatedMeasurements[axis] += 0.5f * (gyroPrevious[axis] + gyroADCf) * sampleDeltaUs;
-                gyroPrevious[axis] = gyroADCf;
+            stage->applyFn(stage->bank, gyroADCf);
+            if (stage->id == GYRO_FILTER_STAGE_DYN_NOTCH) {
+                DEBUG_SET(DEBUG_FFT, 1, lrintf(gyroADCf[X])); // store data after dynamic notches
+            }
+        }
+        if (!lpfApplied) {
+            for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+                DEBUG_SET(DEBUG_GYRO, axis, lrintf(gyroADCf[axis]));
             }
         }
     }
+
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        gyro.gyroADCf[axis] = gyroADCf[axis];
+        if (!gyroSensor->overflowDetected) {
+            // integrate using trapezium rule to avoid bias
+            accumulatedMeasurements[axis] += 0.5f * (gyroPrevious[axis] + gyroADCf[axis]) * sampleDeltaUs;
+            gyroPrevious[axis] = gyroADCf[axis];
+        }
+    }
 }
 
 FAST_CODE void gyroUpdate(timeUs_t currentTimeUs)
@@ -55,6 +55,15 @@ typedef enum {
     GYRO_OVERFLOW_CHECK_ALL_AXES
 } gyroOverflowCheck_e;
 
+// how the dynamic notch analyser picks the notch frequencies from the spectrum
+typedef enum {
+    DYN_FFT_PEAK_MEAN = 0,          // one notch at the weighted mean of the spectrum
+    DYN_FFT_PEAK_PARABOLIC,         // one notch per peak, parabolic interpolation between bins
+    DYN_FFT_PEAK_GAUSSIAN           // one notch per peak, gaussian (log parabolic) interpolation between bins
+} dynFftPeakMode_e;
+
+#define DYN_NOTCH_COUNT_MAX 3
+
 typedef struct gyroConfig_s {
     sensor_align_e gyro_align;              // gyro alignment
     uint8_t  gyroMovementCalibrationThreshold; // people keep forgetting that moving model while init results in wrong gyro offsets. and then they never reset gyro. so this is now on by default.
@@ -75,6 +84,10 @@ typedef struct gyroConfig_s {
     uint16_t gyro_filter_r;
     uint16_t gyro_filter_p;
     int16_t  gyro_offset_yaw;
+    uint16_t dyn_fft_window;                // dynamic notch FFT size, a power of 2
+    uint16_t dyn_fft_sample_hz;             // gyro data is decimated to this rate before the FFT
+    uint8_t  dyn_fft_peak_mode;             // dynFftPeakMode_e
+    uint8_t  dyn_notch_count;               // number of peaks tracked per axis, not used in MEAN mode
 } gyroConfig_t;
 
 PG_DECLARE(gyroConfig_t, gyroConfig);
@@ -22,6 +22,7 @@
 #ifdef USE_GYRO_DATA_ANALYSE
 #include "arm_math.h"
 
+#include "build/build_config.h"
 #include "build/debug.h"
 
 #include "common/filter.h"
@@ -38,29 +39,37 @@
 // The FFT splits the frequency domain into an number of bins
 // A sampling frequency of 1000 and max frequency of 500 at a window size of 32 gives 16 frequency bins each with a width 31.25Hz
 // Eg [0,31), [31,62), [62, 93) etc
+// A window of 128 at the same sampling rate gives 64 bins of 7.8Hz, at the cost of a 128ms window
 
-#define FFT_WINDOW_SIZE                32  // max for f3 targets
 #define FFT_MIN_FREQ                  100  // not interested in filtering frequencies below 100Hz
-#define FFT_SAMPLING_RATE            1000  // allows analysis up to 500Hz which is more than motors create
-#define FFT_BPF_HZ                    200  // use a bandpass on gyro data to ignore extreme low and extreme high frequencies
+#define FFT_BPF_HZ                    200  // use a bandpass on gyro data to ignore extreme low and extreme high frequencies, at a 1kHz sampling rate
+#define FFT_SLICE_WINDOW_SIZE          64  // above this window size each FFT step gets its own PID cycle
+#define FFT_STEP_LOOPTIME_PERCENT      50  // the longest FFT step, the CFFT, may take up to this share of a gyro cycle
 #define DYN_NOTCH_WIDTH               100  // just an orientation and start value
 #define DYN_NOTCH_CHANGERATE           60  // lower cut does not improve the performance much, higher cut makes it worse...
 #define DYN_NOTCH_MIN_CUTOFF          120  // don't cut too deep into low frequencies
 #define DYN_NOTCH_MAX_CUTOFF          200  // don't go above this cutoff (better filtering with "constant" delay at higher center frequencies)
+#define DYN_NOTCH_PEAK_MIN_RATIO     0.2f  // peaks below this fraction of the highest one are noise, their notches are left where they are
 
 #define BIQUAD_Q 1.0f / sqrtf(2.0f)         // quality factor - butterworth
 
 static uint16_t samplingFrequency;          // gyro rate
+static uint16_t fftWindowSize;
+static uint16_t fftSamplingRate;            // gyro rate after decimation
 static uint8_t fftBinCount;
+static uint8_t fftStartBin;                 // first bin above FFT_MIN_FREQ, peaks are searched from there
 static float fftResolution;                 // hz per bin
-static float gyroData[3][FFT_WINDOW_SIZE];  // gyro data used for frequency analysis
+static uint8_t fftPeakMode;
+static uint8_t dynNotchCount;
+static bool fftSliced;                      // run one step per call, for the larger windows
+static float gyroData[3][GYRO_FFT_WINDOW_SIZE_MAX];  // gyro data used for frequency analysis
 
 static arm_rfft_fast_instance_f32 fftInstance;
-static float fftData[FFT_WINDOW_SIZE];
-static float rfftData[FFT_WINDOW_SIZE];
+static float fftData[GYRO_FFT_WINDOW_SIZE_MAX];
+static float rfftData[GYRO_FFT_WINDOW_SIZE_MAX];
 static gyroFftData_t fftResult[3];
 static uint16_t fftMaxFreq = 0;             // nyquist rate
-static uint16_t fftIdx = 0;                 // use a circular buffer for the last FFT_WINDOW_SIZE samples
+static uint16_t fftIdx = 0;                 // use a circular buffer for the last fftWindowSize samples
 
 
 // accumulator for oversampled data => no aliasing and less noise
@@ -72,22 +81,28 @@ static int fftSamplingScale;
 static biquadFilter_t fftGyroFilter[3];
 
 // filter for smoothing frequency estimation
-static biquadFilter_t fftFreqFilter[3];
+static biquadFilter_t fftFreqFilter[3][DYN_NOTCH_COUNT_MAX];
 
 // Hanning window, see https://en.wikipedia.org/wiki/Window_function#Hann_.28Hanning.29_window
-static float hanningWindow[FFT_WINDOW_SIZE];
+static float hanningWindow[GYRO_FFT_WINDOW_SIZE_MAX];
+
+// notch coefficients over the range the centre frequencies are constrained to
+static biquadNotchTable_t dynNotchTable;
+
+// CFFT step time in us on an F4 at 168MHz, for the windows from 32 up
+static const uint8_t fftCfftTimeUs[] = { 16, 35, 70, 150 };
 
 void initHanning(void)
 {
-    for (int i = 0; i < FFT_WINDOW_SIZE; i++) {
-        hanningWindow[i] = (0.5 - 0.5 * cos_approx(2 * M_PIf * i / (FFT_WINDOW_SIZE - 1)));
+    for (int i = 0; i < fftWindowSize; i++) {
+        hanningWindow[i] = (0.5 - 0.5 * cos_approx(2 * M_PIf * i / (fftWindowSize - 1)));
     }
 }
 
 void initGyroData(void)
 {
     for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
-        for (int i = 0; i < FFT_WINDOW_SIZE; i++) {
+        for (int i = 0; i < GYRO_FFT_WINDOW_SIZE_MAX; i++) {
             gyroData[axis][i] = 0;
         }
     }
@@ -95,29 +110,68 @@ void initGyroData(void)
 
 static inline int fftFreqToBin(int freq)
 {
-    return ((FFT_WINDOW_SIZE / 2 - 1) * freq) / (fftMaxFreq);
+    return ((fftWindowSize / 2 - 1) * freq) / (fftMaxFreq);
+}
+
+static float dynNotchQ(float centerFreq)
+{
+    const float cutoffFreq = constrainf(centerFreq - DYN_NOTCH_WIDTH, DYN_NOTCH_MIN_CUTOFF, DYN_NOTCH_MAX_CUTOFF);
+    return filterGetNotchQApprox(centerFreq, cutoffFreq);
+}
+
+/*
+ * Largest window whose CFFT step fits in the gyro cycle, the step can't be split so the window is limited instead
+ */
+uint16_t gyroDataAnalyseWindowMax(uint32_t targetLooptimeUs)
+{
+    const uint32_t stepBudgetUs = targetLooptimeUs * FFT_STEP_LOOPTIME_PERCENT / 100;
+    uint16_t window = 32;
+    for (unsigned i = 1; i < ARRAYLEN(fftCfftTimeUs) && window < GYRO_FFT_WINDOW_SIZE_MAX && fftCfftTimeUs[i] <= stepBudgetUs; i++) {
+        window *= 2;
+    }
+    return window;
+}
+
+uint8_t gyroDataAnalyseNotchCount(void)
+{
+    if (gyroConfig()->dyn_fft_peak_mode == DYN_FFT_PEAK_MEAN) {
+        return 1;
+    }
+    return constrain(gyroConfig()->dyn_notch_count, 1, DYN_NOTCH_COUNT_MAX);
 }
 
 void gyroDataAnalyseInit(uint32_t targetLooptimeUs)
 {
     // initialise even if FEATURE_DYNAMIC_FILTER not set, since it may be set later
     samplingFrequency = 1000000 / targetLooptimeUs;
-    fftSamplingScale = samplingFrequency / FFT_SAMPLING_RATE;
-    fftMaxFreq = FFT_SAMPLING_RATE / 2;
+    // validateAndFixGyroConfig keeps the window a power of 2 within GYRO_FFT_WINDOW_SIZE_MAX
+    fftWindowSize = constrain(gyroConfig()->dyn_fft_window, 32, gyroDataAnalyseWindowMax(targetLooptimeUs));
+    fftSamplingScale = MAX(samplingFrequency / gyroConfig()->dyn_fft_sample_hz, 1);
+    fftSamplingRate = samplingFrequency / fftSamplingScale;
+    fftMaxFreq = fftSamplingRate / 2;
     fftBinCount = fftFreqToBin(fftMaxFreq) + 1;
-    fftResolution = FFT_SAMPLING_RATE / FFT_WINDOW_SIZE;
-    arm_rfft_fast_init_f32(&fftInstance, FFT_WINDOW_SIZE);
-
+    fftResolution = (float)fftSamplingRate / fftWindowSize;
+    fftStartBin = MAX(lrintf(FFT_MIN_FREQ / fftResolution), 1);
+    fftPeakMode = gyroConfig()->dyn_fft_peak_mode;
+    dynNotchCount = gyroDataAnalyseNotchCount();
+    fftSliced = fftWindowSize > FFT_SLICE_WINDOW_SIZE;
+    arm_rfft_fast_init_f32(&fftInstance, fftWindowSize);
+    biquadNotchTableInit(&dynNotchTable, DYN_NOTCH_MIN_CUTOFF + 10, fftMaxFreq, targetLooptimeUs, dynNotchQ);
+
+    fftIdx = 0;
     initGyroData();
     initHanning();
 
-    // recalculation of filters takes 4 calls per axis => each filter gets updated every 3 * 4 = 12 calls
+    // recalculation of filters takes 4 calls per axis, 7 when sliced => each filter gets updated every 3 * 4 = 12 calls
     // at 4khz gyro loop rate this means 4khz / 4 / 3 = 333Hz => update every 3ms
-    float looptime = targetLooptimeUs * 4 * 3;
+    const int callsPerAxis = fftSliced ? 7 : 4;
+    float looptime = targetLooptimeUs * callsPerAxis * 3;
     for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
-        fftResult[axis].centerFreq = 200; // any init value
-        biquadFilterInitLPF(&fftFreqFilter[axis], DYN_NOTCH_CHANGERATE, looptime);
-        biquadFilterInit(&fftGyroFilter[axis], FFT_BPF_HZ, 1000000 / FFT_SAMPLING_RATE, BIQUAD_Q, FILTER_BPF);
+        for (int i = 0; i < DYN_NOTCH_COUNT_MAX; i++) {
+            fftResult[axis].centerFreq[i] = 200 + 100 * i; // any init value
+            biquadFilterInitLPF(&fftFreqFilter[axis][i], DYN_NOTCH_CHANGERATE, looptime);
+        }
+        biquadFilterInit(&fftGyroFilter[axis], FFT_BPF_HZ * fftSamplingRate / 1000, 1000000 / fftSamplingRate, BIQUAD_Q, FILTER_BPF);
     }
 }
 
@@ -130,15 +184,15 @@ const gyroFftData_t *gyroFftData(int axis)
 /*
  * Collect gyro data, to be analysed in gyroDataAnalyseUpdate function
  */
-void gyroDataAnalyse(const gyroDev_t *gyroDev, biquadFilter_t *notchFilterDyn)
+void gyroDataAnalyse(const gyroDev_t *gyroDev, biquadFilterBank_t *notchFilterDyn)
 {
-    // if gyro sampling is > 1kHz, accumulate multiple samples
+    // if gyro sampling is > dyn_fft_sample_hz, accumulate multiple samples
     for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
         fftAcc[axis] += gyroDev->gyroADC[axis];
     }
     fftAccCount++;
 
-    // this runs at 1kHz
+    // this runs at dyn_fft_sample_hz
     if (fftAccCount == fftSamplingScale) {
         fftAccCount = 0;
 
@@ -152,7 +206,7 @@ void gyroDataAnalyse(const gyroDev_t *gyroDev, biquadFilter_t *notchFilterDyn)
             fftAcc[axis] = 0;
         }
 
-        fftIdx = (fftIdx + 1) % FFT_WINDOW_SIZE;
+        fftIdx = (fftIdx + 1) % fftWindowSize;
     }
 
     // calculate FFT and update filters
@@ -177,9 +231,110 @@ typedef enum {
 } UpdateStep_e;
 
 /*
- * Analyse last gyro data from the last FFT_WINDOW_SIZE milliseconds
+ * Offset of the true peak from bin, in bins, from the magnitudes of the bin and its two neighbours
  */
-void gyroDataAnalyseUpdate(biquadFilter_t *notchFilterDyn)
+STATIC_UNIT_TESTED float fftPeakOffset(float left, float peak, float right, bool gaussian)
+{
+    if (gaussian && left > 0 && right > 0) {
+        // the main lobe of the Hanning window is close to a gaussian, i.e. a parabola of the log magnitudes
+        left = logf(left);
+        peak = logf(peak);
+        right = logf(right);
+    }
+    const float denom = left - 2 * peak + right;
+    if (denom >= 0) {
+        return 0;
+    }
+    return constrainf(0.5f * (left - right) / denom, -0.5f, 0.5f);
+}
+
+/*
+ * Finds the maxCount highest local maxima of the magnitudes from startBin up to binCount and returns their
+ * interpolated positions in bins, lowest first
+ */
+STATIC_UNIT_TESTED int fftFindPeaks(const float *magnitude, int startBin, int binCount, int maxCount, bool gaussian, float *peakPos)
+{
+    int peakBin[DYN_NOTCH_COUNT_MAX];
+    int peakCount = 0;
+
+    maxCount = constrain(maxCount, 1, DYN_NOTCH_COUNT_MAX);
+    for (int i = MAX(startBin, 1); i < binCount - 1; i++) {
+        if (magnitude[i] <= magnitude[i - 1] || magnitude[i] < magnitude[i + 1]) {
+            continue;
+        }
+        // insertion into the list of highest peaks
+        int pos = MIN(peakCount, maxCount - 1);
+        if (peakCount == maxCount && magnitude[i] <= magnitude[peakBin[pos]]) {
+            continue;
+        }
+        while (pos > 0 && magnitude[i] > magnitude[peakBin[pos - 1]]) {
+            peakBin[pos] = peakBin[pos - 1];
+            pos--;
+        }
+        peakBin[pos] = i;
+        peakCount = MIN(peakCount + 1, maxCount);
+    }
+
+    // the list is sorted by magnitude, drop the noise then sort by frequency
+    while (peakCount > 1 && magnitude[peakBin[peakCount - 1]] < DYN_NOTCH_PEAK_MIN_RATIO * magnitude[peakBin[0]]) {
+        peakCount--;
+    }
+    for (int i = 1; i < peakCount; i++) {
+        for (int j = i; j > 0 && peakBin[j] < peakBin[j - 1]; j--) {
+            const int bin = peakBin[j];
+            peakBin[j] = peakBin[j - 1];
+            peakBin[j - 1] = bin;
+        }
+    }
+
+    for (int i = 0; i < peakCount; i++) {
+        const int bin = peakBin[i];
+        peakPos[i] = bin + fftPeakOffset(magnitude[bin - 1], magnitude[bin], magnitude[bin + 1], gaussian);
+    }
+    return peakCount;
+}
+
+/*
+ * Pairs the peaks with the notches, closest pair first, so that each peak moves the notch that is already nearest to
+ * it. Following the frequency order instead would pull a notch onto the band of another one whenever a peak is missing.
+ */
+STATIC_UNIT_TESTED void fftAssignPeaks(const uint16_t *centerFreq, int notchCount, const float *peakFreq, int peakCount, int *peakNotch)
+{
+    bool notchTaken[DYN_NOTCH_COUNT_MAX] = { false };
+
+    for (int i = 0; i < peakCount; i++) {
+        peakNotch[i] = -1;
+    }
+    for (int n = 0; n < MIN(peakCount, notchCount); n++) {
+        int bestPeak = 0;
+        int bestNotch = 0;
+        float bestDistance = INFINITY;
+        for (int i = 0; i < peakCount; i++) {
+            for (int j = 0; j < notchCount; j++) {
+                const float distance = fabsf(peakFreq[i] - centerFreq[j]);
+                if (peakNotch[i] < 0 && !notchTaken[j] && distance < bestDistance) {
+                    bestPeak = i;
+                    bestNotch = j;
+                    bestDistance = distance;
+                }
+            }
+        }
+        peakNotch[bestPeak] = bestNotch;
+        notchTaken[bestNotch] = true;
+    }
+}
+
+static void fftUpdateCenterFreq(int axis, int notch, float freq)
+{
+    freq = constrainf(freq, DYN_NOTCH_MIN_CUTOFF + 10, fftMaxFreq);
+    freq = biquadFilterApply(&fftFreqFilter[axis][notch], freq);
+    fftResult[axis].centerFreq[notch] = constrainf(freq, DYN_NOTCH_MIN_CUTOFF + 10, fftMaxFreq);
+}
+
+/*
+ * Analyse last gyro data from the last fftWindowSize samples
+ */
+void gyroDataAnalyseUpdate(biquadFilterBank_t *notchFilterDyn)
 {
     static int axis = 0;
     static int step = 0;
@@ -193,7 +348,8 @@ void gyroDataAnalyseUpdate(biquadFilter_t *notchFilterDyn)
     switch (step) {
         case STEP_ARM_CFFT_F32:
         {
-            switch (FFT_WINDOW_SIZE / 2) {
+            // in one go whatever the window, gyroDataAnalyseWindowMax() keeps it within the gyro cycle
+            switch (fftWindowSize / 2) {
             case 16:
                 // 16us
                 arm_cfft_radix8by2_f32(Sint, fftData);
@@ -204,7 +360,11 @@ void gyroDataAnalyseUpdate(biquadFilter_t *notchFilterDyn)
                 break;
             case 64:
                 // 70us
-                arm_radix8_butterfly_f32(fftData, FFT_WINDOW_SIZE / 2, Sint->pTwiddle, 1);
+                arm_radix8_butterfly_f32(fftData, fftWindowSize / 2, Sint->pTwiddle, 1);
+                break;
+            case 128:
+                // 150us, a radix 2 stage then two 64 point radix 8 butterflies
+                arm_cfft_radix8by2_f32(Sint, fftData);
                 break;
             }
             DEBUG_SET(DEBUG_FFT_TIME, 1, micros() - startTime);
@@ -215,6 +375,9 @@ void gyroDataAnalyseUpdate(biquadFilter_t *notchFilterDyn)
             // 6us
             arm_bitreversal_32((uint32_t*) fftData, Sint->bitRevLength, Sint->pBitRevTable);
             DEBUG_SET(DEBUG_FFT_TIME, 1, micros() - startTime);
+            if (fftSliced) {
+                break;
+            }
             step++;
             FALLTHROUGH;
         }
@@ -231,57 +394,78 @@ void gyroDataAnalyseUpdate(biquadFilter_t *notchFilterDyn)
             // 8us
             arm_cmplx_mag_f32(rfftData, fftData, fftBinCount);
             DEBUG_SET(DEBUG_FFT_TIME, 2, micros() - startTime);
+            if (fftSliced) {
+                break;
+            }
             step++;
             FALLTHROUGH;
         }
         case STEP_CALC_FREQUENCIES:
         {
             // 13us
-            float fftSum = 0;
-            float fftWeightedSum = 0;
-
+            // iterate over fft data and find the highest value
             fftResult[axis].maxVal = 0;
-            // iterate over fft data and calculate weighted indexes
-            float squaredData;
             for (int i = 0; i < fftBinCount; i++) {
-                squaredData = fftData[i] * fftData[i];  //more weight on higher peaks
-                fftResult[axis].maxVal = MAX(fftResult[axis].maxVal, squaredData);
-                fftSum += squaredData;
-                fftWeightedSum += squaredData * (i + 1); // calculate weighted index starting at 1, not 0
+                fftResult[axis].maxVal = MAX(fftResult[axis].maxVal, fftData[i] * fftData[i]);
             }
 
-            // get weighted center of relevant frequency range (this way we have a better resolution than 31.25Hz)
-            if (fftSum > 0) {
-                // idx was shifted by 1 to start at 1, not 0
-                float fftMeanIndex = (fftWeightedSum / fftSum) - 1;
-                // the index points at the center frequency of each bin so index 0 is actually 16.125Hz
-                // fftMeanIndex += 0.5;
-
-                // don't go below the minimal cutoff frequency + 10 and don't jump around too much
-                float centerFreq;
-                centerFreq = constrain(fftMeanIndex * fftResolution, DYN_NOTCH_MIN_CUTOFF + 10, fftMaxFreq);
-                centerFreq = biquadFilterApply(&fftFreqFilter[axis], centerFreq);
-                centerFreq = constrain(centerFreq, DYN_NOTCH_MIN_CUTOFF + 10, fftMaxFreq);
-                fftResult[axis].centerFreq = centerFreq;
+            if (fftPeakMode == DYN_FFT_PEAK_MEAN) {
+                float fftSum = 0;
+                float fftWeightedSum = 0;
+                // calculate weighted indexes
+                float squaredData;
+                for (int i = 0; i < fftBinCount; i++) {
+                    squaredData = fftData[i] * fftData[i];  //more weight on higher peaks
+                    fftSum += squaredData;
+                    fftWeightedSum += squaredData * (i + 1); // calculate weighted index starting at 1, not 0
+                }
+
+                // get weighted center of relevant frequency range (this way we have a better resolution than the bin width)
+                if (fftSum > 0) {
+                    // idx was shifted by 1 to start at 1, not 0
+                    float fftMeanIndex = (fftWeightedSum / fftSum) - 1;
+                    // the index points at the center frequency of each bin so index 0 is actually 16.125Hz
+                    // fftMeanIndex += 0.5;
+
+                    // don't go below the minimal cutoff frequency + 10 and don't jump around too much
+                    fftUpdateCenterFreq(axis, 0, fftMeanIndex * fftResolution);
+                    if (axis == 0) {
+                        DEBUG_SET(DEBUG_FFT, 3, lrintf(fftMeanIndex * 100));
+                    }
+                }
+            } else {
+                float peakFreq[DYN_NOTCH_COUNT_MAX];
+                int peakNotch[DYN_NOTCH_COUNT_MAX];
+                const int peakCount = fftFindPeaks(fftData, fftStartBin, fftBinCount, dynNotchCount, fftPeakMode == DYN_FFT_PEAK_GAUSSIAN, peakFreq);
+                for (int i = 0; i < peakCount; i++) {
+                    peakFreq[i] *= fftResolution;
+                }
+                // notches without a peak of their own are left where they are
+                fftAssignPeaks(fftResult[axis].centerFreq, dynNotchCount, peakFreq, peakCount, peakNotch);
+                for (int i = 0; i < peakCount; i++) {
+                    fftUpdateCenterFreq(axis, peakNotch[i], peakFreq[i]);
+                }
                 if (axis == 0) {
-                    DEBUG_SET(DEBUG_FFT, 3, lrintf(fftMeanIndex * 100));
+                    DEBUG_SET(DEBUG_FFT, 3, peakCount);
                 }
             }
 
-            DEBUG_SET(DEBUG_FFT_FREQ, axis, fftResult[axis].centerFreq);
+            DEBUG_SET(DEBUG_FFT_FREQ, axis, fftResult[axis].centerFreq[0]);
             DEBUG_SET(DEBUG_FFT_TIME, 1, micros() - startTime);
             break;
         }
         case STEP_UPDATE_FILTERS:
         {
-            // 7us
-            // calculate new filter coefficients
-            float cutoffFreq = constrain(fftResult[axis].centerFreq - DYN_NOTCH_WIDTH, DYN_NOTCH_MIN_CUTOFF, DYN_NOTCH_MAX_CUTOFF);
-            float notchQ = filterGetNotchQApprox(fftResult[axis].centerFreq, cutoffFreq);
-            biquadFilterUpdate(&notchFilterDyn[axis], fftResult[axis].centerFreq, gyro.targetLooptime, notchQ, FILTER_NOTCH);
+            // look up the new filter coefficients, the filter state is kept
+            for (int i = 0; i < dynNotchCount; i++) {
+                biquadFilterBankUpdateNotch(&notchFilterDyn[i], axis, &dynNotchTable, fftResult[axis].centerFreq[i]);
+            }
             DEBUG_SET(DEBUG_FFT_TIME, 1, micros() - startTime);
 
             axis = (axis + 1) % 3;
+            if (fftSliced) {
+                break;
+            }
             step++;
             FALLTHROUGH;
         }
@@ -290,7 +474,7 @@ void gyroDataAnalyseUpdate(biquadFilter_t *notchFilterDyn)
             // 5us
             // apply hanning window to gyro samples and store result in fftData
             // hanning starts and ends with 0, could be skipped for minor speed improvement
-            uint8_t ringBufIdx = FFT_WINDOW_SIZE - fftIdx;
+            const uint16_t ringBufIdx = fftWindowSize - fftIdx;
             arm_mult_f32(&gyroData[axis][fftIdx], &hanningWindow[0], &fftData[0], ringBufIdx);
             if (fftIdx > 0)
                 arm_mult_f32(&gyroData[axis][0], &hanningWindow[ringBufIdx], &fftData[ringBufIdx], fftIdx);
@@ -20,14 +20,29 @@
 #include "common/time.h"
 #include "common/filter.h"
 
-#define GYRO_FFT_BIN_COUNT      16 // FFT_WINDOW_SIZE / 2
+#include "sensors/gyro.h"
+
+// largest FFT the RAM and the per-step CPU budget allow, the window is set with dyn_fft_window
+#ifndef GYRO_FFT_WINDOW_SIZE_MAX
+#if defined(STM32F7)
+#define GYRO_FFT_WINDOW_SIZE_MAX   256
+#elif defined(STM32F4)
+#define GYRO_FFT_WINDOW_SIZE_MAX   128
+#else
+#define GYRO_FFT_WINDOW_SIZE_MAX    32 // max for f3 targets
+#endif
+#endif
+#define GYRO_FFT_BIN_COUNT_MAX     (GYRO_FFT_WINDOW_SIZE_MAX / 2)
+
 typedef struct gyroFftData_s {
     float maxVal;
-    uint16_t centerFreq;
+    uint16_t centerFreq[DYN_NOTCH_COUNT_MAX];   // one per dynamic notch, each following the peak nearest to it
 } gyroFftData_t;
 
 void gyroDataAnalyseInit(uint32_t targetLooptime);
+uint16_t gyroDataAnalyseWindowMax(uint32_t targetLooptime);
+uint8_t gyroDataAnalyseNotchCount(void);
 const gyroFftData_t *gyroFftData(int axis);
 struct gyroDev_s;
-void gyroDataAnalyse(const struct gyroDev_s *gyroDev, biquadFilter_t *notchFilterDyn);
-void gyroDataAnalyseUpdate(biquadFilter_t *notchFilterDyn);
+void gyroDataAnalyse(const struct gyroDev_s *gyroDev, biquadFilterBank_t *notchFilterDyn);
+void gyroDataAnalyseUpdate(biquadFilterBank_t *notchFilterDyn);
@@ -40,6 +40,7 @@
 #include "drivers/rangefinder/rangefinder.h"
 #include "drivers/rangefinder/rangefinder_hcsr04.h"
 #include "drivers/rangefinder/rangefinder_lidartf.h"
+#include "drivers/rangefinder/rangefinder_fake.h"
 
 #include "fc/config.h"
 #include "fc/runtime_config.h"
@@ -66,10 +67,16 @@ rangefinder_t rangefinder;
 #define RANGEFINDER_DYNAMIC_THRESHOLD           600     //Used to determine max. usable rangefinder disatance
 #define RANGEFINDER_DYNAMIC_FACTOR              75
 
+#ifdef USE_FAKE_RANGEFINDER
+#define RANGEFINDER_DEFAULT_HARDWARE RANGEFINDER_FAKE
+#else
+#define RANGEFINDER_DEFAULT_HARDWARE RANGEFINDER_NONE
+#endif
+
 PG_REGISTER_WITH_RESET_TEMPLATE(rangefinderConfig_t, rangefinderConfig, PG_RANGEFINDER_CONFIG, 0);
 
 PG_RESET_TEMPLATE(rangefinderConfig_t, rangefinderConfig,
-    .rangefinder_hardware = RANGEFINDER_NONE,
+    .rangefinder_hardware = RANGEFINDER_DEFAULT_HARDWARE,
 );
 
 #ifdef USE_RANGEFINDER_HCSR04
@@ -162,6 +169,15 @@ static bool rangefinderDetect(rangefinderDev_t * dev, uint8_t rangefinderHardwar
 #endif
             break;
 
+        case RANGEFINDER_FAKE:
+#if defined(USE_FAKE_RANGEFINDER)
+            if (fakeRangefinderDetect(dev)) {
+                rangefinderHardware = RANGEFINDER_FAKE;
+                rescheduleTask(TASK_RANGEFINDER, TASK_PERIOD_MS(RANGEFINDER_FAKE_TASK_PERIOD_MS));
+            }
+#endif
+            break;
+
         case RANGEFINDER_NONE:
             rangefinderHardware = RANGEFINDER_NONE;
             break;
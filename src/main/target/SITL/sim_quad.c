@@ -0,0 +1,411 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "platform.h"
+
+#include "common/maths.h"
+
+#include "drivers/barometer/barometer_fake.h"
+#include "drivers/rangefinder/rangefinder.h"
+#include "drivers/rangefinder/rangefinder_fake.h"
+#include "drivers/time.h"
+
+#include "flight/ol_filter.h"
+#include "flight/ol_flightplan.h"
+#include "flight/ol_navigation.h"
+
+#include "target/SITL/sim_quad.h"
+
+#define GRAVITY 9.80665
+
+// Same layout as servo_packet: front right (CCW), back left (CCW), front left (CW), back right (CW)
+static const double motorX[4] = {  1, -1,  1, -1 };
+static const double motorY[4] = {  1, -1, -1,  1 };
+static const double motorSpin[4] = {  1,  1, -1, -1 }; // yaw torque on the body, NED
+
+static simQuadConfig_t config = {
+    .rateHz = 1000,
+
+    .mass = 0.5,
+    .arm = 0.09,
+    .inertia = { 1.5e-3, 1.5e-3, 2.5e-3 },
+
+    .motorTau = 0.03,
+    .thrustMax = 5.8,
+    .thrustExpo = 1.0,
+    .torqueCoeff = 0.012,
+
+    .dragLin = 0.15,
+    .dragQuad = 0.02,
+    .dragRot = 2e-4,
+
+    .gateRateHz = 25,
+    .gateLatencyMs = 40,
+    .gateRangeMax = 6,
+    .gateFov = 70,
+    .gateNoise = 0.03,
+    .gateOutlier = 0.02,
+
+    .seed = 1,
+};
+
+typedef struct simQuadParam_s {
+    const char *name;
+    double *value;
+} simQuadParam_t;
+
+static const simQuadParam_t params[] = {
+    { "rate_hz", &config.rateHz },
+    { "mass", &config.mass },
+    { "arm", &config.arm },
+    { "ixx", &config.inertia[0] },
+    { "iyy", &config.inertia[1] },
+    { "izz", &config.inertia[2] },
+    { "motor_tau", &config.motorTau },
+    { "thrust_max", &config.thrustMax },
+    { "thrust_expo", &config.thrustExpo },
+    { "torque_coeff", &config.torqueCoeff },
+    { "drag_lin", &config.dragLin },
+    { "drag_quad", &config.dragQuad },
+    { "drag_rot", &config.dragRot },
+    { "gate_rate_hz", &config.gateRateHz },
+    { "gate_latency_ms", &config.gateLatencyMs },
+    { "gate_range_max", &config.gateRangeMax },
+    { "gate_fov", &config.gateFov },
+    { "gate_noise", &config.gateNoise },
+    { "gate_outlier", &config.gateOutlier },
+};
+
+typedef struct simQuadState_s {
+    double time;                // s
+    double pos[3];              // m, NED
+    double vel[3];              // m/s, NED
+    double q[4];                // body to NED, w x y z
+    double rate[3];             // rad/s, body FRD
+    double motor[4];            // normalised motor speed
+} simQuadState_t;
+
+static simQuadState_t state;
+static volatile float motorCommand[4];
+static uint32_t randomState;
+
+// pending gate detection, delivered after the configured latency
+static bool gatePending;
+static double gateCaptureTime;
+static double gateDx, gateDy, gateDz;
+static double nextGateTime;
+
+// newest delivered detection, repeated in every packet until the next one so none is lost to a skipped packet
+static uint32_t gateDeliveredCnt;
+static double gateDelivered[3];
+static double gateDeliveredTime;
+
+static uint32_t gateAppliedCnt;     // main loop only
+
+static bool loadParams(const char *filename)
+{
+    FILE *f = fopen(filename, "r");
+    if (f == NULL) {
+        fprintf(stderr, "[simQuad] cannot open '%s'\n", filename);
+        return false;
+    }
+
+    char line[128];
+    char name[64];
+    double value;
+    while (fgets(line, sizeof(line), f)) {
+        if (line[0] == '#' || sscanf(line, "%63s %lf", name, &value) != 2) {
+            continue;
+        }
+        bool found = false;
+        for (unsigned i = 0; i < ARRAYLEN(params); i++) {
+            if (strcmp(name, params[i].name) == 0) {
+                *params[i].value = value;
+                found = true;
+            }
+        }
+        if (strcmp(name, "seed") == 0) {
+            config.seed = (uint32_t)value;
+            found = true;
+        }
+        if (!found) {
+            fprintf(stderr, "[simQuad] unknown parameter '%s'\n", name);
+        }
+    }
+    fclose(f);
+    return true;
+}
+
+// xorshift32, runs are reproducible for a given seed
+static double randomUniform(void)
+{
+    randomState ^= randomState << 13;
+    randomState ^= randomState >> 17;
+    randomState ^= randomState << 5;
+    return (randomState >> 8) * (1.0 / 16777216.0);
+}
+
+static double randomGauss(void)
+{
+    const double u = randomUniform() + 1e-12;
+    const double v = randomUniform();
+    return sqrt(-2.0 * log(u)) * cos(2.0 * M_PI * v);
+}
+
+bool simQuadInit(const char *spec)
+{
+    if (spec == NULL || strncmp(spec, "quad", 4) != 0) {
+        return false;
+    }
+    if (spec[4] == ':' && !loadParams(spec + 5)) {
+        return false;
+    }
+
+    memset(&state, 0, sizeof(state));
+    state.q[0] = 1;
+    for (int i = 0; i < 4; i++) {
+        motorCommand[i] = 0;
+    }
+    randomState = config.seed ? config.seed : 1;
+    gatePending = false;
+    nextGateTime = 0;
+    gateDeliveredCnt = 0;
+    gateAppliedCnt = 0;
+
+    printf("[simQuad] %.0f Hz, mass %.3f kg, arm %.3f m, thrust %.2f N per motor\n", config.rateHz, config.mass, config.arm, config.thrustMax);
+    return true;
+}
+
+double simQuadDt(void)
+{
+    return 1.0 / config.rateHz;
+}
+
+void simQuadSetMotors(const float *motorSpeed)
+{
+    for (int i = 0; i < 4; i++) {
+        motorCommand[i] = motorSpeed[i];
+    }
+}
+
+static void rotationMatrix(const double *q, double R[3][3])
+{
+    const double w = q[0], x = q[1], y = q[2], z = q[3];
+
+    R[0][0] = 1 - 2 * (y * y + z * z);
+    R[0][1] = 2 * (x * y - w * z);
+    R[0][2] = 2 * (x * z + w * y);
+    R[1][0] = 2 * (x * y + w * z);
+    R[1][1] = 1 - 2 * (x * x + z * z);
+    R[1][2] = 2 * (y * z - w * x);
+    R[2][0] = 2 * (x * z - w * y);
+    R[2][1] = 2 * (y * z + w * x);
+    R[2][2] = 1 - 2 * (x * x + y * y);
+}
+
+// Camera looks forward, report the closest flightplan gate in view relative to the drone in the navigation frame
+static void captureGate(double R[3][3])
+{
+    const double yaw = atan2(R[1][0], R[0][0]);
+    double best = config.gateRangeMax;
+    bool found = false;
+
+    for (int i = 0; i < OL_FLIGHTPLAN_MAX_GATES; i++) {
+        const olGate_t *gate = olGates(i);
+        if (gate->speed == 0) {
+            break;
+        }
+        const double dx = gate->x * 0.01 - state.pos[0];
+        const double dy = gate->y * 0.01 - state.pos[1];
+        const double dist = sqrt(dx * dx + dy * dy);
+        double bearing = atan2(dy, dx) - yaw;
+        bearing = remainder(bearing, 2 * M_PI);
+        if (dist < best && dist > 0.3 && fabs(bearing) < config.gateFov * M_PI / 360) {
+            best = dist;
+            gateDx = dx;
+            gateDy = dy;
+            gateDz = gate->alt * 0.01 + state.pos[2];
+            found = true;
+        }
+    }
+    if (!found) {
+        return;
+    }
+
+    gateDx += randomGauss() * config.gateNoise * best;
+    gateDy += randomGauss() * config.gateNoise * best;
+    if (randomUniform() < config.gateOutlier) {
+        // misdetection, e.g. another gate or a reflection
+        gateDx += (randomUniform() - 0.5) * 6;
+        gateDy += (randomUniform() - 0.5) * 6;
+    }
+    gateCaptureTime = state.time;
+    gatePending = true;
+}
+
+static void updateGateDetection(double R[3][3])
+{
+    if (gatePending && state.time >= gateCaptureTime + config.gateLatencyMs * 1e-3) {
+        gateDelivered[0] = gateDx;
+        gateDelivered[1] = gateDy;
+        gateDelivered[2] = gateDz;
+        gateDeliveredTime = state.time;
+        gateDeliveredCnt++;
+        gatePending = false;
+    }
+
+    if (!gatePending && state.time >= nextGateTime && config.gateRateHz > 0) {
+        nextGateTime = state.time + 1.0 / config.gateRateHz;
+        captureGate(R);
+    }
+}
+
+/**
+ * Advance the model by one step with the last motor command and fill the packet an external simulator would send,
+ * and the sensors it has no fields for. Runs in the model thread, nothing of the firmware is touched here.
+ */
+void simQuadStep(fdm_packet *pkt, simQuadSensors_t *sensors)
+{
+    const double dt = simQuadDt();
+    double R[3][3];
+    rotationMatrix(state.q, R);
+
+    // motors
+    double thrust = 0;
+    double torque[3] = { 0, 0, 0 };
+    const double armXY = config.arm * M_SQRT1_2;
+    for (int i = 0; i < 4; i++) {
+        const double command = constrainf(motorCommand[i], 0.0f, 1.0f);
+        state.motor[i] += (command - state.motor[i]) * dt / (config.motorTau + dt);
+        const double w = state.motor[i];
+        const double t = config.thrustMax * ((1 - config.thrustExpo) * w + config.thrustExpo * w * w);
+        thrust += t;
+        // r x F with F = (0, 0, -t)
+        torque[0] += -motorY[i] * armXY * t;
+        torque[1] += motorX[i] * armXY * t;
+        torque[2] += motorSpin[i] * config.torqueCoeff * t;
+    }
+
+    // rotation, Euler's equations
+    double I[3];
+    for (int i = 0; i < 3; i++) {
+        I[i] = config.inertia[i];
+        torque[i] -= config.dragRot * state.rate[i];
+    }
+    const double p = state.rate[0], q = state.rate[1], r = state.rate[2];
+    state.rate[0] += (torque[0] - (I[2] - I[1]) * q * r) / I[0] * dt;
+    state.rate[1] += (torque[1] - (I[0] - I[2]) * r * p) / I[1] * dt;
+    state.rate[2] += (torque[2] - (I[1] - I[0]) * p * q) / I[2] * dt;
+
+    // translation, NED
+    double acc[3];
+    const double speed = sqrt(state.vel[0] * state.vel[0] + state.vel[1] * state.vel[1] + state.vel[2] * state.vel[2]);
+    for (int i = 0; i < 3; i++) {
+        const double drag = config.dragLin * state.vel[i] + config.dragQuad * speed * state.vel[i];
+        acc[i] = (-R[i][2] * thrust - drag) / config.mass;
+    }
+    acc[2] += GRAVITY;
+
+    for (int i = 0; i < 3; i++) {
+        state.vel[i] += acc[i] * dt;
+        state.pos[i] += state.vel[i] * dt;
+    }
+
+    // ground, resting level until the motors lift it
+    if (state.pos[2] >= 0) {
+        state.pos[2] = 0;
+        if (state.vel[2] > 0) {
+            memset(state.vel, 0, sizeof(state.vel));
+            memset(state.rate, 0, sizeof(state.rate));
+            acc[0] = acc[1] = acc[2] = 0;
+        }
+    }
+
+    // attitude
+    const double *qa = state.q;
+    const double dq[4] = {
+        0.5 * (-qa[1] * state.rate[0] - qa[2] * state.rate[1] - qa[3] * state.rate[2]),
+        0.5 * ( qa[0] * state.rate[0] + qa[2] * state.rate[2] - qa[3] * state.rate[1]),
+        0.5 * ( qa[0] * state.rate[1] - qa[1] * state.rate[2] + qa[3] * state.rate[0]),
+        0.5 * ( qa[0] * state.rate[2] + qa[1] * state.rate[1] - qa[2] * state.rate[0]),
+    };
+    double norm = 0;
+    for (int i = 0; i < 4; i++) {
+        state.q[i] += dq[i] * dt;
+        norm += state.q[i] * state.q[i];
+    }
+    norm = 1.0 / sqrt(norm);
+    for (int i = 0; i < 4; i++) {
+        state.q[i] *= norm;
+    }
+    state.time += dt;
+    rotationMatrix(state.q, R);
+
+    // sensors
+    pkt->timestamp = state.time;
+    for (int i = 0; i < 3; i++) {
+        pkt->imu_angular_velocity_rpy[i] = state.rate[i];
+        // specific force in the body frame
+        pkt->imu_linear_acceleration_xyz[i] = R[0][i] * acc[0] + R[1][i] * acc[1] + R[2][i] * (acc[2] - GRAVITY);
+        pkt->velocity_xyz[i] = state.vel[i];
+        pkt->position_xyz[i] = state.pos[i];
+    }
+    for (int i = 0; i < 4; i++) {
+        pkt->imu_orientation_quat[i] = state.q[i];
+    }
+
+    const double altitude = -state.pos[2];
+    sensors->pressure = lrint(101325.0 * pow(1.0 - 2.25577e-5 * altitude, 5.25588));
+    if (R[2][2] > 0.5) {
+        sensors->rangefinder = lrint(altitude / R[2][2] * 100);
+    } else {
+        sensors->rangefinder = RANGEFINDER_OUT_OF_RANGE;
+    }
+
+    updateGateDetection(R);
+    sensors->gateCnt = gateDeliveredCnt;
+    for (int i = 0; i < 3; i++) {
+        sensors->gate[i] = gateDelivered[i];
+    }
+    sensors->gateTime = gateDeliveredTime;
+}
+
+/**
+ * Hand the sensors of a model step to the fake drivers and the outer loop, from the main loop.
+ *
+ * @param timestamp model time of the step, the fdm_packet timestamp
+ */
+void simQuadApplySensors(const simQuadSensors_t *sensors, double timestamp)
+{
+    fakeBaroSet(sensors->pressure, 2500);
+    fakeRangefinderSet(sensors->rangefinder);
+
+    if (sensors->gateCnt != gateAppliedCnt) {
+        gateAppliedCnt = sensors->gateCnt;
+        // same path as a detection arriving over MAVLink, the arrival time is the model time since on the firmware clock
+        const timeUs_t arrivalUs = micros() - lrint((timestamp - sensors->gateTime) * 1e6);
+        ol_filter_push_vision(sensors->gate[0], sensors->gate[1], sensors->gate[2],
+            arrivalUs - olNavigationConfig()->vision_latency_ms * 1000);
+    }
+}
@@ -0,0 +1,72 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Built-in quadrotor model, replaces the external simulator and its UDP link
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "platform.h"
+
+#define SIM_QUAD_ENV "SITL_MODEL"   // "quad" or "quad:<parameter file>"
+
+typedef struct simQuadConfig_s {
+    double rateHz;              // physics steps (fdm_packets) per second
+
+    // airframe, X configuration
+    double mass;                // kg
+    double arm;                 // m, motor to centre
+    double inertia[3];          // kg m^2, body x, y, z
+
+    // motors and propellers
+    double motorTau;            // s, first order motor response
+    double thrustMax;           // N per motor at full command
+    double thrustExpo;          // 0 thrust linear in command, 1 quadratic
+    double torqueCoeff;         // m, yaw torque per N of thrust
+
+    // aerodynamics
+    double dragLin;             // N per m/s
+    double dragQuad;            // N per (m/s)^2
+    double dragRot;             // Nm per rad/s
+
+    // JeVois like gate detections
+    double gateRateHz;
+    double gateLatencyMs;
+    double gateRangeMax;        // m
+    double gateFov;             // deg, full horizontal field of view
+    double gateNoise;           // m per m distance, standard deviation
+    double gateOutlier;         // probability of a misdetection
+
+    uint32_t seed;
+} simQuadConfig_t;
+
+// Sensors of a model step the fdm_packet has no fields for, applied by the main loop with the packet
+typedef struct simQuadSensors_s {
+    int32_t pressure;           // Pa
+    int32_t rangefinder;        // cm, RANGEFINDER_OUT_OF_RANGE when tilted too far
+    uint32_t gateCnt;           // gate detections delivered so far
+    double gate[3];             // m, newest detection, gate relative to the drone
+    double gateTime;            // s, model time the newest detection was delivered
+} simQuadSensors_t;
+
+bool simQuadInit(const char *spec);
+void simQuadSetMotors(const float *motorSpeed);
+void simQuadStep(fdm_packet *pkt, simQuadSensors_t *sensors);
+void simQuadApplySensors(const simQuadSensors_t *sensors, double timestamp);
+double simQuadDt(void);
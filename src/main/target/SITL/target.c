@@ -43,55 +43,108 @@ const timerHardware_t timerHardware[1]; // unused
 
 #include "config/feature.h"
 #include "fc/config.h"
+#include "fc/fc_init.h"
 #include "scheduler/scheduler.h"
 
 #include "rx/rx.h"
 
 #include "dyad.h"
 #include "target/SITL/udplink.h"
+#include "target/SITL/sim_quad.h"
 
-static fdm_packet fdmPkt;
 static servo_packet pwmPkt;
 
 static struct timespec start_time;
+#if !defined(SIMULATOR_LOCKSTEP)
 static double simRate = 1.0;
+#endif
 static pthread_t tcpWorker, udpWorker;
 static bool workerRunning = true;
+static bool useSimQuad = false;  // built-in model instead of an external simulator
 static udpLink_t stateLink, pwmLink;
-static pthread_mutex_t updateLock;
-static pthread_mutex_t mainLoopLock;
+
+// everything the simulator queued since the last wake up, received in one syscall
+#define FDM_RING_SIZE 16
+static fdm_packet fdmRing[FDM_RING_SIZE];
+static uint32_t fdmReceived = 0;
+static uint32_t fdmDropped = 0;     // stale, a newer packet was in the same batch
+
+// fdm_packet and the sensors of the built-in model the packet has no fields for
+typedef struct {
+    fdm_packet fdm;
+    simQuadSensors_t sensors;   // useSimQuad only
+} simPacket_t;
+
+#if !defined(SIMULATOR_LOCKSTEP)
+// Newest fdm_packet, handed from udpThread/simThread to the main loop without locks (triple buffer).
+// The producer owns fdmSlot[fdmSlotBack], the main loop fdmSlot[fdmSlotFront], fdmSlotMiddle is swapped atomically.
+#define FDM_SLOT_NEW 0x80
+static simPacket_t fdmSlot[3];
+static uint8_t fdmSlotBack = 0;
+static uint8_t fdmSlotMiddle = 1;   // | FDM_SLOT_NEW while the main loop has not taken it
+static uint8_t fdmSlotFront = 2;
+
+// both only touched by the main loop, updateState() runs there
+static bool motorUpdatePending = true;  // one servo_packet per fdm_packet
+static bool mainLoopReleased = true;    // SIMULATOR_GYROPID_SYNC
+
+static simPacket_t* fdmSlotWriteBuffer(void) {
+    return &fdmSlot[fdmSlotBack];
+}
+
+static void fdmSlotPublish(void) {
+    fdmSlotBack = __atomic_exchange_n(&fdmSlotMiddle, fdmSlotBack | FDM_SLOT_NEW, __ATOMIC_ACQ_REL) & ~FDM_SLOT_NEW;
+}
+
+static const simPacket_t* fdmSlotTake(void) {
+    if (!(__atomic_load_n(&fdmSlotMiddle, __ATOMIC_ACQUIRE) & FDM_SLOT_NEW)) {
+        return NULL;
+    }
+    fdmSlotFront = __atomic_exchange_n(&fdmSlotMiddle, fdmSlotFront, __ATOMIC_ACQ_REL) & ~FDM_SLOT_NEW;
+    return &fdmSlot[fdmSlotFront];
+}
+#endif
+
+#if defined(SIMULATOR_LOCKSTEP)
+#if defined(SIMULATOR_GYROPID_SYNC)
+#error "SIMULATOR_LOCKSTEP already synchronises the main loop, do not combine it with SIMULATOR_GYROPID_SYNC"
+#endif
+// Virtual clock, only advanced by the main loop (lockstepAdvance) and delays, read by micros()/millis()
+static volatile uint64_t simTimeUs = 0;
+static uint64_t stepEndUs = 0;      // virtual time the current simulator step runs to
+static bool stepRunning = false;    // main loop is executing a step, udpThread waits for it
+static pthread_mutex_t stepLock;
+static pthread_cond_t stepCond;
+#endif
 
 int timeval_sub(struct timespec *result, struct timespec *x, struct timespec *y);
+void microsleep(uint32_t usec);
 
+#if !defined(SIMULATOR_LOCKSTEP)
 int lockMainPID(void) {
-    return pthread_mutex_trylock(&mainLoopLock);
+    if (!mainLoopReleased) {
+        return -1;
+    }
+    mainLoopReleased = false;
+    return 0;
 }
+#endif
 
 #define RAD2DEG (180.0 / M_PI)
 #define ACC_SCALE (256 / 9.80665)
 #define GYRO_SCALE (16.4)
 void sendMotorUpdate() {
-    udpSend(&pwmLink, &pwmPkt, sizeof(servo_packet));
-}
-void updateState(const fdm_packet* pkt) {
-    static double last_timestamp = 0; // in seconds
-    static uint64_t last_realtime = 0; // in uS
-    static struct timespec last_ts; // last packet
-
-    struct timespec now_ts;
-    clock_gettime(CLOCK_MONOTONIC, &now_ts);
-
-    const uint64_t realtime_now = micros64_real();
-    if (realtime_now > last_realtime + 500*1e3) { // 500ms timeout
-        last_timestamp = pkt->timestamp;
-        last_realtime = realtime_now;
-        sendMotorUpdate();
+    if (useSimQuad) {
+        simQuadSetMotors(pwmPkt.motor_speed);
         return;
     }
+    udpSend(&pwmLink, &pwmPkt, sizeof(servo_packet));
+}
+static void updateSensors(const fdm_packet* pkt, const simQuadSensors_t* sensors, double deltaSim) {
+    UNUSED(deltaSim);
 
-    const double deltaSim = pkt->timestamp - last_timestamp;  // in seconds
-    if (deltaSim < 0) { // don't use old packet
-        return;
+    if (sensors) {
+        simQuadApplySensors(sensors, pkt->timestamp);
     }
 
     int16_t x,y,z;
@@ -142,6 +195,89 @@ void updateState(const fdm_packet* pkt) {
     imuSetHasNewData(deltaSim*1e6);
     imuUpdateAttitude(micros());
 #endif
+}
+
+#if defined(SIMULATOR_LOCKSTEP)
+// Let the main loop run up to the end of the simulator step and wait for it, called from udpThread
+static void lockstepRun(double deltaSim) {
+    pthread_mutex_lock(&stepLock);
+    stepEndUs += (uint64_t)(deltaSim * 1e6 + 0.5);
+    if (stepEndUs < simTimeUs) {
+        // first packet, or the firmware was delayed during init
+        stepEndUs = simTimeUs;
+    }
+    stepRunning = true;
+    pthread_cond_broadcast(&stepCond);
+    while (stepRunning && workerRunning) {
+        pthread_cond_wait(&stepCond, &stepLock);
+    }
+    pthread_mutex_unlock(&stepLock);
+}
+
+// Called once per main loop iteration, every iteration takes exactly SIMULATOR_LOCKSTEP_LOOP_US of virtual time
+void lockstepAdvance(void) {
+    pthread_mutex_lock(&stepLock);
+    if (simTimeUs < stepEndUs) {
+        simTimeUs += SIMULATOR_LOCKSTEP_LOOP_US;
+    }
+    if (simTimeUs >= stepEndUs) {
+        // step done, hand the motor outputs to udpThread and wait for the next fdm_packet
+        stepRunning = false;
+        pthread_cond_broadcast(&stepCond);
+        while (!stepRunning && workerRunning) {
+            pthread_cond_wait(&stepCond, &stepLock);
+        }
+    }
+    pthread_mutex_unlock(&stepLock);
+}
+
+static void lockstepRelease(void) {
+    pthread_mutex_lock(&stepLock);
+    stepRunning = false;
+    pthread_cond_broadcast(&stepCond);
+    pthread_mutex_unlock(&stepLock);
+}
+
+void updateState(const fdm_packet* pkt, const simQuadSensors_t* sensors) {
+    static double last_timestamp = 0; // in seconds
+    static bool started = false;
+
+    double deltaSim = started ? pkt->timestamp - last_timestamp : 0;  // in seconds
+    if (deltaSim < 0) { // simulator restarted, keep the virtual clock monotonic
+        deltaSim = 0;
+    }
+    last_timestamp = pkt->timestamp;
+    started = true;
+
+    updateSensors(pkt, sensors, deltaSim);
+    lockstepRun(deltaSim);
+
+    // exactly one servo_packet per fdm_packet, after the step completed
+    sendMotorUpdate();
+}
+#else
+void updateState(const fdm_packet* pkt, const simQuadSensors_t* sensors) {
+    static double last_timestamp = 0; // in seconds
+    static uint64_t last_realtime = 0; // in uS
+    static struct timespec last_ts; // last packet
+
+    struct timespec now_ts;
+    clock_gettime(CLOCK_MONOTONIC, &now_ts);
+
+    const uint64_t realtime_now = micros64_real();
+    if (realtime_now > last_realtime + 500*1e3) { // 500ms timeout
+        last_timestamp = pkt->timestamp;
+        last_realtime = realtime_now;
+        sendMotorUpdate();
+        return;
+    }
+
+    const double deltaSim = pkt->timestamp - last_timestamp;  // in seconds
+    if (deltaSim < 0) { // don't use old packet
+        return;
+    }
+
+    updateSensors(pkt, sensors, deltaSim);
 
 
     if (deltaSim < 0.02 && deltaSim > 0) { // simulator should run faster than 50Hz
@@ -158,26 +294,98 @@ void updateState(const fdm_packet* pkt) {
     last_ts.tv_sec = now_ts.tv_sec;
     last_ts.tv_nsec = now_ts.tv_nsec;
 
-    pthread_mutex_unlock(&updateLock); // can send PWM output now
+    motorUpdatePending = true; // can send PWM output now
+    mainLoopReleased = true; // can run main loop
+}
 
-#if defined(SIMULATOR_GYROPID_SYNC)
-    pthread_mutex_unlock(&mainLoopLock); // can run main loop
-#endif
+// Called from the main loop, applies the newest fdm_packet if there is one
+void simulatorPoll(void) {
+    const simPacket_t* pkt = fdmSlotTake();
+    if (pkt) {
+        updateState(&pkt->fdm, useSimQuad ? &pkt->sensors : NULL);
+    }
 }
+#endif
 
 static void* udpThread(void* data) {
     UNUSED(data);
-    int n = 0;
+    int lens[FDM_RING_SIZE];
+
+    while (workerRunning) {
+        int n = udpRecvBatch(&stateLink, fdmRing, sizeof(fdm_packet), FDM_RING_SIZE, lens, 100);
+#if defined(SIMULATOR_LOCKSTEP)
+        // every packet is a simulator step, none can be skipped
+        for (int i = 0; i < n; i++) {
+            if (lens[i] == sizeof(fdm_packet)) {
+                fdmReceived++;
+                updateState(&fdmRing[i], NULL);
+            }
+        }
+#else
+        // only the newest state is of any use to the main loop, keep draining while the ring fills up
+        bool fresh = false;
+        while (n > 0) {
+            int newest = -1;
+            for (int i = 0; i < n; i++) {
+                if (lens[i] == sizeof(fdm_packet)) {
+                    fdmReceived++;
+                    fdmDropped += (fresh || newest >= 0);
+                    newest = i;
+                }
+            }
+            if (newest >= 0) {
+                fdmSlotWriteBuffer()->fdm = fdmRing[newest];
+                fresh = true;
+            }
+            n = (n == FDM_RING_SIZE) ? udpRecvBatch(&stateLink, fdmRing, sizeof(fdm_packet), FDM_RING_SIZE, lens, 0) : 0;
+        }
+        if (fresh) {
+            fdmSlotPublish();
+        }
+#endif
+    }
+
+    printf("udpThread end!! %u fdm_packets, %u stale dropped\n", fdmReceived, fdmDropped);
+    return NULL;
+}
+
+// Drives the firmware from the built-in model, one fdm_packet per model step
+static void* simThread(void* data) {
+    UNUSED(data);
+
+    // the sensors the model feeds do not exist before init() completed
+    while (workerRunning && !(systemState & SYSTEM_STATE_READY)) {
+        microsleep(1000);
+    }
+
+#if !defined(SIMULATOR_LOCKSTEP)
+    const uint64_t stepNs = simQuadDt() * 1e9;
+    uint64_t nextNs = nanos64_real();
+#endif
 
     while (workerRunning) {
-        n = udpRecv(&stateLink, &fdmPkt, sizeof(fdm_packet), 100);
-        if (n == sizeof(fdm_packet)) {
-//            printf("[data]new fdm %d\n", n);
-            updateState(&fdmPkt);
+#if defined(SIMULATOR_LOCKSTEP)
+        simPacket_t pkt;
+        simQuadStep(&pkt.fdm, &pkt.sensors);
+        updateState(&pkt.fdm, &pkt.sensors);
+#else
+        simPacket_t* pkt = fdmSlotWriteBuffer();
+        simQuadStep(&pkt->fdm, &pkt->sensors);
+        fdmSlotPublish();
+
+        // real time, pace the model by the wall clock
+        nextNs += stepNs;
+        const uint64_t nowNs = nanos64_real();
+        if (nextNs > nowNs) {
+            microsleep((nextNs - nowNs) / 1000);
+        } else {
+            // fell behind, do not burst, simRate is estimated from the packet spacing
+            nextNs = nowNs;
         }
+#endif
     }
 
-    printf("udpThread end!!\n");
+    printf("simThread end!!\n");
     return NULL;
 }
 
@@ -207,15 +415,13 @@ void systemInit(void) {
     SystemCoreClock = 500 * 1e6; // fake 500MHz
     FLASH_Unlock();
 
-    if (pthread_mutex_init(&updateLock, NULL) != 0) {
-        printf("Create updateLock error!\n");
-        exit(1);
-    }
-
-    if (pthread_mutex_init(&mainLoopLock, NULL) != 0) {
-        printf("Create mainLoopLock error!\n");
+#if defined(SIMULATOR_LOCKSTEP)
+    if (pthread_mutex_init(&stepLock, NULL) != 0 || pthread_cond_init(&stepCond, NULL) != 0) {
+        printf("Create stepLock error!\n");
         exit(1);
     }
+    printf("[system]lockstep with simulator, %d us per main loop iteration\n", SIMULATOR_LOCKSTEP_LOOP_US);
+#endif
 
     ret = pthread_create(&tcpWorker, NULL, tcpThread, NULL);
     if (ret != 0) {
@@ -223,13 +429,19 @@ void systemInit(void) {
         exit(1);
     }
 
-    ret = udpInit(&pwmLink, "127.0.0.1", 9002, false);
-    printf("init PwnOut UDP link...%d\n", ret);
+    useSimQuad = simQuadInit(getenv(SIM_QUAD_ENV));
+    if (useSimQuad) {
+        printf("[system]built-in quadrotor model, no UDP link\n");
+        ret = pthread_create(&udpWorker, NULL, simThread, NULL);
+    } else {
+        ret = udpInit(&pwmLink, "127.0.0.1", 9002, false);
+        printf("init PwnOut UDP link...%d\n", ret);
 
-    ret = udpInit(&stateLink, NULL, 9003, true);
-    printf("start UDP server...%d\n", ret);
+        ret = udpInit(&stateLink, NULL, 9003, true);
+        printf("start UDP server...%d\n", ret);
 
-    ret = pthread_create(&udpWorker, NULL, udpThread, NULL);
+        ret = pthread_create(&udpWorker, NULL, udpThread, NULL);
+    }
     if (ret != 0) {
         printf("Create udpWorker error!\n");
         exit(1);
@@ -242,6 +454,9 @@ void systemInit(void) {
 void systemReset(void){
     printf("[system]Reset!\n");
     workerRunning = false;
+#if defined(SIMULATOR_LOCKSTEP)
+    lockstepRelease();
+#endif
     pthread_join(tcpWorker, NULL);
     pthread_join(udpWorker, NULL);
     exit(0);
@@ -249,6 +464,9 @@ void systemReset(void){
 void systemResetToBootloader(void) {
     printf("[system]ResetToBootloader!\n");
     workerRunning = false;
+#if defined(SIMULATOR_LOCKSTEP)
+    lockstepRelease();
+#endif
     pthread_join(tcpWorker, NULL);
     pthread_join(udpWorker, NULL);
     exit(0);
@@ -292,6 +510,15 @@ uint64_t millis64_real() {
     return 1.0e3*((ts.tv_sec + (ts.tv_nsec*1.0e-9)) - (start_time.tv_sec + (start_time.tv_nsec*1.0e-9)));
 }
 
+#if defined(SIMULATOR_LOCKSTEP)
+uint64_t micros64() {
+    return simTimeUs;
+}
+
+uint64_t millis64() {
+    return simTimeUs / 1000;
+}
+#else
 uint64_t micros64() {
     static uint64_t last = 0;
     static uint64_t out = 0;
@@ -315,6 +542,7 @@ uint64_t millis64() {
     return out*1e-6;
 //    return millis64_real();
 }
+#endif
 
 uint32_t micros(void) {
     return micros64() & 0xFFFFFFFF;
@@ -331,20 +559,31 @@ void microsleep(uint32_t usec) {
     while (nanosleep(&ts, &ts) == -1 && errno == EINTR) ;
 }
 
+#if defined(SIMULATOR_LOCKSTEP)
+// nothing else advances the virtual clock while the main loop is blocked in a delay
+void delayMicroseconds(uint32_t us) {
+    simTimeUs += us;
+}
+#else
 void delayMicroseconds(uint32_t us) {
     microsleep(us / simRate);
 }
+#endif
 
 void delayMicroseconds_real(uint32_t us) {
     microsleep(us);
 }
 
 void delay(uint32_t ms) {
+#if defined(SIMULATOR_LOCKSTEP)
+    delayMicroseconds(ms * 1000);
+#else
     uint64_t start = millis64();
 
     while ((millis64() - start) < ms) {
         microsleep(1000);
     }
+#endif
 }
 
 // Subtract the ‘struct timespec’ values X and Y,  storing the result in RESULT.
@@ -440,9 +679,12 @@ void pwmCompleteMotorUpdate(uint8_t motorCount) {
     pwmPkt.motor_speed[1] = motorsPwm[2] / outScale;
     pwmPkt.motor_speed[2] = motorsPwm[3] / outScale;
 
+#if !defined(SIMULATOR_LOCKSTEP) // in lockstep udpThread sends the outputs once the step completed
     // get one "fdm_packet" can only send one "servo_packet"!!
-    if (pthread_mutex_trylock(&updateLock) != 0) return;
-    udpSend(&pwmLink, &pwmPkt, sizeof(servo_packet));
+    if (!motorUpdatePending) return;
+    motorUpdatePending = false;
+    sendMotorUpdate();
+#endif
 //    printf("[pwm]%u:%u,%u,%u,%u\n", idlePulse, motorsPwm[0], motorsPwm[1], motorsPwm[2], motorsPwm[3]);
 }
 
@@ -38,6 +38,12 @@
 //#define SIMULATOR_IMU_SYNC
 //#define SIMULATOR_GYROPID_SYNC
 
+// run in lockstep with the simulator: every fdm_packet advances a virtual clock by its timestamp delta,
+// runs the main loop up to that time and answers with exactly one servo_packet. Deterministic and not
+// bound to real time. Build with EXTRA_FLAGS=-DSIMULATOR_LOCKSTEP or uncomment.
+//#define SIMULATOR_LOCKSTEP
+#define SIMULATOR_LOCKSTEP_LOOP_US      50  // virtual duration of one main loop iteration
+
 // file name to save config
 #define EEPROM_FILENAME "eeprom.bin"
 #define EEPROM_IN_RAM
@@ -67,6 +73,9 @@
 #define USE_BARO
 #define USE_FAKE_BARO
 
+#define USE_RANGEFINDER
+#define USE_FAKE_RANGEFINDER
+
 #define USABLE_TIMER_CHANNEL_COUNT 0
 
 #define USE_UART1
@@ -261,3 +270,5 @@ uint64_t micros64(void);
 uint64_t millis64(void);
 
 int lockMainPID(void);
+void simulatorPoll(void);
+void lockstepAdvance(void);
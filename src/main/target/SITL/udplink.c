@@ -5,6 +5,8 @@
  * under the terms of the MIT license.
  */
 
+#define _GNU_SOURCE // recvmmsg
+
 #include <string.h>
 
 #include <fcntl.h>
@@ -65,3 +67,39 @@ int udpRecv(udpLink_t* link, void* data, size_t size, uint32_t timeout_ms) {
     ret = recvfrom(link->fd, data, size, 0, (struct sockaddr *)&link->recv, &len);
     return ret;
 }
+
+int udpRecvBatch(udpLink_t* link, void* ring, size_t size, int count, int* lens, uint32_t timeout_ms) {
+    struct mmsghdr msgs[UDP_BATCH_MAX];
+    struct iovec iovecs[UDP_BATCH_MAX];
+    fd_set fds;
+    struct timeval tv;
+
+    if (count > UDP_BATCH_MAX) {
+        count = UDP_BATCH_MAX;
+    }
+
+    FD_ZERO(&fds);
+    FD_SET(link->fd, &fds);
+
+    tv.tv_sec = timeout_ms / 1000;
+    tv.tv_usec = (timeout_ms % 1000) * 1000UL;
+
+    if (select(link->fd+1, &fds, NULL, NULL, &tv) != 1) {
+        return -1;
+    }
+
+    memset(msgs, 0, sizeof(msgs[0]) * count);
+    for (int i = 0; i < count; i++) {
+        iovecs[i].iov_base = (uint8_t *)ring + i * size;
+        iovecs[i].iov_len = size;
+        msgs[i].msg_hdr.msg_iov = &iovecs[i];
+        msgs[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    // everything already queued in one syscall, straight into the ring
+    int ret = recvmmsg(link->fd, msgs, count, MSG_DONTWAIT, NULL);
+    for (int i = 0; i < ret; i++) {
+        lens[i] = msgs[i].msg_len;
+    }
+    return ret;
+}
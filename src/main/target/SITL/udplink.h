@@ -19,6 +19,8 @@
 extern "C" {
 #endif
 
+#define UDP_BATCH_MAX 32
+
 typedef struct {
     int fd;
     struct sockaddr_in si;
@@ -31,6 +33,8 @@ typedef struct {
 int udpInit(udpLink_t* link, const char* addr, int port, bool isServer);
 int udpRecv(udpLink_t* link, void* data, size_t size, uint32_t timeout_ms);
 int udpSend(udpLink_t* link, const void* data, size_t size);
+// receive up to count datagrams of at most size bytes into consecutive ring entries, lens[] gets their lengths
+int udpRecvBatch(udpLink_t* link, void* ring, size_t size, int count, int* lens, uint32_t timeout_ms);
 
 #ifdef __cplusplus
 } // extern "C"
@@ -47,6 +47,7 @@
 #ifdef STM32F4
 #define USE_DSHOT
 #define USE_ESC_SENSOR
+#define USE_RPM_FILTER
 #define I2C3_OVERCLOCK true
 #define USE_GYRO_DATA_ANALYSE
 #define USE_ADC
@@ -64,6 +65,7 @@
 #ifdef STM32F7
 #define USE_DSHOT
 #define USE_ESC_SENSOR
+#define USE_RPM_FILTER
 #define I2C3_OVERCLOCK true
 #define I2C4_OVERCLOCK true
 #define USE_GYRO_DATA_ANALYSE
@@ -148,6 +150,7 @@
 #define USE_RTC_TIME
 #define USE_RX_MSP
 #define USE_SERIALRX_FPORT      // FrSky FPort
+#define USE_TASK_HISTOGRAM
 #define USE_TELEMETRY_CRSF
 #define USE_TELEMETRY_SRXL
 #define USE_VIRTUAL_CURRENT_METER
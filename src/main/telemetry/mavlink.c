@@ -50,6 +50,8 @@
 #include "flight/failsafe.h"
 #include "flight/navigation.h"
 #include "flight/altitude.h"
+#include "flight/ol_filter.h"
+#include "flight/ol_navigation.h"
 
 #include "io/serial.h"
 #include "io/gimbal.h"
@@ -69,6 +71,7 @@
 
 #include "telemetry/telemetry.h"
 #include "telemetry/mavlink.h"
+#include "telemetry/mavlink_rx.h"
 
 #include "build/debug.h"
 
@@ -80,8 +83,6 @@
 #pragma GCC diagnostic pop
 
 #define TELEMETRY_MAVLINK_INITIAL_PORT_MODE MODE_TX
-#define TELEMETRY_MAVLINK_MAXRATE 50
-#define TELEMETRY_MAVLINK_DELAY ((1000 * 1000) / TELEMETRY_MAVLINK_MAXRATE)
 
 extern uint16_t rssi; // FIXME dependency on mw.c
 
@@ -90,14 +91,7 @@ static serialPortConfig_t *portConfig;
 
 static bool mavlinkTelemetryEnabled =  false;
 static portSharing_e mavlinkPortSharing;
-static uint32_t lastJeVoistime = 0;
-static uint32_t lastJeVoischeck = 0;
 uint8_t my_mode = 0;
-uint8_t JeVois_alive = 0;
-float uart_altitude;
-float uart_roll;
-float uart_pitch;
-float uart_yaw;
 
 float my_param[8] = {0,0,0,0,0,0,0,0};
 
@@ -105,101 +99,154 @@ char param_name[6];
 
 uint8_t parameterchanged = 0;
 
+/*
+ * Serial RX callback: completes frames, stamps them with the time their last byte arrived and queues the
+ * decoded payload for the navigation task. Nothing here touches navigation or controller state.
+ */
 static void mavlinkReceive(uint16_t c, void *data)
 {
     UNUSED(data);
-    mavlink_message_t msg;
+    static mavlink_message_t msg;
+    static bool seqValid = false;
+    static uint8_t seqNext;
     mavlink_status_t status;
-    if(mavlink_parse_char(MAVLINK_COMM_0, (uint8_t)c,&msg,&status))
-    {
 
-        switch(msg.msgid)
-        {
-            case 105: // highres_imu for test of communication
-            {
-                mavlink_highres_imu_t hr;
-                mavlink_msg_highres_imu_decode(&msg,&hr);
-                uart_altitude = hr.abs_pressure;
-                DEBUG_SET(DEBUG_UART,1,hr.time_usec);	
-                DEBUG_SET(DEBUG_UART,3,100*uart_altitude);
-                break;
-            }
-            case 81: //setpoint command
-            {
-                lastJeVoistime = micros();
-                mavlink_manual_setpoint_t command;
-                mavlink_msg_manual_setpoint_decode(&msg,&command);
-                uart_altitude = -command.thrust * 100;
-                uart_roll = command.roll;   //maybe need normalization but this should be done in the JeVois
-                uart_pitch = -command.pitch;
-                uart_yaw = command.yaw;
-                DEBUG_SET(DEBUG_UART,1,command.time_boot_ms);	
-                DEBUG_SET(DEBUG_UART,3,uart_altitude);
-                DEBUG_SET(DEBUG_COMMAND,0,uart_altitude);
-                DEBUG_SET(DEBUG_COMMAND,1,uart_roll / 3.14 * 180);
-                DEBUG_SET(DEBUG_COMMAND,2,uart_pitch / 3.14 * 180);
-                DEBUG_SET(DEBUG_COMMAND,3,uart_yaw / 3.14 * 180);
-                break;
-            }
-            case 21:
-            {
-                DEBUG_SET(DEBUG_REQUEST,0,100);
-                break;
-            }
-            case 102:
-            {
-                mavlink_vision_position_estimate_t vision;
-                mavlink_msg_vision_position_estimate_decode(&msg,&vision);
-                DEBUG_SET(DEBUG_PHIL,0,vision.x);
-                DEBUG_SET(DEBUG_PHIL,1,vision.y);
-            }
-        }
+    const uint8_t received = mavlink_parse_char(MAVLINK_COMM_0, (uint8_t)c, &msg, &status);
+    if (status.packet_rx_drop_count) {
+        mavlinkRxCountLost(0, status.packet_rx_drop_count);
+    }
+    if (!received) {
+        return;
+    }
+
+    mavlinkRxMessage_t rx;
+    rx.rxTimeUs = microsISR();
+
+    // Frames lost on the wire show up as gaps in the sender's sequence numbers
+    if (seqValid && msg.seq != seqNext) {
+        mavlinkRxCountLost((uint8_t)(msg.seq - seqNext), 0);
+    }
+    seqNext = msg.seq + 1;
+    seqValid = true;
+
+    switch (msg.msgid) {
+    case MAVLINK_MSG_ID_MANUAL_SETPOINT:
+    {
+        mavlink_manual_setpoint_t command;
+        mavlink_msg_manual_setpoint_decode(&msg, &command);
+        rx.type = MAVLINK_RX_SETPOINT;
+        rx.data.setpoint.timeBootMs = command.time_boot_ms;
+        rx.data.setpoint.roll = command.roll;
+        rx.data.setpoint.pitch = command.pitch;
+        rx.data.setpoint.yaw = command.yaw;
+        rx.data.setpoint.thrust = command.thrust;
+        break;
+    }
+    case MAVLINK_MSG_ID_VISION_POSITION_ESTIMATE:
+    {
+        mavlink_vision_position_estimate_t vision;
+        mavlink_msg_vision_position_estimate_decode(&msg, &vision);
+        rx.type = MAVLINK_RX_VISION;
+        rx.data.vision.usec = vision.usec;
+        rx.data.vision.x = vision.x;
+        rx.data.vision.y = vision.y;
+        rx.data.vision.z = vision.z;
+        break;
+    }
+    case MAVLINK_MSG_ID_HIGHRES_IMU: // for test of communication
+    {
+        mavlink_highres_imu_t hr;
+        mavlink_msg_highres_imu_decode(&msg, &hr);
+        rx.type = MAVLINK_RX_HIGHRES_IMU;
+        rx.data.imu.usec = hr.time_usec;
+        rx.data.imu.absPressure = hr.abs_pressure;
+        break;
+    }
+    case MAVLINK_MSG_ID_PARAM_REQUEST_LIST:
+        DEBUG_SET(DEBUG_REQUEST, 0, 100);
+        FALLTHROUGH;
+    default:
+        rx.type = MAVLINK_RX_OTHER;
+        break;
     }
+
+    mavlinkRxPush(&rx);
 }
 
-/* MAVLink datastream rates in Hz */
-static const uint8_t mavRates[] = {
-    [MAV_DATA_STREAM_EXTENDED_STATUS] = 1, //1Hz
-    [MAV_DATA_STREAM_RC_CHANNELS] = 5, //5Hz
-    [MAV_DATA_STREAM_POSITION] = 2, //2Hz
-    [MAV_DATA_STREAM_EXTRA1] = 15, //15Hz
-    [MAV_DATA_STREAM_EXTRA2] = 15 //15Hz
+#define MAVLINK_TX_BUFFER_SIZE      512     // one scheduler pass worth of frames, flushed with a single write
+#define MAVLINK_TX_BUDGET_WINDOW_US 20000   // bandwidth that can be saved up while the streams are idle
+
+typedef struct mavlinkStream_s {
+    timeUs_t nextDueUs;
+    mavlinkTxStats_t stats;
+} mavlinkStream_t;
+
+static mavlinkStream_t mavStreams[MAVLINK_STREAM_COUNT];
+
+#define MAVLINK_FRAME_LEN(payloadLen)   (MAVLINK_NUM_NON_PAYLOAD_BYTES + (payloadLen))
+
+// Largest burst of each stream, a burst can be smaller than the last one but never larger than this
+static const uint16_t mavStreamBurstMax[MAVLINK_STREAM_COUNT] = {
+    [MAVLINK_STREAM_HEARTBEAT] = MAVLINK_FRAME_LEN(MAVLINK_MSG_ID_HEARTBEAT_LEN),
+    [MAVLINK_STREAM_STATUS] = MAVLINK_FRAME_LEN(MAVLINK_MSG_ID_SYS_STATUS_LEN) + MAVLINK_FRAME_LEN(MAVLINK_MSG_ID_PARAM_REQUEST_READ_LEN)
+        + MAVLINK_FRAME_LEN(MAVLINK_MSG_ID_PARAM_VALUE_LEN),
+    [MAVLINK_STREAM_ATTITUDE_QUATERNION] = MAVLINK_FRAME_LEN(MAVLINK_MSG_ID_ATTITUDE_QUATERNION_LEN),
+    [MAVLINK_STREAM_LOCAL_POSITION] = MAVLINK_FRAME_LEN(MAVLINK_MSG_ID_LOCAL_POSITION_NED_LEN),
+    [MAVLINK_STREAM_ODOMETRY] = MAVLINK_FRAME_LEN(MAVLINK_MSG_ID_LOCAL_POSITION_NED_LEN)
+        + MAVLINK_FRAME_LEN(MAVLINK_MSG_ID_ATTITUDE_QUATERNION_LEN),
+    [MAVLINK_STREAM_STATES] = MAVLINK_FRAME_LEN(MAVLINK_MSG_ID_HIGHRES_IMU_LEN) + MAVLINK_FRAME_LEN(MAVLINK_MSG_ID_ATTITUDE_LEN)
+        + MAVLINK_FRAME_LEN(MAVLINK_MSG_ID_SET_MODE_LEN),
 };
+static mavlink_message_t mavMsg;
 
-#define MAXSTREAMS (sizeof(mavRates) / sizeof(mavRates[0]))
+static uint8_t mavTxBuffer[MAVLINK_TX_BUFFER_SIZE];
+static uint16_t mavTxLength;
+static uint32_t mavTxBytesSent;
 
-static uint8_t mavTicks[MAXSTREAMS];
-static mavlink_message_t mavMsg;
-static uint8_t mavBuffer[MAVLINK_MAX_PACKET_LEN];
-static uint32_t lastMavlinkMessage = 0;
+// Bandwidth budget in bytes, refilled at the line rate of the port
+static uint32_t mavTxBytesPerSecond;
+static int32_t mavTxBudget;
+static timeUs_t mavTxBudgetTimeUs;
 
-static int mavlinkStreamTrigger(enum MAV_DATA_STREAM streamNum)
+static void mavlinkFlush(void)
 {
-    uint8_t rate = (uint8_t) mavRates[streamNum];
-    if (rate == 0) {
-        return 0;
+    if (mavTxLength) {
+        serialWriteBuf(mavlinkPort, mavTxBuffer, mavTxLength);
+        mavTxBytesSent += mavTxLength;
+        mavTxLength = 0;
     }
+}
 
-    if (mavTicks[streamNum] == 0) {
-        // we're triggering now, setup the next trigger point
-        if (rate > TELEMETRY_MAVLINK_MAXRATE) {
-            rate = TELEMETRY_MAVLINK_MAXRATE;
-        }
-
-        mavTicks[streamNum] = (TELEMETRY_MAVLINK_MAXRATE / rate);
-        return 1;
+// Append the packed mavMsg to the transmit buffer, written out as one block at the end of the pass
+static void mavlinkSendMessage(void)
+{
+    if (mavTxLength + MAVLINK_MAX_PACKET_LEN > MAVLINK_TX_BUFFER_SIZE) {
+        mavlinkFlush();
     }
-
-    // count down at TASK_RATE_HZ
-    mavTicks[streamNum]--;
-    return 0;
+    mavTxLength += mavlink_msg_to_send_buffer(mavTxBuffer + mavTxLength, &mavMsg);
 }
 
-
-static void mavlinkSerialWrite(uint8_t * buf, uint16_t length)
+static void mavlinkStartStreams(void)
 {
-    for (int i = 0; i < length; i++)
-        serialWrite(mavlinkPort, buf[i]);
+    // 8N1, ten bits on the wire per byte
+    mavTxBytesPerSecond = mavlinkPort->baudRate / 10;
+    mavTxBudget = 0;
+    mavTxBudgetTimeUs = micros();
+    mavTxLength = 0;
+
+    const telemetryConfig_t *config = telemetryConfig();
+    const uint8_t rates[MAVLINK_STREAM_COUNT] = {
+        [MAVLINK_STREAM_ATTITUDE_QUATERNION] = config->mavlink_attitude_hz,
+        [MAVLINK_STREAM_LOCAL_POSITION] = config->mavlink_position_hz,
+        [MAVLINK_STREAM_ODOMETRY] = config->mavlink_odometry_hz,
+        [MAVLINK_STREAM_STATES] = 15,
+        [MAVLINK_STREAM_HEARTBEAT] = 5,
+        [MAVLINK_STREAM_STATUS] = 1,
+    };
+    for (int i = 0; i < MAVLINK_STREAM_COUNT; i++) {
+        mavStreams[i].stats.rateHz = MIN(rates[i], MAVLINK_STREAM_MAX_RATE_HZ);
+        mavStreams[i].nextDueUs = mavTxBudgetTimeUs;
+    }
 }
 
 void freeMAVLinkTelemetryPort(void)
@@ -233,6 +280,7 @@ void configureMAVLinkTelemetryPort(void)
         return;
     }
 
+    mavlinkStartStreams();
     mavlinkTelemetryEnabled = true;
 }
 
@@ -241,6 +289,7 @@ void checkMAVLinkTelemetryState(void)
     if (portConfig && telemetryCheckRxPortShared(portConfig)) {
         if (!mavlinkTelemetryEnabled && telemetrySharedPort != NULL) {
             mavlinkPort = telemetrySharedPort;
+            mavlinkStartStreams();
             mavlinkTelemetryEnabled = true;
         }
     } else {
@@ -259,8 +308,6 @@ void checkMAVLinkTelemetryState(void)
 
 void mavlinkSendSystemStatus(void)
 {
-    uint16_t msgLength;
-
     uint32_t onboardControlAndSensors = 35843;
 
     /*
@@ -318,13 +365,11 @@ void mavlinkSendSystemStatus(void)
         0,
         // errors_count4 Autopilot-specific errors
         0);
-    msgLength = mavlink_msg_to_send_buffer(mavBuffer, &mavMsg);
-    mavlinkSerialWrite(mavBuffer, msgLength);
+    mavlinkSendMessage();
 }
 
 void mavlinkSendRCChannelsAndRSSI(void)
 {
-    uint16_t msgLength;
     mavlink_msg_rc_channels_raw_pack(0, 200, &mavMsg,
         // time_boot_ms Timestamp (milliseconds since system boot)
         millis(),
@@ -348,13 +393,11 @@ void mavlinkSendRCChannelsAndRSSI(void)
         (rxRuntimeConfig.channelCount >= 8) ? rcData[7] : 0,
         // rssi Receive signal strength indicator, 0: 0%, 255: 100%
         scaleRange(getRssi(), 0, 1023, 0, 255));
-    msgLength = mavlink_msg_to_send_buffer(mavBuffer, &mavMsg);
-    mavlinkSerialWrite(mavBuffer, msgLength);
+    mavlinkSendMessage();
 }
 
 void mavlinkSendHeartbeat(void)
 {
-    uint16_t msgLength;
     mavlink_msg_heartbeat_pack(0, 200, &mavMsg,
         // time_boot_ms Timestamp (milliseconds since system boot)
         // type
@@ -367,14 +410,12 @@ void mavlinkSendHeartbeat(void)
         0,
         // system_status
         0);
-    msgLength = mavlink_msg_to_send_buffer(mavBuffer, &mavMsg);
-    mavlinkSerialWrite(mavBuffer, msgLength);
+    mavlinkSendMessage();
 }
 
 #if defined(USE_GPS)
 void mavlinkSendPosition(void)
 {
-    uint16_t msgLength;
     uint8_t gpsFixType = 0;
 
     if (!sensors(SENSOR_GPS))
@@ -413,8 +454,7 @@ void mavlinkSendPosition(void)
         gpsSol.groundCourse * 10,
         // satellites_visible Number of satellites visible. If unknown, set to 255
         gpsSol.numSat);
-    msgLength = mavlink_msg_to_send_buffer(mavBuffer, &mavMsg);
-    mavlinkSerialWrite(mavBuffer, msgLength);
+    mavlinkSendMessage();
 
     // Global position
     mavlink_msg_global_position_int_pack(0, 200, &mavMsg,
@@ -441,8 +481,7 @@ void mavlinkSendPosition(void)
         // heading Current heading in degrees, in compass units (0..360, 0=north)
         DECIDEGREES_TO_DEGREES(attitude.values.yaw)
     );
-    msgLength = mavlink_msg_to_send_buffer(mavBuffer, &mavMsg);
-    mavlinkSerialWrite(mavBuffer, msgLength);
+    mavlinkSendMessage();
 
     mavlink_msg_gps_global_origin_pack(0, 200, &mavMsg,
         // latitude Latitude (WGS84), expressed as * 1E7
@@ -451,15 +490,13 @@ void mavlinkSendPosition(void)
         GPS_home[LON],
         // altitude Altitude(WGS84), expressed as * 1000
         0);
-    msgLength = mavlink_msg_to_send_buffer(mavBuffer, &mavMsg);
-    mavlinkSerialWrite(mavBuffer, msgLength);
+    mavlinkSendMessage();
 }
 #endif
 
 // send MAV states via MAVlink
 void mavlinkSendMAVStates(void)
 {
-    uint16_t msgLength;
     mavlink_msg_highres_imu_pack(0, 200, &mavMsg,
     // time_boot_ms Timestamp (milliseconds since system boot)
     (uint64_t)microsISR(),
@@ -491,8 +528,7 @@ void mavlinkSendMAVStates(void)
     0,
     // extract 4
     0);
-    msgLength = mavlink_msg_to_send_buffer(mavBuffer, &mavMsg);
-    mavlinkSerialWrite(mavBuffer, msgLength);
+    mavlinkSendMessage();
     DEBUG_SET(DEBUG_UART,2,my_altitude);
     DEBUG_SET(DEBUG_MSG,0,accmx);
     DEBUG_SET(DEBUG_MSG,1,accmy);
@@ -507,7 +543,6 @@ void mavlinkSendMAVStates(void)
 
 void mavlinkSendAttitude(void)
 {
-    uint16_t msgLength;
     mavlink_msg_attitude_pack(0, 200, &mavMsg,
         // time_boot_ms Timestamp (milliseconds since system boot)
         millis(),
@@ -523,22 +558,16 @@ void mavlinkSendAttitude(void)
         0,
         // yawspeed Yaw angular speed (rad/s)
         0);
-    msgLength = mavlink_msg_to_send_buffer(mavBuffer, &mavMsg);
-    mavlinkSerialWrite(mavBuffer, msgLength);
+    mavlinkSendMessage();
 }
 
 // send MAV states via MAVlink
 void mavlinkSendMAVMode(void)
 {
     // check if Jevois still alive
-    lastJeVoischeck = micros();
-    if(lastJeVoischeck - lastJeVoistime < 5000000)
-    {
-        JeVois_alive = 1;
-    }
-    else
-    {
-        JeVois_alive = 0;
+    const mavlinkLinkHealth_e jevoisHealth = mavlinkRxLinkHealth(micros());
+    const uint8_t jevoisAlive = jevoisHealth == MAVLINK_LINK_OK || jevoisHealth == MAVLINK_LINK_STALE;
+    if (!jevoisAlive) {
         beeper(BEEPER_RX_LOST);
     }
     if(FLIGHT_MODE(RANGEFINDER_MODE))
@@ -549,27 +578,23 @@ void mavlinkSendMAVMode(void)
     {
         my_mode = 2;
     }
-    uint16_t msgLength;
     mavlink_msg_set_mode_pack(0, 200, &mavMsg,
     // time_boot_ms Timestamp (milliseconds since system boot)
     0,
     my_mode,
-    JeVois_alive);
-    msgLength = mavlink_msg_to_send_buffer(mavBuffer, &mavMsg);
-    mavlinkSerialWrite(mavBuffer, msgLength);
+    jevoisAlive);
+    mavlinkSendMessage();
 }
 
 void mavlinkSendMAVParam(void)
 {
-    uint16_t msgLength;
     char name[16] = {'P','A','R','A','M'};
     mavlink_msg_param_request_read_pack(0, 200, &mavMsg,
     1,
     1,
     name,
     0);
-    msgLength = mavlink_msg_to_send_buffer(mavBuffer, &mavMsg);
-    mavlinkSerialWrite(mavBuffer, msgLength);
+    mavlinkSendMessage();
     mavlink_msg_param_value_pack(0, 200, &mavMsg,
     // time_boot_ms Timestamp (milliseconds since system boot)
     name,
@@ -577,13 +602,11 @@ void mavlinkSendMAVParam(void)
     0,
     1,
     0);
-    msgLength = mavlink_msg_to_send_buffer(mavBuffer, &mavMsg);
-    mavlinkSerialWrite(mavBuffer, msgLength);
+    mavlinkSendMessage();
 }
 
 void mavlinkSendHUDAndHeartbeat(void)
 {
-    uint16_t msgLength;
     float mavAltitude = 0;
     float mavGroundSpeed = 0;
     float mavAirSpeed = 0;
@@ -628,8 +651,7 @@ void mavlinkSendHUDAndHeartbeat(void)
         mavAltitude,
         // climb Current climb rate in meters/second
         mavClimbRate);
-    msgLength = mavlink_msg_to_send_buffer(mavBuffer, &mavMsg);
-    mavlinkSerialWrite(mavBuffer, msgLength);
+    mavlinkSendMessage();
 
 
     uint8_t mavModes = MAV_MODE_FLAG_MANUAL_INPUT_ENABLED;
@@ -710,30 +732,149 @@ void mavlinkSendHUDAndHeartbeat(void)
         mavCustomMode,
         // system_status System status flag, see MAV_STATE ENUM
         mavSystemState);
-    msgLength = mavlink_msg_to_send_buffer(mavBuffer, &mavMsg);
-    mavlinkSerialWrite(mavBuffer, msgLength);
+    mavlinkSendMessage();
 }
 
-void processMAVLinkTelemetry(void)
+// ATTITUDE_QUATERNION: the IMU quaternion is a half turn about x away from the NED earth / FRD body convention
+static void mavlinkSendAttitudeQuaternion(uint32_t timeBootMs)
 {
-    DEBUG_SET(DEBUG_UART,0,100);
-    // is executed @ TELEMETRY_MAVLINK_MAXRATE rate
-    if (mavlinkStreamTrigger(MAV_DATA_STREAM_EXTENDED_STATUS)) {
-        mavlinkSendSystemStatus();
-        mavlinkSendMAVParam();
+    quaternion quat;
+    imuGetQuaternion(&quat);
+
+    mavlink_msg_attitude_quaternion_pack(0, 200, &mavMsg,
+        // time_boot_ms Timestamp (milliseconds since system boot)
+        timeBootMs,
+        // q1..q4 Quaternion components, w, x, y, z
+        quat.w, quat.x, -quat.y, -quat.z,
+        // rollspeed, pitchspeed, yawspeed Body angular speed (rad/s)
+        DEGREES_TO_RADIANS(gyro.gyroADCf[X]),
+        -DEGREES_TO_RADIANS(gyro.gyroADCf[Y]),
+        -DEGREES_TO_RADIANS(gyro.gyroADCf[Z]));
+    mavlinkSendMessage();
+}
+
+// LOCAL_POSITION_NED from the outer loop estimate, dr_state is x north, y east, z up relative to the flightplan start
+static void mavlinkSendLocalPosition(uint32_t timeBootMs)
+{
+    mavlink_msg_local_position_ned_pack(0, 200, &mavMsg,
+        // time_boot_ms Timestamp (milliseconds since system boot)
+        timeBootMs,
+        // x, y, z Position (m)
+        dr_state.x, dr_state.y, -dr_state.z,
+        // vx, vy, vz Speed (m/s)
+        dr_state.vx, dr_state.vy, -dr_state.vz);
+    mavlinkSendMessage();
+}
+
+static void mavlinkStreamAttitudeQuaternion(timeUs_t currentTimeUs)
+{
+    mavlinkSendAttitudeQuaternion(currentTimeUs / 1000);
+}
+
+static void mavlinkStreamLocalPosition(timeUs_t currentTimeUs)
+{
+    mavlinkSendLocalPosition(currentTimeUs / 1000);
+}
+
+// Pose and twist with one timestamp in one write, what ODOMETRY carries in MAVLink 2
+static void mavlinkStreamOdometry(timeUs_t currentTimeUs)
+{
+    const uint32_t timeBootMs = currentTimeUs / 1000;
+    mavlinkSendLocalPosition(timeBootMs);
+    mavlinkSendAttitudeQuaternion(timeBootMs);
+}
+
+static void mavlinkStreamStates(timeUs_t currentTimeUs)
+{
+    UNUSED(currentTimeUs);
+    mavlinkSendMAVStates();
+    mavlinkSendAttitude();
+    mavlinkSendMAVMode();
+}
+
+static void mavlinkStreamHeartbeat(timeUs_t currentTimeUs)
+{
+    UNUSED(currentTimeUs);
+    mavlinkSendHeartbeat();
+}
+
+static void mavlinkStreamStatus(timeUs_t currentTimeUs)
+{
+    UNUSED(currentTimeUs);
+    mavlinkSendSystemStatus();
+    mavlinkSendMAVParam();
+}
+
+static void (* const mavStreamSend[MAVLINK_STREAM_COUNT])(timeUs_t currentTimeUs) = {
+    [MAVLINK_STREAM_ATTITUDE_QUATERNION] = mavlinkStreamAttitudeQuaternion,
+    [MAVLINK_STREAM_LOCAL_POSITION] = mavlinkStreamLocalPosition,
+    [MAVLINK_STREAM_ODOMETRY] = mavlinkStreamOdometry,
+    [MAVLINK_STREAM_STATES] = mavlinkStreamStates,
+    [MAVLINK_STREAM_HEARTBEAT] = mavlinkStreamHeartbeat,
+    [MAVLINK_STREAM_STATUS] = mavlinkStreamStatus,
+};
+
+// Bytes the line has carried since the last pass, capped so an idle period does not turn into a burst
+static void mavlinkRefillBudget(timeUs_t currentTimeUs)
+{
+    if (!mavTxBytesPerSecond) {
+        // No line rate (USB VCP), only the transmit buffer limits
+        mavTxBudget = MAVLINK_TX_BUFFER_SIZE;
+        return;
     }
 
-    if (mavlinkStreamTrigger(MAV_DATA_STREAM_RC_CHANNELS)) {
-        mavlinkSendHeartbeat();
+    // At low baud rates the window still has to hold the largest burst or that stream would never fit
+    const int32_t windowBytes = (uint64_t)mavTxBytesPerSecond * MAVLINK_TX_BUDGET_WINDOW_US / 1000000;
+    const int32_t budgetMax = MAX(windowBytes, MAVLINK_MAX_PACKET_LEN);
+    if (cmpTimeUs(currentTimeUs, mavTxBudgetTimeUs) > MAVLINK_TX_BUDGET_WINDOW_US) {
+        mavTxBudgetTimeUs = currentTimeUs - MAVLINK_TX_BUDGET_WINDOW_US;
     }
-    if (mavlinkStreamTrigger(MAV_DATA_STREAM_EXTRA1)) {
-        mavlinkSendMAVStates();
-        mavlinkSendAttitude();
-        mavlinkSendMAVMode();
+    const uint32_t bytes = (uint64_t)cmpTimeUs(currentTimeUs, mavTxBudgetTimeUs) * mavTxBytesPerSecond / 1000000;
+    // Advance by the time the whole bytes take so the fractions carry over to the next pass
+    mavTxBudgetTimeUs += (uint64_t)bytes * 1000000 / mavTxBytesPerSecond;
+    mavTxBudget = MIN(mavTxBudget + (int32_t)bytes, budgetMax);
+}
+
+/*
+ * Walk the streams in priority order and send the due ones that fit both the bandwidth budget and the free
+ * space of the port, sizing each by its largest burst. A due stream that does not fit stays due and holds
+ * back the streams below it, so the high rate streams degrade last. All frames of a pass go out in one write.
+ */
+static void processMAVLinkTelemetry(timeUs_t currentTimeUs)
+{
+    DEBUG_SET(DEBUG_UART,0,100);
+
+    mavlinkRefillBudget(currentTimeUs);
+    const int32_t txFree = serialTxBytesFree(mavlinkPort);
+    int32_t available = MIN(mavTxBudget, txFree);
+    int32_t used = 0;
+
+    for (int i = 0; i < MAVLINK_STREAM_COUNT; i++) {
+        mavlinkStream_t *stream = &mavStreams[i];
+        if (!stream->stats.rateHz || cmpTimeUs(currentTimeUs, stream->nextDueUs) < 0) {
+            continue;
+        }
+        if (mavStreamBurstMax[i] > available - used) {
+            stream->stats.deferred++;
+            break;
+        }
+
+        const uint32_t sentBefore = mavTxBytesSent + mavTxLength;
+        mavStreamSend[i](currentTimeUs);
+        stream->stats.burstBytes = mavTxBytesSent + mavTxLength - sentBefore;
+        stream->stats.sent++;
+        used += stream->stats.burstBytes;
+
+        // Keep the phase of the stream, unless it fell more than a period behind
+        const timeDelta_t periodUs = 1000000 / stream->stats.rateHz;
+        stream->nextDueUs += periodUs;
+        if (cmpTimeUs(currentTimeUs, stream->nextDueUs) >= 0) {
+            stream->nextDueUs = currentTimeUs + periodUs;
+        }
     }
-    // if (mavlinkStreamTrigger(MAV_DATA_STREAM_EXTRA2)) {
-        
-    // }
+
+    mavlinkFlush();
+    mavTxBudget -= used;
 }
 
 void handleMAVLinkTelemetry(void)
@@ -746,11 +887,22 @@ void handleMAVLinkTelemetry(void)
         return;
     }
 
-    uint32_t now = micros();
-    if ((now - lastMavlinkMessage) >= TELEMETRY_MAVLINK_DELAY) {
-        processMAVLinkTelemetry();
-        lastMavlinkMessage = now;
-    }
+    processMAVLinkTelemetry(micros());
+}
+
+const mavlinkTxStats_t *mavlinkTxGetStats(mavlinkStreamId_e stream)
+{
+    return &mavStreams[stream].stats;
+}
+
+uint32_t mavlinkTxGetBytesPerSecond(void)
+{
+    return mavTxBytesPerSecond;
+}
+
+uint32_t mavlinkTxGetBytesSent(void)
+{
+    return mavTxBytesSent;
 }
 
 #endif
@@ -17,6 +17,29 @@
 
 #pragma once
 
+#include <stdint.h>
+
+#define MAVLINK_STREAM_MAX_RATE_HZ  200
+
+// Outgoing streams in priority order, a stream only goes out when the ones above it are not waiting for bandwidth.
+// The low rate housekeeping comes first so a saturated link still carries the heartbeat.
+typedef enum {
+    MAVLINK_STREAM_HEARTBEAT = 0,
+    MAVLINK_STREAM_STATUS,          // SYS_STATUS and parameters
+    MAVLINK_STREAM_ATTITUDE_QUATERNION,
+    MAVLINK_STREAM_LOCAL_POSITION,
+    MAVLINK_STREAM_ODOMETRY,        // LOCAL_POSITION_NED and ATTITUDE_QUATERNION sampled together
+    MAVLINK_STREAM_STATES,          // HIGHRES_IMU, ATTITUDE and mode
+    MAVLINK_STREAM_COUNT
+} mavlinkStreamId_e;
+
+typedef struct mavlinkTxStats_s {
+    uint8_t rateHz;                 // configured
+    uint16_t burstBytes;            // size of the last burst
+    uint32_t sent;
+    uint32_t deferred;              // times a due burst had to wait for bandwidth
+} mavlinkTxStats_t;
+
 void initMAVLinkTelemetry(void);
 void handleMAVLinkTelemetry(void);
 void checkMAVLinkTelemetryState(void);
@@ -24,7 +47,6 @@ void checkMAVLinkTelemetryState(void);
 void freeMAVLinkTelemetryPort(void);
 void configureMAVLinkTelemetryPort(void);
 
-extern float uart_altitude;
-extern float uart_roll;
-extern float uart_pitch;
-extern float uart_yaw;
\ No newline at end of file
+const mavlinkTxStats_t *mavlinkTxGetStats(mavlinkStreamId_e stream);
+uint32_t mavlinkTxGetBytesPerSecond(void);
+uint32_t mavlinkTxGetBytesSent(void);
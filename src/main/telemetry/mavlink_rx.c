@@ -0,0 +1,210 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "platform.h"
+
+#if defined(USE_TELEMETRY) && defined(USE_TELEMETRY_MAVLINK)
+
+#include "build/debug.h"
+
+#include "common/maths.h"
+#include "common/utils.h"
+
+#include "flight/ol_filter.h"
+#include "flight/ol_navigation.h"
+
+#include "telemetry/mavlink_rx.h"
+
+#define MAVLINK_RX_QUEUE_MASK (MAVLINK_RX_QUEUE_SIZE - 1)
+
+STATIC_ASSERT((MAVLINK_RX_QUEUE_SIZE & MAVLINK_RX_QUEUE_MASK) == 0 && MAVLINK_RX_QUEUE_SIZE <= 128, mavlink_rx_queue_size_not_power_of_two);
+
+float uart_altitude;
+float uart_roll;
+float uart_pitch;
+float uart_yaw;
+
+// The RX callback only writes rxQueueHead and the navigation task only writes rxQueueTail. The free running
+// uint8_t indices wrap together with the queue because its size divides 256.
+static mavlinkRxMessage_t rxQueue[MAVLINK_RX_QUEUE_SIZE];
+static uint8_t rxQueueHead;
+static uint8_t rxQueueTail;
+
+// received, dropped and lastRxUs are written by the producer, the rest by the consumer
+static mavlinkRxStats_t rxStats[MAVLINK_RX_TYPE_COUNT];
+static uint32_t rxLostFrames;
+static uint32_t rxCrcErrors;
+static timeUs_t rxLinkLastUs;       // last setpoint or vision message
+static bool rxLinkSeen;
+
+static timeUs_t rateWindowStartUs;
+static uint16_t rateWindowCount[MAVLINK_RX_TYPE_COUNT];
+
+bool mavlinkRxPush(const mavlinkRxMessage_t *msg)
+{
+    mavlinkRxStats_t *stats = &rxStats[msg->type];
+    const uint8_t head = rxQueueHead;
+    const uint8_t tail = __atomic_load_n(&rxQueueTail, __ATOMIC_ACQUIRE);
+
+    stats->lastRxUs = msg->rxTimeUs;
+    if (msg->type == MAVLINK_RX_SETPOINT || msg->type == MAVLINK_RX_VISION) {
+        rxLinkLastUs = msg->rxTimeUs;
+        rxLinkSeen = true;
+    }
+    if ((uint8_t)(head - tail) >= MAVLINK_RX_QUEUE_SIZE) {
+        // the consumer is behind, keep what it has not seen yet
+        stats->dropped++;
+        return false;
+    }
+
+    rxQueue[head & MAVLINK_RX_QUEUE_MASK] = *msg;
+    stats->received++;
+    __atomic_store_n(&rxQueueHead, (uint8_t)(head + 1), __ATOMIC_RELEASE);
+    return true;
+}
+
+// Frames the parser saw a sequence gap for, and frames it discarded for a bad checksum
+void mavlinkRxCountLost(uint32_t frames, uint32_t crcErrors)
+{
+    rxLostFrames += frames;
+    rxCrcErrors += crcErrors;
+}
+
+bool mavlinkRxPop(mavlinkRxMessage_t *msg, timeUs_t currentTimeUs)
+{
+    const uint8_t tail = rxQueueTail;
+    const uint8_t head = __atomic_load_n(&rxQueueHead, __ATOMIC_ACQUIRE);
+
+    if (head == tail) {
+        return false;
+    }
+
+    *msg = rxQueue[tail & MAVLINK_RX_QUEUE_MASK];
+    __atomic_store_n(&rxQueueTail, (uint8_t)(tail + 1), __ATOMIC_RELEASE);
+
+    mavlinkRxStats_t *stats = &rxStats[msg->type];
+    const timeDelta_t latency = cmpTimeUs(currentTimeUs, msg->rxTimeUs);
+    const uint32_t latencyUs = latency > 0 ? latency : 0;
+    stats->latencyAvgUs = stats->latencyAvgUs ? stats->latencyAvgUs + ((int32_t)(latencyUs - stats->latencyAvgUs) / 8) : latencyUs;
+    stats->latencyMaxUs = MAX(stats->latencyMaxUs, latencyUs);
+    rateWindowCount[msg->type]++;
+
+    return true;
+}
+
+static void applyMessage(const mavlinkRxMessage_t *msg)
+{
+    switch (msg->type) {
+    case MAVLINK_RX_SETPOINT:
+        uart_altitude = -msg->data.setpoint.thrust * 100;
+        uart_roll = msg->data.setpoint.roll;   //maybe need normalization but this should be done in the JeVois
+        uart_pitch = -msg->data.setpoint.pitch;
+        uart_yaw = msg->data.setpoint.yaw;
+        DEBUG_SET(DEBUG_UART, 1, msg->data.setpoint.timeBootMs);
+        DEBUG_SET(DEBUG_UART, 3, uart_altitude);
+        DEBUG_SET(DEBUG_COMMAND, 0, uart_altitude);
+        DEBUG_SET(DEBUG_COMMAND, 1, uart_roll / 3.14f * 180);
+        DEBUG_SET(DEBUG_COMMAND, 2, uart_pitch / 3.14f * 180);
+        DEBUG_SET(DEBUG_COMMAND, 3, uart_yaw / 3.14f * 180);
+        break;
+
+    case MAVLINK_RX_VISION:
+        // gate relative position, stamped with its capture time for the latency compensated correction
+        ol_filter_push_vision(msg->data.vision.x, msg->data.vision.y, msg->data.vision.z,
+            msg->rxTimeUs - olNavigationConfig()->vision_latency_ms * 1000);
+        DEBUG_SET(DEBUG_PHIL, 0, msg->data.vision.x);
+        DEBUG_SET(DEBUG_PHIL, 1, msg->data.vision.y);
+        break;
+
+    case MAVLINK_RX_HIGHRES_IMU:
+        uart_altitude = msg->data.imu.absPressure;
+        DEBUG_SET(DEBUG_UART, 1, msg->data.imu.usec);
+        DEBUG_SET(DEBUG_UART, 3, 100 * uart_altitude);
+        break;
+
+    default:
+        break;
+    }
+}
+
+// Drain the queue, called by the navigation task before it runs the filter
+void mavlinkRxProcess(timeUs_t currentTimeUs)
+{
+    mavlinkRxMessage_t msg;
+
+    while (mavlinkRxPop(&msg, currentTimeUs)) {
+        applyMessage(&msg);
+    }
+
+    if (cmpTimeUs(currentTimeUs, rateWindowStartUs) >= MAVLINK_RX_RATE_WINDOW_US) {
+        const timeDelta_t window = cmpTimeUs(currentTimeUs, rateWindowStartUs);
+        for (int i = 0; i < MAVLINK_RX_TYPE_COUNT; i++) {
+            rxStats[i].rateHz = (uint64_t)rateWindowCount[i] * 1000000 / window;
+            rateWindowCount[i] = 0;
+        }
+        rateWindowStartUs = currentTimeUs;
+    }
+}
+
+const mavlinkRxStats_t *mavlinkRxGetStats(mavlinkRxType_e type)
+{
+    return &rxStats[type];
+}
+
+uint32_t mavlinkRxGetLostFrames(void)
+{
+    return rxLostFrames;
+}
+
+uint32_t mavlinkRxGetCrcErrors(void)
+{
+    return rxCrcErrors;
+}
+
+// Health of the camera link, judged by the messages the navigation relies on
+mavlinkLinkHealth_e mavlinkRxLinkHealth(timeUs_t currentTimeUs)
+{
+    if (!rxLinkSeen) {
+        return MAVLINK_LINK_NONE;
+    }
+
+    const timeDelta_t age = cmpTimeUs(currentTimeUs, rxLinkLastUs);
+    if (age > MAVLINK_RX_LOST_US) {
+        return MAVLINK_LINK_LOST;
+    }
+    if (age > MAVLINK_RX_STALE_US) {
+        return MAVLINK_LINK_STALE;
+    }
+    return MAVLINK_LINK_OK;
+}
+
+void mavlinkRxReset(void)
+{
+    rxQueueHead = 0;
+    rxQueueTail = 0;
+    memset(rxStats, 0, sizeof(rxStats));
+    memset(rateWindowCount, 0, sizeof(rateWindowCount));
+    rxLostFrames = 0;
+    rxCrcErrors = 0;
+    rxLinkSeen = false;
+}
+
+#endif
@@ -0,0 +1,98 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// MAVLink messages from the companion camera (JeVois), parsed in the serial RX callback and handed to the
+// navigation task through a single producer, single consumer queue
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "common/time.h"
+
+#define MAVLINK_RX_QUEUE_SIZE   16          // power of two
+#define MAVLINK_RX_STALE_US     200000      // no message for this long: link degraded
+#define MAVLINK_RX_LOST_US      1000000     // no message for this long: link lost
+#define MAVLINK_RX_RATE_WINDOW_US 1000000
+
+typedef enum {
+    MAVLINK_RX_SETPOINT = 0,    // MANUAL_SETPOINT (81)
+    MAVLINK_RX_VISION,          // VISION_POSITION_ESTIMATE (102)
+    MAVLINK_RX_HIGHRES_IMU,     // HIGHRES_IMU (105), link test
+    MAVLINK_RX_OTHER,
+    MAVLINK_RX_TYPE_COUNT
+} mavlinkRxType_e;
+
+typedef struct mavlinkRxMessage_s {
+    uint8_t type;               // mavlinkRxType_e
+    timeUs_t rxTimeUs;          // time the last byte of the frame arrived
+    union {
+        struct {
+            uint32_t timeBootMs;
+            float roll;         // rad
+            float pitch;        // rad
+            float yaw;          // rad
+            float thrust;
+        } setpoint;
+        struct {
+            uint64_t usec;      // camera clock
+            float x;            // m, gate relative to the drone
+            float y;
+            float z;
+        } vision;
+        struct {
+            uint64_t usec;
+            float absPressure;
+        } imu;
+    } data;
+} mavlinkRxMessage_t;
+
+typedef struct mavlinkRxStats_s {
+    uint32_t received;          // frames queued
+    uint32_t dropped;           // frames lost because the queue was full
+    uint16_t rateHz;            // frames in the last complete rate window
+    uint32_t latencyAvgUs;      // receive to consumption by the navigation task, filtered
+    uint32_t latencyMaxUs;
+    timeUs_t lastRxUs;
+} mavlinkRxStats_t;
+
+typedef enum {
+    MAVLINK_LINK_NONE = 0,      // nothing received since boot
+    MAVLINK_LINK_OK,
+    MAVLINK_LINK_STALE,
+    MAVLINK_LINK_LOST
+} mavlinkLinkHealth_e;
+
+// Producer, serial RX callback
+bool mavlinkRxPush(const mavlinkRxMessage_t *msg);
+void mavlinkRxCountLost(uint32_t frames, uint32_t crcErrors);
+
+// Consumer, navigation task
+bool mavlinkRxPop(mavlinkRxMessage_t *msg, timeUs_t currentTimeUs);
+void mavlinkRxProcess(timeUs_t currentTimeUs);
+
+const mavlinkRxStats_t *mavlinkRxGetStats(mavlinkRxType_e type);
+uint32_t mavlinkRxGetLostFrames(void);
+uint32_t mavlinkRxGetCrcErrors(void);
+mavlinkLinkHealth_e mavlinkRxLinkHealth(timeUs_t currentTimeUs);
+void mavlinkRxReset(void);
+
+extern float uart_altitude;
+extern float uart_roll;
+extern float uart_pitch;
+extern float uart_yaw;
@@ -51,6 +51,9 @@ typedef struct telemetryConfig_s {
     uint8_t pidValuesAsTelemetry;
     uint8_t report_cell_voltage;
     uint8_t flysky_sensors[IBUS_SENSOR_COUNT];
+    uint8_t mavlink_attitude_hz;            // ATTITUDE_QUATERNION rate for the companion computer, 0 disables
+    uint8_t mavlink_position_hz;            // LOCAL_POSITION_NED rate
+    uint8_t mavlink_odometry_hz;            // LOCAL_POSITION_NED and ATTITUDE_QUATERNION with a common timestamp
 } telemetryConfig_t;
 
 PG_DECLARE(telemetryConfig_t, telemetryConfig);
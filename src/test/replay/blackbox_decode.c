@@ -0,0 +1,150 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Decode a blackbox log to CSV, one frame type per run:
+ *
+ *   blackbox_decode [-l log] [-t I|S|G|H|O] [-s] file
+ *
+ * -l selects the log of a dump with several (from 0), -t the frames to print (I for the main I and P frames, O for the
+ * navigation O and o frames), -s prints the frame counts and decoding errors to stderr.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "blackbox/blackbox_decoder.h"
+
+#include "blackbox_log_file.h"
+
+static blackboxDecoder_t decoder;
+
+static void usage(const char *name)
+{
+    fprintf(stderr, "usage: %s [-l log] [-t I|S|G|H|O] [-s] file\n", name);
+}
+
+static void printCsvHeader(const blackboxDecoderFrameDef_t *def)
+{
+    for (int i = 0; i < def->fieldCount; i++) {
+        printf("%s%s", i ? "," : "", def->name[i]);
+    }
+    printf("\n");
+}
+
+static void printCsvFrame(const blackboxDecoderFrame_t *frame)
+{
+    const blackboxDecoderFrameDef_t *def = frame->def;
+
+    for (int i = 0; i < def->fieldCount; i++) {
+        if (def->isSigned[i]) {
+            printf("%s%d", i ? "," : "", frame->values[i]);
+        } else {
+            printf("%s%u", i ? "," : "", (uint32_t)frame->values[i]);
+        }
+    }
+    printf("\n");
+}
+
+static void printStats(void)
+{
+    static const char frameTypes[BLACKBOX_DECODER_DEF_COUNT] = { 'I', 'S', 'G', 'H', 'O' };
+
+    for (int i = 0; i < BLACKBOX_DECODER_DEF_COUNT; i++) {
+        if (decoder.def[i].fieldCount) {
+            fprintf(stderr, "%c frames: %u (%d fields)\n", frameTypes[i], decoder.stats.frames[i], decoder.def[i].fieldCount);
+        }
+    }
+    fprintf(stderr, "events: %u\n", decoder.stats.events);
+    fprintf(stderr, "corrupt frames: %u\n", decoder.stats.corruptFrames);
+    fprintf(stderr, "frames skipped waiting for an intra frame: %u\n", decoder.stats.skippedFrames);
+}
+
+int main(int argc, char *argv[])
+{
+    int logIndex = 0;
+    char frameType = 'I';
+    bool stats = false;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "l:t:s")) != -1) {
+        switch (opt) {
+        case 'l':
+            logIndex = atoi(optarg);
+            break;
+        case 't':
+            frameType = optarg[0];
+            break;
+        case 's':
+            stats = true;
+            break;
+        default:
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if (optind != argc - 1 || !strchr("ISGHO", frameType)) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    blackboxLogFile_t file;
+    if (!blackboxLogFileOpen(&file, argv[optind])) {
+        return 1;
+    }
+
+    const uint8_t *log = blackboxDecoderFindLog(file.data, file.length, logIndex);
+    if (!log) {
+        if (logIndex > 0) {
+            fprintf(stderr, "%s: no log %d\n", argv[optind], logIndex);
+            return 1;
+        }
+        // A capture that missed the start of the header, try with what is left of it
+        log = file.data;
+    }
+
+    if (!blackboxDecoderInit(&decoder, log, file.data + file.length - log)) {
+        fprintf(stderr, "%s: no field definitions in the header\n", argv[optind]);
+        return 1;
+    }
+
+    const blackboxDecoderFrameDef_t *def = NULL;
+    blackboxDecoderFrame_t frame;
+    while (blackboxDecoderNext(&decoder, &frame)) {
+        // P and o frames are printed with the I and O frames they are deltas of
+        const char type = (frame.type == 'P') ? 'I' : (frame.type == 'o') ? 'O' : frame.type;
+        if (type != frameType) {
+            continue;
+        }
+        if (def != frame.def) {
+            def = frame.def;
+            printCsvHeader(def);
+        }
+        printCsvFrame(&frame);
+    }
+
+    if (stats) {
+        printStats();
+    }
+
+    blackboxLogFileClose(&file);
+    return 0;
+}
@@ -0,0 +1,65 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "blackbox_log_file.h"
+
+bool blackboxLogFileOpen(blackboxLogFile_t *file, const char *path)
+{
+    struct stat st;
+
+    file->data = NULL;
+    file->length = 0;
+
+    file->fd = open(path, O_RDONLY);
+    if (file->fd < 0) {
+        perror(path);
+        return false;
+    }
+    if (fstat(file->fd, &st) < 0 || st.st_size == 0) {
+        fprintf(stderr, "%s: empty or unreadable\n", path);
+        close(file->fd);
+        return false;
+    }
+
+    void *data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, file->fd, 0);
+    if (data == MAP_FAILED) {
+        perror(path);
+        close(file->fd);
+        return false;
+    }
+    // The decoder only moves forward, let the kernel read ahead and drop the pages behind it
+    madvise(data, st.st_size, MADV_SEQUENTIAL);
+
+    file->data = data;
+    file->length = st.st_size;
+    return true;
+}
+
+void blackboxLogFileClose(blackboxLogFile_t *file)
+{
+    if (file->data) {
+        munmap((void *)file->data, file->length);
+        close(file->fd);
+        file->data = NULL;
+    }
+}
@@ -0,0 +1,509 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Re-run a logged flight through the firmware gyro, IMU, PID and outer loop code:
+ *
+ *   blackbox_replay [-l log] [-s setting=value]... file > replay.csv
+ *
+ * The configuration is taken from the log header and can be changed with -s, using the CLI setting names. Every main
+ * frame feeds the logged gyro, accelerometer and rcCommand to gyroUpdate(), accUpdate(), processRcCommand() and
+ * pidController(), imuUpdateAttitude() and ol_navigation_update() run at their task rates in log time, and the gate
+ * detections of the O frames are fed to the outer loop filter. The output has one line per main frame with the
+ * replayed and the logged values, the RMS of their differences is printed to stderr.
+ *
+ * The gyro input is the unfiltered gyro of debug_mode GYRO_NOTCH when the log has it, otherwise the logged gyroADC,
+ * which has already been through the gyro filters of the flight. rcCommand is logged after the RC interpolation, so
+ * the interpolation is off in the replay. The mixer, RX and failsafe are not run, see replay_stubs.c.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <math.h>
+#include <unistd.h>
+
+#include "platform.h"
+
+#include "blackbox/blackbox_decoder.h"
+
+#include "build/debug.h"
+
+#include "common/axis.h"
+#include "common/bitarray.h"
+#include "common/maths.h"
+#include "common/utils.h"
+
+#include "drivers/accgyro/accgyro.h"
+#include "drivers/accgyro/accgyro_fake.h"
+
+#include "fc/config.h"
+#include "fc/controlrate_profile.h"
+#include "fc/fc_core.h"
+#include "fc/fc_rc.h"
+#include "fc/rc_controls.h"
+#include "fc/rc_modes.h"
+#include "fc/runtime_config.h"
+
+#include "flight/imu.h"
+#include "flight/ol_filter.h"
+#include "flight/ol_navigation.h"
+#include "flight/pid.h"
+
+#include "interface/settings.h"
+
+#include "pg/pg.h"
+
+#include "rx/rx.h"
+
+#include "sensors/acceleration.h"
+#include "sensors/gyro.h"
+
+#include "blackbox_log_file.h"
+#include "replay_stubs.h"
+#include "replay_vision.h"
+
+#define REPLAY_MAX_OVERRIDES    32
+#define REPLAY_IMU_PERIOD_US    (1000000 / 100)     // TASK_ATTITUDE rate
+
+extern gyroDev_t * const gyroDevPtr;
+
+// Header lines that map to CLI settings, multi valued lines set one setting per value
+typedef struct replayHeaderSetting_s {
+    const char *header;
+    const char *settings;
+} replayHeaderSetting_t;
+
+static const replayHeaderSetting_t replayHeaderSettings[] = {
+    { "pid_process_denom",          "pid_process_denom" },
+    { "thr_mid",                    "thr_mid" },
+    { "thr_expo",                   "thr_expo" },
+    { "tpa_rate",                   "tpa_rate" },
+    { "tpa_breakpoint",             "tpa_breakpoint" },
+    { "rc_rates",                   "roll_rc_rate,pitch_rc_rate,yaw_rc_rate" },
+    { "rc_expo",                    "roll_expo,pitch_expo,yaw_expo" },
+    { "rates",                      "roll_srate,pitch_srate,yaw_srate" },
+    { "rollPID",                    "p_roll,i_roll,d_roll" },
+    { "pitchPID",                   "p_pitch,i_pitch,d_pitch" },
+    { "yawPID",                     "p_yaw,i_yaw,d_yaw" },
+    { "levelPID",                   "p_level,i_level,d_level" },
+    { "dterm_filter_type",          "dterm_lowpass_type" },
+    { "dterm_lpf_hz",               "dterm_lowpass" },
+    { "yaw_lpf_hz",                 "yaw_lowpass" },
+    { "dterm_notch_hz",             "dterm_notch_hz" },
+    { "dterm_notch_cutoff",         "dterm_notch_cutoff" },
+    { "iterm_windup",               "iterm_windup" },
+    { "vbat_pid_gain",              "vbat_pid_gain" },
+    { "pidAtMinThrottle",           "pid_at_min_throttle" },
+    { "anti_gravity_threshold",     "anti_gravity_threshold" },
+    { "anti_gravity_gain",          "anti_gravity_gain" },
+    { "setpoint_relaxation_ratio",  "setpoint_relax_ratio" },
+    { "dterm_setpoint_weight",      "dterm_setpoint_weight" },
+    { "acc_limit_yaw",              "acc_limit_yaw" },
+    { "acc_limit",                  "acc_limit" },
+    { "pidsum_limit",               "pidsum_limit" },
+    { "pidsum_limit_yaw",           "pidsum_limit_yaw" },
+    { "deadband",                   "deadband" },
+    { "yaw_deadband",               "yaw_deadband" },
+    { "gyro_lowpass_type",          "gyro_lowpass_type" },
+    { "gyro_lowpass_hz",            "gyro_lowpass_hz" },
+    { "gyro_notch_hz",              "gyro_notch1_hz,gyro_notch2_hz" },
+    { "gyro_notch_cutoff",          "gyro_notch1_cutoff,gyro_notch2_cutoff" },
+    { "debug_mode",                 "debug_mode" },
+};
+
+typedef struct replayFields_s {
+    int iteration;
+    int time;
+    int gyro;
+    int debug;
+    int acc;
+    int rcCommand;
+    int axisP;
+    int axisI;
+    int axisD[XYZ_AXIS_COUNT];
+} replayFields_t;
+
+typedef struct replayError_s {
+    double gyro;
+    double pid;
+    double olPos;
+    uint32_t frames;
+    uint32_t olFrames;
+} replayError_t;
+
+static blackboxDecoder_t decoder;
+static replayFields_t fields;
+static replayError_t error;
+
+static const clivalue_t *findSetting(const char *name)
+{
+    for (unsigned i = 0; i < valueTableEntryCount; i++) {
+        if (strcasecmp(valueTable[i].name, name) == 0) {
+            return &valueTable[i];
+        }
+    }
+    return NULL;
+}
+
+// The replay always runs with the first PID and rate profiles, the log header has the values of the active ones
+static bool setSetting(const char *name, const char *text)
+{
+    const clivalue_t *setting = findSetting(name);
+    if (!setting || (setting->type & VALUE_MODE_MASK) == MODE_ARRAY) {
+        return false;
+    }
+
+    int value;
+    if ((setting->type & VALUE_MODE_MASK) == MODE_LOOKUP && !(text[0] >= '0' && text[0] <= '9')) {
+        const lookupTableEntry_t *table = &lookupTables[setting->config.lookup.tableIndex];
+        for (value = 0; value < table->valueCount; value++) {
+            if (strcasecmp(table->values[value], text) == 0) {
+                break;
+            }
+        }
+        if (value == table->valueCount) {
+            return false;
+        }
+    } else {
+        value = atoi(text);
+    }
+
+    uint8_t *ptr = pgFind(setting->pgn)->address + setting->offset;
+    switch (setting->type & VALUE_TYPE_MASK) {
+    case VAR_UINT8:
+    case VAR_INT8:
+        *(uint8_t *)ptr = value;
+        break;
+    case VAR_UINT16:
+    case VAR_INT16:
+        *(uint16_t *)ptr = value;
+        break;
+    }
+    return true;
+}
+
+static void applyHeaderLine(const char *name, char *values)
+{
+    for (unsigned i = 0; i < ARRAYLEN(replayHeaderSettings); i++) {
+        if (strcmp(replayHeaderSettings[i].header, name) != 0) {
+            continue;
+        }
+        char settings[128];
+        strncpy(settings, replayHeaderSettings[i].settings, sizeof(settings) - 1);
+        settings[sizeof(settings) - 1] = '\0';
+
+        char *settingSave, *valueSave;
+        char *setting = strtok_r(settings, ",", &settingSave);
+        char *value = strtok_r(values, ",", &valueSave);
+        for (; setting && value; setting = strtok_r(NULL, ",", &settingSave), value = strtok_r(NULL, ",", &valueSave)) {
+            setSetting(setting, value);
+        }
+        return;
+    }
+}
+
+static void applyHeader(const uint8_t *log, const uint8_t *end)
+{
+    const uint8_t *line = log;
+
+    while (end - line > 2 && line[0] == 'H' && line[1] == ' ') {
+        const uint8_t *eol = memchr(line, '\n', end - line);
+        if (!eol) {
+            break;
+        }
+
+        char text[256];
+        const size_t length = MIN((size_t)(eol - line), sizeof(text) - 1);
+        memcpy(text, line, length);
+        text[length] = '\0';
+
+        char *colon = strchr(text, ':');
+        if (colon) {
+            *colon = '\0';
+            applyHeaderLine(text + 2, colon + 1);
+        }
+        line = eol + 1;
+    }
+}
+
+static bool findFields(void)
+{
+    const blackboxDecoderFrameDef_t *def = &decoder.def[BLACKBOX_DECODER_DEF_MAIN];
+
+    fields.iteration = blackboxDecoderFindField(def, "loopIteration");
+    fields.time = blackboxDecoderFindField(def, "time");
+    fields.gyro = blackboxDecoderFindField(def, "gyroADC[0]");
+    fields.debug = blackboxDecoderFindField(def, "debug[0]");
+    fields.acc = blackboxDecoderFindField(def, "accSmooth[0]");
+    fields.rcCommand = blackboxDecoderFindField(def, "rcCommand[0]");
+    fields.axisP = blackboxDecoderFindField(def, "axisP[0]");
+    fields.axisI = blackboxDecoderFindField(def, "axisI[0]");
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        char name[16];
+        snprintf(name, sizeof(name), "axisD[%d]", axis);
+        fields.axisD[axis] = blackboxDecoderFindField(def, name);
+    }
+
+    return fields.iteration >= 0 && fields.time >= 0 && fields.gyro >= 0 && fields.rcCommand >= 0
+        && fields.axisP >= 0 && fields.axisI >= 0;
+}
+
+static void setFlightModes(uint32_t boxMask)
+{
+    static const uint8_t boxIdToFlightModeMap[] = BOXID_TO_FLIGHT_MODE_MAP_INITIALIZER;
+
+    memset(&rcModeActivationMask, 0, sizeof(rcModeActivationMask));
+    memcpy(&rcModeActivationMask, &boxMask, sizeof(boxMask));
+
+    flightModeFlags = 0;
+    for (int box = BOXANGLE; box <= BOXID_FLIGHTMODE_LAST; box++) {
+        if (bitArrayGet(&rcModeActivationMask, box)) {
+            flightModeFlags |= 1 << boxIdToFlightModeMap[box];
+        }
+    }
+}
+
+static void replayInit(uint32_t framePeriodUs)
+{
+    currentPidProfile = pidProfilesMutable(0);
+    currentControlRateProfile = controlRateProfilesMutable(0);
+    debugMode = systemConfig()->debug_mode;
+
+    gyroInit();
+    // The gyro is sampled once per logged frame, the filters are set up for that rate
+    gyro.targetLooptime = framePeriodUs;
+    gyroDevPtr->scale = 1.0f;
+    gyroInitFilters();
+    accInit(framePeriodUs);
+    setAccelerationTrims(&accelerometerConfigMutable()->accZero);
+
+    imuConfigure(0);
+    imuInit();
+    pidInit(currentPidProfile);
+    initRcProcessing();
+    ol_navigation_init();
+    replayVisionInit();
+
+    // Main frames are only logged while armed
+    ENABLE_ARMING_FLAG(ARMED);
+    pidStabilisationState(PID_STABILISATION_ON);
+}
+
+static void replayMainFrame(const int32_t *values)
+{
+    replayTimeUs = values[fields.time];
+
+    // DEBUG_GYRO_NOTCH logs the aligned, calibrated gyro in deg/s before any filter
+    const int gyroField = (decoder.debugMode == DEBUG_GYRO_NOTCH && fields.debug >= 0) ? fields.debug : fields.gyro;
+    fakeGyroSet(gyroDevPtr, values[gyroField + X], values[gyroField + Y], values[gyroField + Z]);
+    gyroUpdate(replayTimeUs);
+
+    if (fields.acc >= 0) {
+        fakeAccSet(&acc.dev, values[fields.acc + X], values[fields.acc + Y], values[fields.acc + Z]);
+        accUpdate(replayTimeUs, &accelerometerConfigMutable()->accelerometerTrims);
+    }
+
+    static timeUs_t imuTimeUs;
+    if (cmpTimeUs(replayTimeUs, imuTimeUs) >= 0) {
+        imuUpdateAttitude(replayTimeUs);
+        imuTimeUs = replayTimeUs + REPLAY_IMU_PERIOD_US;
+    }
+
+    bool rcChanged = false;
+    for (int i = 0; i < 4; i++) {
+        if (rcCommand[i] != values[fields.rcCommand + i]) {
+            rcCommand[i] = values[fields.rcCommand + i];
+            rcChanged = true;
+        }
+    }
+    isRXDataNew = rcChanged;
+    processRcCommand();
+
+    imuIntegrateGyro(gyro.gyroADCf, targetPidLooptime * 0.000001f);
+    pidController(currentPidProfile, &accelerometerConfig()->accelerometerTrims, replayTimeUs);
+
+    static timeUs_t navTimeUs;
+    if (cmpTimeUs(replayTimeUs, navTimeUs) >= 0) {
+        ol_navigation_update(replayTimeUs);
+        navTimeUs = replayTimeUs + lrintf(ol_dt * 1e6f);
+    }
+
+    printf("%u,%u", (uint32_t)values[fields.iteration], replayTimeUs);
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        const int32_t loggedD = fields.axisD[axis] >= 0 ? values[fields.axisD[axis]] : 0;
+        printf(",%.1f,%d,%.1f,%d,%.1f,%d,%.1f,%d",
+            (double)gyro.gyroADCf[axis], values[fields.gyro + axis],
+            (double)axisPID_P[axis], values[fields.axisP + axis],
+            (double)axisPID_I[axis], values[fields.axisI + axis],
+            (double)axisPID_D[axis], loggedD);
+
+        const float gyroError = gyro.gyroADCf[axis] - values[fields.gyro + axis];
+        const float pidError = axisPID_P[axis] + axisPID_I[axis] + axisPID_D[axis]
+            - (values[fields.axisP + axis] + values[fields.axisI + axis] + loggedD);
+        error.gyro += gyroError * gyroError;
+        error.pid += pidError * pidError;
+    }
+    printf(",%d,%d,%d,%.2f,%.2f,%.2f\n", attitude.values.roll, attitude.values.pitch, attitude.values.yaw,
+        (double)dr_state.x, (double)dr_state.y, (double)dr_state.z);
+    error.frames++;
+}
+
+static void replayOlFrame(const blackboxDecoderFrame_t *frame)
+{
+    if (!replayVisionFrame(frame)) {
+        return;
+    }
+
+    const int pos = blackboxDecoderFindField(frame->def, "drPos[0]");
+    if (pos >= 0) {
+        const float dx = dr_state.x - frame->values[pos + 0] / 100.0f;
+        const float dy = dr_state.y - frame->values[pos + 1] / 100.0f;
+        const float dz = dr_state.z - frame->values[pos + 2] / 100.0f;
+        error.olPos += dx * dx + dy * dy + dz * dz;
+        error.olFrames++;
+    }
+}
+
+static void printCsvHeader(void)
+{
+    printf("loopIteration,time");
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        printf(",gyro[%d],loggedGyro[%d],axisP[%d],loggedAxisP[%d],axisI[%d],loggedAxisI[%d],axisD[%d],loggedAxisD[%d]",
+            axis, axis, axis, axis, axis, axis, axis, axis);
+    }
+    printf(",roll,pitch,yaw,drPos[0],drPos[1],drPos[2]\n");
+}
+
+static void printError(void)
+{
+    if (error.frames) {
+        fprintf(stderr, "main frames: %u, rms gyro error %.2f deg/s, rms pid sum error %.2f\n", error.frames,
+            sqrt(error.gyro / (error.frames * XYZ_AXIS_COUNT)), sqrt(error.pid / (error.frames * XYZ_AXIS_COUNT)));
+    }
+    if (error.olFrames) {
+        fprintf(stderr, "O frames: %u, rms position error %.3f m\n", error.olFrames, sqrt(error.olPos / error.olFrames));
+    }
+}
+
+static void usage(const char *name)
+{
+    fprintf(stderr, "usage: %s [-l log] [-s setting=value]... file\n", name);
+}
+
+int main(int argc, char *argv[])
+{
+    int logIndex = 0;
+    char *overrides[REPLAY_MAX_OVERRIDES];
+    int overrideCount = 0;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "l:s:")) != -1) {
+        switch (opt) {
+        case 'l':
+            logIndex = atoi(optarg);
+            break;
+        case 's':
+            if (overrideCount == REPLAY_MAX_OVERRIDES || !strchr(optarg, '=')) {
+                usage(argv[0]);
+                return 1;
+            }
+            overrides[overrideCount++] = optarg;
+            break;
+        default:
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if (optind != argc - 1) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    blackboxLogFile_t file;
+    if (!blackboxLogFileOpen(&file, argv[optind])) {
+        return 1;
+    }
+    const uint8_t *end = file.data + file.length;
+    const uint8_t *log = blackboxDecoderFindLog(file.data, file.length, logIndex);
+    if (!log) {
+        fprintf(stderr, "%s: no log %d\n", argv[optind], logIndex);
+        return 1;
+    }
+    if (!blackboxDecoderInit(&decoder, log, end - log) || !findFields()) {
+        fprintf(stderr, "%s: the log has no main frames with gyro, rcCommand and PID fields\n", argv[optind]);
+        return 1;
+    }
+
+    pgResetAll();
+    applyHeader(log, end);
+
+    const uint32_t framePeriodUs = decoder.looptime * pidConfig()->pid_process_denom * decoder.pDenom / decoder.pNum;
+    if (decoder.pNum != 1) {
+        fprintf(stderr, "warning: %d of %d PID loops logged, the replay runs at the average frame period of %uus\n",
+            decoder.pNum, decoder.pDenom, framePeriodUs);
+    }
+    if (decoder.debugMode != DEBUG_GYRO_NOTCH) {
+        fprintf(stderr, "warning: no debug_mode GYRO_NOTCH, the replay is fed the filtered gyro of the log\n");
+    }
+
+    pidConfigMutable()->pid_process_denom = 1;
+    rxConfigMutable()->rcInterpolation = RC_SMOOTHING_OFF;
+    accelerometerConfigMutable()->acc_hardware = ACC_FAKE;
+    accelerometerConfigMutable()->acc_lpf_hz = 0;   // accSmooth is logged after the filter
+
+    for (int i = 0; i < overrideCount; i++) {
+        char *value = strchr(overrides[i], '=');
+        *value++ = '\0';
+        if (!setSetting(overrides[i], value)) {
+            fprintf(stderr, "%s: invalid setting %s=%s\n", argv[0], overrides[i], value);
+            return 1;
+        }
+    }
+
+    replayInit(framePeriodUs);
+    printCsvHeader();
+
+    blackboxDecoderFrame_t frame;
+    while (blackboxDecoderNext(&decoder, &frame)) {
+        switch (frame.type) {
+        case 'I':
+        case 'P':
+            replayMainFrame(frame.values);
+            break;
+        case 'S':
+            setFlightModes(frame.values[blackboxDecoderFindField(frame.def, "flightModeFlags")]);
+            break;
+        case 'E':
+            if (frame.event.event == FLIGHT_LOG_EVENT_FLIGHTMODE) {
+                setFlightModes(frame.event.data.flightMode.flags);
+            }
+            break;
+        case 'O':
+        case 'o':
+            replayOlFrame(&frame);
+            break;
+        }
+    }
+
+    printError();
+    blackboxLogFileClose(&file);
+    return 0;
+}
@@ -0,0 +1,113 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * The parts of the firmware the replay does not run: the mixer, RX, failsafe, GPS, compass and battery code are
+ * replaced by the values below, the mode activation mask and the RC state are set by blackbox_replay.c from the log.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "platform.h"
+
+#include "common/bitarray.h"
+#include "common/time.h"
+#include "common/utils.h"
+
+#include "pg/pg.h"
+#include "pg/pg_ids.h"
+
+#include "fc/config.h"
+#include "fc/fc_core.h"
+#include "fc/rc_controls.h"
+#include "fc/rc_modes.h"
+
+#include "flight/pid.h"
+
+#include "io/beeper.h"
+#include "io/gps.h"
+
+#include "rx/rx.h"
+
+#include "scheduler/scheduler.h"
+
+#include "sensors/battery.h"
+#include "sensors/compass.h"
+#include "sensors/current.h"
+#include "sensors/sensors.h"
+#include "sensors/voltage.h"
+
+#include "replay_stubs.h"
+
+PG_REGISTER(flight3DConfig_t, flight3DConfig, PG_MOTOR_3D_CONFIG, 0);
+PG_REGISTER(rcControlsConfig_t, rcControlsConfig, PG_RC_CONTROLS_CONFIG, 0);
+PG_REGISTER(rxConfig_t, rxConfig, PG_RX_CONFIG, 0);
+PG_REGISTER(systemConfig_t, systemConfig, PG_SYSTEM_CONFIG, 0);
+
+timeUs_t replayTimeUs;
+boxBitmask_t rcModeActivationMask;
+
+// RX
+bool isRXDataNew;
+float rcCommand[4];
+int16_t rcData[MAX_SUPPORTED_RC_CHANNEL_COUNT];
+uint16_t rxGetRefreshRate(void) { return 0; }
+
+bool IS_RC_MODE_ACTIVE(boxId_e boxId) { return bitArrayGet(&rcModeActivationMask, boxId); }
+bool isAntiGravityModeActive(void) { return IS_RC_MODE_ACTIVE(BOXANTIGRAVITY); }
+
+// Sensors and configuration
+uint8_t detectedSensors[SENSOR_INDEX_COUNT];
+pidProfile_t *currentPidProfile;
+mag_t mag;
+bool compassIsHealthy(void) { return false; }
+
+uint16_t InflightcalibratingA;
+bool AccInflightCalibrationMeasurementDone;
+bool AccInflightCalibrationSavetoEEProm;
+bool AccInflightCalibrationActive;
+
+int16_t GPS_angle[ANGLE_INDEX_COUNT];
+gpsSolutionData_t gpsSol;
+
+const char * const currentMeterSourceNames[CURRENT_METER_COUNT] = { "NONE", "ADC", "VIRTUAL", "ESC", "MSP" };
+const char * const voltageMeterSourceNames[VOLTAGE_METER_COUNT] = { "NONE", "ADC", "ESC" };
+const lowVoltageCutoff_t *getLowVoltageCutoff(void)
+{
+    static const lowVoltageCutoff_t lowVoltageCutoff;
+    return &lowVoltageCutoff;
+}
+
+void saveConfigAndNotify(void) {}
+
+// Mixer and failsafe, the PID outputs are compared with the logged ones before mixing
+float getMotorMixRange(void) { return 0.0f; }
+bool mixerIsOutputSaturated(int axis, float errorRate) { UNUSED(axis); UNUSED(errorRate); return false; }
+bool failsafeIsActive(void) { return false; }
+
+// System
+void beeper(beeperMode_e mode) { UNUSED(mode); }
+void beeperConfirmationBeeps(uint8_t beepCount) { UNUSED(beepCount); }
+void systemBeep(bool on) { UNUSED(on); }
+timeUs_t micros(void) { return replayTimeUs; }
+timeMs_t millis(void) { return replayTimeUs / 1000; }
+timeDelta_t getTaskDeltaTime(cfTaskId_e taskId) { UNUSED(taskId); return 0; }
+void schedulerResetTaskStatistics(cfTaskId_e taskId) { UNUSED(taskId); }
+
+// Gate detections are injected from the O frames instead of the MAVLink RX queue
+void mavlinkRxProcess(timeUs_t currentTimeUs) { UNUSED(currentTimeUs); }
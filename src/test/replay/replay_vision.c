@@ -0,0 +1,78 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * The gate detections of the O frames, fed to the outer loop filter the way mavlinkRxProcess() feeds them in flight.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "platform.h"
+
+#include "blackbox/blackbox_decoder.h"
+
+#include "common/axis.h"
+
+#include "flight/ol_ekf.h"
+#include "flight/ol_filter.h"
+
+#include "replay_vision.h"
+
+static bool seeded;
+static int32_t lastVisionCnt;   // of the log, dr_vision.cnt counts the detections published in the replay
+
+void replayVisionInit(void)
+{
+    seeded = false;
+    lastVisionCnt = 0;
+}
+
+// Returns false if the frame has no detection fields
+bool replayVisionFrame(const blackboxDecoderFrame_t *frame)
+{
+    const blackboxDecoderFrameDef_t *def = frame->def;
+    const int time = blackboxDecoderFindField(def, "time");
+    const int cnt = blackboxDecoderFindField(def, "drVisionCnt");
+    const int vision = blackboxDecoderFindField(def, "drVision[0]");
+    const int visionAge = blackboxDecoderFindField(def, "drVisionAge");
+    const int pos = blackboxDecoderFindField(def, "drPos[0]");
+    const int vel = blackboxDecoderFindField(def, "drVel[0]");
+
+    if (time < 0 || cnt < 0 || vision < 0 || visionAge < 0) {
+        return false;
+    }
+
+    // The log rarely starts with the vehicle at rest at the origin, start the estimate from the logged one
+    if (!seeded && pos >= 0 && vel >= 0) {
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            dr_ekf.x[OL_EKF_X + axis] = frame->values[pos + axis] / 100.0f;
+            dr_ekf.x[OL_EKF_VX + axis] = frame->values[vel + axis] / 100.0f;
+        }
+        lastVisionCnt = frame->values[cnt];
+        seeded = true;
+    }
+
+    // A new detection is picked up by the next ol_navigation_update(), with its capture time for the latency compensation
+    if (frame->values[cnt] != lastVisionCnt) {
+        lastVisionCnt = frame->values[cnt];
+        ol_filter_push_vision(frame->values[vision + 0] / 100.0f, frame->values[vision + 1] / 100.0f,
+            frame->values[vision + 2] / 100.0f, frame->values[time] - frame->values[visionAge]);
+    }
+
+    return true;
+}
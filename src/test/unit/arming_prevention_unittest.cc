@@ -611,6 +611,7 @@ TEST(ArmingPreventionTest, WhenUsingSwitched3DModeThenNormalThrottleArmingCondit
 
 // STUBS
 extern "C" {
+    gyro_t gyro;
     uint32_t micros(void) { return simulationTime; }
     uint32_t millis(void) { return micros() / 1000; }
     bool rxIsReceivingSignal(void) { return simulationHaveRx; }
@@ -659,7 +660,7 @@ extern "C" {
     int16_t calculateThrottleAngleCorrection(uint8_t) { return 0; }
     void processRcCommand(void) {}
     void updateGpsStateForHomeAndHoldMode(void) {}
-    void blackboxUpdate(timeUs_t) {}
+    void blackboxSnapshot(timeUs_t) {}
     void transponderUpdate(timeUs_t) {}
     void GPS_reset_home_position(void) {}
     void accSetCalibrationCycles(uint16_t) {}
@@ -669,5 +670,6 @@ extern "C" {
     void dashboardEnablePageCycling(void) {}
     void dashboardDisablePageCycling(void) {}
     bool imuQuaternionHeadfreeOffsetSet(void) { return true; }
+    void imuIntegrateGyro(const float *, float) {}
     void rescheduleTask(cfTaskId_e, uint32_t) {}
 }
@@ -0,0 +1,397 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "blackbox/blackbox.h"
+    #include "blackbox/blackbox_decoder.h"
+    #include "blackbox/blackbox_encoding.h"
+    #include "blackbox/blackbox_io.h"
+    #include "common/utils.h"
+
+    #include "drivers/serial.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define LOG_BUFFER_SIZE 4096
+
+static uint8_t logBuffer[LOG_BUFFER_SIZE];
+static int logLength;
+
+#define MINTHROTTLE     1070
+#define MOTOR_LOW       1050
+#define VBATREF         420
+
+typedef struct mainState_s {
+    uint32_t iteration;
+    uint32_t time;
+    int32_t axisI[3];
+    int32_t rcCommand[4];
+    int32_t vbat;
+    int32_t rssi;
+    int32_t gyro;
+    int32_t motor[2];
+} mainState_t;
+
+// Field order of mainState_t
+enum {
+    FIELD_ITERATION = 0,
+    FIELD_TIME,
+    FIELD_AXIS_I,
+    FIELD_RC_COMMAND = FIELD_AXIS_I + 3,
+    FIELD_VBAT = FIELD_RC_COMMAND + 4,
+    FIELD_RSSI,
+    FIELD_GYRO,
+    FIELD_MOTOR,
+    FIELD_COUNT = FIELD_MOTOR + 2
+};
+
+static void logWrite(const void *data, int length)
+{
+    ASSERT_LE(logLength + length, LOG_BUFFER_SIZE);
+    memcpy(logBuffer + logLength, data, length);
+    logLength += length;
+}
+
+static void writeHeader(void)
+{
+    logWrite("H Product:Blackbox flight data recorder by Nicholas Sherlock\n", 61);
+    blackboxPrintfHeaderLine("Field I name", "%s", "loopIteration,time,axisI[0],axisI[1],axisI[2],"
+                             "rcCommand[0],rcCommand[1],rcCommand[2],rcCommand[3],vbatLatest,rssi,gyroADC[0],motor[0],motor[1]");
+    blackboxPrintfHeaderLine("Field I signed", "%s", "0,0,1,1,1,1,1,1,0,0,0,1,0,0");
+    blackboxPrintfHeaderLine("Field I predictor", "%s", "0,0,0,0,0,0,0,0,4,9,0,0,11,5");
+    blackboxPrintfHeaderLine("Field I encoding", "%s", "1,1,0,0,0,0,0,0,1,3,1,0,1,0");
+    blackboxPrintfHeaderLine("Field P predictor", "%s", "6,2,1,1,1,1,1,1,1,1,1,3,3,3");
+    blackboxPrintfHeaderLine("Field P encoding", "%s", "9,0,7,7,7,8,8,8,8,6,6,0,0,0");
+    blackboxPrintfHeaderLine("Field S name", "%s", "flightModeFlags,failsafePhase,rxSignalReceived,rxFlightChannelsValid");
+    blackboxPrintfHeaderLine("Field S signed", "%s", "0,1,1,1");
+    blackboxPrintfHeaderLine("Field S predictor", "%s", "0,0,0,0");
+    blackboxPrintfHeaderLine("Field S encoding", "%s", "1,10,10,10");
+    blackboxPrintfHeaderLine("I interval", "%d", 32);
+    blackboxPrintfHeaderLine("P interval", "%d/%d", 1, 2);
+    blackboxPrintfHeaderLine("minthrottle", "%d", MINTHROTTLE);
+    blackboxPrintfHeaderLine("motorOutput", "%d,%d", MOTOR_LOW, 2000);
+    blackboxPrintfHeaderLine("vbatref", "%d", VBATREF);
+}
+
+// Frames written the way writeIntraframe() and writeInterframe() do
+static void writeMainFrame(const mainState_t *state, const mainState_t *prev, const mainState_t *prev2)
+{
+    uint8_t frame[BLACKBOX_MAX_FRAME_SIZE];
+    uint8_t *pos = frame;
+
+    if (!prev) {
+        *pos++ = 'I';
+        pos = blackboxEncodeUnsignedVB(pos, state->iteration);
+        pos = blackboxEncodeUnsignedVB(pos, state->time);
+        pos = blackboxEncodeSignedVBArray(pos, state->axisI, 3);
+        pos = blackboxEncodeSignedVBArray(pos, state->rcCommand, 3);
+        pos = blackboxEncodeUnsignedVB(pos, state->rcCommand[3] - MINTHROTTLE);
+        pos = blackboxEncodeUnsignedVB(pos, (VBATREF - state->vbat) & 0x3FFF);
+        pos = blackboxEncodeUnsignedVB(pos, state->rssi);
+        pos = blackboxEncodeSignedVB(pos, state->gyro);
+        pos = blackboxEncodeUnsignedVB(pos, state->motor[0] - MOTOR_LOW);
+        pos = blackboxEncodeSignedVB(pos, state->motor[1] - state->motor[0]);
+    } else {
+        int32_t deltas[4];
+
+        *pos++ = 'P';
+        pos = blackboxEncodeSignedVB(pos, (int32_t)(state->time - 2 * prev->time + prev2->time));
+        for (int i = 0; i < 3; i++) {
+            deltas[i] = state->axisI[i] - prev->axisI[i];
+        }
+        pos = blackboxEncodeTag2_3S32(pos, deltas);
+        for (int i = 0; i < 4; i++) {
+            deltas[i] = state->rcCommand[i] - prev->rcCommand[i];
+        }
+        pos = blackboxEncodeTag8_4S16(pos, deltas);
+        deltas[0] = state->vbat - prev->vbat;
+        deltas[1] = state->rssi - prev->rssi;
+        pos = blackboxEncodeTag8_8SVB(pos, deltas, 2);
+        pos = blackboxEncodeSignedVB(pos, state->gyro - (prev->gyro + prev2->gyro) / 2);
+        for (int i = 0; i < 2; i++) {
+            pos = blackboxEncodeSignedVB(pos, state->motor[i] - (prev->motor[i] + prev2->motor[i]) / 2);
+        }
+    }
+
+    logWrite(frame, pos - frame);
+}
+
+static void writeSlowFrame(uint32_t flags, int32_t *values)
+{
+    blackboxWrite('S');
+    blackboxWriteUnsignedVB(flags);
+    blackboxWriteTag2_3SVariable(values);
+}
+
+static void writeLogEnd(void)
+{
+    blackboxWrite('E');
+    blackboxWrite(FLIGHT_LOG_EVENT_LOG_END);
+    blackboxWriteString("End of log");
+    blackboxWrite(0);
+}
+
+static mainState_t makeState(int i)
+{
+    mainState_t state;
+
+    state.iteration = 2 * i;    // P interval 1/2 logs every other iteration
+    state.time = 4000000000u + 250 * i;   // wraps in the middle of the log
+    state.axisI[0] = i;
+    state.axisI[1] = -3 * i * i;
+    state.axisI[2] = 100000 * i;
+    state.rcCommand[0] = 0;
+    state.rcCommand[1] = 7 * i;
+    state.rcCommand[2] = -300 * i;
+    state.rcCommand[3] = MINTHROTTLE + 40 * i;
+    state.vbat = VBATREF + 5 - i;
+    state.rssi = i & 4 ? 1023 : 0;
+    state.gyro = (i & 1 ? -1 : 1) * 37 * i;
+    state.motor[0] = MOTOR_LOW - 10 + 113 * i;
+    state.motor[1] = MOTOR_LOW + 900 - 50 * i;
+    return state;
+}
+
+static void expectState(const mainState_t *state, const blackboxDecoderFrame_t *frame)
+{
+    const int32_t *v = frame->values;
+
+    EXPECT_EQ(state->iteration, (uint32_t)v[FIELD_ITERATION]);
+    EXPECT_EQ(state->time, (uint32_t)v[FIELD_TIME]);
+    for (int i = 0; i < 3; i++) {
+        EXPECT_EQ(state->axisI[i], v[FIELD_AXIS_I + i]);
+    }
+    for (int i = 0; i < 4; i++) {
+        EXPECT_EQ(state->rcCommand[i], v[FIELD_RC_COMMAND + i]);
+    }
+    EXPECT_EQ(state->vbat, v[FIELD_VBAT]);
+    EXPECT_EQ(state->rssi, v[FIELD_RSSI]);
+    EXPECT_EQ(state->gyro, v[FIELD_GYRO]);
+    EXPECT_EQ(state->motor[0], v[FIELD_MOTOR]);
+    EXPECT_EQ(state->motor[1], v[FIELD_MOTOR + 1]);
+}
+
+// Writes an I frame and count - 1 P frames of makeState(first) on
+static void writeMainFrames(int first, int count)
+{
+    mainState_t history[3];
+
+    for (int i = 0; i < count; i++) {
+        history[i % 3] = makeState(first + i);
+        if (i == 0) {
+            writeMainFrame(&history[0], NULL, NULL);
+        } else {
+            writeMainFrame(&history[i % 3], &history[(i + 2) % 3], i >= 2 ? &history[(i + 1) % 3] : &history[(i + 2) % 3]);
+        }
+    }
+}
+
+static blackboxDecoder_t decoder;
+
+TEST(BlackboxDecoderTest, Header)
+{
+    // given
+    logLength = 0;
+    writeHeader();
+
+    // when
+    EXPECT_TRUE(blackboxDecoderInit(&decoder, logBuffer, logLength));
+
+    // then
+    const blackboxDecoderFrameDef_t *def = &decoder.def[BLACKBOX_DECODER_DEF_MAIN];
+    EXPECT_EQ(FIELD_COUNT, def->fieldCount);
+    EXPECT_STREQ("rcCommand[3]", def->name[FIELD_RC_COMMAND + 3]);
+    EXPECT_EQ(FIELD_MOTOR, blackboxDecoderFindField(def, "motor[0]"));
+    EXPECT_EQ(-1, blackboxDecoderFindField(def, "motor[2]"));
+    EXPECT_EQ(FLIGHT_LOG_FIELD_PREDICTOR_MINTHROTTLE, def->predictor[0][FIELD_RC_COMMAND + 3]);
+    EXPECT_EQ(FLIGHT_LOG_FIELD_ENCODING_TAG8_4S16, def->encoding[1][FIELD_RC_COMMAND + 3]);
+    EXPECT_EQ(4, decoder.def[BLACKBOX_DECODER_DEF_SLOW].fieldCount);
+    EXPECT_EQ(0, decoder.def[BLACKBOX_DECODER_DEF_OL].fieldCount);
+    EXPECT_EQ(32, decoder.iInterval);
+    EXPECT_EQ(1, decoder.pNum);
+    EXPECT_EQ(2, decoder.pDenom);
+    EXPECT_EQ(MINTHROTTLE, decoder.minthrottle);
+    EXPECT_EQ(MOTOR_LOW, decoder.motorOutputLow);
+    EXPECT_EQ(VBATREF, decoder.vbatref);
+}
+
+TEST(BlackboxDecoderTest, MainFrames)
+{
+    // given
+    logLength = 0;
+    writeHeader();
+    writeMainFrames(0, 10);
+    writeLogEnd();
+
+    // when
+    EXPECT_TRUE(blackboxDecoderInit(&decoder, logBuffer, logLength));
+
+    // then
+    blackboxDecoderFrame_t frame;
+    for (int i = 0; i < 10; i++) {
+        ASSERT_TRUE(blackboxDecoderNext(&decoder, &frame));
+        EXPECT_EQ(i == 0 ? 'I' : 'P', frame.type);
+        const mainState_t state = makeState(i);
+        expectState(&state, &frame);
+    }
+    ASSERT_TRUE(blackboxDecoderNext(&decoder, &frame));
+    EXPECT_EQ('E', frame.type);
+    EXPECT_EQ(FLIGHT_LOG_EVENT_LOG_END, frame.event.event);
+    EXPECT_FALSE(blackboxDecoderNext(&decoder, &frame));
+    EXPECT_EQ(10, decoder.stats.frames[BLACKBOX_DECODER_DEF_MAIN]);
+    EXPECT_EQ(0, decoder.stats.corruptFrames);
+}
+
+TEST(BlackboxDecoderTest, SlowFrameVariableEncoding)
+{
+    // given
+    int32_t values[][3] = {
+        {1, -2, 0},         // 2 bits
+        {-16, 15, 7},       // 554
+        {-128, 63, -64},    // 877
+        {256, -129, 8388608} // 32 bits
+    };
+    logLength = 0;
+    writeHeader();
+    for (unsigned i = 0; i < ARRAYLEN(values); i++) {
+        writeSlowFrame(i * 1000, values[i]);
+    }
+
+    // when
+    EXPECT_TRUE(blackboxDecoderInit(&decoder, logBuffer, logLength));
+
+    // then
+    blackboxDecoderFrame_t frame;
+    for (unsigned i = 0; i < ARRAYLEN(values); i++) {
+        ASSERT_TRUE(blackboxDecoderNext(&decoder, &frame));
+        EXPECT_EQ('S', frame.type);
+        EXPECT_EQ(i * 1000, (uint32_t)frame.values[0]);
+        EXPECT_EQ(values[i][0], frame.values[1]);
+        EXPECT_EQ(values[i][1], frame.values[2]);
+        EXPECT_EQ(values[i][2], frame.values[3]);
+    }
+    EXPECT_FALSE(blackboxDecoderNext(&decoder, &frame));
+}
+
+TEST(BlackboxDecoderTest, CorruptFrameResynchronises)
+{
+    // given
+    logLength = 0;
+    writeHeader();
+    writeMainFrames(0, 3);
+    // a frame marker followed by a variable byte value that never ends, then more bytes that are not frames
+    const uint8_t garbage[] = { 'P', 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 };
+    logWrite(garbage, sizeof(garbage));
+    writeMainFrames(3, 2);      // I and P frame after the damage
+
+    // when
+    EXPECT_TRUE(blackboxDecoderInit(&decoder, logBuffer, logLength));
+
+    // then
+    blackboxDecoderFrame_t frame;
+    for (int i = 0; i < 5; i++) {
+        ASSERT_TRUE(blackboxDecoderNext(&decoder, &frame));
+        const mainState_t state = makeState(i);
+        expectState(&state, &frame);
+    }
+    EXPECT_FALSE(blackboxDecoderNext(&decoder, &frame));
+    EXPECT_EQ(7, decoder.stats.corruptFrames);
+}
+
+TEST(BlackboxDecoderTest, DeltaFramesWaitForIntraFrame)
+{
+    // given
+    logLength = 0;
+    writeHeader();
+    const int start = logLength;
+    writeMainFrames(0, 1);
+    const int intraLength = logLength - start;
+    logLength = start;
+    writeMainFrames(0, 4);
+    // drop the I frame, as if the start of the log had been lost
+    logLength -= intraLength;
+    memmove(logBuffer + start, logBuffer + start + intraLength, logLength - start);
+
+    // when
+    EXPECT_TRUE(blackboxDecoderInit(&decoder, logBuffer, logLength));
+
+    // then
+    blackboxDecoderFrame_t frame;
+    EXPECT_FALSE(blackboxDecoderNext(&decoder, &frame));
+    EXPECT_EQ(3, decoder.stats.skippedFrames);
+}
+
+TEST(BlackboxDecoderTest, FindLog)
+{
+    // given
+    logLength = 0;
+    writeHeader();
+    writeMainFrames(0, 2);
+    writeLogEnd();
+    const int second = logLength;
+    writeHeader();
+    writeMainFrames(5, 2);
+
+    // then
+    EXPECT_EQ(logBuffer, blackboxDecoderFindLog(logBuffer, logLength, 0));
+    EXPECT_EQ(logBuffer + second, blackboxDecoderFindLog(logBuffer, logLength, 1));
+    EXPECT_EQ(NULL, blackboxDecoderFindLog(logBuffer, logLength, 2));
+
+    // when
+    const uint8_t *log = blackboxDecoderFindLog(logBuffer, logLength, 1);
+    EXPECT_TRUE(blackboxDecoderInit(&decoder, log, logBuffer + logLength - log));
+
+    // then
+    blackboxDecoderFrame_t frame;
+    ASSERT_TRUE(blackboxDecoderNext(&decoder, &frame));
+    const mainState_t state = makeState(5);
+    expectState(&state, &frame);
+}
+
+// STUBS
+
+extern "C" {
+
+int32_t blackboxHeaderBudget;
+void serialWrite(serialPort_t *, uint8_t) {}
+bool isSerialTransmitBufferEmpty(const serialPort_t *) { return true; }
+
+void blackboxWrite(uint8_t value)
+{
+    logWrite(&value, 1);
+}
+
+void blackboxWriteBuf(const uint8_t *buf, int length)
+{
+    logWrite(buf, length);
+}
+
+int blackboxWriteString(const char *s)
+{
+    const int length = strlen(s);
+    logWrite(s, length);
+    return length;
+}
+
+}
@@ -118,6 +118,95 @@ TEST(BlackboxEncodingTest, TestWriteUnsignedVB)
     EXPECT_EQ(1, serialWriteBuffer[2]);
 }
 
+TEST(BlackboxEncodingTest, TestEncodeUnsignedVB)
+{
+    uint8_t buf[BLACKBOX_VB_MAX_BYTES + 1];
+
+    EXPECT_EQ(1, blackboxEncodeUnsignedVB(buf, 0) - buf);
+    EXPECT_EQ(0, buf[0]);
+    EXPECT_EQ(1, blackboxEncodeUnsignedVB(buf, 127) - buf);
+    EXPECT_EQ(127, buf[0]);
+    EXPECT_EQ(2, blackboxEncodeUnsignedVB(buf, 128) - buf);
+    EXPECT_EQ(0x80, buf[0]);
+    EXPECT_EQ(1, buf[1]);
+    EXPECT_EQ(2, blackboxEncodeUnsignedVB(buf, 16383) - buf);
+    EXPECT_EQ(3, blackboxEncodeUnsignedVB(buf, 16384) - buf);
+    EXPECT_EQ(5, blackboxEncodeUnsignedVB(buf, 0xFFFFFFFF) - buf);
+    EXPECT_EQ(0xFF, buf[0]);
+    EXPECT_EQ(0x0F, buf[4]);
+
+    // zigzag: -1 -> 1, 1 -> 2
+    EXPECT_EQ(1, blackboxEncodeSignedVB(buf, -1) - buf);
+    EXPECT_EQ(1, buf[0]);
+    EXPECT_EQ(1, blackboxEncodeSignedVB(buf, 1) - buf);
+    EXPECT_EQ(2, buf[0]);
+}
+
+TEST(BlackboxEncodingTest, TestEncodeTag2_3S32)
+{
+    uint8_t buf[BLACKBOX_TAG2_3S32_MAX_BYTES];
+
+    int32_t v2[3] = {1, -2, 0};
+    EXPECT_EQ(1, blackboxEncodeTag2_3S32(buf, v2) - buf);
+    EXPECT_EQ(0x18, buf[0]); // 0001 1000
+
+    int32_t v4[3] = {7, -8, 2};
+    EXPECT_EQ(2, blackboxEncodeTag2_3S32(buf, v4) - buf);
+    EXPECT_EQ(0x47, buf[0]); // 0100 0111
+    EXPECT_EQ(0x82, buf[1]); // 1000 0010
+
+    int32_t v6[3] = {31, -32, 8};
+    EXPECT_EQ(3, blackboxEncodeTag2_3S32(buf, v6) - buf);
+    EXPECT_EQ(0x9F, buf[0]);
+    EXPECT_EQ(0xE0, buf[1]);
+    EXPECT_EQ(0x08, buf[2]);
+
+    // 1, 2 and 4 byte fields
+    int32_t v32[3] = {32, -129, 0x12345678};
+    EXPECT_EQ(8, blackboxEncodeTag2_3S32(buf, v32) - buf);
+    EXPECT_EQ(0xF4, buf[0]); // 11 11 01 00
+    EXPECT_EQ(32, buf[1]);
+    EXPECT_EQ(0x7F, buf[2]);
+    EXPECT_EQ(0xFF, buf[3]);
+    EXPECT_EQ(0x78, buf[4]);
+    EXPECT_EQ(0x12, buf[7]);
+}
+
+TEST(BlackboxEncodingTest, TestEncodeTag8_4S16)
+{
+    uint8_t buf[BLACKBOX_TAG8_4S16_MAX_BYTES];
+
+    int32_t zero[4] = {0, 0, 0, 0};
+    EXPECT_EQ(1, blackboxEncodeTag8_4S16(buf, zero) - buf);
+    EXPECT_EQ(0, buf[0]);
+
+    // 4 bit, 8 bit, zero, 16 bit
+    int32_t v[4] = {-8, 100, 0, 1000};
+    EXPECT_EQ(5, blackboxEncodeTag8_4S16(buf, v) - buf);
+    EXPECT_EQ(0xC9, buf[0]); // 11 00 10 01
+    EXPECT_EQ(0x86, buf[1]); // -8, high nibble of 100
+    EXPECT_EQ(0x40, buf[2]); // low nibble of 100, high nibble of 1000
+    EXPECT_EQ(0x3E, buf[3]); // middle bits of 1000
+    EXPECT_EQ(0x80, buf[4]); // low nibble of 1000
+}
+
+TEST(BlackboxEncodingTest, TestEncodeTag8_8SVB)
+{
+    uint8_t buf[BLACKBOX_TAG8_8SVB_MAX_BYTES];
+
+    int32_t v[8] = {0, 1, 0, 0, 0, 0, 0, -100};
+    EXPECT_EQ(4, blackboxEncodeTag8_8SVB(buf, v, 8) - buf);
+    EXPECT_EQ(0x82, buf[0]);
+    EXPECT_EQ(2, buf[1]);
+    EXPECT_EQ(0xC7, buf[2]); // zigzag(-100) = 199
+    EXPECT_EQ(0x01, buf[3]);
+
+    // A single field has no header
+    EXPECT_EQ(1, blackboxEncodeTag8_8SVB(buf, v + 1, 1) - buf);
+    EXPECT_EQ(2, buf[0]);
+    EXPECT_EQ(0, blackboxEncodeTag8_8SVB(buf, v, 0) - buf);
+}
+
 TEST(BlackboxTest, TestWriteTag2_3SVariable_BITS2)
 {
     serialTestResetBuffers();
@@ -246,6 +335,7 @@ PG_REGISTER(blackboxConfig_t, blackboxConfig, PG_BLACKBOX_CONFIG, 0);
 int32_t blackboxHeaderBudget;
 void mspSerialAllocatePorts(void) {}
 void blackboxWrite(uint8_t value) {serialWrite(blackboxPort, value);}
+void blackboxWriteBuf(const uint8_t *buf, int length) {serialWriteBuf(blackboxPort, buf, length);}
 int blackboxWriteString(const char *s)
 {
     const uint8_t *pos = (uint8_t*)s;
@@ -0,0 +1,255 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "blackbox/blackbox.h"
+    #include "blackbox/blackbox_decoder.h"
+    #include "blackbox/blackbox_encoding.h"
+    #include "blackbox/blackbox_io.h"
+
+    #include "build/debug.h"
+
+    #include "drivers/serial.h"
+
+    #include "flight/ol_control.h"
+    #include "flight/ol_ekf.h"
+    #include "flight/ol_filter.h"
+    #include "flight/ol_flightplan.h"
+
+    #include "../replay/replay_vision.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define LOG_BUFFER_SIZE 1024
+
+#define NAV_PERIOD_US   5000
+#define START_US        1000000
+
+static uint8_t logBuffer[LOG_BUFFER_SIZE];
+static int logLength;
+
+typedef struct olState_s {
+    int32_t time;
+    int32_t visionCnt;
+    int32_t vision[3];     // cm
+    int32_t visionAge;     // us
+    int32_t pos[3];        // cm
+    int32_t vel[3];        // cm/s
+} olState_t;
+
+static void logWrite(const void *data, int length)
+{
+    ASSERT_LE(logLength + length, LOG_BUFFER_SIZE);
+    memcpy(logBuffer + logLength, data, length);
+    logLength += length;
+}
+
+static void writeHeader(void)
+{
+    logWrite("H Product:Blackbox flight data recorder by Nicholas Sherlock\n", 61);
+    blackboxPrintfHeaderLine("Field I name", "%s", "loopIteration,time");
+    blackboxPrintfHeaderLine("Field I signed", "%s", "0,0");
+    blackboxPrintfHeaderLine("Field I predictor", "%s", "0,0");
+    blackboxPrintfHeaderLine("Field I encoding", "%s", "1,1");
+    blackboxPrintfHeaderLine("Field O name", "%s", "time,drVisionCnt,drVision[0],drVision[1],drVision[2],drVisionAge,"
+                             "drPos[0],drPos[1],drPos[2],drVel[0],drVel[1],drVel[2]");
+    blackboxPrintfHeaderLine("Field O signed", "%s", "0,0,1,1,1,1,1,1,1,1,1,1");
+    blackboxPrintfHeaderLine("Field O predictor", "%s", "0,0,0,0,0,0,0,0,0,0,0,0");
+    blackboxPrintfHeaderLine("Field O encoding", "%s", "1,1,0,0,0,0,0,0,0,0,0,0");
+}
+
+static void writeOlFrame(const olState_t *state)
+{
+    uint8_t frame[BLACKBOX_MAX_FRAME_SIZE];
+    uint8_t *pos = frame;
+
+    *pos++ = 'O';
+    pos = blackboxEncodeUnsignedVB(pos, state->time);
+    pos = blackboxEncodeUnsignedVB(pos, state->visionCnt);
+    pos = blackboxEncodeSignedVBArray(pos, state->vision, 3);
+    pos = blackboxEncodeSignedVB(pos, state->visionAge);
+    pos = blackboxEncodeSignedVBArray(pos, state->pos, 3);
+    pos = blackboxEncodeSignedVBArray(pos, state->vel, 3);
+
+    logWrite(frame, pos - frame);
+}
+
+static void writeLogEnd(void)
+{
+    blackboxWrite('E');
+    blackboxWrite(FLIGHT_LOG_EVENT_LOG_END);
+    blackboxWriteString("End of log");
+    blackboxWrite(0);
+}
+
+static blackboxDecoder_t decoder;
+static timeUs_t navTimeUs;
+
+// The outer loop of ol_navigation_update() with RANGEFINDER_MODE on, up to time
+static void runNavigation(timeUs_t time)
+{
+    static int lastVisionCnt;
+
+    for (; cmpTimeUs(time, navTimeUs) >= 0; navTimeUs += NAV_PERIOD_US) {
+        ol_filter_fetch_vision();
+        ol_filter_predict(navTimeUs);
+        if (dr_vision.cnt != lastVisionCnt) {
+            lastVisionCnt = dr_vision.cnt;
+            ol_filter_correct();
+        }
+    }
+}
+
+// Replays the O frames of the log like blackbox_replay does
+static void replayLog(void)
+{
+    ASSERT_TRUE(blackboxDecoderInit(&decoder, logBuffer, logLength));
+
+    blackboxDecoderFrame_t frame;
+    while (blackboxDecoderNext(&decoder, &frame)) {
+        if (frame.type == 'O' || frame.type == 'o') {
+            runNavigation(frame.values[0]);
+            EXPECT_TRUE(replayVisionFrame(&frame));
+        }
+    }
+}
+
+static void resetReplay(void)
+{
+    logLength = 0;
+    navTimeUs = START_US;
+    ol_filter_reset();
+    replayVisionInit();
+
+    dr_fp.gate_x = 5.0f;
+    dr_fp.gate_y = 0.0f;
+    dr_fp.gate_alt = 150.0f;
+}
+
+TEST(BlackboxReplayTest, DetectionMovesEstimate)
+{
+    // given
+    resetReplay();
+    writeHeader();
+    olState_t state = {};
+    state.time = START_US;
+    writeOlFrame(&state);
+
+    // gate seen 4.5m ahead and 1.5m above 20ms ago, the vehicle is at x = 0.5m
+    state.time = START_US + 100000;
+    state.visionCnt = 1;
+    state.vision[0] = 450;
+    state.vision[2] = 150;
+    state.visionAge = 20000;
+    writeOlFrame(&state);
+
+    state.time = START_US + 200000;
+    writeOlFrame(&state);
+    writeLogEnd();
+
+    // position not known yet, the detection is trusted
+    dr_ekf.P[OL_EKF_X][OL_EKF_X] = 1.0f;
+    dr_ekf.P[OL_EKF_Y][OL_EKF_Y] = 1.0f;
+    const int visionCnt = dr_vision.cnt;
+
+    // when
+    replayLog();
+    runNavigation(START_US + 200000);
+
+    // then
+    EXPECT_EQ(visionCnt + 1, dr_vision.cnt);
+    EXPECT_EQ(START_US + 100000 - 20000, (int)dr_vision.time);
+    EXPECT_FLOAT_EQ(4.5f, dr_vision.dx);
+    EXPECT_NEAR(0.5f, dr_state.x, 0.05f);
+}
+
+TEST(BlackboxReplayTest, SeedsFromFirstFrame)
+{
+    // given
+    resetReplay();
+    writeHeader();
+    olState_t state = {};
+    state.time = START_US;
+    state.visionCnt = 7;        // detection of before the log started
+    state.vision[0] = 100;
+    state.pos[0] = 250;
+    state.vel[1] = -50;
+    writeOlFrame(&state);
+    writeLogEnd();
+    const int visionCnt = dr_vision.cnt;
+
+    // when
+    replayLog();
+    runNavigation(START_US + NAV_PERIOD_US);
+
+    // then
+    EXPECT_EQ(visionCnt, dr_vision.cnt);
+    EXPECT_NEAR(2.5f, dr_state.x, 0.01f);
+    EXPECT_NEAR(-0.5f, dr_state.vy, 0.01f);
+}
+
+// STUBS
+
+extern "C" {
+
+int16_t debug[DEBUG16_VALUE_COUNT];
+uint8_t debugMode;
+
+struct dronerace_control_struct dr_control;
+struct dronerace_fp_struct dr_fp;
+
+bool imuGetEarthAcceleration(float *accEarth)
+{
+    accEarth[0] = accEarth[1] = accEarth[2] = 0;
+    return true;
+}
+
+void imuGetRotationMatrix(float rotation[3][3])
+{
+    memset(rotation, 0, sizeof(float[3][3]));
+    rotation[0][0] = rotation[1][1] = rotation[2][2] = 1;
+}
+
+int32_t blackboxHeaderBudget;
+void serialWrite(serialPort_t *, uint8_t) {}
+bool isSerialTransmitBufferEmpty(const serialPort_t *) { return true; }
+
+void blackboxWrite(uint8_t value)
+{
+    logWrite(&value, 1);
+}
+
+void blackboxWriteBuf(const uint8_t *buf, int length)
+{
+    logWrite(buf, length);
+}
+
+int blackboxWriteString(const char *s)
+{
+    const int length = strlen(s);
+    logWrite(s, length);
+    return length;
+}
+
+}
@@ -244,6 +244,32 @@ TEST(BlackboxTest, Test_zero_p_denom)
     EXPECT_EQ(false, blackboxShouldLogPFrame());
 }
 
+TEST(BlackboxTest, Test_ol_denom)
+{
+    blackboxConfigMutable()->p_denom = 32;
+    blackboxConfigMutable()->ol_denom = 8;
+    // 1kHz PIDloop, O frames at 125Hz
+    gyro.targetLooptime = 1000;
+    blackboxInit();
+    EXPECT_EQ(true, blackboxShouldLogOlFrame());
+
+    for (int frame = 0; frame < 4; ++frame) {
+        for (int ii = 0; ii < 7; ++ii) {
+            blackboxAdvanceIterationTimers();
+            EXPECT_EQ(false, blackboxShouldLogOlFrame());
+        }
+        blackboxAdvanceIterationTimers();
+        EXPECT_EQ(true, blackboxShouldLogOlFrame());
+    }
+
+    blackboxConfigMutable()->ol_denom = 0;
+    blackboxInit();
+    for (int ii = 0; ii < 32; ++ii) {
+        EXPECT_EQ(false, blackboxShouldLogOlFrame());
+        blackboxAdvanceIterationTimers();
+    }
+}
+
 TEST(BlackboxTest, Test_CalculatePDenom)
 {
     blackboxConfigMutable()->p_denom = 0;
@@ -383,6 +409,7 @@ bool isModeActivationConditionPresent(boxId_e) {return false;}
 uint32_t millis(void) {return 0;}
 bool sensors(uint32_t) {return false;}
 void serialWrite(serialPort_t *, uint8_t) {}
+void serialWriteBuf(serialPort_t *, const uint8_t *, int) {}
 uint32_t serialTxBytesFree(const serialPort_t *) {return 0;}
 bool isSerialTransmitBufferEmpty(const serialPort_t *) {return false;}
 bool feature(uint32_t) {return false;}
@@ -198,3 +198,139 @@ TEST(FilterUnittest, TestSlewFilter)
     slewFilterApply(&filter, 200.0f);
     EXPECT_EQ(200, filter.state);
 }
+
+static float testFilterInput(int axis, int i)
+{
+    // a different mix of tones on each axis
+    return 100.0f * sinf(0.05f * i * (axis + 1)) + 30.0f * sinf(1.3f * i + axis);
+}
+
+TEST(FilterUnittest, TestBiquadFilterBankMatchesBiquadFilter)
+{
+    biquadFilter_t notch[3], lpf[3];
+    biquadFilterBank_t notchBank, lpfBank;
+
+    for (int axis = 0; axis < 3; axis++) {
+        biquadFilterInit(&notch[axis], 200, 125, filterGetNotchQ(200, 160), FILTER_NOTCH);
+        biquadFilterInitLPF(&lpf[axis], 90, 125);
+    }
+    biquadFilterBankInit(&notchBank, 200, 125, filterGetNotchQ(200, 160), FILTER_NOTCH);
+    biquadFilterBankInitLPF(&lpfBank, 90, 125);
+
+    for (int i = 0; i < 200; i++) {
+        float data[FILTER_BANK_LANES] = { testFilterInput(0, i), testFilterInput(1, i), testFilterInput(2, i), 0.0f };
+        biquadFilterBankApply(&notchBank, data);
+        biquadFilterBankApplyDF1(&lpfBank, data);
+        for (int axis = 0; axis < 3; axis++) {
+            const float expected = biquadFilterApplyDF1(&lpf[axis], biquadFilterApply(&notch[axis], testFilterInput(axis, i)));
+            EXPECT_FLOAT_EQ(expected, data[axis]);
+        }
+        // the padding lane filters zeros
+        EXPECT_EQ(0.0f, data[3]);
+    }
+}
+
+TEST(FilterUnittest, TestBiquadFilterBankUpdateMovesOneLane)
+{
+    biquadFilter_t notch[3];
+    biquadFilterBank_t bank;
+
+    for (int axis = 0; axis < 3; axis++) {
+        biquadFilterInit(&notch[axis], 400, 125, filterGetNotchQ(400, 390), FILTER_NOTCH);
+    }
+    biquadFilterBankInit(&bank, 400, 125, filterGetNotchQ(400, 390), FILTER_NOTCH);
+
+    for (int i = 0; i < 300; i++) {
+        if (i == 100) {
+            // retune the Y axis only, the state of every lane is kept
+            biquadFilterUpdate(&notch[1], 250, 125, filterGetNotchQ(250, 200), FILTER_NOTCH);
+            biquadFilterBankUpdate(&bank, 1, 250, 125, filterGetNotchQ(250, 200), FILTER_NOTCH);
+            EXPECT_FLOAT_EQ(notch[1].b1, bank.b1[1]);
+            EXPECT_FLOAT_EQ(notch[0].b1, bank.b1[0]);
+            EXPECT_NE(bank.b1[0], bank.b1[1]);
+        }
+        float data[FILTER_BANK_LANES] = { testFilterInput(0, i), testFilterInput(1, i), testFilterInput(2, i), 0.0f };
+        biquadFilterBankApplyDF1(&bank, data);
+        for (int axis = 0; axis < 3; axis++) {
+            EXPECT_FLOAT_EQ(biquadFilterApplyDF1(&notch[axis], testFilterInput(axis, i)), data[axis]);
+        }
+    }
+}
+
+static float testNotchQ(float centerFreq)
+{
+    return filterGetNotchQApprox(centerFreq, fmaxf(centerFreq - 100, 120));
+}
+
+TEST(FilterUnittest, TestBiquadNotchTableMatchesBiquadFilter)
+{
+    static biquadNotchTable_t table;
+    biquadFilterBank_t bank;
+
+    biquadNotchTableInit(&table, 130, 500, 125, testNotchQ);
+    biquadFilterBankInit(&bank, 400, 125, testNotchQ(400), FILTER_NOTCH);
+
+    // between the entries too, and past both ends where the frequency is clamped
+    for (float freq = 120; freq <= 510; freq += 0.7f) {
+        const float centerFreq = fminf(fmaxf(freq, 130), 500);
+        biquadFilter_t notch;
+        biquadFilterInit(&notch, centerFreq, 125, testNotchQ(centerFreq), FILTER_NOTCH);
+        biquadFilterBankUpdateNotch(&bank, 2, &table, freq);
+        EXPECT_NEAR(notch.b0, bank.b0[2], 1e-3f);
+        EXPECT_NEAR(notch.b1, bank.b1[2], 1e-3f);
+        EXPECT_NEAR(notch.b2, bank.b2[2], 1e-3f);
+        EXPECT_NEAR(notch.a1, bank.a1[2], 1e-3f);
+        EXPECT_NEAR(notch.a2, bank.a2[2], 1e-3f);
+        // the zeros of a notch are at cos(omega) = -b1 / (2 * b0), the interpolated notch stays on its frequency
+        const float notchFreq = acosf(-bank.b1[2] / (2 * bank.b0[2])) / (2 * M_PI * 125 * 0.000001f);
+        EXPECT_NEAR(centerFreq, notchFreq, 0.1f);
+    }
+}
+
+TEST(FilterUnittest, TestBiquadNotchTableUpdateKeepsState)
+{
+    static biquadNotchTable_t table;
+    biquadFilter_t notch;
+    biquadFilterBank_t bank;
+
+    biquadNotchTableInit(&table, 130, 500, 125, testNotchQ);
+    biquadFilterInit(&notch, 300, 125, testNotchQ(300), FILTER_NOTCH);
+    biquadFilterBankInit(&bank, 300, 125, testNotchQ(300), FILTER_NOTCH);
+
+    // sweep the notch a little every cycle, as the dynamic notch does, the output follows the exact filter
+    for (int i = 0; i < 2000; i++) {
+        const float centerFreq = 300 + 50 * sinf(i * 0.005f);
+        biquadFilterUpdate(&notch, centerFreq, 125, testNotchQ(centerFreq), FILTER_NOTCH);
+        biquadFilterBankUpdateNotch(&bank, 0, &table, centerFreq);
+        float data[FILTER_BANK_LANES] = { testFilterInput(0, i), 0.0f, 0.0f, 0.0f };
+        biquadFilterBankApplyDF1(&bank, data);
+        EXPECT_NEAR(biquadFilterApplyDF1(&notch, testFilterInput(0, i)), data[0], 0.01f);
+    }
+}
+
+TEST(FilterUnittest, TestPt1AndKalmanFilterBankMatchFilters)
+{
+    pt1Filter_t pt1[3];
+    fastKalman_t kalman[3];
+    pt1FilterBank_t pt1Bank;
+    fastKalmanBank_t kalmanBank;
+
+    for (int axis = 0; axis < 3; axis++) {
+        pt1FilterInit(&pt1[axis], 100, 0.000125f);
+        pt1[axis].state = 0.0f;
+        fastKalmanInit(&kalman[axis], 3000, 88, 0);
+    }
+    pt1FilterBankInit(&pt1Bank, 100, 0.000125f);
+    fastKalmanBankInit(&kalmanBank, 3000, 88, 0);
+
+    for (int i = 0; i < 200; i++) {
+        float data[FILTER_BANK_LANES] = { testFilterInput(0, i), testFilterInput(1, i), testFilterInput(2, i), 0.0f };
+        fastKalmanBankApply(&kalmanBank, data);
+        pt1FilterBankApply(&pt1Bank, data);
+        for (int axis = 0; axis < 3; axis++) {
+            const float expected = pt1FilterApply(&pt1[axis], fastKalmanUpdate(&kalman[axis], testFilterInput(axis, i)));
+            EXPECT_FLOAT_EQ(expected, data[axis]);
+        }
+        EXPECT_EQ(0.0f, data[3]);
+    }
+}
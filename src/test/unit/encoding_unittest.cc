@@ -56,6 +56,7 @@ TEST(EncodingTest, ZigzagEncodingTest)
         zigzagEncodingExpectation_t *expectation = &expectations[i];
 
         EXPECT_EQ(expectation->expected, zigzagEncode(expectation->input));
+        EXPECT_EQ(expectation->input, zigzagDecode(expectation->expected));
     }
 }
 
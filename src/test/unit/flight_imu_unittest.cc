@@ -40,6 +40,7 @@ extern "C" {
     #include "flight/mixer.h"
     #include "flight/pid.h"
     #include "flight/imu.h"
+    #include "flight/ol_filter.h"
 
     #include "io/gps.h"
 
@@ -49,6 +50,7 @@ extern "C" {
     #include "sensors/barometer.h"
     #include "sensors/compass.h"
     #include "sensors/gyro.h"
+    #include "sensors/rangefinder.h"
     #include "sensors/sensors.h"
 
     void imuComputeRotationMatrix(void);
@@ -56,6 +58,9 @@ extern "C" {
 
     extern quaternion q;
     extern float rMat[3][3];
+    extern float correctionRate[XYZ_AXIS_COUNT];
+
+    static uint32_t enabledSensors;
 
     PG_REGISTER(rcControlsConfig_t, rcControlsConfig, PG_RC_CONTROLS_CONFIG, 0);
     PG_REGISTER(barometerConfig_t, barometerConfig, PG_BAROMETER_CONFIG, 0);
@@ -193,6 +198,76 @@ TEST(FlightImuTest, TestSmallAngle)
     EXPECT_EQ(0, STATE(SMALL_ANGLE));
 }
 
+TEST(FlightImuTest, TestIntegrateGyroDisabled)
+{
+    // given
+    imuConfigMutable()->gyro_rate_integration = 0;
+    imuConfigure(800);
+    enabledSensors = SENSOR_ACC;
+    acc.isAccelUpdatedAtLeastOnce = true;
+    q.w = 1; q.x = 0; q.y = 0; q.z = 0;
+    imuComputeRotationMatrix();
+
+    // when
+    const float gyroRate[XYZ_AXIS_COUNT] = { 90, 0, 0 };
+    imuIntegrateGyro(gyroRate, 0.001f);
+
+    // expect, the gyro is integrated in the attitude task
+    EXPECT_FLOAT_EQ(1.0f, q.w);
+    EXPECT_FLOAT_EQ(1.0f, rMat[2][2]);
+}
+
+TEST(FlightImuTest, TestIntegrateGyro)
+{
+    // given
+    imuConfigMutable()->gyro_rate_integration = 1;
+    imuConfigure(800);
+    enabledSensors = SENSOR_ACC;
+    acc.isAccelUpdatedAtLeastOnce = true;
+    memset(correctionRate, 0, sizeof(correctionRate));
+    q.w = 1; q.x = 0; q.y = 0; q.z = 0;
+    imuComputeRotationMatrix();
+
+    // when, rolling right at 90 deg/s for one second at 1kHz
+    const float gyroRate[XYZ_AXIS_COUNT] = { 90, 0, 0 };
+    for (int i = 0; i < 1000; i++) {
+        imuIntegrateGyro(gyroRate, 0.001f);
+    }
+
+    // expect
+    EXPECT_NEAR(sqrt2over2, q.w, 1e-3f);
+    EXPECT_NEAR(sqrt2over2, q.x, 1e-3f);
+    EXPECT_NEAR(1.0f, sq(q.w) + sq(q.x) + sq(q.y) + sq(q.z), 1e-5f);
+    EXPECT_NEAR(0.0f, rMat[2][2], 2e-3f);
+    EXPECT_NEAR(1.0f, rMat[2][1], 1e-5f);
+
+    // and the consumers see the same matrix
+    float rotation[3][3];
+    imuGetRotationMatrix(rotation);
+    EXPECT_EQ(0, memcmp(rotation, rMat, sizeof(rotation)));
+
+    // when, the acc/mag feedback of the attitude task levels it back without any gyro rate
+    const float noRate[XYZ_AXIS_COUNT] = { 0, 0, 0 };
+    correctionRate[X] = -M_PIf / 2;
+    for (int i = 0; i < 1000; i++) {
+        imuIntegrateGyro(noRate, 0.001f);
+    }
+
+    // expect
+    EXPECT_NEAR(1.0f, q.w, 1e-3f);
+    EXPECT_NEAR(1.0f, rMat[2][2], 1e-3f);
+
+    // when, no accelerometer
+    enabledSensors = 0;
+    imuIntegrateGyro(gyroRate, 0.1f);
+
+    // expect, nothing to correct the attitude with so it is not estimated
+    EXPECT_NEAR(1.0f, q.w, 1e-3f);
+
+    imuConfigMutable()->gyro_rate_integration = 0;
+    imuConfigure(800);
+}
+
 // STUBS
 
 extern "C" {
@@ -227,8 +302,7 @@ uint16_t disableFlightMode(flightModeFlags_e mask)
 
 bool sensors(uint32_t mask)
 {
-    UNUSED(mask);
-    return false;
+    return enabledSensors & mask;
 };
 
 uint32_t millis(void) { return 0; }
@@ -240,4 +314,8 @@ void performBaroCalibrationCycle(void) {}
 int32_t baroCalculateAltitude(void) { return 0; }
 bool gyroGetAccumulationAverage(float *) { return false; }
 bool accGetAccumulationAverage(float *) { return false; }
+bool rangefinderProcess(float) { return false; }
+int32_t rangefinderGetLatestAltitude(void) { return RANGEFINDER_OUT_OF_RANGE; }
+struct dronerace_state_struct dr_state;
+bool ol_filter_correct_altitude(float) { return false; }
 }
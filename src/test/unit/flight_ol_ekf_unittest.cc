@@ -0,0 +1,148 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stdint.h>
+#include <math.h>
+
+extern "C" {
+    #include "flight/ol_ekf.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define STEP_DT 0.002f  // 500 Hz outer loop
+
+static void expectSymmetric(void)
+{
+    for (int i = 0; i < OL_EKF_NX; i++) {
+        for (int j = 0; j < i; j++) {
+            EXPECT_FLOAT_EQ(dr_ekf.P[i][j], dr_ekf.P[j][i]);
+        }
+    }
+}
+
+TEST(OlEkfTest, PredictIntegratesAcceleration)
+{
+    ol_ekf_reset(0, 0, 0);
+    const float acc[3] = { 1.0f, -2.0f, 0.5f };
+
+    for (int i = 0; i < 500; i++) {
+        ol_ekf_predict(acc, STEP_DT);
+    }
+
+    // 1 s at constant acceleration is exact with the midpoint position step
+    EXPECT_NEAR(0.5f, dr_ekf.x[OL_EKF_X], 1e-4f);
+    EXPECT_NEAR(-1.0f, dr_ekf.x[OL_EKF_Y], 1e-4f);
+    EXPECT_NEAR(0.25f, dr_ekf.x[OL_EKF_Z], 1e-4f);
+    EXPECT_NEAR(1.0f, dr_ekf.x[OL_EKF_VX], 1e-4f);
+    EXPECT_NEAR(-2.0f, dr_ekf.x[OL_EKF_VY], 1e-4f);
+    EXPECT_NEAR(0.5f, dr_ekf.x[OL_EKF_VZ], 1e-4f);
+
+    // Uncertainty grows and flows from velocity into position
+    EXPECT_GT(dr_ekf.P[OL_EKF_X][OL_EKF_X], 0);
+    EXPECT_GT(dr_ekf.P[OL_EKF_X][OL_EKF_VX], 0);
+    EXPECT_LT(dr_ekf.P[OL_EKF_X][OL_EKF_X], dr_ekf.P[OL_EKF_VX][OL_EKF_VX]);
+    expectSymmetric();
+}
+
+TEST(OlEkfTest, UpdateMovesStateAndShrinksCovariance)
+{
+    ol_ekf_reset(1.0f, 1.0f, 0.1f);
+
+    EXPECT_TRUE(ol_ekf_update(OL_EKF_X, 2.0f, 1.0f, 0));
+
+    // Equal prior and measurement variance, half way
+    EXPECT_FLOAT_EQ(1.0f, dr_ekf.x[OL_EKF_X]);
+    EXPECT_FLOAT_EQ(0.5f, dr_ekf.P[OL_EKF_X][OL_EKF_X]);
+    EXPECT_FLOAT_EQ(0, dr_ekf.x[OL_EKF_Y]);
+    EXPECT_EQ(1u, dr_ekf.updates);
+    expectSymmetric();
+}
+
+TEST(OlEkfTest, GateRejectsOutliers)
+{
+    ol_ekf_reset(0.01f, 0.01f, 0.1f);
+
+    // 5 m off with 0.2 m standard deviations
+    EXPECT_FALSE(ol_ekf_update(OL_EKF_X, 5.0f, 0.04f, 4.0f));
+    EXPECT_FLOAT_EQ(0, dr_ekf.x[OL_EKF_X]);
+    EXPECT_FLOAT_EQ(0.01f, dr_ekf.P[OL_EKF_X][OL_EKF_X]);
+    EXPECT_EQ(1u, dr_ekf.rejected);
+
+    EXPECT_TRUE(ol_ekf_update(OL_EKF_X, 0.3f, 0.04f, 4.0f));
+    EXPECT_EQ(1u, dr_ekf.updates);
+}
+
+TEST(OlEkfTest, GateChecksWithoutUpdating)
+{
+    ol_ekf_reset(0.01f, 0.01f, 0.1f);
+
+    EXPECT_FALSE(ol_ekf_gate(OL_EKF_Y, 5.0f, 0.04f, 4.0f));
+    EXPECT_TRUE(ol_ekf_gate(OL_EKF_X, 0.3f, 0.04f, 4.0f));
+    EXPECT_TRUE(ol_ekf_gate(OL_EKF_Y, 5.0f, 0.04f, 0));
+
+    // nothing applied or counted
+    EXPECT_FLOAT_EQ(0, dr_ekf.x[OL_EKF_X]);
+    EXPECT_FLOAT_EQ(0.01f, dr_ekf.P[OL_EKF_X][OL_EKF_X]);
+    EXPECT_EQ(0u, dr_ekf.updates);
+    EXPECT_EQ(0u, dr_ekf.rejected);
+}
+
+TEST(OlEkfTest, AltitudeUpdatesEstimateAccelerometerBias)
+{
+    ol_ekf_reset(0.01f, 0.01f, 0.25f);
+
+    // Hovering at 1.5 m with an accelerometer that reads 0.3 m/s^2 too high
+    const float acc[3] = { 0, 0, 0.3f };
+    dr_ekf.x[OL_EKF_Z] = 1.5f;
+    for (int i = 0; i < 10 * 500; i++) {
+        ol_ekf_predict(acc, STEP_DT);
+        if (i % 12 == 0) {
+            ol_ekf_update(OL_EKF_Z, 1.5f - dr_ekf.x[OL_EKF_Z], 0.0025f, 0);
+        }
+    }
+
+    EXPECT_NEAR(0.3f, dr_ekf.x[OL_EKF_BZ], 0.02f);
+    EXPECT_NEAR(0, dr_ekf.x[OL_EKF_VZ], 0.05f);
+    EXPECT_NEAR(1.5f, dr_ekf.x[OL_EKF_Z], 0.01f);
+
+    // Horizontal axes are untouched by vertical measurements
+    EXPECT_FLOAT_EQ(0, dr_ekf.P[OL_EKF_X][OL_EKF_Z]);
+    expectSymmetric();
+}
+
+TEST(OlEkfTest, ResetAxisKeepsOtherStates)
+{
+    ol_ekf_reset(0.01f, 0.01f, 0.25f);
+    const float acc[3] = { 1.0f, 1.0f, 0.2f };
+    for (int i = 0; i < 100; i++) {
+        ol_ekf_predict(acc, STEP_DT);
+    }
+    const float z = dr_ekf.x[OL_EKF_Z];
+    const float pz = dr_ekf.P[OL_EKF_Z][OL_EKF_Z];
+
+    ol_ekf_reset_axis(OL_EKF_X, 0.001f, 0.002f);
+
+    EXPECT_FLOAT_EQ(0, dr_ekf.x[OL_EKF_X]);
+    EXPECT_FLOAT_EQ(0, dr_ekf.x[OL_EKF_VX]);
+    EXPECT_FLOAT_EQ(0.001f, dr_ekf.P[OL_EKF_X][OL_EKF_X]);
+    EXPECT_FLOAT_EQ(0.002f, dr_ekf.P[OL_EKF_VX][OL_EKF_VX]);
+    EXPECT_FLOAT_EQ(0, dr_ekf.P[OL_EKF_X][OL_EKF_VX]);
+    EXPECT_GT(dr_ekf.x[OL_EKF_Y], 0);
+    EXPECT_FLOAT_EQ(z, dr_ekf.x[OL_EKF_Z]);
+    EXPECT_FLOAT_EQ(pz, dr_ekf.P[OL_EKF_Z][OL_EKF_Z]);
+}
@@ -0,0 +1,199 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stdint.h>
+
+extern "C" {
+    #include "flight/ol_filter.h"
+    #include "flight/ol_ransac.h"
+
+    struct dronerace_state_struct dr_state;
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define DETECTION_PERIOD 0.04f
+
+// drift of the prediction against the measurements: bias + rate * (t - t_newest)
+static void pushDetections(int count, float biasX, float rateX, float biasY, float rateY, int outlierEvery)
+{
+    for (int i = 0; i < count; i++) {
+        dr_state.time += DETECTION_PERIOD;
+        const float dt = -(count - 1 - i) * DETECTION_PERIOD;
+        float driftX = biasX + rateX * dt;
+        float driftY = biasY + rateY * dt;
+        if (outlierEvery && (i % outlierEvery) == 0) {
+            // misdetected gate, meters away from the truth
+            driftX += (i & 1) ? 3.0f : -4.0f;
+            driftY += (i & 2) ? -5.0f : 2.5f;
+        }
+        ransac_push(dr_state.time, 10.0f + driftX, -2.0f + driftY, 10.0f, -2.0f, (timeUs_t)(dr_state.time * 1e6f));
+    }
+}
+
+static int runToCompletion(void)
+{
+    int calls = 0;
+    while (calls < 1000) {
+        calls++;
+        if (ransac_step()) {
+            break;
+        }
+    }
+    return calls;
+}
+
+TEST(OlRansacTest, NoFitWithTooFewDetections)
+{
+    // given
+    dr_state.time = 1.0f;
+    ransac_reset();
+
+    // when
+    pushDetections(4, 0.5f, 0.0f, 0.5f, 0.0f, 0);
+
+    // then
+    for (int i = 0; i < 20; i++) {
+        EXPECT_FALSE(ransac_step());
+    }
+    EXPECT_EQ(0, dr_ransac.fit_cnt);
+}
+
+TEST(OlRansacTest, FitIsSplitIntoBoundedSteps)
+{
+    // given
+    dr_state.time = 1.0f;
+    ransac_reset();
+    pushDetections(RANSAC_BUF_SIZE, 0.3f, 0.2f, -0.4f, 0.1f, 0);
+
+    // when
+    const int calls = runToCompletion();
+
+    // then
+    EXPECT_EQ((RANSAC_ITERATIONS + RANSAC_ITERATIONS_PER_STEP - 1) / RANSAC_ITERATIONS_PER_STEP, calls);
+    EXPECT_EQ(1, dr_ransac.fit_cnt);
+    EXPECT_FALSE(ransac_step());
+}
+
+TEST(OlRansacTest, RejectsOutliers)
+{
+    // given
+    dr_state.time = 1.0f;
+    ransac_reset();
+    pushDetections(RANSAC_BUF_SIZE, 0.6f, 0.8f, -0.3f, -0.5f, 4);
+
+    // when
+    runToCompletion();
+
+    // then
+    EXPECT_NEAR(0.6f, dr_ransac.corr_x, 0.01f);
+    EXPECT_NEAR(0.8f, dr_ransac.rate_x, 0.01f);
+    EXPECT_NEAR(-0.3f, dr_ransac.corr_y, 0.01f);
+    EXPECT_NEAR(-0.5f, dr_ransac.rate_y, 0.01f);
+}
+
+TEST(OlRansacTest, Deterministic)
+{
+    // given
+    dr_state.time = 1.0f;
+    ransac_reset();
+    pushDetections(RANSAC_BUF_SIZE, 0.6f, 0.8f, -0.3f, -0.5f, 3);
+    runToCompletion();
+    const float corrX = dr_ransac.corr_x;
+    const float rateY = dr_ransac.rate_y;
+
+    // when
+    dr_state.time = 1.0f;
+    ransac_reset();
+    pushDetections(RANSAC_BUF_SIZE, 0.6f, 0.8f, -0.3f, -0.5f, 3);
+    runToCompletion();
+
+    // then
+    EXPECT_EQ(corrX, dr_ransac.corr_x);
+    EXPECT_EQ(rateY, dr_ransac.rate_y);
+}
+
+TEST(OlRansacTest, ShiftLeavesOnlyResidualDrift)
+{
+    // given
+    dr_state.time = 1.0f;
+    ransac_reset();
+    pushDetections(RANSAC_BUF_SIZE, 0.6f, 0.8f, -0.3f, -0.5f, 5);
+    runToCompletion();
+
+    // when
+    ransac_shift(dr_ransac.corr_x, dr_ransac.corr_y, dr_ransac.rate_x, dr_ransac.rate_y, dr_ransac.fit_time);
+    ransac_push(dr_state.time, 10.0f, -2.0f, 10.0f, -2.0f, (timeUs_t)(dr_state.time * 1e6f));
+    runToCompletion();
+
+    // then
+    EXPECT_EQ(2, dr_ransac.fit_cnt);
+    EXPECT_NEAR(0.0f, dr_ransac.corr_x, 0.01f);
+    EXPECT_NEAR(0.0f, dr_ransac.rate_x, 0.01f);
+    EXPECT_NEAR(0.0f, dr_ransac.corr_y, 0.01f);
+    EXPECT_NEAR(0.0f, dr_ransac.rate_y, 0.01f);
+}
+
+TEST(OlRansacTest, ShiftDuringFit)
+{
+    // given
+    dr_state.time = 1.0f;
+    ransac_reset();
+    pushDetections(RANSAC_BUF_SIZE, 0.6f, 0.8f, -0.3f, -0.5f, 5);
+    EXPECT_FALSE(ransac_step());
+
+    // when
+    ransac_shift(0.5f, -0.2f, 0.0f, 0.0f, 0.0f);
+    runToCompletion();
+
+    // then
+    EXPECT_EQ(1, dr_ransac.fit_cnt);
+    EXPECT_NEAR(0.1f, dr_ransac.corr_x, 0.01f);
+    EXPECT_NEAR(0.8f, dr_ransac.rate_x, 0.01f);
+    EXPECT_NEAR(-0.1f, dr_ransac.corr_y, 0.01f);
+    EXPECT_NEAR(-0.5f, dr_ransac.rate_y, 0.01f);
+
+    // and the result moves with later shifts
+    ransac_shift(0.1f, -0.1f, 0.8f, -0.5f, dr_ransac.fit_time);
+    EXPECT_NEAR(0.0f, dr_ransac.corr_x, 0.01f);
+    EXPECT_NEAR(0.0f, dr_ransac.rate_x, 0.01f);
+    EXPECT_NEAR(0.0f, dr_ransac.corr_y, 0.01f);
+    EXPECT_NEAR(0.0f, dr_ransac.rate_y, 0.01f);
+}
+
+TEST(OlRansacTest, DriftOfRecentFitOnly)
+{
+    // given
+    dr_state.time = 1.0f;
+    ransac_reset();
+    pushDetections(RANSAC_BUF_SIZE, 0.6f, 0.8f, -0.3f, -0.5f, 0);
+    float driftX, driftY;
+    EXPECT_FALSE(ransac_drift(dr_state.time, &driftX, &driftY));
+
+    // when
+    runToCompletion();
+
+    // then
+    EXPECT_TRUE(ransac_drift(dr_state.time - 0.5f, &driftX, &driftY));
+    EXPECT_NEAR(0.6f - 0.8f * 0.5f, driftX, 0.01f);
+    EXPECT_NEAR(-0.3f + 0.5f * 0.5f, driftY, 0.01f);
+
+    // no detections within dt_max
+    dr_state.time += dr_ransac.dt_max + 0.1f;
+    ransac_update_buffer_size();
+    EXPECT_FALSE(ransac_drift(dr_state.time, &driftX, &driftY));
+}
@@ -0,0 +1,117 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stdint.h>
+#include <math.h>
+
+extern "C" {
+    #include "flight/ol_trajectory.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define SAMPLE_DT 0.005f
+
+// the default flightplan, a 4 x 2 m rectangle
+static const float gateX[] = { 4.0f, 4.0f, 0.0f, 0.0f };
+static const float gateY[] = { 0.0f, -2.0f, -2.0f, 0.0f };
+
+static void buildPlan(float speed)
+{
+    const float speeds[] = { speed, speed, speed, speed };
+    ol_trajectory_build(gateX, gateY, speeds, 4);
+}
+
+TEST(OlTrajectoryTest, StartsAtRest)
+{
+    buildPlan(2.5f);
+
+    EXPECT_FLOAT_EQ(0, dr_traj.time);
+    EXPECT_FLOAT_EQ(0, dr_traj.x);
+    EXPECT_FLOAT_EQ(0, dr_traj.y);
+    EXPECT_FLOAT_EQ(0, dr_traj.vx);
+    EXPECT_FLOAT_EQ(0, dr_traj.vy);
+}
+
+TEST(OlTrajectoryTest, PassesThroughAllGates)
+{
+    buildPlan(2.5f);
+
+    const float duration = ol_trajectory_duration();
+    float closest[4] = { 1e6f, 1e6f, 1e6f, 1e6f };
+    for (float t = 0; t < duration + 1.0f; t += SAMPLE_DT) {
+        ol_trajectory_sample(t);
+        for (int i = 0; i < 4; i++) {
+            const float d = hypotf(dr_traj.x - gateX[i], dr_traj.y - gateY[i]);
+            closest[i] = fminf(closest[i], d);
+        }
+    }
+    for (int i = 0; i < 4; i++) {
+        EXPECT_LT(closest[i], 0.05f);
+    }
+
+    // ends at rest in the last gate
+    EXPECT_NEAR(0, dr_traj.x, 1e-4f);
+    EXPECT_NEAR(0, dr_traj.y, 1e-4f);
+    EXPECT_NEAR(0, dr_traj.vx, 1e-4f);
+    EXPECT_NEAR(0, dr_traj.vy, 1e-4f);
+}
+
+TEST(OlTrajectoryTest, RespectsSpeedAndAccelerationLimits)
+{
+    for (float speed = 1.0f; speed <= 10.0f; speed += 3.0f) {
+        buildPlan(speed);
+
+        const float duration = ol_trajectory_duration();
+        for (float t = 0; t < duration; t += SAMPLE_DT) {
+            ol_trajectory_sample(t);
+            EXPECT_LT(hypotf(dr_traj.vx, dr_traj.vy), speed * 1.2f);
+            EXPECT_LT(hypotf(dr_traj.ax, dr_traj.ay), OL_TRAJECTORY_MAX_ACC * 1.5f);
+        }
+    }
+}
+
+TEST(OlTrajectoryTest, SetpointsAreContinuous)
+{
+    buildPlan(5.0f);
+
+    ol_trajectory_sample(0);
+    float x = dr_traj.x, y = dr_traj.y, vx = dr_traj.vx, vy = dr_traj.vy;
+    const float duration = ol_trajectory_duration();
+    for (float t = SAMPLE_DT; t < duration; t += SAMPLE_DT) {
+        ol_trajectory_sample(t);
+        // position integrates the velocity, velocity the acceleration
+        EXPECT_NEAR(x + 0.5f * (vx + dr_traj.vx) * SAMPLE_DT, dr_traj.x, 1e-3f);
+        EXPECT_NEAR(y + 0.5f * (vy + dr_traj.vy) * SAMPLE_DT, dr_traj.y, 1e-3f);
+        EXPECT_LT(fabsf(dr_traj.vx - vx), OL_TRAJECTORY_MAX_ACC * 1.5f * SAMPLE_DT);
+        EXPECT_LT(fabsf(dr_traj.vy - vy), OL_TRAJECTORY_MAX_ACC * 1.5f * SAMPLE_DT);
+        x = dr_traj.x;
+        y = dr_traj.y;
+        vx = dr_traj.vx;
+        vy = dr_traj.vy;
+    }
+}
+
+TEST(OlTrajectoryTest, EmptyPlanHoldsOrigin)
+{
+    ol_trajectory_build(gateX, gateY, NULL, 0);
+    ol_trajectory_sample(3.0f);
+
+    EXPECT_FLOAT_EQ(0, ol_trajectory_duration());
+    EXPECT_FLOAT_EQ(0, dr_traj.x);
+    EXPECT_FLOAT_EQ(0, dr_traj.vy);
+}
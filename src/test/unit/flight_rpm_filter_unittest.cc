@@ -0,0 +1,204 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include <math.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "build/debug.h"
+
+    #include "common/filter.h"
+    #include "common/maths.h"
+
+    #include "config/feature.h"
+
+    #include "flight/rpm_filter.h"
+
+    #include "pg/pg.h"
+    #include "pg/pg_ids.h"
+
+    #include "sensors/esc_sensor.h"
+
+    static escSensorData_t escSensorData[4];
+    static uint8_t motorCount = 4;
+    static bool escSensorFeature = true;
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define LOOPTIME_US 125
+
+static rpmNotchFilter_t filter;
+
+static void resetRpmFilterTest(void)
+{
+    pgResetAll();
+    motorCount = 4;
+    escSensorFeature = true;
+    for (int i = 0; i < 4; i++) {
+        escSensorData[i].dataAge = 0;
+        escSensorData[i].rpm = 0;
+    }
+}
+
+// telemetry rpm field for a motor frequency in Hz, 14 poles
+static int16_t telemetryRpm(float motorHz)
+{
+    return lrintf(motorHz * 60 * 7 / 100);
+}
+
+static void runRpmFilterUpdates(int cycles)
+{
+    for (int i = 0; i < cycles; i++) {
+        rpmFilterUpdate(&filter);
+    }
+}
+
+TEST(RpmFilterUnittest, TestDisabled)
+{
+    resetRpmFilterTest();
+    escSensorFeature = false;
+    EXPECT_FALSE(rpmFilterInit(&filter, LOOPTIME_US));
+
+    resetRpmFilterTest();
+    rpmFilterConfigMutable()->gyro_rpm_notch_harmonics = 0;
+    EXPECT_FALSE(rpmFilterInit(&filter, LOOPTIME_US));
+
+    // nothing to do and nothing filtered
+    float data[FILTER_BANK_LANES] = { 1.0f, 2.0f, 3.0f, 0.0f };
+    rpmFilterUpdate(&filter);
+    rpmFilterApply(&filter, data);
+    EXPECT_FLOAT_EQ(1.0f, data[0]);
+    EXPECT_FLOAT_EQ(3.0f, data[2]);
+}
+
+TEST(RpmFilterUnittest, TestMotorFrequencyFromTelemetry)
+{
+    resetRpmFilterTest();
+    ASSERT_TRUE(rpmFilterInit(&filter, LOOPTIME_US));
+    EXPECT_EQ(12, filter.notchCount);
+
+    // idle and stopped motors keep their notches at the minimum
+    runRpmFilterUpdates(4);
+    EXPECT_FLOAT_EQ(100.0f, rpmFilterMotorFrequency(&filter, 0));
+
+    escSensorData[0].rpm = telemetryRpm(200);
+    escSensorData[1].rpm = telemetryRpm(250);
+    escSensorData[2].dataAge = ESC_DATA_INVALID;
+    escSensorData[2].rpm = telemetryRpm(300);
+    escSensorData[3].rpm = telemetryRpm(320);
+    // the telemetry is smoothed, give it 100ms
+    runRpmFilterUpdates(800);
+    EXPECT_NEAR(200.0f, rpmFilterMotorFrequency(&filter, 0), 0.5f);
+    EXPECT_NEAR(250.0f, rpmFilterMotorFrequency(&filter, 1), 0.5f);
+    EXPECT_FLOAT_EQ(100.0f, rpmFilterMotorFrequency(&filter, 2));
+    EXPECT_NEAR(320.0f, rpmFilterMotorFrequency(&filter, 3), 0.5f);
+    EXPECT_FLOAT_EQ(0.0f, rpmFilterMotorFrequency(&filter, 4));
+}
+
+TEST(RpmFilterUnittest, TestHarmonicCoefficients)
+{
+    resetRpmFilterTest();
+    ASSERT_TRUE(rpmFilterInit(&filter, LOOPTIME_US));
+
+    for (int i = 0; i < 4; i++) {
+        escSensorData[i].rpm = telemetryRpm(230);
+    }
+    runRpmFilterUpdates(800);
+
+    // the recurrence gives the coefficients biquadFilterInit computes for each harmonic
+    const float motorHz = rpmFilterMotorFrequency(&filter, 1);
+    for (int harmonic = 1; harmonic <= 3; harmonic++) {
+        biquadFilter_t expected;
+        biquadFilterInit(&expected, motorHz * harmonic, LOOPTIME_US, 5.0f, FILTER_NOTCH);
+        const biquadFilterBank_t *notch = &filter.notch[1 * 3 + harmonic - 1];
+        for (int lane = 0; lane < 3; lane++) {
+            EXPECT_NEAR(expected.b0, notch->b0[lane], 1e-4f);
+            EXPECT_NEAR(expected.b1, notch->b1[lane], 1e-4f);
+            EXPECT_NEAR(expected.b2, notch->b2[lane], 1e-4f);
+            EXPECT_NEAR(expected.a1, notch->a1[lane], 1e-4f);
+            EXPECT_NEAR(expected.a2, notch->a2[lane], 1e-4f);
+        }
+    }
+
+    // harmonics close to nyquist are not filtered
+    for (int i = 0; i < 4; i++) {
+        escSensorData[i].rpm = telemetryRpm(1600);
+    }
+    runRpmFilterUpdates(800);
+    const biquadFilterBank_t *thirdHarmonic = &filter.notch[2];
+    EXPECT_FLOAT_EQ(1.0f, thirdHarmonic->b0[0]);
+    EXPECT_FLOAT_EQ(0.0f, thirdHarmonic->a1[0]);
+    EXPECT_NE(0.0f, filter.notch[0].a1[0]);
+}
+
+TEST(RpmFilterUnittest, TestMotorNoiseRemoved)
+{
+    resetRpmFilterTest();
+    ASSERT_TRUE(rpmFilterInit(&filter, LOOPTIME_US));
+
+    const float motorHz[4] = { 180, 195, 210, 225 };
+    for (int i = 0; i < 4; i++) {
+        escSensorData[i].rpm = telemetryRpm(motorHz[i]);
+    }
+    runRpmFilterUpdates(800);
+
+    // the rotation frequency and its second harmonic of every motor, and a slow manoeuvre on top
+    float peak[3] = { 0, 0, 0 };
+    for (int i = 0; i < 16000; i++) {
+        const float t = i * LOOPTIME_US * 0.000001f;
+        float noise = 0;
+        for (int motor = 0; motor < 4; motor++) {
+            noise += 10 * sinf(2 * M_PIf * motorHz[motor] * t) + 5 * sinf(2 * M_PIf * 2 * motorHz[motor] * t + motor);
+        }
+        const float manoeuvre = 100 * sinf(2 * M_PIf * 5 * t);
+        float data[FILTER_BANK_LANES] = { manoeuvre + noise, noise, -noise, 0.0f };
+        rpmFilterUpdate(&filter);
+        rpmFilterApply(&filter, data);
+        if (i > 8000) {
+            peak[0] = fmaxf(peak[0], fabsf(data[0] - manoeuvre));
+            peak[1] = fmaxf(peak[1], fabsf(data[1]));
+            peak[2] = fmaxf(peak[2], fabsf(data[2]));
+        }
+        // the padding lane stays at zero
+        EXPECT_EQ(0.0f, data[3]);
+    }
+    // 60 peak to peak before the filter, the manoeuvre goes through with a small phase shift
+    EXPECT_LT(peak[0], 5.0f);
+    EXPECT_LT(peak[1], 1.0f);
+    EXPECT_LT(peak[2], 1.0f);
+}
+
+// STUBS
+
+extern "C" {
+
+uint8_t getMotorCount(void) { return motorCount; }
+bool feature(uint32_t mask) { return (mask == FEATURE_ESC_SENSOR) && escSensorFeature; }
+escSensorData_t *getEscSensorData(uint8_t motorNumber)
+{
+    return motorNumber < motorCount ? &escSensorData[motorNumber] : NULL;
+}
+int16_t debug[DEBUG16_VALUE_COUNT];
+uint8_t debugMode;
+
+}
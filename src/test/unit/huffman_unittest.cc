@@ -19,6 +19,7 @@
 
 extern "C" {
     #include "common/huffman.h"
+    #include "common/maths.h"
 }
 
 #include "unittest_macros.h"
@@ -503,6 +504,76 @@ TEST(HuffmanUnittest, TestHuffmanEncodeStreaming)
     EXPECT_EQ(0xd8, (int)outBuf[4]);
 }
 
+TEST(HuffmanUnittest, TestHuffmanEncodeStreamingMatchesEncodeBuf)
+{
+    // all the byte values, in chunks of every length from 1 to 7
+    uint8_t inBuf[256];
+    for (int i = 0; i < 256; i++) {
+        inBuf[i] = i * 7;
+    }
+    const int inLen = 40;
+
+    uint8_t expected[OUTBUF_LEN];
+    const int expectedLen = huffmanEncodeBuf(expected, OUTBUF_LEN, inBuf, inLen, huffmanTable);
+    ASSERT_GT(expectedLen, 0);
+
+    for (int chunk = 1; chunk < 8; chunk++) {
+        huffmanState_t state = {
+            .bytesWritten = 0,
+            .outByte = outBuf,
+            .outBufLen = OUTBUF_LEN,
+            .outBit = 0x80,
+        };
+        *state.outByte = 0;
+        for (int pos = 0; pos < inLen; pos += chunk) {
+            const int status = huffmanEncodeBufStreaming(&state, inBuf + pos, MIN(chunk, inLen - pos), huffmanTable);
+            EXPECT_EQ(0, status);
+        }
+        if (state.outBit != 0x80) {
+            ++state.bytesWritten;
+        }
+
+        EXPECT_EQ(expectedLen, state.bytesWritten);
+        for (int i = 0; i < expectedLen; i++) {
+            EXPECT_EQ(expected[i], outBuf[i]);
+        }
+    }
+}
+
+TEST(HuffmanUnittest, TestHuffmanEncodeStreamingOverflow)
+{
+    const uint8_t inBuf[3] = {0,1,2};
+    // 11 101 1001 does not fit in one byte
+    huffmanState_t state = {
+        .bytesWritten = 0,
+        .outByte = outBuf,
+        .outBufLen = 1,
+        .outBit = 0x80,
+    };
+    *state.outByte = 0;
+    int status = huffmanEncodeBufStreaming(&state, inBuf, 2, huffmanTable);
+    EXPECT_EQ(0, status);
+    EXPECT_EQ(0, state.bytesWritten);
+    EXPECT_EQ(0x04, state.outBit);
+    EXPECT_EQ(0xe8, (int)outBuf[0]);
+
+    // the third code does not fit in the byte, the state is left as it was
+    status = huffmanEncodeBufStreaming(&state, inBuf + 2, 1, huffmanTable);
+    EXPECT_EQ(-1, status);
+    EXPECT_EQ(0, state.bytesWritten);
+    EXPECT_EQ(0x04, state.outBit);
+    EXPECT_EQ(outBuf, state.outByte);
+    EXPECT_EQ(0xe8, (int)outBuf[0]);
+
+    // exactly filling the buffer is not an overflow
+    // 11 101 101
+    status = huffmanEncodeBufStreaming(&state, inBuf + 1, 1, huffmanTable);
+    EXPECT_EQ(0, status);
+    EXPECT_EQ(1, state.bytesWritten);
+    EXPECT_EQ(0x80, state.outBit);
+    EXPECT_EQ(0xed, (int)outBuf[0]);
+}
+
 TEST(HuffmanUnittest, TestHuffmanDecode)
 {
     int len;
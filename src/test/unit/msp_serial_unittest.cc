@@ -0,0 +1,250 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "common/streambuf.h"
+    #include "common/utils.h"
+
+    #include "pg/pg.h"
+    #include "pg/pg_ids.h"
+
+    #include "drivers/serial.h"
+
+    #include "interface/msp.h"
+
+    #include "io/serial.h"
+
+    #include "msp/msp_serial.h"
+
+    PG_REGISTER(serialConfig_t, serialConfig, PG_SERIAL_CONFIG, 0);
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define TEST_STREAM_CMD 192
+#define TEST_STREAM_FRAMES 3
+
+static serialPort_t testPort;
+static serialPortConfig_t testPortConfig;
+static uint32_t testVcpBytesFree;
+
+static uint8_t rxData[32];
+static int rxLen;
+static int rxIndex;
+
+static uint8_t txData[2048];
+static int txLen;
+static uint32_t txBytesUsed; // Written and not transmitted yet
+
+static int streamFrameSize;
+static int streamFrameExtra; // Bytes over mspSerialStreamPayloadMax()
+static int streamFramesSent;
+
+static void resetTestPort(uint32_t txBufferSize)
+{
+    memset(&testPort, 0, sizeof(testPort));
+    testPortConfig.identifier = txBufferSize ? SERIAL_PORT_USART1 : SERIAL_PORT_USB_VCP;
+    testPort.identifier = testPortConfig.identifier;
+    testPort.txBufferSize = txBufferSize;
+    testVcpBytesFree = 255;
+    rxLen = 0;
+    rxIndex = 0;
+    txLen = 0;
+    txBytesUsed = 0;
+    streamFrameExtra = 0;
+    streamFramesSent = 0;
+
+    mspSerialInit();
+}
+
+static void receiveCommand(uint8_t cmd)
+{
+    rxLen = 0;
+    rxIndex = 0;
+    rxData[rxLen++] = '$';
+    rxData[rxLen++] = 'M';
+    rxData[rxLen++] = '<';
+    rxData[rxLen++] = 0;
+    rxData[rxLen++] = cmd;
+    rxData[rxLen++] = cmd; // checksum of the size and the command
+}
+
+static bool testStreamFn(mspPacket_t *packet)
+{
+    if (streamFramesSent >= TEST_STREAM_FRAMES || sbufBytesRemaining(&packet->buf) < streamFrameSize) {
+        return false;
+    }
+    packet->cmd = TEST_STREAM_CMD;
+    for (int i = 0; i < streamFrameSize; i++) {
+        sbufWriteU8(&packet->buf, i);
+    }
+    streamFramesSent++;
+    return true;
+}
+
+static void testBindStream(struct serialPort_s *port)
+{
+    mspSerialSetStream(port, testStreamFn);
+}
+
+// Sizes the frames the way the dataflash stream start does and replies with that size
+static mspResult_e testProcessCommand(struct serialPort_s *srcPort, mspPacket_t *cmd, mspPacket_t *reply, mspPostProcessFnPtr *mspPostProcessFn)
+{
+    EXPECT_EQ(&testPort, srcPort);
+    reply->cmd = cmd->cmd;
+    streamFrameSize = mspSerialStreamPayloadMax(srcPort) + streamFrameExtra;
+    sbufWriteU16(&reply->buf, streamFrameSize);
+    *mspPostProcessFn = testBindStream;
+    return MSP_RESULT_ACK;
+}
+
+static void testProcessReply(mspPacket_t *)
+{
+}
+
+TEST(MspSerialTest, StreamPayloadFitsTxBuffer)
+{
+    resetTestPort(256);
+
+    // The MSP header with the jumbo frame length and the checksum have to fit as well
+    EXPECT_EQ(256 - 1 - 8, (int)mspSerialStreamPayloadMax(&testPort));
+}
+
+TEST(MspSerialTest, StreamPayloadOnVcp)
+{
+    resetTestPort(0);
+
+    EXPECT_EQ(255 - 8, (int)mspSerialStreamPayloadMax(&testPort));
+}
+
+TEST(MspSerialTest, StreamOnSmallTxBuffer)
+{
+    resetTestPort(256);
+
+    receiveCommand(TEST_STREAM_CMD);
+    mspSerialProcess(MSP_SKIP_NON_MSP_DATA, testProcessCommand, testProcessReply);
+    EXPECT_EQ(256 - 1 - 8, streamFrameSize);
+
+    // The reply is transmitted before the stream is bound, which leaves room for the first frame
+    EXPECT_EQ(1, streamFramesSent);
+    const int replyLen = 5 + sizeof(uint16_t) + 1;
+
+    // A frame takes the whole buffer, the next one goes once it has been transmitted
+    mspSerialProcess(MSP_SKIP_NON_MSP_DATA, testProcessCommand, testProcessReply);
+    EXPECT_EQ(1, streamFramesSent);
+    for (int i = 1; i < TEST_STREAM_FRAMES; i++) {
+        txBytesUsed = 0;
+        mspSerialProcess(MSP_SKIP_NON_MSP_DATA, testProcessCommand, testProcessReply);
+        EXPECT_EQ(i + 1, streamFramesSent);
+    }
+
+    // Whole frames, back to back
+    const int frameLen = 5 + streamFrameSize + 1;
+    EXPECT_EQ(replyLen + TEST_STREAM_FRAMES * frameLen, txLen);
+    for (int i = 0; i < TEST_STREAM_FRAMES; i++) {
+        const uint8_t *frame = &txData[replyLen + i * frameLen];
+        EXPECT_EQ('$', frame[0]);
+        EXPECT_EQ('M', frame[1]);
+        EXPECT_EQ('>', frame[2]);
+        EXPECT_EQ(streamFrameSize, frame[3]);
+        EXPECT_EQ(TEST_STREAM_CMD, frame[4]);
+        EXPECT_EQ(streamFrameSize - 1, frame[5 + streamFrameSize - 1]);
+    }
+}
+
+TEST(MspSerialTest, StreamFrameOverPayloadMaxNeverSent)
+{
+    resetTestPort(256);
+    streamFrameExtra = 1;
+
+    receiveCommand(TEST_STREAM_CMD);
+    for (int i = 0; i < 10; i++) {
+        txBytesUsed = 0;
+        mspSerialProcess(MSP_SKIP_NON_MSP_DATA, testProcessCommand, testProcessReply);
+    }
+    EXPECT_EQ(0, streamFramesSent);
+}
+
+// STUBS
+
+extern "C" {
+    const uint32_t baudRates[] = {0, 9600, 19200, 38400, 57600, 115200, 230400, 250000,
+        400000, 460800, 500000, 921600, 1000000, 1500000, 2000000, 2470000};
+
+    serialPortConfig_t *findSerialPortConfig(serialPortFunction_e)
+    {
+        return &testPortConfig;
+    }
+
+    serialPortConfig_t *findNextSerialPortConfig(serialPortFunction_e)
+    {
+        return NULL;
+    }
+
+    serialPort_t *openSerialPort(serialPortIdentifier_e, serialPortFunction_e, serialReceiveCallbackPtr, void *, uint32_t, portMode_e, portOptions_e)
+    {
+        return &testPort;
+    }
+
+    void closeSerialPort(serialPort_t *) {}
+
+    void waitForSerialPortToFinishTransmitting(serialPort_t *)
+    {
+        txBytesUsed = 0;
+    }
+
+    uint32_t serialRxBytesWaiting(const serialPort_t *)
+    {
+        return rxLen - rxIndex;
+    }
+
+    uint8_t serialRead(serialPort_t *)
+    {
+        return rxData[rxIndex++];
+    }
+
+    uint32_t serialTxBytesFree(const serialPort_t *instance)
+    {
+        if (!instance->txBufferSize) {
+            return testVcpBytesFree;
+        }
+        return instance->txBufferSize - 1 - txBytesUsed;
+    }
+
+    void serialWriteBuf(serialPort_t *instance, const uint8_t *data, int count)
+    {
+        // Anything over the free space would overwrite bytes that haven't been transmitted
+        EXPECT_LE((uint32_t)count, serialTxBytesFree(instance));
+        memcpy(&txData[txLen], data, count);
+        txLen += count;
+        txBytesUsed += count;
+    }
+
+    void serialBeginWrite(serialPort_t *) {}
+    void serialEndWrite(serialPort_t *) {}
+
+    uint32_t millis(void) { return 0; }
+    void systemResetToBootloader(void) {}
+    void cliEnter(serialPort_t *) {}
+}
@@ -51,12 +51,14 @@ extern "C" {
     void taskUpdateAccelerometer(timeUs_t) { simulatedTime += TEST_UPDATE_ACCEL_TIME; }
     void taskHandleSerial(timeUs_t) { simulatedTime += TEST_HANDLE_SERIAL_TIME; }
     void taskUpdateBatteryVoltage(timeUs_t) { simulatedTime += TEST_UPDATE_BATTERY_TIME; }
-    bool rxUpdateCheck(timeUs_t, timeDelta_t) { simulatedTime += TEST_UPDATE_RX_CHECK_TIME; return false; }
+    int rxUpdateCheckCount = 0;
+    bool rxUpdateCheck(timeUs_t, timeDelta_t) { simulatedTime += TEST_UPDATE_RX_CHECK_TIME; rxUpdateCheckCount++; return false; }
     void taskUpdateRxMain(timeUs_t) { simulatedTime += TEST_UPDATE_RX_MAIN_TIME; }
     void imuUpdateAttitude(timeUs_t) { simulatedTime += TEST_IMU_UPDATE_TIME; }
     void dispatchProcess(timeUs_t) { simulatedTime += TEST_DISPATCH_TIME; }
 
     extern int taskQueueSize;
+    extern int taskHeapSize;
     extern cfTask_t* taskQueueArray[];
 
     extern void queueClear(void);
@@ -122,7 +124,7 @@ extern "C" {
 
 TEST(SchedulerUnittest, TestPriorites)
 {
-    EXPECT_EQ(20, TASK_COUNT);
+    EXPECT_EQ(22, TASK_COUNT);
 
     EXPECT_EQ(TASK_PRIORITY_MEDIUM_HIGH, cfTasks[TASK_SYSTEM].staticPriority);
     EXPECT_EQ(TASK_PRIORITY_REALTIME, cfTasks[TASK_GYROPID].staticPriority);
@@ -391,3 +393,135 @@ TEST(SchedulerUnittest, TestTwoTasks)
     scheduler();
     EXPECT_EQ(&cfTasks[TASK_ACCEL], unittest_scheduler_selectedTask);
 }
+
+TEST(SchedulerUnittest, TestTaskHistogram)
+{
+    schedulerInit();
+    for (int taskId = 0; taskId < TASK_COUNT; ++taskId) {
+        setTaskEnabled(static_cast<cfTaskId_e>(taskId), false);
+    }
+    setTaskEnabled(TASK_GYROPID, true);
+    schedulerResetTaskStatistics(TASK_GYROPID);
+
+    // TASK_GYROPID starts 2000us late, a whole desiredPeriod lost
+    cfTasks[TASK_GYROPID].lastExecutedAt = 1000;
+    simulatedTime = 4000;
+    scheduler();
+    cfTaskHistogram_t histogram;
+    getTaskHistogram(TASK_GYROPID, &histogram);
+    EXPECT_EQ(1, histogram.executionTime[10]); // 512us to 1023us
+    EXPECT_EQ(1, histogram.startLatency[11]); // 1024us to 2047us
+    cfDeadlineInfo_t deadlineInfo;
+    getGyroPidDeadlineInfo(&deadlineInfo);
+    EXPECT_EQ(1, deadlineInfo.late);
+    EXPECT_EQ(0, deadlineInfo.overrun);
+
+    // on time
+    simulatedTime = cfTasks[TASK_GYROPID].lastExecutedAt + cfTasks[TASK_GYROPID].desiredPeriod;
+    scheduler();
+    getTaskHistogram(TASK_GYROPID, &histogram);
+    EXPECT_EQ(2, histogram.executionTime[10]);
+    EXPECT_EQ(1, histogram.startLatency[0]);
+    getGyroPidDeadlineInfo(&deadlineInfo);
+    EXPECT_EQ(1, deadlineInfo.late);
+
+    schedulerResetTaskStatistics(TASK_GYROPID);
+    getTaskHistogram(TASK_GYROPID, &histogram);
+    getGyroPidDeadlineInfo(&deadlineInfo);
+    EXPECT_EQ(0, histogram.executionTime[10]);
+    EXPECT_EQ(0, deadlineInfo.late);
+}
+
+static void runScheduler(schedulerMode_e mode, cfTask_t **trace, int count)
+{
+    schedulerSetMode(mode);
+    schedulerInit();
+    simulatedTime = 100000;
+    for (int taskId = 0; taskId < TASK_COUNT; ++taskId) {
+        setTaskEnabled(static_cast<cfTaskId_e>(taskId), false);
+        cfTasks[taskId].lastExecutedAt = 0;
+        cfTasks[taskId].dynamicPriority = 0;
+    }
+    for (int taskId = 0; taskId < TASK_COUNT; ++taskId) {
+        if (taskId != TASK_RX) {
+            setTaskEnabled(static_cast<cfTaskId_e>(taskId), true);
+        }
+    }
+    for (int i = 0; i < count; ++i) {
+        scheduler();
+        trace[i] = unittest_scheduler_selectedTask;
+        simulatedTime += 10;
+    }
+}
+
+TEST(SchedulerUnittest, TestHeapModeMatchesQueueMode)
+{
+    static cfTask_t *queueTrace[5000];
+    static cfTask_t *heapTrace[5000];
+
+    runScheduler(SCHEDULER_MODE_QUEUE, queueTrace, 5000);
+    runScheduler(SCHEDULER_MODE_HEAP, heapTrace, 5000);
+
+    int executed = 0;
+    for (int i = 0; i < 5000; ++i) {
+        EXPECT_EQ(queueTrace[i], heapTrace[i]);
+        executed += (heapTrace[i] != NULL);
+    }
+    EXPECT_GT(executed, 300);
+    schedulerSetMode(SCHEDULER_MODE_QUEUE);
+}
+
+TEST(SchedulerUnittest, TestHeapModeTaskChanges)
+{
+    schedulerSetMode(SCHEDULER_MODE_HEAP);
+    schedulerInit();
+    for (int taskId = 0; taskId < TASK_COUNT; ++taskId) {
+        setTaskEnabled(static_cast<cfTaskId_e>(taskId), false);
+    }
+    EXPECT_EQ(0, taskHeapSize);
+    setTaskEnabled(TASK_ACCEL, true);
+    EXPECT_EQ(1, taskHeapSize);
+
+    simulatedTime = 1000000;
+    cfTasks[TASK_ACCEL].lastExecutedAt = simulatedTime;
+    rescheduleTask(TASK_ACCEL, 10000);
+    scheduler();
+    EXPECT_EQ(static_cast<cfTask_t*>(0), unittest_scheduler_selectedTask);
+
+    // a shorter period takes effect immediately
+    rescheduleTask(TASK_ACCEL, 2000);
+    simulatedTime = cfTasks[TASK_ACCEL].lastExecutedAt + 2000;
+    scheduler();
+    EXPECT_EQ(&cfTasks[TASK_ACCEL], unittest_scheduler_selectedTask);
+
+    // a disabled task is not run again
+    setTaskEnabled(TASK_ACCEL, false);
+    EXPECT_EQ(0, taskHeapSize);
+    simulatedTime += 100000;
+    scheduler();
+    EXPECT_EQ(static_cast<cfTask_t*>(0), unittest_scheduler_selectedTask);
+    schedulerSetMode(SCHEDULER_MODE_QUEUE);
+}
+
+TEST(SchedulerUnittest, TestHeapModeCheckPeriod)
+{
+    schedulerSetMode(SCHEDULER_MODE_HEAP);
+    schedulerInit();
+    for (int taskId = 0; taskId < TASK_COUNT; ++taskId) {
+        setTaskEnabled(static_cast<cfTaskId_e>(taskId), false);
+    }
+    cfTasks[TASK_RX].checkPeriod = 1000;
+    setTaskEnabled(TASK_RX, true);
+    rxUpdateCheckCount = 0;
+
+    // checkFunc is polled once per checkPeriod, not on every pass
+    const uint32_t startTime = simulatedTime;
+    while (simulatedTime - startTime < 10000) {
+        scheduler();
+        simulatedTime += 10;
+    }
+    EXPECT_GE(rxUpdateCheckCount, 9);
+    EXPECT_LE(rxUpdateCheckCount, 11);
+    cfTasks[TASK_RX].checkPeriod = 0;
+    schedulerSetMode(SCHEDULER_MODE_QUEUE);
+}
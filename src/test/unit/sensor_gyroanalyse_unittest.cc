@@ -0,0 +1,195 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <math.h>
+
+extern "C" {
+    #include <platform.h>
+
+    #include "arm_math.h"
+
+    #include "build/build_config.h"
+    #include "pg/pg.h"
+    #include "pg/pg_ids.h"
+    #include "sensors/gyro.h"
+    #include "sensors/gyroanalyse.h"
+
+    STATIC_UNIT_TESTED float fftPeakOffset(float left, float peak, float right, bool gaussian);
+    STATIC_UNIT_TESTED int fftFindPeaks(const float *magnitude, int startBin, int binCount, int maxCount, bool gaussian, float *peakPos);
+    STATIC_UNIT_TESTED void fftAssignPeaks(const uint16_t *centerFreq, int notchCount, const float *peakFreq, int peakCount, int *peakNotch);
+
+    PG_REGISTER(gyroConfig_t, gyroConfig, PG_GYRO_CONFIG, 0);
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define TEST_BIN_COUNT 64
+
+TEST(SensorGyroAnalyse, PeakOffsetParabola)
+{
+    // samples of -(x - 0.3)^2 around x = 0
+    EXPECT_FLOAT_EQ(0.3f, fftPeakOffset(-1.69f, -0.09f, -0.49f, false));
+    EXPECT_FLOAT_EQ(-0.3f, fftPeakOffset(-0.49f, -0.09f, -1.69f, false));
+    EXPECT_FLOAT_EQ(0.0f, fftPeakOffset(1.0f, 2.0f, 1.0f, false));
+}
+
+TEST(SensorGyroAnalyse, PeakOffsetGaussian)
+{
+    // samples of exp(-(x - 0.2)^2) are a parabola once logged
+    const float left = expf(-1.44f);
+    const float peak = expf(-0.04f);
+    const float right = expf(-0.64f);
+    EXPECT_NEAR(0.2f, fftPeakOffset(left, peak, right, true), 1e-5f);
+    EXPECT_GT(fabsf(0.2f - fftPeakOffset(left, peak, right, false)), 0.01f);
+
+    // no log of zero
+    EXPECT_FLOAT_EQ(fftPeakOffset(0.0f, 1.0f, 0.5f, false), fftPeakOffset(0.0f, 1.0f, 0.5f, true));
+}
+
+TEST(SensorGyroAnalyse, PeakOffsetNotAPeak)
+{
+    // flat or a valley
+    EXPECT_FLOAT_EQ(0.0f, fftPeakOffset(1.0f, 1.0f, 1.0f, false));
+    EXPECT_FLOAT_EQ(0.0f, fftPeakOffset(2.0f, 1.0f, 2.0f, false));
+
+    // never more than half a bin away
+    EXPECT_FLOAT_EQ(0.5f, fftPeakOffset(0.0f, 1.0f, 1.0f, false));
+    EXPECT_FLOAT_EQ(0.5f, fftPeakOffset(0.0f, 1.0f, 1.2f, false));
+    EXPECT_FLOAT_EQ(-0.5f, fftPeakOffset(1.2f, 1.0f, 0.0f, false));
+}
+
+static void addPeak(float *magnitude, int bin, float height)
+{
+    magnitude[bin - 1] += height / 2;
+    magnitude[bin] += height;
+    magnitude[bin + 1] += height / 2;
+}
+
+TEST(SensorGyroAnalyse, FindPeaksHighestByFrequency)
+{
+    float magnitude[TEST_BIN_COUNT] = { 0 };
+    addPeak(magnitude, 30, 5);
+    addPeak(magnitude, 20, 10);
+    addPeak(magnitude, 40, 3);
+    addPeak(magnitude, 4, 20); // below the start bin
+
+    float peakPos[DYN_NOTCH_COUNT_MAX];
+    EXPECT_EQ(2, fftFindPeaks(magnitude, 8, TEST_BIN_COUNT, 2, false, peakPos));
+    EXPECT_FLOAT_EQ(20, peakPos[0]);
+    EXPECT_FLOAT_EQ(30, peakPos[1]);
+
+    EXPECT_EQ(1, fftFindPeaks(magnitude, 8, TEST_BIN_COUNT, 1, false, peakPos));
+    EXPECT_FLOAT_EQ(20, peakPos[0]);
+
+    EXPECT_EQ(3, fftFindPeaks(magnitude, 8, TEST_BIN_COUNT, 3, false, peakPos));
+    EXPECT_FLOAT_EQ(20, peakPos[0]);
+    EXPECT_FLOAT_EQ(30, peakPos[1]);
+    EXPECT_FLOAT_EQ(40, peakPos[2]);
+}
+
+TEST(SensorGyroAnalyse, FindPeaksDropsNoise)
+{
+    float magnitude[TEST_BIN_COUNT] = { 0 };
+    addPeak(magnitude, 20, 10);
+    addPeak(magnitude, 40, 1);
+
+    float peakPos[DYN_NOTCH_COUNT_MAX];
+    EXPECT_EQ(1, fftFindPeaks(magnitude, 8, TEST_BIN_COUNT, 2, false, peakPos));
+    EXPECT_FLOAT_EQ(20, peakPos[0]);
+}
+
+TEST(SensorGyroAnalyse, FindPeaksInterpolated)
+{
+    float magnitude[TEST_BIN_COUNT] = { 0 };
+    magnitude[19] = 4;
+    magnitude[20] = 10;
+    magnitude[21] = 8;
+
+    float peakPos[DYN_NOTCH_COUNT_MAX];
+    EXPECT_EQ(1, fftFindPeaks(magnitude, 8, TEST_BIN_COUNT, 2, false, peakPos));
+    EXPECT_FLOAT_EQ(20 + fftPeakOffset(4, 10, 8, false), peakPos[0]);
+    EXPECT_GT(peakPos[0], 20);
+}
+
+TEST(SensorGyroAnalyse, FindPeaksNone)
+{
+    float magnitude[TEST_BIN_COUNT] = { 0 };
+
+    float peakPos[DYN_NOTCH_COUNT_MAX];
+    EXPECT_EQ(0, fftFindPeaks(magnitude, 8, TEST_BIN_COUNT, 2, false, peakPos));
+}
+
+TEST(SensorGyroAnalyse, AssignPeaksToNearestNotch)
+{
+    const uint16_t centerFreq[] = { 200, 300 };
+    int peakNotch[DYN_NOTCH_COUNT_MAX];
+
+    const float bothPeaks[] = { 210, 290 };
+    fftAssignPeaks(centerFreq, 2, bothPeaks, 2, peakNotch);
+    EXPECT_EQ(0, peakNotch[0]);
+    EXPECT_EQ(1, peakNotch[1]);
+
+    // the lower band lost its peak, the upper notch keeps following the upper one
+    const float upperPeak[] = { 290 };
+    fftAssignPeaks(centerFreq, 2, upperPeak, 1, peakNotch);
+    EXPECT_EQ(1, peakNotch[0]);
+
+    // two peaks closest to the same notch, the nearer one gets it
+    const float highPeaks[] = { 320, 400 };
+    fftAssignPeaks(centerFreq, 2, highPeaks, 2, peakNotch);
+    EXPECT_EQ(0, peakNotch[1]);
+    EXPECT_EQ(1, peakNotch[0]);
+}
+
+TEST(SensorGyroAnalyse, AssignPeaksMoreThanNotches)
+{
+    const uint16_t centerFreq[] = { 250 };
+    const float peakFreq[] = { 150, 240, 400 };
+    int peakNotch[DYN_NOTCH_COUNT_MAX];
+
+    fftAssignPeaks(centerFreq, 1, peakFreq, 3, peakNotch);
+    EXPECT_EQ(-1, peakNotch[0]);
+    EXPECT_EQ(0, peakNotch[1]);
+    EXPECT_EQ(-1, peakNotch[2]);
+}
+
+TEST(SensorGyroAnalyse, WindowMaxFitsGyroCycle)
+{
+    EXPECT_EQ(32, gyroDataAnalyseWindowMax(31));   // 32kHz
+    EXPECT_EQ(64, gyroDataAnalyseWindowMax(125));  // 8kHz
+    EXPECT_EQ(128, gyroDataAnalyseWindowMax(250)); // 4kHz
+    EXPECT_EQ(256, gyroDataAnalyseWindowMax(500)); // 2kHz
+    EXPECT_EQ(256, gyroDataAnalyseWindowMax(1000));
+}
+
+// STUBS
+
+extern "C" {
+uint32_t micros(void) {return 0;}
+
+arm_status arm_rfft_fast_init_f32(arm_rfft_fast_instance_f32 *, uint16_t) {return ARM_MATH_SUCCESS;}
+void arm_cmplx_mag_f32(float32_t *, float32_t *, uint32_t) {}
+void arm_mult_f32(float32_t *, float32_t *, float32_t *, uint32_t) {}
+void stage_rfft_f32(arm_rfft_fast_instance_f32 *, float32_t *, float32_t *) {}
+void arm_cfft_radix8by2_f32(arm_cfft_instance_f32 *, float32_t *) {}
+void arm_cfft_radix8by4_f32(arm_cfft_instance_f32 *, float32_t *) {}
+void arm_radix8_butterfly_f32(float32_t *, uint16_t, const float32_t *, uint16_t) {}
+void arm_bitreversal_32(uint32_t *, const uint16_t, const uint16_t *) {}
+}
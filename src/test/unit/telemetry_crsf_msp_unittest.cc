@@ -271,8 +271,9 @@ extern "C" {
 
     bool isAirmodeActive(void) {return true;}
 
-    mspResult_e mspFcProcessCommand(mspPacket_t *cmd, mspPacket_t *reply, mspPostProcessFnPtr *mspPostProcessFn) {
+    mspResult_e mspFcProcessCommand(struct serialPort_s *srcPort, mspPacket_t *cmd, mspPacket_t *reply, mspPostProcessFnPtr *mspPostProcessFn) {
 
+        UNUSED(srcPort);
         UNUSED(mspPostProcessFn);
 
         sbuf_t *dst = &reply->buf;
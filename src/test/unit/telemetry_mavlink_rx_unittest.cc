@@ -0,0 +1,178 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stdint.h>
+#include <string.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "build/debug.h"
+
+    #include "pg/pg.h"
+
+    #include "flight/ol_filter.h"
+    #include "flight/ol_navigation.h"
+
+    #include "telemetry/mavlink_rx.h"
+
+    int16_t debug[DEBUG16_VALUE_COUNT];
+    uint8_t debugMode;
+    struct dronerace_vision_struct dr_vision;
+    olNavigationConfig_t olNavigationConfig_System;
+
+    void ol_filter_push_vision(float dx, float dy, float dz, timeUs_t time)
+    {
+        dr_vision.dx = dx;
+        dr_vision.dy = dy;
+        dr_vision.dz = dz;
+        dr_vision.time = time;
+        dr_vision.cnt++;
+    }
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+static mavlinkRxMessage_t visionMessage(timeUs_t rxTimeUs, float x)
+{
+    mavlinkRxMessage_t msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.type = MAVLINK_RX_VISION;
+    msg.rxTimeUs = rxTimeUs;
+    msg.data.vision.x = x;
+    return msg;
+}
+
+TEST(MavlinkRxTest, QueueKeepsOrder)
+{
+    mavlinkRxReset();
+
+    for (int i = 0; i < 5; i++) {
+        const mavlinkRxMessage_t msg = visionMessage(1000 + i, i);
+        EXPECT_TRUE(mavlinkRxPush(&msg));
+    }
+
+    mavlinkRxMessage_t msg;
+    for (int i = 0; i < 5; i++) {
+        EXPECT_TRUE(mavlinkRxPop(&msg, 2000));
+        EXPECT_EQ((timeUs_t)(1000 + i), msg.rxTimeUs);
+        EXPECT_FLOAT_EQ(i, msg.data.vision.x);
+    }
+    EXPECT_FALSE(mavlinkRxPop(&msg, 2000));
+}
+
+TEST(MavlinkRxTest, FullQueueDropsNewest)
+{
+    mavlinkRxReset();
+
+    // wrap the free running indices a few times
+    mavlinkRxMessage_t msg;
+    for (int i = 0; i < 300; i++) {
+        msg = visionMessage(i, i);
+        mavlinkRxPush(&msg);
+        mavlinkRxPop(&msg, i);
+    }
+
+    for (int i = 0; i < MAVLINK_RX_QUEUE_SIZE; i++) {
+        msg = visionMessage(1000 + i, i);
+        EXPECT_TRUE(mavlinkRxPush(&msg));
+    }
+    msg = visionMessage(5000, 99);
+    EXPECT_FALSE(mavlinkRxPush(&msg));
+
+    const mavlinkRxStats_t *stats = mavlinkRxGetStats(MAVLINK_RX_VISION);
+    EXPECT_EQ(300u + MAVLINK_RX_QUEUE_SIZE, stats->received);
+    EXPECT_EQ(1u, stats->dropped);
+
+    EXPECT_TRUE(mavlinkRxPop(&msg, 2000));
+    EXPECT_FLOAT_EQ(0, msg.data.vision.x);
+}
+
+TEST(MavlinkRxTest, ProcessAppliesVisionWithCaptureTime)
+{
+    mavlinkRxReset();
+    olNavigationConfig_System.vision_latency_ms = 40;
+    dr_vision.cnt = 0;
+
+    mavlinkRxMessage_t msg = visionMessage(100000, 1.5f);
+    msg.data.vision.y = -0.5f;
+    msg.data.vision.z = 0.2f;
+    mavlinkRxPush(&msg);
+
+    mavlinkRxProcess(103000);
+
+    EXPECT_EQ(1, dr_vision.cnt);
+    EXPECT_FLOAT_EQ(1.5f, dr_vision.dx);
+    EXPECT_FLOAT_EQ(-0.5f, dr_vision.dy);
+    EXPECT_FLOAT_EQ(0.2f, dr_vision.dz);
+    EXPECT_EQ((timeUs_t)60000, dr_vision.time);
+
+    const mavlinkRxStats_t *stats = mavlinkRxGetStats(MAVLINK_RX_VISION);
+    EXPECT_EQ(3000u, stats->latencyAvgUs);
+    EXPECT_EQ(3000u, stats->latencyMaxUs);
+}
+
+TEST(MavlinkRxTest, RateOverWindow)
+{
+    mavlinkRxReset();
+    mavlinkRxProcess(0);
+
+    // 50 Hz for one second
+    for (int i = 0; i < 50; i++) {
+        const mavlinkRxMessage_t msg = visionMessage(i * 20000, 0);
+        mavlinkRxPush(&msg);
+        mavlinkRxProcess(i * 20000 + 1000);
+    }
+    mavlinkRxProcess(MAVLINK_RX_RATE_WINDOW_US);
+
+    EXPECT_EQ(50, mavlinkRxGetStats(MAVLINK_RX_VISION)->rateHz);
+    EXPECT_EQ(0, mavlinkRxGetStats(MAVLINK_RX_SETPOINT)->rateHz);
+}
+
+TEST(MavlinkRxTest, LinkHealth)
+{
+    mavlinkRxReset();
+    EXPECT_EQ(MAVLINK_LINK_NONE, mavlinkRxLinkHealth(1000));
+
+    // the link test message does not count as the camera being alive
+    mavlinkRxMessage_t msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.type = MAVLINK_RX_HIGHRES_IMU;
+    msg.rxTimeUs = 1000;
+    mavlinkRxPush(&msg);
+    EXPECT_EQ(MAVLINK_LINK_NONE, mavlinkRxLinkHealth(1000));
+
+    msg.type = MAVLINK_RX_SETPOINT;
+    mavlinkRxPush(&msg);
+    EXPECT_EQ(MAVLINK_LINK_OK, mavlinkRxLinkHealth(1000 + MAVLINK_RX_STALE_US));
+    EXPECT_EQ(MAVLINK_LINK_STALE, mavlinkRxLinkHealth(1001 + MAVLINK_RX_STALE_US));
+    EXPECT_EQ(MAVLINK_LINK_LOST, mavlinkRxLinkHealth(1001 + MAVLINK_RX_LOST_US));
+
+    // recovers on the next message
+    msg = visionMessage(2000000, 0);
+    mavlinkRxPush(&msg);
+    EXPECT_EQ(MAVLINK_LINK_OK, mavlinkRxLinkHealth(2000000));
+}
+
+TEST(MavlinkRxTest, LostFrames)
+{
+    mavlinkRxReset();
+    mavlinkRxCountLost(3, 0);
+    mavlinkRxCountLost(0, 2);
+    EXPECT_EQ(3u, mavlinkRxGetLostFrames());
+    EXPECT_EQ(2u, mavlinkRxGetCrcErrors());
+}